@@ -46,6 +46,7 @@ LOCAL_SRC_FILES := \
 	$(MY_ROOT)/fitz/obj_print.c \
 	$(MY_ROOT)/fitz/res_colorspace.c \
 	$(MY_ROOT)/fitz/res_font.c \
+	$(MY_ROOT)/fitz/res_image.c \
 	$(MY_ROOT)/fitz/res_path.c \
 	$(MY_ROOT)/fitz/res_pixmap.c \
 	$(MY_ROOT)/fitz/res_shade.c \
@@ -77,8 +78,10 @@ LOCAL_SRC_FILES := \
 	$(MY_ROOT)/pdf/pdf_fontfile.c \
 	$(MY_ROOT)/pdf/pdf_function.c \
 	$(MY_ROOT)/pdf/pdf_image.c \
+	$(MY_ROOT)/pdf/pdf_index.c \
 	$(MY_ROOT)/pdf/pdf_interpret.c \
 	$(MY_ROOT)/pdf/pdf_lex.c \
+	$(MY_ROOT)/pdf/pdf_linear.c \
 	$(MY_ROOT)/pdf/pdf_metrics.c \
 	$(MY_ROOT)/pdf/pdf_nametree.c \
 	$(MY_ROOT)/pdf/pdf_outline.c \
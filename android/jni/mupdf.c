@@ -20,6 +20,7 @@
 /* Globals */
 fz_colorspace *colorspace;
 fz_glyph_cache *glyphcache;
+fz_image_cache *imagecache;
 pdf_xref *xref;
 int pagenum = 1;
 int resolution = 160;
@@ -48,6 +49,7 @@ Java_com_artifex_mupdf_MuPDFCore_openFile(JNIEnv * env, jobject thiz, jstring jf
 	if (accelerate)
 		fz_accelerate();
 	glyphcache = fz_new_glyph_cache();
+	imagecache = fz_new_image_cache();
 	colorspace = fz_device_rgb;
 
 	LOGE("Opening document...");
@@ -189,7 +191,7 @@ Java_com_artifex_mupdf_MuPDFCore_drawPage(JNIEnv *env, jobject thiz, jobject bit
 	yscale = (float)pageH/(float)(bbox.y1-bbox.y0);
 	ctm = fz_concat(ctm, fz_scale(xscale, yscale));
 	bbox = fz_round_rect(fz_transform_rect(ctm,currentMediabox));
-	dev = fz_new_draw_device(glyphcache, pix);
+	dev = fz_new_draw_device(glyphcache, imagecache, pix);
 	fz_execute_display_list(currentPageList, dev, ctm, bbox);
 	fz_free_device(dev);
 	fz_drop_pixmap(pix);
@@ -209,4 +211,6 @@ Java_com_artifex_mupdf_MuPDFCore_destroying(JNIEnv * env, jobject thiz)
 	xref = NULL;
 	fz_free_glyph_cache(glyphcache);
 	glyphcache = NULL;
+	fz_free_image_cache(imagecache);
+	imagecache = NULL;
 }
@@ -187,6 +187,7 @@ void pdfapp_open(pdfapp_t *app, char *filename, int fd, int reload)
 		pdfapp_open_pdf(app, filename, fd);
 
 	app->cache = fz_new_glyph_cache();
+	app->images = fz_new_image_cache();
 
 	if (app->pageno < 1)
 		app->pageno = 1;
@@ -214,6 +215,10 @@ void pdfapp_close(pdfapp_t *app)
 		fz_free_glyph_cache(app->cache);
 	app->cache = NULL;
 
+	if (app->images)
+		fz_free_image_cache(app->images);
+	app->images = NULL;
+
 	if (app->image)
 		fz_drop_pixmap(app->image);
 	app->image = NULL;
@@ -307,6 +312,7 @@ static void pdfapp_loadpage_pdf(pdfapp_t *app)
 	pdf_free_page(page);
 
 	pdf_age_store(app->xref->store, 3);
+	pdf_trim_object_cache(app->xref);
 }
 
 static void pdfapp_loadpage_xps(pdfapp_t *app)
@@ -395,7 +401,7 @@ static void pdfapp_showpage(pdfapp_t *app, int loadpage, int drawpage, int repai
 #endif
 		app->image = fz_new_pixmap_with_rect(colorspace, bbox);
 		fz_clear_pixmap_with_color(app->image, 255);
-		idev = fz_new_draw_device(app->cache, app->image);
+		idev = fz_new_draw_device(app->cache, app->images, app->image);
 		fz_execute_display_list(app->page_list, idev, ctm, bbox);
 		fz_free_device(idev);
 	}
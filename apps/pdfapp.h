@@ -36,6 +36,7 @@ struct pdfapp_s
 
 	int pagecount;
 	fz_glyph_cache *cache;
+	fz_image_cache *images;
 
 	/* current view params */
 	int resolution;
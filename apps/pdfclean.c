@@ -123,8 +123,8 @@ static void removeduplicateobjs(void)
 			if (pdf_is_stream(xref, num, 0) || pdf_is_stream(xref, other, 0))
 				continue;
 
-			a = xref->table[num].obj;
-			b = xref->table[other].obj;
+			a = pdf_get_cached_object(xref, num);
+			b = pdf_get_cached_object(xref, other);
 
 			a = fz_resolve_indirect(a);
 			b = fz_resolve_indirect(b);
@@ -225,7 +225,7 @@ static void renumberobjs(void)
 	renumberobj(xref->trailer);
 	for (num = 0; num < xref->len; num++)
 	{
-		fz_obj *obj = xref->table[num].obj;
+		fz_obj *obj = pdf_get_cached_object(xref, num);
 
 		if (fz_is_indirect(obj))
 		{
@@ -239,6 +239,11 @@ static void renumberobjs(void)
 		}
 	}
 
+	/* Drop the objects we don't need any more */
+	for (num = 1; num < xref->len; num++)
+		if (!uselist[num])
+			pdf_drop_cached_object(xref, num);
+
 	/* Create new table for the reordered, compacted xref */
 	oldxref = xref->table;
 	xref->table = fz_calloc(xref->len, sizeof(pdf_xref_entry));
@@ -254,11 +259,6 @@ static void renumberobjs(void)
 				newlen = renumbermap[num];
 			xref->table[renumbermap[num]] = oldxref[num];
 		}
-		else
-		{
-			if (oldxref[num].obj)
-				fz_drop_obj(oldxref[num].obj);
-		}
 	}
 
 	fz_free(oldxref);
@@ -277,8 +277,10 @@ static void renumberobjs(void)
 
 static void retainpages(int argc, char **argv)
 {
+	static char *inherit[] = { "Resources", "MediaBox", "CropBox", "Rotate" };
 	fz_error error;
 	fz_obj *oldroot, *root, *pages, *kids, *countobj, *parent;
+	int i;
 
 	/* Load the old page tree */
 	error = pdf_load_page_tree(xref);
@@ -336,8 +338,16 @@ static void retainpages(int argc, char **argv)
 
 			for (page = spage; page <= epage; page++)
 			{
-				fz_obj *pageobj = xref->page_objs[page-1];
-				fz_obj *pageref = xref->page_refs[page-1];
+				fz_obj *pageobj = pdf_lookup_page_object(xref, page-1);
+				fz_obj *pageref = pdf_lookup_page_ref(xref, page-1);
+
+				/* the page loses its old parents, so copy down what it inherits from them */
+				for (i = 0; i < nelem(inherit); i++)
+				{
+					fz_obj *obj = pdf_lookup_inherited_page_item(pageobj, inherit[i]);
+					if (obj && !fz_dict_gets(pageobj, inherit[i]))
+						fz_dict_puts(pageobj, inherit[i], obj);
+				}
 
 				fz_dict_puts(pageobj, "Parent", parent);
 
@@ -714,6 +724,10 @@ int main(int argc, char **argv)
 	if (error)
 		die(fz_rethrow(error, "cannot open input file '%s'", infile));
 
+	error = pdf_load_full_xref(xref);
+	if (error)
+		die(fz_rethrow(error, "cannot load xref of input file '%s'", infile));
+
 	out = fopen(outfile, "wb");
 	if (!out)
 		die(fz_throw("cannot open output file '%s'", outfile));
@@ -27,9 +27,11 @@ int uselist = 1;
 int alphabits = 8;
 float gamma_value = 1;
 int invert = 0;
+int useindex = 0;
 
 fz_colorspace *colorspace;
 fz_glyph_cache *glyphcache;
+fz_image_cache *imagecache;
 char *filename;
 
 struct {
@@ -66,11 +68,24 @@ static void usage(void)
 		"\t-n\t show the number of pages\n"
 		"\t-R -\trotate clockwise by given number of degrees\n"
 		"\t-G gamma\tgamma correct output\n"
+		"\t-c\tuse or write a document index (input.pdf.idx)\n"
 		// "\t-I\tinvert output\n"
 		"\tpages\tcomma separated list of ranges\n");
 	exit(1);
 }
 
+static fz_error openxref(pdf_xref **xrefp, char *filename, char *password)
+{
+	char indexname[1024];
+
+	if (!useindex)
+		return pdf_open_xref(xrefp, filename, password);
+
+	fz_strlcpy(indexname, filename, sizeof indexname);
+	fz_strlcat(indexname, ".idx", sizeof indexname);
+	return pdf_open_xref_with_index(xrefp, filename, password, indexname);
+}
+
 static int gettime(void)
 {
 	static struct timeval first;
@@ -225,7 +240,7 @@ void drawpage(pdf_xref *xref, int pagenum)
 		else
 			fz_clear_pixmap_with_color(pix, 255);
 
-		dev = fz_new_draw_device(glyphcache, pix);
+		dev = fz_new_draw_device(glyphcache, imagecache, pix);
 		if (list)
 			fz_execute_display_list(list, dev, ctm, bbox);
 		else
@@ -304,6 +319,7 @@ void drawpage(pdf_xref *xref, int pagenum)
 		printf("\n");
 
 	pdf_age_store(xref->store, 3);
+	pdf_trim_object_cache(xref);
 
 	fz_flush_warnings();
 
@@ -361,7 +377,7 @@ int main(int argc, char **argv)
 	fz_error error;
 	int c;
 
-	while ((c = fz_getopt(argc, argv, "o:p:r:j:R:Aab:dgmthJxn5G:I")) != -1)
+	while ((c = fz_getopt(argc, argv, "o:p:r:j:R:Aab:cdgmthJxn5G:I")) != -1)
 	{
 		switch (c)
 		{
@@ -372,6 +388,7 @@ int main(int argc, char **argv)
 		case 'A': accelerate = 0; break;
 		case 'a': savealpha = 1; break;
 		case 'b': alphabits = atoi(fz_optarg); break;
+		case 'c': useindex = 1; break;
 		case 'm': showtime++; break;
 		case 't': showtext++; break;
 		case 'h': showhtml++; break;
@@ -400,7 +417,7 @@ int main(int argc, char **argv)
 
 	if(showpages) {
 		filename = argv[fz_optind++];
-		error = pdf_open_xref(&xref, filename, password);
+		error = openxref(&xref, filename, password);
 		if (error) {
 			die(fz_rethrow(error, "cannot open document: %s", filename));
 		}
@@ -417,6 +434,7 @@ int main(int argc, char **argv)
 		fz_accelerate();
 
 	glyphcache = fz_new_glyph_cache();
+	imagecache = fz_new_image_cache();
 
 	colorspace = fz_device_rgb;
 	if (grayscale)
@@ -441,7 +459,7 @@ int main(int argc, char **argv)
 	{
 		filename = argv[fz_optind++];
 
-		error = pdf_open_xref(&xref, filename, password);
+		error = openxref(&xref, filename, password);
 		if (error)
 			die(fz_rethrow(error, "cannot open document: %s", filename));
 
@@ -476,6 +494,7 @@ int main(int argc, char **argv)
 	}
 
 	fz_free_glyph_cache(glyphcache);
+	fz_free_image_cache(imagecache);
 
 	fz_flush_warnings();
 
@@ -39,6 +39,7 @@ static int isfontdesc(fz_obj *obj)
 static void saveimage(int num)
 {
 	fz_error error;
+	fz_image *image;
 	fz_pixmap *img;
 	fz_obj *ref;
 	char name[1024];
@@ -47,7 +48,11 @@ static void saveimage(int num)
 
 	/* TODO: detect DCTD and save as jpeg */
 
-	error = pdf_load_image(&img, xref, ref);
+	error = pdf_load_image(&image, xref, ref);
+	if (error)
+		die(error);
+
+	error = fz_image_to_pixmap(&img, NULL, image, 0, 0);
 	if (error)
 		die(error);
 
@@ -74,6 +79,7 @@ static void saveimage(int num)
 	}
 
 	fz_drop_pixmap(img);
+	fz_drop_image(image);
 	fz_drop_obj(ref);
 }
 
@@ -200,6 +206,10 @@ int main(int argc, char **argv)
 	if (error)
 		die(fz_rethrow(error, "cannot open input file '%s'", infile));
 
+	error = pdf_load_full_xref(xref);
+	if (error)
+		die(fz_rethrow(error, "cannot load xref of input file '%s'", infile));
+
 	if (fz_optind == argc)
 	{
 		for (o = 0; o < xref->len; o++)
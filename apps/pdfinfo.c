@@ -208,7 +208,7 @@ gatherdimensions(int page, fz_obj *pageref, fz_obj *pageobj)
 	fz_obj *obj;
 	int j;
 
-	obj = fz_dict_gets(pageobj, "MediaBox");
+	obj = pdf_lookup_inherited_page_item(pageobj, "MediaBox");
 	if (!fz_is_array(obj))
 		return;
 
@@ -569,8 +569,8 @@ gatherresourceinfo(int page, fz_obj *rsrc)
 	fz_obj *subrsrc;
 	int i;
 
-	pageobj = xref->page_objs[page-1];
-	pageref = xref->page_refs[page-1];
+	pageobj = pdf_lookup_page_object(xref, page-1);
+	pageref = pdf_lookup_page_ref(xref, page-1);
 
 	if (!pageobj)
 		die(fz_throw("cannot retrieve info from page %d", page));
@@ -632,15 +632,15 @@ gatherpageinfo(int page)
 	fz_obj *pageref;
 	fz_obj *rsrc;
 
-	pageobj = xref->page_objs[page-1];
-	pageref = xref->page_refs[page-1];
+	pageobj = pdf_lookup_page_object(xref, page-1);
+	pageref = pdf_lookup_page_ref(xref, page-1);
 
 	if (!pageobj)
 		die(fz_throw("cannot retrieve info from page %d", page));
 
 	gatherdimensions(page, pageref, pageobj);
 
-	rsrc = fz_dict_gets(pageobj, "Resources");
+	rsrc = pdf_lookup_inherited_page_item(pageobj, "Resources");
 	gatherresourceinfo(page, rsrc);
 }
 
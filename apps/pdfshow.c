@@ -64,7 +64,7 @@ static void showpagetree(void)
 	count = pdf_count_pages(xref);
 	for (i = 0; i < count; i++)
 	{
-		ref = xref->page_refs[i];
+		ref = pdf_lookup_page_ref(xref, i);
 		printf("page %d = %d %d R\n", i + 1, fz_to_num(ref), fz_to_gen(ref));
 	}
 	printf("\n");
@@ -216,6 +216,10 @@ int main(int argc, char **argv)
 	if (error)
 		die(fz_rethrow(error, "cannot open document: %s", filename));
 
+	error = pdf_load_full_xref(xref);
+	if (error)
+		die(fz_rethrow(error, "cannot load xref: %s", filename));
+
 	if (fz_optind == argc)
 		showtrailer();
 
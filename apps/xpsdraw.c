@@ -19,6 +19,7 @@ int uselist = 1;
 
 fz_colorspace *colorspace;
 fz_glyph_cache *glyphcache;
+fz_image_cache *imagecache;
 char *filename;
 
 struct {
@@ -174,7 +175,7 @@ static void drawpage(xps_context *ctx, int pagenum)
 		else
 			fz_clear_pixmap_with_color(pix, 255);
 
-		dev = fz_new_draw_device(glyphcache, pix);
+		dev = fz_new_draw_device(glyphcache, imagecache, pix);
 		if (list)
 			fz_execute_display_list(list, dev, ctm, bbox);
 		else
@@ -315,6 +316,7 @@ int main(int argc, char **argv)
 		fz_accelerate();
 
 	glyphcache = fz_new_glyph_cache();
+	imagecache = fz_new_image_cache();
 
 	colorspace = fz_device_rgb;
 	if (grayscale)
@@ -365,6 +367,7 @@ int main(int argc, char **argv)
 	}
 
 	fz_free_glyph_cache(glyphcache);
+	fz_free_image_cache(imagecache);
 
 	return 0;
 }
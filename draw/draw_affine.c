@@ -2,9 +2,32 @@
 
 typedef unsigned char byte;
 
-static inline float roundup(float x)
+/* Move the edges of a rectilinear image out to pixel boundaries */
+static fz_matrix
+fz_gridfit_matrix(fz_matrix m)
 {
-	return (x < 0) ? floorf(x) : ceilf(x);
+	fz_rect r = fz_transform_rect(m, fz_unit_rect);
+	float x0 = floorf(r.x0), y0 = floorf(r.y0);
+	float x1 = ceilf(r.x1), y1 = ceilf(r.y1);
+
+	if (fabsf(m.b) < FLT_EPSILON && fabsf(m.c) < FLT_EPSILON)
+	{
+		m.b = m.c = 0;
+		m.e = m.a > 0 ? x0 : x1;
+		m.a = m.a > 0 ? x1 - x0 : x0 - x1;
+		m.f = m.d > 0 ? y0 : y1;
+		m.d = m.d > 0 ? y1 - y0 : y0 - y1;
+	}
+	else
+	{
+		m.a = m.d = 0;
+		m.e = m.c > 0 ? x0 : x1;
+		m.c = m.c > 0 ? x1 - x0 : x0 - x1;
+		m.f = m.b > 0 ? y0 : y1;
+		m.b = m.b > 0 ? y1 - y0 : y0 - y1;
+	}
+
+	return m;
 }
 
 static inline int lerp(int a, int b, int t)
@@ -454,6 +477,59 @@ fz_paint_affine_color_near(byte *dp, byte *sp, int sw, int sh, int u, int v, int
 	}
 }
 
+/* Special case code for images drawn pixel for pixel */
+
+static void
+fz_paint_span_g2rgb(byte *dp, byte *sp, int w, int alpha)
+{
+	while (w--)
+	{
+		int x = sp[0];
+		int a = sp[1];
+		int t;
+		if (alpha < 255)
+		{
+			x = fz_mul255(x, alpha);
+			a = fz_mul255(a, alpha);
+		}
+		t = 255 - a;
+		dp[0] = x + fz_mul255(dp[0], t);
+		dp[1] = x + fz_mul255(dp[1], t);
+		dp[2] = x + fz_mul255(dp[2], t);
+		dp[3] = a + fz_mul255(dp[3], t);
+		dp += 4;
+		sp += 2;
+	}
+}
+
+static void
+fz_paint_image_rows(fz_pixmap *dst, byte *dp, fz_pixmap *img, int u, int v, int fd, int w, int h, int alpha)
+{
+	int ui = u >> 16;
+	int x0 = MAX(0, -ui);
+	int x1 = MIN(w, img->w - ui);
+	int n = dst->n;
+
+	if (x1 <= x0)
+		return;
+
+	dp += x0 * n;
+	while (h--)
+	{
+		int vi = v >> 16;
+		if (vi >= 0 && vi < img->h)
+		{
+			byte *sp = img->samples + (vi * img->w + ui + x0) * img->n;
+			if (img->n == n)
+				fz_paint_span(dp, sp, n, x1 - x0, alpha);
+			else
+				fz_paint_span_g2rgb(dp, sp, x1 - x0, alpha);
+		}
+		dp += dst->w * n;
+		v += fd;
+	}
+}
+
 /* Draw an image with an affine transform on destination */
 
 static void
@@ -470,22 +546,16 @@ fz_paint_image_imp(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_pixmap
 
 	/* grid fit the image */
 	if (fz_is_rectilinear(ctm))
-	{
-		ctm.a = roundup(ctm.a);
-		ctm.b = roundup(ctm.b);
-		ctm.c = roundup(ctm.c);
-		ctm.d = roundup(ctm.d);
-		ctm.e = floorf(ctm.e);
-		ctm.f = floorf(ctm.f);
-	}
+		ctm = fz_gridfit_matrix(ctm);
 
 	/* turn on interpolation for upscaled and non-rectilinear transforms */
+	/* but not when stretched by a pixel to fit the grid */
 	dolerp = 0;
 	if (!fz_is_rectilinear(ctm))
 		dolerp = 1;
-	if (sqrtf(ctm.a * ctm.a + ctm.b * ctm.b) > img->w)
+	if (sqrtf(ctm.a * ctm.a + ctm.b * ctm.b) > img->w + 1)
 		dolerp = 1;
-	if (sqrtf(ctm.c * ctm.c + ctm.d * ctm.d) > img->h)
+	if (sqrtf(ctm.c * ctm.c + ctm.d * ctm.d) > img->h + 1)
 		dolerp = 1;
 
 	/* except when we shouldn't, at large magnifications */
@@ -535,7 +605,12 @@ fz_paint_image_imp(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_pixmap
 		hp = NULL;
 	}
 
-	/* TODO: if (fb == 0 && fa == 1) call fz_paint_span */
+	/* images drawn pixel for pixel across are painted a row at a time */
+	if (fa == 65536 && fb == 0 && fc == 0 && !dolerp && !color && !shape)
+	{
+		fz_paint_image_rows(dst, dp, img, u, v, fd, w, h, alpha);
+		return;
+	}
 
 	if (dst->n == 4 && img->n == 2)
 	{
@@ -586,3 +661,262 @@ fz_paint_image(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_pixmap *img
 	assert(dst->n == img->n || (dst->n == 4 && img->n == 2));
 	fz_paint_image_imp(dst, scissor, shape, img, ctm, NULL, alpha);
 }
+
+/*
+ * Draw a packed bitmap with an affine transform on destination. The
+ * coverage of each destination pixel is sampled straight from the bits:
+ * from the nearest bit or the four around it when the bitmap is drawn
+ * at or above its size, and from an ss by ss grid of bits spread over
+ * the pixel's footprint when it is drawn smaller.
+ */
+
+static inline int
+bit_nearest(byte *s, int stride, int w, int h, int u, int v)
+{
+	if (u < 0) u = 0;
+	if (v < 0) v = 0;
+	if (u >= w) u = w - 1;
+	if (v >= h) v = h - 1;
+	return (s[v * stride + (u >> 3)] >> (7 - (u & 7))) & 1;
+}
+
+static void
+fz_sample_bitmap_row(int *cov, fz_bitmap *bit, int u, int v, int fa, int fb, int fc, int fd, int w, int ss, int dolerp)
+{
+	byte *sp = bit->samples;
+	int stride = bit->stride;
+	int sw = bit->w;
+	int sh = bit->h;
+	int sa = fa / ss, sb = fb / ss, sc = fc / ss, sd = fd / ss;
+	int ou = (sa - fa + sc - fc) >> 1;
+	int ov = (sb - fb + sd - fd) >> 1;
+	int area = ss * ss;
+	int i, j, count;
+
+	while (w--)
+	{
+		int ui = u >> 16;
+		int vi = v >> 16;
+		if (ui >= 0 && ui < sw && vi >= 0 && vi < sh)
+		{
+			if (ss > 1)
+			{
+				int ru = u + ou;
+				int rv = v + ov;
+				count = 0;
+				for (j = 0; j < ss; j++)
+				{
+					int cu = ru;
+					int cv = rv;
+					for (i = 0; i < ss; i++)
+					{
+						count += bit_nearest(sp, stride, sw, sh, cu >> 16, cv >> 16);
+						cu += sa;
+						cv += sb;
+					}
+					ru += sc;
+					rv += sd;
+				}
+				*cov = count * 255 / area;
+			}
+			else if (dolerp)
+			{
+				int uf = u & 0xffff;
+				int vf = v & 0xffff;
+				int a = bit_nearest(sp, stride, sw, sh, ui, vi) * 255;
+				int b = bit_nearest(sp, stride, sw, sh, ui+1, vi) * 255;
+				int c = bit_nearest(sp, stride, sw, sh, ui, vi+1) * 255;
+				int d = bit_nearest(sp, stride, sw, sh, ui+1, vi+1) * 255;
+				*cov = bilerp(a, b, c, d, uf, vf);
+			}
+			else
+			{
+				*cov = ((sp[vi * stride + (ui >> 3)] >> (7 - (ui & 7))) & 1) * 255;
+			}
+		}
+		else
+		{
+			*cov = -1;
+		}
+		cov++;
+		u += fa;
+		v += fb;
+	}
+}
+
+/* Blend non-premultiplied color over destination where bits are set */
+
+static inline void
+fz_paint_bitmap_color_N(byte *dp, int *cov, int w, int n, byte *color, byte *hp)
+{
+	int n1 = n - 1;
+	int sa = color[n1];
+	int k;
+
+	while (w--)
+	{
+		int ma = *cov++;
+		if (ma > 0)
+		{
+			int masa = FZ_COMBINE(FZ_EXPAND(ma), sa);
+			for (k = 0; k < n1; k++)
+				dp[k] = FZ_BLEND(color[k], dp[k], masa);
+			dp[n1] = FZ_BLEND(255, dp[n1], masa);
+			if (hp)
+				hp[0] = FZ_BLEND(255, hp[0], masa);
+		}
+		dp += n;
+		if (hp)
+			hp++;
+	}
+}
+
+/* Blend black where bits are clear and white where they are set */
+
+static inline void
+fz_paint_bitmap_gray_N(byte *dp, int *cov, int w, int n, byte *black, byte *white, int alpha, byte *hp)
+{
+	int n1 = n - 1;
+	int sa = FZ_EXPAND(alpha);
+	int k;
+
+	while (w--)
+	{
+		int ma = *cov++;
+		if (ma >= 0)
+		{
+			ma = FZ_EXPAND(ma);
+			for (k = 0; k < n1; k++)
+			{
+				int x = black[k] + (((white[k] - black[k]) * ma) >> 8);
+				dp[k] = FZ_BLEND(x, dp[k], sa);
+			}
+			dp[n1] = FZ_BLEND(255, dp[n1], sa);
+			if (hp)
+				hp[0] = FZ_BLEND(255, hp[0], sa);
+		}
+		dp += n;
+		if (hp)
+			hp++;
+	}
+}
+
+static void
+fz_paint_bitmap_imp(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_bitmap *bit, fz_matrix ctm, byte *color, byte *black, byte *white, int alpha)
+{
+	byte *dp, *hp;
+	int *cov;
+	int u, v, fa, fb, fc, fd;
+	int x, y, w, h;
+	int n, hw, ss;
+	float sx, sy;
+	fz_matrix inv;
+	fz_bbox bbox;
+	int dolerp;
+
+	/* grid fit the image */
+	if (fz_is_rectilinear(ctm))
+		ctm = fz_gridfit_matrix(ctm);
+
+	/* interpolate as fz_paint_image does for images without /Interpolate */
+	dolerp = 0;
+	if (!fz_is_rectilinear(ctm))
+		dolerp = 1;
+	if (sqrtf(ctm.a * ctm.a + ctm.b * ctm.b) > bit->w)
+		dolerp = 1;
+	if (sqrtf(ctm.c * ctm.c + ctm.d * ctm.d) > bit->h)
+		dolerp = 1;
+	if (sqrtf(ctm.a * ctm.a + ctm.b * ctm.b) > bit->w * 2)
+		dolerp = 0;
+	if (sqrtf(ctm.c * ctm.c + ctm.d * ctm.d) > bit->h * 2)
+		dolerp = 0;
+
+	bbox = fz_round_rect(fz_transform_rect(ctm, fz_unit_rect));
+	bbox = fz_intersect_bbox(bbox, scissor);
+	x = bbox.x0;
+	y = bbox.y0;
+	w = bbox.x1 - bbox.x0;
+	h = bbox.y1 - bbox.y0;
+	if (w <= 0 || h <= 0)
+		return;
+
+	/* map from screen space (x,y) to image space (u,v) */
+	inv = fz_scale(1.0f / bit->w, -1.0f / bit->h);
+	inv = fz_concat(inv, fz_translate(0, 1));
+	inv = fz_concat(inv, ctm);
+	inv = fz_invert_matrix(inv);
+
+	fa = inv.a * 65536;
+	fb = inv.b * 65536;
+	fc = inv.c * 65536;
+	fd = inv.d * 65536;
+
+	/* average a grid of bits when several fall in one pixel */
+	sx = sqrtf(inv.a * inv.a + inv.b * inv.b);
+	sy = sqrtf(inv.c * inv.c + inv.d * inv.d);
+	ss = CLAMP(ceilf(MAX(sx, sy) - 0.01f), 1, 64);
+
+	/* Calculate initial texture positions. Do a half step to start. */
+	u = (fa * x) + (fc * y) + inv.e * 65536 + ((fa + fc) >> 1);
+	v = (fb * x) + (fd * y) + inv.f * 65536 + ((fb + fd) >> 1);
+
+	dp = dst->samples + ((y - dst->y) * dst->w + (x - dst->x)) * dst->n;
+	n = dst->n;
+	if (shape)
+	{
+		hw = shape->w;
+		hp = shape->samples + ((y - shape->y) * hw) + x - dst->x;
+	}
+	else
+	{
+		hw = 0;
+		hp = NULL;
+	}
+
+	cov = fz_calloc(w, sizeof(int));
+
+	while (h--)
+	{
+		fz_sample_bitmap_row(cov, bit, u, v, fa, fb, fc, fd, w, ss, dolerp);
+		if (color)
+		{
+			switch (n)
+			{
+			case 1: fz_paint_bitmap_color_N(dp, cov, w, 1, color, hp); break;
+			case 2: fz_paint_bitmap_color_N(dp, cov, w, 2, color, hp); break;
+			case 4: fz_paint_bitmap_color_N(dp, cov, w, 4, color, hp); break;
+			default: fz_paint_bitmap_color_N(dp, cov, w, n, color, hp); break;
+			}
+		}
+		else
+		{
+			switch (n)
+			{
+			case 2: fz_paint_bitmap_gray_N(dp, cov, w, 2, black, white, alpha, hp); break;
+			case 4: fz_paint_bitmap_gray_N(dp, cov, w, 4, black, white, alpha, hp); break;
+			default: fz_paint_bitmap_gray_N(dp, cov, w, n, black, white, alpha, hp); break;
+			}
+		}
+		dp += dst->w * n;
+		hp += hw;
+		u += fc;
+		v += fd;
+	}
+
+	fz_free(cov);
+}
+
+void
+fz_paint_bitmap_with_color(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_bitmap *bit, fz_matrix ctm, byte *color)
+{
+	assert(bit->n == 1);
+	fz_paint_bitmap_imp(dst, scissor, shape, bit, ctm, color, NULL, NULL, 255);
+}
+
+void
+fz_paint_bitmap(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_bitmap *bit, fz_matrix ctm, byte *black, byte *white, int alpha)
+{
+	assert(bit->n == 1);
+	if (alpha > 0)
+		fz_paint_bitmap_imp(dst, scissor, shape, bit, ctm, NULL, black, white, alpha);
+}
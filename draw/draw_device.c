@@ -37,6 +37,7 @@ enum {
 struct fz_draw_device_s
 {
 	fz_glyph_cache *cache;
+	fz_image_cache *images;
 	fz_gel *gel;
 
 	fz_pixmap *dest;
@@ -895,11 +896,124 @@ fz_transform_pixmap(fz_pixmap *image, fz_matrix *ctm, int x, int y, int dx, int
 	return NULL;
 }
 
+/*
+ * Decode an image at no more than the size it will be drawn at,
+ * unless it lies entirely outside the clip.
+ */
+static fz_pixmap *
+fz_draw_image_pixmap(fz_draw_device *dev, fz_image *image, fz_matrix ctm)
+{
+	fz_error error;
+	fz_pixmap *pixmap;
+	fz_bbox bbox;
+	int w, h;
+
+	if (image->w == 0 || image->h == 0)
+		return NULL;
+
+	bbox = fz_round_rect(fz_transform_rect(ctm, fz_unit_rect));
+	if (fz_is_empty_bbox(fz_intersect_bbox(bbox, dev->scissor)))
+		return NULL;
+
+	/* to the nearest pixel, so that a page image can still be halved */
+	w = CLAMP(floorf(sqrtf(ctm.a * ctm.a + ctm.b * ctm.b) + 0.5f), 1, 1 << 16);
+	h = CLAMP(floorf(sqrtf(ctm.c * ctm.c + ctm.d * ctm.d) + 0.5f), 1, 1 << 16);
+
+	error = fz_image_to_pixmap(&pixmap, dev->images, image, w, h);
+	if (error)
+	{
+		fz_catch(error, "cannot draw image");
+		return NULL;
+	}
+
+	if (pixmap->w == 0 || pixmap->h == 0)
+	{
+		fz_drop_pixmap(pixmap);
+		return NULL;
+	}
+
+	return pixmap;
+}
+
+/*
+ * Bilevel images are drawn straight from their packed samples, except
+ * in type 3 glyphs which must not be grid fitted.
+ */
+static int
+fz_draw_use_bitmap(fz_draw_device *dev, fz_image *image)
+{
+	return image->load_bitmap && !(dev->flags & FZ_DRAWDEV_FLAGS_TYPE3);
+}
+
+/*
+ * Get the packed samples of a bilevel image at full size, unless it
+ * lies entirely outside the clip.
+ */
+static fz_bitmap *
+fz_draw_image_bitmap(fz_draw_device *dev, fz_image *image, fz_matrix ctm)
+{
+	fz_error error;
+	fz_bitmap *bitmap;
+	fz_bbox bbox;
+
+	if (image->w == 0 || image->h == 0)
+		return NULL;
+
+	bbox = fz_round_rect(fz_transform_rect(ctm, fz_unit_rect));
+	if (fz_is_empty_bbox(fz_intersect_bbox(bbox, dev->scissor)))
+		return NULL;
+
+	error = fz_image_to_bitmap(&bitmap, dev->images, image);
+	if (error)
+	{
+		fz_catch(error, "cannot draw image");
+		return NULL;
+	}
+
+	return bitmap;
+}
+
+static void
+fz_draw_fill_image_bitmap(fz_draw_device *dev, fz_image *image, fz_matrix ctm, float alpha)
+{
+	fz_colorspace *model = dev->dest->colorspace;
+	unsigned char black[FZ_MAX_COLORS];
+	unsigned char white[FZ_MAX_COLORS];
+	float colorfv[FZ_MAX_COLORS];
+	float gray;
+	fz_bitmap *bitmap;
+	int i;
+
+	bitmap = fz_draw_image_bitmap(dev, image, ctm);
+	if (!bitmap)
+		return;
+
+	if (dev->blendmode & FZ_BLEND_KNOCKOUT)
+		fz_knockout_begin(dev);
+
+	gray = 0;
+	fz_convert_color(fz_device_gray, &gray, model, colorfv);
+	for (i = 0; i < model->n; i++)
+		black[i] = colorfv[i] * 255;
+	gray = 1;
+	fz_convert_color(fz_device_gray, &gray, model, colorfv);
+	for (i = 0; i < model->n; i++)
+		white[i] = colorfv[i] * 255;
+
+	fz_paint_bitmap(dev->dest, dev->scissor, dev->shape, bitmap, ctm, black, white, alpha * 255);
+
+	fz_drop_bitmap(bitmap);
+
+	if (dev->blendmode & FZ_BLEND_KNOCKOUT)
+		fz_knockout_end(dev);
+}
+
 static void
-fz_draw_fill_image(void *user, fz_pixmap *image, fz_matrix ctm, float alpha)
+fz_draw_fill_image(void *user, fz_image *image, fz_matrix ctm, float alpha)
 {
 	fz_draw_device *dev = user;
 	fz_colorspace *model = dev->dest->colorspace;
+	fz_pixmap *pixmap, *orig;
 	fz_pixmap *converted = NULL;
 	fz_pixmap *scaled = NULL;
 	int after;
@@ -911,7 +1025,14 @@ fz_draw_fill_image(void *user, fz_pixmap *image, fz_matrix ctm, float alpha)
 		return;
 	}
 
-	if (image->w == 0 || image->h == 0)
+	if (fz_draw_use_bitmap(dev, image) && image->colorspace == fz_device_gray)
+	{
+		fz_draw_fill_image_bitmap(dev, image, ctm, alpha);
+		return;
+	}
+
+	orig = pixmap = fz_draw_image_pixmap(dev, image, ctm);
+	if (!pixmap)
 		return;
 
 	/* convert images with more components (cmyk->rgb) before scaling */
@@ -922,94 +1043,107 @@ fz_draw_fill_image(void *user, fz_pixmap *image, fz_matrix ctm, float alpha)
 		fz_knockout_begin(dev);
 
 	after = 0;
-	if (image->colorspace == fz_device_gray)
+	if (pixmap->colorspace == fz_device_gray)
 		after = 1;
 
-	if (image->colorspace != model && !after)
+	if (pixmap->colorspace != model && !after)
 	{
-		converted = fz_new_pixmap_with_rect(model, fz_bound_pixmap(image));
-		fz_convert_pixmap(image, converted);
-		image = converted;
+		converted = fz_new_pixmap_with_rect(model, fz_bound_pixmap(pixmap));
+		fz_convert_pixmap(pixmap, converted);
+		pixmap = converted;
 	}
 
 	dx = sqrtf(ctm.a * ctm.a + ctm.b * ctm.b);
 	dy = sqrtf(ctm.c * ctm.c + ctm.d * ctm.d);
-	if (dx < image->w && dy < image->h)
+	if (dx < pixmap->w && dy < pixmap->h)
 	{
 		int gridfit = alpha == 1.0f && !(dev->flags & FZ_DRAWDEV_FLAGS_TYPE3);
-		scaled = fz_transform_pixmap(image, &ctm, dev->dest->x, dev->dest->y, dx, dy, gridfit);
+		scaled = fz_transform_pixmap(pixmap, &ctm, dev->dest->x, dev->dest->y, dx, dy, gridfit);
 		if (scaled == NULL)
 		{
 			if (dx < 1)
 				dx = 1;
 			if (dy < 1)
 				dy = 1;
-			scaled = fz_scale_pixmap(image, image->x, image->y, dx, dy);
+			scaled = fz_scale_pixmap(pixmap, pixmap->x, pixmap->y, dx, dy);
 		}
 		if (scaled != NULL)
-			image = scaled;
+			pixmap = scaled;
 	}
 
-	if (image->colorspace != model)
+	if (pixmap->colorspace != model)
 	{
-		if ((image->colorspace == fz_device_gray && model == fz_device_rgb) ||
-			(image->colorspace == fz_device_gray && model == fz_device_bgr))
+		if ((pixmap->colorspace == fz_device_gray && model == fz_device_rgb) ||
+			(pixmap->colorspace == fz_device_gray && model == fz_device_bgr))
 		{
 			/* We have special case rendering code for gray -> rgb/bgr */
 		}
 		else
 		{
-			converted = fz_new_pixmap_with_rect(model, fz_bound_pixmap(image));
-			fz_convert_pixmap(image, converted);
-			image = converted;
+			converted = fz_new_pixmap_with_rect(model, fz_bound_pixmap(pixmap));
+			fz_convert_pixmap(pixmap, converted);
+			pixmap = converted;
 		}
 	}
 
-	fz_paint_image(dev->dest, dev->scissor, dev->shape, image, ctm, alpha * 255);
+	fz_paint_image(dev->dest, dev->scissor, dev->shape, pixmap, ctm, alpha * 255);
 
 	if (scaled)
 		fz_drop_pixmap(scaled);
 	if (converted)
 		fz_drop_pixmap(converted);
+	fz_drop_pixmap(orig);
 
 	if (dev->blendmode & FZ_BLEND_KNOCKOUT)
 		fz_knockout_end(dev);
 }
 
 static void
-fz_draw_fill_image_mask(void *user, fz_pixmap *image, fz_matrix ctm,
+fz_draw_fill_image_mask(void *user, fz_image *image, fz_matrix ctm,
 	fz_colorspace *colorspace, float *color, float alpha)
 {
 	fz_draw_device *dev = user;
 	fz_colorspace *model = dev->dest->colorspace;
 	unsigned char colorbv[FZ_MAX_COLORS + 1];
 	float colorfv[FZ_MAX_COLORS];
+	fz_pixmap *pixmap = NULL, *orig = NULL;
 	fz_pixmap *scaled = NULL;
+	fz_bitmap *bitmap = NULL;
 	int dx, dy;
 	int i;
 
-	if (image->w == 0 || image->h == 0)
-		return;
+	if (fz_draw_use_bitmap(dev, image))
+	{
+		bitmap = fz_draw_image_bitmap(dev, image, ctm);
+		if (!bitmap)
+			return;
+	}
+	else
+	{
+		orig = pixmap = fz_draw_image_pixmap(dev, image, ctm);
+		if (!pixmap)
+			return;
+	}
 
 	if (dev->blendmode & FZ_BLEND_KNOCKOUT)
 		fz_knockout_begin(dev);
 
 	dx = sqrtf(ctm.a * ctm.a + ctm.b * ctm.b);
 	dy = sqrtf(ctm.c * ctm.c + ctm.d * ctm.d);
-	if (dx < image->w && dy < image->h)
+	if (pixmap && dx < pixmap->w && dy < pixmap->h)
 	{
 		int gridfit = alpha == 1.0f && !(dev->flags & FZ_DRAWDEV_FLAGS_TYPE3);
-		scaled = fz_transform_pixmap(image, &ctm, dev->dest->x, dev->dest->y, dx, dy, gridfit);
+		scaled = fz_transform_pixmap(pixmap, &ctm, dev->dest->x, dev->dest->y, dx, dy, gridfit);
 		if (scaled == NULL)
 		{
 			if (dx < 1)
 				dx = 1;
 			if (dy < 1)
 				dy = 1;
-			scaled = fz_scale_pixmap(image, image->x, image->y, dx, dy);
+			scaled = fz_scale_pixmap(pixmap, pixmap->x, pixmap->y, dx, dy);
 		}
 		if (scaled != NULL)
-			image = scaled;
+			pixmap = scaled;
 	}
 
 	fz_convert_color(colorspace, color, model, colorfv);
@@ -1017,23 +1151,31 @@ fz_draw_fill_image_mask(void *user, fz_pixmap *image, fz_matrix ctm,
 		colorbv[i] = colorfv[i] * 255;
 	colorbv[i] = alpha * 255;
 
-	fz_paint_image_with_color(dev->dest, dev->scissor, dev->shape, image, ctm, colorbv);
+	if (bitmap)
+		fz_paint_bitmap_with_color(dev->dest, dev->scissor, dev->shape, bitmap, ctm, colorbv);
+	else
+		fz_paint_image_with_color(dev->dest, dev->scissor, dev->shape, pixmap, ctm, colorbv);
 
 	if (scaled)
 		fz_drop_pixmap(scaled);
+	fz_drop_pixmap(orig);
+	fz_drop_bitmap(bitmap);
 
 	if (dev->blendmode & FZ_BLEND_KNOCKOUT)
 		fz_knockout_begin(dev);
 }
 
 static void
-fz_draw_clip_image_mask(void *user, fz_pixmap *image, fz_rect *rect, fz_matrix ctm)
+fz_draw_clip_image_mask(void *user, fz_image *image, fz_rect *rect, fz_matrix ctm)
 {
 	fz_draw_device *dev = user;
 	fz_colorspace *model = dev->dest->colorspace;
 	fz_bbox bbox;
 	fz_pixmap *mask, *dest, *shape;
+	fz_pixmap *pixmap = NULL, *orig = NULL;
 	fz_pixmap *scaled = NULL;
+	fz_bitmap *bitmap = NULL;
+	unsigned char opaque = 255;
 	int dx, dy;
 
 	if (dev->top == STACK_SIZE)
@@ -1046,11 +1188,16 @@ fz_draw_clip_image_mask(void *user, fz_pixmap *image, fz_rect *rect, fz_matrix c
 	dump_spaces(dev->top, "Clip (image mask) begin\n");
 #endif
 
-	if (image->w == 0 || image->h == 0)
+	if (fz_draw_use_bitmap(dev, image))
+		bitmap = fz_draw_image_bitmap(dev, image, ctm);
+	else
+		orig = pixmap = fz_draw_image_pixmap(dev, image, ctm);
+	if (!pixmap && !bitmap)
 	{
 		dev->stack[dev->top].scissor = dev->scissor;
 		dev->stack[dev->top].mask = NULL;
 		dev->stack[dev->top].dest = NULL;
+		dev->stack[dev->top].shape = dev->shape;
 		dev->stack[dev->top].blendmode = dev->blendmode;
 		dev->scissor = fz_empty_bbox;
 		dev->top++;
@@ -1077,26 +1224,31 @@ fz_draw_clip_image_mask(void *user, fz_pixmap *image, fz_rect *rect, fz_matrix c
 
 	dx = sqrtf(ctm.a * ctm.a + ctm.b * ctm.b);
 	dy = sqrtf(ctm.c * ctm.c + ctm.d * ctm.d);
-	if (dx < image->w && dy < image->h)
+	if (pixmap && dx < pixmap->w && dy < pixmap->h)
 	{
 		int gridfit = !(dev->flags & FZ_DRAWDEV_FLAGS_TYPE3);
-		scaled = fz_transform_pixmap(image, &ctm, dev->dest->x, dev->dest->y, dx, dy, gridfit);
+		scaled = fz_transform_pixmap(pixmap, &ctm, dev->dest->x, dev->dest->y, dx, dy, gridfit);
 		if (scaled == NULL)
 		{
 			if (dx < 1)
 				dx = 1;
 			if (dy < 1)
 				dy = 1;
-			scaled = fz_scale_pixmap(image, image->x, image->y, dx, dy);
+			scaled = fz_scale_pixmap(pixmap, pixmap->x, pixmap->y, dx, dy);
 		}
 		if (scaled != NULL)
-			image = scaled;
+			pixmap = scaled;
 	}
 
-	fz_paint_image(mask, bbox, dev->shape, image, ctm, 255);
+	if (bitmap)
+		fz_paint_bitmap_with_color(mask, bbox, dev->shape, bitmap, ctm, &opaque);
+	else
+		fz_paint_image(mask, bbox, dev->shape, pixmap, ctm, 255);
 
 	if (scaled)
 		fz_drop_pixmap(scaled);
+	fz_drop_pixmap(orig);
+	fz_drop_bitmap(bitmap);
 
 	dev->stack[dev->top].scissor = dev->scissor;
 	dev->stack[dev->top].mask = mask;
@@ -1523,11 +1675,12 @@ fz_draw_free_user(void *user)
 }
 
 fz_device *
-fz_new_draw_device(fz_glyph_cache *cache, fz_pixmap *dest)
+fz_new_draw_device(fz_glyph_cache *cache, fz_image_cache *images, fz_pixmap *dest)
 {
 	fz_device *dev;
 	fz_draw_device *ddev = fz_malloc(sizeof(fz_draw_device));
 	ddev->cache = cache;
+	ddev->images = images;
 	ddev->gel = fz_new_gel();
 	ddev->dest = dest;
 	ddev->shape = NULL;
@@ -1575,7 +1728,7 @@ fz_new_draw_device(fz_glyph_cache *cache, fz_pixmap *dest)
 fz_device *
 fz_new_draw_device_type3(fz_glyph_cache *cache, fz_pixmap *dest)
 {
-	fz_device *dev = fz_new_draw_device(cache, dest);
+	fz_device *dev = fz_new_draw_device(cache, NULL, dest);
 	fz_draw_device *ddev = dev->user;
 	ddev->flags |= FZ_DRAWDEV_FLAGS_TYPE3;
 	return dev;
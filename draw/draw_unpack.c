@@ -168,6 +168,78 @@ fz_unpack_tile(fz_pixmap *dst, unsigned char * restrict src, int n, int depth, i
 	}
 }
 
+/*
+ * Unpack a w by h image at 1/fx by 1/fy of its size, averaging each
+ * block of fx by fy samples into one pixel. The size of dst decides
+ * whether a trailing partial block is averaged or dropped. Palette
+ * indices (scale 1) can't be averaged, so those are subsampled instead.
+ */
+
+void
+fz_unpack_tile_reduced(fz_pixmap *dst, unsigned char * restrict src, int w, int h, int n, int depth, int stride, int scale, int fx, int fy)
+{
+	fz_pixmap *row;
+	unsigned char *sp, *dp;
+	int *acc, *ap;
+	int dn = dst->n;
+	int x, y, k, ox, oy, bw, bh;
+
+	row = fz_new_pixmap(dst->colorspace, w, 1);
+
+	if (scale == 1)
+	{
+		for (oy = 0; oy < dst->h; oy++)
+		{
+			fz_unpack_tile(row, src + oy * fy * stride, n, depth, stride, scale);
+			sp = row->samples;
+			dp = dst->samples + oy * dst->w * dn;
+			for (ox = 0; ox < dst->w; ox++)
+			{
+				memcpy(dp, sp, dn);
+				sp += fx * dn;
+				dp += dn;
+			}
+		}
+		fz_drop_pixmap(row);
+		return;
+	}
+
+	acc = fz_calloc(dst->w * dn, sizeof(int));
+
+	for (oy = 0; oy < dst->h; oy++)
+	{
+		bh = MIN(fy, h - oy * fy);
+
+		memset(acc, 0, dst->w * dn * sizeof(int));
+		for (y = 0; y < bh; y++)
+		{
+			fz_unpack_tile(row, src + (oy * fy + y) * stride, n, depth, stride, scale);
+			sp = row->samples;
+			ap = acc;
+			for (ox = 0; ox < dst->w; ox++)
+			{
+				bw = MIN(fx, w - ox * fx);
+				for (x = 0; x < bw; x++)
+					for (k = 0; k < dn; k++)
+						ap[k] += *sp++;
+				ap += dn;
+			}
+		}
+
+		dp = dst->samples + oy * dst->w * dn;
+		ap = acc;
+		for (ox = 0; ox < dst->w; ox++)
+		{
+			int div = MIN(fx, w - ox * fx) * bh;
+			for (k = 0; k < dn; k++)
+				*dp++ = (*ap++ + div / 2) / div;
+		}
+	}
+
+	fz_free(acc);
+	fz_drop_pixmap(row);
+}
+
 /* Apply decode array */
 
 void
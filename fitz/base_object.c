@@ -26,9 +26,12 @@ struct fz_obj_s
 	union
 	{
 		int b;
-		int i;
+		fz_off_t i;
 		float f;
 		struct {
+			void *crypt; /* still encrypted if set, holds a reference */
+			int num;
+			int gen;
 			unsigned short len;
 			char buf[1];
 		} s;
@@ -59,6 +62,36 @@ static fz_obj *fz_resolve_indirect_null(fz_obj *ref)
 
 fz_obj* (*fz_resolve_indirect)(fz_obj*) = fz_resolve_indirect_null;
 
+static int fz_decrypt_string_null(void *crypt, int num, int gen, unsigned char *s, int len)
+{
+	return len;
+}
+
+int (*fz_decrypt_string)(void *crypt, int num, int gen, unsigned char *s, int len) = fz_decrypt_string_null;
+
+static void fz_drop_string_crypt_null(void *crypt)
+{
+}
+
+void (*fz_drop_string_crypt)(void *crypt) = fz_drop_string_crypt_null;
+
+/*
+ * Strings from encrypted documents are decrypted when first looked at.
+ * Like the reference counts, this changes the object in place, so objects
+ * must not be shared between threads.
+ */
+static inline void fz_decrypt_str(fz_obj *obj)
+{
+	if (obj->u.s.crypt)
+	{
+		void *crypt = obj->u.s.crypt;
+		obj->u.s.crypt = NULL;
+		obj->u.s.len = fz_decrypt_string(crypt, obj->u.s.num, obj->u.s.gen, (unsigned char *)obj->u.s.buf, obj->u.s.len);
+		obj->u.s.buf[obj->u.s.len] = '\0';
+		fz_drop_string_crypt(crypt);
+	}
+}
+
 fz_obj *
 fz_new_null(void)
 {
@@ -88,6 +121,16 @@ fz_new_int(int i)
 	return obj;
 }
 
+fz_obj *
+fz_new_offset(fz_off_t ofs)
+{
+	fz_obj *obj = fz_malloc(sizeof(fz_obj));
+	obj->refs = 1;
+	obj->kind = FZ_INT;
+	obj->u.i = ofs;
+	return obj;
+}
+
 fz_obj *
 fz_new_real(float f)
 {
@@ -104,6 +147,9 @@ fz_new_string(char *str, int len)
 	fz_obj *obj = fz_malloc(offsetof(fz_obj, u.s.buf) + len + 1);
 	obj->refs = 1;
 	obj->kind = FZ_STRING;
+	obj->u.s.crypt = NULL;
+	obj->u.s.num = 0;
+	obj->u.s.gen = 0;
 	obj->u.s.len = len;
 	memcpy(obj->u.s.buf, str, len);
 	obj->u.s.buf[len] = '\0';
@@ -202,6 +248,16 @@ int fz_to_bool(fz_obj *obj)
 }
 
 int fz_to_int(fz_obj *obj)
+{
+	obj = fz_resolve_indirect(obj);
+	if (fz_is_int(obj))
+		return CLAMP(obj->u.i, INT_MIN, INT_MAX);
+	if (fz_is_real(obj))
+		return obj->u.f;
+	return 0;
+}
+
+fz_off_t fz_to_offset(fz_obj *obj)
 {
 	obj = fz_resolve_indirect(obj);
 	if (fz_is_int(obj))
@@ -233,7 +289,10 @@ char *fz_to_str_buf(fz_obj *obj)
 {
 	obj = fz_resolve_indirect(obj);
 	if (fz_is_string(obj))
+	{
+		fz_decrypt_str(obj);
 		return obj->u.s.buf;
+	}
 	return "";
 }
 
@@ -241,17 +300,25 @@ int fz_to_str_len(fz_obj *obj)
 {
 	obj = fz_resolve_indirect(obj);
 	if (fz_is_string(obj))
+	{
+		fz_decrypt_str(obj);
 		return obj->u.s.len;
+	}
 	return 0;
 }
 
-/* for use by pdf_crypt_obj_imp to decrypt AES string in place */
-void fz_set_str_len(fz_obj *obj, int newlen)
+/* for use by pdf_crypt_obj to mark a string for decryption on first use */
+/* the string takes over the reference to crypt */
+void fz_set_str_crypt(fz_obj *obj, void *crypt, int num, int gen)
 {
-	obj = fz_resolve_indirect(obj);
 	if (fz_is_string(obj))
-		if (newlen < obj->u.s.len)
-			obj->u.s.len = newlen;
+	{
+		if (obj->u.s.crypt)
+			fz_drop_string_crypt(obj->u.s.crypt);
+		obj->u.s.crypt = crypt;
+		obj->u.s.num = num;
+		obj->u.s.gen = gen;
+	}
 }
 
 int fz_to_num(fz_obj *obj)
@@ -275,6 +342,11 @@ void *fz_get_indirect_xref(fz_obj *obj)
 	return NULL;
 }
 
+int fz_get_obj_refs(fz_obj *obj)
+{
+	return obj ? obj->refs : 0;
+}
+
 int
 fz_objcmp(fz_obj *a, fz_obj *b)
 {
@@ -298,7 +370,11 @@ fz_objcmp(fz_obj *a, fz_obj *b)
 		return a->u.b - b->u.b;
 
 	case FZ_INT:
-		return a->u.i - b->u.i;
+		if (a->u.i < b->u.i)
+			return -1;
+		if (a->u.i > b->u.i)
+			return 1;
+		return 0;
 
 	case FZ_REAL:
 		if (a->u.f < b->u.f)
@@ -308,6 +384,8 @@ fz_objcmp(fz_obj *a, fz_obj *b)
 		return 0;
 
 	case FZ_STRING:
+		fz_decrypt_str(a);
+		fz_decrypt_str(b);
 		if (a->u.s.len < b->u.s.len)
 		{
 			if (memcmp(a->u.s.buf, b->u.s.buf, a->u.s.len) <= 0)
@@ -797,6 +875,10 @@ fz_drop_obj(fz_obj *obj)
 		else if (obj->kind == FZ_DICT)
 			fz_free_dict(obj);
 		else
+		{
+			if (obj->kind == FZ_STRING && obj->u.s.crypt)
+				fz_drop_string_crypt(obj->u.s.crypt);
 			fz_free(obj);
+		}
 	}
 }
@@ -466,6 +466,144 @@ void aes_crypt_ecb( aes_context *ctx,
 	PUT_ULONG_LE( X3, output, 12 );
 }
 
+/*
+ * AES-NI versions of CBC encryption and decryption. They use the same key
+ * schedules as the table driven code: the decryption schedule above is
+ * already in the order and form (InvMixColumns applied to the inner
+ * round keys) that AESDEC expects. CBC decryption does not depend on the
+ * previous block's result, so four blocks are decrypted at once.
+ */
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define HAVE_AESNI
+#endif
+
+#ifdef HAVE_AESNI
+
+#include <immintrin.h>
+
+#define AESNI __attribute__((target("aes,sse2")))
+
+static int aesni_state = -1;
+
+static int have_aesni( void )
+{
+	if( aesni_state < 0 )
+	{
+		__builtin_cpu_init();
+		aesni_state = __builtin_cpu_supports( "aes" ) != 0;
+	}
+	return aesni_state;
+}
+
+static AESNI void aesni_load_keys( aes_context *ctx, __m128i *rk )
+{
+	unsigned long *RK = ctx->rk;
+	int i;
+
+	for( i = 0; i <= ctx->nr; i++, RK += 4 )
+		rk[i] = _mm_set_epi32( (int) RK[3], (int) RK[2], (int) RK[1], (int) RK[0] );
+}
+
+static AESNI void aesni_decrypt_cbc( aes_context *ctx,
+	int length,
+	unsigned char iv[16],
+	const unsigned char *input,
+	unsigned char *output )
+{
+	__m128i rk[15];
+	__m128i b0, b1, b2, b3, c0, c1, c2, c3, prev;
+	int i, nr = ctx->nr;
+
+	aesni_load_keys( ctx, rk );
+	prev = _mm_loadu_si128( (const __m128i *) iv );
+
+	while( length >= 64 )
+	{
+		c0 = _mm_loadu_si128( (const __m128i *) input );
+		c1 = _mm_loadu_si128( (const __m128i *) ( input + 16 ) );
+		c2 = _mm_loadu_si128( (const __m128i *) ( input + 32 ) );
+		c3 = _mm_loadu_si128( (const __m128i *) ( input + 48 ) );
+
+		b0 = _mm_xor_si128( c0, rk[0] );
+		b1 = _mm_xor_si128( c1, rk[0] );
+		b2 = _mm_xor_si128( c2, rk[0] );
+		b3 = _mm_xor_si128( c3, rk[0] );
+
+		for( i = 1; i < nr; i++ )
+		{
+			b0 = _mm_aesdec_si128( b0, rk[i] );
+			b1 = _mm_aesdec_si128( b1, rk[i] );
+			b2 = _mm_aesdec_si128( b2, rk[i] );
+			b3 = _mm_aesdec_si128( b3, rk[i] );
+		}
+
+		b0 = _mm_xor_si128( _mm_aesdeclast_si128( b0, rk[nr] ), prev );
+		b1 = _mm_xor_si128( _mm_aesdeclast_si128( b1, rk[nr] ), c0 );
+		b2 = _mm_xor_si128( _mm_aesdeclast_si128( b2, rk[nr] ), c1 );
+		b3 = _mm_xor_si128( _mm_aesdeclast_si128( b3, rk[nr] ), c2 );
+
+		_mm_storeu_si128( (__m128i *) output, b0 );
+		_mm_storeu_si128( (__m128i *) ( output + 16 ), b1 );
+		_mm_storeu_si128( (__m128i *) ( output + 32 ), b2 );
+		_mm_storeu_si128( (__m128i *) ( output + 48 ), b3 );
+
+		prev = c3;
+		input += 64;
+		output += 64;
+		length -= 64;
+	}
+
+	while( length > 0 )
+	{
+		c0 = _mm_loadu_si128( (const __m128i *) input );
+		b0 = _mm_xor_si128( c0, rk[0] );
+		for( i = 1; i < nr; i++ )
+			b0 = _mm_aesdec_si128( b0, rk[i] );
+		b0 = _mm_xor_si128( _mm_aesdeclast_si128( b0, rk[nr] ), prev );
+		_mm_storeu_si128( (__m128i *) output, b0 );
+
+		prev = c0;
+		input += 16;
+		output += 16;
+		length -= 16;
+	}
+
+	_mm_storeu_si128( (__m128i *) iv, prev );
+}
+
+static AESNI void aesni_encrypt_cbc( aes_context *ctx,
+	int length,
+	unsigned char iv[16],
+	const unsigned char *input,
+	unsigned char *output )
+{
+	__m128i rk[15];
+	__m128i b;
+	int i, nr = ctx->nr;
+
+	aesni_load_keys( ctx, rk );
+	b = _mm_loadu_si128( (const __m128i *) iv );
+
+	while( length > 0 )
+	{
+		b = _mm_xor_si128( b, _mm_loadu_si128( (const __m128i *) input ) );
+		b = _mm_xor_si128( b, rk[0] );
+		for( i = 1; i < nr; i++ )
+			b = _mm_aesenc_si128( b, rk[i] );
+		b = _mm_aesenclast_si128( b, rk[nr] );
+		_mm_storeu_si128( (__m128i *) output, b );
+
+		input += 16;
+		output += 16;
+		length -= 16;
+	}
+
+	_mm_storeu_si128( (__m128i *) iv, b );
+}
+
+#endif
+
 /*
  * AES-CBC buffer encryption/decryption
  */
@@ -479,6 +617,17 @@ void aes_crypt_cbc( aes_context *ctx,
 	int i;
 	unsigned char temp[16];
 
+#ifdef HAVE_AESNI
+	if( have_aesni() && ( ctx->nr == 10 || ctx->nr == 12 || ctx->nr == 14 ) )
+	{
+		if( mode == AES_DECRYPT )
+			aesni_decrypt_cbc( ctx, length, iv, input, output );
+		else
+			aesni_encrypt_cbc( ctx, length, iv, input, output );
+		return;
+	}
+#endif
+
 #if defined(XYSSL_PADLOCK_C) && defined(XYSSL_HAVE_X86)
 	if( padlock_supports( PADLOCK_ACE ) )
 	{
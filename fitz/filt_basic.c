@@ -452,7 +452,18 @@ read_aesd(fz_stream *stm, unsigned char *buf, int len)
 
 	while (p < ep)
 	{
-		int n = fz_read(state->chain, state->bp, 16);
+		/* decrypt whole blocks straight from the chain's buffer, keeping
+		 * the last block back so that its padding can be stripped */
+		int n = MIN(ep - p, state->chain->wp - state->chain->rp - 16) & ~15;
+		if (n > 0)
+		{
+			aes_crypt_cbc(&state->aes, AES_DECRYPT, n, state->iv, state->chain->rp, p);
+			state->chain->rp += n;
+			p += n;
+			continue;
+		}
+
+		n = fz_read(state->chain, state->bp, 16);
 		if (n < 0)
 			return fz_rethrow(n, "read error in aes filter");
 		else if (n == 0)
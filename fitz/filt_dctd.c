@@ -9,6 +9,7 @@ struct fz_dctd_s
 {
 	fz_stream *chain;
 	int color_transform;
+	int l2factor;
 	int init;
 	int stride;
 	unsigned char *scanline;
@@ -108,6 +109,10 @@ read_dctd(fz_stream *stm, unsigned char *buf, int len)
 
 		jpeg_read_header(cinfo, 1);
 
+		/* let the idct do the downscaling if we only need a smaller image */
+		cinfo->scale_num = 1;
+		cinfo->scale_denom = 1 << state->l2factor;
+
 		/* speed up jpeg decoding a bit */
 		cinfo->dct_method = JDCT_FASTEST;
 		cinfo->do_fancy_upsampling = FALSE;
@@ -202,7 +207,7 @@ skip:
 }
 
 fz_stream *
-fz_open_dctd(fz_stream *chain, fz_obj *params)
+fz_open_dctd(fz_stream *chain, fz_obj *params, int l2factor)
 {
 	fz_dctd *state;
 	fz_obj *obj;
@@ -211,6 +216,7 @@ fz_open_dctd(fz_stream *chain, fz_obj *params)
 	memset(state, 0, sizeof(fz_dctd));
 	state->chain = chain;
 	state->color_transform = -1; /* unset */
+	state->l2factor = CLAMP(l2factor, 0, 3);
 	state->init = 0;
 
 	obj = fz_dict_gets(params, "ColorTransform");
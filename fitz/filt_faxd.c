@@ -170,15 +170,48 @@ const cfd_node cf_uncompressed_decode[] = {
 
 /* bit magic */
 
+static const unsigned char lm[8] = {
+	0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01
+};
+
+static const unsigned char rm[8] = {
+	0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE
+};
+
+/* number of leading zero bits in a byte */
+static const unsigned char clz8[256] = {
+	8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
 static inline int getbit(const unsigned char *buf, int x)
 {
 	return ( buf[x >> 3] >> ( 7 - (x & 7) ) ) & 1;
 }
 
+/*
+ * Find the next changing element after x in a line: skip whole words and
+ * bytes of the same color, then find the first differing bit in the byte.
+ */
 static int
 find_changing(const unsigned char *line, int x, int w)
 {
-	int a, b;
+	unsigned int pattern, word;
+	int a, m, i, end;
 
 	if (!line)
 		return w;
@@ -194,15 +227,32 @@ find_changing(const unsigned char *line, int x, int w)
 		x++;
 	}
 
-	while (x < w)
+	if (x >= w)
+		return x;
+
+	pattern = a ? ~0U : 0;
+	end = (w + 7) >> 3;
+	i = x >> 3;
+
+	/* bits that differ from a, from x onwards */
+	m = (line[i] ^ pattern) & lm[x & 7];
+	while (!m)
 	{
-		b = getbit(line, x);
-		if (a != b)
-			break;
-		x++;
+		i++;
+		while (i + 4 <= end)
+		{
+			memcpy(&word, line + i, 4);
+			if (word != pattern)
+				break;
+			i += 4;
+		}
+		if (i >= end)
+			return w;
+		m = (line[i] ^ pattern) & 0xFF;
 	}
 
-	return x;
+	x = (i << 3) + clz8[m];
+	return MIN(x, w);
 }
 
 static int
@@ -219,17 +269,9 @@ find_changing_color(const unsigned char *line, int x, int w, int color)
 	return x;
 }
 
-static const unsigned char lm[8] = {
-	0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 0x07, 0x03, 0x01
-};
-
-static const unsigned char rm[8] = {
-	0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE
-};
-
 static inline void setbits(unsigned char *line, int x0, int x1)
 {
-	int a0, a1, b0, b1, a;
+	int a0, a1, b0, b1;
 
 	a0 = x0 >> 3;
 	a1 = x1 >> 3;
@@ -245,8 +287,8 @@ static inline void setbits(unsigned char *line, int x0, int x1)
 	else
 	{
 		line[a0] |= lm[b0];
-		for (a = a0 + 1; a < a1; a++)
-			line[a] = 0xFF;
+		if (a1 > a0 + 1)
+			memset(line + a0 + 1, 0xFF, a1 - a0 - 1);
 		if (b1)
 			line[a1] |= rm[b1];
 	}
@@ -590,8 +632,10 @@ eol:
 
 	if (fax->black_is_1)
 	{
-		while (fax->rp < fax->wp && p < ep)
-			*p++ = *fax->rp++;
+		int n = MIN(fax->wp - fax->rp, ep - p);
+		memcpy(p, fax->rp, n);
+		fax->rp += n;
+		p += n;
 	}
 	else
 	{
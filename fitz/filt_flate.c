@@ -101,3 +101,33 @@ fz_open_flated(fz_stream *chain)
 
 	return fz_new_stream(state, read_flated, close_flated);
 }
+
+/*
+ * Inflate a whole zlib stream in one call. Returns the number of bytes
+ * decoded, or -1 if the data is not a complete zlib stream that fits
+ * in the output buffer.
+ */
+int
+fz_inflate_buffer(unsigned char *out, int outlen, unsigned char *in, int inlen)
+{
+	z_stream z;
+	int code;
+
+	z.zalloc = zalloc;
+	z.zfree = zfree;
+	z.opaque = NULL;
+	z.next_in = in;
+	z.avail_in = inlen;
+	z.next_out = out;
+	z.avail_out = outlen;
+
+	if (inflateInit(&z) != Z_OK)
+		return -1;
+
+	code = inflate(&z, Z_FINISH);
+	inflateEnd(&z);
+
+	if (code != Z_STREAM_END)
+		return -1;
+	return outlen - z.avail_out;
+}
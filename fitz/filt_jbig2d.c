@@ -17,13 +17,19 @@ typedef unsigned int uint32_t;
 
 #include <jbig2.h>
 
+struct fz_jbig2_globals_s
+{
+	int refs;
+	Jbig2GlobalCtx *gctx;
+};
+
 typedef struct fz_jbig2d_s fz_jbig2d;
 
 struct fz_jbig2d_s
 {
 	fz_stream *chain;
 	Jbig2Ctx *ctx;
-	Jbig2GlobalCtx *gctx;
+	fz_jbig2_globals *globals;
 	Jbig2Image *page;
 	int idx;
 };
@@ -34,9 +40,9 @@ close_jbig2d(fz_stream *stm)
 	fz_jbig2d *state = stm->state;
 	if (state->page)
 		jbig2_release_page(state->ctx, state->page);
-	if (state->gctx)
-		jbig2_global_ctx_free(state->gctx);
 	jbig2_ctx_free(state->ctx);
+	if (state->globals)
+		fz_drop_jbig2_globals(state->globals);
 	fz_close(state->chain);
 	fz_free(state);
 }
@@ -80,24 +86,54 @@ read_jbig2d(fz_stream *stm, unsigned char *buf, int len)
 	return p - buf;
 }
 
+fz_jbig2_globals *
+fz_load_jbig2_globals(unsigned char *data, int len)
+{
+	fz_jbig2_globals *globals;
+	Jbig2Ctx *ctx;
+
+	ctx = jbig2_ctx_new(NULL, JBIG2_OPTIONS_EMBEDDED, NULL, NULL, NULL);
+	jbig2_data_in(ctx, data, len);
+
+	globals = fz_malloc(sizeof(fz_jbig2_globals));
+	globals->refs = 1;
+	globals->gctx = jbig2_make_global_ctx(ctx);
+	return globals;
+}
+
+fz_jbig2_globals *
+fz_keep_jbig2_globals(fz_jbig2_globals *globals)
+{
+	globals->refs ++;
+	return globals;
+}
+
+void
+fz_drop_jbig2_globals(fz_jbig2_globals *globals)
+{
+	if (globals && --globals->refs == 0)
+	{
+		jbig2_global_ctx_free(globals->gctx);
+		fz_free(globals);
+	}
+}
+
 fz_stream *
-fz_open_jbig2d(fz_stream *chain, fz_buffer *globals)
+fz_open_jbig2d(fz_stream *chain, fz_jbig2_globals *globals)
 {
 	fz_jbig2d *state;
 
 	state = fz_malloc(sizeof(fz_jbig2d));
 	state->chain = chain;
-	state->ctx = jbig2_ctx_new(NULL, JBIG2_OPTIONS_EMBEDDED, NULL, NULL, NULL);
-	state->gctx = NULL;
+	state->globals = NULL;
 	state->page = NULL;
 	state->idx = 0;
 
 	if (globals)
-	{
-		jbig2_data_in(state->ctx, globals->data, globals->len);
-		state->gctx = jbig2_make_global_ctx(state->ctx);
-		state->ctx = jbig2_ctx_new(NULL, JBIG2_OPTIONS_EMBEDDED, state->gctx, NULL, NULL);
-	}
+		state->globals = fz_keep_jbig2_globals(globals);
+
+	state->ctx = jbig2_ctx_new(NULL, JBIG2_OPTIONS_EMBEDDED,
+		globals ? globals->gctx : NULL, NULL, NULL);
 
 	return fz_new_stream(state, read_jbig2d, close_jbig2d);
 }
@@ -18,29 +18,88 @@ static void fz_opj_info_callback(const char *msg, void *client_data)
 	/* fprintf(stderr, "openjpeg info: %s", msg); */
 }
 
-fz_error
-fz_load_jpx_image(fz_pixmap **imgp, unsigned char *data, int size, fz_colorspace *defcs)
+/*
+ * Find how many wavelet decomposition levels the main header of the
+ * codestream gives each component, ie. how many times openjpeg can
+ * halve the image for us by leaving out the finer levels.
+ */
+static int
+fz_jpx_levels(unsigned char *data, int size, int format)
+{
+	unsigned char *p = data;
+	unsigned char *ep = data + size;
+	int levels = -1;
+	int csiz = 0;
+
+	/* find the codestream box in a jp2 file */
+	if (format == CODEC_JP2)
+	{
+		while (1)
+		{
+			unsigned int len;
+			int hdr = 8;
+
+			if (ep - p < 8)
+				return 0;
+			len = p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+			if (len == 1)
+			{
+				if (ep - p < 16 || p[8] | p[9] | p[10] | p[11])
+					return 0;
+				len = p[12] << 24 | p[13] << 16 | p[14] << 8 | p[15];
+				hdr = 16;
+			}
+			else if (len == 0)
+				len = ep - p;
+
+			if (!memcmp(p + 4, "jp2c", 4))
+			{
+				p += hdr;
+				break;
+			}
+
+			if (len < hdr || len > ep - p)
+				return 0;
+			p += len;
+		}
+	}
+
+	if (ep - p < 2 || p[0] != 0xFF || p[1] != 0x4F)
+		return 0;
+	p += 2;
+
+	/* marker segments up to the first tile-part */
+	while (ep - p >= 4 && p[0] == 0xFF && p[1] != 0x90)
+	{
+		int len = p[2] << 8 | p[3];
+		if (len < 2 || len + 2 > ep - p)
+			break;
+
+		if (p[1] == 0x51 && len >= 38) /* SIZ */
+			csiz = p[38] << 8 | p[39];
+		if (p[1] == 0x52 && len >= 8) /* COD */
+			levels = levels < 0 ? p[9] : MIN(levels, p[9]);
+		if (p[1] == 0x53) /* COC */
+		{
+			int k = 4 + (csiz < 257 ? 1 : 2) + 1;
+			if (len + 2 > k)
+				levels = levels < 0 ? p[k] : MIN(levels, p[k]);
+		}
+
+		p += 2 + len;
+	}
+
+	return MAX(levels, 0);
+}
+
+static opj_image_t *
+fz_opj_decode(unsigned char *data, int size, int format, int reduce)
 {
-	fz_pixmap *img;
 	opj_event_mgr_t evtmgr;
 	opj_dparameters_t params;
 	opj_dinfo_t *info;
 	opj_cio_t *cio;
 	opj_image_t *jpx;
-	fz_colorspace *colorspace;
-	unsigned char *p;
-	int format;
-	int a, n, w, h, depth, sgnd;
-	int x, y, k, v;
-
-	if (size < 2)
-		return fz_throw("not enough data to determine image format");
-
-	/* Check for SOC marker -- if found we have a bare J2K stream */
-	if (data[0] == 0xFF && data[1] == 0x4F)
-		format = CODEC_J2K;
-	else
-		format = CODEC_JP2;
 
 	memset(&evtmgr, 0, sizeof(evtmgr));
 	evtmgr.error_handler = fz_opj_error_callback;
@@ -48,6 +107,7 @@ fz_load_jpx_image(fz_pixmap **imgp, unsigned char *data, int size, fz_colorspace
 	evtmgr.info_handler = fz_opj_info_callback;
 
 	opj_set_default_decoder_parameters(&params);
+	params.cp_reduce = reduce;
 
 	info = opj_create_decompress(format);
 	opj_set_event_mgr((opj_common_ptr)info, &evtmgr, stderr);
@@ -60,6 +120,42 @@ fz_load_jpx_image(fz_pixmap **imgp, unsigned char *data, int size, fz_colorspace
 	opj_cio_close(cio);
 	opj_destroy_decompress(info);
 
+	return jpx;
+}
+
+/*
+ * Decode the image at 1/2^l2factor of its size, or as close to
+ * that as the number of wavelet levels in the image allows.
+ */
+fz_error
+fz_load_jpx_image(fz_pixmap **imgp, unsigned char *data, int size, fz_colorspace *defcs, int l2factor)
+{
+	fz_pixmap *img;
+	opj_image_t *jpx;
+	fz_colorspace *colorspace;
+	unsigned char *p;
+	int format;
+	int a, n, w, h, depth, sgnd;
+	int x, y, k, v;
+
+	if (size < 2)
+		return fz_throw("not enough data to determine image format");
+
+	/* Check for SOC marker -- if found we have a bare J2K stream */
+	if (data[0] == 0xFF && data[1] == 0x4F)
+		format = CODEC_J2K;
+	else
+		format = CODEC_JP2;
+
+	if (l2factor > 0)
+		l2factor = MIN(l2factor, fz_jpx_levels(data, size, format));
+
+	jpx = fz_opj_decode(data, size, format, l2factor);
+
+	/* tile headers may have fewer levels than the main header */
+	if (!jpx && l2factor > 0)
+		jpx = fz_opj_decode(data, size, format, 0);
+
 	if (!jpx)
 		return fz_throw("opj_decode failed");
 
@@ -10,14 +10,40 @@ enum
 	LZW_CLEAR = 256,
 	LZW_EOD = 257,
 	LZW_FIRST = 258,
-	MAX_LENGTH = 4097
+	MAX_LENGTH = 4097,
+	MAX_STRINGS = (1 << 20)
 };
 
+/*
+ * Every string in the table is also kept whole in a flat array, so codes
+ * can be copied to the output with memcpy. A new string is the previous
+ * string plus one byte, so if the previous string is the last one in the
+ * array the new one simply extends it in place. Strings that don't fit in
+ * the array are rebuilt from the prefix chain instead.
+ *
+ * Most strings are short, so copies of up to 16 bytes are done with one
+ * fixed size copy. The array has room to spare at the end for that. When
+ * a string is copied to the end of the array from just before it, the
+ * fixed size copy runs into its own destination, hence the memmove.
+ */
+
+enum { SLACK = 16 };
+
+static inline void
+copy_string(unsigned char *dst, const unsigned char *src, int len, int room)
+{
+	if (len <= SLACK && room >= SLACK)
+		memmove(dst, src, SLACK);
+	else
+		memcpy(dst, src, len);
+}
+
 typedef struct lzw_code_s lzw_code;
 
 struct lzw_code_s
 {
 	int prev;			/* prev code (in string) */
+	int offset;			/* string in strings array, or -1 */
 	unsigned short length;		/* string len, including this token */
 	unsigned char value;		/* data value */
 	unsigned char first_char;	/* first token of string */
@@ -37,26 +63,96 @@ struct fz_lzwd_s
 	int old_code;			/* previously recognized code */
 	int next_code;			/* next free entry */
 
+	unsigned int word;		/* bits read but not used yet */
+	int bits;
+
 	lzw_code table[NUM_CODES];
 
+	unsigned char *strings;
+	int strings_len, strings_cap;
+
 	unsigned char bp[MAX_LENGTH];
 	unsigned char *rp, *wp;
 };
 
+static void
+lzw_add_string(fz_lzwd *lzw, int code, int old_code)
+{
+	lzw_code *new = &lzw->table[code];
+	lzw_code *old = &lzw->table[old_code];
+	int len = new->length;
+
+	if (old->offset < 0)
+	{
+		new->offset = -1;
+		return;
+	}
+
+	/* share the previous string if it's the last one */
+	if (old->offset + old->length == lzw->strings_len && lzw->strings_len < lzw->strings_cap)
+	{
+		new->offset = old->offset;
+		lzw->strings[lzw->strings_len++] = new->value;
+		return;
+	}
+
+	if (lzw->strings_len + len > lzw->strings_cap)
+	{
+		int cap = lzw->strings_cap;
+		while (cap < lzw->strings_len + len && cap < MAX_STRINGS)
+			cap *= 2;
+		if (lzw->strings_len + len > cap)
+		{
+			new->offset = -1;
+			return;
+		}
+		lzw->strings = fz_realloc(lzw->strings, cap + SLACK, 1);
+		lzw->strings_cap = cap;
+	}
+
+	new->offset = lzw->strings_len;
+	copy_string(lzw->strings + new->offset, lzw->strings + old->offset, len - 1, SLACK);
+	lzw->strings[new->offset + len - 1] = new->value;
+	lzw->strings_len += len;
+}
+
+static inline void
+lzw_copy_string(fz_lzwd *lzw, int code, unsigned char *dst, int room)
+{
+	lzw_code *table = lzw->table;
+	unsigned char *s;
+
+	if (table[code].offset >= 0)
+	{
+		copy_string(dst, lzw->strings + table[code].offset, table[code].length, room);
+		return;
+	}
+
+	/* build the string backwards from the prefix chain */
+	s = dst + table[code].length;
+	while (s > dst && code >= 0)
+	{
+		*(--s) = table[code].value;
+		code = table[code].prev;
+	}
+}
+
 static int
 read_lzwd(fz_stream *stm, unsigned char *buf, int len)
 {
 	fz_lzwd *lzw = stm->state;
+	fz_stream *chain = lzw->chain;
 	lzw_code *table = lzw->table;
 	unsigned char *p = buf;
 	unsigned char *ep = buf + len;
-	unsigned char *s;
 	int codelen;
 
 	int code_bits = lzw->code_bits;
 	int code = lzw->code;
 	int old_code = lzw->old_code;
 	int next_code = lzw->next_code;
+	unsigned int word = lzw->word;
+	int bits = lzw->bits;
 
 	while (lzw->rp < lzw->wp && p < ep)
 		*p++ = *lzw->rp++;
@@ -64,16 +160,34 @@ read_lzwd(fz_stream *stm, unsigned char *buf, int len)
 	while (p < ep)
 	{
 		if (lzw->eod)
-			return 0;
+			return p - buf;
 
-		code = fz_read_bits(lzw->chain, code_bits);
+		/* take as many bytes as we can straight from the chain's buffer */
+		while (bits <= 24 && chain->rp < chain->wp)
+		{
+			word = (word << 8) | *chain->rp++;
+			bits += 8;
+		}
 
-		if (fz_is_eof_bits(lzw->chain))
+		/* ... but no more than we need from the next one */
+		while (bits < code_bits)
+		{
+			int c = fz_read_byte(chain);
+			if (c == EOF)
+				break;
+			word = (word << 8) | c;
+			bits += 8;
+		}
+
+		if (bits < code_bits)
 		{
 			lzw->eod = 1;
 			break;
 		}
 
+		bits -= code_bits;
+		code = (word >> bits) & ((1 << code_bits) - 1);
+
 		if (code == LZW_EOD)
 		{
 			lzw->eod = 1;
@@ -85,6 +199,7 @@ read_lzwd(fz_stream *stm, unsigned char *buf, int len)
 			code_bits = MIN_BITS;
 			next_code = LZW_FIRST;
 			old_code = -1;
+			lzw->strings_len = 256;
 			continue;
 		}
 
@@ -93,7 +208,7 @@ read_lzwd(fz_stream *stm, unsigned char *buf, int len)
 		{
 			old_code = code;
 		}
-		else
+		else if (next_code < NUM_CODES)
 		{
 			/* add new entry to the code table */
 			table[next_code].prev = old_code;
@@ -106,6 +221,8 @@ read_lzwd(fz_stream *stm, unsigned char *buf, int len)
 			else
 				fz_warn("out of range code encountered in lzw decode");
 
+			lzw_add_string(lzw, next_code, old_code);
+
 			next_code ++;
 
 			if (next_code > (1 << code_bits) - lzw->early_change - 1)
@@ -117,40 +234,45 @@ read_lzwd(fz_stream *stm, unsigned char *buf, int len)
 
 			old_code = code;
 		}
-
-		/* code maps to a string, copy to output (in reverse...) */
-		if (code > 255)
+		else
 		{
-			codelen = table[code].length;
-			lzw->rp = lzw->bp;
-			lzw->wp = lzw->bp + codelen;
-
-			assert(codelen < MAX_LENGTH);
-
-			s = lzw->wp;
-			do {
-				*(--s) = table[code].value;
-				code = table[code].prev;
-			} while (code >= 0 && s > lzw->bp);
+			old_code = code;
 		}
 
-		/* ... or just a single character */
+		/* code maps to a string, copy it straight to the output if it fits */
+		codelen = table[code].length;
+		if (codelen <= ep - p)
+		{
+			lzw_copy_string(lzw, code, p, ep - p);
+			p += codelen;
+		}
 		else
 		{
-			lzw->bp[0] = code;
+			assert(codelen < MAX_LENGTH);
+			lzw_copy_string(lzw, code, lzw->bp, 0);
 			lzw->rp = lzw->bp;
-			lzw->wp = lzw->bp + 1;
+			lzw->wp = lzw->bp + codelen;
+			while (lzw->rp < lzw->wp && p < ep)
+				*p++ = *lzw->rp++;
 		}
+	}
 
-		/* copy to output */
-		while (lzw->rp < lzw->wp && p < ep)
-			*p++ = *lzw->rp++;
+	/* give back whole bytes we read past the end of the data */
+	if (lzw->eod)
+	{
+		while (bits >= 8)
+		{
+			fz_unread_byte(chain);
+			bits -= 8;
+		}
 	}
 
 	lzw->code_bits = code_bits;
 	lzw->code = code;
 	lzw->old_code = old_code;
 	lzw->next_code = next_code;
+	lzw->word = word;
+	lzw->bits = bits;
 
 	return p - buf;
 }
@@ -160,6 +282,7 @@ close_lzwd(fz_stream *stm)
 {
 	fz_lzwd *lzw = stm->state;
 	fz_close(lzw->chain);
+	fz_free(lzw->strings);
 	fz_free(lzw);
 }
 
@@ -179,12 +302,18 @@ fz_open_lzwd(fz_stream *chain, fz_obj *params)
 	if (obj)
 		lzw->early_change = !!fz_to_int(obj);
 
+	lzw->strings_cap = 1 << 16;
+	lzw->strings_len = 256;
+	lzw->strings = fz_malloc(lzw->strings_cap + SLACK);
+
 	for (i = 0; i < 256; i++)
 	{
 		lzw->table[i].value = i;
 		lzw->table[i].first_char = i;
 		lzw->table[i].length = 1;
 		lzw->table[i].prev = -1;
+		lzw->table[i].offset = i;
+		lzw->strings[i] = i;
 	}
 
 	for (i = 256; i < NUM_CODES; i++)
@@ -193,12 +322,15 @@ fz_open_lzwd(fz_stream *chain, fz_obj *params)
 		lzw->table[i].first_char = 0;
 		lzw->table[i].length = 0;
 		lzw->table[i].prev = -1;
+		lzw->table[i].offset = -1;
 	}
 
 	lzw->code_bits = MIN_BITS;
 	lzw->code = -1;
 	lzw->next_code = LZW_FIRST;
 	lzw->old_code = -1;
+	lzw->word = 0;
+	lzw->bits = 0;
 	lzw->rp = lzw->bp;
 	lzw->wp = lzw->bp;
 
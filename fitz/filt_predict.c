@@ -57,12 +57,224 @@ static inline int paeth(int a, int b, int c)
 	return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
 }
 
+/*
+ * Vectorized predictors for pixels of 1, 3 or 4 bytes, which covers the
+ * common 8-bit gray, RGB and CMYK images. Sub, Average and Paeth depend on
+ * the pixel to the left, so they work on all the bytes of a pixel at once;
+ * Up and the one byte Sub work on whole vectors. The best version the cpu
+ * supports is picked at run time. They return 0 for cases they don't handle.
+ */
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define HAVE_SSE2
+#endif
+
+static int (*fz_predict_png_simd)(unsigned char *out, unsigned char *in, unsigned char *ref, int len, int bpp, int predictor) = NULL;
+
+#ifdef HAVE_SSE2
+
+#include <immintrin.h>
+
+#define SSE2 __attribute__((target("sse2")))
+#define AVX2 __attribute__((target("avx2")))
+
+static inline SSE2 __m128i load_pixel(unsigned char *p, int bpp)
+{
+	unsigned int v = 0;
+	memcpy(&v, p, bpp);
+	return _mm_cvtsi32_si128(v);
+}
+
+static inline SSE2 void store_pixel(unsigned char *p, __m128i v, int bpp)
+{
+	unsigned int x = _mm_cvtsi128_si32(v);
+	memcpy(p, &x, bpp);
+}
+
+static inline SSE2 void
+sub_sse2(unsigned char *out, unsigned char *in, int len, int bpp)
+{
+	__m128i a = _mm_setzero_si128();
+	int i;
+
+	for (i = 0; i + bpp <= len; i += bpp)
+	{
+		a = _mm_add_epi8(a, load_pixel(in + i, bpp));
+		store_pixel(out + i, a, bpp);
+	}
+	for (; i < len; i++)
+		out[i] = in[i] + (i >= bpp ? out[i - bpp] : 0);
+}
+
+static SSE2 void
+sub1_sse2(unsigned char *out, unsigned char *in, int len)
+{
+	__m128i x, last = _mm_setzero_si128();
+	int i;
+
+	/* running sum in log steps across each vector */
+	for (i = 0; i + 16 <= len; i += 16)
+	{
+		x = _mm_loadu_si128((__m128i*)(in + i));
+		x = _mm_add_epi8(x, _mm_slli_si128(x, 1));
+		x = _mm_add_epi8(x, _mm_slli_si128(x, 2));
+		x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+		x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+		x = _mm_add_epi8(x, last);
+		_mm_storeu_si128((__m128i*)(out + i), x);
+		last = _mm_set1_epi8((char)_mm_cvtsi128_si32(_mm_srli_si128(x, 15)));
+	}
+	for (; i < len; i++)
+		out[i] = in[i] + (i > 0 ? out[i - 1] : 0);
+}
+
+static SSE2 void
+up_sse2(unsigned char *out, unsigned char *in, unsigned char *ref, int len)
+{
+	__m128i x, y;
+	int i;
+
+	for (i = 0; i + 16 <= len; i += 16)
+	{
+		x = _mm_loadu_si128((__m128i*)(in + i));
+		y = _mm_loadu_si128((__m128i*)(ref + i));
+		_mm_storeu_si128((__m128i*)(out + i), _mm_add_epi8(x, y));
+	}
+	for (; i < len; i++)
+		out[i] = in[i] + ref[i];
+}
+
+static inline SSE2 void
+avg_sse2(unsigned char *out, unsigned char *in, unsigned char *ref, int len, int bpp)
+{
+	__m128i one = _mm_set1_epi8(1);
+	__m128i a = _mm_setzero_si128();
+	__m128i b, avg;
+	int i;
+
+	for (i = 0; i + bpp <= len; i += bpp)
+	{
+		b = load_pixel(ref + i, bpp);
+		/* pavgb rounds up; knock off the carry to get (a + b) / 2 */
+		avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+		a = _mm_add_epi8(avg, load_pixel(in + i, bpp));
+		store_pixel(out + i, a, bpp);
+	}
+	for (; i < len; i++)
+		out[i] = in[i] + ((i >= bpp ? out[i - bpp] : 0) + ref[i]) / 2;
+}
+
+static inline SSE2 __m128i abs_epi16(__m128i x)
+{
+	return _mm_max_epi16(x, _mm_sub_epi16(_mm_setzero_si128(), x));
+}
+
+static inline SSE2 __m128i select_epi16(__m128i mask, __m128i a, __m128i b)
+{
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static inline SSE2 void
+paeth_sse2(unsigned char *out, unsigned char *in, unsigned char *ref, int len, int bpp)
+{
+	__m128i zero = _mm_setzero_si128();
+	__m128i mask = _mm_set1_epi16(0xff);
+	__m128i a = zero, c = zero;
+	__m128i b, x, pa, pb, pc, smallest, nearest;
+	int i;
+
+	/* same choice as paeth(), in 16-bit lanes */
+	for (i = 0; i + bpp <= len; i += bpp)
+	{
+		b = _mm_unpacklo_epi8(load_pixel(ref + i, bpp), zero);
+		x = _mm_unpacklo_epi8(load_pixel(in + i, bpp), zero);
+		pa = _mm_sub_epi16(b, c);
+		pb = _mm_sub_epi16(a, c);
+		pc = abs_epi16(_mm_add_epi16(pa, pb));
+		pa = abs_epi16(pa);
+		pb = abs_epi16(pb);
+		smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+		nearest = select_epi16(_mm_cmpeq_epi16(smallest, pa), a,
+			select_epi16(_mm_cmpeq_epi16(smallest, pb), b, c));
+		a = _mm_and_si128(_mm_add_epi16(x, nearest), mask);
+		store_pixel(out + i, _mm_packus_epi16(a, a), bpp);
+		c = b;
+	}
+	for (; i < len; i++)
+		out[i] = in[i] + (i >= bpp ? paeth(out[i - bpp], ref[i], ref[i - bpp]) : ref[i]);
+}
+
+static SSE2 int
+fz_predict_png_sse2(unsigned char *out, unsigned char *in, unsigned char *ref, int len, int bpp, int predictor)
+{
+	if (predictor == 2)
+	{
+		up_sse2(out, in, ref, len);
+		return 1;
+	}
+
+	/* Pass constant pixel sizes so the pixel loads and stores are inlined */
+	switch (predictor * 8 + bpp)
+	{
+	case 1 * 8 + 1: sub1_sse2(out, in, len); return 1;
+	case 1 * 8 + 3: sub_sse2(out, in, len, 3); return 1;
+	case 1 * 8 + 4: sub_sse2(out, in, len, 4); return 1;
+	case 3 * 8 + 3: avg_sse2(out, in, ref, len, 3); return 1;
+	case 3 * 8 + 4: avg_sse2(out, in, ref, len, 4); return 1;
+	case 4 * 8 + 3: paeth_sse2(out, in, ref, len, 3); return 1;
+	case 4 * 8 + 4: paeth_sse2(out, in, ref, len, 4); return 1;
+	}
+	return 0;
+}
+
+static AVX2 int
+fz_predict_png_avx2(unsigned char *out, unsigned char *in, unsigned char *ref, int len, int bpp, int predictor)
+{
+	__m256i x, y;
+	int i;
+
+	if (predictor != 2)
+		return fz_predict_png_sse2(out, in, ref, len, bpp, predictor);
+
+	for (i = 0; i + 32 <= len; i += 32)
+	{
+		x = _mm256_loadu_si256((__m256i*)(in + i));
+		y = _mm256_loadu_si256((__m256i*)(ref + i));
+		_mm256_storeu_si256((__m256i*)(out + i), _mm256_add_epi8(x, y));
+	}
+	up_sse2(out + i, in + i, ref + i, len - i);
+	return 1;
+}
+
+#endif
+
+static void
+fz_init_predict_simd(void)
+{
+	static int done = 0;
+	if (done)
+		return;
+#ifdef HAVE_SSE2
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		fz_predict_png_simd = fz_predict_png_avx2;
+	else if (__builtin_cpu_supports("sse2"))
+		fz_predict_png_simd = fz_predict_png_sse2;
+#endif
+	done = 1;
+}
+
 static void
 fz_predict_tiff(fz_predict *state, unsigned char *out, unsigned char *in, int len)
 {
 	int left[MAXC];
 	int i, k;
 
+	/* with whole-byte components this is the PNG Sub predictor */
+	if (state->bpc == 8 && fz_predict_png_simd)
+		if (fz_predict_png_simd(out, in, NULL, state->columns * state->colors, state->colors, 1))
+			return;
+
 	for (k = 0; k < state->colors; k++)
 		left[k] = 0;
 
@@ -86,10 +298,13 @@ fz_predict_png(fz_predict *state, unsigned char *out, unsigned char *in, int len
 	int i;
 	unsigned char *ref = state->ref;
 
+	if (fz_predict_png_simd && fz_predict_png_simd(out, in, ref, len, bpp, predictor))
+		return;
+
 	switch (predictor)
 	{
 	case 0:
-		memcpy(out, in, len);
+		memmove(out, in, len);
 		break;
 	case 1:
 		for (i = bpp; i > 0; i--)
@@ -189,15 +404,11 @@ close_predict(fz_stream *stm)
 	fz_free(state);
 }
 
-fz_stream *
-fz_open_predict(fz_stream *chain, fz_obj *params)
+static void
+fz_init_predict(fz_predict *state, fz_obj *params)
 {
-	fz_predict *state;
 	fz_obj *obj;
 
-	state = fz_malloc(sizeof(fz_predict));
-	state->chain = chain;
-
 	state->predictor = 1;
 	state->columns = 1;
 	state->colors = 1;
@@ -231,6 +442,19 @@ fz_open_predict(fz_stream *chain, fz_obj *params)
 	state->stride = (state->bpc * state->colors * state->columns + 7) / 8;
 	state->bpp = (state->bpc * state->colors + 7) / 8;
 
+	fz_init_predict_simd();
+}
+
+fz_stream *
+fz_open_predict(fz_stream *chain, fz_obj *params)
+{
+	fz_predict *state;
+
+	state = fz_malloc(sizeof(fz_predict));
+	state->chain = chain;
+
+	fz_init_predict(state, params);
+
 	state->in = fz_malloc(state->stride + 1);
 	state->out = fz_malloc(state->stride);
 	state->ref = fz_malloc(state->stride);
@@ -241,3 +465,55 @@ fz_open_predict(fz_stream *chain, fz_obj *params)
 
 	return fz_new_stream(state, read_predict, close_predict);
 }
+
+/*
+ * Whole buffer prediction, for data decoded in one go. Only the PNG
+ * predictors are handled, since each row can be undone in place: the
+ * output row always starts before the input row it is made from.
+ */
+
+int
+fz_png_predicted_length(fz_obj *params, int len)
+{
+	fz_predict state;
+
+	fz_init_predict(&state, params);
+	if (state.predictor < 10 || state.stride <= 0 || state.bpp <= 0)
+		return -1;
+	if (len % state.stride != 0 || len / state.stride > INT_MAX / (state.stride + 1))
+		return -1;
+	return len / state.stride * (state.stride + 1);
+}
+
+int
+fz_unpredict_png_buffer(unsigned char *buf, int len, fz_obj *params)
+{
+	fz_predict state;
+	unsigned char *in, *out, *zero;
+	int rows, i;
+
+	fz_init_predict(&state, params);
+	if (state.predictor < 10 || state.stride <= 0 || state.bpp <= 0)
+		return -1;
+
+	rows = len / (state.stride + 1);
+
+	/* the row above the first row is all zero */
+	zero = fz_malloc(state.stride);
+	memset(zero, 0, state.stride);
+	state.ref = zero;
+
+	in = buf;
+	out = buf;
+	for (i = 0; i < rows; i++)
+	{
+		fz_predict_png(&state, out, in + 1, state.stride, in[0]);
+		state.ref = out;
+		in += state.stride + 1;
+		out += state.stride;
+	}
+
+	fz_free(zero);
+
+	return rows * state.stride;
+}
@@ -1,6 +1,14 @@
 #ifndef _FITZ_H_
 #define _FITZ_H_
 
+/*
+ * Ask for 64-bit file offsets on 32-bit unix systems.
+ */
+
+#ifndef _FILE_OFFSET_BITS
+#define _FILE_OFFSET_BITS 64
+#endif
+
 /*
  * Include the standard libc headers.
  */
@@ -60,6 +68,12 @@ int gettimeofday(struct timeval *tv, struct timezone *tz);
 #define M_SQRT2 1.41421356237309504880
 #endif
 
+/*
+ * File offsets and file sizes are 64-bit so we can read files over 2 GB.
+ */
+
+typedef long long fz_off_t;
+
 /*
  * Variadic macros, inline and restrict keywords
  */
@@ -356,10 +370,13 @@ void aes_crypt_cbc( fz_aes *ctx, int mode, int length,
 typedef struct fz_obj_s fz_obj;
 
 extern fz_obj* (*fz_resolve_indirect)(fz_obj*);
+extern int (*fz_decrypt_string)(void *crypt, int num, int gen, unsigned char *s, int len);
+extern void (*fz_drop_string_crypt)(void *crypt);
 
 fz_obj *fz_new_null(void);
 fz_obj *fz_new_bool(int b);
 fz_obj *fz_new_int(int i);
+fz_obj *fz_new_offset(fz_off_t ofs);
 fz_obj *fz_new_real(float f);
 fz_obj *fz_new_name(char *str);
 fz_obj *fz_new_string(char *str, int len);
@@ -389,6 +406,7 @@ int fz_objcmp(fz_obj *a, fz_obj *b);
 /* safe, silent failure, no error reporting */
 int fz_to_bool(fz_obj *obj);
 int fz_to_int(fz_obj *obj);
+fz_off_t fz_to_offset(fz_obj *obj);
 float fz_to_real(fz_obj *obj);
 char *fz_to_name(fz_obj *obj);
 char *fz_to_str_buf(fz_obj *obj);
@@ -418,8 +436,9 @@ int fz_fprint_obj(FILE *fp, fz_obj *obj, int tight);
 void fz_debug_obj(fz_obj *obj);
 void fz_debug_ref(fz_obj *obj);
 
-void fz_set_str_len(fz_obj *obj, int newlen); /* private */
+void fz_set_str_crypt(fz_obj *obj, void *crypt, int num, int gen); /* private */
 void *fz_get_indirect_xref(fz_obj *obj); /* private */
+int fz_get_obj_refs(fz_obj *obj); /* private */
 
 /*
  * Data buffers.
@@ -432,9 +451,12 @@ struct fz_buffer_s
 	int refs;
 	unsigned char *data;
 	int cap, len;
+	fz_buffer *parent; /* data is a slice of the parent's data */
+	int mapped; /* data is a read-only memory mapped file */
 };
 
 fz_buffer *fz_new_buffer(int size);
+fz_buffer *fz_new_buffer_slice(fz_buffer *parent, int offset, int len);
 fz_buffer *fz_keep_buffer(fz_buffer *buf);
 void fz_drop_buffer(fz_buffer *buf);
 
@@ -453,15 +475,15 @@ struct fz_stream_s
 	int refs;
 	int error;
 	int eof;
-	int pos;
+	fz_off_t pos;
 	int avail;
 	int bits;
 	unsigned char *bp, *rp, *wp, *ep;
 	void *state;
 	int (*read)(fz_stream *stm, unsigned char *buf, int len);
 	void (*close)(fz_stream *stm);
-	void (*seek)(fz_stream *stm, int offset, int whence);
-	unsigned char buf[4096];
+	void (*seek)(fz_stream *stm, fz_off_t offset, int whence);
+	unsigned char *buf;
 };
 
 fz_stream *fz_open_fd(int file);
@@ -471,12 +493,15 @@ fz_stream *fz_open_buffer(fz_buffer *buf);
 fz_stream *fz_open_memory(unsigned char *data, int len);
 void fz_close(fz_stream *stm);
 
+fz_buffer *fz_slice_stream(fz_stream *stm, fz_off_t offset, int len);
+
 fz_stream *fz_new_stream(void*, int(*)(fz_stream*, unsigned char*, int), void(*)(fz_stream *));
 fz_stream *fz_keep_stream(fz_stream *stm);
+void fz_resize_stream_buffer(fz_stream *stm, int size);
 void fz_fill_buffer(fz_stream *stm);
 
-int fz_tell(fz_stream *stm);
-void fz_seek(fz_stream *stm, int offset, int whence);
+fz_off_t fz_tell(fz_stream *stm);
+void fz_seek(fz_stream *stm, fz_off_t offset, int whence);
 
 int fz_read(fz_stream *stm, unsigned char *buf, int len);
 void fz_read_line(fz_stream *stm, char *buf, int max);
@@ -565,6 +590,8 @@ static inline int fz_is_eof_bits(fz_stream *stm)
  * Data filters.
  */
 
+typedef struct fz_jbig2_globals_s fz_jbig2_globals;
+
 fz_stream *fz_open_copy(fz_stream *chain);
 fz_stream *fz_open_null(fz_stream *chain, int len);
 fz_stream *fz_open_arc4(fz_stream *chain, unsigned char *key, unsigned keylen);
@@ -572,12 +599,21 @@ fz_stream *fz_open_aesd(fz_stream *chain, unsigned char *key, unsigned keylen);
 fz_stream *fz_open_a85d(fz_stream *chain);
 fz_stream *fz_open_ahxd(fz_stream *chain);
 fz_stream *fz_open_rld(fz_stream *chain);
-fz_stream *fz_open_dctd(fz_stream *chain, fz_obj *param);
+fz_stream *fz_open_dctd(fz_stream *chain, fz_obj *param, int l2factor);
 fz_stream *fz_open_faxd(fz_stream *chain, fz_obj *param);
 fz_stream *fz_open_flated(fz_stream *chain);
 fz_stream *fz_open_lzwd(fz_stream *chain, fz_obj *param);
 fz_stream *fz_open_predict(fz_stream *chain, fz_obj *param);
-fz_stream *fz_open_jbig2d(fz_stream *chain, fz_buffer *global);
+fz_stream *fz_open_jbig2d(fz_stream *chain, fz_jbig2_globals *globals);
+
+/* decoded JBIG2 global segments, shared by the streams that use them */
+fz_jbig2_globals *fz_load_jbig2_globals(unsigned char *data, int len);
+fz_jbig2_globals *fz_keep_jbig2_globals(fz_jbig2_globals *globals);
+void fz_drop_jbig2_globals(fz_jbig2_globals *globals);
+
+int fz_inflate_buffer(unsigned char *out, int outlen, unsigned char *in, int inlen);
+int fz_png_predicted_length(fz_obj *params, int len);
+int fz_unpredict_png_buffer(unsigned char *buf, int len, fz_obj *params);
 
 /*
  * Resources and other graphics related objects.
@@ -635,16 +671,58 @@ fz_error fz_write_pnm(fz_pixmap *pixmap, char *filename);
 fz_error fz_write_pam(fz_pixmap *pixmap, char *filename, int savealpha);
 fz_error fz_write_png(fz_pixmap *pixmap, char *filename, int savealpha);
 
-fz_error fz_load_jpx_image(fz_pixmap **imgp, unsigned char *data, int size, fz_colorspace *dcs);
+fz_error fz_load_jpx_image(fz_pixmap **imgp, unsigned char *data, int size, fz_colorspace *dcs, int l2factor);
 
 /*
- * Bitmaps have 1 component per bit. Only used for creating halftoned versions
- * of contone buffers, and saving out. Samples are stored msb first, akin to
- * pbms.
+ * Images are kept compressed and only decoded to pixmaps when they are
+ * drawn, at no more than the size they are drawn at. The last pixmap
+ * decoded for each image is kept in an image cache of bounded size, which
+ * the caller creates and passes to the draw device.
+ *
+ * Bilevel images and masks may also be loaded as a packed bitmap, at
+ * one bit per pixel, if load_bitmap is set. Set bits are opaque in masks
+ * and white in gray images.
  */
 
+typedef struct fz_image_s fz_image;
+typedef struct fz_image_cache_s fz_image_cache;
 typedef struct fz_bitmap_s fz_bitmap;
 
+struct fz_image_s
+{
+	int refs;
+	int w, h;
+	fz_colorspace *colorspace; /* NULL for image masks */
+	fz_image *mask; /* explicit soft/image mask */
+	void *state;
+	fz_error (*load)(fz_pixmap **pixp, void *state, int w, int h);
+	fz_error (*load_bitmap)(fz_bitmap **bitp, void *state);
+	void (*free_state)(void *state);
+	fz_pixmap *tile;
+	fz_bitmap *bitmap;
+	fz_image_cache *cache;
+	fz_image *prev, *next;
+};
+
+fz_image *fz_new_image(int w, int h, fz_colorspace *colorspace, void *state,
+	fz_error (*load)(fz_pixmap **pixp, void *state, int w, int h),
+	void (*free_state)(void *state));
+fz_image *fz_new_image_from_pixmap(fz_pixmap *pix);
+fz_image *fz_keep_image(fz_image *image);
+void fz_drop_image(fz_image *image);
+fz_error fz_image_to_pixmap(fz_pixmap **pixp, fz_image_cache *cache, fz_image *image, int w, int h);
+fz_error fz_image_to_bitmap(fz_bitmap **bitp, fz_image_cache *cache, fz_image *image);
+
+fz_image_cache *fz_new_image_cache(void);
+void fz_set_image_cache_limit(fz_image_cache *cache, int size);
+void fz_free_image_cache(fz_image_cache *cache);
+
+/*
+ * Bitmaps have 1 component per bit. Used for creating halftoned versions
+ * of contone buffers and saving out, and for the samples of bilevel images.
+ * Samples are stored msb first, akin to pbms.
+ */
+
 struct fz_bitmap_s
 {
 	int refs;
@@ -977,9 +1055,9 @@ struct fz_device_s
 	void (*ignore_text)(void *, fz_text *, fz_matrix);
 
 	void (*fill_shade)(void *, fz_shade *shd, fz_matrix ctm, float alpha);
-	void (*fill_image)(void *, fz_pixmap *img, fz_matrix ctm, float alpha);
-	void (*fill_image_mask)(void *, fz_pixmap *img, fz_matrix ctm, fz_colorspace *, float *color, float alpha);
-	void (*clip_image_mask)(void *, fz_pixmap *img, fz_rect *rect, fz_matrix ctm);
+	void (*fill_image)(void *, fz_image *img, fz_matrix ctm, float alpha);
+	void (*fill_image_mask)(void *, fz_image *img, fz_matrix ctm, fz_colorspace *, float *color, float alpha);
+	void (*clip_image_mask)(void *, fz_image *img, fz_rect *rect, fz_matrix ctm);
 
 	void (*pop_clip)(void *);
 
@@ -1003,9 +1081,9 @@ void fz_clip_stroke_text(fz_device *dev, fz_text *text, fz_stroke_state *stroke,
 void fz_ignore_text(fz_device *dev, fz_text *text, fz_matrix ctm);
 void fz_pop_clip(fz_device *dev);
 void fz_fill_shade(fz_device *dev, fz_shade *shade, fz_matrix ctm, float alpha);
-void fz_fill_image(fz_device *dev, fz_pixmap *image, fz_matrix ctm, float alpha);
-void fz_fill_image_mask(fz_device *dev, fz_pixmap *image, fz_matrix ctm, fz_colorspace *colorspace, float *color, float alpha);
-void fz_clip_image_mask(fz_device *dev, fz_pixmap *image, fz_rect *rect, fz_matrix ctm);
+void fz_fill_image(fz_device *dev, fz_image *image, fz_matrix ctm, float alpha);
+void fz_fill_image_mask(fz_device *dev, fz_image *image, fz_matrix ctm, fz_colorspace *colorspace, float *color, float alpha);
+void fz_clip_image_mask(fz_device *dev, fz_image *image, fz_rect *rect, fz_matrix ctm);
 void fz_begin_mask(fz_device *dev, fz_rect area, int luminosity, fz_colorspace *colorspace, float *bc);
 void fz_end_mask(fz_device *dev);
 void fz_begin_group(fz_device *dev, fz_rect area, int isolated, int knockout, int blendmode, float alpha);
@@ -1018,7 +1096,7 @@ void fz_free_device(fz_device *dev);
 
 fz_device *fz_new_trace_device(void);
 fz_device *fz_new_bbox_device(fz_bbox *bboxp);
-fz_device *fz_new_draw_device(fz_glyph_cache *cache, fz_pixmap *dest);
+fz_device *fz_new_draw_device(fz_glyph_cache *cache, fz_image_cache *images, fz_pixmap *dest);
 fz_device *fz_new_draw_device_type3(fz_glyph_cache *cache, fz_pixmap *dest);
 
 /*
@@ -1075,6 +1153,7 @@ void fz_accelerate_arch(void);
 void fz_decode_tile(fz_pixmap *pix, float *decode);
 void fz_decode_indexed_tile(fz_pixmap *pix, float *decode, int maxval);
 void fz_unpack_tile(fz_pixmap *dst, unsigned char * restrict src, int n, int depth, int stride, int scale);
+void fz_unpack_tile_reduced(fz_pixmap *dst, unsigned char * restrict src, int w, int h, int n, int depth, int stride, int scale, int fx, int fy);
 
 void fz_paint_solid_alpha(unsigned char * restrict dp, int w, int alpha);
 void fz_paint_solid_color(unsigned char * restrict dp, int n, int w, unsigned char *color);
@@ -1084,6 +1163,8 @@ void fz_paint_span_with_color(unsigned char * restrict dp, unsigned char * restr
 
 void fz_paint_image(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_pixmap *img, fz_matrix ctm, int alpha);
 void fz_paint_image_with_color(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_pixmap *img, fz_matrix ctm, unsigned char *colorbv);
+void fz_paint_bitmap(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_bitmap *bit, fz_matrix ctm, unsigned char *black, unsigned char *white, int alpha);
+void fz_paint_bitmap_with_color(fz_pixmap *dst, fz_bbox scissor, fz_pixmap *shape, fz_bitmap *bit, fz_matrix ctm, unsigned char *colorbv);
 
 void fz_paint_pixmap(fz_pixmap *dst, fz_pixmap *src, int alpha);
 void fz_paint_pixmap_with_mask(fz_pixmap *dst, fz_pixmap *src, fz_pixmap *msk);
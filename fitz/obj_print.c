@@ -235,7 +235,7 @@ static void fmt_obj(struct fmt *fmt, fz_obj *obj)
 		fmt_puts(fmt, fz_to_bool(obj) ? "true" : "false");
 	else if (fz_is_int(obj))
 	{
-		sprintf(buf, "%d", fz_to_int(obj));
+		sprintf(buf, "%lld", fz_to_offset(obj));
 		fmt_puts(fmt, buf);
 	}
 	else if (fz_is_real(obj))
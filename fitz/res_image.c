@@ -0,0 +1,278 @@
+#include "fitz.h"
+
+/*
+ * Decoded pixmaps and bitmaps are kept in a list of images, most
+ * recently used first. When the list holds more than the limit, the
+ * samples of the least recently used images are dropped; they will be
+ * decoded again if the image is drawn again.
+ *
+ * Like the glyph cache, an image cache belongs to whoever created it and
+ * is passed to the draw device. An image is in at most one cache at a time.
+ */
+
+struct fz_image_cache_s
+{
+	int limit;
+	int used;
+	fz_image *head, *tail;
+};
+
+fz_image_cache *
+fz_new_image_cache(void)
+{
+	fz_image_cache *cache;
+
+	cache = fz_malloc(sizeof(fz_image_cache));
+	cache->limit = 64 << 20;
+	cache->used = 0;
+	cache->head = NULL;
+	cache->tail = NULL;
+
+	return cache;
+}
+
+static int
+fz_cached_size(fz_image *image)
+{
+	int size = 0;
+	if (image->tile && image->load)
+		size += image->tile->w * image->tile->h * image->tile->n;
+	if (image->bitmap)
+		size += image->bitmap->stride * image->bitmap->h;
+	return size;
+}
+
+static void
+fz_uncache_image(fz_image *image)
+{
+	fz_image_cache *cache = image->cache;
+
+	if (!cache)
+		return;
+
+	if (image->prev)
+		image->prev->next = image->next;
+	else
+		cache->head = image->next;
+	if (image->next)
+		image->next->prev = image->prev;
+	else
+		cache->tail = image->prev;
+	image->prev = NULL;
+	image->next = NULL;
+	image->cache = NULL;
+
+	cache->used -= fz_cached_size(image);
+}
+
+static void
+fz_evict_image(fz_image *image)
+{
+	fz_uncache_image(image);
+	if (image->tile && image->load)
+	{
+		fz_drop_pixmap(image->tile);
+		image->tile = NULL;
+	}
+	if (image->bitmap)
+	{
+		fz_drop_bitmap(image->bitmap);
+		image->bitmap = NULL;
+	}
+}
+
+static void
+fz_cache_image(fz_image_cache *cache, fz_image *image)
+{
+	int size = fz_cached_size(image);
+
+	if (size == 0)
+		return;
+
+	image->cache = cache;
+	image->prev = NULL;
+	image->next = cache->head;
+	if (cache->head)
+		cache->head->prev = image;
+	else
+		cache->tail = image;
+	cache->head = image;
+
+	cache->used += size;
+	while (cache->used > cache->limit && cache->tail != image)
+		fz_evict_image(cache->tail);
+}
+
+void
+fz_set_image_cache_limit(fz_image_cache *cache, int size)
+{
+	cache->limit = size;
+	while (cache->used > cache->limit && cache->tail)
+		fz_evict_image(cache->tail);
+}
+
+/*
+ * Images outlive the cache; the samples they hold are dropped with it.
+ */
+void
+fz_free_image_cache(fz_image_cache *cache)
+{
+	while (cache->tail)
+		fz_evict_image(cache->tail);
+	fz_free(cache);
+}
+
+fz_image *
+fz_new_image(int w, int h, fz_colorspace *colorspace, void *state,
+	fz_error (*load)(fz_pixmap **pixp, void *state, int w, int h),
+	void (*free_state)(void *state))
+{
+	fz_image *image;
+
+	image = fz_malloc(sizeof(fz_image));
+	image->refs = 1;
+	image->w = w;
+	image->h = h;
+	image->colorspace = colorspace ? fz_keep_colorspace(colorspace) : NULL;
+	image->mask = NULL;
+	image->state = state;
+	image->load = load;
+	image->load_bitmap = NULL;
+	image->free_state = free_state;
+	image->tile = NULL;
+	image->bitmap = NULL;
+	image->cache = NULL;
+	image->prev = NULL;
+	image->next = NULL;
+
+	return image;
+}
+
+/*
+ * Wrap an already decoded pixmap. It can't be decoded again,
+ * so it stays with the image and out of the cache.
+ */
+fz_image *
+fz_new_image_from_pixmap(fz_pixmap *pix)
+{
+	fz_image *image;
+
+	image = fz_new_image(pix->w, pix->h, pix->colorspace, NULL, NULL, NULL);
+	image->tile = fz_keep_pixmap(pix);
+	if (pix->mask)
+		image->mask = fz_new_image_from_pixmap(pix->mask);
+
+	return image;
+}
+
+fz_image *
+fz_keep_image(fz_image *image)
+{
+	image->refs++;
+	return image;
+}
+
+void
+fz_drop_image(fz_image *image)
+{
+	if (image && --image->refs == 0)
+	{
+		fz_evict_image(image);
+		if (image->tile)
+			fz_drop_pixmap(image->tile);
+		if (image->mask)
+			fz_drop_image(image->mask);
+		if (image->colorspace)
+			fz_drop_colorspace(image->colorspace);
+		if (image->free_state)
+			image->free_state(image->state);
+		fz_free(image);
+	}
+}
+
+/*
+ * Get a pixmap of the image that will do for drawing it w by h pixels
+ * large, or at full size if w and h are zero. A pixmap decoded earlier
+ * is reused if it is big enough; otherwise the image is decoded again.
+ * Without a cache the decoded pixmap is not kept.
+ */
+fz_error
+fz_image_to_pixmap(fz_pixmap **pixp, fz_image_cache *cache, fz_image *image, int w, int h)
+{
+	fz_error error;
+	fz_pixmap *tile = image->tile;
+
+	if (tile && !image->load)
+	{
+		*pixp = fz_keep_pixmap(tile);
+		return fz_okay;
+	}
+
+	if (tile && ((tile->w >= image->w && tile->h >= image->h) ||
+		(w > 0 && h > 0 && tile->w >= w && tile->h >= h)))
+	{
+		if (cache)
+		{
+			fz_uncache_image(image);
+			fz_cache_image(cache, image);
+		}
+		*pixp = fz_keep_pixmap(tile);
+		return fz_okay;
+	}
+
+	error = image->load(&tile, image->state, w, h);
+	if (error)
+		return fz_rethrow(error, "cannot decode image");
+
+	if (cache)
+	{
+		fz_uncache_image(image);
+		if (image->tile)
+			fz_drop_pixmap(image->tile);
+		image->tile = fz_keep_pixmap(tile);
+		fz_cache_image(cache, image);
+	}
+
+	*pixp = tile;
+	return fz_okay;
+}
+
+/*
+ * Get the packed samples of a bilevel image, at full size.
+ */
+fz_error
+fz_image_to_bitmap(fz_bitmap **bitp, fz_image_cache *cache, fz_image *image)
+{
+	fz_error error;
+	fz_bitmap *bit;
+
+	if (!image->load_bitmap)
+		return fz_throw("image has no packed samples");
+
+	if (image->bitmap)
+	{
+		bit = fz_keep_bitmap(image->bitmap);
+	}
+	else
+	{
+		error = image->load_bitmap(&bit, image->state);
+		if (error)
+			return fz_rethrow(error, "cannot decode image");
+		if (!cache)
+		{
+			*bitp = bit;
+			return fz_okay;
+		}
+		fz_uncache_image(image);
+		image->bitmap = fz_keep_bitmap(bit);
+	}
+
+	if (cache)
+	{
+		fz_uncache_image(image);
+		fz_cache_image(cache, image);
+	}
+
+	*bitp = bit;
+	return fz_okay;
+}
@@ -1,5 +1,9 @@
 #include "fitz.h"
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 fz_buffer *
 fz_new_buffer(int size)
 {
@@ -12,6 +16,38 @@ fz_new_buffer(int size)
 	b->data = fz_malloc(size);
 	b->cap = size;
 	b->len = 0;
+	b->parent = NULL;
+	b->mapped = 0;
+
+	return b;
+}
+
+/*
+ * Create a buffer that shares a range of the data of another buffer.
+ * The slice keeps the parent alive, and gets its own copy of the data
+ * if it is ever resized.
+ */
+fz_buffer *
+fz_new_buffer_slice(fz_buffer *parent, int offset, int len)
+{
+	fz_buffer *b;
+
+	assert(offset >= 0 && len >= 0 && offset + len <= parent->len);
+
+	/* share the root buffer rather than build chains of slices */
+	if (parent->parent)
+	{
+		offset += parent->data - parent->parent->data;
+		parent = parent->parent;
+	}
+
+	b = fz_malloc(sizeof(fz_buffer));
+	b->refs = 1;
+	b->data = parent->data + offset;
+	b->cap = len;
+	b->len = len;
+	b->parent = fz_keep_buffer(parent);
+	b->mapped = 0;
 
 	return b;
 }
@@ -23,12 +59,25 @@ fz_keep_buffer(fz_buffer *buf)
 	return buf;
 }
 
+static void
+fz_free_buffer_data(fz_buffer *buf)
+{
+	if (buf->parent)
+		fz_drop_buffer(buf->parent);
+#ifndef _WIN32
+	else if (buf->mapped)
+		munmap(buf->data, buf->cap);
+#endif
+	else
+		fz_free(buf->data);
+}
+
 void
 fz_drop_buffer(fz_buffer *buf)
 {
 	if (--buf->refs == 0)
 	{
-		fz_free(buf->data);
+		fz_free_buffer_data(buf);
 		fz_free(buf);
 	}
 }
@@ -36,7 +85,18 @@ fz_drop_buffer(fz_buffer *buf)
 void
 fz_resize_buffer(fz_buffer *buf, int size)
 {
-	buf->data = fz_realloc(buf->data, size, 1);
+	if (buf->parent || buf->mapped)
+	{
+		/* borrowed data is read-only: move it into memory we own */
+		unsigned char *data = fz_malloc(MAX(size, 1));
+		memcpy(data, buf->data, MIN(size, buf->len));
+		fz_free_buffer_data(buf);
+		buf->data = data;
+		buf->parent = NULL;
+		buf->mapped = 0;
+	}
+	else
+		buf->data = fz_realloc(buf->data, size, 1);
 	buf->cap = size;
 	if (buf->len > buf->cap)
 		buf->len = buf->cap;
@@ -1,9 +1,24 @@
 #include "fitz.h"
 
-fz_stream *
-fz_new_stream(void *state,
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <sys/mman.h>
+#else
+#define lseek _lseeki64
+#endif
+
+/*
+ * Streams buffer 4k of data by default. Callers that know a stream
+ * will be read in bulk can ask for a larger buffer, up to 256k.
+ */
+
+#define FZ_STREAM_BUFFER_SIZE 4096
+#define FZ_MAX_STREAM_BUFFER_SIZE (256 << 10)
+
+static fz_stream *
+fz_new_stream_with_buffer(void *state,
 	int(*read)(fz_stream *stm, unsigned char *buf, int len),
-	void(*close)(fz_stream *stm))
+	void(*close)(fz_stream *stm), int size)
 {
 	fz_stream *stm;
 
@@ -17,10 +32,11 @@ fz_new_stream(void *state,
 	stm->bits = 0;
 	stm->avail = 0;
 
+	stm->buf = size > 0 ? fz_malloc(size) : NULL;
 	stm->bp = stm->buf;
 	stm->rp = stm->bp;
 	stm->wp = stm->bp;
-	stm->ep = stm->buf + sizeof stm->buf;
+	stm->ep = stm->buf + size;
 
 	stm->state = state;
 	stm->read = read;
@@ -30,6 +46,44 @@ fz_new_stream(void *state,
 	return stm;
 }
 
+fz_stream *
+fz_new_stream(void *state,
+	int(*read)(fz_stream *stm, unsigned char *buf, int len),
+	void(*close)(fz_stream *stm))
+{
+	return fz_new_stream_with_buffer(state, read, close, FZ_STREAM_BUFFER_SIZE);
+}
+
+/*
+ * Change the size of the buffer of a stream, keeping any data that
+ * has been buffered but not read yet. Streams that read directly from
+ * memory have no buffer of their own and are left alone.
+ */
+void
+fz_resize_stream_buffer(fz_stream *stm, int size)
+{
+	unsigned char *buf;
+	int n;
+
+	if (!stm->buf)
+		return;
+
+	n = stm->wp - stm->rp;
+	size = CLAMP(size, MAX(n, 1), FZ_MAX_STREAM_BUFFER_SIZE);
+	if (size == stm->ep - stm->bp)
+		return;
+
+	buf = fz_malloc(size);
+	memcpy(buf, stm->rp, n);
+	fz_free(stm->buf);
+
+	stm->buf = buf;
+	stm->bp = buf;
+	stm->rp = buf;
+	stm->wp = buf + n;
+	stm->ep = buf + size;
+}
+
 fz_stream *
 fz_keep_stream(fz_stream *stm)
 {
@@ -45,6 +99,7 @@ fz_close(fz_stream *stm)
 	{
 		if (stm->close)
 			stm->close(stm);
+		fz_free(stm->buf);
 		fz_free(stm);
 	}
 }
@@ -59,9 +114,9 @@ static int read_file(fz_stream *stm, unsigned char *buf, int len)
 	return n;
 }
 
-static void seek_file(fz_stream *stm, int offset, int whence)
+static void seek_file(fz_stream *stm, fz_off_t offset, int whence)
 {
-	int n = lseek(*(int*)stm->state, offset, whence);
+	fz_off_t n = lseek(*(int*)stm->state, offset, whence);
 	if (n < 0)
 		fz_warn("cannot lseek: %s", strerror(errno));
 	stm->pos = n;
@@ -77,12 +132,57 @@ static void close_file(fz_stream *stm)
 	fz_free(stm->state);
 }
 
+#ifndef _WIN32
+/*
+ * Map regular files into memory and read them as a buffer. This saves
+ * a read syscall and a copy for every buffer load, and lets
+ * fz_slice_stream hand out the contents without copying at all.
+ */
+static fz_buffer *
+fz_map_file(int fd)
+{
+	fz_buffer *buf;
+	struct stat st;
+	void *data;
+
+	if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+		return NULL;
+	if (st.st_size <= 0 || st.st_size > INT_MAX)
+		return NULL;
+
+	data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED)
+		return NULL;
+
+	buf = fz_malloc(sizeof(fz_buffer));
+	buf->refs = 1;
+	buf->data = data;
+	buf->cap = st.st_size;
+	buf->len = st.st_size;
+	buf->parent = NULL;
+	buf->mapped = 1;
+
+	return buf;
+}
+#endif
+
 fz_stream *
 fz_open_fd(int fd)
 {
 	fz_stream *stm;
 	int *state;
 
+#ifndef _WIN32
+	fz_buffer *map = fz_map_file(fd);
+	if (map)
+	{
+		close(fd);
+		stm = fz_open_buffer(map);
+		fz_drop_buffer(map);
+		return stm;
+	}
+#endif
+
 	state = fz_malloc(sizeof(int));
 	*state = fd;
 
@@ -119,15 +219,14 @@ static int read_buffer(fz_stream *stm, unsigned char *buf, int len)
 	return 0;
 }
 
-static void seek_buffer(fz_stream *stm, int offset, int whence)
+static void seek_buffer(fz_stream *stm, fz_off_t offset, int whence)
 {
-	if (whence == 0)
-		stm->rp = stm->bp + offset;
+	fz_off_t len = stm->ep - stm->bp;
 	if (whence == 1)
-		stm->rp += offset;
+		offset += stm->rp - stm->bp;
 	if (whence == 2)
-		stm->rp = stm->ep - offset;
-	stm->rp = CLAMP(stm->rp, stm->bp, stm->ep);
+		offset = len - offset;
+	stm->rp = stm->bp + CLAMP(offset, 0, len);
 	stm->wp = stm->ep;
 }
 
@@ -142,7 +241,7 @@ fz_open_buffer(fz_buffer *buf)
 {
 	fz_stream *stm;
 
-	stm = fz_new_stream(fz_keep_buffer(buf), read_buffer, close_buffer);
+	stm = fz_new_stream_with_buffer(fz_keep_buffer(buf), read_buffer, close_buffer, 0);
 	stm->seek = seek_buffer;
 
 	stm->bp = buf->data;
@@ -160,7 +259,7 @@ fz_open_memory(unsigned char *data, int len)
 {
 	fz_stream *stm;
 
-	stm = fz_new_stream(NULL, read_buffer, close_buffer);
+	stm = fz_new_stream_with_buffer(NULL, read_buffer, close_buffer, 0);
 	stm->seek = seek_buffer;
 
 	stm->bp = data;
@@ -172,3 +271,23 @@ fz_open_memory(unsigned char *data, int len)
 
 	return stm;
 }
+
+/*
+ * Return a buffer sharing the data of a buffer stream (including memory
+ * mapped files), or NULL if the stream is not backed by a buffer or the
+ * range is out of bounds. The caller must drop the returned buffer.
+ */
+fz_buffer *
+fz_slice_stream(fz_stream *stm, fz_off_t offset, int len)
+{
+	fz_buffer *buf;
+
+	if (stm->read != read_buffer || !stm->state)
+		return NULL;
+
+	buf = stm->state;
+	if (offset < 0 || len < 0 || offset > buf->len || len > buf->len - offset)
+		return NULL;
+
+	return fz_new_buffer_slice(buf, offset, len);
+}
@@ -46,18 +46,25 @@ fz_read(fz_stream *stm, unsigned char *buf, int len)
 	}
 	else
 	{
-		n = stm->read(stm, buf + count, len - count);
-		if (n < 0)
-		{
-			stm->error = 1;
-			return fz_rethrow(n, "read error");
-		}
-		else if (n == 0)
-		{
-			stm->eof = 1;
-		}
-		else if (n > 0)
+		/* large reads go straight into the caller's memory */
+		while (count < len)
 		{
+			n = stm->read(stm, buf + count, len - count);
+			if (n < 0)
+			{
+				stm->error = 1;
+				if (count > 0)
+				{
+					fz_catch(n, "read error; returning partial data");
+					break;
+				}
+				return fz_rethrow(n, "read error");
+			}
+			else if (n == 0)
+			{
+				stm->eof = 1;
+				break;
+			}
 			stm->pos += n;
 			count += n;
 		}
@@ -157,14 +164,14 @@ fz_read_line(fz_stream *stm, char *mem, int n)
 		*s = '\0';
 }
 
-int
+fz_off_t
 fz_tell(fz_stream *stm)
 {
 	return stm->pos - (stm->wp - stm->rp);
 }
 
 void
-fz_seek(fz_stream *stm, int offset, int whence)
+fz_seek(fz_stream *stm, fz_off_t offset, int whence)
 {
 	if (stm->seek)
 	{
@@ -175,10 +182,9 @@ fz_seek(fz_stream *stm, int offset, int whence)
 		}
 		if (whence == 0)
 		{
-			unsigned char *p = stm->wp - (stm->pos - offset);
-			if (p >= stm->bp && p <= stm->wp)
+			if (offset <= stm->pos && stm->pos - offset <= stm->wp - stm->bp)
 			{
-				stm->rp = p;
+				stm->rp = stm->wp - (stm->pos - offset);
 				stm->eof = 0;
 				return;
 			}
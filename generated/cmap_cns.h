@@ -0,0 +1,9301 @@
+/* This is an automatically generated file. Do not edit. */
+
+/* Adobe-CNS1-0 */
+
+static const pdf_range cmap_Adobe_CNS1_0_ranges[] = {
+{0,56393,0},
+};
+
+static const unsigned short cmap_Adobe_CNS1_0_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_CNS1_0 = {
+	-1, "Adobe-CNS1-0", "", 0, 0, 1,
+	{ {2,0,14335}, },
+	1, 1, (pdf_range*) cmap_Adobe_CNS1_0_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_CNS1_0_table,
+};
+
+/* Adobe-CNS1-1 */
+
+static const pdf_range cmap_Adobe_CNS1_1_ranges[] = {
+{0,65533,0},{16384,4093,16384},
+};
+
+static const unsigned short cmap_Adobe_CNS1_1_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_CNS1_1 = {
+	-1, "Adobe-CNS1-1", "", 0, 0, 1,
+	{ {2,0,17407}, },
+	2, 2, (pdf_range*) cmap_Adobe_CNS1_1_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_CNS1_1_table,
+};
+
+/* Adobe-CNS1-2 */
+
+static const pdf_range cmap_Adobe_CNS1_2_ranges[] = {
+{0,65533,0},{16384,4865,16384},
+};
+
+static const unsigned short cmap_Adobe_CNS1_2_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_CNS1_2 = {
+	-1, "Adobe-CNS1-2", "", 0, 0, 1,
+	{ {2,0,17663}, },
+	2, 2, (pdf_range*) cmap_Adobe_CNS1_2_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_CNS1_2_table,
+};
+
+/* Adobe-CNS1-3 */
+
+static const pdf_range cmap_Adobe_CNS1_3_ranges[] = {
+{0,65533,0},{16384,9845,16384},
+};
+
+static const unsigned short cmap_Adobe_CNS1_3_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_CNS1_3 = {
+	-1, "Adobe-CNS1-3", "", 0, 0, 1,
+	{ {2,0,18943}, },
+	2, 2, (pdf_range*) cmap_Adobe_CNS1_3_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_CNS1_3_table,
+};
+
+/* Adobe-CNS1-4 */
+
+static const pdf_range cmap_Adobe_CNS1_4_ranges[] = {
+{0,65533,0},{16384,10321,16384},
+};
+
+static const unsigned short cmap_Adobe_CNS1_4_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_CNS1_4 = {
+	-1, "Adobe-CNS1-4", "", 0, 0, 1,
+	{ {2,0,19199}, },
+	2, 2, (pdf_range*) cmap_Adobe_CNS1_4_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_CNS1_4_table,
+};
+
+/* Adobe-CNS1-5 */
+
+static const pdf_range cmap_Adobe_CNS1_5_ranges[] = {
+{0,65533,0},{16384,10813,16384},
+};
+
+static const unsigned short cmap_Adobe_CNS1_5_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_CNS1_5 = {
+	-1, "Adobe-CNS1-5", "", 0, 0, 1,
+	{ {2,0,19199}, },
+	2, 2, (pdf_range*) cmap_Adobe_CNS1_5_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_CNS1_5_table,
+};
+
+/* Adobe-CNS1-6 */
+
+static const pdf_range cmap_Adobe_CNS1_6_ranges[] = {
+{0,65533,0},{16384,11085,16384},
+};
+
+static const unsigned short cmap_Adobe_CNS1_6_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_CNS1_6 = {
+	-1, "Adobe-CNS1-6", "", 0, 0, 1,
+	{ {2,0,19199}, },
+	2, 2, (pdf_range*) cmap_Adobe_CNS1_6_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_CNS1_6_table,
+};
+
+/* Adobe-CNS1-UCS2 */
+
+static const pdf_range cmap_Adobe_CNS1_UCS2_ranges[] = {
+{0,0,65533},{1,377,32},{96,18,0},{101,5,12289},
+{103,34,5},{112,9,65104},{115,0,183},{116,13,65108},
+{120,30,14},{128,5,65288},{130,5,65077},{132,6,22},
+{134,5,65079},{136,5,12308},{138,5,65081},{140,5,12304},
+{142,5,65083},{144,5,12298},{146,5,65085},{148,5,12296},
+{150,5,65087},{152,5,12300},{154,5,65089},{156,5,12302},
+{158,5,65091},{160,21,65113},{166,5,8216},{168,5,8220},
+{170,5,12317},{172,106,24},{199,5,65097},{201,5,65101},
+{203,5,65099},{205,9,65119},{208,34,51},{217,5,8806},
+{219,14,60},{223,17,65122},{228,0,8764},{229,5,8745},
+{231,70,64},{249,5,8598},{251,42,82},{262,5,162},
+{264,14,93},{268,9,65129},{271,0,13269},{272,9,13212},
+{275,6,97},{277,5,13198},{279,42,99},{290,29,9601},
+{298,78,110},{318,5,9581},{320,22,130},{326,5,9698},
+{328,6,136},{330,9,9585},{333,37,65296},{343,37,8544},
+{353,33,12321},{362,10,138},{365,101,65313},{391,101,65345},
+{417,65,913},{434,25,931},{441,65,945},{458,25,963},
+{465,145,12549},{502,14,141},{506,37,9312},{516,37,9332},
+{526,37,8560},{536,102,145},{562,125,9216},{594,54,171},
+{608,5,20992},{610,114,185},{639,5,23376},{641,30,214},
+{649,9,24049},{652,90,222},{675,5,20166},{677,0,20173},
+{678,5,20170},{680,14,245},{684,5,20845},{686,10,249},
+{689,9,20998},{692,0,21243},{693,5,21246},{695,90,252},
+{718,5,24340},{720,166,275},{762,13,20180},{766,5,20195},
+{768,14,317},{772,5,20873},{774,0,20908},{775,5,20985},
+{777,14,321},{781,5,21253},{783,166,325},{825,5,24066},
+{827,26,367},{834,5,25171},{836,22,374},{842,5,26410},
+{844,62,380},{860,5,29992},{862,13,30000},{866,46,396},
+{878,5,19998},{880,5,20050},{882,42,408},{893,5,20240},
+{895,70,419},{913,5,21009},{915,22,437},{921,5,21360},
+{923,98,443},{948,5,22809},{950,5,22839},{952,26,468},
+{959,5,23383},{961,5,23431},{963,54,475},{977,5,25100},
+{979,26,489},{986,5,26092},{988,5,26354},{990,46,496},
+{1002,5,27743},{1004,14,508},{1008,5,27725},{1010,66,512},
+{1027,5,32907},{1029,106,529},{1056,5,20304},{1058,82,556},
+{1079,5,20918},{1081,6,577},{1083,5,21033},{1085,6,579},
+{1087,5,21161},{1089,90,581},{1112,5,21557},{1114,146,604},
+{1151,5,23386},{1153,14,641},{1157,5,23616},{1159,6,645},
+{1161,5,23696},{1163,198,647},{1213,13,26446},{1217,54,697},
+{1231,5,27784},{1233,86,711},{1255,5,28796},{1257,34,733},
+{1266,5,30007},{1268,230,742},{1326,5,20139},{1328,174,800},
+{1372,9,21367},{1375,142,844},{1411,5,22855},{1413,114,880},
+{1442,5,23621},{1444,66,909},{1461,5,24213},{1463,0,24310},
+{1464,5,24358},{1466,0,24361},{1467,5,24448},{1469,134,926},
+{1503,5,25299},{1505,50,960},{1518,5,25302},{1520,118,973},
+{1550,5,26479},{1552,42,1003},{1563,5,27494},{1565,38,1014},
+{1575,5,27837},{1577,110,1024},{1605,5,29228},{1607,62,1052},
+{1623,5,30105},{1625,26,1068},{1632,5,31040},{1634,262,1075},
+{1700,5,20141},{1702,386,1141},{1799,5,23630},{1801,66,1238},
+{1818,5,24458},{1820,378,1255},{1915,5,27965},{1917,98,1350},
+{1942,5,29408},{1944,54,1375},{1958,5,30116},{1960,5,30114},
+{1962,0,30328},{1963,9,30342},{1966,58,1389},{1981,5,30732},
+{1983,14,1404},{1987,5,31161},{1989,5,31185},{1991,90,1408},
+{2014,5,32963},{2016,158,1431},{2056,5,35330},{2058,98,1471},
+{2083,9,38475},{2086,50,1496},{2099,5,20492},{2101,118,1509},
+{2131,5,20900},{2133,142,1539},{2169,5,22275},{2171,22,1575},
+{2177,5,22871},{2179,310,1581},{2257,5,25386},{2259,10,1659},
+{2262,5,25928},{2264,46,1662},{2276,5,26388},{2278,114,1674},
+{2307,5,27687},{2309,206,1703},{2361,5,30130},{2363,30,1755},
+{2371,5,30413},{2373,0,30505},{2374,5,30495},{2376,318,1763},
+{2456,5,33322},{2458,126,1843},{2490,5,34945},{2492,62,1875},
+{2508,5,36001},{2510,114,1891},{2539,5,38498},{2541,182,1920},
+{2587,5,21311},{2589,250,1966},{2652,5,23644},{2654,70,2029},
+{2672,5,24247},{2674,146,2047},{2711,5,25114},{2713,174,2084},
+{2757,5,26059},{2759,134,2128},{2793,5,27627},{2795,158,2162},
+{2835,5,28937},{2837,70,2202},{2855,5,29942},{2857,6,2220},
+{2859,5,30053},{2861,10,2222},{2864,5,30164},{2866,326,2225},
+{2948,5,33659},{2950,322,2307},{3031,5,38518},{3033,22,2388},
+{3039,5,38914},{3041,70,2394},{3059,5,21108},{3061,150,2412},
+{3099,5,22576},{3101,10,2450},{3104,5,22777},{3106,50,2453},
+{3119,5,23562},{3121,46,2466},{3133,5,24257},{3135,10,2478},
+{3138,5,24489},{3140,138,2481},{3175,5,25581},{3177,34,2516},
+{3186,5,25954},{3188,46,2525},{3200,5,26366},{3202,126,2537},
+{3234,5,27694},{3236,142,2569},{3272,5,28953},{3274,70,2605},
+{3292,5,29749},{3294,18,2623},{3299,5,29989},{3301,34,2628},
+{3310,5,30331},{3312,174,2637},{3356,5,32724},{3358,206,2681},
+{3410,5,35009},{3412,234,2733},{3471,5,37396},{3473,70,2792},
+{3491,5,38533},{3493,22,2810},{3499,5,38598},{3501,10,2816},
+{3504,5,38917},{3506,58,2819},{3521,5,20658},{3523,50,2834},
+{3536,5,21218},{3538,34,2847},{3547,5,21987},{3549,10,2856},
+{3552,5,21957},{3554,6,2859},{3556,5,22290},{3558,206,2861},
+{3610,5,25121},{3612,46,2913},{3624,5,25622},{3626,22,2925},
+{3632,5,26247},{3634,322,2931},{3715,5,29787},{3717,42,3012},
+{3728,5,30430},{3730,58,3023},{3745,5,30871},{3747,66,3038},
+{3764,5,31391},{3766,58,3055},{3781,5,32617},{3783,58,3070},
+{3798,5,33145},{3800,118,3085},{3830,5,34562},{3832,62,3115},
+{3848,5,35442},{3850,82,3131},{3871,5,36039},{3873,242,3152},
+{3934,5,38548},{3936,6,3213},{3938,5,38601},{3940,26,3215},
+{3947,5,38928},{3949,22,3222},{3955,5,39165},{3957,138,3228},
+{3992,5,22029},{3994,130,3263},{4027,5,23525},{4029,90,3296},
+{4052,5,24930},{4054,438,3319},{4164,5,31118},{4166,74,3429},
+{4185,5,31933},{4187,10,3448},{4190,5,32189},{4192,58,3451},
+{4207,5,32736},{4209,282,3466},{4280,5,36049},{4282,150,3537},
+{4320,5,38312},{4322,46,3575},{4334,5,38935},{4336,26,3587},
+{4343,5,39599},{4345,0,39654},{4346,5,39745},{4348,46,3594},
+{4360,5,20744},{4362,6,3606},{4364,9,21127},{4367,62,3608},
+{4383,5,22063},{4385,74,3624},{4404,5,23652},{4406,226,3643},
+{4463,5,25975},{4465,86,3700},{4487,5,27589},{4489,158,3722},
+{4529,5,30241},{4531,110,3762},{4559,5,31686},{4561,98,3790},
+{4586,9,33179},{4589,26,3815},{4596,5,34092},{4598,94,3822},
+{4622,5,35090},{4624,102,3846},{4650,5,36076},{4652,5,36066},
+{4654,210,3872},{4707,5,38662},{4709,86,3925},{4731,5,39662},
+{4733,246,3947},{4795,5,25787},{4797,230,4009},{4855,5,29123},
+{4857,26,4067},{4864,5,29964},{4866,22,4074},{4872,5,30622},
+{4874,22,4080},{4880,5,31309},{4882,46,4086},{4894,5,31957},
+{4896,42,4098},{4907,5,32752},{4909,26,4109},{4916,5,33368},
+{4918,10,4116},{4921,5,34152},{4923,106,4119},{4950,5,35585},
+{4952,182,4146},{4998,5,38567},{5000,30,4192},{5008,5,38747},
+{5010,314,4200},{5089,5,25986},{5091,74,4279},{5110,5,28639},
+{5112,322,4298},{5193,5,32881},{5195,294,4379},{5269,5,36993},
+{5271,74,4453},{5290,9,38346},{5293,90,4472},{5316,5,40668},
+{5318,62,4495},{5334,5,25850},{5336,38,4511},{5346,5,27310},
+{5348,38,4521},{5358,5,29179},{5360,46,4531},{5372,5,30651},
+{5374,6,4543},{5376,5,31329},{5378,0,31328},{5379,5,31428},
+{5381,26,4545},{5388,5,32340},{5390,182,4552},{5436,5,37291},
+{5438,126,4598},{5470,5,39230},{5472,94,4630},{5496,5,22750},
+{5498,162,4654},{5539,5,31806},{5541,26,4695},{5548,5,32361},
+{5550,38,4702},{5560,5,34276},{5562,58,4712},{5577,5,35662},
+{5579,54,4727},{5593,5,37002},{5595,26,4741},{5602,5,37852},
+{5604,290,4748},{5677,5,31983},{5679,62,4821},{5695,5,34836},
+{5697,154,4837},{5736,5,20791},{5738,218,4876},{5793,5,38712},
+{5795,86,4931},{5817,5,40806},{5819,118,4953},{5849,5,36118},
+{5851,18,4983},{5856,5,37969},{5858,5,38717},{5860,186,4988},
+{5907,5,39514},{5909,0,39511},{5910,5,39635},{5912,42,5035},
+{5923,5,30321},{5925,86,5046},{5947,5,40441},{5949,5,40572},
+{5951,118,5068},{5981,5,38013},{5983,0,38012},{5984,5,40055},
+{5986,222,5098},{6042,5,22306},{6044,270,5154},{6112,5,23674},
+{6114,150,5222},{6152,5,27723},{6154,6,5260},{6156,5,29364},
+{6158,50,5262},{6171,5,37015},{6173,106,5275},{6200,5,21165},
+{6202,10,5302},{6205,5,21390},{6207,322,5305},{6288,5,25230},
+{6290,110,5386},{6318,5,27673},{6320,122,5414},{6351,5,29587},
+{6353,10,5445},{6356,5,30100},{6358,58,5448},{6373,5,33411},
+{6375,178,5463},{6420,5,21042},{6422,10,5508},{6425,5,21258},
+{6427,142,5511},{6463,5,22387},{6465,198,5547},{6515,9,24354},
+{6518,318,5597},{6598,5,26488},{6600,282,5677},{6671,5,30015},
+{6673,210,5748},{6726,5,34413},{6728,230,5801},{6786,5,21701},
+{6788,34,5859},{6797,5,22430},{6799,198,5868},{6849,5,23763},
+{6851,26,5918},{6858,9,24097},{6861,122,5925},{6892,5,25154},
+{6894,50,5956},{6907,5,25363},{6909,86,5969},{6931,5,26383},
+{6933,138,5991},{6968,5,26569},{6970,38,6026},{6980,5,27680},
+{6982,146,6036},{7019,5,28852},{7021,6,6073},{7023,5,29257},
+{7025,126,6075},{7057,5,30023},{7059,18,6107},{7064,9,30467},
+{7067,14,6112},{7071,5,30695},{7073,0,30726},{7074,5,30737},
+{7076,78,6116},{7096,5,31488},{7098,0,31866},{7099,5,31864},
+{7101,9,31871},{7104,30,6136},{7112,5,32782},{7114,374,6144},
+{7208,5,20470},{7210,46,6238},{7222,5,20932},{7224,18,6250},
+{7229,5,21086},{7231,86,6255},{7253,5,21751},{7255,14,6277},
+{7259,5,22273},{7261,74,6281},{7280,5,23085},{7282,206,6300},
+{7334,5,25412},{7336,98,6352},{7361,5,26051},{7363,18,6377},
+{7368,5,26386},{7370,10,6382},{7373,5,26674},{7375,154,6385},
+{7414,5,28003},{7416,186,6424},{7463,9,28869},{7466,114,6471},
+{7495,5,29655},{7497,0,29672},{7498,5,29918},{7500,5,29940},
+{7502,82,6500},{7523,5,30489},{7525,86,6521},{7547,5,31211},
+{7549,38,6543},{7559,5,31371},{7561,450,6553},{7674,5,34883},
+{7676,0,34925},{7677,5,34933},{7679,126,6666},{7711,5,37081},
+{7713,34,6698},{7722,5,37198},{7724,118,6707},{7754,5,20579},
+{7756,58,6737},{7771,5,21877},{7773,462,6752},{7889,5,24242},
+{7891,42,6868},{7902,5,24787},{7904,226,6879},{7961,5,26733},
+{7963,134,6936},{7997,5,27447},{7999,6,6970},{8001,5,27533},
+{8003,78,6972},{8023,5,28124},{8025,158,6992},{8065,5,29307},
+{8067,126,7032},{8099,5,30155},{8101,30,7064},{8109,5,30513},
+{8111,66,7072},{8128,5,31081},{8130,22,7089},{8136,5,31222},
+{8138,142,7095},{8174,5,32062},{8176,18,7131},{8181,5,32668},
+{8183,0,32667},{8184,5,32714},{8186,0,32717},{8187,5,32720},
+{8189,306,7136},{8266,5,34491},{8268,0,34499},{8269,5,34493},
+{8271,118,7213},{8301,5,35932},{8303,58,7243},{8318,5,36576},
+{8320,38,7258},{8330,5,37106},{8332,0,37076},{8333,5,37099},
+{8335,50,7268},{8348,5,37354},{8350,854,7281},{8564,5,26013},
+{8566,194,7495},{8615,5,26845},{8617,74,7544},{8636,5,27634},
+{8638,6,7563},{8640,5,28230},{8642,10,7565},{8645,5,28220},
+{8647,146,7568},{8684,5,28213},{8686,258,7605},{8751,5,30534},
+{8753,18,7670},{8758,5,30539},{8760,10,7675},{8763,5,30820},
+{8765,206,7678},{8817,5,32574},{8819,5,32613},{8821,0,32674},
+{8822,5,32672},{8824,6,7730},{8826,5,32847},{8828,46,7732},
+{8840,9,33271},{8843,0,33284},{8844,5,33340},{8846,354,7744},
+{8935,5,35290},{8937,18,7833},{8942,5,35415},{8944,5,35396},
+{8946,146,7838},{8983,5,36583},{8985,218,7875},{9040,5,38536},
+{9042,58,7930},{9057,5,20099},{9059,82,7945},{9080,5,21115},
+{9082,246,7966},{9144,5,23512},{9146,106,8028},{9173,5,24905},
+{9175,118,8055},{9205,5,25634},{9207,178,8085},{9252,5,26952},
+{9254,138,8130},{9289,5,27643},{9291,0,27641},{9292,5,27639},
+{9294,22,8165},{9300,5,28307},{9302,274,8171},{9371,5,29770},
+{9373,14,8240},{9377,5,29775},{9379,122,8244},{9410,5,30559},
+{9412,58,8275},{9427,5,30853},{9429,46,8290},{9441,5,31256},
+{9443,182,8302},{9489,5,32615},{9491,14,8348},{9495,5,32731},
+{9497,382,8352},{9593,5,35021},{9595,138,8448},{9630,5,35972},
+{9632,0,36044},{9633,5,36200},{9635,6,8483},{9637,5,36238},
+{9639,0,36237},{9640,5,36243},{9642,78,8485},{9662,5,36615},
+{9664,58,8505},{9679,5,37230},{9681,138,8520},{9716,5,38546},
+{9718,30,8555},{9726,5,38775},{9728,6,8563},{9730,5,38925},
+{9732,122,8565},{9763,5,21120},{9765,306,8596},{9842,5,24152},
+{9844,78,8673},{9864,5,24914},{9866,82,8693},{9887,5,25714},
+{9889,270,8714},{9957,9,27550},{9960,5,27587},{9962,46,8782},
+{9974,5,28441},{9976,234,8794},{10035,5,29954},{10037,130,8853},
+{10070,5,31114},{10072,58,8886},{10087,5,31403},{10089,130,8901},
+{10122,5,32203},{10124,42,8934},{10135,5,32738},{10137,314,8945},
+{10216,5,34598},{10218,26,9024},{10225,5,35057},{10227,90,9031},
+{10250,5,35944},{10252,66,9054},{10269,5,36624},{10271,270,9071},
+{10339,5,39085},{10341,58,9139},{10356,5,39742},{10358,5,39776},
+{10360,0,39775},{10361,5,40177},{10363,22,9154},{10369,5,20742},
+{10371,6,9160},{10373,5,20747},{10375,6,9162},{10377,5,21131},
+{10379,422,9164},{10485,5,26034},{10487,458,9270},{10602,9,29534},
+{10605,26,9385},{10612,5,29833},{10614,74,9392},{10633,9,30364},
+{10636,50,9411},{10649,5,30915},{10651,414,9424},{10755,5,34023},
+{10757,42,9528},{10768,5,34659},{10770,134,9539},{10804,9,35095},
+{10807,62,9573},{10823,5,35540},{10825,134,9589},{10859,5,36390},
+{10861,50,9623},{10874,5,36630},{10876,26,9636},{10883,5,37161},
+{10885,10,9643},{10888,5,37253},{10890,0,37258},{10891,5,37249},
+{10893,10,9646},{10896,5,37571},{10898,242,9649},{10959,5,39190},
+{10961,14,9710},{10965,5,39379},{10967,154,9714},{11006,5,40719},
+{11008,214,9753},{11062,5,24167},{11064,158,9807},{11104,5,26314},
+{11106,138,9847},{11141,5,27213},{11143,18,9882},{11148,5,27562},
+{11150,154,9887},{11189,5,29120},{11191,34,9926},{11200,5,29146},
+{11202,5,29341},{11204,0,29545},{11205,5,29542},{11207,114,9935},
+{11236,5,30626},{11238,38,9964},{11248,5,30945},{11250,0,30957},
+{11251,5,30943},{11253,110,9974},{11281,5,31952},{11283,14,10002},
+{11287,5,32287},{11289,54,10006},{11303,5,32635},{11305,74,10020},
+{11324,9,33365},{11327,190,10039},{11375,5,34704},{11377,34,10087},
+{11386,5,35117},{11388,46,10096},{11400,5,35572},{11402,46,10108},
+{11414,5,35985},{11416,62,10120},{11432,5,36412},{11434,66,10136},
+{11451,5,37173},{11453,0,37267},{11454,5,37264},{11456,174,10153},
+{11500,5,38329},{11502,266,10197},{11569,5,40582},{11571,6,10264},
+{11573,5,40661},{11575,42,10266},{11586,5,22156},{11588,82,10277},
+{11609,5,23537},{11611,286,10298},{11683,5,29550},{11685,34,10370},
+{11694,9,29968},{11697,10,10379},{11700,5,30280},{11702,58,10382},
+{11717,5,30971},{11719,58,10397},{11734,5,31424},{11736,66,10412},
+{11753,5,31728},{11755,438,10429},{11865,5,35314},{11867,222,10539},
+{11923,5,37712},{11925,190,10595},{11973,5,39211},{11975,70,10643},
+{11993,5,39421},{11995,94,10661},{12019,5,40238},{12021,14,10685},
+{12025,5,40258},{12027,78,10689},{12047,5,20781},{12049,30,10709},
+{12057,5,23657},{12059,0,24000},{12060,5,24173},{12062,6,10717},
+{12064,5,25069},{12066,58,10719},{12081,5,26330},{12083,26,10734},
+{12090,5,27318},{12092,26,10741},{12099,5,28684},{12101,14,10748},
+{12105,5,28671},{12107,134,10752},{12141,5,30995},{12143,126,10786},
+{12175,5,32759},{12177,0,32885},{12178,5,33233},{12180,210,10818},
+{12233,5,35152},{12235,174,10871},{12279,9,36678},{12282,6,10915},
+{12284,5,37178},{12286,122,10917},{12317,5,38354},{12319,94,10948},
+{12343,9,38992},{12346,66,10972},{12363,5,39684},{12365,178,10989},
+{12410,5,20788},{12412,18,11034},{12417,5,22182},{12419,22,11039},
+{12425,9,23357},{12428,138,11045},{12463,9,28705},{12466,34,11080},
+{12475,5,29349},{12477,34,11089},{12486,5,30665},{12488,34,11098},
+{12497,5,31335},{12499,86,11107},{12521,5,32765},{12523,122,11129},
+{12554,5,34806},{12556,38,11160},{12566,5,35162},{12568,106,11170},
+{12595,5,36102},{12597,54,11197},{12611,5,36687},{12613,118,11211},
+{12643,5,38362},{12645,6,11241},{12647,5,38699},{12649,18,11243},
+{12654,9,38877},{12657,42,11248},{12668,5,39334},{12670,74,11259},
+{12689,5,39914},{12691,94,11278},{12715,5,40331},{12717,6,11302},
+{12719,5,40308},{12721,62,11304},{12737,5,40768},{12739,0,40781},
+{12740,9,40790},{12743,22,11320},{12749,5,24006},{12751,5,24302},
+{12753,5,24512},{12755,26,11326},{12762,5,26339},{12764,22,11333},
+{12770,5,27374},{12772,62,11339},{12788,5,29203},{12790,58,11355},
+{12805,5,31015},{12807,14,11370},{12811,5,31340},{12813,62,11374},
+{12829,5,33384},{12831,50,11390},{12844,5,34832},{12846,78,11403},
+{12866,5,36694},{12868,30,11423},{12876,5,37298},{12878,130,11431},
+{12911,5,38702},{12913,6,11464},{12915,5,38909},{12917,0,39008},
+{12918,5,39010},{12920,0,39007},{12921,5,39105},{12923,226,11466},
+{12980,5,40358},{12982,78,11523},{13002,5,22205},{13004,46,11543},
+{13016,5,28739},{13018,0,28746},{13019,5,28744},{13021,5,28741},
+{13023,54,11555},{13037,5,32391},{13039,146,11569},{13076,5,35706},
+{13078,34,11606},{13087,5,37188},{13089,142,11615},{13125,5,39703},
+{13127,30,11651},{13135,5,39976},{13137,58,11659},{13152,5,40377},
+{13154,102,11674},{13180,5,23371},{13182,30,11700},{13190,5,27400},
+{13192,0,27661},{13193,9,28757},{13196,0,28754},{13197,5,29214},
+{13199,38,11708},{13209,5,31344},{13211,46,11718},{13223,5,34356},
+{13225,98,11730},{13250,5,36502},{13252,18,11755},{13257,5,37962},
+{13259,10,11760},{13262,5,37960},{13264,34,11763},{13273,5,39507},
+{13275,242,11772},{13336,5,25091},{13338,14,11833},{13342,5,27409},
+{13344,174,11837},{13388,5,38852},{13390,10,11881},{13393,9,39710},
+{13396,122,11884},{13427,5,40690},{13429,34,11915},{13438,5,40814},
+{13440,18,11924},{13445,5,26349},{13447,82,11929},{13468,5,35732},
+{13470,9,36510},{13473,18,11950},{13478,5,37992},{13480,82,11955},
+{13501,5,40448},{13503,26,11976},{13510,9,40820},{13513,10,11983},
+{13516,5,27416},{13518,18,11986},{13523,5,30680},{13525,30,11991},
+{13533,5,33248},{13535,9,34374},{13538,5,35193},{13540,10,11999},
+{13543,5,35736},{13545,246,12002},{13607,5,39027},{13609,14,12064},
+{13613,5,39526},{13615,38,12068},{13625,5,38016},{13627,46,12078},
+{13639,5,28777},{13641,26,12090},{13648,377,32},{13743,22,12097},
+{13749,5,12541},{13751,5,12445},{13753,0,65533},{13754,9,12293},
+{13757,14,12103},{13761,329,12353},{13844,341,12449},{13930,21,1040},
+{13936,0,1025},{13937,125,1046},{13969,0,1105},{13970,101,1078},
+{13996,0,8679},{13997,5,8632},{13999,0,20033},{14001,0,20058},
+{14003,18,12107},{14009,358,12112},{14099,9,65040},{14102,82,12202},
+{14124,0,22462},{14126,0,28990},{14128,0,27042},{14130,6,12223},
+{14134,6,12225},{14137,6,12227},{14139,5,31426},{14141,0,29137},
+{14143,22,12229},{14150,10,12235},{14155,10,12238},{14160,14,12241},
+{14165,18,12245},{14171,6,12250},{14174,0,31910},{14176,30,12252},
+{14185,0,32093},{14187,18,12260},{14194,10,12265},{14198,0,32229},
+{14200,0,65533},{14203,18,12268},{14208,5,32576},{14210,6,12273},
+{14213,6,12275},{14216,0,32675},{14219,0,17756},{14222,0,32762},
+{14224,18,12277},{14231,5,32827},{14233,0,32865},{14235,0,18825},
+{14239,6,12282},{14242,10,12284},{14246,0,27775},{14248,0,25831},
+{14250,0,33304},{14252,0,27219},{14255,6,12287},{14259,0,20473},
+{14261,6,12289},{14268,6,12291},{14271,14,12293},{14277,0,14017},
+{14280,10,12297},{14288,18,12300},{14294,10,12305},{14298,10,12308},
+{14302,0,33880},{14304,26,12311},{14314,22,12318},{14321,0,16960},
+{14323,34,12324},{14334,0,34241},{14336,0,34306},{14340,10,12333},
+{14344,0,21495},{14346,6,12336},{14349,0,34798},{14351,26,12338},
+{14358,5,34885},{14363,10,12345},{14366,5,34996},{14368,0,35013},
+{14370,22,12348},{14377,0,35303},{14380,14,12354},{14385,0,31465},
+{14387,0,18195},{14389,10,12358},{14394,14,12361},{14399,10,12365},
+{14403,10,12368},{14409,0,14117},{14411,0,36054},{14414,6,12371},
+{14417,14,12373},{14422,0,36265},{14426,0,15228},{14429,26,12377},
+{14438,6,12384},{14442,6,12386},{14447,0,24312},{14449,6,12388},
+{14452,0,14720},{14454,0,36919},{14457,0,36961},{14460,0,37032},
+{14462,0,37060},{14464,22,12390},{14472,14,12396},{14482,6,12400},
+{14486,0,23235},{14489,6,12402},{14494,34,12404},{14506,22,12413},
+{14513,10,12419},{14517,10,12422},{14528,22,12425},{14535,14,12431},
+{14540,6,12435},{14543,10,12437},{14548,26,12440},{14556,6,12447},
+{14559,6,12449},{14563,22,12451},{14570,0,15697},{14574,18,12457},
+{14581,22,12462},{14588,0,19314},{14591,18,12468},{14597,0,14020},
+{14600,6,12473},{14603,14,12475},{14608,10,12479},{14612,6,12482},
+{14615,0,23109},{14617,14,12484},{14622,0,40404},{14629,6,12488},
+{14632,6,12490},{14638,0,40249},{14641,26,12492},{14649,22,12499},
+{14656,14,12505},{14661,0,40727},{14663,18,12509},{14669,30,12514},
+{14679,0,29047},{14683,0,29598},{14686,0,31135},{14689,6,12522},
+{14692,10,12524},{14697,18,12527},{14704,0,29054},{14706,0,28835},
+{14709,0,16071},{14713,0,14114},{14716,0,14049},{14720,0,14115},
+{14722,0,22363},{14728,0,34051},{14730,6,12532},{14738,0,17652},
+{14742,18,12534},{14748,6,12539},{14755,6,12541},{14758,0,22162},
+{14762,0,65533},{14764,14,12543},{14769,0,20156},{14771,10,12547},
+{14775,0,23144},{14778,0,14745},{14781,6,12550},{14786,0,35546},
+{14788,18,12552},{14795,34,12557},{14807,0,28018},{14810,6,12566},
+{14813,0,17629},{14817,0,36218},{14820,6,12568},{14823,14,12570},
+{14831,0,27089},{14833,26,12574},{14842,10,12581},{14846,0,21940},
+{14848,0,21709},{14850,34,12584},{14863,18,12593},{14872,14,12598},
+{14877,0,23169},{14880,6,12602},{14883,10,12604},{14887,22,12607},
+{14896,6,12613},{14900,0,14081},{14902,0,14045},{14904,6,12615},
+{14910,6,12617},{14914,0,23147},{14916,0,23364},{14918,6,12619},
+{14922,6,12621},{14928,0,25024},{14932,10,12623},{14939,0,25713},
+{14942,0,14889},{14947,14,12626},{14953,0,25252},{14955,14,12630},
+{14963,0,21773},{14967,0,26318},{14970,0,15072},{14977,0,30958},
+{14981,0,13412},{14985,0,26254},{14987,10,12634},{14992,0,26211},
+{14995,0,26142},{14997,0,14545},{15000,0,15257},{15003,6,12637},
+{15006,14,12639},{15012,14,12643},{15017,22,12647},{15025,6,12653},
+{15029,0,37513},{15032,14,12655},{15037,6,12659},{15040,22,12661},
+{15048,14,12667},{15054,0,20857},{15057,0,29818},{15063,6,12671},
+{15068,26,12673},{15076,10,12680},{15081,10,12683},{15085,6,12686},
+{15090,6,12688},{15093,0,16127},{15096,10,12690},{15101,0,20703},
+{15104,0,30584},{15106,5,30478},{15108,0,30587},{15111,0,14942},
+{15113,10,12693},{15118,0,16584},{15121,0,37639},{15123,22,12696},
+{15131,18,12702},{15137,10,12707},{15141,10,12710},{15149,14,12713},
+{15155,6,12717},{15160,0,23053},{15162,6,12719},{15165,18,12721},
+{15173,0,31949},{15176,30,12726},{15187,0,32151},{15189,0,17002},
+{15192,0,26582},{15195,0,22468},{15198,6,12734},{15203,0,31500},
+{15205,14,12736},{15212,0,39455},{15214,0,33941},{15217,22,12740},
+{15224,0,39107},{15226,6,12746},{15229,0,33875},{15231,0,34320},
+{15233,6,12748},{15236,0,23339},{15238,0,23268},{15240,0,34464},
+{15243,0,34861},{15245,30,12750},{15254,0,35156},{15261,26,12758},
+{15269,6,12765},{15272,10,12767},{15276,10,12770},{15280,22,12773},
+{15287,18,12779},{15293,10,12784},{15297,6,12787},{15300,22,12789},
+{15307,0,16482},{15309,0,37927},{15312,22,12795},{15319,6,12801},
+{15324,0,16103},{15326,0,38543},{15330,0,16076},{15334,14,12803},
+{15339,6,12807},{15343,6,12809},{15349,18,12811},{15355,10,12816},
+{15359,0,24001},{15362,0,38943},{15364,0,37622},{15366,6,12819},
+{15371,0,39132},{15373,22,12821},{15380,18,12827},{15387,14,12832},
+{15392,0,19344},{15394,18,12836},{15400,0,22562},{15403,0,30788},
+{15406,18,12841},{15413,30,12846},{15422,0,39839},{15425,6,12854},
+{15428,10,12856},{15435,6,12859},{15440,6,12861},{15445,6,12863},
+{15450,0,31202},{15454,14,12865},{15459,22,12869},{15466,14,12875},
+{15473,26,12879},{15481,26,12886},{15489,0,29163},{15492,0,65533},
+{15495,14,12893},{15500,6,12897},{15503,6,12899},{15507,0,33906},
+{15513,0,22932},{15516,0,32168},{15522,14,12901},{15528,0,16097},
+{15530,14,12905},{15541,0,29768},{15543,0,28837},{15545,10,12909},
+{15549,0,37681},{15552,0,37766},{15555,0,18741},{15557,0,29035},
+{15560,0,22180},{15564,6,12912},{15567,0,32254},{15571,10,12914},
+{15576,0,22960},{15580,6,12917},{15583,10,12919},{15588,6,12922},
+{15591,18,12924},{15597,6,12929},{15600,0,28175},{15602,6,12931},
+{15605,10,12933},{15610,10,12936},{15614,38,12939},{15626,10,12949},
+{15630,0,28926},{15636,6,12952},{15646,0,27162},{15649,10,12954},
+{15656,10,12957},{15660,0,33773},{15664,6,12960},{15667,6,12962},
+{15671,6,12964},{15674,14,12966},{15679,6,12970},{15682,0,27179},
+{15687,0,28957},{15690,0,20400},{15692,0,23746},{15696,0,27148},
+{15699,6,12972},{15702,6,12974},{15705,6,12976},{15708,0,31955},
+{15712,42,12978},{15723,5,36795},{15725,182,12989},{15772,0,65533},
+{15774,6,13035},{15777,6,13037},{15783,6,13039},{15789,0,20946},
+{15791,0,22943},{15793,0,15294},{15795,0,14747},{15798,0,14178},
+{15800,0,35678},{15802,6,13041},{15806,10,13043},{15811,0,21948},
+{15813,0,13427},{15815,0,18200},{15817,6,13046},{15820,6,13048},
+{15824,0,65533},{15826,0,36950},{15828,6,13050},{15831,0,65533},
+{15833,0,35562},{15836,0,19392},{15838,0,37989},{15840,6,13052},
+{15845,0,20074},{15847,6,13054},{15850,0,35191},{15852,6,13056},
+{15856,14,13058},{15862,6,13062},{15865,22,13064},{15872,6,13070},
+{15875,0,37680},{15877,0,27705},{15879,6,13072},{15884,0,28344},
+{15887,18,13074},{15894,6,13079},{15897,0,14753},{15901,6,13081},
+{15904,6,13083},{15909,10,13085},{15913,0,27139},{15915,0,21410},
+{15917,10,13088},{15924,0,23941},{15926,6,13091},{15929,0,23979},
+{15931,10,13093},{15936,6,13096},{15939,38,13098},{15950,26,13108},
+{15958,6,13115},{15962,0,15851},{15965,30,13117},{15974,18,13125},
+{15980,78,13130},{16001,14,13150},{16006,22,13154},{16014,0,24272},
+{16018,10,13160},{16022,38,13163},{16033,0,40050},{16035,6,13173},
+{16038,22,13175},{16045,50,13181},{16059,6,13194},{16062,14,13196},
+{16068,0,65533},{16070,0,60715},{16072,26,13200},{16080,18,13207},
+{16086,14,13212},{16091,0,33884},{16093,30,13216},{16102,6,13224},
+{16105,0,30842},{16107,22,13226},{16114,18,13232},{16120,6,13237},
+{16123,34,13239},{16134,0,34477},{16137,6,13248},{16140,6,13250},
+{16143,198,13252},{16194,30,13302},{16203,30,13310},{16212,14,13318},
+{16217,42,13322},{16229,98,13333},{16255,30,13358},{16264,46,13366},
+{16277,30,13378},{16286,18,13386},{16292,6,13391},{16295,146,13393},
+{16333,18,13430},{16339,18,13435},{16345,42,13440},{16357,18,13451},
+{16363,70,13456},{16382,38,13474},{16393,6,13484},{16396,0,37595},
+{16399,18,13486},{16406,0,37700},{16408,0,33518},{16410,10,13491},
+{16418,0,20395},{16420,0,20488},{16426,0,65533},{16428,0,24484},
+{16431,0,28379},{16433,26,13494},{16442,0,20832},{16444,0,20842},
+{16452,6,13501},{16456,30,13503},{16465,22,13511},{16472,50,13517},
+{16488,6,13530},{16493,6,13532},{16496,0,27851},{16498,18,13534},
+{16504,14,13539},{16509,0,21374},{16513,6,13543},{16516,14,13545},
+{16521,34,13549},{16531,0,21472},{16534,0,21494},{16536,22,13558},
+{16544,14,13564},{16550,0,15796},{16554,26,13568},{16563,0,17746},
+{16565,0,26291},{16567,6,13575},{16570,42,13577},{16582,0,13859},
+{16584,0,22342},{16586,14,13588},{16591,0,22502},{16593,0,22531},
+{16596,0,22566},{16598,18,13592},{16604,10,13597},{16609,22,13600},
+{16616,6,13606},{16619,6,13608},{16625,0,23001},{16629,0,28017},
+{16632,0,23033},{16634,10,13610},{16638,18,13613},{16646,0,14130},
+{16648,18,13618},{16654,6,13623},{16657,0,23509},{16661,14,13625},
+{16666,10,13629},{16671,22,13632},{16679,10,13638},{16683,14,13641},
+{16690,26,13645},{16699,14,13652},{16704,6,13656},{16707,26,13658},
+{16716,0,15070},{16718,0,24378},{16722,0,24419},{16724,6,13665},
+{16727,10,13667},{16734,0,37334},{16737,22,13670},{16744,18,13676},
+{16752,18,13681},{16759,6,13686},{16762,6,13688},{16766,0,25043},
+{16769,6,13690},{16773,14,13692},{16778,0,25285},{16780,0,25301},
+{16782,0,25452},{16784,10,13696},{16789,0,28554},{16791,0,65533},
+{16793,30,13699},{16803,18,13707},{16809,10,13712},{16813,10,13715},
+{16817,0,26136},{16820,0,26180},{16823,0,26187},{16825,0,26215},
+{16827,6,13718},{16833,0,30661},{16835,6,13720},{16839,0,27130},
+{16842,6,13722},{16846,22,13724},{16854,0,26717},{16856,6,13730},
+{16859,6,13732},{16862,10,13734},{16866,10,13737},{16870,14,13740},
+{16875,10,13744},{16880,0,27205},{16882,14,13747},{16887,6,13751},
+{16890,10,13753},{16894,0,28341},{16896,0,65533},{16898,6,13756},
+{16901,0,27617},{16903,6,13758},{16908,10,13760},{16912,0,17605},
+{16918,6,13763},{16921,0,39811},{16924,6,13765},{16929,14,13767},
+{16936,0,34099},{16938,14,13771},{16945,0,29779},{16947,10,13775},
+{16951,10,13778},{16955,0,28410},{16958,22,13781},{16965,6,13787},
+{16968,0,28627},{16975,0,20959},{16976,5,57937},{16980,18,13789},
+{16985,5,28885},{16987,18,13794},{16993,18,13799},{16999,6,13804},
+{17002,0,28972},{17006,0,29114},{17008,30,13806},{17017,6,13814},
+{17020,14,13816},{17025,18,13820},{17032,0,18669},{17034,14,13825},
+{17040,6,13829},{17045,6,13831},{17050,10,13833},{17054,6,13836},
+{17058,0,29792},{17060,38,13838},{17074,0,23366},{17077,0,29896},
+{17079,6,13848},{17083,0,23511},{17085,18,13850},{17091,0,16132},
+{17093,38,13855},{17104,10,13865},{17109,14,13868},{17114,0,33890},
+{17118,14,13872},{17123,0,30552},{17125,0,30639},{17129,30,13876},
+{17138,10,13884},{17142,6,13887},{17145,14,13889},{17150,0,31133},
+{17152,10,13893},{17156,6,13896},{17159,14,13898},{17166,0,21904},
+{17168,0,14828},{17170,0,36422},{17173,0,65533},{17175,0,30586},
+{17177,6,13902},{17182,0,25821},{17186,10,13904},{17190,0,65533},
+{17195,0,65533},{17199,0,18420},{17202,6,13907},{17205,6,13909},
+{17209,0,65533},{17211,30,13911},{17220,10,13919},{17226,0,25834},
+{17229,6,13922},{17233,6,13924},{17236,6,13926},{17239,0,65533},
+{17244,22,13928},{17252,6,13934},{17255,6,13936},{17258,18,13938},
+{17266,6,13943},{17270,6,13945},{17273,0,13688},{17276,6,13947},
+{17280,6,13949},{17283,6,13951},{17295,0,14872},{17301,6,13953},
+{17304,46,13955},{17317,42,13967},{17329,0,65533},{17331,0,65533},
+{17333,86,13978},{17356,14,14000},{17361,90,14004},{17385,90,14027},
+{17408,377,32},{17503,10,14050},{17506,377,32},{17601,18,14053},
+{17606,5,12443},{17608,0,11904},{17609,17,12736},{17615,0,12741},
+{17618,5,12742},{17622,0,12744},{17624,13,12745},{17629,5,12749},
+{17631,5,62776},{17635,0,38737},{17637,62,14058},{17654,14,14074},
+{17659,0,13505},{17661,6,14078},{17665,10,14080},{17669,22,14083},
+{17676,18,14089},{17682,22,14094},{17689,14,14100},{17693,9,11910},
+{17696,0,11914},{17697,5,11916},{17699,42,14104},{17710,5,11980},
+{17712,0,11983},{17713,5,11990},{17715,0,11998},{17718,18,14115},
+{17724,74,14120},{17743,5,23454},{17745,94,14139},{17769,5,36710},
+{17771,38,14163},{17782,22,14173},{17790,0,40458},{17792,34,14179},
+{17805,158,14188},{17846,0,16467},{17856,0,16571},{17858,0,22098},
+{17864,0,13819},{17869,0,16275},{17879,0,16377},{17881,0,25650},
+{17890,10,14228},{17894,6,14231},{17897,6,14233},{17900,6,14235},
+{17903,0,37302},{17909,0,13833},{17911,0,22191},{17923,0,23124},
+{17928,0,22428},{17935,0,14083},{17944,10,14237},{17948,30,14240},
+{17958,342,14248},{18045,14,14334},{18049,5,28392},{18051,10,14338},
+{18055,50,14341},{18069,6,14354},{18072,6,14356},{18075,18,14358},
+{18083,0,13438},{18087,14,14363},{18092,0,35660},{18094,0,18730},
+{18098,6,14367},{18103,0,26760},{18105,6,14369},{18108,10,14371},
+{18112,14,14374},{18117,6,14378},{18120,26,14380},{18128,0,28838},
+{18130,10,14387},{18135,10,14390},{18140,0,22398},{18143,0,16357},
+{18146,0,28675},{18148,6,14393},{18152,26,14395},{18160,14,14402},
+{18164,5,29726},{18166,138,14406},{18202,102,14441},{18229,94,14467},
+{18253,5,33113},{18255,110,14491},{18283,5,34159},{18285,46,14519},
+{18298,138,14531},{18333,5,37619},{18335,178,14566},{18381,58,14611},
+{18399,0,38083},{18401,0,38081},{18406,6,14626},{18413,0,21662},
+{18438,0,13895},{18442,0,21348},{18450,0,28859},{18461,0,29080},
+{18463,6,14628},{18496,0,22709},{18507,0,22408},{18514,0,22885},
+{18517,0,22335},{18532,6,14630},{18543,0,22201},{18545,0,13848},
+{18565,0,38047},{18567,0,14009},{18570,0,22230},{18591,0,25574},
+{18603,0,15863},{18606,0,36816},{18619,0,32415},{18622,6,14632},
+{18625,0,29090},{18628,0,19868},{18630,6,14634},{18633,0,36793},
+{18635,0,20202},{18637,0,36480},{18645,0,20122},{18654,0,15814},
+{18656,0,19996},{18661,6,14636},{18665,0,23440},{18685,26,14638},
+{18693,0,22442},{18708,0,22439},{18715,0,39963},{18717,0,15878},
+{18722,10,14645},{18734,0,13877},{18736,6,14648},{18752,6,14650},
+{18755,6,14652},{18758,34,14654},{18768,10,14663},{18774,6,14666},
+{18777,6,14668},{18780,0,14128},{18785,234,14670},{18844,5,9178},
+{18846,18,14729},{18852,10,14734},{18856,10,14737},{18860,0,13657},
+{18862,0,24866},{18864,18,14740},{18871,0,15499},{18873,14,14745},
+{18878,6,14749},{18881,10,14751},{18886,10,14754},{18890,6,14757},
+{18893,46,14759},{18906,10,14771},{18910,0,25995},{18912,6,14774},
+{18915,6,14776},{18918,6,14778},{18921,10,14780},{18926,62,14783},
+{18944,30,14799},{18953,0,33471},{18955,0,19585},{18957,0,23931},
+{18960,5,40877},{18962,30,14807},{18971,6,14815},{18974,0,19682},
+{18976,18,14817},{18986,0,19543},{18988,10,14822},{18992,10,14825},
+{18996,0,29221},{19001,14,14828},{19006,6,14832},{19009,0,23515},
+{19011,6,14834},{19014,18,14836},{19020,6,14841},{19023,18,14843},
+{19030,10,14848},{19034,10,14851},{19038,14,14854},{19044,10,14858},
+{19049,6,14861},{19052,10,14863},{19056,0,24379},{19060,6,14866},
+{19063,6,14868},{19066,10,14870},{19070,0,16764},{19073,6,14873},
+{19076,26,14875},{19084,14,14882},
+};
+
+static const unsigned short cmap_Adobe_CNS1_UCS2_table[14886] = {
+169,8482,8230,12288,65292,65294,8231,65307,65306,65311,65281,65072,
+8943,8229,65372,8211,65073,8212,65533,65533,65533,65533,65371,65373,
+8245,8242,65283,65286,65290,8251,167,12291,9675,9679,9651,9650,
+9678,9734,9733,9671,9670,9633,9632,9661,9660,12963,8453,8254,
+65507,65343,717,65291,65293,215,247,177,8730,65308,65310,65309,
+8800,8734,8786,8801,8869,8736,8735,8895,13266,13265,8747,8750,
+8757,8756,9792,9794,8853,9737,8593,8595,8594,8592,8601,8600,
+8741,8739,65295,65340,65295,65340,65284,165,12306,65285,65312,8451,
+8457,13262,13217,13252,176,20825,20827,20830,20829,20833,20835,21991,
+29929,31950,9615,9614,9613,9612,9611,9610,9609,9532,9524,9516,
+9508,9500,9620,9472,9474,9621,9484,9488,9492,9496,9584,9583,
+9552,9566,9578,9569,9701,9700,12344,21316,12346,729,714,711,
+715,20008,20022,20031,20101,20128,20866,20886,20907,21241,21304,21353,
+21430,22786,23424,24027,24186,24191,24308,24400,24417,25908,26080,30098,
+30326,36789,38582,9249,19968,20057,19969,19971,20035,20061,20102,20108,
+20154,20799,20837,20843,20960,21147,21269,21313,21340,21448,19977,19979,
+19976,19978,20011,20024,20961,20037,20040,20063,20062,20110,20129,20800,
+20995,21242,21315,21449,21475,22303,22763,22805,22823,22899,23379,23544,
+23567,23586,23608,23665,24029,24037,24062,24178,24318,24331,24339,25165,
+19985,19984,19981,20013,20016,20025,20043,23609,20104,20113,20117,20114,
+20116,20130,20161,20160,20163,20164,20803,20801,20839,20844,20887,20982,
+21270,21305,21320,21319,21317,21342,21380,21451,21450,21453,22764,22825,
+22827,22826,22829,23380,23569,23588,23610,23663,24052,24187,24319,24515,
+25096,25142,25163,25166,25903,25991,26007,26020,26041,26085,26352,26376,
+26408,27424,27490,27513,27595,27604,27611,27663,27700,28779,29226,29238,
+29243,29255,29273,29275,29356,29579,19993,19990,19989,19988,19992,20027,
+20045,20047,20046,20197,20184,20185,20190,20805,20804,20984,21002,21152,
+21151,21271,21277,20191,21322,21321,21345,21344,21359,21358,21435,21487,
+21476,21491,21484,21486,21481,21480,21500,21496,21493,21483,21478,21482,
+21490,21489,21488,21477,21485,21499,22235,22234,22806,22830,22833,22900,
+22902,23381,23427,23612,24040,24039,24038,24179,24188,24321,24344,24343,
+24517,25098,25170,25169,26021,26086,26414,26412,26413,27491,27597,27665,
+27664,27704,27713,27712,27710,29359,29572,29577,29916,29926,29976,29983,
+30091,30333,30382,30399,30446,30683,30690,30707,31034,31166,31348,31435,
+20073,20121,20132,20134,20133,20223,20233,20249,20234,20245,20237,20239,
+20210,20214,20219,20208,20211,20221,20225,20235,20809,20807,20806,20808,
+20840,20849,20877,20912,21015,21006,21014,21155,21256,21281,21280,21513,
+21519,21516,21514,21520,21505,21515,21508,21521,21517,21512,21507,21518,
+21510,21522,22240,22238,22237,22323,22320,22312,22317,22316,22319,22313,
+22916,22904,22915,22909,22905,22914,22913,23429,23433,23546,23574,23673,
+24030,24070,24182,24180,24335,24347,24537,24534,25102,25104,25187,25179,
+25176,25910,26089,26088,26377,26429,26420,26417,26421,27425,27492,27515,
+27670,27741,27735,27737,27728,27733,27745,27739,28784,29279,29277,30334,
+31481,31859,31992,32566,32650,32701,32769,32771,32780,32786,32819,32895,
+32905,33251,33258,33267,33276,33292,33307,33311,33390,33394,33406,34411,
+34880,34892,34915,35199,38433,20018,20136,20301,20303,20295,20311,20318,
+20276,20315,20309,20272,20285,20282,20280,20291,20308,20284,20294,20323,
+20316,20320,20271,20302,20278,20313,20317,20296,20314,20812,20811,20813,
+20853,21029,21028,21032,21163,21164,21283,21363,21365,21533,21549,21534,
+21566,21542,21582,21543,21574,21571,21555,21576,21570,21531,21545,21578,
+21561,21563,21560,21550,21536,21564,21568,21553,21547,21535,21548,22250,
+22256,22244,22251,22346,22353,22336,22349,22343,22350,22334,22352,22351,
+22331,22767,22846,22941,22930,22952,22942,22947,22937,22934,22925,22948,
+22931,22922,22949,23389,23388,23436,23435,23439,23596,23615,23614,23700,
+23692,24043,24076,24207,24199,24202,24311,24324,24351,24420,24418,24439,
+24441,24536,24524,24535,24525,24561,24555,24568,24554,25106,25105,25220,
+25239,25238,25216,25206,25225,25197,25226,25212,25214,25209,25203,25234,
+25199,25240,25198,25237,25235,25233,25222,25913,25915,25912,26097,26356,
+26463,26460,26454,26462,26441,26438,26464,26451,26455,27493,27599,27714,
+27742,27801,27777,27781,27803,27754,27770,27792,27760,27788,27752,27798,
+27794,27773,27779,27762,27774,27764,27782,27766,27789,27796,27800,27778,
+28790,28792,29282,29281,29280,29380,29378,29590,29996,29995,30338,30447,
+30691,31169,31168,31167,31350,31995,32597,32918,32915,32925,32920,32923,
+32922,32946,33391,33426,33419,33421,35211,35282,35328,35895,35910,35925,
+35997,36196,36208,36275,36523,36554,36763,36784,36802,36806,36805,36804,
+24033,37009,37026,37034,37030,37027,37193,37318,37324,38450,38446,38449,
+38442,38444,20006,20054,20083,20107,20123,20126,20335,20381,20365,20339,
+20351,20332,20379,20363,20358,20355,20336,20341,20360,20329,20347,20374,
+20350,20367,20369,20346,20820,20818,20821,20841,20855,20854,20856,20925,
+20989,21051,21048,21047,21050,21040,21038,21046,21057,21182,21179,21330,
+21332,21331,21329,21350,21462,21460,21463,21619,21621,21654,21624,21653,
+21632,21627,21623,21636,21650,21638,21628,21648,21617,21622,21644,21658,
+21602,21608,21643,21629,21646,22266,22403,22391,22378,22377,22369,22374,
+22372,22396,22812,22857,22852,22868,22974,22971,22996,22969,22958,22993,
+22982,22992,22989,22987,22995,22986,22959,22963,22994,22981,23391,23396,
+23395,23447,23450,23448,23452,23449,23451,23578,23624,23735,23713,23736,
+23721,23723,23729,23731,24088,24090,24086,24085,24091,24081,24184,24218,
+24215,24220,24447,24444,24541,24544,24573,24565,24575,24591,24596,24623,
+24629,24598,24618,24597,24609,24615,24617,24619,24603,25110,25109,25151,
+25150,25152,25215,25289,25292,25284,25279,25282,25273,25298,25307,25259,
+25291,25288,25256,25277,25276,25296,25305,25287,25293,25269,25306,25265,
+25304,25286,25260,25294,25918,26023,26044,26106,26132,26131,26124,26118,
+26114,26126,26112,26127,26133,26122,26119,26381,26379,26477,26507,26517,
+26481,26524,26483,26487,26503,26525,26519,26495,26505,26494,26512,26485,
+26522,26515,26492,26474,26482,27427,27519,27667,27675,27875,27880,27891,
+27825,27852,27877,27827,27836,27874,27819,27861,27859,27832,27844,27833,
+27841,27822,27863,27845,27889,27839,27835,27873,27867,27850,27820,27887,
+27868,27862,27872,28821,28814,28818,28810,28825,29240,29256,29287,29289,
+29376,29390,29401,29399,29392,29609,29608,29599,29611,29605,30013,30109,
+30340,30402,30450,30452,30693,30717,31038,31177,31176,31354,31353,31482,
+31998,32596,32652,32651,32773,32954,32933,32930,32945,32929,32939,32937,
+32948,32938,32943,33253,33278,33293,33459,33437,33433,33453,33469,33439,
+33465,33457,33452,33445,33455,33464,33443,33456,33470,33463,34382,34417,
+21021,34920,36555,36814,36820,36817,37045,37048,37041,37046,37319,37329,
+38263,38272,38428,38464,38463,38459,38468,38466,38585,38632,38738,38750,
+20127,20449,20405,20399,20415,20448,20433,20431,20445,20419,20406,20440,
+20447,20426,20439,20398,20432,20420,20418,20442,20430,20446,20407,20823,
+20882,20881,20896,21070,21059,21066,21069,21068,21067,21063,21191,21193,
+21187,21185,21261,21335,21371,21402,21467,21676,21696,21672,21710,21705,
+21688,21670,21683,21703,21698,21693,21674,21697,21700,21704,21679,21675,
+21681,21691,21673,21671,21695,22271,22402,22411,22432,22435,22434,22478,
+22446,22419,22869,22865,22863,22862,22864,23004,23000,23039,23011,23016,
+23043,23013,23018,23002,23014,23041,23035,23401,23459,23462,23460,23458,
+23461,23553,23629,23627,23769,23762,24055,24093,24101,24095,24189,24224,
+24230,24314,24328,24365,24421,24456,24453,24455,24460,24457,24594,24605,
+24608,24613,24590,24616,24653,24688,24680,24674,24646,24643,24684,24683,
+24682,24676,25153,25308,25366,25353,25340,25325,25345,25326,25341,25351,
+25329,25335,25327,25324,25342,25332,25361,25346,25919,25925,26027,26045,
+26082,26149,26157,26144,26151,26159,26143,26152,26161,26148,26359,26623,
+26579,26609,26580,26576,26604,26550,26543,26613,26601,26607,26564,26577,
+26548,26586,26597,26552,26575,26590,26611,26544,26585,26594,26589,26578,
+27498,27523,27526,27573,27602,27607,27679,27849,27915,27954,27946,27969,
+27941,27916,27953,27934,27927,27963,27958,27931,27893,27961,27943,27960,
+27945,27950,27957,27918,27947,28843,28858,28851,28844,28847,28845,28856,
+28846,28836,29232,29298,29295,29300,29417,29623,29642,29627,29618,29645,
+29632,29619,29978,29997,30031,30028,30030,30027,30123,30408,30406,30403,
+30405,30465,30457,30456,30473,30475,30462,30460,30471,30684,30722,30740,
+31046,31049,31048,31047,31179,31359,31361,31487,31485,31869,32002,32005,
+32000,32009,32007,32004,32006,32568,32654,32703,32784,32781,32785,32822,
+32982,32997,32986,32972,32993,32987,32974,32990,32996,32989,33268,33314,
+33511,33539,33541,33507,33499,33510,33540,33509,33538,33545,33490,33495,
+33521,33537,33500,33492,33489,33502,33491,33503,33519,33542,34384,34425,
+34427,34426,34893,34923,35201,35284,35336,35998,36000,36212,36211,36276,
+36557,36556,36848,36838,36834,36842,36837,36845,36843,36836,36840,37066,
+37070,37057,37059,37195,37194,37325,38274,38480,38754,38761,38859,38893,
+38899,38913,39080,39131,39135,39318,39321,20056,20147,20515,20463,20518,
+20517,20472,20521,20502,20486,20540,20511,20506,20498,20497,20474,20480,
+20500,20520,20465,20513,20491,20505,20504,20467,20462,20525,20522,20478,
+20523,20489,20860,20898,20941,20940,20934,20939,21078,21084,21076,21083,
+21085,21290,21375,21407,21405,21471,21736,21776,21761,21815,21756,21733,
+21746,21766,21754,21780,21737,21741,21729,21769,21742,21738,21734,21799,
+21767,21757,21775,22466,22484,22475,22467,22537,22799,22874,23057,23064,
+23068,23071,23067,23059,23020,23072,23075,23081,23077,23052,23049,23403,
+23640,23472,23475,23478,23476,23470,23477,23481,23480,23556,23633,23637,
+23632,23789,23805,23803,23786,23784,23792,23798,23809,23796,24046,24109,
+24107,24235,24237,24231,24369,24466,24465,24464,24665,24675,24677,24656,
+24661,24685,24681,24687,24708,24735,24730,24717,24724,24716,24709,24726,
+25159,25331,25352,25343,25422,25406,25391,25429,25410,25414,25423,25417,
+25402,25424,25405,25384,25421,25420,26009,26049,26053,26178,26185,26191,
+26179,26194,26188,26181,26177,26360,26391,26657,26680,26696,26694,26707,
+26681,26690,26708,26665,26803,26647,26700,26705,26685,26612,26704,26688,
+26684,26691,26666,26693,26643,26648,26689,27530,27529,27575,27683,27686,
+27684,27888,28010,28053,28040,28039,28006,28024,28023,27993,28051,28012,
+28041,28014,27994,28020,28009,28044,28042,28025,28037,28005,28052,28874,
+28888,28900,28889,28872,28879,29241,29305,29436,29433,29437,29432,29431,
+29574,29677,29705,29678,29664,29674,29662,30036,30045,30044,30042,30041,
+30142,30149,30151,30141,30140,30137,30146,30136,30347,30384,30410,30504,
+30697,30768,30759,30776,30749,30772,30775,30757,30765,30752,30751,30770,
+31061,31056,31072,31071,31062,31070,31069,31063,31066,31204,31203,31207,
+31199,31206,31209,31192,31364,31368,31449,31494,31505,31881,32033,32023,
+32011,32010,32032,32034,32020,32016,32021,32026,32028,32013,32025,32027,
+32570,32607,32660,32709,32705,32774,32772,32792,32789,32793,32791,32829,
+32831,33009,33026,33008,33029,33005,33012,33030,33016,33011,33032,33021,
+33034,33020,33007,33261,33260,33280,33296,33320,33324,33467,33579,33618,
+33620,33610,33592,33616,33609,33589,33588,33615,33586,33593,33590,33559,
+33600,33585,33576,33603,34388,34442,34474,34451,34468,34473,34444,34467,
+34460,34928,34935,34941,34937,35352,35344,35342,35340,35349,35338,35351,
+35347,35350,35343,35345,35912,35962,35961,36215,36524,36562,36564,36559,
+36785,36865,36870,36855,36864,36858,36852,36867,36861,36869,36856,37013,
+37089,37085,37090,37202,37197,37196,37336,37341,37335,37340,37337,38275,
+38497,38491,38493,38500,38488,38494,38587,39138,39340,39592,39640,39717,
+39730,39740,20094,20602,20605,20572,20551,20547,20556,20570,20553,20581,
+20598,20558,20565,20597,20596,20599,20559,20495,20591,20589,20828,20885,
+20976,21098,21103,21202,21209,21208,21205,21264,21263,21273,21310,21443,
+26364,21830,21866,21862,21828,21854,21857,21827,21834,21809,21846,21839,
+21845,21807,21860,21816,21806,21852,21804,21859,21811,21825,21847,22280,
+22283,22281,22495,22533,22538,22534,22496,22500,22522,22530,22581,22519,
+22521,22816,22882,23094,23105,23113,23142,23146,23104,23100,23138,23130,
+23110,23114,23408,23495,23493,23492,23490,23487,23494,23561,23560,23559,
+23648,23815,23814,23822,23835,23830,23842,23825,23849,23828,23833,23844,
+23847,23831,24034,24120,24118,24115,24119,24246,24245,24254,24373,24375,
+24407,24428,24425,24427,24471,24473,24478,24472,24481,24480,24476,24703,
+24739,24713,24736,24744,24779,24756,24806,24765,24773,24763,24757,24796,
+24764,24792,24789,24774,24799,24760,24794,24775,25160,25504,25511,25458,
+25494,25506,25509,25463,25447,25496,25514,25457,25513,25481,25475,25499,
+25451,25512,25476,25480,25497,25505,25516,25490,25487,25472,25467,25449,
+25448,25466,25949,25942,25937,25945,25943,21855,25935,25944,25941,25940,
+26012,26011,26028,26063,26062,26205,26202,26212,26216,26214,26206,26361,
+21207,26395,26753,26799,26786,26771,26805,26751,26742,26801,26791,26775,
+26800,26755,26820,26797,26758,26757,26772,26781,26792,26783,26785,26754,
+27442,27578,27691,28046,28092,28147,28121,28082,28129,28108,28132,28155,
+28154,28165,28103,28107,28079,28113,28078,28126,28153,28088,28151,28149,
+28101,28114,28186,28085,28122,28139,28120,28138,28145,28142,28136,28102,
+28100,28074,28140,28095,28134,28921,28925,28911,29245,29309,29313,29468,
+29467,29462,29459,29465,29575,29701,29706,29699,29702,29694,29709,29920,
+29980,29986,30050,30064,30095,30133,30154,30157,30350,30420,30418,30427,
+30519,30526,30524,30518,30520,30522,30827,30787,30798,31077,31080,31085,
+31227,31378,31381,31520,31528,31515,31532,31526,31513,31518,31534,31890,
+31895,31893,32070,32067,32113,32046,32057,32060,32064,32048,32051,32068,
+32047,32066,32050,32049,32573,32670,32666,32716,32718,32722,32796,32842,
+32838,33071,33046,33059,33067,33065,33072,33060,33282,33333,33335,33334,
+33337,33678,33694,33688,33656,33698,33686,33725,33707,33682,33674,33683,
+33673,33696,33655,33670,33703,34389,24426,34503,34496,34486,34500,34485,
+34502,34507,34481,34479,34505,34899,34974,34952,34987,34962,34966,34957,
+34955,35219,35215,35370,35357,35363,35365,35377,35373,35359,35355,35362,
+35913,35930,36009,36012,36011,36008,36010,36007,36199,36198,36286,36282,
+36571,36575,36889,36877,36890,36887,36899,36895,36893,36880,36885,36894,
+36896,36879,36898,36886,36891,36884,37096,37101,37117,37207,37326,37365,
+37350,37347,37351,37357,37353,38281,38506,38517,38515,38520,38512,38516,
+38508,38592,38634,38633,31456,31455,39770,40165,40565,40575,40613,40635,
+20642,20621,20613,20633,20625,20608,20630,20632,20634,26368,20977,21106,
+21097,21214,21213,21211,21338,21413,21883,21888,21927,21884,21898,21917,
+21912,21890,21916,21930,21908,21895,21899,21891,21939,21934,21919,21822,
+21938,21914,21947,21932,21937,21886,21897,21931,21913,22285,22575,22570,
+22580,22564,22561,22557,22560,22880,23159,23194,23167,23186,23195,23207,
+23411,23409,23506,23500,23507,23504,23601,23884,23888,23860,23879,24061,
+24133,24125,24128,24131,24190,24266,24260,24380,24429,24488,24785,24801,
+24754,24758,24800,24860,24867,24826,24853,24816,24827,24820,24936,24817,
+24846,24822,24841,24832,24850,25119,25161,25507,25484,25551,25536,25577,
+25545,25542,25549,25554,25571,25552,25569,25558,25462,25588,25578,25563,
+25682,25562,25593,25950,25958,26001,26000,26031,26222,26224,26228,26230,
+26223,26257,26234,26238,26231,26399,26397,26874,26837,26848,26840,26839,
+26885,26847,26869,26862,26855,26873,26834,26866,26851,26827,26829,26893,
+26898,26894,26825,26842,26990,26875,27454,27450,27453,27544,27542,27580,
+27631,27692,28207,28216,28244,28193,28210,28263,28234,28192,28197,28195,
+28187,28251,28248,28196,28246,28270,28205,28198,28271,28212,28237,28218,
+28204,28227,28189,28222,28363,28297,28185,28238,28259,28228,28274,28265,
+28255,28966,28976,28961,28982,29038,28956,29260,29316,29312,29494,29477,
+29492,29481,29754,29738,29747,29730,29733,29748,29743,29723,29734,29736,
+30059,30058,30178,30171,30179,30169,30168,30174,30176,30358,30355,30388,
+30428,30543,30701,30813,30828,30831,31245,31240,31243,31237,31232,31384,
+31383,31382,31461,31459,31561,31574,31558,31568,31570,31572,31565,31563,
+31567,31569,31903,31909,32094,32080,32104,32085,32043,32110,32114,32097,
+32102,32098,32112,32115,21892,32779,32850,32901,33109,33108,33099,33105,
+33102,33081,33094,33086,33100,33107,33140,33298,33308,33769,33795,33784,
+33805,33760,33733,33803,33729,33775,33777,33780,33879,33802,33776,33804,
+33740,33789,33778,33738,33848,33806,33796,33756,33799,33748,33759,34395,
+34527,34521,34541,34516,34523,34532,34512,34526,34903,34993,35203,35222,
+35387,35424,35413,35422,35388,35393,35412,35419,35408,35398,35380,35386,
+35382,35414,35937,35970,36015,36028,36019,36029,36033,36027,36032,36020,
+36023,36022,36031,36024,36234,36229,36225,36302,36317,36299,36314,36305,
+36300,36315,36294,36603,36600,36604,36764,36910,36917,36913,36920,36914,
+36918,37122,37109,37129,37118,37219,37221,37327,37411,37385,37406,37389,
+37392,37383,37393,38292,38287,38283,38289,38291,38290,38286,38538,38542,
+38539,38525,38541,38514,38532,38593,38597,38596,38639,38642,38860,38920,
+39143,39146,39151,39145,39154,39149,39342,39341,40643,40653,40657,20098,
+20653,20661,20677,20670,20652,20663,20667,20655,20679,21119,21111,21117,
+21215,21222,21220,21295,21983,21992,21971,21990,21966,21980,21959,21969,
+21999,21978,21985,21989,21961,22622,22609,22616,22615,22618,22612,22635,
+22604,22637,22602,22626,22610,22603,22887,23233,23241,23244,23230,23229,
+23228,23219,23234,23218,23913,23919,24140,24185,24265,24264,24338,24409,
+24492,24494,24858,24847,24904,24863,24819,24859,24825,24833,24840,24910,
+24908,24900,24909,24894,24884,24871,24845,24838,24887,25619,25662,25630,
+25642,25645,25661,25644,25615,25628,25620,25613,25654,25606,25964,26015,
+26032,26263,26249,26262,26244,26264,26253,26371,27028,26989,26970,26999,
+26976,26964,26997,26928,27010,26954,26984,26987,26974,26963,27001,27014,
+26973,26979,26971,27463,27506,27584,27583,27603,27645,28322,28335,28371,
+28342,28354,28304,28317,28359,28357,28325,28312,28348,28346,28331,28369,
+28310,28316,28356,28372,28330,28327,28340,29006,29017,29033,29028,29001,
+29031,29020,29036,29030,29004,29029,29022,28998,29032,29014,29242,29266,
+29495,29509,29503,29502,29807,29786,29781,29791,29790,29761,29759,29785,
+30070,30072,30208,30192,30209,30194,30193,30202,30207,30196,30195,30555,
+30571,30566,30558,30563,30585,30570,30572,30556,30565,30568,30562,30702,
+30862,30896,30860,30857,30844,30865,30867,30847,31098,31103,31105,33836,
+31165,31260,31258,31264,31252,31263,31262,31607,31680,31584,31598,31591,
+31921,31923,31925,32147,32121,32145,32129,32143,32091,32622,32626,32681,
+32680,32676,32854,32856,32902,32900,33137,33136,33144,33125,33134,33139,
+33131,33126,33285,33351,33922,33911,33853,33841,33909,33894,33899,33865,
+33900,33883,33852,33845,33889,33891,33897,33901,33862,34398,34396,34399,
+34553,34579,34568,34567,34560,34558,34555,34566,34570,34905,35039,35028,
+35033,35036,35032,35037,35041,35018,35029,35026,35228,35299,35435,35430,
+35433,35440,35463,35452,35427,35488,35441,35461,35437,35426,35438,35436,
+35449,35451,35390,35432,35938,35978,35977,36042,36036,36018,36035,36034,
+36037,36321,36319,36328,36335,36339,36346,36330,36324,36326,36530,36611,
+36617,36606,36618,36767,36786,36939,36938,36947,36930,36948,36924,36949,
+36944,36935,36943,36942,36941,36945,36926,36929,37138,37143,37228,37226,
+37225,37321,37431,37463,37432,37437,37440,37438,37467,37451,37476,37457,
+37428,37449,37453,37445,37433,37439,37466,38296,38552,38605,38603,38647,
+38651,38649,38646,38742,38772,38774,38931,38922,38930,38924,39164,39156,
+39347,39345,39348,39649,40169,40578,40718,40723,40736,20711,20718,20709,
+20694,20717,20698,20693,20687,20689,20721,20686,20713,20834,20979,21123,
+21122,21297,21421,22014,22016,22043,22039,22013,22036,22022,22025,22007,
+22038,22047,22024,22032,22006,22296,22294,22645,22654,22659,22675,22666,
+22649,22661,22653,22781,22821,22818,22820,22890,22889,23265,23270,23273,
+23255,23254,23256,23267,23413,23518,23527,23521,23528,23522,23524,23519,
+23565,23650,23940,23943,24155,24163,24149,24151,24148,24275,24278,24330,
+24390,24432,24505,24903,24895,24907,24951,24927,24922,24920,24949,25130,
+25735,25688,25684,25764,25720,25695,25722,25681,25703,25652,25709,25723,
+25970,26017,26071,26070,26274,26280,26269,27036,27048,27029,27073,27054,
+27091,27083,27035,27063,27067,27051,27060,27088,27085,27053,27084,27046,
+27075,27043,27465,27468,27699,28467,28436,28414,28435,28404,28457,28478,
+28448,28460,28431,28418,28450,28415,28399,28422,28465,28472,28466,28451,
+28437,28459,28463,28552,28458,28396,28417,28402,28364,28407,29076,29081,
+29053,29066,29060,29074,29246,29330,29334,29508,29520,29796,29795,29802,
+29808,29805,29956,30097,30247,30221,30219,30217,30227,30433,30435,30596,
+30589,30591,30561,30913,30879,30887,30899,30889,30883,31117,31278,31281,
+31402,31401,31469,31471,31649,31637,31627,31605,31639,31645,31636,31631,
+31672,31623,31620,31929,32187,32176,32156,32160,32202,32180,32178,32177,
+32186,32162,32191,32181,32184,32173,32210,32199,32172,32624,32735,32862,
+32858,32903,33104,33152,33167,33160,33162,33151,33154,33255,33274,33287,
+33300,33310,33355,33993,33983,33990,33988,33945,33950,33970,33948,33995,
+33976,33984,34003,33936,33980,34001,33994,34623,34588,34619,34594,34597,
+34612,34584,34645,34615,34601,35059,35074,35060,35065,35064,35069,35048,
+35098,35055,35494,35468,35486,35491,35469,35489,35475,35492,35498,35493,
+35496,35480,35473,35482,35495,35946,35981,35980,36051,36203,36249,36245,
+36348,36628,36626,36629,36627,36771,36960,36952,36956,36963,36953,36958,
+36962,36957,36955,37145,37144,37150,37237,37240,37239,37236,37496,37548,
+37504,37509,37528,37526,37499,37523,37532,37544,37500,37521,38305,38307,
+38309,38308,38553,38556,38555,38604,38610,38656,38780,38789,38902,39087,
+39089,39171,39173,39180,39177,39361,40180,40182,40179,40636,40763,40778,
+20740,20736,20731,20725,20729,20738,20741,20956,21133,21130,21232,21426,
+22062,22075,22073,22066,22079,22068,22057,22099,22094,22103,22132,22070,
+22656,22687,22686,22707,22684,22702,22697,22694,22893,23305,23291,23307,
+23285,23308,23304,23534,23532,23529,23531,23965,23956,24162,24159,24161,
+24290,24282,24287,24285,24291,24288,24392,24433,24503,24501,24950,24935,
+24942,24925,24917,24962,24956,24944,24939,24958,24999,24976,25003,24974,
+25004,24986,24996,24980,25006,25134,25705,25711,25721,25758,25778,25736,
+25744,25776,25765,25747,25749,25769,25746,25774,25773,25771,25754,25772,
+25753,25762,25779,25973,26286,26283,26292,26289,27171,27167,27112,27137,
+27166,27161,27133,27169,27155,27146,27123,27138,27141,27117,27153,27472,
+27470,27556,28479,28540,28548,28497,28518,28500,28550,28525,28507,28536,
+28526,28558,28538,28528,28516,28567,28504,28373,28527,28512,28511,29087,
+29100,29105,29096,29270,29339,29518,29527,29801,29835,29827,29822,29824,
+30079,30240,30249,30239,30244,30246,30362,30394,30436,30606,30599,30604,
+30609,30603,30923,30917,30906,30922,30910,30933,30908,30928,31295,31292,
+31296,31293,31287,31291,31407,31406,31661,31665,31684,31668,31681,31648,
+31692,31946,32224,32244,32239,32251,32216,32236,32221,32232,32227,32218,
+32222,32233,32158,32217,32242,32249,32629,32631,32687,32745,32806,33184,
+33178,33176,34071,34109,34074,34030,34067,34065,34083,34081,34068,34028,
+34085,34047,34054,34690,34676,34678,34656,34662,34680,34664,34649,34647,
+34636,34643,34907,34909,35088,35079,35093,35082,35516,35538,35527,35524,
+35477,35531,35576,35506,35529,35522,35519,35504,35542,35533,35510,35513,
+35547,35916,35918,35948,36064,36062,36070,36068,36060,36074,36065,36205,
+36255,36259,36395,36368,36381,36386,36367,36393,36383,36385,36382,36538,
+36637,36635,36639,36649,36646,36650,36636,36638,36645,36969,36974,36968,
+36973,36983,37168,37165,37159,37169,37255,37257,37259,37251,37573,37563,
+37559,37610,37604,37569,37555,37564,37586,37575,37616,37554,38317,38321,
+38660,38665,38752,38797,38795,38799,38945,38955,38940,39091,39178,39187,
+39186,39192,39389,39376,39391,39387,39377,39381,39378,39385,39607,39719,
+39749,39748,39799,39791,40198,40201,40195,40617,40638,40654,22696,40786,
+20754,20760,20756,20752,20757,20864,20906,20957,21137,21139,21235,22105,
+22123,22137,22121,22116,22136,22122,22120,22117,22129,22127,22124,22114,
+22134,22721,22718,22727,22725,22894,23325,23348,23416,23536,23566,24394,
+25010,24977,25001,24970,25037,25014,25022,25034,25032,25136,25797,25793,
+25803,25818,25796,25799,25794,25805,25791,25810,25812,25790,25972,26310,
+26313,26297,26308,26311,26296,27197,27192,27194,27225,27243,27224,27193,
+27204,27234,27233,27211,27207,27189,27231,27208,27481,27511,27653,28610,
+28593,28577,28611,28580,28609,28583,28595,28608,28601,28598,28582,28576,
+28596,29118,29129,29136,29138,29128,29141,29113,29134,29145,29148,29544,
+29852,29859,29848,29855,29854,29922,30260,30264,30266,30439,30437,30624,
+30629,30952,30938,30956,30951,31142,31302,31308,31307,31418,31705,31761,
+31689,31716,31707,31713,31721,31718,32266,32273,32264,32283,32291,32286,
+32285,32265,32272,32633,32690,32750,32808,33203,33193,33192,33275,33288,
+34122,34137,34120,34115,34121,34157,34154,34142,34691,34719,34718,34722,
+34701,34913,35114,35122,35109,35115,35105,35242,35238,35558,35578,35563,
+35569,35584,35548,35559,35566,35582,35575,35565,35571,35574,35580,35947,
+35949,35987,36084,36420,36401,36404,36418,36409,36405,36667,36655,36664,
+36659,36776,36774,36981,36980,36984,36978,36988,36986,37172,37266,37664,
+37686,37624,37683,37679,37666,37628,37675,37636,37658,37648,37670,37665,
+37653,37678,37657,38331,38570,38613,38670,38673,38678,38669,38675,38671,
+38758,38808,38960,38968,38971,38967,38957,38969,38948,39184,39208,39198,
+39195,39201,39194,39405,39394,39409,39608,39612,39675,39661,39720,39825,
+40213,40227,40230,40232,40210,40219,40664,40660,40845,40860,20778,20767,
+20769,20786,21237,22158,22144,22160,22149,22151,22159,22741,22739,22737,
+22734,23344,23338,23332,23418,23607,23656,23996,23994,23997,23992,24171,
+24396,24509,25033,25026,25031,25062,25035,25138,25140,25806,25802,25816,
+25824,25840,25830,25836,25841,25826,25837,26329,26326,27264,27284,27268,
+27298,27292,27355,27299,27262,27287,27280,27296,27484,27566,27610,27656,
+28632,28657,28635,28644,28651,28655,28544,28652,28641,28649,28629,28654,
+28656,29159,29151,29166,29158,29157,29165,29164,29172,29152,29237,29254,
+29552,29554,29865,29872,29862,29864,30278,30274,30284,30442,30643,30634,
+30640,30636,30631,30637,30703,30967,30970,30964,30959,30977,31143,31146,
+31319,31423,31751,31757,31742,31735,31756,31712,31968,31964,31966,31970,
+31967,31961,31965,32302,32318,32326,32311,32306,32323,32299,32317,32305,
+32325,32321,32308,32313,32328,32309,32319,32303,32580,32755,32764,32880,
+32879,32883,33222,33219,33210,33218,33216,33215,33213,33225,33214,33256,
+33289,33393,34218,34180,34174,34204,34193,34196,34223,34203,34183,34216,
+34186,34214,34407,34752,34769,34739,34770,34758,34731,34747,34746,34760,
+34763,35131,35126,35140,35128,35133,35244,35598,35607,35609,35611,35594,
+35616,35613,35588,35600,35905,35903,35955,36090,36093,36092,36088,36091,
+36264,36425,36427,36424,36426,36676,36670,36674,36677,36671,36991,36989,
+36996,36992,37177,37283,37278,37276,37709,37762,37672,37749,37706,37733,
+37707,37656,37758,37740,37723,37744,37722,37716,38344,38342,38577,38584,
+38614,38684,38686,38816,38867,38982,39094,39221,39425,39423,39854,39851,
+39850,39853,40251,40255,40587,40655,40670,40667,40766,40779,21474,22165,
+22190,22745,22744,23352,24413,25059,25139,25844,25842,25854,25862,25847,
+26039,26332,26406,27315,27308,27331,27323,27320,27330,27487,27512,27567,
+28681,28683,28670,28678,28666,28689,28687,29182,29176,29559,29557,29863,
+29887,29973,30294,30296,30290,30653,30655,30990,31150,31787,31783,31786,
+31774,31779,31777,31975,32350,32346,32353,32338,32345,32584,32761,32763,
+32887,32886,33229,33231,33290,34255,34217,34253,34256,34249,34224,34234,
+34233,34799,34796,34802,34784,35206,35250,35316,35624,35641,35628,35627,
+35920,36101,36441,36451,36454,36452,36447,36437,36544,36681,36685,36999,
+36995,37000,37328,37780,37770,37782,37794,37811,37806,37804,37808,37784,
+37786,37783,38356,38358,38352,38357,38626,38620,38617,38619,38622,38692,
+38819,38822,38829,38905,38989,38991,38988,38990,38995,39098,39229,39214,
+39333,39438,39617,39683,39686,39759,39758,39757,39882,39881,39933,39880,
+39872,40273,40285,40288,40672,40725,40748,20787,22181,22184,22754,23541,
+40848,24300,25074,25079,25078,25077,25856,25871,26336,26333,27365,27357,
+27354,27347,28699,28703,28712,28698,28701,28693,28696,29190,29197,29272,
+29346,29560,29562,29885,29898,29923,30087,30086,30303,30305,30663,31001,
+31153,31339,31337,31800,31805,31799,31808,32363,32365,32377,32371,32645,
+32694,32697,32696,33240,34281,34269,34282,34261,34295,34811,34821,34829,
+34809,34814,35168,35167,35158,35166,35649,35676,35672,35657,35674,35654,
+35673,36104,36106,36476,36466,36487,36470,36460,36474,36468,36692,36686,
+36781,37297,37294,37857,37841,37855,37827,37832,37846,37858,37837,37848,
+37860,37847,37864,38364,38580,38627,38698,38695,38753,38876,38907,39006,
+39000,39003,39100,39237,39241,39446,39449,39693,39912,39911,39894,39899,
+40329,40289,40306,40298,40300,40594,40599,40595,40628,21240,22199,22198,
+22196,22204,22756,23360,23363,23421,23542,24009,25080,25082,25880,25876,
+25881,26342,26407,27372,28734,28720,28722,29200,29563,29903,30306,30309,
+31014,31018,31020,31019,31431,31478,31820,31811,31821,36782,32381,32380,
+32386,32588,32768,33242,33382,34299,34297,34321,34298,34310,34315,34311,
+34314,35172,35258,35320,35696,35692,35686,35695,35679,35691,36111,36109,
+36489,36481,36485,36482,37300,37323,37912,37891,37885,38369,38704,39108,
+39250,39249,39336,39467,39472,39479,39477,39955,39949,40569,40629,40680,
+40751,40799,40803,40801,22209,22208,22210,22804,23660,24013,25084,25086,
+25885,25884,26005,26345,27387,27396,27386,27570,28748,29211,29351,29910,
+29908,30313,30675,31824,32399,32396,32700,34327,34349,34330,34851,34850,
+34849,34847,35178,35180,35261,35700,35703,35709,36115,36490,36493,36491,
+36703,36783,37306,37934,37939,37941,37946,37944,37938,37931,38370,38706,
+38911,39015,39013,39255,39493,39491,39488,39486,39631,39764,39761,39981,
+39973,40367,40372,40386,40376,40605,40687,40729,40796,20796,20795,22216,
+22218,22217,23423,24020,24018,24398,25087,25892,27402,27489,28753,28760,
+29568,29924,30090,30318,30316,31155,31840,31839,32894,32893,33247,35186,
+35183,35324,35712,36497,36499,36705,37192,37956,38851,38849,39019,39253,
+39509,39501,39634,39706,40009,39985,39998,39995,40403,40407,40756,40812,
+40810,40852,22220,24022,25088,25891,25899,25898,26348,27408,29914,31434,
+31844,31843,31845,32403,32406,32404,33250,34360,34367,34865,35722,37008,
+37007,37987,37984,37988,38760,39023,39260,39633,40020,40023,40022,40421,
+40607,40692,22225,22761,25900,28766,30679,32592,32648,34870,34873,34914,
+35731,35730,35734,33399,36123,37312,37994,38722,38728,38724,38854,39024,
+39519,39714,39768,40031,40711,40823,40818,24307,27414,28771,31852,31854,
+34875,35264,36513,37313,38002,38000,39025,39262,39638,39715,40652,28772,
+30682,35738,38007,38857,39522,39525,32412,35740,36522,37317,40695,35924,
+38015,40474,29224,39530,39729,40475,40478,31858,20034,20060,20981,21274,
+21378,19975,19980,20039,20109,22231,23662,24435,19983,20871,19982,20014,
+20115,20162,20169,20168,20888,21244,21356,21433,22304,22787,22828,23568,
+24063,26081,27571,27596,27668,29247,20017,20028,20200,20188,20201,20193,
+20189,20186,21004,21001,21276,21324,22807,22831,23425,23428,23570,23611,
+23668,23667,24068,24192,24194,24521,25097,25168,27669,27702,27715,27711,
+27707,29358,29360,29578,31160,32906,38430,20238,20248,20268,20213,20244,
+20209,20224,20215,20232,20253,20226,20229,20258,20243,20228,20212,20242,
+20913,21011,21008,21158,21282,21279,21325,21386,21511,22241,22239,22318,
+22314,22324,22844,22912,22908,22917,22907,22910,22903,22911,23382,23573,
+23589,23676,23678,24031,24181,24196,24322,24346,24436,24533,24532,24527,
+25180,25182,25188,25185,25190,25186,25177,25184,25178,25189,25911,26095,
+26094,26430,26425,26424,26427,26426,26431,26428,26419,27672,27718,27730,
+27740,27727,27722,27732,28785,29278,29582,29994,30335,31349,32593,33400,
+33404,33408,33405,33407,34381,35198,37017,37019,37012,38434,38436,38432,
+38435,20310,20283,20322,20297,20307,20324,20286,20327,20306,20319,20289,
+20312,20269,20275,20287,20321,20879,20921,21020,21022,21025,21257,21347,
+21362,21552,21559,21546,21588,21573,21529,21532,21541,21528,21565,21583,
+21569,21544,21540,21575,22254,22247,22245,22337,22341,22348,22345,22347,
+22354,22790,22848,22950,22936,22944,22935,22926,22946,22928,22927,22951,
+22945,23438,23442,23592,23594,23693,23695,23688,23691,23689,23698,23690,
+23686,23699,23701,24032,24074,24078,24203,24201,24204,24200,24205,24325,
+24349,24440,24438,24530,24529,24528,24557,24552,24558,24563,24545,24548,
+24547,24570,24559,24567,24571,24576,24564,25146,25219,25228,25236,25223,
+25201,25211,25210,25200,25217,25224,25207,25213,25202,25204,26096,26100,
+26099,26098,26101,26437,26439,26457,26453,26444,26440,26461,26445,26458,
+26443,27600,27768,27751,27755,27780,27787,27791,27761,27759,27753,27802,
+27757,27783,27797,27804,27750,27763,27749,27771,27790,28788,28794,29283,
+29375,29373,29379,29382,29377,29370,29381,29589,29591,29586,30010,30009,
+30337,31037,32820,32917,32921,32912,32914,32924,33424,33423,33413,33422,
+33425,33427,33418,35960,36809,36799,37023,37025,37029,37022,37031,37024,
+38448,38440,38447,38445,20019,20376,20348,20357,20349,20352,20359,20342,
+20340,20361,20356,20343,20300,20375,20330,20378,20345,20353,20344,20368,
+20380,20372,20382,20370,20354,20373,20331,20334,20894,20924,20926,21045,
+21062,21041,21180,21308,21394,21396,21639,21631,21633,21649,21634,21640,
+21611,21626,21630,21605,21612,21620,21606,21645,21615,21601,21600,21656,
+21603,21607,21604,22263,22265,22383,22386,22381,22379,22385,22384,22390,
+22400,22389,22395,22370,22376,22397,22796,22853,22965,22970,22991,22990,
+22962,22988,22977,22966,22972,22979,22998,22961,22973,22976,22984,22964,
+22983,23394,23397,23443,23445,23620,23623,23726,23716,23712,23733,23727,
+23720,23724,23711,23715,23725,23714,23722,23719,23709,23717,23734,23728,
+23718,24087,24084,24089,24360,24404,24450,24446,24445,24542,24549,24621,
+24614,24601,24626,24587,24628,24586,24599,24627,24602,24606,24620,24610,
+24589,24592,24622,24595,24593,24588,24585,24604,25108,25149,25261,25268,
+25297,25278,25258,25270,25290,25262,25267,25263,25275,25257,25264,25272,
+25917,26024,26043,26121,26108,26116,26130,26120,26107,26115,26123,26125,
+26117,26109,26129,26128,26358,26378,26501,26476,26510,26514,26486,26491,
+26520,26502,26500,26484,26509,26508,26490,26527,26513,26521,26499,26493,
+26497,26516,27429,27520,27518,27614,27677,27795,27884,27883,27886,27865,
+27830,27860,27821,27879,27831,27856,27842,27834,27843,27846,27885,27890,
+27858,27869,27828,27786,27805,27776,27870,27840,27952,27853,27847,27824,
+27897,27855,27881,27857,28820,28824,28805,28819,28806,28804,28817,28822,
+28802,28826,28803,29290,29398,29387,29400,29385,29404,29394,29396,29402,
+29388,29393,29604,29601,29613,29606,29602,29600,29612,29597,29917,29928,
+30014,30092,30104,30383,30451,30449,30448,30453,30712,30716,30713,30715,
+30714,30711,31042,31039,31173,31352,31355,31483,31861,31997,32821,32911,
+32942,32931,32952,32949,32941,33312,33440,33472,33451,33434,33432,33435,
+33461,33447,33454,33468,33438,33466,33460,33448,33441,33449,33474,33444,
+33475,33462,33442,34416,34415,35926,36818,36811,36819,36813,36822,36821,
+36823,37042,37044,37039,37043,37040,38457,38461,38460,38458,38467,20429,
+20421,20435,20402,20425,20427,20417,20436,20444,20441,20411,20403,20443,
+20423,20438,20410,20416,20409,20460,21060,21065,21184,21186,21309,21372,
+21399,21398,21401,21400,21690,21665,21677,21669,21711,21699,33549,21687,
+21678,21718,21686,21664,21616,21692,21666,21694,21618,21726,21680,22453,
+22436,22412,22423,22429,22427,22420,22424,22415,22425,22437,22426,22421,
+22772,22797,22867,23009,23006,23022,23040,23025,23005,23034,23037,23036,
+23030,23012,23026,23031,23003,23017,23027,23029,23008,23038,23028,23021,
+23464,23628,23760,23768,23756,23767,23755,23771,23774,23770,23753,23751,
+23754,23766,23759,23752,23750,23758,23775,23800,24057,24096,24100,24240,
+24228,24226,24219,24227,24229,24327,24366,24406,24454,24631,24633,24660,
+24690,24670,24645,24659,24647,24649,24667,24652,24640,24642,24671,24612,
+24644,24664,24678,24686,25295,25357,25355,25333,25358,25347,25323,25337,
+25359,25356,25336,25334,25344,25338,25365,25339,25328,25921,25923,26026,
+26047,26166,26145,26162,26165,26140,26150,26146,26163,26155,26170,26141,
+26164,26169,26158,26561,26610,26568,26554,26588,26555,26616,26584,26560,
+26551,26565,26603,26596,26591,26549,26573,26547,26615,26614,26606,26595,
+26562,26553,26574,26599,26608,26546,26620,26566,26605,26572,26542,26598,
+26587,26618,26563,26602,26571,27432,27522,27524,27574,27606,27608,27616,
+27944,27956,27949,27935,27964,27967,27922,27914,27866,27955,27908,27929,
+27962,27930,27921,27904,27933,27970,27905,27928,27959,27907,27919,27968,
+27911,27936,27948,27912,27938,27913,27920,28855,28831,28862,28849,28848,
+28833,28841,29249,29292,29296,29299,29294,29386,29412,29416,29419,29407,
+29418,29414,29411,29573,29644,29634,29640,29637,29625,29622,29621,29620,
+29675,29631,29639,29630,29635,29638,29624,29643,29932,29934,29998,30119,
+30122,30329,30404,30472,30474,30455,30459,30458,30725,30736,30735,30734,
+30729,30723,30739,31050,31052,31051,31045,31044,31189,31181,31183,31190,
+31182,31360,31358,31441,32003,32008,32001,32600,32657,32653,32702,32775,
+32788,32823,32984,32967,32992,32977,32968,32962,32976,32965,32995,32985,
+32988,32970,32981,32969,32975,32983,32998,32973,33279,33313,33428,33497,
+33534,33529,33543,33512,33536,33493,33594,33515,33494,33524,33516,33505,
+33522,33525,33548,33531,33526,33520,33514,33508,33504,33530,33523,33517,
+34423,34420,34428,34419,34881,34894,34919,34922,34921,35283,35332,35335,
+36210,36835,36833,36846,36832,37105,37053,37055,37077,37061,37054,37063,
+37067,37064,37332,37331,38484,38479,38481,38483,38474,38478,20510,20485,
+20487,20499,20514,20528,20507,20469,20468,20531,20535,20524,20503,20508,
+20512,20519,20533,20527,20529,20494,20826,20884,20883,20938,20936,20942,
+21089,21082,21074,21077,21090,21197,21262,21406,21798,21730,21783,21778,
+21735,21747,21732,21786,21759,21764,21768,21739,21777,21765,21745,21770,
+21755,21728,21774,21763,21771,22476,22578,22485,22482,22458,22470,22461,
+22460,22456,22454,22463,22471,22480,22457,22465,22798,22858,23065,23062,
+23061,23055,23063,23050,23070,23091,23404,23463,23469,23468,23555,23638,
+23636,23788,23807,23790,23793,23799,23808,23801,24105,24104,24232,24238,
+24234,24236,24371,24368,24423,24669,24666,24679,24641,24738,24712,24704,
+24722,24705,24733,24707,24725,24731,24727,24711,24732,24718,25113,25158,
+25330,25360,25430,25388,25398,25411,25572,25401,25419,25418,25404,25385,
+25409,25396,25432,25428,25433,25389,25415,25395,25434,25425,25400,25431,
+25408,25416,25930,25926,26054,26050,26186,26207,26183,26193,26655,26650,
+26697,26683,26699,26703,26646,26673,26652,26677,26667,26669,26671,26702,
+26692,26676,26653,26642,26644,26662,26664,26670,26701,26682,26661,26656,
+27436,27439,27437,27441,27444,27501,32898,27528,27622,27620,27624,27619,
+27618,27623,27685,28026,28022,27917,28001,28050,27992,28002,28013,28015,
+28049,28045,28143,28031,28038,27998,28007,28000,28055,28016,28028,27999,
+28034,28056,27951,28008,28043,28030,28032,28036,27926,28035,28027,28029,
+28021,28048,28892,28883,28881,28893,28875,32569,28898,28887,28882,28894,
+28896,28884,28877,28890,28878,28897,29250,29304,29303,29302,29440,29434,
+29428,29438,29430,29427,29435,29441,29651,29657,29669,29654,29628,29671,
+29667,29673,29660,29650,29659,29652,29661,29658,29985,30043,30047,30128,
+30145,30139,30148,30144,30143,30134,30138,30346,30409,30493,30491,30480,
+30483,30482,30499,30481,30485,30498,30503,30755,30764,30754,30773,30767,
+30760,30766,30763,30753,30761,30771,30762,30769,31060,31067,31055,31068,
+31059,31058,31057,31200,31214,31213,31210,31196,31198,31197,31366,31369,
+31365,31370,31367,31448,31504,31492,31507,31493,31503,31496,31498,31502,
+31497,31506,31876,31889,31882,31884,31880,31885,31877,32030,32029,32017,
+32014,32024,32022,32019,32031,32018,32015,32012,32604,32609,32606,32608,
+32605,32603,32662,32658,32707,32706,32704,32790,32830,32825,33018,33010,
+33017,33013,33025,33019,33024,33281,33327,33317,33587,33581,33604,33561,
+33617,33573,33622,33599,33601,33574,33564,33570,33602,33614,33563,33578,
+33544,33596,33613,33558,33572,33568,33591,33583,33577,33607,33605,33612,
+33619,33566,33580,33611,33575,33608,34387,34386,34466,34472,34454,34445,
+34449,34462,34439,34455,34438,34443,34458,34437,34469,34457,34465,34471,
+34453,34456,34446,34461,34448,34452,34930,34944,34929,34943,34927,34947,
+34942,34932,34940,35346,35911,35927,35963,36004,36003,36214,36216,36277,
+36279,36278,36561,36563,36862,36853,36866,36863,36859,36868,36860,36854,
+37078,37088,37091,37087,37093,37080,37083,37079,37084,37092,37200,37333,
+37346,37338,38492,38495,38588,39139,39647,39727,20095,20592,20586,20577,
+20574,20576,20563,20555,20573,20594,20552,20557,20545,20571,20554,20578,
+20501,20549,20575,20585,20587,20550,20544,20590,20595,20567,20561,20944,
+21099,21101,21100,21102,21206,21203,21293,21404,21820,21837,21840,21812,
+21802,21841,21858,21814,21813,21808,21842,21829,21772,21810,21861,21838,
+21817,21832,21805,21819,21824,21835,22282,22279,22523,22548,22498,22518,
+22492,22516,22528,22509,22525,22536,22520,22539,22515,22479,22535,22510,
+22499,22514,22501,22508,22497,22542,22524,22544,22503,22529,22540,22513,
+22505,22512,22541,22532,22876,23136,23128,23125,23143,23134,23096,23093,
+23149,23120,23135,23141,23148,23123,23140,23127,23107,23133,23122,23108,
+23131,23112,23182,23102,23117,23097,23116,23152,23145,23111,23121,23126,
+23106,23132,23410,23406,23489,23488,23641,23838,23819,23837,23834,23840,
+23820,23848,23821,23846,23845,23823,23856,23826,23843,23839,23854,24126,
+24116,24241,24244,24249,24374,24376,24475,24470,24479,24714,24720,24710,
+24766,24752,24762,24783,24804,24793,24797,24776,24753,24795,24759,24778,
+24767,24771,24781,24768,25394,25445,25482,25474,25469,25533,25502,25517,
+25501,25495,25515,25486,25455,25479,25488,25454,25519,25461,25500,25453,
+25518,25468,25508,25403,25503,25464,25477,25473,25489,25485,25456,25939,
+26061,26213,26209,26203,26201,26204,26210,26392,26745,26759,26768,26780,
+26798,26795,26966,26735,26787,26796,26793,26741,26740,26802,26767,26743,
+26770,26748,26731,26738,26794,26752,26737,26750,26779,26774,26763,26784,
+26761,26788,26744,26747,26769,26764,26762,26749,27446,27443,27537,27535,
+27532,27690,28096,28075,28084,28083,28276,28076,28137,28130,28087,28150,
+28116,28160,28104,28128,28127,28118,28094,28133,28123,28148,28106,28093,
+28141,28144,28090,28117,28098,28111,28105,28112,28146,28115,28157,28119,
+28109,28131,28091,28922,28941,28919,28951,28916,28940,28912,28932,28915,
+28944,28924,28927,28934,28947,28928,28920,28918,28939,28930,28942,29310,
+29311,29469,29463,29447,29457,29464,29450,29448,29439,29455,29470,29576,
+29686,29688,29685,29700,29697,29693,29703,29696,29690,29692,29695,29708,
+29707,29684,29704,30052,30051,30158,30162,30159,30161,30160,30351,30345,
+30419,30521,30511,30509,30516,30515,30525,30501,30523,30517,30792,30802,
+30793,30797,30794,30796,30758,30789,30800,31076,31079,31075,31083,31073,
+31163,31226,31224,31375,31380,31376,31541,31547,31540,31525,31536,31522,
+31524,31539,31512,31530,31517,31537,31531,31533,31535,31538,31544,31514,
+31523,31892,31896,31894,31907,32053,32061,32056,32054,32058,32069,32044,
+32041,32065,32071,32074,32059,32040,32611,32661,32711,32719,32713,32799,
+32798,32795,32839,32835,32840,33048,33061,33049,33051,33069,33055,33068,
+33054,33057,33045,33063,33053,33058,33297,33336,33331,33338,33332,33330,
+33396,33680,33699,33704,33677,33658,33651,33700,33652,33679,33665,33685,
+33689,33653,33684,33705,33661,33667,33676,33693,33691,33706,33675,33662,
+33701,33711,33672,33687,33712,33663,33702,33671,33710,33654,34393,34390,
+34495,34487,34498,34497,34501,34490,34480,34504,34489,34483,34488,34508,
+34484,34898,34953,34965,34984,34978,34986,34970,34961,34977,34975,34968,
+34983,34969,34971,34967,34980,34988,34956,34963,34958,35202,35286,35289,
+35285,35376,35367,35372,35358,35897,35899,35965,36005,36221,36219,36217,
+36284,36290,36281,36287,36289,36568,36574,36573,36572,36567,36900,36875,
+36881,36892,36876,36897,37103,37098,37104,37108,37097,37206,37208,37210,
+37203,37205,37356,37364,37361,37363,37368,37348,37369,37367,37352,37358,
+38266,38278,38280,38524,38509,38507,38513,38511,38591,38762,38916,39141,
+39319,20635,20629,20628,20638,20619,20643,20611,20620,20622,20637,20584,
+20636,20626,20610,20615,20831,20948,21266,21265,21412,21415,21905,21928,
+21925,21933,21879,22085,21922,21907,21896,21903,21941,21889,21923,21906,
+21924,21885,21900,21926,21887,21909,21921,21902,22284,22569,22583,22553,
+22558,22567,22563,22568,22517,22600,22565,22556,22555,22579,22591,22582,
+22574,22585,22584,22573,22572,22587,22881,23215,23188,23199,23162,23202,
+23198,23160,23206,23164,23205,23212,23189,23214,23095,23172,23178,23191,
+23171,23179,23209,23163,23165,23180,23196,23183,23187,23197,23530,23501,
+23499,23508,23505,23498,23502,23564,23600,23863,23875,23915,23873,23883,
+23871,23861,23889,23886,23893,23859,23866,23890,23869,23857,23897,23874,
+23865,23881,23864,23868,23858,23862,23872,23877,24132,24129,24408,24486,
+24485,24491,24777,24761,24780,24802,24782,24772,24852,24818,24842,24854,
+24837,24821,24851,24824,24828,24830,24769,24835,24856,24861,24848,24831,
+24836,24843,25162,25492,25521,25520,25550,25573,25576,25583,25539,25757,
+25587,25546,25568,25590,25557,25586,25589,25697,25567,25534,25565,25564,
+25540,25560,25555,25538,25543,25548,25547,25544,25584,25559,25561,25906,
+25959,25962,25956,25948,25960,25957,25996,26030,26064,26066,26236,26220,
+26235,26240,26225,26233,26218,26226,26369,26892,26835,26884,26844,26922,
+26860,26858,26865,26895,26838,26871,26859,26852,26870,26899,26896,26867,
+26849,26887,26828,26888,26992,26804,26897,26863,26822,26900,26872,26832,
+26877,26876,26856,26891,26890,26903,26830,26824,26854,26868,26833,26886,
+26836,26857,26901,26917,26823,27449,27451,27455,27452,27540,27543,27545,
+27541,27581,27632,27696,28156,28191,28233,28296,28229,28258,28203,28223,
+28225,28253,28275,28188,28211,28235,28224,28241,28219,28163,28206,28254,
+28264,28252,28257,28209,28200,28256,28273,28267,28217,28194,28208,28243,
+28261,28199,28280,28260,28279,28245,28281,28242,28262,28250,28960,28958,
+28975,28923,28974,28977,28963,28965,28962,28978,28959,28968,28986,28955,
+29259,29274,29320,29321,29318,29317,29323,29458,29451,29488,29474,29489,
+29491,29479,29490,29485,29478,29475,29493,29452,29742,29740,29744,29739,
+29718,29722,29729,29741,29745,29732,29731,29725,29737,29728,29746,29947,
+29999,30063,30060,30183,30170,30177,30182,30173,30175,30180,30167,30357,
+30354,30426,30532,30541,30533,30538,30542,30686,30700,30816,30812,30829,
+30833,30826,30830,30832,30825,30824,30814,30818,31092,31091,31090,31088,
+31234,31242,31235,31244,31236,31385,31462,31460,31562,31559,31556,31560,
+31564,31566,31552,31576,31557,31906,31902,31912,31905,32088,32111,32099,
+32083,32086,32103,32106,32079,32109,32092,32107,32082,32084,32105,32081,
+32095,32078,32727,32849,33022,32980,33091,33098,33106,33103,33095,33085,
+33101,33082,33254,33262,33343,33397,33595,33743,33785,33827,33728,33768,
+33810,33767,33764,33788,33782,33808,33734,33736,33771,33763,33727,33793,
+33757,33765,33752,33791,33761,33739,33742,33750,33781,33737,33801,33807,
+33758,33809,33798,33730,33779,33749,33786,33735,33745,33770,33811,33690,
+33731,33772,33774,33732,33787,33751,33762,33819,33755,33790,34520,34530,
+34534,34515,34531,34522,34538,34525,34539,34524,34540,34537,34519,34536,
+34513,34888,34902,34901,35002,35031,35001,35000,35008,35006,34998,35004,
+34999,35005,34994,35073,35017,35221,35224,35223,35293,35406,35405,35385,
+35417,35392,35410,35400,35409,35402,35404,35407,35935,35969,35968,36026,
+36030,36016,36025,36021,36228,36224,36233,36312,36307,36301,36295,36310,
+36316,36303,36309,36313,36296,36311,36293,36591,36599,36602,36601,36582,
+36590,36581,36597,36598,36587,36593,36588,36596,36585,36909,36916,36911,
+37126,37164,37124,37119,37116,37128,37113,37115,37121,37120,37127,37125,
+37123,37217,37220,37215,37218,37216,37377,37386,37413,37379,37402,37414,
+37391,37388,37376,37394,37375,37373,37382,37380,37415,37378,37404,37412,
+37401,37399,37381,37398,38267,38285,38284,38288,38535,38526,38531,38528,
+38594,38600,38595,38641,38640,38764,38768,38766,38919,39081,39147,40166,
+40697,20150,20669,20671,20678,20654,20676,20682,20660,20680,20674,20656,
+20673,20666,20657,20683,20681,20662,20664,20951,21114,21112,21955,21979,
+21964,21968,21963,21962,21981,21952,21972,21956,21993,21951,21970,21901,
+21967,21973,21986,21974,21960,22002,21965,21977,21954,22292,22611,22632,
+22628,22607,22605,22601,22639,22613,22606,22621,22617,22629,22619,22589,
+22627,22641,22780,23239,23236,23243,23226,23224,23217,23221,23216,23231,
+23240,23227,23238,23223,23232,23242,23220,23222,23245,23225,23184,23510,
+23583,23603,23921,23907,23882,23909,23922,23916,23902,23912,23911,23906,
+24048,24143,24142,24138,24141,24139,24261,24268,24262,24267,24263,24384,
+24495,24493,24823,24875,24901,24886,24882,24878,24902,24879,24911,24873,
+24896,25120,37224,25123,25125,25124,25541,25585,25579,25616,25618,25609,
+25632,25636,25651,25667,25631,25621,25624,25657,25655,25612,25638,25648,
+25640,25665,25653,25647,25610,25626,25664,25637,25639,25611,25575,25627,
+25646,25633,25614,25967,26002,26067,26246,26252,26261,26256,26251,26250,
+26265,26260,26232,26400,26982,26975,26936,26958,26978,26993,26943,26949,
+26986,26937,26946,26967,26969,27002,26933,26988,26931,26941,26981,26864,
+27000,26932,26985,26944,26991,26948,26998,26968,26945,26996,26956,26939,
+26955,26935,26972,26959,26961,26930,26962,26927,27003,26940,27462,27461,
+27459,27458,27464,27457,27547,28315,28374,28360,28303,28352,28319,28320,
+28337,28345,28358,28370,28349,28353,28318,28361,28343,28336,28365,28326,
+28367,28338,28350,28355,28380,28376,28313,28306,28302,28301,28324,28321,
+28351,28339,28368,28362,28311,28334,28323,28999,29012,29010,29027,29024,
+28993,29021,29026,29042,29048,29034,29025,28994,29016,28995,29003,29040,
+29023,29008,29011,28996,29005,29018,29263,29325,29324,29329,29328,29326,
+29500,29506,29499,29498,29504,29514,29513,29764,29778,29777,29783,29760,
+29774,29762,29766,29773,29780,29921,29951,29950,29949,29981,30073,30071,
+27011,30191,30223,30211,30199,30206,30204,30201,30200,30224,30203,30198,
+30189,30197,30205,30361,30389,30429,30549,30546,30550,30554,30569,30567,
+30548,30553,30573,30688,30855,30874,30868,30863,30852,30869,30881,30851,
+30841,30873,30848,30870,30843,31100,31106,31101,31097,31249,31250,31255,
+31253,31266,31251,31259,31248,31395,31394,31390,31467,31590,31588,31597,
+31604,31593,31602,31589,31603,31601,31600,31585,31608,31606,31587,31922,
+31924,31919,32136,32134,32128,32141,32127,32133,32122,32142,32123,32131,
+32124,32140,32148,32132,32125,32146,32621,32619,32620,32678,32677,32679,
+32801,33124,33120,33143,33116,33129,33115,33122,33138,26401,33118,33142,
+33127,33135,33092,33121,33309,33353,33348,33344,33346,33349,34033,33855,
+33878,33910,33913,33935,33933,33893,33873,33856,33926,33895,33840,33869,
+33917,33882,33881,33908,33907,33885,34055,33886,33847,33850,33844,33914,
+33859,33912,33842,33861,33833,33753,33867,33839,33858,33837,33887,33904,
+33849,33870,33868,33874,33903,33989,33934,33851,33863,33846,33843,33896,
+33918,33860,33835,33888,33876,33902,33872,34571,34564,34551,34572,34554,
+34518,34549,34637,34552,34574,34569,34561,34550,34573,34565,35030,35019,
+35038,35035,35034,35020,35024,35205,35227,35295,35301,35300,35297,35296,
+35298,35292,35302,35446,35462,35455,35425,35391,35447,35458,35460,35445,
+35459,35457,35444,35450,35900,35915,35914,35941,35940,35942,35974,36241,
+36236,36240,36242,36336,36320,36332,36337,36334,36304,36329,36323,36322,
+36327,36338,36331,36340,36614,36607,36609,36608,36613,36610,36619,36946,
+36927,36932,36937,36925,37136,37133,37135,37137,37142,37140,37131,37134,
+37448,37458,37424,37434,37478,37427,37477,37470,37507,37422,37450,37446,
+37485,37484,37455,37472,37479,37487,37430,37473,37488,37425,37460,37475,
+37456,37490,37454,37459,37452,37462,37426,38303,38300,38302,38299,38545,
+38551,38606,38650,38653,38648,38645,38771,38770,38927,39084,39158,39161,
+39343,39346,39344,39349,39597,39595,39771,40170,40173,40167,40576,40701,
+20710,20692,20695,20712,20723,20699,20714,20701,20708,20691,20716,20720,
+20719,20707,20704,20952,21225,21227,21296,21420,22055,22037,22028,22034,
+22012,22031,22044,22017,22035,22018,22010,22045,22020,22015,22009,22665,
+22652,22672,22680,22662,22657,22655,22644,22667,22650,22663,22673,22670,
+22646,22658,22664,22651,22676,22671,22782,22891,23260,23278,23269,23253,
+23274,23258,23277,23275,23283,23266,23264,23259,23276,23262,23261,23257,
+23272,23263,23415,23520,23523,23651,23938,23936,23933,23942,23930,23937,
+23927,23946,23945,23944,23934,23932,23949,23929,23935,24147,24280,24273,
+24279,24270,24284,24277,24281,24274,24276,24388,24387,24431,24502,24876,
+24872,24897,24926,24945,24947,24946,24940,24960,24948,24916,24954,24923,
+24933,24891,24938,24929,24918,25129,25127,25131,25643,25677,25691,25693,
+25716,25718,25725,25717,25702,25766,25678,25730,25694,25692,25675,25683,
+25696,25680,25727,25663,25708,25707,25689,25701,25719,25971,26016,26273,
+26272,26271,26373,26372,26402,27057,27062,27081,27040,27086,27030,27056,
+27052,27068,27025,27033,27022,27047,27021,27049,27070,27055,27071,27076,
+27069,27044,27092,27065,27082,27034,27087,27059,27027,27050,27041,27038,
+27097,27031,27024,27074,27061,27045,27078,27466,27469,27467,27646,28366,
+28405,28401,28419,28453,28408,28471,28411,28462,28425,28494,28455,28440,
+28475,28434,28397,28426,28470,28531,28409,28398,28461,28480,28464,28476,
+28469,28395,28423,28430,28483,28421,28413,28406,28473,28444,28412,28474,
+28447,28429,28446,28424,28449,29063,29072,29065,29056,29061,29058,29071,
+29051,29062,29057,29079,29252,29267,29335,29333,29331,29507,29517,29521,
+29516,29794,29811,29809,29813,29810,29799,29806,29952,30077,30096,30230,
+30216,30220,30229,30225,30218,30228,30392,30593,30588,30597,30594,30574,
+30592,30575,30590,30595,30898,30890,30900,30893,30888,30846,30891,30878,
+30885,30880,30892,30882,30884,31128,31126,31125,31124,31123,31127,31112,
+31122,31120,31275,31306,31280,31279,31272,31270,31400,31470,31624,31644,
+31626,31633,31632,31638,31629,31628,31643,31630,31621,31640,21124,31641,
+31652,31618,31931,31935,31932,31930,32167,32183,32194,32163,32170,32193,
+32192,32197,32157,32206,32196,32198,32175,32185,32150,32188,32159,32166,
+32174,32169,32161,32201,32627,32741,32734,32804,32861,32860,33161,33158,
+33155,33159,33165,33164,33163,33301,33943,33956,33953,33951,33978,33998,
+33986,33964,33966,33963,33977,33972,33985,33997,33962,33946,33969,34000,
+33949,33959,33979,33954,33940,33991,33996,33947,33961,33967,33960,34006,
+33944,33974,33999,33952,34007,34004,34002,34011,33968,33937,34401,34611,
+34595,34600,34667,34624,34606,34590,34593,34585,34587,34627,34604,34625,
+34622,34630,34592,34610,34602,34605,34620,34578,34618,34609,34613,34626,
+34616,34596,34586,34608,34577,35063,35047,35066,35070,35054,35068,35062,
+35067,35056,35052,35051,35229,35233,35231,35230,35305,35307,35304,35499,
+35481,35467,35474,35471,35478,35901,36053,36047,36055,36246,36361,36354,
+36351,36365,36349,36362,36355,36359,36358,36357,36350,36352,36356,36622,
+36621,37155,37148,37152,37154,37151,37149,37146,37156,37153,37147,37242,
+37234,37241,37235,37541,37540,37494,37531,37498,37536,37524,37546,37517,
+37542,37530,37547,37497,37527,37503,37539,37614,37518,37506,37525,37538,
+37501,37512,37537,37514,37510,37516,37529,37543,37502,37511,37545,37533,
+37515,37421,38558,38561,38655,38744,38781,38778,38782,38787,38784,38786,
+38779,38788,38785,38783,38862,38861,38934,39170,39168,39175,39325,39324,
+39363,39353,39355,39354,39362,39357,39367,39601,39651,39655,40181,40615,
+20735,20739,20784,20728,20726,20734,20733,20746,21233,21231,22088,22082,
+22092,22069,22081,22090,22089,22086,22104,22106,22080,22067,22077,22060,
+22078,22072,22058,22074,22298,22699,22685,22705,22688,22691,22703,22700,
+22693,22689,22783,23295,23284,23293,23287,23286,23299,23288,23298,23289,
+23297,23303,23301,23311,23655,23961,23959,23967,23954,23970,23955,23957,
+23968,23964,23969,23962,23966,24169,24157,24160,24156,32243,24283,24286,
+24289,24393,24498,24971,24963,24953,25009,25008,24994,24969,24987,24979,
+25007,25005,24991,24978,25002,24993,24973,24934,25011,25133,25710,25712,
+25750,25760,25733,25751,25756,25743,25739,25738,25740,25763,25759,25704,
+25777,25752,25974,25978,25977,25979,26293,26288,26281,26290,26295,26282,
+26287,27136,27142,27159,27109,27128,27157,27121,27108,27168,27135,27116,
+27106,27163,27165,27134,27175,27122,27118,27156,27127,27111,27200,27144,
+27110,27131,27149,27132,27115,27145,27140,27160,27173,27151,27126,27174,
+27143,27124,27158,27473,27557,27555,27554,27558,27649,27648,27647,27650,
+28481,28454,28542,28551,28614,28562,28557,28553,28556,28514,28495,28549,
+28506,28566,28534,28524,28546,28501,28530,28498,28496,28503,28564,28563,
+28509,28416,28513,28523,28541,28519,28560,28499,28555,28521,28543,28565,
+28515,28535,28522,28539,29106,29103,29083,29104,29088,29082,29097,29109,
+29085,29093,29086,29092,29089,29098,29084,29095,29107,29336,29338,29528,
+29522,29533,29531,29537,29530,29529,29538,29831,29830,29825,29821,29829,
+29832,29820,29817,29960,29959,30078,30245,30238,30233,30237,30236,30243,
+30234,30248,30235,30363,30605,30607,30601,30600,30925,30907,30927,30924,
+30929,30926,30932,30920,30921,31130,31137,31136,31132,31138,31131,27510,
+31289,31410,31412,31411,31671,31691,31678,31660,31694,31663,31673,31690,
+31669,31941,31944,31948,31947,32247,32219,32234,32231,32215,32225,32259,
+32250,32230,32246,32241,32240,32238,32223,32630,32684,32688,32685,32749,
+32747,32746,32748,32742,32744,32868,32871,33187,33183,33182,33173,33186,
+33177,33175,33302,33359,33363,33362,33360,33358,33361,34084,34107,34063,
+34048,34089,34062,34057,34061,34079,34058,34087,34076,34043,34091,34042,
+34056,34060,34036,34090,34034,34069,34039,34027,34035,34044,34066,34026,
+34025,34070,34046,34088,34077,34094,34050,34045,34078,34038,34097,34086,
+34032,34031,34041,34072,34080,34096,34059,34073,34095,34402,34646,34679,
+34785,34675,34648,34644,34651,34642,34657,34650,34641,34654,34669,34666,
+34640,34638,34655,34653,34671,34668,34682,34670,34652,34661,34639,34683,
+34677,34658,34663,34665,34906,35077,35084,35092,35083,35078,35094,35089,
+35086,35081,35234,35236,35235,35309,35312,35308,35535,35526,35512,35539,
+35537,35515,35543,35518,35520,35525,35544,35523,35514,35517,35545,35902,
+35917,35983,36069,36063,36057,36072,36058,36061,36071,36256,36252,36257,
+36251,36384,36387,36389,36388,36398,36373,36379,36374,36369,36377,36372,
+36370,36376,36371,36380,36375,36378,36652,36644,36632,36634,36640,36643,
+36979,36976,36975,36967,36971,37167,37163,37170,37158,37166,37252,37248,
+37584,37568,37593,37558,37583,37617,37599,37592,37609,37591,37597,37580,
+37615,37570,37608,37578,37576,37582,37606,37581,37589,37577,37600,37598,
+37607,37585,37587,37557,37601,37669,37574,37556,38268,38316,38315,38318,
+38320,38564,38562,38611,38661,38664,38658,38746,38794,38798,38792,38864,
+38863,38942,38941,38950,38953,38952,38944,38939,38951,39090,39176,39162,
+39185,39188,39189,39388,39373,39375,39374,39369,39382,39384,39371,39383,
+39372,39603,39660,39659,39667,39666,39665,39750,39747,39783,39796,39793,
+39782,39798,39797,39792,39784,39780,39788,40188,40186,40189,40191,40183,
+40199,40192,40185,40187,40200,40197,40196,40579,40659,20764,20755,20759,
+20762,20753,20958,21300,21473,22128,22112,22126,22131,22118,22115,22125,
+22130,22110,22135,22300,22299,22728,22717,22729,22719,22714,22722,22716,
+22726,23319,23321,23323,23329,23316,23315,23312,23318,23336,23322,23328,
+23326,23535,23980,23985,23977,23975,23989,23984,23982,23978,23976,23986,
+23981,23983,23988,24166,24175,24297,24295,24294,24296,24293,24395,24508,
+24507,24989,25000,24982,25029,25012,25030,25025,25036,25018,25023,25016,
+24972,25815,25814,25808,25807,25801,25789,25737,25795,25819,25843,25817,
+25907,25983,25980,26018,26312,26302,26304,26319,26301,26299,26298,26316,
+26403,27188,27238,27209,27239,27186,27240,27198,27229,27245,27254,27227,
+27217,27176,27226,27195,27199,27201,27242,27236,27216,27215,27220,27247,
+27241,27232,27196,27230,27222,27221,27206,27477,27476,27478,27559,27592,
+27591,27652,27651,27654,28589,28619,28579,28615,28604,28622,28616,28510,
+28612,28605,28574,28618,28584,28676,28581,28590,28602,28588,28586,28623,
+28607,28600,28578,28617,28587,28621,28591,28594,28592,29125,29122,29119,
+29112,29142,29131,29140,29130,29127,29135,29117,29144,29116,29126,29548,
+29541,29547,29546,29823,29850,29856,29844,29842,29845,29857,29963,30080,
+30255,30253,30257,30269,30259,30268,30261,30258,30256,30395,30438,30618,
+30621,30625,30620,30619,30613,30617,30615,30941,30953,30949,30954,30942,
+30947,30939,31140,31300,31304,31303,31414,31416,31413,31409,31415,31710,
+31715,31719,31709,31701,31717,31706,31720,31737,31700,31722,31714,31708,
+31723,31704,31711,31954,31956,31959,32274,32289,32279,32268,32275,32270,
+32284,32277,32282,32290,32267,32271,32278,32269,32276,32293,32292,32579,
+32634,32689,32751,32810,32809,32876,33201,33190,33198,33209,33205,33195,
+33200,33196,33204,33202,33207,33191,33266,34134,34117,34155,34125,34131,
+34145,34136,34112,34118,34148,34113,34146,34116,34129,34119,34147,34110,
+34139,34161,34126,34158,34165,34133,34151,34144,34188,34150,34141,34132,
+34149,34156,34403,34405,34404,34724,34715,34703,34711,34707,34706,34696,
+34689,34710,34712,34681,34695,34723,34693,34717,34692,34708,34716,34714,
+34697,35102,35110,35120,35111,35121,35106,35113,35107,35119,35116,35103,
+35313,35552,35554,35570,35549,35604,35556,35551,35568,35528,35550,35553,
+35560,35583,35567,35579,35984,36085,36078,36081,36080,36083,36204,36206,
+36261,36263,36403,36414,36408,36416,36421,36406,36417,36400,36415,36541,
+36662,36654,36661,36658,36665,36663,36660,36982,36985,36987,36998,37114,
+37171,37261,37263,37671,37662,37640,37663,37638,37647,37754,37688,37692,
+37659,37667,37650,37633,37702,37677,37646,37645,37579,37661,37626,37651,
+37625,37623,37684,37634,37668,37631,37673,37689,37685,37674,37652,37644,
+37643,37630,37641,37632,37627,37654,38332,38349,38334,38326,38335,38325,
+38333,38569,38612,38667,38674,38672,38809,38807,38804,38896,38904,38965,
+38959,38962,39204,39199,39207,39209,39326,39406,39404,39397,39396,39408,
+39395,39402,39401,39399,39609,39615,39604,39611,39670,39674,39673,39671,
+39731,39808,39813,39815,39804,39806,39803,39810,39827,39826,39824,39802,
+39829,39805,39816,40229,40215,40224,40222,40212,40233,40221,40216,40226,
+40208,40217,40223,40584,40622,40621,40698,40722,40765,20774,20773,20770,
+20772,20768,20777,21236,22163,22150,22148,22147,22142,22146,22143,22145,
+22742,22740,22735,22738,23341,23333,23346,23331,23340,23335,23334,23343,
+23342,23419,23991,24172,24170,24510,25027,25013,25020,25063,25056,25061,
+25060,25064,25054,25839,25833,25827,25835,25828,25832,25985,25984,26038,
+26074,26322,27277,27286,27265,27301,27273,27295,27291,27297,27294,27271,
+27283,27278,27285,27267,27304,27300,27281,27263,27302,27290,27269,27276,
+27282,27483,27565,27657,28620,28585,28660,28628,28643,28636,28653,28647,
+28646,28638,28658,28637,28642,28648,29153,29169,29160,29170,29156,29168,
+29154,29555,29847,29874,29867,29840,29866,29869,29873,29861,29871,29967,
+30084,30275,30279,30372,30441,30645,30635,30642,30647,30646,30644,30641,
+30632,30704,30963,30973,30978,30975,30962,30981,30969,30974,30980,31147,
+31144,31324,31323,31318,31320,31316,31322,31422,31749,31759,31730,31744,
+31743,31739,31758,31732,31755,31731,31746,31753,31747,31745,31736,31741,
+31750,31760,31754,31976,32301,32316,32322,32307,38984,32312,32298,32329,
+32320,32327,32297,32332,32304,32315,32310,32324,32314,32581,32639,32638,
+32637,32756,32754,32812,33211,33220,33228,33226,33221,33223,33212,33257,
+33371,33370,33372,34179,34176,34191,34215,34197,34208,34187,34211,34171,
+34212,34202,34206,34167,34172,34185,34209,34170,34168,34135,34190,34198,
+34182,34189,34201,34205,34177,34210,34178,34184,34181,34169,34166,34200,
+34192,34207,34408,34750,34730,34733,34757,34736,34732,34745,34741,34748,
+34734,34761,34755,34754,34764,34743,34735,34756,34762,34740,34742,34751,
+34744,34749,34782,34738,35125,35123,35132,35134,35137,35154,35127,35138,
+35245,35247,35246,35614,35608,35606,35601,35589,35595,35618,35599,35602,
+35605,35591,35597,35592,35590,35612,35603,35610,35919,35952,35954,35953,
+35951,35989,35988,36089,36207,36430,36429,36435,36432,36428,36423,36675,
+36672,36997,36990,37176,37274,37282,37275,37273,37279,37281,37277,37280,
+37793,37763,37807,37732,37718,37703,37756,37720,37724,37750,37705,37728,
+37741,37775,37708,37738,37753,37719,37717,37714,37711,37745,37751,37755,
+37729,37726,37731,37735,37710,37721,38343,38336,38345,38339,38341,38327,
+38574,38576,38572,38688,38687,38680,38685,38681,38810,38817,38812,38814,
+38813,38869,38868,38897,38977,38980,38986,38985,38981,38979,39205,39210,
+39219,39218,39215,39213,39217,39216,39320,39331,39329,39426,39418,39412,
+39415,39417,39416,39414,39419,39420,39427,39614,39678,39677,39681,39676,
+39752,39834,39848,39838,39835,39846,39841,39845,39844,39814,39842,39840,
+39855,40243,40257,40295,40246,40241,40248,40240,40261,40254,40247,40256,
+40253,32757,40237,40586,40585,40589,40624,40648,40666,40699,40703,40740,
+40739,40738,40788,40864,20785,22168,22172,22167,22170,22173,22169,22896,
+23356,25048,25055,25073,25066,25072,25067,25046,25065,25855,25860,25853,
+25848,25857,25859,25852,26004,26075,26328,27333,27321,27325,27361,27334,
+27322,27335,27316,27309,27486,27593,27659,28679,28673,28677,28692,28686,
+28667,28710,28668,28663,28682,29185,29183,29177,29187,29181,29558,29880,
+29888,29877,29889,29886,29878,29883,29890,29972,29971,30300,30308,30297,
+30288,30291,30295,30298,30374,30397,30444,30658,30650,30988,30985,30992,
+30994,30993,31149,31148,31327,31772,31785,31769,31776,31775,31789,31773,
+31782,31784,31778,31781,31792,32348,32336,32342,32355,32344,32354,32351,
+32337,32352,32343,32339,32693,32691,33232,33375,33374,34228,34246,34240,
+34243,34242,34227,34229,34237,34247,34244,34239,34251,34254,34248,34245,
+34225,34230,34258,34340,34232,34231,34238,34409,34791,34790,34786,34779,
+34795,34794,34789,34783,34803,34788,34772,34780,34771,34797,34776,34787,
+34775,34777,34817,34804,34792,34781,35155,35147,35151,35148,35142,35145,
+35626,35623,35619,35635,35632,35637,35655,35631,35644,35646,35633,35621,
+35639,35622,35638,35630,35620,35643,35645,35642,35906,35957,35993,35992,
+35991,36094,36100,36098,36096,36444,36450,36448,36439,36438,36446,36453,
+36455,36443,36442,36449,36445,36457,36436,36683,37160,37182,37288,37285,
+37287,37295,37290,37813,37772,37778,37815,37787,37789,37769,37799,37774,
+37802,37790,37798,37781,37768,37785,37791,37760,37773,37809,37777,37810,
+37796,37800,37812,37795,38353,38579,38615,38618,24002,38623,38616,38621,
+38691,38690,38693,38828,38830,38824,38827,38820,38826,38818,38821,38871,
+38873,38870,38872,38906,39096,39233,39228,39226,39439,39435,39433,39437,
+39428,39441,39434,39429,39431,39430,39616,39644,39688,39721,39733,39754,
+39756,39755,39879,39878,39875,39871,39873,39861,39864,39891,39862,39876,
+39865,39869,40284,40275,40271,40266,40283,40267,40281,40278,40268,40279,
+40274,40276,40287,40280,40282,40590,40588,40671,40705,40704,40726,40741,
+40747,40746,40745,40744,40780,40789,21142,21239,21428,22187,22189,22186,
+22188,22746,22749,22747,22802,24003,24176,24511,25083,25863,25872,25869,
+25865,25868,25870,25988,26078,26077,26334,27367,27360,27340,27345,27353,
+27339,27359,27356,27344,27371,27343,27341,27358,27488,27568,27660,28697,
+28711,28704,28694,28715,28713,28695,28708,28700,29196,29194,29191,29186,
+29189,29348,29347,29345,29899,29893,29879,29891,29974,30304,30660,30705,
+31005,31003,31009,31004,30999,31006,31152,31795,31804,31801,31788,31803,
+31980,31978,32374,32373,32376,32368,32375,32367,32378,32370,32372,32360,
+32587,32586,32643,32646,32695,32888,33239,33237,33291,33380,33377,33379,
+34283,34289,34285,34265,34273,34280,34266,34263,34284,34290,34296,34264,
+34271,34275,34268,34257,34288,34278,34287,34270,34274,34816,34810,34819,
+34825,34828,34827,34822,34812,34824,34815,34826,34818,35170,35159,35169,
+35164,35160,35165,35161,35208,35255,35254,35318,35664,35656,35658,35648,
+35667,35670,35668,35659,35669,35665,35650,35666,35671,35907,35959,35958,
+35994,36105,36268,36266,36269,36267,36461,36472,36467,36458,36463,36475,
+36546,36690,36689,36691,36788,37184,37183,37296,37293,37854,37831,37839,
+37826,37850,37840,37881,37868,37836,37849,37801,37862,37834,37844,37870,
+37859,37845,37828,37838,37824,37842,37797,37863,38269,38625,38697,38696,
+38694,38835,38839,38838,39004,39001,39005,38999,39103,39101,39099,39102,
+39240,39239,39235,39450,39445,39461,39453,39460,39451,39458,39456,39463,
+39459,39454,39452,39444,39618,39691,39690,39694,39692,39735,39904,39902,
+39908,39910,39906,39920,39892,39895,39916,39900,39897,39909,39893,39905,
+39898,40311,40321,40330,40324,40328,40305,40320,40312,40326,40317,40299,
+40304,40297,40325,40307,40315,40322,40303,40313,40319,40327,40296,40596,
+40593,40640,40700,40749,21303,22194,22197,22195,22755,23365,25081,25879,
+25878,25877,25875,26079,26344,27379,27376,27370,27368,27385,27377,28732,
+28725,28719,28727,28724,28721,28738,28728,28735,28730,28729,28714,28736,
+28731,28723,28737,29352,29565,29564,29882,30379,30378,30398,30445,30668,
+30670,30671,30669,30706,31013,31011,31012,31017,31154,31342,31479,31817,
+31816,31818,31815,31813,31982,32379,32382,32385,32384,32698,32767,32889,
+33243,33241,34338,34303,34305,34302,34331,34304,34294,34308,34313,34309,
+34316,34301,34841,34839,34835,34838,35171,35174,35257,35319,35680,35690,
+35677,35688,35683,35685,35687,35693,36270,36486,36488,36484,36697,36693,
+36696,36698,37005,37187,37185,37303,37301,37899,37907,37883,37920,37903,
+37908,37886,37909,37904,37928,37913,37901,37877,37888,37879,37895,37902,
+37910,37906,37882,37897,37880,37948,37898,37887,37884,37900,37878,37905,
+37894,38366,38368,38367,38841,38843,39248,39246,39257,39244,39243,39251,
+39474,39476,39473,39468,39466,39478,39465,39470,39480,39469,39623,39626,
+39622,39696,39698,39697,39947,39944,39927,39941,39954,39928,40000,39943,
+39950,39942,39959,39956,39945,40351,40345,40356,40349,40338,40344,40336,
+40347,40352,40340,40348,40362,40343,40353,40346,40354,40360,40350,40355,
+40383,40361,40342,40601,40603,40602,40677,40676,40679,40678,40752,40750,
+40795,40800,40798,40797,40793,40849,20794,20793,21144,21143,22211,23368,
+23367,24011,24015,24305,25085,25883,27394,27388,27395,27384,27392,29213,
+29210,29209,29566,29975,30314,30672,31021,31025,31023,31828,31827,31986,
+32394,32395,32390,32397,32589,32699,32816,33245,34328,34346,34342,34335,
+34339,34332,34329,34343,34350,34337,34336,34345,34334,34341,34857,34845,
+34843,34848,34852,34844,34859,34890,35181,35177,35182,35179,35322,35705,
+35704,35653,36112,36116,36271,36494,36492,36702,36699,36701,37190,37305,
+37951,37947,37942,37929,37949,37936,37945,37930,37943,37932,37952,37937,
+38373,38372,38371,38709,38714,38847,38881,39012,39113,39110,39104,39256,
+39254,39481,39485,39494,39492,39490,39489,39482,39487,39629,39701,39702,
+39738,39762,39979,39965,39964,39980,39971,39972,39969,40375,40374,40380,
+40385,40391,40394,40399,40382,40389,40387,40379,40373,40398,40364,40392,
+40369,40365,40396,40371,40397,40370,40570,40604,40683,40686,40685,40731,
+40728,40730,40753,40782,40805,40804,40850,20153,22214,22213,22219,22897,
+24021,24017,24306,25889,25888,25894,25890,27403,29353,29567,29912,29909,
+29913,29911,30317,30381,31029,31156,31831,31836,31833,31835,31834,31988,
+31985,32401,32591,32647,33246,33387,34355,34348,34354,34358,34860,34856,
+34854,34858,34853,35185,35263,35262,35323,35710,35716,35714,35718,35717,
+35711,36117,36501,36500,36506,36498,36496,36704,36706,37191,37964,37968,
+37967,37959,37957,37958,38719,38883,39018,39017,39115,39252,39259,39502,
+39500,39503,39496,39498,39497,39506,39504,39632,39705,39723,39739,39766,
+39765,40006,40008,39999,40004,39993,39987,40001,39996,39991,39988,39986,
+39997,39990,40411,40402,40414,40410,40395,40400,40412,40401,40415,40425,
+40409,40408,40406,40437,40405,40413,40630,40688,40757,40755,40754,40770,
+40811,40853,40866,20797,21145,22760,22759,22898,23373,24024,34863,24399,
+25089,25897,25893,26006,26347,27407,27594,28763,28762,29218,29570,29569,
+29571,30320,30676,31847,31846,32405,33388,34362,34368,34361,34364,34353,
+34363,34366,34864,34866,34862,34867,35190,35188,35187,35326,35724,35726,
+35723,35720,35909,36121,36504,36708,36707,37308,37986,37973,37981,37975,
+37982,38912,39510,39513,40018,40024,40016,40010,40013,40011,40021,40025,
+40012,40014,40443,40439,40431,40419,40427,40440,40420,40438,40417,40430,
+40422,40434,40432,40418,40428,40436,40435,40424,40429,40642,40656,40710,
+40732,40760,40759,40758,40771,40783,40817,40816,22227,22221,23374,23661,
+25901,27411,28767,28769,28765,28768,29219,29915,29925,30677,31032,31159,
+31158,31850,32407,32649,33389,34371,34872,34871,34869,34891,36509,37310,
+37309,37314,37995,38629,38726,38723,38727,38855,38885,39518,39637,39769,
+40035,40039,40038,40034,40030,40032,40450,40446,40455,40451,40454,40453,
+40457,40447,40445,40452,40608,40734,40774,22228,25902,26040,27415,27418,
+28770,29222,29354,31033,31849,31851,31990,32410,32408,32411,32409,35196,
+35195,35327,36517,36516,36515,37998,37997,37999,38001,38003,38729,39026,
+39263,40040,40046,40045,40459,40461,40464,40463,40466,40465,40609,40693,
+40713,40775,40824,40827,40826,40825,22302,28774,31855,34876,36274,36518,
+37315,38004,38008,38006,38005,39520,39726,40052,40051,40049,40053,40468,
+40467,40694,40714,40868,28776,28773,31991,34410,34878,34877,34879,35742,
+35996,36521,36553,38731,39116,39265,39339,39524,39716,40469,40471,40776,
+25095,27422,29223,34380,36520,38018,39529,39528,40473,34379,35743,38019,
+40057,40631,30325,39531,40058,40477,29225,40612,40830,40777,40856,65049,
+8764,65075,9588,65076,65103,776,65342,12540,65339,65341,10045,20994,
+17553,40880,20872,40881,65533,65533,65533,65533,65533,65533,65533,65533,
+65533,65533,65533,65533,65533,65533,65533,65533,65533,65533,65533,65533,
+65533,65533,65533,65533,65533,65533,65533,65533,65533,65533,65533,65533,
+65533,65533,65533,65533,65533,65533,65533,65533,172,65508,65287,65282,
+12849,8470,8481,30849,37561,35023,22715,24658,31911,23290,9556,9574,
+9559,9568,9580,9571,9562,9577,9565,9554,9572,9557,65533,65533,
+65533,9560,9575,9563,9555,9573,9558,9567,9579,9570,9561,9576,
+9564,9553,65533,65533,65533,65533,65533,9619,65533,65533,65533,65044,
+65043,65046,65045,65533,65533,65533,65533,65533,65533,65533,65533,65533,
+65533,65533,65533,65533,65533,65533,65533,23412,31305,31333,31357,31419,
+31408,16842,31450,31453,31466,16879,21682,31499,31573,31529,31650,31599,
+33692,31696,33825,31634,65533,65533,33938,31738,65533,31797,31812,31875,
+31945,31943,31974,65533,31987,31989,32359,17693,32137,32171,28981,32179,
+32214,32228,15635,32245,32366,65533,17195,37996,32295,32583,31030,39393,
+32663,64091,32776,32797,65533,32815,26405,32935,33031,33050,22704,17530,
+33321,34018,33634,33450,26907,16859,34123,33488,33562,33403,33506,33560,
+15807,33565,21996,33669,17675,33708,65533,33747,27223,34138,13462,33905,
+15827,17636,27303,33866,31064,65533,34014,65533,33681,17568,33939,34020,
+17731,34100,23282,17699,17703,34163,17686,26559,34326,17770,34344,13896,
+34430,65533,34737,34778,34831,22113,34412,26710,17935,34910,34972,18011,
+35207,65533,65533,65533,35239,35260,35484,30611,37374,35472,29052,35596,
+35615,35647,65533,35661,35497,35728,35739,35503,17941,34895,35995,36114,
+36099,36059,28764,36113,16080,31463,36525,36534,36547,37588,36633,36653,
+36773,37635,36787,65533,36857,65533,37038,64038,37223,37289,37316,31916,
+37390,27807,37441,37474,37676,37739,18789,37444,37747,37979,36540,38277,
+38310,37926,38304,28662,17081,18911,27676,38523,38550,16748,38563,25050,
+58541,30965,38589,21452,18849,38705,34370,38710,18959,17725,17797,28789,
+23361,38683,65533,38743,23370,38751,37925,20688,38793,38815,38833,38846,
+38848,38866,38880,38894,29724,65533,38901,19153,38964,38963,38987,39014,
+15118,39114,39095,39112,39111,19199,21936,39137,39142,39148,37752,39225,
+39413,39436,39483,39440,39512,39648,39650,39668,19470,39700,39725,20532,
+39732,14531,39760,39744,39822,39938,39935,39948,40318,40323,40462,40388,
+40592,40597,40606,40610,19764,40618,40623,40641,15200,14821,15645,20274,
+14270,40706,40712,19350,37924,40761,22175,22154,40773,39352,38898,33919,
+65533,40809,31452,40846,29206,19390,37737,37875,37612,37761,37835,29207,
+16107,30578,31299,28880,65533,33877,26617,14131,15381,15847,22636,26640,
+16471,21707,22174,37788,20216,20779,14361,65533,20299,20362,13365,20265,
+20120,20685,20749,20386,20227,20290,20526,20588,20609,20428,20453,20568,
+20732,28278,20904,20931,21081,21156,21217,65533,18042,29068,65533,16094,
+29849,29716,29782,29592,19342,21456,13700,29199,22301,37469,38644,22493,
+22413,22399,13886,22731,23193,23084,22968,23166,23247,23058,14069,27909,
+29763,23073,37856,29836,28933,18802,37896,37821,14240,23582,23710,24158,
+24136,24269,23375,14035,33066,24332,24334,34912,24702,24539,16056,24985,
+24984,24693,25399,25782,25393,25553,25659,25963,26994,15348,26219,19347,
+26160,29904,15254,26806,65533,15300,27326,27187,27218,27337,27397,25873,
+26776,27212,15319,27258,27479,37792,37618,37991,28069,28427,65533,15759,
+28164,23101,28170,22599,27940,30786,28987,28913,29264,29319,29332,16134,
+16049,24743,16115,29900,29756,37767,29751,17567,17745,30083,16227,16216,
+30037,30323,65533,29800,15099,15821,37370,22322,37698,29752,29851,16063,
+30750,30861,30856,30930,29648,31065,16654,65533,65533,31141,27181,31290,
+31220,16750,16690,37429,31217,13719,21867,13680,13994,31458,23129,30960,
+23082,31486,16889,31837,31853,16913,31886,31868,31918,27314,32220,32263,
+32211,32590,32733,31527,39398,34373,39523,27164,17642,33079,17410,32966,
+33033,33090,33378,33381,23174,16767,23042,34926,20293,34951,35007,35046,
+35173,35149,16045,33955,18165,18127,14322,35389,35356,24397,37419,26068,
+28969,28868,40301,35999,36073,22938,30659,23024,14036,36394,36519,36656,
+36682,17140,27736,28603,18587,28537,28299,39913,14005,37051,18612,21873,
+18694,37307,37892,34021,35371,38297,38311,38295,38294,29765,16066,29714,
+29803,16124,38721,26695,18973,65533,37736,37562,23313,35689,18748,29689,
+38811,65533,39224,37349,17600,16128,37418,18725,33812,39227,39245,15869,
+65533,19311,39338,39516,27279,39457,23294,39471,39356,19389,19351,37757,
+22642,26821,15741,37976,14631,24912,24839,40015,40019,40059,39989,39952,
+39807,39887,40225,19630,40472,19632,40204,40357,33981,34300,17715,33824,
+34286,15714,37851,37566,37704,30905,37495,37965,20452,13376,36964,30781,
+30804,30902,30795,13978,20338,28634,28633,65533,28702,21524,22459,22771,
+22410,40214,22487,28980,13487,24844,23246,23051,17084,14124,19323,37819,
+37816,37605,29666,16105,29876,27352,29683,29691,16086,37508,29670,37727,
+21762,31172,17710,37889,14090,23201,14050,14000,37471,23161,37748,15565,
+19094,14730,20724,15721,15692,29045,17147,17643,27991,28775,27823,15574,
+28162,28428,15727,30033,14012,13512,18048,16090,18545,22980,37486,18750,
+36673,22546,22472,14038,26809,26983,33854,17631,17614,65533,65533,33597,
+22921,23170,23137,23153,14125,23023,14023,29070,37776,26266,23150,23083,
+65533,28979,15781,27871,23019,24412,36972,33270,30476,27810,22269,22633,
+26465,23646,22770,28857,26627,20001,31545,15820,29482,30048,22586,33446,
+27018,24803,20206,39364,40639,21249,26528,24808,20916,31363,39994,31432,
+26906,22956,22592,21610,24807,22138,26965,39983,34725,23584,24075,26398,
+33965,35713,20088,25283,26709,65533,33533,35237,36768,38840,38983,39613,
+24497,26184,26303,65533,65533,26382,26904,18640,19128,65533,29193,36570,
+21135,29041,20582,13563,65533,18300,35682,23899,24981,23079,38486,28047,
+65533,31554,65533,31301,39462,13919,31107,23852,65533,18128,30011,34917,
+22710,14108,15444,37505,34855,35061,14756,65533,65533,17727,26294,35139,
+16607,29101,33638,65533,19639,31555,31102,28597,37823,26678,38749,22293,
+38947,26046,27093,21458,15377,26422,13770,18682,65533,30728,37461,17394,
+17375,23032,65533,22155,36882,21953,17673,32383,28502,27313,13540,14138,
+65533,22207,36366,23405,25566,65533,25904,22061,21530,19581,22050,22046,
+32585,22901,34672,33047,40286,36120,30267,40005,30286,30649,37701,21554,
+33096,33527,22053,33074,33816,32957,21994,31074,22083,21526,13774,22021,
+22001,26353,13869,30004,22000,21946,21655,21874,40619,32090,65533,25245,
+38765,21652,36045,29174,37238,25596,25529,25598,21865,20890,13535,20903,
+21581,21790,21779,30310,36397,30129,32950,34820,65533,35015,33206,33820,
+17644,29444,33547,22139,37232,37384,29286,18254,16634,40029,25887,18675,
+29091,32398,40272,13687,27826,21351,14812,33325,21579,60739,14930,29556,
+19721,39917,65533,19547,25390,32037,14890,36872,21196,15988,13946,17897,
+30272,23280,22695,16575,22140,39819,23924,30292,40581,19681,65533,14331,
+24857,60787,22109,21044,13741,65533,40316,31830,39737,22494,23635,25811,
+60812,20990,23950,38659,40577,36940,31519,39682,23761,31651,25192,25397,
+39679,31695,39722,31870,65533,31810,31878,39957,31740,39689,65533,39982,
+40794,21875,23491,20477,40600,20466,21088,21201,22375,20566,22967,24082,
+38856,40363,36700,21609,38836,39232,38842,21292,24880,26924,21466,39946,
+40194,19515,38465,27008,20646,30022,39386,21107,60873,37209,38529,37212,
+60877,37201,25471,27338,22033,37262,30074,25221,29519,31856,60892,30422,
+39837,20010,33726,34882,60900,23626,27072,65533,65533,21023,24053,20174,
+27697,20281,21660,65533,21146,36226,13822,65533,13811,60918,27474,37244,
+40869,39831,38958,39092,39610,40616,40580,31508,60930,27642,34840,32632,
+60934,22048,36471,40787,60939,36308,36431,40476,36353,25218,36392,36469,
+31443,31294,30936,27882,35431,30215,40742,27854,34774,30147,30803,36108,
+29410,29553,35629,29442,29937,36075,34351,24506,34976,17591,60975,60978,
+35454,60981,24829,30311,39639,40260,37742,39823,34805,60989,65533,36087,
+29484,38689,39856,13782,29362,19463,31825,39242,24921,19460,40598,24957,
+61005,22367,24943,25254,25145,65533,14940,25058,21418,25444,26626,13778,
+23895,36826,61022,20697,30982,21298,38456,16485,61030,30718,61032,31938,
+31962,31277,32870,32867,32077,29957,29938,35220,33306,26380,32866,32859,
+29936,33027,30500,35209,30035,34729,34766,33224,34700,35401,36013,35651,
+30507,29944,34010,27058,36262,61068,35241,65533,28089,34753,29927,15835,
+29046,24740,24988,15569,65533,24695,61082,32625,24809,19326,34124,17077,
+29679,20917,13897,30780,26436,25311,20702,20737,13434,20750,39020,14147,
+33814,23426,34685,20914,20920,40244,20937,20943,20945,15580,20947,20915,
+65533,65533,20973,33741,26942,24443,21003,21030,21052,21173,21079,21140,
+21177,21189,31765,34114,21216,34317,21833,28377,21299,65533,26651,29653,
+24650,16042,14540,29149,17570,21357,21364,30694,21395,21408,21419,21422,
+29607,16217,29596,21441,21445,27721,20041,22526,21465,15019,21523,28793,
+21803,26199,27995,21613,21853,21647,21668,18342,21831,19693,21551,29719,
+21894,21929,65533,22071,26317,26276,65533,22093,22095,30961,22257,38791,
+21502,22272,22255,22253,27758,28811,22338,14001,22559,22698,13665,22752,
+22748,22779,23551,22339,37843,13729,22815,26790,14019,28249,23076,65533,
+34053,22985,23211,23139,14054,65533,14088,23190,29797,23251,24195,21200,
+23414,25992,23420,16388,18525,23539,23453,19728,23557,23571,29646,23572,
+23625,18653,23685,23785,23791,23947,23824,23832,23878,23738,24023,33532,
+14381,33415,14390,15298,24110,27274,65533,57647,21414,20151,65533,21416,
+24073,57656,24313,24315,14496,24316,26686,37915,24333,24434,37696,24487,
+23990,15711,24625,26245,14691,15815,13881,22416,31089,15936,24734,65533,
+24810,29860,20705,23200,24932,24898,24961,20980,24967,23466,25040,14642,
+24611,24924,25886,25483,14871,25656,25592,25825,25829,38011,14950,25658,
+14935,25933,28438,25989,25965,25951,65533,26037,19255,26065,16600,57771,
+26083,24543,26227,64018,39332,26370,26471,26466,26583,17641,26658,28240,
+37436,26625,27105,27147,26995,26819,26881,26880,14849,15232,26540,26977,
+17148,26934,27032,15265,33635,20624,27129,27293,15347,26545,27336,15373,
+27421,24798,27445,27508,14144,21537,27612,27703,27738,33318,27769,14053,
+15595,32655,26679,28054,27996,28284,28420,20935,65533,65533,33838,31180,
+28239,23185,28664,14093,28573,17749,37872,28484,28508,15694,28532,15675,
+28575,28747,28798,28839,65533,28876,28895,16644,15848,29108,29078,28971,
+28997,23176,29002,64072,29007,37730,28861,29198,37954,29205,22801,37955,
+29220,37697,29230,29248,26813,29269,29271,15957,26637,28477,29314,65533,
+29483,29480,29486,29647,29610,29641,29769,26147,14021,29687,29717,26883,
+29753,16087,29767,29668,29814,33721,29804,29812,37873,27180,29826,18771,
+29966,29982,37765,30029,30026,30055,30062,30094,29789,30110,30132,30210,
+30252,30289,30287,30319,58067,30352,33263,14328,30369,30373,30391,30412,
+30494,30502,30528,25775,30708,65533,26826,30895,30919,30931,38565,31022,
+30935,31028,30897,36792,34948,31110,35072,26882,31104,31036,31145,28202,
+16040,31174,31188,65533,21797,65533,14900,18389,65533,25741,36478,39602,
+14951,16365,13574,40302,38933,65533,17369,65533,25780,21731,65533,65533,
+14843,65533,36456,65533,65533,18443,16378,22643,65533,21881,65533,17338,
+65533,19124,33194,39157,25465,14846,36288,22177,25724,15939,65533,65533,
+65533,14738,14854,65533,65533,13500,27709,65533,65533,38314,65533,28992,
+65533,20822,20222,20616,65533,13459,20870,24130,20997,21031,21113,13651,
+21442,21343,65533,21823,65533,21976,13789,22049,65533,22100,65533,65533,
+14265,23745,23829,23894,14392,20097,24253,14612,25017,25232,25368,25690,
+25745,33133,33156,33171,26624,15292,29327,29389,29497,30018,30172,16320,
+16343,65533,30336,30348,16552,30777,16643,31377,31771,31981,32659,32686,
+65533,33535,22623,34482,17836,34699,35143,65533,35369,65533,36465,36528,
+65533,37214,37260,39182,39196,65533,65533,39809,40384,40339,40620,19857,
+65533,37818,40571,28809,29512,65533,31129,36791,65533,39234,169,8482,
+8230,8364,8364,8464,8364,8364,20059,20155,13630,23587,24401,24516,
+14586,25164,25909,27514,27701,27706,28780,29227,20012,29357,32594,31035,
+31993,32595,32770,32896,21341,34916,35265,35744,36125,38021,38264,38271,
+38376,38886,39029,39118,39134,39267,40060,40479,40644,27503,63751,20023,
+38429,25143,38050,11908,11925,11932,11941,11943,11946,11948,11950,11958,
+11964,11966,11978,25866,20029,28381,40270,37343,20250,20264,20392,20852,
+20892,20964,21153,21160,21307,21326,21457,21464,22242,22768,22788,22791,
+22834,22836,23398,23706,24198,24635,25993,26622,26628,26725,27982,28860,
+30005,32420,32428,32442,32455,32463,32479,32518,32567,33402,33487,33647,
+35270,35774,35810,36718,29713,31996,32205,26950,31433,30904,32956,36107,
+33014,32927,40647,19661,40393,40460,19518,13761,28314,33342,29977,18705,
+39532,39567,40857,31111,20004,20096,20103,20159,20203,20279,13388,20413,
+15944,20483,13437,13477,22789,20955,20988,20105,21136,21287,13767,21417,
+13649,21424,21539,13677,13682,13953,21651,21667,21684,21689,21712,21743,
+21784,21795,21800,13720,13733,13759,21975,13765,21708,33476,21945,39974,
+39606,33004,23580,33076,14231,22681,21096,13850,31666,23400,18432,19244,
+40743,18919,39967,39821,22011,13810,22153,23870,23880,15868,14351,23972,
+23993,14368,24357,24451,14600,14655,14669,24791,24893,23781,14729,25015,
+25039,14776,25132,25317,14840,22193,14851,25570,25595,25607,14923,25792,
+40863,14999,25990,15037,26111,26195,15090,26258,15138,26390,15170,26532,
+15192,26698,26756,15218,15217,15227,26889,26947,29276,26980,27039,27013,
+27094,15325,27237,27252,27249,27266,15340,27289,15346,27307,27317,27348,
+27382,27521,27585,27626,27765,27818,15563,27906,27910,27942,28033,15599,
+28068,28081,28181,28184,28201,28294,28347,28386,28378,40831,28452,28468,
+15686,28545,28606,15722,15733,29111,23705,15754,28716,15761,28752,28756,
+28783,28799,17345,13809,13902,15789,26237,31860,29837,32402,17667,34673,
+25537,30583,35210,15088,28815,40802,37830,37734,37519,34324,16784,26511,
+26654,14435,15129,33942,14818,33920,17262,38769,39323,18733,28439,32357,
+23855,15859,32164,33830,21637,23920,29583,20424,32743,29456,29496,29505,
+16041,29173,29665,16074,16081,29721,16098,16112,16116,16122,29907,16142,
+16211,30061,30066,30093,16252,30152,30285,30324,16348,30330,29064,22051,
+35200,16413,30531,16441,16453,13787,30616,16490,16495,30654,30667,30744,
+30748,30791,30801,30822,33864,31027,31026,16649,31121,31238,16743,16818,
+31420,33401,16836,31439,31451,16847,31586,31596,31611,31762,16992,17018,
+31867,31900,17036,31928,17044,36755,28864,32207,32212,32208,32253,32692,
+29343,17303,32800,32805,32814,32817,32852,22452,28832,32951,33001,17389,
+33036,33038,33042,33044,17409,15161,33110,17427,33148,17445,17453,33189,
+22511,33217,33252,33364,17551,33398,33482,33496,17584,33623,38505,33797,
+28917,33892,33928,17668,33982,34017,34040,34064,34104,34130,17723,34272,
+17783,34418,34450,34543,38469,17926,17943,34990,35071,35108,35217,35384,
+35476,35508,35921,36052,36082,36124,18328,36291,18413,36410,22356,22005,
+18487,36558,36578,36580,36589,36594,36801,36810,36812,36915,18605,39136,
+37395,18718,37416,37464,37483,37553,37550,37567,37603,37611,37629,37699,
+37764,37805,18757,18769,37911,37917,37933,37950,18794,37972,38009,38189,
+38306,18855,38388,38451,18917,18980,38720,18997,38834,38850,19172,39097,
+19225,39153,22596,39193,39223,39261,39266,19312,39365,19357,39484,39695,
+39785,39901,39921,39924,19565,39968,14191,40265,40702,22096,40381,40444,
+38134,36790,40625,40637,40646,38108,40674,40689,40696,40772,22359,29043,
+27113,14024,22433,29009,19620,38215,36798,36794,21982,34694,19994,19972,
+23309,13996,21373,13989,22682,22394,21722,29050,21024,15384,17762,23327,
+40784,40614,20962,21314,26285,22620,21843,15749,24928,18606,38845,24755,
+33828,38932,15147,15666,28801,23708,256,193,461,192,274,201,
+282,200,332,211,465,210,62245,7870,62247,7872,202,257,
+225,462,224,593,275,233,283,232,299,237,464,236,
+333,243,466,242,363,250,468,249,470,472,474,476,
+252,62276,7871,62278,7873,234,609,643,592,603,596,629,
+339,248,331,650,618,11933,11974,12003,20539,28158,40870,15817,
+34959,28791,23797,19232,36775,37366,29073,26393,29626,19216,30948,29698,
+20910,16393,27235,16931,34319,31274,38741,28749,21284,37876,30425,40871,
+30685,20131,20464,20668,20015,20247,40872,21556,32139,22674,22736,24210,
+24217,24514,26905,27203,27903,29184,29580,16091,23317,29881,35715,31379,
+31724,31939,32364,33528,34199,40873,34960,40874,36537,40875,36815,34143,
+39392,37409,40876,16497,17058,23066,39016,26475,17014,22333,34262,23446,
+40879,32347,17392,19506,17923,17830,17784,19831,17843,15253,18230,18244,
+19527,19520,18255,17882,19589,19719,19108,18081,26189,22267,32149,22813,
+15860,38708,23204,13861,23249,23479,23804,26478,34195,29793,29853,26343,
+28247,31178,15752,17603,17306,17718,23765,35577,23672,15634,23928,40882,
+29015,17752,19575,14712,13386,35532,20404,22975,33132,38998,16642,18107,
+16135,40883,16632,14294,18167,17773,14548,17761,17691,19849,19579,19830,
+17898,16328,13921,17630,17597,16877,
+};
+
+static pdf_cmap cmap_Adobe_CNS1_UCS2 = {
+	-1, "Adobe-CNS1-UCS2", "", 0, 0, 1,
+	{ {2,0,65535}, },
+	2018, 2018, (pdf_range*) cmap_Adobe_CNS1_UCS2_ranges,
+	14886, 14886, (unsigned short*) cmap_Adobe_CNS1_UCS2_table,
+};
+
+/* B5-H */
+
+static const pdf_range cmap_B5_H_ranges[] = {
+{32,377,13648},{41280,97,99},{41305,13,13743},{41309,133,128},
+{41377,337,162},{41462,6,0},{41464,25,249},{41536,249,256},
+{41633,373,319},{41792,249,413},{41889,105,476},{41917,9,503},
+{42048,249,595},{42145,373,658},{42304,249,752},{42401,373,815},
+{42560,249,909},{42657,373,972},{42816,249,1066},{42913,373,1129},
+{43072,249,1223},{43169,373,1286},{43328,249,1380},{43425,373,1443},
+{43584,249,1537},{43681,373,1600},{43840,249,1694},{43937,373,1757},
+{44096,249,1851},{44193,369,1914},{44286,0,2431},{44352,249,2007},
+{44449,373,2070},{44608,249,2164},{44705,373,2227},{44864,249,2321},
+{44961,185,2384},{45008,185,2432},{45120,249,2479},{45217,373,2542},
+{45376,249,2636},{45473,373,2699},{45632,249,2793},{45729,373,2856},
+{45888,249,2950},{45985,373,3013},{46144,249,3107},{46241,373,3170},
+{46400,249,3264},{46497,373,3327},{46656,249,3421},{46753,373,3484},
+{46912,249,3578},{47009,373,3641},{47168,249,3735},{47265,373,3798},
+{47424,249,3892},{47521,373,3955},{47680,249,4049},{47777,373,4112},
+{47936,249,4206},{48033,153,4269},{48072,217,4309},{48192,249,4364},
+{48289,373,4427},{48448,249,4521},{48545,373,4584},{48704,69,4678},
+{48722,0,4308},{48723,173,4696},{48801,373,4740},{48960,249,4834},
+{49057,373,4897},{49216,249,4991},{49313,373,5054},{49472,249,5148},
+{49569,37,5211},{49579,333,5222},{49728,249,5306},{49825,165,5369},
+{49867,0,5221},{49868,201,5411},{49984,129,5462},{50017,117,5496},
+{50081,93,5526},{50105,6,2},{50107,269,5552},{50240,85,5620},
+{50262,0,5495},{50263,157,5642},{50337,373,5682},{50496,249,5776},
+{50593,373,5839},{50752,249,5933},{51520,37,5996},{51530,0,628},
+{51531,129,6006},{51564,73,6040},{51617,113,6059},{51646,0,6039},
+{51647,181,6088},{51693,69,6135},{51776,249,6153},{51873,341,6216},
+{51959,0,6134},{51960,25,6302},{52032,249,6309},{52129,373,6372},
+{52288,249,6466},{52385,373,6529},{52544,249,6623},{52641,373,6686},
+{52800,249,6780},{52897,373,6843},{53056,249,6937},{53153,373,7000},
+{53312,249,7094},{53409,373,7157},{53568,249,7251},{53665,373,7314},
+{53824,249,7408},{53921,373,7471},{54080,249,7565},{54177,373,7628},
+{54336,249,7722},{54433,373,7785},{54592,249,7879},{54689,373,7942},
+{54848,249,8036},{54945,169,8099},{54988,0,8788},{54989,197,8143},
+{55104,229,8193},{55162,0,8889},{55163,13,8251},{55201,373,8255},
+{55360,249,8349},{55457,373,8412},{55616,249,8506},{55713,373,8569},
+{55872,249,8663},{55969,245,8726},{56031,0,8142},{56032,121,8789},
+{56128,249,8820},{56225,21,8883},{56231,349,8890},{56384,249,8978},
+{56481,373,9041},{56640,249,9135},{56737,361,9198},{56828,0,9089},
+{56829,5,9289},{56896,249,9291},{56993,373,9354},{57152,249,9448},
+{57249,373,9511},{57408,249,9605},{57505,373,9668},{57664,249,9762},
+{57761,373,9825},{57920,249,9919},{58017,373,9982},{58176,249,10076},
+{58273,373,10139},{58432,249,10233},{58529,373,10296},{58688,249,10390},
+{58785,373,10453},{58944,249,10547},{59041,373,10610},{59200,249,10704},
+{59297,373,10767},{59456,249,10861},{59553,5,10924},{59555,365,10927},
+{59712,213,11019},{59766,33,11074},{59809,373,11083},{59968,249,11177},
+{60065,373,11240},{60224,105,11334},{60251,141,11362},{60321,317,11398},
+{60401,0,10926},{60402,49,11478},{60480,249,11491},{60577,241,11554},
+{60638,0,11073},{60639,125,11615},{60736,249,11647},{60833,33,11710},
+{60842,337,11720},{60992,249,11805},{61089,293,11868},{61163,0,12308},
+{61164,73,11942},{61248,249,11961},{61345,373,12024},{61504,85,12118},
+{61526,0,11719},{61527,157,12140},{61601,165,12180},{61643,0,11361},
+{61644,201,12222},{61760,137,12273},{61795,29,12309},{61803,0,12640},
+{61804,73,12317},{61857,373,12336},{62016,157,12430},{62056,0,12783},
+{62057,85,12470},{62113,133,12492},{62147,237,12527},{62272,209,12587},
+{62325,37,12641},{62369,373,12651},{62528,149,12745},{62566,97,12784},
+{62625,77,12809},{62645,0,12526},{62646,281,12829},{62717,5,12901},
+{62784,249,12903},{62881,373,12966},{63040,137,13060},{63075,0,12900},
+{63076,105,13095},{63137,373,13122},{63296,249,13216},{63393,373,13279},
+{63552,249,13373},{63649,373,13436},{63808,217,13530},{63863,29,13586},
+{63905,137,13594},{63940,10,4},{63943,41,13630},{63954,13,13642},
+};
+
+static const unsigned short cmap_B5_H_table[7] = {
+248,247,5551,5550,13585,13629,13641,
+};
+
+static pdf_cmap cmap_B5_H = {
+	-1, "B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,41280,65278}, },
+	240, 240, (pdf_range*) cmap_B5_H_ranges,
+	7, 7, (unsigned short*) cmap_B5_H_table,
+};
+
+/* B5-V */
+
+static const pdf_range cmap_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+};
+
+static const unsigned short cmap_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_B5_V = {
+	-1, "B5-V", "B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_B5_V_table,
+};
+
+/* B5pc-H */
+
+static const pdf_range cmap_B5pc_H_ranges[] = {
+{32,377,1},{128,0,61},{253,9,96},{41280,97,99},
+{41305,13,13743},{41309,133,128},{41377,337,162},{41462,6,0},
+{41464,25,249},{41536,249,256},{41633,373,319},{41792,249,413},
+{41889,105,476},{41917,9,503},{41920,129,562},{42048,249,595},
+{42145,373,658},{42304,249,752},{42401,373,815},{42560,249,909},
+{42657,373,972},{42816,249,1066},{42913,373,1129},{43072,249,1223},
+{43169,373,1286},{43328,249,1380},{43425,373,1443},{43584,249,1537},
+{43681,373,1600},{43840,249,1694},{43937,373,1757},{44096,249,1851},
+{44193,369,1914},{44286,0,2431},{44352,249,2007},{44449,373,2070},
+{44608,249,2164},{44705,373,2227},{44864,249,2321},{44961,185,2384},
+{45008,185,2432},{45120,249,2479},{45217,373,2542},{45376,249,2636},
+{45473,373,2699},{45632,249,2793},{45729,373,2856},{45888,249,2950},
+{45985,373,3013},{46144,249,3107},{46241,373,3170},{46400,249,3264},
+{46497,373,3327},{46656,249,3421},{46753,373,3484},{46912,249,3578},
+{47009,373,3641},{47168,249,3735},{47265,373,3798},{47424,249,3892},
+{47521,373,3955},{47680,249,4049},{47777,373,4112},{47936,249,4206},
+{48033,153,4269},{48072,217,4309},{48192,249,4364},{48289,373,4427},
+{48448,249,4521},{48545,373,4584},{48704,69,4678},{48722,0,4308},
+{48723,173,4696},{48801,373,4740},{48960,249,4834},{49057,373,4897},
+{49216,249,4991},{49313,373,5054},{49472,249,5148},{49569,37,5211},
+{49579,333,5222},{49728,249,5306},{49825,165,5369},{49867,0,5221},
+{49868,201,5411},{49984,129,5462},{50017,117,5496},{50081,93,5526},
+{50105,6,2},{50107,269,5552},{50240,85,5620},{50262,0,5495},
+{50263,157,5642},{50337,373,5682},{50496,249,5776},{50593,373,5839},
+{50752,249,5933},{51520,37,5996},{51530,0,628},{51531,129,6006},
+{51564,73,6040},{51617,113,6059},{51646,0,6039},{51647,181,6088},
+{51693,69,6135},{51776,249,6153},{51873,341,6216},{51959,0,6134},
+{51960,25,6302},{52032,249,6309},{52129,373,6372},{52288,249,6466},
+{52385,373,6529},{52544,249,6623},{52641,373,6686},{52800,249,6780},
+{52897,373,6843},{53056,249,6937},{53153,373,7000},{53312,249,7094},
+{53409,373,7157},{53568,249,7251},{53665,373,7314},{53824,249,7408},
+{53921,373,7471},{54080,249,7565},{54177,373,7628},{54336,249,7722},
+{54433,373,7785},{54592,249,7879},{54689,373,7942},{54848,249,8036},
+{54945,169,8099},{54988,0,8788},{54989,197,8143},{55104,229,8193},
+{55162,0,8889},{55163,13,8251},{55201,373,8255},{55360,249,8349},
+{55457,373,8412},{55616,249,8506},{55713,373,8569},{55872,249,8663},
+{55969,245,8726},{56031,0,8142},{56032,121,8789},{56128,249,8820},
+{56225,21,8883},{56231,349,8890},{56384,249,8978},{56481,373,9041},
+{56640,249,9135},{56737,361,9198},{56828,0,9089},{56829,5,9289},
+{56896,249,9291},{56993,373,9354},{57152,249,9448},{57249,373,9511},
+{57408,249,9605},{57505,373,9668},{57664,249,9762},{57761,373,9825},
+{57920,249,9919},{58017,373,9982},{58176,249,10076},{58273,373,10139},
+{58432,249,10233},{58529,373,10296},{58688,249,10390},{58785,373,10453},
+{58944,249,10547},{59041,373,10610},{59200,249,10704},{59297,373,10767},
+{59456,249,10861},{59553,5,10924},{59555,365,10927},{59712,213,11019},
+{59766,33,11074},{59809,373,11083},{59968,249,11177},{60065,373,11240},
+{60224,105,11334},{60251,141,11362},{60321,317,11398},{60401,0,10926},
+{60402,49,11478},{60480,249,11491},{60577,241,11554},{60638,0,11073},
+{60639,125,11615},{60736,249,11647},{60833,33,11710},{60842,337,11720},
+{60992,249,11805},{61089,293,11868},{61163,0,12308},{61164,73,11942},
+{61248,249,11961},{61345,373,12024},{61504,85,12118},{61526,0,11719},
+{61527,157,12140},{61601,165,12180},{61643,0,11361},{61644,201,12222},
+{61760,137,12273},{61795,29,12309},{61803,0,12640},{61804,73,12317},
+{61857,373,12336},{62016,157,12430},{62056,0,12783},{62057,85,12470},
+{62113,133,12492},{62147,237,12527},{62272,209,12587},{62325,37,12641},
+{62369,373,12651},{62528,149,12745},{62566,97,12784},{62625,77,12809},
+{62645,0,12526},{62646,281,12829},{62717,5,12901},{62784,249,12903},
+{62881,373,12966},{63040,137,13060},{63075,0,12900},{63076,105,13095},
+{63137,373,13122},{63296,249,13216},{63393,373,13279},{63552,249,13373},
+{63649,373,13436},{63808,217,13530},{63863,29,13586},{63905,137,13594},
+{63940,10,4},{63943,41,13630},{63954,13,13642},
+};
+
+static const unsigned short cmap_B5pc_H_table[7] = {
+248,247,5551,5550,13585,13629,13641,
+};
+
+static pdf_cmap cmap_B5pc_H = {
+	-1, "B5pc-H", "", 0, 0, 3,
+	{ {1,0,128},{2,41280,64766},{1,253,255}, },
+	243, 243, (pdf_range*) cmap_B5pc_H_ranges,
+	7, 7, (unsigned short*) cmap_B5pc_H_table,
+};
+
+/* B5pc-V */
+
+static const pdf_range cmap_B5pc_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+};
+
+static const unsigned short cmap_B5pc_V_table[] = { 0 };
+
+static pdf_cmap cmap_B5pc_V = {
+	-1, "B5pc-V", "B5pc-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_B5pc_V_ranges,
+	0, 0, (unsigned short*) cmap_B5pc_V_table,
+};
+
+/* CNS-EUC-H */
+
+static const pdf_range cmap_CNS_EUC_H_ranges[] = {
+{32,377,13648},{41377,373,99},{41377,373,5996},{41377,373,99},
+{41633,373,193},{41633,373,6090},{41633,373,193},{41889,181,287},
+{41889,373,6184},{41889,181,287},{42145,373,333},{42145,373,6278},
+{42145,373,333},{42401,301,427},{42401,373,6372},{42401,301,427},
+{42478,9,503},{42478,9,503},{42657,117,506},{42657,373,6466},
+{42657,117,506},{42913,0,595},{42913,373,6560},{42913,0,595},
+{42914,9,536},{42914,9,536},{42917,0,596},{42917,6,0},
+{42918,6,2},{42919,6,4},{42920,0,540},{42921,13,603},
+{42921,13,603},{42925,9,541},{42925,9,541},{42928,0,607},
+{42928,6,6},{42929,6,8},{42930,6,10},{42931,6,12},
+{42932,6,14},{42933,6,16},{42934,6,18},{42935,0,545},
+{42936,5,612},{42936,5,612},{42938,0,546},{42938,6,20},
+{42939,6,22},{42940,6,24},{42941,6,26},{42942,6,28},
+{42943,0,6005},{42944,5,634},{42944,5,634},{42946,0,548},
+{42946,0,548},{42947,13,636},{42947,13,636},{42951,0,549},
+{42951,0,549},{42952,13,642},{42952,13,642},{42956,0,6006},
+{42956,6,30},{42957,6,32},{42958,0,550},{42959,5,648},
+{42959,5,648},{42961,5,652},{42961,5,652},{42963,9,551},
+{42963,9,551},{42966,9,654},{42966,9,654},{42969,5,554},
+{42969,5,554},{42971,0,6007},{42971,0,6007},{42972,13,720},
+{42972,13,720},{42976,0,725},{42976,6,34},{42977,0,556},
+{42978,13,726},{42978,13,726},{42982,0,557},{42982,0,557},
+{42983,25,730},{42983,25,730},{42990,0,6026},{42990,0,6026},
+{42991,13,737},{42991,13,737},{42995,0,6028},{42995,0,6028},
+{42996,17,741},{42996,17,741},{43001,0,6029},{43001,0,6029},
+{43002,13,746},{43002,13,746},{43006,0,854},{43006,0,854},
+{43169,21,855},{43169,373,6654},{43169,21,855},{43175,0,862},
+{43175,6,36},{43176,0,866},{43177,5,558},{43177,5,558},
+{43179,29,867},{43179,29,867},{43187,0,6066},{43187,0,6066},
+{43188,9,875},{43188,9,875},{43191,13,1014},{43191,13,1014},
+{43195,0,6162},{43195,0,6162},{43196,9,1018},{43196,9,1018},
+{43199,17,1022},{43199,17,1022},{43204,33,1029},{43204,33,1029},
+{43213,0,6163},{43213,6,38},{43214,0,6168},{43215,13,1039},
+{43215,13,1039},{43219,0,6169},{43219,0,6169},{43220,21,1288},
+{43220,21,1288},{43226,0,6375},{43226,0,6375},{43227,29,1294},
+{43227,29,1294},{43235,0,560},{43235,6,40},{43236,0,1307},
+{43237,9,1312},{43237,9,1312},{43240,13,1686},{43240,13,1686},
+{43244,0,561},{43244,0,561},{43245,13,1695},{43245,13,1695},
+{43249,41,2086},{43249,41,2086},{43260,9,2549},{43260,9,2549},
+{43425,0,7731},{43425,373,6748},{43425,6,42},{43426,6,44},
+{43427,0,7732},{43428,5,2553},{43428,5,2553},{43430,21,3041},
+{43430,21,3041},{43436,9,3515},{43436,9,3515},{43439,0,9056},
+{43439,6,46},{43440,0,9746},{43441,9,3963},{43441,9,3963},
+{43444,5,4352},{43444,5,4352},{43446,0,4745},{43446,0,4745},
+{43447,5,5042},{43447,5,5042},{43449,0,12045},{43449,0,12045},
+{43681,373,6842},{43937,373,6936},{44193,373,7030},{44449,373,7124},
+{44705,373,7218},{44961,373,7312},{45217,373,7406},{45473,373,7500},
+{45729,373,7594},{45985,373,7688},{46241,373,7782},{46497,373,7876},
+{46753,373,7970},{47009,373,8064},{47265,373,8158},{47521,373,8252},
+{47777,373,8346},{48033,373,8440},{48289,373,8534},{48545,373,8628},
+{48801,373,8722},{49057,373,8816},{49313,373,8910},{49569,373,9004},
+{49825,129,562},{49825,373,9098},{49825,129,562},{50081,373,9192},
+{50337,373,595},{50337,373,9286},{50337,373,595},{50593,373,689},
+{50593,373,9380},{50593,373,689},{50849,373,783},{50849,373,9474},
+{50849,373,783},{51105,373,877},{51105,373,9568},{51105,373,877},
+{51361,373,971},{51361,373,9662},{51361,373,971},{51617,373,1065},
+{51617,373,9756},{51617,373,1065},{51873,373,1159},{51873,373,9850},
+{51873,373,1159},{52129,373,1253},{52129,373,9944},{52129,373,1253},
+{52385,373,1347},{52385,373,10038},{52385,373,1347},{52641,373,1441},
+{52641,373,10132},{52641,373,1441},{52897,373,1535},{52897,373,10226},
+{52897,373,1535},{53153,373,1629},{53153,373,10320},{53153,373,1629},
+{53409,373,1723},{53409,373,10414},{53409,373,1723},{53665,373,1817},
+{53665,373,10508},{53665,373,1817},{53921,373,1911},{53921,373,10602},
+{53921,373,1911},{54177,373,2005},{54177,373,10696},{54177,373,2005},
+{54433,373,2099},{54433,373,10790},{54433,373,2099},{54689,373,2193},
+{54689,373,10884},{54689,373,2193},{54945,373,2287},{54945,373,10978},
+{54945,373,2287},{55201,373,2381},{55201,373,11072},{55201,373,2381},
+{55457,373,2475},{55457,373,11166},{55457,373,2475},{55713,373,2569},
+{55713,373,11260},{55713,373,2569},{55969,373,2663},{55969,373,11354},
+{55969,373,2663},{56225,373,2757},{56225,373,11448},{56225,373,2757},
+{56481,373,2851},{56481,373,11542},{56481,373,2851},{56737,373,2945},
+{56737,373,11636},{56737,373,2945},{56993,373,3039},{56993,373,11730},
+{56993,373,3039},{57249,373,3133},{57249,373,11824},{57249,373,3133},
+{57505,373,3227},{57505,373,11918},{57505,373,3227},{57761,373,3321},
+{57761,373,12012},{57761,373,3321},{58017,373,3415},{58017,373,12106},
+{58017,373,3415},{58273,373,3509},{58273,373,12200},{58273,373,3509},
+{58529,373,3603},{58529,373,12294},{58529,373,3603},{58785,373,3697},
+{58785,373,12388},{58785,373,3697},{59041,373,3791},{59041,373,12482},
+{59041,373,3791},{59297,373,3885},{59297,373,12576},{59297,373,3885},
+{59553,373,3979},{59553,373,12670},{59553,373,3979},{59809,373,4073},
+{59809,373,12764},{59809,373,4073},{60065,373,4167},{60065,373,12858},
+{60065,373,4167},{60321,373,4261},{60321,373,12952},{60321,373,4261},
+{60577,373,4355},{60577,373,13046},{60577,373,4355},{60833,373,4449},
+{60833,373,13140},{60833,373,4449},{61089,373,4543},{61089,373,13234},
+{61089,373,4543},{61345,373,4637},{61345,373,13328},{61345,373,4637},
+{61601,373,4731},{61601,373,13422},{61601,373,4731},{61857,373,4825},
+{61857,373,13516},{61857,373,4825},{62113,373,4919},{62113,141,13610},
+{62113,373,4919},{62369,373,5013},{62369,373,5013},{62625,373,5107},
+{62625,373,5107},{62881,373,5201},{62881,373,5201},{63137,373,5295},
+{63137,373,5295},{63393,373,5389},{63393,373,5389},{63649,373,5483},
+{63649,373,5483},{63905,373,5577},{63905,373,5577},{64161,373,5671},
+{64161,373,5671},{64417,373,5765},{64417,373,5765},{64673,373,5859},
+{64673,373,5859},{64929,169,5953},{64929,169,5953},
+};
+
+static const unsigned short cmap_CNS_EUC_H_table[48] = {
+596,539,539,602,602,540,607,5998,5998,608,608,610,
+610,544,544,611,611,5999,5999,545,546,6000,6000,547,
+547,614,614,633,633,6005,6006,646,646,550,725,556,
+862,866,6163,6168,560,1307,7731,2552,2552,7732,9056,9746,
+};
+
+static pdf_cmap cmap_CNS_EUC_H = {
+	-1, "CNS-EUC-H", "", 0, 0, 5,
+	{ {1,0,128},{4,41377,65278},{4,41377,65278},{4,41377,65278},{2,41377,65278}, },
+	371, 371, (pdf_range*) cmap_CNS_EUC_H_ranges,
+	48, 48, (unsigned short*) cmap_CNS_EUC_H_table,
+};
+
+/* CNS-EUC-V */
+
+static const pdf_range cmap_CNS_EUC_V_ranges[] = {
+{32,377,13648},{41377,41,99},{41377,373,5996},{41377,41,99},
+{41388,0,13646},{41388,0,13646},{41389,53,111},{41389,53,111},
+{41403,0,124},{41403,6,0},{41404,6,2},{41405,0,126},
+{41406,5,130},{41406,5,130},{41408,5,130},{41408,5,130},
+{41410,5,134},{41410,5,134},{41412,5,134},{41412,5,134},
+{41414,5,138},{41414,5,138},{41416,5,138},{41416,5,138},
+{41418,5,142},{41418,5,142},{41420,5,142},{41420,5,142},
+{41422,5,146},{41422,5,146},{41424,5,146},{41424,5,146},
+{41426,5,150},{41426,5,150},{41428,5,150},{41428,5,150},
+{41430,5,154},{41430,5,154},{41432,5,154},{41432,5,154},
+{41434,5,158},{41434,5,158},{41436,137,158},{41436,137,158},
+{41633,137,193},{41633,373,6090},{41633,137,193},{41668,0,13647},
+{41668,0,13647},{41669,229,229},{41669,229,229},{41889,181,287},
+{41889,373,6184},{41889,181,287},{42145,373,333},{42145,373,6278},
+{42145,373,333},{42401,301,427},{42401,373,6372},{42401,301,427},
+{42478,9,503},{42478,9,503},{42657,117,506},{42657,373,6466},
+{42657,117,506},{42913,0,595},{42913,373,6560},{42913,0,595},
+{42914,9,536},{42914,9,536},{42917,0,596},{42917,6,4},
+{42918,6,6},{42919,6,8},{42920,0,540},{42921,13,603},
+{42921,13,603},{42925,9,541},{42925,9,541},{42928,0,607},
+{42928,6,10},{42929,6,12},{42930,6,14},{42931,6,16},
+{42932,6,18},{42933,6,20},{42934,6,22},{42935,0,545},
+{42936,5,612},{42936,5,612},{42938,0,546},{42938,6,24},
+{42939,6,26},{42940,6,28},{42941,6,30},{42942,6,32},
+{42943,0,6005},{42944,5,634},{42944,5,634},{42946,0,548},
+{42946,0,548},{42947,13,636},{42947,13,636},{42951,0,549},
+{42951,0,549},{42952,13,642},{42952,13,642},{42956,0,6006},
+{42956,6,34},{42957,6,36},{42958,0,550},{42959,5,648},
+{42959,5,648},{42961,5,652},{42961,5,652},{42963,9,551},
+{42963,9,551},{42966,9,654},{42966,9,654},{42969,5,554},
+{42969,5,554},{42971,0,6007},{42971,0,6007},{42972,13,720},
+{42972,13,720},{42976,0,725},{42976,6,38},{42977,0,556},
+{42978,13,726},{42978,13,726},{42982,0,557},{42982,0,557},
+{42983,25,730},{42983,25,730},{42990,0,6026},{42990,0,6026},
+{42991,13,737},{42991,13,737},{42995,0,6028},{42995,0,6028},
+{42996,17,741},{42996,17,741},{43001,0,6029},{43001,0,6029},
+{43002,13,746},{43002,13,746},{43006,0,854},{43006,0,854},
+{43169,21,855},{43169,373,6654},{43169,21,855},{43175,0,862},
+{43175,6,40},{43176,0,866},{43177,5,558},{43177,5,558},
+{43179,29,867},{43179,29,867},{43187,0,6066},{43187,0,6066},
+{43188,9,875},{43188,9,875},{43191,13,1014},{43191,13,1014},
+{43195,0,6162},{43195,0,6162},{43196,9,1018},{43196,9,1018},
+{43199,17,1022},{43199,17,1022},{43204,33,1029},{43204,33,1029},
+{43213,0,6163},{43213,6,42},{43214,0,6168},{43215,13,1039},
+{43215,13,1039},{43219,0,6169},{43219,0,6169},{43220,21,1288},
+{43220,21,1288},{43226,0,6375},{43226,0,6375},{43227,29,1294},
+{43227,29,1294},{43235,0,560},{43235,6,44},{43236,0,1307},
+{43237,9,1312},{43237,9,1312},{43240,13,1686},{43240,13,1686},
+{43244,0,561},{43244,0,561},{43245,13,1695},{43245,13,1695},
+{43249,41,2086},{43249,41,2086},{43260,9,2549},{43260,9,2549},
+{43425,0,7731},{43425,373,6748},{43425,6,46},{43426,6,48},
+{43427,0,7732},{43428,5,2553},{43428,5,2553},{43430,21,3041},
+{43430,21,3041},{43436,9,3515},{43436,9,3515},{43439,0,9056},
+{43439,6,50},{43440,0,9746},{43441,9,3963},{43441,9,3963},
+{43444,5,4352},{43444,5,4352},{43446,0,4745},{43446,0,4745},
+{43447,5,5042},{43447,5,5042},{43449,0,12045},{43449,0,12045},
+{43681,373,6842},{43937,373,6936},{44193,373,7030},{44449,373,7124},
+{44705,373,7218},{44961,373,7312},{45217,373,7406},{45473,373,7500},
+{45729,373,7594},{45985,373,7688},{46241,373,7782},{46497,373,7876},
+{46753,373,7970},{47009,373,8064},{47265,373,8158},{47521,373,8252},
+{47777,373,8346},{48033,373,8440},{48289,373,8534},{48545,373,8628},
+{48801,373,8722},{49057,373,8816},{49313,373,8910},{49569,373,9004},
+{49825,129,562},{49825,373,9098},{49825,129,562},{50081,373,9192},
+{50337,373,595},{50337,373,9286},{50337,373,595},{50593,373,689},
+{50593,373,9380},{50593,373,689},{50849,373,783},{50849,373,9474},
+{50849,373,783},{51105,373,877},{51105,373,9568},{51105,373,877},
+{51361,373,971},{51361,373,9662},{51361,373,971},{51617,373,1065},
+{51617,373,9756},{51617,373,1065},{51873,373,1159},{51873,373,9850},
+{51873,373,1159},{52129,373,1253},{52129,373,9944},{52129,373,1253},
+{52385,373,1347},{52385,373,10038},{52385,373,1347},{52641,373,1441},
+{52641,373,10132},{52641,373,1441},{52897,373,1535},{52897,373,10226},
+{52897,373,1535},{53153,373,1629},{53153,373,10320},{53153,373,1629},
+{53409,373,1723},{53409,373,10414},{53409,373,1723},{53665,373,1817},
+{53665,373,10508},{53665,373,1817},{53921,373,1911},{53921,373,10602},
+{53921,373,1911},{54177,373,2005},{54177,373,10696},{54177,373,2005},
+{54433,373,2099},{54433,373,10790},{54433,373,2099},{54689,373,2193},
+{54689,373,10884},{54689,373,2193},{54945,373,2287},{54945,373,10978},
+{54945,373,2287},{55201,373,2381},{55201,373,11072},{55201,373,2381},
+{55457,373,2475},{55457,373,11166},{55457,373,2475},{55713,373,2569},
+{55713,373,11260},{55713,373,2569},{55969,373,2663},{55969,373,11354},
+{55969,373,2663},{56225,373,2757},{56225,373,11448},{56225,373,2757},
+{56481,373,2851},{56481,373,11542},{56481,373,2851},{56737,373,2945},
+{56737,373,11636},{56737,373,2945},{56993,373,3039},{56993,373,11730},
+{56993,373,3039},{57249,373,3133},{57249,373,11824},{57249,373,3133},
+{57505,373,3227},{57505,373,11918},{57505,373,3227},{57761,373,3321},
+{57761,373,12012},{57761,373,3321},{58017,373,3415},{58017,373,12106},
+{58017,373,3415},{58273,373,3509},{58273,373,12200},{58273,373,3509},
+{58529,373,3603},{58529,373,12294},{58529,373,3603},{58785,373,3697},
+{58785,373,12388},{58785,373,3697},{59041,373,3791},{59041,373,12482},
+{59041,373,3791},{59297,373,3885},{59297,373,12576},{59297,373,3885},
+{59553,373,3979},{59553,373,12670},{59553,373,3979},{59809,373,4073},
+{59809,373,12764},{59809,373,4073},{60065,373,4167},{60065,373,12858},
+{60065,373,4167},{60321,373,4261},{60321,373,12952},{60321,373,4261},
+{60577,373,4355},{60577,373,13046},{60577,373,4355},{60833,373,4449},
+{60833,373,13140},{60833,373,4449},{61089,373,4543},{61089,373,13234},
+{61089,373,4543},{61345,373,4637},{61345,373,13328},{61345,373,4637},
+{61601,373,4731},{61601,373,13422},{61601,373,4731},{61857,373,4825},
+{61857,373,13516},{61857,373,4825},{62113,373,4919},{62113,141,13610},
+{62113,373,4919},{62369,373,5013},{62369,373,5013},{62625,373,5107},
+{62625,373,5107},{62881,373,5201},{62881,373,5201},{63137,373,5295},
+{63137,373,5295},{63393,373,5389},{63393,373,5389},{63649,373,5483},
+{63649,373,5483},{63905,373,5577},{63905,373,5577},{64161,373,5671},
+{64161,373,5671},{64417,373,5765},{64417,373,5765},{64673,373,5859},
+{64673,373,5859},{64929,169,5953},{64929,169,5953},
+};
+
+static const unsigned short cmap_CNS_EUC_V_table[52] = {
+124,126,126,126,596,539,539,602,602,540,607,5998,
+5998,608,608,610,610,544,544,611,611,5999,5999,545,
+546,6000,6000,547,547,614,614,633,633,6005,6006,646,
+646,550,725,556,862,866,6163,6168,560,1307,7731,2552,
+2552,7732,9056,9746,
+};
+
+static pdf_cmap cmap_CNS_EUC_V = {
+	-1, "CNS-EUC-V", "", 0, 1, 5,
+	{ {1,0,128},{4,41377,65278},{4,41377,65278},{4,41377,65278},{2,41377,65278}, },
+	415, 415, (pdf_range*) cmap_CNS_EUC_V_ranges,
+	52, 52, (unsigned short*) cmap_CNS_EUC_V_table,
+};
+
+/* CNS1-H */
+
+static const pdf_range cmap_CNS1_H_ranges[] = {
+{8481,373,99},{8737,373,193},{8993,181,287},{9249,373,333},
+{9505,301,427},{9582,9,503},{9761,117,506},{10017,0,595},
+{10018,9,536},{10021,14,0},{10025,13,603},{10029,9,541},
+{10032,30,4},{10040,5,612},{10042,22,12},{10048,5,634},
+{10050,0,548},{10051,13,636},{10055,0,549},{10056,13,642},
+{10060,10,18},{10063,5,648},{10065,5,652},{10067,9,551},
+{10070,9,654},{10073,5,554},{10075,0,6007},{10076,13,720},
+{10080,6,21},{10082,13,726},{10086,0,557},{10087,25,730},
+{10094,0,6026},{10095,13,737},{10099,0,6028},{10100,17,741},
+{10105,0,6029},{10106,13,746},{10110,0,854},{10273,21,855},
+{10279,6,23},{10281,5,558},{10283,29,867},{10291,0,6066},
+{10292,9,875},{10295,13,1014},{10299,0,6162},{10300,9,1018},
+{10303,17,1022},{10308,33,1029},{10317,6,25},{10319,13,1039},
+{10323,0,6169},{10324,21,1288},{10330,0,6375},{10331,29,1294},
+{10339,6,27},{10341,9,1312},{10344,13,1686},{10348,0,561},
+{10349,13,1695},{10353,41,2086},{10364,9,2549},{10529,10,29},
+{10532,5,2553},{10534,21,3041},{10540,9,3515},{10543,6,32},
+{10545,9,3963},{10548,5,4352},{10550,0,4745},{10551,5,5042},
+{10553,0,12045},{16929,129,562},{17441,373,595},{17697,373,689},
+{17953,373,783},{18209,373,877},{18465,373,971},{18721,373,1065},
+{18977,373,1159},{19233,373,1253},{19489,373,1347},{19745,373,1441},
+{20001,373,1535},{20257,373,1629},{20513,373,1723},{20769,373,1817},
+{21025,373,1911},{21281,373,2005},{21537,373,2099},{21793,373,2193},
+{22049,373,2287},{22305,373,2381},{22561,373,2475},{22817,373,2569},
+{23073,373,2663},{23329,373,2757},{23585,373,2851},{23841,373,2945},
+{24097,373,3039},{24353,373,3133},{24609,373,3227},{24865,373,3321},
+{25121,373,3415},{25377,373,3509},{25633,373,3603},{25889,373,3697},
+{26145,373,3791},{26401,373,3885},{26657,373,3979},{26913,373,4073},
+{27169,373,4167},{27425,373,4261},{27681,373,4355},{27937,373,4449},
+{28193,373,4543},{28449,373,4637},{28705,373,4731},{28961,373,4825},
+{29217,373,4919},{29473,373,5013},{29729,373,5107},{29985,373,5201},
+{30241,373,5295},{30497,373,5389},{30753,373,5483},{31009,373,5577},
+{31265,373,5671},{31521,373,5765},{31777,373,5859},{32033,169,5953},
+};
+
+static const unsigned short cmap_CNS1_H_table[34] = {
+596,539,602,540,607,5998,608,610,544,611,5999,545,
+546,6000,547,614,633,6005,6006,646,550,725,556,862,
+866,6163,6168,560,1307,7731,2552,7732,9056,9746,
+};
+
+static pdf_cmap cmap_CNS1_H = {
+	-1, "CNS1-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	132, 132, (pdf_range*) cmap_CNS1_H_ranges,
+	34, 34, (unsigned short*) cmap_CNS1_H_table,
+};
+
+/* CNS1-V */
+
+static const pdf_range cmap_CNS1_V_ranges[] = {
+{8492,0,13646},{8507,0,124},{8509,0,126},{8510,5,130},
+{8514,5,134},{8518,5,138},{8522,5,142},{8526,5,146},
+{8530,5,150},{8534,5,154},{8538,5,158},{8772,0,13647},
+};
+
+static const unsigned short cmap_CNS1_V_table[] = { 0 };
+
+static pdf_cmap cmap_CNS1_V = {
+	-1, "CNS1-V", "CNS1-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_CNS1_V_ranges,
+	0, 0, (unsigned short*) cmap_CNS1_V_table,
+};
+
+/* CNS2-H */
+
+static const pdf_range cmap_CNS2_H_ranges[] = {
+{8481,373,5996},{8737,373,6090},{8993,373,6184},{9249,373,6278},
+{9505,373,6372},{9761,373,6466},{10017,373,6560},{10273,373,6654},
+{10529,373,6748},{10785,373,6842},{11041,373,6936},{11297,373,7030},
+{11553,373,7124},{11809,373,7218},{12065,373,7312},{12321,373,7406},
+{12577,373,7500},{12833,373,7594},{13089,373,7688},{13345,373,7782},
+{13601,373,7876},{13857,373,7970},{14113,373,8064},{14369,373,8158},
+{14625,373,8252},{14881,373,8346},{15137,373,8440},{15393,373,8534},
+{15649,373,8628},{15905,373,8722},{16161,373,8816},{16417,373,8910},
+{16673,373,9004},{16929,373,9098},{17185,373,9192},{17441,373,9286},
+{17697,373,9380},{17953,373,9474},{18209,373,9568},{18465,373,9662},
+{18721,373,9756},{18977,373,9850},{19233,373,9944},{19489,373,10038},
+{19745,373,10132},{20001,373,10226},{20257,373,10320},{20513,373,10414},
+{20769,373,10508},{21025,373,10602},{21281,373,10696},{21537,373,10790},
+{21793,373,10884},{22049,373,10978},{22305,373,11072},{22561,373,11166},
+{22817,373,11260},{23073,373,11354},{23329,373,11448},{23585,373,11542},
+{23841,373,11636},{24097,373,11730},{24353,373,11824},{24609,373,11918},
+{24865,373,12012},{25121,373,12106},{25377,373,12200},{25633,373,12294},
+{25889,373,12388},{26145,373,12482},{26401,373,12576},{26657,373,12670},
+{26913,373,12764},{27169,373,12858},{27425,373,12952},{27681,373,13046},
+{27937,373,13140},{28193,373,13234},{28449,373,13328},{28705,373,13422},
+{28961,373,13516},{29217,141,13610},
+};
+
+static const unsigned short cmap_CNS2_H_table[] = { 0 };
+
+static pdf_cmap cmap_CNS2_H = {
+	-1, "CNS2-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	82, 82, (pdf_range*) cmap_CNS2_H_ranges,
+	0, 0, (unsigned short*) cmap_CNS2_H_table,
+};
+
+/* CNS2-V */
+
+static const pdf_range cmap_CNS2_V_ranges[] = { {0,1,0}
+};
+
+static const unsigned short cmap_CNS2_V_table[] = { 0 };
+
+static pdf_cmap cmap_CNS2_V = {
+	-1, "CNS2-V", "CNS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	0, 0, (pdf_range*) cmap_CNS2_V_ranges,
+	0, 0, (unsigned short*) cmap_CNS2_V_table,
+};
+
+/* ETHK-B5-H */
+
+static const pdf_range cmap_ETHK_B5_H_ranges[] = {
+{32,377,1},{34624,149,18965},{34663,73,19003},{34682,17,19088},
+{34721,249,19093},{34880,85,17609},{34902,161,18785},{34977,29,18826},
+{34985,5,18844},{35136,5,17716},{35139,0,17718},{35142,13,17719},
+{35148,6,0},{35150,9,17724},{35153,0,17306},{35154,177,17727},
+{35233,17,17772},{35238,0,17314},{35243,14,2},{35248,9,17779},
+{35253,41,17782},{35265,9,17793},{35269,37,17796},{35279,0,17340},
+{35280,33,17806},{35289,18,6},{35294,9,17817},{35297,10,11},
+{35300,21,17821},{35306,5,17317},{35308,53,17827},{35322,0,17321},
+{35323,13,17841},{35392,6,14},{35395,37,17163},{35405,0,17846},
+{35406,45,17174},{35418,0,17847},{35419,9,17187},{35422,0,17848},
+{35423,13,17191},{35428,49,17196},{35441,0,17849},{35442,9,17210},
+{35446,6,16},{35448,5,17216},{35450,18,18},{35489,25,17223},
+{35496,0,17854},{35497,5,17231},{35500,17,17234},{35506,13,17240},
+{35510,14,23},{35515,49,17249},{35529,9,17263},{35532,0,17857},
+{35534,29,17268},{35542,5,17858},{35544,17,17278},{35551,25,17285},
+{35558,6,27},{35560,49,17861},{35574,33,17874},{35648,0,17883},
+{35649,5,17292},{35651,5,17884},{35653,30,29},{35661,13,17298},
+{35665,9,17890},{35669,9,17893},{35672,14,37},{35676,17,17897},
+{35681,0,17319},{35682,21,17902},{35688,0,17324},{35689,85,17908},
+{35745,121,17930},{35776,113,17631},{35806,125,17660},{35904,133,18849},
+{35938,0,19022},{35939,109,18883},{36001,17,18911},{36007,121,18916},
+{36041,13,18947},{36046,49,18951},{36059,6,41},{36061,29,19024},
+{36070,97,19032},{36160,0,19057},{36162,117,19058},{36192,5,17961},
+{36194,0,17338},{36195,17,17963},{36200,10,43},{36203,9,17968},
+{36206,0,17342},{36207,25,17971},{36214,0,17343},{36215,9,17978},
+{36218,10,46},{36221,5,17982},{36257,13,17984},{36261,0,17346},
+{36262,5,17988},{36264,6,49},{36266,45,17990},{36278,0,17351},
+{36279,45,18002},{36291,0,17352},{36292,213,18014},{36346,0,17401},
+{36347,13,18068},{36416,17,14123},{36421,0,18072},{36422,137,14128},
+{36457,6,51},{36459,5,18073},{36461,5,14166},{36463,0,11752},
+{36464,21,14169},{36470,0,18075},{36471,13,14175},{36475,0,18076},
+{36476,5,14180},{36478,0,289},{36513,17,14182},{36518,0,18077},
+{36519,13,14187},{36523,0,4203},{36524,29,14192},{36532,0,4902},
+{36533,9,14201},{36536,0,18078},{36537,61,14205},{36553,0,18079},
+{36554,9,14221},{36557,0,1643},{36558,5,14225},{36560,0,4910},
+{36561,77,14228},{36581,0,18080},{36582,33,14248},{36591,0,18081},
+{36592,21,14257},{36598,0,18082},{36599,29,14264},{36672,89,14272},
+{36695,10,53},{36698,17,14297},{36703,0,18084},{36704,25,14302},
+{36711,10,56},{36714,13,14311},{36718,0,8877},{36719,37,14316},
+{36729,0,18086},{36730,17,14327},{36769,57,14332},{36784,0,18087},
+{36785,77,14348},{36805,10,59},{36808,5,14369},{36810,10,62},
+{36813,49,14374},{36826,0,18091},{36827,29,14387},{36835,0,18092},
+{36836,93,14396},{36860,10,65},{36928,81,14422},{36949,0,18094},
+{36950,21,14444},{36956,9,18095},{36959,53,14451},{36973,10,68},
+{36976,37,14467},{36986,0,14057},{36987,13,14477},{37025,17,14481},
+{37030,0,18099},{37031,65,14486},{37048,0,18100},{37049,137,14503},
+{37084,0,5009},{37085,77,14539},{37105,0,5796},{37106,49,14560},
+{37184,145,14573},{37221,0,18101},{37222,29,14610},{37230,0,18102},
+{37231,57,14618},{37246,0,18103},{37281,6,71},{37283,109,14634},
+{37311,0,12402},{37312,29,14663},{37320,0,18105},{37321,213,14672},
+{37440,13,14726},{37444,0,14728},{37445,121,14731},{37476,0,18106},
+{37477,29,14763},{37485,0,18107},{37486,65,14772},{37537,53,14789},
+{37551,5,281},{37553,6,73},{37555,81,14803},{37576,0,16300},
+{37577,29,14825},{37585,0,10620},{37586,73,14834},{37605,0,18108},
+{37606,45,14853},{37618,0,18109},{37619,45,14865},{37696,157,14877},
+{37736,0,18110},{37737,85,14917},{37793,33,14939},{37802,0,18111},
+{37803,89,14948},{37826,0,18112},{37827,133,14971},{37861,0,18113},
+{37862,5,15005},{37864,0,18114},{37865,5,15008},{37867,0,18115},
+{37868,73,15010},{37952,21,15029},{37958,6,75},{37960,193,15036},
+{38009,0,18117},{38010,17,15086},{38049,161,15091},{38090,6,77},
+{38092,201,15134},{38208,49,15185},{38221,0,18119},{38222,45,15198},
+{38234,0,18120},{38235,13,15210},{38239,0,18121},{38240,121,15215},
+{38305,145,15246},{38342,0,18122},{38343,69,15283},{38361,0,6171},
+{38362,145,15302},{38464,13,15339},{38468,0,15919},{38469,45,15344},
+{38481,0,18123},{38482,93,15357},{38506,0,18124},{38507,77,15382},
+{38561,201,15402},{38612,0,18125},{38613,93,15453},{38637,0,15478},
+{38638,53,15478},{38652,0,11044},{38653,5,15493},{38720,249,15495},
+{38817,373,15558},{38976,13,15652},{38980,5,18126},{38982,161,15658},
+{39023,0,18128},{39024,17,15700},{39029,5,18129},{39031,0,15705},
+{39032,5,18131},{39034,0,15706},{39035,13,18133},{39073,5,18137},
+{39075,0,15707},{39076,41,18139},{39087,0,15708},{39088,13,18150},
+{39092,34,79},{39101,5,15711},{39103,9,18158},{39106,14,88},
+{39110,5,15715},{39112,37,18163},{39122,0,17357},{39123,17,18173},
+{39128,5,17358},{39130,6,92},{39132,9,18179},{39135,0,17364},
+{39136,9,18182},{39139,0,15717},{39140,9,18185},{39143,0,15718},
+{39144,17,18188},{39149,0,15719},{39150,5,18193},{39152,14,94},
+{39156,5,17365},{39158,21,18197},{39164,10,98},{39232,5,18204},
+{39234,22,101},{39240,25,18208},{39247,0,15725},{39248,13,18215},
+{39252,0,17369},{39253,25,18219},{39260,0,17370},{39261,25,18226},
+{39268,0,17372},{39269,17,18233},{39274,0,15726},{39275,9,18238},
+{39278,0,15727},{39279,21,18241},{39285,0,15728},{39286,5,18247},
+{39288,0,15729},{39289,21,18249},{39329,22,107},{39335,25,18258},
+{39342,0,15731},{39343,9,18265},{39346,0,17374},{39347,9,18268},
+{39350,0,15732},{39351,9,18271},{39354,0,15733},{39355,57,18274},
+{39370,0,17376},{39371,5,18289},{39373,0,17378},{39374,17,18291},
+{39379,0,17379},{39380,5,18296},{39382,0,17381},{39383,29,18298},
+{39391,0,17375},{39392,5,18306},{39394,26,113},{39401,21,18311},
+{39407,0,17405},{39408,13,18317},{39412,0,15735},{39413,37,18321},
+{39488,37,18331},{39498,10,120},{39501,45,18342},{39513,0,15738},
+{39514,17,18354},{39519,10,123},{39522,13,18360},{39526,22,126},
+{39532,25,18366},{39539,10,132},{39542,29,18374},{39550,0,15742},
+{39585,5,18382},{39587,10,135},{39590,9,18385},{39593,6,138},
+{39595,25,18388},{39602,0,15743},{39603,13,18395},{39607,26,140},
+{39614,33,18402},{39623,0,15747},{39624,29,18411},{39632,10,147},
+{39635,21,18420},{39641,9,15750},{39644,21,18426},{39650,10,150},
+{39653,9,18433},{39656,6,153},{39658,13,18436},{39662,0,17330},
+{39663,9,18440},{39666,0,15756},{39667,9,18443},{39670,0,15757},
+{39671,13,18446},{39675,0,15758},{39676,9,18450},{39744,21,18453},
+{39750,0,15759},{39751,9,18459},{39754,0,15760},{39755,33,18462},
+{39764,0,15762},{39765,9,18471},{39768,22,155},{39774,5,15766},
+{39776,0,18477},{39778,53,18478},{39792,13,15768},{39796,5,18492},
+{39798,10,161},{39801,5,18494},{39803,14,164},{39841,6,168},
+{39843,5,15779},{39845,5,18498},{39847,13,15781},{39851,6,170},
+{39853,5,18501},{39855,0,15786},{39856,5,18503},{39858,29,15787},
+{39866,13,18505},{39870,6,172},{39872,21,15796},{39878,0,10969},
+{39879,9,18510},{39882,22,174},{39888,5,15805},{39890,14,180},
+{39894,5,18518},{39896,9,15809},{39899,5,18520},{39901,26,184},
+{39908,9,18524},{39911,6,191},{39913,9,15817},{39916,6,193},
+{39918,5,15821},{39920,9,18529},{39923,0,15823},{39924,5,18532},
+{39926,6,195},{39928,5,15825},{39930,0,18535},{39931,5,15827},
+{39933,5,18536},{40000,5,15829},{40002,6,197},{40004,9,15832},
+{40007,14,199},{40011,5,18541},{40013,21,15837},{40019,14,203},
+{40023,17,15845},{40028,6,207},{40030,5,18546},{40032,14,209},
+{40036,9,15853},{40039,30,213},{40047,13,15859},{40051,5,18554},
+{40053,5,15863},{40055,14,221},{40059,5,15867},{40061,6,225},
+{40097,5,15870},{40099,5,18559},{40101,0,15872},{40102,5,18561},
+{40104,5,15873},{40106,10,227},{40109,5,15876},{40111,5,18565},
+{40113,37,15878},{40123,10,230},{40126,17,15890},{40131,9,18568},
+{40134,29,15895},{40142,10,233},{40145,9,15905},{40148,13,18572},
+{40152,9,15908},{40155,0,18576},{40156,37,15911},{40166,0,18577},
+{40167,9,15921},{40170,0,18578},{40171,5,15924},{40173,0,18579},
+{40174,45,15926},{40186,9,18580},{40189,6,236},{40256,0,17384},
+{40257,17,18584},{40262,0,15939},{40263,5,18589},{40265,0,15940},
+{40266,5,18591},{40268,5,15942},{40270,14,238},{40274,9,18595},
+{40277,10,242},{40280,5,18599},{40282,0,3340},{40283,21,18601},
+{40289,14,245},{40293,73,18608},{40312,6,249},{40314,13,18627},
+{40318,0,15951},{40353,13,18631},{40357,13,15952},{40361,10,251},
+{40364,5,15957},{40366,5,18637},{40368,0,15960},{40369,5,18639},
+{40371,18,254},{40376,13,18643},{40380,5,15964},{40382,0,18647},
+{40383,5,15966},{40385,5,18648},{40387,6,259},{40389,5,18650},
+{40391,5,15970},{40393,6,261},{40395,5,18653},{40397,17,15973},
+{40402,0,18655},{40403,9,15978},{40406,13,18656},{40410,133,15981},
+{40444,0,18660},{40445,5,16015},{40512,9,16017},{40515,0,18661},
+{40516,105,16021},{40543,0,18662},{40544,9,16049},{40547,0,18663},
+{40548,5,16052},{40550,5,18664},{40552,10,263},{40555,21,18667},
+{40561,10,266},{40564,9,18674},{40567,5,16058},{40569,22,269},
+{40609,5,16063},{40611,0,18680},{40612,9,16065},{40615,5,18681},
+{40617,10,275},{40620,5,16070},{40622,0,18684},{40623,9,16072},
+{40626,5,18685},{40628,6,278},{40630,5,16076},{40632,6,280},
+{40634,5,18689},{40636,0,16079},{40637,5,18691},{40639,5,16080},
+{40641,9,18693},{40644,5,16082},{40646,0,18696},{40647,13,16084},
+{40651,5,18697},{40653,0,16089},{40654,5,18699},{40656,5,16090},
+{40658,6,282},{40660,5,18702},{40662,5,16093},{40664,5,18704},
+{40666,81,16095},{40687,0,9398},{40688,5,16117},{40690,0,18706},
+{40691,9,16119},{40694,9,18707},{40697,5,16122},{40699,14,284},
+{40768,9,16127},{40771,0,18711},{40772,13,16130},{40776,0,18712},
+{40777,5,16134},{40779,5,18713},{40781,73,16136},{40800,0,13585},
+{40801,17,16156},{40806,0,14661},{40807,5,18715},{40809,25,16163},
+{40816,0,18717},{40817,53,16170},{40865,77,16184},{40885,0,18718},
+{40886,17,16204},{40891,0,18719},{40892,9,16209},{40895,10,288},
+{40898,33,16213},{40907,6,291},{40909,25,16224},{40916,0,18723},
+{40917,9,16232},{40920,0,14910},{40921,41,16236},{40932,0,18724},
+{40933,77,16247},{40953,0,18725},{40954,17,16267},{41024,0,18726},
+{41025,21,16272},{41031,0,18727},{41032,49,16278},{41045,0,18728},
+{41046,49,16291},{41059,0,14353},{41060,33,16305},{41069,0,18729},
+{41070,33,16314},{41079,0,1522},{41080,9,16324},{41083,0,18730},
+{41084,9,16327},{41121,6,293},{41123,13,16331},{41127,0,18732},
+{41128,113,16335},{41157,0,18733},{41158,37,16364},{41168,0,18734},
+{41169,13,16374},{41173,0,15086},{41174,33,16379},{41183,0,9341},
+{41184,9,16389},{41187,6,295},{41189,5,16393},{41191,25,18736},
+{41198,0,17332},{41199,9,18743},{41202,0,17336},{41203,45,18746},
+{41280,97,99},{41305,13,13743},{41309,133,128},{41377,337,162},
+{41462,6,297},{41464,25,249},{41536,249,256},{41633,373,319},
+{41792,249,413},{41889,105,476},{41917,9,503},{42048,249,595},
+{42145,373,658},{42304,249,752},{42401,373,815},{42560,249,909},
+{42657,373,972},{42816,249,1066},{42913,373,1129},{43072,249,1223},
+{43169,373,1286},{43328,249,1380},{43425,373,1443},{43584,249,1537},
+{43681,373,1600},{43840,249,1694},{43937,373,1757},{44096,249,1851},
+{44193,369,1914},{44286,0,2431},{44352,249,2007},{44449,373,2070},
+{44608,249,2164},{44705,373,2227},{44864,249,2321},{44961,185,2384},
+{45008,185,2432},{45120,249,2479},{45217,373,2542},{45376,249,2636},
+{45473,373,2699},{45632,249,2793},{45729,373,2856},{45888,249,2950},
+{45985,373,3013},{46144,249,3107},{46241,373,3170},{46400,249,3264},
+{46497,373,3327},{46656,249,3421},{46753,373,3484},{46912,249,3578},
+{47009,373,3641},{47168,249,3735},{47265,373,3798},{47424,249,3892},
+{47521,373,3955},{47680,249,4049},{47777,373,4112},{47936,249,4206},
+{48033,153,4269},{48072,217,4309},{48192,249,4364},{48289,373,4427},
+{48448,249,4521},{48545,373,4584},{48704,69,4678},{48722,0,4308},
+{48723,173,4696},{48801,373,4740},{48960,249,4834},{49057,373,4897},
+{49216,249,4991},{49313,373,5054},{49472,249,5148},{49569,37,5211},
+{49579,333,5222},{49728,249,5306},{49825,165,5369},{49867,0,5221},
+{49868,201,5411},{49984,129,5462},{50017,117,5496},{50081,93,5526},
+{50105,6,299},{50107,269,5552},{50240,85,5620},{50262,0,5495},
+{50263,157,5642},{50337,373,5682},{50496,249,5776},{50593,373,5839},
+{50752,249,5933},{50849,117,506},{50879,97,537},{50904,25,13747},
+{50911,0,6036},{50912,121,13754},{51008,249,13785},{51105,373,13848},
+{51264,249,13942},{51361,201,14005},{51412,9,17606},{51415,33,17692},
+{51424,0,18846},{51425,29,17701},{51433,0,18847},{51434,25,17709},
+{51441,0,18848},{51445,37,18834},{51520,37,5996},{51530,0,628},
+{51531,129,6006},{51564,73,6040},{51617,113,6059},{51646,0,6039},
+{51647,181,6088},{51693,69,6135},{51776,249,6153},{51873,341,6216},
+{51959,0,6134},{51960,25,6302},{52032,249,6309},{52129,373,6372},
+{52288,249,6466},{52385,373,6529},{52544,249,6623},{52641,373,6686},
+{52800,249,6780},{52897,373,6843},{53056,249,6937},{53153,373,7000},
+{53312,249,7094},{53409,373,7157},{53568,249,7251},{53665,373,7314},
+{53824,249,7408},{53921,373,7471},{54080,249,7565},{54177,373,7628},
+{54336,249,7722},{54433,373,7785},{54592,249,7879},{54689,373,7942},
+{54848,249,8036},{54945,169,8099},{54988,0,8788},{54989,197,8143},
+{55104,229,8193},{55162,0,8889},{55163,13,8251},{55201,373,8255},
+{55360,249,8349},{55457,373,8412},{55616,249,8506},{55713,373,8569},
+{55872,249,8663},{55969,245,8726},{56031,0,8142},{56032,121,8789},
+{56128,249,8820},{56225,21,8883},{56231,349,8890},{56384,249,8978},
+{56481,373,9041},{56640,249,9135},{56737,361,9198},{56828,0,9089},
+{56829,5,9289},{56896,249,9291},{56993,373,9354},{57152,249,9448},
+{57249,373,9511},{57408,249,9605},{57505,373,9668},{57664,249,9762},
+{57761,373,9825},{57920,249,9919},{58017,373,9982},{58176,249,10076},
+{58273,373,10139},{58432,249,10233},{58529,373,10296},{58688,249,10390},
+{58785,373,10453},{58944,249,10547},{59041,373,10610},{59200,249,10704},
+{59297,373,10767},{59456,249,10861},{59553,5,10924},{59555,365,10927},
+{59712,213,11019},{59766,33,11074},{59809,373,11083},{59968,249,11177},
+{60065,373,11240},{60224,105,11334},{60251,141,11362},{60321,317,11398},
+{60401,0,10926},{60402,49,11478},{60480,249,11491},{60577,241,11554},
+{60638,0,11073},{60639,125,11615},{60736,249,11647},{60833,33,11710},
+{60842,337,11720},{60992,249,11805},{61089,293,11868},{61163,0,12308},
+{61164,73,11942},{61248,249,11961},{61345,373,12024},{61504,85,12118},
+{61526,0,11719},{61527,157,12140},{61601,165,12180},{61643,0,11361},
+{61644,201,12222},{61760,137,12273},{61795,29,12309},{61803,0,12640},
+{61804,73,12317},{61857,373,12336},{62016,157,12430},{62056,0,12783},
+{62057,85,12470},{62113,133,12492},{62147,237,12527},{62272,209,12587},
+{62325,37,12641},{62369,373,12651},{62528,149,12745},{62566,97,12784},
+{62625,77,12809},{62645,0,12526},{62646,281,12829},{62717,5,12901},
+{62784,249,12903},{62881,373,12966},{63040,137,13060},{63075,0,12900},
+{63076,105,13095},{63137,373,13122},{63296,249,13216},{63393,373,13279},
+{63552,249,13373},{63649,373,13436},{63808,217,13530},{63863,29,13586},
+{63905,137,13594},{63940,10,301},{63943,41,13630},{63954,13,13642},
+{63958,161,14056},{64064,121,16395},{64095,0,2106},{64096,21,16427},
+{64102,0,2557},{64103,93,16434},{64161,29,16458},{64169,5,18758},
+{64171,69,16468},{64189,0,781},{64190,25,16487},{64197,0,363},
+{64198,57,16495},{64213,0,2144},{64214,161,16511},{64320,29,16552},
+{64328,0,16002},{64329,37,16561},{64339,0,18760},{64340,101,16572},
+{64366,0,18761},{64367,61,16599},{64417,5,16615},{64419,0,18762},
+{64420,77,16618},{64440,0,3107},{64441,21,16639},{64447,0,18763},
+{64448,49,16645},{64461,0,18764},{64462,145,16658},{64499,0,6116},
+{64500,17,16696},{64505,0,16014},{64506,17,16702},{64576,37,16707},
+{64586,0,18765},{64587,13,16717},{64591,0,8495},{64592,5,16721},
+{64594,0,18766},{64595,61,16723},{64611,0,18767},{64612,29,16739},
+{64620,6,304},{64622,25,16749},{64629,0,18769},{64630,33,16756},
+{64673,93,16765},{64697,0,4447},{64698,5,16789},{64700,5,18770},
+{64702,53,16792},{64716,0,18772},{64717,81,16807},{64738,6,306},
+{64740,37,16829},{64750,0,18774},{64751,5,16839},{64753,0,1219},
+{64754,49,16842},{64832,33,16855},{64841,0,18775},{64842,125,16864},
+{64874,0,18776},{64875,77,16897},{64929,85,16917},{64951,6,308},
+{64953,5,16941},{64955,0,3237},{64956,153,16944},{64995,0,18777},
+{64996,49,16984},{65009,6,310},{65011,45,16998},{65088,69,17010},
+{65106,0,15728},{65107,101,17029},{65133,10,312},{65136,29,17057},
+{65144,0,18780},{65145,21,17065},{65185,33,17071},{65194,0,288},
+{65195,197,17080},{65245,0,7080},{65246,5,18781},{65248,49,17131},
+{65261,5,18783},{65263,61,17144},
+};
+
+static const unsigned short cmap_ETHK_B5_H_table[315] = {
+17723,17347,17388,17777,17387,17778,17308,17815,17310,17816,17311,17313,
+17820,17315,17845,17161,17214,17850,17851,17219,17852,17221,17853,17855,
+17245,17856,17247,17860,17371,17294,17886,17295,17887,17296,17888,17297,
+17889,17303,17896,17304,17348,19023,18964,17339,17312,17341,17344,17981,
+17345,17337,17325,4181,14164,3381,14296,18083,18085,14309,10178,18088,
+14368,18089,18090,4940,16377,18093,14420,2510,3015,14466,18098,14633,
+18104,284,283,18116,7430,10657,18118,17354,18154,15709,18155,17356,
+15710,18156,17402,18157,15713,18161,15714,18162,18178,17361,15720,18195,
+15721,18196,15722,18203,17367,17404,15723,18206,15724,18207,17368,18255,
+15730,18256,17349,18257,17350,15734,18308,17323,18309,17383,18310,17385,
+15736,18341,15737,17327,18359,15739,17389,18364,15740,17390,18365,17407,
+15741,18373,17393,17395,18384,17394,17400,17396,15744,18399,15745,18400,
+15746,18401,17335,15748,18419,15749,15753,18432,15754,15755,17328,15763,
+18474,15764,18475,15765,18476,12112,15773,5925,13037,15776,18496,15777,
+15778,18497,18500,15785,15795,18509,15803,18513,15804,18514,17360,18515,
+18516,15807,18517,15808,15812,7188,15813,18522,15814,18523,15815,15816,
+18527,16890,18528,4841,18534,11438,18538,18539,15835,18540,15836,6756,
+18543,15844,18544,18545,15850,15851,18548,5124,18549,18550,8996,18551,
+15857,13418,18552,15858,18553,8849,18556,15866,18557,18558,15869,18563,
+15875,18564,18567,6023,2399,18571,15903,7833,15938,18583,18593,15944,
+18594,15945,15946,18598,9665,17353,15948,18607,15949,17397,15950,18635,
+15956,18636,15961,18641,15962,18642,15963,15968,1510,18652,15972,16054,
+18666,16055,16056,18673,16057,18677,16060,18678,16061,18679,16062,1832,
+16069,18683,16075,18687,18688,16078,18701,16092,18710,16124,6150,16126,
+18720,16212,18721,3970,18722,16330,18731,18735,15049,248,247,5551,
+5550,13585,13629,13641,16385,18768,3193,18773,6333,3261,3278,18778,
+18779,17055,3716,
+};
+
+static pdf_cmap cmap_ETHK_B5_H = {
+	-1, "ETHK-B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,34624,65278}, },
+	990, 990, (pdf_range*) cmap_ETHK_B5_H_ranges,
+	315, 315, (unsigned short*) cmap_ETHK_B5_H_table,
+};
+
+/* ETHK-B5-V */
+
+static const pdf_range cmap_ETHK_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+{50916,5,14097},
+};
+
+static const unsigned short cmap_ETHK_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_ETHK_B5_V = {
+	-1, "ETHK-B5-V", "ETHK-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	13, 13, (pdf_range*) cmap_ETHK_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_ETHK_B5_V_table,
+};
+
+/* ETen-B5-H */
+
+static const pdf_range cmap_ETen_B5_H_ranges[] = {
+{32,377,13648},{41280,97,99},{41305,13,13743},{41309,133,128},
+{41377,337,162},{41462,6,0},{41464,25,249},{41536,249,256},
+{41633,373,319},{41792,249,413},{41889,105,476},{41917,9,503},
+{42048,249,595},{42145,373,658},{42304,249,752},{42401,373,815},
+{42560,249,909},{42657,373,972},{42816,249,1066},{42913,373,1129},
+{43072,249,1223},{43169,373,1286},{43328,249,1380},{43425,373,1443},
+{43584,249,1537},{43681,373,1600},{43840,249,1694},{43937,373,1757},
+{44096,249,1851},{44193,369,1914},{44286,0,2431},{44352,249,2007},
+{44449,373,2070},{44608,249,2164},{44705,373,2227},{44864,249,2321},
+{44961,185,2384},{45008,185,2432},{45120,249,2479},{45217,373,2542},
+{45376,249,2636},{45473,373,2699},{45632,249,2793},{45729,373,2856},
+{45888,249,2950},{45985,373,3013},{46144,249,3107},{46241,373,3170},
+{46400,249,3264},{46497,373,3327},{46656,249,3421},{46753,373,3484},
+{46912,249,3578},{47009,373,3641},{47168,249,3735},{47265,373,3798},
+{47424,249,3892},{47521,373,3955},{47680,249,4049},{47777,373,4112},
+{47936,249,4206},{48033,153,4269},{48072,217,4309},{48192,249,4364},
+{48289,373,4427},{48448,249,4521},{48545,373,4584},{48704,69,4678},
+{48722,0,4308},{48723,173,4696},{48801,373,4740},{48960,249,4834},
+{49057,373,4897},{49216,249,4991},{49313,373,5054},{49472,249,5148},
+{49569,37,5211},{49579,333,5222},{49728,249,5306},{49825,165,5369},
+{49867,0,5221},{49868,201,5411},{49984,129,5462},{50017,117,5496},
+{50081,93,5526},{50105,6,2},{50107,269,5552},{50240,85,5620},
+{50262,0,5495},{50263,157,5642},{50337,373,5682},{50496,249,5776},
+{50593,373,5839},{50752,249,5933},{50849,117,506},{50879,97,537},
+{50904,25,13747},{50911,0,6036},{50912,121,13754},{51008,249,13785},
+{51105,373,13848},{51264,249,13942},{51361,201,14005},{51520,37,5996},
+{51530,0,628},{51531,129,6006},{51564,73,6040},{51617,113,6059},
+{51646,0,6039},{51647,181,6088},{51693,69,6135},{51776,249,6153},
+{51873,341,6216},{51959,0,6134},{51960,25,6302},{52032,249,6309},
+{52129,373,6372},{52288,249,6466},{52385,373,6529},{52544,249,6623},
+{52641,373,6686},{52800,249,6780},{52897,373,6843},{53056,249,6937},
+{53153,373,7000},{53312,249,7094},{53409,373,7157},{53568,249,7251},
+{53665,373,7314},{53824,249,7408},{53921,373,7471},{54080,249,7565},
+{54177,373,7628},{54336,249,7722},{54433,373,7785},{54592,249,7879},
+{54689,373,7942},{54848,249,8036},{54945,169,8099},{54988,0,8788},
+{54989,197,8143},{55104,229,8193},{55162,0,8889},{55163,13,8251},
+{55201,373,8255},{55360,249,8349},{55457,373,8412},{55616,249,8506},
+{55713,373,8569},{55872,249,8663},{55969,245,8726},{56031,0,8142},
+{56032,121,8789},{56128,249,8820},{56225,21,8883},{56231,349,8890},
+{56384,249,8978},{56481,373,9041},{56640,249,9135},{56737,361,9198},
+{56828,0,9089},{56829,5,9289},{56896,249,9291},{56993,373,9354},
+{57152,249,9448},{57249,373,9511},{57408,249,9605},{57505,373,9668},
+{57664,249,9762},{57761,373,9825},{57920,249,9919},{58017,373,9982},
+{58176,249,10076},{58273,373,10139},{58432,249,10233},{58529,373,10296},
+{58688,249,10390},{58785,373,10453},{58944,249,10547},{59041,373,10610},
+{59200,249,10704},{59297,373,10767},{59456,249,10861},{59553,5,10924},
+{59555,365,10927},{59712,213,11019},{59766,33,11074},{59809,373,11083},
+{59968,249,11177},{60065,373,11240},{60224,105,11334},{60251,141,11362},
+{60321,317,11398},{60401,0,10926},{60402,49,11478},{60480,249,11491},
+{60577,241,11554},{60638,0,11073},{60639,125,11615},{60736,249,11647},
+{60833,33,11710},{60842,337,11720},{60992,249,11805},{61089,293,11868},
+{61163,0,12308},{61164,73,11942},{61248,249,11961},{61345,373,12024},
+{61504,85,12118},{61526,0,11719},{61527,157,12140},{61601,165,12180},
+{61643,0,11361},{61644,201,12222},{61760,137,12273},{61795,29,12309},
+{61803,0,12640},{61804,73,12317},{61857,373,12336},{62016,157,12430},
+{62056,0,12783},{62057,85,12470},{62113,133,12492},{62147,237,12527},
+{62272,209,12587},{62325,37,12641},{62369,373,12651},{62528,149,12745},
+{62566,97,12784},{62625,77,12809},{62645,0,12526},{62646,281,12829},
+{62717,5,12901},{62784,249,12903},{62881,373,12966},{63040,137,13060},
+{63075,0,12900},{63076,105,13095},{63137,373,13122},{63296,249,13216},
+{63393,373,13279},{63552,249,13373},{63649,373,13436},{63808,217,13530},
+{63863,29,13586},{63905,137,13594},{63940,10,4},{63943,41,13630},
+{63954,13,13642},{63958,161,14056},
+};
+
+static const unsigned short cmap_ETen_B5_H_table[7] = {
+248,247,5551,5550,13585,13629,13641,
+};
+
+static pdf_cmap cmap_ETen_B5_H = {
+	-1, "ETen-B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,41280,65278}, },
+	250, 250, (pdf_range*) cmap_ETen_B5_H_ranges,
+	7, 7, (unsigned short*) cmap_ETen_B5_H_table,
+};
+
+/* ETen-B5-V */
+
+static const pdf_range cmap_ETen_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+{50916,5,14097},
+};
+
+static const unsigned short cmap_ETen_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_ETen_B5_V = {
+	-1, "ETen-B5-V", "ETen-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	13, 13, (pdf_range*) cmap_ETen_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_ETen_B5_V_table,
+};
+
+/* ETenms-B5-H */
+
+static const pdf_range cmap_ETenms_B5_H_ranges[] = {
+{32,377,1},
+};
+
+static const unsigned short cmap_ETenms_B5_H_table[] = { 0 };
+
+static pdf_cmap cmap_ETenms_B5_H = {
+	-1, "ETenms-B5-H", "ETen-B5-H", 0, 0, 0,
+	{ {0,0,0}, },
+	1, 1, (pdf_range*) cmap_ETenms_B5_H_ranges,
+	0, 0, (unsigned short*) cmap_ETenms_B5_H_table,
+};
+
+/* ETenms-B5-V */
+
+static const pdf_range cmap_ETenms_B5_V_ranges[] = {
+{41291,6,0},{41302,0,312},{41304,0,122},{41306,0,13743},
+{41308,0,13745},{41309,5,130},{41313,5,134},{41317,5,138},
+{41321,5,142},{41325,5,146},{41329,5,150},{41333,5,154},
+{41337,5,158},{41341,5,130},{41377,5,134},{41379,5,138},
+{50916,5,14097},
+};
+
+static const unsigned short cmap_ETenms_B5_V_table[2] = {
+13646,109,
+};
+
+static pdf_cmap cmap_ETenms_B5_V = {
+	-1, "ETenms-B5-V", "ETenms-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	17, 17, (pdf_range*) cmap_ETenms_B5_V_ranges,
+	2, 2, (unsigned short*) cmap_ETenms_B5_V_table,
+};
+
+/* HKdla-B5-H */
+
+static const pdf_range cmap_HKdla_B5_H_ranges[] = {
+{32,377,1},{41280,97,99},{41305,13,13743},{41309,133,128},
+{41377,337,162},{41462,6,0},{41464,25,249},{41536,249,256},
+{41633,373,319},{41792,249,413},{41889,105,476},{41917,9,503},
+{42048,249,595},{42145,373,658},{42304,249,752},{42401,373,815},
+{42560,249,909},{42657,373,972},{42816,249,1066},{42913,373,1129},
+{43072,249,1223},{43169,373,1286},{43328,249,1380},{43425,373,1443},
+{43584,249,1537},{43681,373,1600},{43840,249,1694},{43937,373,1757},
+{44096,249,1851},{44193,369,1914},{44286,0,2431},{44352,249,2007},
+{44449,373,2070},{44608,249,2164},{44705,373,2227},{44864,249,2321},
+{44961,185,2384},{45008,185,2432},{45120,249,2479},{45217,373,2542},
+{45376,249,2636},{45473,373,2699},{45632,249,2793},{45729,373,2856},
+{45888,249,2950},{45985,373,3013},{46144,249,3107},{46241,373,3170},
+{46400,249,3264},{46497,373,3327},{46656,249,3421},{46753,373,3484},
+{46912,249,3578},{47009,373,3641},{47168,249,3735},{47265,373,3798},
+{47424,249,3892},{47521,373,3955},{47680,249,4049},{47777,373,4112},
+{47936,249,4206},{48033,153,4269},{48072,217,4309},{48192,249,4364},
+{48289,373,4427},{48448,249,4521},{48545,373,4584},{48704,69,4678},
+{48722,0,4308},{48723,173,4696},{48801,373,4740},{48960,249,4834},
+{49057,373,4897},{49216,249,4991},{49313,373,5054},{49472,249,5148},
+{49569,37,5211},{49579,333,5222},{49728,249,5306},{49825,165,5369},
+{49867,0,5221},{49868,201,5411},{49984,129,5462},{50017,117,5496},
+{50081,93,5526},{50105,6,2},{50107,269,5552},{50240,85,5620},
+{50262,0,5495},{50263,157,5642},{50337,373,5682},{50496,249,5776},
+{50593,373,5839},{50752,249,5933},{51520,37,5996},{51530,0,628},
+{51531,129,6006},{51564,73,6040},{51617,113,6059},{51646,0,6039},
+{51647,181,6088},{51693,69,6135},{51776,249,6153},{51873,341,6216},
+{51959,0,6134},{51960,25,6302},{52032,249,6309},{52129,373,6372},
+{52288,249,6466},{52385,373,6529},{52544,249,6623},{52641,373,6686},
+{52800,249,6780},{52897,373,6843},{53056,249,6937},{53153,373,7000},
+{53312,249,7094},{53409,373,7157},{53568,249,7251},{53665,373,7314},
+{53824,249,7408},{53921,373,7471},{54080,249,7565},{54177,373,7628},
+{54336,249,7722},{54433,373,7785},{54592,249,7879},{54689,373,7942},
+{54848,249,8036},{54945,169,8099},{54988,0,8788},{54989,197,8143},
+{55104,229,8193},{55162,0,8889},{55163,13,8251},{55201,373,8255},
+{55360,249,8349},{55457,373,8412},{55616,249,8506},{55713,373,8569},
+{55872,249,8663},{55969,245,8726},{56031,0,8142},{56032,121,8789},
+{56128,249,8820},{56225,21,8883},{56231,349,8890},{56384,249,8978},
+{56481,373,9041},{56640,249,9135},{56737,361,9198},{56828,0,9089},
+{56829,5,9289},{56896,249,9291},{56993,373,9354},{57152,249,9448},
+{57249,373,9511},{57408,249,9605},{57505,373,9668},{57664,249,9762},
+{57761,373,9825},{57920,249,9919},{58017,373,9982},{58176,249,10076},
+{58273,373,10139},{58432,249,10233},{58529,373,10296},{58688,249,10390},
+{58785,373,10453},{58944,249,10547},{59041,373,10610},{59200,249,10704},
+{59297,373,10767},{59456,249,10861},{59553,5,10924},{59555,365,10927},
+{59712,213,11019},{59766,33,11074},{59809,373,11083},{59968,249,11177},
+{60065,373,11240},{60224,105,11334},{60251,141,11362},{60321,317,11398},
+{60401,0,10926},{60402,49,11478},{60480,249,11491},{60577,241,11554},
+{60638,0,11073},{60639,125,11615},{60736,249,11647},{60833,33,11710},
+{60842,337,11720},{60992,249,11805},{61089,293,11868},{61163,0,12308},
+{61164,73,11942},{61248,249,11961},{61345,373,12024},{61504,85,12118},
+{61526,0,11719},{61527,157,12140},{61601,165,12180},{61643,0,11361},
+{61644,201,12222},{61760,137,12273},{61795,29,12309},{61803,0,12640},
+{61804,73,12317},{61857,373,12336},{62016,157,12430},{62056,0,12783},
+{62057,85,12470},{62113,133,12492},{62147,237,12527},{62272,209,12587},
+{62325,37,12641},{62369,373,12651},{62528,149,12745},{62566,97,12784},
+{62625,77,12809},{62645,0,12526},{62646,281,12829},{62717,5,12901},
+{62784,249,12903},{62881,373,12966},{63040,137,13060},{63075,0,12900},
+{63076,105,13095},{63137,373,13122},{63296,249,13216},{63393,373,13279},
+{63552,249,13373},{63649,373,13436},{63808,217,13530},{63863,29,13586},
+{63905,137,13594},{63940,10,4},{63943,41,13630},{63954,13,13642},
+{64065,246,7},{64161,70,69},{64179,5,16001},{64181,294,87},
+{64320,214,161},{64374,5,16228},{64376,26,215},{64417,374,222},
+{64576,250,316},{64673,82,379},{64694,5,16862},{64696,110,400},
+{64724,5,16960},{64726,162,428},{64832,250,469},{64929,374,532},
+{65088,158,626},{65128,5,15723},{65130,82,666},{65185,78,687},
+{65205,5,14566},{65207,286,707},
+};
+
+static const unsigned short cmap_HKdla_B5_H_table[779] = {
+248,247,5551,5550,13585,13629,13641,16713,16035,16004,16007,15877,
+16534,14788,15725,15999,15479,16006,14460,16039,16910,16036,16778,16479,
+16662,16523,15974,15973,15759,16798,14950,16737,16010,15758,16013,15804,
+16021,14755,16884,16017,15302,15811,16046,14150,14449,14848,17036,16987,
+16045,16675,16038,16032,15150,15805,14436,15485,16041,16909,16216,16024,
+15728,16040,16020,16029,15018,16037,15564,16536,16031,16885,16011,15218,
+14304,15071,17120,16023,16786,14472,17096,16016,14447,16028,16708,16710,
+16030,16009,16531,15374,16005,14556,16489,14296,16025,16003,16008,16000,
+16049,16746,14187,15975,15992,16994,14325,14324,15173,15961,10940,15807,
+16573,15998,14381,16048,16043,16050,16929,16234,14363,16026,16931,16014,
+15357,16474,16047,15560,14664,17085,16588,15964,16044,14618,16042,17305,
+14490,16012,14495,16033,16775,16015,16323,16034,16027,15997,16465,16316,
+16341,15124,16930,14235,16507,14216,15284,16848,16996,14430,14188,15806,
+14355,16383,15715,14214,15178,14138,17018,15482,16901,15398,14511,14646,
+14248,15220,16237,16022,14268,15995,16362,16842,14807,16593,15217,16335,
+1986,17150,15565,15984,15986,14156,14185,15183,14239,11845,14349,16290,
+14364,16252,16217,16286,15763,14357,14475,15456,14576,14250,16180,15378,
+14592,16298,14603,14633,16167,16272,16215,16219,16226,15734,14792,14653,
+15462,14800,16418,16172,16168,14796,16166,14797,16191,14789,16334,16436,
+16222,16434,16468,16760,16224,16169,16477,16195,16232,16480,16170,16483,
+14823,14518,16528,16456,16402,15740,16459,16461,16463,16975,15737,16192,
+16138,16336,16182,16493,16517,16516,16702,16699,16326,16518,14674,16545,
+16178,16899,16230,15747,15989,16546,1392,16185,2161,16164,16558,16196,
+14581,16329,16333,16309,15996,16338,16205,16572,16567,14424,17327,16236,
+15749,17302,14758,16253,16319,16584,16223,16171,15730,16591,14853,15746,
+16604,15717,16596,16602,16173,1429,15745,16625,1781,16632,16635,16193,
+16664,15753,16220,15719,16142,16147,16674,16330,16681,16140,16139,16225,
+15754,16174,6513,16693,14891,16235,15269,16452,16981,14135,16165,14137,
+14896,16707,16580,15716,16318,16294,16428,16727,16287,11072,16295,16389,
+16385,7323,15748,2709,16748,16393,15733,15068,16296,16183,16756,16390,
+16386,16314,16320,4784,16317,16755,16774,14932,16325,16985,16322,16149,
+16208,16262,16321,16780,16327,16150,16782,16203,16797,4447,16324,13188,
+15769,16825,14985,16823,15755,15718,994,15722,15738,16867,1561,14742,
+16328,15006,16184,15744,17131,15750,16859,16190,16470,16857,16374,16221,
+15732,16872,16839,15761,15179,15682,15021,15013,16882,16204,16888,16238,
+16249,16269,16387,16273,15043,2330,16948,16379,16381,16248,15477,15475,
+14501,17401,15614,16983,16947,15721,15486,15727,16384,15808,16388,3698,
+14648,16292,10586,17011,15049,17021,15050,16306,16310,16279,16282,17035,
+17402,17034,16209,16280,16803,15708,16227,17040,8084,17094,17058,16378,
+16285,16382,16283,16351,16358,16350,17079,16372,17080,16363,17087,15729,
+16207,17093,17109,17104,17112,16213,16360,16371,17119,16339,15987,16277,
+17134,17140,16268,16335,17132,16340,17136,1986,2389,17150,17153,15565,
+17159,17403,16346,16267,14131,16266,14145,14144,14146,16275,16271,15984,
+17097,15986,16297,17101,17362,16270,16247,15726,3338,16145,14162,16148,
+16152,16211,16159,16156,16312,13213,15167,16210,16154,16157,14172,14469,
+14177,16343,16342,16345,16344,16349,16019,14185,14190,15180,14196,14207,
+14203,14210,15183,14226,16355,16348,16347,16357,15221,14242,16354,16359,
+15981,3370,15993,15990,14239,16366,17108,15764,15713,16353,14174,15226,
+14347,16364,16367,11845,16380,16365,14349,16356,16274,16302,14353,16250,
+15243,16218,14358,16290,15246,14364,8276,14367,16288,17404,15894,15252,
+16252,16391,16251,15731,15991,15762,16289,14273,14291,15994,16217,15445,
+16376,16373,15436,15756,16291,14272,16212,14336,15231,16286,14370,16361,
+14371,16352,15763,16377,14375,16293,16368,14390,16281,16370,15757,17382,
+13602,16369,16284,16305,16278,15983,16233,16375,16258,16264,16261,16259,
+16255,16265,15285,14434,16263,16177,14357,14462,16201,16200,16199,16197,
+17387,14466,16239,16206,15304,17405,17406,16331,15826,14457,16144,14382,
+14475,15456,10911,15457,14483,15988,16300,16257,15309,15316,15315,16332,
+16337,16189,16202,9042,14509,16198,14517,16141,16307,14528,15919,14543,
+14549,16179,15765,16181,14551,16175,14560,15362,16242,16240,15766,16437,
+16243,14576,15371,14583,14250,17407,14586,15377,16180,16313,15378,16394,
+15735,16194,14592,14594,16244,15767,16298,16153,16155,14606,14601,14603,
+16146,16151,16311,16160,16315,16188,16301,14617,16214,16241,16308,14620,
+16158,16186,14619,15751,15418,16162,15985,15417,15742,16676,16187,15982,
+16299,14629,16176,14633,16260,16143,16246,16276,14642,16167,14643,16245,
+14647,15736,16161,16272,14656,15743,14666,16256,16163,14672,16254,
+};
+
+static pdf_cmap cmap_HKdla_B5_H = {
+	-1, "HKdla-B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,41280,65278}, },
+	262, 262, (pdf_range*) cmap_HKdla_B5_H_ranges,
+	779, 779, (unsigned short*) cmap_HKdla_B5_H_table,
+};
+
+/* HKdla-B5-V */
+
+static const pdf_range cmap_HKdla_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+};
+
+static const unsigned short cmap_HKdla_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_HKdla_B5_V = {
+	-1, "HKdla-B5-V", "HKdla-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_HKdla_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_HKdla_B5_V_table,
+};
+
+/* HKdlb-B5-H */
+
+static const pdf_range cmap_HKdlb_B5_H_ranges[] = {
+{32,377,1},{36416,250,0},{36513,142,63},{36549,5,15220},
+{36551,222,99},{36672,250,155},{36769,374,218},{36928,250,312},
+{37025,374,375},{37184,250,469},{37281,118,532},{37311,5,16862},
+{37313,82,562},{37335,158,583},{37440,150,623},{41280,97,99},
+{41305,13,13743},{41309,133,128},{41377,337,162},{41462,6,661},
+{41464,25,249},{41536,249,256},{41633,373,319},{41792,249,413},
+{41889,105,476},{41917,9,503},{42048,249,595},{42145,373,658},
+{42304,249,752},{42401,373,815},{42560,249,909},{42657,373,972},
+{42816,249,1066},{42913,373,1129},{43072,249,1223},{43169,373,1286},
+{43328,249,1380},{43425,373,1443},{43584,249,1537},{43681,373,1600},
+{43840,249,1694},{43937,373,1757},{44096,249,1851},{44193,369,1914},
+{44286,0,2431},{44352,249,2007},{44449,373,2070},{44608,249,2164},
+{44705,373,2227},{44864,249,2321},{44961,185,2384},{45008,185,2432},
+{45120,249,2479},{45217,373,2542},{45376,249,2636},{45473,373,2699},
+{45632,249,2793},{45729,373,2856},{45888,249,2950},{45985,373,3013},
+{46144,249,3107},{46241,373,3170},{46400,249,3264},{46497,373,3327},
+{46656,249,3421},{46753,373,3484},{46912,249,3578},{47009,373,3641},
+{47168,249,3735},{47265,373,3798},{47424,249,3892},{47521,373,3955},
+{47680,249,4049},{47777,373,4112},{47936,249,4206},{48033,153,4269},
+{48072,217,4309},{48192,249,4364},{48289,373,4427},{48448,249,4521},
+{48545,373,4584},{48704,69,4678},{48722,0,4308},{48723,173,4696},
+{48801,373,4740},{48960,249,4834},{49057,373,4897},{49216,249,4991},
+{49313,373,5054},{49472,249,5148},{49569,37,5211},{49579,333,5222},
+{49728,249,5306},{49825,165,5369},{49867,0,5221},{49868,201,5411},
+{49984,129,5462},{50017,117,5496},{50081,93,5526},{50105,6,663},
+{50107,269,5552},{50240,85,5620},{50262,0,5495},{50263,157,5642},
+{50337,373,5682},{50496,249,5776},{50593,373,5839},{50752,249,5933},
+{51520,37,5996},{51530,0,628},{51531,129,6006},{51564,73,6040},
+{51617,113,6059},{51646,0,6039},{51647,181,6088},{51693,69,6135},
+{51776,249,6153},{51873,341,6216},{51959,0,6134},{51960,25,6302},
+{52032,249,6309},{52129,373,6372},{52288,249,6466},{52385,373,6529},
+{52544,249,6623},{52641,373,6686},{52800,249,6780},{52897,373,6843},
+{53056,249,6937},{53153,373,7000},{53312,249,7094},{53409,373,7157},
+{53568,249,7251},{53665,373,7314},{53824,249,7408},{53921,373,7471},
+{54080,249,7565},{54177,373,7628},{54336,249,7722},{54433,373,7785},
+{54592,249,7879},{54689,373,7942},{54848,249,8036},{54945,169,8099},
+{54988,0,8788},{54989,197,8143},{55104,229,8193},{55162,0,8889},
+{55163,13,8251},{55201,373,8255},{55360,249,8349},{55457,373,8412},
+{55616,249,8506},{55713,373,8569},{55872,249,8663},{55969,245,8726},
+{56031,0,8142},{56032,121,8789},{56128,249,8820},{56225,21,8883},
+{56231,349,8890},{56384,249,8978},{56481,373,9041},{56640,249,9135},
+{56737,361,9198},{56828,0,9089},{56829,5,9289},{56896,249,9291},
+{56993,373,9354},{57152,249,9448},{57249,373,9511},{57408,249,9605},
+{57505,373,9668},{57664,249,9762},{57761,373,9825},{57920,249,9919},
+{58017,373,9982},{58176,249,10076},{58273,373,10139},{58432,249,10233},
+{58529,373,10296},{58688,249,10390},{58785,373,10453},{58944,249,10547},
+{59041,373,10610},{59200,249,10704},{59297,373,10767},{59456,249,10861},
+{59553,5,10924},{59555,365,10927},{59712,213,11019},{59766,33,11074},
+{59809,373,11083},{59968,249,11177},{60065,373,11240},{60224,105,11334},
+{60251,141,11362},{60321,317,11398},{60401,0,10926},{60402,49,11478},
+{60480,249,11491},{60577,241,11554},{60638,0,11073},{60639,125,11615},
+{60736,249,11647},{60833,33,11710},{60842,337,11720},{60992,249,11805},
+{61089,293,11868},{61163,0,12308},{61164,73,11942},{61248,249,11961},
+{61345,373,12024},{61504,85,12118},{61526,0,11719},{61527,157,12140},
+{61601,165,12180},{61643,0,11361},{61644,201,12222},{61760,137,12273},
+{61795,29,12309},{61803,0,12640},{61804,73,12317},{61857,373,12336},
+{62016,157,12430},{62056,0,12783},{62057,85,12470},{62113,133,12492},
+{62147,237,12527},{62272,209,12587},{62325,37,12641},{62369,373,12651},
+{62528,149,12745},{62566,97,12784},{62625,77,12809},{62645,0,12526},
+{62646,281,12829},{62717,5,12901},{62784,249,12903},{62881,373,12966},
+{63040,137,13060},{63075,0,12900},{63076,105,13095},{63137,373,13122},
+{63296,249,13216},{63393,373,13279},{63552,249,13373},{63649,373,13436},
+{63808,217,13530},{63863,29,13586},{63905,137,13594},{63940,10,665},
+{63943,41,13630},{63954,13,13642},
+};
+
+static const unsigned short cmap_HKdlb_B5_H_table[668] = {
+15735,15724,16217,14617,15984,14162,14511,14214,16155,15708,16281,16360,
+14475,14556,16298,17096,14145,15743,17132,16275,14490,14457,14138,17104,
+15983,16152,14056,14137,16025,15180,15826,16297,16300,16331,14131,16287,
+16602,16169,15462,16930,16558,15738,16269,14800,16996,15746,16899,16859,
+16350,16372,16388,16230,16283,15718,16459,16351,16635,16402,16358,17131,
+16676,15740,15721,16382,15730,16326,15614,17401,15682,16149,16334,17035,
+16591,17398,16389,16173,16737,16172,15050,15722,16483,16325,14823,16170,
+16480,17011,16929,16546,16232,16545,16215,16240,16311,14150,16299,16370,
+16268,16264,14291,17140,15436,15226,14469,14135,16347,16157,16364,16357,
+14174,16375,14355,16355,16154,14566,16348,14207,15751,15315,15736,15316,
+16278,16277,15756,14647,16156,14642,15723,14336,16376,15418,16194,17405,
+16305,14226,16276,16158,16394,14466,16284,15713,16162,16361,15762,14207,
+15252,14190,17153,16186,14435,16369,17150,15356,16197,14239,14187,16148,
+16199,14434,14185,15378,16201,14367,14633,16214,16180,16349,14586,16251,
+15377,16252,17407,15987,16241,14629,15445,14517,16218,14358,15981,14210,
+16145,15243,14272,14357,14395,15731,15726,16266,16190,16948,16867,16327,
+16371,16387,16434,16238,16803,16390,16171,16253,15475,16150,16386,16470,
+16314,16235,16273,16318,16474,15071,15937,15719,16224,16872,16320,15747,
+16755,16220,16178,16191,15715,16710,16333,15737,16168,16321,16572,15729,
+16183,17112,16363,16961,14896,14797,17087,16910,16138,14796,16452,16536,
+16780,15716,16196,16463,17109,17040,16384,14985,16748,16580,16461,15808,
+16208,16393,16303,16262,16531,15021,16184,15733,16185,17101,16248,16285,
+16528,15744,16174,14518,16825,15754,16164,15006,15068,15717,16517,16209,
+17402,16227,16760,16823,15986,16857,16782,15734,17108,17058,16983,16140,
+14742,16981,16567,16282,16330,16222,15749,16378,16310,15043,16328,16203,
+16625,16436,16219,17097,15477,16249,17094,14543,16884,16193,14603,14560,
+17021,17136,16167,14370,14296,14242,16243,17080,16153,17079,15755,16681,
+16596,14581,16707,16418,16848,16885,16195,16584,16534,16477,16756,16702,
+16699,14788,15753,16901,14059,14789,15748,16468,6463,1561,2161,4447,
+16211,16159,13213,16312,15167,16210,14177,14172,16345,16343,16342,16019,
+14196,14203,15183,16391,16354,15993,15990,16359,3370,16366,16353,15991,
+16291,16212,14268,15994,16289,14273,16373,16286,15231,14347,16367,16380,
+14349,16365,16356,14353,16250,16290,15246,14364,16288,16352,15763,14375,
+16368,16293,14390,15757,16233,16258,16261,16259,16265,16255,15285,16263,
+16177,15764,560,17406,16144,14462,17387,16239,16027,16206,15304,7721,
+16200,14382,15456,10911,14483,17399,15988,15309,15049,16332,16337,16189,
+16202,14509,9042,16198,14514,16307,16141,14528,15919,14549,16181,14551,
+16175,16179,15765,15362,16242,15766,14567,16437,15371,14576,14583,16313,
+14592,16244,14601,16146,16151,16160,16315,16188,16308,16301,14618,14620,
+14619,15417,15985,15742,16187,16176,16260,17400,16143,16246,14643,16245,
+14656,16161,16272,14666,16256,16163,14672,15767,11845,1392,16045,13602,
+3043,1429,552,2709,4784,2330,17404,16274,16302,1986,2389,14213,
+15982,15725,16226,14792,16229,14653,16166,16493,16336,16182,16518,14674,
+16338,14424,16379,16231,16001,16329,16309,15996,15989,15479,15150,16205,
+17327,15975,16573,16236,14758,14664,16319,16223,14853,1781,16632,16813,
+16142,16674,16147,16139,16693,14891,16696,550,16713,15269,16385,16317,
+16296,16774,14932,16322,16786,16775,13188,16324,15769,15018,16374,16221,
+16839,15761,15732,16204,16882,15013,15179,15750,16888,16960,16381,16295,
+16985,3698,16994,15486,14648,16947,10586,16279,16306,17034,16280,8084,
+16192,16207,16271,15727,17119,16213,16339,17134,16335,16340,15997,17159,
+17403,16346,3338,16247,15807,16428,16292,15727,15565,16228,16267,14447,
+6513,7323,1861,7541,14472,14146,11072,14057,14304,15894,14460,14250,
+16270,16604,15482,16294,16479,15398,14430,16165,16456,15745,14606,16516,
+16664,16727,14594,14495,16377,14371,14449,14058,14188,14144,14324,17120,
+16987,14061,15124,17093,16523,14501,16746,16797,16708,16975,16225,16344,
+1564,248,247,5551,5550,13585,13629,13641,
+};
+
+static pdf_cmap cmap_HKdlb_B5_H = {
+	-1, "HKdlb-B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,36416,65278}, },
+	254, 254, (pdf_range*) cmap_HKdlb_B5_H_ranges,
+	668, 668, (unsigned short*) cmap_HKdlb_B5_H_table,
+};
+
+/* HKdlb-B5-V */
+
+static const pdf_range cmap_HKdlb_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+};
+
+static const unsigned short cmap_HKdlb_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_HKdlb_B5_V = {
+	-1, "HKdlb-B5-V", "HKdlb-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_HKdlb_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_HKdlb_B5_V_table,
+};
+
+/* HKgccs-B5-H */
+
+static const pdf_range cmap_HKgccs_B5_H_ranges[] = {
+{32,377,1},{35392,249,17160},{35489,273,17223},{35649,5,17292},
+{35653,0,17294},{35655,0,17295},{35657,0,17296},{35659,0,17297},
+{35661,13,17298},{35668,0,17302},{35672,0,17303},{35674,0,17304},
+{36416,17,14123},{36422,145,14128},{36460,37,14165},{36471,25,14175},
+{36478,0,289},{36513,17,14182},{36519,133,14187},{36554,105,14221},
+{36582,33,14248},{36592,57,14257},{36672,97,14272},{36698,17,14297},
+{36704,25,14302},{36712,89,14309},{36769,141,14332},{36806,0,14368},
+{36808,69,14369},{36827,129,14387},{36861,5,14420},{36928,109,14422},
+{36958,65,14450},{36976,37,14467},{36986,0,14057},{36987,13,14477},
+{37025,17,14481},{37031,65,14486},{37049,277,14503},{37184,145,14573},
+{37222,29,14610},{37231,57,14618},{37281,0,14633},{37283,365,14634},
+{37440,249,14726},{37537,53,14789},{37551,5,281},{37553,6,0},
+{37555,197,14803},{37606,45,14853},{37619,45,14865},{37696,157,14877},
+{37737,85,14917},{37793,33,14939},{37803,89,14948},{37827,133,14971},
+{37862,17,15005},{37868,73,15010},{37952,21,15029},{37959,221,15035},
+{38049,373,15091},{38208,49,15185},{38222,45,15198},{38235,141,15210},
+{38305,145,15246},{38343,221,15283},{38464,249,15339},{38561,201,15402},
+{38613,165,15453},{38720,249,15495},{38817,373,15558},{38976,209,15652},
+{39031,0,15705},{39034,0,15706},{39075,0,15707},{39087,0,15708},
+{39094,0,15709},{39097,0,15710},{39101,5,15711},{39106,0,15713},
+{39108,0,15714},{39110,5,15715},{39139,0,15717},{39143,0,15718},
+{39149,0,15719},{39152,0,15720},{39154,0,15721},{39164,0,15722},
+{39235,0,15723},{39237,0,15724},{39247,0,15725},{39274,0,15726},
+{39278,0,15727},{39285,0,15728},{39288,0,15729},{39330,0,15730},
+{39342,0,15731},{39350,0,15732},{39354,0,15733},{39394,0,15734},
+{39412,0,15735},{39498,0,15736},{39500,0,15737},{39513,0,15738},
+{39521,0,15739},{39528,0,15740},{39539,0,15741},{39550,0,15742},
+{39602,0,15743},{39607,0,15744},{39609,0,15745},{39611,0,15746},
+{39623,0,15747},{39632,0,15748},{39634,0,15749},{39641,9,15750},
+{39650,0,15753},{39652,0,15754},{39656,0,15755},{39666,0,15756},
+{39670,0,15757},{39675,0,15758},{39750,0,15759},{39754,0,15760},
+{39756,0,15761},{39764,0,15762},{39768,0,15763},{39770,0,15764},
+{39772,0,15765},{39774,5,15766},{39792,13,15768},{39798,9,15772},
+{39803,5,15775},{39806,0,15777},{39841,0,15778},{39843,5,15779},
+{39847,13,15781},{39852,0,15785},{39855,0,15786},{39858,29,15787},
+{39870,0,15795},{39872,25,15796},{39882,0,15803},{39884,0,15804},
+{39888,5,15805},{39891,0,15807},{39893,0,15808},{39896,9,15809},
+{39901,10,2},{39905,0,15814},{39907,0,15815},{39911,0,15816},
+{39913,13,15817},{39918,5,15821},{39923,0,15823},{39926,0,15824},
+{39928,5,15825},{39931,5,15827},{40000,9,15829},{40004,9,15832},
+{40008,0,15835},{40010,0,15836},{40013,25,15837},{40021,0,15844},
+{40023,17,15845},{40029,0,15850},{40032,0,15851},{40034,0,15852},
+{40036,9,15853},{40040,0,15856},{40042,6,5},{40045,0,15858},
+{40047,13,15859},{40053,9,15863},{40057,0,15866},{40059,5,15867},
+{40062,0,15869},{40097,5,15870},{40101,0,15872},{40104,5,15873},
+{40107,0,15875},{40109,5,15876},{40113,37,15878},{40124,25,15888},
+{40134,29,15895},{40143,17,15903},{40152,9,15908},{40156,37,15911},
+{40167,9,15921},{40171,5,15924},{40174,45,15926},{40189,0,15938},
+{40262,0,15939},{40265,5,15940},{40268,5,15942},{40271,0,15944},
+{40273,0,15945},{40277,0,15946},{40279,0,9665},{40282,0,15947},
+{40290,0,15948},{40292,0,15949},{40313,0,15950},{40318,0,15951},
+{40357,13,15952},{40362,0,15956},{40364,9,15957},{40368,0,15960},
+{40371,0,15961},{40373,0,15962},{40375,0,15963},{40380,5,15964},
+{40383,5,15966},{40387,5,15968},{40391,5,15970},{40394,0,15972},
+{40397,17,15973},{40403,9,15978},{40410,133,15981},{40445,5,16015},
+{40512,137,16017},{40548,5,16052},{40552,0,16054},{40554,0,16055},
+{40561,0,16056},{40563,0,16057},{40567,5,16058},{40570,0,16060},
+{40572,0,16061},{40574,0,16062},{40609,5,16063},{40612,9,16065},
+{40617,5,16068},{40620,5,16070},{40623,9,16072},{40628,0,16075},
+{40630,5,16076},{40633,0,16078},{40636,0,16079},{40639,5,16080},
+{40644,5,16082},{40647,13,16084},{40652,5,16088},{40656,5,16090},
+{40659,0,16092},{40662,5,16093},{40666,93,16095},{40691,9,16119},
+{40697,5,16122},{40700,9,16124},{40768,9,16127},{40772,13,16130},
+{40777,5,16134},{40781,105,16136},{40809,25,16163},{40817,53,16170},
+{40865,77,16184},{40886,17,16204},{40892,9,16209},{40896,0,16212},
+{40898,133,16213},{40933,77,16247},{40954,17,16267},{41025,21,16272},
+{41032,49,16278},{41046,89,16291},{41070,49,16314},{41084,9,16327},
+{41121,0,16330},{41123,13,16331},{41128,113,16335},{41158,37,16364},
+{41169,69,16374},{41188,9,16392},{41280,97,99},{41305,13,13743},
+{41309,133,128},{41377,337,162},{41462,6,7},{41464,25,249},
+{41536,249,256},{41633,373,319},{41792,249,413},{41889,105,476},
+{41917,9,503},{42048,249,595},{42145,373,658},{42304,249,752},
+{42401,373,815},{42560,249,909},{42657,373,972},{42816,249,1066},
+{42913,373,1129},{43072,249,1223},{43169,373,1286},{43328,249,1380},
+{43425,373,1443},{43584,249,1537},{43681,373,1600},{43840,249,1694},
+{43937,373,1757},{44096,249,1851},{44193,369,1914},{44286,0,2431},
+{44352,249,2007},{44449,373,2070},{44608,249,2164},{44705,373,2227},
+{44864,249,2321},{44961,185,2384},{45008,185,2432},{45120,249,2479},
+{45217,373,2542},{45376,249,2636},{45473,373,2699},{45632,249,2793},
+{45729,373,2856},{45888,249,2950},{45985,373,3013},{46144,249,3107},
+{46241,373,3170},{46400,249,3264},{46497,373,3327},{46656,249,3421},
+{46753,373,3484},{46912,249,3578},{47009,373,3641},{47168,249,3735},
+{47265,373,3798},{47424,249,3892},{47521,373,3955},{47680,249,4049},
+{47777,373,4112},{47936,249,4206},{48033,153,4269},{48072,217,4309},
+{48192,249,4364},{48289,373,4427},{48448,249,4521},{48545,373,4584},
+{48704,69,4678},{48722,0,4308},{48723,173,4696},{48801,373,4740},
+{48960,249,4834},{49057,373,4897},{49216,249,4991},{49313,373,5054},
+{49472,249,5148},{49569,37,5211},{49579,333,5222},{49728,249,5306},
+{49825,165,5369},{49867,0,5221},{49868,201,5411},{49984,129,5462},
+{50017,117,5496},{50081,93,5526},{50105,6,9},{50107,269,5552},
+{50240,85,5620},{50262,0,5495},{50263,157,5642},{50337,373,5682},
+{50496,249,5776},{50593,373,5839},{50752,249,5933},{51520,37,5996},
+{51530,0,628},{51531,129,6006},{51564,73,6040},{51617,113,6059},
+{51646,0,6039},{51647,181,6088},{51693,69,6135},{51776,249,6153},
+{51873,341,6216},{51959,0,6134},{51960,25,6302},{52032,249,6309},
+{52129,373,6372},{52288,249,6466},{52385,373,6529},{52544,249,6623},
+{52641,373,6686},{52800,249,6780},{52897,373,6843},{53056,249,6937},
+{53153,373,7000},{53312,249,7094},{53409,373,7157},{53568,249,7251},
+{53665,373,7314},{53824,249,7408},{53921,373,7471},{54080,249,7565},
+{54177,373,7628},{54336,249,7722},{54433,373,7785},{54592,249,7879},
+{54689,373,7942},{54848,249,8036},{54945,169,8099},{54988,0,8788},
+{54989,197,8143},{55104,229,8193},{55162,0,8889},{55163,13,8251},
+{55201,373,8255},{55360,249,8349},{55457,373,8412},{55616,249,8506},
+{55713,373,8569},{55872,249,8663},{55969,245,8726},{56031,0,8142},
+{56032,121,8789},{56128,249,8820},{56225,21,8883},{56231,349,8890},
+{56384,249,8978},{56481,373,9041},{56640,249,9135},{56737,361,9198},
+{56828,0,9089},{56829,5,9289},{56896,249,9291},{56993,373,9354},
+{57152,249,9448},{57249,373,9511},{57408,249,9605},{57505,373,9668},
+{57664,249,9762},{57761,373,9825},{57920,249,9919},{58017,373,9982},
+{58176,249,10076},{58273,373,10139},{58432,249,10233},{58529,373,10296},
+{58688,249,10390},{58785,373,10453},{58944,249,10547},{59041,373,10610},
+{59200,249,10704},{59297,373,10767},{59456,249,10861},{59553,5,10924},
+{59555,365,10927},{59712,213,11019},{59766,33,11074},{59809,373,11083},
+{59968,249,11177},{60065,373,11240},{60224,105,11334},{60251,141,11362},
+{60321,317,11398},{60401,0,10926},{60402,49,11478},{60480,249,11491},
+{60577,241,11554},{60638,0,11073},{60639,125,11615},{60736,249,11647},
+{60833,33,11710},{60842,337,11720},{60992,249,11805},{61089,293,11868},
+{61163,0,12308},{61164,73,11942},{61248,249,11961},{61345,373,12024},
+{61504,85,12118},{61526,0,11719},{61527,157,12140},{61601,165,12180},
+{61643,0,11361},{61644,201,12222},{61760,137,12273},{61795,29,12309},
+{61803,0,12640},{61804,73,12317},{61857,373,12336},{62016,157,12430},
+{62056,0,12783},{62057,85,12470},{62113,133,12492},{62147,237,12527},
+{62272,209,12587},{62325,37,12641},{62369,373,12651},{62528,149,12745},
+{62566,97,12784},{62625,77,12809},{62645,0,12526},{62646,281,12829},
+{62717,5,12901},{62784,249,12903},{62881,373,12966},{63040,137,13060},
+{63075,0,12900},{63076,105,13095},{63137,373,13122},{63296,249,13216},
+{63393,373,13279},{63552,249,13373},{63649,373,13436},{63808,217,13530},
+{63863,29,13586},{63905,137,13594},{63940,10,11},{63943,41,13630},
+{63954,13,13642},{64064,249,16395},{64161,373,16458},{64320,249,16552},
+{64417,117,16615},{64448,49,16645},{64462,193,16658},{64576,37,16707},
+{64587,13,16717},{64591,0,8495},{64592,5,16721},{64595,61,16723},
+{64612,65,16739},{64630,33,16756},{64673,93,16765},{64697,0,4447},
+{64698,5,16789},{64701,149,16791},{64740,37,16829},{64751,61,16839},
+{64832,33,16855},{64842,209,16864},{64929,321,16917},{65011,45,16998},
+{65088,177,17010},{65134,37,17055},{65145,21,17065},{65185,33,17071},
+{65194,0,288},{65195,201,17080},{65248,49,17131},{65263,61,17144},
+};
+
+static const unsigned short cmap_HKgccs_B5_H_table[14] = {
+284,283,15812,7188,15813,15857,13418,248,247,5551,5550,13585,
+13629,13641,
+};
+
+static pdf_cmap cmap_HKgccs_B5_H = {
+	-1, "HKgccs-B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,35392,65278}, },
+	544, 544, (pdf_range*) cmap_HKgccs_B5_H_ranges,
+	14, 14, (unsigned short*) cmap_HKgccs_B5_H_table,
+};
+
+/* HKgccs-B5-V */
+
+static const pdf_range cmap_HKgccs_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+};
+
+static const unsigned short cmap_HKgccs_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_HKgccs_B5_V = {
+	-1, "HKgccs-B5-V", "HKgccs-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_HKgccs_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_HKgccs_B5_V_table,
+};
+
+/* HKm314-B5-H */
+
+static const pdf_range cmap_HKm314_B5_H_ranges[] = {
+{32,377,1},{41280,97,99},{41305,13,13743},{41309,133,128},
+{41377,337,162},{41462,6,0},{41464,25,249},{41536,249,256},
+{41633,373,319},{41792,249,413},{41889,105,476},{41917,9,503},
+{42048,249,595},{42145,373,658},{42304,249,752},{42401,373,815},
+{42560,249,909},{42657,373,972},{42816,249,1066},{42913,373,1129},
+{43072,249,1223},{43169,373,1286},{43328,249,1380},{43425,373,1443},
+{43584,249,1537},{43681,373,1600},{43840,249,1694},{43937,373,1757},
+{44096,249,1851},{44193,369,1914},{44286,0,2431},{44352,249,2007},
+{44449,373,2070},{44608,249,2164},{44705,373,2227},{44864,249,2321},
+{44961,185,2384},{45008,185,2432},{45120,249,2479},{45217,373,2542},
+{45376,249,2636},{45473,373,2699},{45632,249,2793},{45729,373,2856},
+{45888,249,2950},{45985,373,3013},{46144,249,3107},{46241,373,3170},
+{46400,249,3264},{46497,373,3327},{46656,249,3421},{46753,373,3484},
+{46912,249,3578},{47009,373,3641},{47168,249,3735},{47265,373,3798},
+{47424,249,3892},{47521,373,3955},{47680,249,4049},{47777,373,4112},
+{47936,249,4206},{48033,153,4269},{48072,217,4309},{48192,249,4364},
+{48289,373,4427},{48448,249,4521},{48545,373,4584},{48704,69,4678},
+{48722,0,4308},{48723,173,4696},{48801,373,4740},{48960,249,4834},
+{49057,373,4897},{49216,249,4991},{49313,373,5054},{49472,249,5148},
+{49569,37,5211},{49579,333,5222},{49728,249,5306},{49825,165,5369},
+{49867,0,5221},{49868,201,5411},{49984,129,5462},{50017,117,5496},
+{50081,93,5526},{50105,6,2},{50107,269,5552},{50240,85,5620},
+{50262,0,5495},{50263,157,5642},{50337,373,5682},{50496,249,5776},
+{50593,373,5839},{50752,249,5933},{51008,58,4},{51023,5,16456},
+{51025,130,19},{51058,5,16040},{51060,42,52},{51105,114,63},
+{51134,5,17329},{51136,90,92},{51159,5,17340},{51161,110,115},
+{51189,5,17346},{51191,30,143},{51264,150,151},{51302,5,17355},
+{51304,0,16306},{51305,9,17034},{51308,74,189},{51361,110,208},
+{51389,5,14363},{51391,5,14366},{51393,34,236},{51402,5,17383},
+{51404,14,245},{51408,5,14435},{51410,78,249},{51430,5,15377},
+{51432,26,269},{51439,5,14618},{51441,18,276},{51446,5,17394},
+{51448,10,281},{51451,5,14646},{51453,6,284},{51520,37,5996},
+{51530,0,628},{51531,129,6006},{51564,73,6040},{51617,113,6059},
+{51646,0,6039},{51647,181,6088},{51693,69,6135},{51776,249,6153},
+{51873,341,6216},{51959,0,6134},{51960,25,6302},{52032,249,6309},
+{52129,373,6372},{52288,249,6466},{52385,373,6529},{52544,249,6623},
+{52641,373,6686},{52800,249,6780},{52897,373,6843},{53056,249,6937},
+{53153,373,7000},{53312,249,7094},{53409,373,7157},{53568,249,7251},
+{53665,373,7314},{53824,249,7408},{53921,373,7471},{54080,249,7565},
+{54177,373,7628},{54336,249,7722},{54433,373,7785},{54592,249,7879},
+{54689,373,7942},{54848,249,8036},{54945,169,8099},{54988,0,8788},
+{54989,197,8143},{55104,229,8193},{55162,0,8889},{55163,13,8251},
+{55201,373,8255},{55360,249,8349},{55457,373,8412},{55616,249,8506},
+{55713,373,8569},{55872,249,8663},{55969,245,8726},{56031,0,8142},
+{56032,121,8789},{56128,249,8820},{56225,21,8883},{56231,349,8890},
+{56384,249,8978},{56481,373,9041},{56640,249,9135},{56737,361,9198},
+{56828,0,9089},{56829,5,9289},{56896,249,9291},{56993,373,9354},
+{57152,249,9448},{57249,373,9511},{57408,249,9605},{57505,373,9668},
+{57664,249,9762},{57761,373,9825},{57920,249,9919},{58017,373,9982},
+{58176,249,10076},{58273,373,10139},{58432,249,10233},{58529,373,10296},
+{58688,249,10390},{58785,373,10453},{58944,249,10547},{59041,373,10610},
+{59200,249,10704},{59297,373,10767},{59456,249,10861},{59553,5,10924},
+{59555,365,10927},{59712,213,11019},{59766,33,11074},{59809,373,11083},
+{59968,249,11177},{60065,373,11240},{60224,105,11334},{60251,141,11362},
+{60321,317,11398},{60401,0,10926},{60402,49,11478},{60480,249,11491},
+{60577,241,11554},{60638,0,11073},{60639,125,11615},{60736,249,11647},
+{60833,33,11710},{60842,337,11720},{60992,249,11805},{61089,293,11868},
+{61163,0,12308},{61164,73,11942},{61248,249,11961},{61345,373,12024},
+{61504,85,12118},{61526,0,11719},{61527,157,12140},{61601,165,12180},
+{61643,0,11361},{61644,201,12222},{61760,137,12273},{61795,29,12309},
+{61803,0,12640},{61804,73,12317},{61857,373,12336},{62016,157,12430},
+{62056,0,12783},{62057,85,12470},{62113,133,12492},{62147,237,12527},
+{62272,209,12587},{62325,37,12641},{62369,373,12651},{62528,149,12745},
+{62566,97,12784},{62625,77,12809},{62645,0,12526},{62646,281,12829},
+{62717,5,12901},{62784,249,12903},{62881,373,12966},{63040,137,13060},
+{63075,0,12900},{63076,105,13095},{63137,373,13122},{63296,249,13216},
+{63393,373,13279},{63552,249,13373},{63649,373,13436},{63808,217,13530},
+{63863,29,13586},{63905,137,13594},{63940,10,286},{63943,41,13630},
+{63954,13,13642},
+};
+
+static const unsigned short cmap_HKm314_B5_H_table[289] = {
+248,247,5551,5550,15725,14788,17305,15877,14058,14792,14653,17307,
+16418,17309,16436,17311,16035,16038,16465,16459,16463,17314,16474,16036,
+15805,15807,16476,16479,17316,16507,16514,16237,16523,17318,16531,16534,
+17319,16536,15999,15479,16039,16010,16024,16012,16545,14848,14755,16013,
+17320,16216,15804,15564,15150,15302,16011,16031,17196,17321,16136,16037,
+16009,15811,16002,16001,16020,16003,16008,17323,16017,17324,15996,16000,
+16015,15975,15992,15976,17325,14290,16205,17326,15998,16572,15971,16573,
+17327,16567,16055,16109,16234,16021,14664,15560,16588,16006,15482,15485,
+17332,16593,15730,15398,14059,16575,16640,15493,17333,14877,14325,14062,
+15967,16662,16671,16664,16675,16679,16681,16014,14447,16707,16710,16708,
+16713,15269,16727,16737,14060,16746,16386,16774,16314,16208,16022,16778,
+16321,15759,17345,16032,16150,16029,16786,14950,16028,16016,16797,14248,
+16798,16775,16034,16007,16004,16046,15220,15221,15218,16050,16044,16842,
+16884,16848,15018,16885,16888,16891,16901,15758,16910,15715,16930,16929,
+16931,16489,16431,14501,15605,15721,16987,15048,15808,14826,16384,16996,
+16994,16383,16026,17011,14697,17018,17354,16282,16053,15071,17096,16045,
+17358,16271,17359,15986,16042,17363,17120,14381,16341,15124,14056,17136,
+15997,17150,17157,14138,14150,14162,14061,15178,15173,17370,16094,14188,
+14187,14210,15977,15183,14214,17371,14216,17372,16077,14231,16909,14296,
+15217,14556,14304,14324,14355,16048,14349,16047,16049,16361,17380,16377,
+15961,16025,15966,15284,16043,14430,17385,15806,16005,15724,14449,14460,
+14466,16027,14472,15374,14382,14490,14475,15364,14057,17085,15309,14495,
+14235,14511,16023,14576,15357,17391,14213,14594,16298,16153,14617,17393,
+15974,16162,15742,15417,16033,16176,14633,16316,16272,2746,13585,13629,
+13641,
+};
+
+static pdf_cmap cmap_HKm314_B5_H = {
+	-1, "HKm314-B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,41280,65278}, },
+	273, 273, (pdf_range*) cmap_HKm314_B5_H_ranges,
+	289, 289, (unsigned short*) cmap_HKm314_B5_H_table,
+};
+
+/* HKm314-B5-V */
+
+static const pdf_range cmap_HKm314_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+};
+
+static const unsigned short cmap_HKm314_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_HKm314_B5_V = {
+	-1, "HKm314-B5-V", "HKm314-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_HKm314_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_HKm314_B5_V_table,
+};
+
+/* HKm471-B5-H */
+
+static const pdf_range cmap_HKm471_B5_H_ranges[] = {
+{32,377,1},{41280,97,99},{41305,13,13743},{41309,133,128},
+{41377,337,162},{41462,6,0},{41464,25,249},{41536,249,256},
+{41633,373,319},{41792,249,413},{41889,105,476},{41917,9,503},
+{42048,249,595},{42145,373,658},{42304,249,752},{42401,373,815},
+{42560,249,909},{42657,373,972},{42816,249,1066},{42913,373,1129},
+{43072,249,1223},{43169,373,1286},{43328,249,1380},{43425,373,1443},
+{43584,249,1537},{43681,373,1600},{43840,249,1694},{43937,373,1757},
+{44096,249,1851},{44193,369,1914},{44286,0,2431},{44352,249,2007},
+{44449,373,2070},{44608,249,2164},{44705,373,2227},{44864,249,2321},
+{44961,185,2384},{45008,185,2432},{45120,249,2479},{45217,373,2542},
+{45376,249,2636},{45473,373,2699},{45632,249,2793},{45729,373,2856},
+{45888,249,2950},{45985,373,3013},{46144,249,3107},{46241,373,3170},
+{46400,249,3264},{46497,373,3327},{46656,249,3421},{46753,373,3484},
+{46912,249,3578},{47009,373,3641},{47168,249,3735},{47265,373,3798},
+{47424,249,3892},{47521,373,3955},{47680,249,4049},{47777,373,4112},
+{47936,249,4206},{48033,153,4269},{48072,217,4309},{48192,249,4364},
+{48289,373,4427},{48448,249,4521},{48545,373,4584},{48704,69,4678},
+{48722,0,4308},{48723,173,4696},{48801,373,4740},{48960,249,4834},
+{49057,373,4897},{49216,249,4991},{49313,373,5054},{49472,249,5148},
+{49569,37,5211},{49579,333,5222},{49728,249,5306},{49825,165,5369},
+{49867,0,5221},{49868,201,5411},{49984,129,5462},{50017,117,5496},
+{50081,93,5526},{50105,6,2},{50107,269,5552},{50240,85,5620},
+{50262,0,5495},{50263,157,5642},{50337,373,5682},{50496,249,5776},
+{50593,373,5839},{50752,249,5933},{51520,37,5996},{51530,0,628},
+{51531,129,6006},{51564,73,6040},{51617,113,6059},{51646,0,6039},
+{51647,181,6088},{51693,69,6135},{51776,249,6153},{51873,341,6216},
+{51959,0,6134},{51960,25,6302},{52032,249,6309},{52129,373,6372},
+{52288,249,6466},{52385,373,6529},{52544,249,6623},{52641,373,6686},
+{52800,249,6780},{52897,373,6843},{53056,249,6937},{53153,373,7000},
+{53312,249,7094},{53409,373,7157},{53568,249,7251},{53665,373,7314},
+{53824,249,7408},{53921,373,7471},{54080,249,7565},{54177,373,7628},
+{54336,249,7722},{54433,373,7785},{54592,249,7879},{54689,373,7942},
+{54848,249,8036},{54945,169,8099},{54988,0,8788},{54989,197,8143},
+{55104,229,8193},{55162,0,8889},{55163,13,8251},{55201,373,8255},
+{55360,249,8349},{55457,373,8412},{55616,249,8506},{55713,373,8569},
+{55872,249,8663},{55969,245,8726},{56031,0,8142},{56032,121,8789},
+{56128,249,8820},{56225,21,8883},{56231,349,8890},{56384,249,8978},
+{56481,373,9041},{56640,249,9135},{56737,361,9198},{56828,0,9089},
+{56829,5,9289},{56896,249,9291},{56993,373,9354},{57152,249,9448},
+{57249,373,9511},{57408,249,9605},{57505,373,9668},{57664,249,9762},
+{57761,373,9825},{57920,249,9919},{58017,373,9982},{58176,249,10076},
+{58273,373,10139},{58432,249,10233},{58529,373,10296},{58688,249,10390},
+{58785,373,10453},{58944,249,10547},{59041,373,10610},{59200,249,10704},
+{59297,373,10767},{59456,249,10861},{59553,5,10924},{59555,365,10927},
+{59712,213,11019},{59766,33,11074},{59809,373,11083},{59968,249,11177},
+{60065,373,11240},{60224,105,11334},{60251,141,11362},{60321,317,11398},
+{60401,0,10926},{60402,49,11478},{60480,249,11491},{60577,241,11554},
+{60638,0,11073},{60639,125,11615},{60736,249,11647},{60833,33,11710},
+{60842,337,11720},{60992,249,11805},{61089,293,11868},{61163,0,12308},
+{61164,73,11942},{61248,249,11961},{61345,373,12024},{61504,85,12118},
+{61526,0,11719},{61527,157,12140},{61601,165,12180},{61643,0,11361},
+{61644,201,12222},{61760,137,12273},{61795,29,12309},{61803,0,12640},
+{61804,73,12317},{61857,373,12336},{62016,157,12430},{62056,0,12783},
+{62057,85,12470},{62113,133,12492},{62147,237,12527},{62272,209,12587},
+{62325,37,12641},{62369,373,12651},{62528,149,12745},{62566,97,12784},
+{62625,77,12809},{62645,0,12526},{62646,281,12829},{62717,5,12901},
+{62784,249,12903},{62881,373,12966},{63040,137,13060},{63075,0,12900},
+{63076,105,13095},{63137,373,13122},{63296,249,13216},{63393,373,13279},
+{63552,249,13373},{63649,373,13436},{63808,217,13530},{63863,29,13586},
+{63905,137,13594},{63940,10,4},{63943,41,13630},{63954,13,13642},
+{64064,46,7},{64076,5,14796},{64078,14,19},{64082,5,17310},
+{64084,14,23},{64088,5,16456},{64090,18,27},{64095,5,17313},
+{64097,22,32},{64103,5,16479},{64105,6,38},{64107,5,16506},
+{64109,70,40},{64161,42,58},{64172,5,16040},{64174,182,69},
+{64220,9,17329},{64223,110,115},{64251,5,17335},{64253,6,143},
+{64320,190,145},{64368,5,17346},{64370,38,193},{64380,5,15220},
+{64382,0,14242},{64417,10,203},{64420,5,17348},{64422,182,206},
+{64468,5,17353},{64470,6,252},{64472,5,17355},{64474,0,16306},
+{64475,5,17034},{64477,66,254},{64494,9,17362},{64497,30,271},
+{64505,5,17365},{64507,14,279},{64576,206,283},{64628,5,17376},
+{64630,34,335},{64673,0,14364},{64674,5,14366},{64676,62,344},
+{64692,5,17383},{64694,14,360},{64698,5,14435},{64700,118,364},
+{64730,5,17389},{64732,0,15357},{64733,5,15377},{64735,82,394},
+{64756,5,17394},{64758,34,415},
+};
+
+static const unsigned short cmap_HKm471_B5_H_table[424] = {
+248,247,5551,5550,13585,13629,13641,15725,14788,17305,16207,15877,
+17306,15246,14058,14792,14653,17307,16418,17308,14789,17309,16436,16035,
+16038,17312,16465,16459,16463,16468,16760,16138,16474,16036,15805,17315,
+15807,16476,16483,17316,16509,16514,16237,17317,16523,17318,16185,16531,
+16534,17319,16536,15999,15479,16039,16899,16081,16010,16024,16012,16545,
+15747,14848,14755,16013,17320,16216,15804,16546,15564,15150,15302,16011,
+16031,17196,17321,16136,16037,16009,15811,16002,16001,16020,17322,16003,
+16008,17323,16017,17324,15996,16000,16015,17189,15975,15992,15976,17325,
+14290,16205,17326,15998,16572,15971,16573,17327,16236,16121,16567,16055,
+16109,16234,14758,17328,16021,14664,15560,16588,16006,16584,15482,15485,
+17332,16593,15730,16596,15398,14059,16602,16601,16575,15745,16625,16640,
+15493,17333,14877,14325,14062,15967,16662,17083,16671,17334,16664,16675,
+16674,16679,17337,16681,17338,15829,16111,15754,17339,14891,17340,16696,
+17341,16014,14896,14447,16707,16710,16708,16713,15269,16727,17342,16737,
+14060,16746,15748,16386,16774,16314,17343,16325,16208,16022,17344,16778,
+16321,15759,17345,16032,16150,16029,16782,16786,14950,16028,17295,16016,
+16797,17238,14248,16798,16793,16775,16034,16799,16007,16004,16046,15218,
+15993,15981,16050,17350,16044,16842,16884,17351,16848,15018,16862,16859,
+16872,17352,16374,16857,15682,16885,16888,16891,16901,15758,16910,15715,
+16930,16929,16931,16489,16431,16962,14501,16966,15605,15721,15614,16987,
+15048,15808,14826,16384,16996,16994,16383,16026,17011,14697,17018,17027,
+16282,16053,15127,17036,17040,15071,17357,17093,17096,16045,17358,16271,
+17359,15986,15984,17360,16042,17361,16297,17112,16371,17120,15104,17175,
+14381,15987,16341,15124,14056,17140,15118,17132,17136,15997,17367,17150,
+17157,16346,15857,14131,15741,17368,14138,14144,14146,14150,14162,16159,
+17369,14061,15178,14174,15173,17370,16094,14185,14188,14187,14190,14207,
+14203,14210,15977,15183,14214,17371,14216,17372,16077,14231,16909,17373,
+14268,17374,14296,15217,15994,17375,14556,14304,14318,14324,14355,16048,
+17378,16365,14349,16047,16274,14358,14363,16290,16049,4938,17379,16361,
+17380,16377,15763,17381,15961,17382,14391,16281,16025,15966,15284,16043,
+14430,17385,15806,16005,15724,14449,16096,17386,14460,17387,16056,14466,
+16027,17388,14472,15374,14382,14490,14475,15364,14057,17085,15309,14495,
+15838,14235,15315,14511,16023,14550,16181,14560,16437,14576,17391,14213,
+14594,15836,17392,16298,14603,16153,14606,14617,17393,15420,14618,15418,
+14619,15974,16162,15742,15985,15417,16033,16176,14633,16316,14646,17396,
+14647,16272,17397,2746,
+};
+
+static pdf_cmap cmap_HKm471_B5_H = {
+	-1, "HKm471-B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,41280,65278}, },
+	294, 294, (pdf_range*) cmap_HKm471_B5_H_ranges,
+	424, 424, (unsigned short*) cmap_HKm471_B5_H_table,
+};
+
+/* HKm471-B5-V */
+
+static const pdf_range cmap_HKm471_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+};
+
+static const unsigned short cmap_HKm471_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_HKm471_B5_V = {
+	-1, "HKm471-B5-V", "HKm471-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_HKm471_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_HKm471_B5_V_table,
+};
+
+/* HKscs-B5-H */
+
+static const pdf_range cmap_HKscs_B5_H_ranges[] = {
+{32,377,1},{34624,149,18965},{34663,73,19003},{34682,17,19088},
+{34721,249,19093},{34880,85,17609},{34902,161,18785},{34977,29,18826},
+{34985,5,18844},{35136,5,17716},{35139,0,17718},{35142,13,17719},
+{35148,6,0},{35150,9,17724},{35153,0,17306},{35154,177,17727},
+{35233,17,17772},{35238,0,17314},{35243,14,2},{35248,9,17779},
+{35253,41,17782},{35265,9,17793},{35269,37,17796},{35279,0,17340},
+{35280,33,17806},{35289,18,6},{35294,9,17817},{35297,10,11},
+{35300,21,17821},{35306,5,17317},{35308,53,17827},{35322,0,17321},
+{35323,13,17841},{35392,6,14},{35395,37,17163},{35405,0,17846},
+{35406,45,17174},{35418,0,17847},{35419,9,17187},{35422,0,17848},
+{35423,13,17191},{35428,49,17196},{35441,0,17849},{35442,9,17210},
+{35446,6,16},{35448,5,17216},{35450,18,18},{35489,25,17223},
+{35496,0,17854},{35497,5,17231},{35500,17,17234},{35506,13,17240},
+{35510,14,23},{35515,49,17249},{35529,9,17263},{35532,0,17857},
+{35534,29,17268},{35542,5,17858},{35544,17,17278},{35551,25,17285},
+{35558,6,27},{35560,49,17861},{35574,33,17874},{35648,0,17883},
+{35649,5,17292},{35651,5,17884},{35653,30,29},{35661,13,17298},
+{35665,9,17890},{35669,9,17893},{35672,14,37},{35676,17,17897},
+{35681,0,17319},{35682,21,17902},{35688,0,17324},{35689,85,17908},
+{35745,121,17930},{35776,113,17631},{35806,125,17660},{35904,133,18849},
+{35938,0,19022},{35939,109,18883},{36001,17,18911},{36007,121,18916},
+{36041,13,18947},{36046,49,18951},{36059,6,41},{36061,29,19024},
+{36070,97,19032},{36160,0,19057},{36162,117,19058},{36192,5,17961},
+{36194,0,17338},{36195,17,17963},{36200,10,43},{36203,9,17968},
+{36206,0,17342},{36207,25,17971},{36214,0,17343},{36215,9,17978},
+{36218,10,46},{36221,5,17982},{36257,13,17984},{36261,0,17346},
+{36262,5,17988},{36264,6,49},{36266,45,17990},{36278,0,17351},
+{36279,45,18002},{36291,0,17352},{36292,213,18014},{36346,0,17401},
+{36347,13,18068},{36416,17,14123},{36421,0,18072},{36422,137,14128},
+{36457,6,51},{36459,5,18073},{36461,5,14166},{36463,0,11752},
+{36464,21,14169},{36470,0,18075},{36471,13,14175},{36475,0,18076},
+{36476,5,14180},{36478,0,289},{36513,17,14182},{36518,0,18077},
+{36519,13,14187},{36523,0,4203},{36524,29,14192},{36532,0,4902},
+{36533,9,14201},{36536,0,18078},{36537,61,14205},{36553,0,18079},
+{36554,9,14221},{36557,0,1643},{36558,5,14225},{36560,0,4910},
+{36561,77,14228},{36581,0,18080},{36582,33,14248},{36591,0,18081},
+{36592,21,14257},{36598,0,18082},{36599,29,14264},{36672,89,14272},
+{36695,10,53},{36698,17,14297},{36703,0,18084},{36704,25,14302},
+{36711,10,56},{36714,13,14311},{36718,0,8877},{36719,37,14316},
+{36729,0,18086},{36730,17,14327},{36769,57,14332},{36784,0,18087},
+{36785,77,14348},{36805,10,59},{36808,5,14369},{36810,10,62},
+{36813,49,14374},{36826,0,18091},{36827,29,14387},{36835,0,18092},
+{36836,93,14396},{36860,10,65},{36928,81,14422},{36949,0,18094},
+{36950,21,14444},{36956,9,18095},{36959,53,14451},{36973,10,68},
+{36976,37,14467},{36986,0,14057},{36987,13,14477},{37025,17,14481},
+{37030,0,18099},{37031,65,14486},{37048,0,18100},{37049,137,14503},
+{37084,0,5009},{37085,77,14539},{37105,0,5796},{37106,49,14560},
+{37184,145,14573},{37221,0,18101},{37222,29,14610},{37230,0,18102},
+{37231,57,14618},{37246,0,18103},{37281,6,71},{37283,109,14634},
+{37311,0,12402},{37312,29,14663},{37320,0,18105},{37321,213,14672},
+{37440,13,14726},{37444,0,14728},{37445,121,14731},{37476,0,18106},
+{37477,29,14763},{37485,0,18107},{37486,65,14772},{37537,53,14789},
+{37551,5,281},{37553,6,73},{37555,81,14803},{37576,0,16300},
+{37577,29,14825},{37585,0,10620},{37586,73,14834},{37605,0,18108},
+{37606,45,14853},{37618,0,18109},{37619,45,14865},{37696,157,14877},
+{37736,0,18110},{37737,85,14917},{37793,33,14939},{37802,0,18111},
+{37803,89,14948},{37826,0,18112},{37827,133,14971},{37861,0,18113},
+{37862,5,15005},{37864,0,18114},{37865,5,15008},{37867,0,18115},
+{37868,73,15010},{37952,21,15029},{37958,6,75},{37960,193,15036},
+{38009,0,18117},{38010,17,15086},{38049,161,15091},{38090,6,77},
+{38092,201,15134},{38208,49,15185},{38221,0,18119},{38222,45,15198},
+{38234,0,18120},{38235,13,15210},{38239,0,18121},{38240,121,15215},
+{38305,145,15246},{38342,0,18122},{38343,69,15283},{38361,0,6171},
+{38362,145,15302},{38464,13,15339},{38468,0,15919},{38469,45,15344},
+{38481,0,18123},{38482,93,15357},{38506,0,18124},{38507,77,15382},
+{38561,201,15402},{38612,0,18125},{38613,93,15453},{38637,0,15478},
+{38638,53,15478},{38652,0,11044},{38653,5,15493},{38720,249,15495},
+{38817,373,15558},{38976,13,15652},{38980,5,18126},{38982,161,15658},
+{39023,0,18128},{39024,17,15700},{39029,5,18129},{39031,0,15705},
+{39032,5,18131},{39034,0,15706},{39035,13,18133},{39073,5,18137},
+{39075,0,15707},{39076,41,18139},{39087,0,15708},{39088,13,18150},
+{39092,34,79},{39101,5,15711},{39103,9,18158},{39106,14,88},
+{39110,5,15715},{39112,37,18163},{39122,0,17357},{39123,17,18173},
+{39128,5,17358},{39130,6,92},{39132,9,18179},{39135,0,17364},
+{39136,9,18182},{39139,0,15717},{39140,9,18185},{39143,0,15718},
+{39144,17,18188},{39149,0,15719},{39150,5,18193},{39152,14,94},
+{39156,5,17365},{39158,21,18197},{39164,10,98},{39232,5,18204},
+{39234,22,101},{39240,25,18208},{39247,0,15725},{39248,13,18215},
+{39252,0,17369},{39253,25,18219},{39260,0,17370},{39261,25,18226},
+{39268,0,17372},{39269,17,18233},{39274,0,15726},{39275,9,18238},
+{39278,0,15727},{39279,21,18241},{39285,0,15728},{39286,5,18247},
+{39288,0,15729},{39289,21,18249},{39329,22,107},{39335,25,18258},
+{39342,0,15731},{39343,9,18265},{39346,0,17374},{39347,9,18268},
+{39350,0,15732},{39351,9,18271},{39354,0,15733},{39355,57,18274},
+{39370,0,17376},{39371,5,18289},{39373,0,17378},{39374,17,18291},
+{39379,0,17379},{39380,5,18296},{39382,0,17381},{39383,29,18298},
+{39391,0,17375},{39392,5,18306},{39394,26,113},{39401,21,18311},
+{39407,0,17405},{39408,13,18317},{39412,0,15735},{39413,37,18321},
+{39488,37,18331},{39498,10,120},{39501,45,18342},{39513,0,15738},
+{39514,17,18354},{39519,10,123},{39522,13,18360},{39526,22,126},
+{39532,25,18366},{39539,10,132},{39542,29,18374},{39550,0,15742},
+{39585,5,18382},{39587,10,135},{39590,9,18385},{39593,6,138},
+{39595,25,18388},{39602,0,15743},{39603,13,18395},{39607,26,140},
+{39614,33,18402},{39623,0,15747},{39624,29,18411},{39632,10,147},
+{39635,21,18420},{39641,9,15750},{39644,21,18426},{39650,10,150},
+{39653,9,18433},{39656,6,153},{39658,13,18436},{39662,0,17330},
+{39663,9,18440},{39666,0,15756},{39667,9,18443},{39670,0,15757},
+{39671,13,18446},{39675,0,15758},{39676,9,18450},{39744,21,18453},
+{39750,0,15759},{39751,9,18459},{39754,0,15760},{39755,33,18462},
+{39764,0,15762},{39765,9,18471},{39768,22,155},{39774,5,15766},
+{39776,0,18477},{39778,53,18478},{39792,13,15768},{39796,5,18492},
+{39798,10,161},{39801,5,18494},{39803,14,164},{39841,6,168},
+{39843,5,15779},{39845,5,18498},{39847,13,15781},{39851,6,170},
+{39853,5,18501},{39855,0,15786},{39856,5,18503},{39858,29,15787},
+{39866,13,18505},{39870,6,172},{39872,21,15796},{39878,0,10969},
+{39879,9,18510},{39882,22,174},{39888,5,15805},{39890,14,180},
+{39894,5,18518},{39896,9,15809},{39899,5,18520},{39901,26,184},
+{39908,9,18524},{39911,6,191},{39913,9,15817},{39916,6,193},
+{39918,5,15821},{39920,9,18529},{39923,0,15823},{39924,5,18532},
+{39926,6,195},{39928,5,15825},{39930,0,18535},{39931,5,15827},
+{39933,5,18536},{40000,5,15829},{40002,6,197},{40004,9,15832},
+{40007,14,199},{40011,5,18541},{40013,21,15837},{40019,14,203},
+{40023,17,15845},{40028,6,207},{40030,5,18546},{40032,14,209},
+{40036,9,15853},{40039,30,213},{40047,13,15859},{40051,5,18554},
+{40053,5,15863},{40055,14,221},{40059,5,15867},{40061,6,225},
+{40097,5,15870},{40099,5,18559},{40101,0,15872},{40102,5,18561},
+{40104,5,15873},{40106,10,227},{40109,5,15876},{40111,5,18565},
+{40113,37,15878},{40123,10,230},{40126,17,15890},{40131,9,18568},
+{40134,29,15895},{40142,10,233},{40145,9,15905},{40148,13,18572},
+{40152,9,15908},{40155,0,18576},{40156,37,15911},{40166,0,18577},
+{40167,9,15921},{40170,0,18578},{40171,5,15924},{40173,0,18579},
+{40174,45,15926},{40186,9,18580},{40189,6,236},{40256,0,17384},
+{40257,17,18584},{40262,0,15939},{40263,5,18589},{40265,0,15940},
+{40266,5,18591},{40268,5,15942},{40270,14,238},{40274,9,18595},
+{40277,10,242},{40280,5,18599},{40282,0,3340},{40283,21,18601},
+{40289,14,245},{40293,73,18608},{40312,6,249},{40314,13,18627},
+{40318,0,15951},{40353,13,18631},{40357,13,15952},{40361,10,251},
+{40364,5,15957},{40366,5,18637},{40368,0,15960},{40369,5,18639},
+{40371,18,254},{40376,13,18643},{40380,5,15964},{40382,0,18647},
+{40383,5,15966},{40385,5,18648},{40387,6,259},{40389,5,18650},
+{40391,5,15970},{40393,6,261},{40395,5,18653},{40397,17,15973},
+{40402,0,18655},{40403,9,15978},{40406,13,18656},{40410,133,15981},
+{40444,0,18660},{40445,5,16015},{40512,9,16017},{40515,0,18661},
+{40516,105,16021},{40543,0,18662},{40544,9,16049},{40547,0,18663},
+{40548,5,16052},{40550,5,18664},{40552,10,263},{40555,21,18667},
+{40561,10,266},{40564,9,18674},{40567,5,16058},{40569,22,269},
+{40609,5,16063},{40611,0,18680},{40612,9,16065},{40615,5,18681},
+{40617,10,275},{40620,5,16070},{40622,0,18684},{40623,9,16072},
+{40626,5,18685},{40628,6,278},{40630,5,16076},{40632,6,280},
+{40634,5,18689},{40636,0,16079},{40637,5,18691},{40639,5,16080},
+{40641,9,18693},{40644,5,16082},{40646,0,18696},{40647,13,16084},
+{40651,5,18697},{40653,0,16089},{40654,5,18699},{40656,5,16090},
+{40658,6,282},{40660,5,18702},{40662,5,16093},{40664,5,18704},
+{40666,81,16095},{40687,0,9398},{40688,5,16117},{40690,0,18706},
+{40691,9,16119},{40694,9,18707},{40697,5,16122},{40699,14,284},
+{40768,9,16127},{40771,0,18711},{40772,13,16130},{40776,0,18712},
+{40777,5,16134},{40779,5,18713},{40781,73,16136},{40800,0,13585},
+{40801,17,16156},{40806,0,14661},{40807,5,18715},{40809,25,16163},
+{40816,0,18717},{40817,53,16170},{40865,77,16184},{40885,0,18718},
+{40886,17,16204},{40891,0,18719},{40892,9,16209},{40895,10,288},
+{40898,33,16213},{40907,6,291},{40909,25,16224},{40916,0,18723},
+{40917,9,16232},{40920,0,14910},{40921,41,16236},{40932,0,18724},
+{40933,77,16247},{40953,0,18725},{40954,17,16267},{41024,0,18726},
+{41025,21,16272},{41031,0,18727},{41032,49,16278},{41045,0,18728},
+{41046,49,16291},{41059,0,14353},{41060,33,16305},{41069,0,18729},
+{41070,33,16314},{41079,0,1522},{41080,9,16324},{41083,0,18730},
+{41084,9,16327},{41121,6,293},{41123,13,16331},{41127,0,18732},
+{41128,113,16335},{41157,0,18733},{41158,37,16364},{41168,0,18734},
+{41169,13,16374},{41173,0,15086},{41174,33,16379},{41183,0,9341},
+{41184,9,16389},{41187,6,295},{41189,5,16393},{41191,25,18736},
+{41198,0,17332},{41199,9,18743},{41202,0,17336},{41203,45,18746},
+{41280,97,99},{41305,13,13743},{41309,133,128},{41377,337,162},
+{41462,6,297},{41464,25,249},{41536,249,256},{41633,373,319},
+{41792,249,413},{41889,105,476},{41917,9,503},{42048,249,595},
+{42145,373,658},{42304,249,752},{42401,373,815},{42560,249,909},
+{42657,373,972},{42816,249,1066},{42913,373,1129},{43072,249,1223},
+{43169,373,1286},{43328,249,1380},{43425,373,1443},{43584,249,1537},
+{43681,373,1600},{43840,249,1694},{43937,373,1757},{44096,249,1851},
+{44193,369,1914},{44286,0,2431},{44352,249,2007},{44449,373,2070},
+{44608,249,2164},{44705,373,2227},{44864,249,2321},{44961,185,2384},
+{45008,185,2432},{45120,249,2479},{45217,373,2542},{45376,249,2636},
+{45473,373,2699},{45632,249,2793},{45729,373,2856},{45888,249,2950},
+{45985,373,3013},{46144,249,3107},{46241,373,3170},{46400,249,3264},
+{46497,373,3327},{46656,249,3421},{46753,373,3484},{46912,249,3578},
+{47009,373,3641},{47168,249,3735},{47265,373,3798},{47424,249,3892},
+{47521,373,3955},{47680,249,4049},{47777,373,4112},{47936,249,4206},
+{48033,153,4269},{48072,217,4309},{48192,249,4364},{48289,373,4427},
+{48448,249,4521},{48545,373,4584},{48704,69,4678},{48722,0,4308},
+{48723,173,4696},{48801,373,4740},{48960,249,4834},{49057,373,4897},
+{49216,249,4991},{49313,373,5054},{49472,249,5148},{49569,37,5211},
+{49579,333,5222},{49728,249,5306},{49825,165,5369},{49867,0,5221},
+{49868,201,5411},{49984,129,5462},{50017,117,5496},{50081,93,5526},
+{50105,6,299},{50107,269,5552},{50240,85,5620},{50262,0,5495},
+{50263,157,5642},{50337,373,5682},{50496,249,5776},{50593,373,5839},
+{50752,249,5933},{50849,117,506},{50879,61,537},{50896,9,554},
+{50900,0,558},{50902,0,560},{50904,21,13747},{50912,121,13754},
+{51008,249,13785},{51105,373,13848},{51264,249,13942},{51361,13,14005},
+{51405,25,14049},{51412,9,17606},{51415,33,17692},{51424,0,18846},
+{51425,29,17701},{51433,0,18847},{51434,25,17709},{51441,0,18848},
+{51445,37,18834},{51520,37,5996},{51530,0,628},{51531,129,6006},
+{51564,73,6040},{51617,113,6059},{51646,0,6039},{51647,181,6088},
+{51693,69,6135},{51776,249,6153},{51873,341,6216},{51959,0,6134},
+{51960,25,6302},{52032,249,6309},{52129,373,6372},{52288,249,6466},
+{52385,373,6529},{52544,249,6623},{52641,373,6686},{52800,249,6780},
+{52897,373,6843},{53056,249,6937},{53153,373,7000},{53312,249,7094},
+{53409,373,7157},{53568,249,7251},{53665,373,7314},{53824,249,7408},
+{53921,373,7471},{54080,249,7565},{54177,373,7628},{54336,249,7722},
+{54433,373,7785},{54592,249,7879},{54689,373,7942},{54848,249,8036},
+{54945,169,8099},{54988,0,8788},{54989,197,8143},{55104,229,8193},
+{55162,0,8889},{55163,13,8251},{55201,373,8255},{55360,249,8349},
+{55457,373,8412},{55616,249,8506},{55713,373,8569},{55872,249,8663},
+{55969,245,8726},{56031,0,8142},{56032,121,8789},{56128,249,8820},
+{56225,21,8883},{56231,349,8890},{56384,249,8978},{56481,373,9041},
+{56640,249,9135},{56737,361,9198},{56828,0,9089},{56829,5,9289},
+{56896,249,9291},{56993,373,9354},{57152,249,9448},{57249,373,9511},
+{57408,249,9605},{57505,373,9668},{57664,249,9762},{57761,373,9825},
+{57920,249,9919},{58017,373,9982},{58176,249,10076},{58273,373,10139},
+{58432,249,10233},{58529,373,10296},{58688,249,10390},{58785,373,10453},
+{58944,249,10547},{59041,373,10610},{59200,249,10704},{59297,373,10767},
+{59456,249,10861},{59553,5,10924},{59555,365,10927},{59712,213,11019},
+{59766,33,11074},{59809,373,11083},{59968,249,11177},{60065,373,11240},
+{60224,105,11334},{60251,141,11362},{60321,317,11398},{60401,0,10926},
+{60402,49,11478},{60480,249,11491},{60577,241,11554},{60638,0,11073},
+{60639,125,11615},{60736,249,11647},{60833,33,11710},{60842,337,11720},
+{60992,249,11805},{61089,293,11868},{61163,0,12308},{61164,73,11942},
+{61248,249,11961},{61345,373,12024},{61504,85,12118},{61526,0,11719},
+{61527,157,12140},{61601,165,12180},{61643,0,11361},{61644,201,12222},
+{61760,137,12273},{61795,29,12309},{61803,0,12640},{61804,73,12317},
+{61857,373,12336},{62016,157,12430},{62056,0,12783},{62057,85,12470},
+{62113,133,12492},{62147,237,12527},{62272,209,12587},{62325,37,12641},
+{62369,373,12651},{62528,149,12745},{62566,97,12784},{62625,77,12809},
+{62645,0,12526},{62646,281,12829},{62717,5,12901},{62784,249,12903},
+{62881,373,12966},{63040,137,13060},{63075,0,12900},{63076,105,13095},
+{63137,373,13122},{63296,249,13216},{63393,373,13279},{63552,249,13373},
+{63649,373,13436},{63808,217,13530},{63863,29,13586},{63905,137,13594},
+{63940,10,301},{63943,41,13630},{63954,13,13642},{63958,161,14056},
+{64064,121,16395},{64095,0,2106},{64096,21,16427},{64102,0,2557},
+{64103,93,16434},{64161,29,16458},{64169,5,18758},{64171,69,16468},
+{64189,0,781},{64190,25,16487},{64197,0,363},{64198,57,16495},
+{64213,0,2144},{64214,161,16511},{64320,29,16552},{64328,0,16002},
+{64329,37,16561},{64339,0,18760},{64340,101,16572},{64366,0,18761},
+{64367,61,16599},{64417,5,16615},{64419,0,18762},{64420,77,16618},
+{64440,0,3107},{64441,21,16639},{64447,0,18763},{64448,49,16645},
+{64461,0,18764},{64462,145,16658},{64499,0,6116},{64500,17,16696},
+{64505,0,16014},{64506,17,16702},{64576,37,16707},{64586,0,18765},
+{64587,13,16717},{64591,0,8495},{64592,5,16721},{64594,0,18766},
+{64595,61,16723},{64611,0,18767},{64612,29,16739},{64620,6,304},
+{64622,25,16749},{64629,0,18769},{64630,33,16756},{64673,93,16765},
+{64697,0,4447},{64698,5,16789},{64700,5,18770},{64702,53,16792},
+{64716,0,18772},{64717,81,16807},{64738,6,306},{64740,37,16829},
+{64750,0,18774},{64751,5,16839},{64753,0,1219},{64754,49,16842},
+{64832,33,16855},{64841,0,18775},{64842,125,16864},{64874,0,18776},
+{64875,77,16897},{64929,85,16917},{64951,6,308},{64953,5,16941},
+{64955,0,3237},{64956,153,16944},{64995,0,18777},{64996,49,16984},
+{65009,6,310},{65011,45,16998},{65088,69,17010},{65106,0,15728},
+{65107,101,17029},{65133,10,312},{65136,29,17057},{65144,0,18780},
+{65145,21,17065},{65185,33,17071},{65194,0,288},{65195,197,17080},
+{65245,0,7080},{65246,5,18781},{65248,49,17131},{65261,5,18783},
+{65263,61,17144},
+};
+
+static const unsigned short cmap_HKscs_B5_H_table[315] = {
+17723,17347,17388,17777,17387,17778,17308,17815,17310,17816,17311,17313,
+17820,17315,17845,17161,17214,17850,17851,17219,17852,17221,17853,17855,
+17245,17856,17247,17860,17371,17294,17886,17295,17887,17296,17888,17297,
+17889,17303,17896,17304,17348,19023,18964,17339,17312,17341,17344,17981,
+17345,17337,17325,4181,14164,3381,14296,18083,18085,14309,10178,18088,
+14368,18089,18090,4940,16377,18093,14420,2510,3015,14466,18098,14633,
+18104,284,283,18116,7430,10657,18118,17354,18154,15709,18155,17356,
+15710,18156,17402,18157,15713,18161,15714,18162,18178,17361,15720,18195,
+15721,18196,15722,18203,17367,17404,15723,18206,15724,18207,17368,18255,
+15730,18256,17349,18257,17350,15734,18308,17323,18309,17383,18310,17385,
+15736,18341,15737,17327,18359,15739,17389,18364,15740,17390,18365,17407,
+15741,18373,17393,17395,18384,17394,17400,17396,15744,18399,15745,18400,
+15746,18401,17335,15748,18419,15749,15753,18432,15754,15755,17328,15763,
+18474,15764,18475,15765,18476,12112,15773,5925,13037,15776,18496,15777,
+15778,18497,18500,15785,15795,18509,15803,18513,15804,18514,17360,18515,
+18516,15807,18517,15808,15812,7188,15813,18522,15814,18523,15815,15816,
+18527,16890,18528,4841,18534,11438,18538,18539,15835,18540,15836,6756,
+18543,15844,18544,18545,15850,15851,18548,5124,18549,18550,8996,18551,
+15857,13418,18552,15858,18553,8849,18556,15866,18557,18558,15869,18563,
+15875,18564,18567,6023,2399,18571,15903,7833,15938,18583,18593,15944,
+18594,15945,15946,18598,9665,17353,15948,18607,15949,17397,15950,18635,
+15956,18636,15961,18641,15962,18642,15963,15968,1510,18652,15972,16054,
+18666,16055,16056,18673,16057,18677,16060,18678,16061,18679,16062,1832,
+16069,18683,16075,18687,18688,16078,18701,16092,18710,16124,6150,16126,
+18720,16212,18721,3970,18722,16330,18731,18735,15049,248,247,5551,
+5550,13585,13629,13641,16385,18768,3193,18773,6333,3261,3278,18778,
+18779,17055,3716,
+};
+
+static pdf_cmap cmap_HKscs_B5_H = {
+	-1, "HKscs-B5-H", "", 0, 0, 2,
+	{ {1,0,128},{2,34624,65278}, },
+	993, 993, (pdf_range*) cmap_HKscs_B5_H_ranges,
+	315, 315, (unsigned short*) cmap_HKscs_B5_H_table,
+};
+
+/* HKscs-B5-V */
+
+static const pdf_range cmap_HKscs_B5_V_ranges[] = {
+{41291,0,13646},{41306,0,13743},{41308,0,13745},{41309,5,130},
+{41313,5,134},{41317,5,138},{41321,5,142},{41325,5,146},
+{41329,5,150},{41333,5,154},{41337,5,158},{41443,0,13647},
+{50916,5,14097},
+};
+
+static const unsigned short cmap_HKscs_B5_V_table[] = { 0 };
+
+static pdf_cmap cmap_HKscs_B5_V = {
+	-1, "HKscs-B5-V", "HKscs-B5-H", 0, 1, 0,
+	{ {0,0,0}, },
+	13, 13, (pdf_range*) cmap_HKscs_B5_V_ranges,
+	0, 0, (unsigned short*) cmap_HKscs_B5_V_table,
+};
+
+/* UniCNS-UCS2-H */
+
+static const pdf_range cmap_UniCNS_UCS2_H_ranges[] = {
+{32,377,1},{162,5,262},{165,0,260},{167,6,0},
+{172,0,14049},{176,6,2},{183,0,115},{192,6,4},
+{200,10,6},{210,6,9},{215,0,210},{224,6,11},
+{232,10,13},{236,6,16},{242,6,18},{247,14,20},
+{252,0,18827},{256,6,24},{274,6,26},{282,6,28},
+{299,0,18811},{331,10,30},{339,0,18839},{363,0,18819},
+{461,6,33},{464,10,35},{468,0,18821},{470,0,18823},
+{472,0,18824},{474,0,18825},{476,0,18826},{592,6,38},
+{596,0,18837},{603,0,18836},{609,0,18833},{618,0,18843},
+{629,0,18838},{643,0,18834},{650,0,18842},{710,6,40},
+{714,6,42},{729,0,502},{776,0,13747},{913,65,417},
+{931,25,434},{945,65,441},{963,25,458},{1025,0,13936},
+{1040,21,13930},{1046,125,13937},{1078,101,13970},{1105,0,13969},
+{7870,14,44},{8211,6,48},{8216,5,166},{8220,5,168},
+{8226,0,104},{8229,6,50},{8242,0,173},{8245,0,172},
+{8251,0,177},{8254,0,195},{8364,0,17601},{8451,0,266},
+{8453,0,194},{8457,0,267},{8470,0,14054},{8481,0,14055},
+{8544,37,343},{8560,37,526},{8592,14,52},{8598,5,249},
+{8600,6,56},{8632,5,13997},{8679,0,13996},{8730,0,213},
+{8734,10,58},{8739,0,254},{8741,0,253},{8745,5,229},
+{8747,0,237},{8750,0,238},{8756,6,61},{8764,0,228},
+{8786,0,221},{8800,6,63},{8806,5,217},{8869,0,231},
+{8895,0,234},{9216,125,562},{9249,0,594},{9312,37,506},
+{9332,37,516},{9472,0,311},{9474,0,312},{9484,0,314},
+{9488,0,315},{9492,0,316},{9496,0,317},{9500,0,309},
+{9508,0,308},{9516,0,307},{9524,0,306},{9532,0,305},
+{9552,114,65},{9581,5,318},{9583,6,94},{9585,9,330},
+{9601,29,290},{9609,26,96},{9619,10,103},{9632,6,106},
+{9650,6,108},{9660,6,110},{9670,6,112},{9675,0,180},
+{9678,6,114},{9698,5,326},{9700,6,116},{9733,6,118},
+{9737,0,244},{9792,10,120},{10045,0,13760},{11904,0,17608},
+{11908,0,17692},{11910,9,17693},{11914,0,17696},{11916,5,17697},
+{11925,0,17699},{11932,6,123},{11941,0,17701},{11943,0,17702},
+{11946,0,17703},{11948,0,17704},{11950,0,17705},{11958,0,17706},
+{11964,0,17707},{11966,0,17708},{11974,0,1289},{11978,0,17709},
+{11980,5,17710},{11983,0,17712},{11990,5,17713},{11998,0,17715},
+{12003,0,2550},{12083,0,551},{12288,0,99},{12289,5,101},
+{12291,0,179},{12293,9,13754},{12296,5,148},{12298,5,144},
+{12300,5,152},{12302,5,156},{12304,5,140},{12306,0,261},
+{12308,5,136},{12317,5,170},{12321,33,353},{12353,329,13761},
+{12443,5,17606},{12445,5,13751},{12449,341,13844},{12540,0,13757},
+{12541,5,13749},{12549,145,465},{12849,0,14053},{12963,0,193},
+{13198,5,277},{13212,9,272},{13217,0,276},{13252,0,279},
+{13262,0,275},{13265,6,125},{13269,0,271},{13365,0,14781},
+{13376,0,15463},{13388,0,17811},{13412,0,14981},{13427,0,15813},
+{13434,0,16435},{13437,6,127},{13459,0,17310},{13462,0,14300},
+{13477,0,17816},{13487,0,15487},{13500,0,17280},{13505,0,17659},
+{13512,0,15616},{13535,0,16036},{13540,0,15956},{13563,0,15818},
+{13574,0,17206},{13630,0,17639},{13649,0,17825},{13651,0,17317},
+{13665,0,16600},{13677,0,17828},{13680,0,15151},{13682,0,17829},
+{13687,6,129},{13700,0,14843},{13719,6,131},{13729,0,16610},
+{13733,0,17841},{13741,0,16124},{13759,0,17842},{13761,0,17792},
+{13765,0,17844},{13767,0,17823},{13770,0,15939},{13774,0,16001},
+{13778,0,16329},{13782,0,16309},{13787,0,18189},{13789,0,17324},
+{13809,10,133},{13819,0,17864},{13822,0,16234},{13833,0,17909},
+{13848,0,18545},{13850,0,17946},{13859,0,16582},{13869,0,16006},
+{13877,0,18734},{13881,0,16741},{13886,0,14856},{13895,10,136},
+{13902,0,18072},{13919,0,15859},{13946,0,16099},{13953,0,17830},
+{13978,0,15473},{13989,0,18690},{13994,0,15152},{13996,0,18688},
+{14000,6,139},{14005,0,15298},{14009,0,18567},{14012,0,15615},
+{14017,0,14277},{14019,10,141},{14023,6,144},{14035,6,146},
+{14038,0,15628},{14045,0,14902},{14049,6,148},{14053,6,150},
+{14069,0,14872},{14081,0,14900},{14083,0,17935},{14088,0,16639},
+{14090,0,15573},{14093,0,16952},{14108,0,15870},{14114,6,152},
+{14117,0,14409},{14124,6,154},{14128,0,18780},{14130,6,156},
+{14138,0,15958},{14144,0,16898},{14147,0,16438},{14178,0,15798},
+{14191,0,18379},{14231,0,17901},{14240,0,14888},{14265,0,17335},
+{14270,0,14654},{14322,0,15265},{14328,0,17106},{14331,0,16117},
+{14351,0,17964},{14361,0,14767},{14368,0,17967},{14381,0,16686},
+{14390,0,16691},{14392,0,17339},{14435,0,18115},{14496,0,16709},
+{14531,0,14610},{14540,0,16502},{14545,0,14997},{14586,0,17643},
+{14600,0,17970},{14612,0,17342},{14631,0,15409},{14642,0,16770},
+{14655,0,17971},{14669,0,17972},{14691,0,16739},{14720,0,14452},
+{14729,6,158},{14738,0,17270},{14745,0,14778},{14747,0,15795},
+{14753,0,15897},{14756,0,15887},{14776,0,17979},{14812,0,16078},
+{14818,0,18120},{14821,0,14651},{14828,0,17168},{14840,0,17982},
+{14843,0,17221},{14846,0,17256},{14849,0,16864},{14851,0,17984},
+{14854,0,17271},{14871,6,160},{14889,6,162},{14900,0,17177},
+{14923,0,17988},{14930,0,16083},{14935,0,16798},{14940,0,16324},
+{14942,0,15111},{14950,6,164},{14999,0,17991},{15019,0,16529},
+{15037,0,17993},{15070,0,16716},{15072,0,14970},{15088,0,18098},
+{15090,0,17996},{15099,0,15090},{15118,0,14568},{15129,0,18117},
+{15138,0,17998},{15147,0,18774},{15161,0,18251},{15170,0,18000},
+{15192,0,18002},{15200,0,14650},{15217,6,166},{15227,6,168},
+{15232,0,16866},{15254,0,15004},{15257,0,15000},{15265,0,16873},
+{15292,0,17352},{15294,0,15793},{15298,0,16692},{15300,0,15008},
+{15319,0,15020},{15325,0,18015},{15340,0,18020},{15346,10,170},
+{15373,0,16887},{15377,0,15936},{15381,0,14744},{15444,0,15872},
+{15563,0,18032},{15565,0,15589},{15569,0,16387},{15574,0,15607},
+{15580,0,16462},{15595,0,16919},{15599,0,18037},{15635,0,14195},
+{15645,0,14652},{15666,0,18775},{15675,0,16965},{15686,0,18053},
+{15692,0,15595},{15694,0,16962},{15697,0,14570},{15711,0,16729},
+{15714,0,15454},{15721,6,173},{15727,0,15612},{15733,0,18058},
+{15741,0,15407},{15749,0,18763},{15754,0,18061},{15759,0,15037},
+{15761,0,18063},{15781,0,15702},{15789,0,18073},{15796,0,16550},
+{15807,0,14288},{15814,6,175},{15820,6,177},{15827,0,14305},
+{15835,0,16383},{15847,6,179},{15851,0,15962},{15859,0,18132},
+{15863,0,18603},{15868,6,181},{15878,0,18717},{15936,0,16745},
+{15939,0,17261},{15944,0,17813},{15957,0,17023},{15988,0,16098},
+{16040,10,183},{16045,0,15261},{16049,0,15064},{16056,0,14923},
+{16063,0,15115},{16066,0,15320},{16071,0,14709},{16074,0,18161},
+{16076,0,15330},{16080,6,186},{16086,6,188},{16090,0,15618},
+{16094,0,14834},{16097,6,190},{16103,0,15324},{16105,0,15524},
+{16107,0,14698},{16112,0,18167},{16115,6,192},{16122,0,18169},
+{16124,0,15336},{16127,6,194},{16132,0,17091},{16134,0,15063},
+{16142,0,18171},{16211,0,18172},{16216,6,196},{16227,0,15078},
+{16252,0,18176},{16275,0,17869},{16320,0,17359},{16343,0,17361},
+{16348,0,18180},{16357,0,18143},{16365,0,17205},{16377,6,198},
+{16388,0,16654},{16413,0,18185},{16441,0,18187},{16453,0,18188},
+{16467,0,17846},{16471,0,14749},{16482,0,15307},{16485,0,16339},
+{16490,0,18191},{16495,0,18192},{16552,0,17365},{16571,0,17856},
+{16575,0,16108},{16584,0,15118},{16600,0,16811},{16607,0,15895},
+{16634,0,16062},{16643,6,200},{16649,0,18204},{16654,0,15131},
+{16690,0,15141},{16743,0,18207},{16748,0,14510},{16750,0,15139},
+{16767,0,15234},{16784,0,18112},{16818,0,18208},{16836,0,18211},
+{16842,0,14143},{16847,0,18214},{16859,0,14271},{16879,0,14147},
+{16889,0,15166},{16913,0,15169},{16960,0,14321},{16992,0,18219},
+{17002,0,15189},{17018,0,18220},{17036,0,18223},{17044,0,18225},
+{17077,0,16400},{17081,0,14502},{17084,0,15498},{17140,0,15289},
+{17147,6,202},{17195,0,14205},{17262,0,18122},{17303,0,18235},
+{17338,0,17247},{17345,0,18069},{17369,0,17214},{17375,0,15945},
+{17389,0,18245},{17394,0,15944},{17409,6,204},{17427,0,18255},
+{17445,0,18257},{17453,0,18258},{17530,0,14255},{17551,0,18264},
+{17567,6,206},{17570,0,16505},{17584,0,18268},{17591,0,16289},
+{17600,0,15367},{17605,0,16912},{17614,0,15651},{17629,0,14813},
+{17631,0,15650},{17636,0,14306},{17641,14,208},{17652,0,14738},
+{17667,6,212},{17673,0,15952},{17675,0,14292},{17686,0,14329},
+{17693,0,14183},{17703,0,14327},{17710,0,15571},{17715,0,15441},
+{17723,0,18282},{17725,0,14532},{17727,0,15890},{17731,0,14323},
+{17745,6,214},{17749,0,16958},{17756,0,14219},{17762,0,18752},
+{17770,0,14340},{17783,0,18286},{17797,0,14533},{17897,0,16100},
+{17926,0,18291},{17935,0,14357},{17941,0,14403},{17943,0,18292},
+{18011,0,14365},{18042,0,14825},{18048,0,15617},{18127,6,216},
+{18165,0,15263},{18195,0,14387},{18200,0,15815},{18254,0,16060},
+{18300,0,15821},{18328,0,18305},{18342,0,16547},{18358,0,16106},
+{18389,0,17178},{18413,0,18307},{18420,0,17199},{18432,0,17950},
+{18443,0,17234},{18487,0,18311},{18525,0,16655},{18545,0,15619},
+{18587,0,15293},{18605,6,218},{18640,0,15783},{18653,0,16672},
+{18669,0,17032},{18675,0,16065},{18682,0,15940},{18694,0,15303},
+{18705,0,17796},{18718,0,18324},{18725,0,15375},{18730,0,18094},
+{18733,0,18125},{18741,0,15555},{18748,0,15352},{18750,0,15622},
+{18757,0,18339},{18769,0,18340},{18771,0,17069},{18789,0,14489},
+{18794,0,18345},{18802,0,14884},{18825,0,14235},{18849,0,14519},
+{18855,0,18350},{18911,0,14506},{18917,0,18353},{18919,0,17953},
+{18959,0,14531},{18973,0,15340},{18980,0,18354},{18997,0,18356},
+{19094,0,15591},{19124,0,17249},{19128,0,15784},{19153,0,14563},
+{19172,0,18359},{19199,0,14578},{19225,0,18361},{19244,0,17951},
+{19255,0,16809},{19311,6,220},{19314,0,14588},{19323,0,15501},
+{19326,0,16394},{19342,0,14839},{19344,0,15392},{19347,0,14988},
+{19350,6,222},{19357,0,18370},{19389,6,224},{19392,0,15836},
+{19460,0,16315},{19463,0,16311},{19470,0,14604},{19515,0,16188},
+{19518,0,17787},{19547,0,16089},{19565,0,18377},{19581,0,15974},
+{19620,0,18622},{19630,0,15426},{19632,0,15429},{19639,0,15905},
+{19661,0,17784},{19681,0,16115},{19693,0,16555},{19721,0,16086},
+{19728,0,16663},{19764,0,14645},{19857,0,17397},{19868,0,18628},
+{19968,6,226},{19971,6,228},{19975,42,230},{19988,10,241},
+{19992,10,244},{19996,0,18656},{19998,5,878},{20001,0,15725},
+{20004,0,17805},{20006,0,1320},{20008,0,536},{20010,18,247},
+{20016,14,252},{20022,14,256},{20027,10,260},{20031,0,538},
+{20033,10,263},{20037,0,622},{20039,10,266},{20043,0,664},
+{20045,10,269},{20050,5,880},{20054,0,1321},{20056,30,272},
+{20073,6,280},{20083,0,1322},{20088,0,15758},{20094,18,282},
+{20099,5,9057},{20101,18,287},{20107,14,292},{20113,18,296},
+{20120,14,301},{20126,18,305},{20132,10,310},{20136,0,1046},
+{20139,5,1326},{20141,5,1700},{20147,0,2098},{20150,6,313},
+{20153,14,315},{20159,22,319},{20166,5,675},{20168,6,325},
+{20170,5,678},{20173,6,327},{20180,13,762},{20184,10,329},
+{20188,14,332},{20193,0,6035},{20195,5,766},{20197,0,760},
+{20200,14,336},{20206,0,15734},{20208,34,340},{20219,0,898},
+{20221,0,901},{20223,26,349},{20232,14,356},{20237,10,360},
+{20240,5,893},{20242,14,363},{20248,10,367},{20253,0,6078},
+{20258,0,6081},{20264,6,370},{20268,6,372},{20271,6,374},
+{20274,10,376},{20278,38,379},{20289,10,389},{20293,18,392},
+{20299,18,397},{20304,5,1056},{20306,74,402},{20327,0,6186},
+{20329,14,421},{20334,10,425},{20338,102,428},{20365,0,1330},
+{20367,14,454},{20372,18,458},{20378,18,463},{20386,0,14791},
+{20392,0,17726},{20395,0,16418},{20398,10,468},{20402,6,471},
+{20405,10,473},{20409,10,476},{20413,0,17812},{20415,26,479},
+{20423,42,486},{20435,6,497},{20438,46,499},{20452,6,511},
+{20460,0,6764},{20462,6,513},{20465,18,515},{20470,5,7208},
+{20472,10,520},{20477,6,523},{20480,0,2115},{20483,0,17814},
+{20485,18,525},{20491,0,2120},{20492,5,2099},{20494,6,530},
+{20497,46,532},{20510,22,544},{20517,50,550},{20531,10,563},
+{20535,0,7206},{20540,0,2109},{20544,6,566},{20547,0,2560},
+{20549,42,568},{20561,0,7761},{20563,0,7739},{20565,14,579},
+{20570,34,583},{20579,5,7754},{20581,6,592},{20584,34,594},
+{20594,22,603},{20602,0,2556},{20605,0,2557},{20608,14,609},
+{20613,0,3049},{20615,6,613},{20619,14,615},{20624,10,619},
+{20628,10,622},{20632,26,625},{20642,6,632},{20646,0,16191},
+{20652,22,634},{20658,5,3521},{20660,18,640},{20666,6,645},
+{20669,10,647},{20673,6,650},{20676,30,652},{20685,18,660},
+{20691,18,665},{20697,10,670},{20701,18,673},{20707,30,678},
+{20716,22,686},{20723,14,692},{20728,6,696},{20731,42,698},
+{20742,5,10369},{20744,5,4360},{20746,0,10376},{20747,5,10373},
+{20749,6,709},{20752,22,711},{20759,6,717},{20762,0,11011},
+{20764,0,11008},{20767,14,719},{20772,10,723},{20777,10,726},
+{20781,5,12047},{20784,14,729},{20788,5,12410},{20791,5,5736},
+{20793,18,733},{20799,10,738},{20803,26,741},{20811,10,748},
+{20818,0,1349},{20820,14,751},{20825,42,755},{20837,0,605},
+{20839,22,766},{20845,5,684},{20849,0,909},{20852,22,772},
+{20860,0,2130},{20864,0,4751},{20866,0,541},{20870,10,778},
+{20873,5,772},{20877,0,910},{20879,0,6195},{20881,30,781},
+{20890,0,16035},{20892,0,17728},{20894,0,6416},{20896,0,1727},
+{20898,0,2133},{20900,5,2131},{20903,6,789},{20906,10,791},
+{20912,22,794},{20918,5,1079},{20920,6,800},{20924,10,802},
+{20931,0,14811},{20932,5,7222},{20934,58,805},{20951,6,820},
+{20955,30,822},{20964,0,17729},{20973,0,16468},{20976,6,830},
+{20979,14,832},{20984,0,777},{20985,5,775},{20988,10,836},
+{20992,5,608},{20994,6,839},{20997,0,17313},{20998,9,689},
+{21001,14,841},{21006,0,915},{21008,0,6088},{21009,5,913},
+{21011,0,6087},{21014,6,845},{21020,22,847},{21028,18,853},
+{21033,5,1083},{21038,0,1362},{21040,6,858},{21042,5,6420},
+{21044,18,860},{21050,10,865},{21057,0,1364},{21059,6,868},
+{21062,6,870},{21065,22,872},{21074,0,7228},{21076,14,878},
+{21081,18,882},{21086,5,7229},{21088,10,887},{21096,30,890},
+{21106,6,898},{21108,5,3059},{21111,14,900},{21115,5,9080},
+{21117,0,3532},{21119,0,3530},{21120,5,9763},{21122,10,904},
+{21127,9,4364},{21130,0,4368},{21131,5,10377},{21133,0,4367},
+{21135,10,907},{21139,6,910},{21142,22,912},{21151,10,918},
+{21155,6,921},{21158,0,6089},{21160,0,17731},{21161,5,1087},
+{21163,6,923},{21165,5,6200},{21173,0,16476},{21177,0,16479},
+{21179,6,925},{21182,0,1365},{21184,14,927},{21189,0,16480},
+{21191,0,1735},{21193,0,1736},{21196,6,931},{21200,14,933},
+{21205,18,937},{21211,0,3064},{21213,18,942},{21218,5,3536},
+{21220,0,3535},{21222,0,3534},{21225,0,9765},{21227,0,9766},
+{21231,10,947},{21235,10,950},{21239,22,953},{21246,5,693},
+{21249,0,15737},{21253,5,781},{21256,6,959},{21258,5,6425},
+{21261,22,961},{21269,10,967},{21273,6,970},{21276,6,972},
+{21279,18,974},{21287,0,17822},{21290,0,2143},{21292,6,979},
+{21295,22,981},{21303,10,987},{21307,14,990},{21311,5,2587},
+{21313,18,994},{21319,14,999},{21324,10,1003},{21329,14,1006},
+{21335,0,1740},{21338,0,3065},{21340,22,1010},{21347,6,1016},
+{21350,6,1018},{21353,0,546},{21356,14,1020},{21360,5,921},
+{21362,14,1024},{21367,9,1372},{21371,18,1028},{21378,0,6000},
+{21380,0,701},{21386,0,6093},{21390,5,6205},{21394,10,1033},
+{21398,18,1036},{21404,18,1041},{21410,0,15915},{21412,42,1046},
+{21424,0,17826},{21426,0,4370},{21428,0,12414},{21430,0,547},
+{21433,0,6019},{21435,0,792},{21441,10,1057},{21445,0,16524},
+{21448,22,1060},{21456,10,1066},{21460,0,1376},{21462,22,1069},
+{21471,30,1075},{21480,46,1083},{21493,14,1095},{21499,6,1099},
+{21502,0,16577},{21505,0,928},{21507,6,1101},{21510,58,1103},
+{21526,0,15999},{21528,38,1118},{21539,66,1128},{21557,5,1112},
+{21559,10,1145},{21563,14,1148},{21568,14,1152},{21573,14,1156},
+{21578,6,1160},{21581,10,1162},{21588,0,6210},{21600,54,1165},
+{21615,38,1179},{21626,34,1189},{21636,18,1198},{21643,54,1203},
+{21658,0,1394},{21660,0,16230},{21662,0,18413},{21664,82,1217},
+{21686,58,1238},{21701,5,6786},{21703,10,1253},{21707,22,1256},
+{21718,0,6784},{21722,0,18723},{21726,0,6794},{21728,46,1262},
+{21741,10,1274},{21745,10,1277},{21751,5,7253},{21754,14,1280},
+{21759,0,7244},{21761,78,1284},{21783,6,1304},{21786,0,7243},
+{21790,0,16040},{21795,0,17838},{21797,14,1306},{21802,62,1310},
+{21819,6,1326},{21822,14,1328},{21827,34,1332},{21837,26,1341},
+{21845,10,1348},{21852,14,1351},{21857,22,1355},{21865,10,1361},
+{21873,10,1364},{21877,5,7771},{21879,0,8391},{21881,0,17245},
+{21883,38,1367},{21894,62,1377},{21912,10,1393},{21916,6,1396},
+{21919,0,3083},{21921,54,1398},{21936,22,1412},{21945,14,1418},
+{21951,22,1422},{21957,5,3552},{21959,98,1428},{21985,6,1453},
+{21987,5,3547},{21989,22,1455},{21996,0,14290},{21999,14,1461},
+{22005,10,1465},{22009,38,1468},{22020,10,1478},{22024,6,1481},
+{22028,0,9771},{22029,5,3992},{22031,34,1483},{22043,34,1492},
+{22053,0,15992},{22055,0,9769},{22057,6,1501},{22060,10,1503},
+{22063,5,4383},{22066,38,1506},{22077,26,1516},{22085,6,1523},
+{22088,10,1525},{22092,18,1528},{22098,10,1533},{22103,14,1536},
+{22109,6,1540},{22112,26,1542},{22120,50,1549},{22134,26,1562},
+{22142,38,1569},{22153,10,1579},{22156,5,11586},{22158,10,1582},
+{22162,6,1585},{22165,0,5322},{22167,14,1587},{22172,14,1591},
+{22177,0,17259},{22180,6,1595},{22182,5,12417},{22184,0,5495},
+{22186,22,1597},{22193,26,1603},{22201,0,18543},{22204,0,5645},
+{22205,5,13002},{22207,18,1610},{22213,6,1615},{22216,22,1617},
+{22225,0,5919},{22227,6,1623},{22230,6,1625},{22234,6,1627},
+{22237,22,1629},{22244,6,1635},{22247,0,6223},{22250,6,1637},
+{22253,18,1639},{22263,0,6451},{22265,6,1644},{22269,0,15716},
+{22271,6,1646},{22273,5,7259},{22275,5,2169},{22279,26,1648},
+{22290,5,3556},{22292,10,1655},{22296,0,4000},{22298,26,1658},
+{22306,5,6042},{22312,10,1665},{22316,18,1668},{22322,10,1673},
+{22331,0,1134},{22334,22,1676},{22341,10,1682},{22345,38,1685},
+{22356,0,18309},{22359,0,18406},{22363,0,14722},{22367,0,16319},
+{22369,6,1695},{22372,0,1407},{22374,22,1697},{22381,0,6455},
+{22383,14,1703},{22387,5,6463},{22389,10,1707},{22394,26,1710},
+{22402,6,1717},{22408,0,18507},{22410,14,1719},{22415,6,1723},
+{22419,10,1725},{22423,26,1728},{22430,5,6797},{22432,22,1735},
+{22439,0,18708},{22442,0,18693},{22446,0,1773},{22452,10,1741},
+{22456,30,1744},{22465,14,1752},{22470,10,1756},{22475,6,1759},
+{22478,10,1761},{22482,0,7264},{22484,6,1764},{22487,0,15485},
+{22492,46,1766},{22505,0,7825},{22508,74,1778},{22528,58,1797},
+{22544,0,7820},{22546,0,15626},{22548,0,7798},{22553,0,8412},
+{22555,14,1812},{22560,42,1816},{22572,14,1827},{22576,5,3099},
+{22578,38,1831},{22589,0,9119},{22591,6,1841},{22596,0,18363},
+{22599,34,1843},{22609,18,1852},{22615,34,1857},{22626,14,1866},
+{22632,6,1870},{22635,10,1872},{22639,0,9112},{22641,22,1875},
+{22649,42,1881},{22661,26,1892},{22670,14,1899},{22675,6,1903},
+{22680,10,1905},{22684,22,1908},{22691,0,10404},{22693,30,1914},
+{22702,14,1922},{22707,0,4388},{22709,6,1926},{22714,22,1928},
+{22721,6,1934},{22725,18,1936},{22731,0,14857},{22734,6,1941},
+{22737,22,1943},{22744,22,1949},{22750,5,5496},{22752,0,16601},
+{22754,10,1955},{22759,10,1958},{22763,6,1961},{22767,6,1963},
+{22770,10,1965},{22777,5,3104},{22779,18,1968},{22786,22,1973},
+{22794,0,548},{22796,14,1979},{22801,6,1983},{22804,14,1985},
+{22809,5,948},{22812,0,1409},{22815,6,1989},{22818,0,4012},
+{22820,6,1991},{22823,0,637},{22825,26,1993},{22833,6,2000},
+{22836,0,17741},{22839,5,950},{22844,0,6100},{22846,0,1136},
+{22848,0,6232},{22852,6,2002},{22855,5,1411},{22857,6,2004},
+{22862,14,2006},{22867,10,2010},{22871,5,2177},{22874,0,2179},
+{22876,0,7829},{22880,10,2013},{22885,0,18514},{22887,0,3571},
+{22889,10,2016},{22893,6,2019},{22896,38,2021},{22907,42,2031},
+{22921,6,2042},{22925,14,2044},{22930,10,2048},{22934,18,2051},
+{22941,46,2056},{22956,0,15745},{22958,66,2068},{22976,6,2085},
+{22979,70,2087},{22998,0,6480},{23000,26,2105},{23008,6,2112},
+{23011,14,2114},{23016,110,2118},{23049,18,2146},{23055,0,7283},
+{23057,10,2151},{23061,18,2154},{23067,6,2159},{23070,14,2161},
+{23075,10,2165},{23079,0,15841},{23081,14,2168},{23085,5,7280},
+{23091,0,7287},{23093,18,2172},{23100,10,2177},{23104,42,2180},
+{23116,6,2191},{23120,122,2193},{23152,6,2224},{23159,34,2226},
+{23169,14,2235},{23174,0,15233},{23176,0,16995},{23178,10,2239},
+{23182,38,2242},{23193,38,2252},{23205,10,2262},{23209,0,8451},
+{23211,6,2265},{23214,90,2267},{23238,38,2290},{23251,0,16642},
+{23253,70,2300},{23272,26,2318},{23280,0,16103},{23282,38,2325},
+{23293,10,2335},{23297,10,2338},{23301,0,10421},{23303,10,2341},
+{23307,10,2344},{23311,10,2347},{23315,6,2350},{23318,6,2352},
+{23321,10,2354},{23325,18,2357},{23331,22,2362},{23338,26,2368},
+{23346,0,11601},{23348,0,4777},{23352,0,5326},{23356,0,12056},
+{23357,9,12425},{23360,6,2375},{23363,22,2377},{23370,0,14541},
+{23371,5,13180},{23373,10,2383},{23376,5,639},{23379,14,2386},
+{23383,5,959},{23386,5,1151},{23388,6,2390},{23391,0,1431},
+{23394,18,2392},{23400,6,2397},{23403,14,2399},{23408,34,2403},
+{23418,14,2412},{23423,26,2416},{23431,5,961},{23433,0,964},
+{23435,6,2423},{23438,10,2425},{23442,6,2428},{23445,0,6490},
+{23447,26,2430},{23454,5,17743},{23458,26,2437},{23466,0,16763},
+{23468,10,2444},{23472,0,2195},{23475,14,2447},{23480,6,2451},
+{23487,34,2453},{23498,18,2462},{23504,30,2467},{23512,5,9144},
+{23518,26,2475},{23525,5,4027},{23527,22,2482},{23534,10,2488},
+{23537,5,11609},{23539,0,16661},{23541,6,2491},{23544,0,642},
+{23546,0,965},{23551,0,16605},{23553,0,1798},{23555,10,2493},
+{23559,10,2496},{23562,5,3119},{23564,42,2499},{23578,0,1440},
+{23580,0,17898},{23582,10,2510},{23586,14,2513},{23592,0,6245},
+{23594,0,6246},{23596,0,1156},{23600,6,2517},{23603,0,9147},
+{23607,22,2519},{23614,6,2525},{23616,5,1157},{23620,0,6491},
+{23621,5,1442},{23623,26,2527},{23630,5,1799},{23632,6,2534},
+{23635,14,2536},{23640,6,2540},{23644,5,2652},{23646,0,15719},
+{23648,0,2651},{23650,6,2542},{23652,5,4404},{23655,6,2544},
+{23657,5,12057},{23660,14,2546},{23665,0,646},{23667,6,2550},
+{23673,0,967},{23674,5,6112},{23676,0,6111},{23678,0,6114},
+{23685,6,2552},{23688,22,2554},{23695,0,6248},{23696,5,1161},
+{23698,14,2560},{23705,6,2564},{23708,86,2566},{23731,0,1450},
+{23733,14,2588},{23738,0,16683},{23745,6,2592},{23750,26,2594},
+{23758,18,2601},{23763,5,6849},{23766,22,2606},{23774,6,2612},
+{23781,0,17975},{23784,10,2614},{23788,22,2617},{23796,0,2215},
+{23798,14,2623},{23803,0,2209},{23805,0,2208},{23807,10,2627},
+{23814,6,2630},{23819,30,2632},{23828,30,2640},{23837,14,2648},
+{23842,30,2652},{23852,0,15863},{23854,50,2660},{23868,30,2673},
+{23877,30,2681},{23886,0,8476},{23888,10,2689},{23893,10,2692},
+{23897,0,8483},{23899,0,15829},{23902,0,9154},{23906,6,2695},
+{23909,0,9151},{23911,10,2697},{23915,6,2700},{23919,14,2702},
+{23924,0,16111},{23927,0,9833},{23929,6,2706},{23932,26,2708},
+{23940,30,2715},{23949,6,2723},{23954,14,2725},{23959,0,10425},
+{23961,6,2729},{23964,26,2731},{23972,0,17965},{23975,46,2738},
+{23988,26,2750},{23996,6,2757},{24000,14,2759},{24006,5,12749},
+{24009,0,5651},{24011,0,13006},{24013,0,5743},{24015,0,13007},
+{24017,6,2763},{24020,18,2765},{24027,0,550},{24029,22,2770},
+{24037,14,2776},{24043,0,1165},{24046,0,2216},{24048,0,9158},
+{24049,9,649},{24052,6,2780},{24055,0,1805},{24057,0,6857},
+{24061,10,2782},{24066,5,825},{24068,0,6052},{24070,0,969},
+{24073,14,2785},{24078,0,6259},{24081,6,2789},{24084,30,2791},
+{24093,0,1806},{24095,6,2799},{24097,9,6858},{24100,6,2801},
+{24104,6,2803},{24107,0,2218},{24109,6,2805},{24115,6,2807},
+{24118,10,2809},{24125,6,2812},{24128,22,2814},{24136,0,14892},
+{24138,22,2820},{24147,10,2826},{24151,0,4040},{24152,5,9842},
+{24155,34,2829},{24166,0,11064},{24167,5,11062},{24169,14,2838},
+{24173,5,12060},{24175,6,2842},{24178,18,2844},{24184,34,2849},
+{24194,10,2858},{24198,30,2861},{24207,0,1167},{24213,5,1461},
+{24215,0,1459},{24218,10,2869},{24224,0,1810},{24226,26,2872},
+{24234,18,2879},{24240,6,2884},{24242,5,7889},{24244,10,2886},
+{24247,5,2672},{24249,0,7888},{24253,6,2889},{24257,5,3133},
+{24260,42,2891},{24272,78,2902},{24293,18,2922},{24300,0,5501},
+{24302,5,12751},{24305,14,2927},{24310,26,2931},{24318,6,2938},
+{24321,6,2940},{24324,6,2942},{24327,6,2944},{24330,22,2946},
+{24338,6,2952},{24340,5,718},{24343,6,2954},{24346,6,2956},
+{24349,0,6266},{24351,0,1172},{24354,9,6515},{24357,0,17968},
+{24358,5,1464},{24360,6,2958},{24365,6,2960},{24368,6,2962},
+{24371,0,7308},{24373,14,2964},{24378,0,16718},{24380,0,3136},
+{24384,0,9169},{24387,6,2968},{24390,0,4045},{24392,38,2970},
+{24404,0,6518},{24406,14,2980},{24412,6,2984},{24417,18,2986},
+{24423,0,7310},{24425,18,2991},{24431,22,2996},{24438,14,3002},
+{24443,18,3006},{24448,5,1467},{24450,6,3011},{24453,18,3013},
+{24458,5,1818},{24460,0,1821},{24464,10,3018},{24470,14,3021},
+{24475,6,3025},{24478,14,3027},{24484,18,3031},{24489,5,3138},
+{24491,18,3036},{24497,6,3041},{24501,10,3043},{24505,26,3046},
+{24512,5,12753},{24515,10,3053},{24521,0,6055},{24524,6,3056},
+{24527,14,3058},{24532,22,3062},{24539,0,14922},{24541,18,3068},
+{24547,10,3073},{24552,0,6273},{24554,6,3076},{24557,10,3078},
+{24561,0,1181},{24563,10,3081},{24567,6,3084},{24570,6,3086},
+{24573,0,1473},{24575,6,3088},{24585,58,3090},{24601,22,3105},
+{24608,62,3111},{24625,18,3127},{24631,0,6873},{24633,0,6874},
+{24635,0,17747},{24640,30,3132},{24649,6,3140},{24652,6,3142},
+{24656,0,2229},{24658,14,3144},{24664,14,3148},{24669,10,3152},
+{24674,58,3155},{24690,0,6876},{24693,0,14934},{24695,0,16389},
+{24702,14,3170},{24707,30,3174},{24716,10,3182},{24720,0,7897},
+{24722,0,7318},{24724,14,3185},{24730,26,3189},{24738,10,3196},
+{24743,6,3199},{24752,70,3201},{24771,50,3219},{24785,0,3141},
+{24787,5,7902},{24789,0,2705},{24791,54,3232},{24806,14,3246},
+{24816,70,3250},{24835,54,3268},{24850,18,3282},{24856,22,3287},
+{24863,0,3594},{24867,0,3147},{24871,10,3293},{24875,6,3296},
+{24878,10,3298},{24882,0,9178},{24884,0,3605},{24886,6,3301},
+{24891,0,9874},{24893,22,3303},{24900,18,3309},{24905,5,9173},
+{24907,22,3314},{24914,5,9864},{24916,10,3320},{24920,38,3323},
+{24930,5,4052},{24932,18,3333},{24938,10,3338},{24942,38,3341},
+{24953,6,3351},{24956,10,3353},{24960,14,3356},{24967,0,16762},
+{24969,22,3360},{24976,26,3366},{24984,22,3373},{24991,0,10457},
+{24993,6,3379},{24996,0,4437},{24999,78,3381},{25020,0,11617},
+{25022,22,3401},{25029,34,3407},{25039,6,3416},{25043,0,16766},
+{25046,0,12070},{25048,0,12062},{25050,0,14513},{25054,10,3418},
+{25058,38,3421},{25069,5,12064},{25072,10,3431},{25077,50,3434},
+{25091,5,13336},{25095,14,3447},{25100,5,977},{25102,0,976},
+{25104,10,3451},{25108,10,3454},{25113,0,7328},{25114,5,2711},
+{25119,6,3457},{25121,5,3610},{25123,10,3459},{25127,0,9879},
+{25129,22,3462},{25136,0,4791},{25138,10,3468},{25142,6,3471},
+{25145,6,3473},{25149,18,3475},{25154,5,6892},{25158,34,3480},
+{25168,10,3489},{25171,5,834},{25176,18,3492},{25182,0,6125},
+{25184,26,3497},{25192,0,16149},{25197,30,3504},{25206,6,3512},
+{25209,70,3514},{25228,0,6287},{25230,5,6288},{25232,34,3532},
+{25245,0,16022},{25252,0,14953},{25254,0,16321},{25256,38,3541},
+{25267,14,3551},{25272,6,3555},{25275,18,3557},{25282,66,3562},
+{25299,5,1503},{25301,0,16780},{25302,5,1518},{25304,18,3579},
+{25311,0,16412},{25317,0,17981},{25323,98,3584},{25351,10,3609},
+{25355,26,3612},{25363,5,6907},{25365,6,3619},{25368,0,17345},
+{25384,6,3621},{25386,5,2257},{25388,14,3623},{25393,54,3627},
+{25408,14,3641},{25412,5,7334},{25414,46,3645},{25428,26,3657},
+{25444,6,3664},{25447,10,3666},{25451,30,3669},{25461,34,3677},
+{25471,26,3686},{25479,46,3693},{25492,0,8524},{25494,14,3705},
+{25499,42,3709},{25511,42,3720},{25529,0,16029},{25533,6,3731},
+{25536,78,3733},{25557,90,3753},{25581,5,3175},{25583,30,3776},
+{25592,6,3784},{25595,6,3786},{25598,0,16030},{25606,6,3788},
+{25609,30,3790},{25618,14,3798},{25622,5,3624},{25624,0,9202},
+{25626,10,3802},{25630,14,3805},{25634,5,9205},{25636,18,3809},
+{25642,26,3814},{25650,38,3821},{25661,18,3831},{25667,0,9199},
+{25675,0,9897},{25677,6,3836},{25680,18,3838},{25688,38,3843},
+{25701,18,3853},{25707,26,3858},{25714,5,9887},{25716,38,3865},
+{25727,0,9901},{25730,0,9894},{25733,0,10469},{25735,26,3875},
+{25743,18,3882},{25749,22,3887},{25756,18,3893},{25762,18,3898},
+{25769,0,4452},{25771,38,3903},{25782,0,14948},{25787,5,4795},
+{25789,34,3913},{25799,0,4799},{25801,10,3922},{25805,14,3925},
+{25810,10,3929},{25814,22,3932},{25821,0,17182},{25824,54,3938},
+{25839,22,3952},{25847,6,3958},{25850,5,5334},{25852,22,3960},
+{25859,6,3966},{25862,6,3968},{25865,6,3970},{25868,22,3972},
+{25875,26,3978},{25883,46,3985},{25897,30,3997},{25906,30,4005},
+{25915,0,1208},{25917,10,4013},{25921,0,6913},{25923,0,6914},
+{25925,6,4016},{25928,5,2262},{25930,0,7358},{25933,0,16799},
+{25935,0,2749},{25937,0,2745},{25939,26,4018},{25948,14,4025},
+{25954,5,3186},{25956,18,4029},{25962,14,4034},{25967,0,9225},
+{25970,18,4038},{25975,5,4463},{25977,14,4043},{25983,10,4047},
+{25986,5,5089},{25988,22,4050},{25996,0,8563},{26000,10,4056},
+{26004,14,4059},{26009,0,2264},{26011,6,4063},{26013,5,8564},
+{26015,14,4065},{26020,6,4069},{26023,6,4071},{26026,10,4073},
+{26030,10,4076},{26034,5,10485},{26037,18,4079},{26043,18,4084},
+{26049,6,4089},{26051,5,7361},{26053,6,4091},{26059,5,2757},
+{26061,30,4093},{26070,6,4101},{26074,6,4103},{26077,26,4105},
+{26085,6,4112},{26088,6,4114},{26092,5,986},{26094,30,4116},
+{26106,14,4124},{26111,6,4128},{26114,78,4130},{26136,0,16817},
+{26140,50,4150},{26155,0,6925},{26157,38,4163},{26169,6,4173},
+{26177,18,4175},{26183,22,4180},{26191,0,2269},{26193,10,4186},
+{26199,0,16539},{26201,26,4189},{26209,30,4196},{26218,10,4204},
+{26222,26,4207},{26230,34,4214},{26240,0,8572},{26244,10,4223},
+{26247,5,3632},{26249,22,4226},{26256,10,4232},{26260,26,4235},
+{26269,0,4077},{26271,14,4242},{26276,0,16570},{26280,14,4246},
+{26285,58,4250},{26301,14,4265},{26308,0,4810},{26310,14,4269},
+{26314,5,11104},{26316,14,4273},{26322,0,11634},{26326,0,5092},
+{26328,6,4277},{26330,5,12081},{26332,10,4279},{26336,0,5508},
+{26339,5,12762},{26342,0,5657},{26344,6,4282},{26347,6,4284},
+{26349,5,13445},{26352,6,4286},{26354,5,988},{26356,0,1211},
+{26358,14,4288},{26364,0,2591},{26366,5,3200},{26368,22,4292},
+{26376,26,4298},{26383,5,6931},{26386,5,7368},{26388,5,2276},
+{26390,10,4305},{26395,0,2768},{26397,26,4308},{26405,14,4315},
+{26410,5,842},{26412,10,4319},{26417,0,993},{26419,14,4322},
+{26424,30,4326},{26436,22,4334},{26443,10,4340},{26446,13,1213},
+{26451,0,1223},{26453,10,4343},{26457,6,4346},{26460,26,4348},
+{26471,0,16842},{26474,0,1560},{26476,6,4355},{26479,5,1550},
+{26481,26,4357},{26488,5,6598},{26490,22,4364},{26497,0,6597},
+{26499,18,4370},{26505,0,1553},{26507,42,4375},{26519,14,4386},
+{26524,6,4390},{26527,6,4392},{26532,0,18001},{26540,0,16867},
+{26542,54,4394},{26559,30,4408},{26568,0,6935},{26569,5,6968},
+{26571,38,4416},{26582,38,4426},{26594,22,4436},{26601,70,4442},
+{26620,0,6960},{26622,26,4460},{26637,0,17025},{26640,0,14748},
+{26642,10,4467},{26646,10,4470},{26650,34,4473},{26661,6,4482},
+{26664,14,4484},{26669,10,4488},{26673,0,7379},{26674,5,7373},
+{26676,42,4491},{26688,70,4502},{26707,14,4520},{26717,0,16854},
+{26725,0,17751},{26731,0,7977},{26733,5,7961},{26735,0,7966},
+{26737,6,4524},{26740,22,4526},{26747,70,4532},{26767,22,4550},
+{26774,10,4556},{26779,10,4559},{26783,22,4562},{26790,66,4568},
+{26809,0,15636},{26813,0,17020},{26819,46,4585},{26832,34,4597},
+{26842,0,3224},{26844,0,8581},{26845,5,8615},{26847,10,4606},
+{26851,6,4609},{26854,26,4611},{26862,62,4618},{26880,86,4634},
+{26903,6,4656},{26906,6,4658},{26917,0,8624},{26922,0,8582},
+{26924,0,16184},{26927,6,4660},{26930,30,4662},{26939,46,4670},
+{26952,5,9252},{26954,10,4682},{26958,6,4685},{26961,170,4687},
+{27008,0,16190},{27010,6,4730},{27013,6,4732},{27018,0,15732},
+{27021,6,4734},{27024,6,4736},{27027,38,4738},{27038,102,4748},
+{27065,0,9938},{27067,38,4774},{27078,0,9953},{27081,34,4784},
+{27091,14,4793},{27097,0,9947},{27105,6,4797},{27108,22,4799},
+{27115,14,4805},{27121,14,4809},{27126,94,4813},{27151,0,10526},
+{27153,0,4483},{27155,58,4837},{27171,0,4469},{27173,14,4852},
+{27179,10,4856},{27186,14,4859},{27192,38,4863},{27204,22,4873},
+{27211,6,4879},{27213,5,11141},{27215,50,4881},{27229,22,4894},
+{27236,30,4900},{27245,0,11120},{27247,0,11134},{27249,0,18018},
+{27252,0,18017},{27254,0,11121},{27258,0,15021},{27262,30,4908},
+{27271,0,11644},{27273,6,4916},{27276,46,4918},{27289,62,4930},
+{27307,10,4946},{27310,5,5346},{27313,18,4949},{27318,5,12090},
+{27320,14,4954},{27325,6,4958},{27330,6,4960},{27333,34,4962},
+{27343,10,4971},{27347,6,4974},{27352,38,4976},{27365,0,5510},
+{27367,6,4986},{27370,10,4988},{27374,5,12770},{27376,6,4991},
+{27379,0,12764},{27382,0,18026},{27384,18,4993},{27392,0,13015},
+{27394,14,4998},{27400,5,13190},{27402,6,5002},{27407,6,5004},
+{27409,5,13342},{27411,0,13447},{27414,6,5006},{27416,5,13516},
+{27418,0,13519},{27421,6,5008},{27424,6,5010},{27427,0,1562},
+{27429,0,6601},{27432,0,6973},{27436,6,5012},{27439,0,7399},
+{27441,22,5014},{27447,5,7997},{27449,26,5020},{27457,10,5027},
+{27461,38,5030},{27472,10,5040},{27476,14,5043},{27481,0,4828},
+{27483,6,5047},{27486,30,5049},{27494,5,1563},{27498,0,1897},
+{27501,0,7403},{27503,0,17685},{27506,0,3659},{27508,0,16892},
+{27510,22,5057},{27518,26,5063},{27526,0,1899},{27528,10,5070},
+{27532,0,8003},{27533,5,8001},{27535,0,8000},{27537,0,7999},
+{27540,22,5073},{27547,0,9288},{27550,9,9957},{27554,22,5079},
+{27562,5,11148},{27565,14,5085},{27570,6,5089},{27573,10,5091},
+{27578,0,2792},{27580,6,5094},{27583,10,5096},{27587,5,9960},
+{27589,5,4487},{27591,26,5099},{27599,6,5106},{27602,10,5108},
+{27606,10,5111},{27610,10,5114},{27614,0,6604},{27616,18,5117},
+{27622,10,5122},{27626,0,18029},{27627,5,2793},{27631,6,5125},
+{27634,5,8636},{27639,5,9292},{27641,6,5127},{27643,5,9289},
+{27645,38,5129},{27656,6,5139},{27659,10,5141},{27663,10,5144},
+{27667,14,5147},{27672,0,6145},{27673,5,6318},{27675,10,5151},
+{27679,0,1903},{27680,5,6980},{27683,14,5154},{27687,5,2307},
+{27690,10,5158},{27694,5,3234},{27696,6,5161},{27699,34,5163},
+{27709,26,5172},{27718,0,6146},{27721,6,5179},{27723,5,6152},
+{27725,5,1008},{27727,6,5181},{27730,0,6147},{27732,6,5183},
+{27735,30,5185},{27743,5,1002},{27745,0,1006},{27749,26,5193},
+{27757,38,5200},{27768,14,5210},{27773,42,5214},{27784,5,1231},
+{27786,26,5225},{27794,18,5232},{27800,22,5237},{27807,0,14473},
+{27810,0,15715},{27818,42,5243},{27830,26,5254},{27837,5,1575},
+{27839,34,5261},{27849,58,5270},{27865,42,5285},{27877,0,1573},
+{27879,50,5296},{27893,0,1919},{27897,0,6635},{27904,74,5309},
+{27926,22,5328},{27933,14,5334},{27938,0,7010},{27940,98,5338},
+{27965,5,1915},{27967,14,5363},{27982,0,17752},{27991,22,5367},
+{27998,18,5373},{28003,5,7414},{28005,22,5378},{28012,26,5384},
+{28020,146,5391},{28068,6,5428},{28074,10,5430},{28078,6,5433},
+{28081,18,5435},{28087,38,5440},{28098,0,8033},{28100,38,5450},
+{28111,50,5460},{28124,5,8023},{28126,34,5473},{28136,62,5482},
+{28153,18,5498},{28160,0,8016},{28162,14,5503},{28170,0,15041},
+{28175,0,15600},{28181,0,18040},{28184,22,5507},{28191,86,5513},
+{28213,5,8684},{28216,14,5535},{28220,5,8645},{28222,14,5539},
+{28227,10,5543},{28230,5,8640},{28233,10,5546},{28237,38,5549},
+{28248,70,5559},{28267,0,8670},{28270,6,5577},{28273,14,5579},
+{28278,14,5583},{28284,0,16931},{28294,0,18043},{28296,6,5587},
+{28299,0,15295},{28301,14,5589},{28306,0,9322},{28307,5,9300},
+{28310,70,5593},{28330,6,5611},{28334,162,5613},{28376,22,5654},
+{28386,0,18046},{28392,5,18049},{28395,18,5660},{28401,6,5665},
+{28404,110,5667},{28434,26,5695},{28441,5,9974},{28444,0,9999},
+{28446,38,5702},{28457,98,5712},{28483,6,5737},{28494,42,5739},
+{28506,42,5750},{28518,6,5761},{28521,30,5763},{28530,10,5771},
+{28534,50,5774},{28548,42,5787},{28560,0,10571},{28562,22,5798},
+{28573,102,5804},{28600,50,5830},{28614,38,5843},{28627,10,5853},
+{28632,26,5856},{28639,5,5110},{28641,14,5863},{28646,14,5867},
+{28651,30,5871},{28660,0,11663},{28662,10,5879},{28666,10,5882},
+{28670,14,5885},{28675,18,5889},{28681,10,5894},{28684,5,12099},
+{28686,6,5897},{28689,0,5356},{28692,50,5899},{28705,9,12463},
+{28708,0,12468},{28710,26,5912},{28719,26,5919},{28727,22,5926},
+{28734,18,5932},{28739,5,13016},{28741,5,13021},{28744,5,13019},
+{28746,10,5937},{28752,10,5940},{28756,0,18065},{28757,9,13193},
+{28760,0,5833},{28762,58,5943},{28777,5,13639},{28779,6,5958},
+{28783,10,5960},{28788,10,5963},{28792,10,5966},{28796,5,1255},
+{28798,6,5969},{28801,22,5971},{28809,10,5977},{28814,6,5980},
+{28817,22,5982},{28824,10,5988},{28831,10,5991},{28835,18,5994},
+{28841,0,7021},{28843,26,5999},{28851,0,1930},{28852,5,7019},
+{28855,30,6006},{28864,0,18227},{28868,0,15274},{28869,9,7463},
+{28872,0,2337},{28874,42,6014},{28885,5,16985},{28887,14,6025},
+{28892,26,6029},{28900,0,2335},{28911,10,6036},{28915,54,6039},
+{28930,0,8062},{28932,10,6053},{28937,5,2835},{28939,14,6056},
+{28944,0,8053},{28947,0,8057},{28951,0,8047},{28953,5,3272},
+{28955,34,6060},{28965,6,6069},{28968,6,6071},{28971,6,6073},
+{28974,34,6075},{28986,6,6084},{28990,0,14126},{28992,30,6086},
+{29001,46,6094},{29014,0,3700},{29016,10,6106},{29020,66,6109},
+{29038,0,3278},{29040,14,6126},{29045,14,6130},{29050,18,6134},
+{29056,10,6139},{29060,26,6142},{29068,0,14826},{29070,10,6149},
+{29074,0,4134},{29076,0,4129},{29078,62,6152},{29095,14,6168},
+{29100,6,6172},{29103,26,6174},{29111,14,6181},{29116,14,6185},
+{29120,5,11189},{29122,0,11185},{29123,5,4855},{29125,26,6189},
+{29134,18,6196},{29140,10,6201},{29144,6,6204},{29146,5,11200},
+{29148,6,6206},{29151,14,6208},{29156,18,6212},{29163,14,6217},
+{29168,10,6221},{29172,10,6224},{29176,6,6227},{29179,5,5358},
+{29181,10,6229},{29185,10,6232},{29189,10,6235},{29193,6,6238},
+{29196,18,6240},{29203,5,12788},{29205,10,6245},{29209,10,6248},
+{29213,0,13023},{29214,5,13197},{29218,10,6251},{29222,22,6254},
+{29228,5,1605},{29230,0,17017},{29232,0,1937},{29237,6,6260},
+{29240,14,6262},{29245,22,6266},{29252,0,10018},{29254,10,6272},
+{29257,5,7023},{29259,6,6275},{29263,6,6277},{29266,6,6279},
+{29269,58,6281},{29286,6,6296},{29289,6,6298},{29292,0,7025},
+{29294,10,6300},{29298,10,6303},{29302,14,6306},{29307,5,8065},
+{29309,22,6310},{29316,14,6316},{29320,5,8703},{29323,54,6320},
+{29338,6,6334},{29341,5,11202},{29343,0,18234},{29345,14,6336},
+{29349,5,12475},{29351,14,6340},{29356,18,6344},{29362,0,16310},
+{29364,5,6156},{29370,0,6347},{29373,0,6343},{29375,30,6349},
+{29385,22,6357},{29392,10,6363},{29396,0,6657},{29398,18,6366},
+{29404,0,6655},{29407,0,7033},{29408,5,1942},{29410,10,6371},
+{29414,0,7035},{29416,14,6374},{29427,6,6378},{29430,50,6380},
+{29444,0,16053},{29447,6,6393},{29450,10,6395},{29455,18,6398},
+{29462,14,6403},{29467,14,6407},{29474,6,6411},{29477,38,6413},
+{29488,50,6423},{29502,30,6436},{29512,10,6444},{29516,26,6447},
+{29527,18,6454},{29533,0,10605},{29534,9,10602},{29537,6,6459},
+{29541,0,11208},{29542,5,11205},{29544,18,6461},{29550,5,11683},
+{29552,34,6466},{29562,70,6475},{29582,6,6493},{29586,0,6353},
+{29587,5,6351},{29589,14,6495},{29596,26,6499},{29604,38,6506},
+{29618,30,6516},{29627,6,6524},{29630,10,6526},{29634,6,6529},
+{29637,46,6531},{29650,18,6543},{29655,5,7495},{29657,22,6548},
+{29664,46,6554},{29677,10,6566},{29683,58,6569},{29699,42,6584},
+{29713,6,6595},{29716,14,6597},{29721,18,6601},{29726,5,18164},
+{29728,26,6606},{29736,50,6613},{29749,5,3292},{29751,14,6626},
+{29756,0,15071},{29759,42,6630},{29770,5,9371},{29773,6,6641},
+{29775,5,9377},{29777,26,6643},{29785,6,6650},{29787,5,3715},
+{29789,14,6652},{29794,14,6656},{29799,62,6660},{29817,6,6676},
+{29820,30,6678},{29829,14,6686},{29833,5,10612},{29835,10,6690},
+{29840,0,11688},{29842,0,11215},{29844,6,6693},{29847,22,6695},
+{29854,14,6701},{29859,34,6705},{29869,0,11690},{29871,14,6714},
+{29876,18,6718},{29882,6,6723},{29885,26,6725},{29893,0,12481},
+{29896,0,17077},{29898,10,6732},{29903,6,6735},{29907,42,6737},
+{29918,5,7498},{29920,38,6748},{29932,0,7054},{29934,0,7055},
+{29936,10,6758},{29940,5,7500},{29942,5,2855},{29944,0,16372},
+{29947,0,8736},{29949,14,6761},{29954,5,10035},{29956,6,6765},
+{29959,6,6767},{29963,0,11218},{29964,5,4864},{29966,6,6769},
+{29968,9,11694},{29971,30,6771},{29980,14,6779},{29985,6,6783},
+{29989,5,3299},{29992,5,860},{29994,22,6785},{30000,13,862},
+{30004,6,6791},{30007,5,1266},{30009,10,6793},{30013,6,6796},
+{30015,5,6671},{30018,0,17357},{30022,0,16192},{30023,5,7057},
+{30026,22,6798},{30033,0,15614},{30035,10,6804},{30041,18,6807},
+{30047,6,6812},{30050,10,6814},{30053,5,2859},{30055,0,17088},
+{30058,26,6817},{30066,0,18174},{30070,18,6824},{30077,14,6829},
+{30083,6,6833},{30086,6,6835},{30090,34,6837},{30100,5,6356},
+{30104,0,6675},{30105,5,1623},{30109,6,6846},{30114,5,1960},
+{30116,5,1958},{30119,0,7059},{30122,6,6848},{30128,6,6850},
+{30130,5,2361},{30132,10,6852},{30136,54,6855},{30151,6,6869},
+{30154,0,2867},{30155,5,8099},{30157,22,6871},{30164,5,2864},
+{30167,54,6877},{30182,6,6891},{30189,0,9403},{30191,82,6893},
+{30215,26,6914},{30223,10,6921},{30227,14,6924},{30233,30,6928},
+{30241,5,4529},{30243,26,6936},{30252,6,6943},{30255,26,6945},
+{30264,0,4867},{30266,14,6952},{30272,0,16102},{30274,6,6956},
+{30278,6,6958},{30280,5,11700},{30284,34,6960},{30294,18,6969},
+{30300,0,12128},{30303,14,6974},{30308,14,6978},{30313,6,6982},
+{30316,18,6984},{30321,5,5923},{30323,14,6989},{30328,10,6993},
+{30331,5,3310},{30333,22,6996},{30340,0,1625},{30342,9,1963},
+{30345,14,7002},{30350,10,7006},{30354,6,7009},{30357,6,7011},
+{30361,10,7013},{30364,9,10633},{30369,0,17109},{30372,10,7016},
+{30378,6,7019},{30381,14,7021},{30388,6,7025},{30391,6,7027},
+{30394,6,7029},{30397,10,7031},{30402,18,7034},{30408,10,7039},
+{30412,0,17112},{30413,5,2371},{30418,10,7042},{30422,0,16213},
+{30426,14,7045},{30430,5,3728},{30433,0,4152},{30435,18,7049},
+{30441,6,7054},{30444,38,7056},{30455,22,7066},{30462,0,1975},
+{30465,0,1970},{30467,9,7064},{30471,22,7072},{30478,5,15106},
+{30480,14,7078},{30485,0,7522},{30489,5,7523},{30491,0,7516},
+{30493,6,7082},{30495,5,2374},{30498,30,7084},{30507,0,16371},
+{30509,0,8108},{30511,0,8107},{30513,5,8109},{30515,46,7092},
+{30528,0,17120},{30531,10,7104},{30534,5,8751},{30538,0,8756},
+{30539,5,8758},{30541,10,7107},{30546,0,9412},{30548,10,7110},
+{30552,18,7113},{30558,0,3733},{30559,5,9410},{30561,10,7118},
+{30565,42,7121},{30578,0,14699},{30583,58,7132},{30599,10,7147},
+{30603,18,7150},{30609,0,4537},{30611,0,14381},{30613,0,11238},
+{30615,26,7155},{30622,5,4872},{30624,6,7162},{30626,5,11236},
+{30629,0,4874},{30631,6,7164},{30634,14,7166},{30639,34,7170},
+{30649,6,7179},{30651,5,5372},{30653,10,7181},{30658,14,7184},
+{30663,0,5534},{30665,5,12486},{30667,10,7188},{30670,5,12799},
+{30672,0,13029},{30675,10,7191},{30679,0,5925},{30680,5,13523},
+{30682,10,7194},{30686,0,8760},{30688,0,9420},{30690,6,7197},
+{30693,6,7199},{30695,5,7071},{30697,0,2377},{30700,34,7201},
+{30711,30,7210},{30722,6,7218},{30725,6,7220},{30728,6,7222},
+{30732,5,1981},{30734,10,7224},{30737,5,7074},{30739,6,7227},
+{30744,0,18195},{30748,30,7229},{30757,66,7237},{30775,10,7254},
+{30780,6,7257},{30786,14,7259},{30791,30,7263},{30800,18,7271},
+{30812,10,7276},{30816,0,8762},{30818,0,8774},{30820,5,8763},
+{30822,0,18199},{30824,38,7279},{30841,14,7289},{30846,14,7293},
+{30851,6,7297},{30853,5,9427},{30855,10,7299},{30860,14,7302},
+{30865,0,3750},{30867,14,7306},{30871,5,3745},{30873,6,7310},
+{30878,30,7312},{30887,26,7320},{30895,22,7327},{30902,0,15468},
+{30904,18,7333},{30910,0,4543},{30913,0,4158},{30915,5,10649},
+{30917,0,4540},{30919,58,7338},{30935,6,7353},{30938,6,7355},
+{30941,6,7357},{30943,5,11251},{30945,5,11248},{30947,0,11246},
+{30949,0,11243},{30951,14,7359},{30956,38,7363},{30967,0,5151},
+{30969,6,7373},{30971,5,11717},{30973,10,7375},{30977,6,7378},
+{30980,10,7380},{30985,0,12143},{30988,0,12140},{30990,0,5374},
+{30992,10,7383},{30995,5,12141},{30999,0,12494},{31001,0,5535},
+{31003,14,7386},{31009,0,12492},{31011,14,7390},{31015,5,12805},
+{31017,26,7394},{31025,22,7401},{31032,30,7407},{31040,5,1632},
+{31042,0,6687},{31044,34,7415},{31055,90,7424},{31079,6,7447},
+{31081,5,8128},{31083,0,8131},{31085,0,2884},{31088,18,7449},
+{31097,6,7454},{31100,30,7456},{31110,10,7464},{31114,5,10070},
+{31117,0,4166},{31118,5,4164},{31120,54,7467},{31135,14,7481},
+{31140,42,7485},{31152,18,7496},{31158,10,7501},{31161,5,1987},
+{31163,0,8133},{31165,18,7504},{31172,10,7509},{31176,6,7512},
+{31179,18,7514},{31185,5,1989},{31188,10,7519},{31192,0,2404},
+{31196,18,7522},{31202,10,7527},{31206,6,7530},{31209,6,7532},
+{31211,5,7547},{31213,6,7534},{31217,0,15143},{31220,0,15138},
+{31222,5,8136},{31224,0,8135},{31226,6,7536},{31232,0,3325},
+{31234,18,7538},{31240,0,3322},{31242,14,7543},{31248,22,7547},
+{31255,0,9444},{31256,5,9441},{31258,10,7553},{31262,10,7556},
+{31266,0,9446},{31270,0,10085},{31272,0,10084},{31275,0,10080},
+{31277,18,7559},{31287,0,4551},{31289,30,7564},{31299,38,7572},
+{31309,5,4880},{31316,0,11731},{31318,10,7582},{31322,10,7585},
+{31327,6,7588},{31329,5,5376},{31333,0,14134},{31335,5,12497},
+{31337,0,5538},{31339,0,5537},{31340,5,12811},{31342,0,12810},
+{31344,5,13209},{31348,10,7590},{31352,14,7593},{31357,18,7597},
+{31363,30,7602},{31371,5,7559},{31375,14,7610},{31380,22,7614},
+{31390,0,9452},{31391,5,3764},{31394,6,7620},{31400,10,7622},
+{31403,5,10087},{31406,42,7625},{31418,10,7636},{31422,6,7639},
+{31424,5,11734},{31426,5,14139},{31428,5,5379},{31431,18,7641},
+{31439,0,18212},{31441,0,7095},{31443,0,16266},{31448,22,7646},
+{31455,6,7652},{31458,22,7654},{31465,10,7660},{31469,10,7663},
+{31478,6,7666},{31481,10,7668},{31485,10,7671},{31488,5,7096},
+{31492,10,7674},{31496,18,7677},{31502,26,7682},{31512,14,7689},
+{31517,14,7693},{31522,78,7697},{31544,6,7717},{31547,0,8142},
+{31552,0,8793},{31554,66,7719},{31572,10,7736},{31576,0,8794},
+{31584,30,7739},{31593,0,9458},{31596,50,7747},{31611,0,18217},
+{31618,0,10105},{31620,6,7760},{31623,6,7762},{31626,34,7764},
+{31636,22,7773},{31643,10,7779},{31648,18,7782},{31660,6,7787},
+{31663,0,10668},{31665,6,7789},{31668,6,7791},{31671,10,7793},
+{31678,0,10665},{31680,6,7796},{31684,0,4557},{31686,5,4559},
+{31689,14,7798},{31694,10,7802},{31700,6,7805},{31704,78,7807},
+{31728,5,11753},{31730,10,7827},{31735,50,7830},{31749,10,7843},
+{31753,38,7846},{31765,0,16481},{31769,0,12152},{31771,34,7856},
+{31781,34,7865},{31792,0,12161},{31795,0,12499},{31797,0,14169},
+{31799,10,7874},{31803,10,7877},{31806,5,5539},{31808,0,5544},
+{31810,14,7880},{31815,14,7884},{31820,6,7888},{31824,6,7890},
+{31827,6,7892},{31830,6,7894},{31833,18,7896},{31839,6,7901},
+{31843,18,7903},{31849,30,7908},{31858,14,7916},{31864,5,7099},
+{31866,18,7920},{31871,9,7101},{31875,14,7925},{31880,10,7929},
+{31884,10,7932},{31889,6,7935},{31892,18,7937},{31900,0,18222},
+{31902,6,7942},{31905,10,7944},{31909,14,7947},{31916,0,14469},
+{31918,6,7951},{31921,18,7953},{31928,18,7958},{31933,5,4185},
+{31935,0,10107},{31938,0,16343},{31941,0,10672},{31943,30,7963},
+{31952,5,11281},{31954,10,7971},{31957,5,4894},{31959,0,11280},
+{31961,6,7974},{31964,18,7976},{31970,0,5169},{31974,10,7981},
+{31978,0,12505},{31980,10,7984},{31983,5,5677},{31985,34,7987},
+{31995,14,7996},{32000,138,8000},{32037,0,16094},{32040,6,8035},
+{32043,6,8037},{32046,22,8039},{32053,6,8045},{32056,22,8047},
+{32062,5,8174},{32064,30,8053},{32074,0,8176},{32077,38,8061},
+{32088,0,8800},{32090,22,8071},{32097,10,8077},{32102,22,8080},
+{32109,26,8086},{32121,18,8093},{32127,10,8098},{32131,14,8101},
+{32136,6,8105},{32140,14,8107},{32145,14,8111},{32150,6,8115},
+{32156,34,8117},{32166,62,8126},{32183,22,8142},{32189,5,4190},
+{32191,14,8148},{32196,14,8152},{32201,6,8156},{32203,5,10122},
+{32205,14,8158},{32210,10,8162},{32214,46,8165},{32227,30,8177},
+{32236,0,4570},{32238,38,8185},{32249,10,8195},{32253,6,8198},
+{32259,0,10682},{32263,66,8200},{32282,18,8217},{32287,5,11287},
+{32289,18,8222},{32295,0,14207},{32297,10,8227},{32301,114,8230},
+{32332,0,11769},{32336,14,8259},{32340,5,5388},{32342,18,8263},
+{32348,0,12162},{32350,22,8268},{32357,0,18130},{32359,6,8274},
+{32361,5,5548},{32363,0,5545},{32365,14,8276},{32370,66,8280},
+{32390,0,13040},{32391,5,13037},{32394,22,8297},{32401,46,8303},
+{32415,0,18619},{32420,0,17755},{32428,0,17756},{32442,0,17757},
+{32455,0,17758},{32463,0,17759},{32479,0,17760},{32518,0,17761},
+{32566,18,8315},{32573,0,2913},{32574,5,8817},{32576,5,14208},
+{32579,10,8320},{32583,58,8323},{32600,0,7107},{32603,26,8338},
+{32611,0,8179},{32613,5,8819},{32615,5,9489},{32617,5,3781},
+{32619,14,8345},{32624,14,8349},{32629,22,8353},{32635,5,11303},
+{32637,10,8359},{32643,0,12518},{32645,42,8362},{32657,26,8373},
+{32666,6,8380},{32668,5,8181},{32670,0,2914},{32672,5,8822},
+{32674,30,8382},{32684,94,8390},{32709,0,2428},{32711,0,8189},
+{32713,0,8191},{32714,5,8184},{32716,14,8414},{32720,5,8187},
+{32722,0,2918},{32724,5,3356},{32727,0,8824},{32731,5,9495},
+{32733,10,8418},{32736,5,4207},{32738,5,10135},{32741,42,8421},
+{32752,5,4907},{32754,14,8432},{32759,5,12175},{32761,14,8436},
+{32765,5,12521},{32767,38,8440},{32779,10,8450},{32782,5,7112},
+{32784,10,8453},{32788,22,8456},{32795,26,8462},{32804,10,8469},
+{32808,10,8472},{32812,0,11781},{32814,14,8475},{32819,18,8479},
+{32825,0,7605},{32827,5,14231},{32829,10,8484},{32835,0,8196},
+{32838,10,8487},{32842,0,2920},{32847,5,8826},{32849,6,8490},
+{32852,0,18240},{32854,0,3787},{32856,0,3788},{32858,18,8492},
+{32865,14,8497},{32870,6,8501},{32876,0,11310},{32879,6,8503},
+{32881,5,5193},{32883,0,5197},{32885,18,8505},{32893,14,8510},
+{32898,0,7404},{32900,14,8514},{32905,6,8518},{32907,5,1027},
+{32911,6,8520},{32914,6,8522},{32917,6,8524},{32920,22,8526},
+{32927,0,17782},{32929,10,8532},{32933,0,1645},{32935,0,14240},
+{32937,10,8535},{32941,10,8538},{32945,6,8541},{32948,18,8543},
+{32954,0,1644},{32956,6,8548},{32962,0,7121},{32963,5,2014},
+{32965,22,8550},{32972,22,8556},{32980,42,8562},{32992,6,8573},
+{32995,14,8575},{33001,0,18244},{33004,6,8579},{33007,30,8581},
+{33016,26,8589},{33024,14,8596},{33029,22,8600},{33036,0,18246},
+{33038,0,18247},{33042,0,18248},{33044,30,8606},{33053,10,8614},
+{33057,18,8617},{33063,0,8208},{33065,18,8622},{33071,6,8627},
+{33074,0,15993},{33076,0,17900},{33079,0,15218},{33081,6,8629},
+{33085,6,8631},{33090,10,8633},{33094,10,8636},{33098,50,8639},
+{33113,5,18253},{33115,6,8652},{33118,0,9507},{33120,10,8654},
+{33124,14,8657},{33129,0,9502},{33131,0,3797},{33133,30,8661},
+{33142,10,8669},{33145,5,3798},{33148,0,18256},{33151,6,8672},
+{33154,10,8674},{33158,30,8677},{33167,0,4215},{33171,0,17350},
+{33173,0,10705},{33175,14,8685},{33179,9,4586},{33182,10,8689},
+{33186,6,8692},{33189,30,8694},{33198,0,11313},{33200,30,8702},
+{33209,70,8710},{33228,6,8728},{33231,6,8730},{33233,5,12178},
+{33237,0,12525},{33239,18,8732},{33245,10,8737},{33248,5,13533},
+{33250,34,8740},{33260,14,8749},{33266,10,8753},{33270,0,15713},
+{33271,9,8840},{33274,10,8756},{33278,18,8759},{33284,6,8764},
+{33287,26,8766},{33296,10,8773},{33300,10,8776},{33304,0,14250},
+{33306,34,8779},{33317,6,8788},{33320,6,8790},{33322,5,2456},
+{33324,6,8792},{33327,0,7614},{33330,34,8794},{33340,5,8844},
+{33342,10,8803},{33346,0,9517},{33348,6,8806},{33351,0,3802},
+{33353,0,9514},{33355,0,4225},{33358,26,8808},{33365,9,11324},
+{33368,5,4916},{33370,10,8815},{33374,6,8818},{33377,22,8820},
+{33384,5,12829},{33387,18,8826},{33393,6,8831},{33396,50,8833},
+{33411,5,6373},{33413,0,6368},{33415,0,16690},{33418,6,8846},
+{33421,30,8848},{33432,14,8856},{33437,82,8860},{33459,46,8881},
+{33472,0,6704},{33474,10,8893},{33482,0,18266},{33487,42,8896},
+{33499,6,8907},{33502,42,8909},{33514,54,8920},{33529,66,8934},
+{33547,10,8951},{33558,34,8954},{33568,0,7637},{33570,0,7627},
+{33572,38,8963},{33583,0,7639},{33585,50,8973},{33599,26,8986},
+{33607,54,8993},{33622,6,9007},{33634,6,9009},{33638,0,15902},
+{33647,0,17765},{33651,22,9011},{33658,0,8222},{33659,5,2948},
+{33661,10,9017},{33665,0,8227},{33667,0,8234},{33669,102,9020},
+{33696,0,2946},{33698,42,9046},{33710,10,9057},{33721,0,17063},
+{33725,74,9060},{33745,0,8886},{33747,26,9079},{33755,42,9086},
+{33767,62,9097},{33784,30,9113},{33793,0,8865},{33795,18,9121},
+{33801,46,9126},{33814,0,16439},{33816,0,15994},{33819,6,9138},
+{33824,6,9140},{33827,6,9142},{33830,0,18136},{33833,0,9549},
+{33835,86,9144},{33858,50,9166},{33872,102,9179},{33899,62,9205},
+{33917,14,9221},{33922,0,3803},{33926,0,9529},{33928,0,18274},
+{33933,30,9225},{33942,58,9233},{33959,46,9248},{33972,0,10161},
+{33974,0,10181},{33976,42,9260},{33988,14,9271},{33993,46,9275},
+{34006,6,9287},{34010,6,9289},{34014,0,14314},{34017,6,9291},
+{34020,6,9293},{34023,5,10755},{34025,14,9295},{34030,26,9299},
+{34038,42,9306},{34050,6,9317},{34053,86,9319},{34076,22,9341},
+{34083,34,9347},{34092,5,4596},{34094,14,9356},{34099,6,9360},
+{34104,0,18280},{34107,0,10717},{34109,6,9362},{34112,58,9364},
+{34129,42,9379},{34141,6,9390},{34144,30,9392},{34152,5,4921},
+{34154,18,9400},{34159,5,18283},{34161,0,11345},{34163,0,14328},
+{34165,30,9405},{34174,0,5212},{34176,70,9413},{34196,10,9431},
+{34200,50,9434},{34214,18,9447},{34223,10,9452},{34227,30,9455},
+{34237,50,9463},{34251,0,12194},{34253,22,9476},{34261,0,5559},
+{34263,14,9482},{34268,30,9486},{34276,5,5560},{34278,0,12547},
+{34280,42,9494},{34294,50,9505},{34308,14,9518},{34313,18,9522},
+{34320,6,9527},{34324,0,18110},{34326,26,9529},{34334,50,9536},
+{34348,14,9549},{34353,10,9553},{34356,5,13223},{34358,0,13228},
+{34360,18,9556},{34366,10,9561},{34370,6,9564},{34373,0,15206},
+{34374,9,13535},{34379,14,9566},{34384,0,2047},{34386,18,9570},
+{34393,0,8251},{34395,6,9575},{34398,6,9577},{34401,18,9579},
+{34407,22,9584},{34413,5,6726},{34415,22,9590},{34423,0,7162},
+{34425,14,9596},{34430,0,14346},{34437,10,9600},{34442,18,9603},
+{34448,42,9608},{34460,10,9619},{34464,22,9622},{34471,14,9628},
+{34477,0,16134},{34479,46,9632},{34491,5,8266},{34493,5,8269},
+{34495,42,9644},{34507,6,9655},{34512,6,9657},{34515,6,9659},
+{34518,38,9661},{34530,10,9671},{34534,0,8902},{34536,22,9674},
+{34543,0,18289},{34549,26,9680},{34558,0,3828},{34560,6,9687},
+{34562,5,3830},{34564,42,9689},{34577,10,9700},{34584,18,9703},
+{34590,0,10197},{34592,22,9708},{34598,5,10216},{34600,10,9714},
+{34604,10,9717},{34608,22,9720},{34615,6,9726},{34618,10,9728},
+{34622,22,9731},{34630,0,10205},{34636,90,9737},{34659,5,10768},
+{34661,50,9760},{34675,34,9773},{34685,0,16453},{34689,34,9782},
+{34699,10,9791},{34703,0,11363},{34704,5,11375},{34706,10,9794},
+{34710,10,9797},{34714,22,9800},{34722,14,9806},{34729,118,9810},
+{34760,18,9840},{34766,0,16365},{34769,14,9845},{34774,74,9849},
+{34794,22,9868},{34802,14,9874},{34806,5,12554},{34809,14,9878},
+{34814,34,9882},{34824,22,9891},{34831,0,14353},{34832,5,12844},
+{34835,0,12847},{34836,5,5695},{34838,14,9897},{34843,10,9901},
+{34847,82,9904},{34869,18,9925},{34875,30,9930},{34883,5,7674},
+{34885,5,14358},{34888,0,8915},{34890,22,9938},{34898,6,9944},
+{34901,10,9946},{34905,10,9949},{34909,6,9952},{34912,22,9954},
+{34919,18,9960},{34925,22,9965},{34932,0,7686},{34933,5,7677},
+{34935,0,2489},{34937,0,2493},{34940,18,9971},{34945,5,2490},
+{34947,6,9976},{34951,10,9978},{34955,14,9981},{34961,10,9985},
+{34965,30,9988},{34974,18,9996},{34980,0,8286},{34983,6,10001},
+{34986,10,10003},{34990,0,18293},{34993,6,10006},{34996,5,14366},
+{34998,18,10008},{35004,18,10013},{35009,5,3410},{35013,0,14368},
+{35015,0,16049},{35017,14,10018},{35021,5,9593},{35023,6,10022},
+{35026,0,3844},{35028,46,10024},{35041,0,3841},{35046,10,10036},
+{35051,6,10039},{35054,10,10041},{35057,5,10225},{35059,62,10044},
+{35077,10,10060},{35081,14,10063},{35086,0,10810},{35088,6,10067},
+{35090,5,4622},{35092,10,10069},{35095,9,10804},{35098,0,4259},
+{35102,6,10072},{35105,26,10074},{35113,14,10081},{35117,5,11386},
+{35119,18,10085},{35125,14,10090},{35131,14,10094},{35137,14,10098},
+{35142,6,10102},{35145,0,12235},{35147,10,10104},{35151,0,12230},
+{35152,5,12233},{35154,10,10107},{35158,14,10110},{35162,5,12566},
+{35164,42,10114},{35177,26,10125},{35185,14,10132},{35190,6,10136},
+{35193,5,13538},{35195,6,10138},{35198,22,10140},{35205,26,10146},
+{35215,0,2973},{35217,0,18296},{35219,22,10153},{35227,18,10159},
+{35233,26,10164},{35241,6,10171},{35244,14,10173},{35250,0,5416},
+{35254,6,10177},{35257,6,10179},{35260,22,10181},{35270,0,17766},
+{35282,18,10187},{35289,0,8293},{35290,5,8935},{35292,6,10192},
+{35295,42,10194},{35307,10,10205},{35312,6,10208},{35314,5,11865},
+{35316,0,5417},{35318,10,10210},{35322,10,10213},{35326,10,10216},
+{35330,5,2056},{35332,0,7172},{35335,6,10219},{35338,0,2499},
+{35340,0,2497},{35342,22,10221},{35349,14,10227},{35355,18,10231},
+{35362,6,10236},{35365,0,2977},{35367,0,8296},{35369,18,10238},
+{35376,6,10243},{35380,0,3425},{35382,0,3427},{35384,38,10245},
+{35396,5,8944},{35398,0,3424},{35400,10,10255},{35404,26,10258},
+{35412,10,10265},{35415,5,8942},{35417,0,8940},{35419,0,3422},
+{35422,0,3418},{35424,14,10268},{35430,14,10272},{35435,14,10276},
+{35440,6,10280},{35442,5,3848},{35444,14,10282},{35449,14,10286},
+{35454,6,10290},{35457,26,10292},{35467,10,10299},{35471,30,10302},
+{35480,10,10310},{35484,0,14380},{35486,0,4263},{35488,6,10313},
+{35491,34,10315},{35503,6,10324},{35506,0,4633},{35508,0,18300},
+{35510,0,4640},{35512,34,10326},{35522,30,10335},{35531,0,4631},
+{35533,0,4639},{35535,0,10818},{35537,10,10343},{35540,5,10823},
+{35542,50,10346},{35556,0,11404},{35558,10,10359},{35562,6,10362},
+{35565,26,10364},{35572,5,11400},{35574,10,10371},{35578,10,10374},
+{35582,10,10377},{35585,5,4950},{35588,18,10380},{35594,90,10385},
+{35618,26,10408},{35626,30,10415},{35635,0,12239},{35637,10,10423},
+{35641,42,10426},{35653,26,10437},{35660,5,14395},{35662,5,5577},
+{35664,42,10444},{35676,18,10455},{35682,6,10460},{35685,34,10462},
+{35695,6,10471},{35700,0,5775},{35703,10,10473},{35706,5,13076},
+{35709,22,10476},{35716,10,10482},{35720,0,13376},{35722,10,10485},
+{35726,0,13374},{35728,0,14399},{35730,6,10488},{35732,5,13468},
+{35734,0,5933},{35736,5,13543},{35738,10,10490},{35742,10,10493},
+{35774,0,17767},{35810,0,17768},{35895,0,1291},{35897,0,8299},
+{35899,18,10496},{35905,10,10501},{35909,50,10504},{35924,14,10517},
+{35930,0,2984},{35932,5,8301},{35935,0,8952},{35937,6,10521},
+{35940,10,10523},{35944,5,10250},{35946,14,10526},{35951,18,10530},
+{35957,26,10535},{35965,0,8303},{35968,10,10542},{35972,5,9630},
+{35974,0,9629},{35977,6,10545},{35980,6,10547},{35983,6,10549},
+{35985,5,11414},{35987,10,10551},{35991,38,10554},{36001,5,2508},
+{36003,10,10564},{36007,26,10567},{36015,6,10574},{36018,78,10576},
+{36039,5,3871},{36042,0,3870},{36044,6,10596},{36047,0,10253},
+{36049,5,4280},{36051,18,10598},{36057,34,10603},{36066,5,4652},
+{36068,30,10612},{36076,5,4650},{36078,0,11418},{36080,22,10620},
+{36087,30,10626},{36096,0,12264},{36098,14,10634},{36102,5,12595},
+{36104,22,10638},{36111,26,10644},{36118,5,5849},{36120,6,10651},
+{36123,10,10653},{36196,0,1295},{36198,6,10656},{36200,5,9633},
+{36203,22,10658},{36210,10,10664},{36214,22,10667},{36221,0,8305},
+{36224,10,10673},{36228,6,10676},{36233,6,10678},{36236,6,10680},
+{36238,5,9637},{36240,10,10682},{36243,5,9640},{36245,6,10685},
+{36249,0,4283},{36251,6,10687},{36255,10,10689},{36259,0,4659},
+{36261,42,10692},{36274,22,10703},{36281,6,10709},{36284,0,8308},
+{36286,22,10711},{36293,14,10717},{36299,26,10721},{36307,42,10728},
+{36319,22,10739},{36326,26,10745},{36334,26,10752},{36346,0,3883},
+{36348,46,10759},{36361,6,10771},{36365,98,10773},{36390,5,10859},
+{36392,14,10798},{36397,6,10802},{36400,6,10804},{36403,14,10806},
+{36408,10,10810},{36412,5,11432},{36414,18,10813},{36420,50,10818},
+{36435,18,10831},{36441,70,10836},{36460,6,10854},{36463,0,12606},
+{36465,30,10856},{36474,10,10864},{36478,0,17188},{36480,10,10867},
+{36484,42,10870},{36496,22,10881},{36502,5,13250},{36504,0,13379},
+{36506,0,13247},{36509,0,13473},{36510,9,13470},{36513,0,5961},
+{36515,42,10887},{36528,0,17385},{36530,0,3887},{36534,0,14431},
+{36538,0,4669},{36540,6,10898},{36544,0,5430},{36546,6,10900},
+{36553,26,10902},{36561,14,10909},{36567,6,10913},{36570,22,10915},
+{36576,5,8318},{36578,0,18313},{36580,10,10921},{36583,5,8983},
+{36585,0,8990},{36587,18,10924},{36593,6,10929},{36596,34,10931},
+{36606,22,10940},{36613,6,10946},{36615,5,9662},{36617,10,10948},
+{36621,6,10951},{36624,5,10269},{36626,14,10953},{36630,5,10874},
+{36632,34,10957},{36643,14,10966},{36649,6,10970},{36652,18,10972},
+{36658,30,10977},{36667,0,4967},{36670,30,10985},{36678,9,12279},
+{36681,10,10993},{36685,6,10996},{36687,5,12611},{36689,18,10998},
+{36694,5,12866},{36696,50,11003},{36710,5,17769},{36718,0,17771},
+{36755,0,18226},{36763,6,11016},{36767,6,11018},{36771,0,4290},
+{36773,6,11020},{36776,0,4971},{36781,54,11022},{36795,5,15723},
+{36798,6,11036},{36801,6,11038},{36804,10,11040},{36809,22,11043},
+{36816,30,11049},{36826,0,16331},{36832,26,11057},{36840,0,2073},
+{36842,6,11064},{36845,6,11066},{36848,0,2065},{36852,74,11068},
+{36872,0,16096},{36875,10,11087},{36879,14,11090},{36884,14,11094},
+{36889,46,11098},{36909,10,11110},{36913,30,11113},{36924,14,11121},
+{36929,6,11125},{36932,0,9668},{36935,0,3902},{36937,54,11127},
+{36952,6,11141},{36955,14,11143},{36960,18,11147},{36967,10,11152},
+{36971,22,11155},{36978,58,11161},{36993,5,5269},{36995,22,11176},
+{37002,5,5593},{37005,0,12871},{37007,10,11182},{37012,6,11185},
+{37015,5,6171},{37017,0,6170},{37019,0,6173},{37022,22,11187},
+{37029,14,11193},{37034,0,1309},{37038,34,11197},{37048,0,1682},
+{37051,0,15300},{37053,10,11206},{37057,0,2076},{37059,10,11209},
+{37063,6,11212},{37066,6,11214},{37070,0,2075},{37076,18,11216},
+{37081,5,7711},{37083,10,11221},{37087,26,11224},{37096,10,11231},
+{37099,5,8333},{37101,0,3014},{37103,10,11234},{37106,5,8330},
+{37108,6,11237},{37113,66,11239},{37131,0,9677},{37133,22,11256},
+{37140,0,9676},{37142,58,11262},{37158,10,11277},{37161,5,10883},
+{37163,38,11280},{37173,5,11451},{37176,6,11290},{37178,5,12284},
+{37182,14,11292},{37187,0,12872},{37188,5,13087},{37190,30,11296},
+{37198,5,7722},{37200,14,11304},{37205,22,11308},{37212,0,16199},
+{37214,30,11314},{37223,14,11322},{37228,0,3911},{37230,5,9679},
+{37232,0,16056},{37234,34,11326},{37244,0,16239},{37248,0,10894},
+{37249,5,10891},{37251,6,11335},{37253,5,10888},{37255,0,4688},
+{37257,26,11337},{37264,5,11454},{37266,6,11344},{37273,42,11346},
+{37285,0,12288},{37287,14,11357},{37291,5,5436},{37293,18,11361},
+{37298,5,12876},{37300,14,11366},{37305,22,11370},{37312,30,11376},
+{37321,0,3914},{37323,26,11384},{37331,30,11391},{37340,6,11399},
+{37343,0,17722},{37346,30,11401},{37354,5,8348},{37356,10,11409},
+{37361,0,8343},{37363,10,11412},{37367,14,11415},{37373,54,11419},
+{37388,30,11433},{37396,5,3471},{37398,6,11441},{37401,6,11443},
+{37404,0,9028},{37406,0,3475},{37411,22,11445},{37418,6,11451},
+{37421,6,11453},{37424,42,11455},{37436,22,11466},{37444,10,11472},
+{37448,66,11475},{37466,6,11492},{37469,42,11494},{37483,22,11505},
+{37490,0,9706},{37494,102,11511},{37521,0,4318},{37523,42,11537},
+{37536,50,11548},{37550,0,18329},{37553,26,11561},{37561,14,11568},
+{37566,18,11572},{37571,5,10896},{37573,66,11577},{37591,10,11594},
+{37595,0,16396},{37597,18,11597},{37603,38,11602},{37614,18,11612},
+{37619,5,18333},{37622,58,11617},{37638,14,11632},{37643,22,11636},
+{37650,18,11642},{37656,14,11647},{37661,82,11651},{37683,14,11672},
+{37688,6,11676},{37692,0,11466},{37696,62,11678},{37712,5,11923},
+{37714,0,11933},{37716,34,11694},{37726,66,11703},{37744,6,11720},
+{37747,46,11722},{37760,42,11734},{37772,26,11745},{37780,90,11752},
+{37804,38,11775},{37815,6,11785},{37818,6,11787},{37821,0,14887},
+{37823,6,11789},{37826,10,11791},{37830,10,11794},{37834,70,11797},
+{37852,5,5602},{37854,26,11815},{37862,10,11822},{37868,0,12626},
+{37870,0,12633},{37872,6,11825},{37875,0,14690},{37877,50,11827},
+{37891,6,11840},{37894,78,11842},{37915,0,16712},{37917,0,18342},
+{37920,0,12881},{37924,42,11862},{37936,14,11873},{37941,46,11877},
+{37954,22,11889},{37960,5,13262},{37962,5,13257},{37964,6,11895},
+{37967,6,11897},{37969,5,5856},{37972,6,11899},{37975,6,11901},
+{37979,0,14495},{37981,6,11903},{37984,0,5902},{37986,14,11905},
+{37991,0,15032},{37992,5,13478},{37994,62,11909},{38011,6,11925},
+{38013,5,5981},{38015,0,5988},{38016,5,13625},{38018,6,11927},
+{38021,0,17671},{38047,0,18565},{38050,0,17691},{38081,0,18401},
+{38083,0,18399},{38108,0,18391},{38134,0,18386},{38189,0,18348},
+{38215,0,18623},{38263,6,11929},{38266,14,11931},{38271,6,11935},
+{38274,6,11937},{38277,6,11939},{38280,6,11941},{38283,38,11943},
+{38294,14,11953},{38299,6,11957},{38302,38,11959},{38312,5,4320},
+{38314,18,11969},{38320,6,11974},{38325,10,11976},{38329,5,11500},
+{38331,22,11979},{38339,0,11947},{38341,18,11985},{38346,9,5290},
+{38349,0,11498},{38352,6,11990},{38354,5,12317},{38356,10,11992},
+{38362,5,12643},{38364,0,5611},{38366,30,11995},{38376,0,17674},
+{38388,0,18351},{38428,10,12003},{38432,18,12006},{38440,0,6385},
+{38442,0,1318},{38444,30,12011},{38456,22,12019},{38463,26,12025},
+{38474,0,7194},{38475,9,2083},{38478,14,12032},{38483,6,12036},
+{38486,0,15847},{38488,0,2545},{38491,18,12038},{38497,0,2541},
+{38498,5,2539},{38500,0,2544},{38505,18,12043},{38511,26,12048},
+{38518,5,3031},{38520,0,3028},{38523,14,12055},{38528,6,12059},
+{38531,6,12061},{38533,5,3491},{38535,0,9038},{38536,5,9040},
+{38538,6,12063},{38541,10,12065},{38545,0,9718},{38546,5,9716},
+{38548,5,3934},{38550,14,12068},{38555,6,12072},{38558,0,10322},
+{38561,18,12074},{38567,5,4998},{38569,6,12079},{38572,0,11952},
+{38574,0,11950},{38576,6,12081},{38579,6,12083},{38582,0,561},
+{38584,6,12085},{38587,10,12087},{38591,26,12090},{38598,5,3499},
+{38600,0,9045},{38601,5,3938},{38603,14,12097},{38610,54,12101},
+{38625,10,12115},{38629,0,13480},{38632,10,12118},{38639,14,12121},
+{38644,30,12125},{38653,0,9722},{38655,6,12133},{38658,14,12135},
+{38662,5,4707},{38664,6,12139},{38667,0,11508},{38669,26,12141},
+{38678,0,5004},{38680,6,12148},{38683,62,12150},{38699,5,12647},
+{38702,5,12911},{38704,10,12166},{38709,6,12169},{38712,5,5793},
+{38714,0,13106},{38717,5,5858},{38719,22,12171},{38726,14,12177},
+{38731,0,13606},{38737,6,12181},{38742,10,12183},{38746,0,10940},
+{38747,5,5008},{38749,22,12186},{38758,0,5010},{38760,10,12192},
+{38764,10,12195},{38768,18,12198},{38774,0,3946},{38775,5,9726},
+{38778,46,12203},{38791,18,12215},{38797,10,12220},{38804,0,11513},
+{38807,62,12223},{38824,0,12332},{38826,18,12239},{38833,14,12244},
+{38838,22,12248},{38845,26,12254},{38852,5,13388},{38854,14,12261},
+{38859,22,12265},{38866,30,12271},{38876,0,5617},{38877,9,12654},
+{38880,6,12279},{38883,0,13266},{38885,6,12281},{38893,6,12283},
+{38896,14,12285},{38901,6,12289},{38904,14,12291},{38909,5,12915},
+{38911,10,12295},{38914,5,3039},{38916,0,8363},{38917,5,3504},
+{38919,6,12298},{38922,0,3950},{38924,0,3952},{38925,5,9730},
+{38927,0,9729},{38928,5,3947},{38930,18,12300},{38935,5,4334},
+{38939,26,12305},{38947,6,12312},{38950,14,12314},{38955,0,4715},
+{38957,14,12318},{38962,14,12322},{38967,10,12326},{38971,0,5014},
+{38977,0,11966},{38979,50,12329},{38992,9,12343},{38995,0,5468},
+{38999,10,12342},{39003,22,12345},{39010,5,12918},{39012,14,12351},
+{39017,14,12355},{39023,14,12359},{39027,5,13607},{39029,0,17677},
+{39080,6,12363},{39084,0,9732},{39085,5,10339},{39087,0,4336},
+{39089,14,12365},{39094,42,12369},{39105,5,12921},{39107,6,12380},
+{39110,26,12382},{39118,0,17678},{39131,6,12389},{39134,22,12391},
+{39141,10,12397},{39145,18,12400},{39151,0,3509},{39153,6,12405},
+{39156,10,12407},{39161,6,12410},{39164,0,3953},{39165,5,3955},
+{39168,0,10342},{39170,6,12412},{39173,0,4339},{39175,14,12414},
+{39180,0,4340},{39182,0,17389},{39184,22,12418},{39190,5,10959},
+{39192,18,12424},{39198,6,12429},{39201,0,5023},{39204,6,12431},
+{39207,14,12433},{39211,5,11973},{39213,26,12437},{39221,0,5304},
+{39223,26,12444},{39230,5,5470},{39232,14,12451},{39237,0,5623},
+{39239,30,12455},{39248,38,12463},{39259,18,12473},{39265,10,12478},
+{39318,14,12481},{39323,14,12485},{39329,0,11984},{39331,10,12489},
+{39334,5,12668},{39336,0,5722},{39338,46,12492},{39352,22,12504},
+{39361,18,12510},{39367,0,10352},{39369,0,10968},{39371,30,12515},
+{39379,5,10965},{39381,34,12523},{39391,0,4724},{39393,26,12532},
+{39401,6,12539},{39404,10,12541},{39408,6,12544},{39412,34,12546},
+{39421,5,11993},{39423,0,5306},{39425,26,12555},{39433,34,12562},
+{39444,10,12571},{39449,58,12574},{39465,38,12589},{39476,74,12599},
+{39496,10,12618},{39500,18,12621},{39506,0,13280},{39507,5,13273},
+{39509,18,12626},{39514,5,5907},{39516,0,15384},{39518,10,12631},
+{39522,14,12634},{39526,5,13613},{39528,18,12638},{39567,0,17798},
+{39592,0,2550},{39595,0,9740},{39597,0,9739},{39599,5,4343},
+{39601,14,12643},{39606,50,12647},{39622,6,12660},{39626,0,12940},
+{39629,0,13123},{39631,14,12662},{39635,5,5910},{39637,14,12666},
+{39644,0,12361},{39647,18,12670},{39654,6,12675},{39659,10,12677},
+{39662,5,4731},{39665,14,12680},{39670,6,12684},{39673,26,12686},
+{39681,10,12693},{39684,5,12363},{39686,0,5478},{39688,42,12696},
+{39700,10,12707},{39703,5,13125},{39705,6,12710},{39710,9,13393},
+{39714,14,12712},{39719,18,12716},{39725,10,12721},{39729,18,12724},
+{39735,0,12688},{39737,14,12729},{39742,5,10356},{39744,0,14613},
+{39745,5,4346},{39747,14,12733},{39752,0,12002},{39754,34,12737},
+{39764,10,12746},{39768,14,12749},{39775,0,10360},{39776,5,10358},
+{39780,0,10990},{39782,14,12753},{39788,0,10991},{39791,10,12757},
+{39796,14,12760},{39802,38,12764},{39813,14,12774},{39819,0,16110},
+{39821,26,12778},{39829,0,11553},{39831,0,16241},{39834,6,12785},
+{39837,22,12787},{39844,10,12793},{39848,0,12004},{39850,6,12796},
+{39853,14,12798},{39861,6,12802},{39864,6,12804},{39869,0,12381},
+{39871,10,12806},{39875,6,12809},{39878,18,12811},{39887,0,15420},
+{39891,18,12816},{39897,22,12821},{39904,10,12827},{39908,22,12830},
+{39914,5,12689},{39916,6,12836},{39920,6,12838},{39924,0,18376},
+{39927,6,12840},{39933,0,5484},{39935,0,14619},{39938,0,14618},
+{39941,38,12842},{39952,0,15418},{39954,14,12852},{39959,0,12955},
+{39963,10,12856},{39967,10,12859},{39971,14,12862},{39976,5,13135},
+{39979,18,12866},{39985,26,12871},{39993,34,12878},{40004,10,12887},
+{40008,34,12890},{40018,30,12899},{40029,14,12907},{40034,6,12911},
+{40038,10,12913},{40045,6,12916},{40049,18,12918},{40055,5,5984},
+{40057,14,12923},{40165,10,12927},{40169,6,12930},{40173,0,9743},
+{40177,5,10361},{40179,18,12932},{40185,18,12937},{40191,6,12942},
+{40194,30,12944},{40204,0,15430},{40208,0,11565},{40210,0,5038},
+{40212,22,12952},{40219,0,5039},{40221,26,12958},{40229,6,12965},
+{40232,6,12967},{40237,0,12032},{40238,5,12019},{40240,6,12969},
+{40243,6,12971},{40246,14,12973},{40251,0,5311},{40253,18,12977},
+{40258,5,12025},{40260,6,12982},{40265,14,12984},{40270,26,12988},
+{40278,46,12995},{40295,50,13007},{40308,5,12719},{40311,10,13020},
+{40315,62,13023},{40331,5,12715},{40336,0,12964},{40338,10,13039},
+{40342,62,13042},{40358,5,12980},{40360,22,13058},{40367,0,5809},
+{40369,30,13064},{40377,5,13152},{40379,42,13072},{40391,98,13083},
+{40417,22,13108},{40424,6,13114},{40427,22,13116},{40434,26,13122},
+{40441,5,5947},{40443,18,13129},{40448,5,13501},{40450,22,13134},
+{40457,50,13140},{40471,34,13153},{40565,0,3043},{40569,10,13162},
+{40572,5,5949},{40575,26,13165},{40582,5,11569},{40584,26,13172},
+{40592,74,13179},{40612,54,13198},{40628,14,13212},{40635,38,13216},
+{40646,10,13226},{40652,22,13229},{40659,6,13235},{40661,5,11573},
+{40664,0,5040},{40666,6,13237},{40668,5,5316},{40670,10,13239},
+{40674,0,18392},{40676,18,13242},{40683,0,13164},{40685,18,13247},
+{40690,5,13427},{40692,58,13252},{40710,18,13267},{40718,0,3963},
+{40719,5,11006},{40722,6,13272},{40725,30,13274},{40734,0,13508},
+{40736,0,3965},{40738,94,13282},{40763,0,4352},{40765,6,13306},
+{40768,5,12737},{40770,58,13308},{40786,14,13323},{40790,9,12740},
+{40793,50,13327},{40806,5,5817},{40809,14,13340},{40814,5,13438},
+{40816,10,13344},{40820,9,13510},{40823,18,13347},{40830,6,13352},
+{40845,6,13354},{40848,10,13356},{40852,6,13359},{40856,6,13361},
+{40860,0,5043},{40863,6,13363},{40866,0,13325},{40868,6,13365},
+{57344,0,16395},{57346,5,16397},{57353,5,16404},{57356,0,16407},
+{57358,0,16409},{57362,17,16413},{57368,0,16419},{57370,17,16421},
+{57376,0,16427},{57378,5,16429},{57381,0,16432},{57389,5,16440},
+{57392,0,16443},{57394,25,16445},{57403,5,16454},{57413,0,16464},
+{57420,0,16471},{57434,0,16485},{57436,0,16487},{57439,9,16490},
+{57444,0,16495},{57446,0,16497},{57452,0,16503},{57457,0,16508},
+{57460,5,16511},{57464,0,16515},{57469,0,16520},{57479,0,16530},
+{57481,5,16532},{57484,0,16535},{57491,5,16542},{57497,5,16548},
+{57500,9,16551},{57510,5,16561},{57513,0,16564},{57515,0,16566},
+{57518,0,16569},{57530,0,16581},{57532,0,16583},{57534,0,16585},
+{57539,0,16590},{57541,0,16592},{57543,5,16594},{57546,0,16597},
+{57552,0,16603},{57556,5,16607},{57564,0,16615},{57567,0,16618},
+{57570,13,16621},{57575,9,16626},{57579,5,16630},{57582,0,16633},
+{57586,0,16637},{57592,5,16643},{57595,0,16645},{57597,0,16647},
+{57603,0,16653},{57606,0,16656},{57609,9,16658},{57616,0,16665},
+{57620,5,16669},{57628,5,16677},{57633,0,16682},{57638,9,16687},
+{57648,5,16697},{57654,0,16703},{57657,0,16706},{57665,5,16714},
+{57669,0,16717},{57671,5,16719},{57674,0,16721},{57677,0,16723},
+{57680,0,16726},{57684,13,16730},{57689,5,16735},{57693,0,18767},
+{57698,0,16743},{57704,9,16749},{57713,5,16757},{57717,0,16761},
+{57720,5,16764},{57723,5,16767},{57727,5,16771},{57733,0,16777},
+{57735,0,16779},{57737,0,16781},{57739,0,16783},{57743,5,16787},
+{57747,0,16790},{57749,6,13367},{57759,5,16801},{57764,0,18772},
+{57766,0,16808},{57770,0,16812},{57774,0,16816},{57776,5,16818},
+{57779,5,16821},{57782,0,16824},{57784,0,16826},{57787,0,18773},
+{57788,13,16829},{57793,0,16834},{57796,5,16837},{57800,0,16840},
+{57804,5,16844},{57812,5,16852},{57815,0,16855},{57818,0,16858},
+{57821,0,16861},{57826,0,16865},{57830,0,16869},{57835,0,16874},
+{57839,5,16878},{57842,0,16881},{57847,0,16886},{57850,0,16889},
+{57854,0,16893},{57856,10,13369},{57861,0,16900},{57863,0,16902},
+{57866,9,16905},{57872,0,16911},{57874,17,16913},{57881,0,16920},
+{57883,5,16922},{57887,9,16926},{57894,9,16933},{57898,0,16937},
+{57903,0,16942},{57905,0,16944},{57907,0,16946},{57911,0,16950},
+{57915,0,16954},{57917,5,16956},{57925,0,16964},{57928,0,16967},
+{57930,21,16969},{57937,13,16976},{57953,0,16992},{57960,0,16998},
+{57963,0,17001},{57965,9,17003},{57969,0,17007},{57978,0,17016},
+{57981,0,17019},{57986,0,17024},{57992,5,17030},{57995,0,17033},
+{58000,5,17038},{58004,9,17042},{58009,9,17047},{58015,0,17053},
+{58017,0,18779},{58020,0,17057},{58022,0,17059},{58034,13,17070},
+{58039,5,17075},{58042,0,17078},{58046,5,17081},{58049,0,17084},
+{58055,0,17090},{58057,0,17092},{58068,0,17103},{58072,5,17107},
+{58078,0,17113},{58080,9,17115},{58087,0,17122},{58089,0,17124},
+{58091,9,17126},{58096,5,18781},{58104,0,17137},{58108,0,17141},
+{58111,5,18783},{58113,0,17144},{58118,0,17149},{58120,0,17151},
+{58124,0,17155},{58127,0,17158},{58129,0,14123},{58131,0,14125},
+{58133,0,14127},{58136,0,14129},{58139,5,14132},{58143,0,14136},
+{58149,0,14142},{58156,0,14149},{58160,5,14153},{58165,5,14158},
+{58171,0,14164},{58173,0,18074},{58178,0,14170},{58181,0,14173},
+{58184,0,14175},{58194,0,14184},{58196,0,14186},{58203,5,14192},
+{58208,0,14197},{58210,0,14199},{58212,5,14201},{58223,0,14212},
+{58226,0,14215},{58228,5,14217},{58231,0,14220},{58233,0,14221},
+{58235,0,14223},{58241,5,14229},{58246,0,14234},{58248,9,14236},
+{58253,0,14241},{58257,0,14245},{58259,6,13372},{58262,0,14249},
+{58264,0,14251},{58266,5,14253},{58270,0,18081},{58271,5,14257},
+{58274,0,14260},{58277,0,18082},{58278,13,14264},{58284,0,14270},
+{58289,5,14275},{58292,5,14278},{58297,17,14283},{58307,0,14293},
+{58312,0,14297},{58316,6,13374},{58319,0,14303},{58325,0,18085},
+{58328,9,14311},{58337,0,14320},{58339,0,14322},{58343,0,18086},
+{58349,5,14332},{58352,0,14335},{58354,9,14337},{58360,0,14343},
+{58362,0,14345},{58365,0,14348},{58367,0,14350},{58377,9,14360},
+{58388,0,14369},{58395,0,14376},{58397,5,14378},{58403,0,14384},
+{58405,6,13376},{58408,0,14388},{58412,5,14392},{58418,0,14398},
+{58422,0,14402},{58426,9,14406},{58430,0,14410},{58432,5,14412},
+{58436,0,14416},{58440,0,18093},{58444,9,14423},{58448,5,14427},
+{58457,5,14436},{58461,5,14440},{58465,9,14444},{58469,0,14448},
+{58471,9,18095},{58474,0,14451},{58476,0,14453},{58478,5,14455},
+{58481,5,14458},{58484,0,14461},{58486,0,14463},{58494,5,14470},
+{58500,0,14476},{58502,17,14477},{58509,5,14484},{58513,5,14487},
+{58517,9,14491},{58529,0,18100},{58530,9,14503},{58539,0,14512},
+{58543,0,14516},{58547,29,14520},{58561,0,14534},{58566,0,14539},
+{58569,0,14542},{58573,5,14546},{58582,0,14555},{58585,0,14558},
+{58588,5,14561},{58596,0,14569},{58598,9,14571},{58606,5,14579},
+{58614,0,14587},{58616,5,14589},{58623,0,14596},{58625,5,14598},
+{58629,0,14602},{58634,0,14607},{58637,0,18101},{58639,0,14611},
+{58642,0,14614},{58644,0,14616},{58646,0,18102},{58650,0,14621},
+{58652,21,14623},{58660,0,14631},{58664,0,18104},{58665,13,14634},
+{58670,5,14639},{58679,0,14648},{58686,0,14655},{58691,0,14660},
+{58699,0,14668},{58708,5,14677},{58711,9,14680},{58715,5,14684},
+{58718,5,14687},{58722,0,14691},{58726,5,14695},{58733,5,14702},
+{58736,0,14705},{58738,5,14707},{58741,9,14710},{58745,5,14714},
+{58748,9,14717},{58752,0,14721},{58754,17,14723},{58760,0,14729},
+{58763,21,14732},{58770,9,14739},{58778,0,14747},{58781,17,14750},
+{58788,0,14757},{58790,9,14759},{58794,0,14763},{58799,0,14768},
+{58801,6,13378},{58805,0,14774},{58807,5,14776},{58810,5,14779},
+{58814,9,14783},{58818,0,14787},{58824,5,14793},{58839,9,14804},
+{58843,5,14808},{58847,0,14812},{58849,9,14814},{58853,5,14818},
+{58857,0,14822},{58862,13,14827},{58867,0,14832},{58875,5,14840},
+{58880,0,14845},{58882,0,14847},{58884,0,14849},{58895,13,14859},
+{58905,13,14868},{58913,0,14876},{58915,5,14878},{58919,0,14882},
+{58923,0,14886},{58930,9,14893},{58935,5,14898},{58938,0,14901},
+{58940,0,14903},{58943,13,14906},{58949,5,14912},{58952,0,14915},
+{58955,0,14917},{58958,5,14920},{58962,13,14924},{58967,9,14929},
+{58973,13,14935},{58978,5,14940},{58981,13,14943},{58986,0,18111},
+{58990,5,14951},{58993,0,14954},{58998,13,14959},{59003,9,14964},
+{59007,5,14968},{59011,21,14971},{59018,9,14978},{59022,9,14982},
+{59026,0,14986},{59030,5,14990},{59033,5,14993},{59036,0,14996},
+{59038,5,14998},{59041,5,15001},{59046,0,15005},{59052,5,15010},
+{59058,0,15016},{59065,5,15023},{59069,5,15027},{59072,5,15030},
+{59077,0,18116},{59079,0,15036},{59082,0,15039},{59089,5,15046},
+{59095,5,15052},{59098,5,15055},{59101,17,15058},{59108,9,15065},
+{59118,0,15075},{59122,5,15079},{59127,0,15084},{59130,9,15087},
+{59135,0,15092},{59137,5,15094},{59142,5,15099},{59145,5,15102},
+{59148,0,15105},{59152,5,15109},{59155,0,15112},{59159,5,15116},
+{59162,5,15119},{59165,0,15122},{59172,5,15129},{59179,0,15136},
+{59183,0,15140},{59187,17,15144},{59196,5,15153},{59200,9,15157},
+{59204,0,15161},{59207,0,15164},{59213,9,15170},{59217,5,15174},
+{59227,9,15184},{59231,0,15188},{59233,5,15190},{59236,5,15193},
+{59239,5,15196},{59241,0,18119},{59244,9,15200},{59248,0,15204},
+{59253,0,15209},{59255,5,15210},{59258,0,15213},{59260,5,15215},
+{59268,0,15223},{59270,0,15225},{59273,0,15228},{59275,0,15230},
+{59277,0,15232},{59280,0,15235},{59282,0,15237},{59284,0,15239},
+{59286,5,15241},{59289,0,15244},{59298,0,15253},{59300,21,15255},
+{59313,0,15268},{59316,0,15271},{59320,0,15275},{59324,0,15279},
+{59332,0,15286},{59338,0,15292},{59342,0,15296},{59345,0,15299},
+{59352,0,15306},{59354,0,15308},{59356,5,15310},{59364,0,15318},
+{59367,9,15321},{59371,0,15325},{59373,9,15327},{59377,9,15331},
+{59384,0,15338},{59387,5,15341},{59391,13,15345},{59400,0,15354},
+{59404,0,15358},{59406,5,15360},{59409,0,15363},{59411,0,15365},
+{59414,9,15368},{59418,0,15372},{59425,0,15379},{59431,5,15385},
+{59437,0,15391},{59439,0,15393},{59445,0,15399},{59447,5,15401},
+{59450,5,15404},{59457,5,15411},{59467,0,15421},{59469,5,15423},
+{59473,0,15427},{59477,13,15431},{59483,9,15437},{59488,9,15442},
+{59493,9,15447},{59497,5,15451},{59500,0,15453},{59505,0,15458},
+{59512,0,15465},{59517,9,15470},{59527,0,15480},{59535,0,15488},
+{59537,5,15490},{59540,5,15493},{59546,0,15499},{59549,0,15502},
+{59552,5,15505},{59555,17,15508},{59561,5,15514},{59564,17,15517},
+{59573,5,15526},{59576,0,15529},{59581,25,15534},{59589,0,15542},
+{59591,0,15544},{59595,0,15548},{59597,5,15550},{59600,5,15553},
+{59603,0,15556},{59605,5,15558},{59608,9,15561},{59613,0,15566},
+{59615,9,15568},{59621,5,15574},{59624,9,15577},{59629,0,15582},
+{59633,5,15586},{59637,0,15590},{59643,0,15596},{59646,0,15599},
+{59648,0,15601},{59651,0,15604},{59655,5,15608},{59660,0,15613},
+{59671,5,15624},{59676,0,15629},{59678,17,15631},{59685,29,15638},
+{59694,5,15647},{59699,13,15652},{59704,0,18127},{59706,0,15659},
+{59708,9,15661},{59713,0,15666},{59716,5,15669},{59720,0,15673},
+{59725,0,15678},{59728,0,15681},{59730,13,15683},{59735,5,15688},
+{59738,0,15691},{59740,9,15693},{59744,5,15697},{59748,0,15701},
+{59751,6,13380},{59758,5,18133},{59763,10,13382},{59767,5,18141},
+{59770,5,18144},{59773,0,18147},{59777,5,18150},{59783,0,15709},
+{59786,0,15710},{59790,0,15711},{59793,0,18159},{59824,0,17364},
+{59851,0,18201},{59887,0,18228},{59971,0,18297},{60073,0,18380},
+{60095,9,18396},{60101,0,18400},{60105,13,18402},{60111,9,18408},
+{60115,5,18411},{60118,17,18414},{60124,0,18419},{60126,21,18420},
+{60135,21,18426},{60142,0,18432},{60144,9,18433},{60148,0,17328},
+{60149,5,18436},{60152,6,13385},{60154,5,18440},{60158,9,18443},
+{60162,13,18446},{60168,29,18451},{60177,5,18459},{60181,0,18462},
+{60184,21,18465},{60191,9,18471},{60195,0,18474},{60197,0,18475},
+{60199,0,18476},{60202,0,18477},{60204,53,18478},{60221,0,15771},
+{60222,5,18492},{60225,0,15773},{60227,5,18494},{60230,0,15776},
+{60234,0,18497},{60235,5,15779},{60237,5,18498},{60239,5,15781},
+{60243,6,13387},{60245,5,18501},{60247,0,15786},{60248,5,18503},
+{60250,5,15787},{60253,0,15790},{60255,0,15792},{60257,0,15794},
+{60258,5,18505},{60261,0,18508},{60263,0,18509},{60264,5,15796},
+{60267,0,15799},{60269,0,15801},{60271,9,18510},{60275,6,13389},
+{60278,10,13391},{60282,0,18516},{60286,5,18518},{60288,5,15809},
+{60291,5,18520},{60293,0,15812},{60296,10,13394},{60300,9,18524},
+{60303,6,13397},{60307,0,15819},{60309,0,18528},{60311,0,15822},
+{60312,9,18529},{60315,0,15823},{60319,6,13399},{60322,6,13401},
+{60325,5,18536},{60328,0,15830},{60330,6,13403},{60333,14,13405},
+{60338,5,18541},{60340,0,15837},{60342,0,15839},{60345,0,15842},
+{60348,6,13409},{60351,0,15846},{60354,0,15849},{60357,5,18546},
+{60359,6,13411},{60362,0,18549},{60364,5,15854},{60366,0,18550},
+{60368,0,18551},{60371,0,18552},{60373,0,18553},{60375,5,15860},
+{60378,5,18554},{60381,0,15864},{60383,0,18556},{60385,0,18557},
+{60388,0,18558},{60391,0,15871},{60392,5,18559},{60395,5,18561},
+{60398,6,13413},{60401,6,13415},{60405,6,13417},{60409,9,15881},
+{60413,5,15885},{60421,5,15892},{60424,5,18568},{60428,0,15896},
+{60430,9,15898},{60435,6,13419},{60439,5,15906},{60441,13,18572},
+{60445,0,15908},{60448,0,18576},{60450,0,15912},{60452,0,15914},
+{60454,0,15916},{60458,6,13421},{60460,9,15921},{60463,0,18578},
+{60465,6,13423},{60469,0,15928},{60471,0,15930},{60475,5,15934},
+{60479,9,18580},{60482,10,13425},{60485,17,18584},{60491,5,18589},
+{60495,0,18592},{60498,0,18593},{60500,0,18594},{60502,9,18595},
+{60506,0,18598},{60508,5,18599},{60511,5,18601},{60514,5,18604},
+{60519,6,13428},{60521,41,18608},{60533,5,18620},{60537,0,18624},
+{60539,0,18626},{60542,0,18627},{60544,0,18629},{60548,0,18632},
+{60550,0,18634},{60557,6,13430},{60561,6,13432},{60563,5,18639},
+{60565,6,13434},{60568,6,13436},{60570,5,18643},{60573,6,13438},
+{60576,0,18647},{60579,5,18648},{60583,5,18650},{60587,0,18652},
+{60589,0,18653},{60591,0,15973},{60596,0,18655},{60598,0,15979},
+{60601,9,18657},{60623,0,16000},{60628,0,16005},{60635,5,16012},
+{60638,0,18660},{60639,9,16015},{60645,0,16021},{60656,0,16032},
+{60658,0,16034},{60661,0,16037},{60668,0,16044},{60676,0,18663},
+{60679,0,18664},{60682,0,18666},{60684,21,18667},{60691,0,18673},
+{60693,9,18674},{60696,0,16058},{60698,0,18677},{60700,10,13440},
+{60706,0,18680},{60708,5,16066},{60710,5,18681},{60713,6,13443},
+{60716,6,13445},{60731,0,16079},{60733,0,18692},{60737,5,18694},
+{60741,0,18696},{60743,0,16085},{60746,5,18697},{60749,5,18699},
+{60751,0,16090},{60753,6,13447},{60755,5,18702},{60759,5,18704},
+{60767,0,16101},{60770,0,16104},{60779,0,16113},{60785,6,13449},
+{60789,0,18707},{60791,6,13451},{60794,0,18710},{60801,0,18711},
+{60804,5,16132},{60806,0,18712},{60808,0,16135},{60809,5,18713},
+{60811,0,16136},{60814,0,16139},{60817,0,16142},{60838,0,18716},
+{60870,0,16193},{60879,0,16202},{60881,0,18718},{60887,0,18719},
+{60890,6,13453},{60893,0,18721},{60897,0,16216},{60909,0,16228},
+{60936,0,16254},{60945,0,16263},{60949,0,18725},{60955,0,18726},
+{60960,0,16276},{60962,0,18727},{60970,0,16285},{60976,6,13455},
+{60980,0,16294},{61000,0,18729},{61014,0,18730},{61019,0,18731},
+{61021,0,16332},{61024,0,18732},{61028,0,16338},{61034,0,16344},
+{61046,0,16356},{61052,0,16362},{61054,0,18733},{61073,0,16381},
+{61084,0,18735},{61089,21,18737},{61095,0,17332},{61096,9,18743},
+{61100,21,18746},{61108,0,18754},{61111,0,18757},{62211,85,17609},
+{62245,0,18797},{62247,0,18799},{62276,0,18828},{62278,0,18830},
+{62282,5,18844},{62368,5,17716},{62380,0,17723},{62448,0,17781},
+{62457,5,17788},{62460,0,17791},{62472,13,17801},{62525,0,17845},
+{62528,9,17163},{62532,0,17167},{62534,0,17169},{62536,5,17171},
+{62539,0,17174},{62541,0,17176},{62544,9,17179},{62548,9,17183},
+{62551,0,17847},{62554,6,13457},{62556,13,17191},{62561,9,17196},
+{62565,5,17200},{62569,0,17204},{62572,5,17207},{62574,6,13459},
+{62580,0,17850},{62583,10,13461},{62587,0,17853},{62588,9,17223},
+{62592,5,17227},{62595,0,17854},{62596,5,17231},{62600,0,17235},
+{62603,0,17238},{62605,13,17240},{62609,0,17855},{62615,5,17250},
+{62619,0,17254},{62622,0,17257},{62628,9,17263},{62631,0,17857},
+{62633,5,17268},{62637,0,17272},{62639,5,17274},{62642,0,17859},
+{62643,5,17278},{62647,0,17282},{62650,25,17285},{62657,0,17860},
+{62659,9,17861},{62663,13,17865},{62668,13,17870},{62673,17,17874},
+{62679,0,17880},{62681,5,17882},{62683,5,17292},{62685,5,17884},
+{62687,6,13464},{62690,18,13466},{62695,9,17298},{62703,0,17893},
+{62706,6,13471},{62712,0,17899},{62716,0,17902},{62718,13,17904},
+{62723,0,17908},{62725,0,17910},{62727,41,17912},{62739,13,17924},
+{62744,21,17929},{62751,29,17936},{62762,0,17947},{62771,5,17956},
+{62778,5,17633},{62781,0,17636},{62798,0,17653},{62803,0,17658},
+{62806,0,17660},{62809,5,17663},{62814,0,17668},{62821,0,17675},
+{62827,0,17681},{62834,0,17688},{63124,0,18044},{63134,0,18054},
+{63149,0,18068},{63152,0,18071},{63461,5,13999},{63464,0,14002},
+{63466,5,14004},{63469,5,14007},{64012,6,13473},{65072,6,13475},
+{65075,6,13477},{65077,5,130},{65079,5,134},{65081,5,138},
+{65083,5,142},{65085,5,146},{65087,5,150},{65089,5,154},
+{65091,5,158},{65097,5,199},{65099,5,203},{65101,5,201},
+{65103,6,13479},{65106,0,114},{65108,13,116},{65113,21,160},
+{65119,9,205},{65122,17,223},{65129,9,268},{65281,26,13481},
+{65288,5,128},{65290,22,13488},{65296,37,333},{65306,26,13494},
+{65313,101,365},{65339,18,13501},{65345,101,391},{65371,10,13506},
+{65380,0,113},{65506,0,14049},{65508,0,14050},
+};
+
+static const unsigned short cmap_UniCNS_UCS2_H_table[13509] = {
+178,13747,280,212,18788,18786,18792,18790,18801,18796,18794,18805,
+18803,18810,18808,18832,18814,18812,18818,18816,211,18840,18822,18820,
+18785,18802,18789,18807,18791,18809,18841,18793,18815,18787,18804,18813,
+18795,18817,18835,18806,13748,504,503,505,18798,18829,18800,18831,
+121,123,111,110,248,245,247,246,252,251,220,233,
+232,240,239,219,222,322,14090,14072,14081,14063,14074,14083,
+14065,14078,14087,14069,14080,14089,14071,323,14084,14066,325,14086,
+14068,14073,14082,14064,14079,14088,14070,324,14085,14067,321,320,
+304,303,302,301,300,299,298,14096,310,313,190,189,
+183,182,192,191,188,187,184,181,329,328,186,185,
+241,243,242,17700,732,236,235,17815,18083,16075,17273,15149,
+17840,18070,17959,16236,18438,14342,16403,15583,16589,16613,14597,17046,
+15674,18464,14904,15283,14716,15581,16918,16636,14713,14720,15500,15671,
+16646,14743,17976,15592,16784,17295,14942,16095,16796,17203,18006,18005,
+18007,14426,18022,16883,14958,15594,18057,18654,16740,15727,15091,14745,
+16989,17963,15380,17156,18157,16501,14420,18162,15533,17055,15528,18166,
+15069,18168,15093,15373,15081,16521,17879,17236,17367,16988,15598,16870,
+18250,15219,15074,14317,16847,15217,15602,16052,18079,18275,15076,16563,
+15264,15866,18321,18765,15382,18368,14658,15396,15395,14676,595,597,
+598,18686,6001,617,615,618,616,6002,660,6010,6008,659,
+658,754,753,752,755,751,18685,16215,619,17651,661,6011,
+662,6030,1045,6388,537,17687,620,663,756,6031,17719,13999,
+5996,599,6003,623,16526,757,759,758,2097,596,14001,17637,
+5997,600,625,624,882,15845,2555,7733,17806,17340,3518,539,
+601,17807,666,17820,1323,602,6004,626,667,669,6012,670,
+668,14788,883,18645,1324,1325,1699,540,627,671,884,886,
+885,9059,16700,13175,603,17638,14769,17808,673,672,6013,674,
+680,6015,6014,677,16226,761,768,6037,6033,6036,769,785,
+6032,6034,18635,17809,899,6074,896,900,6084,6072,897,6076,
+14765,887,6075,902,6079,14792,6083,6080,6077,888,890,903,
+892,6069,895,6085,6082,6073,891,6070,889,17724,17725,14782,
+6071,6191,1068,1055,14653,6192,1052,1070,17810,1060,16229,1059,
+6180,1063,1058,6185,6193,6189,14795,1061,15247,1064,1049,1073,
+6182,14772,6400,1047,1069,1048,6187,6183,1062,1054,6179,1050,
+6190,1071,1074,1053,1066,1072,1051,6188,1067,6194,6181,1065,
+6184,1341,6402,6414,1333,6415,1328,1338,15474,1331,6396,1339,
+6395,6399,6406,6404,1347,1342,6390,6392,1344,1332,6393,6405,
+6412,1337,6398,6391,1336,6394,1340,6397,14773,1335,1345,6407,
+1346,6411,6409,6413,1343,6401,6389,6403,1334,6408,1329,6410,
+1716,1704,15690,6749,6757,1703,1711,1723,6763,6761,6756,1705,
+6762,6752,1719,1710,1718,6747,6759,18152,6750,1714,6751,14799,
+6746,1721,1708,1717,1707,6748,6753,6760,1715,1712,6755,1720,
+6758,6754,1709,1722,1713,1706,1702,15462,14800,2124,2102,2118,
+16168,2123,7204,7203,2105,14259,2114,16166,2127,7197,2108,7198,
+16420,2129,7217,2572,2113,2112,7199,2116,7749,2107,7210,2122,
+2121,2111,7202,7211,7196,2110,7212,2119,7200,2101,2104,2103,
+7213,2117,2106,2126,2128,7207,2125,14796,7215,7201,7216,7205,
+14608,7214,7757,7745,7750,7756,2559,7743,2563,7747,7740,2561,
+7744,2566,2571,2567,16172,7760,14801,2562,7746,2558,7741,7737,
+7751,7738,7736,7748,2564,15817,8376,7752,7735,7753,14797,2574,
+7758,2573,7734,7742,7759,2569,2568,2565,2570,3052,14798,8379,
+8372,8380,17308,8370,8373,3048,8374,16876,3051,8378,8368,8367,
+3053,3054,3050,3055,8366,8377,8375,8369,3047,8371,3525,3519,
+9063,3528,9069,9072,9066,3520,9075,3526,9076,9071,3527,9060,
+3524,9061,9070,9068,9064,3523,9062,3529,9067,9074,9065,9073,
+14789,3976,3973,14545,3974,9756,9748,3972,3969,9749,16334,3971,
+9752,9754,16433,15101,9761,16753,9760,9755,3968,9747,3966,9750,
+3977,9753,9757,3970,3967,9759,9758,3975,9751,15593,4357,10371,
+10368,4358,4356,14802,10375,10372,10365,4355,16434,4359,10366,4354,
+4362,14790,16436,4749,11012,4746,11009,4748,4750,11010,4747,5045,
+11582,5046,11580,11581,11579,11578,11583,5044,14766,10367,12046,5047,
+5493,12998,12997,5820,5819,13326,604,628,682,681,771,770,
+906,905,907,904,1076,1075,1077,1348,1350,17306,1724,281,
+7218,282,2575,284,283,8381,16442,285,3978,286,683,908,
+1351,16444,606,686,17727,1078,1353,1352,1354,15054,17311,6009,
+14006,1726,1725,7220,7219,2576,542,687,6016,16038,14810,4752,
+543,774,911,6086,16456,16465,15740,16402,16457,6196,6417,1355,
+6418,2136,16938,7224,16459,7221,2137,2135,2134,7225,16460,7762,
+16461,15789,16463,8382,9077,9762,17818,4363,4753,11013,16975,607,
+621,16466,2577,3057,3979,16760,5998,688,17819,1356,16138,14003,
+629,6039,778,16473,6038,916,912,6197,1675,6198,16224,18736,
+6199,1082,1081,16474,17314,1085,1361,6423,16123,6419,1363,1359,
+1358,1360,1357,16475,1729,6765,6422,1734,6766,1730,1733,1732,
+1731,1728,2140,7231,2138,16477,14820,7227,2141,2139,2142,16169,
+7226,7232,17945,3061,2578,7763,7765,7764,7766,2579,3058,16195,
+3531,9079,17315,9078,3981,3980,10102,15807,17821,4754,4755,16478,
+12412,13000,12999,13327,16232,610,780,779,17730,917,14821,1086,
+1089,1366,6424,6767,1738,6768,1737,16097,7233,16649,16170,2580,
+7768,2583,7767,2767,2582,2581,3063,3062,3533,16483,14823,10380,
+4369,10379,4756,11584,5048,12413,5641,544,630,692,6017,918,
+6202,1739,7234,2585,2584,8384,8383,611,695,783,2586,5999,
+6040,784,6091,920,919,6090,1090,16182,7769,3538,9767,3982,
+16336,16493,11014,12743,545,696,17732,6427,6769,2589,612,18759,
+631,363,699,698,697,787,786,6041,6092,17733,1370,1367,
+1369,1368,613,17665,700,17319,789,788,6203,18442,1371,16077,
+6018,16506,791,790,6204,1091,16507,1092,1741,6770,18689,16509,
+2144,6428,16514,6429,6772,6771,6774,6773,1742,7770,2146,7235,
+2145,16516,8385,3066,16699,8386,16702,17824,16326,16517,9768,3983,
+16518,16523,17318,2590,614,632,703,702,14518,704,14842,17734,
+15933,1375,1377,17735,16528,16185,1743,2147,16531,11015,5321,633,
+794,809,804,799,798,805,803,796,810,797,793,808,
+807,806,795,802,16534,14344,801,811,800,934,930,936,
+6094,933,923,926,929,925,932,935,924,927,931,937,
+16536,15479,6215,6212,15972,1105,6213,1093,1095,1119,1114,16899,
+17827,6220,6214,1097,1099,6219,1106,6209,1118,1120,1094,1111,
+16556,6207,1117,15989,1102,6208,1110,1108,1109,1115,6216,1096,
+1116,6218,1104,1101,6211,1100,6221,1103,1107,16081,16039,1098,
+6217,6446,6445,1395,6448,6450,6439,6442,6449,1396,16178,15747,
+6436,6440,16541,6444,6789,1391,6793,1378,6441,1379,1392,1385,
+1381,6437,1384,1389,1398,6438,6431,1383,6432,6434,1386,18137,
+1388,6430,6435,1397,1393,6443,1399,16545,1390,6433,1387,17831,
+16024,1382,1380,16010,6447,6788,6776,6791,17832,16546,6778,1750,
+1764,1746,1763,1755,1760,1744,6777,6783,1759,6795,1761,14148,
+1751,17833,6785,6782,1749,17834,6775,1762,6790,1754,6792,1765,
+1745,1756,1753,6780,1757,1752,1758,1748,14755,17320,14848,1747,
+6779,17835,7255,2160,7237,17217,7242,2153,2164,7240,2148,2158,
+2163,7247,2159,2162,17836,7250,2154,7241,2156,7252,2152,2167,
+2150,15564,7257,7245,7249,2155,2166,7246,2161,7251,7258,7785,
+14963,7256,2168,2149,7248,7239,16041,2157,7238,17837,17161,7236,
+2165,17839,7777,16538,2609,7791,2607,2604,7782,2600,7786,2611,
+7776,7781,7780,2151,2606,7789,7792,7773,3084,17321,7793,2612,
+2598,2595,7784,2592,16554,7790,16488,2599,7794,7774,7788,2602,
+7775,7778,7783,17326,2603,2601,2613,2608,16544,2596,2748,2597,
+7779,2610,2605,7787,2594,16031,2593,15150,15302,16011,16164,3067,
+3070,8402,3090,8405,3068,8398,3074,3080,3355,16558,3078,8395,
+3091,3071,3079,8403,9095,8408,8396,17166,8387,8400,8394,3077,
+8406,3073,3093,3086,3075,3072,8407,8393,8399,8401,8389,8404,
+3069,8388,16559,3076,3092,3088,8390,3082,14581,3089,3085,3081,
+14846,8397,17322,16009,3087,15811,9093,9089,15951,9104,9082,9091,
+3545,9100,3555,9087,9086,9084,9102,3543,9096,9085,3546,9094,
+3541,9090,9097,9099,17843,17323,9103,3550,9083,3544,9088,16020,
+3539,3551,9098,3554,3542,287,3540,9092,15996,3549,16008,16003,
+9101,18310,3999,3994,9783,9779,17958,9773,3988,3984,9782,3985,
+9776,9778,9781,16002,3990,3997,3991,9774,3998,16205,9772,9777,
+3989,9770,3995,3987,3986,9775,9780,15976,3996,16253,17325,15975,
+18183,4377,10397,10394,15971,4371,4374,10392,4376,10384,4382,16567,
+10396,4373,10398,4372,10393,10395,4375,10391,10385,10382,15998,8392,
+10388,10381,10387,10386,10383,16572,4379,16573,18383,17858,4378,17327,
+4380,10389,4757,10390,16121,11024,11017,14354,4769,11021,4761,4765,
+11020,4764,4760,4763,4758,4768,11022,11018,4767,11016,4766,11023,
+11019,4381,4770,11025,4762,4759,15749,16055,16109,11591,11593,5050,
+11594,11592,11590,11589,5052,11588,5053,17960,14665,15948,5049,5054,
+5051,14758,11585,12051,12049,12054,12052,12050,12053,14756,14664,15560,
+5494,12419,12415,12420,12416,5323,17911,17983,12744,12746,5644,12745,
+5643,5642,15965,5739,5738,5740,13001,13177,13176,5821,5823,5822,
+13178,5878,13441,13440,13513,18570,6005,813,812,940,939,6096,
+938,6095,17736,1123,6224,1121,1124,16580,6222,16579,1122,16575,
+6452,1400,1766,16578,7796,2614,2616,7795,2615,8409,3094,9105,
+15926,4001,10399,11027,11026,14850,13573,634,6020,943,947,6098,
+945,944,6097,946,942,15097,941,6099,1131,18517,1127,6225,
+16588,16606,6226,16584,1129,6228,1125,6229,6227,1128,1130,1133,
+1132,1126,6230,1405,6465,1406,16171,6466,1404,1403,6456,6453,
+6458,6457,6454,6461,6459,1402,16223,6462,1408,6467,18140,14855,
+6460,1767,1401,15483,1768,6800,14854,6806,16742,1774,6804,6810,
+6801,6805,6807,6809,6803,17928,6802,1769,18532,1771,1770,6799,
+6808,18241,6796,7270,7269,7274,7265,15481,7268,7267,14124,7271,
+7275,2171,2174,15195,7266,7272,15627,2173,7261,1772,7810,7273,
+2172,7263,7801,14853,16129,2617,2621,7817,7799,7813,2622,7815,
+16591,7821,7816,7804,7812,18260,7826,7824,7814,7809,7802,8417,
+7800,2626,7807,2627,2623,7797,7819,7805,16527,7803,7822,2624,
+16593,7828,2618,2620,7811,7806,2175,2619,7808,7823,7827,7818,
+8421,8420,3102,8413,3103,3101,15400,8415,3098,8419,16596,8414,
+8416,8410,3096,8429,8428,8425,3095,7262,8422,3097,2625,8424,
+8411,8427,8426,15730,8430,8423,15746,15042,8418,9111,3567,3570,
+3565,9110,9114,9109,3559,3569,9106,3563,9113,3561,3560,9116,
+3562,9118,18761,9115,3558,17375,3568,9120,9108,9117,9107,15717,
+3564,14746,3566,9121,15398,17237,9791,4002,9797,4007,9793,9800,
+9785,4009,4003,9790,4385,9789,9798,4004,4008,9788,9794,9799,
+9784,4006,9792,9796,9802,9786,9795,4005,9801,9787,17944,18691,
+4389,10401,4387,4386,10403,10408,10407,4392,16107,4744,4391,16599,
+10400,10406,4390,10405,14244,10402,18496,15869,11032,14059,11034,11029,
+4772,11031,4771,11033,4774,11035,4773,11028,11030,5058,11597,5057,
+11598,5056,11596,5055,11595,5325,5324,12421,12423,16602,12422,5498,
+12747,5646,13329,13328,5920,635,705,1135,17737,15720,15482,6811,
+16604,9122,4010,9803,10409,548,6021,17738,17817,6231,17739,6468,
+6812,7276,2176,17012,12424,5741,636,814,6044,16611,2628,4013,
+4011,706,708,707,6022,709,815,6045,816,17740,1413,6469,
+1410,7277,1778,1777,1779,1776,6813,1414,1775,3106,8431,2629,
+4015,4014,9804,4393,4775,12055,13179,13330,638,817,15978,818,
+6106,953,956,6104,6102,955,6105,6107,6101,958,957,954,
+952,6103,15664,1147,1144,6237,6240,6239,1138,1146,15513,1143,
+6236,6234,1142,15280,1137,1140,15791,6235,6242,6238,1141,1145,
+1148,6233,6241,1139,1419,1427,15576,6481,6474,1428,6485,6470,
+6477,16173,14864,1418,6471,1416,6478,6482,1415,6483,6476,6479,
+15620,1430,1421,6486,6484,16620,1426,1424,6475,1423,6473,6472,
+1422,1420,1429,1425,1417,1781,16625,1788,6827,1780,6819,6815,
+6831,6814,1783,6824,1786,1789,1784,6828,1787,15705,2186,6834,
+6816,15672,15282,6818,6825,6829,6833,6830,6823,6826,15946,16632,
+6820,1791,6822,6821,6832,1782,6817,1790,15245,1785,2192,7285,
+15497,2191,15160,2180,14867,2185,7282,7279,7284,2181,7278,2184,
+2182,7286,2183,2187,14875,2188,16616,2190,2189,15163,15680,14863,
+7836,2630,8445,7835,7854,2636,15040,7852,2635,2631,7861,7845,
+7848,14615,2639,7858,7850,2632,2640,7855,7853,7838,7859,7847,
+7842,17923,7832,7860,7844,7831,15156,2638,7849,7862,7846,7834,
+7839,7830,15667,2637,16635,7843,7840,2633,7833,14775,7857,2634,
+14914,7841,7837,15679,7856,15668,3107,8438,15585,8435,8452,8440,
+8453,14865,3109,14877,15665,8449,8446,8447,8450,8454,7851,8456,
+9142,16949,3110,8457,8433,8443,16640,8448,14858,3108,3111,8455,
+8458,8437,8434,16754,15580,8436,8441,8439,3112,16634,8442,8444,
+8432,9130,9128,3580,3578,9138,9129,9139,9135,9127,9141,9126,
+9133,3577,3576,3575,9131,9136,3572,3579,14486,9124,9134,9123,
+9132,3573,9137,9125,3574,9140,15496,17333,9808,4020,4019,4021,
+9820,9810,9816,9805,9819,9818,9822,9815,4016,9814,4022,15238,
+9807,4017,9821,4018,9809,9812,9817,9811,9806,14325,9813,10411,
+4397,10414,10413,10416,10418,14062,4395,10412,15389,10410,10419,10417,
+10415,10420,4399,4394,4396,4398,18687,10422,11042,15350,11041,11040,
+11043,11036,11037,11045,11038,4776,11047,18753,11046,11039,11602,5061,
+11600,11605,11604,11044,5060,15236,11603,11599,11607,11606,5059,5647,
+14536,5648,14916,12748,17074,13005,13004,13331,13442,14897,641,710,
+819,6108,1150,1149,6487,1433,1432,6488,17742,17949,1792,2193,
+7288,15967,7864,2641,3114,7863,3113,14130,4023,16650,9823,4778,
+5062,11608,16652,5649,5824,549,6046,16452,820,6047,963,1154,
+1153,6243,1155,18665,6244,6489,1434,1436,1438,1435,1439,1437,
+16662,1796,1793,1795,1797,1794,7289,6835,7291,7290,2199,2196,
+2198,2200,2197,2202,2201,2646,7866,7865,2645,16165,2644,2643,
+2647,2642,8464,8461,3116,8460,8465,3118,8463,3115,3117,8462,
+16657,9143,17083,4024,4032,9824,4026,4030,9825,4031,4025,4029,
+4402,8459,4403,4401,4400,11048,4779,5499,5650,7292,2203,16664,
+2650,2649,2648,8466,4033,4780,643,6023,711,6048,16666,16668,
+6109,966,14889,9146,15753,644,17640,712,6110,8467,3121,5063,
+645,665,713,6049,821,1160,1159,6492,1441,16671,16220,1802,
+6836,1801,2206,2204,16130,7294,2205,7293,2194,7867,4034,9826,
+10423,5064,5742,13443,6006,714,6051,6050,16673,6254,6249,6251,
+6253,6250,1164,6247,6252,6255,1163,6256,18060,17745,18778,6506,
+14890,6500,6495,1445,6503,6501,6494,6507,6510,6505,6498,1447,
+6504,1448,6499,6502,6493,6497,6509,1449,6496,6508,1444,1446,
+17336,15692,6853,6846,6852,6845,6847,6841,6839,6854,6851,6837,
+16147,1804,6848,6840,6838,1803,6844,6842,6843,6855,2211,16674,
+2210,7295,2207,7297,16675,2212,7298,2213,7299,6856,7301,7296,
+7300,2214,2655,2654,7869,7873,7875,2656,7878,16679,2660,7880,
+2662,17337,2658,2666,16680,2663,7871,2657,7870,7868,7882,7872,
+2659,7881,2664,7877,7876,2665,7874,2661,7883,18131,7879,8482,
+8489,8478,3124,8474,8490,8468,8487,8485,8479,8488,8481,17961,
+8473,8491,8471,8484,8469,8492,16681,3125,17962,8486,9150,8472,
+3122,3123,8475,8480,8477,17338,16330,9157,9149,9156,9155,3581,
+8470,9153,3582,18148,9148,9152,9840,9831,9838,9829,9837,9841,
+9828,9832,9827,4035,15924,9830,4036,9836,9835,9834,16676,9839,
+16140,10427,10429,4407,10430,10424,10434,10432,4406,10435,10426,10431,
+10433,10428,11052,11057,11051,11056,15929,11049,11059,11055,11060,11054,
+11050,11058,11061,11053,16728,11611,5068,17966,5066,5065,5067,12059,
+15359,12323,12428,13183,5826,5825,13182,5879,16684,13332,647,968,
+6115,6257,1306,2667,648,824,823,822,715,16225,3126,652,
+6024,16704,6258,15754,1166,1456,16174,6512,1454,1453,6511,1451,
+6513,1452,1455,1808,6861,6862,1807,7303,7302,2217,16693,2670,
+7885,2669,2671,2668,3128,7884,3129,8494,17312,3130,8493,3127,
+9161,9163,3583,9162,9160,9159,9844,4041,4039,4037,10439,10437,
+14891,4409,10438,4410,4408,4038,10436,11613,5069,11612,11065,12429,
+653,827,971,6116,970,1457,3584,551,716,828,1809,3131,
+552,6053,6054,16648,6117,17746,1168,6263,6261,1169,6260,6262,
+6264,1458,6866,1460,6865,6867,6864,6868,1811,2221,7304,7306,
+2219,7307,2220,7305,6863,7886,7887,2675,2674,17341,2676,3135,
+9164,9166,9168,3586,3585,3132,9167,9165,14896,9848,16701,9846,
+9852,4042,9853,9850,4043,9847,9845,9851,4412,10441,9849,4414,
+10442,4413,4416,10443,4411,4415,11070,11068,11067,11069,11066,13008,
+13184,5954,553,1463,1170,14447,16707,1812,16708,16710,654,717,
+829,6118,1171,6265,6869,1813,4044,655,14910,16713,14911,972,
+3587,656,831,830,6119,973,6514,1466,1814,6870,7309,2222,
+2677,7891,2678,7892,9855,9854,4417,10444,4781,11071,5070,15269,
+5827,13334,554,17641,6871,2679,8495,3588,15706,5327,555,1174,
+16722,1173,1815,2681,2953,2682,2680,3137,9856,4046,4418,16724,
+6007,6120,6268,1175,6267,1176,16472,1470,6521,6520,1469,6519,
+17969,1817,6872,1820,1816,1822,2225,2224,2223,7894,2683,2686,
+2684,7893,2689,2685,7895,2688,2687,16428,8497,8496,16727,3140,
+8498,3589,9171,3590,9170,15768,10445,4420,9857,4419,4047,16287,
+11073,11072,5071,11614,12430,720,17642,832,1178,1180,6123,6271,
+6270,6269,6122,6121,975,1179,1177,974,1471,6522,16815,1472,
+6276,6278,6277,6523,1184,1182,6272,6274,6280,6275,6284,1474,
+6281,1183,6279,6282,1475,6283,6543,6530,6528,6542,6537,1827,
+1476,6538,6541,1823,6540,1477,1482,1480,6531,6526,6533,1487,
+6544,1824,6534,1825,1483,6536,16773,6887,1826,6525,1484,1828,
+1485,1481,1486,6535,6524,6539,1478,16737,6527,6532,6529,1479,
+6884,7314,6885,1834,6888,6878,1833,6880,6881,16500,6883,1829,
+14060,6879,6875,2230,6889,2226,7312,6882,7311,6877,6886,1832,
+2227,1838,2228,6890,7313,1831,2232,1837,1836,1835,2231,6891,
+2233,1830,14919,2690,7317,7319,7321,2234,2240,7898,7325,7316,
+2692,7896,2239,2237,7327,2238,7322,2241,7324,2236,7323,7326,
+7320,16746,2235,2693,7315,2691,16385,15068,2694,7900,7909,3143,
+16748,2696,2701,3144,7911,2708,8500,7901,2700,2703,2698,7899,
+7913,7916,8515,7914,8504,2699,2706,2710,7908,8499,7912,2695,
+8501,7915,8503,7904,17973,2704,7906,2709,7910,2702,7907,15820,
+2707,3145,3142,8502,15733,7905,2697,15748,15739,16393,3150,3154,
+8506,3595,3152,8510,3156,9172,8512,3597,3148,3151,8513,16296,
+8514,8520,3158,3598,8516,8521,8509,3608,15413,3599,3157,8507,
+8522,15495,3607,3155,3592,8519,3159,8511,8505,3149,8508,8517,
+16118,3591,3596,3146,8518,3606,9859,9183,9175,9858,9179,9181,
+16183,9177,3609,17974,3604,4049,9184,9860,16756,3602,9176,9180,
+4048,3593,4050,3601,3603,3600,9182,15410,9870,4425,9877,4056,
+16314,4055,9872,16774,4424,9861,4054,18764,9876,16755,9873,10462,
+4422,3153,9875,4429,9867,4423,16320,4428,9862,9866,9863,9869,
+4057,4421,4051,10448,9871,4427,16317,4430,9868,16759,4426,10447,
+10452,4785,10446,11085,10461,4434,4432,4783,10458,10454,4438,15840,
+11076,14933,14932,4436,10453,16386,11074,10460,10451,4431,11075,4784,
+10459,4433,4435,10456,4439,10455,10450,10449,4782,10463,11078,11616,
+4787,17977,11084,17343,11082,4788,11083,14928,11080,5073,11615,11077,
+11079,5074,4790,5072,4789,5076,11081,4786,17978,16769,11623,12063,
+11619,16325,5328,11621,11620,5075,11618,11622,12071,12067,12069,12068,
+12066,5502,5505,5504,5503,5652,12755,5653,12431,5744,13009,5745,
+5828,5880,13335,13619,721,6056,833,979,1186,1185,6545,1489,
+1488,3160,9185,9187,9189,9188,9878,4058,9880,17980,10464,4440,
+5077,5329,5078,722,17690,16322,6285,6546,1491,1490,1492,1839,
+7329,2242,2713,3161,8523,723,17644,657,724,6057,837,836,
+982,6130,6132,981,6124,6131,6127,6129,980,6126,6133,6128,
+1193,1202,1200,6295,6292,6300,1198,6301,1191,6298,1197,6294,
+6293,1195,6299,1196,1493,1190,6296,16262,6286,1187,16208,1206,
+6291,6297,1192,1194,17344,1205,1199,1204,6290,1203,1189,1188,
+1201,1507,6558,6551,1502,1521,6547,6554,6556,6559,1516,6555,
+6548,1514,6552,6560,1499,6557,1509,1508,6550,1497,1498,15759,
+1496,16778,1520,1512,1506,1494,6553,1505,1495,1513,1522,6894,
+1510,6549,1500,1517,1511,1515,1501,1840,6900,1852,1844,1846,
+1851,6912,1849,7330,2243,1854,6897,6905,1850,6904,6901,6909,
+6911,1843,1847,1853,2245,6906,1845,1856,6899,1848,2244,1842,
+6896,6903,6895,6898,6902,7331,1855,6910,1841,2259,7343,7333,
+7349,16093,2248,14949,7917,7351,7345,16150,7336,14947,7354,7339,
+2254,7940,7342,2256,2247,7356,7344,2250,7337,2251,7350,7357,
+2253,7341,7340,2261,2260,2246,2252,2255,7353,7347,2249,7332,
+7355,7346,7348,7352,16327,7918,2721,2741,2740,2729,16782,7936,
+7932,7929,7947,2724,2716,7934,3177,2720,7942,17255,2742,2739,
+7938,7921,16203,2738,7944,7920,2727,2731,7943,7930,2732,2726,
+7919,16776,3163,7946,7928,2737,7931,7945,2736,2717,7926,2722,
+2733,2728,7935,7925,7923,7941,2714,2734,2718,3162,7939,2719,
+2715,2730,2725,2723,7927,2735,7924,7937,7933,8526,8525,7922,
+8542,3165,18088,8548,8531,8545,9190,3168,8549,8552,3167,8534,
+8551,8550,3169,8527,3164,3172,14950,3170,8547,8537,3174,8554,
+8546,8555,3182,3180,8544,8543,15968,8541,8535,3173,17985,3171,
+7338,8528,18591,9220,8529,3166,3179,9192,8530,8553,9191,8538,
+8533,3178,8539,8536,16786,3183,17986,16028,3626,17987,9195,9214,
+9219,9207,3622,9224,3619,9193,9194,3612,3621,9201,9215,9221,
+3620,3614,9200,9196,9223,9197,9217,9208,9218,9210,3615,9881,
+3618,3616,9222,9213,9209,17881,9198,4068,9212,3623,9204,16785,
+9203,16797,14955,3617,3613,9902,9216,9211,9882,9893,9900,4066,
+3181,9898,4061,4060,9905,17346,9883,9896,9884,9895,4064,9899,
+8540,9906,9891,4067,10478,4441,9904,9903,4069,10465,4442,10466,
+14939,9885,9890,9886,9907,4063,4443,4065,4070,17260,9889,4059,
+4446,11092,10474,10473,10475,17187,10472,4447,17347,4453,4450,4451,
+10467,10470,10480,4459,4457,10471,8532,4444,10477,10468,4460,10476,
+4062,4449,9892,4456,4458,4455,4454,17121,4448,10479,4445,4461,
+17216,11091,4805,4802,17989,4793,4800,11093,4798,4792,11090,5080,
+4794,4801,5079,11089,11088,4803,16131,4804,11087,11086,5081,11096,
+4797,11094,5082,16793,5087,11626,11628,16794,5084,14248,11629,11625,
+17226,11627,5085,5088,11624,5083,5086,5331,11095,5330,5336,12075,
+12078,12074,5332,12072,5506,12076,12077,12073,5333,12432,12435,17718,
+12436,12434,12437,5507,12433,15017,12759,5655,12758,12757,12756,5654,
+5656,13010,5747,5746,16775,16064,13186,13185,13188,5881,5829,13339,
+13187,13338,5883,5882,5921,13444,13514,725,15970,8556,11097,556,
+17645,983,6134,1209,1207,6561,1523,1857,1858,7359,7948,2752,
+2751,2744,2747,2750,2746,8560,2743,3184,16805,8559,8562,3185,
+8557,8561,8558,14956,3627,16804,4071,9908,4806,4462,10481,10483,
+10482,10484,11099,11098,11631,11630,12438,16803,17992,726,16651,17748,
+3189,3188,9226,12079,5748,13340,727,2754,2753,3628,9909,4072,
+11100,728,838,1524,6562,6915,1859,2755,8566,3190,3629,16807,
+11632,5337,13515,729,6563,1525,1860,15931,6916,2265,7363,2266,
+7360,7949,2759,2756,8567,16810,8568,9227,15272,4074,4073,11633,
+12080,12440,12439,12760,557,6025,1861,16814,730,839,985,984,
+6136,6135,6302,1210,6305,6304,6303,6306,1526,6569,6565,6574,
+17994,1533,1531,6570,6566,6573,1530,1537,6568,6564,1536,6571,
+1529,6572,1532,1534,6576,6575,6567,1528,1527,1535,6921,6927,
+14995,1867,1864,6918,6923,17045,1870,1862,6922,1865,1868,1863,
+6930,1866,14989,1869,6919,6924,6928,6920,6917,6929,6926,2274,
+2267,2270,16820,2273,7366,15769,2268,7364,16823,2272,7367,2271,
+17995,7953,2761,7952,7954,2760,2765,7365,7951,7955,14992,2762,
+7950,2764,16825,2763,8575,14987,8570,3191,3195,3192,8573,8576,
+16827,3193,3194,3199,9236,8574,3197,8571,8569,18075,3198,3635,
+16738,9228,3631,9233,9232,9229,3637,14985,9231,3196,17997,9235,
+9230,3634,3630,3636,9234,15677,9912,9911,9910,4075,4076,10489,
+10492,4466,18760,4465,10493,10488,4468,10490,16565,4467,10487,15891,
+10491,4812,4809,11109,11108,11107,11102,15770,11103,4807,4811,11101,
+4808,11110,16568,14967,11106,12083,5091,5338,5509,12441,12761,5749,
+13341,5884,731,16004,6577,1871,2275,2766,3056,8577,16836,3638,
+9914,9913,732,990,6578,1539,16354,1538,15777,17999,2278,7956,
+3203,15755,3202,9237,9506,9915,11111,14239,5339,5658,733,841,
+844,840,6144,992,994,15937,6139,6138,6141,6140,6143,991,
+6137,6142,16411,6307,1221,6308,6312,1220,6316,6311,6314,6310,
+1218,1224,6309,6315,1217,6313,1219,1212,1222,15718,16843,6580,
+1540,1543,1561,1545,6588,1556,6583,1546,6591,6584,1559,6596,
+1554,1552,6595,6587,6579,6586,1547,1541,6590,6589,6581,18113,
+1555,6593,6582,1558,6600,1542,1549,6585,6594,1557,1544,1548,
+6592,15738,6964,1879,1892,16884,6959,6949,1885,6947,1878,6942,
+1888,6955,6936,6938,14330,6941,6933,6954,6970,1883,6943,6961,
+6972,6963,6948,6956,1889,1876,1884,1896,1873,1875,15192,16846,
+6940,1893,1886,6966,6937,1895,1890,6946,1894,6953,6945,1887,
+6965,6957,1881,6971,6944,1877,6962,6952,1882,6958,1874,6934,
+1891,2293,1880,6951,6950,6939,14742,6967,17749,1872,17351,16851,
+16328,15722,17750,7389,2300,7390,7378,2289,2301,7371,16498,7380,
+7388,18114,7370,7397,2279,16848,7396,7391,7392,2287,2298,7382,
+7383,7393,7384,7387,7381,15918,16925,2280,2284,7395,7375,2296,
+2292,16711,2295,2302,2285,2297,7386,2299,2282,15339,2281,7372,
+18003,7376,2290,7394,7385,7377,2294,2291,2283,2286,15760,14356,
+7981,7978,7971,7970,2775,7974,7989,7957,7990,7976,7994,7982,
+2774,7980,2769,2790,2780,18004,2784,2783,7958,18103,7987,7993,
+7985,7992,7973,7959,7991,7975,2772,2785,7984,2778,15018,7983,
+7960,2786,2788,7986,2789,2771,7967,7988,16612,2777,2787,7969,
+7979,7964,7968,2782,7963,2770,2779,2776,7972,2288,8600,2773,
+15006,16860,2781,15406,8603,8625,8614,3223,17131,3218,8597,3219,
+8613,8606,8619,3215,8579,8621,3205,8587,3208,3207,3210,3206,
+8595,3217,8590,8617,3213,8609,8622,8584,8589,8583,3212,8602,
+9259,8585,3216,8594,8618,3211,8591,8588,8605,3214,3204,3226,
+8608,8607,16863,16862,17147,17052,8580,3209,8620,8596,8598,18008,
+8611,8610,8578,3220,3222,8586,8593,8601,3221,8592,8604,8623,
+8612,15778,15744,14269,9279,3646,9277,9256,9261,9254,16871,9273,
+9240,9247,9271,9281,9257,16470,9244,9263,9268,9248,18009,9265,
+9245,17775,3648,9272,9270,9241,9275,9276,9278,3652,3644,15750,
+7965,9249,9267,9250,3641,3657,9274,3655,3651,9239,3643,16868,
+9242,3656,18011,9258,9238,15637,3649,9262,9246,3650,9255,3640,
+3225,9264,8599,9243,14957,16859,9269,3645,9266,3642,9260,3653,
+9251,9280,3647,9391,18013,3654,9929,9927,9949,9925,9943,3639,
+4080,9921,9948,16872,9926,9940,4085,4078,9946,18012,9919,9945,
+14128,4096,9936,9952,4094,9928,4079,9930,9944,4088,9923,4092,
+4082,9932,9922,9916,16374,9942,4089,9951,9917,4086,4087,9924,
+9935,9931,9933,16221,4081,9950,4095,9934,9918,9939,4084,4093,
+4091,9920,9941,4090,14831,4083,9937,15932,18014,16856,10505,10501,
+10497,10517,10514,4471,15761,10521,10504,4482,10511,10500,10510,4479,
+10530,10527,10513,10498,16877,16839,10518,10520,4475,10508,10503,10494,
+4472,4480,15913,10523,4481,10495,10529,10516,10522,4478,16857,15696,
+10519,4477,10512,10499,10531,10496,10524,4474,15646,10506,15208,10507,
+4473,4470,10502,4476,10525,10528,10509,11124,15682,17067,15135,11116,
+15012,11112,4825,4814,4819,4815,11126,11137,4813,11118,11127,10515,
+11128,4820,16880,11143,4824,4827,11114,4823,15019,11132,11131,11123,
+15013,14252,11133,11140,11139,14298,4818,4816,11125,11122,11119,11138,
+4826,11136,4822,4821,11130,18016,11113,11115,11117,11135,11129,4817,
+5100,11652,5093,11637,18019,11648,5095,11655,11639,16694,11656,11635,
+11646,15387,5102,11651,11657,11645,5094,11647,11636,5101,18021,11654,
+11641,5097,16882,11643,11640,5103,11642,5096,5099,11650,11638,11653,
+14307,11649,18023,5341,12094,15955,15179,5340,12093,18024,5344,12085,
+12089,5343,12086,15009,5345,5342,12084,12088,12092,16885,15014,16204,
+12447,12444,12453,12452,12450,12445,5513,18025,15530,12446,5512,5098,
+12449,5511,12454,12448,12443,12087,12442,12767,12766,12451,5659,12765,
+12769,13014,12768,5752,5750,13012,13011,13013,5751,15015,5830,13189,
+13344,5885,5955,13518,16888,13620,734,995,7398,7400,7401,2791,
+7996,7402,16891,7995,8626,3228,8627,8629,3229,3227,8628,9287,
+9285,9284,9283,9282,3658,9286,4097,9954,9956,4098,9955,4485,
+4484,10532,16238,11145,11144,11146,15022,11658,5104,12095,5348,12455,
+5831,735,845,996,1225,10658,4829,5349,736,17646,997,6603,
+1565,6602,18027,6974,1898,6975,7405,2304,2303,8630,8633,3231,
+8631,3230,8632,10535,10534,4486,10533,10536,11147,11659,5105,5350,
+12456,5753,6026,1900,6976,2305,3232,8634,3661,3660,18028,11151,
+11150,12096,13345,737,6027,846,1226,6317,1901,3662,738,6977,
+1902,6978,5106,739,16903,6979,16901,7410,7409,7407,7406,7411,
+7408,3233,8635,9291,16249,3663,9962,10539,10538,10537,10540,11153,
+11152,4830,11154,5107,11660,12097,12457,13192,740,848,847,1566,
+6028,6058,998,1567,14507,6605,2306,2310,7412,2309,8004,2795,
+3236,8638,16227,4099,741,17647,6059,16904,849,15877,17648,6062,
+17281,852,6061,851,850,1227,6060,16525,6150,6149,1004,6151,
+1005,1000,15290,1001,16908,1007,6148,999,1228,6336,6334,6321,
+1240,6328,1235,6322,6330,16586,6327,1238,6326,1245,6335,1247,
+18030,1249,6320,16910,1236,6337,1243,1246,14246,6628,1230,1253,
+1244,6323,1233,1248,6331,6626,6324,1239,1250,6338,6325,1237,
+1242,6606,1251,6332,1241,1252,1229,6329,1234,6333,6627,18031,
+1579,1595,6613,1586,15606,6634,1571,16076,1574,6625,6611,6615,
+1582,1584,6618,1591,1577,1590,6630,1585,6617,6619,1583,1588,
+6620,6633,1904,1594,16496,1572,6632,16273,6636,6616,6638,6623,
+1581,6612,1580,1598,1587,6610,6990,1593,1597,6624,6629,15703,
+1599,1592,1578,1568,6614,1569,6637,16269,6608,6607,6621,6609,
+1596,2311,1589,6622,1570,6997,7000,18033,7003,6992,14873,18034,
+7006,7009,7011,6989,1905,1910,7417,1926,7004,7012,6996,6988,
+7444,1913,7001,6993,6995,1918,6998,1912,6985,7007,15043,1909,
+18035,1921,6982,1923,1907,1927,7008,6984,1924,7438,6631,1911,
+1906,6991,6983,1925,1917,7002,1922,1920,6994,1914,6986,6987,
+7005,1908,6999,15603,7420,2319,2324,16540,16930,7429,7435,7431,
+7418,7421,2331,2316,7430,7439,2326,2312,2321,7422,2323,7423,
+7433,16629,14807,2325,7448,7416,2318,2317,2329,7413,7446,7434,
+7447,7441,7427,7442,18036,7436,7445,7443,2330,7428,2315,2314,
+2322,2328,7440,2327,7425,2796,15848,7449,7424,7419,2320,2332,
+2313,16929,7432,7437,18038,15033,2830,8006,8010,2811,2809,18039,
+2800,8008,8007,2820,8013,2814,16379,8031,8043,2797,8028,8021,
+2832,8005,2829,2817,2828,2807,8017,8035,8027,2808,2802,8041,
+8034,8036,2810,2818,8038,8015,8032,8020,8040,2823,2799,2821,
+8025,2812,8019,8018,2801,8012,8042,2803,8022,2833,2827,8011,
+2824,2822,2831,8029,2826,7426,8030,2825,8037,2798,8026,2816,
+8014,2815,2813,2805,2804,8639,8039,15610,8660,15038,2806,18041,
+3265,2819,3247,8654,3261,8642,3244,3240,8672,3246,3250,3245,
+3254,8676,8667,18042,17154,8649,3259,3253,8661,3237,8673,8666,
+3241,8655,3256,3238,8671,3258,8659,3262,8650,8657,8651,3260,
+3268,8647,8643,3243,8656,3257,3266,16948,16849,8658,8682,8674,
+3239,8680,3251,3249,16614,8686,3248,8664,8652,8662,3271,8668,
+8665,8648,3267,8678,8675,8683,3242,8663,3270,3252,3255,8669,
+3269,8653,8009,14803,8679,8677,8681,8644,3264,9324,9323,9297,
+3669,3679,9331,3674,9321,17793,9294,3680,3670,9309,9299,9302,
+9326,3664,9333,9325,3673,9314,3684,3683,3677,9332,3665,9312,
+9303,9316,9328,3685,16894,3667,9311,15884,9304,3676,18045,3675,
+9307,9317,9327,9298,9308,3668,9318,3681,3672,9305,3671,9296,
+9310,9330,3263,4127,9313,9963,9315,9329,3678,9306,3666,3682,
+4506,9295,9320,16489,18047,16431,9319,17720,9991,4124,9980,9985,
+4113,9965,4126,4104,9964,9997,4128,9968,9984,16955,9970,10000,
+9996,4102,4112,10566,4125,4110,9966,16932,9995,4114,9992,10005,
+9972,9981,15034,15611,10003,9993,4109,9979,4103,4101,4119,16800,
+18126,9977,10004,10002,4107,10006,4111,4118,18051,9967,10542,9976,
+4105,4123,4120,4108,9986,9971,4121,9988,4115,4117,4100,18052,
+9990,9982,9969,4116,9998,10001,9978,9989,17026,4106,4489,9987,
+10541,9994,16960,9973,10551,10561,4492,10560,10572,4494,10558,15954,
+10562,4505,10553,4497,16961,10565,11162,4509,4508,10567,10550,10577,
+4503,4493,10570,10574,10579,10568,10556,4496,4499,4507,4502,10559,
+9983,16963,10555,10578,4498,15294,4501,10580,4490,10569,10543,10575,
+5116,18055,10557,4491,10552,4495,10544,4122,10548,16789,10573,10549,
+10547,4500,10546,10564,10563,10576,10554,4504,16953,11165,16966,4843,
+4833,11177,11157,4835,11169,4842,4837,11167,11662,11173,11179,11172,
+11155,11170,11181,11183,4832,11182,4838,4844,15911,4841,11176,4840,
+11171,15291,11159,11164,18056,11175,4839,4836,4831,4834,11163,10545,
+11158,11161,11178,11166,11156,11661,11180,11160,11174,16968,11664,5120,
+5108,15476,15475,5112,11666,11672,11670,5118,11673,11665,5113,11669,
+11668,11674,5119,5114,5117,11667,5121,5115,5122,5109,11671,14501,
+12110,16951,5355,12107,12109,5353,12105,12106,12101,18146,11168,12102,
+5354,12098,5351,12111,5352,12104,5357,12103,5519,12461,12467,5520,
+12458,5517,5514,12469,5518,15478,5515,12460,12108,12459,5516,12466,
+12783,12462,18062,12774,5661,12777,5662,12786,12776,12773,12775,12779,
+12782,12781,12785,12772,5660,12780,12784,12787,12778,13018,16980,5754,
+18064,5832,13196,13347,13346,14418,13450,5922,13448,13451,13449,13520,
+5956,5970,13596,13574,15605,13595,742,17649,18066,1010,6154,6339,
+14535,1254,1257,16537,6340,16981,18067,18777,6647,6649,6644,6641,
+6643,17401,1603,16587,1601,18099,6645,1602,6642,6639,1600,6646,
+6640,1604,6648,7014,18242,7018,14706,1936,15543,15699,16982,1928,
+1931,1933,1935,1932,7017,7016,7013,1934,15721,1929,18450,17753,
+17008,7015,2333,7454,16984,7462,7467,2338,14701,7452,7458,7451,
+7461,7457,2334,2336,7466,7450,7453,7459,16987,7460,7468,7456,
+2838,8050,15048,8052,8048,18272,8060,8046,8059,2834,8044,8690,
+8054,2837,15630,8055,8058,8051,14883,8056,8061,8049,8045,8063,
+8700,3279,15687,8688,8697,8687,3276,8695,8693,8694,3274,8698,
+15273,16993,17002,8691,8689,3275,8692,8696,15700,15486,14189,3277,
+8699,15045,17304,9339,9346,9348,9354,16994,3698,9334,3690,16996,
+9349,3695,9355,3686,16999,9352,18533,9336,9353,9335,9347,3687,
+9356,3692,9340,3697,9351,9338,9345,9341,9337,3689,3696,3694,
+3691,3699,3688,9344,15557,3693,9350,15808,9342,18407,15597,16384,
+14679,9343,18724,10014,14389,4131,14704,10010,10016,10012,4133,10011,
+10015,10007,18182,10009,4132,15675,10013,10008,16991,10017,18461,4130,
+10586,10583,10595,10589,10591,4510,10585,10593,18625,16072,10592,10590,
+10596,4513,10587,10594,4511,15901,10582,10584,4512,10581,10597,16990,
+10588,18059,11187,4851,17006,11198,11196,4845,11186,11184,11199,11194,
+4849,4846,11193,11191,4852,11195,4847,14141,4848,11192,4850,11188,
+11197,4853,4854,16504,5124,5131,11675,11681,11679,5127,5126,5123,
+11677,15489,5129,5128,5125,11680,11676,11678,5130,18158,16026,5361,
+12114,12116,5360,12113,12112,12473,12115,12474,5521,12472,15803,12471,
+12470,5522,17009,14844,5663,17011,14675,14697,13025,13024,5755,13348,
+13452,17014,13521,13621,5990,13641,743,17650,5132,744,1607,2339,
+3701,745,2839,4135,6029,17018,7022,7469,5133,746,1608,8701,
+3280,9357,15049,3702,10019,17021,4514,17022,5523,747,8702,748,
+18010,1012,6155,1011,1260,1259,1258,6341,16059,1609,1610,6650,
+7028,1939,7026,1938,7027,1940,7472,7471,7470,2340,2840,8064,
+8067,3282,2841,17027,3281,8706,8705,15050,8707,9359,9358,9362,
+17353,9361,9360,4136,10022,15051,10021,4137,10020,10598,10599,4515,
+12479,5524,12478,12477,5756,12790,13199,13522,749,17652,6063,853,
+6064,6342,1611,6346,1262,6344,1261,6348,6345,6654,7029,6652,
+6659,17354,1612,1615,6660,6656,6651,1614,6653,1613,6658,16279,
+7036,7030,7031,1941,7034,7032,7478,7475,7477,2345,2344,2342,
+7474,7479,2341,2343,7476,8075,7473,7480,16282,8070,8074,8073,
+8709,8720,8076,18154,8071,8708,2845,2844,8069,8072,2846,2843,
+2842,8068,8077,8711,8718,3284,8717,8714,17034,3286,15728,17029,
+16306,8716,17035,8710,8712,8715,8713,3285,8719,3283,3703,18155,
+17356,9366,9365,9363,3706,3705,9367,18156,9364,10023,4138,3704,
+17402,9369,9368,10026,10024,4516,16209,4139,10025,10601,4517,10600,
+10609,10608,10606,10607,10610,4857,11204,11210,11209,11207,5134,16280,
+5135,11682,16084,5363,12117,5362,5525,5526,5664,12792,12791,13026,
+13200,5834,13350,13349,13351,854,7037,2346,2847,8078,855,6065,
+750,6158,18149,6349,1263,6350,14838,16522,6668,14683,1618,6666,
+6662,6665,6661,1620,6664,16519,1617,1616,17037,1619,6667,6663,
+1947,1950,7045,7044,7043,1944,7052,7042,1946,7485,7049,7047,
+1949,7039,7050,7041,7051,7048,7040,17040,1945,7053,7038,1948,
+16667,17036,15127,7490,7481,7492,16499,7484,7482,7494,7491,7489,
+7493,2352,2350,18160,15523,7487,17061,7483,15546,7486,7497,7488,
+2351,7046,2347,2349,16401,15531,8092,8081,8079,17050,8080,15353,
+8087,15532,8088,8084,2852,8089,8086,8083,2850,8082,2848,2851,
+8085,8093,2348,2849,8091,8090,2853,17772,15334,14836,17051,8725,
+16557,18163,8726,3296,14557,8732,8734,8727,3290,8731,8730,3291,
+3297,3298,8733,3288,8724,8722,8728,8721,3295,8723,8729,8735,
+3289,3294,15073,15113,17054,3287,3713,9376,3712,9380,14874,9370,
+15319,9381,17060,15541,17041,9382,9379,9374,9373,16945,9383,3709,
+14837,9375,3714,3708,17094,3711,3710,17058,10027,4141,4140,16641,
+10032,15086,4518,4142,15335,17064,4144,10033,3707,4143,10029,10031,
+10028,17065,10030,17062,10620,15057,10619,10616,4521,11211,4522,10615,
+17068,4520,10617,10614,10611,10618,4519,14881,18077,11214,11216,11685,
+4860,14835,11212,15114,4858,4862,4861,11213,11217,4859,16752,11692,
+5138,5364,5139,5136,11689,11687,11693,5137,11691,11686,15525,12120,
+12123,12482,12118,12793,12124,5527,12122,5365,12119,12121,12125,12483,
+5528,12480,15070,5665,15003,18170,5758,13202,5757,13204,13201,13203,
+5886,13453,856,6669,2854,9384,4863,5529,5835,13454,857,16382,
+6670,288,16358,16283,16351,9387,9386,9385,10034,4145,16350,10622,
+10621,17079,11697,12127,12126,5366,12484,13027,858,17795,1951,2857,
+9388,17080,859,7502,2858,6159,1265,1264,1952,7056,8737,16007,
+17754,6355,6354,15867,1621,6673,17087,1956,1954,17086,1955,1953,
+16363,2353,15082,2357,2356,7503,2355,2354,7504,15729,2861,8095,
+8094,3302,3301,8739,18173,17089,8738,2862,3717,9390,3718,9389,
+16207,10037,10623,4523,11219,15077,11698,5531,5530,5836,866,6674,
+18175,17093,2863,10038,4146,558,1622,17095,7060,1957,7505,16045,
+17096,2866,7511,2367,2365,7512,7507,2364,2363,2358,7510,7509,
+7506,2366,16275,7508,2359,2360,18177,2868,8096,8098,8102,8101,
+8097,8747,3307,3306,8741,3304,17358,8744,3308,8745,3309,8742,
+3303,3305,8746,8743,8740,9392,3720,3723,3722,3727,3726,9404,
+9402,9395,9399,9398,3724,9401,9397,9405,9396,3725,3719,3721,
+17097,9394,16271,10040,4150,10044,4149,10041,4148,9393,9400,10043,
+4151,10045,10042,10039,10626,10630,10632,10628,10627,10625,4526,4524,
+10629,4527,10624,4528,4147,10631,4525,17098,11221,11220,11228,11222,
+11227,11224,4866,11226,4868,15984,11225,11223,5141,11699,5140,11702,
+5142,18178,15986,17100,12131,17099,5369,12132,16112,5367,12133,5368,
+12130,12134,5532,12485,5533,5666,12129,5667,16042,16297,5759,13028,
+5838,13205,5837,17101,13352,15083,18179,13635,559,1962,7061,18181,
+867,1013,6160,17363,6358,1268,8104,7513,2368,17364,2869,8103,
+17104,8749,3313,8748,3312,9406,4531,10636,11703,17110,12135,12795,
+12794,13206,868,6676,2369,3314,9407,17111,10046,4532,11229,12136,
+12796,869,1626,1968,7062,1969,1967,1966,7514,2370,2871,8105,
+2870,8750,2872,3315,9408,4153,4533,4870,11230,4869,11704,5143,
+12137,12797,870,1269,6679,6678,1627,6677,1628,6680,7068,1972,
+1971,7070,7069,1976,1977,7063,1973,7067,1974,15714,7517,7521,
+7519,7518,7515,17118,7525,7520,16360,8114,17119,7526,2376,2373,
+8112,8111,8116,2876,2873,2877,8106,2878,8115,2875,8113,2874,
+18186,8753,8755,8754,8757,3316,9417,9409,9413,17123,9418,9414,
+3730,3738,4157,3741,3734,3739,3732,9416,3740,9415,3736,3731,
+3737,9419,10051,10053,18089,15104,3735,17175,15108,10048,4155,10054,
+4156,10052,10047,10050,10055,4154,10049,4535,10640,10639,4538,4536,
+10637,4534,10638,11240,18190,11239,11231,11235,11234,11232,4871,11233,
+5148,11712,5145,11706,5147,5149,17125,5146,11711,11707,5144,11710,
+11705,11709,11708,15987,12139,5370,18193,5371,12138,15281,12488,16833,
+18194,12798,12801,5760,13353,13455,5971,871,1978,872,1270,1629,
+16513,8761,3317,3742,5150,11713,12489,12802,873,17129,6686,6681,
+6683,6685,6684,6682,1630,16341,1979,7081,7076,7073,15942,7080,
+7079,7078,7077,7082,1980,18196,2381,15123,2387,2386,7535,7529,
+7527,2384,8123,2379,7532,7536,7538,7534,7528,2385,7533,7531,
+2378,7539,2388,7537,2382,7530,2383,2380,17366,16410,15466,15044,
+2880,15403,8124,18197,8117,8119,8121,15469,8122,8120,2881,8125,
+18198,8118,16277,15467,8765,3318,8773,8772,8771,8768,2879,3319,
+8766,8769,3320,8770,8767,9431,16105,9435,3749,10061,3752,9433,
+14056,9430,9425,9421,15125,3748,3747,15124,3743,9424,3751,9423,
+9426,9434,9432,9422,10063,4159,10065,9429,10067,4163,10068,10064,
+4160,10060,4162,10057,10062,10066,10059,17132,3744,17140,10056,4161,
+10058,17777,15459,4541,10642,4545,17133,10648,10651,4542,4539,10644,
+10641,10646,10643,4546,10645,15126,17134,10647,4544,17138,16268,4876,
+11247,11241,11245,4878,4875,11242,11244,4877,11250,14977,5154,15162,
+16574,11720,11714,5153,14515,11722,5152,11715,11723,11719,5155,11716,
+11724,11721,16335,12144,12146,12145,12491,12493,12490,12495,12804,12807,
+12803,5668,12808,5669,5671,5670,13030,17136,13032,13031,18203,18202,
+17139,13207,14211,13456,13525,874,17655,17152,6359,1631,6688,7087,
+7086,1983,1986,1985,1984,7083,7085,7084,7542,2390,7546,7545,
+7544,7540,2389,2393,2396,14309,15128,2397,7541,7543,2395,2394,
+2392,2391,8132,15997,8130,8126,2882,8127,2883,8778,16744,8777,
+8776,8775,9439,3753,9436,9438,15910,3754,17148,3755,9437,15862,
+17145,17800,10077,10079,18205,10078,10075,10074,10073,10072,10076,10069,
+17404,10652,10657,10655,17150,14686,10654,10653,10656,11253,15134,4879,
+5156,11726,17153,5157,11725,12148,12147,5375,12496,5536,12809,5839,
+13208,13458,13457,6066,3757,875,1273,1272,1271,15565,6689,17157,
+1635,1634,1991,16947,7089,7092,7090,17159,7088,7091,7553,7555,
+7554,2401,7549,15450,2399,2398,2402,2400,2403,7552,7551,7550,
+8134,2885,8779,8781,8783,3324,18206,8780,3323,8782,3321,9449,
+9440,9443,9447,3761,9445,3759,9448,3758,3763,3762,3760,16346,
+4167,10083,10082,4168,10659,15137,4552,4548,4550,16267,4547,4549,
+14700,11254,15857,4882,11256,11255,14131,10081,4884,4883,11729,5158,
+11730,11732,11728,11727,12149,5378,876,6161,1274,6690,1637,1636,
+6691,14135,7094,1992,7093,1993,15741,2405,7558,7556,7562,2406,
+7557,7561,8138,8140,17368,2886,8139,2887,3328,3327,3326,8784,
+9451,9450,10086,4170,4169,4554,4553,14138,11260,10660,10662,10661,
+11259,11257,11261,11258,4885,14137,18209,11733,5159,5672,15743,17776,
+5887,877,7563,2407,14144,18213,14673,14145,3038,3037,15155,3330,
+8786,3329,8785,14429,14385,14146,9453,4171,10089,4172,5673,12813,
+1014,1638,6692,1995,15165,1994,7565,7567,2408,7569,7572,7570,
+14150,15203,7571,7568,7564,2409,7573,7566,16247,8149,2893,8158,
+2890,8151,2894,16145,2888,8146,8159,8147,8144,2892,15199,2889,
+14152,8150,8153,2891,8154,2895,8155,8145,8152,8156,8148,8143,
+8141,8157,15726,15853,15909,8789,8795,3333,8788,8790,3331,8787,
+3338,8791,3337,8792,3339,3334,3340,3335,3336,14151,3332,3768,
+9464,18215,9467,9455,9460,9454,3770,18216,9456,3769,14156,9463,
+9462,9459,9461,9457,4176,9466,3766,9465,4183,10100,4182,10090,
+10092,4175,10097,10096,10099,4180,10094,10093,14162,4179,4174,10095,
+4177,10101,10103,10098,10091,4178,4562,4173,14155,16148,10104,10666,
+4555,4556,17948,4558,10671,10663,4181,10669,3767,4561,4888,10670,
+10664,4563,10667,16152,14160,11271,11266,11276,4886,11268,4890,11274,
+11265,11262,11277,5165,4891,11273,11263,4889,11267,4893,11264,11269,
+4892,11272,11275,11738,11745,11743,5163,11750,11270,14167,11741,16159,
+11751,5162,11740,11739,11749,11746,11748,11736,11752,5160,11747,11756,
+11744,5164,5161,11742,11737,11755,4887,18218,17369,12150,12156,5384,
+12154,12153,5386,12159,5385,12160,12157,5382,12158,12151,5383,5381,
+12502,12155,5543,5541,12501,12503,12500,5542,16156,5675,14171,12818,
+12817,12815,12814,12816,5674,5676,5761,16312,13034,13033,16127,13211,
+13213,13215,13214,13212,15167,5841,5840,5889,5888,5890,13355,13354,
+13526,13459,13527,5957,15168,5958,13575,16210,5995,1015,18076,6693,
+7098,18221,15177,1996,16154,14172,7574,7580,16157,7578,2410,7576,
+7577,7579,15176,7575,2896,8160,2898,8162,2897,8161,8797,3341,
+8799,8796,8163,3342,14174,14061,8798,15178,9470,3771,9468,3772,
+9469,3773,18224,4184,10109,10106,10108,14177,10673,14176,4564,10675,
+10674,15173,289,11278,15708,11279,5171,16345,5167,5172,5168,5170,
+5166,14178,5387,11757,12504,17370,12819,13217,13035,14180,13216,14181,
+13528,13597,1016,17656,1275,17773,6694,1639,1999,7106,1997,7104,
+2002,1998,2003,2001,7105,2000,2414,2413,7591,2422,7584,7590,
+2418,7583,7589,7587,2417,2419,7586,2412,7585,2423,2420,2424,
+2421,7582,7581,7588,2415,2411,2416,8178,8171,3347,8170,2902,
+2909,2906,2912,2911,2907,8164,8167,8166,2903,8168,8177,2904,
+8165,2905,8172,2910,2900,2908,8169,2899,8173,16349,8816,8807,
+3344,8814,8811,8803,8812,3346,8804,16019,3779,8809,14185,3343,
+8815,3350,3352,8802,3351,8805,3345,8813,8806,8810,8808,3348,
+8801,3353,2901,3349,3354,3775,9477,9479,9481,9485,9475,9473,
+3777,9480,9484,9476,9472,9471,14187,9482,9474,9478,3778,3776,
+9486,3774,9483,10126,15187,4189,10118,4577,10128,4192,10132,4198,
+10113,18135,10129,10110,15516,10131,10114,14188,4205,4202,10130,10124,
+4188,4196,4195,14190,4194,4200,10111,4201,10125,4197,4187,10127,
+4199,10116,10115,10112,10120,10117,10121,4204,10133,4193,17774,10119,
+18229,18231,4203,15182,18230,14191,10680,4569,4578,4574,10677,15180,
+4571,4575,10689,4565,10681,4573,14194,14198,10684,10679,4572,4576,
+10678,10688,4567,10687,10686,4579,10440,4566,14196,10685,10676,4580,
+10683,4568,18232,15567,15181,4898,4903,4896,11295,11286,11298,11290,
+11296,4904,4897,11283,11289,11299,11292,11297,11285,11293,4899,11291,
+4902,4901,11284,11294,4900,11301,11300,11768,11764,5179,11758,5173,
+5189,11770,5181,5177,11761,5184,5187,11772,5176,11763,5185,11774,
+11771,11759,5180,5174,5188,11766,5183,11760,5178,11773,5182,5175,
+11767,5186,11765,12163,12169,5393,12172,12164,12171,12166,5394,5391,
+5390,12168,12170,5392,12167,12165,14182,12515,5546,14203,12511,12509,
+12513,5550,12514,12507,12506,12510,12508,5547,12512,12820,5681,5680,
+12821,15953,12823,12822,5682,13036,13039,5763,13041,16073,5762,13218,
+18078,5891,5893,13356,5892,13460,13530,13532,13529,13531,5977,1017,
+17762,2004,7455,2425,11302,5190,11775,14210,5395,15977,12517,12516,
+5683,13042,15183,13219,5926,6162,17654,17657,1640,1276,7597,7592,
+7596,7594,2426,7595,7593,9488,9491,9487,3780,4206,16391,3783,
+10134,4581,10690,4582,16251,4905,11305,11778,11777,11776,5551,12519,
+13220,5927,13461,1018,1642,1641,7109,2005,16924,7108,7599,17371,
+2427,8180,7598,14214,2915,8183,8821,14216,3786,9493,9492,9494,
+3785,3784,10691,10693,17372,4583,10692,11306,4906,12174,18233,12173,
+5552,12520,5554,5553,12824,13043,5764,1019,7110,2006,7602,2429,
+7601,7600,2916,8186,2917,8190,15198,10138,4209,10137,10698,18153,
+10699,4584,10696,10695,10697,10694,4909,11307,11780,5191,11779,12031,
+5396,14222,5397,5192,12825,5684,1020,17661,1021,2431,1643,2430,
+7111,14225,3358,1022,2008,2007,2009,1023,7114,2433,7603,2435,
+2432,2434,8194,2919,14226,8193,8192,18236,9497,10139,18237,4585,
+4910,11309,11308,18238,14228,13044,18239,1024,6360,6695,2010,7115,
+2436,7604,2437,2921,8195,8197,8825,3359,4211,16357,10141,10140,
+4210,14233,16355,16348,10700,16347,10701,5196,5195,12177,5399,5398,
+12523,12826,5843,5842,1025,17662,3790,3360,3789,4212,1026,6067,
+6696,6363,6364,1278,6361,1277,1280,6362,1282,1281,6365,1279,
+1648,1646,6698,1650,1652,1649,6701,6697,1653,1647,1283,1651,
+6700,16046,18243,6699,17778,15995,7123,15220,7117,7120,7129,7127,
+2016,7133,2019,7130,7122,7119,8829,7128,2011,7131,7116,7125,
+2013,2018,7126,2022,2020,7118,2017,7124,2021,2012,7132,17897,
+2442,2451,2440,2438,7607,2446,2443,7609,17780,2445,7608,7606,
+7611,2450,2448,8828,7612,7610,2439,16359,2441,2444,14242,2447,
+15221,2449,18249,8207,2923,15981,8198,8200,14243,8201,8209,8205,
+8203,8206,8210,2924,2928,8199,2926,14905,2925,8204,8202,2922,
+2927,3366,8837,8835,3368,15222,8830,9511,3367,8834,15990,8831,
+3363,3369,8836,3365,8833,4213,3364,8832,3370,3362,3361,18252,
+9503,9501,9499,9512,9504,9498,3794,3800,9509,17348,3795,9510,
+3792,3791,9505,3796,3371,9508,9500,3793,4218,4214,4219,10144,
+17349,10143,10145,4216,10142,4217,10148,10147,10146,10708,4591,10707,
+4590,10704,10703,4589,10706,10702,18259,11312,11322,4913,4912,17252,
+11316,11318,11317,11311,11320,4911,11319,11315,16050,11321,11314,5200,
+11782,11788,5204,5206,5203,5202,18261,5201,5199,11783,11786,5198,
+11787,16366,5205,11785,11784,5400,5401,12180,12524,5555,12828,5685,
+12827,13045,13221,5844,5894,1029,18262,1654,8838,4220,5207,11789,
+1030,2453,2452,8839,17105,11323,1031,2023,4221,4914,1032,1655,
+7134,2454,7613,2929,8843,3801,4222,4915,5208,5402,12526,1033,
+1656,2455,8211,3372,4223,10149,10709,16353,1034,3373,9513,4224,
+1035,6702,7135,2024,7615,16909,2458,14256,2459,16080,8216,8213,
+8215,2930,2932,2931,8212,2933,8214,17794,8846,9516,9515,9518,
+10714,10710,10713,10715,10712,10711,18263,11791,11790,11792,12182,12181,
+12528,15226,12529,12527,15227,5686,13222,13357,13462,1036,1284,5209,
+1037,8217,8847,18265,5934,6163,18210,17763,14280,6164,6166,1038,
+6167,6165,6372,1286,1287,6369,6367,6366,6370,1285,6371,7136,
+6707,1659,6706,6708,1658,6713,1662,6703,6717,6723,1669,6720,
+1666,15731,6710,6716,6718,14268,6705,1665,1660,6711,1667,1670,
+1664,1657,6715,6709,6722,1672,1668,1663,6714,2460,6712,1661,
+1671,6719,6721,17891,17764,14273,2041,2035,2043,2040,7143,7146,
+2036,18267,7137,2029,2039,2042,2044,7158,7149,14281,2028,7157,
+2032,2030,2025,7141,7156,7145,7148,7161,16408,2045,7155,2037,
+7150,7160,7147,7151,7154,15991,7139,7159,7153,16685,15762,7138,
+17374,7142,2038,2033,2026,2031,2027,2046,7140,7632,2034,16054,
+7152,6781,7635,2474,14282,7619,14274,7630,7626,14289,7645,7636,
+7621,7625,7648,2477,7640,7631,2461,7646,7617,2476,2471,7616,
+2469,2468,2473,7638,2465,2472,7144,8848,7633,15658,7623,2475,
+7624,7628,2478,7618,7642,7641,7649,2467,2464,7647,7643,7634,
+7629,2470,2466,7620,2462,7644,2463,7622,18269,14262,16875,8223,
+8225,8230,8250,2947,2937,8233,8240,8246,14291,2950,8248,8243,
+2945,2943,8239,8235,8221,2934,8226,8218,14316,2942,2944,8231,
+8228,2939,8244,2936,8229,8889,8237,14157,8236,2935,2938,8219,
+8224,8241,8247,2951,8220,8232,8238,2941,14294,8249,8242,8245,
+2940,16217,8864,8852,3381,8881,8890,8893,3379,8860,8885,8861,
+8875,3392,8871,3389,16469,8872,8849,14296,3398,8883,8873,8895,
+8868,9550,8898,3396,8866,8878,3399,3378,8870,8896,8863,8856,
+8867,8855,8853,3374,8887,8862,8891,15660,8892,3382,3387,3383,
+3391,8882,3384,8874,8858,3376,8850,8884,8894,8857,3390,8899,
+8869,3375,3395,18271,8880,3397,8876,3386,3380,3388,3377,3394,
+8877,8859,8879,8854,8888,15376,8897,16051,15445,14161,8851,18769,
+9571,3756,9554,16941,9552,9531,3806,9547,9567,9543,3814,9566,
+9541,3393,9557,9542,9564,3813,3805,15649,9520,9528,9553,9545,
+9570,9548,3819,9565,18200,3810,14308,9551,9559,9532,9558,9575,
+9527,9560,15229,9573,14731,9521,3385,14302,9535,9534,3812,16091,
+9538,9540,9555,9572,3815,17114,3816,18273,9526,3808,9530,9568,
+3817,3809,3811,3818,9574,9561,9556,14304,15507,9537,9536,3807,
+9522,3804,9546,9523,9544,9533,9569,14670,15214,9525,9563,9524,
+4238,10189,14166,14318,10172,15133,10150,10180,4230,10165,10175,4233,
+10168,4231,10153,10183,10152,10171,15262,10151,10169,10178,10176,10164,
+10159,10157,15756,10158,10177,10188,10166,4232,4235,10160,10154,10170,
+4239,15436,18276,4227,4236,10162,10156,4229,9562,4228,10173,4226,
+4241,4234,10174,10163,10155,10182,10167,4240,10186,4237,10185,10179,
+10184,16373,10187,18277,14261,14319,15312,10743,10742,10738,4603,4595,
+10758,10757,9519,10735,10739,10733,10752,10737,18278,10759,10730,10728,
+10740,10750,10745,4605,10719,10749,14730,16619,4606,9539,10731,10722,
+10725,10763,10732,10723,10721,10718,18279,4599,10741,4598,4602,10736,
+10744,4592,10760,10764,4594,10727,10747,10751,10724,10761,4601,4600,
+10716,4604,10754,10726,10746,10720,10734,10729,10748,10765,10762,10753,
+16936,14324,4593,11343,11334,11337,16482,4923,11339,11328,11335,11341,
+4920,4924,4918,14272,16399,11330,11346,11340,18281,11331,11355,11349,
+11327,11811,11333,4919,14299,11344,11354,4927,11351,11332,11338,11342,
+11336,11356,11353,11350,4926,11329,11357,4925,11347,11348,11824,11805,
+11810,11823,11809,11801,11806,11794,11818,11820,11793,5211,11822,11814,
+5218,11821,11807,5220,11799,11352,11815,11812,11795,11826,5214,5215,
+11797,11813,11825,11816,11803,5217,5213,11817,11804,11827,11798,11808,
+11819,11800,11802,5221,11796,5219,5404,5210,5216,5408,12198,12188,
+12183,12189,12199,12203,12202,5410,5409,12190,12204,12193,12185,14334,
+12187,12186,12192,12197,12184,12191,12196,5407,5405,12195,5403,5406,
+12545,12200,12537,12541,12533,12536,12544,5557,12549,12542,18285,12534,
+12550,12543,12535,5556,5558,12530,12538,12532,15446,12548,12546,12531,
+12539,12837,5562,12540,5688,5690,5687,15440,12842,12834,12832,12836,
+12833,14336,12838,12840,5691,5693,12839,5694,5692,12841,16484,15231,
+5689,14331,5765,13046,13052,5767,12835,13051,13058,13049,13056,13055,
+12831,13050,12201,13059,13048,13053,14341,13057,13047,13226,5766,13054,
+16286,13362,13227,13225,5895,13360,13358,13363,13361,13364,5896,13359,
+14529,13463,13630,13622,6168,1673,7651,7650,2479,2952,8252,3400,
+3821,3820,3822,10190,10766,11358,11360,11359,5222,11828,12205,13598,
+1039,14355,6725,6724,1674,18287,7165,7163,2048,2050,2049,7164,
+7663,7660,7658,2480,7661,2485,7655,7670,7672,7656,18288,2482,
+7673,7668,7654,7659,7669,7665,7662,2487,7671,7657,15240,7666,
+7652,2486,2483,7664,7667,7653,2484,2481,2962,8259,2961,17376,
+8262,8265,2958,2956,8254,8263,8261,8258,8253,2955,8256,8255,
+8268,2957,8257,2959,2954,8260,2963,2960,8264,3407,8914,8903,
+3404,9581,8912,8900,3402,8905,3405,8909,8907,3408,3401,8901,
+8904,3406,8913,8911,8906,8908,8910,3403,9582,9588,9578,9584,
+3823,9580,3829,3827,9587,9577,9590,3832,3826,3825,9586,3833,
+9576,9579,9589,9585,10222,10211,3824,4248,10199,10220,10200,4243,
+10206,10198,4245,10192,10219,4246,10193,4251,10208,10202,10209,10196,
+10221,10213,10207,10191,4247,10214,4250,10218,10212,4244,10210,10204,
+4242,10195,10203,10215,10201,4616,9583,10784,10793,10783,10779,10776,
+4617,10774,4249,10767,4615,10773,4614,10778,10775,10791,10786,10780,
+10785,4610,10777,10796,10792,4611,10797,4613,10798,10782,10194,10788,
+10781,10790,10787,15980,14347,10772,4608,10795,4609,10770,4612,11371,
+10789,10794,11368,4607,4928,11378,11374,16048,11372,11367,11382,17378,
+16367,4932,11366,11365,11379,11369,11364,11370,11381,11362,11380,11377,
+4930,4929,4931,11373,11361,15752,16364,11830,5228,11834,11831,11838,
+11844,11833,14351,11853,5225,11847,11836,11848,11843,11850,11835,5230,
+5229,11837,11851,11829,11849,5223,16380,11841,11840,11845,11832,5227,
+5231,11839,11846,5232,11842,5224,5226,12218,12216,16274,12222,12220,
+12223,14352,12209,12217,12227,11852,12213,5414,10771,12208,12221,12215,
+12212,12207,12206,12226,12211,12210,5412,12219,14349,5411,5413,12214,
+12225,16302,5566,12552,5563,12560,5567,12562,12551,12224,12564,12553,
+16047,5564,12559,12561,12556,12563,12558,12557,5565,12848,12846,16250,
+12843,13062,13065,13061,5771,13063,5770,5769,5768,13064,13233,13231,
+15879,13230,13060,13232,13066,13229,15243,13367,13333,13365,5897,13366,
+13368,13466,5928,13465,13464,5929,5959,13576,13600,13599,13601,1040,
+7166,16218,13067,13467,1041,2051,7167,14404,8271,2964,8917,8916,
+3409,3834,10799,4618,4619,14363,14918,4933,5930,1042,17666,15868,
+7168,1676,7170,7169,2052,7676,15246,7683,2488,7681,7679,7687,
+2492,7685,7682,7680,7684,17143,15248,2966,8272,2971,8288,2970,
+8290,8278,2968,8289,8273,2969,8285,8281,8283,8277,8284,14364,
+2965,8280,16288,8279,8275,8282,8274,8276,2967,8287,3412,8928,
+8924,8926,8921,8920,8918,8925,8927,8923,15249,8922,8930,3842,
+9592,9598,14058,9599,3836,3843,9591,8919,3839,3837,9597,9596,
+3838,3840,9595,3835,15250,10224,4258,10235,10234,10229,4260,10233,
+4252,4254,15880,10231,10223,4256,4255,10227,10232,10230,4257,10228,
+18294,17146,8929,4253,10800,10807,4621,10811,4625,10803,10801,4620,
+10809,10802,4624,10808,11383,11395,4938,11390,11392,18295,4936,11384,
+11388,11391,4934,4937,11394,11393,11385,11389,4935,11855,11854,5234,
+11860,5236,5233,11856,5237,11857,11858,11861,15894,5235,12232,17379,
+12229,12231,15252,11859,12228,15254,5570,12568,12571,12573,12570,12572,
+5571,5569,5568,12569,12565,12849,5697,15251,12850,13069,5772,13071,
+5773,13068,13070,5846,13234,5845,13371,13370,13369,15850,13541,13540,
+6169,1043,18184,2053,8291,3413,9600,5415,14370,12574,16361,14371,
+1288,2972,16352,8931,3414,8933,8932,9601,3845,10236,10239,10238,
+10237,10812,10814,10813,15763,4940,14374,14373,4939,5238,11862,11864,
+11863,12576,12575,12851,5698,14375,5774,13236,13235,5960,17667,1289,
+7171,2054,8294,8292,9608,8934,9602,9606,9605,9607,3846,9604,
+9603,9609,14377,10242,10240,10241,10817,10815,10816,11396,12577,12852,
+5699,13072,13237,5847,13372,13542,1290,7173,2055,2496,2503,2495,
+2504,7688,2501,2498,2502,2500,2494,2981,15267,2975,8298,2980,
+2982,2976,17381,2974,15313,8297,2979,8295,2978,18298,8939,3426,
+3415,3419,15266,3865,9614,8941,3420,8947,16368,8949,8950,8938,
+8937,8951,3423,8948,8946,3421,3417,3428,3416,9613,3860,3855,
+3850,16270,3866,3851,3847,3862,3859,3861,3852,3857,9621,9618,
+9610,9615,3863,9622,3864,3854,16293,9612,9620,9616,9619,9617,
+3858,9611,3853,10245,4262,4265,10247,14383,4273,10246,4267,18299,
+4630,10248,4272,10244,4274,3856,4266,4264,4268,4270,4261,4275,
+4271,14397,4269,10243,14401,4637,10820,4641,10832,10825,4626,10833,
+10827,4636,10828,4635,10831,4629,10829,10819,4628,11407,4634,10822,
+4627,10821,4638,10826,10830,10834,14786,4642,4946,11402,11408,11405,
+11397,11409,11398,4941,4947,11410,15833,4943,4953,4948,11412,11406,
+4944,11399,4954,4955,4952,4632,4942,11413,4956,4949,11411,4945,
+5246,11871,11880,11877,11879,5243,11872,14390,11878,5239,11874,5247,
+11870,11875,11882,11403,11876,11869,5240,11868,5241,11883,5242,11881,
+5245,11867,14391,5244,11873,12238,12252,12247,12249,12237,5418,12236,
+5421,5420,16281,12251,12243,12240,12246,12241,12250,12248,5419,12255,
+12253,12244,12254,12245,14394,12581,5572,12588,16370,13075,5579,12242,
+12579,5575,12580,12585,12578,12587,12589,12582,12584,12586,12583,12590,
+5574,5580,5576,5573,12855,15800,5704,12853,15828,12857,12858,5702,
+12859,12856,15351,12854,5705,5701,12860,5703,5700,5776,13074,13073,
+5777,13238,13243,5848,15757,13240,13239,13242,13241,5898,13375,13373,
+5932,5931,5972,14400,5978,13602,13631,17669,8300,9623,10249,10835,
+5249,5248,12256,12591,13377,1292,7689,2505,2983,9625,9624,4643,
+10836,4644,11884,5422,18301,5987,1293,6728,7690,3429,3867,9627,
+9626,9628,4276,4957,4645,4958,11888,11885,11887,11886,5250,12257,
+12593,12592,6375,2507,2506,7691,8954,8953,3430,3869,3868,4278,
+4277,10837,11416,4959,11890,11889,12260,12259,12258,12594,14405,13603,
+1294,2058,15277,2059,7693,7692,8304,2990,2988,2985,2989,2987,
+2986,16369,3431,8957,3874,3433,3438,8959,3440,3439,3442,8958,
+8955,3436,3432,3434,8956,3441,3437,3435,3876,3875,3873,3877,
+9632,16025,4279,18302,10252,14411,10254,10840,10842,14417,4654,10843,
+4647,10839,4646,4656,4649,10838,4648,10844,10841,15278,4655,16284,
+11420,11419,18303,11421,4960,11417,16305,5254,11891,5251,5255,5253,
+5252,12261,12263,14415,12262,5423,5581,12597,5582,17779,16278,5707,
+5706,13078,14419,14414,5778,13079,13244,15983,13378,5935,18304,17670,
+2992,2991,4282,11422,4657,11423,11892,1296,7174,2061,2060,7694,
+2510,7695,8307,14817,8306,8961,3445,16233,8960,3444,8962,3443,
+9636,9639,9642,9635,9643,4284,10255,10848,10846,4658,10845,10847,
+11424,16375,11425,5256,14422,12599,12601,12598,12600,12861,13080,13577,
+1297,2062,7696,7698,7697,8310,2994,2993,8311,17258,8312,8309,
+18306,8974,3453,8966,8972,3448,3451,8965,3446,8969,9649,3450,
+8964,16258,8970,8967,8973,8963,8971,3449,3452,8968,3447,3879,
+9645,3878,9652,9651,3885,3886,9653,3880,9650,3884,9655,9646,
+9648,3881,9644,9647,9654,3882,9656,4285,10260,10266,10258,10267,
+16261,10257,10262,10268,10265,10264,10263,10256,10261,10259,15966,4664,
+4661,10857,10862,10864,10861,10854,10856,10866,10863,10858,10867,10855,
+10865,4662,4668,4666,10849,4667,4663,10850,10852,10851,16264,4665,
+15284,4660,16043,10853,11435,4962,11426,4963,4966,11431,11428,4965,
+18308,11427,11436,11429,11434,4964,4961,11430,17170,11898,5259,5257,
+5260,5258,11897,11894,11893,16259,11896,11895,12278,5429,12269,12268,
+5424,12274,12273,12265,12276,12270,5428,12267,12275,12266,5425,5427,
+12271,5426,12272,17229,12277,12605,5587,12602,17383,5584,12604,5589,
+16265,5586,16255,12603,5588,12607,5583,15959,5709,5711,12864,5710,
+12862,5585,12863,5708,5779,5781,13082,5780,13081,13249,5851,13248,
+5852,13246,13245,13547,13546,13545,13578,15285,13623,13604,5979,1298,
+2511,14430,14496,11437,12608,14432,13605,1299,1677,2064,2063,18312,
+2514,7699,2512,7700,2513,8317,8313,15806,2995,8316,8315,8314,
+2996,18314,8981,8979,8986,8988,18315,8980,8975,8987,18316,8989,
+8982,8985,8976,3455,8978,8977,3454,3456,3890,9658,9660,9659,
+9664,3888,9661,9657,3889,3891,9665,10272,10271,4287,4289,4286,
+4288,10870,14434,10871,4671,4676,4670,4677,4672,10872,10873,10869,
+4678,4674,4673,4675,10868,14435,11439,4968,15287,11441,4970,11444,
+11440,11438,11443,4969,11442,5262,5265,11900,15623,5263,11899,5261,
+5264,5431,15288,12282,5432,5591,12610,12609,12613,5590,12868,12869,
+12865,12870,13084,16177,13085,13083,5782,13252,5853,13253,13381,13380,
+1300,3457,3892,15764,14438,4972,5592,5679,5783,1301,2515,3893,
+14442,12614,560,18387,17405,17142,18633,18631,18630,6377,18317,1302,
+1305,1304,1303,6376,18318,6730,18319,6732,1678,18606,1680,6729,
+6731,1679,6734,6733,6735,7178,7176,2067,7175,2072,2069,2066,
+2068,2071,2070,7177,2521,7702,7708,2518,2525,14449,2520,7705,
+7707,2523,7701,7704,2519,2516,7703,2522,7706,2524,2517,8321,
+8324,2998,3008,3004,8322,15950,3012,3005,3010,3000,2997,2999,
+3011,8323,3003,3006,3002,3007,8325,3009,3001,8320,8991,3458,
+8993,3460,3462,18320,8992,3459,3463,14454,3461,3899,9670,3907,
+9667,3908,3897,9669,3895,3894,16144,3905,3904,3903,3901,3906,
+9666,3896,3898,3900,15826,4292,4295,4299,4293,4298,4296,4291,
+14457,4297,4294,15464,10879,4681,4679,10880,15712,4682,4680,10878,
+10877,4976,10876,4974,4973,11445,4683,4975,11446,4978,11447,4977,
+5267,11902,5266,5271,5434,5268,11901,11448,5433,5435,5900,5899,
+1307,6174,2526,6381,6378,6383,6379,1308,1311,6380,1310,6382,
+14460,14464,6738,6740,1683,6736,6739,6737,1681,1684,7180,7184,
+7181,2077,14462,7183,7185,7187,2074,7186,8332,7182,7709,7718,
+7716,7717,7719,2528,7714,7710,2527,2529,7713,7720,7715,3013,
+8335,8327,8326,8328,7179,8329,3465,9000,11449,9001,8998,3015,
+3467,8997,9003,9002,3464,9006,8996,9005,8994,9004,8999,3466,
+9672,9678,9673,9671,9674,3909,9675,3910,4301,4300,10279,10282,
+10274,10278,4302,10277,10275,10281,10276,10273,10280,10886,4686,12283,
+10882,8995,4685,10887,10881,4684,4687,10885,11450,4979,11903,5272,
+12286,12616,12615,12873,13086,13254,5854,1312,2079,2078,2532,2531,
+7721,16201,2530,8339,8340,8336,3016,8337,16197,8338,17387,9009,
+9011,9007,9010,3468,9008,3469,14466,9186,3913,3912,10284,10286,
+4306,4303,16027,4305,4304,10285,10283,4691,10893,4689,10890,4690,
+17388,11456,16206,11457,4980,11453,11907,11904,11906,5275,11910,5274,
+11908,11911,11909,11905,5273,12289,12287,14467,12291,12618,5596,12290,
+12617,5595,5712,12875,17903,12874,13089,5784,15304,13382,13475,13474,
+5936,5962,13476,13579,14468,5980,1313,1685,5713,1314,2080,3017,
+3470,5438,1686,7189,7188,7724,16734,2535,2533,2537,7726,2536,
+2534,7725,3020,8346,15366,3019,3021,8351,3023,8341,3022,8352,
+8344,8342,3018,8350,8345,8347,15096,9023,14382,9022,9020,9012,
+9027,9015,9025,9032,9024,3478,16057,3474,9013,9019,3476,14472,
+9018,3477,3479,9021,18323,9033,9031,9030,9016,3473,9029,9014,
+9017,9026,18325,15374,15270,10321,9690,9683,9702,9711,9686,3925,
+15142,9699,3915,3917,3929,9684,16850,3918,3920,3930,3919,14474,
+14490,3928,9692,9681,3926,9691,3922,9709,3927,9707,9695,9705,
+3924,9682,9708,9703,15943,9710,3916,18326,3931,3921,14851,9688,
+15584,9696,9700,14475,9704,3923,9687,9685,9697,18327,9694,9693,
+15621,9698,9701,10289,15460,4307,10299,10291,4313,4317,10308,10316,
+10301,4309,15873,10305,9689,15545,4310,10312,10317,10309,15029,10311,
+10320,10313,10295,10304,18109,4314,10293,10306,4312,10300,4311,10314,
+10297,10290,4315,10319,10292,10310,10307,10302,10288,10287,10296,10315,
+4316,10318,10294,10298,4308,18328,4703,4698,10928,10924,10900,4694,
+14057,15349,4693,4699,15456,18330,10898,4697,10910,4692,10927,4701,
+10913,10918,10912,11475,10908,10916,10914,10901,10895,10922,4700,10923,
+14433,10917,10906,10904,10899,10907,10920,10903,10919,10925,18331,4696,
+15522,10915,10921,10911,10905,4695,18332,14692,10303,10909,4702,10902,
+15026,15364,11480,4983,11479,11477,11495,4987,18335,11492,11484,11494,
+11470,11482,14439,4989,11462,15121,11460,11493,11491,11490,11474,11473,
+11463,4991,11469,11478,11489,4994,11496,5283,4996,4990,11467,11476,
+11459,11461,4981,4993,4986,11468,11483,10926,4992,11458,5278,11485,
+11488,4988,14482,11472,4995,4985,15875,15549,4984,11481,11487,4982,
+11465,11486,16725,17015,15098,18336,16406,15988,11471,11917,15457,11922,
+5280,5282,11928,5276,11942,11934,5289,11932,11916,11931,11919,11943,
+5288,5286,11920,11939,15547,11925,11938,17000,11940,11915,5281,18108,
+11941,15344,14689,11929,14483,5285,11926,14824,5287,11935,14494,15588,
+5279,11921,11936,14585,11930,11464,11937,11918,15397,5284,12308,14693,
+5277,11913,18337,17085,15552,15072,12305,12298,5440,12293,12309,12300,
+11927,15676,12311,12294,5439,12304,5441,5449,5447,12306,5448,12296,
+14764,12297,12302,12307,15025,11912,5442,12316,12313,12640,12303,12299,
+12314,12629,12301,5445,18338,5444,11914,5446,12310,12312,5443,12315,
+12292,12295,15504,17399,15503,15917,12638,12622,5600,12636,14762,12620,
+5601,12631,14694,12627,5606,12637,12621,12624,5598,12639,16609,12632,
+12635,5604,5609,5607,12628,12623,15455,12619,5599,14880,5597,5605,
+12634,5608,12630,12641,5610,16959,17066,12890,12905,12892,12899,12625,
+12897,12880,12903,5716,12884,12902,12891,15572,5715,15305,12907,12893,
+14885,12898,12901,12878,12904,12889,12894,12882,12886,12906,12896,12879,
+12883,12885,12895,18341,5714,12888,14659,14544,14499,15309,12887,13093,
+13097,5791,13099,18343,5785,13095,13101,5790,5786,5787,13092,13098,
+5789,13096,5788,13091,12900,13094,18344,13090,13100,17010,17013,5855,
+13261,13264,13260,13255,15461,13259,13256,18346,13384,13386,15408,13385,
+13387,13383,5901,5903,15838,5937,13477,14206,13549,13548,13550,5964,
+13551,5963,13552,13580,13583,13582,5973,13581,18347,16795,5983,13624,
+13632,1687,17672,8353,9034,10929,12642,17673,1688,2081,2538,14497,
+8354,8355,3024,3482,9036,9035,3486,3481,9037,3483,3485,3484,
+3480,15317,15316,3932,15314,9715,9713,9714,9712,14500,4319,18349,
+4322,4324,4323,14498,15315,17301,10931,10930,4704,10932,10933,4705,
+11504,11502,11949,4997,11497,11505,11499,11503,11945,11948,5294,11944,
+5293,11946,5452,12319,5450,5453,5451,12908,12910,12909,5717,5792,
+13104,13103,13102,1689,17689,6068,6177,1044,6175,6178,6176,1319,
+6387,1316,6386,6384,1317,1315,18352,16337,6741,6744,1692,6743,
+6742,1691,1690,16189,1694,6745,1693,18290,7195,7191,2082,7192,
+7193,7190,2542,7727,2543,2546,7728,18270,3025,8358,3033,8357,
+8360,3029,8359,3494,3027,3030,3026,14508,8356,3490,9039,9043,
+16198,9042,3495,3487,3489,3493,3488,15326,14509,9719,3933,4325,
+4327,4326,10323,10935,14511,10934,17135,11506,5000,11951,5295,12320,
+5612,5296,1695,2547,7729,14517,8361,3034,3496,9044,9046,3498,
+3497,3937,4328,3936,9720,4329,10936,11507,5001,5297,12321,12325,
+5456,12322,5457,5455,12326,5458,12324,12645,5454,5613,1696,3036,
+3035,3501,9048,9047,3502,14852,9724,3943,3940,9723,3942,9721,
+3941,10324,4330,10939,16141,4706,10937,10938,4709,5005,5002,5007,
+11510,5003,11509,5006,11955,11957,14537,5298,11956,5299,11954,11953,
+16307,12328,12327,5459,12329,12650,5615,12649,12646,5614,5718,14528,
+5795,13105,14530,13265,18355,15337,5938,13482,5940,13481,13483,5939,
+13553,17635,1697,3944,14540,10325,15343,1698,14543,4710,5616,2086,
+5904,2087,8362,9049,16023,9051,9050,15356,9728,9725,3945,10327,
+10332,4331,10326,10328,10335,10330,10334,10331,10329,10333,4332,16576,
+10943,14548,10941,4712,4711,10942,4713,11512,5011,11511,11958,15355,
+11960,11962,11961,14549,5300,11959,12336,5460,12334,12337,5461,12335,
+12333,12330,5462,12331,14550,18357,12651,16179,12653,12652,15765,12913,
+16181,12914,18766,14551,13107,14552,5861,18358,5860,5941,13484,16175,
+5974,2088,3503,10337,10336,10945,10944,14553,5301,11964,11963,12340,
+12338,12341,12339,14554,13108,13485,17676,2089,14556,11514,11965,14669,
+2090,14560,4333,11515,5463,12342,5618,5796,13390,2091,9052,3506,
+3951,3949,18770,17212,10338,10952,4716,10947,10946,15362,10951,4714,
+15927,5018,10948,10953,10950,10949,5016,16242,11517,5012,11518,14565,
+14564,11516,5015,5013,5017,11971,11967,11970,5302,15766,11762,11969,
+11968,14566,5466,5464,5467,5465,12660,5620,12658,5621,12657,12659,
+5619,12920,12917,13109,5798,14567,5797,13268,13267,5862,16437,5905,
+5942,5965,13554,2092,9053,4337,10954,4717,16243,5303,14575,12346,
+18360,5469,12663,5622,12662,12664,12661,13112,15224,5719,13111,14577,
+14576,13110,14574,13269,13609,2093,15371,17679,2094,18322,14582,2548,
+7730,8364,14583,3507,3510,3508,9054,14584,3512,18362,3511,3954,
+17253,9733,9734,10956,10341,4338,10343,10955,4341,4718,5019,10957,
+4720,4719,10958,10961,4721,18364,5024,5022,17390,5021,11520,11519,
+11972,11521,5020,11522,11975,11979,5473,11978,11981,11980,11977,11976,
+18365,15357,14586,12349,15377,12348,5472,16180,12347,17407,12667,12666,
+12665,5624,16313,12927,12926,15378,12924,12923,5721,5720,12928,13270,
+5863,13114,5799,13113,12925,13271,5906,18366,5966,13555,13610,17391,
+17680,2095,8365,11982,2096,15381,10345,10344,11523,11983,16835,5474,
+15383,13611,2549,3514,3513,9735,9737,3958,9736,3957,3959,9738,
+14667,10347,10349,10348,15394,10351,4342,10350,10346,15735,18369,10971,
+10973,10963,10967,10964,4723,4726,4728,4727,10969,10972,10970,4729,
+16194,4725,10962,4722,14213,5026,11529,11527,11526,15205,11532,11531,
+11530,11525,5025,11524,11528,5027,11987,14591,11991,11988,11990,11989,
+11986,11992,11995,5305,11985,11996,12354,12357,12359,12358,12352,12356,
+12351,14592,12353,5475,12350,14594,12355,12682,12671,5625,5626,12670,
+12675,12681,12673,12680,15212,12677,15388,12676,12679,12674,12672,15858,
+12678,12935,12933,5723,12932,12938,12936,15390,5724,12931,12929,12930,
+5726,12934,5725,12937,13115,13121,14593,18371,13116,5803,13122,5802,
+13120,13119,5801,13118,5800,13117,13277,13279,13278,13275,5865,13272,
+13276,13281,5864,13391,5909,14595,13392,13486,5943,13584,5975,15207,
+13612,5976,13628,13627,5991,13636,17797,10353,17202,10974,11535,17392,
+4730,5028,11533,16244,11536,5029,15767,11997,11534,12360,5476,12683,
+12941,12939,5804,13282,5912,5866,13487,5967,16298,2551,7731,14600,
+3960,14601,10354,4345,10355,10976,10975,5031,10979,10978,10977,14603,
+11537,11540,11539,11538,5030,12001,11999,11998,16151,12000,16146,5477,
+12362,16160,12685,12684,12687,5627,12686,18372,12942,12944,12943,14605,
+13124,13127,13283,5867,5944,5968,13615,2552,4733,5032,12365,16153,
+13284,14606,13585,7732,5992,2553,11541,14609,12366,16128,13128,13285,
+2554,10981,4735,4734,10980,12367,12369,12368,5481,5480,5479,14612,
+5806,13129,5805,13287,13286,5945,13488,3041,9741,10985,10982,10989,
+18373,4737,10988,10984,10983,10987,10986,4736,11552,11547,11545,11554,
+11546,15419,11542,17393,11548,16921,11543,12011,11544,11555,17955,14617,
+16301,11551,5033,11550,11549,12003,12006,16214,12005,15422,12013,12008,
+12012,12010,12009,12007,5309,5308,5310,5307,12014,16308,12375,12378,
+12376,12380,12373,5486,12374,12372,12379,12371,12370,5485,5483,5482,
+12377,12697,12703,5630,12698,12701,12705,5631,12700,18374,12692,12691,
+12704,12695,12693,12702,12694,5629,5628,15297,12699,16087,12696,18375,
+12947,12950,12948,12954,12952,12946,12957,16186,12945,14620,5728,12953,
+12949,5727,12956,16158,18715,13132,13131,17954,18378,13138,13134,13137,
+5808,17894,13130,13133,5807,16162,15751,5869,13298,13293,13297,15417,
+13300,13296,13292,15742,5871,13295,13299,5870,13290,12951,13294,13291,
+15985,13288,13289,5868,13399,13401,13404,13400,13405,15414,13398,13396,
+15415,5913,13402,5915,5914,13397,13403,16063,13493,5946,13494,13492,
+13489,13491,13490,13556,13558,13557,13588,16033,13587,13586,13589,13633,
+13637,15416,17682,3042,9055,9744,3961,9742,4350,4348,10363,4349,
+10996,10999,10993,11000,10992,10994,10995,10998,16187,4740,11003,11002,
+4738,10997,11001,4739,11560,5034,15484,11557,11563,11566,11562,11559,
+11567,11558,15425,11564,5035,11556,5036,5037,11561,12023,12021,12015,
+16458,12018,12028,12022,14638,12030,12027,5312,12029,12016,16299,12024,
+18381,12385,12387,12390,17721,12384,16074,5487,12392,12383,12393,12389,
+12391,12395,12388,12396,12386,12382,5488,15982,12394,5489,5633,12017,
+12731,12722,5635,12718,5636,15276,17211,12727,12721,12711,5634,12724,
+12706,12713,12728,12725,16126,12717,14629,12729,12712,12707,12726,14630,
+12709,12723,12714,12730,12710,5632,12708,12962,17395,12967,12979,12970,
+12963,12959,12972,12965,12968,12961,12975,12958,12966,12971,12973,12976,
+12960,15435,12974,12978,12969,16176,13154,13157,13156,13161,13159,5810,
+13150,13140,13139,5812,13149,13141,18384,13146,12977,17394,13142,5811,
+13148,14633,13147,13143,13155,17785,13144,13305,13158,13160,13151,13145,
+13306,13308,13302,5872,14622,13315,13313,5873,13312,13311,13304,13301,
+13307,13316,13303,13309,13414,13419,13409,13412,5916,13416,13423,13310,
+13410,13420,13424,13415,13408,13418,13417,13422,13421,13314,13413,13407,
+13411,13406,18385,13505,13496,13504,13495,13498,13506,13500,13499,13497,
+13503,17790,13559,17786,13560,14632,13562,13561,13564,13563,13591,13590,
+13616,13617,15428,13629,5989,5993,16260,13638,5994,17683,5729,13162,
+17400,3044,9745,16143,3962,11004,16246,16114,11568,12034,12033,5313,
+12398,12035,12397,14641,12733,5637,5639,12732,14642,16316,5638,16167,
+12982,12984,12983,13163,5813,14643,5917,13507,13565,14644,13642,3045,
+18756,10364,16245,4741,14646,16018,17396,11572,11571,14647,12036,18388,
+5640,5730,13317,13634,3046,4351,18389,4742,15736,12734,14649,13425,
+3515,17684,18390,17783,12037,5969,3516,4743,5314,13426,3517,11005,
+5041,12038,5318,5315,12399,5490,12986,12985,12988,12987,5731,13166,
+13165,5814,13318,18393,5918,13566,13592,5986,18394,9056,11575,12039,
+12735,9746,18382,12040,12401,12400,14656,13429,5951,14657,13567,13593,
+11576,3964,5491,12402,14661,13168,5815,13169,13167,13430,12043,12042,
+12041,12403,16272,17952,12407,12406,12405,12404,5492,12736,12990,5732,
+12989,13170,13321,13320,5874,13319,13433,13432,13431,14663,11577,5319,
+13322,13434,18395,14666,13509,13568,13618,13644,4353,5320,12408,12739,
+13171,13435,18755,4745,16256,12044,12409,12995,16163,12991,5816,12994,
+12993,5733,12992,5735,14671,5734,13173,13172,14672,5876,13323,5875,
+13437,13436,5953,5952,13569,13572,13571,13570,13643,18048,5042,14674,
+5500,12996,13174,5877,13324,13645,17799,17990,12045,13594,16240,18771,
+16792,16895,18776,16897,14247,18080,14301,18084,14386,18091,14770,18107,
+15704,18129,18138,15707,18139,18439,17330,18500,15785,18513,15804,17360,
+18515,15805,18522,15814,18523,15816,18527,18534,15825,18535,15827,18538,
+15832,15834,18539,15835,18540,15844,18544,15851,18548,15874,18563,18564,
+15876,18566,15878,18571,15903,15920,18577,15925,18579,15938,18583,17384,
+18607,15949,18636,15957,18638,15960,15961,18641,18642,15963,18646,15964,
+18678,16061,18679,16069,18683,16071,18684,18701,16092,18706,16119,18709,
+16122,16211,18720,18728,16291,17189,17848,17849,17210,17851,17219,17852,
+17294,17886,17887,17296,17888,17297,17889,17303,17896,628,9089,109,
+122,13743,13745,13746,112,108,14052,174,259,264,175,14051,
+176,208,100,209,103,257,106,105,214,216,215,107,
+265,13758,258,13759,13748,197,132,120,133,
+};
+
+static pdf_cmap cmap_UniCNS_UCS2_H = {
+	-1, "UniCNS-UCS2-H", "", 0, 0, 2,
+	{ {2,0,55295},{2,57344,65535}, },
+	5399, 5399, (pdf_range*) cmap_UniCNS_UCS2_H_ranges,
+	13509, 13509, (unsigned short*) cmap_UniCNS_UCS2_H_table,
+};
+
+/* UniCNS-UCS2-V */
+
+static const pdf_range cmap_UniCNS_UCS2_V_ranges[] = {
+{8211,6,0},{8229,0,109},{12296,5,150},{12298,5,146},
+{12300,5,154},{12302,5,158},{12304,5,142},{12308,5,138},
+{65103,0,13745},{65288,5,130},{65371,0,134},{65373,0,135},
+};
+
+static const unsigned short cmap_UniCNS_UCS2_V_table[2] = {
+120,122,
+};
+
+static pdf_cmap cmap_UniCNS_UCS2_V = {
+	-1, "UniCNS-UCS2-V", "UniCNS-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_UniCNS_UCS2_V_ranges,
+	2, 2, (unsigned short*) cmap_UniCNS_UCS2_V_table,
+};
+
+/* UniCNS-UTF16-H */
+
+static const pdf_range cmap_UniCNS_UTF16_H_ranges[] = {
+{32,377,1},{162,5,262},{165,0,260},{167,6,0},
+{172,0,14049},{175,10,2},{183,0,115},{192,6,5},
+{200,10,7},{210,6,10},{215,0,210},{224,6,12},
+{232,10,14},{236,6,17},{242,6,19},{247,14,21},
+{252,0,18827},{256,6,25},{274,6,27},{282,6,29},
+{299,0,18811},{331,10,31},{339,0,18839},{363,0,18819},
+{461,6,34},{464,10,36},{468,0,18821},{470,0,18823},
+{472,0,18824},{474,0,18825},{476,0,18826},{592,6,39},
+{596,0,18837},{603,0,18836},{609,0,18833},{618,0,18843},
+{629,0,18838},{643,0,18834},{650,0,18842},{710,6,41},
+{714,6,43},{717,0,198},{729,0,502},{772,0,195},
+{776,0,13747},{780,0,504},{913,65,417},{931,25,434},
+{945,65,441},{963,25,458},{1025,0,13936},{1040,21,13930},
+{1046,125,13937},{1078,101,13970},{1105,0,13969},{7870,14,45},
+{8211,6,49},{8216,5,166},{8220,5,168},{8226,0,104},
+{8229,10,51},{8242,0,173},{8245,0,172},{8251,0,177},
+{8254,0,195},{8364,0,17601},{8451,0,266},{8453,0,194},
+{8457,0,267},{8470,0,14054},{8481,0,14055},{8544,37,343},
+{8560,37,526},{8592,14,54},{8598,5,249},{8600,6,58},
+{8632,5,13997},{8679,0,13996},{8725,0,257},{8730,0,213},
+{8734,10,60},{8739,0,254},{8741,0,253},{8745,5,229},
+{8747,0,237},{8750,0,238},{8756,6,63},{8764,0,228},
+{8786,0,221},{8800,6,65},{8806,5,217},{8853,0,243},
+{8857,0,244},{8869,0,231},{8895,0,234},{8943,0,110},
+{9178,5,18844},{9216,125,562},{9249,0,594},{9312,37,506},
+{9332,37,516},{9472,0,311},{9474,0,312},{9484,0,314},
+{9488,0,315},{9492,0,316},{9496,0,317},{9500,0,309},
+{9508,0,308},{9516,0,307},{9524,0,306},{9532,0,305},
+{9552,114,67},{9581,5,318},{9583,6,96},{9585,9,330},
+{9588,0,13744},{9601,29,290},{9609,26,98},{9619,10,105},
+{9632,6,108},{9650,6,110},{9660,6,112},{9670,6,114},
+{9675,0,180},{9678,6,116},{9698,5,326},{9700,6,118},
+{9733,6,120},{9737,0,244},{9792,10,122},{10045,0,13760},
+{11904,0,17608},{11908,0,17692},{11910,9,17693},{11914,0,17696},
+{11916,5,17697},{11925,0,17699},{11932,6,125},{11941,0,17701},
+{11943,0,17702},{11946,0,17703},{11948,0,17704},{11950,0,17705},
+{11958,0,17706},{11964,0,17707},{11966,0,17708},{11974,0,18847},
+{11978,0,17709},{11980,5,17710},{11983,0,17712},{11990,5,17713},
+{11998,0,17715},{12003,0,18848},{12032,0,595},{12033,9,536},
+{12036,14,127},{12040,13,603},{12044,9,541},{12047,30,131},
+{12055,5,612},{12057,22,139},{12063,5,634},{12065,6,145},
+{12067,13,636},{12071,0,549},{12072,13,642},{12076,10,147},
+{12079,5,648},{12081,5,652},{12083,9,551},{12086,9,654},
+{12089,5,554},{12091,0,6007},{12092,13,720},{12096,6,150},
+{12098,13,726},{12102,0,557},{12103,25,730},{12110,0,6026},
+{12111,13,737},{12115,0,6028},{12116,17,741},{12121,0,6029},
+{12122,13,746},{12126,25,854},{12133,6,152},{12135,5,558},
+{12137,29,867},{12145,0,6066},{12146,9,875},{12149,13,1014},
+{12153,0,6162},{12154,9,1018},{12157,17,1022},{12162,33,1029},
+{12171,6,154},{12173,13,1039},{12177,0,6169},{12178,21,1288},
+{12184,0,6375},{12185,29,1294},{12193,6,156},{12195,9,1312},
+{12198,13,1686},{12202,0,561},{12203,5,1695},{12205,6,158},
+{12207,41,2086},{12218,9,2549},{12221,10,160},{12224,5,2553},
+{12226,21,3041},{12232,9,3515},{12235,6,163},{12237,9,3963},
+{12240,5,4352},{12242,0,4745},{12243,5,5042},{12245,0,12045},
+{12288,0,99},{12289,5,101},{12291,0,179},{12293,9,13754},
+{12296,5,148},{12298,5,144},{12300,5,152},{12302,5,156},
+{12304,5,140},{12306,0,261},{12308,5,136},{12317,5,170},
+{12321,33,353},{12344,9,362},{12353,329,13761},{12443,5,17606},
+{12445,5,13751},{12449,341,13844},{12540,0,13757},{12541,5,13749},
+{12549,145,465},{12736,17,17609},{12741,0,17615},{12742,5,17618},
+{12744,0,17622},{12745,13,17624},{12749,5,17629},{12751,0,13999},
+{12849,0,14053},{12963,0,193},{13198,5,277},{13212,9,272},
+{13217,0,276},{13252,0,279},{13262,0,275},{13265,6,165},
+{13269,0,271},{13365,0,14781},{13376,0,15463},{13386,0,19046},
+{13388,0,17811},{13412,0,14981},{13427,0,15813},{13434,0,16435},
+{13437,6,167},{13459,0,17310},{13462,0,14300},{13477,0,17816},
+{13487,0,15487},{13500,0,17280},{13505,0,17659},{13512,0,15616},
+{13535,0,16036},{13540,0,15956},{13542,0,19122},{13563,0,15818},
+{13574,0,17206},{13630,0,17639},{13649,0,17825},{13651,0,17317},
+{13657,0,18860},{13665,0,16600},{13677,0,17828},{13680,0,15151},
+{13682,0,17829},{13687,6,169},{13700,0,14843},{13719,6,171},
+{13729,0,16610},{13733,0,17841},{13741,0,16124},{13759,0,17842},
+{13761,0,17792},{13765,0,17844},{13767,0,17823},{13770,0,15939},
+{13774,0,16001},{13778,0,16329},{13782,0,16309},{13787,0,18189},
+{13789,0,17324},{13809,10,173},{13819,0,17864},{13822,0,16234},
+{13833,0,17909},{13848,0,18545},{13850,0,17946},{13853,0,14007},
+{13859,0,16582},{13861,0,19012},{13869,0,16006},{13877,0,18734},
+{13881,0,16741},{13886,0,14856},{13895,10,176},{13902,0,18072},
+{13919,0,15859},{13921,0,19084},{13946,0,16099},{13953,0,17830},
+{13978,0,15473},{13989,0,18690},{13994,0,15152},{13996,0,18688},
+{14000,6,179},{14005,0,15298},{14009,0,18567},{14012,0,15615},
+{14017,0,14277},{14019,10,181},{14023,6,184},{14035,6,186},
+{14038,0,15628},{14045,0,14902},{14049,6,188},{14053,6,190},
+{14069,0,14872},{14081,0,14900},{14083,0,17935},{14088,0,16639},
+{14090,0,15573},{14093,0,16952},{14108,0,15870},{14114,6,192},
+{14117,0,14409},{14124,6,194},{14128,0,18780},{14130,6,196},
+{14138,0,15958},{14144,0,16898},{14147,0,16438},{14178,0,15798},
+{14191,0,18379},{14231,0,17901},{14240,0,14888},{14265,0,17335},
+{14270,0,14654},{14294,0,19067},{14322,0,15265},{14328,0,17106},
+{14331,0,16117},{14351,0,17964},{14361,0,14767},{14368,0,17967},
+{14381,0,16686},{14390,0,16691},{14392,0,17339},{14435,0,18115},
+{14453,0,19088},{14496,0,16709},{14531,0,14610},{14540,0,16502},
+{14545,0,14997},{14548,0,19074},{14586,0,17643},{14600,0,17970},
+{14612,0,17342},{14631,0,15409},{14642,0,16770},{14655,0,17971},
+{14669,0,17972},{14691,0,16739},{14712,0,19045},{14720,0,14452},
+{14729,6,198},{14738,0,17270},{14745,0,14778},{14747,0,15795},
+{14753,0,15897},{14756,0,15887},{14776,0,17979},{14812,0,16078},
+{14818,0,18120},{14821,0,14651},{14828,0,17168},{14840,0,17982},
+{14843,0,17221},{14846,0,17256},{14849,0,16864},{14851,0,17984},
+{14854,0,17271},{14871,6,200},{14889,6,202},{14900,0,17177},
+{14923,0,17988},{14930,0,16083},{14935,0,16798},{14940,0,16324},
+{14942,0,15111},{14950,6,204},{14999,0,17991},{15019,0,16529},
+{15037,0,17993},{15070,0,16716},{15072,0,14970},{15088,0,18098},
+{15090,0,17996},{15093,0,19094},{15099,0,15090},{15118,0,14568},
+{15129,0,18117},{15138,0,17998},{15147,0,18774},{15161,0,18251},
+{15170,0,18000},{15192,0,18002},{15200,0,14650},{15217,6,206},
+{15227,6,208},{15232,0,16866},{15253,6,210},{15257,0,15000},
+{15265,0,16873},{15292,0,17352},{15294,0,15793},{15298,0,16692},
+{15300,0,15008},{15319,0,15020},{15325,0,18015},{15340,0,18020},
+{15346,10,212},{15373,0,16887},{15377,0,15936},{15381,0,14744},
+{15384,0,18737},{15444,0,15872},{15499,0,18871},{15563,0,18032},
+{15565,0,15589},{15569,0,16387},{15574,0,15607},{15580,0,16462},
+{15595,0,16919},{15599,0,18037},{15634,6,215},{15645,0,14652},
+{15666,0,18775},{15675,0,16965},{15686,0,18053},{15692,0,15595},
+{15694,0,16962},{15697,0,14570},{15711,0,16729},{15714,0,15454},
+{15721,6,217},{15727,0,15612},{15733,0,18058},{15741,0,15407},
+{15749,0,18763},{15752,0,19026},{15754,0,18061},{15759,0,15037},
+{15761,0,18063},{15781,0,15702},{15789,0,18073},{15796,0,16550},
+{15807,0,14288},{15814,6,219},{15817,0,18853},{15820,6,221},
+{15827,0,14305},{15835,0,16383},{15847,6,223},{15851,0,15962},
+{15859,6,225},{15863,0,18603},{15868,6,227},{15878,0,18717},
+{15936,0,16745},{15939,0,17261},{15944,0,17813},{15957,0,17023},
+{15988,0,16098},{16040,10,229},{16045,0,15261},{16049,0,15064},
+{16056,0,14923},{16063,0,15115},{16066,0,15320},{16071,0,14709},
+{16074,0,18161},{16076,0,15330},{16080,6,232},{16086,6,234},
+{16090,6,236},{16094,0,14834},{16097,6,238},{16103,0,15324},
+{16105,0,15524},{16107,6,240},{16112,0,18167},{16115,6,242},
+{16122,0,18169},{16124,0,15336},{16127,6,244},{16132,0,17091},
+{16134,6,246},{16142,0,18171},{16211,0,18172},{16216,6,248},
+{16227,0,15078},{16252,0,18176},{16275,0,17869},{16320,0,17359},
+{16328,0,19082},{16343,0,17361},{16348,0,18180},{16357,0,18143},
+{16365,0,17205},{16377,6,250},{16388,0,16654},{16393,0,18878},
+{16413,0,18185},{16441,0,18187},{16453,0,18188},{16467,0,17846},
+{16471,0,14749},{16482,0,15307},{16485,0,16339},{16490,0,18191},
+{16495,0,18192},{16497,0,18944},{16552,0,17365},{16564,0,19149},
+{16571,0,17856},{16575,0,16108},{16584,0,15118},{16600,0,16811},
+{16607,0,15895},{16632,0,19066},{16634,0,16062},{16642,10,252},
+{16649,0,18204},{16654,0,15131},{16689,6,255},{16743,0,18207},
+{16748,0,14510},{16750,0,15139},{16764,0,19070},{16767,0,15234},
+{16769,0,19138},{16784,0,18112},{16818,0,18208},{16836,0,18211},
+{16842,0,14143},{16847,0,18214},{16859,0,14271},{16877,0,19087},
+{16879,0,14147},{16889,0,15166},{16913,0,15169},{16931,0,18881},
+{16960,0,14321},{16992,0,18219},{17002,0,15189},{17014,0,18949},
+{17018,0,18220},{17036,0,18223},{17044,0,18225},{17058,0,18945},
+{17077,0,16400},{17081,0,14502},{17084,0,15498},{17140,0,15289},
+{17147,6,257},{17162,0,19102},{17195,0,14205},{17262,0,18122},
+{17303,0,18235},{17306,0,19030},{17338,0,17247},{17345,0,18069},
+{17369,0,17214},{17375,0,15945},{17389,0,18245},{17392,0,18965},
+{17394,0,15944},{17409,6,259},{17427,0,18255},{17445,0,18257},
+{17453,0,18258},{17530,0,14255},{17551,0,18264},{17553,0,14004},
+{17567,6,261},{17570,0,16505},{17584,0,18268},{17591,0,16289},
+{17597,0,19086},{17600,0,15367},{17603,0,19027},{17605,0,16912},
+{17614,0,15651},{17629,10,263},{17633,0,19151},{17636,0,14306},
+{17641,14,266},{17652,0,14738},{17667,6,270},{17673,0,15952},
+{17675,0,14292},{17686,0,14329},{17691,0,19077},{17693,0,14183},
+{17699,0,14326},{17703,0,14327},{17710,0,15571},{17715,0,15441},
+{17718,0,19031},{17723,0,18282},{17725,0,14532},{17727,0,15890},
+{17731,0,14323},{17745,6,272},{17749,0,16958},{17752,0,19041},
+{17756,0,14219},{17761,6,274},{17770,0,14340},{17773,0,19073},
+{17783,6,276},{17797,0,14533},{17830,0,18968},{17836,0,17377},
+{17843,0,18972},{17882,0,18989},{17897,6,278},{17923,0,18967},
+{17926,0,18291},{17935,0,14357},{17941,0,14403},{17943,0,18292},
+{18011,0,14365},{18042,0,14825},{18048,0,15617},{18081,0,18994},
+{18094,0,19136},{18107,0,19061},{18127,6,280},{18165,0,15263},
+{18167,0,19068},{18195,0,14387},{18200,0,15815},{18230,0,18977},
+{18244,0,18978},{18254,6,282},{18300,0,15821},{18328,0,18305},
+{18342,0,16547},{18358,0,16106},{18389,0,17178},{18413,0,18307},
+{18420,0,17199},{18432,0,17950},{18443,0,17234},{18487,0,18311},
+{18525,0,16655},{18545,0,15619},{18587,0,15293},{18605,6,284},
+{18612,0,15301},{18640,0,15783},{18653,0,16672},{18669,0,17032},
+{18675,0,16065},{18682,0,15940},{18694,0,15303},{18705,0,17796},
+{18718,0,18324},{18725,0,15375},{18730,0,18094},{18733,0,18125},
+{18735,6,286},{18741,0,15555},{18748,0,15352},{18750,0,15622},
+{18757,0,18339},{18769,0,18340},{18771,0,17069},{18789,0,14489},
+{18794,0,18345},{18802,0,14884},{18825,0,14235},{18849,0,14519},
+{18855,0,18350},{18911,0,14506},{18917,0,18353},{18919,0,17953},
+{18959,0,14531},{18973,0,15340},{18980,0,18354},{18997,0,18356},
+{19094,0,15591},{19108,0,18993},{19124,0,17249},{19128,0,15784},
+{19153,0,14563},{19172,0,18359},{19199,0,14578},{19216,0,18873},
+{19225,0,18361},{19232,0,18858},{19244,0,17951},{19255,0,16809},
+{19311,6,288},{19314,0,14588},{19323,0,15501},{19326,0,16394},
+{19342,0,14839},{19344,0,15392},{19347,0,14988},{19350,6,290},
+{19357,0,18370},{19389,6,292},{19392,0,15836},{19460,0,16315},
+{19463,0,16311},{19470,0,14604},{19506,0,18966},{19515,0,16188},
+{19518,0,17787},{19520,0,18980},{19527,0,18979},{19543,0,18986},
+{19547,0,16089},{19565,0,18377},{19575,0,19044},{19579,0,19079},
+{19581,0,15974},{19585,0,18955},{19589,0,18990},{19620,0,18622},
+{19630,0,15426},{19632,0,15429},{19639,0,15905},{19661,0,17784},
+{19681,6,294},{19693,0,16555},{19719,0,18992},{19721,0,16086},
+{19728,0,16663},{19764,0,14645},{19830,6,296},{19849,0,19078},
+{19857,0,17397},{19868,0,18628},{19968,6,298},{19971,6,300},
+{19975,42,302},{19988,10,313},{19992,10,316},{19996,0,18656},
+{19998,5,878},{20001,0,15725},{20004,0,17805},{20006,0,1320},
+{20008,0,536},{20010,38,319},{20022,14,329},{20027,10,333},
+{20031,0,538},{20033,10,336},{20037,0,622},{20039,10,339},
+{20043,0,664},{20045,10,342},{20050,5,880},{20054,0,1321},
+{20056,30,345},{20073,6,353},{20083,0,1322},{20088,0,15758},
+{20094,18,355},{20099,5,9057},{20101,18,360},{20107,14,365},
+{20113,18,369},{20120,14,374},{20126,34,378},{20136,0,1046},
+{20139,5,1326},{20141,5,1700},{20147,0,2098},{20150,6,387},
+{20153,14,389},{20159,22,393},{20166,5,675},{20168,6,399},
+{20170,5,678},{20173,6,401},{20180,13,762},{20184,10,403},
+{20188,14,406},{20193,0,6035},{20195,5,766},{20197,0,760},
+{20200,14,410},{20206,0,15734},{20208,34,414},{20219,0,898},
+{20221,34,423},{20232,14,432},{20237,10,436},{20240,5,893},
+{20242,14,439},{20247,14,443},{20253,0,6078},{20258,0,6081},
+{20264,6,447},{20268,6,449},{20271,6,451},{20274,10,453},
+{20278,38,456},{20289,10,466},{20293,18,469},{20299,18,474},
+{20304,5,1056},{20306,74,479},{20327,0,6186},{20329,14,498},
+{20334,10,502},{20338,102,505},{20365,0,1330},{20367,14,531},
+{20372,18,535},{20378,18,540},{20386,0,14791},{20392,0,17726},
+{20395,0,16418},{20398,10,545},{20402,22,548},{20409,10,554},
+{20413,0,17812},{20415,26,557},{20423,42,564},{20435,6,575},
+{20438,46,577},{20452,6,589},{20460,0,6764},{20462,30,591},
+{20470,5,7208},{20472,10,599},{20477,6,602},{20480,0,2115},
+{20483,0,17814},{20485,18,604},{20491,0,2120},{20492,5,2099},
+{20494,6,609},{20497,46,611},{20510,22,623},{20517,50,629},
+{20531,10,642},{20535,0,7206},{20539,6,645},{20544,6,647},
+{20547,0,2560},{20549,42,649},{20561,0,7761},{20563,0,7739},
+{20565,14,660},{20570,34,664},{20579,5,7754},{20581,6,673},
+{20584,34,675},{20594,22,684},{20602,0,2556},{20605,0,2557},
+{20608,14,690},{20613,0,3049},{20615,6,694},{20619,14,696},
+{20624,10,700},{20628,10,703},{20632,26,706},{20642,6,713},
+{20646,0,16191},{20652,22,715},{20658,5,3521},{20660,18,721},
+{20666,22,726},{20673,6,732},{20676,30,734},{20685,18,742},
+{20691,18,747},{20697,10,752},{20701,18,755},{20707,30,760},
+{20716,22,768},{20723,14,774},{20728,6,778},{20731,42,780},
+{20742,5,10369},{20744,5,4360},{20746,0,10376},{20747,5,10373},
+{20749,6,791},{20752,22,793},{20759,6,799},{20762,0,11011},
+{20764,0,11008},{20767,14,801},{20772,10,805},{20777,10,808},
+{20781,5,12047},{20784,14,811},{20788,5,12410},{20791,5,5736},
+{20793,18,815},{20799,10,820},{20803,26,823},{20811,10,830},
+{20818,0,1349},{20820,14,833},{20825,42,837},{20837,0,605},
+{20839,22,848},{20845,5,684},{20849,0,909},{20852,22,854},
+{20860,0,2130},{20864,0,4751},{20866,0,541},{20870,10,860},
+{20873,5,772},{20877,0,910},{20879,0,6195},{20881,30,863},
+{20890,0,16035},{20892,0,17728},{20894,0,6416},{20896,0,1727},
+{20898,0,2133},{20900,5,2131},{20903,6,871},{20906,10,873},
+{20910,0,18876},{20912,22,876},{20918,5,1079},{20920,6,882},
+{20924,10,884},{20931,0,14811},{20932,5,7222},{20934,58,887},
+{20951,6,902},{20955,30,904},{20964,0,17729},{20973,0,16468},
+{20976,6,912},{20979,14,914},{20984,0,777},{20985,5,775},
+{20988,10,918},{20992,5,608},{20994,6,921},{20997,0,17313},
+{20998,9,689},{21001,14,923},{21006,0,915},{21008,0,6088},
+{21009,5,913},{21011,0,6087},{21014,6,927},{21020,22,929},
+{21028,18,935},{21033,5,1083},{21038,0,1362},{21040,6,940},
+{21042,5,6420},{21044,18,942},{21050,10,947},{21057,0,1364},
+{21059,6,950},{21062,6,952},{21065,26,954},{21074,0,7228},
+{21076,14,961},{21081,18,965},{21086,5,7229},{21088,10,970},
+{21096,30,973},{21106,6,981},{21108,5,3059},{21111,14,983},
+{21115,5,9080},{21117,0,3532},{21119,0,3530},{21120,5,9763},
+{21122,10,987},{21127,9,4364},{21130,0,4368},{21131,5,10377},
+{21133,0,4367},{21135,10,990},{21139,6,993},{21142,22,995},
+{21151,10,1001},{21155,6,1004},{21158,0,6089},{21160,0,17731},
+{21161,5,1087},{21163,6,1006},{21165,5,6200},{21173,0,16476},
+{21177,0,16479},{21179,6,1008},{21182,0,1365},{21184,14,1010},
+{21189,0,16480},{21191,0,1735},{21193,0,1736},{21196,6,1014},
+{21200,14,1016},{21205,18,1020},{21211,0,3064},{21213,18,1025},
+{21218,5,3536},{21220,0,3535},{21222,0,3534},{21225,0,9765},
+{21227,0,9766},{21231,10,1030},{21235,10,1033},{21239,22,1036},
+{21246,5,693},{21249,0,15737},{21253,5,781},{21256,6,1042},
+{21258,5,6425},{21261,22,1044},{21269,10,1050},{21273,6,1053},
+{21276,6,1055},{21279,22,1057},{21287,0,17822},{21290,0,2143},
+{21292,6,1063},{21295,22,1065},{21303,10,1071},{21307,14,1074},
+{21311,5,2587},{21313,18,1078},{21319,14,1083},{21324,10,1087},
+{21329,14,1090},{21335,0,1740},{21338,0,3065},{21340,22,1094},
+{21347,6,1100},{21350,6,1102},{21353,0,546},{21356,14,1104},
+{21360,5,921},{21362,14,1108},{21367,9,1372},{21371,18,1112},
+{21378,0,6000},{21380,0,701},{21386,0,6093},{21390,5,6205},
+{21394,10,1117},{21398,18,1120},{21404,18,1125},{21410,0,15915},
+{21412,42,1130},{21424,0,17826},{21426,0,4370},{21428,0,12414},
+{21430,0,547},{21433,0,6019},{21435,0,792},{21441,10,1141},
+{21445,0,16524},{21448,22,1144},{21456,10,1150},{21460,0,1376},
+{21462,22,1153},{21471,30,1159},{21480,46,1167},{21493,14,1179},
+{21499,6,1183},{21502,0,16577},{21505,0,928},{21507,6,1185},
+{21510,58,1187},{21526,0,15999},{21528,38,1202},{21539,70,1212},
+{21557,5,1112},{21559,10,1230},{21563,14,1233},{21568,14,1237},
+{21573,14,1241},{21578,22,1245},{21588,0,6210},{21600,54,1251},
+{21615,38,1265},{21626,34,1275},{21636,18,1284},{21643,54,1289},
+{21658,0,1394},{21660,0,16230},{21662,0,18413},{21664,82,1303},
+{21686,58,1324},{21701,5,6786},{21703,10,1339},{21707,22,1342},
+{21718,0,6784},{21722,0,18723},{21726,0,6794},{21728,46,1348},
+{21741,10,1360},{21745,10,1363},{21751,5,7253},{21754,14,1366},
+{21759,0,7244},{21761,78,1370},{21783,6,1390},{21786,0,7243},
+{21790,0,16040},{21795,0,17838},{21797,14,1392},{21802,62,1396},
+{21819,6,1412},{21822,14,1414},{21827,34,1418},{21837,26,1427},
+{21845,10,1434},{21852,14,1437},{21857,22,1441},{21865,10,1447},
+{21873,10,1450},{21877,5,7771},{21879,0,8391},{21881,0,17245},
+{21883,38,1453},{21894,62,1463},{21912,10,1479},{21916,6,1482},
+{21919,0,3083},{21921,54,1484},{21936,22,1498},{21945,14,1504},
+{21951,22,1508},{21957,5,3552},{21959,98,1514},{21985,6,1539},
+{21987,5,3547},{21989,22,1541},{21996,0,14290},{21999,14,1547},
+{22005,10,1551},{22009,38,1554},{22020,10,1564},{22024,6,1567},
+{22028,0,9771},{22029,5,3992},{22031,34,1569},{22043,34,1578},
+{22053,0,15992},{22055,0,9769},{22057,6,1587},{22060,10,1589},
+{22063,5,4383},{22066,38,1592},{22077,26,1602},{22085,6,1609},
+{22088,10,1611},{22092,18,1614},{22098,10,1619},{22103,14,1622},
+{22109,6,1626},{22112,26,1628},{22120,50,1635},{22134,26,1648},
+{22142,38,1655},{22153,10,1665},{22156,5,11586},{22158,10,1668},
+{22162,6,1671},{22165,0,5322},{22167,14,1673},{22172,14,1677},
+{22177,0,17259},{22180,6,1681},{22182,5,12417},{22184,0,5495},
+{22186,22,1683},{22193,26,1689},{22201,0,18543},{22204,0,5645},
+{22205,5,13002},{22207,18,1696},{22213,6,1701},{22216,22,1703},
+{22225,0,5919},{22227,6,1709},{22230,6,1711},{22234,6,1713},
+{22237,22,1715},{22244,6,1721},{22247,0,6223},{22250,6,1723},
+{22253,18,1725},{22263,0,6451},{22265,10,1730},{22269,0,15716},
+{22271,6,1733},{22273,5,7259},{22275,5,2169},{22279,26,1735},
+{22290,5,3556},{22292,10,1742},{22296,0,4000},{22298,26,1745},
+{22306,5,6042},{22312,10,1752},{22316,18,1755},{22322,10,1760},
+{22331,0,1134},{22333,26,1763},{22341,10,1770},{22345,38,1773},
+{22356,0,18309},{22359,0,18406},{22363,0,14722},{22367,0,16319},
+{22369,6,1783},{22372,0,1407},{22374,22,1785},{22381,0,6455},
+{22383,14,1791},{22387,5,6463},{22389,10,1795},{22394,26,1798},
+{22402,6,1805},{22408,0,18507},{22410,14,1807},{22415,6,1811},
+{22419,10,1813},{22423,26,1816},{22430,5,6797},{22432,22,1823},
+{22439,0,18708},{22442,0,18693},{22446,0,1773},{22451,14,1829},
+{22456,30,1833},{22465,14,1841},{22470,10,1845},{22475,6,1848},
+{22478,10,1850},{22482,0,7264},{22484,6,1853},{22487,0,15485},
+{22492,46,1855},{22505,0,7825},{22508,74,1867},{22528,58,1886},
+{22544,0,7820},{22546,0,15626},{22548,0,7798},{22552,6,1901},
+{22555,62,1903},{22572,14,1919},{22576,5,3099},{22578,38,1923},
+{22589,0,9119},{22591,6,1933},{22596,0,18363},{22599,34,1935},
+{22609,18,1944},{22615,34,1949},{22626,14,1958},{22632,6,1962},
+{22635,10,1964},{22639,0,9112},{22641,22,1967},{22649,42,1973},
+{22661,26,1984},{22670,26,1991},{22678,0,19108},{22680,10,1998},
+{22684,22,2001},{22691,0,10404},{22693,30,2007},{22702,14,2015},
+{22707,0,4388},{22709,6,2019},{22714,22,2021},{22721,6,2027},
+{22725,18,2029},{22731,0,14857},{22734,34,2034},{22744,22,2043},
+{22750,5,5496},{22752,0,16601},{22754,10,2049},{22759,10,2052},
+{22763,6,2055},{22767,6,2057},{22770,10,2059},{22777,5,3104},
+{22779,18,2062},{22786,22,2067},{22794,0,548},{22796,14,2073},
+{22801,6,2077},{22804,14,2079},{22809,5,948},{22812,6,2083},
+{22815,6,2085},{22818,0,4012},{22820,6,2087},{22823,0,637},
+{22825,26,2089},{22833,6,2096},{22836,0,17741},{22839,5,950},
+{22844,0,6100},{22846,0,1136},{22848,0,6232},{22852,6,2098},
+{22855,5,1411},{22857,6,2100},{22862,14,2102},{22867,10,2106},
+{22871,5,2177},{22874,0,2179},{22876,0,7829},{22880,10,2109},
+{22885,0,18514},{22887,0,3571},{22889,10,2112},{22893,6,2115},
+{22896,38,2117},{22907,42,2127},{22921,6,2138},{22925,14,2140},
+{22930,10,2144},{22934,18,2147},{22941,46,2152},{22956,0,15745},
+{22958,78,2164},{22979,70,2184},{22998,0,6480},{23000,26,2202},
+{23008,6,2209},{23011,14,2211},{23016,110,2215},{23049,18,2243},
+{23055,0,7283},{23057,10,2248},{23061,30,2251},{23070,14,2259},
+{23075,10,2263},{23079,0,15841},{23081,14,2266},{23085,5,7280},
+{23091,0,7287},{23093,18,2270},{23100,10,2275},{23104,42,2278},
+{23116,6,2289},{23120,122,2291},{23152,6,2322},{23159,34,2324},
+{23169,14,2333},{23174,0,15233},{23176,0,16995},{23178,10,2337},
+{23182,38,2340},{23193,38,2350},{23204,14,2360},{23209,0,8451},
+{23211,6,2364},{23214,90,2366},{23238,38,2389},{23249,0,19014},
+{23251,0,16642},{23253,70,2399},{23272,26,2417},{23280,0,16103},
+{23282,38,2424},{23293,10,2434},{23297,10,2437},{23301,0,10421},
+{23303,10,2440},{23307,10,2443},{23311,10,2446},{23315,18,2449},
+{23321,10,2454},{23325,18,2457},{23331,22,2462},{23338,26,2468},
+{23346,0,11601},{23348,0,4777},{23352,0,5326},{23356,0,12056},
+{23357,9,12425},{23360,6,2475},{23363,22,2477},{23370,0,14541},
+{23371,5,13180},{23373,10,2483},{23376,5,639},{23379,14,2486},
+{23383,5,959},{23386,5,1151},{23388,6,2490},{23391,0,1431},
+{23394,18,2492},{23400,6,2497},{23403,14,2499},{23408,34,2503},
+{23418,14,2512},{23423,26,2516},{23431,5,961},{23433,0,964},
+{23435,6,2523},{23438,10,2525},{23442,6,2528},{23445,34,2530},
+{23454,5,17743},{23458,26,2539},{23466,0,16763},{23468,10,2546},
+{23472,0,2195},{23475,26,2549},{23487,34,2556},{23498,18,2565},
+{23504,30,2570},{23512,5,9144},{23515,0,19009},{23518,26,2578},
+{23525,5,4027},{23527,22,2585},{23534,10,2591},{23537,5,11609},
+{23539,0,16661},{23541,6,2594},{23544,0,642},{23546,0,965},
+{23551,0,16605},{23553,0,1798},{23555,10,2596},{23559,10,2599},
+{23562,5,3119},{23564,42,2602},{23578,0,1440},{23580,0,17898},
+{23582,10,2613},{23586,14,2616},{23592,0,6245},{23594,0,6246},
+{23596,0,1156},{23600,6,2620},{23603,0,9147},{23607,22,2622},
+{23614,6,2628},{23616,5,1157},{23620,0,6491},{23621,5,1442},
+{23623,26,2630},{23630,5,1799},{23632,6,2637},{23635,14,2639},
+{23640,6,2643},{23644,5,2652},{23646,0,15719},{23648,0,2651},
+{23650,6,2645},{23652,5,4404},{23655,6,2647},{23657,5,12057},
+{23660,14,2649},{23665,0,646},{23667,6,2653},{23672,6,2655},
+{23674,5,6112},{23676,0,6111},{23678,0,6114},{23685,6,2657},
+{23688,22,2659},{23695,0,6248},{23696,5,1161},{23698,14,2665},
+{23705,6,2669},{23708,86,2671},{23731,0,1450},{23733,14,2693},
+{23738,0,16683},{23745,6,2697},{23750,26,2699},{23758,18,2706},
+{23763,5,6849},{23765,26,2711},{23774,6,2718},{23781,0,17975},
+{23784,10,2720},{23788,22,2723},{23796,22,2729},{23803,10,2735},
+{23807,10,2738},{23814,6,2741},{23819,30,2743},{23828,30,2751},
+{23837,14,2759},{23842,30,2763},{23852,0,15863},{23854,50,2771},
+{23868,30,2784},{23877,30,2792},{23886,0,8476},{23888,10,2800},
+{23893,10,2803},{23897,0,8483},{23899,0,15829},{23902,0,9154},
+{23906,6,2806},{23909,0,9151},{23911,10,2808},{23915,6,2811},
+{23919,14,2813},{23924,0,16111},{23927,46,2817},{23940,30,2829},
+{23949,6,2837},{23954,14,2839},{23959,0,10425},{23961,6,2843},
+{23964,26,2845},{23972,0,17965},{23975,46,2852},{23988,26,2864},
+{23996,6,2871},{24000,14,2873},{24006,5,12749},{24009,0,5651},
+{24011,0,13006},{24013,0,5743},{24015,0,13007},{24017,6,2877},
+{24020,18,2879},{24027,0,550},{24029,22,2884},{24037,14,2890},
+{24043,0,1165},{24046,0,2216},{24048,0,9158},{24049,9,649},
+{24052,6,2894},{24055,0,1805},{24057,0,6857},{24061,10,2896},
+{24066,5,825},{24068,0,6052},{24070,0,969},{24073,14,2899},
+{24078,0,6259},{24081,6,2903},{24084,30,2905},{24093,0,1806},
+{24095,6,2913},{24097,9,6858},{24100,6,2915},{24104,6,2917},
+{24107,0,2218},{24109,6,2919},{24115,6,2921},{24118,10,2923},
+{24125,6,2926},{24128,22,2928},{24136,0,14892},{24138,22,2934},
+{24147,10,2940},{24151,0,4040},{24152,5,9842},{24155,34,2943},
+{24166,0,11064},{24167,5,11062},{24169,14,2952},{24173,5,12060},
+{24175,6,2956},{24178,18,2958},{24184,34,2963},{24194,10,2972},
+{24198,30,2975},{24207,0,1167},{24210,0,18906},{24213,5,1461},
+{24215,0,1459},{24217,14,2983},{24224,0,1810},{24226,26,2987},
+{24234,18,2994},{24240,6,2999},{24242,5,7889},{24244,10,3001},
+{24247,5,2672},{24249,0,7888},{24253,6,3004},{24257,5,3133},
+{24260,42,3006},{24272,78,3017},{24293,18,3037},{24300,0,5501},
+{24302,5,12751},{24305,14,3042},{24310,26,3046},{24318,6,3053},
+{24321,6,3055},{24324,6,3057},{24327,6,3059},{24330,22,3061},
+{24338,6,3067},{24340,5,718},{24343,6,3069},{24346,6,3071},
+{24349,0,6266},{24351,0,1172},{24354,9,6515},{24357,0,17968},
+{24358,5,1464},{24360,6,3073},{24365,6,3075},{24368,6,3077},
+{24371,0,7308},{24373,14,3079},{24378,10,3083},{24384,0,9169},
+{24387,6,3086},{24390,0,4045},{24392,38,3088},{24404,0,6518},
+{24406,14,3098},{24412,6,3102},{24417,18,3104},{24423,0,7310},
+{24425,18,3109},{24431,22,3114},{24438,14,3120},{24443,18,3124},
+{24448,5,1467},{24450,6,3129},{24453,18,3131},{24458,5,1818},
+{24460,0,1821},{24464,10,3136},{24470,14,3139},{24475,6,3143},
+{24478,14,3145},{24484,18,3149},{24489,5,3138},{24491,18,3154},
+{24497,6,3159},{24501,10,3161},{24505,26,3164},{24512,5,12753},
+{24514,14,3171},{24521,0,6055},{24524,6,3175},{24527,14,3177},
+{24532,22,3181},{24539,0,14922},{24541,18,3187},{24547,10,3192},
+{24552,0,6273},{24554,6,3195},{24557,10,3197},{24561,0,1181},
+{24563,10,3200},{24567,6,3203},{24570,6,3205},{24573,0,1473},
+{24575,6,3207},{24585,58,3209},{24601,22,3224},{24608,62,3230},
+{24625,18,3246},{24631,0,6873},{24633,0,6874},{24635,0,17747},
+{24640,30,3251},{24649,6,3259},{24652,6,3261},{24656,0,2229},
+{24658,14,3263},{24664,14,3267},{24669,10,3271},{24674,58,3274},
+{24690,0,6876},{24693,0,14934},{24695,0,16389},{24702,14,3289},
+{24707,30,3293},{24716,10,3301},{24720,0,7897},{24722,0,7318},
+{24724,14,3304},{24730,26,3308},{24738,10,3315},{24743,6,3318},
+{24752,70,3320},{24771,50,3338},{24785,0,3141},{24787,5,7902},
+{24789,0,2705},{24791,54,3351},{24806,18,3365},{24816,70,3370},
+{24835,54,3388},{24850,18,3402},{24856,22,3407},{24863,0,3594},
+{24866,6,3413},{24871,10,3415},{24875,6,3418},{24878,10,3420},
+{24882,0,9178},{24884,0,3605},{24886,6,3423},{24891,0,9874},
+{24893,22,3425},{24900,18,3431},{24905,5,9173},{24907,22,3436},
+{24914,5,9864},{24916,10,3442},{24920,38,3445},{24930,5,4052},
+{24932,18,3455},{24938,10,3460},{24942,38,3463},{24953,6,3473},
+{24956,10,3475},{24960,14,3478},{24967,0,16762},{24969,22,3482},
+{24976,26,3488},{24984,22,3495},{24991,0,10457},{24993,6,3501},
+{24996,0,4437},{24999,78,3503},{25020,0,11617},{25022,22,3523},
+{25029,34,3529},{25039,6,3538},{25043,0,16766},{25046,0,12070},
+{25048,0,12062},{25050,0,14513},{25054,10,3540},{25058,38,3543},
+{25069,5,12064},{25072,10,3553},{25077,50,3556},{25091,5,13336},
+{25095,14,3569},{25100,5,977},{25102,0,976},{25104,10,3573},
+{25108,10,3576},{25113,0,7328},{25114,5,2711},{25119,6,3579},
+{25121,5,3610},{25123,10,3581},{25127,0,9879},{25129,22,3584},
+{25136,0,4791},{25138,10,3590},{25142,6,3593},{25145,6,3595},
+{25149,18,3597},{25154,5,6892},{25158,34,3602},{25168,10,3611},
+{25171,5,834},{25176,18,3614},{25182,0,6125},{25184,26,3619},
+{25192,0,16149},{25197,30,3626},{25206,6,3634},{25209,70,3636},
+{25228,0,6287},{25230,5,6288},{25232,34,3654},{25245,0,16022},
+{25252,0,14953},{25254,0,16321},{25256,38,3663},{25267,14,3673},
+{25272,6,3677},{25275,18,3679},{25281,70,3684},{25299,5,1503},
+{25301,0,16780},{25302,5,1518},{25304,18,3702},{25311,0,16412},
+{25317,0,17981},{25323,98,3707},{25351,10,3732},{25355,26,3735},
+{25363,5,6907},{25365,6,3742},{25368,0,17345},{25384,6,3744},
+{25386,5,2257},{25388,14,3746},{25393,54,3750},{25408,14,3764},
+{25412,5,7334},{25414,46,3768},{25428,26,3780},{25444,6,3787},
+{25447,10,3789},{25451,30,3792},{25461,34,3800},{25471,26,3809},
+{25479,46,3816},{25492,0,8524},{25494,14,3828},{25499,42,3832},
+{25511,42,3843},{25529,0,16029},{25533,6,3854},{25536,78,3856},
+{25557,90,3876},{25581,5,3175},{25583,30,3899},{25592,6,3907},
+{25595,6,3909},{25598,0,16030},{25606,6,3911},{25609,30,3913},
+{25618,14,3921},{25622,5,3624},{25624,0,9202},{25626,10,3925},
+{25630,14,3928},{25634,5,9205},{25636,18,3932},{25642,26,3937},
+{25650,38,3944},{25661,18,3954},{25667,0,9199},{25675,0,9897},
+{25677,6,3959},{25680,18,3961},{25688,38,3966},{25701,18,3976},
+{25707,26,3981},{25714,5,9887},{25716,38,3988},{25727,0,9901},
+{25730,0,9894},{25733,0,10469},{25735,26,3998},{25743,18,4005},
+{25749,22,4010},{25756,18,4016},{25762,18,4021},{25769,0,4452},
+{25771,38,4026},{25782,0,14948},{25787,5,4795},{25789,34,4036},
+{25799,0,4799},{25801,10,4045},{25805,14,4048},{25810,10,4052},
+{25814,22,4055},{25821,0,17182},{25824,54,4061},{25839,22,4075},
+{25847,6,4081},{25850,5,5334},{25852,22,4083},{25859,6,4089},
+{25862,6,4091},{25865,6,4093},{25868,22,4095},{25875,26,4101},
+{25883,46,4108},{25897,30,4120},{25906,30,4128},{25915,0,1208},
+{25917,10,4136},{25921,0,6913},{25923,0,6914},{25925,6,4139},
+{25928,5,2262},{25930,0,7358},{25933,0,16799},{25935,0,2749},
+{25937,0,2745},{25939,26,4141},{25948,14,4148},{25954,5,3186},
+{25956,18,4152},{25962,14,4157},{25967,0,9225},{25970,18,4161},
+{25975,5,4463},{25977,14,4166},{25983,10,4170},{25986,5,5089},
+{25988,22,4173},{25995,6,4179},{26000,10,4181},{26004,14,4184},
+{26009,0,2264},{26011,6,4188},{26013,5,8564},{26015,14,4190},
+{26020,6,4194},{26023,6,4196},{26026,10,4198},{26030,10,4201},
+{26034,5,10485},{26037,18,4204},{26043,18,4209},{26049,6,4214},
+{26051,5,7361},{26053,6,4216},{26059,5,2757},{26061,30,4218},
+{26070,6,4226},{26074,6,4228},{26077,26,4230},{26085,6,4237},
+{26088,6,4239},{26092,5,986},{26094,30,4241},{26106,14,4249},
+{26111,6,4253},{26114,78,4255},{26136,0,16817},{26140,50,4275},
+{26155,0,6925},{26157,38,4288},{26169,6,4298},{26177,18,4300},
+{26183,26,4305},{26191,0,2269},{26193,10,4312},{26199,0,16539},
+{26201,62,4315},{26218,10,4331},{26222,26,4334},{26230,34,4341},
+{26240,0,8572},{26244,10,4350},{26247,5,3632},{26249,22,4353},
+{26256,10,4359},{26260,26,4362},{26269,0,4077},{26271,14,4369},
+{26276,0,16570},{26280,14,4373},{26285,58,4377},{26301,14,4392},
+{26308,0,4810},{26310,14,4396},{26314,5,11104},{26316,14,4400},
+{26322,0,11634},{26326,0,5092},{26328,6,4404},{26330,5,12081},
+{26332,10,4406},{26336,0,5508},{26339,5,12762},{26342,14,4409},
+{26347,6,4413},{26349,5,13445},{26352,6,4415},{26354,5,988},
+{26356,0,1211},{26358,14,4417},{26364,0,2591},{26366,5,3200},
+{26368,22,4421},{26376,26,4427},{26383,5,6931},{26386,5,7368},
+{26388,5,2276},{26390,14,4434},{26395,0,2768},{26397,26,4438},
+{26405,14,4445},{26410,5,842},{26412,10,4449},{26417,0,993},
+{26419,14,4452},{26424,30,4456},{26436,22,4464},{26443,10,4470},
+{26446,13,1213},{26451,0,1223},{26453,10,4473},{26457,6,4476},
+{26460,26,4478},{26471,0,16842},{26474,18,4485},{26479,5,1550},
+{26481,26,4490},{26488,5,6598},{26490,22,4497},{26497,26,4503},
+{26505,0,1553},{26507,42,4510},{26519,14,4521},{26524,6,4525},
+{26527,6,4527},{26532,0,18001},{26540,0,16867},{26542,54,4529},
+{26559,30,4543},{26568,0,6935},{26569,5,6968},{26571,38,4551},
+{26582,38,4561},{26594,22,4571},{26601,70,4577},{26620,0,6960},
+{26622,26,4595},{26637,0,17025},{26640,0,14748},{26642,10,4602},
+{26646,10,4605},{26650,34,4608},{26661,6,4617},{26664,14,4619},
+{26669,10,4623},{26673,0,7379},{26674,5,7373},{26676,42,4626},
+{26688,70,4637},{26707,14,4655},{26717,0,16854},{26725,0,17751},
+{26731,0,7977},{26733,5,7961},{26735,0,7966},{26737,6,4659},
+{26740,22,4661},{26747,70,4667},{26767,22,4685},{26774,10,4691},
+{26779,10,4694},{26783,22,4697},{26790,66,4703},{26809,0,15636},
+{26813,0,17020},{26819,46,4720},{26832,34,4732},{26842,0,3224},
+{26844,0,8581},{26845,5,8615},{26847,10,4741},{26851,6,4744},
+{26854,26,4746},{26862,62,4753},{26880,86,4769},{26903,18,4791},
+{26917,0,8624},{26922,0,8582},{26924,0,16184},{26927,6,4796},
+{26930,30,4798},{26939,46,4806},{26952,5,9252},{26954,10,4818},
+{26958,6,4821},{26961,170,4823},{27008,0,16190},{27010,6,4866},
+{27013,6,4868},{27018,0,15732},{27021,6,4870},{27024,6,4872},
+{27027,38,4874},{27038,102,4884},{27065,0,9938},{27067,38,4910},
+{27078,0,9953},{27081,34,4920},{27091,14,4929},{27097,0,9947},
+{27105,6,4933},{27108,22,4935},{27115,14,4941},{27121,14,4945},
+{27126,94,4949},{27151,0,10526},{27153,0,4483},{27155,58,4973},
+{27171,0,4469},{27173,18,4988},{27179,10,4993},{27186,14,4996},
+{27192,38,5000},{27203,26,5010},{27211,6,5017},{27213,5,11141},
+{27215,50,5019},{27229,58,5032},{27245,0,11120},{27247,0,11134},
+{27249,0,18018},{27252,0,18017},{27254,0,11121},{27258,0,15021},
+{27262,30,5047},{27271,0,11644},{27273,6,5055},{27276,46,5057},
+{27289,62,5069},{27307,10,5085},{27310,5,5346},{27313,18,5088},
+{27318,5,12090},{27320,14,5093},{27325,6,5097},{27330,6,5099},
+{27333,34,5101},{27343,10,5110},{27347,6,5113},{27352,38,5115},
+{27365,0,5510},{27367,6,5125},{27370,10,5127},{27374,5,12770},
+{27376,6,5130},{27379,0,12764},{27382,0,18026},{27384,18,5132},
+{27392,0,13015},{27394,14,5137},{27400,5,13190},{27402,6,5141},
+{27407,6,5143},{27409,5,13342},{27411,0,13447},{27414,6,5145},
+{27416,5,13516},{27418,0,13519},{27421,6,5147},{27424,6,5149},
+{27427,0,1562},{27429,0,6601},{27432,0,6973},{27436,6,5151},
+{27439,0,7399},{27441,22,5153},{27447,5,7997},{27449,26,5159},
+{27457,10,5166},{27461,38,5169},{27472,10,5179},{27476,14,5182},
+{27481,0,4828},{27483,6,5186},{27486,30,5188},{27494,5,1563},
+{27498,0,1897},{27501,0,7403},{27503,0,17685},{27506,0,3659},
+{27508,0,16892},{27510,22,5196},{27518,26,5202},{27526,0,1899},
+{27528,10,5209},{27532,0,8003},{27533,5,8001},{27535,0,8000},
+{27537,0,7999},{27540,22,5212},{27547,0,9288},{27550,9,9957},
+{27554,22,5218},{27562,5,11148},{27565,14,5224},{27570,6,5228},
+{27573,10,5230},{27578,0,2792},{27580,6,5233},{27583,10,5235},
+{27587,5,9960},{27589,5,4487},{27591,26,5238},{27599,6,5245},
+{27602,10,5247},{27606,10,5250},{27610,10,5253},{27614,0,6604},
+{27616,18,5256},{27622,10,5261},{27626,0,18029},{27627,5,2793},
+{27631,6,5264},{27634,5,8636},{27639,5,9292},{27641,6,5266},
+{27643,5,9289},{27645,38,5268},{27656,6,5278},{27659,10,5280},
+{27663,10,5283},{27667,14,5286},{27672,0,6145},{27673,5,6318},
+{27675,10,5290},{27679,0,1903},{27680,5,6980},{27683,14,5293},
+{27687,5,2307},{27690,10,5297},{27694,5,3234},{27696,6,5300},
+{27699,34,5302},{27709,26,5311},{27718,0,6146},{27721,6,5318},
+{27723,5,6152},{27725,5,1008},{27727,6,5320},{27730,0,6147},
+{27732,6,5322},{27735,30,5324},{27743,5,1002},{27745,0,1006},
+{27749,26,5332},{27757,38,5339},{27768,14,5349},{27773,42,5353},
+{27784,5,1231},{27786,26,5364},{27794,18,5371},{27800,22,5376},
+{27807,0,14473},{27810,0,15715},{27818,42,5382},{27830,26,5393},
+{27837,5,1575},{27839,34,5400},{27849,58,5409},{27865,42,5424},
+{27877,0,1573},{27879,50,5435},{27893,0,1919},{27897,0,6635},
+{27903,78,5448},{27926,22,5468},{27933,14,5474},{27938,0,7010},
+{27940,98,5478},{27965,5,1915},{27967,14,5503},{27982,0,17752},
+{27991,22,5507},{27998,18,5513},{28003,5,7414},{28005,22,5518},
+{28012,26,5524},{28020,146,5531},{28068,6,5568},{28074,10,5570},
+{28078,6,5573},{28081,18,5575},{28087,38,5580},{28098,0,8033},
+{28100,38,5590},{28111,50,5600},{28124,5,8023},{28126,34,5613},
+{28136,62,5622},{28153,22,5638},{28160,0,8016},{28162,14,5644},
+{28170,0,15041},{28175,0,15600},{28181,0,18040},{28184,22,5648},
+{28191,86,5654},{28213,5,8684},{28216,14,5676},{28220,5,8645},
+{28222,14,5680},{28227,10,5684},{28230,5,8640},{28233,10,5687},
+{28237,114,5690},{28267,0,8670},{28270,6,5719},{28273,14,5721},
+{28278,14,5725},{28284,0,16931},{28294,0,18043},{28296,6,5729},
+{28299,0,15295},{28301,14,5731},{28306,0,9322},{28307,5,9300},
+{28310,70,5735},{28330,6,5753},{28334,162,5755},{28376,22,5796},
+{28386,0,18046},{28392,5,18049},{28395,18,5802},{28401,6,5807},
+{28404,110,5809},{28434,26,5837},{28441,5,9974},{28444,0,9999},
+{28446,38,5844},{28457,98,5854},{28483,6,5879},{28494,42,5881},
+{28506,42,5892},{28518,6,5903},{28521,30,5905},{28530,10,5913},
+{28534,50,5916},{28548,42,5929},{28560,0,10571},{28562,22,5940},
+{28573,102,5946},{28600,50,5972},{28614,38,5985},{28627,10,5995},
+{28632,26,5998},{28639,5,5110},{28641,14,6005},{28646,14,6009},
+{28651,30,6013},{28660,0,11663},{28662,10,6021},{28666,10,6024},
+{28670,14,6027},{28675,18,6031},{28681,10,6036},{28684,5,12099},
+{28686,6,6039},{28689,0,5356},{28692,50,6041},{28705,9,12463},
+{28708,0,12468},{28710,26,6054},{28719,26,6061},{28727,22,6068},
+{28734,18,6074},{28739,5,13016},{28741,5,13021},{28744,5,13019},
+{28746,14,6079},{28752,10,6083},{28756,0,18065},{28757,9,13193},
+{28760,0,5833},{28762,58,6086},{28777,5,13639},{28779,6,6101},
+{28782,14,6103},{28788,26,6107},{28796,5,1255},{28798,6,6114},
+{28801,22,6116},{28809,10,6122},{28814,6,6125},{28817,22,6127},
+{28824,10,6133},{28831,10,6136},{28835,18,6139},{28841,0,7021},
+{28843,26,6144},{28851,0,1930},{28852,5,7019},{28855,30,6151},
+{28864,0,18227},{28868,0,15274},{28869,9,7463},{28872,0,2337},
+{28874,42,6159},{28885,5,16985},{28887,14,6170},{28892,26,6174},
+{28900,0,2335},{28911,10,6181},{28915,54,6184},{28930,0,8062},
+{28932,10,6198},{28937,5,2835},{28939,14,6201},{28944,0,8053},
+{28947,0,8057},{28951,0,8047},{28953,5,3272},{28955,34,6205},
+{28965,6,6214},{28968,6,6216},{28971,6,6218},{28974,34,6220},
+{28986,6,6229},{28990,0,14126},{28992,30,6231},{29001,46,6239},
+{29014,18,6251},{29020,66,6256},{29038,0,3278},{29040,14,6273},
+{29045,14,6277},{29050,18,6281},{29056,10,6286},{29060,26,6289},
+{29068,0,14826},{29070,18,6296},{29076,0,4129},{29078,62,6301},
+{29095,14,6317},{29100,6,6321},{29103,26,6323},{29111,14,6330},
+{29116,14,6334},{29120,5,11189},{29122,0,11185},{29123,5,4855},
+{29125,26,6338},{29134,18,6345},{29140,10,6350},{29144,6,6353},
+{29146,5,11200},{29148,6,6355},{29151,14,6357},{29156,18,6361},
+{29163,14,6366},{29168,10,6370},{29172,10,6373},{29176,6,6376},
+{29179,5,5358},{29181,26,6378},{29189,10,6385},{29193,6,6388},
+{29196,18,6390},{29203,5,12788},{29205,10,6395},{29209,10,6398},
+{29213,0,13023},{29214,5,13197},{29218,38,6401},{29228,5,1605},
+{29230,0,17017},{29232,0,1937},{29237,6,6411},{29240,14,6413},
+{29245,22,6417},{29252,0,10018},{29254,10,6423},{29257,5,7023},
+{29259,6,6426},{29263,6,6428},{29266,6,6430},{29269,58,6432},
+{29286,6,6447},{29289,6,6449},{29292,0,7025},{29294,10,6451},
+{29298,10,6454},{29302,14,6457},{29307,5,8065},{29309,22,6461},
+{29316,14,6467},{29320,5,8703},{29323,54,6471},{29338,6,6485},
+{29341,5,11202},{29343,0,18234},{29345,14,6487},{29349,5,12475},
+{29351,14,6491},{29356,18,6495},{29362,0,16310},{29364,5,6156},
+{29370,0,6347},{29373,0,6343},{29375,30,6500},{29385,22,6508},
+{29392,10,6514},{29396,0,6657},{29398,18,6517},{29404,0,6655},
+{29407,0,7033},{29408,5,1942},{29410,10,6522},{29414,0,7035},
+{29416,14,6525},{29427,6,6529},{29430,50,6531},{29444,0,16053},
+{29447,6,6544},{29450,10,6546},{29455,18,6549},{29462,14,6554},
+{29467,14,6558},{29474,6,6562},{29477,38,6564},{29488,50,6574},
+{29502,30,6587},{29512,10,6595},{29516,26,6598},{29527,18,6605},
+{29533,0,10605},{29534,9,10602},{29537,6,6610},{29541,0,11208},
+{29542,5,11205},{29544,18,6612},{29550,5,11683},{29552,34,6617},
+{29562,74,6626},{29582,6,6645},{29586,0,6353},{29587,5,6351},
+{29589,14,6647},{29596,26,6651},{29604,38,6658},{29618,42,6668},
+{29630,10,6679},{29634,58,6682},{29650,18,6697},{29655,5,7495},
+{29657,22,6702},{29664,46,6708},{29677,10,6720},{29683,106,6723},
+{29713,6,6750},{29716,14,6752},{29721,18,6756},{29726,5,18164},
+{29728,26,6761},{29736,50,6768},{29749,5,3292},{29751,14,6781},
+{29756,0,15071},{29759,42,6785},{29770,5,9371},{29772,10,6796},
+{29775,5,9377},{29777,26,6799},{29785,6,6806},{29787,5,3715},
+{29789,34,6808},{29799,62,6817},{29817,6,6833},{29820,30,6835},
+{29829,14,6843},{29833,5,10612},{29835,10,6847},{29840,0,11688},
+{29842,0,11215},{29844,6,6850},{29847,42,6852},{29859,34,6863},
+{29869,0,11690},{29871,14,6872},{29876,30,6876},{29885,26,6884},
+{29893,6,6891},{29896,0,17077},{29898,10,6893},{29903,6,6896},
+{29907,42,6898},{29918,5,7498},{29920,38,6909},{29932,0,7054},
+{29934,0,7055},{29936,10,6919},{29940,5,7500},{29942,5,2855},
+{29944,0,16372},{29947,0,8736},{29949,14,6922},{29954,5,10035},
+{29956,6,6926},{29959,6,6928},{29963,0,11218},{29964,5,4864},
+{29966,6,6930},{29968,9,11694},{29971,30,6932},{29980,14,6940},
+{29985,6,6944},{29989,5,3299},{29992,5,860},{29994,22,6946},
+{30000,13,862},{30004,6,6952},{30007,5,1266},{30009,10,6954},
+{30013,6,6957},{30015,5,6671},{30018,0,17357},{30022,0,16192},
+{30023,5,7057},{30026,22,6959},{30033,0,15614},{30035,10,6965},
+{30041,18,6968},{30047,6,6973},{30050,10,6975},{30053,5,2859},
+{30055,0,17088},{30058,26,6978},{30066,0,18174},{30070,18,6985},
+{30077,14,6990},{30083,6,6994},{30086,6,6996},{30090,34,6998},
+{30100,5,6356},{30104,0,6675},{30105,5,1623},{30109,6,7007},
+{30114,5,1960},{30116,5,1958},{30119,0,7059},{30122,6,7009},
+{30128,6,7011},{30130,5,2361},{30132,10,7013},{30136,54,7016},
+{30151,6,7030},{30154,0,2867},{30155,5,8099},{30157,22,7032},
+{30164,5,2864},{30167,54,7038},{30182,6,7052},{30189,0,9403},
+{30191,82,7054},{30215,26,7075},{30223,10,7082},{30227,14,7085},
+{30233,30,7089},{30241,5,4529},{30243,26,7097},{30252,6,7104},
+{30255,26,7106},{30264,0,4867},{30266,14,7113},{30272,0,16102},
+{30274,6,7117},{30278,6,7119},{30280,5,11700},{30284,34,7121},
+{30294,18,7130},{30300,0,12128},{30303,14,7135},{30308,14,7139},
+{30313,6,7143},{30316,18,7145},{30321,5,5923},{30323,14,7150},
+{30328,10,7154},{30331,5,3310},{30333,22,7157},{30340,0,1625},
+{30342,9,1963},{30345,14,7163},{30350,10,7167},{30354,6,7170},
+{30357,6,7172},{30361,10,7174},{30364,9,10633},{30369,0,17109},
+{30372,10,7177},{30378,6,7180},{30381,14,7182},{30388,6,7186},
+{30391,6,7188},{30394,6,7190},{30397,10,7192},{30402,18,7195},
+{30408,10,7200},{30412,0,17112},{30413,5,2371},{30418,10,7203},
+{30422,0,16213},{30425,18,7206},{30430,5,3728},{30433,0,4152},
+{30435,18,7211},{30441,6,7216},{30444,38,7218},{30455,22,7228},
+{30462,0,1975},{30465,0,1970},{30467,9,7064},{30471,22,7234},
+{30478,5,15106},{30480,14,7240},{30485,0,7522},{30489,5,7523},
+{30491,0,7516},{30493,6,7244},{30495,5,2374},{30498,30,7246},
+{30507,0,16371},{30509,0,8108},{30511,0,8107},{30513,5,8109},
+{30515,46,7254},{30528,0,17120},{30531,10,7266},{30534,5,8751},
+{30538,0,8756},{30539,5,8758},{30541,10,7269},{30546,0,9412},
+{30548,10,7272},{30552,18,7275},{30558,0,3733},{30559,5,9410},
+{30561,10,7280},{30565,42,7283},{30578,0,14699},{30583,58,7294},
+{30599,10,7309},{30603,18,7312},{30609,0,4537},{30611,0,14381},
+{30613,0,11238},{30615,26,7317},{30622,5,4872},{30624,6,7324},
+{30626,5,11236},{30629,0,4874},{30631,6,7326},{30634,14,7328},
+{30639,34,7332},{30649,6,7341},{30651,5,5372},{30653,10,7343},
+{30658,14,7346},{30663,0,5534},{30665,5,12486},{30667,10,7350},
+{30670,5,12799},{30672,0,13029},{30675,10,7353},{30679,0,5925},
+{30680,5,13523},{30682,18,7356},{30688,0,9420},{30690,6,7361},
+{30693,6,7363},{30695,5,7071},{30697,0,2377},{30700,34,7365},
+{30711,30,7374},{30722,6,7382},{30725,6,7384},{30728,6,7386},
+{30732,5,1981},{30734,10,7388},{30737,5,7074},{30739,6,7391},
+{30744,0,18195},{30748,30,7393},{30757,66,7401},{30775,10,7418},
+{30780,6,7421},{30786,14,7423},{30791,30,7427},{30800,18,7435},
+{30812,10,7440},{30816,0,8762},{30818,0,8774},{30820,5,8763},
+{30822,0,18199},{30824,38,7443},{30841,14,7453},{30846,14,7457},
+{30851,6,7461},{30853,5,9427},{30855,10,7463},{30860,14,7466},
+{30865,0,3750},{30867,14,7470},{30871,5,3745},{30873,6,7474},
+{30878,30,7476},{30887,26,7484},{30895,22,7491},{30902,0,15468},
+{30904,18,7497},{30910,0,4543},{30913,0,4158},{30915,5,10649},
+{30917,0,4540},{30919,58,7502},{30935,6,7517},{30938,6,7519},
+{30941,6,7521},{30943,5,11251},{30945,5,11248},{30947,10,7523},
+{30951,14,7526},{30956,38,7530},{30967,0,5151},{30969,6,7540},
+{30971,5,11717},{30973,10,7542},{30977,6,7545},{30980,10,7547},
+{30985,0,12143},{30988,0,12140},{30990,0,5374},{30992,10,7550},
+{30995,5,12141},{30999,0,12494},{31001,0,5535},{31003,14,7553},
+{31009,0,12492},{31011,14,7557},{31015,5,12805},{31017,26,7561},
+{31025,22,7568},{31032,30,7574},{31040,5,1632},{31042,0,6687},
+{31044,34,7582},{31055,90,7591},{31079,6,7614},{31081,5,8128},
+{31083,0,8131},{31085,0,2884},{31088,18,7616},{31097,6,7621},
+{31100,30,7623},{31110,10,7631},{31114,5,10070},{31117,0,4166},
+{31118,5,4164},{31120,54,7634},{31135,14,7648},{31140,42,7652},
+{31152,18,7663},{31158,10,7668},{31161,5,1987},{31163,0,8133},
+{31165,18,7671},{31172,10,7676},{31176,34,7679},{31185,5,1989},
+{31188,10,7688},{31192,0,2404},{31196,18,7691},{31202,10,7696},
+{31206,6,7699},{31209,6,7701},{31211,5,7547},{31213,6,7703},
+{31217,0,15143},{31220,0,15138},{31222,5,8136},{31224,0,8135},
+{31226,6,7705},{31232,0,3325},{31234,18,7707},{31240,0,3322},
+{31242,14,7712},{31248,22,7716},{31255,0,9444},{31256,5,9441},
+{31258,10,7722},{31262,10,7725},{31266,0,9446},{31270,0,10085},
+{31272,0,10084},{31274,34,7728},{31287,0,4551},{31289,30,7737},
+{31299,38,7745},{31309,5,4880},{31316,0,11731},{31318,10,7755},
+{31322,10,7758},{31327,6,7761},{31329,5,5376},{31333,0,14134},
+{31335,5,12497},{31337,0,5538},{31339,0,5537},{31340,5,12811},
+{31342,0,12810},{31344,5,13209},{31346,0,19133},{31348,10,7763},
+{31352,14,7766},{31357,18,7770},{31363,30,7775},{31371,5,7559},
+{31375,42,7783},{31390,0,9452},{31391,5,3764},{31394,6,7794},
+{31400,10,7796},{31403,5,10087},{31406,42,7799},{31418,10,7810},
+{31422,6,7813},{31424,5,11734},{31426,5,14139},{31428,5,5379},
+{31431,18,7815},{31439,0,18212},{31441,0,7095},{31443,0,16266},
+{31448,22,7820},{31455,6,7826},{31458,22,7828},{31465,10,7834},
+{31469,10,7837},{31478,6,7840},{31481,26,7842},{31488,5,7096},
+{31492,10,7849},{31496,18,7852},{31502,26,7857},{31512,14,7864},
+{31517,14,7868},{31522,78,7872},{31544,6,7892},{31547,0,8142},
+{31552,0,8793},{31554,66,7894},{31572,10,7911},{31576,0,8794},
+{31584,30,7914},{31593,0,9458},{31596,50,7922},{31611,0,18217},
+{31618,0,10105},{31620,6,7935},{31623,6,7937},{31626,34,7939},
+{31636,22,7948},{31643,10,7954},{31648,18,7957},{31660,14,7962},
+{31665,6,7966},{31668,6,7968},{31671,10,7970},{31678,0,10665},
+{31680,6,7973},{31684,6,7975},{31686,5,4559},{31689,14,7977},
+{31694,10,7981},{31700,6,7984},{31704,82,7986},{31728,5,11753},
+{31730,10,8007},{31735,50,8010},{31749,10,8023},{31753,38,8026},
+{31765,0,16481},{31769,0,12152},{31771,34,8036},{31781,34,8045},
+{31792,0,12161},{31795,0,12499},{31797,0,14169},{31799,10,8054},
+{31803,10,8057},{31806,5,5539},{31808,0,5544},{31810,14,8060},
+{31815,14,8064},{31820,6,8068},{31824,6,8070},{31827,6,8072},
+{31830,6,8074},{31833,18,8076},{31839,6,8081},{31843,18,8083},
+{31849,30,8088},{31858,14,8096},{31864,5,7099},{31866,18,8100},
+{31871,9,7101},{31875,14,8105},{31880,10,8109},{31884,10,8112},
+{31889,6,8115},{31892,18,8117},{31900,0,18222},{31902,6,8122},
+{31905,10,8124},{31909,14,8127},{31916,0,14469},{31918,6,8131},
+{31921,18,8133},{31928,18,8138},{31933,5,4185},{31935,0,10107},
+{31938,6,8143},{31941,0,10672},{31943,30,8145},{31952,5,11281},
+{31954,10,8153},{31957,5,4894},{31959,0,11280},{31961,6,8156},
+{31964,18,8158},{31970,0,5169},{31974,10,8163},{31978,0,12505},
+{31980,10,8166},{31983,5,5677},{31985,34,8169},{31995,14,8178},
+{32000,138,8182},{32037,0,16094},{32040,6,8217},{32043,6,8219},
+{32046,22,8221},{32053,6,8227},{32056,22,8229},{32062,5,8174},
+{32064,30,8235},{32074,0,8176},{32077,38,8243},{32088,0,8800},
+{32090,22,8253},{32097,10,8259},{32102,22,8262},{32109,26,8268},
+{32121,18,8275},{32127,10,8280},{32131,14,8283},{32136,6,8287},
+{32139,18,8289},{32145,26,8294},{32156,34,8301},{32166,62,8310},
+{32183,22,8326},{32189,5,4190},{32191,14,8332},{32196,14,8336},
+{32201,6,8340},{32203,5,10122},{32205,14,8342},{32210,10,8346},
+{32214,46,8349},{32227,30,8361},{32236,0,4570},{32238,38,8369},
+{32249,10,8379},{32253,6,8382},{32259,0,10682},{32263,66,8384},
+{32282,18,8401},{32287,5,11287},{32289,18,8406},{32295,0,14207},
+{32297,10,8411},{32301,114,8414},{32332,0,11769},{32336,14,8443},
+{32340,5,5388},{32342,26,8447},{32350,22,8454},{32357,0,18130},
+{32359,6,8460},{32361,5,5548},{32363,22,8462},{32370,66,8468},
+{32390,0,13040},{32391,5,13037},{32394,22,8485},{32401,46,8491},
+{32415,0,18619},{32420,0,17755},{32428,0,17756},{32442,0,17757},
+{32455,0,17758},{32463,0,17759},{32479,0,17760},{32518,0,17761},
+{32566,18,8503},{32573,0,2913},{32574,5,8817},{32576,5,14208},
+{32579,10,8508},{32583,58,8511},{32600,0,7107},{32603,26,8526},
+{32611,0,8179},{32613,5,8819},{32615,5,9489},{32617,5,3781},
+{32619,14,8533},{32624,14,8537},{32629,22,8541},{32635,5,11303},
+{32637,10,8547},{32643,0,12518},{32645,42,8550},{32657,26,8561},
+{32666,6,8568},{32668,5,8181},{32670,0,2914},{32672,5,8822},
+{32674,30,8570},{32684,94,8578},{32709,0,2428},{32711,0,8189},
+{32713,0,8191},{32714,5,8184},{32716,14,8602},{32720,5,8187},
+{32722,0,2918},{32724,5,3356},{32727,0,8824},{32731,5,9495},
+{32733,10,8606},{32736,5,4207},{32738,5,10135},{32741,42,8609},
+{32752,5,4907},{32754,14,8620},{32759,5,12175},{32761,14,8624},
+{32765,5,12521},{32767,38,8628},{32779,10,8638},{32782,5,7112},
+{32784,10,8641},{32788,22,8644},{32795,26,8650},{32804,10,8657},
+{32808,10,8660},{32812,0,11781},{32814,14,8663},{32819,18,8667},
+{32825,0,7605},{32827,5,14231},{32829,10,8672},{32835,0,8196},
+{32838,10,8675},{32842,0,2920},{32847,5,8826},{32849,6,8678},
+{32852,0,18240},{32854,0,3787},{32856,0,3788},{32858,18,8680},
+{32865,14,8685},{32870,6,8689},{32876,0,11310},{32879,6,8691},
+{32881,5,5193},{32883,0,5197},{32885,18,8693},{32893,14,8698},
+{32898,0,7404},{32900,14,8702},{32905,6,8706},{32907,5,1027},
+{32911,6,8708},{32914,6,8710},{32917,6,8712},{32920,22,8714},
+{32927,0,17782},{32929,10,8720},{32933,0,1645},{32935,0,14240},
+{32937,10,8723},{32941,10,8726},{32945,6,8729},{32948,18,8731},
+{32954,0,1644},{32956,6,8736},{32962,0,7121},{32963,5,2014},
+{32965,22,8738},{32972,22,8744},{32980,42,8750},{32992,6,8761},
+{32995,14,8763},{33001,0,18244},{33004,6,8767},{33007,30,8769},
+{33016,26,8777},{33024,14,8784},{33029,22,8788},{33036,0,18246},
+{33038,0,18247},{33042,0,18248},{33044,30,8794},{33053,10,8802},
+{33057,18,8805},{33063,0,8208},{33065,18,8810},{33071,6,8815},
+{33074,0,15993},{33076,0,17900},{33079,0,15218},{33081,6,8817},
+{33085,6,8819},{33090,10,8821},{33094,10,8824},{33098,50,8827},
+{33113,5,18253},{33115,6,8840},{33118,0,9507},{33120,10,8842},
+{33124,14,8845},{33129,0,9502},{33131,38,8849},{33142,10,8859},
+{33145,5,3798},{33148,0,18256},{33151,6,8862},{33154,10,8864},
+{33158,30,8867},{33167,0,4215},{33171,0,17350},{33173,0,10705},
+{33175,14,8875},{33179,9,4586},{33182,10,8879},{33186,6,8882},
+{33189,30,8884},{33198,0,11313},{33200,30,8892},{33209,70,8900},
+{33228,6,8918},{33231,6,8920},{33233,5,12178},{33237,0,12525},
+{33239,18,8922},{33245,10,8927},{33248,5,13533},{33250,34,8930},
+{33260,14,8939},{33266,10,8943},{33270,0,15713},{33271,9,8840},
+{33274,10,8946},{33278,18,8949},{33284,6,8954},{33287,26,8956},
+{33296,10,8963},{33300,10,8966},{33304,0,14250},{33306,34,8969},
+{33317,6,8978},{33320,6,8980},{33322,5,2456},{33324,6,8982},
+{33327,0,7614},{33330,34,8984},{33340,5,8844},{33342,10,8993},
+{33346,0,9517},{33348,6,8996},{33351,0,3802},{33353,0,9514},
+{33355,0,4225},{33358,26,8998},{33365,9,11324},{33368,5,4916},
+{33370,10,9005},{33374,6,9008},{33377,22,9010},{33384,5,12829},
+{33387,18,9016},{33393,6,9021},{33396,50,9023},{33411,5,6373},
+{33413,0,6368},{33415,0,16690},{33418,6,9036},{33421,30,9038},
+{33432,14,9046},{33437,82,9050},{33459,54,9071},{33474,10,9085},
+{33482,0,18266},{33487,42,9088},{33499,6,9099},{33502,42,9101},
+{33514,126,9112},{33547,10,9144},{33558,34,9147},{33568,0,7637},
+{33570,0,7627},{33572,38,9156},{33583,0,7639},{33585,50,9166},
+{33599,26,9179},{33607,54,9186},{33622,6,9200},{33634,6,9202},
+{33638,0,15902},{33647,0,17765},{33651,22,9204},{33658,0,8222},
+{33659,5,2948},{33661,10,9210},{33665,0,8227},{33667,0,8234},
+{33669,102,9213},{33696,0,2946},{33698,42,9239},{33710,10,9250},
+{33721,0,17063},{33725,74,9253},{33745,0,8886},{33747,26,9272},
+{33755,42,9279},{33767,62,9290},{33784,30,9306},{33793,0,8865},
+{33795,18,9314},{33801,46,9319},{33814,0,16439},{33816,0,15994},
+{33819,6,9331},{33824,6,9333},{33827,6,9335},{33830,0,18136},
+{33833,0,9549},{33835,86,9337},{33858,50,9359},{33872,102,9372},
+{33899,62,9398},{33917,14,9414},{33922,0,3803},{33924,0,19103},
+{33926,0,9529},{33928,0,18274},{33933,94,9418},{33959,46,9442},
+{33972,0,10161},{33974,0,10181},{33976,42,9454},{33988,14,9465},
+{33993,46,9469},{34006,6,9481},{34010,6,9483},{34014,0,14314},
+{34017,6,9485},{34020,6,9487},{34023,5,10755},{34025,14,9489},
+{34030,26,9493},{34038,42,9500},{34050,98,9511},{34076,22,9536},
+{34083,34,9542},{34092,5,4596},{34094,14,9551},{34099,6,9555},
+{34104,0,18280},{34107,0,10717},{34109,6,9557},{34112,58,9559},
+{34129,42,9574},{34141,42,9585},{34152,5,4921},{34154,18,9596},
+{34159,5,18283},{34161,0,11345},{34163,0,14328},{34165,30,9601},
+{34174,0,5212},{34176,70,9609},{34195,70,9627},{34214,18,9645},
+{34223,10,9650},{34227,30,9653},{34237,50,9661},{34251,0,12194},
+{34253,22,9674},{34261,22,9680},{34268,30,9686},{34276,5,5560},
+{34278,0,12547},{34280,42,9694},{34294,50,9705},{34308,14,9718},
+{34313,18,9722},{34319,10,9727},{34323,6,9730},{34326,26,9732},
+{34334,50,9739},{34348,14,9752},{34353,10,9756},{34356,5,13223},
+{34358,0,13228},{34360,18,9759},{34366,10,9764},{34370,6,9767},
+{34373,0,15206},{34374,9,13535},{34379,14,9769},{34384,0,2047},
+{34386,18,9773},{34393,0,8251},{34395,6,9778},{34398,6,9780},
+{34401,18,9782},{34407,22,9787},{34413,5,6726},{34415,22,9793},
+{34423,0,7162},{34425,14,9799},{34430,0,14346},{34437,10,9803},
+{34442,18,9806},{34448,42,9811},{34460,10,9822},{34464,22,9825},
+{34471,14,9831},{34477,0,16134},{34479,46,9835},{34491,5,8266},
+{34493,5,8269},{34495,42,9847},{34507,6,9858},{34512,6,9860},
+{34515,6,9862},{34518,38,9864},{34530,10,9874},{34534,0,8902},
+{34536,22,9877},{34543,0,18289},{34549,26,9883},{34558,0,3828},
+{34560,6,9890},{34562,5,3830},{34564,42,9892},{34577,10,9903},
+{34584,18,9906},{34590,0,10197},{34592,22,9911},{34598,5,10216},
+{34600,10,9917},{34604,10,9920},{34608,22,9923},{34615,6,9929},
+{34618,10,9931},{34622,22,9934},{34630,0,10205},{34636,90,9940},
+{34659,5,10768},{34661,50,9963},{34675,34,9976},{34685,0,16453},
+{34689,34,9985},{34699,10,9994},{34703,0,11363},{34704,5,11375},
+{34706,10,9997},{34710,10,10000},{34714,22,10003},{34722,14,10009},
+{34729,118,10013},{34760,18,10043},{34766,0,16365},{34769,14,10048},
+{34774,74,10052},{34794,22,10071},{34802,14,10077},{34806,5,12554},
+{34809,14,10081},{34814,34,10085},{34824,22,10094},{34831,0,14353},
+{34832,5,12844},{34835,0,12847},{34836,5,5695},{34838,14,10100},
+{34843,10,10104},{34847,82,10107},{34869,18,10128},{34875,30,10133},
+{34883,5,7674},{34885,5,14358},{34888,0,8915},{34890,22,10141},
+{34898,6,10147},{34901,10,10149},{34905,10,10152},{34909,6,10155},
+{34912,22,10157},{34919,18,10163},{34925,22,10168},{34932,0,7686},
+{34933,5,7677},{34935,0,2489},{34937,0,2493},{34940,18,10174},
+{34945,5,2490},{34947,6,10179},{34951,10,10181},{34955,34,10184},
+{34965,54,10193},{34980,0,8286},{34983,6,10207},{34986,10,10209},
+{34990,0,18293},{34993,6,10212},{34996,5,14366},{34998,18,10214},
+{35004,18,10219},{35009,5,3410},{35013,0,14368},{35015,0,16049},
+{35017,14,10224},{35021,5,9593},{35023,6,10228},{35026,0,3844},
+{35028,46,10230},{35041,0,3841},{35046,10,10242},{35051,6,10245},
+{35054,10,10247},{35057,5,10225},{35059,62,10250},{35077,10,10266},
+{35081,14,10269},{35086,0,10810},{35088,6,10273},{35090,5,4622},
+{35092,10,10275},{35095,9,10804},{35098,0,4259},{35102,6,10278},
+{35105,26,10280},{35113,14,10287},{35117,5,11386},{35119,18,10291},
+{35125,14,10296},{35131,14,10300},{35137,14,10304},{35142,6,10308},
+{35145,0,12235},{35147,10,10310},{35151,0,12230},{35152,5,12233},
+{35154,10,10313},{35158,14,10316},{35162,5,12566},{35164,42,10320},
+{35177,26,10331},{35185,14,10338},{35190,6,10342},{35193,5,13538},
+{35195,6,10344},{35198,22,10346},{35205,26,10352},{35215,0,2973},
+{35217,0,18296},{35219,22,10359},{35227,18,10365},{35233,26,10370},
+{35241,6,10377},{35244,14,10379},{35250,0,5416},{35254,6,10383},
+{35257,6,10385},{35260,22,10387},{35270,0,17766},{35282,18,10393},
+{35289,0,8293},{35290,5,8935},{35292,6,10398},{35295,42,10400},
+{35307,10,10411},{35312,6,10414},{35314,5,11865},{35316,0,5417},
+{35318,10,10416},{35322,10,10419},{35326,10,10422},{35330,5,2056},
+{35332,0,7172},{35335,6,10425},{35338,0,2499},{35340,0,2497},
+{35342,22,10427},{35349,14,10433},{35355,18,10437},{35362,6,10442},
+{35365,0,2977},{35367,0,8296},{35369,18,10444},{35376,6,10449},
+{35380,0,3425},{35382,0,3427},{35384,38,10451},{35396,5,8944},
+{35398,0,3424},{35400,10,10461},{35404,26,10464},{35412,10,10471},
+{35415,5,8942},{35417,0,8940},{35419,0,3422},{35422,0,3418},
+{35424,14,10474},{35430,14,10478},{35435,14,10482},{35440,6,10486},
+{35442,5,3848},{35444,14,10488},{35449,14,10492},{35454,6,10496},
+{35457,26,10498},{35467,10,10505},{35471,30,10508},{35480,10,10516},
+{35484,0,14380},{35486,0,4263},{35488,6,10519},{35491,34,10521},
+{35503,6,10530},{35506,0,4633},{35508,0,18300},{35510,0,4640},
+{35512,34,10532},{35522,30,10541},{35531,10,10549},{35535,0,10818},
+{35537,10,10552},{35540,5,10823},{35542,50,10555},{35556,0,11404},
+{35558,10,10568},{35562,6,10571},{35565,26,10573},{35572,5,11400},
+{35574,26,10580},{35582,10,10587},{35585,5,4950},{35588,18,10590},
+{35594,90,10595},{35618,26,10618},{35626,30,10625},{35635,0,12239},
+{35637,10,10633},{35641,42,10636},{35653,34,10647},{35662,5,5577},
+{35664,42,10656},{35676,18,10667},{35682,6,10672},{35685,34,10674},
+{35695,6,10683},{35700,0,5775},{35703,10,10685},{35706,5,13076},
+{35709,38,10688},{35720,0,13376},{35722,10,10698},{35726,10,10701},
+{35730,6,10704},{35732,5,13468},{35734,0,5933},{35736,5,13543},
+{35738,10,10706},{35742,10,10709},{35774,0,17767},{35810,0,17768},
+{35895,0,1291},{35897,0,8299},{35899,18,10712},{35905,10,10717},
+{35909,50,10720},{35924,14,10733},{35930,0,2984},{35932,5,8301},
+{35935,0,8952},{35937,6,10737},{35940,10,10739},{35944,5,10250},
+{35946,14,10742},{35951,18,10746},{35957,26,10751},{35965,0,8303},
+{35968,10,10758},{35972,5,9630},{35974,0,9629},{35977,6,10761},
+{35980,6,10763},{35983,6,10765},{35985,5,11414},{35987,10,10767},
+{35991,38,10770},{36001,5,2508},{36003,10,10780},{36007,26,10783},
+{36015,6,10790},{36018,78,10792},{36039,5,3871},{36042,0,3870},
+{36044,6,10812},{36047,0,10253},{36049,5,4280},{36051,18,10814},
+{36057,34,10819},{36066,5,4652},{36068,30,10828},{36076,5,4650},
+{36078,0,11418},{36080,22,10836},{36087,30,10842},{36096,0,12264},
+{36098,14,10850},{36102,5,12595},{36104,22,10854},{36111,26,10860},
+{36118,5,5849},{36120,6,10867},{36123,10,10869},{36196,0,1295},
+{36198,6,10872},{36200,5,9633},{36203,22,10874},{36210,10,10880},
+{36214,22,10883},{36221,0,8305},{36224,10,10889},{36228,6,10892},
+{36233,6,10894},{36236,6,10896},{36238,5,9637},{36240,10,10898},
+{36243,5,9640},{36245,6,10901},{36249,0,4283},{36251,6,10903},
+{36255,10,10905},{36259,0,4659},{36261,42,10908},{36274,22,10919},
+{36281,6,10925},{36284,0,8308},{36286,22,10927},{36293,14,10933},
+{36299,26,10937},{36307,42,10944},{36319,22,10955},{36326,26,10961},
+{36334,26,10968},{36346,0,3883},{36348,46,10975},{36361,6,10987},
+{36365,98,10989},{36390,5,10859},{36392,14,11014},{36397,6,11018},
+{36400,6,11020},{36403,14,11022},{36408,10,11026},{36412,5,11432},
+{36414,18,11029},{36420,50,11034},{36435,18,11047},{36441,70,11052},
+{36460,6,11070},{36463,0,12606},{36465,30,11072},{36474,10,11080},
+{36478,0,17188},{36480,10,11083},{36484,42,11086},{36496,22,11097},
+{36502,5,13250},{36504,0,13379},{36506,0,13247},{36509,0,13473},
+{36510,9,13470},{36513,0,5961},{36515,42,11103},{36528,0,17385},
+{36530,0,3887},{36534,0,14431},{36537,6,11114},{36540,6,11116},
+{36544,0,5430},{36546,6,11118},{36553,26,11120},{36561,14,11127},
+{36567,6,11131},{36570,22,11133},{36576,5,8318},{36578,0,18313},
+{36580,10,11139},{36583,5,8983},{36585,0,8990},{36587,18,11142},
+{36593,6,11147},{36596,34,11149},{36606,22,11158},{36613,6,11164},
+{36615,5,9662},{36617,10,11166},{36621,6,11169},{36624,5,10269},
+{36626,14,11171},{36630,5,10874},{36632,34,11175},{36643,14,11184},
+{36649,6,11188},{36652,18,11190},{36658,30,11195},{36667,0,4967},
+{36670,30,11203},{36678,9,12279},{36681,10,11211},{36685,6,11214},
+{36687,5,12611},{36689,18,11216},{36694,5,12866},{36696,50,11221},
+{36710,5,17769},{36718,0,17771},{36755,0,18226},{36763,6,11234},
+{36767,6,11236},{36771,0,4290},{36773,14,11238},{36781,54,11242},
+{36795,5,15723},{36798,6,11256},{36801,6,11258},{36804,10,11260},
+{36809,58,11263},{36826,0,16331},{36832,26,11278},{36840,0,2073},
+{36842,6,11285},{36845,6,11287},{36848,0,2065},{36852,74,11289},
+{36872,0,16096},{36875,10,11308},{36879,14,11311},{36884,14,11315},
+{36889,46,11319},{36909,10,11331},{36913,30,11334},{36924,14,11342},
+{36929,6,11346},{36932,0,9668},{36934,6,11348},{36937,54,11350},
+{36952,6,11364},{36955,14,11366},{36960,18,11370},{36967,10,11375},
+{36971,22,11378},{36978,58,11384},{36993,5,5269},{36995,22,11399},
+{37002,5,5593},{37005,0,12871},{37007,10,11405},{37012,6,11408},
+{37015,5,6171},{37017,0,6170},{37019,0,6173},{37022,22,11410},
+{37029,14,11416},{37034,0,1309},{37038,34,11420},{37048,0,1682},
+{37051,0,15300},{37053,10,11429},{37057,0,2076},{37059,10,11432},
+{37063,6,11435},{37066,6,11437},{37070,0,2075},{37076,18,11439},
+{37081,5,7711},{37083,10,11444},{37087,26,11447},{37096,10,11454},
+{37099,5,8333},{37101,0,3014},{37103,10,11457},{37106,5,8330},
+{37108,6,11460},{37113,66,11462},{37131,0,9677},{37133,22,11479},
+{37140,0,9676},{37142,58,11485},{37158,10,11500},{37161,5,10883},
+{37163,38,11503},{37173,5,11451},{37176,6,11513},{37178,5,12284},
+{37182,14,11515},{37187,0,12872},{37188,5,13087},{37190,30,11519},
+{37198,5,7722},{37200,14,11527},{37205,22,11531},{37212,0,16199},
+{37214,30,11537},{37223,14,11545},{37228,0,3911},{37230,5,9679},
+{37232,0,16056},{37234,34,11549},{37244,0,16239},{37248,0,10894},
+{37249,5,10891},{37251,6,11558},{37253,5,10888},{37255,0,4688},
+{37257,26,11560},{37264,5,11454},{37266,6,11567},{37273,42,11569},
+{37285,0,12288},{37287,14,11580},{37291,5,5436},{37293,18,11584},
+{37298,5,12876},{37300,14,11589},{37305,22,11593},{37312,30,11599},
+{37321,0,3914},{37323,26,11607},{37331,30,11614},{37340,6,11622},
+{37343,0,17722},{37346,30,11624},{37354,5,8348},{37356,10,11632},
+{37361,0,8343},{37363,30,11635},{37373,54,11643},{37388,30,11657},
+{37396,5,3471},{37398,18,11665},{37404,0,9028},{37406,0,3475},
+{37409,0,18940},{37411,22,11670},{37418,6,11676},{37421,6,11678},
+{37424,42,11680},{37436,22,11691},{37444,10,11697},{37448,66,11700},
+{37466,6,11717},{37469,42,11719},{37483,22,11730},{37490,0,9706},
+{37494,102,11736},{37521,0,4318},{37523,42,11762},{37536,50,11773},
+{37550,0,18329},{37553,26,11786},{37561,14,11793},{37566,18,11797},
+{37571,5,10896},{37573,66,11802},{37591,10,11819},{37595,0,16396},
+{37597,18,11822},{37603,38,11827},{37614,18,11837},{37619,5,18333},
+{37622,58,11842},{37638,14,11857},{37643,22,11861},{37650,18,11867},
+{37656,14,11872},{37661,82,11876},{37683,14,11897},{37688,6,11901},
+{37692,0,11466},{37696,62,11903},{37712,5,11923},{37714,0,11933},
+{37716,34,11919},{37726,66,11928},{37744,6,11945},{37747,46,11947},
+{37760,42,11959},{37772,26,11970},{37780,90,11977},{37804,38,12000},
+{37815,6,12010},{37818,6,12012},{37821,0,14887},{37823,6,12014},
+{37826,10,12016},{37830,10,12019},{37834,70,12022},{37852,5,5602},
+{37854,26,12040},{37862,10,12047},{37868,0,12626},{37870,0,12633},
+{37872,6,12050},{37875,58,12052},{37891,6,12067},{37894,78,12069},
+{37915,0,16712},{37917,0,18342},{37920,0,12881},{37924,62,12089},
+{37941,46,12105},{37954,22,12117},{37960,5,13262},{37962,5,13257},
+{37964,6,12123},{37967,6,12125},{37969,5,5856},{37972,6,12127},
+{37975,6,12129},{37979,0,14495},{37981,6,12131},{37984,0,5902},
+{37986,14,12133},{37991,0,15032},{37992,5,13478},{37994,62,12137},
+{38011,6,12153},{38013,5,5981},{38015,0,5988},{38016,5,13625},
+{38018,6,12155},{38021,0,17671},{38047,0,18565},{38050,0,17691},
+{38081,0,18401},{38083,0,18399},{38108,0,18391},{38134,0,18386},
+{38189,0,18348},{38215,0,18623},{38263,6,12157},{38266,14,12159},
+{38271,6,12163},{38274,6,12165},{38277,6,12167},{38280,6,12169},
+{38283,38,12171},{38294,14,12181},{38299,6,12185},{38302,38,12187},
+{38312,5,4320},{38314,18,12197},{38320,6,12202},{38325,10,12204},
+{38329,5,11500},{38331,22,12207},{38339,0,11947},{38341,18,12213},
+{38346,9,5290},{38349,0,11498},{38352,6,12218},{38354,5,12317},
+{38356,10,12220},{38362,5,12643},{38364,0,5611},{38366,30,12223},
+{38376,0,17674},{38388,0,18351},{38428,10,12231},{38432,18,12234},
+{38440,0,6385},{38442,0,1318},{38444,30,12239},{38456,22,12247},
+{38463,26,12253},{38474,0,7194},{38475,9,2083},{38478,14,12260},
+{38483,6,12264},{38486,0,15847},{38488,0,2545},{38491,18,12266},
+{38497,0,2541},{38498,5,2539},{38500,0,2544},{38505,18,12271},
+{38511,26,12276},{38518,5,3031},{38520,0,3028},{38523,14,12283},
+{38528,6,12287},{38531,6,12289},{38533,5,3491},{38535,0,9038},
+{38536,5,9040},{38538,6,12291},{38541,10,12293},{38545,0,9718},
+{38546,5,9716},{38548,5,3934},{38550,14,12296},{38555,6,12300},
+{38558,0,10322},{38561,18,12302},{38567,5,4998},{38569,6,12307},
+{38572,0,11952},{38574,0,11950},{38576,6,12309},{38579,6,12311},
+{38582,0,561},{38584,6,12313},{38587,10,12315},{38591,26,12318},
+{38598,5,3499},{38600,0,9045},{38601,5,3938},{38603,14,12325},
+{38610,54,12329},{38625,10,12343},{38629,0,13480},{38632,10,12346},
+{38639,14,12349},{38644,30,12353},{38653,0,9722},{38655,6,12361},
+{38658,14,12363},{38662,5,4707},{38664,6,12367},{38667,0,11508},
+{38669,26,12369},{38678,0,5004},{38680,6,12376},{38683,62,12378},
+{38699,5,12647},{38702,5,12911},{38704,10,12394},{38708,10,12397},
+{38712,5,5793},{38714,0,13106},{38717,5,5858},{38719,22,12400},
+{38726,22,12406},{38737,6,12412},{38741,14,12414},{38746,0,10940},
+{38747,5,5008},{38749,22,12418},{38758,0,5010},{38760,10,12424},
+{38764,10,12427},{38768,18,12430},{38774,0,3946},{38775,5,9726},
+{38778,46,12435},{38791,18,12447},{38797,10,12452},{38804,0,11513},
+{38807,62,12455},{38824,0,12332},{38826,18,12471},{38833,14,12476},
+{38838,22,12480},{38845,26,12486},{38852,5,13388},{38854,14,12493},
+{38859,22,12497},{38866,30,12503},{38876,0,5617},{38877,9,12654},
+{38880,6,12511},{38883,0,13266},{38885,6,12513},{38893,6,12515},
+{38896,14,12517},{38901,6,12521},{38904,14,12523},{38909,5,12915},
+{38911,10,12527},{38914,5,3039},{38916,0,8363},{38917,5,3504},
+{38919,6,12530},{38922,0,3950},{38924,0,3952},{38925,5,9730},
+{38927,0,9729},{38928,5,3947},{38930,18,12532},{38935,5,4334},
+{38939,26,12537},{38947,6,12544},{38950,14,12546},{38955,0,4715},
+{38957,14,12550},{38962,14,12554},{38967,10,12558},{38971,0,5014},
+{38977,0,11966},{38979,50,12561},{38992,9,12343},{38995,0,5468},
+{38998,14,12574},{39003,22,12578},{39010,5,12918},{39012,34,12584},
+{39023,14,12593},{39027,5,13607},{39029,0,17677},{39080,6,12597},
+{39084,0,9732},{39085,5,10339},{39087,0,4336},{39089,14,12599},
+{39094,42,12603},{39105,5,12921},{39107,6,12614},{39110,26,12616},
+{39118,0,17678},{39131,6,12623},{39134,22,12625},{39141,10,12631},
+{39145,18,12634},{39151,0,3509},{39153,6,12639},{39156,10,12641},
+{39161,6,12644},{39164,0,3953},{39165,5,3955},{39168,0,10342},
+{39170,6,12646},{39173,0,4339},{39175,14,12648},{39180,0,4340},
+{39182,0,17389},{39184,22,12652},{39190,5,10959},{39192,18,12658},
+{39198,6,12663},{39201,0,5023},{39204,6,12665},{39207,14,12667},
+{39211,5,11973},{39213,26,12671},{39221,0,5304},{39223,26,12678},
+{39230,5,5470},{39232,14,12685},{39237,0,5623},{39239,30,12689},
+{39248,38,12697},{39259,18,12707},{39265,10,12712},{39318,14,12715},
+{39323,14,12719},{39329,0,11984},{39331,10,12723},{39334,5,12668},
+{39336,0,5722},{39338,46,12726},{39352,22,12738},{39361,18,12744},
+{39367,0,10352},{39369,0,10968},{39371,30,12749},{39379,5,10965},
+{39381,34,12757},{39391,34,12766},{39401,6,12775},{39404,10,12777},
+{39408,6,12780},{39412,34,12782},{39421,5,11993},{39423,0,5306},
+{39425,26,12791},{39433,34,12798},{39444,10,12807},{39449,58,12810},
+{39465,38,12825},{39476,74,12835},{39496,10,12854},{39500,18,12857},
+{39506,0,13280},{39507,5,13273},{39509,18,12862},{39514,5,5907},
+{39516,0,15384},{39518,10,12867},{39522,14,12870},{39526,5,13613},
+{39528,18,12874},{39567,0,17798},{39592,0,2550},{39595,0,9740},
+{39597,0,9739},{39599,5,4343},{39601,14,12879},{39606,50,12883},
+{39622,6,12896},{39626,0,12940},{39629,0,13123},{39631,14,12898},
+{39635,5,5910},{39637,14,12902},{39644,0,12361},{39647,18,12906},
+{39654,6,12911},{39659,10,12913},{39662,5,4731},{39665,14,12916},
+{39670,6,12920},{39673,26,12922},{39681,10,12929},{39684,5,12363},
+{39686,0,5478},{39688,42,12932},{39700,10,12943},{39703,5,13125},
+{39705,6,12946},{39710,9,13393},{39714,14,12948},{39719,18,12952},
+{39725,10,12957},{39729,18,12960},{39735,0,12688},{39737,14,12965},
+{39742,5,10356},{39744,0,14613},{39745,5,4346},{39747,14,12969},
+{39752,0,12002},{39754,34,12973},{39764,10,12982},{39768,14,12985},
+{39775,0,10360},{39776,5,10358},{39780,0,10990},{39782,14,12989},
+{39788,0,10991},{39791,10,12993},{39796,14,12996},{39802,38,13000},
+{39813,14,13010},{39819,0,16110},{39821,26,13014},{39829,0,11553},
+{39831,0,16241},{39834,6,13021},{39837,22,13023},{39844,10,13029},
+{39848,0,12004},{39850,6,13032},{39853,14,13034},{39861,6,13038},
+{39864,6,13040},{39869,0,12381},{39871,10,13042},{39875,6,13045},
+{39878,18,13047},{39887,0,15420},{39891,18,13052},{39897,22,13057},
+{39904,10,13063},{39908,22,13066},{39914,5,12689},{39916,6,13072},
+{39920,6,13074},{39924,0,18376},{39927,6,13076},{39933,0,5484},
+{39935,0,14619},{39938,0,14618},{39941,38,13078},{39952,0,15418},
+{39954,14,13088},{39959,0,12955},{39963,10,13092},{39967,10,13095},
+{39971,14,13098},{39976,5,13135},{39979,18,13102},{39985,26,13107},
+{39993,34,13114},{40004,10,13123},{40008,34,13126},{40018,30,13135},
+{40029,14,13143},{40034,6,13147},{40038,10,13149},{40045,6,13152},
+{40049,18,13154},{40055,5,5984},{40057,14,13159},{40165,10,13163},
+{40169,6,13166},{40173,0,9743},{40177,5,10361},{40179,18,13168},
+{40185,18,13173},{40191,6,13178},{40194,30,13180},{40204,0,15430},
+{40208,0,11565},{40210,0,5038},{40212,22,13188},{40219,0,5039},
+{40221,26,13194},{40229,6,13201},{40232,6,13203},{40237,0,12032},
+{40238,5,12019},{40240,6,13205},{40243,6,13207},{40246,14,13209},
+{40251,0,5311},{40253,18,13213},{40258,5,12025},{40260,6,13218},
+{40265,14,13220},{40270,26,13224},{40278,46,13231},{40295,50,13243},
+{40308,5,12719},{40311,10,13256},{40315,62,13259},{40331,5,12715},
+{40336,0,12964},{40338,10,13275},{40342,62,13278},{40358,5,12980},
+{40360,22,13294},{40367,0,5809},{40369,30,13300},{40377,5,13152},
+{40379,42,13308},{40391,98,13319},{40417,22,13344},{40424,6,13350},
+{40427,22,13352},{40434,26,13358},{40441,5,5947},{40443,18,13365},
+{40448,5,13501},{40450,22,13370},{40457,50,13376},{40471,34,13389},
+{40565,0,3043},{40569,10,13398},{40572,5,5949},{40575,26,13401},
+{40582,5,11569},{40584,26,13408},{40592,74,13415},{40612,54,13434},
+{40628,14,13448},{40635,38,13452},{40646,10,13462},{40652,22,13465},
+{40659,6,13471},{40661,5,11573},{40664,0,5040},{40666,6,13473},
+{40668,5,5316},{40670,10,13475},{40674,0,18392},{40676,18,13478},
+{40683,0,13164},{40685,18,13483},{40690,5,13427},{40692,58,13488},
+{40710,18,13503},{40718,0,3963},{40719,5,11006},{40722,6,13508},
+{40725,30,13510},{40734,0,13508},{40736,0,3965},{40738,94,13518},
+{40763,0,4352},{40765,6,13542},{40768,5,12737},{40770,58,13544},
+{40786,14,13559},{40790,9,12740},{40793,50,13563},{40806,5,5817},
+{40809,14,13576},{40814,5,13438},{40816,10,13580},{40820,9,13510},
+{40823,18,13583},{40830,6,13588},{40845,6,13590},{40848,10,13592},
+{40852,22,13595},{40860,0,5043},{40863,6,13601},{40866,0,13325},
+{40868,34,13603},{40877,5,18960},{40879,18,13612},{40903,18,13617},
+{56320,10,13622},{56322,6,13625},{56323,6,13627},{56324,0,17033},
+{56326,0,18531},{56326,0,15843},{56329,0,15286},{56329,0,18576},
+{56329,0,18598},{56331,0,17848},{56333,6,13629},{56336,0,14522},
+{56336,6,13631},{56337,6,13633},{56338,0,15196},{56338,0,15825},
+{56338,6,13635},{56339,6,13637},{56340,0,14424},{56340,0,18095},
+{56342,0,16592},{56345,0,18519},{56348,0,17860},{56348,6,13639},
+{56349,0,14561},{56349,5,17924},{56350,10,13641},{56352,0,15886},
+{56352,6,13644},{56353,0,16211},{56353,0,19091},{56353,10,13646},
+{56355,0,18577},{56355,6,13649},{56356,6,13651},{56357,6,13653},
+{56358,10,13655},{56360,6,13658},{56361,0,14193},{56361,6,13660},
+{56362,6,13662},{56363,6,13664},{56364,6,13666},{56367,6,13668},
+{56368,0,15925},{56370,6,13670},{56371,6,13672},{56372,10,13674},
+{56376,6,13677},{56377,0,16971},{56377,6,13679},{56378,0,17941},
+{56378,0,14998},{56378,6,13681},{56379,0,18728},{56379,0,15786},
+{56379,0,15311},{56379,18,13683},{56383,0,15209},{56383,6,13688},
+{56384,0,15490},{56384,6,13690},{56385,18,13692},{56389,6,13697},
+{56390,0,18520},{56390,0,18750},{56390,0,19069},{56392,0,16071},
+{56392,0,18578},{56392,10,13699},{56394,6,13702},{56395,6,13704},
+{56398,10,13706},{56400,10,13709},{56402,0,15570},{56402,0,17227},
+{56402,6,13712},{56403,10,13714},{56405,0,17886},{56407,0,14192},
+{56407,0,17149},{56407,6,13717},{56410,6,13719},{56411,14,13721},
+{56414,18,13725},{56418,6,13730},{56419,6,13732},{56420,6,13734},
+{56421,0,18417},{56421,0,18696},{56421,6,13736},{56424,0,14218},
+{56424,6,13738},{56428,0,14555},{56428,0,18991},{56428,0,17801},
+{56430,0,18521},{56430,6,13740},{56431,6,13742},{56432,6,13744},
+{56433,6,13746},{56434,6,13748},{56435,0,14702},{56435,0,15882},
+{56435,0,18851},{56437,10,13750},{56439,0,17852},{56439,6,13753},
+{56440,0,17916},{56440,6,13755},{56443,0,17328},{56443,14,13757},
+{56446,0,18772},{56446,18,13761},{56450,0,15654},{56450,6,13766},
+{56451,0,18784},{56451,6,13768},{56452,0,18538},{56452,6,13770},
+{56453,6,13772},{56454,6,13774},{56455,0,16441},{56455,0,15011},
+{56455,6,13776},{56456,0,18478},{56456,0,15499},{56456,0,18539},
+{56456,0,16719},{56456,0,14335},{56456,10,13778},{56458,0,14249},
+{56458,6,13781},{56459,0,14752},{56459,10,13783},{56461,0,14841},
+{56461,6,13786},{56462,0,14959},{56464,6,13788},{56465,0,16923},
+{56465,0,16969},{56465,10,13790},{56467,6,13793},{56468,0,16715},
+{56470,0,16013},{56470,6,13795},{56471,14,13797},{56474,0,15024},
+{56474,6,13801},{56475,10,13803},{56477,0,17115},{56477,6,13806},
+{56478,6,13808},{56479,10,13810},{56481,6,13813},{56482,10,13815},
+{56484,0,15518},{56484,0,18557},{56484,6,13818},{56485,6,13820},
+{56489,0,17192},{56492,6,13822},{56493,0,18745},{56493,10,13824},
+{56495,6,13827},{56496,6,13829},{56497,6,13831},{56498,0,17668},
+{56500,6,13833},{56501,10,13835},{56503,0,14546},{56503,0,15963},
+{56503,6,13838},{56504,6,13840},{56505,0,14639},{56508,0,19141},
+{56508,0,14547},{56508,6,13842},{56509,6,13844},{56510,6,13846},
+{56511,6,13848},{56512,0,14322},{56512,0,15508},{56512,6,13850},
+{56513,0,19143},{56513,0,16772},{56513,10,13852},{56517,10,13855},
+{56519,0,17275},{56519,0,18738},{56519,6,13858},{56520,0,16409},
+{56520,0,15386},{56520,6,13860},{56521,0,19144},{56521,0,17857},
+{56521,0,16917},{56521,0,14845},{56521,6,13862},{56522,10,13864},
+{56524,6,13867},{56525,0,14338},{56525,0,17289},{56525,10,13869},
+{56527,10,13872},{56529,0,14718},{56529,0,15216},{56529,6,13875},
+{56530,6,13877},{56531,0,17330},{56531,10,13879},{56533,6,13882},
+{56534,0,15505},{56534,6,13884},{56535,10,13886},{56537,0,15079},
+{56537,6,13889},{56538,6,13891},{56541,6,13893},{56545,0,14751},
+{56545,0,14132},{56545,0,14626},{56548,0,14830},{56548,6,13895},
+{56549,0,14524},{56549,0,17172},{56551,6,13897},{56552,6,13899},
+{56553,6,13901},{56556,0,19042},{56556,6,13903},{56557,0,16419},
+{56557,0,16845},{56557,6,13905},{56560,6,13907},{56561,10,13909},
+{56563,6,13912},{56564,0,18581},{56565,5,17926},{56567,6,13914},
+{56568,0,14348},{56570,0,14685},{56570,10,13916},{56572,0,16446},
+{56572,6,13919},{56573,6,13921},{56574,0,18697},{56574,0,14154},
+{56574,6,13923},{56575,0,15794},{56575,10,13925},{56577,10,13928},
+{56579,0,18528},{56579,0,18743},{56579,5,14898},{56580,6,13931},
+{56581,0,18917},{56581,10,13933},{56583,6,13936},{56584,6,13938},
+{56588,0,17614},{56588,0,16915},{56588,6,13940},{56589,0,19098},
+{56589,6,13942},{56590,10,13944},{56592,6,13947},{56593,6,13949},
+{56594,0,18482},{56594,6,13951},{56595,0,17092},{56597,0,17164},
+{56597,6,13953},{56598,14,13955},{56601,0,18500},{56601,0,18721},
+{56603,6,13959},{56608,6,13961},{56609,6,13963},{56610,0,18713},
+{56610,6,13965},{56611,0,18718},{56611,6,13967},{56612,10,13969},
+{56614,0,18550},{56614,0,15652},{56614,6,13972},{56615,0,14579},
+{56615,6,13974},{56616,10,13976},{56618,6,13979},{56622,6,13981},
+{56623,0,15299},{56623,0,18668},{56623,0,15434},{56623,6,13983},
+{56624,0,14265},{56624,6,13985},{56625,10,13987},{56627,0,14470},
+{56627,6,13990},{56628,0,15318},{56628,6,13992},{56633,0,17863},
+{56633,0,18551},{56635,0,18441},{56635,6,13994},{56636,6,13996},
+{56637,0,17957},{56637,6,13998},{56638,6,14000},{56639,0,15816},
+{56639,6,14002},{56640,0,16978},{56640,14,14004},{56643,6,14008},
+{56644,0,17210},{56644,6,14010},{56645,6,14012},{56646,0,18732},
+{56646,6,14014},{56647,0,17871},{56647,6,14016},{56648,0,17917},
+{56648,0,18660},{56648,0,15822},{56648,6,14018},{56649,0,15928},
+{56649,0,18612},{56652,0,15144},{56652,6,14020},{56653,6,14022},
+{56654,6,14024},{56655,0,18470},{56655,10,14026},{56657,0,17664},
+{56657,0,15653},{56659,0,19089},{56659,6,14029},{56660,0,16644},
+{56660,10,14031},{56662,0,18592},{56662,5,16976},{56664,10,14034},
+{56666,0,14202},{56666,6,14037},{56667,0,15582},{56667,0,14975},
+{56667,0,15517},{56667,6,14039},{56668,0,14735},{56668,6,14041},
+{56669,0,17179},{56669,6,14043},{56670,0,18523},{56670,6,14045},
+{56673,6,14047},{56674,10,14049},{56676,6,14052},{56677,6,14054},
+{56678,6,14056},{56679,0,14952},{56679,0,18492},{56679,6,14058},
+{56682,0,18452},{56682,10,14060},{56684,6,14063},{56687,0,18423},
+{56687,18,14065},{56691,6,14070},{56692,0,17019},{56692,0,18956},
+{56692,6,14072},{56693,10,14074},{56695,14,14077},{56698,0,15908},
+{56698,10,14081},{56700,0,14894},{56700,6,14084},{56701,6,14086},
+{56702,0,17934},{56702,0,14687},{56702,5,17884},{56703,6,14088},
+{56704,0,18872},{56704,10,14090},{56706,0,14983},{56706,10,14093},
+{56708,0,17845},{56711,6,14096},{56712,6,14098},{56713,0,17384},
+{56713,18,14100},{56717,0,17238},{56717,6,14105},{56718,6,14107},
+{56719,0,16750},{56719,0,14973},{56719,0,14407},{56719,6,14109},
+{56722,6,14111},{56723,6,14113},{56724,6,14115},{56725,6,14117},
+{56726,0,16511},{56726,0,14893},{56728,0,14412},{56728,6,14119},
+{56729,0,19139},{56729,0,17299},{56731,6,14121},{56732,0,15451},
+{56732,10,14123},{56736,0,18680},{56736,0,15213},{56736,0,16853},
+{56736,6,14126},{56737,10,14128},{56739,0,18669},{56739,0,14284},
+{56739,6,14131},{56740,0,17922},{56740,0,16914},{56740,0,16440},
+{56740,0,15442},{56740,5,16821},{56741,0,16660},{56741,0,16585},
+{56741,10,14133},{56743,0,14264},{56743,6,14136},{56744,0,14909},
+{56744,6,14138},{56745,10,14140},{56747,0,15088},{56747,0,15907},
+{56747,6,14143},{56748,0,14829},{56748,6,14145},{56749,0,18746},
+{56749,6,14147},{56750,6,14149},{56751,6,14151},{56754,0,18424},
+{56754,0,18535},{56754,6,14153},{56755,10,14155},{56757,0,15921},
+{56757,6,14158},{56758,6,14160},{56759,0,15514},{56759,6,14162},
+{56760,0,15401},{56760,0,17171},{56760,0,18593},{56760,6,14164},
+{56761,0,15519},{56761,0,14476},{56761,0,19124},{56761,6,14166},
+{56762,0,15147},{56762,6,14168},{56763,0,14446},{56763,6,14170},
+{56764,0,14427},{56764,0,16552},{56764,6,14172},{56765,18,14174},
+{56769,10,14179},{56771,0,15799},{56771,0,18614},{56773,6,14182},
+{56776,0,18425},{56776,0,16831},{56776,6,14184},{56777,6,14186},
+{56778,14,14188},{56781,0,16844},{56781,0,18859},{56781,14,14192},
+{56784,6,14196},{56788,0,15153},{56788,6,14198},{56789,0,15554},
+{56789,0,14539},{56791,0,15365},{56791,0,14421},{56793,10,14200},
+{56795,6,14203},{56796,0,15279},{56796,6,14205},{56797,6,14207},
+{56798,6,14209},{56799,0,16783},{56799,6,14211},{56800,0,17137},
+{56800,14,14213},{56803,0,14951},{56803,0,17865},{56803,6,14217},
+{56804,14,14219},{56807,0,15103},{56807,5,18594},{56808,10,14223},
+{56810,0,17181},{56810,6,14226},{56811,0,14991},{56811,0,17908},
+{56811,0,16928},{56811,14,14228},{56816,0,15444},{56818,0,16228},
+{56818,6,14232},{56819,6,14234},{56820,10,14236},{56822,6,14239},
+{56823,5,16818},{56824,0,14267},{56824,6,14241},{56825,0,16922},
+{56825,0,15174},{56825,6,14243},{56826,6,14245},{56827,6,14247},
+{56828,6,14249},{56829,14,14251},{56832,0,15447},{56832,6,14255},
+{56836,0,16656},{56836,6,14257},{56837,6,14259},{56838,6,14261},
+{56839,0,14008},{56839,14,14263},{56842,0,15896},{56842,10,14267},
+{56844,6,14270},{56845,6,14272},{56846,0,14793},{56846,0,15204},
+{56846,6,14274},{56847,0,14982},{56847,0,18747},{56847,10,14276},
+{56849,0,15855},{56849,0,17929},{56849,6,14279},{56850,0,17663},
+{56850,6,14281},{56851,10,14283},{56853,6,14286},{56854,10,14288},
+{56856,6,14291},{56857,6,14293},{56858,0,18494},{56858,6,14295},
+{56859,0,15354},{56859,0,15232},{56859,6,14297},{56860,6,14299},
+{56864,0,17122},{56864,6,14301},{56865,10,14303},{56867,10,14306},
+{56869,0,14723},{56869,0,14332},{56869,6,14309},{56870,10,14311},
+{56872,6,14314},{56873,6,14316},{56874,14,14318},{56877,0,15609},
+{56877,0,18553},{56877,6,14322},{56878,6,14324},{56879,6,14326},
+{56880,6,14328},{56881,6,14330},{56882,0,15814},{56882,0,18863},
+{56882,6,14332},{56883,6,14334},{56884,0,14980},{56884,10,14336},
+{56886,0,16726},{56886,6,14339},{56889,0,19051},{56889,0,14805},
+{56889,0,17292},{56889,0,16332},{56891,0,17282},{56891,6,14341},
+{56892,10,14343},{56894,0,15534},{56894,0,15961},{56896,0,15452},
+{56898,0,18485},{56898,0,15322},{56898,0,15225},{56898,10,14346},
+{56900,6,14349},{56901,0,15787},{56901,0,16633},{56901,18,14351},
+{56905,6,14356},{56906,0,16869},{56906,6,14358},{56907,0,18102},
+{56907,10,14360},{56909,10,14363},{56911,0,18129},{56911,6,14366},
+{56912,0,15569},{56912,0,17921},{56912,6,14368},{56913,0,14774},
+{56913,22,14370},{56918,0,19028},{56918,0,15697},{56918,0,18740},
+{56918,14,14376},{56921,0,15688},{56921,0,14384},{56921,10,14380},
+{56923,0,17288},{56925,10,14383},{56929,0,14217},{56929,10,14386},
+{56933,0,14940},{56933,0,14253},{56933,6,14389},{56934,0,15537},
+{56934,6,14391},{56935,6,14393},{56936,0,14621},{56938,6,14395},
+{56941,10,14397},{56945,14,14400},{56948,6,14404},{56949,6,14406},
+{56950,0,16015},{56950,6,14408},{56951,0,18748},{56951,0,16992},
+{56951,0,18725},{56951,6,14410},{56952,0,14946},{56952,0,16608},
+{56952,6,14412},{56953,0,17072},{56953,6,14414},{56954,0,18100},
+{56954,10,14416},{56956,0,18465},{56956,0,17943},{56960,6,14419},
+{56961,0,18646},{56961,6,14421},{56962,6,14423},{56963,0,14876},
+{56963,6,14425},{56964,0,15443},{56964,6,14427},{56968,0,18648},
+{56968,6,14429},{56969,0,14968},{56969,6,14431},{56970,0,16569},
+{56970,6,14433},{56971,0,14283},{56971,0,18984},{56971,6,14435},
+{56972,0,17070},{56974,0,19131},{56978,6,14437},{56979,0,18634},
+{56979,6,14439},{56980,6,14441},{56981,0,14254},{56981,0,18925},
+{56981,6,14443},{56982,0,17880},{56982,6,14445},{56983,6,14447},
+{56984,6,14449},{56985,0,18518},{56985,10,14451},{56987,6,14454},
+{56988,10,14456},{56990,10,14459},{56994,0,16017},{56996,0,16682},
+{56996,6,14462},{56997,0,15934},{56997,6,14464},{56998,0,16464},
+{56998,6,14466},{56999,0,15810},{56999,6,14468},{57000,6,14470},
+{57001,6,14472},{57002,6,14474},{57003,0,14962},{57003,6,14476},
+{57004,0,17124},{57004,0,17084},{57004,6,14478},{57005,10,14480},
+{57007,6,14483},{57008,6,14485},{57009,6,14487},{57010,0,16092},
+{57010,0,19071},{57010,0,17059},{57010,6,14489},{57011,0,15529},
+{57011,6,14491},{57012,10,14493},{57014,0,18672},{57014,18,14496},
+{57018,0,18659},{57018,0,15116},{57018,10,14501},{57020,0,15171},
+{57020,6,14504},{57021,10,14506},{57023,0,14806},{57023,6,14509},
+{57024,0,14721},{57024,0,18513},{57024,6,14511},{57025,6,14513},
+{57026,6,14515},{57030,6,14517},{57031,14,14519},{57034,14,14523},
+{57037,14,14527},{57040,6,14531},{57041,6,14533},{57042,6,14535},
+{57043,6,14537},{57044,6,14539},{57045,0,18459},{57045,0,18473},
+{57045,10,14541},{57047,0,14123},{57047,0,18739},{57047,6,14544},
+{57048,0,17938},{57048,0,18655},{57048,14,14546},{57053,10,14550},
+{57055,0,15641},{57055,0,15065},{57055,0,16858},{57055,6,14553},
+{57056,6,14555},{57057,6,14557},{57058,0,16005},{57058,6,14559},
+{57059,0,15130},{57059,0,15099},{57061,0,16447},{57061,6,14561},
+{57062,0,17804},{57062,0,18564},{57062,6,14563},{57063,6,14565},
+{57064,0,18474},{57064,6,14567},{57065,6,14569},{57070,0,14739},
+{57070,0,14895},{57070,6,14571},{57076,0,18667},{57076,10,14573},
+{57078,10,14576},{57080,0,15058},{57080,6,14579},{57081,6,14581},
+{57082,0,14860},{57082,0,18138},{57082,0,15136},{57082,6,14583},
+{57083,0,14714},{57083,6,14585},{57084,0,16902},{57084,0,18544},
+{57084,0,15308},{57086,0,17332},{57086,10,14587},{57090,6,14590},
+{57091,10,14592},{57093,0,14285},{57093,6,14595},{57094,0,14573},
+{57094,0,15379},{57094,0,18586},{57098,0,14779},{57098,0,14527},
+{57098,14,14597},{57101,0,16548},{57101,6,14601},{57102,0,18475},
+{57102,0,18751},{57102,0,14153},{57102,6,14603},{57103,0,19083},
+{57103,0,14369},{57103,18,14605},{57107,0,16485},{57107,0,14461},
+{57107,10,14610},{57109,6,14613},{57110,0,17224},{57112,0,15711},
+{57112,0,15914},{57114,0,19033},{57114,0,15046},{57114,6,14615},
+{57117,0,15506},{57117,0,16792},{57119,0,15404},{57119,6,14617},
+{57120,6,14619},{57121,6,14621},{57122,6,14623},{57123,0,18621},
+{57125,0,18068},{57125,0,14451},{57125,0,15053},{57125,6,14625},
+{57126,0,16497},{57126,0,14741},{57128,0,16670},{57130,14,14627},
+{57133,0,16471},{57133,6,14631},{57134,6,14633},{57135,0,18509},
+{57135,0,18587},{57135,6,14635},{57136,6,14637},{57137,6,14639},
+{57140,6,14641},{57141,0,16133},{57141,6,14643},{57142,0,15684},
+{57144,10,14645},{57146,0,15659},{57146,0,14386},{57146,6,14648},
+{57147,10,14650},{57151,0,18476},{57151,0,14750},{57153,0,17169},
+{57153,0,18054},{57153,0,15515},{57153,0,15129},{57155,14,14653},
+{57158,10,14657},{57160,0,15186},{57162,6,14660},{57163,6,14662},
+{57164,0,18754},{57164,0,17231},{57166,0,15801},{57168,0,17889},
+{57168,6,14664},{57169,0,16907},{57169,6,14666},{57170,6,14668},
+{57175,0,15470},{57178,10,14670},{57182,0,17303},{57185,10,14673},
+{57187,6,14676},{57188,0,14648},{57188,6,14678},{57189,0,19134},
+{57189,0,14436},{57189,6,14680},{57190,0,16581},{57194,0,16731},
+{57194,0,14941},{57196,0,18711},{57196,6,14682},{57197,6,14684},
+{57198,22,14686},{57203,6,14692},{57204,0,18486},{57204,0,17956},
+{57204,6,14694},{57205,0,17257},{57205,6,14696},{57209,0,15805},
+{57213,10,14698},{57215,6,14701},{57216,6,14703},{57217,0,15110},
+{57217,6,14705},{57218,0,17090},{57218,0,15439},{57220,10,14707},
+{57225,6,14710},{57228,14,14712},{57231,0,18091},{57231,0,15052},
+{57231,6,14716},{57238,0,19029},{57238,0,18504},{57238,6,14718},
+{57239,10,14720},{57241,6,14723},{57242,0,14345},{57244,0,15596},
+{57244,0,16837},{57244,6,14725},{57245,10,14727},{57247,10,14730},
+{57249,6,14733},{57255,10,14735},{57257,0,18699},{57257,0,17716},
+{57259,0,14913},{57261,0,17882},{57264,14,14738},{57267,0,15170},
+{57267,0,18702},{57267,6,14742},{57268,0,14276},{57268,0,16743},
+{57268,0,16443},{57268,0,16973},{57268,0,14158},{57268,6,14744},
+{57269,0,17932},{57269,0,15493},{57269,10,14746},{57271,10,14749},
+{57276,0,18432},{57276,6,14752},{57277,6,14754},{57278,10,14756},
+{57280,6,14759},{57281,6,14761},{57282,0,16840},{57282,0,18678},
+{57282,6,14763},{57285,0,15900},{57285,0,16398},{57285,0,15360},
+{57285,6,14765},{57286,0,14726},{57286,6,14767},{57287,0,18526},
+{57289,10,14769},{57291,6,14772},{57292,0,15819},{57292,0,16362},
+{57292,10,14774},{57296,0,16720},{57300,0,18597},{57300,6,14777},
+{57301,10,14779},{57303,0,15448},{57303,0,14878},{57305,0,15536},
+{57305,6,14782},{57306,10,14784},{57310,0,18491},{57310,0,15655},
+{57310,6,14787},{57311,0,18134},{57311,0,15342},{57311,6,14789},
+{57312,6,14791},{57313,6,14793},{57314,10,14795},{57318,10,14798},
+{57320,0,18480},{57320,6,14801},{57321,6,14803},{57322,0,15323},
+{57322,6,14805},{57323,0,18679},{57323,0,16532},{57323,6,14807},
+{57324,0,16492},{57324,6,14809},{57325,0,15922},{57325,10,14811},
+{57327,0,15835},{57327,0,17355},{57327,6,14814},{57330,0,16119},
+{57332,0,17883},{57332,6,14816},{57333,0,18638},{57333,0,18730},
+{57333,0,16597},{57333,0,17103},{57333,14,14818},{57336,0,14703},
+{57336,6,14822},{57337,0,18911},{57337,6,14824},{57338,0,18467},
+{57338,6,14826},{57339,6,14828},{57340,0,16788},{57342,0,14724},
+{57342,6,14830},{57343,0,19072},{57343,0,14493},{57344,121,16395},
+{57375,0,2106},{57376,21,16427},{57382,0,2557},{57383,125,16434},
+{57415,5,18758},{57417,69,16468},{57435,0,781},{57436,25,16487},
+{57443,0,363},{57444,57,16495},{57459,0,2144},{57460,193,16511},
+{57509,0,16002},{57510,37,16561},{57520,0,18760},{57521,101,16572},
+{57547,0,18761},{57548,69,16599},{57566,0,18762},{57567,77,16618},
+{57587,0,3107},{57588,21,16639},{57594,0,18763},{57595,49,16645},
+{57608,0,18764},{57609,145,16658},{57646,0,6116},{57647,17,16696},
+{57652,0,16014},{57653,57,16702},{57668,0,18765},{57669,13,16717},
+{57673,0,8495},{57674,5,16721},{57676,0,18766},{57677,61,16723},
+{57693,0,18767},{57694,29,16739},{57702,6,14832},{57704,25,16749},
+{57711,0,18769},{57712,129,16756},{57745,0,4447},{57746,5,16789},
+{57748,5,18770},{57750,53,16792},{57764,0,18772},{57765,81,16807},
+{57786,6,14834},{57788,37,16829},{57798,0,18774},{57799,5,16839},
+{57801,0,1219},{57802,85,16842},{57824,0,18775},{57825,125,16864},
+{57857,0,18776},{57858,165,16897},{57900,6,14836},{57902,5,16941},
+{57904,0,3237},{57905,153,16944},{57944,0,18777},{57945,49,16984},
+{57958,6,14838},{57960,117,16998},{57990,0,15728},{57991,101,17029},
+{58017,10,14840},{58020,29,17057},{58028,0,18780},{58029,57,17065},
+{58044,0,288},{58045,197,17080},{58095,0,7080},{58096,5,18781},
+{58098,49,17131},{58111,5,18783},{58113,61,17144},{58129,17,14123},
+{58134,0,18072},{58135,137,14128},{58170,6,14843},{58172,5,18073},
+{58174,5,14166},{58176,0,11752},{58177,21,14169},{58183,0,18075},
+{58184,13,14175},{58188,0,18076},{58189,5,14180},{58191,0,289},
+{58192,17,14182},{58197,0,18077},{58198,13,14187},{58202,0,4203},
+{58203,29,14192},{58211,0,4902},{58212,9,14201},{58215,0,18078},
+{58216,61,14205},{58232,0,18079},{58233,9,14221},{58236,0,1643},
+{58237,5,14225},{58239,0,4910},{58240,77,14228},{58260,0,18080},
+{58261,33,14248},{58270,0,18081},{58271,21,14257},{58277,0,18082},
+{58278,121,14264},{58309,10,14845},{58312,17,14297},{58317,0,18084},
+{58318,25,14302},{58325,10,14848},{58328,13,14311},{58332,0,8877},
+{58333,37,14316},{58343,0,18086},{58344,77,14327},{58364,0,18087},
+{58365,77,14348},{58385,10,14851},{58388,5,14369},{58390,10,14854},
+{58393,49,14374},{58406,0,18091},{58407,29,14387},{58415,0,18092},
+{58416,93,14396},{58440,10,14857},{58443,81,14422},{58464,0,18094},
+{58465,21,14444},{58471,9,18095},{58474,53,14451},{58488,10,14860},
+{58491,37,14467},{58501,0,14057},{58502,33,14477},{58511,0,18099},
+{58512,65,14486},{58529,0,18100},{58530,137,14503},{58565,0,5009},
+{58566,77,14539},{58586,0,5796},{58587,197,14560},{58637,0,18101},
+{58638,29,14610},{58646,0,18102},{58647,57,14618},{58662,10,14863},
+{58665,109,14634},{58693,0,12402},{58694,29,14663},{58702,0,18105},
+{58703,229,14672},{58761,0,14728},{58762,121,14731},{58793,0,18106},
+{58794,29,14763},{58802,0,18107},{58803,121,14772},{58834,5,281},
+{58836,6,14866},{58838,81,14803},{58859,0,16300},{58860,29,14825},
+{58868,0,10620},{58869,73,14834},{58888,0,18108},{58889,45,14853},
+{58901,0,18109},{58902,205,14865},{58954,0,18110},{58955,121,14917},
+{58986,0,18111},{58987,89,14948},{59010,0,18112},{59011,133,14971},
+{59045,0,18113},{59046,5,15005},{59048,0,18114},{59049,5,15008},
+{59051,0,18115},{59052,97,15010},{59077,6,14868},{59079,193,15036},
+{59128,0,18117},{59129,181,15086},{59175,6,14870},{59177,253,15134},
+{59241,0,18119},{59242,45,15198},{59254,0,18120},{59255,13,15210},
+{59259,0,18121},{59260,269,15215},{59328,0,18122},{59329,69,15283},
+{59347,0,6171},{59348,161,15302},{59389,0,15919},{59390,45,15344},
+{59402,0,18123},{59403,93,15357},{59427,0,18124},{59428,281,15382},
+{59499,0,18125},{59500,93,15453},{59524,0,15478},{59525,53,15478},
+{59539,0,11044},{59540,649,15493},{59703,5,18126},{59705,161,15658},
+{59746,0,18128},{59747,17,15700},{59752,5,18129},{59754,0,15705},
+{59755,5,18131},{59757,0,15706},{59758,21,18133},{59764,0,15707},
+{59765,41,18139},{59776,0,15708},{59777,13,18150},{59781,34,14872},
+{59790,5,15711},{59792,9,18158},{59795,14,14881},{59799,5,15715},
+{59801,37,18163},{59811,0,17357},{59812,17,18173},{59817,5,17358},
+{59819,6,14885},{59821,9,18179},{59824,0,17364},{59825,9,18182},
+{59828,0,15717},{59829,9,18185},{59832,0,15718},{59833,17,18188},
+{59838,0,15719},{59839,5,18193},{59841,14,14887},{59845,5,17365},
+{59847,21,18197},{59853,10,14891},{59856,5,18204},{59858,22,14894},
+{59864,25,18208},{59871,0,15725},{59872,13,18215},{59876,0,17369},
+{59877,25,18219},{59884,0,17370},{59885,25,18226},{59892,0,17372},
+{59893,17,18233},{59898,0,15726},{59899,9,18238},{59902,6,14900},
+{59904,17,18242},{59909,0,15728},{59910,5,18247},{59912,0,15729},
+{59913,25,18249},{59920,18,14902},{59925,25,18258},{59932,0,15731},
+{59933,9,18265},{59936,0,17374},{59937,9,18268},{59940,0,15732},
+{59941,9,18271},{59944,0,15733},{59945,57,18274},{59960,0,17376},
+{59961,5,18289},{59963,0,17378},{59964,17,18291},{59969,0,17379},
+{59970,5,18296},{59972,0,17381},{59973,29,18298},{59981,0,17375},
+{59982,5,18306},{59984,26,14907},{59991,21,18311},{59997,0,17405},
+{59998,13,18317},{60002,0,15735},{60003,77,18321},{60023,10,14914},
+{60026,45,18342},{60038,0,15738},{60039,17,18354},{60044,10,14917},
+{60047,13,18360},{60051,22,14920},{60057,25,18366},{60064,10,14926},
+{60067,29,18374},{60075,0,15742},{60076,5,18382},{60078,10,14929},
+{60081,9,18385},{60084,6,14932},{60086,25,18388},{60093,0,15743},
+{60094,13,18395},{60098,26,14934},{60105,33,18402},{60114,0,15747},
+{60115,29,18411},{60123,10,14941},{60126,21,18420},{60132,9,15750},
+{60135,21,18426},{60141,10,14944},{60144,9,18433},{60147,6,14947},
+{60149,13,18436},{60153,0,17330},{60154,9,18440},{60157,0,15756},
+{60158,9,18443},{60161,0,15757},{60162,13,18446},{60166,0,15758},
+{60167,33,18450},{60176,0,15759},{60177,9,18459},{60180,0,15760},
+{60181,33,18462},{60190,0,15762},{60191,9,18471},{60194,22,14949},
+{60200,5,15766},{60202,0,18477},{60204,53,18478},{60218,13,15768},
+{60222,5,18492},{60224,10,14955},{60227,5,18494},{60229,10,14958},
+{60232,5,15777},{60234,0,18497},{60235,5,15779},{60237,5,18498},
+{60239,13,15781},{60243,6,14961},{60245,5,18501},{60247,0,15786},
+{60248,5,18503},{60250,29,15787},{60258,13,18505},{60262,6,14963},
+{60264,21,15796},{60270,0,10969},{60271,9,18510},{60274,22,14965},
+{60280,5,15805},{60282,14,14971},{60286,5,18518},{60288,9,15809},
+{60291,5,18520},{60293,26,14975},{60300,9,18524},{60303,6,14982},
+{60305,9,15817},{60308,6,14984},{60310,5,15821},{60312,9,18529},
+{60315,0,15823},{60316,5,18532},{60318,6,14986},{60320,5,15825},
+{60322,0,18535},{60323,5,15827},{60325,5,18536},{60327,5,15829},
+{60329,6,14988},{60331,9,15832},{60334,14,14990},{60338,5,18541},
+{60340,21,15837},{60346,14,14994},{60350,17,15845},{60355,6,14998},
+{60357,5,18546},{60359,14,15000},{60363,9,15853},{60366,30,15004},
+{60374,13,15859},{60378,5,18554},{60380,5,15863},{60382,14,15012},
+{60386,5,15867},{60388,0,18558},{60389,9,15869},{60392,5,18559},
+{60394,0,15872},{60395,5,18561},{60397,5,15873},{60399,10,15016},
+{60402,5,15876},{60404,5,18565},{60406,37,15878},{60416,10,15019},
+{60419,17,15890},{60424,9,18568},{60427,29,15895},{60435,10,15022},
+{60438,9,15905},{60441,13,18572},{60445,9,15908},{60448,0,18576},
+{60449,37,15911},{60459,0,18577},{60460,9,15921},{60463,0,18578},
+{60464,5,15924},{60466,0,18579},{60467,45,15926},{60479,9,18580},
+{60482,10,15025},{60485,17,18584},{60490,0,15939},{60491,5,18589},
+{60493,0,15940},{60494,5,18591},{60496,5,15942},{60498,14,15028},
+{60502,9,18595},{60505,10,15032},{60508,5,18599},{60510,0,3340},
+{60511,21,18601},{60517,14,15035},{60521,73,18608},{60540,6,15039},
+{60542,13,18627},{60546,0,15951},{60547,13,18631},{60551,13,15952},
+{60555,10,15041},{60558,5,15957},{60560,5,18637},{60562,0,15960},
+{60563,5,18639},{60565,18,15044},{60570,13,18643},{60574,5,15964},
+{60576,0,18647},{60577,5,15966},{60579,5,18648},{60581,6,15049},
+{60583,5,18650},{60585,5,15970},{60587,6,15051},{60589,5,18653},
+{60591,17,15973},{60596,0,18655},{60597,9,15978},{60600,13,18656},
+{60604,133,15981},{60638,0,18660},{60639,17,16015},{60644,0,18661},
+{60645,105,16021},{60672,0,18662},{60673,9,16049},{60676,0,18663},
+{60677,5,16052},{60679,5,18664},{60681,10,15053},{60684,21,18667},
+{60690,10,15056},{60693,9,18674},{60696,5,16058},{60698,18,15059},
+{60703,9,16062},{60706,0,18680},{60707,9,16065},{60710,5,18681},
+{60712,10,15064},{60715,5,16070},{60717,0,18684},{60718,9,16072},
+{60721,5,18685},{60723,6,15067},{60725,5,16076},{60727,6,15069},
+{60729,5,18689},{60731,0,16079},{60732,5,18691},{60734,5,16080},
+{60736,9,18693},{60739,5,16082},{60741,0,18696},{60742,13,16084},
+{60746,5,18697},{60748,0,16089},{60749,5,18699},{60751,5,16090},
+{60753,6,15071},{60755,5,18702},{60757,5,16093},{60759,5,18704},
+{60761,81,16095},{60782,0,9398},{60783,5,16117},{60785,0,18706},
+{60786,9,16119},{60789,9,18707},{60792,5,16122},{60794,10,15073},
+{60797,13,16126},{60801,0,18711},{60802,13,16130},{60806,0,18712},
+{60807,5,16134},{60809,5,18713},{60811,73,16136},{60830,0,13585},
+{60831,17,16156},{60836,0,14661},{60837,5,18715},{60839,25,16163},
+{60846,0,18717},{60847,133,16170},{60881,0,18718},{60882,17,16204},
+{60887,0,18719},{60888,9,16209},{60891,10,15076},{60894,33,16213},
+{60903,6,15079},{60905,25,16224},{60912,0,18723},{60913,9,16232},
+{60916,0,14910},{60917,41,16236},{60928,0,18724},{60929,77,16247},
+{60949,0,18725},{60950,17,16267},{60955,0,18726},{60956,21,16272},
+{60962,0,18727},{60963,49,16278},{60976,0,18728},{60977,49,16291},
+{60990,0,14353},{60991,33,16305},{61000,0,18729},{61001,33,16314},
+{61010,0,1522},{61011,9,16324},{61014,0,18730},{61015,13,16327},
+{61019,0,18731},{61020,13,16331},{61024,0,18732},{61025,113,16335},
+{61054,0,18733},{61055,37,16364},{61065,0,18734},{61066,13,16374},
+{61070,0,15086},{61071,33,16379},{61080,0,9341},{61081,9,16389},
+{61084,6,15081},{61086,5,16393},{61088,25,18736},{61095,0,17332},
+{61096,9,18743},{61099,0,17336},{61100,45,18746},{62211,85,17609},
+{62233,193,18785},{62282,5,18844},{62368,5,17716},{62371,0,17718},
+{62374,13,17719},{62380,6,15083},{62382,9,17724},{62385,0,17306},
+{62386,197,17727},{62436,0,17314},{62441,14,15085},{62446,9,17779},
+{62451,41,17782},{62463,9,17793},{62467,37,17796},{62477,0,17340},
+{62478,33,17806},{62487,18,15089},{62492,9,17817},{62495,10,15094},
+{62498,21,17821},{62504,5,17317},{62506,53,17827},{62520,0,17321},
+{62521,17,17841},{62526,0,17161},{62528,37,17163},{62538,0,17846},
+{62539,45,17174},{62551,0,17847},{62552,9,17187},{62555,0,17848},
+{62556,13,17191},{62561,49,17196},{62574,0,17849},{62575,9,17210},
+{62579,6,15097},{62581,5,17216},{62583,18,15099},{62588,25,17223},
+{62595,0,17854},{62596,5,17231},{62599,17,17234},{62605,13,17240},
+{62609,14,15104},{62614,49,17249},{62628,9,17263},{62631,0,17857},
+{62633,29,17268},{62641,5,17858},{62643,17,17278},{62650,25,17285},
+{62657,6,15108},{62659,49,17861},{62673,37,17874},{62683,5,17292},
+{62685,5,17884},{62687,30,15110},{62695,13,17298},{62699,9,17890},
+{62703,9,17893},{62706,14,15118},{62710,17,17897},{62715,0,17319},
+{62716,21,17902},{62722,0,17324},{62723,209,17908},{62776,113,17631},
+{62806,125,17660},{62841,9,18851},{62845,0,18855},{62848,13,18858},
+{62853,0,18863},{62859,17,18869},{62867,5,18877},{62870,5,18880},
+{62875,5,18884},{62880,0,18889},{62883,5,18892},{62891,0,18900},
+{62896,0,18905},{62900,0,18909},{62902,0,18911},{62905,0,18914},
+{62909,0,18917},{62911,5,18919},{62916,5,18924},{62924,0,18932},
+{62926,0,18934},{62928,0,18936},{62933,17,18941},{62944,0,18949},
+{62948,0,18952},{62950,9,18954},{62954,13,18958},{62959,0,18963},
+{63028,5,17961},{63030,0,17338},{63031,17,17963},{63036,10,15122},
+{63039,9,17968},{63042,0,17342},{63043,25,17971},{63050,0,17343},
+{63051,9,17978},{63054,10,15125},{63057,21,17982},{63063,0,17346},
+{63064,5,17988},{63066,6,15128},{63068,45,17990},{63080,0,17351},
+{63081,45,18002},{63093,0,17352},{63094,213,18014},{63148,0,17401},
+{63149,13,18068},{63153,117,506},{63183,61,537},{63200,9,554},
+{63204,0,558},{63206,0,560},{63208,21,13747},{63216,1017,13754},
+{63511,25,14049},{63518,9,17606},{63521,33,17692},{63530,0,18846},
+{63531,29,17701},{63539,0,18847},{63540,25,17709},{63547,0,18848},
+{63551,37,18834},{63751,0,17686},{64012,6,15130},{64018,0,16828},
+{64038,0,14465},{64072,0,16997},{64091,0,14224},{65040,9,14099},
+{65043,14,15132},{65049,0,13646},{65072,6,15136},{65075,6,15138},
+{65077,5,130},{65079,5,134},{65081,5,138},{65083,5,142},
+{65085,5,146},{65087,5,150},{65089,5,154},{65091,5,158},
+{65097,5,199},{65099,5,203},{65101,5,201},{65103,0,13746},
+{65104,9,112},{65108,13,116},{65113,21,160},{65119,9,205},
+{65122,17,223},{65128,0,258},{65129,9,268},{65281,26,15140},
+{65288,5,128},{65290,22,15147},{65296,37,333},{65306,26,15153},
+{65313,101,365},{65339,18,15160},{65345,101,391},{65371,14,15165},
+{65380,0,113},{65504,5,262},{65506,14,15169},{65517,0,14096},
+};
+
+static const unsigned short cmap_UniCNS_UTF16_H_table[15173] = {
+178,13747,195,280,212,18788,18786,18792,18790,18801,18796,18794,
+18805,18803,18810,18808,18832,18814,18812,18818,18816,211,18840,18822,
+18820,18785,18802,18789,18807,18791,18809,18841,18793,18815,18787,18804,
+18813,18795,18817,18835,18806,13748,504,503,505,18798,18829,18800,
+18831,121,123,111,110,104,248,245,247,246,252,251,
+220,233,232,240,239,219,222,322,14090,14072,14081,14063,
+14074,14083,14065,14078,14087,14069,14080,14089,14071,323,14084,14066,
+325,14086,14068,14073,14082,14064,14079,14088,14070,324,14085,14067,
+321,320,304,303,302,301,300,299,298,14096,310,313,
+190,189,183,182,192,191,188,187,184,181,329,328,
+186,185,241,243,242,17700,18846,596,539,602,540,607,
+5998,608,610,544,611,5999,545,546,6000,547,614,633,
+6005,548,548,6006,646,550,725,556,862,866,6163,6168,
+560,1307,17635,1698,7731,2552,7732,9056,9746,236,235,17815,
+18083,16075,17273,15149,17840,18070,17959,16236,18438,14342,16403,15583,
+16589,16613,14597,17046,15674,18464,14904,15283,14716,15581,16918,16636,
+14713,14720,15500,15671,16646,14743,17976,15592,16784,17295,14942,16095,
+16796,17203,18006,18005,18007,14426,18976,15004,18022,16883,14958,19036,
+14195,15594,18057,18654,16740,15727,15091,14745,16989,18132,19006,17963,
+15380,17156,18157,16501,14420,18162,15533,17055,15618,18919,15528,18166,
+14698,19092,15069,18168,15093,15373,15063,19063,15081,16521,17879,17236,
+19060,17367,16988,19130,15141,15598,16870,18250,15219,15074,14317,14813,
+19085,15650,16847,15217,15602,16052,18079,18275,15076,16563,19076,18752,
+18286,18969,16100,19081,15264,15866,16060,18988,18321,18765,19128,19106,
+15382,18368,14658,15396,15395,14676,16115,18974,19080,18971,595,597,
+598,18686,6001,617,615,618,616,6002,660,6010,6008,659,
+658,754,753,752,755,751,18685,16215,619,17651,661,6011,
+18898,662,6030,1045,6388,537,17687,620,663,756,6031,17719,
+13999,5996,599,6003,623,16526,757,759,758,2097,596,14001,
+17637,5997,600,625,624,882,15845,2555,7733,17806,17340,3518,
+539,601,17807,666,17820,1323,602,6004,626,667,669,6012,
+670,668,14788,883,18645,1324,1325,1699,540,627,671,18895,
+884,886,885,9059,16700,13175,603,17638,14769,17808,673,672,
+6013,674,680,6015,6014,677,16226,761,768,6037,6033,6036,
+769,785,6032,6034,18635,17809,899,6074,896,900,6084,6072,
+897,6076,14765,901,17307,887,6075,902,6079,14792,6083,6080,
+6077,888,890,903,892,6069,895,6085,6082,6073,891,18899,
+6070,889,17724,17725,14782,6071,6191,1068,1055,14653,6192,1052,
+1070,17810,1060,16229,1059,6180,1063,1058,6185,6193,6189,14795,
+1061,15247,1064,1049,1073,6182,14772,6400,1047,1069,1048,6187,
+6183,1062,1054,6179,1050,6190,1071,1074,1053,1066,1072,1051,
+6188,1067,6194,6181,1065,6184,1341,6402,6414,1333,6415,1328,
+1338,15474,1331,6396,1339,6395,6399,6406,6404,1347,1342,6390,
+6392,1344,1332,6393,6405,6412,1337,6398,6391,1336,6394,1340,
+6397,14773,1335,1345,6407,1346,6411,6409,6413,1343,6401,6389,
+6403,1334,6408,1329,6410,1716,1704,15690,6749,6757,19050,1703,
+1711,1723,6763,6761,6756,1705,6762,6752,1719,1710,1718,6747,
+6759,18152,6750,1714,6751,14799,6746,1721,1708,1717,1707,6748,
+6753,6760,1715,1712,6755,1720,6758,6754,1709,1722,1713,1706,
+1702,15462,14800,2124,2102,18896,2118,16168,2123,7204,7203,2105,
+14259,2114,16166,2127,7197,2108,7198,16420,2129,7217,2572,2113,
+2112,7199,2116,7749,2107,7210,2122,2121,2111,7202,7211,7196,
+2110,7212,2119,7200,2101,2104,2103,7213,2117,2106,2126,2128,
+7207,2125,14796,7215,7201,7216,7205,14608,7214,18849,2109,7757,
+7745,7750,7756,2559,7743,2563,7747,7740,2561,7744,2566,2571,
+2567,16172,7760,14801,2562,7746,2558,7741,7737,7751,7738,7736,
+7748,2564,15817,8376,7752,7735,7753,14797,2574,7758,2573,7734,
+7742,7759,2569,2568,2565,2570,3052,14798,8379,8372,8380,17308,
+8370,8373,3048,8374,16876,3051,8378,8368,8367,3053,3054,3050,
+3055,8366,8377,8375,8369,3047,8371,3525,3519,9063,3528,9069,
+9072,9066,3520,9075,3526,9076,9071,3527,18897,9060,3524,9061,
+9070,9068,9064,3523,9062,3529,9067,9074,9065,9073,14789,3976,
+3973,14545,3974,9756,9748,3972,3969,9749,16334,3971,9752,9754,
+16433,15101,9761,16753,9760,9755,3968,9747,3966,9750,3977,9753,
+9757,3970,3967,9759,9758,3975,9751,15593,4357,10371,10368,4358,
+4356,14802,10375,10372,10365,4355,16434,4359,10366,4354,4362,14790,
+16436,4749,11012,4746,11009,4748,4750,11010,4747,5045,11582,5046,
+11580,11581,11579,11578,11583,5044,14766,10367,12046,5047,5493,12998,
+12997,5820,5819,13326,604,628,682,681,771,770,906,905,
+907,904,1076,1075,1077,1348,1350,17306,1724,281,7218,282,
+2575,284,283,8381,16442,285,3978,286,683,908,1351,16444,
+606,686,17727,1078,1353,1352,1354,15054,17311,6009,14006,1726,
+1725,7220,7219,2576,542,687,6016,16038,14810,4752,543,774,
+911,6086,16456,16465,15740,16402,16457,6196,6417,1355,6418,2136,
+16938,7224,16459,7221,2137,2135,2134,7225,16460,7762,16461,15789,
+16463,8382,9077,9762,17818,4363,4753,11013,16975,607,621,18758,
+2577,3057,3979,16760,5998,688,17819,1356,16138,14003,629,6039,
+778,16473,6038,916,912,6197,1675,6198,16224,18736,6199,1082,
+1081,16474,17314,1085,1361,6423,16123,6419,1363,1359,1358,1360,
+1357,16475,1729,6765,6422,1734,6766,1730,1733,1732,1731,1728,
+19120,2140,7231,2138,16477,14820,7227,2141,2139,2142,16169,7226,
+7232,17945,3061,2578,7763,7765,7764,7766,2579,3058,16195,3531,
+9079,17315,9078,3981,3980,10102,15807,17821,4754,4755,16478,12412,
+13000,12999,13327,16232,610,780,779,17730,917,14821,1086,1089,
+1366,6424,6767,1738,6768,1737,16097,7233,16649,16170,2580,7768,
+2583,7767,2767,2582,2581,3063,3062,3533,16483,14823,10380,4369,
+10379,4756,11584,5048,12413,5641,544,630,692,6017,918,6202,
+1739,7234,2585,2584,8384,8383,611,695,783,2586,5999,6040,
+784,6091,920,919,6090,1090,18888,16182,7769,3538,9767,3982,
+16336,16493,11014,12743,545,696,17732,6427,6769,2589,612,18759,
+631,363,699,698,697,787,786,6041,6092,17733,1370,1367,
+1369,1368,613,17665,700,17319,789,788,6203,18442,1371,16077,
+6018,16506,791,790,6204,1091,16507,1092,1741,6770,18689,16509,
+2144,6428,16514,6429,6772,6771,6774,6773,1742,7770,2146,7235,
+2145,16516,8385,3066,16699,8386,16702,17824,16326,16517,9768,3983,
+16518,16523,17318,2590,614,632,703,702,14518,704,14842,17734,
+15933,1375,1377,17735,16528,16185,1743,2147,16531,11015,5321,633,
+794,809,804,799,798,805,803,796,810,797,793,808,
+807,806,795,802,16534,14344,801,811,800,934,930,936,
+6094,933,923,926,929,925,932,935,924,927,931,937,
+16536,15479,6215,6212,15972,1105,6213,1093,1095,1119,1114,16899,
+17827,6220,6214,1097,1099,6219,1106,6209,1118,1120,1094,1111,
+16556,6207,1117,15989,1102,18901,6208,1110,1108,1109,1115,6216,
+1096,1116,6218,1104,1101,6211,1100,6221,1103,1107,16081,19129,
+16039,1098,6217,6446,6445,1395,6448,6450,6439,6442,6449,1396,
+16178,15747,6436,6440,16541,6444,6789,1391,6793,1378,6441,1379,
+1392,1385,1381,6437,1384,1389,1398,6438,6431,1383,6432,6434,
+1386,18137,1388,6430,6435,1397,1393,6443,1399,16545,1390,6433,
+1387,17831,16024,1382,1380,16010,6447,6788,6776,6791,17832,16546,
+6778,1750,1764,1746,1763,1755,1760,1744,6777,6783,1759,6795,
+1761,14148,1751,17833,6785,6782,1749,17834,6775,1762,6790,1754,
+6792,1765,1745,1756,1753,6780,1757,1752,1758,1748,14755,17890,
+14848,1747,6779,17835,7255,2160,7237,17217,7242,2153,2164,7240,
+2148,2158,2163,7247,2159,2162,17836,7250,2154,7241,2156,7252,
+2152,2167,2150,15564,7257,7245,7249,2155,2166,7246,2161,7251,
+7258,7785,14963,7256,2168,2149,7248,7239,16041,2157,7238,17837,
+17161,7236,2165,17839,7777,16538,2609,7791,2607,2604,7782,2600,
+7786,2611,7776,7781,7780,2151,2606,7789,7792,7773,3084,17321,
+7793,2612,2598,2595,7784,2592,16554,7790,16488,2599,7794,7774,
+7788,2602,7775,7778,7783,18762,2603,2601,2613,2608,16544,2596,
+2748,2597,7779,2610,2605,7787,2594,16031,2593,15150,15302,16011,
+16164,3067,3070,8402,3090,8405,3068,8398,3074,3080,3355,16558,
+3078,8395,3091,3071,3079,8403,9095,8408,8396,17166,8387,8400,
+8394,3077,8406,3073,3093,3086,3075,3072,8407,8393,8399,8401,
+8389,8404,3069,8388,16559,3076,3092,3088,8390,3082,14581,3089,
+3085,3081,14846,8397,17892,16009,3087,15811,9093,9089,15951,9104,
+9082,9091,3545,9100,3555,9087,9086,9084,9102,3543,9096,9085,
+3546,9094,3541,9090,9097,9099,17843,17323,9103,3550,9083,3544,
+9088,18661,3539,3551,9098,3554,3542,287,3540,9092,15996,3549,
+16008,16003,9101,18310,3999,3994,9783,9779,17958,9773,3988,3984,
+9782,3985,9776,9778,9781,16002,3990,3997,3991,9774,3998,16205,
+9772,9777,3989,9770,3995,3987,3986,9775,9780,15976,3996,16253,
+17325,15975,18183,4377,10397,10394,15971,4371,4374,10392,4376,10384,
+4382,16567,10396,4373,10398,4372,10393,10395,4375,10391,10385,10382,
+15998,8392,10388,10381,10387,10386,10383,16572,4379,16573,18383,17858,
+4378,17327,4380,10389,4757,10390,16121,11024,11017,14354,4769,11021,
+4761,4765,11020,4764,4760,4763,4758,4768,11022,11018,4767,11016,
+4766,11023,11019,4381,4770,11025,4762,4759,15749,16055,16109,11591,
+11593,5050,11594,11592,11590,11589,5052,11588,5053,17960,14665,15948,
+5049,5054,5051,14758,11585,12051,12049,12054,12052,12050,12053,14756,
+14664,15560,5494,12419,12415,12420,12416,5323,17911,17983,12744,12746,
+5644,12745,5643,5642,15965,5739,5738,5740,13001,13177,13176,5821,
+5823,5822,13178,5878,13441,13440,13513,18570,6005,813,812,940,
+939,6096,938,6095,17736,1123,6224,1121,1124,16580,6222,16579,
+1122,16575,6452,1400,19002,1766,16578,7796,2614,2616,7795,2615,
+8409,3094,9105,15926,4001,10399,11027,11026,14850,13573,634,6020,
+943,947,6098,945,944,6097,946,942,15097,941,6099,18950,
+1131,18517,1127,6225,16588,16606,6226,16584,1129,6228,1125,6229,
+6227,1128,1130,1133,1132,1126,6230,1405,6465,1406,16171,6466,
+1404,1403,6456,6453,6458,6457,6454,6461,6459,1402,18722,6462,
+1408,6467,18140,14855,6460,1767,1401,15483,1768,6800,14854,6806,
+16742,1774,6804,6810,6801,6805,6807,6809,6803,17928,6802,1769,
+18532,1771,1770,6799,6808,19127,18241,6796,7270,7269,7274,7265,
+15481,7268,7267,14124,7271,7275,2171,2174,15195,7266,7272,15627,
+2173,7261,1772,7810,7273,2172,7263,7801,14853,16129,2617,2621,
+7817,7799,7813,2622,7815,16591,7821,7816,7804,7812,18260,7826,
+7824,7814,7809,7802,8417,7800,2626,7807,2627,2623,7797,7819,
+7805,16527,7803,7822,2624,16593,7828,2618,2620,7811,7806,2175,
+2619,7808,7823,7827,7818,19132,8412,8421,8420,3102,8413,16598,
+3103,3101,15400,8415,3098,8419,16596,8414,8416,8410,3096,8429,
+8428,8425,3095,7262,8422,3097,2625,8424,8411,8427,8426,15730,
+8430,8423,15746,15042,8418,9111,3567,3570,3565,9110,9114,9109,
+3559,3569,9106,3563,9113,3561,3560,9116,3562,9118,18761,9115,
+3558,17375,3568,9120,9108,9117,9107,15717,3564,14746,3566,9121,
+15398,17237,9791,4002,9797,4007,9793,9800,9785,4009,4003,9790,
+4385,9789,9798,4004,4008,9788,9794,9799,9784,4006,9792,9796,
+9802,9786,9795,18903,4005,9801,9787,17944,18691,4389,10401,4387,
+4386,10403,10408,10407,4392,16107,4744,4391,16599,10400,10406,4390,
+10405,14244,10402,18496,15869,11032,14059,11034,11029,4772,11031,4771,
+11033,4774,11035,4773,11028,11030,5058,11597,18904,5057,11598,5056,
+11596,5055,11595,5325,5324,12421,12423,16602,12422,5498,12747,5646,
+13329,13328,5920,635,705,1135,17737,15720,15482,6811,16604,9122,
+4010,9803,10409,548,6021,17738,17817,6231,17739,6468,6812,7276,
+2176,17012,12424,5741,636,814,6044,1409,19004,16611,2628,4013,
+4011,706,708,707,6022,709,815,6045,816,17740,1413,6469,
+1410,7277,1778,1777,1779,1776,6813,1414,1775,3106,8431,2629,
+4015,4014,9804,4393,4775,12055,13179,13330,638,817,15978,818,
+6106,953,956,6104,6102,955,6105,6107,6101,958,957,954,
+952,6103,15664,1147,1144,6237,6240,6239,1138,1146,15513,1143,
+6236,6234,1142,15280,1137,1140,15791,6235,6242,6238,1141,1145,
+1148,6233,6241,1139,1419,1427,15576,6481,6474,1428,6485,6470,
+6477,16173,14864,1418,6471,1416,6478,6482,1415,19052,6483,6476,
+6479,15620,1430,1421,6486,6484,16620,1426,1424,6475,1423,6473,
+6472,1422,1420,1429,1425,1417,1781,16625,1788,6827,1780,6819,
+6815,6831,6814,1783,6824,1786,1789,1784,6828,1787,15705,2186,
+6834,6816,15672,15282,6818,6825,6829,6833,6830,6823,6826,15946,
+16632,6820,1791,6822,6821,6832,1782,6817,1790,15245,1785,2192,
+7285,15497,2191,15160,2180,14867,2185,7282,7279,7284,2181,7278,
+18946,2184,2182,7286,2183,2187,14875,2188,16616,2190,2189,15163,
+15680,14863,7836,2630,8445,7835,7854,2636,15040,7852,2635,2631,
+7861,7845,7848,14615,2639,7858,7850,2632,2640,7855,7853,7838,
+7859,7847,7842,17923,7832,7860,7844,7831,15156,2638,7849,7862,
+7846,7834,7839,7830,15667,2637,16635,7843,7840,2633,7833,14775,
+7857,2634,14914,7841,7837,15679,7856,15668,3107,8438,15585,8435,
+8452,8440,8453,14865,3109,14877,15665,8449,8446,8447,8450,8454,
+7851,8456,9142,16949,3110,8457,8433,8443,16640,8448,14858,3108,
+3111,8455,8458,8437,8434,16754,15580,8436,19011,8441,8439,3112,
+16634,8442,8444,8432,9130,9128,3580,3578,9138,9129,9139,9135,
+9127,9141,9126,9133,3577,3576,3575,9131,9136,3572,3579,14486,
+9124,9134,9123,9132,3573,9137,9125,3574,9140,15496,14866,9808,
+4020,4019,4021,9820,9810,9816,9805,9819,9818,9822,9815,4016,
+9814,4022,15238,9807,4017,9821,4018,9809,9812,9817,9811,9806,
+14325,9813,10411,4397,10414,10413,10416,10418,14062,4395,10412,15389,
+10410,10419,10417,10415,10420,4399,4394,4396,4398,18687,10422,11042,
+15350,11041,11040,18921,11043,11036,11037,11045,11038,4776,11047,18753,
+11046,11039,11602,5061,11600,11605,11604,11044,5060,15236,11603,11599,
+11607,11606,5059,5647,14536,5648,14916,12748,17074,13005,13004,13331,
+13442,14897,641,710,819,6108,1150,1149,6487,1433,1432,6488,
+17742,17949,1792,2193,7288,15967,7864,2641,3114,7863,3113,14130,
+4023,16650,9823,4778,5062,11608,16652,5649,5824,549,6046,16452,
+820,6047,963,1154,1153,6243,1155,18665,6244,6489,6490,18962,
+1434,1436,1438,1435,1439,1437,16662,1796,1793,1795,1797,1794,
+7289,6835,7291,7290,2199,2196,2198,2200,2197,19015,2202,2201,
+2646,7866,7865,2645,16165,2644,2643,2647,2642,8464,8461,3116,
+8460,8465,3118,8463,3115,3117,8462,16657,9143,17083,4024,4032,
+9824,4026,4030,9825,4031,4025,4029,4402,8459,4403,4401,4400,
+11048,4779,5499,5650,7292,2203,16664,2650,2649,2648,8466,4033,
+4780,643,6023,711,6048,16666,16668,6109,966,14889,9146,15753,
+644,17640,712,6110,8467,3121,5063,645,665,713,6049,821,
+1160,1159,6492,1441,16671,16220,1802,6836,1801,2206,2204,16130,
+7294,2205,7293,2194,7867,4034,9826,10423,5064,5742,13443,6006,
+714,6051,6050,19035,967,16673,6254,6249,6251,6253,6250,1164,
+6247,6252,6255,1163,6256,18060,17745,18778,6506,14890,6500,6495,
+1445,6503,6501,6494,6507,6510,6505,6498,1447,6504,1448,6499,
+6502,6493,6497,6509,1449,6496,6508,1444,1446,17336,15692,6853,
+6846,6852,6845,6847,6841,6839,6854,6851,6837,16147,1804,19032,
+6848,6840,6838,1803,6844,6842,6843,6855,2211,16674,2210,7295,
+2207,7297,16675,2212,7298,2215,18857,2213,7299,6856,7301,2209,
+19016,2208,7296,7300,2214,2655,2654,7869,7873,7875,2656,7878,
+16679,2660,7880,2662,17337,2658,2666,16680,2663,7871,2657,7870,
+7868,7882,7872,2659,7881,2664,7877,7876,2665,7874,2661,7883,
+18131,7879,8482,8489,8478,3124,8474,8490,8468,8487,8485,8479,
+8488,8481,17961,8473,8491,8471,8484,8469,8492,16681,3125,17962,
+8486,9150,8472,3122,3123,8475,8480,8477,17338,16330,9157,9149,
+9156,9155,3581,8470,9153,3582,18148,9148,9152,9833,19038,9840,
+9831,18957,9838,9829,9837,9841,9828,9832,9827,4035,15924,9830,
+4036,9836,9835,9834,16676,9839,16140,10427,10429,4407,10430,10424,
+10434,10432,4406,10435,10426,10431,10433,10428,11052,11057,11051,11056,
+15929,11049,11059,11055,11060,11054,11050,11058,11061,11053,16728,11611,
+5068,17966,5066,5065,5067,12059,15359,12323,12428,13183,5826,5825,
+13182,5879,16684,13332,647,968,6115,6257,1306,2667,648,824,
+823,822,715,16225,3126,652,6024,16704,6258,15754,1166,1456,
+16174,6512,1454,1453,6511,1451,6513,1452,1455,1808,6861,6862,
+1807,7303,7302,2217,16693,2670,7885,2669,2671,2668,3128,7884,
+3129,8494,17312,3130,8493,3127,9161,9163,3583,9162,9160,9159,
+9844,4041,4039,4037,10439,10437,14891,4409,10438,4410,4408,4038,
+10436,11613,5069,11612,11065,12429,653,827,971,6116,970,1457,
+3584,551,716,828,1809,3131,552,6053,6054,16648,6117,17746,
+1168,6263,6261,1169,6260,6262,6264,18907,1458,6866,1460,6865,
+6867,6864,6868,1811,2221,7304,7306,2219,7307,2220,7305,6863,
+7886,7887,2675,2674,17341,2676,3135,9164,9166,9168,3586,3585,
+3132,9167,9165,14896,9848,16014,9846,9852,4042,9853,9850,4043,
+9847,9845,9851,4412,10441,9849,4414,10442,4413,4416,10443,4411,
+4415,11070,11068,11067,11069,11066,13008,13184,5954,553,1463,1170,
+14447,16707,1812,16708,16710,654,717,829,6118,1171,6265,6869,
+1813,4044,655,14910,16713,14911,972,3587,656,831,830,6119,
+973,6514,1466,1814,6870,7309,2222,2677,7891,2678,7892,16718,
+19056,3136,9855,9854,4417,10444,4781,11071,5070,15269,5827,13334,
+554,17641,6871,2679,8495,3588,15706,5327,555,1174,16722,1173,
+1815,2681,2953,2682,2680,3137,9856,4046,4418,16724,6007,6120,
+6268,1175,6267,1176,16472,1470,6521,6520,1469,6519,17969,1817,
+6872,1820,1816,1822,2225,2224,2223,7894,2683,2686,2684,7893,
+2689,2685,7895,2688,2687,16428,8497,8496,16727,3140,8498,3589,
+9171,3590,9170,15768,10445,4420,9857,4419,4047,16287,11073,11072,
+5071,11614,12430,18908,720,17642,832,1178,1180,6123,6271,6270,
+6269,6122,6121,975,1179,1177,974,1471,6522,16815,1472,6276,
+6278,6277,6523,1184,1182,6272,6274,6280,6275,6284,1474,6281,
+1183,6279,6282,1475,6283,6543,6530,6528,6542,6537,1827,1476,
+6538,6541,1823,6540,1477,1482,1480,6531,6526,6533,1487,6544,
+1824,6534,1825,1483,6536,16773,6887,1826,6525,1484,1828,1485,
+1481,1486,6535,6524,6539,1478,16737,6527,6532,6529,1479,6884,
+7314,6885,1834,6888,6878,1833,6880,6881,16500,6883,1829,14060,
+6879,6875,2230,6889,2226,7312,6882,7311,6877,6886,1832,2227,
+1838,2228,6890,7313,1831,2232,1837,1836,1835,2231,6891,2233,
+1830,14919,2690,7317,7319,7321,2234,2240,7898,7325,7316,2692,
+7896,2239,2237,7327,2238,7322,2241,7324,2236,7323,7326,7320,
+16746,2235,2693,7315,2691,16385,15068,2694,7900,7909,3143,18768,
+2696,2701,3144,7911,2708,8500,7901,2700,2703,2698,7899,7913,
+7916,8515,7914,8504,2699,2706,2710,7908,8499,7912,2695,8501,
+7915,8503,7904,17973,2704,7906,2709,7910,2702,7907,16890,2707,
+3145,3142,8502,15733,7905,2697,15748,15739,16393,16748,3150,3154,
+8506,3595,3152,8510,3156,9172,8512,3597,3148,3151,8513,16296,
+8514,8520,3158,3598,8516,8521,8509,3608,15413,3599,3157,8507,
+8522,15495,3607,3155,3592,8519,3159,8511,8505,3149,8508,8517,
+16118,3591,3596,3146,8518,18862,3147,3606,9859,9183,9175,9858,
+9179,9181,16183,9177,3609,17974,3604,4049,9184,9860,16756,3602,
+9176,9180,4048,3593,4050,3601,3603,3600,9182,15410,9870,4425,
+9877,4056,16314,4055,9872,16774,4424,9861,4054,18764,9876,16755,
+9873,10462,4422,3153,9875,4429,9867,4423,16320,4428,9862,9866,
+9863,9869,4057,4421,4051,10448,9871,4427,16317,4430,9868,16759,
+4426,10447,10452,4785,10446,11085,10461,4434,4432,4783,10458,10454,
+4438,15840,11076,14933,14932,4436,10453,16386,11074,10460,10451,4431,
+11075,4784,10459,4433,4435,10456,4439,10455,10450,10449,4782,10463,
+11078,11616,4787,17977,11084,17343,11082,4788,11083,14928,11080,5073,
+11615,11077,11079,5074,4790,5072,4789,5076,11081,4786,17978,16769,
+11623,12063,11619,16325,5328,11621,11620,5075,11618,11622,12071,12067,
+12069,12068,12066,5502,5505,5504,5503,5652,12755,5653,12431,5744,
+13009,5745,5828,5880,13335,13619,721,6056,833,979,1186,1185,
+6545,1489,1488,3160,9185,9187,9189,9188,9878,4058,9880,17980,
+10464,4440,5077,5329,5078,722,17690,16322,6285,6546,1491,1490,
+1492,1839,7329,2242,2713,3161,8523,723,17644,657,724,6057,
+837,836,982,6130,6132,981,6124,6131,6127,6129,980,6126,
+6133,6128,1193,1202,1200,6295,6292,6300,1198,6301,1191,6298,
+1197,6294,6293,1195,6299,1196,1493,1190,6296,16262,6286,1187,
+16208,1206,6291,6297,1192,1194,17344,1205,1199,1204,6290,1203,
+1189,1188,1201,1507,6558,6551,1502,1521,6547,6554,6556,6559,
+1516,6555,6548,1514,6552,6560,1499,6557,1509,1508,6550,1497,
+19153,1498,15759,1496,16778,1520,1512,1506,1494,6553,1505,1495,
+1513,1522,6894,1510,6549,1500,1517,1511,1515,1501,1840,6900,
+1852,1844,1846,1851,6912,1849,7330,2243,1854,6897,6905,1850,
+6904,6901,6909,6911,1843,1847,1853,2245,6906,1845,1856,6899,
+1848,2244,1842,6896,6903,6895,6898,6902,7331,1855,6910,1841,
+2259,7343,7333,7349,16093,2248,14949,7917,7351,7345,16150,7336,
+14947,7354,7339,2254,7940,7342,2256,2247,7356,7344,2250,7337,
+2251,7350,7357,2253,7341,7340,2261,2260,2246,2252,2255,7353,
+7347,2249,7332,7355,7346,7348,7352,16327,7918,2721,2741,2740,
+2729,16782,7936,7932,7929,7947,2724,2716,7934,3177,2720,7942,
+17255,2742,2739,7938,7921,16203,2738,7944,7920,2727,2731,7943,
+7930,2732,2726,7919,16776,3163,7946,7928,2737,7931,7945,2736,
+2717,7926,2722,2733,2728,7935,7925,7923,7941,2714,2734,2718,
+3162,7939,2719,2715,2730,2725,2723,7927,2735,7924,7937,7933,
+8526,8525,7922,8542,3165,18088,8548,8531,8545,9190,3168,8549,
+8552,3167,8534,8551,8550,3169,8527,3164,3172,14950,3170,8547,
+8537,3174,8554,8546,8555,3182,3180,8544,8543,15968,8541,8535,
+3173,17985,3171,7338,8528,18591,9220,8529,3166,3179,9192,8530,
+8553,9191,8538,8533,3178,8539,8536,16786,3183,17986,16028,3626,
+17987,9195,9214,9219,9207,3622,9224,3619,9193,9194,3612,3621,
+9201,9215,9221,3620,3614,9200,9196,9223,9197,9217,9208,9218,
+9210,3615,9881,3618,3616,9222,9213,9209,17881,9198,4068,9212,
+3623,9204,16785,9203,16797,14955,3617,3613,9902,9216,9211,9882,
+9893,9900,4066,3181,9898,4061,4060,9905,17346,9883,9896,9884,
+9895,4064,9899,8540,9906,9891,4067,10478,4441,9904,9903,4069,
+10465,4442,10466,14939,9885,9890,9886,9907,4063,4443,4065,4070,
+17260,9889,4059,4446,11092,10474,10473,10475,17187,10472,4447,17347,
+4453,4450,4451,10467,10470,10480,4459,4457,10471,8532,4444,10477,
+10468,4460,10476,4062,4449,9892,4456,4458,4455,4454,17121,4448,
+10479,4445,4461,17216,11091,4805,4802,17989,4793,4800,11093,4798,
+4792,11090,5080,4794,4801,5079,11089,11088,4803,16131,4804,11087,
+11086,5081,11096,4797,11094,5082,16793,5087,11626,11628,16794,5084,
+14248,11629,11625,17226,11627,5085,5088,11624,5083,5086,5331,11095,
+5330,5336,12075,12078,12074,5332,12072,5506,12076,12077,12073,5333,
+12432,12435,17718,12436,12434,12437,5507,12433,15017,12759,5655,12758,
+12757,12756,5654,5656,13010,5747,5746,16775,16064,13186,13185,13188,
+5881,5829,13339,13187,13338,5883,5882,5921,13444,13514,725,15970,
+8556,11097,556,17645,983,6134,1209,1207,6561,1523,1857,1858,
+7359,7948,2752,2751,2744,2747,2750,2746,8560,2743,3184,16805,
+8559,8562,3185,8557,8561,8558,14956,3627,16804,4071,9908,4806,
+4462,10481,10483,10482,10484,11099,11098,11631,11630,12438,16803,17992,
+726,16651,17748,18910,8563,3189,3188,9226,12079,5748,13340,727,
+2754,2753,3628,9909,4072,11100,728,838,1524,6562,6915,1859,
+2755,8566,3190,3629,16807,11632,5337,13515,729,6563,1525,1860,
+15931,6916,2265,7363,2266,7360,7949,2759,2756,8567,16810,8568,
+9227,15272,4074,4073,11633,12080,12440,12439,12760,557,6025,1861,
+16814,730,839,985,984,6136,6135,6302,1210,6305,6304,6303,
+6306,1526,6569,6565,6574,17994,1533,1531,6570,6566,6573,1530,
+1537,6568,6564,1536,6571,1529,6572,1532,1534,6576,6575,6567,
+1528,1527,1535,6921,6927,14995,1867,1864,6918,6923,17045,1870,
+1862,6922,1865,1868,1863,6930,1866,14989,1869,6919,6924,6928,
+6920,6917,6929,6926,2274,2267,2270,16820,2273,7366,15769,2268,
+7364,16823,2272,19001,7367,2271,17995,7953,2761,7952,7954,2760,
+2765,7365,19113,7951,7955,14992,2762,7950,2764,16825,2763,8575,
+14987,8570,3191,3195,3192,8573,8576,16827,3193,3194,3199,9236,
+8574,3197,8571,8569,18075,3198,3635,16738,9228,3631,9233,9232,
+9229,3637,14985,9231,3196,17997,9235,9230,3634,3630,3636,9234,
+15677,9912,9911,9910,4075,4076,10489,10492,4466,18760,4465,10493,
+10488,4468,10490,16565,4467,10487,15891,10491,4812,4809,11109,11108,
+11107,11102,15770,11103,4807,4811,11101,4808,11110,16568,14967,11106,
+12083,5091,5338,5509,12441,5657,19023,12761,5749,13341,5884,731,
+16004,6577,1871,2275,2766,3056,8577,16836,3638,9914,9913,732,
+990,6578,1539,16354,1538,15777,17999,2278,7956,18867,3203,15755,
+3202,9237,9506,9915,11111,14239,5339,5658,733,841,844,840,
+6144,992,994,15937,6139,6138,6141,6140,6143,991,6137,6142,
+16411,6307,1221,6308,6312,1220,6316,6311,6314,6310,1218,1224,
+6309,6315,1217,6313,1219,1212,1222,15718,16843,1560,18948,6580,
+1540,19017,1543,1561,1545,6588,1556,6583,1546,6591,6584,1559,
+6596,1554,1552,6597,19118,6595,6587,6579,6586,1547,1541,6590,
+6589,6581,18113,1555,6593,6582,1558,6600,1542,1549,6585,6594,
+1557,1544,1548,6592,15738,6964,1879,1892,16884,6959,6949,1885,
+6947,1878,6942,1888,6955,6936,6938,14330,6941,6933,6954,6970,
+1883,6943,6961,6972,6963,6948,6956,1889,1876,1884,1896,1873,
+1875,15192,16846,6940,1893,1886,6966,6937,1895,1890,6946,1894,
+6953,6945,1887,6965,6957,1881,6971,6944,1877,6962,6952,1882,
+6958,1874,6934,1891,2293,1880,6951,6950,6939,14742,6967,17749,
+1872,17351,16851,16328,15722,17750,7389,2300,7390,7378,2289,2301,
+7371,16498,7380,7388,18114,7370,7397,2279,16848,7396,7391,7392,
+2287,2298,7382,7383,7393,7384,7387,7381,15918,16925,2280,2284,
+7395,7375,2296,2292,16711,2295,2302,2285,2297,7386,2299,2282,
+15339,2281,7372,18003,7376,2290,7394,7385,7377,2294,2291,2283,
+2286,15760,14356,7981,7978,7971,7970,2775,7974,7989,7957,7990,
+7976,7994,7982,2774,7980,2769,2790,2780,18004,2784,2783,7958,
+18103,7987,7993,7985,7992,7973,7959,7991,7975,2772,2785,7984,
+2778,15018,7983,7960,2786,2788,7986,2789,2771,7967,7988,16612,
+2777,2787,7969,7979,7964,7968,2782,7963,2770,2779,2776,7972,
+2288,8600,2773,15006,16860,2781,15406,8603,8625,8614,3223,17131,
+3218,8597,3219,8613,8606,8619,3215,8579,8621,3205,8587,3208,
+3207,3210,3206,8595,3217,8590,8617,3213,8609,8622,8584,8589,
+8583,3212,8602,9259,8585,3216,8594,8618,3211,8591,8588,8605,
+3214,3204,3226,8608,8607,16863,16862,17147,17052,8580,3209,8620,
+8596,8598,18008,8611,8610,8578,3220,3222,8586,8593,8601,3221,
+8592,8604,8623,8612,15778,18912,15744,14269,9279,3646,9277,9256,
+9261,9254,16871,9273,9240,9247,9271,9281,9257,16470,9244,9263,
+9268,9248,18009,9265,9245,17775,3648,9272,9270,9241,9275,9276,
+9278,3652,3644,15750,7965,9249,9267,9250,3641,3657,9274,3655,
+3651,9239,3643,16868,9242,3656,18011,9258,9238,15637,3649,9262,
+9246,3650,9255,3640,3225,9264,8599,9243,14957,16859,9269,3645,
+9266,3642,9260,3653,9251,9280,3647,9391,18013,3654,9929,9927,
+9949,9925,9943,3639,4080,9921,9948,16872,9926,9940,4085,4078,
+9946,18012,9919,9945,14128,4096,9936,9952,4094,9928,4079,9930,
+9944,4088,9923,4092,4082,9932,9922,9916,16374,9942,4089,9951,
+9917,4086,4087,9924,9935,9931,9933,16221,4081,9950,4095,9934,
+9918,9939,4084,4093,4091,9920,9941,4090,14831,4083,9937,15932,
+18014,16856,10505,10501,10497,10517,10514,4471,18463,10521,10504,4482,
+10511,10500,10510,4479,10530,10527,10513,10498,16877,16839,10518,10520,
+4475,10508,10503,10494,4472,4480,15913,10523,4481,10495,10529,10516,
+10522,4478,16857,15696,10519,4477,10512,10499,10531,10496,10524,4474,
+15646,10506,15208,10507,4473,4470,10502,4476,10525,10528,10509,11124,
+19114,15682,17067,15135,11116,15012,11112,4825,4814,4819,4815,11126,
+11137,4813,11118,11127,10515,11128,18913,4820,16880,11143,4824,4827,
+11114,4823,15019,11132,11131,11123,15013,14252,11133,11140,11139,14298,
+4818,4816,11125,11122,11119,11138,4826,11136,4822,4821,18879,11130,
+18016,11113,11115,11117,11135,11129,4817,5100,11652,5093,11637,18019,
+11648,5095,11655,11639,16694,11656,11635,11646,15387,5102,11651,11657,
+11645,5094,11647,11636,5101,18021,11654,11641,5097,16882,11643,11640,
+5103,11642,5096,5099,11650,11638,11653,14307,11649,18023,5341,12094,
+15955,15179,5340,12093,18024,5344,12085,12089,5343,12086,15009,5345,
+5342,12084,12088,12092,16885,15014,16204,12447,12444,12453,12452,12450,
+12445,5513,18025,15530,12446,5512,5098,12449,5511,12454,12448,12443,
+12087,12442,12767,12766,12451,5659,12765,12769,13014,12768,5752,5750,
+13012,13011,13013,5751,15015,5830,13189,13344,5885,5955,13518,16888,
+13620,734,995,7398,7400,7401,2791,7996,7402,16891,7995,8626,
+3228,8627,8629,3229,3227,8628,9287,9285,9284,9283,9282,3658,
+9286,4097,9954,9956,4098,9955,4485,4484,10532,16238,11145,11144,
+11146,15022,11658,5104,12095,5348,12455,5831,735,845,996,1225,
+10658,4829,5349,736,17646,997,6603,1565,6602,18027,6974,1898,
+6975,7405,2304,2303,8630,8633,3231,8631,3230,8632,10535,10534,
+4486,10533,10536,11147,11659,5105,5350,12456,5753,6026,1900,6976,
+2305,3232,8634,3661,3660,18028,11151,11150,12096,13345,737,6027,
+846,1226,6317,1901,3662,738,6977,1902,6978,5106,739,16903,
+6979,16901,7410,7409,7407,7406,7411,7408,3233,8635,9291,16249,
+3663,9962,10539,10538,10537,10540,11153,11152,4830,11154,5107,11660,
+12097,12457,13192,740,848,847,1566,6028,6058,998,1567,14507,
+6605,2306,2310,7412,2309,8004,2795,3236,8638,16227,4099,741,
+17647,6059,16904,849,15877,17648,6062,17281,852,6061,851,850,
+1227,6060,16525,6150,6149,1004,6151,1005,1000,15290,1001,16908,
+1007,6148,999,1228,6336,6334,6321,1240,6328,1235,6322,6330,
+16586,6327,1238,6326,1245,6335,1247,18030,1249,6320,16910,1236,
+6337,1243,1246,14246,6628,1230,1253,1244,6323,1233,1248,6331,
+6626,6324,1239,1250,6338,6325,1237,1242,6606,1251,6332,1241,
+1252,1229,6329,1234,6333,6627,18031,1579,1595,6613,1586,15606,
+6634,1571,16076,1574,6625,6611,6615,1582,1584,6618,1591,1577,
+1590,6630,1585,6617,6619,1583,1588,6620,6633,1904,1594,16496,
+1572,6632,16273,6636,6616,6638,6623,1581,6612,1580,1598,1587,
+6610,6990,1593,1597,6624,6629,15703,1599,1592,1578,1568,6614,
+1569,6637,16269,6608,6607,6621,6609,1596,2311,1589,6622,1570,
+18915,6997,7000,18033,7003,6992,14873,18034,7006,7009,7011,6989,
+1905,1910,7417,1926,7004,7012,6996,6988,7444,1913,7001,6993,
+6995,1918,6998,1912,6985,7007,15043,1909,18035,1921,6982,1923,
+1907,1927,7008,6984,1924,7438,6631,1911,1906,6991,6983,1925,
+1917,7002,1922,1920,6994,1914,6986,6987,7005,1908,6999,15603,
+7420,2319,2324,16540,16930,7429,7435,7431,7418,7421,2331,2316,
+7430,7439,2326,2312,2321,7422,2323,7423,7433,16629,14807,2325,
+7448,7416,2318,2317,2329,7413,7446,7434,7447,7441,7427,7442,
+18036,7436,7445,7443,2330,7428,2315,2314,2322,2328,7440,2327,
+7425,2796,15848,7449,7424,7419,2320,2332,2313,16929,7432,7437,
+18038,15033,2830,8006,8010,2811,2809,18039,2800,8008,8007,2820,
+8013,2814,16379,8031,8043,2797,8028,8021,2832,8005,2829,2817,
+2828,2807,8017,8035,8027,2808,2802,8041,8034,8036,2810,2818,
+8038,8015,8032,8020,8040,2823,2799,2821,8025,2812,8019,8018,
+2801,8012,8042,2803,8022,2833,2827,8011,2824,2822,2831,8029,
+2826,7426,8030,2825,8037,2798,8026,2816,8014,2815,2813,2805,
+2804,8639,8039,18850,15610,8660,15038,2806,18041,3265,2819,3247,
+8654,3261,8642,3244,3240,8672,3246,3250,3245,3254,8676,8667,
+18042,17154,8649,3259,3253,8661,3237,8673,8666,3241,8655,3256,
+3238,8671,3258,8659,3262,8650,8657,8651,3260,3268,8647,8643,
+3243,8656,3257,3266,16948,16849,8658,8682,8674,3239,8680,3251,
+19024,3249,16614,8686,3248,8664,8652,8662,3271,8668,8665,8648,
+3267,8678,8675,8683,3242,8663,3270,3252,3255,8669,3269,8653,
+8009,14803,8679,8677,8681,8644,3264,9324,9323,9297,3669,3679,
+9331,3674,9321,17793,9294,3680,3670,9309,9299,9302,9326,3664,
+9333,9325,3673,9314,3684,3683,3677,9332,3665,9312,9303,9316,
+9328,3685,16894,3667,9311,15884,9304,3676,18045,3675,9307,9317,
+9327,9298,9308,3668,9318,3681,3672,9305,3671,9296,9310,9330,
+3263,4127,9313,9963,9315,9329,3678,9306,3666,3682,4506,9295,
+9320,16489,18047,16431,9319,17720,9991,4124,9980,9985,4113,9965,
+4126,4104,9964,9997,4128,9968,9984,16955,9970,10000,9996,4102,
+4112,10566,4125,4110,9966,16932,9995,4114,9992,10005,9972,9981,
+15034,15611,10003,9993,4109,9979,4103,4101,4119,16800,18126,9977,
+10004,10002,4107,10006,4111,4118,18051,9967,10542,9976,4105,4123,
+4120,4108,9986,9971,4121,9988,4115,4117,4100,18052,9990,9982,
+9969,4116,9998,10001,9978,9989,17026,4106,4489,9987,10541,9994,
+16960,9973,10551,10561,4492,10560,10572,4494,10558,15954,10562,4505,
+10553,4497,16961,10565,11162,4509,4508,10567,10550,10577,4503,4493,
+10570,10574,10579,10568,10556,4496,4499,4507,4502,10559,9983,16963,
+10555,10578,4498,15294,4501,10580,4490,10569,10543,10575,5116,18055,
+10557,4491,10552,4495,10544,4122,10548,16789,10573,10549,10547,4500,
+10546,10564,10563,10576,10554,4504,16953,11165,16966,4843,4833,11177,
+11157,4835,11169,4842,4837,11167,11662,11173,11179,11172,11155,11170,
+11181,11183,4832,11182,4838,4844,15911,4841,11176,4840,11171,15291,
+11159,11164,18056,11175,4839,4836,4831,4834,11163,10545,11158,11161,
+11178,11166,11156,11661,11180,11160,11174,16968,11664,5120,5108,15476,
+15475,5112,11666,11672,11670,5118,11673,11665,5113,11669,11668,11674,
+5119,5114,5117,11667,5121,5115,5122,5109,11671,14501,12110,16951,
+5355,12107,12109,5353,12105,12106,12101,18146,11168,12102,5354,12098,
+5351,12111,5352,12104,5357,12103,5519,12461,12467,5520,12458,5517,
+5514,12469,5518,15478,5515,12460,12108,12459,5516,12466,12783,12462,
+18062,12774,5661,12777,5662,12786,12776,12773,12775,12779,12782,12781,
+12785,12772,5660,12780,12784,12787,12778,13018,16980,5754,18887,18064,
+5832,13196,13347,13346,14418,13450,5922,13448,13451,13449,13520,5956,
+5970,13596,13574,15605,13595,742,17649,19154,18066,1010,6154,6339,
+14535,1254,18856,1257,16537,6340,16981,18067,18777,6647,6649,6644,
+6641,6643,17401,1603,16587,1601,18099,6645,1602,6642,6639,1600,
+6646,6640,1604,6648,7014,18242,7018,14706,1936,15543,18128,16982,
+1928,1931,1933,1935,1932,7017,7016,7013,1934,15721,1929,18450,
+17753,17008,7015,2333,7454,16984,7462,7467,2338,14701,7452,7458,
+7451,7461,7457,2334,2336,7466,7450,7453,7459,16987,7460,7468,
+7456,2838,8050,15048,8052,8048,18272,8060,8046,8059,2834,8044,
+8690,8054,2837,15630,8055,8058,8051,14883,8056,8061,8049,8045,
+8063,8700,3279,15687,8688,8697,8687,3276,8695,8693,8694,3274,
+8698,15273,16993,17002,8691,8689,3275,8692,8696,15700,15486,14189,
+3277,8699,15045,17304,9339,9346,9348,9354,16994,3698,9334,3690,
+16996,9349,3695,9355,3686,16999,9352,18533,9336,9353,9335,3700,
+19040,9347,3687,9356,3692,9340,3697,9351,9338,9345,9341,9337,
+3689,3696,3694,3691,3699,3688,9344,15557,3693,9350,15808,9342,
+18407,15597,16384,14679,9343,18724,10014,14389,4131,14704,10010,10016,
+10012,4133,10011,10015,10007,18182,10009,4132,15675,10013,10008,18866,
+4134,16991,10017,18461,4130,10586,10583,10595,10589,10591,4510,10585,
+10593,18625,16072,10592,10590,10596,4513,10587,10594,4511,15901,10582,
+10584,4512,10581,10597,16990,10588,18059,11187,4851,17006,11198,11196,
+4845,11186,11184,11199,11194,4849,4846,11193,11191,4852,11195,4847,
+14141,4848,11192,4850,11188,11197,4853,4854,16504,5124,5131,11675,
+11681,11679,5127,5126,5123,11677,15489,5129,5128,5125,11680,11676,
+11678,5130,18158,16026,5361,12114,12116,5360,12113,18916,12112,12473,
+12115,12474,5521,12472,15803,12471,12470,5522,17009,14844,5663,17011,
+14675,14697,13025,13024,5755,13348,13452,17014,18996,13521,13621,5990,
+13641,743,17650,5132,744,1607,2339,3701,745,2839,4135,6029,
+17018,7022,7469,5133,746,1608,8701,3280,9357,15049,3702,10019,
+17021,4514,17022,5523,747,8702,748,18010,1012,6155,1011,1260,
+1259,1258,6341,16059,1609,1610,6650,7028,1939,7026,1938,7027,
+1940,7472,7471,7470,2340,2840,8064,8067,3282,2841,17027,3281,
+8706,8705,15050,8707,9359,9358,9362,17353,9361,9360,4136,10022,
+15051,10021,4137,10020,10598,10599,4515,12479,5524,12478,12477,5756,
+12790,13199,13522,749,17652,6063,853,6064,6342,1611,6346,1262,
+6344,1261,6348,6345,6654,7029,6652,6659,17354,1612,1615,6660,
+6656,6651,1614,6653,1613,6658,16279,7036,7030,7031,1941,7034,
+7032,7478,7475,7477,2345,2344,2342,7474,7479,2341,2343,7476,
+8075,7473,7480,16282,8070,8074,8073,8709,8720,8076,18154,8071,
+8708,2845,2844,8069,8072,2846,2843,2842,8068,8077,8711,8718,
+3284,8717,8714,17034,3286,15728,17029,16306,8716,17035,8710,8712,
+8715,8713,3285,8719,3283,3703,18155,17356,9366,9365,9363,3706,
+3705,9367,18156,9364,10023,4138,3704,17402,9369,9368,10026,10024,
+4516,16209,4139,10025,10601,4517,10600,10609,10608,10606,10607,10610,
+4857,11204,11210,11209,11207,5134,16280,5135,11682,16084,5363,12117,
+5362,5525,5526,5664,12792,12791,13026,13200,5834,13350,13349,13351,
+854,7037,2346,2847,8078,855,6065,750,18918,6158,18149,6349,
+1263,6350,14838,16522,6668,14683,1618,6666,6662,6665,6661,1620,
+6664,16519,1617,1616,17037,1619,6667,6663,1947,1950,7045,7044,
+7043,1944,7052,7042,18868,1946,7485,7049,7047,1949,7039,7050,
+19123,7041,7051,7048,7040,17040,1945,7053,7038,1948,16667,17036,
+15127,7490,7481,7492,16499,7484,7482,7494,7491,7489,7493,2352,
+2350,18160,15523,7487,17061,7483,15546,7486,7497,7488,2351,7046,
+2347,2349,16401,15531,8092,8081,8079,17050,8080,15353,8087,15532,
+8088,8084,2852,8089,8086,8083,18875,2850,8082,2848,2851,8085,
+8093,2348,2849,8091,8090,2853,17772,15334,14836,17051,8725,16557,
+18163,8726,3296,14557,8732,8734,8727,3290,8731,8730,3291,3297,
+3298,8733,3288,8724,8722,8728,8721,3295,8723,8729,8735,3289,
+3294,15073,15113,17054,3287,3713,9376,3712,9380,14874,9370,15319,
+9381,17060,15541,17041,19116,9382,9379,9374,9373,16945,9383,3709,
+14837,9375,3714,3708,17094,3711,3710,17058,19020,10027,4141,4140,
+16641,10032,15086,4518,4142,15335,17064,4144,10033,3707,4143,10029,
+10031,10028,17065,10030,17062,10620,15057,10619,10616,4521,11211,4522,
+10615,17068,4520,10617,10614,10611,10618,4519,14881,18077,11214,11216,
+11685,4860,14835,11212,15114,4858,19021,4862,4861,11213,11217,4859,
+16752,11692,5138,5364,5139,5136,11689,11687,11693,5137,11691,11686,
+15525,12120,12123,12482,12118,18922,12793,12124,5527,12122,5365,12119,
+12121,12125,12483,12481,19125,5528,12480,15070,5665,15003,18170,5758,
+13202,5757,13204,13201,13203,5886,13453,856,6669,2854,9384,4863,
+5529,5835,13454,857,16382,6670,288,16358,16283,16351,9387,9386,
+9385,10034,4145,16350,10622,10621,17079,11697,12127,12126,5366,12484,
+13027,858,17795,1951,2857,9388,17080,859,7502,2858,6159,1265,
+1264,1952,7056,8737,16007,17754,6355,6354,15867,1621,6673,17087,
+1956,1954,17086,1955,1953,16363,2353,15082,2357,2356,7503,2355,
+2354,7504,15729,2861,8095,8094,3302,3301,8739,18173,17089,8738,
+2862,3717,9390,3718,9389,16207,10037,10623,4523,11219,15077,11698,
+5531,5530,5836,866,6674,18175,17093,2863,10038,4146,558,1622,
+17095,7060,1957,7505,16045,17096,2866,7511,2367,2365,7512,7507,
+2364,2363,2358,7510,7509,7506,2366,16275,7508,2359,2360,18177,
+2868,8096,8098,8102,8101,8097,8747,3307,3306,8741,3304,17358,
+8744,3308,8745,3309,8742,3303,3305,8746,8743,8740,9392,3720,
+3723,3722,3727,3726,9404,9402,9395,9399,9398,3724,9401,9397,
+9405,9396,3725,3719,3721,17097,9394,16271,10040,4150,10044,4149,
+10041,4148,9393,9400,10043,4151,10045,10042,10039,10626,10630,10632,
+10628,10627,10625,4526,4524,10629,4527,10624,4528,4147,10631,4525,
+17098,11221,11220,11228,11222,11227,11224,4866,11226,4868,15984,11225,
+11223,5141,11699,5140,11702,5142,18178,15986,17100,12131,17099,5369,
+12132,16112,5367,12133,5368,12130,12134,5532,12485,5533,5666,12129,
+5667,16042,16297,5759,13028,5838,13205,5837,17101,13352,15083,18179,
+13635,559,1962,7061,18181,867,1013,6160,17363,6358,1268,8104,
+7513,2368,17364,2869,8103,17104,8749,3313,8748,3312,9406,4531,
+10636,11703,17110,12135,12795,12794,13206,868,6676,2369,3314,9407,
+17111,10046,4532,11229,12136,12796,869,1626,1968,7062,1969,1967,
+1966,7514,2370,2871,8105,2870,18891,8750,2872,3315,9408,4153,
+4533,4870,11230,4869,11704,5143,12137,12797,870,1269,6679,6678,
+1627,6677,1628,6680,7068,1972,1971,7070,7069,1976,1977,7063,
+1973,7067,1974,15714,7517,7521,7519,7518,7515,17118,7525,7520,
+16360,8114,17119,7526,2376,2373,8112,8111,8116,2876,2873,2877,
+8106,2878,8115,2875,8113,2874,18186,8753,8755,8754,8757,3316,
+9417,9409,9413,17123,9418,9414,3730,3738,4157,3741,3734,3739,
+3732,9416,3740,9415,3736,3731,3737,9419,10051,10053,18089,15104,
+3735,17175,15108,10048,4155,10054,4156,10052,10047,10050,10055,4154,
+10049,4535,10640,10639,4538,4536,10637,4534,10638,11240,18190,11239,
+11231,11235,11234,11232,4871,11233,5148,11712,5145,11706,5147,5149,
+17125,5146,11711,11707,5144,11710,11705,11709,11708,15987,12139,5370,
+18193,5371,12138,15281,12488,16833,18194,12798,12801,5760,13353,13455,
+5971,871,1978,18894,8760,872,1270,1629,16513,8761,3317,3742,
+5150,11713,12489,12802,873,17129,6686,6681,6683,6685,6684,6682,
+1630,16341,1979,7081,7076,7073,15942,7080,7079,7078,7077,7082,
+1980,18196,2381,15123,2387,2386,7535,7529,7527,2384,8123,2379,
+7532,7536,7538,7534,7528,2385,7533,7531,2378,7539,2388,7537,
+2382,7530,2383,2380,17366,16410,15466,15044,2880,15403,8124,18197,
+8117,8119,8121,15469,8122,8120,2881,8125,18198,8118,16277,15467,
+8765,3318,8773,8772,8771,8768,2879,3319,8766,8769,3320,8770,
+8767,9431,16105,9435,3749,10061,3752,9433,14056,9430,9425,9421,
+15125,3748,3747,15124,3743,9424,3751,9423,9426,9434,9432,9422,
+10063,4159,10065,9429,10067,4163,10068,10064,4160,10060,4162,10057,
+10062,10066,10059,17132,3744,17140,10056,4161,10058,17777,15459,4541,
+10642,4545,17133,10648,10651,4542,4539,10644,10641,10646,10643,4546,
+10645,15126,17134,10647,4544,17138,16268,4876,11247,11241,11245,11246,
+18874,11243,4878,4875,11242,11244,4877,11250,14977,5154,15162,16574,
+11720,11714,5153,14515,11722,5152,11715,11723,11719,5155,11716,11724,
+11721,16335,12144,12146,12145,12491,12493,12490,12495,12804,12807,12803,
+5668,12808,5669,5671,5670,13030,17136,13032,13031,18203,18202,17139,
+13207,14211,13456,13525,874,17655,17152,6359,1631,6688,7087,7086,
+1983,1986,1985,1984,7083,7085,7084,7542,2390,7546,7545,7544,
+7540,2389,2393,2396,14309,15128,2397,7541,7543,2395,2394,2392,
+2391,8132,15997,8130,8126,2882,8127,2883,8778,16744,8777,8776,
+8775,9439,3753,9436,9438,15910,3754,17148,3755,9437,15862,17145,
+17800,10077,10079,18205,10078,10075,10074,10073,10072,10076,10069,17404,
+10652,10657,10655,17150,14686,10654,10653,10656,11253,15134,4879,5156,
+11726,17153,5157,11725,12148,12147,5375,12496,5536,12809,5839,13208,
+13458,13457,6066,3757,875,1273,1272,1271,15565,6689,17157,1635,
+1634,19025,1991,16947,7089,7092,7090,19111,17159,7088,7091,7553,
+7555,7554,2401,7549,15450,2399,2398,2402,2400,2403,7552,7551,
+7550,8134,2885,8779,8781,8783,3324,18206,8780,3323,8782,3321,
+9449,9440,9443,9447,3761,9445,3759,9448,3758,3763,3762,3760,
+18883,10080,19119,16346,4167,10083,10082,4168,19112,10659,15137,4552,
+4548,4550,16267,4547,4549,14700,11254,15857,4882,11256,11255,14131,
+10081,4884,4883,11729,5158,11730,11732,11728,11727,12149,5378,876,
+6161,1274,6690,1637,1636,6691,14135,7094,1992,7093,1993,15741,
+2405,7558,7556,7562,2406,7557,7561,8138,8140,17368,2886,18926,
+8139,2887,3328,3327,3326,8784,9451,9450,10086,4170,4169,4554,
+4553,14138,11260,10660,10662,10661,11259,11257,11261,11258,4885,14137,
+18209,11733,5159,5672,15743,17776,5887,877,7563,2407,14144,18213,
+14673,14145,3038,3037,15155,3330,8786,3329,8785,14429,14385,14146,
+9453,4171,10089,4172,5673,12813,1014,1638,6692,19095,1995,15165,
+1994,7565,7567,2408,7569,7572,7570,14150,15203,7571,7568,7564,
+2409,7573,7566,16247,8149,2893,8158,2890,8151,2894,16145,2888,
+8146,8159,8147,8144,2892,15199,2889,14152,8150,8153,2891,8154,
+2895,8155,8145,8152,8156,8148,8143,8141,8157,15726,15853,15909,
+8789,8795,3333,8788,8790,3331,8787,3338,8791,3337,8792,3339,
+3334,3340,3335,3336,14151,3332,3768,9464,18215,9467,9455,9460,
+9454,3770,18216,9456,3769,14156,9463,9462,9459,9461,9457,4176,
+9466,3766,9465,4183,10100,4182,10090,10092,4175,10097,10096,10099,
+4180,10094,10093,14162,4179,4174,10095,4177,10101,10103,10098,10091,
+4178,4562,4173,14155,16148,10104,10666,4555,19140,10668,4556,17948,
+4558,10671,10663,4181,10669,3767,4561,4557,19117,4888,10670,10664,
+4563,10667,16152,14160,11271,11266,11276,4886,11268,4890,11274,11265,
+11262,11277,5165,4891,11273,11263,4889,11267,4893,11264,11269,4892,
+11272,11275,18927,11738,11745,11743,5163,11750,11270,14167,11741,16159,
+11751,5162,11740,11739,11749,11746,11748,11736,11752,5160,11747,11756,
+11744,5164,5161,11742,11737,11755,4887,18218,17369,12150,12156,5384,
+12154,12153,5386,12159,5385,12160,12157,5382,12158,12151,5383,5381,
+12502,12155,5543,5541,12501,12503,12500,5542,16156,5675,14171,12818,
+12817,12815,12814,12816,5674,5676,5761,16312,13034,13033,16127,13211,
+13213,13215,13214,13212,15167,5841,5840,5889,5888,5890,13355,13354,
+13526,13459,13527,5957,15168,5958,13575,16210,5995,1015,18076,6693,
+7098,18221,15177,1996,16154,14172,7574,7580,16157,7578,2410,7576,
+7577,7579,15176,7575,2896,8160,2898,8162,2897,8161,8797,3341,
+8799,8796,8163,3342,14174,14061,8798,15178,9470,3771,9468,3772,
+9469,3773,18224,4184,10109,10106,10108,16343,18928,14177,10673,14176,
+4564,10675,10674,15173,289,11278,15708,11279,5171,16345,5167,5172,
+5168,5170,5166,14178,5387,11757,12504,17370,12819,13217,13035,14180,
+13216,14181,13528,13597,1016,17656,1275,17773,6694,1639,1999,7106,
+1997,7104,2002,1998,2003,2001,7105,2000,2414,2413,7591,2422,
+7584,7590,2418,7583,7589,7587,2417,2419,7586,2412,7585,2423,
+2420,2424,2421,7582,7581,7588,2415,2411,2416,8178,8171,3347,
+8170,2902,2909,2906,2912,2911,2907,8164,8167,8166,2903,8168,
+8177,2904,8165,2905,8172,2910,2900,2908,8169,2899,8173,16349,
+8816,8807,3344,8814,8811,8803,8812,3346,8804,16019,3779,8809,
+14185,3343,8815,3350,3352,8802,3351,8805,3345,8813,8806,8810,
+8808,3348,8801,3353,2901,3349,3354,3775,9477,9479,9481,9485,
+9475,9473,3777,9480,9484,9476,9472,9471,14187,18902,9482,9474,
+9478,3778,3776,9486,3774,9483,19003,10126,15187,4189,10118,4577,
+10128,4192,10132,4198,10113,18135,10129,10110,15516,10131,10114,14188,
+4205,4202,10130,10124,4188,4196,4195,14190,4194,4200,10111,4201,
+10125,4197,4187,10127,4199,10116,10115,10112,10120,10117,10121,4204,
+10133,4193,17774,10119,18229,18231,4203,15182,18230,14191,10680,4569,
+4578,4574,10677,15180,4571,4575,10689,4565,10681,4573,14194,14198,
+10684,10679,4572,4576,10678,10688,4567,10687,10686,4579,10440,4566,
+14196,10685,10676,4580,10683,4568,18232,15567,15181,4898,4903,4896,
+11295,11286,11298,11290,11296,4904,4897,11283,11289,11299,11292,11297,
+11285,11293,4899,11291,4902,4901,11284,11294,4900,11301,11300,11768,
+11764,5179,11758,5173,5189,11770,5181,5177,11761,5184,5187,11772,
+5176,11763,5185,11774,11771,11759,5180,5174,5188,11766,5183,11760,
+5178,11773,5182,5175,11767,5186,11765,12163,12169,5393,12172,12164,
+12171,12166,5394,5391,18964,12162,5390,12168,12170,5392,12167,12165,
+14182,12515,5545,18929,5546,14203,12511,12509,12513,5550,12514,12507,
+12506,12510,12508,5547,12512,12820,5681,5680,12821,15953,12823,12822,
+5682,13036,13039,5763,13041,16073,5762,13218,18078,5891,5893,13356,
+5892,13460,13530,13532,13529,13531,5977,1017,17762,2004,7455,2425,
+11302,5190,11775,14210,5395,15977,12517,12516,5683,13042,15183,13219,
+5926,6162,17654,17657,1640,1276,7597,7592,7596,7594,2426,7595,
+7593,9488,9491,9487,3780,4206,16391,3783,10134,4581,10690,4582,
+16251,4905,11305,11778,11777,11776,5551,12519,13220,5927,13461,1018,
+1642,1641,7109,2005,16924,7108,7599,17371,2427,8180,7598,14214,
+2915,8183,8821,14216,3786,9493,9492,9494,3785,3784,10691,10693,
+17372,4583,10692,11306,4906,12174,18233,12173,5552,12520,5554,5553,
+12824,13043,5764,1019,7110,2006,7602,2429,7601,7600,2916,8186,
+2917,8190,15198,10138,4209,10137,10698,18153,10699,4584,10696,10695,
+10697,10694,4909,11307,11780,5191,11779,12031,5396,14222,5397,5192,
+12825,5684,1020,17661,1021,2431,1643,2430,7111,14225,3358,1022,
+2008,2007,2009,1023,7114,2433,7603,2435,2432,2434,8194,2919,
+14226,8193,8192,18236,9497,10139,18237,4585,4910,11309,11308,18238,
+14228,13044,18239,1024,6360,6695,2010,7115,2436,7604,2437,2921,
+8195,8197,8825,3359,4211,16357,10141,10140,4210,14233,16355,16348,
+10700,16347,10701,5196,5195,12177,5399,5398,12523,12826,5843,5842,
+1025,17662,3790,3360,3789,4212,1026,6067,6696,6363,6364,1278,
+6361,1277,1280,6362,1282,1281,6365,1279,1648,1646,6698,1650,
+1652,1649,6701,6697,1653,1647,1283,1651,6700,16046,18243,6699,
+17778,15995,7123,15220,7117,7120,7129,7127,2016,7133,2019,7130,
+7122,7119,8829,7128,2011,7131,7116,7125,2013,2018,7126,2022,
+2020,7118,2017,7124,2021,2012,7132,17897,2442,2451,2440,2438,
+7607,2446,2443,7609,17780,2445,7608,7606,7611,2450,2448,8828,
+7612,7610,2439,16359,2441,2444,14242,2447,15221,2449,18249,8207,
+2923,15981,8198,8200,14243,8201,8209,8205,8203,8206,8210,2924,
+2928,8199,2926,14905,2925,8204,8202,2922,2927,3366,8837,8835,
+3368,15222,8830,9511,3367,8834,15990,8831,3363,3369,8836,3365,
+8833,4213,3364,8832,3370,3362,3361,18252,9503,9501,9499,9512,
+9504,9498,3794,3800,9509,3797,19053,17348,3795,9510,3792,3791,
+9505,3796,3371,9508,9500,3793,4218,4214,4219,10144,17349,10143,
+10145,4216,10142,4217,10148,10147,10146,10708,4591,10707,4590,10704,
+10703,4589,10706,10702,18259,11312,11322,4913,4912,17252,11316,11318,
+11317,11311,11320,4911,11319,11315,16050,11321,11314,5200,11782,11788,
+5204,5206,5203,5202,18261,5201,5199,11783,11786,5198,11787,16366,
+5205,11785,11784,5400,5401,12180,12524,5555,12828,5685,12827,13045,
+13221,5844,5894,1029,18262,1654,8838,4220,5207,11789,1030,2453,
+2452,8839,17105,11323,1031,2023,4221,4914,1032,1655,7134,2454,
+7613,2929,8843,3801,4222,4915,5208,5402,12526,1033,1656,2455,
+8211,3372,4223,10149,10709,16353,1034,3373,9513,4224,1035,6702,
+7135,2024,7615,16909,2458,14256,2459,16080,8216,8213,8215,2930,
+2932,2931,8212,2933,8214,17794,8846,9516,9515,9518,10714,10710,
+10713,10715,10712,10711,18263,11791,11790,11792,12182,12181,12528,15226,
+12529,12527,15227,5686,13222,13357,13462,1036,1284,5209,1037,8217,
+8847,18265,5934,6163,18210,17763,14280,6164,6166,1038,6167,6165,
+6372,1286,1287,6369,6367,6366,6370,1285,6371,7136,6707,1659,
+6706,6708,1658,6713,1662,6703,6717,6723,1669,6720,1666,15731,
+6710,6716,6718,14268,6705,1665,1660,6711,1667,1670,1664,1657,
+6715,6709,6722,1672,1668,1663,6714,2460,6712,1661,1671,18953,
+6704,6719,6721,17891,17764,14273,2041,2035,2043,2040,7143,7146,
+2036,18267,7137,2029,2039,2042,2044,7158,7149,14281,2028,7157,
+2032,2030,2025,7141,7156,7145,7148,7161,16408,2045,7155,2037,
+7150,7160,7147,7151,7154,15991,18930,7139,7159,7153,16685,15762,
+7138,17374,7142,2038,2033,2026,2031,2027,2046,7140,7632,2034,
+16054,7152,6781,7635,2474,14282,7619,14274,7630,7626,14289,7645,
+7636,7621,7625,7648,2477,7640,7631,2461,7646,7617,2476,2471,
+7616,2469,2468,2473,7638,2465,2472,7144,8848,7633,15658,7623,
+2475,7624,7628,2478,7618,7642,7641,7649,2467,2464,7647,7643,
+7634,7629,2470,2466,7620,2462,7644,2463,7622,18269,14262,16875,
+8223,8225,8230,8250,2947,2937,8233,8240,8246,14291,2950,8248,
+8243,2945,2943,8239,8235,8221,2934,8226,8218,14316,2942,2944,
+8231,8228,2939,8244,2936,8229,8889,8237,14157,8236,2935,2938,
+8219,8224,8241,8247,2951,8220,8232,8238,2941,14294,8249,8242,
+8245,2940,16217,8864,8852,3381,8881,8890,8893,3379,8860,8885,
+8861,8875,3392,8871,3389,16469,8872,8849,14296,3398,8883,8873,
+8895,8868,9550,8898,3396,8866,8878,3399,3378,8870,8896,8863,
+8856,8867,8855,8853,3374,8887,8862,8891,15660,8892,3382,3387,
+3383,3391,8882,3384,8874,8858,3376,8850,8884,8894,8857,3390,
+8899,8869,3375,3395,18271,8880,3397,8876,3386,3380,3388,3377,
+3394,8877,8859,8879,8854,8888,15376,8897,16051,15445,14161,8851,
+18769,9571,3756,9554,16941,9552,9531,3806,9547,9567,9543,3814,
+9566,9541,3393,9557,9542,9564,3813,3805,15649,9520,9528,9553,
+9545,9570,9548,3819,9565,18200,3810,14308,9551,9559,9532,9558,
+9575,9527,9560,15229,9573,14731,9521,3385,14302,9535,9534,3812,
+16091,9538,9540,9555,9572,3815,17114,3816,18273,9526,3808,9530,
+9568,3817,3809,3811,3818,9574,9561,9556,14304,15507,9537,9536,
+3807,9522,3804,9546,9523,9544,9533,9569,14670,18121,9525,9563,
+9524,4238,10189,14166,14318,10172,15214,18118,10150,10180,4230,10165,
+10175,4233,10168,4231,10153,10183,10152,10171,15262,10151,10169,10178,
+10176,10164,10159,10157,15756,10158,10177,10188,10166,4232,4235,10160,
+10154,10170,4239,15436,18276,4227,4236,10162,10156,4229,9562,4228,
+10173,4226,4241,4234,10174,10163,10155,10182,10167,4240,10186,4237,
+10185,10179,10184,16373,10187,18277,14261,14319,15312,10743,10742,10738,
+4603,4595,10758,10757,9519,10735,10739,10733,10752,10737,18278,10759,
+10730,10728,10740,10750,10745,4605,10719,10749,14728,19147,16619,4606,
+9539,10731,10722,10725,10763,10732,10723,10721,10718,18279,4599,10741,
+4598,4602,10736,10744,4592,10760,10764,4594,10727,10747,10751,10724,
+10761,4601,4600,10716,4604,10754,10726,10746,10720,10734,10729,10748,
+10765,10762,10753,16936,14324,4593,11343,11334,11337,16482,4923,11339,
+11328,11335,11341,4920,4924,4918,14272,16399,11330,11346,11340,18281,
+11331,11355,11349,11327,11811,11333,4919,14299,11344,11354,4927,18938,
+11351,11332,11338,11342,11336,11356,11353,11350,4926,11329,11357,4925,
+11347,11348,11824,11805,11810,11823,11809,11801,11806,11794,11818,11820,
+11793,5211,11822,11814,5218,11821,11807,5220,11799,11352,11815,11812,
+11795,11826,5214,19018,5215,11797,11813,18931,11825,11816,11803,5217,
+5213,11817,11804,11827,11798,11808,11819,11800,11802,5221,11796,5219,
+5404,5210,5216,5408,12198,12188,12183,12189,12199,12203,12202,5410,
+5409,12190,12204,12193,12185,14334,12187,12186,12192,12197,12184,12191,
+12196,5407,5405,12195,5403,5406,12545,12200,5559,18951,12537,12541,
+12533,12536,12544,5557,12549,12542,18285,12534,12550,12543,12535,5556,
+5558,12530,12538,12532,15446,12548,12546,12531,12539,12837,5562,12540,
+5688,5690,5687,15440,12842,12834,12832,12836,12833,14336,12838,12840,
+5691,5693,12839,5694,5692,12841,16484,18882,15231,5689,19107,18110,
+14331,5765,13046,13052,5767,12835,13051,13058,13049,13056,13055,12831,
+13050,12201,13059,13048,13053,14341,13057,13047,13226,5766,13054,16286,
+13362,13227,13225,5895,13360,13358,13363,13361,13364,5896,13359,14529,
+13463,13630,13622,6168,1673,7651,7650,2479,2952,8252,3400,3821,
+3820,3822,10190,10766,11358,11360,11359,5222,11828,12205,13598,1039,
+14355,6725,6724,1674,18287,7165,7163,2048,2050,2049,7164,7663,
+7660,7658,2480,7661,2485,7655,7670,7672,7656,18288,2482,7673,
+7668,7654,7659,7669,7665,7662,2487,7671,7657,15240,7666,7652,
+2486,2483,7664,7667,7653,2484,2481,2962,8259,2961,17376,8262,
+8265,2958,2956,8254,8263,8261,8258,8253,2955,8256,8255,8268,
+2957,8257,2959,2954,8260,2963,2960,8264,3407,8914,8903,3404,
+9581,8912,8900,3402,8905,3405,8909,8907,3408,3401,8901,8904,
+3406,8913,8911,8906,8908,8910,3403,9582,9588,9578,9584,3823,
+9580,3829,3827,9587,9577,9590,3832,3826,3825,9586,3833,9576,
+9579,9589,9585,10222,10211,3824,4248,10199,10220,10200,4243,10206,
+10198,4245,10192,10219,4246,10193,4251,10208,10202,10209,10196,10221,
+10213,10207,10191,4247,10214,4250,10218,10212,4244,10210,10204,4242,
+10195,10203,10215,10201,4616,9583,10784,10793,10783,10779,10776,4617,
+10774,4249,10767,4615,10773,4614,10778,10775,10791,10786,10780,10785,
+4610,10777,10796,10792,4611,10797,4613,10798,10782,10194,10788,10781,
+10790,10787,15980,18087,10772,4608,10795,4609,10770,4612,11371,10789,
+10794,11368,4607,4928,11378,11374,18662,11372,11367,11382,17378,16367,
+4932,11366,11365,11379,11369,11364,11370,11381,11362,11380,11377,4930,
+4929,4931,11373,11361,15752,16364,11830,5228,11834,11831,11838,11844,
+11833,14351,11853,5225,11847,11836,11848,11843,11850,11835,5230,5229,
+11837,11851,11829,11849,5223,16380,11841,11840,11845,11832,5227,5231,
+11839,11846,5232,11842,5224,5226,12218,12216,16274,12222,12220,12223,
+14352,12209,12217,12227,11852,12213,5414,10771,12208,12221,12215,12212,
+12207,12206,12226,12211,12210,5412,12219,14349,5411,5413,12214,12225,
+16302,5566,12552,5563,12560,5567,12562,12551,12224,12564,12553,16047,
+5564,12559,12561,12556,12563,12558,12557,5565,12848,12846,16250,12843,
+13062,13065,13061,5771,13063,5770,5769,5768,13064,13233,13231,15879,
+13230,13060,13232,13066,13229,15243,13367,13333,13365,5897,13366,13368,
+13466,5928,13465,13464,5929,5959,13576,13600,13599,13601,1040,7166,
+16218,13067,13467,1041,2051,7167,14404,8271,2964,8917,8916,3409,
+3834,10799,4618,4619,14363,14918,4933,5930,1042,17666,15868,7168,
+1676,7170,7169,2052,7676,15246,7683,2488,7681,7679,7687,2492,
+7685,7682,7680,7684,17143,15248,2966,8272,2971,8288,2970,8290,
+18854,18933,8278,2968,8289,8273,2969,8285,8281,8283,8277,8284,
+14364,19115,2965,8280,16288,8279,8275,8282,8274,8276,2967,8287,
+3412,8928,8924,8926,8921,8920,8918,8925,8927,8923,15249,8922,
+8930,3842,9592,9598,14058,9599,3836,3843,9591,8919,3839,3837,
+9597,9596,3838,3840,9595,3835,15250,10224,4258,10235,10234,10229,
+4260,10233,4252,4254,15880,10231,10223,4256,4255,10227,10232,10230,
+4257,10228,18294,17146,8929,4253,10800,10807,4621,10811,4625,10803,
+10801,4620,10809,10802,4624,10808,11383,11395,4938,11390,11392,18295,
+4936,11384,11388,11391,4934,4937,11394,11393,11385,11389,4935,11855,
+11854,5234,11860,5236,5233,11856,5237,11857,11858,11861,15894,5235,
+12232,17379,12229,12231,15252,11859,12228,15254,5570,12568,12571,12573,
+12570,12572,5571,5569,5568,12569,12565,12849,5697,15251,12850,13069,
+5772,13071,5773,13068,13070,5846,13234,5845,13371,13370,13369,15850,
+13541,13540,6169,1043,18184,2053,8291,3413,9600,5415,14370,12574,
+16361,18090,1288,2972,16352,8931,3414,8933,8932,9601,3845,10236,
+10239,10238,10237,10812,10814,10813,15763,4940,14374,16377,4939,5238,
+11862,11864,11863,12576,12575,12851,5698,14375,5774,13236,13235,5960,
+17667,1289,7171,2054,8294,8292,9608,8934,9602,9606,9605,9607,
+3846,9604,9603,9609,14377,10242,10240,10241,10817,10815,10816,11396,
+12577,12852,5699,13072,13237,5847,13372,13542,1290,7173,2055,2496,
+2503,2495,2504,7688,2501,2498,2502,2500,2494,2981,15267,2975,
+8298,2980,2982,2976,17381,2974,15313,8297,2979,8295,2978,18298,
+8939,3426,3415,3419,15266,3865,9614,8941,3420,8947,16368,8949,
+8950,8938,8937,8951,3423,8948,8946,3421,3417,3428,3416,9613,
+3860,3855,3850,16270,3866,3851,3847,3862,3859,3861,3852,3857,
+9621,9618,9610,9615,3863,9622,3864,3854,16293,9612,9620,9616,
+9619,9617,3858,9611,3853,10245,4262,4265,10247,14383,4273,10246,
+4267,18299,4630,10248,4272,10244,4274,3856,4266,4264,4268,4270,
+4261,4275,4271,14397,4269,10243,14401,4637,10820,4641,10832,10825,
+4626,10833,10827,4636,10828,4635,10831,4629,10829,10819,4628,11407,
+4634,4631,19049,4639,10822,4627,10821,4638,10826,10830,10834,14786,
+4642,4946,11402,11408,11405,11397,11409,11398,4941,4947,11410,15833,
+4943,4953,4948,11412,11406,4944,11399,4954,4955,4952,4632,19034,
+4942,11413,4956,4949,11411,4945,5246,11871,11880,11877,11879,5243,
+11872,14390,11878,5239,11874,5247,11870,11875,11882,11403,11876,11869,
+5240,11868,5241,11883,5242,11881,5245,11867,14391,5244,11873,12238,
+12252,12247,12249,12237,5418,12236,5421,5420,16281,12251,12243,12240,
+12246,12241,12250,12248,5419,12255,12253,12244,12254,12245,14394,12581,
+5572,12588,16370,13075,5579,12242,12579,5575,12580,12585,18092,14396,
+12578,12587,12589,12582,12584,12586,12583,12590,5574,5580,5576,5573,
+12855,15800,5704,12853,15828,12857,12858,5702,12859,12856,15351,12854,
+5705,5701,12860,5703,5700,5776,13074,13073,5777,13238,13243,5848,
+15757,13240,18923,13239,13242,13241,5898,13375,13373,13374,19135,14399,
+5932,5931,5972,14400,5978,13602,13631,17669,8300,9623,10249,10835,
+5249,5248,12256,12591,13377,1292,7689,2505,2983,9625,9624,4643,
+10836,4644,11884,5422,18301,5987,1293,6728,7690,3429,3867,9627,
+9626,9628,4276,4957,4645,4958,11888,11885,11887,11886,5250,12257,
+12593,12592,6375,2507,2506,7691,8954,8953,3430,3869,3868,4278,
+4277,10837,11416,4959,11890,11889,12260,12259,12258,12594,14405,13603,
+1294,2058,15277,2059,7693,7692,8304,2990,2988,2985,2989,2987,
+2986,16369,3431,8957,3874,3433,3438,8959,3440,3439,3442,8958,
+8955,3436,3432,3434,8956,3441,3437,3435,3876,3875,3873,3877,
+9632,16025,4279,18302,10252,14411,10254,10840,10842,14417,4654,10843,
+4647,10839,4646,4656,4649,10838,4648,10844,10841,15278,4655,16284,
+11420,11419,18303,11421,4960,11417,16305,5254,11891,5251,5255,5253,
+5252,12261,12263,14415,12262,5423,5581,12597,5582,17779,16278,5707,
+5706,13078,14419,14414,5778,13079,13244,15983,13378,5935,18304,17670,
+2992,2991,4282,11422,4657,11423,11892,1296,7174,2061,2060,7694,
+2510,7695,8307,14817,8306,8961,3445,16233,8960,3444,8962,3443,
+9636,9639,9642,9635,9643,4284,10255,10848,10846,4658,10845,10847,
+11424,16375,11425,5256,14422,12599,12601,12598,12600,12861,13080,13577,
+1297,2062,7696,7698,7697,8310,2994,2993,8311,17258,8312,8309,
+18306,8974,3453,8966,8972,3448,3451,8965,3446,8969,9649,3450,
+8964,16258,8970,8967,8973,8963,8971,3449,3452,8968,3447,3879,
+9645,3878,9652,9651,3885,3886,9653,3880,9650,3884,9655,9646,
+9648,3881,9644,9647,9654,3882,9656,4285,10260,10266,10258,10267,
+16261,10257,10262,10268,10265,10264,10263,10256,10261,10259,15966,4664,
+4661,10857,10862,10864,10861,10854,10856,10866,10863,10858,10867,10855,
+10865,4662,4668,4666,10849,4667,4663,10850,10852,10851,16264,4665,
+15284,4660,16043,10853,11435,4962,11426,4963,4966,11431,11428,4965,
+18308,11427,11436,11429,11434,4964,4961,11430,17170,11898,5259,5257,
+5260,5258,11897,11894,11893,16259,11896,11895,12278,5429,12269,12268,
+5424,12274,12273,12265,12276,12270,5428,12267,12275,12266,5425,5427,
+12271,5426,12272,17229,12277,12605,5587,12602,17383,5584,12604,5589,
+16265,5586,16255,12603,5588,12607,5583,18637,5709,5711,12864,5710,
+12862,5585,12863,5708,5779,5781,13082,5780,13081,13249,5851,13248,
+5852,13246,13245,13547,13546,13545,13578,15285,13623,13604,5979,1298,
+2511,14430,18935,4669,14496,11437,12608,14432,13605,1299,1677,2064,
+2063,18312,2514,7699,2512,7700,2513,8317,8313,15806,2995,8316,
+8315,8314,2996,18314,8981,8979,8986,8988,18315,8980,8975,8987,
+18316,8989,8982,8985,8976,3455,8978,8977,3454,3456,3890,9658,
+9660,9659,9664,3888,9661,9657,3889,3891,9665,10272,10271,4287,
+4289,4286,4288,10870,14434,10871,4671,4676,4670,4677,4672,10872,
+10873,10869,4678,4674,4673,4675,10868,14435,11439,4968,15287,11441,
+4970,11444,11440,11438,11443,4969,11442,5262,5265,11900,15623,5263,
+11899,5261,5264,5431,15288,12282,5432,5591,12610,12609,12613,5590,
+12868,12869,12865,12870,13084,16177,13085,13083,5782,13252,5853,13253,
+13381,13380,1300,3457,3892,15764,14438,4972,18864,4971,5592,5679,
+5783,1301,2515,3893,14442,12614,560,18387,17405,17142,18633,18631,
+18630,6377,18317,1302,1305,1304,1303,6376,18318,6730,18319,6732,
+1678,18937,18606,1680,6729,6731,1679,6734,6733,6735,7178,7176,
+2067,7175,2072,2069,2066,2068,2071,2070,7177,2521,7702,7708,
+2518,2525,14449,2520,7705,7707,2523,7701,7704,2519,2516,7703,
+2522,7706,2524,2517,8321,8324,2998,3008,3004,8322,15950,3012,
+3005,3010,3000,2997,2999,3011,8323,3003,3006,3002,3007,8325,
+3009,3001,8320,8991,3458,8993,3460,3462,18320,8992,3459,3463,
+14454,3461,3899,9670,3907,9667,3908,3897,19121,3902,9669,3895,
+3894,16144,3905,3904,3903,3901,3906,9666,3896,3898,3900,15826,
+4292,4295,4299,4293,4298,4296,4291,14457,4297,4294,15464,10879,
+4681,4679,10880,15712,4682,4680,10878,10877,4976,10876,4974,4973,
+11445,4683,4975,11446,4978,11447,4977,5267,11902,5266,5271,5434,
+5268,11901,11448,5433,5435,5900,5899,1307,6174,2526,6381,6378,
+6383,6379,1308,1311,6380,1310,6382,14460,14464,6738,6740,1683,
+6736,6739,6737,1681,1684,7180,7184,7181,2077,14462,7183,7185,
+7187,2074,7186,8332,7182,7709,7718,7716,7717,7719,2528,7714,
+7710,2527,2529,7713,7720,7715,3013,8335,8327,8326,8328,7179,
+8329,3465,9000,11449,9001,8998,3015,3467,8997,9003,9002,3464,
+9006,8996,9005,8994,9004,8999,3466,9672,9678,9673,9671,9674,
+3909,9675,3910,4301,4300,10279,10282,10274,10278,4302,10277,10275,
+10281,10276,10273,10280,10886,4686,12283,10882,8995,4685,10887,10881,
+4684,4687,10885,11450,4979,11903,5272,12286,12616,12615,12873,13086,
+13254,5854,1312,2079,2078,2532,2531,7721,16201,2530,8339,8340,
+8336,3016,8337,16197,8338,17387,9009,9011,9007,9010,3468,9008,
+3469,14466,9186,3913,3912,10284,10286,4306,4303,16027,4305,4304,
+10285,10283,4691,10893,4689,10890,4690,17388,11456,16206,11457,4980,
+11453,11907,11904,11906,5275,11910,5274,11908,11911,11909,11905,5273,
+12289,12287,14467,12291,12618,5596,12290,12617,5595,5712,12875,17903,
+12874,13089,5784,15304,13382,13475,13474,5936,5962,13476,13579,14468,
+5980,1313,1685,5713,1314,2080,3017,3470,5438,1686,7189,7188,
+7724,16734,2535,2533,2537,7726,2536,2534,7725,3020,8346,15366,
+3019,3021,8351,3023,8341,3022,8352,8344,8342,3018,18865,8350,
+8345,8347,15096,9023,14382,9022,9020,9012,9027,9015,9025,9032,
+9024,3478,16057,3474,9013,9019,3476,14472,9018,3477,3479,9021,
+18323,9033,9031,19110,9030,9016,3473,9029,9014,9017,9026,18325,
+15374,15270,10321,9690,9683,9702,9711,9686,3925,15142,9699,3915,
+3917,3929,9684,16850,3918,3920,3930,3919,14474,14490,3928,9692,
+9681,3926,9691,3922,9709,3927,9707,9695,9705,3924,9682,9708,
+9703,15943,9710,3916,18326,3931,3921,14851,9688,15584,9696,9700,
+14475,9704,3923,9687,9685,9697,18327,9694,9693,15621,9698,9701,
+10289,15460,4307,10299,10291,4313,4317,10308,10316,10301,4309,15873,
+10305,9689,15545,4310,10312,10317,10309,15029,10311,10320,10313,10295,
+10304,18109,4314,10293,10306,4312,10300,4311,10314,10297,10290,4315,
+10319,10292,10310,10307,10302,10288,10287,10296,10315,4316,10318,10294,
+10298,4308,18328,4703,4698,10928,10924,10900,4694,14057,15349,4693,
+4699,15456,18330,10898,4697,10910,4692,10927,4701,10913,10918,10912,
+11475,10908,10916,10914,10901,10895,10922,4700,10923,14433,10917,10906,
+10904,10899,10907,10920,10903,10919,10925,18331,4696,15522,10915,10921,
+10911,10905,4695,18332,14692,10303,10909,4702,10902,15026,15364,11480,
+4983,11479,11477,11495,4987,18335,11492,11484,11494,11470,11482,14439,
+4989,11462,15121,11460,11493,11491,11490,11474,11473,11463,4991,11469,
+11478,11489,4994,11496,5283,4996,4990,11467,11476,11459,11461,4981,
+4993,4986,11468,11483,10926,4992,11458,5278,11485,11488,4988,14482,
+11472,4995,4985,15875,15549,4984,11481,11487,4982,11465,11486,16725,
+17015,15098,18336,16406,15988,11471,11917,15457,11922,5280,5282,11928,
+5276,11942,11934,5289,11932,11916,11931,11919,11943,5288,5286,11920,
+11939,15547,11925,11938,17000,11940,11915,5281,18108,11941,15344,14689,
+11929,14483,5285,11926,16300,5287,11935,14494,15588,5279,11921,11936,
+14585,11930,11464,11937,11918,15397,5284,12308,14693,5277,11913,18337,
+17085,15552,15072,12305,12298,5440,12293,12309,12300,11927,15676,12311,
+12294,5439,12304,5441,5449,5447,12306,5448,12296,14764,12297,12302,
+12307,15025,11912,5442,12316,12313,12640,12303,12299,12314,12629,12301,
+5445,18338,5444,11914,5446,12310,12312,5443,12315,12292,12295,15504,
+17399,15503,15917,12638,12622,5600,12636,18106,12620,5601,12631,14694,
+12627,5606,12637,12621,12624,5598,12639,16609,12632,12635,5604,5609,
+5607,12628,12623,15455,12619,5599,14880,5597,5605,12634,5608,12630,
+12641,5610,16959,17066,14690,18890,12890,12905,12892,12899,12625,12897,
+12880,12903,5716,12884,12902,12891,15572,5715,15305,12907,12893,14885,
+12898,12901,12878,12904,12889,12894,12882,12886,12906,12896,12879,12883,
+12885,12895,18341,5714,12888,14659,14544,14499,15309,12887,13093,13097,
+5791,13099,18343,5785,19105,13095,13101,5790,5786,5787,13092,13098,
+5789,13096,5788,13091,12900,13094,18344,13090,13100,17010,17013,5855,
+13261,13264,13260,13255,15461,13259,13256,18346,13384,13386,15408,13385,
+13387,13383,5901,5903,15838,5937,13477,14206,13549,13548,13550,5964,
+13551,5963,13552,13580,13583,13582,5973,13581,18347,16795,5983,13624,
+13632,1687,17672,8353,9034,10929,12642,17673,1688,2081,2538,14497,
+8354,8355,3024,3482,9036,9035,3486,3481,9037,3483,3485,3484,
+3480,15317,15316,3932,15314,9715,9713,9714,9712,14500,4319,18349,
+4322,4324,4323,14498,15315,17301,10931,10930,4704,10932,10933,4705,
+11504,11502,11949,4997,11497,11505,11499,11503,11945,11948,5294,11944,
+5293,11946,5452,12319,5450,5453,5451,12908,12910,12909,5717,5792,
+13104,13103,13102,1689,17689,6068,6177,1044,6175,6178,6176,1319,
+6387,1316,6386,6384,1317,1315,18352,16337,6741,6744,1692,6743,
+6742,1691,1690,16189,1694,6745,1693,18290,7195,7191,2082,7192,
+7193,7190,2542,7727,2543,2546,7728,18270,3025,8358,3033,8357,
+8360,3029,8359,3494,3027,3030,3026,14508,8356,3490,9039,9043,
+16198,9042,3495,3487,3489,3493,3488,15326,14509,9719,3933,4325,
+4327,4326,10323,10935,14511,10934,17135,11506,5000,11951,5295,12320,
+5612,5296,1695,2547,7729,14517,8361,3034,3496,9044,9046,3498,
+3497,3937,4328,3936,9720,4329,10936,11507,5001,5297,12321,12325,
+5456,12322,5457,5455,12326,5458,12324,12645,5454,5613,1696,3036,
+3035,3501,9048,9047,3502,14852,9724,3943,3940,9723,3942,9721,
+3941,10324,4330,10939,16141,4706,10937,10938,4709,5005,5002,5007,
+11510,5003,11509,5006,11955,11957,14537,5298,11956,5299,11954,11953,
+16307,12328,12327,5459,12329,12650,5615,12649,12646,5614,5718,14528,
+5795,19007,13105,14530,13265,18355,15337,5938,13482,5940,13481,13483,
+5939,13553,19109,13606,17635,1697,18886,3944,14540,10325,15919,1698,
+14543,4710,5616,2086,5904,2087,8362,9049,16023,9051,9050,18123,
+9728,9725,3945,10327,10332,4331,10326,10328,10335,10330,10334,10331,
+10329,10333,4332,16576,10943,14548,10941,4712,4711,10942,4713,11512,
+5011,11511,11958,15355,11960,11962,11961,14549,5300,11959,12336,5460,
+12334,12337,5461,12335,12333,12330,5462,12331,14550,18357,12651,16179,
+12653,12652,15765,12913,16181,12914,18766,14551,13107,14552,5861,18358,
+5860,5941,13484,16175,5974,2088,3503,10337,10336,10945,10944,14553,
+5301,11964,11963,12340,12338,12341,12339,14554,13108,13485,17676,2089,
+14556,11514,11965,14669,2090,14560,4333,11515,5463,12342,5618,5796,
+13390,2091,9052,3506,3951,3949,18770,17212,10338,10952,4716,10947,
+10946,15362,10951,4714,15927,5018,10948,10953,10950,10949,5016,16242,
+11517,5012,11518,14565,14564,11516,5015,5013,5017,11971,11967,11970,
+5302,15766,11762,11969,11968,14566,5466,5464,5467,5465,19054,12660,
+5620,12658,5621,12657,12659,5619,12920,12917,13109,5798,14567,5797,
+18947,13268,13267,5862,16437,5905,5942,5965,13554,2092,9053,4337,
+10954,4717,16243,5303,14575,12346,18360,5469,12663,5622,12662,12664,
+12661,13112,15224,5719,13111,14577,14576,13110,14574,13269,13609,2093,
+15371,17679,2094,18322,14582,2548,7730,8364,14583,3507,3510,3508,
+9054,14584,3512,18362,3511,3954,17253,9733,9734,10956,10341,4338,
+10343,10955,4341,4718,5019,10957,4720,4719,10958,10961,4721,18364,
+5024,5022,17390,5021,11520,11519,11972,11521,5020,11522,11975,11979,
+5473,11978,11981,11980,11977,11976,18365,15357,14586,12349,15377,12348,
+5472,16180,12347,17407,12667,12666,12665,5624,16313,12927,12926,15378,
+12924,12923,5721,5720,12928,13270,5863,13114,5799,13113,12925,13271,
+5906,18366,5966,13555,13610,18367,17680,2095,8365,11982,2096,18124,
+10345,10344,11523,11983,16835,5474,15383,13611,2549,3514,3513,9735,
+9737,3958,9736,3957,3959,9738,14667,10347,10349,10348,15394,10351,
+4342,10350,10346,15735,18369,10971,10973,10963,10967,10964,4723,4726,
+4728,4727,10969,10972,10970,4729,16194,4725,10962,4722,4724,18939,
+14213,5026,11529,11527,11526,15205,11532,11531,11530,11525,5025,11524,
+11528,5027,11987,14591,11991,11988,11990,11989,11986,11992,11995,5305,
+11985,11996,12354,12357,12359,12358,12352,12356,12351,14592,12353,5475,
+12350,14594,12355,12682,12671,5625,5626,12670,12675,12681,12673,12680,
+15212,12677,15388,12676,12679,12674,12672,15858,12678,12935,12933,5723,
+12932,12938,12936,15390,5724,12931,12929,12930,5726,12934,5725,12937,
+13115,13121,14593,18371,13116,5803,13122,5802,13120,13119,5801,13118,
+5800,13117,13277,13279,13278,13275,5865,13272,13276,13281,5864,13391,
+5909,14595,13392,13486,5943,13584,5975,15207,13612,5976,13628,13627,
+5991,13636,17797,10353,17202,10974,11535,17895,4730,5028,11533,16244,
+11536,5029,15767,11997,11534,12360,5476,12683,12941,12939,5804,13282,
+5912,5866,13487,5967,16298,2551,7731,14600,3960,14601,10354,4345,
+10355,10976,10975,5031,10979,10978,10977,14603,11537,11540,11539,11538,
+5030,12001,11999,11998,16151,12000,16146,5477,12362,16160,12685,12684,
+12687,5627,12686,18372,12942,12944,12943,14605,13124,13127,13283,5867,
+5944,5968,13615,2552,4733,5032,12365,16153,13284,14606,13585,7732,
+5992,2553,11541,14609,12366,16128,13128,13285,2554,10981,4735,4734,
+10980,12367,12369,12368,5481,5480,5479,14612,5806,13129,5805,13287,
+13286,5945,13488,3041,9741,10985,10982,10989,18373,4737,10988,10984,
+10983,10987,10986,4736,11552,11547,11545,11554,11546,15419,11542,17393,
+11548,16921,11543,12011,11544,11555,17955,14617,16301,11551,5033,11550,
+11549,12003,12006,16214,12005,15422,12013,12008,12012,12010,12009,12007,
+5309,5308,5310,5307,12014,16308,12375,12378,12376,12380,12373,5486,
+12374,12372,12379,12371,12370,5485,5483,5482,12377,12697,12703,5630,
+12698,12701,12705,5631,12700,18374,12692,12691,12704,12695,12693,12702,
+12694,5629,5628,15297,12699,16087,12696,18375,12947,12950,12948,12954,
+12952,12946,12957,16186,12945,14620,5728,12953,12949,5727,12956,16158,
+18715,13132,13131,17954,18378,13138,13134,13137,5808,17894,13130,13133,
+5807,16162,15751,5869,13298,13293,13297,15417,13300,13296,13292,15742,
+5871,13295,13299,5870,13290,12951,13294,13291,15985,13288,13289,5868,
+13399,13401,13404,13400,13405,15414,13398,13396,15415,5913,13402,5915,
+5914,13397,13403,16063,13493,5946,13494,13492,13489,13491,13490,13556,
+13558,13557,13588,16033,13587,13586,13589,13633,13637,15416,17682,3042,
+9055,9744,3961,9742,4350,4348,10363,4349,10996,10999,10993,11000,
+10992,10994,10995,10998,16187,4740,11003,11002,4738,10997,11001,4739,
+11560,5034,15484,11557,11563,11566,11562,11559,11567,11558,15425,11564,
+5035,11556,5036,5037,11561,12023,12021,12015,16458,12018,12028,12022,
+14638,12030,12027,5312,12029,12016,16299,12024,18381,12385,12387,12390,
+17721,12384,16074,5487,12392,12383,12393,12389,12391,12395,12388,12396,
+12386,12382,5488,15982,12394,5489,5633,12017,12731,12722,5635,12718,
+5636,15276,17211,12727,12721,12711,5634,12724,12706,12713,12728,12725,
+16126,12717,14629,12729,12712,12707,12726,14630,12709,12723,12714,12730,
+12710,5632,12708,12962,17395,12967,12979,12970,12963,12959,12972,12965,
+12968,12961,12975,12958,12966,12971,12973,12976,12960,15435,12974,12978,
+12969,16176,13154,13157,13156,13161,13159,5810,13150,13140,13139,5812,
+13149,13141,18384,13146,12977,17394,13142,5811,13148,14633,13147,13143,
+13155,17785,13144,13305,13158,13160,13151,13145,13306,13308,13302,5872,
+14622,13315,13313,5873,13312,13311,13304,13301,13307,13316,13303,13309,
+13414,13419,13409,13412,5916,13416,13423,13310,13410,13420,13424,13415,
+13408,13418,13417,13422,13421,13314,13413,13407,13411,13406,18385,13505,
+13496,13504,13495,13498,13506,13500,13499,13497,13503,17790,13559,17786,
+13560,14632,13562,13561,13564,13563,13591,13590,13616,13617,15428,13629,
+5989,5993,16260,13638,5994,17683,5729,13162,17400,3044,9745,16143,
+3962,11004,16246,16114,11568,12034,12033,5313,12398,12035,12397,14641,
+12733,5637,5639,12732,14642,16316,5638,16167,12982,12984,12983,13163,
+5813,14643,5917,13507,13565,14644,13642,3045,18756,10364,16245,4741,
+14646,16018,17396,11572,11571,14647,12036,18388,5640,5730,13317,13634,
+3046,4351,18389,4742,15736,12734,14649,13425,3515,17684,18390,17783,
+12037,5969,3516,4743,5314,13426,3517,11005,5041,12038,5318,5315,
+12399,5490,12986,12985,12988,12987,5731,13166,13165,5814,13318,18393,
+5918,13566,13592,5986,18394,9056,11575,12039,12735,9746,18382,12040,
+12401,12400,14656,13429,5951,14657,13567,13593,11576,3964,5491,12402,
+14661,13168,5815,13169,13167,13430,12043,12042,12041,12403,16272,17952,
+12407,12406,12405,12404,5492,12736,12990,5732,12989,13170,13321,13320,
+5874,13319,13433,13432,13431,14663,11577,5319,13322,13434,18395,14666,
+13509,13568,13618,13644,4353,5320,12408,12739,13171,13435,18755,4745,
+16256,12044,12409,12995,16163,12991,5816,12994,12993,5733,12992,5735,
+18105,5734,13173,13172,14672,5876,13323,5875,13437,13436,5953,5952,
+13569,13572,13571,13570,13643,18048,5042,14674,5500,12996,13174,5877,
+13324,19104,19096,13645,17799,17990,12045,13594,16240,18852,18893,18900,
+18932,18934,18936,18941,18963,14005,14007,19039,19064,19126,19142,19146,
+19150,19155,16816,14149,18536,14423,17862,17075,18505,15154,17789,17681,
+16381,15851,18510,14437,14879,15509,14780,15624,15310,15030,16432,14828,
+18151,15861,14754,15244,17030,15066,15539,15960,14976,15704,15511,15346,
+14350,16630,17316,16812,16486,14979,18455,17031,14655,15200,18516,18451,
+14711,14392,16510,18488,14558,17291,16113,16564,14768,17176,14715,14492,
+17038,16562,18415,18411,15039,16957,14929,18943,14966,15235,18727,16012,
+19048,17163,17228,17024,15275,18462,14930,15268,16688,18652,18537,16950,
+18559,18477,15193,18434,14944,18566,17294,15629,14737,18416,15662,16594,
+17919,14589,18569,17003,15685,18111,18433,18527,14251,18548,16765,14920,
+14870,15587,16016,14616,18914,15100,15449,14770,18074,18489,18589,15860,
+18547,17853,16855,18456,14990,16721,18469,14908,14996,14822,16021,18435,
+16535,18767,15804,17634,19062,18651,18418,14611,18889,16590,14159,15661,
+16622,14173,16706,15578,18579,14808,15579,14710,16934,17636,16356,17688,
+14229,18436,14926,14223,14002,16044,16905,14668,18771,18419,14142,16101,
+18580,14816,14320,14815,18666,15341,18396,18437,16956,17242,14247,16455,
+15782,19075,14935,14478,18629,17251,15957,17076,18649,15527,15645,14901,
+15237,14954,14343,18677,14814,18924,15893,16669,17850,16757,18457,17057,
+15892,18710,15906,14523,18632,15338,18973,14598,17278,16566,18420,18085,
+14727,18479,15648,15563,14520,14696,16697,15849,17902,14707,17174,18439,
+15577,17877,15854,18663,14170,17201,14230,18975,17167,17296,18549,17268,
+17849,17913,18093,17623,17300,17620,14000,19145,17617,15842,15693,18228,
+17861,16132,17616,18611,18985,17298,16698,17194,16216,18141,17185,17910,
+18506,18400,16561,15239,14965,14133,18706,15363,16841,18421,19093,15601,
+15639,18607,15402,15899,17653,17198,14945,18600,18422,15432,18749,15112,
+16906,15391,18159,15095,15433,17847,16834,16732,19055,18511,17241,18674,
+14260,18720,15548,15424,15559,15321,16916,16687,18097,18534,14978,15427,
+15669,14590,15080,14936,18870,18481,16943,18127,14428,18954,17158,17628,
+17108,14753,14416,18601,16645,17107,15016,18540,16425,14526,15191,15542,
+15061,16777,15864,16294,15832,14164,15844,14201,14747,16392,16889,14627,
+14986,14378,16926,15881,17155,14912,15215,16135,15691,16421,16879,16623,
+17165,18582,18440,17056,16448,18861,14481,18741,16920,16413,17791,15846,
+14631,18201,14636,14455,18602,17878,14445,18716,14614,16974,18522,15979,
+16808,15472,16404,15558,15202,18742,16967,17717,19019,17196,14868,16395,
+18884,17876,15393,18658,17851,16551,14938,16621,18855,17872,18583,16607,
+19037,14410,16491,14406,16970,18644,16897,18729,14279,18617,18104,18147,
+14572,15185,15465,16768,19010,18604,17071,19097,18119,18524,18709,18712,
+17126,14393,14733,18525,18575,18471,18297,17127,18613,15412,14458,14695,
+19059,15920,16964,16136,17899,16689,18670,16543,17285,14677,14569,15544,
+18446,17942,14175,18695,15874,14562,18952,17183,16067,14278,17116,14258,
+16933,17937,16771,15122,14337,16749,16451,14971,18684,17078,15930,14961,
+15345,14425,15520,15145,15871,17048,16449,15089,15242,14263,15823,14624,
+18472,14634,14732,14270,18484,14804,17855,15973,14708,18618,17254,16886,
+14740,18700,17225,17854,16927,14660,16533,16069,19047,14293,16628,16037,
+15230,18101,15903,17235,16637,16414,14776,14625,15488,14136,15575,15211,
+15120,18558,14924,18584,18608,14339,16454,14969,15431,15480,19065,18905,
+18701,18483,17047,15405,18609,14361,18942,14907,15773,19148,14678,16911,
+15241,16913,14413,14925,18541,18044,16714,19058,17269,18779,15094,15084,
+17240,15471,15797,15788,17802,18627,16659,16861,18560,14287,15194,17803,
+15876,16142,14408,18402,18673,17940,16407,14480,18744,15031,16979,18571,
+15453,14444,16397,14628,14812,14360,15689,17042,14237,18892,14362,16405,
+15540,16826,17781,15796,15949,19099,15075,15056,14542,18116,15331,17896,
+17180,14869,18493,16830,17204,15423,15834,17788,15210,14680,16677,15260,
+18552,15521,17049,14886,15670,15502,14917,18572,15781,19152,16423,14607,
+17263,18426,17016,16291,18999,16122,15916,17918,17287,17264,18682,18573,
+14459,14787,17141,14761,16781,18427,16653,17905,17675,17914,15790,18498,
+18782,15437,16512,18920,18139,18403,18512,14275,15551,18982,16079,15599,
+18142,18447,15561,18585,14931,14662,17117,17144,14832,14635,16838,15102,
+17005,19043,16802,17044,15325,14376,17053,14236,17004,16801,18615,14587,
+16736,15005,15885,14921,18705,18453,15421,14505,17039,15923,16944,14571,
+16954,16829,14734,15105,17297,16450,14637,16658,18554,18643,16790,14688,
+16678,14333,16603,16865,18773,16615,14301,14313,14184,14691,18454,15372,
+14859,14906,14241,17274,15494,15060,16254,17082,15306,17873,15694,17197,
+15092,16583,15604,14441,16730,14682,15228,14257,16751,18997,18642,16761,
+17193,15779,15964,16878,18150,18726,15161,18133,19101,15059,15184,14448,
+18998,15329,17250,15328,15369,18970,16733,17658,18757,18647,16723,19022,
+15632,16935,18431,14521,18508,14785,16824,18404,15047,17906,14312,17915,
+15332,17920,15771,17290,14398,17933,14504,18561,18869,15586,15188,15556,
+15253,15642,15271,16422,18562,19137,14471,14809,19100,14794,17286,18563,
+17866,16618,15681,18624,15535,17930,14871,18694,17189,15119,15109,16202,
+17887,16553,15146,18086,15785,17272,16515,15159,14818,16000,16735,19090,
+14440,16415,15055,15678,17360,14729,15172,18497,17200,14725,15792,18707,
+18675,17868,18590,17874,16508,18676,16085,14960,15647,18529,15158,18641,
+15634,19013,16424,14757,15361,16276,16034,14784,15590,14640,18542,16104,
+18145,18397,16647,18499,18405,18880,16285,14840,18096,14379,17939,14456,
+15458,18981,14783,15574,17128,17001,18408,15568,17893,14477,15117,17207,
+18458,14984,15686,18605,15028,15087,18409,17931,15550,17265,14212,18671,
+14525,18733,14993,16758,14580,14125,14937,14297,16631,14512,14186,18428,
+14453,18071,14503,17081,17223,16895,16549,16487,14402,15912,14964,14516,
+14994,14484,18714,14487,18443,14488,15140,14463,17043,15327,16503,14238,
+14534,15201,18885,18501,18084,15709,15157,14245,15710,18704,15878,18620,
+16058,15683,17904,15510,17907,14736,14974,14903,18626,15707,15399,14882,
+16881,15698,16417,14602,18664,18082,18574,14479,18081,18502,14819,18616,
+16139,18877,14862,18653,18909,16832,14763,14234,18460,18958,18495,16344,
+15837,18490,18703,17279,15292,16942,14943,14972,18995,14596,15358,18468,
+18783,18636,18430,18735,17888,16106,15898,15347,17870,18698,17232,17859,
+18610,18503,15067,17723,18445,14388,17151,16717,14221,16338,14915,15673,
+17947,16032,16665,14847,15776,18596,16430,14681,15809,14719,17660,17243,
+15368,14215,18987,15812,18983,16542,16900,18555,17364,19000,15631,16595,
+15526,17191,15370,16998,15385,14220,18639,16193,14199,15148,18692,14861,
+16779,16703,16520,14266,14927,14717,16937,18444,15190,18781,16263,16427,
+18107,15036,16429,16490,15411,15935,16946,15256,15255,18515,18530,18588,
+14827,17867,16787,16530,17073,18429,14311,15491,14286,15638,18546,18640,
+15827,15259,18556,16767,18144,19057,17113,18398,15938,16643,15001,15538,
+14760,17875,15175,15883,16627,15666,16416,17184,15223,18776,17912,17936,
+16764,14623,18080,19005,14999,15635,15695,15348,18959,18410,15023,15625,
+17633,15512,18380,18731,18448,18599,14849,15164,18449,16874,17219,14777,
+18412,18487,18568,16893,17293,17208,15010,14599,15643,18466,15258,15296,
+14684,15663,16624,16090,14759,15438,16066,14127,15839,15062,16495,15780,
+15633,14303,16852,15553,17621,17007,15701,14129,18657,15027,15562,14485,
+18681,14491,18683,15608,15333,14705,19008,16972,15640,15613,15257,18650,
+15830,14712,15197,14197,16061,15566,15644,18414,16626,18719,15002,16445,
+16385,18768,3193,18773,6333,3261,3278,18778,18779,17055,3716,4181,
+14164,3381,14296,18083,18085,14309,10178,18088,14368,18089,18090,4940,
+16377,18093,14420,2510,3015,14466,18098,18103,14633,18104,284,283,
+18116,7430,10657,18118,17354,18154,15709,18155,17356,15710,18156,17402,
+18157,15713,18161,15714,18162,18178,17361,15720,18195,15721,18196,15722,
+18203,17367,17404,15723,18206,15724,18207,17368,15727,18241,15730,18256,
+17349,18257,17350,15734,18308,17323,18309,17383,18310,17385,15736,18341,
+15737,17327,18359,15739,17389,18364,15740,17390,18365,17407,15741,18373,
+17393,17395,18384,17394,17400,17396,15744,18399,15745,18400,15746,18401,
+17335,15748,18419,15749,15753,18432,15754,15755,17328,15763,18474,15764,
+18475,15765,18476,12112,15773,5925,13037,15776,18496,18500,15785,15795,
+18509,15803,18513,15804,18514,17360,18515,18516,15807,18517,15808,15812,
+7188,15813,18522,15814,18523,15815,15816,18527,16890,18528,4841,18534,
+11438,18538,18539,15835,18540,15836,6756,18543,15844,18544,18545,15850,
+15851,18548,5124,18549,18550,8996,18551,15857,13418,18552,15858,18553,
+8849,18556,15866,18557,18563,15875,18564,18567,6023,2399,18571,15903,
+7833,15938,18583,17384,18593,15944,18594,15945,15946,18598,9665,17353,
+15948,18607,15949,17397,15950,18635,15956,18636,15961,18641,15962,18642,
+15963,15968,1510,18652,15972,16054,18666,16055,16056,18673,16057,18677,
+16060,18678,16061,18679,1832,16069,18683,16075,18687,18688,16078,18701,
+16092,18710,16124,6150,18720,16212,18721,3970,18722,18735,15049,17723,
+17347,17388,17777,17387,17778,17308,17815,17310,17816,17311,17313,17820,
+17315,17214,17850,17851,17219,17852,17221,17853,17855,17245,17856,17247,
+17860,17371,17294,17886,17295,17887,17296,17888,17297,17889,17303,17896,
+17304,17348,17339,17312,17341,17344,17981,17345,17337,17325,628,9089,
+14104,14103,14106,14105,109,122,13743,13745,108,14052,174,259,
+264,175,14051,176,208,100,209,103,257,106,105,214,
+216,215,107,265,13758,258,13759,13748,197,132,120,133,
+228,14049,196,14050,260,
+};
+
+static pdf_cmap cmap_UniCNS_UTF16_H = {
+	-1, "UniCNS-UTF16-H", "", 0, 0, 3,
+	{ {2,0,55295},{4,56320,57343},{2,57344,65535}, },
+	6328, 6328, (pdf_range*) cmap_UniCNS_UTF16_H_ranges,
+	15173, 15173, (unsigned short*) cmap_UniCNS_UTF16_H_table,
+};
+
+/* UniCNS-UTF16-V */
+
+static const pdf_range cmap_UniCNS_UTF16_V_ranges[] = {
+{8211,6,0},{8229,0,109},{12296,5,150},{12298,5,146},
+{12300,5,154},{12302,5,158},{12304,5,142},{12308,5,138},
+{65103,0,13745},{65288,5,130},{65371,0,134},{65373,0,135},
+};
+
+static const unsigned short cmap_UniCNS_UTF16_V_table[2] = {
+120,122,
+};
+
+static pdf_cmap cmap_UniCNS_UTF16_V = {
+	-1, "UniCNS-UTF16-V", "UniCNS-UTF16-H", 0, 1, 0,
+	{ {0,0,0}, },
+	12, 12, (pdf_range*) cmap_UniCNS_UTF16_V_ranges,
+	2, 2, (unsigned short*) cmap_UniCNS_UTF16_V_table,
+};
@@ -0,0 +1,11408 @@
+/* This is an automatically generated file. Do not edit. */
+
+/* Adobe-GB1-0 */
+
+static const pdf_range cmap_Adobe_GB1_0_ranges[] = {
+{0,30865,0},
+};
+
+static const unsigned short cmap_Adobe_GB1_0_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_GB1_0 = {
+	-1, "Adobe-GB1-0", "", 0, 0, 1,
+	{ {2,0,7935}, },
+	1, 1, (pdf_range*) cmap_Adobe_GB1_0_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_GB1_0_table,
+};
+
+/* Adobe-GB1-1 */
+
+static const pdf_range cmap_Adobe_GB1_1_ranges[] = {
+{0,39585,0},
+};
+
+static const unsigned short cmap_Adobe_GB1_1_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_GB1_1 = {
+	-1, "Adobe-GB1-1", "", 0, 0, 1,
+	{ {2,0,9983}, },
+	1, 1, (pdf_range*) cmap_Adobe_GB1_1_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_GB1_1_table,
+};
+
+/* Adobe-GB1-2 */
+
+static const pdf_range cmap_Adobe_GB1_2_ranges[] = {
+{0,65533,0},{16384,22969,16384},
+};
+
+static const unsigned short cmap_Adobe_GB1_2_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_GB1_2 = {
+	-1, "Adobe-GB1-2", "", 0, 0, 1,
+	{ {2,0,22271}, },
+	2, 2, (pdf_range*) cmap_Adobe_GB1_2_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_GB1_2_table,
+};
+
+/* Adobe-GB1-3 */
+
+static const pdf_range cmap_Adobe_GB1_3_ranges[] = {
+{0,65533,0},{16384,23873,16384},
+};
+
+static const unsigned short cmap_Adobe_GB1_3_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_GB1_3 = {
+	-1, "Adobe-GB1-3", "", 0, 0, 1,
+	{ {2,0,22527}, },
+	2, 2, (pdf_range*) cmap_Adobe_GB1_3_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_GB1_3_table,
+};
+
+/* Adobe-GB1-4 */
+
+static const pdf_range cmap_Adobe_GB1_4_ranges[] = {
+{0,65533,0},{16384,50717,16384},
+};
+
+static const unsigned short cmap_Adobe_GB1_4_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_GB1_4 = {
+	-1, "Adobe-GB1-4", "", 0, 0, 1,
+	{ {2,0,29183}, },
+	2, 2, (pdf_range*) cmap_Adobe_GB1_4_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_GB1_4_table,
+};
+
+/* Adobe-GB1-5 */
+
+static const pdf_range cmap_Adobe_GB1_5_ranges[] = {
+{0,65533,0},{16384,55597,16384},
+};
+
+static const unsigned short cmap_Adobe_GB1_5_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_GB1_5 = {
+	-1, "Adobe-GB1-5", "", 0, 0, 1,
+	{ {2,0,30463}, },
+	2, 2, (pdf_range*) cmap_Adobe_GB1_5_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_GB1_5_table,
+};
+
+/* Adobe-GB1-UCS2 */
+
+static const pdf_range cmap_Adobe_GB1_UCS2_ranges[] = {
+{0,0,65533},{1,377,32},{96,9,12288},{99,38,0},
+{109,5,8216},{111,5,8220},{113,5,12308},{115,29,12296},
+{123,5,12310},{125,5,12304},{127,14,10},{131,5,8743},
+{133,78,14},{153,5,8814},{155,5,8804},{157,22,34},
+{163,5,8242},{165,10,40},{168,5,65504},{170,62,43},
+{186,5,8592},{188,6,59},{190,77,9352},{210,77,9332},
+{230,37,9312},{240,37,12832},{250,45,8544},{262,9,65281},
+{265,0,65509},{266,353,65285},{355,0,65507},{356,329,12353},
+{439,341,12449},{525,65,913},{542,25,931},{549,65,945},
+{566,25,963},{573,10,61},{576,5,65306},{578,6,64},
+{580,5,65077},{582,5,65081},{584,5,65087},{586,5,65085},
+{588,13,65089},{592,5,12310},{594,5,65083},{596,5,65079},
+{598,6,66},{600,5,65075},{602,21,1040},{608,0,1025},
+{609,125,1046},{641,0,1105},{642,101,1078},{668,126,68},
+{700,145,12549},{737,0,59341},{738,301,9472},{814,373,33},
+{908,778,100},{1103,5,36776},{1105,6854,295},{2819,5,25720},
+{2821,2126,2009},{3353,5,33292},{3355,3530,2541},{4238,5,33828},
+{4240,1214,3424},{4544,5,33267},{4546,826,3728},{4753,5,21055},
+{4755,530,3935},{4888,5,35750},{4890,0,35754},{4891,5,35764},
+{4893,0,35767},{4894,5,35778},{4896,10,4068},{4899,9,35794},
+{4902,0,35798},{4903,5,35800},{4905,0,35804},{4906,5,35807},
+{4908,0,35812},{4909,5,35816},{4911,22,4071},{4917,5,35839},
+{4919,18,4077},{4924,5,35857},{4926,9,35860},{4929,14,4082},
+{4933,9,35871},{4936,6,4086},{4938,5,35882},{4940,5,35886},
+{4942,5,35890},{4944,5,35893},{4946,238,4088},{5006,5,21164},
+{5008,110,4148},{5036,5,22318},{5038,286,4176},{5110,5,33483},
+{5112,98,4248},{5137,5,33556},{5139,14,4273},{5143,5,33627},
+{5145,98,4277},{5170,5,33645},{5172,6,4302},{5174,5,33715},
+{5176,134,4304},{5210,5,33784},{5212,42,4338},{5223,5,33927},
+{5225,514,4349},{5354,5,25783},{5356,94,4478},{5380,9,21586},
+{5383,46,4502},{5395,5,21658},{5397,42,4514},{5408,5,21715},
+{5410,22,4525},{5416,5,21721},{5418,0,21724},{5419,5,21673},
+{5421,38,4531},{5431,5,21794},{5433,62,4541},{5449,9,21877},
+{5452,62,4557},{5468,5,21949},{5470,26,4573},{5477,5,21995},
+{5479,22,4580},{5485,5,22002},{5487,5,21964},{5489,110,4586},
+{5517,5,22139},{5519,78,4614},{5539,5,24123},{5541,46,4634},
+{5553,5,23704},{5555,66,4646},{5572,5,23810},{5574,174,4663},
+{5618,5,29367},{5620,54,4707},{5634,5,29434},{5636,102,4721},
+{5662,21,39271},{5668,30,4747},{5676,5,39312},{5678,9,39315},
+{5681,106,4755},{5708,5,24581},{5710,54,4782},{5724,5,24696},
+{5726,170,4796},{5769,5,38389},{5771,6,4839},{5773,5,38403},
+{5775,6,4841},{5777,13,38410},{5781,6,4843},{5783,9,38421},
+{5786,5,38425},{5788,46,4845},{5800,5,27752},{5802,26,4857},
+{5809,5,27895},{5811,138,4864},{5846,5,28051},{5848,102,4899},
+{5874,5,28243},{5876,82,4925},{5897,5,28486},{5899,270,4946},
+{5967,5,36917},{5969,10,5014},{5972,5,36945},{5974,134,5017},
+{6008,5,22953},{6010,42,5051},{6021,5,23045},{6023,206,5062},
+{6075,5,39543},{6077,10,5114},{6080,5,39552},{6082,14,5117},
+{6086,5,39570},{6088,6,5121},{6090,9,39579},{6093,5,39583},
+{6095,5,39586},{6097,22,5123},{6103,5,32424},{6105,10,5129},
+{6108,9,32448},{6111,0,32457},{6112,5,32459},{6114,14,5132},
+{6118,5,32480},{6120,6,5136},{6122,5,32494},{6124,5,32497},
+{6126,6,5138},{6128,5,32506},{6130,0,32510},{6131,9,32513},
+{6134,5,32519},{6136,5,32523},{6138,0,32527},{6139,5,32529},
+{6141,18,5140},{6146,25,32545},{6153,13,32554},{6157,17,32559},
+{6162,194,5145},{6211,5,29824},{6213,10,5194},{6216,5,29864},
+{6218,14,5197},{6222,9,38890},{6225,146,5201},{6262,5,26674},
+{6264,5,26720},{6266,94,5238},{6290,5,26911},{6292,78,5262},
+{6312,5,27015},{6314,82,5282},{6335,5,27159},{6337,82,5303},
+{6358,5,27521},{6360,6,5324},{6362,5,27538},{6364,0,27533},
+{6365,5,27546},{6367,14,5326},{6371,9,36721},{6374,5,36725},
+{6376,6,5330},{6378,5,36729},{6380,6,5332},{6382,5,36737},
+{6384,10,5334},{6387,9,36749},{6390,78,5337},{6410,9,26094},
+{6413,106,5357},{6440,5,26331},{6442,6,5384},{6444,5,36146},
+{6446,14,5386},{6450,5,36165},{6452,5,36168},{6454,18,5390},
+{6459,9,35274},{6462,13,35278},{6466,18,5395},{6471,5,29310},
+{6473,82,5400},{6494,9,27672},{6497,98,5421},{6522,13,32999},
+{6526,46,5446},{6538,5,33037},{6540,54,5458},{6554,5,33113},
+{6556,10,5472},{6559,5,33148},{6561,86,5475},{6583,9,39121},
+{6586,0,39125},{6587,5,39129},{6589,226,5497},{6646,5,25160},
+{6648,14,5554},{6652,5,31067},{6654,158,5558},{6694,5,30743},
+{6696,10,5598},{6699,5,30748},{6701,9,30777},{6704,30,5601},
+{6712,5,30806},{6714,110,5609},{6742,5,40699},{6744,14,5637},
+{6748,5,30471},{6750,26,5641},{6757,5,30544},{6759,46,5648},
+{6771,5,30623},{6773,98,5660},{6798,9,38021},{6801,6,5685},
+{6803,5,38028},{6805,5,38031},{6807,10,5687},{6810,9,38042},
+{6813,5,38051},{6815,14,5690},{6819,5,38063},{6821,6,5694},
+{6823,17,38070},{6828,5,38076},{6830,6,5696},{6832,25,38088},
+{6839,9,38096},{6842,9,38101},{6845,10,5698},{6848,9,38110},
+{6851,0,38114},{6852,5,38116},{6854,5,38119},{6856,10,5701},
+{6859,5,38126},{6861,9,38131},{6864,6,5704},{6866,5,38140},
+{6868,10,5706},{6871,5,38150},{6873,5,38153},{6875,9,38157},
+{6878,17,38162},{6883,6,5709},{6885,9,38173},{6888,0,38178},
+{6889,5,38186},{6891,6,5711},{6893,5,38193},{6895,0,38196},
+{6896,9,38198},{6899,0,38204},{6900,5,38206},{6902,6,5713},
+{6904,9,38212},{6907,6,5715},{6909,5,38222},{6911,9,38226},
+{6914,13,38230},{6918,0,38235},{6919,5,38238},{6921,0,38237},
+{6922,5,38241},{6924,33,38244},{6933,0,38255},{6934,9,38257},
+{6937,118,5717},{6967,17,40488},{6972,18,5747},{6977,5,40505},
+{6979,0,40510},{6980,5,40513},{6982,0,40516},{6983,13,40518},
+{6987,5,40523},{6989,14,5752},{6993,9,40538},{6996,6,5756},
+{6998,25,40550},{7005,38,5758},{7015,5,30131},{7017,194,5768},
+{7066,5,31352},{7068,210,5817},{7121,9,32805},{7124,62,5870},
+{7140,5,39052},{7142,6,5886},{7144,5,39066},{7146,5,39070},
+{7148,5,39073},{7150,5,39077},{7152,118,5888},{7182,5,34545},
+{7184,122,5918},{7215,5,34685},{7217,186,5949},{7264,5,32580},
+{7266,14,5996},{7270,5,31491},{7272,114,6000},{7301,5,31654},
+{7303,58,6029},{7318,5,31717},{7320,54,6044},{7334,5,33281},
+{7336,10,6058},{7339,9,33313},{7342,22,6061},{7348,5,33331},
+{7350,66,6067},{7367,5,32687},{7369,34,6084},{7378,5,31932},
+{7380,6,6093},{7382,5,31948},{7384,134,6095},{7418,5,37198},
+{7420,22,6129},{7426,5,37245},{7428,30,6135},{7436,5,37282},
+{7438,0,37290},{7439,9,37293},{7442,58,6143},{7457,5,36310},
+{7459,6,6158},{7461,5,36302},{7463,10,6160},{7466,5,36343},
+{7468,78,6163},{7488,5,36417},{7490,5,36433},{7492,170,6183},
+{7535,21,40837},{7541,18,6226},{7546,5,38588},{7548,58,6231},
+{7563,13,40069},{7567,10,6246},{7570,9,40080},{7573,5,40084},
+{7575,5,40090},{7577,21,40094},{7583,17,40101},{7588,0,40107},
+{7589,5,40109},{7591,29,40112},{7599,13,40122},{7603,13,40132},
+{7607,25,40138},{7614,9,40147},{7617,9,40151},{7620,5,40156},
+{7622,14,6249},{7626,5,38801},{7628,66,6253},{7645,5,39627},
+{7647,102,6270},{7673,5,40637},{7675,6,6296},{7677,5,40583},
+{7679,18,6298},{7684,9,40667},{7687,50,6303},{7700,5,40765},
+{7702,5002,6316},{8953,5,35473},{8955,654,7567},{9119,5,39146},
+{9121,30,7731},{9129,9,39240},{9132,422,7739},{9238,5,39491},
+{9240,22,7845},{9246,5,32007},{9248,498,7851},{9373,5,36638},
+{9375,178,7976},{9420,5,39086},{9422,146,8021},{9459,9,37330},
+{9462,106,8058},{9489,5,37484},{9491,182,8085},{9537,5,37926},
+{9539,46,8131},{9551,5,37639},{9553,90,8143},{9576,5,37852},
+{9578,274,8166},{9647,5,30278},{9649,10,8235},{9652,5,30317},
+{9654,62,8238},{9670,5,38926},{9672,458,8254},{9787,5,39914},
+{9789,430,8369},{9897,37,8560},{9907,5,714},{9909,26,8477},
+{9916,13,8598},{9920,14,8484},{9924,5,8806},{9926,0,8895},
+{9927,141,9552},{9963,57,9601},{9978,9,9619},{9981,5,9660},
+{9983,13,9698},{9987,10,8488},{9990,5,12317},{9992,33,12321},
+{10001,0,12963},{10002,5,13198},{10004,9,13212},{10007,10,8491},
+{10010,5,13265},{10012,30,8494},{10020,5,12443},{10022,5,12541},
+{10024,0,12294},{10025,5,12445},{10027,37,65097},{10037,13,65108},
+{10041,53,65113},{10055,13,65128},{10059,0,12350},{10060,45,12272},
+{10072,0,19970},{10073,9,19972},{10076,10,8502},{10079,9,19999},
+{10082,10,8505},{10085,5,20014},{10087,18,8508},{10092,9,20032},
+{10095,22,8513},{10101,5,20058},{10103,13,20066},{10107,5,20071},
+{10109,21,20074},{10115,0,20082},{10116,37,20084},{10126,9,20095},
+{10129,9,20099},{10132,10,8519},{10135,5,20118},{10137,0,20121},
+{10138,5,20124},{10140,6,8522},{10142,9,20143},{10145,0,20148},
+{10146,13,20150},{10150,9,20156},{10153,6,8524},{10155,5,20175},
+{10157,0,20178},{10158,9,20186},{10161,6,8526},{10163,5,20198},
+{10165,0,20201},{10166,9,20205},{10169,6,8528},{10171,9,20216},
+{10174,10,8530},{10177,25,20226},{10184,5,20235},{10186,17,20242},
+{10191,5,20252},{10193,6,8533},{10195,5,20264},{10197,9,20268},
+{10200,22,8535},{10206,17,20286},{10211,5,20292},{10213,21,20295},
+{10219,10,8541},{10222,5,20321},{10224,6,8544},{10226,5,20330},
+{10228,5,20333},{10230,5,20337},{10232,0,20341},{10233,13,20343},
+{10237,0,20349},{10238,9,20352},{10241,22,8546},{10247,5,20370},
+{10249,0,20373},{10250,9,20376},{10253,0,20380},{10254,5,20382},
+{10256,5,20385},{10258,10,8552},{10261,17,20400},{10266,33,20406},
+{10275,5,20416},{10277,13,20422},{10281,9,20427},{10284,17,20434},
+{10289,10,8555},{10292,5,20452},{10294,0,20455},{10295,5,20459},
+{10297,6,8558},{10299,13,20468},{10303,0,20473},{10304,9,20475},
+{10307,0,20479},{10308,17,20481},{10313,5,20487},{10315,14,8560},
+{10319,9,20501},{10322,0,20507},{10323,5,20509},{10325,0,20512},
+{10326,9,20514},{10329,0,20519},{10330,41,20527},{10341,6,8564},
+{10343,13,20543},{10347,9,20548},{10350,5,20554},{10352,0,20557},
+{10353,17,20560},{10358,13,20566},{10362,0,20571},{10363,29,20573},
+{10371,21,20582},{10377,25,20589},{10384,9,20600},{10387,5,20604},
+{10389,13,20609},{10393,5,20614},{10395,13,20617},{10399,29,20622},
+{10407,0,20631},{10408,29,20634},{10416,6,8566},{10418,5,20650},
+{10420,13,20654},{10424,0,20662},{10425,5,20664},{10427,5,20668},
+{10429,9,20671},{10432,5,20675},{10434,9,20678},{10437,17,20682},
+{10442,0,20688},{10443,9,20690},{10446,9,20695},{10449,9,20699},
+{10452,21,20703},{10458,9,20713},{10461,13,20719},{10465,0,20724},
+{10466,9,20726},{10469,0,20730},{10470,13,20732},{10474,14,8568},
+{10478,13,20748},{10482,6,8572},{10484,5,20758},{10486,21,20761},
+{10492,0,20768},{10493,29,20770},{10501,25,20779},{10508,13,20787},
+{10512,5,20792},{10514,5,20797},{10516,14,8574},{10520,9,20814},
+{10523,0,20819},{10524,9,20823},{10527,0,20827},{10528,17,20829},
+{10533,5,20835},{10535,5,20838},{10537,14,8578},{10541,5,20862},
+{10543,5,20867},{10545,5,20870},{10547,5,20874},{10549,13,20878},
+{10553,5,20883},{10555,6,8582},{10557,9,20893},{10560,6,8584},
+{10562,17,20902},{10567,5,20909},{10569,0,20916},{10570,9,20920},
+{10573,5,20926},{10575,9,20929},{10578,18,8586},{10583,33,20946},
+{10592,0,20956},{10593,5,20958},{10595,5,20962},{10597,21,20965},
+{10603,22,8591},{10609,5,20996},{10611,0,21001},{10612,5,21003},
+{10614,5,21007},{10616,9,21011},{10619,0,21020},{10620,5,21022},
+{10622,9,21025},{10625,9,21029},{10628,10,8597},{10631,5,21041},
+{10633,5,21044},{10635,6,8600},{10637,5,21061},{10639,5,21064},
+{10641,5,21070},{10643,5,21074},{10645,0,21077},{10646,13,21079},
+{10650,0,21085},{10651,5,21087},{10653,9,21090},{10656,6,8602},
+{10658,9,21099},{10661,5,21104},{10663,0,21107},{10664,25,21110},
+{10671,6,8604},{10673,9,21124},{10676,0,21131},{10677,5,21134},
+{10679,0,21138},{10680,25,21140},{10687,0,21148},{10688,13,21156},
+{10692,9,21166},{10695,37,21172},{10705,6,8606},{10707,9,21188},
+{10710,6,8608},{10712,13,21196},{10716,0,21201},{10717,5,21203},
+{10719,10,8610},{10722,5,21216},{10724,0,21219},{10725,41,21221},
+{10736,9,21234},{10739,5,21238},{10741,9,21243},{10744,13,21249},
+{10748,0,21255},{10749,13,21257},{10753,0,21262},{10754,13,21265},
+{10758,0,21272},{10759,5,21275},{10761,5,21278},{10763,0,21282},
+{10764,5,21284},{10766,9,21287},{10769,5,21291},{10771,0,21296},
+{10772,25,21298},{10779,5,21308},{10781,10,8613},{10784,9,21323},
+{10787,0,21328},{10788,5,21336},{10790,18,8616},{10795,5,21356},
+{10797,10,8621},{10800,13,21371},{10804,5,21376},{10806,0,21379},
+{10807,5,21383},{10809,0,21386},{10810,25,21390},{10817,5,21398},
+{10819,5,21403},{10821,14,8624},{10825,9,21418},{10828,9,21423},
+{10831,6,8628},{10833,13,21431},{10837,9,21436},{10840,0,21440},
+{10841,13,21444},{10845,9,21454},{10848,5,21458},{10850,6,8630},
+{10852,9,21468},{10855,14,8632},{10859,9,21502},{10862,18,8636},
+{10867,9,21528},{10870,6,8641},{10872,5,21540},{10874,10,8643},
+{10877,5,21558},{10879,10,8646},{10882,5,21569},{10884,5,21572},
+{10886,6,8649},{10888,13,21580},{10892,6,8651},{10894,17,21597},
+{10899,10,8653},{10902,29,21609},{10910,0,21620},{10911,5,21625},
+{10913,5,21630},{10915,10,8656},{10918,13,21639},{10922,10,8659},
+{10925,5,21655},{10927,0,21660},{10928,17,21662},{10933,14,8662},
+{10937,9,21685},{10940,5,21689},{10942,10,8666},{10945,5,21706},
+{10947,14,8669},{10951,9,21730},{10954,5,21739},{10956,9,21743},
+{10959,21,21748},{10965,10,8673},{10968,5,21762},{10970,6,8676},
+{10972,17,21770},{10977,5,21778},{10979,21,21781},{10985,13,21788},
+{10989,0,21793},{10990,5,21797},{10992,5,21800},{10994,10,8678},
+{10997,9,21812},{11000,13,21816},{11004,14,8681},{11008,5,21831},
+{11010,13,21835},{11014,5,21841},{11016,0,21844},{11017,17,21847},
+{11022,0,21853},{11023,5,21855},{11025,5,21858},{11027,5,21864},
+{11029,0,21867},{11030,21,21871},{11036,5,21881},{11038,6,8685},
+{11040,5,21893},{11042,9,21900},{11045,0,21904},{11046,5,21906},
+{11048,9,21909},{11051,5,21914},{11053,0,21918},{11054,25,21920},
+{11061,5,21928},{11063,6,8687},{11065,5,21935},{11067,18,8689},
+{11072,17,21951},{11077,0,21960},{11078,5,21962},{11080,5,21967},
+{11082,0,21973},{11083,9,21975},{11086,18,8694},{11091,5,21997},
+{11093,5,22000},{11095,0,22004},{11096,17,22008},{11101,0,22015},
+{11102,13,22018},{11106,0,22023},{11107,5,22026},{11109,13,22032},
+{11113,0,22037},{11114,5,22041},{11116,0,22045},{11117,9,22048},
+{11120,5,22053},{11122,0,22056},{11123,5,22058},{11125,10,8699},
+{11128,9,22076},{11131,0,22080},{11132,37,22082},{11142,17,22095},
+{11147,5,22101},{11149,5,22106},{11151,5,22110},{11153,10,8702},
+{11156,5,22125},{11158,18,8705},{11163,9,22141},{11166,13,22145},
+{11170,13,22152},{11174,0,22157},{11175,9,22160},{11178,0,22164},
+{11179,9,22166},{11182,33,22170},{11191,5,22180},{11193,0,22183},
+{11194,17,22185},{11199,9,22192},{11202,0,22197},{11203,13,22200},
+{11207,9,22205},{11210,5,22211},{11212,5,22214},{11214,0,22219},
+{11215,13,22221},{11219,5,22226},{11221,5,22229},{11223,5,22232},
+{11225,6,8710},{11227,21,22245},{11233,0,22252},{11234,5,22254},
+{11236,5,22258},{11238,9,22262},{11241,5,22267},{11243,9,22272},
+{11246,6,8712},{11248,13,22286},{11252,5,22292},{11254,0,22295},
+{11255,9,22297},{11258,5,22301},{11260,9,22304},{11263,13,22308},
+{11267,0,22315},{11268,5,22321},{11270,17,22324},{11275,5,22332},
+{11277,6,8714},{11279,13,22339},{11283,5,22344},{11285,0,22347},
+{11286,17,22354},{11291,5,22360},{11293,5,22370},{11295,14,8716},
+{11299,9,22384},{11302,5,22388},{11304,9,22392},{11307,17,22397},
+{11312,13,22407},{11316,17,22413},{11321,25,22420},{11328,13,22428},
+{11332,14,8720},{11336,9,22447},{11339,0,22451},{11340,9,22453},
+{11343,33,22457},{11352,25,22468},{11359,5,22476},{11361,5,22480},
+{11363,0,22483},{11364,5,22486},{11366,5,22491},{11368,0,22494},
+{11369,5,22498},{11371,29,22501},{11379,0,22510},{11380,13,22512},
+{11384,5,22517},{11386,5,22523},{11388,5,22526},{11390,0,22529},
+{11391,5,22531},{11393,5,22536},{11395,0,22540},{11396,9,22542},
+{11399,9,22546},{11402,5,22551},{11404,9,22554},{11407,0,22559},
+{11408,5,22562},{11410,17,22565},{11415,13,22571},{11419,5,22578},
+{11421,53,22582},{11435,17,22597},{11440,10,8724},{11443,5,22613},
+{11445,17,22617},{11450,9,22623},{11453,0,22627},{11454,17,22630},
+{11459,29,22637},{11467,9,22646},{11470,13,22650},{11474,10,8727},
+{11477,9,22662},{11480,25,22667},{11487,17,22676},{11492,6,8730},
+{11494,29,22688},{11502,13,22698},{11506,13,22703},{11510,25,22708},
+{11517,0,22717},{11518,5,22719},{11520,9,22722},{11523,0,22726},
+{11524,33,22728},{11533,6,8732},{11535,5,22742},{11537,9,22747},
+{11540,6,8734},{11542,13,22757},{11546,6,8736},{11548,5,22769},
+{11550,5,22772},{11552,5,22775},{11554,5,22779},{11556,13,22782},
+{11560,0,22787},{11561,5,22789},{11563,17,22792},{11568,0,22798},
+{11569,13,22800},{11573,5,22807},{11575,0,22811},{11576,5,22813},
+{11578,5,22816},{11580,18,8738},{11585,5,22834},{11587,5,22837},
+{11589,6,8743},{11591,5,22847},{11593,0,22851},{11594,5,22853},
+{11596,0,22858},{11597,5,22860},{11599,0,22864},{11600,5,22866},
+{11602,0,22873},{11603,17,22875},{11608,0,22881},{11609,5,22883},
+{11611,9,22886},{11614,6,8745},{11616,13,22895},{11620,6,8747},
+{11622,9,22906},{11625,9,22910},{11628,6,8749},{11630,5,22923},
+{11632,13,22926},{11636,5,22932},{11638,0,22936},{11639,9,22938},
+{11642,13,22943},{11646,5,22950},{11648,5,22956},{11650,5,22960},
+{11652,21,22963},{11658,0,22970},{11659,5,22972},{11661,25,22975},
+{11668,9,22983},{11671,13,22988},{11675,5,22997},{11677,6,8751},
+{11679,17,23006},{11684,0,23012},{11685,5,23014},{11687,9,23017},
+{11690,45,23021},{11702,0,23034},{11703,9,23036},{11706,6,8753},
+{11708,5,23050},{11710,13,23053},{11714,0,23058},{11715,13,23060},
+{11719,9,23065},{11722,5,23069},{11724,5,23073},{11726,0,23076},
+{11727,9,23078},{11730,25,23082},{11737,6,8755},{11739,17,23095},
+{11744,9,23101},{11747,13,23106},{11751,5,23111},{11753,37,23115},
+{11763,13,23126},{11767,25,23131},{11774,9,23139},{11777,5,23144},
+{11779,5,23147},{11781,21,23150},{11787,5,23160},{11789,13,23163},
+{11793,69,23168},{11811,25,23187},{11818,41,23196},{11829,5,23208},
+{11831,25,23211},{11838,0,23220},{11839,5,23222},{11841,13,23225},
+{11845,5,23231},{11847,21,23235},{11853,5,23242},{11855,17,23245},
+{11860,6,8757},{11862,9,23257},{11865,9,23261},{11868,0,23266},
+{11869,5,23268},{11871,5,23271},{11873,0,23274},{11874,17,23276},
+{11879,9,23282},{11882,17,23286},{11887,13,23292},{11891,25,23297},
+{11898,0,23306},{11899,33,23309},{11908,0,23320},{11909,25,23322},
+{11916,29,23330},{11924,17,23339},{11929,6,8759},{11931,5,23349},
+{11933,25,23353},{11940,41,23361},{11951,9,23373},{11954,10,8761},
+{11957,5,23392},{11959,5,23399},{11961,9,23405},{11964,6,8764},
+{11966,5,23414},{11968,0,23417},{11969,5,23419},{11971,14,8766},
+{11975,5,23437},{11977,9,23440},{11980,10,8770},{11983,9,23463},
+{11986,13,23468},{11990,5,23473},{11992,0,23479},{11993,9,23482},
+{11996,5,23488},{11998,0,23491},{11999,13,23496},{12003,9,23501},
+{12006,0,23505},{12007,33,23508},{12016,18,8773},{12021,13,23537},
+{12025,0,23543},{12026,5,23549},{12028,0,23552},{12029,5,23554},
+{12031,10,8778},{12034,5,23570},{12036,10,8781},{12039,13,23582},
+{12043,6,8784},{12045,13,23592},{12049,13,23597},{12053,5,23602},
+{12055,5,23605},{12057,5,23619},{12059,5,23622},{12061,5,23628},
+{12063,9,23634},{12066,9,23638},{12069,13,23642},{12073,6,8786},
+{12075,9,23657},{12078,6,8788},{12080,25,23666},{12087,13,23675},
+{12091,0,23680},{12092,17,23683},{12097,9,23689},{12100,5,23694},
+{12102,5,23698},{12104,0,23701},{12105,13,23709},{12109,17,23716},
+{12114,0,23722},{12115,9,23726},{12118,10,8790},{12121,13,23737},
+{12125,6,8793},{12127,5,23746},{12129,21,23749},{12135,21,23756},
+{12141,21,23763},{12147,25,23770},{12154,5,23778},{12156,6,8795},
+{12158,5,23787},{12160,5,23790},{12162,9,23793},{12165,0,23797},
+{12166,13,23799},{12170,0,23804},{12171,13,23806},{12175,5,23812},
+{12177,17,23816},{12182,17,23823},{12187,0,23829},{12188,9,23832},
+{12191,5,23836},{12193,17,23839},{12198,6,8797},{12200,5,23850},
+{12202,17,23855},{12207,29,23861},{12215,29,23871},{12223,5,23880},
+{12225,9,23885},{12228,25,23889},{12235,5,23897},{12237,0,23900},
+{12238,41,23902},{12249,0,23914},{12250,5,23917},{12252,13,23920},
+{12256,45,23925},{12268,0,23939},{12269,5,23941},{12271,57,23944},
+{12286,6,8799},{12288,5,23963},{12290,5,23966},{12292,21,23969},
+{12298,57,23976},{12313,6,8801},{12315,29,23997},{12323,17,24006},
+{12328,0,24012},{12329,13,24014},{12333,0,24019},{12334,21,24021},
+{12340,0,24028},{12341,5,24031},{12343,5,24035},{12345,0,24042},
+{12346,5,24044},{12348,5,24053},{12350,17,24056},{12355,5,24063},
+{12357,6,8803},{12359,9,24073},{12362,5,24077},{12364,5,24082},
+{12366,0,24087},{12367,25,24094},{12374,9,24104},{12377,0,24108},
+{12378,5,24111},{12380,0,24114},{12381,5,24116},{12383,5,24121},
+{12385,5,24126},{12387,0,24129},{12388,21,24134},{12394,25,24141},
+{12401,0,24150},{12402,5,24153},{12404,5,24156},{12406,0,24160},
+{12407,25,24164},{12414,17,24173},{12419,6,8805},{12421,9,24193},
+{12424,0,24197},{12425,5,24200},{12427,9,24204},{12430,14,8807},
+{12434,13,24225},{12438,9,24232},{12441,0,24236},{12442,17,24238},
+{12447,0,24244},{12448,13,24250},{12452,37,24255},{12462,21,24267},
+{12468,5,24276},{12470,13,24279},{12474,9,24284},{12477,13,24292},
+{12481,6,8811},{12483,21,24301},{12489,0,24309},{12490,5,24312},
+{12492,9,24315},{12495,9,24325},{12498,0,24329},{12499,9,24332},
+{12502,14,8813},{12506,5,24345},{12508,9,24348},{12511,13,24353},
+{12515,0,24360},{12516,5,24363},{12518,14,8817},{12522,9,24374},
+{12525,0,24379},{12526,9,24381},{12529,17,24385},{12534,0,24391},
+{12535,9,24393},{12538,14,8821},{12542,9,24410},{12545,9,24414},
+{12548,6,8825},{12550,5,24423},{12552,0,24427},{12553,5,24430},
+{12555,0,24434},{12556,9,24436},{12559,6,8827},{12561,9,24445},
+{12564,6,8829},{12566,9,24461},{12569,5,24467},{12571,0,24470},
+{12572,5,24474},{12574,6,8831},{12576,21,24482},{12582,5,24491},
+{12584,21,24495},{12590,6,8833},{12592,5,24506},{12594,17,24510},
+{12599,5,24519},{12601,5,24522},{12603,0,24526},{12604,9,24531},
+{12607,9,24538},{12610,5,24542},{12612,5,24546},{12614,5,24549},
+{12616,5,24552},{12618,0,24556},{12619,5,24559},{12621,9,24562},
+{12624,5,24566},{12626,5,24569},{12628,0,24572},{12629,9,24583},
+{12632,5,24587},{12634,5,24592},{12636,0,24595},{12637,5,24599},
+{12639,0,24602},{12640,5,24606},{12642,9,24610},{12645,9,24620},
+{12648,17,24624},{12653,17,24630},{12658,5,24637},{12660,0,24640},
+{12661,25,24644},{12668,0,24652},{12669,5,24654},{12671,0,24657},
+{12672,5,24659},{12674,9,24662},{12677,5,24667},{12679,13,24670},
+{12683,5,24677},{12685,0,24686},{12686,5,24689},{12688,5,24692},
+{12690,6,8835},{12692,9,24704},{12695,13,24709},{12699,5,24714},
+{12701,13,24718},{12705,6,8837},{12707,9,24727},{12710,6,8839},
+{12712,5,24737},{12714,5,24740},{12716,0,24743},{12717,5,24745},
+{12719,14,8841},{12723,5,24761},{12725,29,24765},{12733,9,24775},
+{12736,17,24780},{12741,9,24786},{12744,5,24790},{12746,10,8845},
+{12749,13,24802},{12753,6,8848},{12755,5,24823},{12757,13,24828},
+{12761,13,24834},{12765,0,24839},{12766,9,24842},{12769,17,24848},
+{12774,13,24854},{12778,5,24861},{12780,5,24865},{12782,0,24869},
+{12783,9,24872},{12786,29,24876},{12794,5,24885},{12796,21,24888},
+{12802,29,24896},{12810,6,8850},{12812,5,24911},{12814,9,24914},
+{12817,5,24918},{12819,0,24921},{12820,5,24923},{12822,0,24926},
+{12823,5,24928},{12825,5,24933},{12827,0,24937},{12828,5,24940},
+{12830,0,24943},{12831,5,24945},{12833,0,24948},{12834,37,24952},
+{12844,25,24963},{12851,5,24972},{12853,6,8852},{12855,17,24981},
+{12860,5,24987},{12862,21,24990},{12868,5,24997},{12870,6,8854},
+{12872,9,25007},{12875,9,25011},{12878,21,25016},{12884,9,25023},
+{12887,13,25027},{12891,13,25037},{12895,0,25043},{12896,33,25045},
+{12905,9,25056},{12908,5,25060},{12910,0,25063},{12911,33,25065},
+{12920,5,25075},{12922,10,8856},{12925,17,25089},{12930,10,8859},
+{12933,9,25116},{12936,10,8862},{12939,5,25128},{12941,14,8865},
+{12945,5,25141},{12947,17,25144},{12952,0,25154},{12953,9,25156},
+{12956,0,25162},{12957,5,25167},{12959,9,25173},{12962,5,25177},
+{12964,25,25180},{12971,5,25188},{12973,0,25192},{12974,5,25201},
+{12976,5,25204},{12978,5,25207},{12980,5,25210},{12982,0,25213},
+{12983,9,25217},{12986,13,25221},{12990,21,25227},{12996,6,8869},
+{12998,9,25244},{13001,0,25251},{13002,5,25254},{13004,5,25257},
+{13006,13,25261},{13010,9,25266},{13013,9,25270},{13016,6,8871},
+{13018,5,25280},{13020,18,8873},{13025,5,25309},{13027,5,25312},
+{13029,0,25316},{13030,5,25322},{13032,10,8878},{13035,13,25336},
+{13039,0,25344},{13040,13,25347},{13044,13,25354},{13048,5,25359},
+{13050,13,25362},{13054,9,25367},{13057,0,25372},{13058,5,25382},
+{13060,0,25385},{13061,9,25388},{13064,5,25392},{13066,21,25395},
+{13072,5,25403},{13074,9,25407},{13077,0,25412},{13078,5,25415},
+{13080,0,25418},{13081,13,25425},{13085,29,25430},{13093,0,25440},
+{13094,9,25444},{13097,6,8881},{13099,5,25455},{13101,9,25459},
+{13104,5,25464},{13106,13,25468},{13110,0,25473},{13111,5,25477},
+{13113,10,8883},{13116,9,25491},{13119,0,25495},{13120,25,25497},
+{13127,18,8886},{13132,5,25521},{13134,5,25525},{13136,14,8891},
+{13140,9,25537},{13143,0,25541},{13144,5,25543},{13146,9,25546},
+{13149,0,25553},{13150,9,25555},{13153,9,25559},{13156,9,25563},
+{13159,6,8895},{13161,17,25572},{13166,5,25579},{13168,9,25583},
+{13171,10,8897},{13174,13,25593},{13178,0,25598},{13179,5,25603},
+{13181,17,25606},{13186,0,25614},{13187,5,25617},{13189,5,25621},
+{13191,9,25624},{13194,6,8900},{13196,13,25634},{13200,9,25639},
+{13203,0,25643},{13204,21,25646},{13210,0,25653},{13211,9,25655},
+{13214,5,25659},{13216,6,8902},{13218,5,25666},{13220,0,25673},
+{13221,21,25675},{13227,0,25683},{13228,9,25685},{13231,9,25689},
+{13234,0,25693},{13235,25,25696},{13242,0,25704},{13243,9,25706},
+{13246,0,25710},{13247,9,25712},{13250,5,25716},{13252,0,25719},
+{13253,21,25724},{13259,6,8904},{13261,29,25737},{13269,0,25748},
+{13270,5,25751},{13272,13,25754},{13276,9,25760},{13279,9,25766},
+{13282,34,8906},{13291,5,25800},{13293,14,8915},{13297,5,25813},
+{13299,0,25817},{13300,9,25819},{13303,14,8919},{13307,17,25831},
+{13312,5,25837},{13314,0,25843},{13315,5,25845},{13317,5,25848},
+{13319,6,8923},{13321,9,25857},{13324,0,25861},{13325,5,25863},
+{13327,17,25866},{13332,5,25872},{13334,18,8925},{13339,13,25886},
+{13343,13,25894},{13347,0,25901},{13348,13,25904},{13352,6,8930},
+{13354,5,25916},{13356,17,25920},{13361,5,25926},{13363,5,25930},
+{13365,5,25933},{13367,0,25936},{13368,9,25938},{13371,10,8932},
+{13374,9,25951},{13377,5,25956},{13379,13,25959},{13383,9,25965},
+{13386,10,8935},{13389,33,25977},{13398,9,25988},{13401,9,25992},
+{13404,9,25997},{13407,18,8938},{13412,5,26013},{13414,0,26016},
+{13415,5,26018},{13417,14,8943},{13421,21,26033},{13427,0,26040},
+{13428,5,26042},{13430,9,26046},{13433,0,26050},{13434,13,26055},
+{13438,0,26061},{13439,5,26064},{13441,9,26067},{13444,29,26072},
+{13452,0,26081},{13453,5,26083},{13455,5,26090},{13457,13,26098},
+{13461,5,26104},{13463,17,26107},{13468,0,26113},{13469,5,26116},
+{13471,9,26119},{13474,6,8947},{13476,9,26128},{13479,9,26134},
+{13482,9,26138},{13485,0,26142},{13486,13,26145},{13490,0,26150},
+{13491,13,26153},{13495,6,8949},{13497,5,26162},{13499,17,26167},
+{13504,0,26173},{13505,5,26175},{13507,25,26180},{13514,5,26189},
+{13516,5,26192},{13518,5,26200},{13520,5,26203},{13522,6,8951},
+{13524,5,26210},{13526,6,8953},{13528,17,26217},{13533,9,26225},
+{13536,0,26229},{13537,5,26232},{13539,9,26235},{13542,9,26239},
+{13545,0,26243},{13546,5,26245},{13548,5,26250},{13550,13,26253},
+{13554,13,26258},{13558,17,26264},{13563,13,26270},{13567,13,26275},
+{13571,5,26281},{13573,5,26284},{13575,17,26287},{13580,13,26293},
+{13584,13,26298},{13588,17,26303},{13593,6,8955},{13595,45,26314},
+{13607,5,26327},{13609,0,26330},{13610,5,26334},{13612,17,26337},
+{13617,5,26343},{13619,5,26346},{13621,9,26349},{13624,0,26353},
+{13625,5,26357},{13627,5,26362},{13629,0,26365},{13630,5,26369},
+{13632,13,26372},{13636,0,26380},{13637,5,26382},{13639,9,26385},
+{13642,0,26390},{13643,9,26392},{13646,6,8957},{13648,21,26400},
+{13654,10,8959},{13657,5,26418},{13659,13,26422},{13663,5,26427},
+{13665,5,26430},{13667,0,26433},{13668,5,26436},{13670,0,26439},
+{13671,5,26442},{13673,6,8962},{13675,5,26452},{13677,17,26455},
+{13682,0,26461},{13683,9,26466},{13686,5,26470},{13688,5,26475},
+{13690,10,8964},{13693,13,26488},{13697,6,8967},{13699,5,26498},
+{13701,5,26501},{13703,6,8969},{13705,13,26508},{13709,13,26513},
+{13713,10,8971},{13716,9,26527},{13719,18,8974},{13724,5,26545},
+{13726,0,26548},{13727,29,26553},{13735,0,26562},{13736,37,26565},
+{13746,9,26581},{13749,10,8979},{13752,5,26595},{13754,9,26598},
+{13757,5,26602},{13759,5,26605},{13761,0,26610},{13762,29,26613},
+{13770,0,26622},{13771,13,26625},{13775,14,8982},{13779,5,26644},
+{13781,17,26648},{13786,9,26654},{13789,25,26658},{13796,25,26667},
+{13803,9,26676},{13806,5,26682},{13808,22,8986},{13814,37,26710},
+{13824,0,26730},{13825,29,26732},{13833,0,26741},{13834,33,26744},
+{13843,6,8992},{13845,29,26759},{13853,9,26768},{13856,9,26772},
+{13859,13,26777},{13863,0,26782},{13864,5,26784},{13866,9,26787},
+{13869,13,26793},{13873,0,26798},{13874,5,26801},{13876,0,26804},
+{13877,37,26806},{13887,0,26817},{13888,21,26819},{13894,6,8994},
+{13896,13,26830},{13900,5,26835},{13902,0,26841},{13903,13,26843},
+{13907,5,26849},{13909,9,26852},{13912,21,26856},{13918,0,26863},
+{13919,9,26866},{13922,9,26870},{13925,0,26875},{13926,13,26877},
+{13930,9,26882},{13933,17,26886},{13938,6,8996},{13940,45,26899},
+{13952,9,26913},{13955,29,26917},{13963,5,26926},{13965,9,26929},
+{13968,13,26933},{13972,9,26938},{13975,0,26942},{13976,5,26944},
+{13978,25,26947},{13985,29,26955},{13993,5,26965},{13995,5,26968},
+{13997,5,26971},{13999,0,26975},{14000,5,26977},{14002,5,26980},
+{14004,0,26983},{14005,5,26985},{14007,0,26988},{14008,5,26991},
+{14010,9,26994},{14013,0,26998},{14014,5,27002},{14016,9,27005},
+{14019,10,8998},{14022,9,27018},{14025,21,27022},{14031,5,27030},
+{14033,5,27033},{14035,37,27037},{14045,6,9001},{14047,5,27055},
+{14049,5,27058},{14051,5,27061},{14053,9,27064},{14056,9,27068},
+{14059,0,27072},{14060,29,27074},{14068,0,27087},{14069,9,27089},
+{14072,21,27093},{14078,9,27100},{14081,21,27105},{14087,17,27112},
+{14092,13,27118},{14096,33,27124},{14105,6,9003},{14107,5,27139},
+{14109,13,27142},{14113,29,27147},{14121,9,27156},{14124,13,27162},
+{14128,6,9005},{14130,13,27172},{14134,0,27177},{14135,13,27179},
+{14139,0,27184},{14140,9,27186},{14143,5,27190},{14145,5,27195},
+{14147,17,27199},{14152,5,27205},{14154,5,27209},{14156,13,27212},
+{14160,25,27217},{14167,0,27226},{14168,9,27228},{14171,0,27232},
+{14172,5,27235},{14174,41,27238},{14185,25,27250},{14192,5,27258},
+{14194,9,27261},{14197,9,27265},{14200,13,27269},{14204,13,27274},
+{14208,0,27279},{14209,5,27282},{14211,5,27285},{14213,13,27288},
+{14217,9,27293},{14220,0,27297},{14221,17,27300},{14226,0,27306},
+{14227,5,27309},{14229,9,27312},{14232,13,27316},{14236,5,27321},
+{14238,25,27324},{14245,57,27332},{14260,21,27348},{14266,0,27356},
+{14267,25,27360},{14274,6,9007},{14276,21,27373},{14282,13,27380},
+{14286,5,27385},{14288,29,27388},{14296,17,27397},{14301,13,27403},
+{14305,5,27408},{14307,9,27411},{14310,25,27415},{14317,0,27423},
+{14318,5,27429},{14320,37,27432},{14330,13,27443},{14334,10,9009},
+{14337,13,27455},{14341,5,27460},{14343,0,27464},{14344,5,27466},
+{14346,9,27469},{14349,29,27473},{14357,17,27482},{14362,0,27488},
+{14363,5,27496},{14365,25,27499},{14372,13,27507},{14376,0,27514},
+{14377,13,27517},{14381,10,9012},{14384,13,27534},{14388,5,27540},
+{14390,6,9015},{14392,5,27548},{14394,5,27551},{14396,5,27554},
+{14398,17,27557},{14403,5,27564},{14405,5,27568},{14407,0,27574},
+{14408,5,27576},{14410,9,27580},{14413,0,27584},{14414,5,27587},
+{14416,13,27591},{14420,6,9017},{14422,5,27600},{14424,6,9019},
+{14426,17,27612},{14431,29,27618},{14439,9,27628},{14442,9,27632},
+{14445,0,27636},{14446,9,27638},{14449,9,27642},{14452,0,27646},
+{14453,17,27648},{14458,9,27657},{14461,10,9021},{14464,9,27676},
+{14467,18,9024},{14472,5,27702},{14474,13,27705},{14478,5,27710},
+{14480,9,27715},{14483,0,27720},{14484,17,27723},{14489,9,27729},
+{14492,0,27734},{14493,9,27736},{14496,5,27746},{14498,9,27749},
+{14501,17,27755},{14506,10,9029},{14509,5,27767},{14511,9,27770},
+{14514,5,27775},{14516,6,9032},{14518,5,27786},{14520,5,27789},
+{14522,5,27793},{14524,13,27797},{14528,0,27802},{14529,9,27804},
+{14532,14,9034},{14536,5,27823},{14538,13,27828},{14542,0,27834},
+{14543,13,27840},{14547,9,27846},{14550,0,27851},{14551,9,27853},
+{14554,5,27857},{14556,9,27864},{14559,5,27868},{14561,6,9038},
+{14563,5,27878},{14565,0,27881},{14566,5,27884},{14568,10,9040},
+{14571,5,27903},{14573,5,27906},{14575,5,27909},{14577,9,27912},
+{14580,0,27917},{14581,9,27919},{14584,13,27923},{14588,0,27928},
+{14589,5,27932},{14591,21,27935},{14597,0,27942},{14598,5,27944},
+{14600,5,27948},{14602,5,27951},{14604,0,27956},{14605,9,27958},
+{14608,0,27962},{14609,5,27967},{14611,18,9043},{14616,13,27989},
+{14620,10,9048},{14623,5,28001},{14625,5,28004},{14627,5,28007},
+{14629,9,28011},{14632,13,28016},{14636,5,28021},{14638,5,28026},
+{14640,17,28029},{14645,5,28035},{14647,0,28038},{14648,5,28042},
+{14650,0,28045},{14651,5,28047},{14653,0,28050},{14654,17,28054},
+{14659,10,9051},{14662,5,28076},{14664,5,28080},{14666,5,28083},
+{14668,5,28086},{14670,21,28089},{14676,9,28097},{14679,9,28104},
+{14682,13,28109},{14686,13,28114},{14690,0,28119},{14691,9,28122},
+{14694,0,28127},{14695,5,28130},{14697,0,28133},{14698,9,28135},
+{14701,0,28141},{14702,5,28143},{14704,10,9054},{14707,29,28157},
+{14715,13,28166},{14719,6,9057},{14721,5,28178},{14723,0,28181},
+{14724,5,28184},{14726,5,28187},{14728,5,28190},{14730,0,28194},
+{14731,5,28199},{14733,6,9059},{14735,5,28208},{14737,0,28211},
+{14738,9,28213},{14741,0,28217},{14742,9,28219},{14745,13,28223},
+{14749,29,28229},{14757,13,28239},{14761,6,9061},{14763,5,28249},
+{14765,5,28252},{14767,41,28256},{14778,5,28268},{14780,53,28272},
+{14794,9,28288},{14797,0,28292},{14798,5,28295},{14800,17,28298},
+{14805,17,28305},{14810,0,28311},{14811,9,28313},{14814,0,28318},
+{14815,5,28320},{14817,5,28323},{14819,0,28326},{14820,5,28328},
+{14822,13,28331},{14826,10,9063},{14829,5,28344},{14831,0,28348},
+{14832,9,28350},{14835,6,9066},{14837,9,28360},{14840,14,9068},
+{14844,5,28376},{14846,9,28379},{14849,6,9072},{14851,5,28394},
+{14853,5,28397},{14855,5,28400},{14857,0,28403},{14858,5,28405},
+{14860,17,28410},{14865,0,28416},{14866,9,28419},{14869,5,28423},
+{14871,17,28426},{14876,9,28432},{14879,13,28438},{14883,17,28443},
+{14888,0,28449},{14889,13,28453},{14893,6,9074},{14895,5,28468},
+{14897,0,28471},{14898,17,28473},{14903,0,28480},{14904,13,28482},
+{14908,9,28488},{14911,0,28492},{14912,9,28494},{14915,5,28498},
+{14917,9,28501},{14920,5,28506},{14922,0,28509},{14923,9,28511},
+{14926,6,9076},{14928,21,28519},{14934,6,9078},{14936,5,28533},
+{14938,6,9080},{14940,5,28541},{14942,9,28545},{14945,0,28549},
+{14946,5,28554},{14948,29,28559},{14956,13,28568},{14960,9,28573},
+{14963,5,28578},{14965,5,28581},{14967,0,28584},{14968,13,28586},
+{14972,5,28591},{14974,0,28594},{14975,5,28596},{14977,5,28599},
+{14979,21,28602},{14985,17,28612},{14990,25,28618},{14997,5,28627},
+{14999,5,28630},{15001,5,28633},{15003,5,28636},{15005,5,28642},
+{15007,21,28645},{15013,5,28652},{15015,29,28658},{15023,6,9082},
+{15025,21,28671},{15031,5,28679},{15033,0,28682},{15034,9,28684},
+{15037,0,28688},{15038,9,28690},{15041,5,28694},{15043,10,9084},
+{15046,5,28705},{15048,9,28708},{15051,25,28713},{15058,0,28721},
+{15059,5,28723},{15061,9,28726},{15064,13,28730},{15068,13,28735},
+{15072,25,28741},{15079,5,28749},{15081,0,28752},{15082,9,28754},
+{15085,5,28758},{15087,13,28761},{15091,13,28767},{15095,5,28773},
+{15097,9,28776},{15100,0,28782},{15101,13,28785},{15105,0,28791},
+{15106,9,28793},{15109,0,28797},{15110,13,28801},{15114,9,28806},
+{15117,9,28811},{15120,9,28815},{15123,0,28819},{15124,5,28823},
+{15126,5,28826},{15128,49,28830},{15141,6,9087},{15143,9,28852},
+{15146,0,28858},{15147,5,28862},{15149,13,28868},{15153,0,28873},
+{15154,13,28875},{15158,29,28880},{15166,0,28890},{15167,9,28892},
+{15170,13,28896},{15174,10,9089},{15177,13,28912},{15181,5,28917},
+{15183,0,28920},{15184,9,28922},{15187,41,28926},{15198,17,28939},
+{15203,5,28945},{15205,6,9092},{15207,21,28955},{15213,13,28962},
+{15217,29,28967},{15225,13,28978},{15229,53,28983},{15243,9,28998},
+{15246,6,9094},{15248,9,29007},{15251,33,29011},{15260,0,29021},
+{15261,9,29023},{15264,6,9096},{15266,5,29034},{15268,0,29037},
+{15269,9,29039},{15272,13,29044},{15276,0,29049},{15277,5,29051},
+{15279,21,29054},{15285,17,29061},{15290,13,29067},{15294,5,29072},
+{15296,0,29075},{15297,5,29077},{15299,17,29082},{15304,25,29089},
+{15311,9,29097},{15314,13,29101},{15318,6,9098},{15320,9,29110},
+{15323,13,29114},{15327,5,29119},{15329,0,29122},{15330,13,29124},
+{15334,17,29129},{15339,9,29135},{15342,0,29139},{15343,9,29142},
+{15346,5,29146},{15348,5,29149},{15350,13,29153},{15354,17,29160},
+{15359,17,29167},{15364,13,29173},{15368,5,29178},{15370,0,29181},
+{15371,25,29183},{15378,21,29191},{15384,5,29198},{15386,37,29201},
+{15396,0,29212},{15397,37,29214},{15407,6,9100},{15409,9,29229},
+{15412,5,29235},{15414,0,29244},{15415,25,29248},{15422,9,29257},
+{15425,13,29262},{15429,9,29267},{15432,18,9102},{15437,9,29283},
+{15440,0,29288},{15441,13,29290},{15445,5,29296},{15447,5,29299},
+{15449,9,29302},{15452,5,29307},{15454,5,29314},{15456,17,29317},
+{15461,6,9107},{15463,5,29328},{15465,9,29331},{15468,29,29335},
+{15476,5,29344},{15478,13,29347},{15482,13,29352},{15486,0,29358},
+{15487,9,29361},{15490,0,29365},{15491,21,29370},{15497,9,29381},
+{15500,13,29385},{15504,6,9109},{15506,13,29395},{15510,0,29400},
+{15511,13,29402},{15515,0,29407},{15516,21,29410},{15522,5,29418},
+{15524,5,29429},{15526,9,29438},{15529,0,29442},{15530,21,29444},
+{15536,9,29451},{15539,13,29455},{15543,0,29460},{15544,9,29464},
+{15547,5,29471},{15549,5,29475},{15551,9,29478},{15554,0,29485},
+{15555,5,29487},{15557,5,29490},{15559,6,9111},{15561,5,29500},
+{15563,0,29504},{15564,5,29506},{15566,25,29510},{15573,5,29518},
+{15575,0,29521},{15576,13,29523},{15580,29,29528},{15588,25,29537},
+{15595,10,9113},{15598,5,29555},{15600,14,9116},{15604,9,29569},
+{15607,5,29573},{15609,6,9120},{15611,5,29580},{15613,5,29583},
+{15615,13,29586},{15619,13,29591},{15623,9,29596},{15626,5,29600},
+{15628,21,29603},{15634,0,29610},{15635,5,29612},{15637,0,29617},
+{15638,9,29620},{15641,5,29624},{15643,13,29628},{15647,0,29633},
+{15648,17,29635},{15653,5,29643},{15655,0,29646},{15656,25,29650},
+{15663,13,29658},{15667,0,29663},{15668,13,29665},{15672,6,9122},
+{15674,9,29674},{15677,13,29678},{15681,41,29683},{15692,13,29695},
+{15696,0,29700},{15697,5,29703},{15699,13,29707},{15703,33,29713},
+{15712,21,29724},{15718,5,29731},{15720,18,9124},{15725,5,29745},
+{15727,17,29751},{15732,5,29757},{15734,0,29760},{15735,33,29762},
+{15744,33,29772},{15753,10,9129},{15756,9,29792},{15759,17,29796},
+{15764,5,29803},{15766,5,29806},{15768,17,29809},{15773,21,29816},
+{15779,6,9132},{15781,9,29828},{15784,6,9134},{15786,5,29836},
+{15788,0,29839},{15789,41,29841},{15800,0,29853},{15801,13,29855},
+{15805,5,29860},{15807,21,29866},{15813,33,29873},{15822,5,29883},
+{15824,45,29886},{15836,13,29899},{15840,5,29904},{15842,0,29907},
+{15843,17,29909},{15848,18,9136},{15853,25,29927},{15860,13,29936},
+{15864,0,29941},{15865,25,29944},{15872,13,29952},{15876,25,29957},
+{15883,10,9141},{15886,13,29972},{15890,0,29979},{15891,5,29981},
+{15893,9,29984},{15896,0,29988},{15897,5,29990},{15899,18,9144},
+{15904,5,30012},{15906,0,30015},{15907,13,30017},{15911,5,30022},
+{15913,5,30025},{15915,0,30029},{15916,13,30032},{15920,13,30037},
+{15924,13,30046},{15928,5,30051},{15930,9,30055},{15933,21,30060},
+{15939,10,9149},{15942,17,30074},{15947,9,30080},{15950,5,30084},
+{15952,9,30088},{15955,9,30092},{15958,14,9152},{15962,5,30107},
+{15964,6,9156},{15966,17,30118},{15971,0,30125},{15972,5,30134},
+{15974,5,30138},{15976,9,30143},{15979,0,30150},{15980,5,30155},
+{15982,13,30158},{15986,10,9158},{15989,5,30172},{15991,9,30175},
+{15994,6,9161},{15996,13,30188},{16000,5,30194},{16002,13,30197},
+{16006,5,30202},{16008,5,30205},{16010,0,30212},{16011,13,30214},
+{16015,5,30222},{16017,13,30225},{16021,6,9163},{16023,5,30236},
+{16025,10,9165},{16028,5,30254},{16030,5,30257},{16032,5,30262},
+{16034,5,30265},{16036,6,9168},{16038,5,30276},{16040,0,30280},
+{16041,5,30282},{16043,21,30286},{16049,6,9170},{16051,9,30297},
+{16054,0,30301},{16055,5,30304},{16057,10,9172},{16060,17,30323},
+{16065,5,30329},{16067,9,30335},{16070,6,9175},{16072,5,30345},
+{16074,5,30348},{16076,5,30351},{16078,0,30354},{16079,5,30356},
+{16081,5,30359},{16083,33,30363},{16092,33,30373},{16101,5,30383},
+{16103,0,30387},{16104,9,30389},{16107,0,30393},{16108,13,30395},
+{16112,5,30400},{16114,5,30403},{16116,6,9177},{16118,5,30411},
+{16120,6,9179},{16122,5,30425},{16124,5,30428},{16126,10,9181},
+{16129,21,30440},{16135,6,9184},{16137,9,30453},{16140,5,30458},
+{16142,0,30461},{16143,5,30463},{16145,5,30466},{16147,5,30469},
+{16149,6,9186},{16151,41,30478},{16162,13,30491},{16166,0,30497},
+{16167,9,30499},{16170,0,30503},{16171,9,30506},{16174,0,30510},
+{16175,17,30512},{16180,6,9188},{16182,9,30525},{16185,0,30530},
+{16186,9,30532},{16189,25,30536},{16196,29,30546},{16204,5,30556},
+{16206,5,30559},{16208,6,9190},{16210,5,30569},{16212,45,30573},
+{16224,9,30586},{16227,9,30593},{16230,21,30598},{16236,5,30607},
+{16238,17,30611},{16243,17,30617},{16248,0,30625},{16249,5,30627},
+{16251,10,9192},{16254,5,30638},{16256,5,30641},{16258,0,30644},
+{16259,17,30646},{16264,0,30654},{16265,25,30656},{16272,17,30664},
+{16277,33,30670},{16286,5,30680},{16288,17,30685},{16293,14,9195},
+{16297,9,30704},{16300,5,30708},{16302,0,30711},{16303,13,30713},
+{16307,21,30723},{16313,5,30730},{16315,9,30734},{16318,18,9199},
+{16323,9,30752},{16326,6,9204},{16328,5,30762},{16330,5,30766},
+{16332,9,30769},{16335,5,30773},{16337,6,9206},{16339,5,30785},
+{16341,6,9208},{16343,13,30792},{16347,10,9210},{16350,5,30803},
+{16352,17,30808},{16357,21,30814},{16363,9,30821},{16366,0,30825},
+{16367,25,30832},{16374,13,30840},{16378,37,30845},{16388,0,30856},
+{16389,5,30858},{16391,5,30863},{16393,0,30866},{16394,9,30868},
+{16397,0,30873},{16398,5,30877},{16400,18,9213},{16405,9,30890},
+{16408,5,30894},{16410,9,30901},{16413,6,9218},{16415,5,30911},
+{16417,9,30914},{16420,9,30918},{16423,13,30924},{16427,9,30929},
+{16430,9,30934},{16433,29,30939},{16441,9,30948},{16444,9,30953},
+{16447,5,30957},{16449,5,30960},{16451,0,30963},{16452,5,30965},
+{16454,5,30968},{16456,5,30971},{16458,9,30974},{16461,9,30978},
+{16464,29,30982},{16472,13,30991},{16476,17,30996},{16481,13,31002},
+{16485,17,31007},{16490,0,31013},{16491,9,31015},{16494,13,31021},
+{16498,5,31026},{16500,17,31029},{16505,6,9220},{16507,13,31042},
+{16511,0,31047},{16512,33,31050},{16521,5,31060},{16523,5,31064},
+{16525,0,31073},{16526,5,31075},{16528,0,31078},{16529,13,31081},
+{16533,0,31086},{16534,25,31088},{16541,0,31097},{16542,17,31099},
+{16547,5,31106},{16549,13,31110},{16553,5,31115},{16555,37,31120},
+{16565,41,31131},{16576,5,31144},{16578,9,31147},{16581,6,9222},
+{16583,17,31156},{16588,10,9224},{16591,5,31172},{16593,5,31175},
+{16595,6,9227},{16597,9,31182},{16600,5,31187},{16602,5,31190},
+{16604,21,31193},{16610,9,31200},{16613,18,9229},{16618,25,31217},
+{16625,5,31225},{16627,0,31228},{16628,5,31230},{16630,0,31233},
+{16631,5,31236},{16633,13,31239},{16637,0,31244},{16638,17,31247},
+{16643,5,31253},{16645,5,31256},{16647,9,31259},{16650,0,31263},
+{16651,5,31265},{16653,37,31268},{16663,5,31279},{16665,0,31282},
+{16666,9,31284},{16669,10,9234},{16672,17,31297},{16677,17,31303},
+{16682,5,31311},{16684,17,31314},{16689,33,31320},{16698,21,31331},
+{16704,0,31338},{16705,13,31340},{16709,9,31345},{16712,0,31349},
+{16713,13,31355},{16717,10,9237},{16720,13,31369},{16724,9,31374},
+{16727,5,31379},{16729,9,31385},{16732,0,31390},{16733,13,31393},
+{16737,6,9240},{16739,13,31407},{16743,5,31412},{16745,9,31415},
+{16748,13,31419},{16752,13,31424},{16756,6,9242},{16758,37,31436},
+{16768,5,31447},{16770,13,31450},{16774,5,31457},{16776,0,31460},
+{16777,9,31463},{16780,5,31467},{16782,0,31470},{16783,21,31472},
+{16789,5,31479},{16791,5,31483},{16793,0,31486},{16794,9,31488},
+{16797,10,9244},{16800,9,31500},{16803,0,31504},{16804,5,31506},
+{16806,9,31510},{16809,0,31514},{16810,5,31516},{16812,0,31519},
+{16813,9,31521},{16816,10,9247},{16819,5,31535},{16821,0,31538},
+{16822,13,31540},{16826,10,9250},{16829,21,31551},{16835,6,9253},
+{16837,5,31565},{16839,18,9255},{16844,5,31582},{16846,0,31585},
+{16847,13,31587},{16851,21,31592},{16857,5,31599},{16859,5,31603},
+{16861,10,9260},{16864,5,31612},{16866,0,31615},{16867,13,31617},
+{16871,17,31622},{16876,0,31628},{16877,5,31630},{16879,9,31633},
+{16882,0,31638},{16883,13,31640},{16887,9,31646},{16890,9,31651},
+{16893,9,31662},{16896,5,31666},{16898,9,31669},{16901,25,31673},
+{16908,5,31682},{16910,10,9263},{16913,13,31693},{16917,0,31698},
+{16918,17,31700},{16923,5,31707},{16925,9,31710},{16928,5,31714},
+{16930,5,31719},{16932,9,31723},{16935,5,31727},{16937,0,31730},
+{16938,9,31732},{16941,13,31736},{16945,6,9266},{16947,21,31745},
+{16953,9,31752},{16956,0,31758},{16957,21,31760},{16963,25,31767},
+{16970,6,9268},{16972,5,31780},{16974,5,31784},{16976,45,31788},
+{16988,13,31801},{16992,0,31810},{16993,29,31812},{17001,53,31822},
+{17015,5,31837},{17017,9,31841},{17020,13,31845},{17024,6,9270},
+{17026,9,31855},{17029,21,31861},{17035,41,31870},{17046,25,31882},
+{17053,5,31891},{17055,0,31894},{17056,9,31897},{17059,5,31904},
+{17061,0,31907},{17062,13,31910},{17066,9,31915},{17069,5,31919},
+{17071,17,31924},{17076,5,31930},{17078,5,31935},{17080,9,31938},
+{17083,10,9272},{17086,25,31950},{17093,0,31960},{17094,5,31962},
+{17096,21,31969},{17102,21,31977},{17108,18,9275},{17113,5,31996},
+{17115,14,9280},{17119,5,32014},{17121,5,32017},{17123,6,9284},
+{17125,9,32029},{17128,13,32035},{17132,9,32040},{17135,9,32044},
+{17138,17,32052},{17143,0,32059},{17144,5,32061},{17146,10,9286},
+{17149,25,32071},{17156,0,32079},{17157,45,32081},{17169,5,32095},
+{17171,9,32099},{17174,0,32103},{17175,17,32105},{17180,5,32111},
+{17182,5,32116},{17184,0,32120},{17185,25,32122},{17192,0,32130},
+{17193,5,32132},{17195,0,32135},{17196,17,32138},{17201,9,32144},
+{17204,29,32148},{17212,0,32157},{17213,9,32159},{17216,5,32164},
+{17218,13,32167},{17222,0,32175},{17223,9,32181},{17226,0,32188},
+{17227,13,32192},{17231,5,32197},{17233,5,32200},{17235,17,32204},
+{17240,0,32211},{17241,5,32213},{17243,9,32218},{17246,6,9289},
+{17248,5,32228},{17250,0,32231},{17251,5,32234},{17253,5,32237},
+{17255,10,9291},{17258,5,32247},{17260,0,32250},{17261,45,32252},
+{17273,13,32268},{17277,33,32274},{17286,0,32284},{17287,9,32288},
+{17290,9,32292},{17293,9,32296},{17296,0,32300},{17297,5,32303},
+{17299,14,9294},{17303,5,32319},{17305,9,32322},{17308,37,32328},
+{17318,0,32339},{17319,13,32342},{17323,9,32347},{17326,9,32351},
+{17329,21,32355},{17335,0,32364},{17336,5,32369},{17338,17,32372},
+{17343,5,32378},{17345,9,32383},{17348,17,32387},{17353,10,9298},
+{17356,9,32400},{17359,6,9301},{17361,5,32409},{17363,5,32413},
+{17365,6,9303},{17367,5,32443},{17369,34,9305},{17378,25,32571},
+{17385,0,32579},{17386,21,32582},{17392,6,9314},{17394,5,32594},
+{17396,6,9316},{17398,13,32603},{17402,0,32608},{17403,17,32611},
+{17408,9,32619},{17411,6,9318},{17413,5,32629},{17415,0,32632},
+{17416,13,32634},{17420,5,32639},{17422,9,32642},{17425,14,9320},
+{17429,17,32655},{17434,17,32661},{17439,5,32667},{17441,0,32672},
+{17442,5,32674},{17444,6,9324},{17446,17,32682},{17451,0,32689},
+{17452,17,32691},{17457,5,32698},{17459,6,9326},{17461,9,32706},
+{17464,13,32710},{17468,6,9328},{17470,9,32719},{17473,0,32723},
+{17474,5,32726},{17476,21,32729},{17482,9,32738},{17485,5,32743},
+{17487,13,32746},{17491,6,9330},{17493,17,32756},{17498,0,32762},
+{17499,9,32765},{17502,0,32770},{17503,13,32775},{17507,5,32782},
+{17509,6,9332},{17511,5,32794},{17513,9,32797},{17516,0,32801},
+{17517,5,32803},{17519,6,9334},{17521,5,32815},{17523,6,9336},
+{17525,5,32825},{17527,6,9338},{17529,5,32832},{17531,5,32836},
+{17533,9,32839},{17536,13,32846},{17540,14,9340},{17544,9,32859},
+{17547,37,32863},{17557,13,32875},{17561,6,9344},{17563,9,32890},
+{17566,5,32897},{17568,6,9346},{17570,21,32909},{17576,5,32916},
+{17578,14,9348},{17582,9,32934},{17585,10,9352},{17588,5,32949},
+{17590,5,32952},{17592,6,9355},{17594,17,32967},{17599,25,32975},
+{17606,0,32984},{17607,5,32991},{17609,5,32994},{17611,22,9357},
+{17617,13,33022},{17621,5,33027},{17623,5,33031},{17625,5,33035},
+{17627,10,9363},{17630,5,33052},{17632,49,33055},{17645,5,33069},
+{17647,0,33072},{17648,9,33075},{17651,0,33079},{17652,13,33082},
+{17656,25,33087},{17663,18,9366},{17668,5,33111},{17670,17,33115},
+{17675,9,33122},{17678,14,9371},{17682,5,33138},{17684,9,33141},
+{17687,0,33153},{17688,17,33155},{17693,0,33161},{17694,13,33163},
+{17698,0,33168},{17699,21,33170},{17705,0,33177},{17706,5,33182},
+{17708,5,33185},{17710,5,33188},{17712,0,33191},{17713,29,33195},
+{17721,21,33204},{17727,0,33212},{17728,5,33220},{17730,5,33223},
+{17732,6,9375},{17734,29,33232},{17742,0,33241},{17743,13,33243},
+{17747,5,33249},{17749,9,33252},{17752,6,9377},{17754,17,33262},
+{17759,17,33269},{17764,14,9379},{17768,5,33294},{17770,6,9383},
+{17772,21,33301},{17778,6,9385},{17780,13,33316},{17784,14,9387},
+{17788,5,33340},{17790,17,33343},{17795,5,33349},{17797,6,9391},
+{17799,9,33356},{17802,29,33360},{17810,13,33371},{17814,13,33376},
+{17818,6,9393},{17820,5,33385},{17822,5,33388},{17824,5,33397},
+{17826,0,33400},{17827,5,33403},{17829,5,33408},{17831,0,33411},
+{17832,9,33413},{17835,10,9395},{17838,13,33427},{17842,5,33434},
+{17844,6,9398},{17846,5,33442},{17848,6,9400},{17850,5,33461},
+{17852,6,9402},{17854,5,33471},{17856,5,33474},{17858,5,33477},
+{17860,10,9404},{17863,5,33497},{17865,6,9407},{17867,9,33512},
+{17870,9,33516},{17873,0,33520},{17874,5,33522},{17876,5,33525},
+{17878,6,9409},{17880,17,33532},{17885,5,33546},{17887,6,9411},
+{17889,5,33554},{17891,0,33558},{17892,5,33560},{17894,37,33565},
+{17904,5,33577},{17906,18,9413},{17911,9,33597},{17914,5,33601},
+{17916,5,33604},{17918,6,9418},{17920,13,33611},{17924,0,33619},
+{17925,17,33621},{17930,6,9420},{17932,25,33648},{17939,5,33657},
+{17941,25,33662},{17948,5,33671},{17950,9,33675},{17953,9,33679},
+{17956,5,33684},{17958,0,33687},{17959,5,33689},{17961,10,9422},
+{17964,13,33699},{17968,13,33708},{17972,6,9425},{17974,5,33726},
+{17976,9,33730},{17979,0,33734},{17980,5,33736},{17982,0,33739},
+{17983,5,33741},{17985,13,33744},{17989,6,9427},{17991,9,33753},
+{17994,0,33758},{17995,9,33762},{17998,9,33766},{18001,13,33771},
+{18005,17,33779},{18010,9,33786},{18013,9,33790},{18016,6,9429},
+{18018,5,33800},{18020,0,33808},{18021,21,33810},{18027,9,33817},
+{18030,21,33822},{18036,9,33833},{18039,13,33837},{18043,9,33842},
+{18046,5,33846},{18048,9,33849},{18051,29,33854},{18059,5,33863},
+{18061,25,33866},{18068,13,33875},{18072,0,33880},{18073,13,33885},
+{18077,6,9431},{18079,5,33895},{18081,22,9433},{18087,25,33915},
+{18094,13,33923},{18098,6,9439},{18100,13,33935},{18104,5,33941},
+{18106,0,33944},{18107,5,33946},{18109,13,33949},{18113,49,33954},
+{18126,5,33968},{18128,0,33971},{18129,9,33973},{18132,6,9441},
+{18134,5,33986},{18136,13,33989},{18140,0,33996},{18141,5,33998},
+{18143,0,34002},{18144,5,34004},{18146,21,34007},{18152,0,34014},
+{18153,5,34017},{18155,0,34020},{18156,17,34023},{18161,0,34029},
+{18162,41,34033},{18173,0,34046},{18174,45,34048},{18186,13,34061},
+{18190,0,34066},{18191,5,34069},{18193,5,34072},{18195,9,34075},
+{18198,6,9443},{18200,5,34084},{18202,13,34087},{18206,33,34094},
+{18215,9,34110},{18218,0,34114},{18219,5,34116},{18221,0,34119},
+{18222,9,34123},{18225,9,34127},{18228,6,9445},{18230,13,34138},
+{18234,9,34143},{18237,0,34147},{18238,9,34149},{18241,5,34155},
+{18243,13,34158},{18247,0,34163},{18248,5,34165},{18250,0,34168},
+{18251,5,34172},{18253,17,34175},{18258,10,9447},{18261,5,34189},
+{18263,0,34192},{18264,5,34194},{18266,21,34197},{18272,5,34205},
+{18274,13,34208},{18278,6,9450},{18280,9,34219},{18283,21,34225},
+{18289,0,34232},{18290,21,34235},{18296,25,34242},{18303,9,34250},
+{18306,5,34257},{18308,0,34260},{18309,21,34262},{18315,21,34270},
+{18321,9,34278},{18324,33,34283},{18333,0,34293},{18334,5,34295},
+{18336,9,34300},{18339,13,34304},{18343,9,34312},{18346,17,34316},
+{18351,13,34322},{18355,9,34327},{18358,9,34331},{18361,9,34335},
+{18364,13,34339},{18368,0,34344},{18369,9,34346},{18372,37,34350},
+{18382,6,9452},{18384,5,34365},{18386,49,34368},{18399,5,34386},
+{18401,13,34390},{18405,6,9454},{18407,5,34400},{18409,13,34403},
+{18413,9,34408},{18416,0,34413},{18417,5,34415},{18419,25,34418},
+{18426,25,34435},{18433,17,34446},{18438,0,34452},{18439,21,34454},
+{18445,17,34462},{18450,5,34469},{18452,0,34475},{18453,5,34477},
+{18455,5,34482},{18457,9,34487},{18460,17,34491},{18465,9,34497},
+{18468,6,9456},{18470,5,34508},{18472,5,34514},{18474,9,34517},
+{18477,0,34522},{18478,5,34524},{18480,13,34528},{18484,13,34533},
+{18488,9,34538},{18491,0,34543},{18492,9,34549},{18495,9,34555},
+{18498,6,9458},{18500,5,34564},{18502,5,34571},{18504,13,34574},
+{18508,18,9460},{18513,5,34591},{18515,0,34596},{18516,9,34598},
+{18519,13,34602},{18523,5,34607},{18525,5,34610},{18527,5,34613},
+{18529,9,34616},{18532,5,34620},{18534,25,34624},{18541,5,34634},
+{18543,0,34637},{18544,13,34639},{18548,10,9465},{18551,21,34650},
+{18557,5,34657},{18559,25,34663},{18566,0,34671},{18567,9,34673},
+{18570,6,9468},{18572,5,34681},{18574,9,34687},{18577,5,34694},
+{18579,5,34697},{18581,0,34700},{18582,17,34702},{18587,9,34708},
+{18590,21,34712},{18596,5,34720},{18598,17,34723},{18603,5,34729},
+{18605,0,34734},{18606,9,34736},{18609,0,34740},{18610,13,34742},
+{18614,0,34748},{18615,5,34750},{18617,9,34753},{18620,10,9470},
+{18623,5,34764},{18625,5,34767},{18627,25,34772},{18634,13,34780},
+{18638,5,34785},{18640,0,34788},{18641,13,34790},{18645,6,9473},
+{18647,5,34800},{18649,9,34803},{18652,5,34807},{18654,0,34810},
+{18655,5,34812},{18657,13,34815},{18661,0,34820},{18662,9,34823},
+{18665,17,34827},{18670,6,9475},{18672,13,34839},{18676,9,34844},
+{18679,0,34848},{18680,49,34852},{18693,9,34867},{18696,5,34871},
+{18698,0,34874},{18699,9,34877},{18702,9,34881},{18705,9,34887},
+{18708,0,34891},{18709,17,34894},{18714,5,34901},{18716,10,9477},
+{18719,9,34910},{18722,5,34918},{18724,14,9480},{18728,13,34931},
+{18732,0,34936},{18733,9,34938},{18736,6,9484},{18738,5,34950},
+{18740,5,34953},{18742,0,34956},{18743,13,34958},{18747,9,34963},
+{18750,17,34967},{18755,17,34973},{18760,0,34979},{18761,21,34981},
+{18767,0,34988},{18768,9,34990},{18771,17,34994},{18776,13,35000},
+{18780,13,35005},{18784,5,35011},{18786,5,35015},{18788,9,35019},
+{18791,5,35024},{18793,0,35027},{18794,5,35030},{18796,5,35034},
+{18798,0,35038},{18799,5,35040},{18801,5,35046},{18803,25,35049},
+{18810,0,35058},{18811,9,35061},{18814,5,35066},{18816,9,35071},
+{18819,13,35075},{18823,5,35080},{18825,17,35083},{18830,0,35089},
+{18831,17,35092},{18836,17,35100},{18841,9,35106},{18844,13,35110},
+{18848,13,35116},{18852,10,9486},{18855,5,35129},{18857,17,35132},
+{18862,5,35138},{18864,5,35141},{18866,53,35144},{18880,21,35159},
+{18886,9,35169},{18889,0,35173},{18890,9,35175},{18893,0,35179},
+{18894,5,35181},{18896,5,35184},{18898,29,35187},{18906,9,35196},
+{18909,6,9489},{18911,5,35204},{18913,13,35207},{18917,9,35212},
+{18920,9,35216},{18923,5,35220},{18925,0,35223},{18926,29,35225},
+{18934,13,35234},{18938,9,35239},{18941,0,35243},{18942,5,35245},
+{18944,5,35248},{18946,13,35251},{18950,5,35256},{18952,5,35259},
+{18954,10,9491},{18957,9,35283},{18960,9,35287},{18963,6,9494},
+{18965,13,35295},{18969,0,35300},{18970,13,35303},{18974,9,35308},
+{18977,9,35312},{18980,6,9496},{18982,25,35321},{18989,9,35332},
+{18992,14,9498},{18996,5,35345},{18998,6,9502},{19000,5,35353},
+{19002,6,9504},{19004,9,35360},{19007,0,35364},{19008,13,35366},
+{19012,5,35371},{19014,9,35374},{19017,5,35378},{19019,0,35381},
+{19020,9,35383},{19023,9,35387},{19026,5,35391},{19028,13,35394},
+{19032,0,35399},{19033,17,35401},{19038,10,9506},{19041,5,35414},
+{19043,5,35417},{19045,5,35420},{19047,5,35423},{19049,5,35428},
+{19051,5,35431},{19053,10,9509},{19056,9,35446},{19059,5,35450},
+{19061,5,35453},{19063,13,35456},{19067,0,35464},{19068,5,35467},
+{19070,9,35470},{19073,0,35476},{19074,5,35478},{19076,0,35481},
+{19077,9,35483},{19080,10,9512},{19083,9,35497},{19086,9,35501},
+{19089,0,35505},{19090,9,35507},{19093,5,35511},{19095,5,35514},
+{19097,5,35517},{19099,5,35520},{19101,0,35523},{19102,5,35525},
+{19104,18,9515},{19109,9,35539},{19112,9,35544},{19115,0,35549},
+{19116,9,35551},{19119,6,9520},{19121,9,35560},{19124,0,35564},
+{19125,5,35567},{19127,0,35570},{19128,5,35572},{19130,22,9522},
+{19136,5,35592},{19138,9,35595},{19141,0,35599},{19142,9,35601},
+{19145,10,9528},{19148,9,35614},{19151,13,35618},{19155,0,35623},
+{19156,5,35625},{19158,17,35630},{19163,17,35636},{19168,13,35642},
+{19172,37,35647},{19182,13,35658},{19186,21,35664},{19192,6,9531},
+{19194,33,35677},{19203,13,35687},{19207,5,35693},{19209,9,35697},
+{19212,5,35701},{19214,17,35704},{19219,5,35710},{19221,33,35713},
+{19230,9,35723},{19233,9,35727},{19236,0,35732},{19237,17,35735},
+{19242,38,9533},{19252,33,35896},{19261,13,35906},{19265,5,35914},
+{19267,9,35917},{19270,13,35921},{19274,13,35926},{19278,21,35931},
+{19284,25,35939},{19291,25,35948},{19298,13,35956},{19302,25,35963},
+{19309,5,35971},{19311,9,35974},{19314,0,35979},{19315,25,35981},
+{19322,9,35989},{19325,13,35993},{19329,0,35999},{19330,13,36003},
+{19334,5,36013},{19336,22,9543},{19342,21,36043},{19348,0,36052},
+{19349,13,36054},{19353,14,9549},{19357,5,36072},{19359,21,36078},
+{19365,17,36085},{19370,17,36095},{19375,5,36102},{19377,10,9553},
+{19380,17,36113},{19385,13,36119},{19389,0,36128},{19390,5,36177},
+{19392,10,9556},{19395,9,36200},{19398,0,36204},{19399,5,36206},
+{19401,5,36209},{19403,33,36216},{19412,5,36226},{19414,13,36230},
+{19418,17,36236},{19423,5,36242},{19425,9,36246},{19428,17,36250},
+{19433,9,36256},{19436,13,36260},{19440,29,36265},{19448,5,36278},
+{19450,10,9559},{19453,9,36288},{19456,0,36293},{19457,13,36295},
+{19461,6,9562},{19463,13,36306},{19467,5,36312},{19469,0,36316},
+{19470,9,36320},{19473,9,36325},{19476,0,36329},{19477,5,36333},
+{19479,9,36336},{19482,10,9564},{19485,25,36350},{19492,9,36358},
+{19495,0,36363},{19496,5,36365},{19498,9,36369},{19501,29,36373},
+{19509,5,36384},{19511,17,36388},{19516,10,9567},{19519,5,36402},
+{19521,9,36406},{19524,5,36411},{19526,5,36414},{19528,0,36419},
+{19529,5,36421},{19531,13,36429},{19535,5,36435},{19537,9,36438},
+{19540,33,36442},{19549,5,36452},{19551,5,36455},{19553,5,36458},
+{19555,14,9570},{19559,9,36471},{19562,0,36475},{19563,5,36477},
+{19565,0,36480},{19566,9,36482},{19569,14,9574},{19573,17,36501},
+{19578,6,9578},{19580,5,36511},{19582,9,36514},{19585,9,36519},
+{19588,5,36525},{19590,5,36528},{19592,25,36531},{19599,17,36539},
+{19604,33,36545},{19613,9,36559},{19616,0,36563},{19617,21,36565},
+{19623,9,36572},{19626,13,36576},{19630,21,36581},{19636,21,36588},
+{19642,17,36595},{19647,0,36605},{19648,13,36607},{19652,10,9580},
+{19655,25,36619},{19662,0,36627},{19663,17,36630},{19668,17,36640},
+{19673,5,36647},{19675,13,36651},{19679,9,36656},{19682,13,36660},
+{19686,5,36665},{19688,5,36668},{19690,5,36672},{19692,0,36675},
+{19693,5,36679},{19695,9,36682},{19698,17,36687},{19703,37,36693},
+{19713,30,9583},{19721,9,36768},{19724,5,36772},{19726,10,9591},
+{19729,9,36787},{19732,5,36791},{19734,9,36794},{19737,5,36799},
+{19739,6,9594},{19741,17,36809},{19746,6,9596},{19748,5,36822},
+{19750,0,36826},{19751,5,36832},{19753,14,9598},{19757,5,36849},
+{19759,5,36853},{19761,9,36858},{19764,5,36862},{19766,5,36871},
+{19768,18,9602},{19773,5,36900},{19775,21,36903},{19781,5,36912},
+{19783,5,36915},{19785,0,36919},{19786,5,36921},{19788,0,36925},
+{19789,5,36927},{19791,0,36931},{19792,5,36933},{19794,9,36936},
+{19797,6,9607},{19799,5,36953},{19801,14,9609},{19805,5,36966},
+{19807,9,36970},{19810,9,36975},{19813,18,9613},{19818,5,36997},
+{19820,0,37001},{19821,9,37004},{19824,22,9618},{19830,9,37022},
+{19833,5,37028},{19835,9,37031},{19838,14,9624},{19842,5,37052},
+{19844,5,37055},{19846,5,37058},{19848,0,37062},{19849,5,37064},
+{19851,9,37067},{19854,0,37074},{19855,9,37076},{19858,9,37080},
+{19861,6,9628},{19863,9,37091},{19866,5,37097},{19868,6,9630},
+{19870,13,37104},{19874,5,37110},{19876,13,37113},{19880,9,37119},
+{19883,6,9632},{19885,5,37127},{19887,29,37130},{19895,6,9634},
+{19897,5,37143},{19899,13,37146},{19903,9,37151},{19906,9,37156},
+{19909,17,37160},{19914,10,9636},{19917,5,37175},{19919,29,37179},
+{19927,5,37188},{19929,6,9639},{19931,13,37203},{19935,5,37208},
+{19937,5,37211},{19939,5,37215},{19941,9,37222},{19944,10,9641},
+{19947,9,37242},{19950,17,37248},{19955,10,9644},{19958,5,37262},
+{19960,9,37267},{19963,9,37271},{19966,17,37277},{19971,21,37284},
+{19977,13,37296},{19981,13,37302},{19985,17,37307},{19990,22,9647},
+{19996,5,37338},{19998,17,37342},{20003,5,37349},{20005,0,37352},
+{20006,41,37354},{20017,6,9653},{20019,17,37371},{20024,5,37378},
+{20026,9,37381},{20029,9,37386},{20032,0,37391},{20033,5,37394},
+{20035,29,37398},{20043,13,37407},{20047,0,37412},{20048,21,37416},
+{20054,0,37423},{20055,5,37425},{20057,5,37429},{20059,5,37435},
+{20061,13,37441},{20065,5,37446},{20067,9,37450},{20070,9,37454},
+{20073,9,37458},{20076,0,37462},{20077,5,37464},{20079,5,37468},
+{20081,9,37471},{20084,9,37475},{20087,17,37479},{20092,21,37486},
+{20098,9,37493},{20101,0,37497},{20102,9,37500},{20105,5,37505},
+{20107,0,37508},{20108,29,37510},{20116,5,37519},{20118,0,37522},
+{20119,5,37524},{20121,10,9655},{20124,9,37533},{20127,5,37537},
+{20129,10,9658},{20132,5,37551},{20134,17,37554},{20139,6,9661},
+{20141,13,37565},{20145,10,9663},{20148,9,37577},{20151,5,37581},
+{20153,5,37584},{20155,37,37587},{20165,0,37598},{20166,9,37600},
+{20169,6,9666},{20171,5,37611},{20173,13,37618},{20177,0,37623},
+{20178,9,37625},{20181,13,37629},{20185,13,37634},{20189,25,37641},
+{20196,0,37649},{20197,5,37651},{20199,5,37654},{20201,9,37660},
+{20204,0,37665},{20205,9,37667},{20208,0,37671},{20209,5,37673},
+{20211,5,37676},{20213,5,37680},{20215,5,37684},{20217,0,37687},
+{20218,17,37689},{20223,6,9668},{20225,5,37700},{20227,9,37704},
+{20230,0,37708},{20231,21,37710},{20237,9,37717},{20240,5,37721},
+{20242,29,37724},{20250,9,37734},{20253,0,37739},{20254,9,37741},
+{20257,13,37745},{20261,9,37751},{20264,9,37755},{20267,9,37759},
+{20270,0,37763},{20271,5,37765},{20273,5,37768},{20275,13,37771},
+{20279,21,37776},{20285,0,37783},{20286,33,37785},{20295,5,37796},
+{20297,14,9670},{20301,5,37809},{20303,0,37812},{20304,5,37814},
+{20306,21,37817},{20312,9,37824},{20315,9,37828},{20318,6,9674},
+{20320,9,37838},{20323,13,37842},{20327,9,37849},{20330,6,9676},
+{20332,9,37861},{20335,45,37865},{20347,6,9678},{20349,33,37882},
+{20358,25,37892},{20365,13,37900},{20369,0,37905},{20370,9,37909},
+{20373,9,37914},{20376,5,37918},{20378,17,37921},{20383,17,37929},
+{20388,9,37935},{20391,0,37940},{20392,5,37942},{20394,0,37945},
+{20395,9,37947},{20398,13,37952},{20402,17,37957},{20407,0,37963},
+{20408,17,37965},{20413,0,37971},{20414,41,37973},{20425,5,37985},
+{20427,0,37988},{20428,17,37990},{20433,0,37996},{20434,5,37998},
+{20436,0,38001},{20437,13,38003},{20441,0,38008},{20442,5,38010},
+{20444,17,38016},{20449,18,9680},{20454,5,38099},{20456,58,9685},
+{20471,5,38260},{20473,25,38264},{20480,0,38273},{20481,5,38276},
+{20483,5,38279},{20485,14,9700},{20489,9,38293},{20492,29,38297},
+{20500,0,38306},{20501,5,38310},{20503,0,38314},{20504,13,38318},
+{20508,9,38323},{20511,5,38327},{20513,0,38330},{20514,9,38336},
+{20517,5,38340},{20519,6,9704},{20521,9,38349},{20524,9,38353},
+{20527,17,38359},{20532,0,38365},{20533,5,38367},{20535,5,38371},
+{20537,5,38374},{20539,30,9706},{20547,25,38435},{20554,9,38443},
+{20557,5,38447},{20559,13,38455},{20563,14,9714},{20567,5,38478},
+{20569,9,38481},{20572,5,38486},{20574,5,38489},{20576,10,9718},
+{20579,5,38501},{20581,0,38507},{20582,9,38509},{20585,0,38513},
+{20586,13,38521},{20590,25,38526},{20597,10,9721},{20600,9,38545},
+{20603,6,9724},{20605,37,38557},{20615,0,38569},{20616,17,38571},
+{20621,18,9726},{20626,5,38594},{20628,0,38600},{20629,5,38602},
+{20631,5,38608},{20633,5,38611},{20635,5,38615},{20637,0,38618},
+{20638,9,38621},{20641,0,38625},{20642,13,38628},{20646,13,38635},
+{20650,5,38640},{20652,5,38644},{20654,6,9731},{20656,5,38652},
+{20658,0,38655},{20659,5,38658},{20661,0,38661},{20662,9,38666},
+{20665,9,38672},{20668,5,38676},{20670,17,38679},{20675,0,38685},
+{20676,29,38687},{20684,5,38696},{20686,5,38699},{20688,5,38702},
+{20690,0,38705},{20691,17,38707},{20696,9,38714},{20699,9,38719},
+{20702,0,38723},{20703,9,38725},{20706,33,38729},{20715,5,38740},
+{20717,5,38743},{20719,5,38748},{20721,0,38751},{20722,5,38755},
+{20724,5,38758},{20726,33,38762},{20735,0,38773},{20736,17,38775},
+{20741,29,38781},{20749,17,38790},{20754,14,9733},{20758,9,38805},
+{20761,25,38809},{20768,5,38817},{20770,5,38820},{20772,13,38823},
+{20776,6,9737},{20778,5,38832},{20780,0,38835},{20781,29,38837},
+{20789,17,38846},{20794,5,38852},{20796,5,38855},{20798,0,38858},
+{20799,21,38861},{20805,17,38868},{20810,5,38874},{20812,0,38877},
+{20813,25,38879},{20820,0,38888},{20821,17,38894},{20826,0,38900},
+{20827,29,38903},{20835,18,9739},{20840,9,38932},{20843,9,38937},
+{20846,13,38941},{20850,5,38946},{20852,0,38949},{20853,21,38951},
+{20859,5,38958},{20861,21,38961},{20867,5,38969},{20869,0,38972},
+{20870,29,38974},{20878,17,38983},{20883,13,38991},{20887,9,38997},
+{20890,0,39002},{20891,5,39004},{20893,9,39007},{20896,5,39011},
+{20898,0,39014},{20899,9,39016},{20902,5,39021},{20904,26,9744},
+{20911,17,39081},{20916,6,9751},{20918,5,39092},{20920,17,39095},
+{20925,25,39101},{20932,6,9753},{20934,17,39113},{20939,5,39119},
+{20941,0,39124},{20942,5,39126},{20944,5,39132},{20946,0,39137},
+{20947,13,39139},{20951,6,9755},{20953,5,39152},{20955,0,39155},
+{20956,25,39157},{20963,13,39167},{20967,0,39172},{20968,9,39174},
+{20971,0,39179},{20972,5,39182},{20974,13,39188},{20978,5,39193},
+{20980,5,39196},{20982,5,39199},{20984,21,39202},{20990,17,39209},
+{20995,13,39215},{20999,9,39220},{21002,13,39224},{21006,0,39229},
+{21007,9,39232},{21010,0,39236},{21011,5,39238},{21013,13,39245},
+{21017,6,9757},{21019,13,39256},{21023,0,39261},{21024,9,39263},
+{21027,10,9759},{21030,5,39288},{21032,6,9762},{21034,5,39298},
+{21036,10,9764},{21039,41,39322},{21050,5,39334},{21052,9,39337},
+{21055,5,39343},{21057,0,39346},{21058,45,39349},{21070,53,39362},
+{21084,0,39379},{21085,5,39382},{21087,14,9767},{21091,37,39395},
+{21101,9,39406},{21104,49,39410},{21117,0,39424},{21118,9,39426},
+{21121,25,39430},{21128,21,39440},{21134,5,39447},{21136,65,39450},
+{21153,6,9771},{21155,17,39473},{21160,17,39481},{21165,0,39487},
+{21166,13,39494},{21170,5,39499},{21172,0,39502},{21173,17,39504},
+{21178,0,39510},{21179,5,39512},{21181,9,39516},{21184,5,39520},
+{21186,0,39523},{21187,13,39526},{21191,14,9773},{21195,5,39565},
+{21197,5,39572},{21199,6,9777},{21201,21,39593},{21207,13,39602},
+{21211,6,9779},{21213,9,39613},{21216,5,39619},{21218,17,39622},
+{21223,5,39629},{21225,6,9781},{21227,21,39641},{21233,0,39648},
+{21234,13,39650},{21238,13,39655},{21242,0,39660},{21243,33,39664},
+{21252,0,39674},{21253,25,39676},{21260,5,39684},{21262,0,39687},
+{21263,13,39689},{21267,0,39694},{21268,9,39696},{21271,21,39700},
+{21277,13,39707},{21281,5,39712},{21283,10,9783},{21286,13,39722},
+{21290,0,39728},{21291,29,39731},{21299,13,39741},{21303,0,39750},
+{21304,9,39754},{21307,0,39760},{21308,5,39762},{21310,9,39765},
+{21313,0,39769},{21314,77,39771},{21334,13,39792},{21338,5,39797},
+{21340,33,39800},{21349,0,39810},{21350,37,39812},{21360,0,39823},
+{21361,25,39827},{21368,5,39835},{21370,41,39839},{21381,0,39852},
+{21382,65,39855},{21399,17,39874},{21404,0,39880},{21405,33,39883},
+{21414,0,39893},{21415,13,39895},{21419,0,39900},{21420,9,39902},
+{21423,0,39907},{21424,5,39909},{21426,0,39913},{21427,13,39916},
+{21431,9,39921},{21434,29,39925},{21442,0,39934},{21443,29,39936},
+{21451,9,39946},{21454,5,39950},{21456,0,39953},{21457,45,39956},
+{21469,5,39969},{21471,0,39972},{21472,5,39974},{21474,9,39978},
+{21477,9,39982},{21480,14,9786},{21484,5,39996},{21486,21,39999},
+{21492,5,40006},{21494,29,40010},{21502,6,9790},{21504,13,40025},
+{21508,0,40030},{21509,25,40032},{21516,17,40040},{21521,37,40046},
+{21531,6,9792},{21533,5,40061},{21535,0,40064},{21536,5,40067},
+{21538,5,40073},{21540,10,9794},{21543,13,40086},{21547,18,9797},
+{21552,17,40126},{21557,5,40136},{21559,5,40145},{21561,5,40154},
+{21563,5,40160},{21565,5,40163},{21567,9,40166},{21570,5,40170},
+{21572,21,40173},{21578,0,40181},{21579,57,40183},{21594,0,40200},
+{21595,41,40202},{21606,17,40214},{21611,6,9802},{21613,9,40224},
+{21616,5,40228},{21618,0,40231},{21619,21,40233},{21625,37,40241},
+{21635,9,40252},{21638,5,40256},{21640,53,40259},{21654,29,40276},
+{21662,5,40286},{21664,29,40290},{21672,0,40299},{21673,5,40301},
+{21675,5,40304},{21677,77,40307},{21697,0,40328},{21698,33,40330},
+{21707,13,40340},{21711,0,40345},{21712,37,40347},{21722,9,40358},
+{21725,17,40362},{21730,13,40368},{21734,21,40373},{21740,9,40381},
+{21743,6,9804},{21745,53,40389},{21759,9,40404},{21762,0,40408},
+{21763,37,40411},{21773,29,40423},{21781,5,40432},{21783,13,40436},
+{21787,65,40443},{21804,29,40461},{21812,13,40470},{21816,22,9806},
+{21822,5,40507},{21824,10,9812},{21827,9,40530},{21830,10,9815},
+{21833,13,40543},{21837,0,40549},{21838,5,40558},{21840,6,9818},
+{21842,9,40566},{21845,0,40571},{21846,5,40576},{21848,13,40579},
+{21852,5,40585},{21854,21,40588},{21860,9,40596},{21863,17,40600},
+{21868,0,40606},{21869,17,40608},{21874,5,40615},{21876,17,40618},
+{21881,13,40624},{21885,5,40630},{21887,5,40633},{21889,0,40636},
+{21890,17,40639},{21895,13,40645},{21899,5,40650},{21901,0,40656},
+{21902,5,40658},{21904,9,40661},{21907,5,40665},{21909,0,40673},
+{21910,5,40675},{21912,0,40678},{21913,13,40683},{21917,5,40688},
+{21919,0,40691},{21920,5,40693},{21922,6,9820},{21924,33,40704},
+{21933,10,9822},{21936,5,40721},{21938,10,9825},{21941,21,40730},
+{21947,0,40737},{21948,33,40739},{21957,5,40749},{21959,25,40752},
+{21966,10,9828},{21969,17,40767},{21974,17,40773},{21979,9,40780},
+{21982,0,40787},{21983,13,40789},{21987,5,40794},{21989,5,40797},
+{21991,0,40802},{21992,5,40804},{21994,9,40807},{21997,0,40811},
+{21998,17,40813},{22003,13,40819},{22007,25,40824},{22014,5,40833},
+{22016,5,40846},{22018,9,40849},{22021,9,40854},{22024,5,40861},
+{22026,17,40865},{22031,0,63788},{22032,9,64013},{22035,0,64017},
+{22036,5,64019},{22038,0,64024},{22039,9,64031},{22042,5,64035},
+{22044,9,64039},{22047,0,11905},{22051,70,9831},{22069,5,40886},
+{22071,14,9849},{22076,26,9853},{22083,5,11958},{22086,62,9860},
+{22102,5,18818},{22104,5,18821},{22106,18,9876},{22112,0,19619},
+{22113,9,19615},{22116,6,9881},{22118,25,19731},{22125,6,9883},
+{22127,377,32},{22222,14,9885},{22226,373,33},{22320,234,9889},
+{22379,5,12533},{22381,54,9948},{22395,9,12339},{22398,9,12344},
+{22401,9,12586},{22404,93,12704},{22428,0,11904},{22429,5,11906},
+{22431,9,11909},{22434,5,11913},{22436,37,11917},{22446,5,11928},
+{22448,45,11931},{22460,5,11944},{22462,9,11947},{22465,13,11951},
+{22469,5,11956},{22471,9,11960},{22474,53,11964},{22488,161,11979},
+{22529,281,13312},{22600,169,13384},{22643,1189,13428},{22941,441,13727},
+{23052,41,13839},{23063,3057,13851},{23828,337,14617},{23913,381,14703},
+{24009,53,14801},{24023,585,14816},{24170,869,14964},{24388,1145,15183},
+{24675,449,15471},{24788,3537,15585},{25673,1053,16471},{25937,1881,16736},
+{26408,461,17208},{26524,13,17325},{26528,169,17330},{26571,989,17374},
+{26819,1489,17623},{27192,77,17997},{27212,769,18018},{27405,17,18212},
+{27410,325,18218},{27492,61,18301},{27508,1761,18318},{27949,197,18760},
+{27999,5,18811},{28001,13,18814},{28005,0,18820},{28006,77,18823},
+{28026,9,18844},{28029,85,18848},{28051,2809,18872},{28754,153,19576},
+{28793,441,19620},{28904,589,19738},{29052,25,19887},{29059,18,9962},
+{29064,4657,40960},{30229,217,42128},
+};
+
+static const unsigned short cmap_Adobe_GB1_UCS2_table[9967] = {
+183,713,711,168,12291,12293,8212,65374,8214,8943,177,215,
+247,8758,8721,8719,8746,8745,8712,8759,8730,8869,8741,8736,
+8978,8857,8747,8750,8801,8780,8776,8765,8733,8800,8734,8757,
+8756,9794,9792,176,8451,65284,164,8240,167,8470,9734,9733,
+9675,9679,9678,9671,9670,9633,9632,9651,9650,8251,8594,8595,
+12307,65292,12290,12289,65281,65311,65073,8230,257,225,462,224,
+275,233,283,232,299,237,464,236,333,243,466,242,
+363,250,468,249,470,472,474,476,252,234,593,7743,
+324,328,505,609,257,225,462,224,275,233,283,232,
+299,237,464,236,333,243,466,242,363,250,468,249,
+470,472,474,476,252,234,593,7743,324,328,505,609,
+21834,38463,22467,25384,21710,21769,21696,30353,30284,34108,30702,33406,
+30861,29233,38552,38797,27688,23433,20474,25353,26263,23736,33018,26696,
+32942,26114,30414,20985,25942,29100,32753,34948,20658,22885,25034,28595,
+33453,25420,25170,21485,21543,31494,20843,30116,24052,25300,36299,38774,
+25226,32793,22365,38712,32610,29240,30333,26575,30334,25670,20336,36133,
+25308,31255,26001,29677,25644,25203,33324,39041,26495,29256,25198,25292,
+20276,29923,21322,21150,32458,37030,24110,26758,27036,33152,32465,26834,
+30917,34444,38225,20621,35876,33502,32990,21253,35090,21093,34180,38649,
+20445,22561,39281,23453,25265,25253,26292,35961,40077,29190,26479,30865,
+24754,21329,21271,36744,32972,36125,38049,20493,29384,22791,24811,28953,
+34987,22868,33519,26412,31528,23849,32503,29997,27893,36454,36856,36924,
+40763,27604,37145,31508,24444,30887,34006,34109,27605,27609,27606,24065,
+24199,30201,38381,25949,24330,24517,36767,22721,33218,36991,38491,38829,
+36793,32534,36140,25153,20415,21464,21342,36779,36941,26631,24426,33176,
+34920,40150,24971,21035,30250,24428,25996,28626,28392,23486,25672,20853,
+20912,26564,19993,31177,39292,28851,30149,24182,29627,33760,25773,25320,
+38069,27874,21338,21187,25615,38082,31636,20271,24091,33334,33046,33162,
+28196,27850,39539,25429,21340,21754,34917,22496,19981,24067,27493,31807,
+37096,24598,25830,29468,35009,26448,25165,36130,30572,36393,37319,24425,
+33756,34081,39184,21442,34453,27531,24813,24808,28799,33485,33329,20179,
+27815,34255,25805,31961,27133,26361,33609,21397,31574,20391,20876,27979,
+23618,36461,25554,21449,33580,33590,26597,30900,25661,23519,23700,24046,
+35815,25286,26612,35962,25600,25530,34633,39307,35863,32544,38130,20135,
+38416,39076,26124,29462,22330,23581,24120,38271,20607,32928,21378,25950,
+30021,21809,20513,36229,25220,38046,26397,22066,28526,24034,21557,28818,
+36710,25199,25764,25507,24443,28552,37108,33251,36784,23576,26216,24561,
+27785,38472,36225,34924,25745,31216,22478,27225,25104,21576,20056,31243,
+24809,28548,35802,25215,36894,39563,31204,21507,30196,25345,21273,27744,
+36831,24347,39536,32827,40831,20360,23610,36196,32709,26021,28861,20805,
+20914,34411,23815,23456,25277,37228,30068,36364,31264,24833,31609,20167,
+32504,30597,19985,33261,21021,20986,27249,21416,36487,38148,38607,28353,
+38500,26970,30784,20648,30679,25616,35302,22788,25571,24029,31359,26941,
+20256,33337,21912,20018,30126,31383,24162,24202,38383,21019,21561,28810,
+25462,38180,22402,26149,26943,37255,21767,28147,32431,34850,25139,32496,
+30133,33576,30913,38604,36766,24904,29943,35789,27492,21050,36176,27425,
+32874,33905,22257,21254,20174,19995,20945,31895,37259,31751,20419,36479,
+31713,31388,25703,23828,20652,33030,30209,31929,28140,32736,26449,23384,
+23544,30923,25774,25619,25514,25387,38169,25645,36798,31572,30249,25171,
+22823,21574,27513,20643,25140,24102,27526,20195,36151,34955,24453,36910,
+24608,32829,25285,20025,21333,37112,25528,32966,26086,27694,20294,24814,
+28129,35806,24377,34507,24403,25377,20826,33633,26723,20992,25443,36424,
+20498,23707,31095,23548,21040,31291,24764,36947,30423,24503,24471,30340,
+36460,28783,30331,31561,30634,20979,37011,22564,20302,28404,36842,25932,
+31515,29380,28068,32735,23265,25269,24213,22320,33922,31532,24093,24351,
+36882,32532,39072,25474,28359,30872,28857,20856,38747,22443,30005,20291,
+30008,24215,24806,22880,28096,27583,30857,21500,38613,20939,20993,25481,
+21514,38035,35843,36300,29241,30879,34678,36845,35853,21472,19969,30447,
+21486,38025,39030,40718,38189,23450,35746,20002,19996,20908,33891,25026,
+21160,26635,20375,24683,20923,27934,20828,25238,26007,38497,35910,36887,
+30168,37117,30563,27602,29322,29420,35835,22581,30585,36172,26460,38208,
+32922,24230,28193,22930,31471,30701,38203,27573,26029,32526,22534,20817,
+38431,23545,22697,21544,36466,25958,39039,22244,38045,30462,36929,25479,
+21702,22810,22842,22427,36530,26421,36346,33333,21057,24816,22549,34558,
+23784,40517,20420,39069,35769,23077,24694,21380,25212,36943,37122,39295,
+24681,32780,20799,32819,23572,39285,27953,20108,36144,21457,32602,31567,
+20240,20047,38400,27861,29648,34281,24070,30058,32763,27146,30718,38034,
+32321,20961,28902,21453,36820,33539,36137,29359,39277,27867,22346,33459,
+26041,32938,25151,38450,22952,20223,35775,32442,25918,33778,38750,21857,
+39134,32933,21290,35837,21536,32954,24223,27832,36153,33452,37210,21545,
+27675,20998,32439,22367,28954,27774,31881,22859,20221,24575,24868,31914,
+20016,23553,26539,34562,23792,38155,39118,30127,28925,36898,20911,32541,
+35773,22857,20964,20315,21542,22827,25975,32932,23413,25206,25282,36752,
+24133,27679,31526,20239,20440,26381,28014,28074,31119,34993,24343,29995,
+25242,36741,20463,37340,26023,33071,33105,24220,33104,36212,21103,35206,
+36171,22797,20613,20184,38428,29238,33145,36127,23500,35747,38468,22919,
+32538,21648,22134,22030,35813,25913,27010,38041,30422,28297,24178,29976,
+26438,26577,31487,32925,36214,24863,31174,25954,36195,20872,21018,38050,
+32568,32923,32434,23703,28207,26464,31705,30347,39640,33167,32660,31957,
+25630,38224,31295,21578,21733,27468,25601,25096,40509,33011,30105,21106,
+38761,33883,26684,34532,38401,38548,38124,20010,21508,32473,26681,36319,
+32789,26356,24218,32697,22466,32831,26775,24037,25915,21151,24685,40858,
+20379,36524,20844,23467,24339,24041,27742,25329,36129,20849,38057,21246,
+27807,33503,29399,22434,26500,36141,22815,36764,33735,21653,31629,20272,
+27837,23396,22993,40723,21476,34506,39592,35895,32929,25925,39038,22266,
+38599,21038,29916,21072,23521,25346,35074,20054,25296,24618,26874,20851,
+23448,20896,35266,31649,39302,32592,24815,28748,36143,20809,24191,36891,
+29808,35268,22317,30789,24402,40863,38394,36712,39740,35809,30328,26690,
+26588,36330,36149,21053,36746,28378,26829,38149,37101,22269,26524,35065,
+36807,21704,39608,23401,28023,27686,20133,23475,39559,37219,25000,37039,
+38889,21547,28085,23506,20989,21898,32597,32752,25788,25421,26097,25022,
+24717,28938,27735,27721,22831,26477,33322,22741,22158,35946,27627,37085,
+22909,32791,21495,28009,21621,21917,33655,33743,26680,31166,21644,20309,
+21512,30418,35977,38402,27827,28088,36203,35088,40548,36154,22079,40657,
+30165,24456,29408,24680,21756,20136,27178,34913,24658,36720,21700,28888,
+34425,40511,27946,23439,24344,32418,21897,20399,29492,21564,21402,20505,
+21518,21628,20046,24573,29786,22774,33899,32993,34676,29392,31946,28246,
+24359,34382,21804,25252,20114,27818,25143,33457,21719,21326,29502,28369,
+30011,21010,21270,35805,27088,24458,24576,28142,22351,27426,29615,26707,
+36824,32531,25442,24739,21796,30186,35938,28949,28067,23462,24187,33618,
+24908,40644,30970,34647,31783,30343,20976,24822,29004,26179,24140,24653,
+35854,28784,25381,36745,24509,24674,34516,22238,27585,24724,24935,21321,
+24800,26214,36159,31229,20250,28905,27719,35763,35826,32472,33636,26127,
+23130,39746,27985,28151,35905,27963,20249,28779,33719,25110,24785,38669,
+36135,31096,20987,22334,22522,26426,30072,31293,31215,31637,32908,39269,
+36857,28608,35749,40481,23020,32489,32521,21513,26497,26840,36753,31821,
+38598,21450,24613,30142,27762,21363,23241,32423,25380,20960,33034,24049,
+34015,25216,20864,23395,20238,31085,21058,24760,27982,23492,23490,35745,
+35760,26082,24524,38469,22931,32487,32426,22025,26551,22841,20339,23478,
+21152,33626,39050,36158,30002,38078,20551,31292,20215,26550,39550,23233,
+27516,30417,22362,23574,31546,38388,29006,20860,32937,33392,22904,32516,
+33575,26816,26604,30897,30839,25315,25441,31616,20461,21098,20943,33616,
+27099,37492,36341,36145,35265,38190,31661,20214,20581,33328,21073,39279,
+28176,28293,28071,24314,20725,23004,23558,27974,27743,30086,33931,26728,
+22870,35762,21280,37233,38477,34121,26898,30977,28966,33014,20132,37066,
+27975,39556,23047,22204,25605,38128,30699,20389,33050,29409,35282,39290,
+32564,32478,21119,25945,37237,36735,36739,21483,31382,25581,25509,30342,
+31224,34903,38454,25130,21163,33410,26708,26480,25463,30571,31469,27905,
+32467,35299,22992,25106,34249,33445,30028,20511,20171,30117,35819,23626,
+24062,31563,26020,37329,20170,27941,35167,32039,38182,20165,35880,36827,
+38771,26187,31105,36817,28908,28024,23613,21170,33606,20834,33550,30555,
+26230,40120,20140,24778,31934,31923,32463,20117,35686,26223,39048,38745,
+22659,25964,38236,24452,30153,38742,31455,31454,20928,28847,31384,25578,
+31350,32416,29590,38893,20037,28792,20061,37202,21417,25937,26087,33276,
+33285,21646,23601,30106,38816,25304,29401,30141,23621,39545,33738,23616,
+21632,30697,20030,27822,32858,25298,25454,24040,20855,36317,36382,38191,
+20465,21477,24807,28844,21095,25424,40515,23071,20518,30519,21367,32482,
+25733,25899,25225,25496,20500,29237,35273,20915,35776,32477,22343,33740,
+38055,20891,21531,23803,20426,31459,27994,37089,39567,21888,21654,21345,
+21679,24320,25577,26999,20975,24936,21002,22570,21208,22350,30733,30475,
+24247,24951,31968,25179,25239,20130,28821,32771,25335,28900,38752,22391,
+33499,26607,26869,30933,39063,31185,22771,21683,21487,28212,20811,21051,
+23458,35838,32943,21827,22438,24691,22353,21549,31354,24656,23380,25511,
+25248,21475,25187,23495,26543,21741,31391,33510,37239,24211,35044,22840,
+22446,25358,36328,33007,22359,31607,20393,24555,23485,27454,21281,31568,
+29378,26694,30719,30518,26103,20917,20111,30420,23743,31397,33909,22862,
+39745,20608,39304,24871,28291,22372,26118,25414,22256,25324,25193,24275,
+38420,22403,25289,21895,34593,33098,36771,21862,33713,26469,36182,34013,
+23146,26639,25318,31726,38417,20848,28572,35888,25597,35272,25042,32518,
+28866,28389,29701,27028,29436,24266,37070,26391,28010,25438,21171,29282,
+32769,20332,23013,37226,28889,28061,21202,20048,38647,38253,34174,30922,
+32047,20769,22418,25794,32907,31867,27882,26865,26974,20919,21400,26792,
+29313,40654,31729,29432,31163,28435,29702,26446,37324,40100,31036,33673,
+33620,21519,26647,20029,21385,21169,30782,21382,21033,20616,20363,20432,
+30178,31435,31890,27813,38582,21147,29827,21737,20457,32852,33714,36830,
+38256,24265,24604,28063,24088,25947,33080,38142,24651,28860,32451,31918,
+20937,26753,31921,33391,20004,36742,37327,26238,20142,35845,25769,32842,
+20698,30103,29134,23525,36797,28518,20102,25730,38243,24278,26009,21015,
+35010,28872,21155,29454,29747,26519,30967,38678,20020,37051,40158,28107,
+20955,36161,21533,25294,29618,33777,38646,40836,38083,20278,32666,20940,
+28789,38517,23725,39046,21478,20196,28316,29705,27060,30827,39311,30041,
+21016,30244,27969,26611,20845,40857,32843,21657,31548,31423,38534,22404,
+25314,38471,27004,23044,25602,31699,28431,38475,33446,21346,39045,24208,
+28809,25523,21348,34383,40065,40595,30860,38706,36335,36162,40575,28510,
+31108,24405,38470,25134,39540,21525,38109,20387,26053,23653,23649,32533,
+34385,27695,24459,29575,28388,32511,23782,25371,23402,28390,21365,20081,
+25504,30053,25249,36718,20262,20177,27814,32438,35770,33821,34746,32599,
+36923,38179,31657,39585,35064,33853,27931,39558,32476,22920,40635,29595,
+30721,34434,39532,39554,22043,21527,22475,20080,40614,21334,36808,33033,
+30610,39314,34542,28385,34067,26364,24930,28459,35881,33426,33579,30450,
+27667,24537,33725,29483,33541,38170,27611,30683,38086,21359,33538,20882,
+24125,35980,36152,20040,29611,26522,26757,37238,38665,29028,27809,30473,
+23186,38209,27599,32654,26151,23504,22969,23194,38376,38391,20204,33804,
+33945,27308,30431,38192,29467,26790,23391,30511,37274,38753,31964,36855,
+35868,24357,31859,31192,35269,27852,34588,23494,24130,26825,30496,32501,
+20885,20813,21193,23081,32517,38754,33495,25551,30596,34256,31186,28218,
+24217,22937,34065,28781,27665,25279,30399,25935,24751,38397,26126,34719,
+40483,38125,21517,21629,35884,34321,27169,33180,30952,25705,39764,25273,
+26411,33707,22696,40664,27819,28448,23518,38476,35851,29279,26576,25287,
+29281,20137,22982,27597,22675,26286,24149,21215,24917,26408,30446,30566,
+29287,31302,25343,21738,21584,38048,37027,23068,32435,27670,20035,22902,
+32784,22856,21335,30007,38590,22218,25376,33041,24700,38393,28118,21602,
+39297,20869,23273,33021,22958,38675,20522,27877,23612,25311,20320,21311,
+33147,36870,28346,34091,25288,24180,30910,25781,25467,24565,23064,37247,
+40479,23615,25423,32834,23421,21870,38218,38221,28037,24744,26592,29406,
+20957,23425,25319,27870,29275,25197,38062,32445,33043,27987,20892,24324,
+22900,21162,24594,22899,26262,34384,30111,25386,25062,31983,35834,21734,
+27431,40485,27572,34261,21589,20598,27812,21866,36276,29228,24085,24597,
+29750,25293,25490,29260,24472,28227,27966,25856,28504,30424,30928,30460,
+30036,21028,21467,20051,24222,26049,32810,32982,25243,21638,21032,28846,
+34957,36305,27873,21624,32986,22521,35060,36180,38506,37197,20329,27803,
+21943,30406,30768,25256,28921,28558,24429,34028,26842,30844,31735,33192,
+26379,40527,25447,30896,22383,30738,38713,25209,25259,21128,29749,27607,
+21860,33086,30130,30382,21305,30174,20731,23617,35692,31687,20559,29255,
+39575,39128,28418,29922,31080,25735,30629,25340,39057,36139,21697,32856,
+20050,22378,33529,33805,24179,20973,29942,35780,23631,22369,27900,39047,
+23110,30772,39748,36843,31893,21078,25169,38138,20166,33670,33889,33769,
+33970,22484,26420,22275,26222,28006,35889,26333,28689,26399,27450,26646,
+25114,22971,19971,20932,28422,26578,27791,20854,26827,22855,27495,30054,
+23822,33040,40784,26071,31048,31041,39569,36215,23682,20062,20225,21551,
+22865,30732,22120,27668,36804,24323,27773,27875,35755,25488,24688,27965,
+29301,25190,38030,38085,21315,36801,31614,20191,35878,20094,40660,38065,
+38067,21069,28508,36963,27973,35892,22545,23884,27424,27465,26538,21595,
+33108,32652,22681,34103,24378,25250,27207,38201,25970,24708,26725,30631,
+20052,20392,24039,38808,25772,32728,23789,20431,31373,20999,33540,19988,
+24623,31363,38054,20405,20146,31206,29748,21220,33465,25810,31165,23517,
+27777,38738,36731,27682,20542,21375,28165,25806,26228,27696,24773,39031,
+35831,24198,29756,31351,31179,19992,37041,29699,27714,22234,37195,27845,
+36235,21306,34502,26354,36527,23624,39537,28192,21462,23094,40843,36259,
+21435,22280,39079,26435,37275,27849,20840,30154,25331,29356,21048,21149,
+32570,28820,30264,21364,40522,27063,30830,38592,35033,32676,28982,29123,
+20873,26579,29924,22756,25880,22199,35753,39286,25200,32469,24825,28909,
+22764,20161,20154,24525,38887,20219,35748,20995,22922,32427,25172,20173,
+26085,25102,33592,33993,33635,34701,29076,28342,23481,32466,20887,25545,
+26580,32905,33593,34837,20754,23418,22914,36785,20083,27741,20837,35109,
+36719,38446,34122,29790,38160,38384,28070,33509,24369,25746,27922,33832,
+33134,40131,22622,36187,19977,21441,20254,25955,26705,21971,20007,25620,
+39578,25195,23234,29791,33394,28073,26862,20711,33678,30722,26432,21049,
+27801,32433,20667,21861,29022,31579,26194,29642,33515,26441,23665,21024,
+29053,34923,38378,38485,25797,36193,33203,21892,27733,25159,32558,22674,
+20260,21830,36175,26188,19978,23578,35059,26786,25422,31245,28903,33421,
+21242,38902,23569,21736,37045,32461,22882,36170,34503,36198,25668,23556,
+24913,28041,31038,35774,30775,30003,21627,20280,36523,28145,23072,32453,
+31070,27784,23457,23158,29978,32958,24910,28183,22768,29983,29989,29298,
+21319,32499,30465,30427,21097,32988,22307,24072,22833,29422,26045,28287,
+35799,23608,34417,21313,30707,25342,26102,20160,39135,34432,23454,35782,
+21490,30690,20351,23630,39542,22987,24335,31034,22763,19990,26623,20107,
+25325,35475,36893,21183,26159,21980,22124,36866,20181,20365,37322,39280,
+27663,24066,24643,23460,35270,35797,25910,25163,39318,23432,23551,25480,
+21806,21463,30246,20861,34092,26530,26803,27530,25234,36755,21460,33298,
+28113,30095,20070,36174,23408,29087,34223,26257,26329,32626,34560,40653,
+40736,23646,26415,36848,26641,26463,25101,31446,22661,24246,25968,28465,
+24661,21047,32781,25684,34928,29993,24069,26643,25332,38684,21452,29245,
+35841,27700,30561,31246,21550,30636,39034,33308,35828,30805,26388,28865,
+26031,25749,22070,24605,31169,21496,19997,27515,32902,23546,21987,22235,
+20282,20284,39282,24051,26494,32824,24578,39042,36865,23435,35772,35829,
+25628,33368,25822,22013,33487,37221,20439,32032,36895,31903,20723,22609,
+28335,23487,35785,32899,37240,33948,31639,34429,38539,38543,32485,39635,
+30862,23681,31319,36930,38567,31071,23385,25439,31499,34001,26797,21766,
+32553,29712,32034,38145,25152,22604,20182,23427,22905,22612,29549,25374,
+36427,36367,32974,33492,25260,21488,27888,37214,22826,24577,27760,22349,
+25674,36138,30251,28393,22363,27264,30192,28525,35885,35848,22374,27631,
+34962,30899,25506,21497,28845,27748,22616,25642,22530,26848,33179,21776,
+31958,20504,36538,28108,36255,28907,25487,28059,28372,32486,33796,26691,
+36867,28120,38518,35752,22871,29305,34276,33150,30140,35466,26799,21076,
+36386,38161,25552,39064,36420,21884,20307,26367,22159,24789,28053,21059,
+23625,22825,28155,22635,30000,29980,24684,33300,33094,25361,26465,36834,
+30522,36339,36148,38081,24086,21381,21548,28867,27712,24311,20572,20141,
+24237,25402,33351,36890,26704,37230,30643,21516,38108,24420,31461,26742,
+25413,31570,32479,30171,20599,25237,22836,36879,20984,31171,31361,22270,
+24466,36884,28034,23648,22303,21520,20820,28237,22242,25512,39059,33151,
+34581,35114,36864,21534,23663,33216,25302,25176,33073,40501,38464,39534,
+39548,26925,22949,25299,21822,25366,21703,34521,27964,23043,29926,34972,
+27498,22806,35916,24367,28286,29609,39037,20024,28919,23436,30871,25405,
+26202,30358,24779,23451,23113,19975,33109,27754,29579,20129,26505,32593,
+24448,26106,26395,24536,22916,23041,24013,24494,21361,38886,36829,26693,
+22260,21807,24799,20026,28493,32500,33479,33806,22996,20255,20266,23614,
+32428,26410,34074,21619,30031,32963,21890,39759,20301,28205,35859,23561,
+24944,21355,30239,28201,34442,25991,38395,32441,21563,31283,32010,38382,
+21985,32705,29934,25373,34583,28065,31389,25105,26017,21351,25569,27779,
+24043,21596,38056,20044,27745,35820,23627,26080,33436,26791,21566,21556,
+27595,27494,20116,25410,21320,33310,20237,20398,22366,25098,38654,26212,
+29289,21247,21153,24735,35823,26132,29081,26512,35199,30802,30717,26224,
+22075,21560,38177,29306,31232,24687,24076,24713,33181,22805,24796,29060,
+28911,28330,27728,29312,27268,34989,24109,20064,23219,21916,38115,27927,
+31995,38553,25103,32454,30606,34430,21283,38686,36758,26247,23777,20384,
+29421,19979,21414,22799,21523,25472,38184,20808,20185,40092,32420,21688,
+36132,34900,33335,38386,28046,24358,23244,26174,38505,29616,29486,21439,
+33146,39301,32673,23466,38519,38480,32447,30456,21410,38262,39321,31665,
+35140,28248,20065,32724,31077,35814,24819,21709,20139,39033,24055,27233,
+20687,21521,35937,33831,30813,38660,21066,21742,22179,38144,28040,23477,
+28102,26195,23567,23389,26657,32918,21880,31505,25928,26964,20123,27463,
+34638,38795,21327,25375,25658,37034,26012,32961,35856,20889,26800,21368,
+34809,25032,27844,27899,35874,23633,34218,33455,38156,27427,36763,26032,
+24571,24515,20449,34885,26143,33125,29481,24826,20852,21009,22411,24418,
+37026,34892,37266,24184,26447,24615,22995,20804,20982,33016,21256,27769,
+38596,29066,20241,20462,32670,26429,21957,38152,31168,34966,32483,22687,
+25100,38656,34394,22040,39035,24464,35768,33988,37207,21465,26093,24207,
+30044,24676,32110,23167,32490,32493,36713,21927,23459,24748,26059,29572,
+36873,30307,30505,32474,38772,34203,23398,31348,38634,34880,21195,29071,
+24490,26092,35810,23547,39535,24033,27529,27739,35757,35759,36874,36805,
+21387,25276,40486,40493,21568,20011,33469,29273,34460,23830,34905,28079,
+38597,21713,20122,35766,28937,21693,38409,28895,28153,30416,20005,30740,
+34578,23721,24310,35328,39068,38414,28814,27839,22852,25513,30524,34893,
+28436,33395,22576,29141,21388,30746,38593,21761,24422,28976,23476,35866,
+39564,27523,22830,40495,31207,26472,25196,20335,30113,32650,27915,38451,
+27687,20208,30162,20859,26679,28478,36992,33136,22934,29814,25671,23591,
+36965,31377,35875,23002,21676,33280,33647,35201,32768,26928,22094,32822,
+29239,37326,20918,20063,39029,25494,19994,21494,26355,33099,22812,28082,
+19968,22777,21307,25558,38129,20381,20234,34915,39056,22839,36951,31227,
+20202,33008,30097,27778,23452,23016,24413,26885,34433,20506,24050,20057,
+30691,20197,33402,25233,26131,37009,23673,20159,24441,33222,36920,32900,
+30123,20134,35028,24847,27589,24518,20041,30410,28322,35811,35758,35850,
+35793,24322,32764,32716,32462,33589,33643,22240,27575,38899,38452,23035,
+21535,38134,28139,23493,39278,23609,24341,38544,21360,33521,27185,23156,
+40560,24212,32552,33721,33639,34631,36814,36194,30408,24433,39062,30828,
+26144,21727,25317,20323,33219,30152,24248,38605,36362,34553,21647,27891,
+28044,27704,24703,21191,29992,24189,20248,24736,24551,23588,30001,37038,
+38080,29369,27833,28216,37193,26377,21451,21491,20305,37321,35825,21448,
+24188,36802,28132,20110,30402,27014,34398,24858,33286,20313,20446,36926,
+40060,24841,28189,28180,38533,20104,23089,38632,19982,23679,31161,23431,
+35821,32701,29577,22495,33419,37057,21505,36935,21947,23786,24481,24840,
+27442,29425,32946,35465,28020,23507,35029,39044,35947,39533,40499,28170,
+20900,20803,22435,34945,21407,25588,36757,22253,21592,22278,29503,28304,
+32536,36828,33489,24895,24616,38498,26352,32422,36234,36291,38053,23731,
+31908,26376,24742,38405,32792,20113,37095,21248,38504,20801,36816,34164,
+37213,26197,38901,23381,21277,30776,26434,26685,21705,28798,23472,36733,
+20877,22312,21681,25874,26242,36190,36163,33039,33900,36973,31967,20991,
+34299,26531,26089,28577,34468,36481,22122,36896,30338,28790,29157,36131,
+25321,21017,27901,36156,24590,22686,24974,26366,36192,25166,21939,28195,
+26413,36711,38113,38392,30504,26629,27048,21643,20045,28856,35784,25688,
+25995,23429,31364,20538,23528,30651,27617,35449,31896,27838,30415,26025,
+36759,23853,23637,34360,26632,21344,25112,31449,28251,32509,27167,31456,
+24432,28467,24352,25484,28072,26454,19976,24080,36134,20183,32960,30260,
+38556,25307,26157,25214,27836,36213,29031,32617,20806,32903,21484,36974,
+25240,21746,34544,36761,32773,38167,34071,36825,27993,29645,26015,30495,
+29956,30759,33275,36126,38024,20390,26517,30137,35786,38663,25391,38215,
+38453,33976,25379,30529,24449,29424,20105,24596,25972,25327,27491,25919,
+24103,30151,37073,35777,33437,26525,25903,21553,34584,30693,32930,33026,
+27713,20043,32455,32844,30452,26893,27542,25191,20540,20356,22336,25351,
+27490,36286,21482,26088,32440,24535,25370,25527,32622,24092,23769,21046,
+26234,31209,31258,36136,28825,30164,28382,27835,31378,20013,30405,24544,
+38047,34935,32456,31181,32959,37325,20210,20247,33311,21608,24030,27954,
+35788,31909,36724,32920,24090,21650,30385,23449,26172,39588,29664,26666,
+34523,26417,29482,35832,35803,36880,31481,28891,29038,25284,30633,22065,
+20027,33879,26609,21161,34496,36142,38136,31569,20303,27880,31069,39547,
+25235,29226,25341,19987,30742,36716,25776,36186,31686,26729,24196,35013,
+22918,25758,22766,29366,26894,38181,36861,36184,22368,32512,35846,20934,
+25417,25305,21331,26700,29730,33537,37196,21828,30528,28796,27978,20857,
+21672,36164,23039,28363,28100,23388,32043,20180,31869,28371,23376,33258,
+28173,23383,39683,26837,36394,23447,32508,24635,32437,37049,36208,22863,
+25549,31199,36275,21330,26063,31062,35781,38459,32452,38075,32386,22068,
+37257,26368,32618,23562,36981,26152,24038,20304,26590,20570,20316,22352,
+24231,20109,19980,20800,19984,24319,21317,19989,20120,19998,39730,23404,
+22121,20008,31162,20031,21269,20039,22829,29243,21358,27664,22239,32996,
+39319,27603,30590,40727,20022,20127,40720,20060,20073,20115,33416,23387,
+21868,22031,20164,21389,21405,21411,21413,21422,38757,36189,21274,21493,
+21286,21294,21310,36188,21350,21347,20994,21000,21006,21037,21043,21068,
+21086,21089,21084,33967,21117,21122,21121,21136,21139,20866,32596,20155,
+20163,20169,20162,20200,20193,20203,20190,20251,20211,20258,20324,20213,
+20261,20263,20233,20267,20318,20327,25912,20314,20317,20319,20311,20274,
+20285,20342,20340,20369,20361,20355,20367,20350,20347,20394,20348,20396,
+20372,20454,20456,20458,20421,20442,20451,20444,20433,20447,20472,20521,
+20556,20467,20524,20495,20526,20525,20478,20508,20492,20517,20520,20606,
+20547,20565,20552,20558,20588,20603,20645,20647,20649,20666,20694,20742,
+20717,20716,20710,20718,20743,20747,20189,27709,20312,20325,20430,40864,
+27718,31860,20846,24061,40649,39320,20865,22804,21241,21261,35335,21264,
+20971,22809,20821,20128,20822,20147,34926,34980,20149,33044,35026,31104,
+23348,34819,32696,20907,20913,20925,20924,20935,20886,20898,20901,35744,
+35787,35791,35790,35822,35824,35827,35830,35833,35836,35842,35844,35847,
+35852,35855,35865,35867,35864,35869,35877,35879,21353,21370,38429,38434,
+38433,38449,38442,38461,38460,38466,38473,38484,38495,38503,38508,38514,
+38516,38536,38541,38551,38576,37015,37019,37021,37017,37036,37025,37044,
+37043,37046,37050,37048,37040,37071,37061,37054,37072,37060,37063,37075,
+37094,37090,37084,37079,37083,37099,37103,37118,37124,37154,37150,37155,
+37169,37167,37177,37187,37190,21005,22850,21154,21182,21759,21200,21206,
+21232,21471,29166,30669,24308,20981,20988,39727,21430,24321,30042,24047,
+22348,22441,22433,22654,22716,22725,22737,22313,22316,22314,22323,22329,
+22364,22331,22338,22377,22405,22379,22406,22396,22395,22376,22381,22390,
+22387,22445,22436,22412,22450,22479,22439,22452,22419,22432,22485,22488,
+22490,22489,22482,22456,22516,22511,22520,22500,22493,22539,22541,22525,
+22509,22528,22558,22553,22596,22560,22629,22636,22657,22665,22682,22656,
+39336,40729,25087,33401,33405,33407,33423,33418,33448,33412,33422,33425,
+33431,33433,33451,33464,33470,33456,33480,33482,33507,33432,33463,33454,
+33473,33449,33460,33441,33450,33439,33476,33486,33444,33505,33545,33527,
+33508,33551,33543,33500,33524,33490,33496,33548,33531,33491,33553,33562,
+33542,33504,33493,33564,33617,33544,33682,33596,33588,33585,33691,33630,
+33583,33615,33607,33603,33631,33600,33559,33632,33581,33594,33587,33638,
+33637,33640,33563,33641,33644,33642,33712,33656,33696,33706,33683,33692,
+33669,33660,33718,33705,33661,33720,33659,33688,33694,33704,33722,33724,
+33729,33793,33765,33752,22535,33816,33803,33757,33789,33750,33820,33848,
+33809,33798,33748,33759,33807,33795,33770,33733,33728,33830,33776,33761,
+33884,33873,33882,33881,33907,33914,33929,33912,33852,33862,33897,33910,
+33932,33934,33841,33901,33985,33997,34000,34022,33981,34003,33994,33983,
+33978,34016,33953,33977,33972,33943,34021,34019,34060,29965,34104,34032,
+34105,34079,34106,34134,34107,34047,34044,34137,34120,34152,34148,34142,
+34170,30626,34115,34162,34171,34212,34216,34183,34191,34169,34222,34204,
+34181,34233,34231,34224,34259,34241,34268,34303,34343,34309,34345,34326,
+34364,24318,24328,22844,22849,32823,22869,22874,22872,21263,23586,23589,
+23596,23604,25164,25194,25247,25275,25290,25306,25303,25326,25378,25334,
+25401,25419,25411,25517,25590,25457,25466,25486,25524,25453,25516,25482,
+25449,25518,25532,25586,25592,25568,25599,25540,25566,25550,25682,25542,
+25534,25669,25665,25611,25627,25632,25612,25638,25633,25694,25732,25709,
+25750,25722,25753,25786,25792,25808,25815,25828,25826,25865,25893,25902,
+24331,24530,29977,24337,21343,21489,21501,21481,21480,21499,21522,21526,
+21510,21579,21590,21571,21537,21591,21593,21539,21554,21634,21652,21623,
+21617,21604,21636,21622,21606,21661,21712,21677,21698,21684,21714,21671,
+21670,21618,21667,21717,21691,21695,21708,21668,21725,21711,21726,21787,
+21735,21792,21757,21780,21747,21775,21777,21799,21802,21863,21903,21941,
+21833,21869,21825,21845,21823,21840,21820,21815,21846,21811,21808,21852,
+21899,21970,21891,21937,21945,21896,21889,21919,21886,21974,21905,21883,
+21983,21908,21913,21994,22007,21961,22047,21969,21972,21990,21981,21956,
+21999,21989,21992,22005,21988,36756,22046,22024,22028,22017,22052,22051,
+22014,22016,22055,22061,22104,22073,22103,22060,22093,22114,22105,22108,
+22092,22100,22150,22116,22129,22123,22149,22163,22191,22228,22231,22237,
+22241,22261,22251,22265,22271,22276,22282,22281,22300,24079,24089,24084,
+24081,24113,24119,24132,24148,24155,24158,24161,23692,23674,23693,23696,
+23702,23688,23697,23706,23708,23733,23714,23741,23724,23723,23729,23715,
+23745,23735,23748,23762,23780,23755,23781,23847,23846,23854,23844,23838,
+23814,23835,23896,23870,23860,23869,23916,23899,23919,23901,23915,23883,
+23882,23913,23924,23938,23961,23965,35955,23991,24005,24435,24439,24450,
+24455,24457,24460,24469,24473,24476,24488,24493,24501,24508,34914,24417,
+29357,29360,29364,29379,29377,29390,29389,29394,29416,29423,29417,29426,
+29428,29431,29441,29427,29443,29463,29459,29473,29450,29470,29469,29461,
+29474,29497,29477,29484,29496,29489,29520,29517,29527,29536,29548,29551,
+29566,33307,22821,39143,22820,22786,39267,39284,39287,39293,39296,39300,
+39303,39306,39309,24192,24209,24203,24214,24229,24224,24249,24245,24254,
+24243,36179,24274,24273,24283,24296,24298,33210,24516,24521,24534,24527,
+24579,24558,24580,24545,24548,24574,24554,24557,24568,24601,24629,24614,
+24603,24591,24589,24617,24619,24586,24639,24609,24699,24698,24642,24682,
+24701,24726,24730,24749,24733,24707,24722,24716,24731,24812,24763,24753,
+24797,24792,24774,24794,24756,24864,24870,24853,24867,24820,24832,24846,
+24875,24906,24949,25004,24980,24999,25015,25044,25077,24541,38579,38377,
+38379,38385,38387,38396,38398,38406,38408,38415,38418,20012,29247,25109,
+27701,27732,27740,27722,27811,27781,27792,27796,27788,27764,27766,27782,
+27817,27856,27860,27821,27889,27863,27826,27872,27862,27898,27883,27886,
+27825,27859,27887,27902,27961,27943,27916,27971,27976,27911,27908,27929,
+27918,27947,27981,27950,27957,27930,27983,27986,27988,27955,28049,28015,
+28062,28064,27998,27996,28000,28028,28003,28186,28103,28101,28126,28174,
+28095,28128,28177,28134,28125,28121,28182,28075,28172,28078,28203,28270,
+28238,28267,28338,28255,28294,28210,28197,28228,28383,28337,28312,28384,
+28461,28386,28325,28327,28349,28347,28343,28375,28340,28367,28303,28354,
+28319,28514,28452,28437,28409,28463,28470,28491,28532,28458,28425,28457,
+28553,28557,28556,28536,28530,28540,28538,28625,28617,28583,28601,28598,
+28610,28641,28654,28638,28640,28655,28698,28707,28699,28729,28725,28751,
+28766,23424,23428,23445,23443,23461,23480,29999,39582,25652,23524,23534,
+35120,23536,36423,35591,36790,36819,36821,36837,36846,36836,36841,36838,
+36851,36840,36869,36868,36875,36902,36881,36877,36886,36897,36909,36911,
+36932,36944,36968,36952,36962,36955,26297,36980,36989,36994,37000,36995,
+37003,24400,24407,24406,24408,23611,21675,23632,23641,23409,23651,23654,
+32700,24362,24361,24365,33396,24380,39739,23662,22913,22915,22925,22947,
+22935,22986,22955,22942,22948,22994,22962,22959,22999,22974,23005,23048,
+23011,23000,23033,23052,23049,23090,23092,23057,23075,23059,23104,23143,
+23114,23125,23100,23138,23157,33004,23210,23195,23159,23162,23230,23275,
+23218,23250,23252,23224,23264,23267,23281,23254,23270,23256,23260,23305,
+23319,23318,23346,23351,23360,23573,23580,23386,23397,23411,23377,23379,
+23394,39541,39546,39551,39549,39557,39560,39562,39568,39574,39576,39589,
+39591,32415,32417,32419,32421,32429,32432,32446,32464,32468,32471,32475,
+32488,32491,32525,32502,32535,32537,32540,32539,32543,32565,24186,30079,
+24027,30014,37013,29582,29585,29614,29602,29599,29647,29634,29649,29623,
+29619,29632,29641,29640,29669,29657,39036,29706,29673,29671,29662,29626,
+29682,29711,29738,29787,29734,29733,29736,29744,29742,29740,29723,29722,
+29761,29788,29783,29781,29785,29815,29805,29822,29852,29838,29831,29835,
+29854,29840,29863,29906,29882,26444,26451,26462,26440,26473,26533,26503,
+26474,26483,26520,26535,26485,26536,26526,26541,26507,26487,26492,26608,
+26633,26584,26634,26601,26544,26636,26585,26549,26586,26547,26589,26624,
+26563,26552,26594,26638,26561,26621,26702,26722,26692,26724,26755,26653,
+26709,26726,26689,26727,26688,26686,26698,26697,26665,26805,26767,26740,
+26743,26771,26731,26818,26990,26876,26873,26916,26864,26891,26881,26967,
+26851,26896,26993,26937,26976,26946,26973,27012,26987,27008,27032,27000,
+26932,27084,27086,27017,26982,26979,27001,27035,27047,27067,27051,27053,
+27092,27057,27073,27082,27103,27029,27104,27021,27135,27183,27117,27237,
+27122,27204,27198,27296,27216,27227,27189,27278,27257,27197,27176,27224,
+27260,27281,27280,27305,27287,27307,29495,29522,27527,27524,27553,27562,
+36715,36717,36728,36727,36732,36734,36740,36743,36747,36760,36762,36558,
+25099,25111,25115,25119,25122,25121,25125,25124,25132,33255,29935,29940,
+29951,29967,29969,29971,25908,26122,26137,26482,26115,26133,26112,28805,
+26359,26141,26164,26161,26166,26165,32774,26207,26196,26177,26191,26198,
+26209,26199,26231,26244,26252,26279,26269,26302,26342,26345,36150,36155,
+36157,36160,36167,36173,36181,36185,35271,29294,29343,29277,29286,29295,
+29316,29323,29325,29327,29330,25352,25394,25520,25663,25816,32772,27626,
+27635,27645,27637,27641,27653,27655,27654,27661,27669,27681,27689,27684,
+27690,27698,25909,25941,25963,29261,29266,29270,29232,34402,21014,32927,
+32924,32915,32956,26378,32957,32945,32939,32941,32948,32951,32987,32962,
+32964,32985,32973,32983,26384,32989,33003,33009,33012,33005,33010,33020,
+26389,33042,35930,33078,33054,33068,33048,33074,33096,33100,33107,33140,
+33137,33120,33129,33133,33127,22605,23221,33160,33154,33169,28373,33187,
+33194,33228,26406,33226,33211,33217,33190,27428,27447,27449,27459,27462,
+27481,27571,24384,27586,35315,26000,40785,26003,26044,26054,26052,26051,
+26060,26062,26066,26070,28800,28828,28822,28829,28859,28864,28855,28843,
+28849,28904,28874,28944,28947,28950,28975,28977,29043,29020,29032,28997,
+29042,29002,29048,29050,29080,29107,29109,29096,29088,29152,29140,29159,
+29177,29213,29224,28780,28952,29030,29113,25150,25149,25155,31035,31040,
+31046,31049,31059,31066,31074,31063,31072,31087,31079,31098,31109,31114,
+31130,31143,31155,24529,24528,24636,24669,24666,24679,24641,24665,24675,
+24747,24838,24845,24925,25001,24989,25035,25041,25094,32896,32895,27795,
+27894,28156,30710,30712,30720,30729,30737,26027,30765,30751,30780,30757,
+30764,30755,30761,30798,30829,30758,30800,30791,30796,30826,30875,30867,
+30874,30855,30876,30881,30883,30898,30905,30885,30932,30937,30921,30956,
+30962,30981,30964,30995,31012,31006,31028,40859,40697,30449,30468,30477,
+30457,30490,30498,30489,30509,30502,30517,30520,30535,30531,30554,30568,
+30562,30565,30591,30605,30589,30592,30604,30609,30640,30645,30653,30010,
+30016,30030,30027,30024,30043,30066,30073,30083,32600,32609,32607,35400,
+32616,32628,32625,32633,32641,32638,30413,30437,34866,38027,38026,38036,
+38039,38037,38059,38058,38061,38060,38066,38068,38079,38084,38105,38104,
+38107,38122,38121,38123,38135,38137,38143,38147,38146,38168,38171,38185,
+38188,38210,38197,38217,38220,38202,30695,30700,38601,31189,31213,31203,
+31211,31238,23879,31235,31234,31262,31252,31289,31287,31313,40655,39333,
+31344,30344,30350,30355,30361,30372,29918,29920,29996,40480,40482,40498,
+40497,40502,40504,40503,40526,40529,40533,40535,40542,40547,40561,40557,
+40563,30098,30100,30102,30112,30109,30124,30115,30136,30148,30129,30128,
+30147,30146,30166,30157,30179,30184,30182,30180,30187,30183,30211,30193,
+30204,30207,30224,30208,30213,30220,30231,30218,30245,30232,30229,30233,
+30235,30268,30242,30240,30272,30253,30256,30271,30261,30275,30270,30259,
+30285,30302,30292,30300,30294,30315,30319,32714,31462,31360,31366,31368,
+31381,31398,31392,31404,31400,31405,31411,34916,34921,34930,34941,34943,
+34946,34978,35014,34999,35004,35017,35042,35022,35043,35045,35057,35098,
+35068,35048,35070,35056,35105,35097,35091,35099,35082,35124,35115,35126,
+35137,35174,35195,30091,32997,30386,30388,30684,32786,32788,32790,32796,
+32800,32802,32809,32808,32817,32779,32821,32835,32838,32845,32850,32873,
+32881,35203,39032,39040,39043,39049,39055,39060,34381,34388,34412,34414,
+34431,34426,34428,34427,34472,34445,34443,34476,34461,34471,34467,34474,
+34451,34473,34486,34500,34485,34510,34480,34490,34481,34479,34505,34511,
+34484,34537,34541,34547,34512,34579,34526,34548,34527,34520,34513,34563,
+34567,34552,34568,34570,34573,34569,34595,34619,34590,34597,34606,34586,
+34622,34632,34612,34609,34601,34615,34623,34690,34594,34683,34656,34672,
+34636,34670,34699,34643,34659,34684,34660,34649,34661,34707,34735,34728,
+34770,34758,34696,34693,34733,34711,34691,34731,34789,34732,34741,34739,
+34763,34771,34749,34769,34752,34762,34779,34794,34784,34798,34838,34835,
+34814,34826,34843,34849,34873,34876,32566,32578,33296,31482,31485,31496,
+31509,31498,31531,31503,31559,31544,31530,31513,31534,31537,31520,31525,
+31524,31539,31550,31518,31576,31578,31557,31605,31564,31581,31584,31598,
+31611,31586,31602,31601,31632,31672,31660,31645,31656,31621,31658,31644,
+31650,31659,31668,31697,31681,31692,31709,31706,31722,31756,31742,31740,
+31759,31766,31755,31775,31786,31782,31800,31809,31808,33278,33284,33260,
+34884,33325,33327,33320,33323,33336,33339,33342,33348,33353,33355,33359,
+33370,33375,33384,34942,34949,34952,35032,35039,35166,32669,32671,32679,
+32690,31868,25929,31889,31901,31900,31902,31906,31922,31937,31943,31944,
+31941,31959,31976,33390,26280,32703,32718,32725,32741,32737,32742,32745,
+32750,32755,31992,32119,32166,32174,32327,32411,40632,40628,36211,36228,
+36244,36241,36273,36199,36205,35911,35913,37194,37200,37220,37218,37217,
+37232,37225,37231,37234,37236,37241,37260,37253,37264,37261,37265,37301,
+37300,37306,35925,40574,36280,36331,36357,36441,36457,36277,36287,36284,
+36282,36292,36314,36318,36315,36294,36332,36323,36345,36347,36324,36361,
+36349,36372,36381,36383,36396,36398,36387,36399,36410,36416,36409,36405,
+36413,36401,36425,36426,36464,36470,36476,36463,36468,36485,36495,36500,
+36496,36508,36510,35960,35970,35978,35973,35992,35988,26011,35286,35294,
+35290,35292,35301,35307,35311,35390,35622,38739,38633,38643,38639,38662,
+38657,38664,38671,38670,38698,38701,38704,38718,40832,40835,40844,40702,
+40715,40717,38585,38606,38610,30655,38624,37518,37550,37576,37694,37738,
+37834,37775,37950,37995,40063,40066,31267,40075,40078,40159,40162,38780,
+38789,38804,38831,38827,38819,38834,38836,39601,39600,39607,40536,39606,
+39610,39612,39617,39616,39621,39618,39633,39749,39747,39751,39753,39752,
+39757,39761,39144,39181,39214,39253,39252,39647,39649,39654,39663,39659,
+39675,39661,39673,39688,39695,39699,39711,39715,32315,40578,40587,40594,
+37846,40605,40607,40672,40671,40674,40681,40679,40677,40682,40687,40738,
+40748,40751,40761,40759,40772,12295,65374,8214,12307,65294,65309,65339,
+65341,65507,252,169,8482,8230,32,30362,34297,31001,24859,39599,
+35158,22761,32631,25850,25943,38930,36774,32070,24171,32129,37770,35607,
+39165,23542,22577,39825,36649,35997,37575,29437,20633,24970,32179,31558,
+30050,25987,24163,38281,37002,32232,36022,35722,36783,36782,27161,40009,
+30303,28693,28657,36051,25839,39173,25765,37474,37457,39361,35036,36001,
+21443,34870,27544,24922,24920,29158,33980,33369,20489,28356,21408,20596,
+28204,23652,35435,25881,25723,34796,39262,35730,32399,37855,29987,38369,
+39019,22580,22039,38263,20767,33144,24288,26274,37396,36554,24505,22645,
+38515,35183,31281,25074,35488,39425,36978,39347,40786,29118,34909,34802,
+23541,30087,36490,31820,32162,37276,37604,38619,30990,20786,35320,34389,
+20659,30241,38358,21109,37656,32020,32189,36781,35422,36060,32880,24478,
+21474,36517,31428,37679,36948,24118,36024,25812,21934,37170,25763,33213,
+24986,35477,24392,30070,25803,40680,34153,27284,25623,23798,31153,23566,
+29128,37159,25973,28364,36958,32224,39003,40670,22666,38651,28593,37347,
+35519,35548,37336,38914,37664,35330,26481,21205,26847,20941,39717,29346,
+29544,35712,36077,37709,37723,26039,32222,38538,23565,22136,38931,37389,
+22890,22702,40285,38989,35355,24801,39187,20818,29246,39180,36019,30332,
+32624,38309,31020,37353,29033,31684,36009,39151,35370,32033,39131,35513,
+24290,36027,32027,22707,22894,24996,31966,35920,26963,37586,39080,30219,
+39342,32299,35575,40179,33178,36667,25771,36628,36070,24489,36000,35331,
+23142,32283,35442,37411,33995,24185,36245,36123,23713,21083,37628,32177,
+23831,37804,25841,40255,38307,37499,20491,32102,40852,38799,36002,37390,
+28317,27083,36092,34865,39015,21102,38364,35264,39208,24931,36011,24291,
+35215,27512,40860,38312,36556,35437,27331,36020,21130,36645,37707,22283,
+36942,39405,38867,28450,34399,38305,40372,36032,36703,40251,32005,22778,
+35703,28396,22057,33775,30059,21123,35441,25079,22750,27489,29872,36996,
+32233,35594,25582,36637,36036,31330,26371,29172,21295,35569,35496,32362,
+33911,28222,29554,36008,31117,25802,27231,31309,39249,35663,40388,32318,
+32221,26997,36655,32026,25824,24190,34186,21137,28639,35336,35352,38555,
+32380,32000,22846,33698,38960,36040,37440,20729,39381,27570,30435,22533,
+31627,38291,33393,32216,32365,27298,40572,25536,25791,31777,20745,34214,
+27323,37970,36368,36068,35211,37749,33382,21133,39198,28472,28666,28567,
+23559,28479,34083,27123,22892,35611,37292,33184,28550,39509,23308,25898,
+37496,30703,20709,39171,32371,32094,36686,36611,38542,31680,28500,32080,
+35489,32202,37670,20677,35641,36914,29180,30433,21185,33686,39912,39514,
+32147,38968,37857,24465,30169,31478,31998,33290,39378,33289,25818,37624,
+25084,21127,40273,32121,35258,35363,32118,37406,36557,39423,38283,20977,
+38982,27579,35506,22718,25031,25715,24235,35122,35463,22602,20744,23532,
+31014,26336,34407,24011,31418,39243,28528,25844,38346,34847,33240,33802,
+20358,36084,34253,27396,25876,31811,38348,34349,28734,35733,25900,35261,
+25078,32412,29211,28651,25736,21214,28551,27138,37939,22744,39006,31852,
+38626,28757,35023,39881,31150,40599,21426,21237,31019,27511,28701,38584,
+20486,32879,34030,36899,37934,24976,28451,31806,25986,33225,37832,25088,
+29001,32244,31975,20841,36635,35538,30274,36988,37904,29557,33256,37168,
+40023,36035,40801,37428,38728,23994,38936,39230,21129,40845,32894,22184,
+31840,22751,25871,38580,27155,23105,25695,31757,34310,30439,39025,24300,
+29200,25796,28407,34396,39791,36034,37682,38520,39522,37569,23650,32311,
+24942,28670,32209,24018,25891,23423,28772,20098,25476,36650,20523,20374,
+28138,32184,35542,34367,32645,37007,38012,31854,39486,39409,32097,23229,
+29802,30908,34718,39340,39393,21966,36023,40613,36067,36993,30622,39237,
+34875,28415,35646,37672,37466,36031,37762,38272,24758,20497,37683,22818,
+35598,24396,35219,32191,32236,24287,28357,25003,38313,40180,37528,35628,
+35584,30045,37385,32013,38627,25747,33126,24817,39719,39186,25836,33193,
+25862,37312,40165,32886,22169,38007,37811,27320,29552,23527,25840,28632,
+37397,32016,33215,28611,36786,30247,35582,27472,40407,27590,22036,28442,
+30436,40848,36064,22132,40300,39449,39108,38971,36007,34315,24977,35413,
+28497,38935,25778,37610,20693,27192,35676,33229,40778,39438,35912,21843,
+27683,35350,29309,37370,37467,36983,31805,35609,37666,37463,28154,35700,
+22649,27085,21958,22715,34196,25654,37740,27211,21932,20689,32761,31429,
+31434,27453,35242,23522,36629,27691,20670,38915,35531,24950,29898,31406,
+36264,21312,36544,39493,40818,39028,27402,21240,40306,30906,35731,39250,
+25854,32350,29105,38860,35469,32009,27054,32104,36575,37613,38287,28516,
+28753,34217,39955,36093,20632,21930,39479,25475,28544,27578,32023,31721,
+26348,38275,38493,36109,32341,20663,36062,29138,32057,36050,25448,25885,
+25086,35373,32051,23529,23352,33102,28402,32882,32361,21213,32854,24107,
+29509,28629,35433,26178,34645,23526,35672,39387,21218,36969,37323,39166,
+35222,35430,22781,29560,27166,36664,26360,36118,23660,34899,27193,31466,
+25976,24101,38617,35504,38918,35500,30889,29197,32114,39164,39686,32883,
+24939,38924,35359,35494,25851,34311,35380,32901,38614,38568,32143,27506,
+23403,25613,32302,29795,37782,29562,25787,33274,24907,25892,36010,30321,
+28760,22727,35674,35527,22022,28271,29145,28644,32295,35342,39472,35588,
+37563,38988,39636,26781,36028,37941,24307,32893,28916,37509,32113,38957,
+22294,22615,22296,38973,40213,39345,39389,27234,31402,35178,24398,28771,
+38929,33836,32178,38859,36949,22285,29234,28656,32173,33894,20553,20702,
+32239,35586,34907,32862,32011,31337,21839,25790,34680,28198,31401,21978,
+37794,28879,35491,28961,34154,22626,38695,21209,35492,37675,29351,35186,
+32722,37521,25138,32048,34662,36676,23805,20448,29433,22151,37697,39854,
+32406,36066,37532,38289,39023,38570,29694,29563,32291,39201,25010,32171,
+38002,37129,35443,38911,38917,34157,22210,37559,26313,22063,21332,25406,
+33029,35559,23531,28681,35613,37573,37313,33288,37561,32137,38920,35377,
+32210,32396,36562,25080,36984,30316,32098,23416,21211,35426,23563,39348,
+35347,35338,36956,22739,40201,40232,21854,20126,35357,38329,40573,22196,
+38996,38331,33399,21421,30831,35578,39511,40230,26954,25562,30221,38525,
+30306,39178,27171,22575,35617,34277,29242,38913,26989,33865,37291,37541,
+38948,36986,20736,34811,34269,20740,25014,32681,35427,35696,35516,35695,
+32377,34093,38512,37504,39154,38577,27387,23344,40441,25033,32403,29801,
+34722,29151,29074,34821,36111,31310,21938,25793,20653,30320,36404,20778,
+24962,37109,37438,29494,35480,36671,39192,39770,28417,33287,23996,35486,
+39729,29508,35709,38928,39341,40219,28149,36677,22290,21729,22291,32227,
+36960,39000,32004,36493,38000,38322,38642,37142,38549,36939,34292,37270,
+26248,38620,36617,25890,26283,36106,36124,33247,38015,26839,31432,36012,
+25799,21063,28580,36042,36104,36555,37720,38296,35408,40779,20661,27656,
+30430,26028,36670,23940,26855,25136,32187,24373,28466,24115,36076,33081,
+36249,34756,36685,37754,36889,35998,37341,20597,35386,37806,38499,24128,
+30309,37165,35657,32340,32887,22519,34937,32025,25711,25842,24159,36074,
+28399,37912,32066,31278,33131,34886,35589,36600,30394,26205,39519,35576,
+35461,29165,30682,22225,36015,37956,31689,39376,23560,30938,36681,36090,
+27137,33674,35037,22941,22767,29376,37648,36101,22684,32180,35524,28310,
+28609,36039,28460,32156,32317,32305,37138,35419,32068,38013,21959,21401,
+21428,38760,36107,21293,21297,36094,21060,21132,21108,20660,20480,20630,
+20757,20738,20756,20796,20791,20712,20674,20795,20752,20794,20681,31988,
+40652,22213,40172,35131,33248,35329,35344,35340,35349,35635,35406,35365,
+35393,35382,35398,35412,35416,35410,35462,35460,35455,35440,35452,35445,
+35436,35438,35533,35554,35425,35482,35493,35535,35537,35529,35547,35543,
+35522,35510,35574,35563,35604,35585,35556,35565,35580,35571,35558,35566,
+35550,35624,35740,35606,35610,35600,35627,35629,35670,35673,35662,35742,
+35691,35734,38488,37178,37140,37172,37087,37174,37126,37192,33467,21233,
+24048,22538,22745,22754,22752,22746,22497,22607,22550,22610,22557,22628,
+34188,34131,34294,33703,33799,34031,33511,34338,34086,22603,29026,34136,
+34045,34126,34184,34234,29334,28366,34113,34254,34130,33984,33874,33892,
+33940,33845,34207,34133,40367,33939,32264,34118,34146,34078,39488,34362,
+37795,34167,34334,34298,34308,34282,34330,22889,23607,25451,25718,25759,
+25681,25692,25779,25860,25878,25847,25852,25883,22064,22072,22216,22182,
+21764,21692,22144,22109,22112,22069,22006,22118,22130,22156,22117,22044,
+22062,21993,22038,22208,22029,22195,22209,22127,36705,22198,22165,22279,
+24131,24172,24152,24151,23943,23796,23888,23852,23975,23968,23959,23821,
+23992,23937,24020,24480,29559,29505,29546,29499,29547,29568,29564,39136,
+39219,39145,39228,39149,39156,39177,39185,39195,39223,39231,39235,39244,
+39266,24289,36065,25082,25006,24938,24894,24757,24884,25036,24927,25064,
+24827,24887,24818,24947,24860,24978,38274,38278,38344,38286,38292,38284,
+38373,38317,38315,39726,38316,38334,38326,39721,38335,38333,38332,38339,
+38347,38356,38352,38357,38366,28739,28505,28711,28696,28668,28039,28025,
+28254,28590,28687,28408,28527,28150,28543,28678,28576,28683,28775,28740,
+28677,28535,28704,28703,28722,28712,28765,39467,36999,36885,37008,23656,
+24371,23285,23255,23296,23149,23304,23372,23207,23291,23307,23329,23338,
+23321,39380,39391,39385,39478,39515,39377,39384,39501,39498,39394,39530,
+39439,39437,39429,39490,39469,39446,39489,39470,39480,39503,39525,39524,
+31993,32006,32002,32394,32028,32021,32019,32058,32050,32049,32272,32060,
+32064,32063,32093,32078,32115,32134,32131,32136,32190,32186,32203,32212,
+32196,32158,32172,32185,32163,32176,32199,32217,32215,32249,32242,32354,
+32230,32246,32241,32267,32225,32265,32285,32287,32286,32301,32266,32273,
+32381,32313,32309,32306,32326,32325,32392,32346,32338,32366,32382,32368,
+32367,32408,29859,29771,29903,38922,29885,29759,29833,29862,29908,29914,
+38873,38878,38876,27050,27370,26776,26838,27141,26783,27355,27379,27368,
+27359,27273,26895,27208,26984,27071,27194,27292,27410,27422,27357,27111,
+27407,27414,27372,27354,27384,27315,27367,27299,27347,27358,27556,27550,
+27566,27563,27567,36564,36571,36594,36603,36708,36601,36604,36587,36580,
+36706,36602,36606,36618,36615,36613,36626,36646,36636,36659,36678,36692,
+25108,25127,29964,26311,26308,26249,26326,36033,36016,36026,36029,36100,
+36018,36037,36112,36049,36058,36053,36075,36071,36091,35224,35244,35233,
+35263,35238,35247,35250,35255,27647,27660,27692,29272,26407,33110,33242,
+33051,33214,33121,33231,27487,39094,39100,39110,39112,36674,40783,26005,
+29036,29010,29079,29121,29148,29182,31152,31118,31146,25055,24932,25059,
+25095,28585,30959,30893,30824,30904,31018,31025,30820,30973,30951,30947,
+40853,30616,30558,30652,32646,32648,37337,37335,37333,37367,37351,37348,
+37702,37365,37369,37384,37414,37445,37393,37392,37377,37415,37380,37413,
+37376,37434,37478,37431,37427,37461,37437,37432,37470,37439,37984,37424,
+37449,37448,37453,37422,37433,37944,37548,37536,37498,37546,37614,37583,
+37891,37603,37946,37553,37542,37799,37526,37580,37545,37877,37523,37503,
+37801,37530,37658,37547,37507,37899,37544,37539,37906,37688,37617,37847,
+37605,37616,37615,37608,37564,37597,37622,37571,37599,37606,37650,37638,
+37737,37659,37696,37633,37653,37678,37699,37663,37657,37733,37703,37750,
+37716,37732,37802,37744,37764,37860,37848,37928,37767,37836,37784,37816,
+37823,37798,37808,37813,37964,37858,37837,37854,37827,37831,37841,37908,
+37917,37879,37989,37907,37997,37920,38009,37881,37913,37962,37938,37951,
+37972,37987,37758,31329,40169,40182,40199,40198,40227,40327,40469,40221,
+40223,40421,40239,40409,40240,40258,40478,40275,40477,40288,40274,40435,
+40284,40289,40339,40298,40303,40329,40344,40346,40384,40357,40361,40386,
+40380,40474,40403,40410,40431,40422,40434,40440,40460,40442,40475,30308,
+30296,30311,30210,30281,30238,30267,30313,30322,31431,31414,35168,35123,
+35165,35143,35128,35172,30392,32814,32812,32889,32885,38919,38945,38940,
+28481,38950,38967,38990,38995,39027,39010,39001,39013,39020,39024,34787,
+34822,34566,34851,34806,34554,34799,34692,34832,34760,34833,34747,34766,
+32588,31716,31591,31849,31731,31744,31691,31836,31774,31787,31779,31850,
+31839,33380,33387,35018,32677,31986,31990,31965,32310,40617,36274,37317,
+37315,40570,36489,36428,36498,36474,36437,36506,36491,36499,36497,36513,
+36451,36522,36518,35316,35318,38746,38722,38717,38724,40788,40799,40793,
+40800,40796,40806,40812,40810,40823,40701,40703,40713,35726,38014,37864,
+39799,39796,39809,39811,39822,40056,31308,39826,40031,39824,39853,39834,
+39850,39838,40045,39851,39837,40024,39873,40058,39985,39993,39971,39991,
+39872,39882,39879,39933,39894,39905,39908,39911,39901,39906,39920,39899,
+39924,39892,40029,39944,39952,39949,39954,39945,39935,39968,39986,39981,
+39976,39973,39977,39987,39998,40008,39995,39989,40005,40022,40020,40018,
+40039,38851,38845,38857,40379,39631,39638,39637,39768,39758,39255,39260,
+39714,40695,40690,35180,38342,37686,24390,34068,32404,40803,22137,40725,
+22081,39662,35079,31296,39091,38308,39693,36852,24409,31339,39138,20642,
+34193,20760,25458,21067,30543,32397,26310,30637,40565,22217,40692,28635,
+25054,30663,28720,40629,34890,38370,38854,31844,32308,38822,40623,22220,
+39089,27311,32590,31984,20418,32363,40569,22190,39706,33903,31142,31858,
+39634,38587,32251,35069,30787,729,8211,8213,8229,8245,8453,8457,
+8725,8735,8739,8786,9737,8853,12306,13217,13252,13262,13269,65072,
+65506,65508,8481,12849,8208,12540,19983,19986,19991,20003,20006,20009,
+20017,20019,20021,20023,20028,20036,20038,20042,20049,20053,20055,20103,
+20106,20112,20131,20138,20168,20172,20192,20194,20209,20212,20220,20222,
+20224,20257,20259,20273,20275,20277,20279,20281,20283,20306,20308,20310,
+20326,20328,20357,20359,20362,20364,20366,20368,20388,20395,20397,20441,
+20443,20450,20464,20466,20490,20494,20496,20499,20539,20541,20644,20646,
+20737,20739,20741,20746,20753,20755,20802,20807,20810,20812,20842,20847,
+20850,20858,20888,20890,20897,20899,20933,20936,20938,20942,20944,20972,
+20974,20978,20980,20983,20990,21034,21036,21039,21052,21054,21094,21096,
+21118,21120,21184,21186,21192,21194,21207,21210,21212,21314,21316,21318,
+21339,21341,21349,21352,21354,21362,21366,21369,21406,21409,21412,21415,
+21427,21429,21461,21466,21473,21479,21492,21498,21506,21509,21511,21515,
+21524,21532,21538,21546,21552,21555,21562,21565,21567,21575,21577,21585,
+21594,21603,21605,21607,21633,21635,21637,21645,21649,21651,21669,21678,
+21680,21682,21694,21699,21701,21718,21720,21723,21728,21755,21758,21760,
+21765,21768,21803,21805,21810,21821,21824,21826,21829,21885,21887,21931,
+21933,21940,21942,21944,21946,21948,21979,21982,21984,21986,21991,22067,
+22071,22074,22113,22115,22119,22128,22131,22133,22135,22138,22236,22243,
+22277,22284,22335,22337,22373,22375,22380,22382,22437,22440,22442,22444,
+22606,22608,22611,22655,22658,22660,22683,22685,22738,22740,22753,22755,
+22762,22765,22819,22822,22824,22828,22832,22843,22845,22891,22893,22901,
+22903,22917,22921,23001,23003,23040,23042,23091,23093,23251,23253,23345,
+23347,23378,23382,23390,23410,23412,23422,23426,23430,23434,23444,23446,
+23455,23520,23523,23530,23533,23535,23557,23564,23568,23575,23577,23579,
+23587,23590,23647,23655,23661,23664,23730,23732,23734,23742,23744,23783,
+23785,23845,23848,23960,23962,23993,23995,24068,24071,24181,24183,24210,
+24216,24219,24221,24297,24299,24336,24338,24340,24342,24366,24368,24370,
+24372,24397,24399,24401,24404,24419,24421,24440,24442,24451,24454,24477,
+24479,24502,24504,24695,24702,24723,24725,24732,24734,24750,24752,24755,
+24759,24793,24795,24798,24810,24821,24905,24909,24975,24979,25002,25005,
+25081,25083,25085,25097,25107,25113,25120,25123,25126,25131,25133,25135,
+25137,25236,25241,25274,25278,25283,25291,25295,25297,25301,25328,25330,
+25333,25450,25452,25483,25485,25489,25505,25508,25510,25515,25519,25529,
+25531,25533,25535,25567,25570,25587,25589,25591,25629,25631,25662,25664,
+25731,25734,25770,25775,25777,25780,25782,25785,25789,25795,25798,25804,
+25807,25809,25811,25823,25825,25827,25829,25853,25855,25875,25877,25879,
+25882,25884,25911,25914,25944,25946,25948,25969,25971,25974,26002,26004,
+26006,26008,26010,26022,26024,26026,26030,26123,26125,26158,26160,26206,
+26208,26213,26215,26309,26312,26396,26398,26409,26414,26416,26445,26450,
+26478,26484,26486,26493,26496,26504,26506,26518,26521,26523,26532,26534,
+26537,26540,26542,26587,26591,26593,26630,26637,26640,26642,26687,26695,
+26699,26701,26703,26706,26754,26756,26826,26828,26892,26897,27009,27011,
+27013,27049,27052,27134,27136,27168,27170,27369,27371,27448,27451,27452,
+27525,27528,27532,27543,27545,27596,27598,27608,27610,27662,27666,27671,
+27680,27685,27693,27697,27699,27761,27763,27765,27780,27783,27808,27810,
+27816,27820,27871,27876,27890,27892,27897,27970,27972,27977,27980,27984,
+27995,27997,27999,28060,28066,28069,28146,28148,28152,28171,28175,28202,
+28206,28245,28247,28336,28339,28341,28355,28358,28365,28368,28370,28374,
+28387,28391,28462,28464,28515,28517,28529,28531,28537,28539,28667,28669,
+28697,28700,28702,28848,28850,28901,28906,28910,28948,28951,29003,29005,
+29027,29029,29106,29108,29225,29227,29271,29274,29276,29278,29280,29324,
+29326,29391,29393,29493,29498,29545,29550,29553,29558,29561,29565,29567,
+29576,29578,29670,29672,29735,29737,29739,29741,29743,29782,29784,29789,
+29823,29826,29832,29834,29915,29917,29919,29921,29925,29966,29968,29970,
+29994,29998,30004,30006,30009,30067,30069,30071,30096,30099,30101,30104,
+30110,30114,30163,30167,30170,30181,30185,30230,30234,30243,30248,30252,
+30269,30273,30293,30295,30310,30312,30314,30339,30341,30407,30409,30419,
+30421,30432,30434,30438,30448,30451,30474,30476,30521,30523,30564,30567,
+30630,30632,30635,30692,30694,30696,30698,30739,30741,30745,30747,30750,
+30756,30760,30781,30783,30788,30790,30797,30799,30801,30880,30882,30884,
+30886,30888,30907,30909,31037,31039,31151,31154,31164,31167,31170,31178,
+31180,31205,31208,31210,31212,31214,31288,31290,31294,31362,31365,31367,
+31399,31403,31430,31433,31493,31495,31497,31527,31529,31533,31545,31547,
+31549,31560,31562,31571,31573,31575,31577,31580,31606,31608,31610,31685,
+31688,31690,31741,31743,31776,31778,31851,31853,31942,31945,31947,31985,
+31987,31989,31991,31994,31999,32001,32003,32012,32022,32024,32065,32067,
+32069,32223,32226,32240,32243,32245,32307,32312,32314,32316,32393,32395,
+32398,32405,32407,32430,32436,32470,32484,32492,32505,32522,32528,32542,
+32567,32569,32589,32591,32598,32601,32623,32627,32647,32649,32651,32653,
+32678,32680,32702,32704,32715,32717,32751,32754,32785,32787,32811,32813,
+32818,32820,32828,32830,32851,32853,32855,32857,32884,32888,32904,32906,
+32919,32921,32926,32931,32940,32944,32947,32955,32965,32998,33006,33013,
+33015,33017,33019,33045,33047,33049,33095,33097,33101,33103,33106,33128,
+33130,33132,33135,33227,33230,33257,33259,33277,33279,33283,33291,33297,
+33299,33309,33312,33321,33326,33330,33338,33352,33354,33381,33383,33417,
+33420,33424,33438,33440,33447,33458,33466,33468,33481,33488,33494,33501,
+33506,33528,33530,33549,33552,33582,33584,33586,33591,33595,33608,33610,
+33629,33634,33693,33695,33697,33717,33723,33749,33751,33794,33797,33890,
+33893,33898,33902,33904,33906,33908,33913,33930,33933,33979,33982,34080,
+34082,34132,34135,34182,34185,34187,34213,34215,34361,34363,34395,34397,
+34501,34504,34559,34561,34580,34582,34585,34587,34589,34644,34646,34648,
+34677,34679,34757,34759,34761,34795,34797,34834,34836,34904,34906,34908,
+34922,34925,34927,34929,34944,34947,35121,35125,35127,35200,35202,35262,
+35267,35277,35291,35293,35317,35319,35337,35339,35341,35343,35348,35351,
+35356,35358,35407,35409,35411,35434,35439,35444,35487,35490,35495,35528,
+35530,35532,35534,35536,35555,35557,35577,35579,35581,35583,35587,35590,
+35605,35608,35612,35671,35675,35741,35743,35756,35761,35771,35783,35792,
+35818,35849,35870,36017,36021,36025,36030,36038,36041,36059,36061,36063,
+36069,36105,36108,36110,36183,36191,36197,36281,36283,36285,36301,36304,
+36340,36342,36348,36395,36397,36400,36462,36465,36467,36469,36486,36488,
+36492,36494,36507,36509,36612,36614,36616,36704,36707,36709,36714,36736,
+36748,36754,36765,36775,36778,36780,36803,36806,36815,36818,36835,36839,
+36844,36847,36876,36878,36883,36888,36892,36940,36950,36957,36959,36961,
+36964,36979,36982,36985,36987,36990,37010,37012,37014,37016,37018,37020,
+37035,37037,37042,37047,37086,37088,37100,37102,37123,37125,37139,37141,
+37166,37171,37173,37191,37201,37227,37229,37235,37254,37256,37258,37314,
+37316,37318,37320,37328,37334,37366,37368,37527,37529,37531,37540,37543,
+37549,37560,37562,37570,37572,37574,37607,37609,37695,37698,37800,37803,
+37805,37807,37833,37835,37856,37859,37878,37880,38033,38038,38040,38087,
+38095,38106,38118,38139,38172,38176,38183,38195,38205,38211,38216,38219,
+38229,38234,38240,38254,38282,38285,38288,38290,38343,38345,38380,38399,
+38407,38419,38424,38427,38430,38432,38462,38465,38467,38474,38492,38494,
+38496,38535,38537,38540,38550,38554,38578,38581,38583,38586,38591,38648,
+38650,38796,38798,38800,38803,38828,38830,38912,38916,38921,38923,38925,
+39026,39051,39054,39058,39061,39065,39075,39088,39090,39109,39111,39148,
+39150,39251,39254,39268,39270,39283,39291,39294,39305,39308,39310,39386,
+39388,39390,39392,39468,39471,39531,39538,39555,39561,39577,39590,39609,
+39611,39632,39639,39716,39718,39720,39988,39990,39992,39994,40019,40021,
+40057,40059,40076,40079,40083,40093,40106,40108,40111,40121,40220,40222,
+40385,40387,40476,40484,40487,40494,40496,40500,40512,40525,40528,40534,
+40537,40541,40562,40564,40696,40698,40714,40716,40719,40724,40726,40728,
+40760,40762,40764,11908,13427,13383,11912,11915,40884,13726,13850,13838,
+11916,11927,14702,14616,40885,14799,14815,14963,14800,15182,15470,15584,
+11943,40888,11946,16470,16735,11950,17207,11955,17329,17324,11963,17373,
+17622,18017,17996,40889,18211,18217,18300,18317,11978,18759,18810,18813,
+18847,18843,18871,18870,40890,19575,19618,19886,40891,252,169,8482,
+8230,257,225,462,224,275,233,283,232,299,237,464,
+236,333,243,466,242,363,250,468,249,470,472,474,
+476,252,234,593,7743,324,328,505,609,32,8364,165,
+8364,36,12351,8364,12353,12359,12355,12363,12363,12369,12369,12371,
+12371,12361,12388,12357,12430,12419,12423,12421,12436,12449,12455,12451,
+12467,12467,12457,12483,12453,12526,12515,12519,12517,12535,12537,12536,
+12538,12540,8364,165,8364,36,12351,
+};
+
+static pdf_cmap cmap_Adobe_GB1_UCS2 = {
+	-1, "Adobe-GB1-UCS2", "", 0, 0, 1,
+	{ {2,0,65535}, },
+	4386, 4386, (pdf_range*) cmap_Adobe_GB1_UCS2_ranges,
+	9967, 9967, (unsigned short*) cmap_Adobe_GB1_UCS2_table,
+};
+
+/* GB-EUC-H */
+
+static const pdf_range cmap_GB_EUC_H_ranges[] = {
+{32,0,7716},{33,373,814},{41377,373,96},{41649,197,190},
+{41701,37,240},{41713,45,250},{41889,373,262},{42145,329,356},
+{42401,341,439},{42657,93,525},{42689,209,549},{42913,129,602},
+{42961,129,635},{43169,125,668},{43205,149,700},{43428,301,738},
+{43681,373,814},{43937,125,908},{45217,373,940},{45473,373,1034},
+{45729,373,1128},{45985,373,1222},{46241,373,1316},{46497,373,1410},
+{46753,373,1504},{47009,373,1598},{47265,373,1692},{47521,373,1786},
+{47777,373,1880},{48033,373,1974},{48289,373,2068},{48545,373,2162},
+{48801,373,2256},{49057,373,2350},{49313,373,2444},{49569,373,2538},
+{49825,373,2632},{50081,373,2726},{50337,373,2820},{50593,373,2914},
+{50849,373,3008},{51105,373,3102},{51361,373,3196},{51617,373,3290},
+{51873,373,3384},{52129,373,3478},{52385,373,3572},{52641,373,3666},
+{52897,373,3760},{53153,373,3854},{53409,373,3948},{53665,373,4042},
+{53921,373,4136},{54177,373,4230},{54433,373,4324},{54689,373,4418},
+{54945,373,4512},{55201,353,4606},{55457,373,4695},{55713,373,4789},
+{55969,373,4883},{56225,373,4977},{56481,373,5071},{56737,373,5165},
+{56993,373,5259},{57249,373,5353},{57505,373,5447},{57761,373,5541},
+{58017,373,5635},{58273,373,5729},{58529,373,5823},{58785,373,5917},
+{59041,373,6011},{59297,373,6105},{59553,373,6199},{59809,373,6293},
+{60065,373,6387},{60321,373,6481},{60577,373,6575},{60833,373,6669},
+{61089,373,6763},{61345,373,6857},{61601,373,6951},{61857,373,7045},
+{62113,373,7139},{62369,373,7233},{62625,373,7327},{62881,373,7421},
+{63137,373,7515},{63393,373,7609},
+};
+
+static const unsigned short cmap_GB_EUC_H_table[] = { 0 };
+
+static pdf_cmap cmap_GB_EUC_H = {
+	-1, "GB-EUC-H", "", 0, 0, 2,
+	{ {1,0,128},{2,41377,65278}, },
+	90, 90, (pdf_range*) cmap_GB_EUC_H_ranges,
+	0, 0, (unsigned short*) cmap_GB_EUC_H_table,
+};
+
+/* GB-EUC-V */
+
+static const pdf_range cmap_GB_EUC_V_ranges[] = {
+{41378,6,0},{41386,0,598},{41387,5,7704},{41389,0,599},
+{41394,53,582},{41470,0,7706},{41889,0,578},{41896,5,580},
+{41900,0,573},{41902,0,7707},{41914,5,576},{41917,0,7708},
+{41919,0,579},{41947,0,7709},{41949,0,7710},{41951,0,600},
+{41979,0,596},{41981,6,2},
+};
+
+static const unsigned short cmap_GB_EUC_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GB_EUC_V = {
+	-1, "GB-EUC-V", "GB-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_GB_EUC_V_ranges,
+	4, 4, (unsigned short*) cmap_GB_EUC_V_table,
+};
+
+/* GB-H */
+
+static const pdf_range cmap_GB_H_ranges[] = {
+{8481,373,96},{8753,197,190},{8805,37,240},{8817,45,250},
+{8993,373,262},{9249,329,356},{9505,341,439},{9761,93,525},
+{9793,209,549},{10017,129,602},{10065,129,635},{10273,125,668},
+{10309,149,700},{10532,301,738},{10785,373,814},{11041,125,908},
+{12321,373,940},{12577,373,1034},{12833,373,1128},{13089,373,1222},
+{13345,373,1316},{13601,373,1410},{13857,373,1504},{14113,373,1598},
+{14369,373,1692},{14625,373,1786},{14881,373,1880},{15137,373,1974},
+{15393,373,2068},{15649,373,2162},{15905,373,2256},{16161,373,2350},
+{16417,373,2444},{16673,373,2538},{16929,373,2632},{17185,373,2726},
+{17441,373,2820},{17697,373,2914},{17953,373,3008},{18209,373,3102},
+{18465,373,3196},{18721,373,3290},{18977,373,3384},{19233,373,3478},
+{19489,373,3572},{19745,373,3666},{20001,373,3760},{20257,373,3854},
+{20513,373,3948},{20769,373,4042},{21025,373,4136},{21281,373,4230},
+{21537,373,4324},{21793,373,4418},{22049,373,4512},{22305,353,4606},
+{22561,373,4695},{22817,373,4789},{23073,373,4883},{23329,373,4977},
+{23585,373,5071},{23841,373,5165},{24097,373,5259},{24353,373,5353},
+{24609,373,5447},{24865,373,5541},{25121,373,5635},{25377,373,5729},
+{25633,373,5823},{25889,373,5917},{26145,373,6011},{26401,373,6105},
+{26657,373,6199},{26913,373,6293},{27169,373,6387},{27425,373,6481},
+{27681,373,6575},{27937,373,6669},{28193,373,6763},{28449,373,6857},
+{28705,373,6951},{28961,373,7045},{29217,373,7139},{29473,373,7233},
+{29729,373,7327},{29985,373,7421},{30241,373,7515},{30497,373,7609},
+};
+
+static const unsigned short cmap_GB_H_table[] = { 0 };
+
+static pdf_cmap cmap_GB_H = {
+	-1, "GB-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	88, 88, (pdf_range*) cmap_GB_H_ranges,
+	0, 0, (unsigned short*) cmap_GB_H_table,
+};
+
+/* GB-V */
+
+static const pdf_range cmap_GB_V_ranges[] = {
+{8482,6,0},{8490,0,598},{8491,5,7704},{8493,0,599},
+{8498,53,582},{8574,0,7706},{8993,0,578},{9000,5,580},
+{9004,0,573},{9006,0,7707},{9018,5,576},{9021,0,7708},
+{9023,0,579},{9051,0,7709},{9053,0,7710},{9055,0,600},
+{9083,0,596},{9085,6,2},
+};
+
+static const unsigned short cmap_GB_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GB_V = {
+	-1, "GB-V", "GB-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_GB_V_ranges,
+	4, 4, (unsigned short*) cmap_GB_V_table,
+};
+
+/* GBK-EUC-H */
+
+static const pdf_range cmap_GBK_EUC_H_ranges[] = {
+{32,0,7716},{33,373,814},{33088,225,10072},{33145,0,8281},
+{33146,17,10129},{33152,21,10134},{33158,0,8689},{33159,405,10140},
+{33261,0,8178},{33262,29,10242},{33270,0,8285},{33271,29,10250},
+{33344,73,10258},{33363,0,9884},{33364,53,10277},{33378,0,8629},
+{33379,65,10291},{33396,0,8908},{33397,17,10308},{33402,0,8214},
+{33403,5,10313},{33405,6,0},{33408,0,7968},{33409,5,10316},
+{33411,0,8319},{33412,45,10318},{33424,0,8284},{33425,77,10330},
+{33445,0,8596},{33446,133,10350},{33480,6,2},{33482,89,10384},
+{33505,14,4},{33509,29,10408},{33517,0,9855},{33518,13,10416},
+{33522,0,8750},{33523,13,10420},{33527,18,8},{33532,9,10425},
+{33600,6,13},{33602,9,10429},{33605,0,8916},{33606,5,10432},
+{33608,0,8121},{33609,9,10434},{33612,0,8920},{33613,21,10437},
+{33619,0,8415},{33620,9,10443},{33623,0,8386},{33624,21,10446},
+{33630,0,8597},{33631,21,10452},{33637,6,15},{33639,41,10458},
+{33650,0,8065},{33651,17,10469},{33656,26,17},{33664,0,8080},
+{33665,17,10477},{33670,0,8918},{33671,5,10482},{33673,6,24},
+{33675,5,10484},{33677,0,9857},{33678,21,10486},{33684,0,7798},
+{33685,33,10492},{33694,0,8753},{33695,25,10501},{33702,0,7827},
+{33703,13,10508},{33707,0,8914},{33708,5,10512},{33710,10,26},
+{33713,33,10514},{33722,0,7909},{33723,53,10523},{33737,0,8229},
+{33738,173,10537},{33782,0,7887},{33783,29,10581},{33856,61,10589},
+{33872,0,8153},{33873,125,10605},{33905,0,8904},{33906,5,10637},
+{33908,0,8803},{33909,5,10639},{33911,0,9859},{33912,25,10641},
+{33920,5,10648},{33922,0,7959},{33923,41,10650},{33934,0,7979},
+{33935,9,10661},{33938,6,29},{33940,33,10664},{33949,0,8015},
+{33950,9,10673},{33953,22,31},{33959,5,10677},{33961,0,8053},
+{33962,105,10679},{33989,0,8126},{33990,49,10706},{34003,30,37},
+{34011,5,10722},{34013,0,8498},{34014,45,10724},{34026,0,8995},
+{34027,9,10736},{34030,0,8209},{34031,5,10739},{34033,0,8437},
+{34034,49,10741},{34112,65,10754},{34129,14,45},{34133,33,10772},
+{34142,0,8431},{34143,25,10781},{34150,0,8656},{34151,93,10788},
+{34176,25,10812},{34183,0,8897},{34184,9,10819},{34187,0,7780},
+{34188,21,10822},{34194,0,8697},{34195,9,10828},{34198,10,49},
+{34201,33,10832},{34210,0,7770},{34211,57,10841},{34226,0,7842},
+{34227,301,10856},{34368,37,10932},{34378,0,9069},{34379,33,10942},
+{34388,0,8775},{34389,73,10951},{34408,0,9068},{34409,85,10970},
+{34432,85,10992},{34454,0,8604},{34455,5,11014},{34457,0,8393},
+{34458,25,11016},{34465,0,8688},{34466,157,11023},{34506,18,52},
+{34511,5,11065},{34513,0,8748},{34514,37,11067},{34524,6,57},
+{34526,9,11077},{34529,0,8303},{34530,21,11080},{34536,0,8609},
+{34537,17,11086},{34542,0,9081},{34543,17,11091},{34548,0,9074},
+{34549,37,11096},{34624,0,8554},{34625,9,11106},{34628,0,9084},
+{34629,13,11109},{34633,14,59},{34637,5,11114},{34639,0,9079},
+{34640,25,11116},{34647,0,8012},{34648,5,11123},{34650,26,63},
+{34657,17,11127},{34662,0,9844},{34663,73,11132},{34682,0,9071},
+{34683,5,11151},{34685,6,70},{34688,10,72},{34691,9,11155},
+{34694,18,75},{34699,5,11160},{34701,6,80},{34703,13,11162},
+{34707,0,9070},{34708,13,11166},{34712,0,8631},{34713,13,11170},
+{34717,0,9077},{34718,17,11174},{34723,0,9090},{34724,9,11179},
+{34727,0,8350},{34728,41,11182},{34739,10,82},{34742,17,11194},
+{34747,0,9887},{34748,9,11199},{34751,14,85},{34755,25,11203},
+{34762,10,89},{34765,5,11210},{34767,0,8923},{34768,5,11212},
+{34770,14,92},{34774,13,11215},{34778,0,8865},{34779,109,11219},
+{34807,14,96},{34811,13,11248},{34880,6,100},{34882,5,11252},
+{34884,10,102},{34887,221,11255},{34944,229,11311},{35002,0,9002},
+{35003,65,11369},{35020,0,8843},{35021,25,11386},{35028,0,8069},
+{35029,5,11393},{35031,0,8997},{35032,25,11395},{35039,0,9004},
+{35040,17,11402},{35045,0,9006},{35046,45,11407},{35058,6,105},
+{35060,5,11419},{35062,0,7795},{35063,29,11421},{35136,41,11429},
+{35147,22,107},{35153,9,11442},{35156,0,8575},{35157,29,11445},
+{35165,10,113},{35168,49,11454},{35181,0,7805},{35182,9,11467},
+{35185,0,8406},{35186,37,11470},{35196,0,7874},{35197,5,11480},
+{35200,41,11482},{35211,0,8882},{35212,49,11493},{35225,0,7903},
+{35226,13,11506},{35230,0,7929},{35231,25,11510},{35238,10,116},
+{35241,21,11518},{35247,0,8551},{35248,37,11524},{35258,0,8685},
+{35259,9,11534},{35262,10,119},{35265,9,11537},{35268,18,122},
+{35273,17,11541},{35278,0,7723},{35279,5,11546},{35281,0,8878},
+{35282,21,11548},{35288,0,8009},{35289,5,11554},{35291,0,8504},
+{35292,93,11556},{35316,0,8321},{35317,37,11580},{35392,6,127},
+{35394,89,11591},{35417,22,129},{35423,101,11616},{35449,0,8877},
+{35450,17,11642},{35456,397,11647},{35556,0,8255},{35557,101,11747},
+{35648,13,11773},{35652,0,7950},{35653,13,11777},{35657,0,9209},
+{35658,189,11781},{35706,0,9212},{35707,13,11829},{35712,45,11833},
+{35724,0,8297},{35725,65,11845},{35742,0,9207},{35743,77,11862},
+{35763,0,9206},{35764,17,11882},{35769,0,9213},{35770,13,11887},
+{35774,0,9208},{35775,25,11891},{35782,14,135},{35786,37,11899},
+{35796,0,9217},{35797,25,11909},{35804,0,9215},{35805,29,11916},
+{35813,0,9216},{35814,17,11924},{35819,0,8737},{35820,13,11929},
+{35824,0,8482},{35825,53,11933},{35904,13,11947},{35908,0,9211},
+{35909,37,11951},{35919,0,8538},{35920,25,11961},{35927,0,8677},
+{35928,13,11968},{35932,0,8279},{35933,133,11972},{35968,41,12006},
+{35979,30,139},{35987,21,12019},{35993,6,147},{35995,25,12025},
+{36002,22,149},{36008,93,12033},{36032,0,9052},{36033,65,12057},
+{36050,14,155},{36054,9,12075},{36057,0,8510},{36058,121,12078},
+{36089,0,7958},{36090,17,12109},{36160,201,12114},{36211,10,159},
+{36214,17,12166},{36219,0,8628},{36220,9,12171},{36224,29,12174},
+{36232,0,9103},{36233,21,12182},{36239,0,7962},{36240,53,12188},
+{36254,0,9099},{36255,101,12202},{36281,0,9098},{36282,157,12228},
+{36322,10,162},{36325,5,12269},{36327,0,9096},{36328,57,12271},
+{36343,0,9102},{36344,21,12286},{36350,0,9101},{36416,21,12292},
+{36422,0,9100},{36423,57,12298},{36438,18,165},{36443,49,12315},
+{36456,0,8169},{36457,17,12328},{36462,10,170},{36465,53,12334},
+{36480,0,8996},{36481,101,12348},{36507,0,8515},{36508,9,12374},
+{36511,0,8489},{36512,13,12377},{36516,0,8823},{36517,5,12381},
+{36519,0,7847},{36520,13,12383},{36524,10,173},{36527,53,12388},
+{36541,6,176},{36543,13,12402},{36547,10,178},{36550,25,12407},
+{36557,6,181},{36559,25,12414},{36566,6,183},{36568,77,12421},
+{36588,0,8160},{36589,69,12441},{36672,69,12459},{36690,18,185},
+{36695,21,12477},{36701,0,8261},{36702,21,12483},{36708,0,8568},
+{36709,101,12489},{36736,21,12515},{36742,10,190},{36745,45,12522},
+{36757,10,193},{36760,9,12535},{36763,10,196},{36766,9,12539},
+{36769,0,9852},{36770,105,12542},{36797,0,8133},{36798,21,12569},
+{36804,10,199},{36807,21,12576},{36813,0,7947},{36814,37,12582},
+{36824,0,7804},{36825,149,12592},{36928,249,12630},{36992,113,12693},
+{37021,6,202},{37023,105,12722},{37050,0,7907},{37051,17,12749},
+{37056,6,204},{37058,9,12754},{37061,0,9145},{37062,81,12757},
+{37083,6,206},{37085,61,12778},{37101,0,9141},{37102,5,12794},
+{37104,0,9146},{37105,21,12796},{37111,0,9139},{37112,25,12802},
+{37184,5,12809},{37186,0,8546},{37187,29,12811},{37195,10,208},
+{37198,9,12820},{37201,0,9143},{37202,5,12823},{37204,6,211},
+{37206,9,12825},{37209,6,213},{37211,5,12828},{37213,0,8274},
+{37214,9,12830},{37217,10,215},{37220,37,12834},{37230,0,8754},
+{37231,25,12844},{37238,0,7743},{37239,9,12851},{37242,10,218},
+{37245,5,12854},{37248,13,12856},{37252,0,7854},{37253,29,12860},
+{37261,0,7931},{37262,9,12868},{37265,10,221},{37268,9,12872},
+{37271,0,8644},{37272,9,12875},{37275,0,8724},{37276,49,12878},
+{37289,10,224},{37292,53,12891},{37306,6,227},{37308,9,12905},
+{37311,0,9440},{37312,9,12908},{37315,0,9144},{37316,33,12911},
+{37325,0,7809},{37326,5,12920},{37328,38,229},{37338,17,12925},
+{37343,0,9441},{37344,5,12930},{37346,0,9379},{37347,25,12932},
+{37354,0,9380},{37355,17,12939},{37360,10,239},{37363,45,12945},
+{37440,249,12957},{37504,213,13020},{37558,0,8657},{37559,89,13074},
+{37582,10,242},{37585,9,13098},{37588,0,9858},{37589,37,13101},
+{37599,6,245},{37601,113,13111},{37630,0,8077},{37696,61,13140},
+{37712,0,8703},{37713,45,13156},{37725,0,8024},{37726,69,13168},
+{37744,0,8539},{37745,17,13186},{37750,0,7862},{37751,29,13191},
+{37760,45,13199},{37772,0,8411},{37773,61,13211},{37789,0,9056},
+{37790,25,13227},{37797,10,247},{37800,45,13235},{37812,0,8846},
+{37813,9,13247},{37816,0,8159},{37817,5,13250},{37819,10,250},
+{37822,29,13253},{37830,0,8194},{37831,29,13261},{37839,0,8339},
+{37840,25,13269},{37847,0,9055},{37848,9,13276},{37851,6,253},
+{37853,13,13279},{37857,0,7944},{37858,5,13283},{37860,6,255},
+{37862,9,13285},{37865,34,257},{37874,5,13291},{37876,6,266},
+{37878,13,13293},{37882,0,7849},{37883,9,13297},{37886,0,8140},
+{37952,13,13300},{37956,0,8050},{37957,29,13304},{37965,0,8344},
+{37966,5,13312},{37968,22,268},{37974,5,13315},{37976,0,9061},
+{37977,5,13317},{37979,18,274},{37984,13,13320},{37988,10,279},
+{37991,25,13325},{37998,0,8252},{37999,9,13332},{38002,34,282},
+{38011,13,13339},{38016,10,291},{38019,13,13343},{38023,6,294},
+{38025,93,13347},{38049,0,7726},{38050,65,13371},{38067,10,296},
+{38070,33,13389},{38079,6,299},{38081,41,13398},{38092,0,9428},
+{38093,41,13409},{38104,0,8815},{38105,25,13420},{38112,0,7895},
+{38113,117,13427},{38208,197,13457},{38258,0,8493},{38259,45,13507},
+{38272,9,13519},{38275,0,8859},{38276,101,13522},{38302,6,301},
+{38304,73,13548},{38323,0,7801},{38324,21,13567},{38330,0,8794},
+{38331,77,13573},{38351,22,303},{38357,45,13595},{38369,0,9385},
+{38370,17,13607},{38375,0,8167},{38376,33,13612},{38385,0,8466},
+{38386,21,13621},{38392,0,8508},{38393,17,13627},{38398,0,8028},
+{38464,85,13632},{38486,0,9412},{38487,145,13654},{38524,0,7884},
+{38525,5,13691},{38528,505,13693},{38720,153,13820},{38759,0,9322},
+{38760,13,13859},{38764,10,309},{38767,61,13864},{38784,85,13880},
+{38806,6,312},{38808,17,13902},{38813,0,7886},{38814,17,13907},
+{38819,0,8818},{38820,105,13912},{38847,0,9331},{38848,181,13939},
+{38894,0,8702},{38895,29,13985},{38903,0,7934},{38904,25,13993},
+{38976,17,14000},{38981,0,9333},{38982,9,14005},{38985,0,8714},
+{38986,17,14008},{38991,0,8047},{38992,129,14013},{39025,10,314},
+{39028,41,14047},{39040,6,317},{39042,33,14059},{39051,6,319},
+{39053,73,14068},{39072,0,9340},{39073,33,14087},{39082,0,8097},
+{39083,41,14096},{39094,6,321},{39096,5,14107},{39098,0,9324},
+{39099,45,14109},{39111,0,8254},{39112,9,14121},{39115,0,7756},
+{39116,13,14124},{39120,0,8506},{39121,5,14128},{39123,0,8708},
+{39124,57,14130},{39139,10,323},{39142,33,14145},{39151,0,9332},
+{39152,5,14154},{39154,0,8413},{39155,45,14156},{39232,9,14168},
+{39235,10,326},{39238,125,14172},{39270,0,9330},{39271,25,14204},
+{39278,0,7861},{39279,21,14211},{39285,0,9336},{39286,13,14217},
+{39290,6,329},{39292,9,14221},{39296,17,14224},{39301,0,9881},
+{39302,9,14229},{39305,0,9346},{39306,13,14232},{39310,0,8353},
+{39311,5,14236},{39313,0,8082},{39314,25,14238},{39321,0,7992},
+{39322,57,14245},{39337,0,9349},{39338,21,14260},{39344,22,331},
+{39350,25,14267},{39357,22,337},{39363,21,14276},{39369,0,9327},
+{39370,13,14282},{39374,0,9345},{39375,5,14286},{39377,0,8736},
+{39378,29,14288},{39386,0,8181},{39387,17,14296},{39392,0,8436},
+{39393,13,14301},{39397,0,9341},{39398,5,14305},{39400,0,9337},
+{39401,9,14307},{39404,0,9342},{39405,25,14310},{39412,0,9338},
+{39413,37,14317},{39488,37,14327},{39498,0,8419},{39499,45,14337},
+{39511,0,8365},{39512,49,14349},{39525,10,343},{39528,33,14363},
+{39537,0,8537},{39538,13,14372},{39542,6,346},{39544,25,14376},
+{39552,29,14383},{39560,0,7772},{39561,9,14391},{39564,0,9352},
+{39565,13,14394},{39569,0,9351},{39570,17,14398},{39575,0,9354},
+{39576,5,14403},{39578,6,348},{39580,5,14405},{39582,0,8067},
+{39583,9,14407},{39586,6,350},{39588,21,14410},{39594,0,8367},
+{39595,145,14416},{39632,0,9408},{39633,17,14453},{39638,0,8813},
+{39639,9,14458},{39642,0,9409},{39643,25,14461},{39650,14,352},
+{39654,97,14469},{39744,249,14494},{39808,321,14557},{39889,0,9180},
+{39890,37,14638},{39900,0,9179},{39901,133,14648},{40000,73,14682},
+{40019,0,8286},{40020,17,14701},{40025,14,356},{40029,93,14707},
+{40053,0,8607},{40054,9,14731},{40057,0,7782},{40058,17,14734},
+{40064,21,14739},{40070,0,8035},{40071,85,14745},{40093,0,9181},
+{40094,49,14767},{40107,0,8555},{40108,117,14780},{40138,0,8885},
+{40139,13,14810},{40143,0,7974},{40144,85,14814},{40166,6,360},
+{40168,13,14836},{40172,10,362},{40175,45,14841},{40187,0,8011},
+{40188,5,14853},{40190,0,8850},{40256,5,14855},{40258,0,8484},
+{40259,9,14857},{40262,6,365},{40264,17,14860},{40269,10,367},
+{40272,65,14866},{40289,0,8369},{40290,21,14883},{40296,6,370},
+{40298,13,14889},{40302,0,8888},{40303,5,14893},{40305,0,8822},
+{40306,9,14895},{40309,0,8091},{40310,17,14898},{40315,14,372},
+{40320,37,14905},{40330,0,8382},{40331,5,14915},{40333,0,8116},
+{40334,9,14917},{40337,0,9175},{40338,25,14920},{40345,0,8453},
+{40346,25,14927},{40353,6,376},{40355,13,14934},{40359,0,9194},
+{40360,13,14938},{40364,6,378},{40366,13,14942},{40370,6,380},
+{40372,37,14946},{40382,0,8093},{40383,25,14956},{40390,0,9189},
+{40391,5,14963},{40393,0,8804},{40394,9,14965},{40397,0,9442},
+{40398,13,14968},{40402,0,9182},{40403,5,14972},{40405,0,7876},
+{40406,41,14974},{40417,6,382},{40419,53,14985},{40433,0,8491},
+{40434,5,14999},{40436,0,8357},{40437,5,15001},{40439,0,9867},
+{40440,5,15003},{40442,0,8054},{40443,5,15005},{40445,6,384},
+{40512,17,15008},{40517,0,8193},{40518,5,15013},{40520,6,386},
+{40522,29,15015},{40530,18,388},{40535,21,15025},{40541,6,393},
+{40543,5,15031},{40545,10,395},{40548,9,15034},{40551,0,9183},
+{40552,13,15037},{40556,0,7759},{40557,5,15041},{40559,0,9177},
+{40560,5,15043},{40562,14,398},{40566,17,15046},{40571,6,402},
+{40573,5,15051},{40576,17,15053},{40581,10,404},{40584,33,15059},
+{40593,0,8186},{40594,13,15068},{40598,6,407},{40600,37,15072},
+{40610,0,8454},{40611,9,15082},{40614,0,8203},{40615,5,15085},
+{40617,0,8550},{40618,13,15087},{40622,0,9199},{40623,13,15091},
+{40627,6,409},{40629,5,15095},{40631,0,9191},{40632,241,15097},
+{40693,0,8611},{40694,33,15158},{40768,53,15167},{40782,0,8570},
+{40783,125,15181},{40815,0,8613},{40816,57,15213},{40832,69,15228},
+{40850,0,8226},{40851,17,15246},{40856,0,9430},{40857,49,15251},
+{40870,0,9018},{40871,5,15264},{40873,0,7918},{40874,5,15266},
+{40876,0,9429},{40877,109,15268},{40905,0,8744},{40906,9,15296},
+{40909,0,9431},{40910,73,15299},{40929,0,8444},{40930,33,15318},
+{40939,0,7815},{40940,5,15327},{40942,0,9432},{40943,17,15329},
+{40948,0,7866},{40949,29,15334},{40957,6,411},{41024,9,15343},
+{41027,0,8556},{41028,5,15346},{41030,0,9433},{41031,5,15348},
+{41033,0,8743},{41034,13,15350},{41038,0,7775},{41039,17,15354},
+{41044,0,8863},{41045,17,15359},{41050,0,8029},{41051,21,15364},
+{41057,10,413},{41060,49,15371},{41073,0,8521},{41074,5,15384},
+{41076,0,8262},{41077,37,15386},{41088,0,8192},{41089,61,15396},
+{41105,0,8592},{41106,5,15412},{41108,10,416},{41111,69,15415},
+{41129,0,9411},{41130,81,15433},{41151,0,8396},{41152,53,15454},
+{41166,0,9024},{41167,37,15468},{41177,0,7889},{41178,13,15478},
+{41182,0,8620},{41183,57,15482},{41198,0,8879},{41199,61,15497},
+{41377,373,96},{41633,37,9897},{41649,197,190},{41701,37,240},
+{41713,45,250},{41889,373,262},{42145,329,356},{42401,341,439},
+{42657,93,525},{42689,209,549},{42913,129,602},{42961,129,635},
+{43072,249,9907},{43136,85,9970},{43169,125,668},{43205,149,700},
+{43328,93,9992},{43353,5,10016},{43356,0,10018},{43360,121,10019},
+{43392,85,10050},{43414,0,7703},{43428,301,738},{43584,49,15513},
+{43597,6,419},{43599,133,15526},{43633,10,421},{43636,9,15561},
+{43639,0,9109},{43640,5,15564},{43642,6,424},{43644,9,15566},
+{43648,101,15569},{43674,26,426},{43681,373,814},{43840,0,8036},
+{43841,5,15598},{43843,30,433},{43851,5,15602},{43853,0,9113},
+{43854,193,15604},{43904,129,15653},{43937,125,908},{44096,21,15686},
+{44102,0,8640},{44103,165,15692},{44145,0,9312},{44146,37,15734},
+{44156,0,9308},{44157,5,15744},{44160,49,15746},{44173,0,8541},
+{44174,17,15759},{44179,6,441},{44181,45,15764},{44352,33,15776},
+{44361,0,9313},{44362,77,15785},{44382,0,9307},{44383,5,15805},
+{44385,0,9314},{44386,21,15807},{44392,0,8020},{44393,41,15813},
+{44404,0,9311},{44405,37,15824},{44416,5,15834},{44418,0,8428},
+{44419,13,15836},{44423,0,9309},{44424,9,15840},{44427,0,9315},
+{44428,17,15843},{44433,0,9316},{44434,57,15848},{44608,77,15863},
+{44628,0,9381},{44629,49,15883},{44642,0,7792},{44643,109,15896},
+{44672,0,8335},{44673,13,15924},{44677,0,7746},{44678,17,15928},
+{44683,0,8014},{44684,29,15933},{44692,0,7857},{44693,41,15941},
+{44704,0,7819},{44864,141,15952},{44900,0,8134},{44901,85,15988},
+{44923,0,9646},{44924,9,16010},{44928,5,16013},{44930,6,443},
+{44932,37,16015},{44942,14,445},{44946,37,16026},{44956,0,9651},
+{44957,5,16036},{44959,6,449},{45120,0,16039},{45121,5,9647},
+{45123,6,451},{45125,37,16041},{45135,0,9644},{45136,13,16051},
+{45140,0,7758},{45141,5,16055},{45143,34,453},{45152,5,9652},
+{45154,10,462},{45157,25,16060},{45164,0,7913},{45165,61,16067},
+{45181,6,465},{45184,89,16084},{45207,10,467},{45210,25,16108},
+{45217,373,940},{45376,41,16115},{45387,30,470},{45395,173,16129},
+{45440,89,16173},{45463,0,9860},{45464,33,16196},{45473,373,1034},
+{45632,6,478},{45634,145,16206},{45671,0,9454},{45672,17,16243},
+{45677,0,8308},{45678,21,16248},{45684,0,9863},{45685,37,16254},
+{45696,0,9456},{45697,29,16264},{45705,0,9869},{45706,61,16272},
+{45722,0,8864},{45723,21,16288},{45729,373,1128},{45888,9,16294},
+{45891,0,8107},{45892,173,16297},{45936,0,9896},{45937,53,16341},
+{45952,29,16355},{45960,0,9449},{45961,9,16363},{45964,10,480},
+{45967,69,16367},{45985,373,1222},{46144,77,16385},{46164,0,8520},
+{46165,9,16405},{46168,0,9444},{46169,17,16408},{46174,14,483},
+{46178,73,16414},{46197,0,8871},{46198,29,16433},{46206,0,9452},
+{46208,9,16441},{46211,0,9451},{46212,17,16444},{46217,0,9443},
+{46218,33,16449},{46227,0,9450},{46228,49,16458},{46241,373,1316},
+{46400,6,487},{46402,33,16472},{46411,0,7719},{46412,37,16481},
+{46422,0,8166},{46423,9,16491},{46426,10,489},{46429,13,16494},
+{46433,0,9448},{46434,113,16498},{46464,109,16527},{46492,6,492},
+{46494,9,16555},{46497,373,1410},{46656,69,16558},{46674,0,9890},
+{46675,5,16576},{46677,0,9437},{46678,9,16578},{46681,14,494},
+{46685,133,16582},{46720,129,16616},{46753,373,1504},{46912,53,16649},
+{46926,0,8853},{46927,5,16663},{46929,0,7808},{46930,25,16665},
+{46937,0,9847},{46938,37,16672},{46948,10,498},{46951,61,16682},
+{46967,6,501},{46969,21,16698},{46976,10,503},{46979,117,16705},
+{47009,373,1598},{47168,9,16735},{47171,14,506},{47175,21,16739},
+{47181,0,9657},{47182,9,16745},{47185,0,8170},{47186,29,16748},
+{47194,26,510},{47201,85,16758},{47223,0,8513},{47224,25,16780},
+{47232,5,16787},{47234,0,8135},{47235,117,16789},{47265,373,1692},
+{47424,61,16819},{47440,0,7745},{47441,61,16835},{47457,0,9700},
+{47458,97,16851},{47483,0,8070},{47484,9,16876},{47488,113,16879},
+{47517,0,8115},{47518,5,16908},{47520,0,7919},{47521,373,1786},
+{47680,5,16910},{47682,10,517},{47685,65,16913},{47702,0,9699},
+{47703,5,16930},{47705,0,8465},{47706,21,16932},{47712,0,9702},
+{47713,33,16938},{47722,0,9703},{47723,33,16947},{47732,0,8257},
+{47733,37,16956},{47744,13,16966},{47748,18,520},{47753,13,16972},
+{47757,0,9707},{47758,61,16976},{47774,10,525},{47777,373,1880},
+{47936,0,8183},{47937,29,16993},{47945,0,7821},{47946,53,17001},
+{47960,0,9705},{47961,5,17015},{47963,6,528},{47965,9,17017},
+{47968,0,9875},{47969,13,17020},{47973,22,530},{47979,9,17026},
+{47982,0,9891},{47983,61,17029},{48000,129,17045},{48033,373,1974},
+{48192,69,17078},{48210,6,536},{48212,21,17096},{48218,0,8228},
+{48219,21,17102},{48225,34,538},{48234,9,17112},{48237,34,547},
+{48246,5,9246},{48248,14,556},{48252,5,17119},{48254,0,8359},
+{48256,5,17121},{48258,38,560},{48268,9,17125},{48271,0,7923},
+{48272,37,17128},{48282,14,570},{48286,9,17138},{48289,373,2068},
+{48448,5,17141},{48450,14,574},{48454,5,17144},{48456,30,578},
+{48464,25,17149},{48471,10,586},{48474,45,17157},{48486,6,589},
+{48488,5,17169},{48490,6,591},{48492,9,17171},{48495,10,593},
+{48498,25,17175},{48505,10,596},{48508,5,17182},{48510,0,8148},
+{48512,6,599},{48514,25,17185},{48521,10,601},{48524,5,17193},
+{48526,14,604},{48530,17,17196},{48535,0,8536},{48536,9,17201},
+{48539,0,8130},{48540,17,17204},{48545,373,2162},{48704,9,17209},
+{48707,10,608},{48710,9,17213},{48713,6,611},{48715,21,17216},
+{48721,34,613},{48730,9,17223},{48733,30,622},{48741,13,17227},
+{48745,0,9269},{48746,5,17231},{48748,0,9275},{48749,5,17233},
+{48751,6,630},{48753,17,17235},{48758,14,632},{48762,5,17241},
+{48764,10,636},{48768,9,17243},{48771,26,639},{48778,5,17248},
+{48780,14,646},{48784,5,17251},{48786,0,8326},{48787,5,17253},
+{48789,30,650},{48797,5,17258},{48799,6,658},{48801,373,2256},
+{48960,0,9894},{48961,45,17261},{48973,14,660},{48977,13,17273},
+{48981,6,664},{48983,33,17277},{48992,18,666},{48997,9,17287},
+{49000,0,8642},{49001,9,17290},{49004,0,8558},{49005,9,17293},
+{49008,14,671},{49012,5,17297},{49014,34,675},{49024,5,17301},
+{49026,6,684},{49028,17,17303},{49033,6,686},{49035,37,17308},
+{49045,14,688},{49049,13,17319},{49053,0,9300},{49054,9,17323},
+{49057,373,2350},{49216,0,8443},{49217,9,17326},{49220,0,9280},
+{49221,21,17329},{49227,30,692},{49235,5,17336},{49237,0,8110},
+{49238,17,17338},{49243,0,8730},{49244,5,17343},{49246,10,700},
+{49249,29,17345},{49257,30,703},{49265,9,17356},{49268,22,711},
+{49274,5,17361},{49276,0,8191},{49277,5,17363},{49280,105,17365},
+{49307,10,717},{49310,9,17393},{49313,373,2444},{49472,61,17396},
+{49488,0,7914},{49489,9,17412},{49492,0,7724},{49493,37,17415},
+{49503,14,720},{49507,69,17426},{49525,0,9714},{49526,5,17444},
+{49528,0,8725},{49529,21,17446},{49536,81,17452},{49557,0,8622},
+{49558,41,17473},{49569,373,2538},{49728,53,17484},{49742,0,8416},
+{49743,85,17498},{49765,10,724},{49768,81,17521},{49789,6,727},
+{49792,13,17543},{49796,0,8601},{49797,53,17547},{49811,38,729},
+{49821,9,17563},{49824,0,8569},{49825,373,2632},{49984,0,8248},
+{49985,5,17566},{49987,0,8533},{49988,217,17568},{50043,0,8658},
+{50044,9,17623},{50048,13,17626},{50052,0,9415},{50053,85,17630},
+{50075,0,8825},{50076,17,17652},{50081,373,2726},{50240,33,17657},
+{50249,0,8483},{50250,5,17666},{50252,0,9413},{50253,25,17668},
+{50260,0,9417},{50261,9,17675},{50264,0,8340},{50265,5,17678},
+{50267,0,8854},{50268,25,17680},{50275,0,7799},{50276,73,17687},
+{50295,0,7942},{50296,5,17706},{50298,0,8101},{50299,13,17708},
+{50304,6,739},{50306,57,17713},{50321,10,741},{50324,13,17728},
+{50328,18,744},{50333,13,17734},{50337,373,2820},{50496,13,17738},
+{50500,10,749},{50503,13,17743},{50507,6,752},{50509,17,17747},
+{50514,0,8236},{50515,45,17752},{50527,0,8545},{50528,9,17764},
+{50531,14,754},{50535,93,17767},{50560,73,17791},{50579,0,7777},
+{50580,29,17810},{50588,10,758},{50591,5,17819},{50593,373,2914},
+{50752,6,761},{50754,5,17822},{50756,0,8072},{50757,5,17824},
+{50759,0,8696},{50760,105,17826},{50787,0,8994},{50788,53,17853},
+{50802,0,9014},{50803,45,17867},{50816,129,17879},{50849,373,3008},
+{51008,149,17912},{51046,0,8875},{51047,29,17950},{51055,0,8127},
+{51056,21,17958},{51062,0,8061},{51063,13,17964},{51067,0,9011},
+{51068,9,17968},{51072,129,17971},{51105,373,3102},{51264,6,763},
+{51266,49,18005},{51279,0,9012},{51280,5,18018},{51282,0,8177},
+{51283,73,18020},{51302,0,8587},{51303,25,18039},{51310,0,9033},
+{51311,57,18046},{51326,0,8715},{51328,25,18061},{51335,0,9030},
+{51336,37,18068},{51346,10,765},{51349,13,18079},{51353,0,9889},
+{51354,9,18083},{51357,0,8034},{51358,9,18086},{51361,373,3196},
+{51520,57,18089},{51535,6,768},{51537,113,18104},{51566,10,770},
+{51569,21,18134},{51575,0,7954},{51576,25,18140},{51584,57,18147},
+{51599,6,773},{51601,41,18162},{51612,0,9020},{51613,13,18173},
+{51617,373,3290},{51776,53,18177},{51790,0,9839},{51791,25,18191},
+{51798,0,9041},{51799,5,18198},{51801,0,8096},{51802,5,18200},
+{51804,0,9016},{51805,13,18202},{51809,0,8731},{51810,45,18206},
+{51822,0,9026},{51823,9,18218},{51826,0,9039},{51827,13,18221},
+{51831,0,9021},{51832,9,18225},{51835,14,775},{51840,6,779},
+{51842,25,18230},{51849,0,9040},{51850,13,18237},{51854,6,781},
+{51856,5,18241},{51858,0,8651},{51859,25,18243},{51866,0,9045},
+{51867,21,18250},{51873,373,3384},{52032,9,18256},{52035,18,783},
+{52040,9,18261},{52043,0,9856},{52044,5,18264},{52046,0,8410},
+{52047,29,18266},{52055,0,9034},{52056,17,18274},{52061,10,788},
+{52064,37,18280},{52074,0,9023},{52075,61,18290},{52091,6,791},
+{52093,5,18306},{52096,25,18308},{52103,0,8722},{52104,21,18315},
+{52110,0,8711},{52111,9,18321},{52114,0,9049},{52115,33,18324},
+{52124,10,793},{52127,5,18334},{52129,373,3478},{52288,6,796},
+{52290,25,18336},{52297,10,798},{52300,9,18343},{52303,0,8379},
+{52304,45,18346},{52316,0,9050},{52317,9,18358},{52320,0,9046},
+{52321,9,18361},{52324,0,9015},{52325,29,18364},{52333,0,8185},
+{52334,41,18372},{52345,0,9043},{52346,9,18383},{52349,6,801},
+{52352,53,18387},{52366,0,7829},{52367,17,18401},{52372,10,803},
+{52375,21,18407},{52381,0,8168},{52382,9,18413},{52385,373,3572},
+{52544,249,18416},{52608,61,18479},{52624,0,9690},{52625,25,18495},
+{52632,0,9687},{52633,29,18502},{52641,373,3666},{52800,153,18510},
+{52839,0,8494},{52840,37,18549},{52850,0,8626},{52851,45,18559},
+{52864,6,806},{52866,17,18572},{52871,0,9692},{52872,73,18577},
+{52891,0,8300},{52892,5,18596},{52894,0,8742},{52895,5,18598},
+{52897,373,3760},{53056,53,18600},{53070,0,9696},{53071,21,18614},
+{53077,0,8827},{53078,5,18620},{53080,0,9694},{53081,9,18622},
+{53084,0,9697},{53085,57,18625},{53100,0,9685},{53101,21,18640},
+{53107,10,808},{53110,5,18647},{53112,0,7817},{53113,9,18649},
+{53116,0,9689},{53117,5,18652},{53120,6,811},{53122,25,18655},
+{53129,6,813},{53131,29,18662},{53139,6,815},{53141,33,18670},
+{53150,10,817},{53153,373,3854},{53312,49,18680},{53325,0,7977},
+{53326,9,18693},{53329,0,7771},{53330,9,18696},{53333,0,8310},
+{53334,21,18699},{53340,0,8855},{53341,9,18705},{53344,0,9872},
+{53345,21,18708},{53351,0,8511},{53352,13,18714},{53356,10,820},
+{53359,53,18719},{53373,6,823},{53376,129,18734},{53409,373,3948},
+{53568,81,18767},{53589,0,9713},{53590,9,18788},{53593,0,8204},
+{53594,25,18791},{53601,6,825},{53603,69,18798},{53621,0,9895},
+{53622,25,18816},{53629,6,827},{53632,113,18824},{53661,6,829},
+{53663,5,18853},{53665,373,4042},{53824,0,9662},{53825,5,18855},
+{53827,0,8925},{53828,33,18857},{53837,0,9661},{53838,53,18866},
+{53852,0,7722},{53853,21,18880},{53859,6,831},{53861,9,18886},
+{53864,0,9663},{53865,13,18889},{53869,10,833},{53872,5,18894},
+{53874,0,7807},{53875,5,18896},{53877,0,8621},{53878,33,18898},
+{53888,37,18907},{53898,0,8086},{53899,9,18917},{53902,0,7986},
+{53903,9,18920},{53906,0,8324},{53907,5,18923},{53909,10,836},
+{53912,29,18926},{53920,0,9402},{53921,373,4136},{54080,13,18934},
+{54084,0,9404},{54085,9,18938},{54088,10,839},{54091,5,18942},
+{54093,0,9405},{54094,5,18944},{54096,0,9406},{54097,13,18946},
+{54101,0,9407},{54102,5,18950},{54104,0,8146},{54105,5,18952},
+{54107,14,842},{54111,97,18955},{54136,18,846},{54141,5,18982},
+{54144,17,18984},{54149,10,851},{54152,9,18989},{54155,34,854},
+{54164,5,18996},{54166,22,863},{54172,5,19000},{54174,10,869},
+{54177,373,4230},{54336,6,872},{54338,9,19004},{54341,10,874},
+{54344,13,19008},{54348,0,7922},{54349,5,19012},{54351,0,8479},
+{54352,9,19014},{54355,0,8669},{54356,5,19017},{54358,10,877},
+{54361,9,19020},{54364,0,8834},{54365,17,19023},{54370,0,8934},
+{54371,13,19028},{54375,0,8936},{54376,21,19032},{54382,30,880},
+{54390,5,19041},{54392,0,8938},{54393,5,19043},{54395,0,8893},
+{54396,5,19045},{54398,0,7838},{54400,5,19047},{54402,10,888},
+{54405,5,19049},{54407,0,8503},{54408,5,19051},{54410,50,891},
+{54423,17,19056},{54428,0,8944},{54429,5,19061},{54431,6,904},
+{54433,373,4324},{54592,9,19064},{54595,14,906},{54599,9,19067},
+{54602,0,8446},{54603,9,19070},{54606,5,8953},{54608,6,910},
+{54610,5,19074},{54612,10,912},{54615,9,19077},{54618,42,915},
+{54629,9,19083},{54632,0,8519},{54633,9,19086},{54636,10,926},
+{54639,9,19090},{54642,0,8961},{54643,5,19093},{54645,0,7925},
+{54646,5,19095},{54648,0,8728},{54649,5,19097},{54651,0,7878},
+{54652,5,19099},{54654,0,8960},{54656,6,929},{54658,5,19102},
+{54660,46,931},{54672,9,19109},{54675,6,943},{54677,9,19112},
+{54680,14,945},{54684,9,19116},{54687,6,949},{54689,373,4418},
+{54848,14,951},{54852,9,19121},{54855,14,955},{54859,5,19125},
+{54861,10,959},{54864,5,19128},{54866,62,962},{54882,9,19135},
+{54885,0,8023},{54886,9,19138},{54889,10,978},{54892,9,19142},
+{54895,38,981},{54905,9,19148},{54908,0,8710},{54909,5,19151},
+{54912,9,19153},{54915,0,8973},{54916,5,19156},{54918,10,991},
+{54921,17,19158},{54926,0,8931},{54927,17,19163},{54932,0,8122},
+{54933,13,19168},{54937,0,8312},{54938,25,19172},{54945,373,4512},
+{55104,9,19179},{55107,0,8840},{55108,13,19182},{55112,6,994},
+{55114,21,19186},{55120,26,996},{55127,49,19194},{55140,0,8984},
+{55141,5,19207},{55143,6,1003},{55145,9,19209},{55148,0,8405},
+{55149,5,19212},{55151,0,8010},{55152,17,19214},{55157,0,8768},
+{55158,5,19219},{55160,0,7891},{55161,21,19221},{55168,9,19227},
+{55171,0,7753},{55172,9,19230},{55175,0,9755},{55176,9,19233},
+{55179,18,1005},{55184,17,19237},{55189,10,1010},{55192,33,19243},
+{55201,353,4606},{55360,49,19252},{55373,0,8392},{55374,17,19265},
+{55379,0,7933},{55380,169,19270},{55424,61,19313},{55440,22,1013},
+{55446,13,19330},{55450,26,1019},{55457,373,4695},{55616,114,1026},
+{55645,21,19342},{55651,18,1055},{55656,13,19349},{55660,54,1060},
+{55674,5,19357},{55676,10,1074},{55680,0,7892},{55681,21,19359},
+{55687,0,8179},{55688,17,19365},{55693,18,1077},{55698,17,19370},
+{55703,6,1082},{55705,5,19375},{55707,22,1084},{55713,373,4789},
+{55872,10,1090},{55875,17,19380},{55880,0,8509},{55881,13,19385},
+{55885,6,1093},{55887,141,19389},{55923,0,7956},{55924,9,19425},
+{55927,0,8826},{55928,25,19428},{55936,17,19435},{55941,0,8430},
+{55942,29,19440},{55950,0,9720},{55951,69,19448},{55969,373,4883},
+{56128,125,19466},{56160,0,8084},{56161,89,19498},{56184,0,8752},
+{56185,21,19521},{56192,13,19527},{56196,0,9725},{56197,21,19531},
+{56203,0,9728},{56204,45,19537},{56216,0,9734},{56217,29,19549},
+{56225,373,4977},{56384,17,19557},{56389,0,9727},{56390,33,19562},
+{56399,34,1095},{56408,17,19573},{56413,0,9729},{56414,13,19578},
+{56418,0,9733},{56419,9,19582},{56422,6,1104},{56424,9,19585},
+{56427,0,9735},{56428,61,19588},{56444,0,8432},{56445,5,19604},
+{56448,25,19606},{56455,14,1106},{56459,9,19613},{56462,10,1110},
+{56465,21,19617},{56471,0,9357},{56472,9,19623},{56475,0,8450},
+{56476,13,19626},{56480,0,9364},{56481,373,5071},{56640,21,19630},
+{56646,0,9363},{56647,21,19636},{56653,0,9358},{56654,17,19642},
+{56659,26,1113},{56666,13,19648},{56670,30,1120},{56678,25,19655},
+{56685,14,1128},{56689,17,19663},{56694,10,1132},{56697,5,9373},
+{56699,13,19668},{56704,10,1135},{56707,5,19673},{56709,6,1138},
+{56711,13,19675},{56715,0,8048},{56716,9,19679},{56719,0,9376},
+{56720,13,19682},{56724,0,8507},{56725,5,19686},{56727,0,7943},
+{56728,5,19688},{56730,6,1140},{56732,5,19690},{56734,10,1142},
+{56737,373,5165},{56896,6,1145},{56898,5,19693},{56900,0,8872},
+{56901,9,19695},{56904,6,1147},{56906,17,19698},{56911,0,9378},
+{56912,37,19703},{56922,22,1149},{56928,41,19715},{56939,0,7728},
+{56940,9,19726},{56943,14,1155},{56947,45,19729},{56960,69,19741},
+{56978,0,9851},{56979,45,19759},{56991,6,1159},{56993,373,5259},
+{57152,10,1161},{57155,37,19773},{57165,0,8123},{57166,53,19783},
+{57180,18,1164},{57185,9,19798},{57188,18,1169},{57193,13,19803},
+{57197,0,8499},{57198,21,19807},{57204,0,7812},{57205,5,19813},
+{57207,30,1174},{57216,0,8021},{57217,5,19818},{57219,10,1182},
+{57222,9,19821},{57225,6,1185},{57227,85,19824},{57249,373,5353},
+{57408,61,19846},{57424,0,8990},{57425,45,19862},{57437,0,8755},
+{57438,41,19874},{57449,0,8992},{57450,5,19885},{57452,0,8647},
+{57453,29,19887},{57461,18,1187},{57466,17,19897},{57472,25,19902},
+{57479,0,7867},{57480,17,19909},{57485,30,1192},{57493,5,19917},
+{57495,0,8987},{57496,33,19919},{57505,373,5447},{57664,5,19928},
+{57666,0,8993},{57667,129,19930},{57700,0,8789},{57701,9,19963},
+{57704,0,7823},{57705,41,19966},{57716,6,1200},{57718,33,19977},
+{57728,13,19986},{57732,22,1202},{57738,5,19992},{57740,6,1208},
+{57742,9,9459},{57745,18,1210},{57750,5,19996},{57752,0,8832},
+{57753,17,19998},{57758,10,1215},{57761,373,5541},{57920,14,1218},
+{57924,41,20006},{57935,22,1222},{57941,17,20019},{57946,6,1228},
+{57948,5,20024},{57950,0,9478},{57951,9,20026},{57954,6,1230},
+{57956,9,20029},{57959,18,1232},{57964,5,20033},{57966,6,1237},
+{57968,29,20035},{57976,0,8149},{57977,13,20043},{57981,6,1239},
+{57984,10,1241},{57987,21,20048},{57993,10,1244},{57996,5,20055},
+{57998,6,1247},{58000,5,20057},{58002,14,1249},{58006,5,20059},
+{58008,14,1253},{58012,13,20061},{58016,0,9473},{58017,373,5635},
+{58176,5,20065},{58178,6,1257},{58180,9,20067},{58183,0,9496},
+{58184,9,20070},{58187,0,7766},{58188,9,20073},{58191,10,1259},
+{58194,5,20077},{58196,6,1262},{58198,5,20079},{58200,0,9488},
+{58201,9,20081},{58204,0,7765},{58205,9,20084},{58208,0,9482},
+{58209,17,20087},{58214,5,9489},{58216,33,20092},{58225,14,1264},
+{58229,9,20102},{58232,6,1268},{58234,5,20105},{58236,10,1270},
+{58240,37,20108},{58250,10,1273},{58253,5,20119},{58255,26,1276},
+{58262,9,20124},{58265,0,9501},{58266,5,20127},{58268,18,1283},
+{58273,373,5729},{58432,18,1288},{58437,9,20131},{58440,0,9509},
+{58441,17,20134},{58446,22,1293},{58452,13,20141},{58456,26,1299},
+{58463,9,20148},{58466,0,9513},{58467,5,20151},{58469,0,9505},
+{58470,5,20153},{58472,0,7935},{58473,37,20155},{58483,10,1306},
+{58486,9,20166},{58489,22,1309},{58496,6,1315},{58498,5,20171},
+{58500,18,1317},{58505,13,20173},{58509,10,1322},{58512,9,20178},
+{58515,0,7960},{58516,13,20181},{58520,0,9547},{58521,13,20185},
+{58525,0,9543},{58526,5,9551},{58528,0,20189},{58529,373,5823},
+{58688,21,20190},{58694,10,1325},{58697,5,20197},{58699,0,9548},
+{58700,5,20199},{58702,14,1328},{58706,9,20201},{58709,14,1332},
+{58713,9,20205},{58716,10,1336},{58719,5,20209},{58721,0,8619},
+{58722,5,20211},{58724,6,1339},{58726,5,20213},{58728,6,1341},
+{58730,5,20215},{58732,10,1343},{58735,21,20218},{58741,14,1346},
+{58745,5,20225},{58747,6,1350},{58749,5,20227},{58752,14,1352},
+{58756,21,20231},{58762,0,9558},{58763,9,20237},{58766,0,8808},
+{58767,5,20240},{58769,0,7894},{58770,29,20242},{58778,6,1356},
+{58780,9,20250},{58783,6,1358},{58785,373,5917},{58944,0,8412},
+{58945,9,20254},{58948,0,9561},{58949,13,20257},{58953,6,1360},
+{58955,9,20261},{58958,0,8829},{58959,9,20264},{58962,0,9598},
+{58963,9,20267},{58966,10,1362},{58969,5,20271},{58971,0,9566},
+{58972,5,20273},{58974,0,7732},{58975,37,20275},{58985,10,1365},
+{58988,33,20286},{58997,6,1368},{58999,5,20295},{59001,22,1370},
+{59008,18,1376},{59013,5,20301},{59015,10,1381},{59018,5,20304},
+{59020,0,9569},{59021,21,20306},{59027,0,9570},{59028,9,20312},
+{59031,0,9580},{59032,9,20315},{59035,6,1384},{59037,5,20318},
+{59039,6,1386},{59041,373,6011},{59200,9,20320},{59203,0,9582},
+{59204,13,20323},{59208,6,1388},{59210,9,20327},{59213,5,9576},
+{59215,26,1390},{59222,9,20332},{59225,0,9757},{59226,45,20335},
+{59238,18,1397},{59243,33,20349},{59252,0,9506},{59253,25,20358},
+{59260,0,9523},{59261,5,20365},{59264,5,20367},{59266,18,1402},
+{59271,9,20370},{59274,6,1407},{59276,9,20373},{59279,0,9584},
+{59280,5,20376},{59282,0,9589},{59283,17,20378},{59288,5,9537},
+{59290,0,9565},{59291,17,20383},{59296,0,8218},{59297,373,6105},
+{59456,9,20388},{59459,14,1409},{59463,5,20392},{59465,10,1413},
+{59468,9,20395},{59471,0,9595},{59472,13,20398},{59476,0,8867},
+{59477,17,20402},{59482,10,1416},{59485,17,20408},{59490,10,1419},
+{59493,41,20414},{59504,0,9492},{59505,5,20425},{59507,10,1422},
+{59510,21,20428},{59516,0,9588},{59517,5,20434},{59520,10,1425},
+{59523,13,20437},{59527,10,1428},{59530,5,20442},{59532,14,1431},
+{59536,65,20444},{59553,373,6199},{59712,45,20461},{59724,0,7797},
+{59725,25,20473},{59732,14,1435},{59736,5,20481},{59738,0,9152},
+{59739,5,20483},{59741,46,1439},{59753,9,20489},{59756,0,8809},
+{59757,29,20492},{59765,18,1451},{59770,5,20501},{59772,10,1456},
+{59776,10,1459},{59779,13,20504},{59783,0,8783},{59784,9,20508},
+{59787,0,9163},{59788,5,20511},{59790,26,1462},{59797,9,20514},
+{59800,0,9168},{59801,5,20517},{59803,22,1469},{59809,373,6293},
+{59968,0,8184},{59969,9,20521},{59972,0,9171},{59973,9,20524},
+{59976,10,1475},{59979,17,20527},{59984,10,1478},{59987,5,20533},
+{59989,6,1481},{59991,5,20535},{59993,0,9157},{59994,145,20537},
+{60032,0,8986},{60033,9,20574},{60036,0,8468},{60037,5,20577},
+{60039,0,8836},{60040,21,20579},{60046,14,1483},{60050,13,20586},
+{60054,0,8705},{60055,33,20590},{60064,0,7897},{60065,373,6387},
+{60224,6,1487},{60226,9,20600},{60229,0,8786},{60230,5,20603},
+{60232,0,8057},{60233,37,20605},{60243,10,1489},{60246,17,20616},
+{60251,10,1492},{60254,5,20622},{60256,10,1495},{60259,37,20625},
+{60269,0,8534},{60270,5,20635},{60272,14,1498},{60276,13,20638},
+{60280,6,1502},{60282,17,20642},{60288,17,20647},{60293,0,8784},
+{60294,13,20652},{60298,0,7875},{60299,85,20656},{60321,373,6481},
+{60480,21,20678},{60486,0,8616},{60487,57,20684},{60502,0,9741},
+{60503,9,20699},{60506,10,1504},{60509,9,20703},{60512,0,8242},
+{60513,49,20706},{60526,0,9739},{60527,25,20719},{60534,0,8899},
+{60535,29,20726},{60544,85,20734},{60566,0,7971},{60567,37,20756},
+{60577,373,6575},{60736,21,20766},{60742,0,9877},{60743,65,20772},
+{60760,0,9822},{60761,17,20789},{60766,0,9821},{60767,5,20794},
+{60769,0,9874},{60770,5,20796},{60772,14,1507},{60776,21,20799},
+{60782,0,8000},{60783,17,20805},{60788,0,9317},{60789,5,20810},
+{60791,10,1511},{60794,17,20813},{60800,65,20818},{60817,62,1514},
+{60833,373,6669},{60992,18,1530},{60997,9,20840},{61000,6,1535},
+{61002,9,20843},{61005,0,9673},{61006,13,20846},{61010,0,9672},
+{61011,5,20850},{61013,10,1537},{61016,21,20853},{61022,0,8573},
+{61023,5,20859},{61025,0,8062},{61026,21,20861},{61032,6,1540},
+{61034,5,20867},{61036,10,1542},{61039,29,20870},{61047,0,8154},
+{61048,17,20878},{61053,6,1545},{61056,0,9677},{61057,13,20883},
+{61061,6,1547},{61063,9,20887},{61066,14,1549},{61070,5,20891},
+{61072,0,8200},{61073,9,20893},{61076,0,9680},{61077,5,20896},
+{61079,10,1553},{61082,9,20899},{61085,6,1556},{61087,5,20902},
+{61089,373,6763},{61248,22,1558},{61254,21,20905},{61260,0,7936},
+{61261,17,20911},{61266,5,9420},{61268,14,1564},{61272,5,20918},
+{61274,0,9422},{61275,17,20920},{61280,0,9423},{61281,25,20925},
+{61288,18,1568},{61293,37,20934},{61303,0,7924},{61304,5,20944},
+{61306,10,1573},{61309,5,20947},{61312,5,20949},{61314,0,9117},
+{61315,5,9119},{61317,14,1576},{61321,5,20953},{61323,10,1580},
+{61326,25,20956},{61333,10,1583},{61336,13,20963},{61340,10,1586},
+{61343,5,20968},{61345,373,6857},{61504,18,1589},{61509,5,20972},
+{61511,10,1594},{61514,13,20974},{61518,0,8760},{61519,5,20978},
+{61521,0,9125},{61522,5,20980},{61524,0,8090},{61525,5,20982},
+{61527,0,8643},{61528,21,20984},{61534,0,7982},{61535,33,20990},
+{61544,0,9116},{61545,9,20999},{61548,0,9126},{61549,13,21002},
+{61553,14,1597},{61557,9,21007},{61560,10,1601},{61563,5,21011},
+{61565,5,9129},{61568,10,1604},{61571,13,21013},{61575,6,1607},
+{61577,5,21017},{61579,0,9830},{61580,13,21019},{61584,10,1609},
+{61587,9,21024},{61590,0,9133},{61591,37,21027},{61601,373,6951},
+{61760,69,21037},{61778,10,1612},{61781,5,21055},{61783,14,1615},
+{61787,45,21058},{61799,0,7767},{61800,53,21070},{61814,22,1619},
+{61820,5,21085},{61822,0,9224},{61824,38,1625},{61834,37,21091},
+{61844,0,7999},{61845,9,21101},{61848,0,8295},{61849,29,21104},
+{61857,373,7045},{62016,17,21112},{62021,10,1635},{62024,9,21118},
+{62027,0,9231},{62028,25,21121},{62035,10,1638},{62038,21,21128},
+{62044,0,9234},{62045,5,21134},{62047,0,8375},{62048,65,21136},
+{62065,22,1641},{62071,17,21155},{62076,10,1647},{62080,17,21160},
+{62085,18,1650},{62090,5,9238},{62092,0,8433},{62093,13,21166},
+{62097,0,9226},{62098,5,21170},{62100,10,1655},{62103,17,21173},
+{62108,10,1658},{62111,5,21179},{62113,373,7139},{62272,6,1661},
+{62274,9,21181},{62277,0,8860},{62278,5,21184},{62280,14,1663},
+{62284,13,21187},{62288,0,9228},{62289,61,21191},{62305,0,7721},
+{62306,69,21207},{62324,22,1667},{62330,17,21226},{62336,45,21231},
+{62348,0,9845},{62349,73,21243},{62368,0,8524},{62369,373,7233},
+{62528,17,21262},{62533,0,9850},{62534,37,21267},{62544,0,9888},
+{62545,21,21277},{62551,26,1673},{62558,13,21286},{62562,10,1680},
+{62565,61,21291},{62581,0,9829},{62582,21,21307},{62588,10,1683},
+{62592,77,21314},{62612,0,8266},{62613,13,21334},{62617,0,9759},
+{62618,5,21338},{62620,0,9758},{62621,13,21340},{62625,373,7327},
+{62784,17,21344},{62789,10,1686},{62792,37,21350},{62802,18,1689},
+{62807,25,21361},{62814,0,9769},{62815,5,21368},{62817,6,1694},
+{62819,41,21370},{62830,18,1696},{62835,45,21382},{62848,17,21394},
+{62853,6,1701},{62855,17,21399},{62860,14,1703},{62864,33,21405},
+{62873,10,1707},{62876,13,21415},{62880,0,9795},{62881,373,7421},
+{63040,6,1710},{63042,9,21420},{63045,14,1712},{63049,5,21424},
+{63051,10,1716},{63054,5,9787},{63056,13,21427},{63060,0,9794},
+{63061,9,21431},{63064,0,9796},{63065,29,21434},{63073,10,1719},
+{63076,29,21443},{63084,6,1722},{63086,9,21451},{63089,0,9801},
+{63090,5,21454},{63092,14,1724},{63096,25,21457},{63104,17,21464},
+{63109,0,9805},{63110,5,21469},{63112,10,1728},{63115,5,21472},
+{63117,6,1731},{63119,9,21474},{63122,0,9807},{63123,9,21477},
+{63126,42,1733},{63137,373,7515},{63296,5,21484},{63298,0,9812},
+{63299,21,21486},{63305,0,9816},{63306,5,21492},{63308,6,1744},
+{63310,29,21494},{63318,26,1746},{63325,13,21504},{63329,10,1753},
+{63332,25,21509},{63339,0,9820},{63340,17,21516},{63345,0,9772},
+{63346,37,21521},{63356,10,1756},{63360,129,21532},{63393,373,7609},
+{63552,5,21565},{63554,0,8348},{63555,9,21567},{63558,0,9600},
+{63559,5,21570},{63561,0,8924},{63562,21,21572},{63568,14,1759},
+{63572,57,21579},{63587,14,1763},{63591,41,21595},{63602,0,8578},
+{63603,17,21606},{63608,18,1767},{63613,5,21613},{63616,6,1772},
+{63618,5,21616},{63620,10,1774},{63623,21,21619},{63629,6,1777},
+{63631,37,21625},{63641,0,8007},{63642,9,21635},{63645,0,7965},
+{63646,5,21638},{63648,0,9613},{63808,53,21640},{63822,10,1779},
+{63825,29,21654},{63833,6,1782},{63835,5,21662},{63837,6,1784},
+{63839,29,21664},{63847,10,1786},{63850,5,21673},{63852,0,9624},
+{63853,5,21675},{63855,0,8438},{63856,57,21677},{63872,17,21692},
+{63877,10,1789},{63880,33,21698},{63889,0,9622},{63890,13,21707},
+{63894,10,1792},{63897,29,21712},{64064,5,21720},{64066,0,9629},
+{64067,9,21722},{64070,0,9630},{64071,17,21725},{64076,0,9036},
+{64077,13,21730},{64081,0,8004},{64082,21,21734},{64088,6,1795},
+{64090,9,21740},{64093,18,1797},{64098,53,21745},{64112,0,9634},
+{64113,9,21759},{64116,14,1802},{64120,25,21763},{64128,9,21770},
+{64131,6,1806},{64133,29,21773},{64141,0,9636},{64142,5,21781},
+{64144,6,1808},{64146,13,21783},{64150,10,1810},{64153,29,21787},
+{64320,33,21795},{64329,0,9640},{64330,29,21804},{64338,0,9606},
+{64339,13,21812},{64343,18,1813},{64348,97,21817},{64373,0,9864},
+{64374,9,21842},{64377,22,1818},{64384,61,21847},{64400,0,8207},
+{64401,41,21863},{64412,0,8305},{64413,5,21874},{64415,6,1824},
+{64576,13,21877},{64580,0,9878},{64581,13,21881},{64585,0,9871},
+{64586,61,21885},{64602,0,8922},{64603,29,21901},{64611,0,7873},
+{64612,13,21909},{64616,0,7859},{64617,21,21913},{64623,10,1826},
+{64626,5,21920},{64628,0,9833},{64629,5,21922},{64631,5,9752},
+{64633,21,21924},{64640,9,21930},{64643,0,9754},{64644,21,21933},
+{64650,0,9843},{64651,85,21939},{64832,69,21961},{64850,6,1829},
+{64852,9,21979},{64855,14,1831},{64859,13,21983},{64863,0,9745},
+{64864,5,21987},{64866,0,9747},{64867,5,21989},{64869,18,1835},
+{64874,5,21992},{64876,0,9748},{64877,9,21994},{64880,10,1840},
+{64883,17,21998},{64888,0,8434},{64889,13,22003},{64893,6,1843},
+{64896,29,22008},{64904,0,8247},{64905,5,22016},{64907,0,8371},
+{64908,9,22018},{64911,6,1845},{64913,9,22021},{64916,0,7988},
+{64917,29,22024},{64925,14,1847},{65088,0,4697},{65089,245,22032},
+{65152,129,22094},
+};
+
+static const unsigned short cmap_GBK_EUC_H_table[1851] = {
+7778,10315,7781,8833,8909,10407,8458,7742,7830,8907,8812,10424,
+8471,10428,8424,8108,8915,8720,10474,8911,10475,8723,10476,8164,
+8912,8910,8919,8917,8913,8906,7833,8143,8246,7994,10676,8905,
+8089,7885,10719,8617,10720,8678,10721,8487,8195,8901,8030,10771,
+8902,8208,10831,8898,8459,11063,8414,11064,7850,8408,8896,8368,
+11113,9082,7796,9080,8655,9064,11125,9073,11126,9065,9072,11153,
+11154,9078,9075,9087,11158,9076,11159,8373,7899,9842,9067,11193,
+8249,9085,8693,11202,9089,9083,9086,8652,9066,9865,11214,9879,
+9091,7997,11247,8591,8774,8776,8574,11254,8576,8709,7736,8163,
+9017,11440,9003,11441,9005,8615,11453,9007,8409,11517,8157,8199,
+8998,9001,8018,8251,9000,11540,8999,11590,8060,9051,7902,11614,
+8098,11615,7930,9210,11898,9214,8104,8421,12017,8495,8355,8481,
+12018,8660,8165,7818,7735,8094,8870,8680,12032,7898,7865,8272,
+7783,12074,9204,9097,12165,7863,9105,12268,8817,9104,12313,8243,
+12314,8764,8277,12333,9106,8837,12387,9092,9095,9094,8848,12406,
+7748,7730,9093,7955,8051,8327,7800,9134,7926,7985,9205,12521,
+8821,9838,12534,7856,8323,12538,8584,7841,12575,9107,9140,8318,
+8341,9147,7720,9149,7774,12819,7773,7983,9439,9138,8526,9148,
+12833,8427,8219,8380,9150,8329,12871,9137,8158,8739,9142,9868,
+9438,8190,8017,8673,12922,9136,12923,8142,12924,8478,8225,8819,
+12944,8624,8476,13097,9053,8461,8282,9057,13234,8256,9054,13252,
+7786,7852,7764,8384,9058,8544,13288,8605,8078,8749,13289,8263,
+13290,8802,8039,7858,7762,8356,7964,8847,13314,8173,7725,8530,
+9062,13319,8442,9059,13324,8346,8182,13335,9060,13336,7785,13337,
+9063,13338,8477,8793,8278,8547,8105,8188,7868,13388,8514,8222,
+7747,8790,9384,9383,13593,9862,9382,13594,8654,8565,13863,9325,
+9323,8799,9320,14046,8448,14058,9334,7975,8407,8874,8197,8387,
+8512,9335,8040,14171,8581,8075,9348,9344,9326,14266,9339,9350,
+9329,9347,9328,14274,9321,14275,9343,9419,14362,8019,8211,7987,
+9353,9355,8463,8155,8394,14468,8423,9410,8772,9186,14706,8404,
+7779,8328,7869,14840,9025,8264,9184,8311,14865,8762,8001,8220,
+8095,14903,9674,14904,9185,8172,9187,8462,8102,8196,8886,8361,
+8557,15007,8593,7760,8092,15023,9178,15024,8275,9193,9188,8661,
+15033,9190,8212,15045,9196,9195,9176,9198,9870,15058,9197,9174,
+9192,8585,8280,8473,15342,8124,15370,9434,8712,15414,7910,8630,
+7741,8757,15560,9111,8767,8490,7890,15595,9110,9112,15596,8354,
+15597,8235,15600,9108,8505,15601,8543,8641,9114,8741,8298,7937,
+8704,9650,7831,16025,8363,8232,16038,16040,9649,8706,9643,8838,
+16057,9645,16058,9654,16059,8675,8751,8549,9655,7717,16083,9664,
+16107,8858,8814,16126,8125,16127,8068,8370,16128,8259,16205,9455,
+9445,16366,8698,9446,8439,16413,8299,16471,7826,9447,8210,7916,
+8038,9436,8206,16581,9435,7864,9764,8041,8747,9599,8027,8603,
+16704,9853,8608,8582,16738,8429,7844,8417,16756,9656,8800,16757,
+8418,8868,16912,9704,9706,16970,8079,16971,9708,8400,8221,16992,
+9710,8250,9701,9709,17024,8201,17025,8293,9717,7932,9883,17108,
+9715,17109,8921,17110,9716,17111,9243,8136,17115,8059,17116,9245,
+17117,8780,8008,9244,8447,8602,17118,8337,9251,7835,9250,17123,
+8464,17124,8845,8049,7928,9249,8625,9254,9253,8480,8474,9252,
+17143,9256,9258,9257,17146,8852,17147,8894,17148,7729,9260,17156,
+8117,9259,8111,8296,8676,7969,17174,8449,8572,8522,9261,17184,
+8145,7731,17192,9263,9262,17195,9264,8667,8889,17212,9270,7822,
+9273,8645,9271,8594,17222,9274,7961,8588,7744,8883,8287,9272,
+9266,8820,17226,7836,9265,8325,8119,9267,8276,8670,17240,9268,
+9277,8073,9276,8046,7896,17246,7871,9285,17247,8777,9281,17250,
+7751,8022,8598,17255,9283,9279,17256,8227,17257,9282,9278,17260,
+9038,9286,9291,9284,9255,9292,7951,17286,9287,9289,9288,7939,
+17296,9290,8540,8891,9296,17299,9876,9295,9718,8273,17300,9294,
+8890,8045,9298,9297,9301,17318,8841,8470,8486,8033,9885,17335,
+8074,9302,9305,9304,8058,9293,9303,9299,17353,9248,17354,8671,
+9861,17355,7790,8740,9840,17359,8634,17360,9306,9698,17392,9882,
+8290,9457,17425,9458,9666,17520,9665,8488,17542,8215,7840,8485,
+8525,17561,9668,8349,8842,17562,9667,17712,8345,7853,9416,8360,
+8223,17732,8389,17733,9418,8176,17742,9414,8797,8926,8763,8665,
+8139,8137,9711,17818,8088,17821,9712,18004,8013,9031,18078,8595,
+9037,9032,7776,18133,9029,8216,9013,9028,9009,18228,9035,18229,
+9019,7860,8614,9022,18259,8052,18260,9008,8081,18279,8455,8180,
+9027,8788,18333,9010,7718,9047,9048,8258,8531,8289,18386,8265,
+18406,8002,18571,8606,7787,18646,9691,18654,8721,8745,9686,9693,
+9695,8175,18679,9688,8600,18718,7816,8844,18733,7768,8876,9846,
+18823,8161,9659,9660,9658,8583,18893,9835,8502,18925,9400,8420,
+18941,9401,8189,18954,9403,7981,9737,18980,9738,18981,7828,8927,
+7883,7949,8055,18992,8683,18993,8929,18994,8559,18995,8928,8682,
+18998,8930,8395,18999,8056,7906,19002,8690,19003,8528,8147,19007,
+8933,8532,19019,8935,8932,19038,8810,19039,8939,19040,8937,8381,
+8950,8679,8726,8492,19053,7784,8946,7991,8947,19054,8943,8016,
+7952,8648,19055,8945,8942,19063,8941,8862,8940,8162,19073,7855,
+8758,19076,8951,8765,19080,7810,8118,19081,8612,8618,8952,8529,
+19082,8032,8517,19089,8156,19101,8884,8553,19104,8957,19105,8426,
+19106,8948,19107,8955,19108,8956,8231,8288,8959,8958,7879,19115,
+8972,8949,19119,8966,19120,8970,8659,8963,19124,8967,8971,8031,
+19127,8969,8962,7940,8861,19130,8699,19131,8968,19132,8364,19133,
+8334,8965,8599,19134,8561,8856,8322,19141,8977,8964,19145,8975,
+7733,19146,8401,8976,8099,19147,8662,8978,8333,8979,8982,8043,
+8980,19192,8496,8981,8552,19193,8388,8729,8727,7789,8440,19236,
+8187,8985,8974,19242,8983,7739,8831,19329,7948,7769,7972,8378,
+8037,7920,8548,7984,8801,19334,19335,8866,9387,19336,9391,7912,
+7993,19337,7752,8304,7848,19338,9388,7927,8566,9389,19339,8315,
+8005,9386,8267,8239,8026,9392,19340,8887,8063,19341,8805,9394,
+8475,7761,19348,9396,9395,19353,7839,19354,8472,19355,8372,9135,
+8635,8306,8085,19356,7946,9398,8849,9397,8824,8873,9399,7976,
+8457,8903,9390,8881,8806,19377,8795,8900,19378,8469,19379,8746,
+9393,7957,8796,9724,7820,9730,19571,8781,19572,9732,9726,9731,
+7843,9736,7803,8807,7990,8150,8672,19616,9356,8857,9361,9366,
+9359,9362,19647,9367,8113,19652,9370,19653,9369,19654,8792,9368,
+9371,19662,7945,8422,8230,9375,8025,19672,7995,9372,7738,8283,
+8816,8759,9426,19692,8627,8773,9377,8828,8112,8006,19713,9088,
+9365,19714,9360,7837,7755,7754,8362,9202,19771,8830,19772,8217,
+8787,19797,7998,7846,8590,8684,19801,7870,19802,8778,8399,8674,
+19815,8719,19816,8233,19817,8307,9201,19820,7750,8291,9203,8892,
+19895,8988,19896,8785,8839,19914,8237,7851,19915,8989,19916,8991,
+8716,8100,8347,8664,19990,9722,19991,9721,8500,19994,9464,19995,
+9463,7880,9462,7877,9467,20003,20004,9466,20005,7917,9469,20017,
+9465,20018,9470,8397,9480,9476,9471,8336,7901,7973,20032,9475,
+9474,7802,8358,7953,20047,9479,9472,9477,9497,20054,9493,9484,
+8241,9483,9487,9498,9481,9486,8756,9491,8064,9495,9494,9485,
+20076,8403,8314,8398,8106,20101,9502,7967,9517,8733,9522,20107,
+8571,8623,20118,9516,9512,20121,8332,20122,9519,20123,8636,9525,
+20129,8717,9510,20130,9524,9514,9503,9521,9500,8653,20139,8666,
+20140,8562,9534,8271,20145,9539,20146,8663,20147,7740,9535,20165,
+9540,9507,7824,9530,9541,20169,9533,20170,8385,8451,9504,9532,
+9531,9528,9536,20177,8141,8880,20196,9542,7834,9554,9520,9545,
+9553,7882,20204,8402,8120,20208,8313,9549,7845,8268,8320,9837,
+20217,9527,9546,8632,20224,9550,9468,9556,20229,7996,20230,7893,
+9559,9555,9544,20253,8087,9557,8316,20270,9562,8542,20285,9568,
+8610,9044,9571,9511,20297,9518,9560,20298,7963,20299,8835,20300,
+9572,8352,20303,9573,9581,8224,9567,9578,9529,9564,9579,7791,
+20330,8132,9575,20331,9563,9515,20347,9585,20348,9591,8234,20369,
+9526,9587,9583,8851,9592,9594,8198,20391,8567,9499,20394,9508,
+9593,20407,9574,8083,20413,9596,9597,20427,9586,8782,20436,8646,
+8351,20441,9590,8292,8895,9756,8798,8317,20480,9151,8467,7749,
+20485,8152,9156,20486,9154,8452,20487,8637,20488,8071,9155,8003,
+20500,7966,9849,7915,7989,8330,20503,9159,9161,9158,8691,20513,
+8695,9167,9166,9162,9165,9836,20519,9153,20520,8174,9169,9170,
+9172,7832,7980,20532,9173,7793,9873,8732,20585,7806,8269,20599,
+8114,8535,20615,8639,8735,20621,8253,8213,20624,9893,8516,20637,
+7825,8791,8202,8338,9740,20702,9742,9823,20798,8589,8445,9319,
+20812,9318,8649,20835,8713,7881,8425,20836,8650,8518,9669,8668,
+20837,9310,20838,8527,20839,9670,9671,8769,8586,7727,7900,8383,
+8244,8718,20852,9675,9676,8131,8377,20869,8577,8563,7905,9678,
+8694,8779,9681,20890,7872,9682,20898,7978,7794,9683,8638,9684,
+8260,20904,9679,8435,20916,9880,20917,9848,8376,20932,9424,20933,
+9425,9115,20946,9854,20951,9121,20952,7921,8734,20955,9122,8523,
+7734,8501,8109,20967,7763,20970,9123,8707,20971,7911,9124,8343,
+7908,9118,21006,8245,9127,9128,21010,8309,9131,8171,9132,8042,
+8441,9831,21023,7788,8301,8770,7938,8579,21057,7813,8681,8869,
+9223,8138,21084,9218,8066,9220,21087,8497,21088,8580,21089,9219,
+21090,8302,9227,8151,21117,7811,9230,8391,9229,9200,21153,9233,
+9236,21154,8560,9221,8460,9237,8294,21165,9042,9235,9232,9225,
+21172,9240,8103,21178,8700,8129,9222,8270,21186,9242,9241,9825,
+21225,9892,8564,9827,9826,9832,21283,7888,21284,8342,21285,9164,
+9160,21290,8766,9828,21313,8761,9760,21349,9761,9762,21360,9767,
+7737,9765,9774,9771,9770,9773,21381,9768,8633,9782,9776,9784,
+21404,8205,9783,9797,21414,9786,21419,9792,9789,9793,21423,9790,
+9791,8128,21426,9785,21442,9804,9799,9803,9800,21456,9802,8456,
+9780,21471,9809,9808,9810,9778,9806,9811,21480,9815,21481,9781,
+21482,9779,21483,9814,9813,7757,9819,21502,9818,21503,9817,8238,
+9775,9798,21508,9766,9763,21531,9777,7941,8331,21578,9601,9603,
+9602,21594,8686,8771,21611,9607,21612,9608,21615,9604,8701,21618,
+8687,9610,9612,8144,9618,9615,9620,7904,9617,9621,9623,21672,
+8374,9605,21697,9625,9626,21711,9627,9824,9632,9628,21743,9631,
+21744,8044,8366,21762,9611,9635,9609,9637,9638,9619,9639,8738,
+9641,9633,9642,21816,9616,9614,9886,9723,21845,8076,8692,21846,
+9719,21876,9834,21919,9866,8390,8811,9427,7814,21982,9743,9744,
+9746,8240,21991,9841,9750,21997,9749,9751,22007,7970,9453,2562,
+16595,8204,20611,
+};
+
+static pdf_cmap cmap_GBK_EUC_H = {
+	-1, "GBK-EUC-H", "", 0, 0, 2,
+	{ {1,0,128},{2,33088,65278}, },
+	2713, 2713, (pdf_range*) cmap_GBK_EUC_H_ranges,
+	1851, 1851, (unsigned short*) cmap_GBK_EUC_H_table,
+};
+
+/* GBK-EUC-V */
+
+static const pdf_range cmap_GBK_EUC_V_ranges[] = {
+{41378,6,0},{41386,0,598},{41387,5,7704},{41389,0,599},
+{41394,53,582},{41470,0,7706},{41889,0,578},{41896,5,580},
+{41900,0,573},{41902,0,7707},{41914,5,576},{41917,0,7708},
+{41919,0,579},{41947,0,7709},{41949,0,7710},{41951,0,600},
+{41979,0,596},{41981,6,2},
+};
+
+static const unsigned short cmap_GBK_EUC_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GBK_EUC_V = {
+	-1, "GBK-EUC-V", "GBK-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_GBK_EUC_V_ranges,
+	4, 4, (unsigned short*) cmap_GBK_EUC_V_table,
+};
+
+/* GBK2K-H */
+
+static const pdf_range cmap_GBK2K_H_ranges[] = {
+{32,377,1},{33072,29,22440},{33072,37,22690},{33072,37,23950},
+{33072,37,25210},{33072,37,26470},{33072,37,27730},{33072,37,28990},
+{33072,37,30091},{33081,0,22448},{33088,225,10072},{33145,0,8281},
+{33146,17,10129},{33152,21,10134},{33158,0,8689},{33159,405,10140},
+{33261,0,8178},{33262,29,10242},{33270,0,8285},{33271,29,10250},
+{33328,37,22449},{33328,37,22700},{33328,37,23960},{33328,37,25220},
+{33328,37,26480},{33328,37,27740},{33328,37,29000},{33328,37,30101},
+{33344,73,10258},{33363,0,9884},{33364,53,10277},{33378,0,8629},
+{33379,65,10291},{33396,0,8908},{33397,17,10308},{33402,0,8214},
+{33403,5,10313},{33405,6,0},{33408,0,7968},{33409,5,10316},
+{33411,0,8319},{33412,45,10318},{33424,0,8284},{33425,77,10330},
+{33445,0,8596},{33446,133,10350},{33480,6,2},{33482,89,10384},
+{33505,14,4},{33509,29,10408},{33517,0,9855},{33518,13,10416},
+{33522,0,8750},{33523,13,10420},{33527,18,8},{33532,9,10425},
+{33584,37,22459},{33584,37,22710},{33584,37,23970},{33584,37,25230},
+{33584,37,26490},{33584,37,27750},{33584,37,29010},{33584,37,30111},
+{33600,6,13},{33602,9,10429},{33605,0,8916},{33606,5,10432},
+{33608,0,8121},{33609,9,10434},{33612,0,8920},{33613,21,10437},
+{33619,0,8415},{33620,9,10443},{33623,0,8386},{33624,21,10446},
+{33630,0,8597},{33631,21,10452},{33637,6,15},{33639,41,10458},
+{33650,0,8065},{33651,17,10469},{33656,26,17},{33664,0,8080},
+{33665,17,10477},{33670,0,8918},{33671,5,10482},{33673,6,24},
+{33675,5,10484},{33677,0,9857},{33678,21,10486},{33684,0,7798},
+{33685,33,10492},{33694,0,8753},{33695,25,10501},{33702,0,7827},
+{33703,13,10508},{33707,0,8914},{33708,5,10512},{33710,10,26},
+{33713,33,10514},{33722,0,7909},{33723,53,10523},{33737,0,8229},
+{33738,173,10537},{33782,0,7887},{33783,29,10581},{33840,37,22469},
+{33840,37,22720},{33840,37,23980},{33840,37,25240},{33840,37,26500},
+{33840,37,27760},{33840,37,29020},{33840,37,30121},{33846,0,22354},
+{33856,61,10589},{33872,0,8153},{33873,125,10605},{33905,0,8904},
+{33906,5,10637},{33908,0,8803},{33909,5,10639},{33911,0,9859},
+{33912,25,10641},{33920,5,10648},{33922,0,7959},{33923,41,10650},
+{33934,0,7979},{33935,9,10661},{33938,6,29},{33940,33,10664},
+{33949,0,8015},{33950,9,10673},{33953,22,31},{33959,5,10677},
+{33961,0,8053},{33962,105,10679},{33989,0,8126},{33990,49,10706},
+{34003,30,37},{34011,5,10722},{34013,0,8498},{34014,45,10724},
+{34026,0,8995},{34027,9,10736},{34030,0,8209},{34031,5,10739},
+{34033,0,8437},{34034,49,10741},{34096,37,22479},{34096,37,22730},
+{34096,37,23990},{34096,37,25250},{34096,37,26510},{34096,37,27770},
+{34096,37,29030},{34096,37,30131},{34112,65,10754},{34129,14,45},
+{34133,33,10772},{34142,0,8431},{34143,25,10781},{34150,0,8656},
+{34151,93,10788},{34176,25,10812},{34183,0,8897},{34184,9,10819},
+{34187,0,7780},{34188,21,10822},{34194,0,8697},{34195,9,10828},
+{34198,10,49},{34201,33,10832},{34210,0,7770},{34211,57,10841},
+{34226,0,7842},{34227,301,10856},{34352,37,22489},{34352,37,22740},
+{34352,37,24000},{34352,37,25260},{34352,37,26520},{34352,37,27780},
+{34352,37,29040},{34352,37,30141},{34368,37,10932},{34378,0,9069},
+{34379,33,10942},{34388,0,8775},{34389,73,10951},{34408,0,9068},
+{34409,85,10970},{34432,85,10992},{34454,0,8604},{34455,5,11014},
+{34457,0,8393},{34458,25,11016},{34465,0,8688},{34466,157,11023},
+{34506,18,52},{34511,5,11065},{34513,0,8748},{34514,37,11067},
+{34524,6,57},{34526,9,11077},{34529,0,8303},{34530,21,11080},
+{34536,0,8609},{34537,17,11086},{34542,0,9081},{34543,17,11091},
+{34548,0,9074},{34549,37,11096},{34608,37,22499},{34608,37,22750},
+{34608,37,24010},{34608,37,25270},{34608,37,26530},{34608,37,27790},
+{34608,33,29050},{34608,37,30151},{34624,0,8554},{34625,9,11106},
+{34628,0,9084},{34629,13,11109},{34633,14,59},{34637,5,11114},
+{34639,0,9079},{34640,25,11116},{34647,0,8012},{34648,5,11123},
+{34650,26,63},{34657,17,11127},{34662,0,9844},{34663,73,11132},
+{34682,0,9071},{34683,5,11151},{34685,6,70},{34688,10,72},
+{34691,9,11155},{34694,18,75},{34699,5,11160},{34701,6,80},
+{34703,13,11162},{34707,0,9070},{34708,13,11166},{34712,0,8631},
+{34713,13,11170},{34717,0,9077},{34718,17,11174},{34723,0,9090},
+{34724,9,11179},{34727,0,8350},{34728,41,11182},{34739,10,82},
+{34742,17,11194},{34747,0,9887},{34748,9,11199},{34751,14,85},
+{34755,25,11203},{34762,10,89},{34765,5,11210},{34767,0,8923},
+{34768,5,11212},{34770,14,92},{34774,13,11215},{34778,0,8865},
+{34779,109,11219},{34807,14,96},{34811,13,11248},{34864,37,22509},
+{34864,37,22760},{34864,37,24020},{34864,37,25280},{34864,37,26540},
+{34864,37,27800},{34864,37,30161},{34880,6,100},{34882,5,11252},
+{34884,10,102},{34887,221,11255},{34944,229,11311},{35002,0,9002},
+{35003,65,11369},{35020,0,8843},{35021,25,11386},{35028,0,8069},
+{35029,5,11393},{35031,0,8997},{35032,25,11395},{35039,0,9004},
+{35040,17,11402},{35045,0,9006},{35046,45,11407},{35058,6,105},
+{35060,5,11419},{35062,0,7795},{35063,29,11421},{35120,37,22519},
+{35120,37,22770},{35120,37,24030},{35120,37,25290},{35120,37,26550},
+{35120,37,27810},{35120,37,30171},{35136,41,11429},{35147,22,107},
+{35153,9,11442},{35156,0,8575},{35157,29,11445},{35165,10,113},
+{35168,49,11454},{35181,0,7805},{35182,9,11467},{35185,0,8406},
+{35186,37,11470},{35196,0,7874},{35197,5,11480},{35200,41,11482},
+{35211,0,8882},{35212,49,11493},{35225,0,7903},{35226,13,11506},
+{35230,0,7929},{35231,25,11510},{35238,10,116},{35241,21,11518},
+{35247,0,8551},{35248,37,11524},{35258,0,8685},{35259,9,11534},
+{35262,10,119},{35265,9,11537},{35268,18,122},{35273,17,11541},
+{35278,0,7723},{35279,5,11546},{35281,0,8878},{35282,21,11548},
+{35288,0,8009},{35289,5,11554},{35291,0,8504},{35292,93,11556},
+{35316,0,8321},{35317,37,11580},{35376,37,22780},{35376,37,24040},
+{35376,37,25300},{35376,37,26560},{35376,37,27820},{35376,37,30181},
+{35392,6,127},{35394,89,11591},{35417,22,129},{35423,101,11616},
+{35449,0,8877},{35450,17,11642},{35456,397,11647},{35556,0,8255},
+{35557,101,11747},{35632,37,22790},{35632,37,24050},{35632,37,25310},
+{35632,37,26570},{35632,37,27830},{35632,37,30191},{35634,30,135},
+{35648,13,11773},{35652,0,7950},{35653,13,11777},{35657,0,9209},
+{35658,189,11781},{35706,0,9212},{35707,13,11829},{35712,45,11833},
+{35724,0,8297},{35725,65,11845},{35742,0,9207},{35743,77,11862},
+{35763,0,9206},{35764,17,11882},{35769,0,9213},{35770,13,11887},
+{35774,0,9208},{35775,25,11891},{35782,14,143},{35786,37,11899},
+{35796,0,9217},{35797,25,11909},{35804,0,9215},{35805,29,11916},
+{35813,0,9216},{35814,17,11924},{35819,0,8737},{35820,13,11929},
+{35824,0,8482},{35825,53,11933},{35888,0,3238},{35888,37,22800},
+{35888,37,24060},{35888,37,25320},{35888,37,26580},{35888,37,27840},
+{35888,37,30201},{35889,34,147},{35904,13,11947},{35908,0,9211},
+{35909,37,11951},{35919,0,8538},{35920,25,11961},{35927,0,8677},
+{35928,13,11968},{35932,0,8279},{35933,133,11972},{35968,41,12006},
+{35979,30,156},{35987,21,12019},{35993,6,164},{35995,25,12025},
+{36002,22,166},{36008,93,12033},{36032,0,9052},{36033,65,12057},
+{36050,14,172},{36054,9,12075},{36057,0,8510},{36058,121,12078},
+{36089,0,7958},{36090,17,12109},{36144,0,2543},{36144,37,22810},
+{36144,37,24070},{36144,37,25330},{36144,37,26590},{36144,37,27850},
+{36144,37,30211},{36145,34,176},{36160,201,12114},{36211,10,185},
+{36214,17,12166},{36219,0,8628},{36220,9,12171},{36224,29,12174},
+{36232,0,9103},{36233,21,12182},{36239,0,7962},{36240,53,12188},
+{36254,0,9099},{36255,101,12202},{36281,0,9098},{36282,157,12228},
+{36322,10,188},{36325,5,12269},{36327,0,9096},{36328,57,12271},
+{36343,0,9102},{36344,21,12286},{36350,0,9101},{36400,0,4283},
+{36400,37,22820},{36400,37,24080},{36400,37,25340},{36400,37,26600},
+{36400,37,27860},{36400,29,30221},{36401,34,191},{36416,21,12292},
+{36422,0,9100},{36423,57,12298},{36438,18,200},{36443,49,12315},
+{36456,0,8169},{36457,17,12328},{36462,10,205},{36465,53,12334},
+{36480,0,8996},{36481,101,12348},{36507,0,8515},{36508,9,12374},
+{36511,0,8489},{36512,13,12377},{36516,0,8823},{36517,5,12381},
+{36519,0,7847},{36520,13,12383},{36524,10,208},{36527,53,12388},
+{36541,6,211},{36543,13,12402},{36547,10,213},{36550,25,12407},
+{36557,6,216},{36559,25,12414},{36566,6,218},{36568,77,12421},
+{36588,0,8160},{36589,69,12441},{36656,0,4656},{36656,37,22830},
+{36656,37,24090},{36656,37,25350},{36656,37,26610},{36656,37,27870},
+{36657,0,5934},{36657,33,30229},{36658,30,220},{36672,69,12459},
+{36690,18,228},{36695,21,12477},{36701,0,8261},{36702,21,12483},
+{36708,0,8568},{36709,101,12489},{36736,21,12515},{36742,10,233},
+{36745,45,12522},{36757,10,236},{36760,9,12535},{36763,10,239},
+{36766,9,12539},{36769,0,9852},{36770,105,12542},{36797,0,8133},
+{36798,21,12569},{36804,10,242},{36807,21,12576},{36813,0,7947},
+{36814,37,12582},{36824,0,7804},{36825,149,12592},{36912,0,2093},
+{36912,37,22840},{36912,37,24100},{36912,37,25360},{36912,37,26620},
+{36912,37,27880},{36912,37,30238},{36913,34,245},{36928,249,12630},
+{36992,113,12693},{37021,6,254},{37023,105,12722},{37050,0,7907},
+{37051,17,12749},{37056,6,256},{37058,9,12754},{37061,0,9145},
+{37062,81,12757},{37083,6,258},{37085,61,12778},{37101,0,9141},
+{37102,5,12794},{37104,0,9146},{37105,21,12796},{37111,0,9139},
+{37112,25,12802},{37168,0,5614},{37168,37,22850},{37168,37,24110},
+{37168,37,25370},{37168,37,26630},{37168,37,27890},{37168,37,30248},
+{37169,34,260},{37184,5,12809},{37186,0,8546},{37187,29,12811},
+{37195,10,269},{37198,9,12820},{37201,0,9143},{37202,5,12823},
+{37204,6,272},{37206,9,12825},{37209,6,274},{37211,5,12828},
+{37213,0,8274},{37214,9,12830},{37217,10,276},{37220,37,12834},
+{37230,0,8754},{37231,25,12844},{37238,0,7743},{37239,9,12851},
+{37242,10,279},{37245,5,12854},{37248,13,12856},{37252,0,7854},
+{37253,29,12860},{37261,0,7931},{37262,9,12868},{37265,10,282},
+{37268,9,12872},{37271,0,8644},{37272,9,12875},{37275,0,8724},
+{37276,49,12878},{37289,10,285},{37292,53,12891},{37306,6,288},
+{37308,9,12905},{37311,0,9440},{37312,9,12908},{37315,0,9144},
+{37316,33,12911},{37325,0,7809},{37326,5,12920},{37328,38,290},
+{37338,17,12925},{37343,0,9441},{37344,5,12930},{37346,0,9379},
+{37347,25,12932},{37354,0,9380},{37355,17,12939},{37360,10,300},
+{37363,45,12945},{37424,0,2240},{37424,37,22860},{37424,37,24120},
+{37424,37,25380},{37424,37,26640},{37424,37,27900},{37424,37,30258},
+{37425,34,303},{37440,249,12957},{37504,213,13020},{37558,0,8657},
+{37559,89,13074},{37582,10,312},{37585,9,13098},{37588,0,9858},
+{37589,37,13101},{37599,6,315},{37601,113,13111},{37630,0,8077},
+{37680,0,6589},{37680,37,22870},{37680,37,24130},{37680,37,25390},
+{37680,37,26650},{37680,37,27910},{37680,37,30268},{37681,34,317},
+{37696,61,13140},{37712,0,8703},{37713,45,13156},{37725,0,8024},
+{37726,69,13168},{37744,0,8539},{37745,17,13186},{37750,0,7862},
+{37751,29,13191},{37760,45,13199},{37772,0,8411},{37773,61,13211},
+{37789,0,9056},{37790,25,13227},{37797,10,326},{37800,45,13235},
+{37812,0,8846},{37813,9,13247},{37816,0,8159},{37817,5,13250},
+{37819,10,329},{37822,29,13253},{37830,0,8194},{37831,29,13261},
+{37839,0,8339},{37840,25,13269},{37847,0,9055},{37848,9,13276},
+{37851,6,332},{37853,13,13279},{37857,0,7944},{37858,5,13283},
+{37860,6,334},{37862,9,13285},{37865,34,336},{37874,5,13291},
+{37876,6,345},{37878,13,13293},{37882,0,7849},{37883,9,13297},
+{37886,0,8140},{37936,0,4713},{37936,37,22880},{37936,37,24140},
+{37936,37,25400},{37936,37,26660},{37936,37,27920},{37936,21,30278},
+{37937,34,347},{37952,13,13300},{37956,0,8050},{37957,29,13304},
+{37965,0,8344},{37966,5,13312},{37968,22,356},{37974,5,13315},
+{37976,0,9061},{37977,5,13317},{37979,18,362},{37984,13,13320},
+{37988,10,367},{37991,25,13325},{37998,0,8252},{37999,9,13332},
+{38002,34,370},{38011,13,13339},{38016,10,379},{38019,13,13343},
+{38023,6,382},{38025,93,13347},{38049,0,7726},{38050,65,13371},
+{38067,10,384},{38070,33,13389},{38079,6,387},{38081,41,13398},
+{38092,0,9428},{38093,41,13409},{38104,0,8815},{38105,25,13420},
+{38112,0,7895},{38113,117,13427},{38192,0,1733},{38192,37,22890},
+{38192,37,24150},{38192,37,25410},{38192,37,26670},{38192,37,27930},
+{38193,34,389},{38208,197,13457},{38258,0,8493},{38259,45,13507},
+{38272,9,13519},{38275,0,8859},{38276,101,13522},{38302,6,398},
+{38304,73,13548},{38323,0,7801},{38324,21,13567},{38330,0,8794},
+{38331,77,13573},{38351,22,400},{38357,45,13595},{38369,0,9385},
+{38370,17,13607},{38375,0,8167},{38376,33,13612},{38385,0,8466},
+{38386,21,13621},{38392,0,8508},{38393,17,13627},{38398,0,8028},
+{38448,0,2850},{38448,37,22900},{38448,37,24160},{38448,37,25420},
+{38448,37,26680},{38448,37,27940},{38449,34,406},{38464,85,13632},
+{38486,0,9412},{38487,145,13654},{38524,0,7884},{38525,5,13691},
+{38528,505,13693},{38704,0,2780},{38704,37,22910},{38704,37,24170},
+{38704,37,25430},{38704,37,26690},{38704,37,27950},{38705,34,415},
+{38720,153,13820},{38759,0,9322},{38760,13,13859},{38764,10,424},
+{38767,61,13864},{38784,85,13880},{38806,6,427},{38808,17,13902},
+{38813,0,7886},{38814,17,13907},{38819,0,8818},{38820,105,13912},
+{38847,0,9331},{38848,181,13939},{38894,0,8702},{38895,29,13985},
+{38903,0,7934},{38904,25,13993},{38960,0,6686},{38960,37,22920},
+{38960,37,24180},{38960,37,25440},{38960,37,26700},{38960,37,27960},
+{38961,10,429},{38963,25,29064},{38964,22,432},{38976,17,14000},
+{38981,0,9333},{38982,9,14005},{38985,0,8714},{38986,17,14008},
+{38991,0,8047},{38992,129,14013},{39025,10,438},{39028,41,14047},
+{39040,6,441},{39042,33,14059},{39051,6,443},{39053,73,14068},
+{39072,0,9340},{39073,33,14087},{39082,0,8097},{39083,41,14096},
+{39094,6,445},{39096,5,14107},{39098,0,9324},{39099,45,14109},
+{39111,0,8254},{39112,9,14121},{39115,0,7756},{39116,13,14124},
+{39120,0,8506},{39121,5,14128},{39123,0,8708},{39124,57,14130},
+{39139,10,447},{39142,33,14145},{39151,0,9332},{39152,5,14154},
+{39154,0,8413},{39155,45,14156},{39216,0,3300},{39216,37,22930},
+{39216,37,24190},{39216,37,25450},{39216,37,26710},{39216,37,27970},
+{39216,37,29071},{39217,34,450},{39232,9,14168},{39235,10,459},
+{39238,125,14172},{39270,0,9330},{39271,25,14204},{39278,0,7861},
+{39279,21,14211},{39285,0,9336},{39286,13,14217},{39290,6,462},
+{39292,9,14221},{39296,17,14224},{39301,0,9881},{39302,9,14229},
+{39305,0,9346},{39306,13,14232},{39310,0,8353},{39311,5,14236},
+{39313,0,8082},{39314,25,14238},{39321,0,7992},{39322,57,14245},
+{39337,0,9349},{39338,21,14260},{39344,22,464},{39350,25,14267},
+{39357,22,470},{39363,21,14276},{39369,0,9327},{39370,13,14282},
+{39374,0,9345},{39375,5,14286},{39377,0,8736},{39378,29,14288},
+{39386,0,8181},{39387,17,14296},{39392,0,8436},{39393,13,14301},
+{39397,0,9341},{39398,5,14305},{39400,0,9337},{39401,9,14307},
+{39404,0,9342},{39405,25,14310},{39412,0,9338},{39413,37,14317},
+{39472,0,4093},{39472,37,22940},{39472,37,24200},{39472,37,25460},
+{39472,37,26720},{39472,37,27980},{39472,37,29081},{39473,34,476},
+{39488,37,14327},{39498,0,8419},{39499,45,14337},{39511,0,8365},
+{39512,49,14349},{39525,10,485},{39528,33,14363},{39537,0,8537},
+{39538,13,14372},{39542,6,488},{39544,25,14376},{39552,29,14383},
+{39560,0,7772},{39561,9,14391},{39564,0,9352},{39565,13,14394},
+{39569,0,9351},{39570,17,14398},{39575,0,9354},{39576,5,14403},
+{39578,6,490},{39580,5,14405},{39582,0,8067},{39583,9,14407},
+{39586,6,492},{39588,21,14410},{39594,0,8367},{39595,145,14416},
+{39632,0,9408},{39633,17,14453},{39638,0,8813},{39639,9,14458},
+{39642,0,9409},{39643,25,14461},{39650,14,494},{39654,97,14469},
+{39728,0,7803},{39728,37,22950},{39728,37,24210},{39728,37,25470},
+{39728,37,26730},{39728,37,27990},{39728,37,29091},{39729,34,498},
+{39744,249,14494},{39808,321,14557},{39889,0,9180},{39890,37,14638},
+{39900,0,9179},{39901,133,14648},{39984,0,8317},{39984,37,22960},
+{39984,37,24220},{39984,37,25480},{39984,37,26740},{39984,37,28000},
+{39984,37,29101},{39985,34,507},{40000,73,14682},{40019,0,8286},
+{40020,17,14701},{40025,14,516},{40029,93,14707},{40053,0,8607},
+{40054,9,14731},{40057,0,7782},{40058,17,14734},{40064,21,14739},
+{40070,0,8035},{40071,85,14745},{40093,0,9181},{40094,49,14767},
+{40107,0,8555},{40108,117,14780},{40138,0,8885},{40139,13,14810},
+{40143,0,7974},{40144,85,14814},{40166,6,520},{40168,13,14836},
+{40172,10,522},{40175,45,14841},{40187,0,8011},{40188,5,14853},
+{40190,0,8850},{40240,0,2289},{40240,37,22970},{40240,37,24230},
+{40240,37,25490},{40240,37,26750},{40240,37,28010},{40240,37,29111},
+{40241,34,525},{40256,5,14855},{40258,0,8484},{40259,9,14857},
+{40262,6,534},{40264,17,14860},{40269,10,536},{40272,65,14866},
+{40289,0,8369},{40290,21,14883},{40296,6,539},{40298,13,14889},
+{40302,0,8888},{40303,5,14893},{40305,0,8822},{40306,9,14895},
+{40309,0,8091},{40310,17,14898},{40315,14,541},{40320,37,14905},
+{40330,0,8382},{40331,5,14915},{40333,0,8116},{40334,9,14917},
+{40337,0,9175},{40338,25,14920},{40345,0,8453},{40346,25,14927},
+{40353,6,545},{40355,13,14934},{40359,0,9194},{40360,13,14938},
+{40364,6,547},{40366,13,14942},{40370,6,549},{40372,37,14946},
+{40382,0,8093},{40383,25,14956},{40390,0,9189},{40391,5,14963},
+{40393,0,8804},{40394,9,14965},{40397,0,9442},{40398,13,14968},
+{40402,0,9182},{40403,5,14972},{40405,0,7876},{40406,41,14974},
+{40417,6,551},{40419,53,14985},{40433,0,8491},{40434,5,14999},
+{40436,0,8357},{40437,5,15001},{40439,0,9867},{40440,5,15003},
+{40442,0,8054},{40443,5,15005},{40445,6,553},{40496,0,1754},
+{40496,37,22980},{40496,37,24240},{40496,37,25500},{40496,37,26760},
+{40496,37,28020},{40496,37,29121},{40497,34,555},{40512,17,15008},
+{40517,0,8193},{40518,5,15013},{40520,6,564},{40522,29,15015},
+{40530,18,566},{40535,21,15025},{40541,6,571},{40543,5,15031},
+{40545,10,573},{40548,9,15034},{40551,0,9183},{40552,13,15037},
+{40556,0,7759},{40557,5,15041},{40559,0,9177},{40560,5,15043},
+{40562,14,576},{40566,17,15046},{40571,6,580},{40573,5,15051},
+{40576,17,15053},{40581,10,582},{40584,33,15059},{40593,0,8186},
+{40594,13,15068},{40598,6,585},{40600,37,15072},{40610,0,8454},
+{40611,9,15082},{40614,0,8203},{40615,5,15085},{40617,0,8550},
+{40618,13,15087},{40622,0,9199},{40623,13,15091},{40627,6,587},
+{40629,5,15095},{40631,0,9191},{40632,241,15097},{40693,0,8611},
+{40694,33,15158},{40752,0,8305},{40752,37,22990},{40752,37,24250},
+{40752,37,25510},{40752,37,26770},{40752,37,28030},{40752,37,29131},
+{40753,34,589},{40768,53,15167},{40782,0,8570},{40783,125,15181},
+{40815,0,8613},{40816,57,15213},{40832,69,15228},{40850,0,8226},
+{40851,17,15246},{40856,0,9430},{40857,49,15251},{40870,0,9018},
+{40871,5,15264},{40873,0,7918},{40874,5,15266},{40876,0,9429},
+{40877,109,15268},{40905,0,8744},{40906,9,15296},{40909,0,9431},
+{40910,73,15299},{40929,0,8444},{40930,33,15318},{40939,0,7815},
+{40940,5,15327},{40942,0,9432},{40943,17,15329},{40948,0,7866},
+{40949,29,15334},{40957,6,598},{41008,0,1072},{41008,37,23000},
+{41008,37,24260},{41008,37,25520},{41008,37,26780},{41008,37,28040},
+{41008,37,29141},{41009,18,600},{41024,9,15343},{41027,0,8556},
+{41028,5,15346},{41030,0,9433},{41031,5,15348},{41033,0,8743},
+{41034,13,15350},{41038,0,7775},{41039,17,15354},{41044,0,8863},
+{41045,17,15359},{41050,0,8029},{41051,21,15364},{41057,10,605},
+{41060,49,15371},{41073,0,8521},{41074,5,15384},{41076,0,8262},
+{41077,37,15386},{41088,0,8192},{41089,61,15396},{41105,0,8592},
+{41106,5,15412},{41108,10,608},{41111,69,15415},{41129,0,9411},
+{41130,81,15433},{41151,0,8396},{41152,53,15454},{41166,0,9024},
+{41167,37,15468},{41177,0,7889},{41178,13,15478},{41182,0,8620},
+{41183,57,15482},{41198,0,8879},{41199,61,15497},{41264,37,23010},
+{41264,37,24270},{41264,37,25530},{41264,37,26790},{41264,37,28050},
+{41264,37,29151},{41377,373,96},{41520,37,23020},{41520,37,24280},
+{41520,37,25540},{41520,37,26800},{41520,37,28060},{41520,37,29161},
+{41633,37,9897},{41649,197,190},{41699,0,22353},{41701,37,240},
+{41713,45,250},{41776,37,23030},{41776,37,24290},{41776,37,25550},
+{41776,37,26810},{41776,37,28070},{41776,37,29171},{41889,373,262},
+{42032,37,23040},{42032,37,24300},{42032,37,25560},{42032,37,26820},
+{42032,37,28080},{42032,37,29181},{42145,329,356},{42288,37,23050},
+{42288,37,24310},{42288,37,25570},{42288,37,26830},{42288,37,28090},
+{42288,37,29191},{42291,9,22395},{42296,5,22398},{42401,341,439},
+{42544,0,22400},{42544,37,23060},{42544,37,24320},{42544,37,25580},
+{42544,37,26840},{42544,37,28100},{42544,37,29201},{42548,0,22357},
+{42550,0,22375},{42657,93,525},{42689,209,549},{42800,37,23070},
+{42800,37,24330},{42800,37,25590},{42800,37,26850},{42800,37,28110},
+{42800,37,29211},{42805,14,611},{42913,129,602},{42961,129,635},
+{43056,37,23080},{43056,37,24340},{43056,37,25600},{43056,37,26860},
+{43056,37,28120},{43056,37,29221},{43062,9,22401},{43072,249,9907},
+{43136,85,9970},{43169,125,668},{43205,149,700},{43312,37,23090},
+{43312,37,24350},{43312,37,25610},{43312,37,26870},{43312,37,28130},
+{43312,37,29231},{43328,93,9992},{43353,5,10016},{43356,0,10018},
+{43360,121,10019},{43392,85,10050},{43414,0,7703},{43428,301,738},
+{43568,37,23100},{43568,37,24360},{43568,37,25620},{43568,37,26880},
+{43568,37,28140},{43568,37,29241},{43584,49,15513},{43597,6,615},
+{43599,133,15526},{43633,10,617},{43636,9,15561},{43639,0,9109},
+{43640,5,15564},{43642,6,620},{43644,9,15566},{43648,101,15569},
+{43674,26,622},{43681,373,814},{43824,37,23110},{43824,37,24370},
+{43824,37,25630},{43824,37,26890},{43824,37,28150},{43824,37,29251},
+{43840,0,8036},{43841,5,15598},{43843,30,629},{43851,5,15602},
+{43853,0,9113},{43854,193,15604},{43904,129,15653},{43937,125,908},
+{44080,37,23120},{44080,37,24380},{44080,37,25640},{44080,37,26900},
+{44080,37,28160},{44080,37,29261},{44096,21,15686},{44102,0,8640},
+{44103,165,15692},{44145,0,9312},{44146,37,15734},{44156,0,9308},
+{44157,5,15744},{44160,49,15746},{44173,0,8541},{44174,17,15759},
+{44179,6,637},{44181,45,15764},{44336,37,23130},{44336,37,24390},
+{44336,37,25650},{44336,37,26910},{44336,37,28170},{44336,37,29271},
+{44352,33,15776},{44361,0,9313},{44362,77,15785},{44382,0,9307},
+{44383,5,15805},{44385,0,9314},{44386,21,15807},{44392,0,8020},
+{44393,41,15813},{44404,0,9311},{44405,37,15824},{44416,5,15834},
+{44418,0,8428},{44419,13,15836},{44423,0,9309},{44424,9,15840},
+{44427,0,9315},{44428,17,15843},{44433,0,9316},{44434,57,15848},
+{44592,37,23140},{44592,37,24400},{44592,37,25660},{44592,37,26920},
+{44592,37,28180},{44592,37,29281},{44608,77,15863},{44628,0,9381},
+{44629,49,15883},{44642,0,7792},{44643,109,15896},{44672,0,8335},
+{44673,13,15924},{44677,0,7746},{44678,17,15928},{44683,0,8014},
+{44684,29,15933},{44692,0,7857},{44693,41,15941},{44704,0,7819},
+{44848,37,23150},{44848,37,24410},{44848,37,25670},{44848,37,26930},
+{44848,37,28190},{44848,37,29291},{44864,141,15952},{44900,0,8134},
+{44901,85,15988},{44923,0,9646},{44924,9,16010},{44928,5,16013},
+{44930,6,639},{44932,37,16015},{44942,14,641},{44946,37,16026},
+{44956,0,9651},{44957,5,16036},{44959,6,645},{45104,37,23160},
+{45104,37,24420},{45104,37,25680},{45104,37,26940},{45104,37,28200},
+{45104,37,29301},{45120,0,16039},{45121,5,9647},{45123,6,647},
+{45125,37,16041},{45135,0,9644},{45136,13,16051},{45140,0,7758},
+{45141,5,16055},{45143,34,649},{45152,5,9652},{45154,10,658},
+{45157,25,16060},{45164,0,7913},{45165,61,16067},{45181,6,661},
+{45184,89,16084},{45207,10,663},{45210,25,16108},{45217,373,940},
+{45360,37,23170},{45360,37,24430},{45360,37,25690},{45360,37,26950},
+{45360,37,28210},{45360,37,29311},{45376,41,16115},{45387,30,666},
+{45395,173,16129},{45440,89,16173},{45463,0,9860},{45464,33,16196},
+{45473,373,1034},{45616,37,23180},{45616,37,24440},{45616,37,25700},
+{45616,37,26960},{45616,37,28220},{45616,37,29321},{45632,6,674},
+{45634,145,16206},{45671,0,9454},{45672,17,16243},{45677,0,8308},
+{45678,21,16248},{45684,0,9863},{45685,37,16254},{45696,0,9456},
+{45697,29,16264},{45705,0,9869},{45706,61,16272},{45722,0,8864},
+{45723,21,16288},{45729,373,1128},{45872,37,23190},{45872,37,24450},
+{45872,37,25710},{45872,37,26970},{45872,37,28230},{45872,37,29331},
+{45888,9,16294},{45891,0,8107},{45892,173,16297},{45936,0,9896},
+{45937,53,16341},{45952,29,16355},{45960,0,9449},{45961,9,16363},
+{45964,10,676},{45967,69,16367},{45985,373,1222},{46128,37,23200},
+{46128,37,24460},{46128,37,25720},{46128,37,26980},{46128,37,28240},
+{46128,37,29341},{46132,21,22404},{46144,77,16385},{46164,0,8520},
+{46165,9,16405},{46168,0,9444},{46169,17,16408},{46174,14,679},
+{46178,73,16414},{46197,0,8871},{46198,29,16433},{46206,0,9452},
+{46208,9,16441},{46211,0,9451},{46212,17,16444},{46217,0,9443},
+{46218,33,16449},{46227,0,9450},{46228,49,16458},{46241,373,1316},
+{46384,37,22410},{46384,37,23210},{46384,37,24470},{46384,37,25730},
+{46384,37,26990},{46384,37,28250},{46384,37,29351},{46400,6,683},
+{46402,33,16472},{46411,0,7719},{46412,37,16481},{46422,0,8166},
+{46423,9,16491},{46426,10,685},{46429,13,16494},{46433,0,9448},
+{46434,113,16498},{46464,109,16527},{46492,6,688},{46494,9,16555},
+{46497,373,1410},{46640,29,22420},{46640,37,23220},{46640,37,24480},
+{46640,37,25740},{46640,37,27000},{46640,37,28260},{46640,37,29361},
+{46656,69,16558},{46674,0,9890},{46675,5,16576},{46677,0,9437},
+{46678,9,16578},{46681,14,690},{46685,133,16582},{46720,129,16616},
+{46753,373,1504},{46896,37,23230},{46896,37,24490},{46896,37,25750},
+{46896,37,27010},{46896,37,28270},{46896,37,29371},{46912,53,16649},
+{46926,0,8853},{46927,5,16663},{46929,0,7808},{46930,25,16665},
+{46937,0,9847},{46938,37,16672},{46948,10,694},{46951,61,16682},
+{46967,6,697},{46969,21,16698},{46976,10,699},{46979,117,16705},
+{47009,373,1598},{47152,37,23240},{47152,37,24500},{47152,37,25760},
+{47152,37,27020},{47152,37,28280},{47152,37,29381},{47168,9,16735},
+{47171,14,702},{47175,21,16739},{47181,0,9657},{47182,9,16745},
+{47185,0,8170},{47186,29,16748},{47194,26,706},{47201,85,16758},
+{47223,0,8513},{47224,25,16780},{47232,5,16787},{47234,0,8135},
+{47235,117,16789},{47265,373,1692},{47408,37,23250},{47408,37,24510},
+{47408,37,25770},{47408,37,27030},{47408,37,28290},{47408,37,29391},
+{47424,61,16819},{47440,0,7745},{47441,61,16835},{47457,0,9700},
+{47458,97,16851},{47483,0,8070},{47484,9,16876},{47488,113,16879},
+{47517,0,8115},{47518,5,16908},{47520,0,7919},{47521,373,1786},
+{47664,37,23260},{47664,37,24520},{47664,37,25780},{47664,37,27040},
+{47664,37,28300},{47664,37,29401},{47680,5,16910},{47682,10,713},
+{47685,65,16913},{47702,0,9699},{47703,5,16930},{47705,0,8465},
+{47706,21,16932},{47712,0,9702},{47713,33,16938},{47722,0,9703},
+{47723,33,16947},{47732,0,8257},{47733,37,16956},{47744,13,16966},
+{47748,18,716},{47753,13,16972},{47757,0,9707},{47758,61,16976},
+{47774,10,721},{47777,373,1880},{47920,37,23270},{47920,37,24530},
+{47920,37,25790},{47920,37,27050},{47920,37,28310},{47920,37,29411},
+{47936,0,8183},{47937,29,16993},{47945,0,7821},{47946,53,17001},
+{47960,0,9705},{47961,5,17015},{47963,6,724},{47965,9,17017},
+{47968,0,9875},{47969,13,17020},{47973,22,726},{47979,9,17026},
+{47982,0,9891},{47983,61,17029},{48000,129,17045},{48033,373,1974},
+{48176,37,23280},{48176,37,24540},{48176,37,25800},{48176,37,27060},
+{48176,37,28320},{48176,37,29421},{48192,69,17078},{48210,6,732},
+{48212,21,17096},{48218,0,8228},{48219,21,17102},{48225,34,734},
+{48234,9,17112},{48237,34,743},{48246,5,9246},{48248,14,752},
+{48252,5,17119},{48254,0,8359},{48256,5,17121},{48258,38,756},
+{48268,9,17125},{48271,0,7923},{48272,37,17128},{48282,14,766},
+{48286,9,17138},{48289,373,2068},{48432,37,23290},{48432,37,24550},
+{48432,37,25810},{48432,37,27070},{48432,37,28330},{48432,37,29431},
+{48448,5,17141},{48450,14,770},{48454,5,17144},{48456,30,774},
+{48464,25,17149},{48471,10,782},{48474,45,17157},{48486,6,785},
+{48488,5,17169},{48490,6,787},{48492,9,17171},{48495,10,789},
+{48498,25,17175},{48505,10,792},{48508,5,17182},{48510,0,8148},
+{48512,6,795},{48514,25,17185},{48521,10,797},{48524,5,17193},
+{48526,14,800},{48530,17,17196},{48535,0,8536},{48536,9,17201},
+{48539,0,8130},{48540,17,17204},{48545,373,2162},{48688,37,23300},
+{48688,37,24560},{48688,37,25820},{48688,37,27080},{48688,37,28340},
+{48688,37,29441},{48704,9,17209},{48707,10,804},{48710,9,17213},
+{48713,6,807},{48715,21,17216},{48721,34,809},{48730,9,17223},
+{48733,30,818},{48741,13,17227},{48745,0,9269},{48746,5,17231},
+{48748,0,9275},{48749,5,17233},{48751,6,826},{48753,17,17235},
+{48758,14,828},{48762,5,17241},{48764,10,832},{48768,9,17243},
+{48771,26,835},{48778,5,17248},{48780,14,842},{48784,5,17251},
+{48786,0,8326},{48787,5,17253},{48789,30,846},{48797,5,17258},
+{48799,6,854},{48801,373,2256},{48944,37,23310},{48944,37,24570},
+{48944,37,25830},{48944,37,27090},{48944,37,28350},{48944,37,29451},
+{48960,0,9894},{48961,45,17261},{48973,14,856},{48977,13,17273},
+{48981,6,860},{48983,33,17277},{48992,18,862},{48997,9,17287},
+{49000,0,8642},{49001,9,17290},{49004,0,8558},{49005,9,17293},
+{49008,14,867},{49012,5,17297},{49014,34,871},{49024,5,17301},
+{49026,6,880},{49028,17,17303},{49033,6,882},{49035,37,17308},
+{49045,14,884},{49049,13,17319},{49053,0,9300},{49054,9,17323},
+{49057,373,2350},{49200,37,23320},{49200,37,24580},{49200,37,25840},
+{49200,37,27100},{49200,37,28360},{49200,37,29461},{49216,0,8443},
+{49217,9,17326},{49220,0,9280},{49221,21,17329},{49227,30,888},
+{49235,5,17336},{49237,0,8110},{49238,17,17338},{49243,0,8730},
+{49244,5,17343},{49246,10,896},{49249,29,17345},{49257,30,899},
+{49265,9,17356},{49268,22,907},{49274,5,17361},{49276,0,8191},
+{49277,5,17363},{49280,105,17365},{49307,10,913},{49310,9,17393},
+{49313,373,2444},{49456,37,23330},{49456,37,24590},{49456,37,25850},
+{49456,37,27110},{49456,37,28370},{49456,37,29471},{49472,61,17396},
+{49488,0,7914},{49489,9,17412},{49492,0,7724},{49493,37,17415},
+{49503,14,916},{49507,69,17426},{49525,0,9714},{49526,5,17444},
+{49528,0,8725},{49529,21,17446},{49536,81,17452},{49557,0,8622},
+{49558,41,17473},{49569,373,2538},{49712,37,23340},{49712,37,24600},
+{49712,37,25860},{49712,37,27120},{49712,37,28380},{49712,37,29481},
+{49728,53,17484},{49742,0,8416},{49743,85,17498},{49765,10,920},
+{49768,81,17521},{49789,6,923},{49792,13,17543},{49796,0,8601},
+{49797,53,17547},{49811,38,925},{49821,9,17563},{49824,0,8569},
+{49825,373,2632},{49968,37,23350},{49968,37,24610},{49968,37,25870},
+{49968,37,27130},{49968,37,28390},{49968,37,29491},{49984,0,8248},
+{49985,5,17566},{49987,0,8533},{49988,217,17568},{50043,0,8658},
+{50044,9,17623},{50048,13,17626},{50052,0,9415},{50053,85,17630},
+{50075,0,8825},{50076,17,17652},{50081,373,2726},{50224,37,23360},
+{50224,37,24620},{50224,37,25880},{50224,37,27140},{50224,37,28400},
+{50224,37,29501},{50240,33,17657},{50249,0,8483},{50250,5,17666},
+{50252,0,9413},{50253,25,17668},{50260,0,9417},{50261,9,17675},
+{50264,0,8340},{50265,5,17678},{50267,0,8854},{50268,25,17680},
+{50275,0,7799},{50276,73,17687},{50295,0,7942},{50296,5,17706},
+{50298,0,8101},{50299,13,17708},{50304,6,935},{50306,57,17713},
+{50321,10,937},{50324,13,17728},{50328,18,940},{50333,13,17734},
+{50337,373,2820},{50480,37,23370},{50480,37,24630},{50480,37,25890},
+{50480,37,27150},{50480,37,28410},{50480,37,29511},{50496,13,17738},
+{50500,10,945},{50503,13,17743},{50507,6,948},{50509,17,17747},
+{50514,0,8236},{50515,45,17752},{50527,0,8545},{50528,9,17764},
+{50531,14,950},{50535,93,17767},{50560,73,17791},{50579,0,7777},
+{50580,29,17810},{50588,10,954},{50591,5,17819},{50593,373,2914},
+{50736,37,23380},{50736,37,24640},{50736,37,25900},{50736,37,27160},
+{50736,37,28420},{50736,37,29521},{50752,6,957},{50754,5,17822},
+{50756,0,8072},{50757,5,17824},{50759,0,8696},{50760,105,17826},
+{50787,0,8994},{50788,53,17853},{50802,0,9014},{50803,45,17867},
+{50816,129,17879},{50849,373,3008},{50992,37,23390},{50992,37,24650},
+{50992,37,25910},{50992,37,27170},{50992,37,28430},{50992,37,29531},
+{51008,149,17912},{51046,0,8875},{51047,29,17950},{51055,0,8127},
+{51056,21,17958},{51062,0,8061},{51063,13,17964},{51067,0,9011},
+{51068,9,17968},{51072,129,17971},{51105,373,3102},{51248,37,23400},
+{51248,37,24660},{51248,37,25920},{51248,37,27180},{51248,37,28440},
+{51248,37,29541},{51264,6,959},{51266,49,18005},{51279,0,9012},
+{51280,5,18018},{51282,0,8177},{51283,73,18020},{51302,0,8587},
+{51303,25,18039},{51310,0,9033},{51311,57,18046},{51326,0,8715},
+{51328,25,18061},{51335,0,9030},{51336,37,18068},{51346,10,961},
+{51349,13,18079},{51353,0,9889},{51354,9,18083},{51357,0,8034},
+{51358,9,18086},{51361,373,3196},{51504,37,23410},{51504,37,24670},
+{51504,37,25930},{51504,37,27190},{51504,37,28450},{51504,37,29551},
+{51520,57,18089},{51535,6,964},{51537,113,18104},{51566,10,966},
+{51569,21,18134},{51575,0,7954},{51576,25,18140},{51584,57,18147},
+{51599,6,969},{51601,41,18162},{51612,0,9020},{51613,13,18173},
+{51617,373,3290},{51760,37,23420},{51760,37,24680},{51760,37,25940},
+{51760,37,27200},{51760,37,28460},{51760,37,29561},{51776,53,18177},
+{51790,0,9839},{51791,25,18191},{51798,0,9041},{51799,5,18198},
+{51801,0,8096},{51802,5,18200},{51804,0,9016},{51805,13,18202},
+{51809,0,8731},{51810,45,18206},{51822,0,9026},{51823,9,18218},
+{51826,0,9039},{51827,13,18221},{51831,0,9021},{51832,9,18225},
+{51835,14,971},{51840,6,975},{51842,25,18230},{51849,0,9040},
+{51850,13,18237},{51854,6,977},{51856,5,18241},{51858,0,8651},
+{51859,25,18243},{51866,0,9045},{51867,21,18250},{51873,373,3384},
+{52016,37,23430},{52016,37,24690},{52016,37,25950},{52016,37,27210},
+{52016,37,28470},{52016,37,29571},{52032,9,18256},{52035,18,979},
+{52040,9,18261},{52043,0,9856},{52044,5,18264},{52046,0,8410},
+{52047,29,18266},{52055,0,9034},{52056,17,18274},{52061,10,984},
+{52064,37,18280},{52074,0,9023},{52075,61,18290},{52091,6,987},
+{52093,5,18306},{52096,25,18308},{52103,0,8722},{52104,21,18315},
+{52110,0,8711},{52111,9,18321},{52114,0,9049},{52115,33,18324},
+{52124,10,989},{52127,5,18334},{52129,373,3478},{52272,37,23440},
+{52272,37,24700},{52272,37,25960},{52272,37,27220},{52272,37,28480},
+{52272,37,29581},{52288,6,992},{52290,25,18336},{52297,10,994},
+{52300,9,18343},{52303,0,8379},{52304,45,18346},{52316,0,9050},
+{52317,9,18358},{52320,0,9046},{52321,9,18361},{52324,0,9015},
+{52325,29,18364},{52333,0,8185},{52334,41,18372},{52345,0,9043},
+{52346,9,18383},{52349,6,997},{52352,53,18387},{52366,0,7829},
+{52367,17,18401},{52372,10,999},{52375,21,18407},{52381,0,8168},
+{52382,9,18413},{52385,373,3572},{52528,37,23450},{52528,37,24710},
+{52528,37,25970},{52528,37,27230},{52528,37,28490},{52528,37,29591},
+{52544,249,18416},{52608,61,18479},{52624,0,9690},{52625,25,18495},
+{52632,0,9687},{52633,29,18502},{52641,373,3666},{52784,37,23460},
+{52784,37,24720},{52784,37,25980},{52784,37,27240},{52784,37,28500},
+{52784,37,29601},{52800,153,18510},{52839,0,8494},{52840,37,18549},
+{52850,0,8626},{52851,45,18559},{52864,6,1002},{52866,17,18572},
+{52871,0,9692},{52872,73,18577},{52891,0,8300},{52892,5,18596},
+{52894,0,8742},{52895,5,18598},{52897,373,3760},{53040,37,23470},
+{53040,37,24730},{53040,37,25990},{53040,37,27250},{53040,37,28510},
+{53040,37,29611},{53056,53,18600},{53070,0,9696},{53071,21,18614},
+{53077,0,8827},{53078,5,18620},{53080,0,9694},{53081,9,18622},
+{53084,0,9697},{53085,57,18625},{53100,0,9685},{53101,21,18640},
+{53107,10,1004},{53110,5,18647},{53112,0,7817},{53113,9,18649},
+{53116,0,9689},{53117,5,18652},{53120,6,1007},{53122,25,18655},
+{53129,6,1009},{53131,29,18662},{53139,6,1011},{53141,33,18670},
+{53150,10,1013},{53153,373,3854},{53296,37,23480},{53296,37,24740},
+{53296,37,26000},{53296,37,27260},{53296,37,28520},{53296,37,29621},
+{53312,49,18680},{53325,0,7977},{53326,9,18693},{53329,0,7771},
+{53330,9,18696},{53333,0,8310},{53334,21,18699},{53340,0,8855},
+{53341,9,18705},{53344,0,9872},{53345,21,18708},{53351,0,8511},
+{53352,13,18714},{53356,10,1016},{53359,53,18719},{53373,6,1019},
+{53376,129,18734},{53409,373,3948},{53552,37,23490},{53552,37,24750},
+{53552,37,26010},{53552,37,27270},{53552,37,28530},{53552,37,29631},
+{53568,81,18767},{53589,0,9713},{53590,9,18788},{53593,0,8204},
+{53594,25,18791},{53601,6,1021},{53603,69,18798},{53621,0,9895},
+{53622,25,18816},{53629,6,1023},{53632,113,18824},{53661,6,1025},
+{53663,5,18853},{53665,373,4042},{53808,37,23500},{53808,37,24760},
+{53808,37,26020},{53808,37,27280},{53808,37,28540},{53808,37,29641},
+{53824,0,9662},{53825,5,18855},{53827,0,8925},{53828,33,18857},
+{53837,0,9661},{53838,53,18866},{53852,0,7722},{53853,21,18880},
+{53859,6,1027},{53861,9,18886},{53864,0,9663},{53865,13,18889},
+{53869,10,1029},{53872,5,18894},{53874,0,7807},{53875,5,18896},
+{53877,0,8621},{53878,33,18898},{53888,37,18907},{53898,0,8086},
+{53899,9,18917},{53902,0,7986},{53903,9,18920},{53906,0,8324},
+{53907,5,18923},{53909,10,1032},{53912,29,18926},{53920,0,9402},
+{53921,373,4136},{54064,37,23510},{54064,37,24770},{54064,37,26030},
+{54064,37,27290},{54064,37,28550},{54064,37,29651},{54080,13,18934},
+{54084,0,9404},{54085,9,18938},{54088,10,1035},{54091,5,18942},
+{54093,0,9405},{54094,5,18944},{54096,0,9406},{54097,13,18946},
+{54101,0,9407},{54102,5,18950},{54104,0,8146},{54105,5,18952},
+{54107,14,1038},{54111,97,18955},{54136,18,1042},{54141,5,18982},
+{54144,17,18984},{54149,10,1047},{54152,9,18989},{54155,34,1050},
+{54164,5,18996},{54166,22,1059},{54172,5,19000},{54174,10,1065},
+{54177,373,4230},{54320,37,23520},{54320,37,24780},{54320,37,26040},
+{54320,37,27300},{54320,37,28560},{54320,37,29661},{54336,6,1068},
+{54338,9,19004},{54341,10,1070},{54344,13,19008},{54348,0,7922},
+{54349,5,19012},{54351,0,8479},{54352,9,19014},{54355,0,8669},
+{54356,5,19017},{54358,10,1073},{54361,9,19020},{54364,0,8834},
+{54365,17,19023},{54370,0,8934},{54371,13,19028},{54375,0,8936},
+{54376,21,19032},{54382,30,1076},{54390,5,19041},{54392,0,8938},
+{54393,5,19043},{54395,0,8893},{54396,5,19045},{54398,0,7838},
+{54400,5,19047},{54402,10,1084},{54405,5,19049},{54407,0,8503},
+{54408,5,19051},{54410,50,1087},{54423,17,19056},{54428,0,8944},
+{54429,5,19061},{54431,6,1100},{54433,373,4324},{54576,37,23530},
+{54576,37,24790},{54576,37,26050},{54576,37,27310},{54576,37,28570},
+{54576,37,29671},{54592,9,19064},{54595,14,1102},{54599,9,19067},
+{54602,0,8446},{54603,9,19070},{54606,5,8953},{54608,6,1106},
+{54610,5,19074},{54612,10,1108},{54615,9,19077},{54618,42,1111},
+{54629,9,19083},{54632,0,8519},{54633,9,19086},{54636,10,1122},
+{54639,9,19090},{54642,0,8961},{54643,5,19093},{54645,0,7925},
+{54646,5,19095},{54648,0,8728},{54649,5,19097},{54651,0,7878},
+{54652,5,19099},{54654,0,8960},{54656,6,1125},{54658,5,19102},
+{54660,46,1127},{54672,9,19109},{54675,6,1139},{54677,9,19112},
+{54680,14,1141},{54684,9,19116},{54687,6,1145},{54689,373,4418},
+{54832,37,23540},{54832,37,24800},{54832,37,26060},{54832,37,27320},
+{54832,37,28580},{54832,37,29681},{54848,14,1147},{54852,9,19121},
+{54855,14,1151},{54859,5,19125},{54861,10,1155},{54864,5,19128},
+{54866,62,1158},{54882,9,19135},{54885,0,8023},{54886,9,19138},
+{54889,10,1174},{54892,9,19142},{54895,38,1177},{54905,9,19148},
+{54908,0,8710},{54909,5,19151},{54912,9,19153},{54915,0,8973},
+{54916,5,19156},{54918,10,1187},{54921,17,19158},{54926,0,8931},
+{54927,17,19163},{54932,0,8122},{54933,13,19168},{54937,0,8312},
+{54938,25,19172},{54945,373,4512},{55088,37,23550},{55088,37,24810},
+{55088,37,26070},{55088,37,27330},{55088,37,28590},{55088,37,29691},
+{55104,9,19179},{55107,0,8840},{55108,13,19182},{55112,6,1190},
+{55114,21,19186},{55120,26,1192},{55127,49,19194},{55140,0,8984},
+{55141,5,19207},{55143,6,1199},{55145,9,19209},{55148,0,8405},
+{55149,5,19212},{55151,0,8010},{55152,17,19214},{55157,0,8768},
+{55158,5,19219},{55160,0,7891},{55161,21,19221},{55168,9,19227},
+{55171,0,7753},{55172,9,19230},{55175,0,9755},{55176,9,19233},
+{55179,18,1201},{55184,17,19237},{55189,10,1206},{55192,33,19243},
+{55201,353,4606},{55344,37,23560},{55344,37,24820},{55344,37,26080},
+{55344,37,27340},{55344,37,28600},{55344,37,29701},{55360,49,19252},
+{55373,0,8392},{55374,17,19265},{55379,0,7933},{55380,169,19270},
+{55424,61,19313},{55440,22,1209},{55446,13,19330},{55450,26,1215},
+{55457,373,4695},{55600,37,23570},{55600,37,24830},{55600,37,26090},
+{55600,37,27350},{55600,37,28610},{55600,37,29711},{55616,114,1222},
+{55645,21,19342},{55651,18,1251},{55656,13,19349},{55660,54,1256},
+{55674,5,19357},{55676,10,1270},{55680,0,7892},{55681,21,19359},
+{55687,0,8179},{55688,17,19365},{55693,18,1273},{55698,17,19370},
+{55703,6,1278},{55705,5,19375},{55707,22,1280},{55713,373,4789},
+{55856,37,23580},{55856,37,24840},{55856,37,26100},{55856,37,27360},
+{55856,37,28620},{55856,37,29721},{55872,10,1286},{55875,17,19380},
+{55880,0,8509},{55881,13,19385},{55885,6,1289},{55887,141,19389},
+{55923,0,7956},{55924,9,19425},{55927,0,8826},{55928,25,19428},
+{55936,17,19435},{55941,0,8430},{55942,29,19440},{55950,0,9720},
+{55951,69,19448},{55969,373,4883},{56112,37,23590},{56112,37,24850},
+{56112,37,26110},{56112,37,27370},{56112,37,28630},{56112,37,29731},
+{56128,125,19466},{56160,0,8084},{56161,89,19498},{56184,0,8752},
+{56185,21,19521},{56192,13,19527},{56196,0,9725},{56197,21,19531},
+{56203,0,9728},{56204,45,19537},{56216,0,9734},{56217,29,19549},
+{56225,373,4977},{56368,37,23600},{56368,37,24860},{56368,37,26120},
+{56368,37,27380},{56368,37,28640},{56368,37,29741},{56384,17,19557},
+{56389,0,9727},{56390,33,19562},{56399,34,1291},{56408,17,19573},
+{56413,0,9729},{56414,13,19578},{56418,0,9733},{56419,9,19582},
+{56422,6,1300},{56424,9,19585},{56427,0,9735},{56428,61,19588},
+{56444,0,8432},{56445,5,19604},{56448,25,19606},{56455,14,1302},
+{56459,9,19613},{56462,10,1306},{56465,21,19617},{56471,0,9357},
+{56472,9,19623},{56475,0,8450},{56476,13,19626},{56480,0,9364},
+{56481,373,5071},{56624,37,23610},{56624,37,24870},{56624,37,26130},
+{56624,37,27390},{56624,37,28650},{56624,37,29751},{56640,21,19630},
+{56646,0,9363},{56647,21,19636},{56653,0,9358},{56654,17,19642},
+{56659,26,1309},{56666,13,19648},{56670,30,1316},{56678,25,19655},
+{56685,14,1324},{56689,17,19663},{56694,10,1328},{56697,5,9373},
+{56699,13,19668},{56704,10,1331},{56707,5,19673},{56709,6,1334},
+{56711,13,19675},{56715,0,8048},{56716,9,19679},{56719,0,9376},
+{56720,13,19682},{56724,0,8507},{56725,5,19686},{56727,0,7943},
+{56728,5,19688},{56730,6,1336},{56732,5,19690},{56734,10,1338},
+{56737,373,5165},{56880,37,23620},{56880,37,24880},{56880,37,26140},
+{56880,37,27400},{56880,37,28660},{56880,37,29761},{56896,6,1341},
+{56898,5,19693},{56900,0,8872},{56901,9,19695},{56904,6,1343},
+{56906,17,19698},{56911,0,9378},{56912,37,19703},{56922,22,1345},
+{56928,41,19715},{56939,0,7728},{56940,9,19726},{56943,14,1351},
+{56947,45,19729},{56960,69,19741},{56978,0,9851},{56979,45,19759},
+{56991,6,1355},{56993,373,5259},{57136,37,23630},{57136,37,24890},
+{57136,37,26150},{57136,37,27410},{57136,37,28670},{57136,37,29771},
+{57152,10,1357},{57155,37,19773},{57165,0,8123},{57166,53,19783},
+{57180,18,1360},{57185,9,19798},{57188,18,1365},{57193,13,19803},
+{57197,0,8499},{57198,21,19807},{57204,0,7812},{57205,5,19813},
+{57207,30,1370},{57216,0,8021},{57217,5,19818},{57219,10,1378},
+{57222,9,19821},{57225,6,1381},{57227,85,19824},{57249,373,5353},
+{57392,37,23640},{57392,37,24900},{57392,37,26160},{57392,37,27420},
+{57392,37,28680},{57392,37,29781},{57408,61,19846},{57424,0,8990},
+{57425,45,19862},{57437,0,8755},{57438,41,19874},{57449,0,8992},
+{57450,5,19885},{57452,0,8647},{57453,29,19887},{57461,18,1383},
+{57466,17,19897},{57472,25,19902},{57479,0,7867},{57480,17,19909},
+{57485,30,1388},{57493,5,19917},{57495,0,8987},{57496,33,19919},
+{57505,373,5447},{57648,37,23650},{57648,37,24910},{57648,37,26170},
+{57648,37,27430},{57648,37,28690},{57648,37,29791},{57664,5,19928},
+{57666,0,8993},{57667,129,19930},{57700,0,8789},{57701,9,19963},
+{57704,0,7823},{57705,41,19966},{57716,6,1396},{57718,33,19977},
+{57728,13,19986},{57732,22,1398},{57738,5,19992},{57740,6,1404},
+{57742,9,9459},{57745,18,1406},{57750,5,19996},{57752,0,8832},
+{57753,17,19998},{57758,10,1411},{57761,373,5541},{57904,37,23660},
+{57904,37,24920},{57904,37,26180},{57904,37,27440},{57904,37,28700},
+{57904,37,29801},{57920,14,1414},{57924,41,20006},{57935,22,1418},
+{57941,17,20019},{57946,6,1424},{57948,5,20024},{57950,0,9478},
+{57951,9,20026},{57954,6,1426},{57956,9,20029},{57959,18,1428},
+{57964,5,20033},{57966,6,1433},{57968,29,20035},{57976,0,8149},
+{57977,13,20043},{57981,6,1435},{57984,10,1437},{57987,21,20048},
+{57993,10,1440},{57996,5,20055},{57998,6,1443},{58000,5,20057},
+{58002,14,1445},{58006,5,20059},{58008,14,1449},{58012,13,20061},
+{58016,0,9473},{58017,373,5635},{58160,37,23670},{58160,37,24930},
+{58160,37,26190},{58160,37,27450},{58160,37,28710},{58160,37,29811},
+{58176,5,20065},{58178,6,1453},{58180,9,20067},{58183,0,9496},
+{58184,9,20070},{58187,0,7766},{58188,9,20073},{58191,10,1455},
+{58194,5,20077},{58196,6,1458},{58198,5,20079},{58200,0,9488},
+{58201,9,20081},{58204,0,7765},{58205,9,20084},{58208,0,9482},
+{58209,17,20087},{58214,5,9489},{58216,33,20092},{58225,14,1460},
+{58229,9,20102},{58232,6,1464},{58234,5,20105},{58236,10,1466},
+{58240,37,20108},{58250,10,1469},{58253,5,20119},{58255,26,1472},
+{58262,9,20124},{58265,0,9501},{58266,5,20127},{58268,18,1479},
+{58273,373,5729},{58416,37,23680},{58416,37,24940},{58416,37,26200},
+{58416,37,27460},{58416,37,28720},{58416,37,29821},{58432,18,1484},
+{58437,9,20131},{58440,0,9509},{58441,17,20134},{58446,22,1489},
+{58452,13,20141},{58456,26,1495},{58463,9,20148},{58466,0,9513},
+{58467,5,20151},{58469,0,9505},{58470,5,20153},{58472,0,7935},
+{58473,37,20155},{58483,10,1502},{58486,9,20166},{58489,22,1505},
+{58496,6,1511},{58498,5,20171},{58500,18,1513},{58505,13,20173},
+{58509,10,1518},{58512,9,20178},{58515,0,7960},{58516,13,20181},
+{58520,0,9547},{58521,13,20185},{58525,0,9543},{58526,5,9551},
+{58528,0,20189},{58529,373,5823},{58672,37,23690},{58672,37,24950},
+{58672,37,26210},{58672,37,27470},{58672,37,28730},{58672,37,29831},
+{58688,21,20190},{58694,10,1521},{58697,5,20197},{58699,0,9548},
+{58700,5,20199},{58702,14,1524},{58706,9,20201},{58709,14,1528},
+{58713,9,20205},{58716,10,1532},{58719,5,20209},{58721,0,8619},
+{58722,5,20211},{58724,6,1535},{58726,5,20213},{58728,6,1537},
+{58730,5,20215},{58732,10,1539},{58735,21,20218},{58741,14,1542},
+{58745,5,20225},{58747,6,1546},{58749,5,20227},{58752,14,1548},
+{58756,21,20231},{58762,0,9558},{58763,9,20237},{58766,0,8808},
+{58767,5,20240},{58769,0,7894},{58770,29,20242},{58778,6,1552},
+{58780,9,20250},{58783,6,1554},{58785,373,5917},{58928,37,23700},
+{58928,37,24960},{58928,37,26220},{58928,37,27480},{58928,37,28740},
+{58928,37,29841},{58944,0,8412},{58945,9,20254},{58948,0,9561},
+{58949,13,20257},{58953,6,1556},{58955,9,20261},{58958,0,8829},
+{58959,9,20264},{58962,0,9598},{58963,9,20267},{58966,10,1558},
+{58969,5,20271},{58971,0,9566},{58972,5,20273},{58974,0,7732},
+{58975,37,20275},{58985,10,1561},{58988,33,20286},{58997,6,1564},
+{58999,5,20295},{59001,22,1566},{59008,18,1572},{59013,5,20301},
+{59015,10,1577},{59018,5,20304},{59020,0,9569},{59021,21,20306},
+{59027,0,9570},{59028,9,20312},{59031,0,9580},{59032,9,20315},
+{59035,6,1580},{59037,5,20318},{59039,6,1582},{59041,373,6011},
+{59184,37,23710},{59184,37,24970},{59184,37,26230},{59184,37,27490},
+{59184,37,28750},{59184,37,29851},{59200,9,20320},{59203,0,9582},
+{59204,13,20323},{59208,6,1584},{59210,9,20327},{59213,5,9576},
+{59215,26,1586},{59222,9,20332},{59225,0,9757},{59226,45,20335},
+{59238,18,1593},{59243,33,20349},{59252,0,9506},{59253,25,20358},
+{59260,0,9523},{59261,5,20365},{59264,5,20367},{59266,18,1598},
+{59271,9,20370},{59274,6,1603},{59276,9,20373},{59279,0,9584},
+{59280,5,20376},{59282,0,9589},{59283,17,20378},{59288,5,9537},
+{59290,0,9565},{59291,17,20383},{59296,0,8218},{59297,373,6105},
+{59440,37,23720},{59440,37,24980},{59440,37,26240},{59440,37,27500},
+{59440,37,28760},{59440,37,29861},{59456,9,20388},{59459,14,1605},
+{59463,5,20392},{59465,10,1609},{59468,9,20395},{59471,0,9595},
+{59472,13,20398},{59476,0,8867},{59477,17,20402},{59482,10,1612},
+{59485,17,20408},{59490,10,1615},{59493,41,20414},{59504,0,9492},
+{59505,5,20425},{59507,10,1618},{59510,21,20428},{59516,0,9588},
+{59517,5,20434},{59520,10,1621},{59523,13,20437},{59527,10,1624},
+{59530,5,20442},{59532,14,1627},{59536,65,20444},{59553,373,6199},
+{59696,37,23730},{59696,37,24990},{59696,37,26250},{59696,37,27510},
+{59696,37,28770},{59696,37,29871},{59712,45,20461},{59724,0,7797},
+{59725,25,20473},{59732,14,1631},{59736,5,20481},{59738,0,9152},
+{59739,5,20483},{59741,46,1635},{59753,9,20489},{59756,0,8809},
+{59757,29,20492},{59765,18,1647},{59770,5,20501},{59772,10,1652},
+{59776,10,1655},{59779,13,20504},{59783,0,8783},{59784,9,20508},
+{59787,0,9163},{59788,5,20511},{59790,26,1658},{59797,9,20514},
+{59800,0,9168},{59801,5,20517},{59803,22,1665},{59809,373,6293},
+{59952,37,23740},{59952,37,25000},{59952,37,26260},{59952,37,27520},
+{59952,37,28780},{59952,37,29881},{59968,0,8184},{59969,9,20521},
+{59972,0,9171},{59973,9,20524},{59976,10,1671},{59979,17,20527},
+{59984,10,1674},{59987,5,20533},{59989,6,1677},{59991,5,20535},
+{59993,0,9157},{59994,145,20537},{60032,0,8986},{60033,9,20574},
+{60036,0,8468},{60037,5,20577},{60039,0,8836},{60040,21,20579},
+{60046,14,1679},{60050,13,20586},{60054,0,8705},{60055,33,20590},
+{60064,0,7897},{60065,373,6387},{60208,37,23750},{60208,37,25010},
+{60208,37,26270},{60208,37,27530},{60208,37,28790},{60208,37,29891},
+{60224,6,1683},{60226,9,20600},{60229,0,8786},{60230,5,20603},
+{60232,0,8057},{60233,37,20605},{60243,10,1685},{60246,17,20616},
+{60251,10,1688},{60254,5,20622},{60256,10,1691},{60259,37,20625},
+{60269,0,8534},{60270,5,20635},{60272,14,1694},{60276,13,20638},
+{60280,6,1698},{60282,17,20642},{60288,17,20647},{60293,0,8784},
+{60294,13,20652},{60298,0,7875},{60299,85,20656},{60321,373,6481},
+{60464,37,23760},{60464,37,25020},{60464,37,26280},{60464,37,27540},
+{60464,37,28800},{60464,37,29901},{60480,21,20678},{60486,0,8616},
+{60487,57,20684},{60502,0,9741},{60503,9,20699},{60506,10,1700},
+{60509,9,20703},{60512,0,8242},{60513,49,20706},{60526,0,9739},
+{60527,25,20719},{60534,0,8899},{60535,29,20726},{60544,85,20734},
+{60566,0,7971},{60567,37,20756},{60577,373,6575},{60720,37,23770},
+{60720,37,25030},{60720,37,26290},{60720,37,27550},{60720,37,28810},
+{60720,37,29911},{60736,21,20766},{60742,0,9877},{60743,65,20772},
+{60760,0,9822},{60761,17,20789},{60766,0,9821},{60767,5,20794},
+{60769,0,9874},{60770,5,20796},{60772,14,1703},{60776,21,20799},
+{60782,0,8000},{60783,17,20805},{60788,0,9317},{60789,5,20810},
+{60791,10,1707},{60794,17,20813},{60800,65,20818},{60817,62,1710},
+{60833,373,6669},{60976,37,23780},{60976,37,25040},{60976,37,26300},
+{60976,37,27560},{60976,37,28820},{60976,37,29921},{60985,0,22529},
+{60992,18,1726},{60997,9,20840},{61000,6,1731},{61002,9,20843},
+{61005,0,9673},{61006,13,20846},{61010,0,9672},{61011,5,20850},
+{61013,10,1733},{61016,21,20853},{61022,0,8573},{61023,5,20859},
+{61025,0,8062},{61026,21,20861},{61032,6,1736},{61034,5,20867},
+{61036,10,1738},{61039,29,20870},{61047,0,8154},{61048,17,20878},
+{61053,6,1741},{61056,0,9677},{61057,13,20883},{61061,6,1743},
+{61063,9,20887},{61066,14,1745},{61070,5,20891},{61072,0,8200},
+{61073,9,20893},{61076,0,9680},{61077,5,20896},{61079,10,1749},
+{61082,9,20899},{61085,6,1752},{61087,5,20902},{61089,373,6763},
+{61232,37,22530},{61232,37,23790},{61232,37,25050},{61232,37,26310},
+{61232,37,27570},{61232,37,28830},{61232,37,29931},{61248,22,1754},
+{61254,21,20905},{61260,0,7936},{61261,17,20911},{61266,5,9420},
+{61268,14,1760},{61272,5,20918},{61274,0,9422},{61275,17,20920},
+{61280,0,9423},{61281,25,20925},{61288,18,1764},{61293,37,20934},
+{61303,0,7924},{61304,5,20944},{61306,10,1769},{61309,5,20947},
+{61312,5,20949},{61314,0,9117},{61315,5,9119},{61317,14,1772},
+{61321,5,20953},{61323,10,1776},{61326,25,20956},{61333,10,1779},
+{61336,13,20963},{61340,10,1782},{61343,5,20968},{61345,373,6857},
+{61488,37,22540},{61488,37,23800},{61488,37,25060},{61488,37,26320},
+{61488,37,27580},{61488,37,28840},{61488,37,29941},{61504,18,1785},
+{61509,5,20972},{61511,10,1790},{61514,13,20974},{61518,0,8760},
+{61519,5,20978},{61521,0,9125},{61522,5,20980},{61524,0,8090},
+{61525,5,20982},{61527,0,8643},{61528,21,20984},{61534,0,7982},
+{61535,33,20990},{61544,0,9116},{61545,9,20999},{61548,0,9126},
+{61549,13,21002},{61553,14,1793},{61557,9,21007},{61560,10,1797},
+{61563,5,21011},{61565,5,9129},{61568,10,1800},{61571,13,21013},
+{61575,6,1803},{61577,5,21017},{61579,0,9830},{61580,13,21019},
+{61584,10,1805},{61587,9,21024},{61590,0,9133},{61591,37,21027},
+{61601,373,6951},{61744,37,22550},{61744,37,23810},{61744,37,25070},
+{61744,37,26330},{61744,37,27590},{61744,37,28850},{61744,37,29951},
+{61760,69,21037},{61778,10,1808},{61781,5,21055},{61783,14,1811},
+{61787,45,21058},{61799,0,7767},{61800,53,21070},{61814,22,1815},
+{61820,5,21085},{61822,0,9224},{61824,38,1821},{61834,37,21091},
+{61844,0,7999},{61845,9,21101},{61848,0,8295},{61849,29,21104},
+{61857,373,7045},{62000,37,22560},{62000,37,23820},{62000,37,25080},
+{62000,37,26340},{62000,37,27600},{62000,37,28860},{62000,37,29961},
+{62016,17,21112},{62021,10,1831},{62024,9,21118},{62027,0,9231},
+{62028,25,21121},{62035,10,1834},{62038,21,21128},{62044,0,9234},
+{62045,5,21134},{62047,0,8375},{62048,65,21136},{62065,22,1837},
+{62071,17,21155},{62076,10,1843},{62080,17,21160},{62085,18,1846},
+{62090,5,9238},{62092,0,8433},{62093,13,21166},{62097,0,9226},
+{62098,5,21170},{62100,10,1851},{62103,17,21173},{62108,10,1854},
+{62111,5,21179},{62113,373,7139},{62256,37,22570},{62256,37,23830},
+{62256,37,25090},{62256,37,26350},{62256,37,27610},{62256,37,28870},
+{62256,37,29971},{62272,6,1857},{62274,9,21181},{62277,0,8860},
+{62278,5,21184},{62280,14,1859},{62284,13,21187},{62288,0,9228},
+{62289,61,21191},{62305,0,7721},{62306,69,21207},{62324,22,1863},
+{62330,17,21226},{62336,45,21231},{62348,0,9845},{62349,73,21243},
+{62368,0,8524},{62369,373,7233},{62512,37,22580},{62512,37,23840},
+{62512,37,25100},{62512,37,26360},{62512,37,27620},{62512,37,28880},
+{62512,37,29981},{62528,17,21262},{62533,0,9850},{62534,37,21267},
+{62544,0,9888},{62545,21,21277},{62551,26,1869},{62558,13,21286},
+{62562,10,1876},{62565,61,21291},{62581,0,9829},{62582,21,21307},
+{62588,10,1879},{62592,77,21314},{62612,0,8266},{62613,13,21334},
+{62617,0,9759},{62618,5,21338},{62620,0,9758},{62621,13,21340},
+{62625,373,7327},{62768,37,22590},{62768,37,23850},{62768,37,25110},
+{62768,37,26370},{62768,37,27630},{62768,37,28890},{62768,37,29991},
+{62784,17,21344},{62789,10,1882},{62792,37,21350},{62802,18,1885},
+{62807,25,21361},{62814,0,9769},{62815,5,21368},{62817,6,1890},
+{62819,41,21370},{62830,18,1892},{62835,45,21382},{62848,17,21394},
+{62853,6,1897},{62855,17,21399},{62860,14,1899},{62864,33,21405},
+{62873,10,1903},{62876,13,21415},{62880,0,9795},{62881,373,7421},
+{63024,37,22600},{63024,37,23860},{63024,37,25120},{63024,37,26380},
+{63024,37,27640},{63024,37,28900},{63024,37,30001},{63040,6,1906},
+{63042,9,21420},{63045,14,1908},{63049,5,21424},{63051,10,1912},
+{63054,5,9787},{63056,13,21427},{63060,0,9794},{63061,9,21431},
+{63064,0,9796},{63065,29,21434},{63073,10,1915},{63076,29,21443},
+{63084,6,1918},{63086,9,21451},{63089,0,9801},{63090,5,21454},
+{63092,14,1920},{63096,25,21457},{63104,17,21464},{63109,0,9805},
+{63110,5,21469},{63112,10,1924},{63115,5,21472},{63117,6,1927},
+{63119,9,21474},{63122,0,9807},{63123,9,21477},{63126,42,1929},
+{63137,373,7515},{63280,37,22610},{63280,37,23870},{63280,37,25130},
+{63280,37,26390},{63280,37,27650},{63280,37,28910},{63280,37,30011},
+{63296,5,21484},{63298,0,9812},{63299,21,21486},{63305,0,9816},
+{63306,5,21492},{63308,6,1940},{63310,29,21494},{63318,26,1942},
+{63325,13,21504},{63329,10,1949},{63332,25,21509},{63339,0,9820},
+{63340,17,21516},{63345,0,9772},{63346,37,21521},{63356,10,1952},
+{63360,129,21532},{63393,373,7609},{63536,37,22620},{63536,37,23880},
+{63536,37,25140},{63536,37,26400},{63536,37,27660},{63536,37,28920},
+{63536,37,30021},{63552,5,21565},{63554,0,8348},{63555,9,21567},
+{63558,0,9600},{63559,5,21570},{63561,0,8924},{63562,21,21572},
+{63568,14,1955},{63572,57,21579},{63587,14,1959},{63591,41,21595},
+{63602,0,8578},{63603,17,21606},{63608,18,1963},{63613,5,21613},
+{63616,6,1968},{63618,5,21616},{63620,10,1970},{63623,21,21619},
+{63629,6,1973},{63631,37,21625},{63641,0,8007},{63642,9,21635},
+{63645,0,7965},{63646,5,21638},{63648,0,9613},{63792,37,22630},
+{63792,37,23890},{63792,37,25150},{63792,37,26410},{63792,37,27670},
+{63792,37,28930},{63792,37,30031},{63808,53,21640},{63822,10,1975},
+{63825,29,21654},{63833,6,1978},{63835,5,21662},{63837,6,1980},
+{63839,29,21664},{63847,10,1982},{63850,5,21673},{63852,0,9624},
+{63853,5,21675},{63855,0,8438},{63856,57,21677},{63872,17,21692},
+{63877,10,1985},{63880,33,21698},{63889,0,9622},{63890,13,21707},
+{63894,10,1988},{63897,29,21712},{64048,37,22640},{64048,37,23900},
+{64048,37,25160},{64048,37,26420},{64048,37,27680},{64048,37,28940},
+{64048,37,30041},{64064,5,21720},{64066,0,9629},{64067,9,21722},
+{64070,0,9630},{64071,17,21725},{64076,0,9036},{64077,13,21730},
+{64081,0,8004},{64082,21,21734},{64088,6,1991},{64090,9,21740},
+{64093,18,1993},{64098,53,21745},{64112,0,9634},{64113,9,21759},
+{64116,14,1998},{64120,25,21763},{64128,9,21770},{64131,6,2002},
+{64133,29,21773},{64141,0,9636},{64142,5,21781},{64144,6,2004},
+{64146,13,21783},{64150,10,2006},{64153,29,21787},{64304,37,22650},
+{64304,37,23910},{64304,37,25170},{64304,37,26430},{64304,37,27690},
+{64304,37,28950},{64304,37,30051},{64320,33,21795},{64329,0,9640},
+{64330,29,21804},{64338,0,9606},{64339,13,21812},{64343,18,2009},
+{64348,97,21817},{64373,0,9864},{64374,9,21842},{64377,22,2014},
+{64384,61,21847},{64400,0,8207},{64401,41,21863},{64412,0,8305},
+{64413,5,21874},{64415,6,2020},{64560,37,22660},{64560,37,23920},
+{64560,37,25180},{64560,37,26440},{64560,37,27700},{64560,37,28960},
+{64560,37,30061},{64576,13,21877},{64580,0,9878},{64581,13,21881},
+{64585,0,9871},{64586,61,21885},{64602,0,8922},{64603,29,21901},
+{64611,0,7873},{64612,13,21909},{64616,0,7859},{64617,21,21913},
+{64623,10,2022},{64626,5,21920},{64628,0,9833},{64629,5,21922},
+{64631,5,9752},{64633,21,21924},{64640,9,21930},{64643,0,9754},
+{64644,21,21933},{64650,0,9843},{64651,85,21939},{64816,37,22670},
+{64816,37,23930},{64816,37,25190},{64816,37,26450},{64816,37,27710},
+{64816,37,28970},{64816,37,30071},{64824,5,22428},{64832,69,21961},
+{64850,6,2025},{64852,9,21979},{64855,14,2027},{64859,13,21983},
+{64863,0,9745},{64864,5,21987},{64866,0,9747},{64867,5,21989},
+{64869,18,2031},{64874,5,21992},{64876,0,9748},{64877,9,21994},
+{64880,10,2036},{64883,17,21998},{64888,0,8434},{64889,13,22003},
+{64893,6,2039},{64896,29,22008},{64904,0,8247},{64905,5,22016},
+{64907,0,8371},{64908,9,22018},{64911,6,2041},{64913,9,22021},
+{64916,0,7988},{64917,29,22024},{64925,14,2043},{65072,37,22430},
+{65072,37,22680},{65072,37,23940},{65072,37,25200},{65072,37,26460},
+{65072,37,27720},{65072,37,28980},{65072,37,30081},{65088,0,4697},
+{65089,245,22032},{65152,129,22094},
+};
+
+static const unsigned short cmap_GBK2K_H_table[2047] = {
+7778,10315,7781,8833,8909,10407,8458,7742,7830,8907,8812,10424,
+8471,10428,8424,8108,8915,8720,10474,8911,10475,8723,10476,8164,
+8912,8910,8919,8917,8913,8906,7833,8143,8246,7994,10676,8905,
+8089,7885,10719,8617,10720,8678,10721,8487,8195,8901,8030,10771,
+8902,8208,10831,8898,8459,11063,8414,11064,7850,8408,8896,8368,
+11113,9082,7796,9080,8655,9064,11125,9073,11126,9065,9072,11153,
+11154,9078,9075,9087,11158,9076,11159,8373,7899,9842,9067,11193,
+8249,9085,8693,11202,9089,9083,9086,8652,9066,9865,11214,9879,
+9091,7997,11247,8591,8774,8776,8574,11254,8576,8709,7736,8163,
+9017,11440,9003,11441,9005,8615,11453,9007,8409,11517,8157,8199,
+8998,9001,8018,8251,9000,11540,8999,11590,8060,9051,7902,11614,
+8098,11615,7930,4162,4707,4722,4709,4185,10131,1597,4867,9210,
+11898,9214,8104,1592,3270,982,4765,4884,4879,2091,5017,1431,
+8421,12017,8495,8355,8481,12018,8660,8165,7818,7735,8094,8870,
+8680,12032,7898,7865,8272,7783,12074,9204,4860,4710,4740,10778,
+3397,1150,4946,1228,5020,9097,12165,7863,9105,12268,8817,2407,
+5523,3698,3414,5660,11565,3859,1398,2927,9104,12313,8243,12314,
+8764,8277,12333,9106,8837,12387,9092,9095,9094,8848,12406,7748,
+7730,9093,7955,8051,1386,3948,5302,3395,6004,3318,6165,1789,
+8327,7800,9134,7926,7985,9205,12521,8821,9838,12534,7856,8323,
+12538,8584,7841,12575,9107,2238,1732,6163,1852,5016,5293,5366,
+1798,5986,9140,8318,8341,9147,7720,9149,5600,3983,1765,12946,
+3437,4518,6409,3795,1526,7774,12819,7773,7983,9439,9138,8526,
+9148,12833,8427,8219,8380,9150,8329,12871,9137,8158,8739,9142,
+9868,9438,8190,8017,8673,12922,9136,12923,8142,12924,8478,8225,
+8819,12944,8624,1626,3821,3248,4350,4357,2849,3124,4536,1400,
+8476,13097,9053,8461,8282,3826,1073,2736,3430,3095,3491,2053,
+4611,1715,9057,13234,8256,9054,13252,7786,7852,7764,8384,9058,
+8544,13288,8605,8078,8749,13289,8263,13290,8802,8039,7858,5789,
+3019,4073,2916,3209,4041,4310,1832,3728,7762,8356,7964,8847,
+13314,8173,7725,8530,9062,13319,8442,9059,13324,8346,8182,13335,
+9060,13336,7785,13337,9063,13338,8477,8793,8278,8547,8105,8188,
+7868,13388,8514,8222,7747,3379,4264,3650,7110,7008,16063,994,
+3011,2808,8790,9384,9383,13593,9862,9382,13594,8654,2737,3407,
+3398,3413,16587,1923,4049,2539,4592,7399,7262,3753,4123,4309,
+2490,1591,7115,1593,8565,13863,9325,9323,8799,3261,1249,4657,
+4544,2297,3353,5656,4570,7388,9320,14046,8448,14058,9334,7975,
+8407,8874,8197,8387,8512,9335,17826,7152,1291,4051,3995,4169,
+18908,8086,2200,8040,14171,8581,8075,9348,9344,9326,14266,9339,
+9350,9329,9347,9328,14274,9321,14275,9343,1825,1528,7445,7504,
+7739,1285,4668,4672,3366,9419,14362,8019,8211,7987,9353,9355,
+8463,8155,8394,14468,8423,9410,3980,1250,19731,4191,4276,19992,
+2522,2241,7797,1714,2542,7545,4303,20714,1636,2795,1770,8589,
+8772,9186,14706,8404,7779,8328,7869,14840,9025,4219,8713,7936,
+7924,3402,3438,3920,8301,1824,8264,9184,8311,14865,8762,8001,
+8220,8095,14903,9674,14904,9185,8172,9187,8462,8102,8196,8886,
+8361,8557,15007,7660,7888,5019,4704,1862,8761,8348,9864,2656,
+8593,7760,8092,15023,9178,15024,8275,9193,9188,8661,15033,9190,
+8212,15045,9196,9195,9176,9198,9870,15058,9197,9174,9192,8585,
+8280,2704,21894,3465,1937,6741,9752,1509,1821,3466,8473,15342,
+8390,7814,8247,7988,4851,8124,15370,9434,8712,15414,7910,22390,
+22392,22391,22393,8630,7741,8757,15560,9111,8767,8490,7890,15595,
+9110,9112,15596,8354,15597,8235,15600,9108,8505,15601,8543,8641,
+9114,8741,8298,7937,8704,9650,7831,16025,8363,8232,16038,16040,
+9649,8706,9643,8838,16057,9645,16058,9654,16059,8675,8751,8549,
+9655,7717,16083,9664,16107,8858,8814,16126,8125,16127,8068,8370,
+16128,8259,16205,9455,9445,16366,8698,9446,8439,16413,8299,16471,
+7826,9447,8210,7916,8038,9436,8206,16581,9435,7864,9764,8041,
+8747,9599,8027,8603,16704,9853,8608,8582,16738,8429,7844,8417,
+16756,9656,8800,16757,8418,8868,16912,9704,9706,16970,8079,16971,
+9708,8400,8221,16992,9710,8250,9701,9709,17024,8201,17025,8293,
+9717,7932,9883,17108,9715,17109,8921,17110,9716,17111,9243,8136,
+17115,8059,17116,9245,17117,8780,8008,9244,8447,8602,17118,8337,
+9251,7835,9250,17123,8464,17124,8845,8049,7928,9249,8625,9254,
+9253,8480,8474,9252,17143,9256,9258,9257,17146,8852,17147,8894,
+17148,7729,9260,17156,8117,9259,8111,8296,8676,7969,17174,8449,
+8572,8522,9261,17184,8145,7731,17192,9263,9262,17195,9264,8667,
+8889,17212,9270,7822,9273,8645,9271,8594,17222,9274,7961,8588,
+7744,8883,8287,9272,9266,8820,17226,7836,9265,8325,8119,9267,
+8276,8670,17240,9268,9277,8073,9276,8046,7896,17246,7871,9285,
+17247,8777,9281,17250,7751,8022,8598,17255,9283,9279,17256,8227,
+17257,9282,9278,17260,9038,9286,9291,9284,9255,9292,7951,17286,
+9287,9289,9288,7939,17296,9290,8540,8891,9296,17299,9876,9295,
+9718,8273,17300,9294,8890,8045,9298,9297,9301,17318,8841,8470,
+8486,8033,9885,17335,8074,9302,9305,9304,8058,9293,9303,9299,
+17353,9248,17354,8671,9861,17355,7790,8740,9840,17359,8634,17360,
+9306,9698,17392,9882,8290,9457,17425,9458,9666,17520,9665,8488,
+17542,8215,7840,8485,8525,17561,9668,8349,8842,17562,9667,17712,
+8345,7853,9416,8360,8223,17732,8389,17733,9418,8176,17742,9414,
+8797,8926,8763,8665,8139,8137,9711,17818,8088,17821,9712,18004,
+8013,9031,18078,8595,9037,9032,7776,18133,9029,8216,9013,9028,
+9009,18228,9035,18229,9019,7860,8614,9022,18259,8052,18260,9008,
+8081,18279,8455,8180,9027,8788,18333,9010,7718,9047,9048,8258,
+8531,8289,18386,8265,18406,8002,18571,8606,7787,18646,9691,18654,
+8721,8745,9686,9693,9695,8175,18679,9688,8600,18718,7816,8844,
+18733,7768,8876,9846,18823,8161,9659,9660,9658,8583,18893,9835,
+8502,18925,9400,8420,18941,9401,8189,18954,9403,7981,9737,18980,
+9738,18981,7828,8927,7883,7949,8055,18992,8683,18993,8929,18994,
+8559,18995,8928,8682,18998,8930,8395,18999,8056,7906,19002,8690,
+19003,8528,8147,19007,8933,8532,19019,8935,8932,19038,8810,19039,
+8939,19040,8937,8381,8950,8679,8726,8492,19053,7784,8946,7991,
+8947,19054,8943,8016,7952,8648,19055,8945,8942,19063,8941,8862,
+8940,8162,19073,7855,8758,19076,8951,8765,19080,7810,8118,19081,
+8612,8618,8952,8529,19082,8032,8517,19089,8156,19101,8884,8553,
+19104,8957,19105,8426,19106,8948,19107,8955,19108,8956,8231,8288,
+8959,8958,7879,19115,8972,8949,19119,8966,19120,8970,8659,8963,
+19124,8967,8971,8031,19127,8969,8962,7940,8861,19130,8699,19131,
+8968,19132,8364,19133,8334,8965,8599,19134,8561,8856,8322,19141,
+8977,8964,19145,8975,7733,19146,8401,8976,8099,19147,8662,8978,
+8333,8979,8982,8043,8980,19192,8496,8981,8552,19193,8388,8729,
+8727,7789,8440,19236,8187,8985,8974,19242,8983,7739,8831,19329,
+7948,7769,7972,8378,8037,7920,8548,7984,8801,19334,19335,8866,
+9387,19336,9391,7912,7993,19337,7752,8304,7848,19338,9388,7927,
+8566,9389,19339,8315,8005,9386,8267,8239,8026,9392,19340,8887,
+8063,19341,8805,9394,8475,7761,19348,9396,9395,19353,7839,19354,
+8472,19355,8372,9135,8635,8306,8085,19356,7946,9398,8849,9397,
+8824,8873,9399,7976,8457,8903,9390,8881,8806,19377,8795,8900,
+19378,8469,19379,8746,9393,7957,8796,9724,7820,9730,19571,8781,
+19572,9732,9726,9731,7843,9736,7803,8807,7990,8150,8672,19616,
+9356,8857,9361,9366,9359,9362,19647,9367,8113,19652,9370,19653,
+9369,19654,8792,9368,9371,19662,7945,8422,8230,9375,8025,19672,
+7995,9372,7738,8283,8816,8759,9426,19692,8627,8773,9377,8828,
+8112,8006,19713,9088,9365,19714,9360,7837,7755,7754,8362,9202,
+19771,8830,19772,8217,8787,19797,7998,7846,8590,8684,19801,7870,
+19802,8778,8399,8674,19815,8719,19816,8233,19817,8307,9201,19820,
+7750,8291,9203,8892,19895,8988,19896,8785,8839,19914,8237,7851,
+19915,8989,19916,8991,8716,8100,8347,8664,19990,9722,19991,9721,
+8500,19994,9464,19995,9463,7880,9462,7877,9467,20003,20004,9466,
+20005,7917,9469,20017,9465,20018,9470,8397,9480,9476,9471,8336,
+7901,7973,20032,9475,9474,7802,8358,7953,20047,9479,9472,9477,
+9497,20054,9493,9484,8241,9483,9487,9498,9481,9486,8756,9491,
+8064,9495,9494,9485,20076,8403,8314,8398,8106,20101,9502,7967,
+9517,8733,9522,20107,8571,8623,20118,9516,9512,20121,8332,20122,
+9519,20123,8636,9525,20129,8717,9510,20130,9524,9514,9503,9521,
+9500,8653,20139,8666,20140,8562,9534,8271,20145,9539,20146,8663,
+20147,7740,9535,20165,9540,9507,7824,9530,9541,20169,9533,20170,
+8385,8451,9504,9532,9531,9528,9536,20177,8141,8880,20196,9542,
+7834,9554,9520,9545,9553,7882,20204,8402,8120,20208,8313,9549,
+7845,8268,8320,9837,20217,9527,9546,8632,20224,9550,9468,9556,
+20229,7996,20230,7893,9559,9555,9544,20253,8087,9557,8316,20270,
+9562,8542,20285,9568,8610,9044,9571,9511,20297,9518,9560,20298,
+7963,20299,8835,20300,9572,8352,20303,9573,9581,8224,9567,9578,
+9529,9564,9579,7791,20330,8132,9575,20331,9563,9515,20347,9585,
+20348,9591,8234,20369,9526,9587,9583,8851,9592,9594,8198,20391,
+8567,9499,20394,9508,9593,20407,9574,8083,20413,9596,9597,20427,
+9586,8782,20436,8646,8351,20441,9590,8292,8895,9756,8798,8317,
+20480,9151,8467,7749,20485,8152,9156,20486,9154,8452,20487,8637,
+20488,8071,9155,8003,20500,7966,9849,7915,7989,8330,20503,9159,
+9161,9158,8691,20513,8695,9167,9166,9162,9165,9836,20519,9153,
+20520,8174,9169,9170,9172,7832,7980,20532,9173,7793,9873,8732,
+20585,7806,8269,20599,8114,8535,20615,8639,8735,20621,8253,8213,
+20624,9893,8516,20637,7825,8791,8202,8338,9740,20702,9742,9823,
+20798,8589,8445,9319,20812,9318,8649,20835,8713,7881,8425,20836,
+8650,8518,9669,8668,20837,9310,20838,8527,20839,9670,9671,8769,
+8586,7727,7900,8383,8244,8718,20852,9675,9676,8131,8377,20869,
+8577,8563,7905,9678,8694,8779,9681,20890,7872,9682,20898,7978,
+7794,9683,8638,9684,8260,20904,9679,8435,20916,9880,20917,9848,
+8376,20932,9424,20933,9425,9115,20946,9854,20951,9121,20952,7921,
+8734,20955,9122,8523,7734,8501,8109,20967,7763,20970,9123,8707,
+20971,7911,9124,8343,7908,9118,21006,8245,9127,9128,21010,8309,
+9131,8171,9132,8042,8441,9831,21023,7788,8301,8770,7938,8579,
+21057,7813,8681,8869,9223,8138,21084,9218,8066,9220,21087,8497,
+21088,8580,21089,9219,21090,8302,9227,8151,21117,7811,9230,8391,
+9229,9200,21153,9233,9236,21154,8560,9221,8460,9237,8294,21165,
+9042,9235,9232,9225,21172,9240,8103,21178,8700,8129,9222,8270,
+21186,9242,9241,9825,21225,9892,8564,9827,9826,9832,21283,7888,
+21284,8342,21285,9164,9160,21290,8766,9828,21313,8761,9760,21349,
+9761,9762,21360,9767,7737,9765,9774,9771,9770,9773,21381,9768,
+8633,9782,9776,9784,21404,8205,9783,9797,21414,9786,21419,9792,
+9789,9793,21423,9790,9791,8128,21426,9785,21442,9804,9799,9803,
+9800,21456,9802,8456,9780,21471,9809,9808,9810,9778,9806,9811,
+21480,9815,21481,9781,21482,9779,21483,9814,9813,7757,9819,21502,
+9818,21503,9817,8238,9775,9798,21508,9766,9763,21531,9777,7941,
+8331,21578,9601,9603,9602,21594,8686,8771,21611,9607,21612,9608,
+21615,9604,8701,21618,8687,9610,9612,8144,9618,9615,9620,7904,
+9617,9621,9623,21672,8374,9605,21697,9625,9626,21711,9627,9824,
+9632,9628,21743,9631,21744,8044,8366,21762,9611,9635,9609,9637,
+9638,9619,9639,8738,9641,9633,9642,21816,9616,9614,9886,9723,
+21845,8076,8692,21846,9719,21876,9834,21919,9866,8390,8811,9427,
+7814,21982,9743,9744,9746,8240,21991,9841,9750,21997,9749,9751,
+22007,7970,9453,2562,16595,8204,20611,
+};
+
+static pdf_cmap cmap_GBK2K_H = {
+	-1, "GBK2K-H", "", 0, 0, 3,
+	{ {1,0,127},{4,33072,65081},{2,33088,65278}, },
+	3558, 3558, (pdf_range*) cmap_GBK2K_H_ranges,
+	2047, 2047, (unsigned short*) cmap_GBK2K_H_table,
+};
+
+/* GBK2K-V */
+
+static const pdf_range cmap_GBK2K_V_ranges[] = {
+{41378,6,0},{41386,0,598},{41387,5,7704},{41389,0,599},
+{41394,53,582},{41470,0,7706},{41889,0,578},{41896,5,580},
+{41900,0,573},{41902,0,7707},{41914,5,576},{41917,0,7708},
+{41919,0,579},{41947,0,7709},{41949,0,7710},{41951,0,600},
+{41979,0,596},{41981,6,2},{42145,0,22359},{42147,0,22361},
+{42149,0,22370},{42151,0,22360},{42153,0,22368},{42179,0,22369},
+{42211,0,22372},{42213,0,22374},{42215,0,22373},{42222,0,22371},
+{42401,0,22376},{42403,0,22378},{42405,0,22385},{42407,0,22377},
+{42409,0,22383},{42435,0,22384},{42467,0,22387},{42469,0,22389},
+{42471,0,22388},{42478,0,22386},{43360,0,22394},
+};
+
+static const unsigned short cmap_GBK2K_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GBK2K_V = {
+	-1, "GBK2K-V", "GBK2K-H", 0, 1, 0,
+	{ {0,0,0}, },
+	39, 39, (pdf_range*) cmap_GBK2K_V_ranges,
+	4, 4, (unsigned short*) cmap_GBK2K_V_table,
+};
+
+/* GBKp-EUC-H */
+
+static const pdf_range cmap_GBKp_EUC_H_ranges[] = {
+{32,377,1},{33088,225,10072},{33145,0,8281},{33146,17,10129},
+{33152,21,10134},{33158,0,8689},{33159,405,10140},{33261,0,8178},
+{33262,29,10242},{33270,0,8285},{33271,29,10250},{33344,73,10258},
+{33363,0,9884},{33364,53,10277},{33378,0,8629},{33379,65,10291},
+{33396,0,8908},{33397,17,10308},{33402,0,8214},{33403,5,10313},
+{33405,6,0},{33408,0,7968},{33409,5,10316},{33411,0,8319},
+{33412,45,10318},{33424,0,8284},{33425,77,10330},{33445,0,8596},
+{33446,133,10350},{33480,6,2},{33482,89,10384},{33505,14,4},
+{33509,29,10408},{33517,0,9855},{33518,13,10416},{33522,0,8750},
+{33523,13,10420},{33527,18,8},{33532,9,10425},{33600,6,13},
+{33602,9,10429},{33605,0,8916},{33606,5,10432},{33608,0,8121},
+{33609,9,10434},{33612,0,8920},{33613,21,10437},{33619,0,8415},
+{33620,9,10443},{33623,0,8386},{33624,21,10446},{33630,0,8597},
+{33631,21,10452},{33637,6,15},{33639,41,10458},{33650,0,8065},
+{33651,17,10469},{33656,26,17},{33664,0,8080},{33665,17,10477},
+{33670,0,8918},{33671,5,10482},{33673,6,24},{33675,5,10484},
+{33677,0,9857},{33678,21,10486},{33684,0,7798},{33685,33,10492},
+{33694,0,8753},{33695,25,10501},{33702,0,7827},{33703,13,10508},
+{33707,0,8914},{33708,5,10512},{33710,10,26},{33713,33,10514},
+{33722,0,7909},{33723,53,10523},{33737,0,8229},{33738,173,10537},
+{33782,0,7887},{33783,29,10581},{33856,61,10589},{33872,0,8153},
+{33873,125,10605},{33905,0,8904},{33906,5,10637},{33908,0,8803},
+{33909,5,10639},{33911,0,9859},{33912,25,10641},{33920,5,10648},
+{33922,0,7959},{33923,41,10650},{33934,0,7979},{33935,9,10661},
+{33938,6,29},{33940,33,10664},{33949,0,8015},{33950,9,10673},
+{33953,22,31},{33959,5,10677},{33961,0,8053},{33962,105,10679},
+{33989,0,8126},{33990,49,10706},{34003,30,37},{34011,5,10722},
+{34013,0,8498},{34014,45,10724},{34026,0,8995},{34027,9,10736},
+{34030,0,8209},{34031,5,10739},{34033,0,8437},{34034,49,10741},
+{34112,65,10754},{34129,14,45},{34133,33,10772},{34142,0,8431},
+{34143,25,10781},{34150,0,8656},{34151,93,10788},{34176,25,10812},
+{34183,0,8897},{34184,9,10819},{34187,0,7780},{34188,21,10822},
+{34194,0,8697},{34195,9,10828},{34198,10,49},{34201,33,10832},
+{34210,0,7770},{34211,57,10841},{34226,0,7842},{34227,301,10856},
+{34368,37,10932},{34378,0,9069},{34379,33,10942},{34388,0,8775},
+{34389,73,10951},{34408,0,9068},{34409,85,10970},{34432,85,10992},
+{34454,0,8604},{34455,5,11014},{34457,0,8393},{34458,25,11016},
+{34465,0,8688},{34466,157,11023},{34506,18,52},{34511,5,11065},
+{34513,0,8748},{34514,37,11067},{34524,6,57},{34526,9,11077},
+{34529,0,8303},{34530,21,11080},{34536,0,8609},{34537,17,11086},
+{34542,0,9081},{34543,17,11091},{34548,0,9074},{34549,37,11096},
+{34624,0,8554},{34625,9,11106},{34628,0,9084},{34629,13,11109},
+{34633,14,59},{34637,5,11114},{34639,0,9079},{34640,25,11116},
+{34647,0,8012},{34648,5,11123},{34650,26,63},{34657,17,11127},
+{34662,0,9844},{34663,73,11132},{34682,0,9071},{34683,5,11151},
+{34685,6,70},{34688,10,72},{34691,9,11155},{34694,18,75},
+{34699,5,11160},{34701,6,80},{34703,13,11162},{34707,0,9070},
+{34708,13,11166},{34712,0,8631},{34713,13,11170},{34717,0,9077},
+{34718,17,11174},{34723,0,9090},{34724,9,11179},{34727,0,8350},
+{34728,41,11182},{34739,10,82},{34742,17,11194},{34747,0,9887},
+{34748,9,11199},{34751,14,85},{34755,25,11203},{34762,10,89},
+{34765,5,11210},{34767,0,8923},{34768,5,11212},{34770,14,92},
+{34774,13,11215},{34778,0,8865},{34779,109,11219},{34807,14,96},
+{34811,13,11248},{34880,6,100},{34882,5,11252},{34884,10,102},
+{34887,221,11255},{34944,229,11311},{35002,0,9002},{35003,65,11369},
+{35020,0,8843},{35021,25,11386},{35028,0,8069},{35029,5,11393},
+{35031,0,8997},{35032,25,11395},{35039,0,9004},{35040,17,11402},
+{35045,0,9006},{35046,45,11407},{35058,6,105},{35060,5,11419},
+{35062,0,7795},{35063,29,11421},{35136,41,11429},{35147,22,107},
+{35153,9,11442},{35156,0,8575},{35157,29,11445},{35165,10,113},
+{35168,49,11454},{35181,0,7805},{35182,9,11467},{35185,0,8406},
+{35186,37,11470},{35196,0,7874},{35197,5,11480},{35200,41,11482},
+{35211,0,8882},{35212,49,11493},{35225,0,7903},{35226,13,11506},
+{35230,0,7929},{35231,25,11510},{35238,10,116},{35241,21,11518},
+{35247,0,8551},{35248,37,11524},{35258,0,8685},{35259,9,11534},
+{35262,10,119},{35265,9,11537},{35268,18,122},{35273,17,11541},
+{35278,0,7723},{35279,5,11546},{35281,0,8878},{35282,21,11548},
+{35288,0,8009},{35289,5,11554},{35291,0,8504},{35292,93,11556},
+{35316,0,8321},{35317,37,11580},{35392,6,127},{35394,89,11591},
+{35417,22,129},{35423,101,11616},{35449,0,8877},{35450,17,11642},
+{35456,397,11647},{35556,0,8255},{35557,101,11747},{35648,13,11773},
+{35652,0,7950},{35653,13,11777},{35657,0,9209},{35658,189,11781},
+{35706,0,9212},{35707,13,11829},{35712,45,11833},{35724,0,8297},
+{35725,65,11845},{35742,0,9207},{35743,77,11862},{35763,0,9206},
+{35764,17,11882},{35769,0,9213},{35770,13,11887},{35774,0,9208},
+{35775,25,11891},{35782,14,135},{35786,37,11899},{35796,0,9217},
+{35797,25,11909},{35804,0,9215},{35805,29,11916},{35813,0,9216},
+{35814,17,11924},{35819,0,8737},{35820,13,11929},{35824,0,8482},
+{35825,53,11933},{35904,13,11947},{35908,0,9211},{35909,37,11951},
+{35919,0,8538},{35920,25,11961},{35927,0,8677},{35928,13,11968},
+{35932,0,8279},{35933,133,11972},{35968,41,12006},{35979,30,139},
+{35987,21,12019},{35993,6,147},{35995,25,12025},{36002,22,149},
+{36008,93,12033},{36032,0,9052},{36033,65,12057},{36050,14,155},
+{36054,9,12075},{36057,0,8510},{36058,121,12078},{36089,0,7958},
+{36090,17,12109},{36160,201,12114},{36211,10,159},{36214,17,12166},
+{36219,0,8628},{36220,9,12171},{36224,29,12174},{36232,0,9103},
+{36233,21,12182},{36239,0,7962},{36240,53,12188},{36254,0,9099},
+{36255,101,12202},{36281,0,9098},{36282,157,12228},{36322,10,162},
+{36325,5,12269},{36327,0,9096},{36328,57,12271},{36343,0,9102},
+{36344,21,12286},{36350,0,9101},{36416,21,12292},{36422,0,9100},
+{36423,57,12298},{36438,18,165},{36443,49,12315},{36456,0,8169},
+{36457,17,12328},{36462,10,170},{36465,53,12334},{36480,0,8996},
+{36481,101,12348},{36507,0,8515},{36508,9,12374},{36511,0,8489},
+{36512,13,12377},{36516,0,8823},{36517,5,12381},{36519,0,7847},
+{36520,13,12383},{36524,10,173},{36527,53,12388},{36541,6,176},
+{36543,13,12402},{36547,10,178},{36550,25,12407},{36557,6,181},
+{36559,25,12414},{36566,6,183},{36568,77,12421},{36588,0,8160},
+{36589,69,12441},{36672,69,12459},{36690,18,185},{36695,21,12477},
+{36701,0,8261},{36702,21,12483},{36708,0,8568},{36709,101,12489},
+{36736,21,12515},{36742,10,190},{36745,45,12522},{36757,10,193},
+{36760,9,12535},{36763,10,196},{36766,9,12539},{36769,0,9852},
+{36770,105,12542},{36797,0,8133},{36798,21,12569},{36804,10,199},
+{36807,21,12576},{36813,0,7947},{36814,37,12582},{36824,0,7804},
+{36825,149,12592},{36928,249,12630},{36992,113,12693},{37021,6,202},
+{37023,105,12722},{37050,0,7907},{37051,17,12749},{37056,6,204},
+{37058,9,12754},{37061,0,9145},{37062,81,12757},{37083,6,206},
+{37085,61,12778},{37101,0,9141},{37102,5,12794},{37104,0,9146},
+{37105,21,12796},{37111,0,9139},{37112,25,12802},{37184,5,12809},
+{37186,0,8546},{37187,29,12811},{37195,10,208},{37198,9,12820},
+{37201,0,9143},{37202,5,12823},{37204,6,211},{37206,9,12825},
+{37209,6,213},{37211,5,12828},{37213,0,8274},{37214,9,12830},
+{37217,10,215},{37220,37,12834},{37230,0,8754},{37231,25,12844},
+{37238,0,7743},{37239,9,12851},{37242,10,218},{37245,5,12854},
+{37248,13,12856},{37252,0,7854},{37253,29,12860},{37261,0,7931},
+{37262,9,12868},{37265,10,221},{37268,9,12872},{37271,0,8644},
+{37272,9,12875},{37275,0,8724},{37276,49,12878},{37289,10,224},
+{37292,53,12891},{37306,6,227},{37308,9,12905},{37311,0,9440},
+{37312,9,12908},{37315,0,9144},{37316,33,12911},{37325,0,7809},
+{37326,5,12920},{37328,38,229},{37338,17,12925},{37343,0,9441},
+{37344,5,12930},{37346,0,9379},{37347,25,12932},{37354,0,9380},
+{37355,17,12939},{37360,10,239},{37363,45,12945},{37440,249,12957},
+{37504,213,13020},{37558,0,8657},{37559,89,13074},{37582,10,242},
+{37585,9,13098},{37588,0,9858},{37589,37,13101},{37599,6,245},
+{37601,113,13111},{37630,0,8077},{37696,61,13140},{37712,0,8703},
+{37713,45,13156},{37725,0,8024},{37726,69,13168},{37744,0,8539},
+{37745,17,13186},{37750,0,7862},{37751,29,13191},{37760,45,13199},
+{37772,0,8411},{37773,61,13211},{37789,0,9056},{37790,25,13227},
+{37797,10,247},{37800,45,13235},{37812,0,8846},{37813,9,13247},
+{37816,0,8159},{37817,5,13250},{37819,10,250},{37822,29,13253},
+{37830,0,8194},{37831,29,13261},{37839,0,8339},{37840,25,13269},
+{37847,0,9055},{37848,9,13276},{37851,6,253},{37853,13,13279},
+{37857,0,7944},{37858,5,13283},{37860,6,255},{37862,9,13285},
+{37865,34,257},{37874,5,13291},{37876,6,266},{37878,13,13293},
+{37882,0,7849},{37883,9,13297},{37886,0,8140},{37952,13,13300},
+{37956,0,8050},{37957,29,13304},{37965,0,8344},{37966,5,13312},
+{37968,22,268},{37974,5,13315},{37976,0,9061},{37977,5,13317},
+{37979,18,274},{37984,13,13320},{37988,10,279},{37991,25,13325},
+{37998,0,8252},{37999,9,13332},{38002,34,282},{38011,13,13339},
+{38016,10,291},{38019,13,13343},{38023,6,294},{38025,93,13347},
+{38049,0,7726},{38050,65,13371},{38067,10,296},{38070,33,13389},
+{38079,6,299},{38081,41,13398},{38092,0,9428},{38093,41,13409},
+{38104,0,8815},{38105,25,13420},{38112,0,7895},{38113,117,13427},
+{38208,197,13457},{38258,0,8493},{38259,45,13507},{38272,9,13519},
+{38275,0,8859},{38276,101,13522},{38302,6,301},{38304,73,13548},
+{38323,0,7801},{38324,21,13567},{38330,0,8794},{38331,77,13573},
+{38351,22,303},{38357,45,13595},{38369,0,9385},{38370,17,13607},
+{38375,0,8167},{38376,33,13612},{38385,0,8466},{38386,21,13621},
+{38392,0,8508},{38393,17,13627},{38398,0,8028},{38464,85,13632},
+{38486,0,9412},{38487,145,13654},{38524,0,7884},{38525,5,13691},
+{38528,505,13693},{38720,153,13820},{38759,0,9322},{38760,13,13859},
+{38764,10,309},{38767,61,13864},{38784,85,13880},{38806,6,312},
+{38808,17,13902},{38813,0,7886},{38814,17,13907},{38819,0,8818},
+{38820,105,13912},{38847,0,9331},{38848,181,13939},{38894,0,8702},
+{38895,29,13985},{38903,0,7934},{38904,25,13993},{38976,17,14000},
+{38981,0,9333},{38982,9,14005},{38985,0,8714},{38986,17,14008},
+{38991,0,8047},{38992,129,14013},{39025,10,314},{39028,41,14047},
+{39040,6,317},{39042,33,14059},{39051,6,319},{39053,73,14068},
+{39072,0,9340},{39073,33,14087},{39082,0,8097},{39083,41,14096},
+{39094,6,321},{39096,5,14107},{39098,0,9324},{39099,45,14109},
+{39111,0,8254},{39112,9,14121},{39115,0,7756},{39116,13,14124},
+{39120,0,8506},{39121,5,14128},{39123,0,8708},{39124,57,14130},
+{39139,10,323},{39142,33,14145},{39151,0,9332},{39152,5,14154},
+{39154,0,8413},{39155,45,14156},{39232,9,14168},{39235,10,326},
+{39238,125,14172},{39270,0,9330},{39271,25,14204},{39278,0,7861},
+{39279,21,14211},{39285,0,9336},{39286,13,14217},{39290,6,329},
+{39292,9,14221},{39296,17,14224},{39301,0,9881},{39302,9,14229},
+{39305,0,9346},{39306,13,14232},{39310,0,8353},{39311,5,14236},
+{39313,0,8082},{39314,25,14238},{39321,0,7992},{39322,57,14245},
+{39337,0,9349},{39338,21,14260},{39344,22,331},{39350,25,14267},
+{39357,22,337},{39363,21,14276},{39369,0,9327},{39370,13,14282},
+{39374,0,9345},{39375,5,14286},{39377,0,8736},{39378,29,14288},
+{39386,0,8181},{39387,17,14296},{39392,0,8436},{39393,13,14301},
+{39397,0,9341},{39398,5,14305},{39400,0,9337},{39401,9,14307},
+{39404,0,9342},{39405,25,14310},{39412,0,9338},{39413,37,14317},
+{39488,37,14327},{39498,0,8419},{39499,45,14337},{39511,0,8365},
+{39512,49,14349},{39525,10,343},{39528,33,14363},{39537,0,8537},
+{39538,13,14372},{39542,6,346},{39544,25,14376},{39552,29,14383},
+{39560,0,7772},{39561,9,14391},{39564,0,9352},{39565,13,14394},
+{39569,0,9351},{39570,17,14398},{39575,0,9354},{39576,5,14403},
+{39578,6,348},{39580,5,14405},{39582,0,8067},{39583,9,14407},
+{39586,6,350},{39588,21,14410},{39594,0,8367},{39595,145,14416},
+{39632,0,9408},{39633,17,14453},{39638,0,8813},{39639,9,14458},
+{39642,0,9409},{39643,25,14461},{39650,14,352},{39654,97,14469},
+{39744,249,14494},{39808,321,14557},{39889,0,9180},{39890,37,14638},
+{39900,0,9179},{39901,133,14648},{40000,73,14682},{40019,0,8286},
+{40020,17,14701},{40025,14,356},{40029,93,14707},{40053,0,8607},
+{40054,9,14731},{40057,0,7782},{40058,17,14734},{40064,21,14739},
+{40070,0,8035},{40071,85,14745},{40093,0,9181},{40094,49,14767},
+{40107,0,8555},{40108,117,14780},{40138,0,8885},{40139,13,14810},
+{40143,0,7974},{40144,85,14814},{40166,6,360},{40168,13,14836},
+{40172,10,362},{40175,45,14841},{40187,0,8011},{40188,5,14853},
+{40190,0,8850},{40256,5,14855},{40258,0,8484},{40259,9,14857},
+{40262,6,365},{40264,17,14860},{40269,10,367},{40272,65,14866},
+{40289,0,8369},{40290,21,14883},{40296,6,370},{40298,13,14889},
+{40302,0,8888},{40303,5,14893},{40305,0,8822},{40306,9,14895},
+{40309,0,8091},{40310,17,14898},{40315,14,372},{40320,37,14905},
+{40330,0,8382},{40331,5,14915},{40333,0,8116},{40334,9,14917},
+{40337,0,9175},{40338,25,14920},{40345,0,8453},{40346,25,14927},
+{40353,6,376},{40355,13,14934},{40359,0,9194},{40360,13,14938},
+{40364,6,378},{40366,13,14942},{40370,6,380},{40372,37,14946},
+{40382,0,8093},{40383,25,14956},{40390,0,9189},{40391,5,14963},
+{40393,0,8804},{40394,9,14965},{40397,0,9442},{40398,13,14968},
+{40402,0,9182},{40403,5,14972},{40405,0,7876},{40406,41,14974},
+{40417,6,382},{40419,53,14985},{40433,0,8491},{40434,5,14999},
+{40436,0,8357},{40437,5,15001},{40439,0,9867},{40440,5,15003},
+{40442,0,8054},{40443,5,15005},{40445,6,384},{40512,17,15008},
+{40517,0,8193},{40518,5,15013},{40520,6,386},{40522,29,15015},
+{40530,18,388},{40535,21,15025},{40541,6,393},{40543,5,15031},
+{40545,10,395},{40548,9,15034},{40551,0,9183},{40552,13,15037},
+{40556,0,7759},{40557,5,15041},{40559,0,9177},{40560,5,15043},
+{40562,14,398},{40566,17,15046},{40571,6,402},{40573,5,15051},
+{40576,17,15053},{40581,10,404},{40584,33,15059},{40593,0,8186},
+{40594,13,15068},{40598,6,407},{40600,37,15072},{40610,0,8454},
+{40611,9,15082},{40614,0,8203},{40615,5,15085},{40617,0,8550},
+{40618,13,15087},{40622,0,9199},{40623,13,15091},{40627,6,409},
+{40629,5,15095},{40631,0,9191},{40632,241,15097},{40693,0,8611},
+{40694,33,15158},{40768,53,15167},{40782,0,8570},{40783,125,15181},
+{40815,0,8613},{40816,57,15213},{40832,69,15228},{40850,0,8226},
+{40851,17,15246},{40856,0,9430},{40857,49,15251},{40870,0,9018},
+{40871,5,15264},{40873,0,7918},{40874,5,15266},{40876,0,9429},
+{40877,109,15268},{40905,0,8744},{40906,9,15296},{40909,0,9431},
+{40910,73,15299},{40929,0,8444},{40930,33,15318},{40939,0,7815},
+{40940,5,15327},{40942,0,9432},{40943,17,15329},{40948,0,7866},
+{40949,29,15334},{40957,6,411},{41024,9,15343},{41027,0,8556},
+{41028,5,15346},{41030,0,9433},{41031,5,15348},{41033,0,8743},
+{41034,13,15350},{41038,0,7775},{41039,17,15354},{41044,0,8863},
+{41045,17,15359},{41050,0,8029},{41051,21,15364},{41057,10,413},
+{41060,49,15371},{41073,0,8521},{41074,5,15384},{41076,0,8262},
+{41077,37,15386},{41088,0,8192},{41089,61,15396},{41105,0,8592},
+{41106,5,15412},{41108,10,416},{41111,69,15415},{41129,0,9411},
+{41130,81,15433},{41151,0,8396},{41152,53,15454},{41166,0,9024},
+{41167,37,15468},{41177,0,7889},{41178,13,15478},{41182,0,8620},
+{41183,57,15482},{41198,0,8879},{41199,61,15497},{41377,373,96},
+{41633,37,9897},{41649,197,190},{41701,37,240},{41713,45,250},
+{41889,373,262},{42145,329,356},{42401,341,439},{42657,93,525},
+{42689,209,549},{42913,129,602},{42961,129,635},{43072,249,9907},
+{43136,85,9970},{43169,125,668},{43205,149,700},{43328,93,9992},
+{43353,5,10016},{43356,0,10018},{43360,121,10019},{43392,85,10050},
+{43414,0,7703},{43428,301,738},{43584,49,15513},{43597,6,419},
+{43599,133,15526},{43633,10,421},{43636,9,15561},{43639,0,9109},
+{43640,5,15564},{43642,6,424},{43644,9,15566},{43648,101,15569},
+{43674,26,426},{43681,373,814},{43840,0,8036},{43841,5,15598},
+{43843,30,433},{43851,5,15602},{43853,0,9113},{43854,193,15604},
+{43904,129,15653},{43937,125,908},{44096,21,15686},{44102,0,8640},
+{44103,165,15692},{44145,0,9312},{44146,37,15734},{44156,0,9308},
+{44157,5,15744},{44160,49,15746},{44173,0,8541},{44174,17,15759},
+{44179,6,441},{44181,45,15764},{44352,33,15776},{44361,0,9313},
+{44362,77,15785},{44382,0,9307},{44383,5,15805},{44385,0,9314},
+{44386,21,15807},{44392,0,8020},{44393,41,15813},{44404,0,9311},
+{44405,37,15824},{44416,5,15834},{44418,0,8428},{44419,13,15836},
+{44423,0,9309},{44424,9,15840},{44427,0,9315},{44428,17,15843},
+{44433,0,9316},{44434,57,15848},{44608,77,15863},{44628,0,9381},
+{44629,49,15883},{44642,0,7792},{44643,109,15896},{44672,0,8335},
+{44673,13,15924},{44677,0,7746},{44678,17,15928},{44683,0,8014},
+{44684,29,15933},{44692,0,7857},{44693,41,15941},{44704,0,7819},
+{44864,141,15952},{44900,0,8134},{44901,85,15988},{44923,0,9646},
+{44924,9,16010},{44928,5,16013},{44930,6,443},{44932,37,16015},
+{44942,14,445},{44946,37,16026},{44956,0,9651},{44957,5,16036},
+{44959,6,449},{45120,0,16039},{45121,5,9647},{45123,6,451},
+{45125,37,16041},{45135,0,9644},{45136,13,16051},{45140,0,7758},
+{45141,5,16055},{45143,34,453},{45152,5,9652},{45154,10,462},
+{45157,25,16060},{45164,0,7913},{45165,61,16067},{45181,6,465},
+{45184,89,16084},{45207,10,467},{45210,25,16108},{45217,373,940},
+{45376,41,16115},{45387,30,470},{45395,173,16129},{45440,89,16173},
+{45463,0,9860},{45464,33,16196},{45473,373,1034},{45632,6,478},
+{45634,145,16206},{45671,0,9454},{45672,17,16243},{45677,0,8308},
+{45678,21,16248},{45684,0,9863},{45685,37,16254},{45696,0,9456},
+{45697,29,16264},{45705,0,9869},{45706,61,16272},{45722,0,8864},
+{45723,21,16288},{45729,373,1128},{45888,9,16294},{45891,0,8107},
+{45892,173,16297},{45936,0,9896},{45937,53,16341},{45952,29,16355},
+{45960,0,9449},{45961,9,16363},{45964,10,480},{45967,69,16367},
+{45985,373,1222},{46144,77,16385},{46164,0,8520},{46165,9,16405},
+{46168,0,9444},{46169,17,16408},{46174,14,483},{46178,73,16414},
+{46197,0,8871},{46198,29,16433},{46206,0,9452},{46208,9,16441},
+{46211,0,9451},{46212,17,16444},{46217,0,9443},{46218,33,16449},
+{46227,0,9450},{46228,49,16458},{46241,373,1316},{46400,6,487},
+{46402,33,16472},{46411,0,7719},{46412,37,16481},{46422,0,8166},
+{46423,9,16491},{46426,10,489},{46429,13,16494},{46433,0,9448},
+{46434,113,16498},{46464,109,16527},{46492,6,492},{46494,9,16555},
+{46497,373,1410},{46656,69,16558},{46674,0,9890},{46675,5,16576},
+{46677,0,9437},{46678,9,16578},{46681,14,494},{46685,133,16582},
+{46720,129,16616},{46753,373,1504},{46912,53,16649},{46926,0,8853},
+{46927,5,16663},{46929,0,7808},{46930,25,16665},{46937,0,9847},
+{46938,37,16672},{46948,10,498},{46951,61,16682},{46967,6,501},
+{46969,21,16698},{46976,10,503},{46979,117,16705},{47009,373,1598},
+{47168,9,16735},{47171,14,506},{47175,21,16739},{47181,0,9657},
+{47182,9,16745},{47185,0,8170},{47186,29,16748},{47194,26,510},
+{47201,85,16758},{47223,0,8513},{47224,25,16780},{47232,5,16787},
+{47234,0,8135},{47235,117,16789},{47265,373,1692},{47424,61,16819},
+{47440,0,7745},{47441,61,16835},{47457,0,9700},{47458,97,16851},
+{47483,0,8070},{47484,9,16876},{47488,113,16879},{47517,0,8115},
+{47518,5,16908},{47520,0,7919},{47521,373,1786},{47680,5,16910},
+{47682,10,517},{47685,65,16913},{47702,0,9699},{47703,5,16930},
+{47705,0,8465},{47706,21,16932},{47712,0,9702},{47713,33,16938},
+{47722,0,9703},{47723,33,16947},{47732,0,8257},{47733,37,16956},
+{47744,13,16966},{47748,18,520},{47753,13,16972},{47757,0,9707},
+{47758,61,16976},{47774,10,525},{47777,373,1880},{47936,0,8183},
+{47937,29,16993},{47945,0,7821},{47946,53,17001},{47960,0,9705},
+{47961,5,17015},{47963,6,528},{47965,9,17017},{47968,0,9875},
+{47969,13,17020},{47973,22,530},{47979,9,17026},{47982,0,9891},
+{47983,61,17029},{48000,129,17045},{48033,373,1974},{48192,69,17078},
+{48210,6,536},{48212,21,17096},{48218,0,8228},{48219,21,17102},
+{48225,34,538},{48234,9,17112},{48237,34,547},{48246,5,9246},
+{48248,14,556},{48252,5,17119},{48254,0,8359},{48256,5,17121},
+{48258,38,560},{48268,9,17125},{48271,0,7923},{48272,37,17128},
+{48282,14,570},{48286,9,17138},{48289,373,2068},{48448,5,17141},
+{48450,14,574},{48454,5,17144},{48456,30,578},{48464,25,17149},
+{48471,10,586},{48474,45,17157},{48486,6,589},{48488,5,17169},
+{48490,6,591},{48492,9,17171},{48495,10,593},{48498,25,17175},
+{48505,10,596},{48508,5,17182},{48510,0,8148},{48512,6,599},
+{48514,25,17185},{48521,10,601},{48524,5,17193},{48526,14,604},
+{48530,17,17196},{48535,0,8536},{48536,9,17201},{48539,0,8130},
+{48540,17,17204},{48545,373,2162},{48704,9,17209},{48707,10,608},
+{48710,9,17213},{48713,6,611},{48715,21,17216},{48721,34,613},
+{48730,9,17223},{48733,30,622},{48741,13,17227},{48745,0,9269},
+{48746,5,17231},{48748,0,9275},{48749,5,17233},{48751,6,630},
+{48753,17,17235},{48758,14,632},{48762,5,17241},{48764,10,636},
+{48768,9,17243},{48771,26,639},{48778,5,17248},{48780,14,646},
+{48784,5,17251},{48786,0,8326},{48787,5,17253},{48789,30,650},
+{48797,5,17258},{48799,6,658},{48801,373,2256},{48960,0,9894},
+{48961,45,17261},{48973,14,660},{48977,13,17273},{48981,6,664},
+{48983,33,17277},{48992,18,666},{48997,9,17287},{49000,0,8642},
+{49001,9,17290},{49004,0,8558},{49005,9,17293},{49008,14,671},
+{49012,5,17297},{49014,34,675},{49024,5,17301},{49026,6,684},
+{49028,17,17303},{49033,6,686},{49035,37,17308},{49045,14,688},
+{49049,13,17319},{49053,0,9300},{49054,9,17323},{49057,373,2350},
+{49216,0,8443},{49217,9,17326},{49220,0,9280},{49221,21,17329},
+{49227,30,692},{49235,5,17336},{49237,0,8110},{49238,17,17338},
+{49243,0,8730},{49244,5,17343},{49246,10,700},{49249,29,17345},
+{49257,30,703},{49265,9,17356},{49268,22,711},{49274,5,17361},
+{49276,0,8191},{49277,5,17363},{49280,105,17365},{49307,10,717},
+{49310,9,17393},{49313,373,2444},{49472,61,17396},{49488,0,7914},
+{49489,9,17412},{49492,0,7724},{49493,37,17415},{49503,14,720},
+{49507,69,17426},{49525,0,9714},{49526,5,17444},{49528,0,8725},
+{49529,21,17446},{49536,81,17452},{49557,0,8622},{49558,41,17473},
+{49569,373,2538},{49728,53,17484},{49742,0,8416},{49743,85,17498},
+{49765,10,724},{49768,81,17521},{49789,6,727},{49792,13,17543},
+{49796,0,8601},{49797,53,17547},{49811,38,729},{49821,9,17563},
+{49824,0,8569},{49825,373,2632},{49984,0,8248},{49985,5,17566},
+{49987,0,8533},{49988,217,17568},{50043,0,8658},{50044,9,17623},
+{50048,13,17626},{50052,0,9415},{50053,85,17630},{50075,0,8825},
+{50076,17,17652},{50081,373,2726},{50240,33,17657},{50249,0,8483},
+{50250,5,17666},{50252,0,9413},{50253,25,17668},{50260,0,9417},
+{50261,9,17675},{50264,0,8340},{50265,5,17678},{50267,0,8854},
+{50268,25,17680},{50275,0,7799},{50276,73,17687},{50295,0,7942},
+{50296,5,17706},{50298,0,8101},{50299,13,17708},{50304,6,739},
+{50306,57,17713},{50321,10,741},{50324,13,17728},{50328,18,744},
+{50333,13,17734},{50337,373,2820},{50496,13,17738},{50500,10,749},
+{50503,13,17743},{50507,6,752},{50509,17,17747},{50514,0,8236},
+{50515,45,17752},{50527,0,8545},{50528,9,17764},{50531,14,754},
+{50535,93,17767},{50560,73,17791},{50579,0,7777},{50580,29,17810},
+{50588,10,758},{50591,5,17819},{50593,373,2914},{50752,6,761},
+{50754,5,17822},{50756,0,8072},{50757,5,17824},{50759,0,8696},
+{50760,105,17826},{50787,0,8994},{50788,53,17853},{50802,0,9014},
+{50803,45,17867},{50816,129,17879},{50849,373,3008},{51008,149,17912},
+{51046,0,8875},{51047,29,17950},{51055,0,8127},{51056,21,17958},
+{51062,0,8061},{51063,13,17964},{51067,0,9011},{51068,9,17968},
+{51072,129,17971},{51105,373,3102},{51264,6,763},{51266,49,18005},
+{51279,0,9012},{51280,5,18018},{51282,0,8177},{51283,73,18020},
+{51302,0,8587},{51303,25,18039},{51310,0,9033},{51311,57,18046},
+{51326,0,8715},{51328,25,18061},{51335,0,9030},{51336,37,18068},
+{51346,10,765},{51349,13,18079},{51353,0,9889},{51354,9,18083},
+{51357,0,8034},{51358,9,18086},{51361,373,3196},{51520,57,18089},
+{51535,6,768},{51537,113,18104},{51566,10,770},{51569,21,18134},
+{51575,0,7954},{51576,25,18140},{51584,57,18147},{51599,6,773},
+{51601,41,18162},{51612,0,9020},{51613,13,18173},{51617,373,3290},
+{51776,53,18177},{51790,0,9839},{51791,25,18191},{51798,0,9041},
+{51799,5,18198},{51801,0,8096},{51802,5,18200},{51804,0,9016},
+{51805,13,18202},{51809,0,8731},{51810,45,18206},{51822,0,9026},
+{51823,9,18218},{51826,0,9039},{51827,13,18221},{51831,0,9021},
+{51832,9,18225},{51835,14,775},{51840,6,779},{51842,25,18230},
+{51849,0,9040},{51850,13,18237},{51854,6,781},{51856,5,18241},
+{51858,0,8651},{51859,25,18243},{51866,0,9045},{51867,21,18250},
+{51873,373,3384},{52032,9,18256},{52035,18,783},{52040,9,18261},
+{52043,0,9856},{52044,5,18264},{52046,0,8410},{52047,29,18266},
+{52055,0,9034},{52056,17,18274},{52061,10,788},{52064,37,18280},
+{52074,0,9023},{52075,61,18290},{52091,6,791},{52093,5,18306},
+{52096,25,18308},{52103,0,8722},{52104,21,18315},{52110,0,8711},
+{52111,9,18321},{52114,0,9049},{52115,33,18324},{52124,10,793},
+{52127,5,18334},{52129,373,3478},{52288,6,796},{52290,25,18336},
+{52297,10,798},{52300,9,18343},{52303,0,8379},{52304,45,18346},
+{52316,0,9050},{52317,9,18358},{52320,0,9046},{52321,9,18361},
+{52324,0,9015},{52325,29,18364},{52333,0,8185},{52334,41,18372},
+{52345,0,9043},{52346,9,18383},{52349,6,801},{52352,53,18387},
+{52366,0,7829},{52367,17,18401},{52372,10,803},{52375,21,18407},
+{52381,0,8168},{52382,9,18413},{52385,373,3572},{52544,249,18416},
+{52608,61,18479},{52624,0,9690},{52625,25,18495},{52632,0,9687},
+{52633,29,18502},{52641,373,3666},{52800,153,18510},{52839,0,8494},
+{52840,37,18549},{52850,0,8626},{52851,45,18559},{52864,6,806},
+{52866,17,18572},{52871,0,9692},{52872,73,18577},{52891,0,8300},
+{52892,5,18596},{52894,0,8742},{52895,5,18598},{52897,373,3760},
+{53056,53,18600},{53070,0,9696},{53071,21,18614},{53077,0,8827},
+{53078,5,18620},{53080,0,9694},{53081,9,18622},{53084,0,9697},
+{53085,57,18625},{53100,0,9685},{53101,21,18640},{53107,10,808},
+{53110,5,18647},{53112,0,7817},{53113,9,18649},{53116,0,9689},
+{53117,5,18652},{53120,6,811},{53122,25,18655},{53129,6,813},
+{53131,29,18662},{53139,6,815},{53141,33,18670},{53150,10,817},
+{53153,373,3854},{53312,49,18680},{53325,0,7977},{53326,9,18693},
+{53329,0,7771},{53330,9,18696},{53333,0,8310},{53334,21,18699},
+{53340,0,8855},{53341,9,18705},{53344,0,9872},{53345,21,18708},
+{53351,0,8511},{53352,13,18714},{53356,10,820},{53359,53,18719},
+{53373,6,823},{53376,129,18734},{53409,373,3948},{53568,81,18767},
+{53589,0,9713},{53590,9,18788},{53593,0,8204},{53594,25,18791},
+{53601,6,825},{53603,69,18798},{53621,0,9895},{53622,25,18816},
+{53629,6,827},{53632,113,18824},{53661,6,829},{53663,5,18853},
+{53665,373,4042},{53824,0,9662},{53825,5,18855},{53827,0,8925},
+{53828,33,18857},{53837,0,9661},{53838,53,18866},{53852,0,7722},
+{53853,21,18880},{53859,6,831},{53861,9,18886},{53864,0,9663},
+{53865,13,18889},{53869,10,833},{53872,5,18894},{53874,0,7807},
+{53875,5,18896},{53877,0,8621},{53878,33,18898},{53888,37,18907},
+{53898,0,8086},{53899,9,18917},{53902,0,7986},{53903,9,18920},
+{53906,0,8324},{53907,5,18923},{53909,10,836},{53912,29,18926},
+{53920,0,9402},{53921,373,4136},{54080,13,18934},{54084,0,9404},
+{54085,9,18938},{54088,10,839},{54091,5,18942},{54093,0,9405},
+{54094,5,18944},{54096,0,9406},{54097,13,18946},{54101,0,9407},
+{54102,5,18950},{54104,0,8146},{54105,5,18952},{54107,14,842},
+{54111,97,18955},{54136,18,846},{54141,5,18982},{54144,17,18984},
+{54149,10,851},{54152,9,18989},{54155,34,854},{54164,5,18996},
+{54166,22,863},{54172,5,19000},{54174,10,869},{54177,373,4230},
+{54336,6,872},{54338,9,19004},{54341,10,874},{54344,13,19008},
+{54348,0,7922},{54349,5,19012},{54351,0,8479},{54352,9,19014},
+{54355,0,8669},{54356,5,19017},{54358,10,877},{54361,9,19020},
+{54364,0,8834},{54365,17,19023},{54370,0,8934},{54371,13,19028},
+{54375,0,8936},{54376,21,19032},{54382,30,880},{54390,5,19041},
+{54392,0,8938},{54393,5,19043},{54395,0,8893},{54396,5,19045},
+{54398,0,7838},{54400,5,19047},{54402,10,888},{54405,5,19049},
+{54407,0,8503},{54408,5,19051},{54410,50,891},{54423,17,19056},
+{54428,0,8944},{54429,5,19061},{54431,6,904},{54433,373,4324},
+{54592,9,19064},{54595,14,906},{54599,9,19067},{54602,0,8446},
+{54603,9,19070},{54606,5,8953},{54608,6,910},{54610,5,19074},
+{54612,10,912},{54615,9,19077},{54618,42,915},{54629,9,19083},
+{54632,0,8519},{54633,9,19086},{54636,10,926},{54639,9,19090},
+{54642,0,8961},{54643,5,19093},{54645,0,7925},{54646,5,19095},
+{54648,0,8728},{54649,5,19097},{54651,0,7878},{54652,5,19099},
+{54654,0,8960},{54656,6,929},{54658,5,19102},{54660,46,931},
+{54672,9,19109},{54675,6,943},{54677,9,19112},{54680,14,945},
+{54684,9,19116},{54687,6,949},{54689,373,4418},{54848,14,951},
+{54852,9,19121},{54855,14,955},{54859,5,19125},{54861,10,959},
+{54864,5,19128},{54866,62,962},{54882,9,19135},{54885,0,8023},
+{54886,9,19138},{54889,10,978},{54892,9,19142},{54895,38,981},
+{54905,9,19148},{54908,0,8710},{54909,5,19151},{54912,9,19153},
+{54915,0,8973},{54916,5,19156},{54918,10,991},{54921,17,19158},
+{54926,0,8931},{54927,17,19163},{54932,0,8122},{54933,13,19168},
+{54937,0,8312},{54938,25,19172},{54945,373,4512},{55104,9,19179},
+{55107,0,8840},{55108,13,19182},{55112,6,994},{55114,21,19186},
+{55120,26,996},{55127,49,19194},{55140,0,8984},{55141,5,19207},
+{55143,6,1003},{55145,9,19209},{55148,0,8405},{55149,5,19212},
+{55151,0,8010},{55152,17,19214},{55157,0,8768},{55158,5,19219},
+{55160,0,7891},{55161,21,19221},{55168,9,19227},{55171,0,7753},
+{55172,9,19230},{55175,0,9755},{55176,9,19233},{55179,18,1005},
+{55184,17,19237},{55189,10,1010},{55192,33,19243},{55201,353,4606},
+{55360,49,19252},{55373,0,8392},{55374,17,19265},{55379,0,7933},
+{55380,169,19270},{55424,61,19313},{55440,22,1013},{55446,13,19330},
+{55450,26,1019},{55457,373,4695},{55616,114,1026},{55645,21,19342},
+{55651,18,1055},{55656,13,19349},{55660,54,1060},{55674,5,19357},
+{55676,10,1074},{55680,0,7892},{55681,21,19359},{55687,0,8179},
+{55688,17,19365},{55693,18,1077},{55698,17,19370},{55703,6,1082},
+{55705,5,19375},{55707,22,1084},{55713,373,4789},{55872,10,1090},
+{55875,17,19380},{55880,0,8509},{55881,13,19385},{55885,6,1093},
+{55887,141,19389},{55923,0,7956},{55924,9,19425},{55927,0,8826},
+{55928,25,19428},{55936,17,19435},{55941,0,8430},{55942,29,19440},
+{55950,0,9720},{55951,69,19448},{55969,373,4883},{56128,125,19466},
+{56160,0,8084},{56161,89,19498},{56184,0,8752},{56185,21,19521},
+{56192,13,19527},{56196,0,9725},{56197,21,19531},{56203,0,9728},
+{56204,45,19537},{56216,0,9734},{56217,29,19549},{56225,373,4977},
+{56384,17,19557},{56389,0,9727},{56390,33,19562},{56399,34,1095},
+{56408,17,19573},{56413,0,9729},{56414,13,19578},{56418,0,9733},
+{56419,9,19582},{56422,6,1104},{56424,9,19585},{56427,0,9735},
+{56428,61,19588},{56444,0,8432},{56445,5,19604},{56448,25,19606},
+{56455,14,1106},{56459,9,19613},{56462,10,1110},{56465,21,19617},
+{56471,0,9357},{56472,9,19623},{56475,0,8450},{56476,13,19626},
+{56480,0,9364},{56481,373,5071},{56640,21,19630},{56646,0,9363},
+{56647,21,19636},{56653,0,9358},{56654,17,19642},{56659,26,1113},
+{56666,13,19648},{56670,30,1120},{56678,25,19655},{56685,14,1128},
+{56689,17,19663},{56694,10,1132},{56697,5,9373},{56699,13,19668},
+{56704,10,1135},{56707,5,19673},{56709,6,1138},{56711,13,19675},
+{56715,0,8048},{56716,9,19679},{56719,0,9376},{56720,13,19682},
+{56724,0,8507},{56725,5,19686},{56727,0,7943},{56728,5,19688},
+{56730,6,1140},{56732,5,19690},{56734,10,1142},{56737,373,5165},
+{56896,6,1145},{56898,5,19693},{56900,0,8872},{56901,9,19695},
+{56904,6,1147},{56906,17,19698},{56911,0,9378},{56912,37,19703},
+{56922,22,1149},{56928,41,19715},{56939,0,7728},{56940,9,19726},
+{56943,14,1155},{56947,45,19729},{56960,69,19741},{56978,0,9851},
+{56979,45,19759},{56991,6,1159},{56993,373,5259},{57152,10,1161},
+{57155,37,19773},{57165,0,8123},{57166,53,19783},{57180,18,1164},
+{57185,9,19798},{57188,18,1169},{57193,13,19803},{57197,0,8499},
+{57198,21,19807},{57204,0,7812},{57205,5,19813},{57207,30,1174},
+{57216,0,8021},{57217,5,19818},{57219,10,1182},{57222,9,19821},
+{57225,6,1185},{57227,85,19824},{57249,373,5353},{57408,61,19846},
+{57424,0,8990},{57425,45,19862},{57437,0,8755},{57438,41,19874},
+{57449,0,8992},{57450,5,19885},{57452,0,8647},{57453,29,19887},
+{57461,18,1187},{57466,17,19897},{57472,25,19902},{57479,0,7867},
+{57480,17,19909},{57485,30,1192},{57493,5,19917},{57495,0,8987},
+{57496,33,19919},{57505,373,5447},{57664,5,19928},{57666,0,8993},
+{57667,129,19930},{57700,0,8789},{57701,9,19963},{57704,0,7823},
+{57705,41,19966},{57716,6,1200},{57718,33,19977},{57728,13,19986},
+{57732,22,1202},{57738,5,19992},{57740,6,1208},{57742,9,9459},
+{57745,18,1210},{57750,5,19996},{57752,0,8832},{57753,17,19998},
+{57758,10,1215},{57761,373,5541},{57920,14,1218},{57924,41,20006},
+{57935,22,1222},{57941,17,20019},{57946,6,1228},{57948,5,20024},
+{57950,0,9478},{57951,9,20026},{57954,6,1230},{57956,9,20029},
+{57959,18,1232},{57964,5,20033},{57966,6,1237},{57968,29,20035},
+{57976,0,8149},{57977,13,20043},{57981,6,1239},{57984,10,1241},
+{57987,21,20048},{57993,10,1244},{57996,5,20055},{57998,6,1247},
+{58000,5,20057},{58002,14,1249},{58006,5,20059},{58008,14,1253},
+{58012,13,20061},{58016,0,9473},{58017,373,5635},{58176,5,20065},
+{58178,6,1257},{58180,9,20067},{58183,0,9496},{58184,9,20070},
+{58187,0,7766},{58188,9,20073},{58191,10,1259},{58194,5,20077},
+{58196,6,1262},{58198,5,20079},{58200,0,9488},{58201,9,20081},
+{58204,0,7765},{58205,9,20084},{58208,0,9482},{58209,17,20087},
+{58214,5,9489},{58216,33,20092},{58225,14,1264},{58229,9,20102},
+{58232,6,1268},{58234,5,20105},{58236,10,1270},{58240,37,20108},
+{58250,10,1273},{58253,5,20119},{58255,26,1276},{58262,9,20124},
+{58265,0,9501},{58266,5,20127},{58268,18,1283},{58273,373,5729},
+{58432,18,1288},{58437,9,20131},{58440,0,9509},{58441,17,20134},
+{58446,22,1293},{58452,13,20141},{58456,26,1299},{58463,9,20148},
+{58466,0,9513},{58467,5,20151},{58469,0,9505},{58470,5,20153},
+{58472,0,7935},{58473,37,20155},{58483,10,1306},{58486,9,20166},
+{58489,22,1309},{58496,6,1315},{58498,5,20171},{58500,18,1317},
+{58505,13,20173},{58509,10,1322},{58512,9,20178},{58515,0,7960},
+{58516,13,20181},{58520,0,9547},{58521,13,20185},{58525,0,9543},
+{58526,5,9551},{58528,0,20189},{58529,373,5823},{58688,21,20190},
+{58694,10,1325},{58697,5,20197},{58699,0,9548},{58700,5,20199},
+{58702,14,1328},{58706,9,20201},{58709,14,1332},{58713,9,20205},
+{58716,10,1336},{58719,5,20209},{58721,0,8619},{58722,5,20211},
+{58724,6,1339},{58726,5,20213},{58728,6,1341},{58730,5,20215},
+{58732,10,1343},{58735,21,20218},{58741,14,1346},{58745,5,20225},
+{58747,6,1350},{58749,5,20227},{58752,14,1352},{58756,21,20231},
+{58762,0,9558},{58763,9,20237},{58766,0,8808},{58767,5,20240},
+{58769,0,7894},{58770,29,20242},{58778,6,1356},{58780,9,20250},
+{58783,6,1358},{58785,373,5917},{58944,0,8412},{58945,9,20254},
+{58948,0,9561},{58949,13,20257},{58953,6,1360},{58955,9,20261},
+{58958,0,8829},{58959,9,20264},{58962,0,9598},{58963,9,20267},
+{58966,10,1362},{58969,5,20271},{58971,0,9566},{58972,5,20273},
+{58974,0,7732},{58975,37,20275},{58985,10,1365},{58988,33,20286},
+{58997,6,1368},{58999,5,20295},{59001,22,1370},{59008,18,1376},
+{59013,5,20301},{59015,10,1381},{59018,5,20304},{59020,0,9569},
+{59021,21,20306},{59027,0,9570},{59028,9,20312},{59031,0,9580},
+{59032,9,20315},{59035,6,1384},{59037,5,20318},{59039,6,1386},
+{59041,373,6011},{59200,9,20320},{59203,0,9582},{59204,13,20323},
+{59208,6,1388},{59210,9,20327},{59213,5,9576},{59215,26,1390},
+{59222,9,20332},{59225,0,9757},{59226,45,20335},{59238,18,1397},
+{59243,33,20349},{59252,0,9506},{59253,25,20358},{59260,0,9523},
+{59261,5,20365},{59264,5,20367},{59266,18,1402},{59271,9,20370},
+{59274,6,1407},{59276,9,20373},{59279,0,9584},{59280,5,20376},
+{59282,0,9589},{59283,17,20378},{59288,5,9537},{59290,0,9565},
+{59291,17,20383},{59296,0,8218},{59297,373,6105},{59456,9,20388},
+{59459,14,1409},{59463,5,20392},{59465,10,1413},{59468,9,20395},
+{59471,0,9595},{59472,13,20398},{59476,0,8867},{59477,17,20402},
+{59482,10,1416},{59485,17,20408},{59490,10,1419},{59493,41,20414},
+{59504,0,9492},{59505,5,20425},{59507,10,1422},{59510,21,20428},
+{59516,0,9588},{59517,5,20434},{59520,10,1425},{59523,13,20437},
+{59527,10,1428},{59530,5,20442},{59532,14,1431},{59536,65,20444},
+{59553,373,6199},{59712,45,20461},{59724,0,7797},{59725,25,20473},
+{59732,14,1435},{59736,5,20481},{59738,0,9152},{59739,5,20483},
+{59741,46,1439},{59753,9,20489},{59756,0,8809},{59757,29,20492},
+{59765,18,1451},{59770,5,20501},{59772,10,1456},{59776,10,1459},
+{59779,13,20504},{59783,0,8783},{59784,9,20508},{59787,0,9163},
+{59788,5,20511},{59790,26,1462},{59797,9,20514},{59800,0,9168},
+{59801,5,20517},{59803,22,1469},{59809,373,6293},{59968,0,8184},
+{59969,9,20521},{59972,0,9171},{59973,9,20524},{59976,10,1475},
+{59979,17,20527},{59984,10,1478},{59987,5,20533},{59989,6,1481},
+{59991,5,20535},{59993,0,9157},{59994,145,20537},{60032,0,8986},
+{60033,9,20574},{60036,0,8468},{60037,5,20577},{60039,0,8836},
+{60040,21,20579},{60046,14,1483},{60050,13,20586},{60054,0,8705},
+{60055,33,20590},{60064,0,7897},{60065,373,6387},{60224,6,1487},
+{60226,9,20600},{60229,0,8786},{60230,5,20603},{60232,0,8057},
+{60233,37,20605},{60243,10,1489},{60246,17,20616},{60251,10,1492},
+{60254,5,20622},{60256,10,1495},{60259,37,20625},{60269,0,8534},
+{60270,5,20635},{60272,14,1498},{60276,13,20638},{60280,6,1502},
+{60282,17,20642},{60288,17,20647},{60293,0,8784},{60294,13,20652},
+{60298,0,7875},{60299,85,20656},{60321,373,6481},{60480,21,20678},
+{60486,0,8616},{60487,57,20684},{60502,0,9741},{60503,9,20699},
+{60506,10,1504},{60509,9,20703},{60512,0,8242},{60513,49,20706},
+{60526,0,9739},{60527,25,20719},{60534,0,8899},{60535,29,20726},
+{60544,85,20734},{60566,0,7971},{60567,37,20756},{60577,373,6575},
+{60736,21,20766},{60742,0,9877},{60743,65,20772},{60760,0,9822},
+{60761,17,20789},{60766,0,9821},{60767,5,20794},{60769,0,9874},
+{60770,5,20796},{60772,14,1507},{60776,21,20799},{60782,0,8000},
+{60783,17,20805},{60788,0,9317},{60789,5,20810},{60791,10,1511},
+{60794,17,20813},{60800,65,20818},{60817,62,1514},{60833,373,6669},
+{60992,18,1530},{60997,9,20840},{61000,6,1535},{61002,9,20843},
+{61005,0,9673},{61006,13,20846},{61010,0,9672},{61011,5,20850},
+{61013,10,1537},{61016,21,20853},{61022,0,8573},{61023,5,20859},
+{61025,0,8062},{61026,21,20861},{61032,6,1540},{61034,5,20867},
+{61036,10,1542},{61039,29,20870},{61047,0,8154},{61048,17,20878},
+{61053,6,1545},{61056,0,9677},{61057,13,20883},{61061,6,1547},
+{61063,9,20887},{61066,14,1549},{61070,5,20891},{61072,0,8200},
+{61073,9,20893},{61076,0,9680},{61077,5,20896},{61079,10,1553},
+{61082,9,20899},{61085,6,1556},{61087,5,20902},{61089,373,6763},
+{61248,22,1558},{61254,21,20905},{61260,0,7936},{61261,17,20911},
+{61266,5,9420},{61268,14,1564},{61272,5,20918},{61274,0,9422},
+{61275,17,20920},{61280,0,9423},{61281,25,20925},{61288,18,1568},
+{61293,37,20934},{61303,0,7924},{61304,5,20944},{61306,10,1573},
+{61309,5,20947},{61312,5,20949},{61314,0,9117},{61315,5,9119},
+{61317,14,1576},{61321,5,20953},{61323,10,1580},{61326,25,20956},
+{61333,10,1583},{61336,13,20963},{61340,10,1586},{61343,5,20968},
+{61345,373,6857},{61504,18,1589},{61509,5,20972},{61511,10,1594},
+{61514,13,20974},{61518,0,8760},{61519,5,20978},{61521,0,9125},
+{61522,5,20980},{61524,0,8090},{61525,5,20982},{61527,0,8643},
+{61528,21,20984},{61534,0,7982},{61535,33,20990},{61544,0,9116},
+{61545,9,20999},{61548,0,9126},{61549,13,21002},{61553,14,1597},
+{61557,9,21007},{61560,10,1601},{61563,5,21011},{61565,5,9129},
+{61568,10,1604},{61571,13,21013},{61575,6,1607},{61577,5,21017},
+{61579,0,9830},{61580,13,21019},{61584,10,1609},{61587,9,21024},
+{61590,0,9133},{61591,37,21027},{61601,373,6951},{61760,69,21037},
+{61778,10,1612},{61781,5,21055},{61783,14,1615},{61787,45,21058},
+{61799,0,7767},{61800,53,21070},{61814,22,1619},{61820,5,21085},
+{61822,0,9224},{61824,38,1625},{61834,37,21091},{61844,0,7999},
+{61845,9,21101},{61848,0,8295},{61849,29,21104},{61857,373,7045},
+{62016,17,21112},{62021,10,1635},{62024,9,21118},{62027,0,9231},
+{62028,25,21121},{62035,10,1638},{62038,21,21128},{62044,0,9234},
+{62045,5,21134},{62047,0,8375},{62048,65,21136},{62065,22,1641},
+{62071,17,21155},{62076,10,1647},{62080,17,21160},{62085,18,1650},
+{62090,5,9238},{62092,0,8433},{62093,13,21166},{62097,0,9226},
+{62098,5,21170},{62100,10,1655},{62103,17,21173},{62108,10,1658},
+{62111,5,21179},{62113,373,7139},{62272,6,1661},{62274,9,21181},
+{62277,0,8860},{62278,5,21184},{62280,14,1663},{62284,13,21187},
+{62288,0,9228},{62289,61,21191},{62305,0,7721},{62306,69,21207},
+{62324,22,1667},{62330,17,21226},{62336,45,21231},{62348,0,9845},
+{62349,73,21243},{62368,0,8524},{62369,373,7233},{62528,17,21262},
+{62533,0,9850},{62534,37,21267},{62544,0,9888},{62545,21,21277},
+{62551,26,1673},{62558,13,21286},{62562,10,1680},{62565,61,21291},
+{62581,0,9829},{62582,21,21307},{62588,10,1683},{62592,77,21314},
+{62612,0,8266},{62613,13,21334},{62617,0,9759},{62618,5,21338},
+{62620,0,9758},{62621,13,21340},{62625,373,7327},{62784,17,21344},
+{62789,10,1686},{62792,37,21350},{62802,18,1689},{62807,25,21361},
+{62814,0,9769},{62815,5,21368},{62817,6,1694},{62819,41,21370},
+{62830,18,1696},{62835,45,21382},{62848,17,21394},{62853,6,1701},
+{62855,17,21399},{62860,14,1703},{62864,33,21405},{62873,10,1707},
+{62876,13,21415},{62880,0,9795},{62881,373,7421},{63040,6,1710},
+{63042,9,21420},{63045,14,1712},{63049,5,21424},{63051,10,1716},
+{63054,5,9787},{63056,13,21427},{63060,0,9794},{63061,9,21431},
+{63064,0,9796},{63065,29,21434},{63073,10,1719},{63076,29,21443},
+{63084,6,1722},{63086,9,21451},{63089,0,9801},{63090,5,21454},
+{63092,14,1724},{63096,25,21457},{63104,17,21464},{63109,0,9805},
+{63110,5,21469},{63112,10,1728},{63115,5,21472},{63117,6,1731},
+{63119,9,21474},{63122,0,9807},{63123,9,21477},{63126,42,1733},
+{63137,373,7515},{63296,5,21484},{63298,0,9812},{63299,21,21486},
+{63305,0,9816},{63306,5,21492},{63308,6,1744},{63310,29,21494},
+{63318,26,1746},{63325,13,21504},{63329,10,1753},{63332,25,21509},
+{63339,0,9820},{63340,17,21516},{63345,0,9772},{63346,37,21521},
+{63356,10,1756},{63360,129,21532},{63393,373,7609},{63552,5,21565},
+{63554,0,8348},{63555,9,21567},{63558,0,9600},{63559,5,21570},
+{63561,0,8924},{63562,21,21572},{63568,14,1759},{63572,57,21579},
+{63587,14,1763},{63591,41,21595},{63602,0,8578},{63603,17,21606},
+{63608,18,1767},{63613,5,21613},{63616,6,1772},{63618,5,21616},
+{63620,10,1774},{63623,21,21619},{63629,6,1777},{63631,37,21625},
+{63641,0,8007},{63642,9,21635},{63645,0,7965},{63646,5,21638},
+{63648,0,9613},{63808,53,21640},{63822,10,1779},{63825,29,21654},
+{63833,6,1782},{63835,5,21662},{63837,6,1784},{63839,29,21664},
+{63847,10,1786},{63850,5,21673},{63852,0,9624},{63853,5,21675},
+{63855,0,8438},{63856,57,21677},{63872,17,21692},{63877,10,1789},
+{63880,33,21698},{63889,0,9622},{63890,13,21707},{63894,10,1792},
+{63897,29,21712},{64064,5,21720},{64066,0,9629},{64067,9,21722},
+{64070,0,9630},{64071,17,21725},{64076,0,9036},{64077,13,21730},
+{64081,0,8004},{64082,21,21734},{64088,6,1795},{64090,9,21740},
+{64093,18,1797},{64098,53,21745},{64112,0,9634},{64113,9,21759},
+{64116,14,1802},{64120,25,21763},{64128,9,21770},{64131,6,1806},
+{64133,29,21773},{64141,0,9636},{64142,5,21781},{64144,6,1808},
+{64146,13,21783},{64150,10,1810},{64153,29,21787},{64320,33,21795},
+{64329,0,9640},{64330,29,21804},{64338,0,9606},{64339,13,21812},
+{64343,18,1813},{64348,97,21817},{64373,0,9864},{64374,9,21842},
+{64377,22,1818},{64384,61,21847},{64400,0,8207},{64401,41,21863},
+{64412,0,8305},{64413,5,21874},{64415,6,1824},{64576,13,21877},
+{64580,0,9878},{64581,13,21881},{64585,0,9871},{64586,61,21885},
+{64602,0,8922},{64603,29,21901},{64611,0,7873},{64612,13,21909},
+{64616,0,7859},{64617,21,21913},{64623,10,1826},{64626,5,21920},
+{64628,0,9833},{64629,5,21922},{64631,5,9752},{64633,21,21924},
+{64640,9,21930},{64643,0,9754},{64644,21,21933},{64650,0,9843},
+{64651,85,21939},{64832,69,21961},{64850,6,1829},{64852,9,21979},
+{64855,14,1831},{64859,13,21983},{64863,0,9745},{64864,5,21987},
+{64866,0,9747},{64867,5,21989},{64869,18,1835},{64874,5,21992},
+{64876,0,9748},{64877,9,21994},{64880,10,1840},{64883,17,21998},
+{64888,0,8434},{64889,13,22003},{64893,6,1843},{64896,29,22008},
+{64904,0,8247},{64905,5,22016},{64907,0,8371},{64908,9,22018},
+{64911,6,1845},{64913,9,22021},{64916,0,7988},{64917,29,22024},
+{64925,14,1847},{65088,0,4697},{65089,245,22032},{65152,129,22094},
+};
+
+static const unsigned short cmap_GBKp_EUC_H_table[1851] = {
+7778,10315,7781,8833,8909,10407,8458,7742,7830,8907,8812,10424,
+8471,10428,8424,8108,8915,8720,10474,8911,10475,8723,10476,8164,
+8912,8910,8919,8917,8913,8906,7833,8143,8246,7994,10676,8905,
+8089,7885,10719,8617,10720,8678,10721,8487,8195,8901,8030,10771,
+8902,8208,10831,8898,8459,11063,8414,11064,7850,8408,8896,8368,
+11113,9082,7796,9080,8655,9064,11125,9073,11126,9065,9072,11153,
+11154,9078,9075,9087,11158,9076,11159,8373,7899,9842,9067,11193,
+8249,9085,8693,11202,9089,9083,9086,8652,9066,9865,11214,9879,
+9091,7997,11247,8591,8774,8776,8574,11254,8576,8709,7736,8163,
+9017,11440,9003,11441,9005,8615,11453,9007,8409,11517,8157,8199,
+8998,9001,8018,8251,9000,11540,8999,11590,8060,9051,7902,11614,
+8098,11615,7930,9210,11898,9214,8104,8421,12017,8495,8355,8481,
+12018,8660,8165,7818,7735,8094,8870,8680,12032,7898,7865,8272,
+7783,12074,9204,9097,12165,7863,9105,12268,8817,9104,12313,8243,
+12314,8764,8277,12333,9106,8837,12387,9092,9095,9094,8848,12406,
+7748,7730,9093,7955,8051,8327,7800,9134,7926,7985,9205,12521,
+8821,9838,12534,7856,8323,12538,8584,7841,12575,9107,9140,8318,
+8341,9147,7720,9149,7774,12819,7773,7983,9439,9138,8526,9148,
+12833,8427,8219,8380,9150,8329,12871,9137,8158,8739,9142,9868,
+9438,8190,8017,8673,12922,9136,12923,8142,12924,8478,8225,8819,
+12944,8624,8476,13097,9053,8461,8282,9057,13234,8256,9054,13252,
+7786,7852,7764,8384,9058,8544,13288,8605,8078,8749,13289,8263,
+13290,8802,8039,7858,7762,8356,7964,8847,13314,8173,7725,8530,
+9062,13319,8442,9059,13324,8346,8182,13335,9060,13336,7785,13337,
+9063,13338,8477,8793,8278,8547,8105,8188,7868,13388,8514,8222,
+7747,8790,9384,9383,13593,9862,9382,13594,8654,8565,13863,9325,
+9323,8799,9320,14046,8448,14058,9334,7975,8407,8874,8197,8387,
+8512,9335,8040,14171,8581,8075,9348,9344,9326,14266,9339,9350,
+9329,9347,9328,14274,9321,14275,9343,9419,14362,8019,8211,7987,
+9353,9355,8463,8155,8394,14468,8423,9410,8772,9186,14706,8404,
+7779,8328,7869,14840,9025,8264,9184,8311,14865,8762,8001,8220,
+8095,14903,9674,14904,9185,8172,9187,8462,8102,8196,8886,8361,
+8557,15007,8593,7760,8092,15023,9178,15024,8275,9193,9188,8661,
+15033,9190,8212,15045,9196,9195,9176,9198,9870,15058,9197,9174,
+9192,8585,8280,8473,15342,8124,15370,9434,8712,15414,7910,8630,
+7741,8757,15560,9111,8767,8490,7890,15595,9110,9112,15596,8354,
+15597,8235,15600,9108,8505,15601,8543,8641,9114,8741,8298,7937,
+8704,9650,7831,16025,8363,8232,16038,16040,9649,8706,9643,8838,
+16057,9645,16058,9654,16059,8675,8751,8549,9655,7717,16083,9664,
+16107,8858,8814,16126,8125,16127,8068,8370,16128,8259,16205,9455,
+9445,16366,8698,9446,8439,16413,8299,16471,7826,9447,8210,7916,
+8038,9436,8206,16581,9435,7864,9764,8041,8747,9599,8027,8603,
+16704,9853,8608,8582,16738,8429,7844,8417,16756,9656,8800,16757,
+8418,8868,16912,9704,9706,16970,8079,16971,9708,8400,8221,16992,
+9710,8250,9701,9709,17024,8201,17025,8293,9717,7932,9883,17108,
+9715,17109,8921,17110,9716,17111,9243,8136,17115,8059,17116,9245,
+17117,8780,8008,9244,8447,8602,17118,8337,9251,7835,9250,17123,
+8464,17124,8845,8049,7928,9249,8625,9254,9253,8480,8474,9252,
+17143,9256,9258,9257,17146,8852,17147,8894,17148,7729,9260,17156,
+8117,9259,8111,8296,8676,7969,17174,8449,8572,8522,9261,17184,
+8145,7731,17192,9263,9262,17195,9264,8667,8889,17212,9270,7822,
+9273,8645,9271,8594,17222,9274,7961,8588,7744,8883,8287,9272,
+9266,8820,17226,7836,9265,8325,8119,9267,8276,8670,17240,9268,
+9277,8073,9276,8046,7896,17246,7871,9285,17247,8777,9281,17250,
+7751,8022,8598,17255,9283,9279,17256,8227,17257,9282,9278,17260,
+9038,9286,9291,9284,9255,9292,7951,17286,9287,9289,9288,7939,
+17296,9290,8540,8891,9296,17299,9876,9295,9718,8273,17300,9294,
+8890,8045,9298,9297,9301,17318,8841,8470,8486,8033,9885,17335,
+8074,9302,9305,9304,8058,9293,9303,9299,17353,9248,17354,8671,
+9861,17355,7790,8740,9840,17359,8634,17360,9306,9698,17392,9882,
+8290,9457,17425,9458,9666,17520,9665,8488,17542,8215,7840,8485,
+8525,17561,9668,8349,8842,17562,9667,17712,8345,7853,9416,8360,
+8223,17732,8389,17733,9418,8176,17742,9414,8797,8926,8763,8665,
+8139,8137,9711,17818,8088,17821,9712,18004,8013,9031,18078,8595,
+9037,9032,7776,18133,9029,8216,9013,9028,9009,18228,9035,18229,
+9019,7860,8614,9022,18259,8052,18260,9008,8081,18279,8455,8180,
+9027,8788,18333,9010,7718,9047,9048,8258,8531,8289,18386,8265,
+18406,8002,18571,8606,7787,18646,9691,18654,8721,8745,9686,9693,
+9695,8175,18679,9688,8600,18718,7816,8844,18733,7768,8876,9846,
+18823,8161,9659,9660,9658,8583,18893,9835,8502,18925,9400,8420,
+18941,9401,8189,18954,9403,7981,9737,18980,9738,18981,7828,8927,
+7883,7949,8055,18992,8683,18993,8929,18994,8559,18995,8928,8682,
+18998,8930,8395,18999,8056,7906,19002,8690,19003,8528,8147,19007,
+8933,8532,19019,8935,8932,19038,8810,19039,8939,19040,8937,8381,
+8950,8679,8726,8492,19053,7784,8946,7991,8947,19054,8943,8016,
+7952,8648,19055,8945,8942,19063,8941,8862,8940,8162,19073,7855,
+8758,19076,8951,8765,19080,7810,8118,19081,8612,8618,8952,8529,
+19082,8032,8517,19089,8156,19101,8884,8553,19104,8957,19105,8426,
+19106,8948,19107,8955,19108,8956,8231,8288,8959,8958,7879,19115,
+8972,8949,19119,8966,19120,8970,8659,8963,19124,8967,8971,8031,
+19127,8969,8962,7940,8861,19130,8699,19131,8968,19132,8364,19133,
+8334,8965,8599,19134,8561,8856,8322,19141,8977,8964,19145,8975,
+7733,19146,8401,8976,8099,19147,8662,8978,8333,8979,8982,8043,
+8980,19192,8496,8981,8552,19193,8388,8729,8727,7789,8440,19236,
+8187,8985,8974,19242,8983,7739,8831,19329,7948,7769,7972,8378,
+8037,7920,8548,7984,8801,19334,19335,8866,9387,19336,9391,7912,
+7993,19337,7752,8304,7848,19338,9388,7927,8566,9389,19339,8315,
+8005,9386,8267,8239,8026,9392,19340,8887,8063,19341,8805,9394,
+8475,7761,19348,9396,9395,19353,7839,19354,8472,19355,8372,9135,
+8635,8306,8085,19356,7946,9398,8849,9397,8824,8873,9399,7976,
+8457,8903,9390,8881,8806,19377,8795,8900,19378,8469,19379,8746,
+9393,7957,8796,9724,7820,9730,19571,8781,19572,9732,9726,9731,
+7843,9736,7803,8807,7990,8150,8672,19616,9356,8857,9361,9366,
+9359,9362,19647,9367,8113,19652,9370,19653,9369,19654,8792,9368,
+9371,19662,7945,8422,8230,9375,8025,19672,7995,9372,7738,8283,
+8816,8759,9426,19692,8627,8773,9377,8828,8112,8006,19713,9088,
+9365,19714,9360,7837,7755,7754,8362,9202,19771,8830,19772,8217,
+8787,19797,7998,7846,8590,8684,19801,7870,19802,8778,8399,8674,
+19815,8719,19816,8233,19817,8307,9201,19820,7750,8291,9203,8892,
+19895,8988,19896,8785,8839,19914,8237,7851,19915,8989,19916,8991,
+8716,8100,8347,8664,19990,9722,19991,9721,8500,19994,9464,19995,
+9463,7880,9462,7877,9467,20003,20004,9466,20005,7917,9469,20017,
+9465,20018,9470,8397,9480,9476,9471,8336,7901,7973,20032,9475,
+9474,7802,8358,7953,20047,9479,9472,9477,9497,20054,9493,9484,
+8241,9483,9487,9498,9481,9486,8756,9491,8064,9495,9494,9485,
+20076,8403,8314,8398,8106,20101,9502,7967,9517,8733,9522,20107,
+8571,8623,20118,9516,9512,20121,8332,20122,9519,20123,8636,9525,
+20129,8717,9510,20130,9524,9514,9503,9521,9500,8653,20139,8666,
+20140,8562,9534,8271,20145,9539,20146,8663,20147,7740,9535,20165,
+9540,9507,7824,9530,9541,20169,9533,20170,8385,8451,9504,9532,
+9531,9528,9536,20177,8141,8880,20196,9542,7834,9554,9520,9545,
+9553,7882,20204,8402,8120,20208,8313,9549,7845,8268,8320,9837,
+20217,9527,9546,8632,20224,9550,9468,9556,20229,7996,20230,7893,
+9559,9555,9544,20253,8087,9557,8316,20270,9562,8542,20285,9568,
+8610,9044,9571,9511,20297,9518,9560,20298,7963,20299,8835,20300,
+9572,8352,20303,9573,9581,8224,9567,9578,9529,9564,9579,7791,
+20330,8132,9575,20331,9563,9515,20347,9585,20348,9591,8234,20369,
+9526,9587,9583,8851,9592,9594,8198,20391,8567,9499,20394,9508,
+9593,20407,9574,8083,20413,9596,9597,20427,9586,8782,20436,8646,
+8351,20441,9590,8292,8895,9756,8798,8317,20480,9151,8467,7749,
+20485,8152,9156,20486,9154,8452,20487,8637,20488,8071,9155,8003,
+20500,7966,9849,7915,7989,8330,20503,9159,9161,9158,8691,20513,
+8695,9167,9166,9162,9165,9836,20519,9153,20520,8174,9169,9170,
+9172,7832,7980,20532,9173,7793,9873,8732,20585,7806,8269,20599,
+8114,8535,20615,8639,8735,20621,8253,8213,20624,9893,8516,20637,
+7825,8791,8202,8338,9740,20702,9742,9823,20798,8589,8445,9319,
+20812,9318,8649,20835,8713,7881,8425,20836,8650,8518,9669,8668,
+20837,9310,20838,8527,20839,9670,9671,8769,8586,7727,7900,8383,
+8244,8718,20852,9675,9676,8131,8377,20869,8577,8563,7905,9678,
+8694,8779,9681,20890,7872,9682,20898,7978,7794,9683,8638,9684,
+8260,20904,9679,8435,20916,9880,20917,9848,8376,20932,9424,20933,
+9425,9115,20946,9854,20951,9121,20952,7921,8734,20955,9122,8523,
+7734,8501,8109,20967,7763,20970,9123,8707,20971,7911,9124,8343,
+7908,9118,21006,8245,9127,9128,21010,8309,9131,8171,9132,8042,
+8441,9831,21023,7788,8301,8770,7938,8579,21057,7813,8681,8869,
+9223,8138,21084,9218,8066,9220,21087,8497,21088,8580,21089,9219,
+21090,8302,9227,8151,21117,7811,9230,8391,9229,9200,21153,9233,
+9236,21154,8560,9221,8460,9237,8294,21165,9042,9235,9232,9225,
+21172,9240,8103,21178,8700,8129,9222,8270,21186,9242,9241,9825,
+21225,9892,8564,9827,9826,9832,21283,7888,21284,8342,21285,9164,
+9160,21290,8766,9828,21313,8761,9760,21349,9761,9762,21360,9767,
+7737,9765,9774,9771,9770,9773,21381,9768,8633,9782,9776,9784,
+21404,8205,9783,9797,21414,9786,21419,9792,9789,9793,21423,9790,
+9791,8128,21426,9785,21442,9804,9799,9803,9800,21456,9802,8456,
+9780,21471,9809,9808,9810,9778,9806,9811,21480,9815,21481,9781,
+21482,9779,21483,9814,9813,7757,9819,21502,9818,21503,9817,8238,
+9775,9798,21508,9766,9763,21531,9777,7941,8331,21578,9601,9603,
+9602,21594,8686,8771,21611,9607,21612,9608,21615,9604,8701,21618,
+8687,9610,9612,8144,9618,9615,9620,7904,9617,9621,9623,21672,
+8374,9605,21697,9625,9626,21711,9627,9824,9632,9628,21743,9631,
+21744,8044,8366,21762,9611,9635,9609,9637,9638,9619,9639,8738,
+9641,9633,9642,21816,9616,9614,9886,9723,21845,8076,8692,21846,
+9719,21876,9834,21919,9866,8390,8811,9427,7814,21982,9743,9744,
+9746,8240,21991,9841,9750,21997,9749,9751,22007,7970,9453,2562,
+16595,8204,20611,
+};
+
+static pdf_cmap cmap_GBKp_EUC_H = {
+	-1, "GBKp-EUC-H", "", 0, 0, 2,
+	{ {1,0,128},{2,33088,65278}, },
+	2712, 2712, (pdf_range*) cmap_GBKp_EUC_H_ranges,
+	1851, 1851, (unsigned short*) cmap_GBKp_EUC_H_table,
+};
+
+/* GBKp-EUC-V */
+
+static const pdf_range cmap_GBKp_EUC_V_ranges[] = {
+{41378,6,0},{41386,0,598},{41387,5,7704},{41389,0,599},
+{41394,53,582},{41470,0,7706},{41889,0,578},{41896,5,580},
+{41900,0,573},{41902,0,7707},{41914,5,576},{41917,0,7708},
+{41919,0,579},{41947,0,7709},{41949,0,7710},{41951,0,600},
+{41979,0,596},{41981,6,2},
+};
+
+static const unsigned short cmap_GBKp_EUC_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GBKp_EUC_V = {
+	-1, "GBKp-EUC-V", "GBKp-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_GBKp_EUC_V_ranges,
+	4, 4, (unsigned short*) cmap_GBKp_EUC_V_table,
+};
+
+/* GBT-EUC-H */
+
+static const pdf_range cmap_GBT_EUC_H_ranges[] = {
+{32,0,7716},{33,373,814},{41377,373,96},{41649,197,190},
+{41701,37,240},{41713,45,250},{41889,373,262},{42145,329,356},
+{42401,341,439},{42657,93,525},{42689,209,549},{42913,129,602},
+{42961,129,635},{43169,125,668},{43205,149,700},{43428,301,738},
+{43681,373,814},{43937,125,908},{45217,25,940},{45224,10,0},
+{45227,5,950},{45229,5,7719},{45231,37,954},{45241,0,7721},
+{45242,21,965},{45248,0,7722},{45249,69,972},{45267,10,3},
+{45270,13,993},{45274,10,6},{45277,25,1000},{45284,0,7727},
+{45285,25,1008},{45292,5,7728},{45294,6,9},{45296,9,1019},
+{45299,0,7731},{45300,9,1023},{45303,10,11},{45306,17,1029},
+{45473,13,1034},{45477,5,7734},{45479,6,14},{45481,5,1042},
+{45483,0,7737},{45484,21,1045},{45490,6,16},{45492,5,7739},
+{45494,0,1055},{45495,9,7741},{45498,25,1059},{45505,0,7744},
+{45506,29,1067},{45514,0,7745},{45515,13,1076},{45519,5,7746},
+{45521,6,18},{45523,5,1084},{45525,0,7749},{45526,33,1087},
+{45535,9,7750},{45538,5,1099},{45540,0,7753},{45541,5,1102},
+{45543,5,7754},{45545,6,20},{45547,9,1108},{45550,0,7757},
+{45551,5,1112},{45553,0,7758},{45554,5,1115},{45556,13,7759},
+{45560,17,1121},{45565,6,22},{45729,17,1128},{45734,5,7764},
+{45736,13,1135},{45740,0,7766},{45741,29,1140},{45749,0,7767},
+{45750,9,1149},{45753,0,7768},{45754,45,1153},{45766,0,7769},
+{45767,25,1166},{45774,37,7770},{45784,21,1183},{45790,14,24},
+{45794,5,7782},{45796,41,1195},{45807,0,7784},{45808,9,1207},
+{45811,37,7785},{45821,5,1220},{45985,5,7795},{45987,0,1224},
+{45988,13,7797},{45992,6,28},{45994,13,1231},{45998,0,7802},
+{45999,21,1236},{46005,0,7803},{46006,9,1243},{46009,0,7804},
+{46010,13,1247},{46014,0,7805},{46015,9,1252},{46018,18,30},
+{46023,21,1260},{46029,10,35},{46032,5,1269},{46034,0,7811},
+{46035,21,1272},{46041,18,38},{46046,17,1283},{46051,6,43},
+{46053,5,7816},{46055,6,45},{46057,5,1294},{46059,5,7819},
+{46061,5,1298},{46063,18,47},{46068,21,1305},{46074,5,7824},
+{46076,9,1313},{46241,5,7826},{46243,5,1318},{46245,5,7828},
+{46247,13,1322},{46251,0,7830},{46252,9,1327},{46255,0,7831},
+{46256,9,1331},{46259,5,7832},{46261,9,1336},{46264,0,7834},
+{46265,21,1340},{46271,0,7835},{46272,5,1347},{46274,0,7836},
+{46275,13,1350},{46279,0,7837},{46280,5,1355},{46282,0,7838},
+{46283,5,1358},{46285,10,52},{46288,9,1363},{46291,5,7841},
+{46293,17,1368},{46298,10,55},{46301,61,1376},{46317,10,58},
+{46320,29,1395},{46328,0,7847},{46329,5,1404},{46331,0,7848},
+{46332,9,1407},{46497,5,1410},{46499,6,61},{46501,13,7850},
+{46505,9,1418},{46508,6,63},{46510,5,7855},{46512,0,1425},
+{46513,17,7857},{46518,6,65},{46520,5,1433},{46522,9,7863},
+{46525,33,1438},{46534,0,7866},{46535,13,1448},{46539,0,7867},
+{46540,13,1453},{46544,0,7868},{46545,5,1458},{46547,0,7869},
+{46548,33,1461},{46557,9,7870},{46560,9,1473},{46563,0,7873},
+{46564,5,1477},{46566,5,7874},{46568,17,1481},{46573,0,7876},
+{46574,29,1487},{46582,5,7877},{46584,17,1497},{46589,6,67},
+{46753,9,1504},{46756,5,7880},{46758,22,69},{46764,9,1515},
+{46767,5,7885},{46769,5,1520},{46771,0,7887},{46772,9,1523},
+{46775,0,7888},{46776,25,1527},{46783,9,7889},{46786,5,1537},
+{46788,10,75},{46791,21,1542},{46797,6,78},{46799,5,7895},
+{46801,5,1552},{46803,5,7897},{46805,6,80},{46807,5,1558},
+{46809,10,82},{46812,17,1563},{46817,0,7902},{46818,25,1569},
+{46825,0,7903},{46826,5,1577},{46828,6,85},{46830,5,7905},
+{46832,6,87},{46834,13,1585},{46838,0,7908},{46839,5,1590},
+{46841,6,89},{46843,5,7910},{46845,5,1596},{47009,9,7912},
+{47012,9,1601},{47015,0,7915},{47016,25,1605},{47023,5,7916},
+{47025,5,1614},{47027,0,7918},{47028,5,1617},{47030,5,7919},
+{47032,6,91},{47034,33,1623},{47043,5,7922},{47045,13,1634},
+{47049,0,7924},{47050,5,1639},{47052,0,7925},{47053,5,1642},
+{47055,10,93},{47058,17,1647},{47063,5,7928},{47065,9,1654},
+{47068,0,7930},{47069,5,1658},{47071,9,7931},{47074,6,96},
+{47076,5,1665},{47078,9,7935},{47081,5,1670},{47083,9,7938},
+{47086,6,98},{47088,13,1677},{47092,0,7942},{47093,9,1682},
+{47096,0,7943},{47097,21,1686},{47265,21,1692},{47271,5,7944},
+{47273,37,1700},{47283,5,7946},{47285,17,1712},{47290,14,100},
+{47294,5,7950},{47296,9,1723},{47299,0,7952},{47300,5,1727},
+{47302,5,7953},{47304,6,104},{47306,17,1733},{47311,0,7956},
+{47312,9,1739},{47315,13,7957},{47319,5,1746},{47321,5,7961},
+{47323,33,1750},{47332,0,7963},{47333,13,1760},{47337,10,106},
+{47340,25,1767},{47347,6,109},{47349,5,7967},{47351,6,111},
+{47353,21,1780},{47521,25,1786},{47528,0,7970},{47529,17,1794},
+{47534,0,7971},{47535,5,1800},{47537,18,113},{47542,9,1807},
+{47545,5,7975},{47547,41,1812},{47558,0,7977},{47559,13,1824},
+{47563,0,7978},{47564,13,1829},{47568,0,7979},{47569,25,1834},
+{47576,0,7980},{47577,5,1842},{47579,34,118},{47588,5,1853},
+{47590,0,7986},{47591,5,1856},{47593,13,7987},{47597,6,127},
+{47599,5,1864},{47601,6,129},{47603,9,7993},{47606,5,1871},
+{47608,10,131},{47611,5,1876},{47613,6,134},{47777,21,1880},
+{47783,0,7999},{47784,9,1887},{47787,0,8000},{47788,53,1891},
+{47802,0,8001},{47803,37,1906},{47813,0,8002},{47814,45,1917},
+{47826,0,8003},{47827,13,1930},{47831,5,8004},{47833,41,1936},
+{47844,0,8006},{47845,9,1948},{47848,0,8007},{47849,9,1952},
+{47852,0,8008},{47853,21,1956},{47859,0,5605},{47860,13,1963},
+{47864,0,8009},{47865,21,1968},{48033,9,1974},{48036,10,136},
+{48039,5,1980},{48041,5,8012},{48043,5,1984},{48045,5,8014},
+{48047,6,139},{48049,5,1990},{48051,6,141},{48053,9,8018},
+{48056,0,1997},{48057,5,8021},{48059,85,2000},{48081,6,143},
+{48083,5,8024},{48085,37,2026},{48095,33,8026},{48104,9,2045},
+{48107,0,8035},{48108,17,2049},{48113,0,8036},{48114,9,2055},
+{48117,9,8037},{48120,5,2061},{48122,0,8040},{48123,5,2064},
+{48125,6,145},{48289,6,147},{48291,5,2070},{48293,5,8043},
+{48295,0,2074},{48296,5,8045},{48298,14,149},{48302,29,2081},
+{48310,9,8049},{48313,5,2092},{48315,0,8052},{48316,17,2095},
+{48321,10,153},{48324,5,2103},{48326,5,8055},{48328,5,2107},
+{48330,6,156},{48332,5,8058},{48334,5,2113},{48336,0,8060},
+{48337,9,2116},{48340,9,8061},{48343,6,158},{48345,5,2124},
+{48347,14,160},{48351,9,8067},{48354,0,2133},{48355,5,8070},
+{48357,9,2136},{48360,6,164},{48362,9,8073},{48365,5,2144},
+{48367,17,8076},{48372,5,2151},{48374,25,8081},{48381,5,2160},
+{48545,0,2162},{48546,21,8088},{48552,9,2169},{48555,5,8094},
+{48557,5,2174},{48559,13,8096},{48563,6,166},{48565,17,2182},
+{48570,0,8101},{48571,5,2188},{48573,9,8102},{48576,0,2193},
+{48577,13,8105},{48581,9,2198},{48584,9,8109},{48587,9,2204},
+{48590,5,8112},{48592,25,2209},{48599,0,8114},{48600,5,2217},
+{48602,0,8115},{48603,17,2220},{48608,5,8116},{48610,33,2227},
+{48619,0,8118},{48620,29,2237},{48628,17,8119},{48633,13,2250},
+{48637,6,168},{48801,5,8125},{48803,5,2258},{48805,0,8127},
+{48806,5,2261},{48808,10,170},{48811,5,2266},{48813,0,8130},
+{48814,9,2269},{48817,0,8131},{48818,9,2273},{48821,9,8132},
+{48824,5,2279},{48826,0,8135},{48827,17,2282},{48832,0,8136},
+{48833,29,2288},{48841,0,8137},{48842,37,2297},{48852,0,8138},
+{48853,13,2308},{48857,0,8139},{48858,9,2313},{48861,0,8140},
+{48862,13,2317},{48866,0,8141},{48867,5,2322},{48869,18,173},
+{48874,13,2329},{48878,0,8145},{48879,21,2334},{48885,6,178},
+{48887,5,8147},{48889,5,2344},{48891,5,8149},{48893,5,2348},
+{49057,13,2350},{49061,0,8151},{49062,13,2355},{49066,0,8152},
+{49067,5,2360},{49069,0,8153},{49070,89,2363},{49093,10,180},
+{49096,21,2389},{49102,0,8156},{49103,5,2396},{49105,5,8157},
+{49107,21,2400},{49113,0,8159},{49114,29,2407},{49122,9,8160},
+{49125,13,2418},{49129,18,183},{49134,17,2427},{49139,22,188},
+{49145,5,8169},{49147,13,2440},{49313,10,194},{49316,17,2447},
+{49321,10,197},{49324,9,2455},{49327,5,8175},{49329,5,2460},
+{49331,13,8177},{49335,0,2466},{49336,49,8181},{49349,25,2480},
+{49356,5,8194},{49358,21,2489},{49364,18,200},{49369,13,2500},
+{49373,0,8199},{49374,5,2505},{49376,0,8200},{49377,29,2508},
+{49385,6,205},{49387,5,8202},{49389,5,2520},{49391,9,8204},
+{49394,13,2525},{49398,17,8207},{49403,13,2534},{49569,9,2538},
+{49572,5,8212},{49574,9,2543},{49577,17,8214},{49582,0,2551},
+{49583,37,8219},{49593,13,2562},{49597,5,8229},{49599,9,2568},
+{49602,0,8231},{49603,9,2572},{49606,0,8232},{49607,5,2576},
+{49609,0,8233},{49610,9,2579},{49613,0,8234},{49614,21,2583},
+{49620,0,8235},{49621,13,2590},{49625,9,8236},{49628,5,2597},
+{49630,0,8239},{49631,17,2600},{49636,5,8240},{49638,9,2607},
+{49641,6,207},{49643,5,8243},{49645,21,2614},{49651,10,209},
+{49654,13,2623},{49658,13,8247},{49662,0,2631},{49825,0,2632},
+{49826,25,8251},{49833,5,2640},{49835,33,8258},{49844,13,2651},
+{49848,0,8267},{49849,9,2656},{49852,5,8268},{49854,14,212},
+{49858,9,2665},{49861,9,8272},{49864,9,2671},{49867,21,8275},
+{49873,6,216},{49875,5,2682},{49877,29,8282},{49885,0,2692},
+{49886,17,8290},{49891,9,2698},{49894,9,8295},{49897,0,2704},
+{49898,17,8298},{49903,10,218},{49906,13,8304},{49910,0,2717},
+{49911,13,8308},{49915,13,2722},{50081,0,8312},{50082,29,2727},
+{50090,0,8313},{50091,5,2736},{50093,0,8314},{50094,17,2739},
+{50099,6,221},{50101,33,2746},{50110,0,8316},{50111,21,2756},
+{50117,9,8317},{50120,13,2765},{50124,10,223},{50127,21,2772},
+{50133,5,8322},{50135,5,2780},{50137,0,8324},{50138,21,2783},
+{50144,0,8325},{50145,13,2790},{50149,0,8326},{50150,25,2795},
+{50157,0,8327},{50158,5,2803},{50160,0,8328},{50161,13,2806},
+{50165,5,8329},{50167,5,2812},{50169,5,8331},{50171,5,2816},
+{50173,6,226},{50337,61,2820},{50353,0,8334},{50354,13,2837},
+{50358,0,8335},{50359,57,2842},{50374,0,8336},{50375,5,2858},
+{50377,0,8337},{50378,25,2861},{50385,6,228},{50387,13,8339},
+{50391,5,2874},{50393,0,8343},{50394,29,2877},{50402,0,8344},
+{50403,5,2886},{50405,0,8345},{50406,21,2889},{50412,0,8346},
+{50413,9,2896},{50416,5,8347},{50418,5,2901},{50420,6,230},
+{50422,9,8350},{50425,5,2908},{50427,5,8353},{50429,6,232},
+{50593,5,8356},{50595,5,2916},{50597,17,8358},{50602,25,2923},
+{50609,0,8363},{50610,9,2931},{50613,6,234},{50615,9,8365},
+{50618,14,236},{50622,53,2943},{50636,0,8370},{50637,21,2958},
+{50643,0,8371},{50644,53,2965},{50658,0,8372},{50659,13,2980},
+{50663,0,8373},{50664,45,2985},{50676,0,8374},{50677,37,2998},
+{50849,45,3008},{50861,5,8375},{50863,21,3022},{50869,5,8377},
+{50871,13,3030},{50875,0,8379},{50876,5,3035},{50878,10,240},
+{50881,5,3040},{50883,5,8382},{50885,21,3044},{50891,9,8384},
+{50894,17,3053},{50899,0,8387},{50900,9,3059},{50903,0,8388},
+{50904,69,3063},{50922,5,8389},{50924,9,3083},{50927,10,243},
+{50930,5,3089},{50932,0,8393},{50933,9,3092},{50936,0,8394},
+{50937,13,3096},{50941,6,246},{51105,5,3102},{51107,6,248},
+{51109,5,8397},{51111,0,3108},{51112,5,8399},{51114,6,250},
+{51116,5,3113},{51118,5,8402},{51120,9,3117},{51123,9,8404},
+{51126,9,3123},{51129,5,8407},{51131,5,3128},{51133,5,8409},
+{51135,14,252},{51139,5,3136},{51141,6,256},{51143,5,8414},
+{51145,9,3142},{51148,0,8416},{51149,5,3146},{51151,0,8417},
+{51152,13,3149},{51156,5,8418},{51158,6,258},{51160,21,3157},
+{51166,0,8421},{51167,5,3164},{51169,9,8422},{51172,21,3169},
+{51178,17,8425},{51183,29,3180},{51191,5,8430},{51193,5,3190},
+{51195,14,260},{51361,5,3196},{51363,0,8434},{51364,9,3199},
+{51367,5,8435},{51369,25,3204},{51376,0,8437},{51377,13,3212},
+{51381,10,264},{51384,41,3219},{51395,13,8440},{51399,6,267},
+{51401,13,3236},{51405,10,269},{51408,5,3243},{51410,0,8447},
+{51411,21,3246},{51417,0,8448},{51418,13,3253},{51422,0,8449},
+{51423,53,3258},{51437,0,8450},{51438,9,3273},{51441,9,8451},
+{51444,9,3279},{51447,5,8454},{51449,14,272},{51453,5,3288},
+{51617,0,8458},{51618,9,3291},{51621,6,276},{51623,5,8460},
+{51625,9,3298},{51628,0,8462},{51629,13,3302},{51633,0,8463},
+{51634,5,3307},{51636,0,8464},{51637,9,3310},{51640,5,8465},
+{51642,25,3315},{51649,5,8467},{51651,6,278},{51653,13,3326},
+{51657,18,280},{51662,25,3335},{51669,0,8473},{51670,21,3343},
+{51676,10,285},{51679,5,3352},{51681,18,288},{51686,5,3359},
+{51688,0,8479},{51689,25,3362},{51696,0,8480},{51697,5,3370},
+{51699,5,8481},{51701,10,293},{51704,5,8484},{51706,13,3379},
+{51710,0,8486},{51873,9,3384},{51876,9,8487},{51879,10,296},
+{51882,5,8491},{51884,17,3395},{51889,0,8493},{51890,5,3401},
+{51892,9,8494},{51895,13,3406},{51899,0,8497},{51900,37,3411},
+{51910,0,8498},{51911,9,3422},{51914,0,8499},{51915,5,3426},
+{51917,5,8500},{51919,13,3430},{51923,5,8502},{51925,13,3436},
+{51929,0,8504},{51930,13,3441},{51934,10,299},{51937,9,3448},
+{51940,0,8507},{51941,13,3452},{51945,5,8508},{51947,33,3458},
+{51956,5,8510},{51958,6,302},{51960,5,3471},{51962,0,8513},
+{51963,5,3474},{51965,6,304},{52129,21,3478},{52135,0,8515},
+{52136,9,3485},{52139,10,306},{52142,17,3491},{52147,6,309},
+{52149,5,8519},{52151,6,311},{52153,21,3502},{52159,0,8522},
+{52160,25,3509},{52167,6,313},{52169,13,8524},{52173,5,3522},
+{52175,5,8528},{52177,5,3526},{52179,10,315},{52182,33,3531},
+{52191,5,8532},{52193,9,3542},{52196,6,318},{52198,5,8535},
+{52200,5,3549},{52202,0,8537},{52203,13,3552},{52207,5,8538},
+{52209,13,3558},{52213,5,8540},{52215,6,320},{52217,21,3566},
+{52385,5,8543},{52387,17,3574},{52392,0,8545},{52393,9,3580},
+{52396,0,8546},{52397,5,3584},{52399,17,8547},{52404,9,3591},
+{52407,5,8552},{52409,17,3596},{52414,10,322},{52417,41,3604},
+{52428,18,325},{52433,17,3620},{52438,0,8559},{52439,9,3626},
+{52442,10,330},{52445,9,3632},{52448,10,333},{52451,5,3638},
+{52453,0,8564},{52454,57,3641},{52469,0,8565},{52470,9,3657},
+{52473,5,8566},{52475,0,3662},{52476,9,8568},{52641,45,3666},
+{52653,0,8571},{52654,17,3679},{52659,0,8572},{52660,9,3685},
+{52663,0,8573},{52664,13,3689},{52668,0,8574},{52669,5,3694},
+{52671,0,8575},{52672,17,3697},{52677,10,336},{52680,37,3705},
+{52690,6,339},{52692,9,8579},{52695,21,3720},{52701,0,8582},
+{52702,5,3727},{52704,0,8583},{52705,9,3730},{52708,5,8584},
+{52710,6,341},{52712,37,3737},{52722,0,8587},{52723,17,3748},
+{52728,0,8588},{52729,21,3754},{52897,9,3760},{52900,5,8589},
+{52902,6,343},{52904,5,3767},{52906,13,8592},{52910,5,3773},
+{52912,5,8596},{52914,6,345},{52916,33,3779},{52925,0,8599},
+{52926,5,3789},{52928,0,8600},{52929,13,3792},{52933,5,8601},
+{52935,14,347},{52939,9,3802},{52942,13,8605},{52946,21,3809},
+{52952,9,8609},{52955,10,351},{52958,5,8613},{52960,41,3823},
+{52971,10,354},{52974,9,3837},{52977,10,357},{52980,33,3843},
+{52989,5,8619},{53153,49,3854},{53166,10,360},{53169,5,3870},
+{53171,0,8623},{53172,9,3873},{53175,5,8624},{53177,6,363},
+{53179,5,3880},{53181,6,365},{53183,9,8628},{53186,9,3887},
+{53189,10,367},{53192,5,3893},{53194,5,8633},{53196,0,3897},
+{53197,5,8635},{53199,6,370},{53201,9,3902},{53204,17,8638},
+{53209,14,372},{53213,5,3914},{53215,0,8645},{53216,5,3917},
+{53218,0,8646},{53219,13,3920},{53223,0,8647},{53224,5,3925},
+{53226,18,376},{53231,17,3932},{53236,0,8651},{53237,13,3938},
+{53241,5,8652},{53243,9,3944},{53246,0,8654},{53409,13,3948},
+{53413,0,8655},{53414,25,3953},{53421,5,8656},{53423,9,3962},
+{53426,9,8658},{53429,17,3968},{53434,5,8661},{53436,9,3975},
+{53439,0,8663},{53440,21,3979},{53446,0,8664},{53447,13,3986},
+{53451,0,8665},{53452,85,3991},{53474,0,8666},{53475,5,4014},
+{53477,0,8667},{53478,17,4017},{53483,10,381},{53486,33,4025},
+{53495,9,8670},{53498,5,4037},{53500,0,8673},{53501,5,4040},
+{53665,5,8674},{53667,6,384},{53669,5,4046},{53671,0,8677},
+{53672,9,4049},{53675,0,8678},{53676,9,4053},{53679,9,8679},
+{53682,9,4059},{53685,9,8682},{53688,10,386},{53691,5,8686},
+{53693,33,4070},{53702,9,8688},{53705,5,4082},{53707,0,8691},
+{53708,5,4085},{53710,5,8692},{53712,17,4089},{53717,5,8694},
+{53719,25,4096},{53726,0,8696},{53727,5,4104},{53729,5,8697},
+{53731,17,4108},{53736,5,8699},{53738,5,4115},{53740,6,389},
+{53742,5,8702},{53744,6,391},{53746,5,4123},{53748,0,8705},
+{53749,5,4126},{53751,9,8706},{53754,17,4131},{53921,6,393},
+{53923,5,4138},{53925,0,8710},{53926,9,4141},{53929,0,8711},
+{53930,17,4145},{53935,0,8712},{53936,9,4151},{53939,6,395},
+{53941,5,8714},{53943,21,4158},{53949,10,397},{53952,9,4167},
+{53955,18,400},{53960,25,4175},{53967,0,8721},{53968,17,4183},
+{53973,0,8722},{53974,13,4189},{53978,0,8723},{53979,33,4194},
+{53988,5,8724},{53990,5,4205},{53992,13,8726},{53996,9,4211},
+{53999,10,405},{54002,9,4217},{54005,0,8732},{54006,5,4221},
+{54008,0,8733},{54009,5,4224},{54011,0,8734},{54012,5,4227},
+{54014,0,8735},{54177,5,4230},{54179,37,8736},{54189,6,408},
+{54191,5,4244},{54193,0,8747},{54194,5,4247},{54196,9,8748},
+{54199,6,410},{54201,5,4254},{54203,0,8752},{54204,33,4257},
+{54213,10,412},{54216,5,4269},{54218,9,8755},{54221,29,4274},
+{54229,0,8758},{54230,33,4283},{54239,5,8759},{54241,5,4294},
+{54243,0,8761},{54244,5,4297},{54246,0,8762},{54247,13,4300},
+{54251,5,8763},{54253,5,4306},{54255,0,8765},{54256,13,4309},
+{54260,0,8766},{54261,25,4314},{54268,10,415},{54433,9,4324},
+{54436,6,418},{54438,9,8770},{54441,21,4332},{54447,13,8773},
+{54451,5,4342},{54453,5,8777},{54455,6,420},{54457,9,4348},
+{54460,6,422},{54462,5,8781},{54464,13,4355},{54468,6,424},
+{54470,5,8784},{54472,10,426},{54475,13,8787},{54479,13,4370},
+{54483,0,8791},{54484,13,4375},{54488,0,8792},{54489,9,4380},
+{54492,17,8793},{54497,9,4388},{54500,10,429},{54503,25,4394},
+{54510,6,432},{54512,17,8801},{54517,13,4408},{54521,0,8806},
+{54522,13,4413},{54526,0,8807},{54689,5,8808},{54691,21,4420},
+{54697,10,434},{54700,5,4429},{54702,0,8812},{54703,5,4432},
+{54705,0,8813},{54706,9,4435},{54709,13,8814},{54713,5,4442},
+{54715,10,437},{54718,5,4447},{54720,0,8820},{54721,13,4450},
+{54725,10,440},{54728,5,4457},{54730,5,8823},{54732,6,443},
+{54734,21,4463},{54740,0,8826},{54741,29,4470},{54749,5,8827},
+{54751,14,445},{54755,25,4484},{54762,9,8831},{54765,5,4494},
+{54767,0,8834},{54768,5,4497},{54770,5,8835},{54772,9,4501},
+{54775,0,5611},{54776,25,4505},{54945,13,8837},{54949,37,4516},
+{54959,5,8841},{54961,9,4528},{54964,0,8843},{54965,21,4532},
+{54971,14,449},{54975,5,8846},{54977,9,4544},{54980,0,8848},
+{54981,17,4548},{54986,0,8849},{54987,5,4554},{54989,0,8850},
+{54990,17,4557},{54995,6,453},{54997,9,8852},{55000,5,4567},
+{55002,0,8855},{55003,13,4570},{55007,10,455},{55010,9,4577},
+{55013,6,458},{55015,5,8859},{55017,17,4584},{55022,5,8861},
+{55024,5,4591},{55026,0,8863},{55027,5,4594},{55029,5,8864},
+{55031,17,4598},{55036,9,8866},{55201,9,4606},{55204,0,8869},
+{55205,9,4610},{55208,9,8870},{55211,10,460},{55214,13,8874},
+{55218,0,4623},{55219,5,8878},{55221,10,463},{55224,17,8881},
+{55229,37,4634},{55239,0,8886},{55240,5,4645},{55242,0,8887},
+{55243,37,4648},{55253,0,8888},{55254,17,4659},{55259,13,8889},
+{55263,29,4668},{55271,6,466},{55273,5,8894},{55275,57,4680},
+{55457,137,4695},{55492,0,8896},{55493,5,4731},{55495,10,468},
+{55498,5,4736},{55500,5,8899},{55502,5,4740},{55504,5,8901},
+{55506,6,471},{55508,17,4746},{55513,6,473},{55515,5,8905},
+{55517,77,4755},{55537,0,8907},{55538,13,4776},{55542,5,8908},
+{55544,25,4782},{55713,45,4789},{55725,14,475},{55729,9,8912},
+{55732,73,4808},{55751,0,8915},{55752,17,4828},{55757,13,8916},
+{55761,45,4837},{55773,0,8920},{55774,9,4850},{55777,0,8921},
+{55778,5,4854},{55780,10,479},{55783,17,4859},{55788,0,8924},
+{55789,25,4865},{55796,5,8925},{55798,33,4874},{55969,13,4883},
+{55973,233,8927},{56032,37,4946},{56042,0,8986},{56043,45,4957},
+{56055,10,482},{56058,13,4972},{56062,0,8989},{56225,5,4977},
+{56227,0,8990},{56228,5,4980},{56230,0,8991},{56231,5,4983},
+{56233,5,8992},{56235,61,4987},{56251,10,485},{56254,65,5006},
+{56271,10,488},{56274,33,5026},{56283,0,8998},{56284,5,5036},
+{56286,0,8999},{56287,9,5039},{56290,10,491},{56293,21,5045},
+{56299,0,9002},{56300,5,5052},{56302,0,9003},{56303,5,5055},
+{56305,0,9004},{56306,9,5058},{56309,9,9005},{56312,25,5064},
+{56481,105,5071},{56508,0,9008},{56509,5,5099},{56511,0,9009},
+{56512,5,5102},{56514,0,9010},{56515,17,5105},{56520,9,9011},
+{56523,21,5113},{56529,0,9014},{56530,17,5120},{56535,0,9015},
+{56536,29,5126},{56544,0,9016},{56545,5,5135},{56547,5,9017},
+{56549,13,5139},{56553,5,9019},{56555,21,5145},{56561,0,9021},
+{56562,13,5152},{56566,0,9022},{56567,5,5157},{56569,0,9023},
+{56570,9,5160},{56573,5,9024},{56737,6,494},{56739,17,9027},
+{56744,5,5172},{56746,5,9032},{56748,21,5176},{56754,0,9034},
+{56755,5,5183},{56757,0,9035},{56758,13,5186},{56762,5,9036},
+{56764,89,5192},{56787,0,9038},{56788,25,5216},{56795,0,9039},
+{56796,5,5224},{56798,0,9040},{56799,17,5227},{56804,0,9041},
+{56805,21,5233},{56811,0,9042},{56812,17,5240},{56817,0,9043},
+{56818,13,5246},{56822,5,9044},{56824,13,5252},{56828,10,496},
+{56993,45,5259},{57005,0,9048},{57006,21,5272},{57012,0,9049},
+{57013,17,5279},{57018,0,9050},{57019,41,5285},{57030,0,9051},
+{57031,29,5297},{57039,6,499},{57041,5,9053},{57043,17,5309},
+{57048,0,9055},{57049,33,5315},{57058,0,9056},{57059,17,5325},
+{57064,0,9057},{57065,9,5331},{57068,0,9058},{57069,21,5335},
+{57075,0,9059},{57076,29,5342},{57084,0,9060},{57085,5,5351},
+{57249,0,5353},{57250,5,9061},{57252,6,501},{57254,53,5358},
+{57268,0,9064},{57269,25,5373},{57276,5,9065},{57278,6,503},
+{57280,5,5384},{57282,5,9068},{57284,29,5388},{57292,0,9070},
+{57293,9,5397},{57296,0,9071},{57297,13,5401},{57301,0,9072},
+{57302,5,5406},{57304,5,9073},{57306,5,5410},{57308,0,9075},
+{57309,9,5413},{57312,10,505},{57315,9,5419},{57318,0,9078},
+{57319,5,5423},{57321,10,508},{57324,9,5428},{57327,0,9081},
+{57328,17,5432},{57333,0,9082},{57334,9,5438},{57337,0,9083},
+{57338,17,5442},{57505,81,5447},{57526,5,9084},{57528,25,5470},
+{57535,0,9086},{57536,29,5478},{57544,0,9087},{57545,17,5487},
+{57550,0,9088},{57551,13,5493},{57555,0,9089},{57556,45,5498},
+{57568,0,9090},{57569,57,5511},{57584,0,9091},{57585,25,5527},
+{57592,0,9092},{57593,9,5535},{57596,9,9093},{57761,37,5541},
+{57771,10,511},{57774,5,5554},{57776,0,9098},{57777,9,5557},
+{57780,0,9099},{57781,21,5561},{57787,10,514},{57790,5,5570},
+{57792,5,9102},{57794,25,5574},{57801,0,9104},{57802,21,5582},
+{57808,0,9105},{57809,37,5589},{57819,0,9106},{57820,17,5600},
+{57825,6,517},{57827,13,5607},{57831,0,4504},{57832,21,5612},
+{57838,5,9108},{57840,21,5620},{57846,10,519},{57849,13,5629},
+{57853,6,522},{58017,9,5635},{58020,0,9113},{58021,9,5639},
+{58024,0,9114},{58025,69,5643},{58043,37,9115},{58053,0,4293},
+{58054,33,9125},{58063,6,524},{58065,29,5683},{58073,0,9135},
+{58074,33,5692},{58083,5,9136},{58085,6,526},{58087,5,5705},
+{58089,9,9139},{58092,45,5710},{58104,6,528},{58106,13,9143},
+{58110,0,5728},{58273,6,530},{58275,5,5731},{58277,0,9148},
+{58278,17,5734},{58283,0,9149},{58284,29,5740},{58292,0,9150},
+{58293,61,5749},{58309,89,9151},{58332,25,5788},{58339,0,9174},
+{58340,33,5796},{58349,0,9175},{58350,9,5806},{58353,5,9176},
+{58355,17,5811},{58360,0,9178},{58361,17,5817},{58366,0,9179},
+{58529,9,5823},{58532,5,9180},{58534,17,5828},{58539,0,9182},
+{58540,9,5834},{58543,9,9183},{58546,9,5840},{58549,5,9186},
+{58551,41,5845},{58562,0,9188},{58563,5,5857},{58565,0,9189},
+{58566,9,5860},{58569,0,9190},{58570,57,5864},{58585,0,9191},
+{58586,5,5880},{58588,10,532},{58591,17,5885},{58596,0,9194},
+{58597,21,5891},{58603,5,9195},{58605,17,5899},{58610,0,9197},
+{58611,41,5905},{58622,0,9198},{58785,57,5917},{58800,0,9199},
+{58801,29,5933},{58809,0,9200},{58810,49,5942},{58823,10,535},
+{58826,13,5958},{58830,0,9203},{58831,129,5963},{58864,10,538},
+{58867,33,5999},{58876,5,9206},{58878,0,6010},{59041,5,6011},
+{59043,0,9208},{59044,25,6014},{59051,5,9209},{59053,6,541},
+{59055,17,6025},{59060,5,9212},{59062,33,6032},{59071,0,9214},
+{59072,29,6042},{59080,5,9215},{59082,9,6052},{59085,0,9217},
+{59086,69,6056},{59104,121,9218},{59297,229,9249},{59355,21,6163},
+{59361,5,9307},{59363,13,6171},{59367,0,9309},{59368,25,6176},
+{59375,0,9310},{59376,13,6184},{59380,9,9311},{59383,29,6191},
+{59553,25,6199},{59560,0,9314},{59561,9,6207},{59564,0,9315},
+{59565,33,6211},{59574,6,543},{59576,9,9317},{59579,13,6225},
+{59583,5,9320},{59585,13,6231},{59589,6,545},{59591,9,9323},
+{59594,13,6240},{59598,10,547},{59601,5,6247},{59603,0,9328},
+{59604,33,6250},{59613,10,550},{59616,5,6262},{59618,5,9331},
+{59620,14,553},{59624,9,6270},{59627,18,557},{59632,33,6278},
+{59641,0,9338},{59642,5,6288},{59644,5,9339},{59646,0,6292},
+{59809,0,9341},{59810,41,6294},{59821,0,9342},{59822,21,6306},
+{59828,5,9343},{59830,6,562},{59832,45,6316},{59844,10,564},
+{59847,5,6331},{59849,0,9348},{59850,45,6334},{59862,0,9349},
+{59863,9,6347},{59866,0,9350},{59867,33,6351},{59876,6,567},
+{59878,5,9352},{59880,18,569},{59885,69,9356},{60065,17,9374},
+{60070,0,6392},{60071,5,9379},{60073,29,6395},{60081,0,9381},
+{60082,37,6404},{60092,0,9382},{60093,49,6415},{60106,0,9383},
+{60107,5,6429},{60109,0,9384},{60110,17,6432},{60115,0,9385},
+{60116,21,6438},{60122,85,9386},{60144,57,6466},{60321,21,6481},
+{60327,0,9408},{60328,5,6488},{60330,0,9409},{60331,25,6491},
+{60338,0,9410},{60339,21,6499},{60345,0,9411},{60346,61,6506},
+{60362,5,9412},{60364,6,574},{60366,29,6526},{60374,0,9415},
+{60375,9,6535},{60378,0,9416},{60379,21,6539},{60385,0,9417},
+{60386,81,6546},{60407,0,9418},{60408,25,6568},{60577,5,6575},
+{60579,0,9419},{60580,17,6578},{60585,21,9420},{60591,5,6589},
+{60593,0,9426},{60594,5,6592},{60596,5,9427},{60598,29,6596},
+{60606,5,9429},{60608,6,576},{60610,17,6608},{60615,0,9432},
+{60616,9,6614},{60619,0,9433},{60620,85,6618},{60642,0,9434},
+{60643,57,6641},{60658,0,9435},{60659,5,6657},{60661,0,9436},
+{60662,5,6660},{60664,0,9437},{60665,21,6663},{60833,0,9438},
+{60834,21,6670},{60840,0,9439},{60841,21,6677},{60847,5,9440},
+{60849,9,6685},{60852,26,578},{60859,13,6695},{60863,0,9446},
+{60864,5,6700},{60866,5,9447},{60868,29,6704},{60876,5,9449},
+{60878,17,6714},{60883,0,9451},{60884,9,6720},{60887,0,9452},
+{60888,61,6724},{60904,0,9453},{60905,17,6741},{60910,0,9454},
+{60911,37,6747},{60921,5,9455},{60923,13,6759},{61089,105,6763},
+{61116,0,9457},{61117,5,6791},{61119,0,9458},{61120,13,6794},
+{61124,233,9459},{61345,321,9518},{61426,49,6938},{61601,5,6951},
+{61603,0,9599},{61604,41,6954},{61615,169,9600},{61658,5,7008},
+{61660,5,9643},{61662,6,585},{61664,33,7014},{61673,0,9646},
+{61674,5,7024},{61676,0,9647},{61677,5,7027},{61679,0,9648},
+{61680,25,7030},{61687,10,587},{61690,5,7040},{61692,0,9651},
+{61693,5,7043},{61857,25,7045},{61864,0,9652},{61865,5,7053},
+{61867,0,9653},{61868,5,7056},{61870,0,9654},{61871,9,7059},
+{61874,0,9655},{61875,33,7063},{61884,0,9656},{61885,9,7073},
+{61888,0,9657},{61889,29,7077},{61897,0,9658},{61898,9,7086},
+{61901,6,590},{61903,5,9660},{61905,33,7093},{61914,10,592},
+{61917,25,7105},{61924,0,9664},{61925,25,7113},{61932,0,9665},
+{61933,5,7121},{61935,0,9666},{61936,25,7124},{61943,10,595},
+{61946,5,7134},{61948,9,9669},{62113,49,9672},{62126,9,7152},
+{62129,5,9685},{62131,21,7157},{62137,0,9687},{62138,33,7164},
+{62147,0,9688},{62148,17,7174},{62153,0,9689},{62154,5,7180},
+{62156,5,9690},{62158,6,598},{62160,9,7186},{62163,0,9693},
+{62164,65,7190},{62181,0,9694},{62182,29,7208},{62190,0,9695},
+{62191,29,7217},{62199,0,9696},{62200,17,7226},{62205,6,600},
+{62369,117,7233},{62399,0,9698},{62400,21,7264},{62406,10,602},
+{62409,49,7273},{62422,0,9701},{62423,5,7287},{62425,0,9702},
+{62426,41,7290},{62437,5,9703},{62439,9,7303},{62442,10,605},
+{62445,5,7309},{62447,10,608},{62450,41,7314},{62461,6,611},
+{62625,13,7327},{62629,0,9710},{62630,33,7332},{62639,0,9711},
+{62640,17,7342},{62645,0,9712},{62646,41,7348},{62657,0,9713},
+{62658,17,7360},{62663,0,9714},{62664,25,7366},{62671,5,9715},
+{62673,17,7375},{62678,0,9717},{62679,73,7381},{62698,0,9718},
+{62699,13,7401},{62703,0,9719},{62704,17,7406},{62709,0,9720},
+{62710,33,7412},{62881,17,7421},{62886,5,9721},{62888,69,7428},
+{62906,5,9723},{62908,29,7448},{62916,0,9725},{62917,9,7457},
+{62920,0,9726},{62921,17,7461},{62926,5,9727},{62928,0,7468},
+{62929,5,9729},{62931,21,7471},{62937,0,9731},{62938,5,7478},
+{62940,0,9732},{62941,33,7481},{62950,5,9733},{62952,25,7492},
+{62959,0,9735},{62960,5,7500},{62962,0,9736},{62963,33,7503},
+{62972,0,9737},{62973,5,7513},{63137,5,7515},{63139,0,9738},
+{63140,5,7518},{63142,10,613},{63145,5,7523},{63147,0,9741},
+{63148,13,7526},{63152,0,9742},{63153,5,7531},{63155,45,9743},
+{63167,21,7545},{63173,18,616},{63178,17,7556},{63183,189,9758},
+{63393,57,9806},{63408,5,7624},{63410,5,9821},{63412,6,621},
+{63414,25,7630},{63421,0,9824},{63422,17,7638},{63427,6,623},
+{63429,5,9826},{63431,9,7647},{63434,5,9828},{63436,9,7652},
+{63439,5,9830},{63441,49,7657},{63454,0,9832},{63455,5,7671},
+{63457,0,2745},{63458,61,7674},{63474,0,9833},{63475,5,7691},
+{63477,0,9834},{63478,33,7694},{63649,21,9835},{63655,10,625},
+{63658,5,9841},{63660,14,628},{63664,5,9844},{63666,14,632},
+{63670,5,9847},{63672,0,1852},{63673,5,9849},{63675,0,1987},
+{63676,13,9851},{63680,14,636},{63684,5,9856},{63686,0,2316},
+{63687,5,9858},{63689,6,640},{63691,5,2458},{63693,14,642},
+{63697,41,9863},{63708,18,646},{63713,17,9874},{63718,22,651},
+{63724,9,9880},{63727,10,657},{63730,21,9884},{63736,6,660},
+{63738,5,9890},{63740,10,662},{63905,10,665},{63908,5,9894},
+{63910,14,668},
+};
+
+static const unsigned short cmap_GBT_EUC_H_table[672] = {
+7717,948,7718,7723,991,7724,7725,998,7726,1017,7730,7732,
+1027,7733,1040,7736,7738,1052,1082,7748,1106,7756,7763,1127,
+7780,1190,7781,1192,1229,7801,7806,1256,7807,1258,7808,7809,
+1267,7810,7812,1279,7813,1281,7814,7815,1289,1292,7818,7821,
+1301,7822,1303,7823,7839,1361,7840,7843,1374,7844,7845,1393,
+7846,7849,1413,7854,1422,1431,7862,7879,1503,1509,7882,1511,
+7883,1513,7884,7892,1540,7893,7894,1549,1556,7899,7900,1561,
+7901,7904,1580,1583,7907,7909,1593,1621,7921,7926,1645,7927,
+1663,7934,1675,7941,7948,1718,7949,1720,1731,7955,7964,1765,
+7965,7966,1775,1778,7969,7972,1803,7973,1805,7974,7981,1845,
+7982,1847,7983,1849,7984,1851,7985,1862,7991,7992,1867,7996,
+1874,7997,7998,1879,8010,1978,8011,1988,8016,8017,1993,8023,
+2023,8041,2067,2068,8042,2077,8047,2079,8048,8053,2101,8054,
+8057,2110,2122,8064,8065,2127,8066,2129,8072,2140,2180,8100,
+8124,2255,8128,2264,8129,8142,2325,8143,2327,8144,8146,2341,
+8154,2387,8155,8163,2423,8164,2425,8165,8166,2433,8167,2435,
+8168,2437,8171,2445,8172,8173,2453,8174,8196,2496,8197,2498,
+8198,8201,2517,8242,2611,8245,2621,8246,2661,8270,2663,8271,
+2680,8281,2710,8303,2712,8315,7673,8320,2770,8321,8333,2819,
+8338,2869,8349,2904,2912,8355,8364,2935,2939,8368,2941,8369,
+8380,3038,8381,8391,3087,8392,8395,3101,8396,3105,3111,8401,
+3132,8411,3134,8412,8413,3139,3155,8420,8432,3193,8433,3195,
+8438,3217,8439,3234,8444,8445,3241,8446,3284,8456,3286,8457,
+8459,3295,3324,8469,8470,3331,8471,3333,8472,8474,3350,8475,
+8476,3355,8477,3357,8478,3374,8483,3376,3390,8490,3392,8505,
+3446,8506,3469,8512,8514,3477,8516,3489,8517,8518,3497,3500,
+8521,8523,3517,8530,3529,8531,8534,3546,3564,8542,8554,3602,
+8555,8556,3616,8557,3618,8558,8560,3630,8561,8562,3636,8563,
+8576,3703,8577,8578,3716,3735,8586,3765,8591,3777,8598,3798,
+8603,3800,8604,3818,8612,3820,8615,3835,8616,8617,3841,8618,
+8621,3868,8622,3878,8626,8627,3883,8631,3891,8632,3900,8637,
+3910,8643,3912,8644,8648,3928,8649,3930,8650,8668,4023,8669,
+4044,8676,4065,8685,4067,8701,4118,4121,8704,4136,8709,8713,
+4155,8716,4165,8717,8718,4171,8719,4173,8720,8730,4215,8731,
+4242,8746,4252,8751,8753,4267,8754,8767,4322,8768,8769,4328,
+4346,8779,8780,4352,8783,4360,4363,8786,4365,8798,4392,8799,
+8800,4402,8810,4427,8811,8818,4445,8819,8821,4455,8822,4461,
+8825,4480,8829,4482,8830,8844,4539,8845,4541,8851,4563,8856,
+4575,8857,8858,4581,4616,8873,4618,4626,8880,4628,8893,4677,
+8897,4734,8898,4744,8903,8904,4752,8910,4802,8911,4804,8922,
+4857,8923,8987,4970,8988,8994,5004,8995,8996,5024,8997,9000,
+5043,9001,9026,5166,9046,5257,9047,9052,5306,5356,9063,5382,
+9067,9076,5417,9077,9079,5426,9080,9096,5552,9097,9100,5568,
+9101,1962,9107,9110,5627,9111,9112,5634,5681,9134,5703,9138,
+9142,5723,5729,9147,9192,5883,9193,9201,5956,9202,9204,5997,
+9205,6023,9211,9316,6221,9322,6236,9326,6245,9327,9329,6260,
+9330,6266,9333,6268,9334,9335,6274,9336,6276,9337,6314,9345,
+9346,6329,9347,9351,6361,6364,9354,6366,9355,6368,6524,9414,
+6606,9431,9442,6689,9443,6691,9444,6693,9445,7012,9645,9649,
+7038,9650,9659,7090,9662,7103,9663,9667,7132,9668,7184,9692,
+9697,7232,9699,7271,9700,9705,7307,9706,9707,7312,9708,9709,
+7326,9739,7521,9740,9755,7552,9756,7554,9757,7628,9823,9825,
+7644,1228,1290,1304,1428,1486,9843,1526,1619,1662,9846,1732,
+2091,9855,2126,2153,2417,9860,9861,2522,9862,2554,3034,3037,
+3050,3052,3058,3218,3354,3468,3518,9879,3579,3696,9883,3747,
+4157,4313,4347,4361,9892,4513,9893,4538,4565,9896,4605,4633,
+};
+
+static pdf_cmap cmap_GBT_EUC_H = {
+	-1, "GBT-EUC-H", "", 0, 0, 2,
+	{ {1,0,128},{2,41377,65278}, },
+	1849, 1849, (pdf_range*) cmap_GBT_EUC_H_ranges,
+	672, 672, (unsigned short*) cmap_GBT_EUC_H_table,
+};
+
+/* GBT-EUC-V */
+
+static const pdf_range cmap_GBT_EUC_V_ranges[] = {
+{41378,6,0},{41386,0,598},{41387,5,7704},{41389,0,599},
+{41394,53,582},{41470,0,7706},{41889,0,578},{41896,5,580},
+{41900,0,573},{41902,0,7707},{41914,5,576},{41917,0,7708},
+{41919,0,579},{41947,0,7709},{41949,0,7710},{41951,0,600},
+{41979,0,596},{41981,6,2},
+};
+
+static const unsigned short cmap_GBT_EUC_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GBT_EUC_V = {
+	-1, "GBT-EUC-V", "GBT-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_GBT_EUC_V_ranges,
+	4, 4, (unsigned short*) cmap_GBT_EUC_V_table,
+};
+
+/* GBT-H */
+
+static const pdf_range cmap_GBT_H_ranges[] = {
+{8481,373,96},{8753,197,190},{8805,37,240},{8817,45,250},
+{8993,373,262},{9249,329,356},{9505,341,439},{9761,93,525},
+{9793,209,549},{10017,129,602},{10065,129,635},{10273,125,668},
+{10309,149,700},{10532,301,738},{10785,373,814},{11041,125,908},
+{12321,25,940},{12328,10,0},{12331,5,950},{12333,5,7719},
+{12335,37,954},{12345,0,7721},{12346,21,965},{12352,0,7722},
+{12353,69,972},{12371,10,3},{12374,13,993},{12378,10,6},
+{12381,25,1000},{12388,0,7727},{12389,25,1008},{12396,5,7728},
+{12398,6,9},{12400,9,1019},{12403,0,7731},{12404,9,1023},
+{12407,10,11},{12410,17,1029},{12577,13,1034},{12581,5,7734},
+{12583,6,14},{12585,5,1042},{12587,0,7737},{12588,21,1045},
+{12594,6,16},{12596,5,7739},{12598,0,1055},{12599,9,7741},
+{12602,25,1059},{12609,0,7744},{12610,29,1067},{12618,0,7745},
+{12619,13,1076},{12623,5,7746},{12625,6,18},{12627,5,1084},
+{12629,0,7749},{12630,33,1087},{12639,9,7750},{12642,5,1099},
+{12644,0,7753},{12645,5,1102},{12647,5,7754},{12649,6,20},
+{12651,9,1108},{12654,0,7757},{12655,5,1112},{12657,0,7758},
+{12658,5,1115},{12660,13,7759},{12664,17,1121},{12669,6,22},
+{12833,17,1128},{12838,5,7764},{12840,13,1135},{12844,0,7766},
+{12845,29,1140},{12853,0,7767},{12854,9,1149},{12857,0,7768},
+{12858,45,1153},{12870,0,7769},{12871,25,1166},{12878,37,7770},
+{12888,21,1183},{12894,14,24},{12898,5,7782},{12900,41,1195},
+{12911,0,7784},{12912,9,1207},{12915,37,7785},{12925,5,1220},
+{13089,5,7795},{13091,0,1224},{13092,13,7797},{13096,6,28},
+{13098,13,1231},{13102,0,7802},{13103,21,1236},{13109,0,7803},
+{13110,9,1243},{13113,0,7804},{13114,13,1247},{13118,0,7805},
+{13119,9,1252},{13122,18,30},{13127,21,1260},{13133,10,35},
+{13136,5,1269},{13138,0,7811},{13139,21,1272},{13145,18,38},
+{13150,17,1283},{13155,6,43},{13157,5,7816},{13159,6,45},
+{13161,5,1294},{13163,5,7819},{13165,5,1298},{13167,18,47},
+{13172,21,1305},{13178,5,7824},{13180,9,1313},{13345,5,7826},
+{13347,5,1318},{13349,5,7828},{13351,13,1322},{13355,0,7830},
+{13356,9,1327},{13359,0,7831},{13360,9,1331},{13363,5,7832},
+{13365,9,1336},{13368,0,7834},{13369,21,1340},{13375,0,7835},
+{13376,5,1347},{13378,0,7836},{13379,13,1350},{13383,0,7837},
+{13384,5,1355},{13386,0,7838},{13387,5,1358},{13389,10,52},
+{13392,9,1363},{13395,5,7841},{13397,17,1368},{13402,10,55},
+{13405,61,1376},{13421,10,58},{13424,29,1395},{13432,0,7847},
+{13433,5,1404},{13435,0,7848},{13436,9,1407},{13601,5,1410},
+{13603,6,61},{13605,13,7850},{13609,9,1418},{13612,6,63},
+{13614,5,7855},{13616,0,1425},{13617,17,7857},{13622,6,65},
+{13624,5,1433},{13626,9,7863},{13629,33,1438},{13638,0,7866},
+{13639,13,1448},{13643,0,7867},{13644,13,1453},{13648,0,7868},
+{13649,5,1458},{13651,0,7869},{13652,33,1461},{13661,9,7870},
+{13664,9,1473},{13667,0,7873},{13668,5,1477},{13670,5,7874},
+{13672,17,1481},{13677,0,7876},{13678,29,1487},{13686,5,7877},
+{13688,17,1497},{13693,6,67},{13857,9,1504},{13860,5,7880},
+{13862,22,69},{13868,9,1515},{13871,5,7885},{13873,5,1520},
+{13875,0,7887},{13876,9,1523},{13879,0,7888},{13880,25,1527},
+{13887,9,7889},{13890,5,1537},{13892,10,75},{13895,21,1542},
+{13901,6,78},{13903,5,7895},{13905,5,1552},{13907,5,7897},
+{13909,6,80},{13911,5,1558},{13913,10,82},{13916,17,1563},
+{13921,0,7902},{13922,25,1569},{13929,0,7903},{13930,5,1577},
+{13932,6,85},{13934,5,7905},{13936,6,87},{13938,13,1585},
+{13942,0,7908},{13943,5,1590},{13945,6,89},{13947,5,7910},
+{13949,5,1596},{14113,9,7912},{14116,9,1601},{14119,0,7915},
+{14120,25,1605},{14127,5,7916},{14129,5,1614},{14131,0,7918},
+{14132,5,1617},{14134,5,7919},{14136,6,91},{14138,33,1623},
+{14147,5,7922},{14149,13,1634},{14153,0,7924},{14154,5,1639},
+{14156,0,7925},{14157,5,1642},{14159,10,93},{14162,17,1647},
+{14167,5,7928},{14169,9,1654},{14172,0,7930},{14173,5,1658},
+{14175,9,7931},{14178,6,96},{14180,5,1665},{14182,9,7935},
+{14185,5,1670},{14187,9,7938},{14190,6,98},{14192,13,1677},
+{14196,0,7942},{14197,9,1682},{14200,0,7943},{14201,21,1686},
+{14369,21,1692},{14375,5,7944},{14377,37,1700},{14387,5,7946},
+{14389,17,1712},{14394,14,100},{14398,5,7950},{14400,9,1723},
+{14403,0,7952},{14404,5,1727},{14406,5,7953},{14408,6,104},
+{14410,17,1733},{14415,0,7956},{14416,9,1739},{14419,13,7957},
+{14423,5,1746},{14425,5,7961},{14427,33,1750},{14436,0,7963},
+{14437,13,1760},{14441,10,106},{14444,25,1767},{14451,6,109},
+{14453,5,7967},{14455,6,111},{14457,21,1780},{14625,25,1786},
+{14632,0,7970},{14633,17,1794},{14638,0,7971},{14639,5,1800},
+{14641,18,113},{14646,9,1807},{14649,5,7975},{14651,41,1812},
+{14662,0,7977},{14663,13,1824},{14667,0,7978},{14668,13,1829},
+{14672,0,7979},{14673,25,1834},{14680,0,7980},{14681,5,1842},
+{14683,34,118},{14692,5,1853},{14694,0,7986},{14695,5,1856},
+{14697,13,7987},{14701,6,127},{14703,5,1864},{14705,6,129},
+{14707,9,7993},{14710,5,1871},{14712,10,131},{14715,5,1876},
+{14717,6,134},{14881,21,1880},{14887,0,7999},{14888,9,1887},
+{14891,0,8000},{14892,53,1891},{14906,0,8001},{14907,37,1906},
+{14917,0,8002},{14918,45,1917},{14930,0,8003},{14931,13,1930},
+{14935,5,8004},{14937,41,1936},{14948,0,8006},{14949,9,1948},
+{14952,0,8007},{14953,9,1952},{14956,0,8008},{14957,21,1956},
+{14963,0,5605},{14964,13,1963},{14968,0,8009},{14969,21,1968},
+{15137,9,1974},{15140,10,136},{15143,5,1980},{15145,5,8012},
+{15147,5,1984},{15149,5,8014},{15151,6,139},{15153,5,1990},
+{15155,6,141},{15157,9,8018},{15160,0,1997},{15161,5,8021},
+{15163,85,2000},{15185,6,143},{15187,5,8024},{15189,37,2026},
+{15199,33,8026},{15208,9,2045},{15211,0,8035},{15212,17,2049},
+{15217,0,8036},{15218,9,2055},{15221,9,8037},{15224,5,2061},
+{15226,0,8040},{15227,5,2064},{15229,6,145},{15393,6,147},
+{15395,5,2070},{15397,5,8043},{15399,0,2074},{15400,5,8045},
+{15402,14,149},{15406,29,2081},{15414,9,8049},{15417,5,2092},
+{15419,0,8052},{15420,17,2095},{15425,10,153},{15428,5,2103},
+{15430,5,8055},{15432,5,2107},{15434,6,156},{15436,5,8058},
+{15438,5,2113},{15440,0,8060},{15441,9,2116},{15444,9,8061},
+{15447,6,158},{15449,5,2124},{15451,14,160},{15455,9,8067},
+{15458,0,2133},{15459,5,8070},{15461,9,2136},{15464,6,164},
+{15466,9,8073},{15469,5,2144},{15471,17,8076},{15476,5,2151},
+{15478,25,8081},{15485,5,2160},{15649,0,2162},{15650,21,8088},
+{15656,9,2169},{15659,5,8094},{15661,5,2174},{15663,13,8096},
+{15667,6,166},{15669,17,2182},{15674,0,8101},{15675,5,2188},
+{15677,9,8102},{15680,0,2193},{15681,13,8105},{15685,9,2198},
+{15688,9,8109},{15691,9,2204},{15694,5,8112},{15696,25,2209},
+{15703,0,8114},{15704,5,2217},{15706,0,8115},{15707,17,2220},
+{15712,5,8116},{15714,33,2227},{15723,0,8118},{15724,29,2237},
+{15732,17,8119},{15737,13,2250},{15741,6,168},{15905,5,8125},
+{15907,5,2258},{15909,0,8127},{15910,5,2261},{15912,10,170},
+{15915,5,2266},{15917,0,8130},{15918,9,2269},{15921,0,8131},
+{15922,9,2273},{15925,9,8132},{15928,5,2279},{15930,0,8135},
+{15931,17,2282},{15936,0,8136},{15937,29,2288},{15945,0,8137},
+{15946,37,2297},{15956,0,8138},{15957,13,2308},{15961,0,8139},
+{15962,9,2313},{15965,0,8140},{15966,13,2317},{15970,0,8141},
+{15971,5,2322},{15973,18,173},{15978,13,2329},{15982,0,8145},
+{15983,21,2334},{15989,6,178},{15991,5,8147},{15993,5,2344},
+{15995,5,8149},{15997,5,2348},{16161,13,2350},{16165,0,8151},
+{16166,13,2355},{16170,0,8152},{16171,5,2360},{16173,0,8153},
+{16174,89,2363},{16197,10,180},{16200,21,2389},{16206,0,8156},
+{16207,5,2396},{16209,5,8157},{16211,21,2400},{16217,0,8159},
+{16218,29,2407},{16226,9,8160},{16229,13,2418},{16233,18,183},
+{16238,17,2427},{16243,22,188},{16249,5,8169},{16251,13,2440},
+{16417,10,194},{16420,17,2447},{16425,10,197},{16428,9,2455},
+{16431,5,8175},{16433,5,2460},{16435,13,8177},{16439,0,2466},
+{16440,49,8181},{16453,25,2480},{16460,5,8194},{16462,21,2489},
+{16468,18,200},{16473,13,2500},{16477,0,8199},{16478,5,2505},
+{16480,0,8200},{16481,29,2508},{16489,6,205},{16491,5,8202},
+{16493,5,2520},{16495,9,8204},{16498,13,2525},{16502,17,8207},
+{16507,13,2534},{16673,9,2538},{16676,5,8212},{16678,9,2543},
+{16681,17,8214},{16686,0,2551},{16687,37,8219},{16697,13,2562},
+{16701,5,8229},{16703,9,2568},{16706,0,8231},{16707,9,2572},
+{16710,0,8232},{16711,5,2576},{16713,0,8233},{16714,9,2579},
+{16717,0,8234},{16718,21,2583},{16724,0,8235},{16725,13,2590},
+{16729,9,8236},{16732,5,2597},{16734,0,8239},{16735,17,2600},
+{16740,5,8240},{16742,9,2607},{16745,6,207},{16747,5,8243},
+{16749,21,2614},{16755,10,209},{16758,13,2623},{16762,13,8247},
+{16766,0,2631},{16929,0,2632},{16930,25,8251},{16937,5,2640},
+{16939,33,8258},{16948,13,2651},{16952,0,8267},{16953,9,2656},
+{16956,5,8268},{16958,14,212},{16962,9,2665},{16965,9,8272},
+{16968,9,2671},{16971,21,8275},{16977,6,216},{16979,5,2682},
+{16981,29,8282},{16989,0,2692},{16990,17,8290},{16995,9,2698},
+{16998,9,8295},{17001,0,2704},{17002,17,8298},{17007,10,218},
+{17010,13,8304},{17014,0,2717},{17015,13,8308},{17019,13,2722},
+{17185,0,8312},{17186,29,2727},{17194,0,8313},{17195,5,2736},
+{17197,0,8314},{17198,17,2739},{17203,6,221},{17205,33,2746},
+{17214,0,8316},{17215,21,2756},{17221,9,8317},{17224,13,2765},
+{17228,10,223},{17231,21,2772},{17237,5,8322},{17239,5,2780},
+{17241,0,8324},{17242,21,2783},{17248,0,8325},{17249,13,2790},
+{17253,0,8326},{17254,25,2795},{17261,0,8327},{17262,5,2803},
+{17264,0,8328},{17265,13,2806},{17269,5,8329},{17271,5,2812},
+{17273,5,8331},{17275,5,2816},{17277,6,226},{17441,61,2820},
+{17457,0,8334},{17458,13,2837},{17462,0,8335},{17463,57,2842},
+{17478,0,8336},{17479,5,2858},{17481,0,8337},{17482,25,2861},
+{17489,6,228},{17491,13,8339},{17495,5,2874},{17497,0,8343},
+{17498,29,2877},{17506,0,8344},{17507,5,2886},{17509,0,8345},
+{17510,21,2889},{17516,0,8346},{17517,9,2896},{17520,5,8347},
+{17522,5,2901},{17524,6,230},{17526,9,8350},{17529,5,2908},
+{17531,5,8353},{17533,6,232},{17697,5,8356},{17699,5,2916},
+{17701,17,8358},{17706,25,2923},{17713,0,8363},{17714,9,2931},
+{17717,6,234},{17719,9,8365},{17722,14,236},{17726,53,2943},
+{17740,0,8370},{17741,21,2958},{17747,0,8371},{17748,53,2965},
+{17762,0,8372},{17763,13,2980},{17767,0,8373},{17768,45,2985},
+{17780,0,8374},{17781,37,2998},{17953,45,3008},{17965,5,8375},
+{17967,21,3022},{17973,5,8377},{17975,13,3030},{17979,0,8379},
+{17980,5,3035},{17982,10,240},{17985,5,3040},{17987,5,8382},
+{17989,21,3044},{17995,9,8384},{17998,17,3053},{18003,0,8387},
+{18004,9,3059},{18007,0,8388},{18008,69,3063},{18026,5,8389},
+{18028,9,3083},{18031,10,243},{18034,5,3089},{18036,0,8393},
+{18037,9,3092},{18040,0,8394},{18041,13,3096},{18045,6,246},
+{18209,5,3102},{18211,6,248},{18213,5,8397},{18215,0,3108},
+{18216,5,8399},{18218,6,250},{18220,5,3113},{18222,5,8402},
+{18224,9,3117},{18227,9,8404},{18230,9,3123},{18233,5,8407},
+{18235,5,3128},{18237,5,8409},{18239,14,252},{18243,5,3136},
+{18245,6,256},{18247,5,8414},{18249,9,3142},{18252,0,8416},
+{18253,5,3146},{18255,0,8417},{18256,13,3149},{18260,5,8418},
+{18262,6,258},{18264,21,3157},{18270,0,8421},{18271,5,3164},
+{18273,9,8422},{18276,21,3169},{18282,17,8425},{18287,29,3180},
+{18295,5,8430},{18297,5,3190},{18299,14,260},{18465,5,3196},
+{18467,0,8434},{18468,9,3199},{18471,5,8435},{18473,25,3204},
+{18480,0,8437},{18481,13,3212},{18485,10,264},{18488,41,3219},
+{18499,13,8440},{18503,6,267},{18505,13,3236},{18509,10,269},
+{18512,5,3243},{18514,0,8447},{18515,21,3246},{18521,0,8448},
+{18522,13,3253},{18526,0,8449},{18527,53,3258},{18541,0,8450},
+{18542,9,3273},{18545,9,8451},{18548,9,3279},{18551,5,8454},
+{18553,14,272},{18557,5,3288},{18721,0,8458},{18722,9,3291},
+{18725,6,276},{18727,5,8460},{18729,9,3298},{18732,0,8462},
+{18733,13,3302},{18737,0,8463},{18738,5,3307},{18740,0,8464},
+{18741,9,3310},{18744,5,8465},{18746,25,3315},{18753,5,8467},
+{18755,6,278},{18757,13,3326},{18761,18,280},{18766,25,3335},
+{18773,0,8473},{18774,21,3343},{18780,10,285},{18783,5,3352},
+{18785,18,288},{18790,5,3359},{18792,0,8479},{18793,25,3362},
+{18800,0,8480},{18801,5,3370},{18803,5,8481},{18805,10,293},
+{18808,5,8484},{18810,13,3379},{18814,0,8486},{18977,9,3384},
+{18980,9,8487},{18983,10,296},{18986,5,8491},{18988,17,3395},
+{18993,0,8493},{18994,5,3401},{18996,9,8494},{18999,13,3406},
+{19003,0,8497},{19004,37,3411},{19014,0,8498},{19015,9,3422},
+{19018,0,8499},{19019,5,3426},{19021,5,8500},{19023,13,3430},
+{19027,5,8502},{19029,13,3436},{19033,0,8504},{19034,13,3441},
+{19038,10,299},{19041,9,3448},{19044,0,8507},{19045,13,3452},
+{19049,5,8508},{19051,33,3458},{19060,5,8510},{19062,6,302},
+{19064,5,3471},{19066,0,8513},{19067,5,3474},{19069,6,304},
+{19233,21,3478},{19239,0,8515},{19240,9,3485},{19243,10,306},
+{19246,17,3491},{19251,6,309},{19253,5,8519},{19255,6,311},
+{19257,21,3502},{19263,0,8522},{19264,25,3509},{19271,6,313},
+{19273,13,8524},{19277,5,3522},{19279,5,8528},{19281,5,3526},
+{19283,10,315},{19286,33,3531},{19295,5,8532},{19297,9,3542},
+{19300,6,318},{19302,5,8535},{19304,5,3549},{19306,0,8537},
+{19307,13,3552},{19311,5,8538},{19313,13,3558},{19317,5,8540},
+{19319,6,320},{19321,21,3566},{19489,5,8543},{19491,17,3574},
+{19496,0,8545},{19497,9,3580},{19500,0,8546},{19501,5,3584},
+{19503,17,8547},{19508,9,3591},{19511,5,8552},{19513,17,3596},
+{19518,10,322},{19521,41,3604},{19532,18,325},{19537,17,3620},
+{19542,0,8559},{19543,9,3626},{19546,10,330},{19549,9,3632},
+{19552,10,333},{19555,5,3638},{19557,0,8564},{19558,57,3641},
+{19573,0,8565},{19574,9,3657},{19577,5,8566},{19579,0,3662},
+{19580,9,8568},{19745,45,3666},{19757,0,8571},{19758,17,3679},
+{19763,0,8572},{19764,9,3685},{19767,0,8573},{19768,13,3689},
+{19772,0,8574},{19773,5,3694},{19775,0,8575},{19776,17,3697},
+{19781,10,336},{19784,37,3705},{19794,6,339},{19796,9,8579},
+{19799,21,3720},{19805,0,8582},{19806,5,3727},{19808,0,8583},
+{19809,9,3730},{19812,5,8584},{19814,6,341},{19816,37,3737},
+{19826,0,8587},{19827,17,3748},{19832,0,8588},{19833,21,3754},
+{20001,9,3760},{20004,5,8589},{20006,6,343},{20008,5,3767},
+{20010,13,8592},{20014,5,3773},{20016,5,8596},{20018,6,345},
+{20020,33,3779},{20029,0,8599},{20030,5,3789},{20032,0,8600},
+{20033,13,3792},{20037,5,8601},{20039,14,347},{20043,9,3802},
+{20046,13,8605},{20050,21,3809},{20056,9,8609},{20059,10,351},
+{20062,5,8613},{20064,41,3823},{20075,10,354},{20078,9,3837},
+{20081,10,357},{20084,33,3843},{20093,5,8619},{20257,49,3854},
+{20270,10,360},{20273,5,3870},{20275,0,8623},{20276,9,3873},
+{20279,5,8624},{20281,6,363},{20283,5,3880},{20285,6,365},
+{20287,9,8628},{20290,9,3887},{20293,10,367},{20296,5,3893},
+{20298,5,8633},{20300,0,3897},{20301,5,8635},{20303,6,370},
+{20305,9,3902},{20308,17,8638},{20313,14,372},{20317,5,3914},
+{20319,0,8645},{20320,5,3917},{20322,0,8646},{20323,13,3920},
+{20327,0,8647},{20328,5,3925},{20330,18,376},{20335,17,3932},
+{20340,0,8651},{20341,13,3938},{20345,5,8652},{20347,9,3944},
+{20350,0,8654},{20513,13,3948},{20517,0,8655},{20518,25,3953},
+{20525,5,8656},{20527,9,3962},{20530,9,8658},{20533,17,3968},
+{20538,5,8661},{20540,9,3975},{20543,0,8663},{20544,21,3979},
+{20550,0,8664},{20551,13,3986},{20555,0,8665},{20556,85,3991},
+{20578,0,8666},{20579,5,4014},{20581,0,8667},{20582,17,4017},
+{20587,10,381},{20590,33,4025},{20599,9,8670},{20602,5,4037},
+{20604,0,8673},{20605,5,4040},{20769,5,8674},{20771,6,384},
+{20773,5,4046},{20775,0,8677},{20776,9,4049},{20779,0,8678},
+{20780,9,4053},{20783,9,8679},{20786,9,4059},{20789,9,8682},
+{20792,10,386},{20795,5,8686},{20797,33,4070},{20806,9,8688},
+{20809,5,4082},{20811,0,8691},{20812,5,4085},{20814,5,8692},
+{20816,17,4089},{20821,5,8694},{20823,25,4096},{20830,0,8696},
+{20831,5,4104},{20833,5,8697},{20835,17,4108},{20840,5,8699},
+{20842,5,4115},{20844,6,389},{20846,5,8702},{20848,6,391},
+{20850,5,4123},{20852,0,8705},{20853,5,4126},{20855,9,8706},
+{20858,17,4131},{21025,6,393},{21027,5,4138},{21029,0,8710},
+{21030,9,4141},{21033,0,8711},{21034,17,4145},{21039,0,8712},
+{21040,9,4151},{21043,6,395},{21045,5,8714},{21047,21,4158},
+{21053,10,397},{21056,9,4167},{21059,18,400},{21064,25,4175},
+{21071,0,8721},{21072,17,4183},{21077,0,8722},{21078,13,4189},
+{21082,0,8723},{21083,33,4194},{21092,5,8724},{21094,5,4205},
+{21096,13,8726},{21100,9,4211},{21103,10,405},{21106,9,4217},
+{21109,0,8732},{21110,5,4221},{21112,0,8733},{21113,5,4224},
+{21115,0,8734},{21116,5,4227},{21118,0,8735},{21281,5,4230},
+{21283,37,8736},{21293,6,408},{21295,5,4244},{21297,0,8747},
+{21298,5,4247},{21300,9,8748},{21303,6,410},{21305,5,4254},
+{21307,0,8752},{21308,33,4257},{21317,10,412},{21320,5,4269},
+{21322,9,8755},{21325,29,4274},{21333,0,8758},{21334,33,4283},
+{21343,5,8759},{21345,5,4294},{21347,0,8761},{21348,5,4297},
+{21350,0,8762},{21351,13,4300},{21355,5,8763},{21357,5,4306},
+{21359,0,8765},{21360,13,4309},{21364,0,8766},{21365,25,4314},
+{21372,10,415},{21537,9,4324},{21540,6,418},{21542,9,8770},
+{21545,21,4332},{21551,13,8773},{21555,5,4342},{21557,5,8777},
+{21559,6,420},{21561,9,4348},{21564,6,422},{21566,5,8781},
+{21568,13,4355},{21572,6,424},{21574,5,8784},{21576,10,426},
+{21579,13,8787},{21583,13,4370},{21587,0,8791},{21588,13,4375},
+{21592,0,8792},{21593,9,4380},{21596,17,8793},{21601,9,4388},
+{21604,10,429},{21607,25,4394},{21614,6,432},{21616,17,8801},
+{21621,13,4408},{21625,0,8806},{21626,13,4413},{21630,0,8807},
+{21793,5,8808},{21795,21,4420},{21801,10,434},{21804,5,4429},
+{21806,0,8812},{21807,5,4432},{21809,0,8813},{21810,9,4435},
+{21813,13,8814},{21817,5,4442},{21819,10,437},{21822,5,4447},
+{21824,0,8820},{21825,13,4450},{21829,10,440},{21832,5,4457},
+{21834,5,8823},{21836,6,443},{21838,21,4463},{21844,0,8826},
+{21845,29,4470},{21853,5,8827},{21855,14,445},{21859,25,4484},
+{21866,9,8831},{21869,5,4494},{21871,0,8834},{21872,5,4497},
+{21874,5,8835},{21876,9,4501},{21879,0,5611},{21880,25,4505},
+{22049,13,8837},{22053,37,4516},{22063,5,8841},{22065,9,4528},
+{22068,0,8843},{22069,21,4532},{22075,14,449},{22079,5,8846},
+{22081,9,4544},{22084,0,8848},{22085,17,4548},{22090,0,8849},
+{22091,5,4554},{22093,0,8850},{22094,17,4557},{22099,6,453},
+{22101,9,8852},{22104,5,4567},{22106,0,8855},{22107,13,4570},
+{22111,10,455},{22114,9,4577},{22117,6,458},{22119,5,8859},
+{22121,17,4584},{22126,5,8861},{22128,5,4591},{22130,0,8863},
+{22131,5,4594},{22133,5,8864},{22135,17,4598},{22140,9,8866},
+{22305,9,4606},{22308,0,8869},{22309,9,4610},{22312,9,8870},
+{22315,10,460},{22318,13,8874},{22322,0,4623},{22323,5,8878},
+{22325,10,463},{22328,17,8881},{22333,37,4634},{22343,0,8886},
+{22344,5,4645},{22346,0,8887},{22347,37,4648},{22357,0,8888},
+{22358,17,4659},{22363,13,8889},{22367,29,4668},{22375,6,466},
+{22377,5,8894},{22379,57,4680},{22561,137,4695},{22596,0,8896},
+{22597,5,4731},{22599,10,468},{22602,5,4736},{22604,5,8899},
+{22606,5,4740},{22608,5,8901},{22610,6,471},{22612,17,4746},
+{22617,6,473},{22619,5,8905},{22621,77,4755},{22641,0,8907},
+{22642,13,4776},{22646,5,8908},{22648,25,4782},{22817,45,4789},
+{22829,14,475},{22833,9,8912},{22836,73,4808},{22855,0,8915},
+{22856,17,4828},{22861,13,8916},{22865,45,4837},{22877,0,8920},
+{22878,9,4850},{22881,0,8921},{22882,5,4854},{22884,10,479},
+{22887,17,4859},{22892,0,8924},{22893,25,4865},{22900,5,8925},
+{22902,33,4874},{23073,13,4883},{23077,233,8927},{23136,37,4946},
+{23146,0,8986},{23147,45,4957},{23159,10,482},{23162,13,4972},
+{23166,0,8989},{23329,5,4977},{23331,0,8990},{23332,5,4980},
+{23334,0,8991},{23335,5,4983},{23337,5,8992},{23339,61,4987},
+{23355,10,485},{23358,65,5006},{23375,10,488},{23378,33,5026},
+{23387,0,8998},{23388,5,5036},{23390,0,8999},{23391,9,5039},
+{23394,10,491},{23397,21,5045},{23403,0,9002},{23404,5,5052},
+{23406,0,9003},{23407,5,5055},{23409,0,9004},{23410,9,5058},
+{23413,9,9005},{23416,25,5064},{23585,105,5071},{23612,0,9008},
+{23613,5,5099},{23615,0,9009},{23616,5,5102},{23618,0,9010},
+{23619,17,5105},{23624,9,9011},{23627,21,5113},{23633,0,9014},
+{23634,17,5120},{23639,0,9015},{23640,29,5126},{23648,0,9016},
+{23649,5,5135},{23651,5,9017},{23653,13,5139},{23657,5,9019},
+{23659,21,5145},{23665,0,9021},{23666,13,5152},{23670,0,9022},
+{23671,5,5157},{23673,0,9023},{23674,9,5160},{23677,5,9024},
+{23841,6,494},{23843,17,9027},{23848,5,5172},{23850,5,9032},
+{23852,21,5176},{23858,0,9034},{23859,5,5183},{23861,0,9035},
+{23862,13,5186},{23866,5,9036},{23868,89,5192},{23891,0,9038},
+{23892,25,5216},{23899,0,9039},{23900,5,5224},{23902,0,9040},
+{23903,17,5227},{23908,0,9041},{23909,21,5233},{23915,0,9042},
+{23916,17,5240},{23921,0,9043},{23922,13,5246},{23926,5,9044},
+{23928,13,5252},{23932,10,496},{24097,45,5259},{24109,0,9048},
+{24110,21,5272},{24116,0,9049},{24117,17,5279},{24122,0,9050},
+{24123,41,5285},{24134,0,9051},{24135,29,5297},{24143,6,499},
+{24145,5,9053},{24147,17,5309},{24152,0,9055},{24153,33,5315},
+{24162,0,9056},{24163,17,5325},{24168,0,9057},{24169,9,5331},
+{24172,0,9058},{24173,21,5335},{24179,0,9059},{24180,29,5342},
+{24188,0,9060},{24189,5,5351},{24353,0,5353},{24354,5,9061},
+{24356,6,501},{24358,53,5358},{24372,0,9064},{24373,25,5373},
+{24380,5,9065},{24382,6,503},{24384,5,5384},{24386,5,9068},
+{24388,29,5388},{24396,0,9070},{24397,9,5397},{24400,0,9071},
+{24401,13,5401},{24405,0,9072},{24406,5,5406},{24408,5,9073},
+{24410,5,5410},{24412,0,9075},{24413,9,5413},{24416,10,505},
+{24419,9,5419},{24422,0,9078},{24423,5,5423},{24425,10,508},
+{24428,9,5428},{24431,0,9081},{24432,17,5432},{24437,0,9082},
+{24438,9,5438},{24441,0,9083},{24442,17,5442},{24609,81,5447},
+{24630,5,9084},{24632,25,5470},{24639,0,9086},{24640,29,5478},
+{24648,0,9087},{24649,17,5487},{24654,0,9088},{24655,13,5493},
+{24659,0,9089},{24660,45,5498},{24672,0,9090},{24673,57,5511},
+{24688,0,9091},{24689,25,5527},{24696,0,9092},{24697,9,5535},
+{24700,9,9093},{24865,37,5541},{24875,10,511},{24878,5,5554},
+{24880,0,9098},{24881,9,5557},{24884,0,9099},{24885,21,5561},
+{24891,10,514},{24894,5,5570},{24896,5,9102},{24898,25,5574},
+{24905,0,9104},{24906,21,5582},{24912,0,9105},{24913,37,5589},
+{24923,0,9106},{24924,17,5600},{24929,6,517},{24931,13,5607},
+{24935,0,4504},{24936,21,5612},{24942,5,9108},{24944,21,5620},
+{24950,10,519},{24953,13,5629},{24957,6,522},{25121,9,5635},
+{25124,0,9113},{25125,9,5639},{25128,0,9114},{25129,69,5643},
+{25147,37,9115},{25157,0,4293},{25158,33,9125},{25167,6,524},
+{25169,29,5683},{25177,0,9135},{25178,33,5692},{25187,5,9136},
+{25189,6,526},{25191,5,5705},{25193,9,9139},{25196,45,5710},
+{25208,6,528},{25210,13,9143},{25214,0,5728},{25377,6,530},
+{25379,5,5731},{25381,0,9148},{25382,17,5734},{25387,0,9149},
+{25388,29,5740},{25396,0,9150},{25397,61,5749},{25413,89,9151},
+{25436,25,5788},{25443,0,9174},{25444,33,5796},{25453,0,9175},
+{25454,9,5806},{25457,5,9176},{25459,17,5811},{25464,0,9178},
+{25465,17,5817},{25470,0,9179},{25633,9,5823},{25636,5,9180},
+{25638,17,5828},{25643,0,9182},{25644,9,5834},{25647,9,9183},
+{25650,9,5840},{25653,5,9186},{25655,41,5845},{25666,0,9188},
+{25667,5,5857},{25669,0,9189},{25670,9,5860},{25673,0,9190},
+{25674,57,5864},{25689,0,9191},{25690,5,5880},{25692,10,532},
+{25695,17,5885},{25700,0,9194},{25701,21,5891},{25707,5,9195},
+{25709,17,5899},{25714,0,9197},{25715,41,5905},{25726,0,9198},
+{25889,57,5917},{25904,0,9199},{25905,29,5933},{25913,0,9200},
+{25914,49,5942},{25927,10,535},{25930,13,5958},{25934,0,9203},
+{25935,129,5963},{25968,10,538},{25971,33,5999},{25980,5,9206},
+{25982,0,6010},{26145,5,6011},{26147,0,9208},{26148,25,6014},
+{26155,5,9209},{26157,6,541},{26159,17,6025},{26164,5,9212},
+{26166,33,6032},{26175,0,9214},{26176,29,6042},{26184,5,9215},
+{26186,9,6052},{26189,0,9217},{26190,69,6056},{26208,121,9218},
+{26401,229,9249},{26459,21,6163},{26465,5,9307},{26467,13,6171},
+{26471,0,9309},{26472,25,6176},{26479,0,9310},{26480,13,6184},
+{26484,9,9311},{26487,29,6191},{26657,25,6199},{26664,0,9314},
+{26665,9,6207},{26668,0,9315},{26669,33,6211},{26678,6,543},
+{26680,9,9317},{26683,13,6225},{26687,5,9320},{26689,13,6231},
+{26693,6,545},{26695,9,9323},{26698,13,6240},{26702,10,547},
+{26705,5,6247},{26707,0,9328},{26708,33,6250},{26717,10,550},
+{26720,5,6262},{26722,5,9331},{26724,14,553},{26728,9,6270},
+{26731,18,557},{26736,33,6278},{26745,0,9338},{26746,5,6288},
+{26748,5,9339},{26750,0,6292},{26913,0,9341},{26914,41,6294},
+{26925,0,9342},{26926,21,6306},{26932,5,9343},{26934,6,562},
+{26936,45,6316},{26948,10,564},{26951,5,6331},{26953,0,9348},
+{26954,45,6334},{26966,0,9349},{26967,9,6347},{26970,0,9350},
+{26971,33,6351},{26980,6,567},{26982,5,9352},{26984,18,569},
+{26989,69,9356},{27169,17,9374},{27174,0,6392},{27175,5,9379},
+{27177,29,6395},{27185,0,9381},{27186,37,6404},{27196,0,9382},
+{27197,49,6415},{27210,0,9383},{27211,5,6429},{27213,0,9384},
+{27214,17,6432},{27219,0,9385},{27220,21,6438},{27226,85,9386},
+{27248,57,6466},{27425,21,6481},{27431,0,9408},{27432,5,6488},
+{27434,0,9409},{27435,25,6491},{27442,0,9410},{27443,21,6499},
+{27449,0,9411},{27450,61,6506},{27466,5,9412},{27468,6,574},
+{27470,29,6526},{27478,0,9415},{27479,9,6535},{27482,0,9416},
+{27483,21,6539},{27489,0,9417},{27490,81,6546},{27511,0,9418},
+{27512,25,6568},{27681,5,6575},{27683,0,9419},{27684,17,6578},
+{27689,21,9420},{27695,5,6589},{27697,0,9426},{27698,5,6592},
+{27700,5,9427},{27702,29,6596},{27710,5,9429},{27712,6,576},
+{27714,17,6608},{27719,0,9432},{27720,9,6614},{27723,0,9433},
+{27724,85,6618},{27746,0,9434},{27747,57,6641},{27762,0,9435},
+{27763,5,6657},{27765,0,9436},{27766,5,6660},{27768,0,9437},
+{27769,21,6663},{27937,0,9438},{27938,21,6670},{27944,0,9439},
+{27945,21,6677},{27951,5,9440},{27953,9,6685},{27956,26,578},
+{27963,13,6695},{27967,0,9446},{27968,5,6700},{27970,5,9447},
+{27972,29,6704},{27980,5,9449},{27982,17,6714},{27987,0,9451},
+{27988,9,6720},{27991,0,9452},{27992,61,6724},{28008,0,9453},
+{28009,17,6741},{28014,0,9454},{28015,37,6747},{28025,5,9455},
+{28027,13,6759},{28193,105,6763},{28220,0,9457},{28221,5,6791},
+{28223,0,9458},{28224,13,6794},{28228,233,9459},{28449,321,9518},
+{28530,49,6938},{28705,5,6951},{28707,0,9599},{28708,41,6954},
+{28719,169,9600},{28762,5,7008},{28764,5,9643},{28766,6,585},
+{28768,33,7014},{28777,0,9646},{28778,5,7024},{28780,0,9647},
+{28781,5,7027},{28783,0,9648},{28784,25,7030},{28791,10,587},
+{28794,5,7040},{28796,0,9651},{28797,5,7043},{28961,25,7045},
+{28968,0,9652},{28969,5,7053},{28971,0,9653},{28972,5,7056},
+{28974,0,9654},{28975,9,7059},{28978,0,9655},{28979,33,7063},
+{28988,0,9656},{28989,9,7073},{28992,0,9657},{28993,29,7077},
+{29001,0,9658},{29002,9,7086},{29005,6,590},{29007,5,9660},
+{29009,33,7093},{29018,10,592},{29021,25,7105},{29028,0,9664},
+{29029,25,7113},{29036,0,9665},{29037,5,7121},{29039,0,9666},
+{29040,25,7124},{29047,10,595},{29050,5,7134},{29052,9,9669},
+{29217,49,9672},{29230,9,7152},{29233,5,9685},{29235,21,7157},
+{29241,0,9687},{29242,33,7164},{29251,0,9688},{29252,17,7174},
+{29257,0,9689},{29258,5,7180},{29260,5,9690},{29262,6,598},
+{29264,9,7186},{29267,0,9693},{29268,65,7190},{29285,0,9694},
+{29286,29,7208},{29294,0,9695},{29295,29,7217},{29303,0,9696},
+{29304,17,7226},{29309,6,600},{29473,117,7233},{29503,0,9698},
+{29504,21,7264},{29510,10,602},{29513,49,7273},{29526,0,9701},
+{29527,5,7287},{29529,0,9702},{29530,41,7290},{29541,5,9703},
+{29543,9,7303},{29546,10,605},{29549,5,7309},{29551,10,608},
+{29554,41,7314},{29565,6,611},{29729,13,7327},{29733,0,9710},
+{29734,33,7332},{29743,0,9711},{29744,17,7342},{29749,0,9712},
+{29750,41,7348},{29761,0,9713},{29762,17,7360},{29767,0,9714},
+{29768,25,7366},{29775,5,9715},{29777,17,7375},{29782,0,9717},
+{29783,73,7381},{29802,0,9718},{29803,13,7401},{29807,0,9719},
+{29808,17,7406},{29813,0,9720},{29814,33,7412},{29985,17,7421},
+{29990,5,9721},{29992,69,7428},{30010,5,9723},{30012,29,7448},
+{30020,0,9725},{30021,9,7457},{30024,0,9726},{30025,17,7461},
+{30030,5,9727},{30032,0,7468},{30033,5,9729},{30035,21,7471},
+{30041,0,9731},{30042,5,7478},{30044,0,9732},{30045,33,7481},
+{30054,5,9733},{30056,25,7492},{30063,0,9735},{30064,5,7500},
+{30066,0,9736},{30067,33,7503},{30076,0,9737},{30077,5,7513},
+{30241,5,7515},{30243,0,9738},{30244,5,7518},{30246,10,613},
+{30249,5,7523},{30251,0,9741},{30252,13,7526},{30256,0,9742},
+{30257,5,7531},{30259,45,9743},{30271,21,7545},{30277,18,616},
+{30282,17,7556},{30287,189,9758},{30497,57,9806},{30512,5,7624},
+{30514,5,9821},{30516,6,621},{30518,25,7630},{30525,0,9824},
+{30526,17,7638},{30531,6,623},{30533,5,9826},{30535,9,7647},
+{30538,5,9828},{30540,9,7652},{30543,5,9830},{30545,49,7657},
+{30558,0,9832},{30559,5,7671},{30561,0,2745},{30562,61,7674},
+{30578,0,9833},{30579,5,7691},{30581,0,9834},{30582,33,7694},
+{30753,21,9835},{30759,10,625},{30762,5,9841},{30764,14,628},
+{30768,5,9844},{30770,14,632},{30774,5,9847},{30776,0,1852},
+{30777,5,9849},{30779,0,1987},{30780,13,9851},{30784,14,636},
+{30788,5,9856},{30790,0,2316},{30791,5,9858},{30793,6,640},
+{30795,5,2458},{30797,14,642},{30801,41,9863},{30812,18,646},
+{30817,17,9874},{30822,22,651},{30828,9,9880},{30831,10,657},
+{30834,21,9884},{30840,6,660},{30842,5,9890},{30844,10,662},
+{31009,10,665},{31012,5,9894},{31014,14,668},
+};
+
+static const unsigned short cmap_GBT_H_table[672] = {
+7717,948,7718,7723,991,7724,7725,998,7726,1017,7730,7732,
+1027,7733,1040,7736,7738,1052,1082,7748,1106,7756,7763,1127,
+7780,1190,7781,1192,1229,7801,7806,1256,7807,1258,7808,7809,
+1267,7810,7812,1279,7813,1281,7814,7815,1289,1292,7818,7821,
+1301,7822,1303,7823,7839,1361,7840,7843,1374,7844,7845,1393,
+7846,7849,1413,7854,1422,1431,7862,7879,1503,1509,7882,1511,
+7883,1513,7884,7892,1540,7893,7894,1549,1556,7899,7900,1561,
+7901,7904,1580,1583,7907,7909,1593,1621,7921,7926,1645,7927,
+1663,7934,1675,7941,7948,1718,7949,1720,1731,7955,7964,1765,
+7965,7966,1775,1778,7969,7972,1803,7973,1805,7974,7981,1845,
+7982,1847,7983,1849,7984,1851,7985,1862,7991,7992,1867,7996,
+1874,7997,7998,1879,8010,1978,8011,1988,8016,8017,1993,8023,
+2023,8041,2067,2068,8042,2077,8047,2079,8048,8053,2101,8054,
+8057,2110,2122,8064,8065,2127,8066,2129,8072,2140,2180,8100,
+8124,2255,8128,2264,8129,8142,2325,8143,2327,8144,8146,2341,
+8154,2387,8155,8163,2423,8164,2425,8165,8166,2433,8167,2435,
+8168,2437,8171,2445,8172,8173,2453,8174,8196,2496,8197,2498,
+8198,8201,2517,8242,2611,8245,2621,8246,2661,8270,2663,8271,
+2680,8281,2710,8303,2712,8315,7673,8320,2770,8321,8333,2819,
+8338,2869,8349,2904,2912,8355,8364,2935,2939,8368,2941,8369,
+8380,3038,8381,8391,3087,8392,8395,3101,8396,3105,3111,8401,
+3132,8411,3134,8412,8413,3139,3155,8420,8432,3193,8433,3195,
+8438,3217,8439,3234,8444,8445,3241,8446,3284,8456,3286,8457,
+8459,3295,3324,8469,8470,3331,8471,3333,8472,8474,3350,8475,
+8476,3355,8477,3357,8478,3374,8483,3376,3390,8490,3392,8505,
+3446,8506,3469,8512,8514,3477,8516,3489,8517,8518,3497,3500,
+8521,8523,3517,8530,3529,8531,8534,3546,3564,8542,8554,3602,
+8555,8556,3616,8557,3618,8558,8560,3630,8561,8562,3636,8563,
+8576,3703,8577,8578,3716,3735,8586,3765,8591,3777,8598,3798,
+8603,3800,8604,3818,8612,3820,8615,3835,8616,8617,3841,8618,
+8621,3868,8622,3878,8626,8627,3883,8631,3891,8632,3900,8637,
+3910,8643,3912,8644,8648,3928,8649,3930,8650,8668,4023,8669,
+4044,8676,4065,8685,4067,8701,4118,4121,8704,4136,8709,8713,
+4155,8716,4165,8717,8718,4171,8719,4173,8720,8730,4215,8731,
+4242,8746,4252,8751,8753,4267,8754,8767,4322,8768,8769,4328,
+4346,8779,8780,4352,8783,4360,4363,8786,4365,8798,4392,8799,
+8800,4402,8810,4427,8811,8818,4445,8819,8821,4455,8822,4461,
+8825,4480,8829,4482,8830,8844,4539,8845,4541,8851,4563,8856,
+4575,8857,8858,4581,4616,8873,4618,4626,8880,4628,8893,4677,
+8897,4734,8898,4744,8903,8904,4752,8910,4802,8911,4804,8922,
+4857,8923,8987,4970,8988,8994,5004,8995,8996,5024,8997,9000,
+5043,9001,9026,5166,9046,5257,9047,9052,5306,5356,9063,5382,
+9067,9076,5417,9077,9079,5426,9080,9096,5552,9097,9100,5568,
+9101,1962,9107,9110,5627,9111,9112,5634,5681,9134,5703,9138,
+9142,5723,5729,9147,9192,5883,9193,9201,5956,9202,9204,5997,
+9205,6023,9211,9316,6221,9322,6236,9326,6245,9327,9329,6260,
+9330,6266,9333,6268,9334,9335,6274,9336,6276,9337,6314,9345,
+9346,6329,9347,9351,6361,6364,9354,6366,9355,6368,6524,9414,
+6606,9431,9442,6689,9443,6691,9444,6693,9445,7012,9645,9649,
+7038,9650,9659,7090,9662,7103,9663,9667,7132,9668,7184,9692,
+9697,7232,9699,7271,9700,9705,7307,9706,9707,7312,9708,9709,
+7326,9739,7521,9740,9755,7552,9756,7554,9757,7628,9823,9825,
+7644,1228,1290,1304,1428,1486,9843,1526,1619,1662,9846,1732,
+2091,9855,2126,2153,2417,9860,9861,2522,9862,2554,3034,3037,
+3050,3052,3058,3218,3354,3468,3518,9879,3579,3696,9883,3747,
+4157,4313,4347,4361,9892,4513,9893,4538,4565,9896,4605,4633,
+};
+
+static pdf_cmap cmap_GBT_H = {
+	-1, "GBT-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	1847, 1847, (pdf_range*) cmap_GBT_H_ranges,
+	672, 672, (unsigned short*) cmap_GBT_H_table,
+};
+
+/* GBT-V */
+
+static const pdf_range cmap_GBT_V_ranges[] = {
+{8482,6,0},{8490,0,598},{8491,5,7704},{8493,0,599},
+{8498,53,582},{8574,0,7706},{8993,0,578},{9000,5,580},
+{9004,0,573},{9006,0,7707},{9018,5,576},{9021,0,7708},
+{9023,0,579},{9051,0,7709},{9053,0,7710},{9055,0,600},
+{9083,0,596},{9085,6,2},
+};
+
+static const unsigned short cmap_GBT_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GBT_V = {
+	-1, "GBT-V", "GBT-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_GBT_V_ranges,
+	4, 4, (unsigned short*) cmap_GBT_V_table,
+};
+
+/* GBTpc-EUC-H */
+
+static const pdf_range cmap_GBTpc_EUC_H_ranges[] = {
+{32,377,1},{128,0,7712},{253,9,7713},{41377,373,96},
+{41649,197,190},{41701,37,240},{41713,45,250},{41889,373,262},
+{42145,329,356},{42401,341,439},{42657,93,525},{42689,209,549},
+{42913,129,602},{42961,129,635},{43169,125,668},{43205,149,700},
+{43428,301,738},{43681,373,814},{43937,125,908},{45217,25,940},
+{45224,10,0},{45227,5,950},{45229,5,7719},{45231,37,954},
+{45241,0,7721},{45242,21,965},{45248,0,7722},{45249,69,972},
+{45267,10,3},{45270,13,993},{45274,10,6},{45277,25,1000},
+{45284,0,7727},{45285,25,1008},{45292,5,7728},{45294,6,9},
+{45296,9,1019},{45299,0,7731},{45300,9,1023},{45303,10,11},
+{45306,17,1029},{45473,13,1034},{45477,5,7734},{45479,6,14},
+{45481,5,1042},{45483,0,7737},{45484,21,1045},{45490,6,16},
+{45492,5,7739},{45494,0,1055},{45495,9,7741},{45498,25,1059},
+{45505,0,7744},{45506,29,1067},{45514,0,7745},{45515,13,1076},
+{45519,5,7746},{45521,6,18},{45523,5,1084},{45525,0,7749},
+{45526,33,1087},{45535,9,7750},{45538,5,1099},{45540,0,7753},
+{45541,5,1102},{45543,5,7754},{45545,6,20},{45547,9,1108},
+{45550,0,7757},{45551,5,1112},{45553,0,7758},{45554,5,1115},
+{45556,13,7759},{45560,17,1121},{45565,6,22},{45729,17,1128},
+{45734,5,7764},{45736,13,1135},{45740,0,7766},{45741,29,1140},
+{45749,0,7767},{45750,9,1149},{45753,0,7768},{45754,45,1153},
+{45766,0,7769},{45767,25,1166},{45774,37,7770},{45784,21,1183},
+{45790,14,24},{45794,5,7782},{45796,41,1195},{45807,0,7784},
+{45808,9,1207},{45811,37,7785},{45821,5,1220},{45985,5,7795},
+{45987,0,1224},{45988,13,7797},{45992,6,28},{45994,13,1231},
+{45998,0,7802},{45999,21,1236},{46005,0,7803},{46006,9,1243},
+{46009,0,7804},{46010,13,1247},{46014,0,7805},{46015,9,1252},
+{46018,18,30},{46023,21,1260},{46029,10,35},{46032,5,1269},
+{46034,0,7811},{46035,21,1272},{46041,18,38},{46046,17,1283},
+{46051,6,43},{46053,5,7816},{46055,6,45},{46057,5,1294},
+{46059,5,7819},{46061,5,1298},{46063,18,47},{46068,21,1305},
+{46074,5,7824},{46076,9,1313},{46241,5,7826},{46243,5,1318},
+{46245,5,7828},{46247,13,1322},{46251,0,7830},{46252,9,1327},
+{46255,0,7831},{46256,9,1331},{46259,5,7832},{46261,9,1336},
+{46264,0,7834},{46265,21,1340},{46271,0,7835},{46272,5,1347},
+{46274,0,7836},{46275,13,1350},{46279,0,7837},{46280,5,1355},
+{46282,0,7838},{46283,5,1358},{46285,10,52},{46288,9,1363},
+{46291,5,7841},{46293,17,1368},{46298,10,55},{46301,61,1376},
+{46317,10,58},{46320,29,1395},{46328,0,7847},{46329,5,1404},
+{46331,0,7848},{46332,9,1407},{46497,5,1410},{46499,6,61},
+{46501,13,7850},{46505,9,1418},{46508,6,63},{46510,5,7855},
+{46512,0,1425},{46513,17,7857},{46518,6,65},{46520,5,1433},
+{46522,9,7863},{46525,33,1438},{46534,0,7866},{46535,13,1448},
+{46539,0,7867},{46540,13,1453},{46544,0,7868},{46545,5,1458},
+{46547,0,7869},{46548,33,1461},{46557,9,7870},{46560,9,1473},
+{46563,0,7873},{46564,5,1477},{46566,5,7874},{46568,17,1481},
+{46573,0,7876},{46574,29,1487},{46582,5,7877},{46584,17,1497},
+{46589,6,67},{46753,9,1504},{46756,5,7880},{46758,22,69},
+{46764,9,1515},{46767,5,7885},{46769,5,1520},{46771,0,7887},
+{46772,9,1523},{46775,0,7888},{46776,25,1527},{46783,9,7889},
+{46786,5,1537},{46788,10,75},{46791,21,1542},{46797,6,78},
+{46799,5,7895},{46801,5,1552},{46803,5,7897},{46805,6,80},
+{46807,5,1558},{46809,10,82},{46812,17,1563},{46817,0,7902},
+{46818,25,1569},{46825,0,7903},{46826,5,1577},{46828,6,85},
+{46830,5,7905},{46832,6,87},{46834,13,1585},{46838,0,7908},
+{46839,5,1590},{46841,6,89},{46843,5,7910},{46845,5,1596},
+{47009,9,7912},{47012,9,1601},{47015,0,7915},{47016,25,1605},
+{47023,5,7916},{47025,5,1614},{47027,0,7918},{47028,5,1617},
+{47030,5,7919},{47032,6,91},{47034,33,1623},{47043,5,7922},
+{47045,13,1634},{47049,0,7924},{47050,5,1639},{47052,0,7925},
+{47053,5,1642},{47055,10,93},{47058,17,1647},{47063,5,7928},
+{47065,9,1654},{47068,0,7930},{47069,5,1658},{47071,9,7931},
+{47074,6,96},{47076,5,1665},{47078,9,7935},{47081,5,1670},
+{47083,9,7938},{47086,6,98},{47088,13,1677},{47092,0,7942},
+{47093,9,1682},{47096,0,7943},{47097,21,1686},{47265,21,1692},
+{47271,5,7944},{47273,37,1700},{47283,5,7946},{47285,17,1712},
+{47290,14,100},{47294,5,7950},{47296,9,1723},{47299,0,7952},
+{47300,5,1727},{47302,5,7953},{47304,6,104},{47306,17,1733},
+{47311,0,7956},{47312,9,1739},{47315,13,7957},{47319,5,1746},
+{47321,5,7961},{47323,33,1750},{47332,0,7963},{47333,13,1760},
+{47337,10,106},{47340,25,1767},{47347,6,109},{47349,5,7967},
+{47351,6,111},{47353,21,1780},{47521,25,1786},{47528,0,7970},
+{47529,17,1794},{47534,0,7971},{47535,5,1800},{47537,18,113},
+{47542,9,1807},{47545,5,7975},{47547,41,1812},{47558,0,7977},
+{47559,13,1824},{47563,0,7978},{47564,13,1829},{47568,0,7979},
+{47569,25,1834},{47576,0,7980},{47577,5,1842},{47579,34,118},
+{47588,5,1853},{47590,0,7986},{47591,5,1856},{47593,13,7987},
+{47597,6,127},{47599,5,1864},{47601,6,129},{47603,9,7993},
+{47606,5,1871},{47608,10,131},{47611,5,1876},{47613,6,134},
+{47777,21,1880},{47783,0,7999},{47784,9,1887},{47787,0,8000},
+{47788,53,1891},{47802,0,8001},{47803,37,1906},{47813,0,8002},
+{47814,45,1917},{47826,0,8003},{47827,13,1930},{47831,5,8004},
+{47833,41,1936},{47844,0,8006},{47845,9,1948},{47848,0,8007},
+{47849,9,1952},{47852,0,8008},{47853,21,1956},{47859,0,5605},
+{47860,13,1963},{47864,0,8009},{47865,21,1968},{48033,9,1974},
+{48036,10,136},{48039,5,1980},{48041,5,8012},{48043,5,1984},
+{48045,5,8014},{48047,6,139},{48049,5,1990},{48051,6,141},
+{48053,9,8018},{48056,0,1997},{48057,5,8021},{48059,85,2000},
+{48081,6,143},{48083,5,8024},{48085,37,2026},{48095,33,8026},
+{48104,9,2045},{48107,0,8035},{48108,17,2049},{48113,0,8036},
+{48114,9,2055},{48117,9,8037},{48120,5,2061},{48122,0,8040},
+{48123,5,2064},{48125,6,145},{48289,6,147},{48291,5,2070},
+{48293,5,8043},{48295,0,2074},{48296,5,8045},{48298,14,149},
+{48302,29,2081},{48310,9,8049},{48313,5,2092},{48315,0,8052},
+{48316,17,2095},{48321,10,153},{48324,5,2103},{48326,5,8055},
+{48328,5,2107},{48330,6,156},{48332,5,8058},{48334,5,2113},
+{48336,0,8060},{48337,9,2116},{48340,9,8061},{48343,6,158},
+{48345,5,2124},{48347,14,160},{48351,9,8067},{48354,0,2133},
+{48355,5,8070},{48357,9,2136},{48360,6,164},{48362,9,8073},
+{48365,5,2144},{48367,17,8076},{48372,5,2151},{48374,25,8081},
+{48381,5,2160},{48545,0,2162},{48546,21,8088},{48552,9,2169},
+{48555,5,8094},{48557,5,2174},{48559,13,8096},{48563,6,166},
+{48565,17,2182},{48570,0,8101},{48571,5,2188},{48573,9,8102},
+{48576,0,2193},{48577,13,8105},{48581,9,2198},{48584,9,8109},
+{48587,9,2204},{48590,5,8112},{48592,25,2209},{48599,0,8114},
+{48600,5,2217},{48602,0,8115},{48603,17,2220},{48608,5,8116},
+{48610,33,2227},{48619,0,8118},{48620,29,2237},{48628,17,8119},
+{48633,13,2250},{48637,6,168},{48801,5,8125},{48803,5,2258},
+{48805,0,8127},{48806,5,2261},{48808,10,170},{48811,5,2266},
+{48813,0,8130},{48814,9,2269},{48817,0,8131},{48818,9,2273},
+{48821,9,8132},{48824,5,2279},{48826,0,8135},{48827,17,2282},
+{48832,0,8136},{48833,29,2288},{48841,0,8137},{48842,37,2297},
+{48852,0,8138},{48853,13,2308},{48857,0,8139},{48858,9,2313},
+{48861,0,8140},{48862,13,2317},{48866,0,8141},{48867,5,2322},
+{48869,18,173},{48874,13,2329},{48878,0,8145},{48879,21,2334},
+{48885,6,178},{48887,5,8147},{48889,5,2344},{48891,5,8149},
+{48893,5,2348},{49057,13,2350},{49061,0,8151},{49062,13,2355},
+{49066,0,8152},{49067,5,2360},{49069,0,8153},{49070,89,2363},
+{49093,10,180},{49096,21,2389},{49102,0,8156},{49103,5,2396},
+{49105,5,8157},{49107,21,2400},{49113,0,8159},{49114,29,2407},
+{49122,9,8160},{49125,13,2418},{49129,18,183},{49134,17,2427},
+{49139,22,188},{49145,5,8169},{49147,13,2440},{49313,10,194},
+{49316,17,2447},{49321,10,197},{49324,9,2455},{49327,5,8175},
+{49329,5,2460},{49331,13,8177},{49335,0,2466},{49336,49,8181},
+{49349,25,2480},{49356,5,8194},{49358,21,2489},{49364,18,200},
+{49369,13,2500},{49373,0,8199},{49374,5,2505},{49376,0,8200},
+{49377,29,2508},{49385,6,205},{49387,5,8202},{49389,5,2520},
+{49391,9,8204},{49394,13,2525},{49398,17,8207},{49403,13,2534},
+{49569,9,2538},{49572,5,8212},{49574,9,2543},{49577,17,8214},
+{49582,0,2551},{49583,37,8219},{49593,13,2562},{49597,5,8229},
+{49599,9,2568},{49602,0,8231},{49603,9,2572},{49606,0,8232},
+{49607,5,2576},{49609,0,8233},{49610,9,2579},{49613,0,8234},
+{49614,21,2583},{49620,0,8235},{49621,13,2590},{49625,9,8236},
+{49628,5,2597},{49630,0,8239},{49631,17,2600},{49636,5,8240},
+{49638,9,2607},{49641,6,207},{49643,5,8243},{49645,21,2614},
+{49651,10,209},{49654,13,2623},{49658,13,8247},{49662,0,2631},
+{49825,0,2632},{49826,25,8251},{49833,5,2640},{49835,33,8258},
+{49844,13,2651},{49848,0,8267},{49849,9,2656},{49852,5,8268},
+{49854,14,212},{49858,9,2665},{49861,9,8272},{49864,9,2671},
+{49867,21,8275},{49873,6,216},{49875,5,2682},{49877,29,8282},
+{49885,0,2692},{49886,17,8290},{49891,9,2698},{49894,9,8295},
+{49897,0,2704},{49898,17,8298},{49903,10,218},{49906,13,8304},
+{49910,0,2717},{49911,13,8308},{49915,13,2722},{50081,0,8312},
+{50082,29,2727},{50090,0,8313},{50091,5,2736},{50093,0,8314},
+{50094,17,2739},{50099,6,221},{50101,33,2746},{50110,0,8316},
+{50111,21,2756},{50117,9,8317},{50120,13,2765},{50124,10,223},
+{50127,21,2772},{50133,5,8322},{50135,5,2780},{50137,0,8324},
+{50138,21,2783},{50144,0,8325},{50145,13,2790},{50149,0,8326},
+{50150,25,2795},{50157,0,8327},{50158,5,2803},{50160,0,8328},
+{50161,13,2806},{50165,5,8329},{50167,5,2812},{50169,5,8331},
+{50171,5,2816},{50173,6,226},{50337,61,2820},{50353,0,8334},
+{50354,13,2837},{50358,0,8335},{50359,57,2842},{50374,0,8336},
+{50375,5,2858},{50377,0,8337},{50378,25,2861},{50385,6,228},
+{50387,13,8339},{50391,5,2874},{50393,0,8343},{50394,29,2877},
+{50402,0,8344},{50403,5,2886},{50405,0,8345},{50406,21,2889},
+{50412,0,8346},{50413,9,2896},{50416,5,8347},{50418,5,2901},
+{50420,6,230},{50422,9,8350},{50425,5,2908},{50427,5,8353},
+{50429,6,232},{50593,5,8356},{50595,5,2916},{50597,17,8358},
+{50602,25,2923},{50609,0,8363},{50610,9,2931},{50613,6,234},
+{50615,9,8365},{50618,14,236},{50622,53,2943},{50636,0,8370},
+{50637,21,2958},{50643,0,8371},{50644,53,2965},{50658,0,8372},
+{50659,13,2980},{50663,0,8373},{50664,45,2985},{50676,0,8374},
+{50677,37,2998},{50849,45,3008},{50861,5,8375},{50863,21,3022},
+{50869,5,8377},{50871,13,3030},{50875,0,8379},{50876,5,3035},
+{50878,10,240},{50881,5,3040},{50883,5,8382},{50885,21,3044},
+{50891,9,8384},{50894,17,3053},{50899,0,8387},{50900,9,3059},
+{50903,0,8388},{50904,69,3063},{50922,5,8389},{50924,9,3083},
+{50927,10,243},{50930,5,3089},{50932,0,8393},{50933,9,3092},
+{50936,0,8394},{50937,13,3096},{50941,6,246},{51105,5,3102},
+{51107,6,248},{51109,5,8397},{51111,0,3108},{51112,5,8399},
+{51114,6,250},{51116,5,3113},{51118,5,8402},{51120,9,3117},
+{51123,9,8404},{51126,9,3123},{51129,5,8407},{51131,5,3128},
+{51133,5,8409},{51135,14,252},{51139,5,3136},{51141,6,256},
+{51143,5,8414},{51145,9,3142},{51148,0,8416},{51149,5,3146},
+{51151,0,8417},{51152,13,3149},{51156,5,8418},{51158,6,258},
+{51160,21,3157},{51166,0,8421},{51167,5,3164},{51169,9,8422},
+{51172,21,3169},{51178,17,8425},{51183,29,3180},{51191,5,8430},
+{51193,5,3190},{51195,14,260},{51361,5,3196},{51363,0,8434},
+{51364,9,3199},{51367,5,8435},{51369,25,3204},{51376,0,8437},
+{51377,13,3212},{51381,10,264},{51384,41,3219},{51395,13,8440},
+{51399,6,267},{51401,13,3236},{51405,10,269},{51408,5,3243},
+{51410,0,8447},{51411,21,3246},{51417,0,8448},{51418,13,3253},
+{51422,0,8449},{51423,53,3258},{51437,0,8450},{51438,9,3273},
+{51441,9,8451},{51444,9,3279},{51447,5,8454},{51449,14,272},
+{51453,5,3288},{51617,0,8458},{51618,9,3291},{51621,6,276},
+{51623,5,8460},{51625,9,3298},{51628,0,8462},{51629,13,3302},
+{51633,0,8463},{51634,5,3307},{51636,0,8464},{51637,9,3310},
+{51640,5,8465},{51642,25,3315},{51649,5,8467},{51651,6,278},
+{51653,13,3326},{51657,18,280},{51662,25,3335},{51669,0,8473},
+{51670,21,3343},{51676,10,285},{51679,5,3352},{51681,18,288},
+{51686,5,3359},{51688,0,8479},{51689,25,3362},{51696,0,8480},
+{51697,5,3370},{51699,5,8481},{51701,10,293},{51704,5,8484},
+{51706,13,3379},{51710,0,8486},{51873,9,3384},{51876,9,8487},
+{51879,10,296},{51882,5,8491},{51884,17,3395},{51889,0,8493},
+{51890,5,3401},{51892,9,8494},{51895,13,3406},{51899,0,8497},
+{51900,37,3411},{51910,0,8498},{51911,9,3422},{51914,0,8499},
+{51915,5,3426},{51917,5,8500},{51919,13,3430},{51923,5,8502},
+{51925,13,3436},{51929,0,8504},{51930,13,3441},{51934,10,299},
+{51937,9,3448},{51940,0,8507},{51941,13,3452},{51945,5,8508},
+{51947,33,3458},{51956,5,8510},{51958,6,302},{51960,5,3471},
+{51962,0,8513},{51963,5,3474},{51965,6,304},{52129,21,3478},
+{52135,0,8515},{52136,9,3485},{52139,10,306},{52142,17,3491},
+{52147,6,309},{52149,5,8519},{52151,6,311},{52153,21,3502},
+{52159,0,8522},{52160,25,3509},{52167,6,313},{52169,13,8524},
+{52173,5,3522},{52175,5,8528},{52177,5,3526},{52179,10,315},
+{52182,33,3531},{52191,5,8532},{52193,9,3542},{52196,6,318},
+{52198,5,8535},{52200,5,3549},{52202,0,8537},{52203,13,3552},
+{52207,5,8538},{52209,13,3558},{52213,5,8540},{52215,6,320},
+{52217,21,3566},{52385,5,8543},{52387,17,3574},{52392,0,8545},
+{52393,9,3580},{52396,0,8546},{52397,5,3584},{52399,17,8547},
+{52404,9,3591},{52407,5,8552},{52409,17,3596},{52414,10,322},
+{52417,41,3604},{52428,18,325},{52433,17,3620},{52438,0,8559},
+{52439,9,3626},{52442,10,330},{52445,9,3632},{52448,10,333},
+{52451,5,3638},{52453,0,8564},{52454,57,3641},{52469,0,8565},
+{52470,9,3657},{52473,5,8566},{52475,0,3662},{52476,9,8568},
+{52641,45,3666},{52653,0,8571},{52654,17,3679},{52659,0,8572},
+{52660,9,3685},{52663,0,8573},{52664,13,3689},{52668,0,8574},
+{52669,5,3694},{52671,0,8575},{52672,17,3697},{52677,10,336},
+{52680,37,3705},{52690,6,339},{52692,9,8579},{52695,21,3720},
+{52701,0,8582},{52702,5,3727},{52704,0,8583},{52705,9,3730},
+{52708,5,8584},{52710,6,341},{52712,37,3737},{52722,0,8587},
+{52723,17,3748},{52728,0,8588},{52729,21,3754},{52897,9,3760},
+{52900,5,8589},{52902,6,343},{52904,5,3767},{52906,13,8592},
+{52910,5,3773},{52912,5,8596},{52914,6,345},{52916,33,3779},
+{52925,0,8599},{52926,5,3789},{52928,0,8600},{52929,13,3792},
+{52933,5,8601},{52935,14,347},{52939,9,3802},{52942,13,8605},
+{52946,21,3809},{52952,9,8609},{52955,10,351},{52958,5,8613},
+{52960,41,3823},{52971,10,354},{52974,9,3837},{52977,10,357},
+{52980,33,3843},{52989,5,8619},{53153,49,3854},{53166,10,360},
+{53169,5,3870},{53171,0,8623},{53172,9,3873},{53175,5,8624},
+{53177,6,363},{53179,5,3880},{53181,6,365},{53183,9,8628},
+{53186,9,3887},{53189,10,367},{53192,5,3893},{53194,5,8633},
+{53196,0,3897},{53197,5,8635},{53199,6,370},{53201,9,3902},
+{53204,17,8638},{53209,14,372},{53213,5,3914},{53215,0,8645},
+{53216,5,3917},{53218,0,8646},{53219,13,3920},{53223,0,8647},
+{53224,5,3925},{53226,18,376},{53231,17,3932},{53236,0,8651},
+{53237,13,3938},{53241,5,8652},{53243,9,3944},{53246,0,8654},
+{53409,13,3948},{53413,0,8655},{53414,25,3953},{53421,5,8656},
+{53423,9,3962},{53426,9,8658},{53429,17,3968},{53434,5,8661},
+{53436,9,3975},{53439,0,8663},{53440,21,3979},{53446,0,8664},
+{53447,13,3986},{53451,0,8665},{53452,85,3991},{53474,0,8666},
+{53475,5,4014},{53477,0,8667},{53478,17,4017},{53483,10,381},
+{53486,33,4025},{53495,9,8670},{53498,5,4037},{53500,0,8673},
+{53501,5,4040},{53665,5,8674},{53667,6,384},{53669,5,4046},
+{53671,0,8677},{53672,9,4049},{53675,0,8678},{53676,9,4053},
+{53679,9,8679},{53682,9,4059},{53685,9,8682},{53688,10,386},
+{53691,5,8686},{53693,33,4070},{53702,9,8688},{53705,5,4082},
+{53707,0,8691},{53708,5,4085},{53710,5,8692},{53712,17,4089},
+{53717,5,8694},{53719,25,4096},{53726,0,8696},{53727,5,4104},
+{53729,5,8697},{53731,17,4108},{53736,5,8699},{53738,5,4115},
+{53740,6,389},{53742,5,8702},{53744,6,391},{53746,5,4123},
+{53748,0,8705},{53749,5,4126},{53751,9,8706},{53754,17,4131},
+{53921,6,393},{53923,5,4138},{53925,0,8710},{53926,9,4141},
+{53929,0,8711},{53930,17,4145},{53935,0,8712},{53936,9,4151},
+{53939,6,395},{53941,5,8714},{53943,21,4158},{53949,10,397},
+{53952,9,4167},{53955,18,400},{53960,25,4175},{53967,0,8721},
+{53968,17,4183},{53973,0,8722},{53974,13,4189},{53978,0,8723},
+{53979,33,4194},{53988,5,8724},{53990,5,4205},{53992,13,8726},
+{53996,9,4211},{53999,10,405},{54002,9,4217},{54005,0,8732},
+{54006,5,4221},{54008,0,8733},{54009,5,4224},{54011,0,8734},
+{54012,5,4227},{54014,0,8735},{54177,5,4230},{54179,37,8736},
+{54189,6,408},{54191,5,4244},{54193,0,8747},{54194,5,4247},
+{54196,9,8748},{54199,6,410},{54201,5,4254},{54203,0,8752},
+{54204,33,4257},{54213,10,412},{54216,5,4269},{54218,9,8755},
+{54221,29,4274},{54229,0,8758},{54230,33,4283},{54239,5,8759},
+{54241,5,4294},{54243,0,8761},{54244,5,4297},{54246,0,8762},
+{54247,13,4300},{54251,5,8763},{54253,5,4306},{54255,0,8765},
+{54256,13,4309},{54260,0,8766},{54261,25,4314},{54268,10,415},
+{54433,9,4324},{54436,6,418},{54438,9,8770},{54441,21,4332},
+{54447,13,8773},{54451,5,4342},{54453,5,8777},{54455,6,420},
+{54457,9,4348},{54460,6,422},{54462,5,8781},{54464,13,4355},
+{54468,6,424},{54470,5,8784},{54472,10,426},{54475,13,8787},
+{54479,13,4370},{54483,0,8791},{54484,13,4375},{54488,0,8792},
+{54489,9,4380},{54492,17,8793},{54497,9,4388},{54500,10,429},
+{54503,25,4394},{54510,6,432},{54512,17,8801},{54517,13,4408},
+{54521,0,8806},{54522,13,4413},{54526,0,8807},{54689,5,8808},
+{54691,21,4420},{54697,10,434},{54700,5,4429},{54702,0,8812},
+{54703,5,4432},{54705,0,8813},{54706,9,4435},{54709,13,8814},
+{54713,5,4442},{54715,10,437},{54718,5,4447},{54720,0,8820},
+{54721,13,4450},{54725,10,440},{54728,5,4457},{54730,5,8823},
+{54732,6,443},{54734,21,4463},{54740,0,8826},{54741,29,4470},
+{54749,5,8827},{54751,14,445},{54755,25,4484},{54762,9,8831},
+{54765,5,4494},{54767,0,8834},{54768,5,4497},{54770,5,8835},
+{54772,9,4501},{54775,0,5611},{54776,25,4505},{54945,13,8837},
+{54949,37,4516},{54959,5,8841},{54961,9,4528},{54964,0,8843},
+{54965,21,4532},{54971,14,449},{54975,5,8846},{54977,9,4544},
+{54980,0,8848},{54981,17,4548},{54986,0,8849},{54987,5,4554},
+{54989,0,8850},{54990,17,4557},{54995,6,453},{54997,9,8852},
+{55000,5,4567},{55002,0,8855},{55003,13,4570},{55007,10,455},
+{55010,9,4577},{55013,6,458},{55015,5,8859},{55017,17,4584},
+{55022,5,8861},{55024,5,4591},{55026,0,8863},{55027,5,4594},
+{55029,5,8864},{55031,17,4598},{55036,9,8866},{55201,9,4606},
+{55204,0,8869},{55205,9,4610},{55208,9,8870},{55211,10,460},
+{55214,13,8874},{55218,0,4623},{55219,5,8878},{55221,10,463},
+{55224,17,8881},{55229,37,4634},{55239,0,8886},{55240,5,4645},
+{55242,0,8887},{55243,37,4648},{55253,0,8888},{55254,17,4659},
+{55259,13,8889},{55263,29,4668},{55271,6,466},{55273,5,8894},
+{55275,57,4680},{55457,137,4695},{55492,0,8896},{55493,5,4731},
+{55495,10,468},{55498,5,4736},{55500,5,8899},{55502,5,4740},
+{55504,5,8901},{55506,6,471},{55508,17,4746},{55513,6,473},
+{55515,5,8905},{55517,77,4755},{55537,0,8907},{55538,13,4776},
+{55542,5,8908},{55544,25,4782},{55713,45,4789},{55725,14,475},
+{55729,9,8912},{55732,73,4808},{55751,0,8915},{55752,17,4828},
+{55757,13,8916},{55761,45,4837},{55773,0,8920},{55774,9,4850},
+{55777,0,8921},{55778,5,4854},{55780,10,479},{55783,17,4859},
+{55788,0,8924},{55789,25,4865},{55796,5,8925},{55798,33,4874},
+{55969,13,4883},{55973,233,8927},{56032,37,4946},{56042,0,8986},
+{56043,45,4957},{56055,10,482},{56058,13,4972},{56062,0,8989},
+{56225,5,4977},{56227,0,8990},{56228,5,4980},{56230,0,8991},
+{56231,5,4983},{56233,5,8992},{56235,61,4987},{56251,10,485},
+{56254,65,5006},{56271,10,488},{56274,33,5026},{56283,0,8998},
+{56284,5,5036},{56286,0,8999},{56287,9,5039},{56290,10,491},
+{56293,21,5045},{56299,0,9002},{56300,5,5052},{56302,0,9003},
+{56303,5,5055},{56305,0,9004},{56306,9,5058},{56309,9,9005},
+{56312,25,5064},{56481,105,5071},{56508,0,9008},{56509,5,5099},
+{56511,0,9009},{56512,5,5102},{56514,0,9010},{56515,17,5105},
+{56520,9,9011},{56523,21,5113},{56529,0,9014},{56530,17,5120},
+{56535,0,9015},{56536,29,5126},{56544,0,9016},{56545,5,5135},
+{56547,5,9017},{56549,13,5139},{56553,5,9019},{56555,21,5145},
+{56561,0,9021},{56562,13,5152},{56566,0,9022},{56567,5,5157},
+{56569,0,9023},{56570,9,5160},{56573,5,9024},{56737,6,494},
+{56739,17,9027},{56744,5,5172},{56746,5,9032},{56748,21,5176},
+{56754,0,9034},{56755,5,5183},{56757,0,9035},{56758,13,5186},
+{56762,5,9036},{56764,89,5192},{56787,0,9038},{56788,25,5216},
+{56795,0,9039},{56796,5,5224},{56798,0,9040},{56799,17,5227},
+{56804,0,9041},{56805,21,5233},{56811,0,9042},{56812,17,5240},
+{56817,0,9043},{56818,13,5246},{56822,5,9044},{56824,13,5252},
+{56828,10,496},{56993,45,5259},{57005,0,9048},{57006,21,5272},
+{57012,0,9049},{57013,17,5279},{57018,0,9050},{57019,41,5285},
+{57030,0,9051},{57031,29,5297},{57039,6,499},{57041,5,9053},
+{57043,17,5309},{57048,0,9055},{57049,33,5315},{57058,0,9056},
+{57059,17,5325},{57064,0,9057},{57065,9,5331},{57068,0,9058},
+{57069,21,5335},{57075,0,9059},{57076,29,5342},{57084,0,9060},
+{57085,5,5351},{57249,0,5353},{57250,5,9061},{57252,6,501},
+{57254,53,5358},{57268,0,9064},{57269,25,5373},{57276,5,9065},
+{57278,6,503},{57280,5,5384},{57282,5,9068},{57284,29,5388},
+{57292,0,9070},{57293,9,5397},{57296,0,9071},{57297,13,5401},
+{57301,0,9072},{57302,5,5406},{57304,5,9073},{57306,5,5410},
+{57308,0,9075},{57309,9,5413},{57312,10,505},{57315,9,5419},
+{57318,0,9078},{57319,5,5423},{57321,10,508},{57324,9,5428},
+{57327,0,9081},{57328,17,5432},{57333,0,9082},{57334,9,5438},
+{57337,0,9083},{57338,17,5442},{57505,81,5447},{57526,5,9084},
+{57528,25,5470},{57535,0,9086},{57536,29,5478},{57544,0,9087},
+{57545,17,5487},{57550,0,9088},{57551,13,5493},{57555,0,9089},
+{57556,45,5498},{57568,0,9090},{57569,57,5511},{57584,0,9091},
+{57585,25,5527},{57592,0,9092},{57593,9,5535},{57596,9,9093},
+{57761,37,5541},{57771,10,511},{57774,5,5554},{57776,0,9098},
+{57777,9,5557},{57780,0,9099},{57781,21,5561},{57787,10,514},
+{57790,5,5570},{57792,5,9102},{57794,25,5574},{57801,0,9104},
+{57802,21,5582},{57808,0,9105},{57809,37,5589},{57819,0,9106},
+{57820,17,5600},{57825,6,517},{57827,13,5607},{57831,0,4504},
+{57832,21,5612},{57838,5,9108},{57840,21,5620},{57846,10,519},
+{57849,13,5629},{57853,6,522},{58017,9,5635},{58020,0,9113},
+{58021,9,5639},{58024,0,9114},{58025,69,5643},{58043,37,9115},
+{58053,0,4293},{58054,33,9125},{58063,6,524},{58065,29,5683},
+{58073,0,9135},{58074,33,5692},{58083,5,9136},{58085,6,526},
+{58087,5,5705},{58089,9,9139},{58092,45,5710},{58104,6,528},
+{58106,13,9143},{58110,0,5728},{58273,6,530},{58275,5,5731},
+{58277,0,9148},{58278,17,5734},{58283,0,9149},{58284,29,5740},
+{58292,0,9150},{58293,61,5749},{58309,89,9151},{58332,25,5788},
+{58339,0,9174},{58340,33,5796},{58349,0,9175},{58350,9,5806},
+{58353,5,9176},{58355,17,5811},{58360,0,9178},{58361,17,5817},
+{58366,0,9179},{58529,9,5823},{58532,5,9180},{58534,17,5828},
+{58539,0,9182},{58540,9,5834},{58543,9,9183},{58546,9,5840},
+{58549,5,9186},{58551,41,5845},{58562,0,9188},{58563,5,5857},
+{58565,0,9189},{58566,9,5860},{58569,0,9190},{58570,57,5864},
+{58585,0,9191},{58586,5,5880},{58588,10,532},{58591,17,5885},
+{58596,0,9194},{58597,21,5891},{58603,5,9195},{58605,17,5899},
+{58610,0,9197},{58611,41,5905},{58622,0,9198},{58785,57,5917},
+{58800,0,9199},{58801,29,5933},{58809,0,9200},{58810,49,5942},
+{58823,10,535},{58826,13,5958},{58830,0,9203},{58831,129,5963},
+{58864,10,538},{58867,33,5999},{58876,5,9206},{58878,0,6010},
+{59041,5,6011},{59043,0,9208},{59044,25,6014},{59051,5,9209},
+{59053,6,541},{59055,17,6025},{59060,5,9212},{59062,33,6032},
+{59071,0,9214},{59072,29,6042},{59080,5,9215},{59082,9,6052},
+{59085,0,9217},{59086,69,6056},{59104,121,9218},{59297,229,9249},
+{59355,21,6163},{59361,5,9307},{59363,13,6171},{59367,0,9309},
+{59368,25,6176},{59375,0,9310},{59376,13,6184},{59380,9,9311},
+{59383,29,6191},{59553,25,6199},{59560,0,9314},{59561,9,6207},
+{59564,0,9315},{59565,33,6211},{59574,6,543},{59576,9,9317},
+{59579,13,6225},{59583,5,9320},{59585,13,6231},{59589,6,545},
+{59591,9,9323},{59594,13,6240},{59598,10,547},{59601,5,6247},
+{59603,0,9328},{59604,33,6250},{59613,10,550},{59616,5,6262},
+{59618,5,9331},{59620,14,553},{59624,9,6270},{59627,18,557},
+{59632,33,6278},{59641,0,9338},{59642,5,6288},{59644,5,9339},
+{59646,0,6292},{59809,0,9341},{59810,41,6294},{59821,0,9342},
+{59822,21,6306},{59828,5,9343},{59830,6,562},{59832,45,6316},
+{59844,10,564},{59847,5,6331},{59849,0,9348},{59850,45,6334},
+{59862,0,9349},{59863,9,6347},{59866,0,9350},{59867,33,6351},
+{59876,6,567},{59878,5,9352},{59880,18,569},{59885,69,9356},
+{60065,17,9374},{60070,0,6392},{60071,5,9379},{60073,29,6395},
+{60081,0,9381},{60082,37,6404},{60092,0,9382},{60093,49,6415},
+{60106,0,9383},{60107,5,6429},{60109,0,9384},{60110,17,6432},
+{60115,0,9385},{60116,21,6438},{60122,85,9386},{60144,57,6466},
+{60321,21,6481},{60327,0,9408},{60328,5,6488},{60330,0,9409},
+{60331,25,6491},{60338,0,9410},{60339,21,6499},{60345,0,9411},
+{60346,61,6506},{60362,5,9412},{60364,6,574},{60366,29,6526},
+{60374,0,9415},{60375,9,6535},{60378,0,9416},{60379,21,6539},
+{60385,0,9417},{60386,81,6546},{60407,0,9418},{60408,25,6568},
+{60577,5,6575},{60579,0,9419},{60580,17,6578},{60585,21,9420},
+{60591,5,6589},{60593,0,9426},{60594,5,6592},{60596,5,9427},
+{60598,29,6596},{60606,5,9429},{60608,6,576},{60610,17,6608},
+{60615,0,9432},{60616,9,6614},{60619,0,9433},{60620,85,6618},
+{60642,0,9434},{60643,57,6641},{60658,0,9435},{60659,5,6657},
+{60661,0,9436},{60662,5,6660},{60664,0,9437},{60665,21,6663},
+{60833,0,9438},{60834,21,6670},{60840,0,9439},{60841,21,6677},
+{60847,5,9440},{60849,9,6685},{60852,26,578},{60859,13,6695},
+{60863,0,9446},{60864,5,6700},{60866,5,9447},{60868,29,6704},
+{60876,5,9449},{60878,17,6714},{60883,0,9451},{60884,9,6720},
+{60887,0,9452},{60888,61,6724},{60904,0,9453},{60905,17,6741},
+{60910,0,9454},{60911,37,6747},{60921,5,9455},{60923,13,6759},
+{61089,105,6763},{61116,0,9457},{61117,5,6791},{61119,0,9458},
+{61120,13,6794},{61124,233,9459},{61345,321,9518},{61426,49,6938},
+{61601,5,6951},{61603,0,9599},{61604,41,6954},{61615,169,9600},
+{61658,5,7008},{61660,5,9643},{61662,6,585},{61664,33,7014},
+{61673,0,9646},{61674,5,7024},{61676,0,9647},{61677,5,7027},
+{61679,0,9648},{61680,25,7030},{61687,10,587},{61690,5,7040},
+{61692,0,9651},{61693,5,7043},{61857,25,7045},{61864,0,9652},
+{61865,5,7053},{61867,0,9653},{61868,5,7056},{61870,0,9654},
+{61871,9,7059},{61874,0,9655},{61875,33,7063},{61884,0,9656},
+{61885,9,7073},{61888,0,9657},{61889,29,7077},{61897,0,9658},
+{61898,9,7086},{61901,6,590},{61903,5,9660},{61905,33,7093},
+{61914,10,592},{61917,25,7105},{61924,0,9664},{61925,25,7113},
+{61932,0,9665},{61933,5,7121},{61935,0,9666},{61936,25,7124},
+{61943,10,595},{61946,5,7134},{61948,9,9669},{62113,49,9672},
+{62126,9,7152},{62129,5,9685},{62131,21,7157},{62137,0,9687},
+{62138,33,7164},{62147,0,9688},{62148,17,7174},{62153,0,9689},
+{62154,5,7180},{62156,5,9690},{62158,6,598},{62160,9,7186},
+{62163,0,9693},{62164,65,7190},{62181,0,9694},{62182,29,7208},
+{62190,0,9695},{62191,29,7217},{62199,0,9696},{62200,17,7226},
+{62205,6,600},{62369,117,7233},{62399,0,9698},{62400,21,7264},
+{62406,10,602},{62409,49,7273},{62422,0,9701},{62423,5,7287},
+{62425,0,9702},{62426,41,7290},{62437,5,9703},{62439,9,7303},
+{62442,10,605},{62445,5,7309},{62447,10,608},{62450,41,7314},
+{62461,6,611},{62625,13,7327},{62629,0,9710},{62630,33,7332},
+{62639,0,9711},{62640,17,7342},{62645,0,9712},{62646,41,7348},
+{62657,0,9713},{62658,17,7360},{62663,0,9714},{62664,25,7366},
+{62671,5,9715},{62673,17,7375},{62678,0,9717},{62679,73,7381},
+{62698,0,9718},{62699,13,7401},{62703,0,9719},{62704,17,7406},
+{62709,0,9720},{62710,33,7412},{62881,17,7421},{62886,5,9721},
+{62888,69,7428},{62906,5,9723},{62908,29,7448},{62916,0,9725},
+{62917,9,7457},{62920,0,9726},{62921,17,7461},{62926,5,9727},
+{62928,0,7468},{62929,5,9729},{62931,21,7471},{62937,0,9731},
+{62938,5,7478},{62940,0,9732},{62941,33,7481},{62950,5,9733},
+{62952,25,7492},{62959,0,9735},{62960,5,7500},{62962,0,9736},
+{62963,33,7503},{62972,0,9737},{62973,5,7513},{63137,5,7515},
+{63139,0,9738},{63140,5,7518},{63142,10,613},{63145,5,7523},
+{63147,0,9741},{63148,13,7526},{63152,0,9742},{63153,5,7531},
+{63155,45,9743},{63167,21,7545},{63173,18,616},{63178,17,7556},
+{63183,189,9758},{63393,57,9806},{63408,5,7624},{63410,5,9821},
+{63412,6,621},{63414,25,7630},{63421,0,9824},{63422,17,7638},
+{63427,6,623},{63429,5,9826},{63431,9,7647},{63434,5,9828},
+{63436,9,7652},{63439,5,9830},{63441,49,7657},{63454,0,9832},
+{63455,5,7671},{63457,0,2745},{63458,61,7674},{63474,0,9833},
+{63475,5,7691},{63477,0,9834},{63478,33,7694},{63649,21,9835},
+{63655,10,625},{63658,5,9841},{63660,14,628},{63664,5,9844},
+{63666,14,632},{63670,5,9847},{63672,0,1852},{63673,5,9849},
+{63675,0,1987},{63676,13,9851},{63680,14,636},{63684,5,9856},
+{63686,0,2316},{63687,5,9858},{63689,6,640},{63691,5,2458},
+{63693,14,642},{63697,41,9863},{63708,18,646},{63713,17,9874},
+{63718,22,651},{63724,9,9880},{63727,10,657},{63730,21,9884},
+{63736,6,660},{63738,5,9890},{63740,10,662},{63905,10,665},
+{63908,5,9894},{63910,14,668},
+};
+
+static const unsigned short cmap_GBTpc_EUC_H_table[672] = {
+7717,948,7718,7723,991,7724,7725,998,7726,1017,7730,7732,
+1027,7733,1040,7736,7738,1052,1082,7748,1106,7756,7763,1127,
+7780,1190,7781,1192,1229,7801,7806,1256,7807,1258,7808,7809,
+1267,7810,7812,1279,7813,1281,7814,7815,1289,1292,7818,7821,
+1301,7822,1303,7823,7839,1361,7840,7843,1374,7844,7845,1393,
+7846,7849,1413,7854,1422,1431,7862,7879,1503,1509,7882,1511,
+7883,1513,7884,7892,1540,7893,7894,1549,1556,7899,7900,1561,
+7901,7904,1580,1583,7907,7909,1593,1621,7921,7926,1645,7927,
+1663,7934,1675,7941,7948,1718,7949,1720,1731,7955,7964,1765,
+7965,7966,1775,1778,7969,7972,1803,7973,1805,7974,7981,1845,
+7982,1847,7983,1849,7984,1851,7985,1862,7991,7992,1867,7996,
+1874,7997,7998,1879,8010,1978,8011,1988,8016,8017,1993,8023,
+2023,8041,2067,2068,8042,2077,8047,2079,8048,8053,2101,8054,
+8057,2110,2122,8064,8065,2127,8066,2129,8072,2140,2180,8100,
+8124,2255,8128,2264,8129,8142,2325,8143,2327,8144,8146,2341,
+8154,2387,8155,8163,2423,8164,2425,8165,8166,2433,8167,2435,
+8168,2437,8171,2445,8172,8173,2453,8174,8196,2496,8197,2498,
+8198,8201,2517,8242,2611,8245,2621,8246,2661,8270,2663,8271,
+2680,8281,2710,8303,2712,8315,7673,8320,2770,8321,8333,2819,
+8338,2869,8349,2904,2912,8355,8364,2935,2939,8368,2941,8369,
+8380,3038,8381,8391,3087,8392,8395,3101,8396,3105,3111,8401,
+3132,8411,3134,8412,8413,3139,3155,8420,8432,3193,8433,3195,
+8438,3217,8439,3234,8444,8445,3241,8446,3284,8456,3286,8457,
+8459,3295,3324,8469,8470,3331,8471,3333,8472,8474,3350,8475,
+8476,3355,8477,3357,8478,3374,8483,3376,3390,8490,3392,8505,
+3446,8506,3469,8512,8514,3477,8516,3489,8517,8518,3497,3500,
+8521,8523,3517,8530,3529,8531,8534,3546,3564,8542,8554,3602,
+8555,8556,3616,8557,3618,8558,8560,3630,8561,8562,3636,8563,
+8576,3703,8577,8578,3716,3735,8586,3765,8591,3777,8598,3798,
+8603,3800,8604,3818,8612,3820,8615,3835,8616,8617,3841,8618,
+8621,3868,8622,3878,8626,8627,3883,8631,3891,8632,3900,8637,
+3910,8643,3912,8644,8648,3928,8649,3930,8650,8668,4023,8669,
+4044,8676,4065,8685,4067,8701,4118,4121,8704,4136,8709,8713,
+4155,8716,4165,8717,8718,4171,8719,4173,8720,8730,4215,8731,
+4242,8746,4252,8751,8753,4267,8754,8767,4322,8768,8769,4328,
+4346,8779,8780,4352,8783,4360,4363,8786,4365,8798,4392,8799,
+8800,4402,8810,4427,8811,8818,4445,8819,8821,4455,8822,4461,
+8825,4480,8829,4482,8830,8844,4539,8845,4541,8851,4563,8856,
+4575,8857,8858,4581,4616,8873,4618,4626,8880,4628,8893,4677,
+8897,4734,8898,4744,8903,8904,4752,8910,4802,8911,4804,8922,
+4857,8923,8987,4970,8988,8994,5004,8995,8996,5024,8997,9000,
+5043,9001,9026,5166,9046,5257,9047,9052,5306,5356,9063,5382,
+9067,9076,5417,9077,9079,5426,9080,9096,5552,9097,9100,5568,
+9101,1962,9107,9110,5627,9111,9112,5634,5681,9134,5703,9138,
+9142,5723,5729,9147,9192,5883,9193,9201,5956,9202,9204,5997,
+9205,6023,9211,9316,6221,9322,6236,9326,6245,9327,9329,6260,
+9330,6266,9333,6268,9334,9335,6274,9336,6276,9337,6314,9345,
+9346,6329,9347,9351,6361,6364,9354,6366,9355,6368,6524,9414,
+6606,9431,9442,6689,9443,6691,9444,6693,9445,7012,9645,9649,
+7038,9650,9659,7090,9662,7103,9663,9667,7132,9668,7184,9692,
+9697,7232,9699,7271,9700,9705,7307,9706,9707,7312,9708,9709,
+7326,9739,7521,9740,9755,7552,9756,7554,9757,7628,9823,9825,
+7644,1228,1290,1304,1428,1486,9843,1526,1619,1662,9846,1732,
+2091,9855,2126,2153,2417,9860,9861,2522,9862,2554,3034,3037,
+3050,3052,3058,3218,3354,3468,3518,9879,3579,3696,9883,3747,
+4157,4313,4347,4361,9892,4513,9893,4538,4565,9896,4605,4633,
+};
+
+static pdf_cmap cmap_GBTpc_EUC_H = {
+	-1, "GBTpc-EUC-H", "", 0, 0, 3,
+	{ {1,0,128},{2,41377,64766},{1,253,255}, },
+	1850, 1850, (pdf_range*) cmap_GBTpc_EUC_H_ranges,
+	672, 672, (unsigned short*) cmap_GBTpc_EUC_H_table,
+};
+
+/* GBTpc-EUC-V */
+
+static const pdf_range cmap_GBTpc_EUC_V_ranges[] = {
+{41378,6,0},{41386,0,598},{41387,5,7704},{41389,0,599},
+{41394,53,582},{41470,0,7706},{41889,0,578},{41896,5,580},
+{41900,0,573},{41902,0,7707},{41914,5,576},{41917,0,7708},
+{41919,0,579},{41947,0,7709},{41949,0,7710},{41951,0,600},
+{41979,0,596},{41981,6,2},
+};
+
+static const unsigned short cmap_GBTpc_EUC_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GBTpc_EUC_V = {
+	-1, "GBTpc-EUC-V", "GBTpc-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_GBTpc_EUC_V_ranges,
+	4, 4, (unsigned short*) cmap_GBTpc_EUC_V_table,
+};
+
+/* GBpc-EUC-H */
+
+static const pdf_range cmap_GBpc_EUC_H_ranges[] = {
+{32,377,1},{128,0,7712},{253,9,7713},{41377,373,96},
+{41649,197,190},{41701,37,240},{41713,45,250},{41889,373,262},
+{42145,329,356},{42401,341,439},{42657,93,525},{42689,209,549},
+{42913,129,602},{42961,129,635},{43169,125,668},{43205,149,700},
+{43428,301,738},{43681,373,814},{43937,125,908},{45217,373,940},
+{45473,373,1034},{45729,373,1128},{45985,373,1222},{46241,373,1316},
+{46497,373,1410},{46753,373,1504},{47009,373,1598},{47265,373,1692},
+{47521,373,1786},{47777,373,1880},{48033,373,1974},{48289,373,2068},
+{48545,373,2162},{48801,373,2256},{49057,373,2350},{49313,373,2444},
+{49569,373,2538},{49825,373,2632},{50081,373,2726},{50337,373,2820},
+{50593,373,2914},{50849,373,3008},{51105,373,3102},{51361,373,3196},
+{51617,373,3290},{51873,373,3384},{52129,373,3478},{52385,373,3572},
+{52641,373,3666},{52897,373,3760},{53153,373,3854},{53409,373,3948},
+{53665,373,4042},{53921,373,4136},{54177,373,4230},{54433,373,4324},
+{54689,373,4418},{54945,373,4512},{55201,353,4606},{55457,373,4695},
+{55713,373,4789},{55969,373,4883},{56225,373,4977},{56481,373,5071},
+{56737,373,5165},{56993,373,5259},{57249,373,5353},{57505,373,5447},
+{57761,373,5541},{58017,373,5635},{58273,373,5729},{58529,373,5823},
+{58785,373,5917},{59041,373,6011},{59297,373,6105},{59553,373,6199},
+{59809,373,6293},{60065,373,6387},{60321,373,6481},{60577,373,6575},
+{60833,373,6669},{61089,373,6763},{61345,373,6857},{61601,373,6951},
+{61857,373,7045},{62113,373,7139},{62369,373,7233},{62625,373,7327},
+{62881,373,7421},{63137,373,7515},{63393,373,7609},
+};
+
+static const unsigned short cmap_GBpc_EUC_H_table[] = { 0 };
+
+static pdf_cmap cmap_GBpc_EUC_H = {
+	-1, "GBpc-EUC-H", "", 0, 0, 3,
+	{ {1,0,128},{2,41377,64766},{1,253,255}, },
+	91, 91, (pdf_range*) cmap_GBpc_EUC_H_ranges,
+	0, 0, (unsigned short*) cmap_GBpc_EUC_H_table,
+};
+
+/* GBpc-EUC-V */
+
+static const pdf_range cmap_GBpc_EUC_V_ranges[] = {
+{41378,6,0},{41386,0,598},{41387,5,7704},{41389,0,599},
+{41394,53,582},{41470,0,7706},{41889,0,578},{41896,5,580},
+{41900,0,573},{41902,0,7707},{41914,5,576},{41917,0,7708},
+{41919,0,579},{41947,0,7709},{41949,0,7710},{41951,0,600},
+{41979,0,596},{41981,6,2},
+};
+
+static const unsigned short cmap_GBpc_EUC_V_table[4] = {
+575,574,597,7711,
+};
+
+static pdf_cmap cmap_GBpc_EUC_V = {
+	-1, "GBpc-EUC-V", "GBpc-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_GBpc_EUC_V_ranges,
+	4, 4, (unsigned short*) cmap_GBpc_EUC_V_table,
+};
+
+/* UniGB-UCS2-H */
+
+static const pdf_range cmap_UniGB_UCS2_H_ranges[] = {
+{32,377,1},{164,6,0},{167,6,2},{176,6,4},
+{215,0,128},{224,6,6},{232,10,8},{236,6,11},
+{242,6,13},{247,0,129},{249,6,15},{252,0,692},
+{257,0,668},{275,0,672},{283,0,674},{299,0,676},
+{333,0,680},{363,0,684},{462,0,670},{464,0,678},
+{466,0,682},{468,0,686},{470,0,688},{472,0,689},
+{474,0,690},{476,0,691},{505,0,698},{711,0,101},
+{713,0,100},{714,5,9907},{729,0,9909},{913,65,525},
+{931,25,542},{945,65,549},{963,25,566},{1025,0,608},
+{1040,21,602},{1046,125,609},{1078,101,642},{1105,0,641},
+{7743,0,695},{8208,0,10018},{8211,14,17},{8216,5,109},
+{8220,5,111},{8229,6,21},{8240,0,170},{8242,5,163},
+{8245,0,9913},{8251,0,184},{8364,0,22353},{8451,0,165},
+{8453,0,9914},{8457,0,9915},{8470,0,172},{8481,0,10016},
+{8544,45,250},{8560,37,9897},{8592,5,186},{8594,6,23},
+{8598,13,9916},{8712,0,137},{8719,0,134},{8721,0,133},
+{8725,0,9920},{8730,0,139},{8733,14,25},{8739,0,9922},
+{8741,0,141},{8743,5,131},{8745,10,29},{8750,0,146},
+{8756,14,32},{8765,0,150},{8776,0,149},{8780,0,148},
+{8786,0,9923},{8800,6,36},{8804,5,155},{8806,5,9924},
+{8814,5,153},{8853,0,9988},{8857,0,144},{8869,0,140},
+{8895,0,9926},{8943,0,108},{8978,0,143},{9312,37,230},
+{9332,77,210},{9352,77,190},{9472,301,738},{9552,141,9927},
+{9601,57,9963},{9619,9,9978},{9632,6,38},{9650,6,40},
+{9660,5,9981},{9670,6,42},{9675,0,175},{9678,6,44},
+{9698,13,9983},{9733,6,46},{9737,0,9987},{9792,0,161},
+{9794,0,160},{11904,6,48},{11906,5,22429},{11908,0,22051},
+{11909,9,22431},{11912,0,22054},{11913,5,22434},{11915,6,50},
+{11917,37,22436},{11927,0,22061},{11928,5,22446},{11931,45,22448},
+{11943,0,22074},{11944,5,22460},{11946,0,22077},{11947,9,22462},
+{11950,0,22080},{11951,13,22465},{11955,0,22082},{11956,5,22469},
+{11958,5,22083},{11960,9,22471},{11963,0,22088},{11964,53,22474},
+{11978,0,22098},{11979,161,22488},{12032,854,52},{12272,45,10060},
+{12288,9,96},{12291,0,103},{12293,10,266},{12296,29,115},
+{12304,5,125},{12306,6,269},{12308,5,113},{12310,5,123},
+{12317,5,9990},{12321,33,9992},{12339,9,22395},{12344,9,22398},
+{12350,6,271},{12353,329,356},{12436,0,22375},{12443,5,10020},
+{12445,5,10025},{12449,341,439},{12535,13,22390},{12539,6,273},
+{12541,5,10022},{12549,145,700},{12586,9,22401},{12704,93,22404},
+{12832,37,240},{12849,0,10017},{12963,0,10001},{13198,5,10002},
+{13212,9,10004},{13217,0,10007},{13252,0,10008},{13262,0,10009},
+{13265,5,10010},{13269,0,10012},{13312,281,22529},{13383,0,22053},
+{13384,169,22600},{13427,0,22052},{13428,1189,22643},{13726,0,22057},
+{13727,441,22941},{13838,0,22059},{13839,41,23052},{13850,0,22058},
+{13851,3057,23063},{14616,0,22063},{14617,337,23828},{14702,0,22062},
+{14703,381,23913},{14799,6,275},{14801,53,24009},{14815,0,22066},
+{14816,585,24023},{14963,0,22067},{14964,869,24170},{15182,0,22071},
+{15183,1145,24388},{15470,0,22072},{15471,449,24675},{15584,0,22073},
+{15585,3537,24788},{16470,0,22078},{16471,1053,25673},{16735,0,22079},
+{16736,1881,25937},{17207,0,22081},{17208,461,26408},{17324,0,22087},
+{17325,13,26524},{17329,0,22086},{17330,169,26528},{17373,0,22089},
+{17374,989,26571},{17622,0,22090},{17623,1489,26819},{17996,0,22092},
+{17997,77,27192},{18017,0,22091},{18018,769,27212},{18211,0,22094},
+{18212,17,27405},{18217,0,22095},{18218,325,27410},{18300,0,22096},
+{18301,61,27492},{18317,0,22097},{18318,1761,27508},{18759,0,22099},
+{18760,197,27949},{18810,0,22100},{18811,5,27999},{18813,0,22101},
+{18814,13,28001},{18818,5,22102},{18820,0,28005},{18821,5,22104},
+{18823,77,28006},{18843,0,22107},{18844,9,28026},{18847,0,22106},
+{18848,85,28029},{18870,6,277},{18872,2809,28051},{19575,0,22116},
+{19576,153,28754},{19615,9,22113},{19618,6,279},{19620,441,28793},
+{19731,25,22118},{19738,589,28904},{19886,0,22125},{19887,25,29052},
+{19968,14,281},{19972,9,10073},{19975,94,285},{19999,9,10079},
+{20002,46,309},{20014,5,10085},{20016,62,321},{20032,9,10092},
+{20035,90,337},{20058,5,10101},{20060,22,360},{20066,13,10103},
+{20070,0,3456},{20071,5,10107},{20073,0,4726},{20074,21,10109},
+{20080,14,366},{20084,37,10116},{20094,0,3113},{20095,9,10126},
+{20098,0,8281},{20099,9,10129},{20102,62,370},{20118,5,10135},
+{20120,14,386},{20124,5,10138},{20126,66,390},{20143,9,10142},
+{20146,14,407},{20150,13,10146},{20154,6,411},{20156,9,10150},
+{20159,62,413},{20175,5,10155},{20177,34,429},{20186,9,10158},
+{20189,34,438},{20198,5,10163},{20200,18,447},{20205,9,10166},
+{20208,30,452},{20216,9,10171},{20219,26,460},{20226,25,10177},
+{20233,6,467},{20235,5,10184},{20237,18,469},{20242,17,10186},
+{20247,18,474},{20252,5,10191},{20254,38,479},{20264,5,10195},
+{20266,6,489},{20268,9,10197},{20271,58,491},{20286,17,10206},
+{20291,0,1481},{20292,5,10211},{20294,0,1420},{20295,21,10213},
+{20301,78,506},{20321,5,10222},{20323,26,526},{20330,5,10226},
+{20332,0,2491},{20333,5,10228},{20335,6,533},{20337,5,10230},
+{20339,14,535},{20343,13,10233},{20347,18,539},{20352,9,10238},
+{20355,58,544},{20370,5,10247},{20372,14,559},{20376,9,10250},
+{20379,10,563},{20382,5,10254},{20384,0,3885},{20385,5,10256},
+{20387,50,566},{20400,17,10261},{20405,0,3155},{20406,33,10266},
+{20415,0,1100},{20416,5,10275},{20418,14,579},{20422,13,10277},
+{20426,0,2350},{20427,9,10281},{20430,14,583},{20434,17,10284},
+{20439,50,587},{20452,5,10292},{20454,18,600},{20459,5,10295},
+{20461,26,605},{20468,13,10299},{20472,10,612},{20475,9,10304},
+{20478,10,615},{20481,17,10308},{20486,0,8214},{20487,5,10313},
+{20489,46,618},{20501,9,10319},{20504,18,630},{20509,5,10323},
+{20511,10,635},{20514,9,10326},{20517,38,638},{20527,41,10330},
+{20538,18,648},{20543,13,10343},{20547,0,4828},{20548,9,10347},
+{20551,10,653},{20554,5,10350},{20556,14,656},{20560,17,10353},
+{20565,0,4829},{20566,13,10358},{20570,10,660},{20573,29,10363},
+{20581,0,2162},{20582,21,10371},{20588,0,4832},{20589,25,10377},
+{20596,14,663},{20600,9,10384},{20603,0,4833},{20604,5,10387},
+{20606,10,667},{20609,13,10389},{20613,0,1712},{20614,5,10393},
+{20616,0,2535},{20617,13,10395},{20621,0,1027},{20622,29,10399},
+{20630,14,670},{20634,29,10408},{20642,30,674},{20650,5,10418},
+{20652,6,682},{20654,13,10420},{20658,22,684},{20664,5,10425},
+{20666,6,690},{20668,5,10427},{20670,0,8424},{20671,9,10429},
+{20674,0,8916},{20675,5,10432},{20677,0,8121},{20678,9,10434},
+{20681,0,8920},{20682,17,10437},{20687,10,692},{20690,9,10443},
+{20693,6,695},{20695,9,10446},{20698,0,2574},{20699,9,10449},
+{20702,0,8597},{20703,21,10452},{20709,14,697},{20713,9,10458},
+{20716,10,701},{20719,13,10461},{20723,10,704},{20726,9,10466},
+{20729,10,707},{20732,13,10470},{20736,46,710},{20748,13,10478},
+{20752,22,722},{20758,5,10484},{20760,0,9857},{20761,21,10486},
+{20767,10,728},{20770,29,10493},{20778,0,8753},{20779,25,10501},
+{20786,0,7827},{20787,13,10508},{20791,0,8914},{20792,5,10512},
+{20794,10,731},{20797,5,10514},{20799,58,734},{20814,9,10520},
+{20817,22,749},{20823,9,10524},{20826,10,755},{20829,17,10528},
+{20834,0,2259},{20835,5,10533},{20837,0,3270},{20838,5,10535},
+{20840,86,758},{20862,5,10541},{20864,10,780},{20867,5,10543},
+{20869,0,2877},{20870,5,10545},{20872,6,783},{20874,5,10547},
+{20876,6,785},{20878,13,10549},{20882,0,2741},{20883,5,10553},
+{20885,30,787},{20893,9,10557},{20896,22,795},{20902,17,10562},
+{20907,6,801},{20909,5,10567},{20911,34,803},{20920,9,10570},
+{20923,10,812},{20926,5,10573},{20928,0,2282},{20929,9,10575},
+{20932,54,815},{20946,33,10583},{20955,10,829},{20958,5,10593},
+{20960,6,832},{20962,5,10595},{20964,0,1676},{20965,21,10597},
+{20971,98,834},{20996,5,10609},{20998,18,859},{21003,5,10612},
+{21005,6,864},{21007,5,10614},{21009,6,866},{21011,9,10616},
+{21014,30,868},{21022,5,10620},{21024,0,3319},{21025,9,10622},
+{21028,0,2961},{21029,9,10625},{21032,34,876},{21041,5,10631},
+{21043,0,4752},{21044,5,10633},{21046,34,885},{21055,5,4753},
+{21057,14,894},{21061,5,10637},{21063,0,8803},{21064,5,10639},
+{21066,14,898},{21070,5,10641},{21072,6,902},{21074,5,10643},
+{21076,10,904},{21079,13,10646},{21083,14,907},{21087,5,10651},
+{21089,0,4757},{21090,9,10653},{21093,22,911},{21099,9,10658},
+{21102,6,917},{21104,5,10661},{21106,14,919},{21110,25,10664},
+{21117,26,923},{21124,9,10673},{21127,26,930},{21134,5,10677},
+{21136,14,937},{21140,25,10680},{21147,34,941},{21156,13,10688},
+{21160,14,950},{21164,5,5006},{21166,9,10692},{21169,10,954},
+{21172,37,10695},{21182,22,957},{21188,9,10707},{21191,18,963},
+{21196,13,10712},{21200,10,968},{21203,5,10717},{21205,42,971},
+{21216,5,10722},{21218,10,982},{21221,41,10725},{21232,6,985},
+{21234,9,10736},{21237,0,8209},{21238,5,10739},{21240,10,987},
+{21243,9,10741},{21246,10,990},{21249,13,10744},{21253,14,993},
+{21257,13,10749},{21261,14,997},{21265,13,10754},{21269,22,1001},
+{21275,5,10759},{21277,0,4372},{21278,5,10761},{21280,14,1007},
+{21284,5,10764},{21286,0,4742},{21287,9,10766},{21290,0,1640},
+{21291,5,10769},{21293,18,1011},{21298,25,10772},{21305,10,1016},
+{21308,5,10779},{21310,50,1019},{21323,9,10784},{21326,38,1032},
+{21336,5,10788},{21338,70,1042},{21356,5,10795},{21358,50,1060},
+{21371,13,10800},{21375,0,3169},{21376,5,10804},{21378,18,1073},
+{21383,5,10807},{21385,18,1078},{21390,25,10810},{21397,0,1189},
+{21398,5,10817},{21400,10,1083},{21403,5,10819},{21405,50,1086},
+{21418,9,10825},{21421,6,1099},{21423,9,10828},{21426,18,1101},
+{21431,13,10833},{21435,0,3200},{21436,9,10837},{21439,18,1106},
+{21444,13,10841},{21448,22,1111},{21454,9,10845},{21457,0,1599},
+{21458,5,10848},{21460,30,1117},{21468,9,10852},{21471,122,1125},
+{21502,9,10859},{21505,90,1156},{21528,9,10867},{21531,34,1179},
+{21540,5,10872},{21542,62,1188},{21558,5,10877},{21560,34,1204},
+{21569,5,10882},{21571,0,5384},{21572,5,10884},{21574,22,1213},
+{21580,13,10888},{21584,6,1219},{21586,9,5380},{21589,30,1221},
+{21597,17,10894},{21602,26,1229},{21609,29,10902},{21617,30,1236},
+{21625,5,10911},{21627,10,1244},{21630,5,10913},{21632,26,1247},
+{21639,13,10918},{21643,46,1254},{21655,5,10925},{21657,0,2629},
+{21658,5,5395},{21660,6,1266},{21662,17,10928},{21667,22,1268},
+{21673,5,5419},{21675,38,1274},{21685,9,10937},{21688,0,3897},
+{21689,5,10940},{21691,58,1284},{21706,5,10945},{21708,26,1299},
+{21715,5,5408},{21717,14,1306},{21721,5,5416},{21723,26,1310},
+{21730,9,10951},{21733,22,1317},{21739,5,10954},{21741,6,1323},
+{21743,9,10956},{21746,6,1325},{21748,21,10959},{21754,30,1327},
+{21762,5,10968},{21764,22,1335},{21770,17,10972},{21775,10,1341},
+{21778,5,10977},{21780,0,5429},{21781,21,10979},{21787,0,5425},
+{21788,13,10985},{21792,6,1344},{21794,5,5431},{21796,0,2002},
+{21797,5,10990},{21799,0,5435},{21800,5,10992},{21802,38,1346},
+{21812,9,10997},{21815,0,5447},{21816,13,11000},{21820,42,1356},
+{21831,5,11008},{21833,6,1367},{21835,13,11010},{21839,6,1369},
+{21841,5,11014},{21843,14,1371},{21847,17,11017},{21852,10,1375},
+{21855,5,11023},{21857,0,1637},{21858,5,11025},{21860,14,1378},
+{21864,5,11027},{21866,18,1382},{21871,21,11030},{21877,9,5449},
+{21880,0,3952},{21881,5,11036},{21883,38,1387},{21893,5,11040},
+{21895,18,1397},{21900,9,11042},{21903,10,1402},{21906,5,11046},
+{21908,0,5470},{21909,9,11048},{21912,6,1405},{21914,5,11051},
+{21916,14,1407},{21920,25,11054},{21927,0,4037},{21928,5,11061},
+{21930,18,1411},{21935,5,11065},{21937,46,1416},{21949,5,5468},
+{21951,17,11072},{21956,22,1428},{21962,5,11078},{21964,5,5487},
+{21966,0,8303},{21967,5,11080},{21969,22,1434},{21975,9,11083},
+{21978,66,1440},{21995,5,5477},{21997,5,11091},{21999,0,5483},
+{22000,5,11093},{22002,5,5485},{22004,14,1457},{22008,17,11096},
+{22013,18,1461},{22018,13,11102},{22022,14,1466},{22026,5,11107},
+{22028,14,1470},{22032,13,11109},{22036,18,1474},{22041,5,11114},
+{22043,18,1479},{22048,9,11117},{22051,6,1484},{22053,5,11120},
+{22055,10,1486},{22058,5,11123},{22060,62,1489},{22076,9,11128},
+{22079,10,1505},{22082,37,11132},{22092,10,1508},{22095,17,11142},
+{22100,0,5512},{22101,5,11147},{22103,10,1511},{22106,5,11149},
+{22108,6,1514},{22110,5,11151},{22112,50,1516},{22125,5,11156},
+{22127,46,1529},{22139,5,5517},{22141,9,11163},{22144,0,9070},
+{22145,13,11166},{22149,10,1541},{22152,13,11170},{22156,14,1544},
+{22160,9,11175},{22163,10,1548},{22166,9,11179},{22169,0,8350},
+{22170,33,11182},{22179,0,3942},{22180,5,11191},{22182,10,1551},
+{22185,17,11194},{22190,6,1554},{22192,9,11199},{22195,18,1556},
+{22200,13,11203},{22204,0,2193},{22205,9,11207},{22208,10,1561},
+{22211,5,11210},{22213,0,8923},{22214,5,11212},{22216,18,1564},
+{22221,13,11215},{22225,0,8865},{22226,5,11219},{22228,0,5522},
+{22229,5,11221},{22231,0,5523},{22232,5,11223},{22234,42,1569},
+{22245,21,11227},{22251,10,1580},{22254,5,11234},{22256,6,1583},
+{22258,5,11236},{22260,6,1585},{22262,9,11238},{22265,6,1587},
+{22267,5,11241},{22269,10,1589},{22272,9,11243},{22275,42,1592},
+{22286,13,11248},{22290,6,1603},{22292,5,11252},{22294,10,1605},
+{22297,9,11255},{22300,0,5533},{22301,5,11258},{22303,0,3698},
+{22304,9,11260},{22307,0,3388},{22308,13,11263},{22312,22,1608},
+{22318,5,5036},{22320,0,1465},{22321,5,11268},{22323,0,5034},
+{22324,17,11270},{22329,10,1614},{22332,5,11275},{22334,18,1617},
+{22339,13,11279},{22343,0,2344},{22344,5,11283},{22346,30,1622},
+{22354,17,11286},{22359,0,2422},{22360,5,11291},{22362,30,1630},
+{22370,5,11293},{22372,46,1638},{22384,9,11299},{22387,0,5050},
+{22388,5,11302},{22390,6,1650},{22392,9,11304},{22395,6,1652},
+{22397,17,11307},{22402,18,1654},{22407,13,11312},{22411,6,1659},
+{22413,17,11316},{22418,6,1661},{22420,25,11321},{22427,0,1569},
+{22428,13,11328},{22432,58,1663},{22447,9,11336},{22450,10,1678},
+{22453,9,11340},{22456,0,5065},{22457,33,11343},{22466,6,1681},
+{22468,25,11352},{22475,0,2712},{22476,5,11359},{22478,6,1683},
+{22480,5,11361},{22482,14,1685},{22486,5,11364},{22488,10,1689},
+{22491,5,11366},{22493,18,1692},{22498,5,11369},{22500,0,5069},
+{22501,29,11371},{22509,10,1697},{22512,13,11380},{22516,0,5066},
+{22517,5,11384},{22519,14,1700},{22523,5,11386},{22525,0,5073},
+{22526,5,11388},{22528,10,1704},{22531,5,11391},{22533,10,1707},
+{22536,5,11393},{22538,14,1710},{22542,9,11396},{22545,0,3122},
+{22546,9,11399},{22549,6,1714},{22551,5,11402},{22553,0,5077},
+{22554,9,11404},{22557,18,1716},{22562,5,11408},{22564,0,1453},
+{22565,17,11410},{22570,0,2365},{22571,13,11415},{22575,10,1721},
+{22578,5,11419},{22580,6,1724},{22582,53,11421},{22596,0,5078},
+{22597,17,11435},{22602,42,1726},{22613,5,11443},{22615,6,1737},
+{22617,17,11445},{22622,0,3286},{22623,9,11450},{22626,14,1739},
+{22630,17,11454},{22635,6,1743},{22637,29,11459},{22645,0,7805},
+{22646,9,11467},{22649,0,8406},{22650,13,11470},{22654,30,1745},
+{22662,9,11477},{22665,6,1753},{22667,25,11480},{22674,6,1755},
+{22676,17,11487},{22681,26,1757},{22688,29,11494},{22696,6,1764},
+{22698,13,11502},{22702,0,7903},{22703,13,11506},{22707,0,7929},
+{22708,25,11510},{22715,14,1766},{22719,5,11518},{22721,0,1091},
+{22722,9,11520},{22725,10,1770},{22728,33,11524},{22737,18,1773},
+{22742,5,11535},{22744,10,1778},{22747,9,11537},{22750,26,1781},
+{22757,13,11542},{22761,30,1788},{22769,5,11548},{22771,0,2388},
+{22772,5,11550},{22774,0,1967},{22775,5,11552},{22777,6,1796},
+{22779,5,11554},{22781,0,8504},{22782,13,11556},{22786,10,1798},
+{22789,5,11561},{22791,0,1057},{22792,17,11563},{22797,10,1801},
+{22800,13,11569},{22804,10,1804},{22807,5,11573},{22809,14,1807},
+{22813,5,11576},{22815,0,1812},{22816,5,11578},{22818,62,1811},
+{22834,5,11585},{22836,0,3688},{22837,5,11587},{22839,30,1827},
+{22847,5,11591},{22849,14,1835},{22853,5,11594},{22855,18,1839},
+{22860,5,11597},{22862,14,1844},{22866,5,11600},{22868,26,1848},
+{22875,17,11603},{22880,10,1855},{22883,5,11609},{22885,0,973},
+{22886,9,11611},{22889,22,1858},{22895,13,11616},{22899,26,1864},
+{22906,9,11622},{22909,0,1914},{22910,9,11625},{22913,38,1871},
+{22923,5,11630},{22925,0,6007},{22926,13,11632},{22930,6,1881},
+{22932,5,11636},{22934,14,1883},{22938,9,11639},{22941,6,1887},
+{22943,13,11642},{22947,10,1889},{22950,5,11646},{22952,0,1630},
+{22953,5,6008},{22955,0,6013},{22956,5,11648},{22958,6,1892},
+{22960,5,11650},{22962,0,6017},{22963,21,11652},{22969,10,1894},
+{22972,5,11659},{22974,0,6020},{22975,25,11661},{22982,0,2842},
+{22983,9,11668},{22986,6,1897},{22988,13,11671},{22992,18,1899},
+{22997,5,11675},{22999,26,1904},{23006,17,11679},{23011,10,1911},
+{23014,5,11685},{23016,0,4179},{23017,9,11687},{23020,0,2074},
+{23021,45,11690},{23033,10,1914},{23036,9,11703},{23039,22,1917},
+{23045,5,6021},{23047,10,1923},{23050,5,11708},{23052,0,6028},
+{23053,13,11710},{23057,10,1926},{23060,13,11715},{23064,0,2898},
+{23065,9,11719},{23068,0,2859},{23069,5,11722},{23071,6,1929},
+{23073,5,11724},{23075,10,1931},{23078,9,11727},{23081,0,2793},
+{23082,25,11730},{23089,22,1934},{23095,17,11739},{23100,0,6039},
+{23101,9,11744},{23104,6,1940},{23106,13,11747},{23110,0,3044},
+{23111,5,11751},{23113,6,1942},{23115,37,11753},{23125,0,6038},
+{23126,13,11763},{23130,0,2046},{23131,25,11767},{23138,0,6040},
+{23139,9,11774},{23142,6,1944},{23144,5,11777},{23146,0,2466},
+{23147,5,11779},{23149,0,9209},{23150,21,11781},{23156,14,1946},
+{23160,5,11787},{23162,0,6046},{23163,13,11789},{23167,0,4033},
+{23168,69,11793},{23186,0,2754},{23187,25,11811},{23194,6,1950},
+{23196,41,11818},{23207,0,9212},{23208,5,11829},{23210,0,6043},
+{23211,25,11831},{23218,14,1952},{23222,5,11839},{23224,0,6052},
+{23225,13,11841},{23229,6,1956},{23231,5,11845},{23233,6,1958},
+{23235,21,11847},{23241,0,2088},{23242,5,11853},{23244,0,3904},
+{23245,17,11855},{23250,26,1960},{23257,9,11862},{23260,0,6059},
+{23261,9,11865},{23264,14,1967},{23268,5,11869},{23270,0,6057},
+{23271,5,11871},{23273,10,1971},{23276,17,11874},{23281,0,6055},
+{23282,9,11879},{23285,0,9206},{23286,17,11882},{23291,0,9213},
+{23292,13,11887},{23296,0,9208},{23297,25,11891},{23304,18,1974},
+{23309,33,11899},{23318,14,1979},{23322,25,11909},{23329,0,9215},
+{23330,29,11916},{23338,0,9216},{23339,17,11924},{23344,18,1983},
+{23349,5,11931},{23351,6,1988},{23353,25,11933},{23360,0,6065},
+{23361,41,11940},{23372,0,9211},{23373,9,11951},{23376,62,1990},
+{23392,5,11957},{23394,18,2006},{23399,5,11959},{23401,14,2011},
+{23405,9,11961},{23408,22,2015},{23414,5,11966},{23416,10,2021},
+{23419,5,11969},{23421,62,2024},{23437,5,11975},{23439,0,1953},
+{23440,9,11977},{23443,78,2040},{23463,9,11983},{23466,6,2060},
+{23468,13,11986},{23472,0,4378},{23473,5,11990},{23475,26,2062},
+{23482,9,11993},{23485,10,2069},{23488,5,11996},{23490,22,2072},
+{23496,13,11999},{23500,0,1718},{23501,9,12003},{23504,14,2078},
+{23508,33,12007},{23517,78,2082},{23537,13,12021},{23541,30,2102},
+{23549,5,12026},{23551,10,2110},{23554,5,12029},{23556,54,2113},
+{23570,5,12034},{23572,38,2127},{23582,13,12039},{23586,22,2137},
+{23592,13,12045},{23596,0,5304},{23597,13,12049},{23601,0,2300},
+{23602,5,12053},{23604,0,5305},{23605,5,12055},{23607,46,2143},
+{23619,5,12057},{23621,0,2306},{23622,5,12059},{23624,14,2155},
+{23628,5,12061},{23630,14,2159},{23634,9,12063},{23637,0,4442},
+{23638,9,12066},{23641,0,5993},{23642,13,12069},{23646,42,2163},
+{23657,9,12075},{23660,22,2174},{23666,25,12080},{23673,6,2180},
+{23675,13,12087},{23679,14,2182},{23683,17,12092},{23688,0,5552},
+{23689,9,12097},{23692,6,2186},{23694,5,12100},{23696,6,2188},
+{23698,5,12102},{23700,14,2190},{23704,5,5553},{23706,10,2194},
+{23709,13,12105},{23713,10,2197},{23716,17,12109},{23721,18,2200},
+{23726,9,12115},{23729,30,2205},{23737,13,12121},{23741,18,2213},
+{23746,5,12127},{23748,0,5567},{23749,21,12129},{23755,0,5570},
+{23756,21,12135},{23762,0,5568},{23763,21,12141},{23769,0,4548},
+{23770,25,12147},{23777,0,3884},{23778,5,12154},{23780,26,2218},
+{23787,5,12158},{23789,0,3146},{23790,5,12160},{23792,0,1666},
+{23793,9,12162},{23796,10,2225},{23799,13,12166},{23803,10,2228},
+{23806,13,12171},{23810,5,5572},{23812,5,12175},{23814,6,2231},
+{23816,17,12177},{23821,6,2233},{23823,17,12182},{23828,14,2235},
+{23832,9,12188},{23835,0,5580},{23836,5,12191},{23838,0,5578},
+{23839,17,12193},{23844,22,2239},{23850,5,12200},{23852,10,2245},
+{23855,17,12202},{23860,0,5583},{23861,29,12207},{23869,6,2248},
+{23871,29,12215},{23879,0,6946},{23880,5,12223},{23882,10,2250},
+{23885,9,12225},{23888,0,9098},{23889,25,12228},{23896,0,5581},
+{23897,5,12235},{23899,10,2253},{23902,41,12238},{23913,14,2256},
+{23917,5,12250},{23919,0,5587},{23920,13,12252},{23924,0,5593},
+{23925,45,12256},{23937,14,2260},{23941,5,12269},{23943,0,9096},
+{23944,57,12271},{23959,10,2264},{23962,9,12287},{23965,0,5596},
+{23966,5,12290},{23968,0,9101},{23969,21,12292},{23975,0,9100},
+{23976,57,12298},{23991,22,2267},{23997,29,12315},{24005,0,5599},
+{24006,17,12323},{24011,10,2273},{24014,13,12329},{24018,10,2276},
+{24021,21,12334},{24027,14,2279},{24031,5,12341},{24033,6,2283},
+{24035,5,12343},{24037,26,2285},{24044,5,12346},{24046,26,2292},
+{24053,5,12348},{24055,0,3932},{24056,17,12350},{24061,46,2299},
+{24073,9,12359},{24076,0,3856},{24077,5,12362},{24079,10,2311},
+{24082,5,12364},{24084,38,2314},{24094,25,12367},{24101,10,2324},
+{24104,9,12374},{24107,14,2327},{24111,5,12378},{24113,10,2331},
+{24116,5,12381},{24118,10,2334},{24121,5,12383},{24123,5,5539},
+{24125,0,2742},{24126,5,12385},{24128,22,2337},{24134,21,12388},
+{24140,0,2020},{24141,25,12394},{24148,18,2343},{24153,5,12402},
+{24155,0,5544},{24156,5,12404},{24158,22,2348},{24164,25,12407},
+{24171,6,2354},{24173,17,12414},{24178,58,2356},{24193,9,12421},
+{24196,14,2371},{24200,5,12425},{24202,6,2375},{24204,9,12427},
+{24207,70,2377},{24225,13,12434},{24229,10,2395},{24232,9,12438},
+{24235,10,2398},{24238,17,12442},{24243,26,2401},{24250,13,12448},
+{24254,0,5689},{24255,37,12452},{24265,6,2408},{24267,21,12462},
+{24273,10,2410},{24276,5,12468},{24278,0,2583},{24279,13,12470},
+{24283,0,5694},{24284,9,12474},{24287,18,2413},{24292,13,12477},
+{24296,18,2418},{24301,21,12483},{24307,18,2423},{24312,5,12490},
+{24314,0,2169},{24315,9,12492},{24318,26,2428},{24325,9,12495},
+{24328,14,2435},{24332,9,12499},{24335,38,2439},{24345,5,12506},
+{24347,0,1279},{24348,9,12508},{24351,6,2449},{24353,13,12511},
+{24357,22,2451},{24363,5,12516},{24365,34,2457},{24374,9,12522},
+{24377,14,2466},{24381,9,12526},{24384,0,6590},{24385,17,12529},
+{24390,10,2470},{24393,9,12535},{24396,54,2473},{24410,9,12542},
+{24413,0,4180},{24414,9,12545},{24417,22,2487},{24423,5,12550},
+{24425,18,2493},{24430,5,12553},{24432,14,2498},{24436,9,12556},
+{24439,22,2502},{24445,9,12561},{24448,50,2508},{24461,9,12566},
+{24464,10,2521},{24467,5,12569},{24469,18,2524},{24474,5,12572},
+{24476,22,2529},{24482,21,12576},{24488,10,2535},{24491,5,12582},
+{24493,6,2538},{24495,21,12584},{24501,18,2540},{24506,5,12592},
+{24508,6,2545},{24510,17,12594},{24515,14,2547},{24519,5,12599},
+{24521,0,5699},{24522,5,12601},{24524,26,2551},{24531,9,12604},
+{24534,14,2558},{24538,9,12607},{24541,0,5763},{24542,5,12610},
+{24544,6,2562},{24546,5,12612},{24548,0,5706},{24549,5,12614},
+{24551,0,4268},{24552,5,12616},{24554,18,2564},{24559,5,12619},
+{24561,0,1253},{24562,9,12621},{24565,0,2897},{24566,5,12624},
+{24568,0,5712},{24569,5,12626},{24571,38,2569},{24581,5,5708},
+{24583,9,12629},{24586,0,5721},{24587,5,12632},{24589,10,2579},
+{24592,5,12634},{24594,18,2582},{24599,5,12637},{24601,18,2587},
+{24606,5,12640},{24608,6,2592},{24610,9,12642},{24613,26,2594},
+{24620,9,12645},{24623,0,3152},{24624,17,12648},{24629,0,5714},
+{24630,17,12653},{24635,6,2601},{24637,5,12658},{24639,18,2603},
+{24644,25,12661},{24651,10,2608},{24654,5,12669},{24656,10,2611},
+{24659,5,12672},{24661,0,3478},{24662,9,12674},{24665,6,2614},
+{24667,5,12677},{24669,0,6670},{24670,13,12679},{24674,10,2616},
+{24677,5,12683},{24679,38,2619},{24689,5,12686},{24691,0,2399},
+{24692,5,12688},{24694,6,2629},{24696,5,5724},{24698,22,2631},
+{24704,9,12692},{24707,6,2637},{24709,13,12695},{24713,0,3857},
+{24714,5,12699},{24716,6,2639},{24718,13,12701},{24722,18,2641},
+{24727,9,12707},{24730,26,2646},{24737,5,12712},{24739,0,2001},
+{24740,5,12714},{24742,10,2653},{24745,5,12717},{24747,54,2656},
+{24761,5,12723},{24763,6,2670},{24765,29,12725},{24773,6,2672},
+{24775,9,12733},{24778,6,2674},{24780,17,12736},{24785,0,2056},
+{24786,9,12741},{24789,0,3643},{24790,5,12744},{24792,38,2676},
+{24802,13,12749},{24806,66,2686},{24823,5,12755},{24825,10,2703},
+{24828,13,12757},{24832,6,2706},{24834,13,12761},{24838,14,2708},
+{24842,9,12766},{24845,10,2712},{24848,17,12769},{24853,0,5749},
+{24854,13,12774},{24858,10,2715},{24861,5,12778},{24863,6,2718},
+{24865,5,12780},{24867,18,2720},{24872,9,12783},{24875,0,5754},
+{24876,29,12786},{24884,0,9141},{24885,5,12794},{24887,0,9146},
+{24888,21,12796},{24894,6,2725},{24896,29,12802},{24904,26,2727},
+{24911,5,12812},{24913,0,3358},{24914,9,12814},{24917,0,2848},
+{24918,5,12817},{24920,10,2734},{24923,5,12820},{24925,10,2737},
+{24928,5,12823},{24930,10,2740},{24933,5,12825},{24935,18,2743},
+{24940,5,12828},{24942,10,2748},{24945,5,12831},{24947,18,2751},
+{24952,37,12834},{24962,0,8754},{24963,25,12844},{24970,6,2756},
+{24972,5,12851},{24974,26,2758},{24981,17,12855},{24986,0,7854},
+{24987,5,12860},{24989,0,6681},{24990,21,12862},{24996,0,7931},
+{24997,5,12868},{24999,30,2765},{25007,9,12872},{25010,0,8644},
+{25011,9,12875},{25014,6,2773},{25016,21,12878},{25022,0,1901},
+{25023,9,12884},{25026,0,1517},{25027,13,12887},{25031,22,2775},
+{25037,13,12891},{25041,14,2781},{25045,33,12896},{25054,6,2785},
+{25056,9,12905},{25059,0,9440},{25060,5,12908},{25062,10,2787},
+{25065,33,12911},{25074,0,7809},{25075,5,12920},{25077,46,2790},
+{25089,17,12925},{25094,86,2802},{25116,9,12933},{25119,34,2824},
+{25128,5,12939},{25130,42,2833},{25141,5,12945},{25143,0,1980},
+{25144,17,12947},{25149,26,2844},{25156,9,12953},{25159,0,3329},
+{25160,5,6646},{25162,18,2851},{25167,5,12957},{25169,14,2856},
+{25173,9,12959},{25176,0,3713},{25177,5,12962},{25179,0,2373},
+{25180,25,12964},{25187,0,2408},{25188,5,12971},{25190,42,2860},
+{25201,5,12974},{25203,0,1005},{25204,5,12976},{25206,0,1683},
+{25207,5,12978},{25209,0,3003},{25210,5,12980},{25212,18,2871},
+{25217,9,12983},{25220,0,1234},{25221,13,12986},{25225,6,2876},
+{25227,21,12990},{25233,42,2878},{25244,9,12998},{25247,26,2889},
+{25254,5,13002},{25256,0,2987},{25257,5,13004},{25259,6,2896},
+{25261,13,13006},{25265,0,1040},{25266,9,13010},{25269,0,1463},
+{25270,9,13013},{25273,26,2898},{25280,5,13018},{25282,106,2905},
+{25309,5,13025},{25311,0,2885},{25312,5,13027},{25314,30,2932},
+{25322,5,13030},{25324,46,2940},{25336,13,13035},{25340,26,2952},
+{25347,13,13040},{25351,10,2959},{25354,13,13044},{25358,0,2419},
+{25359,5,13048},{25361,0,3655},{25362,13,13050},{25366,0,3723},
+{25367,9,13054},{25370,46,2962},{25382,5,13058},{25384,14,2974},
+{25388,9,13061},{25391,0,4498},{25392,5,13064},{25394,0,6479},
+{25395,21,13066},{25401,6,2978},{25403,5,13072},{25405,6,2980},
+{25407,9,13074},{25410,18,2982},{25415,5,13078},{25417,30,2987},
+{25425,13,13081},{25429,0,1149},{25430,29,13085},{25438,22,2995},
+{25444,9,13094},{25447,30,3001},{25455,5,13099},{25457,6,3009},
+{25459,9,13101},{25462,6,3011},{25464,5,13104},{25466,6,3013},
+{25468,13,13106},{25472,18,3015},{25477,5,13111},{25479,46,3020},
+{25491,9,13116},{25494,10,3032},{25497,25,13120},{25504,66,3035},
+{25521,5,13132},{25523,6,3052},{25525,5,13134},{25527,38,3054},
+{25537,9,13140},{25540,10,3064},{25543,5,13144},{25545,0,3259},
+{25546,9,13146},{25549,22,3067},{25555,9,13150},{25558,0,4165},
+{25559,9,13153},{25562,0,8703},{25563,9,13156},{25566,22,3073},
+{25572,17,13161},{25577,6,3079},{25579,5,13166},{25581,6,3081},
+{25583,9,13168},{25586,26,3083},{25593,13,13174},{25597,22,3090},
+{25603,5,13179},{25605,0,2194},{25606,17,13181},{25611,22,3096},
+{25617,5,13187},{25619,6,3102},{25621,5,13189},{25623,0,7862},
+{25624,9,13191},{25627,26,3104},{25634,13,13196},{25638,0,5347},
+{25639,9,13200},{25642,14,3111},{25646,21,13204},{25652,10,3115},
+{25655,9,13211},{25658,0,3962},{25659,5,13214},{25661,18,3118},
+{25666,5,13218},{25668,26,3123},{25675,21,13221},{25681,14,3130},
+{25685,9,13228},{25688,0,4427},{25689,9,13231},{25692,14,3134},
+{25696,25,13235},{25703,10,3138},{25706,9,13243},{25709,10,3141},
+{25712,9,13247},{25715,0,8159},{25716,5,13250},{25718,6,3144},
+{25720,5,2819},{25722,6,3146},{25724,21,13253},{25730,26,3148},
+{25737,29,13261},{25745,22,3155},{25751,5,13270},{25753,0,5356},
+{25754,13,13272},{25758,6,3161},{25760,9,13276},{25763,10,3163},
+{25766,9,13279},{25769,54,3166},{25783,5,5354},{25785,58,3180},
+{25800,5,13291},{25802,42,3195},{25813,5,13297},{25815,14,3206},
+{25819,9,13300},{25822,34,3210},{25831,17,13307},{25836,0,8344},
+{25837,5,13312},{25839,22,3219},{25845,5,13315},{25847,0,9061},
+{25848,5,13317},{25850,26,3225},{25857,9,13321},{25860,10,3232},
+{25863,5,13325},{25865,0,5363},{25866,17,13327},{25871,0,8252},
+{25872,5,13332},{25874,46,3235},{25886,13,13339},{25890,14,3247},
+{25894,13,13343},{25898,22,3251},{25904,13,13348},{25908,30,3257},
+{25916,5,13354},{25918,6,3265},{25920,17,13356},{25925,0,1827},
+{25926,5,13361},{25928,6,3267},{25930,5,13363},{25932,0,1457},
+{25933,5,13365},{25935,10,3269},{25938,9,13368},{25941,38,3272},
+{25951,9,13374},{25954,6,3282},{25956,5,13377},{25958,0,1559},
+{25959,13,13379},{25963,6,3284},{25965,9,13383},{25968,34,3286},
+{25977,33,13389},{25986,6,3295},{25988,9,13398},{25991,0,3795},
+{25992,9,13401},{25995,6,3297},{25997,9,13404},{26000,50,3299},
+{26013,5,13412},{26015,10,3312},{26018,5,13415},{26020,50,3315},
+{26033,21,13421},{26039,10,3328},{26042,5,13428},{26044,6,3331},
+{26046,9,13430},{26049,22,3333},{26055,13,13434},{26059,18,3339},
+{26064,5,13439},{26066,0,6602},{26067,9,13441},{26070,6,3344},
+{26072,29,13444},{26080,10,3346},{26083,5,13453},{26085,18,3349},
+{26090,5,13455},{26092,6,3354},{26094,9,6410},{26097,0,1900},
+{26098,13,13457},{26102,6,3356},{26104,5,13461},{26106,0,3755},
+{26107,17,13463},{26112,14,3358},{26116,5,13469},{26118,0,2448},
+{26119,9,13471},{26122,22,3362},{26128,9,13476},{26131,10,3368},
+{26134,9,13479},{26137,0,6414},{26138,9,13482},{26141,14,3371},
+{26145,13,13486},{26149,14,3375},{26153,13,13491},{26157,18,3379},
+{26162,5,13497},{26164,10,3384},{26167,17,13499},{26172,10,3387},
+{26175,5,13505},{26177,10,3390},{26180,25,13507},{26187,6,3393},
+{26189,5,13514},{26191,0,6430},{26192,5,13516},{26194,22,3395},
+{26200,5,13518},{26202,0,3742},{26203,5,13520},{26205,18,3401},
+{26210,5,13524},{26212,18,3406},{26217,17,13528},{26222,10,3411},
+{26225,9,13533},{26228,14,3414},{26232,5,13537},{26234,0,4550},
+{26235,9,13539},{26238,0,2569},{26239,9,13542},{26242,10,3418},
+{26245,5,13546},{26247,10,3421},{26250,5,13548},{26252,0,6436},
+{26253,13,13550},{26257,0,3461},{26258,13,13554},{26262,6,3424},
+{26264,17,13558},{26269,0,6438},{26270,13,13563},{26274,0,7801},
+{26275,13,13567},{26279,6,3426},{26281,5,13571},{26283,0,8794},
+{26284,5,13573},{26286,0,2845},{26287,17,13575},{26292,0,1042},
+{26293,13,13580},{26297,0,5979},{26298,13,13584},{26302,0,6439},
+{26303,17,13588},{26308,22,3428},{26314,45,13595},{26326,0,9385},
+{26327,5,13607},{26329,6,3434},{26331,5,6440},{26333,0,3063},
+{26334,5,13610},{26336,0,8167},{26337,17,13612},{26342,0,6442},
+{26343,5,13617},{26345,0,6443},{26346,5,13619},{26348,0,8466},
+{26349,9,13621},{26352,18,3436},{26357,5,13625},{26359,10,3441},
+{26362,5,13627},{26364,18,3444},{26369,5,13630},{26371,0,8028},
+{26372,13,13632},{26376,22,3449},{26382,5,13637},{26384,0,6532},
+{26385,9,13639},{26388,14,3455},{26392,9,13643},{26395,18,3459},
+{26400,21,13648},{26406,46,3464},{26418,5,13657},{26420,6,3476},
+{26422,13,13659},{26426,0,2063},{26427,5,13663},{26429,0,4011},
+{26430,5,13665},{26432,14,3478},{26436,5,13668},{26438,14,3482},
+{26442,5,13671},{26444,30,3486},{26452,5,13675},{26454,0,4457},
+{26455,17,13677},{26460,22,3494},{26466,9,13683},{26469,0,2463},
+{26470,5,13686},{26472,10,3500},{26475,5,13688},{26477,42,3503},
+{26488,13,13693},{26492,22,3514},{26498,5,13699},{26500,0,1810},
+{26501,5,13701},{26503,18,3520},{26508,13,13705},{26512,0,3845},
+{26513,13,13709},{26517,38,3525},{26527,9,13716},{26530,58,3535},
+{26545,5,13724},{26547,22,3550},{26553,29,13727},{26561,14,3556},
+{26565,37,13736},{26575,22,3560},{26581,9,13746},{26584,42,3566},
+{26595,5,13752},{26597,0,1200},{26598,9,13754},{26601,0,6247},
+{26602,5,13757},{26604,0,2144},{26605,5,13759},{26607,22,3577},
+{26613,29,13762},{26621,14,3583},{26625,13,13771},{26629,58,3587},
+{26644,5,13779},{26646,6,3602},{26648,17,13781},{26653,0,6271},
+{26654,9,13786},{26657,0,3950},{26658,25,13789},{26665,6,3604},
+{26667,25,13796},{26674,5,6262},{26676,9,13803},{26679,10,3606},
+{26682,5,13806},{26684,102,3609},{26710,37,13814},{26720,5,6264},
+{26722,38,3635},{26732,29,13825},{26740,14,3645},{26744,33,13834},
+{26753,22,3649},{26759,29,13845},{26767,0,6282},{26768,9,13853},
+{26771,0,6285},{26772,9,13856},{26775,6,3655},{26777,13,13859},
+{26781,10,3657},{26784,5,13864},{26786,0,3339},{26787,9,13866},
+{26790,10,3660},{26793,13,13869},{26797,14,3663},{26801,5,13874},
+{26803,10,3667},{26806,37,13877},{26816,10,3670},{26819,21,13888},
+{26825,18,3673},{26830,13,13896},{26834,0,1023},{26835,5,13900},
+{26837,22,3678},{26843,13,13903},{26847,6,3684},{26849,5,13907},
+{26851,0,6298},{26852,9,13909},{26855,0,8818},{26856,21,13912},
+{26862,14,3686},{26866,9,13919},{26869,0,2384},{26870,9,13922},
+{26873,14,3690},{26877,13,13926},{26881,0,6296},{26882,9,13930},
+{26885,0,4181},{26886,17,13933},{26891,30,3694},{26899,45,13940},
+{26911,5,6290},{26913,9,13952},{26916,0,6293},{26917,29,13955},
+{26925,0,3719},{26926,5,13963},{26928,0,4147},{26929,9,13965},
+{26932,0,6310},{26933,13,13968},{26937,0,6301},{26938,9,13972},
+{26941,10,3702},{26944,5,13976},{26946,0,6303},{26947,25,13978},
+{26954,0,8702},{26955,29,13985},{26963,6,3705},{26965,5,13993},
+{26967,0,6297},{26968,5,13995},{26970,0,1315},{26971,5,13997},
+{26973,14,3707},{26977,5,14000},{26979,0,6317},{26980,5,14002},
+{26982,10,3711},{26985,5,14005},{26987,14,3714},{26991,5,14008},
+{26993,0,6300},{26994,9,14010},{26997,18,3718},{27002,5,14014},
+{27004,0,2636},{27005,9,14016},{27008,26,3723},{27015,5,6312},
+{27017,0,6315},{27018,9,14022},{27021,0,6331},{27022,21,14025},
+{27028,6,3730},{27030,5,14031},{27032,0,6308},{27033,5,14033},
+{27035,6,3732},{27037,37,14035},{27047,30,3734},{27055,5,14047},
+{27057,0,6325},{27058,5,14049},{27060,0,2618},{27061,5,14051},
+{27063,0,3217},{27064,9,14053},{27067,0,6321},{27068,9,14056},
+{27071,10,3742},{27074,29,14060},{27082,26,3745},{27089,9,14069},
+{27092,0,6324},{27093,21,14072},{27099,0,2154},{27100,9,14078},
+{27103,6,3752},{27105,21,14081},{27111,0,9340},{27112,17,14087},
+{27117,0,6334},{27118,13,14092},{27122,6,3754},{27124,33,14096},
+{27133,22,3756},{27139,5,14107},{27141,0,9324},{27142,13,14109},
+{27146,0,1611},{27147,29,14113},{27155,0,8254},{27156,9,14121},
+{27159,5,6335},{27161,0,7756},{27162,13,14124},{27166,22,3762},
+{27172,13,14130},{27176,10,3768},{27179,13,14135},{27183,10,3771},
+{27186,9,14140},{27189,0,6344},{27190,5,14143},{27192,10,3774},
+{27195,5,14145},{27197,6,3777},{27199,17,14147},{27204,0,6339},
+{27205,5,14152},{27207,6,3779},{27209,5,14154},{27211,0,8413},
+{27212,13,14156},{27216,0,6342},{27217,25,14160},{27224,14,3781},
+{27228,9,14168},{27231,14,3785},{27235,5,14172},{27237,0,6337},
+{27238,41,14174},{27249,0,1308},{27250,25,14185},{27257,0,6346},
+{27258,5,14192},{27260,0,6350},{27261,9,14194},{27264,0,3591},
+{27265,9,14197},{27268,0,3866},{27269,13,14200},{27273,0,9330},
+{27274,13,14204},{27278,14,3789},{27282,5,14209},{27284,0,7861},
+{27285,5,14211},{27287,0,6354},{27288,13,14213},{27292,0,9336},
+{27293,9,14217},{27296,14,3793},{27300,17,14221},{27305,14,3797},
+{27309,5,14227},{27311,0,9881},{27312,9,14229},{27315,0,9346},
+{27316,13,14232},{27320,0,8353},{27321,5,14236},{27323,0,8082},
+{27324,25,14238},{27331,0,7992},{27332,57,14245},{27347,0,9349},
+{27348,21,14260},{27354,22,3801},{27360,25,14267},{27367,22,3807},
+{27373,21,14276},{27379,0,9327},{27380,13,14282},{27384,0,9345},
+{27385,5,14286},{27387,0,8736},{27388,29,14288},{27396,0,8181},
+{27397,17,14296},{27402,0,8436},{27403,13,14301},{27407,0,9341},
+{27408,5,14305},{27410,0,9337},{27411,9,14307},{27414,0,9342},
+{27415,25,14310},{27422,26,3813},{27429,5,14318},{27431,0,2936},
+{27432,37,14320},{27442,0,4320},{27443,13,14330},{27447,14,3820},
+{27451,5,14335},{27453,6,3824},{27455,13,14337},{27459,0,6580},
+{27460,5,14341},{27462,14,3826},{27466,5,14344},{27468,0,1763},
+{27469,9,14346},{27472,0,8365},{27473,29,14349},{27481,0,6582},
+{27482,17,14357},{27487,34,3830},{27496,5,14363},{27498,0,3730},
+{27499,25,14365},{27506,0,8537},{27507,13,14372},{27511,22,3839},
+{27517,13,14377},{27521,5,6358},{27523,42,3845},{27534,13,14384},
+{27538,5,6362},{27540,5,14388},{27542,14,3856},{27546,5,6365},
+{27548,5,14392},{27550,0,9352},{27551,5,14394},{27553,0,6367},
+{27554,5,14396},{27556,0,9351},{27557,17,14398},{27562,6,3860},
+{27564,5,14403},{27566,6,3862},{27568,5,14405},{27570,22,3864},
+{27576,5,14408},{27578,6,3870},{27580,9,14410},{27583,14,3872},
+{27587,5,14414},{27589,6,3876},{27591,13,14416},{27595,18,3878},
+{27600,5,14422},{27602,38,3883},{27612,17,14426},{27617,0,4434},
+{27618,29,14431},{27626,6,3893},{27628,9,14439},{27631,0,3597},
+{27632,9,14442},{27635,10,3895},{27638,9,14446},{27641,0,6488},
+{27642,9,14449},{27645,10,3898},{27648,17,14453},{27653,14,3901},
+{27657,9,14458},{27660,46,3905},{27672,9,6494},{27675,0,1650},
+{27676,9,14464},{27679,90,3917},{27702,5,14472},{27704,0,4261},
+{27705,13,14474},{27709,0,4847},{27710,5,14478},{27712,10,3940},
+{27715,9,14480},{27718,18,3943},{27723,17,14484},{27728,0,3864},
+{27729,9,14489},{27732,14,3948},{27736,9,14493},{27739,26,3952},
+{27746,5,14496},{27748,0,3603},{27749,9,14498},{27752,5,5800},
+{27754,0,3749},{27755,17,14501},{27760,26,3959},{27767,5,14509},
+{27769,0,4005},{27770,9,14511},{27773,6,3966},{27775,5,14514},
+{27777,34,3968},{27786,5,14518},{27788,0,5799},{27789,5,14520},
+{27791,6,3977},{27793,5,14522},{27795,6,3979},{27797,13,14524},
+{27801,10,3981},{27804,9,14529},{27807,62,3984},{27823,5,14536},
+{27825,10,4000},{27828,13,14538},{27832,30,4003},{27840,13,14543},
+{27844,6,4011},{27846,9,14547},{27849,14,4013},{27853,9,14551},
+{27856,0,5806},{27857,5,14554},{27859,18,4017},{27864,9,14556},
+{27867,0,1623},{27868,5,14559},{27870,30,4022},{27878,5,14563},
+{27880,14,4030},{27884,5,14566},{27886,34,4034},{27895,5,5809},
+{27897,34,4043},{27906,5,14573},{27908,0,5829},{27909,5,14575},
+{27911,0,5828},{27912,9,14577},{27915,14,4052},{27919,9,14581},
+{27922,0,3282},{27923,13,14584},{27927,18,4056},{27932,5,14589},
+{27934,0,1523},{27935,21,14591},{27941,10,4061},{27944,5,14598},
+{27946,6,4064},{27948,5,14600},{27950,0,5834},{27951,5,14602},
+{27953,18,4066},{27958,9,14605},{27961,22,4071},{27967,5,14609},
+{27969,78,4077},{27989,13,14616},{27993,30,4097},{28001,5,14623},
+{28003,0,5851},{28004,5,14625},{28006,0,3061},{28007,5,14627},
+{28009,6,4105},{28011,9,14629},{28014,6,4107},{28016,13,14632},
+{28020,0,4324},{28021,5,14636},{28023,10,4109},{28026,5,14638},
+{28028,0,5850},{28029,17,14640},{28034,0,3696},{28035,5,14645},
+{28037,18,4112},{28042,5,14648},{28044,10,4117},{28047,5,14651},
+{28049,6,4120},{28051,5,5846},{28053,0,3644},{28054,17,14654},
+{28059,66,4122},{28076,5,14662},{28078,6,4139},{28080,5,14664},
+{28082,0,4161},{28083,5,14666},{28085,0,1892},{28086,5,14668},
+{28088,0,1931},{28089,21,14670},{28095,6,4141},{28097,9,14676},
+{28100,14,4143},{28104,9,14679},{28107,6,4147},{28109,13,14682},
+{28113,0,3454},{28114,13,14686},{28118,14,4149},{28122,9,14691},
+{28125,18,4153},{28130,5,14695},{28132,10,4158},{28135,9,14698},
+{28138,18,4161},{28143,5,14702},{28145,46,4166},{28157,29,14707},
+{28165,0,3170},{28166,13,14715},{28170,30,4178},{28178,5,14721},
+{28180,14,4186},{28184,5,14724},{28186,0,5852},{28187,5,14726},
+{28189,0,4298},{28190,5,14728},{28192,26,4190},{28199,5,14731},
+{28201,26,4197},{28208,5,14735},{28210,10,4204},{28213,9,14738},
+{28216,10,4207},{28219,9,14742},{28222,0,8035},{28223,13,14745},
+{28227,6,4210},{28229,29,14749},{28237,6,4212},{28239,13,14757},
+{28243,5,5874},{28245,14,4214},{28249,5,14763},{28251,0,4448},
+{28252,5,14765},{28254,6,4218},{28256,41,14767},{28267,0,5870},
+{28268,5,14778},{28270,6,4220},{28272,53,14780},{28286,6,4222},
+{28288,9,14794},{28291,14,4224},{28295,5,14798},{28297,0,1731},
+{28298,17,14800},{28303,6,4228},{28305,17,14805},{28310,10,4230},
+{28313,9,14811},{28316,14,4233},{28320,5,14815},{28322,0,4206},
+{28323,5,14817},{28325,10,4237},{28328,5,14820},{28330,0,3863},
+{28331,13,14822},{28335,34,4240},{28344,5,14829},{28346,14,4249},
+{28350,9,14832},{28353,26,4253},{28360,9,14837},{28363,50,4260},
+{28376,5,14844},{28378,0,1871},{28379,9,14846},{28382,46,4273},
+{28394,5,14851},{28396,0,8011},{28397,5,14853},{28399,0,8850},
+{28400,5,14855},{28402,10,4285},{28405,5,14858},{28407,10,4288},
+{28410,17,14860},{28415,14,4291},{28419,9,14866},{28422,0,3072},
+{28423,5,14869},{28425,0,5907},{28426,17,14871},{28431,0,2640},
+{28432,9,14876},{28435,10,4295},{28438,13,14879},{28442,0,8369},
+{28443,17,14883},{28448,18,4298},{28453,13,14889},{28457,42,4303},
+{28468,5,14895},{28470,10,4314},{28473,17,14898},{28478,14,4317},
+{28482,13,14904},{28486,5,5897},{28488,9,14908},{28491,10,4321},
+{28494,9,14912},{28497,0,8382},{28498,5,14915},{28500,0,8116},
+{28501,9,14917},{28504,6,4324},{28506,5,14920},{28508,10,4326},
+{28511,9,14923},{28514,18,4329},{28519,21,14928},{28525,30,4334},
+{28533,5,14936},{28535,22,4342},{28541,5,14940},{28543,6,4348},
+{28545,9,14942},{28548,22,4350},{28554,5,14946},{28556,10,4356},
+{28559,29,14948},{28567,0,8093},{28568,13,14956},{28572,0,2472},
+{28573,9,14960},{28576,6,4359},{28578,5,14963},{28580,0,8804},
+{28581,5,14965},{28583,10,4361},{28586,13,14968},{28590,0,9182},
+{28591,5,14972},{28593,10,4364},{28596,5,14975},{28598,0,5920},
+{28599,5,14977},{28601,0,5919},{28602,21,14979},{28608,14,4367},
+{28612,17,14985},{28617,0,5917},{28618,25,14990},{28625,6,4371},
+{28627,5,14997},{28629,0,8491},{28630,5,14999},{28632,0,8357},
+{28633,5,15001},{28635,0,9867},{28636,5,15003},{28638,14,4373},
+{28642,5,15005},{28644,0,8557},{28645,21,15007},{28651,0,8193},
+{28652,5,15013},{28654,14,4377},{28658,29,15015},{28666,22,4381},
+{28672,17,15026},{28677,6,4387},{28679,5,15031},{28681,10,4389},
+{28684,9,15034},{28687,10,4392},{28690,9,15038},{28693,0,7759},
+{28694,5,15041},{28696,34,4395},{28705,5,15046},{28707,0,5928},
+{28708,9,15048},{28711,6,4404},{28713,25,15051},{28720,10,4406},
+{28723,5,15059},{28725,0,5931},{28726,9,15061},{28729,0,5930},
+{28730,13,15064},{28734,0,8186},{28735,13,15068},{28739,6,4409},
+{28741,25,15072},{28748,0,1849},{28749,5,15079},{28751,10,4411},
+{28754,9,15082},{28757,0,8203},{28758,5,15085},{28760,0,8550},
+{28761,13,15087},{28765,6,4414},{28767,13,15091},{28771,6,4416},
+{28773,5,15095},{28775,0,9191},{28776,9,15097},{28779,22,4418},
+{28785,13,15101},{28789,14,4424},{28793,9,15106},{28796,18,4428},
+{28801,13,15110},{28805,0,6419},{28806,9,15114},{28809,6,4433},
+{28811,9,15117},{28814,0,4096},{28815,9,15120},{28818,18,4435},
+{28823,5,15124},{28825,0,4554},{28826,5,15126},{28828,6,4440},
+{28830,49,15128},{28843,34,4442},{28852,9,15143},{28855,26,4451},
+{28862,5,15147},{28864,14,4458},{28868,13,15149},{28872,10,4462},
+{28875,13,15154},{28879,0,8611},{28880,29,15158},{28888,14,4465},
+{28892,9,15167},{28895,0,4085},{28896,13,15170},{28900,46,4469},
+{28912,13,15177},{28916,0,8570},{28917,5,15181},{28919,10,4481},
+{28922,9,15184},{28925,0,1670},{28926,41,15187},{28937,6,4484},
+{28939,17,15198},{28944,0,6615},{28945,5,15203},{28947,30,4486},
+{28955,21,15207},{28961,0,8613},{28962,13,15213},{28966,0,2186},
+{28967,29,15217},{28975,10,4494},{28978,13,15225},{28982,0,3222},
+{28983,53,15229},{28997,0,6623},{28998,9,15243},{29001,22,4497},
+{29007,9,15248},{29010,0,9430},{29011,33,15251},{29020,10,4503},
+{29023,9,15261},{29026,30,4506},{29034,5,15266},{29036,10,4514},
+{29039,9,15269},{29042,6,4517},{29044,13,15272},{29048,10,4519},
+{29051,5,15277},{29053,0,3320},{29054,21,15279},{29060,0,3861},
+{29061,17,15285},{29066,0,4007},{29067,13,15290},{29071,0,4053},
+{29072,5,15294},{29074,10,4522},{29077,5,15297},{29079,10,4525},
+{29082,17,15299},{29087,6,4528},{29089,25,15304},{29096,0,6631},
+{29097,9,15311},{29100,0,969},{29101,13,15314},{29105,18,4530},
+{29110,9,15320},{29113,0,6642},{29114,13,15323},{29118,0,7815},
+{29119,5,15327},{29121,10,4535},{29124,13,15330},{29128,0,7866},
+{29129,17,15334},{29134,0,2576},{29135,9,15339},{29138,14,4538},
+{29142,9,15343},{29145,0,8556},{29146,5,15346},{29148,0,9433},
+{29149,5,15348},{29151,6,4542},{29153,13,15350},{29157,10,4544},
+{29160,17,15354},{29165,6,4547},{29167,17,15359},{29172,0,8029},
+{29173,13,15364},{29177,0,6636},{29178,5,15368},{29180,14,4549},
+{29184,21,15372},{29190,0,1045},{29191,21,15378},{29197,0,8521},
+{29198,5,15384},{29200,0,8262},{29201,37,15386},{29211,10,4553},
+{29214,37,15397},{29224,18,4556},{29229,9,15409},{29232,10,4561},
+{29235,5,15412},{29237,42,4564},{29248,25,15415},{29255,6,4575},
+{29257,9,15422},{29260,6,4577},{29262,13,15425},{29266,0,6506},
+{29267,9,15429},{29270,50,4579},{29283,9,15437},{29286,14,4592},
+{29290,13,15441},{29294,6,4596},{29296,5,15445},{29298,0,3381},
+{29299,5,15447},{29301,0,3104},{29302,9,15449},{29305,6,4598},
+{29307,5,15452},{29309,0,8396},{29310,5,6471},{29312,6,4600},
+{29314,5,15454},{29316,0,6473},{29317,17,15456},{29322,22,4602},
+{29328,5,15463},{29330,0,6477},{29331,9,15465},{29334,0,9024},
+{29335,29,15468},{29343,0,6467},{29344,5,15476},{29346,0,7889},
+{29347,13,15478},{29351,0,8620},{29352,13,15482},{29356,18,4608},
+{29361,9,15487},{29364,10,4613},{29367,5,5618},{29369,0,4273},
+{29370,21,15491},{29376,18,4616},{29381,9,15497},{29384,0,1056},
+{29385,13,15500},{29389,22,4621},{29395,13,15506},{29399,10,4627},
+{29402,13,15511},{29406,14,4630},{29410,21,15516},{29416,6,4634},
+{29418,5,15522},{29420,34,4636},{29429,5,15524},{29431,10,4645},
+{29434,5,5634},{29436,6,4648},{29438,9,15526},{29441,10,4650},
+{29444,21,15530},{29450,0,5639},{29451,9,15536},{29454,0,2589},
+{29455,13,15539},{29459,18,4653},{29464,9,15544},{29467,14,4658},
+{29471,5,15547},{29473,6,4662},{29475,5,15549},{29477,0,5645},
+{29478,9,15551},{29481,22,4664},{29487,5,15555},{29489,0,5648},
+{29490,5,15557},{29492,30,4670},{29500,5,15561},{29502,14,4678},
+{29506,5,15564},{29508,6,4682},{29510,25,15566},{29517,0,5650},
+{29518,5,15573},{29520,10,4684},{29523,13,15576},{29527,0,5651},
+{29528,29,15580},{29536,0,5652},{29537,25,15588},{29544,42,4687},
+{29555,5,15598},{29557,46,4698},{29569,9,15604},{29572,0,4041},
+{29573,5,15607},{29575,18,4710},{29580,5,15611},{29582,0,6168},
+{29583,5,15613},{29585,0,6169},{29586,13,15615},{29590,0,2288},
+{29591,13,15619},{29595,0,2705},{29596,9,15623},{29599,0,6172},
+{29600,5,15626},{29602,0,6171},{29603,21,15628},{29609,10,4715},
+{29612,5,15635},{29614,22,4718},{29620,9,15638},{29623,0,6176},
+{29624,5,15641},{29626,6,4724},{29628,13,15643},{29632,10,4726},
+{29635,17,15648},{29640,10,4729},{29643,5,15653},{29645,18,4732},
+{29650,25,15656},{29657,0,6182},{29658,13,15663},{29662,10,4737},
+{29665,13,15668},{29669,18,4740},{29674,9,15674},{29677,0,1003},
+{29678,13,15677},{29682,0,6189},{29683,41,15681},{29694,6,4745},
+{29696,9,15693},{29699,14,4747},{29703,5,15697},{29705,6,4751},
+{29707,13,15699},{29711,6,4753},{29713,33,15703},{29722,6,4755},
+{29724,21,15712},{29730,0,4638},{29731,5,15718},{29733,46,4757},
+{29745,5,15725},{29747,14,4769},{29751,17,15727},{29756,0,3178},
+{29757,5,15732},{29759,10,4773},{29762,33,15735},{29771,0,9308},
+{29772,33,15744},{29781,42,4776},{29792,9,15756},{29795,0,8541},
+{29796,17,15759},{29801,6,4787},{29803,5,15764},{29805,0,6207},
+{29806,5,15766},{29808,0,1854},{29809,17,15768},{29814,6,4789},
+{29816,21,15773},{29822,6,4791},{29824,5,6211},{29826,6,4793},
+{29828,9,15781},{29831,18,4795},{29836,5,15786},{29838,10,4800},
+{29841,41,15789},{29852,10,4803},{29855,13,15801},{29859,0,9307},
+{29860,5,15805},{29862,6,4806},{29864,5,6216},{29866,21,15807},
+{29872,0,8020},{29873,33,15813},{29882,0,6221},{29883,5,15822},
+{29885,0,9311},{29886,45,15824},{29898,0,8428},{29899,13,15836},
+{29903,0,9309},{29904,5,15840},{29906,10,4808},{29909,17,15843},
+{29914,50,4811},{29927,25,15853},{29934,6,4824},{29936,13,15860},
+{29940,14,4826},{29944,25,15865},{29951,0,6405},{29952,13,15872},
+{29956,0,4488},{29957,25,15876},{29964,30,4830},{29972,13,15886},
+{29976,18,4838},{29981,5,15891},{29983,0,3379},{29984,9,15893},
+{29987,10,4843},{29990,5,15897},{29992,78,4846},{30012,5,15904},
+{30014,10,4866},{30017,13,15907},{30021,0,1230},{30022,5,15911},
+{30024,0,6780},{30025,5,15913},{30027,18,4869},{30032,13,15916},
+{30036,0,2960},{30037,13,15920},{30041,18,4874},{30046,13,15924},
+{30050,0,7746},{30051,5,15928},{30053,6,4879},{30055,9,15930},
+{30058,6,4881},{30060,21,15933},{30066,30,4883},{30074,17,15942},
+{30079,0,6164},{30080,9,15947},{30083,0,6784},{30084,5,15950},
+{30086,6,4891},{30088,9,15952},{30091,0,7110},{30092,9,15955},
+{30095,46,4893},{30107,5,15962},{30109,34,4905},{30118,17,15966},
+{30123,30,4914},{30131,5,7015},{30133,0,1350},{30134,5,15972},
+{30136,6,4922},{30138,5,15974},{30140,10,4924},{30143,9,15976},
+{30146,34,4927},{30155,5,15980},{30157,0,7024},{30158,13,15982},
+{30162,38,4936},{30172,5,15989},{30174,0,3013},{30175,9,15991},
+{30178,38,4946},{30188,13,15996},{30192,6,4956},{30194,5,16000},
+{30196,0,1274},{30197,13,16002},{30201,0,1085},{30202,5,16006},
+{30204,0,7033},{30205,5,16008},{30207,26,4958},{30214,13,16011},
+{30218,14,4965},{30222,5,16015},{30224,0,7035},{30225,13,16017},
+{30229,26,4969},{30236,5,16023},{30238,62,4976},{30254,5,16028},
+{30256,0,7051},{30257,5,16030},{30259,10,4992},{30262,5,16032},
+{30264,0,3214},{30265,5,16034},{30267,34,4995},{30276,5,16038},
+{30278,5,9647},{30280,6,5004},{30282,5,16041},{30284,6,5006},
+{30286,21,16043},{30292,18,5008},{30297,9,16051},{30300,14,5013},
+{30304,5,16055},{30306,42,5017},{30317,5,9652},{30319,14,5028},
+{30323,17,16060},{30328,0,1864},{30329,5,16065},{30331,14,5032},
+{30335,9,16067},{30338,26,5036},{30345,5,16072},{30347,0,1753},
+{30348,5,16074},{30350,0,6958},{30351,5,16076},{30353,10,5043},
+{30356,5,16079},{30358,0,3743},{30359,5,16081},{30361,6,5046},
+{30363,33,16083},{30372,0,6961},{30373,33,16092},{30382,0,3011},
+{30383,5,16101},{30385,14,5048},{30389,9,16104},{30392,10,5052},
+{30395,13,16108},{30399,0,2808},{30400,5,16112},{30402,0,4288},
+{30403,5,16114},{30405,22,5055},{30411,5,16118},{30413,46,5061},
+{30425,5,16122},{30427,0,3385},{30428,5,16124},{30430,38,5073},
+{30440,21,16129},{30446,26,5083},{30453,9,16137},{30456,6,5090},
+{30458,5,16140},{30460,22,5092},{30466,5,16145},{30468,0,6745},
+{30469,5,16147},{30471,5,6748},{30473,18,5098},{30478,41,16151},
+{30489,6,5103},{30491,13,16162},{30495,14,5105},{30499,9,16167},
+{30502,14,5109},{30506,9,16171},{30509,10,5113},{30512,17,16175},
+{30517,30,5116},{30525,9,16182},{30528,14,5124},{30532,9,16186},
+{30535,0,6759},{30536,25,16189},{30543,0,9860},{30544,5,6757},
+{30546,29,16196},{30554,6,5128},{30556,5,16204},{30558,0,9455},
+{30559,5,16206},{30561,30,5130},{30569,5,16210},{30571,6,5138},
+{30573,45,16212},{30585,0,1538},{30586,9,16224},{30589,14,5140},
+{30593,9,16227},{30596,6,5144},{30598,21,16230},{30604,10,5146},
+{30607,5,16236},{30609,6,5149},{30611,17,16238},{30616,0,9454},
+{30617,17,16243},{30622,0,8308},{30623,5,6771},{30625,6,5151},
+{30627,5,16249},{30629,34,5153},{30638,5,16254},{30640,0,6773},
+{30641,5,16256},{30643,10,5162},{30646,17,16259},{30651,18,5165},
+{30656,25,16265},{30663,0,9869},{30664,17,16272},{30669,0,5015},
+{30670,33,16277},{30679,0,1318},{30680,5,16286},{30682,10,5170},
+{30685,17,16288},{30690,54,5173},{30704,9,16297},{30707,0,3398},
+{30708,5,16300},{30710,10,5187},{30713,13,16303},{30717,22,5190},
+{30723,21,16307},{30729,0,6693},{30730,5,16313},{30732,6,5196},
+{30734,9,16315},{30737,22,5198},{30743,5,6694},{30745,10,5204},
+{30748,5,6699},{30750,6,5207},{30752,9,16323},{30755,26,5209},
+{30762,5,16328},{30764,6,5216},{30766,5,16330},{30768,0,2986},
+{30769,9,16332},{30772,0,3045},{30773,5,16335},{30775,6,5218},
+{30777,9,6701},{30780,18,5220},{30785,5,16339},{30787,18,5225},
+{30792,13,16343},{30796,26,5230},{30803,5,16350},{30805,0,3499},
+{30806,5,6712},{30808,17,16352},{30813,0,3938},{30814,21,16357},
+{30820,0,9449},{30821,9,16363},{30824,30,5237},{30832,25,16367},
+{30839,0,2146},{30840,13,16374},{30844,0,2993},{30845,37,16378},
+{30855,10,5245},{30858,5,16389},{30860,10,5248},{30863,5,16391},
+{30865,10,5251},{30868,9,16394},{30871,22,5254},{30877,5,16398},
+{30879,42,5260},{30890,9,16405},{30893,0,9444},{30894,5,16408},
+{30896,18,5271},{30901,9,16410},{30904,26,5276},{30911,5,16415},
+{30913,0,1352},{30914,9,16417},{30917,0,1024},{30918,9,16420},
+{30921,10,5283},{30924,13,16423},{30928,0,2958},{30929,9,16427},
+{30932,6,5286},{30934,9,16430},{30937,6,5288},{30939,29,16433},
+{30947,0,9452},{30948,9,16441},{30951,6,5290},{30953,9,16444},
+{30956,0,6732},{30957,5,16447},{30959,0,9443},{30960,5,16449},
+{30962,10,5292},{30965,5,16452},{30967,0,2592},{30968,5,16454},
+{30970,0,2012},{30971,5,16456},{30973,0,9450},{30974,9,16458},
+{30977,0,2185},{30978,9,16461},{30981,0,6734},{30982,29,16464},
+{30990,0,7826},{30991,13,16472},{30995,0,6736},{30996,17,16476},
+{31001,0,7719},{31002,13,16481},{31006,0,6738},{31007,17,16485},
+{31012,10,5295},{31015,9,16491},{31018,10,5298},{31021,13,16494},
+{31025,0,9448},{31026,5,16498},{31028,0,6739},{31029,17,16500},
+{31034,30,5301},{31042,13,16507},{31046,14,5309},{31050,33,16512},
+{31059,0,6654},{31060,5,16521},{31062,6,5313},{31064,5,16523},
+{31066,0,6655},{31067,5,6652},{31069,22,5315},{31075,5,16526},
+{31077,14,5321},{31081,13,16529},{31085,10,5325},{31088,25,16534},
+{31095,14,5328},{31099,17,16542},{31104,6,5332},{31106,5,16547},
+{31108,6,5334},{31110,13,16549},{31114,0,6663},{31115,5,16553},
+{31117,10,5336},{31120,37,16555},{31130,0,6664},{31131,41,16565},
+{31142,6,5339},{31144,5,16576},{31146,0,9437},{31147,9,16578},
+{31150,22,5341},{31156,17,16583},{31161,42,5347},{31172,5,16591},
+{31174,0,1740},{31175,5,16593},{31177,18,5358},{31182,9,16597},
+{31185,6,5363},{31187,5,16600},{31189,0,6941},{31190,5,16602},
+{31192,0,2781},{31193,21,16604},{31199,0,4671},{31200,9,16610},
+{31203,54,5365},{31217,25,16618},{31224,0,2214},{31225,5,16625},
+{31227,10,5379},{31230,5,16628},{31232,14,5382},{31236,5,16631},
+{31238,0,6945},{31239,13,16633},{31243,14,5386},{31247,17,16638},
+{31252,0,6950},{31253,5,16643},{31255,0,1001},{31256,5,16645},
+{31258,0,4552},{31259,9,16647},{31262,10,5390},{31265,5,16651},
+{31267,0,7567},{31268,37,16653},{31278,0,8853},{31279,5,16663},
+{31281,10,5393},{31284,9,16666},{31287,38,5396},{31297,17,16672},
+{31302,0,2853},{31303,17,16677},{31308,10,5406},{31311,5,16682},
+{31313,0,6953},{31314,17,16684},{31319,0,3552},{31320,33,16689},
+{31329,6,5409},{31331,21,16698},{31337,10,5411},{31340,13,16705},
+{31344,0,6956},{31345,9,16709},{31348,14,5414},{31352,5,7066},
+{31354,0,2402},{31355,13,16713},{31359,38,5418},{31369,13,16720},
+{31373,0,3148},{31374,9,16724},{31377,6,5428},{31379,5,16727},
+{31381,14,5430},{31385,9,16729},{31388,18,5434},{31393,13,16733},
+{31397,38,5439},{31407,13,16739},{31411,0,7077},{31412,5,16743},
+{31414,0,9657},{31415,9,16745},{31418,0,8170},{31419,13,16748},
+{31423,0,2631},{31424,13,16752},{31428,30,5449},{31436,37,16758},
+{31446,0,3473},{31447,5,16768},{31449,0,4447},{31450,13,16770},
+{31454,10,5457},{31457,5,16774},{31459,14,5460},{31463,9,16777},
+{31466,0,8513},{31467,5,16780},{31469,10,5464},{31472,21,16783},
+{31478,0,8135},{31479,5,16789},{31481,6,5467},{31483,5,16791},
+{31485,10,5469},{31488,9,16794},{31491,5,7270},{31493,26,5472},
+{31500,9,16800},{31503,10,5479},{31506,5,16804},{31508,6,5482},
+{31510,9,16806},{31513,10,5484},{31516,5,16810},{31518,10,5487},
+{31521,9,16813},{31524,42,5490},{31535,5,16819},{31537,10,5501},
+{31540,13,16822},{31544,26,5504},{31551,21,16829},{31557,30,5511},
+{31565,5,16837},{31567,58,5519},{31582,5,16844},{31584,10,5534},
+{31587,13,16847},{31591,0,9700},{31592,21,16851},{31598,0,7295},
+{31599,5,16857},{31601,6,5537},{31603,5,16859},{31605,26,5539},
+{31612,5,16864},{31614,10,5546},{31617,13,16867},{31621,0,7307},
+{31622,17,16871},{31627,10,5549},{31630,5,16877},{31632,0,7300},
+{31633,9,16879},{31636,14,5552},{31640,13,16883},{31644,6,5556},
+{31646,9,16887},{31649,6,5558},{31651,9,16890},{31654,5,7301},
+{31656,22,5560},{31662,9,16893},{31665,0,3921},{31666,5,16896},
+{31668,0,7312},{31669,9,16898},{31672,0,7303},{31673,25,16901},
+{31680,6,5566},{31682,5,16908},{31684,34,5568},{31693,13,16913},
+{31697,10,5577},{31700,17,16918},{31705,6,5580},{31707,5,16923},
+{31709,0,7316},{31710,9,16925},{31713,0,1374},{31714,5,16928},
+{31716,0,9699},{31717,5,7318},{31719,5,16930},{31721,6,5582},
+{31723,9,16932},{31726,0,2469},{31727,5,16935},{31729,10,5584},
+{31732,9,16938},{31735,0,2994},{31736,13,16941},{31740,18,5587},
+{31745,21,16947},{31751,0,1371},{31752,9,16953},{31755,18,5592},
+{31760,21,16957},{31766,0,7325},{31767,25,16963},{31774,22,5597},
+{31780,5,16972},{31782,6,5603},{31784,5,16974},{31786,6,5605},
+{31788,45,16976},{31800,0,7330},{31801,13,16988},{31805,26,5607},
+{31812,29,16993},{31820,6,5614},{31822,53,17001},{31836,0,9705},
+{31837,5,17015},{31839,6,5616},{31841,9,17017},{31844,0,9875},
+{31845,13,17020},{31849,22,5618},{31855,9,17026},{31858,10,5624},
+{31861,21,17029},{31867,10,5627},{31870,41,17035},{31881,0,1656},
+{31882,25,17046},{31889,6,5630},{31891,5,17053},{31893,14,5632},
+{31897,9,17056},{31900,14,5636},{31904,5,17059},{31906,14,5640},
+{31910,13,17062},{31914,0,1661},{31915,9,17066},{31918,0,2561},
+{31919,5,17069},{31921,10,5644},{31924,17,17071},{31929,0,1381},
+{31930,5,17076},{31932,5,7378},{31934,0,2266},{31935,5,17078},
+{31937,0,7380},{31938,9,17080},{31941,26,5647},{31948,5,7382},
+{31950,25,17086},{31957,18,5654},{31962,5,17094},{31964,18,5659},
+{31969,21,17096},{31975,6,5664},{31977,21,17102},{31983,50,5666},
+{31996,5,17113},{31998,34,5679},{32007,5,9246},{32009,18,5688},
+{32014,5,17119},{32016,0,8359},{32017,5,17121},{32019,38,5693},
+{32029,9,17125},{32032,10,5703},{32035,13,17128},{32039,0,2245},
+{32040,9,17132},{32043,0,4652},{32044,9,17135},{32047,18,5706},
+{32052,17,17138},{32057,14,5711},{32061,5,17144},{32063,30,5715},
+{32071,25,17149},{32078,10,5723},{32081,45,17157},{32093,6,5726},
+{32095,5,17169},{32097,6,5728},{32099,9,17171},{32102,10,5730},
+{32105,17,17175},{32110,0,4032},{32111,5,17180},{32113,10,5733},
+{32116,5,17182},{32118,14,5736},{32122,25,17185},{32129,10,5740},
+{32132,5,17193},{32134,14,5743},{32138,17,17196},{32143,0,8536},
+{32144,9,17201},{32147,0,8130},{32148,29,17204},{32156,10,5747},
+{32159,9,17213},{32162,6,5750},{32164,5,17216},{32166,0,7401},
+{32167,13,17218},{32171,38,5752},{32181,9,17223},{32184,30,5762},
+{32192,13,17227},{32196,0,9269},{32197,5,17231},{32199,0,9275},
+{32200,5,17233},{32202,6,5770},{32204,17,17235},{32209,14,5772},
+{32213,5,17241},{32215,10,5776},{32218,9,17243},{32221,26,5779},
+{32228,5,17248},{32230,14,5786},{32234,5,17251},{32236,0,8326},
+{32237,5,17253},{32239,30,5790},{32247,5,17258},{32249,10,5798},
+{32252,45,17261},{32264,14,5801},{32268,13,17273},{32272,6,5805},
+{32274,33,17277},{32283,18,5807},{32288,9,17287},{32291,0,8642},
+{32292,9,17290},{32295,0,8558},{32296,9,17293},{32299,14,5812},
+{32303,5,17297},{32305,54,5816},{32319,5,17303},{32321,0,1614},
+{32322,9,17305},{32325,10,5830},{32328,37,17308},{32338,14,5833},
+{32342,13,17319},{32346,0,9300},{32347,9,17323},{32350,0,8443},
+{32351,9,17326},{32354,0,9280},{32355,21,17329},{32361,30,5837},
+{32369,5,17336},{32371,0,8110},{32372,17,17338},{32377,0,8730},
+{32378,5,17343},{32380,10,5845},{32383,9,17345},{32386,0,4680},
+{32387,17,17348},{32392,30,5848},{32400,9,17356},{32403,22,5856},
+{32409,5,17361},{32411,6,5862},{32413,5,17363},{32415,34,5864},
+{32424,5,6103},{32426,66,5873},{32443,5,17367},{32445,10,5890},
+{32448,9,6108},{32451,30,5893},{32459,5,6112},{32461,74,5901},
+{32480,5,6118},{32482,46,5920},{32494,5,6122},{32496,0,1349},
+{32497,5,6124},{32499,26,5932},{32506,5,6128},{32508,18,5939},
+{32513,9,6131},{32516,10,5944},{32519,5,6134},{32521,6,5947},
+{32523,5,6136},{32525,14,5949},{32529,5,6139},{32531,54,5953},
+{32545,25,6146},{32552,6,5967},{32554,13,6153},{32558,0,3330},
+{32559,17,6157},{32564,26,5969},{32571,25,17378},{32578,6,5976},
+{32580,5,7264},{32582,21,17386},{32588,22,5978},{32594,5,17394},
+{32596,26,5984},{32603,13,17398},{32607,14,5991},{32611,17,17403},
+{32616,10,5995},{32619,9,17408},{32622,26,5998},{32629,5,17413},
+{32631,10,6005},{32634,13,17416},{32638,0,6794},{32639,5,17420},
+{32641,0,6793},{32642,9,17422},{32645,38,6008},{32655,17,17429},
+{32660,0,1756},{32661,17,17434},{32666,0,2608},{32667,5,17439},
+{32669,18,6018},{32674,5,17442},{32676,22,6023},{32682,17,17446},
+{32687,5,7367},{32689,6,6029},{32691,17,17452},{32696,6,6031},
+{32698,5,17457},{32700,22,6033},{32706,9,17461},{32709,0,1286},
+{32710,13,17464},{32714,18,6039},{32719,9,17470},{32722,14,6044},
+{32726,5,17474},{32728,0,3145},{32729,21,17476},{32735,10,6048},
+{32738,9,17482},{32741,6,6051},{32743,5,17485},{32745,0,7396},
+{32746,13,17487},{32750,22,6053},{32756,17,17493},{32761,14,6059},
+{32765,9,17499},{32768,26,6063},{32775,13,17503},{32779,10,6070},
+{32782,5,17507},{32784,38,6073},{32794,5,17511},{32796,0,7118},
+{32797,9,17513},{32800,10,6083},{32803,5,17517},{32805,9,7121},
+{32808,26,6086},{32815,5,17521},{32817,30,6093},{32825,5,17525},
+{32827,18,6101},{32832,5,17529},{32834,6,6106},{32836,5,17531},
+{32838,0,7130},{32839,9,17533},{32842,14,6108},{32846,13,17536},
+{32850,34,6112},{32859,9,17544},{32862,0,8601},{32863,37,17547},
+{32873,6,6121},{32875,13,17557},{32879,42,6123},{32890,9,17563},
+{32893,14,6134},{32897,5,17566},{32899,38,6138},{32909,21,17570},
+{32915,0,6513},{32916,5,17576},{32918,62,6148},{32934,9,17582},
+{32937,46,6164},{32949,5,17588},{32951,0,6521},{32952,5,17590},
+{32954,50,6176},{32967,17,17594},{32972,10,6189},{32975,25,17599},
+{32982,34,6192},{32991,5,17607},{32993,0,1969},{32994,5,17609},
+{32996,10,6201},{32999,13,6522},{33003,74,6204},{33022,13,17617},
+{33026,0,4523},{33027,5,17621},{33029,6,6223},{33031,5,17623},
+{33033,6,6225},{33035,5,17625},{33037,5,6538},{33039,50,6227},
+{33052,5,17630},{33054,0,6546},{33055,49,17632},{33068,0,6547},
+{33069,5,17645},{33071,14,6240},{33075,9,17648},{33078,14,6244},
+{33082,13,17652},{33086,0,3009},{33087,25,17656},{33094,66,6248},
+{33111,5,17668},{33113,5,6554},{33115,17,17670},{33120,6,6265},
+{33122,9,17675},{33125,50,6267},{33138,5,17682},{33140,0,6553},
+{33141,9,17684},{33144,14,6280},{33148,5,6559},{33150,18,6284},
+{33155,17,17688},{33160,10,6289},{33163,13,17694},{33167,10,6292},
+{33170,21,17699},{33176,22,6295},{33182,5,17706},{33184,0,8101},
+{33185,5,17708},{33187,0,6569},{33188,5,17710},{33190,18,6301},
+{33195,29,17713},{33203,0,3326},{33204,21,17721},{33210,38,6306},
+{33220,5,17728},{33222,0,4195},{33223,5,17730},{33225,26,6316},
+{33232,29,17734},{33240,10,6323},{33243,13,17743},{33247,6,6326},
+{33249,5,17747},{33251,0,1249},{33252,9,17749},{33255,26,6328},
+{33262,17,17754},{33267,5,4544},{33269,17,17759},{33274,26,6335},
+{33281,5,7334},{33283,34,6342},{33292,5,3353},{33294,5,17768},
+{33296,18,6351},{33301,21,17772},{33307,22,6356},{33313,9,7339},
+{33316,13,17780},{33320,42,6362},{33331,5,7348},{33333,26,6373},
+{33340,5,17788},{33342,0,7350},{33343,17,17790},{33348,0,7351},
+{33349,5,17795},{33351,18,6380},{33356,9,17799},{33359,0,7354},
+{33360,29,17802},{33368,10,6385},{33371,13,17810},{33375,0,7356},
+{33376,13,17814},{33380,18,6388},{33385,5,17820},{33387,0,9712},
+{33388,5,17822},{33390,26,6393},{33397,5,17824},{33399,14,6400},
+{33403,5,17827},{33405,10,6404},{33408,5,17829},{33410,10,6407},
+{33413,9,17832},{33416,42,6410},{33427,13,17838},{33431,10,6421},
+{33434,5,17842},{33436,22,6424},{33442,5,17846},{33444,66,6430},
+{33461,5,17850},{33463,30,6447},{33471,5,17854},{33473,0,5112},
+{33474,5,17856},{33476,0,5118},{33477,5,17858},{33479,14,6455},
+{33483,5,5110},{33485,46,6459},{33497,5,17863},{33499,50,6471},
+{33512,9,17867},{33515,0,3316},{33516,9,17870},{33519,10,6484},
+{33522,5,17874},{33524,0,5128},{33525,5,17876},{33527,18,6487},
+{33532,17,17880},{33537,34,6492},{33546,5,17885},{33548,22,6501},
+{33554,5,17889},{33556,5,5137},{33558,6,6507},{33560,5,17892},
+{33562,10,6509},{33565,37,17894},{33575,6,6512},{33577,5,17904},
+{33579,70,6514},{33597,9,17911},{33600,0,5157},{33601,5,17914},
+{33603,0,5155},{33604,5,17916},{33606,14,6532},{33610,17,17919},
+{33615,22,6536},{33621,17,17925},{33626,0,2119},{33627,5,5143},
+{33629,62,6542},{33645,5,5170},{33647,0,4144},{33648,25,17932},
+{33655,6,6558},{33657,5,17939},{33659,10,6560},{33662,25,17941},
+{33669,6,6563},{33671,5,17948},{33673,6,6565},{33675,9,17950},
+{33678,0,3304},{33679,9,17953},{33682,6,6567},{33684,5,17956},
+{33686,10,6569},{33689,5,17959},{33691,30,6572},{33699,13,17964},
+{33703,18,6580},{33708,13,17968},{33712,10,6585},{33715,5,5174},
+{33717,34,6588},{33726,5,17974},{33728,6,6597},{33730,9,17976},
+{33733,10,6599},{33736,5,17980},{33738,10,6602},{33741,5,17983},
+{33743,0,1921},{33744,13,17985},{33748,18,6605},{33753,9,17991},
+{33756,22,6610},{33762,9,17995},{33765,0,5194},{33766,9,17998},
+{33769,6,6616},{33771,13,18001},{33775,14,6618},{33779,17,18005},
+{33784,5,5210},{33786,9,18010},{33789,0,5200},{33790,9,18013},
+{33793,26,6622},{33800,5,18018},{33802,30,6629},{33810,21,18021},
+{33816,0,5197},{33817,9,18027},{33820,6,6637},{33822,21,18030},
+{33828,5,4238},{33830,10,6639},{33833,9,18036},{33836,0,8587},
+{33837,13,18039},{33841,0,5234},{33842,9,18043},{33845,0,9033},
+{33846,5,18046},{33848,0,5203},{33849,9,18048},{33852,6,6642},
+{33854,29,18051},{33862,0,5229},{33863,5,18059},{33865,0,8715},
+{33866,25,18061},{33873,6,6644},{33875,13,18068},{33879,22,6646},
+{33885,13,18073},{33889,22,6652},{33895,5,18079},{33897,70,6658},
+{33915,25,18087},{33922,0,1466},{33923,13,18094},{33927,5,5223},
+{33929,22,6676},{33935,13,18100},{33939,6,6682},{33941,5,18104},
+{33943,10,6684},{33946,5,18107},{33948,0,3543},{33949,13,18109},
+{33953,0,5246},{33954,49,18113},{33967,0,4759},{33968,5,18126},
+{33970,10,6687},{33973,9,18129},{33976,38,6690},{33986,5,18134},
+{33988,0,4025},{33989,13,18136},{33993,18,6700},{33998,5,18141},
+{34000,14,6705},{34004,5,18144},{34006,0,1078},{34007,21,18146},
+{34013,14,6709},{34017,5,18153},{34019,14,6713},{34023,17,18156},
+{34028,18,6717},{34033,41,18162},{34044,14,6722},{34048,45,18174},
+{34060,0,5252},{34061,13,18186},{34065,14,6726},{34069,5,18191},
+{34071,0,4482},{34072,5,18193},{34074,0,3780},{34075,9,18195},
+{34078,22,6730},{34084,5,18200},{34086,0,9016},{34087,13,18202},
+{34091,10,6736},{34094,33,18206},{34103,26,6739},{34110,9,18215},
+{34113,10,6746},{34116,5,18219},{34118,18,6749},{34123,9,18222},
+{34126,0,9021},{34127,9,18225},{34130,30,6754},{34138,13,18230},
+{34142,0,5267},{34143,9,18234},{34146,10,6762},{34149,9,18238},
+{34152,10,6765},{34155,5,18241},{34157,0,8651},{34158,13,18243},
+{34162,10,6768},{34165,5,18248},{34167,18,6771},{34172,5,18251},
+{34174,0,2500},{34175,17,18253},{34180,34,6776},{34189,5,18261},
+{34191,10,6785},{34194,5,18264},{34196,0,8410},{34197,21,18266},
+{34203,6,6788},{34205,5,18272},{34207,0,9034},{34208,13,18274},
+{34212,26,6790},{34219,9,18280},{34222,10,6797},{34225,21,18283},
+{34231,14,6800},{34235,21,18290},{34241,0,5285},{34242,25,18296},
+{34249,0,2230},{34250,9,18303},{34253,14,6804},{34257,5,18306},
+{34259,10,6808},{34262,21,18309},{34268,6,6811},{34270,21,18315},
+{34276,6,6813},{34278,9,18321},{34281,6,6815},{34283,33,18324},
+{34292,10,6817},{34295,5,18334},{34297,10,6820},{34300,9,18336},
+{34303,0,5287},{34304,13,18339},{34308,14,6823},{34312,9,18343},
+{34315,0,8379},{34316,17,18346},{34321,0,2821},{34322,13,18351},
+{34326,0,5291},{34327,9,18355},{34330,0,9050},{34331,9,18358},
+{34334,0,9046},{34335,9,18361},{34338,0,9015},{34339,13,18364},
+{34343,10,6827},{34346,9,18369},{34349,0,8185},{34350,37,18372},
+{34360,18,6830},{34365,5,18384},{34367,0,8289},{34368,49,18386},
+{34381,18,6835},{34386,5,18399},{34388,6,6840},{34390,13,18401},
+{34394,22,6842},{34400,5,18407},{34402,0,6509},{34403,13,18409},
+{34407,0,8168},{34408,9,18413},{34411,14,6848},{34415,5,18417},
+{34417,0,3396},{34418,25,18419},{34425,38,6852},{34435,25,18426},
+{34442,14,6862},{34446,17,18433},{34451,10,6866},{34454,21,18439},
+{34460,6,6869},{34462,17,18445},{34467,6,6871},{34469,5,18450},
+{34471,22,6873},{34477,5,18453},{34479,10,6879},{34482,5,18455},
+{34484,10,6882},{34487,9,18457},{34490,0,7175},{34491,17,18460},
+{34496,0,4602},{34497,9,18465},{34500,30,6885},{34508,5,18470},
+{34510,14,6893},{34514,5,18472},{34516,0,2028},{34517,9,18474},
+{34520,14,6897},{34524,5,18478},{34526,6,6901},{34528,13,18480},
+{34532,0,1773},{34533,13,18484},{34537,0,7181},{34538,9,18488},
+{34541,14,6903},{34545,5,7182},{34547,6,6907},{34549,9,18492},
+{34552,10,6909},{34555,9,18495},{34558,22,6912},{34564,5,18500},
+{34566,18,6918},{34571,5,18502},{34573,0,7198},{34574,13,18504},
+{34578,50,6923},{34591,5,18513},{34593,18,6936},{34598,9,18516},
+{34601,0,7210},{34602,13,18519},{34606,0,7204},{34607,5,18523},
+{34609,0,7209},{34610,5,18525},{34612,0,7208},{34613,5,18527},
+{34615,0,7211},{34616,9,18529},{34619,0,7201},{34620,5,18532},
+{34622,6,6941},{34624,25,18534},{34631,10,6943},{34634,5,18541},
+{34636,10,6946},{34639,13,18544},{34643,26,6949},{34650,21,18551},
+{34656,0,7218},{34657,5,18557},{34659,14,6956},{34663,25,18559},
+{34670,10,6960},{34673,9,18567},{34676,18,6963},{34681,5,18572},
+{34683,6,6968},{34685,5,7215},{34687,9,18574},{34690,14,6970},
+{34694,5,18577},{34696,0,7234},{34697,5,18579},{34699,10,6974},
+{34702,17,18582},{34707,0,7229},{34708,9,18587},{34711,0,7237},
+{34712,21,18590},{34718,6,6977},{34720,5,18596},{34722,0,8742},
+{34723,17,18598},{34728,0,7231},{34729,5,18603},{34731,18,6979},
+{34736,9,18606},{34739,10,6984},{34742,13,18610},{34746,14,6987},
+{34750,5,18615},{34752,0,7248},{34753,9,18617},{34756,30,6991},
+{34764,5,18623},{34766,0,9697},{34767,5,18625},{34769,10,6999},
+{34772,25,18627},{34779,0,7250},{34780,13,18634},{34784,0,7252},
+{34785,5,18638},{34787,10,7002},{34790,13,18641},{34794,22,7005},
+{34800,5,18647},{34802,0,7817},{34803,9,18649},{34806,0,9689},
+{34807,5,18652},{34809,10,7011},{34812,5,18655},{34814,6,7014},
+{34816,9,18658},{34819,14,7016},{34823,9,18662},{34826,0,7257},
+{34827,17,18665},{34832,26,7020},{34839,13,18672},{34843,0,7258},
+{34844,9,18676},{34847,18,7027},{34852,49,18680},{34865,6,7032},
+{34867,9,18693},{34870,0,7771},{34871,5,18696},{34873,14,7034},
+{34877,9,18699},{34880,0,4051},{34881,9,18702},{34884,10,7038},
+{34887,9,18705},{34890,14,7041},{34894,17,18709},{34899,6,7045},
+{34901,5,18714},{34903,26,7047},{34910,9,18719},{34913,18,7054},
+{34918,5,18722},{34920,42,7059},{34931,13,18728},{34935,10,7070},
+{34938,9,18733},{34941,34,7073},{34950,5,18738},{34952,0,7360},
+{34953,5,18740},{34955,10,7082},{34958,13,18743},{34962,0,3598},
+{34963,9,18747},{34966,0,4015},{34967,17,18750},{34972,0,3729},
+{34973,17,18755},{34978,10,7085},{34981,21,18761},{34987,10,7088},
+{34990,9,18768},{34993,0,1695},{34994,17,18771},{34999,0,7086},
+{35000,13,18776},{35004,0,7087},{35005,13,18780},{35009,6,7091},
+{35011,5,18784},{35013,6,7093},{35015,5,18786},{35017,6,7095},
+{35019,9,18788},{35022,6,7097},{35024,5,18791},{35026,14,7099},
+{35030,5,18794},{35032,6,7103},{35034,5,18796},{35036,14,7105},
+{35040,5,18799},{35042,14,7109},{35046,5,18801},{35048,0,7096},
+{35049,25,18803},{35056,18,7113},{35061,9,18811},{35064,6,7118},
+{35066,5,18814},{35068,14,7120},{35072,5,18817},{35074,0,1836},
+{35075,13,18819},{35079,0,9846},{35080,5,18823},{35082,0,7103},
+{35083,17,18825},{35088,14,7124},{35092,17,18831},{35097,10,7128},
+{35100,17,18836},{35105,0,7099},{35106,9,18841},{35109,0,3271},
+{35110,13,18844},{35114,6,7131},{35116,13,18848},{35120,34,7133},
+{35129,5,18855},{35131,0,8925},{35132,17,18857},{35137,0,7107},
+{35138,5,18862},{35140,0,3922},{35141,5,18864},{35143,0,9661},
+{35144,53,18866},{35158,0,7722},{35159,21,18880},{35165,14,7142},
+{35169,9,18886},{35172,10,7146},{35175,9,18890},{35178,10,7149},
+{35181,5,18894},{35183,0,7807},{35184,5,18896},{35186,0,8621},
+{35187,29,18898},{35195,0,7109},{35196,9,18906},{35199,18,7152},
+{35204,5,18911},{35206,0,1709},{35207,13,18913},{35211,0,8086},
+{35212,9,18917},{35215,0,7986},{35216,9,18920},{35219,0,8324},
+{35220,5,18923},{35222,10,7157},{35225,29,18926},{35233,0,9402},
+{35234,13,18934},{35238,0,9404},{35239,9,18938},{35242,10,7160},
+{35245,5,18942},{35247,0,9405},{35248,5,18944},{35250,0,9406},
+{35251,13,18946},{35255,0,9407},{35256,5,18950},{35258,0,8146},
+{35259,5,18952},{35261,50,7163},{35274,9,6459},{35277,0,18956},
+{35278,13,6462},{35282,0,2200},{35283,9,18957},{35286,0,7511},
+{35287,9,18960},{35290,18,7176},{35295,13,18965},{35299,14,7181},
+{35303,13,18970},{35307,0,7516},{35308,9,18974},{35311,0,7517},
+{35312,9,18977},{35315,22,7185},{35321,25,18982},{35328,14,7191},
+{35332,9,18989},{35335,38,7195},{35345,5,18996},{35347,22,7205},
+{35353,5,19000},{35355,18,7211},{35360,9,19004},{35363,10,7216},
+{35366,13,19008},{35370,0,7922},{35371,5,19012},{35373,0,8479},
+{35374,9,19014},{35377,0,8669},{35378,5,19017},{35380,10,7219},
+{35383,9,19020},{35386,0,8834},{35387,9,19023},{35390,0,7518},
+{35391,5,19026},{35393,0,8934},{35394,13,19028},{35398,10,7222},
+{35401,17,19033},{35406,30,7225},{35414,5,19041},{35416,0,8938},
+{35417,5,19043},{35419,0,8893},{35420,5,19045},{35422,0,7838},
+{35423,5,19047},{35425,10,7233},{35428,5,19049},{35430,0,8503},
+{35431,5,19051},{35433,50,7236},{35446,9,19056},{35449,0,4435},
+{35450,5,19059},{35452,0,8944},{35453,5,19061},{35455,0,8942},
+{35456,13,19063},{35460,26,7249},{35467,5,19068},{35469,0,8446},
+{35470,9,19070},{35473,5,8953},{35475,10,7256},{35478,5,19074},
+{35480,10,7259},{35483,9,19077},{35486,42,7262},{35497,9,19083},
+{35500,0,8519},{35501,9,19086},{35504,10,7273},{35507,9,19090},
+{35510,0,8961},{35511,5,19093},{35513,0,7925},{35514,5,19095},
+{35516,0,8728},{35517,5,19097},{35519,0,7878},{35520,5,19099},
+{35522,10,7276},{35525,5,19102},{35527,46,7279},{35539,9,19109},
+{35542,6,7291},{35544,9,19112},{35547,14,7293},{35551,9,19116},
+{35554,22,7297},{35560,9,19121},{35563,14,7303},{35567,5,19125},
+{35569,10,7307},{35572,5,19128},{35574,70,7310},{35592,5,19136},
+{35594,0,8023},{35595,9,19138},{35598,10,7328},{35601,9,19142},
+{35604,38,7331},{35614,9,19148},{35617,0,8710},{35618,13,19151},
+{35622,10,7341},{35625,5,19156},{35627,10,7344},{35630,17,19158},
+{35635,0,8931},{35636,17,19163},{35641,0,8122},{35642,13,19168},
+{35646,0,8312},{35647,37,19172},{35657,0,8840},{35658,13,19182},
+{35662,6,7347},{35664,21,19186},{35670,26,7349},{35677,33,19194},
+{35686,0,2270},{35687,13,19203},{35691,6,7356},{35693,5,19207},
+{35695,6,7358},{35697,9,19209},{35700,0,8405},{35701,5,19212},
+{35703,0,8010},{35704,17,19214},{35709,0,8768},{35710,5,19219},
+{35712,0,7891},{35713,33,19221},{35722,0,7753},{35723,9,19230},
+{35726,0,9755},{35727,9,19233},{35730,18,7360},{35735,17,19237},
+{35740,38,7365},{35750,5,4888},{35752,46,7375},{35764,5,4891},
+{35766,46,7387},{35778,5,4894},{35780,54,7399},{35794,9,4899},
+{35797,10,7413},{35800,5,4903},{35802,18,7416},{35807,5,4906},
+{35809,26,7421},{35816,5,4909},{35818,154,7428},{35857,5,4924},
+{35859,0,3788},{35860,9,4926},{35863,30,7467},{35871,9,4933},
+{35874,30,7475},{35882,5,4938},{35884,6,7483},{35886,5,4940},
+{35888,6,7485},{35890,5,4942},{35892,0,3121},{35893,5,4944},
+{35895,0,1825},{35896,33,19252},{35905,0,2050},{35906,13,19261},
+{35910,14,7487},{35914,5,19265},{35916,0,3732},{35917,9,19267},
+{35920,0,7933},{35921,13,19270},{35925,0,7445},{35926,13,19274},
+{35930,0,6544},{35931,21,19278},{35937,6,7491},{35939,25,19284},
+{35946,6,7493},{35948,25,19291},{35955,0,5597},{35956,13,19298},
+{35960,10,7495},{35963,25,19302},{35970,0,7505},{35971,5,19309},
+{35973,0,7507},{35974,9,19311},{35977,14,7498},{35981,25,19315},
+{35988,0,7509},{35989,9,19322},{35992,0,7508},{35993,13,19325},
+{35997,22,7502},{36003,13,19330},{36007,22,7508},{36013,5,19334},
+{36015,110,7514},{36043,21,19342},{36049,18,7542},{36054,13,19349},
+{36058,54,7547},{36072,5,19357},{36074,14,7561},{36078,21,19359},
+{36084,0,8179},{36085,17,19365},{36090,22,7565},{36096,13,19371},
+{36100,6,7571},{36102,5,19375},{36104,34,7573},{36113,17,19380},
+{36118,0,8509},{36119,13,19385},{36123,90,7582},{36146,5,6444},
+{36148,66,7605},{36165,5,6450},{36167,0,6454},{36168,5,6452},
+{36170,26,7622},{36177,5,19390},{36179,82,7629},{36200,9,19395},
+{36203,10,7650},{36206,5,19399},{36208,0,4668},{36209,5,19401},
+{36211,18,7653},{36216,33,19403},{36225,0,1256},{36226,5,19412},
+{36228,6,7658},{36230,13,19414},{36234,6,7660},{36236,17,19418},
+{36241,0,7410},{36242,5,19423},{36244,6,7662},{36246,9,19425},
+{36249,0,8826},{36250,17,19428},{36255,0,3614},{36256,9,19433},
+{36259,0,3199},{36260,13,19436},{36264,0,8430},{36265,29,19440},
+{36273,18,7664},{36278,5,19448},{36280,30,7669},{36288,9,19453},
+{36291,14,7677},{36295,13,19457},{36299,10,7681},{36302,5,7461},
+{36304,6,7684},{36306,13,19463},{36310,5,7457},{36312,5,19467},
+{36314,22,7686},{36320,9,19470},{36323,6,7692},{36325,9,19473},
+{36328,18,7694},{36333,5,19477},{36335,0,2654},{36336,9,19479},
+{36339,14,7699},{36343,5,7466},{36345,18,7703},{36350,25,19485},
+{36357,0,7449},{36358,9,19492},{36361,14,7708},{36365,5,19496},
+{36367,6,7712},{36369,9,19498},{36372,0,7474},{36373,29,19501},
+{36381,10,7714},{36384,5,19509},{36386,6,7717},{36388,17,19511},
+{36393,34,7719},{36402,5,19519},{36404,6,7728},{36406,9,19521},
+{36409,6,7730},{36411,5,19524},{36413,0,7485},{36414,5,19526},
+{36416,0,7482},{36417,5,7488},{36419,6,7732},{36421,5,19529},
+{36423,22,7734},{36429,13,19531},{36433,5,7490},{36435,5,19535},
+{36437,0,9728},{36438,9,19537},{36441,0,7450},{36442,33,19540},
+{36451,0,9734},{36452,5,19549},{36454,0,1069},{36455,5,19551},
+{36457,0,7451},{36458,5,19553},{36460,42,7740},{36471,9,19559},
+{36474,10,7751},{36477,5,19563},{36479,10,7754},{36482,9,19566},
+{36485,62,7757},{36501,17,19573},{36506,18,7773},{36511,5,19580},
+{36513,0,9733},{36514,9,19582},{36517,6,7778},{36519,9,19585},
+{36522,10,7780},{36525,5,19588},{36527,0,3192},{36528,5,19590},
+{36530,0,1570},{36531,25,19592},{36538,0,3612},{36539,17,19599},
+{36544,0,8432},{36545,33,19604},{36554,18,7783},{36559,9,19613},
+{36562,10,7788},{36565,21,19617},{36571,0,9357},{36572,9,19623},
+{36575,0,8450},{36576,13,19626},{36580,0,9364},{36581,21,19630},
+{36587,0,9363},{36588,21,19636},{36594,0,9358},{36595,17,19642},
+{36600,30,7791},{36608,9,19649},{36611,30,7799},{36619,25,19655},
+{36626,14,7807},{36630,17,19663},{36635,10,7811},{36638,5,9373},
+{36640,17,19668},{36645,6,7814},{36647,5,19673},{36649,6,7816},
+{36651,13,19675},{36655,0,8048},{36656,9,19679},{36659,0,9376},
+{36660,13,19682},{36664,0,8507},{36665,5,19686},{36667,0,7943},
+{36668,5,19688},{36670,6,7818},{36672,5,19690},{36674,18,7820},
+{36679,5,19693},{36681,0,8872},{36682,9,19695},{36685,6,7825},
+{36687,17,19698},{36692,0,9378},{36693,37,19703},{36703,70,7827},
+{36721,9,6371},{36724,0,4576},{36725,5,6374},{36727,6,7845},
+{36729,5,6378},{36731,22,7847},{36737,5,6382},{36739,38,7853},
+{36749,9,6387},{36752,62,7863},{36768,9,19721},{36771,0,2460},
+{36772,5,19724},{36774,6,7879},{36776,5,1103},{36778,34,7881},
+{36787,9,19729},{36790,0,5949},{36791,5,19732},{36793,0,1096},
+{36794,9,19734},{36797,6,7890},{36799,5,19737},{36801,30,7892},
+{36809,17,19741},{36814,30,7900},{36822,5,19748},{36824,30,7908},
+{36832,5,19751},{36834,58,7916},{36849,5,19757},{36851,6,7931},
+{36853,5,19759},{36855,10,7933},{36858,9,19761},{36861,0,4628},
+{36862,5,19764},{36864,26,7936},{36871,5,19766},{36873,106,7943},
+{36900,5,19773},{36902,0,5962},{36903,21,19775},{36909,10,7970},
+{36912,5,19781},{36914,0,8123},{36915,5,19783},{36917,5,5967},
+{36919,6,7973},{36921,5,19786},{36923,14,7975},{36927,5,19789},
+{36929,14,7979},{36933,5,19792},{36935,0,4315},{36936,9,19794},
+{36939,22,7983},{36945,5,5972},{36947,22,7989},{36953,5,19799},
+{36955,42,7995},{36966,5,19805},{36968,6,8006},{36970,9,19807},
+{36973,6,8008},{36975,9,19810},{36978,74,8010},{36997,5,19818},
+{36999,18,8029},{37004,9,19821},{37007,58,8034},{37022,9,19830},
+{37025,10,8049},{37028,5,19833},{37030,0,1017},{37031,9,19835},
+{37034,70,8052},{37052,5,19842},{37054,0,4981},{37055,5,19844},
+{37057,0,4313},{37058,5,19846},{37060,14,8070},{37064,5,19849},
+{37066,0,2189},{37067,9,19851},{37070,22,8074},{37076,9,19855},
+{37079,0,4989},{37080,9,19858},{37083,30,8080},{37091,9,19863},
+{37094,10,8088},{37097,5,19866},{37099,18,8091},{37104,13,19870},
+{37108,6,8096},{37110,5,19874},{37112,0,1415},{37113,13,19876},
+{37117,10,8098},{37120,5,19881},{37122,18,8101},{37127,5,19885},
+{37129,0,8647},{37130,29,19887},{37138,18,8106},{37143,5,19897},
+{37145,0,1074},{37146,13,19899},{37150,0,4996},{37151,9,19903},
+{37154,6,8111},{37156,9,19906},{37159,0,7867},{37160,17,19909},
+{37165,38,8113},{37175,5,19917},{37177,6,8123},{37179,29,19919},
+{37187,0,5001},{37188,5,19927},{37190,30,8125},{37198,5,7418},
+{37200,10,8133},{37203,13,19931},{37207,0,4026},{37208,5,19935},
+{37210,0,1648},{37211,5,19937},{37213,6,8136},{37215,5,19939},
+{37217,18,8138},{37222,9,19941},{37225,66,8143},{37242,9,19947},
+{37245,5,7426},{37247,0,2899},{37248,17,19950},{37253,34,8160},
+{37262,5,19958},{37264,10,8169},{37267,9,19960},{37270,0,8789},
+{37271,9,19963},{37274,10,8172},{37277,17,19966},{37282,5,7436},
+{37284,21,19971},{37290,10,8175},{37293,9,7439},{37296,13,19977},
+{37300,6,8178},{37302,13,19981},{37306,0,7444},{37307,17,19985},
+{37312,70,8180},{37330,9,9459},{37333,18,8198},{37338,5,19996},
+{37340,6,8203},{37342,17,19998},{37347,6,8205},{37349,5,20003},
+{37351,10,8207},{37354,41,20006},{37365,22,8210},{37371,17,20019},
+{37376,6,8216},{37378,5,20024},{37380,0,9478},{37381,9,20026},
+{37384,6,8218},{37386,9,20029},{37389,18,8220},{37394,5,20033},
+{37396,6,8225},{37398,29,20035},{37406,0,8149},{37407,13,20043},
+{37411,18,8227},{37416,21,20048},{37422,10,8232},{37425,5,20055},
+{37427,6,8235},{37429,5,20057},{37431,14,8237},{37435,5,20059},
+{37437,14,8241},{37441,13,20061},{37445,0,9473},{37446,5,20065},
+{37448,6,8245},{37450,9,20067},{37453,0,9496},{37454,9,20070},
+{37457,0,7766},{37458,9,20073},{37461,10,8247},{37464,5,20077},
+{37466,6,8250},{37468,5,20079},{37470,0,9488},{37471,9,20081},
+{37474,0,7765},{37475,9,20084},{37478,0,9482},{37479,17,20087},
+{37484,5,9489},{37486,21,20092},{37492,0,2155},{37493,9,20098},
+{37496,14,8252},{37500,9,20102},{37503,6,8256},{37505,5,20105},
+{37507,10,8258},{37510,29,20108},{37518,0,7552},{37519,5,20116},
+{37521,10,8261},{37524,5,20119},{37526,26,8264},{37533,9,20124},
+{37536,0,9501},{37537,5,20127},{37539,46,8271},{37551,5,20132},
+{37553,0,9509},{37554,17,20134},{37559,22,8283},{37565,13,20141},
+{37569,30,8289},{37577,9,20148},{37580,0,9513},{37581,5,20151},
+{37583,0,9505},{37584,5,20153},{37586,0,7935},{37587,37,20155},
+{37597,10,8297},{37600,9,20166},{37603,30,8300},{37611,5,20171},
+{37613,18,8308},{37618,13,20173},{37622,10,8313},{37625,9,20178},
+{37628,0,7960},{37629,13,20181},{37633,0,9547},{37634,13,20185},
+{37638,0,9543},{37639,5,9551},{37641,25,20189},{37648,10,8316},
+{37651,5,20197},{37653,0,9548},{37654,5,20199},{37656,14,8319},
+{37660,9,20201},{37663,14,8323},{37667,9,20205},{37670,10,8327},
+{37673,5,20209},{37675,0,8619},{37676,5,20211},{37678,6,8330},
+{37680,5,20213},{37682,6,8332},{37684,5,20215},{37686,10,8334},
+{37689,17,20218},{37694,22,8337},{37700,5,20225},{37702,6,8343},
+{37704,9,20227},{37707,10,8345},{37710,21,20231},{37716,0,9558},
+{37717,9,20237},{37720,0,8808},{37721,5,20240},{37723,0,7894},
+{37724,29,20242},{37732,6,8348},{37734,9,20250},{37737,14,8350},
+{37741,9,20254},{37744,0,9561},{37745,13,20257},{37749,6,8354},
+{37751,9,20261},{37754,0,8829},{37755,9,20264},{37758,0,9598},
+{37759,9,20267},{37762,10,8356},{37765,5,20271},{37767,0,9566},
+{37768,5,20273},{37770,0,7732},{37771,13,20275},{37775,0,7558},
+{37776,21,20279},{37782,10,8359},{37785,33,20286},{37794,6,8362},
+{37796,5,20295},{37798,42,8364},{37809,5,20301},{37811,10,8375},
+{37814,5,20304},{37816,0,9569},{37817,21,20306},{37823,0,9570},
+{37824,9,20312},{37827,0,9580},{37828,9,20315},{37831,26,8378},
+{37838,9,20320},{37841,0,9582},{37842,13,20323},{37846,10,8385},
+{37849,9,20327},{37852,5,9576},{37854,26,8388},{37861,9,20332},
+{37864,0,9757},{37865,45,20335},{37877,18,8395},{37882,33,20349},
+{37891,0,9506},{37892,25,20358},{37899,0,9523},{37900,13,20365},
+{37904,18,8400},{37909,9,20370},{37912,6,8405},{37914,9,20373},
+{37917,0,9584},{37918,5,20376},{37920,0,9589},{37921,17,20378},
+{37926,5,9537},{37928,0,9565},{37929,17,20383},{37934,0,8218},
+{37935,9,20388},{37938,14,8407},{37942,5,20392},{37944,10,8411},
+{37947,9,20395},{37950,6,8414},{37952,13,20398},{37956,0,8867},
+{37957,17,20402},{37962,10,8416},{37965,17,20408},{37970,10,8419},
+{37973,41,20414},{37984,0,9492},{37985,5,20425},{37987,10,8422},
+{37990,17,20428},{37995,10,8425},{37998,5,20434},{38000,10,8428},
+{38003,13,20437},{38007,10,8431},{38010,5,20442},{38012,14,8434},
+{38016,17,20444},{38021,9,6798},{38024,14,8438},{38028,5,6803},
+{38030,0,3106},{38031,5,6805},{38033,34,8442},{38042,9,6810},
+{38045,22,8451},{38051,5,6813},{38053,38,8457},{38063,5,6819},
+{38065,18,8467},{38070,17,6823},{38075,0,4679},{38076,5,6828},
+{38078,38,8472},{38088,25,6832},{38095,0,20453},{38096,9,6839},
+{38099,5,20454},{38101,9,6842},{38104,22,8482},{38110,9,6848},
+{38113,10,8488},{38116,5,6852},{38118,0,20457},{38119,5,6854},
+{38121,18,8491},{38126,5,6859},{38128,10,8496},{38131,9,6861},
+{38134,22,8499},{38140,5,6866},{38142,30,8505},{38150,5,6871},
+{38152,0,4013},{38153,5,6873},{38155,6,8513},{38157,9,6875},
+{38160,6,8515},{38162,17,6878},{38167,22,8517},{38173,9,6885},
+{38176,38,8523},{38186,5,6889},{38188,18,8533},{38193,5,6893},
+{38195,10,8538},{38198,9,6896},{38201,18,8541},{38206,5,6900},
+{38208,14,8546},{38212,9,6904},{38215,26,8550},{38222,5,6909},
+{38224,6,8557},{38226,9,6911},{38229,0,20467},{38230,13,6914},
+{38234,14,8559},{38238,5,6919},{38240,0,20469},{38241,5,6922},
+{38243,0,2582},{38244,33,6924},{38253,14,8563},{38257,9,6934},
+{38260,5,20471},{38262,6,8567},{38264,25,20473},{38271,18,8569},
+{38276,5,20481},{38278,0,9152},{38279,5,20483},{38281,46,8574},
+{38293,9,20489},{38296,0,8809},{38297,29,20492},{38305,18,8586},
+{38310,5,20501},{38312,22,8591},{38318,13,20504},{38322,0,8783},
+{38323,9,20508},{38326,0,9163},{38327,5,20511},{38329,26,8597},
+{38336,9,20514},{38339,0,9168},{38340,5,20517},{38342,26,8604},
+{38349,9,20521},{38352,0,9171},{38353,9,20524},{38356,10,8611},
+{38359,17,20527},{38364,10,8614},{38367,5,20533},{38369,6,8617},
+{38371,5,20535},{38373,0,9157},{38374,5,20537},{38376,50,8619},
+{38389,5,5769},{38391,46,8632},{38403,5,5773},{38405,18,8644},
+{38410,13,5777},{38414,26,8649},{38421,9,5783},{38424,0,20543},
+{38425,5,5786},{38427,30,8656},{38435,25,20547},{38442,0,4952},
+{38443,9,20554},{38446,0,3273},{38447,5,20557},{38449,22,8664},
+{38455,13,20559},{38459,74,8670},{38478,5,20567},{38480,0,3915},
+{38481,9,20569},{38484,6,8689},{38486,5,20572},{38488,0,8986},
+{38489,5,20574},{38491,38,8691},{38501,5,20579},{38503,22,8701},
+{38509,9,20582},{38512,34,8707},{38521,13,20586},{38525,0,8705},
+{38526,25,20590},{38533,46,8716},{38545,9,20600},{38548,34,8728},
+{38557,37,20605},{38567,14,8737},{38571,17,20616},{38576,46,8741},
+{38588,5,7546},{38590,14,8753},{38594,5,20626},{38596,22,8757},
+{38602,5,20629},{38604,14,8763},{38608,5,20631},{38610,0,7549},
+{38611,5,20633},{38613,6,8767},{38615,5,20635},{38617,14,8769},
+{38621,9,20638},{38624,14,8773},{38628,13,20642},{38632,10,8777},
+{38635,13,20646},{38639,0,7523},{38640,5,20650},{38642,6,8780},
+{38644,5,20652},{38646,22,8782},{38652,5,20656},{38654,14,8788},
+{38658,5,20659},{38660,22,8792},{38666,9,20662},{38669,10,8798},
+{38672,9,20665},{38675,0,2881},{38676,5,20668},{38678,0,2593},
+{38679,17,20670},{38684,10,8801},{38687,29,20676},{38695,0,8616},
+{38696,5,20684},{38698,0,7529},{38699,5,20686},{38701,0,7530},
+{38702,5,20688},{38704,10,8804},{38707,17,20691},{38712,6,8807},
+{38714,9,20696},{38717,6,8809},{38719,9,20699},{38722,10,8811},
+{38725,9,20703},{38728,0,8242},{38729,33,20706},{38738,6,8814},
+{38740,5,20715},{38742,0,2279},{38743,5,20717},{38745,10,8816},
+{38748,5,20719},{38750,18,8819},{38755,5,20722},{38757,0,4738},
+{38758,5,20724},{38760,6,8824},{38762,33,20726},{38771,14,8826},
+{38775,17,20736},{38780,0,7624},{38781,29,20741},{38789,0,7625},
+{38790,17,20749},{38795,22,8830},{38801,5,7626},{38803,6,8836},
+{38805,9,20758},{38808,0,3143},{38809,25,20761},{38816,0,2302},
+{38817,5,20768},{38819,0,7631},{38820,5,20770},{38822,0,9877},
+{38823,13,20772},{38827,18,8838},{38832,5,20778},{38834,10,8843},
+{38837,29,20781},{38845,0,9822},{38846,17,20789},{38851,0,9821},
+{38852,5,20794},{38854,0,9874},{38855,5,20796},{38857,14,8846},
+{38861,21,20799},{38867,0,8000},{38868,17,20805},{38873,0,9317},
+{38874,5,20810},{38876,10,8850},{38879,25,20813},{38886,14,8853},
+{38890,9,6222},{38893,0,2289},{38894,17,20821},{38899,14,8857},
+{38903,29,20827},{38911,58,8861},{38926,5,9670},{38928,14,8876},
+{38932,9,20840},{38935,6,8880},{38937,9,20843},{38940,0,9673},
+{38941,13,20846},{38945,0,9672},{38946,5,20850},{38948,10,8882},
+{38951,21,20853},{38957,0,8573},{38958,5,20859},{38960,0,8062},
+{38961,21,20861},{38967,6,8885},{38969,5,20867},{38971,10,8887},
+{38974,29,20870},{38982,0,8154},{38983,17,20878},{38988,10,8890},
+{38991,13,20883},{38995,6,8893},{38997,9,20887},{39000,14,8895},
+{39004,5,20891},{39006,0,8200},{39007,9,20893},{39010,0,9680},
+{39011,5,20896},{39013,10,8899},{39016,9,20899},{39019,6,8902},
+{39021,5,20902},{39023,114,8904},{39052,5,7140},{39054,46,8933},
+{39066,5,7144},{39068,6,8945},{39070,5,7146},{39072,0,1472},
+{39073,5,7148},{39075,6,8947},{39077,5,7150},{39079,6,8949},
+{39081,17,20911},{39086,5,9420},{39088,14,8951},{39092,5,20918},
+{39094,0,9422},{39095,17,20920},{39100,0,9423},{39101,25,20925},
+{39108,18,8955},{39113,17,20934},{39118,0,1668},{39119,5,20939},
+{39121,9,6583},{39124,6,8960},{39126,5,20942},{39128,0,3021},
+{39129,5,6587},{39131,0,7924},{39132,5,20944},{39134,18,8962},
+{39139,13,20947},{39143,10,8967},{39146,5,9119},{39148,14,8970},
+{39152,5,20953},{39154,10,8974},{39157,25,20956},{39164,14,8977},
+{39168,9,20964},{39171,10,8981},{39174,9,20968},{39177,18,8984},
+{39182,5,20972},{39184,14,8989},{39188,13,20974},{39192,0,8760},
+{39193,5,20978},{39195,0,9125},{39196,5,20980},{39198,0,8090},
+{39199,5,20982},{39201,0,8643},{39202,21,20984},{39208,0,7982},
+{39209,17,20990},{39214,0,7657},{39215,13,20995},{39219,0,9116},
+{39220,9,20999},{39223,0,9126},{39224,13,21002},{39228,14,8993},
+{39232,9,21007},{39235,10,8997},{39238,5,21011},{39240,9,9129},
+{39243,6,9000},{39245,13,21013},{39249,26,9002},{39256,13,21019},
+{39260,10,9009},{39263,9,21024},{39266,18,9012},{39271,21,5662},
+{39277,42,9017},{39288,5,21030},{39290,30,9028},{39298,5,21034},
+{39300,46,9036},{39312,5,5676},{39314,0,2719},{39315,9,5678},
+{39318,14,9048},{39322,41,21039},{39333,0,6955},{39334,5,21050},
+{39336,0,5086},{39337,9,21052},{39340,10,9052},{39343,5,21055},
+{39345,14,9055},{39349,45,21058},{39361,0,7767},{39362,53,21070},
+{39376,22,9059},{39382,5,21085},{39384,42,9065},{39395,37,21091},
+{39405,0,7999},{39406,9,21101},{39409,0,8295},{39410,49,21104},
+{39423,10,9076},{39426,9,21118},{39429,0,9231},{39430,25,21121},
+{39437,10,9079},{39440,21,21128},{39446,0,9234},{39447,5,21134},
+{39449,0,8375},{39450,65,21136},{39467,22,9082},{39473,17,21155},
+{39478,10,9088},{39481,17,21160},{39486,18,9091},{39491,5,9238},
+{39493,0,8433},{39494,13,21166},{39498,0,9226},{39499,5,21170},
+{39501,10,9096},{39504,17,21173},{39509,10,9099},{39512,5,21179},
+{39514,6,9102},{39516,9,21181},{39519,0,8860},{39520,5,21184},
+{39522,14,9104},{39526,13,21187},{39530,50,9108},{39543,5,6075},
+{39545,26,9121},{39552,5,6080},{39554,42,9128},{39565,5,21195},
+{39567,10,9139},{39570,5,6086},{39572,5,21197},{39574,18,9142},
+{39579,9,6090},{39582,0,5941},{39583,5,6093},{39585,0,2697},
+{39586,5,6095},{39588,18,9147},{39593,21,21201},{39599,10,9152},
+{39602,13,21207},{39606,26,9155},{39613,9,21213},{39616,10,9162},
+{39619,5,21216},{39621,0,7643},{39622,17,21218},{39627,5,7645},
+{39629,5,21223},{39631,38,9165},{39641,21,21227},{39647,10,9175},
+{39650,13,21234},{39654,0,7662},{39655,13,21238},{39659,18,9178},
+{39664,33,21243},{39673,10,9183},{39676,25,21253},{39683,0,4660},
+{39684,5,21260},{39686,10,9186},{39689,13,21263},{39693,10,9189},
+{39696,9,21268},{39699,0,7670},{39700,21,21271},{39706,0,9888},
+{39707,13,21277},{39711,0,7671},{39712,5,21281},{39714,30,9192},
+{39722,13,21286},{39726,18,9200},{39731,29,21291},{39739,6,9205},
+{39741,13,21299},{39745,34,9207},{39754,9,21304},{39757,18,9216},
+{39762,5,21308},{39764,0,2826},{39765,9,21310},{39768,10,9221},
+{39771,77,21314},{39791,0,8266},{39792,13,21334},{39796,0,9759},
+{39797,5,21338},{39799,0,9758},{39800,33,21340},{39809,10,9224},
+{39812,37,21350},{39822,18,9227},{39827,25,21361},{39834,0,9769},
+{39835,5,21368},{39837,6,9232},{39839,41,21370},{39850,18,9234},
+{39855,65,21382},{39872,6,9239},{39874,17,21399},{39879,14,9241},
+{39883,33,21405},{39892,10,9245},{39895,13,21415},{39899,10,9248},
+{39902,9,21420},{39905,14,9251},{39909,5,21424},{39911,10,9255},
+{39914,5,9787},{39916,13,21427},{39920,0,9794},{39921,9,21431},
+{39924,0,9796},{39925,29,21434},{39933,10,9258},{39936,29,21443},
+{39944,6,9261},{39946,9,21451},{39949,0,9801},{39950,5,21454},
+{39952,14,9263},{39956,45,21457},{39968,0,9805},{39969,5,21469},
+{39971,10,9267},{39974,5,21472},{39976,6,9270},{39978,9,21474},
+{39981,0,9807},{39982,9,21477},{39985,42,9272},{39996,5,21484},
+{39998,0,9812},{39999,21,21486},{40005,0,9816},{40006,5,21492},
+{40008,6,9283},{40010,29,21494},{40018,26,9285},{40025,13,21504},
+{40029,10,9292},{40032,25,21509},{40039,0,9820},{40040,17,21516},
+{40045,0,9772},{40046,37,21521},{40056,18,9295},{40061,5,21533},
+{40063,14,9300},{40067,5,21536},{40069,13,7563},{40073,5,21538},
+{40075,18,9304},{40080,9,7570},{40083,0,21542},{40084,5,7573},
+{40086,13,21543},{40090,5,7575},{40092,6,9309},{40094,21,7577},
+{40100,0,2523},{40101,17,7583},{40106,10,9311},{40109,5,7589},
+{40111,0,21550},{40112,29,7591},{40120,6,9314},{40122,13,7599},
+{40126,17,21552},{40131,0,3285},{40132,13,7603},{40136,5,21557},
+{40138,25,7607},{40145,5,21559},{40147,9,7614},{40150,0,1111},
+{40151,9,7617},{40154,5,21561},{40156,5,7620},{40158,6,9316},
+{40160,5,21563},{40162,0,7623},{40163,5,21565},{40165,0,8348},
+{40166,9,21567},{40169,0,9600},{40170,5,21570},{40172,0,8924},
+{40173,21,21572},{40179,14,9318},{40183,57,21579},{40198,14,9322},
+{40202,41,21595},{40213,0,8578},{40214,17,21606},{40219,18,9326},
+{40224,9,21613},{40227,0,9604},{40228,5,21616},{40230,10,9331},
+{40233,21,21619},{40239,6,9334},{40241,37,21625},{40251,0,8007},
+{40252,9,21635},{40255,0,7965},{40256,5,21638},{40258,0,9613},
+{40259,53,21640},{40273,10,9336},{40276,29,21654},{40284,6,9339},
+{40286,5,21662},{40288,6,9341},{40290,29,21664},{40298,10,9343},
+{40301,5,21673},{40303,0,9624},{40304,5,21675},{40306,0,8438},
+{40307,77,21677},{40327,10,9346},{40330,33,21698},{40339,0,9622},
+{40340,13,21707},{40344,10,9349},{40347,37,21712},{40357,0,9629},
+{40358,9,21722},{40361,0,9630},{40362,17,21725},{40367,0,9036},
+{40368,13,21730},{40372,0,8004},{40373,21,21734},{40379,6,9352},
+{40381,9,21740},{40384,18,9354},{40389,53,21745},{40403,0,9634},
+{40404,9,21759},{40407,14,9359},{40411,37,21763},{40421,6,9363},
+{40423,29,21773},{40431,0,9636},{40432,5,21781},{40434,6,9365},
+{40436,13,21783},{40440,10,9367},{40443,65,21787},{40460,0,9640},
+{40461,29,21804},{40469,0,9606},{40470,13,21812},{40474,54,9370},
+{40488,17,6967},{40493,46,9384},{40505,5,6977},{40507,5,21822},
+{40509,14,9396},{40513,5,6980},{40515,10,9400},{40518,13,6983},
+{40522,0,3216},{40523,5,6987},{40525,18,9403},{40530,9,21827},
+{40533,18,9408},{40538,9,6993},{40541,6,9413},{40543,13,21833},
+{40547,10,9415},{40550,25,6998},{40557,0,7006},{40558,5,21838},
+{40560,22,9418},{40566,9,21842},{40569,26,9424},{40576,5,21846},
+{40578,0,7676},{40579,13,21848},{40583,5,7677},{40585,5,21852},
+{40587,0,7679},{40588,21,21854},{40594,6,9431},{40596,9,21860},
+{40599,0,8207},{40600,17,21863},{40605,10,9433},{40608,17,21869},
+{40613,6,9436},{40615,5,21874},{40617,0,9719},{40618,17,21876},
+{40623,0,9878},{40624,13,21881},{40628,6,9438},{40630,5,21885},
+{40632,0,7405},{40633,5,21887},{40635,6,9440},{40637,5,7673},
+{40639,17,21890},{40644,0,2011},{40645,13,21895},{40649,0,4856},
+{40650,5,21899},{40652,22,9442},{40658,5,21902},{40660,0,3114},
+{40661,9,21904},{40664,0,2831},{40665,5,21907},{40667,9,7684},
+{40670,18,9448},{40675,5,21910},{40677,22,9453},{40683,13,21913},
+{40687,0,7694},{40688,5,21917},{40690,10,9459},{40693,5,21920},
+{40695,14,9462},{40699,5,6742},{40701,10,9466},{40704,33,21924},
+{40713,30,9469},{40721,5,21936},{40723,26,9477},{40730,21,21941},
+{40736,10,9484},{40739,33,21948},{40748,0,7696},{40749,5,21957},
+{40751,0,7697},{40752,25,21959},{40759,22,9487},{40765,5,7700},
+{40767,17,21969},{40772,0,7702},{40773,17,21974},{40778,6,9493},
+{40780,9,21979},{40783,22,9495},{40789,13,21983},{40793,0,9745},
+{40794,5,21987},{40796,0,9747},{40797,5,21989},{40799,18,9501},
+{40804,5,21992},{40806,0,9748},{40807,9,21994},{40810,10,9506},
+{40813,17,21998},{40818,0,8434},{40819,13,22003},{40823,0,9751},
+{40824,25,22007},{40831,6,9509},{40833,5,22014},{40835,6,9511},
+{40837,21,7535},{40843,10,9513},{40846,5,22016},{40848,0,8371},
+{40849,9,22018},{40852,6,9516},{40854,9,22021},{40857,14,9518},
+{40861,5,22024},{40863,6,9522},{40865,17,22026},{59414,9,22048},
+{59422,0,22056},{59430,0,22064},{59435,5,22069},{59441,5,22075},
+{59451,0,22085},{59459,0,22093},{59476,5,22110},{59492,0,22126},
+{63788,0,22031},{64013,9,22032},{64017,0,22035},{64019,5,22036},
+{64024,0,22038},{64031,9,22039},{64035,5,22042},{64039,9,22044},
+{65072,0,10013},{65097,37,10027},{65108,13,10037},{65113,53,10041},
+{65128,13,10055},{65281,9,262},{65284,0,166},{65285,353,266},
+{65374,0,106},{65504,5,168},{65506,14,9524},
+};
+
+static const unsigned short cmap_UniGB_UCS2_H_table[9528] = {
+167,22354,171,102,162,127,671,669,675,673,693,679,
+677,683,681,687,685,9910,105,9911,107,9912,108,185,
+188,151,157,9921,142,136,135,145,159,158,130,138,
+152,147,181,180,183,182,179,178,177,176,174,173,
+22428,22047,22055,22060,4162,4707,4722,4709,4185,10131,1597,4867,
+3238,1592,3270,982,4765,4884,4879,2091,5017,1431,2543,4860,
+4710,4740,10778,3397,1150,4946,1228,5020,4283,2407,5523,3698,
+3414,5660,11565,3859,1398,2927,4656,5934,1386,3948,5302,3395,
+6004,3318,6165,1789,2093,2238,1732,6163,1852,5016,5293,5366,
+1798,5986,5614,5600,3983,1765,12946,3437,4518,6409,3795,1526,
+2240,1626,3821,3248,4350,4357,2849,3124,4536,1400,6589,3826,
+1073,2736,3430,3095,3491,2053,4611,1715,4713,5789,3019,4073,
+2916,3209,4041,4310,1832,3728,1733,3379,4264,3650,7110,7008,
+16063,994,3011,2808,2850,2737,3407,3398,3413,16587,1923,4049,
+2539,4592,2780,7399,7262,3753,4123,4309,2490,1591,7115,1593,
+6686,3261,1249,4657,4544,2297,3353,5656,4570,7388,3300,17826,
+7152,1291,4051,3995,4169,18908,8086,2200,4093,1825,1528,7445,
+7504,7739,1285,4668,4672,3366,7803,3980,1250,19731,4191,4276,
+19992,2522,2241,7797,8317,1714,2542,7545,4303,20714,1636,2795,
+1770,8589,2289,4219,8713,7936,7924,3402,3438,3920,8301,1824,
+1754,7660,7888,5019,4704,1862,8761,8348,9864,2656,8305,2704,
+21894,3465,1937,6741,9752,1509,1821,3466,1072,8390,7814,8247,
+7988,4851,104,10024,7703,9989,189,10059,22357,99,10019,22065,
+22068,22109,22108,22117,22112,4162,1504,10072,3070,3747,4458,3288,
+3336,3887,4696,1154,4304,10076,4698,1304,10077,4613,3151,4701,
+3415,10078,3181,1124,4156,1367,1514,3508,4703,1513,10082,2566,
+4088,10083,3294,4707,10084,1777,4071,5788,4559,1662,10087,1329,
+10088,2594,10089,4722,10090,3737,1413,3769,4598,10091,2529,2312,
+4709,2862,10095,2290,10096,4711,2745,4204,10097,4525,3817,4424,
+1964,1603,2497,10098,3032,2963,3140,10099,1837,10100,1264,4185,
+4725,2292,3089,4153,3869,3924,2713,2681,10115,3268,2580,10132,
+4301,4506,10133,3417,1597,4695,4287,2436,10134,4361,1978,4727,
+3828,2269,4702,10137,4080,3956,8689,4723,4867,3751,2375,10140,
+2188,1884,4199,1217,1943,2841,10141,3930,2264,3669,2570,3156,
+4869,10145,4872,3238,4767,4193,3401,3237,4770,4768,4732,2247,
+3052,1301,10153,4769,2242,2234,10154,3247,1366,2687,10157,1181,
+4653,3426,3568,4461,1713,3894,4846,4774,3111,10161,4772,10162,
+1405,2615,4187,4771,10165,4174,4773,2764,4127,10169,4568,4776,
+10170,4779,2161,2126,3241,10174,1658,10175,1631,10176,3090,4782,
+4168,3832,2098,1689,1602,4008,4569,4266,2052,2038,4775,3290,
+3775,1326,10193,4777,10194,3332,4780,2686,4781,3776,4783,1141,
+1817,10200,4791,10201,1012,10202,2607,10203,3365,10204,3514,10205,
+3515,4792,3786,1454,4606,4689,4280,10219,3640,10220,1925,10221,
+4790,4848,4293,4787,1677,4692,4788,4784,4789,2886,4251,4778,
+4849,10224,4785,10225,2982,4121,998,2116,4794,10232,4793,4800,
+4802,10237,4799,3408,4797,4533,10241,8178,10242,1283,4796,10243,
+2536,10244,3427,10245,4798,10246,4795,4804,10249,8285,1520,1794,
+10253,4167,2665,10258,2197,4493,1191,3141,2424,4801,10259,4803,
+10260,3833,1957,9884,1372,1580,4808,4850,3147,2537,4812,3532,
+1690,10289,4809,10290,4811,1036,4294,4813,8629,3984,10291,4810,
+4805,10294,4806,2546,4807,2150,4009,1700,10297,2322,10298,4817,
+4814,10303,958,4822,10307,8908,7778,10315,7968,4824,1055,10316,
+4819,10317,8319,1434,10318,2338,3611,1961,4183,10322,4823,2233,
+10325,1232,4825,2330,10329,4826,4815,2882,8284,4818,4821,4820,
+4431,10341,4532,10342,3168,2124,4830,8596,4816,10352,4831,3018,
+4691,10362,3668,7781,8833,2941,3686,4827,1226,2443,8909,10407,
+8458,7742,9855,1401,10416,4834,10417,4835,1317,4836,1378,8750,
+972,7830,8907,8812,10424,8471,4837,3310,3934,10442,8415,8386,
+4838,8108,4842,3303,8915,4841,4840,4843,3536,10465,2170,8065,
+10469,3014,8720,10474,8911,10475,8723,10476,4839,4844,8164,8080,
+10477,4845,8918,10482,3264,10483,8912,8910,7798,10492,2503,8919,
+8917,8913,1592,4697,4365,10516,4333,4001,1289,4472,10517,3893,
+1851,10518,2392,10519,2791,1553,7909,10523,3700,4866,4868,1428,
+10527,1524,3206,8229,10537,982,1796,2626,4854,10538,2471,1803,
+10539,1841,3990,1121,3075,2318,1477,4645,10540,4129,2137,3445,
+2096,4858,4765,1743,3224,1192,4380,2790,4884,3258,10555,3967,
+10556,2347,2922,1843,10560,4885,10561,4332,4886,4879,1515,1672,
+1122,4880,1290,2341,10569,2435,4152,2511,1522,4882,4881,3071,
+10578,4633,4883,10579,2562,10580,1491,2609,7887,10581,2152,10582,
+1368,2598,10592,2912,2091,1615,4864,10603,3037,10604,2362,2016,
+8153,10605,1451,10606,5017,4002,10607,3690,967,1307,2060,5018,
+1894,10608,4391,1431,1492,4748,3243,1651,3149,4749,10611,2364,
+5003,4750,3991,1987,6510,2585,2622,4405,1744,1335,10619,1306,
+2970,2534,10628,1113,10629,4751,1831,10630,1438,4549,3479,3210,
+3307,1359,2393,10635,1869,10636,1574,2100,3645,8904,3940,9859,
+4755,3117,1833,2164,3633,10645,3049,7959,4758,10650,4756,1033,
+10656,2326,10657,3386,2151,7979,1708,1769,10663,8906,7833,4760,
+10671,2204,10672,4762,4761,8015,8143,3005,8246,7994,10676,8905,
+8089,4763,8053,10679,4764,2543,10687,3211,1015,1791,2118,3840,
+5005,2588,1518,4601,2925,2218,2531,2257,2488,5008,3421,10705,
+8126,10706,1137,4263,10710,2792,10711,4052,5010,10716,2496,7885,
+5011,10719,2366,8617,10720,8678,10721,8487,8195,2847,8498,10724,
+3159,5012,8995,8437,4860,3344,1805,3839,4363,1031,1365,10748,
+4004,4861,10753,5301,4863,4710,1988,1050,10758,1276,4740,2180,
+2428,10763,3880,8901,4743,8030,10771,8902,3012,3189,4164,4744,
+2887,8431,3397,10781,3108,10782,4700,10783,3382,3830,2033,1014,
+1983,3960,10787,1049,4673,4636,8656,1414,2715,2866,1136,10790,
+1150,10791,1102,5370,4445,2357,2643,4747,2648,10792,4746,3811,
+10793,4946,10794,3791,4714,2739,4230,3762,10797,2087,3215,2680,
+10798,2332,3969,10799,4947,1228,10806,1585,3663,2533,2530,10809,
+4066,4106,4733,2512,8897,1960,4734,10821,4336,7780,10822,3918,
+4735,10823,4736,3888,10824,1309,2294,8697,4737,8208,10831,8898,
+10832,5020,3909,10840,3289,1173,7770,4283,1197,2083,4278,3488,
+1617,3452,10850,3196,3443,1101,4027,10851,2962,5013,1503,10855,
+7842,2407,1822,2323,2614,10856,5374,5373,4538,2209,4474,979,
+1506,2390,3579,5371,3406,4279,10857,4741,4157,1916,3507,3601,
+10858,5375,1489,5372,4314,10862,1273,1778,10863,5378,10864,1926,
+2077,1494,10865,3677,2816,1962,2527,3699,3935,5376,3890,10866,
+2663,5377,2711,2348,10870,2600,3709,4222,1642,5385,10871,5388,
+1678,980,1557,1649,10874,1891,3664,2401,3494,3091,10875,4519,
+5389,10876,3825,1240,3851,1336,10879,3798,1959,10880,3824,10881,
+4070,1399,10886,1263,10887,1761,5379,2856,10892,2940,5383,5386,
+4340,5387,10893,3127,3815,2875,10899,5394,10900,5399,10901,4571,
+5393,5410,3781,10910,1918,5398,5392,2975,3364,1963,2817,2310,
+10915,5390,10916,5397,10917,2969,4423,1924,10922,2299,4258,1723,
+10923,4579,10924,5391,1815,2356,10927,5400,5411,5421,10933,5407,
+5406,4646,5991,4142,5402,10934,2358,10935,4382,10936,2389,5404,
+5413,9069,4083,10942,5414,946,3030,5403,10943,1948,10944,1566,
+3724,1879,4376,5415,3929,944,5423,5401,4079,5405,5412,10947,
+1982,10948,10949,5418,5422,5424,4249,10950,8775,1762,2935,5426,
+3347,2545,2855,2411,3941,4477,5430,1151,10965,1942,5428,10966,
+5009,10967,4109,9068,10970,3561,1344,10971,945,5433,3609,5434,
+5427,10989,5436,10994,1976,10995,3442,3767,5453,1231,10996,5452,
+5446,11004,3722,5444,11005,5442,11006,2397,4641,11007,3333,5440,
+940,8604,5445,8393,11016,5443,5448,5454,11022,8688,3008,3311,
+2461,5437,2943,11029,4730,5441,2905,5466,3639,11038,5463,11039,
+2355,5461,3784,5457,3327,2457,5460,1956,1895,5455,5438,11045,
+5465,1328,5471,3871,1919,11053,5462,8459,11063,8414,11064,7850,
+5458,8748,4414,11067,5439,11068,2984,11069,5459,11070,4316,11071,
+5482,4012,8408,8896,11077,5474,5476,5456,3293,5479,11082,5464,
+8609,11086,3423,5481,11087,5467,11088,3802,11089,3512,5491,5484,
+5480,11090,5489,9081,5472,11095,5490,9074,5473,3529,5499,11101,
+5500,5496,8554,11106,5494,2113,5495,9084,1725,4731,8368,11113,
+9082,7796,4021,2710,9079,11116,5493,5475,5498,5497,5501,11122,
+8012,5506,5502,9080,8655,9064,4597,1237,11125,4681,9073,3504,
+11126,9065,5504,11127,3850,1936,11131,9844,5511,5507,4148,5505,
+5503,5509,5510,9071,9072,11153,5508,11154,5514,9078,9075,11155,
+3094,4706,4398,5516,3424,9087,11158,5515,9076,11159,8373,11160,
+1724,11161,7899,9842,11162,5519,5513,8631,9077,11174,1910,3642,
+5520,11178,9090,9067,11193,8249,9887,5521,9085,8693,11202,9089,
+3229,9083,9086,8652,9066,9865,2869,11214,9879,3185,3513,11225,
+5524,2029,4716,4217,5525,3702,11226,1561,5527,11233,4339,2450,
+1364,3766,5526,5528,1829,1875,3693,5529,3059,5530,11246,4341,
+9091,3201,5532,5531,7997,11247,8591,8774,8776,8574,11254,8576,
+4381,5031,5033,11267,5032,1856,5035,1222,5039,2061,11277,4534,
+11278,5040,1624,11285,5024,3585,2367,1994,4693,2400,2132,3590,
+5038,990,3834,1653,4630,3041,2447,11295,3596,11296,5047,5041,
+3033,5043,11297,5048,11298,3000,5049,2381,5046,5045,1340,2455,
+2633,5042,5044,3992,5053,2504,5058,5059,5026,1809,4334,5052,
+11332,2398,5056,11333,5025,11334,1479,11335,5051,2418,5054,11339,
+5057,1786,942,1260,5055,5064,11363,3057,5060,5061,5063,5062,
+5070,11368,4311,1153,9002,5074,11379,5067,8843,5068,2977,2062,
+5075,11390,3606,8069,1552,5196,8997,5071,11395,5072,1576,9004,
+9006,5076,11407,5079,1037,8709,4104,7736,7795,1537,8163,9017,
+3567,6563,11440,9003,11441,3537,9005,11442,3571,8575,3604,8615,
+11453,9007,5080,3649,5081,5027,11474,5085,5082,11475,2274,11476,
+3474,5083,7874,3331,2844,3130,5084,11492,8882,11493,4409,4017,
+2830,1556,8409,5028,11517,8157,5029,11523,8551,5030,11533,8685,
+11534,1909,8199,8998,9001,8018,8251,9000,11540,8999,11541,3227,
+7723,11546,3414,3236,11547,4624,8878,3378,4163,8009,5660,11560,
+1321,1711,11568,3889,4859,3859,3731,4865,1567,11575,4160,8321,
+11580,5659,5657,11581,1398,11582,3647,3582,1679,11583,4712,4116,
+1906,11584,3390,4171,2417,2115,1568,11589,5295,11590,8060,5296,
+5004,11593,4098,3077,2865,1675,11596,1657,2441,4669,11599,3092,
+1061,5298,2178,3626,5300,11602,5299,1485,11608,3350,9051,7902,
+11614,8098,11615,7930,2927,2924,11620,2863,11621,2140,3570,6005,
+3266,6006,3758,11628,4622,1721,2703,11629,3244,1545,2110,4134,
+6011,11638,2803,8877,6014,6010,6015,3720,2880,6018,2760,11658,
+3069,6012,3411,2228,1820,6016,4000,3774,6019,6026,11677,4141,
+11678,2171,6023,6025,11684,2492,6027,11702,4221,4648,11706,3759,
+11707,3727,2637,2192,6024,6029,6032,11714,6034,2329,3368,6033,
+11726,1583,4302,6030,11737,6031,11738,3197,6035,8255,3746,6037,
+7950,6036,4233,6041,3373,6045,2761,6044,6049,3870,11838,6564,
+8297,6047,2129,3298,6050,11860,6051,11861,6056,9207,6058,6053,
+1462,11868,6054,2878,11873,6048,9210,6060,11898,9214,8104,6062,
+6061,11908,9217,8737,11929,6063,11930,4876,6064,8482,4656,6071,
+11954,6072,2404,4371,11955,4659,1385,3556,6068,4729,4651,3949,
+11956,2772,6073,2097,1819,6069,4048,1881,2678,8538,4705,3458,
+5994,11964,6070,11965,1682,8677,11968,3265,2904,11971,8279,5934,
+2913,11972,3569,5935,4429,11973,4307,3439,957,11974,3523,3739,
+5937,11980,5936,11981,4663,1842,4581,1511,3745,4178,1039,3404,
+11982,1293,3372,2394,4038,3433,5938,2007,3913,1797,1885,4112,
+3945,2117,11992,5939,3256,2426,1119,3539,2104,11998,2103,4225,
+2785,2409,2759,12006,1893,4325,3163,2834,1203,12016,1834,8421,
+12017,5943,2577,8495,8355,4432,8481,12018,8660,8165,12019,5944,
+12020,5946,7818,7735,12025,1386,1555,3511,4057,1437,3440,12028,
+1663,3357,12031,2172,8094,8870,3789,4685,8680,12032,7898,7865,
+3948,12033,3346,1594,6066,2133,12036,1251,12037,3337,12038,6067,
+1223,5302,12043,4269,5303,12044,4137,9052,3395,4227,1284,5990,
+2884,2256,3777,2901,2309,3015,1194,3193,3646,2237,3820,3409,
+3040,5992,3975,3467,12073,3697,2668,8272,5995,7783,2667,5996,
+12074,9204,8510,12078,6004,3710,12079,3318,4192,5548,4305,12091,
+3551,3088,5547,5549,5550,5555,1204,12104,5551,1749,5556,1435,
+5557,7958,5559,5564,4091,12114,5562,5561,2612,5563,12118,4355,
+12119,5558,12120,5566,961,5560,12125,2438,12126,5565,5569,5571,
+2676,12156,1578,12157,4317,9097,12165,7863,2349,12170,8628,5579,
+1292,9103,3080,1377,12187,4075,7962,5577,12198,5575,5574,12199,
+1065,9099,4441,5576,5584,5582,5591,5590,3123,5586,12237,5588,
+5592,12249,5589,5585,9105,5594,12268,8817,9102,12286,5595,5598,
+9104,12313,8243,12314,8764,8169,12328,3760,8277,12333,9106,6165,
+12340,1323,4572,4059,1239,1789,4688,3142,2317,1799,12345,3814,
+1205,5023,8996,2093,4184,3517,984,4855,2238,12355,12356,1083,
+3431,1155,12357,3484,1608,12358,3389,5534,4459,5537,5536,2946,
+3662,12366,2554,5535,4578,1142,4547,1468,8515,1403,4512,8489,
+12377,3868,1018,5538,12380,8823,7847,5541,1224,8837,12387,2786,
+9092,5542,1686,5543,2846,12401,9095,9094,5545,8848,12406,5546,
+1332,7748,7730,9093,1732,3036,2893,12419,1129,12420,3997,7955,
+6163,2008,4284,4265,8051,1852,5681,4620,12424,3177,1084,1333,
+5683,4029,2645,5682,12430,2415,4235,1464,5684,1483,12431,2802,
+1784,12432,1705,12433,2964,1644,5686,5685,1543,4694,8160,12441,
+3670,5690,12447,5688,3475,2370,4254,5687,2551,2483,5693,5692,
+2453,8327,7800,9134,7926,7985,5695,12481,5696,12482,8261,8568,
+5016,12489,4092,3667,5293,4699,2359,5021,4211,3097,2923,5294,
+12498,1088,5366,3412,12502,5369,12503,1798,12504,4228,12505,1696,
+1954,1469,4454,2779,3903,1974,12515,5999,5998,6000,12518,3733,
+12519,3280,12520,9205,12521,8821,1424,3132,12525,6002,9838,12534,
+7856,8323,12538,8584,12539,5986,12540,1858,1426,12541,2659,5988,
+5987,5989,9852,5614,3993,12548,3679,12549,4110,1169,1108,12552,
+1115,2990,4452,4245,12555,5600,5601,12559,4194,12560,1246,1076,
+3754,4504,5602,12564,2277,1408,12565,5603,1939,5604,1991,2672,
+5605,4023,8133,3694,5606,12571,1444,2952,5607,5608,12574,7841,
+12575,9107,4318,5609,7947,4054,5610,3761,5611,12590,1443,12591,
+7804,5612,2026,3983,5698,1089,4203,2108,3239,12603,5701,6668,
+6667,5367,5700,4541,3757,2731,4561,5705,5710,2425,12618,5711,
+5703,3982,12628,1965,5707,1659,1992,3583,3520,5702,5704,5718,
+4408,5717,2926,12636,4507,2947,1159,5713,12639,5716,2552,3505,
+1410,5723,2084,5715,3999,4348,5719,1839,5720,4665,6669,5722,
+12660,6673,5728,3432,2558,12668,2021,2403,12671,1946,6674,6671,
+2027,6675,4031,6672,1941,1590,5729,1521,3652,1792,12685,3855,
+3102,1584,12690,5727,5726,2872,5730,12691,4262,5735,3137,5737,
+1902,5736,12705,2031,12706,5731,5732,5738,12710,5734,12711,3841,
+4267,4358,12716,2909,6676,4039,5733,12719,2810,12720,5741,1048,
+12721,5746,9140,8318,12722,2101,5740,1440,3174,5744,2265,3744,
+5743,12746,5745,12747,3860,5742,12748,3768,2034,7907,1484,2324,
+1177,1266,12753,1058,5739,1176,1421,1848,1575,8341,9147,3928,
+5751,12754,2017,3234,3989,9145,5752,1299,6677,12765,4319,4297,
+6678,5753,4201,4291,7720,9149,1739,5747,5750,1660,12782,5748,
+2445,9139,4347,1355,12810,5755,8546,2010,12811,3376,7774,12819,
+7773,6679,12822,9143,2724,7983,9439,2032,2363,12827,9138,8526,
+8274,12830,3790,9148,12833,5756,8427,2371,7743,1112,4410,12853,
+8219,8380,9150,12854,5758,5759,1888,6680,12870,8329,5757,12871,
+9137,8724,5760,8158,3971,8739,974,6682,9142,6683,2476,12895,
+5761,9868,9438,2932,12910,9144,5762,8190,8017,8673,12922,9136,
+12923,8142,12924,8478,5088,8225,6684,9441,1765,12930,3835,6393,
+4018,3472,3249,3876,1262,3809,2229,12931,9379,5790,2055,6394,
+4446,12932,3068,6395,6396,12936,6398,6397,12937,6400,6399,12938,
+9380,2217,12941,6401,12942,2661,12943,8819,12944,8624,1348,1402,
+6644,6643,1628,3566,1099,12952,6645,12956,3437,5306,1164,4413,
+3050,978,1397,3246,3105,4531,12973,2452,5307,3297,4120,2917,
+1010,1243,3232,1586,12982,4467,1269,2095,2336,988,4189,3450,
+4610,12996,3687,1525,2374,4476,12997,1698,2968,5308,2406,2684,
+3133,13001,1977,1041,3004,3578,2827,13016,5309,4067,1294,13017,
+2807,1684,13020,4595,1412,1207,2839,2892,2456,5310,13021,1011,
+2949,2601,13022,1838,13023,2315,3721,985,13024,3712,5312,2303,
+4635,5311,4465,1000,2634,2147,13029,4250,2468,2914,1133,4404,
+2451,3418,5313,4509,13032,1801,13033,3208,3486,13034,5315,2378,
+3027,4612,3399,2854,13039,1275,1835,4535,6478,959,4542,2677,
+13057,3805,3573,3961,2870,1427,5314,4502,2090,2024,943,13060,
+2931,1391,5316,3671,3741,8657,3829,5318,13077,3682,2449,4634,
+13080,5317,977,1899,3340,2902,2327,2487,3557,13093,2148,2000,
+1432,2998,8476,5328,13097,9053,13098,5325,2316,5321,9858,1338,
+2222,5322,2896,3891,13110,1473,8461,8282,1565,3441,1493,5327,
+13113,4455,13114,5323,3616,3101,13115,2950,4155,13119,2337,2682,
+13127,3600,1245,13128,2212,13129,2405,3703,4099,1390,13130,5326,
+5319,5329,13131,6480,2647,5324,4543,1416,13136,1211,13137,5330,
+13138,5340,13139,8077,5335,13143,5339,4670,5337,2797,3636,13149,
+1196,5336,13159,5333,3812,13160,1322,2360,2285,2211,8024,5331,
+13171,4337,13172,5320,13173,5332,2474,13178,5334,1210,1764,2638,
+5343,5346,8539,13186,1138,1319,1389,3295,5344,3526,13194,1758,
+13195,5345,5348,3605,13203,1004,1393,5942,13210,8411,1202,13216,
+6481,13217,5342,3356,5341,997,4136,1120,13220,3586,9056,5338,
+13227,3481,9057,13234,5349,8256,1376,13242,2825,5351,13246,8846,
+9054,13252,5353,7786,2581,13259,5350,2334,13260,3025,8194,1258,
+3281,8339,13269,3503,5352,4623,9055,7852,1244,7764,2572,13282,
+7944,3144,1132,1388,13283,4616,13284,8384,9058,13285,2895,13286,
+13287,5357,8544,1898,13288,8605,8078,5358,8749,2505,13289,8263,
+3324,13290,8802,8039,7858,13293,1184,3171,13294,5359,13295,3161,
+13296,7849,5360,6482,13299,8140,3528,13303,8050,13304,5362,13305,
+5361,13306,1160,7762,8356,7964,8847,13314,8173,7725,8530,9062,
+13319,8442,13320,2955,9059,13324,8346,4383,13334,8182,13335,9060,
+13336,3228,7785,13337,9063,13338,8477,8793,8278,8547,5364,8105,
+2335,8188,13347,5365,4518,6409,6502,3436,13352,4786,1727,13353,
+1790,1634,4511,3954,7371,2809,13367,2295,6503,968,7726,13371,
+2205,13372,2555,13373,1087,1229,1741,3291,6504,2275,3476,13386,
+3136,13387,4508,7868,13388,1680,8514,8222,7747,4428,1116,6593,
+1002,13407,6595,13408,9428,13409,1526,13410,2584,13411,7510,3964,
+4486,13414,3810,2240,1287,13417,1702,13418,4439,13419,6697,8815,
+1550,13420,3502,3981,7895,13427,1626,6596,3392,2965,13433,6599,
+6598,2666,6597,4040,6600,13438,6601,4674,6603,3083,3821,13452,
+2107,3248,1418,2296,4539,4394,4055,4028,3400,2434,6418,13468,
+965,6416,6413,13474,1220,13475,2812,2045,4190,3843,6417,6421,
+13485,3986,4248,1341,13490,2758,4687,4466,13495,3422,13496,6423,
+6422,6425,6424,4582,13504,3905,6429,8493,2019,2251,3335,3314,
+3947,6428,4369,6431,6433,8859,13522,6427,13523,6432,3837,13526,
+2035,13527,1252,3060,2271,3849,3172,13536,2262,6434,4384,13545,
+6435,3883,8790,9384,2928,960,6437,7389,9383,13593,9862,9382,
+13594,8654,3462,13609,4350,13624,3191,4158,1783,6420,8508,1187,
+2723,13629,4411,3641,4683,4357,4277,6515,2996,13636,1691,3500,
+6542,13642,2485,3756,13646,1236,13647,3065,6572,9412,2849,13654,
+3779,2828,1063,4416,13655,3468,13656,4587,3058,1571,3306,13667,
+4374,3203,1734,13670,6228,3317,6225,13673,2521,3998,1163,1384,
+13674,6226,1540,13682,6227,3471,1751,3656,4119,6229,6232,1907,
+13690,1046,2221,7884,6415,6233,13691,6236,13692,6241,6242,13697,
+3518,1008,13698,2078,6231,13703,3752,13704,6240,4494,13713,2591,
+6234,13714,2747,13715,1876,4517,6238,3447,4393,13719,6230,13720,
+6235,6237,13721,3126,1664,13722,6239,13723,2410,6248,6253,13726,
+6251,2127,2114,6257,6260,13735,6256,1123,995,2838,1735,3073,
+3225,3260,6245,6250,6252,13749,1866,6254,4690,13750,2910,13751,
+6258,2383,6243,4600,13761,2625,1208,6261,13770,3416,6255,4421,
+13775,1107,4444,6244,6246,1519,6249,13776,6259,2467,13777,3470,
+13778,3485,3067,2528,6280,4585,4130,1922,1780,1772,4375,6277,
+13808,6276,6274,1865,3621,6268,3765,2431,13809,963,6279,6278,
+13810,4637,13811,6266,13812,3674,3292,13813,1997,2220,6272,6267,
+1430,6269,3138,6273,6275,2177,4619,13824,6286,6283,13833,3681,
+6284,2563,13843,6270,13844,2748,1019,1788,9322,8565,13863,9325,
+2771,3823,2513,3560,13873,3632,3968,3448,13876,6281,2143,13887,
+6287,2787,13894,3076,13895,1872,4661,9323,8799,2079,13902,2992,
+7886,3607,3302,13918,6294,2509,6292,1840,13925,6289,6295,13938,
+4529,4626,9331,6299,13939,2184,1325,13975,1342,7934,3955,6304,
+2510,13999,6302,6316,14004,9333,6306,14007,8714,6288,8047,14013,
+2361,6309,6318,6307,14019,1728,14020,6305,14021,4289,2481,6329,
+6319,1020,6320,4422,14045,9320,6322,14046,6323,8448,9334,14059,
+6326,6327,7975,6311,8407,6314,14068,1990,6328,6330,6338,8097,
+1186,14105,6332,14106,8874,8197,8506,4450,14128,2822,14129,8708,
+6348,14134,1944,6333,14139,4232,8387,8512,9335,6347,6340,3134,
+9332,6349,1261,14167,6343,8040,14171,3933,8581,6345,14208,6352,
+6351,6341,14220,8075,9348,6353,14226,6355,2767,9344,9326,14266,
+9339,9350,9329,9347,9328,14274,9321,14275,9343,9338,14317,3124,
+1361,1995,3979,6577,6578,14334,6579,3066,8419,2427,6581,3957,
+14343,3125,9419,14362,8019,4536,4510,1358,1156,3827,3078,8211,
+7987,1400,14376,3509,2130,4115,6361,14381,1404,6360,14382,4060,
+3449,1175,14383,6364,4530,14390,7772,14391,6368,9354,9353,9355,
+8067,6589,2938,1549,14407,4218,8463,8155,1487,14413,2030,6591,
+4202,8367,3826,14420,2843,14421,2756,1533,4719,1073,1080,1082,
+3007,14424,1081,14425,2736,6484,1912,6485,14445,6487,6486,14452,
+9408,6489,6491,6490,8813,9409,6492,14461,3430,4715,2806,14462,
+2730,3095,6493,2861,14463,1687,14467,6497,3167,8394,6499,14468,
+1883,4126,956,6498,6500,8423,9410,14469,1419,2671,3173,14470,
+6501,14471,3491,5791,3666,4524,3184,4852,2040,14483,1905,5794,
+5792,3328,14492,1904,4061,5793,3269,1800,2174,1277,3818,3584,
+14506,2086,14507,5802,14508,5803,3098,1655,3164,4177,3813,14516,
+5796,5804,14517,3371,1254,3074,5797,6687,5798,3308,14528,2983,
+1806,14532,2752,14533,5795,2942,2541,2688,1182,14534,5805,1979,
+2832,14535,5808,2313,5819,5813,1930,1645,4274,14542,4557,4468,
+1818,4437,4097,3972,3187,3205,1147,14550,2783,5820,5807,1605,
+5815,5812,2915,14561,5814,2974,1135,3099,14562,2883,4607,14565,
+2508,5817,5818,5821,3580,5811,14568,4259,14569,1068,6688,14570,
+5816,3973,3042,4406,5822,14571,14572,2225,4124,5825,14580,5831,
+3873,14588,5830,5836,2700,2243,14597,5824,1952,5832,1596,4573,
+5840,14604,5835,5823,14608,2051,3726,3103,2954,2624,14611,5826,
+14612,3120,2173,2190,5827,14613,4644,1193,14614,5833,2102,5837,
+14615,2048,5838,2921,5839,4484,2352,14620,5848,14621,5845,14622,
+5849,1917,2486,1692,5842,1882,2255,9180,2908,14647,9179,3944,
+3359,4260,14650,3902,5841,14653,3617,14659,2495,5843,2553,5844,
+3807,14660,2006,1460,14661,3278,2168,4456,3301,1693,5864,5866,
+4077,5857,1486,4650,5854,3946,5853,2597,3613,2874,14690,3623,
+5862,5861,5855,14694,5858,1422,4286,14697,5860,8286,4224,1382,
+14701,1993,3367,14704,1345,14705,8772,9186,2049,14706,4086,8404,
+3648,6689,4331,14719,5865,4658,5856,14720,2166,5859,4299,14723,
+5863,3377,3195,1544,14730,4415,1146,5877,8607,3793,14733,5867,
+7782,3787,14734,1750,5876,14737,2391,4275,14741,2801,2953,5878,
+3701,5869,14761,1973,14762,3923,9181,5872,5868,8555,3734,3393,
+2446,14797,2167,5873,5893,4343,8885,14810,5881,2616,7974,14814,
+5895,5885,14819,5886,3538,14826,5880,5871,14827,5891,14828,3255,
+5889,2890,5888,14831,5887,1313,5894,14835,7779,8328,14836,1474,
+4649,7869,14840,9025,5892,14841,1985,14842,4655,3618,6568,14843,
+5890,4556,5879,5882,2721,5884,14849,2674,2479,2679,14850,1118,
+3589,8484,14857,1455,8264,9184,5901,8311,14865,8762,3022,2519,
+4102,5900,2833,14888,8001,8220,5899,5908,5906,2725,8888,5883,
+14893,5902,14894,3477,8822,4453,5903,14897,8091,4131,8095,14903,
+9674,5904,14911,3770,2956,9175,3118,14922,2657,5896,14926,8453,
+14927,2579,3593,1238,9185,8172,14934,5913,14935,5905,9194,5912,
+14938,5915,14939,5914,9187,8462,1267,14945,8102,8196,1247,5909,
+5911,5910,2989,9189,4395,5918,14967,9442,7876,14974,975,2071,
+8886,5921,8361,5916,1117,5924,8054,5925,5922,5923,5926,8593,
+7760,8092,15023,9178,15024,8275,15025,9193,9188,8661,15033,9190,
+9183,15037,3064,9177,15043,5927,5929,15044,8212,15045,9196,9195,
+9176,9198,9870,15058,9197,9174,9192,5932,15081,8454,9199,5933,
+8585,8280,2053,6639,2805,15100,1447,2023,2610,4401,15105,2291,
+4643,15109,4377,1178,6604,2646,1337,1241,15123,3213,2376,6606,
+6605,6607,6611,2325,3602,2971,2283,15141,6612,15142,1127,6610,
+4425,1476,15146,6608,2559,1288,6609,3501,2478,3665,2587,15153,
+6614,1949,2494,15166,4593,2379,15174,1616,3342,6613,2039,15175,
+3615,2254,3235,15176,3862,3738,15183,2988,4082,1903,6616,15205,
+2005,6617,15206,6640,1059,1654,6618,4111,6619,8226,6625,15246,
+2018,15247,2136,6621,15260,3312,9018,15264,2751,15265,6641,4470,
+6622,7918,9429,15268,4594,6624,6620,6626,15276,6627,8744,15296,
+3254,9431,6628,3844,3459,6632,8444,15318,6629,15319,6630,9432,
+15329,3223,8473,15342,6634,4105,8743,6633,4402,7775,6635,8863,
+5014,8124,15370,9434,15371,8192,15396,6637,6638,15407,4611,15408,
+2945,6508,953,8592,2339,1715,4150,993,1498,8712,4713,15414,
+3489,7910,5789,3019,1009,2951,6505,6507,15432,9411,4073,15433,
+2916,15434,6468,15435,2837,15436,2840,2489,6469,2852,15440,3838,
+6466,6470,3627,3853,3865,2514,1534,6474,15461,6475,15462,6476,
+3209,5615,15486,1621,5616,5617,15490,4625,8879,5621,2430,5620,
+1459,5623,5622,15504,1971,15505,5624,1808,15510,2304,2911,15515,
+1940,2199,5625,5627,1535,3886,3391,5626,4505,4321,5628,5632,
+5629,5630,2517,8630,2482,7741,5631,15529,5633,5637,15543,5642,
+1221,5636,2770,1161,5641,5640,5638,5643,3988,4588,2733,5646,
+15554,3908,1958,15559,8757,6356,5647,5644,15560,9111,1984,4342,
+15563,9109,8767,8490,5649,15575,6357,7890,15595,9110,9112,5653,
+3572,15596,5654,8354,15597,8036,8235,15600,9108,8505,15601,8543,
+8641,9114,15602,5655,15603,9113,2673,15609,4310,15610,3750,3735,
+15634,2746,6170,1996,3907,15637,2602,6177,6188,1130,6178,15647,
+6174,6180,6179,3315,4485,15655,6173,1606,6175,6187,15667,4584,
+6181,15672,6186,15673,6185,8640,15692,3183,15696,2480,2520,2617,
+6184,6190,3563,6200,6199,6194,6193,15720,6195,15721,6191,15722,
+6198,15723,6197,15724,6196,2590,3158,3006,2948,9312,15734,6201,
+6204,15753,6203,15754,6205,1966,6192,6202,15755,3275,3299,8741,
+8298,4135,6206,6208,15779,15780,2544,6213,15784,9313,15785,6214,
+6210,15788,6218,6209,15800,6215,9314,6219,6220,15842,9315,9316,
+15848,1832,15849,6962,15850,6963,15851,3023,1013,3226,15852,3728,
+3804,6403,6404,15864,3038,1356,9381,5253,15883,6406,15884,6407,
+15885,6408,1733,5368,3374,15890,3651,7792,15896,3380,4264,3483,
+15899,1697,6964,1067,15900,5940,3650,4270,2122,3363,15901,1480,
+15902,2867,1482,15903,6776,1986,6166,15906,6777,6779,2232,15915,
+6778,3782,2621,5022,6781,4030,8335,2683,3079,1609,8014,6782,
+15939,1296,15940,7857,15941,2064,6783,2175,7819,3455,15958,4176,
+7008,15959,7009,15960,7010,2575,15961,1768,2301,7012,15964,2930,
+7011,4122,15965,7014,983,2235,4198,7013,15971,1330,1669,7020,
+7019,3010,7017,4495,3630,2305,2085,7022,7021,7018,1128,15979,
+4513,4253,2278,3207,4128,15986,4555,1938,7023,15987,1530,8134,
+15988,3685,2538,7025,7028,15994,7027,7030,7026,15995,2003,7029,
+3592,7032,7034,7036,1380,9646,7031,16010,7037,7040,7937,7038,
+8704,7043,16021,7039,7042,7044,16022,7045,9650,3792,7048,7831,
+7047,16025,2623,7041,3444,8363,16026,1396,1114,3588,16027,7050,
+7056,4463,7053,9651,7046,16036,7055,7052,7049,16037,8232,7054,
+16040,9649,948,7057,7059,16049,7061,16050,9644,7060,16054,7058,
+7758,8706,4043,9643,8838,16057,9645,16058,9654,16059,7062,8675,
+7063,8751,8549,9655,1448,7913,994,996,4400,16070,1445,16071,
+2213,2015,6957,947,16078,6959,6960,7717,4580,7112,16103,7113,
+9664,16107,8858,4560,2985,16116,4244,16117,4205,6795,966,4438,
+4087,2131,1927,16120,2437,16121,1730,1442,2957,8814,2768,16126,
+8125,16127,8068,8370,6796,16128,8259,2850,1505,16135,6744,2729,
+16136,4528,3917,6747,2959,16142,1563,16143,16144,3384,2753,16149,
+2369,16150,6746,6752,6750,4487,2788,16166,6751,6754,16170,4420,
+4044,6753,16174,2773,6755,2433,2331,6756,16180,3658,16181,4100,
+4642,4503,16185,6760,6761,2261,3492,6763,1532,16208,6764,2851,
+16209,6762,2223,1166,6767,4720,6765,6768,2798,1303,6769,6766,
+3878,6770,2718,16248,5269,3026,16251,3139,16252,4596,1450,16253,
+3495,9863,3676,16258,6774,4433,9456,6775,16264,7550,8864,2737,
+7114,3407,4186,16293,4521,16294,6938,16295,2311,16296,2196,6939,
+1547,950,8107,6690,16302,6691,3848,1612,2432,6692,2706,3305,
+3093,2368,6696,3001,16318,4089,16319,4614,16320,4107,16321,16322,
+6704,6708,16326,6706,6714,4489,16327,6709,6707,6698,3362,4373,
+6705,16337,2532,16338,1316,9896,16341,1857,16342,6716,6717,16347,
+6710,16348,6715,16349,3847,9445,16366,6718,2619,4247,6711,3218,
+8698,6722,16388,1488,2652,952,3550,1047,16393,6720,3740,1475,
+16397,6721,6719,6723,1499,16400,6724,16401,6725,16402,6728,16403,
+1077,16404,8520,2999,2145,6726,3599,1201,9446,6727,8439,16413,
+8299,16414,2894,6731,2501,1387,6729,2385,6730,8871,9451,2824,
+6733,16451,6735,6737,16490,8166,9447,8210,7916,3413,6648,2524,
+16505,3360,16506,6649,3085,6650,16511,3084,6651,4675,6657,4608,
+3370,3555,6658,16525,6656,3926,16528,6660,3024,2099,16533,6659,
+1436,2059,16541,6661,4875,2252,2658,6662,8038,9436,1694,9890,
+6665,8206,16581,9435,7864,16582,6666,4306,4708,2518,16588,3162,
+1923,16589,4014,3506,16590,3691,1125,16595,3180,16596,4565,2387,
+2800,6943,1272,16613,3157,4118,16614,4551,16615,6944,16616,6942,
+16617,2066,1259,4173,16627,2037,3854,16630,6948,6947,1265,16637,
+3341,3493,6949,16650,1298,7808,16665,3799,6952,16669,6951,16670,
+1439,2125,2065,16671,1760,9847,9764,8041,8747,9599,8027,8603,
+16704,9853,4049,16712,2286,3179,1324,7068,3692,16717,3153,4430,
+16718,7069,16719,7070,4139,4558,7071,2210,1331,2284,1375,3808,
+16732,2412,7073,2439,7072,16737,7075,8608,8582,16738,7074,7076,
+8429,7844,8417,16756,9656,8800,16757,8418,2539,2281,2280,4451,
+2351,16776,3680,7065,2224,16782,1546,4592,7267,7268,16793,1736,
+16797,981,16798,7269,16799,7273,3558,7275,16803,3953,1075,7272,
+7279,16809,1458,7287,16812,7282,7284,7283,1688,16816,1064,16817,
+7278,7274,1467,16818,7280,7281,16821,7285,7277,16826,2134,16827,
+2630,16828,7286,7290,7745,7276,16835,1449,16836,2239,7292,1601,
+2429,4605,3683,16839,1395,16840,1190,16841,7288,16842,7289,3313,
+16843,7293,7294,16846,7297,7299,7298,7291,16861,2423,16862,1300,
+16863,7296,3110,16866,2149,8070,16876,1816,1140,2067,16882,3544,
+7309,7305,1845,7310,7306,2696,7308,7311,7304,2160,8115,7314,
+7919,16910,4618,3017,16911,8868,16912,9704,7315,7313,16917,2639,
+1752,7317,8465,7320,2516,16937,9702,7323,16945,7322,16946,9703,
+7326,7321,8257,16956,7324,9706,7327,16970,8079,16971,9708,7329,
+2014,7328,9707,8400,8221,1157,7332,7331,16992,8183,7821,2081,
+9710,8250,9701,9709,17024,8201,17025,8293,9891,2780,4853,2507,
+7370,4654,7372,2540,3048,17055,1369,4436,7374,7373,7375,3535,
+7376,17061,4356,4575,2564,7377,2267,7385,17083,7381,7384,17084,
+1972,17085,1757,3610,7386,17093,1185,2776,9717,7932,4390,2372,
+8228,7387,2933,9883,17108,9715,17109,8921,17110,9716,17111,7399,
+9243,17112,3874,8136,17115,8059,17116,9245,17117,8780,8008,9244,
+8447,3800,8602,17118,8337,9251,7835,9250,17123,8464,17124,8845,
+8049,7928,9249,3533,7923,3564,2502,8625,9254,9253,8480,8474,
+9252,17143,9256,9258,9257,17146,8852,17147,8894,17148,7729,9260,
+17156,8117,9259,8111,8296,8676,7969,17174,8449,8572,8522,9261,
+8148,7400,17184,8145,7731,17192,9263,9262,17195,9264,8667,8889,
+17212,9270,7822,9273,8645,9271,8594,7402,17222,9274,7961,8588,
+7744,8883,8287,9272,9266,8820,17226,7836,9265,8325,8119,9267,
+8276,8670,17240,9268,9277,8073,9276,8046,7896,17246,7871,9285,
+17247,8777,9281,17250,7751,8022,8598,17255,9283,9279,17256,8227,
+17257,9282,9278,17260,9894,9038,9286,9291,9284,9255,9292,7951,
+17286,9287,9289,9288,7939,17296,9290,8540,8891,9296,17299,9876,
+9295,9718,8273,17300,9294,17301,7675,17302,8890,8045,9298,9297,
+7403,9301,17318,8841,8470,8486,8033,9885,17335,8074,9302,9305,
+9304,8058,9293,9303,9299,17353,9248,17354,8671,9861,17355,7790,
+8740,9840,17359,8634,17360,9306,7404,8191,6099,2287,6100,1955,
+6101,3896,6102,4351,2089,2112,3245,3778,6105,17365,1346,6106,
+3309,1748,2860,17366,4666,2689,1652,4540,3797,1633,2919,6107,
+3916,2560,4678,3369,3877,4526,4564,6111,1016,3349,4214,2268,
+6114,1022,3257,2226,6115,3233,17369,6116,2043,1779,4045,6117,
+2702,2343,2203,3684,2333,4016,17370,3548,3619,2111,6120,2075,
+4034,6121,17371,4035,3383,3771,2789,6127,1066,1302,17372,4664,
+4449,6130,2675,4631,2141,2794,2477,2076,17373,6126,1551,6138,
+17374,1999,1471,2669,1097,6141,4344,6142,1722,6144,6143,1673,
+17375,6145,1215,4236,3562,2202,6162,7262,17376,1746,17377,3212,
+7263,17385,9698,17392,9882,17393,1847,3753,4766,1896,17396,2693,
+6785,17397,1600,6787,17402,6786,992,6789,4471,4684,4546,17411,
+7914,6791,3463,17412,6790,7724,17415,6792,8290,9457,17425,9458,
+17426,4123,17427,3129,17428,2757,7364,4010,7365,17441,3912,3221,
+9714,17444,7366,17445,8725,17451,7369,4878,1785,5997,4309,17459,
+7390,17460,3803,7064,17468,4213,17469,7391,8622,17473,3925,7392,
+1461,1383,7394,7393,7395,7397,17491,1897,970,17492,7398,8416,
+17498,1610,4212,4146,2490,17502,2377,6483,4480,6426,7127,1591,
+3480,2864,17509,7115,17510,7116,1782,7117,1915,4360,989,7119,
+17516,7120,7125,7124,2966,17519,9666,17520,9665,7126,17523,1593,
+17524,7128,4149,5297,3519,1281,17527,1411,17528,1787,2903,7129,
+2573,2628,4527,7131,7132,17540,2547,17541,8488,17542,3031,17543,
+2314,7133,1362,8215,7840,7134,8485,8525,17561,9668,8349,8842,
+17562,9667,8569,8248,6686,6685,3541,4197,8533,3510,4473,17568,
+3261,17569,2506,2068,3951,17578,4577,17579,1542,1747,6512,1737,
+17580,6511,1227,1826,4522,17581,1681,1639,2138,1627,6518,17585,
+6519,964,2396,17586,6517,4322,17587,6520,1643,17592,6514,6516,
+3375,4566,4462,3965,6527,3783,6528,17593,1417,1052,6530,3576,
+2967,6531,17606,6529,2976,6526,3387,6533,1030,4717,7111,17611,
+6534,6042,6537,17612,2421,4175,6535,6540,1767,6536,17613,2187,
+17614,4003,17615,962,17616,6541,2879,8658,1379,2717,2092,4387,
+3081,2871,6543,2920,4873,17627,1144,17628,6548,17629,2198,9415,
+1703,17647,3714,6549,6545,17651,2556,8825,3654,17663,6550,17664,
+2459,4159,6551,17665,8483,17666,1706,1704,17667,6552,3128,3748,
+9413,6557,9417,3987,8340,6562,17678,6558,17679,8854,17680,6561,
+3284,17681,4133,6556,7799,1716,3910,2888,3629,3705,1021,17687,
+6566,6565,17693,1145,1755,17698,6567,1109,17705,7942,3608,2823,
+3858,6576,17712,2995,8345,6570,5697,6574,17727,7853,9416,8360,
+3711,6575,1092,4252,8223,6573,17732,6571,8389,17733,9418,8176,
+17742,9414,8797,8926,6402,8236,17752,4657,17753,7337,1305,8545,
+4490,2297,17764,7333,17765,4143,17766,7336,2298,4292,8763,8665,
+8139,8137,17767,7266,17770,3453,17771,3653,5656,3497,17778,3831,
+4570,17779,7344,17784,1908,7345,1006,7342,17785,7343,2163,1180,
+17786,1573,1143,3900,7346,1327,17787,7347,3672,17797,7352,17798,
+7353,3527,7777,7355,9711,17818,8088,17819,7357,7388,2565,2139,
+8072,3300,4103,6001,8696,17826,5089,4188,5090,951,5091,2219,
+17831,5095,4728,17835,5093,4312,17836,3343,5096,5092,17837,5097,
+2727,5098,5107,5099,3822,4516,17844,5117,17845,5115,5120,2231,
+2642,17848,5094,5113,5116,5100,1647,976,5109,3977,5103,1981,
+17849,1625,5114,5108,5101,3160,17852,8994,17853,4072,5102,3772,
+5104,17860,5105,1179,5119,3530,17861,4346,5129,5133,3577,5140,
+17862,2796,5130,2382,5127,17865,1029,1807,5139,5121,17866,5106,
+5124,3279,2413,9014,1062,17873,4231,5123,17878,3034,17879,5132,
+4639,2740,1619,3150,2734,5136,5126,5145,5122,5131,17887,2260,
+5125,17888,5134,17891,5158,5135,5166,5141,2142,1351,2728,1198,
+5160,17906,5152,17907,5149,17908,5162,5148,4215,1199,17909,3250,
+3262,5161,17910,5147,2258,5154,17918,1188,5153,2153,5142,2009,
+17924,2526,17930,5151,5156,5159,1429,17931,3252,2044,5164,5163,
+4240,5165,5167,5169,4216,5168,1920,5173,5186,5181,5184,5180,
+3053,2525,8875,5146,5178,8127,17958,5187,5150,5179,17961,5188,
+17962,5176,17963,8061,9011,5189,5183,5177,2829,5172,2462,2548,
+17972,5182,2054,5185,4237,5190,17973,5191,2732,5214,5192,5213,
+17979,1814,2308,17982,2345,5206,17989,5201,17990,5195,1170,5199,
+17994,5207,1131,5217,3055,5212,8013,5216,2603,1635,5193,18016,
+5209,3620,18017,5205,9012,8177,5198,2765,3035,3773,5208,18020,
+5204,5202,2691,5215,3937,3283,5228,2699,5219,9030,4599,18072,
+5221,5220,1771,5218,3054,18077,1516,9031,18078,8595,5230,18081,
+1968,4388,5235,18082,9889,18083,1363,18084,5222,18085,2440,5231,
+8034,5227,18086,5225,5226,18098,2176,5232,18099,5233,9037,9032,
+5249,18106,2766,3056,18128,5248,4501,5247,5244,18132,7776,5240,
+18133,5243,9029,5236,3251,5242,7954,18140,5237,5238,3559,18143,
+5241,2465,18152,2094,5245,5251,18155,5250,5239,2991,18161,8216,
+9013,5255,5262,9020,18173,5261,2804,18190,2722,9839,9041,5257,
+18198,1171,18199,8096,2891,3446,8731,3131,5254,5256,5258,5260,
+949,1079,9026,18218,5270,9039,18221,5264,2183,3274,9028,9009,
+18228,9035,5259,18229,9019,5263,9040,18237,5266,5265,7860,8614,
+5271,18247,4367,9045,18250,5277,5268,5272,1034,5280,18258,5275,
+9022,18259,8052,18260,9008,5276,18263,9856,4047,5279,5273,18278,
+8081,18279,5274,8455,3976,5278,3460,5283,5282,18289,5281,9023,
+8180,9027,1183,2799,5284,18308,2939,5286,8722,3628,8711,1607,
+9049,8788,18333,9010,7718,9047,4392,9048,5289,8258,8531,5288,
+18368,5290,4443,18382,9043,18383,5292,7152,1975,2649,2929,2670,
+7153,7829,4020,18405,8265,18406,4290,8002,1291,7154,18416,7155,
+1950,7157,7159,7158,3545,3879,7156,3403,4182,2707,3794,7162,
+1025,7161,7168,18438,1174,4074,7164,7166,4396,7165,7160,7169,
+7167,18452,7163,7177,7174,7176,7180,7172,7170,7171,18468,3190,
+3352,18469,7178,1823,1425,7173,7179,7186,7192,7191,3725,18477,
+4586,7188,7190,7184,2720,18491,4478,7185,7189,7195,4257,9690,
+1577,18498,3464,18499,1665,7193,9687,7194,7196,7199,7197,4090,
+7187,18508,3706,18509,3806,4520,18510,7205,18511,2784,18512,7202,
+2458,7214,7200,18515,7203,7206,7212,4241,7207,1212,7220,18543,
+3958,7223,18548,8494,18549,2013,18550,7227,7224,7226,7228,8626,
+7221,18566,7219,1970,18570,1500,18571,8606,7217,7225,7213,7238,
+9692,7235,7222,18581,3253,8300,2813,7239,7241,7236,18605,7230,
+7243,18609,7242,2692,9696,18614,7246,8827,18620,7233,18621,9694,
+18622,7249,7244,7247,7232,7245,9685,18640,7240,7251,18645,7787,
+18646,7253,9691,3970,18654,8721,7256,18657,4877,18661,8745,9686,
+9693,9695,18670,7255,18671,3263,7254,8175,18679,7259,1347,9688,
+7977,6797,7260,18698,8310,7261,7338,3985,8855,9872,18708,3995,
+4101,8511,3899,2215,18716,4076,18717,8600,18718,7816,1945,5613,
+4169,7078,1152,1110,7079,18724,3321,1257,18725,4870,18726,3482,
+18727,7080,4563,18732,8844,7081,7358,7082,18736,4335,7083,18737,
+971,7359,1407,18742,2972,7084,18760,4871,1060,18767,3867,1162,
+2586,4621,7085,7088,9713,7090,8204,4874,18793,4200,4326,7361,
+3220,7768,8876,18798,7362,7089,7091,2416,7092,7098,7093,18810,
+3338,2978,2698,1877,7095,9895,7097,18816,1933,18830,1032,7101,
+7100,7094,7102,3707,7105,5945,18852,8161,9659,7104,18853,7106,
+18854,9662,9660,7363,2244,9658,9663,18889,7108,8583,18893,9835,
+3846,18909,4145,18910,7135,8502,18925,9400,8420,18941,9401,8189,
+18954,9403,7981,2158,1844,18955,1855,2782,3434,6458,2475,2340,
+7513,18963,7514,18964,7512,2227,18969,7515,1320,6592,9737,18980,
+9738,18981,7828,4093,8927,7883,7949,4862,8055,18992,8683,18993,
+8929,18994,8559,18995,8928,8682,18998,8930,8395,18999,8056,7906,
+19002,8690,19003,8528,8147,19007,8933,8532,19019,8935,8936,19032,
+6788,8932,19038,8810,19039,8939,19040,8937,8381,8950,8679,8726,
+8492,19053,7784,8946,7991,8947,19054,8943,8016,7952,8648,19055,
+8945,8941,8862,8940,8162,19067,4323,3631,3419,19073,7855,8758,
+19076,8951,8765,19080,7810,8118,19081,8612,8618,8952,8529,19082,
+8032,8517,19089,8156,8960,19101,8884,8553,19104,8957,19105,8426,
+19106,8948,19107,8955,19108,8956,8231,8288,8959,8958,7879,19115,
+8972,8949,19119,8966,19120,8970,8659,8963,19124,8967,8971,8031,
+19127,8969,8962,7940,8861,19130,8699,19131,8968,19132,8364,19133,
+8334,8965,8599,19134,8561,8856,19135,5948,8322,19141,8977,8964,
+19145,8975,7733,19146,8401,8976,8099,19147,8662,7519,19155,8973,
+8978,8333,8979,8982,8043,8980,19192,8496,8981,8552,19193,8388,
+8984,3016,8729,8727,7789,8440,19236,8187,8985,8974,19242,8983,
+19243,4887,2105,1512,1719,3242,2072,3625,3230,4890,3100,19244,
+4062,4208,4063,2106,19245,2179,2041,4081,4893,4024,1582,2690,
+19246,3524,1674,3361,1632,2342,4515,3039,4676,3405,19247,4426,
+3540,4496,4896,4574,1357,4898,4897,19248,4210,3435,4902,3394,
+1268,4590,4905,1989,1423,1863,4056,4207,4908,1726,3927,1206,
+19249,2236,3819,4308,4911,3842,4912,4282,2042,4913,3498,3525,
+4914,3176,4589,4915,2934,1536,4916,1641,2395,4917,4918,3490,
+4919,1496,4920,2571,4632,4921,3595,19250,4209,2836,4922,1502,
+2022,4923,3966,1214,4931,4929,4113,4930,2778,4932,19251,3974,
+4140,1028,4936,3112,4937,2248,2726,2818,3594,2473,3062,1528,
+7414,8392,7415,3936,2004,1911,4328,7504,1043,1209,1928,7506,
+19314,2743,7739,8831,19329,7948,7769,7972,8378,8037,7920,8548,
+7984,8801,8866,9387,19336,9391,7912,7993,19337,7752,8304,7848,
+19338,9388,7927,8566,9389,19339,8315,8005,9386,8267,8239,8026,
+9392,19340,8887,8063,19341,8805,9394,8475,7761,19348,9396,9395,
+19353,7839,19354,8472,19355,8372,9135,8635,8306,8085,19356,7946,
+9398,8849,9397,8824,7892,8873,9399,7976,8457,8903,19370,9390,
+8881,8806,19377,8795,8900,19378,8469,19379,8746,9393,7957,8796,
+1053,4491,1717,19389,1802,1165,4403,3898,999,4460,2058,4553,
+1620,3587,3029,1098,1811,4603,1850,1598,2157,3660,1868,6446,
+1406,2744,1646,1935,6447,4407,6448,2121,2036,6449,2599,2655,
+4386,4647,3351,1710,1539,6455,3457,3334,1360,5691,2979,6456,
+2464,19392,4629,6457,4617,3287,4745,4739,4385,19393,4412,3325,
+4243,1742,1285,19394,3355,7412,1932,19398,7413,7407,1707,4469,
+1738,3087,7408,1233,4352,3188,7409,7956,7411,9720,4672,2944,
+7452,7447,19450,7455,19451,7454,19452,4537,7453,4353,7456,19456,
+7464,986,1497,19461,19462,2973,7459,7463,19469,2319,7460,1781,
+7468,7471,2420,19476,1867,7448,7465,3659,19482,2156,19483,7469,
+1572,7470,19484,7473,7472,4256,19495,1297,3575,8084,7475,2320,
+7476,3634,7479,1167,4662,19516,7477,19517,7478,7480,19518,7486,
+8752,7484,7483,7481,19528,3638,5947,1433,7487,7492,3574,9725,
+1446,1195,19555,7496,7493,19556,1558,19557,7497,19558,7494,9727,
+19562,7495,1373,19565,4397,7498,19569,1310,19570,9724,7820,9730,
+19571,8781,19572,7499,7501,9732,9726,9731,7500,9729,19578,7502,
+19579,7503,7843,9736,9735,3366,1795,7803,8807,7990,8150,6392,
+8672,19616,9356,8857,9361,9366,9359,9362,19647,9367,19648,8113,
+19652,9370,19653,9369,19654,8792,9368,9371,19662,7945,8422,8230,
+9375,8025,7995,9372,7738,8283,8816,8759,9426,19692,8627,8773,
+9377,8828,8112,8006,19713,9088,9365,19714,9360,19715,1242,4417,
+1861,4036,19716,6369,4615,6370,2685,3272,1947,6377,6376,3166,
+6380,4379,6381,2207,19717,2208,6384,1699,2567,6385,1051,2025,
+1870,6386,19718,1685,2080,19719,3451,5492,4338,3882,4440,6390,
+4479,6391,3980,1813,19720,1354,1090,7728,19726,19727,1105,19728,
+7837,7755,7754,1250,3267,8362,2578,1394,3109,4285,19739,3096,
+4065,19740,1878,2716,4242,19746,4366,2253,19747,5950,1618,5951,
+1998,4483,19750,2249,4345,3764,2549,1278,3657,19753,5954,5952,
+5956,19754,5958,5955,1456,3047,19755,1501,5953,19756,3469,5957,
+9851,2777,1070,2070,3708,3522,3425,3622,5960,5959,2889,4042,
+4064,5961,19768,5964,19769,3689,4591,5963,1470,19770,3695,9202,
+5965,1529,19771,8830,3673,1853,19772,3420,1270,3534,4399,5966,
+1671,8217,5969,1409,5970,19785,4196,2694,1071,19788,4295,1564,
+3553,19791,5971,8787,19797,1106,7998,1587,5974,1441,7846,8590,
+19798,4172,5976,5978,8684,19801,7870,19802,8778,19803,5977,3119,
+19804,4138,5975,8499,4389,4475,7812,19813,5980,4686,19814,8399,
+8674,19815,8719,19816,8233,5981,19817,1093,4132,8307,5982,5984,
+8021,9201,5983,19820,7750,5985,8291,9203,4191,19824,1452,19825,
+6167,19826,4967,19827,4970,19828,4968,19829,4969,4972,3994,2858,
+3963,19838,4971,19839,4271,1889,4978,3182,19840,4974,4973,3348,
+4975,19841,4977,4667,4976,2595,4983,4980,19848,4984,2484,4979,
+4982,4514,19854,4985,4990,4988,1913,19861,8990,19862,2353,4987,
+4986,4362,1158,4991,19868,1874,19869,4992,1248,8755,1531,4993,
+19880,1588,19883,4994,19884,8992,8892,19895,8988,19896,8785,4995,
+4997,8839,19914,4999,8237,4998,7851,19915,8989,19916,8991,5000,
+8987,5002,19929,8993,4276,7416,3186,4640,2981,7417,19930,2293,
+4368,3581,7422,7421,1887,7420,3531,7424,2493,19944,1295,19945,
+3675,7425,7423,2181,7428,19946,7429,2206,2749,2414,3542,7430,
+7432,19955,1343,19956,4682,19957,1370,7431,7434,7433,7435,3996,
+2774,3204,7823,7438,8716,8100,7443,7442,8347,8664,19990,9722,
+19991,9721,19992,1168,19993,4281,3428,8500,2522,4567,4151,2568,
+19994,2241,9464,19995,9463,7880,9462,1701,8832,7877,9467,9466,
+20005,7917,9469,20017,9465,20018,9470,8397,9480,9476,9471,8336,
+7901,7973,20032,9475,9474,7802,8358,7953,20047,9479,9472,9477,
+9497,20054,9493,9484,8241,9483,9487,9498,9481,9486,8756,9491,
+8064,9495,9494,9485,20076,8403,8314,8398,8106,20101,9502,7967,
+9517,8733,9522,20107,8571,8623,20118,9516,9512,20121,8332,20122,
+9519,20123,8636,9525,20129,8717,9510,20130,9524,9514,9503,9521,
+9500,20131,7553,8653,20139,8666,20140,8562,9534,8271,20145,9539,
+20146,8663,20147,7740,7554,9535,20165,9540,9507,7824,9530,9541,
+20169,9533,20170,8385,8451,9504,9532,9531,9528,9536,20177,8141,
+8880,20196,9542,7834,9554,9520,9545,9553,7882,20204,8402,8120,
+20208,8313,9549,7845,8268,8320,9837,20217,9527,7555,20223,9546,
+8632,20224,9550,9468,9556,7996,20230,7893,9559,9555,9544,7556,
+20253,8412,8087,9557,8316,20270,9562,8542,20285,9568,8610,9044,
+9571,9511,20297,9518,9560,20298,7963,20299,8835,20300,9572,8352,
+20303,9573,9581,8224,20318,7557,20319,9567,9578,7681,9529,9564,
+9579,7791,20330,8132,9575,20331,9563,9515,20347,9585,20348,9591,
+8234,20369,9526,9587,9583,8851,9592,9594,8198,20391,8567,9499,
+20394,9508,7559,9595,9593,20407,9574,8083,20413,9596,9597,20427,
+9586,7560,20433,9588,8782,20436,8646,8351,20441,9590,8292,8895,
+9756,8798,4492,1507,6802,6801,20449,1613,1495,6807,6809,20450,
+6808,20451,1729,1562,1235,4562,2857,1054,1745,4354,3154,2346,
+3816,1804,6816,6815,6818,6817,2918,3115,6821,3116,6822,1134,
+2123,6830,4272,3661,1139,2606,6831,3107,2738,20452,6846,6845,
+20456,6847,3678,2664,4418,6851,3872,6857,6856,6858,1776,2815,
+2195,4166,1216,4223,6864,4604,6865,3051,20458,2557,6868,3943,
+3565,6870,6869,1311,1873,1667,3978,3276,3635,4481,6883,1392,
+2735,6884,20459,20460,3852,6888,2695,1339,4627,2246,20461,3892,
+6891,6892,1510,2159,2321,2769,20462,6895,6903,3135,6937,1548,
+6899,20463,1541,2755,6902,20464,4499,20465,6907,2906,20466,6908,
+2907,1759,1026,20468,6918,2276,6921,2499,20470,6933,2550,3919,
+7797,1225,8317,20480,9151,8467,7749,20485,8152,9156,20486,9154,
+8452,20487,8637,20488,8071,9155,8003,20500,7966,9849,7915,7989,
+8330,20503,9159,9161,9158,8691,20513,8695,9167,9166,9162,9165,
+9836,20519,9153,20520,8174,9169,8184,9170,9172,7832,7980,20532,
+9173,7793,9873,2762,5765,3322,5766,20539,1086,3801,1334,3277,
+5767,3901,5768,2135,2763,4419,2873,1860,3796,5771,2811,5772,
+20540,1604,1774,1929,4359,5775,20541,5776,4084,4095,5781,1218,
+2470,5782,20542,2454,20544,1714,4948,20545,1554,20546,4950,4949,
+4951,1629,4125,4220,4500,2216,4677,4954,4953,20563,941,3716,
+20564,4955,20565,1720,2109,2660,2635,1255,4956,20566,2641,2835,
+2182,4957,3323,1094,20576,8468,20577,4958,20578,1527,4349,8836,
+1314,4959,4364,3906,2980,20581,4960,8732,20585,4961,7806,4962,
+2611,3624,3914,8269,4300,2632,20597,4963,20598,7897,3546,20599,
+4964,8114,3547,4229,1775,8786,20603,4965,954,3875,20604,8057,
+4464,3554,8535,20615,8639,4966,8735,20621,5764,8253,20622,2542,
+20623,8213,7545,20624,9893,2868,20625,3219,4108,4006,4078,2082,
+1830,20628,6940,1353,4255,7548,1312,1490,8534,8516,20637,7825,
+8791,7551,20641,8202,8338,4303,7521,4050,8784,7522,2604,2498,
+20654,1035,20655,7875,3836,20658,4019,7525,3939,20661,7524,4497,
+7526,2750,2057,7528,7527,3487,20675,3881,7531,20690,2653,991,
+3002,9741,7532,9740,20702,9742,3165,7520,2273,9739,1478,1636,
+20721,2380,2775,2795,8899,1770,2250,4046,20735,987,3959,20754,
+955,20755,7971,20756,20757,7628,7630,20776,1095,20777,7629,7632,
+20780,7633,9823,20798,8589,8445,9319,20812,9318,3763,3240,20820,
+1890,4219,20826,4370,3345,8649,20835,8713,7881,8425,20836,8650,
+8518,9669,8668,20837,9310,20838,8527,20839,8769,8586,7727,7900,
+8383,8244,8718,20852,9675,9676,8131,8377,20869,8577,8563,7905,
+9677,9678,8694,8779,9681,20890,7872,9682,20898,7978,7794,9683,
+8638,9684,8260,20904,9679,8435,4154,1508,3175,7136,3931,3496,
+4022,6183,3736,1828,1560,7137,1007,3521,7138,4327,2644,2613,
+3043,2272,7139,2120,20905,20906,7142,4170,3028,20907,3704,7143,
+20908,4246,2386,3637,20909,4094,1581,20910,1219,3202,7936,20916,
+9880,20917,9848,8376,20932,9424,20933,9425,20941,6586,1638,3402,
+9115,20946,9854,5658,7655,9117,20951,9121,20952,7921,8734,20955,
+9122,8523,7734,8501,20963,8109,20967,7763,9123,8707,20971,7911,
+7656,1172,9124,8343,7908,9118,21006,8245,9127,9128,21010,8309,
+8171,9132,8042,8441,21017,7659,7658,21018,9830,9831,21023,7788,
+9133,5661,21027,2069,21028,1622,4226,2165,3429,1038,3516,21029,
+5668,1595,3231,5669,2201,21032,1126,5670,21033,1589,5671,2876,
+5672,3911,1846,5673,2444,21036,5674,1213,21037,5675,21038,2620,
+3438,4718,4857,3920,8301,8770,7938,8579,21057,7813,8681,8869,
+9223,8138,21084,9218,8066,9224,9220,21087,8497,21088,8580,21089,
+9219,21090,8302,9227,8151,21117,7811,9230,8391,9229,9200,21153,
+9233,9236,21154,8560,9221,8460,9237,8294,21165,9042,9235,9232,
+9225,21172,9240,8103,21178,8700,8129,9222,8270,21186,9242,9241,
+9228,21191,2708,4329,3717,4058,1280,3194,21192,1148,2662,6074,
+3410,2307,6077,4609,3718,6079,2128,6078,2709,21193,2191,6082,
+2701,1886,6083,21194,6084,1271,4114,2354,6085,3086,6088,3020,
+6089,21199,3296,4583,6097,21200,6098,1824,7721,7635,7634,7638,
+7636,1880,21211,7639,21212,7640,7642,7641,7644,9825,21225,7647,
+9892,3549,8564,9827,9826,21226,1754,7660,21233,7661,7664,21242,
+7666,9845,7663,7667,21252,7665,8524,21262,7668,9850,21267,7669,
+9832,7672,21283,7888,21284,8342,21285,9164,9160,5019,21290,8766,
+4704,6003,1862,2442,2047,7649,3046,7648,21303,7650,7652,7651,
+7653,9829,3785,21307,7654,9828,21313,8761,9760,21349,9761,9762,
+21360,9767,7737,9765,9774,9771,9770,9773,21381,9768,8633,9782,
+9776,9784,21404,8205,9783,9797,21414,9786,9795,21419,9792,9789,
+9793,21423,9790,9791,8128,21426,9785,21442,9804,9799,9803,9800,
+21456,9802,8456,9780,21471,9809,9808,9810,9778,9806,9811,21480,
+9815,21481,9781,21482,9779,21483,9814,9813,7757,9819,21502,9818,
+21503,9817,8238,9775,9798,21508,9766,9763,21531,9777,21532,4296,
+7561,21535,2650,7562,7568,21540,1044,7569,21541,3895,21547,21548,
+7588,21549,2263,21551,2596,7622,7941,8331,21578,9601,9603,9602,
+21594,8686,8771,21611,9607,21612,9608,8701,21618,8687,9610,9612,
+8144,9618,9615,9620,7904,9617,9621,9623,21672,8374,9605,21697,
+9625,9626,21711,9627,9824,9632,9628,21743,9631,21744,8044,8366,
+21762,9611,9635,9609,9637,9638,9619,9639,8738,9641,9633,9642,
+21816,9616,9614,2900,6965,2073,6966,2814,21817,2937,4068,21818,
+4069,21819,4117,21820,6973,6972,4330,21821,3715,6974,6976,6975,
+1766,6979,1951,21824,2328,6982,1579,21825,6989,2997,21826,6990,
+6991,21830,6992,7637,21831,21832,6996,6997,1934,21837,4234,7005,
+21840,7007,21841,9864,9886,9723,21845,8076,8692,7446,2656,7680,
+2651,7682,21868,7683,8305,2714,7406,9871,2704,21889,8922,3465,
+2515,6954,21901,1937,7873,7688,7687,21909,7689,7692,21912,7691,
+7859,7690,7693,9834,21919,9866,9833,21922,6741,21923,9752,7542,
+9753,9754,21933,7543,21934,7544,1509,21935,4724,1821,21938,9843,
+21939,4721,21940,5087,3466,21947,7695,7699,21966,7698,21967,1072,
+21968,8390,8811,9427,3082,6594,7814,21982,9743,9744,9746,8240,
+21991,9841,9750,21997,9749,1282,7533,7534,2605,3198,7541,8247,
+7970,9453,2627,1793,6740,7988,1859,4851,10014,355,10015,265,
+};
+
+static pdf_cmap cmap_UniGB_UCS2_H = {
+	-1, "UniGB-UCS2-H", "", 0, 0, 2,
+	{ {2,0,55295},{2,57344,65535}, },
+	6047, 6047, (pdf_range*) cmap_UniGB_UCS2_H_ranges,
+	9528, 9528, (unsigned short*) cmap_UniGB_UCS2_H_table,
+};
+
+/* UniGB-UCS2-V */
+
+static const pdf_range cmap_UniGB_UCS2_V_ranges[] = {
+{8212,0,598},{8230,0,599},{8741,0,7708},{12289,6,0},
+{12296,29,584},{12304,5,594},{12307,0,7706},{12308,5,582},
+{12310,5,592},{65281,0,578},{65288,5,580},{65292,0,573},
+{65294,0,7707},{65306,5,576},{65309,0,7708},{65311,0,579},
+{65339,0,7709},{65341,0,7710},{65343,0,600},{65371,0,596},
+{65373,6,2},{65507,0,7711},
+};
+
+static const unsigned short cmap_UniGB_UCS2_V_table[4] = {
+575,574,597,7704,
+};
+
+static pdf_cmap cmap_UniGB_UCS2_V = {
+	-1, "UniGB-UCS2-V", "UniGB-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	22, 22, (pdf_range*) cmap_UniGB_UCS2_V_ranges,
+	4, 4, (unsigned short*) cmap_UniGB_UCS2_V_table,
+};
+
+/* UniGB-UTF16-H */
+
+static const pdf_range cmap_UniGB_UTF16_H_ranges[] = {
+{32,377,1},{164,6,0},{167,10,2},{176,6,5},
+{183,0,99},{215,0,128},{224,6,7},{232,10,9},
+{236,6,12},{242,6,14},{247,0,129},{249,6,16},
+{252,0,692},{257,0,668},{275,0,672},{283,0,674},
+{299,0,676},{324,0,696},{328,0,697},{333,0,680},
+{363,0,684},{462,0,670},{464,0,678},{466,0,682},
+{468,0,686},{470,0,688},{472,0,689},{474,0,690},
+{476,0,691},{505,0,698},{593,0,694},{609,0,699},
+{711,0,101},{713,0,100},{714,5,9907},{729,0,9909},
+{913,65,525},{931,25,542},{945,65,549},{963,25,566},
+{1025,0,608},{1040,21,602},{1046,125,609},{1078,101,642},
+{1105,0,641},{7743,0,695},{8208,0,10018},{8211,14,18},
+{8216,5,109},{8220,5,111},{8229,6,22},{8240,0,170},
+{8242,5,163},{8245,0,9913},{8251,0,184},{8285,0,599},
+{8364,0,22353},{8451,0,165},{8453,0,9914},{8457,0,9915},
+{8470,0,172},{8481,6,24},{8544,45,250},{8560,37,9897},
+{8592,5,186},{8594,6,26},{8598,13,9916},{8712,0,137},
+{8719,0,134},{8721,0,133},{8725,0,9920},{8730,0,139},
+{8733,14,28},{8739,0,9922},{8741,0,141},{8743,5,131},
+{8745,10,32},{8750,0,146},{8756,14,35},{8765,0,150},
+{8776,0,149},{8780,0,148},{8786,0,9923},{8800,6,39},
+{8804,5,155},{8806,5,9924},{8814,5,153},{8853,0,9988},
+{8857,0,144},{8869,0,140},{8895,0,9926},{8943,0,108},
+{8978,0,143},{9312,37,230},{9332,77,210},{9352,77,190},
+{9472,301,738},{9552,141,9927},{9601,57,9963},{9619,9,9978},
+{9632,6,41},{9650,6,43},{9660,5,9981},{9670,6,45},
+{9675,0,175},{9678,6,47},{9698,13,9983},{9733,6,49},
+{9737,0,9987},{9792,0,161},{9794,0,160},{11904,6,51},
+{11906,5,22429},{11908,0,22051},{11909,9,22431},{11912,0,22054},
+{11913,5,22434},{11915,6,53},{11917,37,22436},{11927,0,22061},
+{11928,5,22446},{11931,45,22448},{11943,0,22074},{11944,5,22460},
+{11946,0,22077},{11947,9,22462},{11950,0,22080},{11951,13,22465},
+{11955,0,22082},{11956,5,22469},{11958,5,22083},{11960,9,22471},
+{11963,0,22088},{11964,53,22474},{11978,0,22098},{11979,161,22488},
+{12032,854,55},{12272,45,10060},{12288,9,96},{12291,0,103},
+{12293,10,269},{12296,29,115},{12304,5,125},{12306,6,272},
+{12308,5,113},{12310,5,123},{12317,5,9990},{12321,33,9992},
+{12339,9,22395},{12344,9,22398},{12350,6,274},{12353,329,356},
+{12436,0,22375},{12443,5,10020},{12445,5,10025},{12449,341,439},
+{12535,22,276},{12541,5,10022},{12549,145,700},{12586,9,22401},
+{12704,93,22404},{12832,37,240},{12849,0,10017},{12963,0,10001},
+{13198,5,10002},{13212,9,10004},{13217,0,10007},{13252,0,10008},
+{13262,0,10009},{13265,5,10010},{13269,0,10012},{13312,281,22529},
+{13383,0,22053},{13384,169,22600},{13427,0,22052},{13428,1189,22643},
+{13726,0,22057},{13727,441,22941},{13838,0,22059},{13839,41,23052},
+{13850,0,22058},{13851,3057,23063},{14616,0,22063},{14617,337,23828},
+{14702,0,22062},{14703,381,23913},{14799,6,282},{14801,53,24009},
+{14815,0,22066},{14816,585,24023},{14963,0,22067},{14964,869,24170},
+{15182,0,22071},{15183,1145,24388},{15470,0,22072},{15471,449,24675},
+{15584,0,22073},{15585,3537,24788},{16470,0,22078},{16471,1053,25673},
+{16735,0,22079},{16736,1881,25937},{17207,0,22081},{17208,461,26408},
+{17324,0,22087},{17325,13,26524},{17329,0,22086},{17330,169,26528},
+{17373,0,22089},{17374,989,26571},{17622,0,22090},{17623,1489,26819},
+{17996,0,22092},{17997,77,27192},{18017,0,22091},{18018,769,27212},
+{18211,0,22094},{18212,17,27405},{18217,0,22095},{18218,325,27410},
+{18300,0,22096},{18301,61,27492},{18317,0,22097},{18318,1761,27508},
+{18759,0,22099},{18760,197,27949},{18810,0,22100},{18811,5,27999},
+{18813,0,22101},{18814,13,28001},{18818,5,22102},{18820,0,28005},
+{18821,5,22104},{18823,77,28006},{18843,0,22107},{18844,9,28026},
+{18847,0,22106},{18848,85,28029},{18870,6,284},{18872,2809,28051},
+{19575,0,22116},{19576,153,28754},{19615,9,22113},{19618,6,286},
+{19620,441,28793},{19731,25,22118},{19738,589,28904},{19886,0,22125},
+{19887,25,29052},{19968,14,288},{19972,9,10073},{19975,94,292},
+{19999,9,10079},{20002,46,316},{20014,5,10085},{20016,62,328},
+{20032,9,10092},{20035,90,344},{20058,5,10101},{20060,22,367},
+{20066,13,10103},{20070,0,3456},{20071,5,10107},{20073,0,4726},
+{20074,21,10109},{20080,14,373},{20084,37,10116},{20094,0,3113},
+{20095,9,10126},{20098,0,8281},{20099,9,10129},{20102,62,377},
+{20118,5,10135},{20120,14,393},{20124,5,10138},{20126,66,397},
+{20143,9,10142},{20146,14,414},{20150,13,10146},{20154,6,418},
+{20156,9,10150},{20159,62,420},{20175,5,10155},{20177,34,436},
+{20186,9,10158},{20189,34,445},{20198,5,10163},{20200,18,454},
+{20205,9,10166},{20208,30,459},{20216,9,10171},{20219,26,467},
+{20226,25,10177},{20233,6,474},{20235,5,10184},{20237,18,476},
+{20242,17,10186},{20247,18,481},{20252,5,10191},{20254,38,486},
+{20264,5,10195},{20266,6,496},{20268,9,10197},{20271,58,498},
+{20286,17,10206},{20291,0,1481},{20292,5,10211},{20294,0,1420},
+{20295,21,10213},{20301,78,513},{20321,5,10222},{20323,26,533},
+{20330,5,10226},{20332,0,2491},{20333,5,10228},{20335,6,540},
+{20337,5,10230},{20339,14,542},{20343,13,10233},{20347,18,546},
+{20352,9,10238},{20355,58,551},{20370,5,10247},{20372,14,566},
+{20376,9,10250},{20379,10,570},{20382,5,10254},{20384,0,3885},
+{20385,5,10256},{20387,50,573},{20400,17,10261},{20405,0,3155},
+{20406,33,10266},{20415,0,1100},{20416,5,10275},{20418,14,586},
+{20422,13,10277},{20426,0,2350},{20427,9,10281},{20430,14,590},
+{20434,17,10284},{20439,50,594},{20452,5,10292},{20454,18,607},
+{20459,5,10295},{20461,26,612},{20468,13,10299},{20472,10,619},
+{20475,9,10304},{20478,10,622},{20481,17,10308},{20486,0,8214},
+{20487,5,10313},{20489,46,625},{20501,9,10319},{20504,18,637},
+{20509,5,10323},{20511,10,642},{20514,9,10326},{20517,38,645},
+{20527,41,10330},{20538,18,655},{20543,13,10343},{20547,0,4828},
+{20548,9,10347},{20551,10,660},{20554,5,10350},{20556,14,663},
+{20560,17,10353},{20565,0,4829},{20566,13,10358},{20570,10,667},
+{20573,29,10363},{20581,0,2162},{20582,21,10371},{20588,0,4832},
+{20589,25,10377},{20596,14,670},{20600,9,10384},{20603,0,4833},
+{20604,5,10387},{20606,10,674},{20609,13,10389},{20613,0,1712},
+{20614,5,10393},{20616,0,2535},{20617,13,10395},{20621,0,1027},
+{20622,29,10399},{20630,14,677},{20634,29,10408},{20642,30,681},
+{20650,5,10418},{20652,6,689},{20654,13,10420},{20658,22,691},
+{20664,5,10425},{20666,6,697},{20668,5,10427},{20670,0,8424},
+{20671,9,10429},{20674,0,8916},{20675,5,10432},{20677,0,8121},
+{20678,9,10434},{20681,0,8920},{20682,17,10437},{20687,10,699},
+{20690,9,10443},{20693,6,702},{20695,9,10446},{20698,0,2574},
+{20699,9,10449},{20702,0,8597},{20703,21,10452},{20709,14,704},
+{20713,9,10458},{20716,10,708},{20719,13,10461},{20723,10,711},
+{20726,9,10466},{20729,10,714},{20732,13,10470},{20736,46,717},
+{20748,13,10478},{20752,22,729},{20758,5,10484},{20760,0,9857},
+{20761,21,10486},{20767,10,735},{20770,29,10493},{20778,0,8753},
+{20779,25,10501},{20786,0,7827},{20787,13,10508},{20791,0,8914},
+{20792,5,10512},{20794,10,738},{20797,5,10514},{20799,58,741},
+{20814,9,10520},{20817,22,756},{20823,9,10524},{20826,10,762},
+{20829,17,10528},{20834,0,2259},{20835,5,10533},{20837,0,3270},
+{20838,5,10535},{20840,86,765},{20862,5,10541},{20864,10,787},
+{20867,5,10543},{20869,0,2877},{20870,5,10545},{20872,6,790},
+{20874,5,10547},{20876,6,792},{20878,13,10549},{20882,0,2741},
+{20883,5,10553},{20885,30,794},{20893,9,10557},{20896,22,802},
+{20902,17,10562},{20907,6,808},{20909,5,10567},{20911,34,810},
+{20920,9,10570},{20923,10,819},{20926,5,10573},{20928,0,2282},
+{20929,9,10575},{20932,54,822},{20946,33,10583},{20955,10,836},
+{20958,5,10593},{20960,6,839},{20962,5,10595},{20964,0,1676},
+{20965,21,10597},{20971,98,841},{20996,5,10609},{20998,18,866},
+{21003,5,10612},{21005,6,871},{21007,5,10614},{21009,6,873},
+{21011,9,10616},{21014,30,875},{21022,5,10620},{21024,0,3319},
+{21025,9,10622},{21028,0,2961},{21029,9,10625},{21032,34,883},
+{21041,5,10631},{21043,0,4752},{21044,5,10633},{21046,34,892},
+{21055,5,4753},{21057,14,901},{21061,5,10637},{21063,0,8803},
+{21064,5,10639},{21066,14,905},{21070,5,10641},{21072,6,909},
+{21074,5,10643},{21076,10,911},{21079,13,10646},{21083,14,914},
+{21087,5,10651},{21089,0,4757},{21090,9,10653},{21093,22,918},
+{21099,9,10658},{21102,6,924},{21104,5,10661},{21106,14,926},
+{21110,25,10664},{21117,26,930},{21124,9,10673},{21127,26,937},
+{21134,5,10677},{21136,14,944},{21140,25,10680},{21147,34,948},
+{21156,13,10688},{21160,14,957},{21164,5,5006},{21166,9,10692},
+{21169,10,961},{21172,37,10695},{21182,22,964},{21188,9,10707},
+{21191,18,970},{21196,13,10712},{21200,10,975},{21203,5,10717},
+{21205,42,978},{21216,5,10722},{21218,10,989},{21221,41,10725},
+{21232,6,992},{21234,9,10736},{21237,0,8209},{21238,5,10739},
+{21240,10,994},{21243,9,10741},{21246,10,997},{21249,13,10744},
+{21253,14,1000},{21257,13,10749},{21261,14,1004},{21265,13,10754},
+{21269,22,1008},{21275,5,10759},{21277,0,4372},{21278,5,10761},
+{21280,14,1014},{21284,5,10764},{21286,0,4742},{21287,9,10766},
+{21290,0,1640},{21291,5,10769},{21293,18,1018},{21298,25,10772},
+{21305,10,1023},{21308,5,10779},{21310,50,1026},{21323,9,10784},
+{21326,38,1039},{21336,5,10788},{21338,70,1049},{21356,5,10795},
+{21358,50,1067},{21371,13,10800},{21375,0,3169},{21376,5,10804},
+{21378,18,1080},{21383,5,10807},{21385,18,1085},{21390,25,10810},
+{21397,0,1189},{21398,5,10817},{21400,10,1090},{21403,5,10819},
+{21405,50,1093},{21418,9,10825},{21421,6,1106},{21423,9,10828},
+{21426,18,1108},{21431,13,10833},{21435,0,3200},{21436,9,10837},
+{21439,18,1113},{21444,13,10841},{21448,22,1118},{21454,9,10845},
+{21457,0,1599},{21458,5,10848},{21460,30,1124},{21468,9,10852},
+{21471,122,1132},{21502,9,10859},{21505,90,1163},{21528,9,10867},
+{21531,34,1186},{21540,5,10872},{21542,62,1195},{21558,5,10877},
+{21560,34,1211},{21569,5,10882},{21571,0,5384},{21572,5,10884},
+{21574,22,1220},{21580,13,10888},{21584,6,1226},{21586,9,5380},
+{21589,30,1228},{21597,17,10894},{21602,26,1236},{21609,29,10902},
+{21617,30,1243},{21625,5,10911},{21627,10,1251},{21630,5,10913},
+{21632,26,1254},{21639,13,10918},{21643,46,1261},{21655,5,10925},
+{21657,0,2629},{21658,5,5395},{21660,6,1273},{21662,17,10928},
+{21667,22,1275},{21673,5,5419},{21675,38,1281},{21685,9,10937},
+{21688,0,3897},{21689,5,10940},{21691,58,1291},{21706,5,10945},
+{21708,26,1306},{21715,5,5408},{21717,14,1313},{21721,5,5416},
+{21723,26,1317},{21730,9,10951},{21733,22,1324},{21739,5,10954},
+{21741,6,1330},{21743,9,10956},{21746,6,1332},{21748,21,10959},
+{21754,30,1334},{21762,5,10968},{21764,22,1342},{21770,17,10972},
+{21775,10,1348},{21778,5,10977},{21780,0,5429},{21781,21,10979},
+{21787,0,5425},{21788,13,10985},{21792,6,1351},{21794,5,5431},
+{21796,0,2002},{21797,5,10990},{21799,0,5435},{21800,5,10992},
+{21802,38,1353},{21812,9,10997},{21815,0,5447},{21816,13,11000},
+{21820,42,1363},{21831,5,11008},{21833,6,1374},{21835,13,11010},
+{21839,6,1376},{21841,5,11014},{21843,14,1378},{21847,17,11017},
+{21852,10,1382},{21855,5,11023},{21857,0,1637},{21858,5,11025},
+{21860,14,1385},{21864,5,11027},{21866,18,1389},{21871,21,11030},
+{21877,9,5449},{21880,0,3952},{21881,5,11036},{21883,38,1394},
+{21893,5,11040},{21895,18,1404},{21900,9,11042},{21903,10,1409},
+{21906,5,11046},{21908,0,5470},{21909,9,11048},{21912,6,1412},
+{21914,5,11051},{21916,14,1414},{21920,25,11054},{21927,0,4037},
+{21928,5,11061},{21930,18,1418},{21935,5,11065},{21937,46,1423},
+{21949,5,5468},{21951,17,11072},{21956,22,1435},{21962,5,11078},
+{21964,5,5487},{21966,0,8303},{21967,5,11080},{21969,22,1441},
+{21975,9,11083},{21978,66,1447},{21995,5,5477},{21997,5,11091},
+{21999,0,5483},{22000,5,11093},{22002,5,5485},{22004,14,1464},
+{22008,17,11096},{22013,18,1468},{22018,13,11102},{22022,14,1473},
+{22026,5,11107},{22028,14,1477},{22032,13,11109},{22036,18,1481},
+{22041,5,11114},{22043,18,1486},{22048,9,11117},{22051,6,1491},
+{22053,5,11120},{22055,10,1493},{22058,5,11123},{22060,62,1496},
+{22076,9,11128},{22079,10,1512},{22082,37,11132},{22092,10,1515},
+{22095,17,11142},{22100,0,5512},{22101,5,11147},{22103,10,1518},
+{22106,5,11149},{22108,6,1521},{22110,5,11151},{22112,50,1523},
+{22125,5,11156},{22127,46,1536},{22139,5,5517},{22141,9,11163},
+{22144,0,9070},{22145,13,11166},{22149,10,1548},{22152,13,11170},
+{22156,14,1551},{22160,9,11175},{22163,10,1555},{22166,9,11179},
+{22169,0,8350},{22170,33,11182},{22179,0,3942},{22180,5,11191},
+{22182,10,1558},{22185,17,11194},{22190,6,1561},{22192,9,11199},
+{22195,18,1563},{22200,13,11203},{22204,0,2193},{22205,9,11207},
+{22208,10,1568},{22211,5,11210},{22213,0,8923},{22214,5,11212},
+{22216,18,1571},{22221,13,11215},{22225,0,8865},{22226,5,11219},
+{22228,0,5522},{22229,5,11221},{22231,0,5523},{22232,5,11223},
+{22234,42,1576},{22245,21,11227},{22251,10,1587},{22254,5,11234},
+{22256,6,1590},{22258,5,11236},{22260,6,1592},{22262,9,11238},
+{22265,6,1594},{22267,5,11241},{22269,10,1596},{22272,9,11243},
+{22275,42,1599},{22286,13,11248},{22290,6,1610},{22292,5,11252},
+{22294,10,1612},{22297,9,11255},{22300,0,5533},{22301,5,11258},
+{22303,0,3698},{22304,9,11260},{22307,0,3388},{22308,13,11263},
+{22312,22,1615},{22318,5,5036},{22320,0,1465},{22321,5,11268},
+{22323,0,5034},{22324,17,11270},{22329,10,1621},{22332,5,11275},
+{22334,18,1624},{22339,13,11279},{22343,0,2344},{22344,5,11283},
+{22346,30,1629},{22354,17,11286},{22359,0,2422},{22360,5,11291},
+{22362,30,1637},{22370,5,11293},{22372,46,1645},{22384,9,11299},
+{22387,0,5050},{22388,5,11302},{22390,6,1657},{22392,9,11304},
+{22395,6,1659},{22397,17,11307},{22402,18,1661},{22407,13,11312},
+{22411,6,1666},{22413,17,11316},{22418,6,1668},{22420,25,11321},
+{22427,0,1569},{22428,13,11328},{22432,58,1670},{22447,9,11336},
+{22450,10,1685},{22453,9,11340},{22456,0,5065},{22457,33,11343},
+{22466,6,1688},{22468,25,11352},{22475,0,2712},{22476,5,11359},
+{22478,6,1690},{22480,5,11361},{22482,14,1692},{22486,5,11364},
+{22488,10,1696},{22491,5,11366},{22493,18,1699},{22498,5,11369},
+{22500,0,5069},{22501,29,11371},{22509,10,1704},{22512,13,11380},
+{22516,0,5066},{22517,5,11384},{22519,14,1707},{22523,5,11386},
+{22525,0,5073},{22526,5,11388},{22528,10,1711},{22531,5,11391},
+{22533,10,1714},{22536,5,11393},{22538,14,1717},{22542,9,11396},
+{22545,0,3122},{22546,9,11399},{22549,6,1721},{22551,5,11402},
+{22553,0,5077},{22554,9,11404},{22557,18,1723},{22562,5,11408},
+{22564,0,1453},{22565,17,11410},{22570,0,2365},{22571,13,11415},
+{22575,10,1728},{22578,5,11419},{22580,6,1731},{22582,53,11421},
+{22596,0,5078},{22597,17,11435},{22602,42,1733},{22613,5,11443},
+{22615,6,1744},{22617,17,11445},{22622,0,3286},{22623,9,11450},
+{22626,14,1746},{22630,17,11454},{22635,6,1750},{22637,29,11459},
+{22645,0,7805},{22646,9,11467},{22649,0,8406},{22650,13,11470},
+{22654,30,1752},{22662,9,11477},{22665,6,1760},{22667,25,11480},
+{22674,6,1762},{22676,17,11487},{22681,26,1764},{22688,29,11494},
+{22696,6,1771},{22698,13,11502},{22702,0,7903},{22703,13,11506},
+{22707,0,7929},{22708,25,11510},{22715,14,1773},{22719,5,11518},
+{22721,0,1091},{22722,9,11520},{22725,10,1777},{22728,33,11524},
+{22737,18,1780},{22742,5,11535},{22744,10,1785},{22747,9,11537},
+{22750,26,1788},{22757,13,11542},{22761,30,1795},{22769,5,11548},
+{22771,0,2388},{22772,5,11550},{22774,0,1967},{22775,5,11552},
+{22777,6,1803},{22779,5,11554},{22781,0,8504},{22782,13,11556},
+{22786,10,1805},{22789,5,11561},{22791,0,1057},{22792,17,11563},
+{22797,10,1808},{22800,13,11569},{22804,10,1811},{22807,5,11573},
+{22809,14,1814},{22813,5,11576},{22815,0,1812},{22816,5,11578},
+{22818,62,1818},{22834,5,11585},{22836,0,3688},{22837,5,11587},
+{22839,30,1834},{22847,5,11591},{22849,14,1842},{22853,5,11594},
+{22855,18,1846},{22860,5,11597},{22862,14,1851},{22866,5,11600},
+{22868,26,1855},{22875,17,11603},{22880,10,1862},{22883,5,11609},
+{22885,0,973},{22886,9,11611},{22889,22,1865},{22895,13,11616},
+{22899,26,1871},{22906,9,11622},{22909,0,1914},{22910,9,11625},
+{22913,38,1878},{22923,5,11630},{22925,0,6007},{22926,13,11632},
+{22930,6,1888},{22932,5,11636},{22934,14,1890},{22938,9,11639},
+{22941,6,1894},{22943,13,11642},{22947,10,1896},{22950,5,11646},
+{22952,0,1630},{22953,5,6008},{22955,0,6013},{22956,5,11648},
+{22958,6,1899},{22960,5,11650},{22962,0,6017},{22963,21,11652},
+{22969,10,1901},{22972,5,11659},{22974,0,6020},{22975,25,11661},
+{22982,0,2842},{22983,9,11668},{22986,6,1904},{22988,13,11671},
+{22992,18,1906},{22997,5,11675},{22999,26,1911},{23006,17,11679},
+{23011,10,1918},{23014,5,11685},{23016,0,4179},{23017,9,11687},
+{23020,0,2074},{23021,45,11690},{23033,10,1921},{23036,9,11703},
+{23039,22,1924},{23045,5,6021},{23047,10,1930},{23050,5,11708},
+{23052,0,6028},{23053,13,11710},{23057,10,1933},{23060,13,11715},
+{23064,0,2898},{23065,9,11719},{23068,0,2859},{23069,5,11722},
+{23071,6,1936},{23073,5,11724},{23075,10,1938},{23078,9,11727},
+{23081,0,2793},{23082,25,11730},{23089,22,1941},{23095,17,11739},
+{23100,0,6039},{23101,9,11744},{23104,6,1947},{23106,13,11747},
+{23110,0,3044},{23111,5,11751},{23113,6,1949},{23115,37,11753},
+{23125,0,6038},{23126,13,11763},{23130,0,2046},{23131,25,11767},
+{23138,0,6040},{23139,9,11774},{23142,6,1951},{23144,5,11777},
+{23146,0,2466},{23147,5,11779},{23149,0,9209},{23150,21,11781},
+{23156,14,1953},{23160,5,11787},{23162,0,6046},{23163,13,11789},
+{23167,0,4033},{23168,69,11793},{23186,0,2754},{23187,25,11811},
+{23194,6,1957},{23196,41,11818},{23207,0,9212},{23208,5,11829},
+{23210,0,6043},{23211,25,11831},{23218,14,1959},{23222,5,11839},
+{23224,0,6052},{23225,13,11841},{23229,6,1963},{23231,5,11845},
+{23233,6,1965},{23235,21,11847},{23241,0,2088},{23242,5,11853},
+{23244,0,3904},{23245,17,11855},{23250,26,1967},{23257,9,11862},
+{23260,0,6059},{23261,9,11865},{23264,14,1974},{23268,5,11869},
+{23270,0,6057},{23271,5,11871},{23273,10,1978},{23276,17,11874},
+{23281,0,6055},{23282,9,11879},{23285,0,9206},{23286,17,11882},
+{23291,0,9213},{23292,13,11887},{23296,0,9208},{23297,25,11891},
+{23304,18,1981},{23309,33,11899},{23318,14,1986},{23322,25,11909},
+{23329,0,9215},{23330,29,11916},{23338,0,9216},{23339,17,11924},
+{23344,18,1990},{23349,5,11931},{23351,6,1995},{23353,25,11933},
+{23360,0,6065},{23361,41,11940},{23372,0,9211},{23373,9,11951},
+{23376,62,1997},{23392,5,11957},{23394,18,2013},{23399,5,11959},
+{23401,14,2018},{23405,9,11961},{23408,22,2022},{23414,5,11966},
+{23416,10,2028},{23419,5,11969},{23421,62,2031},{23437,5,11975},
+{23439,0,1953},{23440,9,11977},{23443,78,2047},{23463,9,11983},
+{23466,6,2067},{23468,13,11986},{23472,0,4378},{23473,5,11990},
+{23475,26,2069},{23482,9,11993},{23485,10,2076},{23488,5,11996},
+{23490,22,2079},{23496,13,11999},{23500,0,1718},{23501,9,12003},
+{23504,14,2085},{23508,33,12007},{23517,78,2089},{23537,13,12021},
+{23541,30,2109},{23549,5,12026},{23551,10,2117},{23554,5,12029},
+{23556,54,2120},{23570,5,12034},{23572,38,2134},{23582,13,12039},
+{23586,22,2144},{23592,13,12045},{23596,0,5304},{23597,13,12049},
+{23601,0,2300},{23602,5,12053},{23604,0,5305},{23605,5,12055},
+{23607,46,2150},{23619,5,12057},{23621,0,2306},{23622,5,12059},
+{23624,14,2162},{23628,5,12061},{23630,14,2166},{23634,9,12063},
+{23637,0,4442},{23638,9,12066},{23641,0,5993},{23642,13,12069},
+{23646,42,2170},{23657,9,12075},{23660,22,2181},{23666,25,12080},
+{23673,6,2187},{23675,13,12087},{23679,14,2189},{23683,17,12092},
+{23688,0,5552},{23689,9,12097},{23692,6,2193},{23694,5,12100},
+{23696,6,2195},{23698,5,12102},{23700,14,2197},{23704,5,5553},
+{23706,10,2201},{23709,13,12105},{23713,10,2204},{23716,17,12109},
+{23721,18,2207},{23726,9,12115},{23729,30,2212},{23737,13,12121},
+{23741,18,2220},{23746,5,12127},{23748,0,5567},{23749,21,12129},
+{23755,0,5570},{23756,21,12135},{23762,0,5568},{23763,21,12141},
+{23769,0,4548},{23770,25,12147},{23777,0,3884},{23778,5,12154},
+{23780,26,2225},{23787,5,12158},{23789,0,3146},{23790,5,12160},
+{23792,0,1666},{23793,9,12162},{23796,10,2232},{23799,13,12166},
+{23803,10,2235},{23806,13,12171},{23810,5,5572},{23812,5,12175},
+{23814,6,2238},{23816,17,12177},{23821,6,2240},{23823,17,12182},
+{23828,14,2242},{23832,9,12188},{23835,0,5580},{23836,5,12191},
+{23838,0,5578},{23839,17,12193},{23844,22,2246},{23850,5,12200},
+{23852,10,2252},{23855,17,12202},{23860,0,5583},{23861,29,12207},
+{23869,6,2255},{23871,29,12215},{23879,0,6946},{23880,5,12223},
+{23882,10,2257},{23885,9,12225},{23888,0,9098},{23889,25,12228},
+{23896,0,5581},{23897,5,12235},{23899,10,2260},{23902,41,12238},
+{23913,14,2263},{23917,5,12250},{23919,0,5587},{23920,13,12252},
+{23924,0,5593},{23925,45,12256},{23937,14,2267},{23941,5,12269},
+{23943,0,9096},{23944,57,12271},{23959,10,2271},{23962,9,12287},
+{23965,0,5596},{23966,5,12290},{23968,0,9101},{23969,21,12292},
+{23975,0,9100},{23976,57,12298},{23991,22,2274},{23997,29,12315},
+{24005,0,5599},{24006,17,12323},{24011,10,2280},{24014,13,12329},
+{24018,10,2283},{24021,21,12334},{24027,14,2286},{24031,5,12341},
+{24033,6,2290},{24035,5,12343},{24037,26,2292},{24044,5,12346},
+{24046,26,2299},{24053,5,12348},{24055,0,3932},{24056,17,12350},
+{24061,46,2306},{24073,9,12359},{24076,0,3856},{24077,5,12362},
+{24079,10,2318},{24082,5,12364},{24084,38,2321},{24094,25,12367},
+{24101,10,2331},{24104,9,12374},{24107,14,2334},{24111,5,12378},
+{24113,10,2338},{24116,5,12381},{24118,10,2341},{24121,5,12383},
+{24123,5,5539},{24125,0,2742},{24126,5,12385},{24128,22,2344},
+{24134,21,12388},{24140,0,2020},{24141,25,12394},{24148,18,2350},
+{24153,5,12402},{24155,0,5544},{24156,5,12404},{24158,22,2355},
+{24164,25,12407},{24171,6,2361},{24173,17,12414},{24178,58,2363},
+{24193,9,12421},{24196,14,2378},{24200,5,12425},{24202,6,2382},
+{24204,9,12427},{24207,70,2384},{24225,13,12434},{24229,10,2402},
+{24232,9,12438},{24235,10,2405},{24238,17,12442},{24243,26,2408},
+{24250,13,12448},{24254,0,5689},{24255,37,12452},{24265,6,2415},
+{24267,21,12462},{24273,10,2417},{24276,5,12468},{24278,0,2583},
+{24279,13,12470},{24283,0,5694},{24284,9,12474},{24287,18,2420},
+{24292,13,12477},{24296,18,2425},{24301,21,12483},{24307,18,2430},
+{24312,5,12490},{24314,0,2169},{24315,9,12492},{24318,26,2435},
+{24325,9,12495},{24328,14,2442},{24332,9,12499},{24335,38,2446},
+{24345,5,12506},{24347,0,1279},{24348,9,12508},{24351,6,2456},
+{24353,13,12511},{24357,22,2458},{24363,5,12516},{24365,34,2464},
+{24374,9,12522},{24377,14,2473},{24381,9,12526},{24384,0,6590},
+{24385,17,12529},{24390,10,2477},{24393,9,12535},{24396,54,2480},
+{24410,9,12542},{24413,0,4180},{24414,9,12545},{24417,22,2494},
+{24423,5,12550},{24425,18,2500},{24430,5,12553},{24432,14,2505},
+{24436,9,12556},{24439,22,2509},{24445,9,12561},{24448,50,2515},
+{24461,9,12566},{24464,10,2528},{24467,5,12569},{24469,18,2531},
+{24474,5,12572},{24476,22,2536},{24482,21,12576},{24488,10,2542},
+{24491,5,12582},{24493,6,2545},{24495,21,12584},{24501,18,2547},
+{24506,5,12592},{24508,6,2552},{24510,17,12594},{24515,14,2554},
+{24519,5,12599},{24521,0,5699},{24522,5,12601},{24524,26,2558},
+{24531,9,12604},{24534,14,2565},{24538,9,12607},{24541,0,5763},
+{24542,5,12610},{24544,6,2569},{24546,5,12612},{24548,0,5706},
+{24549,5,12614},{24551,0,4268},{24552,5,12616},{24554,18,2571},
+{24559,5,12619},{24561,0,1253},{24562,9,12621},{24565,0,2897},
+{24566,5,12624},{24568,0,5712},{24569,5,12626},{24571,38,2576},
+{24581,5,5708},{24583,9,12629},{24586,0,5721},{24587,5,12632},
+{24589,10,2586},{24592,5,12634},{24594,18,2589},{24599,5,12637},
+{24601,18,2594},{24606,5,12640},{24608,6,2599},{24610,9,12642},
+{24613,26,2601},{24620,9,12645},{24623,0,3152},{24624,17,12648},
+{24629,0,5714},{24630,17,12653},{24635,6,2608},{24637,5,12658},
+{24639,18,2610},{24644,25,12661},{24651,10,2615},{24654,5,12669},
+{24656,10,2618},{24659,5,12672},{24661,0,3478},{24662,9,12674},
+{24665,6,2621},{24667,5,12677},{24669,0,6670},{24670,13,12679},
+{24674,10,2623},{24677,5,12683},{24679,38,2626},{24689,5,12686},
+{24691,0,2399},{24692,5,12688},{24694,6,2636},{24696,5,5724},
+{24698,22,2638},{24704,9,12692},{24707,6,2644},{24709,13,12695},
+{24713,0,3857},{24714,5,12699},{24716,6,2646},{24718,13,12701},
+{24722,18,2648},{24727,9,12707},{24730,26,2653},{24737,5,12712},
+{24739,0,2001},{24740,5,12714},{24742,10,2660},{24745,5,12717},
+{24747,54,2663},{24761,5,12723},{24763,6,2677},{24765,29,12725},
+{24773,6,2679},{24775,9,12733},{24778,6,2681},{24780,17,12736},
+{24785,0,2056},{24786,9,12741},{24789,0,3643},{24790,5,12744},
+{24792,38,2683},{24802,13,12749},{24806,66,2693},{24823,5,12755},
+{24825,10,2710},{24828,13,12757},{24832,6,2713},{24834,13,12761},
+{24838,14,2715},{24842,9,12766},{24845,10,2719},{24848,17,12769},
+{24853,0,5749},{24854,13,12774},{24858,10,2722},{24861,5,12778},
+{24863,6,2725},{24865,5,12780},{24867,18,2727},{24872,9,12783},
+{24875,0,5754},{24876,29,12786},{24884,0,9141},{24885,5,12794},
+{24887,0,9146},{24888,21,12796},{24894,6,2732},{24896,29,12802},
+{24904,26,2734},{24911,5,12812},{24913,0,3358},{24914,9,12814},
+{24917,0,2848},{24918,5,12817},{24920,10,2741},{24923,5,12820},
+{24925,10,2744},{24928,5,12823},{24930,10,2747},{24933,5,12825},
+{24935,18,2750},{24940,5,12828},{24942,10,2755},{24945,5,12831},
+{24947,18,2758},{24952,37,12834},{24962,0,8754},{24963,25,12844},
+{24970,6,2763},{24972,5,12851},{24974,26,2765},{24981,17,12855},
+{24986,0,7854},{24987,5,12860},{24989,0,6681},{24990,21,12862},
+{24996,0,7931},{24997,5,12868},{24999,30,2772},{25007,9,12872},
+{25010,0,8644},{25011,9,12875},{25014,6,2780},{25016,21,12878},
+{25022,0,1901},{25023,9,12884},{25026,0,1517},{25027,13,12887},
+{25031,22,2782},{25037,13,12891},{25041,14,2788},{25045,33,12896},
+{25054,6,2792},{25056,9,12905},{25059,0,9440},{25060,5,12908},
+{25062,10,2794},{25065,33,12911},{25074,0,7809},{25075,5,12920},
+{25077,46,2797},{25089,17,12925},{25094,86,2809},{25116,9,12933},
+{25119,34,2831},{25128,5,12939},{25130,42,2840},{25141,5,12945},
+{25143,0,1980},{25144,17,12947},{25149,26,2851},{25156,9,12953},
+{25159,0,3329},{25160,5,6646},{25162,18,2858},{25167,5,12957},
+{25169,14,2863},{25173,9,12959},{25176,0,3713},{25177,5,12962},
+{25179,0,2373},{25180,25,12964},{25187,0,2408},{25188,5,12971},
+{25190,42,2867},{25201,5,12974},{25203,0,1005},{25204,5,12976},
+{25206,0,1683},{25207,5,12978},{25209,0,3003},{25210,5,12980},
+{25212,18,2878},{25217,9,12983},{25220,0,1234},{25221,13,12986},
+{25225,6,2883},{25227,21,12990},{25233,42,2885},{25244,9,12998},
+{25247,26,2896},{25254,5,13002},{25256,0,2987},{25257,5,13004},
+{25259,6,2903},{25261,13,13006},{25265,0,1040},{25266,9,13010},
+{25269,0,1463},{25270,9,13013},{25273,26,2905},{25280,5,13018},
+{25282,106,2912},{25309,5,13025},{25311,0,2885},{25312,5,13027},
+{25314,30,2939},{25322,5,13030},{25324,46,2947},{25336,13,13035},
+{25340,26,2959},{25347,13,13040},{25351,10,2966},{25354,13,13044},
+{25358,0,2419},{25359,5,13048},{25361,0,3655},{25362,13,13050},
+{25366,0,3723},{25367,9,13054},{25370,46,2969},{25382,5,13058},
+{25384,14,2981},{25388,9,13061},{25391,0,4498},{25392,5,13064},
+{25394,0,6479},{25395,21,13066},{25401,6,2985},{25403,5,13072},
+{25405,6,2987},{25407,9,13074},{25410,18,2989},{25415,5,13078},
+{25417,30,2994},{25425,13,13081},{25429,0,1149},{25430,29,13085},
+{25438,22,3002},{25444,9,13094},{25447,30,3008},{25455,5,13099},
+{25457,6,3016},{25459,9,13101},{25462,6,3018},{25464,5,13104},
+{25466,6,3020},{25468,13,13106},{25472,18,3022},{25477,5,13111},
+{25479,46,3027},{25491,9,13116},{25494,10,3039},{25497,25,13120},
+{25504,66,3042},{25521,5,13132},{25523,6,3059},{25525,5,13134},
+{25527,38,3061},{25537,9,13140},{25540,10,3071},{25543,5,13144},
+{25545,0,3259},{25546,9,13146},{25549,22,3074},{25555,9,13150},
+{25558,0,4165},{25559,9,13153},{25562,0,8703},{25563,9,13156},
+{25566,22,3080},{25572,17,13161},{25577,6,3086},{25579,5,13166},
+{25581,6,3088},{25583,9,13168},{25586,26,3090},{25593,13,13174},
+{25597,22,3097},{25603,5,13179},{25605,0,2194},{25606,17,13181},
+{25611,22,3103},{25617,5,13187},{25619,6,3109},{25621,5,13189},
+{25623,0,7862},{25624,9,13191},{25627,26,3111},{25634,13,13196},
+{25638,0,5347},{25639,9,13200},{25642,14,3118},{25646,21,13204},
+{25652,10,3122},{25655,9,13211},{25658,0,3962},{25659,5,13214},
+{25661,18,3125},{25666,5,13218},{25668,26,3130},{25675,21,13221},
+{25681,14,3137},{25685,9,13228},{25688,0,4427},{25689,9,13231},
+{25692,14,3141},{25696,25,13235},{25703,10,3145},{25706,9,13243},
+{25709,10,3148},{25712,9,13247},{25715,0,8159},{25716,5,13250},
+{25718,6,3151},{25720,5,2819},{25722,6,3153},{25724,21,13253},
+{25730,26,3155},{25737,29,13261},{25745,22,3162},{25751,5,13270},
+{25753,0,5356},{25754,13,13272},{25758,6,3168},{25760,9,13276},
+{25763,10,3170},{25766,9,13279},{25769,54,3173},{25783,5,5354},
+{25785,58,3187},{25800,5,13291},{25802,42,3202},{25813,5,13297},
+{25815,14,3213},{25819,9,13300},{25822,34,3217},{25831,17,13307},
+{25836,0,8344},{25837,5,13312},{25839,22,3226},{25845,5,13315},
+{25847,0,9061},{25848,5,13317},{25850,26,3232},{25857,9,13321},
+{25860,10,3239},{25863,5,13325},{25865,0,5363},{25866,17,13327},
+{25871,0,8252},{25872,5,13332},{25874,46,3242},{25886,13,13339},
+{25890,14,3254},{25894,13,13343},{25898,22,3258},{25904,13,13348},
+{25908,30,3264},{25916,5,13354},{25918,6,3272},{25920,17,13356},
+{25925,0,1827},{25926,5,13361},{25928,6,3274},{25930,5,13363},
+{25932,0,1457},{25933,5,13365},{25935,10,3276},{25938,9,13368},
+{25941,38,3279},{25951,9,13374},{25954,6,3289},{25956,5,13377},
+{25958,0,1559},{25959,13,13379},{25963,6,3291},{25965,9,13383},
+{25968,34,3293},{25977,33,13389},{25986,6,3302},{25988,9,13398},
+{25991,0,3795},{25992,9,13401},{25995,6,3304},{25997,9,13404},
+{26000,50,3306},{26013,5,13412},{26015,10,3319},{26018,5,13415},
+{26020,50,3322},{26033,21,13421},{26039,10,3335},{26042,5,13428},
+{26044,6,3338},{26046,9,13430},{26049,22,3340},{26055,13,13434},
+{26059,18,3346},{26064,5,13439},{26066,0,6602},{26067,9,13441},
+{26070,6,3351},{26072,29,13444},{26080,10,3353},{26083,5,13453},
+{26085,18,3356},{26090,5,13455},{26092,6,3361},{26094,9,6410},
+{26097,0,1900},{26098,13,13457},{26102,6,3363},{26104,5,13461},
+{26106,0,3755},{26107,17,13463},{26112,14,3365},{26116,5,13469},
+{26118,0,2448},{26119,9,13471},{26122,22,3369},{26128,9,13476},
+{26131,10,3375},{26134,9,13479},{26137,0,6414},{26138,9,13482},
+{26141,14,3378},{26145,13,13486},{26149,14,3382},{26153,13,13491},
+{26157,18,3386},{26162,5,13497},{26164,10,3391},{26167,17,13499},
+{26172,10,3394},{26175,5,13505},{26177,10,3397},{26180,25,13507},
+{26187,6,3400},{26189,5,13514},{26191,0,6430},{26192,5,13516},
+{26194,22,3402},{26200,5,13518},{26202,0,3742},{26203,5,13520},
+{26205,18,3408},{26210,5,13524},{26212,18,3413},{26217,17,13528},
+{26222,10,3418},{26225,9,13533},{26228,14,3421},{26232,5,13537},
+{26234,0,4550},{26235,9,13539},{26238,0,2569},{26239,9,13542},
+{26242,10,3425},{26245,5,13546},{26247,10,3428},{26250,5,13548},
+{26252,0,6436},{26253,13,13550},{26257,0,3461},{26258,13,13554},
+{26262,6,3431},{26264,17,13558},{26269,0,6438},{26270,13,13563},
+{26274,0,7801},{26275,13,13567},{26279,6,3433},{26281,5,13571},
+{26283,0,8794},{26284,5,13573},{26286,0,2845},{26287,17,13575},
+{26292,0,1042},{26293,13,13580},{26297,0,5979},{26298,13,13584},
+{26302,0,6439},{26303,17,13588},{26308,22,3435},{26314,45,13595},
+{26326,0,9385},{26327,5,13607},{26329,6,3441},{26331,5,6440},
+{26333,0,3063},{26334,5,13610},{26336,0,8167},{26337,17,13612},
+{26342,0,6442},{26343,5,13617},{26345,0,6443},{26346,5,13619},
+{26348,0,8466},{26349,9,13621},{26352,18,3443},{26357,5,13625},
+{26359,10,3448},{26362,5,13627},{26364,18,3451},{26369,5,13630},
+{26371,0,8028},{26372,13,13632},{26376,22,3456},{26382,5,13637},
+{26384,0,6532},{26385,9,13639},{26388,14,3462},{26392,9,13643},
+{26395,18,3466},{26400,21,13648},{26406,46,3471},{26418,5,13657},
+{26420,6,3483},{26422,13,13659},{26426,0,2063},{26427,5,13663},
+{26429,0,4011},{26430,5,13665},{26432,14,3485},{26436,5,13668},
+{26438,14,3489},{26442,5,13671},{26444,30,3493},{26452,5,13675},
+{26454,0,4457},{26455,17,13677},{26460,22,3501},{26466,9,13683},
+{26469,0,2463},{26470,5,13686},{26472,10,3507},{26475,5,13688},
+{26477,42,3510},{26488,13,13693},{26492,22,3521},{26498,5,13699},
+{26500,0,1810},{26501,5,13701},{26503,18,3527},{26508,13,13705},
+{26512,0,3845},{26513,13,13709},{26517,38,3532},{26527,9,13716},
+{26530,58,3542},{26545,5,13724},{26547,22,3557},{26553,29,13727},
+{26561,14,3563},{26565,37,13736},{26575,22,3567},{26581,9,13746},
+{26584,42,3573},{26595,5,13752},{26597,0,1200},{26598,9,13754},
+{26601,0,6247},{26602,5,13757},{26604,0,2144},{26605,5,13759},
+{26607,22,3584},{26613,29,13762},{26621,14,3590},{26625,13,13771},
+{26629,58,3594},{26644,5,13779},{26646,6,3609},{26648,17,13781},
+{26653,0,6271},{26654,9,13786},{26657,0,3950},{26658,25,13789},
+{26665,6,3611},{26667,25,13796},{26674,5,6262},{26676,9,13803},
+{26679,10,3613},{26682,5,13806},{26684,102,3616},{26710,37,13814},
+{26720,5,6264},{26722,38,3642},{26732,29,13825},{26740,14,3652},
+{26744,33,13834},{26753,22,3656},{26759,29,13845},{26767,0,6282},
+{26768,9,13853},{26771,0,6285},{26772,9,13856},{26775,6,3662},
+{26777,13,13859},{26781,10,3664},{26784,5,13864},{26786,0,3339},
+{26787,9,13866},{26790,10,3667},{26793,13,13869},{26797,14,3670},
+{26801,5,13874},{26803,10,3674},{26806,37,13877},{26816,10,3677},
+{26819,21,13888},{26825,18,3680},{26830,13,13896},{26834,0,1023},
+{26835,5,13900},{26837,22,3685},{26843,13,13903},{26847,6,3691},
+{26849,5,13907},{26851,0,6298},{26852,9,13909},{26855,0,8818},
+{26856,21,13912},{26862,14,3693},{26866,9,13919},{26869,0,2384},
+{26870,9,13922},{26873,14,3697},{26877,13,13926},{26881,0,6296},
+{26882,9,13930},{26885,0,4181},{26886,17,13933},{26891,30,3701},
+{26899,45,13940},{26911,5,6290},{26913,9,13952},{26916,0,6293},
+{26917,29,13955},{26925,0,3719},{26926,5,13963},{26928,0,4147},
+{26929,9,13965},{26932,0,6310},{26933,13,13968},{26937,0,6301},
+{26938,9,13972},{26941,10,3709},{26944,5,13976},{26946,0,6303},
+{26947,25,13978},{26954,0,8702},{26955,29,13985},{26963,6,3712},
+{26965,5,13993},{26967,0,6297},{26968,5,13995},{26970,0,1315},
+{26971,5,13997},{26973,14,3714},{26977,5,14000},{26979,0,6317},
+{26980,5,14002},{26982,10,3718},{26985,5,14005},{26987,14,3721},
+{26991,5,14008},{26993,0,6300},{26994,9,14010},{26997,18,3725},
+{27002,5,14014},{27004,0,2636},{27005,9,14016},{27008,26,3730},
+{27015,5,6312},{27017,0,6315},{27018,9,14022},{27021,0,6331},
+{27022,21,14025},{27028,6,3737},{27030,5,14031},{27032,0,6308},
+{27033,5,14033},{27035,6,3739},{27037,37,14035},{27047,30,3741},
+{27055,5,14047},{27057,0,6325},{27058,5,14049},{27060,0,2618},
+{27061,5,14051},{27063,0,3217},{27064,9,14053},{27067,0,6321},
+{27068,9,14056},{27071,10,3749},{27074,29,14060},{27082,26,3752},
+{27089,9,14069},{27092,0,6324},{27093,21,14072},{27099,0,2154},
+{27100,9,14078},{27103,6,3759},{27105,21,14081},{27111,0,9340},
+{27112,17,14087},{27117,0,6334},{27118,13,14092},{27122,6,3761},
+{27124,33,14096},{27133,22,3763},{27139,5,14107},{27141,0,9324},
+{27142,13,14109},{27146,0,1611},{27147,29,14113},{27155,0,8254},
+{27156,9,14121},{27159,5,6335},{27161,0,7756},{27162,13,14124},
+{27166,22,3769},{27172,13,14130},{27176,10,3775},{27179,13,14135},
+{27183,10,3778},{27186,9,14140},{27189,0,6344},{27190,5,14143},
+{27192,10,3781},{27195,5,14145},{27197,6,3784},{27199,17,14147},
+{27204,0,6339},{27205,5,14152},{27207,6,3786},{27209,5,14154},
+{27211,0,8413},{27212,13,14156},{27216,0,6342},{27217,25,14160},
+{27224,14,3788},{27228,9,14168},{27231,14,3792},{27235,5,14172},
+{27237,0,6337},{27238,41,14174},{27249,0,1308},{27250,25,14185},
+{27257,0,6346},{27258,5,14192},{27260,0,6350},{27261,9,14194},
+{27264,0,3591},{27265,9,14197},{27268,0,3866},{27269,13,14200},
+{27273,0,9330},{27274,13,14204},{27278,14,3796},{27282,5,14209},
+{27284,0,7861},{27285,5,14211},{27287,0,6354},{27288,13,14213},
+{27292,0,9336},{27293,9,14217},{27296,14,3800},{27300,17,14221},
+{27305,14,3804},{27309,5,14227},{27311,0,9881},{27312,9,14229},
+{27315,0,9346},{27316,13,14232},{27320,0,8353},{27321,5,14236},
+{27323,0,8082},{27324,25,14238},{27331,0,7992},{27332,57,14245},
+{27347,0,9349},{27348,21,14260},{27354,22,3808},{27360,25,14267},
+{27367,22,3814},{27373,21,14276},{27379,0,9327},{27380,13,14282},
+{27384,0,9345},{27385,5,14286},{27387,0,8736},{27388,29,14288},
+{27396,0,8181},{27397,17,14296},{27402,0,8436},{27403,13,14301},
+{27407,0,9341},{27408,5,14305},{27410,0,9337},{27411,9,14307},
+{27414,0,9342},{27415,25,14310},{27422,26,3820},{27429,5,14318},
+{27431,0,2936},{27432,37,14320},{27442,0,4320},{27443,13,14330},
+{27447,14,3827},{27451,5,14335},{27453,6,3831},{27455,13,14337},
+{27459,0,6580},{27460,5,14341},{27462,14,3833},{27466,5,14344},
+{27468,0,1763},{27469,9,14346},{27472,0,8365},{27473,29,14349},
+{27481,0,6582},{27482,17,14357},{27487,34,3837},{27496,5,14363},
+{27498,0,3730},{27499,25,14365},{27506,0,8537},{27507,13,14372},
+{27511,22,3846},{27517,13,14377},{27521,5,6358},{27523,42,3852},
+{27534,13,14384},{27538,5,6362},{27540,5,14388},{27542,14,3863},
+{27546,5,6365},{27548,5,14392},{27550,0,9352},{27551,5,14394},
+{27553,0,6367},{27554,5,14396},{27556,0,9351},{27557,17,14398},
+{27562,6,3867},{27564,5,14403},{27566,6,3869},{27568,5,14405},
+{27570,22,3871},{27576,5,14408},{27578,6,3877},{27580,9,14410},
+{27583,14,3879},{27587,5,14414},{27589,6,3883},{27591,13,14416},
+{27595,18,3885},{27600,5,14422},{27602,38,3890},{27612,17,14426},
+{27617,0,4434},{27618,29,14431},{27626,6,3900},{27628,9,14439},
+{27631,0,3597},{27632,9,14442},{27635,10,3902},{27638,9,14446},
+{27641,0,6488},{27642,9,14449},{27645,10,3905},{27648,17,14453},
+{27653,14,3908},{27657,9,14458},{27660,46,3912},{27672,9,6494},
+{27675,0,1650},{27676,9,14464},{27679,90,3924},{27702,5,14472},
+{27704,0,4261},{27705,13,14474},{27709,0,4847},{27710,5,14478},
+{27712,10,3947},{27715,9,14480},{27718,18,3950},{27723,17,14484},
+{27728,0,3864},{27729,9,14489},{27732,14,3955},{27736,9,14493},
+{27739,26,3959},{27746,5,14496},{27748,0,3603},{27749,9,14498},
+{27752,5,5800},{27754,0,3749},{27755,17,14501},{27760,26,3966},
+{27767,5,14509},{27769,0,4005},{27770,9,14511},{27773,6,3973},
+{27775,5,14514},{27777,34,3975},{27786,5,14518},{27788,0,5799},
+{27789,5,14520},{27791,6,3984},{27793,5,14522},{27795,6,3986},
+{27797,13,14524},{27801,10,3988},{27804,9,14529},{27807,62,3991},
+{27823,5,14536},{27825,10,4007},{27828,13,14538},{27832,30,4010},
+{27840,13,14543},{27844,6,4018},{27846,9,14547},{27849,14,4020},
+{27853,9,14551},{27856,0,5806},{27857,5,14554},{27859,18,4024},
+{27864,9,14556},{27867,0,1623},{27868,5,14559},{27870,30,4029},
+{27878,5,14563},{27880,14,4037},{27884,5,14566},{27886,34,4041},
+{27895,5,5809},{27897,34,4050},{27906,5,14573},{27908,0,5829},
+{27909,5,14575},{27911,0,5828},{27912,9,14577},{27915,14,4059},
+{27919,9,14581},{27922,0,3282},{27923,13,14584},{27927,18,4063},
+{27932,5,14589},{27934,0,1523},{27935,21,14591},{27941,10,4068},
+{27944,5,14598},{27946,6,4071},{27948,5,14600},{27950,0,5834},
+{27951,5,14602},{27953,18,4073},{27958,9,14605},{27961,22,4078},
+{27967,5,14609},{27969,78,4084},{27989,13,14616},{27993,30,4104},
+{28001,5,14623},{28003,0,5851},{28004,5,14625},{28006,0,3061},
+{28007,5,14627},{28009,6,4112},{28011,9,14629},{28014,6,4114},
+{28016,13,14632},{28020,0,4324},{28021,5,14636},{28023,10,4116},
+{28026,5,14638},{28028,0,5850},{28029,17,14640},{28034,0,3696},
+{28035,5,14645},{28037,18,4119},{28042,5,14648},{28044,10,4124},
+{28047,5,14651},{28049,6,4127},{28051,5,5846},{28053,0,3644},
+{28054,17,14654},{28059,66,4129},{28076,5,14662},{28078,6,4146},
+{28080,5,14664},{28082,0,4161},{28083,5,14666},{28085,0,1892},
+{28086,5,14668},{28088,0,1931},{28089,21,14670},{28095,6,4148},
+{28097,9,14676},{28100,14,4150},{28104,9,14679},{28107,6,4154},
+{28109,13,14682},{28113,0,3454},{28114,13,14686},{28118,14,4156},
+{28122,9,14691},{28125,18,4160},{28130,5,14695},{28132,10,4165},
+{28135,9,14698},{28138,18,4168},{28143,5,14702},{28145,46,4173},
+{28157,29,14707},{28165,0,3170},{28166,13,14715},{28170,30,4185},
+{28178,5,14721},{28180,14,4193},{28184,5,14724},{28186,0,5852},
+{28187,5,14726},{28189,0,4298},{28190,5,14728},{28192,26,4197},
+{28199,5,14731},{28201,26,4204},{28208,5,14735},{28210,10,4211},
+{28213,9,14738},{28216,10,4214},{28219,9,14742},{28222,0,8035},
+{28223,13,14745},{28227,6,4217},{28229,29,14749},{28237,6,4219},
+{28239,13,14757},{28243,5,5874},{28245,14,4221},{28249,5,14763},
+{28251,0,4448},{28252,5,14765},{28254,6,4225},{28256,41,14767},
+{28267,0,5870},{28268,5,14778},{28270,6,4227},{28272,53,14780},
+{28286,6,4229},{28288,9,14794},{28291,14,4231},{28295,5,14798},
+{28297,0,1731},{28298,17,14800},{28303,6,4235},{28305,17,14805},
+{28310,10,4237},{28313,9,14811},{28316,14,4240},{28320,5,14815},
+{28322,0,4206},{28323,5,14817},{28325,10,4244},{28328,5,14820},
+{28330,0,3863},{28331,13,14822},{28335,34,4247},{28344,5,14829},
+{28346,14,4256},{28350,9,14832},{28353,26,4260},{28360,9,14837},
+{28363,50,4267},{28376,5,14844},{28378,0,1871},{28379,9,14846},
+{28382,46,4280},{28394,5,14851},{28396,0,8011},{28397,5,14853},
+{28399,0,8850},{28400,5,14855},{28402,10,4292},{28405,5,14858},
+{28407,10,4295},{28410,17,14860},{28415,14,4298},{28419,9,14866},
+{28422,0,3072},{28423,5,14869},{28425,0,5907},{28426,17,14871},
+{28431,0,2640},{28432,9,14876},{28435,10,4302},{28438,13,14879},
+{28442,0,8369},{28443,17,14883},{28448,18,4305},{28453,13,14889},
+{28457,42,4310},{28468,5,14895},{28470,10,4321},{28473,17,14898},
+{28478,14,4324},{28482,13,14904},{28486,5,5897},{28488,9,14908},
+{28491,10,4328},{28494,9,14912},{28497,0,8382},{28498,5,14915},
+{28500,0,8116},{28501,9,14917},{28504,6,4331},{28506,5,14920},
+{28508,10,4333},{28511,9,14923},{28514,18,4336},{28519,21,14928},
+{28525,30,4341},{28533,5,14936},{28535,22,4349},{28541,5,14940},
+{28543,6,4355},{28545,9,14942},{28548,22,4357},{28554,5,14946},
+{28556,10,4363},{28559,29,14948},{28567,0,8093},{28568,13,14956},
+{28572,0,2472},{28573,9,14960},{28576,6,4366},{28578,5,14963},
+{28580,0,8804},{28581,5,14965},{28583,10,4368},{28586,13,14968},
+{28590,0,9182},{28591,5,14972},{28593,10,4371},{28596,5,14975},
+{28598,0,5920},{28599,5,14977},{28601,0,5919},{28602,21,14979},
+{28608,14,4374},{28612,17,14985},{28617,0,5917},{28618,25,14990},
+{28625,6,4378},{28627,5,14997},{28629,0,8491},{28630,5,14999},
+{28632,0,8357},{28633,5,15001},{28635,0,9867},{28636,5,15003},
+{28638,14,4380},{28642,5,15005},{28644,0,8557},{28645,21,15007},
+{28651,0,8193},{28652,5,15013},{28654,14,4384},{28658,29,15015},
+{28666,22,4388},{28672,17,15026},{28677,6,4394},{28679,5,15031},
+{28681,10,4396},{28684,9,15034},{28687,10,4399},{28690,9,15038},
+{28693,0,7759},{28694,5,15041},{28696,34,4402},{28705,5,15046},
+{28707,0,5928},{28708,9,15048},{28711,6,4411},{28713,25,15051},
+{28720,10,4413},{28723,5,15059},{28725,0,5931},{28726,9,15061},
+{28729,0,5930},{28730,13,15064},{28734,0,8186},{28735,13,15068},
+{28739,6,4416},{28741,25,15072},{28748,0,1849},{28749,5,15079},
+{28751,10,4418},{28754,9,15082},{28757,0,8203},{28758,5,15085},
+{28760,0,8550},{28761,13,15087},{28765,6,4421},{28767,13,15091},
+{28771,6,4423},{28773,5,15095},{28775,0,9191},{28776,9,15097},
+{28779,22,4425},{28785,13,15101},{28789,14,4431},{28793,9,15106},
+{28796,18,4435},{28801,13,15110},{28805,0,6419},{28806,9,15114},
+{28809,6,4440},{28811,9,15117},{28814,0,4096},{28815,9,15120},
+{28818,18,4442},{28823,5,15124},{28825,0,4554},{28826,5,15126},
+{28828,6,4447},{28830,49,15128},{28843,34,4449},{28852,9,15143},
+{28855,26,4458},{28862,5,15147},{28864,14,4465},{28868,13,15149},
+{28872,10,4469},{28875,13,15154},{28879,0,8611},{28880,29,15158},
+{28888,14,4472},{28892,9,15167},{28895,0,4085},{28896,13,15170},
+{28900,46,4476},{28912,13,15177},{28916,0,8570},{28917,5,15181},
+{28919,10,4488},{28922,9,15184},{28925,0,1670},{28926,41,15187},
+{28937,6,4491},{28939,17,15198},{28944,0,6615},{28945,5,15203},
+{28947,30,4493},{28955,21,15207},{28961,0,8613},{28962,13,15213},
+{28966,0,2186},{28967,29,15217},{28975,10,4501},{28978,13,15225},
+{28982,0,3222},{28983,53,15229},{28997,0,6623},{28998,9,15243},
+{29001,22,4504},{29007,9,15248},{29010,0,9430},{29011,33,15251},
+{29020,10,4510},{29023,9,15261},{29026,30,4513},{29034,5,15266},
+{29036,10,4521},{29039,9,15269},{29042,6,4524},{29044,13,15272},
+{29048,10,4526},{29051,5,15277},{29053,0,3320},{29054,21,15279},
+{29060,0,3861},{29061,17,15285},{29066,0,4007},{29067,13,15290},
+{29071,0,4053},{29072,5,15294},{29074,10,4529},{29077,5,15297},
+{29079,10,4532},{29082,17,15299},{29087,6,4535},{29089,25,15304},
+{29096,0,6631},{29097,9,15311},{29100,0,969},{29101,13,15314},
+{29105,18,4537},{29110,9,15320},{29113,0,6642},{29114,13,15323},
+{29118,0,7815},{29119,5,15327},{29121,10,4542},{29124,13,15330},
+{29128,0,7866},{29129,17,15334},{29134,0,2576},{29135,9,15339},
+{29138,14,4545},{29142,9,15343},{29145,0,8556},{29146,5,15346},
+{29148,0,9433},{29149,5,15348},{29151,6,4549},{29153,13,15350},
+{29157,10,4551},{29160,17,15354},{29165,6,4554},{29167,17,15359},
+{29172,0,8029},{29173,13,15364},{29177,0,6636},{29178,5,15368},
+{29180,14,4556},{29184,21,15372},{29190,0,1045},{29191,21,15378},
+{29197,0,8521},{29198,5,15384},{29200,0,8262},{29201,37,15386},
+{29211,10,4560},{29214,37,15397},{29224,18,4563},{29229,9,15409},
+{29232,10,4568},{29235,5,15412},{29237,42,4571},{29248,25,15415},
+{29255,6,4582},{29257,9,15422},{29260,6,4584},{29262,13,15425},
+{29266,0,6506},{29267,9,15429},{29270,50,4586},{29283,9,15437},
+{29286,14,4599},{29290,13,15441},{29294,6,4603},{29296,5,15445},
+{29298,0,3381},{29299,5,15447},{29301,0,3104},{29302,9,15449},
+{29305,6,4605},{29307,5,15452},{29309,0,8396},{29310,5,6471},
+{29312,6,4607},{29314,5,15454},{29316,0,6473},{29317,17,15456},
+{29322,22,4609},{29328,5,15463},{29330,0,6477},{29331,9,15465},
+{29334,0,9024},{29335,29,15468},{29343,0,6467},{29344,5,15476},
+{29346,0,7889},{29347,13,15478},{29351,0,8620},{29352,13,15482},
+{29356,18,4615},{29361,9,15487},{29364,10,4620},{29367,5,5618},
+{29369,0,4273},{29370,21,15491},{29376,18,4623},{29381,9,15497},
+{29384,0,1056},{29385,13,15500},{29389,22,4628},{29395,13,15506},
+{29399,10,4634},{29402,13,15511},{29406,14,4637},{29410,21,15516},
+{29416,6,4641},{29418,5,15522},{29420,34,4643},{29429,5,15524},
+{29431,10,4652},{29434,5,5634},{29436,6,4655},{29438,9,15526},
+{29441,10,4657},{29444,21,15530},{29450,0,5639},{29451,9,15536},
+{29454,0,2589},{29455,13,15539},{29459,18,4660},{29464,9,15544},
+{29467,14,4665},{29471,5,15547},{29473,6,4669},{29475,5,15549},
+{29477,0,5645},{29478,9,15551},{29481,22,4671},{29487,5,15555},
+{29489,0,5648},{29490,5,15557},{29492,30,4677},{29500,5,15561},
+{29502,14,4685},{29506,5,15564},{29508,6,4689},{29510,25,15566},
+{29517,0,5650},{29518,5,15573},{29520,10,4691},{29523,13,15576},
+{29527,0,5651},{29528,29,15580},{29536,0,5652},{29537,25,15588},
+{29544,42,4694},{29555,5,15598},{29557,46,4705},{29569,9,15604},
+{29572,0,4041},{29573,5,15607},{29575,18,4717},{29580,5,15611},
+{29582,0,6168},{29583,5,15613},{29585,0,6169},{29586,13,15615},
+{29590,0,2288},{29591,13,15619},{29595,0,2705},{29596,9,15623},
+{29599,0,6172},{29600,5,15626},{29602,0,6171},{29603,21,15628},
+{29609,10,4722},{29612,5,15635},{29614,22,4725},{29620,9,15638},
+{29623,0,6176},{29624,5,15641},{29626,6,4731},{29628,13,15643},
+{29632,10,4733},{29635,17,15648},{29640,10,4736},{29643,5,15653},
+{29645,18,4739},{29650,25,15656},{29657,0,6182},{29658,13,15663},
+{29662,10,4744},{29665,13,15668},{29669,18,4747},{29674,9,15674},
+{29677,0,1003},{29678,13,15677},{29682,0,6189},{29683,41,15681},
+{29694,6,4752},{29696,9,15693},{29699,14,4754},{29703,5,15697},
+{29705,6,4758},{29707,13,15699},{29711,6,4760},{29713,33,15703},
+{29722,6,4762},{29724,21,15712},{29730,0,4638},{29731,5,15718},
+{29733,46,4764},{29745,5,15725},{29747,14,4776},{29751,17,15727},
+{29756,0,3178},{29757,5,15732},{29759,10,4780},{29762,33,15735},
+{29771,0,9308},{29772,33,15744},{29781,42,4783},{29792,9,15756},
+{29795,0,8541},{29796,17,15759},{29801,6,4794},{29803,5,15764},
+{29805,0,6207},{29806,5,15766},{29808,0,1854},{29809,17,15768},
+{29814,6,4796},{29816,21,15773},{29822,6,4798},{29824,5,6211},
+{29826,6,4800},{29828,9,15781},{29831,18,4802},{29836,5,15786},
+{29838,10,4807},{29841,41,15789},{29852,10,4810},{29855,13,15801},
+{29859,0,9307},{29860,5,15805},{29862,6,4813},{29864,5,6216},
+{29866,21,15807},{29872,0,8020},{29873,33,15813},{29882,0,6221},
+{29883,5,15822},{29885,0,9311},{29886,45,15824},{29898,0,8428},
+{29899,13,15836},{29903,0,9309},{29904,5,15840},{29906,10,4815},
+{29909,17,15843},{29914,50,4818},{29927,25,15853},{29934,6,4831},
+{29936,13,15860},{29940,14,4833},{29944,25,15865},{29951,0,6405},
+{29952,13,15872},{29956,0,4488},{29957,25,15876},{29964,30,4837},
+{29972,13,15886},{29976,18,4845},{29981,5,15891},{29983,0,3379},
+{29984,9,15893},{29987,10,4850},{29990,5,15897},{29992,78,4853},
+{30012,5,15904},{30014,10,4873},{30017,13,15907},{30021,0,1230},
+{30022,5,15911},{30024,0,6780},{30025,5,15913},{30027,18,4876},
+{30032,13,15916},{30036,0,2960},{30037,13,15920},{30041,18,4881},
+{30046,13,15924},{30050,0,7746},{30051,5,15928},{30053,6,4886},
+{30055,9,15930},{30058,6,4888},{30060,21,15933},{30066,30,4890},
+{30074,17,15942},{30079,0,6164},{30080,9,15947},{30083,0,6784},
+{30084,5,15950},{30086,6,4898},{30088,9,15952},{30091,0,7110},
+{30092,9,15955},{30095,46,4900},{30107,5,15962},{30109,34,4912},
+{30118,17,15966},{30123,30,4921},{30131,5,7015},{30133,0,1350},
+{30134,5,15972},{30136,6,4929},{30138,5,15974},{30140,10,4931},
+{30143,9,15976},{30146,34,4934},{30155,5,15980},{30157,0,7024},
+{30158,13,15982},{30162,38,4943},{30172,5,15989},{30174,0,3013},
+{30175,9,15991},{30178,38,4953},{30188,13,15996},{30192,6,4963},
+{30194,5,16000},{30196,0,1274},{30197,13,16002},{30201,0,1085},
+{30202,5,16006},{30204,0,7033},{30205,5,16008},{30207,26,4965},
+{30214,13,16011},{30218,14,4972},{30222,5,16015},{30224,0,7035},
+{30225,13,16017},{30229,26,4976},{30236,5,16023},{30238,62,4983},
+{30254,5,16028},{30256,0,7051},{30257,5,16030},{30259,10,4999},
+{30262,5,16032},{30264,0,3214},{30265,5,16034},{30267,34,5002},
+{30276,5,16038},{30278,5,9647},{30280,6,5011},{30282,5,16041},
+{30284,6,5013},{30286,21,16043},{30292,18,5015},{30297,9,16051},
+{30300,14,5020},{30304,5,16055},{30306,42,5024},{30317,5,9652},
+{30319,14,5035},{30323,17,16060},{30328,0,1864},{30329,5,16065},
+{30331,14,5039},{30335,9,16067},{30338,26,5043},{30345,5,16072},
+{30347,0,1753},{30348,5,16074},{30350,0,6958},{30351,5,16076},
+{30353,10,5050},{30356,5,16079},{30358,0,3743},{30359,5,16081},
+{30361,6,5053},{30363,33,16083},{30372,0,6961},{30373,33,16092},
+{30382,0,3011},{30383,5,16101},{30385,14,5055},{30389,9,16104},
+{30392,10,5059},{30395,13,16108},{30399,0,2808},{30400,5,16112},
+{30402,0,4288},{30403,5,16114},{30405,22,5062},{30411,5,16118},
+{30413,46,5068},{30425,5,16122},{30427,0,3385},{30428,5,16124},
+{30430,38,5080},{30440,21,16129},{30446,26,5090},{30453,9,16137},
+{30456,6,5097},{30458,5,16140},{30460,22,5099},{30466,5,16145},
+{30468,0,6745},{30469,5,16147},{30471,5,6748},{30473,18,5105},
+{30478,41,16151},{30489,6,5110},{30491,13,16162},{30495,14,5112},
+{30499,9,16167},{30502,14,5116},{30506,9,16171},{30509,10,5120},
+{30512,17,16175},{30517,30,5123},{30525,9,16182},{30528,14,5131},
+{30532,9,16186},{30535,0,6759},{30536,25,16189},{30543,0,9860},
+{30544,5,6757},{30546,29,16196},{30554,6,5135},{30556,5,16204},
+{30558,0,9455},{30559,5,16206},{30561,30,5137},{30569,5,16210},
+{30571,6,5145},{30573,45,16212},{30585,0,1538},{30586,9,16224},
+{30589,14,5147},{30593,9,16227},{30596,6,5151},{30598,21,16230},
+{30604,10,5153},{30607,5,16236},{30609,6,5156},{30611,17,16238},
+{30616,0,9454},{30617,17,16243},{30622,0,8308},{30623,5,6771},
+{30625,6,5158},{30627,5,16249},{30629,34,5160},{30638,5,16254},
+{30640,0,6773},{30641,5,16256},{30643,10,5169},{30646,17,16259},
+{30651,18,5172},{30656,25,16265},{30663,0,9869},{30664,17,16272},
+{30669,0,5015},{30670,33,16277},{30679,0,1318},{30680,5,16286},
+{30682,10,5177},{30685,17,16288},{30690,54,5180},{30704,9,16297},
+{30707,0,3398},{30708,5,16300},{30710,10,5194},{30713,13,16303},
+{30717,22,5197},{30723,21,16307},{30729,0,6693},{30730,5,16313},
+{30732,6,5203},{30734,9,16315},{30737,22,5205},{30743,5,6694},
+{30745,10,5211},{30748,5,6699},{30750,6,5214},{30752,9,16323},
+{30755,26,5216},{30762,5,16328},{30764,6,5223},{30766,5,16330},
+{30768,0,2986},{30769,9,16332},{30772,0,3045},{30773,5,16335},
+{30775,6,5225},{30777,9,6701},{30780,18,5227},{30785,5,16339},
+{30787,18,5232},{30792,13,16343},{30796,26,5237},{30803,5,16350},
+{30805,0,3499},{30806,5,6712},{30808,17,16352},{30813,0,3938},
+{30814,21,16357},{30820,0,9449},{30821,9,16363},{30824,30,5244},
+{30832,25,16367},{30839,0,2146},{30840,13,16374},{30844,0,2993},
+{30845,37,16378},{30855,10,5252},{30858,5,16389},{30860,10,5255},
+{30863,5,16391},{30865,10,5258},{30868,9,16394},{30871,22,5261},
+{30877,5,16398},{30879,42,5267},{30890,9,16405},{30893,0,9444},
+{30894,5,16408},{30896,18,5278},{30901,9,16410},{30904,26,5283},
+{30911,5,16415},{30913,0,1352},{30914,9,16417},{30917,0,1024},
+{30918,9,16420},{30921,10,5290},{30924,13,16423},{30928,0,2958},
+{30929,9,16427},{30932,6,5293},{30934,9,16430},{30937,6,5295},
+{30939,29,16433},{30947,0,9452},{30948,9,16441},{30951,6,5297},
+{30953,9,16444},{30956,0,6732},{30957,5,16447},{30959,0,9443},
+{30960,5,16449},{30962,10,5299},{30965,5,16452},{30967,0,2592},
+{30968,5,16454},{30970,0,2012},{30971,5,16456},{30973,0,9450},
+{30974,9,16458},{30977,0,2185},{30978,9,16461},{30981,0,6734},
+{30982,29,16464},{30990,0,7826},{30991,13,16472},{30995,0,6736},
+{30996,17,16476},{31001,0,7719},{31002,13,16481},{31006,0,6738},
+{31007,17,16485},{31012,10,5302},{31015,9,16491},{31018,10,5305},
+{31021,13,16494},{31025,0,9448},{31026,5,16498},{31028,0,6739},
+{31029,17,16500},{31034,30,5308},{31042,13,16507},{31046,14,5316},
+{31050,33,16512},{31059,0,6654},{31060,5,16521},{31062,6,5320},
+{31064,5,16523},{31066,0,6655},{31067,5,6652},{31069,22,5322},
+{31075,5,16526},{31077,14,5328},{31081,13,16529},{31085,10,5332},
+{31088,25,16534},{31095,14,5335},{31099,17,16542},{31104,6,5339},
+{31106,5,16547},{31108,6,5341},{31110,13,16549},{31114,0,6663},
+{31115,5,16553},{31117,10,5343},{31120,37,16555},{31130,0,6664},
+{31131,41,16565},{31142,6,5346},{31144,5,16576},{31146,0,9437},
+{31147,9,16578},{31150,22,5348},{31156,17,16583},{31161,42,5354},
+{31172,5,16591},{31174,0,1740},{31175,5,16593},{31177,18,5365},
+{31182,9,16597},{31185,6,5370},{31187,5,16600},{31189,0,6941},
+{31190,5,16602},{31192,0,2781},{31193,21,16604},{31199,0,4671},
+{31200,9,16610},{31203,54,5372},{31217,25,16618},{31224,0,2214},
+{31225,5,16625},{31227,10,5386},{31230,5,16628},{31232,14,5389},
+{31236,5,16631},{31238,0,6945},{31239,13,16633},{31243,14,5393},
+{31247,17,16638},{31252,0,6950},{31253,5,16643},{31255,0,1001},
+{31256,5,16645},{31258,0,4552},{31259,9,16647},{31262,10,5397},
+{31265,5,16651},{31267,0,7567},{31268,37,16653},{31278,0,8853},
+{31279,5,16663},{31281,10,5400},{31284,9,16666},{31287,38,5403},
+{31297,17,16672},{31302,0,2853},{31303,17,16677},{31308,10,5413},
+{31311,5,16682},{31313,0,6953},{31314,17,16684},{31319,0,3552},
+{31320,33,16689},{31329,6,5416},{31331,21,16698},{31337,10,5418},
+{31340,13,16705},{31344,0,6956},{31345,9,16709},{31348,14,5421},
+{31352,5,7066},{31354,0,2402},{31355,13,16713},{31359,38,5425},
+{31369,13,16720},{31373,0,3148},{31374,9,16724},{31377,6,5435},
+{31379,5,16727},{31381,14,5437},{31385,9,16729},{31388,18,5441},
+{31393,13,16733},{31397,38,5446},{31407,13,16739},{31411,0,7077},
+{31412,5,16743},{31414,0,9657},{31415,9,16745},{31418,0,8170},
+{31419,13,16748},{31423,0,2631},{31424,13,16752},{31428,30,5456},
+{31436,37,16758},{31446,0,3473},{31447,5,16768},{31449,0,4447},
+{31450,13,16770},{31454,10,5464},{31457,5,16774},{31459,14,5467},
+{31463,9,16777},{31466,0,8513},{31467,5,16780},{31469,10,5471},
+{31472,21,16783},{31478,0,8135},{31479,5,16789},{31481,6,5474},
+{31483,5,16791},{31485,10,5476},{31488,9,16794},{31491,5,7270},
+{31493,26,5479},{31500,9,16800},{31503,10,5486},{31506,5,16804},
+{31508,6,5489},{31510,9,16806},{31513,10,5491},{31516,5,16810},
+{31518,10,5494},{31521,9,16813},{31524,42,5497},{31535,5,16819},
+{31537,10,5508},{31540,13,16822},{31544,26,5511},{31551,21,16829},
+{31557,30,5518},{31565,5,16837},{31567,58,5526},{31582,5,16844},
+{31584,10,5541},{31587,13,16847},{31591,0,9700},{31592,21,16851},
+{31598,0,7295},{31599,5,16857},{31601,6,5544},{31603,5,16859},
+{31605,26,5546},{31612,5,16864},{31614,10,5553},{31617,13,16867},
+{31621,0,7307},{31622,17,16871},{31627,10,5556},{31630,5,16877},
+{31632,0,7300},{31633,9,16879},{31636,14,5559},{31640,13,16883},
+{31644,6,5563},{31646,9,16887},{31649,6,5565},{31651,9,16890},
+{31654,5,7301},{31656,22,5567},{31662,9,16893},{31665,0,3921},
+{31666,5,16896},{31668,0,7312},{31669,9,16898},{31672,0,7303},
+{31673,25,16901},{31680,6,5573},{31682,5,16908},{31684,34,5575},
+{31693,13,16913},{31697,10,5584},{31700,17,16918},{31705,6,5587},
+{31707,5,16923},{31709,0,7316},{31710,9,16925},{31713,0,1374},
+{31714,5,16928},{31716,0,9699},{31717,5,7318},{31719,5,16930},
+{31721,6,5589},{31723,9,16932},{31726,0,2469},{31727,5,16935},
+{31729,10,5591},{31732,9,16938},{31735,0,2994},{31736,13,16941},
+{31740,18,5594},{31745,21,16947},{31751,0,1371},{31752,9,16953},
+{31755,18,5599},{31760,21,16957},{31766,0,7325},{31767,25,16963},
+{31774,22,5604},{31780,5,16972},{31782,6,5610},{31784,5,16974},
+{31786,6,5612},{31788,45,16976},{31800,0,7330},{31801,13,16988},
+{31805,26,5614},{31812,29,16993},{31820,6,5621},{31822,53,17001},
+{31836,0,9705},{31837,5,17015},{31839,6,5623},{31841,9,17017},
+{31844,0,9875},{31845,13,17020},{31849,22,5625},{31855,9,17026},
+{31858,10,5631},{31861,21,17029},{31867,10,5634},{31870,41,17035},
+{31881,0,1656},{31882,25,17046},{31889,6,5637},{31891,5,17053},
+{31893,14,5639},{31897,9,17056},{31900,14,5643},{31904,5,17059},
+{31906,14,5647},{31910,13,17062},{31914,0,1661},{31915,9,17066},
+{31918,0,2561},{31919,5,17069},{31921,10,5651},{31924,17,17071},
+{31929,0,1381},{31930,5,17076},{31932,5,7378},{31934,0,2266},
+{31935,5,17078},{31937,0,7380},{31938,9,17080},{31941,26,5654},
+{31948,5,7382},{31950,25,17086},{31957,18,5661},{31962,5,17094},
+{31964,18,5666},{31969,21,17096},{31975,6,5671},{31977,21,17102},
+{31983,50,5673},{31996,5,17113},{31998,34,5686},{32007,5,9246},
+{32009,18,5695},{32014,5,17119},{32016,0,8359},{32017,5,17121},
+{32019,38,5700},{32029,9,17125},{32032,10,5710},{32035,13,17128},
+{32039,0,2245},{32040,9,17132},{32043,0,4652},{32044,9,17135},
+{32047,18,5713},{32052,17,17138},{32057,14,5718},{32061,5,17144},
+{32063,30,5722},{32071,25,17149},{32078,10,5730},{32081,45,17157},
+{32093,6,5733},{32095,5,17169},{32097,6,5735},{32099,9,17171},
+{32102,10,5737},{32105,17,17175},{32110,0,4032},{32111,5,17180},
+{32113,10,5740},{32116,5,17182},{32118,14,5743},{32122,25,17185},
+{32129,10,5747},{32132,5,17193},{32134,14,5750},{32138,17,17196},
+{32143,0,8536},{32144,9,17201},{32147,0,8130},{32148,29,17204},
+{32156,10,5754},{32159,9,17213},{32162,6,5757},{32164,5,17216},
+{32166,0,7401},{32167,13,17218},{32171,38,5759},{32181,9,17223},
+{32184,30,5769},{32192,13,17227},{32196,0,9269},{32197,5,17231},
+{32199,0,9275},{32200,5,17233},{32202,6,5777},{32204,17,17235},
+{32209,14,5779},{32213,5,17241},{32215,10,5783},{32218,9,17243},
+{32221,26,5786},{32228,5,17248},{32230,14,5793},{32234,5,17251},
+{32236,0,8326},{32237,5,17253},{32239,30,5797},{32247,5,17258},
+{32249,10,5805},{32252,45,17261},{32264,14,5808},{32268,13,17273},
+{32272,6,5812},{32274,33,17277},{32283,18,5814},{32288,9,17287},
+{32291,0,8642},{32292,9,17290},{32295,0,8558},{32296,9,17293},
+{32299,14,5819},{32303,5,17297},{32305,54,5823},{32319,5,17303},
+{32321,0,1614},{32322,9,17305},{32325,10,5837},{32328,37,17308},
+{32338,14,5840},{32342,13,17319},{32346,0,9300},{32347,9,17323},
+{32350,0,8443},{32351,9,17326},{32354,0,9280},{32355,21,17329},
+{32361,30,5844},{32369,5,17336},{32371,0,8110},{32372,17,17338},
+{32377,0,8730},{32378,5,17343},{32380,10,5852},{32383,9,17345},
+{32386,0,4680},{32387,17,17348},{32392,30,5855},{32400,9,17356},
+{32403,22,5863},{32409,5,17361},{32411,6,5869},{32413,5,17363},
+{32415,34,5871},{32424,5,6103},{32426,66,5880},{32443,5,17367},
+{32445,10,5897},{32448,9,6108},{32451,30,5900},{32459,5,6112},
+{32461,74,5908},{32480,5,6118},{32482,46,5927},{32494,5,6122},
+{32496,0,1349},{32497,5,6124},{32499,26,5939},{32506,5,6128},
+{32508,18,5946},{32513,9,6131},{32516,10,5951},{32519,5,6134},
+{32521,6,5954},{32523,5,6136},{32525,14,5956},{32529,5,6139},
+{32531,54,5960},{32545,25,6146},{32552,6,5974},{32554,13,6153},
+{32558,0,3330},{32559,17,6157},{32564,26,5976},{32571,25,17378},
+{32578,6,5983},{32580,5,7264},{32582,21,17386},{32588,22,5985},
+{32594,5,17394},{32596,26,5991},{32603,13,17398},{32607,14,5998},
+{32611,17,17403},{32616,10,6002},{32619,9,17408},{32622,26,6005},
+{32629,5,17413},{32631,10,6012},{32634,13,17416},{32638,0,6794},
+{32639,5,17420},{32641,0,6793},{32642,9,17422},{32645,38,6015},
+{32655,17,17429},{32660,0,1756},{32661,17,17434},{32666,0,2608},
+{32667,5,17439},{32669,18,6025},{32674,5,17442},{32676,22,6030},
+{32682,17,17446},{32687,5,7367},{32689,6,6036},{32691,17,17452},
+{32696,6,6038},{32698,5,17457},{32700,22,6040},{32706,9,17461},
+{32709,0,1286},{32710,13,17464},{32714,18,6046},{32719,9,17470},
+{32722,14,6051},{32726,5,17474},{32728,0,3145},{32729,21,17476},
+{32735,10,6055},{32738,9,17482},{32741,6,6058},{32743,5,17485},
+{32745,0,7396},{32746,13,17487},{32750,22,6060},{32756,17,17493},
+{32761,14,6066},{32765,9,17499},{32768,26,6070},{32775,13,17503},
+{32779,10,6077},{32782,5,17507},{32784,38,6080},{32794,5,17511},
+{32796,0,7118},{32797,9,17513},{32800,10,6090},{32803,5,17517},
+{32805,9,7121},{32808,26,6093},{32815,5,17521},{32817,30,6100},
+{32825,5,17525},{32827,18,6108},{32832,5,17529},{32834,6,6113},
+{32836,5,17531},{32838,0,7130},{32839,9,17533},{32842,14,6115},
+{32846,13,17536},{32850,34,6119},{32859,9,17544},{32862,0,8601},
+{32863,37,17547},{32873,6,6128},{32875,13,17557},{32879,42,6130},
+{32890,9,17563},{32893,14,6141},{32897,5,17566},{32899,38,6145},
+{32909,21,17570},{32915,0,6513},{32916,5,17576},{32918,62,6155},
+{32934,9,17582},{32937,46,6171},{32949,5,17588},{32951,0,6521},
+{32952,5,17590},{32954,50,6183},{32967,17,17594},{32972,10,6196},
+{32975,25,17599},{32982,34,6199},{32991,5,17607},{32993,0,1969},
+{32994,5,17609},{32996,10,6208},{32999,13,6522},{33003,74,6211},
+{33022,13,17617},{33026,0,4523},{33027,5,17621},{33029,6,6230},
+{33031,5,17623},{33033,6,6232},{33035,5,17625},{33037,5,6538},
+{33039,50,6234},{33052,5,17630},{33054,0,6546},{33055,49,17632},
+{33068,0,6547},{33069,5,17645},{33071,14,6247},{33075,9,17648},
+{33078,14,6251},{33082,13,17652},{33086,0,3009},{33087,25,17656},
+{33094,66,6255},{33111,5,17668},{33113,5,6554},{33115,17,17670},
+{33120,6,6272},{33122,9,17675},{33125,50,6274},{33138,5,17682},
+{33140,0,6553},{33141,9,17684},{33144,14,6287},{33148,5,6559},
+{33150,18,6291},{33155,17,17688},{33160,10,6296},{33163,13,17694},
+{33167,10,6299},{33170,21,17699},{33176,22,6302},{33182,5,17706},
+{33184,0,8101},{33185,5,17708},{33187,0,6569},{33188,5,17710},
+{33190,18,6308},{33195,29,17713},{33203,0,3326},{33204,21,17721},
+{33210,38,6313},{33220,5,17728},{33222,0,4195},{33223,5,17730},
+{33225,26,6323},{33232,29,17734},{33240,10,6330},{33243,13,17743},
+{33247,6,6333},{33249,5,17747},{33251,0,1249},{33252,9,17749},
+{33255,26,6335},{33262,17,17754},{33267,5,4544},{33269,17,17759},
+{33274,26,6342},{33281,5,7334},{33283,34,6349},{33292,5,3353},
+{33294,5,17768},{33296,18,6358},{33301,21,17772},{33307,22,6363},
+{33313,9,7339},{33316,13,17780},{33320,42,6369},{33331,5,7348},
+{33333,26,6380},{33340,5,17788},{33342,0,7350},{33343,17,17790},
+{33348,0,7351},{33349,5,17795},{33351,18,6387},{33356,9,17799},
+{33359,0,7354},{33360,29,17802},{33368,10,6392},{33371,13,17810},
+{33375,0,7356},{33376,13,17814},{33380,18,6395},{33385,5,17820},
+{33387,0,9712},{33388,5,17822},{33390,26,6400},{33397,5,17824},
+{33399,14,6407},{33403,5,17827},{33405,10,6411},{33408,5,17829},
+{33410,10,6414},{33413,9,17832},{33416,42,6417},{33427,13,17838},
+{33431,10,6428},{33434,5,17842},{33436,22,6431},{33442,5,17846},
+{33444,66,6437},{33461,5,17850},{33463,30,6454},{33471,5,17854},
+{33473,0,5112},{33474,5,17856},{33476,0,5118},{33477,5,17858},
+{33479,14,6462},{33483,5,5110},{33485,46,6466},{33497,5,17863},
+{33499,50,6478},{33512,9,17867},{33515,0,3316},{33516,9,17870},
+{33519,10,6491},{33522,5,17874},{33524,0,5128},{33525,5,17876},
+{33527,18,6494},{33532,17,17880},{33537,34,6499},{33546,5,17885},
+{33548,22,6508},{33554,5,17889},{33556,5,5137},{33558,6,6514},
+{33560,5,17892},{33562,10,6516},{33565,37,17894},{33575,6,6519},
+{33577,5,17904},{33579,70,6521},{33597,9,17911},{33600,0,5157},
+{33601,5,17914},{33603,0,5155},{33604,5,17916},{33606,14,6539},
+{33610,17,17919},{33615,22,6543},{33621,17,17925},{33626,0,2119},
+{33627,5,5143},{33629,62,6549},{33645,5,5170},{33647,0,4144},
+{33648,25,17932},{33655,6,6565},{33657,5,17939},{33659,10,6567},
+{33662,25,17941},{33669,6,6570},{33671,5,17948},{33673,6,6572},
+{33675,9,17950},{33678,0,3304},{33679,9,17953},{33682,6,6574},
+{33684,5,17956},{33686,10,6576},{33689,5,17959},{33691,30,6579},
+{33699,13,17964},{33703,18,6587},{33708,13,17968},{33712,10,6592},
+{33715,5,5174},{33717,34,6595},{33726,5,17974},{33728,6,6604},
+{33730,9,17976},{33733,10,6606},{33736,5,17980},{33738,10,6609},
+{33741,5,17983},{33743,0,1921},{33744,13,17985},{33748,18,6612},
+{33753,9,17991},{33756,22,6617},{33762,9,17995},{33765,0,5194},
+{33766,9,17998},{33769,6,6623},{33771,13,18001},{33775,14,6625},
+{33779,17,18005},{33784,5,5210},{33786,9,18010},{33789,0,5200},
+{33790,9,18013},{33793,26,6629},{33800,5,18018},{33802,30,6636},
+{33810,21,18021},{33816,0,5197},{33817,9,18027},{33820,6,6644},
+{33822,21,18030},{33828,5,4238},{33830,10,6646},{33833,9,18036},
+{33836,0,8587},{33837,13,18039},{33841,0,5234},{33842,9,18043},
+{33845,0,9033},{33846,5,18046},{33848,0,5203},{33849,9,18048},
+{33852,6,6649},{33854,29,18051},{33862,0,5229},{33863,5,18059},
+{33865,0,8715},{33866,25,18061},{33873,6,6651},{33875,13,18068},
+{33879,22,6653},{33885,13,18073},{33889,22,6659},{33895,5,18079},
+{33897,70,6665},{33915,25,18087},{33922,0,1466},{33923,13,18094},
+{33927,5,5223},{33929,22,6683},{33935,13,18100},{33939,6,6689},
+{33941,5,18104},{33943,10,6691},{33946,5,18107},{33948,0,3543},
+{33949,13,18109},{33953,0,5246},{33954,49,18113},{33967,0,4759},
+{33968,5,18126},{33970,10,6694},{33973,9,18129},{33976,38,6697},
+{33986,5,18134},{33988,0,4025},{33989,13,18136},{33993,18,6707},
+{33998,5,18141},{34000,14,6712},{34004,5,18144},{34006,0,1078},
+{34007,21,18146},{34013,14,6716},{34017,5,18153},{34019,14,6720},
+{34023,17,18156},{34028,18,6724},{34033,41,18162},{34044,14,6729},
+{34048,45,18174},{34060,0,5252},{34061,13,18186},{34065,14,6733},
+{34069,5,18191},{34071,0,4482},{34072,5,18193},{34074,0,3780},
+{34075,9,18195},{34078,22,6737},{34084,5,18200},{34086,0,9016},
+{34087,13,18202},{34091,10,6743},{34094,33,18206},{34103,26,6746},
+{34110,9,18215},{34113,10,6753},{34116,5,18219},{34118,18,6756},
+{34123,9,18222},{34126,0,9021},{34127,9,18225},{34130,30,6761},
+{34138,13,18230},{34142,0,5267},{34143,9,18234},{34146,10,6769},
+{34149,9,18238},{34152,10,6772},{34155,5,18241},{34157,0,8651},
+{34158,13,18243},{34162,10,6775},{34165,5,18248},{34167,18,6778},
+{34172,5,18251},{34174,0,2500},{34175,17,18253},{34180,34,6783},
+{34189,5,18261},{34191,10,6792},{34194,5,18264},{34196,0,8410},
+{34197,21,18266},{34203,6,6795},{34205,5,18272},{34207,0,9034},
+{34208,13,18274},{34212,26,6797},{34219,9,18280},{34222,10,6804},
+{34225,21,18283},{34231,14,6807},{34235,21,18290},{34241,0,5285},
+{34242,25,18296},{34249,0,2230},{34250,9,18303},{34253,14,6811},
+{34257,5,18306},{34259,10,6815},{34262,21,18309},{34268,6,6818},
+{34270,21,18315},{34276,6,6820},{34278,9,18321},{34281,6,6822},
+{34283,33,18324},{34292,10,6824},{34295,5,18334},{34297,10,6827},
+{34300,9,18336},{34303,0,5287},{34304,13,18339},{34308,14,6830},
+{34312,9,18343},{34315,0,8379},{34316,17,18346},{34321,0,2821},
+{34322,13,18351},{34326,0,5291},{34327,9,18355},{34330,0,9050},
+{34331,9,18358},{34334,0,9046},{34335,9,18361},{34338,0,9015},
+{34339,13,18364},{34343,10,6834},{34346,9,18369},{34349,0,8185},
+{34350,37,18372},{34360,18,6837},{34365,5,18384},{34367,0,8289},
+{34368,49,18386},{34381,18,6842},{34386,5,18399},{34388,6,6847},
+{34390,13,18401},{34394,22,6849},{34400,5,18407},{34402,0,6509},
+{34403,13,18409},{34407,0,8168},{34408,9,18413},{34411,14,6855},
+{34415,5,18417},{34417,0,3396},{34418,25,18419},{34425,38,6859},
+{34435,25,18426},{34442,14,6869},{34446,17,18433},{34451,10,6873},
+{34454,21,18439},{34460,6,6876},{34462,17,18445},{34467,6,6878},
+{34469,5,18450},{34471,22,6880},{34477,5,18453},{34479,10,6886},
+{34482,5,18455},{34484,10,6889},{34487,9,18457},{34490,0,7175},
+{34491,17,18460},{34496,0,4602},{34497,9,18465},{34500,30,6892},
+{34508,5,18470},{34510,14,6900},{34514,5,18472},{34516,0,2028},
+{34517,9,18474},{34520,14,6904},{34524,5,18478},{34526,6,6908},
+{34528,13,18480},{34532,0,1773},{34533,13,18484},{34537,0,7181},
+{34538,9,18488},{34541,14,6910},{34545,5,7182},{34547,6,6914},
+{34549,9,18492},{34552,10,6916},{34555,9,18495},{34558,22,6919},
+{34564,5,18500},{34566,18,6925},{34571,5,18502},{34573,0,7198},
+{34574,13,18504},{34578,50,6930},{34591,5,18513},{34593,18,6943},
+{34598,9,18516},{34601,0,7210},{34602,13,18519},{34606,0,7204},
+{34607,5,18523},{34609,0,7209},{34610,5,18525},{34612,0,7208},
+{34613,5,18527},{34615,0,7211},{34616,9,18529},{34619,0,7201},
+{34620,5,18532},{34622,6,6948},{34624,25,18534},{34631,10,6950},
+{34634,5,18541},{34636,10,6953},{34639,13,18544},{34643,26,6956},
+{34650,21,18551},{34656,0,7218},{34657,5,18557},{34659,14,6963},
+{34663,25,18559},{34670,10,6967},{34673,9,18567},{34676,18,6970},
+{34681,5,18572},{34683,6,6975},{34685,5,7215},{34687,9,18574},
+{34690,14,6977},{34694,5,18577},{34696,0,7234},{34697,5,18579},
+{34699,10,6981},{34702,17,18582},{34707,0,7229},{34708,9,18587},
+{34711,0,7237},{34712,21,18590},{34718,6,6984},{34720,5,18596},
+{34722,0,8742},{34723,17,18598},{34728,0,7231},{34729,5,18603},
+{34731,18,6986},{34736,9,18606},{34739,10,6991},{34742,13,18610},
+{34746,14,6994},{34750,5,18615},{34752,0,7248},{34753,9,18617},
+{34756,30,6998},{34764,5,18623},{34766,0,9697},{34767,5,18625},
+{34769,10,7006},{34772,25,18627},{34779,0,7250},{34780,13,18634},
+{34784,0,7252},{34785,5,18638},{34787,10,7009},{34790,13,18641},
+{34794,22,7012},{34800,5,18647},{34802,0,7817},{34803,9,18649},
+{34806,0,9689},{34807,5,18652},{34809,10,7018},{34812,5,18655},
+{34814,6,7021},{34816,9,18658},{34819,14,7023},{34823,9,18662},
+{34826,0,7257},{34827,17,18665},{34832,26,7027},{34839,13,18672},
+{34843,0,7258},{34844,9,18676},{34847,18,7034},{34852,49,18680},
+{34865,6,7039},{34867,9,18693},{34870,0,7771},{34871,5,18696},
+{34873,14,7041},{34877,9,18699},{34880,0,4051},{34881,9,18702},
+{34884,10,7045},{34887,9,18705},{34890,14,7048},{34894,17,18709},
+{34899,6,7052},{34901,5,18714},{34903,26,7054},{34910,9,18719},
+{34913,18,7061},{34918,5,18722},{34920,42,7066},{34931,13,18728},
+{34935,10,7077},{34938,9,18733},{34941,34,7080},{34950,5,18738},
+{34952,0,7360},{34953,5,18740},{34955,10,7089},{34958,13,18743},
+{34962,0,3598},{34963,9,18747},{34966,0,4015},{34967,17,18750},
+{34972,0,3729},{34973,17,18755},{34978,10,7092},{34981,21,18761},
+{34987,10,7095},{34990,9,18768},{34993,0,1695},{34994,17,18771},
+{34999,0,7086},{35000,13,18776},{35004,0,7087},{35005,13,18780},
+{35009,6,7098},{35011,5,18784},{35013,6,7100},{35015,5,18786},
+{35017,6,7102},{35019,9,18788},{35022,6,7104},{35024,5,18791},
+{35026,14,7106},{35030,5,18794},{35032,6,7110},{35034,5,18796},
+{35036,14,7112},{35040,5,18799},{35042,14,7116},{35046,5,18801},
+{35048,0,7096},{35049,25,18803},{35056,18,7120},{35061,9,18811},
+{35064,6,7125},{35066,5,18814},{35068,14,7127},{35072,5,18817},
+{35074,0,1836},{35075,13,18819},{35079,0,9846},{35080,5,18823},
+{35082,0,7103},{35083,17,18825},{35088,14,7131},{35092,17,18831},
+{35097,10,7135},{35100,17,18836},{35105,0,7099},{35106,9,18841},
+{35109,0,3271},{35110,13,18844},{35114,6,7138},{35116,13,18848},
+{35120,34,7140},{35129,5,18855},{35131,0,8925},{35132,17,18857},
+{35137,0,7107},{35138,5,18862},{35140,0,3922},{35141,5,18864},
+{35143,0,9661},{35144,53,18866},{35158,0,7722},{35159,21,18880},
+{35165,14,7149},{35169,9,18886},{35172,10,7153},{35175,9,18890},
+{35178,10,7156},{35181,5,18894},{35183,0,7807},{35184,5,18896},
+{35186,0,8621},{35187,29,18898},{35195,0,7109},{35196,9,18906},
+{35199,18,7159},{35204,5,18911},{35206,0,1709},{35207,13,18913},
+{35211,0,8086},{35212,9,18917},{35215,0,7986},{35216,9,18920},
+{35219,0,8324},{35220,5,18923},{35222,10,7164},{35225,29,18926},
+{35233,0,9402},{35234,13,18934},{35238,0,9404},{35239,9,18938},
+{35242,10,7167},{35245,5,18942},{35247,0,9405},{35248,5,18944},
+{35250,0,9406},{35251,13,18946},{35255,0,9407},{35256,5,18950},
+{35258,0,8146},{35259,5,18952},{35261,50,7170},{35274,9,6459},
+{35277,0,18956},{35278,13,6462},{35282,0,2200},{35283,9,18957},
+{35286,0,7511},{35287,9,18960},{35290,18,7183},{35295,13,18965},
+{35299,14,7188},{35303,13,18970},{35307,0,7516},{35308,9,18974},
+{35311,0,7517},{35312,9,18977},{35315,22,7192},{35321,25,18982},
+{35328,14,7198},{35332,9,18989},{35335,38,7202},{35345,5,18996},
+{35347,22,7212},{35353,5,19000},{35355,18,7218},{35360,9,19004},
+{35363,10,7223},{35366,13,19008},{35370,0,7922},{35371,5,19012},
+{35373,0,8479},{35374,9,19014},{35377,0,8669},{35378,5,19017},
+{35380,10,7226},{35383,9,19020},{35386,0,8834},{35387,9,19023},
+{35390,0,7518},{35391,5,19026},{35393,0,8934},{35394,13,19028},
+{35398,10,7229},{35401,17,19033},{35406,30,7232},{35414,5,19041},
+{35416,0,8938},{35417,5,19043},{35419,0,8893},{35420,5,19045},
+{35422,0,7838},{35423,5,19047},{35425,10,7240},{35428,5,19049},
+{35430,0,8503},{35431,5,19051},{35433,50,7243},{35446,9,19056},
+{35449,0,4435},{35450,5,19059},{35452,0,8944},{35453,5,19061},
+{35455,0,8942},{35456,13,19063},{35460,26,7256},{35467,5,19068},
+{35469,0,8446},{35470,9,19070},{35473,5,8953},{35475,10,7263},
+{35478,5,19074},{35480,10,7266},{35483,9,19077},{35486,42,7269},
+{35497,9,19083},{35500,0,8519},{35501,9,19086},{35504,10,7280},
+{35507,9,19090},{35510,0,8961},{35511,5,19093},{35513,0,7925},
+{35514,5,19095},{35516,0,8728},{35517,5,19097},{35519,0,7878},
+{35520,5,19099},{35522,10,7283},{35525,5,19102},{35527,46,7286},
+{35539,9,19109},{35542,6,7298},{35544,9,19112},{35547,14,7300},
+{35551,9,19116},{35554,22,7304},{35560,9,19121},{35563,14,7310},
+{35567,5,19125},{35569,10,7314},{35572,5,19128},{35574,70,7317},
+{35592,5,19136},{35594,0,8023},{35595,9,19138},{35598,10,7335},
+{35601,9,19142},{35604,38,7338},{35614,9,19148},{35617,0,8710},
+{35618,13,19151},{35622,10,7348},{35625,5,19156},{35627,10,7351},
+{35630,17,19158},{35635,0,8931},{35636,17,19163},{35641,0,8122},
+{35642,13,19168},{35646,0,8312},{35647,37,19172},{35657,0,8840},
+{35658,13,19182},{35662,6,7354},{35664,21,19186},{35670,26,7356},
+{35677,33,19194},{35686,0,2270},{35687,13,19203},{35691,6,7363},
+{35693,5,19207},{35695,6,7365},{35697,9,19209},{35700,0,8405},
+{35701,5,19212},{35703,0,8010},{35704,17,19214},{35709,0,8768},
+{35710,5,19219},{35712,0,7891},{35713,33,19221},{35722,0,7753},
+{35723,9,19230},{35726,0,9755},{35727,9,19233},{35730,18,7367},
+{35735,17,19237},{35740,38,7372},{35750,5,4888},{35752,46,7382},
+{35764,5,4891},{35766,46,7394},{35778,5,4894},{35780,54,7406},
+{35794,9,4899},{35797,10,7420},{35800,5,4903},{35802,18,7423},
+{35807,5,4906},{35809,26,7428},{35816,5,4909},{35818,154,7435},
+{35857,5,4924},{35859,0,3788},{35860,9,4926},{35863,30,7474},
+{35871,9,4933},{35874,30,7482},{35882,5,4938},{35884,6,7490},
+{35886,5,4940},{35888,6,7492},{35890,5,4942},{35892,0,3121},
+{35893,5,4944},{35895,0,1825},{35896,33,19252},{35905,0,2050},
+{35906,13,19261},{35910,14,7494},{35914,5,19265},{35916,0,3732},
+{35917,9,19267},{35920,0,7933},{35921,13,19270},{35925,0,7445},
+{35926,13,19274},{35930,0,6544},{35931,21,19278},{35937,6,7498},
+{35939,25,19284},{35946,6,7500},{35948,25,19291},{35955,0,5597},
+{35956,13,19298},{35960,10,7502},{35963,25,19302},{35970,0,7505},
+{35971,5,19309},{35973,0,7507},{35974,9,19311},{35977,14,7505},
+{35981,25,19315},{35988,0,7509},{35989,9,19322},{35992,0,7508},
+{35993,13,19325},{35997,22,7509},{36003,13,19330},{36007,22,7515},
+{36013,5,19334},{36015,110,7521},{36043,21,19342},{36049,18,7549},
+{36054,13,19349},{36058,54,7554},{36072,5,19357},{36074,14,7568},
+{36078,21,19359},{36084,0,8179},{36085,17,19365},{36090,22,7572},
+{36096,13,19371},{36100,6,7578},{36102,5,19375},{36104,34,7580},
+{36113,17,19380},{36118,0,8509},{36119,13,19385},{36123,90,7589},
+{36146,5,6444},{36148,66,7612},{36165,5,6450},{36167,0,6454},
+{36168,5,6452},{36170,26,7629},{36177,5,19390},{36179,82,7636},
+{36200,9,19395},{36203,10,7657},{36206,5,19399},{36208,0,4668},
+{36209,5,19401},{36211,18,7660},{36216,33,19403},{36225,0,1256},
+{36226,5,19412},{36228,6,7665},{36230,13,19414},{36234,6,7667},
+{36236,17,19418},{36241,0,7410},{36242,5,19423},{36244,6,7669},
+{36246,9,19425},{36249,0,8826},{36250,17,19428},{36255,0,3614},
+{36256,9,19433},{36259,0,3199},{36260,13,19436},{36264,0,8430},
+{36265,29,19440},{36273,18,7671},{36278,5,19448},{36280,30,7676},
+{36288,9,19453},{36291,14,7684},{36295,13,19457},{36299,10,7688},
+{36302,5,7461},{36304,6,7691},{36306,13,19463},{36310,5,7457},
+{36312,5,19467},{36314,22,7693},{36320,9,19470},{36323,6,7699},
+{36325,9,19473},{36328,18,7701},{36333,5,19477},{36335,0,2654},
+{36336,9,19479},{36339,14,7706},{36343,5,7466},{36345,18,7710},
+{36350,25,19485},{36357,0,7449},{36358,9,19492},{36361,14,7715},
+{36365,5,19496},{36367,6,7719},{36369,9,19498},{36372,0,7474},
+{36373,29,19501},{36381,10,7721},{36384,5,19509},{36386,6,7724},
+{36388,17,19511},{36393,34,7726},{36402,5,19519},{36404,6,7735},
+{36406,9,19521},{36409,6,7737},{36411,5,19524},{36413,0,7485},
+{36414,5,19526},{36416,0,7482},{36417,5,7488},{36419,6,7739},
+{36421,5,19529},{36423,22,7741},{36429,13,19531},{36433,5,7490},
+{36435,5,19535},{36437,0,9728},{36438,9,19537},{36441,0,7450},
+{36442,33,19540},{36451,0,9734},{36452,5,19549},{36454,0,1069},
+{36455,5,19551},{36457,0,7451},{36458,5,19553},{36460,42,7747},
+{36471,9,19559},{36474,10,7758},{36477,5,19563},{36479,10,7761},
+{36482,9,19566},{36485,62,7764},{36501,17,19573},{36506,18,7780},
+{36511,5,19580},{36513,0,9733},{36514,9,19582},{36517,6,7785},
+{36519,9,19585},{36522,10,7787},{36525,5,19588},{36527,0,3192},
+{36528,5,19590},{36530,0,1570},{36531,25,19592},{36538,0,3612},
+{36539,17,19599},{36544,0,8432},{36545,33,19604},{36554,18,7790},
+{36559,9,19613},{36562,10,7795},{36565,21,19617},{36571,0,9357},
+{36572,9,19623},{36575,0,8450},{36576,13,19626},{36580,0,9364},
+{36581,21,19630},{36587,0,9363},{36588,21,19636},{36594,0,9358},
+{36595,17,19642},{36600,30,7798},{36608,9,19649},{36611,30,7806},
+{36619,25,19655},{36626,14,7814},{36630,17,19663},{36635,10,7818},
+{36638,5,9373},{36640,17,19668},{36645,6,7821},{36647,5,19673},
+{36649,6,7823},{36651,13,19675},{36655,0,8048},{36656,9,19679},
+{36659,0,9376},{36660,13,19682},{36664,0,8507},{36665,5,19686},
+{36667,0,7943},{36668,5,19688},{36670,6,7825},{36672,5,19690},
+{36674,18,7827},{36679,5,19693},{36681,0,8872},{36682,9,19695},
+{36685,6,7832},{36687,17,19698},{36692,0,9378},{36693,37,19703},
+{36703,70,7834},{36721,9,6371},{36724,0,4576},{36725,5,6374},
+{36727,6,7852},{36729,5,6378},{36731,22,7854},{36737,5,6382},
+{36739,38,7860},{36749,9,6387},{36752,62,7870},{36768,9,19721},
+{36771,0,2460},{36772,5,19724},{36774,6,7886},{36776,5,1103},
+{36778,34,7888},{36787,9,19729},{36790,0,5949},{36791,5,19732},
+{36793,0,1096},{36794,9,19734},{36797,6,7897},{36799,5,19737},
+{36801,30,7899},{36809,17,19741},{36814,30,7907},{36822,5,19748},
+{36824,30,7915},{36832,5,19751},{36834,58,7923},{36849,5,19757},
+{36851,6,7938},{36853,5,19759},{36855,10,7940},{36858,9,19761},
+{36861,0,4628},{36862,5,19764},{36864,26,7943},{36871,5,19766},
+{36873,106,7950},{36900,5,19773},{36902,0,5962},{36903,21,19775},
+{36909,10,7977},{36912,5,19781},{36914,0,8123},{36915,5,19783},
+{36917,5,5967},{36919,6,7980},{36921,5,19786},{36923,14,7982},
+{36927,5,19789},{36929,14,7986},{36933,5,19792},{36935,0,4315},
+{36936,9,19794},{36939,22,7990},{36945,5,5972},{36947,22,7996},
+{36953,5,19799},{36955,42,8002},{36966,5,19805},{36968,6,8013},
+{36970,9,19807},{36973,6,8015},{36975,9,19810},{36978,74,8017},
+{36997,5,19818},{36999,18,8036},{37004,9,19821},{37007,58,8041},
+{37022,9,19830},{37025,10,8056},{37028,5,19833},{37030,0,1017},
+{37031,9,19835},{37034,70,8059},{37052,5,19842},{37054,0,4981},
+{37055,5,19844},{37057,0,4313},{37058,5,19846},{37060,14,8077},
+{37064,5,19849},{37066,0,2189},{37067,9,19851},{37070,22,8081},
+{37076,9,19855},{37079,0,4989},{37080,9,19858},{37083,30,8087},
+{37091,9,19863},{37094,10,8095},{37097,5,19866},{37099,18,8098},
+{37104,13,19870},{37108,6,8103},{37110,5,19874},{37112,0,1415},
+{37113,13,19876},{37117,10,8105},{37120,5,19881},{37122,18,8108},
+{37127,5,19885},{37129,0,8647},{37130,29,19887},{37138,18,8113},
+{37143,5,19897},{37145,0,1074},{37146,13,19899},{37150,0,4996},
+{37151,9,19903},{37154,6,8118},{37156,9,19906},{37159,0,7867},
+{37160,17,19909},{37165,38,8120},{37175,5,19917},{37177,6,8130},
+{37179,29,19919},{37187,0,5001},{37188,5,19927},{37190,30,8132},
+{37198,5,7418},{37200,10,8140},{37203,13,19931},{37207,0,4026},
+{37208,5,19935},{37210,0,1648},{37211,5,19937},{37213,6,8143},
+{37215,5,19939},{37217,18,8145},{37222,9,19941},{37225,66,8150},
+{37242,9,19947},{37245,5,7426},{37247,0,2899},{37248,17,19950},
+{37253,34,8167},{37262,5,19958},{37264,10,8176},{37267,9,19960},
+{37270,0,8789},{37271,9,19963},{37274,10,8179},{37277,17,19966},
+{37282,5,7436},{37284,21,19971},{37290,10,8182},{37293,9,7439},
+{37296,13,19977},{37300,6,8185},{37302,13,19981},{37306,0,7444},
+{37307,17,19985},{37312,70,8187},{37330,9,9459},{37333,18,8205},
+{37338,5,19996},{37340,6,8210},{37342,17,19998},{37347,6,8212},
+{37349,5,20003},{37351,10,8214},{37354,41,20006},{37365,22,8217},
+{37371,17,20019},{37376,6,8223},{37378,5,20024},{37380,0,9478},
+{37381,9,20026},{37384,6,8225},{37386,9,20029},{37389,18,8227},
+{37394,5,20033},{37396,6,8232},{37398,29,20035},{37406,0,8149},
+{37407,13,20043},{37411,18,8234},{37416,21,20048},{37422,10,8239},
+{37425,5,20055},{37427,6,8242},{37429,5,20057},{37431,14,8244},
+{37435,5,20059},{37437,14,8248},{37441,13,20061},{37445,0,9473},
+{37446,5,20065},{37448,6,8252},{37450,9,20067},{37453,0,9496},
+{37454,9,20070},{37457,0,7766},{37458,9,20073},{37461,10,8254},
+{37464,5,20077},{37466,6,8257},{37468,5,20079},{37470,0,9488},
+{37471,9,20081},{37474,0,7765},{37475,9,20084},{37478,0,9482},
+{37479,17,20087},{37484,5,9489},{37486,21,20092},{37492,0,2155},
+{37493,9,20098},{37496,14,8259},{37500,9,20102},{37503,6,8263},
+{37505,5,20105},{37507,10,8265},{37510,29,20108},{37518,0,7552},
+{37519,5,20116},{37521,10,8268},{37524,5,20119},{37526,26,8271},
+{37533,9,20124},{37536,0,9501},{37537,5,20127},{37539,46,8278},
+{37551,5,20132},{37553,0,9509},{37554,17,20134},{37559,22,8290},
+{37565,13,20141},{37569,30,8296},{37577,9,20148},{37580,0,9513},
+{37581,5,20151},{37583,0,9505},{37584,5,20153},{37586,0,7935},
+{37587,37,20155},{37597,10,8304},{37600,9,20166},{37603,30,8307},
+{37611,5,20171},{37613,18,8315},{37618,13,20173},{37622,10,8320},
+{37625,9,20178},{37628,0,7960},{37629,13,20181},{37633,0,9547},
+{37634,13,20185},{37638,0,9543},{37639,5,9551},{37641,25,20189},
+{37648,10,8323},{37651,5,20197},{37653,0,9548},{37654,5,20199},
+{37656,14,8326},{37660,9,20201},{37663,14,8330},{37667,9,20205},
+{37670,10,8334},{37673,5,20209},{37675,0,8619},{37676,5,20211},
+{37678,6,8337},{37680,5,20213},{37682,6,8339},{37684,5,20215},
+{37686,10,8341},{37689,17,20218},{37694,22,8344},{37700,5,20225},
+{37702,6,8350},{37704,9,20227},{37707,10,8352},{37710,21,20231},
+{37716,0,9558},{37717,9,20237},{37720,0,8808},{37721,5,20240},
+{37723,0,7894},{37724,29,20242},{37732,6,8355},{37734,9,20250},
+{37737,14,8357},{37741,9,20254},{37744,0,9561},{37745,13,20257},
+{37749,6,8361},{37751,9,20261},{37754,0,8829},{37755,9,20264},
+{37758,0,9598},{37759,9,20267},{37762,10,8363},{37765,5,20271},
+{37767,0,9566},{37768,5,20273},{37770,0,7732},{37771,13,20275},
+{37775,0,7558},{37776,21,20279},{37782,10,8366},{37785,33,20286},
+{37794,6,8369},{37796,5,20295},{37798,42,8371},{37809,5,20301},
+{37811,10,8382},{37814,5,20304},{37816,0,9569},{37817,21,20306},
+{37823,0,9570},{37824,9,20312},{37827,0,9580},{37828,9,20315},
+{37831,26,8385},{37838,9,20320},{37841,0,9582},{37842,13,20323},
+{37846,10,8392},{37849,9,20327},{37852,5,9576},{37854,26,8395},
+{37861,9,20332},{37864,0,9757},{37865,45,20335},{37877,18,8402},
+{37882,33,20349},{37891,0,9506},{37892,25,20358},{37899,0,9523},
+{37900,13,20365},{37904,18,8407},{37909,9,20370},{37912,6,8412},
+{37914,9,20373},{37917,0,9584},{37918,5,20376},{37920,0,9589},
+{37921,17,20378},{37926,5,9537},{37928,0,9565},{37929,17,20383},
+{37934,0,8218},{37935,9,20388},{37938,14,8414},{37942,5,20392},
+{37944,10,8418},{37947,9,20395},{37950,6,8421},{37952,13,20398},
+{37956,0,8867},{37957,17,20402},{37962,10,8423},{37965,17,20408},
+{37970,10,8426},{37973,41,20414},{37984,0,9492},{37985,5,20425},
+{37987,10,8429},{37990,17,20428},{37995,10,8432},{37998,5,20434},
+{38000,10,8435},{38003,13,20437},{38007,10,8438},{38010,5,20442},
+{38012,14,8441},{38016,17,20444},{38021,9,6798},{38024,14,8445},
+{38028,5,6803},{38030,0,3106},{38031,5,6805},{38033,34,8449},
+{38042,9,6810},{38045,22,8458},{38051,5,6813},{38053,38,8464},
+{38063,5,6819},{38065,18,8474},{38070,17,6823},{38075,0,4679},
+{38076,5,6828},{38078,38,8479},{38088,25,6832},{38095,0,20453},
+{38096,9,6839},{38099,5,20454},{38101,9,6842},{38104,22,8489},
+{38110,9,6848},{38113,10,8495},{38116,5,6852},{38118,0,20457},
+{38119,5,6854},{38121,18,8498},{38126,5,6859},{38128,10,8503},
+{38131,9,6861},{38134,22,8506},{38140,5,6866},{38142,30,8512},
+{38150,5,6871},{38152,0,4013},{38153,5,6873},{38155,6,8520},
+{38157,9,6875},{38160,6,8522},{38162,17,6878},{38167,22,8524},
+{38173,9,6885},{38176,38,8530},{38186,5,6889},{38188,18,8540},
+{38193,5,6893},{38195,10,8545},{38198,9,6896},{38201,18,8548},
+{38206,5,6900},{38208,14,8553},{38212,9,6904},{38215,26,8557},
+{38222,5,6909},{38224,6,8564},{38226,9,6911},{38229,0,20467},
+{38230,13,6914},{38234,14,8566},{38238,5,6919},{38240,0,20469},
+{38241,5,6922},{38243,0,2582},{38244,33,6924},{38253,14,8570},
+{38257,9,6934},{38260,5,20471},{38262,6,8574},{38264,25,20473},
+{38271,18,8576},{38276,5,20481},{38278,0,9152},{38279,5,20483},
+{38281,46,8581},{38293,9,20489},{38296,0,8809},{38297,29,20492},
+{38305,18,8593},{38310,5,20501},{38312,22,8598},{38318,13,20504},
+{38322,0,8783},{38323,9,20508},{38326,0,9163},{38327,5,20511},
+{38329,26,8604},{38336,9,20514},{38339,0,9168},{38340,5,20517},
+{38342,26,8611},{38349,9,20521},{38352,0,9171},{38353,9,20524},
+{38356,10,8618},{38359,17,20527},{38364,10,8621},{38367,5,20533},
+{38369,6,8624},{38371,5,20535},{38373,0,9157},{38374,5,20537},
+{38376,50,8626},{38389,5,5769},{38391,46,8639},{38403,5,5773},
+{38405,18,8651},{38410,13,5777},{38414,26,8656},{38421,9,5783},
+{38424,0,20543},{38425,5,5786},{38427,30,8663},{38435,25,20547},
+{38442,0,4952},{38443,9,20554},{38446,0,3273},{38447,5,20557},
+{38449,22,8671},{38455,13,20559},{38459,74,8677},{38478,5,20567},
+{38480,0,3915},{38481,9,20569},{38484,6,8696},{38486,5,20572},
+{38488,0,8986},{38489,5,20574},{38491,38,8698},{38501,5,20579},
+{38503,22,8708},{38509,9,20582},{38512,34,8714},{38521,13,20586},
+{38525,0,8705},{38526,25,20590},{38533,46,8723},{38545,9,20600},
+{38548,34,8735},{38557,37,20605},{38567,14,8744},{38571,17,20616},
+{38576,46,8748},{38588,5,7546},{38590,14,8760},{38594,5,20626},
+{38596,22,8764},{38602,5,20629},{38604,14,8770},{38608,5,20631},
+{38610,0,7549},{38611,5,20633},{38613,6,8774},{38615,5,20635},
+{38617,14,8776},{38621,9,20638},{38624,14,8780},{38628,13,20642},
+{38632,10,8784},{38635,13,20646},{38639,0,7523},{38640,5,20650},
+{38642,6,8787},{38644,5,20652},{38646,22,8789},{38652,5,20656},
+{38654,14,8795},{38658,5,20659},{38660,22,8799},{38666,9,20662},
+{38669,10,8805},{38672,9,20665},{38675,0,2881},{38676,5,20668},
+{38678,0,2593},{38679,17,20670},{38684,10,8808},{38687,29,20676},
+{38695,0,8616},{38696,5,20684},{38698,0,7529},{38699,5,20686},
+{38701,0,7530},{38702,5,20688},{38704,10,8811},{38707,17,20691},
+{38712,6,8814},{38714,9,20696},{38717,6,8816},{38719,9,20699},
+{38722,10,8818},{38725,9,20703},{38728,0,8242},{38729,33,20706},
+{38738,6,8821},{38740,5,20715},{38742,0,2279},{38743,5,20717},
+{38745,10,8823},{38748,5,20719},{38750,18,8826},{38755,5,20722},
+{38757,0,4738},{38758,5,20724},{38760,6,8831},{38762,33,20726},
+{38771,14,8833},{38775,17,20736},{38780,0,7624},{38781,29,20741},
+{38789,0,7625},{38790,17,20749},{38795,22,8837},{38801,5,7626},
+{38803,6,8843},{38805,9,20758},{38808,0,3143},{38809,25,20761},
+{38816,0,2302},{38817,5,20768},{38819,0,7631},{38820,5,20770},
+{38822,0,9877},{38823,13,20772},{38827,18,8845},{38832,5,20778},
+{38834,10,8850},{38837,29,20781},{38845,0,9822},{38846,17,20789},
+{38851,0,9821},{38852,5,20794},{38854,0,9874},{38855,5,20796},
+{38857,14,8853},{38861,21,20799},{38867,0,8000},{38868,17,20805},
+{38873,0,9317},{38874,5,20810},{38876,10,8857},{38879,25,20813},
+{38886,14,8860},{38890,9,6222},{38893,0,2289},{38894,17,20821},
+{38899,14,8864},{38903,29,20827},{38911,58,8868},{38926,5,9670},
+{38928,14,8883},{38932,9,20840},{38935,6,8887},{38937,9,20843},
+{38940,0,9673},{38941,13,20846},{38945,0,9672},{38946,5,20850},
+{38948,10,8889},{38951,21,20853},{38957,0,8573},{38958,5,20859},
+{38960,0,8062},{38961,21,20861},{38967,6,8892},{38969,5,20867},
+{38971,10,8894},{38974,29,20870},{38982,0,8154},{38983,17,20878},
+{38988,10,8897},{38991,13,20883},{38995,6,8900},{38997,9,20887},
+{39000,14,8902},{39004,5,20891},{39006,0,8200},{39007,9,20893},
+{39010,0,9680},{39011,5,20896},{39013,10,8906},{39016,9,20899},
+{39019,6,8909},{39021,5,20902},{39023,114,8911},{39052,5,7140},
+{39054,46,8940},{39066,5,7144},{39068,6,8952},{39070,5,7146},
+{39072,0,1472},{39073,5,7148},{39075,6,8954},{39077,5,7150},
+{39079,6,8956},{39081,17,20911},{39086,5,9420},{39088,14,8958},
+{39092,5,20918},{39094,0,9422},{39095,17,20920},{39100,0,9423},
+{39101,25,20925},{39108,18,8962},{39113,17,20934},{39118,0,1668},
+{39119,5,20939},{39121,9,6583},{39124,6,8967},{39126,5,20942},
+{39128,0,3021},{39129,5,6587},{39131,0,7924},{39132,5,20944},
+{39134,18,8969},{39139,13,20947},{39143,10,8974},{39146,5,9119},
+{39148,14,8977},{39152,5,20953},{39154,10,8981},{39157,25,20956},
+{39164,14,8984},{39168,9,20964},{39171,10,8988},{39174,9,20968},
+{39177,18,8991},{39182,5,20972},{39184,14,8996},{39188,13,20974},
+{39192,0,8760},{39193,5,20978},{39195,0,9125},{39196,5,20980},
+{39198,0,8090},{39199,5,20982},{39201,0,8643},{39202,21,20984},
+{39208,0,7982},{39209,17,20990},{39214,0,7657},{39215,13,20995},
+{39219,0,9116},{39220,9,20999},{39223,0,9126},{39224,13,21002},
+{39228,14,9000},{39232,9,21007},{39235,10,9004},{39238,5,21011},
+{39240,9,9129},{39243,6,9007},{39245,13,21013},{39249,26,9009},
+{39256,13,21019},{39260,10,9016},{39263,9,21024},{39266,18,9019},
+{39271,21,5662},{39277,42,9024},{39288,5,21030},{39290,30,9035},
+{39298,5,21034},{39300,46,9043},{39312,5,5676},{39314,0,2719},
+{39315,9,5678},{39318,14,9055},{39322,41,21039},{39333,0,6955},
+{39334,5,21050},{39336,0,5086},{39337,9,21052},{39340,10,9059},
+{39343,5,21055},{39345,14,9062},{39349,45,21058},{39361,0,7767},
+{39362,53,21070},{39376,22,9066},{39382,5,21085},{39384,42,9072},
+{39395,37,21091},{39405,0,7999},{39406,9,21101},{39409,0,8295},
+{39410,49,21104},{39423,10,9083},{39426,9,21118},{39429,0,9231},
+{39430,25,21121},{39437,10,9086},{39440,21,21128},{39446,0,9234},
+{39447,5,21134},{39449,0,8375},{39450,65,21136},{39467,22,9089},
+{39473,17,21155},{39478,10,9095},{39481,17,21160},{39486,18,9098},
+{39491,5,9238},{39493,0,8433},{39494,13,21166},{39498,0,9226},
+{39499,5,21170},{39501,10,9103},{39504,17,21173},{39509,10,9106},
+{39512,5,21179},{39514,6,9109},{39516,9,21181},{39519,0,8860},
+{39520,5,21184},{39522,14,9111},{39526,13,21187},{39530,50,9115},
+{39543,5,6075},{39545,26,9128},{39552,5,6080},{39554,42,9135},
+{39565,5,21195},{39567,10,9146},{39570,5,6086},{39572,5,21197},
+{39574,18,9149},{39579,9,6090},{39582,0,5941},{39583,5,6093},
+{39585,0,2697},{39586,5,6095},{39588,18,9154},{39593,21,21201},
+{39599,10,9159},{39602,13,21207},{39606,26,9162},{39613,9,21213},
+{39616,10,9169},{39619,5,21216},{39621,0,7643},{39622,17,21218},
+{39627,5,7645},{39629,5,21223},{39631,38,9172},{39641,21,21227},
+{39647,10,9182},{39650,13,21234},{39654,0,7662},{39655,13,21238},
+{39659,18,9185},{39664,33,21243},{39673,10,9190},{39676,25,21253},
+{39683,0,4660},{39684,5,21260},{39686,10,9193},{39689,13,21263},
+{39693,10,9196},{39696,9,21268},{39699,0,7670},{39700,21,21271},
+{39706,0,9888},{39707,13,21277},{39711,0,7671},{39712,5,21281},
+{39714,30,9199},{39722,13,21286},{39726,18,9207},{39731,29,21291},
+{39739,6,9212},{39741,13,21299},{39745,34,9214},{39754,9,21304},
+{39757,18,9223},{39762,5,21308},{39764,0,2826},{39765,9,21310},
+{39768,10,9228},{39771,77,21314},{39791,0,8266},{39792,13,21334},
+{39796,0,9759},{39797,5,21338},{39799,0,9758},{39800,33,21340},
+{39809,10,9231},{39812,37,21350},{39822,18,9234},{39827,25,21361},
+{39834,0,9769},{39835,5,21368},{39837,6,9239},{39839,41,21370},
+{39850,18,9241},{39855,65,21382},{39872,6,9246},{39874,17,21399},
+{39879,14,9248},{39883,33,21405},{39892,10,9252},{39895,13,21415},
+{39899,10,9255},{39902,9,21420},{39905,14,9258},{39909,5,21424},
+{39911,10,9262},{39914,5,9787},{39916,13,21427},{39920,0,9794},
+{39921,9,21431},{39924,0,9796},{39925,29,21434},{39933,10,9265},
+{39936,29,21443},{39944,6,9268},{39946,9,21451},{39949,0,9801},
+{39950,5,21454},{39952,14,9270},{39956,45,21457},{39968,0,9805},
+{39969,5,21469},{39971,10,9274},{39974,5,21472},{39976,6,9277},
+{39978,9,21474},{39981,0,9807},{39982,9,21477},{39985,42,9279},
+{39996,5,21484},{39998,0,9812},{39999,21,21486},{40005,0,9816},
+{40006,5,21492},{40008,6,9290},{40010,29,21494},{40018,26,9292},
+{40025,13,21504},{40029,10,9299},{40032,25,21509},{40039,0,9820},
+{40040,17,21516},{40045,0,9772},{40046,37,21521},{40056,18,9302},
+{40061,5,21533},{40063,14,9307},{40067,5,21536},{40069,13,7563},
+{40073,5,21538},{40075,18,9311},{40080,9,7570},{40083,0,21542},
+{40084,5,7573},{40086,13,21543},{40090,5,7575},{40092,6,9316},
+{40094,21,7577},{40100,0,2523},{40101,17,7583},{40106,10,9318},
+{40109,5,7589},{40111,0,21550},{40112,29,7591},{40120,6,9321},
+{40122,13,7599},{40126,17,21552},{40131,0,3285},{40132,13,7603},
+{40136,5,21557},{40138,25,7607},{40145,5,21559},{40147,9,7614},
+{40150,0,1111},{40151,9,7617},{40154,5,21561},{40156,5,7620},
+{40158,6,9323},{40160,5,21563},{40162,0,7623},{40163,5,21565},
+{40165,0,8348},{40166,9,21567},{40169,0,9600},{40170,5,21570},
+{40172,0,8924},{40173,21,21572},{40179,14,9325},{40183,57,21579},
+{40198,14,9329},{40202,41,21595},{40213,0,8578},{40214,17,21606},
+{40219,18,9333},{40224,9,21613},{40227,0,9604},{40228,5,21616},
+{40230,10,9338},{40233,21,21619},{40239,6,9341},{40241,37,21625},
+{40251,0,8007},{40252,9,21635},{40255,0,7965},{40256,5,21638},
+{40258,0,9613},{40259,53,21640},{40273,10,9343},{40276,29,21654},
+{40284,6,9346},{40286,5,21662},{40288,6,9348},{40290,29,21664},
+{40298,10,9350},{40301,5,21673},{40303,0,9624},{40304,5,21675},
+{40306,0,8438},{40307,77,21677},{40327,10,9353},{40330,33,21698},
+{40339,0,9622},{40340,13,21707},{40344,10,9356},{40347,37,21712},
+{40357,0,9629},{40358,9,21722},{40361,0,9630},{40362,17,21725},
+{40367,0,9036},{40368,13,21730},{40372,0,8004},{40373,21,21734},
+{40379,6,9359},{40381,9,21740},{40384,18,9361},{40389,53,21745},
+{40403,0,9634},{40404,9,21759},{40407,14,9366},{40411,37,21763},
+{40421,6,9370},{40423,29,21773},{40431,0,9636},{40432,5,21781},
+{40434,6,9372},{40436,13,21783},{40440,10,9374},{40443,65,21787},
+{40460,0,9640},{40461,29,21804},{40469,0,9606},{40470,13,21812},
+{40474,54,9377},{40488,17,6967},{40493,46,9391},{40505,5,6977},
+{40507,5,21822},{40509,14,9403},{40513,5,6980},{40515,10,9407},
+{40518,13,6983},{40522,0,3216},{40523,5,6987},{40525,18,9410},
+{40530,9,21827},{40533,18,9415},{40538,9,6993},{40541,6,9420},
+{40543,13,21833},{40547,10,9422},{40550,25,6998},{40557,0,7006},
+{40558,5,21838},{40560,22,9425},{40566,9,21842},{40569,26,9431},
+{40576,5,21846},{40578,0,7676},{40579,13,21848},{40583,5,7677},
+{40585,5,21852},{40587,0,7679},{40588,21,21854},{40594,6,9438},
+{40596,9,21860},{40599,0,8207},{40600,17,21863},{40605,10,9440},
+{40608,17,21869},{40613,6,9443},{40615,5,21874},{40617,0,9719},
+{40618,17,21876},{40623,0,9878},{40624,13,21881},{40628,6,9445},
+{40630,5,21885},{40632,0,7405},{40633,5,21887},{40635,6,9447},
+{40637,5,7673},{40639,17,21890},{40644,0,2011},{40645,13,21895},
+{40649,0,4856},{40650,5,21899},{40652,22,9449},{40658,5,21902},
+{40660,0,3114},{40661,9,21904},{40664,0,2831},{40665,5,21907},
+{40667,9,7684},{40670,18,9455},{40675,5,21910},{40677,22,9460},
+{40683,13,21913},{40687,0,7694},{40688,5,21917},{40690,10,9466},
+{40693,5,21920},{40695,14,9469},{40699,5,6742},{40701,10,9473},
+{40704,33,21924},{40713,30,9476},{40721,5,21936},{40723,26,9484},
+{40730,21,21941},{40736,10,9491},{40739,33,21948},{40748,0,7696},
+{40749,5,21957},{40751,0,7697},{40752,25,21959},{40759,22,9494},
+{40765,5,7700},{40767,17,21969},{40772,0,7702},{40773,17,21974},
+{40778,6,9500},{40780,9,21979},{40783,22,9502},{40789,13,21983},
+{40793,0,9745},{40794,5,21987},{40796,0,9747},{40797,5,21989},
+{40799,18,9508},{40804,5,21992},{40806,0,9748},{40807,9,21994},
+{40810,10,9513},{40813,17,21998},{40818,0,8434},{40819,13,22003},
+{40823,0,9751},{40824,25,22007},{40831,6,9516},{40833,5,22014},
+{40835,6,9518},{40837,21,7535},{40843,10,9520},{40846,5,22016},
+{40848,0,8371},{40849,9,22018},{40852,6,9523},{40854,9,22021},
+{40857,14,9525},{40861,5,22024},{40863,6,9529},{40865,17,22026},
+{40884,6,9531},{40886,5,22069},{40888,14,9533},{40960,4657,29064},
+{42128,217,30229},{56455,0,22048},{56457,0,22049},{56524,0,22050},
+{56585,0,22093},{56719,0,22085},{56733,0,22110},{56791,0,22075},
+{56830,0,22111},{59244,0,22353},{59277,25,573},{59284,5,592},
+{59286,0,599},{59335,6,9537},{59367,49,10059},{59413,317,22047},
+{63788,0,22031},{63865,0,2562},{63893,0,16595},{63975,0,8204},
+{63985,0,20611},{64012,0,4697},{64013,9,22032},{64017,0,22035},
+{64019,5,22036},{64024,0,22038},{64031,9,22039},{64035,5,22042},
+{64039,9,22044},{65040,10,9539},{65043,13,576},{65047,5,592},
+{65049,0,599},{65072,6,9542},{65075,5,600},{65077,5,580},
+{65079,5,596},{65081,5,582},{65083,5,594},{65085,5,586},
+{65087,5,584},{65089,13,588},{65097,37,10027},{65108,13,10037},
+{65113,53,10041},{65128,13,10055},{65281,9,262},{65284,0,166},
+{65285,353,266},{65374,0,106},{65504,5,168},{65506,14,9544},
+};
+
+static const unsigned short cmap_UniGB_UTF16_H_table[9548] = {
+167,22354,171,102,7713,162,127,671,669,675,673,693,
+679,677,683,681,687,685,9910,105,9911,107,9912,108,
+10016,7714,185,188,151,157,9921,142,136,135,145,159,
+158,130,138,152,147,181,180,183,182,179,178,177,
+176,174,173,22428,22047,22055,22060,4162,4707,4722,4709,4185,
+10131,1597,4867,3238,1592,3270,982,4765,4884,4879,2091,5017,
+1431,2543,4860,4710,4740,10778,3397,1150,4946,1228,5020,4283,
+2407,5523,3698,3414,5660,11565,3859,1398,2927,4656,5934,1386,
+3948,5302,3395,6004,3318,6165,1789,2093,2238,1732,6163,1852,
+5016,5293,5366,1798,5986,5614,5600,3983,1765,12946,3437,4518,
+6409,3795,1526,2240,1626,3821,3248,4350,4357,2849,3124,4536,
+1400,6589,3826,1073,2736,3430,3095,3491,2053,4611,1715,4713,
+5789,3019,4073,2916,3209,4041,4310,1832,3728,1733,3379,4264,
+3650,7110,7008,16063,994,3011,2808,2850,2737,3407,3398,3413,
+16587,1923,4049,2539,4592,2780,7399,7262,3753,4123,4309,2490,
+1591,7115,1593,6686,3261,1249,4657,4544,2297,3353,5656,4570,
+7388,3300,17826,7152,1291,4051,3995,4169,18908,8086,2200,4093,
+1825,1528,7445,7504,7739,1285,4668,4672,3366,7803,3980,1250,
+19731,4191,4276,19992,2522,2241,7797,8317,1714,2542,7545,4303,
+20714,1636,2795,1770,8589,2289,4219,8713,7936,7924,3402,3438,
+3920,8301,1824,1754,7660,7888,5019,4704,1862,8761,8348,9864,
+2656,8305,2704,21894,3465,1937,6741,9752,1509,1821,3466,1072,
+8390,7814,8247,7988,4851,104,10024,7703,9989,189,10059,22357,
+22390,22392,22391,22393,99,10019,22065,22068,22109,22108,22117,22112,
+4162,1504,10072,3070,3747,4458,3288,3336,3887,4696,1154,4304,
+10076,4698,1304,10077,4613,3151,4701,3415,10078,3181,1124,4156,
+1367,1514,3508,4703,1513,10082,2566,4088,10083,3294,4707,10084,
+1777,4071,5788,4559,1662,10087,1329,10088,2594,10089,4722,10090,
+3737,1413,3769,4598,10091,2529,2312,4709,2862,10095,2290,10096,
+4711,2745,4204,10097,4525,3817,4424,1964,1603,2497,10098,3032,
+2963,3140,10099,1837,10100,1264,4185,4725,2292,3089,4153,3869,
+3924,2713,2681,10115,3268,2580,10132,4301,4506,10133,3417,1597,
+4695,4287,2436,10134,4361,1978,4727,3828,2269,4702,10137,4080,
+3956,8689,4723,4867,3751,2375,10140,2188,1884,4199,1217,1943,
+2841,10141,3930,2264,3669,2570,3156,4869,10145,4872,3238,4767,
+4193,3401,3237,4770,4768,4732,2247,3052,1301,10153,4769,2242,
+2234,10154,3247,1366,2687,10157,1181,4653,3426,3568,4461,1713,
+3894,4846,4774,3111,10161,4772,10162,1405,2615,4187,4771,10165,
+4174,4773,2764,4127,10169,4568,4776,10170,4779,2161,2126,3241,
+10174,1658,10175,1631,10176,3090,4782,4168,3832,2098,1689,1602,
+4008,4569,4266,2052,2038,4775,3290,3775,1326,10193,4777,10194,
+3332,4780,2686,4781,3776,4783,1141,1817,10200,4791,10201,1012,
+10202,2607,10203,3365,10204,3514,10205,3515,4792,3786,1454,4606,
+4689,4280,10219,3640,10220,1925,10221,4790,4848,4293,4787,1677,
+4692,4788,4784,4789,2886,4251,4778,4849,10224,4785,10225,2982,
+4121,998,2116,4794,10232,4793,4800,4802,10237,4799,3408,4797,
+4533,10241,8178,10242,1283,4796,10243,2536,10244,3427,10245,4798,
+10246,4795,4804,10249,8285,1520,1794,10253,4167,2665,10258,2197,
+4493,1191,3141,2424,4801,10259,4803,10260,3833,1957,9884,1372,
+1580,4808,4850,3147,2537,4812,3532,1690,10289,4809,10290,4811,
+1036,4294,4813,8629,3984,10291,4810,4805,10294,4806,2546,4807,
+2150,4009,1700,10297,2322,10298,4817,4814,10303,958,4822,10307,
+8908,7778,10315,7968,4824,1055,10316,4819,10317,8319,1434,10318,
+2338,3611,1961,4183,10322,4823,2233,10325,1232,4825,2330,10329,
+4826,4815,2882,8284,4818,4821,4820,4431,10341,4532,10342,3168,
+2124,4830,8596,4816,10352,4831,3018,4691,10362,3668,7781,8833,
+2941,3686,4827,1226,2443,8909,10407,8458,7742,9855,1401,10416,
+4834,10417,4835,1317,4836,1378,8750,972,7830,8907,8812,10424,
+8471,4837,3310,3934,10442,8415,8386,4838,8108,4842,3303,8915,
+4841,4840,4843,3536,10465,2170,8065,10469,3014,8720,10474,8911,
+10475,8723,10476,4839,4844,8164,8080,10477,4845,8918,10482,3264,
+10483,8912,8910,7798,10492,2503,8919,8917,8913,1592,4697,4365,
+10516,4333,4001,1289,4472,10517,3893,1851,10518,2392,10519,2791,
+1553,7909,10523,3700,4866,4868,1428,10527,1524,3206,8229,10537,
+982,1796,2626,4854,10538,2471,1803,10539,1841,3990,1121,3075,
+2318,1477,4645,10540,4129,2137,3445,2096,4858,4765,1743,3224,
+1192,4380,2790,4884,3258,10555,3967,10556,2347,2922,1843,10560,
+4885,10561,4332,4886,4879,1515,1672,1122,4880,1290,2341,10569,
+2435,4152,2511,1522,4882,4881,3071,10578,4633,4883,10579,2562,
+10580,1491,2609,7887,10581,2152,10582,1368,2598,10592,2912,2091,
+1615,4864,10603,3037,10604,2362,2016,8153,10605,1451,10606,5017,
+4002,10607,3690,967,1307,2060,5018,1894,10608,4391,1431,1492,
+4748,3243,1651,3149,4749,10611,2364,5003,4750,3991,1987,6510,
+2585,2622,4405,1744,1335,10619,1306,2970,2534,10628,1113,10629,
+4751,1831,10630,1438,4549,3479,3210,3307,1359,2393,10635,1869,
+10636,1574,2100,3645,8904,3940,9859,4755,3117,1833,2164,3633,
+10645,3049,7959,4758,10650,4756,1033,10656,2326,10657,3386,2151,
+7979,1708,1769,10663,8906,7833,4760,10671,2204,10672,4762,4761,
+8015,8143,3005,8246,7994,10676,8905,8089,4763,8053,10679,4764,
+2543,10687,3211,1015,1791,2118,3840,5005,2588,1518,4601,2925,
+2218,2531,2257,2488,5008,3421,10705,8126,10706,1137,4263,10710,
+2792,10711,4052,5010,10716,2496,7885,5011,10719,2366,8617,10720,
+8678,10721,8487,8195,2847,8498,10724,3159,5012,8995,8437,4860,
+3344,1805,3839,4363,1031,1365,10748,4004,4861,10753,5301,4863,
+4710,1988,1050,10758,1276,4740,2180,2428,10763,3880,8901,4743,
+8030,10771,8902,3012,3189,4164,4744,2887,8431,3397,10781,3108,
+10782,4700,10783,3382,3830,2033,1014,1983,3960,10787,1049,4673,
+4636,8656,1414,2715,2866,1136,10790,1150,10791,1102,5370,4445,
+2357,2643,4747,2648,10792,4746,3811,10793,4946,10794,3791,4714,
+2739,4230,3762,10797,2087,3215,2680,10798,2332,3969,10799,4947,
+1228,10806,1585,3663,2533,2530,10809,4066,4106,4733,2512,8897,
+1960,4734,10821,4336,7780,10822,3918,4735,10823,4736,3888,10824,
+1309,2294,8697,4737,8208,10831,8898,10832,5020,3909,10840,3289,
+1173,7770,4283,1197,2083,4278,3488,1617,3452,10850,3196,3443,
+1101,4027,10851,2962,5013,1503,10855,7842,2407,1822,2323,2614,
+10856,5374,5373,4538,2209,4474,979,1506,2390,3579,5371,3406,
+4279,10857,4741,4157,1916,3507,3601,10858,5375,1489,5372,4314,
+10862,1273,1778,10863,5378,10864,1926,2077,1494,10865,3677,2816,
+1962,2527,3699,3935,5376,3890,10866,2663,5377,2711,2348,10870,
+2600,3709,4222,1642,5385,10871,5388,1678,980,1557,1649,10874,
+1891,3664,2401,3494,3091,10875,4519,5389,10876,3825,1240,3851,
+1336,10879,3798,1959,10880,3824,10881,4070,1399,10886,1263,10887,
+1761,5379,2856,10892,2940,5383,5386,4340,5387,10893,3127,3815,
+2875,10899,5394,10900,5399,10901,4571,5393,5410,3781,10910,1918,
+5398,5392,2975,3364,1963,2817,2310,10915,5390,10916,5397,10917,
+2969,4423,1924,10922,2299,4258,1723,10923,4579,10924,5391,1815,
+2356,10927,5400,5411,5421,10933,5407,5406,4646,5991,4142,5402,
+10934,2358,10935,4382,10936,2389,5404,5413,9069,4083,10942,5414,
+946,3030,5403,10943,1948,10944,1566,3724,1879,4376,5415,3929,
+944,5423,5401,4079,5405,5412,10947,1982,10948,10949,5418,5422,
+5424,4249,10950,8775,1762,2935,5426,3347,2545,2855,2411,3941,
+4477,5430,1151,10965,1942,5428,10966,5009,10967,4109,9068,10970,
+3561,1344,10971,945,5433,3609,5434,5427,10989,5436,10994,1976,
+10995,3442,3767,5453,1231,10996,5452,5446,11004,3722,5444,11005,
+5442,11006,2397,4641,11007,3333,5440,940,8604,5445,8393,11016,
+5443,5448,5454,11022,8688,3008,3311,2461,5437,2943,11029,4730,
+5441,2905,5466,3639,11038,5463,11039,2355,5461,3784,5457,3327,
+2457,5460,1956,1895,5455,5438,11045,5465,1328,5471,3871,1919,
+11053,5462,8459,11063,8414,11064,7850,5458,8748,4414,11067,5439,
+11068,2984,11069,5459,11070,4316,11071,5482,4012,8408,8896,11077,
+5474,5476,5456,3293,5479,11082,5464,8609,11086,3423,5481,11087,
+5467,11088,3802,11089,3512,5491,5484,5480,11090,5489,9081,5472,
+11095,5490,9074,5473,3529,5499,11101,5500,5496,8554,11106,5494,
+2113,5495,9084,1725,4731,8368,11113,9082,7796,4021,2710,9079,
+11116,5493,5475,5498,5497,5501,11122,8012,5506,5502,9080,8655,
+9064,4597,1237,11125,4681,9073,3504,11126,9065,5504,11127,3850,
+1936,11131,9844,5511,5507,4148,5505,5503,5509,5510,9071,9072,
+11153,5508,11154,5514,9078,9075,11155,3094,4706,4398,5516,3424,
+9087,11158,5515,9076,11159,8373,11160,1724,11161,7899,9842,11162,
+5519,5513,8631,9077,11174,1910,3642,5520,11178,9090,9067,11193,
+8249,9887,5521,9085,8693,11202,9089,3229,9083,9086,8652,9066,
+9865,2869,11214,9879,3185,3513,11225,5524,2029,4716,4217,5525,
+3702,11226,1561,5527,11233,4339,2450,1364,3766,5526,5528,1829,
+1875,3693,5529,3059,5530,11246,4341,9091,3201,5532,5531,7997,
+11247,8591,8774,8776,8574,11254,8576,4381,5031,5033,11267,5032,
+1856,5035,1222,5039,2061,11277,4534,11278,5040,1624,11285,5024,
+3585,2367,1994,4693,2400,2132,3590,5038,990,3834,1653,4630,
+3041,2447,11295,3596,11296,5047,5041,3033,5043,11297,5048,11298,
+3000,5049,2381,5046,5045,1340,2455,2633,5042,5044,3992,5053,
+2504,5058,5059,5026,1809,4334,5052,11332,2398,5056,11333,5025,
+11334,1479,11335,5051,2418,5054,11339,5057,1786,942,1260,5055,
+5064,11363,3057,5060,5061,5063,5062,5070,11368,4311,1153,9002,
+5074,11379,5067,8843,5068,2977,2062,5075,11390,3606,8069,1552,
+5196,8997,5071,11395,5072,1576,9004,9006,5076,11407,5079,1037,
+8709,4104,7736,7795,1537,8163,9017,3567,6563,11440,9003,11441,
+3537,9005,11442,3571,8575,3604,8615,11453,9007,5080,3649,5081,
+5027,11474,5085,5082,11475,2274,11476,3474,5083,7874,3331,2844,
+3130,5084,11492,8882,11493,4409,4017,2830,1556,8409,5028,11517,
+8157,5029,11523,8551,5030,11533,8685,11534,1909,8199,8998,9001,
+8018,8251,9000,11540,8999,11541,3227,7723,11546,3414,3236,11547,
+4624,8878,3378,4163,8009,5660,11560,1321,1711,11568,3889,4859,
+3859,3731,4865,1567,11575,4160,8321,11580,5659,5657,11581,1398,
+11582,3647,3582,1679,11583,4712,4116,1906,11584,3390,4171,2417,
+2115,1568,11589,5295,11590,8060,5296,5004,11593,4098,3077,2865,
+1675,11596,1657,2441,4669,11599,3092,1061,5298,2178,3626,5300,
+11602,5299,1485,11608,3350,9051,7902,11614,8098,11615,7930,2927,
+2924,11620,2863,11621,2140,3570,6005,3266,6006,3758,11628,4622,
+1721,2703,11629,3244,1545,2110,4134,6011,11638,2803,8877,6014,
+6010,6015,3720,2880,6018,2760,11658,3069,6012,3411,2228,1820,
+6016,4000,3774,6019,6026,11677,4141,11678,2171,6023,6025,11684,
+2492,6027,11702,4221,4648,11706,3759,11707,3727,2637,2192,6024,
+6029,6032,11714,6034,2329,3368,6033,11726,1583,4302,6030,11737,
+6031,11738,3197,6035,8255,3746,6037,7950,6036,4233,6041,3373,
+6045,2761,6044,6049,3870,11838,6564,8297,6047,2129,3298,6050,
+11860,6051,11861,6056,9207,6058,6053,1462,11868,6054,2878,11873,
+6048,9210,6060,11898,9214,8104,6062,6061,11908,9217,8737,11929,
+6063,11930,4876,6064,8482,4656,6071,11954,6072,2404,4371,11955,
+4659,1385,3556,6068,4729,4651,3949,11956,2772,6073,2097,1819,
+6069,4048,1881,2678,8538,4705,3458,5994,11964,6070,11965,1682,
+8677,11968,3265,2904,11971,8279,5934,2913,11972,3569,5935,4429,
+11973,4307,3439,957,11974,3523,3739,5937,11980,5936,11981,4663,
+1842,4581,1511,3745,4178,1039,3404,11982,1293,3372,2394,4038,
+3433,5938,2007,3913,1797,1885,4112,3945,2117,11992,5939,3256,
+2426,1119,3539,2104,11998,2103,4225,2785,2409,2759,12006,1893,
+4325,3163,2834,1203,12016,1834,8421,12017,5943,2577,8495,8355,
+4432,8481,12018,8660,8165,12019,5944,12020,5946,7818,7735,12025,
+1386,1555,3511,4057,1437,3440,12028,1663,3357,12031,2172,8094,
+8870,3789,4685,8680,12032,7898,7865,3948,12033,3346,1594,6066,
+2133,12036,1251,12037,3337,12038,6067,1223,5302,12043,4269,5303,
+12044,4137,9052,3395,4227,1284,5990,2884,2256,3777,2901,2309,
+3015,1194,3193,3646,2237,3820,3409,3040,5992,3975,3467,12073,
+3697,2668,8272,5995,7783,2667,5996,12074,9204,8510,12078,6004,
+3710,12079,3318,4192,5548,4305,12091,3551,3088,5547,5549,5550,
+5555,1204,12104,5551,1749,5556,1435,5557,7958,5559,5564,4091,
+12114,5562,5561,2612,5563,12118,4355,12119,5558,12120,5566,961,
+5560,12125,2438,12126,5565,5569,5571,2676,12156,1578,12157,4317,
+9097,12165,7863,2349,12170,8628,5579,1292,9103,3080,1377,12187,
+4075,7962,5577,12198,5575,5574,12199,1065,9099,4441,5576,5584,
+5582,5591,5590,3123,5586,12237,5588,5592,12249,5589,5585,9105,
+5594,12268,8817,9102,12286,5595,5598,9104,12313,8243,12314,8764,
+8169,12328,3760,8277,12333,9106,6165,12340,1323,4572,4059,1239,
+1789,4688,3142,2317,1799,12345,3814,1205,5023,8996,2093,4184,
+3517,984,4855,2238,12355,12356,1083,3431,1155,12357,3484,1608,
+12358,3389,5534,4459,5537,5536,2946,3662,12366,2554,5535,4578,
+1142,4547,1468,8515,1403,4512,8489,12377,3868,1018,5538,12380,
+8823,7847,5541,1224,8837,12387,2786,9092,5542,1686,5543,2846,
+12401,9095,9094,5545,8848,12406,5546,1332,7748,7730,9093,1732,
+3036,2893,12419,1129,12420,3997,7955,6163,2008,4284,4265,8051,
+1852,5681,4620,12424,3177,1084,1333,5683,4029,2645,5682,12430,
+2415,4235,1464,5684,1483,12431,2802,1784,12432,1705,12433,2964,
+1644,5686,5685,1543,4694,8160,12441,3670,5690,12447,5688,3475,
+2370,4254,5687,2551,2483,5693,5692,2453,8327,7800,9134,7926,
+7985,5695,12481,5696,12482,8261,8568,5016,12489,4092,3667,5293,
+4699,2359,5021,4211,3097,2923,5294,12498,1088,5366,3412,12502,
+5369,12503,1798,12504,4228,12505,1696,1954,1469,4454,2779,3903,
+1974,12515,5999,5998,6000,12518,3733,12519,3280,12520,9205,12521,
+8821,1424,3132,12525,6002,9838,12534,7856,8323,12538,8584,12539,
+5986,12540,1858,1426,12541,2659,5988,5987,5989,9852,5614,3993,
+12548,3679,12549,4110,1169,1108,12552,1115,2990,4452,4245,12555,
+5600,5601,12559,4194,12560,1246,1076,3754,4504,5602,12564,2277,
+1408,12565,5603,1939,5604,1991,2672,5605,4023,8133,3694,5606,
+12571,1444,2952,5607,5608,12574,7841,12575,9107,4318,5609,7947,
+4054,5610,3761,5611,12590,1443,12591,7804,5612,2026,3983,5698,
+1089,4203,2108,3239,12603,5701,6668,6667,5367,5700,4541,3757,
+2731,4561,5705,5710,2425,12618,5711,5703,3982,12628,1965,5707,
+1659,1992,3583,3520,5702,5704,5718,4408,5717,2926,12636,4507,
+2947,1159,5713,12639,5716,2552,3505,1410,5723,2084,5715,3999,
+4348,5719,1839,5720,4665,6669,5722,12660,6673,5728,3432,2558,
+12668,2021,2403,12671,1946,6674,6671,2027,6675,4031,6672,1941,
+1590,5729,1521,3652,1792,12685,3855,3102,1584,12690,5727,5726,
+2872,5730,12691,4262,5735,3137,5737,1902,5736,12705,2031,12706,
+5731,5732,5738,12710,5734,12711,3841,4267,4358,12716,2909,6676,
+4039,5733,12719,2810,12720,5741,1048,12721,5746,9140,8318,12722,
+2101,5740,1440,3174,5744,2265,3744,5743,12746,5745,12747,3860,
+5742,12748,3768,2034,7907,1484,2324,1177,1266,12753,1058,5739,
+1176,1421,1848,1575,8341,9147,3928,5751,12754,2017,3234,3989,
+9145,5752,1299,6677,12765,4319,4297,6678,5753,4201,4291,7720,
+9149,1739,5747,5750,1660,12782,5748,2445,9139,4347,1355,12810,
+5755,8546,2010,12811,3376,7774,12819,7773,6679,12822,9143,2724,
+7983,9439,2032,2363,12827,9138,8526,8274,12830,3790,9148,12833,
+5756,8427,2371,7743,1112,4410,12853,8219,8380,9150,12854,5758,
+5759,1888,6680,12870,8329,5757,12871,9137,8724,5760,8158,3971,
+8739,974,6682,9142,6683,2476,12895,5761,9868,9438,2932,12910,
+9144,5762,8190,8017,8673,12922,9136,12923,8142,12924,8478,5088,
+8225,6684,9441,1765,12930,3835,6393,4018,3472,3249,3876,1262,
+3809,2229,12931,9379,5790,2055,6394,4446,12932,3068,6395,6396,
+12936,6398,6397,12937,6400,6399,12938,9380,2217,12941,6401,12942,
+2661,12943,8819,12944,8624,1348,1402,6644,6643,1628,3566,1099,
+12952,6645,12956,3437,5306,1164,4413,3050,978,1397,3246,3105,
+4531,12973,2452,5307,3297,4120,2917,1010,1243,3232,1586,12982,
+4467,1269,2095,2336,988,4189,3450,4610,12996,3687,1525,2374,
+4476,12997,1698,2968,5308,2406,2684,3133,13001,1977,1041,3004,
+3578,2827,13016,5309,4067,1294,13017,2807,1684,13020,4595,1412,
+1207,2839,2892,2456,5310,13021,1011,2949,2601,13022,1838,13023,
+2315,3721,985,13024,3712,5312,2303,4635,5311,4465,1000,2634,
+2147,13029,4250,2468,2914,1133,4404,2451,3418,5313,4509,13032,
+1801,13033,3208,3486,13034,5315,2378,3027,4612,3399,2854,13039,
+1275,1835,4535,6478,959,4542,2677,13057,3805,3573,3961,2870,
+1427,5314,4502,2090,2024,943,13060,2931,1391,5316,3671,3741,
+8657,3829,5318,13077,3682,2449,4634,13080,5317,977,1899,3340,
+2902,2327,2487,3557,13093,2148,2000,1432,2998,8476,5328,13097,
+9053,13098,5325,2316,5321,9858,1338,2222,5322,2896,3891,13110,
+1473,8461,8282,1565,3441,1493,5327,13113,4455,13114,5323,3616,
+3101,13115,2950,4155,13119,2337,2682,13127,3600,1245,13128,2212,
+13129,2405,3703,4099,1390,13130,5326,5319,5329,13131,6480,2647,
+5324,4543,1416,13136,1211,13137,5330,13138,5340,13139,8077,5335,
+13143,5339,4670,5337,2797,3636,13149,1196,5336,13159,5333,3812,
+13160,1322,2360,2285,2211,8024,5331,13171,4337,13172,5320,13173,
+5332,2474,13178,5334,1210,1764,2638,5343,5346,8539,13186,1138,
+1319,1389,3295,5344,3526,13194,1758,13195,5345,5348,3605,13203,
+1004,1393,5942,13210,8411,1202,13216,6481,13217,5342,3356,5341,
+997,4136,1120,13220,3586,9056,5338,13227,3481,9057,13234,5349,
+8256,1376,13242,2825,5351,13246,8846,9054,13252,5353,7786,2581,
+13259,5350,2334,13260,3025,8194,1258,3281,8339,13269,3503,5352,
+4623,9055,7852,1244,7764,2572,13282,7944,3144,1132,1388,13283,
+4616,13284,8384,9058,13285,2895,13286,13287,5357,8544,1898,13288,
+8605,8078,5358,8749,2505,13289,8263,3324,13290,8802,8039,7858,
+13293,1184,3171,13294,5359,13295,3161,13296,7849,5360,6482,13299,
+8140,3528,13303,8050,13304,5362,13305,5361,13306,1160,7762,8356,
+7964,8847,13314,8173,7725,8530,9062,13319,8442,13320,2955,9059,
+13324,8346,4383,13334,8182,13335,9060,13336,3228,7785,13337,9063,
+13338,8477,8793,8278,8547,5364,8105,2335,8188,13347,5365,4518,
+6409,6502,3436,13352,4786,1727,13353,1790,1634,4511,3954,7371,
+2809,13367,2295,6503,968,7726,13371,2205,13372,2555,13373,1087,
+1229,1741,3291,6504,2275,3476,13386,3136,13387,4508,7868,13388,
+1680,8514,8222,7747,4428,1116,6593,1002,13407,6595,13408,9428,
+13409,1526,13410,2584,13411,7510,3964,4486,13414,3810,2240,1287,
+13417,1702,13418,4439,13419,6697,8815,1550,13420,3502,3981,7895,
+13427,1626,6596,3392,2965,13433,6599,6598,2666,6597,4040,6600,
+13438,6601,4674,6603,3083,3821,13452,2107,3248,1418,2296,4539,
+4394,4055,4028,3400,2434,6418,13468,965,6416,6413,13474,1220,
+13475,2812,2045,4190,3843,6417,6421,13485,3986,4248,1341,13490,
+2758,4687,4466,13495,3422,13496,6423,6422,6425,6424,4582,13504,
+3905,6429,8493,2019,2251,3335,3314,3947,6428,4369,6431,6433,
+8859,13522,6427,13523,6432,3837,13526,2035,13527,1252,3060,2271,
+3849,3172,13536,2262,6434,4384,13545,6435,3883,8790,9384,2928,
+960,6437,7389,9383,13593,9862,9382,13594,8654,3462,13609,4350,
+13624,3191,4158,1783,6420,8508,1187,2723,13629,4411,3641,4683,
+4357,4277,6515,2996,13636,1691,3500,6542,13642,2485,3756,13646,
+1236,13647,3065,6572,9412,2849,13654,3779,2828,1063,4416,13655,
+3468,13656,4587,3058,1571,3306,13667,4374,3203,1734,13670,6228,
+3317,6225,13673,2521,3998,1163,1384,13674,6226,1540,13682,6227,
+3471,1751,3656,4119,6229,6232,1907,13690,1046,2221,7884,6415,
+6233,13691,6236,13692,6241,6242,13697,3518,1008,13698,2078,6231,
+13703,3752,13704,6240,4494,13713,2591,6234,13714,2747,13715,1876,
+4517,6238,3447,4393,13719,6230,13720,6235,6237,13721,3126,1664,
+13722,6239,13723,2410,6248,6253,13726,6251,2127,2114,6257,6260,
+13735,6256,1123,995,2838,1735,3073,3225,3260,6245,6250,6252,
+13749,1866,6254,4690,13750,2910,13751,6258,2383,6243,4600,13761,
+2625,1208,6261,13770,3416,6255,4421,13775,1107,4444,6244,6246,
+1519,6249,13776,6259,2467,13777,3470,13778,3485,3067,2528,6280,
+4585,4130,1922,1780,1772,4375,6277,13808,6276,6274,1865,3621,
+6268,3765,2431,13809,963,6279,6278,13810,4637,13811,6266,13812,
+3674,3292,13813,1997,2220,6272,6267,1430,6269,3138,6273,6275,
+2177,4619,13824,6286,6283,13833,3681,6284,2563,13843,6270,13844,
+2748,1019,1788,9322,8565,13863,9325,2771,3823,2513,3560,13873,
+3632,3968,3448,13876,6281,2143,13887,6287,2787,13894,3076,13895,
+1872,4661,9323,8799,2079,13902,2992,7886,3607,3302,13918,6294,
+2509,6292,1840,13925,6289,6295,13938,4529,4626,9331,6299,13939,
+2184,1325,13975,1342,7934,3955,6304,2510,13999,6302,6316,14004,
+9333,6306,14007,8714,6288,8047,14013,2361,6309,6318,6307,14019,
+1728,14020,6305,14021,4289,2481,6329,6319,1020,6320,4422,14045,
+9320,6322,14046,6323,8448,9334,14059,6326,6327,7975,6311,8407,
+6314,14068,1990,6328,6330,6338,8097,1186,14105,6332,14106,8874,
+8197,8506,4450,14128,2822,14129,8708,6348,14134,1944,6333,14139,
+4232,8387,8512,9335,6347,6340,3134,9332,6349,1261,14167,6343,
+8040,14171,3933,8581,6345,14208,6352,6351,6341,14220,8075,9348,
+6353,14226,6355,2767,9344,9326,14266,9339,9350,9329,9347,9328,
+14274,9321,14275,9343,9338,14317,3124,1361,1995,3979,6577,6578,
+14334,6579,3066,8419,2427,6581,3957,14343,3125,9419,14362,8019,
+4536,4510,1358,1156,3827,3078,8211,7987,1400,14376,3509,2130,
+4115,6361,14381,1404,6360,14382,4060,3449,1175,14383,6364,4530,
+14390,7772,14391,6368,9354,9353,9355,8067,6589,2938,1549,14407,
+4218,8463,8155,1487,14413,2030,6591,4202,8367,3826,14420,2843,
+14421,2756,1533,4719,1073,1080,1082,3007,14424,1081,14425,2736,
+6484,1912,6485,14445,6487,6486,14452,9408,6489,6491,6490,8813,
+9409,6492,14461,3430,4715,2806,14462,2730,3095,6493,2861,14463,
+1687,14467,6497,3167,8394,6499,14468,1883,4126,956,6498,6500,
+8423,9410,14469,1419,2671,3173,14470,6501,14471,3491,5791,3666,
+4524,3184,4852,2040,14483,1905,5794,5792,3328,14492,1904,4061,
+5793,3269,1800,2174,1277,3818,3584,14506,2086,14507,5802,14508,
+5803,3098,1655,3164,4177,3813,14516,5796,5804,14517,3371,1254,
+3074,5797,6687,5798,3308,14528,2983,1806,14532,2752,14533,5795,
+2942,2541,2688,1182,14534,5805,1979,2832,14535,5808,2313,5819,
+5813,1930,1645,4274,14542,4557,4468,1818,4437,4097,3972,3187,
+3205,1147,14550,2783,5820,5807,1605,5815,5812,2915,14561,5814,
+2974,1135,3099,14562,2883,4607,14565,2508,5817,5818,5821,3580,
+5811,14568,4259,14569,1068,6688,14570,5816,3973,3042,4406,5822,
+14571,14572,2225,4124,5825,14580,5831,3873,14588,5830,5836,2700,
+2243,14597,5824,1952,5832,1596,4573,5840,14604,5835,5823,14608,
+2051,3726,3103,2954,2624,14611,5826,14612,3120,2173,2190,5827,
+14613,4644,1193,14614,5833,2102,5837,14615,2048,5838,2921,5839,
+4484,2352,14620,5848,14621,5845,14622,5849,1917,2486,1692,5842,
+1882,2255,9180,2908,14647,9179,3944,3359,4260,14650,3902,5841,
+14653,3617,14659,2495,5843,2553,5844,3807,14660,2006,1460,14661,
+3278,2168,4456,3301,1693,5864,5866,4077,5857,1486,4650,5854,
+3946,5853,2597,3613,2874,14690,3623,5862,5861,5855,14694,5858,
+1422,4286,14697,5860,8286,4224,1382,14701,1993,3367,14704,1345,
+14705,8772,9186,2049,14706,4086,8404,3648,6689,4331,14719,5865,
+4658,5856,14720,2166,5859,4299,14723,5863,3377,3195,1544,14730,
+4415,1146,5877,8607,3793,14733,5867,7782,3787,14734,1750,5876,
+14737,2391,4275,14741,2801,2953,5878,3701,5869,14761,1973,14762,
+3923,9181,5872,5868,8555,3734,3393,2446,14797,2167,5873,5893,
+4343,8885,14810,5881,2616,7974,14814,5895,5885,14819,5886,3538,
+14826,5880,5871,14827,5891,14828,3255,5889,2890,5888,14831,5887,
+1313,5894,14835,7779,8328,14836,1474,4649,7869,14840,9025,5892,
+14841,1985,14842,4655,3618,6568,14843,5890,4556,5879,5882,2721,
+5884,14849,2674,2479,2679,14850,1118,3589,8484,14857,1455,8264,
+9184,5901,8311,14865,8762,3022,2519,4102,5900,2833,14888,8001,
+8220,5899,5908,5906,2725,8888,5883,14893,5902,14894,3477,8822,
+4453,5903,14897,8091,4131,8095,14903,9674,5904,14911,3770,2956,
+9175,3118,14922,2657,5896,14926,8453,14927,2579,3593,1238,9185,
+8172,14934,5913,14935,5905,9194,5912,14938,5915,14939,5914,9187,
+8462,1267,14945,8102,8196,1247,5909,5911,5910,2989,9189,4395,
+5918,14967,9442,7876,14974,975,2071,8886,5921,8361,5916,1117,
+5924,8054,5925,5922,5923,5926,8593,7760,8092,15023,9178,15024,
+8275,15025,9193,9188,8661,15033,9190,9183,15037,3064,9177,15043,
+5927,5929,15044,8212,15045,9196,9195,9176,9198,9870,15058,9197,
+9174,9192,5932,15081,8454,9199,5933,8585,8280,2053,6639,2805,
+15100,1447,2023,2610,4401,15105,2291,4643,15109,4377,1178,6604,
+2646,1337,1241,15123,3213,2376,6606,6605,6607,6611,2325,3602,
+2971,2283,15141,6612,15142,1127,6610,4425,1476,15146,6608,2559,
+1288,6609,3501,2478,3665,2587,15153,6614,1949,2494,15166,4593,
+2379,15174,1616,3342,6613,2039,15175,3615,2254,3235,15176,3862,
+3738,15183,2988,4082,1903,6616,15205,2005,6617,15206,6640,1059,
+1654,6618,4111,6619,8226,6625,15246,2018,15247,2136,6621,15260,
+3312,9018,15264,2751,15265,6641,4470,6622,7918,9429,15268,4594,
+6624,6620,6626,15276,6627,8744,15296,3254,9431,6628,3844,3459,
+6632,8444,15318,6629,15319,6630,9432,15329,3223,8473,15342,6634,
+4105,8743,6633,4402,7775,6635,8863,5014,8124,15370,9434,15371,
+8192,15396,6637,6638,15407,4611,15408,2945,6508,953,8592,2339,
+1715,4150,993,1498,8712,4713,15414,3489,7910,5789,3019,1009,
+2951,6505,6507,15432,9411,4073,15433,2916,15434,6468,15435,2837,
+15436,2840,2489,6469,2852,15440,3838,6466,6470,3627,3853,3865,
+2514,1534,6474,15461,6475,15462,6476,3209,5615,15486,1621,5616,
+5617,15490,4625,8879,5621,2430,5620,1459,5623,5622,15504,1971,
+15505,5624,1808,15510,2304,2911,15515,1940,2199,5625,5627,1535,
+3886,3391,5626,4505,4321,5628,5632,5629,5630,2517,8630,2482,
+7741,5631,15529,5633,5637,15543,5642,1221,5636,2770,1161,5641,
+5640,5638,5643,3988,4588,2733,5646,15554,3908,1958,15559,8757,
+6356,5647,5644,15560,9111,1984,4342,15563,9109,8767,8490,5649,
+15575,6357,7890,15595,9110,9112,5653,3572,15596,5654,8354,15597,
+8036,8235,15600,9108,8505,15601,8543,8641,9114,15602,5655,15603,
+9113,2673,15609,4310,15610,3750,3735,15634,2746,6170,1996,3907,
+15637,2602,6177,6188,1130,6178,15647,6174,6180,6179,3315,4485,
+15655,6173,1606,6175,6187,15667,4584,6181,15672,6186,15673,6185,
+8640,15692,3183,15696,2480,2520,2617,6184,6190,3563,6200,6199,
+6194,6193,15720,6195,15721,6191,15722,6198,15723,6197,15724,6196,
+2590,3158,3006,2948,9312,15734,6201,6204,15753,6203,15754,6205,
+1966,6192,6202,15755,3275,3299,8741,8298,4135,6206,6208,15779,
+15780,2544,6213,15784,9313,15785,6214,6210,15788,6218,6209,15800,
+6215,9314,6219,6220,15842,9315,9316,15848,1832,15849,6962,15850,
+6963,15851,3023,1013,3226,15852,3728,3804,6403,6404,15864,3038,
+1356,9381,5253,15883,6406,15884,6407,15885,6408,1733,5368,3374,
+15890,3651,7792,15896,3380,4264,3483,15899,1697,6964,1067,15900,
+5940,3650,4270,2122,3363,15901,1480,15902,2867,1482,15903,6776,
+1986,6166,15906,6777,6779,2232,15915,6778,3782,2621,5022,6781,
+4030,8335,2683,3079,1609,8014,6782,15939,1296,15940,7857,15941,
+2064,6783,2175,7819,3455,15958,4176,7008,15959,7009,15960,7010,
+2575,15961,1768,2301,7012,15964,2930,7011,4122,15965,7014,983,
+2235,4198,7013,15971,1330,1669,7020,7019,3010,7017,4495,3630,
+2305,2085,7022,7021,7018,1128,15979,4513,4253,2278,3207,4128,
+15986,4555,1938,7023,15987,1530,8134,15988,3685,2538,7025,7028,
+15994,7027,7030,7026,15995,2003,7029,3592,7032,7034,7036,1380,
+9646,7031,16010,7037,7040,7937,7038,8704,7043,16021,7039,7042,
+7044,16022,7045,9650,3792,7048,7831,7047,16025,2623,7041,3444,
+8363,16026,1396,1114,3588,16027,7050,7056,4463,7053,9651,7046,
+16036,7055,7052,7049,16037,8232,7054,16040,9649,948,7057,7059,
+16049,7061,16050,9644,7060,16054,7058,7758,8706,4043,9643,8838,
+16057,9645,16058,9654,16059,7062,8675,7063,8751,8549,9655,1448,
+7913,994,996,4400,16070,1445,16071,2213,2015,6957,947,16078,
+6959,6960,7717,4580,7112,16103,7113,9664,16107,8858,4560,2985,
+16116,4244,16117,4205,6795,966,4438,4087,2131,1927,16120,2437,
+16121,1730,1442,2957,8814,2768,16126,8125,16127,8068,8370,6796,
+16128,8259,2850,1505,16135,6744,2729,16136,4528,3917,6747,2959,
+16142,1563,16143,16144,3384,2753,16149,2369,16150,6746,6752,6750,
+4487,2788,16166,6751,6754,16170,4420,4044,6753,16174,2773,6755,
+2433,2331,6756,16180,3658,16181,4100,4642,4503,16185,6760,6761,
+2261,3492,6763,1532,16208,6764,2851,16209,6762,2223,1166,6767,
+4720,6765,6768,2798,1303,6769,6766,3878,6770,2718,16248,5269,
+3026,16251,3139,16252,4596,1450,16253,3495,9863,3676,16258,6774,
+4433,9456,6775,16264,7550,8864,2737,7114,3407,4186,16293,4521,
+16294,6938,16295,2311,16296,2196,6939,1547,950,8107,6690,16302,
+6691,3848,1612,2432,6692,2706,3305,3093,2368,6696,3001,16318,
+4089,16319,4614,16320,4107,16321,16322,6704,6708,16326,6706,6714,
+4489,16327,6709,6707,6698,3362,4373,6705,16337,2532,16338,1316,
+9896,16341,1857,16342,6716,6717,16347,6710,16348,6715,16349,3847,
+9445,16366,6718,2619,4247,6711,3218,8698,6722,16388,1488,2652,
+952,3550,1047,16393,6720,3740,1475,16397,6721,6719,6723,1499,
+16400,6724,16401,6725,16402,6728,16403,1077,16404,8520,2999,2145,
+6726,3599,1201,9446,6727,8439,16413,8299,16414,2894,6731,2501,
+1387,6729,2385,6730,8871,9451,2824,6733,16451,6735,6737,16490,
+8166,9447,8210,7916,3413,6648,2524,16505,3360,16506,6649,3085,
+6650,16511,3084,6651,4675,6657,4608,3370,3555,6658,16525,6656,
+3926,16528,6660,3024,2099,16533,6659,1436,2059,16541,6661,4875,
+2252,2658,6662,8038,9436,1694,9890,6665,8206,16581,9435,7864,
+16582,6666,4306,4708,2518,16588,3162,1923,16589,4014,3506,16590,
+3691,1125,16595,3180,16596,4565,2387,2800,6943,1272,16613,3157,
+4118,16614,4551,16615,6944,16616,6942,16617,2066,1259,4173,16627,
+2037,3854,16630,6948,6947,1265,16637,3341,3493,6949,16650,1298,
+7808,16665,3799,6952,16669,6951,16670,1439,2125,2065,16671,1760,
+9847,9764,8041,8747,9599,8027,8603,16704,9853,4049,16712,2286,
+3179,1324,7068,3692,16717,3153,4430,16718,7069,16719,7070,4139,
+4558,7071,2210,1331,2284,1375,3808,16732,2412,7073,2439,7072,
+16737,7075,8608,8582,16738,7074,7076,8429,7844,8417,16756,9656,
+8800,16757,8418,2539,2281,2280,4451,2351,16776,3680,7065,2224,
+16782,1546,4592,7267,7268,16793,1736,16797,981,16798,7269,16799,
+7273,3558,7275,16803,3953,1075,7272,7279,16809,1458,7287,16812,
+7282,7284,7283,1688,16816,1064,16817,7278,7274,1467,16818,7280,
+7281,16821,7285,7277,16826,2134,16827,2630,16828,7286,7290,7745,
+7276,16835,1449,16836,2239,7292,1601,2429,4605,3683,16839,1395,
+16840,1190,16841,7288,16842,7289,3313,16843,7293,7294,16846,7297,
+7299,7298,7291,16861,2423,16862,1300,16863,7296,3110,16866,2149,
+8070,16876,1816,1140,2067,16882,3544,7309,7305,1845,7310,7306,
+2696,7308,7311,7304,2160,8115,7314,7919,16910,4618,3017,16911,
+8868,16912,9704,7315,7313,16917,2639,1752,7317,8465,7320,2516,
+16937,9702,7323,16945,7322,16946,9703,7326,7321,8257,16956,7324,
+9706,7327,16970,8079,16971,9708,7329,2014,7328,9707,8400,8221,
+1157,7332,7331,16992,8183,7821,2081,9710,8250,9701,9709,17024,
+8201,17025,8293,9891,2780,4853,2507,7370,4654,7372,2540,3048,
+17055,1369,4436,7374,7373,7375,3535,7376,17061,4356,4575,2564,
+7377,2267,7385,17083,7381,7384,17084,1972,17085,1757,3610,7386,
+17093,1185,2776,9717,7932,4390,2372,8228,7387,2933,9883,17108,
+9715,17109,8921,17110,9716,17111,7399,9243,17112,3874,8136,17115,
+8059,17116,9245,17117,8780,8008,9244,8447,3800,8602,17118,8337,
+9251,7835,9250,17123,8464,17124,8845,8049,7928,9249,3533,7923,
+3564,2502,8625,9254,9253,8480,8474,9252,17143,9256,9258,9257,
+17146,8852,17147,8894,17148,7729,9260,17156,8117,9259,8111,8296,
+8676,7969,17174,8449,8572,8522,9261,8148,7400,17184,8145,7731,
+17192,9263,9262,17195,9264,8667,8889,17212,9270,7822,9273,8645,
+9271,8594,7402,17222,9274,7961,8588,7744,8883,8287,9272,9266,
+8820,17226,7836,9265,8325,8119,9267,8276,8670,17240,9268,9277,
+8073,9276,8046,7896,17246,7871,9285,17247,8777,9281,17250,7751,
+8022,8598,17255,9283,9279,17256,8227,17257,9282,9278,17260,9894,
+9038,9286,9291,9284,9255,9292,7951,17286,9287,9289,9288,7939,
+17296,9290,8540,8891,9296,17299,9876,9295,9718,8273,17300,9294,
+17301,7675,17302,8890,8045,9298,9297,7403,9301,17318,8841,8470,
+8486,8033,9885,17335,8074,9302,9305,9304,8058,9293,9303,9299,
+17353,9248,17354,8671,9861,17355,7790,8740,9840,17359,8634,17360,
+9306,7404,8191,6099,2287,6100,1955,6101,3896,6102,4351,2089,
+2112,3245,3778,6105,17365,1346,6106,3309,1748,2860,17366,4666,
+2689,1652,4540,3797,1633,2919,6107,3916,2560,4678,3369,3877,
+4526,4564,6111,1016,3349,4214,2268,6114,1022,3257,2226,6115,
+3233,17369,6116,2043,1779,4045,6117,2702,2343,2203,3684,2333,
+4016,17370,3548,3619,2111,6120,2075,4034,6121,17371,4035,3383,
+3771,2789,6127,1066,1302,17372,4664,4449,6130,2675,4631,2141,
+2794,2477,2076,17373,6126,1551,6138,17374,1999,1471,2669,1097,
+6141,4344,6142,1722,6144,6143,1673,17375,6145,1215,4236,3562,
+2202,6162,7262,17376,1746,17377,3212,7263,17385,9698,17392,9882,
+17393,1847,3753,4766,1896,17396,2693,6785,17397,1600,6787,17402,
+6786,992,6789,4471,4684,4546,17411,7914,6791,3463,17412,6790,
+7724,17415,6792,8290,9457,17425,9458,17426,4123,17427,3129,17428,
+2757,7364,4010,7365,17441,3912,3221,9714,17444,7366,17445,8725,
+17451,7369,4878,1785,5997,4309,17459,7390,17460,3803,7064,17468,
+4213,17469,7391,8622,17473,3925,7392,1461,1383,7394,7393,7395,
+7397,17491,1897,970,17492,7398,8416,17498,1610,4212,4146,2490,
+17502,2377,6483,4480,6426,7127,1591,3480,2864,17509,7115,17510,
+7116,1782,7117,1915,4360,989,7119,17516,7120,7125,7124,2966,
+17519,9666,17520,9665,7126,17523,1593,17524,7128,4149,5297,3519,
+1281,17527,1411,17528,1787,2903,7129,2573,2628,4527,7131,7132,
+17540,2547,17541,8488,17542,3031,17543,2314,7133,1362,8215,7840,
+7134,8485,8525,17561,9668,8349,8842,17562,9667,8569,8248,6686,
+6685,3541,4197,8533,3510,4473,17568,3261,17569,2506,2068,3951,
+17578,4577,17579,1542,1747,6512,1737,17580,6511,1227,1826,4522,
+17581,1681,1639,2138,1627,6518,17585,6519,964,2396,17586,6517,
+4322,17587,6520,1643,17592,6514,6516,3375,4566,4462,3965,6527,
+3783,6528,17593,1417,1052,6530,3576,2967,6531,17606,6529,2976,
+6526,3387,6533,1030,4717,7111,17611,6534,6042,6537,17612,2421,
+4175,6535,6540,1767,6536,17613,2187,17614,4003,17615,962,17616,
+6541,2879,8658,1379,2717,2092,4387,3081,2871,6543,2920,4873,
+17627,1144,17628,6548,17629,2198,9415,1703,17647,3714,6549,6545,
+17651,2556,8825,3654,17663,6550,17664,2459,4159,6551,17665,8483,
+17666,1706,1704,17667,6552,3128,3748,9413,6557,9417,3987,8340,
+6562,17678,6558,17679,8854,17680,6561,3284,17681,4133,6556,7799,
+1716,3910,2888,3629,3705,1021,17687,6566,6565,17693,1145,1755,
+17698,6567,1109,17705,7942,3608,2823,3858,6576,17712,2995,8345,
+6570,5697,6574,17727,7853,9416,8360,3711,6575,1092,4252,8223,
+6573,17732,6571,8389,17733,9418,8176,17742,9414,8797,8926,6402,
+8236,17752,4657,17753,7337,1305,8545,4490,2297,17764,7333,17765,
+4143,17766,7336,2298,4292,8763,8665,8139,8137,17767,7266,17770,
+3453,17771,3653,5656,3497,17778,3831,4570,17779,7344,17784,1908,
+7345,1006,7342,17785,7343,2163,1180,17786,1573,1143,3900,7346,
+1327,17787,7347,3672,17797,7352,17798,7353,3527,7777,7355,9711,
+17818,8088,17819,7357,7388,2565,2139,8072,3300,4103,6001,8696,
+17826,5089,4188,5090,951,5091,2219,17831,5095,4728,17835,5093,
+4312,17836,3343,5096,5092,17837,5097,2727,5098,5107,5099,3822,
+4516,17844,5117,17845,5115,5120,2231,2642,17848,5094,5113,5116,
+5100,1647,976,5109,3977,5103,1981,17849,1625,5114,5108,5101,
+3160,17852,8994,17853,4072,5102,3772,5104,17860,5105,1179,5119,
+3530,17861,4346,5129,5133,3577,5140,17862,2796,5130,2382,5127,
+17865,1029,1807,5139,5121,17866,5106,5124,3279,2413,9014,1062,
+17873,4231,5123,17878,3034,17879,5132,4639,2740,1619,3150,2734,
+5136,5126,5145,5122,5131,17887,2260,5125,17888,5134,17891,5158,
+5135,5166,5141,2142,1351,2728,1198,5160,17906,5152,17907,5149,
+17908,5162,5148,4215,1199,17909,3250,3262,5161,17910,5147,2258,
+5154,17918,1188,5153,2153,5142,2009,17924,2526,17930,5151,5156,
+5159,1429,17931,3252,2044,5164,5163,4240,5165,5167,5169,4216,
+5168,1920,5173,5186,5181,5184,5180,3053,2525,8875,5146,5178,
+8127,17958,5187,5150,5179,17961,5188,17962,5176,17963,8061,9011,
+5189,5183,5177,2829,5172,2462,2548,17972,5182,2054,5185,4237,
+5190,17973,5191,2732,5214,5192,5213,17979,1814,2308,17982,2345,
+5206,17989,5201,17990,5195,1170,5199,17994,5207,1131,5217,3055,
+5212,8013,5216,2603,1635,5193,18016,5209,3620,18017,5205,9012,
+8177,5198,2765,3035,3773,5208,18020,5204,5202,2691,5215,3937,
+3283,5228,2699,5219,9030,4599,18072,5221,5220,1771,5218,3054,
+18077,1516,9031,18078,8595,5230,18081,1968,4388,5235,18082,9889,
+18083,1363,18084,5222,18085,2440,5231,8034,5227,18086,5225,5226,
+18098,2176,5232,18099,5233,9037,9032,5249,18106,2766,3056,18128,
+5248,4501,5247,5244,18132,7776,5240,18133,5243,9029,5236,3251,
+5242,7954,18140,5237,5238,3559,18143,5241,2465,18152,2094,5245,
+5251,18155,5250,5239,2991,18161,8216,9013,5255,5262,9020,18173,
+5261,2804,18190,2722,9839,9041,5257,18198,1171,18199,8096,2891,
+3446,8731,3131,5254,5256,5258,5260,949,1079,9026,18218,5270,
+9039,18221,5264,2183,3274,9028,9009,18228,9035,5259,18229,9019,
+5263,9040,18237,5266,5265,7860,8614,5271,18247,4367,9045,18250,
+5277,5268,5272,1034,5280,18258,5275,9022,18259,8052,18260,9008,
+5276,18263,9856,4047,5279,5273,18278,8081,18279,5274,8455,3976,
+5278,3460,5283,5282,18289,5281,9023,8180,9027,1183,2799,5284,
+18308,2939,5286,8722,3628,8711,1607,9049,8788,18333,9010,7718,
+9047,4392,9048,5289,8258,8531,5288,18368,5290,4443,18382,9043,
+18383,5292,7152,1975,2649,2929,2670,7153,7829,4020,18405,8265,
+18406,4290,8002,1291,7154,18416,7155,1950,7157,7159,7158,3545,
+3879,7156,3403,4182,2707,3794,7162,1025,7161,7168,18438,1174,
+4074,7164,7166,4396,7165,7160,7169,7167,18452,7163,7177,7174,
+7176,7180,7172,7170,7171,18468,3190,3352,18469,7178,1823,1425,
+7173,7179,7186,7192,7191,3725,18477,4586,7188,7190,7184,2720,
+18491,4478,7185,7189,7195,4257,9690,1577,18498,3464,18499,1665,
+7193,9687,7194,7196,7199,7197,4090,7187,18508,3706,18509,3806,
+4520,18510,7205,18511,2784,18512,7202,2458,7214,7200,18515,7203,
+7206,7212,4241,7207,1212,7220,18543,3958,7223,18548,8494,18549,
+2013,18550,7227,7224,7226,7228,8626,7221,18566,7219,1970,18570,
+1500,18571,8606,7217,7225,7213,7238,9692,7235,7222,18581,3253,
+8300,2813,7239,7241,7236,18605,7230,7243,18609,7242,2692,9696,
+18614,7246,8827,18620,7233,18621,9694,18622,7249,7244,7247,7232,
+7245,9685,18640,7240,7251,18645,7787,18646,7253,9691,3970,18654,
+8721,7256,18657,4877,18661,8745,9686,9693,9695,18670,7255,18671,
+3263,7254,8175,18679,7259,1347,9688,7977,6797,7260,18698,8310,
+7261,7338,3985,8855,9872,18708,3995,4101,8511,3899,2215,18716,
+4076,18717,8600,18718,7816,1945,5613,4169,7078,1152,1110,7079,
+18724,3321,1257,18725,4870,18726,3482,18727,7080,4563,18732,8844,
+7081,7358,7082,18736,4335,7083,18737,971,7359,1407,18742,2972,
+7084,18760,4871,1060,18767,3867,1162,2586,4621,7085,7088,9713,
+7090,8204,4874,18793,4200,4326,7361,3220,7768,8876,18798,7362,
+7089,7091,2416,7092,7098,7093,18810,3338,2978,2698,1877,7095,
+9895,7097,18816,1933,18830,1032,7101,7100,7094,7102,3707,7105,
+5945,18852,8161,9659,7104,18853,7106,18854,9662,9660,7363,2244,
+9658,9663,18889,7108,8583,18893,9835,3846,18909,4145,18910,7135,
+8502,18925,9400,8420,18941,9401,8189,18954,9403,7981,2158,1844,
+18955,1855,2782,3434,6458,2475,2340,7513,18963,7514,18964,7512,
+2227,18969,7515,1320,6592,9737,18980,9738,18981,7828,4093,8927,
+7883,7949,4862,8055,18992,8683,18993,8929,18994,8559,18995,8928,
+8682,18998,8930,8395,18999,8056,7906,19002,8690,19003,8528,8147,
+19007,8933,8532,19019,8935,8936,19032,6788,8932,19038,8810,19039,
+8939,19040,8937,8381,8950,8679,8726,8492,19053,7784,8946,7991,
+8947,19054,8943,8016,7952,8648,19055,8945,8941,8862,8940,8162,
+19067,4323,3631,3419,19073,7855,8758,19076,8951,8765,19080,7810,
+8118,19081,8612,8618,8952,8529,19082,8032,8517,19089,8156,8960,
+19101,8884,8553,19104,8957,19105,8426,19106,8948,19107,8955,19108,
+8956,8231,8288,8959,8958,7879,19115,8972,8949,19119,8966,19120,
+8970,8659,8963,19124,8967,8971,8031,19127,8969,8962,7940,8861,
+19130,8699,19131,8968,19132,8364,19133,8334,8965,8599,19134,8561,
+8856,19135,5948,8322,19141,8977,8964,19145,8975,7733,19146,8401,
+8976,8099,19147,8662,7519,19155,8973,8978,8333,8979,8982,8043,
+8980,19192,8496,8981,8552,19193,8388,8984,3016,8729,8727,7789,
+8440,19236,8187,8985,8974,19242,8983,19243,4887,2105,1512,1719,
+3242,2072,3625,3230,4890,3100,19244,4062,4208,4063,2106,19245,
+2179,2041,4081,4893,4024,1582,2690,19246,3524,1674,3361,1632,
+2342,4515,3039,4676,3405,19247,4426,3540,4496,4896,4574,1357,
+4898,4897,19248,4210,3435,4902,3394,1268,4590,4905,1989,1423,
+1863,4056,4207,4908,1726,3927,1206,19249,2236,3819,4308,4911,
+3842,4912,4282,2042,4913,3498,3525,4914,3176,4589,4915,2934,
+1536,4916,1641,2395,4917,4918,3490,4919,1496,4920,2571,4632,
+4921,3595,19250,4209,2836,4922,1502,2022,4923,3966,1214,4931,
+4929,4113,4930,2778,4932,19251,3974,4140,1028,4936,3112,4937,
+2248,2726,2818,3594,2473,3062,1528,7414,8392,7415,3936,2004,
+1911,4328,7504,1043,1209,1928,7506,19314,2743,7739,8831,19329,
+7948,7769,7972,8378,8037,7920,8548,7984,8801,8866,9387,19336,
+9391,7912,7993,19337,7752,8304,7848,19338,9388,7927,8566,9389,
+19339,8315,8005,9386,8267,8239,8026,9392,19340,8887,8063,19341,
+8805,9394,8475,7761,19348,9396,9395,19353,7839,19354,8472,19355,
+8372,9135,8635,8306,8085,19356,7946,9398,8849,9397,8824,7892,
+8873,9399,7976,8457,8903,19370,9390,8881,8806,19377,8795,8900,
+19378,8469,19379,8746,9393,7957,8796,1053,4491,1717,19389,1802,
+1165,4403,3898,999,4460,2058,4553,1620,3587,3029,1098,1811,
+4603,1850,1598,2157,3660,1868,6446,1406,2744,1646,1935,6447,
+4407,6448,2121,2036,6449,2599,2655,4386,4647,3351,1710,1539,
+6455,3457,3334,1360,5691,2979,6456,2464,19392,4629,6457,4617,
+3287,4745,4739,4385,19393,4412,3325,4243,1742,1285,19394,3355,
+7412,1932,19398,7413,7407,1707,4469,1738,3087,7408,1233,4352,
+3188,7409,7956,7411,9720,4672,2944,7452,7447,19450,7455,19451,
+7454,19452,4537,7453,4353,7456,19456,7464,986,1497,19461,19462,
+2973,7459,7463,19469,2319,7460,1781,7468,7471,2420,19476,1867,
+7448,7465,3659,19482,2156,19483,7469,1572,7470,19484,7473,7472,
+4256,19495,1297,3575,8084,7475,2320,7476,3634,7479,1167,4662,
+19516,7477,19517,7478,7480,19518,7486,8752,7484,7483,7481,19528,
+3638,5947,1433,7487,7492,3574,9725,1446,1195,19555,7496,7493,
+19556,1558,19557,7497,19558,7494,9727,19562,7495,1373,19565,4397,
+7498,19569,1310,19570,9724,7820,9730,19571,8781,19572,7499,7501,
+9732,9726,9731,7500,9729,19578,7502,19579,7503,7843,9736,9735,
+3366,1795,7803,8807,7990,8150,6392,8672,19616,9356,8857,9361,
+9366,9359,9362,19647,9367,19648,8113,19652,9370,19653,9369,19654,
+8792,9368,9371,19662,7945,8422,8230,9375,8025,7995,9372,7738,
+8283,8816,8759,9426,19692,8627,8773,9377,8828,8112,8006,19713,
+9088,9365,19714,9360,19715,1242,4417,1861,4036,19716,6369,4615,
+6370,2685,3272,1947,6377,6376,3166,6380,4379,6381,2207,19717,
+2208,6384,1699,2567,6385,1051,2025,1870,6386,19718,1685,2080,
+19719,3451,5492,4338,3882,4440,6390,4479,6391,3980,1813,19720,
+1354,1090,7728,19726,19727,1105,19728,7837,7755,7754,1250,3267,
+8362,2578,1394,3109,4285,19739,3096,4065,19740,1878,2716,4242,
+19746,4366,2253,19747,5950,1618,5951,1998,4483,19750,2249,4345,
+3764,2549,1278,3657,19753,5954,5952,5956,19754,5958,5955,1456,
+3047,19755,1501,5953,19756,3469,5957,9851,2777,1070,2070,3708,
+3522,3425,3622,5960,5959,2889,4042,4064,5961,19768,5964,19769,
+3689,4591,5963,1470,19770,3695,9202,5965,1529,19771,8830,3673,
+1853,19772,3420,1270,3534,4399,5966,1671,8217,5969,1409,5970,
+19785,4196,2694,1071,19788,4295,1564,3553,19791,5971,8787,19797,
+1106,7998,1587,5974,1441,7846,8590,19798,4172,5976,5978,8684,
+19801,7870,19802,8778,19803,5977,3119,19804,4138,5975,8499,4389,
+4475,7812,19813,5980,4686,19814,8399,8674,19815,8719,19816,8233,
+5981,19817,1093,4132,8307,5982,5984,8021,9201,5983,19820,7750,
+5985,8291,9203,4191,19824,1452,19825,6167,19826,4967,19827,4970,
+19828,4968,19829,4969,4972,3994,2858,3963,19838,4971,19839,4271,
+1889,4978,3182,19840,4974,4973,3348,4975,19841,4977,4667,4976,
+2595,4983,4980,19848,4984,2484,4979,4982,4514,19854,4985,4990,
+4988,1913,19861,8990,19862,2353,4987,4986,4362,1158,4991,19868,
+1874,19869,4992,1248,8755,1531,4993,19880,1588,19883,4994,19884,
+8992,8892,19895,8988,19896,8785,4995,4997,8839,19914,4999,8237,
+4998,7851,19915,8989,19916,8991,5000,8987,5002,19929,8993,4276,
+7416,3186,4640,2981,7417,19930,2293,4368,3581,7422,7421,1887,
+7420,3531,7424,2493,19944,1295,19945,3675,7425,7423,2181,7428,
+19946,7429,2206,2749,2414,3542,7430,7432,19955,1343,19956,4682,
+19957,1370,7431,7434,7433,7435,3996,2774,3204,7823,7438,8716,
+8100,7443,7442,8347,8664,19990,9722,19991,9721,19992,1168,19993,
+4281,3428,8500,2522,4567,4151,2568,19994,2241,9464,19995,9463,
+7880,9462,1701,8832,7877,9467,9466,20005,7917,9469,20017,9465,
+20018,9470,8397,9480,9476,9471,8336,7901,7973,20032,9475,9474,
+7802,8358,7953,20047,9479,9472,9477,9497,20054,9493,9484,8241,
+9483,9487,9498,9481,9486,8756,9491,8064,9495,9494,9485,20076,
+8403,8314,8398,8106,20101,9502,7967,9517,8733,9522,20107,8571,
+8623,20118,9516,9512,20121,8332,20122,9519,20123,8636,9525,20129,
+8717,9510,20130,9524,9514,9503,9521,9500,20131,7553,8653,20139,
+8666,20140,8562,9534,8271,20145,9539,20146,8663,20147,7740,7554,
+9535,20165,9540,9507,7824,9530,9541,20169,9533,20170,8385,8451,
+9504,9532,9531,9528,9536,20177,8141,8880,20196,9542,7834,9554,
+9520,9545,9553,7882,20204,8402,8120,20208,8313,9549,7845,8268,
+8320,9837,20217,9527,7555,20223,9546,8632,20224,9550,9468,9556,
+7996,20230,7893,9559,9555,9544,7556,20253,8412,8087,9557,8316,
+20270,9562,8542,20285,9568,8610,9044,9571,9511,20297,9518,9560,
+20298,7963,20299,8835,20300,9572,8352,20303,9573,9581,8224,20318,
+7557,20319,9567,9578,7681,9529,9564,9579,7791,20330,8132,9575,
+20331,9563,9515,20347,9585,20348,9591,8234,20369,9526,9587,9583,
+8851,9592,9594,8198,20391,8567,9499,20394,9508,7559,9595,9593,
+20407,9574,8083,20413,9596,9597,20427,9586,7560,20433,9588,8782,
+20436,8646,8351,20441,9590,8292,8895,9756,8798,4492,1507,6802,
+6801,20449,1613,1495,6807,6809,20450,6808,20451,1729,1562,1235,
+4562,2857,1054,1745,4354,3154,2346,3816,1804,6816,6815,6818,
+6817,2918,3115,6821,3116,6822,1134,2123,6830,4272,3661,1139,
+2606,6831,3107,2738,20452,6846,6845,20456,6847,3678,2664,4418,
+6851,3872,6857,6856,6858,1776,2815,2195,4166,1216,4223,6864,
+4604,6865,3051,20458,2557,6868,3943,3565,6870,6869,1311,1873,
+1667,3978,3276,3635,4481,6883,1392,2735,6884,20459,20460,3852,
+6888,2695,1339,4627,2246,20461,3892,6891,6892,1510,2159,2321,
+2769,20462,6895,6903,3135,6937,1548,6899,20463,1541,2755,6902,
+20464,4499,20465,6907,2906,20466,6908,2907,1759,1026,20468,6918,
+2276,6921,2499,20470,6933,2550,3919,7797,1225,8317,20480,9151,
+8467,7749,20485,8152,9156,20486,9154,8452,20487,8637,20488,8071,
+9155,8003,20500,7966,9849,7915,7989,8330,20503,9159,9161,9158,
+8691,20513,8695,9167,9166,9162,9165,9836,20519,9153,20520,8174,
+9169,8184,9170,9172,7832,7980,20532,9173,7793,9873,2762,5765,
+3322,5766,20539,1086,3801,1334,3277,5767,3901,5768,2135,2763,
+4419,2873,1860,3796,5771,2811,5772,20540,1604,1774,1929,4359,
+5775,20541,5776,4084,4095,5781,1218,2470,5782,20542,2454,20544,
+1714,4948,20545,1554,20546,4950,4949,4951,1629,4125,4220,4500,
+2216,4677,4954,4953,20563,941,3716,20564,4955,20565,1720,2109,
+2660,2635,1255,4956,20566,2641,2835,2182,4957,3323,1094,20576,
+8468,20577,4958,20578,1527,4349,8836,1314,4959,4364,3906,2980,
+20581,4960,8732,20585,4961,7806,4962,2611,3624,3914,8269,4300,
+2632,20597,4963,20598,7897,3546,20599,4964,8114,3547,4229,1775,
+8786,20603,4965,954,3875,20604,8057,4464,3554,8535,20615,8639,
+4966,8735,20621,5764,8253,20622,2542,20623,8213,7545,20624,9893,
+2868,20625,3219,4108,4006,4078,2082,1830,20628,6940,1353,4255,
+7548,1312,1490,8534,8516,20637,7825,8791,7551,20641,8202,8338,
+4303,7521,4050,8784,7522,2604,2498,20654,1035,20655,7875,3836,
+20658,4019,7525,3939,20661,7524,4497,7526,2750,2057,7528,7527,
+3487,20675,3881,7531,20690,2653,991,3002,9741,7532,9740,20702,
+9742,3165,7520,2273,9739,1478,1636,20721,2380,2775,2795,8899,
+1770,2250,4046,20735,987,3959,20754,955,20755,7971,20756,20757,
+7628,7630,20776,1095,20777,7629,7632,20780,7633,9823,20798,8589,
+8445,9319,20812,9318,3763,3240,20820,1890,4219,20826,4370,3345,
+8649,20835,8713,7881,8425,20836,8650,8518,9669,8668,20837,9310,
+20838,8527,20839,8769,8586,7727,7900,8383,8244,8718,20852,9675,
+9676,8131,8377,20869,8577,8563,7905,9677,9678,8694,8779,9681,
+20890,7872,9682,20898,7978,7794,9683,8638,9684,8260,20904,9679,
+8435,4154,1508,3175,7136,3931,3496,4022,6183,3736,1828,1560,
+7137,1007,3521,7138,4327,2644,2613,3043,2272,7139,2120,20905,
+20906,7142,4170,3028,20907,3704,7143,20908,4246,2386,3637,20909,
+4094,1581,20910,1219,3202,7936,20916,9880,20917,9848,8376,20932,
+9424,20933,9425,20941,6586,1638,3402,9115,20946,9854,5658,7655,
+9117,20951,9121,20952,7921,8734,20955,9122,8523,7734,8501,20963,
+8109,20967,7763,9123,8707,20971,7911,7656,1172,9124,8343,7908,
+9118,21006,8245,9127,9128,21010,8309,8171,9132,8042,8441,21017,
+7659,7658,21018,9830,9831,21023,7788,9133,5661,21027,2069,21028,
+1622,4226,2165,3429,1038,3516,21029,5668,1595,3231,5669,2201,
+21032,1126,5670,21033,1589,5671,2876,5672,3911,1846,5673,2444,
+21036,5674,1213,21037,5675,21038,2620,3438,4718,4857,3920,8301,
+8770,7938,8579,21057,7813,8681,8869,9223,8138,21084,9218,8066,
+9224,9220,21087,8497,21088,8580,21089,9219,21090,8302,9227,8151,
+21117,7811,9230,8391,9229,9200,21153,9233,9236,21154,8560,9221,
+8460,9237,8294,21165,9042,9235,9232,9225,21172,9240,8103,21178,
+8700,8129,9222,8270,21186,9242,9241,9228,21191,2708,4329,3717,
+4058,1280,3194,21192,1148,2662,6074,3410,2307,6077,4609,3718,
+6079,2128,6078,2709,21193,2191,6082,2701,1886,6083,21194,6084,
+1271,4114,2354,6085,3086,6088,3020,6089,21199,3296,4583,6097,
+21200,6098,1824,7721,7635,7634,7638,7636,1880,21211,7639,21212,
+7640,7642,7641,7644,9825,21225,7647,9892,3549,8564,9827,9826,
+21226,1754,7660,21233,7661,7664,21242,7666,9845,7663,7667,21252,
+7665,8524,21262,7668,9850,21267,7669,9832,7672,21283,7888,21284,
+8342,21285,9164,9160,5019,21290,8766,4704,6003,1862,2442,2047,
+7649,3046,7648,21303,7650,7652,7651,7653,9829,3785,21307,7654,
+9828,21313,8761,9760,21349,9761,9762,21360,9767,7737,9765,9774,
+9771,9770,9773,21381,9768,8633,9782,9776,9784,21404,8205,9783,
+9797,21414,9786,9795,21419,9792,9789,9793,21423,9790,9791,8128,
+21426,9785,21442,9804,9799,9803,9800,21456,9802,8456,9780,21471,
+9809,9808,9810,9778,9806,9811,21480,9815,21481,9781,21482,9779,
+21483,9814,9813,7757,9819,21502,9818,21503,9817,8238,9775,9798,
+21508,9766,9763,21531,9777,21532,4296,7561,21535,2650,7562,7568,
+21540,1044,7569,21541,3895,21547,21548,7588,21549,2263,21551,2596,
+7622,7941,8331,21578,9601,9603,9602,21594,8686,8771,21611,9607,
+21612,9608,8701,21618,8687,9610,9612,8144,9618,9615,9620,7904,
+9617,9621,9623,21672,8374,9605,21697,9625,9626,21711,9627,9824,
+9632,9628,21743,9631,21744,8044,8366,21762,9611,9635,9609,9637,
+9638,9619,9639,8738,9641,9633,9642,21816,9616,9614,2900,6965,
+2073,6966,2814,21817,2937,4068,21818,4069,21819,4117,21820,6973,
+6972,4330,21821,3715,6974,6976,6975,1766,6979,1951,21824,2328,
+6982,1579,21825,6989,2997,21826,6990,6991,21830,6992,7637,21831,
+21832,6996,6997,1934,21837,4234,7005,21840,7007,21841,9864,9886,
+9723,21845,8076,8692,7446,2656,7680,2651,7682,21868,7683,8305,
+2714,7406,9871,2704,21889,8922,3465,2515,6954,21901,1937,7873,
+7688,7687,21909,7689,7692,21912,7691,7859,7690,7693,9834,21919,
+9866,9833,21922,6741,21923,9752,7542,9753,9754,21933,7543,21934,
+7544,1509,21935,4724,1821,21938,9843,21939,4721,21940,5087,3466,
+21947,7695,7699,21966,7698,21967,1072,21968,8390,8811,9427,3082,
+6594,7814,21982,9743,9744,9746,8240,21991,9841,9750,21997,9749,
+1282,7533,7534,2605,3198,7541,8247,7970,9453,2627,1793,6740,
+7988,1859,4851,22056,22064,22076,22093,22110,22126,695,698,573,
+575,574,10013,598,10014,355,10015,265,
+};
+
+static pdf_cmap cmap_UniGB_UTF16_H = {
+	-1, "UniGB-UTF16-H", "", 0, 0, 3,
+	{ {2,0,55295},{4,56320,57343},{2,57344,65535}, },
+	6080, 6080, (pdf_range*) cmap_UniGB_UTF16_H_ranges,
+	9548, 9548, (unsigned short*) cmap_UniGB_UTF16_H_table,
+};
+
+/* UniGB-UTF16-V */
+
+static const pdf_range cmap_UniGB_UTF16_V_ranges[] = {
+{8212,0,598},{8230,0,599},{12289,6,0},{12296,29,584},
+{12304,5,594},{12307,0,7706},{12308,5,582},{12310,5,592},
+{65281,0,578},{65288,5,580},{65292,0,573},{65294,0,7707},
+{65306,5,576},{65309,0,7708},{65311,0,579},{65339,0,7709},
+{65341,0,7710},{65343,0,600},{65371,0,596},{65373,6,2},
+{65507,0,7711},
+};
+
+static const unsigned short cmap_UniGB_UTF16_V_table[4] = {
+575,574,597,7704,
+};
+
+static pdf_cmap cmap_UniGB_UTF16_V = {
+	-1, "UniGB-UTF16-V", "UniGB-UTF16-H", 0, 1, 0,
+	{ {0,0,0}, },
+	21, 21, (pdf_range*) cmap_UniGB_UTF16_V_ranges,
+	4, 4, (unsigned short*) cmap_UniGB_UTF16_V_table,
+};
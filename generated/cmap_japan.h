@@ -0,0 +1,11625 @@
+/* This is an automatically generated file. Do not edit. */
+
+/* 78-EUC-H */
+
+static const pdf_range cmap_78_EUC_H_ranges[] = {
+{32,377,231},{36512,253,326},{41377,373,633},{41633,53,727},
+{41904,37,780},{41921,101,790},{41953,101,816},{42145,329,842},
+{42401,341,925},{42657,93,1011},{42689,93,1035},{42913,129,1059},
+{42961,129,1092},{45217,6,0},{45219,21,1127},{45225,0,8266},
+{45226,29,1134},{45234,6,2},{45236,25,1144},{45243,0,7634},
+{45244,197,1152},{45294,0,7635},{45295,13,1203},{45299,0,7636},
+{45300,29,1208},{45308,0,7637},{45309,5,1217},{45473,33,1219},
+{45482,0,7638},{45483,37,1229},{45493,0,7639},{45494,9,1240},
+{45497,0,7640},{45498,9,1244},{45501,0,7642},{45502,13,1248},
+{45506,0,7643},{45507,157,1253},{45547,0,7644},{45548,73,1294},
+{45729,25,1313},{45736,10,4},{45739,209,1323},{45792,0,7647},
+{45793,97,1377},{45818,0,7648},{45819,5,1403},{45821,6,7},
+{45985,6,9},{45987,121,1409},{46018,0,6497},{46019,21,1441},
+{46025,0,5023},{46026,105,1448},{46053,0,7651},{46054,17,1476},
+{46059,0,7652},{46060,25,1482},{46067,0,7653},{46068,5,1490},
+{46070,0,5937},{46071,9,1493},{46074,0,7654},{46075,13,1497},
+{46241,129,1501},{46274,6,11},{46276,33,1536},{46285,0,7656},
+{46286,13,1546},{46290,0,6688},{46291,69,1551},{46309,0,7657},
+{46310,97,1570},{46497,37,1595},{46507,0,7658},{46508,77,1606},
+{46528,0,7659},{46529,245,1627},{46753,6,13},{46755,25,1691},
+{46762,0,7661},{46763,105,1699},{46790,0,7474},{46791,29,1727},
+{46799,0,7662},{46800,113,1736},{46829,0,7663},{46830,21,1766},
+{46836,0,7664},{46837,21,1773},{46843,14,15},{47009,9,1783},
+{47012,0,7667},{47013,69,1787},{47031,0,7668},{47032,49,1806},
+{47045,0,7669},{47046,29,1820},{47054,0,7670},{47055,9,1829},
+{47058,0,7671},{47059,5,1833},{47061,0,7672},{47062,17,1836},
+{47067,0,7181},{47068,29,1842},{47076,0,7673},{47077,45,1851},
+{47089,0,7674},{47090,25,1864},{47097,0,7675},{47098,13,1872},
+{47102,0,7676},{47265,73,1877},{47284,0,7677},{47285,45,1897},
+{47297,0,7678},{47298,241,1910},{47521,37,1971},{47531,0,7679},
+{47532,41,1982},{47543,0,7680},{47544,37,1994},{47554,0,7681},
+{47555,97,2005},{47580,0,5853},{47581,61,2031},{47597,0,7682},
+{47598,21,2048},{47604,0,7683},{47605,13,2055},{47609,0,7684},
+{47610,17,2060},{47777,197,2065},{47827,0,7685},{47828,73,2116},
+{47847,0,7686},{47848,45,2136},{47860,0,7687},{47861,37,2149},
+{48033,21,2159},{48039,0,7688},{48040,5,2166},{48042,10,19},
+{48045,45,2171},{48057,0,7691},{48058,273,2184},{48289,153,2253},
+{48328,6,22},{48330,49,2294},{48343,0,7694},{48344,17,2308},
+{48349,5,7695},{48351,125,2315},{48545,37,2347},{48555,0,7697},
+{48556,37,2358},{48566,0,7698},{48567,209,2369},{48620,5,7699},
+{48622,13,2424},{48626,5,7701},{48628,41,2430},{48801,13,2441},
+{48805,0,7703},{48806,49,2446},{48819,0,7704},{48820,41,2460},
+{48831,0,7705},{48832,81,2472},{48853,0,7706},{48854,33,2494},
+{48863,0,7707},{48864,13,2504},{48868,0,7708},{48869,101,2509},
+{49057,33,2535},{49066,0,7709},{49067,181,2545},{49113,0,7710},
+{49114,21,2592},{49120,0,7711},{49121,29,2599},{49129,0,7712},
+{49130,81,2608},{49313,6,24},{49315,121,2631},{49346,0,7714},
+{49347,137,2663},{49382,0,7715},{49383,37,2699},{49393,5,7716},
+{49395,21,2711},{49401,5,7718},{49403,13,2719},{49569,21,2723},
+{49575,6,26},{49577,61,2731},{49593,0,7721},{49594,69,2748},
+{49612,0,7722},{49613,5,2767},{49615,0,7723},{49616,57,2770},
+{49631,0,7724},{49632,33,2786},{49641,0,7725},{49642,81,2796},
+{49825,109,2817},{49853,0,7726},{49854,57,2846},{49869,0,7727},
+{49870,53,2862},{49884,0,7728},{49885,21,2877},{49891,0,7729},
+{49892,41,2884},{49903,0,7730},{49904,17,2896},{49909,5,7731},
+{49911,21,2903},{49917,6,28},{50081,21,2911},{50087,6,30},
+{50089,5,7735},{50091,5,2921},{50093,5,7737},{50095,53,2925},
+{50109,0,7739},{50110,197,2940},{50160,0,7740},{50161,13,2991},
+{50165,0,7741},{50166,21,2996},{50172,0,7742},{50173,5,3003},
+{50337,109,3005},{50365,0,7743},{50366,37,3034},{50376,10,32},
+{50379,5,3047},{50381,10,35},{50384,13,3052},{50388,0,8267},
+{50389,21,3057},{50395,0,4533},{50396,137,3064},{50593,6,38},
+{50595,13,3101},{50599,0,7749},{50600,21,3106},{50606,0,7750},
+{50607,25,3113},{50614,0,7751},{50615,29,3121},{50623,0,7752},
+{50624,29,3130},{50632,0,7753},{50633,5,3139},{50635,0,7754},
+{50636,17,3142},{50641,5,7755},{50643,13,3149},{50647,0,5855},
+{50648,45,3154},{50660,0,7757},{50661,33,3167},{50670,0,5200},
+{50671,13,3177},{50675,0,5430},{50676,13,3182},{50680,0,7758},
+{50681,21,3187},{50849,113,3193},{50878,0,7759},{50879,9,3223},
+{50882,0,7760},{50883,65,3227},{50900,5,7761},{50902,17,3246},
+{50907,5,7763},{50909,13,3253},{50913,0,7765},{50914,13,3258},
+{50918,5,7766},{50920,5,3264},{50922,0,7768},{50923,41,3267},
+{50934,0,6893},{50935,29,3279},{51105,29,3287},{51113,0,7769},
+{51114,57,3296},{51129,0,7770},{51130,113,3312},{51159,0,7771},
+{51160,57,3342},{51175,10,40},{51178,9,3360},{51181,0,7774},
+{51182,65,3364},{51361,9,3381},{51364,0,7775},{51365,33,3385},
+{51374,10,43},{51377,137,3397},{51412,0,7778},{51413,49,3433},
+{51426,0,7779},{51427,69,3447},{51445,0,7780},{51446,33,3466},
+{51617,0,3475},{51618,5,7781},{51620,41,3478},{51631,14,46},
+{51635,5,3493},{51637,0,7785},{51638,37,3496},{51648,0,7786},
+{51649,49,3507},{51662,0,7787},{51663,5,3521},{51665,0,7788},
+{51666,177,3524},{51873,133,3569},{51907,0,7789},{51908,33,3604},
+{51917,0,7790},{51918,45,3614},{51930,0,7791},{51931,117,3627},
+{51961,0,7792},{51962,17,3658},{52129,6,50},{52131,21,3665},
+{52137,0,7794},{52138,129,3672},{52171,0,7795},{52172,117,3706},
+{52202,0,7475},{52203,17,3737},{52208,0,7796},{52209,25,3743},
+{52216,6,52},{52218,17,3752},{52385,173,3757},{52429,0,7797},
+{52430,41,3802},{52441,0,7798},{52442,17,3814},{52447,0,7799},
+{52448,5,3820},{52450,0,7800},{52451,85,3823},{52473,22,54},
+{52641,65,3851},{52658,0,7804},{52659,113,3869},{52688,0,7805},
+{52689,9,3899},{52692,0,7806},{52693,17,3903},{52698,0,7476},
+{52699,53,3909},{52713,0,7807},{52714,81,3924},{52897,165,3945},
+{52939,0,7808},{52940,181,3988},{52986,5,7809},{52988,9,4036},
+{53153,0,7811},{53154,57,4040},{53169,0,7812},{53170,13,4056},
+{53174,0,6007},{53175,5,4061},{53177,0,7813},{53178,101,4064},
+{53409,209,4090},{53462,0,3751},{53463,157,4144},{53665,109,4184},
+{53693,0,7814},{53694,33,4213},{53703,0,7815},{53704,9,4223},
+{53707,10,60},{53710,193,4229},{53921,373,4278},{54177,57,4372},
+{54192,0,7818},{54193,33,4388},{54202,0,7819},{54203,137,4398},
+{54238,0,7821},{54239,45,4434},{54251,0,7822},{54252,73,4447},
+{54433,137,4466},{54468,0,7823},{54469,121,4502},{54500,0,3063},
+{54501,101,4534},{54689,109,4560},{54717,0,7824},{54718,145,4589},
+{54755,0,7825},{54756,105,4627},{54945,6,63},{54947,365,4656},
+{55201,373,4748},{55457,9,4842},{55460,0,7828},{55461,357,4846},
+{55713,249,4936},{55776,0,7829},{55777,41,5000},{55788,0,7830},
+{55789,41,5012},{55800,0,1447},{55801,21,5024},{55969,93,5030},
+{55993,0,7831},{55994,73,5055},{56013,0,7832},{56014,193,5075},
+{56225,141,5124},{56261,0,7833},{56262,13,5161},{56266,0,7834},
+{56267,49,5166},{56280,0,3490},{56281,69,5180},{56299,10,65},
+{56302,21,5201},{56308,0,7836},{56309,37,5208},{56481,373,5218},
+{56737,373,5312},{56993,93,5406},{57017,0,3181},{57018,85,5431},
+{57040,0,7837},{57041,141,5454},{57077,0,1535},{57078,33,5491},
+{57249,373,5500},{57505,17,5594},{57510,0,7839},{57511,221,5600},
+{57567,0,7840},{57568,85,5657},{57590,0,7477},{57591,29,5680},
+{57761,37,5688},{57771,0,7841},{57772,13,5699},{57776,5,7842},
+{57778,305,5705},{58017,37,5782},{58027,0,7844},{58028,237,5793},
+{58088,10,68},{58091,13,5856},{58095,0,7845},{58096,57,5861},
+{58273,161,5876},{58314,0,7846},{58315,33,5918},{58324,0,7847},
+{58325,33,5928},{58334,0,1492},{58335,125,5938},{58529,93,5970},
+{58553,0,7848},{58554,45,5995},{58566,0,4060},{58567,113,6008},
+{58596,0,7849},{58597,33,6038},{58606,0,7850},{58607,61,6048},
+{58785,93,6064},{58809,10,71},{58812,37,6091},{58822,0,7853},
+{58823,221,6102},{59041,145,6158},{59078,0,7854},{59079,221,6196},
+{59297,265,6252},{59364,0,7855},{59365,13,6320},{59369,0,7856},
+{59370,29,6325},{59378,0,7857},{59379,45,6334},{59553,73,6346},
+{59572,0,7858},{59573,21,6366},{59579,0,7859},{59580,221,6373},
+{59636,0,7860},{59637,37,6430},{59809,6,74},{59811,41,6442},
+{59822,0,3845},{59823,169,6454},{59866,0,1440},{59867,141,6498},
+{60065,9,6534},{60068,0,3358},{60069,5,6538},{60071,0,7862},
+{60072,81,6541},{60093,0,7863},{60094,193,6563},{60143,0,7864},
+{60144,57,6613},{60321,65,6628},{60338,0,7865},{60339,165,6646},
+{60381,0,1550},{60382,29,6689},{60390,0,7866},{60391,57,6698},
+{60406,0,7867},{60407,29,6714},{60577,173,6722},{60621,0,2730},
+{60622,105,6767},{60649,0,7868},{60650,37,6795},{60660,0,7869},
+{60661,37,6806},{60833,177,6816},{60878,0,7870},{60879,113,6862},
+{60908,10,76},{60911,61,6894},{61089,29,6910},{61097,0,7873},
+{61098,73,6919},{61117,0,7874},{61118,97,6939},{61143,0,7875},
+{61144,153,6965},{61345,373,7004},{61601,141,7098},{61637,0,7878},
+{61638,41,7135},{61649,0,7879},{61650,17,7147},{61655,0,7880},
+{61656,109,7153},{61684,6,79},{61686,33,7183},{61857,373,7192},
+{62113,45,7286},{62125,0,7882},{62126,53,7299},{62140,0,7883},
+{62141,61,7314},{62157,6,81},{62159,145,7332},{62196,0,1321},
+{62197,37,7370},{62369,189,7380},{62417,0,7885},{62418,169,7429},
+{62461,6,83},
+};
+
+static const unsigned short cmap_78_EUC_H_table[85] = {
+1125,7633,7961,7330,7645,7369,7646,7649,1406,1407,7650,7655,
+5490,1689,7660,7665,1780,7666,1782,7689,2169,7690,7693,6441,
+2629,7713,7720,6766,7733,2910,7734,2918,7744,3045,7745,7746,
+3050,7747,3099,7748,7772,6537,7773,7776,3395,7777,7783,5179,
+3491,7784,3663,7793,7980,4143,6453,7801,3847,7802,3849,7803,
+7816,4227,7817,4654,7826,7835,5199,3176,2030,5854,3153,7851,
+6089,7852,6440,2293,7871,6892,7872,1841,7881,1143,7884,7886,
+7473,
+};
+
+static pdf_cmap cmap_78_EUC_H = {
+	-1, "78-EUC-H", "", 0, 0, 3,
+	{ {1,0,128},{2,36512,36575},{2,41377,65278}, },
+	573, 573, (pdf_range*) cmap_78_EUC_H_ranges,
+	85, 85, (unsigned short*) cmap_78_EUC_H_table,
+};
+
+/* 78-EUC-V */
+
+static const pdf_range cmap_78_EUC_V_ranges[] = {
+{41378,5,7887},{41393,5,7889},{41404,9,7891},{41409,17,7894},
+{41418,69,7899},{41441,0,7917},{42145,0,7918},{42147,0,7919},
+{42149,0,7920},{42151,0,7921},{42153,0,7922},{42179,0,7923},
+{42211,0,7924},{42213,0,7925},{42215,0,7926},{42222,0,7927},
+{42401,0,7928},{42403,0,7929},{42405,0,7930},{42407,0,7931},
+{42409,0,7932},{42435,0,7933},{42467,0,7934},{42469,0,7935},
+{42471,0,7936},{42478,0,7937},{42485,5,7938},
+};
+
+static const unsigned short cmap_78_EUC_V_table[] = { 0 };
+
+static pdf_cmap cmap_78_EUC_V = {
+	-1, "78-EUC-V", "78-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	27, 27, (pdf_range*) cmap_78_EUC_V_ranges,
+	0, 0, (unsigned short*) cmap_78_EUC_V_table,
+};
+
+/* 78-H */
+
+static const pdf_range cmap_78_H_ranges[] = {
+{8481,373,633},{8737,53,727},{9008,37,780},{9025,101,790},
+{9057,101,816},{9249,329,842},{9505,341,925},{9761,93,1011},
+{9793,93,1035},{10017,129,1059},{10065,129,1092},{12321,6,0},
+{12323,21,1127},{12329,0,8266},{12330,29,1134},{12338,6,2},
+{12340,25,1144},{12347,0,7634},{12348,197,1152},{12398,0,7635},
+{12399,13,1203},{12403,0,7636},{12404,29,1208},{12412,0,7637},
+{12413,5,1217},{12577,33,1219},{12586,0,7638},{12587,37,1229},
+{12597,0,7639},{12598,9,1240},{12601,0,7640},{12602,9,1244},
+{12605,0,7642},{12606,13,1248},{12610,0,7643},{12611,157,1253},
+{12651,0,7644},{12652,73,1294},{12833,25,1313},{12840,10,4},
+{12843,209,1323},{12896,0,7647},{12897,97,1377},{12922,0,7648},
+{12923,5,1403},{12925,6,7},{13089,6,9},{13091,121,1409},
+{13122,0,6497},{13123,21,1441},{13129,0,5023},{13130,105,1448},
+{13157,0,7651},{13158,17,1476},{13163,0,7652},{13164,25,1482},
+{13171,0,7653},{13172,5,1490},{13174,0,5937},{13175,9,1493},
+{13178,0,7654},{13179,13,1497},{13345,129,1501},{13378,6,11},
+{13380,33,1536},{13389,0,7656},{13390,13,1546},{13394,0,6688},
+{13395,69,1551},{13413,0,7657},{13414,97,1570},{13601,37,1595},
+{13611,0,7658},{13612,77,1606},{13632,0,7659},{13633,245,1627},
+{13857,6,13},{13859,25,1691},{13866,0,7661},{13867,105,1699},
+{13894,0,7474},{13895,29,1727},{13903,0,7662},{13904,113,1736},
+{13933,0,7663},{13934,21,1766},{13940,0,7664},{13941,21,1773},
+{13947,14,15},{14113,9,1783},{14116,0,7667},{14117,69,1787},
+{14135,0,7668},{14136,49,1806},{14149,0,7669},{14150,29,1820},
+{14158,0,7670},{14159,9,1829},{14162,0,7671},{14163,5,1833},
+{14165,0,7672},{14166,17,1836},{14171,0,7181},{14172,29,1842},
+{14180,0,7673},{14181,45,1851},{14193,0,7674},{14194,25,1864},
+{14201,0,7675},{14202,13,1872},{14206,0,7676},{14369,73,1877},
+{14388,0,7677},{14389,45,1897},{14401,0,7678},{14402,241,1910},
+{14625,37,1971},{14635,0,7679},{14636,41,1982},{14647,0,7680},
+{14648,37,1994},{14658,0,7681},{14659,97,2005},{14684,0,5853},
+{14685,61,2031},{14701,0,7682},{14702,21,2048},{14708,0,7683},
+{14709,13,2055},{14713,0,7684},{14714,17,2060},{14881,197,2065},
+{14931,0,7685},{14932,73,2116},{14951,0,7686},{14952,45,2136},
+{14964,0,7687},{14965,37,2149},{15137,21,2159},{15143,0,7688},
+{15144,5,2166},{15146,10,19},{15149,45,2171},{15161,0,7691},
+{15162,273,2184},{15393,153,2253},{15432,6,22},{15434,49,2294},
+{15447,0,7694},{15448,17,2308},{15453,5,7695},{15455,125,2315},
+{15649,37,2347},{15659,0,7697},{15660,37,2358},{15670,0,7698},
+{15671,209,2369},{15724,5,7699},{15726,13,2424},{15730,5,7701},
+{15732,41,2430},{15905,13,2441},{15909,0,7703},{15910,49,2446},
+{15923,0,7704},{15924,41,2460},{15935,0,7705},{15936,81,2472},
+{15957,0,7706},{15958,33,2494},{15967,0,7707},{15968,13,2504},
+{15972,0,7708},{15973,101,2509},{16161,33,2535},{16170,0,7709},
+{16171,181,2545},{16217,0,7710},{16218,21,2592},{16224,0,7711},
+{16225,29,2599},{16233,0,7712},{16234,81,2608},{16417,6,24},
+{16419,121,2631},{16450,0,7714},{16451,137,2663},{16486,0,7715},
+{16487,37,2699},{16497,5,7716},{16499,21,2711},{16505,5,7718},
+{16507,13,2719},{16673,21,2723},{16679,6,26},{16681,61,2731},
+{16697,0,7721},{16698,69,2748},{16716,0,7722},{16717,5,2767},
+{16719,0,7723},{16720,57,2770},{16735,0,7724},{16736,33,2786},
+{16745,0,7725},{16746,81,2796},{16929,109,2817},{16957,0,7726},
+{16958,57,2846},{16973,0,7727},{16974,53,2862},{16988,0,7728},
+{16989,21,2877},{16995,0,7729},{16996,41,2884},{17007,0,7730},
+{17008,17,2896},{17013,5,7731},{17015,21,2903},{17021,6,28},
+{17185,21,2911},{17191,6,30},{17193,5,7735},{17195,5,2921},
+{17197,5,7737},{17199,53,2925},{17213,0,7739},{17214,197,2940},
+{17264,0,7740},{17265,13,2991},{17269,0,7741},{17270,21,2996},
+{17276,0,7742},{17277,5,3003},{17441,109,3005},{17469,0,7743},
+{17470,37,3034},{17480,10,32},{17483,5,3047},{17485,10,35},
+{17488,13,3052},{17492,0,8267},{17493,21,3057},{17499,0,4533},
+{17500,137,3064},{17697,6,38},{17699,13,3101},{17703,0,7749},
+{17704,21,3106},{17710,0,7750},{17711,25,3113},{17718,0,7751},
+{17719,29,3121},{17727,0,7752},{17728,29,3130},{17736,0,7753},
+{17737,5,3139},{17739,0,7754},{17740,17,3142},{17745,5,7755},
+{17747,13,3149},{17751,0,5855},{17752,45,3154},{17764,0,7757},
+{17765,33,3167},{17774,0,5200},{17775,13,3177},{17779,0,5430},
+{17780,13,3182},{17784,0,7758},{17785,21,3187},{17953,113,3193},
+{17982,0,7759},{17983,9,3223},{17986,0,7760},{17987,65,3227},
+{18004,5,7761},{18006,17,3246},{18011,5,7763},{18013,13,3253},
+{18017,0,7765},{18018,13,3258},{18022,5,7766},{18024,5,3264},
+{18026,0,7768},{18027,41,3267},{18038,0,6893},{18039,29,3279},
+{18209,29,3287},{18217,0,7769},{18218,57,3296},{18233,0,7770},
+{18234,113,3312},{18263,0,7771},{18264,57,3342},{18279,10,40},
+{18282,9,3360},{18285,0,7774},{18286,65,3364},{18465,9,3381},
+{18468,0,7775},{18469,33,3385},{18478,10,43},{18481,137,3397},
+{18516,0,7778},{18517,49,3433},{18530,0,7779},{18531,69,3447},
+{18549,0,7780},{18550,33,3466},{18721,0,3475},{18722,5,7781},
+{18724,41,3478},{18735,14,46},{18739,5,3493},{18741,0,7785},
+{18742,37,3496},{18752,0,7786},{18753,49,3507},{18766,0,7787},
+{18767,5,3521},{18769,0,7788},{18770,177,3524},{18977,133,3569},
+{19011,0,7789},{19012,33,3604},{19021,0,7790},{19022,45,3614},
+{19034,0,7791},{19035,117,3627},{19065,0,7792},{19066,17,3658},
+{19233,6,50},{19235,21,3665},{19241,0,7794},{19242,129,3672},
+{19275,0,7795},{19276,117,3706},{19306,0,7475},{19307,17,3737},
+{19312,0,7796},{19313,25,3743},{19320,6,52},{19322,17,3752},
+{19489,173,3757},{19533,0,7797},{19534,41,3802},{19545,0,7798},
+{19546,17,3814},{19551,0,7799},{19552,5,3820},{19554,0,7800},
+{19555,85,3823},{19577,22,54},{19745,65,3851},{19762,0,7804},
+{19763,113,3869},{19792,0,7805},{19793,9,3899},{19796,0,7806},
+{19797,17,3903},{19802,0,7476},{19803,53,3909},{19817,0,7807},
+{19818,81,3924},{20001,165,3945},{20043,0,7808},{20044,181,3988},
+{20090,5,7809},{20092,9,4036},{20257,0,7811},{20258,57,4040},
+{20273,0,7812},{20274,13,4056},{20278,0,6007},{20279,5,4061},
+{20281,0,7813},{20282,101,4064},{20513,209,4090},{20566,0,3751},
+{20567,157,4144},{20769,109,4184},{20797,0,7814},{20798,33,4213},
+{20807,0,7815},{20808,9,4223},{20811,10,60},{20814,193,4229},
+{21025,373,4278},{21281,57,4372},{21296,0,7818},{21297,33,4388},
+{21306,0,7819},{21307,137,4398},{21342,0,7821},{21343,45,4434},
+{21355,0,7822},{21356,73,4447},{21537,137,4466},{21572,0,7823},
+{21573,121,4502},{21604,0,3063},{21605,101,4534},{21793,109,4560},
+{21821,0,7824},{21822,145,4589},{21859,0,7825},{21860,105,4627},
+{22049,6,63},{22051,365,4656},{22305,373,4748},{22561,9,4842},
+{22564,0,7828},{22565,357,4846},{22817,249,4936},{22880,0,7829},
+{22881,41,5000},{22892,0,7830},{22893,41,5012},{22904,0,1447},
+{22905,21,5024},{23073,93,5030},{23097,0,7831},{23098,73,5055},
+{23117,0,7832},{23118,193,5075},{23329,141,5124},{23365,0,7833},
+{23366,13,5161},{23370,0,7834},{23371,49,5166},{23384,0,3490},
+{23385,69,5180},{23403,10,65},{23406,21,5201},{23412,0,7836},
+{23413,37,5208},{23585,373,5218},{23841,373,5312},{24097,93,5406},
+{24121,0,3181},{24122,85,5431},{24144,0,7837},{24145,141,5454},
+{24181,0,1535},{24182,33,5491},{24353,373,5500},{24609,17,5594},
+{24614,0,7839},{24615,221,5600},{24671,0,7840},{24672,85,5657},
+{24694,0,7477},{24695,29,5680},{24865,37,5688},{24875,0,7841},
+{24876,13,5699},{24880,5,7842},{24882,305,5705},{25121,37,5782},
+{25131,0,7844},{25132,237,5793},{25192,10,68},{25195,13,5856},
+{25199,0,7845},{25200,57,5861},{25377,161,5876},{25418,0,7846},
+{25419,33,5918},{25428,0,7847},{25429,33,5928},{25438,0,1492},
+{25439,125,5938},{25633,93,5970},{25657,0,7848},{25658,45,5995},
+{25670,0,4060},{25671,113,6008},{25700,0,7849},{25701,33,6038},
+{25710,0,7850},{25711,61,6048},{25889,93,6064},{25913,10,71},
+{25916,37,6091},{25926,0,7853},{25927,221,6102},{26145,145,6158},
+{26182,0,7854},{26183,221,6196},{26401,265,6252},{26468,0,7855},
+{26469,13,6320},{26473,0,7856},{26474,29,6325},{26482,0,7857},
+{26483,45,6334},{26657,73,6346},{26676,0,7858},{26677,21,6366},
+{26683,0,7859},{26684,221,6373},{26740,0,7860},{26741,37,6430},
+{26913,6,74},{26915,41,6442},{26926,0,3845},{26927,169,6454},
+{26970,0,1440},{26971,141,6498},{27169,9,6534},{27172,0,3358},
+{27173,5,6538},{27175,0,7862},{27176,81,6541},{27197,0,7863},
+{27198,193,6563},{27247,0,7864},{27248,57,6613},{27425,65,6628},
+{27442,0,7865},{27443,165,6646},{27485,0,1550},{27486,29,6689},
+{27494,0,7866},{27495,57,6698},{27510,0,7867},{27511,29,6714},
+{27681,173,6722},{27725,0,2730},{27726,105,6767},{27753,0,7868},
+{27754,37,6795},{27764,0,7869},{27765,37,6806},{27937,177,6816},
+{27982,0,7870},{27983,113,6862},{28012,10,76},{28015,61,6894},
+{28193,29,6910},{28201,0,7873},{28202,73,6919},{28221,0,7874},
+{28222,97,6939},{28247,0,7875},{28248,153,6965},{28449,373,7004},
+{28705,141,7098},{28741,0,7878},{28742,41,7135},{28753,0,7879},
+{28754,17,7147},{28759,0,7880},{28760,109,7153},{28788,6,79},
+{28790,33,7183},{28961,373,7192},{29217,45,7286},{29229,0,7882},
+{29230,53,7299},{29244,0,7883},{29245,61,7314},{29261,6,81},
+{29263,145,7332},{29300,0,1321},{29301,37,7370},{29473,189,7380},
+{29521,0,7885},{29522,169,7429},{29565,6,83},
+};
+
+static const unsigned short cmap_78_H_table[85] = {
+1125,7633,7961,7330,7645,7369,7646,7649,1406,1407,7650,7655,
+5490,1689,7660,7665,1780,7666,1782,7689,2169,7690,7693,6441,
+2629,7713,7720,6766,7733,2910,7734,2918,7744,3045,7745,7746,
+3050,7747,3099,7748,7772,6537,7773,7776,3395,7777,7783,5179,
+3491,7784,3663,7793,7980,4143,6453,7801,3847,7802,3849,7803,
+7816,4227,7817,4654,7826,7835,5199,3176,2030,5854,3153,7851,
+6089,7852,6440,2293,7871,6892,7872,1841,7881,1143,7884,7886,
+7473,
+};
+
+static pdf_cmap cmap_78_H = {
+	-1, "78-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	571, 571, (pdf_range*) cmap_78_H_ranges,
+	85, 85, (unsigned short*) cmap_78_H_table,
+};
+
+/* 78-RKSJ-H */
+
+static const pdf_range cmap_78_RKSJ_H_ranges[] = {
+{32,377,231},{160,253,326},{33088,249,633},{33152,177,696},
+{33359,37,780},{33376,101,790},{33409,101,816},{33439,329,842},
+{33600,249,925},{33664,89,988},{33695,93,1011},{33727,93,1035},
+{33856,129,1059},{33904,57,1092},{33920,69,1107},{34975,6,0},
+{34977,21,1127},{34983,0,8266},{34984,29,1134},{34992,6,2},
+{34994,25,1144},{35001,0,7634},{35002,197,1152},{35052,0,7635},
+{35053,13,1203},{35057,0,7636},{35058,29,1208},{35066,0,7637},
+{35067,5,1217},{35136,33,1219},{35145,0,7638},{35146,37,1229},
+{35156,0,7639},{35157,9,1240},{35160,0,7640},{35161,9,1244},
+{35164,0,7642},{35165,13,1248},{35169,0,7643},{35170,113,1253},
+{35200,41,1282},{35211,0,7644},{35212,101,1294},{35238,10,4},
+{35241,209,1323},{35294,0,7647},{35295,97,1377},{35320,0,7648},
+{35321,5,1403},{35323,6,7},{35392,6,9},{35394,121,1409},
+{35425,0,6497},{35426,21,1441},{35432,0,5023},{35433,85,1448},
+{35456,17,1470},{35461,0,7651},{35462,17,1476},{35467,0,7652},
+{35468,25,1482},{35475,0,7653},{35476,5,1490},{35478,0,5937},
+{35479,9,1493},{35482,0,7654},{35483,145,1497},{35520,6,11},
+{35522,33,1536},{35531,0,7656},{35532,13,1546},{35536,0,6688},
+{35537,69,1551},{35555,0,7657},{35556,97,1570},{35648,37,1595},
+{35658,0,7658},{35659,77,1606},{35679,0,7659},{35680,121,1627},
+{35712,125,1658},{35744,0,7660},{35745,25,1691},{35752,0,7661},
+{35753,105,1699},{35780,0,7474},{35781,29,1727},{35789,0,7662},
+{35790,113,1736},{35819,0,7663},{35820,21,1766},{35826,0,7664},
+{35827,21,1773},{35833,14,13},{35904,9,1783},{35907,0,7667},
+{35908,69,1787},{35926,0,7668},{35927,49,1806},{35940,0,7669},
+{35941,29,1820},{35949,0,7670},{35950,9,1829},{35953,0,7671},
+{35954,5,1833},{35956,0,7672},{35957,17,1836},{35962,0,7181},
+{35963,13,1842},{35968,13,1846},{35972,0,7673},{35973,45,1851},
+{35985,0,7674},{35986,25,1864},{35993,0,7675},{35994,13,1872},
+{35998,0,7676},{35999,73,1877},{36018,0,7677},{36019,45,1897},
+{36031,0,7678},{36032,241,1910},{36160,37,1971},{36170,0,7679},
+{36171,41,1982},{36182,0,7680},{36183,37,1994},{36193,0,7681},
+{36194,97,2005},{36219,0,5853},{36220,9,2031},{36224,49,2034},
+{36237,0,7682},{36238,21,2048},{36244,0,7683},{36245,13,2055},
+{36249,0,7684},{36250,217,2060},{36305,0,7685},{36306,73,2116},
+{36325,0,7686},{36326,45,2136},{36338,0,7687},{36339,37,2149},
+{36416,21,2159},{36422,0,7688},{36423,5,2166},{36425,10,17},
+{36428,45,2171},{36440,0,7691},{36441,149,2184},{36480,277,2222},
+{36550,6,20},{36552,49,2294},{36565,0,7694},{36566,17,2308},
+{36571,5,7695},{36573,125,2315},{36672,37,2347},{36682,0,7697},
+{36683,37,2358},{36693,0,7698},{36694,161,2369},{36736,45,2410},
+{36748,5,7699},{36750,13,2424},{36754,5,7701},{36756,57,2430},
+{36771,0,7703},{36772,49,2446},{36785,0,7704},{36786,41,2460},
+{36797,0,7705},{36798,81,2472},{36819,0,7706},{36820,33,2494},
+{36829,0,7707},{36830,13,2504},{36834,0,7708},{36835,101,2509},
+{36928,33,2535},{36937,0,7709},{36938,181,2545},{36984,0,7710},
+{36985,21,2592},{36992,0,7711},{36993,29,2599},{37001,0,7712},
+{37002,85,2608},{37024,0,7713},{37025,121,2631},{37056,0,7714},
+{37057,137,2663},{37092,0,7715},{37093,37,2699},{37103,5,7716},
+{37105,21,2711},{37111,5,7718},{37113,13,2719},{37184,21,2723},
+{37190,6,22},{37192,61,2731},{37208,0,7721},{37209,69,2748},
+{37227,0,7722},{37228,5,2767},{37230,0,7723},{37231,57,2770},
+{37246,0,7724},{37248,33,2786},{37257,0,7725},{37258,193,2796},
+{37307,0,7726},{37308,57,2846},{37323,0,7727},{37324,53,2862},
+{37338,0,7728},{37339,21,2877},{37345,0,7729},{37346,41,2884},
+{37357,0,7730},{37358,17,2896},{37363,5,7731},{37365,21,2903},
+{37371,6,24},{37440,21,2911},{37446,6,26},{37448,5,7735},
+{37450,5,2921},{37452,5,7737},{37454,53,2925},{37468,0,7739},
+{37469,133,2940},{37504,61,2974},{37520,0,7740},{37521,13,2991},
+{37525,0,7741},{37526,21,2996},{37532,0,7742},{37533,117,3003},
+{37563,0,7743},{37564,37,3034},{37574,10,28},{37577,5,3047},
+{37579,10,31},{37582,13,3052},{37586,0,8267},{37587,21,3057},
+{37593,0,4533},{37594,137,3064},{37696,6,34},{37698,13,3101},
+{37702,0,7749},{37703,21,3106},{37709,0,7750},{37710,25,3113},
+{37717,0,7751},{37718,29,3121},{37726,0,7752},{37727,29,3130},
+{37735,0,7753},{37736,5,3139},{37738,0,7754},{37739,17,3142},
+{37744,5,7755},{37746,13,3149},{37750,0,5855},{37751,29,3154},
+{37760,13,3162},{37764,0,7757},{37765,33,3167},{37774,0,5200},
+{37775,13,3177},{37779,0,5430},{37780,13,3182},{37784,0,7758},
+{37785,137,3187},{37820,0,7759},{37821,9,3223},{37824,0,7760},
+{37825,65,3227},{37842,5,7761},{37844,17,3246},{37849,5,7763},
+{37851,13,3253},{37855,0,7765},{37856,13,3258},{37860,5,7766},
+{37862,5,3264},{37864,0,7768},{37865,41,3267},{37876,0,6893},
+{37877,29,3279},{37952,29,3287},{37960,0,7769},{37961,57,3296},
+{37976,0,7770},{37977,113,3312},{38006,0,7771},{38007,29,3342},
+{38016,25,3350},{38023,10,36},{38026,9,3360},{38029,0,7774},
+{38030,77,3364},{38050,0,7775},{38051,33,3385},{38060,10,39},
+{38063,137,3397},{38098,0,7778},{38099,49,3433},{38112,0,7779},
+{38113,69,3447},{38131,0,7780},{38132,33,3466},{38208,0,3475},
+{38209,5,7781},{38211,41,3478},{38222,14,42},{38226,5,3493},
+{38228,0,7785},{38229,37,3496},{38239,0,7786},{38240,49,3507},
+{38253,0,7787},{38254,5,3521},{38256,0,7788},{38257,53,3524},
+{38272,257,3538},{38337,0,7789},{38338,33,3604},{38347,0,7790},
+{38348,45,3614},{38360,0,7791},{38361,117,3627},{38391,0,7792},
+{38392,17,3658},{38464,6,46},{38466,21,3665},{38472,0,7794},
+{38473,129,3672},{38506,0,7795},{38507,77,3706},{38528,37,3726},
+{38538,0,7475},{38539,17,3737},{38544,0,7796},{38545,25,3743},
+{38552,6,48},{38554,193,3752},{38603,0,7797},{38604,41,3802},
+{38615,0,7798},{38616,17,3814},{38621,0,7799},{38622,5,3820},
+{38624,0,7800},{38625,85,3823},{38647,22,50},{38720,65,3851},
+{38737,0,7804},{38738,113,3869},{38767,0,7805},{38768,9,3899},
+{38771,0,7806},{38772,17,3903},{38777,0,7476},{38778,17,3909},
+{38784,33,3914},{38793,0,7807},{38794,249,3924},{38857,0,7808},
+{38858,181,3988},{38904,5,7809},{38906,9,4036},{38976,0,7811},
+{38977,57,4040},{38992,0,7812},{38993,13,4056},{38997,0,6007},
+{38998,5,4061},{39000,0,7813},{39001,101,4064},{39071,209,4090},
+{39124,0,3751},{39125,157,4144},{39232,109,4184},{39260,0,7814},
+{39261,33,4213},{39270,0,7815},{39271,9,4223},{39274,10,56},
+{39277,69,4229},{39296,497,4247},{39488,57,4372},{39503,0,7818},
+{39504,33,4388},{39513,0,7819},{39514,137,4398},{39549,6,59},
+{39552,41,4435},{39563,0,7822},{39564,213,4447},{39618,0,7823},
+{39619,121,4502},{39650,0,3063},{39651,101,4534},{39744,109,4560},
+{39772,0,7824},{39773,133,4589},{39808,9,4623},{39811,0,7825},
+{39812,109,4627},{39840,0,7826},{39841,365,4656},{40000,249,4748},
+{40064,133,4811},{40098,0,7828},{40099,357,4846},{40256,249,4936},
+{40320,0,7829},{40321,41,5000},{40332,0,7830},{40333,41,5012},
+{40344,0,1447},{40345,117,5024},{40375,0,7831},{40376,73,5055},
+{40395,0,7832},{40396,193,5075},{40512,141,5124},{40548,0,7833},
+{40549,13,5161},{40553,0,7834},{40554,49,5166},{40567,0,3490},
+{40568,25,5180},{40576,41,5187},{40587,10,61},{40590,21,5201},
+{40596,0,7836},{40597,413,5208},{40768,249,5312},{40832,217,5375},
+{40887,0,3181},{40888,85,5431},{40910,0,7837},{40911,141,5454},
+{40947,0,1535},{40948,33,5491},{57408,249,5500},{57472,141,5563},
+{57508,0,7839},{57509,221,5600},{57565,0,7840},{57566,85,5657},
+{57588,0,7477},{57589,29,5680},{57664,37,5688},{57674,0,7841},
+{57675,13,5699},{57679,5,7842},{57681,181,5705},{57728,161,5751},
+{57769,0,7844},{57770,237,5793},{57830,10,64},{57833,13,5856},
+{57837,0,7845},{57838,57,5861},{57920,161,5876},{57961,0,7846},
+{57962,33,5918},{57971,0,7847},{57972,33,5928},{57981,6,67},
+{57984,217,5939},{58039,0,7848},{58040,45,5995},{58052,0,4060},
+{58053,113,6008},{58082,0,7849},{58083,33,6038},{58092,0,7850},
+{58093,61,6048},{58176,93,6064},{58200,10,69},{58203,37,6091},
+{58213,0,7853},{58214,97,6102},{58240,269,6127},{58308,0,7854},
+{58309,221,6196},{58432,249,6252},{58496,13,6315},{58500,0,7855},
+{58501,13,6320},{58505,0,7856},{58506,29,6325},{58514,0,7857},
+{58515,121,6334},{58546,0,7858},{58547,21,6366},{58553,0,7859},
+{58554,221,6373},{58610,0,7860},{58611,37,6430},{58688,6,72},
+{58690,41,6442},{58701,0,3845},{58702,169,6454},{58745,0,1440},
+{58746,17,6498},{58752,133,6503},{58786,0,3358},{58787,5,6538},
+{58789,0,7862},{58790,81,6541},{58811,0,7863},{58812,193,6563},
+{58861,0,7864},{58862,57,6613},{58944,65,6628},{58961,0,7865},
+{58962,165,6646},{59004,0,1550},{59005,5,6689},{59008,21,6691},
+{59014,0,7866},{59015,57,6698},{59030,0,7867},{59031,205,6714},
+{59083,0,2730},{59084,105,6767},{59111,0,7868},{59112,37,6795},
+{59122,0,7869},{59123,37,6806},{59200,177,6816},{59245,0,7870},
+{59246,65,6862},{59264,45,6879},{59276,10,74},{59279,93,6894},
+{59303,0,7873},{59304,73,6919},{59323,0,7874},{59324,97,6939},
+{59349,0,7875},{59350,153,6965},{59456,249,7004},{59520,265,7067},
+{59587,0,7878},{59588,41,7135},{59599,0,7879},{59600,17,7147},
+{59605,0,7880},{59606,109,7153},{59634,6,77},{59636,33,7183},
+{59712,249,7192},{59776,169,7255},{59819,0,7882},{59820,53,7299},
+{59834,0,7883},{59835,61,7314},{59851,6,79},{59853,145,7332},
+{59890,0,1321},{59891,37,7370},{59968,189,7380},{60016,0,7885},
+{60017,53,7429},{60032,113,7443},{60061,6,81},
+};
+
+static const unsigned short cmap_78_RKSJ_H_table[83] = {
+1125,7633,7961,7330,7645,7369,7646,7649,1406,1407,7650,7655,
+5490,7665,1780,7666,1782,7689,2169,7690,7693,6441,7720,6766,
+7733,2910,7734,2918,7744,3045,7745,7746,3050,7747,3099,7748,
+7772,6537,7773,7776,3395,7777,7783,5179,3491,7784,3663,7793,
+7980,4143,6453,7801,3847,7802,3849,7803,7816,4227,7817,7821,
+4434,7835,5199,3176,2030,5854,3153,1492,5938,7851,6089,7852,
+6440,2293,7871,6892,7872,1841,7881,1143,7884,7886,7473,
+};
+
+static pdf_cmap cmap_78_RKSJ_H = {
+	-1, "78-RKSJ-H", "", 0, 0, 4,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764}, },
+	575, 575, (pdf_range*) cmap_78_RKSJ_H_ranges,
+	83, 83, (unsigned short*) cmap_78_RKSJ_H_table,
+};
+
+/* 78-RKSJ-V */
+
+static const pdf_range cmap_78_RKSJ_V_ranges[] = {
+{33089,5,7887},{33104,5,7889},{33115,9,7891},{33120,17,7894},
+{33129,69,7899},{33153,0,7917},{33439,0,7918},{33441,0,7919},
+{33443,0,7920},{33445,0,7921},{33447,0,7922},{33473,0,7923},
+{33505,0,7924},{33507,0,7925},{33509,0,7926},{33516,0,7927},
+{33600,0,7928},{33602,0,7929},{33604,0,7930},{33606,0,7931},
+{33608,0,7932},{33634,0,7933},{33667,0,7934},{33669,0,7935},
+{33671,0,7936},{33678,0,7937},{33685,5,7938},
+};
+
+static const unsigned short cmap_78_RKSJ_V_table[] = { 0 };
+
+static pdf_cmap cmap_78_RKSJ_V = {
+	-1, "78-RKSJ-V", "78-RKSJ-H", 0, 1, 0,
+	{ {0,0,0}, },
+	27, 27, (pdf_range*) cmap_78_RKSJ_V_ranges,
+	0, 0, (unsigned short*) cmap_78_RKSJ_V_table,
+};
+
+/* 78-V */
+
+static const pdf_range cmap_78_V_ranges[] = {
+{8482,5,7887},{8497,5,7889},{8508,9,7891},{8513,17,7894},
+{8522,69,7899},{8545,0,7917},{9249,0,7918},{9251,0,7919},
+{9253,0,7920},{9255,0,7921},{9257,0,7922},{9283,0,7923},
+{9315,0,7924},{9317,0,7925},{9319,0,7926},{9326,0,7927},
+{9505,0,7928},{9507,0,7929},{9509,0,7930},{9511,0,7931},
+{9513,0,7932},{9539,0,7933},{9571,0,7934},{9573,0,7935},
+{9575,0,7936},{9582,0,7937},{9589,5,7938},
+};
+
+static const unsigned short cmap_78_V_table[] = { 0 };
+
+static pdf_cmap cmap_78_V = {
+	-1, "78-V", "78-H", 0, 1, 0,
+	{ {0,0,0}, },
+	27, 27, (pdf_range*) cmap_78_V_ranges,
+	0, 0, (unsigned short*) cmap_78_V_table,
+};
+
+/* 78ms-RKSJ-H */
+
+static const pdf_range cmap_78ms_RKSJ_H_ranges[] = {
+{32,373,231},{126,0,631},{160,253,326},{33088,249,633},
+{33152,177,696},{33208,29,741},{33224,25,749},{33242,57,756},
+{33264,29,771},{33276,0,779},{33359,37,780},{33376,101,790},
+{33409,101,816},{33439,329,842},{33600,249,925},{33664,89,988},
+{33695,93,1011},{33727,93,1035},{33856,129,1059},{33904,57,1092},
+{33920,69,1107},{33951,126,0},{34624,117,7555},{34655,5,7585},
+{34657,18,32},{34662,5,7592},{34664,0,8044},{34665,5,7595},
+{34667,0,8043},{34668,5,7598},{34670,0,8047},{34671,25,7601},
+{34686,0,8323},{34688,13,7608},{34692,0,8055},{34693,41,7613},
+{34704,10,37},{34707,25,7624},{34714,0,768},{34715,5,7631},
+{34975,6,40},{34977,21,1127},{34983,0,8266},{34984,29,1134},
+{34992,6,42},{34994,25,1144},{35001,0,7634},{35002,197,1152},
+{35052,0,7635},{35053,13,1203},{35057,0,7636},{35058,29,1208},
+{35066,0,7637},{35067,5,1217},{35136,33,1219},{35145,0,7638},
+{35146,37,1229},{35156,0,7639},{35157,9,1240},{35160,0,7640},
+{35161,9,1244},{35164,0,7642},{35165,13,1248},{35169,0,7643},
+{35170,113,1253},{35200,41,1282},{35211,0,7644},{35212,101,1294},
+{35238,10,44},{35241,209,1323},{35294,0,7647},{35295,97,1377},
+{35320,0,7648},{35321,5,1403},{35323,6,47},{35392,6,49},
+{35394,121,1409},{35425,0,6497},{35426,21,1441},{35432,0,5023},
+{35433,85,1448},{35456,17,1470},{35461,0,7651},{35462,17,1476},
+{35467,0,7652},{35468,25,1482},{35475,0,7653},{35476,5,1490},
+{35478,0,5937},{35479,9,1493},{35482,0,7654},{35483,145,1497},
+{35520,6,51},{35522,33,1536},{35531,0,7656},{35532,13,1546},
+{35536,0,6688},{35537,69,1551},{35555,0,7657},{35556,97,1570},
+{35648,37,1595},{35658,0,7658},{35659,77,1606},{35679,0,7659},
+{35680,121,1627},{35712,125,1658},{35744,0,7660},{35745,25,1691},
+{35752,0,7661},{35753,105,1699},{35780,0,7474},{35781,29,1727},
+{35789,0,7662},{35790,113,1736},{35819,0,7663},{35820,21,1766},
+{35826,0,7664},{35827,21,1773},{35833,14,53},{35904,9,1783},
+{35907,0,7667},{35908,69,1787},{35926,0,7668},{35927,49,1806},
+{35940,0,7669},{35941,29,1820},{35949,0,7670},{35950,9,1829},
+{35953,0,7671},{35954,5,1833},{35956,0,7672},{35957,17,1836},
+{35962,0,7181},{35963,13,1842},{35968,13,1846},{35972,0,7673},
+{35973,45,1851},{35985,0,7674},{35986,25,1864},{35993,0,7675},
+{35994,13,1872},{35998,0,7676},{35999,73,1877},{36018,0,7677},
+{36019,45,1897},{36031,0,7678},{36032,241,1910},{36160,37,1971},
+{36170,0,7679},{36171,41,1982},{36182,0,7680},{36183,37,1994},
+{36193,0,7681},{36194,97,2005},{36219,0,5853},{36220,9,2031},
+{36224,49,2034},{36237,0,7682},{36238,21,2048},{36244,0,7683},
+{36245,13,2055},{36249,0,7684},{36250,217,2060},{36305,0,7685},
+{36306,73,2116},{36325,0,7686},{36326,45,2136},{36338,0,7687},
+{36339,37,2149},{36416,21,2159},{36422,0,7688},{36423,5,2166},
+{36425,10,57},{36428,45,2171},{36440,0,7691},{36441,149,2184},
+{36480,277,2222},{36550,6,60},{36552,49,2294},{36565,0,7694},
+{36566,17,2308},{36571,5,7695},{36573,125,2315},{36672,37,2347},
+{36682,0,7697},{36683,37,2358},{36693,0,7698},{36694,161,2369},
+{36736,45,2410},{36748,5,7699},{36750,13,2424},{36754,5,7701},
+{36756,57,2430},{36771,0,7703},{36772,49,2446},{36785,0,7704},
+{36786,41,2460},{36797,0,7705},{36798,81,2472},{36819,0,7706},
+{36820,33,2494},{36829,0,7707},{36830,13,2504},{36834,0,7708},
+{36835,101,2509},{36928,33,2535},{36937,0,7709},{36938,181,2545},
+{36984,0,7710},{36985,21,2592},{36992,0,7711},{36993,29,2599},
+{37001,0,7712},{37002,85,2608},{37024,0,7713},{37025,121,2631},
+{37056,0,7714},{37057,137,2663},{37092,0,7715},{37093,37,2699},
+{37103,5,7716},{37105,21,2711},{37111,5,7718},{37113,13,2719},
+{37184,21,2723},{37190,6,62},{37192,61,2731},{37208,0,7721},
+{37209,69,2748},{37227,0,7722},{37228,5,2767},{37230,0,7723},
+{37231,57,2770},{37246,0,7724},{37248,33,2786},{37257,0,7725},
+{37258,193,2796},{37307,0,7726},{37308,57,2846},{37323,0,7727},
+{37324,53,2862},{37338,0,7728},{37339,21,2877},{37345,0,7729},
+{37346,41,2884},{37357,0,7730},{37358,17,2896},{37363,5,7731},
+{37365,21,2903},{37371,6,64},{37440,21,2911},{37446,6,66},
+{37448,5,7735},{37450,5,2921},{37452,5,7737},{37454,53,2925},
+{37468,0,7739},{37469,133,2940},{37504,61,2974},{37520,0,7740},
+{37521,13,2991},{37525,0,7741},{37526,21,2996},{37532,0,7742},
+{37533,117,3003},{37563,0,7743},{37564,37,3034},{37574,10,68},
+{37577,5,3047},{37579,10,71},{37582,13,3052},{37586,0,8267},
+{37587,21,3057},{37593,0,4533},{37594,137,3064},{37696,6,74},
+{37698,13,3101},{37702,0,7749},{37703,21,3106},{37709,0,7750},
+{37710,25,3113},{37717,0,7751},{37718,29,3121},{37726,0,7752},
+{37727,29,3130},{37735,0,7753},{37736,5,3139},{37738,0,7754},
+{37739,17,3142},{37744,5,7755},{37746,13,3149},{37750,0,5855},
+{37751,29,3154},{37760,13,3162},{37764,0,7757},{37765,33,3167},
+{37774,0,5200},{37775,13,3177},{37779,0,5430},{37780,13,3182},
+{37784,0,7758},{37785,137,3187},{37820,0,7759},{37821,9,3223},
+{37824,0,7760},{37825,65,3227},{37842,5,7761},{37844,17,3246},
+{37849,5,7763},{37851,13,3253},{37855,0,7765},{37856,13,3258},
+{37860,5,7766},{37862,5,3264},{37864,0,7768},{37865,41,3267},
+{37876,0,6893},{37877,29,3279},{37952,29,3287},{37960,0,7769},
+{37961,57,3296},{37976,0,7770},{37977,113,3312},{38006,0,7771},
+{38007,29,3342},{38016,25,3350},{38023,10,76},{38026,9,3360},
+{38029,0,7774},{38030,77,3364},{38050,0,7775},{38051,33,3385},
+{38060,10,79},{38063,137,3397},{38098,0,7778},{38099,49,3433},
+{38112,0,7779},{38113,69,3447},{38131,0,7780},{38132,33,3466},
+{38208,0,3475},{38209,5,7781},{38211,41,3478},{38222,14,82},
+{38226,5,3493},{38228,0,7785},{38229,37,3496},{38239,0,7786},
+{38240,49,3507},{38253,0,7787},{38254,5,3521},{38256,0,7788},
+{38257,53,3524},{38272,257,3538},{38337,0,7789},{38338,33,3604},
+{38347,0,7790},{38348,45,3614},{38360,0,7791},{38361,117,3627},
+{38391,0,7792},{38392,17,3658},{38464,6,86},{38466,21,3665},
+{38472,0,7794},{38473,129,3672},{38506,0,7795},{38507,77,3706},
+{38528,37,3726},{38538,0,7475},{38539,17,3737},{38544,0,7796},
+{38545,25,3743},{38552,6,88},{38554,193,3752},{38603,0,7797},
+{38604,41,3802},{38615,0,7798},{38616,17,3814},{38621,0,7799},
+{38622,5,3820},{38624,0,7800},{38625,85,3823},{38647,22,90},
+{38720,65,3851},{38737,0,7804},{38738,113,3869},{38767,0,7805},
+{38768,9,3899},{38771,0,7806},{38772,17,3903},{38777,0,7476},
+{38778,17,3909},{38784,33,3914},{38793,0,7807},{38794,249,3924},
+{38857,0,7808},{38858,181,3988},{38904,5,7809},{38906,9,4036},
+{38976,0,7811},{38977,57,4040},{38992,0,7812},{38993,13,4056},
+{38997,0,6007},{38998,5,4061},{39000,0,7813},{39001,101,4064},
+{39071,209,4090},{39124,0,3751},{39125,157,4144},{39232,109,4184},
+{39260,0,7814},{39261,33,4213},{39270,0,7815},{39271,9,4223},
+{39274,10,96},{39277,69,4229},{39296,497,4247},{39488,57,4372},
+{39503,0,7818},{39504,33,4388},{39513,0,7819},{39514,137,4398},
+{39549,6,99},{39552,41,4435},{39563,0,7822},{39564,213,4447},
+{39618,0,7823},{39619,121,4502},{39650,0,3063},{39651,101,4534},
+{39744,109,4560},{39772,0,7824},{39773,133,4589},{39808,9,4623},
+{39811,0,7825},{39812,109,4627},{39840,0,7826},{39841,365,4656},
+{40000,249,4748},{40064,133,4811},{40098,0,7828},{40099,357,4846},
+{40256,249,4936},{40320,0,7829},{40321,41,5000},{40332,0,7830},
+{40333,41,5012},{40344,0,1447},{40345,117,5024},{40375,0,7831},
+{40376,73,5055},{40395,0,7832},{40396,193,5075},{40512,141,5124},
+{40548,0,7833},{40549,13,5161},{40553,0,7834},{40554,49,5166},
+{40567,0,3490},{40568,25,5180},{40576,41,5187},{40587,10,101},
+{40590,21,5201},{40596,0,7836},{40597,413,5208},{40768,249,5312},
+{40832,217,5375},{40887,0,3181},{40888,85,5431},{40910,0,7837},
+{40911,141,5454},{40947,0,1535},{40948,33,5491},{57408,249,5500},
+{57472,141,5563},{57508,0,7839},{57509,221,5600},{57565,0,7840},
+{57566,85,5657},{57588,0,7477},{57589,29,5680},{57664,37,5688},
+{57674,0,7841},{57675,13,5699},{57679,5,7842},{57681,181,5705},
+{57728,161,5751},{57769,0,7844},{57770,237,5793},{57830,10,104},
+{57833,13,5856},{57837,0,7845},{57838,57,5861},{57920,161,5876},
+{57961,0,7846},{57962,33,5918},{57971,0,7847},{57972,33,5928},
+{57981,6,107},{57984,217,5939},{58039,0,7848},{58040,45,5995},
+{58052,0,4060},{58053,113,6008},{58082,0,7849},{58083,33,6038},
+{58092,0,7850},{58093,61,6048},{58176,93,6064},{58200,10,109},
+{58203,37,6091},{58213,0,7853},{58214,97,6102},{58240,269,6127},
+{58308,0,7854},{58309,221,6196},{58432,249,6252},{58496,13,6315},
+{58500,0,7855},{58501,13,6320},{58505,0,7856},{58506,29,6325},
+{58514,0,7857},{58515,121,6334},{58546,0,7858},{58547,21,6366},
+{58553,0,7859},{58554,221,6373},{58610,0,7860},{58611,37,6430},
+{58688,6,112},{58690,41,6442},{58701,0,3845},{58702,169,6454},
+{58745,0,1440},{58746,17,6498},{58752,133,6503},{58786,0,3358},
+{58787,5,6538},{58789,0,7862},{58790,81,6541},{58811,0,7863},
+{58812,193,6563},{58861,0,7864},{58862,57,6613},{58944,65,6628},
+{58961,0,7865},{58962,165,6646},{59004,0,1550},{59005,5,6689},
+{59008,21,6691},{59014,0,7866},{59015,57,6698},{59030,0,7867},
+{59031,205,6714},{59083,0,2730},{59084,105,6767},{59111,0,7868},
+{59112,37,6795},{59122,0,7869},{59123,37,6806},{59200,177,6816},
+{59245,0,7870},{59246,65,6862},{59264,45,6879},{59276,10,114},
+{59279,93,6894},{59303,0,7873},{59304,73,6919},{59323,0,7874},
+{59324,97,6939},{59349,0,7875},{59350,153,6965},{59456,249,7004},
+{59520,265,7067},{59587,0,7878},{59588,41,7135},{59599,0,7879},
+{59600,17,7147},{59605,0,7880},{59606,109,7153},{59634,6,117},
+{59636,33,7183},{59712,249,7192},{59776,169,7255},{59819,0,7882},
+{59820,53,7299},{59834,0,7883},{59835,61,7314},{59851,6,119},
+{59853,145,7332},{59890,0,1321},{59891,37,7370},{59968,189,7380},
+{60016,0,7885},{60017,53,7429},{60032,113,7443},{60061,0,7886},
+{60062,17,7473},{60067,5,8284},{60736,249,8359},{60800,205,8422},
+{60852,0,1993},{60853,285,8474},{60992,249,8546},{61056,433,8609},
+{61167,37,8092},{61177,0,751},{61178,9,8005},{64064,37,8092},
+{64074,37,7575},{64084,0,751},{64085,9,8005},{64088,14,121},
+{64092,137,8359},{64128,317,8394},{64208,0,1993},{64209,173,8474},
+{64320,249,8518},{64384,497,8581},{64576,45,8706},
+};
+
+static const unsigned short cmap_78ms_RKSJ_H_table[125] = {
+7479,7481,7491,7495,7503,7499,7507,7523,7515,7531,7539,7480,
+7482,7494,7498,7506,7502,7514,7530,7522,7538,7554,7511,7526,
+7519,7534,7542,7508,7527,7516,7535,7545,8038,7588,8040,7590,
+8042,762,761,769,1125,7633,7961,7330,7645,7369,7646,7649,
+1406,1407,7650,7655,5490,7665,1780,7666,1782,7689,2169,7690,
+7693,6441,7720,6766,7733,2910,7734,2918,7744,3045,7745,7746,
+3050,7747,3099,7748,7772,6537,7773,7776,3395,7777,7783,5179,
+3491,7784,3663,7793,7980,4143,6453,7801,3847,7802,3849,7803,
+7816,4227,7817,7821,4434,7835,5199,3176,2030,5854,3153,1492,
+5938,7851,6089,7852,6440,2293,7871,6892,7872,1841,7881,1143,
+7884,7618,7610,8055,768,
+};
+
+static pdf_cmap cmap_78ms_RKSJ_H = {
+	-1, "78ms-RKSJ-H", "", 0, 0, 4,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764}, },
+	623, 623, (pdf_range*) cmap_78ms_RKSJ_H_ranges,
+	125, 125, (unsigned short*) cmap_78ms_RKSJ_H_table,
+};
+
+/* 78ms-RKSJ-V */
+
+static const pdf_range cmap_78ms_RKSJ_V_ranges[] = {
+{33089,5,7887},{33091,6,0},{33104,5,7889},{33115,9,7891},
+{33120,17,7894},{33129,69,7899},{33153,0,7917},{33192,6,2},
+{33194,5,736},{33196,0,8270},{33439,0,7918},{33441,0,7919},
+{33443,0,7920},{33445,0,7921},{33447,0,7922},{33473,0,7923},
+{33505,0,7924},{33507,0,7925},{33509,0,7926},{33516,0,7927},
+{33600,0,7928},{33602,0,7929},{33604,0,7930},{33606,0,7931},
+{33608,0,7932},{33634,0,7933},{33667,0,7934},{33669,0,7935},
+{33671,0,7936},{33678,0,7937},{33685,5,7938},{33951,126,4},
+{34655,5,7940},{34657,18,36},{34662,5,7947},{34664,0,8344},
+{34665,5,7950},{34667,0,8348},{34668,5,7953},{34670,0,8349},
+{34688,5,7956},
+};
+
+static const unsigned short cmap_78ms_RKSJ_V_table[41] = {
+8268,8274,739,738,7481,7479,7495,7503,7499,7491,7523,7515,
+7531,7507,7539,7482,7480,7498,7506,7502,7494,7530,7522,7538,
+7514,7554,7526,7519,7534,7511,7545,7527,7516,7535,7508,7542,
+8329,7943,8339,7945,8338,
+};
+
+static pdf_cmap cmap_78ms_RKSJ_V = {
+	-1, "78ms-RKSJ-V", "78ms-RKSJ-H", 0, 1, 0,
+	{ {0,0,0}, },
+	41, 41, (pdf_range*) cmap_78ms_RKSJ_V_ranges,
+	41, 41, (unsigned short*) cmap_78ms_RKSJ_V_table,
+};
+
+/* 83pv-RKSJ-H */
+
+static const pdf_range cmap_83pv_RKSJ_H_ranges[] = {
+{32,377,1},{128,0,97},{160,253,326},{253,10,0},
+{33088,249,633},{33152,177,696},{33208,29,741},{33224,25,749},
+{33242,57,756},{33264,29,771},{33276,0,779},{33359,37,780},
+{33376,101,790},{33409,101,816},{33439,329,842},{33600,249,925},
+{33664,89,988},{33695,93,1011},{33727,93,1035},{33856,129,1059},
+{33904,57,1092},{33920,69,1107},{33951,126,3},{34112,249,232},
+{34176,0,390},{34177,117,296},{34207,249,327},{34270,121,391},
+{34368,249,422},{34432,69,485},{34450,0,295},{34451,45,503},
+{34466,301,7479},{34624,117,7555},{34655,89,7585},{34688,61,7608},
+{34704,10,35},{34707,25,7624},{34714,0,768},{34715,5,7631},
+{34975,373,1125},{35136,249,1219},{35200,497,1282},{35392,249,1407},
+{35456,497,1470},{35648,249,1595},{35712,497,1658},{35904,249,1783},
+{35968,497,1846},{36160,249,1971},{36224,497,2034},{36416,249,2159},
+{36480,497,2222},{36672,249,2347},{36736,497,2410},{36928,249,2535},
+{36992,497,2598},{37184,249,2723},{37248,497,2786},{37440,249,2911},
+{37504,497,2974},{37696,249,3099},{37760,497,3162},{37952,249,3287},
+{38016,497,3350},{38208,249,3475},{38272,497,3538},{38464,249,3663},
+{38528,497,3726},{38720,249,3851},{38784,497,3914},{38976,201,4039},
+{39071,373,4090},{39232,249,4184},{39296,497,4247},{39488,249,4372},
+{39552,497,4435},{39744,249,4560},{39808,497,4623},{40000,249,4748},
+{40064,497,4811},{40256,249,4936},{40320,497,4999},{40512,249,5124},
+{40576,497,5187},{40768,249,5312},{40832,497,5375},{57408,249,5500},
+{57472,497,5563},{57664,249,5688},{57728,497,5751},{57920,249,5876},
+{57984,497,5939},{58176,249,6064},{58240,497,6127},{58432,249,6252},
+{58496,497,6315},{58688,249,6440},{58752,497,6503},{58944,249,6628},
+{59008,497,6691},{59200,249,6816},{59264,497,6879},{59456,249,7004},
+{59520,497,7067},{59712,249,7192},{59776,497,7255},{59968,249,7380},
+{60032,137,7443},{60067,5,8284},{60224,0,633},{60225,5,7887},
+{60227,49,636},{60240,5,7889},{60242,33,651},{60251,9,7891},
+{60254,5,663},{60256,17,7894},{60261,13,670},{60265,69,7899},
+{60283,13,692},{60288,6,38},{60290,169,698},{60344,29,741},
+{60360,25,749},{60378,57,756},{60400,29,771},{60412,0,779},
+{60495,37,780},{60512,101,790},{60545,101,816},{60575,34,40},
+{60584,97,851},{60609,0,7923},{60610,121,877},{60641,18,49},
+{60646,21,913},{60652,0,7927},{60653,17,920},{60736,34,54},
+{60745,97,934},{60770,0,7933},{60771,109,960},{60800,9,988},
+{60803,18,63},{60808,21,996},{60814,0,7937},{60815,21,1003},
+{60821,5,7938},{60831,93,1011},{60863,93,1035},{60992,117,7555},
+{61023,61,7940},{61039,25,7601},{61056,5,7956},{61058,53,7610},
+{61072,10,68},{61075,25,7624},{61082,0,768},{61083,5,7631},
+};
+
+static const unsigned short cmap_83pv_RKSJ_H_table[71] = {
+152,228,124,7479,7481,7491,7495,7503,7499,7507,7523,7515,
+7531,7539,7480,7482,7494,7498,7506,7502,7514,7530,7522,7538,
+7554,7511,7526,7519,7534,7542,7508,7527,7516,7535,7545,762,
+761,769,696,7917,7918,843,7919,845,7920,847,7921,849,
+7922,7924,909,7925,911,7926,7928,926,7929,928,7930,930,
+7931,932,7932,7934,992,7935,994,7936,762,761,769,
+};
+
+static pdf_cmap cmap_83pv_RKSJ_H = {
+	-1, "83pv-RKSJ-H", "", 0, 0, 5,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764},{1,253,255}, },
+	160, 160, (pdf_range*) cmap_83pv_RKSJ_H_ranges,
+	71, 71, (unsigned short*) cmap_83pv_RKSJ_H_table,
+};
+
+/* 90ms-RKSJ-H */
+
+static const pdf_range cmap_90ms_RKSJ_H_ranges[] = {
+{32,373,231},{126,0,631},{160,253,326},{33088,249,633},
+{33152,177,696},{33208,29,741},{33224,25,749},{33242,57,756},
+{33264,29,771},{33276,0,779},{33359,37,780},{33376,101,790},
+{33409,101,816},{33439,329,842},{33600,249,925},{33664,89,988},
+{33695,93,1011},{33727,93,1035},{33856,129,1059},{33904,57,1092},
+{33920,69,1107},{33951,126,0},{34624,117,7555},{34655,5,7585},
+{34657,18,32},{34662,5,7592},{34664,0,8044},{34665,5,7595},
+{34667,0,8043},{34668,5,7598},{34670,0,8047},{34671,25,7601},
+{34686,0,8323},{34688,13,7608},{34692,0,8055},{34693,41,7613},
+{34704,10,37},{34707,25,7624},{34714,0,768},{34715,5,7631},
+{34975,373,1125},{35136,249,1219},{35200,497,1282},{35392,249,1407},
+{35456,497,1470},{35648,249,1595},{35712,497,1658},{35904,249,1783},
+{35968,497,1846},{36160,249,1971},{36224,497,2034},{36416,249,2159},
+{36480,497,2222},{36672,249,2347},{36736,497,2410},{36928,249,2535},
+{36992,497,2598},{37184,249,2723},{37248,497,2786},{37440,249,2911},
+{37504,497,2974},{37696,249,3099},{37760,497,3162},{37952,249,3287},
+{38016,497,3350},{38208,249,3475},{38272,497,3538},{38464,249,3663},
+{38528,497,3726},{38720,249,3851},{38784,497,3914},{38976,201,4039},
+{39071,373,4090},{39232,249,4184},{39296,497,4247},{39488,249,4372},
+{39552,497,4435},{39744,249,4560},{39808,497,4623},{40000,249,4748},
+{40064,497,4811},{40256,249,4936},{40320,497,4999},{40512,249,5124},
+{40576,497,5187},{40768,249,5312},{40832,497,5375},{57408,249,5500},
+{57472,497,5563},{57664,249,5688},{57728,497,5751},{57920,249,5876},
+{57984,497,5939},{58176,249,6064},{58240,497,6127},{58432,249,6252},
+{58496,497,6315},{58688,249,6440},{58752,497,6503},{58944,249,6628},
+{59008,497,6691},{59200,249,6816},{59264,497,6879},{59456,249,7004},
+{59520,497,7067},{59712,249,7192},{59776,497,7255},{59968,249,7380},
+{60032,137,7443},{60067,5,8284},{60736,249,8359},{60800,205,8422},
+{60852,0,1993},{60853,285,8474},{60992,249,8546},{61056,433,8609},
+{61167,37,8092},{61177,0,751},{61178,9,8005},{64064,37,8092},
+{64074,37,7575},{64084,0,751},{64085,9,8005},{64088,14,40},
+{64092,137,8359},{64128,317,8394},{64208,0,1993},{64209,173,8474},
+{64320,249,8518},{64384,497,8581},{64576,45,8706},
+};
+
+static const unsigned short cmap_90ms_RKSJ_H_table[44] = {
+7479,7481,7491,7495,7503,7499,7507,7523,7515,7531,7539,7480,
+7482,7494,7498,7506,7502,7514,7530,7522,7538,7554,7511,7526,
+7519,7534,7542,7508,7527,7516,7535,7545,8038,7588,8040,7590,
+8042,762,761,769,7618,7610,8055,768,
+};
+
+static pdf_cmap cmap_90ms_RKSJ_H = {
+	-1, "90ms-RKSJ-H", "", 0, 0, 4,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764}, },
+	131, 131, (pdf_range*) cmap_90ms_RKSJ_H_ranges,
+	44, 44, (unsigned short*) cmap_90ms_RKSJ_H_table,
+};
+
+/* 90ms-RKSJ-V */
+
+static const pdf_range cmap_90ms_RKSJ_V_ranges[] = {
+{33089,5,7887},{33091,6,0},{33104,5,7889},{33115,9,7891},
+{33120,17,7894},{33129,69,7899},{33153,0,7917},{33192,6,2},
+{33194,5,736},{33196,0,8270},{33439,0,7918},{33441,0,7919},
+{33443,0,7920},{33445,0,7921},{33447,0,7922},{33473,0,7923},
+{33505,0,7924},{33507,0,7925},{33509,0,7926},{33516,0,7927},
+{33600,0,7928},{33602,0,7929},{33604,0,7930},{33606,0,7931},
+{33608,0,7932},{33634,0,7933},{33667,0,7934},{33669,0,7935},
+{33671,0,7936},{33678,0,7937},{33685,5,7938},{33951,126,4},
+{34655,5,7940},{34657,18,36},{34662,5,7947},{34664,0,8344},
+{34665,5,7950},{34667,0,8348},{34668,5,7953},{34670,0,8349},
+{34688,5,7956},
+};
+
+static const unsigned short cmap_90ms_RKSJ_V_table[41] = {
+8268,8274,739,738,7481,7479,7495,7503,7499,7491,7523,7515,
+7531,7507,7539,7482,7480,7498,7506,7502,7494,7530,7522,7538,
+7514,7554,7526,7519,7534,7511,7545,7527,7516,7535,7508,7542,
+8329,7943,8339,7945,8338,
+};
+
+static pdf_cmap cmap_90ms_RKSJ_V = {
+	-1, "90ms-RKSJ-V", "90ms-RKSJ-H", 0, 1, 0,
+	{ {0,0,0}, },
+	41, 41, (pdf_range*) cmap_90ms_RKSJ_V_ranges,
+	41, 41, (unsigned short*) cmap_90ms_RKSJ_V_table,
+};
+
+/* 90msp-RKSJ-H */
+
+static const pdf_range cmap_90msp_RKSJ_H_ranges[] = {
+{32,377,1},{160,253,326},{33088,249,633},{33152,177,696},
+{33208,29,741},{33224,25,749},{33242,57,756},{33264,29,771},
+{33276,0,779},{33359,37,780},{33376,101,790},{33409,101,816},
+{33439,329,842},{33600,249,925},{33664,89,988},{33695,93,1011},
+{33727,93,1035},{33856,129,1059},{33904,57,1092},{33920,69,1107},
+{33951,126,0},{34624,117,7555},{34655,5,7585},{34657,18,32},
+{34662,5,7592},{34664,0,8044},{34665,5,7595},{34667,0,8043},
+{34668,5,7598},{34670,0,8047},{34671,25,7601},{34686,0,8323},
+{34688,13,7608},{34692,0,8055},{34693,41,7613},{34704,10,37},
+{34707,25,7624},{34714,0,768},{34715,5,7631},{34975,373,1125},
+{35136,249,1219},{35200,497,1282},{35392,249,1407},{35456,497,1470},
+{35648,249,1595},{35712,497,1658},{35904,249,1783},{35968,497,1846},
+{36160,249,1971},{36224,497,2034},{36416,249,2159},{36480,497,2222},
+{36672,249,2347},{36736,497,2410},{36928,249,2535},{36992,497,2598},
+{37184,249,2723},{37248,497,2786},{37440,249,2911},{37504,497,2974},
+{37696,249,3099},{37760,497,3162},{37952,249,3287},{38016,497,3350},
+{38208,249,3475},{38272,497,3538},{38464,249,3663},{38528,497,3726},
+{38720,249,3851},{38784,497,3914},{38976,201,4039},{39071,373,4090},
+{39232,249,4184},{39296,497,4247},{39488,249,4372},{39552,497,4435},
+{39744,249,4560},{39808,497,4623},{40000,249,4748},{40064,497,4811},
+{40256,249,4936},{40320,497,4999},{40512,249,5124},{40576,497,5187},
+{40768,249,5312},{40832,497,5375},{57408,249,5500},{57472,497,5563},
+{57664,249,5688},{57728,497,5751},{57920,249,5876},{57984,497,5939},
+{58176,249,6064},{58240,497,6127},{58432,249,6252},{58496,497,6315},
+{58688,249,6440},{58752,497,6503},{58944,249,6628},{59008,497,6691},
+{59200,249,6816},{59264,497,6879},{59456,249,7004},{59520,497,7067},
+{59712,249,7192},{59776,497,7255},{59968,249,7380},{60032,137,7443},
+{60067,5,8284},{60736,249,8359},{60800,205,8422},{60852,0,1993},
+{60853,285,8474},{60992,249,8546},{61056,433,8609},{61167,37,8092},
+{61177,0,751},{61178,9,8005},{64064,37,8092},{64074,37,7575},
+{64084,0,751},{64085,9,8005},{64088,14,40},{64092,137,8359},
+{64128,317,8394},{64208,0,1993},{64209,173,8474},{64320,249,8518},
+{64384,497,8581},{64576,45,8706},
+};
+
+static const unsigned short cmap_90msp_RKSJ_H_table[44] = {
+7479,7481,7491,7495,7503,7499,7507,7523,7515,7531,7539,7480,
+7482,7494,7498,7506,7502,7514,7530,7522,7538,7554,7511,7526,
+7519,7534,7542,7508,7527,7516,7535,7545,8038,7588,8040,7590,
+8042,762,761,769,7618,7610,8055,768,
+};
+
+static pdf_cmap cmap_90msp_RKSJ_H = {
+	-1, "90msp-RKSJ-H", "", 0, 0, 4,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764}, },
+	130, 130, (pdf_range*) cmap_90msp_RKSJ_H_ranges,
+	44, 44, (unsigned short*) cmap_90msp_RKSJ_H_table,
+};
+
+/* 90msp-RKSJ-V */
+
+static const pdf_range cmap_90msp_RKSJ_V_ranges[] = {
+{33089,5,7887},{33091,6,0},{33104,5,7889},{33115,9,7891},
+{33120,17,7894},{33129,69,7899},{33153,0,7917},{33192,6,2},
+{33194,5,736},{33196,0,8270},{33439,0,7918},{33441,0,7919},
+{33443,0,7920},{33445,0,7921},{33447,0,7922},{33473,0,7923},
+{33505,0,7924},{33507,0,7925},{33509,0,7926},{33516,0,7927},
+{33600,0,7928},{33602,0,7929},{33604,0,7930},{33606,0,7931},
+{33608,0,7932},{33634,0,7933},{33667,0,7934},{33669,0,7935},
+{33671,0,7936},{33678,0,7937},{33685,5,7938},{33951,126,4},
+{34655,5,7940},{34657,18,36},{34662,5,7947},{34664,0,8344},
+{34665,5,7950},{34667,0,8348},{34668,5,7953},{34670,0,8349},
+{34688,5,7956},
+};
+
+static const unsigned short cmap_90msp_RKSJ_V_table[41] = {
+8268,8274,739,738,7481,7479,7495,7503,7499,7491,7523,7515,
+7531,7507,7539,7482,7480,7498,7506,7502,7494,7530,7522,7538,
+7514,7554,7526,7519,7534,7511,7545,7527,7516,7535,7508,7542,
+8329,7943,8339,7945,8338,
+};
+
+static pdf_cmap cmap_90msp_RKSJ_V = {
+	-1, "90msp-RKSJ-V", "90msp-RKSJ-H", 0, 1, 0,
+	{ {0,0,0}, },
+	41, 41, (pdf_range*) cmap_90msp_RKSJ_V_ranges,
+	41, 41, (unsigned short*) cmap_90msp_RKSJ_V_table,
+};
+
+/* 90pv-RKSJ-H */
+
+static const pdf_range cmap_90pv_RKSJ_H_ranges[] = {
+{32,377,1},{128,0,97},{160,253,326},{253,10,0},
+{33088,249,633},{33152,177,696},{33208,29,741},{33224,25,749},
+{33242,57,756},{33264,29,771},{33276,0,779},{33359,37,780},
+{33376,101,790},{33409,101,816},{33439,329,842},{33600,249,925},
+{33664,89,988},{33695,93,1011},{33727,93,1035},{33856,129,1059},
+{33904,57,1092},{33920,69,1107},{33951,126,3},{34112,77,7555},
+{34142,77,8071},{34172,9,8286},{34176,21,8289},{34193,37,8061},
+{34207,37,7575},{34217,5,8225},{34219,9,8295},{34227,37,8092},
+{34237,17,8298},{34267,101,8112},{34368,46,35},{34380,5,7605},
+{34382,0,8037},{34383,25,8024},{34390,6,47},{34392,5,8034},
+{34394,9,8031},{34397,0,8306},{34459,9,7610},{34462,6,49},
+{34464,5,8016},{34466,18,51},{34483,10,56},{34503,13,8219},
+{34507,13,8309},{34511,14,59},{34515,13,8206},{34624,25,8197},
+{34631,58,63},{34646,5,8139},{34648,0,8142},{34705,5,8317},
+{34707,17,7613},{34712,50,78},{34725,5,8327},{34727,6,91},
+{34729,5,8040},{34731,42,93},{34749,0,8048},{34750,5,8051},
+{34752,5,8049},{34789,9,7621},{34792,0,8323},{34810,0,8054},
+{34811,5,8321},{34880,0,7624},{34881,5,7629},{34900,5,7608},
+{34920,0,7958},{34922,13,8313},{34975,373,1125},{35136,249,1219},
+{35200,497,1282},{35392,249,1407},{35456,497,1470},{35648,249,1595},
+{35712,497,1658},{35904,249,1783},{35968,497,1846},{36160,249,1971},
+{36224,497,2034},{36416,249,2159},{36480,497,2222},{36672,249,2347},
+{36736,497,2410},{36928,249,2535},{36992,497,2598},{37184,249,2723},
+{37248,497,2786},{37440,249,2911},{37504,497,2974},{37696,249,3099},
+{37760,497,3162},{37952,249,3287},{38016,497,3350},{38208,249,3475},
+{38272,497,3538},{38464,249,3663},{38528,497,3726},{38720,249,3851},
+{38784,497,3914},{38976,201,4039},{39071,373,4090},{39232,249,4184},
+{39296,497,4247},{39488,249,4372},{39552,497,4435},{39744,249,4560},
+{39808,497,4623},{40000,249,4748},{40064,497,4811},{40256,249,4936},
+{40320,497,4999},{40512,249,5124},{40576,497,5187},{40768,249,5312},
+{40832,497,5375},{57408,249,5500},{57472,497,5563},{57664,249,5688},
+{57728,497,5751},{57920,249,5876},{57984,497,5939},{58176,249,6064},
+{58240,497,6127},{58432,249,6252},{58496,497,6315},{58688,249,6440},
+{58752,497,6503},{58944,249,6628},{59008,497,6691},{59200,249,6816},
+{59264,497,6879},{59456,249,7004},{59520,497,7067},{59712,249,7192},
+{59776,497,7255},{59968,249,7380},{60032,137,7443},{60067,5,8284},
+{60225,5,7887},{60240,5,7889},{60251,9,7891},{60256,17,7894},
+{60265,69,7899},{60289,0,7917},{60575,0,7918},{60577,0,7919},
+{60579,0,7920},{60581,0,7921},{60583,0,7922},{60609,0,7923},
+{60641,0,7924},{60643,0,7925},{60645,0,7926},{60652,0,7927},
+{60736,0,7928},{60738,0,7929},{60740,0,7930},{60742,0,7931},
+{60744,0,7932},{60770,0,7933},{60803,0,7934},{60805,0,7935},
+{60807,0,7936},{60814,0,7937},{60821,5,7938},
+};
+
+static const unsigned short cmap_90pv_RKSJ_H_table[104] = {
+152,228,124,7479,7481,7491,7495,7503,7499,7507,7523,7515,
+7531,7539,7480,7482,7494,7498,7506,7502,7514,7530,7522,7538,
+7554,7511,7526,7519,7534,7542,7508,7527,7516,7535,7545,7601,
+8186,7602,8020,8022,8303,7607,8023,7603,8021,7604,8304,8305,
+8036,8307,8018,8019,8211,8213,8212,8214,8058,8056,8308,8014,
+8013,8012,8011,8150,8204,8145,8138,7620,8151,7618,8146,8141,
+7619,8149,8147,8143,8148,8144,8154,8165,8319,8158,8191,8320,
+8223,7585,8038,7588,7586,8039,8183,8042,7592,7590,7593,7599,
+8046,8044,7595,8045,8043,7596,8047,7598,
+};
+
+static pdf_cmap cmap_90pv_RKSJ_H = {
+	-1, "90pv-RKSJ-H", "", 0, 0, 5,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764},{1,253,255}, },
+	171, 171, (pdf_range*) cmap_90pv_RKSJ_H_ranges,
+	104, 104, (unsigned short*) cmap_90pv_RKSJ_H_table,
+};
+
+/* 90pv-RKSJ-V */
+
+static const pdf_range cmap_90pv_RKSJ_V_ranges[] = {
+{33089,5,7887},{33104,5,7889},{33115,9,7891},{33120,17,7894},
+{33129,69,7899},{33153,0,7917},{33439,0,7918},{33441,0,7919},
+{33443,0,7920},{33445,0,7921},{33447,0,7922},{33473,0,7923},
+{33505,0,7924},{33507,0,7925},{33509,0,7926},{33516,0,7927},
+{33600,0,7928},{33602,0,7929},{33604,0,7930},{33606,0,7931},
+{33608,0,7932},{33634,0,7933},{33667,0,7934},{33669,0,7935},
+{33671,0,7936},{33678,0,7937},{33685,5,7938},{34719,18,0},
+{34724,5,8333},{34726,5,8337},{34728,0,7947},{34729,5,8339},
+{34731,10,5},{34734,5,8343},{34736,0,7950},{34737,5,8347},
+{34739,10,8},{34749,18,11},{34810,9,8324},
+};
+
+static const unsigned short cmap_90pv_RKSJ_V_table[16] = {
+7940,8329,7943,7941,8330,7945,7948,7954,7951,8349,7953,8350,
+8353,8356,8358,8357,
+};
+
+static pdf_cmap cmap_90pv_RKSJ_V = {
+	-1, "90pv-RKSJ-V", "90pv-RKSJ-H", 0, 1, 0,
+	{ {0,0,0}, },
+	39, 39, (pdf_range*) cmap_90pv_RKSJ_V_ranges,
+	16, 16, (unsigned short*) cmap_90pv_RKSJ_V_table,
+};
+
+/* Add-H */
+
+static const pdf_range cmap_Add_H_ranges[] = {
+{8481,373,633},{8737,53,727},{8762,29,741},{8778,25,749},
+{8796,57,756},{8818,29,771},{8830,0,779},{9008,37,780},
+{9025,101,790},{9057,101,816},{9249,329,842},{9332,9,7958},
+{9505,341,925},{9761,93,1011},{9793,93,1035},{10017,129,1059},
+{10065,129,1092},{10273,126,0},{12321,6,32},{12323,57,1127},
+{12338,0,7961},{12339,29,1143},{12347,0,7634},{12348,197,1152},
+{12398,0,7635},{12399,5,1203},{12401,10,34},{12404,29,1208},
+{12412,0,7637},{12413,5,1217},{12577,33,1219},{12586,0,7638},
+{12587,29,1229},{12595,10,37},{12598,9,1240},{12601,0,7964},
+{12602,9,1244},{12605,0,7642},{12606,13,1248},{12610,0,7643},
+{12611,157,1253},{12651,0,7644},{12652,73,1294},{12833,25,1313},
+{12840,10,40},{12843,209,1323},{12896,0,7647},{12897,21,1377},
+{12903,0,7965},{12904,69,1384},{12922,0,7648},{12923,13,1403},
+{13089,6,43},{13091,285,1409},{13163,0,7652},{13164,25,1482},
+{13171,0,7653},{13172,21,1490},{13178,0,7654},{13179,13,1497},
+{13345,129,1501},{13378,0,7655},{13379,37,1535},{13389,0,7656},
+{13390,89,1546},{13413,0,7657},{13414,97,1570},{13601,37,1595},
+{13611,0,7658},{13612,77,1606},{13632,0,7659},{13633,129,1627},
+{13666,0,7966},{13667,17,1661},{13672,0,7967},{13673,85,1667},
+{13857,6,45},{13859,25,1691},{13866,0,7661},{13867,89,1699},
+{13890,0,7968},{13891,45,1723},{13903,0,7662},{13904,113,1736},
+{13933,0,7663},{13934,21,1766},{13940,0,7664},{13941,21,1773},
+{13947,14,47},{14113,85,1783},{14135,0,7668},{14136,101,1806},
+{14162,0,7671},{14163,117,1833},{14193,0,7674},{14194,41,1864},
+{14205,6,51},{14369,73,1877},{14388,0,7677},{14389,45,1897},
+{14401,0,7678},{14402,241,1910},{14625,37,1971},{14635,0,7679},
+{14636,257,1982},{14701,0,7682},{14702,21,2048},{14708,0,7683},
+{14709,13,2055},{14713,0,7684},{14714,17,2060},{14881,197,2065},
+{14931,0,7685},{14932,73,2116},{14951,0,7686},{14952,45,2136},
+{14964,0,7687},{14965,37,2149},{15137,21,2159},{15143,0,7688},
+{15144,5,2166},{15146,10,53},{15149,45,2171},{15161,0,7691},
+{15162,25,2184},{15169,0,7970},{15170,241,2192},{15393,153,2253},
+{15432,0,7693},{15433,77,2293},{15453,5,7695},{15455,125,2315},
+{15649,37,2347},{15659,0,7697},{15660,37,2358},{15670,0,7698},
+{15671,209,2369},{15724,0,7699},{15725,17,2423},{15730,5,7701},
+{15732,41,2430},{15905,13,2441},{15909,0,7703},{15910,49,2446},
+{15923,0,7704},{15924,129,2460},{15957,0,7706},{15958,33,2494},
+{15967,0,7707},{15968,13,2504},{15972,0,7708},{15973,101,2509},
+{16161,33,2535},{16170,0,7709},{16171,181,2545},{16217,0,7971},
+{16218,21,2592},{16224,0,7711},{16225,117,2599},{16417,6,56},
+{16419,265,2631},{16486,0,7715},{16487,37,2699},{16497,0,7716},
+{16498,25,2710},{16505,10,58},{16508,5,7973},{16510,0,2722},
+{16673,21,2723},{16679,0,7720},{16680,65,2730},{16697,0,7721},
+{16698,69,2748},{16716,0,7722},{16717,5,2767},{16719,0,7723},
+{16720,57,2770},{16735,0,7724},{16736,33,2786},{16745,0,7725},
+{16746,81,2796},{16929,85,2817},{16951,0,7975},{16952,17,2840},
+{16957,0,7726},{16958,57,2846},{16973,0,7727},{16974,53,2862},
+{16988,0,7728},{16989,21,2877},{16995,0,7729},{16996,41,2884},
+{17007,0,7730},{17008,49,2896},{17021,6,61},{17185,21,2911},
+{17191,10,63},{17194,9,2920},{17197,5,7737},{17199,53,2925},
+{17213,0,7739},{17214,197,2940},{17264,0,7740},{17265,13,2991},
+{17269,0,7741},{17270,21,2996},{17276,0,7742},{17277,5,3003},
+{17441,109,3005},{17469,0,7743},{17470,37,3034},{17480,10,66},
+{17483,13,3047},{17487,0,7747},{17488,185,3052},{17697,6,69},
+{17699,13,3101},{17703,0,7749},{17704,21,3106},{17710,0,7750},
+{17711,25,3113},{17718,0,7751},{17719,29,3121},{17727,0,7752},
+{17728,29,3130},{17736,0,7753},{17737,5,3139},{17739,0,7754},
+{17740,17,3142},{17745,6,71},{17747,65,3149},{17764,0,7757},
+{17765,73,3167},{17784,0,7758},{17785,21,3187},{17953,129,3193},
+{17986,0,7760},{17987,65,3227},{18004,0,7761},{18005,21,3245},
+{18011,0,7763},{18012,37,3252},{18022,5,7766},{18024,5,3264},
+{18026,0,7768},{18027,41,3267},{18038,0,7872},{18039,29,3279},
+{18209,29,3287},{18217,6,73},{18219,53,3297},{18233,0,7770},
+{18234,113,3312},{18263,0,7771},{18264,57,3342},{18279,10,75},
+{18282,9,3360},{18285,0,7774},{18286,65,3364},{18465,9,3381},
+{18468,0,7775},{18469,33,3385},{18478,10,78},{18481,57,3397},
+{18496,0,7978},{18497,73,3413},{18516,0,7778},{18517,125,3433},
+{18549,0,7780},{18550,33,3466},{18721,0,3475},{18722,5,7781},
+{18724,41,3478},{18735,0,7783},{18736,5,3490},{18738,0,7784},
+{18739,5,3493},{18741,0,7785},{18742,37,3496},{18752,0,7786},
+{18753,49,3507},{18766,0,7787},{18767,189,3521},{18977,133,3569},
+{19011,0,7789},{19012,33,3604},{19021,0,7790},{19022,17,3614},
+{19027,0,7979},{19028,21,3620},{19034,0,7791},{19035,117,3627},
+{19065,0,7792},{19066,17,3658},{19233,29,3663},{19241,0,7794},
+{19242,129,3672},{19275,0,7795},{19276,141,3706},{19312,0,7796},
+{19313,25,3743},{19320,0,7980},{19321,21,3751},{19489,173,3757},
+{19533,0,7797},{19534,41,3802},{19545,0,7798},{19546,17,3814},
+{19551,0,7799},{19552,5,3820},{19554,0,7800},{19555,89,3823},
+{19578,10,81},{19581,5,3849},{19745,65,3851},{19762,0,7804},
+{19763,113,3869},{19792,0,7805},{19793,9,3899},{19796,0,7806},
+{19797,77,3903},{19817,0,7807},{19818,81,3924},{20001,353,3945},
+{20090,5,7809},{20092,0,7981},{20093,5,4037},{20257,0,7811},
+{20258,57,4040},{20273,0,7812},{20274,25,4056},{20281,0,7813},
+{20282,101,4064},{20513,373,4090},{20769,6,84},{20771,101,4186},
+{20797,0,7814},{20798,57,4213},{20813,0,7817},{20814,193,4229},
+{21025,89,4278},{21048,0,7983},{21049,277,4302},{21281,57,4372},
+{21296,0,7818},{21297,33,4388},{21306,0,7819},{21307,49,4398},
+{21320,0,7984},{21321,81,4412},{21342,0,7821},{21343,45,4434},
+{21355,6,86},{21357,69,4448},{21537,137,4466},{21572,6,88},
+{21574,149,4503},{21612,0,7987},{21613,69,4542},{21793,109,4560},
+{21821,0,7824},{21822,145,4589},{21859,0,7825},{21860,77,4627},
+{21880,0,7988},{21881,21,4648},{22049,6,90},{22051,357,4656},
+{22141,5,7989},{22305,373,4748},{22561,9,4842},{22564,0,7828},
+{22565,357,4846},{22817,25,4936},{22824,0,7991},{22825,217,4944},
+{22880,0,7829},{22881,41,5000},{22892,0,7830},{22893,69,5012},
+{23073,93,5030},{23097,0,7831},{23098,253,5055},{23162,0,7992},
+{23163,13,5120},{23329,141,5124},{23365,0,7833},{23366,145,5161},
+{23403,0,7835},{23404,73,5199},{23585,373,5218},{23841,253,5312},
+{23905,0,7993},{23906,113,5377},{24097,185,5406},{24144,0,7837},
+{24145,17,5454},{24150,0,7994},{24151,121,5460},{24182,0,7995},
+{24183,29,5492},{24353,325,5500},{24435,0,7838},{24436,41,5583},
+{24609,17,5594},{24614,0,7839},{24615,221,5600},{24671,0,7840},
+{24672,121,5657},{24865,37,5688},{24875,0,7841},{24876,329,5699},
+{25121,309,5782},{25199,0,7845},{25200,57,5861},{25377,161,5876},
+{25418,0,7846},{25419,33,5918},{25428,0,7847},{25429,13,5928},
+{25433,0,7996},{25434,145,5933},{25633,93,5970},{25657,0,7848},
+{25658,21,5995},{25664,0,7997},{25665,137,6002},{25700,0,7849},
+{25701,33,6038},{25710,0,7850},{25711,61,6048},{25889,93,6064},
+{25913,10,92},{25916,37,6091},{25926,0,7853},{25927,221,6102},
+{26145,157,6158},{26185,0,7998},{26186,209,6199},{26401,265,6252},
+{26468,0,7855},{26469,13,6320},{26473,0,7856},{26474,29,6325},
+{26482,0,7857},{26483,45,6334},{26657,101,6346},{26683,0,7859},
+{26684,65,6373},{26701,0,7999},{26702,193,6391},{26913,369,6440},
+{27006,0,8000},{27169,105,6534},{27196,5,8001},{27198,193,6563},
+{27247,0,7864},{27248,57,6613},{27425,65,6628},{27442,0,7865},
+{27443,201,6646},{27494,0,7866},{27495,93,6698},{27681,285,6722},
+{27753,0,7868},{27754,81,6795},{27937,177,6816},{27982,0,7870},
+{27983,189,6862},{28193,29,6910},{28201,0,7873},{28202,73,6919},
+{28221,0,7874},{28222,257,6939},{28449,373,7004},{28705,189,7098},
+{28753,0,7879},{28754,177,7147},{28961,221,7192},{29017,0,8003},
+{29018,145,7249},{29217,45,7286},{29229,0,7882},{29230,53,7299},
+{29244,0,7883},{29245,65,7314},{29262,0,7884},{29263,189,7332},
+{29473,189,7380},{29521,6,95},{29523,165,7430},{29565,6,97},
+{29729,13,7474},{29733,5,8284},{30497,9,8005},{30503,14,99},
+{30510,41,8009},{30524,9,7601},{30527,6,103},{30529,9,8021},
+{30532,9,7604},{30535,37,8024},{30545,10,105},{30548,5,8035},
+{30551,0,8037},{30553,14,108},{30557,9,8039},{30560,26,112},
+{30567,5,8044},{30569,0,7599},{30570,25,8046},{30580,21,8053},
+{30586,6,119},{30590,0,8060},{30761,37,8061},{30772,77,8071},
+{30793,77,7555},{30813,0,8091},{30814,37,7575},{30827,77,8092},
+{31009,101,8112},{31045,0,7958},{31049,5,8138},{31051,0,7620},
+{31052,9,8140},{31055,0,7619},{31056,17,8143},{31061,0,7618},
+{31062,13,8148},{31069,53,8152},{31087,61,8166},{32033,5,7887},
+{32035,6,121},{32037,37,7889},{32047,14,123},{32051,69,7899},
+{32069,85,7918},{32091,5,8264},{32109,13,736},{32113,13,8182},
+};
+
+static const unsigned short cmap_Add_H_table[127] = {
+7479,7481,7491,7495,7503,7499,7507,7523,7515,7531,7539,7480,
+7482,7494,7498,7506,7502,7514,7530,7522,7538,7554,7511,7526,
+7519,7534,7542,7508,7527,7516,7535,7545,1125,7633,7962,1206,
+7636,7963,1238,7639,7645,1321,7646,1407,7650,1689,7660,7665,
+1780,7666,1782,7969,7676,7689,2169,7690,2629,7713,7718,7972,
+2719,7733,2910,7734,2918,7735,7744,3045,7745,3099,7748,7976,
+7756,7769,7977,7772,3358,7773,7776,3395,7777,7801,3847,7802,
+4184,7982,7822,7985,7823,7986,4654,7826,7851,6089,7852,7885,
+8004,7886,7473,8008,768,762,761,8020,7607,771,8034,772,
+7588,7585,8038,7586,7590,8042,7592,7596,8043,7598,7595,7610,
+8059,8268,8274,8282,8275,8280,8277,
+};
+
+static pdf_cmap cmap_Add_H = {
+	-1, "Add-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	540, 540, (pdf_range*) cmap_Add_H_ranges,
+	127, 127, (unsigned short*) cmap_Add_H_table,
+};
+
+/* Add-RKSJ-H */
+
+static const pdf_range cmap_Add_RKSJ_H_ranges[] = {
+{32,377,231},{160,253,326},{33088,249,633},{33152,177,696},
+{33208,29,741},{33224,25,749},{33242,57,756},{33264,29,771},
+{33276,0,779},{33359,37,780},{33376,101,790},{33409,101,816},
+{33439,329,842},{33522,9,7958},{33600,249,925},{33664,89,988},
+{33695,93,1011},{33727,93,1035},{33856,129,1059},{33904,57,1092},
+{33920,69,1107},{33951,126,0},{34975,6,32},{34977,57,1127},
+{34992,0,7961},{34993,29,1143},{35001,0,7634},{35002,197,1152},
+{35052,0,7635},{35053,5,1203},{35055,10,34},{35058,29,1208},
+{35066,0,7637},{35067,5,1217},{35136,33,1219},{35145,0,7638},
+{35146,29,1229},{35154,10,37},{35157,9,1240},{35160,0,7964},
+{35161,9,1244},{35164,0,7642},{35165,13,1248},{35169,0,7643},
+{35170,113,1253},{35200,41,1282},{35211,0,7644},{35212,101,1294},
+{35238,10,40},{35241,209,1323},{35294,0,7647},{35295,21,1377},
+{35301,0,7965},{35302,69,1384},{35320,0,7648},{35321,13,1403},
+{35392,6,43},{35394,241,1409},{35456,41,1470},{35467,0,7652},
+{35468,25,1482},{35475,0,7653},{35476,21,1490},{35482,0,7654},
+{35483,145,1497},{35520,0,7655},{35521,37,1535},{35531,0,7656},
+{35532,89,1546},{35555,0,7657},{35556,97,1570},{35648,37,1595},
+{35658,0,7658},{35659,77,1606},{35679,0,7659},{35680,121,1627},
+{35712,5,1658},{35714,0,7966},{35715,17,1661},{35720,0,7967},
+{35721,89,1667},{35744,0,7660},{35745,25,1691},{35752,0,7661},
+{35753,89,1699},{35776,0,7968},{35777,45,1723},{35789,0,7662},
+{35790,113,1736},{35819,0,7663},{35820,21,1766},{35826,0,7664},
+{35827,21,1773},{35833,14,45},{35904,85,1783},{35926,0,7668},
+{35927,101,1806},{35953,0,7671},{35954,49,1833},{35968,65,1846},
+{35985,0,7674},{35986,41,1864},{35997,6,49},{35999,73,1877},
+{36018,0,7677},{36019,45,1897},{36031,0,7678},{36032,241,1910},
+{36160,37,1971},{36170,0,7679},{36171,205,1982},{36224,49,2034},
+{36237,0,7682},{36238,21,2048},{36244,0,7683},{36245,13,2055},
+{36249,0,7684},{36250,217,2060},{36305,0,7685},{36306,73,2116},
+{36325,0,7686},{36326,45,2136},{36338,0,7687},{36339,37,2149},
+{36416,21,2159},{36422,0,7688},{36423,5,2166},{36425,10,51},
+{36428,45,2171},{36440,0,7691},{36441,25,2184},{36448,0,7970},
+{36449,117,2192},{36480,277,2222},{36550,0,7693},{36551,77,2293},
+{36571,5,7695},{36573,125,2315},{36672,37,2347},{36682,0,7697},
+{36683,37,2358},{36693,0,7698},{36694,161,2369},{36736,45,2410},
+{36748,0,7699},{36749,17,2423},{36754,5,7701},{36756,57,2430},
+{36771,0,7703},{36772,49,2446},{36785,0,7704},{36786,129,2460},
+{36819,0,7706},{36820,33,2494},{36829,0,7707},{36830,13,2504},
+{36834,0,7708},{36835,101,2509},{36928,33,2535},{36937,0,7709},
+{36938,181,2545},{36984,0,7971},{36985,21,2592},{36992,0,7711},
+{36993,121,2599},{37024,0,7713},{37025,265,2631},{37092,0,7715},
+{37093,37,2699},{37103,0,7716},{37104,25,2710},{37111,10,54},
+{37114,5,7973},{37116,0,2722},{37184,21,2723},{37190,0,7720},
+{37191,65,2730},{37208,0,7721},{37209,69,2748},{37227,0,7722},
+{37228,5,2767},{37230,0,7723},{37231,57,2770},{37246,0,7724},
+{37248,33,2786},{37257,0,7725},{37258,169,2796},{37301,0,7975},
+{37302,17,2840},{37307,0,7726},{37308,57,2846},{37323,0,7727},
+{37324,53,2862},{37338,0,7728},{37339,21,2877},{37345,0,7729},
+{37346,41,2884},{37357,0,7730},{37358,49,2896},{37371,6,57},
+{37440,21,2911},{37446,10,59},{37449,9,2920},{37452,5,7737},
+{37454,53,2925},{37468,0,7739},{37469,133,2940},{37504,61,2974},
+{37520,0,7740},{37521,13,2991},{37525,0,7741},{37526,21,2996},
+{37532,0,7742},{37533,117,3003},{37563,0,7743},{37564,37,3034},
+{37574,10,62},{37577,13,3047},{37581,0,7747},{37582,185,3052},
+{37696,6,65},{37698,13,3101},{37702,0,7749},{37703,21,3106},
+{37709,0,7750},{37710,25,3113},{37717,0,7751},{37718,29,3121},
+{37726,0,7752},{37727,29,3130},{37735,0,7753},{37736,5,3139},
+{37738,0,7754},{37739,17,3142},{37744,6,67},{37746,49,3149},
+{37760,13,3162},{37764,0,7757},{37765,73,3167},{37784,0,7758},
+{37785,153,3187},{37824,0,7760},{37825,65,3227},{37842,0,7761},
+{37843,21,3245},{37849,0,7763},{37850,37,3252},{37860,5,7766},
+{37862,5,3264},{37864,0,7768},{37865,41,3267},{37876,0,7872},
+{37877,29,3279},{37952,29,3287},{37960,6,69},{37962,53,3297},
+{37976,0,7770},{37977,113,3312},{38006,0,7771},{38007,29,3342},
+{38016,25,3350},{38023,10,71},{38026,9,3360},{38029,0,7774},
+{38030,77,3364},{38050,0,7775},{38051,33,3385},{38060,10,74},
+{38063,57,3397},{38078,0,7978},{38079,73,3413},{38098,0,7778},
+{38099,125,3433},{38131,0,7780},{38132,33,3466},{38208,0,3475},
+{38209,5,7781},{38211,41,3478},{38222,0,7783},{38223,5,3490},
+{38225,0,7784},{38226,5,3493},{38228,0,7785},{38229,37,3496},
+{38239,0,7786},{38240,49,3507},{38253,0,7787},{38254,65,3521},
+{38272,257,3538},{38337,0,7789},{38338,33,3604},{38347,0,7790},
+{38348,17,3614},{38353,0,7979},{38354,21,3620},{38360,0,7791},
+{38361,117,3627},{38391,0,7792},{38392,17,3658},{38464,29,3663},
+{38472,0,7794},{38473,129,3672},{38506,0,7795},{38507,77,3706},
+{38528,61,3726},{38544,0,7796},{38545,25,3743},{38552,0,7980},
+{38553,197,3751},{38603,0,7797},{38604,41,3802},{38615,0,7798},
+{38616,17,3814},{38621,0,7799},{38622,5,3820},{38624,0,7800},
+{38625,89,3823},{38648,10,77},{38651,5,3849},{38720,65,3851},
+{38737,0,7804},{38738,113,3869},{38767,0,7805},{38768,9,3899},
+{38771,0,7806},{38772,41,3903},{38784,33,3914},{38793,0,7807},
+{38794,437,3924},{38904,5,7809},{38906,0,7981},{38907,5,4037},
+{38976,0,7811},{38977,57,4040},{38992,0,7812},{38993,25,4056},
+{39000,0,7813},{39001,101,4064},{39071,373,4090},{39232,6,80},
+{39234,101,4186},{39260,0,7814},{39261,57,4213},{39276,0,7817},
+{39277,69,4229},{39296,213,4247},{39350,0,7983},{39351,277,4302},
+{39488,57,4372},{39503,0,7818},{39504,33,4388},{39513,0,7819},
+{39514,49,4398},{39527,0,7984},{39528,81,4412},{39549,6,82},
+{39552,41,4435},{39563,6,84},{39565,209,4448},{39618,6,86},
+{39620,149,4503},{39658,0,7987},{39659,69,4542},{39744,109,4560},
+{39772,0,7824},{39773,133,4589},{39808,9,4623},{39811,0,7825},
+{39812,77,4627},{39832,0,7988},{39833,25,4648},{39840,0,7826},
+{39841,357,4656},{39931,5,7989},{40000,249,4748},{40064,133,4811},
+{40098,0,7828},{40099,357,4846},{40256,25,4936},{40263,0,7991},
+{40264,217,4944},{40320,0,7829},{40321,41,5000},{40332,0,7830},
+{40333,165,5012},{40375,0,7831},{40376,253,5055},{40440,0,7992},
+{40441,13,5120},{40512,141,5124},{40548,0,7833},{40549,101,5161},
+{40576,41,5187},{40587,0,7835},{40588,449,5199},{40768,249,5312},
+{40832,6,88},{40834,301,5377},{40910,0,7837},{40911,17,5454},
+{40916,0,7994},{40917,121,5460},{40948,0,7995},{40949,29,5492},
+{57408,249,5500},{57472,73,5563},{57491,0,7838},{57492,61,5583},
+{57508,0,7839},{57509,221,5600},{57565,0,7840},{57566,121,5657},
+{57664,37,5688},{57674,0,7841},{57675,205,5699},{57728,433,5751},
+{57837,0,7845},{57838,57,5861},{57920,161,5876},{57961,0,7846},
+{57962,33,5918},{57971,0,7847},{57972,13,5928},{57976,0,7996},
+{57977,21,5933},{57984,217,5939},{58039,0,7848},{58040,21,5995},
+{58046,0,7997},{58047,137,6002},{58082,0,7849},{58083,33,6038},
+{58092,0,7850},{58093,61,6048},{58176,93,6064},{58200,10,90},
+{58203,37,6091},{58213,0,7853},{58214,97,6102},{58240,281,6127},
+{58311,0,7998},{58312,209,6199},{58432,249,6252},{58496,13,6315},
+{58500,0,7855},{58501,13,6320},{58505,0,7856},{58506,29,6325},
+{58514,0,7857},{58515,149,6334},{58553,0,7859},{58554,65,6373},
+{58571,0,7999},{58572,193,6391},{58688,249,6440},{58752,117,6503},
+{58782,0,8000},{58783,105,6534},{58810,5,8001},{58812,193,6563},
+{58861,0,7864},{58862,57,6613},{58944,65,6628},{58961,0,7865},
+{58962,177,6646},{59008,21,6691},{59014,0,7866},{59015,381,6698},
+{59111,0,7868},{59112,81,6795},{59200,177,6816},{59245,0,7870},
+{59246,65,6862},{59264,153,6879},{59303,0,7873},{59304,73,6919},
+{59323,0,7874},{59324,257,6939},{59456,249,7004},{59520,313,7067},
+{59599,0,7879},{59600,177,7147},{59712,221,7192},{59768,0,8003},
+{59769,21,7249},{59776,169,7255},{59819,0,7882},{59820,53,7299},
+{59834,0,7883},{59835,65,7314},{59852,0,7884},{59853,189,7332},
+{59968,189,7380},{60016,6,93},{60018,49,7430},{60032,113,7443},
+{60061,0,7886},{60062,17,7473},{60067,5,8284},{60480,9,8005},
+{60486,14,95},{60493,41,8009},{60507,9,7601},{60510,6,99},
+{60512,9,8021},{60515,9,7604},{60518,37,8024},{60528,10,101},
+{60531,5,8035},{60534,0,8037},{60536,14,104},{60540,9,8039},
+{60544,26,108},{60551,5,8044},{60553,0,7599},{60554,25,8046},
+{60564,21,8053},{60570,6,115},{60574,0,8060},{60583,37,8061},
+{60594,77,8071},{60615,77,7555},{60635,0,8091},{60636,37,7575},
+{60649,77,8092},{60736,101,8112},{60772,0,7958},{60776,5,8138},
+{60778,0,7620},{60779,9,8140},{60782,0,7619},{60783,17,8143},
+{60788,0,7618},{60789,13,8148},{60796,9,8152},{60800,41,8155},
+{60815,61,8166},{61248,5,7887},{61250,6,117},{61252,37,7889},
+{61262,14,119},{61266,69,7899},{61284,85,7918},{61306,5,8264},
+{61325,13,736},{61329,13,8182},
+};
+
+static const unsigned short cmap_Add_RKSJ_H_table[123] = {
+7479,7481,7491,7495,7503,7499,7507,7523,7515,7531,7539,7480,
+7482,7494,7498,7506,7502,7514,7530,7522,7538,7554,7511,7526,
+7519,7534,7542,7508,7527,7516,7535,7545,1125,7633,7962,1206,
+7636,7963,1238,7639,7645,1321,7646,1407,7650,7665,1780,7666,
+1782,7969,7676,7689,2169,7690,7718,7972,2719,7733,2910,7734,
+2918,7735,7744,3045,7745,3099,7748,7976,7756,7769,7977,7772,
+3358,7773,7776,3395,7777,7801,3847,7802,4184,7982,7821,4434,
+7822,7985,7823,7986,5375,7993,7851,6089,7852,7885,8004,8008,
+768,762,761,8020,7607,771,8034,772,7588,7585,8038,7586,
+7590,8042,7592,7596,8043,7598,7595,7610,8059,8268,8274,8282,
+8275,8280,8277,
+};
+
+static pdf_cmap cmap_Add_RKSJ_H = {
+	-1, "Add-RKSJ-H", "", 0, 0, 4,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764}, },
+	546, 546, (pdf_range*) cmap_Add_RKSJ_H_ranges,
+	123, 123, (unsigned short*) cmap_Add_RKSJ_H_table,
+};
+
+/* Add-RKSJ-V */
+
+static const pdf_range cmap_Add_RKSJ_V_ranges[] = {
+{33089,5,7887},{33091,6,0},{33104,5,7889},{33115,9,7891},
+{33120,17,7894},{33125,14,2},{33129,69,7899},{33439,0,7918},
+{33441,0,7919},{33443,0,7920},{33445,0,7921},{33447,0,7922},
+{33473,0,7923},{33505,0,7924},{33507,0,7925},{33509,0,7926},
+{33516,0,7927},{33523,5,8264},{33600,0,7928},{33602,0,7929},
+{33604,0,7930},{33606,0,7931},{33608,0,7932},{33634,0,7933},
+{33667,0,7934},{33669,0,7935},{33671,0,7936},{33678,0,7937},
+{33685,5,7938},{60536,18,6},{60541,5,8339},{60544,42,11},
+{60555,5,8349},{60557,14,22},{60565,0,8324},{61330,0,8333},
+};
+
+static const unsigned short cmap_Add_RKSJ_V_table[26] = {
+8268,8274,8282,8275,8280,8277,7943,7940,8329,7941,8330,7945,
+8338,7947,7951,8348,7953,7950,8344,8347,7954,8343,8358,8357,
+8353,8356,
+};
+
+static pdf_cmap cmap_Add_RKSJ_V = {
+	-1, "Add-RKSJ-V", "Add-RKSJ-H", 0, 1, 0,
+	{ {0,0,0}, },
+	36, 36, (pdf_range*) cmap_Add_RKSJ_V_ranges,
+	26, 26, (unsigned short*) cmap_Add_RKSJ_V_table,
+};
+
+/* Add-V */
+
+static const pdf_range cmap_Add_V_ranges[] = {
+{8482,5,7887},{8484,6,0},{8497,5,7889},{8508,9,7891},
+{8513,17,7894},{8518,14,2},{8522,69,7899},{9249,0,7918},
+{9251,0,7919},{9253,0,7920},{9255,0,7921},{9257,0,7922},
+{9283,0,7923},{9315,0,7924},{9317,0,7925},{9319,0,7926},
+{9326,0,7927},{9333,5,8264},{9505,0,7928},{9507,0,7929},
+{9509,0,7930},{9511,0,7931},{9513,0,7932},{9539,0,7933},
+{9571,0,7934},{9573,0,7935},{9575,0,7936},{9582,0,7937},
+{9589,5,7938},{30553,18,6},{30558,5,8339},{30560,42,11},
+{30571,5,8349},{30573,14,22},{30581,0,8324},{32114,0,8333},
+};
+
+static const unsigned short cmap_Add_V_table[26] = {
+8268,8274,8282,8275,8280,8277,7943,7940,8329,7941,8330,7945,
+8338,7947,7951,8348,7953,7950,8344,8347,7954,8343,8358,8357,
+8353,8356,
+};
+
+static pdf_cmap cmap_Add_V = {
+	-1, "Add-V", "Add-H", 0, 1, 0,
+	{ {0,0,0}, },
+	36, 36, (pdf_range*) cmap_Add_V_ranges,
+	26, 26, (unsigned short*) cmap_Add_V_table,
+};
+
+/* Adobe-Japan1-0 */
+
+static const pdf_range cmap_Adobe_Japan1_0_ranges[] = {
+{0,33133,0},
+};
+
+static const unsigned short cmap_Adobe_Japan1_0_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Japan1_0 = {
+	-1, "Adobe-Japan1-0", "", 0, 0, 1,
+	{ {2,0,8447}, },
+	1, 1, (pdf_range*) cmap_Adobe_Japan1_0_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Japan1_0_table,
+};
+
+/* Adobe-Japan1-1 */
+
+static const pdf_range cmap_Adobe_Japan1_1_ranges[] = {
+{0,33433,0},
+};
+
+static const unsigned short cmap_Adobe_Japan1_1_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Japan1_1 = {
+	-1, "Adobe-Japan1-1", "", 0, 0, 1,
+	{ {2,0,8447}, },
+	1, 1, (pdf_range*) cmap_Adobe_Japan1_1_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Japan1_1_table,
+};
+
+/* Adobe-Japan1-2 */
+
+static const pdf_range cmap_Adobe_Japan1_2_ranges[] = {
+{0,34877,0},
+};
+
+static const unsigned short cmap_Adobe_Japan1_2_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Japan1_2 = {
+	-1, "Adobe-Japan1-2", "", 0, 0, 1,
+	{ {2,0,8959}, },
+	1, 1, (pdf_range*) cmap_Adobe_Japan1_2_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Japan1_2_table,
+};
+
+/* Adobe-Japan1-3 */
+
+static const pdf_range cmap_Adobe_Japan1_3_ranges[] = {
+{0,37413,0},
+};
+
+static const unsigned short cmap_Adobe_Japan1_3_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Japan1_3 = {
+	-1, "Adobe-Japan1-3", "", 0, 0, 1,
+	{ {2,0,9471}, },
+	1, 1, (pdf_range*) cmap_Adobe_Japan1_3_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Japan1_3_table,
+};
+
+/* Adobe-Japan1-4 */
+
+static const pdf_range cmap_Adobe_Japan1_4_ranges[] = {
+{0,61773,0},
+};
+
+static const unsigned short cmap_Adobe_Japan1_4_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Japan1_4 = {
+	-1, "Adobe-Japan1-4", "", 0, 0, 1,
+	{ {2,0,15615}, },
+	1, 1, (pdf_range*) cmap_Adobe_Japan1_4_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Japan1_4_table,
+};
+
+/* Adobe-Japan1-5 */
+
+static const pdf_range cmap_Adobe_Japan1_5_ranges[] = {
+{0,65533,0},{16384,15729,16384},
+};
+
+static const unsigned short cmap_Adobe_Japan1_5_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Japan1_5 = {
+	-1, "Adobe-Japan1-5", "", 0, 0, 1,
+	{ {2,0,20479}, },
+	2, 2, (pdf_range*) cmap_Adobe_Japan1_5_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Japan1_5_table,
+};
+
+/* Adobe-Japan1-6 */
+
+static const pdf_range cmap_Adobe_Japan1_6_ranges[] = {
+{0,65533,0},{16384,26693,16384},
+};
+
+static const unsigned short cmap_Adobe_Japan1_6_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Japan1_6 = {
+	-1, "Adobe-Japan1-6", "", 0, 0, 1,
+	{ {2,0,23295}, },
+	2, 2, (pdf_range*) cmap_Adobe_Japan1_6_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Japan1_6_table,
+};
+
+/* Adobe-Japan1-UCS2 */
+
+static const pdf_range cmap_Adobe_Japan1_UCS2_ranges[] = {
+{0,0,65533},{1,237,32},{61,0,165},{62,121,93},
+{93,30,4553},{101,9,161},{104,22,4561},{110,5,8249},
+{112,5,64257},{114,0,8210},{115,5,8224},{117,38,4567},
+{127,5,769},{129,0,175},{130,9,774},{133,86,4577},
+{155,13,176},{159,6,4599},{161,9,188},{164,21,192},
+{170,65,199},{187,21,217},{193,21,224},{199,65,231},
+{216,25,249},{223,30,4601},{231,237,32},{291,0,165},
+{292,129,93},{325,0,8254},{326,253,65376},{390,0,65344},
+{391,5,12528},{393,74,4609},{412,5,12496},{414,5,12499},
+{416,5,12502},{418,5,12505},{420,5,12508},{422,0,65376},
+{423,5,12317},{425,301,9472},{501,18,4628},{506,13,12296},
+{510,13,12302},{514,62,4633},{530,5,12362},{532,54,4649},
+{546,21,12394},{552,14,4663},{556,17,12414},{561,6,4667},
+{563,21,12424},{569,6,4669},{571,5,12432},{573,62,4671},
+{589,5,12400},{591,5,12403},{593,5,12406},{595,5,12409},
+{597,5,12412},{599,34,4687},{608,5,162},{610,90,4696},
+{633,9,12288},{636,10,4719},{639,5,65306},{641,6,4722},
+{643,5,12443},{645,22,4724},{651,5,12541},{653,5,12445},
+{655,6,4730},{657,9,12293},{660,38,4732},{670,5,8216},
+{672,5,8220},{674,5,65288},{676,5,12308},{678,14,4742},
+{682,37,12296},{692,34,4746},{701,5,8806},{703,18,4755},
+{708,5,8242},{710,10,4760},{713,5,162},{715,86,4763},
+{737,5,8592},{739,14,4785},{743,5,8838},{745,5,8834},
+{747,6,4789},{749,5,8743},{751,46,4791},{763,5,8810},
+{765,14,4803},{769,5,8747},{771,18,4807},{776,5,8224},
+{778,6,4812},{780,37,65296},{790,101,65313},{816,101,65345},
+{842,329,12353},{925,341,12449},{1011,65,913},{1028,25,931},
+{1035,65,945},{1052,25,963},{1059,21,1040},{1065,0,1025},
+{1066,125,1046},{1098,0,1105},{1099,101,1078},{1125,1358,4814},
+{1465,5,38989},{1467,878,5154},{1687,5,20139},{1689,7994,5374},
+{3688,5,24536},{3690,706,7373},{3867,5,29494},{3869,954,7550},
+{4108,9,20126},{4111,162,7789},{4152,5,20452},{4154,118,7830},
+{4184,5,20681},{4186,42,7860},{4197,5,20737},{4199,34,7871},
+{4208,5,20799},{4210,18,7880},{4215,5,20841},{4217,34,7885},
+{4226,5,20885},{4228,10,7894},{4231,9,20905},{4234,0,20915},
+{4235,5,20913},{4237,94,7897},{4261,5,21067},{4263,62,7921},
+{4279,5,21164},{4281,46,7937},{4293,5,21240},{4295,186,7949},
+{4342,5,21548},{4344,134,7996},{4378,5,21733},{4380,54,8030},
+{4394,5,21846},{4396,314,8044},{4475,5,22327},{4477,74,8123},
+{4496,5,22482},{4498,146,8142},{4535,9,22779},{4538,22,8179},
+{4544,5,22828},{4546,98,8185},{4571,5,23001},{4573,34,8210},
+{4582,5,23093},{4584,50,8219},{4597,5,23290},{4599,50,8232},
+{4612,5,23386},{4614,106,8245},{4641,5,23559},{4643,18,8272},
+{4648,5,23608},{4650,298,8277},{4725,5,24118},{4727,38,8352},
+{4737,5,24181},{4739,14,8362},{4743,5,24257},{4745,22,8366},
+{4751,5,24282},{4753,6,8372},{4755,5,24296},{4757,90,8374},
+{4780,5,24406},{4782,246,8397},{4844,5,24726},{4846,62,8459},
+{4862,5,24822},{4864,26,8475},{4871,5,24845},{4873,54,8482},
+{4887,9,24920},{4890,158,8496},{4930,5,25096},{4932,34,8536},
+{4941,5,25138},{4943,42,8545},{4954,5,25234},{4956,334,8556},
+{5040,5,25824},{5042,62,8640},{5058,5,25908},{5060,50,8656},
+{5073,5,25986},{5075,50,8669},{5088,5,26080},{5090,22,8682},
+{5096,5,26165},{5098,34,8688},{5107,5,26215},{5109,114,8697},
+{5138,5,26406},{5140,42,8726},{5151,5,26467},{5153,626,8737},
+{5310,5,27298},{5312,142,8894},{5348,5,27512},{5350,5,27519},
+{5352,26,8930},{5359,5,27562},{5361,62,8937},{5377,5,27667},
+{5379,410,8953},{5482,5,28372},{5484,478,9056},{5604,5,29243},
+{5606,5,29247},{5608,78,9176},{5628,5,29408},{5630,50,9196},
+{5643,5,29518},{5645,194,9209},{5694,5,29936},{5696,110,9258},
+{5724,5,30086},{5726,90,9286},{5749,5,30206},{5751,14,9309},
+{5755,5,30194},{5757,18,9313},{5762,9,30240},{5765,14,9318},
+{5769,5,30279},{5771,10,9322},{5774,5,30305},{5776,9,30312},
+{5779,54,9325},{5793,5,30361},{5795,6,9339},{5797,9,30392},
+{5800,66,9341},{5817,5,30501},{5819,0,30491},{5820,5,30519},
+{5822,70,9358},{5840,5,30652},{5842,238,9376},{5902,5,31161},
+{5904,30,9436},{5912,5,31256},{5914,38,9444},{5924,5,31329},
+{5926,94,9454},{5950,5,31449},{5952,0,31453},{5953,5,31457},
+{5955,30,9478},{5963,5,31512},{5965,58,9486},{5980,5,31600},
+{5982,602,9501},{6133,5,32345},{6135,38,9652},{6145,5,32392},
+{6147,10,9662},{6150,5,32403},{6152,6,9665},{6154,5,32411},
+{6156,10,9667},{6159,9,32588},{6162,5,32592},{6164,10,9670},
+{6167,5,32607},{6169,5,32616},{6171,78,9673},{6191,5,32709},
+{6193,50,9693},{6206,5,32792},{6208,206,9706},{6260,5,33125},
+{6262,110,9758},{6290,5,33247},{6292,0,33255},{6293,5,33274},
+{6295,0,33278},{6296,5,33281},{6298,74,9786},{6317,5,33386},
+{6319,6,9805},{6321,5,33399},{6323,134,9807},{6357,5,33559},
+{6359,278,9841},{6429,5,34071},{6431,222,9911},{6487,5,34473},
+{6489,5,34443},{6491,270,9967},{6559,5,34806},{6561,146,10035},
+{6598,5,35011},{6600,0,35028},{6601,5,35032},{6603,54,10072},
+{6617,5,35114},{6619,118,10086},{6649,5,35263},{6651,0,35290},
+{6652,5,35292},{6654,102,10116},{6680,5,35493},{6682,190,10142},
+{6730,5,35730},{6732,0,35734},{6733,5,35737},{6735,62,10190},
+{6751,5,35981},{6753,26,10206},{6760,5,36018},{6762,30,10213},
+{6770,5,36090},{6772,5,36100},{6774,98,10221},{6799,5,36330},
+{6801,10,10246},{6804,5,36360},{6806,0,36351},{6807,5,36381},
+{6809,278,10249},{6879,9,36706},{6882,54,10319},{6896,5,36857},
+{6898,46,10333},{6910,13,36943},{6914,194,10345},{6963,5,37312},
+{6965,30,10394},{6973,5,37365},{6975,166,10402},{7017,5,37804},
+{7019,6,10444},{7021,5,37846},{7023,166,10446},{7065,5,38296},
+{7067,86,10488},{7089,5,38446},{7091,70,10510},{7109,5,38577},
+{7111,10,10528},{7114,5,38584},{7116,86,10531},{7138,5,38717},
+{7140,78,10553},{7160,5,38799},{7162,14,10573},{7166,5,38835},
+{7168,86,10577},{7190,9,39023},{7193,66,10599},{7210,5,39197},
+{7212,14,10616},{7216,5,39229},{7218,18,10620},{7223,5,39249},
+{7225,6,10625},{7227,5,39319},{7229,0,39333},{7230,5,39341},
+{7232,22,10627},{7238,5,39405},{7240,5,39409},{7242,122,10633},
+{7273,5,39635},{7275,5,39646},{7277,5,39650},{7279,46,10664},
+{7291,5,39714},{7293,0,39717},{7294,13,39719},{7298,5,39726},
+{7300,14,10676},{7304,5,39757},{7306,22,10680},{7312,5,39830},
+{7314,5,39839},{7316,26,10686},{7323,5,39889},{7325,218,10693},
+{7380,5,40285},{7382,114,10748},{7411,5,40474},{7413,22,10777},
+{7419,5,40587},{7421,42,10783},{7432,9,40654},{7435,34,10794},
+{7444,5,40694},{7446,0,40697},{7447,9,40699},{7450,5,40711},
+{7452,34,10803},{7461,9,40799},{7464,5,40806},{7466,50,10812},
+{7479,301,9472},{7555,77,9312},{7575,37,8544},{7585,62,10825},
+{7601,9,13212},{7604,5,13198},{7606,26,10841},{7613,17,12964},
+{7618,5,12849},{7620,42,10848},{7631,5,8745},{7633,30,10859},
+{7642,90,10867},{7666,14,10890},{7671,6,10894},{7674,82,10896},
+{7696,150,10917},{7735,74,10955},{7755,214,10974},{7809,5,63890},
+{7811,10,11028},{7815,0,20873},{7818,26,11031},{7826,46,11038},
+{7840,186,11050},{7887,5,12289},{7889,38,11097},{7899,5,65288},
+{7901,5,12308},{7903,5,65095},{7905,6,11107},{7907,37,12296},
+{7917,82,11109},{7938,5,12533},{7940,62,11130},{7956,5,12317},
+{7958,9,12436},{7961,242,11146},{8022,5,13220},{8024,26,11207},
+{8031,9,13189},{8034,106,11214},{8061,3,0},{8062,33,9352},
+{8071,77,9332},{8091,0,12881},{8092,37,8560},{8102,37,12882},
+{8112,101,9372},{8138,142,11241},{8174,9,9131},{8177,0,65080},
+{8178,9,9127},{8181,30,11277},{8189,3,3},{8190,3,7},
+{8191,0,12958},{8192,5,13192},{8194,14,11285},{8198,21,12842},
+{8204,10,11289},{8207,9,11013},{8210,18,11292},{8215,13,9728},
+{8219,0,9758},{8220,5,9756},{8222,10,11297},{8225,5,8554},
+{8227,10,11300},{8230,29,9601},{8238,26,11303},{8245,5,9620},
+{8247,5,9581},{8249,22,11310},{8255,5,9698},{8257,14,11316},
+{8261,9,9585},{8264,5,12437},{8266,34,11320},{8275,5,8216},
+{8277,5,8220},{8279,26,11329},{8286,33,10102},{8295,3,11},
+{8296,3,16},{8297,3,20},{8298,5,8570},{8300,3,23},
+{8301,3,28},{8302,3,32},{8303,10,11336},{8306,3,35},
+{8307,10,11339},{8310,5,8644},{8312,3,38},{8313,13,12535},
+{8317,14,11342},{8321,3,41},{8322,3,46},{8323,6,11346},
+{8325,3,51},{8326,3,56},{8327,474,11348},{8446,5,23992},
+{8448,366,11467},{8540,5,28998},{8543,142,11559},{8579,9,64024},
+{8582,118,11595},{8612,5,64032},{8614,70,11625},{8632,5,64036},
+{8634,30,11643},{8642,5,37357},{8644,5,37348},{8646,46,11651},
+{8658,5,37495},{8660,154,11663},{8699,5,64042},{8701,74,11702},
+{8720,237,32},{8780,0,165},{8781,121,93},{8812,30,11721},
+{8820,9,161},{8823,22,11729},{8829,5,8249},{8831,5,64257},
+{8833,0,8210},{8834,5,8224},{8836,38,11735},{8846,5,769},
+{8848,0,175},{8849,9,774},{8852,86,11745},{8874,13,176},
+{8878,6,11767},{8880,9,188},{8883,21,192},{8889,65,199},
+{8906,21,217},{8912,21,224},{8918,65,231},{8935,25,249},
+{8942,34,11769},{8951,233,33},{9010,0,165},{9011,129,93},
+{9044,54,11778},{9058,5,162},{9060,94,11792},{9084,253,65376},
+{9148,5,12528},{9150,74,11816},{9169,5,12496},{9171,5,12499},
+{9173,5,12502},{9175,5,12505},{9177,5,12508},{9179,58,11835},
+{9194,5,12362},{9196,54,11850},{9210,21,12394},{9216,14,11864},
+{9220,17,12414},{9225,6,11868},{9227,21,12424},{9233,6,11870},
+{9235,5,12432},{9237,62,11872},{9253,5,12400},{9255,5,12403},
+{9257,5,12406},{9259,5,12409},{9261,5,12412},{9263,5,12317},
+{9265,6,11888},{9267,13,12296},{9271,13,12302},{9275,6,11890},
+{9277,301,9472},{9353,10,11892},{9356,5,8242},{9358,0,64256},
+{9359,5,64259},{9361,38,11895},{9371,13,8539},{9375,5,8531},
+{9377,0,8304},{9378,21,8308},{9384,37,8320},{9394,6,11905},
+{9396,3,61},{9397,6,11907},{9399,3,64},{9400,6,11909},
+{9402,3,67},{9403,18,11911},{9408,3,70},{9409,6,11916},
+{9411,3,73},{9412,6,11918},{9414,3,76},{9415,50,11920},
+{9428,5,601},{9430,0,602},{9431,5,602},{9433,42,11933},
+{9444,237,32},{9504,0,165},{9505,121,93},{9536,30,11944},
+{9544,9,161},{9547,22,11952},{9553,5,8249},{9555,5,64257},
+{9557,0,8210},{9558,5,8224},{9560,38,11958},{9570,5,769},
+{9572,0,175},{9573,9,774},{9576,86,11968},{9598,13,176},
+{9602,6,11990},{9604,9,188},{9607,21,192},{9613,65,199},
+{9630,21,217},{9636,21,224},{9642,65,231},{9659,25,249},
+{9666,38,11992},{9676,5,8242},{9678,0,64256},{9679,5,64259},
+{9681,38,12002},{9691,13,8539},{9695,5,8531},{9697,0,8304},
+{9698,21,8308},{9704,37,8320},{9714,6,12012},{9716,3,79},
+{9717,6,12014},{9719,3,82},{9720,6,12016},{9722,3,85},
+{9723,18,12018},{9728,3,88},{9729,6,12023},{9731,3,91},
+{9732,6,12025},{9734,3,94},{9735,10,12027},{9738,37,48},
+{9748,14,12030},{9752,5,40},{9754,5,46},{9756,5,58},
+{9758,37,48},{9768,14,12034},{9772,5,40},{9774,5,46},
+{9776,5,58},{9778,6,12038},{9780,3,97},{9781,5,8531},
+{9783,0,190},{9784,21,8533},{9790,3,101},{9791,3,105},
+{9792,3,109},{9793,3,113},{9794,3,117},{9795,3,121},
+{9796,13,8539},{9800,3,125},{9801,3,129},{9802,3,133},
+{9803,3,137},{9804,3,141},{9805,3,145},{9806,3,149},
+{9807,3,154},{9808,3,159},{9809,3,164},{9810,3,169},
+{9811,3,174},{9812,3,179},{9813,3,184},{9814,3,189},
+{9815,3,194},{9816,3,199},{9817,3,204},{9818,3,209},
+{9819,3,214},{9820,3,220},{9821,3,225},{9822,3,230},
+{9823,3,235},{9824,3,241},{9825,3,247},{9826,3,251},
+{9827,3,255},{9828,3,259},{9829,3,263},{9830,3,267},
+{9831,3,271},{9832,3,275},{9833,3,279},{9834,3,283},
+{9835,3,287},{9836,3,291},{9837,3,295},{9838,3,299},
+{9839,3,303},{9840,3,307},{9841,3,311},{9842,3,315},
+{9843,3,319},{9844,3,323},{9845,3,327},{9846,3,331},
+{9847,3,335},{9848,3,339},{9849,3,343},{9850,3,347},
+{9851,3,351},{9852,3,355},{9853,3,359},{9854,3,364},
+{9855,3,369},{9856,3,374},{9857,3,379},{9858,3,384},
+{9859,3,389},{9860,3,394},{9861,3,399},{9862,3,404},
+{9863,3,409},{9864,3,414},{9865,3,419},{9866,3,424},
+{9867,3,430},{9868,3,435},{9869,3,440},{9870,3,445},
+{9871,3,451},{9872,37,48},{9882,6,12040},{9884,3,457},
+{9885,3,460},{9886,3,463},{9887,3,466},{9888,3,469},
+{9889,3,472},{9890,3,475},{9891,3,478},{9892,3,481},
+{9893,3,484},{9894,3,487},{9895,3,490},{9896,3,493},
+{9897,3,496},{9898,3,499},{9899,3,502},{9900,3,505},
+{9901,3,508},{9902,3,511},{9903,3,514},{9904,3,517},
+{9905,3,520},{9906,3,523},{9907,3,526},{9908,3,529},
+{9909,3,532},{9910,3,535},{9911,3,538},{9912,3,541},
+{9913,3,544},{9914,3,547},{9915,3,550},{9916,3,553},
+{9917,3,556},{9918,3,559},{9919,3,562},{9920,3,565},
+{9921,3,568},{9922,3,571},{9923,3,574},{9924,3,577},
+{9925,3,580},{9926,3,583},{9927,3,586},{9928,3,589},
+{9929,3,592},{9930,3,595},{9931,3,598},{9932,3,601},
+{9933,3,604},{9934,3,607},{9935,3,610},{9936,3,613},
+{9937,3,616},{9938,3,619},{9939,3,622},{9940,3,625},
+{9941,3,628},{9942,3,631},{9943,3,634},{9944,3,637},
+{9945,3,640},{9946,3,643},{9947,3,646},{9948,3,649},
+{9949,3,652},{9950,3,655},{9951,3,658},{9952,3,661},
+{9953,3,664},{9954,3,667},{9955,3,670},{9956,3,673},
+{9957,3,676},{9958,3,679},{9959,3,682},{9960,3,685},
+{9961,3,688},{9962,3,691},{9963,3,694},{9964,3,697},
+{9965,3,700},{9966,3,703},{9967,3,706},{9968,3,709},
+{9969,3,712},{9970,3,715},{9971,3,718},{9972,3,721},
+{9973,3,724},{9974,45,8560},{9986,3,728},{9987,3,733},
+{9988,3,737},{9989,45,8544},{10001,3,740},{10002,3,745},
+{10003,3,749},{10004,101,65},{10030,14,12042},{10034,5,12362},
+{10036,54,12046},{10050,21,12394},{10056,14,12060},{10060,17,12414},
+{10065,6,12064},{10067,21,12424},{10073,17,12431},{10078,14,12066},
+{10082,5,12458},{10084,54,12070},{10098,21,12490},{10104,14,12084},
+{10108,17,12510},{10113,6,12088},{10115,21,12520},{10121,17,12527},
+{10126,37,12832},{10136,3,752},{10137,3,755},{10138,3,758},
+{10139,3,761},{10140,3,764},{10141,3,767},{10142,3,770},
+{10143,3,773},{10144,3,776},{10145,3,779},{10146,22,12090},
+{10152,37,48},{10162,37,48},{10172,242,12096},{10233,3,782},
+{10234,3,785},{10235,33,9312},{10244,3,788},{10245,3,791},
+{10246,3,794},{10247,3,797},{10248,3,800},{10249,3,803},
+{10250,3,806},{10251,3,809},{10252,3,812},{10253,3,815},
+{10254,3,818},{10255,3,821},{10256,3,824},{10257,3,827},
+{10258,3,830},{10259,3,833},{10260,3,836},{10261,3,839},
+{10262,3,842},{10263,3,845},{10264,3,848},{10265,3,851},
+{10266,3,854},{10267,3,857},{10268,3,860},{10269,3,863},
+{10270,3,866},{10271,3,869},{10272,3,872},{10273,3,875},
+{10274,3,878},{10275,3,881},{10276,3,884},{10277,3,887},
+{10278,3,890},{10279,3,893},{10280,3,896},{10281,3,899},
+{10282,3,902},{10283,3,905},{10284,3,908},{10285,3,911},
+{10286,3,914},{10287,3,917},{10288,3,920},{10289,3,923},
+{10290,3,926},{10291,3,929},{10292,3,932},{10293,3,935},
+{10294,3,938},{10295,3,941},{10296,3,944},{10297,3,947},
+{10298,3,950},{10299,3,953},{10300,3,956},{10301,3,959},
+{10302,3,962},{10303,3,965},{10304,3,968},{10305,3,971},
+{10306,3,974},{10307,3,977},{10308,3,980},{10309,3,983},
+{10310,3,986},{10311,3,989},{10312,3,992},{10313,101,9424},
+{10339,101,9398},{10365,14,12157},{10369,5,12362},{10371,54,12161},
+{10385,21,12394},{10391,14,12175},{10395,17,12414},{10400,6,12179},
+{10402,21,12424},{10408,17,12431},{10413,185,13008},{10460,0,12531},
+{10461,37,12928},{10471,0,12944},{10472,21,12938},{10478,30,12181},
+{10486,5,12960},{10488,62,12189},{10504,3,996},{10505,3,999},
+{10506,3,1002},{10507,3,1005},{10508,3,1008},{10509,3,1011},
+{10510,3,1014},{10511,3,1017},{10512,3,1020},{10513,3,1023},
+{10514,3,1026},{10515,3,1029},{10516,3,1032},{10517,3,1035},
+{10518,3,1038},{10519,3,1041},{10520,3,1044},{10521,3,1047},
+{10522,3,1050},{10523,3,1053},{10524,3,1056},{10525,3,1059},
+{10526,3,1062},{10527,3,1065},{10528,3,1068},{10529,3,1071},
+{10530,3,1074},{10531,3,1077},{10532,3,1080},{10533,3,1083},
+{10534,3,1086},{10535,3,1089},{10536,3,1092},{10537,3,1095},
+{10538,3,1098},{10539,3,1101},{10540,3,1104},{10541,3,1107},
+{10542,3,1110},{10543,3,1113},{10544,3,1116},{10545,3,1119},
+{10546,3,1122},{10547,3,1125},{10548,3,1128},{10549,3,1131},
+{10550,3,1134},{10551,3,1137},{10552,3,1140},{10553,3,1143},
+{10554,3,1146},{10555,3,1149},{10556,3,1152},{10557,3,1155},
+{10558,3,1158},{10559,3,1161},{10560,3,1164},{10561,3,1167},
+{10562,3,1170},{10563,3,1173},{10564,3,1176},{10565,3,1179},
+{10566,3,1182},{10567,3,1185},{10568,3,1188},{10569,3,1191},
+{10570,3,1194},{10571,3,1197},{10572,3,1200},{10573,3,1203},
+{10574,3,1206},{10575,3,1209},{10576,3,1212},{10577,3,1215},
+{10578,3,1218},{10579,3,1221},{10580,3,1224},{10581,3,1227},
+{10582,3,1230},{10583,3,1233},{10584,3,1236},{10585,3,1239},
+{10586,3,1242},{10587,3,1245},{10588,3,1248},{10589,3,1251},
+{10590,3,1254},{10591,3,1257},{10592,3,1260},{10593,3,1263},
+{10594,3,1266},{10595,3,1269},{10596,3,1272},{10597,3,1275},
+{10598,3,1278},{10599,3,1281},{10600,3,1284},{10601,3,1287},
+{10602,3,1290},{10603,3,1293},{10604,3,1296},{10605,101,97},
+{10631,101,65},{10657,14,12205},{10661,5,12362},{10663,54,12209},
+{10677,21,12394},{10683,14,12223},{10687,17,12414},{10692,6,12227},
+{10694,21,12424},{10700,17,12431},{10705,14,12229},{10709,5,12458},
+{10711,54,12233},{10725,21,12490},{10731,14,12247},{10735,17,12510},
+{10740,6,12251},{10742,21,12520},{10748,17,12527},{10753,46,12253},
+{10765,3,1300},{10766,0,49},{10767,3,1303},{10768,0,50},
+{10769,3,1306},{10770,0,51},{10771,3,1309},{10772,0,52},
+{10773,3,1312},{10774,0,53},{10775,3,1315},{10776,0,54},
+{10777,3,1318},{10778,0,55},{10779,3,1321},{10780,0,56},
+{10781,3,1324},{10782,0,57},{10783,3,1327},{10784,3,1330},
+{10785,3,1333},{10786,3,1336},{10787,3,1339},{10788,3,1342},
+{10789,3,1345},{10790,3,1348},{10791,3,1351},{10792,3,1354},
+{10793,3,1357},{10794,3,1360},{10795,3,1363},{10796,3,1366},
+{10797,3,1369},{10798,3,1372},{10799,3,1375},{10800,3,1378},
+{10801,3,1381},{10802,3,1384},{10803,3,1387},{10804,3,1390},
+{10805,3,1393},{10806,3,1396},{10807,3,1399},{10808,3,1402},
+{10809,3,1405},{10810,3,1408},{10811,3,1411},{10812,3,1414},
+{10813,3,1417},{10814,3,1420},{10815,3,1423},{10816,3,1426},
+{10817,3,1429},{10818,3,1432},{10819,3,1435},{10820,3,1438},
+{10821,3,1441},{10822,3,1444},{10823,3,1447},{10824,3,1450},
+{10825,3,1453},{10826,3,1456},{10827,3,1459},{10828,3,1462},
+{10829,3,1465},{10830,3,1468},{10831,3,1471},{10832,3,1474},
+{10833,3,1477},{10834,3,1480},{10835,3,1483},{10836,3,1486},
+{10837,3,1489},{10838,3,1492},{10839,3,1495},{10840,3,1498},
+{10841,3,1501},{10842,3,1504},{10843,3,1507},{10844,3,1510},
+{10845,3,1513},{10846,3,1516},{10847,3,1519},{10848,3,1522},
+{10849,3,1525},{10850,3,1528},{10851,3,1531},{10852,3,1534},
+{10853,3,1537},{10854,3,1540},{10855,3,1543},{10856,3,1546},
+{10857,3,1549},{10858,3,1552},{10859,3,1555},{10860,3,1558},
+{10861,3,1561},{10862,3,1564},{10863,3,1567},{10864,3,1570},
+{10865,3,1573},{10866,3,1576},{10867,3,1579},{10868,3,1582},
+{10869,3,1585},{10870,3,1588},{10871,3,1591},{10872,3,1594},
+{10873,3,1597},{10874,3,1600},{10875,101,97},{10901,101,65},
+{10927,14,12265},{10931,5,12362},{10933,54,12269},{10947,21,12394},
+{10953,14,12283},{10957,17,12414},{10962,6,12287},{10964,21,12424},
+{10970,17,12431},{10975,14,12289},{10979,5,12458},{10981,54,12293},
+{10995,21,12490},{11001,14,12307},{11005,17,12510},{11010,6,12311},
+{11012,21,12520},{11018,17,12527},{11023,58,12313},{11038,3,1604},
+{11039,0,49},{11040,3,1607},{11041,0,50},{11042,3,1610},
+{11043,0,51},{11044,3,1613},{11045,0,52},{11046,3,1616},
+{11047,0,53},{11048,3,1619},{11049,0,54},{11050,3,1622},
+{11051,0,55},{11052,3,1625},{11053,0,56},{11054,3,1628},
+{11055,0,57},{11056,3,1631},{11057,3,1634},{11058,3,1637},
+{11059,3,1640},{11060,3,1643},{11061,3,1646},{11062,3,1649},
+{11063,3,1652},{11064,3,1655},{11065,3,1658},{11066,3,1661},
+{11067,3,1664},{11068,3,1667},{11069,3,1670},{11070,3,1673},
+{11071,3,1676},{11072,3,1679},{11073,3,1682},{11074,3,1685},
+{11075,3,1688},{11076,3,1691},{11077,3,1694},{11078,3,1697},
+{11079,3,1700},{11080,3,1703},{11081,3,1706},{11082,3,1709},
+{11083,3,1712},{11084,3,1715},{11085,3,1718},{11086,3,1721},
+{11087,3,1724},{11088,3,1727},{11089,3,1730},{11090,3,1733},
+{11091,3,1736},{11092,3,1739},{11093,3,1742},{11094,3,1745},
+{11095,3,1748},{11096,3,1751},{11097,3,1754},{11098,3,1757},
+{11099,3,1760},{11100,3,1763},{11101,3,1766},{11102,3,1769},
+{11103,3,1772},{11104,3,1775},{11105,3,1778},{11106,3,1781},
+{11107,3,1784},{11108,3,1787},{11109,3,1790},{11110,3,1793},
+{11111,3,1796},{11112,3,1799},{11113,3,1802},{11114,3,1805},
+{11115,3,1808},{11116,3,1811},{11117,3,1814},{11118,3,1817},
+{11119,3,1820},{11120,3,1823},{11121,3,1826},{11122,3,1829},
+{11123,3,1832},{11124,3,1835},{11125,3,1838},{11126,3,1841},
+{11127,3,1844},{11128,3,1847},{11129,3,1850},{11130,3,1853},
+{11131,3,1856},{11132,3,1859},{11133,3,1862},{11134,3,1865},
+{11135,3,1868},{11136,3,1871},{11137,3,1874},{11138,3,1877},
+{11139,3,1880},{11140,3,1883},{11141,3,1886},{11142,3,1889},
+{11143,3,1892},{11144,3,1895},{11145,3,1898},{11146,3,1901},
+{11147,3,1904},{11148,101,97},{11174,101,65},{11200,14,12328},
+{11204,5,12362},{11206,54,12332},{11220,21,12394},{11226,14,12346},
+{11230,17,12414},{11235,6,12350},{11237,21,12424},{11243,17,12431},
+{11248,14,12352},{11252,5,12458},{11254,54,12356},{11268,21,12490},
+{11274,14,12370},{11278,17,12510},{11283,6,12374},{11285,21,12520},
+{11291,17,12527},{11296,46,12376},{11308,3,1908},{11309,0,49},
+{11310,3,1911},{11311,0,50},{11312,3,1914},{11313,0,51},
+{11314,3,1917},{11315,0,52},{11316,3,1920},{11317,0,53},
+{11318,3,1923},{11319,0,54},{11320,3,1926},{11321,0,55},
+{11322,3,1929},{11323,0,56},{11324,3,1932},{11325,0,57},
+{11326,3,1935},{11327,3,1938},{11328,3,1941},{11329,3,1944},
+{11330,3,1947},{11331,3,1950},{11332,3,1953},{11333,3,1956},
+{11334,3,1959},{11335,3,1962},{11336,3,1965},{11337,3,1968},
+{11338,3,1971},{11339,3,1974},{11340,3,1977},{11341,3,1980},
+{11342,3,1983},{11343,3,1986},{11344,3,1989},{11345,3,1992},
+{11346,3,1995},{11347,3,1998},{11348,3,2001},{11349,3,2004},
+{11350,3,2007},{11351,3,2010},{11352,3,2013},{11353,3,2016},
+{11354,3,2019},{11355,3,2022},{11356,3,2025},{11357,3,2028},
+{11358,3,2031},{11359,3,2034},{11360,3,2037},{11361,3,2040},
+{11362,3,2043},{11363,3,2046},{11364,3,2049},{11365,3,2052},
+{11366,3,2055},{11367,3,2058},{11368,3,2061},{11369,3,2064},
+{11370,3,2067},{11371,3,2070},{11372,3,2073},{11373,3,2076},
+{11374,3,2079},{11375,3,2082},{11376,3,2085},{11377,3,2088},
+{11378,3,2091},{11379,3,2094},{11380,3,2097},{11381,3,2100},
+{11382,3,2103},{11383,3,2106},{11384,3,2109},{11385,3,2112},
+{11386,3,2115},{11387,3,2118},{11388,3,2121},{11389,3,2124},
+{11390,3,2127},{11391,3,2130},{11392,3,2133},{11393,3,2136},
+{11394,3,2139},{11395,3,2142},{11396,3,2145},{11397,3,2148},
+{11398,3,2151},{11399,3,2154},{11400,3,2157},{11401,3,2160},
+{11402,3,2163},{11403,3,2166},{11404,3,2169},{11405,3,2172},
+{11406,3,2175},{11407,3,2178},{11408,3,2181},{11409,3,2184},
+{11410,3,2187},{11411,3,2190},{11412,3,2193},{11413,3,2196},
+{11414,3,2199},{11415,3,2202},{11416,3,2205},{11417,3,2208},
+{11418,101,97},{11444,101,65},{11470,14,12388},{11474,5,12362},
+{11476,54,12392},{11490,21,12394},{11496,14,12406},{11500,17,12414},
+{11505,6,12410},{11507,21,12424},{11513,17,12431},{11518,14,12412},
+{11522,5,12458},{11524,54,12416},{11538,21,12490},{11544,14,12430},
+{11548,17,12510},{11553,6,12434},{11555,21,12520},{11561,17,12527},
+{11566,42,12436},{11577,3,2212},{11578,0,49},{11579,3,2215},
+{11580,0,50},{11581,3,2218},{11582,0,51},{11583,3,2221},
+{11584,0,52},{11585,3,2224},{11586,0,53},{11587,3,2227},
+{11588,0,54},{11589,3,2230},{11590,0,55},{11591,3,2233},
+{11592,0,56},{11593,3,2236},{11594,0,57},{11595,3,2239},
+{11596,3,2242},{11597,3,2245},{11598,3,2248},{11599,3,2251},
+{11600,3,2254},{11601,3,2257},{11602,3,2260},{11603,3,2263},
+{11604,3,2266},{11605,3,2269},{11606,3,2272},{11607,3,2275},
+{11608,3,2278},{11609,3,2281},{11610,3,2284},{11611,3,2287},
+{11612,3,2290},{11613,3,2293},{11614,3,2296},{11615,3,2299},
+{11616,3,2302},{11617,3,2305},{11618,3,2308},{11619,3,2311},
+{11620,3,2314},{11621,3,2317},{11622,3,2320},{11623,3,2323},
+{11624,3,2326},{11625,3,2329},{11626,3,2332},{11627,3,2335},
+{11628,3,2338},{11629,3,2341},{11630,3,2344},{11631,3,2347},
+{11632,3,2350},{11633,3,2353},{11634,3,2356},{11635,3,2359},
+{11636,3,2362},{11637,3,2365},{11638,3,2368},{11639,3,2371},
+{11640,3,2374},{11641,3,2377},{11642,3,2380},{11643,3,2383},
+{11644,3,2386},{11645,3,2389},{11646,3,2392},{11647,3,2395},
+{11648,3,2398},{11649,3,2401},{11650,3,2404},{11651,3,2407},
+{11652,3,2410},{11653,3,2413},{11654,3,2416},{11655,3,2419},
+{11656,3,2422},{11657,3,2425},{11658,3,2428},{11659,3,2431},
+{11660,3,2434},{11661,3,2437},{11662,3,2440},{11663,3,2443},
+{11664,3,2446},{11665,3,2449},{11666,3,2452},{11667,3,2455},
+{11668,3,2458},{11669,3,2461},{11670,3,2464},{11671,3,2467},
+{11672,3,2470},{11673,3,2473},{11674,3,2476},{11675,3,2479},
+{11676,3,2482},{11677,3,2485},{11678,3,2488},{11679,3,2491},
+{11680,3,2494},{11681,3,2497},{11682,3,2500},{11683,3,2503},
+{11684,3,2506},{11685,3,2509},{11686,3,2512},{11687,101,97},
+{11713,101,65},{11739,14,12447},{11743,5,12362},{11745,54,12451},
+{11759,21,12394},{11765,14,12465},{11769,17,12414},{11774,6,12469},
+{11776,21,12424},{11782,17,12431},{11787,14,12471},{11791,5,12458},
+{11793,54,12475},{11807,21,12490},{11813,14,12489},{11817,17,12510},
+{11822,6,12493},{11824,21,12520},{11830,17,12527},{11835,54,12495},
+{11849,3,2516},{11850,6,12509},{11852,5,8481},{11854,3,2519},
+{11855,6,12511},{11857,3,2522},{11858,34,12513},{11867,3,2526},
+{11868,3,2530},{11869,5,13271},{11871,3,2534},{11872,3,2537},
+{11873,3,2540},{11874,5,13057},{11876,6,12522},{11878,3,2543},
+{11879,0,13064},{11880,3,2547},{11881,6,12524},{11883,3,2551},
+{11884,0,13065},{11885,3,2560},{11886,0,13067},{11887,3,2565},
+{11888,0,13068},{11889,21,13070},{11895,3,2569},{11896,0,13079},
+{11897,3,2576},{11898,0,13081},{11899,3,2581},{11900,13,13082},
+{11904,9,13087},{11907,0,13092},{11908,3,2587},{11909,0,13093},
+{11910,3,2590},{11911,3,2593},{11912,5,13096},{11914,3,2598},
+{11915,0,13101},{11916,3,2602},{11917,3,2607},{11918,9,13102},
+{11921,0,13106},{11922,3,2611},{11923,3,2616},{11924,5,13108},
+{11926,0,13116},{11927,3,2621},{11928,3,2625},{11929,3,2633},
+{11930,0,13111},{11931,3,2637},{11932,14,12526},{11936,9,13118},
+{11939,13,13123},{11943,0,13128},{11944,5,13131},{11946,5,13135},
+{11948,3,2640},{11949,3,2644},{11950,6,12530},{11952,3,2647},
+{11953,3,2651},{11954,0,13139},{11955,5,13141},{11957,3,2655},
+{11958,5,13057},{11960,6,12532},{11962,3,2658},{11963,0,13064},
+{11964,3,2662},{11965,6,12534},{11967,3,2666},{11968,0,13065},
+{11969,3,2675},{11970,0,13067},{11971,3,2680},{11972,0,13068},
+{11973,21,13070},{11979,3,2684},{11980,0,13079},{11981,3,2691},
+{11982,0,13081},{11983,3,2696},{11984,13,13082},{11988,9,13087},
+{11991,0,13092},{11992,3,2702},{11993,0,13093},{11994,3,2705},
+{11995,3,2708},{11996,5,13096},{11998,3,2713},{11999,0,13101},
+{12000,3,2717},{12001,3,2722},{12002,9,13102},{12005,0,13106},
+{12006,3,2726},{12007,3,2731},{12008,5,13108},{12010,0,13116},
+{12011,3,2736},{12012,3,2740},{12013,3,2748},{12014,0,13111},
+{12015,3,2752},{12016,14,12536},{12020,9,13118},{12023,13,13123},
+{12027,0,13128},{12028,5,13131},{12030,5,13135},{12032,3,2755},
+{12033,3,2759},{12034,6,12540},{12036,3,2762},{12037,3,2766},
+{12038,0,13139},{12039,5,13141},{12041,14,12542},{12045,3,2770},
+{12046,3,2775},{12047,3,2780},{12048,3,2785},{12049,3,2790},
+{12050,3,2795},{12051,3,2800},{12052,3,2805},{12053,3,2810},
+{12054,3,2815},{12055,3,2820},{12056,3,2825},{12057,3,2830},
+{12058,3,2835},{12059,3,2840},{12060,3,2845},{12061,3,2850},
+{12062,3,2855},{12063,26,12546},{12070,13,12300},{12074,5,12314},
+{12076,5,12312},{12078,5,65288},{12080,5,12317},{12082,5,8216},
+{12084,5,8220},{12086,6,12553},{12088,3,2860},{12089,30,12555},
+{12097,3,2864},{12098,5,9832},{12100,30,12563},{12108,9,12339},
+{12111,22,12571},{12117,3,2867},{12118,10,12577},{12121,5,8818},
+{12123,13,12300},{12127,5,12314},{12129,5,12312},{12131,5,65375},
+{12133,13,12300},{12137,5,12314},{12139,5,12312},{12141,5,65375},
+{12143,0,9115},{12144,5,9117},{12146,22,12580},{12152,5,9123},
+{12154,22,12586},{12160,5,9123},{12162,26,12592},{12169,5,12317},
+{12171,5,8216},{12173,5,8216},{12175,106,12599},{12202,5,8600},
+{12204,5,8598},{12206,6,12626},{12208,5,8644},{12210,10,12628},
+{12213,9,8595},{12216,58,12631},{12231,5,9632},{12233,38,12646},
+{12243,5,9670},{12245,62,12656},{12261,5,12296},{12263,13,12296},
+{12267,5,12298},{12269,14,12672},{12273,5,12445},{12275,37,12353},
+{12285,0,12437},{12286,21,12363},{12292,0,12438},{12293,9,12369},
+{12296,261,12371},{12362,5,12541},{12364,0,12540},{12365,37,12449},
+{12375,0,12533},{12376,21,12459},{12382,0,12534},{12383,9,12465},
+{12386,261,12467},{12452,13,12535},{12456,5,12445},{12458,37,12353},
+{12468,0,12437},{12469,21,12363},{12475,0,12438},{12476,9,12369},
+{12479,261,12371},{12545,5,12541},{12547,0,12540},{12548,37,12449},
+{12558,0,12533},{12559,21,12459},{12565,0,12534},{12566,9,12465},
+{12569,261,12467},{12635,13,12535},{12639,5,65093},{12641,30,12676},
+{12649,5,12541},{12651,5,12445},{12653,5,65288},{12655,5,12308},
+{12657,5,65288},{12659,5,12308},{12661,37,48},{12671,41,12353},
+{12682,0,12437},{12683,21,12364},{12689,0,12438},{12690,265,12370},
+{12757,46,12684},{12769,41,12449},{12780,0,12533},{12781,21,12460},
+{12787,0,12534},{12788,265,12466},{12855,18,12696},{12860,5,12533},
+{12862,38,12701},{12872,5,8242},{12874,0,64256},{12875,5,64259},
+{12877,38,12711},{12887,13,8539},{12891,5,8531},{12893,0,8304},
+{12894,21,8308},{12900,37,8320},{12910,6,12721},{12912,3,2870},
+{12913,6,12723},{12915,3,2873},{12916,6,12725},{12918,3,2876},
+{12919,18,12727},{12924,3,2879},{12925,6,12732},{12927,3,2882},
+{12928,6,12734},{12930,3,2885},{12931,50,12736},{12944,5,601},
+{12946,0,602},{12947,5,602},{12949,42,12749},{12960,237,32},
+{13020,0,165},{13021,121,93},{13052,30,12760},{13060,9,161},
+{13063,22,12768},{13069,5,8249},{13071,5,64257},{13073,0,8210},
+{13074,5,8224},{13076,38,12774},{13086,5,769},{13088,0,175},
+{13089,9,774},{13092,86,12784},{13114,13,176},{13118,6,12806},
+{13120,9,188},{13123,21,192},{13129,65,199},{13146,21,217},
+{13152,21,224},{13158,65,231},{13175,25,249},{13182,38,12808},
+{13192,5,8242},{13194,0,64256},{13195,5,64259},{13197,38,12818},
+{13207,13,8539},{13211,5,8531},{13213,0,8304},{13214,21,8308},
+{13220,37,8320},{13230,6,12828},{13232,3,2888},{13233,6,12830},
+{13235,3,2891},{13236,6,12832},{13238,3,2894},{13239,18,12834},
+{13244,3,2897},{13245,6,12839},{13247,3,2900},{13248,6,12841},
+{13250,3,2903},{13251,10,12843},{13254,37,48},{13264,14,12846},
+{13268,5,40},{13270,5,46},{13272,5,58},{13274,37,48},
+{13284,14,12850},{13288,5,40},{13290,5,46},{13292,5,58},
+{13294,30,12854},{13302,13,12300},{13306,5,12314},{13308,5,12312},
+{13310,5,65288},{13312,5,12317},{13314,5,8216},{13316,5,8220},
+{13318,122,12862},{13349,5,64091},{13351,22,12893},{13358,658,12899},
+{13524,526,13064},{13657,50,13196},{13671,30,13209},{13680,14,13217},
+{13685,82,13221},{13707,38,13242},{13720,10,13252},{13725,98,13255},
+{13751,14,13280},{13756,46,13284},{13769,126,13296},{13802,0,29626},
+{13804,10,13328},{13808,0,29237},{13810,18,13331},{13816,62,13336},
+{13833,5,11916},{13835,14,13352},{13840,0,23426},{13842,46,13356},
+{13855,6,13368},{13858,34,13370},{13868,142,13379},{13905,42,13415},
+{13917,42,13426},{13929,10,13437},{13933,78,13440},{13955,170,13460},
+{13999,134,13503},{14033,5,24536},{14035,130,13537},{14070,10,13570},
+{14073,5,29494},{14076,94,13573},{14101,26,13597},{14110,42,13604},
+{14122,26,13615},{14130,14,13622},{14135,18,13626},{14141,154,13631},
+{14181,22,13670},{14187,5,32592},{14189,0,32593},{14191,5,32709},
+{14193,18,13676},{14198,5,11967},{14200,34,13681},{14210,170,13690},
+{14254,6,13733},{14257,90,13735},{14283,30,13758},{14292,0,27251},
+{14295,0,35346},{14296,5,19972},{14298,6,13766},{14300,5,20015},
+{14302,5,20032},{14304,66,13768},{14321,5,20349},{14323,14,13785},
+{14327,5,20480},{14329,102,13789},{14355,5,20993},{14357,26,13815},
+{14364,5,21258},{14366,102,13822},{14392,5,21856},{14394,10,13848},
+{14397,5,22030},{14399,30,13851},{14407,5,22129},{14409,6,13859},
+{14411,5,22188},{14413,30,13861},{14421,5,22323},{14423,26,13869},
+{14430,5,22517},{14432,78,13876},{14452,5,23011},{14454,74,13896},
+{14473,5,23422},{14475,94,13915},{14499,5,24084},{14501,10,13939},
+{14504,5,24171},{14506,6,13942},{14508,5,24254},{14510,14,13944},
+{14514,5,24348},{14516,122,13948},{14547,9,24850},{14550,78,13979},
+{14570,5,25410},{14572,62,13999},{14588,5,25790},{14590,58,14015},
+{14605,5,26203},{14607,78,14030},{14627,5,26672},{14629,42,14050},
+{14640,5,26864},{14642,30,14061},{14650,5,27007},{14652,10,14069},
+{14655,5,27094},{14657,26,14072},{14664,5,27216},{14666,18,14079},
+{14671,9,27293},{14674,106,14084},{14701,5,27883},{14703,130,14111},
+{14736,5,28583},{14738,30,14144},{14746,5,28765},{14748,22,14152},
+{14754,5,28883},{14756,78,14158},{14776,5,29269},{14778,22,14178},
+{14784,5,29444},{14786,22,14184},{14792,5,29573},{14794,0,29589},
+{14795,9,29598},{14798,46,14190},{14810,5,29722},{14812,10,14202},
+{14815,9,29743},{14818,42,14205},{14829,9,29829},{14832,62,14216},
+{14848,5,30098},{14850,18,14232},{14855,5,30229},{14857,42,14237},
+{14868,5,30372},{14870,26,14248},{14877,5,30559},{14879,34,14255},
+{14888,5,30765},{14890,30,14264},{14898,5,30944},{14900,30,14272},
+{14908,5,31067},{14910,86,14280},{14932,5,31419},{14934,110,14302},
+{14962,5,31944},{14964,14,14330},{14968,9,32007},{14971,34,14334},
+{14980,5,32139},{14982,66,14343},{14999,5,32594},{15001,26,14360},
+{15008,5,32750},{15010,54,14367},{15024,5,32983},{15026,122,14381},
+{15057,5,33727},{15059,110,14412},{15087,5,34471},{15089,42,14440},
+{15100,5,34732},{15102,58,14451},{15117,5,35005},{15119,10,14466},
+{15122,5,35056},{15124,0,35078},{15125,9,35096},{15128,66,14469},
+{15145,5,35651},{15147,142,14486},{15183,5,36789},{15185,110,14522},
+{15213,5,37293},{15215,54,14550},{15229,5,37579},{15231,150,14564},
+{15270,42,14602},{15281,5,38837},{15283,34,14613},{15292,5,38994},
+{15294,26,14622},{15301,5,39218},{15303,18,14629},{15308,5,39353},
+{15310,18,14634},{15315,5,39469},{15317,14,14639},{15321,5,39605},
+{15323,10,14643},{15326,5,39731},{15328,238,14646},{15389,14,14706},
+{15394,110,14710},{15423,18,14738},{15429,30,14743},{15438,18,14751},
+{15444,9,63584},{15447,6,14756},{15449,5,12541},{15451,5,12445},
+{15453,14,14758},{15457,5,8806},{15459,26,14762},{15466,5,8838},
+{15468,5,8834},{15470,6,14769},{15472,5,8836},{15474,5,8842},
+{15476,6,14771},{15478,5,8965},{15480,5,8743},{15482,14,14773},
+{15486,9,8853},{15489,5,8741},{15491,22,14777},{15497,5,8810},
+{15499,14,14783},{15503,5,8747},{15505,14,14787},{15509,5,8822},
+{15511,22,14791},{15517,341,12353},{15603,3,2906},{15604,3,2909},
+{15605,3,2912},{15606,3,2915},{15607,3,2918},{15608,341,12449},
+{15694,3,2921},{15695,3,2924},{15696,3,2927},{15697,3,2930},
+{15698,3,2933},{15699,3,2936},{15700,3,2939},{15701,3,2942},
+{15702,37,12784},{15712,3,2945},{15713,21,12794},{15719,13,12535},
+{15723,6,14797},{15725,5,8922},{15727,6,14799},{15729,5,7742},
+{15731,5,504},{15733,470,14801},{15851,17,741},{15856,3,2948},
+{15857,3,2951},{15858,14,14919},{15862,5,799},{15864,30,14923},
+{15872,5,797},{15874,5,792},{15876,0,810},{15877,5,826},
+{15879,14,14931},{15883,5,610},{15885,50,14935},{15898,5,736},
+{15900,10,14948},{15903,5,8818},{15905,38,14951},{15915,5,7742},
+{15917,5,504},{15919,226,14961},{15976,5,12541},{15978,5,12445},
+{15980,18,15018},{15985,341,12353},{16071,3,2954},{16072,3,2957},
+{16073,3,2960},{16074,3,2963},{16075,3,2966},{16076,341,12449},
+{16162,3,2969},{16163,3,2972},{16164,3,2975},{16165,3,2978},
+{16166,3,2981},{16167,3,2984},{16168,3,2987},{16169,3,2990},
+{16170,37,12784},{16180,3,2993},{16181,21,12794},{16187,13,12535},
+{16191,22,15023},{16197,5,12310},{16199,6,15029},{16201,5,10548},
+{16203,14,15031},{16207,5,10746},{16209,3,2996},{16210,3,2999},
+{16211,3,3002},{16212,3,3005},{16213,3,3008},{16214,3,3011},
+{16215,3,3014},{16216,3,3017},{16217,3,3020},{16218,3,3023},
+{16219,3,3026},{16220,3,3029},{16221,3,3032},{16222,0,962},
+{16223,37,9461},{16233,5,9750},{16235,0,9649},{16236,37,12784},
+{16246,3,3035},{16247,21,12794},{16253,57,9150},{16268,22,15035},
+{16274,13,9680},{16278,5,8263},{16280,10,15041},{16283,61,12688},
+{16299,18,15044},{16304,5,8822},{16306,5,8836},{16308,5,8842},
+{16310,5,8922},{16312,5,9136},{16314,45,9842},{16326,5,12441},
+{16328,0,8413},{16329,5,12310},{16331,6,15049},{16333,37,12784},
+{16343,3,3038},{16344,21,12794},{16350,5,9136},{16352,3,3041},
+{16353,3,3044},{16354,3,3047},{16355,3,3050},{16356,3,3053},
+{16357,3,3056},{16358,3,3059},{16359,3,3062},{16360,3,3065},
+{16361,3,3068},{16362,3,3071},{16363,3,3074},{16364,3,3077},
+{16365,37,12784},{16375,3,3080},{16376,21,12794},{16382,3,3083},
+{16383,3,3086},{16384,3,3089},{16385,3,3092},{16386,3,3095},
+{16387,3,3098},{16388,3,3101},{16389,3,3104},{16390,3,3107},
+{16391,3,3110},{16392,3,3113},{16393,3,3116},{16394,3,3119},
+{16395,37,12784},{16405,3,3122},{16406,21,12794},{16412,6,15051},
+{16414,3,3125},{16415,3,3128},{16416,3,3131},{16417,3,3134},
+{16418,3,3137},{16419,3,3140},{16420,3,3143},{16421,3,3146},
+{16422,3,3149},{16423,3,3152},{16424,3,3155},{16425,3,3158},
+{16426,3,3161},{16427,37,12784},{16437,3,3164},{16438,21,12794},
+{16444,13,12535},{16448,6,15053},{16450,37,12784},{16460,3,3167},
+{16461,21,12794},{16467,10,15055},{16470,5,8806},{16472,18,15058},
+{16477,5,8838},{16479,5,8834},{16481,6,15063},{16483,5,8836},
+{16485,5,8842},{16487,6,15065},{16489,5,8965},{16491,5,8743},
+{16493,14,15067},{16497,9,8853},{16500,5,8741},{16502,22,15071},
+{16508,5,8810},{16510,14,15077},{16514,5,8747},{16516,14,15081},
+{16520,5,8822},{16522,22,15085},{16528,5,8922},{16530,6,15091},
+{16532,5,7742},{16534,5,504},{16536,470,15093},{16654,17,741},
+{16659,3,3170},{16660,3,3173},{16661,14,15211},{16665,5,799},
+{16667,30,15215},{16675,5,797},{16677,5,792},{16679,0,810},
+{16680,5,826},{16682,14,15223},{16686,5,610},{16688,50,15227},
+{16701,5,736},{16703,10,15240},{16706,5,8818},{16708,38,15243},
+{16718,5,7742},{16720,5,504},{16722,374,15253},{16817,14,15347},
+{16822,42,15351},{16834,14,15362},{16839,22,15366},{16846,166,15372},
+{16889,5,26231},{16891,54,15414},{16906,30,15428},{16915,0,27195},
+{16917,210,15436},{16971,110,15489},{16999,5,30541},{17001,14,15517},
+{17006,10,15521},{17010,30,15524},{17019,18,15532},{17025,30,15537},
+{17034,78,15545},{17054,5,33127},{17056,26,15565},{17064,0,33441},
+{17065,5,33443},{17067,86,15572},{17090,38,15594},{17100,5,34308},
+{17102,0,34320},{17104,50,15604},{17118,86,15617},{17141,18,15639},
+{17147,26,15644},{17154,5,37060},{17156,14,15651},{17160,5,37154},
+{17162,18,15655},{17167,5,37732},{17169,182,15660},{17215,5,40015},
+{17217,0,40037},{17218,5,40221},{17220,26,15706},{17228,18,15713},
+{17234,22,15718},{17241,6,15724},{17244,58,15726},{17260,5,20343},
+{17262,62,15741},{17278,5,20626},{17280,6,15757},{17283,0,20657},
+{17284,5,20666},{17286,10,15759},{17290,0,20686},{17292,10,15762},
+{17296,0,20759},{17298,0,20832},{17300,30,15765},{17309,10,15773},
+{17313,22,15776},{17320,0,21144},{17322,0,21156},{17323,5,21178},
+{17325,6,15782},{17328,10,15784},{17333,14,15787},{17338,6,15791},
+{17341,5,13661},{17343,62,15793},{17360,14,15809},{17364,5,21760},
+{17366,26,15813},{17374,18,15820},{17381,26,15825},{17389,6,15832},
+{17392,78,15834},{17412,5,22262},{17416,0,22313},{17418,5,22341},
+{17420,0,22349},{17422,6,15854},{17424,9,22387},{17427,0,22395},
+{17430,0,22426},{17431,5,22429},{17433,6,15856},{17436,0,22476},
+{17439,38,15858},{17450,10,15868},{17453,5,22666},{17455,0,22669},
+{17456,5,22671},{17458,14,15871},{17463,10,15875},{17466,5,22771},
+{17468,5,22789},{17470,6,15878},{17473,18,15880},{17479,0,22879},
+{17481,5,22901},{17483,34,15885},{17494,34,15894},{17503,5,23199},
+{17505,78,15903},{17526,6,15923},{17528,5,14177},{17530,34,15925},
+{17540,0,23647},{17541,5,23655},{17543,0,23664},{17548,10,15934},
+{17553,10,15937},{17557,6,15940},{17560,0,23753},{17563,46,15942},
+{17576,22,15954},{17583,6,15960},{17586,42,15962},{17597,5,24173},
+{17600,18,15973},{17606,6,15978},{17609,34,15980},{17618,9,24530},
+{17621,0,24546},{17622,5,24558},{17624,30,15989},{17633,54,15997},
+{17648,5,24978},{17650,10,16011},{17654,10,16014},{17658,34,16017},
+{17668,10,16026},{17673,6,16029},{17675,5,25403},{17677,10,16031},
+{17681,0,25433},{17684,6,16034},{17687,6,16036},{17689,5,25556},
+{17691,0,25568},{17692,5,25579},{17694,46,16038},{17706,5,25803},
+{17708,6,16050},{17711,122,16052},{17745,0,26218},{17746,5,26220},
+{17748,50,16083},{17762,0,26393},{17765,10,16096},{17771,0,26484},
+{17773,0,26514},{17775,26,16099},{17785,10,16106},{17789,62,16109},
+{17805,9,26776},{17808,0,26780},{17809,5,26794},{17811,10,16125},
+{17816,14,16128},{17820,5,26852},{17822,18,16132},{17828,50,16137},
+{17844,0,27107},{17845,5,27118},{17847,26,16150},{17855,5,27186},
+{17857,22,16157},{17864,10,16163},{17868,22,16166},{17876,9,27377},
+{17879,0,27389},{17881,0,27403},{17882,9,27407},{17886,42,16172},
+{17898,0,27581},{17899,9,27591},{17902,0,27610},{17903,5,27622},
+{17905,18,16183},{17911,54,16188},{17926,6,16202},{17928,5,27942},
+{17930,22,16204},{17936,5,28032},{17938,14,16210},{17946,50,16214},
+{17959,5,28232},{17961,5,28235},{17963,0,28239},{17964,5,28243},
+{17966,66,16227},{17984,42,16244},{17995,5,28616},{17997,0,28649},
+{17999,14,16255},{18004,42,16259},{18016,6,16270},{18019,70,16272},
+{18037,5,29102},{18040,34,16290},{18050,5,29294},{18052,10,16299},
+{18056,42,16302},{18067,5,29464},{18069,30,16313},{18078,5,29550},
+{18080,94,16321},{18105,46,16345},{18118,0,29946},{18120,14,16357},
+{18125,5,30013},{18127,26,16361},{18134,5,30077},{18136,22,16368},
+{18142,5,30143},{18144,14,16374},{18148,5,30175},{18150,30,16378},
+{18159,0,30227},{18160,5,30235},{18163,14,16386},{18168,6,16390},
+{18171,26,16392},{18178,5,30375},{18180,0,30383},{18182,0,30409},
+{18184,0,30440},{18186,14,16399},{18191,0,16441},{18194,0,30552},
+{18196,0,30588},{18198,18,16403},{18203,5,30686},{18205,14,16408},
+{18210,26,16412},{18218,30,16419},{18226,5,30969},{18228,0,30974},
+{18230,54,16427},{18244,5,31180},{18246,6,16441},{18250,70,16443},
+{18269,26,16461},{18279,6,16468},{18281,5,31534},{18283,38,16470},
+{18294,30,16480},{18304,54,16488},{18321,0,31910},{18323,5,31926},
+{18326,0,31940},{18328,0,31949},{18331,0,31974},{18333,18,16502},
+{18340,5,32061},{18342,6,16507},{18346,22,16509},{18353,6,16515},
+{18356,34,16517},{18366,34,16526},{18375,5,32390},{18377,30,16535},
+{18387,5,32611},{18389,0,32621},{18390,5,32637},{18392,6,16543},
+{18395,10,16545},{18399,66,16548},{18417,50,16565},{18431,50,16578},
+{18445,0,33252},{18447,10,16591},{18451,0,33284},{18453,6,16594},
+{18456,10,16596},{18460,10,16599},{18464,6,16602},{18467,22,16604},
+{18473,5,33447},{18475,26,16610},{18482,5,33543},{18484,42,16617},
+{18495,5,33684},{18497,34,16628},{18507,10,16637},{18510,5,33873},
+{18512,5,33881},{18514,0,33884},{18516,34,16640},{18525,5,33998},
+{18527,0,34003},{18529,22,16649},{18535,5,34084},{18537,18,16655},
+{18542,5,34145},{18545,30,16660},{18556,10,16668},{18559,5,34264},
+{18561,38,16671},{18572,6,16681},{18575,22,16683},{18581,5,34460},
+{18583,90,16689},{18606,5,34660},{18608,6,16712},{18612,18,16714},
+{18618,6,16719},{18621,10,16721},{18625,0,34787},{18626,5,34789},
+{18628,34,16724},{18639,0,34921},{18641,14,16733},{18646,14,16737},
+{18651,0,35127},{18653,10,16741},{18657,58,16744},{18673,42,16759},
+{18685,42,16770},{18696,5,35732},{18698,0,35897},{18700,0,35901},
+{18703,18,16781},{18709,26,16786},{18717,0,36081},{18719,30,16793},
+{18728,6,16801},{18730,5,36385},{18732,0,36391},{18734,42,16803},
+{18746,0,18510},{18748,22,16814},{18755,6,16820},{18758,46,16822},
+{18771,6,16834},{18775,34,16836},{18785,6,16845},{18788,14,16847},
+{18792,5,37118},{18794,22,16851},{18800,5,37190},{18802,26,16857},
+{18809,5,37315},{18813,6,16864},{18815,5,37398},{18818,22,16866},
+{18825,5,37500},{18827,26,16872},{18836,0,37554},{18837,5,37567},
+{18839,14,16879},{18845,6,16883},{18849,22,16885},{18857,18,16891},
+{18864,18,16896},{18869,5,37910},{18871,10,16901},{18876,14,16904},
+{18880,5,38284},{18884,0,38344},{18887,0,38444},{18888,5,38451},
+{18891,6,16908},{18894,0,38530},{18896,0,38554},{18898,18,16910},
+{18904,50,16915},{18919,6,16928},{18921,5,38833},{18923,46,16930},
+{18936,5,38962},{18938,22,16942},{18945,0,39095},{18946,5,39099},
+{18948,22,16948},{18954,5,39152},{18956,10,16954},{18960,5,39190},
+{18963,9,39194},{18967,0,39217},{18968,9,39226},{18971,46,16957},
+{18984,66,16969},{19002,70,16986},{19020,5,39787},{19022,5,39798},
+{19024,6,17004},{19027,34,17006},{19039,0,39958},{19040,9,39960},
+{19043,10,17015},{19047,14,17018},{19052,5,40009},{19055,18,17022},
+{19060,9,40041},{19063,5,40045},{19065,22,17027},{19072,0,40209},
+{19073,5,40215},{19076,0,19652},{19078,18,17033},{19085,0,40307},
+{19086,5,40310},{19088,66,17038},{19106,10,17055},{19110,0,40637},
+{19112,42,17058},{19124,0,40797},{19126,10,17069},{19130,42,17072},
+{19141,5,20003},{19143,94,17083},{19167,9,20748},{19170,34,17107},
+{19179,5,20947},{19181,22,17116},{19187,5,21041},{19189,18,17122},
+{19194,5,21112},{19196,82,17127},{19217,5,21444},{19219,14,17148},
+{19223,5,21556},{19225,126,17152},{19257,5,22033},{19259,70,17184},
+{19277,5,22298},{19279,10,17202},{19282,5,22333},{19284,270,17205},
+{19352,5,24276},{19354,182,17273},{19400,5,25518},{19402,0,25578},
+{19403,5,25592},{19405,46,17319},{19417,5,25752},{19419,70,17331},
+{19437,5,26251},{19439,126,17349},{19471,5,27336},{19473,10,17381},
+{19476,5,27517},{19478,94,17384},{19502,5,28378},{19504,46,17408},
+{19516,5,28885},{19518,22,17420},{19524,5,29263},{19526,46,17426},
+{19538,5,29498},{19540,202,17438},{19591,5,30604},{19593,78,17489},
+{19613,5,31015},{19615,130,17509},{19648,5,31826},{19650,9,31835},
+{19653,74,17542},{19672,5,32245},{19674,42,17561},{19685,5,32639},
+{19687,6,17572},{19689,9,32765},{19692,98,17574},{19717,5,33245},
+{19719,18,17599},{19724,5,33299},{19726,150,17604},{19764,5,34711},
+{19766,62,17642},{19782,9,34970},{19785,10,17658},{19788,5,35086},
+{19790,218,17661},{19845,5,36337},{19847,18,17716},{19852,5,36416},
+{19854,110,17721},{19882,9,36768},{19885,138,17749},{19920,5,37563},
+{19922,62,17784},{19938,5,37901},{19940,26,17800},{19947,5,38353},
+{19949,142,17807},{19985,5,39010},{19987,58,17843},{20002,5,39613},
+{20004,10,17858},{20007,5,39693},{20009,110,17861},{20037,9,40578},
+{20040,38,17889},{20050,5,40746},{20052,18,17899},{20067,18,17904},
+{20073,6,17909},{20076,14,17911},{20081,6,17915},{20084,0,21092},
+{20085,5,21105},{20087,10,17917},{20091,82,17920},{20113,42,17941},
+{20125,10,17952},{20128,5,25949},{20131,6,17955},{20134,134,17957},
+{20169,146,17991},{20207,50,18028},{20221,46,18041},{20233,5,37001},
+{20235,106,18053},{20263,190,18080},{20312,10,18128},{20317,5,900},
+{20319,198,18131},{20369,5,8804},{20371,0,9674},{20372,5,900},
+{20374,198,18181},{20424,5,8804},{20426,6,18231},{20428,9,904},
+{20431,18,18233},{20436,13,940},{20440,6,18238},{20442,5,972},
+{20444,10,18240},{20447,41,1026},{20458,5,1038},{20460,41,1106},
+{20471,5,1118},{20473,5,12494},{20475,18,18243},{20480,13,12511},
+{20484,6,18248},{20486,21,12520},{20492,17,12527},{20497,21,65},
+{20503,6,18250},{20505,3,3176},{20506,3,3179},{20507,3,3183},
+{20508,3,3187},{20509,3,3190},{20510,10,18252},{20513,33,49},
+{20522,0,48},{20523,3,3193},{20524,3,3196},{20525,3,3199},
+{20526,3,3202},{20527,3,3205},{20528,3,3208},{20529,3,3211},
+{20530,3,3214},{20531,3,3217},{20532,3,3220},{20533,37,48},
+{20543,37,48},{20553,46,18255},{20565,3,3223},{20566,34,18267},
+{20575,3,3226},{20576,3,3229},{20577,0,21452},{20578,3,3232},
+{20579,3,3235},{20580,3,3238},{20581,3,3241},{20582,0,12487},
+{20583,3,3244},{20584,10,18276},{20587,5,9361},{20589,3,3247},
+{20590,3,3250},{20591,3,3253},{20592,3,3256},{20593,3,3259},
+{20594,3,3262},{20595,3,3265},{20596,3,3268},{20597,3,3271},
+{20598,3,3274},{20599,3,3277},{20600,3,3280},{20601,3,3283},
+{20602,3,3286},{20603,3,3289},{20604,3,3292},{20605,3,3295},
+{20606,3,3298},{20607,3,3301},{20608,3,3304},{20609,3,3307},
+{20610,3,3310},{20611,3,3313},{20612,3,3316},{20613,3,3319},
+{20614,3,3322},{20615,3,3325},{20616,3,3328},{20617,3,3331},
+{20618,3,3334},{20619,3,3337},{20620,3,3340},{20621,3,3343},
+{20622,3,3346},{20623,3,3349},{20624,3,3352},{20625,3,3355},
+{20626,3,3358},{20627,3,3361},{20628,3,3364},{20629,3,3367},
+{20630,3,3370},{20631,3,3373},{20632,3,3376},{20633,3,3379},
+{20634,3,3382},{20635,3,3385},{20636,3,3388},{20637,3,3391},
+{20638,3,3394},{20639,3,3397},{20640,3,3400},{20641,3,3403},
+{20642,3,3406},{20643,3,3409},{20644,3,3412},{20645,3,3415},
+{20646,3,3418},{20647,3,3421},{20648,3,3424},{20649,3,3427},
+{20650,3,3431},{20651,3,3435},{20652,3,3439},{20653,3,3443},
+{20654,3,3447},{20655,3,3451},{20656,3,3455},{20657,3,3459},
+{20658,3,3463},{20659,3,3467},{20660,3,3471},{20661,3,3475},
+{20662,3,3479},{20663,3,3483},{20664,3,3487},{20665,3,3491},
+{20666,3,3495},{20667,3,3499},{20668,3,3503},{20669,3,3507},
+{20670,3,3511},{20671,3,3515},{20672,3,3519},{20673,3,3523},
+{20674,3,3527},{20675,3,3531},{20676,3,3535},{20677,3,3539},
+{20678,3,3543},{20679,3,3547},{20680,3,3551},{20681,3,3555},
+{20682,3,3559},{20683,3,3563},{20684,3,3567},{20685,3,3571},
+{20686,3,3575},{20687,3,3579},{20688,3,3583},{20689,3,3587},
+{20690,3,3591},{20691,3,3595},{20692,3,3599},{20693,3,3603},
+{20694,3,3607},{20695,3,3611},{20696,3,3615},{20697,3,3619},
+{20698,3,3623},{20699,3,3627},{20700,3,3631},{20701,3,3635},
+{20702,3,3639},{20703,3,3643},{20704,3,3647},{20705,3,3651},
+{20706,3,3655},{20707,3,3659},{20708,3,3663},{20709,3,3667},
+{20710,3,3671},{20711,3,3675},{20712,3,3679},{20713,3,3683},
+{20714,3,3687},{20715,3,3691},{20716,3,3695},{20717,3,3699},
+{20718,3,3703},{20719,3,3707},{20720,3,3711},{20721,3,3715},
+{20722,3,3719},{20723,3,3723},{20724,3,3727},{20725,3,3731},
+{20726,3,3735},{20727,3,3739},{20728,3,3743},{20729,3,3747},
+{20730,3,3751},{20731,3,3755},{20732,3,3759},{20733,3,3763},
+{20734,3,3767},{20735,3,3771},{20736,3,3775},{20737,3,3779},
+{20738,3,3783},{20739,3,3787},{20740,3,3791},{20741,3,3795},
+{20742,3,3799},{20743,3,3803},{20744,3,3807},{20745,3,3811},
+{20746,3,3815},{20747,3,3819},{20748,3,3823},{20749,3,3827},
+{20750,3,3830},{20751,3,3833},{20752,3,3836},{20753,3,3839},
+{20754,3,3842},{20755,3,3845},{20756,3,3848},{20757,3,3851},
+{20758,3,3854},{20759,3,3857},{20760,3,3860},{20761,3,3863},
+{20762,3,3866},{20763,3,3869},{20764,3,3872},{20765,3,3875},
+{20766,3,3878},{20767,3,3881},{20768,3,3884},{20769,3,3887},
+{20770,3,3890},{20771,3,3893},{20772,3,3896},{20773,3,3899},
+{20774,3,3902},{20775,3,3905},{20776,3,3908},{20777,3,3911},
+{20778,3,3914},{20779,3,3917},{20780,3,3920},{20781,3,3923},
+{20782,3,3926},{20783,3,3929},{20784,3,3932},{20785,3,3935},
+{20786,3,3938},{20787,3,3941},{20788,3,3944},{20789,3,3947},
+{20790,3,3950},{20791,3,3953},{20792,3,3956},{20793,3,3959},
+{20794,3,3962},{20795,3,3965},{20796,3,3968},{20797,3,3971},
+{20798,3,3974},{20799,3,3977},{20800,3,3980},{20801,3,3983},
+{20802,3,3986},{20803,3,3989},{20804,3,3992},{20805,3,3995},
+{20806,3,3998},{20807,3,4001},{20808,3,4004},{20809,3,4007},
+{20810,3,4010},{20811,3,4013},{20812,3,4016},{20813,3,4019},
+{20814,3,4022},{20815,3,4025},{20816,3,4028},{20817,3,4031},
+{20818,3,4034},{20819,3,4037},{20820,3,4040},{20821,3,4043},
+{20822,3,4046},{20823,3,4049},{20824,3,4052},{20825,3,4055},
+{20826,3,4058},{20827,3,4061},{20828,3,4064},{20829,3,4067},
+{20830,3,4070},{20831,3,4073},{20832,3,4076},{20833,3,4079},
+{20834,3,4082},{20835,3,4085},{20836,3,4088},{20837,3,4091},
+{20838,3,4094},{20839,3,4097},{20840,3,4100},{20841,3,4103},
+{20842,3,4106},{20843,3,4109},{20844,3,4112},{20845,3,4115},
+{20846,3,4118},{20847,3,4121},{20848,3,4124},{20849,3,4127},
+{20850,3,4131},{20851,3,4135},{20852,3,4139},{20853,3,4143},
+{20854,3,4147},{20855,3,4151},{20856,3,4155},{20857,3,4159},
+{20858,3,4163},{20859,3,4167},{20860,3,4171},{20861,3,4175},
+{20862,3,4179},{20863,3,4183},{20864,3,4187},{20865,3,4191},
+{20866,3,4195},{20867,3,4199},{20868,3,4203},{20869,3,4207},
+{20870,3,4211},{20871,3,4215},{20872,3,4219},{20873,3,4223},
+{20874,3,4227},{20875,3,4231},{20876,3,4235},{20877,3,4239},
+{20878,3,4243},{20879,3,4247},{20880,3,4251},{20881,3,4255},
+{20882,3,4259},{20883,3,4263},{20884,3,4267},{20885,3,4271},
+{20886,3,4275},{20887,3,4279},{20888,3,4283},{20889,3,4287},
+{20890,3,4291},{20891,3,4295},{20892,3,4299},{20893,3,4303},
+{20894,3,4307},{20895,3,4311},{20896,3,4315},{20897,3,4319},
+{20898,3,4323},{20899,3,4327},{20900,3,4330},{20901,3,4333},
+{20902,3,4336},{20903,3,4339},{20904,3,4342},{20905,3,4345},
+{20906,3,4348},{20907,3,4351},{20908,3,4354},{20909,3,4357},
+{20910,3,4360},{20911,3,4363},{20912,3,4366},{20913,3,4369},
+{20914,3,4372},{20915,3,4375},{20916,3,4378},{20917,3,4381},
+{20918,3,4384},{20919,3,4387},{20920,3,4391},{20921,3,4395},
+{20922,3,4398},{20923,3,4401},{20924,3,4404},{20925,3,4407},
+{20926,3,4410},{20927,3,4413},{20928,3,4417},{20929,3,4421},
+{20930,3,4424},{20931,3,4428},{20932,3,4433},{20933,3,4439},
+{20934,3,4444},{20935,3,4449},{20936,3,4454},{20937,3,4458},
+{20938,3,4462},{20939,3,4466},{20940,3,4471},{20941,3,4474},
+{20942,3,4478},{20943,3,4484},{20944,3,4487},{20945,3,4491},
+{20946,3,4496},{20947,3,4502},{20948,3,4507},{20949,3,4512},
+{20950,3,4517},{20951,3,4521},{20952,3,4525},{20953,3,4529},
+{20954,3,4534},{20955,3,4537},{20956,3,4541},{20957,6,18279},
+{20959,3,4547},{20960,3,4550},{20961,5,900},{20963,198,18281},
+{21013,5,8804},{21015,0,9674},{21016,5,900},{21018,198,18331},
+{21068,5,8804},{21070,34,18381},{21079,5,20084},{21081,58,18390},
+{21096,5,20299},{21098,54,18405},{21112,9,20411},{21115,5,20416},
+{21117,46,18419},{21129,5,20530},{21131,10,18431},{21134,5,20561},
+{21136,22,18434},{21142,5,20611},{21144,14,18440},{21148,9,20639},
+{21151,5,20655},{21153,14,18444},{21157,5,20700},{21159,26,18448},
+{21166,5,20764},{21168,0,20771},{21169,5,20775},{21171,5,20780},
+{21173,98,18455},{21198,9,21141},{21201,14,18480},{21205,9,21174},
+{21208,70,18484},{21226,9,21287},{21229,5,21291},{21231,22,18502},
+{21237,5,21383},{21239,22,18508},{21245,5,21458},{21247,54,18514},
+{21261,5,21613},{21263,38,18528},{21273,5,21772},{21275,22,18538},
+{21281,5,21850},{21283,22,18544},{21289,5,21975},{21291,30,18550},
+{21299,5,22083},{21301,0,22086},{21302,9,22113},{21305,34,18558},
+{21314,9,22245},{21317,5,22273},{21319,10,18567},{21322,5,22308},
+{21324,130,18570},{21357,5,22663},{21359,6,18603},{21361,9,22688},
+{21364,30,18605},{21372,5,22802},{21374,18,18613},{21379,5,22837},
+{21381,114,18618},{21410,5,23108},{21412,78,18647},{21432,5,23440},
+{21434,0,23444},{21435,5,23464},{21437,6,18667},{21439,5,23473},
+{21441,18,18669},{21446,5,23513},{21448,34,18674},{21457,5,23668},
+{21459,34,18683},{21468,5,23793},{21470,22,18692},{21476,5,23903},
+{21478,6,18698},{21480,5,23929},{21482,54,18700},{21496,5,24144},
+{21498,58,18714},{21513,5,24363},{21515,26,18729},{21522,5,24436},
+{21524,22,18736},{21530,5,24496},{21532,0,24520},{21533,5,24528},
+{21535,46,18742},{21547,5,24662},{21549,54,18754},{21563,5,24777},
+{21565,5,24782},{21567,62,18768},{21583,5,24960},{21585,5,24963},
+{21587,14,18784},{21591,5,25024},{21593,5,25038},{21595,14,18788},
+{21599,5,25068},{21601,50,18792},{21614,9,25229},{21617,0,25267},
+{21618,5,25270},{21620,0,25274},{21621,5,25278},{21623,178,18805},
+{21668,5,25833},{21670,6,18850},{21672,9,25864},{21675,14,18852},
+{21679,5,25916},{21681,54,18856},{21695,5,26100},{21697,5,26110},
+{21699,0,26125},{21700,5,26129},{21702,62,18870},{21718,9,26266},
+{21721,6,18886},{21723,5,26306},{21725,66,18888},{21742,5,26556},
+{21744,62,18905},{21760,5,26736},{21762,30,18921},{21770,5,26844},
+{21772,42,18929},{21783,5,26992},{21785,58,18940},{21800,5,27270},
+{21802,0,27291},{21803,5,27312},{21805,0,27316},{21806,5,27326},
+{21808,0,27340},{21809,5,27349},{21811,10,18955},{21814,5,27398},
+{21816,46,18958},{21828,5,27551},{21830,5,27554},{21832,6,18970},
+{21834,5,27576},{21836,5,27587},{21838,14,18972},{21842,9,27686},
+{21845,166,18976},{21887,5,28333},{21889,22,19018},{21895,5,28397},
+{21897,166,19024},{21939,5,29119},{21941,10,19066},{21944,5,29192},
+{21946,34,19069},{21955,5,29307},{21957,10,19078},{21960,5,29397},
+{21962,30,19081},{21970,13,29533},{21974,62,19089},{21990,5,29695},
+{21992,6,19105},{21994,5,29799},{21996,18,19107},{22001,5,29873},
+{22003,78,19112},{22023,5,30075},{22025,26,19132},{22032,5,30265},
+{22034,14,19139},{22038,5,30348},{22040,0,30367},{22041,5,30370},
+{22043,26,19143},{22050,5,30484},{22052,18,19150},{22057,5,30550},
+{22059,0,30576},{22060,5,30579},{22062,70,19155},{22080,5,30816},
+{22082,194,19173},{22131,5,31284},{22133,70,19222},{22151,5,31551},
+{22153,30,19240},{22161,5,31674},{22163,14,19248},{22167,5,31732},
+{22169,5,31737},{22171,34,19252},{22180,5,31801},{22182,102,19261},
+{22208,13,32195},{22212,5,32205},{22214,58,19287},{22229,5,32413},
+{22231,62,19302},{22247,5,32799},{22249,130,19318},{22282,9,33264},
+{22285,46,19351},{22297,5,33408},{22299,14,19363},{22303,5,33434},
+{22305,18,19367},{22310,5,33546},{22312,5,33566},{22314,26,19372},
+{22321,5,33613},{22323,106,19379},{22350,5,33961},{22352,5,33991},
+{22354,10,19406},{22357,5,34050},{22359,46,19409},{22371,5,34140},
+{22373,5,34143},{22375,34,19421},{22384,9,34237},{22387,22,19430},
+{22393,5,34317},{22395,18,19436},{22400,5,34392},{22402,0,34397},
+{22403,5,34400},{22405,30,19441},{22413,5,34484},{22415,58,19449},
+{22430,5,34620},{22432,14,19464},{22436,13,34691},{22440,98,19468},
+{22465,5,34888},{22467,42,19493},{22478,5,35019},{22480,14,19504},
+{22484,5,35093},{22486,70,19508},{22504,5,35227},{22506,26,19526},
+{22513,5,35332},{22515,14,19533},{22519,5,35371},{22521,30,19537},
+{22529,5,35446},{22531,5,35450},{22533,62,19545},{22549,9,35539},
+{22552,82,19561},{22573,5,35939},{22575,0,35942},{22576,5,35957},
+{22578,0,35966},{22579,5,35974},{22581,6,19582},{22583,5,35995},
+{22585,114,19584},{22614,5,36356},{22616,6,19613},{22618,5,36407},
+{22620,6,19615},{22622,5,36445},{22624,0,36473},{22625,5,36482},
+{22627,18,19617},{22632,5,36547},{22634,26,19622},{22641,5,36623},
+{22643,0,36630},{22644,5,36640},{22646,26,19629},{22653,5,36690},
+{22655,5,36701},{22657,42,19636},{22668,9,36904},{22671,5,36915},
+{22673,30,19647},{22681,5,37080},{22683,70,19655},{22701,5,37267},
+{22703,14,19673},{22707,5,37331},{22709,0,37337},{22710,5,37353},
+{22712,10,19677},{22715,5,37380},{22717,0,37388},{22718,5,37394},
+{22720,0,37400},{22721,5,37404},{22723,9,37412},{22726,9,37422},
+{22729,5,37429},{22731,14,19680},{22735,5,37468},{22737,0,37481},
+{22738,9,37486},{22741,22,19684},{22747,5,37540},{22749,30,19690},
+{22757,5,37596},{22759,90,19698},{22782,5,37760},{22784,30,19721},
+{22792,9,37812},{22795,5,37828},{22797,90,19729},{22820,5,38301},
+{22822,22,19752},{22828,5,38437},{22830,0,38455},{22831,5,38457},
+{22833,0,38482},{22834,5,38486},{22836,62,19758},{22852,5,38775},
+{22854,26,19774},{22861,5,38852},{22863,26,19781},{22870,5,38903},
+{22872,134,19788},{22906,9,39402},{22909,5,39412},{22911,5,39421},
+{22913,26,19822},{22920,5,39498},{22922,58,19829},{22937,5,39666},
+{22939,10,19844},{22942,5,39679},{22944,5,39684},{22946,14,19847},
+{22950,5,39737},{22952,0,39756},{22953,5,39766},{22955,10,19851},
+{22958,5,39789},{22960,110,19854},{22988,5,40243},{22990,10,19882},
+{22993,5,40275},{22995,14,19885},{22999,5,40338},{23001,0,40341},
+{23002,5,40343},{23004,14,19889},{23008,5,40404},{23010,18,19893},
+{23015,9,40464},{23018,6,19898},{23020,5,40590},{23022,30,19900},
+{23030,5,40684},{23032,42,19908},{23043,5,40771},{23045,30,19919},
+{23053,5,40849},{23055,10,19927},
+};
+
+static const unsigned short cmap_Adobe_Japan1_UCS2_table[19930] = {
+2,48,46,3,115,101,99,3,109,105,110,4,
+88,73,73,73,3,88,73,86,2,88,86,4,
+120,105,105,105,3,120,105,118,2,120,118,2,
+84,66,2,8595,8593,4,26377,38480,20250,31038,4,36001,
+22243,27861,20154,4,26377,38480,20250,31038,4,36001,22243,27861,
+20154,2,69,778,2,73,778,2,79,778,2,101,
+778,2,305,778,2,111,778,2,69,778,2,73,
+778,2,79,778,2,101,778,2,305,778,2,111,
+778,3,48,47,51,3,49,47,55,3,50,47,
+55,3,51,47,55,3,52,47,55,3,53,47,
+55,3,54,47,55,3,49,47,57,3,50,47,
+57,3,52,47,57,3,53,47,57,3,55,47,
+57,3,56,47,57,4,49,47,49,48,4,51,
+47,49,48,4,55,47,49,48,4,57,47,49,
+48,4,49,47,49,49,4,50,47,49,49,4,
+51,47,49,49,4,52,47,49,49,4,53,47,
+49,49,4,54,47,49,49,4,55,47,49,49,
+4,56,47,49,49,4,57,47,49,49,5,49,
+48,47,49,49,4,49,47,49,50,4,53,47,
+49,50,4,55,47,49,50,5,49,49,47,49,
+50,5,49,47,49,48,48,3,48,47,51,3,
+49,47,50,3,49,47,51,3,50,47,51,3,
+49,47,52,3,51,47,52,3,49,47,53,3,
+50,47,53,3,51,47,53,3,52,47,53,3,
+49,47,54,3,53,47,54,3,49,47,55,3,
+50,47,55,3,51,47,55,3,52,47,55,3,
+53,47,55,3,54,47,55,3,49,47,56,3,
+51,47,56,3,53,47,56,3,55,47,56,3,
+49,47,57,3,50,47,57,3,52,47,57,3,
+53,47,57,3,55,47,57,3,56,47,57,4,
+49,47,49,48,4,51,47,49,48,4,55,47,
+49,48,4,57,47,49,48,4,49,47,49,49,
+4,50,47,49,49,4,51,47,49,49,4,52,
+47,49,49,4,53,47,49,49,4,54,47,49,
+49,4,55,47,49,49,4,56,47,49,49,4,
+57,47,49,49,5,49,48,47,49,49,4,49,
+47,49,50,4,53,47,49,50,4,55,47,49,
+50,5,49,49,47,49,50,5,49,47,49,48,
+48,2,48,48,2,48,49,2,48,50,2,48,
+51,2,48,52,2,48,53,2,48,54,2,48,
+55,2,48,56,2,48,57,2,50,49,2,50,
+50,2,50,51,2,50,52,2,50,53,2,50,
+54,2,50,55,2,50,56,2,50,57,2,51,
+48,2,51,49,2,51,50,2,51,51,2,51,
+52,2,51,53,2,51,54,2,51,55,2,51,
+56,2,51,57,2,52,48,2,52,49,2,52,
+50,2,52,51,2,52,52,2,52,53,2,52,
+54,2,52,55,2,52,56,2,52,57,2,53,
+48,2,53,49,2,53,50,2,53,51,2,53,
+52,2,53,53,2,53,54,2,53,55,2,53,
+56,2,53,57,2,54,48,2,54,49,2,54,
+50,2,54,51,2,54,52,2,54,53,2,54,
+54,2,54,55,2,54,56,2,54,57,2,55,
+48,2,55,49,2,55,50,2,55,51,2,55,
+52,2,55,53,2,55,54,2,55,55,2,55,
+56,2,55,57,2,56,48,2,56,49,2,56,
+50,2,56,51,2,56,52,2,56,53,2,56,
+54,2,56,55,2,56,56,2,56,57,2,57,
+48,2,57,49,2,57,50,2,57,51,2,57,
+52,2,57,53,2,57,54,2,57,55,2,57,
+56,2,57,57,3,49,48,48,4,120,105,105,
+105,3,120,105,118,2,120,118,4,88,73,73,
+73,3,88,73,86,2,88,86,2,21313,19968,2,
+21313,20108,2,21313,19977,2,21313,22235,2,21313,20116,2,
+21313,20845,2,21313,19971,2,21313,20843,2,21313,20061,2,
+20108,21313,2,40,41,2,48,48,2,51,50,2,
+51,51,2,51,52,2,51,53,2,51,54,2,
+51,55,2,51,56,2,51,57,2,52,48,2,
+52,49,2,52,50,2,52,51,2,52,52,2,
+52,53,2,52,54,2,52,55,2,52,56,2,
+52,57,2,53,48,2,53,49,2,53,50,2,
+53,51,2,53,52,2,53,53,2,53,54,2,
+53,55,2,53,56,2,53,57,2,54,48,2,
+54,49,2,54,50,2,54,51,2,54,52,2,
+54,53,2,54,54,2,54,55,2,54,56,2,
+54,57,2,55,48,2,55,49,2,55,50,2,
+55,51,2,55,52,2,55,53,2,55,54,2,
+55,55,2,55,56,2,55,57,2,56,48,2,
+56,49,2,56,50,2,56,51,2,56,52,2,
+56,53,2,56,54,2,56,55,2,56,56,2,
+56,57,2,57,48,2,57,49,2,57,50,2,
+57,51,2,57,52,2,57,53,2,57,54,2,
+57,55,2,57,56,2,57,57,3,49,48,48,
+2,48,48,2,48,49,2,48,50,2,48,51,
+2,48,52,2,48,53,2,48,54,2,48,55,
+2,48,56,2,48,57,2,49,48,2,49,49,
+2,49,50,2,49,51,2,49,52,2,49,53,
+2,49,54,2,49,55,2,49,56,2,49,57,
+2,50,48,2,50,49,2,50,50,2,50,51,
+2,50,52,2,50,53,2,50,54,2,50,55,
+2,50,56,2,50,57,2,51,48,2,51,49,
+2,51,50,2,51,51,2,51,52,2,51,53,
+2,51,54,2,51,55,2,51,56,2,51,57,
+2,52,48,2,52,49,2,52,50,2,52,51,
+2,52,52,2,52,53,2,52,54,2,52,55,
+2,52,56,2,52,57,2,53,48,2,53,49,
+2,53,50,2,53,51,2,53,52,2,53,53,
+2,53,54,2,53,55,2,53,56,2,53,57,
+2,54,48,2,54,49,2,54,50,2,54,51,
+2,54,52,2,54,53,2,54,54,2,54,55,
+2,54,56,2,54,57,2,55,48,2,55,49,
+2,55,50,2,55,51,2,55,52,2,55,53,
+2,55,54,2,55,55,2,55,56,2,55,57,
+2,56,48,2,56,49,2,56,50,2,56,51,
+2,56,52,2,56,53,2,56,54,2,56,55,
+2,56,56,2,56,57,2,57,48,2,57,49,
+2,57,50,2,57,51,2,57,52,2,57,53,
+2,57,54,2,57,55,2,57,56,2,57,57,
+3,49,48,48,2,48,48,2,48,49,2,48,
+50,2,48,51,2,48,52,2,48,53,2,48,
+54,2,48,55,2,48,56,2,48,57,2,49,
+48,2,49,49,2,49,50,2,49,51,2,49,
+52,2,49,53,2,49,54,2,49,55,2,49,
+56,2,49,57,2,50,48,2,50,49,2,50,
+50,2,50,51,2,50,52,2,50,53,2,50,
+54,2,50,55,2,50,56,2,50,57,2,51,
+48,2,51,49,2,51,50,2,51,51,2,51,
+52,2,51,53,2,51,54,2,51,55,2,51,
+56,2,51,57,2,52,48,2,52,49,2,52,
+50,2,52,51,2,52,52,2,52,53,2,52,
+54,2,52,55,2,52,56,2,52,57,2,53,
+48,2,53,49,2,53,50,2,53,51,2,53,
+52,2,53,53,2,53,54,2,53,55,2,53,
+56,2,53,57,2,54,48,2,54,49,2,54,
+50,2,54,51,2,54,52,2,54,53,2,54,
+54,2,54,55,2,54,56,2,54,57,2,55,
+48,2,55,49,2,55,50,2,55,51,2,55,
+52,2,55,53,2,55,54,2,55,55,2,55,
+56,2,55,57,2,56,48,2,56,49,2,56,
+50,2,56,51,2,56,52,2,56,53,2,56,
+54,2,56,55,2,56,56,2,56,57,2,57,
+48,2,57,49,2,57,50,2,57,51,2,57,
+52,2,57,53,2,57,54,2,57,55,2,57,
+56,2,57,57,3,49,48,48,2,48,48,2,
+48,49,2,48,50,2,48,51,2,48,52,2,
+48,53,2,48,54,2,48,55,2,48,56,2,
+48,57,2,49,48,2,49,49,2,49,50,2,
+49,51,2,49,52,2,49,53,2,49,54,2,
+49,55,2,49,56,2,49,57,2,50,48,2,
+50,49,2,50,50,2,50,51,2,50,52,2,
+50,53,2,50,54,2,50,55,2,50,56,2,
+50,57,2,51,48,2,51,49,2,51,50,2,
+51,51,2,51,52,2,51,53,2,51,54,2,
+51,55,2,51,56,2,51,57,2,52,48,2,
+52,49,2,52,50,2,52,51,2,52,52,2,
+52,53,2,52,54,2,52,55,2,52,56,2,
+52,57,2,53,48,2,53,49,2,53,50,2,
+53,51,2,53,52,2,53,53,2,53,54,2,
+53,55,2,53,56,2,53,57,2,54,48,2,
+54,49,2,54,50,2,54,51,2,54,52,2,
+54,53,2,54,54,2,54,55,2,54,56,2,
+54,57,2,55,48,2,55,49,2,55,50,2,
+55,51,2,55,52,2,55,53,2,55,54,2,
+55,55,2,55,56,2,55,57,2,56,48,2,
+56,49,2,56,50,2,56,51,2,56,52,2,
+56,53,2,56,54,2,56,55,2,56,56,2,
+56,57,2,57,48,2,57,49,2,57,50,2,
+57,51,2,57,52,2,57,53,2,57,54,2,
+57,55,2,57,56,2,57,57,3,49,48,48,
+2,48,48,2,48,49,2,48,50,2,48,51,
+2,48,52,2,48,53,2,48,54,2,48,55,
+2,48,56,2,48,57,2,49,48,2,49,49,
+2,49,50,2,49,51,2,49,52,2,49,53,
+2,49,54,2,49,55,2,49,56,2,49,57,
+2,50,48,2,50,49,2,50,50,2,50,51,
+2,50,52,2,50,53,2,50,54,2,50,55,
+2,50,56,2,50,57,2,51,48,2,51,49,
+2,51,50,2,51,51,2,51,52,2,51,53,
+2,51,54,2,51,55,2,51,56,2,51,57,
+2,52,48,2,52,49,2,52,50,2,52,51,
+2,52,52,2,52,53,2,52,54,2,52,55,
+2,52,56,2,52,57,2,53,48,2,53,49,
+2,53,50,2,53,51,2,53,52,2,53,53,
+2,53,54,2,53,55,2,53,56,2,53,57,
+2,54,48,2,54,49,2,54,50,2,54,51,
+2,54,52,2,54,53,2,54,54,2,54,55,
+2,54,56,2,54,57,2,55,48,2,55,49,
+2,55,50,2,55,51,2,55,52,2,55,53,
+2,55,54,2,55,55,2,55,56,2,55,57,
+2,56,48,2,56,49,2,56,50,2,56,51,
+2,56,52,2,56,53,2,56,54,2,56,55,
+2,56,56,2,56,57,2,57,48,2,57,49,
+2,57,50,2,57,51,2,57,52,2,57,53,
+2,57,54,2,57,55,2,57,56,2,57,57,
+3,49,48,48,2,48,48,2,48,49,2,48,
+50,2,48,51,2,48,52,2,48,53,2,48,
+54,2,48,55,2,48,56,2,48,57,2,49,
+48,2,49,49,2,49,50,2,49,51,2,49,
+52,2,49,53,2,49,54,2,49,55,2,49,
+56,2,49,57,2,50,48,2,50,49,2,50,
+50,2,50,51,2,50,52,2,50,53,2,50,
+54,2,50,55,2,50,56,2,50,57,2,51,
+48,2,51,49,2,51,50,2,51,51,2,51,
+52,2,51,53,2,51,54,2,51,55,2,51,
+56,2,51,57,2,52,48,2,52,49,2,52,
+50,2,52,51,2,52,52,2,52,53,2,52,
+54,2,52,55,2,52,56,2,52,57,2,53,
+48,2,53,49,2,53,50,2,53,51,2,53,
+52,2,53,53,2,53,54,2,53,55,2,53,
+56,2,53,57,2,54,48,2,54,49,2,54,
+50,2,54,51,2,54,52,2,54,53,2,54,
+54,2,54,55,2,54,56,2,54,57,2,55,
+48,2,55,49,2,55,50,2,55,51,2,55,
+52,2,55,53,2,55,54,2,55,55,2,55,
+56,2,55,57,2,56,48,2,56,49,2,56,
+50,2,56,51,2,56,52,2,56,53,2,56,
+54,2,56,55,2,56,56,2,56,57,2,57,
+48,2,57,49,2,57,50,2,57,51,2,57,
+52,2,57,53,2,57,54,2,57,55,2,57,
+56,2,57,57,3,49,48,48,2,80,72,2,
+86,83,3,99,47,99,3,109,47,109,3,110,
+47,109,2,12373,12376,2,12373,12376,2,12450,12488,3,
+12454,12523,12471,3,12456,12463,12469,8,12458,12531,12464,12473,
+12488,12525,12540,12512,4,12458,12531,12488,12525,3,12459,12483,
+12503,6,12461,12525,12522,12483,12488,12523,4,12464,12473,12540,
+12512,5,12463,12523,12470,12540,12489,2,12487,12459,2,12486,
+12521,4,12489,12521,12463,12510,3,12496,12540,12484,4,12497,
+12473,12459,12523,3,12496,12524,12523,4,12501,12449,12521,12489,
+4,12501,12455,12512,12488,3,12504,12463,12488,7,12504,12463,
+12488,12497,12473,12459,12523,3,12506,12475,12479,2,12506,12479,
+3,12518,12540,12525,2,12521,12489,3,12523,12463,12473,3,
+12523,12500,12450,2,12450,12488,3,12454,12523,12471,3,12456,
+12463,12469,8,12458,12531,12464,12473,12488,12525,12540,12512,4,
+12458,12531,12488,12525,3,12459,12483,12503,6,12461,12525,12522,
+12484,12488,12523,4,12464,12473,12540,12512,5,12463,12523,12470,
+12495,12489,2,12487,12459,2,12486,12521,4,12489,12521,12463,
+12510,3,12496,12540,12484,4,12497,12473,12459,12523,3,12496,
+12524,12523,4,12501,12449,12521,12489,4,12501,12455,12512,12488,
+3,12504,12463,12488,7,12504,12463,12488,12497,12473,12459,12523,
+3,12506,12475,12479,2,12506,12479,3,12518,12540,12525,2,
+12521,12489,3,12523,12463,12473,3,12523,12500,12450,4,21307,
+30274,27861,20154,4,23398,26657,27861,20154,4,20849,21516,32068,
+21512,4,21332,21516,32068,21512,4,21512,36039,20250,31038,4,
+21512,21517,20250,31038,4,31038,22243,27861,20154,4,23447,25945,
+27861,20154,4,37109,20415,30058,21495,4,21307,30274,27861,20154,
+4,23398,26657,27861,20154,4,20849,21516,32068,21512,4,21332,
+21516,32068,21512,4,21512,36039,20250,31038,4,21512,21517,20250,
+31038,4,31038,22243,27861,20154,4,23447,25945,27861,20154,4,
+37109,20415,30058,21495,3,74,65,83,2,37326,29699,2,
+92,92,2,69,778,2,73,778,2,79,778,2,
+101,778,2,305,778,2,111,778,2,69,778,2,
+73,778,2,79,778,2,101,778,2,305,778,2,
+111,778,2,12363,12442,2,12365,12442,2,12367,12442,2,
+12369,12442,2,12371,12442,2,12459,12442,2,12461,12442,2,
+12463,12442,2,12465,12442,2,12467,12442,2,12475,12442,2,
+12484,12442,2,12488,12442,2,12791,12442,2,745,741,2,
+741,745,2,12363,12442,2,12365,12442,2,12367,12442,2,
+12369,12442,2,12371,12442,2,12459,12442,2,12461,12442,2,
+12463,12442,2,12465,12442,2,12467,12442,2,12475,12442,2,
+12484,12442,2,12488,12442,2,12791,12442,2,12363,12442,2,
+12365,12442,2,12367,12442,2,12369,12442,2,12371,12442,2,
+12459,12442,2,12461,12442,2,12463,12442,2,12465,12442,2,
+12467,12442,2,12475,12442,2,12484,12442,2,12488,12442,2,
+12791,12442,2,12791,12442,2,12363,12442,2,12365,12442,2,
+12367,12442,2,12369,12442,2,12371,12442,2,12459,12442,2,
+12461,12442,2,12463,12442,2,12465,12442,2,12467,12442,2,
+12475,12442,2,12484,12442,2,12488,12442,2,12791,12442,2,
+12363,12442,2,12365,12442,2,12367,12442,2,12369,12442,2,
+12371,12442,2,12459,12442,2,12461,12442,2,12463,12442,2,
+12465,12442,2,12467,12442,2,12475,12442,2,12484,12442,2,
+12488,12442,2,12791,12442,2,12363,12442,2,12365,12442,2,
+12367,12442,2,12369,12442,2,12371,12442,2,12459,12442,2,
+12461,12442,2,12463,12442,2,12465,12442,2,12467,12442,2,
+12475,12442,2,12484,12442,2,12488,12442,2,12791,12442,2,
+12791,12442,2,745,741,2,741,745,2,67,76,3,
+75,67,76,3,66,69,76,2,65,83,2,65,
+77,2,48,215,2,49,215,2,50,215,2,51,
+215,2,52,215,2,53,215,2,54,215,2,55,
+215,2,56,215,2,57,215,2,12411,12363,2,80,
+86,2,77,86,2,83,83,2,83,49,2,83,
+50,2,83,51,2,72,86,2,48,48,2,48,
+49,2,48,50,2,48,51,2,48,52,2,48,
+53,2,48,54,2,48,55,2,48,56,2,48,
+57,2,49,48,2,49,49,2,49,50,2,49,
+51,2,49,52,2,49,53,2,49,54,2,49,
+55,2,49,56,2,49,57,2,50,48,2,50,
+49,2,50,50,2,50,51,2,50,52,2,50,
+53,2,50,54,2,50,55,2,50,56,2,50,
+57,2,51,48,2,51,49,2,51,50,2,51,
+51,2,51,52,2,51,53,2,51,54,2,51,
+55,2,51,56,2,51,57,2,52,48,2,52,
+49,2,52,50,2,52,51,2,52,52,2,52,
+53,2,52,54,2,52,55,2,52,56,2,52,
+57,2,53,48,2,53,49,2,53,50,2,53,
+51,2,53,52,2,53,53,2,53,54,2,53,
+55,2,53,56,2,53,57,3,39,48,48,3,
+39,48,49,3,39,48,50,3,39,48,51,3,
+39,48,52,3,39,48,53,3,39,48,54,3,
+39,48,55,3,39,48,56,3,39,48,57,3,
+39,49,48,3,39,49,49,3,39,49,50,3,
+39,49,51,3,39,49,52,3,39,49,53,3,
+39,49,54,3,39,49,55,3,39,49,56,3,
+39,49,57,3,39,50,48,3,39,50,49,3,
+39,50,50,3,39,50,51,3,39,50,52,3,
+39,50,53,3,39,50,54,3,39,50,55,3,
+39,50,56,3,39,50,57,3,39,51,48,3,
+39,51,49,3,39,51,50,3,39,51,51,3,
+39,51,52,3,39,51,53,3,39,51,54,3,
+39,51,55,3,39,51,56,3,39,51,57,3,
+39,52,48,3,39,52,49,3,39,52,50,3,
+39,52,51,3,39,52,52,3,39,52,53,3,
+39,52,54,3,39,52,55,3,39,52,56,3,
+39,52,57,3,39,53,48,3,39,53,49,3,
+39,53,50,3,39,53,51,3,39,53,52,3,
+39,53,53,3,39,53,54,3,39,53,55,3,
+39,53,56,3,39,53,57,3,39,54,48,3,
+39,54,49,3,39,54,50,3,39,54,51,3,
+39,54,52,3,39,54,53,3,39,54,54,3,
+39,54,55,3,39,54,56,3,39,54,57,3,
+39,55,48,3,39,55,49,3,39,55,50,3,
+39,55,51,3,39,55,52,3,39,55,53,3,
+39,55,54,3,39,55,55,3,39,55,56,3,
+39,55,57,3,39,56,48,3,39,56,49,3,
+39,56,50,3,39,56,51,3,39,56,52,3,
+39,56,53,3,39,56,54,3,39,56,55,3,
+39,56,56,3,39,56,57,3,39,57,48,3,
+39,57,49,3,39,57,50,3,39,57,51,3,
+39,57,52,3,39,57,53,3,39,57,54,3,
+39,57,55,3,39,57,56,3,39,57,57,2,
+48,48,2,48,49,2,48,50,2,48,51,2,
+48,52,2,48,53,2,48,54,2,48,55,2,
+48,56,2,48,57,2,49,48,2,49,49,2,
+49,50,2,49,51,2,49,52,2,49,53,2,
+49,54,2,49,55,2,49,56,2,49,57,2,
+50,48,2,50,49,2,50,50,2,50,51,2,
+50,52,2,50,53,2,50,54,2,50,55,2,
+50,56,2,50,57,2,51,48,2,51,49,2,
+51,50,2,51,51,2,51,52,2,51,53,2,
+51,54,2,51,55,2,51,56,2,51,57,2,
+52,48,2,52,49,2,52,50,2,52,51,2,
+52,52,2,52,53,2,52,54,2,52,55,2,
+52,56,2,52,57,2,53,48,2,53,49,2,
+53,50,2,53,51,2,53,52,2,53,53,2,
+53,54,2,53,55,2,53,56,2,53,57,2,
+54,48,2,54,49,2,54,50,2,54,51,2,
+54,52,2,54,53,2,54,54,2,54,55,2,
+54,56,2,54,57,2,55,48,2,55,49,2,
+55,50,2,55,51,2,55,52,2,55,53,2,
+55,54,2,55,55,2,55,56,2,55,57,2,
+56,48,2,56,49,2,56,50,2,56,51,2,
+56,52,2,56,53,2,56,54,2,56,55,2,
+56,56,2,56,57,2,57,48,2,57,49,2,
+57,50,2,57,51,2,57,52,2,57,53,2,
+57,54,2,57,55,2,57,56,2,57,57,3,
+49,48,48,3,49,48,49,3,49,48,50,3,
+49,48,51,3,49,48,52,3,49,48,53,3,
+49,48,54,3,49,48,55,3,49,48,56,3,
+49,48,57,3,49,49,48,3,49,49,49,3,
+49,49,50,3,49,49,51,3,49,49,52,3,
+49,49,53,3,49,49,54,3,49,49,55,3,
+49,49,56,3,49,49,57,3,49,50,48,3,
+49,50,49,3,49,50,50,3,49,50,51,3,
+49,50,52,3,49,50,53,3,49,50,54,3,
+49,50,55,3,49,50,56,3,49,50,57,3,
+49,51,48,3,49,51,49,3,49,51,50,3,
+49,51,51,3,49,51,52,3,49,51,53,3,
+49,51,54,3,49,51,55,3,49,51,56,3,
+49,51,57,3,49,52,48,3,49,52,49,3,
+49,52,50,3,49,52,51,3,49,52,52,3,
+49,52,53,3,49,52,54,3,49,52,55,3,
+49,52,56,3,49,52,57,2,46,48,2,46,
+49,2,46,50,2,46,51,2,46,52,2,46,
+53,2,46,54,2,46,55,2,46,56,2,46,
+57,2,44,48,2,44,49,2,44,50,2,44,
+51,2,44,52,2,44,53,2,44,54,2,44,
+55,2,44,56,2,44,57,3,112,112,98,3,
+112,112,109,2,39,83,2,72,50,2,79,50,
+2,79,120,2,78,120,2,81,50,3,74,114,
+46,3,68,114,46,2,12460,12523,3,12464,12524,12452,
+4,12463,12525,12540,12490,5,12471,12540,12505,12523,12488,4,
+12471,12455,12465,12523,4,12472,12517,12540,12523,4,12487,12471,
+12505,12523,3,12489,12483,12488,3,12496,12452,12488,3,12499,
+12483,12488,4,12505,12463,12524,12523,2,12508,12540,3,12521,
+12531,12489,5,12522,12531,12462,12483,12488,2,12460,12523,3,
+12464,12524,12452,4,12463,12525,12540,12490,5,12471,12540,12505,
+12523,12488,4,12471,12455,12465,12523,4,12472,12517,12540,12523,
+4,12487,12471,12505,12523,3,12489,12483,12488,3,12496,12452,
+12488,3,12499,12483,12488,4,12505,12463,12524,12523,2,12508,
+12540,3,12521,12531,12489,5,12522,12531,12462,12483,12488,2,
+12290,12301,2,12290,12303,166,125,771,8217,92,8216,124,
+126,8260,402,167,164,8220,171,183,182,8226,8218,8222,
+8221,187,8230,8240,191,778,184,779,808,780,822,198,
+170,321,216,338,186,230,305,322,248,339,223,45,
+169,172,174,181,185,352,376,381,773,353,8482,382,
+48,12526,12459,12465,12532,12460,12462,12464,12466,12468,12470,12472,
+12474,12476,12478,12480,12482,12485,12487,12489,8242,168,8246,91,
+93,8210,65376,12434,12353,12355,12357,12359,12361,12419,12421,12423,
+12387,12354,12356,12358,12360,12365,12367,12369,12371,12373,12375,12377,
+12379,12381,12383,12385,12388,12390,12392,12402,12405,12408,12411,12420,
+12422,12431,12435,12430,12364,12366,12368,12370,12372,12374,12392,12378,
+12380,12382,12384,12386,12389,12391,12393,196,249,233,237,223,
+231,199,209,241,243,250,161,191,189,214,220,228,
+235,239,246,220,226,234,238,244,252,224,233,9650,
+225,126,48,65292,65294,12539,65311,65281,180,65344,168,65342,
+8254,65343,12291,20189,12540,8213,8208,65295,65340,65374,8214,65372,
+8230,8229,65339,65341,65371,65373,65291,65293,177,215,247,65309,
+8800,65308,65310,8734,8756,9794,9792,176,8451,65509,65284,65285,
+65283,65286,65290,65312,167,9734,9733,9675,9679,9678,9671,9670,
+9633,9632,9651,9650,9661,9660,8251,12306,8594,8595,12307,8712,
+8715,8746,8745,172,8658,8660,8704,8707,8736,8869,8978,8706,
+8711,8801,8786,8730,8765,8733,8757,8491,8240,9839,9837,9834,
+182,9711,20124,21782,23043,38463,21696,24859,25384,23030,36898,33909,
+33564,31312,24746,25569,28197,26093,33894,33446,39925,26771,22311,26017,
+25201,23451,22992,34427,39156,32098,32190,39822,25110,31903,34999,23433,
+24245,25353,26263,26696,38343,38797,26447,20197,20234,20301,20381,20553,
+22258,22839,22996,23041,23561,24799,24847,24944,26131,26885,28858,30031,
+30064,31227,32173,32239,32963,33806,34915,35586,36949,36986,21307,20117,
+20133,22495,32946,37057,30959,19968,22769,28322,36920,31282,33576,33419,
+39983,20801,21360,21693,21729,22240,23035,24341,39154,28139,32996,34093,
+38498,38512,38560,38907,21515,21491,23431,28879,32701,36802,38632,21359,
+40284,31418,19985,30867,33276,28198,22040,21764,27421,34074,39995,23013,
+21417,28006,29916,38287,22082,20113,36939,38642,33615,39180,21473,21942,
+23344,24433,26144,26355,26628,27704,27891,27945,29787,30408,31310,38964,
+33521,34907,35424,37613,28082,30123,30410,39365,24742,35585,36234,38322,
+27022,21421,20870,22290,22576,22852,23476,24310,24616,25513,25588,27839,
+28436,28814,28948,29017,29141,29503,32257,33398,33489,34199,36960,37467,
+40219,22633,26044,27738,29989,20985,22830,22885,24448,24540,25276,26106,
+27178,27431,27572,29579,32705,35158,40236,40206,40644,23713,27798,33659,
+20740,23627,25014,33222,26742,29281,20057,20474,21368,24681,28201,31311,
+38899,19979,21270,20206,20309,20285,20385,20339,21152,21487,22025,22799,
+23233,23478,23521,31185,26247,26524,26550,27468,27827,28779,29634,31117,
+31166,31292,31623,33457,33499,33540,33655,33775,33747,34662,35506,22057,
+36008,36838,36942,38686,34442,20420,23784,25105,29273,30011,33253,33469,
+34558,36032,38597,39187,39381,20171,20250,35299,22238,22602,22730,24315,
+24555,24618,24724,24674,25040,25106,25296,25913,39745,26214,26800,28023,
+28784,30028,30342,32117,33445,34809,38283,38542,35997,20977,21182,22806,
+21683,23475,23830,24936,27010,28079,30861,33995,34903,35442,37799,39608,
+28012,39336,34521,22435,26623,34510,37390,21123,22151,21508,24275,25313,
+25785,26684,26680,27579,29554,30906,31339,35226,35282,36203,36611,37101,
+38307,38548,38761,23398,23731,27005,25499,31520,27179,27263,26806,39949,
+28511,21106,21917,24688,25324,27963,28167,28369,33883,35088,36676,19988,
+39993,21494,26907,27194,38788,26666,20828,31427,33970,37340,37772,22107,
+40232,26658,33541,33841,31909,21000,33477,29926,20094,20355,20896,23506,
+21002,21208,21223,24059,21914,22570,23014,23436,23448,23515,24178,24185,
+24739,24863,24931,25022,25563,25954,26577,26707,26874,27454,27475,27735,
+28450,28567,28485,29872,29976,30435,30475,31487,31649,31777,32233,32566,
+32752,32925,33382,33694,35251,35532,36011,36996,37969,38291,38289,38306,
+38501,38867,39208,33304,20024,21547,23736,24012,29609,30284,30524,23721,
+32747,36107,38593,38929,38996,39000,20225,20238,21361,21916,22120,22522,
+22855,23305,23492,23696,24076,24190,24524,25582,26426,26071,26082,26399,
+26827,26820,27231,24112,27589,27671,27773,30079,31048,23395,31232,32000,
+24509,35215,35352,36020,36215,36556,36637,39138,39438,39740,20096,20605,
+20736,22931,23452,25135,25216,25836,27450,29344,30097,31047,32681,34811,
+35516,35696,25516,33738,38816,21513,21507,21931,26708,27224,35440,30759,
+26485,40653,21364,23458,33050,34384,36870,19992,20037,20167,20241,21450,
+21560,23470,24339,24613,25937,26429,27714,27762,27875,28792,29699,31350,
+31406,31496,32026,31998,32102,26087,29275,21435,23621,24040,25298,25312,
+25369,28192,34394,35377,36317,37624,28417,31142,39770,20136,20379,20384,
+20689,20807,31478,20849,20982,21332,21281,21375,21483,21932,22659,23777,
+24375,24394,24623,24656,24685,25375,25945,27211,27841,29378,29421,30703,
+33016,33029,33288,34126,37111,37857,38911,39255,39514,20208,20957,23597,
+26241,26989,23616,26354,26997,29577,26704,31873,20677,21220,22343,24062,
+37670,26020,27427,27453,29748,31105,31165,31563,32202,33465,33740,34943,
+35167,35641,36817,37329,21535,37504,20061,20534,21477,21306,29399,29590,
+30697,33510,36527,39366,39368,39378,20855,24858,34398,21936,31354,20598,
+23507,36935,38533,20018,27355,37351,23633,23624,25496,31391,27795,38772,
+36705,31402,29066,38536,31874,26647,32368,26705,37740,21234,21531,34219,
+35347,32676,36557,37089,21350,34952,31041,20418,20670,21009,20804,21843,
+22317,29674,22411,22865,24418,24452,24693,24950,24935,25001,25522,25658,
+25964,26223,26690,28179,30054,31293,31995,32076,32153,32331,32619,33550,
+33610,34509,35336,35427,35686,36605,38938,40335,33464,36814,39912,21127,
+25119,25731,28608,38553,26689,20625,27424,27770,28500,31348,32080,34880,
+35363,26376,20214,20537,20518,20581,20860,21048,21091,21927,22287,22533,
+23244,24314,25010,25080,25331,25458,26908,27177,29309,29356,29486,30740,
+30831,32121,30476,32937,35211,35609,36066,36562,36963,37749,38522,38997,
+39443,40568,20803,21407,21427,24187,24358,28187,28304,29572,29694,32067,
+33335,35328,35578,38480,20046,20491,21476,21628,22266,22993,23396,24049,
+24235,24359,25144,25925,26543,28246,29392,31946,34996,32929,32993,33776,
+34382,35463,36328,37431,38599,39015,40723,20116,20114,20237,21320,21577,
+21566,23087,24460,24481,24735,26791,27278,29786,30849,35486,35492,35703,
+37264,20062,39881,20132,20348,20399,20505,20502,20809,20844,21151,21177,
+21246,21402,21475,21521,21518,21897,22353,22434,22909,23380,23389,23439,
+24037,24039,24055,24184,24195,24218,24247,24344,24658,24908,25239,25304,
+25511,25915,26114,26179,26356,26477,26657,26775,27083,27743,27946,28009,
+28207,28317,30002,30343,30828,31295,31968,32005,32024,32094,32177,32789,
+32771,32943,32945,33108,33167,33322,33618,34892,34913,35611,36002,36092,
+37066,37237,37489,30783,37628,38308,38477,38917,39321,39640,40251,21083,
+21163,21495,21512,22741,25335,28640,35946,36703,40633,20811,21051,21578,
+22269,31296,37239,40288,40658,29508,28425,33136,29969,24573,24794,39592,
+29403,36796,27492,38915,20170,22256,22372,22718,23130,24680,25031,26127,
+26118,26681,26801,28151,30165,32058,33390,39746,20123,20304,21449,21766,
+23919,24038,24046,26619,27801,29811,30722,35408,37782,35039,22352,24231,
+25387,20661,20652,20877,26368,21705,22622,22971,23472,24425,25165,25505,
+26685,27507,28168,28797,37319,29312,30741,30758,31085,25998,32048,33756,
+35009,36617,38555,21092,22312,26448,32618,36001,20916,22338,38442,22586,
+27018,32948,21682,23822,22524,30869,40442,20316,21066,21643,25662,26152,
+26388,26613,31364,31574,32034,37679,26716,39853,31545,21273,20874,21047,
+23519,25334,25774,25830,26413,27578,34217,38609,30352,39894,25420,37638,
+39851,30399,26194,19977,20632,21442,23665,24808,25746,25955,26719,29158,
+29642,29987,31639,32386,34453,35715,36059,37240,39184,26028,26283,27531,
+20181,20180,20282,20351,21050,21496,21490,21987,22235,22763,22987,22985,
+23039,23376,23629,24066,24107,24535,24605,25351,25903,23388,26031,26045,
+26088,26525,27490,27515,27663,29509,31049,31169,31992,32025,32043,32930,
+33026,33267,35222,35422,35433,35430,35468,35566,36039,36060,38604,39164,
+27503,20107,20284,20365,20816,23383,23546,24904,25345,26178,27425,28363,
+27835,29246,29885,30164,30913,31034,32780,32819,33258,33940,36766,27728,
+40575,24335,35672,40235,31482,36600,23437,38635,19971,21489,22519,22833,
+23241,23460,24713,28287,28422,30142,36074,23455,34048,31712,20594,26612,
+33437,23649,34122,32286,33294,20889,23556,25448,36198,26012,29038,31038,
+32023,32773,35613,36554,36974,34503,37034,20511,21242,23610,26451,28796,
+29237,37196,37320,37675,33509,23490,24369,24825,20027,21462,23432,25163,
+26417,27530,29417,29664,31278,33131,36259,37202,39318,20754,21463,21610,
+23551,25480,27193,32172,38656,22234,21454,21608,23447,23601,24030,20462,
+24833,25342,27954,31168,31179,32066,32333,32722,33261,33311,33936,34886,
+35186,35728,36468,36655,36913,37195,37228,38598,37276,20160,20303,20805,
+21313,24467,25102,26580,27713,28171,29539,32294,37325,37507,21460,22809,
+23487,28113,31069,32302,31899,22654,29087,20986,34899,36848,20426,23803,
+26149,30636,31459,33308,39423,20934,24490,26092,26991,27529,28147,28310,
+28516,30462,32020,24033,36981,37255,38918,20966,21021,25152,26257,26329,
+28186,24246,32210,32626,26360,34223,34295,35576,21161,21465,22899,24207,
+24464,24661,37604,38500,20663,20767,21213,21280,21319,21484,21736,21830,
+21809,22039,22888,22974,23100,23477,23558,23567,23569,23578,24196,24202,
+24288,24432,25215,25220,25307,25484,25463,26119,26124,26157,26230,26494,
+26786,27167,27189,27836,28040,28169,28248,28988,28966,29031,30151,30465,
+30813,30977,31077,31216,31456,31505,31911,32057,32918,33750,33931,34121,
+34909,35059,35359,35388,35412,35443,35937,36062,37284,37478,37758,37912,
+38556,38808,19978,19976,19998,20055,20887,21104,22478,22580,22732,23330,
+24120,24773,25854,26465,26454,27972,29366,30067,31331,33976,35698,37304,
+37664,22065,22516,39166,25325,26893,27542,29165,32340,32887,33394,35302,
+39135,34645,36785,23611,20280,20449,20405,21767,23072,23517,23529,24515,
+24910,25391,26032,26187,26862,27035,28024,28145,30003,30137,30495,31070,
+31206,32051,33251,33455,34218,35242,35386,36523,36763,36914,37341,38663,
+20154,20161,20995,22645,22764,23563,29978,23613,33102,35338,36805,38499,
+38765,31525,35535,38920,37218,22259,21416,36887,21561,22402,24101,25512,
+27700,28810,30561,31883,32736,34928,36930,37204,37648,37656,38543,29790,
+39620,23815,23913,25968,26530,36264,38619,25454,26441,26905,33733,38935,
+38592,35070,28548,25722,23544,19990,28716,30045,26159,20932,21046,21218,
+22995,24449,24615,25104,25919,25972,26143,26228,26866,26646,27491,28165,
+29298,29983,30427,31934,32854,22768,35069,35199,35488,35475,35531,36893,
+37266,38738,38745,25993,31246,33030,38587,24109,24796,25114,26021,26132,
+26512,30707,31309,31821,32318,33034,36012,36196,36321,36447,30889,20999,
+25305,25509,25666,25240,35373,31363,31680,35500,38634,32118,33292,34633,
+20185,20808,21315,21344,23459,23554,23574,24029,25126,25159,25776,26643,
+26676,27849,27973,27927,26579,28508,29006,29053,26059,31359,31661,32218,
+32330,32680,33146,33307,33337,34214,35438,36046,36341,36984,36983,37549,
+37521,38275,39854,21069,21892,28472,28982,20840,31109,32341,33203,31950,
+22092,22609,23720,25514,26366,26365,26970,29401,30095,30094,30990,31062,
+31199,31895,32032,32068,34311,35380,38459,36961,40736,20711,21109,21452,
+21474,20489,21930,22766,22863,29245,23435,23652,21277,24803,24819,25436,
+25475,25407,25531,25805,26089,26361,24035,27085,27133,28437,29157,20105,
+30185,30456,31379,31967,32207,32156,32865,33609,33624,33900,33980,34299,
+35013,36208,36865,36973,37783,38684,39442,20687,22679,24974,33235,34101,
+36104,36896,20419,20596,21063,21363,24687,25417,26463,28204,36275,36895,
+20439,23646,36042,26063,32154,21330,34966,20854,25539,23384,23403,23562,
+25613,26449,36956,20182,22810,22826,27760,35409,21822,22549,22949,24816,
+25171,26561,33333,26965,38464,39364,39464,20307,22534,23550,32784,23729,
+24111,24453,24608,24907,25140,26367,27888,28382,32974,33151,33492,34955,
+36024,36864,36910,38538,40667,39899,20195,21488,22823,31532,37261,38988,
+40441,28381,28711,21331,21828,23429,25176,25246,25299,27810,28655,29730,
+35351,37944,28609,35582,33592,20967,34552,21482,21481,20294,36948,36784,
+22890,33073,24061,31466,36799,26842,35895,29432,40008,27197,35504,20025,
+21336,22022,22374,25285,25506,26086,27470,28129,28251,28845,30701,31471,
+31658,32187,32829,32966,34507,35477,37723,22243,22727,24382,26029,26262,
+27264,27573,30007,35527,20516,30693,22320,24347,24677,26234,27744,30196,
+31258,32622,33268,34584,36933,39347,31689,30044,31481,31569,33988,36880,
+31209,31378,33590,23265,30528,20013,20210,23449,24544,25277,26172,26609,
+27880,34411,34935,35387,37198,37619,39376,27159,28710,29482,33511,33879,
+36015,19969,20806,20939,21899,23541,24086,24115,24193,24340,24373,24427,
+24500,25074,25361,26274,26397,28526,29266,30010,30522,32884,33081,33144,
+34678,35519,35548,36229,36339,37530,38263,38914,40165,21189,25431,30452,
+26389,27784,29645,36035,37806,38515,27941,22684,26894,27084,36861,37786,
+30171,36890,22618,26626,25524,27131,20291,28460,26584,36795,34086,32180,
+37716,26943,28528,22378,22775,23340,32044,29226,21514,37347,40372,20141,
+20302,20572,20597,21059,35998,21576,22564,23450,24093,24213,24237,24311,
+24351,24716,25269,25402,25552,26799,27712,30855,31118,31243,32224,33351,
+35330,35558,36420,36883,37048,37165,37336,40718,27877,25688,25826,25973,
+28404,30340,31515,36969,37841,28346,21746,24505,25764,36685,36845,37444,
+20856,22635,22825,23637,24215,28155,32399,29980,36028,36578,39003,28857,
+20253,27583,28593,30000,38651,20814,21520,22581,22615,22956,23648,24466,
+26007,26460,28193,30331,33759,36077,36884,37117,37709,30757,30778,21162,
+24230,22303,22900,24594,20498,20826,20908,20941,20992,21776,22612,22616,
+22871,23445,23798,23947,24764,25237,25645,26481,26691,26812,26847,30423,
+28120,28271,28059,28783,29128,24403,30168,31095,31561,31572,31570,31958,
+32113,21040,33891,34153,34276,35342,35588,35910,36367,36867,36879,37913,
+38518,38957,39472,38360,20685,21205,21516,22530,23566,24999,25758,27934,
+30643,31461,33012,33796,36947,37509,23776,40199,21311,24471,24499,28060,
+29305,30563,31167,31716,27602,29420,35501,26627,27233,20984,31361,26932,
+23626,40182,33515,23493,37193,28702,22136,23663,24775,25958,27788,35930,
+36929,38931,21585,26311,37389,22856,37027,20869,20045,20970,34201,35598,
+28760,25466,37707,26978,39348,32260,30071,21335,26976,36575,38627,27741,
+20108,23612,24336,36841,21250,36049,32905,34425,24319,26085,20083,20837,
+22914,23615,38894,20219,22922,24525,35469,28641,31152,31074,23527,33905,
+29483,29105,24180,24565,25467,25754,29123,31896,20035,24316,20043,22492,
+22178,24745,28611,32013,33021,33075,33215,36786,35223,34468,24052,25226,
+25773,35207,26487,27874,27966,29750,30772,23110,32629,33453,39340,20467,
+24259,25309,25490,25943,26479,30403,29260,32972,32954,36649,37197,20493,
+22521,23186,26757,26995,29028,29437,36023,22770,36064,38506,36889,34687,
+31204,30695,33833,20271,21093,21338,25293,26575,27850,30333,31636,31893,
+33334,34180,36843,26333,28448,29190,32283,33707,39361,40614,20989,31665,
+30834,31672,32903,31560,27368,24161,32908,30033,30048,20843,37474,28300,
+30330,37271,39658,20240,32624,25244,31567,38309,40169,22138,22617,34532,
+38588,20276,21028,21322,21453,21467,24070,25644,26001,26495,27710,27726,
+29256,29359,29677,30036,32321,33324,34281,36009,31684,37318,29033,38930,
+39151,25405,26217,30058,30436,30928,34115,34542,21290,21329,21542,22915,
+24199,24444,24754,25161,25209,25259,26000,27604,27852,30130,30382,30865,
+31192,32203,32631,32933,34987,35513,36027,36991,38750,39131,27147,31800,
+20633,23614,24494,26503,27608,29749,30473,32654,40763,26570,31255,21305,
+30091,39661,24422,33181,33777,32920,24380,24517,30050,31558,36924,26727,
+23019,23195,32016,30334,35628,20469,24426,27161,27703,28418,29922,31080,
+34920,35413,35961,24287,25551,30149,31186,33495,37672,37618,33948,34541,
+39981,21697,24428,25996,27996,28693,36007,36051,38971,25935,29942,19981,
+20184,22496,22827,23142,23500,20904,24067,24220,24598,25206,25975,26023,
+26222,28014,29238,31526,33104,33178,33433,35676,36000,36070,36212,38428,
+38468,20398,25771,27494,33310,33889,34154,37096,23553,26963,39080,33914,
+34135,20239,21103,24489,24133,26381,31119,33145,35079,35206,28149,24343,
+25173,27832,20175,29289,39826,20998,21563,22132,22707,24996,25198,28954,
+22894,31881,31966,32027,38640,25991,32862,19993,20341,20853,22592,24163,
+24179,24330,26564,20006,34109,38281,38491,31859,38913,20731,22721,30294,
+30887,21029,30629,34065,31622,20559,22793,29255,31687,32232,36794,36820,
+36941,20415,21193,23081,24321,38829,20445,33303,37610,22275,25429,27497,
+29995,35036,36628,31298,21215,22675,24917,25098,26286,27597,31807,33769,
+20515,20472,21253,21574,22577,22857,23453,23792,23791,23849,24214,25265,
+25447,25918,26041,26379,27861,27873,28921,30770,32299,32990,33459,33804,
+34028,34562,35090,35370,35914,37030,37586,39165,40179,40300,20047,20129,
+20621,21078,22346,22952,24125,25151,26292,26395,26576,26834,20882,32033,
+32938,33192,35584,35980,36031,37502,38450,21536,38956,21271,20693,21340,
+22696,25778,26420,29287,30566,31302,37350,21187,27809,27526,22528,24140,
+22868,26412,32763,20961,30406,25705,30952,39764,40635,22475,22969,26151,
+26522,27598,21737,27097,24149,33180,26517,39850,26622,40018,26717,20134,
+20451,21448,25273,26411,27819,36804,20397,32365,40639,19975,24930,28288,
+28459,34067,21619,26410,39749,24051,31637,23724,23494,34588,28234,34001,
+31252,33032,22937,31885,27665,30496,21209,22818,28961,29279,30683,38695,
+40289,26891,23167,23064,20901,21517,21629,26126,30431,36855,37528,40180,
+23018,29277,28357,20813,26825,32191,32236,38754,40634,25720,27169,33538,
+22916,23391,27611,29467,30450,32178,32791,33945,20786,26408,40665,30446,
+26466,21247,39173,23588,25147,31870,36016,21839,24758,32011,38272,21249,
+20063,20918,22812,29242,32822,37326,24357,30690,21380,24441,32004,34220,
+35379,36493,38742,26611,34222,37971,24841,24840,27833,30290,35565,36664,
+21807,20305,20778,21191,21451,23461,24189,24736,24962,25558,26377,26586,
+28263,28044,30001,31056,35029,35480,36938,37009,37109,38596,34701,22805,
+20104,20313,19982,35465,36671,38928,20653,24188,22934,23481,24248,25562,
+25594,25793,26332,26954,27096,27915,28342,29076,29992,31407,32650,32768,
+33865,33993,35201,35617,36362,36965,38525,39178,24958,25233,27442,27779,
+28020,32716,32764,28096,32645,34746,35064,26469,33713,38972,38647,27931,
+32097,33853,37226,20081,21365,23888,27396,28651,34253,34349,35239,21033,
+21519,23653,26446,26792,29702,29827,30178,35023,35041,37324,38626,38520,
+24459,29575,31435,33870,25504,30053,21129,27969,28316,29705,30041,30827,
+31890,38534,31452,40845,20406,24942,26053,34396,20102,20142,20698,20001,
+20940,23534,26009,26753,28092,29471,30274,30637,31260,31975,33391,35538,
+36988,37327,38517,38936,21147,32209,20523,21400,26519,28107,29136,29747,
+33256,36650,38563,40023,40607,29792,22593,28057,32047,39006,20196,20278,
+20363,20919,21169,23994,24604,29618,31036,33491,37428,38583,38646,38666,
+40599,40802,26278,27508,21015,21155,28872,35010,24265,24651,24976,28451,
+29001,31806,32244,32879,34030,36899,37676,21570,39791,27347,28809,36034,
+36335,38706,21172,23105,24266,24324,26391,27004,27028,28010,28431,29282,
+29436,31725,32769,32894,34635,37070,20845,40595,31108,32907,37682,35542,
+20525,21644,35441,27498,36036,33031,24785,26528,40434,20121,20120,39952,
+35435,34241,34152,26880,28286,30871,33109,24332,19984,19989,20010,20017,
+20022,20028,20031,20034,20054,20056,20098,20101,35947,20106,33298,24333,
+20110,20130,20144,20147,20150,20174,20173,20164,20166,20162,20183,20190,
+20205,20191,20215,20233,20314,20272,20315,20317,20311,20295,20342,20360,
+20367,20376,20347,20329,20336,20369,20335,20358,20374,20760,20436,20447,
+20430,20440,20443,20433,20442,20432,20506,20520,20500,20522,20517,20485,
+20252,20470,20513,20521,20524,20478,20463,20497,20486,20547,20551,26371,
+20565,20560,20552,20570,20566,20588,20600,20608,20634,20613,20660,20658,
+20659,20674,20694,20702,20709,20717,20707,20718,20729,20725,20745,20758,
+20757,20756,20762,20769,20794,20791,20796,20795,20818,20812,20820,20834,
+31480,20846,20864,20866,22232,20876,20873,20879,20881,20883,20900,20902,
+20898,20912,20917,20925,20933,20937,20955,20960,34389,20969,20973,20976,
+20981,20990,20996,21003,21012,21006,21031,21034,21038,21043,21049,21071,
+21060,21086,21076,21098,21108,21097,21107,21119,21117,21133,21140,21138,
+21105,21128,21137,36776,36775,21180,21173,21185,21197,21207,21214,21219,
+21222,39149,21216,21235,21237,21254,21256,30008,21261,21264,21263,21269,
+21274,21283,21295,21297,21299,21304,21312,21318,21317,19991,21321,21325,
+20950,21342,21353,21358,22808,21371,21367,21378,21398,21408,21414,21413,
+21422,21424,21430,21443,31762,38617,21471,26364,29166,21486,21480,21485,
+21498,21505,21565,21568,21564,21550,21558,21545,21533,21582,21647,21621,
+21646,21599,21617,21623,21616,21650,21627,21632,21622,21636,21648,21638,
+21703,21666,21688,21669,21676,21700,21704,21672,21675,21698,21668,21694,
+21692,21720,21775,21780,21757,21742,21741,21754,21730,21817,21824,21859,
+21836,21806,21852,21829,21816,21811,21853,21913,21888,21679,21898,21919,
+21883,21886,21912,21918,21934,21884,21891,21929,21895,21928,21978,21957,
+21983,21956,21980,21988,21972,22036,22007,22038,22014,22013,22043,22009,
+22094,22096,29151,22068,22070,22066,22072,22123,22116,22063,22124,22122,
+22150,22144,22154,22176,22164,22159,22181,22190,22198,22196,22210,22204,
+22209,22211,22208,22216,22222,22225,22227,22231,22254,22265,22272,22271,
+22276,22281,22280,22283,22285,22291,22296,22294,21959,22300,22310,22350,
+22331,22336,22351,22377,22464,22408,22369,22399,22409,22419,22432,22451,
+22436,22442,22448,22467,22470,22484,22538,22486,22499,22539,22553,22557,
+22642,22561,22626,22603,22640,27584,22610,22589,22649,22661,22713,22687,
+22699,22714,22750,22715,22712,22702,22725,22739,22737,22743,22745,22744,
+22757,22748,22756,22751,22767,22778,22777,22786,22794,22800,22811,26790,
+22821,22834,22840,22846,31442,22869,22864,22862,22874,22872,22882,22880,
+22887,22892,22889,22904,22913,22941,20318,20395,22947,22962,22982,23016,
+23004,22925,23077,23071,23057,23068,23049,23066,23104,23148,23113,23138,
+23146,23194,23228,23230,23243,23234,23229,23267,23255,23270,23273,23254,
+23308,23307,23318,23346,23248,23338,23350,23358,23363,23365,23360,23377,
+23381,23397,23401,23408,23411,23413,23416,25992,23418,23424,23427,23462,
+23480,23491,23495,23497,23508,23504,23524,23526,23522,23518,23525,23531,
+23536,23542,23539,23557,23565,23571,23584,23586,23592,23617,23622,23630,
+23635,23632,23631,23409,23660,23662,20066,23670,23673,23692,23697,23700,
+22939,23723,23739,23734,23740,23735,23749,23742,23751,23769,23785,23805,
+23802,23789,23948,23786,23819,23829,23831,23900,23839,23835,23825,23828,
+23842,23834,23833,23832,23884,23890,23886,23883,23916,23923,23926,23943,
+23940,23938,23970,23965,23980,23982,23997,23952,23991,23996,24009,24013,
+24019,24018,24022,24027,24043,24050,24053,24075,24090,24089,24081,24091,
+24132,24131,24128,24142,24151,24148,24159,24162,24164,24135,24186,40636,
+24191,24224,24264,24272,24271,24278,24291,24285,24290,24289,24300,24305,
+24307,24304,24308,24312,24318,24323,24329,24413,24412,24331,24337,24342,
+24361,24365,24376,24385,24392,24396,24398,24367,24401,24409,24417,24429,
+24435,24439,24451,24450,24447,24458,24456,24465,24455,24478,24473,24472,
+24480,24488,24493,24508,24534,24571,24548,24568,24561,24541,24755,24575,
+24609,24672,24601,24592,24617,24590,24625,24603,24597,24619,24614,24591,
+24634,24666,24641,24682,24695,24671,24650,24646,24653,24675,24643,24676,
+24642,24684,24683,24665,24705,24717,24807,24707,24730,24708,24731,24722,
+24743,24715,24801,24760,24800,24787,24756,24560,24765,24774,24757,24792,
+24909,24853,24838,24832,24820,24826,24835,24865,24827,24817,24903,24894,
+24872,24871,24906,24895,24892,24876,24884,24893,24898,24900,24947,24951,
+24939,24948,24943,24933,24945,24927,24925,24915,24949,24985,24982,24967,
+25004,24980,24986,24970,24977,25003,25006,25036,25034,25033,25079,25032,
+25027,25030,25018,25035,32633,25037,25062,25059,25078,25082,25076,25087,
+25085,25084,25086,25088,25101,25100,25108,25115,25118,25121,25130,25134,
+25136,25153,25166,25182,25187,25179,25184,25192,25212,25218,25225,25214,
+25238,25300,25219,25236,25303,25297,25275,25295,25343,25286,25812,25288,
+25308,25292,25290,25282,25287,25243,25289,25356,25326,25329,25383,25346,
+25352,25327,25333,25424,25406,25421,25628,25423,25494,25486,25472,25515,
+25462,25507,25487,25481,25503,25525,25451,25449,25534,25577,25536,25542,
+25571,25545,25554,25590,25540,25622,25652,25606,25619,25638,25654,25885,
+25623,25640,25615,25703,25711,25718,25678,25898,25749,25747,25765,25769,
+25736,25788,25818,25810,25797,25799,25787,25816,25794,25841,25831,33289,
+25260,25827,25839,25900,25846,25844,25842,25850,25856,25853,25880,25884,
+25861,25892,25891,25899,25911,25910,25912,30027,25928,25942,25941,25933,
+25944,25950,25949,25970,25976,35722,26011,26015,26027,26039,26051,26054,
+26049,26052,26060,26066,26075,26073,26097,26482,26122,26115,26107,26483,
+26164,26140,26191,26180,26185,26177,26206,26205,26212,26207,26210,26224,
+26243,26248,26254,26249,26244,26264,26269,26305,26297,26313,26302,26300,
+26308,26296,26326,26330,26336,26175,26342,26345,26352,26357,26359,26383,
+26390,26398,38712,26414,26431,26422,26433,26424,26423,26438,26462,26464,
+26457,26505,26480,26537,26492,26474,26508,26507,26534,26529,26501,26551,
+26607,26548,26604,26547,26601,26552,26596,26590,26589,26594,26606,26553,
+26574,26566,26599,27292,26654,26694,26665,26688,26701,26674,26702,26803,
+26667,26713,26723,26743,26751,26783,26767,26797,26772,26781,26779,26755,
+27310,26809,26740,26805,26784,26810,26895,26765,26750,26881,26826,26888,
+26840,26914,26918,26849,26892,26829,26836,26855,26837,26934,26898,26884,
+26839,26851,26917,26873,26848,26863,26920,26922,26906,26915,26913,26822,
+27001,26999,26972,27000,26987,26964,27006,26990,26937,26996,26941,26969,
+26928,26977,26974,26973,27009,26986,27058,27054,27088,27071,27073,27091,
+27070,27086,23528,27082,27101,27067,27075,27047,27182,27025,27040,27036,
+27029,27060,27102,27112,27138,27163,27135,27402,27129,27122,27111,27141,
+27057,27166,27117,27156,27115,27146,27154,27329,27171,27155,27204,27148,
+27250,27190,27256,27207,27234,27225,27238,27208,27192,27170,27280,27277,
+27296,27268,27287,34327,27323,27331,27330,27320,27315,27308,27358,27345,
+27359,27306,27354,27370,27387,27397,34326,27386,27410,27414,39729,27423,
+27448,27447,30428,27449,39150,27463,27459,27465,27472,27481,27476,27483,
+27487,27489,27524,27523,27533,27544,27541,27550,27556,27567,27570,27569,
+27571,27575,27580,27590,27595,27603,27615,27628,27627,27635,27631,40638,
+27656,27675,27684,27683,27742,27733,27746,27754,27778,27789,27802,27777,
+27803,27774,27752,27763,27794,27792,27844,27889,27859,27837,27863,27845,
+27869,27822,27825,27838,27834,27867,27887,27865,27882,27935,34893,27958,
+27947,27965,27960,27929,27957,27955,27922,27916,28003,28051,28004,27994,
+28025,27993,28046,28053,28644,28037,28153,28181,28170,28085,28103,28134,
+28088,28102,28140,28126,28108,28136,28114,28101,28154,28121,28132,28117,
+28138,28142,28205,28270,28206,28185,28274,28255,28222,28195,28267,28203,
+28278,28237,28191,28227,28218,28238,28196,28415,28189,28216,28290,28330,
+28312,28361,28343,28371,28349,28335,28356,28338,28303,28325,28354,28319,
+28481,28433,28748,28396,28408,28414,28479,28402,28465,28399,28466,28364,
+28478,28435,28407,28550,28538,28536,28545,28544,28527,28507,28659,28525,
+28546,28540,28504,28558,28561,28610,28518,28595,28579,28577,28580,28601,
+28614,28586,28639,28629,28652,28628,28632,28657,28654,28635,28681,28683,
+28666,28689,28673,28687,28670,28699,28698,28532,28701,28696,28703,28720,
+28734,28722,28753,28771,28825,28818,28847,28913,28844,28856,28851,28846,
+28895,28875,28893,28889,28937,28925,28956,28953,29029,29013,29064,29030,
+29026,29004,29014,29036,29071,29179,29060,29077,29096,29100,29143,29113,
+29118,29138,29129,29140,29134,29152,29164,29159,29173,29180,29177,29183,
+29197,29200,29211,29224,29229,29228,29232,29234,29254,29259,29272,29300,
+29310,29314,29313,29319,29330,29334,29346,29351,29369,29362,29379,29382,
+29380,29390,29394,29410,29433,29431,20495,29463,29450,29468,29462,29469,
+29492,29487,29481,29477,29502,40664,29527,29546,29544,29552,29560,29557,
+29563,29562,29640,29619,29646,29627,29632,29669,29678,29662,29858,29701,
+29807,29733,29688,29746,29754,29781,29759,29791,29785,29761,29788,29801,
+29808,29795,29802,29814,29822,29835,29854,29863,29898,29903,29908,29681,
+29920,29923,29927,29929,29934,29938,29944,29943,29956,29955,29957,29964,
+29966,29965,29973,29971,29982,29990,29996,30012,30020,30029,30026,30025,
+30043,30022,30042,30057,30052,30055,30059,30061,30072,30070,30068,30090,
+30089,30082,30100,30106,30109,30117,30115,30146,30131,30147,30133,30141,
+30136,30140,30129,30157,30154,30162,30169,30179,30174,30204,30209,30192,
+30202,30219,30221,30217,30239,30247,30244,30260,30256,30267,30278,30300,
+30296,30311,30316,30320,30322,30326,30328,30332,30336,30339,30344,30347,
+30350,30358,30355,30384,30388,30402,30413,30422,30418,30430,30433,30437,
+30439,30442,34351,30459,30472,30471,30468,30505,30500,30494,30535,30554,
+30568,30571,30555,30565,30591,30590,30585,30606,30603,30609,30624,30622,
+30640,30646,30649,30655,30651,30663,30669,30679,30682,30684,30691,30702,
+30716,30732,30738,31014,30752,31018,30789,30862,30836,30854,30844,30874,
+30860,30883,30901,30890,30895,30929,30918,30923,30932,30910,30908,30917,
+30922,30956,30951,30938,30973,30964,30983,30994,30993,31001,31020,31019,
+31040,31072,31063,31071,31066,31061,31059,31098,31103,31114,31133,31143,
+40779,31146,31150,31155,31177,31189,31207,31212,31201,31203,31240,31245,
+31264,31263,31104,31281,31291,31294,31287,31299,31319,31305,31337,40861,
+31344,31353,31357,31368,31383,31381,31384,31382,31401,31432,31408,31414,
+31429,31428,31423,36995,31431,31434,31437,31439,31445,31443,31462,31469,
+31472,31490,31503,31498,31494,31539,31518,31541,31528,31542,31568,31610,
+31492,31565,31499,31564,31557,31605,31589,31604,31591,31596,31598,31645,
+31640,31647,31629,31644,31642,31627,31634,31631,31581,31641,31691,31681,
+31692,31695,31668,31686,31709,31721,31761,31764,31718,31717,31840,31744,
+31751,31763,31731,31735,31767,31757,31734,31779,31783,31786,31775,31799,
+31787,31805,31820,31811,31828,31823,31808,31824,31832,31839,31844,31830,
+31845,31852,31861,31875,31888,31908,31917,31906,31915,31905,31912,31923,
+31922,31921,31918,31929,31933,31936,31941,31938,31960,31954,31964,31970,
+39739,31983,31986,31988,31990,31994,32006,32002,32028,32021,32010,32069,
+32075,32046,32050,32063,32053,32070,32115,32086,32078,32114,32104,32110,
+32079,32099,32147,32137,32091,32143,32125,32155,32186,32174,32163,32181,
+32199,32189,32171,32317,32162,32175,32220,32184,32159,32176,32216,32221,
+32228,32222,32251,32242,32225,32261,32266,32291,32289,32274,32305,32287,
+32265,32267,32290,32326,32358,32315,32309,32313,32323,32311,32306,32314,
+32359,32349,32342,32350,32377,32362,32361,32380,32379,32387,32213,32381,
+36782,32383,32396,32402,32400,32406,32398,32568,32570,32581,32597,32596,
+32600,32615,32632,32642,32646,32643,32648,32647,32652,32660,32670,32669,
+32666,32675,32687,32690,32697,32686,32694,32696,35697,32714,32725,32724,
+32737,32742,32745,32755,32761,39132,32774,32772,32779,32786,32796,32801,
+32808,32831,32827,32842,32838,32850,32856,32858,32863,32866,32872,32883,
+32882,32880,32886,32889,32893,32895,32900,32902,32901,32923,32915,32922,
+32941,20880,32940,32987,32997,32985,32989,32964,32986,32982,33033,33007,
+33009,33051,33065,33059,33071,33099,38539,33094,33086,33107,33105,33020,
+33137,33134,33140,33155,33160,33162,33152,33154,33184,33173,33188,33187,
+33119,33171,33193,33200,33205,33214,33208,33213,33216,33218,33210,33225,
+33229,33233,33241,33240,33224,33242,33285,33287,33290,33293,33296,33302,
+33321,33323,33336,33331,33344,33369,33368,33373,33370,33375,33380,33378,
+33384,33326,33393,33406,33421,33426,33451,33439,33467,33452,33505,33507,
+33503,33490,33524,33523,33530,33683,33539,33531,33529,33502,33542,33500,
+33545,33497,33589,33588,33558,33586,33585,33600,33593,33616,33605,33583,
+33579,33669,33690,33706,33695,33698,33686,33571,33678,33671,33674,33660,
+33717,33651,33653,33696,33673,33704,33780,33811,33771,33742,33789,33795,
+33752,33803,33729,33783,33799,33760,33778,33805,33826,33824,33725,33848,
+34054,33787,33901,33834,33852,34138,33924,33911,33899,33965,33902,33922,
+33897,33862,33836,33903,33913,33845,33994,33890,33977,33983,33951,34009,
+33997,33979,34010,34000,33985,33990,34006,33953,34081,34047,34036,34092,
+34079,34069,34068,34044,34112,34147,34136,34120,34113,34306,34123,34133,
+34176,34212,34184,34193,34186,34216,34157,34196,34203,34282,34183,34204,
+34167,34174,34192,34249,34234,34255,34233,34256,34261,34269,34277,34268,
+34297,34314,34323,34315,34302,34298,34310,34338,34330,34352,34367,34381,
+20053,34388,34399,34407,34417,34451,34467,34486,34479,34500,34502,34480,
+34505,34851,34475,34516,34526,34537,34540,34527,34523,34543,34578,34566,
+34568,34560,34563,34555,34577,34569,34573,34553,34570,34612,34623,34615,
+34619,34597,34601,34586,34656,34655,34680,34636,34638,34676,34647,34664,
+34670,34649,34643,34659,34666,34821,34722,34719,34690,34735,34763,34749,
+34752,34768,38614,34731,34756,34739,34759,34758,34747,34799,34802,34784,
+34831,34829,34814,34830,34770,34833,34838,34837,34850,34849,34865,34870,
+34873,34855,34875,34884,34882,34898,34905,34910,34914,34923,34945,34942,
+34974,34933,34941,34997,34930,34946,34967,34962,34990,34969,34978,34957,
+34980,34992,35007,34993,35037,35065,35074,35068,35060,35048,35058,35076,
+35084,35082,35091,35139,35102,35109,35137,35140,35131,35126,35128,35148,
+35101,35168,35166,35174,35172,35181,35178,35183,35188,35191,35198,35203,
+35208,35210,35219,35224,35233,35241,35238,35244,35247,35250,35258,35261,
+35303,35316,35320,35331,35350,35344,35340,35355,35357,35365,35382,35393,
+35419,35410,35398,35400,35452,35437,35436,35426,35461,35458,35460,35496,
+35489,35473,35482,35491,35524,35533,35522,35546,35563,35571,35559,35556,
+35569,35604,35552,35554,35575,35550,35547,35596,35591,35610,35553,35606,
+35600,35607,35616,35635,38827,35622,35627,35646,35624,35649,35660,35663,
+35662,35657,35670,35675,35674,35691,35679,35692,35695,35700,35709,35712,
+35724,35726,35898,35905,35903,35912,35916,35918,35920,35925,35938,35948,
+35960,35962,35970,35977,35973,35978,35988,35964,35992,25117,36013,36010,
+36029,36014,36022,36040,36033,36068,36067,36058,36093,36106,36103,36111,
+36109,36112,40782,36115,36045,36116,36118,36199,36205,36209,36211,36225,
+36249,36290,36286,36282,36303,36314,36310,36300,36315,36299,36319,36323,
+36348,36368,36383,36418,36405,36400,36404,36426,36423,36425,36428,36432,
+36424,36441,36452,36448,36394,36451,36437,36470,36466,36476,36481,36487,
+36485,36484,36491,36490,36499,36497,36500,36505,36522,36513,36524,36528,
+36550,36529,36542,36549,36552,36555,36571,36579,36604,36603,36587,36606,
+36618,36613,36629,36626,36633,36627,36636,36639,36635,36620,36646,36659,
+36667,36665,36677,36674,36670,36684,36681,36678,36686,36695,36700,36764,
+36767,36771,36781,36783,36791,36826,36837,36834,36842,36847,36999,36852,
+36869,36881,36885,36897,36877,36894,36886,36875,36903,36918,36917,36921,
+36856,36878,36937,36926,36950,36952,36958,36968,36975,36982,38568,36978,
+36994,36989,36993,36992,37002,37001,37007,37032,37039,37041,37045,37090,
+37092,25160,37083,37122,37138,37145,37170,37168,37194,37206,37208,37219,
+37221,37225,37235,37234,37259,37257,37250,37282,37291,37295,37290,37301,
+37300,37306,37321,37323,37328,37334,37343,37345,37339,37372,37406,37375,
+37396,37420,37397,37393,37470,37463,37445,37449,37476,37448,37525,37439,
+37451,37456,37532,37526,37523,37531,37466,37583,37561,37559,37609,37647,
+37626,37700,37678,37657,37666,37658,37667,37690,37685,37691,37724,37728,
+37756,37742,37718,37808,37780,37817,37864,37861,37848,37827,37853,37840,
+37832,37860,37914,37908,37907,37891,37895,37904,37942,37931,37941,37921,
+37946,37953,37970,37956,37979,37984,37986,37982,37994,37417,38000,38005,
+38007,38013,37978,38012,38014,38017,38015,38274,38279,38282,38292,38294,
+38304,38312,38311,38317,38332,38331,38329,38334,38346,28662,38339,38349,
+38348,38357,38356,38358,38364,38369,38373,38370,38433,38440,38466,38476,
+38479,38475,38519,38492,38494,38493,38495,38502,38514,38508,38541,38552,
+38549,38551,38570,38567,38576,38580,38582,38606,38603,38601,38605,35149,
+38620,38669,38613,38649,38660,38662,38664,38675,38670,38673,38671,38678,
+38681,38692,38698,38704,38713,38724,38726,38728,38722,38729,38748,38752,
+38756,38758,38760,21202,38763,38769,38777,38789,38780,38785,38778,38790,
+38795,38812,38824,38822,38819,38851,38854,38856,38859,38876,38893,40783,
+38898,31455,38902,38901,38927,38924,38968,38948,38945,38967,38973,38982,
+38991,38987,39019,39028,39027,39082,39087,39089,39094,39108,39107,39110,
+39145,39147,39171,39177,39186,39188,39192,39201,39204,39200,39212,39214,
+39234,39241,39237,39248,39243,39244,39253,39356,39391,39387,39389,39384,
+39377,39419,39416,39425,39439,39429,39394,39449,39467,39479,39493,39490,
+39488,39491,39486,39509,39501,39515,39511,39519,39522,39525,39524,39529,
+39531,39530,39597,39600,39612,39616,39631,39633,39654,39663,39659,39662,
+39668,39665,39671,39675,39686,39704,39706,39711,39730,39748,39747,39759,
+39761,39768,39796,39827,39811,39825,39848,39860,39872,39882,39865,39878,
+39887,39907,39906,39908,39892,39905,39994,39922,39921,39920,39957,39956,
+39945,39955,39948,39942,39944,39954,39946,39940,39982,39963,39973,39972,
+39969,39984,40007,39986,40006,39998,40026,40032,40039,40054,40056,40167,
+40172,40176,40201,40200,40171,40195,40198,40234,40230,40367,40227,40223,
+40260,40213,40210,40257,40255,40254,40262,40264,40292,40273,40272,40281,
+40306,40329,40327,40363,40303,40314,40346,40356,40361,40370,40388,40385,
+40379,40376,40378,40390,40399,40386,40409,40403,40440,40422,40429,40431,
+40445,40478,40565,40569,40573,40577,40584,40594,40597,40593,40605,40613,
+40617,40632,40618,40621,38753,40652,40660,40668,40670,40669,40672,40677,
+40680,40687,40692,30391,40725,40737,40748,40766,40778,40786,40788,40803,
+40812,40810,40823,40818,40822,40853,40860,40864,22575,27079,36953,29796,
+9794,13129,13076,13090,13133,13080,13095,13059,13110,13137,13143,13069,
+13094,13091,13099,13130,13115,13252,13217,12317,12319,8470,13261,8481,
+12857,13182,13181,13180,8750,8721,8730,8869,8736,8735,8895,21854,
+39156,28322,39983,28139,36802,27421,21417,22082,39180,28976,35158,40407,
+36838,24674,25296,26214,64054,33883,38788,22169,15694,32752,32747,24509,
+31047,20448,21375,20677,36544,21936,23633,38772,31041,24935,32363,33606,
+20518,23244,25458,40572,35578,24055,26171,28317,40628,40288,29969,37319,
+27018,26629,34217,39894,37638,29642,21489,23650,36974,28796,32353,37195,
+26329,64070,34223,34295,21736,24288,26786,34083,37292,38808,34645,38765,
+36887,32736,25722,36893,34796,25776,26643,29006,29053,35438,22092,36961,
+21109,25620,30185,36956,39506,33151,40667,21828,28655,64074,34552,36799,
+26842,40008,27197,31774,35387,28710,20939,25431,27084,37786,64016,25681,
+37165,25826,63980,22625,39002,22581,33759,36077,22616,31153,40199,28678,
+28702,22136,36929,38931,37027,35598,28760,26978,31152,22218,29260,36889,
+31204,21085,31672,28497,37297,25405,25161,27147,26570,31255,36924,23195,
+35628,24287,28693,64106,34109,30629,23081,24214,27873,34028,38960,40018,
+40629,20786,39173,31870,37971,24840,30290,29495,29076,32768,33802,63939,
+63897,27028,34847,21817,21811,21988,22066,22181,22539,23230,23643,24164,
+24727,25449,25606,25890,25987,26534,26618,26779,26766,28270,29646,29956,
+29965,29973,30355,30844,31281,40861,31641,31888,31918,32155,32174,32159,
+32724,33326,33421,33490,33571,33653,34071,34110,34690,34770,35082,35247,
+35550,35649,36314,36361,36627,36842,36999,36952,25160,37313,38331,30562,
+38692,38752,38769,38948,39726,39831,39922,40618,40860,8254,65343,12540,
+8213,8208,12316,8214,65372,8230,8229,65371,65373,65309,12353,12355,
+12357,12359,12361,12387,12419,12421,12423,12430,12449,12451,12453,12455,
+12457,12483,12515,12517,12519,12526,13129,13076,13090,13133,13080,13095,
+13059,13110,13137,13143,13069,13094,13091,13099,13130,13115,33446,33576,
+22099,21417,29273,27762,31496,39255,25331,39184,38765,29053,31359,31661,
+25539,33759,31074,21467,31687,36804,31806,20682,21269,21929,22190,22553,
+22811,23592,24272,24271,25153,26305,27656,28195,28396,31383,31709,32745,
+33826,34649,34830,34770,39449,40621,65508,65287,65282,4520,9665,9655,
+8681,8679,8678,8680,9634,9831,9825,9828,9826,13216,13218,13207,
+8467,13208,13235,13234,13233,13232,13259,13200,13268,13206,13090,13078,
+13080,13077,13059,13091,13143,13122,13113,13115,13056,13105,13127,13086,
+13098,13261,13183,8481,9742,12342,12320,169,174,12867,12861,12863,
+12852,12856,12851,12860,12866,12862,12854,12853,12859,12864,12858,12976,
+12973,12969,12975,12948,12970,12952,12971,12946,12945,12947,12972,12974,
+12950,9129,9128,9127,65080,9133,9132,9131,65080,65080,13260,13061,
+189,188,13215,13219,13222,13256,8749,21360,12848,12855,12865,10145,
+9673,9824,9829,9827,9830,9759,12953,9450,65296,65296,12288,9615,
+9614,9613,9612,9611,9610,9609,9584,9583,9552,9566,9578,9569,
+9701,9700,9679,3792,36898,36795,65292,176,12307,12444,12443,8242,
+65294,8220,8222,8216,8218,8243,20956,29081,8575,8458,8457,8507,
+12292,8646,22823,23567,12957,25511,13179,13183,13107,13134,13090,13078,
+13061,13061,13061,13107,13134,13134,13134,13059,13080,13077,13113,13113,
+13113,13143,13122,13122,13122,13091,13115,13056,13086,13086,13086,13098,
+13098,13098,13127,13105,32394,35100,37704,37512,34012,20425,28859,26161,
+26824,37625,26363,24389,20008,20193,20220,20224,20227,20281,20310,20370,
+20362,20378,20372,20429,20544,20514,20479,20510,20550,20592,20546,20628,
+20724,20696,20810,20836,20893,20926,20972,21013,21148,21158,21184,21211,
+21248,21255,21284,21362,21395,21426,21469,64014,21660,21642,21673,21759,
+21894,22361,22373,22444,22472,22471,64015,22618,22686,22706,22795,22867,
+22875,22877,22883,22948,22970,23382,23488,29999,23512,23515,23582,23718,
+23738,23797,23847,23891,64017,23874,23917,24016,24353,24372,24423,24503,
+24542,24669,24709,24714,24798,24789,24864,24818,24849,24887,24880,24984,
+25107,25254,25589,25696,25757,25806,25934,26112,26133,26121,26158,26142,
+26148,26213,26199,26201,64018,26227,26265,26272,26290,26303,26362,26382,
+26391,26470,26555,26706,26560,26625,26692,26831,64019,26984,64020,27032,
+27106,27184,27243,27206,27251,27262,27362,27364,27606,27711,27740,27782,
+27759,27866,27908,28039,28015,28054,28076,28111,28152,28146,28156,28217,
+28252,28199,28220,28351,28552,28597,28661,28677,28679,28712,28805,28843,
+28943,28932,29020,29121,29182,29361,29374,29476,64022,29559,29629,29641,
+29654,29667,29650,29703,29685,29734,29738,29737,29742,29794,29833,29855,
+29953,30063,30338,30364,30366,30363,30374,64023,30534,21167,30753,30798,
+30820,30842,31024,31124,64027,31131,31441,31463,64028,31467,31646,64029,
+32072,32092,32183,32160,32214,32338,32583,32673,64030,33537,33634,33663,
+33735,33782,33864,33972,34131,34137,34155,64031,34224,34823,35061,35346,
+35383,35449,35495,35518,35551,64034,35574,35667,35711,36080,36084,36114,
+36214,64035,36559,36967,37086,64038,37141,37159,37338,37335,37342,37382,
+37392,37386,37434,37440,37436,37454,37465,37457,37433,37479,37543,37607,
+37591,37593,37584,64039,37589,37600,37587,37669,37665,37627,64040,37662,
+37631,37661,37634,37744,37719,37796,37830,37854,37880,37937,37957,37960,
+38290,38534,64041,38557,38575,38707,38715,38723,38733,38735,38737,38741,
+38999,39013,39207,64044,39326,39502,39641,39644,39797,39794,39823,39857,
+39867,39936,40304,40299,64045,40473,40657,172,92,166,125,771,
+8217,92,8216,124,126,8260,402,167,164,8220,171,183,
+182,8226,8218,8222,8221,187,8230,8240,191,778,184,779,
+808,780,822,198,170,321,216,338,186,230,305,322,
+248,339,223,45,169,172,174,181,185,352,376,381,
+773,353,8482,382,48,8194,8254,65344,8242,168,8246,196,
+249,233,237,223,231,199,209,241,243,250,161,191,
+189,214,220,228,235,239,246,220,226,234,238,244,
+252,224,233,225,126,48,172,92,12526,12459,12465,12532,
+12460,12462,12464,12466,12468,12470,12472,12474,12476,12478,12480,12482,
+12485,12487,12489,65376,12434,12353,12355,12357,12359,12361,12419,12421,
+12423,12387,12354,12356,12358,12360,12365,12367,12369,12371,12373,12375,
+12377,12379,12381,12383,12385,12388,12390,12392,12402,12405,12408,12411,
+12420,12422,12431,12435,12430,12364,12366,12368,12370,12372,12374,12392,
+12378,12380,12382,12384,12386,12389,12391,12393,91,93,8210,65376,
+9650,8364,8486,257,299,363,275,333,256,298,362,274,
+332,461,282,7868,463,296,465,467,366,360,462,283,
+7869,464,297,466,468,367,361,593,8049,8048,509,230,
+596,596,596,601,601,8051,8050,567,331,629,652,652,
+652,658,643,720,166,125,771,8217,92,8216,124,126,
+8260,402,167,164,8220,171,183,182,8226,8218,8222,8221,
+187,8230,8240,191,778,184,779,808,780,822,198,170,
+321,216,338,186,230,305,322,248,339,223,45,169,
+172,174,181,185,352,376,381,773,353,8482,382,48,
+8364,8486,257,299,363,275,333,256,298,362,274,332,
+461,282,7868,463,296,465,467,366,360,462,283,7869,
+464,297,466,468,367,361,822,45,61,44,822,45,
+61,44,183,8364,48,8547,12354,12356,12358,12360,12365,12367,
+12369,12371,12373,12375,12377,12379,12381,12383,12385,12388,12390,12392,
+12402,12405,12408,12411,12420,12422,12450,12452,12454,12456,12461,12463,
+12465,12467,12469,12471,12473,12475,12477,12479,12481,12484,12486,12488,
+12498,12501,12504,12507,12516,12518,21942,21512,27883,21839,31572,20363,
+12387,25165,12295,19968,20108,19977,22235,20116,20845,19971,20843,20061,
+21313,12295,19968,20108,19977,22235,20116,20845,19971,20843,20061,21313,
+12295,19968,20108,19977,22235,20116,20845,19971,20843,20061,12388,25165,
+19968,20108,19977,22235,20116,20845,19971,20843,20061,21313,12295,19968,
+20108,19977,22235,20116,20845,19971,20843,20061,21313,12467,12387,12483,
+12457,12354,12356,12358,12360,12365,12367,12369,12371,12373,12375,12377,
+12379,12381,12383,12385,12388,12390,12392,12402,12405,12408,12411,12420,
+12422,35519,12959,21103,28187,27161,27424,22522,31105,12955,12954,12963,
+12962,12951,20986,12956,12949,28168,22679,21839,31572,20363,38651,9676,
+9471,12354,12356,12358,12360,12365,12367,12369,12371,12373,12375,12377,
+12379,12381,12383,12385,12388,12390,12392,12402,12405,12408,12411,12420,
+12422,12450,12452,12454,12456,12461,12463,12465,12467,12469,12471,12473,
+12475,12477,12479,12481,12484,12486,12488,12498,12501,12504,12507,12516,
+12518,26085,26376,28779,27700,26408,37329,22303,21839,31572,20363,9679,
+48,12354,12356,12358,12360,12365,12367,12369,12371,12373,12375,12377,
+12379,12381,12383,12385,12388,12390,12392,12402,12405,12408,12411,12420,
+12422,12450,12452,12454,12456,12461,12463,12465,12467,12469,12471,12473,
+12475,12477,12479,12481,12484,12486,12488,12498,12501,12504,12507,12516,
+12518,26085,26376,28779,27700,26408,37329,22303,36000,21213,21839,31572,
+20363,8414,9633,48,12354,12356,12358,12360,12365,12367,12369,12371,
+12373,12375,12377,12379,12381,12383,12385,12388,12390,12392,12402,12405,
+12408,12411,12420,12422,12450,12452,12454,12456,12461,12463,12465,12467,
+12469,12471,12473,12475,12477,12479,12481,12484,12486,12488,12498,12501,
+12504,12507,12516,12518,26085,26376,28779,27700,26408,37329,22303,21839,
+31572,20363,9632,48,12354,12356,12358,12360,12365,12367,12369,12371,
+12373,12375,12377,12379,12381,12383,12385,12388,12390,12392,12402,12405,
+12408,12411,12420,12422,12450,12452,12454,12456,12461,12463,12465,12467,
+12469,12471,12473,12475,12477,12479,12481,12484,12486,12488,12498,12501,
+12504,12507,12516,12518,26085,26376,28779,27700,26408,37329,22303,21839,
+31572,20363,48,12354,12356,12358,12360,12365,12367,12369,12371,12373,
+12375,12377,12379,12381,12383,12385,12388,12390,12392,12402,12405,12408,
+12411,12420,12422,12450,12452,12454,12456,12461,12463,12465,12467,12469,
+12471,12473,12475,12477,12479,12481,12484,12486,12488,12498,12501,12504,
+12507,12516,12518,26085,26376,28779,27700,26408,37329,22303,21839,31572,
+20363,9632,13250,13261,8470,13272,13274,8448,13250,13252,8453,13207,
+13169,13208,8467,13197,13211,13206,13060,13062,13063,13066,13112,13114,
+13117,13121,13138,13140,13060,13062,13063,13066,13112,13114,13117,13121,
+13138,13140,13182,13181,13180,13179,45,61,8451,9792,9794,12307,
+12306,39,34,8501,976,8714,8463,181,981,987,977,9836,
+65306,169,169,174,174,12347,12347,8252,8265,33,8252,8265,
+9290,8723,8800,8771,9120,9117,9115,9120,9118,9121,9126,9123,
+9121,9126,9124,9121,9126,9123,9121,9126,9124,65372,8213,9986,
+9986,9986,9986,12349,12306,12447,21325,8711,8709,8864,8854,8856,
+8853,8855,8862,8853,9888,9651,9664,9654,8678,8680,8679,8681,
+8656,8596,8652,8651,8592,8594,8593,9476,9478,12336,8967,12336,
+8967,12336,8967,12336,8967,12336,8967,10048,10047,9633,9633,9633,
+9633,9633,9643,9632,9642,10010,10010,9671,9671,9671,9671,9671,
+9670,9670,9678,9673,9675,9702,9679,8226,10070,10070,10070,10070,
+12371,12371,12467,12467,12539,65290,8251,9675,9678,9673,9651,9650,
+12353,12355,12357,12359,12361,12363,12369,12387,12419,12421,12423,12430,
+12449,12451,12453,12455,12457,12483,12515,12517,12519,12526,12540,12540,
+27880,8364,8486,257,299,363,275,333,256,298,362,274,
+332,461,282,7868,463,296,465,467,366,360,462,283,
+7869,464,297,466,468,367,361,593,593,593,509,230,
+596,596,596,601,601,603,603,106,331,629,652,652,
+652,658,643,720,166,125,771,8217,92,8216,124,126,
+8260,402,167,164,8220,171,183,182,8226,8218,8222,8221,
+187,8230,8240,191,778,184,779,808,780,822,198,170,
+321,216,338,186,230,305,322,248,339,223,45,169,
+172,174,181,185,352,376,381,773,353,8482,382,48,
+8364,8486,257,299,363,275,333,256,298,362,274,332,
+461,282,7868,463,296,465,467,366,360,462,283,7869,
+464,297,466,468,367,361,822,45,61,44,822,45,
+61,44,183,45,61,8451,9792,9794,12307,12306,39,34,
+64103,64098,32227,40643,28331,64082,64061,64069,64062,27114,28212,64096,
+64071,64056,64066,64078,34395,64105,64052,64099,25581,25802,30799,64084,
+63856,64077,64097,64072,64076,64081,64067,64090,28041,29376,24910,64086,
+64080,64049,64059,24034,64063,64101,21373,64055,64095,24501,64064,37806,
+64083,39725,64085,64104,64068,64089,26202,64053,64075,64100,64065,64048,
+20341,64057,64051,27493,64058,27599,64050,25150,64079,63773,63964,63798,
+28122,63952,26310,27511,64087,37706,24266,37636,27010,20916,25420,34523,
+37001,36898,20553,32239,36949,21417,39180,34907,24310,27839,37467,32705,
+33469,38597,23475,24936,27010,27579,25954,36011,24012,38929,24112,36556,
+31406,22343,20625,31348,20581,24314,37431,27278,20132,20844,26356,26657,
+30828,32094,32771,36092,38477,25335,32618,20351,21490,22985,35613,37034,
+21454,36655,26580,30636,33308,26991,26494,35359,19976,22516,26893,32887,
+35242,36930,25454,25666,33337,32207,32865,20687,35477,24677,20806,30522,
+32884,36339,24237,24311,33351,26691,36867,27966,25490,36649,29677,38930,
+24754,25161,26000,32203,35513,36007,29238,33914,20998,22132,24996,31881,
+32027,38640,34109,20415,25447,30406,26717,33032,32822,32764,21519,38563,
+40607,40599,32879,32894,28286,20613,20883,20955,21312,38617,21929,22209,
+22285,22699,23002,23094,23230,23886,23943,24009,24019,24365,24472,24792,
+24893,25086,25192,25295,25885,25615,25842,25949,26207,26537,26599,26987,
+26928,27047,27204,27280,27656,27667,28195,28433,28414,28478,29183,29669,
+29746,29791,29920,29964,30322,31018,30932,31162,31257,31381,31986,32115,
+32221,32309,32686,32737,32858,32863,32883,32880,32886,33107,33162,33205,
+33229,33778,34133,34261,34586,34870,34974,35032,35060,35115,35131,35178,
+35183,35357,36101,36111,40782,36497,36513,36946,36878,37168,37206,37208,
+37221,37235,37234,37282,37295,37290,37300,37306,38007,38552,38717,38752,
+38769,38924,39027,39107,39493,39757,39768,39878,39905,39921,40264,40399,
+40712,25201,26263,24847,34915,36949,36986,30959,35999,11991,11965,24272,
+29916,36939,39180,34910,37555,38321,24310,25588,29017,36960,37467,26044,
+24448,32705,21368,38899,21270,33457,33747,36008,36942,38597,39187,24315,
+28784,23475,24936,24936,24936,27010,26478,11974,38548,36676,37772,33477,
+23506,29872,32233,32566,36996,38290,38867,33304,21361,13314,13314,13314,
+24190,26083,26399,27231,36215,39138,21931,34384,36870,21450,21560,24613,
+32026,24040,25298,36317,24378,24656,27073,37111,38911,39255,26241,11945,
+36817,20465,30697,20855,34398,31354,36935,27355,21843,63753,24693,24935,
+36814,20625,28500,31348,26376,11964,20860,21048,26435,32937,35609,36963,
+35329,25142,38599,39015,21555,23067,35492,24037,24908,25221,25511,27083,
+28207,32789,33108,33618,35611,36092,21567,37239,33136,29969,36796,20170,
+37782,24231,24425,25505,27506,33756,20916,21682,21066,29986,19256,23039,
+23039,24063,35566,35566,36039,36039,27425,27425,25448,26012,37034,37196,
+24369,20027,21463,25480,32066,32722,34886,36913,20303,34899,36848,24033,
+36981,36981,25152,26360,22899,21213,21830,23477,23577,28040,30813,32918,
+24773,22516,39166,26893,27542,11997,39136,11998,14221,20405,11927,28024,
+36914,20155,20995,23563,35338,35338,36805,34928,36930,13599,21218,30427,
+32854,35200,35488,35531,38748,38748,31237,33030,38587,31821,31680,35498,
+38634,32085,25159,28568,32673,33337,36984,36983,21069,20840,25475,25591,
+30246,36208,36865,36973,36896,11978,36895,36042,23562,23562,22949,36864,
+36910,38538,39899,22823,13351,28711,36921,33067,20025,27470,35477,26262,
+20516,32622,31689,11950,31569,36880,26609,27880,39376,24501,25074,26397,
+35519,30452,26389,26389,22684,36861,36890,22378,37347,21576,24093,31243,
+30340,36969,36845,28155,20814,36884,30778,22305,21776,64003,34276,35588,
+36867,36879,39472,23566,36947,21534,15240,20839,32905,20083,24525,35469,
+63839,32013,35207,27966,32954,21338,34180,36843,32283,32903,20023,28497,
+37297,20276,21028,21322,24070,30036,26217,34115,36991,24494,40763,21305,
+11946,24421,23020,35413,24217,30149,23142,25975,28014,36000,36000,26381,
+35206,19993,24163,24179,24330,34065,20559,32232,36820,36941,31807,21253,
+23849,25265,26379,30770,32299,32990,33804,37030,37030,39165,40300,20129,
+24125,25151,26395,26395,20882,25705,32763,20961,30952,39764,40635,27097,
+26717,13416,40884,32365,40639,33032,26126,30431,36855,22916,21200,30450,
+32791,25147,32011,38272,32004,36493,26746,26746,26625,24841,21191,26377,
+29494,36938,26332,11959,35201,39178,32716,32764,36534,63775,29575,40845,
+40845,63875,26753,29136,38563,40023,40607,31867,63906,24976,63898,26391,
+32770,20682,20762,20820,20885,11911,21133,21207,13630,21471,26364,21811,
+21988,21589,22208,22841,23068,23234,23414,23572,14306,23782,24148,20040,
+24291,24727,25292,25628,25542,25640,25371,26207,26207,26211,26357,26781,
+26765,27126,27014,23528,23528,27067,27596,28433,28183,28568,27818,27818,
+28699,29026,29243,20012,29468,29898,29935,30069,30188,30286,16305,30570,
+30633,31040,31059,31059,40779,31150,36995,31571,31764,31764,16996,31824,
+31832,32070,32290,32290,32328,32309,32323,32396,32745,33089,17491,33368,
+33401,33507,20857,33626,33824,33725,34036,17701,34183,34292,34615,34619,
+34821,34749,34429,34870,13358,35014,35261,35547,35646,35674,36211,36249,
+18406,36404,36426,36847,36999,36858,36894,36917,36944,36808,36993,37002,
+37002,37002,37002,37002,37002,37001,37001,37001,37001,37001,37001,37001,
+37001,37001,37001,37001,37001,37853,38332,38578,38748,38969,39147,39171,
+39177,39237,39237,39243,39432,39519,39525,39663,39704,39903,40201,40200,
+40613,40652,40712,40778,40803,40807,35100,26824,26363,24389,21248,21385,
+22867,64017,19999,20011,20036,20058,20095,20109,20118,20153,20176,20192,
+20221,20223,20235,20245,20320,20283,20297,20308,20346,20375,20414,20431,
+20477,20496,20507,20519,20526,20567,20582,20586,20539,20623,20630,20636,
+20684,20710,20713,20719,20744,20747,20752,20763,20766,20831,20897,20924,
+20958,20974,20980,21011,21065,21089,21094,21139,21192,21232,21310,21324,
+21323,21345,21356,21419,21466,21478,21493,21543,21581,21606,21611,21620,
+21645,21654,21665,21677,21689,21695,21702,21709,21774,21803,21813,21834,
+21896,21902,22024,22071,22079,22089,22091,22095,22118,22121,22127,22165,
+22170,22193,22217,22237,22244,22282,22293,22307,22319,22348,22384,22412,
+22428,22456,22502,22509,22527,22537,22560,22578,22652,22656,22697,22734,
+22736,22740,22746,22761,22796,22820,22831,22881,22893,22986,22994,23005,
+23044,23052,23075,23111,23125,23139,23149,23166,23198,23207,23212,23219,
+23264,23296,23321,23333,23341,23361,23420,23434,23587,23595,23600,23651,
+23657,23676,23755,23762,23796,23844,23846,23875,23878,23882,23954,23956,
+23961,23968,24024,24032,24056,24064,24082,24088,24110,24152,24232,24234,
+24267,24274,24327,24334,24354,24360,24374,24379,24384,24400,24408,24420,
+24457,24476,24487,24484,24495,24504,24516,24521,24545,24553,24557,24572,
+24599,24602,24627,24673,24703,24734,24740,24752,24779,24795,24824,24860,
+24956,24973,24991,25000,25026,25055,25109,25129,25155,25158,25164,25169,
+25174,25284,25340,25354,25357,25368,25401,25445,25460,25469,25476,25479,
+25488,25502,25553,25564,25609,25616,25634,25684,25691,25709,25723,25829,
+25847,25851,25860,25878,25881,25927,25959,25985,25989,26050,26096,26098,
+26156,26188,26209,26219,26231,26276,26312,26348,26373,26387,26419,26440,
+26444,26486,26491,26544,26546,26617,26583,26585,26608,26668,26715,26738,
+26741,26746,26756,26789,26802,26832,26838,26856,26861,26876,26897,26899,
+26933,26939,26967,26979,26994,27046,27053,27063,27137,27151,27157,27176,
+27188,27198,27205,27222,27227,27267,27273,27281,27356,27367,27372,27422,
+27428,27445,27462,27478,27488,27522,27582,27617,27633,27664,27699,27701,
+27706,27737,27766,27771,27781,27797,27804,27856,27860,27862,27872,27886,
+27914,27918,27921,27950,27991,27998,28005,28034,28095,28100,28106,28118,
+28137,28194,28241,28359,28362,28366,28413,28442,28458,28463,28467,28506,
+28510,28514,28541,28555,28557,28562,28564,28570,28598,28634,28638,28665,
+28729,28732,28746,28756,28772,28780,28798,28801,28821,28855,28888,28892,
+28935,28960,28977,29002,29010,29024,29049,29074,29107,29131,29139,29142,
+29184,29213,29227,29240,29249,29267,29276,29325,29357,29364,29383,29435,
+29480,29489,29507,29548,29564,29571,29606,29611,29621,29623,29628,29647,
+29657,29673,29684,29693,29700,29706,29732,29736,29740,29753,29764,29767,
+29771,29773,29777,29783,29798,29803,29809,29824,29840,29848,29852,29856,
+29859,29864,29867,29877,29887,29896,29914,29918,30030,30073,30081,30096,
+30132,30180,30201,30208,30218,30233,30238,30253,30261,30275,30283,30309,
+30317,30319,30321,30324,30405,30412,30444,30460,30516,30518,30556,30578,
+30589,30613,30634,30694,30704,30708,30726,30754,30768,30773,30824,30878,
+30920,30924,30926,30948,30962,30967,30971,31025,31028,31035,31037,31045,
+31115,31126,31128,31160,31163,31178,31194,31235,31241,31249,31262,31277,
+31289,31301,31308,31325,31328,31341,31352,31392,31395,31411,31430,31495,
+31508,31527,31537,31559,31566,31584,31593,31597,31602,31633,31663,31703,
+31705,31755,31759,31776,31782,31793,31798,31825,31833,31847,31854,31856,
+31932,31935,31959,31961,31965,31979,32019,32029,32035,32065,32083,32089,
+32093,32122,32134,32204,32235,32241,32249,32264,32273,32277,32288,32327,
+32354,32366,32371,32397,32401,32408,32580,32591,32609,32657,32703,32718,
+32735,32741,32748,32762,32782,32785,32788,32804,32806,32826,32828,32864,
+32881,32885,32926,32934,32939,33046,33048,33082,33098,33100,33153,33156,
+33204,33231,33273,33283,33313,33330,33332,33350,33355,33359,33422,33454,
+33463,33470,33478,33534,33603,33617,33621,33670,33677,33682,33688,33705,
+33770,33807,33809,33866,33910,33960,33967,33984,33986,34032,34045,34060,
+34100,34142,34191,34231,34254,34221,34322,34345,34386,34403,34412,34415,
+34426,34445,34449,34456,34554,34557,34571,34579,34585,34590,34600,34622,
+34673,34696,34713,34741,34774,34795,34797,34817,34819,34822,34827,34836,
+34844,34902,34911,34916,34968,34986,35018,35026,35035,35111,35120,35134,
+35195,35284,35286,35301,35313,35335,35343,35349,35362,35406,35455,35572,
+35615,35639,35668,35740,35742,35911,35924,35955,36004,36057,36065,36088,
+36094,36123,36201,36204,36228,36237,36245,36262,36294,36302,36324,36332,
+36384,36427,36460,36464,36474,36498,36526,36531,36561,36564,36601,36631,
+36662,36774,36806,36832,36836,36854,36866,36908,36932,37000,37013,37017,
+37019,37026,37044,37079,37085,37108,37143,37148,37169,37178,37181,37192,
+37211,37217,37220,37262,37278,37288,37298,37308,37360,37367,37371,37383,
+37416,37427,37432,37443,37447,37455,37472,37570,37599,37645,37653,37663,
+37671,37703,37714,37733,37738,37741,37787,37818,37801,37825,37834,37858,
+37882,37885,37903,37940,37951,37973,37995,38002,38264,38310,38313,38315,
+38324,38333,38362,38429,38465,38488,38532,38564,38569,38610,38622,38633,
+38641,38658,38665,38746,38755,38766,38771,38810,38818,38873,38878,38900,
+38922,38926,38942,38947,38955,38974,39001,39020,39096,39098,39103,39112,
+39141,39232,39245,39260,39263,39345,39369,39426,39446,39460,39463,39478,
+39480,39498,39510,39673,39683,39712,39795,39801,39847,39873,39879,39895,
+39911,39915,39927,39930,39933,39947,39975,39978,39990,40001,40019,40035,
+40048,40055,40194,40258,40263,40291,40297,40316,40318,40333,40369,40387,
+40391,40406,40415,40427,40436,40469,40477,40612,40616,40620,40679,40686,
+40720,40722,40727,40729,40751,40759,40761,40769,40773,40791,40808,40817,
+40821,40848,40852,40866,20016,13317,22048,24267,11925,24740,27428,28665,
+28390,29107,11940,31430,32609,32881,32926,11980,37372,23986,38878,20435,
+20697,20720,20931,22134,27220,27905,28112,28226,28377,29668,29729,30060,
+30801,34805,29608,15091,13531,17420,16010,65533,19432,65533,16090,15138,
+65533,17786,16531,18021,16643,17043,18094,13448,63610,63615,12291,12294,
+12540,8800,8734,8756,8451,12543,12447,8712,8715,8746,8745,8713,
+8709,8658,8660,8704,8707,8736,8869,8706,8711,8801,8786,8730,
+8765,8733,8757,8802,8771,8773,8776,8596,8723,8501,8463,8487,
+12448,12371,12467,8533,8984,470,472,474,476,260,728,317,
+346,350,356,377,379,261,731,318,347,711,351,357,
+378,733,380,340,258,313,262,268,280,270,323,327,
+336,344,368,354,341,259,314,263,269,281,271,273,
+324,328,337,345,369,355,729,264,284,292,308,348,
+364,265,285,293,309,349,365,625,651,638,620,622,
+633,648,598,627,637,642,656,635,621,607,626,669,
+654,609,624,641,295,661,660,614,664,450,595,599,
+644,608,403,616,649,600,604,606,592,623,650,612,
+594,653,613,674,673,597,657,634,615,865,712,716,
+721,8255,783,805,812,825,796,829,809,815,734,804,
+816,828,820,794,8750,8735,8895,618,628,630,632,640,
+655,665,668,671,688,690,695,705,8714,8721,8749,8856,
+8862,8864,110,946,952,967,8487,12448,8533,470,472,474,
+476,260,317,346,350,356,377,379,261,318,347,351,
+357,378,380,340,258,313,262,268,280,270,323,327,
+336,344,368,354,341,259,314,263,269,281,271,273,
+324,328,337,345,369,355,264,284,292,308,348,364,
+265,285,293,309,349,365,12291,12294,12540,12543,12447,12371,
+12467,12541,12348,12543,8741,9838,9835,10687,8487,12448,8211,8254,
+65343,10003,8984,9251,9166,164,8273,8258,8713,8742,8773,8776,
+8802,12448,8211,10687,9702,12371,12467,12371,12467,8800,8734,8756,
+8451,8712,8715,8746,8745,8713,8709,8658,8660,8704,8707,8736,
+8869,8706,8711,8801,8786,8730,8765,8733,8757,8802,8771,8773,
+8776,8596,8723,8501,8463,8487,12448,8533,8984,470,472,474,
+476,260,728,317,346,350,356,377,379,261,731,318,
+347,711,351,357,378,733,380,340,258,313,262,268,
+280,270,323,327,336,344,368,354,341,259,314,263,
+269,281,271,273,324,328,337,345,369,355,729,264,
+284,292,308,348,364,265,285,293,309,349,365,625,
+651,638,620,622,633,648,598,627,637,642,656,635,
+621,607,626,669,654,609,624,641,295,661,660,614,
+664,450,595,599,644,608,403,616,649,600,604,606,
+592,623,650,612,594,653,613,674,673,597,657,634,
+615,865,712,716,721,8255,783,805,812,825,796,829,
+809,815,734,804,816,828,820,794,8750,8735,8895,618,
+628,630,632,640,655,665,668,671,688,690,695,704,
+8714,8721,8749,8856,8862,8864,110,946,952,967,8487,12448,
+8533,470,472,474,476,260,317,346,350,356,377,379,
+261,318,347,351,357,378,380,340,258,313,262,268,
+280,270,323,327,336,344,368,354,341,259,314,263,
+269,281,271,273,324,328,337,345,369,355,264,284,
+292,308,348,364,265,285,293,309,349,365,20296,20319,
+20330,20332,20494,20504,20545,20722,20688,20742,20739,20789,20821,20823,
+13493,20938,20962,21079,21196,21206,21243,21276,21347,21405,21522,21631,
+21640,21840,21889,21933,21966,22075,22174,22185,22195,22391,22396,22479,
+22500,22628,22665,22738,22752,34369,22923,22930,22979,23059,23143,23159,
+23172,23236,23421,23443,23570,64060,23674,23695,23711,23715,23722,23760,
+23821,23879,23937,23972,23975,24011,24158,24313,24320,24322,24355,24381,
+24404,24445,24589,24596,24600,24629,24647,24733,24788,24797,24875,25020,
+25017,25122,25178,25199,25302,25468,25573,25721,25796,25808,25897,26013,
+26170,26146,26155,26160,26163,26184,26253,26299,26331,26344,26439,26497,
+26515,26520,26523,26620,26653,26787,26890,26953,26946,26980,27045,27087,
+15286,15299,27113,27125,27284,27301,15375,27419,27436,27495,27561,27565,
+27607,27647,27653,27764,27800,27899,27846,27953,27961,27967,27992,28052,
+28074,28123,28125,28228,28254,28337,28353,28432,28505,28513,28542,28556,
+28576,28604,28615,28618,28656,28750,28789,28836,28900,28971,28958,28974,
+29009,29032,29061,29063,29114,29124,29205,15935,29339,29479,29520,29542,
+29602,29739,29766,29794,29805,29862,29865,29897,29951,29975,16242,30158,
+30210,30216,30308,30337,30365,30378,30390,30414,30420,30438,30449,30474,
+30489,30586,30592,30612,30688,30787,30830,30896,30893,30976,31004,31022,
+31028,31046,31097,31176,31188,31198,31211,31213,31365,31438,31485,31506,
+31533,31547,31599,31745,31795,31853,31865,31887,31892,31904,31957,32049,
+32092,32131,32166,32194,32296,32663,32731,32821,32823,32970,32992,33011,
+33120,33133,33211,33226,33239,17499,33376,33396,33449,33471,33493,33533,
+33536,33570,33581,33594,33607,33661,33703,33743,33745,33761,33793,33798,
+33887,33904,33907,33925,33950,33978,34098,34078,34095,34148,34170,34188,
+34210,34251,34285,34303,34328,34360,34391,34402,17821,34421,34488,34556,
+34695,17898,34826,34832,35022,35122,35129,35136,35220,35318,35399,35421,
+35425,35445,35536,35654,35673,35689,35741,35913,35944,36271,36305,36311,
+36387,36413,36475,18500,36602,36638,36653,36692,36840,36846,36872,36909,
+37015,37043,37054,37063,37103,37140,37142,37167,37172,37251,37361,37705,
+37795,37855,37892,37939,37962,37987,38001,38286,38303,38316,38326,38347,
+38352,38355,18864,38366,38565,38639,38734,38805,38830,38842,38849,38857,
+38875,38998,39143,39256,39427,39617,39619,39630,39638,39682,39688,19479,
+39725,39774,39782,39812,39818,39838,39886,39909,39928,39971,40259,40274,
+40330,40342,40384,40364,40380,40423,40455,40606,40623,40855,19970,19983,
+19986,20009,20014,20039,20049,13318,20073,20125,13356,20156,20163,20168,
+20203,20186,20209,20213,20246,20324,20279,20286,20312,20354,20357,20454,
+20402,20421,20427,20434,13418,20466,20499,20508,20558,20563,20579,20643,
+20616,20629,20650,20676,20679,20723,20692,20705,13458,20851,20867,20875,
+13500,20888,20899,20909,13511,20979,21010,21014,21077,21084,21100,21111,
+21124,21122,21194,21201,21239,21301,21314,21351,21370,21412,21428,21431,
+21440,21461,13667,21492,21540,21544,13678,21571,21602,21612,21653,21664,
+21670,21678,21687,21690,21699,21740,21743,21745,21747,21769,21820,21825,
+13734,21831,13736,21860,21885,21890,21905,13765,21970,21951,21961,21964,
+21969,21981,13786,21986,21993,22056,22023,22032,22064,13812,22077,22080,
+22087,22110,22112,22125,13829,22152,22156,22173,22184,22194,22213,22221,
+22239,22248,22376,22383,22440,22487,22494,22512,13898,22520,22523,22525,
+22532,22558,22567,22585,22601,22604,22631,22676,22685,22698,22705,22723,
+22733,22754,22797,22804,13969,22845,13977,22854,13974,22908,22943,22958,
+22972,22984,22989,23006,23015,23022,14031,23053,23063,23079,23085,23141,
+23162,23179,23196,23202,23217,23221,23226,23231,23258,23260,23269,23280,
+23278,23285,23304,23319,23348,23372,23378,23400,23407,23425,23428,23446,
+23468,23502,23510,14188,14187,23537,23549,14197,23555,23593,23688,23690,
+14273,23712,23714,23719,23725,23733,23814,23824,23851,23837,23840,23857,
+23865,14312,23905,23914,14324,23920,14333,23944,14336,23959,23984,23988,
+24017,24023,24036,24041,14383,14390,14400,24095,24126,24137,14428,24150,
+14433,24229,24236,24249,24262,24281,24317,24328,24350,24391,24419,24434,
+24446,24463,24482,24519,24523,24563,14615,24610,24612,14618,24652,24725,
+24744,24753,24766,24776,24793,24814,24821,24848,24857,24862,24890,14703,
+24897,24902,24928,24983,24997,25005,25045,25053,25077,25123,25170,25185,
+25188,25211,25197,25203,25241,25301,25341,25347,25360,25394,25397,25409,
+25412,25422,25452,25497,25492,25533,25586,25630,25637,25641,25647,25690,
+25693,25715,25725,25735,25745,25759,25813,25815,25828,25855,14958,25871,
+25876,14963,25886,25906,25924,25940,25963,25978,25988,25994,26034,26037,
+26040,26047,26057,26068,15062,26105,26108,26116,26120,26145,26154,26181,
+26193,26190,15082,26235,26240,26256,26258,15118,26285,26289,26293,15130,
+15132,15063,26369,26386,26445,26452,26461,33635,26640,26563,26568,26578,
+26587,26615,26648,26655,26669,26675,26683,26686,26693,26697,26700,26709,
+26711,15223,26731,26734,26748,26754,26768,26774,15213,26804,26811,26875,
+26819,26821,26828,26841,26860,26871,26883,26887,15239,15245,26950,26985,
+26988,27002,27026,15268,27030,27056,27066,27068,27072,27089,27123,15309,
+27124,27134,27153,27162,27165,27199,27209,27258,27214,27218,27236,27275,
+15344,27297,27307,27325,27334,27348,27344,27357,27415,15398,27439,27466,
+27480,27500,27509,27514,27521,27547,27566,27630,27650,27658,27662,27702,
+27725,27739,27757,27780,27785,15555,27796,27799,27821,27842,15570,27868,
+27881,27885,27904,27940,27751,27951,27964,27995,28000,28016,28042,28045,
+28049,28056,28075,28078,28084,28098,27956,28104,28110,28127,28150,28214,
+28190,15633,28210,28247,28259,15646,28307,28327,28340,28355,28469,28395,
+28409,28411,28426,28428,28440,28453,28470,28476,28498,28503,28512,28520,
+28560,28566,28606,28575,28581,28591,15716,28668,28672,28682,28707,28730,
+28739,28743,28747,15770,28773,28777,28782,28790,28806,28823,28831,28849,
+28908,28874,28881,28931,28934,28936,28940,15808,28975,29008,29011,29022,
+15828,29078,29056,29083,29088,29090,29145,29148,29191,15877,29236,29241,
+29250,29271,29283,29304,29311,29326,29358,29360,29377,15968,29388,15974,
+15976,29427,29434,29447,29458,16003,29497,29484,29491,29501,29522,16020,
+29547,29553,29569,29578,29588,29592,29596,29605,29625,29631,29637,29643,
+29665,29671,29689,29715,29690,29697,29779,29760,29763,29778,29789,29825,
+29832,29842,29847,29849,29857,29861,29866,29881,29883,29882,29910,29912,
+29931,29984,29988,29994,16215,30016,30024,30032,30034,30066,30065,30074,
+30092,16245,30114,16247,30128,30135,30150,30159,30163,30173,30183,30190,
+30193,30211,30232,30215,30223,16302,30245,30248,30268,30259,16329,30273,
+30281,30293,16343,30318,30357,30369,30368,30487,30490,30509,30517,16472,
+30618,30623,30626,30628,30692,30698,30700,30715,30725,30729,30733,30745,
+30764,30791,30826,30858,30868,30884,30877,30879,30907,30933,30950,30992,
+31003,31013,31050,31064,16645,31079,31090,31125,31137,31145,31156,31170,
+31175,31190,16712,16719,31242,31253,31259,16739,31288,31303,31318,31321,
+31324,31327,31335,31338,31349,31362,31370,31376,31404,16820,31417,31422,
+16831,31436,31464,31476,31549,31530,16870,16883,31615,31553,16878,31573,
+31609,31588,31590,31603,16903,31632,31643,16910,31669,31676,31685,31690,
+31700,31702,31706,31722,31728,31747,31758,31813,31818,31831,31838,31841,
+31849,31855,31989,32003,17094,32018,32030,32064,32071,17110,32090,32106,
+32112,17117,32127,32136,32151,32157,32167,32170,32182,32192,32215,32217,
+32230,17154,64088,32272,32279,32285,32295,32300,32325,32373,32382,17195,
+32410,17219,32572,32571,32574,32579,13505,32656,20859,32662,32668,32685,
+32707,32719,32739,32754,32778,32776,32790,32812,32816,32835,32870,32891,
+32921,32924,32932,32935,32952,32965,32981,32998,33037,33013,33019,17390,
+33077,33054,17392,33060,33063,33068,33085,17416,33129,17431,17436,33157,
+17442,33176,33202,33217,33219,33238,33243,33260,33277,33279,33305,33314,
+33340,33353,33349,17526,17530,33367,33372,33379,17553,33405,33407,33411,
+33418,33427,33458,33460,33466,33468,33506,33512,33527,33548,33620,33563,
+33565,33584,33596,33604,33623,17598,17620,17587,33691,33693,33737,33744,
+33748,33757,33765,33785,33813,33815,33849,33871,33893,33912,33916,33921,
+17677,33943,33958,33982,17672,34023,34026,34031,34033,34042,34075,34091,
+34127,34159,17731,34129,34171,34173,34175,34177,34182,34195,34205,34207,
+34236,34247,34250,34271,34273,34278,34294,34304,34321,34334,34337,34340,
+34343,34361,34364,34368,34387,34390,34423,34439,34441,34481,34483,34497,
+34499,34513,34517,34519,34531,34534,17848,34565,34567,34574,34576,34591,
+34593,34595,34609,34618,34624,34627,34641,34648,34674,34684,34727,34697,
+34699,34707,34720,17893,34750,34753,34766,34783,34794,34835,34856,34862,
+34866,34876,17935,34890,34904,34927,34976,35004,35008,35025,35027,17985,
+35073,35138,35141,35145,35170,35209,35216,35231,35248,35255,35288,35307,
+18081,35315,35325,35327,18095,35345,35348,35361,35381,35390,35397,35405,
+35416,35502,35472,35511,35543,35580,35594,35589,35597,35612,35629,18188,
+35665,35678,35702,35713,35723,35909,35919,35927,35945,35949,35987,35986,
+35993,18276,35995,36054,36053,36105,36110,36296,36313,36364,18429,36349,
+36358,36372,36374,18454,36406,36409,36436,36450,36461,36463,36504,36510,
+36533,36539,36608,36616,36651,36672,36682,36696,36772,36788,36801,36806,
+64036,36810,36813,36819,36821,36849,36853,36859,36876,36919,36931,36957,
+36997,37004,37008,37025,18613,37040,37046,37059,37064,37084,37087,37110,
+37106,37120,37099,37124,37126,37144,37150,37175,37177,37207,37209,37236,
+37241,37253,37299,37302,37356,37377,37442,37450,37462,37473,37477,37480,
+37503,37513,37517,37527,37529,37535,37547,37574,37582,37605,37649,37623,
+37673,37713,37722,37739,37745,37747,37793,37768,37771,37775,37790,37877,
+37873,37831,37852,37863,37897,37883,37938,37947,37997,37999,38265,38278,
+38460,38497,18919,38579,38586,38589,18938,38616,38618,38621,18948,38676,
+38691,18985,38710,38721,38727,38743,38747,38762,38806,38814,38846,38860,
+38865,38868,38872,38881,38897,38916,38925,38932,38934,19132,38949,38983,
+39014,39083,39085,39088,39106,39111,39115,39137,39139,39146,39155,39176,
+19259,39233,39238,39246,39264,39331,39334,39357,39359,39363,39380,39385,
+39390,39408,39417,39420,39434,39441,39450,39456,39473,39492,39500,39512,
+19394,39599,19402,39607,19410,39609,39622,39632,39634,39637,39648,39653,
+39657,39692,39696,39698,39702,39708,39723,39741,19488,39755,39779,39781,
+39846,39852,39858,39864,39870,39923,39896,39901,39914,39919,39918,39965,
+39970,39977,39985,39991,40005,40028,40020,40024,40027,40029,40031,40050,
+40053,40058,40166,40178,40203,40242,19665,40266,40287,40290,40324,40345,
+40353,40383,40373,40377,40381,40393,40410,40416,40419,19719,40458,40450,
+40461,40476,40571,40576,40581,40603,40671,40703,40706,19831,40707,40762,
+40765,40774,40787,40789,40792,40809,40813,40816,11948,13844,14509,15820,
+16348,17854,17936,19326,19512,19681,19980,20089,20211,20236,20249,20267,
+20270,20273,20356,20382,20407,20484,20492,20556,20575,20578,20599,20622,
+20638,20642,20675,20712,20721,20734,20743,20787,20792,20852,20868,20920,
+20922,20936,20943,20945,20952,20959,20997,21030,21032,21035,21045,21052,
+21082,21088,21102,21130,21132,21217,21225,21233,21251,21265,21279,21293,
+21298,21309,21349,21357,21369,21374,21396,21401,21418,21423,21434,21441,
+21472,21523,21546,21553,21580,21671,21674,21681,21691,21710,21738,21756,
+21765,21768,21781,21799,21802,21814,21841,21862,21903,21906,21908,21924,
+21938,21955,21958,21971,21979,21996,21998,22001,22006,22008,22021,22029,
+22060,22069,22073,22093,22100,22149,22175,22182,22199,22220,22223,22233,
+22241,22251,22253,22257,22279,22284,22301,22316,22318,22367,22379,22381,
+22394,22403,22423,22446,22485,22503,22541,22566,22605,22607,22623,22637,
+22655,22657,22680,22716,22815,22819,22873,22905,22935,22959,22963,23007,
+23025,23032,23218,23224,23274,23286,23323,23325,23329,23352,23479,23511,
+23520,23583,23594,23596,23606,23641,23644,23661,23773,23809,23860,23869,
+23897,23934,23939,24007,24057,24104,24114,24117,24155,24168,24170,24183,
+24192,24203,24243,24253,24273,24397,24492,24554,24583,24649,24660,24679,
+24763,24772,24829,24842,24854,24874,24886,24926,24932,24955,24957,24959,
+24989,25016,25052,25058,25061,25064,25092,25095,25137,25145,25149,25210,
+25232,25256,25306,25332,25366,25386,25398,25414,25419,25427,25457,25461,
+25471,25474,25482,25618,25624,25632,25636,25642,25653,25661,25663,25682,
+25695,25716,25744,25772,25779,25837,25840,25883,25887,25902,25929,25952,
+26002,26005,26036,26046,26056,26062,26064,26079,26238,26291,26304,26319,
+26405,26421,26453,26496,26511,26513,26532,26545,26549,26558,26664,26758,
+26859,26869,26903,26931,26936,26971,26981,27048,27051,27055,27109,27121,
+27210,27221,27239,27249,27311,27395,27451,27455,27568,27639,27641,27652,
+27657,27661,27692,27722,27730,27732,27769,27820,27828,27858,28001,28028,
+28089,28144,28229,28275,28283,28285,28297,28348,28454,28457,28464,28551,
+28573,28590,28599,28685,28704,28745,28824,28848,28997,29106,29172,29207,
+29215,29251,29274,29280,29288,29303,29316,29385,29413,29428,29442,29451,
+29470,29474,29517,29528,29543,29810,29871,29919,29924,29940,29947,29974,
+29985,30015,30046,30105,30116,30145,30148,30156,30167,30172,30177,30191,
+30212,30220,30237,30258,30264,30277,30282,30303,30381,30397,30425,30443,
+30448,30457,30464,30478,30498,30504,30511,30521,30526,30533,30538,30543,
+30558,30564,30567,30572,30596,30614,30631,30639,30647,30654,30665,30673,
+30681,30705,30775,30812,30846,30872,30881,30897,30899,30921,30931,30988,
+31007,31039,31042,31060,31083,31100,31147,31172,31210,31234,31244,31280,
+31290,31300,31360,31366,31380,31413,31421,31486,31531,31607,31648,31660,
+31664,31720,31730,31736,31740,31742,31753,31784,31791,31810,31858,31869,
+31879,31902,31930,31943,31955,31962,32060,32077,32130,32133,32141,32145,
+32158,32179,32185,32208,32229,32303,32310,32324,32367,32376,32385,32573,
+32603,32605,32613,32625,32651,32674,32775,32781,32798,32825,32904,32910,
+32975,32980,33005,33008,33015,33018,33022,33027,33047,33072,33111,33135,
+33139,33163,33168,33179,33182,33227,33237,33249,33263,33270,33280,33291,
+33306,33338,33348,33389,33412,33417,33425,33450,33456,33488,33514,33519,
+33526,33622,33656,33784,33788,33880,33939,33969,33981,34043,34118,34134,
+34141,34181,34200,34370,34374,34496,34580,34594,34606,34617,34653,34683,
+34700,34702,34718,34723,34734,34751,34761,34778,34840,34843,34861,34874,
+34885,34891,34894,34901,34906,34926,35021,35040,35055,35110,35125,35162,
+35164,35179,35184,35196,35237,35253,35260,35285,35401,35415,35431,35454,
+35462,35478,35510,35529,35537,35549,35564,35573,35590,35599,35601,35653,
+35666,35693,35704,35708,35710,35717,35743,35915,35923,35963,36026,36037,
+36041,36050,36076,36085,36087,36097,36099,36119,36124,36206,36241,36255,
+36267,36274,36309,36327,36340,36353,36363,36390,36401,36429,36431,36444,
+36449,36457,36465,36469,36471,36489,36496,36501,36506,36519,36521,36525,
+36584,36592,36615,36632,36645,36647,36652,36661,36666,36675,36679,36689,
+36693,36773,36868,36891,36911,36940,36955,36976,36980,36985,37003,37016,
+37024,37042,37053,37065,37104,37125,37157,37210,37223,37242,37258,37265,
+37269,37296,37307,37309,37314,37317,37376,37385,37411,37494,37518,37551,
+37569,37571,37573,37576,37652,37683,37686,37720,37759,37762,37770,37819,
+37836,37862,37881,37890,37934,37964,38280,38305,38335,38342,38345,38368,
+38372,38374,38436,38449,38456,38461,38484,38516,38523,38527,38529,38531,
+38537,38550,38574,38659,38683,38689,38690,38696,38705,38759,38774,38781,
+38783,38809,38815,38828,38841,38861,38880,38895,38919,38950,38958,39092,
+39109,39170,39185,39189,39221,39240,39252,39262,39393,39436,39440,39459,
+39489,39505,39681,39689,39691,39705,39733,39752,39765,39784,39808,39814,
+39824,39837,39856,39871,39880,39935,39938,39964,39989,40004,40022,40033,
+40040,40240,40253,40298,40315,40421,40425,40435,40570,40624,40676,40688,
+40690,40713,40719,40724,40731,40738,40742,40756,40794,40815,40862,40869,
+13790,65533,65533,65533,65533,19982,20006,20339,20566,20717,20843,20958,
+20989,21311,21332,21568,21916,21931,22025,22190,22190,22208,22211,22222,
+22254,22486,22589,22617,22863,22865,22880,22882,23258,23386,23411,23420,
+23475,24131,24231,24291,24376,24481,24541,24930,25010,25080,14756,14776,
+25765,25846,14940,25991,25993,25998,15044,15051,26081,26215,26222,26305,
+26332,14981,26368,26465,26564,26626,26941,26974,27141,27292,15347,27384,
+27569,27704,27818,28092,28132,15665,28168,28274,28363,28373,28379,28507,
+28507,28516,28532,29246,15936,14497,29642,29885,30045,30140,30169,30216,
+30308,30313,30408,30519,30590,31143,31153,31422,31712,31824,32009,32178,
+32178,32574,32737,32786,32887,32982,33033,33065,33292,33307,33344,33759,
+33748,33807,33865,34026,34129,34147,34255,34382,34402,34442,34882,34935,
+35137,35670,35670,35676,18207,35946,35961,36042,36199,18462,36611,36676,
+36805,36820,36854,36983,36983,37032,37197,37609,37685,37771,37946,38349,
+38442,38552,38567,38911,38911,39178,39201,39255,39848,39854,39865,39944,
+39972,39995,40053,40166,40384,40386,40568,39151,31496,25711,31806,31605,
+29973,35357,24674,28792,24272,31874,38553,34388,33137,37749,21676,29409,
+26775,39851,21449,26454,29990,29969,31432,25402,36929,39361,26023,37345,
+38829,33426,31870,29242,34821,34563,39709,39724,20482,20958,21255,23532,
+63784,26142,63785,28746,64021,21857,27706,31328,34819,38315,38741,186,
+170,8470,272,294,306,319,330,358,307,312,320,329,
+359,266,278,286,290,288,304,302,310,317,315,325,
+342,370,471,475,473,469,372,374,267,279,501,287,
+289,303,311,318,316,326,343,371,373,375,8494,8710,
+8719,186,170,8470,272,294,306,319,330,358,307,312,
+320,329,359,266,278,286,290,288,304,302,310,317,
+315,325,342,370,471,475,473,469,372,374,267,279,
+501,287,289,303,311,318,316,326,343,371,373,375,
+8494,8710,8719,9674,902,938,908,910,939,911,970,912,
+971,944,974,12498,12501,12504,12507,12510,12516,12518,32066,72,
+27573,12468,12511,24180,78,22825,20877,26032,26144,22768,21069,24460,
+32066,31435,20132,21127,21496,35299,26666,27671,20108,22810,25991,25163,
+8212,8212,8212,65533,65533,186,170,8470,272,294,306,319,
+330,358,307,312,320,329,359,266,278,286,290,288,
+304,302,310,317,315,325,342,370,471,475,473,469,
+372,374,267,279,501,287,289,303,311,318,316,326,
+343,371,373,375,8494,8710,8719,186,170,8470,272,294,
+306,319,330,358,307,312,320,329,359,266,278,286,
+290,288,304,302,310,317,315,325,342,370,471,475,
+473,469,372,374,267,279,501,287,289,303,311,318,
+316,326,343,371,373,375,8494,8710,8719,9674,28322,64064,
+64032,35711,20021,20060,20067,20072,20119,20143,20187,20194,20200,20207,
+20222,20226,20232,20242,20247,20275,20277,20288,20290,20306,20323,20334,
+20337,20345,20353,20361,20364,20366,20368,20371,20377,20383,20409,20422,
+20424,20428,20444,20450,20464,20476,20487,20490,20503,20509,20528,20533,
+20549,20554,20569,20576,20583,20589,20593,20609,20614,20618,20624,20635,
+20665,20669,20672,20691,20703,20706,20708,20726,20730,20722,20761,20783,
+20785,20788,20793,20802,20815,20819,20824,20838,20862,20878,20927,20930,
+20946,20949,20965,20978,20983,21016,21026,21061,21080,21087,21120,21125,
+21146,21157,21159,21168,21181,21188,21190,21199,21204,21212,21221,21224,
+21226,21228,21236,21238,21260,21267,21272,21275,21278,21285,21296,21308,
+21337,21339,21349,21379,21390,21409,21429,21432,21437,21455,21470,21472,
+21479,21506,21530,21537,21551,21572,21575,21583,21598,21604,21607,21609,
+21633,21635,21637,21641,21649,21663,21706,21728,21750,21758,21810,21819,
+21821,21833,21837,21848,21887,21907,21911,21923,21953,21963,21982,22015,
+22021,22026,22041,22067,22076,22081,22133,22148,22155,22183,22187,22206,
+22219,22224,22236,22289,22304,22306,22314,22335,22354,22370,22375,22382,
+22385,22393,22398,22401,22420,22425,22431,22433,22421,22439,22441,22461,
+22493,22505,22526,22531,22536,22497,22540,22555,22559,22573,22591,22608,
+22613,22632,22648,22668,22678,22694,22724,22722,22728,22742,22749,22753,
+22790,22813,22817,22824,22832,22835,22847,22851,22866,22878,22891,22895,
+22898,22907,22924,22926,22933,22951,22957,22960,22967,22977,22980,23023,
+23026,23028,23031,23040,23054,23058,23070,23076,23080,23082,23088,23112,
+23116,23120,23134,23163,23184,23187,23190,23193,23227,23238,23240,23247,
+23293,23297,23371,23390,23406,23430,23438,23469,23471,23482,23484,23489,
+23501,23503,23535,23540,23564,23575,23590,23598,23602,23605,23642,23675,
+23677,23687,23698,23709,23730,23732,23767,23790,23826,23843,23871,23880,
+23893,23889,23906,23908,23935,23946,23955,23957,23963,23967,23979,24003,
+24014,24025,24071,24077,24096,24139,24156,24176,24206,24226,24228,24241,
+24268,24270,24284,24286,24293,24299,24326,24345,24356,24366,24368,24383,
+24388,24411,24416,24431,24440,24442,24461,24470,24477,24491,24552,24556,
+24562,24566,24570,24586,24595,24607,24621,24640,24648,24657,24689,24702,
+24706,24710,24712,24718,24721,24723,24728,26079,24738,24741,24759,24770,
+24802,24805,24828,24834,24839,24844,24855,24866,24881,24885,24889,24901,
+24905,24940,24946,24952,24971,24988,24992,25002,25054,25057,25063,25065,
+25071,25089,25091,25116,25120,25127,25131,25154,25156,25168,25172,25180,
+25213,25294,25322,25330,25348,25355,25363,25385,25389,25418,25426,25428,
+25432,25435,25446,25453,25464,25493,25498,25508,25510,25517,25537,25541,
+25544,25550,25555,25587,25610,25648,25675,25679,25683,25692,25697,25699,
+25733,25743,25755,25761,25763,25766,25768,25789,25801,25809,25845,25857,
+25875,25894,25905,25914,25923,25936,25938,25951,25981,26008,26016,26019,
+26022,26030,26035,26070,26072,26079,26134,26141,26147,26150,26153,26169,
+26167,26176,26182,26186,26200,26208,26229,26239,26233,26236,26271,27134,
+26316,26318,26324,26335,26347,26350,26375,26396,26400,26402,26430,26437,
+26476,26500,26510,26518,26521,26562,26565,26569,26588,26593,26598,26610,
+26614,26644,26649,26663,26671,26687,26698,26712,26735,26745,26747,26760,
+26785,26793,26798,26833,26835,26858,26870,26877,26886,26889,26896,26902,
+26929,26949,26958,26982,27003,27021,27041,27064,27077,27080,27134,27136,
+27139,27168,27172,27191,27221,27242,27265,27376,27388,27394,27401,27432,
+27435,27446,27469,27474,27485,27499,27502,27504,27525,27543,27560,27564,
+27619,27666,27673,27679,27694,27707,27723,27727,27755,27768,27783,27807,
+27824,27826,27853,27855,27857,27879,27890,27892,27911,27919,27923,27930,
+27944,27999,28007,28050,28055,28087,28093,28128,28130,28133,28143,28148,
+28160,28164,28219,28242,28253,28258,28264,28301,28313,28320,28339,28347,
+28352,28360,28365,28367,28420,28424,28429,28438,28443,28475,28461,28495,
+28499,28509,28524,28547,28563,28582,28592,28613,28648,28669,28695,28719,
+28724,28727,28740,28744,28757,28820,28822,28827,28852,28922,28933,28939,
+28973,28984,28993,29003,29912,29015,29018,29068,29082,29104,29132,29146,
+29176,29203,29210,29220,29231,29253,29262,29278,29291,29297,29321,29331,
+29352,29400,29407,29438,29453,29459,29490,29493,29526,29545,29561,29568,
+29582,29584,29587,29591,29610,29613,29638,29644,29651,29661,29670,29687,
+29691,29713,29741,29806,29839,29841,29850,29870,29900,29904,29907,29912,
+29915,29928,29930,29935,29948,29958,29970,29991,29993,30006,30009,30019,
+30023,30039,30047,30049,30085,30101,30108,30138,30226,30243,30249,30272,
+30276,30297,30341,30401,30411,30420,30432,30454,30470,30482,30492,30510,
+30525,30530,30546,30605,30626,30638,30641,30645,30659,30674,30677,30712,
+30734,30737,30749,30755,30788,30792,30796,30802,30814,30819,30863,30888,
+30892,30898,30909,30911,30919,30930,30934,30939,30943,30954,30963,30966,
+30975,30982,31002,31006,31008,31017,31021,31029,31044,31051,31055,31057,
+31081,31099,31102,31116,31121,31123,31132,31144,31151,31183,31197,31200,
+31202,31205,31217,31224,31228,31239,31265,31271,31275,31279,31304,31317,
+31333,31358,31371,31377,31390,31433,31451,31465,31468,31473,31483,31519,
+31523,31529,31536,31540,31594,31620,31625,31630,31638,31653,31666,31670,
+31677,31682,31688,31707,31746,31748,31750,31756,31769,31771,31781,31788,
+31796,31814,31829,31834,31843,31849,31868,31878,31920,31931,31951,31956,
+31977,32015,32017,32022,32038,32042,32045,32081,32087,32101,32103,32120,
+32123,32129,32150,32256,32226,32234,32237,32250,32284,32301,32307,32319,
+32334,32336,32344,32351,32357,32405,32575,32604,32614,32640,32653,32655,
+32678,32682,32692,32700,32704,32712,32744,32783,32787,32797,32814,32820,
+32830,32832,32836,32868,32877,32897,32953,32968,32973,32978,33006,33010,
+33014,33017,33035,33052,33056,33084,33093,33095,33106,33121,33143,33158,
+33166,33174,33186,33198,33221,33230,33259,33269,33272,33280,33295,33309,
+33320,33347,33358,33361,33366,33383,33403,33415,33428,33430,33432,33440,
+33498,33504,33508,33517,33569,33580,33582,33587,33591,33597,33602,33648,
+33664,33666,33668,33689,33692,33702,33708,33726,33619,33768,33817,33709,
+33839,33861,33863,33869,33878,33884,33888,33892,33895,33898,33908,33917,
+33938,33941,33996,34034,34039,34055,34062,34064,34076,34082,34087,34090,
+34099,34102,34111,34128,34130,34169,34185,34187,34208,34213,34215,34228,
+34230,34232,34242,34266,34272,34280,34291,34300,34329,34331,34358,34362,
+34365,34404,34409,34422,34454,34458,34465,34470,34477,34487,34489,34495,
+34501,34514,34522,34524,34528,34533,34535,34440,34564,34575,34607,34610,
+34629,34637,34657,34671,34704,34709,34723,34737,34760,34762,34773,34777,
+34780,34786,34788,34801,34803,34808,34810,34815,34825,34841,34834,34842,
+34846,34864,34869,34881,34883,34891,34897,34908,34912,34929,34937,34939,
+34944,34975,34984,35002,35038,35047,35063,35085,35104,35112,35121,35130,
+35142,35151,35154,35159,35163,35169,35171,35182,35187,35189,35194,35197,
+35213,35221,35232,35252,35254,35287,35305,35309,35321,35358,35360,35364,
+35366,35375,35389,35392,35395,35411,35414,35420,35429,35456,35459,35467,
+35471,35474,35479,35481,35487,35497,35503,35507,35515,35523,35526,35528,
+35530,35568,35583,35595,35614,35632,35644,35650,35656,35661,35683,35705,
+35716,35725,35727,35896,35902,35921,35928,35931,35933,35929,35979,35984,
+36025,36038,36043,36047,36061,36072,36079,36082,36095,36197,36223,36226,
+36232,36240,36254,36256,36268,36277,36279,36281,36283,36288,36293,36295,
+36298,36308,36325,36336,36284,36369,36403,36430,36443,36507,36509,36514,
+36538,36545,36551,36572,36590,36593,36599,36589,36610,36643,36648,36654,
+36660,36663,36673,36687,36709,36765,36792,36798,36800,36811,36816,36818,
+36835,36862,36888,36927,36962,36966,36972,37006,37029,37068,37077,37093,
+37074,37128,37133,37136,37146,37152,37161,37166,37174,37180,37187,37199,
+37203,37229,37243,37249,37254,37272,37281,37286,37311,37359,37369,37373,
+37438,37446,37453,37464,37493,37497,37499,37514,37522,37536,37544,37558,
+37560,37562,37565,37575,37581,37592,37601,37603,37608,37612,37614,37616,
+37632,37640,37660,37668,37674,37684,37687,37712,37717,37726,37735,37737,
+37743,37748,37750,37754,37757,37773,37778,37781,37784,37793,37798,37800,
+37803,37833,37835,37837,37843,37849,37879,37889,37896,37909,37919,37935,
+37949,37955,37977,37980,37983,37985,37992,37998,38020,38019,38270,38276,
+38330,38361,38365,38367,38430,38434,38510,38524,38526,38545,38559,38566,
+38602,38618,38623,38650,38661,38682,38685,38689,38730,38744,38779,38784,
+38793,38807,38840,38844,38847,38855,38858,38862,38864,38871,38877,38884,
+38906,38937,38940,38944,38959,38965,38980,38986,38993,39018,39086,39116,
+39142,39158,39175,39199,39202,39206,39211,39220,39225,39239,39257,39259,
+39323,39325,39327,39344,39346,39349,39379,39386,39388,39399,39428,39435,
+39454,39458,39475,39477,39495,39508,39517,39594,39596,39598,39602,39604,
+39611,39615,39624,39639,39643,39652,39655,39660,39669,39674,39677,39707,
+39718,39733,39735,39771,39777,39786,39800,39807,39813,39815,39817,39819,
+39821,39828,39834,39849,39863,39868,39888,39929,39951,39953,39966,39974,
+39976,39997,40003,40014,40030,40059,40183,40185,40220,40239,40250,40252,
+40261,40293,40323,40326,40334,40362,40366,40383,40394,40414,40430,40432,
+40446,40462,40470,40583,40598,40600,40622,40627,40646,40648,40651,40661,
+40689,40693,40696,40721,40726,40730,40735,40753,40754,40764,40767,40775,
+40790,40798,40814,40819,40826,40829,40847,40854,40865,40867,
+};
+
+static pdf_cmap cmap_Adobe_Japan1_UCS2 = {
+	-1, "Adobe-Japan1-UCS2", "", 0, 0, 1,
+	{ {2,0,65535}, },
+	3734, 3734, (pdf_range*) cmap_Adobe_Japan1_UCS2_ranges,
+	19930, 19930, (unsigned short*) cmap_Adobe_Japan1_UCS2_table,
+};
+
+/* Adobe-Japan2-0 */
+
+static const pdf_range cmap_Adobe_Japan2_0_ranges[] = {
+{0,24269,0},
+};
+
+static const unsigned short cmap_Adobe_Japan2_0_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Japan2_0 = {
+	-1, "Adobe-Japan2-0", "", 0, 0, 1,
+	{ {2,0,6143}, },
+	1, 1, (pdf_range*) cmap_Adobe_Japan2_0_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Japan2_0_table,
+};
+
+/* EUC-H */
+
+static const pdf_range cmap_EUC_H_ranges[] = {
+{32,377,231},{36512,253,326},{41377,373,633},{41633,53,727},
+{41658,29,741},{41674,25,749},{41692,57,756},{41714,29,771},
+{41726,0,779},{41904,37,780},{41921,101,790},{41953,101,816},
+{42145,329,842},{42401,341,925},{42657,93,1011},{42689,93,1035},
+{42913,129,1059},{42961,129,1092},{43169,126,0},{45217,373,1125},
+{45473,373,1219},{45729,373,1313},{45985,373,1407},{46241,373,1501},
+{46497,373,1595},{46753,373,1689},{47009,373,1783},{47265,373,1877},
+{47521,373,1971},{47777,373,2065},{48033,373,2159},{48289,373,2253},
+{48545,373,2347},{48801,373,2441},{49057,373,2535},{49313,373,2629},
+{49569,373,2723},{49825,373,2817},{50081,373,2911},{50337,373,3005},
+{50593,373,3099},{50849,373,3193},{51105,373,3287},{51361,373,3381},
+{51617,373,3475},{51873,373,3569},{52129,373,3663},{52385,373,3757},
+{52641,373,3851},{52897,373,3945},{53153,201,4039},{53409,373,4090},
+{53665,373,4184},{53921,373,4278},{54177,373,4372},{54433,373,4466},
+{54689,373,4560},{54945,373,4654},{55201,373,4748},{55457,373,4842},
+{55713,373,4936},{55969,373,5030},{56225,373,5124},{56481,373,5218},
+{56737,373,5312},{56993,373,5406},{57249,373,5500},{57505,373,5594},
+{57761,373,5688},{58017,373,5782},{58273,373,5876},{58529,373,5970},
+{58785,373,6064},{59041,373,6158},{59297,373,6252},{59553,373,6346},
+{59809,373,6440},{60065,373,6534},{60321,373,6628},{60577,373,6722},
+{60833,373,6816},{61089,373,6910},{61345,373,7004},{61601,373,7098},
+{61857,373,7192},{62113,373,7286},{62369,373,7380},{62625,13,7474},
+{62629,5,8284},
+};
+
+static const unsigned short cmap_EUC_H_table[32] = {
+7479,7481,7491,7495,7503,7499,7507,7523,7515,7531,7539,7480,
+7482,7494,7498,7506,7502,7514,7530,7522,7538,7554,7511,7526,
+7519,7534,7542,7508,7527,7516,7535,7545,
+};
+
+static pdf_cmap cmap_EUC_H = {
+	-1, "EUC-H", "", 0, 0, 3,
+	{ {1,0,128},{2,36512,36575},{2,41377,65278}, },
+	89, 89, (pdf_range*) cmap_EUC_H_ranges,
+	32, 32, (unsigned short*) cmap_EUC_H_table,
+};
+
+/* EUC-V */
+
+static const pdf_range cmap_EUC_V_ranges[] = {
+{41378,5,7887},{41393,5,7889},{41404,9,7891},{41409,17,7894},
+{41418,69,7899},{41441,0,7917},{42145,0,7918},{42147,0,7919},
+{42149,0,7920},{42151,0,7921},{42153,0,7922},{42179,0,7923},
+{42211,0,7924},{42213,0,7925},{42215,0,7926},{42222,0,7927},
+{42401,0,7928},{42403,0,7929},{42405,0,7930},{42407,0,7931},
+{42409,0,7932},{42435,0,7933},{42467,0,7934},{42469,0,7935},
+{42471,0,7936},{42478,0,7937},{42485,5,7938},
+};
+
+static const unsigned short cmap_EUC_V_table[] = { 0 };
+
+static pdf_cmap cmap_EUC_V = {
+	-1, "EUC-V", "EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	27, 27, (pdf_range*) cmap_EUC_V_ranges,
+	0, 0, (unsigned short*) cmap_EUC_V_table,
+};
+
+/* Ext-H */
+
+static const pdf_range cmap_Ext_H_ranges[] = {
+{8481,285,633},{8553,0,7478},{8554,81,706},{8737,53,727},
+{9008,37,780},{9025,101,790},{9057,101,816},{9249,329,842},
+{9505,341,925},{9761,93,1011},{9793,93,1035},{10017,129,1059},
+{10065,129,1092},{10529,249,232},{10592,0,390},{10593,117,296},
+{10785,249,327},{10848,121,391},{11041,321,422},{11122,0,295},
+{11123,45,503},{11300,301,7479},{11553,117,7555},{11584,89,7585},
+{11615,0,8323},{11616,61,7608},{11632,10,0},{11635,25,7624},
+{11642,0,768},{11643,5,7631},{12321,6,3},{12323,61,1127},
+{12339,0,7330},{12340,25,1144},{12347,0,7634},{12348,197,1152},
+{12398,0,7635},{12399,13,1203},{12403,0,7636},{12404,29,1208},
+{12412,0,7637},{12413,5,1217},{12577,33,1219},{12586,0,7638},
+{12587,37,1229},{12597,0,7639},{12598,9,1240},{12601,0,7640},
+{12602,5,1244},{12604,5,7641},{12606,13,1248},{12610,0,7643},
+{12611,157,1253},{12651,0,7644},{12652,73,1294},{12833,25,1313},
+{12840,10,5},{12843,209,1323},{12896,0,7647},{12897,97,1377},
+{12922,0,7648},{12923,5,1403},{12925,6,8},{13089,6,10},
+{13091,121,1409},{13122,0,6497},{13123,21,1441},{13129,0,5023},
+{13130,105,1448},{13157,0,7651},{13158,17,1476},{13163,0,7652},
+{13164,25,1482},{13171,0,7653},{13172,5,1490},{13174,0,5937},
+{13175,9,1493},{13178,0,7654},{13179,13,1497},{13345,129,1501},
+{13378,6,12},{13380,33,1536},{13389,0,7656},{13390,13,1546},
+{13394,0,6688},{13395,69,1551},{13413,0,7657},{13414,97,1570},
+{13601,37,1595},{13611,0,7658},{13612,77,1606},{13632,0,7659},
+{13633,245,1627},{13857,6,14},{13859,25,1691},{13866,0,7661},
+{13867,105,1699},{13894,0,7474},{13895,29,1727},{13903,0,7662},
+{13904,113,1736},{13933,0,7663},{13934,21,1766},{13940,0,7664},
+{13941,21,1773},{13947,14,16},{14113,9,1783},{14116,0,7667},
+{14117,69,1787},{14135,0,7668},{14136,49,1806},{14149,0,7669},
+{14150,29,1820},{14158,0,7670},{14159,9,1829},{14162,0,7671},
+{14163,5,1833},{14165,0,7672},{14166,17,1836},{14171,0,7181},
+{14172,29,1842},{14180,0,7673},{14181,45,1851},{14193,0,7674},
+{14194,25,1864},{14201,0,7675},{14202,13,1872},{14206,0,7676},
+{14369,73,1877},{14388,0,7677},{14389,45,1897},{14401,0,7678},
+{14402,241,1910},{14625,37,1971},{14635,0,7679},{14636,41,1982},
+{14647,0,7680},{14648,37,1994},{14658,0,7681},{14659,97,2005},
+{14684,0,5853},{14685,61,2031},{14701,0,7682},{14702,21,2048},
+{14708,0,7683},{14709,13,2055},{14713,0,7684},{14714,17,2060},
+{14881,197,2065},{14931,0,7685},{14932,73,2116},{14951,0,7686},
+{14952,45,2136},{14964,0,7687},{14965,37,2149},{15137,21,2159},
+{15143,0,7688},{15144,5,2166},{15146,10,20},{15149,45,2171},
+{15161,0,7691},{15162,273,2184},{15393,89,2253},{15416,0,7692},
+{15417,57,2277},{15432,6,23},{15434,49,2294},{15447,0,7694},
+{15448,17,2308},{15453,5,7695},{15455,125,2315},{15649,37,2347},
+{15659,0,7697},{15660,37,2358},{15670,0,7698},{15671,209,2369},
+{15724,5,7699},{15726,13,2424},{15730,5,7701},{15732,41,2430},
+{15905,13,2441},{15909,0,7703},{15910,49,2446},{15923,0,7704},
+{15924,41,2460},{15935,0,7705},{15936,81,2472},{15957,0,7706},
+{15958,33,2494},{15967,0,7707},{15968,13,2504},{15972,0,7708},
+{15973,101,2509},{16161,33,2535},{16170,0,7709},{16171,181,2545},
+{16217,0,7710},{16218,21,2592},{16224,0,7711},{16225,29,2599},
+{16233,0,7712},{16234,81,2608},{16417,6,25},{16419,121,2631},
+{16450,0,7714},{16451,137,2663},{16486,0,7715},{16487,37,2699},
+{16497,5,7716},{16499,21,2711},{16505,5,7718},{16507,13,2719},
+{16673,21,2723},{16679,6,27},{16681,61,2731},{16697,0,7721},
+{16698,69,2748},{16716,0,7722},{16717,5,2767},{16719,0,7723},
+{16720,57,2770},{16735,0,7724},{16736,33,2786},{16745,0,7725},
+{16746,81,2796},{16929,109,2817},{16957,0,7726},{16958,57,2846},
+{16973,0,7727},{16974,53,2862},{16988,0,7728},{16989,21,2877},
+{16995,0,7729},{16996,41,2884},{17007,0,7730},{17008,17,2896},
+{17013,5,7731},{17015,21,2903},{17021,6,29},{17185,21,2911},
+{17191,6,31},{17193,5,7735},{17195,5,2921},{17197,5,7737},
+{17199,53,2925},{17213,0,7739},{17214,197,2940},{17264,0,7740},
+{17265,13,2991},{17269,0,7741},{17270,21,2996},{17276,0,7742},
+{17277,5,3003},{17441,109,3005},{17469,0,7743},{17470,37,3034},
+{17480,10,33},{17483,5,3047},{17485,10,36},{17488,41,3052},
+{17499,0,4533},{17500,137,3064},{17697,6,39},{17699,13,3101},
+{17703,0,7749},{17704,21,3106},{17710,0,7750},{17711,25,3113},
+{17718,0,7751},{17719,29,3121},{17727,0,7752},{17728,29,3130},
+{17736,0,7753},{17737,5,3139},{17739,0,7754},{17740,17,3142},
+{17745,5,7755},{17747,13,3149},{17751,0,5855},{17752,45,3154},
+{17764,0,7757},{17765,33,3167},{17774,0,5200},{17775,13,3177},
+{17779,0,5430},{17780,13,3182},{17784,0,7758},{17785,21,3187},
+{17953,113,3193},{17982,0,7759},{17983,9,3223},{17986,0,7760},
+{17987,65,3227},{18004,5,7761},{18006,17,3246},{18011,5,7763},
+{18013,13,3253},{18017,0,7765},{18018,13,3258},{18022,5,7766},
+{18024,5,3264},{18026,0,7768},{18027,41,3267},{18038,0,6893},
+{18039,29,3279},{18209,29,3287},{18217,0,7769},{18218,57,3296},
+{18233,0,7770},{18234,113,3312},{18263,0,7771},{18264,57,3342},
+{18279,10,41},{18282,9,3360},{18285,0,7774},{18286,65,3364},
+{18465,9,3381},{18468,0,7775},{18469,33,3385},{18478,10,44},
+{18481,137,3397},{18516,0,7778},{18517,49,3433},{18530,0,7779},
+{18531,69,3447},{18549,0,7780},{18550,33,3466},{18721,0,3475},
+{18722,5,7781},{18724,41,3478},{18735,14,47},{18739,5,3493},
+{18741,0,7785},{18742,37,3496},{18752,0,7786},{18753,49,3507},
+{18766,0,7787},{18767,5,3521},{18769,0,7788},{18770,177,3524},
+{18977,133,3569},{19011,0,7789},{19012,33,3604},{19021,0,7790},
+{19022,45,3614},{19034,0,7791},{19035,117,3627},{19065,0,7792},
+{19066,17,3658},{19233,6,51},{19235,21,3665},{19241,0,7794},
+{19242,129,3672},{19275,0,7795},{19276,117,3706},{19306,0,7475},
+{19307,17,3737},{19312,0,7796},{19313,29,3743},{19321,0,4143},
+{19322,17,3752},{19489,173,3757},{19533,0,7797},{19534,41,3802},
+{19545,0,7798},{19546,17,3814},{19551,0,7799},{19552,5,3820},
+{19554,0,7800},{19555,85,3823},{19577,22,53},{19745,65,3851},
+{19762,0,7804},{19763,113,3869},{19792,0,7805},{19793,9,3899},
+{19796,0,7806},{19797,17,3903},{19802,0,7476},{19803,53,3909},
+{19817,0,7807},{19818,81,3924},{20001,165,3945},{20043,0,7808},
+{20044,181,3988},{20090,5,7809},{20092,9,4036},{20257,0,7811},
+{20258,57,4040},{20273,0,7812},{20274,13,4056},{20278,0,6007},
+{20279,5,4061},{20281,0,7813},{20282,101,4064},{20513,209,4090},
+{20566,0,3751},{20567,157,4144},{20769,109,4184},{20797,0,7814},
+{20798,33,4213},{20807,0,7815},{20808,9,4223},{20811,10,59},
+{20814,193,4229},{21025,373,4278},{21281,57,4372},{21296,0,7818},
+{21297,33,4388},{21306,0,7819},{21307,81,4398},{21328,0,7820},
+{21329,49,4420},{21342,0,7821},{21343,45,4434},{21355,0,7822},
+{21356,73,4447},{21537,137,4466},{21572,0,7823},{21573,121,4502},
+{21604,0,3063},{21605,101,4534},{21793,109,4560},{21821,0,7824},
+{21822,145,4589},{21859,0,7825},{21860,105,4627},{22049,6,62},
+{22051,313,4656},{22130,0,7827},{22131,45,4736},{22305,373,4748},
+{22561,9,4842},{22564,0,7828},{22565,357,4846},{22817,249,4936},
+{22880,0,7829},{22881,41,5000},{22892,0,7830},{22893,41,5012},
+{22904,0,1447},{22905,21,5024},{23073,93,5030},{23097,0,7831},
+{23098,73,5055},{23117,0,7832},{23118,193,5075},{23329,141,5124},
+{23365,0,7833},{23366,13,5161},{23370,0,7834},{23371,49,5166},
+{23384,0,3490},{23385,69,5180},{23403,10,64},{23406,21,5201},
+{23412,0,7836},{23413,37,5208},{23585,373,5218},{23841,373,5312},
+{24097,93,5406},{24121,0,3181},{24122,85,5431},{24144,0,7837},
+{24145,141,5454},{24181,0,1535},{24182,33,5491},{24353,325,5500},
+{24435,0,7838},{24436,41,5583},{24609,17,5594},{24614,0,7839},
+{24615,221,5600},{24671,0,7840},{24672,85,5657},{24694,0,7477},
+{24695,29,5680},{24865,37,5688},{24875,0,7841},{24876,13,5699},
+{24880,5,7842},{24882,305,5705},{25121,37,5782},{25131,0,7844},
+{25132,237,5793},{25192,10,67},{25195,13,5856},{25199,0,7845},
+{25200,57,5861},{25377,161,5876},{25418,0,7846},{25419,33,5918},
+{25428,0,7847},{25429,33,5928},{25438,0,1492},{25439,125,5938},
+{25633,93,5970},{25657,0,7848},{25658,45,5995},{25670,0,4060},
+{25671,113,6008},{25700,0,7849},{25701,33,6038},{25710,0,7850},
+{25711,61,6048},{25889,93,6064},{25913,10,70},{25916,37,6091},
+{25926,0,7853},{25927,221,6102},{26145,145,6158},{26182,0,7854},
+{26183,221,6196},{26401,265,6252},{26468,0,7855},{26469,13,6320},
+{26473,0,7856},{26474,29,6325},{26482,0,7857},{26483,45,6334},
+{26657,73,6346},{26676,0,7858},{26677,21,6366},{26683,0,7859},
+{26684,221,6373},{26740,0,7860},{26741,37,6430},{26913,6,73},
+{26915,41,6442},{26926,0,3845},{26927,49,6454},{26940,0,7861},
+{26941,113,6468},{26970,0,1440},{26971,141,6498},{27169,9,6534},
+{27172,0,3358},{27173,5,6538},{27175,0,7862},{27176,81,6541},
+{27197,0,7863},{27198,193,6563},{27247,0,7864},{27248,57,6613},
+{27425,65,6628},{27442,0,7865},{27443,165,6646},{27485,0,1550},
+{27486,29,6689},{27494,0,7866},{27495,57,6698},{27510,0,7867},
+{27511,29,6714},{27681,173,6722},{27725,0,2730},{27726,105,6767},
+{27753,0,7868},{27754,37,6795},{27764,0,7869},{27765,37,6806},
+{27937,177,6816},{27982,0,7870},{27983,113,6862},{28012,10,75},
+{28015,61,6894},{28193,29,6910},{28201,0,7873},{28202,73,6919},
+{28221,0,7874},{28222,97,6939},{28247,0,7875},{28248,153,6965},
+{28449,269,7004},{28517,0,7876},{28518,97,7073},{28705,69,7098},
+{28723,0,7877},{28724,65,7117},{28741,0,7878},{28742,41,7135},
+{28753,0,7879},{28754,17,7147},{28759,0,7880},{28760,109,7153},
+{28788,6,78},{28790,33,7183},{28961,373,7192},{29217,45,7286},
+{29229,0,7882},{29230,53,7299},{29244,0,7883},{29245,61,7314},
+{29261,6,80},{29263,145,7332},{29300,0,1321},{29301,37,7370},
+{29473,189,7380},{29521,0,7885},{29522,169,7429},{29565,6,82},
+{31009,373,8359},{31265,81,8453},{31286,0,1993},{31287,285,8474},
+{31521,373,8546},{31777,309,8640},{31857,37,8092},{31867,0,751},
+{31868,9,8005},
+};
+
+static const unsigned short cmap_Ext_H_table[84] = {
+762,761,769,1125,7633,7645,7369,7646,7649,1406,1407,7650,
+7655,5490,1689,7660,7665,1780,7666,1782,7689,2169,7690,7693,
+6441,2629,7713,7720,6766,7733,2910,7734,2918,7744,3045,7745,
+7746,3050,7747,3099,7748,7772,6537,7773,7776,3395,7777,7783,
+5179,3491,7784,3663,7793,6453,7801,3847,7802,3849,7803,7816,
+4227,7817,4654,7826,7835,5199,3176,2030,5854,3153,7851,6089,
+7852,6440,2293,7871,6892,7872,1841,7881,1143,7884,7886,7473,
+};
+
+static pdf_cmap cmap_Ext_H = {
+	-1, "Ext-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	609, 609, (pdf_range*) cmap_Ext_H_ranges,
+	84, 84, (unsigned short*) cmap_Ext_H_table,
+};
+
+/* Ext-RKSJ-H */
+
+static const pdf_range cmap_Ext_RKSJ_H_ranges[] = {
+{32,377,231},{160,253,326},{33088,249,633},{33152,33,696},
+{33161,0,7478},{33162,137,706},{33359,37,780},{33376,101,790},
+{33409,101,816},{33439,329,842},{33600,249,925},{33664,89,988},
+{33695,93,1011},{33727,93,1035},{33856,129,1059},{33904,57,1092},
+{33920,69,1107},{34112,249,232},{34176,0,390},{34177,117,296},
+{34207,249,327},{34270,121,391},{34368,249,422},{34432,69,485},
+{34450,0,295},{34451,45,503},{34466,301,7479},{34624,117,7555},
+{34655,89,7585},{34686,0,8323},{34688,61,7608},{34704,10,0},
+{34707,25,7624},{34714,0,768},{34715,5,7631},{34975,6,3},
+{34977,61,1127},{34993,0,7330},{34994,25,1144},{35001,0,7634},
+{35002,197,1152},{35052,0,7635},{35053,13,1203},{35057,0,7636},
+{35058,29,1208},{35066,0,7637},{35067,5,1217},{35136,33,1219},
+{35145,0,7638},{35146,37,1229},{35156,0,7639},{35157,9,1240},
+{35160,0,7640},{35161,5,1244},{35163,5,7641},{35165,13,1248},
+{35169,0,7643},{35170,113,1253},{35200,41,1282},{35211,0,7644},
+{35212,101,1294},{35238,10,5},{35241,209,1323},{35294,0,7647},
+{35295,97,1377},{35320,0,7648},{35321,5,1403},{35323,6,8},
+{35392,6,10},{35394,121,1409},{35425,0,6497},{35426,21,1441},
+{35432,0,5023},{35433,85,1448},{35456,17,1470},{35461,0,7651},
+{35462,17,1476},{35467,0,7652},{35468,25,1482},{35475,0,7653},
+{35476,5,1490},{35478,0,5937},{35479,9,1493},{35482,0,7654},
+{35483,145,1497},{35520,6,12},{35522,33,1536},{35531,0,7656},
+{35532,13,1546},{35536,0,6688},{35537,69,1551},{35555,0,7657},
+{35556,97,1570},{35648,37,1595},{35658,0,7658},{35659,77,1606},
+{35679,0,7659},{35680,121,1627},{35712,125,1658},{35744,0,7660},
+{35745,25,1691},{35752,0,7661},{35753,105,1699},{35780,0,7474},
+{35781,29,1727},{35789,0,7662},{35790,113,1736},{35819,0,7663},
+{35820,21,1766},{35826,0,7664},{35827,21,1773},{35833,14,14},
+{35904,9,1783},{35907,0,7667},{35908,69,1787},{35926,0,7668},
+{35927,49,1806},{35940,0,7669},{35941,29,1820},{35949,0,7670},
+{35950,9,1829},{35953,0,7671},{35954,5,1833},{35956,0,7672},
+{35957,17,1836},{35962,0,7181},{35963,13,1842},{35968,13,1846},
+{35972,0,7673},{35973,45,1851},{35985,0,7674},{35986,25,1864},
+{35993,0,7675},{35994,13,1872},{35998,0,7676},{35999,73,1877},
+{36018,0,7677},{36019,45,1897},{36031,0,7678},{36032,241,1910},
+{36160,37,1971},{36170,0,7679},{36171,41,1982},{36182,0,7680},
+{36183,37,1994},{36193,0,7681},{36194,97,2005},{36219,0,5853},
+{36220,9,2031},{36224,49,2034},{36237,0,7682},{36238,21,2048},
+{36244,0,7683},{36245,13,2055},{36249,0,7684},{36250,217,2060},
+{36305,0,7685},{36306,73,2116},{36325,0,7686},{36326,45,2136},
+{36338,0,7687},{36339,37,2149},{36416,21,2159},{36422,0,7688},
+{36423,5,2166},{36425,10,18},{36428,45,2171},{36440,0,7691},
+{36441,149,2184},{36480,213,2222},{36534,0,7692},{36535,57,2277},
+{36550,6,21},{36552,49,2294},{36565,0,7694},{36566,17,2308},
+{36571,5,7695},{36573,125,2315},{36672,37,2347},{36682,0,7697},
+{36683,37,2358},{36693,0,7698},{36694,161,2369},{36736,45,2410},
+{36748,5,7699},{36750,13,2424},{36754,5,7701},{36756,57,2430},
+{36771,0,7703},{36772,49,2446},{36785,0,7704},{36786,41,2460},
+{36797,0,7705},{36798,81,2472},{36819,0,7706},{36820,33,2494},
+{36829,0,7707},{36830,13,2504},{36834,0,7708},{36835,101,2509},
+{36928,33,2535},{36937,0,7709},{36938,181,2545},{36984,0,7710},
+{36985,21,2592},{36992,0,7711},{36993,29,2599},{37001,0,7712},
+{37002,85,2608},{37024,0,7713},{37025,121,2631},{37056,0,7714},
+{37057,137,2663},{37092,0,7715},{37093,37,2699},{37103,5,7716},
+{37105,21,2711},{37111,5,7718},{37113,13,2719},{37184,21,2723},
+{37190,6,23},{37192,61,2731},{37208,0,7721},{37209,69,2748},
+{37227,0,7722},{37228,5,2767},{37230,0,7723},{37231,57,2770},
+{37246,0,7724},{37248,33,2786},{37257,0,7725},{37258,193,2796},
+{37307,0,7726},{37308,57,2846},{37323,0,7727},{37324,53,2862},
+{37338,0,7728},{37339,21,2877},{37345,0,7729},{37346,41,2884},
+{37357,0,7730},{37358,17,2896},{37363,5,7731},{37365,21,2903},
+{37371,6,25},{37440,21,2911},{37446,6,27},{37448,5,7735},
+{37450,5,2921},{37452,5,7737},{37454,53,2925},{37468,0,7739},
+{37469,133,2940},{37504,61,2974},{37520,0,7740},{37521,13,2991},
+{37525,0,7741},{37526,21,2996},{37532,0,7742},{37533,117,3003},
+{37563,0,7743},{37564,37,3034},{37574,10,29},{37577,5,3047},
+{37579,10,32},{37582,41,3052},{37593,0,4533},{37594,137,3064},
+{37696,6,35},{37698,13,3101},{37702,0,7749},{37703,21,3106},
+{37709,0,7750},{37710,25,3113},{37717,0,7751},{37718,29,3121},
+{37726,0,7752},{37727,29,3130},{37735,0,7753},{37736,5,3139},
+{37738,0,7754},{37739,17,3142},{37744,5,7755},{37746,13,3149},
+{37750,0,5855},{37751,29,3154},{37760,13,3162},{37764,0,7757},
+{37765,33,3167},{37774,0,5200},{37775,13,3177},{37779,0,5430},
+{37780,13,3182},{37784,0,7758},{37785,137,3187},{37820,0,7759},
+{37821,9,3223},{37824,0,7760},{37825,65,3227},{37842,5,7761},
+{37844,17,3246},{37849,5,7763},{37851,13,3253},{37855,0,7765},
+{37856,13,3258},{37860,5,7766},{37862,5,3264},{37864,0,7768},
+{37865,41,3267},{37876,0,6893},{37877,29,3279},{37952,29,3287},
+{37960,0,7769},{37961,57,3296},{37976,0,7770},{37977,113,3312},
+{38006,0,7771},{38007,29,3342},{38016,25,3350},{38023,10,37},
+{38026,9,3360},{38029,0,7774},{38030,77,3364},{38050,0,7775},
+{38051,33,3385},{38060,10,40},{38063,137,3397},{38098,0,7778},
+{38099,49,3433},{38112,0,7779},{38113,69,3447},{38131,0,7780},
+{38132,33,3466},{38208,0,3475},{38209,5,7781},{38211,41,3478},
+{38222,14,43},{38226,5,3493},{38228,0,7785},{38229,37,3496},
+{38239,0,7786},{38240,49,3507},{38253,0,7787},{38254,5,3521},
+{38256,0,7788},{38257,53,3524},{38272,257,3538},{38337,0,7789},
+{38338,33,3604},{38347,0,7790},{38348,45,3614},{38360,0,7791},
+{38361,117,3627},{38391,0,7792},{38392,17,3658},{38464,6,47},
+{38466,21,3665},{38472,0,7794},{38473,129,3672},{38506,0,7795},
+{38507,77,3706},{38528,37,3726},{38538,0,7475},{38539,17,3737},
+{38544,0,7796},{38545,29,3743},{38553,0,4143},{38554,193,3752},
+{38603,0,7797},{38604,41,3802},{38615,0,7798},{38616,17,3814},
+{38621,0,7799},{38622,5,3820},{38624,0,7800},{38625,85,3823},
+{38647,22,49},{38720,65,3851},{38737,0,7804},{38738,113,3869},
+{38767,0,7805},{38768,9,3899},{38771,0,7806},{38772,17,3903},
+{38777,0,7476},{38778,17,3909},{38784,33,3914},{38793,0,7807},
+{38794,249,3924},{38857,0,7808},{38858,181,3988},{38904,5,7809},
+{38906,9,4036},{38976,0,7811},{38977,57,4040},{38992,0,7812},
+{38993,13,4056},{38997,0,6007},{38998,5,4061},{39000,0,7813},
+{39001,101,4064},{39071,209,4090},{39124,0,3751},{39125,157,4144},
+{39232,109,4184},{39260,0,7814},{39261,33,4213},{39270,0,7815},
+{39271,9,4223},{39274,10,55},{39277,69,4229},{39296,497,4247},
+{39488,57,4372},{39503,0,7818},{39504,33,4388},{39513,0,7819},
+{39514,81,4398},{39535,0,7820},{39536,49,4420},{39549,6,58},
+{39552,41,4435},{39563,0,7822},{39564,213,4447},{39618,0,7823},
+{39619,121,4502},{39650,0,3063},{39651,101,4534},{39744,109,4560},
+{39772,0,7824},{39773,133,4589},{39808,9,4623},{39811,0,7825},
+{39812,109,4627},{39840,0,7826},{39841,313,4656},{39920,0,7827},
+{39921,45,4736},{40000,249,4748},{40064,133,4811},{40098,0,7828},
+{40099,357,4846},{40256,249,4936},{40320,0,7829},{40321,41,5000},
+{40332,0,7830},{40333,41,5012},{40344,0,1447},{40345,117,5024},
+{40375,0,7831},{40376,73,5055},{40395,0,7832},{40396,193,5075},
+{40512,141,5124},{40548,0,7833},{40549,13,5161},{40553,0,7834},
+{40554,49,5166},{40567,0,3490},{40568,25,5180},{40576,41,5187},
+{40587,10,60},{40590,21,5201},{40596,0,7836},{40597,413,5208},
+{40768,249,5312},{40832,217,5375},{40887,0,3181},{40888,85,5431},
+{40910,0,7837},{40911,141,5454},{40947,0,1535},{40948,33,5491},
+{57408,249,5500},{57472,73,5563},{57491,0,7838},{57492,61,5583},
+{57508,0,7839},{57509,221,5600},{57565,0,7840},{57566,85,5657},
+{57588,0,7477},{57589,29,5680},{57664,37,5688},{57674,0,7841},
+{57675,13,5699},{57679,5,7842},{57681,181,5705},{57728,161,5751},
+{57769,0,7844},{57770,237,5793},{57830,10,63},{57833,13,5856},
+{57837,0,7845},{57838,57,5861},{57920,161,5876},{57961,0,7846},
+{57962,33,5918},{57971,0,7847},{57972,33,5928},{57981,6,66},
+{57984,217,5939},{58039,0,7848},{58040,45,5995},{58052,0,4060},
+{58053,113,6008},{58082,0,7849},{58083,33,6038},{58092,0,7850},
+{58093,61,6048},{58176,93,6064},{58200,10,68},{58203,37,6091},
+{58213,0,7853},{58214,97,6102},{58240,269,6127},{58308,0,7854},
+{58309,221,6196},{58432,249,6252},{58496,13,6315},{58500,0,7855},
+{58501,13,6320},{58505,0,7856},{58506,29,6325},{58514,0,7857},
+{58515,121,6334},{58546,0,7858},{58547,21,6366},{58553,0,7859},
+{58554,221,6373},{58610,0,7860},{58611,37,6430},{58688,6,71},
+{58690,41,6442},{58701,0,3845},{58702,49,6454},{58715,0,7861},
+{58716,113,6468},{58745,0,1440},{58746,17,6498},{58752,133,6503},
+{58786,0,3358},{58787,5,6538},{58789,0,7862},{58790,81,6541},
+{58811,0,7863},{58812,193,6563},{58861,0,7864},{58862,57,6613},
+{58944,65,6628},{58961,0,7865},{58962,165,6646},{59004,0,1550},
+{59005,5,6689},{59008,21,6691},{59014,0,7866},{59015,57,6698},
+{59030,0,7867},{59031,205,6714},{59083,0,2730},{59084,105,6767},
+{59111,0,7868},{59112,37,6795},{59122,0,7869},{59123,37,6806},
+{59200,177,6816},{59245,0,7870},{59246,65,6862},{59264,45,6879},
+{59276,10,73},{59279,93,6894},{59303,0,7873},{59304,73,6919},
+{59323,0,7874},{59324,97,6939},{59349,0,7875},{59350,153,6965},
+{59456,249,7004},{59520,17,7067},{59525,0,7876},{59526,169,7073},
+{59569,0,7877},{59570,65,7117},{59587,0,7878},{59588,41,7135},
+{59599,0,7879},{59600,17,7147},{59605,0,7880},{59606,109,7153},
+{59634,6,76},{59636,33,7183},{59712,249,7192},{59776,169,7255},
+{59819,0,7882},{59820,53,7299},{59834,0,7883},{59835,61,7314},
+{59851,6,78},{59853,145,7332},{59890,0,1321},{59891,37,7370},
+{59968,189,7380},{60016,0,7885},{60017,53,7429},{60032,113,7443},
+{60061,6,80},{60736,249,8359},{60800,205,8422},{60852,0,1993},
+{60853,285,8474},{60992,249,8546},{61056,433,8609},{61167,37,8092},
+{61177,0,751},{61178,9,8005},
+};
+
+static const unsigned short cmap_Ext_RKSJ_H_table[82] = {
+762,761,769,1125,7633,7645,7369,7646,7649,1406,1407,7650,
+7655,5490,7665,1780,7666,1782,7689,2169,7690,7693,6441,7720,
+6766,7733,2910,7734,2918,7744,3045,7745,7746,3050,7747,3099,
+7748,7772,6537,7773,7776,3395,7777,7783,5179,3491,7784,3663,
+7793,6453,7801,3847,7802,3849,7803,7816,4227,7817,7821,4434,
+7835,5199,3176,2030,5854,3153,1492,5938,7851,6089,7852,6440,
+2293,7871,6892,7872,1841,7881,1143,7884,7886,7473,
+};
+
+static pdf_cmap cmap_Ext_RKSJ_H = {
+	-1, "Ext-RKSJ-H", "", 0, 0, 4,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764}, },
+	614, 614, (pdf_range*) cmap_Ext_RKSJ_H_ranges,
+	82, 82, (unsigned short*) cmap_Ext_RKSJ_H_table,
+};
+
+/* Ext-RKSJ-V */
+
+static const pdf_range cmap_Ext_RKSJ_V_ranges[] = {
+{33089,5,7887},{33091,6,0},{33098,6,2},{33115,9,7891},
+{33120,17,7894},{33125,14,4},{33129,69,7899},{33163,10,8},
+{33196,0,8270},{33439,0,7918},{33441,0,7919},{33443,0,7920},
+{33445,0,7921},{33447,0,7922},{33473,0,7923},{33505,0,7924},
+{33507,0,7925},{33509,0,7926},{33516,0,7927},{33600,0,7928},
+{33602,0,7929},{33604,0,7930},{33606,0,7931},{33608,0,7932},
+{33634,0,7933},{33667,0,7934},{33669,0,7935},{33671,0,7936},
+{33678,0,7937},{33685,5,7938},{34655,61,7940},{34688,5,7956},
+};
+
+static const unsigned short cmap_Ext_RKSJ_V_table[11] = {
+8268,8274,8272,8271,8281,8276,8279,8278,8269,8273,8283,
+};
+
+static pdf_cmap cmap_Ext_RKSJ_V = {
+	-1, "Ext-RKSJ-V", "Ext-RKSJ-H", 0, 1, 0,
+	{ {0,0,0}, },
+	32, 32, (pdf_range*) cmap_Ext_RKSJ_V_ranges,
+	11, 11, (unsigned short*) cmap_Ext_RKSJ_V_table,
+};
+
+/* Ext-V */
+
+static const pdf_range cmap_Ext_V_ranges[] = {
+{8482,5,7887},{8484,6,0},{8491,6,2},{8508,9,7891},
+{8513,17,7894},{8518,14,4},{8522,69,7899},{8555,10,8},
+{8750,0,8270},{9249,0,7918},{9251,0,7919},{9253,0,7920},
+{9255,0,7921},{9257,0,7922},{9283,0,7923},{9315,0,7924},
+{9317,0,7925},{9319,0,7926},{9326,0,7927},{9505,0,7928},
+{9507,0,7929},{9509,0,7930},{9511,0,7931},{9513,0,7932},
+{9539,0,7933},{9571,0,7934},{9573,0,7935},{9575,0,7936},
+{9582,0,7937},{9589,5,7938},{11584,61,7940},{11616,5,7956},
+};
+
+static const unsigned short cmap_Ext_V_table[11] = {
+8268,8274,8272,8271,8281,8276,8279,8278,8269,8273,8283,
+};
+
+static pdf_cmap cmap_Ext_V = {
+	-1, "Ext-V", "Ext-H", 0, 1, 0,
+	{ {0,0,0}, },
+	32, 32, (pdf_range*) cmap_Ext_V_ranges,
+	11, 11, (unsigned short*) cmap_Ext_V_table,
+};
+
+/* H */
+
+static const pdf_range cmap_H_ranges[] = {
+{8481,373,633},{8737,53,727},{8762,29,741},{8778,25,749},
+{8796,57,756},{8818,29,771},{8830,0,779},{9008,37,780},
+{9025,101,790},{9057,101,816},{9249,329,842},{9505,341,925},
+{9761,93,1011},{9793,93,1035},{10017,129,1059},{10065,129,1092},
+{10273,126,0},{12321,373,1125},{12577,373,1219},{12833,373,1313},
+{13089,373,1407},{13345,373,1501},{13601,373,1595},{13857,373,1689},
+{14113,373,1783},{14369,373,1877},{14625,373,1971},{14881,373,2065},
+{15137,373,2159},{15393,373,2253},{15649,373,2347},{15905,373,2441},
+{16161,373,2535},{16417,373,2629},{16673,373,2723},{16929,373,2817},
+{17185,373,2911},{17441,373,3005},{17697,373,3099},{17953,373,3193},
+{18209,373,3287},{18465,373,3381},{18721,373,3475},{18977,373,3569},
+{19233,373,3663},{19489,373,3757},{19745,373,3851},{20001,373,3945},
+{20257,201,4039},{20513,373,4090},{20769,373,4184},{21025,373,4278},
+{21281,373,4372},{21537,373,4466},{21793,373,4560},{22049,373,4654},
+{22305,373,4748},{22561,373,4842},{22817,373,4936},{23073,373,5030},
+{23329,373,5124},{23585,373,5218},{23841,373,5312},{24097,373,5406},
+{24353,373,5500},{24609,373,5594},{24865,373,5688},{25121,373,5782},
+{25377,373,5876},{25633,373,5970},{25889,373,6064},{26145,373,6158},
+{26401,373,6252},{26657,373,6346},{26913,373,6440},{27169,373,6534},
+{27425,373,6628},{27681,373,6722},{27937,373,6816},{28193,373,6910},
+{28449,373,7004},{28705,373,7098},{28961,373,7192},{29217,373,7286},
+{29473,373,7380},{29729,13,7474},{29733,5,8284},
+};
+
+static const unsigned short cmap_H_table[32] = {
+7479,7481,7491,7495,7503,7499,7507,7523,7515,7531,7539,7480,
+7482,7494,7498,7506,7502,7514,7530,7522,7538,7554,7511,7526,
+7519,7534,7542,7508,7527,7516,7535,7545,
+};
+
+static pdf_cmap cmap_H = {
+	-1, "H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	87, 87, (pdf_range*) cmap_H_ranges,
+	32, 32, (unsigned short*) cmap_H_table,
+};
+
+/* Hankaku */
+
+static const pdf_range cmap_Hankaku_ranges[] = {
+{32,253,231},{96,0,231},{97,117,296},{129,17,327},
+{134,37,516},{144,0,342},{145,57,526},{161,249,327},
+{224,117,541},{254,5,388},
+};
+
+static const unsigned short cmap_Hankaku_table[] = { 0 };
+
+static pdf_cmap cmap_Hankaku = {
+	-1, "Hankaku", "", 0, 0, 1,
+	{ {1,0,255}, },
+	10, 10, (pdf_range*) cmap_Hankaku_ranges,
+	0, 0, (unsigned short*) cmap_Hankaku_table,
+};
+
+/* Hiragana */
+
+static const pdf_range cmap_Hiragana_ranges[] = {
+{32,0,515},{33,17,327},{38,37,516},{48,0,342},
+{49,177,526},{94,5,388},{96,9,571},{102,97,574},
+};
+
+static const unsigned short cmap_Hiragana_table[] = { 0 };
+
+static pdf_cmap cmap_Hiragana = {
+	-1, "Hiragana", "", 0, 0, 1,
+	{ {1,0,255}, },
+	8, 8, (pdf_range*) cmap_Hiragana_ranges,
+	0, 0, (unsigned short*) cmap_Hiragana_table,
+};
+
+/* Hojo-EUC-H */
+
+static const pdf_range cmap_Hojo_EUC_H_ranges[] = {
+{41647,41,1},{41666,9,12},{41707,25,15},{42721,17,22},
+{42727,0,27},{42729,5,28},{42732,0,30},{42737,45,31},
+{42946,49,43},{42994,49,56},{43425,5,69},{43428,0,71},
+{43430,0,72},{43432,5,73},{43435,9,75},{43439,5,78},
+{43457,61,80},{43681,93,96},{43706,245,120},{43937,105,182},
+{43965,25,209},{43973,201,216},{45217,373,267},{45473,373,361},
+{45729,373,455},{45985,373,549},{46241,373,643},{46497,373,737},
+{46753,373,831},{47009,373,925},{47265,373,1019},{47521,373,1113},
+{47777,373,1207},{48033,373,1301},{48289,373,1395},{48545,373,1489},
+{48801,373,1583},{49057,373,1677},{49313,373,1771},{49569,373,1865},
+{49825,373,1959},{50081,373,2053},{50337,373,2147},{50593,373,2241},
+{50849,373,2335},{51105,373,2429},{51361,373,2523},{51617,373,2617},
+{51873,373,2711},{52129,373,2805},{52385,373,2899},{52641,373,2993},
+{52897,373,3087},{53153,373,3181},{53409,373,3275},{53665,373,3369},
+{53921,373,3463},{54177,373,3557},{54433,373,3651},{54689,373,3745},
+{54945,373,3839},{55201,373,3933},{55457,373,4027},{55713,373,4121},
+{55969,373,4215},{56225,373,4309},{56481,373,4403},{56737,373,4497},
+{56993,373,4591},{57249,373,4685},{57505,373,4779},{57761,373,4873},
+{58017,373,4967},{58273,373,5061},{58529,373,5155},{58785,373,5249},
+{59041,373,5343},{59297,373,5437},{59553,373,5531},{59809,373,5625},
+{60065,373,5719},{60321,373,5813},{60577,373,5907},{60833,265,6001},
+};
+
+static const unsigned short cmap_Hojo_EUC_H_table[] = { 0 };
+
+static pdf_cmap cmap_Hojo_EUC_H = {
+	-1, "Hojo-EUC-H", "", 0, 0, 1,
+	{ {3,41377,65278}, },
+	84, 84, (pdf_range*) cmap_Hojo_EUC_H_ranges,
+	0, 0, (unsigned short*) cmap_Hojo_EUC_H_table,
+};
+
+/* Hojo-EUC-V */
+
+static const pdf_range cmap_Hojo_EUC_V_ranges[] = { {0,1,0}
+};
+
+static const unsigned short cmap_Hojo_EUC_V_table[] = { 0 };
+
+static pdf_cmap cmap_Hojo_EUC_V = {
+	-1, "Hojo-EUC-V", "Hojo-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	0, 0, (pdf_range*) cmap_Hojo_EUC_V_ranges,
+	0, 0, (unsigned short*) cmap_Hojo_EUC_V_table,
+};
+
+/* Hojo-H */
+
+static const pdf_range cmap_Hojo_H_ranges[] = {
+{8751,41,1},{8770,9,12},{8811,25,15},{9825,17,22},
+{9831,0,27},{9833,5,28},{9836,0,30},{9841,45,31},
+{10050,49,43},{10098,49,56},{10529,5,69},{10532,0,71},
+{10534,0,72},{10536,5,73},{10539,9,75},{10543,5,78},
+{10561,61,80},{10785,93,96},{10810,245,120},{11041,105,182},
+{11069,25,209},{11077,201,216},{12321,373,267},{12577,373,361},
+{12833,373,455},{13089,373,549},{13345,373,643},{13601,373,737},
+{13857,373,831},{14113,373,925},{14369,373,1019},{14625,373,1113},
+{14881,373,1207},{15137,373,1301},{15393,373,1395},{15649,373,1489},
+{15905,373,1583},{16161,373,1677},{16417,373,1771},{16673,373,1865},
+{16929,373,1959},{17185,373,2053},{17441,373,2147},{17697,373,2241},
+{17953,373,2335},{18209,373,2429},{18465,373,2523},{18721,373,2617},
+{18977,373,2711},{19233,373,2805},{19489,373,2899},{19745,373,2993},
+{20001,373,3087},{20257,373,3181},{20513,373,3275},{20769,373,3369},
+{21025,373,3463},{21281,373,3557},{21537,373,3651},{21793,373,3745},
+{22049,373,3839},{22305,373,3933},{22561,373,4027},{22817,373,4121},
+{23073,373,4215},{23329,373,4309},{23585,373,4403},{23841,373,4497},
+{24097,373,4591},{24353,373,4685},{24609,373,4779},{24865,373,4873},
+{25121,373,4967},{25377,373,5061},{25633,373,5155},{25889,373,5249},
+{26145,373,5343},{26401,373,5437},{26657,373,5531},{26913,373,5625},
+{27169,373,5719},{27425,373,5813},{27681,373,5907},{27937,265,6001},
+};
+
+static const unsigned short cmap_Hojo_H_table[] = { 0 };
+
+static pdf_cmap cmap_Hojo_H = {
+	-1, "Hojo-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	84, 84, (pdf_range*) cmap_Hojo_H_ranges,
+	0, 0, (unsigned short*) cmap_Hojo_H_table,
+};
+
+/* Hojo-V */
+
+static const pdf_range cmap_Hojo_V_ranges[] = { {0,1,0}
+};
+
+static const unsigned short cmap_Hojo_V_table[] = { 0 };
+
+static pdf_cmap cmap_Hojo_V = {
+	-1, "Hojo-V", "Hojo-H", 0, 1, 0,
+	{ {0,0,0}, },
+	0, 0, (pdf_range*) cmap_Hojo_V_ranges,
+	0, 0, (unsigned short*) cmap_Hojo_V_table,
+};
+
+/* Katakana */
+
+static const pdf_range cmap_Katakana_ranges[] = {
+{32,253,326},{96,121,391},
+};
+
+static const unsigned short cmap_Katakana_table[] = { 0 };
+
+static pdf_cmap cmap_Katakana = {
+	-1, "Katakana", "", 0, 0, 1,
+	{ {1,0,255}, },
+	2, 2, (pdf_range*) cmap_Katakana_ranges,
+	0, 0, (unsigned short*) cmap_Katakana_table,
+};
+
+/* NWP-H */
+
+static const pdf_range cmap_NWP_H_ranges[] = {
+{8481,285,633},{8553,0,7478},{8554,81,706},{8737,53,727},
+{8762,29,741},{8778,25,749},{8796,57,756},{8818,29,771},
+{8830,0,779},{9008,37,780},{9025,101,790},{9057,101,816},
+{9249,329,842},{9505,341,925},{9761,93,1011},{9793,93,1035},
+{10017,129,1059},{10065,129,1092},{10529,249,232},{10592,0,390},
+{10593,117,296},{10785,249,327},{10848,121,391},{11041,321,422},
+{11122,0,295},{11123,45,503},{11300,301,7479},{11553,117,7555},
+{11584,89,7585},{11616,61,7608},{11632,10,0},{11635,25,7624},
+{11642,0,768},{11643,5,7631},{11809,26,3},{11816,5,674},
+{11818,22,10},{11824,37,780},{11834,5,639},{11836,18,16},
+{11841,101,790},{11867,22,21},{11873,101,816},{11899,14,27},
+{12065,0,635},{12066,5,686},{12068,66,31},{12085,5,934},
+{12087,54,48},{12101,21,966},{12107,14,62},{12111,17,986},
+{12116,6,66},{12118,21,996},{12124,6,68},{12126,5,643},
+{12128,5,1004},{12130,0,1002},{12131,5,1009},{12133,62,70},
+{12149,5,972},{12151,5,975},{12153,5,978},{12155,5,981},
+{12157,5,984},{12321,6,86},{12323,61,1127},{12339,0,7330},
+{12340,25,1144},{12347,0,7634},{12348,197,1152},{12398,0,7635},
+{12399,13,1203},{12403,0,7636},{12404,29,1208},{12412,0,7637},
+{12413,5,1217},{12577,33,1219},{12586,0,7638},{12587,37,1229},
+{12597,0,7639},{12598,9,1240},{12601,0,7640},{12602,5,1244},
+{12604,5,7641},{12606,13,1248},{12610,0,7643},{12611,157,1253},
+{12651,0,7644},{12652,73,1294},{12833,25,1313},{12840,10,88},
+{12843,209,1323},{12896,0,7647},{12897,97,1377},{12922,0,7648},
+{12923,5,1403},{12925,6,91},{13089,6,93},{13091,121,1409},
+{13122,0,6497},{13123,21,1441},{13129,0,5023},{13130,105,1448},
+{13157,0,7651},{13158,17,1476},{13163,0,7652},{13164,25,1482},
+{13171,0,7653},{13172,5,1490},{13174,0,5937},{13175,9,1493},
+{13178,0,7654},{13179,13,1497},{13345,129,1501},{13378,6,95},
+{13380,33,1536},{13389,0,7656},{13390,13,1546},{13394,0,6688},
+{13395,69,1551},{13413,0,7657},{13414,97,1570},{13601,37,1595},
+{13611,0,7658},{13612,77,1606},{13632,0,7659},{13633,245,1627},
+{13857,6,97},{13859,25,1691},{13866,0,7661},{13867,105,1699},
+{13894,0,7474},{13895,29,1727},{13903,0,7662},{13904,113,1736},
+{13933,0,7663},{13934,21,1766},{13940,0,7664},{13941,21,1773},
+{13947,14,99},{14113,9,1783},{14116,0,7667},{14117,69,1787},
+{14135,0,7668},{14136,49,1806},{14149,0,7669},{14150,29,1820},
+{14158,0,7670},{14159,9,1829},{14162,0,7671},{14163,5,1833},
+{14165,0,7672},{14166,17,1836},{14171,0,7181},{14172,29,1842},
+{14180,0,7673},{14181,45,1851},{14193,0,7674},{14194,25,1864},
+{14201,0,7675},{14202,13,1872},{14206,0,7676},{14369,73,1877},
+{14388,0,7677},{14389,45,1897},{14401,0,7678},{14402,241,1910},
+{14625,37,1971},{14635,0,7679},{14636,41,1982},{14647,0,7680},
+{14648,37,1994},{14658,0,7681},{14659,97,2005},{14684,0,5853},
+{14685,61,2031},{14701,0,7682},{14702,21,2048},{14708,0,7683},
+{14709,13,2055},{14713,0,7684},{14714,17,2060},{14881,197,2065},
+{14931,0,7685},{14932,73,2116},{14951,0,7686},{14952,45,2136},
+{14964,0,7687},{14965,37,2149},{15137,21,2159},{15143,0,7688},
+{15144,5,2166},{15146,10,103},{15149,45,2171},{15161,0,7691},
+{15162,273,2184},{15393,89,2253},{15416,0,7692},{15417,57,2277},
+{15432,6,106},{15434,49,2294},{15447,0,7694},{15448,17,2308},
+{15453,5,7695},{15455,125,2315},{15649,37,2347},{15659,0,7697},
+{15660,37,2358},{15670,0,7698},{15671,209,2369},{15724,5,7699},
+{15726,13,2424},{15730,5,7701},{15732,41,2430},{15905,13,2441},
+{15909,0,7703},{15910,49,2446},{15923,0,7704},{15924,41,2460},
+{15935,0,7705},{15936,81,2472},{15957,0,7706},{15958,33,2494},
+{15967,0,7707},{15968,13,2504},{15972,0,7708},{15973,101,2509},
+{16161,33,2535},{16170,0,7709},{16171,181,2545},{16217,0,7710},
+{16218,21,2592},{16224,0,7711},{16225,29,2599},{16233,0,7712},
+{16234,81,2608},{16417,6,108},{16419,121,2631},{16450,0,7714},
+{16451,137,2663},{16486,0,7715},{16487,37,2699},{16497,5,7716},
+{16499,21,2711},{16505,5,7718},{16507,13,2719},{16673,21,2723},
+{16679,6,110},{16681,61,2731},{16697,0,7721},{16698,69,2748},
+{16716,0,7722},{16717,5,2767},{16719,0,7723},{16720,57,2770},
+{16735,0,7724},{16736,33,2786},{16745,0,7725},{16746,81,2796},
+{16929,109,2817},{16957,0,7726},{16958,57,2846},{16973,0,7727},
+{16974,53,2862},{16988,0,7728},{16989,21,2877},{16995,0,7729},
+{16996,41,2884},{17007,0,7730},{17008,17,2896},{17013,5,7731},
+{17015,21,2903},{17021,6,112},{17185,21,2911},{17191,6,114},
+{17193,5,7735},{17195,5,2921},{17197,5,7737},{17199,53,2925},
+{17213,0,7739},{17214,197,2940},{17264,0,7740},{17265,13,2991},
+{17269,0,7741},{17270,21,2996},{17276,0,7742},{17277,5,3003},
+{17441,109,3005},{17469,0,7743},{17470,37,3034},{17480,10,116},
+{17483,5,3047},{17485,10,119},{17488,41,3052},{17499,0,4533},
+{17500,137,3064},{17697,6,122},{17699,13,3101},{17703,0,7749},
+{17704,21,3106},{17710,0,7750},{17711,25,3113},{17718,0,7751},
+{17719,29,3121},{17727,0,7752},{17728,29,3130},{17736,0,7753},
+{17737,5,3139},{17739,0,7754},{17740,17,3142},{17745,5,7755},
+{17747,13,3149},{17751,0,5855},{17752,45,3154},{17764,0,7757},
+{17765,33,3167},{17774,0,5200},{17775,13,3177},{17779,0,5430},
+{17780,13,3182},{17784,0,7758},{17785,21,3187},{17953,113,3193},
+{17982,0,7759},{17983,9,3223},{17986,0,7760},{17987,65,3227},
+{18004,5,7761},{18006,17,3246},{18011,5,7763},{18013,13,3253},
+{18017,0,7765},{18018,13,3258},{18022,5,7766},{18024,5,3264},
+{18026,0,7768},{18027,41,3267},{18038,0,6893},{18039,29,3279},
+{18209,29,3287},{18217,0,7769},{18218,57,3296},{18233,0,7770},
+{18234,113,3312},{18263,0,7771},{18264,57,3342},{18279,10,124},
+{18282,9,3360},{18285,0,7774},{18286,65,3364},{18465,9,3381},
+{18468,0,7775},{18469,33,3385},{18478,10,127},{18481,137,3397},
+{18516,0,7778},{18517,49,3433},{18530,0,7779},{18531,69,3447},
+{18549,0,7780},{18550,33,3466},{18721,0,3475},{18722,5,7781},
+{18724,41,3478},{18735,14,130},{18739,5,3493},{18741,0,7785},
+{18742,37,3496},{18752,0,7786},{18753,49,3507},{18766,0,7787},
+{18767,5,3521},{18769,0,7788},{18770,177,3524},{18977,133,3569},
+{19011,0,7789},{19012,33,3604},{19021,0,7790},{19022,45,3614},
+{19034,0,7791},{19035,117,3627},{19065,0,7792},{19066,17,3658},
+{19233,6,134},{19235,21,3665},{19241,0,7794},{19242,129,3672},
+{19275,0,7795},{19276,117,3706},{19306,0,7475},{19307,17,3737},
+{19312,0,7796},{19313,29,3743},{19321,0,4143},{19322,17,3752},
+{19489,173,3757},{19533,0,7797},{19534,41,3802},{19545,0,7798},
+{19546,17,3814},{19551,0,7799},{19552,5,3820},{19554,0,7800},
+{19555,85,3823},{19577,22,136},{19745,65,3851},{19762,0,7804},
+{19763,113,3869},{19792,0,7805},{19793,9,3899},{19796,0,7806},
+{19797,17,3903},{19802,0,7476},{19803,53,3909},{19817,0,7807},
+{19818,81,3924},{20001,165,3945},{20043,0,7808},{20044,181,3988},
+{20090,5,7809},{20092,9,4036},{20257,0,7811},{20258,57,4040},
+{20273,0,7812},{20274,13,4056},{20278,0,6007},{20279,5,4061},
+{20281,0,7813},{20282,101,4064},{20513,209,4090},{20566,0,3751},
+{20567,157,4144},{20769,109,4184},{20797,0,7814},{20798,33,4213},
+{20807,0,7815},{20808,9,4223},{20811,10,142},{20814,193,4229},
+{21025,373,4278},{21281,57,4372},{21296,0,7818},{21297,33,4388},
+{21306,0,7819},{21307,81,4398},{21328,0,7820},{21329,49,4420},
+{21342,0,7821},{21343,45,4434},{21355,0,7822},{21356,73,4447},
+{21537,137,4466},{21572,0,7823},{21573,121,4502},{21604,0,3063},
+{21605,101,4534},{21793,109,4560},{21821,0,7824},{21822,145,4589},
+{21859,0,7825},{21860,105,4627},{22049,6,145},{22051,313,4656},
+{22130,0,7827},{22131,45,4736},{22305,373,4748},{22561,9,4842},
+{22564,0,7828},{22565,357,4846},{22817,249,4936},{22880,0,7829},
+{22881,41,5000},{22892,0,7830},{22893,41,5012},{22904,0,1447},
+{22905,21,5024},{23073,93,5030},{23097,0,7831},{23098,73,5055},
+{23117,0,7832},{23118,193,5075},{23329,141,5124},{23365,0,7833},
+{23366,13,5161},{23370,0,7834},{23371,49,5166},{23384,0,3490},
+{23385,69,5180},{23403,10,147},{23406,21,5201},{23412,0,7836},
+{23413,37,5208},{23585,373,5218},{23841,373,5312},{24097,93,5406},
+{24121,0,3181},{24122,85,5431},{24144,0,7837},{24145,141,5454},
+{24181,0,1535},{24182,33,5491},{24353,325,5500},{24435,0,7838},
+{24436,41,5583},{24609,17,5594},{24614,0,7839},{24615,221,5600},
+{24671,0,7840},{24672,85,5657},{24694,0,7477},{24695,29,5680},
+{24865,37,5688},{24875,0,7841},{24876,13,5699},{24880,5,7842},
+{24882,305,5705},{25121,37,5782},{25131,0,7844},{25132,237,5793},
+{25192,10,150},{25195,13,5856},{25199,0,7845},{25200,57,5861},
+{25377,161,5876},{25418,0,7846},{25419,33,5918},{25428,0,7847},
+{25429,33,5928},{25438,0,1492},{25439,125,5938},{25633,93,5970},
+{25657,0,7848},{25658,45,5995},{25670,0,4060},{25671,113,6008},
+{25700,0,7849},{25701,33,6038},{25710,0,7850},{25711,61,6048},
+{25889,93,6064},{25913,10,153},{25916,37,6091},{25926,0,7853},
+{25927,221,6102},{26145,145,6158},{26182,0,7854},{26183,221,6196},
+{26401,265,6252},{26468,0,7855},{26469,13,6320},{26473,0,7856},
+{26474,29,6325},{26482,0,7857},{26483,45,6334},{26657,73,6346},
+{26676,0,7858},{26677,21,6366},{26683,0,7859},{26684,221,6373},
+{26740,0,7860},{26741,37,6430},{26913,6,156},{26915,41,6442},
+{26926,0,3845},{26927,49,6454},{26940,0,7861},{26941,113,6468},
+{26970,0,1440},{26971,141,6498},{27169,9,6534},{27172,0,3358},
+{27173,5,6538},{27175,0,7862},{27176,81,6541},{27197,0,7863},
+{27198,193,6563},{27247,0,7864},{27248,57,6613},{27425,65,6628},
+{27442,0,7865},{27443,165,6646},{27485,0,1550},{27486,29,6689},
+{27494,0,7866},{27495,57,6698},{27510,0,7867},{27511,29,6714},
+{27681,173,6722},{27725,0,2730},{27726,105,6767},{27753,0,7868},
+{27754,37,6795},{27764,0,7869},{27765,37,6806},{27937,177,6816},
+{27982,0,7870},{27983,113,6862},{28012,10,158},{28015,61,6894},
+{28193,29,6910},{28201,0,7873},{28202,73,6919},{28221,0,7874},
+{28222,97,6939},{28247,0,7875},{28248,153,6965},{28449,269,7004},
+{28517,0,7876},{28518,97,7073},{28705,69,7098},{28723,0,7877},
+{28724,65,7117},{28741,0,7878},{28742,41,7135},{28753,0,7879},
+{28754,17,7147},{28759,0,7880},{28760,109,7153},{28788,6,161},
+{28790,33,7183},{28961,373,7192},{29217,45,7286},{29229,0,7882},
+{29230,53,7299},{29244,0,7883},{29245,61,7314},{29261,6,163},
+{29263,145,7332},{29300,0,1321},{29301,37,7370},{29473,189,7380},
+{29521,0,7885},{29522,169,7429},{29565,6,165},
+};
+
+static const unsigned short cmap_NWP_H_table[167] = {
+762,761,769,642,673,773,712,715,717,671,718,692,
+636,693,637,663,699,697,700,641,719,678,711,679,
+648,650,646,680,667,681,649,634,638,1006,925,927,
+929,931,933,991,993,995,959,660,926,928,930,932,
+937,939,941,943,945,947,949,951,953,955,957,960,
+962,964,974,977,980,983,992,994,1003,1007,1008,936,
+938,940,942,944,946,948,950,952,954,956,958,961,
+963,965,1125,7633,7645,7369,7646,7649,1406,1407,7650,7655,
+5490,1689,7660,7665,1780,7666,1782,7689,2169,7690,7693,6441,
+2629,7713,7720,6766,7733,2910,7734,2918,7744,3045,7745,7746,
+3050,7747,3099,7748,7772,6537,7773,7776,3395,7777,7783,5179,
+3491,7784,3663,7793,6453,7801,3847,7802,3849,7803,7816,4227,
+7817,4654,7826,7835,5199,3176,2030,5854,3153,7851,6089,7852,
+6440,2293,7871,6892,7872,1841,7881,1143,7884,7886,7473,
+};
+
+static pdf_cmap cmap_NWP_H = {
+	-1, "NWP-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	635, 635, (pdf_range*) cmap_NWP_H_ranges,
+	167, 167, (unsigned short*) cmap_NWP_H_table,
+};
+
+/* NWP-V */
+
+static const pdf_range cmap_NWP_V_ranges[] = {
+{8482,5,7887},{8484,6,0},{8491,6,2},{8508,9,7891},
+{8513,17,7894},{8518,14,4},{8522,69,7899},{8555,10,8},
+{8750,0,8270},{9249,0,7918},{9251,0,7919},{9253,0,7920},
+{9255,0,7921},{9257,0,7922},{9283,0,7923},{9315,0,7924},
+{9317,0,7925},{9319,0,7926},{9326,0,7927},{9505,0,7928},
+{9507,0,7929},{9509,0,7930},{9511,0,7931},{9513,0,7932},
+{9539,0,7933},{9571,0,7934},{9573,0,7935},{9575,0,7936},
+{9582,0,7937},{9589,5,7938},{11584,61,7940},{11616,5,7956},
+{12065,0,7888},{12066,5,7911},{12068,0,7887},{12071,17,7928},
+{12076,9,7934},{12079,6,11},{12126,6,13},
+};
+
+static const unsigned short cmap_NWP_V_table[15] = {
+8268,8274,8272,8271,8281,8276,8279,8278,8269,8273,8283,7933,
+7891,8272,8271,
+};
+
+static pdf_cmap cmap_NWP_V = {
+	-1, "NWP-V", "NWP-H", 0, 1, 0,
+	{ {0,0,0}, },
+	39, 39, (pdf_range*) cmap_NWP_V_ranges,
+	15, 15, (unsigned short*) cmap_NWP_V_table,
+};
+
+/* RKSJ-H */
+
+static const pdf_range cmap_RKSJ_H_ranges[] = {
+{32,377,231},{160,253,326},{33088,249,633},{33152,177,696},
+{33208,29,741},{33224,25,749},{33242,57,756},{33264,29,771},
+{33276,0,779},{33359,37,780},{33376,101,790},{33409,101,816},
+{33439,329,842},{33600,249,925},{33664,89,988},{33695,93,1011},
+{33727,93,1035},{33856,129,1059},{33904,57,1092},{33920,69,1107},
+{33951,126,0},{34975,373,1125},{35136,249,1219},{35200,497,1282},
+{35392,249,1407},{35456,497,1470},{35648,249,1595},{35712,497,1658},
+{35904,249,1783},{35968,497,1846},{36160,249,1971},{36224,497,2034},
+{36416,249,2159},{36480,497,2222},{36672,249,2347},{36736,497,2410},
+{36928,249,2535},{36992,497,2598},{37184,249,2723},{37248,497,2786},
+{37440,249,2911},{37504,497,2974},{37696,249,3099},{37760,497,3162},
+{37952,249,3287},{38016,497,3350},{38208,249,3475},{38272,497,3538},
+{38464,249,3663},{38528,497,3726},{38720,249,3851},{38784,497,3914},
+{38976,201,4039},{39071,373,4090},{39232,249,4184},{39296,497,4247},
+{39488,249,4372},{39552,497,4435},{39744,249,4560},{39808,497,4623},
+{40000,249,4748},{40064,497,4811},{40256,249,4936},{40320,497,4999},
+{40512,249,5124},{40576,497,5187},{40768,249,5312},{40832,497,5375},
+{57408,249,5500},{57472,497,5563},{57664,249,5688},{57728,497,5751},
+{57920,249,5876},{57984,497,5939},{58176,249,6064},{58240,497,6127},
+{58432,249,6252},{58496,497,6315},{58688,249,6440},{58752,497,6503},
+{58944,249,6628},{59008,497,6691},{59200,249,6816},{59264,497,6879},
+{59456,249,7004},{59520,497,7067},{59712,249,7192},{59776,497,7255},
+{59968,249,7380},{60032,137,7443},{60067,5,8284},
+};
+
+static const unsigned short cmap_RKSJ_H_table[32] = {
+7479,7481,7491,7495,7503,7499,7507,7523,7515,7531,7539,7480,
+7482,7494,7498,7506,7502,7514,7530,7522,7538,7554,7511,7526,
+7519,7534,7542,7508,7527,7516,7535,7545,
+};
+
+static pdf_cmap cmap_RKSJ_H = {
+	-1, "RKSJ-H", "", 0, 0, 4,
+	{ {1,0,128},{2,33088,40956},{1,160,223},{2,57408,64764}, },
+	91, 91, (pdf_range*) cmap_RKSJ_H_ranges,
+	32, 32, (unsigned short*) cmap_RKSJ_H_table,
+};
+
+/* RKSJ-V */
+
+static const pdf_range cmap_RKSJ_V_ranges[] = {
+{33089,5,7887},{33104,5,7889},{33115,9,7891},{33120,17,7894},
+{33129,69,7899},{33153,0,7917},{33439,0,7918},{33441,0,7919},
+{33443,0,7920},{33445,0,7921},{33447,0,7922},{33473,0,7923},
+{33505,0,7924},{33507,0,7925},{33509,0,7926},{33516,0,7927},
+{33600,0,7928},{33602,0,7929},{33604,0,7930},{33606,0,7931},
+{33608,0,7932},{33634,0,7933},{33667,0,7934},{33669,0,7935},
+{33671,0,7936},{33678,0,7937},{33685,5,7938},
+};
+
+static const unsigned short cmap_RKSJ_V_table[] = { 0 };
+
+static pdf_cmap cmap_RKSJ_V = {
+	-1, "RKSJ-V", "RKSJ-H", 0, 1, 0,
+	{ {0,0,0}, },
+	27, 27, (pdf_range*) cmap_RKSJ_V_ranges,
+	0, 0, (unsigned short*) cmap_RKSJ_V_table,
+};
+
+/* Roman */
+
+static const pdf_range cmap_Roman_ranges[] = {
+{32,377,231},
+};
+
+static const unsigned short cmap_Roman_table[] = { 0 };
+
+static pdf_cmap cmap_Roman = {
+	-1, "Roman", "", 0, 0, 1,
+	{ {1,0,255}, },
+	1, 1, (pdf_range*) cmap_Roman_ranges,
+	0, 0, (unsigned short*) cmap_Roman_table,
+};
+
+/* UniHojo-UCS2-H */
+
+static const pdf_range cmap_UniHojo_UCS2_H_ranges[] = {
+{126,0,9},{161,0,12},{164,0,20},{166,0,13},
+{169,6,0},{174,6,2},{184,0,3},{186,0,15},
+{191,66,4},{209,22,21},{216,122,27},{248,110,58},
+{278,50,86},{292,30,99},{302,126,107},{336,186,139},
+{461,62,186},{501,0,206},{711,0,2},{728,14,202},
+{733,0,5},{900,5,10},{902,0,22},{904,9,23},
+{908,0,27},{910,10,206},{938,6,209},{940,13,31},
+{944,0,41},{962,0,38},{970,18,211},{1026,41,43},
+{1038,5,54},{1106,41,56},{1118,5,67},{8470,0,21},
+{8482,0,19},{19970,0,267},{19972,5,268},{19980,0,270},
+{19986,0,271},{19999,0,272},{20003,5,273},{20008,0,275},
+{20011,0,276},{20014,9,277},{20021,0,280},{20032,5,281},
+{20036,0,283},{20039,0,284},{20049,0,285},{20058,0,286},
+{20060,0,287},{20067,0,288},{20072,5,289},{20084,5,291},
+{20089,0,293},{20095,0,294},{20109,0,295},{20118,5,296},
+{20125,0,298},{20143,0,299},{20153,0,300},{20163,0,301},
+{20176,0,302},{20186,5,303},{20192,9,305},{20200,0,308},
+{20207,0,309},{20209,0,310},{20211,0,311},{20213,0,312},
+{20221,13,313},{20226,5,317},{20232,0,319},{20235,5,320},
+{20242,0,322},{20245,9,323},{20249,0,326},{20270,0,327},
+{20273,0,328},{20275,0,330},{20277,0,331},{20279,0,332},
+{20281,0,333},{20283,0,334},{20286,0,335},{20288,0,336},
+{20290,0,337},{20296,5,338},{20299,5,340},{20306,0,342},
+{20308,0,343},{20310,0,344},{20312,0,345},{20319,6,216},
+{20323,0,347},{20330,0,348},{20332,0,349},{20334,0,350},
+{20337,0,351},{20343,13,352},{20349,5,356},{20353,5,358},
+{20356,5,360},{20361,5,362},{20364,0,364},{20366,0,365},
+{20368,0,366},{20370,9,367},{20375,0,370},{20377,5,371},
+{20382,5,373},{20402,0,375},{20407,0,376},{20409,0,377},
+{20411,13,378},{20416,5,382},{20421,5,384},{20424,5,386},
+{20427,9,388},{20431,0,391},{20434,0,392},{20444,0,393},
+{20448,0,394},{20450,0,395},{20464,0,396},{20466,0,397},
+{20476,5,398},{20479,9,400},{20484,0,403},{20487,0,404},
+{20490,0,405},{20492,0,406},{20494,0,407},{20496,0,408},
+{20499,0,409},{20503,5,410},{20507,13,412},{20514,0,416},
+{20519,0,417},{20526,0,418},{20528,0,419},{20530,5,420},
+{20533,0,422},{20539,0,446},{20544,9,423},{20549,5,426},
+{20554,0,428},{20556,0,429},{20558,0,430},{20561,9,431},
+{20567,0,434},{20569,0,435},{20575,5,436},{20578,5,438},
+{20582,5,440},{20586,0,442},{20589,0,443},{20592,5,444},
+{20609,0,447},{20611,5,448},{20614,0,450},{20618,0,451},
+{20622,9,452},{20626,9,455},{20630,0,458},{20635,5,459},
+{20638,17,461},{20650,0,466},{20655,5,467},{20665,5,469},
+{20669,0,471},{20672,0,472},{20675,5,473},{20679,0,475},
+{20684,0,476},{20686,0,477},{20688,0,478},{20691,5,479},
+{20696,0,481},{20700,5,482},{20703,0,484},{20706,0,485},
+{20708,0,486},{20710,0,487},{20712,5,488},{20719,0,490},
+{20721,6,218},{20726,0,492},{20730,0,493},{20734,0,494},
+{20739,0,495},{20742,9,496},{20747,13,499},{20752,0,504},
+{20759,0,505},{20761,0,506},{20763,13,507},{20771,0,511},
+{20775,5,512},{20780,5,514},{20783,0,516},{20785,0,517},
+{20787,9,518},{20792,5,521},{20802,0,523},{20810,0,524},
+{20815,0,525},{20819,0,526},{20821,0,527},{20823,5,528},
+{20831,0,530},{20836,0,531},{20838,0,532},{20862,0,533},
+{20867,5,534},{20875,0,536},{20878,0,537},{20888,0,538},
+{20893,0,539},{20897,0,540},{20899,0,541},{20909,0,542},
+{20920,0,543},{20922,0,544},{20924,0,545},{20926,5,546},
+{20930,0,548},{20936,0,549},{20943,0,550},{20945,9,551},
+{20949,0,554},{20952,0,555},{20958,0,556},{20962,0,557},
+{20965,0,558},{20974,0,559},{20978,9,560},{20983,0,563},
+{20993,5,564},{20997,0,566},{21010,5,567},{21013,5,569},
+{21016,0,571},{21026,0,572},{21032,0,573},{21041,5,574},
+{21045,0,576},{21052,0,577},{21061,0,578},{21065,0,579},
+{21077,0,580},{21079,5,581},{21082,0,583},{21084,0,584},
+{21087,9,585},{21094,0,588},{21102,0,589},{21111,9,590},
+{21120,0,593},{21122,0,594},{21125,0,595},{21130,0,596},
+{21132,0,597},{21139,0,598},{21141,13,599},{21146,0,603},
+{21148,0,604},{21156,13,605},{21167,5,609},{21174,9,611},
+{21178,5,614},{21181,0,616},{21184,0,617},{21188,0,618},
+{21190,0,619},{21192,0,620},{21196,0,621},{21199,0,622},
+{21201,0,623},{21204,0,624},{21206,0,625},{21211,5,626},
+{21217,0,628},{21221,0,629},{21224,9,630},{21228,0,633},
+{21232,5,634},{21236,0,636},{21238,5,637},{21248,0,639},
+{21251,0,640},{21258,9,641},{21265,0,644},{21267,0,645},
+{21272,0,646},{21275,5,647},{21278,5,649},{21285,0,651},
+{21287,9,652},{21291,9,655},{21296,0,658},{21298,0,659},
+{21301,0,660},{21308,9,661},{21314,0,664},{21323,6,220},
+{21337,0,667},{21339,0,668},{21345,0,669},{21347,0,670},
+{21349,0,671},{21356,5,672},{21362,0,674},{21369,0,675},
+{21374,0,676},{21379,0,677},{21383,5,678},{21390,0,680},
+{21395,5,681},{21401,0,683},{21405,0,684},{21409,0,685},
+{21412,0,686},{21418,5,687},{21423,0,689},{21426,0,690},
+{21428,5,691},{21431,5,693},{21434,0,695},{21437,0,696},
+{21440,0,697},{21445,0,698},{21455,0,699},{21458,5,700},
+{21461,0,702},{21466,0,703},{21469,5,704},{21472,0,706},
+{21478,5,707},{21493,0,709},{21506,0,710},{21523,0,711},
+{21530,0,712},{21537,0,713},{21543,5,714},{21546,0,716},
+{21551,0,717},{21553,0,718},{21556,5,719},{21571,5,721},
+{21575,0,723},{21581,0,724},{21583,0,725},{21598,0,726},
+{21602,0,727},{21604,0,728},{21606,5,729},{21609,0,731},
+{21611,0,732},{21613,5,733},{21620,0,735},{21631,0,736},
+{21633,0,737},{21635,0,738},{21637,0,739},{21640,5,740},
+{21645,0,742},{21649,0,743},{21653,5,744},{21660,0,746},
+{21663,0,747},{21665,0,748},{21670,5,749},{21673,5,751},
+{21677,5,753},{21681,0,755},{21687,0,756},{21689,9,757},
+{21695,0,760},{21702,0,761},{21706,0,762},{21709,5,763},
+{21728,0,765},{21738,0,766},{21740,0,767},{21743,0,768},
+{21750,0,769},{21756,0,770},{21758,13,771},{21765,0,775},
+{21768,5,776},{21772,9,778},{21781,0,781},{21802,5,782},
+{21810,0,784},{21813,5,785},{21819,9,787},{21825,0,790},
+{21831,0,791},{21833,5,792},{21837,0,794},{21840,5,795},
+{21848,0,797},{21850,5,798},{21854,0,800},{21856,5,801},
+{21860,0,803},{21862,0,804},{21887,0,805},{21889,5,806},
+{21894,0,808},{21896,0,809},{21902,5,810},{21905,13,812},
+{21911,0,816},{21923,5,817},{21933,0,819},{21938,0,820},
+{21951,0,821},{21953,0,822},{21955,0,823},{21958,0,824},
+{21961,0,825},{21963,5,826},{21966,0,828},{21969,9,829},
+{21975,5,832},{21979,0,834},{21982,0,835},{21986,0,836},
+{21993,0,837},{22006,0,838},{22015,0,839},{22021,0,840},
+{22024,0,841},{22026,0,842},{22029,21,843},{22041,0,849},
+{22060,0,850},{22064,0,851},{22067,0,852},{22069,0,853},
+{22071,0,854},{22073,0,855},{22075,9,856},{22079,9,859},
+{22083,5,862},{22086,0,864},{22089,0,865},{22091,0,866},
+{22093,0,867},{22095,0,868},{22100,0,869},{22110,0,870},
+{22112,13,871},{22118,0,875},{22121,0,876},{22125,0,877},
+{22127,0,878},{22129,5,879},{22133,0,881},{22148,5,882},
+{22152,0,884},{22155,5,885},{22165,0,887},{22169,5,888},
+{22173,9,890},{22182,13,893},{22187,9,897},{22193,0,900},
+{22195,0,901},{22199,0,902},{22206,0,903},{22213,0,904},
+{22217,9,905},{22220,5,910},{22223,5,908},{22233,0,912},
+{22236,5,913},{22239,0,915},{22241,0,916},{22244,17,917},
+{22251,0,923},{22253,0,924},{22257,0,922},{22262,5,925},
+{22273,5,927},{22279,0,929},{22282,0,930},{22284,0,931},
+{22289,0,932},{22293,0,933},{22298,5,934},{22301,0,936},
+{22304,0,937},{22306,13,938},{22313,5,942},{22316,0,944},
+{22318,5,945},{22323,5,947},{22333,9,949},{22341,5,952},
+{22348,5,954},{22354,0,956},{22370,0,957},{22373,0,958},
+{22375,5,959},{22379,0,961},{22381,17,962},{22387,9,967},
+{22391,0,970},{22393,13,971},{22398,0,975},{22401,0,976},
+{22403,0,977},{22412,0,978},{22420,6,222},{22423,0,980},
+{22425,5,981},{22428,13,983},{22433,0,987},{22439,9,989},
+{22444,0,992},{22456,0,993},{22461,0,994},{22471,5,995},
+{22476,0,997},{22479,0,998},{22485,0,999},{22493,5,1000},
+{22497,0,1018},{22500,0,1002},{22502,5,1003},{22505,0,1005},
+{22509,0,1006},{22512,0,1007},{22517,5,1008},{22520,0,1010},
+{22525,9,1011},{22531,5,1014},{22536,5,1016},{22540,5,1019},
+{22555,0,1021},{22558,9,1022},{22566,5,1025},{22573,0,1027},
+{22578,0,1028},{22585,0,1029},{22591,0,1030},{22601,0,1031},
+{22604,5,1032},{22607,5,1034},{22613,0,1036},{22623,0,1037},
+{22625,0,1038},{22628,0,1039},{22631,5,1040},{22648,0,1042},
+{22652,0,1043},{22655,9,1044},{22663,13,1047},{22668,5,1051},
+{22671,5,1053},{22676,0,1055},{22678,0,1056},{22685,0,1057},
+{22688,9,1058},{22694,0,1061},{22697,0,1062},{22705,5,1063},
+{22716,0,1066},{22722,0,1067},{22724,0,1065},{22728,0,1068},
+{22733,5,1069},{22736,0,1071},{22738,0,1072},{22740,0,1073},
+{22742,0,1074},{22746,0,1075},{22749,0,1076},{22753,5,1077},
+{22761,0,1079},{22771,0,1080},{22789,5,1081},{22795,5,1083},
+{22802,9,1085},{22813,0,1089},{22817,0,1090},{22819,5,1091},
+{22824,0,1093},{22831,5,1094},{22835,0,1096},{22837,5,1097},
+{22847,0,1099},{22851,0,1100},{22854,0,1101},{22866,5,1102},
+{22873,0,1104},{22875,0,1105},{22877,9,1106},{22881,0,1109},
+{22883,0,1110},{22891,0,1111},{22893,0,1112},{22895,0,1113},
+{22898,0,1114},{22901,5,1115},{22905,0,1117},{22907,5,1118},
+{22923,5,1120},{22926,0,1122},{22930,0,1123},{22933,0,1124},
+{22935,0,1125},{22943,0,1126},{22948,0,1127},{22951,0,1128},
+{22957,13,1129},{22963,0,1133},{22967,0,1134},{22970,0,1135},
+{22972,0,1136},{22977,0,1137},{22979,5,1138},{22984,0,1140},
+{22986,0,1141},{22989,0,1142},{22994,0,1143},{23005,9,1144},
+{23011,5,1147},{23015,0,1149},{23022,5,1150},{23025,5,1152},
+{23028,0,1154},{23031,0,1155},{23040,0,1156},{23044,0,1157},
+{23052,9,1158},{23058,5,1161},{23070,0,1163},{23075,5,1164},
+{23079,5,1166},{23082,0,1168},{23085,0,1169},{23088,0,1170},
+{23108,5,1171},{23111,5,1173},{23116,0,1175},{23120,0,1176},
+{23125,0,1177},{23134,0,1178},{23139,0,1179},{23141,0,1180},
+{23143,0,1181},{23149,0,1182},{23159,0,1183},{23162,5,1184},
+{23166,0,1186},{23179,0,1187},{23184,0,1188},{23187,0,1189},
+{23190,0,1190},{23193,0,1191},{23196,0,1192},{23198,9,1193},
+{23202,0,1196},{23207,0,1197},{23212,0,1198},{23217,9,1199},
+{23221,0,1202},{23224,0,1203},{23226,5,1204},{23231,0,1206},
+{23236,0,1207},{23238,0,1208},{23240,0,1209},{23247,0,1210},
+{23258,0,1211},{23260,0,1212},{23264,0,1213},{23269,0,1214},
+{23274,0,1215},{23278,0,1216},{23285,5,1217},{23293,0,1219},
+{23296,5,1220},{23304,0,1222},{23319,0,1223},{23321,0,1225},
+{23323,0,1226},{23325,0,1227},{23329,0,1228},{23333,0,1229},
+{23341,0,1230},{23348,0,1224},{23352,0,1231},{23361,0,1232},
+{23371,5,1233},{23378,0,1235},{23382,0,1236},{23390,0,1237},
+{23400,0,1238},{23406,5,1239},{23420,13,1241},{23425,0,1245},
+{23428,0,1246},{23430,0,1247},{23434,0,1248},{23438,0,1249},
+{23440,5,1250},{23443,5,1252},{23446,0,1254},{23464,5,1255},
+{23468,5,1257},{23471,0,1259},{23473,5,1260},{23479,0,1262},
+{23482,0,1263},{23484,0,1264},{23488,5,1265},{23501,0,1267},
+{23503,0,1268},{23510,17,1269},{23520,0,1274},{23535,0,1275},
+{23537,0,1276},{23540,0,1277},{23549,0,1278},{23564,0,1279},
+{23575,0,1280},{23582,5,1281},{23587,0,1283},{23590,0,1284},
+{23593,0,1285},{23595,5,1286},{23598,0,1288},{23600,0,1289},
+{23602,0,1290},{23605,5,1291},{23641,5,1293},{23644,0,1295},
+{23650,5,1296},{23655,9,1298},{23661,0,1301},{23664,0,1302},
+{23668,5,1303},{23674,13,1305},{23687,5,1309},{23690,0,1311},
+{23695,0,1312},{23698,0,1313},{23709,0,1314},{23711,5,1315},
+{23714,5,1317},{23718,0,1319},{23722,0,1320},{23730,0,1321},
+{23732,5,1322},{23738,0,1324},{23753,0,1325},{23755,0,1326},
+{23762,0,1327},{23767,0,1329},{23773,0,1328},{23790,0,1330},
+{23793,5,1331},{23796,0,1333},{23809,0,1334},{23814,0,1335},
+{23821,0,1336},{23826,0,1337},{23843,5,1339},{23846,5,1341},
+{23851,0,1338},{23857,0,1343},{23860,0,1344},{23865,0,1345},
+{23869,0,1346},{23871,0,1347},{23874,5,1348},{23878,0,1350},
+{23880,0,1351},{23882,0,1355},{23889,0,1353},{23893,0,1352},
+{23897,0,1354},{23903,13,1356},{23908,0,1360},{23914,0,1361},
+{23917,0,1362},{23920,0,1363},{23929,5,1364},{23934,5,1366},
+{23937,0,1368},{23939,0,1369},{23944,0,1370},{23946,0,1371},
+{23954,13,1372},{23961,0,1376},{23963,0,1377},{23967,5,1378},
+{23975,0,1380},{23979,0,1381},{23984,0,1382},{23986,0,5426},
+{23988,0,1383},{23992,5,1384},{24003,0,1386},{24007,0,1387},
+{24011,0,1388},{24014,0,1390},{24016,0,1389},{24024,5,1391},
+{24032,0,1393},{24036,0,1394},{24041,0,1395},{24056,5,1396},
+{24064,0,1398},{24071,0,1399},{24077,0,1400},{24082,0,1401},
+{24084,5,1402},{24088,0,1404},{24095,5,1405},{24104,0,1408},
+{24110,0,1407},{24114,0,1409},{24117,0,1410},{24126,0,1411},
+{24137,0,1414},{24139,0,1412},{24144,6,224},{24150,0,1416},
+{24152,0,1417},{24155,5,1418},{24158,0,1420},{24168,0,1421},
+{24170,17,1422},{24176,0,1427},{24192,0,1428},{24203,0,1429},
+{24206,0,1430},{24226,0,1431},{24228,5,1432},{24232,0,1434},
+{24234,0,1435},{24236,0,1436},{24241,0,1437},{24243,0,1438},
+{24253,9,1439},{24262,0,1442},{24267,6,226},{24270,0,1445},
+{24273,5,1446},{24276,5,1448},{24284,0,1450},{24286,0,1451},
+{24293,0,1452},{24299,0,1453},{24322,0,1454},{24326,9,1455},
+{24334,0,1458},{24345,0,1459},{24348,5,1460},{24353,13,1462},
+{24360,0,1466},{24363,5,1467},{24366,0,1469},{24368,0,1470},
+{24372,0,1471},{24374,0,1472},{24379,0,1473},{24381,0,1474},
+{24383,5,1475},{24388,5,1477},{24391,0,1479},{24397,0,1480},
+{24400,0,1481},{24404,0,1482},{24408,0,1483},{24411,0,1484},
+{24416,0,1485},{24419,5,1486},{24423,0,1488},{24431,0,1489},
+{24434,0,1490},{24436,5,1491},{24440,0,1493},{24442,0,1494},
+{24445,5,1495},{24457,0,1497},{24461,0,1498},{24463,0,1499},
+{24470,0,1500},{24476,5,1501},{24482,0,1503},{24484,0,1506},
+{24487,0,1504},{24491,6,228},{24495,9,1508},{24504,0,1511},
+{24516,0,1512},{24519,9,1513},{24523,0,1516},{24528,17,1517},
+{24542,0,1522},{24545,5,1523},{24552,9,1525},{24556,13,1528},
+{24562,5,1532},{24566,0,1534},{24570,0,1535},{24572,0,1536},
+{24583,0,1537},{24586,0,1538},{24589,0,1539},{24595,5,1540},
+{24599,5,1542},{24602,0,1544},{24607,0,1545},{24612,0,1546},
+{24621,0,1547},{24627,0,1548},{24629,0,1549},{24640,0,1550},
+{24647,9,1551},{24652,0,1554},{24657,0,1555},{24660,0,1556},
+{24662,5,1557},{24669,0,1559},{24673,0,1560},{24679,0,1561},
+{24689,0,1562},{24702,5,1563},{24706,0,1565},{24710,0,1566},
+{24712,0,1567},{24714,0,1568},{24718,0,1569},{24721,0,1570},
+{24723,0,1571},{24725,0,1572},{24728,0,1573},{24733,5,1574},
+{24738,0,1576},{24740,5,1577},{24744,0,1579},{24752,5,1580},
+{24759,0,1582},{24763,0,1583},{24766,0,1584},{24770,0,1585},
+{24772,0,1586},{24776,13,1587},{24782,5,1591},{24788,5,1593},
+{24793,0,1595},{24795,0,1596},{24797,5,1597},{24802,0,1599},
+{24805,0,1600},{24818,0,1601},{24821,0,1602},{24824,0,1603},
+{24828,5,1604},{24834,0,1606},{24839,0,1607},{24842,0,1608},
+{24844,0,1609},{24848,17,1610},{24854,5,1615},{24857,0,1617},
+{24860,0,1618},{24862,0,1619},{24866,0,1620},{24874,5,1621},
+{24880,5,1623},{24885,9,1625},{24889,0,1628},{24897,0,1629},
+{24901,5,1630},{24905,0,1632},{24926,0,1633},{24928,0,1634},
+{24940,0,1635},{24946,0,1636},{24952,0,1637},{24955,5,1638},
+{24959,9,1640},{24963,5,1643},{24971,0,1645},{24973,0,1646},
+{24978,5,1647},{24983,5,1649},{24988,5,1651},{24991,5,1653},
+{24997,0,1655},{25000,0,1656},{25002,0,1657},{25005,0,1658},
+{25016,5,1659},{25020,0,1661},{25024,9,1662},{25038,5,1665},
+{25045,0,1667},{25052,13,1668},{25057,5,1672},{25061,0,1676},
+{25063,0,1674},{25065,0,1675},{25068,5,1677},{25071,0,1679},
+{25089,0,1680},{25091,5,1681},{25095,0,1683},{25107,0,1684},
+{25109,0,1685},{25116,0,1686},{25120,0,1687},{25122,5,1688},
+{25127,0,1690},{25129,0,1691},{25131,0,1692},{25145,0,1693},
+{25149,0,1694},{25154,9,1695},{25158,0,1698},{25164,0,1699},
+{25168,9,1700},{25172,0,1703},{25174,0,1704},{25178,0,1705},
+{25180,0,1706},{25188,0,1707},{25197,0,1708},{25199,0,1709},
+{25203,0,1710},{25210,0,1711},{25213,0,1712},{25229,13,1713},
+{25254,0,1717},{25256,0,1718},{25267,0,1719},{25270,5,1720},
+{25274,0,1722},{25278,5,1723},{25284,0,1725},{25294,0,1726},
+{25301,5,1727},{25306,0,1729},{25322,0,1730},{25330,0,1731},
+{25332,0,1732},{25340,5,1733},{25347,5,1735},{25354,5,1737},
+{25357,0,1739},{25360,0,1740},{25363,0,1741},{25366,0,1742},
+{25368,0,1743},{25385,5,1744},{25389,0,1746},{25397,5,1747},
+{25401,0,1749},{25404,0,1750},{25409,13,1751},{25414,0,1755},
+{25418,5,1756},{25422,0,1758},{25426,9,1759},{25432,0,1762},
+{25435,0,1763},{25445,5,1764},{25452,5,1766},{25457,0,1768},
+{25460,5,1769},{25464,0,1771},{25468,5,1772},{25471,0,1774},
+{25474,0,1775},{25476,0,1776},{25479,0,1777},{25482,0,1778},
+{25488,0,1779},{25492,5,1780},{25497,5,1782},{25502,0,1784},
+{25508,0,1785},{25510,0,1786},{25517,9,1787},{25533,0,1790},
+{25537,0,1791},{25541,0,1792},{25544,0,1793},{25550,0,1794},
+{25553,0,1795},{25555,9,1796},{25564,0,1799},{25568,0,1800},
+{25573,0,1801},{25578,0,1802},{25580,0,1803},{25586,5,1804},
+{25589,0,1806},{25592,5,1807},{25609,5,1809},{25616,0,1811},
+{25618,0,1812},{25620,0,1813},{25624,0,1814},{25630,0,1815},
+{25632,0,1816},{25634,0,1817},{25636,5,1818},{25641,5,1820},
+{25647,5,1822},{25653,0,1824},{25661,0,1825},{25663,0,1826},
+{25675,0,1827},{25679,0,1828},{25681,13,1829},{25690,13,1833},
+{25695,9,1837},{25699,0,1840},{25709,0,1841},{25715,5,1842},
+{25723,0,1844},{25725,0,1845},{25733,0,1846},{25735,0,1847},
+{25743,9,1848},{25752,5,1851},{25755,0,1853},{25757,0,1854},
+{25759,0,1855},{25761,0,1856},{25763,0,1857},{25766,0,1858},
+{25768,0,1859},{25772,0,1860},{25779,0,1861},{25789,9,1862},
+{25796,0,1865},{25801,13,1866},{25806,0,1870},{25808,5,1871},
+{25813,0,1873},{25815,0,1874},{25828,5,1875},{25833,5,1877},
+{25837,0,1879},{25840,0,1880},{25845,0,1881},{25847,0,1882},
+{25851,0,1883},{25855,0,1884},{25857,0,1885},{25860,0,1886},
+{25864,9,1887},{25871,0,1890},{25875,5,1891},{25878,0,1893},
+{25881,0,1894},{25883,0,1895},{25886,5,1896},{25890,0,1898},
+{25894,0,1899},{25897,0,1900},{25902,0,1901},{25905,0,1902},
+{25914,0,1903},{25916,5,1904},{25923,0,1906},{25927,0,1907},
+{25929,0,1908},{25936,0,1909},{25938,0,1910},{25940,0,1911},
+{25951,5,1912},{25959,0,1914},{25963,0,1915},{25978,0,1916},
+{25981,0,1917},{25985,0,1918},{25989,0,1919},{25994,0,1920},
+{26002,0,1921},{26005,0,1922},{26008,0,1923},{26013,0,1924},
+{26016,0,1925},{26019,0,1926},{26022,0,1927},{26030,0,1928},
+{26034,9,1929},{26047,0,1932},{26050,0,1933},{26056,5,1934},
+{26062,0,1936},{26064,0,1937},{26068,0,1938},{26070,0,1939},
+{26072,0,1940},{26079,0,1941},{26096,0,1942},{26098,0,1943},
+{26100,5,1944},{26105,0,1946},{26110,9,1947},{26116,0,1950},
+{26120,5,1951},{26125,0,1953},{26129,5,1954},{26133,5,1956},
+{26141,5,1958},{26145,13,1960},{26150,0,1964},{26153,13,1965},
+{26158,0,1969},{26160,5,1970},{26163,0,1972},{26167,0,1974},
+{26169,0,1973},{26176,0,1975},{26181,5,1976},{26186,0,1978},
+{26188,0,1979},{26190,0,1981},{26193,0,1980},{26199,9,1982},
+{26203,5,1985},{26208,5,1987},{26218,9,1990},{26227,0,1994},
+{26229,0,1995},{26231,9,1997},{26235,6,230},{26238,10,232},
+{26251,9,2003},{26256,0,2006},{26258,0,2007},{26265,13,2008},
+{26271,5,2012},{26276,0,2014},{26285,0,2015},{26289,5,2016},
+{26293,0,2018},{26299,0,2019},{26303,5,2020},{26306,5,2022},
+{26312,0,2024},{26316,0,2025},{26318,5,2026},{26324,0,2028},
+{26331,0,2029},{26335,0,2030},{26344,0,2031},{26347,5,2032},
+{26350,0,2034},{26362,6,235},{26373,0,2036},{26375,0,2037},
+{26382,0,2038},{26387,0,2039},{26393,0,2040},{26396,0,2041},
+{26400,0,2042},{26402,0,2043},{26419,0,2044},{26430,0,2045},
+{26437,0,2046},{26439,5,2047},{26444,0,2049},{26452,5,2050},
+{26461,0,2052},{26470,0,2053},{26476,0,2054},{26478,0,2055},
+{26484,0,2056},{26486,0,2057},{26491,0,2058},{26497,0,2059},
+{26500,0,2060},{26510,5,2061},{26513,0,2063},{26515,0,2064},
+{26518,0,2065},{26520,5,2066},{26523,0,2068},{26544,9,2069},
+{26549,0,2072},{26555,9,2073},{26560,0,2077},{26562,5,2078},
+{26565,0,2080},{26568,5,2081},{26578,0,2083},{26583,0,2084},
+{26585,0,2085},{26588,0,2086},{26593,0,2087},{26598,0,2088},
+{26608,0,2089},{26610,0,2090},{26614,5,2091},{26617,0,2076},
+{26644,0,2094},{26649,0,2095},{26653,0,2096},{26655,0,2097},
+{26663,6,237},{26668,5,2100},{26671,9,2102},{26675,0,2105},
+{26683,0,2106},{26687,0,2107},{26692,5,2108},{26698,0,2110},
+{26700,0,2111},{26706,0,2093},{26709,0,2112},{26711,5,2113},
+{26715,0,2115},{26731,0,2116},{26734,17,2117},{26741,0,2122},
+{26745,13,2123},{26754,0,2127},{26756,0,2128},{26758,0,2129},
+{26760,0,2130},{26774,0,2131},{26776,0,2132},{26778,0,2133},
+{26780,0,2134},{26785,0,2135},{26787,0,2136},{26789,0,2137},
+{26793,5,2138},{26798,0,2140},{26802,0,2141},{26811,0,2142},
+{26821,0,2143},{26824,0,2144},{26828,0,2145},{26831,9,2146},
+{26835,0,2149},{26838,0,2150},{26841,0,2151},{26844,5,2152},
+{26853,0,2154},{26856,0,2155},{26858,13,2156},{26864,5,2160},
+{26869,5,2162},{26875,9,2164},{26886,0,2167},{26889,5,2168},
+{26896,5,2170},{26899,0,2172},{26902,5,2173},{26929,0,2175},
+{26931,0,2176},{26933,0,2177},{26936,0,2178},{26939,0,2179},
+{26946,0,2180},{26949,0,2181},{26953,0,2182},{26958,0,2183},
+{26967,0,2184},{26971,0,2185},{26979,13,2186},{26984,5,2190},
+{26988,0,2192},{26992,9,2193},{27002,5,2196},{27007,5,2198},
+{27021,0,2200},{27026,0,2201},{27030,0,2202},{27032,0,2203},
+{27041,0,2204},{27045,5,2205},{27048,0,2207},{27051,0,2208},
+{27053,0,2209},{27055,0,2210},{27063,5,2211},{27066,0,2213},
+{27068,0,2214},{27077,0,2215},{27080,0,2216},{27089,0,2217},
+{27094,5,2218},{27106,0,2220},{27109,0,2221},{27118,5,2222},
+{27121,0,2224},{27123,0,2225},{27125,0,2226},{27134,0,2227},
+{27136,5,2228},{27139,0,2230},{27151,0,2231},{27153,0,2232},
+{27157,0,2233},{27162,0,2234},{27165,0,2235},{27168,0,2236},
+{27172,0,2237},{27176,0,2238},{27184,0,2239},{27186,0,2240},
+{27188,0,2241},{27191,0,2242},{27195,0,2243},{27198,5,2244},
+{27205,5,2246},{27209,5,2248},{27214,0,2250},{27216,9,2251},
+{27221,5,2254},{27227,0,2256},{27236,0,2257},{27239,0,2258},
+{27242,0,2259},{27249,0,2260},{27251,0,2261},{27262,0,2262},
+{27265,0,2263},{27267,0,2264},{27270,5,2265},{27273,0,2267},
+{27275,0,2268},{27281,0,2269},{27291,0,2270},{27293,9,2271},
+{27301,0,2274},{27307,0,2275},{27311,9,2276},{27316,0,2279},
+{27325,9,2280},{27334,0,2283},{27336,6,239},{27340,0,2286},
+{27344,0,2287},{27348,9,2288},{27356,5,2291},{27364,0,2293},
+{27367,0,2294},{27372,0,2295},{27376,9,2296},{27388,5,2299},
+{27394,5,2301},{27398,5,2303},{27401,0,2305},{27407,9,2306},
+{27415,0,2309},{27419,0,2310},{27422,0,2311},{27428,0,2312},
+{27432,0,2313},{27435,5,2314},{27439,0,2316},{27445,5,2317},
+{27451,0,2319},{27455,0,2320},{27462,0,2321},{27466,0,2322},
+{27469,0,2323},{27474,0,2324},{27478,0,2325},{27480,0,2326},
+{27485,0,2327},{27488,0,2328},{27495,0,2329},{27499,0,2330},
+{27502,0,2331},{27504,0,2332},{27509,0,2333},{27517,5,2334},
+{27522,0,2336},{27525,0,2337},{27543,0,2338},{27547,0,2339},
+{27551,5,2340},{27554,5,2342},{27560,5,2344},{27564,9,2346},
+{27568,0,2349},{27576,5,2350},{27581,5,2352},{27587,5,2354},
+{27593,0,2356},{27596,0,2357},{27606,0,2358},{27610,0,2359},
+{27617,0,2360},{27619,0,2361},{27622,5,2362},{27630,0,2364},
+{27633,0,2365},{27639,0,2366},{27641,0,2367},{27647,0,2368},
+{27650,0,2369},{27652,5,2370},{27657,0,2372},{27661,5,2373},
+{27664,0,2375},{27666,0,2376},{27673,0,2377},{27679,0,2378},
+{27686,9,2379},{27692,0,2382},{27694,0,2383},{27699,0,2384},
+{27701,5,2385},{27706,5,2387},{27711,0,2389},{27722,5,2390},
+{27725,0,2392},{27727,0,2393},{27730,0,2394},{27732,0,2395},
+{27737,0,2396},{27739,5,2397},{27751,0,2450},{27755,0,2399},
+{27757,0,2400},{27759,0,2401},{27764,0,2402},{27766,0,2403},
+{27768,5,2404},{27771,0,2406},{27781,9,2407},{27785,0,2410},
+{27796,5,2411},{27799,5,2413},{27804,0,2415},{27807,0,2416},
+{27824,0,2417},{27826,0,2418},{27828,0,2419},{27842,0,2420},
+{27846,0,2421},{27853,0,2422},{27855,13,2423},{27860,0,2427},
+{27862,0,2428},{27866,0,2429},{27868,0,2430},{27872,0,2431},
+{27879,0,2432},{27881,0,2433},{27883,5,2434},{27886,0,2436},
+{27890,0,2437},{27892,0,2438},{27908,0,2439},{27911,0,2440},
+{27914,0,2441},{27918,5,2442},{27921,0,2444},{27923,0,2445},
+{27930,0,2446},{27942,9,2447},{27950,5,2451},{27953,0,2453},
+{27961,0,2454},{27964,0,2455},{27967,0,2456},{27991,0,2457},
+{27998,5,2458},{28001,0,2460},{28005,0,2461},{28007,0,2462},
+{28015,5,2463},{28028,0,2465},{28034,0,2466},{28039,0,2467},
+{28049,5,2468},{28052,0,2470},{28054,9,2471},{28074,0,2474},
+{28076,0,2475},{28084,0,2476},{28087,0,2477},{28089,0,2478},
+{28093,0,2479},{28095,0,2480},{28100,0,2481},{28104,0,2482},
+{28106,0,2483},{28110,5,2484},{28118,0,2486},{28123,0,2487},
+{28125,0,2488},{28127,5,2489},{28130,0,2491},{28133,0,2492},
+{28137,0,2493},{28143,5,2494},{28148,0,2496},{28150,0,2497},
+{28156,0,2498},{28160,0,2499},{28164,0,2500},{28190,0,2501},
+{28194,0,2502},{28199,0,2503},{28210,0,2504},{28214,0,2505},
+{28217,0,2506},{28219,5,2507},{28228,5,2509},{28232,5,2511},
+{28235,0,2513},{28239,0,2514},{28241,13,2515},{28247,0,2519},
+{28252,9,2520},{28258,5,2523},{28264,0,2525},{28275,0,2526},
+{28283,0,2527},{28285,0,2528},{28301,0,2529},{28307,0,2530},
+{28313,0,2531},{28320,0,2532},{28327,0,2533},{28333,5,2534},
+{28337,0,2536},{28339,0,2537},{28347,0,2538},{28351,9,2539},
+{28355,0,2542},{28359,5,2543},{28362,0,2545},{28365,9,2546},
+{28395,0,2549},{28397,5,2550},{28409,0,2552},{28411,0,2553},
+{28413,0,2554},{28420,0,2555},{28424,0,2556},{28426,0,2557},
+{28428,5,2558},{28438,0,2560},{28440,0,2561},{28442,5,2562},
+{28454,0,2564},{28457,5,2565},{28461,0,2573},{28463,5,2567},
+{28467,0,2569},{28470,0,2570},{28475,5,2571},{28495,0,2574},
+{28497,9,2575},{28503,0,2578},{28505,5,2579},{28509,5,2581},
+{28513,5,2583},{28520,0,2585},{28524,0,2586},{28541,5,2587},
+{28547,0,2589},{28551,5,2590},{28555,9,2592},{28560,0,2595},
+{28562,9,2596},{28566,0,2599},{28570,0,2600},{28575,5,2601},
+{28581,13,2603},{28590,9,2607},{28597,5,2610},{28604,0,2612},
+{28613,0,2613},{28615,5,2614},{28618,0,2616},{28634,0,2617},
+{28638,0,2618},{28648,5,2619},{28656,0,2621},{28661,0,2622},
+{28665,0,2623},{28668,5,2624},{28672,0,2626},{28677,9,2627},
+{28685,0,2630},{28695,0,2631},{28704,0,2632},{28707,0,2633},
+{28719,0,2634},{28724,0,2635},{28727,0,2636},{28729,0,2637},
+{28732,0,2638},{28739,5,2639},{28744,13,2641},{28750,0,2649},
+{28756,5,2645},{28765,5,2647},{28772,5,2650},{28780,0,2652},
+{28782,0,2653},{28789,5,2654},{28798,0,2656},{28801,0,2657},
+{28805,5,2658},{28820,17,2660},{28827,0,2665},{28836,0,2666},
+{28843,0,2667},{28848,5,2668},{28852,0,2670},{28855,0,2671},
+{28874,0,2672},{28881,0,2673},{28883,13,2674},{28888,0,2678},
+{28892,0,2679},{28900,0,2680},{28922,0,2681},{28931,17,2682},
+{28939,5,2687},{28943,0,2689},{28958,0,2690},{28960,0,2691},
+{28971,0,2692},{28973,0,2693},{28975,9,2694},{28984,0,2697},
+{28993,0,2698},{28997,9,2699},{29002,5,2702},{29008,0,2704},
+{29010,0,2705},{29015,0,2706},{29018,0,2707},{29020,0,2708},
+{29022,0,2709},{29024,0,2710},{29032,0,2711},{29049,0,2712},
+{29056,0,2713},{29061,0,2714},{29063,0,2715},{29068,0,2716},
+{29074,0,2717},{29082,5,2718},{29088,0,2720},{29090,0,2721},
+{29103,5,2722},{29106,5,2724},{29114,0,2726},{29119,9,2727},
+{29124,0,2730},{29131,5,2731},{29139,0,2733},{29142,0,2734},
+{29145,5,2735},{29148,0,2737},{29176,0,2738},{29182,0,2739},
+{29184,0,2740},{29191,9,2741},{29203,0,2744},{29207,0,2745},
+{29210,0,2746},{29213,0,2747},{29215,0,2748},{29220,0,2749},
+{29227,0,2750},{29231,0,2751},{29236,0,2752},{29240,5,2753},
+{29249,9,2755},{29253,0,2758},{29262,9,2759},{29267,0,2762},
+{29269,5,2763},{29274,0,2765},{29276,0,2766},{29278,0,2767},
+{29280,0,2768},{29283,0,2769},{29288,0,2770},{29291,0,2771},
+{29294,5,2772},{29297,0,2774},{29303,5,2775},{29307,5,2777},
+{29311,0,2779},{29316,0,2780},{29321,0,2781},{29325,5,2782},
+{29331,0,2784},{29339,0,2785},{29352,0,2786},{29357,5,2787},
+{29361,0,2789},{29364,0,2790},{29374,0,2791},{29377,0,2792},
+{29383,0,2793},{29385,0,2794},{29388,0,2795},{29397,5,2796},
+{29400,0,2798},{29407,0,2799},{29413,0,2800},{29427,5,2801},
+{29434,5,2803},{29438,0,2805},{29442,0,2806},{29444,5,2807},
+{29447,0,2809},{29451,0,2810},{29453,0,2811},{29458,5,2812},
+{29464,5,2814},{29470,0,2816},{29474,0,2817},{29476,0,2818},
+{29479,5,2819},{29484,0,2821},{29489,5,2822},{29493,0,2824},
+{29498,5,2825},{29501,0,2827},{29507,0,2828},{29517,0,2829},
+{29520,0,2830},{29522,0,2831},{29526,0,2832},{29528,0,2833},
+{29533,13,2834},{29542,5,2838},{29545,0,2840},{29547,5,2841},
+{29550,5,2843},{29553,0,2845},{29559,0,2846},{29561,0,2847},
+{29564,0,2848},{29568,5,2849},{29571,0,2851},{29573,5,2852},
+{29582,0,2854},{29584,0,2855},{29587,0,2856},{29589,0,2857},
+{29591,5,2858},{29596,0,2860},{29598,9,2861},{29602,0,2864},
+{29605,5,2865},{29610,5,2867},{29613,0,2869},{29621,0,2870},
+{29623,0,2871},{29625,0,2872},{29628,5,2873},{29631,0,2875},
+{29637,5,2876},{29641,0,2878},{29643,5,2879},{29647,0,2881},
+{29650,5,2882},{29654,0,2884},{29657,0,2885},{29661,0,2886},
+{29665,0,2887},{29667,0,2888},{29670,5,2889},{29673,0,2891},
+{29684,5,2892},{29687,0,2894},{29689,9,2895},{29693,0,2898},
+{29695,9,2899},{29700,0,2902},{29703,0,2903},{29706,0,2904},
+{29713,0,2905},{29722,5,2906},{29732,0,2908},{29734,0,2909},
+{29736,37,2910},{29753,0,2920},{29760,0,2921},{29763,5,2922},
+{29766,5,2924},{29771,0,2926},{29773,0,2927},{29777,5,2928},
+{29783,0,2930},{29789,0,2931},{29794,0,2932},{29798,9,2933},
+{29803,0,2936},{29805,5,2937},{29809,5,2939},{29824,5,2941},
+{29829,9,2943},{29833,0,2946},{29839,13,2947},{29848,9,2951},
+{29852,0,2954},{29855,9,2955},{29859,0,2958},{29862,0,2959},
+{29864,13,2960},{29870,5,2964},{29873,5,2966},{29877,0,2968},
+{29881,0,2969},{29883,0,2970},{29887,0,2971},{29896,5,2972},
+{29900,0,2974},{29904,0,2975},{29907,0,2976},{29912,0,2977},
+{29914,5,2978},{29918,5,2980},{29924,0,2982},{29928,0,2983},
+{29930,5,2984},{29935,0,2986},{29940,0,2987},{29946,9,2988},
+{29951,0,2991},{29958,0,2992},{29970,0,2993},{29974,5,2994},
+{29984,5,2996},{29988,0,2998},{29991,0,2999},{29993,5,3000},
+{29999,0,3002},{30006,0,3003},{30009,0,3004},{30013,13,3005},
+{30019,0,3009},{30023,5,3010},{30030,0,3012},{30032,0,3013},
+{30034,0,3014},{30039,0,3015},{30046,5,3016},{30049,0,3018},
+{30063,0,3019},{30065,0,3020},{30073,21,3021},{30081,0,3027},
+{30085,0,3028},{30096,0,3029},{30098,5,3030},{30101,0,3032},
+{30105,0,3033},{30108,0,3034},{30114,0,3035},{30116,0,3036},
+{30132,0,3037},{30138,0,3038},{30143,9,3039},{30148,0,3042},
+{30150,0,3043},{30156,0,3044},{30158,5,3045},{30167,0,3047},
+{30172,0,3048},{30175,9,3049},{30180,0,3052},{30183,0,3053},
+{30188,0,3054},{30190,5,3055},{30193,0,3057},{30201,0,3058},
+{30208,0,3059},{30210,9,3060},{30215,5,3063},{30218,0,3065},
+{30220,0,3066},{30223,0,3067},{30226,5,3068},{30229,5,3070},
+{30233,0,3072},{30235,13,3073},{30243,0,3077},{30245,5,3078},
+{30249,0,3080},{30253,0,3081},{30258,5,3082},{30261,0,3084},
+{30264,9,3085},{30268,0,3088},{30272,5,3090},{30275,9,3092},
+{30281,10,241},{30293,0,3097},{30297,0,3098},{30303,0,3099},
+{30308,5,3100},{30317,9,3102},{30321,0,3105},{30324,0,3106},
+{30337,0,3107},{30341,0,3108},{30348,5,3109},{30357,0,3111},
+{30363,9,3112},{30367,5,3115},{30370,25,3117},{30378,0,3124},
+{30381,0,3125},{30397,0,3126},{30401,0,3127},{30405,0,3128},
+{30409,0,3129},{30411,5,3130},{30414,0,3132},{30420,0,3133},
+{30425,0,3134},{30432,0,3135},{30438,0,3136},{30440,0,3137},
+{30444,0,3138},{30448,5,3139},{30454,0,3141},{30457,0,3142},
+{30460,0,3143},{30464,0,3144},{30470,0,3145},{30474,0,3146},
+{30478,0,3147},{30482,0,3148},{30484,5,3149},{30487,0,3151},
+{30489,5,3152},{30492,0,3154},{30498,0,3155},{30504,0,3156},
+{30509,9,3157},{30516,9,3160},{30521,0,3163},{30525,5,3164},
+{30530,0,3166},{30533,5,3167},{30538,0,3169},{30541,9,3170},
+{30546,0,3173},{30550,5,3174},{30556,0,3176},{30558,9,3177},
+{30562,0,3180},{30564,0,3181},{30567,0,3182},{30570,0,3183},
+{30572,0,3184},{30576,0,3185},{30578,9,3186},{30586,0,3189},
+{30589,0,3190},{30592,0,3191},{30596,0,3192},{30604,5,3193},
+{30612,9,3195},{30618,0,3198},{30623,0,3199},{30626,0,3200},
+{30631,0,3201},{30634,0,3202},{30638,5,3203},{30641,0,3205},
+{30645,0,3206},{30654,0,3207},{30659,0,3208},{30665,0,3209},
+{30673,5,3210},{30677,0,3212},{30681,0,3213},{30686,9,3214},
+{30692,0,3217},{30694,0,3218},{30698,0,3219},{30700,0,3220},
+{30704,5,3221},{30708,0,3223},{30712,0,3224},{30715,0,3225},
+{30725,5,3226},{30729,0,3228},{30733,5,3229},{30737,0,3231},
+{30749,0,3232},{30753,9,3233},{30765,5,3236},{30768,0,3238},
+{30773,0,3239},{30775,0,3240},{30787,5,3241},{30791,5,3243},
+{30796,0,3245},{30798,0,3246},{30802,0,3247},{30812,0,3248},
+{30814,0,3249},{30816,5,3250},{30819,5,3252},{30824,0,3254},
+{30826,0,3255},{30830,0,3256},{30842,0,3257},{30846,0,3258},
+{30858,0,3259},{30863,0,3260},{30868,0,3261},{30872,0,3262},
+{30877,9,3264},{30881,0,3263},{30884,0,3267},{30888,0,3268},
+{30892,5,3269},{30896,13,3271},{30907,0,3275},{30909,0,3276},
+{30911,0,3277},{30919,9,3278},{30924,0,3281},{30926,0,3282},
+{30930,5,3283},{30933,5,3285},{30939,0,3288},{30943,9,3289},
+{30948,0,3287},{30950,0,3292},{30954,0,3293},{30962,5,3294},
+{30966,5,3297},{30970,5,3299},{30975,6,244},{30982,0,3302},
+{30988,0,3303},{30992,0,3304},{31002,0,3305},{31004,0,3306},
+{31006,9,3307},{31013,0,3310},{31015,0,3311},{31017,0,3312},
+{31021,0,3313},{31025,0,3314},{31028,5,3315},{31035,0,3317},
+{31037,0,3318},{31039,0,3319},{31044,9,3320},{31050,5,3323},
+{31055,0,3325},{31057,0,3326},{31060,0,3327},{31064,0,3328},
+{31067,5,3329},{31079,0,3331},{31081,0,3332},{31083,0,3333},
+{31090,0,3334},{31097,0,3335},{31099,5,3336},{31102,0,3338},
+{31115,5,3339},{31121,0,3341},{31123,13,3342},{31128,0,3346},
+{31131,5,3347},{31137,0,3349},{31144,5,3350},{31147,0,3352},
+{31151,0,3353},{31153,0,3354},{31156,0,3355},{31160,0,3356},
+{31163,0,3357},{31170,0,3358},{31172,0,3359},{31175,5,3360},
+{31178,0,3362},{31183,0,3363},{31188,0,3364},{31190,0,3365},
+{31194,0,3366},{31197,5,3367},{31200,0,3369},{31202,0,3370},
+{31205,0,3371},{31210,5,3372},{31213,0,3374},{31217,0,3375},
+{31224,0,3376},{31228,0,3377},{31234,5,3378},{31239,0,3380},
+{31241,5,3381},{31244,0,3383},{31249,0,3384},{31253,0,3385},
+{31259,0,3386},{31262,0,3387},{31265,0,3388},{31271,0,3389},
+{31275,0,3390},{31277,0,3391},{31279,5,3392},{31284,5,3394},
+{31288,9,3396},{31300,5,3399},{31303,5,3401},{31308,0,3403},
+{31317,5,3404},{31321,0,3406},{31324,5,3407},{31327,5,3409},
+{31333,0,3411},{31335,0,3412},{31338,0,3413},{31341,0,3414},
+{31349,0,3415},{31352,0,3416},{31358,0,3417},{31360,0,3418},
+{31362,0,3419},{31365,5,3420},{31370,5,3422},{31376,5,3424},
+{31380,0,3426},{31390,0,3427},{31392,0,3428},{31395,0,3429},
+{31404,0,3430},{31411,0,3431},{31413,0,3432},{31417,0,3433},
+{31419,5,3434},{31430,0,3436},{31433,0,3437},{31436,0,3438},
+{31438,0,3439},{31441,0,3440},{31451,0,3441},{31464,5,3442},
+{31467,5,3444},{31473,0,3446},{31476,0,3447},{31483,0,3448},
+{31485,5,3449},{31495,0,3451},{31508,0,3452},{31519,0,3453},
+{31523,0,3454},{31527,0,3455},{31529,9,3456},{31533,17,3459},
+{31540,0,3464},{31549,0,3465},{31551,9,3466},{31559,0,3469},
+{31566,0,3470},{31573,0,3471},{31584,0,3472},{31588,0,3473},
+{31590,0,3474},{31593,5,3475},{31597,0,3477},{31599,0,3478},
+{31602,5,3479},{31607,0,3481},{31620,0,3482},{31625,0,3483},
+{31630,0,3484},{31632,5,3485},{31638,0,3487},{31643,0,3488},
+{31646,0,3489},{31648,0,3490},{31653,0,3491},{31660,0,3492},
+{31663,5,3493},{31666,0,3495},{31669,5,3496},{31674,13,3498},
+{31682,0,3502},{31685,0,3503},{31688,0,3504},{31690,0,3505},
+{31700,0,3506},{31702,5,3507},{31705,9,3509},{31720,0,3512},
+{31722,0,3513},{31730,0,3514},{31732,5,3515},{31736,9,3517},
+{31740,0,3520},{31742,0,3521},{31745,13,3522},{31750,0,3526},
+{31753,0,3527},{31755,5,3528},{31758,5,3530},{31769,0,3532},
+{31771,0,3533},{31776,0,3534},{31781,5,3535},{31784,0,3537},
+{31788,0,3538},{31793,0,3539},{31795,5,3540},{31798,0,3542},
+{31801,5,3543},{31814,0,3545},{31818,0,3546},{31825,9,3548},
+{31829,0,3547},{31833,21,3551},{31841,0,3557},{31843,0,3558},
+{31847,0,3559},{31849,0,3560},{31853,5,3561},{31856,0,3563},
+{31858,0,3564},{31865,0,3565},{31868,5,3566},{31878,5,3568},
+{31887,0,3570},{31892,0,3571},{31902,0,3572},{31904,0,3573},
+{31910,0,3574},{31920,0,3575},{31926,5,3576},{31930,9,3578},
+{31935,0,3581},{31940,0,3582},{31943,9,3583},{31949,0,3586},
+{31951,0,3587},{31955,9,3588},{31959,0,3591},{31961,5,3592},
+{31965,0,3594},{31974,0,3595},{31977,0,3596},{31979,0,3597},
+{31989,0,3598},{32003,0,3599},{32007,9,3600},{32015,0,3603},
+{32017,9,3604},{32022,0,3607},{32029,5,3608},{32035,0,3610},
+{32038,0,3611},{32042,0,3612},{32045,0,3613},{32049,0,3614},
+{32060,9,3615},{32064,5,3618},{32071,5,3620},{32077,0,3622},
+{32081,0,3623},{32083,0,3624},{32087,0,3625},{32089,5,3626},
+{32092,5,3628},{32101,0,3630},{32103,0,3631},{32106,0,3632},
+{32112,0,3633},{32120,0,3634},{32122,5,3635},{32127,0,3637},
+{32129,9,3638},{32133,5,3641},{32136,0,3643},{32139,9,3644},
+{32145,0,3647},{32150,5,3648},{32157,5,3650},{32166,5,3652},
+{32170,0,3654},{32179,0,3655},{32182,5,3656},{32185,0,3658},
+{32194,17,3659},{32204,9,3664},{32215,0,3667},{32217,0,3668},
+{32226,0,3670},{32229,5,3671},{32234,5,3673},{32237,0,3675},
+{32241,0,3676},{32245,5,3677},{32249,5,3679},{32256,0,3669},
+{32264,0,3681},{32272,5,3682},{32277,0,3684},{32279,0,3685},
+{32284,5,3686},{32288,0,3688},{32295,5,3689},{32300,5,3691},
+{32303,0,3693},{32307,0,3694},{32310,0,3695},{32319,0,3696},
+{32324,5,3697},{32327,0,3699},{32334,0,3700},{32336,0,3701},
+{32338,0,3702},{32344,0,3703},{32351,0,3704},{32353,5,3705},
+{32357,0,3707},{32363,0,3708},{32366,5,3709},{32371,0,3711},
+{32376,0,3712},{32382,0,3713},{32385,0,3714},{32390,5,3715},
+{32394,0,3717},{32397,0,3718},{32401,0,3719},{32405,0,3720},
+{32408,0,3721},{32410,0,3722},{32413,5,3723},{32571,6,246},
+{32573,9,3727},{32579,5,3730},{32583,0,3732},{32591,0,3733},
+{32594,5,3734},{32603,9,3736},{32609,0,3739},{32611,13,3740},
+{32621,0,3744},{32625,0,3745},{32637,13,3746},{32651,0,3750},
+{32653,0,3751},{32655,9,3752},{32662,5,3755},{32668,0,3757},
+{32673,5,3758},{32678,0,3760},{32682,0,3761},{32685,0,3762},
+{32692,0,3763},{32700,0,3764},{32703,5,3765},{32707,0,3767},
+{32712,0,3768},{32718,5,3769},{32731,0,3771},{32735,0,3772},
+{32739,0,3773},{32741,0,3774},{32744,0,3775},{32748,0,3776},
+{32750,5,3777},{32754,0,3779},{32762,0,3780},{32765,9,3781},
+{32775,5,3784},{32778,0,3786},{32781,9,3787},{32785,0,3790},
+{32787,5,3791},{32790,0,3793},{32797,13,3794},{32804,0,3798},
+{32806,0,3799},{32812,0,3800},{32814,0,3801},{32816,0,3802},
+{32820,5,3803},{32823,0,3805},{32825,5,3806},{32828,0,3808},
+{32830,0,3809},{32832,0,3810},{32836,0,3811},{32864,0,3812},
+{32868,0,3813},{32870,0,3814},{32877,0,3815},{32881,0,3816},
+{32885,0,3817},{32897,0,3818},{32904,0,3819},{32910,0,3820},
+{32924,0,3821},{32926,0,3822},{32934,5,3823},{32939,0,3825},
+{32952,5,3826},{32968,0,3828},{32973,0,3829},{32975,0,3830},
+{32978,0,3831},{32980,5,3832},{32983,5,3834},{32992,0,3836},
+{33005,5,3837},{33008,0,3839},{33010,5,3840},{33014,0,3842},
+{33017,5,3843},{33022,0,3845},{33027,0,3846},{33035,0,3847},
+{33046,9,3848},{33052,0,3851},{33054,0,3852},{33056,0,3853},
+{33060,0,3854},{33063,0,3855},{33068,0,3856},{33072,0,3857},
+{33077,0,3858},{33082,0,3859},{33084,0,3860},{33093,0,3861},
+{33095,0,3862},{33098,0,3863},{33100,0,3864},{33106,0,3865},
+{33111,0,3866},{33120,5,3867},{33127,9,3869},{33133,0,3872},
+{33135,0,3873},{33143,0,3874},{33153,0,3875},{33156,9,3877},
+{33163,0,3880},{33166,0,3881},{33168,0,3876},{33174,0,3882},
+{33176,0,3883},{33179,0,3884},{33182,0,3885},{33186,0,3886},
+{33198,0,3887},{33202,0,3888},{33204,0,3889},{33211,0,3890},
+{33219,0,3892},{33221,0,3893},{33226,6,248},{33230,5,3895},
+{33237,0,3897},{33239,0,3898},{33243,0,3899},{33245,5,3900},
+{33249,0,3902},{33252,0,3903},{33259,5,3904},{33264,9,3906},
+{33269,5,3909},{33272,5,3911},{33277,0,3913},{33279,5,3914},
+{33283,0,3916},{33295,0,3917},{33299,5,3918},{33305,5,3920},
+{33309,0,3922},{33313,5,3923},{33320,0,3925},{33330,0,3926},
+{33332,0,3927},{33338,0,3928},{33347,13,3929},{33355,0,3933},
+{33358,5,3934},{33361,0,3936},{33366,0,3937},{33372,0,3938},
+{33376,0,3939},{33379,0,3940},{33383,0,3941},{33389,0,3942},
+{33396,0,3943},{33403,0,3944},{33405,0,3945},{33407,9,3946},
+{33411,5,3949},{33415,0,3951},{33417,5,3952},{33422,0,3954},
+{33425,0,3955},{33428,0,3956},{33430,0,3957},{33432,0,3958},
+{33434,5,3959},{33440,5,3961},{33443,5,3963},{33447,13,3965},
+{33454,0,3969},{33456,0,3970},{33458,0,3971},{33460,0,3972},
+{33463,0,3973},{33466,0,3974},{33468,0,3975},{33470,5,3976},
+{33478,0,3978},{33488,0,3979},{33493,0,3980},{33498,0,3981},
+{33504,0,3982},{33506,0,3983},{33508,0,3984},{33512,0,3985},
+{33514,0,3986},{33517,0,3987},{33519,0,3988},{33526,5,3989},
+{33533,5,3991},{33536,5,3993},{33543,5,3995},{33546,5,3997},
+{33563,0,4000},{33565,9,4001},{33569,5,4004},{33580,9,4006},
+{33584,0,4009},{33587,0,4010},{33591,0,4011},{33594,0,4012},
+{33596,5,4013},{33602,9,4015},{33607,0,4018},{33613,5,4019},
+{33617,0,4021},{33619,6,250},{33621,9,4022},{33648,0,4025},
+{33656,0,4026},{33661,0,4027},{33663,5,4028},{33666,0,4030},
+{33668,0,4031},{33670,0,4032},{33677,0,4033},{33682,0,4034},
+{33684,5,4035},{33688,5,4037},{33691,9,4039},{33702,5,4042},
+{33705,0,4044},{33708,6,252},{33726,9,4046},{33735,0,4049},
+{33737,0,4050},{33743,9,4051},{33748,0,4054},{33757,0,4055},
+{33768,0,4057},{33770,0,4058},{33782,0,4059},{33784,5,4060},
+{33788,0,4062},{33793,0,4063},{33798,0,4064},{33802,0,4065},
+{33807,0,4066},{33809,0,4067},{33813,0,4068},{33817,0,4069},
+{33839,0,4071},{33849,0,4072},{33861,0,4073},{33863,5,4074},
+{33866,0,4076},{33869,0,4077},{33871,0,4078},{33873,5,4079},
+{33878,0,4081},{33880,9,4082},{33884,0,4085},{33888,0,4086},
+{33892,5,4087},{33895,0,4089},{33898,0,4090},{33904,0,4091},
+{33907,5,4092},{33910,0,4094},{33912,0,4095},{33916,5,4096},
+{33921,0,4098},{33925,0,4099},{33938,5,4100},{33941,0,4102},
+{33950,0,4103},{33958,0,4104},{33960,9,4105},{33967,0,4108},
+{33969,0,4109},{33972,0,4110},{33978,0,4111},{33981,5,4112},
+{33984,0,4114},{33986,0,4115},{33991,5,4116},{33996,0,4118},
+{33999,0,4119},{34003,0,4120},{34012,0,4121},{34023,0,4122},
+{34026,0,4123},{34031,13,4124},{34039,0,4128},{34042,5,4130},
+{34045,0,4132},{34050,5,4133},{34055,0,4135},{34060,0,4136},
+{34062,0,4137},{34064,0,4138},{34076,0,4139},{34078,0,4140},
+{34082,13,4141},{34087,0,4145},{34090,5,4146},{34095,0,4148},
+{34098,0,4129},{34099,5,4149},{34102,0,4151},{34111,0,4152},
+{34118,0,4153},{34127,17,4154},{34134,0,4159},{34137,0,4160},
+{34140,25,4161},{34148,0,4168},{34155,0,4169},{34159,0,4170},
+{34169,9,4171},{34173,0,4174},{34175,0,4175},{34177,0,4176},
+{34181,5,4177},{34185,0,4179},{34187,5,4180},{34191,0,4182},
+{34195,0,4183},{34200,0,4184},{34205,0,4185},{34207,5,4186},
+{34210,0,4188},{34213,0,4189},{34215,0,4190},{34221,0,4204},
+{34228,0,4191},{34230,9,4192},{34236,13,4195},{34242,0,4199},
+{34247,0,4200},{34250,5,4201},{34254,0,4203},{34264,0,4205},
+{34266,0,4206},{34271,5,4207},{34278,0,4209},{34280,0,4210},
+{34285,0,4211},{34291,0,4212},{34294,0,4213},{34300,0,4214},
+{34303,5,4215},{34308,5,4217},{34317,5,4219},{34320,9,4221},
+{34328,5,4224},{34331,0,4226},{34334,0,4227},{34337,0,4228},
+{34343,0,4229},{34345,0,4230},{34358,0,4231},{34360,0,4232},
+{34362,0,4233},{34364,5,4234},{34368,10,254},{34374,0,4238},
+{34386,5,4239},{34390,13,4241},{34397,0,4245},{34400,17,4246},
+{34409,0,4251},{34412,0,4252},{34415,0,4253},{34421,9,4254},
+{34426,0,4257},{34440,0,4291},{34445,0,4258},{34449,0,4259},
+{34454,0,4260},{34456,0,4261},{34458,0,4262},{34460,0,4263},
+{34465,0,4264},{34470,9,4265},{34477,0,4268},{34481,0,4269},
+{34483,9,4270},{34487,9,4273},{34495,9,4276},{34499,0,4279},
+{34501,0,4280},{34513,5,4281},{34517,0,4283},{34519,0,4284},
+{34522,0,4285},{34524,0,4286},{34528,0,4287},{34531,0,4288},
+{34533,0,4289},{34535,0,4290},{34554,0,4292},{34556,5,4293},
+{34564,5,4295},{34567,0,4297},{34571,0,4298},{34574,9,4299},
+{34579,5,4302},{34585,0,4304},{34590,5,4305},{34593,0,4307},
+{34595,0,4308},{34600,0,4309},{34606,5,4310},{34609,5,4312},
+{34617,5,4314},{34620,9,4316},{34624,0,4319},{34627,0,4320},
+{34629,0,4321},{34637,0,4322},{34648,0,4323},{34653,0,4324},
+{34657,0,4325},{34660,5,4326},{34671,0,4328},{34673,5,4329},
+{34683,0,4331},{34691,25,4332},{34699,5,4339},{34704,0,4341},
+{34707,0,4342},{34709,0,4343},{34711,9,4344},{34718,0,4347},
+{34720,0,4348},{34723,0,4349},{34727,0,4350},{34732,9,4351},
+{34737,0,4354},{34741,0,4355},{34750,5,4356},{34753,0,4358},
+{34760,9,4359},{34766,0,4362},{34773,5,4363},{34777,5,4365},
+{34780,0,4367},{34783,0,4368},{34786,9,4369},{34794,5,4372},
+{34797,0,4374},{34801,0,4375},{34803,0,4376},{34808,0,4377},
+{34810,0,4378},{34815,0,4379},{34817,0,4380},{34819,0,4381},
+{34822,0,4382},{34825,9,4383},{34832,0,4386},{34834,9,4388},
+{34840,6,257},{34842,9,4392},{34846,5,4395},{34856,0,4397},
+{34861,5,4398},{34864,0,4400},{34866,0,4401},{34869,0,4402},
+{34874,0,4403},{34876,0,4404},{34881,0,4405},{34883,0,4406},
+{34885,0,4407},{34888,13,4408},{34894,0,4412},{34897,0,4413},
+{34901,5,4414},{34904,0,4416},{34906,0,4417},{34908,0,4418},
+{34911,5,4419},{34916,0,4421},{34921,0,4422},{34929,0,4423},
+{34937,0,4424},{34939,0,4425},{34944,0,4426},{34968,0,4427},
+{34970,9,4428},{34975,5,4431},{34984,0,4433},{34986,0,4434},
+{35002,0,4435},{35005,5,4436},{35008,0,4438},{35018,17,4439},
+{35025,9,4444},{35035,0,4447},{35038,0,4448},{35047,0,4449},
+{35055,9,4450},{35061,0,4453},{35063,0,4454},{35073,0,4455},
+{35078,0,4456},{35085,9,4457},{35093,5,4460},{35096,9,4462},
+{35100,0,4465},{35104,0,4466},{35110,9,4467},{35120,9,4470},
+{35125,0,4473},{35129,5,4474},{35134,0,4476},{35136,0,4477},
+{35138,0,4478},{35141,5,4479},{35145,0,4481},{35151,0,4482},
+{35154,0,4483},{35159,0,4484},{35162,9,4485},{35169,9,4488},
+{35179,0,4491},{35182,0,4492},{35184,0,4493},{35187,0,4494},
+{35189,0,4495},{35194,13,4496},{35209,0,4500},{35213,0,4501},
+{35216,0,4502},{35220,5,4503},{35227,5,4505},{35231,5,4507},
+{35237,0,4509},{35248,0,4510},{35252,13,4511},{35260,0,4515},
+{35284,17,4516},{35301,0,4521},{35305,0,4522},{35307,0,4523},
+{35309,0,4524},{35313,0,4525},{35315,0,4526},{35318,0,4527},
+{35321,0,4528},{35325,0,4529},{35327,0,4530},{35332,5,4531},
+{35335,0,4533},{35343,0,4534},{35345,5,4535},{35348,5,4537},
+{35358,0,4539},{35360,0,4540},{35362,0,4541},{35364,0,4542},
+{35366,0,4543},{35371,5,4544},{35375,0,4546},{35381,0,4547},
+{35383,0,4548},{35389,5,4549},{35392,0,4551},{35395,0,4552},
+{35397,0,4553},{35399,0,4554},{35401,0,4555},{35405,5,4556},
+{35411,0,4558},{35414,9,4559},{35420,5,4562},{35425,0,4564},
+{35429,0,4565},{35431,0,4566},{35445,9,4567},{35449,9,4570},
+{35454,9,4573},{35459,0,4576},{35462,0,4577},{35467,0,4578},
+{35471,5,4579},{35474,0,4581},{35478,5,4582},{35481,0,4584},
+{35487,0,4585},{35495,0,4586},{35497,0,4587},{35502,5,4588},
+{35507,0,4590},{35510,5,4591},{35515,0,4593},{35518,0,4594},
+{35523,0,4595},{35526,0,4596},{35528,9,4597},{35537,0,4600},
+{35539,9,4601},{35543,0,4604},{35549,0,4605},{35551,0,4606},
+{35564,0,4607},{35568,0,4608},{35572,9,4609},{35580,0,4612},
+{35583,0,4613},{35589,5,4614},{35594,6,259},{35601,0,4617},
+{35612,0,4618},{35614,5,4619},{35629,0,4622},{35632,0,4623},
+{35639,0,4624},{35644,0,4625},{35650,17,4626},{35656,0,4631},
+{35661,0,4636},{35666,9,4632},{35673,0,4635},{35678,0,4637},
+{35683,0,4638},{35693,0,4639},{35702,0,4640},{35704,5,4641},
+{35708,0,4643},{35710,0,4644},{35713,0,4645},{35716,5,4646},
+{35723,0,4648},{35725,0,4649},{35727,0,4650},{35732,5,4651},
+{35740,0,4653},{35742,5,4654},{35896,5,4656},{35901,5,4658},
+{35909,0,4660},{35911,0,4661},{35913,0,4662},{35915,0,4663},
+{35919,0,4664},{35921,0,4665},{35923,5,4666},{35927,5,4668},
+{35929,0,4672},{35931,0,4670},{35933,0,4671},{35939,5,4673},
+{35942,0,4675},{35944,5,4676},{35949,0,4678},{35955,0,4679},
+{35957,5,4680},{35963,0,4682},{35966,0,4683},{35974,5,4684},
+{35979,0,4686},{35984,0,4687},{35986,5,4688},{35993,0,4690},
+{35995,5,4691},{36004,0,4693},{36025,5,4694},{36037,5,4696},
+{36041,0,4698},{36043,0,4699},{36047,0,4700},{36053,6,261},
+{36057,0,4703},{36061,0,4704},{36065,0,4705},{36072,0,4706},
+{36076,0,4707},{36079,5,4708},{36082,0,4710},{36085,0,4711},
+{36087,5,4712},{36094,5,4714},{36097,0,4716},{36099,0,4717},
+{36105,0,4718},{36114,0,4719},{36119,0,4720},{36123,0,4721},
+{36197,0,4722},{36201,0,4723},{36204,0,4724},{36206,0,4725},
+{36223,0,4726},{36226,0,4727},{36228,0,4728},{36232,0,4729},
+{36237,0,4730},{36240,5,4731},{36245,0,4733},{36254,9,4734},
+{36262,0,4737},{36267,5,4738},{36271,0,4740},{36274,0,4741},
+{36277,0,4742},{36279,0,4743},{36281,0,4744},{36283,6,263},
+{36288,0,4746},{36293,13,4747},{36298,0,4751},{36302,0,4752},
+{36305,0,4753},{36308,5,4754},{36311,0,4756},{36313,0,4757},
+{36324,5,4758},{36327,0,4760},{36332,0,4761},{36336,0,4762},
+{36337,5,4764},{36340,0,4766},{36349,0,4767},{36353,0,4768},
+{36356,9,4769},{36363,0,4772},{36369,0,4773},{36372,0,4774},
+{36374,0,4775},{36384,13,4776},{36390,5,4780},{36401,0,4782},
+{36403,0,4783},{36406,13,4784},{36413,0,4788},{36416,5,4789},
+{36427,0,4791},{36429,9,4792},{36436,0,4795},{36443,13,4796},
+{36449,5,4800},{36457,0,4802},{36460,5,4803},{36463,9,4805},
+{36473,9,4808},{36482,5,4811},{36489,0,4813},{36496,0,4814},
+{36498,0,4815},{36501,0,4816},{36506,5,4817},{36509,5,4819},
+{36514,0,4821},{36519,0,4822},{36521,0,4823},{36525,5,4824},
+{36531,0,4826},{36533,0,4827},{36538,5,4828},{36544,5,4830},
+{36547,5,4832},{36551,0,4834},{36559,0,4835},{36561,0,4836},
+{36564,0,4837},{36572,0,4838},{36584,0,4839},{36589,6,265},
+{36592,5,4841},{36599,0,4843},{36601,5,4844},{36608,0,4847},
+{36610,0,4848},{36615,5,4849},{36623,5,4851},{36630,9,4853},
+{36638,0,4856},{36640,5,4857},{36643,0,4859},{36645,0,4860},
+{36647,5,4861},{36652,9,4863},{36660,13,4866},{36666,0,4870},
+{36672,5,4871},{36675,0,4873},{36679,0,4874},{36687,0,4875},
+{36689,17,4876},{36696,0,4881},{36701,5,4882},{36709,0,4884},
+{36765,0,4885},{36768,5,4886},{36772,9,4888},{36789,5,4891},
+{36792,0,4893},{36798,0,4894},{36800,5,4895},{36806,0,4897},
+{36810,5,4898},{36813,0,4900},{36816,0,4901},{36818,5,4902},
+{36821,0,4904},{36832,0,4905},{36835,5,4906},{36840,0,4908},
+{36846,0,4909},{36849,0,4910},{36853,5,4911},{36859,0,4913},
+{36862,0,4914},{36866,0,4915},{36868,0,4916},{36872,0,4917},
+{36876,0,4918},{36888,0,4919},{36891,0,4920},{36904,5,4921},
+{36906,0,4924},{36908,5,4925},{36911,0,4923},{36915,5,4927},
+{36919,0,4929},{36927,0,4930},{36931,5,4931},{36940,0,4933},
+{36955,0,4934},{36957,0,4935},{36962,0,4936},{36966,5,4937},
+{36972,0,4939},{36976,0,4940},{36980,0,4941},{36985,0,4942},
+{36997,0,4943},{37000,0,4944},{37003,5,4945},{37006,0,4947},
+{37008,0,4948},{37013,0,4949},{37015,9,4950},{37019,0,4953},
+{37024,9,4954},{37029,0,4957},{37040,0,4958},{37042,9,4959},
+{37046,0,4962},{37053,6,267},{37059,9,4966},{37063,5,4969},
+{37068,0,4964},{37074,0,4979},{37077,0,4971},{37079,9,4972},
+{37084,5,4975},{37087,0,4977},{37093,0,4978},{37099,0,4981},
+{37103,5,4982},{37108,0,4984},{37110,0,4980},{37118,9,4985},
+{37124,9,4988},{37128,0,4991},{37133,0,4992},{37136,0,4993},
+{37140,0,4994},{37142,9,4995},{37146,0,4998},{37148,0,4999},
+{37150,0,5000},{37152,0,5001},{37154,5,5003},{37157,0,5002},
+{37159,0,5005},{37161,0,5006},{37166,5,5007},{37169,0,5009},
+{37172,0,5010},{37174,5,5011},{37177,5,5013},{37180,5,5015},
+{37187,0,5017},{37191,5,5018},{37199,0,5020},{37203,0,5021},
+{37207,0,5022},{37209,9,5023},{37217,0,5026},{37220,0,5027},
+{37223,0,5028},{37229,0,5029},{37236,0,5030},{37241,9,5031},
+{37249,0,5034},{37251,0,5035},{37253,5,5036},{37258,0,5038},
+{37262,0,5039},{37265,0,5040},{37267,9,5041},{37272,0,5044},
+{37278,0,5045},{37281,0,5046},{37286,0,5047},{37288,0,5048},
+{37292,9,5049},{37296,13,5052},{37302,0,5056},{37307,9,5057},
+{37311,0,5060},{37314,5,5061},{37317,0,5063},{37331,5,5064},
+{37335,0,5066},{37337,5,5067},{37342,0,5069},{37348,5,5070},
+{37353,5,5072},{37356,21,5074},{37367,0,5080},{37369,0,5081},
+{37371,0,5082},{37373,0,5083},{37376,5,5084},{37380,13,5086},
+{37385,5,5090},{37388,0,5092},{37392,0,5093},{37394,5,5094},
+{37398,0,5096},{37400,0,5097},{37404,5,5098},{37411,13,5100},
+{37416,0,5104},{37422,9,5105},{37427,0,5108},{37429,5,5109},
+{37432,9,5111},{37436,0,5114},{37438,0,5115},{37440,0,5116},
+{37442,5,5117},{37446,5,5119},{37450,0,5121},{37453,9,5122},
+{37457,0,5125},{37464,5,5126},{37468,5,5128},{37472,5,5130},
+{37477,0,5132},{37479,9,5133},{37486,9,5136},{37493,17,5139},
+{37499,9,5144},{37503,0,5147},{37512,9,5148},{37517,5,5151},
+{37522,0,5153},{37527,0,5154},{37529,0,5155},{37535,5,5156},
+{37540,5,5158},{37543,5,5160},{37547,0,5162},{37551,0,5163},
+{37554,0,5164},{37558,0,5165},{37560,0,5166},{37562,13,5167},
+{37567,17,5171},{37573,13,5176},{37579,13,5180},{37584,0,5184},
+{37587,0,5185},{37589,0,5186},{37591,9,5187},{37596,5,5190},
+{37599,9,5192},{37603,0,5195},{37605,0,5196},{37607,5,5197},
+{37612,0,5199},{37614,0,5200},{37616,0,5201},{37625,0,5202},
+{37627,0,5203},{37631,5,5204},{37634,0,5206},{37640,0,5207},
+{37645,0,5208},{37649,0,5209},{37652,5,5210},{37660,13,5212},
+{37665,0,5216},{37668,5,5217},{37671,0,5219},{37673,5,5220},
+{37683,5,5222},{37686,5,5224},{37703,9,5226},{37712,9,5229},
+{37717,0,5232},{37719,5,5233},{37722,0,5235},{37726,0,5236},
+{37732,5,5237},{37735,0,5239},{37737,5,5240},{37741,0,5242},
+{37743,9,5243},{37747,5,5246},{37750,0,5248},{37754,0,5249},
+{37757,0,5250},{37759,13,5251},{37768,0,5255},{37770,5,5256},
+{37773,0,5258},{37775,0,5259},{37778,0,5260},{37781,0,5261},
+{37784,0,5262},{37787,0,5263},{37790,0,5264},{37793,0,5265},
+{37795,5,5266},{37798,0,5268},{37800,6,269},{37803,0,5270},
+{37812,9,5271},{37818,0,5274},{37825,0,5276},{37828,13,5277},
+{37833,17,5281},{37843,0,5286},{37849,0,5287},{37852,0,5288},
+{37854,5,5289},{37858,0,5291},{37862,5,5292},{37879,5,5295},
+{37881,0,5294},{37882,5,5297},{37885,0,5299},{37889,5,5300},
+{37892,0,5302},{37896,5,5303},{37901,9,5305},{37909,9,5308},
+{37919,0,5311},{37934,5,5312},{37937,13,5314},{37947,0,5318},
+{37949,0,5320},{37951,0,5319},{37955,0,5321},{37957,0,5322},
+{37960,0,5323},{37962,0,5324},{37964,0,5325},{37973,0,5326},
+{37977,0,5327},{37980,0,5328},{37983,0,5329},{37985,0,5330},
+{37987,0,5331},{37992,0,5332},{37995,0,5333},{37997,9,5334},
+{38001,5,5337},{38019,6,271},{38264,5,5341},{38270,0,5343},
+{38276,0,5344},{38280,0,5345},{38284,9,5346},{38301,9,5349},
+{38305,0,5352},{38310,0,5353},{38313,0,5354},{38315,5,5355},
+{38324,0,5357},{38326,0,5358},{38330,0,5359},{38333,0,5360},
+{38335,0,5361},{38342,0,5362},{38344,5,5363},{38347,0,5365},
+{38352,13,5366},{38361,5,5370},{38365,13,5372},{38372,0,5376},
+{38374,0,5377},{38429,5,5378},{38434,0,5380},{38436,9,5381},
+{38444,0,5384},{38449,0,5385},{38451,0,5386},{38455,13,5387},
+{38460,5,5391},{38465,0,5393},{38482,0,5394},{38484,0,5395},
+{38486,9,5396},{38497,0,5399},{38510,0,5400},{38516,0,5401},
+{38523,5,5402},{38526,5,5404},{38529,13,5406},{38537,0,5410},
+{38545,0,5411},{38550,0,5412},{38554,0,5413},{38557,0,5414},
+{38559,0,5415},{38564,9,5416},{38569,0,5419},{38574,5,5420},
+{38579,0,5422},{38586,0,5423},{38602,0,5424},{38610,0,5425},
+{38616,0,5427},{38618,0,5428},{38621,9,5429},{38633,0,5432},
+{38639,0,5433},{38641,0,5434},{38650,0,5435},{38658,5,5436},
+{38661,0,5438},{38665,0,5439},{38682,5,5440},{38685,0,5442},
+{38689,9,5443},{38696,0,5446},{38705,0,5447},{38707,0,5448},
+{38721,0,5449},{38723,0,5450},{38730,0,5451},{38734,5,5452},
+{38741,0,5454},{38743,5,5455},{38746,5,5457},{38755,0,5459},
+{38759,0,5460},{38762,0,5461},{38766,0,5462},{38771,0,5463},
+{38774,9,5464},{38779,0,5467},{38781,0,5468},{38783,5,5469},
+{38793,0,5471},{38805,9,5472},{38809,5,5475},{38814,5,5477},
+{38818,0,5479},{38828,0,5480},{38830,0,5481},{38833,5,5482},
+{38837,5,5484},{38840,9,5486},{38844,0,5489},{38846,5,5490},
+{38849,0,5492},{38852,5,5493},{38855,0,5495},{38857,5,5496},
+{38860,9,5498},{38864,5,5501},{38868,0,5503},{38871,9,5504},
+{38875,0,5510},{38877,5,5507},{38880,6,273},{38884,0,5512},
+{38895,0,5513},{38897,0,5514},{38900,0,5515},{38903,5,5516},
+{38906,0,5518},{38919,0,5519},{38922,0,5520},{38925,5,5522},
+{38932,0,5524},{38934,0,5525},{38937,0,5521},{38940,0,5526},
+{38942,0,5527},{38944,0,5528},{38947,0,5529},{38949,6,275},
+{38955,0,5531},{38958,9,5532},{38962,5,5535},{38965,0,5537},
+{38974,0,5539},{38980,0,5540},{38983,0,5541},{38986,0,5542},
+{38993,9,5543},{38998,5,5546},{39001,5,5548},{39010,5,5550},
+{39013,5,5552},{39018,0,5554},{39020,0,5555},{39083,0,5556},
+{39085,5,5557},{39088,0,5559},{39092,0,5560},{39095,5,5561},
+{39098,5,5563},{39103,0,5565},{39106,0,5566},{39109,0,5567},
+{39112,0,5568},{39116,0,5569},{39137,0,5570},{39139,0,5571},
+{39141,9,5572},{39146,0,5575},{39155,0,5576},{39158,0,5577},
+{39170,0,5578},{39175,5,5579},{39185,0,5581},{39189,9,5582},
+{39194,9,5585},{39199,0,5588},{39202,0,5589},{39206,5,5590},
+{39211,0,5592},{39217,17,5593},{39225,13,5598},{39232,5,5602},
+{39238,9,5604},{39245,5,5607},{39252,0,5609},{39256,5,5610},
+{39259,5,5612},{39262,9,5614},{39323,0,5617},{39325,0,5618},
+{39327,0,5619},{39334,0,5620},{39344,9,5621},{39349,0,5624},
+{39353,5,5625},{39357,0,5627},{39359,0,5628},{39363,0,5629},
+{39369,0,5630},{39379,5,5631},{39385,5,5633},{39388,0,5635},
+{39390,0,5636},{39399,0,5637},{39402,9,5638},{39408,0,5641},
+{39412,5,5642},{39417,0,5644},{39421,5,5645},{39426,9,5647},
+{39435,5,5650},{39440,5,5652},{39446,0,5654},{39454,0,5655},
+{39456,0,5656},{39458,9,5657},{39463,0,5660},{39469,5,5661},
+{39475,0,5663},{39477,5,5664},{39480,0,5666},{39489,0,5668},
+{39492,0,5669},{39495,0,5667},{39498,9,5670},{39502,0,5673},
+{39505,0,5674},{39508,0,5675},{39510,0,5676},{39517,0,5677},
+{39594,0,5678},{39596,0,5679},{39598,5,5680},{39602,0,5682},
+{39604,9,5683},{39609,0,5686},{39611,0,5687},{39614,5,5688},
+{39617,0,5690},{39619,0,5691},{39622,0,5692},{39624,0,5693},
+{39630,0,5694},{39632,0,5695},{39634,0,5696},{39637,9,5697},
+{39643,5,5700},{39648,0,5702},{39652,5,5703},{39655,0,5705},
+{39657,0,5706},{39660,0,5707},{39666,5,5708},{39669,0,5710},
+{39673,5,5711},{39677,0,5713},{39679,25,5714},{39688,5,5721},
+{39691,13,5723},{39696,0,5727},{39698,0,5728},{39702,0,5729},
+{39705,0,5730},{39707,5,5731},{39712,0,5733},{39718,0,5734},
+{39723,0,5735},{39725,0,5736},{39731,9,5737},{39735,0,5740},
+{39737,5,5741},{39741,0,5743},{39752,0,5744},{39755,5,5745},
+{39765,9,5747},{39771,0,5750},{39774,0,5751},{39777,0,5752},
+{39779,0,5753},{39781,5,5754},{39784,0,5756},{39786,17,5757},
+{39795,0,5762},{39797,0,5763},{39799,9,5764},{39807,5,5767},
+{39812,13,5769},{39817,9,5773},{39821,0,5776},{39823,5,5777},
+{39828,0,5779},{39834,0,5780},{39837,5,5781},{39846,5,5783},
+{39849,0,5785},{39852,0,5786},{39856,9,5787},{39863,5,5790},
+{39867,5,5792},{39870,5,5794},{39873,0,5796},{39879,5,5797},
+{39886,0,5799},{39888,0,5800},{39895,5,5801},{39901,0,5803},
+{39903,0,5804},{39909,0,5805},{39911,0,5806},{39914,5,5807},
+{39919,0,5809},{39923,0,5810},{39927,13,5811},{39933,0,5815},
+{39935,5,5816},{39938,0,5818},{39947,0,5819},{39951,0,5820},
+{39953,0,5821},{39958,0,5822},{39960,9,5823},{39964,0,5826},
+{39966,0,5827},{39970,5,5828},{39974,17,5830},{39985,0,5835},
+{39989,9,5836},{39997,0,5839},{40001,0,5840},{40003,9,5841},
+{40009,5,5844},{40014,9,5846},{40019,5,5849},{40022,0,5851},
+{40024,0,5852},{40027,6,277},{40029,9,5854},{40035,0,5857},
+{40040,0,5862},{40041,5,5858},{40043,0,5861},{40046,0,5863},
+{40048,0,5864},{40050,0,5865},{40053,0,5866},{40055,0,5867},
+{40059,0,5868},{40166,0,5869},{40178,0,5870},{40183,0,5871},
+{40185,0,5872},{40194,0,5874},{40203,0,5873},{40209,0,5875},
+{40215,5,5876},{40220,9,5878},{40239,5,5881},{40242,9,5883},
+{40250,0,5886},{40252,6,279},{40258,5,5890},{40261,0,5888},
+{40263,0,5892},{40266,0,5893},{40275,5,5894},{40287,0,5896},
+{40290,6,281},{40293,0,5899},{40297,9,5900},{40304,0,5903},
+{40310,5,5904},{40315,5,5906},{40318,0,5908},{40323,5,5909},
+{40326,0,5911},{40330,0,5912},{40333,5,5913},{40338,5,5915},
+{40341,13,5917},{40353,0,5921},{40362,0,5922},{40364,0,5923},
+{40366,0,5924},{40369,0,5925},{40373,0,5926},{40377,0,5927},
+{40380,0,5928},{40383,0,5929},{40387,0,5930},{40391,0,5931},
+{40393,5,5932},{40404,13,5934},{40410,0,5938},{40414,9,5939},
+{40421,0,5942},{40423,0,5943},{40425,0,5944},{40427,0,5945},
+{40430,0,5946},{40432,0,5947},{40435,5,5948},{40446,0,5950},
+{40450,0,5952},{40455,0,5953},{40458,0,5951},{40462,0,5954},
+{40464,9,5955},{40469,5,5958},{40473,0,5960},{40476,5,5961},
+{40570,9,5963},{40576,0,5966},{40578,13,5967},{40583,0,5971},
+{40590,5,5972},{40598,0,5974},{40600,0,5975},{40603,0,5976},
+{40606,0,5977},{40612,0,5978},{40616,0,5979},{40620,0,5980},
+{40622,9,5981},{40627,9,5984},{40646,0,5987},{40648,0,5988},
+{40651,0,5989},{40661,0,5990},{40671,0,5991},{40676,0,5992},
+{40679,0,5993},{40684,9,5994},{40688,9,5997},{40693,0,6000},
+{40696,0,6001},{40703,0,6002},{40706,5,6003},{40713,0,6005},
+{40719,13,6006},{40724,0,6010},{40726,5,6011},{40729,9,6013},
+{40735,0,6016},{40738,0,6017},{40742,0,6018},{40746,5,6019},
+{40751,0,6021},{40753,5,6022},{40756,0,6024},{40759,0,6025},
+{40761,5,6026},{40764,5,6028},{40767,0,6030},{40769,0,6031},
+{40771,17,6032},{40787,0,6037},{40789,13,6038},{40794,0,6042},
+{40797,5,6043},{40808,5,6045},{40813,17,6047},{40819,0,6052},
+{40821,0,6053},{40826,0,6054},{40829,0,6055},{40847,13,6056},
+{40852,0,6060},{40854,5,6061},{40862,0,6063},{40865,9,6064},
+{40869,0,6067},
+};
+
+static const unsigned short cmap_UniHojo_UCS2_H_table[283] = {
+17,16,18,6,14,97,96,99,105,98,104,69,
+109,113,112,115,114,126,125,128,127,142,144,143,
+146,150,145,76,161,160,163,162,176,79,93,183,
+182,185,191,184,190,80,195,199,198,201,200,212,
+211,214,213,82,227,229,228,231,235,230,91,246,
+245,248,247,261,95,262,102,188,100,186,103,189,
+106,192,107,193,110,196,108,194,111,197,70,81,
+118,204,117,203,119,205,116,202,120,207,121,208,
+123,209,122,124,210,71,83,133,218,131,216,132,
+217,130,84,72,85,134,219,135,220,86,136,221,
+138,223,137,222,74,88,73,87,139,224,141,226,
+140,225,89,75,90,149,234,148,233,77,92,151,
+236,153,238,152,237,154,239,155,240,157,242,156,
+241,159,244,158,243,78,94,170,255,167,252,164,
+249,169,254,166,251,168,253,175,260,178,263,177,
+179,264,181,266,180,265,101,187,129,215,147,232,
+165,250,174,259,171,256,173,258,172,257,1,4,
+8,7,28,30,36,26,29,35,40,37,39,42,
+346,329,491,503,666,665,979,988,1413,1415,1444,1443,
+1505,1507,2000,2002,1993,1996,2001,2035,1989,2099,2098,2285,
+2284,3095,3089,3096,3301,3296,3726,3725,3894,3891,4056,3999,
+4045,4070,4236,1088,4237,4391,4387,4621,4616,4702,4701,4745,
+4763,4846,4840,4963,4965,5269,5275,5340,5339,5509,5511,5538,
+5530,5853,5860,5887,5889,5898,5897,
+};
+
+static pdf_cmap cmap_UniHojo_UCS2_H = {
+	-1, "UniHojo-UCS2-H", "", 0, 0, 2,
+	{ {2,0,55295},{2,57344,65535}, },
+	3985, 3985, (pdf_range*) cmap_UniHojo_UCS2_H_ranges,
+	283, 283, (unsigned short*) cmap_UniHojo_UCS2_H_table,
+};
+
+/* UniHojo-UCS2-V */
+
+static const pdf_range cmap_UniHojo_UCS2_V_ranges[] = { {0,1,0}
+};
+
+static const unsigned short cmap_UniHojo_UCS2_V_table[] = { 0 };
+
+static pdf_cmap cmap_UniHojo_UCS2_V = {
+	-1, "UniHojo-UCS2-V", "UniHojo-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	0, 0, (pdf_range*) cmap_UniHojo_UCS2_V_ranges,
+	0, 0, (unsigned short*) cmap_UniHojo_UCS2_V_table,
+};
+
+/* UniHojo-UTF16-H */
+
+static const pdf_range cmap_UniHojo_UTF16_H_ranges[] = {
+{126,0,9},{161,0,12},{164,0,20},{166,0,13},
+{169,6,0},{174,6,2},{184,0,3},{186,0,15},
+{191,66,4},{209,22,21},{216,122,27},{248,110,58},
+{278,50,86},{292,30,99},{302,126,107},{336,186,139},
+{461,62,186},{501,0,206},{711,0,2},{728,14,202},
+{733,0,5},{900,5,10},{902,0,22},{904,9,23},
+{908,0,27},{910,10,206},{938,6,209},{940,13,31},
+{944,0,41},{962,0,38},{970,18,211},{1026,41,43},
+{1038,5,54},{1106,41,56},{1118,5,67},{8470,0,21},
+{8482,0,19},{11907,0,286},{11913,0,565},{11919,0,1283},
+{11925,6,216},{11928,0,1699},{11937,10,218},{11941,0,2750},
+{11944,0,2787},{11949,0,3317},{11953,6,221},{11970,0,4421},
+{11981,0,4892},{11986,0,5341},{11990,0,5378},{12033,0,275},
+{12089,0,1481},{12135,0,3030},{12145,0,3356},{12193,0,4891},
+{19970,0,267},{19972,5,268},{19980,0,270},{19986,0,271},
+{19999,0,272},{20003,5,273},{20008,0,275},{20011,0,276},
+{20014,9,277},{20021,0,280},{20032,5,281},{20036,0,283},
+{20039,0,284},{20049,0,285},{20058,0,286},{20060,0,287},
+{20067,0,288},{20072,5,289},{20084,5,291},{20089,0,293},
+{20095,0,294},{20109,0,295},{20118,5,296},{20125,0,298},
+{20143,0,299},{20153,0,300},{20163,0,301},{20176,0,302},
+{20186,5,303},{20192,9,305},{20200,0,308},{20207,0,309},
+{20209,0,310},{20211,0,311},{20213,0,312},{20221,13,313},
+{20226,5,317},{20232,0,319},{20235,5,320},{20242,0,322},
+{20245,9,323},{20249,0,326},{20270,0,327},{20273,0,328},
+{20275,0,330},{20277,0,331},{20279,0,332},{20281,0,333},
+{20283,0,334},{20286,0,335},{20288,0,336},{20290,0,337},
+{20296,5,338},{20299,5,340},{20306,0,342},{20308,0,343},
+{20310,0,344},{20312,0,345},{20319,6,223},{20323,0,347},
+{20330,0,348},{20332,0,349},{20334,0,350},{20337,0,351},
+{20343,13,352},{20349,5,356},{20353,5,358},{20356,5,360},
+{20361,5,362},{20364,0,364},{20366,0,365},{20368,0,366},
+{20370,9,367},{20375,0,370},{20377,5,371},{20382,5,373},
+{20402,0,375},{20407,0,376},{20409,0,377},{20411,13,378},
+{20416,5,382},{20421,5,384},{20424,5,386},{20427,9,388},
+{20431,0,391},{20434,0,392},{20444,0,393},{20448,0,394},
+{20450,0,395},{20464,0,396},{20466,0,397},{20476,5,398},
+{20479,9,400},{20484,0,403},{20487,0,404},{20490,0,405},
+{20492,0,406},{20494,0,407},{20496,0,408},{20499,0,409},
+{20503,5,410},{20507,13,412},{20514,0,416},{20519,0,417},
+{20526,0,418},{20528,0,419},{20530,5,420},{20533,0,422},
+{20539,0,446},{20544,9,423},{20549,5,426},{20554,0,428},
+{20556,0,429},{20558,0,430},{20561,9,431},{20567,0,434},
+{20569,0,435},{20575,5,436},{20578,5,438},{20582,5,440},
+{20586,0,442},{20589,0,443},{20592,5,444},{20609,0,447},
+{20611,5,448},{20614,0,450},{20618,0,451},{20622,9,452},
+{20626,9,455},{20630,0,458},{20635,5,459},{20638,17,461},
+{20650,0,466},{20655,5,467},{20665,5,469},{20669,0,471},
+{20672,0,472},{20675,5,473},{20679,0,475},{20684,0,476},
+{20686,0,477},{20688,0,478},{20691,5,479},{20696,0,481},
+{20700,5,482},{20703,0,484},{20706,0,485},{20708,0,486},
+{20710,0,487},{20712,5,488},{20719,0,490},{20721,6,225},
+{20726,0,492},{20730,0,493},{20734,0,494},{20739,0,495},
+{20742,9,496},{20747,13,499},{20752,0,504},{20759,0,505},
+{20761,0,506},{20763,13,507},{20771,0,511},{20775,5,512},
+{20780,5,514},{20783,0,516},{20785,0,517},{20787,9,518},
+{20792,5,521},{20802,0,523},{20810,0,524},{20815,0,525},
+{20819,0,526},{20821,0,527},{20823,5,528},{20831,0,530},
+{20836,0,531},{20838,0,532},{20862,0,533},{20867,5,534},
+{20875,0,536},{20878,0,537},{20888,0,538},{20893,0,539},
+{20897,0,540},{20899,0,541},{20909,0,542},{20920,0,543},
+{20922,0,544},{20924,0,545},{20926,5,546},{20930,0,548},
+{20936,0,549},{20943,0,550},{20945,9,551},{20949,0,554},
+{20952,0,555},{20958,0,556},{20962,0,557},{20965,0,558},
+{20974,0,559},{20978,9,560},{20983,0,563},{20993,5,564},
+{20997,0,566},{21010,5,567},{21013,5,569},{21016,0,571},
+{21026,0,572},{21032,0,573},{21041,5,574},{21045,0,576},
+{21052,0,577},{21061,0,578},{21065,0,579},{21077,0,580},
+{21079,5,581},{21082,0,583},{21084,0,584},{21087,9,585},
+{21094,0,588},{21102,0,589},{21111,9,590},{21120,0,593},
+{21122,0,594},{21125,0,595},{21130,0,596},{21132,0,597},
+{21139,0,598},{21141,13,599},{21146,0,603},{21148,0,604},
+{21156,13,605},{21167,5,609},{21174,9,611},{21178,5,614},
+{21181,0,616},{21184,0,617},{21188,0,618},{21190,0,619},
+{21192,0,620},{21196,0,621},{21199,0,622},{21201,0,623},
+{21204,0,624},{21206,0,625},{21211,5,626},{21217,0,628},
+{21221,0,629},{21224,9,630},{21228,0,633},{21232,5,634},
+{21236,0,636},{21238,5,637},{21248,0,639},{21251,0,640},
+{21258,9,641},{21265,0,644},{21267,0,645},{21272,0,646},
+{21275,5,647},{21278,5,649},{21285,0,651},{21287,9,652},
+{21291,9,655},{21296,0,658},{21298,0,659},{21301,0,660},
+{21308,9,661},{21314,0,664},{21323,6,227},{21337,0,667},
+{21339,0,668},{21345,0,669},{21347,0,670},{21349,0,671},
+{21356,5,672},{21362,0,674},{21369,0,675},{21374,0,676},
+{21379,0,677},{21383,5,678},{21390,0,680},{21395,5,681},
+{21401,0,683},{21405,0,684},{21409,0,685},{21412,0,686},
+{21418,5,687},{21423,0,689},{21426,0,690},{21428,5,691},
+{21431,5,693},{21434,0,695},{21437,0,696},{21440,0,697},
+{21445,0,698},{21455,0,699},{21458,5,700},{21461,0,702},
+{21466,0,703},{21469,5,704},{21472,0,706},{21478,5,707},
+{21493,0,709},{21506,0,710},{21523,0,711},{21530,0,712},
+{21537,0,713},{21543,5,714},{21546,0,716},{21551,0,717},
+{21553,0,718},{21556,5,719},{21571,5,721},{21575,0,723},
+{21581,0,724},{21583,0,725},{21598,0,726},{21602,0,727},
+{21604,0,728},{21606,5,729},{21609,0,731},{21611,0,732},
+{21613,5,733},{21620,0,735},{21631,0,736},{21633,0,737},
+{21635,0,738},{21637,0,739},{21640,5,740},{21645,0,742},
+{21649,0,743},{21653,5,744},{21660,0,746},{21663,0,747},
+{21665,0,748},{21670,5,749},{21673,5,751},{21677,5,753},
+{21681,0,755},{21687,0,756},{21689,9,757},{21695,0,760},
+{21702,0,761},{21706,0,762},{21709,5,763},{21728,0,765},
+{21738,0,766},{21740,0,767},{21743,0,768},{21750,0,769},
+{21756,0,770},{21758,13,771},{21765,0,775},{21768,5,776},
+{21772,9,778},{21781,0,781},{21802,5,782},{21810,0,784},
+{21813,5,785},{21819,9,787},{21825,0,790},{21831,0,791},
+{21833,5,792},{21837,0,794},{21840,5,795},{21848,0,797},
+{21850,5,798},{21854,0,800},{21856,5,801},{21860,0,803},
+{21862,0,804},{21887,0,805},{21889,5,806},{21894,0,808},
+{21896,0,809},{21902,5,810},{21905,13,812},{21911,0,816},
+{21923,5,817},{21933,0,819},{21938,0,820},{21951,0,821},
+{21953,0,822},{21955,0,823},{21958,0,824},{21961,0,825},
+{21963,5,826},{21966,0,828},{21969,9,829},{21975,5,832},
+{21979,0,834},{21982,0,835},{21986,0,836},{21993,0,837},
+{22006,0,838},{22015,0,839},{22021,0,840},{22024,0,841},
+{22026,0,842},{22029,21,843},{22041,0,849},{22060,0,850},
+{22064,0,851},{22067,0,852},{22069,0,853},{22071,0,854},
+{22073,0,855},{22075,9,856},{22079,9,859},{22083,5,862},
+{22086,0,864},{22089,0,865},{22091,0,866},{22093,0,867},
+{22095,0,868},{22100,0,869},{22110,0,870},{22112,13,871},
+{22118,0,875},{22121,0,876},{22125,0,877},{22127,0,878},
+{22129,5,879},{22133,0,881},{22148,5,882},{22152,0,884},
+{22155,5,885},{22165,0,887},{22169,5,888},{22173,9,890},
+{22182,13,893},{22187,9,897},{22193,0,900},{22195,0,901},
+{22199,0,902},{22206,0,903},{22213,0,904},{22217,9,905},
+{22220,5,910},{22223,5,908},{22233,0,912},{22236,5,913},
+{22239,0,915},{22241,0,916},{22244,17,917},{22251,0,923},
+{22253,0,924},{22257,0,922},{22262,5,925},{22273,5,927},
+{22279,0,929},{22282,0,930},{22284,0,931},{22289,0,932},
+{22293,0,933},{22298,5,934},{22301,0,936},{22304,0,937},
+{22306,13,938},{22313,5,942},{22316,0,944},{22318,5,945},
+{22323,5,947},{22333,9,949},{22341,5,952},{22348,5,954},
+{22354,0,956},{22370,0,957},{22373,0,958},{22375,5,959},
+{22379,0,961},{22381,17,962},{22387,9,967},{22391,0,970},
+{22393,13,971},{22398,0,975},{22401,0,976},{22403,0,977},
+{22412,0,978},{22420,6,229},{22423,0,980},{22425,5,981},
+{22428,13,983},{22433,0,987},{22439,9,989},{22444,0,992},
+{22456,0,993},{22461,0,994},{22471,5,995},{22476,0,997},
+{22479,0,998},{22485,0,999},{22493,5,1000},{22497,0,1018},
+{22500,0,1002},{22502,5,1003},{22505,0,1005},{22509,0,1006},
+{22512,0,1007},{22517,5,1008},{22520,0,1010},{22525,9,1011},
+{22531,5,1014},{22536,5,1016},{22540,5,1019},{22555,0,1021},
+{22558,9,1022},{22566,5,1025},{22573,0,1027},{22578,0,1028},
+{22585,0,1029},{22591,0,1030},{22601,0,1031},{22604,5,1032},
+{22607,5,1034},{22613,0,1036},{22623,0,1037},{22625,0,1038},
+{22628,0,1039},{22631,5,1040},{22648,0,1042},{22652,0,1043},
+{22655,9,1044},{22663,13,1047},{22668,5,1051},{22671,5,1053},
+{22676,0,1055},{22678,0,1056},{22685,0,1057},{22688,9,1058},
+{22694,0,1061},{22697,0,1062},{22705,5,1063},{22716,0,1066},
+{22722,0,1067},{22724,0,1065},{22728,0,1068},{22733,5,1069},
+{22736,0,1071},{22738,0,1072},{22740,0,1073},{22742,0,1074},
+{22746,0,1075},{22749,0,1076},{22753,5,1077},{22761,0,1079},
+{22771,0,1080},{22789,5,1081},{22795,5,1083},{22802,9,1085},
+{22813,0,1089},{22817,0,1090},{22819,5,1091},{22824,0,1093},
+{22831,5,1094},{22835,0,1096},{22837,5,1097},{22847,0,1099},
+{22851,0,1100},{22854,0,1101},{22866,5,1102},{22873,0,1104},
+{22875,0,1105},{22877,9,1106},{22881,0,1109},{22883,0,1110},
+{22891,0,1111},{22893,0,1112},{22895,0,1113},{22898,0,1114},
+{22901,5,1115},{22905,0,1117},{22907,5,1118},{22923,5,1120},
+{22926,0,1122},{22930,0,1123},{22933,0,1124},{22935,0,1125},
+{22943,0,1126},{22948,0,1127},{22951,0,1128},{22957,13,1129},
+{22963,0,1133},{22967,0,1134},{22970,0,1135},{22972,0,1136},
+{22977,0,1137},{22979,5,1138},{22984,0,1140},{22986,0,1141},
+{22989,0,1142},{22994,0,1143},{23005,9,1144},{23011,5,1147},
+{23015,0,1149},{23022,5,1150},{23025,5,1152},{23028,0,1154},
+{23031,0,1155},{23040,0,1156},{23044,0,1157},{23052,9,1158},
+{23058,5,1161},{23070,0,1163},{23075,5,1164},{23079,5,1166},
+{23082,0,1168},{23085,0,1169},{23088,0,1170},{23108,5,1171},
+{23111,5,1173},{23116,0,1175},{23120,0,1176},{23125,0,1177},
+{23134,0,1178},{23139,0,1179},{23141,0,1180},{23143,0,1181},
+{23149,0,1182},{23159,0,1183},{23162,5,1184},{23166,0,1186},
+{23179,0,1187},{23184,0,1188},{23187,0,1189},{23190,0,1190},
+{23193,0,1191},{23196,0,1192},{23198,9,1193},{23202,0,1196},
+{23207,0,1197},{23212,0,1198},{23217,9,1199},{23221,0,1202},
+{23224,0,1203},{23226,5,1204},{23231,0,1206},{23236,0,1207},
+{23238,0,1208},{23240,0,1209},{23247,0,1210},{23258,0,1211},
+{23260,0,1212},{23264,0,1213},{23269,0,1214},{23274,0,1215},
+{23278,0,1216},{23285,5,1217},{23293,0,1219},{23296,5,1220},
+{23304,0,1222},{23319,0,1223},{23321,0,1225},{23323,0,1226},
+{23325,0,1227},{23329,0,1228},{23333,0,1229},{23341,0,1230},
+{23348,0,1224},{23352,0,1231},{23361,0,1232},{23371,5,1233},
+{23378,0,1235},{23382,0,1236},{23390,0,1237},{23400,0,1238},
+{23406,5,1239},{23420,13,1241},{23425,0,1245},{23428,0,1246},
+{23430,0,1247},{23434,0,1248},{23438,0,1249},{23440,5,1250},
+{23443,5,1252},{23446,0,1254},{23464,5,1255},{23468,5,1257},
+{23471,0,1259},{23473,5,1260},{23479,0,1262},{23482,0,1263},
+{23484,0,1264},{23488,5,1265},{23501,0,1267},{23503,0,1268},
+{23510,17,1269},{23520,0,1274},{23535,0,1275},{23537,0,1276},
+{23540,0,1277},{23549,0,1278},{23564,0,1279},{23575,0,1280},
+{23582,5,1281},{23587,0,1283},{23590,0,1284},{23593,0,1285},
+{23595,5,1286},{23598,0,1288},{23600,0,1289},{23602,0,1290},
+{23605,5,1291},{23641,5,1293},{23644,0,1295},{23650,5,1296},
+{23655,9,1298},{23661,0,1301},{23664,0,1302},{23668,5,1303},
+{23674,13,1305},{23687,5,1309},{23690,0,1311},{23695,0,1312},
+{23698,0,1313},{23709,0,1314},{23711,5,1315},{23714,5,1317},
+{23718,0,1319},{23722,0,1320},{23730,0,1321},{23732,5,1322},
+{23738,0,1324},{23753,0,1325},{23755,0,1326},{23762,0,1327},
+{23767,0,1329},{23773,0,1328},{23790,0,1330},{23793,5,1331},
+{23796,0,1333},{23809,0,1334},{23814,0,1335},{23821,0,1336},
+{23826,0,1337},{23843,5,1339},{23846,5,1341},{23851,0,1338},
+{23857,0,1343},{23860,0,1344},{23865,0,1345},{23869,0,1346},
+{23871,0,1347},{23874,5,1348},{23878,0,1350},{23880,0,1351},
+{23882,0,1355},{23889,0,1353},{23893,0,1352},{23897,0,1354},
+{23903,13,1356},{23908,0,1360},{23914,0,1361},{23917,0,1362},
+{23920,0,1363},{23929,5,1364},{23934,5,1366},{23937,0,1368},
+{23939,0,1369},{23944,0,1370},{23946,0,1371},{23954,13,1372},
+{23961,0,1376},{23963,0,1377},{23967,5,1378},{23975,0,1380},
+{23979,0,1381},{23984,0,1382},{23986,0,5426},{23988,0,1383},
+{23992,5,1384},{24003,0,1386},{24007,0,1387},{24011,0,1388},
+{24014,0,1390},{24016,0,1389},{24024,5,1391},{24032,0,1393},
+{24036,0,1394},{24041,0,1395},{24056,5,1396},{24064,0,1398},
+{24071,0,1399},{24077,0,1400},{24082,0,1401},{24084,5,1402},
+{24088,0,1404},{24095,5,1405},{24104,0,1408},{24110,0,1407},
+{24114,0,1409},{24117,0,1410},{24126,0,1411},{24137,0,1414},
+{24139,0,1412},{24144,6,231},{24150,0,1416},{24152,0,1417},
+{24155,5,1418},{24158,0,1420},{24168,0,1421},{24170,17,1422},
+{24176,0,1427},{24192,0,1428},{24203,0,1429},{24206,0,1430},
+{24226,0,1431},{24228,5,1432},{24232,0,1434},{24234,0,1435},
+{24236,0,1436},{24241,0,1437},{24243,0,1438},{24253,9,1439},
+{24262,0,1442},{24267,6,233},{24270,0,1445},{24273,5,1446},
+{24276,5,1448},{24284,0,1450},{24286,0,1451},{24293,0,1452},
+{24299,0,1453},{24322,0,1454},{24326,9,1455},{24334,0,1458},
+{24345,0,1459},{24348,5,1460},{24353,13,1462},{24360,0,1466},
+{24363,5,1467},{24366,0,1469},{24368,0,1470},{24372,0,1471},
+{24374,0,1472},{24379,0,1473},{24381,0,1474},{24383,5,1475},
+{24388,5,1477},{24391,0,1479},{24397,0,1480},{24400,0,1481},
+{24404,0,1482},{24408,0,1483},{24411,0,1484},{24416,0,1485},
+{24419,5,1486},{24423,0,1488},{24431,0,1489},{24434,0,1490},
+{24436,5,1491},{24440,0,1493},{24442,0,1494},{24445,5,1495},
+{24457,0,1497},{24461,0,1498},{24463,0,1499},{24470,0,1500},
+{24476,5,1501},{24482,0,1503},{24484,0,1506},{24487,0,1504},
+{24491,6,235},{24495,9,1508},{24504,0,1511},{24516,0,1512},
+{24519,9,1513},{24523,0,1516},{24528,17,1517},{24542,0,1522},
+{24545,5,1523},{24552,9,1525},{24556,13,1528},{24562,5,1532},
+{24566,0,1534},{24570,0,1535},{24572,0,1536},{24583,0,1537},
+{24586,0,1538},{24589,0,1539},{24595,5,1540},{24599,5,1542},
+{24602,0,1544},{24607,0,1545},{24612,0,1546},{24621,0,1547},
+{24627,0,1548},{24629,0,1549},{24640,0,1550},{24647,9,1551},
+{24652,0,1554},{24657,0,1555},{24660,0,1556},{24662,5,1557},
+{24669,0,1559},{24673,0,1560},{24679,0,1561},{24689,0,1562},
+{24702,5,1563},{24706,0,1565},{24710,0,1566},{24712,0,1567},
+{24714,0,1568},{24718,0,1569},{24721,0,1570},{24723,0,1571},
+{24725,0,1572},{24728,0,1573},{24733,5,1574},{24738,0,1576},
+{24740,5,1577},{24744,0,1579},{24752,5,1580},{24759,0,1582},
+{24763,0,1583},{24766,0,1584},{24770,0,1585},{24772,0,1586},
+{24776,13,1587},{24782,5,1591},{24788,5,1593},{24793,0,1595},
+{24795,0,1596},{24797,5,1597},{24802,0,1599},{24805,0,1600},
+{24818,0,1601},{24821,0,1602},{24824,0,1603},{24828,5,1604},
+{24834,0,1606},{24839,0,1607},{24842,0,1608},{24844,0,1609},
+{24848,17,1610},{24854,5,1615},{24857,0,1617},{24860,0,1618},
+{24862,0,1619},{24866,0,1620},{24874,5,1621},{24880,5,1623},
+{24885,9,1625},{24889,0,1628},{24897,0,1629},{24901,5,1630},
+{24905,0,1632},{24926,0,1633},{24928,0,1634},{24940,0,1635},
+{24946,0,1636},{24952,0,1637},{24955,5,1638},{24959,9,1640},
+{24963,5,1643},{24971,0,1645},{24973,0,1646},{24978,5,1647},
+{24983,5,1649},{24988,5,1651},{24991,5,1653},{24997,0,1655},
+{25000,0,1656},{25002,0,1657},{25005,0,1658},{25016,5,1659},
+{25020,0,1661},{25024,9,1662},{25038,5,1665},{25045,0,1667},
+{25052,13,1668},{25057,5,1672},{25061,0,1676},{25063,0,1674},
+{25065,0,1675},{25068,5,1677},{25071,0,1679},{25089,0,1680},
+{25091,5,1681},{25095,0,1683},{25107,0,1684},{25109,0,1685},
+{25116,0,1686},{25120,0,1687},{25122,5,1688},{25127,0,1690},
+{25129,0,1691},{25131,0,1692},{25145,0,1693},{25149,0,1694},
+{25154,9,1695},{25158,0,1698},{25164,0,1699},{25168,9,1700},
+{25172,0,1703},{25174,0,1704},{25178,0,1705},{25180,0,1706},
+{25188,0,1707},{25197,0,1708},{25199,0,1709},{25203,0,1710},
+{25210,0,1711},{25213,0,1712},{25229,13,1713},{25254,0,1717},
+{25256,0,1718},{25267,0,1719},{25270,5,1720},{25274,0,1722},
+{25278,5,1723},{25284,0,1725},{25294,0,1726},{25301,5,1727},
+{25306,0,1729},{25322,0,1730},{25330,0,1731},{25332,0,1732},
+{25340,5,1733},{25347,5,1735},{25354,5,1737},{25357,0,1739},
+{25360,0,1740},{25363,0,1741},{25366,0,1742},{25368,0,1743},
+{25385,5,1744},{25389,0,1746},{25397,5,1747},{25401,0,1749},
+{25404,0,1750},{25409,13,1751},{25414,0,1755},{25418,5,1756},
+{25422,0,1758},{25426,9,1759},{25432,0,1762},{25435,0,1763},
+{25445,5,1764},{25452,5,1766},{25457,0,1768},{25460,5,1769},
+{25464,0,1771},{25468,5,1772},{25471,0,1774},{25474,0,1775},
+{25476,0,1776},{25479,0,1777},{25482,0,1778},{25488,0,1779},
+{25492,5,1780},{25497,5,1782},{25502,0,1784},{25508,0,1785},
+{25510,0,1786},{25517,9,1787},{25533,0,1790},{25537,0,1791},
+{25541,0,1792},{25544,0,1793},{25550,0,1794},{25553,0,1795},
+{25555,9,1796},{25564,0,1799},{25568,0,1800},{25573,0,1801},
+{25578,0,1802},{25580,0,1803},{25586,5,1804},{25589,0,1806},
+{25592,5,1807},{25609,5,1809},{25616,0,1811},{25618,0,1812},
+{25620,0,1813},{25624,0,1814},{25630,0,1815},{25632,0,1816},
+{25634,0,1817},{25636,5,1818},{25641,5,1820},{25647,5,1822},
+{25653,0,1824},{25661,0,1825},{25663,0,1826},{25675,0,1827},
+{25679,0,1828},{25681,13,1829},{25690,13,1833},{25695,9,1837},
+{25699,0,1840},{25709,0,1841},{25715,5,1842},{25723,0,1844},
+{25725,0,1845},{25733,0,1846},{25735,0,1847},{25743,9,1848},
+{25752,5,1851},{25755,0,1853},{25757,0,1854},{25759,0,1855},
+{25761,0,1856},{25763,0,1857},{25766,0,1858},{25768,0,1859},
+{25772,0,1860},{25779,0,1861},{25789,9,1862},{25796,0,1865},
+{25801,13,1866},{25806,0,1870},{25808,5,1871},{25813,0,1873},
+{25815,0,1874},{25828,5,1875},{25833,5,1877},{25837,0,1879},
+{25840,0,1880},{25845,0,1881},{25847,0,1882},{25851,0,1883},
+{25855,0,1884},{25857,0,1885},{25860,0,1886},{25864,9,1887},
+{25871,0,1890},{25875,5,1891},{25878,0,1893},{25881,0,1894},
+{25883,0,1895},{25886,5,1896},{25890,0,1898},{25894,0,1899},
+{25897,0,1900},{25902,0,1901},{25905,0,1902},{25914,0,1903},
+{25916,5,1904},{25923,0,1906},{25927,0,1907},{25929,0,1908},
+{25936,0,1909},{25938,0,1910},{25940,0,1911},{25951,5,1912},
+{25959,0,1914},{25963,0,1915},{25978,0,1916},{25981,0,1917},
+{25985,0,1918},{25989,0,1919},{25994,0,1920},{26002,0,1921},
+{26005,0,1922},{26008,0,1923},{26013,0,1924},{26016,0,1925},
+{26019,0,1926},{26022,0,1927},{26030,0,1928},{26034,9,1929},
+{26047,0,1932},{26050,0,1933},{26056,5,1934},{26062,0,1936},
+{26064,0,1937},{26068,0,1938},{26070,0,1939},{26072,0,1940},
+{26079,0,1941},{26096,0,1942},{26098,0,1943},{26100,5,1944},
+{26105,0,1946},{26110,9,1947},{26116,0,1950},{26120,5,1951},
+{26125,0,1953},{26129,5,1954},{26133,5,1956},{26141,5,1958},
+{26145,13,1960},{26150,0,1964},{26153,13,1965},{26158,0,1969},
+{26160,5,1970},{26163,0,1972},{26167,0,1974},{26169,0,1973},
+{26176,0,1975},{26181,5,1976},{26186,0,1978},{26188,0,1979},
+{26190,0,1981},{26193,0,1980},{26199,9,1982},{26203,5,1985},
+{26208,5,1987},{26218,9,1990},{26227,0,1994},{26229,0,1995},
+{26231,9,1997},{26235,6,237},{26238,10,239},{26251,9,2003},
+{26256,0,2006},{26258,0,2007},{26265,13,2008},{26271,5,2012},
+{26276,0,2014},{26285,0,2015},{26289,5,2016},{26293,0,2018},
+{26299,0,2019},{26303,5,2020},{26306,5,2022},{26312,0,2024},
+{26316,0,2025},{26318,5,2026},{26324,0,2028},{26331,0,2029},
+{26335,0,2030},{26344,0,2031},{26347,5,2032},{26350,0,2034},
+{26362,6,242},{26373,0,2036},{26375,0,2037},{26382,0,2038},
+{26387,0,2039},{26393,0,2040},{26396,0,2041},{26400,0,2042},
+{26402,0,2043},{26419,0,2044},{26430,0,2045},{26437,0,2046},
+{26439,5,2047},{26444,0,2049},{26452,5,2050},{26461,0,2052},
+{26470,0,2053},{26476,0,2054},{26478,0,2055},{26484,0,2056},
+{26486,0,2057},{26491,0,2058},{26497,0,2059},{26500,0,2060},
+{26510,5,2061},{26513,0,2063},{26515,0,2064},{26518,0,2065},
+{26520,5,2066},{26523,0,2068},{26544,9,2069},{26549,0,2072},
+{26555,9,2073},{26560,0,2077},{26562,5,2078},{26565,0,2080},
+{26568,5,2081},{26578,0,2083},{26583,0,2084},{26585,0,2085},
+{26588,0,2086},{26593,0,2087},{26598,0,2088},{26608,0,2089},
+{26610,0,2090},{26614,5,2091},{26617,0,2076},{26644,0,2094},
+{26649,0,2095},{26653,0,2096},{26655,0,2097},{26663,6,244},
+{26668,5,2100},{26671,9,2102},{26675,0,2105},{26683,0,2106},
+{26687,0,2107},{26692,5,2108},{26698,0,2110},{26700,0,2111},
+{26706,0,2093},{26709,0,2112},{26711,5,2113},{26715,0,2115},
+{26731,0,2116},{26734,17,2117},{26741,0,2122},{26745,13,2123},
+{26754,0,2127},{26756,0,2128},{26758,0,2129},{26760,0,2130},
+{26774,0,2131},{26776,0,2132},{26778,0,2133},{26780,0,2134},
+{26785,0,2135},{26787,0,2136},{26789,0,2137},{26793,5,2138},
+{26798,0,2140},{26802,0,2141},{26811,0,2142},{26821,0,2143},
+{26824,0,2144},{26828,0,2145},{26831,9,2146},{26835,0,2149},
+{26838,0,2150},{26841,0,2151},{26844,5,2152},{26853,0,2154},
+{26856,0,2155},{26858,13,2156},{26864,5,2160},{26869,5,2162},
+{26875,9,2164},{26886,0,2167},{26889,5,2168},{26896,5,2170},
+{26899,0,2172},{26902,5,2173},{26929,0,2175},{26931,0,2176},
+{26933,0,2177},{26936,0,2178},{26939,0,2179},{26946,0,2180},
+{26949,0,2181},{26953,0,2182},{26958,0,2183},{26967,0,2184},
+{26971,0,2185},{26979,13,2186},{26984,5,2190},{26988,0,2192},
+{26992,9,2193},{27002,5,2196},{27007,5,2198},{27021,0,2200},
+{27026,0,2201},{27030,0,2202},{27032,0,2203},{27041,0,2204},
+{27045,5,2205},{27048,0,2207},{27051,0,2208},{27053,0,2209},
+{27055,0,2210},{27063,5,2211},{27066,0,2213},{27068,0,2214},
+{27077,0,2215},{27080,0,2216},{27089,0,2217},{27094,5,2218},
+{27106,0,2220},{27109,0,2221},{27118,5,2222},{27121,0,2224},
+{27123,0,2225},{27125,0,2226},{27134,0,2227},{27136,5,2228},
+{27139,0,2230},{27151,0,2231},{27153,0,2232},{27157,0,2233},
+{27162,0,2234},{27165,0,2235},{27168,0,2236},{27172,0,2237},
+{27176,0,2238},{27184,0,2239},{27186,0,2240},{27188,0,2241},
+{27191,0,2242},{27195,0,2243},{27198,5,2244},{27205,5,2246},
+{27209,5,2248},{27214,0,2250},{27216,9,2251},{27221,5,2254},
+{27227,0,2256},{27236,0,2257},{27239,0,2258},{27242,0,2259},
+{27249,0,2260},{27251,0,2261},{27262,0,2262},{27265,0,2263},
+{27267,0,2264},{27270,5,2265},{27273,0,2267},{27275,0,2268},
+{27281,0,2269},{27291,0,2270},{27293,9,2271},{27301,0,2274},
+{27307,0,2275},{27311,9,2276},{27316,0,2279},{27325,9,2280},
+{27334,0,2283},{27336,6,246},{27340,0,2286},{27344,0,2287},
+{27348,9,2288},{27356,5,2291},{27364,0,2293},{27367,0,2294},
+{27372,0,2295},{27376,9,2296},{27388,5,2299},{27394,5,2301},
+{27398,5,2303},{27401,0,2305},{27407,9,2306},{27415,0,2309},
+{27419,0,2310},{27422,0,2311},{27428,0,2312},{27432,0,2313},
+{27435,5,2314},{27439,0,2316},{27445,5,2317},{27451,0,2319},
+{27455,0,2320},{27462,0,2321},{27466,0,2322},{27469,0,2323},
+{27474,0,2324},{27478,0,2325},{27480,0,2326},{27485,0,2327},
+{27488,0,2328},{27495,0,2329},{27499,0,2330},{27502,0,2331},
+{27504,0,2332},{27509,0,2333},{27517,5,2334},{27522,0,2336},
+{27525,0,2337},{27543,0,2338},{27547,0,2339},{27551,5,2340},
+{27554,5,2342},{27560,5,2344},{27564,9,2346},{27568,0,2349},
+{27576,5,2350},{27581,5,2352},{27587,5,2354},{27593,0,2356},
+{27596,0,2357},{27606,0,2358},{27610,0,2359},{27617,0,2360},
+{27619,0,2361},{27622,5,2362},{27630,0,2364},{27633,0,2365},
+{27639,0,2366},{27641,0,2367},{27647,0,2368},{27650,0,2369},
+{27652,5,2370},{27657,0,2372},{27661,5,2373},{27664,0,2375},
+{27666,0,2376},{27673,0,2377},{27679,0,2378},{27686,9,2379},
+{27692,0,2382},{27694,0,2383},{27699,0,2384},{27701,5,2385},
+{27706,5,2387},{27711,0,2389},{27722,5,2390},{27725,0,2392},
+{27727,0,2393},{27730,0,2394},{27732,0,2395},{27737,0,2396},
+{27739,5,2397},{27751,0,2450},{27755,0,2399},{27757,0,2400},
+{27759,0,2401},{27764,0,2402},{27766,0,2403},{27768,5,2404},
+{27771,0,2406},{27781,9,2407},{27785,0,2410},{27796,5,2411},
+{27799,5,2413},{27804,0,2415},{27807,0,2416},{27824,0,2417},
+{27826,0,2418},{27828,0,2419},{27842,0,2420},{27846,0,2421},
+{27853,0,2422},{27855,13,2423},{27860,0,2427},{27862,0,2428},
+{27866,0,2429},{27868,0,2430},{27872,0,2431},{27879,0,2432},
+{27881,0,2433},{27883,5,2434},{27886,0,2436},{27890,0,2437},
+{27892,0,2438},{27908,0,2439},{27911,0,2440},{27914,0,2441},
+{27918,5,2442},{27921,0,2444},{27923,0,2445},{27930,0,2446},
+{27942,9,2447},{27950,5,2451},{27953,0,2453},{27961,0,2454},
+{27964,0,2455},{27967,0,2456},{27991,0,2457},{27998,5,2458},
+{28001,0,2460},{28005,0,2461},{28007,0,2462},{28015,5,2463},
+{28028,0,2465},{28034,0,2466},{28039,0,2467},{28049,5,2468},
+{28052,0,2470},{28054,9,2471},{28074,0,2474},{28076,0,2475},
+{28084,0,2476},{28087,0,2477},{28089,0,2478},{28093,0,2479},
+{28095,0,2480},{28100,0,2481},{28104,0,2482},{28106,0,2483},
+{28110,5,2484},{28118,0,2486},{28123,0,2487},{28125,0,2488},
+{28127,5,2489},{28130,0,2491},{28133,0,2492},{28137,0,2493},
+{28143,5,2494},{28148,0,2496},{28150,0,2497},{28156,0,2498},
+{28160,0,2499},{28164,0,2500},{28190,0,2501},{28194,0,2502},
+{28199,0,2503},{28210,0,2504},{28214,0,2505},{28217,0,2506},
+{28219,5,2507},{28228,5,2509},{28232,5,2511},{28235,0,2513},
+{28239,0,2514},{28241,13,2515},{28247,0,2519},{28252,9,2520},
+{28258,5,2523},{28264,0,2525},{28275,0,2526},{28283,0,2527},
+{28285,0,2528},{28301,0,2529},{28307,0,2530},{28313,0,2531},
+{28320,0,2532},{28327,0,2533},{28333,5,2534},{28337,0,2536},
+{28339,0,2537},{28347,0,2538},{28351,9,2539},{28355,0,2542},
+{28359,5,2543},{28362,0,2545},{28365,9,2546},{28395,0,2549},
+{28397,5,2550},{28409,0,2552},{28411,0,2553},{28413,0,2554},
+{28420,0,2555},{28424,0,2556},{28426,0,2557},{28428,5,2558},
+{28438,0,2560},{28440,0,2561},{28442,5,2562},{28454,0,2564},
+{28457,5,2565},{28461,0,2573},{28463,5,2567},{28467,0,2569},
+{28470,0,2570},{28475,5,2571},{28495,0,2574},{28497,9,2575},
+{28503,0,2578},{28505,5,2579},{28509,5,2581},{28513,5,2583},
+{28520,0,2585},{28524,0,2586},{28541,5,2587},{28547,0,2589},
+{28551,5,2590},{28555,9,2592},{28560,0,2595},{28562,9,2596},
+{28566,0,2599},{28570,0,2600},{28575,5,2601},{28581,13,2603},
+{28590,9,2607},{28597,5,2610},{28604,0,2612},{28613,0,2613},
+{28615,5,2614},{28618,0,2616},{28634,0,2617},{28638,0,2618},
+{28648,5,2619},{28656,0,2621},{28661,0,2622},{28665,0,2623},
+{28668,5,2624},{28672,0,2626},{28677,9,2627},{28685,0,2630},
+{28695,0,2631},{28704,0,2632},{28707,0,2633},{28719,0,2634},
+{28724,0,2635},{28727,0,2636},{28729,0,2637},{28732,0,2638},
+{28739,5,2639},{28744,13,2641},{28750,0,2649},{28756,5,2645},
+{28765,5,2647},{28772,5,2650},{28780,0,2652},{28782,0,2653},
+{28789,5,2654},{28798,0,2656},{28801,0,2657},{28805,5,2658},
+{28820,17,2660},{28827,0,2665},{28836,0,2666},{28843,0,2667},
+{28848,5,2668},{28852,0,2670},{28855,0,2671},{28874,0,2672},
+{28881,0,2673},{28883,13,2674},{28888,0,2678},{28892,0,2679},
+{28900,0,2680},{28922,0,2681},{28931,17,2682},{28939,5,2687},
+{28943,0,2689},{28958,0,2690},{28960,0,2691},{28971,0,2692},
+{28973,0,2693},{28975,9,2694},{28984,0,2697},{28993,0,2698},
+{28997,9,2699},{29002,5,2702},{29008,0,2704},{29010,0,2705},
+{29015,0,2706},{29018,0,2707},{29020,0,2708},{29022,0,2709},
+{29024,0,2710},{29032,0,2711},{29049,0,2712},{29056,0,2713},
+{29061,0,2714},{29063,0,2715},{29068,0,2716},{29074,0,2717},
+{29082,5,2718},{29088,0,2720},{29090,0,2721},{29103,5,2722},
+{29106,5,2724},{29114,0,2726},{29119,9,2727},{29124,0,2730},
+{29131,5,2731},{29139,0,2733},{29142,0,2734},{29145,5,2735},
+{29148,0,2737},{29176,0,2738},{29182,0,2739},{29184,0,2740},
+{29191,9,2741},{29203,0,2744},{29207,0,2745},{29210,0,2746},
+{29213,0,2747},{29215,0,2748},{29220,0,2749},{29227,0,2750},
+{29231,0,2751},{29236,0,2752},{29240,5,2753},{29249,9,2755},
+{29253,0,2758},{29262,9,2759},{29267,0,2762},{29269,5,2763},
+{29274,0,2765},{29276,0,2766},{29278,0,2767},{29280,0,2768},
+{29283,0,2769},{29288,0,2770},{29291,0,2771},{29294,5,2772},
+{29297,0,2774},{29303,5,2775},{29307,5,2777},{29311,0,2779},
+{29316,0,2780},{29321,0,2781},{29325,5,2782},{29331,0,2784},
+{29339,0,2785},{29352,0,2786},{29357,5,2787},{29361,0,2789},
+{29364,0,2790},{29374,0,2791},{29377,0,2792},{29383,0,2793},
+{29385,0,2794},{29388,0,2795},{29397,5,2796},{29400,0,2798},
+{29407,0,2799},{29413,0,2800},{29427,5,2801},{29434,5,2803},
+{29438,0,2805},{29442,0,2806},{29444,5,2807},{29447,0,2809},
+{29451,0,2810},{29453,0,2811},{29458,5,2812},{29464,5,2814},
+{29470,0,2816},{29474,0,2817},{29476,0,2818},{29479,5,2819},
+{29484,0,2821},{29489,5,2822},{29493,0,2824},{29498,5,2825},
+{29501,0,2827},{29507,0,2828},{29517,0,2829},{29520,0,2830},
+{29522,0,2831},{29526,0,2832},{29528,0,2833},{29533,13,2834},
+{29542,5,2838},{29545,0,2840},{29547,5,2841},{29550,5,2843},
+{29553,0,2845},{29559,0,2846},{29561,0,2847},{29564,0,2848},
+{29568,5,2849},{29571,0,2851},{29573,5,2852},{29582,0,2854},
+{29584,0,2855},{29587,0,2856},{29589,0,2857},{29591,5,2858},
+{29596,0,2860},{29598,9,2861},{29602,0,2864},{29605,5,2865},
+{29610,5,2867},{29613,0,2869},{29621,0,2870},{29623,0,2871},
+{29625,0,2872},{29628,5,2873},{29631,0,2875},{29637,5,2876},
+{29641,0,2878},{29643,5,2879},{29647,0,2881},{29650,5,2882},
+{29654,0,2884},{29657,0,2885},{29661,0,2886},{29665,0,2887},
+{29667,0,2888},{29670,5,2889},{29673,0,2891},{29684,5,2892},
+{29687,0,2894},{29689,9,2895},{29693,0,2898},{29695,9,2899},
+{29700,0,2902},{29703,0,2903},{29706,0,2904},{29713,0,2905},
+{29722,5,2906},{29732,0,2908},{29734,0,2909},{29736,37,2910},
+{29753,0,2920},{29760,0,2921},{29763,5,2922},{29766,5,2924},
+{29771,0,2926},{29773,0,2927},{29777,5,2928},{29783,0,2930},
+{29789,0,2931},{29794,0,2932},{29798,9,2933},{29803,0,2936},
+{29805,5,2937},{29809,5,2939},{29824,5,2941},{29829,9,2943},
+{29833,0,2946},{29839,13,2947},{29848,9,2951},{29852,0,2954},
+{29855,9,2955},{29859,0,2958},{29862,0,2959},{29864,13,2960},
+{29870,5,2964},{29873,5,2966},{29877,0,2968},{29881,0,2969},
+{29883,0,2970},{29887,0,2971},{29896,5,2972},{29900,0,2974},
+{29904,0,2975},{29907,0,2976},{29912,0,2977},{29914,5,2978},
+{29918,5,2980},{29924,0,2982},{29928,0,2983},{29930,5,2984},
+{29935,0,2986},{29940,0,2987},{29946,9,2988},{29951,0,2991},
+{29958,0,2992},{29970,0,2993},{29974,5,2994},{29984,5,2996},
+{29988,0,2998},{29991,0,2999},{29993,5,3000},{29999,0,3002},
+{30006,0,3003},{30009,0,3004},{30013,13,3005},{30019,0,3009},
+{30023,5,3010},{30030,0,3012},{30032,0,3013},{30034,0,3014},
+{30039,0,3015},{30046,5,3016},{30049,0,3018},{30063,0,3019},
+{30065,0,3020},{30073,21,3021},{30081,0,3027},{30085,0,3028},
+{30096,0,3029},{30098,5,3030},{30101,0,3032},{30105,0,3033},
+{30108,0,3034},{30114,0,3035},{30116,0,3036},{30132,0,3037},
+{30138,0,3038},{30143,9,3039},{30148,0,3042},{30150,0,3043},
+{30156,0,3044},{30158,5,3045},{30167,0,3047},{30172,0,3048},
+{30175,9,3049},{30180,0,3052},{30183,0,3053},{30188,0,3054},
+{30190,5,3055},{30193,0,3057},{30201,0,3058},{30208,0,3059},
+{30210,9,3060},{30215,5,3063},{30218,0,3065},{30220,0,3066},
+{30223,0,3067},{30226,5,3068},{30229,5,3070},{30233,0,3072},
+{30235,13,3073},{30243,0,3077},{30245,5,3078},{30249,0,3080},
+{30253,0,3081},{30258,5,3082},{30261,0,3084},{30264,9,3085},
+{30268,0,3088},{30272,5,3090},{30275,9,3092},{30281,10,248},
+{30293,0,3097},{30297,0,3098},{30303,0,3099},{30308,5,3100},
+{30317,9,3102},{30321,0,3105},{30324,0,3106},{30337,0,3107},
+{30341,0,3108},{30348,5,3109},{30357,0,3111},{30363,9,3112},
+{30367,5,3115},{30370,25,3117},{30378,0,3124},{30381,0,3125},
+{30397,0,3126},{30401,0,3127},{30405,0,3128},{30409,0,3129},
+{30411,5,3130},{30414,0,3132},{30420,0,3133},{30425,0,3134},
+{30432,0,3135},{30438,0,3136},{30440,0,3137},{30444,0,3138},
+{30448,5,3139},{30454,0,3141},{30457,0,3142},{30460,0,3143},
+{30464,0,3144},{30470,0,3145},{30474,0,3146},{30478,0,3147},
+{30482,0,3148},{30484,5,3149},{30487,0,3151},{30489,5,3152},
+{30492,0,3154},{30498,0,3155},{30504,0,3156},{30509,9,3157},
+{30516,9,3160},{30521,0,3163},{30525,5,3164},{30530,0,3166},
+{30533,5,3167},{30538,0,3169},{30541,9,3170},{30546,0,3173},
+{30550,5,3174},{30556,0,3176},{30558,9,3177},{30562,0,3180},
+{30564,0,3181},{30567,0,3182},{30570,0,3183},{30572,0,3184},
+{30576,0,3185},{30578,9,3186},{30586,0,3189},{30589,0,3190},
+{30592,0,3191},{30596,0,3192},{30604,5,3193},{30612,9,3195},
+{30618,0,3198},{30623,0,3199},{30626,0,3200},{30631,0,3201},
+{30634,0,3202},{30638,5,3203},{30641,0,3205},{30645,0,3206},
+{30654,0,3207},{30659,0,3208},{30665,0,3209},{30673,5,3210},
+{30677,0,3212},{30681,0,3213},{30686,9,3214},{30692,0,3217},
+{30694,0,3218},{30698,0,3219},{30700,0,3220},{30704,5,3221},
+{30708,0,3223},{30712,0,3224},{30715,0,3225},{30725,5,3226},
+{30729,0,3228},{30733,5,3229},{30737,0,3231},{30749,0,3232},
+{30753,9,3233},{30765,5,3236},{30768,0,3238},{30773,0,3239},
+{30775,0,3240},{30787,5,3241},{30791,5,3243},{30796,0,3245},
+{30798,0,3246},{30802,0,3247},{30812,0,3248},{30814,0,3249},
+{30816,5,3250},{30819,5,3252},{30824,0,3254},{30826,0,3255},
+{30830,0,3256},{30842,0,3257},{30846,0,3258},{30858,0,3259},
+{30863,0,3260},{30868,0,3261},{30872,0,3262},{30877,9,3264},
+{30881,0,3263},{30884,0,3267},{30888,0,3268},{30892,5,3269},
+{30896,13,3271},{30907,0,3275},{30909,0,3276},{30911,0,3277},
+{30919,9,3278},{30924,0,3281},{30926,0,3282},{30930,5,3283},
+{30933,5,3285},{30939,0,3288},{30943,9,3289},{30948,0,3287},
+{30950,0,3292},{30954,0,3293},{30962,5,3294},{30966,5,3297},
+{30970,5,3299},{30975,6,251},{30982,0,3302},{30988,0,3303},
+{30992,0,3304},{31002,0,3305},{31004,0,3306},{31006,9,3307},
+{31013,0,3310},{31015,0,3311},{31017,0,3312},{31021,0,3313},
+{31025,0,3314},{31028,5,3315},{31035,0,3317},{31037,0,3318},
+{31039,0,3319},{31044,9,3320},{31050,5,3323},{31055,0,3325},
+{31057,0,3326},{31060,0,3327},{31064,0,3328},{31067,5,3329},
+{31079,0,3331},{31081,0,3332},{31083,0,3333},{31090,0,3334},
+{31097,0,3335},{31099,5,3336},{31102,0,3338},{31115,5,3339},
+{31121,0,3341},{31123,13,3342},{31128,0,3346},{31131,5,3347},
+{31137,0,3349},{31144,5,3350},{31147,0,3352},{31151,0,3353},
+{31153,0,3354},{31156,0,3355},{31160,0,3356},{31163,0,3357},
+{31170,0,3358},{31172,0,3359},{31175,5,3360},{31178,0,3362},
+{31183,0,3363},{31188,0,3364},{31190,0,3365},{31194,0,3366},
+{31197,5,3367},{31200,0,3369},{31202,0,3370},{31205,0,3371},
+{31210,5,3372},{31213,0,3374},{31217,0,3375},{31224,0,3376},
+{31228,0,3377},{31234,5,3378},{31239,0,3380},{31241,5,3381},
+{31244,0,3383},{31249,0,3384},{31253,0,3385},{31259,0,3386},
+{31262,0,3387},{31265,0,3388},{31271,0,3389},{31275,0,3390},
+{31277,0,3391},{31279,5,3392},{31284,5,3394},{31288,9,3396},
+{31300,5,3399},{31303,5,3401},{31308,0,3403},{31317,5,3404},
+{31321,0,3406},{31324,5,3407},{31327,5,3409},{31333,0,3411},
+{31335,0,3412},{31338,0,3413},{31341,0,3414},{31349,0,3415},
+{31352,0,3416},{31358,0,3417},{31360,0,3418},{31362,0,3419},
+{31365,5,3420},{31370,5,3422},{31376,5,3424},{31380,0,3426},
+{31390,0,3427},{31392,0,3428},{31395,0,3429},{31404,0,3430},
+{31411,0,3431},{31413,0,3432},{31417,0,3433},{31419,5,3434},
+{31430,0,3436},{31433,0,3437},{31436,0,3438},{31438,0,3439},
+{31441,0,3440},{31451,0,3441},{31464,5,3442},{31467,5,3444},
+{31473,0,3446},{31476,0,3447},{31483,0,3448},{31485,5,3449},
+{31495,0,3451},{31508,0,3452},{31519,0,3453},{31523,0,3454},
+{31527,0,3455},{31529,9,3456},{31533,17,3459},{31540,0,3464},
+{31549,0,3465},{31551,9,3466},{31559,0,3469},{31566,0,3470},
+{31573,0,3471},{31584,0,3472},{31588,0,3473},{31590,0,3474},
+{31593,5,3475},{31597,0,3477},{31599,0,3478},{31602,5,3479},
+{31607,0,3481},{31620,0,3482},{31625,0,3483},{31630,0,3484},
+{31632,5,3485},{31638,0,3487},{31643,0,3488},{31646,0,3489},
+{31648,0,3490},{31653,0,3491},{31660,0,3492},{31663,5,3493},
+{31666,0,3495},{31669,5,3496},{31674,13,3498},{31682,0,3502},
+{31685,0,3503},{31688,0,3504},{31690,0,3505},{31700,0,3506},
+{31702,5,3507},{31705,9,3509},{31720,0,3512},{31722,0,3513},
+{31730,0,3514},{31732,5,3515},{31736,9,3517},{31740,0,3520},
+{31742,0,3521},{31745,13,3522},{31750,0,3526},{31753,0,3527},
+{31755,5,3528},{31758,5,3530},{31769,0,3532},{31771,0,3533},
+{31776,0,3534},{31781,5,3535},{31784,0,3537},{31788,0,3538},
+{31793,0,3539},{31795,5,3540},{31798,0,3542},{31801,5,3543},
+{31814,0,3545},{31818,0,3546},{31825,9,3548},{31829,0,3547},
+{31833,21,3551},{31841,0,3557},{31843,0,3558},{31847,0,3559},
+{31849,0,3560},{31853,5,3561},{31856,0,3563},{31858,0,3564},
+{31865,0,3565},{31868,5,3566},{31878,5,3568},{31887,0,3570},
+{31892,0,3571},{31902,0,3572},{31904,0,3573},{31910,0,3574},
+{31920,0,3575},{31926,5,3576},{31930,9,3578},{31935,0,3581},
+{31940,0,3582},{31943,9,3583},{31949,0,3586},{31951,0,3587},
+{31955,9,3588},{31959,0,3591},{31961,5,3592},{31965,0,3594},
+{31974,0,3595},{31977,0,3596},{31979,0,3597},{31989,0,3598},
+{32003,0,3599},{32007,9,3600},{32015,0,3603},{32017,9,3604},
+{32022,0,3607},{32029,5,3608},{32035,0,3610},{32038,0,3611},
+{32042,0,3612},{32045,0,3613},{32049,0,3614},{32060,9,3615},
+{32064,5,3618},{32071,5,3620},{32077,0,3622},{32081,0,3623},
+{32083,0,3624},{32087,0,3625},{32089,5,3626},{32092,5,3628},
+{32101,0,3630},{32103,0,3631},{32106,0,3632},{32112,0,3633},
+{32120,0,3634},{32122,5,3635},{32127,0,3637},{32129,9,3638},
+{32133,5,3641},{32136,0,3643},{32139,9,3644},{32145,0,3647},
+{32150,5,3648},{32157,5,3650},{32166,5,3652},{32170,0,3654},
+{32179,0,3655},{32182,5,3656},{32185,0,3658},{32194,17,3659},
+{32204,9,3664},{32215,0,3667},{32217,0,3668},{32226,0,3670},
+{32229,5,3671},{32234,5,3673},{32237,0,3675},{32241,0,3676},
+{32245,5,3677},{32249,5,3679},{32256,0,3669},{32264,0,3681},
+{32272,5,3682},{32277,0,3684},{32279,0,3685},{32284,5,3686},
+{32288,0,3688},{32295,5,3689},{32300,5,3691},{32303,0,3693},
+{32307,0,3694},{32310,0,3695},{32319,0,3696},{32324,5,3697},
+{32327,0,3699},{32334,0,3700},{32336,0,3701},{32338,0,3702},
+{32344,0,3703},{32351,0,3704},{32353,5,3705},{32357,0,3707},
+{32363,0,3708},{32366,5,3709},{32371,0,3711},{32376,0,3712},
+{32382,0,3713},{32385,0,3714},{32390,5,3715},{32394,0,3717},
+{32397,0,3718},{32401,0,3719},{32405,0,3720},{32408,0,3721},
+{32410,0,3722},{32413,5,3723},{32571,6,253},{32573,9,3727},
+{32579,5,3730},{32583,0,3732},{32591,0,3733},{32594,5,3734},
+{32603,9,3736},{32609,0,3739},{32611,13,3740},{32621,0,3744},
+{32625,0,3745},{32637,13,3746},{32651,0,3750},{32653,0,3751},
+{32655,9,3752},{32662,5,3755},{32668,0,3757},{32673,5,3758},
+{32678,0,3760},{32682,0,3761},{32685,0,3762},{32692,0,3763},
+{32700,0,3764},{32703,5,3765},{32707,0,3767},{32712,0,3768},
+{32718,5,3769},{32731,0,3771},{32735,0,3772},{32739,0,3773},
+{32741,0,3774},{32744,0,3775},{32748,0,3776},{32750,5,3777},
+{32754,0,3779},{32762,0,3780},{32765,9,3781},{32775,5,3784},
+{32778,0,3786},{32781,9,3787},{32785,0,3790},{32787,5,3791},
+{32790,0,3793},{32797,13,3794},{32804,0,3798},{32806,0,3799},
+{32812,0,3800},{32814,0,3801},{32816,0,3802},{32820,5,3803},
+{32823,0,3805},{32825,5,3806},{32828,0,3808},{32830,0,3809},
+{32832,0,3810},{32836,0,3811},{32864,0,3812},{32868,0,3813},
+{32870,0,3814},{32877,0,3815},{32881,0,3816},{32885,0,3817},
+{32897,0,3818},{32904,0,3819},{32910,0,3820},{32924,0,3821},
+{32926,0,3822},{32934,5,3823},{32939,0,3825},{32952,5,3826},
+{32968,0,3828},{32973,0,3829},{32975,0,3830},{32978,0,3831},
+{32980,5,3832},{32983,5,3834},{32992,0,3836},{33005,5,3837},
+{33008,0,3839},{33010,5,3840},{33014,0,3842},{33017,5,3843},
+{33022,0,3845},{33027,0,3846},{33035,0,3847},{33046,9,3848},
+{33052,0,3851},{33054,0,3852},{33056,0,3853},{33060,0,3854},
+{33063,0,3855},{33068,0,3856},{33072,0,3857},{33077,0,3858},
+{33082,0,3859},{33084,0,3860},{33093,0,3861},{33095,0,3862},
+{33098,0,3863},{33100,0,3864},{33106,0,3865},{33111,0,3866},
+{33120,5,3867},{33127,9,3869},{33133,0,3872},{33135,0,3873},
+{33143,0,3874},{33153,0,3875},{33156,9,3877},{33163,0,3880},
+{33166,0,3881},{33168,0,3876},{33174,0,3882},{33176,0,3883},
+{33179,0,3884},{33182,0,3885},{33186,0,3886},{33198,0,3887},
+{33202,0,3888},{33204,0,3889},{33211,0,3890},{33219,0,3892},
+{33221,0,3893},{33226,6,255},{33230,5,3895},{33237,0,3897},
+{33239,0,3898},{33243,0,3899},{33245,5,3900},{33249,0,3902},
+{33252,0,3903},{33259,5,3904},{33264,9,3906},{33269,5,3909},
+{33272,5,3911},{33277,0,3913},{33279,5,3914},{33283,0,3916},
+{33295,0,3917},{33299,5,3918},{33305,5,3920},{33309,0,3922},
+{33313,5,3923},{33320,0,3925},{33330,0,3926},{33332,0,3927},
+{33338,0,3928},{33347,13,3929},{33355,0,3933},{33358,5,3934},
+{33361,0,3936},{33366,0,3937},{33372,0,3938},{33376,0,3939},
+{33379,0,3940},{33383,0,3941},{33389,0,3942},{33396,0,3943},
+{33403,0,3944},{33405,0,3945},{33407,9,3946},{33411,5,3949},
+{33415,0,3951},{33417,5,3952},{33422,0,3954},{33425,0,3955},
+{33428,0,3956},{33430,0,3957},{33432,0,3958},{33434,5,3959},
+{33440,5,3961},{33443,5,3963},{33447,13,3965},{33454,0,3969},
+{33456,0,3970},{33458,0,3971},{33460,0,3972},{33463,0,3973},
+{33466,0,3974},{33468,0,3975},{33470,5,3976},{33478,0,3978},
+{33488,0,3979},{33493,0,3980},{33498,0,3981},{33504,0,3982},
+{33506,0,3983},{33508,0,3984},{33512,0,3985},{33514,0,3986},
+{33517,0,3987},{33519,0,3988},{33526,5,3989},{33533,5,3991},
+{33536,5,3993},{33543,5,3995},{33546,5,3997},{33563,0,4000},
+{33565,9,4001},{33569,5,4004},{33580,9,4006},{33584,0,4009},
+{33587,0,4010},{33591,0,4011},{33594,0,4012},{33596,5,4013},
+{33602,9,4015},{33607,0,4018},{33613,5,4019},{33617,0,4021},
+{33619,6,257},{33621,9,4022},{33648,0,4025},{33656,0,4026},
+{33661,0,4027},{33663,5,4028},{33666,0,4030},{33668,0,4031},
+{33670,0,4032},{33677,0,4033},{33682,0,4034},{33684,5,4035},
+{33688,5,4037},{33691,9,4039},{33702,5,4042},{33705,0,4044},
+{33708,6,259},{33726,9,4046},{33735,0,4049},{33737,0,4050},
+{33743,9,4051},{33748,0,4054},{33757,0,4055},{33768,0,4057},
+{33770,0,4058},{33782,0,4059},{33784,5,4060},{33788,0,4062},
+{33793,0,4063},{33798,0,4064},{33802,0,4065},{33807,0,4066},
+{33809,0,4067},{33813,0,4068},{33817,0,4069},{33839,0,4071},
+{33849,0,4072},{33861,0,4073},{33863,5,4074},{33866,0,4076},
+{33869,0,4077},{33871,0,4078},{33873,5,4079},{33878,0,4081},
+{33880,9,4082},{33884,0,4085},{33888,0,4086},{33892,5,4087},
+{33895,0,4089},{33898,0,4090},{33904,0,4091},{33907,5,4092},
+{33910,0,4094},{33912,0,4095},{33916,5,4096},{33921,0,4098},
+{33925,0,4099},{33938,5,4100},{33941,0,4102},{33950,0,4103},
+{33958,0,4104},{33960,9,4105},{33967,0,4108},{33969,0,4109},
+{33972,0,4110},{33978,0,4111},{33981,5,4112},{33984,0,4114},
+{33986,0,4115},{33991,5,4116},{33996,0,4118},{33999,0,4119},
+{34003,0,4120},{34012,0,4121},{34023,0,4122},{34026,0,4123},
+{34031,13,4124},{34039,0,4128},{34042,5,4130},{34045,0,4132},
+{34050,5,4133},{34055,0,4135},{34060,0,4136},{34062,0,4137},
+{34064,0,4138},{34076,0,4139},{34078,0,4140},{34082,13,4141},
+{34087,0,4145},{34090,5,4146},{34095,0,4148},{34098,0,4129},
+{34099,5,4149},{34102,0,4151},{34111,0,4152},{34118,0,4153},
+{34127,17,4154},{34134,0,4159},{34137,0,4160},{34140,25,4161},
+{34148,0,4168},{34155,0,4169},{34159,0,4170},{34169,9,4171},
+{34173,0,4174},{34175,0,4175},{34177,0,4176},{34181,5,4177},
+{34185,0,4179},{34187,5,4180},{34191,0,4182},{34195,0,4183},
+{34200,0,4184},{34205,0,4185},{34207,5,4186},{34210,0,4188},
+{34213,0,4189},{34215,0,4190},{34221,0,4204},{34228,0,4191},
+{34230,9,4192},{34236,13,4195},{34242,0,4199},{34247,0,4200},
+{34250,5,4201},{34254,0,4203},{34264,0,4205},{34266,0,4206},
+{34271,5,4207},{34278,0,4209},{34280,0,4210},{34285,0,4211},
+{34291,0,4212},{34294,0,4213},{34300,0,4214},{34303,5,4215},
+{34308,5,4217},{34317,5,4219},{34320,9,4221},{34328,5,4224},
+{34331,0,4226},{34334,0,4227},{34337,0,4228},{34343,0,4229},
+{34345,0,4230},{34358,0,4231},{34360,0,4232},{34362,0,4233},
+{34364,5,4234},{34368,10,261},{34374,0,4238},{34386,5,4239},
+{34390,13,4241},{34397,0,4245},{34400,17,4246},{34409,0,4251},
+{34412,0,4252},{34415,0,4253},{34421,9,4254},{34426,0,4257},
+{34440,0,4291},{34445,0,4258},{34449,0,4259},{34454,0,4260},
+{34456,0,4261},{34458,0,4262},{34460,0,4263},{34465,0,4264},
+{34470,9,4265},{34477,0,4268},{34481,0,4269},{34483,9,4270},
+{34487,9,4273},{34495,9,4276},{34499,0,4279},{34501,0,4280},
+{34513,5,4281},{34517,0,4283},{34519,0,4284},{34522,0,4285},
+{34524,0,4286},{34528,0,4287},{34531,0,4288},{34533,0,4289},
+{34535,0,4290},{34554,0,4292},{34556,5,4293},{34564,5,4295},
+{34567,0,4297},{34571,0,4298},{34574,9,4299},{34579,5,4302},
+{34585,0,4304},{34590,5,4305},{34593,0,4307},{34595,0,4308},
+{34600,0,4309},{34606,5,4310},{34609,5,4312},{34617,5,4314},
+{34620,9,4316},{34624,0,4319},{34627,0,4320},{34629,0,4321},
+{34637,0,4322},{34648,0,4323},{34653,0,4324},{34657,0,4325},
+{34660,5,4326},{34671,0,4328},{34673,5,4329},{34683,0,4331},
+{34691,25,4332},{34699,5,4339},{34704,0,4341},{34707,0,4342},
+{34709,0,4343},{34711,9,4344},{34718,0,4347},{34720,0,4348},
+{34723,0,4349},{34727,0,4350},{34732,9,4351},{34737,0,4354},
+{34741,0,4355},{34750,5,4356},{34753,0,4358},{34760,9,4359},
+{34766,0,4362},{34773,5,4363},{34777,5,4365},{34780,0,4367},
+{34783,0,4368},{34786,9,4369},{34794,5,4372},{34797,0,4374},
+{34801,0,4375},{34803,0,4376},{34808,0,4377},{34810,0,4378},
+{34815,0,4379},{34817,0,4380},{34819,0,4381},{34822,0,4382},
+{34825,9,4383},{34832,0,4386},{34834,9,4388},{34840,6,264},
+{34842,9,4392},{34846,5,4395},{34856,0,4397},{34861,5,4398},
+{34864,0,4400},{34866,0,4401},{34869,0,4402},{34874,0,4403},
+{34876,0,4404},{34881,0,4405},{34883,0,4406},{34885,0,4407},
+{34888,13,4408},{34894,0,4412},{34897,0,4413},{34901,5,4414},
+{34904,0,4416},{34906,0,4417},{34908,0,4418},{34911,5,4419},
+{34916,0,4421},{34921,0,4422},{34929,0,4423},{34937,0,4424},
+{34939,0,4425},{34944,0,4426},{34968,0,4427},{34970,9,4428},
+{34975,5,4431},{34984,0,4433},{34986,0,4434},{35002,0,4435},
+{35005,5,4436},{35008,0,4438},{35018,17,4439},{35025,9,4444},
+{35035,0,4447},{35038,0,4448},{35047,0,4449},{35055,9,4450},
+{35061,0,4453},{35063,0,4454},{35073,0,4455},{35078,0,4456},
+{35085,9,4457},{35093,5,4460},{35096,9,4462},{35100,0,4465},
+{35104,0,4466},{35110,9,4467},{35120,9,4470},{35125,0,4473},
+{35129,5,4474},{35134,0,4476},{35136,0,4477},{35138,0,4478},
+{35141,5,4479},{35145,0,4481},{35151,0,4482},{35154,0,4483},
+{35159,0,4484},{35162,9,4485},{35169,9,4488},{35179,0,4491},
+{35182,0,4492},{35184,0,4493},{35187,0,4494},{35189,0,4495},
+{35194,13,4496},{35209,0,4500},{35213,0,4501},{35216,0,4502},
+{35220,5,4503},{35227,5,4505},{35231,5,4507},{35237,0,4509},
+{35248,0,4510},{35252,13,4511},{35260,0,4515},{35284,17,4516},
+{35301,0,4521},{35305,0,4522},{35307,0,4523},{35309,0,4524},
+{35313,0,4525},{35315,0,4526},{35318,0,4527},{35321,0,4528},
+{35325,0,4529},{35327,0,4530},{35332,5,4531},{35335,0,4533},
+{35343,0,4534},{35345,5,4535},{35348,5,4537},{35358,0,4539},
+{35360,0,4540},{35362,0,4541},{35364,0,4542},{35366,0,4543},
+{35371,5,4544},{35375,0,4546},{35381,0,4547},{35383,0,4548},
+{35389,5,4549},{35392,0,4551},{35395,0,4552},{35397,0,4553},
+{35399,0,4554},{35401,0,4555},{35405,5,4556},{35411,0,4558},
+{35414,9,4559},{35420,5,4562},{35425,0,4564},{35429,0,4565},
+{35431,0,4566},{35445,9,4567},{35449,9,4570},{35454,9,4573},
+{35459,0,4576},{35462,0,4577},{35467,0,4578},{35471,5,4579},
+{35474,0,4581},{35478,5,4582},{35481,0,4584},{35487,0,4585},
+{35495,0,4586},{35497,0,4587},{35502,5,4588},{35507,0,4590},
+{35510,5,4591},{35515,0,4593},{35518,0,4594},{35523,0,4595},
+{35526,0,4596},{35528,9,4597},{35537,0,4600},{35539,9,4601},
+{35543,0,4604},{35549,0,4605},{35551,0,4606},{35564,0,4607},
+{35568,0,4608},{35572,9,4609},{35580,0,4612},{35583,0,4613},
+{35589,5,4614},{35594,6,266},{35601,0,4617},{35612,0,4618},
+{35614,5,4619},{35629,0,4622},{35632,0,4623},{35639,0,4624},
+{35644,0,4625},{35650,17,4626},{35656,0,4631},{35661,0,4636},
+{35666,9,4632},{35673,0,4635},{35678,0,4637},{35683,0,4638},
+{35693,0,4639},{35702,0,4640},{35704,5,4641},{35708,0,4643},
+{35710,0,4644},{35713,0,4645},{35716,5,4646},{35723,0,4648},
+{35725,0,4649},{35727,0,4650},{35732,5,4651},{35740,0,4653},
+{35742,5,4654},{35896,5,4656},{35901,5,4658},{35909,0,4660},
+{35911,0,4661},{35913,0,4662},{35915,0,4663},{35919,0,4664},
+{35921,0,4665},{35923,5,4666},{35927,5,4668},{35929,0,4672},
+{35931,0,4670},{35933,0,4671},{35939,5,4673},{35942,0,4675},
+{35944,5,4676},{35949,0,4678},{35955,0,4679},{35957,5,4680},
+{35963,0,4682},{35966,0,4683},{35974,5,4684},{35979,0,4686},
+{35984,0,4687},{35986,5,4688},{35993,0,4690},{35995,5,4691},
+{36004,0,4693},{36025,5,4694},{36037,5,4696},{36041,0,4698},
+{36043,0,4699},{36047,0,4700},{36053,6,268},{36057,0,4703},
+{36061,0,4704},{36065,0,4705},{36072,0,4706},{36076,0,4707},
+{36079,5,4708},{36082,0,4710},{36085,0,4711},{36087,5,4712},
+{36094,5,4714},{36097,0,4716},{36099,0,4717},{36105,0,4718},
+{36114,0,4719},{36119,0,4720},{36123,0,4721},{36197,0,4722},
+{36201,0,4723},{36204,0,4724},{36206,0,4725},{36223,0,4726},
+{36226,0,4727},{36228,0,4728},{36232,0,4729},{36237,0,4730},
+{36240,5,4731},{36245,0,4733},{36254,9,4734},{36262,0,4737},
+{36267,5,4738},{36271,0,4740},{36274,0,4741},{36277,0,4742},
+{36279,0,4743},{36281,0,4744},{36283,6,270},{36288,0,4746},
+{36293,13,4747},{36298,0,4751},{36302,0,4752},{36305,0,4753},
+{36308,5,4754},{36311,0,4756},{36313,0,4757},{36324,5,4758},
+{36327,0,4760},{36332,0,4761},{36336,0,4762},{36337,5,4764},
+{36340,0,4766},{36349,0,4767},{36353,0,4768},{36356,9,4769},
+{36363,0,4772},{36369,0,4773},{36372,0,4774},{36374,0,4775},
+{36384,13,4776},{36390,5,4780},{36401,0,4782},{36403,0,4783},
+{36406,13,4784},{36413,0,4788},{36416,5,4789},{36427,0,4791},
+{36429,9,4792},{36436,0,4795},{36443,13,4796},{36449,5,4800},
+{36457,0,4802},{36460,5,4803},{36463,9,4805},{36473,9,4808},
+{36482,5,4811},{36489,0,4813},{36496,0,4814},{36498,0,4815},
+{36501,0,4816},{36506,5,4817},{36509,5,4819},{36514,0,4821},
+{36519,0,4822},{36521,0,4823},{36525,5,4824},{36531,0,4826},
+{36533,0,4827},{36538,5,4828},{36544,5,4830},{36547,5,4832},
+{36551,0,4834},{36559,0,4835},{36561,0,4836},{36564,0,4837},
+{36572,0,4838},{36584,0,4839},{36589,6,272},{36592,5,4841},
+{36599,0,4843},{36601,5,4844},{36608,0,4847},{36610,0,4848},
+{36615,5,4849},{36623,5,4851},{36630,9,4853},{36638,0,4856},
+{36640,5,4857},{36643,0,4859},{36645,0,4860},{36647,5,4861},
+{36652,9,4863},{36660,13,4866},{36666,0,4870},{36672,5,4871},
+{36675,0,4873},{36679,0,4874},{36687,0,4875},{36689,17,4876},
+{36696,0,4881},{36701,5,4882},{36709,0,4884},{36765,0,4885},
+{36768,5,4886},{36772,9,4888},{36789,5,4891},{36792,0,4893},
+{36798,0,4894},{36800,5,4895},{36806,0,4897},{36810,5,4898},
+{36813,0,4900},{36816,0,4901},{36818,5,4902},{36821,0,4904},
+{36832,0,4905},{36835,5,4906},{36840,0,4908},{36846,0,4909},
+{36849,0,4910},{36853,5,4911},{36859,0,4913},{36862,0,4914},
+{36866,0,4915},{36868,0,4916},{36872,0,4917},{36876,0,4918},
+{36888,0,4919},{36891,0,4920},{36904,5,4921},{36906,0,4924},
+{36908,5,4925},{36911,0,4923},{36915,5,4927},{36919,0,4929},
+{36927,0,4930},{36931,5,4931},{36940,0,4933},{36955,0,4934},
+{36957,0,4935},{36962,0,4936},{36966,5,4937},{36972,0,4939},
+{36976,0,4940},{36980,0,4941},{36985,0,4942},{36997,0,4943},
+{37000,0,4944},{37003,5,4945},{37006,0,4947},{37008,0,4948},
+{37013,0,4949},{37015,9,4950},{37019,0,4953},{37024,9,4954},
+{37029,0,4957},{37040,0,4958},{37042,9,4959},{37046,0,4962},
+{37053,6,274},{37059,9,4966},{37063,5,4969},{37068,0,4964},
+{37074,0,4979},{37077,0,4971},{37079,9,4972},{37084,5,4975},
+{37087,0,4977},{37093,0,4978},{37099,0,4981},{37103,5,4982},
+{37108,0,4984},{37110,0,4980},{37118,9,4985},{37124,9,4988},
+{37128,0,4991},{37133,0,4992},{37136,0,4993},{37140,0,4994},
+{37142,9,4995},{37146,0,4998},{37148,0,4999},{37150,0,5000},
+{37152,0,5001},{37154,5,5003},{37157,0,5002},{37159,0,5005},
+{37161,0,5006},{37166,5,5007},{37169,0,5009},{37172,0,5010},
+{37174,5,5011},{37177,5,5013},{37180,5,5015},{37187,0,5017},
+{37191,5,5018},{37199,0,5020},{37203,0,5021},{37207,0,5022},
+{37209,9,5023},{37217,0,5026},{37220,0,5027},{37223,0,5028},
+{37229,0,5029},{37236,0,5030},{37241,9,5031},{37249,0,5034},
+{37251,0,5035},{37253,5,5036},{37258,0,5038},{37262,0,5039},
+{37265,0,5040},{37267,9,5041},{37272,0,5044},{37278,0,5045},
+{37281,0,5046},{37286,0,5047},{37288,0,5048},{37292,9,5049},
+{37296,13,5052},{37302,0,5056},{37307,9,5057},{37311,0,5060},
+{37314,5,5061},{37317,0,5063},{37331,5,5064},{37335,0,5066},
+{37337,5,5067},{37342,0,5069},{37348,5,5070},{37353,5,5072},
+{37356,21,5074},{37367,0,5080},{37369,0,5081},{37371,0,5082},
+{37373,0,5083},{37376,5,5084},{37380,13,5086},{37385,5,5090},
+{37388,0,5092},{37392,0,5093},{37394,5,5094},{37398,0,5096},
+{37400,0,5097},{37404,5,5098},{37411,13,5100},{37416,0,5104},
+{37422,9,5105},{37427,0,5108},{37429,5,5109},{37432,9,5111},
+{37436,0,5114},{37438,0,5115},{37440,0,5116},{37442,5,5117},
+{37446,5,5119},{37450,0,5121},{37453,9,5122},{37457,0,5125},
+{37464,5,5126},{37468,5,5128},{37472,5,5130},{37477,0,5132},
+{37479,9,5133},{37486,9,5136},{37493,17,5139},{37499,9,5144},
+{37503,0,5147},{37512,9,5148},{37517,5,5151},{37522,0,5153},
+{37527,0,5154},{37529,0,5155},{37535,5,5156},{37540,5,5158},
+{37543,5,5160},{37547,0,5162},{37551,0,5163},{37554,0,5164},
+{37558,0,5165},{37560,0,5166},{37562,13,5167},{37567,17,5171},
+{37573,13,5176},{37579,13,5180},{37584,0,5184},{37587,0,5185},
+{37589,0,5186},{37591,9,5187},{37596,5,5190},{37599,9,5192},
+{37603,0,5195},{37605,0,5196},{37607,5,5197},{37612,0,5199},
+{37614,0,5200},{37616,0,5201},{37625,0,5202},{37627,0,5203},
+{37631,5,5204},{37634,0,5206},{37640,0,5207},{37645,0,5208},
+{37649,0,5209},{37652,5,5210},{37660,13,5212},{37665,0,5216},
+{37668,5,5217},{37671,0,5219},{37673,5,5220},{37683,5,5222},
+{37686,5,5224},{37703,9,5226},{37712,9,5229},{37717,0,5232},
+{37719,5,5233},{37722,0,5235},{37726,0,5236},{37732,5,5237},
+{37735,0,5239},{37737,5,5240},{37741,0,5242},{37743,9,5243},
+{37747,5,5246},{37750,0,5248},{37754,0,5249},{37757,0,5250},
+{37759,13,5251},{37768,0,5255},{37770,5,5256},{37773,0,5258},
+{37775,0,5259},{37778,0,5260},{37781,0,5261},{37784,0,5262},
+{37787,0,5263},{37790,0,5264},{37793,0,5265},{37795,5,5266},
+{37798,0,5268},{37800,6,276},{37803,0,5270},{37812,9,5271},
+{37818,0,5274},{37825,0,5276},{37828,13,5277},{37833,17,5281},
+{37843,0,5286},{37849,0,5287},{37852,0,5288},{37854,5,5289},
+{37858,0,5291},{37862,5,5292},{37879,5,5295},{37881,0,5294},
+{37882,5,5297},{37885,0,5299},{37889,5,5300},{37892,0,5302},
+{37896,5,5303},{37901,9,5305},{37909,9,5308},{37919,0,5311},
+{37934,5,5312},{37937,13,5314},{37947,0,5318},{37949,0,5320},
+{37951,0,5319},{37955,0,5321},{37957,0,5322},{37960,0,5323},
+{37962,0,5324},{37964,0,5325},{37973,0,5326},{37977,0,5327},
+{37980,0,5328},{37983,0,5329},{37985,0,5330},{37987,0,5331},
+{37992,0,5332},{37995,0,5333},{37997,9,5334},{38001,5,5337},
+{38019,6,278},{38264,5,5341},{38270,0,5343},{38276,0,5344},
+{38280,0,5345},{38284,9,5346},{38301,9,5349},{38305,0,5352},
+{38310,0,5353},{38313,0,5354},{38315,5,5355},{38324,0,5357},
+{38326,0,5358},{38330,0,5359},{38333,0,5360},{38335,0,5361},
+{38342,0,5362},{38344,5,5363},{38347,0,5365},{38352,13,5366},
+{38361,5,5370},{38365,13,5372},{38372,0,5376},{38374,0,5377},
+{38429,5,5378},{38434,0,5380},{38436,9,5381},{38444,0,5384},
+{38449,0,5385},{38451,0,5386},{38455,13,5387},{38460,5,5391},
+{38465,0,5393},{38482,0,5394},{38484,0,5395},{38486,9,5396},
+{38497,0,5399},{38510,0,5400},{38516,0,5401},{38523,5,5402},
+{38526,5,5404},{38529,13,5406},{38537,0,5410},{38545,0,5411},
+{38550,0,5412},{38554,0,5413},{38557,0,5414},{38559,0,5415},
+{38564,9,5416},{38569,0,5419},{38574,5,5420},{38579,0,5422},
+{38586,0,5423},{38602,0,5424},{38610,0,5425},{38616,0,5427},
+{38618,0,5428},{38621,9,5429},{38633,0,5432},{38639,0,5433},
+{38641,0,5434},{38650,0,5435},{38658,5,5436},{38661,0,5438},
+{38665,0,5439},{38682,5,5440},{38685,0,5442},{38689,9,5443},
+{38696,0,5446},{38705,0,5447},{38707,0,5448},{38721,0,5449},
+{38723,0,5450},{38730,0,5451},{38734,5,5452},{38741,0,5454},
+{38743,5,5455},{38746,5,5457},{38755,0,5459},{38759,0,5460},
+{38762,0,5461},{38766,0,5462},{38771,0,5463},{38774,9,5464},
+{38779,0,5467},{38781,0,5468},{38783,5,5469},{38793,0,5471},
+{38805,9,5472},{38809,5,5475},{38814,5,5477},{38818,0,5479},
+{38828,0,5480},{38830,0,5481},{38833,5,5482},{38837,5,5484},
+{38840,9,5486},{38844,0,5489},{38846,5,5490},{38849,0,5492},
+{38852,5,5493},{38855,0,5495},{38857,5,5496},{38860,9,5498},
+{38864,5,5501},{38868,0,5503},{38871,9,5504},{38875,0,5510},
+{38877,5,5507},{38880,6,280},{38884,0,5512},{38895,0,5513},
+{38897,0,5514},{38900,0,5515},{38903,5,5516},{38906,0,5518},
+{38919,0,5519},{38922,0,5520},{38925,5,5522},{38932,0,5524},
+{38934,0,5525},{38937,0,5521},{38940,0,5526},{38942,0,5527},
+{38944,0,5528},{38947,0,5529},{38949,6,282},{38955,0,5531},
+{38958,9,5532},{38962,5,5535},{38965,0,5537},{38974,0,5539},
+{38980,0,5540},{38983,0,5541},{38986,0,5542},{38993,9,5543},
+{38998,5,5546},{39001,5,5548},{39010,5,5550},{39013,5,5552},
+{39018,0,5554},{39020,0,5555},{39083,0,5556},{39085,5,5557},
+{39088,0,5559},{39092,0,5560},{39095,5,5561},{39098,5,5563},
+{39103,0,5565},{39106,0,5566},{39109,0,5567},{39112,0,5568},
+{39116,0,5569},{39137,0,5570},{39139,0,5571},{39141,9,5572},
+{39146,0,5575},{39155,0,5576},{39158,0,5577},{39170,0,5578},
+{39175,5,5579},{39185,0,5581},{39189,9,5582},{39194,9,5585},
+{39199,0,5588},{39202,0,5589},{39206,5,5590},{39211,0,5592},
+{39217,17,5593},{39225,13,5598},{39232,5,5602},{39238,9,5604},
+{39245,5,5607},{39252,0,5609},{39256,5,5610},{39259,5,5612},
+{39262,9,5614},{39323,0,5617},{39325,0,5618},{39327,0,5619},
+{39334,0,5620},{39344,9,5621},{39349,0,5624},{39353,5,5625},
+{39357,0,5627},{39359,0,5628},{39363,0,5629},{39369,0,5630},
+{39379,5,5631},{39385,5,5633},{39388,0,5635},{39390,0,5636},
+{39399,0,5637},{39402,9,5638},{39408,0,5641},{39412,5,5642},
+{39417,0,5644},{39421,5,5645},{39426,9,5647},{39435,5,5650},
+{39440,5,5652},{39446,0,5654},{39454,0,5655},{39456,0,5656},
+{39458,9,5657},{39463,0,5660},{39469,5,5661},{39475,0,5663},
+{39477,5,5664},{39480,0,5666},{39489,0,5668},{39492,0,5669},
+{39495,0,5667},{39498,9,5670},{39502,0,5673},{39505,0,5674},
+{39508,0,5675},{39510,0,5676},{39517,0,5677},{39594,0,5678},
+{39596,0,5679},{39598,5,5680},{39602,0,5682},{39604,9,5683},
+{39609,0,5686},{39611,0,5687},{39614,5,5688},{39617,0,5690},
+{39619,0,5691},{39622,0,5692},{39624,0,5693},{39630,0,5694},
+{39632,0,5695},{39634,0,5696},{39637,9,5697},{39643,5,5700},
+{39648,0,5702},{39652,5,5703},{39655,0,5705},{39657,0,5706},
+{39660,0,5707},{39666,5,5708},{39669,0,5710},{39673,5,5711},
+{39677,0,5713},{39679,25,5714},{39688,5,5721},{39691,13,5723},
+{39696,0,5727},{39698,0,5728},{39702,0,5729},{39705,0,5730},
+{39707,5,5731},{39712,0,5733},{39718,0,5734},{39723,0,5735},
+{39725,0,5736},{39731,9,5737},{39735,0,5740},{39737,5,5741},
+{39741,0,5743},{39752,0,5744},{39755,5,5745},{39765,9,5747},
+{39771,0,5750},{39774,0,5751},{39777,0,5752},{39779,0,5753},
+{39781,5,5754},{39784,0,5756},{39786,17,5757},{39795,0,5762},
+{39797,0,5763},{39799,9,5764},{39807,5,5767},{39812,13,5769},
+{39817,9,5773},{39821,0,5776},{39823,5,5777},{39828,0,5779},
+{39834,0,5780},{39837,5,5781},{39846,5,5783},{39849,0,5785},
+{39852,0,5786},{39856,9,5787},{39863,5,5790},{39867,5,5792},
+{39870,5,5794},{39873,0,5796},{39879,5,5797},{39886,0,5799},
+{39888,0,5800},{39895,5,5801},{39901,0,5803},{39903,0,5804},
+{39909,0,5805},{39911,0,5806},{39914,5,5807},{39919,0,5809},
+{39923,0,5810},{39927,13,5811},{39933,0,5815},{39935,5,5816},
+{39938,0,5818},{39947,0,5819},{39951,0,5820},{39953,0,5821},
+{39958,0,5822},{39960,9,5823},{39964,0,5826},{39966,0,5827},
+{39970,5,5828},{39974,17,5830},{39985,0,5835},{39989,9,5836},
+{39997,0,5839},{40001,0,5840},{40003,9,5841},{40009,5,5844},
+{40014,9,5846},{40019,5,5849},{40022,0,5851},{40024,0,5852},
+{40027,6,284},{40029,9,5854},{40035,0,5857},{40040,0,5862},
+{40041,5,5858},{40043,0,5861},{40046,0,5863},{40048,0,5864},
+{40050,0,5865},{40053,0,5866},{40055,0,5867},{40059,0,5868},
+{40166,0,5869},{40178,0,5870},{40183,0,5871},{40185,0,5872},
+{40194,0,5874},{40203,0,5873},{40209,0,5875},{40215,5,5876},
+{40220,9,5878},{40239,5,5881},{40242,9,5883},{40250,0,5886},
+{40252,6,286},{40258,5,5890},{40261,0,5888},{40263,0,5892},
+{40266,0,5893},{40275,5,5894},{40287,0,5896},{40290,6,288},
+{40293,0,5899},{40297,9,5900},{40304,0,5903},{40310,5,5904},
+{40315,5,5906},{40318,0,5908},{40323,5,5909},{40326,0,5911},
+{40330,0,5912},{40333,5,5913},{40338,5,5915},{40341,13,5917},
+{40353,0,5921},{40362,0,5922},{40364,0,5923},{40366,0,5924},
+{40369,0,5925},{40373,0,5926},{40377,0,5927},{40380,0,5928},
+{40383,0,5929},{40387,0,5930},{40391,0,5931},{40393,5,5932},
+{40404,13,5934},{40410,0,5938},{40414,9,5939},{40421,0,5942},
+{40423,0,5943},{40425,0,5944},{40427,0,5945},{40430,0,5946},
+{40432,0,5947},{40435,5,5948},{40446,0,5950},{40450,0,5952},
+{40455,0,5953},{40458,0,5951},{40462,0,5954},{40464,9,5955},
+{40469,5,5958},{40473,0,5960},{40476,5,5961},{40570,9,5963},
+{40576,0,5966},{40578,13,5967},{40583,0,5971},{40590,5,5972},
+{40598,0,5974},{40600,0,5975},{40603,0,5976},{40606,0,5977},
+{40612,0,5978},{40616,0,5979},{40620,0,5980},{40622,9,5981},
+{40627,9,5984},{40646,0,5987},{40648,0,5988},{40651,0,5989},
+{40661,0,5990},{40671,0,5991},{40676,0,5992},{40679,0,5993},
+{40684,9,5994},{40688,9,5997},{40693,0,6000},{40696,0,6001},
+{40703,0,6002},{40706,5,6003},{40713,0,6005},{40719,13,6006},
+{40724,0,6010},{40726,5,6011},{40729,9,6013},{40735,0,6016},
+{40738,0,6017},{40742,0,6018},{40746,5,6019},{40751,0,6021},
+{40753,5,6022},{40756,0,6024},{40759,0,6025},{40761,5,6026},
+{40764,5,6028},{40767,0,6030},{40769,0,6031},{40771,17,6032},
+{40787,0,6037},{40789,13,6038},{40794,0,6042},{40797,5,6043},
+{40808,5,6045},{40813,17,6047},{40819,0,6052},{40821,0,6053},
+{40826,0,6054},{40829,0,6055},{40847,13,6056},{40852,0,6060},
+{40854,5,6061},{40862,0,6063},{40865,9,6064},{40869,0,6067},
+};
+
+static const unsigned short cmap_UniHojo_UTF16_H_table[290] = {
+17,16,18,6,14,97,96,99,105,98,104,69,
+109,113,112,115,114,126,125,128,127,142,144,143,
+146,150,145,76,161,160,163,162,176,79,93,183,
+182,185,191,184,190,80,195,199,198,201,200,212,
+211,214,213,82,227,229,228,231,235,230,91,246,
+245,248,247,261,95,262,102,188,100,186,103,189,
+106,192,107,193,110,196,108,194,111,197,70,81,
+118,204,117,203,119,205,116,202,120,207,121,208,
+123,209,122,124,210,71,83,133,218,131,216,132,
+217,130,84,72,85,134,219,135,220,86,136,221,
+138,223,137,222,74,88,73,87,139,224,141,226,
+140,225,89,75,90,149,234,148,233,77,92,151,
+236,153,238,152,237,154,239,155,240,157,242,156,
+241,159,244,158,243,78,94,170,255,167,252,164,
+249,169,254,166,251,168,253,175,260,178,263,177,
+179,264,181,266,180,265,101,187,129,215,147,232,
+165,250,174,259,171,256,173,258,172,257,1,4,
+8,7,28,30,36,26,29,35,40,37,39,42,
+1481,1512,2385,2387,2652,3735,3734,346,329,491,503,666,
+665,979,988,1413,1415,1444,1443,1505,1507,2000,2002,1993,
+1996,2001,2035,1989,2099,2098,2285,2284,3095,3089,3096,3301,
+3296,3726,3725,3894,3891,4056,3999,4045,4070,4236,1088,4237,
+4391,4387,4621,4616,4702,4701,4745,4763,4846,4840,4963,4965,
+5269,5275,5340,5339,5509,5511,5538,5530,5853,5860,5887,5889,
+5898,5897,
+};
+
+static pdf_cmap cmap_UniHojo_UTF16_H = {
+	-1, "UniHojo-UTF16-H", "", 0, 0, 3,
+	{ {2,0,55295},{4,56320,57343},{2,57344,65535}, },
+	4004, 4004, (pdf_range*) cmap_UniHojo_UTF16_H_ranges,
+	290, 290, (unsigned short*) cmap_UniHojo_UTF16_H_table,
+};
+
+/* UniHojo-UTF16-V */
+
+static const pdf_range cmap_UniHojo_UTF16_V_ranges[] = { {0,1,0}
+};
+
+static const unsigned short cmap_UniHojo_UTF16_V_table[] = { 0 };
+
+static pdf_cmap cmap_UniHojo_UTF16_V = {
+	-1, "UniHojo-UTF16-V", "UniHojo-UTF16-H", 0, 1, 0,
+	{ {0,0,0}, },
+	0, 0, (pdf_range*) cmap_UniHojo_UTF16_V_ranges,
+	0, 0, (unsigned short*) cmap_UniHojo_UTF16_V_table,
+};
+
+/* UniJIS-UCS2-H */
+
+static const pdf_range cmap_UniJIS_UCS2_H_ranges[] = {
+{32,237,1},{92,0,97},{93,133,62},{161,9,101},
+{164,54,0},{178,5,157},{180,30,14},{188,9,161},
+{191,0,126},{192,21,164},{198,0,139},{199,61,170},
+{215,6,22},{217,21,187},{223,0,150},{224,21,193},
+{230,0,145},{231,61,199},{247,6,24},{249,25,216},
+{256,6,26},{274,6,28},{282,6,30},{295,18,32},
+{305,0,146},{321,6,37},{331,10,39},{338,6,42},
+{352,6,44},{360,14,46},{366,6,50},{376,0,224},
+{381,6,52},{448,0,99},{461,30,54},{509,0,9421},
+{593,0,9418},{596,0,9423},{601,10,62},{629,0,9437},
+{643,0,9442},{652,0,9438},{658,0,9441},{720,0,9443},
+{768,0,65},{769,5,127},{771,10,65},{774,9,130},
+{778,10,68},{807,6,71},{818,0,64},{822,0,138},
+{865,0,758},{913,65,1011},{931,25,1028},{945,65,1035},
+{963,25,1052},{976,6,73},{987,0,12095},{1025,0,1065},
+{1040,21,1059},{1046,125,1066},{1078,101,1099},{1105,0,1098},
+{1115,0,12092},{7868,6,75},{8194,6,77},{8208,26,79},
+{8216,5,670},{8218,0,120},{8220,5,672},{8222,0,121},
+{8224,5,776},{8226,0,119},{8229,6,86},{8240,0,772},
+{8242,5,708},{8249,5,110},{8251,6,88},{8254,0,325},
+{8260,0,104},{8265,0,12112},{8304,0,9377},{8308,21,9378},
+{8320,37,9384},{8364,0,9354},{8413,0,779},{8448,0,11855},
+{8451,0,710},{8453,0,11859},{8457,6,90},{8463,0,12092},
+{8467,0,8025},{8470,0,7610},{8481,6,92},{8486,0,9355},
+{8491,0,771},{8501,0,12089},{8531,5,9375},{8539,13,9371},
+{8544,37,7575},{8554,5,8225},{8560,37,8092},{8570,5,8298},
+{8575,0,8303},{8592,5,737},{8594,14,94},{8598,5,12204},
+{8600,5,12202},{8644,5,8310},{8646,0,8309},{8652,0,12206},
+{8656,0,12200},{8658,0,752},{8660,0,753},{8678,14,98},
+{8704,0,754},{8706,6,102},{8709,0,12184},{8711,6,104},
+{8714,6,106},{8721,10,108},{8730,0,765},{8733,14,111},
+{8741,0,666},{8743,5,749},{8745,6,115},{8747,5,769},
+{8749,6,117},{8756,6,119},{8764,6,121},{8771,0,12120},
+{8786,0,762},{8800,6,123},{8806,5,701},{8810,5,763},
+{8818,5,12121},{8834,5,745},{8838,5,743},{8853,14,125},
+{8861,6,129},{8864,0,12185},{8869,0,757},{8895,0,7630},
+{8942,6,131},{8960,0,12184},{8967,0,12219},{8978,0,758},
+{9290,0,12116},{9312,77,7555},{9332,77,8071},{9352,33,8062},
+{9372,101,8112},{9398,101,10339},{9424,101,10313},{9450,0,8224},
+{9472,301,7479},{9552,0,8251},{9566,0,8252},{9569,0,8254},
+{9578,0,8253},{9581,5,8247},{9583,6,133},{9585,9,8261},
+{9601,29,8230},{9609,26,135},{9620,5,8245},{9632,10,142},
+{9642,6,145},{9650,6,147},{9654,6,149},{9660,6,151},
+{9664,6,153},{9670,6,155},{9673,0,8210},{9675,6,157},
+{9678,6,159},{9698,5,8255},{9700,10,161},{9711,0,779},
+{9728,13,8215},{9733,6,164},{9742,0,8056},{9746,0,12185},
+{9756,5,8220},{9758,6,166},{9792,0,706},{9794,0,705},
+{9824,30,168},{9832,5,12098},{9834,0,775},{9836,6,176},
+{9839,0,773},{9986,0,12176},{10010,0,12241},{10070,0,12259},
+{10102,33,8286},{10145,0,8206},{11907,0,14305},{11909,0,13856},
+{11911,0,14105},{11913,0,14356},{11915,0,14110},{11916,5,13833},
+{11918,10,178},{11922,30,181},{11931,0,5089},{11935,6,189},
+{11937,5,14689},{11939,6,191},{11942,0,14157},{11944,26,193},
+{11953,10,200},{11959,0,14078},{11961,0,14099},{11964,6,203},
+{11966,9,14197},{11969,14,205},{11974,0,13682},{11978,0,13898},
+{11980,6,209},{11983,0,15262},{11985,6,211},{11990,10,213},
+{11997,10,216},{12004,0,1614},{12008,6,219},{12011,0,2666},
+{12013,0,2243},{12015,0,3965},{12018,0,1615},{12032,78,221},
+{12052,5,4301},{12054,42,241},{12065,5,4538},{12067,622,252},
+{12223,5,7299},{12225,62,408},{12241,5,7457},{12243,0,3966},
+{12244,5,7472},{12288,9,633},{12291,6,424},{12293,9,657},
+{12296,37,682},{12306,6,426},{12308,5,676},{12316,6,428},
+{12319,6,430},{12336,0,12218},{12339,9,12108},{12342,0,8057},
+{12353,329,842},{12436,0,7958},{12443,5,643},{12445,5,653},
+{12449,341,925},{12535,13,8313},{12539,6,432},{12541,5,651},
+{12832,37,10126},{12842,21,8198},{12848,0,8197},{12849,5,7618},
+{12851,66,434},{12928,37,10461},{12938,21,10472},{12944,62,451},
+{12960,5,10486},{12962,6,467},{12964,17,7613},{12969,30,469},
+{13008,185,10413},{13056,0,8048},{13057,5,11874},{13059,42,477},
+{13070,21,11889},{13076,22,488},{13082,13,11900},{13086,0,8051},
+{13087,9,11904},{13090,22,494},{13096,5,11912},{13098,6,500},
+{13101,0,11915},{13102,9,11918},{13105,10,502},{13108,5,11924},
+{13110,30,505},{13118,9,11936},{13121,6,513},{13123,13,11939},
+{13127,14,515},{13131,5,11944},{13133,6,519},{13135,5,11946},
+{13137,14,521},{13141,5,11955},{13143,0,8044},{13169,0,11861},
+{13179,18,525},{13189,9,8031},{13192,5,8192},{13197,0,11864},
+{13198,5,7604},{13200,0,8035},{13206,10,530},{13211,0,11865},
+{13212,9,7601},{13215,18,533},{13220,5,8022},{13222,0,8188},
+{13232,14,538},{13250,0,11856},{13252,0,7606},{13256,0,8194},
+{13259,10,542},{13268,0,8036},{13271,5,11869},{13274,0,11851},
+{13314,0,13698},{13317,0,15387},{13351,0,13910},{13448,0,15442},
+{13531,0,15425},{13599,0,13865},{13630,0,14110},{14221,0,13850},
+{14306,0,14123},{15091,0,15424},{15138,0,15433},{15240,0,13965},
+{16010,0,15427},{16090,0,15432},{16305,0,14164},{16531,0,15436},
+{16643,0,15439},{16996,0,14176},{17043,0,15440},{17420,0,15426},
+{17491,0,14195},{17786,0,15435},{18021,0,15438},{18094,0,15441},
+{19432,0,15430},{19968,6,545},{19971,0,2275},{19972,5,14296},
+{19975,18,547},{19981,6,552},{19984,6,554},{19988,22,556},
+{19998,6,562},{20001,0,3974},{20006,0,3602},{20008,0,8371},
+{20010,14,564},{20015,5,14300},{20017,6,568},{20022,14,570},
+{20027,6,574},{20031,0,4097},{20032,5,14302},{20034,14,576},
+{20040,0,14126},{20043,0,3309},{20045,10,580},{20053,22,583},
+{20061,10,589},{20066,0,4659},{20081,0,3930},{20083,0,3285},
+{20094,10,592},{20098,0,4101},{20101,6,595},{20104,26,597},
+{20113,6,604},{20116,10,606},{20120,6,609},{20123,6,611},
+{20126,9,4108},{20129,6,613},{20132,10,615},{20136,0,1686},
+{20139,5,1687},{20141,6,618},{20144,0,4112},{20147,0,4113},
+{20150,0,4114},{20153,10,620},{20160,10,623},{20164,0,4117},
+{20166,6,626},{20170,6,628},{20173,14,630},{20180,22,634},
+{20189,18,640},{20195,10,645},{20205,6,648},{20208,0,1724},
+{20210,0,2981},{20214,6,650},{20219,10,652},{20223,10,655},
+{20227,0,8375},{20233,10,658},{20237,18,661},{20245,0,14315},
+{20250,0,1393},{20252,6,666},{20271,6,668},{20276,0,3408},
+{20278,0,4010},{20280,22,670},{20291,0,3053},{20294,6,676},
+{20297,0,14318},{20301,18,678},{20307,18,683},{20313,22,688},
+{20320,0,14316},{20329,0,4137},{20335,6,694},{20339,0,1346},
+{20341,6,696},{20346,10,698},{20349,5,14321},{20351,0,2198},
+{20355,0,1506},{20358,0,4141},{20360,0,4133},{20362,6,701},
+{20365,0,2246},{20367,0,4134},{20369,6,703},{20372,0,8381},
+{20374,10,705},{20378,6,708},{20381,0,1169},{20384,6,710},
+{20395,0,4564},{20397,10,712},{20405,6,715},{20414,6,717},
+{20418,10,719},{20425,6,722},{20429,18,724},{20435,6,729},
+{20439,6,731},{20442,6,733},{20445,0,3629},{20447,10,735},
+{20451,0,3745},{20452,5,4152},{20462,6,738},{20467,0,3334},
+{20469,6,740},{20472,0,3648},{20474,0,1334},{20477,10,742},
+{20480,5,14327},{20482,0,13383},{20485,6,745},{20489,0,2772},
+{20491,0,1912},{20493,0,3346},{20495,14,747},{20500,0,4156},
+{20502,0,1962},{20505,10,751},{20510,6,754},{20513,54,756},
+{20534,0,1758},{20537,0,1862},{20539,0,14336},{20544,0,8383},
+{20546,6,770},{20550,14,772},{20559,6,776},{20565,10,778},
+{20570,0,4175},{20572,0,3072},{20581,6,781},{20586,0,14335},
+{20588,0,4177},{20592,0,8388},{20594,0,2289},{20596,10,783},
+{20600,0,4178},{20605,0,1616},{20608,0,4179},{20613,0,4181},
+{20621,0,3683},{20623,0,14337},{20625,0,1852},{20628,0,8390},
+{20630,0,14338},{20632,10,786},{20636,0,14339},{20652,6,789},
+{20658,14,791},{20663,0,2439},{20670,0,1807},{20674,0,4187},
+{20677,0,1735},{20681,5,4184},{20684,6,795},{20687,0,2814},
+{20689,0,1691},{20693,6,797},{20696,10,799},{20702,0,4189},
+{20707,0,4192},{20709,10,802},{20713,0,14342},{20717,14,805},
+{20724,6,809},{20729,0,4194},{20731,0,3608},{20736,0,1617},
+{20737,5,4197},{20740,0,1327},{20744,6,811},{20747,0,14345},
+{20752,0,14346},{20754,0,2336},{20756,10,813},{20760,0,4143},
+{20762,6,816},{20766,6,818},{20769,0,4203},{20778,0,3855},
+{20786,0,3813},{20791,0,4205},{20794,10,820},{20799,5,4208},
+{20801,0,1208},{20803,46,823},{20816,0,2247},{20818,0,4210},
+{20820,0,4212},{20826,0,3160},{20828,0,1491},{20831,0,14349},
+{20834,0,4213},{20836,6,835},{20839,6,837},{20841,5,4215},
+{20843,14,839},{20849,0,1694},{20853,18,843},{20860,0,1865},
+{20864,0,4218},{20866,0,4219},{20869,6,848},{20873,6,850},
+{20876,6,852},{20879,18,854},{20885,5,4226},{20887,0,2513},
+{20889,0,2296},{20893,0,8395},{20896,10,859},{20900,10,862},
+{20904,0,3532},{20905,9,4231},{20908,0,3161},{20912,0,4237},
+{20913,5,4235},{20915,18,865},{20924,10,870},{20931,14,873},
+{20937,0,4241},{20939,10,877},{20950,0,4314},{20955,14,880},
+{20960,6,884},{20966,6,886},{20969,6,888},{20972,10,890},
+{20976,6,893},{20980,10,895},{20984,10,898},{20989,6,901},
+{20992,0,3163},{20993,5,14355},{20995,6,903},{20998,10,905},
+{21002,6,908},{21006,0,4253},{21009,0,1808},{21011,10,910},
+{21015,0,4027},{21021,0,2419},{21028,6,913},{21031,0,4254},
+{21033,6,915},{21038,0,4256},{21040,0,3192},{21043,0,4257},
+{21046,22,917},{21059,6,923},{21063,0,2823},{21065,6,925},
+{21067,5,4261},{21069,0,2738},{21071,0,4259},{21076,0,4264},
+{21078,0,3684},{21083,0,2038},{21085,6,927},{21089,0,14359},
+{21091,14,929},{21097,6,933},{21103,26,935},{21117,0,4270},
+{21119,0,4269},{21123,0,1442},{21127,10,942},{21133,0,4271},
+{21137,14,945},{21147,6,949},{21151,6,951},{21155,0,4028},
+{21158,0,8400},{21161,10,953},{21164,5,4279},{21167,0,8573},
+{21169,0,4013},{21172,6,956},{21177,0,1966},{21180,0,4281},
+{21182,0,1421},{21184,6,958},{21187,0,3716},{21189,0,3032},
+{21191,10,960},{21197,0,4284},{21200,0,14056},{21202,0,7150},
+{21205,0,3208},{21207,10,963},{21211,0,8402},{21213,14,966},
+{21218,10,970},{21222,6,973},{21232,0,14363},{21234,6,975},
+{21237,0,4292},{21240,5,4293},{21242,0,2311},{21246,18,977},
+{21253,14,982},{21258,5,14364},{21261,0,4298},{21263,6,986},
+{21269,10,988},{21273,6,991},{21277,0,2779},{21280,6,993},
+{21283,6,995},{21290,0,3439},{21295,0,4304},{21297,0,4305},
+{21299,0,4306},{21304,14,997},{21310,14,1001},{21315,0,2701},
+{21317,34,1005},{21329,14,1014},{21335,6,1018},{21338,0,3364},
+{21340,0,3708},{21342,0,4315},{21344,6,1020},{21350,0,1803},
+{21353,0,4316},{21356,0,14370},{21358,30,1022},{21367,6,1030},
+{21371,0,4319},{21373,0,13365},{21375,0,1698},{21378,0,4321},
+{21380,0,3837},{21385,0,14288},{21395,0,8407},{21398,0,4322},
+{21400,0,3994},{21402,0,1968},{21407,6,1032},{21413,6,1034},
+{21416,6,1036},{21419,0,14371},{21421,6,1038},{21424,0,4327},
+{21426,6,1040},{21430,0,4328},{21435,0,1672},{21442,6,1042},
+{21448,26,1044},{21460,0,2385},{21462,6,1051},{21465,10,1053},
+{21469,0,8409},{21471,0,4332},{21473,22,1056},{21480,46,1062},
+{21493,14,1074},{21498,0,4338},{21505,0,4339},{21507,6,1078},
+{21512,38,1080},{21531,0,1797},{21533,0,4348},{21535,6,1090},
+{21542,6,1092},{21545,0,4347},{21547,0,1562},{21548,5,4342},
+{21550,0,4345},{21555,0,13760},{21558,0,4346},{21560,6,1094},
+{21563,22,1096},{21570,0,4042},{21574,0,3650},{21576,10,1102},
+{21581,6,1105},{21585,0,3253},{21589,0,14115},{21599,0,4353},
+{21606,0,14377},{21608,0,2346},{21610,6,1107},{21616,6,1109},
+{21619,18,1111},{21627,10,1116},{21632,0,4359},{21636,0,4361},
+{21638,0,4363},{21642,26,1119},{21650,0,4357},{21654,0,14381},
+{21660,0,8411},{21665,6,1126},{21668,6,1128},{21672,6,1130},
+{21675,10,1132},{21679,0,4401},{21682,6,1135},{21688,6,1137},
+{21692,26,1139},{21700,0,4369},{21702,14,1146},{21709,0,14387},
+{21720,0,4377},{21729,6,1150},{21733,5,4378},{21736,6,1152},
+{21741,6,1154},{21746,0,3113},{21754,0,4385},{21757,0,4382},
+{21759,0,8414},{21764,0,1238},{21766,6,1156},{21774,10,1158},
+{21780,0,4381},{21782,0,1126},{21803,0,14389},{21806,6,1161},
+{21809,0,2447},{21811,0,4397},{21813,0,14390},{21816,6,1163},
+{21822,0,2851},{21824,0,4388},{21828,10,1165},{21834,0,14391},
+{21836,0,4390},{21839,0,3824},{21843,0,1810},{21846,5,4394},
+{21852,10,1168},{21856,5,14392},{21859,0,4389},{21883,6,1171},
+{21886,0,4405},{21888,0,4400},{21891,6,1173},{21894,22,1175},
+{21902,0,14395},{21912,10,1181},{21916,14,1184},{21927,22,1188},
+{21934,0,4408},{21936,0,1772},{21942,0,1254},{21956,6,1194},
+{21959,0,4472},{21972,0,4420},{21978,0,4414},{21980,0,4418},
+{21983,0,4416},{21987,6,1196},{22007,0,4422},{22009,0,4427},
+{22013,6,1198},{22022,0,2928},{22024,6,1200},{22030,5,14397},
+{22036,0,4421},{22038,10,1202},{22043,0,4426},{22048,0,15389},
+{22057,0,1374},{22063,0,4437},{22065,6,1205},{22068,0,4431},
+{22070,10,1207},{22079,0,14400},{22082,0,1247},{22089,0,14401},
+{22091,6,1210},{22094,10,1212},{22099,0,7963},{22107,0,1496},
+{22116,0,4436},{22118,0,14404},{22120,18,1215},{22127,0,14406},
+{22129,5,14407},{22132,0,3582},{22134,0,15411},{22136,0,3245},
+{22138,0,3404},{22144,0,4441},{22150,6,1220},{22154,0,4442},
+{22159,0,4445},{22164,6,1222},{22169,6,1224},{22176,0,4443},
+{22178,0,3311},{22181,0,4446},{22188,5,14411},{22190,0,4447},
+{22193,0,14413},{22196,0,4449},{22198,0,4448},{22204,0,4451},
+{22208,14,1226},{22216,10,1230},{22222,0,4456},{22225,0,4457},
+{22227,0,4458},{22231,6,1233},{22234,6,1235},{22237,6,1237},
+{22240,0,1212},{22243,6,1239},{22254,0,4460},{22256,0,2068},
+{22258,6,1241},{22265,6,1243},{22269,0,2051},{22271,6,1245},
+{22275,6,1247},{22280,14,1249},{22285,0,4468},{22287,0,1869},
+{22290,6,1253},{22293,6,1255},{22296,0,4470},{22300,0,4473},
+{22303,0,3156},{22305,0,13952},{22307,0,14419},{22310,10,1257},
+{22317,0,1811},{22319,6,1260},{22323,5,14421},{22327,5,4475},
+{22331,0,4478},{22336,0,4479},{22338,0,2132},{22343,0,1737},
+{22346,0,3685},{22348,0,14423},{22350,14,1262},{22361,0,8416},
+{22369,0,4484},{22372,10,1266},{22377,6,1269},{22384,0,14424},
+{22399,0,4485},{22402,0,2600},{22408,6,1271},{22411,6,1273},
+{22419,0,4487},{22428,0,14426},{22432,0,4488},{22434,10,1275},
+{22442,0,4491},{22444,0,8418},{22448,0,4492},{22451,0,4489},
+{22456,0,14427},{22464,0,4482},{22467,0,4493},{22470,10,1278},
+{22475,0,3730},{22478,0,2515},{22482,5,4496},{22484,0,4495},
+{22486,0,4499},{22492,0,3310},{22495,6,1281},{22499,0,4500},
+{22502,0,14428},{22509,0,14429},{22516,0,2533},{22517,5,14430},
+{22519,0,2277},{22521,6,1283},{22524,0,2139},{22527,6,1285},
+{22530,0,3210},{22533,6,1287},{22537,10,1289},{22549,0,2852},
+{22553,0,4502},{22557,0,4503},{22560,6,1292},{22564,0,3077},
+{22570,0,1514},{22575,14,1294},{22580,6,1298},{22586,0,2134},
+{22589,0,4511},{22592,6,1300},{22602,6,1302},{22609,6,1304},
+{22612,0,3165},{22615,14,1306},{22622,0,2105},{22625,6,1310},
+{22633,0,1304},{22635,0,3120},{22640,0,4508},{22642,0,4504},
+{22645,0,2582},{22649,0,4512},{22652,0,14436},{22654,0,2392},
+{22656,0,14437},{22659,0,1701},{22661,0,4513},{22675,0,3640},
+{22679,0,2815},{22684,0,3042},{22686,6,1312},{22696,6,1314},
+{22699,0,4516},{22702,0,4521},{22706,6,1316},{22712,14,1318},
+{22718,0,2070},{22721,0,3609},{22725,0,4522},{22727,0,2947},
+{22730,0,1397},{22732,0,2517},{22734,0,14439},{22736,6,1322},
+{22739,10,1324},{22743,14,1327},{22748,0,4529},{22750,6,1331},
+{22756,6,1333},{22761,0,14443},{22763,6,1335},{22766,18,1337},
+{22775,0,3063},{22777,6,1342},{22779,9,4535},{22786,0,4538},
+{22793,14,1344},{22799,6,1348},{22805,6,1350},{22808,18,1352},
+{22818,0,3776},{22820,6,1357},{22823,0,2887},{22825,10,1359},
+{22828,5,4544},{22830,6,1362},{22833,6,1364},{22839,10,1366},
+{22846,0,4548},{22852,0,1284},{22855,10,1369},{22862,14,1372},
+{22867,10,1376},{22871,6,1379},{22874,6,1381},{22877,0,8428},
+{22880,14,1383},{22885,0,1310},{22887,14,1387},{22892,10,1391},
+{22899,6,1394},{22904,0,4560},{22909,0,1975},{22913,14,1396},
+{22922,0,3291},{22925,0,4570},{22931,0,1618},{22934,0,3887},
+{22937,0,3771},{22939,0,4665},{22941,0,4562},{22947,10,1400},
+{22952,0,3686},{22956,0,3140},{22962,0,4566},{22969,10,1403},
+{22974,0,2450},{22982,0,4567},{22985,10,1406},{22992,18,1409},
+{23001,5,4571},{23004,6,1414},{23011,5,14452},{23013,6,1416},
+{23016,0,4568},{23018,10,1418},{23030,0,1132},{23035,0,1213},
+{23039,0,2207},{23041,0,1174},{23043,6,1421},{23049,0,4577},
+{23052,0,14455},{23057,0,4575},{23064,0,3784},{23066,10,1423},
+{23071,6,1426},{23075,0,14456},{23077,0,4573},{23081,0,3626},
+{23087,0,1944},{23093,5,4582},{23100,0,2451},{23104,6,1428},
+{23110,6,1430},{23113,0,4581},{23125,0,14458},{23130,0,2071},
+{23138,6,1432},{23142,0,3530},{23146,0,4585},{23148,6,1434},
+{23166,6,1436},{23186,0,3348},{23194,6,1438},{23198,0,14462},
+{23207,0,14463},{23212,0,14464},{23219,0,14465},{23228,10,1440},
+{23233,6,1443},{23241,0,2279},{23243,6,1445},{23248,0,4603},
+{23254,6,1447},{23264,6,1449},{23267,0,4592},{23270,0,4594},
+{23273,0,4595},{23290,5,4597},{23296,0,14467},{23305,0,1582},
+{23307,6,1451},{23318,0,4601},{23321,0,14468},{23330,0,2518},
+{23333,0,14469},{23338,0,4604},{23340,6,1453},{23344,0,1255},
+{23346,0,4602},{23350,0,4605},{23358,0,4606},{23360,6,1455},
+{23363,0,4607},{23365,0,4608},{23376,6,1457},{23380,18,1459},
+{23386,5,4612},{23388,6,1464},{23391,0,3806},{23395,14,1466},
+{23401,0,4615},{23403,0,2841},{23408,6,1470},{23411,0,4617},
+{23413,0,4618},{23416,0,4619},{23418,0,4621},{23420,0,14472},
+{23422,5,14473},{23424,0,4622},{23426,6,1472},{23429,0,2896},
+{23431,26,1474},{23439,0,1978},{23445,0,3168},{23447,26,1481},
+{23455,0,2286},{23458,18,1488},{23470,0,1654},{23472,0,2107},
+{23475,14,1493},{23480,6,1497},{23487,6,1499},{23490,22,1501},
+{23497,0,4628},{23500,0,3531},{23504,0,4630},{23506,10,1507},
+{23512,0,8435},{23515,0,1518},{23517,10,1510},{23521,6,1513},
+{23524,22,1515},{23531,6,1521},{23534,0,3976},{23536,0,4637},
+{23539,0,4639},{23541,6,1523},{23544,0,2631},{23546,0,2249},
+{23550,6,1525},{23553,6,1527},{23556,10,1529},{23559,5,4641},
+{23561,10,1532},{23565,10,1535},{23569,0,2455},{23571,6,1538},
+{23574,0,2705},{23577,6,1540},{23582,0,8437},{23584,0,4645},
+{23586,10,1542},{23592,0,4647},{23595,0,14477},{23597,0,1726},
+{23600,6,1545},{23608,5,4648},{23610,30,1547},{23621,6,1555},
+{23624,0,1782},{23626,6,1557},{23629,18,1559},{23635,0,4653},
+{23637,0,3122},{23643,0,7826},{23646,0,2832},{23648,22,1564},
+{23657,0,14480},{23660,0,4657},{23662,6,1570},{23665,0,2177},
+{23670,0,4660},{23673,0,4661},{23676,0,14481},{23692,0,4662},
+{23696,6,1572},{23700,0,4664},{23713,0,1324},{23718,0,8438},
+{23720,6,1574},{23723,6,1576},{23729,0,2866},{23731,0,1463},
+{23734,10,1578},{23738,10,1581},{23742,0,4672},{23749,0,4671},
+{23751,0,4673},{23755,0,14482},{23762,0,14483},{23769,0,4674},
+{23776,6,1584},{23782,0,14124},{23784,10,1586},{23789,0,4678},
+{23791,6,1589},{23796,10,1591},{23802,6,1594},{23805,0,4676},
+{23815,0,2616},{23819,0,4681},{23822,0,2138},{23825,0,4687},
+{23828,30,1596},{23839,0,4685},{23842,0,4689},{23844,0,14485},
+{23846,6,1604},{23849,0,3656},{23874,6,1606},{23878,0,14488},
+{23882,10,1608},{23886,0,4695},{23888,0,3932},{23890,6,1611},
+{23900,0,4684},{23913,0,2617},{23916,6,1613},{23919,0,2087},
+{23923,0,4698},{23926,0,4699},{23938,0,4702},{23940,0,4701},
+{23943,0,4700},{23947,6,1615},{23952,0,4708},{23954,0,14490},
+{23956,0,14491},{23961,0,14492},{23965,0,4704},{23968,0,14493},
+{23970,0,4703},{23980,0,4705},{23982,0,4706},{23986,0,15269},
+{23991,0,4709},{23992,5,8446},{23994,0,4014},{23996,6,1617},
+{24009,0,4711},{24012,6,1619},{24016,0,8448},{24018,6,1621},
+{24022,0,4715},{24024,0,14494},{24027,0,4716},{24029,6,1623},
+{24032,14,1625},{24037,14,1629},{24043,0,4717},{24046,0,2089},
+{24049,18,1633},{24055,6,1638},{24059,0,1512},{24061,14,1640},
+{24066,6,1644},{24070,0,3413},{24075,6,1646},{24081,6,1648},
+{24084,5,14499},{24086,0,3005},{24088,14,1650},{24093,0,3079},
+{24101,0,2601},{24107,0,2211},{24109,14,1654},{24115,0,3006},
+{24118,5,4725},{24120,0,2519},{24125,0,3687},{24128,0,4729},
+{24131,10,1658},{24135,0,4736},{24140,0,3720},{24142,0,4730},
+{24148,6,1661},{24151,6,1663},{24159,0,4733},{24161,14,1665},
+{24171,5,14504},{24178,10,1669},{24181,5,4737},{24184,30,1672},
+{24193,0,3007},{24195,6,1680},{24199,0,3443},{24202,0,2458},
+{24207,0,2434},{24213,10,1682},{24217,6,1685},{24220,0,3534},
+{24224,0,4742},{24230,10,1687},{24234,6,1690},{24237,0,3081},
+{24245,14,1692},{24254,5,14508},{24257,5,4743},{24259,0,3335},
+{24264,14,1696},{24271,6,1700},{24274,6,1702},{24278,0,4748},
+{24282,5,4751},{24285,0,4750},{24287,18,1704},{24296,5,4755},
+{24300,0,4757},{24304,6,1709},{24307,6,1711},{24310,10,1713},
+{24314,10,1716},{24318,6,1719},{24321,0,3627},{24323,6,1721},
+{24327,0,14512},{24329,34,1723},{24339,22,1732},{24347,0,2958},
+{24348,5,14514},{24351,0,3083},{24353,6,1738},{24357,18,1740},
+{24365,0,4772},{24367,0,4778},{24369,0,2321},{24372,18,1745},
+{24378,10,1750},{24382,0,2948},{24384,6,1753},{24389,0,8370},
+{24392,0,4775},{24394,0,1704},{24396,0,4776},{24398,0,4777},
+{24400,6,1755},{24403,0,3184},{24406,5,4780},{24408,6,1757},
+{24412,6,1759},{24417,6,1761},{24420,14,1763},{24425,18,1767},
+{24432,6,1772},{24435,0,4785},{24439,0,4786},{24441,0,3838},
+{24444,0,3444},{24447,26,1774},{24455,22,1781},{24464,14,1787},
+{24471,10,1791},{24476,0,14525},{24478,0,4794},{24480,6,1794},
+{24484,0,14527},{24487,14,1796},{24493,10,1800},{24499,10,1803},
+{24503,10,1806},{24508,6,1809},{24515,10,1811},{24521,0,14531},
+{24524,6,1814},{24534,6,1816},{24536,5,3688},{24540,10,1818},
+{24544,6,1821},{24548,0,4803},{24553,0,14533},{24555,0,1399},
+{24557,0,14534},{24560,6,1823},{24565,0,3302},{24568,0,4804},
+{24571,10,1825},{24575,0,4808},{24590,10,1828},{24594,0,3158},
+{24597,10,1831},{24601,18,1834},{24608,6,1839},{24613,26,1841},
+{24623,0,1705},{24625,0,4815},{24627,0,14538},{24634,0,4821},
+{24641,10,1848},{24646,0,4828},{24650,6,1851},{24653,0,4829},
+{24656,0,1706},{24658,0,1987},{24661,0,2436},{24665,6,1853},
+{24669,0,8454},{24671,26,1855},{24680,22,1862},{24687,6,1868},
+{24693,0,1817},{24695,0,4825},{24703,0,14540},{24705,0,4837},
+{24707,10,1870},{24713,18,1873},{24722,0,4846},{24724,0,1401},
+{24726,5,4844},{24730,6,1878},{24734,10,1880},{24739,6,1883},
+{24742,6,1885},{24745,6,1887},{24752,0,14543},{24754,18,1889},
+{24760,0,4850},{24764,6,1894},{24773,10,1896},{24779,0,14544},
+{24785,0,4077},{24787,0,4852},{24789,0,8458},{24792,0,4858},
+{24794,10,1899},{24798,14,1902},{24803,0,2780},{24807,6,1906},
+{24816,18,1908},{24822,5,4862},{24824,14,1913},{24832,6,1917},
+{24835,0,4867},{24838,0,4861},{24840,6,1919},{24845,5,4871},
+{24847,0,1177},{24849,0,8461},{24850,9,14547},{24853,0,4860},
+{24858,10,1921},{24863,10,1924},{24871,6,1927},{24876,0,4880},
+{24880,0,8463},{24884,0,4881},{24887,0,8462},{24892,14,1929},
+{24898,0,4883},{24900,0,4884},{24903,6,1933},{24906,18,1935},
+{24915,0,4897},{24917,0,3641},{24920,9,4887},{24925,0,4896},
+{24927,0,4895},{24930,6,1940},{24933,0,4893},{24935,6,1942},
+{24939,0,4890},{24942,14,1944},{24947,18,1948},{24956,0,14551},
+{24958,0,3911},{24962,0,3861},{24967,0,4901},{24970,0,4905},
+{24973,6,1953},{24976,6,1955},{24980,0,4903},{24982,0,4900},
+{24984,10,1957},{24991,0,14553},{24996,0,3584},{24999,10,1960},
+{25003,6,1963},{25006,0,4908},{25010,0,1873},{25014,0,1329},
+{25018,0,4916},{25022,0,1524},{25026,6,1965},{25030,30,1967},
+{25040,0,1403},{25055,0,14556},{25059,0,4921},{25062,0,4920},
+{25074,0,3012},{25076,0,4924},{25078,10,1975},{25082,0,4923},
+{25084,18,1978},{25096,5,4930},{25098,0,3642},{25100,10,1983},
+{25104,26,1986},{25114,6,1993},{25117,10,1995},{25121,0,4937},
+{25126,0,2707},{25129,6,1998},{25134,10,2000},{25138,5,4941},
+{25140,0,2871},{25142,0,13757},{25144,0,1921},{25147,0,3821},
+{25150,14,2003},{25155,0,14559},{25158,14,2007},{25163,14,2011},
+{25169,0,14562},{25171,0,2855},{25173,6,2015},{25176,0,2897},
+{25179,0,4947},{25182,0,4945},{25184,0,4948},{25187,0,4946},
+{25192,0,4949},{25198,0,3585},{25201,0,1147},{25206,0,3536},
+{25209,0,3447},{25212,0,4950},{25214,10,2017},{25218,14,2020},
+{25225,6,2024},{25233,0,3912},{25234,5,4954},{25236,18,2026},
+{25243,6,2031},{25246,0,2898},{25254,0,8466},{25259,6,2033},
+{25265,0,3658},{25269,0,3085},{25273,0,3747},{25275,10,2035},
+{25282,0,4971},{25284,26,2038},{25292,6,2045},{25295,22,2047},
+{25303,10,2053},{25307,10,2056},{25312,6,2059},{25324,14,2061},
+{25329,0,4977},{25331,0,1875},{25333,10,2065},{25340,0,14565},
+{25342,6,2068},{25345,6,2070},{25351,14,2072},{25356,6,2076},
+{25361,0,3013},{25368,6,2078},{25371,0,14135},{25375,0,1708},
+{25383,6,2080},{25387,0,2099},{25391,0,2556},{25401,6,2082},
+{25405,10,2084},{25410,5,14570},{25417,0,2826},{25420,6,2087},
+{25423,6,2089},{25429,0,3633},{25431,0,3033},{25436,0,2782},
+{25445,0,14572},{25447,10,2091},{25451,0,4998},{25454,0,2622},
+{25458,0,1876},{25460,0,14573},{25462,6,2094},{25466,6,2096},
+{25469,0,14574},{25472,0,4990},{25475,6,2098},{25479,10,2100},
+{25484,0,2464},{25486,10,2103},{25490,0,3337},{25494,0,4988},
+{25496,0,1783},{25499,0,1467},{25502,22,2106},{25509,0,2688},
+{25511,22,2112},{25522,0,1821},{25524,6,2118},{25531,0,2785},
+{25534,0,5000},{25536,0,5002},{25539,6,2120},{25542,0,5003},
+{25545,0,5005},{25551,14,2122},{25558,0,3862},{25562,10,2126},
+{25569,0,1138},{25571,0,5004},{25577,0,5001},{25581,6,2129},
+{25588,14,2131},{25594,0,3891},{25606,0,5011},{25609,0,14581},
+{25613,0,2843},{25615,6,2135},{25619,6,2137},{25622,6,2139},
+{25628,0,4986},{25634,0,14583},{25638,0,5013},{25640,0,5017},
+{25644,6,2141},{25652,0,5010},{25654,0,5014},{25658,0,1822},
+{25662,0,2145},{25666,0,2689},{25678,0,5022},{25681,0,7747},
+{25684,0,14584},{25688,0,3104},{25691,0,14585},{25696,0,8468},
+{25703,0,5019},{25705,0,3726},{25709,0,14586},{25711,0,5020},
+{25718,0,5021},{25720,0,3802},{25722,6,2143},{25731,0,1848},
+{25736,0,5028},{25746,6,2145},{25749,0,5024},{25754,0,3304},
+{25757,6,2147},{25764,6,2149},{25769,0,5027},{25771,0,3553},
+{25773,6,2151},{25776,0,2709},{25778,0,3710},{25785,0,1447},
+{25787,6,2153},{25790,5,14588},{25793,6,2155},{25797,0,5032},
+{25799,0,5033},{25802,0,13341},{25805,6,2157},{25810,0,5031},
+{25812,0,4966},{25816,0,5035},{25818,0,5030},{25824,5,5040},
+{25826,6,2159},{25829,10,2161},{25836,0,1622},{25839,0,5044},
+{25841,6,2164},{25844,0,5047},{25846,6,2166},{25850,6,2168},
+{25853,6,2170},{25856,0,5050},{25860,6,2172},{25878,0,14594},
+{25880,6,2174},{25884,6,2176},{25890,10,2178},{25898,10,2181},
+{25903,0,2215},{25908,5,5058},{25910,14,2184},{25915,0,1992},
+{25918,6,2188},{25925,0,1922},{25927,6,2190},{25933,10,2192},
+{25937,0,1657},{25941,18,2195},{25949,6,2200},{25954,6,2202},
+{25958,6,2204},{25964,0,1823},{25968,0,2618},{25970,0,5071},
+{25972,6,2206},{25975,6,2208},{25985,0,14598},{25986,5,5073},
+{25989,0,14599},{25991,10,2210},{25996,0,3518},{25998,0,2120},
+{26000,6,2213},{26007,0,3143},{26009,0,3977},{26011,6,2215},
+{26015,0,5077},{26017,0,1146},{26020,6,2217},{26023,0,3538},
+{26027,10,2219},{26031,6,2222},{26039,0,5079},{26041,0,3661},
+{26044,6,2224},{26049,22,2226},{26059,6,2232},{26063,0,2834},
+{26066,0,5085},{26071,0,1590},{26073,0,5087},{26075,0,5086},
+{26080,5,5088},{26082,6,2234},{26085,18,2236},{26092,6,2241},
+{26096,10,2243},{26106,6,2246},{26112,0,8472},{26114,6,2248},
+{26118,6,2250},{26121,6,2252},{26124,0,2467},{26126,6,2254},
+{26131,10,2256},{26140,0,5099},{26142,10,2259},{26148,6,2262},
+{26151,6,2264},{26156,14,2266},{26161,0,8366},{26164,0,5098},
+{26165,5,5096},{26171,6,2270},{26175,0,5129},{26177,14,2272},
+{26185,0,5102},{26187,6,2276},{26191,0,5100},{26194,0,2173},
+{26199,0,8479},{26201,0,8480},{26203,5,14605},{26205,10,2278},
+{26209,22,2281},{26215,5,5107},{26217,0,3433},{26219,0,14608},
+{26222,10,2287},{26227,6,2290},{26230,6,2292},{26234,0,2960},
+{26241,0,1727},{26243,6,2294},{26247,10,2296},{26254,0,5114},
+{26257,0,2421},{26262,14,2299},{26269,0,5118},{26272,0,8484},
+{26274,0,3014},{26276,0,14610},{26278,0,4025},{26283,0,2193},
+{26286,0,3643},{26290,0,8485},{26292,0,3691},{26296,6,2303},
+{26300,0,5123},{26302,6,2305},{26305,0,5119},{26308,0,5124},
+{26310,14,2307},{26326,0,5126},{26329,6,2311},{26332,6,2313},
+{26336,0,5128},{26342,0,5130},{26345,0,5131},{26348,0,14612},
+{26352,0,5132},{26354,14,2315},{26359,38,2319},{26371,0,4171},
+{26373,0,14613},{26376,6,2329},{26379,0,3662},{26381,10,2331},
+{26387,18,2334},{26395,0,3692},{26397,10,2339},{26406,5,5138},
+{26408,0,3814},{26410,18,2342},{26417,0,2327},{26419,6,2347},
+{26422,10,2349},{26426,0,1589},{26429,0,1658},{26431,0,5142},
+{26433,0,5144},{26435,0,13751},{26438,0,5147},{26440,6,2352},
+{26444,0,14617},{26446,14,2354},{26451,0,2313},{26454,0,2523},
+{26457,0,5150},{26460,0,3144},{26462,18,2358},{26467,5,5151},
+{26469,6,2363},{26474,0,5157},{26477,26,2365},{26485,10,2372},
+{26491,6,2375},{26494,6,2377},{26501,0,5162},{26503,0,3470},
+{26505,0,5153},{26507,6,2379},{26512,0,2675},{26517,0,3739},
+{26519,0,3995},{26522,0,3733},{26524,6,2381},{26528,10,2383},
+{26534,0,5160},{26537,0,5155},{26543,6,2386},{26546,10,2388},
+{26550,14,2391},{26555,0,8491},{26560,6,2395},{26564,0,3601},
+{26566,0,5177},{26570,0,3476},{26574,14,2397},{26579,6,2401},
+{26583,14,2403},{26589,6,2407},{26594,0,5173},{26596,0,5170},
+{26599,0,5178},{26601,0,5168},{26604,0,5166},{26606,14,2409},
+{26611,10,2413},{26617,0,14622},{26619,0,2090},{26622,6,2416},
+{26625,18,2418},{26643,0,2710},{26646,6,2423},{26654,0,5180},
+{26657,6,2425},{26665,14,2427},{26672,5,14627},{26674,0,5185},
+{26676,0,2711},{26680,6,2431},{26684,6,2433},{26688,18,2435},
+{26694,0,5181},{26696,0,1162},{26701,6,2440},{26704,18,2442},
+{26713,0,5189},{26715,10,2447},{26719,0,2181},{26723,0,5190},
+{26727,0,3490},{26738,0,14630},{26740,14,2450},{26746,0,14632},
+{26750,6,2454},{26753,0,3978},{26755,10,2456},{26765,10,2459},
+{26771,6,2462},{26775,0,1998},{26779,0,5198},{26781,0,5197},
+{26783,6,2464},{26786,0,2471},{26789,14,2466},{26797,0,5195},
+{26799,18,2470},{26805,6,2475},{26809,6,2477},{26812,0,3176},
+{26820,0,1594},{26822,0,5235},{26824,14,2479},{26829,0,5217},
+{26831,6,2483},{26834,0,3694},{26836,18,2485},{26842,0,2920},
+{26847,10,2490},{26851,0,5225},{26855,6,2493},{26861,10,2495},
+{26864,5,14640},{26866,0,2647},{26873,6,2498},{26876,0,14642},
+{26880,6,2500},{26884,6,2502},{26888,0,5211},{26891,18,2504},
+{26897,10,2509},{26905,14,2512},{26913,10,2516},{26917,6,2519},
+{26920,0,5230},{26922,0,5231},{26928,0,5248},{26932,10,2521},
+{26937,0,5244},{26939,0,14646},{26941,0,5246},{26943,0,3060},
+{26954,0,3894},{26963,10,2524},{26967,0,14647},{26969,6,2527},
+{26972,10,2529},{26976,14,2532},{26984,0,8498},{26986,6,2536},
+{26989,10,2538},{26994,14,2541},{26999,10,2545},{27004,10,2548},
+{27007,5,14650},{27009,6,2551},{27018,0,2135},{27022,0,1279},
+{27025,0,5269},{27028,6,2553},{27032,0,8500},{27035,6,2555},
+{27040,0,5270},{27046,6,2557},{27053,6,2559},{27057,6,2561},
+{27060,0,5273},{27063,0,14654},{27067,0,5265},{27070,6,2563},
+{27073,0,5258},{27075,0,5266},{27079,0,7475},{27082,18,2565},
+{27088,0,5256},{27091,0,5259},{27094,5,14655},{27096,6,2570},
+{27101,6,2572},{27106,0,8501},{27111,6,2574},{27114,6,2576},
+{27117,0,5286},{27122,0,5281},{27126,0,14143},{27129,0,5280},
+{27131,0,3052},{27133,0,2791},{27135,0,5278},{27137,6,2578},
+{27141,0,5283},{27146,10,2580},{27151,0,14658},{27154,14,2583},
+{27159,0,2994},{27161,0,3498},{27163,0,5277},{27166,6,2587},
+{27169,10,2589},{27176,14,2592},{27182,0,5268},{27184,0,8502},
+{27188,10,2596},{27192,10,2599},{27197,6,2602},{27204,18,2604},
+{27211,0,1710},{27216,5,14664},{27220,0,15412},{27222,0,14666},
+{27224,6,2609},{27227,0,14667},{27231,0,1595},{27233,6,2611},
+{27238,0,5302},{27243,0,8503},{27250,6,2613},{27256,0,5298},
+{27262,10,2615},{27267,6,2618},{27273,0,14669},{27277,6,2620},
+{27280,6,2622},{27287,0,5312},{27292,0,5179},{27293,9,14671},
+{27296,0,5308},{27298,5,5310},{27306,0,5323},{27308,0,5319},
+{27310,0,5200},{27315,0,5318},{27320,0,5317},{27323,0,5314},
+{27329,10,2624},{27345,0,5321},{27347,0,4044},{27354,10,2627},
+{27358,6,2630},{27362,0,8507},{27364,0,8508},{27367,6,2632},
+{27370,0,5325},{27372,0,14676},{27386,6,2634},{27396,6,2636},
+{27402,0,5279},{27410,0,5330},{27414,0,5331},{27421,18,2638},
+{27427,6,2643},{27431,0,1316},{27442,0,3913},{27445,0,14679},
+{27447,14,2645},{27453,6,2649},{27459,0,5340},{27462,6,2651},
+{27465,0,5341},{27468,0,1358},{27470,0,2933},{27472,0,5342},
+{27475,6,2653},{27478,0,14681},{27481,0,5343},{27483,0,5345},
+{27487,30,2655},{27497,6,2663},{27503,0,2243},{27506,10,2665},
+{27511,0,13398},{27512,5,5348},{27515,0,2222},{27519,5,5350},
+{27522,10,2668},{27526,0,3718},{27529,10,2671},{27533,0,5354},
+{27541,6,2674},{27544,0,5355},{27550,0,5357},{27556,0,5358},
+{27562,5,5359},{27567,0,5361},{27569,18,2676},{27575,0,5365},
+{27578,10,2681},{27582,10,2684},{27589,6,2687},{27595,18,2689},
+{27602,10,2694},{27606,0,8509},{27608,0,3471},{27611,0,3807},
+{27615,0,5370},{27617,0,14685},{27627,6,2697},{27631,0,5374},
+{27633,0,14686},{27635,0,5373},{27656,0,5376},{27663,10,2699},
+{27667,5,5377},{27671,0,1598},{27675,0,5379},{27683,6,2702},
+{27699,10,2704},{27703,6,2707},{27706,0,14690},{27710,18,2709},
+{27726,0,3418},{27728,0,2266},{27733,0,5383},{27735,0,1532},
+{27737,6,2714},{27740,18,2716},{27746,0,5384},{27752,0,5392},
+{27754,0,5385},{27759,6,2721},{27762,6,2723},{27766,0,14692},
+{27770,6,2725},{27773,6,2727},{27777,10,2729},{27781,6,2732},
+{27784,0,3036},{27788,6,2734},{27792,0,5395},{27794,6,2736},
+{27797,6,2738},{27801,14,2740},{27809,6,2744},{27818,6,2746},
+{27822,0,5403},{27825,0,5404},{27827,0,1359},{27832,30,2748},
+{27841,0,1711},{27844,6,2756},{27849,6,2758},{27852,0,3451},
+{27856,0,14697},{27859,18,2760},{27865,10,2765},{27869,0,5402},
+{27872,14,2768},{27877,0,3103},{27880,0,2987},{27882,0,5410},
+{27883,5,14701},{27886,14,2772},{27891,0,1261},{27905,0,15413},
+{27908,0,8515},{27914,10,2776},{27918,0,14705},{27921,6,2779},
+{27927,0,2714},{27929,0,5417},{27931,0,3926},{27934,6,2781},
+{27941,0,3041},{27945,10,2783},{27950,0,14707},{27954,6,2786},
+{27957,6,2788},{27960,0,5416},{27963,0,1478},{27965,6,2790},
+{27969,0,3958},{27972,6,2792},{27991,0,14708},{27993,6,2794},
+{27996,0,3519},{27998,0,14709},{28003,14,2796},{28009,6,2800},
+{28012,0,1435},{28014,6,2802},{28020,0,3915},{28023,10,2804},
+{28034,0,14711},{28037,0,5431},{28039,10,2807},{28044,0,3866},
+{28046,0,5428},{28051,0,5423},{28053,6,2810},{28057,0,4006},
+{28059,6,2812},{28076,0,8519},{28079,0,1428},{28082,0,1271},
+{28085,0,5435},{28088,0,5438},{28092,0,3979},{28095,6,2814},
+{28100,14,2816},{28106,10,2820},{28111,14,2823},{28117,6,2827},
+{28120,10,2829},{28126,0,5441},{28129,0,2934},{28132,0,5448},
+{28134,0,5437},{28136,18,2832},{28142,0,5451},{28145,10,2837},
+{28149,0,3573},{28151,22,2840},{28165,0,2650},{28167,18,2846},
+{28179,0,1826},{28181,0,5433},{28183,0,14150},{28185,10,2851},
+{28189,0,5470},{28191,34,2854},{28201,0,1337},{28203,18,2863},
+{28212,0,13330},{28216,10,2868},{28220,0,8527},{28222,0,5458},
+{28226,6,2871},{28234,0,3767},{28237,6,2873},{28241,0,14718},
+{28246,0,1924},{28248,0,2477},{28251,6,2875},{28255,0,5457},
+{28263,0,3865},{28267,0,5460},{28270,6,2877},{28274,0,5456},
+{28278,0,5462},{28286,10,2879},{28290,0,5472},{28300,0,3394},
+{28303,6,2882},{28310,0,2410},{28312,0,5474},{28316,6,2884},
+{28319,0,5487},{28322,0,1202},{28325,0,5485},{28330,6,2886},
+{28335,0,5479},{28338,0,5481},{28342,6,2888},{28346,0,3112},
+{28349,0,5478},{28351,0,8528},{28354,0,5486},{28356,6,2890},
+{28359,0,14719},{28361,14,2892},{28366,0,14721},{28369,0,1480},
+{28371,0,5477},{28372,5,5482},{28377,0,15416},{28381,6,2896},
+{28390,0,15396},{28396,0,5491},{28399,0,5497},{28402,0,5495},
+{28404,0,3107},{28407,6,2898},{28413,10,2900},{28417,6,2903},
+{28422,0,2283},{28425,0,2057},{28431,0,4057},{28433,0,5489},
+{28435,10,2905},{28442,0,14723},{28448,0,3375},{28450,6,2908},
+{28458,10,2910},{28463,0,14725},{28465,10,2913},{28472,0,2740},
+{28478,6,2916},{28481,0,5488},{28485,0,1535},{28497,0,7776},
+{28500,0,1855},{28504,0,5514},{28506,10,2918},{28510,6,2921},
+{28514,0,14729},{28516,0,2411},{28518,0,5518},{28525,14,2923},
+{28532,0,5543},{28536,0,5505},{28538,0,5504},{28540,6,2927},
+{28544,10,2929},{28548,0,2629},{28550,0,5503},{28552,0,8529},
+{28555,0,14731},{28557,6,2932},{28561,6,2934},{28564,0,14734},
+{28567,6,2936},{28570,0,14735},{28577,0,5521},{28579,6,2938},
+{28583,5,14736},{28586,0,5525},{28593,0,3133},{28595,0,5519},
+{28597,6,2940},{28601,0,5523},{28608,14,2942},{28614,0,5524},
+{28628,6,2946},{28632,0,5530},{28634,6,2948},{28638,14,2950},
+{28644,0,5430},{28651,6,2954},{28654,6,2956},{28657,0,5531},
+{28659,0,5510},{28661,6,2958},{28665,6,2960},{28670,0,5540},
+{28673,0,5538},{28677,10,2962},{28681,0,5534},{28683,0,5535},
+{28687,0,5539},{28689,0,5537},{28693,0,3520},{28696,0,5545},
+{28698,6,2965},{28701,10,2967},{28710,10,2970},{28716,0,2633},
+{28720,0,5547},{28722,0,5549},{28729,0,14742},{28732,0,14743},
+{28734,0,5548},{28746,0,14744},{28748,0,5490},{28753,0,5550},
+{28756,0,14745},{28760,0,3263},{28765,5,14746},{28771,6,2973},
+{28779,6,2975},{28783,6,2977},{28792,0,1662},{28796,10,2979},
+{28801,0,14751},{28805,0,8535},{28809,6,2982},{28814,0,1292},
+{28818,0,5553},{28821,0,14752},{28825,0,5552},{28843,18,2984},
+{28851,0,5558},{28855,18,2989},{28872,0,4029},{28875,0,5561},
+{28879,0,1226},{28883,5,14754},{28888,6,2994},{28892,6,2996},
+{28895,0,5560},{28913,0,5555},{28921,0,3665},{28925,0,5565},
+{28932,0,8538},{28935,0,14758},{28937,0,5564},{28943,0,8537},
+{28948,0,1293},{28953,6,2998},{28956,0,5566},{28960,6,3000},
+{28966,0,2479},{28976,6,3002},{28982,0,2741},{28988,0,2478},
+{28998,5,8540},{29001,6,3004},{29004,0,5573},{29006,0,2717},
+{29010,0,14762},{29013,6,3006},{29017,0,1294},{29020,0,8539},
+{29024,0,14763},{29026,0,5572},{29028,14,3008},{29033,0,3429},
+{29036,0,5575},{29038,0,2301},{29049,0,14764},{29053,0,2718},
+{29060,0,5578},{29064,0,5570},{29066,0,1789},{29071,0,5576},
+{29074,0,14765},{29076,6,3012},{29081,0,8285},{29087,0,2393},
+{29096,0,5580},{29100,0,5581},{29105,0,3300},{29107,0,14766},
+{29113,0,5583},{29118,0,5584},{29121,0,8543},{29123,0,3305},
+{29128,6,3014},{29131,0,14767},{29134,0,5588},{29136,0,3997},
+{29138,22,3016},{29151,6,3022},{29157,10,3024},{29164,10,3027},
+{29173,0,5592},{29177,0,5594},{29179,6,3030},{29182,10,3032},
+{29190,0,3376},{29197,0,5596},{29200,0,5597},{29211,0,5598},
+{29213,0,14771},{29224,0,5599},{29226,14,3035},{29232,0,5602},
+{29234,0,5603},{29237,6,3039},{29240,0,14773},{29242,0,3832},
+{29243,5,5604},{29245,6,3041},{29247,5,5606},{29249,0,14774},
+{29254,10,3043},{29259,6,3046},{29266,6,3048},{29269,5,14776},
+{29272,6,3050},{29275,10,3052},{29279,0,3778},{29281,6,3055},
+{29287,0,3712},{29289,0,3578},{29298,0,2651},{29300,0,5611},
+{29305,0,3227},{29309,6,3057},{29312,10,3059},{29319,0,5615},
+{29325,0,14779},{29330,0,5616},{29334,0,5617},{29344,0,1624},
+{29346,0,5618},{29351,0,5619},{29356,6,3062},{29359,0,3420},
+{29361,6,3064},{29364,0,14781},{29366,0,2525},{29369,0,5620},
+{29374,0,8546},{29376,0,13355},{29378,10,3066},{29382,6,3069},
+{29390,0,5625},{29392,0,1925},{29394,0,5626},{29399,0,1761},
+{29401,0,2754},{29403,0,2063},{29408,5,5628},{29410,0,5627},
+{29417,0,2329},{29420,6,3071},{29431,10,3073},{29435,10,3076},
+{29444,5,14784},{29450,0,5634},{29462,6,3079},{29467,10,3081},
+{29471,0,3980},{29476,6,3084},{29480,14,3086},{29486,6,3090},
+{29489,0,14787},{29492,0,5638},{29494,5,3867},{29502,6,3092},
+{29507,10,3094},{29518,5,5643},{29527,0,5646},{29539,0,2381},
+{29544,0,5648},{29546,0,5647},{29548,0,14789},{29552,0,5649},
+{29554,0,1451},{29557,0,5651},{29559,6,3097},{29562,10,3099},
+{29571,6,3102},{29573,5,14792},{29575,0,3952},{29577,0,1732},
+{29579,0,1318},{29589,6,3104},{29598,9,14795},{29606,0,14798},
+{29608,6,3106},{29611,0,14799},{29618,6,3108},{29621,0,14800},
+{29623,0,14801},{29626,14,3110},{29632,0,5658},{29634,0,1361},
+{29640,10,3114},{29645,10,3117},{29650,0,8554},{29654,0,8552},
+{29657,0,14804},{29662,0,5661},{29664,0,2330},{29667,10,3120},
+{29673,6,3123},{29677,6,3125},{29681,0,5687},{29684,6,3127},
+{29688,0,5666},{29693,6,3129},{29699,18,3131},{29705,6,3136},
+{29722,5,14810},{29729,6,3138},{29732,10,3140},{29736,10,3143},
+{29740,0,14814},{29742,0,8560},{29743,9,14815},{29746,18,3146},
+{29753,6,3151},{29759,0,5670},{29761,0,5673},{29764,0,14819},
+{29767,0,14820},{29771,0,14821},{29773,0,14822},{29777,0,14823},
+{29781,0,5669},{29783,0,14824},{29785,14,3153},{29790,10,3157},
+{29794,10,3160},{29798,0,14825},{29801,10,3163},{29807,10,3166},
+{29811,0,2092},{29814,0,5679},{29822,0,5680},{29824,0,14828},
+{29827,0,3944},{29829,9,14829},{29833,0,8562},{29835,0,5681},
+{29840,0,14832},{29848,0,14833},{29852,0,14834},{29854,10,3169},
+{29858,6,3172},{29863,6,3174},{29867,0,14838},{29872,0,1536},
+{29877,0,14839},{29885,0,2257},{29887,0,14840},{29896,0,14841},
+{29898,0,5684},{29903,0,5685},{29908,0,5686},{29914,0,14842},
+{29916,0,1245},{29918,0,14843},{29920,0,5688},{29922,6,3176},
+{29926,6,3178},{29929,0,5691},{29934,6,3180},{29936,5,5694},
+{29938,0,5693},{29942,10,3182},{29953,0,8564},{29955,10,3185},
+{29964,10,3188},{29969,0,2059},{29971,0,5705},{29973,0,5704},
+{29976,0,1537},{29978,0,2585},{29980,0,3126},{29982,6,3191},
+{29986,6,3193},{29989,6,3195},{29992,0,3899},{29995,6,3197},
+{29999,18,3199},{30007,6,3204},{30010,10,3206},{30020,0,5710},
+{30022,0,5715},{30025,26,3209},{30033,0,3390},{30036,0,3422},
+{30041,18,3216},{30048,0,3391},{30050,0,3487},{30052,14,3221},
+{30057,18,3225},{30063,6,3230},{30067,26,3232},{30079,0,1600},
+{30081,6,3239},{30086,5,5724},{30089,10,3241},{30094,14,3244},
+{30098,5,14848},{30100,0,5730},{30106,0,5731},{30109,0,5732},
+{30115,0,5734},{30117,0,5733},{30123,0,1272},{30129,18,3248},
+{30136,6,3253},{30140,10,3255},{30146,6,3258},{30149,0,3508},
+{30151,0,2481},{30154,0,5744},{30157,0,5743},{30162,0,5745},
+{30164,6,3260},{30168,6,3262},{30171,0,3047},{30174,0,5748},
+{30178,10,3264},{30185,0,2795},{30188,0,14162},{30192,0,5753},
+{30194,5,5755},{30196,0,2962},{30201,6,3267},{30204,0,5751},
+{30206,5,5749},{30208,6,3269},{30217,10,3271},{30221,0,5758},
+{30229,5,14855},{30233,0,14857},{30238,6,3274},{30240,9,5762},
+{30244,0,5765},{30246,6,3276},{30253,0,14859},{30256,0,5767},
+{30260,6,3278},{30267,0,5768},{30274,6,3280},{30278,0,5771},
+{30279,5,5769},{30283,6,3282},{30286,0,14163},{30290,0,3850},
+{30294,0,3610},{30296,0,5773},{30300,0,5772},{30305,5,5774},
+{30309,0,14863},{30311,0,5779},{30312,9,5776},{30316,6,3284},
+{30319,14,3286},{30324,0,14867},{30326,0,5783},{30328,0,5784},
+{30330,18,3290},{30336,0,5786},{30338,10,3295},{30342,10,3298},
+{30347,0,5789},{30350,0,5790},{30352,0,2167},{30355,0,5792},
+{30358,0,5791},{30361,5,5793},{30363,6,3301},{30366,0,8568},
+{30372,5,14868},{30374,0,8570},{30382,0,3453},{30384,0,5795},
+{30388,0,5796},{30391,0,7452},{30392,9,5797},{30399,0,2172},
+{30402,6,3303},{30405,6,3305},{30408,0,1264},{30410,0,1273},
+{30412,6,3307},{30418,0,5803},{30422,6,3309},{30427,6,3311},
+{30430,6,3313},{30433,0,5805},{30435,10,3315},{30439,0,5807},
+{30442,0,5808},{30444,0,14872},{30446,0,3816},{30450,0,3809},
+{30452,0,3034},{30456,0,2796},{30459,6,3318},{30462,0,2412},
+{30465,0,2482},{30468,0,5813},{30471,10,3320},{30475,6,3323},
+{30491,0,5819},{30494,10,3325},{30500,0,5815},{30501,5,5817},
+{30505,0,5814},{30516,0,14874},{30518,0,14875},{30519,5,5820},
+{30522,0,3019},{30524,0,1567},{30528,0,2979},{30534,6,3328},
+{30554,10,3330},{30559,5,14877},{30561,10,3333},{30565,6,3336},
+{30568,0,5824},{30570,6,3338},{30578,0,14879},{30585,0,5830},
+{30589,10,3340},{30603,0,5832},{30606,0,5831},{30609,0,5833},
+{30613,0,14881},{30622,0,5835},{30624,0,5834},{30629,0,3613},
+{30633,6,3343},{30636,6,3345},{30640,0,5836},{30643,0,3215},
+{30646,0,5837},{30649,0,5838},{30651,0,5842},{30652,5,5840},
+{30655,0,5839},{30663,0,5843},{30669,0,5844},{30679,0,5845},
+{30682,10,3347},{30690,6,3350},{30693,10,3352},{30697,0,1763},
+{30701,14,3355},{30707,6,3359},{30716,0,5850},{30722,0,2093},
+{30726,0,14886},{30732,0,5851},{30738,0,5852},{30740,6,3361},
+{30752,10,3363},{30757,10,3366},{30765,5,14888},{30768,0,14890},
+{30770,0,3666},{30772,6,3369},{30778,0,3153},{30783,0,2030},
+{30789,0,5856},{30798,6,3371},{30801,0,15420},{30813,0,2483},
+{30820,0,8576},{30824,0,14892},{30827,6,3373},{30831,0,1883},
+{30834,0,3383},{30836,0,5858},{30842,0,8577},{30844,0,5860},
+{30849,0,1951},{30854,6,3375},{30860,10,3377},{30865,0,3454},
+{30867,0,1234},{30869,0,2140},{30871,0,4088},{30874,0,5861},
+{30878,0,14893},{30883,0,5863},{30887,0,3611},{30889,6,3380},
+{30895,0,5866},{30901,0,5864},{30906,0,1452},{30908,0,5872},
+{30910,0,5871},{30913,0,2259},{30917,6,3382},{30920,0,14894},
+{30922,10,3384},{30926,0,14896},{30928,6,3387},{30932,0,5870},
+{30938,0,5877},{30944,5,14898},{30948,0,14897},{30951,6,3389},
+{30956,0,5875},{30959,0,1199},{30962,0,14900},{30964,0,5879},
+{30967,0,14901},{30971,0,14902},{30973,0,5878},{30977,0,2484},
+{30983,0,5880},{30990,0,2757},{30993,6,3391},{31001,0,5883},
+{31014,0,5853},{31018,10,3393},{31024,6,3396},{31028,0,14904},
+{31034,18,3398},{31040,6,3403},{31045,0,14907},{31047,10,3405},
+{31056,0,3870},{31059,0,5892},{31061,10,3408},{31066,0,5890},
+{31067,5,14908},{31069,14,3411},{31074,0,3296},{31077,0,2485},
+{31080,0,3502},{31085,0,2119},{31095,0,3186},{31098,0,5893},
+{31103,10,3415},{31108,6,3418},{31114,6,3420},{31117,10,3422},
+{31124,0,8582},{31126,0,14911},{31128,0,14912},{31131,0,8584},
+{31133,0,5896},{31142,6,3425},{31146,0,5899},{31150,0,5900},
+{31152,6,3427},{31155,0,5901},{31160,0,14913},{31161,5,5902},
+{31163,0,14914},{31165,18,3429},{31177,10,3434},{31185,6,3437},
+{31189,0,5905},{31192,0,3455},{31194,0,14916},{31199,0,2759},
+{31201,0,5908},{31203,6,3439},{31206,6,3441},{31209,0,2975},
+{31212,0,5907},{31216,0,2486},{31227,0,1184},{31232,0,1603},
+{31235,0,14917},{31237,0,13875},{31240,6,3443},{31243,0,3092},
+{31245,6,3445},{31249,0,14919},{31252,0,3769},{31255,0,3477},
+{31256,5,5912},{31258,0,2963},{31260,0,3983},{31262,10,3447},
+{31277,6,3450},{31281,6,3452},{31287,0,5920},{31289,0,14922},
+{31291,22,3454},{31298,6,3460},{31301,6,3462},{31305,0,5923},
+{31308,18,3464},{31319,0,5922},{31325,0,14925},{31328,0,14926},
+{31329,5,5924},{31331,0,2527},{31337,0,5926},{31339,0,1453},
+{31341,0,14927},{31344,0,5928},{31348,0,1856},{31350,0,1664},
+{31352,10,3469},{31357,0,5930},{31359,0,2720},{31361,0,3237},
+{31363,6,3472},{31368,0,5931},{31378,6,3474},{31381,14,3476},
+{31391,6,3480},{31395,0,14930},{31401,6,3482},{31406,10,3484},
+{31411,0,14931},{31414,0,5939},{31418,0,1232},{31419,5,14932},
+{31423,0,5942},{31427,22,3487},{31434,6,3493},{31437,0,5946},
+{31439,0,5947},{31441,10,3495},{31445,0,5948},{31449,5,5950},
+{31452,6,3498},{31455,6,3500},{31457,5,5953},{31459,0,2401},
+{31461,10,3502},{31466,6,3505},{31469,0,5956},{31471,6,3507},
+{31478,0,1693},{31480,10,3509},{31487,0,1540},{31490,0,5958},
+{31492,0,5971},{31494,10,3512},{31498,6,3515},{31503,0,5959},
+{31505,0,2488},{31508,0,14936},{31512,5,5963},{31515,0,3109},
+{31518,0,5965},{31520,0,1468},{31525,14,3517},{31532,0,2888},
+{31537,0,14938},{31539,0,5962},{31541,6,3521},{31545,0,2155},
+{31557,18,3523},{31563,38,3528},{31574,0,2150},{31581,0,5993},
+{31584,0,14941},{31589,0,5977},{31591,0,5979},{31593,0,14942},
+{31596,10,3538},{31600,5,5980},{31602,0,14944},{31604,6,3541},
+{31610,0,5970},{31622,6,3543},{31627,0,5990},{31629,0,5987},
+{31631,0,5992},{31633,6,3545},{31636,6,3547},{31639,14,3549},
+{31644,14,3553},{31649,0,1541},{31658,0,2939},{31661,0,2721},
+{31663,0,14946},{31665,0,3382},{31668,0,5999},{31672,0,3384},
+{31680,6,3557},{31684,0,3427},{31686,6,3559},{31689,0,2969},
+{31691,6,3561},{31695,0,5998},{31703,0,14947},{31705,0,14948},
+{31709,0,6001},{31712,0,2288},{31716,10,3563},{31721,0,6002},
+{31725,0,4060},{31731,0,6011},{31734,6,3566},{31744,0,6008},
+{31751,0,6009},{31755,0,14949},{31757,0,6014},{31759,0,14950},
+{31761,14,3568},{31767,0,6013},{31774,14,3572},{31779,0,6016},
+{31782,6,3576},{31786,6,3578},{31793,0,14953},{31798,10,3580},
+{31805,14,3583},{31811,0,6024},{31820,6,3587},{31823,10,3589},
+{31828,0,6025},{31830,0,6032},{31832,6,3592},{31839,6,3594},
+{31844,6,3596},{31847,0,14957},{31852,0,6034},{31854,0,14958},
+{31856,0,14959},{31859,0,3606},{31861,0,6035},{31867,0,14094},
+{31870,0,3822},{31873,10,3598},{31881,0,3588},{31883,0,2606},
+{31885,0,3772},{31888,0,6037},{31890,0,3963},{31893,0,3370},
+{31895,6,3601},{31899,0,2391},{31903,0,1156},{31905,6,3603},
+{31908,6,3605},{31911,6,3607},{31915,0,6041},{31917,6,3609},
+{31921,10,3611},{31929,0,6048},{31932,18,3614},{31938,0,6052},
+{31941,0,6051},{31944,5,14962},{31946,0,1926},{31950,0,2746},
+{31954,0,6054},{31958,14,3619},{31964,18,3623},{31970,0,6056},
+{31975,0,3984},{31979,0,14967},{31983,0,6058},{31986,0,6059},
+{31988,0,6060},{31990,0,6061},{31992,0,2227},{31994,6,3628},
+{31998,0,1668},{32000,0,1604},{32002,0,6064},{32004,10,3630},
+{32007,9,14968},{32010,6,3633},{32013,0,3314},{32016,0,3493},
+{32019,10,3635},{32023,26,3638},{32032,14,3645},{32043,6,3649},
+{32046,10,3651},{32050,6,3654},{32053,0,6073},{32057,6,3656},
+{32063,0,6072},{32065,22,3658},{32072,0,8591},{32075,6,3664},
+{32078,10,3666},{32083,0,14975},{32086,0,6076},{32089,0,14976},
+{32091,14,3669},{32097,10,3673},{32102,0,1669},{32104,0,6079},
+{32110,0,6080},{32113,10,3676},{32117,6,3679},{32121,6,3681},
+{32125,0,6087},{32134,0,14979},{32137,0,6084},{32139,5,14980},
+{32143,0,6086},{32147,0,6083},{32153,14,3683},{32159,6,3687},
+{32162,6,3689},{32171,30,3691},{32180,6,3699},{32183,6,3701},
+{32186,6,3703},{32189,10,3705},{32199,0,6093},{32202,10,3708},
+{32207,0,2799},{32209,6,3711},{32213,6,3713},{32216,0,6103},
+{32218,0,2722},{32220,10,3715},{32224,6,3718},{32227,6,3720},
+{32232,6,3722},{32235,6,3724},{32239,0,1186},{32241,6,3726},
+{32244,0,4037},{32249,0,14985},{32251,0,6107},{32257,0,1297},
+{32260,6,3728},{32264,14,3730},{32273,6,3734},{32277,0,14988},
+{32283,0,3377},{32286,22,3736},{32294,0,2382},{32299,0,3667},
+{32302,0,2390},{32305,6,3742},{32309,0,6123},{32311,0,6126},
+{32313,10,3744},{32317,6,3747},{32321,0,3423},{32323,0,6125},
+{32326,10,3749},{32330,6,3752},{32333,0,2357},{32338,0,8596},
+{32340,10,3754},{32345,5,6133},{32349,6,3757},{32353,6,3759},
+{32358,6,3761},{32361,10,3763},{32365,6,3766},{32368,0,1793},
+{32371,0,14993},{32377,0,6135},{32379,10,3768},{32383,0,6144},
+{32386,6,3771},{32392,5,6145},{32394,0,8359},{32396,26,3773},
+{32403,5,6150},{32406,0,6152},{32408,0,14996},{32411,5,6154},
+{32566,0,1544},{32568,0,6156},{32570,0,6157},{32580,6,3780},
+{32583,0,8597},{32588,9,6159},{32591,0,14998},{32592,5,6162},
+{32594,5,14999},{32596,6,3782},{32600,0,6166},{32607,5,6167},
+{32609,0,15001},{32615,0,6171},{32616,5,6169},{32618,6,3784},
+{32622,0,2964},{32624,0,3399},{32626,0,2426},{32629,0,3331},
+{32631,10,3786},{32642,6,3789},{32645,14,3791},{32650,0,3901},
+{32652,0,6178},{32654,0,3474},{32657,0,15002},{32660,0,6179},
+{32666,0,6182},{32669,6,3795},{32673,0,8598},{32675,6,3797},
+{32680,6,3799},{32686,6,3801},{32690,0,6185},{32694,0,6188},
+{32696,6,3803},{32701,0,1227},{32703,0,15003},{32705,0,1319},
+{32709,5,6191},{32714,0,6193},{32716,0,3916},{32718,0,15004},
+{32722,0,2358},{32724,6,3805},{32735,10,3807},{32741,6,3810},
+{32745,0,6198},{32747,6,3812},{32750,5,15008},{32752,0,1545},
+{32755,0,6199},{32761,14,3814},{32768,26,3818},{32779,6,3825},
+{32782,0,15011},{32784,10,3827},{32788,6,3830},{32791,0,3811},
+{32792,5,6206},{32796,0,6208},{32801,0,6209},{32804,0,15014},
+{32806,0,15015},{32808,0,6210},{32819,0,2262},{32822,0,3833},
+{32826,14,3832},{32831,0,6211},{32838,0,6214},{32842,0,6213},
+{32850,0,6215},{32854,0,2655},{32856,0,6216},{32858,0,6217},
+{32862,18,3836},{32872,0,6220},{32879,34,3841},{32889,0,6225},
+{32893,10,3850},{32900,14,3853},{32905,0,3281},{32907,6,3857},
+{32915,0,6232},{32918,0,2491},{32920,0,3484},{32922,6,3859},
+{32925,6,3861},{32929,6,3863},{32933,6,3865},{32937,18,3867},
+{32943,0,2016},{32945,6,3872},{32948,0,2136},{32954,0,3343},
+{32963,6,3874},{32966,0,2942},{32972,0,3342},{32974,0,2875},
+{32982,0,6243},{32983,5,15024},{32985,10,3876},{32989,6,3879},
+{32993,0,1929},{32996,6,3881},{33007,0,6245},{33009,0,6246},
+{33012,0,3217},{33016,0,1715},{33020,6,3883},{33026,0,2231},
+{33029,22,3885},{33046,0,15026},{33048,0,15027},{33050,6,3891},
+{33059,0,6249},{33065,0,6248},{33067,0,13913},{33071,0,6250},
+{33073,0,2916},{33075,0,3316},{33081,6,3893},{33086,0,6254},
+{33089,0,14194},{33094,0,6253},{33098,10,3895},{33102,0,2587},
+{33104,6,3898},{33107,10,3900},{33119,0,6272},{33125,5,6260},
+{33131,0,2332},{33134,0,6259},{33136,6,3903},{33140,0,6262},
+{33144,10,3905},{33151,22,3908},{33160,0,6264},{33162,0,6265},
+{33167,0,2019},{33171,0,6273},{33173,0,6269},{33178,0,3544},
+{33180,6,3914},{33184,0,6268},{33187,6,3916},{33192,6,3918},
+{33200,0,6275},{33203,10,3920},{33208,0,6278},{33210,0,6282},
+{33213,14,3923},{33218,0,6281},{33222,0,1330},{33224,6,3927},
+{33229,0,6284},{33231,0,15034},{33233,0,6285},{33235,0,2817},
+{33240,10,3929},{33247,5,6290},{33251,0,2569},{33253,0,1385},
+{33255,6,3932},{33258,0,2263},{33261,0,2359},{33267,6,3934},
+{33273,0,15035},{33274,5,6293},{33276,0,1235},{33278,0,6295},
+{33281,5,6296},{33283,0,15036},{33285,0,6298},{33287,14,3936},
+{33292,10,3940},{33296,0,6302},{33298,0,4105},{33302,10,3943},
+{33307,6,3946},{33310,6,3948},{33313,0,15037},{33321,14,3950},
+{33326,0,6319},{33330,30,3954},{33344,0,6308},{33350,6,3962},
+{33355,0,15041},{33359,0,15042},{33368,10,3964},{33373,0,6311},
+{33375,0,6313},{33378,0,6315},{33380,0,6314},{33382,0,1547},
+{33384,0,6316},{33386,5,6317},{33390,6,3967},{33393,6,3969},
+{33398,0,1298},{33399,5,6321},{33401,0,14197},{33406,0,6323},
+{33419,0,1206},{33421,6,3971},{33426,0,6325},{33433,0,3545},
+{33437,0,2291},{33439,0,6327},{33445,6,3973},{33451,18,3975},
+{33457,0,1366},{33459,0,3669},{33463,10,3980},{33467,0,6328},
+{33469,6,3983},{33477,6,3985},{33489,14,3987},{33495,0,3510},
+{33497,0,6345},{33499,6,3991},{33502,6,3993},{33505,0,6330},
+{33507,0,6331},{33509,10,3995},{33515,0,3241},{33521,0,1267},
+{33523,6,3998},{33529,10,4000},{33534,0,15048},{33537,22,4003},
+{33545,0,6344},{33550,0,1834},{33558,0,6348},{33559,5,6357},
+{33564,0,1135},{33571,0,6365},{33576,0,1205},{33579,0,6356},
+{33583,0,6355},{33585,6,4009},{33588,10,4011},{33592,6,4014},
+{33600,0,6351},{33603,0,15049},{33605,0,6354},{33609,6,4016},
+{33615,14,4018},{33621,0,15051},{33624,0,2803},{33634,0,8601},
+{33651,0,6371},{33653,0,6372},{33655,0,1369},{33659,6,4022},
+{33663,0,8602},{33669,10,4024},{33673,6,4027},{33677,6,4029},
+{33682,6,4031},{33686,0,6364},{33688,0,15055},{33690,0,6360},
+{33694,10,4033},{33698,0,6363},{33704,14,4036},{33713,0,3923},
+{33717,0,6370},{33725,0,6392},{33727,5,15057},{33729,0,6384},
+{33733,0,2625},{33735,0,8603},{33738,0,1632},{33740,0,1749},
+{33742,0,6379},{33747,0,1371},{33750,0,2492},{33752,0,6382},
+{33756,0,2122},{33759,6,4040},{33769,10,4042},{33775,14,4045},
+{33780,0,6376},{33782,6,4049},{33787,0,6395},{33789,0,6380},
+{33795,6,4051},{33799,0,6386},{33802,22,4053},{33809,0,15061},
+{33811,0,6377},{33824,0,6391},{33826,0,6390},{33833,6,4059},
+{33836,0,6408},{33841,0,1500},{33845,0,6411},{33848,0,6393},
+{33852,6,4061},{33862,0,6407},{33864,10,4063},{33870,0,3954},
+{33879,0,2998},{33883,0,1481},{33889,10,4066},{33894,0,1141},
+{33897,0,6406},{33899,18,4069},{33905,0,3298},{33909,10,4074},
+{33913,6,4077},{33922,0,6405},{33924,0,6400},{33931,0,2493},
+{33936,0,2361},{33940,0,2264},{33945,0,3812},{33948,0,3513},
+{33951,0,6416},{33953,0,6425},{33960,0,15064},{33965,0,6403},
+{33967,0,15065},{33970,0,1493},{33972,0,8606},{33976,6,4079},
+{33979,6,4081},{33983,14,4083},{33988,0,2973},{33990,0,6423},
+{33993,10,4087},{33997,0,6418},{34000,6,4090},{34006,0,6424},
+{34009,6,4092},{34012,0,8363},{34028,0,3671},{34030,0,4039},
+{34032,0,15068},{34036,0,6428},{34044,6,4094},{34047,6,4096},
+{34054,0,6394},{34060,0,15070},{34065,0,3614},{34067,10,4098},
+{34071,5,6429},{34074,0,1240},{34079,0,6432},{34081,0,6426},
+{34083,0,7706},{34086,0,3057},{34092,6,4101},{34100,6,4103},
+{34109,6,4105},{34112,6,4107},{34115,0,3437},{34120,14,4109},
+{34126,0,1718},{34131,0,8607},{34133,0,6443},{34135,14,4113},
+{34142,0,15072},{34147,0,6437},{34152,14,4117},{34157,0,6450},
+{34167,0,6456},{34174,0,6457},{34176,0,6444},{34180,0,3372},
+{34183,6,4121},{34186,0,6448},{34191,10,4123},{34196,0,6451},
+{34199,0,1300},{34201,0,3261},{34203,6,4126},{34212,0,6445},
+{34214,0,2728},{34216,34,4128},{34231,0,15074},{34233,6,4137},
+{34241,0,4084},{34249,0,6459},{34253,14,4139},{34261,0,6464},
+{34268,6,4143},{34276,6,4145},{34281,6,4147},{34292,0,14208},
+{34295,0,2429},{34297,10,4149},{34302,0,6472},{34306,0,6441},
+{34310,6,4152},{34314,6,4154},{34322,6,4156},{34326,6,4158},
+{34330,0,6476},{34338,0,6475},{34345,0,15078},{34349,0,3936},
+{34351,6,4160},{34367,0,6478},{34381,6,4162},{34384,0,1646},
+{34386,0,15079},{34388,6,4164},{34394,10,4166},{34398,6,4169},
+{34403,0,15080},{34407,0,6483},{34411,6,4171},{34415,0,15082},
+{34417,0,6484},{34425,10,4173},{34429,0,14214},{34442,0,1379},
+{34443,5,6489},{34445,0,15084},{34449,0,15085},{34451,0,6485},
+{34453,0,2187},{34456,0,15086},{34467,6,4176},{34471,5,15087},
+{34473,5,6487},{34475,0,6498},{34479,6,4178},{34486,0,6491},
+{34500,0,6493},{34502,6,4180},{34505,0,6496},{34507,0,2943},
+{34509,6,4182},{34516,0,6499},{34521,0,1437},{34523,0,6504},
+{34526,6,4184},{34532,0,3406},{34537,0,6501},{34540,14,4186},
+{34552,14,4190},{34557,6,4194},{34560,0,6509},{34562,6,4196},
+{34566,0,6507},{34568,14,4198},{34573,0,6514},{34577,10,4202},
+{34584,10,4205},{34588,0,3766},{34590,0,15094},{34597,0,6521},
+{34600,6,4208},{34612,0,6517},{34615,0,6519},{34619,0,6520},
+{34622,6,4210},{34633,0,2698},{34635,6,4212},{34638,0,6528},
+{34643,0,6534},{34645,0,2544},{34647,0,6530},{34649,0,6533},
+{34655,6,4214},{34659,0,6535},{34662,0,1372},{34664,0,6531},
+{34666,0,6536},{34670,0,6532},{34673,0,15097},{34676,0,6529},
+{34678,0,3023},{34680,0,6526},{34687,0,3358},{34690,0,6540},
+{34696,0,15098},{34701,0,3877},{34713,0,15099},{34719,0,6539},
+{34722,0,6538},{34731,0,6547},{34732,5,15100},{34735,0,6541},
+{34739,0,6549},{34741,0,15102},{34746,6,4216},{34749,0,6543},
+{34752,0,6544},{34756,0,6548},{34758,6,4218},{34763,0,6542},
+{34768,0,6545},{34770,0,6562},{34774,0,15103},{34784,0,6555},
+{34795,10,4220},{34799,0,6553},{34802,0,6554},{34805,0,15421},
+{34806,5,6559},{34809,0,1416},{34811,0,1628},{34814,0,6558},
+{34817,0,15106},{34819,0,15107},{34821,10,4223},{34827,0,15109},
+{34829,10,4226},{34833,0,6563},{34836,10,4229},{34844,0,15111},
+{34847,0,7813},{34849,10,4232},{34855,0,6571},{34865,0,6568},
+{34870,0,6569},{34873,0,6570},{34875,0,6572},{34880,0,1858},
+{34882,0,6574},{34884,0,6573},{34886,0,2362},{34892,6,4235},
+{34898,6,4237},{34902,6,4239},{34905,0,6576},{34907,0,1268},
+{34909,10,4241},{34913,14,4244},{34920,0,3503},{34923,0,6579},
+{34928,0,2608},{34930,0,6586},{34933,0,6583},{34935,0,2989},
+{34941,10,4248},{34945,6,4251},{34952,0,1804},{34955,0,2878},
+{34957,0,6593},{34962,0,6589},{34966,14,4253},{34974,0,6582},
+{34978,0,6592},{34980,0,6594},{34986,6,4257},{34990,0,6590},
+{34992,6,4259},{34996,6,4261},{34999,0,1157},{35005,5,15117},
+{35007,0,6596},{35009,6,4263},{35011,5,6598},{35013,6,4265},
+{35018,0,15119},{35023,0,3946},{35026,0,15120},{35028,6,4267},
+{35032,5,6601},{35035,10,4269},{35039,0,2096},{35041,0,3947},
+{35048,0,6608},{35056,5,15122},{35058,14,4272},{35064,6,4276},
+{35068,10,4278},{35074,0,6605},{35076,0,6610},{35078,6,4281},
+{35082,0,6612},{35084,0,6611},{35088,0,1482},{35090,6,4283},
+{35096,9,15125},{35100,10,4285},{35109,0,6616},{35111,0,15128},
+{35114,5,6617},{35120,0,15129},{35126,0,6622},{35128,0,6623},
+{35131,0,6621},{35134,0,15130},{35137,0,6619},{35139,6,4288},
+{35148,6,4290},{35158,0,1320},{35166,10,4292},{35172,0,6629},
+{35174,0,6628},{35178,0,6631},{35181,0,6630},{35183,0,6632},
+{35186,0,2363},{35188,0,6633},{35191,0,6634},{35195,0,15131},
+{35198,14,4295},{35203,0,6636},{35206,10,4299},{35210,6,4302},
+{35215,0,1606},{35219,0,6639},{35222,10,4304},{35226,0,1454},
+{35233,0,6641},{35238,6,4307},{35241,6,4309},{35244,0,6644},
+{35247,0,6645},{35250,6,4311},{35258,0,6647},{35261,0,6648},
+{35263,5,6649},{35282,0,1455},{35284,0,15132},{35286,0,15133},
+{35290,0,6651},{35292,5,6652},{35299,0,1394},{35301,10,4313},
+{35313,0,15135},{35316,0,6655},{35320,0,6656},{35328,14,4316},
+{35335,6,4320},{35338,0,2588},{35340,0,6660},{35342,10,4322},
+{35346,6,4325},{35349,14,4327},{35355,0,6661},{35357,0,6662},
+{35359,0,2497},{35362,6,4331},{35365,0,6663},{35370,0,3674},
+{35373,0,2691},{35377,0,1680},{35379,6,4333},{35382,6,4335},
+{35386,10,4337},{35393,0,6665},{35398,0,6668},{35400,0,6669},
+{35406,0,15140},{35408,10,4340},{35412,6,4343},{35419,0,6666},
+{35422,0,2234},{35424,0,1269},{35426,6,4345},{35430,0,2236},
+{35433,0,2235},{35435,14,4347},{35440,14,4351},{35449,0,8618},
+{35452,0,6670},{35455,0,15141},{35458,0,6675},{35460,6,4355},
+{35463,0,1932},{35465,0,3882},{35468,6,4357},{35473,0,6679},
+{35475,0,2660},{35477,0,2944},{35480,0,3872},{35482,0,6682},
+{35486,0,1952},{35488,6,4359},{35491,6,4361},{35493,5,6680},
+{35495,6,4363},{35498,0,13880},{35500,6,4365},{35504,0,2925},
+{35506,0,1373},{35513,0,3460},{35516,0,1629},{35518,6,4367},
+{35522,0,6686},{35524,0,6684},{35527,0,2954},{35531,10,4369},
+{35535,0,2593},{35538,0,3986},{35542,0,4070},{35546,10,4372},
+{35550,18,4375},{35556,0,6691},{35558,6,4380},{35563,0,6688},
+{35565,6,4382},{35569,0,6692},{35571,6,4384},{35574,10,4386},
+{35578,0,1909},{35582,0,2906},{35584,10,4389},{35588,0,3197},
+{35591,0,6700},{35596,0,6699},{35598,0,3262},{35600,0,6704},
+{35604,0,6693},{35606,6,4392},{35609,10,4394},{35613,0,2305},
+{35615,10,4397},{35622,0,6709},{35624,0,6712},{35627,6,4400},
+{35635,0,6707},{35639,0,15144},{35641,0,1752},{35646,0,6711},
+{35649,0,6713},{35651,5,15145},{35657,0,6717},{35660,0,6714},
+{35662,6,4402},{35667,6,4404},{35670,0,6718},{35672,0,2269},
+{35674,10,4406},{35679,0,6722},{35686,0,1839},{35691,6,4409},
+{35695,14,4411},{35700,0,6725},{35703,0,1954},{35709,0,6726},
+{35711,6,4415},{35715,0,2188},{35722,0,5075},{35724,0,6728},
+{35726,0,6729},{35728,0,2364},{35730,5,6730},{35734,0,6732},
+{35737,5,6733},{35740,0,15148},{35742,0,15149},{35895,0,2921},
+{35898,0,6735},{35903,0,6737},{35905,0,6736},{35910,10,4417},
+{35914,0,3675},{35916,0,6739},{35918,0,6740},{35920,0,6741},
+{35924,6,4420},{35930,0,3250},{35937,6,4422},{35946,10,4424},
+{35955,0,15152},{35960,10,4427},{35964,0,6754},{35970,0,6747},
+{35973,0,6749},{35977,6,4430},{35980,0,3700},{35981,5,6751},
+{35988,0,6753},{35992,0,6755},{35997,6,4432},{36000,10,4434},
+{36004,0,15153},{36007,38,4437},{36018,5,6760},{36020,0,1608},
+{36022,10,4447},{36027,10,4450},{36031,22,4453},{36039,6,4459},
+{36042,0,2833},{36045,6,4461},{36049,0,3280},{36051,0,3522},
+{36057,14,4463},{36062,0,2502},{36064,18,4467},{36070,0,3548},
+{36074,0,2285},{36077,0,3148},{36080,0,8626},{36084,0,8627},
+{36088,0,15156},{36090,5,6770},{36092,10,4472},{36100,5,6772},
+{36103,6,4475},{36106,6,4477},{36109,0,6777},{36111,6,4479},
+{36114,10,4481},{36118,0,6783},{36123,0,15158},{36196,0,2682},
+{36198,6,4484},{36201,0,15159},{36203,10,4486},{36208,6,4489},
+{36211,6,4491},{36214,6,4493},{36225,0,6788},{36228,6,4495},
+{36234,0,1277},{36237,0,15162},{36245,0,15163},{36249,0,6789},
+{36259,0,2333},{36262,0,15164},{36264,0,2620},{36275,0,2829},
+{36282,0,6792},{36286,0,6791},{36290,0,6790},{36294,0,15165},
+{36299,6,4497},{36302,6,4499},{36310,0,6795},{36314,6,4501},
+{36317,0,1681},{36319,0,6801},{36321,0,2683},{36323,6,4503},
+{36328,0,1933},{36330,5,6799},{36332,0,15168},{36335,0,4047},
+{36339,0,3027},{36341,0,2731},{36348,0,6803},{36351,0,6806},
+{36360,5,6804},{36362,0,3907},{36367,6,4505},{36381,5,6807},
+{36383,6,4507},{36394,0,6824},{36400,0,6813},{36404,6,4509},
+{36418,0,6811},{36420,0,3097},{36423,22,4511},{36432,0,6819},
+{36437,0,6826},{36441,0,6821},{36447,6,4517},{36451,6,4519},
+{36460,0,15171},{36464,0,15172},{36466,0,6828},{36468,0,2365},
+{36470,0,6827},{36474,0,15173},{36476,0,6829},{36481,0,6830},
+{36484,6,4521},{36487,0,6831},{36490,6,4523},{36493,0,3842},
+{36497,14,4525},{36505,0,6839},{36513,0,6841},{36522,10,4529},
+{36526,14,4532},{36531,0,15176},{36534,0,14083},{36542,0,6846},
+{36544,0,7663},{36549,6,4536},{36552,0,6848},{36554,14,4538},
+{36559,0,8631},{36561,6,4542},{36564,0,15178},{36571,0,6850},
+{36575,0,3272},{36578,6,4544},{36587,0,6854},{36600,6,4546},
+{36603,14,4548},{36611,0,1457},{36613,0,6857},{36617,6,4552},
+{36620,0,6865},{36626,14,4554},{36631,0,15180},{36633,0,6860},
+{36635,10,4558},{36639,0,6863},{36646,0,6866},{36649,6,4561},
+{36655,0,2366},{36659,0,6867},{36662,0,15181},{36664,6,4563},
+{36667,0,6868},{36670,6,4565},{36674,0,6871},{36676,10,4567},
+{36681,0,6874},{36684,10,4570},{36695,0,6877},{36700,0,6878},
+{36703,0,2046},{36705,0,1787},{36706,9,6879},{36763,6,4573},
+{36766,6,4575},{36771,0,6884},{36774,10,4577},{36781,22,4580},
+{36789,5,15183},{36791,0,6887},{36794,10,4586},{36799,0,2919},
+{36802,0,1228},{36804,10,4589},{36808,0,14233},{36814,0,1844},
+{36817,0,1753},{36820,0,3622},{36826,0,6888},{36832,0,15186},
+{36834,0,6890},{36836,10,4592},{36841,10,4595},{36845,0,3117},
+{36847,6,4598},{36852,0,6894},{36854,10,4600},{36857,5,6896},
+{36861,0,3045},{36864,14,4603},{36869,6,4607},{36875,0,6904},
+{36877,18,4609},{36883,18,4614},{36889,6,4619},{36893,26,4621},
+{36903,0,6905},{36908,0,15190},{36910,0,2881},{36913,6,4628},
+{36917,6,4630},{36920,6,4632},{36924,0,3489},{36926,0,6916},
+{36929,6,4634},{36932,6,4636},{36935,0,1776},{36937,10,4638},
+{36941,6,4641},{36943,13,6910},{36947,14,4643},{36952,6,4647},
+{36956,0,2845},{36958,0,6919},{36960,6,4649},{36963,0,1891},
+{36965,0,3908},{36967,10,4651},{36973,10,4654},{36978,0,6924},
+{36981,14,4657},{36986,0,1192},{36988,6,4661},{36991,22,4663},
+{36999,14,4669},{37007,0,6931},{37009,0,3874},{37013,0,15193},
+{37017,0,15194},{37019,0,15195},{37026,6,4673},{37030,0,3676},
+{37032,0,6932},{37034,0,2309},{37039,0,6933},{37041,0,6934},
+{37044,6,4675},{37048,0,3099},{37057,0,1198},{37066,0,2027},
+{37070,0,4064},{37079,0,15198},{37083,0,6939},{37085,6,4677},
+{37089,6,4679},{37092,0,6937},{37096,0,3558},{37101,0,1458},
+{37108,6,4681},{37111,0,1719},{37117,0,3150},{37122,0,6940},
+{37138,0,6941},{37141,0,8637},{37143,0,15201},{37145,0,6942},
+{37148,0,15202},{37159,0,8638},{37165,0,3100},{37168,10,4683},
+{37178,0,15204},{37181,0,15205},{37192,26,4686},{37202,0,2334},
+{37204,0,2610},{37206,0,6946},{37208,0,6947},{37211,0,15207},
+{37217,18,4693},{37225,6,4698},{37228,0,2369},{37234,6,4700},
+{37237,0,2028},{37239,6,4702},{37250,0,6955},{37255,0,2416},
+{37257,0,6954},{37259,0,6953},{37261,6,4704},{37264,0,1955},
+{37266,0,2663},{37271,0,3396},{37276,0,2371},{37278,0,15211},
+{37282,0,6956},{37284,0,2503},{37288,0,15212},{37290,10,4706},
+{37293,5,15213},{37295,0,6958},{37297,6,4709},{37300,6,4711},
+{37304,0,2530},{37306,0,6962},{37308,0,15216},{37312,5,6963},
+{37318,14,4713},{37323,26,4717},{37334,10,4724},{37338,22,4727},
+{37345,0,6970},{37347,0,3068},{37348,5,8644},{37350,6,4733},
+{37357,5,8642},{37360,0,15217},{37365,5,6973},{37367,0,15218},
+{37371,6,4735},{37375,0,6976},{37382,6,4737},{37386,0,8648},
+{37389,6,4739},{37392,6,4741},{37396,6,4743},{37406,0,6975},
+{37416,6,4745},{37420,0,6978},{37427,6,4747},{37431,14,4749},
+{37436,0,8651},{37439,6,4753},{37443,10,4755},{37447,10,4758},
+{37451,0,6989},{37454,14,4761},{37463,0,6982},{37465,10,4765},
+{37470,0,6981},{37472,0,15227},{37474,0,3393},{37476,0,6985},
+{37478,6,4768},{37489,0,2029},{37495,5,8658},{37502,0,3702},
+{37504,0,1756},{37507,0,2384},{37509,0,3220},{37512,0,8362},
+{37521,0,2735},{37523,0,6993},{37525,6,4770},{37528,0,3791},
+{37530,10,4772},{37543,0,8657},{37549,0,2734},{37555,0,13652},
+{37559,0,6998},{37561,0,6997},{37570,0,15228},{37579,5,15229},
+{37583,6,4775},{37586,6,4777},{37589,0,8665},{37591,0,8661},
+{37593,0,8662},{37599,6,4779},{37604,0,2437},{37607,0,8660},
+{37609,6,4781},{37613,0,1270},{37618,6,4783},{37624,18,4785},
+{37631,0,8673},{37634,0,8675},{37636,0,13402},{37638,0,2170},
+{37645,0,15232},{37647,6,4790},{37653,0,15233},{37656,10,4792},
+{37661,26,4795},{37669,14,4802},{37675,6,4806},{37678,6,4808},
+{37682,0,4069},{37685,0,7009},{37690,6,4810},{37700,0,7002},
+{37703,6,4812},{37706,6,4814},{37709,0,3151},{37714,0,15237},
+{37716,0,3059},{37718,6,4816},{37723,6,4818},{37728,0,7012},
+{37733,0,15238},{37738,0,15239},{37740,10,4820},{37744,0,8676},
+{37749,0,1892},{37756,0,7013},{37758,0,2505},{37772,0,1495},
+{37780,0,7019},{37782,6,4823},{37786,6,4825},{37796,0,8678},
+{37799,0,1433},{37801,0,15243},{37804,5,7017},{37806,0,3039},
+{37808,0,7016},{37817,6,4827},{37825,0,15244},{37827,0,7026},
+{37830,0,8679},{37832,0,7029},{37834,0,15245},{37840,6,4829},
+{37846,5,7021},{37848,0,7025},{37853,6,4831},{37857,6,4833},
+{37860,6,4835},{37864,0,7023},{37880,0,8681},{37882,0,15247},
+{37885,0,15248},{37891,0,7034},{37895,0,7035},{37903,6,4837},
+{37907,6,4839},{37912,10,4841},{37921,0,7040},{37931,0,7038},
+{37937,0,8682},{37940,10,4844},{37944,0,2904},{37946,0,7041},
+{37951,0,15251},{37953,0,7042},{37956,6,4847},{37960,0,8684},
+{37969,10,4849},{37973,0,15252},{37978,6,4852},{37982,0,7048},
+{37984,0,7046},{37986,0,7047},{37994,6,4854},{38000,0,7051},
+{38002,0,15254},{38005,0,7052},{38007,0,7053},{38012,14,4856},
+{38017,0,7058},{38263,6,4860},{38272,0,3827},{38274,6,4862},
+{38279,0,7061},{38281,10,4864},{38287,0,1246},{38289,14,4867},
+{38294,0,7064},{38296,5,7065},{38304,0,7067},{38306,30,4871},
+{38315,0,15258},{38317,0,7070},{38321,6,4879},{38324,0,15259},
+{38329,0,7073},{38331,14,4881},{38339,0,7077},{38343,0,1163},
+{38346,0,7075},{38348,6,4885},{38356,10,4887},{38360,0,3206},
+{38362,0,15261},{38364,0,7083},{38369,6,4890},{38373,0,7085},
+{38428,6,4892},{38433,0,7087},{38440,0,7088},{38442,0,2133},
+{38446,5,7089},{38450,0,3703},{38459,0,2765},{38463,14,4894},
+{38468,0,3551},{38475,10,4898},{38479,6,4901},{38488,0,15264},
+{38491,18,4903},{38498,18,4908},{38506,0,3356},{38508,0,7102},
+{38512,0,1220},{38514,6,4913},{38517,14,4915},{38522,0,1893},
+{38525,0,3909},{38532,10,4919},{38536,0,1790},{38538,6,4922},
+{38541,10,4924},{38548,6,4927},{38551,10,4929},{38555,10,4932},
+{38560,0,1221},{38563,6,4935},{38567,14,4937},{38575,6,4941},
+{38577,5,7109},{38580,0,7112},{38582,6,4943},{38584,5,7114},
+{38587,6,4945},{38592,6,4947},{38596,14,4949},{38601,0,7118},
+{38603,14,4953},{38609,6,4957},{38613,6,4959},{38617,0,4331},
+{38619,6,4961},{38622,0,15270},{38626,6,4963},{38632,14,4965},
+{38640,10,4969},{38646,6,4972},{38649,0,7124},{38651,0,3135},
+{38656,0,2343},{38658,0,15273},{38660,0,7125},{38662,18,4974},
+{38669,10,4979},{38673,0,7130},{38675,0,7128},{38678,0,7132},
+{38681,0,7133},{38684,0,2812},{38686,0,1378},{38692,0,7134},
+{38695,0,3780},{38698,0,7135},{38704,0,7136},{38706,6,4982},
+{38712,6,4984},{38715,0,8691},{38717,5,7138},{38722,10,4986},
+{38726,0,7141},{38728,6,4989},{38733,0,8693},{38735,0,8694},
+{38737,6,4991},{38741,6,4993},{38745,6,4995},{38748,0,7145},
+{38750,0,3463},{38752,18,4997},{38758,0,7148},{38760,6,5002},
+{38763,0,7151},{38765,6,5004},{38769,0,7152},{38771,6,5006},
+{38777,6,5008},{38780,0,7155},{38785,0,7156},{38788,10,5010},
+{38795,0,7159},{38797,0,1164},{38799,5,7160},{38808,0,2508},
+{38810,0,15279},{38812,0,7162},{38816,0,1633},{38818,6,5013},
+{38822,0,7164},{38824,0,7163},{38827,0,6708},{38829,0,3628},
+{38835,5,7166},{38837,5,15281},{38851,0,7168},{38854,0,7169},
+{38856,0,7170},{38859,0,7171},{38867,0,1558},{38873,0,15283},
+{38876,0,7172},{38878,0,15284},{38893,6,5015},{38898,18,5017},
+{38907,0,1222},{38911,0,1721},{38913,10,5022},{38917,6,5025},
+{38920,0,2594},{38922,0,15286},{38924,0,7180},{38926,22,5027},
+{38935,6,5033},{38938,0,1841},{38942,0,15288},{38945,0,7183},
+{38947,6,5035},{38955,10,5037},{38960,0,7795},{38964,0,1266},
+{38967,10,5040},{38971,14,5043},{38982,0,7186},{38987,6,5047},
+{38989,5,1465},{38991,0,7187},{38994,5,15292},{38996,6,5049},
+{38999,18,5051},{39006,0,4008},{39013,0,8698},{39015,0,1936},
+{39019,6,5056},{39023,9,7190},{39027,6,5058},{39080,0,3561},
+{39082,0,7195},{39087,0,7196},{39089,0,7197},{39094,0,7198},
+{39096,0,15296},{39098,0,15297},{39103,0,15298},{39107,6,5060},
+{39110,0,7201},{39112,0,15299},{39131,6,5062},{39135,6,5064},
+{39138,0,1612},{39141,0,15300},{39145,0,7202},{39147,0,7203},
+{39149,10,5066},{39154,0,1215},{39156,0,1151},{39164,10,5069},
+{39171,0,7204},{39173,0,3819},{39177,6,5072},{39180,0,1252},
+{39184,0,2191},{39186,10,5074},{39192,0,7208},{39197,5,7210},
+{39200,6,5077},{39204,0,7212},{39207,6,5079},{39212,0,7214},
+{39214,0,7215},{39218,5,15301},{39229,5,7216},{39232,0,15303},
+{39234,0,7218},{39237,0,7220},{39241,0,7219},{39243,10,5081},
+{39248,0,7221},{39249,5,7223},{39253,0,7226},{39255,0,1722},
+{39260,0,15305},{39263,0,15306},{39318,0,2335},{39319,5,7227},
+{39321,0,2035},{39326,0,8703},{39333,0,7229},{39336,0,1436},
+{39340,0,3333},{39341,5,7230},{39345,0,15307},{39347,6,5084},
+{39353,5,15308},{39356,0,7232},{39361,0,3379},{39364,10,5086},
+{39368,6,5089},{39376,10,5091},{39381,0,1391},{39384,0,7236},
+{39387,0,7234},{39389,0,7235},{39391,0,7233},{39394,0,7247},
+{39405,5,7238},{39409,5,7240},{39416,0,7243},{39419,0,7242},
+{39423,0,2403},{39425,6,5094},{39429,0,7246},{39432,0,14266},
+{39438,6,5096},{39442,6,5098},{39446,0,15312},{39449,0,7248},
+{39460,0,15313},{39463,6,5100},{39467,0,7249},{39469,5,15315},
+{39472,0,3205},{39478,10,5102},{39486,0,7255},{39488,0,7253},
+{39490,6,5105},{39493,0,7251},{39498,0,15319},{39501,6,5107},
+{39506,0,7727},{39509,10,5109},{39514,6,5112},{39519,0,7260},
+{39522,0,7261},{39524,6,5114},{39529,10,5116},{39592,0,2062},
+{39597,0,7267},{39600,0,7268},{39605,5,15321},{39608,0,1434},
+{39612,0,7269},{39616,0,7270},{39620,0,2615},{39631,0,7271},
+{39633,0,7272},{39635,5,7273},{39640,6,5119},{39644,0,8706},
+{39646,5,7275},{39650,5,7277},{39654,0,7279},{39658,6,5121},
+{39661,10,5123},{39665,0,7284},{39668,0,7283},{39671,0,7285},
+{39673,0,15323},{39675,0,7286},{39683,0,15324},{39686,0,7287},
+{39704,0,7288},{39706,0,7289},{39711,6,5126},{39714,5,7291},
+{39717,0,7293},{39719,13,7294},{39725,0,13372},{39726,5,7298},
+{39729,6,5128},{39731,5,15326},{39739,6,5130},{39745,18,5132},
+{39757,5,7304},{39759,0,7303},{39761,0,7306},{39764,0,3728},
+{39768,0,7307},{39770,0,1685},{39791,0,4043},{39794,14,5137},
+{39801,0,15329},{39811,0,7310},{39822,6,5141},{39825,10,5143},
+{39830,5,7312},{39839,5,7314},{39847,6,5146},{39850,6,5148},
+{39853,6,5150},{39857,0,8710},{39860,0,7317},{39865,0,7320},
+{39867,0,8711},{39872,6,5152},{39878,6,5154},{39881,6,5156},
+{39887,0,7322},{39889,5,7323},{39892,0,7328},{39894,6,5158},
+{39899,0,2884},{39903,0,14271},{39905,14,5160},{39911,6,5164},
+{39915,0,15335},{39920,10,5166},{39925,0,1143},{39927,0,15336},
+{39930,0,15337},{39933,0,15338},{39936,0,8712},{39940,0,7343},
+{39942,0,7339},{39944,22,5169},{39952,0,4082},{39954,14,5175},
+{39963,0,7345},{39969,0,7348},{39972,6,5179},{39975,0,15340},
+{39978,0,15341},{39981,14,5181},{39986,0,7351},{39990,0,15342},
+{39993,10,5185},{39998,0,7353},{40001,0,15343},{40006,10,5188},
+{40018,6,5191},{40023,0,4002},{40026,0,7354},{40032,0,7355},
+{40035,0,15345},{40039,0,7356},{40042,0,15346},{40054,10,5193},
+{40165,0,3031},{40167,0,7359},{40169,0,3403},{40171,6,5196},
+{40176,0,7361},{40179,6,5198},{40182,0,3240},{40194,6,5200},
+{40198,14,5202},{40206,0,1322},{40210,0,7374},{40213,0,7373},
+{40219,0,1303},{40223,0,7371},{40227,0,7370},{40230,0,7368},
+{40232,0,1497},{40234,10,5206},{40251,0,2037},{40254,6,5209},
+{40257,6,5211},{40260,0,7372},{40262,10,5213},{40272,6,5216},
+{40281,0,7385},{40284,0,1231},{40285,5,7380},{40288,6,5218},
+{40291,6,5220},{40297,0,15352},{40299,6,5222},{40303,6,5224},
+{40306,0,7386},{40314,0,7391},{40316,0,15353},{40318,0,15354},
+{40327,0,7388},{40329,0,7387},{40333,0,15355},{40335,0,1842},
+{40346,0,7392},{40356,0,7393},{40361,0,7394},{40363,0,7389},
+{40367,0,7369},{40369,6,5226},{40372,0,3069},{40376,0,7399},
+{40378,6,5228},{40385,14,5230},{40390,6,5234},{40399,0,7402},
+{40403,0,7405},{40406,6,5236},{40409,0,7404},{40415,0,15360},
+{40422,0,7407},{40427,0,15361},{40429,0,7408},{40431,0,7409},
+{40434,0,4079},{40436,0,15362},{40440,10,5238},{40445,0,7410},
+{40469,0,15363},{40473,0,8716},{40474,5,7411},{40477,6,5241},
+{40565,0,7414},{40568,6,5243},{40572,6,5245},{40575,0,2267},
+{40577,0,7417},{40584,0,7418},{40587,5,7419},{40593,10,5247},
+{40597,0,7422},{40599,0,4023},{40605,0,7424},{40607,0,4003},
+{40612,10,5250},{40616,10,5253},{40620,6,5256},{40628,6,5258},
+{40632,18,5260},{40638,6,5265},{40643,6,5267},{40652,6,5269},
+{40654,9,7432},{40657,6,5271},{40660,0,7435},{40664,6,5273},
+{40667,14,5275},{40672,0,7439},{40677,0,7440},{40679,6,5279},
+{40686,6,5281},{40692,0,7443},{40694,5,7444},{40697,0,7446},
+{40699,9,7447},{40711,5,7450},{40718,0,3102},{40720,0,15370},
+{40722,6,5283},{40725,0,7453},{40727,0,15372},{40729,0,15373},
+{40736,6,5285},{40748,0,7455},{40751,0,15374},{40759,0,15375},
+{40761,0,15376},{40763,0,3475},{40766,0,7456},{40769,0,15377},
+{40773,0,15378},{40778,6,5287},{40782,6,5289},{40786,0,7458},
+{40788,0,7459},{40791,0,15379},{40799,9,7461},{40802,6,5291},
+{40806,5,7464},{40808,0,15380},{40810,0,7467},{40812,0,7466},
+{40817,6,5293},{40821,10,5295},{40845,0,3966},{40848,0,15383},
+{40852,6,5298},{40860,6,5300},{40864,0,7473},{40866,0,15385},
+{63785,0,8489},{63964,0,8686},{64014,0,8410},{64015,5,8421},
+{64017,26,5302},{64024,9,8579},{64027,18,5309},{64032,5,8612},
+{64034,6,5314},{64036,5,8632},{64038,14,5316},{64042,5,8699},
+{64044,6,5320},{64256,0,9358},{64257,5,112},{64259,5,9359},
+{65072,0,7898},{65073,5,7892},{65075,0,7890},{65077,5,7899},
+{65079,5,7905},{65081,5,7901},{65083,5,7915},{65085,5,7909},
+{65087,5,7907},{65089,13,7911},{65281,26,5322},{65288,5,674},
+{65290,22,5329},{65296,37,780},{65306,5,639},{65308,18,5335},
+{65313,101,790},{65339,22,5340},{65345,101,816},{65371,14,5346},
+{65377,249,327},{65504,5,713},{65506,14,5350},{65512,0,323},
+};
+
+static const unsigned short cmap_UniJIS_UCS2_H_table[5354] = {
+107,61,99,720,647,152,140,109,153,151,154,129,
+707,694,645,159,778,117,134,160,144,123,695,142,
+696,148,9366,9361,9369,9364,9395,9407,12092,9400,9412,9367,
+9362,141,147,9436,9370,9365,143,149,223,227,9405,9417,
+9368,9363,9404,9416,225,229,9394,9406,9398,9410,9401,9413,
+9403,9415,9426,9429,9432,95,129,226,133,135,137,134,
+136,12090,12096,9397,9409,231,633,662,14,114,114,138,
+661,666,669,668,734,12111,8305,8304,8055,228,736,739,
+12201,12215,8013,8012,8014,8011,759,755,760,741,12091,742,
+7625,693,12118,767,703,7629,756,748,747,8195,7624,704,
+768,665,766,698,761,12188,12186,12189,12187,12186,12190,7897,
+668,8250,8249,8244,8243,8242,8241,8240,8239,8238,729,728,
+8015,12239,12237,731,730,12195,8010,733,732,12194,8009,727,
+726,723,10502,725,724,8258,8257,12254,722,721,8219,8222,
+8211,8017,8019,8213,8018,8212,8214,8016,12100,774,4209,14476,
+4646,3762,4739,4779,15391,14530,13852,14561,5059,3644,3773,14749,
+15398,14780,13729,13995,14999,2260,14905,13922,15000,14999,14189,13747,
+13646,1931,15114,13870,2658,15403,15184,3029,15255,15262,13645,2664,
+13847,13849,13848,3380,1323,1200,8371,4095,4097,1333,4102,3275,
+4110,2579,4208,3286,3392,4219,4227,4233,4243,4248,3163,3991,
+4294,4307,2375,3708,4316,4321,4328,3746,1969,4459,3156,2204,
+3878,2887,2433,2208,4622,2631,2454,4646,4648,4658,2177,4716,
+1979,1918,1738,1519,4739,4741,4761,4763,4768,1655,14521,4783,
+4785,2554,4930,1921,2326,2215,5058,3592,3143,1740,3661,5088,
+3284,5132,1860,3814,1853,2221,5349,5364,5368,3450,3807,2223,
+5378,2603,1360,3066,3541,5604,5606,3618,1383,1671,1880,1904,
+1732,1245,1504,1537,2652,3899,3134,3479,14848,5783,3368,3453,
+2172,3816,3779,3836,2676,2260,14913,1363,1856,3953,2971,3606,
+2227,1544,6163,3901,1227,4061,2261,6205,2262,6227,3281,2569,
+2263,2232,1235,2697,2726,2360,2081,2541,6322,6479,2988,1858,
+2022,1189,6635,1887,1455,1908,2921,3198,6742,6745,1419,2682,
+2808,2829,2574,2306,2575,2914,15183,3874,3243,3428,3948,1754,
+3029,3827,3550,7113,7115,1229,8695,3463,3800,1461,7171,7173,
+1339,3607,3561,3464,2543,2335,2035,3333,2062,2036,7276,7293,
+1614,1685,3031,7414,2267,7425,3729,13323,1642,2055,7446,7449,
+3102,1937,2767,3475,655,8308,735,740,665,7608,7609,8058,
+638,660,8143,8141,8148,8147,8204,8142,7620,8151,8149,8144,
+8139,8146,8140,8150,8205,8145,8138,10471,8161,8160,8162,8156,
+10495,8165,10492,8158,8223,10489,10488,10494,8319,8191,10479,10491,
+10490,8154,8157,8159,8163,8153,8164,8155,8152,8042,11876,8183,
+11877,11881,11879,11884,11882,11886,11888,7595,7586,8041,8039,11896,
+8040,11898,8038,8043,11907,11909,7596,7590,8052,7598,8049,11921,
+8327,7592,11930,11932,8046,11933,8047,11926,11934,11935,8045,8050,
+11943,7585,7599,7588,8328,7593,11950,11954,11951,8323,7623,7622,
+7621,8054,8037,8024,8026,8186,8020,7607,8021,8187,8030,8029,
+8028,8027,8034,8182,7611,1200,3000,3754,2510,2174,2509,1340,
+3526,3881,4091,1233,1484,4092,2632,4311,1648,3594,2511,14298,
+4093,14299,14157,2980,4094,1778,4095,13981,1561,2926,2323,4096,
+4098,3307,14304,1649,3259,1911,3681,6480,4099,2512,4100,1333,
+14305,1757,1956,3829,1505,14306,1615,4102,3971,3879,2794,4104,
+2244,3275,14307,4107,1248,1939,1938,1194,14308,4081,4080,2083,
+1125,3682,4111,1958,1195,3744,3070,3972,14309,2579,13856,2372,
+2580,4119,4118,1650,2067,1392,4116,4115,3577,14310,2196,2195,
+2846,4120,3527,2699,656,4121,4123,14311,8372,2885,4009,1166,
+4122,1342,1861,4124,3290,8373,14312,14313,8374,1575,4125,1167,
+14314,1940,1576,3564,3398,1651,4160,3131,3362,4127,2547,8376,
+2197,14317,2245,1344,2912,4131,1168,3071,2373,2084,3854,2862,
+14319,1343,8377,4130,3880,4126,4128,2142,4129,4563,4140,4138,
+3595,4132,14320,4136,1959,8379,4011,4139,8378,4142,14323,4135,
+8380,1689,1690,1345,3751,3552,1960,2549,3967,14324,3624,1806,
+2821,1380,8364,2397,8382,4146,14325,4151,4149,15407,4144,2831,
+4147,4150,4148,4145,7660,2548,2350,4166,3496,4161,14326,4165,
+8385,4159,4168,5632,14329,4167,3159,1961,4154,14330,8386,2310,
+4162,8384,3647,2955,4158,1863,14331,4155,4163,4157,3993,4164,
+4071,14332,8389,4169,8387,4170,4174,1170,3616,4173,4172,4176,
+14333,1864,14334,2822,3073,1774,2175,3467,4180,2101,3885,4183,
+4186,4182,2100,14340,3207,3707,4188,8392,15408,3973,4190,14341,
+2768,4191,4193,14343,15409,8391,4195,14344,4196,4201,4200,4199,
+4202,14347,14348,2440,4204,4207,4206,1897,1809,2374,3001,1692,
+2700,1963,8393,2048,4211,3796,3136,8394,3286,13966,2742,3392,
+1964,4065,4217,3596,2838,1769,3119,14201,3258,1281,4222,2157,
+4221,2102,4223,6235,4224,3695,4225,1507,14350,4230,4228,3785,
+4229,4234,2131,4238,3830,4012,14351,4239,8396,15410,2636,4240,
+2404,3002,3975,3162,4242,8284,1725,14352,4243,3724,2418,2908,
+4245,3260,8397,4246,14353,4247,1420,14354,4248,1695,3236,1308,
+2394,3381,4249,2581,4250,3580,2686,1502,1509,4251,14357,4252,
+8398,3409,3612,3938,4255,2637,2158,1866,4258,2199,2049,3074,
+4260,14358,2143,7774,4263,1867,2126,3363,14360,4267,4265,3565,
+2514,4274,1474,4268,4266,2769,1846,4275,3957,4276,4273,14361,
+4272,3991,8399,1965,1347,2431,3154,2039,4049,4282,8401,4283,
+3856,14362,3625,4285,1510,3775,2441,4286,3639,4290,2638,4287,
+1736,4288,1511,1796,4291,1967,3818,8403,3828,3279,3649,4295,
+8404,4296,4300,4299,4301,1341,3706,2156,4302,2442,1697,4303,
+8405,4307,3478,1760,1193,14366,3223,4308,2375,4310,4309,2443,
+1941,4312,3410,14368,14367,4313,3440,2836,2894,1696,3270,2927,
+2702,14369,4317,1230,1209,1577,8406,2824,1643,3931,4320,1335,
+1898,4323,4325,4324,2597,1243,1280,4326,8408,1899,2176,4329,
+3746,2085,1652,3857,2770,3411,2345,2324,2337,2432,14372,3412,
+1253,2771,1969,1913,1759,14373,4336,2911,2910,1699,2444,4337,
+4335,1348,2886,2276,2201,1224,14374,1486,2040,2200,1635,1444,
+2041,1634,3067,1223,3209,3786,1971,3939,3137,1970,1755,3704,
+3441,14375,1653,2599,3581,4344,4340,1943,13775,4341,3076,1942,
+2050,14376,4349,2338,14378,4356,4354,3759,14379,4351,4360,4355,
+4358,1914,3787,8412,2144,4072,14380,4352,4350,4362,14382,4365,
+4374,4367,4371,8413,4372,4368,14383,2137,1423,4366,14384,4376,
+1210,4375,14385,1129,3516,4373,14386,4364,4370,2104,1211,4386,
+2445,3735,4384,4383,2086,2550,14388,4380,3164,4391,3853,4396,
+4387,2895,4393,2446,4392,4398,7633,4404,4409,4410,2739,8415,
+4412,14394,1972,4402,3003,4406,4399,1513,1578,1475,4407,4403,
+1868,4413,4411,2773,1636,1700,4417,4415,2202,4419,4425,4424,
+14396,1349,4423,2448,1237,2532,4433,4432,14399,4434,14402,2747,
+4428,14403,4429,1579,14405,4439,4435,4438,4440,1443,4444,14409,
+7654,14410,4454,4452,4450,4453,4455,14414,7770,4459,4220,2344,
+2203,14415,1395,2946,14416,1171,2596,4461,1915,4463,4462,3632,
+4464,4466,4465,14417,4467,1282,4469,14418,4471,4474,1145,2127,
+14420,2957,4477,4480,2097,1973,2069,8417,2929,4481,3062,4483,
+4486,1813,14425,1974,1438,4490,4494,8420,8419,1196,3528,3347,
+1580,14432,3719,1870,2863,14433,4498,4501,14434,4505,7474,1283,
+3651,14435,2516,3138,3597,4005,1396,4507,2748,4510,3139,3166,
+3405,3049,7751,4506,8423,4515,3709,14438,8424,3583,4520,4514,
+4517,4519,14440,4524,4523,14441,2042,4525,4527,4526,14442,4518,
+4531,4530,4528,2204,2583,2774,4532,2656,1201,3354,4534,4533,
+3617,4539,8425,14444,1350,4540,3878,1422,4318,2386,2847,4541,
+3831,14445,4543,3121,2848,3529,1309,14446,2278,4546,1172,4547,
+14117,1581,3256,3652,4552,2775,4551,1814,8426,3721,4550,3167,
+4554,4553,8427,4556,14447,4555,8429,4557,2449,4559,2915,4558,
+14448,3587,2433,3157,4561,3287,3442,3805,4565,8430,2853,3731,
+8431,2106,2206,14449,2205,1149,1916,14450,2639,1173,4569,14451,
+1242,1515,3793,3491,13997,1127,14454,4578,13761,4576,4574,2551,
+4579,4050,3330,14457,4584,14459,4580,14460,14461,3783,4586,3492,
+4587,4591,4588,1351,4590,4589,1871,4596,4593,14466,2978,4600,
+4599,3064,14470,4609,14471,2208,4610,1976,4611,8432,2248,2840,
+2216,1977,1602,1917,4614,1462,4616,4656,13840,4623,1225,2325,
+1158,14475,2777,1516,2273,2347,1517,2982,3078,1148,1619,3653,
+1644,2703,2280,3858,4624,1424,1285,2452,1352,4625,3888,2387,
+8433,2320,4626,1583,3242,3765,4627,1508,1775,4629,2552,4634,
+2159,1353,4633,4631,4635,4632,3297,5262,2553,4636,8436,3004,
+4638,2864,2339,3559,2704,2297,4640,2453,1175,2842,2584,4643,
+3211,2454,4644,14122,13835,2456,4646,14476,3820,14478,2348,2312,
+2546,3276,2586,3468,3288,1729,4650,1673,4651,3239,1328,2209,
+4652,4655,4654,1781,3141,2292,7693,14479,2778,3940,4658,3246,
+1584,4663,2749,1568,4666,3764,4668,4670,1563,8439,4667,4669,
+3221,1702,1381,4675,4680,3655,3654,14484,8440,3169,4677,2398,
+4688,4682,1425,4683,4692,4691,4690,4686,14486,8441,8444,14487,
+14489,4696,4693,4694,8442,4697,8445,3170,4679,4710,4707,1564,
+4712,4714,4713,2706,2349,14495,2414,13362,2789,1979,2088,1980,
+1674,1918,4718,3762,3321,4719,1981,14496,2917,1738,13794,14497,
+2210,3533,4720,1585,4723,14498,14501,4722,4721,4724,2670,14502,
+2867,1596,4728,4727,3567,4732,3737,4731,14503,3388,4734,3598,
+4735,1519,3599,3301,1982,1520,4739,1900,3886,3859,1586,4741,
+1983,2457,3080,3657,3123,14000,1984,3155,2098,14506,14507,1919,
+1159,2424,1985,3889,4745,4031,4051,14510,4747,4746,14511,1445,
+3506,2459,4754,4753,4749,4760,4758,4759,4761,1286,3082,4762,
+1872,1398,3308,4763,3283,4764,4052,4765,3600,4768,4090,4106,
+14513,2268,3277,4769,1655,3008,1214,4770,3574,1986,8449,14516,
+3835,1901,1920,14517,4771,8450,3009,14518,1703,4773,13720,14519,
+3485,14520,4774,14521,4779,14522,4782,4767,4766,4783,1815,14523,
+13996,3481,8451,2108,3497,3010,3517,4784,2460,1256,4789,1311,
+2640,4788,4787,1816,2868,4793,4791,14524,4790,3951,1945,2435,
+4792,3142,2376,3224,4796,4795,4797,1946,14526,4798,3566,2405,
+4799,3469,14528,3225,3011,13368,8452,14529,3114,4800,1605,2554,
+14530,3486,1587,3292,4801,2212,1312,4806,8453,2983,14532,4854,
+4805,4802,14535,2060,4814,4820,4812,4817,3535,14536,4811,14537,
+4816,4015,2213,2869,4809,1656,4819,2641,1287,4813,1400,4818,
+4823,4833,4831,4827,4032,4836,4822,4826,4810,14539,1402,4830,
+4832,2959,2072,1336,4824,4835,4834,1707,2825,1476,4840,4842,
+8455,2281,8456,4848,3084,4838,4841,4843,14541,1947,3860,1521,
+14542,1275,4847,3312,1137,3445,4807,4853,4857,3825,3171,4855,
+2520,4856,3247,2061,14545,2671,8457,1176,4851,4849,4839,2178,
+2854,4870,8460,2781,4865,14546,2322,4866,4869,4864,2351,3848,
+3847,1770,1130,14550,1522,8459,4868,4876,4875,4879,4882,4874,
+4878,4873,2250,4877,2870,1988,4859,2555,3755,1523,1819,1426,
+3968,4892,1178,4894,4885,4891,4898,1818,4886,14552,2816,4033,
+4906,8464,4899,4904,3212,14554,1820,4907,4902,14555,4914,4915,
+2073,4913,4911,4910,4917,4909,4919,4922,4912,1874,4927,4926,
+4928,4925,4929,4933,4932,2377,2642,1382,1404,8465,4934,14557,
+1155,2672,4935,6756,4936,1847,14558,4938,4939,1620,4940,13390,
+3690,2420,4943,14560,2708,6938,3446,2326,14561,2109,4944,3575,
+14563,4953,2461,1621,4951,4958,2462,13765,4952,3322,4959,3172,
+4956,1989,2690,4973,3400,3448,5042,4962,1313,2984,14564,2930,
+4965,4972,4967,4974,4970,4969,3365,4963,1405,4961,1675,2899,
+4957,4960,1990,2687,2463,4968,3336,1676,1446,1477,2535,4976,
+4981,4982,2160,2043,2352,4964,2251,4979,2214,4980,1160,14566,
+4975,14567,14568,1677,4978,1131,14569,3086,3432,4984,2784,2169,
+4985,4987,4983,3659,2298,4999,4992,2465,3264,3303,2783,14575,
+14576,2340,4995,4989,4994,14577,14578,4996,3955,2110,2931,4993,
+1991,2602,1288,2750,4991,1631,3051,4997,2839,5008,3507,3087,
+14579,5006,3890,1525,14580,13340,1588,1289,8467,5007,13892,5018,
+14582,5012,7724,5009,5016,3414,3173,2630,14587,2179,5025,8469,
+3213,3115,5026,3323,2161,5034,5029,3892,5036,2786,8470,3105,
+5043,14590,2162,5038,5037,5048,5046,14591,5049,14592,5051,2521,
+14593,5054,5052,14595,5053,5015,7831,5056,5055,5023,5057,5045,
+5061,5060,5062,1406,3660,2643,14596,5064,5067,8471,3524,5066,
+5065,3338,5068,1709,5070,5069,1526,2180,3248,14597,2644,3106,
+3537,5072,3592,4620,2666,3449,3415,5076,2300,1740,2673,5078,
+2192,2949,2217,2557,1305,2218,5082,14600,5080,5083,3969,5081,
+2719,5084,1591,13701,3284,2932,1670,2219,2787,2406,1140,14601,
+5090,14602,1314,5094,1993,5093,2075,2466,8474,5092,3788,2074,
+1179,2674,8473,8476,2645,1257,8477,2399,3732,2146,14603,2468,
+8475,2635,7680,2985,5103,2252,1994,5101,2558,14604,5105,5104,
+5109,14607,5110,14138,5106,8478,1408,3539,1824,5111,8482,2646,
+2469,14609,5112,5116,1355,5113,5115,2950,1161,5117,8483,5125,
+5120,5122,8486,13397,3254,14611,5121,2422,5127,3893,3374,1730,
+1258,1995,5133,5134,2427,2788,8487,8369,4333,2752,2751,2872,
+2103,1860,3863,3568,8488,5135,14614,2147,3035,5136,4053,3015,
+5137,1592,3760,3748,3722,2163,5141,14615,3711,5143,5146,5145,
+14616,2623,3941,1165,2128,2844,5148,2827,5149,2522,3817,3922,
+8490,1996,13681,3339,5154,3174,5091,5095,1641,14618,3325,14619,
+5156,2470,3416,5159,5158,1356,2220,4078,5161,2619,1923,14620,
+14621,5167,5165,1357,5163,5169,5175,8493,2856,5176,3366,3693,
+1527,2715,2378,14623,3055,14624,3864,5172,5171,5174,5164,14625,
+2986,3844,2290,2148,3741,1439,8494,3050,3234,1259,7687,2648,
+1792,1997,1498,5182,1490,5188,14626,1449,2076,1448,2111,5183,
+1851,1825,3175,8495,5184,5186,1733,1794,8492,1528,1637,14629,
+2153,3743,5202,14631,1331,5191,5208,5192,5199,14633,3349,5207,
+7836,5194,1144,5196,5193,5204,14634,4542,1948,3942,3088,1409,
+2077,14635,5187,5203,1471,5201,5205,8367,3797,5210,1593,8496,
+14636,5218,5220,14637,5224,5212,3177,5228,5215,5219,14638,14639,
+2559,5229,5227,1529,4086,5209,5223,1180,3782,5216,2536,3043,
+5206,14643,5222,14644,2624,5232,1487,1877,5234,5213,5233,5226,
+5214,3238,14645,5221,3560,5241,2858,5247,2753,5238,5251,5250,
+3271,5249,3266,14648,5253,5240,1728,5243,2407,14649,3350,5245,
+1731,5237,5239,5236,4054,1464,5242,5252,1427,4055,5272,2560,
+5271,14652,5267,14653,5255,5284,5254,5260,5257,5263,1999,3044,
+2790,5261,3895,3736,5264,5274,5282,5275,13679,5288,14657,5276,
+5289,3465,5295,5290,5293,5287,14659,5285,2472,3803,5305,5292,
+14660,1878,1315,1469,14661,2473,5297,5304,2341,1488,2924,14662,
+5294,14663,8504,5299,5303,1638,5301,3235,5300,5296,8505,8506,
+1470,2951,14668,5309,5307,1949,5306,14670,5291,5316,5315,5324,
+1779,14674,5320,5322,14675,3387,5329,5326,3933,5327,1239,14677,
+5333,1853,2253,1741,14678,5335,5334,5337,1623,1742,1530,14680,
+5339,1531,5344,5346,14682,5347,2221,2649,2065,13386,3554,3634,
+4074,13785,2112,4026,14683,5353,5352,2408,2328,2194,5356,2537,
+5363,5362,5364,1317,2952,2164,1450,5366,14684,3132,4509,1597,
+5367,5368,14148,3644,3734,13388,3231,5369,3450,5372,5371,2223,
+14687,3773,5381,5380,14688,2603,14689,3499,1260,3417,8510,3089,
+2379,1659,14691,1306,8511,3274,5382,2000,2961,8513,2849,1660,
+5393,1854,14693,1599,5391,5389,5386,3914,14694,8512,3249,5387,
+5394,1785,14695,1325,2091,5388,5390,14696,3717,2900,14153,3749,
+3576,3849,5406,2255,2474,5399,5405,1290,5396,5401,2712,3367,
+5398,14698,3663,14699,5400,5409,8514,5407,14700,3664,3326,1661,
+14703,5408,2873,5397,14704,3896,5421,14706,5420,3214,5411,1262,
+2001,5414,2353,5419,5418,5413,5415,3327,2524,2713,5427,5425,
+5422,5424,14710,1244,2002,4056,3540,8517,1410,2561,5426,8516,
+2475,13354,5429,8518,3181,3226,14712,3918,14713,5445,5439,5436,
+14714,3996,5442,8520,15414,2388,5444,5449,14715,3179,5447,13395,
+5443,14716,5450,1216,5440,2562,8522,2409,2078,8521,5432,5446,
+3124,8523,1479,2113,2476,5434,2380,5455,2423,1902,5464,1678,
+3145,14717,5459,5468,1139,1236,8526,5461,2828,5452,5454,2003,
+5471,8524,5466,15415,5465,5463,5467,2935,8525,5453,3180,4087,
+2282,3756,5484,1903,3959,2004,5473,13324,3897,5476,5480,3795,
+5475,14720,2254,5499,2892,2874,5502,5492,14722,5493,5469,1683,
+3500,5501,1291,2792,1533,4034,14724,3757,3054,5496,5498,14726,
+5500,5494,14727,5509,2716,14728,1473,5511,3016,5508,3061,5513,
+14730,5507,5506,5512,14732,5515,5516,14733,1534,13884,5520,5522,
+8530,14738,1849,2905,5517,3313,5529,5527,14739,5533,14740,5526,
+2044,3294,3934,5528,5532,2901,8531,7076,14741,5536,8532,7760,
+8533,5542,5541,5544,3244,5546,2995,2893,8534,5551,14748,1360,
+14749,3182,1411,2314,2114,14750,4045,2604,8536,5556,2936,5559,
+5554,14753,5557,3130,1181,8365,14756,5563,14757,5562,5567,3586,
+14759,3777,7644,14760,4035,14761,5569,5574,3351,5568,5571,2480,
+3898,5579,3183,5586,5585,14768,5587,1295,14769,5582,4430,5589,
+2793,2182,5591,5590,2538,4334,5577,5593,8544,5595,14770,3066,
+14772,5601,5600,2315,3541,2776,2256,5608,3618,3419,5609,3341,
+3017,14775,5610,1383,1671,14778,3794,1332,4058,1879,5612,2116,
+5614,5613,1880,14780,8545,5621,1712,5622,5624,5623,14782,3232,
+1713,5631,2922,5630,14783,4059,3352,5636,5633,3808,5635,5637,
+8547,5641,14786,5640,2996,3299,1881,5639,5642,1296,14788,2056,
+2224,8549,5650,5653,5652,14790,14791,1904,14794,1762,15423,1565,
+4016,5655,13802,5657,14802,8550,5654,8551,2183,3037,5656,14803,
+8553,15417,5659,14805,1812,3421,5660,14806,8556,14807,1905,1663,
+14808,5663,3943,8555,3960,14809,15418,2902,14812,5665,8557,14813,
+8559,8558,5667,3998,1743,3472,3328,14818,5668,5672,1950,1263,
+5674,2614,5671,4004,8561,5677,7477,5675,5678,14826,5664,5676,
+14827,5682,8563,14835,5662,14836,5683,14837,3501,5689,1504,5690,
+5692,14160,3525,5697,5696,5699,5698,5700,5701,5703,5702,5706,
+2652,13790,2184,1307,5707,3635,5708,8434,3134,3869,2005,2563,
+2953,4297,3018,1384,5709,5713,5712,5063,1412,5711,14844,1182,
+3961,5716,5714,2970,2634,5718,3956,1827,5719,5717,3434,5720,
+15419,5721,8565,1183,2526,5726,14161,5723,3269,5722,14845,14846,
+5729,5728,5727,3479,2756,2755,14847,1625,5742,3452,5736,14850,
+5738,5740,2564,5741,5739,2284,5735,5737,2258,2079,3185,5746,
+3945,5747,14851,14852,5754,14853,5752,5759,14854,5757,14858,5760,
+7725,5761,5766,14860,3981,14861,14862,1566,5780,14864,14865,5781,
+14866,5782,3395,3146,5785,3368,3494,8566,5787,3108,1413,2006,
+5788,8569,8567,5800,3340,14870,3725,14871,5801,5802,3178,2653,
+5336,5804,3789,1538,3435,5806,5810,14873,5812,5811,3473,1539,
+1885,5816,2565,3774,8572,5822,5823,5826,14876,2605,7877,3228,
+5827,3713,14165,5825,14880,5829,5828,14166,14882,2400,3982,5846,
+3779,5847,3836,5848,2956,14883,3360,2937,5849,1714,14884,2676,
+14885,1882,2117,5854,8574,14887,3152,2118,1640,3329,14891,8575,
+13342,3962,2007,5859,3090,5862,1429,5857,2685,5865,5873,5868,
+5874,5869,14895,3436,5867,5876,3727,5882,5881,5855,5885,5884,
+8578,14903,2260,14905,4017,14906,2302,5886,1805,1626,1601,2225,
+5891,2758,5888,2389,2566,5889,5887,5894,5916,1744,4067,2743,
+5895,14910,1362,3091,3569,1684,5897,3295,7758,1745,1363,3229,
+2354,2226,5904,14915,2355,1354,3509,5909,3359,2567,5906,5910,
+14918,5911,2667,14920,5915,5914,14921,2331,5917,1204,5918,1364,
+1828,5919,2008,2052,3638,5921,14923,3714,14924,2677,1265,1338,
+1136,14928,5929,1773,2692,2149,2976,2797,5933,5935,5932,5934,
+1784,14929,5936,1788,1665,3900,5938,1492,5941,5940,14934,5944,
+5937,5945,3953,8585,4549,5949,3965,5952,7176,2487,3216,5955,
+8586,2918,8588,2938,5957,4214,2971,2271,5961,14935,1666,5960,
+5973,2592,3542,14937,5967,5966,5968,5975,3488,14939,3386,3187,
+1746,5974,5972,14940,3401,5969,2972,3189,14173,3188,5982,14943,
+5983,5978,5976,3615,1365,14945,5991,3369,3763,2185,5985,5994,
+5989,5988,5984,8589,5986,2693,5996,6000,3619,5995,5997,3230,
+6006,6005,6015,6012,6003,4330,6010,6004,7739,6019,14951,1542,
+14952,6017,6018,6021,14954,6020,3466,6022,4036,3645,6027,6023,
+2678,6026,6028,14955,6029,14956,6030,6007,6031,6033,1734,1791,
+6036,2760,3306,6042,6040,6038,1501,2489,6043,6039,6047,6046,
+6045,6044,14960,6049,2654,14961,6050,3190,14964,6053,14965,6055,
+14966,3589,2798,2009,6062,1829,3839,2010,6063,6067,3826,14971,
+2413,6066,2303,2011,2228,1667,3590,6065,14972,2761,3696,2151,
+14973,2229,3065,6070,4007,2121,6071,2568,2490,2080,14974,2356,
+1906,2762,6068,6074,6069,1830,6077,6081,1857,6085,8592,14977,
+2012,3927,1152,6082,3191,6078,6075,1414,2696,1884,14978,1831,
+2835,6088,2800,6101,8594,6097,6091,6095,2342,1185,6090,6098,
+6102,2013,3810,3058,6092,8593,6100,6089,2940,6094,1153,3798,
+1747,3456,14982,3992,2425,6141,8595,6099,6104,6106,3093,6109,
+13322,6105,3620,1543,14983,3799,14984,6108,3268,6110,14986,6117,
+6111,6118,14987,6114,2294,6116,14989,6113,6119,6112,6115,6127,
+6124,6128,6122,6096,2679,6120,14990,14183,2723,1832,2539,2744,
+6131,6130,6132,7697,14991,6121,6129,6137,6136,7671,3752,14992,
+6139,6138,6142,2186,6140,6147,14994,6153,3125,6149,14995,6148,
+14997,6158,6165,6164,2129,1833,3457,6172,4918,6173,6175,3919,
+6174,6177,6176,6181,6180,6183,1800,2724,1627,6187,6184,6189,
+6186,6195,6194,15005,2607,6196,15006,6197,1569,15007,6200,15010,
+3723,3917,3902,4061,14099,2015,6203,2304,6202,6204,2261,2865,
+15012,6205,15013,2014,15016,6212,15017,2941,3593,6218,15018,2801,
+6219,4038,6223,15019,6222,6221,3020,15020,6224,2540,6226,4062,
+6227,6228,6230,6229,3385,4068,3389,6233,6231,1546,15021,1928,
+2230,3458,15022,1886,3697,15023,6236,6234,2017,1197,1187,6241,
+6239,6242,6237,6240,3668,1217,6238,6257,3315,1716,2668,4076,
+3770,6244,2680,1645,6247,3021,15028,15029,6251,15030,3543,6256,
+6255,2018,4089,2058,6258,3022,3570,2725,2876,6266,15031,6267,
+6263,15032,3738,3482,6271,6270,3698,6274,2745,15033,6276,6279,
+6277,3317,6280,6288,6283,6287,6286,6289,6292,3999,2232,2965,
+6299,1717,5039,6300,2697,6301,2295,6303,3630,1560,2726,2402,
+3555,2360,6304,2020,6305,3424,15038,6307,15039,2857,3371,1907,
+6306,2727,15040,3094,6310,6309,6312,2081,3985,6320,2541,6324,
+15043,1415,1142,6326,6329,3332,15044,2570,15045,1843,1748,1386,
+15046,1503,15047,1299,6333,4018,2877,1367,6343,6341,6332,2319,
+1764,2997,6335,6334,6340,6336,6339,8600,3804,6338,1368,1499,
+6342,6350,6349,6347,6346,2977,2907,6352,2802,1835,1251,6353,
+15050,2021,1326,6369,6359,15052,6367,6374,6368,15053,6366,15054,
+6337,1548,6362,6373,6375,15056,6361,3378,3147,6387,3646,15059,
+6378,1370,1930,3483,6388,8604,6385,6381,3218,7807,6383,3670,
+6389,1188,15060,3361,6397,6398,3928,8605,3903,15062,3556,6413,
+3193,6402,2804,6396,6404,6409,1134,15063,6401,6410,3562,2528,
+6414,6419,2805,6415,15066,6422,15067,3904,6412,1430,6421,3768,
+6417,6420,6435,15069,6427,2287,3758,6434,6433,6431,1218,15071,
+2818,3603,7861,6436,6440,6439,2494,2293,6442,3563,6438,8608,
+6399,4085,3194,3557,8609,6454,6446,15073,6458,6447,6452,6455,
+6449,2165,2571,1798,3840,15076,3845,2428,8611,6462,6460,3935,
+15075,6461,6463,6467,6465,3195,6466,3425,6453,6468,6473,2806,
+6474,2763,6469,6471,15077,6470,5328,5313,5809,6477,6479,1931,
+6481,4244,1679,13336,3970,1771,6482,2988,15081,3282,15083,1150,
+6486,3320,6492,6495,6494,2308,1836,1440,6500,6503,6502,3514,
+3438,6505,2909,6515,15089,6511,15090,1387,3672,6510,6508,6513,
+6516,15091,6512,6506,15092,2966,15093,6523,15095,6522,15096,6518,
+4063,6527,6525,6524,3920,6552,6551,6550,15104,7715,15105,6537,
+15108,8614,6557,6561,6556,15110,6565,6564,6567,6566,6497,2022,
+5412,6575,2395,15112,1431,2495,6577,15113,2023,6578,1189,15114,
+6584,6581,1750,6580,6587,2837,6588,15115,6591,15116,3459,6595,
+6597,1927,6585,2123,4030,2807,14217,6600,3871,15121,3636,6603,
+6609,2496,6607,8615,3921,6604,6606,2657,2628,15124,3571,3673,
+6613,8360,6625,6615,6614,6620,6624,7120,6627,1751,6626,6635,
+2658,13870,3905,3572,3324,6637,6638,1887,2233,3319,6640,6643,
+3937,6642,2572,6646,1549,15134,2542,6654,1908,13756,3095,6657,
+15136,1837,3196,15137,6659,8616,1799,15138,6658,2903,1607,15139,
+1859,3841,2764,6664,8617,2573,2990,2498,2094,2850,6667,2499,
+3504,6673,1838,4083,6672,6671,2729,1639,4073,1432,2500,6676,
+6674,2237,3293,2659,6678,6683,1953,8619,6677,2694,3233,8620,
+3024,2661,1550,6685,6687,6698,3025,6697,8621,6694,6702,6695,
+3096,6690,3851,2238,6689,15142,8623,6696,2430,3699,1276,1190,
+6703,6705,1888,6701,2024,15143,6706,3906,6710,3495,6716,6715,
+8624,15147,6720,6719,3546,6721,6723,6724,1630,6190,2529,8625,
+6727,3198,15150,6738,15151,6742,2501,6743,2045,4103,6744,6745,
+3505,6746,6748,6750,1419,3075,3547,2130,2025,3521,1375,3426,
+6758,1551,2681,6757,6762,2999,3823,6763,3353,2879,3461,3127,
+6759,3701,1388,6765,4046,3038,4075,2239,6764,6781,2730,15154,
+6768,2189,2240,3355,15155,1889,6767,6766,2026,6769,15157,6775,
+2819,6774,1570,6776,6778,8628,6780,6782,2299,6784,1456,15160,
+6785,2808,6786,6787,3549,8629,1609,15161,3026,6798,6796,15166,
+6793,6794,6797,6802,15167,3199,6809,6810,15169,6814,6812,6816,
+6820,6817,6815,15170,6818,2684,6823,6825,6822,6833,6832,6835,
+6834,6837,15174,6836,6838,6840,2574,6842,15175,1765,6843,6845,
+6847,6844,2306,6849,1610,1801,15177,1890,3128,6851,2272,15179,
+6853,6852,1840,6855,2124,6856,6859,6861,3637,6858,6864,6862,
+1611,3344,4000,3852,6869,6872,3883,1483,6870,6875,6873,3116,
+6876,2575,6882,2265,6883,15182,4278,4277,6885,6143,6886,2914,
+2545,3318,3621,3056,2064,3750,2589,15185,15187,6889,1376,3278,
+6891,3373,6892,2396,15188,3790,6909,2880,2809,15189,3200,6895,
+1647,6901,6914,3201,2974,6898,3098,3149,6899,6903,2598,3357,
+3048,2662,6902,2830,2820,6900,1133,4040,2367,2576,6907,6906,
+1203,6908,3251,2609,15191,2967,6915,3873,1249,3623,1377,3219,
+2913,1191,6917,6918,7476,1301,2766,8634,6920,3110,2810,2307,
+6921,2415,6922,2733,2732,3987,6926,3462,6928,6927,6925,5943,
+1552,6893,15192,6930,6929,15196,3257,15197,6935,15199,8635,1802,
+6936,15200,3875,6944,15203,6943,15206,3243,6945,2368,2316,3345,
+2991,15208,2595,6948,15209,6949,6950,3929,6952,6951,2053,2190,
+2889,15210,6959,6957,7707,7777,15215,6961,6960,3428,2115,2317,
+6965,6966,3948,2383,3834,3988,6967,1754,6968,8640,3101,8639,
+6971,1494,2577,8641,6969,3715,1780,15219,6972,8646,15220,3255,
+1441,8647,6980,6977,6979,15221,7050,15222,4019,1934,15223,8655,
+8649,6988,8650,15224,3118,6983,15225,6986,6984,8652,15226,6990,
+8654,8653,6995,1302,2504,8656,6987,6992,3028,6994,6991,6996,
+8663,3677,8667,15231,8666,6999,3631,3512,2992,1682,8368,7001,
+8670,2031,7000,2611,2612,7004,7006,8674,8672,15234,2531,8669,
+7005,7007,8668,1739,15235,3511,2318,4041,7003,2152,7008,7010,
+15236,8361,13400,3265,7015,8677,2945,7011,1795,15240,7014,2095,
+2811,3046,15241,7020,15242,7028,3111,7027,8680,1720,15246,7030,
+7024,15249,7036,7033,7032,2506,3202,7031,15250,7039,7037,7044,
+8683,1553,7043,3846,7055,7045,7049,15253,7056,7054,7057,7059,
+3029,15255,7060,2736,3604,7062,1417,1555,8685,1554,7063,1556,
+1459,2032,3402,15256,7069,7068,15257,13653,1278,7072,7071,15260,
+7074,7079,7078,7081,7080,7082,7084,7086,3550,15262,1128,2859,
+15263,7091,7094,7092,2033,7093,1910,3605,7096,7098,7097,7099,
+1219,2590,2438,1557,7100,7101,3040,3989,3203,7095,3950,15265,
+1777,3964,2882,6252,7103,1418,2613,1460,7105,7106,7104,1850,
+2125,2507,8688,4001,15266,7108,6923,15267,7107,8689,7111,7113,
+4020,2669,3407,2627,1571,3876,1389,2370,1935,7117,2241,7119,
+7116,2166,15268,7123,6546,2621,7121,3949,3273,1229,15271,2695,
+2274,3591,15272,1250,4021,3925,7126,2578,7127,15274,4022,7122,
+7129,7131,4048,8690,5140,7137,7143,8692,7140,7142,7144,8695,
+2664,8696,3843,2665,15275,7146,7430,3800,15276,7147,7149,1461,
+2591,15277,15278,1786,7153,7157,1489,7154,7158,15280,7165,7173,
+3289,7175,1339,15285,7178,7177,3607,3030,2066,2034,2417,15287,
+7179,3884,1572,3430,3252,2626,3990,15289,7182,15290,3705,3204,
+7184,7181,14259,3523,3924,7185,15291,7188,2890,1573,1894,8697,
+1574,15294,7752,3129,7189,15295,7194,7193,7200,7199,3464,6201,
+2543,13848,4289,5338,3431,2242,3678,2534,7205,3910,7206,1390,
+7207,7213,7209,8701,1559,7222,7225,15304,2968,3267,2860,1274,
+1766,1767,15310,2993,7237,1768,7244,15311,1613,7245,2813,1895,
+15314,2861,15317,7250,15318,7252,7254,7257,8704,7256,15320,7259,
+1723,7258,7263,7262,7264,7266,7265,2036,8705,3397,7281,3480,
+7282,7280,7290,15325,5332,7300,6057,1614,1407,2082,7302,7301,
+3761,8708,15328,7308,8707,1154,8709,7311,3579,7309,15330,7316,
+3740,2171,2154,2737,7318,15331,7321,15332,1957,7319,2168,15333,
+7329,7326,7325,7327,15334,1845,7333,7332,7331,7340,7336,7342,
+15339,7338,1472,7341,7337,7335,7334,7347,7346,3515,7344,1207,
+7349,1485,7330,1241,7352,7350,2923,3742,15344,7357,15347,7358,
+7364,7360,3679,3792,15348,7365,7366,3222,7363,7362,7367,2270,
+1321,7377,7376,7375,15349,7378,15350,7379,7384,7383,2054,3781,
+15351,7382,8714,3680,7390,8713,15356,7395,7400,7398,7397,7403,
+15357,7396,7401,15358,15359,7646,7406,2891,2141,15364,7413,1896,
+7415,7677,7416,7423,7421,4066,15365,7425,3380,15366,7426,7428,
+15367,7429,7682,7797,7427,2047,3801,3729,4740,5375,3753,13323,
+1323,7431,1642,8717,2055,5645,3815,2883,7436,7438,7437,15368,
+7441,15369,7442,15371,1937,2767,7454,7457,5898,6779,7174,4024,
+7460,15381,7469,15382,7470,7468,15384,7471,7472,5927,8443,8481,
+8497,8499,8542,8548,8571,8583,8587,8590,8599,8610,8622,8630,
+8636,8664,8671,8687,8702,8715,642,8007,716,712,715,717,
+8006,718,692,636,693,637,663,699,697,700,641,719,
+678,664,679,648,650,646,680,667,681,665,751,649,
+8005,711,
+};
+
+static pdf_cmap cmap_UniJIS_UCS2_H = {
+	-1, "UniJIS-UCS2-H", "", 0, 0, 2,
+	{ {2,0,55295},{2,57344,65535}, },
+	4964, 4964, (pdf_range*) cmap_UniJIS_UCS2_H_ranges,
+	5354, 5354, (unsigned short*) cmap_UniJIS_UCS2_H_table,
+};
+
+/* UniJIS-UCS2-HW-H */
+
+static const pdf_range cmap_UniJIS_UCS2_HW_H_ranges[] = {
+{32,237,231},{92,0,8719},{93,133,292},{165,0,291},
+};
+
+static const unsigned short cmap_UniJIS_UCS2_HW_H_table[] = { 0 };
+
+static pdf_cmap cmap_UniJIS_UCS2_HW_H = {
+	-1, "UniJIS-UCS2-HW-H", "UniJIS-UCS2-H", 0, 0, 0,
+	{ {0,0,0}, },
+	4, 4, (pdf_range*) cmap_UniJIS_UCS2_HW_H_ranges,
+	0, 0, (unsigned short*) cmap_UniJIS_UCS2_HW_H_table,
+};
+
+/* UniJIS-UCS2-HW-V */
+
+static const pdf_range cmap_UniJIS_UCS2_HW_V_ranges[] = {
+{32,237,231},{92,0,8719},{93,133,292},{165,0,291},
+{176,0,8269},{8208,0,7893},{8213,6,0},{8216,5,8281},
+{8220,5,8279},{8229,6,2},{8242,6,4},{8592,14,6},
+{8597,0,12214},{8644,10,10},{8678,14,13},{8741,0,7895},
+{8764,0,7894},{8943,0,7897},{9472,5,7481},{9474,5,7479},
+{9476,5,7485},{9478,5,7483},{9480,5,7489},{9482,5,7487},
+{9484,90,17},{9507,5,7530},{9509,30,40},{9517,9,7517},
+{9520,0,7516},{9521,9,7520},{9524,0,7507},{9525,9,7509},
+{9528,0,7508},{9529,9,7512},{9533,9,7543},{9536,34,48},
+{9545,5,7550},{9756,14,57},{9986,0,12178},{10145,0,8209},
+{12289,5,7887},{12296,37,7907},{12307,0,8270},{12308,5,7901},
+{12316,6,61},{12319,0,7957},{12353,0,7918},{12355,0,7919},
+{12357,0,7920},{12359,0,7921},{12361,0,7922},{12387,0,7923},
+{12419,0,7924},{12421,0,7925},{12423,0,7926},{12430,0,7927},
+{12443,6,63},{12449,0,7928},{12451,0,7929},{12453,0,7930},
+{12455,0,7931},{12457,0,7932},{12483,0,7933},{12515,0,7934},
+{12517,0,7935},{12519,0,7936},{12526,0,7937},{12533,5,7938},
+{12540,0,7891},{13056,0,8350},{13057,5,11958},{13059,42,65},
+{13070,21,11973},{13076,22,76},{13082,13,11984},{13086,0,8353},
+{13087,9,11988},{13090,22,82},{13096,5,11996},{13098,6,88},
+{13101,0,11999},{13102,9,12002},{13105,10,90},{13108,5,12008},
+{13110,30,93},{13118,9,12020},{13121,6,101},{13123,13,12023},
+{13127,14,103},{13131,5,12028},{13133,6,107},{13135,5,12030},
+{13137,14,109},{13141,5,12039},{13143,0,8344},{13183,0,8324},
+{65288,5,7899},{65292,0,8268},{65294,0,8274},{65309,0,7917},
+{65339,0,7903},{65341,0,7904},{65343,0,7890},{65371,14,113},
+{65507,0,7889},
+};
+
+static const unsigned short cmap_UniJIS_UCS2_HW_V_table[117] = {
+7892,7895,7898,7897,8273,8283,738,736,739,737,8311,8310,
+8312,8012,8014,8011,8013,7495,7497,7496,7498,7503,7505,7504,
+7506,7491,7493,7492,7494,7499,7501,7500,7502,7523,7527,7525,
+7524,7526,7529,7528,7535,7533,7532,7534,7537,7536,7538,7515,
+7541,7540,7542,7547,7549,7546,7548,7553,7552,8221,8219,8222,
+8220,7894,7956,8272,8271,8338,11960,8333,11961,11965,11963,11968,
+11966,11970,11972,7950,7941,8340,8330,11980,8339,11982,8329,8348,
+11991,11993,7951,7945,8356,7953,8358,12005,8334,7947,12014,12016,
+8343,12017,8349,12010,12018,12019,8347,8357,12027,7940,7954,7943,
+8337,7948,12034,12038,12035,7905,7896,7906,7894,
+};
+
+static pdf_cmap cmap_UniJIS_UCS2_HW_V = {
+	-1, "UniJIS-UCS2-HW-V", "UniJIS-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	105, 105, (pdf_range*) cmap_UniJIS_UCS2_HW_V_ranges,
+	117, 117, (unsigned short*) cmap_UniJIS_UCS2_HW_V_table,
+};
+
+/* UniJIS-UCS2-V */
+
+static const pdf_range cmap_UniJIS_UCS2_V_ranges[] = {
+{176,0,8269},{8208,0,7893},{8213,6,0},{8216,5,8281},
+{8220,5,8279},{8229,6,2},{8242,6,4},{8592,14,6},
+{8597,0,12214},{8644,10,10},{8678,14,13},{8741,0,7895},
+{8764,0,7894},{8943,0,7897},{9472,5,7481},{9474,5,7479},
+{9476,5,7485},{9478,5,7483},{9480,5,7489},{9482,5,7487},
+{9484,90,17},{9507,5,7530},{9509,30,40},{9517,9,7517},
+{9520,0,7516},{9521,9,7520},{9524,0,7507},{9525,9,7509},
+{9528,0,7508},{9529,9,7512},{9533,9,7543},{9536,34,48},
+{9545,5,7550},{9756,14,57},{9986,0,12178},{10145,0,8209},
+{12289,5,7887},{12296,37,7907},{12307,0,8270},{12308,5,7901},
+{12316,6,61},{12319,0,7957},{12353,0,7918},{12355,0,7919},
+{12357,0,7920},{12359,0,7921},{12361,0,7922},{12387,0,7923},
+{12419,0,7924},{12421,0,7925},{12423,0,7926},{12430,0,7927},
+{12443,6,63},{12449,0,7928},{12451,0,7929},{12453,0,7930},
+{12455,0,7931},{12457,0,7932},{12483,0,7933},{12515,0,7934},
+{12517,0,7935},{12519,0,7936},{12526,0,7937},{12533,5,7938},
+{12540,0,7891},{13056,0,8350},{13057,5,11958},{13059,42,65},
+{13070,21,11973},{13076,22,76},{13082,13,11984},{13086,0,8353},
+{13087,9,11988},{13090,22,82},{13096,5,11996},{13098,6,88},
+{13101,0,11999},{13102,9,12002},{13105,10,90},{13108,5,12008},
+{13110,30,93},{13118,9,12020},{13121,6,101},{13123,13,12023},
+{13127,14,103},{13131,5,12028},{13133,6,107},{13135,5,12030},
+{13137,14,109},{13141,5,12039},{13143,0,8344},{13183,0,8324},
+{65288,5,7899},{65292,0,8268},{65294,0,8274},{65309,0,7917},
+{65339,0,7903},{65341,0,7904},{65343,0,7890},{65371,14,113},
+{65507,0,7889},
+};
+
+static const unsigned short cmap_UniJIS_UCS2_V_table[117] = {
+7892,7895,7898,7897,8273,8283,738,736,739,737,8311,8310,
+8312,8012,8014,8011,8013,7495,7497,7496,7498,7503,7505,7504,
+7506,7491,7493,7492,7494,7499,7501,7500,7502,7523,7527,7525,
+7524,7526,7529,7528,7535,7533,7532,7534,7537,7536,7538,7515,
+7541,7540,7542,7547,7549,7546,7548,7553,7552,8221,8219,8222,
+8220,7894,7956,8272,8271,8338,11960,8333,11961,11965,11963,11968,
+11966,11970,11972,7950,7941,8340,8330,11980,8339,11982,8329,8348,
+11991,11993,7951,7945,8356,7953,8358,12005,8334,7947,12014,12016,
+8343,12017,8349,12010,12018,12019,8347,8357,12027,7940,7954,7943,
+8337,7948,12034,12038,12035,7905,7896,7906,7894,
+};
+
+static pdf_cmap cmap_UniJIS_UCS2_V = {
+	-1, "UniJIS-UCS2-V", "UniJIS-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	101, 101, (pdf_range*) cmap_UniJIS_UCS2_V_ranges,
+	117, 117, (unsigned short*) cmap_UniJIS_UCS2_V_table,
+};
+
+/* UniJIS-UTF16-H */
+
+static const pdf_range cmap_UniJIS_UTF16_H_ranges[] = {
+{32,237,1},{92,0,97},{93,121,62},{124,10,0},
+{160,0,1},{161,9,101},{164,54,3},{178,5,157},
+{180,30,17},{188,9,161},{191,0,126},{192,21,164},
+{198,0,139},{199,61,170},{215,6,25},{217,21,187},
+{223,0,150},{224,21,193},{230,0,145},{231,61,199},
+{247,6,27},{249,25,216},{256,78,29},{278,50,49},
+{292,30,62},{302,126,70},{336,186,102},{402,6,149},
+{450,0,15821},{461,62,151},{501,0,20354},{504,5,15731},
+{509,0,9421},{567,0,9435},{592,50,167},{606,14,180},
+{610,5,15883},{612,18,184},{618,0,15885},{620,42,189},
+{632,14,200},{637,6,204},{640,18,206},{648,42,211},
+{660,6,222},{664,6,224},{668,6,226},{671,0,15893},
+{673,6,228},{688,0,15894},{690,0,15895},{695,0,15896},
+{699,6,230},{705,0,15897},{710,10,232},{716,0,15847},
+{720,6,235},{728,26,237},{736,5,15898},{741,17,15851},
+{768,0,65},{769,5,127},{771,10,244},{774,9,130},
+{778,10,247},{783,0,15850},{792,5,15874},{794,0,15879},
+{796,0,15861},{797,5,15872},{799,5,15862},{804,6,250},
+{807,14,252},{812,0,15859},{815,6,256},{818,0,64},
+{820,0,15871},{822,0,138},{825,0,15860},{826,5,15877},
+{828,6,258},{865,0,15845},{900,5,20317},{902,0,20427},
+{904,9,20428},{908,0,20432},{910,10,260},{913,65,1011},
+{931,25,1028},{938,6,263},{940,13,20436},{944,0,20445},
+{945,65,1035},{962,0,16222},{963,25,1052},{970,6,265},
+{972,5,20442},{974,0,20446},{976,6,267},{981,0,12094},
+{987,0,12095},{1025,0,1065},{1026,41,20447},{1038,5,20458},
+{1040,21,1059},{1046,125,1066},{1078,101,1099},{1105,0,1098},
+{1106,41,20460},{1118,5,20471},{7742,5,15729},{7868,6,269},
+{8048,14,271},{8194,6,275},{8208,26,277},{8216,10,284},
+{8220,10,287},{8224,5,776},{8226,0,119},{8229,6,290},
+{8240,0,772},{8242,5,708},{8249,5,110},{8251,6,292},
+{8254,6,294},{8258,0,16282},{8260,0,104},{8263,5,16278},
+{8265,0,12112},{8273,0,16281},{8282,0,7898},{8285,0,7897},
+{8304,0,9377},{8308,21,9378},{8320,37,9384},{8364,0,9354},
+{8413,6,296},{8448,0,11855},{8451,0,710},{8453,0,11859},
+{8457,6,298},{8463,0,12092},{8467,0,8025},{8470,0,7610},
+{8481,6,300},{8486,6,302},{8491,0,771},{8494,0,20366},
+{8501,0,12089},{8507,0,8307},{8531,5,9375},{8533,0,15727},
+{8534,17,9785},{8539,13,9371},{8544,37,7575},{8554,5,8225},
+{8560,37,8092},{8570,5,8298},{8575,0,8303},{8592,5,737},
+{8594,10,304},{8598,5,12204},{8600,5,12202},{8644,5,8310},
+{8646,0,8309},{8651,6,307},{8656,0,12200},{8658,0,752},
+{8660,0,753},{8678,14,309},{8704,0,754},{8706,6,313},
+{8709,26,315},{8719,0,20368},{8721,10,322},{8729,6,325},
+{8733,14,327},{8741,5,15489},{8743,5,749},{8745,6,331},
+{8747,5,769},{8749,6,333},{8756,6,335},{8764,6,337},
+{8771,0,12120},{8773,0,15507},{8776,0,15508},{8786,0,762},
+{8800,10,339},{8804,5,20369},{8806,5,701},{8810,5,763},
+{8818,5,12121},{8822,5,15509},{8834,5,745},{8836,5,15472},
+{8838,5,743},{8842,5,15474},{8853,14,342},{8862,0,15906},
+{8864,0,12185},{8869,0,757},{8895,0,7630},{8922,5,15725},
+{8965,5,15478},{8967,0,12219},{8978,0,758},{8984,0,15728},
+{9115,6,346},{9117,5,12144},{9119,14,348},{9123,5,12152},
+{9125,6,352},{9127,9,8178},{9130,0,12167},{9131,9,8174},
+{9136,5,16312},{9150,57,16253},{9166,0,16273},{9251,0,16272},
+{9312,77,7555},{9332,77,8071},{9352,33,8062},{9361,5,20587},
+{9372,101,8112},{9398,101,10339},{9424,101,10313},{9450,0,8224},
+{9451,37,10515},{9461,37,16223},{9471,0,10503},{9472,301,7479},
+{9552,0,8251},{9566,0,8252},{9569,0,8254},{9578,0,8253},
+{9581,5,8247},{9583,6,354},{9585,9,8261},{9601,29,8230},
+{9609,26,356},{9620,5,8245},{9632,10,363},{9642,6,366},
+{9649,10,368},{9654,6,371},{9660,6,373},{9664,6,375},
+{9670,6,377},{9673,14,379},{9678,6,383},{9680,13,16274},
+{9698,5,8255},{9700,10,385},{9711,0,779},{9728,13,8215},
+{9733,6,388},{9742,0,8056},{9750,5,16233},{9756,5,8220},
+{9758,6,390},{9792,0,706},{9794,0,705},{9824,30,392},
+{9832,5,12098},{9834,22,400},{9842,45,16314},{9888,0,12192},
+{9986,0,12176},{10003,0,16270},{10010,0,12241},{10047,6,406},
+{10070,0,12259},{10102,33,8286},{10111,0,10514},{10145,0,8206},
+{10548,5,16201},{10687,0,16203},{10746,5,16207},{11013,9,8207},
+{11907,0,14305},{11909,0,13856},{11911,0,14105},{11913,0,14356},
+{11915,0,14110},{11916,5,13833},{11918,10,408},{11922,30,411},
+{11931,0,5089},{11934,10,419},{11937,5,14689},{11939,6,422},
+{11942,0,14157},{11944,26,424},{11953,10,431},{11959,0,14078},
+{11961,0,14099},{11964,6,434},{11966,9,14197},{11969,14,436},
+{11974,0,13682},{11978,0,13898},{11980,6,440},{11983,0,15262},
+{11985,6,442},{11990,10,444},{11997,10,447},{12004,0,1614},
+{12008,6,450},{12011,0,2666},{12013,0,2243},{12015,0,3965},
+{12018,0,1615},{12032,78,452},{12052,5,4301},{12054,42,472},
+{12065,5,4538},{12067,622,483},{12223,5,7299},{12225,62,639},
+{12241,5,7457},{12243,0,3966},{12244,5,7472},{12288,9,633},
+{12291,6,655},{12293,9,657},{12296,37,682},{12306,6,657},
+{12308,5,676},{12310,5,16197},{12312,5,12129},{12316,6,659},
+{12319,6,661},{12336,0,12218},{12339,9,12108},{12342,0,8057},
+{12347,10,663},{12353,329,842},{12436,9,7958},{12441,5,16326},
+{12443,5,643},{12445,5,653},{12447,6,666},{12449,341,925},
+{12535,13,8313},{12539,6,668},{12541,5,651},{12543,0,16195},
+{12688,61,16283},{12784,37,16236},{12794,21,16247},{12832,37,10126},
+{12842,21,8198},{12848,0,8197},{12849,5,7618},{12851,66,670},
+{12881,0,8091},{12882,37,8102},{12892,13,10244},{12928,37,10461},
+{12938,21,10472},{12944,62,687},{12960,5,10486},{12962,6,703},
+{12964,17,7613},{12969,30,705},{12977,57,10248},{13008,185,10413},
+{13056,0,8048},{13057,5,11874},{13059,42,713},{13070,21,11889},
+{13076,22,724},{13082,13,11900},{13086,0,8051},{13087,9,11904},
+{13090,22,730},{13096,5,11912},{13098,6,736},{13101,0,11915},
+{13102,9,11918},{13105,10,738},{13108,5,11924},{13110,30,741},
+{13118,9,11936},{13121,6,749},{13123,13,11939},{13127,14,751},
+{13131,5,11944},{13133,6,755},{13135,5,11946},{13137,14,757},
+{13141,5,11955},{13143,0,8044},{13169,0,11861},{13179,18,761},
+{13189,9,8031},{13192,5,8192},{13197,0,11864},{13198,5,7604},
+{13200,0,8035},{13206,10,766},{13211,0,11865},{13212,9,7601},
+{13215,18,769},{13220,5,8022},{13222,0,8188},{13232,14,774},
+{13250,0,11856},{13252,0,7606},{13256,0,8194},{13259,10,778},
+{13268,0,8036},{13271,5,11869},{13274,0,11851},{13314,0,13698},
+{13317,6,781},{13351,0,13910},{13356,0,17246},{13358,0,14216},
+{13416,0,14047},{13418,0,17269},{13448,0,15442},{13458,0,17294},
+{13493,0,16793},{13500,0,17303},{13505,0,18384},{13511,0,17307},
+{13531,0,15425},{13599,0,13865},{13630,0,14110},{13661,5,17341},
+{13667,0,17344},{13678,0,17348},{13734,0,17369},{13736,0,17371},
+{13765,0,17377},{13786,0,17386},{13790,0,20067},{13812,0,17395},
+{13829,0,17402},{13844,0,19131},{13898,0,17441},{13969,0,17473},
+{13974,0,17477},{13977,0,17475},{14031,0,17494},{14177,5,17528},
+{14187,6,783},{14197,0,17536},{14221,0,13850},{14273,0,17550},
+{14306,0,14123},{14312,0,17570},{14324,0,17573},{14333,0,17576},
+{14336,0,17578},{14383,0,17588},{14390,0,17589},{14400,0,17590},
+{14428,0,17594},{14433,0,17596},{14497,0,20171},{14509,0,19132},
+{14586,0,13852},{14615,0,17625},{14618,0,17628},{14703,0,17643},
+{14756,0,20122},{14776,0,20123},{14940,0,20127},{14958,0,17713},
+{14963,0,17716},{14981,0,20142},{15044,0,20135},{15051,0,20136},
+{15062,6,785},{15082,0,17741},{15091,0,15424},{15118,0,17752},
+{15130,0,17756},{15132,0,17757},{15138,0,15433},{15213,0,17804},
+{15223,0,17797},{15239,6,787},{15245,0,17828},{15268,0,17834},
+{15286,0,16910},{15299,0,16911},{15309,0,17848},{15344,0,17865},
+{15347,0,20151},{15375,0,16919},{15398,0,17887},{15555,0,17916},
+{15570,0,17921},{15633,0,17957},{15646,0,17968},{15665,0,20158},
+{15694,0,7655},{15716,0,17994},{15770,0,18008},{15808,0,18026},
+{15820,0,19133},{15828,0,18031},{15877,0,18043},{15935,6,789},
+{15968,0,18059},{15974,0,18061},{15976,0,18062},{16003,0,18069},
+{16010,0,15427},{16020,0,18075},{16090,0,15432},{16215,0,18123},
+{16242,0,16984},{16245,0,18137},{16247,0,18139},{16302,0,18157},
+{16305,0,14164},{16329,0,18168},{16343,0,18173},{16348,0,19134},
+{16441,0,18191},{16472,0,18198},{16531,0,15436},{16643,0,15439},
+{16645,0,18235},{16712,0,18247},{16719,0,18250},{16739,0,18254},
+{16820,0,18269},{16831,0,18272},{16870,0,18283},{16878,0,18287},
+{16883,0,18284},{16903,0,18294},{16910,0,18297},{16996,0,14176},
+{17043,0,15440},{17094,0,18335},{17110,0,18346},{17117,0,18350},
+{17154,0,18364},{17195,0,18377},{17219,0,18379},{17390,0,18423},
+{17392,0,18426},{17416,0,18432},{17420,0,15426},{17431,0,18434},
+{17436,0,18435},{17442,0,18437},{17491,0,14195},{17499,0,17060},
+{17526,0,18460},{17530,0,18461},{17553,0,18467},{17587,0,18494},
+{17598,0,18492},{17620,0,18493},{17672,0,18524},{17677,0,18520},
+{17701,0,14206},{17731,0,18540},{17786,0,15435},{17821,0,17108},
+{17848,0,18592},{17854,0,19135},{17893,0,18618},{17898,0,17113},
+{17935,6,791},{17985,0,18648},{18021,0,15438},{18081,0,18665},
+{18094,6,793},{18188,0,18690},{18207,0,20219},{18276,0,18712},
+{18406,0,14224},{18429,0,18724},{18454,0,18734},{18462,0,20225},
+{18500,0,17141},{18510,0,18746},{18613,0,18779},{18864,0,17183},
+{18919,0,18898},{18938,0,18902},{18948,0,18907},{18985,0,18910},
+{19132,0,18934},{19256,0,13791},{19259,0,18958},{19326,0,19137},
+{19394,0,18995},{19402,0,18997},{19410,0,18999},{19432,0,15430},
+{19479,0,17204},{19488,0,19016},{19512,0,19138},{19652,0,19076},
+{19665,0,19079},{19681,0,19139},{19719,0,19099},{19831,0,19115},
+{19968,14,795},{19972,5,14296},{19975,46,799},{19988,22,811},
+{19998,6,817},{20001,0,3974},{20003,5,19141},{20006,0,3602},
+{20008,26,819},{20015,5,14300},{20017,6,826},{20021,18,828},
+{20027,6,833},{20031,0,4097},{20032,5,14302},{20034,14,835},
+{20039,6,839},{20043,0,3309},{20045,10,841},{20049,0,17241},
+{20053,22,844},{20060,14,850},{20066,6,854},{20072,6,856},
+{20081,0,3930},{20083,0,3285},{20084,5,21079},{20089,0,19143},
+{20094,10,858},{20098,0,4101},{20101,6,861},{20104,26,863},
+{20113,6,870},{20116,22,872},{20123,10,878},{20126,9,4108},
+{20129,6,881},{20132,10,883},{20136,0,1686},{20139,5,1687},
+{20141,14,886},{20147,0,4113},{20150,0,4114},{20153,14,890},
+{20160,18,894},{20166,10,899},{20170,6,902},{20173,14,904},
+{20180,30,908},{20189,34,916},{20200,0,21085},{20203,0,17250},
+{20205,26,925},{20213,10,932},{20219,34,935},{20232,42,944},
+{20245,10,955},{20249,6,958},{20252,6,960},{20267,0,19147},
+{20270,14,962},{20275,46,966},{20288,0,21094},{20290,6,978},
+{20294,14,980},{20299,5,21096},{20301,78,984},{20323,6,1004},
+{20329,6,1006},{20332,0,16782},{20334,14,1008},{20339,0,1346},
+{20341,6,1012},{20343,5,17260},{20345,14,1014},{20349,5,14321},
+{20351,0,2198},{20353,22,1018},{20360,50,1024},{20374,22,1037},
+{20381,18,1043},{20395,0,4564},{20397,10,1048},{20402,0,17265},
+{20405,10,1051},{20409,0,21111},{20411,9,21112},{20414,6,1054},
+{20416,5,21115},{20418,18,1056},{20424,50,1061},{20439,6,1074},
+{20442,14,1076},{20447,18,1080},{20452,5,4152},{20454,0,17264},
+{20462,22,1085},{20469,6,1091},{20472,0,3648},{20474,0,1334},
+{20476,14,1093},{20480,5,14327},{20482,0,20299},{20484,14,1097},
+{20489,46,1101},{20502,38,1113},{20513,54,1123},{20528,0,21128},
+{20530,5,21129},{20533,6,1137},{20537,0,1862},{20539,0,14336},
+{20544,14,1139},{20549,22,1143},{20556,0,19155},{20558,10,1149},
+{20561,5,21134},{20563,0,17274},{20565,10,1152},{20569,6,1155},
+{20572,0,3072},{20575,6,1157},{20578,6,1159},{20581,10,1161},
+{20586,0,14335},{20588,6,1164},{20592,10,1166},{20596,18,1169},
+{20605,0,1616},{20608,6,1174},{20611,5,21142},{20613,6,1176},
+{20616,0,17277},{20618,0,21145},{20621,18,1178},{20626,5,17278},
+{20628,10,1183},{20632,18,1186},{20638,0,19160},{20639,9,21148},
+{20642,6,1191},{20650,0,17281},{20652,6,1193},{20655,5,21151},
+{20657,18,1195},{20663,0,2439},{20665,0,21153},{20666,5,17284},
+{20669,6,1200},{20672,0,21155},{20674,14,1202},{20679,0,17287},
+{20681,5,4184},{20684,22,1206},{20691,14,1212},{20696,10,1216},
+{20700,5,21157},{20702,6,1219},{20705,34,1221},{20717,38,1230},
+{20729,10,1240},{20734,0,19165},{20736,0,1617},{20737,5,4197},
+{20739,6,1243},{20742,14,1245},{20747,0,14345},{20748,9,19167},
+{20752,0,14346},{20754,0,2336},{20756,30,1249},{20764,5,21166},
+{20766,6,1257},{20769,0,4203},{20771,0,21168},{20775,5,21169},
+{20778,0,3855},{20780,5,21171},{20783,0,21173},{20785,18,1259},
+{20791,22,1264},{20799,5,4208},{20801,62,1270},{20818,14,1286},
+{20823,6,1290},{20826,0,3160},{20828,0,1491},{20831,6,1292},
+{20834,0,4213},{20836,18,1294},{20841,5,4215},{20843,14,1299},
+{20849,0,1694},{20851,26,1303},{20859,6,1310},{20862,0,21182},
+{20864,0,4218},{20866,18,1312},{20873,42,1317},{20885,5,4226},
+{20887,10,1328},{20893,0,8395},{20896,26,1331},{20904,0,3532},
+{20905,9,4231},{20908,6,1338},{20912,0,4237},{20913,5,4235},
+{20915,22,1340},{20922,0,19175},{20924,14,1346},{20930,18,1350},
+{20936,22,1355},{20943,0,19177},{20945,6,1361},{20947,5,19179},
+{20949,6,1363},{20952,0,19181},{20955,30,1365},{20965,10,1373},
+{20969,6,1376},{20972,10,1378},{20976,42,1381},{20989,6,1392},
+{20992,0,3163},{20993,5,14355},{20995,22,1394},{21002,6,1400},
+{21006,0,4253},{21009,30,1402},{21021,0,2419},{21026,0,21192},
+{21028,30,1410},{21038,0,4256},{21040,0,3192},{21041,5,19187},
+{21043,0,4257},{21045,30,1418},{21059,10,1426},{21063,0,2823},
+{21065,6,1429},{21067,5,4261},{21069,0,2738},{21071,0,4259},
+{21076,18,1431},{21082,30,1436},{21091,14,1444},{21097,6,1448},
+{21100,0,17315},{21102,30,1450},{21111,0,17316},{21112,5,19194},
+{21117,0,4270},{21119,6,1458},{21122,14,1460},{21127,14,1464},
+{21132,6,1468},{21137,14,1470},{21141,9,21198},{21144,0,17320},
+{21146,10,1474},{21151,6,1477},{21155,18,1479},{21161,10,1484},
+{21164,5,4279},{21167,10,1487},{21172,6,1490},{21174,9,21205},
+{21177,0,1966},{21178,5,17323},{21180,10,1492},{21184,6,1495},
+{21187,30,1497},{21196,6,1505},{21199,14,1507},{21204,22,1511},
+{21211,62,1517},{21228,0,21217},{21232,30,1533},{21240,5,4293},
+{21242,6,1541},{21246,22,1543},{21253,14,1549},{21258,5,14364},
+{21260,6,1553},{21263,10,1555},{21267,0,21221},{21269,50,1558},
+{21283,10,1571},{21287,9,21226},{21290,0,3439},{21291,5,21229},
+{21293,0,19204},{21295,18,1574},{21301,0,17329},{21304,46,1579},
+{21317,34,1591},{21329,14,1600},{21335,22,1604},{21342,0,4315},
+{21344,6,1610},{21347,0,16801},{21349,10,1612},{21353,0,4316},
+{21356,38,1615},{21367,18,1625},{21373,10,1630},{21378,10,1633},
+{21383,5,21237},{21385,0,14288},{21390,0,21239},{21395,6,1636},
+{21398,0,4322},{21400,10,1638},{21405,0,16802},{21407,10,1641},
+{21412,10,1644},{21416,14,1647},{21421,14,1651},{21426,26,1655},
+{21434,6,1662},{21437,0,21243},{21440,14,1664},{21444,5,19217},
+{21448,30,1668},{21458,5,21245},{21460,14,1676},{21465,10,1680},
+{21469,110,1683},{21498,0,4338},{21505,14,1711},{21512,46,1715},
+{21530,6,1727},{21533,18,1729},{21540,0,17346},{21542,22,1734},
+{21548,5,4342},{21550,6,1740},{21553,0,19222},{21555,0,13760},
+{21556,5,19223},{21558,0,4346},{21560,6,1742},{21563,22,1744},
+{21570,10,1750},{21574,18,1753},{21580,14,1758},{21585,0,3253},
+{21589,0,14115},{21598,6,1762},{21602,0,17350},{21604,0,21258},
+{21606,26,1764},{21613,5,21261},{21616,6,1771},{21619,18,1773},
+{21627,10,1778},{21631,10,1781},{21635,14,1784},{21640,42,1788},
+{21653,6,1799},{21660,0,8411},{21663,14,1801},{21668,46,1805},
+{21681,10,1817},{21687,54,1820},{21702,18,1834},{21709,6,1839},
+{21720,0,4377},{21728,10,1841},{21733,5,4378},{21736,10,1844},
+{21740,14,1847},{21745,10,1851},{21750,0,21271},{21754,0,4385},
+{21756,14,1854},{21760,5,17364},{21764,22,1858},{21772,5,21273},
+{21774,10,1864},{21780,10,1867},{21799,0,19236},{21802,6,1870},
+{21806,6,1872},{21809,10,1874},{21813,6,1877},{21816,6,1879},
+{21819,14,1881},{21824,6,1885},{21828,14,1887},{21833,6,1891},
+{21836,6,1893},{21839,10,1895},{21843,0,1810},{21846,5,4394},
+{21848,0,21280},{21850,5,21281},{21852,10,1898},{21856,6,1901},
+{21859,6,1903},{21862,0,19240},{21883,38,1905},{21894,22,1915},
+{21902,6,1921},{21905,14,1923},{21911,14,1927},{21916,14,1931},
+{21923,6,1935},{21927,30,1937},{21936,0,1772},{21938,0,19245},
+{21942,0,1254},{21951,0,17381},{21953,0,21287},{21955,18,1945},
+{21961,0,17382},{21963,6,1950},{21966,0,16809},{21969,14,1952},
+{21975,5,21289},{21978,22,1956},{21986,10,1962},{21993,0,17389},
+{21996,0,19250},{21998,0,19251},{22001,0,19252},{22006,14,1965},
+{22013,10,1969},{22021,22,1972},{22029,0,19256},{22030,5,14397},
+{22032,0,17393},{22033,5,19257},{22036,0,4421},{22038,14,1978},
+{22043,0,4426},{22048,0,15389},{22056,6,1982},{22060,0,19259},
+{22063,42,1984},{22075,10,1995},{22079,14,1998},{22083,5,21299},
+{22086,6,2002},{22089,0,14401},{22091,22,2004},{22099,6,2010},
+{22107,0,1496},{22110,0,17399},{22112,0,17400},{22113,9,21302},
+{22116,0,4436},{22118,0,14404},{22120,22,2012},{22127,0,14406},
+{22129,5,14407},{22132,10,2018},{22136,0,3245},{22138,0,3404},
+{22144,0,4441},{22148,18,2021},{22154,10,2026},{22159,0,4445},
+{22164,6,2029},{22169,6,2031},{22173,14,2033},{22178,0,3311},
+{22181,18,2037},{22187,0,21309},{22188,5,14411},{22190,0,4447},
+{22193,14,2042},{22198,6,2046},{22204,0,4451},{22206,0,21310},
+{22208,14,2048},{22213,0,17408},{22216,38,2052},{22227,0,4458},
+{22231,42,2062},{22243,6,2073},{22245,9,21314},{22248,0,17411},
+{22251,0,19272},{22253,6,2075},{22256,14,2077},{22262,5,17412},
+{22265,6,2081},{22269,0,2051},{22271,6,2083},{22273,5,21317},
+{22275,6,2085},{22279,26,2087},{22287,0,1869},{22289,10,2094},
+{22293,6,2097},{22296,0,4470},{22298,5,19277},{22300,6,2099},
+{22303,18,2101},{22308,5,21322},{22310,18,2106},{22316,18,2111},
+{22323,5,14421},{22327,5,4475},{22331,0,4478},{22333,5,19282},
+{22335,6,2116},{22338,0,2132},{22341,5,17418},{22343,0,1737},
+{22346,0,3685},{22348,26,2118},{22361,0,8416},{22367,0,19284},
+{22369,6,2125},{22372,30,2127},{22381,18,2135},{22387,9,17424},
+{22391,0,16814},{22393,14,2140},{22398,6,2144},{22401,10,2146},
+{22408,6,2149},{22411,6,2151},{22419,10,2153},{22423,0,19289},
+{22425,6,2156},{22428,0,14426},{22429,5,17431},{22431,22,2158},
+{22439,14,2164},{22444,0,8418},{22446,0,19290},{22448,0,4492},
+{22451,0,4489},{22456,0,14427},{22461,0,21341},{22464,0,4482},
+{22467,0,4493},{22470,10,2168},{22475,6,2171},{22478,6,2173},
+{22482,5,4496},{22484,14,2175},{22492,22,2179},{22499,6,2185},
+{22502,6,2187},{22505,0,21343},{22509,0,14429},{22512,0,17440},
+{22516,0,2533},{22517,5,14430},{22519,38,2189},{22530,18,2199},
+{22536,22,2204},{22549,0,2852},{22553,0,4502},{22555,0,21349},
+{22557,18,2210},{22564,0,3077},{22566,6,2215},{22570,0,1514},
+{22573,0,21351},{22575,14,2217},{22580,6,2221},{22585,6,2223},
+{22589,0,4511},{22591,10,2225},{22601,18,2228},{22607,14,2233},
+{22612,6,2237},{22615,14,2239},{22622,6,2243},{22625,6,2245},
+{22628,0,16819},{22631,10,2247},{22635,0,3120},{22637,0,19298},
+{22640,0,4508},{22642,0,4504},{22645,0,2582},{22648,6,2250},
+{22652,0,14436},{22654,14,2252},{22659,0,1701},{22661,0,4513},
+{22663,5,21357},{22665,0,16820},{22666,5,17453},{22668,6,2256},
+{22671,5,17456},{22675,6,2258},{22678,10,2260},{22684,14,2263},
+{22688,9,21361},{22694,0,21364},{22696,14,2267},{22702,0,4521},
+{22705,10,2271},{22712,18,2274},{22718,0,2070},{22721,18,2279},
+{22727,6,2284},{22730,0,1397},{22732,10,2286},{22736,42,2289},
+{22748,26,2300},{22756,6,2307},{22761,0,14443},{22763,6,2309},
+{22766,18,2311},{22771,5,17466},{22775,0,3063},{22777,6,2316},
+{22779,9,4535},{22786,0,4538},{22789,5,17468},{22793,18,2318},
+{22799,6,2323},{22802,5,21372},{22804,10,2325},{22808,22,2328},
+{22815,0,19303},{22817,18,2334},{22823,18,2339},{22828,5,4544},
+{22830,22,2344},{22837,5,21379},{22839,10,2350},{22845,10,2353},
+{22851,6,2356},{22854,14,2358},{22862,30,2362},{22871,18,2370},
+{22877,26,2375},{22885,0,1310},{22887,34,2382},{22898,10,2391},
+{22901,5,17481},{22904,6,2394},{22907,10,2396},{22913,14,2399},
+{22922,18,2403},{22930,6,2408},{22933,10,2410},{22937,0,3771},
+{22939,0,4665},{22941,0,4562},{22943,0,17484},{22947,10,2413},
+{22951,6,2416},{22956,18,2418},{22962,6,2423},{22967,0,21395},
+{22969,14,2425},{22974,0,2450},{22977,0,21396},{22979,6,2429},
+{22982,0,4567},{22984,14,2431},{22989,0,17488},{22992,18,2435},
+{23001,5,4571},{23004,14,2440},{23011,5,14452},{23013,14,2444},
+{23018,10,2448},{23022,6,2451},{23025,6,2453},{23028,0,21400},
+{23030,10,2455},{23035,0,1213},{23039,10,2458},{23043,6,2461},
+{23049,0,4577},{23052,10,2463},{23057,10,2466},{23063,6,2469},
+{23066,10,2471},{23070,10,2474},{23075,10,2477},{23079,14,2480},
+{23085,0,17498},{23087,6,2484},{23093,5,4582},{23100,0,2451},
+{23104,6,2486},{23108,5,21410},{23110,14,2488},{23116,0,21413},
+{23120,0,21414},{23125,0,14458},{23130,0,2071},{23134,0,21415},
+{23138,6,2492},{23141,10,2494},{23146,0,4585},{23148,6,2497},
+{23159,0,16830},{23162,6,2499},{23166,6,2501},{23172,0,16831},
+{23179,0,17501},{23184,0,21417},{23186,6,2503},{23190,0,21419},
+{23193,14,2505},{23198,0,14462},{23199,5,17503},{23202,0,17505},
+{23207,0,14463},{23212,0,14464},{23217,10,2509},{23221,0,17507},
+{23224,0,19314},{23226,22,2512},{23233,6,2518},{23236,0,16832},
+{23238,0,21422},{23240,6,2520},{23243,6,2522},{23247,6,2524},
+{23254,6,2526},{23258,0,17510},{23260,0,17511},{23264,6,2528},
+{23267,0,4592},{23269,6,2530},{23273,6,2532},{23278,0,17514},
+{23280,0,17513},{23285,6,2534},{23290,5,4597},{23293,0,21425},
+{23296,6,2536},{23304,6,2538},{23307,6,2540},{23318,6,2542},
+{23321,0,14468},{23323,0,19317},{23325,0,19318},{23329,6,2544},
+{23333,0,14469},{23338,0,4604},{23340,6,2546},{23344,0,1255},
+{23346,0,4602},{23348,0,17518},{23350,0,4605},{23352,0,19320},
+{23358,0,4606},{23360,6,2548},{23363,0,4607},{23365,0,4608},
+{23371,6,2550},{23376,10,2552},{23380,18,2555},{23386,5,4612},
+{23388,14,2560},{23395,14,2564},{23400,6,2568},{23403,0,2841},
+{23406,14,2570},{23411,0,4617},{23413,6,2574},{23416,0,4619},
+{23418,0,4621},{23420,6,2576},{23422,5,14473},{23424,62,2578},
+{23440,5,21432},{23443,42,2594},{23455,0,2286},{23458,18,2605},
+{23464,5,21435},{23468,18,2610},{23473,5,21439},{23475,30,2615},
+{23484,0,21442},{23487,34,2623},{23497,0,4628},{23500,18,2632},
+{23506,10,2637},{23510,10,2640},{23513,5,21446},{23515,0,1518},
+{23517,22,2643},{23524,22,2649},{23531,6,2655},{23534,14,2657},
+{23539,14,2661},{23544,0,2631},{23546,0,2249},{23549,10,2665},
+{23553,22,2668},{23559,5,4641},{23561,26,2674},{23569,14,2681},
+{23574,6,2685},{23577,6,2687},{23582,10,2689},{23586,10,2692},
+{23590,0,21452},{23592,26,2695},{23600,10,2702},{23605,6,2705},
+{23608,5,4648},{23610,30,2707},{23621,6,2715},{23624,0,1782},
+{23626,6,2717},{23629,18,2719},{23635,0,4653},{23637,0,3122},
+{23641,14,2724},{23646,30,2728},{23655,5,17541},{23657,0,14480},
+{23660,22,2736},{23668,5,21457},{23670,0,4660},{23673,18,2742},
+{23687,6,2747},{23690,0,17549},{23692,0,4662},{23695,14,2749},
+{23700,0,4664},{23709,0,21463},{23711,18,2753},{23718,30,2758},
+{23729,30,2766},{23738,10,2774},{23742,0,4672},{23749,0,4671},
+{23751,0,4673},{23753,0,17560},{23755,0,14482},{23760,0,16844},
+{23762,0,14483},{23767,0,21466},{23769,0,4674},{23773,0,19331},
+{23776,6,2777},{23782,0,14124},{23784,10,2779},{23789,14,2782},
+{23793,5,21468},{23796,10,2786},{23802,6,2789},{23805,0,4676},
+{23809,0,19332},{23814,6,2791},{23819,0,4681},{23821,6,2793},
+{23824,10,2795},{23828,30,2798},{23837,0,17566},{23839,6,2806},
+{23842,10,2808},{23846,6,2811},{23849,0,3656},{23851,0,17565},
+{23857,0,17568},{23860,0,19333},{23865,0,17569},{23869,0,19334},
+{23871,0,21472},{23874,6,2813},{23878,10,2815},{23882,10,2818},
+{23886,0,4695},{23888,14,2821},{23893,0,21474},{23897,0,19335},
+{23900,0,4684},{23903,5,21476},{23905,6,2825},{23908,0,21479},
+{23913,6,2827},{23916,6,2829},{23919,6,2831},{23923,0,4698},
+{23926,0,4699},{23929,5,21480},{23934,6,2833},{23937,14,2835},
+{23943,6,2839},{23946,10,2841},{23952,0,4708},{23954,14,2844},
+{23959,0,17579},{23961,0,14492},{23963,0,21486},{23965,0,4704},
+{23967,6,2848},{23970,0,4703},{23972,0,16849},{23975,0,16850},
+{23979,6,2850},{23982,0,4706},{23984,0,17580},{23986,0,15405},
+{23988,0,17581},{23991,0,4709},{23992,5,8446},{23994,0,4014},
+{23996,6,2852},{24003,0,21489},{24007,0,19338},{24009,0,4711},
+{24011,14,2854},{24016,14,2858},{24022,14,2862},{24027,0,4716},
+{24029,6,2866},{24032,38,2868},{24043,0,4717},{24046,0,2089},
+{24049,18,2878},{24055,10,2883},{24059,0,1512},{24061,14,2886},
+{24066,6,2890},{24070,6,2892},{24075,10,2894},{24081,6,2897},
+{24084,5,14499},{24086,0,3005},{24088,14,2899},{24093,0,3079},
+{24095,6,2903},{24101,0,2601},{24104,0,19340},{24107,0,2211},
+{24109,14,2905},{24114,6,2909},{24117,0,19342},{24118,5,4725},
+{24120,0,2519},{24125,6,2911},{24128,0,4729},{24131,10,2913},
+{24135,0,4736},{24137,0,17593},{24139,6,2916},{24142,0,4730},
+{24144,5,21496},{24148,18,2918},{24155,6,2923},{24158,6,2925},
+{24161,14,2927},{24168,0,19344},{24170,0,19345},{24171,5,14504},
+{24173,5,17597},{24176,0,21499},{24178,10,2931},{24181,5,4737},
+{24183,42,2934},{24195,6,2945},{24199,0,3443},{24202,6,2947},
+{24206,6,2949},{24213,10,2951},{24217,6,2954},{24220,0,3534},
+{24224,0,4742},{24226,0,21501},{24228,18,2956},{24234,14,2961},
+{24241,0,21503},{24243,0,19349},{24245,18,2965},{24253,0,19350},
+{24254,5,14508},{24257,5,4743},{24259,0,3335},{24262,0,17603},
+{24264,18,2970},{24270,22,2975},{24276,5,19352},{24278,0,4748},
+{24281,0,17604},{24282,5,4751},{24284,30,2981},{24293,0,21508},
+{24296,5,4755},{24299,6,2989},{24304,6,2991},{24307,6,2993},
+{24310,58,2995},{24326,46,3010},{24339,26,3022},{24347,0,2958},
+{24348,5,14514},{24350,6,3029},{24353,34,3031},{24363,5,21513},
+{24365,18,3040},{24372,18,3045},{24378,30,3050},{24388,6,3058},
+{24391,6,3060},{24394,0,1704},{24396,10,3062},{24400,6,3065},
+{24403,6,3067},{24406,5,4780},{24408,6,3069},{24411,10,3071},
+{24416,30,3074},{24425,18,3082},{24431,18,3087},{24436,5,21522},
+{24439,14,3092},{24444,38,3096},{24455,26,3106},{24463,18,3113},
+{24470,14,3118},{24476,10,3122},{24480,10,3125},{24484,0,14527},
+{24487,34,3128},{24496,5,21530},{24499,10,3137},{24503,10,3140},
+{24508,6,3143},{24515,10,3145},{24519,10,3148},{24523,10,3151},
+{24528,5,21533},{24530,9,17618},{24534,6,3154},{24536,5,3688},
+{24540,10,3156},{24544,10,3159},{24548,0,4803},{24552,22,3162},
+{24558,5,17622},{24560,14,3168},{24565,6,3172},{24568,0,4804},
+{24570,14,3174},{24575,0,4808},{24583,0,19357},{24586,0,21540},
+{24589,14,3178},{24594,46,3182},{24607,14,3194},{24612,30,3198},
+{24621,0,21543},{24623,0,1705},{24625,0,4815},{24627,0,14538},
+{24629,0,16863},{24634,0,4821},{24640,14,3206},{24646,30,3210},
+{24656,10,3218},{24660,6,3221},{24662,5,21547},{24665,6,3223},
+{24669,0,8454},{24671,26,3225},{24679,26,3232},{24687,10,3239},
+{24693,0,1817},{24695,0,4825},{24702,6,3242},{24705,22,3244},
+{24712,26,3250},{24721,18,3257},{24726,5,4844},{24728,0,21557},
+{24730,6,3262},{24733,14,3264},{24738,34,3268},{24752,34,3277},
+{24763,14,3286},{24770,0,21562},{24772,18,3290},{24777,5,21563},
+{24779,0,14544},{24782,5,21565},{24785,0,4077},{24787,10,3295},
+{24792,46,3298},{24805,0,21568},{24807,6,3310},{24814,0,17637},
+{24816,22,3312},{24822,5,4862},{24824,22,3318},{24832,14,3324},
+{24838,18,3328},{24844,0,21572},{24845,5,4871},{24847,10,3333},
+{24850,9,14547},{24853,10,3336},{24857,14,3339},{24862,18,3343},
+{24871,6,3348},{24874,10,3350},{24880,6,3353},{24884,14,3355},
+{24889,6,3359},{24892,14,3361},{24897,6,3365},{24900,42,3367},
+{24915,0,4897},{24917,0,3641},{24920,9,4887},{24925,14,3378},
+{24930,14,3382},{24935,6,3386},{24939,6,3388},{24942,42,3390},
+{24955,18,3401},{24960,5,21583},{24962,0,3861},{24963,5,21585},
+{24967,0,4901},{24970,6,3406},{24973,6,3408},{24976,6,3410},
+{24978,5,17648},{24980,0,4903},{24982,18,3412},{24988,6,3417},
+{24991,6,3419},{24996,6,3421},{24999,30,3423},{25010,0,1873},
+{25014,0,1329},{25016,10,3431},{25020,0,16869},{25022,0,1524},
+{25024,5,21591},{25026,6,3434},{25030,30,3436},{25038,5,21593},
+{25040,0,1403},{25045,0,17654},{25052,14,3444},{25057,10,3448},
+{25061,18,3451},{25068,5,21599},{25071,0,21601},{25074,0,3012},
+{25076,18,3456},{25082,0,4923},{25084,22,3461},{25091,6,3467},
+{25095,0,19380},{25096,5,4930},{25098,0,3642},{25100,10,3469},
+{25104,26,3472},{25114,38,3479},{25126,6,3489},{25129,10,3491},
+{25134,14,3494},{25138,5,4941},{25140,0,2871},{25142,0,13757},
+{25144,6,3498},{25147,0,3821},{25149,30,3500},{25158,14,3508},
+{25163,14,3512},{25168,26,3516},{25176,0,2897},{25178,10,3523},
+{25182,0,4945},{25184,6,3526},{25187,6,3528},{25192,0,4949},
+{25197,10,3530},{25201,0,1147},{25203,0,17664},{25206,0,3536},
+{25209,30,3533},{25218,14,3541},{25225,6,3545},{25229,9,21614},
+{25232,6,3547},{25234,5,4954},{25236,22,3549},{25243,6,3555},
+{25246,0,2898},{25254,0,8466},{25256,0,19386},{25259,6,3557},
+{25265,0,3658},{25267,0,21617},{25269,0,3085},{25270,5,21618},
+{25273,18,3559},{25278,5,21621},{25282,0,4971},{25284,26,3564},
+{25292,70,3571},{25312,6,3589},{25322,0,21624},{25324,14,3591},
+{25329,26,3595},{25340,14,3602},{25345,14,3606},{25351,26,3610},
+{25360,6,3617},{25363,0,21628},{25366,0,19389},{25368,6,3619},
+{25371,0,14135},{25375,0,1708},{25383,18,3621},{25389,0,21630},
+{25391,0,2556},{25394,0,17673},{25397,6,3626},{25401,6,3628},
+{25403,5,17675},{25405,10,3630},{25409,0,17677},{25410,5,14570},
+{25412,0,17678},{25414,0,19392},{25417,30,3633},{25426,14,3641},
+{25431,10,3645},{25435,6,3648},{25445,18,3650},{25451,14,3655},
+{25457,6,3659},{25460,18,3661},{25466,14,3666},{25471,6,3670},
+{25474,10,3672},{25479,14,3675},{25484,0,2464},{25486,10,3679},
+{25490,0,3337},{25492,10,3682},{25496,14,3685},{25502,62,3689},
+{25518,5,19400},{25522,0,1821},{25524,6,3705},{25531,0,2785},
+{25533,6,3707},{25536,6,3709},{25539,14,3711},{25544,6,3715},
+{25550,22,3717},{25556,5,17689},{25558,0,3862},{25562,10,3723},
+{25568,6,3726},{25571,0,5004},{25573,0,16876},{25577,6,3728},
+{25579,5,17692},{25581,6,3730},{25586,22,3732},{25592,5,19403},
+{25594,0,3891},{25606,0,5011},{25609,6,3738},{25613,0,2843},
+{25615,6,3740},{25618,10,3742},{25622,10,3745},{25628,0,4986},
+{25630,0,17695},{25632,0,19407},{25634,0,14583},{25636,10,3748},
+{25640,10,3751},{25644,6,3754},{25647,6,3756},{25652,10,3758},
+{25658,0,1822},{25661,10,3761},{25666,0,2689},{25675,0,21652},
+{25678,6,3764},{25681,14,3766},{25688,0,3104},{25690,14,3770},
+{25695,10,3774},{25699,0,21657},{25703,0,5019},{25705,0,3726},
+{25709,0,14586},{25711,0,5020},{25715,6,3777},{25718,0,5021},
+{25720,14,3779},{25725,0,17702},{25731,0,1848},{25733,0,21658},
+{25735,6,3783},{25743,18,3785},{25749,0,5024},{25752,5,19417},
+{25754,6,3790},{25757,10,3792},{25761,0,21661},{25763,14,3795},
+{25768,6,3799},{25771,14,3801},{25776,0,2709},{25778,6,3805},
+{25785,0,1447},{25787,10,3807},{25790,5,14588},{25793,6,3810},
+{25796,6,3812},{25799,0,5033},{25801,6,3814},{25803,5,17706},
+{25805,6,3816},{25808,10,3818},{25812,6,3821},{25815,6,3823},
+{25818,0,5030},{25824,5,5040},{25826,22,3825},{25833,5,21668},
+{25836,6,3831},{25839,14,3833},{25844,14,3837},{25850,6,3841},
+{25853,18,3843},{25860,6,3848},{25864,9,21672},{25871,0,17714},
+{25875,6,3850},{25878,0,14594},{25880,6,3852},{25883,18,3854},
+{25890,10,3859},{25894,0,21676},{25897,14,3862},{25902,6,3866},
+{25905,6,3868},{25908,5,5058},{25910,22,3870},{25916,5,21679},
+{25918,6,3876},{25923,10,3878},{25927,10,3881},{25933,22,3884},
+{25940,22,3890},{25949,14,3896},{25954,6,3900},{25958,6,3902},
+{25963,6,3904},{25968,0,2618},{25970,0,5071},{25972,6,3906},
+{25975,6,3908},{25978,0,17722},{25981,0,21685},{25985,0,14598},
+{25986,5,5073},{25988,6,3910},{25991,14,3912},{25996,0,3518},
+{25998,0,2120},{26000,10,3916},{26005,0,19429},{26007,10,3919},
+{26011,10,3922},{26015,10,3925},{26019,18,3928},{26027,22,3933},
+{26034,14,3939},{26039,10,3943},{26044,14,3946},{26049,22,3950},
+{26056,6,3956},{26059,6,3958},{26062,10,3960},{26066,0,5085},
+{26068,0,17730},{26070,14,3963},{26075,0,5086},{26079,0,19435},
+{26080,5,5088},{26082,6,3967},{26085,18,3969},{26092,6,3974},
+{26096,10,3976},{26100,5,21695},{26105,14,3979},{26110,5,21697},
+{26112,0,8472},{26114,10,3983},{26118,18,3986},{26124,14,3991},
+{26129,5,21700},{26131,14,3995},{26140,86,3999},{26163,6,4021},
+{26165,5,5096},{26167,0,21708},{26169,14,4023},{26175,30,4027},
+{26184,18,4035},{26190,6,4040},{26193,6,4042},{26199,14,4044},
+{26203,5,14605},{26205,38,4048},{26215,5,5107},{26217,10,4058},
+{26220,5,17746},{26222,10,4061},{26227,14,4064},{26231,5,16889},
+{26233,14,4068},{26238,14,4072},{26243,6,4076},{26247,10,4078},
+{26251,5,19437},{26253,6,4081},{26256,10,4083},{26262,14,4086},
+{26266,9,21718},{26269,0,5118},{26271,6,4090},{26274,0,3014},
+{26276,0,14610},{26278,0,4025},{26283,0,2193},{26285,6,4092},
+{26289,18,4094},{26296,6,4099},{26299,6,4101},{26302,14,4103},
+{26306,5,21723},{26308,0,5124},{26310,14,4107},{26316,0,21725},
+{26318,6,4111},{26324,0,21727},{26326,0,5126},{26329,18,4113},
+{26335,6,4118},{26342,0,5130},{26344,6,4120},{26347,6,4122},
+{26350,0,21730},{26352,0,5132},{26354,14,4124},{26359,42,4128},
+{26371,0,4171},{26373,0,14613},{26375,10,4139},{26379,0,3662},
+{26381,10,4142},{26386,22,4145},{26393,0,17762},{26395,22,4151},
+{26402,0,21734},{26405,0,19442},{26406,5,5138},{26408,0,3814},
+{26410,18,4157},{26417,0,2327},{26419,22,4162},{26426,0,1589},
+{26429,10,4168},{26433,0,5144},{26435,0,13751},{26437,18,4171},
+{26444,22,4176},{26451,14,4182},{26457,0,5150},{26460,26,4186},
+{26467,5,5151},{26469,6,4193},{26474,0,5157},{26476,46,4195},
+{26491,6,4207},{26494,14,4209},{26500,6,4213},{26503,0,3470},
+{26505,0,5153},{26507,6,4215},{26510,22,4217},{26517,34,4223},
+{26528,10,4232},{26532,0,19448},{26534,0,5160},{26537,0,5155},
+{26543,42,4235},{26555,0,8491},{26556,5,21742},{26558,0,19451},
+{26560,26,4246},{26568,10,4253},{26574,26,4256},{26583,30,4263},
+{26593,6,4271},{26596,0,5170},{26598,6,4273},{26601,0,5168},
+{26604,0,5166},{26606,38,4275},{26617,14,4285},{26622,6,4289},
+{26625,18,4291},{26640,0,17776},{26643,6,4296},{26646,14,4298},
+{26653,10,4302},{26657,6,4305},{26663,26,4307},{26671,0,21755},
+{26672,5,14627},{26674,10,4314},{26680,6,4317},{26683,46,4319},
+{26696,10,4331},{26700,10,4334},{26704,22,4337},{26711,10,4343},
+{26715,10,4346},{26719,0,2181},{26723,0,5190},{26727,0,3490},
+{26731,0,17798},{26734,0,17799},{26735,9,21759},{26738,0,14630},
+{26740,14,4349},{26745,14,4353},{26750,6,4357},{26753,22,4359},
+{26760,0,21764},{26765,14,4365},{26771,6,4369},{26774,6,4371},
+{26776,9,17805},{26779,10,4373},{26783,18,4376},{26789,18,4381},
+{26794,5,17809},{26797,38,4386},{26809,14,4396},{26819,14,4400},
+{26824,22,4404},{26831,46,4410},{26844,5,21770},{26847,10,4422},
+{26851,0,5225},{26852,5,17820},{26855,6,4425},{26858,22,4427},
+{26864,5,14640},{26866,0,2647},{26869,10,4433},{26873,18,4436},
+{26880,6,4441},{26883,66,4443},{26902,6,4460},{26905,14,4462},
+{26913,10,4466},{26917,6,4469},{26920,0,5230},{26922,0,5231},
+{26928,6,4471},{26931,14,4473},{26936,6,4477},{26939,0,14646},
+{26941,0,5246},{26943,0,3060},{26946,0,16906},{26949,6,4479},
+{26953,6,4481},{26958,0,21781},{26963,10,4483},{26967,0,14647},
+{26969,22,4486},{26976,26,4492},{26984,30,4499},{26992,5,21783},
+{26994,14,4507},{26999,30,4511},{27007,5,14650},{27009,6,4519},
+{27014,0,14144},{27018,0,2135},{27021,6,4521},{27025,6,4523},
+{27028,10,4525},{27032,0,8500},{27035,6,4528},{27040,6,4530},
+{27045,14,4532},{27051,0,19462},{27053,22,4536},{27060,0,5273},
+{27063,6,4542},{27066,10,4544},{27070,14,4547},{27075,0,5266},
+{27077,0,21789},{27079,6,4551},{27082,30,4553},{27091,0,5259},
+{27094,5,14655},{27096,6,4561},{27101,6,4563},{27106,6,4565},
+{27109,0,19464},{27111,18,4567},{27117,0,5286},{27118,5,17845},
+{27121,22,4572},{27129,0,5280},{27131,0,3052},{27133,26,4578},
+{27141,0,5283},{27146,10,4585},{27151,0,14658},{27153,18,4588},
+{27159,0,2994},{27161,10,4593},{27165,30,4596},{27176,14,4604},
+{27182,0,5268},{27184,0,8502},{27186,5,17855},{27188,30,4608},
+{27197,10,4616},{27204,30,4619},{27214,0,17860},{27216,5,14664},
+{27218,0,17861},{27220,10,4627},{27224,6,4630},{27227,0,14667},
+{27231,0,1595},{27233,6,4632},{27236,0,17862},{27238,6,4634},
+{27242,6,4636},{27249,10,4638},{27256,0,5298},{27258,0,17859},
+{27262,14,4641},{27267,6,4645},{27270,5,21800},{27273,0,14669},
+{27275,0,17864},{27277,6,4647},{27280,6,4649},{27284,0,16917},
+{27287,0,5312},{27291,6,4651},{27293,9,14671},{27296,6,4653},
+{27298,5,5310},{27301,0,16918},{27306,10,4655},{27310,6,4658},
+{27312,5,21803},{27315,6,4660},{27320,0,5317},{27323,0,5314},
+{27325,0,17869},{27326,5,21806},{27329,10,4662},{27334,0,17870},
+{27336,5,19471},{27340,0,21808},{27344,6,4665},{27347,6,4667},
+{27349,5,21809},{27354,22,4669},{27362,0,8507},{27364,0,8508},
+{27367,6,4675},{27370,0,5325},{27372,0,14676},{27376,0,21811},
+{27377,9,17876},{27384,0,20152},{27386,14,4677},{27394,14,4681},
+{27398,5,21814},{27401,10,4685},{27407,9,17882},{27410,0,5330},
+{27414,6,4688},{27419,0,16920},{27421,18,4690},{27427,6,4695},
+{27431,6,4697},{27435,6,4699},{27439,0,17888},{27442,0,3913},
+{27445,26,4701},{27453,10,4708},{27459,0,5340},{27462,6,4711},
+{27465,6,4713},{27468,10,4715},{27472,0,5342},{27474,10,4718},
+{27478,0,14681},{27480,6,4721},{27483,0,5345},{27485,0,21822},
+{27487,34,4723},{27497,14,4732},{27502,10,4736},{27506,14,4739},
+{27511,0,13398},{27512,5,5348},{27514,6,4743},{27517,5,19476},
+{27519,5,5350},{27521,22,4745},{27529,10,4751},{27533,0,5354},
+{27541,14,4754},{27547,0,17895},{27550,0,5357},{27551,5,21828},
+{27554,5,21830},{27556,0,5358},{27560,6,4758},{27562,5,5359},
+{27564,38,4760},{27575,0,5365},{27576,5,21834},{27578,26,4770},
+{27587,5,21836},{27589,6,4777},{27591,9,17899},{27595,18,4779},
+{27602,10,4784},{27606,10,4787},{27610,6,4790},{27615,0,5370},
+{27617,0,14685},{27619,0,21838},{27622,5,17903},{27627,6,4792},
+{27630,6,4794},{27633,0,14686},{27635,0,5373},{27639,0,19479},
+{27641,0,19480},{27647,0,16926},{27650,0,17906},{27652,6,4796},
+{27656,10,4798},{27661,22,4801},{27667,5,5377},{27671,0,1598},
+{27673,0,21840},{27675,0,5379},{27679,0,21841},{27683,6,4807},
+{27686,9,21842},{27692,0,19484},{27694,0,21845},{27699,22,4809},
+{27706,6,4815},{27710,18,4817},{27722,6,4822},{27725,14,4824},
+{27730,0,19486},{27732,6,4828},{27735,0,1532},{27737,30,4830},
+{27746,0,5384},{27751,6,4838},{27754,6,4840},{27757,0,17913},
+{27759,6,4842},{27762,10,4844},{27766,0,14692},{27768,14,4847},
+{27773,6,4851},{27777,34,4853},{27788,6,4862},{27792,0,5395},
+{27794,42,4864},{27807,0,21852},{27809,6,4875},{27818,18,4877},
+{27824,18,4882},{27832,30,4887},{27841,6,4895},{27844,10,4897},
+{27849,6,4900},{27852,6,4902},{27855,34,4904},{27865,18,4913},
+{27872,14,4918},{27877,0,3103},{27879,14,4922},{27883,5,14701},
+{27885,30,4926},{27899,0,16930},{27904,6,4934},{27908,0,8515},
+{27911,0,21861},{27914,10,4936},{27918,6,4939},{27921,10,4941},
+{27927,0,2714},{27929,10,4944},{27934,6,4947},{27940,6,4949},
+{27942,5,17928},{27944,14,4951},{27950,6,4955},{27953,22,4957},
+{27960,6,4963},{27963,18,4965},{27969,0,3958},{27972,6,4970},
+{27991,22,4972},{27998,14,4978},{28003,18,4982},{28009,6,4987},
+{28012,0,1435},{28014,10,4989},{28020,0,3915},{28023,10,4992},
+{28028,0,19493},{28032,5,17936},{28034,0,14711},{28037,0,5431},
+{28039,14,4995},{28044,10,4999},{28049,34,5002},{28059,6,5011},
+{28074,10,5013},{28078,6,5016},{28082,0,1271},{28084,6,5018},
+{28087,10,5020},{28092,6,5023},{28095,6,5025},{28098,0,17949},
+{28100,18,5027},{28106,10,5032},{28110,18,5035},{28117,6,5040},
+{28120,14,5042},{28125,22,5046},{28132,10,5052},{28136,18,5055},
+{28142,58,5060},{28160,0,21877},{28164,6,5075},{28167,18,5077},
+{28179,0,1826},{28181,0,5433},{28183,0,14150},{28185,10,5082},
+{28189,42,5085},{28201,0,1337},{28203,18,5096},{28210,0,17958},
+{28212,0,13330},{28214,0,17955},{28216,18,5101},{28222,0,5458},
+{28226,14,5106},{28232,5,17959},{28234,0,3767},{28235,5,17961},
+{28237,10,5110},{28241,6,5113},{28243,5,17964},{28246,10,5115},
+{28251,18,5118},{28258,6,5123},{28263,6,5125},{28267,0,5460},
+{28270,6,5127},{28274,6,5129},{28278,0,5462},{28283,0,19498},
+{28285,14,5131},{28290,0,5472},{28297,0,19500},{28300,6,5135},
+{28303,6,5137},{28307,0,17969},{28310,0,2410},{28312,6,5139},
+{28316,6,5141},{28319,6,5143},{28322,0,1202},{28325,0,5485},
+{28327,0,17970},{28330,6,5145},{28333,5,21887},{28335,0,5479},
+{28337,14,5147},{28342,6,5151},{28346,14,5153},{28351,26,5157},
+{28359,34,5164},{28369,0,1480},{28371,0,5477},{28372,5,5482},
+{28377,0,15416},{28378,5,19502},{28381,6,5173},{28390,0,15396},
+{28395,6,5175},{28397,5,21895},{28399,0,5497},{28402,0,5495},
+{28404,0,3107},{28407,10,5177},{28411,0,17976},{28413,10,5180},
+{28417,6,5183},{28420,0,21897},{28422,0,2283},{28424,10,5185},
+{28428,6,5188},{28431,10,5190},{28435,14,5193},{28440,0,17979},
+{28442,6,5197},{28448,0,3375},{28450,6,5199},{28453,6,5201},
+{28457,18,5203},{28463,18,5208},{28469,6,5213},{28472,0,2740},
+{28475,6,5215},{28478,6,5217},{28481,0,5488},{28485,0,1535},
+{28495,0,21904},{28497,14,5219},{28503,46,5223},{28516,0,2411},
+{28518,0,5518},{28520,0,17987},{28524,18,5235},{28532,0,5543},
+{28536,0,5505},{28538,0,5504},{28540,10,5240},{28544,18,5243},
+{28550,10,5248},{28555,14,5251},{28560,18,5255},{28566,10,5260},
+{28570,0,14735},{28573,0,19508},{28575,10,5263},{28579,14,5266},
+{28583,5,14736},{28586,0,5525},{28590,14,5270},{28595,0,5519},
+{28597,10,5274},{28601,0,5523},{28604,0,16950},{28606,0,17990},
+{28608,14,5277},{28613,10,5281},{28616,5,17995},{28618,0,16952},
+{28628,6,5284},{28632,0,5530},{28634,6,5286},{28638,14,5288},
+{28644,0,5430},{28648,6,5292},{28651,6,5294},{28654,14,5296},
+{28659,0,5510},{28661,6,5300},{28665,6,5302},{28668,10,5304},
+{28672,6,5307},{28677,10,5309},{28681,10,5312},{28685,0,19511},
+{28687,0,5539},{28689,0,5537},{28693,0,3520},{28695,6,5315},
+{28698,6,5317},{28701,14,5319},{28707,0,18002},{28710,10,5323},
+{28716,0,2633},{28719,6,5326},{28722,0,5549},{28724,0,21917},
+{28727,0,21918},{28729,6,5328},{28732,0,14743},{28734,0,5548},
+{28739,6,5330},{28743,22,5332},{28750,0,16954},{28753,0,5550},
+{28756,6,5338},{28760,0,3263},{28765,5,14746},{28771,10,5340},
+{28777,0,18010},{28779,6,5343},{28782,10,5345},{28789,6,5348},
+{28792,0,1662},{28796,10,5350},{28801,0,14751},{28805,6,5353},
+{28809,6,5355},{28814,0,1292},{28818,0,5553},{28820,22,5357},
+{28827,0,21924},{28831,0,18016},{28836,0,16956},{28843,26,5363},
+{28851,6,5370},{28855,18,5372},{28872,0,4029},{28874,6,5377},
+{28879,0,1226},{28881,0,18021},{28883,5,14754},{28885,5,19516},
+{28888,6,5379},{28892,6,5381},{28895,0,5560},{28900,0,16957},
+{28908,0,18019},{28913,0,5555},{28921,6,5383},{28925,0,5565},
+{28931,26,5385},{28939,6,5392},{28943,0,8537},{28948,0,1293},
+{28953,6,5394},{28956,0,5566},{28958,0,16959},{28960,6,5396},
+{28966,0,2479},{28971,0,16958},{28973,18,5398},{28982,0,2741},
+{28984,0,21930},{28988,0,2478},{28993,0,21931},{28997,0,19518},
+{28998,5,8540},{29001,14,5403},{29006,0,2717},{29008,14,5407},
+{29013,10,5411},{29017,6,5414},{29020,0,8539},{29022,0,18030},
+{29024,0,14763},{29026,0,5572},{29028,22,5416},{29036,0,5575},
+{29038,0,2301},{29049,0,14764},{29053,0,2718},{29056,0,18033},
+{29060,6,5422},{29063,6,5424},{29066,0,1789},{29068,0,21936},
+{29071,0,5576},{29074,0,14765},{29076,10,5426},{29081,10,5429},
+{29087,6,5432},{29090,0,18036},{29096,0,5580},{29100,0,5581},
+{29102,5,18037},{29104,14,5434},{29113,6,5438},{29118,0,5584},
+{29119,5,21939},{29121,0,8543},{29123,6,5440},{29128,6,5442},
+{29131,6,5444},{29134,0,5588},{29136,0,3997},{29138,22,5446},
+{29145,6,5452},{29148,0,18041},{29151,6,5454},{29157,10,5456},
+{29164,10,5459},{29172,6,5462},{29176,6,5464},{29179,6,5466},
+{29182,10,5468},{29190,6,5471},{29192,5,21944},{29197,0,5596},
+{29200,0,5597},{29203,0,21946},{29205,0,16967},{29207,0,19521},
+{29210,6,5473},{29213,0,14771},{29215,0,19522},{29220,0,21948},
+{29224,0,5599},{29226,14,5475},{29231,6,5479},{29234,0,5603},
+{29236,10,5481},{29240,10,5484},{29243,5,5604},{29245,6,5487},
+{29247,5,5606},{29249,10,5489},{29253,14,5492},{29259,6,5496},
+{29262,0,21951},{29263,5,19524},{29266,6,5498},{29269,5,14776},
+{29271,50,5500},{29287,10,5513},{29291,0,21953},{29294,5,18050},
+{29297,6,5516},{29300,0,5611},{29303,10,5518},{29307,5,21955},
+{29309,22,5521},{29316,0,19530},{29319,0,5615},{29321,0,21957},
+{29325,6,5527},{29330,6,5529},{29334,0,5617},{29339,0,16969},
+{29344,0,1624},{29346,0,5618},{29351,6,5531},{29356,26,5533},
+{29364,0,14781},{29366,0,2525},{29369,0,5620},{29374,0,8546},
+{29376,18,5540},{29382,6,5545},{29385,0,19531},{29388,0,18060},
+{29390,0,5625},{29392,0,1925},{29394,0,5626},{29397,5,21960},
+{29399,10,5547},{29403,0,2063},{29407,0,21963},{29408,5,5628},
+{29410,0,5627},{29413,0,19532},{29417,0,2329},{29420,6,5550},
+{29427,6,5552},{29431,30,5554},{29442,0,19534},{29444,5,14784},
+{29447,0,18065},{29450,6,5562},{29453,0,21965},{29458,6,5564},
+{29462,6,5566},{29464,5,18067},{29467,18,5568},{29474,0,19537},
+{29476,6,5573},{29479,22,5575},{29486,6,5581},{29489,18,5583},
+{29494,5,3867},{29497,0,18070},{29498,5,19538},{29501,10,5588},
+{29507,10,5591},{29517,0,19540},{29518,5,5643},{29520,0,16972},
+{29522,0,18074},{29526,10,5594},{29533,13,21970},{29539,0,2381},
+{29542,26,5597},{29550,5,18078},{29552,10,5604},{29557,0,5651},
+{29559,22,5607},{29568,6,5613},{29571,6,5615},{29573,5,14792},
+{29575,0,3952},{29577,10,5617},{29582,0,21977},{29584,0,21978},
+{29587,22,5620},{29596,0,18085},{29598,9,14795},{29602,0,16974},
+{29605,6,5626},{29608,14,5628},{29613,0,21982},{29618,6,5632},
+{29621,0,14800},{29623,0,14801},{29625,18,5634},{29631,6,5639},
+{29634,0,1361},{29637,6,5641},{29640,30,5643},{29650,6,5651},
+{29654,0,8552},{29657,0,14804},{29661,6,5653},{29664,6,5655},
+{29667,18,5657},{29673,6,5662},{29677,6,5664},{29681,0,5687},
+{29684,6,5666},{29687,18,5668},{29693,18,5673},{29699,18,5678},
+{29705,6,5683},{29713,0,21992},{29715,0,18094},{29722,5,14810},
+{29729,6,5685},{29732,10,5687},{29736,26,5690},{29743,9,14815},
+{29746,18,5697},{29753,6,5702},{29759,10,5704},{29763,6,5707},
+{29766,6,5709},{29771,0,14821},{29773,0,14822},{29777,10,5711},
+{29781,0,5669},{29783,0,14824},{29785,30,5714},{29794,10,5722},
+{29798,0,14825},{29799,5,21994},{29801,10,5725},{29805,26,5728},
+{29814,0,5679},{29822,0,5680},{29824,6,5735},{29827,0,3944},
+{29829,9,14829},{29832,6,5737},{29835,0,5681},{29839,14,5739},
+{29847,14,5743},{29852,0,14834},{29854,22,5747},{29861,26,5753},
+{29870,10,5760},{29873,5,22001},{29877,0,14839},{29881,10,5763},
+{29885,0,2257},{29887,0,14840},{29896,10,5766},{29900,0,22003},
+{29903,6,5769},{29907,6,5771},{29910,0,18114},{29912,0,18115},
+{29914,10,5773},{29918,10,5776},{29922,10,5779},{29926,22,5782},
+{29934,6,5788},{29936,5,5694},{29938,0,5693},{29940,0,19547},
+{29942,10,5790},{29946,10,5793},{29951,0,16982},{29953,0,8564},
+{29955,14,5796},{29964,10,5800},{29969,10,5803},{29973,14,5806},
+{29978,0,2585},{29980,0,3126},{29982,58,5810},{29999,18,5825},
+{30006,26,5830},{30013,5,18125},{30015,6,5837},{30019,6,5839},
+{30022,50,5841},{30036,0,3422},{30039,0,22020},{30041,38,5854},
+{30052,14,5864},{30057,18,5868},{30063,46,5873},{30075,5,22023},
+{30077,5,18134},{30079,0,1600},{30081,6,5885},{30085,0,22025},
+{30086,5,5724},{30089,14,5887},{30094,14,5891},{30098,5,14848},
+{30100,6,5895},{30105,6,5897},{30108,6,5899},{30114,14,5901},
+{30123,0,1272},{30128,22,5905},{30135,14,5911},{30140,10,5915},
+{30143,5,18142},{30145,26,5918},{30154,0,5744},{30156,14,5925},
+{30162,14,5929},{30167,10,5933},{30171,14,5936},{30175,5,18148},
+{30177,14,5940},{30183,0,18150},{30185,0,2795},{30188,0,14162},
+{30190,14,5944},{30194,5,5755},{30196,0,2962},{30201,6,5948},
+{30204,0,5751},{30206,5,5749},{30208,18,5950},{30215,26,5955},
+{30223,0,18156},{30226,6,5962},{30229,5,14855},{30232,6,5964},
+{30235,5,18160},{30237,10,5966},{30240,9,5762},{30243,26,5969},
+{30253,0,14859},{30256,0,5767},{30258,14,5976},{30264,0,19566},
+{30265,5,22032},{30267,6,5980},{30272,26,5982},{30279,5,5769},
+{30281,14,5989},{30286,0,14163},{30290,0,3850},{30293,6,5993},
+{30296,6,5995},{30300,0,5772},{30303,0,19569},{30305,5,5774},
+{30308,6,5997},{30311,0,5779},{30312,9,5776},{30316,26,5999},
+{30324,0,14867},{30326,0,5783},{30328,0,5784},{30330,18,6006},
+{30336,34,6011},{30347,0,5789},{30348,5,22038},{30350,0,5790},
+{30352,0,2167},{30355,0,5792},{30357,6,6020},{30361,5,5793},
+{30363,26,6022},{30370,5,22041},{30372,5,14868},{30374,0,8570},
+{30375,5,18178},{30378,0,16991},{30381,14,6029},{30388,0,5796},
+{30390,6,6033},{30392,9,5797},{30397,0,19571},{30399,0,2172},
+{30401,10,6035},{30405,6,6038},{30408,26,6040},{30418,0,5803},
+{30420,0,16994},{30422,6,6047},{30425,0,19572},{30427,6,6049},
+{30430,14,6051},{30435,22,6055},{30442,10,6061},{30446,0,3816},
+{30448,10,6064},{30452,0,3034},{30454,0,22047},{30456,6,6067},
+{30459,6,6069},{30462,0,2412},{30464,6,6071},{30468,0,5813},
+{30470,26,6073},{30478,0,19577},{30482,0,22049},{30484,5,22050},
+{30487,0,18186},{30489,14,6080},{30494,10,6084},{30498,0,19578},
+{30500,0,5815},{30501,5,5817},{30504,6,6087},{30509,10,6089},
+{30516,10,6092},{30519,5,5820},{30521,6,6095},{30524,10,6097},
+{30528,0,2979},{30530,0,22055},{30533,10,6100},{30538,0,19584},
+{30541,5,16999},{30543,0,19585},{30546,0,22056},{30550,5,22057},
+{30552,0,18194},{30554,10,6103},{30558,0,19586},{30559,5,14877},
+{30561,30,6106},{30570,10,6114},{30576,0,22059},{30578,0,14879},
+{30579,5,22060},{30585,6,6117},{30588,18,6119},{30596,0,19590},
+{30603,0,5832},{30604,5,19591},{30606,0,5831},{30609,0,5833},
+{30612,10,6124},{30618,0,18199},{30622,10,6127},{30626,0,18201},
+{30628,6,6130},{30631,0,19594},{30633,6,6132},{30636,22,6134},
+{30643,0,3215},{30645,10,6140},{30649,0,5838},{30651,0,5842},
+{30652,5,5840},{30654,6,6143},{30659,0,22067},{30663,0,5843},
+{30665,0,19598},{30669,0,5844},{30673,6,6145},{30677,0,22069},
+{30679,0,5845},{30681,14,6147},{30686,5,18203},{30688,0,17004},
+{30690,22,6151},{30697,6,6157},{30700,22,6159},{30707,6,6165},
+{30712,0,22070},{30715,6,6167},{30722,0,2093},{30725,6,6169},
+{30729,0,18211},{30732,10,6171},{30737,6,6174},{30740,6,6176},
+{30745,0,18213},{30749,0,22073},{30752,14,6178},{30757,10,6182},
+{30764,0,18214},{30765,5,14888},{30768,0,14890},{30770,0,3666},
+{30772,6,6185},{30775,0,19602},{30778,0,3153},{30783,0,2030},
+{30787,10,6187},{30791,6,6190},{30796,0,22077},{30798,6,6192},
+{30801,6,6194},{30812,10,6196},{30816,5,22080},{30819,6,6199},
+{30824,0,14892},{30826,10,6201},{30830,6,6204},{30834,0,3383},
+{30836,0,5858},{30842,0,8577},{30844,0,5860},{30846,0,19604},
+{30849,0,1951},{30854,6,6206},{30858,0,18218},{30860,14,6208},
+{30865,0,3454},{30867,10,6212},{30871,6,6215},{30874,0,5861},
+{30877,10,6217},{30881,0,19606},{30883,6,6220},{30887,14,6222},
+{30892,6,6226},{30895,18,6228},{30901,0,5864},{30906,22,6233},
+{30913,0,2259},{30917,30,6239},{30926,0,14896},{30928,26,6247},
+{30938,6,6254},{30943,0,22093},{30944,5,14898},{30948,0,14897},
+{30950,10,6256},{30954,0,22094},{30956,0,5875},{30959,0,1199},
+{30962,10,6259},{30966,6,6262},{30969,5,18226},{30971,0,14902},
+{30973,18,6264},{30982,6,6269},{30988,0,19611},{30990,0,2757},
+{30992,10,6271},{31001,14,6274},{31006,10,6278},{31013,6,6281},
+{31015,5,19613},{31017,22,6283},{31024,6,6289},{31028,6,6291},
+{31034,34,6293},{31044,30,6302},{31055,10,6310},{31059,22,6313},
+{31066,0,5890},{31067,5,14908},{31069,14,6319},{31074,0,3296},
+{31077,0,2485},{31079,10,6323},{31083,0,19618},{31085,0,2119},
+{31090,0,18237},{31095,0,3186},{31097,14,6326},{31102,14,6330},
+{31108,6,6334},{31114,22,6336},{31121,0,22113},{31123,14,6342},
+{31128,0,14912},{31131,10,6346},{31137,0,18239},{31142,22,6349},
+{31150,14,6355},{31155,6,6359},{31160,0,14913},{31161,5,5902},
+{31163,0,14914},{31165,22,6361},{31172,0,19621},{31175,18,6367},
+{31180,5,18244},{31183,0,22118},{31185,6,6372},{31188,10,6374},
+{31192,0,3455},{31194,0,14916},{31197,42,6377},{31209,18,6388},
+{31216,6,6393},{31224,0,22124},{31227,6,6395},{31232,0,1603},
+{31234,6,6397},{31237,0,13875},{31239,30,6399},{31249,0,14919},
+{31252,6,6407},{31255,0,3477},{31256,5,5912},{31258,10,6409},
+{31262,14,6412},{31271,0,22128},{31275,0,22129},{31277,22,6416},
+{31284,5,22131},{31287,38,6422},{31298,30,6432},{31308,18,6440},
+{31317,10,6445},{31321,0,18258},{31324,6,6448},{31327,6,6450},
+{31329,5,5924},{31331,0,2527},{31333,0,22135},{31335,0,18261},
+{31337,10,6452},{31341,0,14927},{31344,0,5928},{31348,10,6455},
+{31352,10,6458},{31357,38,6461},{31368,0,5931},{31370,6,6471},
+{31376,34,6473},{31390,10,6482},{31395,0,14930},{31401,6,6485},
+{31404,0,18267},{31406,10,6487},{31411,0,14931},{31413,6,6490},
+{31417,6,6492},{31419,5,14932},{31421,10,6494},{31427,50,6497},
+{31441,10,6510},{31445,0,5948},{31449,5,5950},{31451,10,6513},
+{31455,6,6516},{31457,5,5953},{31459,0,2401},{31461,34,6518},
+{31471,10,6527},{31476,0,18275},{31478,0,1693},{31480,14,6530},
+{31485,10,6534},{31490,0,5958},{31492,0,5971},{31494,10,6537},
+{31498,6,6540},{31503,0,5959},{31505,6,6542},{31508,0,14936},
+{31512,5,5963},{31515,0,3109},{31518,10,6544},{31523,0,22147},
+{31525,34,6547},{31534,5,18281},{31536,6,6556},{31539,14,6558},
+{31545,0,2155},{31547,0,17029},{31549,0,18279},{31551,5,22151},
+{31553,0,18286},{31557,18,6562},{31563,46,6567},{31581,0,5993},
+{31584,0,14941},{31588,14,6579},{31593,6,6583},{31596,14,6585},
+{31600,5,5980},{31602,14,6589},{31607,0,19635},{31609,6,6593},
+{31615,0,18285},{31620,0,22154},{31622,6,6595},{31625,0,22155},
+{31627,0,5990},{31629,22,6597},{31636,54,6603},{31653,0,22158},
+{31658,0,2939},{31660,6,6617},{31663,14,6619},{31668,10,6623},
+{31672,0,3384},{31674,5,22161},{31676,6,6626},{31680,10,6628},
+{31684,34,6631},{31695,0,5998},{31700,0,18304},{31702,6,6640},
+{31705,10,6642},{31709,0,6001},{31712,0,2288},{31716,10,6645},
+{31720,10,6648},{31725,0,4060},{31728,0,18308},{31730,6,6651},
+{31732,5,22167},{31734,10,6653},{31737,5,22169},{31740,0,19642},
+{31742,0,19643},{31744,18,6656},{31750,6,6661},{31753,0,19644},
+{31755,18,6663},{31761,14,6668},{31767,0,6013},{31769,0,22175},
+{31771,0,22176},{31774,14,6672},{31779,0,6016},{31781,14,6676},
+{31786,10,6680},{31791,0,19646},{31793,0,14953},{31795,6,6683},
+{31798,10,6685},{31801,5,22180},{31805,14,6688},{31810,6,6692},
+{31813,6,6694},{31818,0,18312},{31820,6,6696},{31823,10,6698},
+{31826,5,19648},{31828,26,6701},{31835,9,19650},{31838,14,6708},
+{31843,10,6712},{31847,0,14957},{31849,0,18316},{31852,18,6715},
+{31858,6,6720},{31861,0,6035},{31865,0,17035},{31867,14,6722},
+{31873,10,6726},{31878,6,6729},{31881,0,3588},{31883,0,2606},
+{31885,0,3772},{31887,6,6731},{31890,0,3963},{31892,6,6733},
+{31895,6,6735},{31899,0,2391},{31902,18,6737},{31908,18,6742},
+{31915,0,6041},{31917,6,6747},{31920,14,6749},{31926,5,18323},
+{31929,30,6753},{31938,0,6052},{31940,6,6761},{31943,0,19658},
+{31944,5,14962},{31946,0,1926},{31949,10,6763},{31954,34,6766},
+{31964,18,6775},{31970,0,6056},{31974,6,6780},{31977,0,22193},
+{31979,0,14967},{31983,0,6058},{31986,0,6059},{31988,10,6782},
+{31992,0,2227},{31994,6,6785},{31998,0,1668},{32000,0,1604},
+{32002,18,6787},{32007,9,14968},{32010,6,6792},{32013,0,3314},
+{32015,62,6794},{32032,14,6810},{32038,0,22197},{32042,38,6814},
+{32053,0,6073},{32057,6,6824},{32060,0,19661},{32061,5,18340},
+{32063,38,6826},{32075,26,6836},{32083,0,14975},{32085,10,6843},
+{32089,22,6846},{32097,10,6852},{32101,14,6855},{32106,0,18348},
+{32110,0,6080},{32112,14,6859},{32117,6,6863},{32120,14,6865},
+{32125,0,6087},{32127,0,18351},{32129,10,6869},{32133,6,6872},
+{32136,6,6874},{32139,5,14980},{32141,0,19665},{32143,0,6086},
+{32145,0,19666},{32147,0,6083},{32150,6,6876},{32153,30,6878},
+{32162,6,6886},{32166,6,6888},{32170,70,6890},{32189,14,6908},
+{32194,0,17044},{32195,13,22208},{32199,0,6093},{32202,10,6912},
+{32205,5,22212},{32207,14,6915},{32213,22,6919},{32220,10,6925},
+{32224,26,6928},{32232,22,6935},{32239,0,1186},{32241,6,6941},
+{32244,0,4037},{32245,5,19672},{32249,10,6943},{32256,6,6946},
+{32260,6,6948},{32264,14,6950},{32272,10,6954},{32277,0,14988},
+{32279,0,18368},{32283,34,6957},{32294,10,6966},{32299,18,6969},
+{32305,10,6974},{32309,10,6977},{32313,10,6980},{32317,10,6983},
+{32321,0,3423},{32323,22,6986},{32330,6,6992},{32333,6,6994},
+{32336,0,22224},{32338,0,8596},{32340,10,6996},{32344,0,22225},
+{32345,5,6133},{32349,10,6999},{32353,6,7002},{32357,10,7004},
+{32361,10,7007},{32365,14,7010},{32371,0,14993},{32373,0,18373},
+{32376,6,7014},{32379,18,7016},{32385,10,7021},{32390,5,18375},
+{32392,5,6145},{32394,0,8359},{32396,26,7024},{32403,5,6150},
+{32405,6,7031},{32408,0,14996},{32410,0,18378},{32411,5,6154},
+{32413,5,22229},{32566,0,1544},{32568,0,6156},{32570,22,7033},
+{32579,10,7039},{32583,0,8597},{32588,9,6159},{32591,0,14998},
+{32592,5,6162},{32594,5,14999},{32596,6,7042},{32600,0,6166},
+{32603,10,7044},{32607,5,6167},{32609,0,15001},{32611,5,18387},
+{32613,10,7047},{32616,5,6169},{32618,6,7050},{32621,6,7052},
+{32624,10,7054},{32629,0,3331},{32631,10,7057},{32637,5,18390},
+{32639,5,19685},{32642,6,7060},{32645,14,7062},{32650,30,7066},
+{32660,0,6179},{32662,6,7074},{32666,0,6182},{32668,10,7076},
+{32673,14,7079},{32678,0,22237},{32680,10,7083},{32685,10,7086},
+{32690,0,6185},{32692,0,22239},{32694,0,6188},{32696,6,7089},
+{32700,6,7091},{32703,10,7093},{32707,0,18399},{32709,5,6191},
+{32712,0,22242},{32714,0,6193},{32716,0,3916},{32718,6,7096},
+{32722,0,2358},{32724,6,7098},{32731,0,17047},{32735,10,7100},
+{32739,0,18401},{32741,6,7103},{32744,6,7105},{32747,6,7107},
+{32750,5,15008},{32752,0,1545},{32754,6,7109},{32761,14,7111},
+{32765,9,19689},{32768,34,7115},{32778,54,7124},{32792,5,6206},
+{32796,10,7138},{32799,5,22247},{32801,0,6209},{32804,0,15014},
+{32806,0,15015},{32808,0,6210},{32812,0,18406},{32814,0,22249},
+{32816,0,18407},{32819,18,7141},{32825,30,7146},{32835,6,7154},
+{32838,0,6214},{32842,0,6213},{32850,0,6215},{32854,0,2655},
+{32856,0,6216},{32858,0,6217},{32862,18,7156},{32868,0,22254},
+{32870,0,18409},{32872,0,6220},{32877,0,22255},{32879,34,7161},
+{32889,0,6225},{32891,0,18410},{32893,10,7170},{32897,0,22256},
+{32900,22,7173},{32907,6,7179},{32910,0,19697},{32915,0,6232},
+{32918,0,2491},{32920,26,7181},{32929,6,7188},{32932,14,7190},
+{32937,18,7194},{32943,0,2016},{32945,6,7199},{32948,0,2136},
+{32952,10,7201},{32963,14,7204},{32968,0,22258},{32970,0,17050},
+{32972,14,7208},{32978,0,22260},{32980,10,7212},{32983,5,15024},
+{32985,10,7215},{32989,6,7218},{32992,6,7220},{32996,10,7222},
+{33005,70,7225},{33026,6,7243},{33029,26,7245},{33037,0,18420},
+{33046,10,7252},{33050,10,7255},{33054,0,18425},{33056,0,22267},
+{33059,6,7258},{33063,0,18428},{33065,0,6248},{33067,6,7260},
+{33071,10,7262},{33075,0,3316},{33077,0,18424},{33081,6,7265},
+{33084,10,7267},{33089,0,14194},{33093,10,7270},{33098,10,7273},
+{33102,0,2587},{33104,22,7276},{33111,0,19708},{33119,10,7282},
+{33125,5,6260},{33127,5,17054},{33129,0,18433},{33131,0,2332},
+{33133,18,7285},{33139,6,7290},{33143,14,7292},{33151,30,7296},
+{33160,0,6264},{33162,6,7304},{33166,10,7306},{33171,0,6273},
+{33173,6,7309},{33176,0,18438},{33178,18,7311},{33184,0,6268},
+{33186,10,7316},{33192,6,7319},{33198,0,22278},{33200,0,6275},
+{33202,14,7321},{33208,0,6278},{33210,6,7325},{33213,26,7327},
+{33221,6,7334},{33224,14,7336},{33229,10,7340},{33233,0,6285},
+{33235,0,2817},{33237,26,7343},{33245,5,19717},{33247,5,6290},
+{33249,0,19719},{33251,10,7350},{33255,6,7353},{33258,14,7355},
+{33263,0,19720},{33264,9,22282},{33267,14,7359},{33272,6,7363},
+{33274,5,6293},{33276,18,7365},{33281,5,6296},{33283,10,7370},
+{33287,38,7373},{33298,0,4105},{33299,5,19724},{33302,38,7383},
+{33313,6,7393},{33320,18,7395},{33326,0,6319},{33330,34,7400},
+{33340,0,18456},{33344,0,6308},{33347,18,7409},{33353,0,18457},
+{33355,0,15041},{33358,6,7414},{33361,0,22293},{33366,18,7416},
+{33372,6,7421},{33375,6,7423},{33378,10,7425},{33382,10,7428},
+{33386,5,6317},{33389,10,7431},{33393,6,7434},{33396,0,17062},
+{33398,0,1298},{33399,5,6321},{33401,0,14197},{33403,0,22296},
+{33405,10,7436},{33408,5,22297},{33411,6,7439},{33415,0,22299},
+{33417,10,7441},{33421,6,7444},{33425,14,7446},{33430,0,22301},
+{33432,6,7450},{33434,5,22303},{33437,0,2291},{33439,10,7452},
+{33443,5,17065},{33445,6,7455},{33447,5,18473},{33449,46,7457},
+{33463,34,7469},{33477,6,7478},{33488,22,7480},{33495,0,3510},
+{33497,14,7486},{33502,42,7490},{33514,6,7501},{33517,0,22309},
+{33519,0,19737},{33521,0,1267},{33523,6,7503},{33526,6,7505},
+{33529,10,7507},{33533,6,7510},{33536,26,7512},{33543,5,18482},
+{33545,0,6344},{33546,5,22310},{33548,0,18484},{33550,0,1834},
+{33558,0,6348},{33559,5,6357},{33563,10,7519},{33566,5,22312},
+{33569,10,7522},{33576,0,1205},{33579,62,7525},{33596,6,7541},
+{33600,0,6351},{33602,22,7543},{33609,6,7549},{33613,5,22321},
+{33615,38,7551},{33626,0,14202},{33634,6,7561},{33648,0,22323},
+{33651,0,6371},{33653,0,6372},{33655,6,7563},{33659,10,7565},
+{33663,6,7568},{33666,0,22325},{33668,14,7570},{33673,6,7574},
+{33677,6,7576},{33682,6,7578},{33684,5,18495},{33686,0,6364},
+{33688,34,7580},{33698,0,6363},{33702,30,7589},{33713,0,3923},
+{33717,0,6370},{33725,6,7597},{33727,5,15057},{33729,0,6384},
+{33733,0,2625},{33735,0,8603},{33737,6,7599},{33740,0,1749},
+{33742,14,7601},{33747,6,7605},{33750,0,2492},{33752,0,6382},
+{33756,6,7607},{33759,10,7609},{33765,0,18503},{33768,14,7612},
+{33775,14,7616},{33780,0,6376},{33782,14,7620},{33787,10,7624},
+{33793,0,17081},{33795,6,7627},{33798,6,7629},{33802,22,7631},
+{33809,0,15061},{33811,0,6377},{33813,0,18505},{33815,0,18507},
+{33817,0,22334},{33824,0,6391},{33826,0,6390},{33833,6,7637},
+{33836,0,6408},{33839,0,22336},{33841,0,1500},{33845,0,6411},
+{33848,6,7639},{33852,6,7641},{33861,22,7643},{33869,10,7649},
+{33873,5,18510},{33878,10,7652},{33881,5,18512},{33883,6,7655},
+{33887,34,7657},{33897,34,7666},{33907,30,7675},{33916,6,7683},
+{33921,6,7685},{33924,6,7687},{33931,0,2493},{33936,0,2361},
+{33938,14,7689},{33943,0,18521},{33945,0,3812},{33948,0,3513},
+{33950,6,7693},{33953,0,6425},{33958,0,18522},{33960,0,15064},
+{33961,5,22350},{33965,0,6403},{33967,0,15065},{33969,6,7695},
+{33972,0,8606},{33976,42,7697},{33988,0,2973},{33990,0,6423},
+{33991,5,22352},{33993,18,7708},{33998,5,18525},{34000,6,7713},
+{34003,0,18527},{34006,0,6424},{34009,6,7715},{34012,0,8363},
+{34023,0,18529},{34026,0,18530},{34028,0,3671},{34030,18,7717},
+{34036,0,6428},{34039,0,22356},{34042,14,7722},{34047,6,7726},
+{34050,5,22357},{34054,6,7728},{34060,0,15070},{34062,0,22360},
+{34064,6,7730},{34067,10,7732},{34071,5,6429},{34074,10,7735},
+{34078,6,7738},{34081,10,7740},{34084,5,18535},{34086,6,7743},
+{34090,14,7745},{34095,0,17092},{34098,18,7749},{34109,18,7754},
+{34115,0,3437},{34118,0,19748},{34120,14,7759},{34126,22,7763},
+{34133,22,7769},{34140,10,7775},{34143,5,22373},{34145,5,18542},
+{34147,6,7778},{34152,14,7780},{34157,0,6450},{34159,0,18539},
+{34167,0,6456},{34169,10,7784},{34173,18,7787},{34180,34,7792},
+{34191,10,7801},{34195,6,7804},{34199,10,7806},{34203,10,7809},
+{34207,6,7812},{34210,0,17096},{34212,50,7814},{34228,0,22381},
+{34230,18,7827},{34236,0,18556},{34237,9,22384},{34241,6,7832},
+{34247,0,18557},{34249,10,7834},{34253,14,7837},{34261,0,6464},
+{34264,5,18559},{34266,0,22388},{34268,6,7841},{34271,10,7843},
+{34276,10,7846},{34280,10,7849},{34285,0,17098},{34291,6,7852},
+{34294,6,7854},{34297,14,7856},{34302,10,7860},{34306,0,6441},
+{34308,5,17100},{34310,6,7863},{34314,6,7865},{34317,5,22393},
+{34320,14,7867},{34326,22,7871},{34334,0,18567},{34337,6,7877},
+{34340,0,18569},{34343,0,18570},{34345,0,15078},{34349,0,3936},
+{34351,6,7879},{34358,0,22397},{34360,10,7881},{34364,6,7884},
+{34367,14,7886},{34374,0,19754},{34381,6,7890},{34384,0,1646},
+{34386,22,7892},{34392,5,22400},{34394,22,7898},{34400,5,22403},
+{34402,10,7904},{34407,0,6483},{34409,0,22406},{34411,6,7907},
+{34415,0,15082},{34417,0,6484},{34421,10,7909},{34425,10,7912},
+{34429,0,14214},{34439,14,7915},{34443,5,6489},{34445,0,15084},
+{34449,0,15085},{34451,0,6485},{34453,6,7919},{34456,0,15086},
+{34458,0,22409},{34460,5,18581},{34465,0,22410},{34467,6,7921},
+{34470,0,22411},{34471,5,15087},{34473,5,6487},{34475,0,6498},
+{34477,0,22412},{34479,10,7923},{34483,0,18584},{34484,5,22413},
+{34486,14,7926},{34495,10,7930},{34499,18,7933},{34505,0,6496},
+{34507,0,2943},{34509,6,7938},{34513,6,7940},{34516,6,7942},
+{34519,0,18589},{34521,14,7944},{34526,10,7948},{34531,18,7951},
+{34537,0,6501},{34540,14,7956},{34552,26,7960},{34560,0,6509},
+{34562,38,7967},{34573,30,7977},{34584,10,7985},{34588,0,3766},
+{34590,6,7988},{34593,10,7990},{34597,0,6521},{34600,6,7993},
+{34606,6,7995},{34609,6,7997},{34612,0,6517},{34615,0,6519},
+{34617,10,7999},{34620,5,22430},{34622,10,8002},{34627,0,18603},
+{34629,0,22432},{34633,0,2698},{34635,14,8005},{34641,0,18604},
+{34643,0,6534},{34645,0,2544},{34647,10,8009},{34653,0,19760},
+{34655,10,8012},{34659,0,6535},{34660,5,18606},{34662,0,1372},
+{34664,0,6531},{34666,0,6536},{34670,6,8015},{34673,6,8017},
+{34676,0,6529},{34678,0,3023},{34680,0,6526},{34683,6,8019},
+{34687,0,3358},{34690,0,6540},{34691,13,22436},{34695,10,8021},
+{34699,14,8024},{34704,0,22440},{34707,0,18615},{34709,0,22441},
+{34711,5,19764},{34713,0,15099},{34718,10,8028},{34722,6,8031},
+{34727,0,18612},{34731,0,6547},{34732,5,15100},{34734,6,8033},
+{34737,0,22443},{34739,0,6549},{34741,0,15102},{34746,6,8035},
+{34749,18,8037},{34756,0,6548},{34758,22,8042},{34766,0,18622},
+{34768,0,6545},{34770,0,6562},{34773,6,8048},{34777,6,8050},
+{34780,0,22448},{34783,6,8052},{34786,10,8054},{34789,5,18626},
+{34794,14,8057},{34799,0,6553},{34801,10,8061},{34805,0,15421},
+{34806,5,6559},{34808,14,8064},{34814,6,8068},{34817,0,15106},
+{34819,0,20312},{34821,10,8070},{34825,10,8073},{34829,38,8076},
+{34840,18,8086},{34846,6,8091},{34849,10,8093},{34855,6,8096},
+{34861,6,8098},{34864,10,8100},{34869,6,8103},{34873,14,8105},
+{34880,26,8109},{34888,5,22465},{34890,18,8116},{34897,10,8121},
+{34901,62,8124},{34920,6,8140},{34923,0,6579},{34926,18,8142},
+{34933,0,6583},{34935,0,2989},{34937,0,22472},{34939,0,22473},
+{34941,22,8147},{34952,0,1804},{34955,0,2878},{34957,0,6593},
+{34962,0,6589},{34966,14,8153},{34970,9,19782},{34974,10,8157},
+{34978,0,6592},{34980,0,6594},{34984,0,22476},{34986,6,8160},
+{34990,0,6590},{34992,6,8162},{34996,6,8164},{34999,0,1157},
+{35002,0,22477},{35004,0,18643},{35005,5,15117},{35007,14,8166},
+{35011,5,6598},{35013,6,8170},{35018,0,15119},{35019,5,22478},
+{35021,10,8172},{35025,18,8175},{35032,5,6601},{35035,26,8180},
+{35047,6,8187},{35055,0,19787},{35056,5,15122},{35058,14,8189},
+{35063,10,8193},{35068,10,8196},{35073,6,8199},{35076,0,6610},
+{35078,6,8201},{35082,0,6612},{35084,6,8203},{35086,5,19788},
+{35088,0,1482},{35090,6,8205},{35093,5,22484},{35096,9,15125},
+{35100,10,8207},{35104,0,22486},{35109,14,8210},{35114,5,6617},
+{35120,10,8214},{35125,26,8217},{35134,0,15130},{35136,26,8224},
+{35145,0,18655},{35148,6,8231},{35151,0,22491},{35154,0,22492},
+{35158,6,8233},{35162,10,8235},{35166,26,8238},{35174,0,6628},
+{35178,6,8245},{35181,14,8247},{35186,14,8251},{35191,0,6634},
+{35194,30,8255},{35203,0,6636},{35206,22,8263},{35213,0,22502},
+{35215,6,8269},{35219,22,8271},{35226,0,1454},{35227,5,22504},
+{35231,10,8277},{35237,10,8280},{35241,6,8283},{35244,0,6644},
+{35247,6,8285},{35250,22,8287},{35258,0,6647},{35260,6,8293},
+{35263,5,6649},{35282,0,1455},{35284,18,8295},{35290,0,6651},
+{35292,5,6652},{35299,0,1394},{35301,10,8300},{35305,0,22510},
+{35307,0,18664},{35309,0,22511},{35313,0,15135},{35315,6,8303},
+{35318,0,17122},{35320,6,8305},{35325,0,18667},{35327,18,8307},
+{35332,5,22513},{35335,6,8312},{35338,0,2588},{35340,0,6660},
+{35342,42,8314},{35355,0,6661},{35357,38,8325},{35370,0,3674},
+{35371,5,22519},{35373,0,2691},{35375,0,22521},{35377,0,1680},
+{35379,18,8335},{35386,18,8340},{35392,6,8345},{35395,0,22524},
+{35397,18,8347},{35405,6,8352},{35408,34,8354},{35419,14,8363},
+{35424,14,8367},{35429,10,8371},{35433,0,2235},{35435,14,8374},
+{35440,14,8378},{35445,0,17126},{35446,5,22529},{35449,0,8618},
+{35450,5,22531},{35452,0,6670},{35454,10,8382},{35458,22,8385},
+{35465,0,3882},{35467,10,8391},{35471,18,8394},{35477,22,8399},
+{35486,14,8405},{35491,6,8409},{35493,5,6680},{35495,14,8411},
+{35500,18,8415},{35506,6,8420},{35510,6,8422},{35513,0,3460},
+{35515,6,8424},{35518,6,8426},{35522,10,8428},{35526,30,8431},
+{35535,14,8439},{35539,9,22549},{35542,6,8443},{35546,34,8445},
+{35556,0,6691},{35558,6,8454},{35563,14,8456},{35568,6,8460},
+{35571,22,8462},{35578,0,1909},{35580,0,18683},{35582,18,8468},
+{35588,14,8473},{35594,30,8477},{35604,0,6693},{35606,6,8485},
+{35609,34,8487},{35622,0,6709},{35624,0,6712},{35627,10,8496},
+{35632,0,22556},{35635,0,6707},{35639,0,15144},{35641,0,1752},
+{35644,0,22557},{35646,0,6711},{35649,6,8499},{35651,5,15145},
+{35653,6,8501},{35656,6,8503},{35660,14,8505},{35665,14,8509},
+{35670,0,6718},{35672,18,8513},{35678,6,8518},{35683,0,22561},
+{35686,0,1839},{35689,0,17130},{35691,10,8520},{35695,14,8523},
+{35700,0,6725},{35702,14,8527},{35708,22,8531},{35715,10,8537},
+{35722,26,8540},{35730,5,6730},{35732,5,18696},{35734,0,6732},
+{35737,5,6733},{35740,14,8547},{35895,14,8551},{35901,10,8555},
+{35905,0,6736},{35909,30,8558},{35918,14,8566},{35923,10,8570},
+{35927,18,8573},{35933,0,22571},{35937,6,8578},{35939,5,22573},
+{35942,0,22575},{35944,22,8580},{35955,0,15152},{35957,5,22576},
+{35960,18,8586},{35966,0,22578},{35970,0,6747},{35973,0,6749},
+{35974,5,22579},{35977,14,8591},{35981,5,6751},{35984,0,22582},
+{35986,10,8595},{35992,6,8598},{35995,30,8600},{36004,0,15153},
+{36007,38,8608},{36018,5,6760},{36020,0,1608},{36022,30,8618},
+{36031,50,8626},{36045,10,8639},{36049,10,8642},{36053,6,8645},
+{36057,22,8647},{36064,18,8653},{36070,0,3548},{36072,0,22590},
+{36074,0,2285},{36076,6,8658},{36079,14,8660},{36084,6,8664},
+{36087,6,8666},{36090,5,6770},{36092,14,8668},{36097,0,19834},
+{36099,0,19835},{36100,5,6772},{36103,18,8672},{36109,14,8677},
+{36114,10,8681},{36118,6,8684},{36123,6,8686},{36196,14,8688},
+{36201,0,15159},{36203,14,8692},{36208,6,8696},{36211,6,8698},
+{36214,6,8700},{36223,0,22595},{36225,6,8702},{36228,6,8704},
+{36232,0,22597},{36234,0,1277},{36237,0,15162},{36240,6,8706},
+{36245,0,15163},{36249,0,6789},{36254,10,8708},{36259,0,2333},
+{36262,0,15164},{36264,0,2620},{36267,6,8711},{36271,0,17134},
+{36274,6,8713},{36277,0,22602},{36279,0,22603},{36281,14,8715},
+{36286,0,6791},{36288,0,22606},{36290,0,6790},{36293,14,8719},
+{36298,10,8723},{36302,6,8726},{36305,0,17135},{36308,14,8728},
+{36313,10,8732},{36317,0,1681},{36319,0,6801},{36321,0,2683},
+{36323,10,8735},{36327,6,8738},{36330,5,6799},{36332,0,15168},
+{36335,6,8740},{36337,5,19845},{36339,10,8742},{36348,6,8745},
+{36351,0,6806},{36353,0,19848},{36356,5,22614},{36358,0,18726},
+{36360,5,6804},{36362,10,8747},{36367,10,8750},{36372,0,18728},
+{36374,0,18729},{36381,5,6807},{36383,6,8753},{36385,5,18730},
+{36387,0,17137},{36390,6,8755},{36394,0,6824},{36400,6,8757},
+{36403,14,8759},{36407,5,22618},{36409,0,18736},{36413,0,17138},
+{36416,5,19852},{36418,0,6811},{36420,0,3097},{36423,38,8763},
+{36436,6,8773},{36441,0,6821},{36443,6,8775},{36445,5,22622},
+{36447,22,8777},{36457,0,19858},{36460,6,8783},{36463,14,8785},
+{36468,14,8789},{36473,14,8793},{36481,0,6830},{36482,5,22625},
+{36484,6,8797},{36487,0,6831},{36489,10,8799},{36493,0,3842},
+{36496,22,8802},{36504,14,8808},{36509,6,8812},{36513,6,8814},
+{36519,0,19866},{36521,34,8816},{36531,0,15176},{36533,6,8825},
+{36538,6,8827},{36542,0,6846},{36544,6,8829},{36547,5,22632},
+{36549,14,8831},{36554,14,8835},{36559,0,8631},{36561,6,8839},
+{36564,0,15178},{36571,6,8841},{36575,0,3272},{36578,6,8843},
+{36584,0,19869},{36587,0,6854},{36589,6,8845},{36592,6,8847},
+{36599,30,8849},{36608,0,18748},{36610,6,8857},{36613,0,6857},
+{36615,14,8859},{36620,0,6865},{36623,5,22641},{36626,30,8863},
+{36635,18,8871},{36640,5,22644},{36643,0,22646},{36645,42,8876},
+{36659,34,8887},{36670,38,8896},{36681,6,8906},{36684,14,8908},
+{36689,0,19880},{36690,5,22653},{36692,6,8912},{36695,6,8914},
+{36700,0,6878},{36701,5,22655},{36703,0,2046},{36705,0,1787},
+{36706,9,6879},{36709,0,22657},{36763,18,8916},{36768,9,19882},
+{36771,22,8921},{36781,22,8927},{36788,0,18756},{36789,5,15183},
+{36791,6,8933},{36794,10,8935},{36798,18,8938},{36804,10,8943},
+{36808,0,14233},{36810,6,8946},{36813,6,8948},{36816,22,8950},
+{36826,0,6888},{36832,0,15186},{36834,18,8956},{36840,14,8961},
+{36845,18,8965},{36852,18,8970},{36857,5,6896},{36859,0,18767},
+{36861,6,8975},{36864,26,8977},{36872,0,17149},{36875,26,8984},
+{36883,34,8991},{36893,26,9000},{36903,0,6905},{36904,9,22668},
+{36908,14,9007},{36913,6,9011},{36915,5,22671},{36917,18,9013},
+{36924,0,3489},{36926,6,9018},{36929,18,9020},{36935,0,1776},
+{36937,22,9025},{36943,13,6910},{36947,14,9031},{36952,6,9035},
+{36955,14,9037},{36960,14,9041},{36965,18,9045},{36972,18,9050},
+{36978,0,6924},{36980,26,9055},{36988,6,9062},{36991,26,9064},
+{36999,22,9071},{37006,14,9077},{37013,0,15193},{37015,10,9081},
+{37019,0,15195},{37024,14,9084},{37029,6,9088},{37032,0,6932},
+{37034,0,2309},{37039,30,9090},{37048,0,3099},{37053,6,9098},
+{37057,0,1198},{37059,0,18782},{37060,5,17154},{37063,14,9100},
+{37068,0,22679},{37070,0,4064},{37074,0,22684},{37077,0,22680},
+{37079,0,15198},{37080,5,22681},{37083,18,9104},{37089,6,9109},
+{37092,6,9111},{37096,0,3558},{37099,0,18791},{37101,0,1458},
+{37103,6,9113},{37106,0,18789},{37108,14,9115},{37117,0,3150},
+{37118,5,18792},{37120,0,18790},{37122,0,6940},{37124,10,9119},
+{37128,0,22685},{37133,0,22686},{37136,0,22687},{37138,0,6941},
+{37140,26,9122},{37148,0,15202},{37150,0,18797},{37152,0,22689},
+{37154,5,17160},{37157,0,19902},{37159,0,8638},{37161,0,22690},
+{37165,22,9129},{37172,0,17163},{37174,6,9135},{37177,6,9137},
+{37180,6,9139},{37187,0,22694},{37190,5,18800},{37192,30,9141},
+{37202,10,9149},{37206,22,9152},{37217,18,9158},{37223,0,19904},
+{37225,6,9163},{37228,6,9165},{37234,14,9167},{37239,18,9171},
+{37249,10,9176},{37253,10,9179},{37257,10,9182},{37261,6,9185},
+{37264,10,9187},{37267,5,22701},{37269,0,19908},{37271,6,9190},
+{37276,0,2371},{37278,0,15211},{37281,6,9192},{37284,0,2503},
+{37286,0,22705},{37288,0,15212},{37290,10,9194},{37293,5,15213},
+{37295,30,9197},{37304,0,2530},{37306,14,9205},{37311,0,22706},
+{37312,5,6963},{37314,0,19912},{37315,5,18809},{37317,18,9209},
+{37323,26,9214},{37331,5,22707},{37334,38,9221},{37345,0,6970},
+{37347,0,3068},{37348,5,8644},{37350,6,9231},{37353,5,22710},
+{37356,0,18813},{37357,5,8642},{37359,10,9233},{37365,5,6973},
+{37367,0,15218},{37369,0,22713},{37371,10,9236},{37375,10,9239},
+{37380,5,22715},{37382,6,9242},{37385,6,9244},{37388,10,9246},
+{37392,6,9249},{37394,5,22718},{37396,6,9251},{37398,5,18815},
+{37400,0,22720},{37404,5,22721},{37406,0,6975},{37411,0,19916},
+{37412,9,22723},{37416,6,9253},{37420,0,6978},{37422,9,22726},
+{37427,6,9255},{37429,5,22729},{37431,14,9257},{37436,0,8651},
+{37438,10,9261},{37442,38,9264},{37453,18,9274},{37462,22,9279},
+{37468,5,22735},{37470,0,6981},{37472,10,9285},{37476,22,9288},
+{37486,9,22738},{37489,0,2029},{37493,6,9294},{37495,5,8658},
+{37497,0,22742},{37499,0,22743},{37500,5,18825},{37502,10,9296},
+{37507,0,2384},{37509,0,3220},{37512,10,9299},{37517,6,9302},
+{37521,10,9304},{37525,30,9307},{37535,6,9315},{37540,5,22747},
+{37543,6,9317},{37547,0,18833},{37549,0,2734},{37551,0,19919},
+{37554,6,9319},{37558,18,9321},{37563,5,19920},{37565,0,22753},
+{37567,5,18837},{37569,10,9326},{37573,14,9329},{37579,5,15229},
+{37581,14,9333},{37586,6,9337},{37589,0,8665},{37591,10,9339},
+{37596,5,22757},{37599,10,9342},{37603,10,9345},{37607,14,9348},
+{37612,10,9352},{37616,0,22764},{37618,6,9355},{37623,22,9357},
+{37631,6,9363},{37634,0,8675},{37636,0,13402},{37638,0,2170},
+{37640,0,22766},{37645,0,15232},{37647,10,9365},{37652,6,9368},
+{37656,10,9370},{37660,66,9373},{37678,6,9390},{37682,22,9392},
+{37690,6,9398},{37700,0,7002},{37703,18,9400},{37709,0,3151},
+{37712,10,9405},{37716,18,9408},{37722,10,9413},{37726,0,22774},
+{37728,0,7012},{37732,5,17167},{37735,0,22775},{37737,34,9416},
+{37747,14,9425},{37754,0,22780},{37756,14,9429},{37760,5,22782},
+{37762,0,19931},{37768,0,18857},{37770,14,9433},{37775,0,18859},
+{37778,0,22785},{37780,18,9437},{37786,6,9442},{37790,0,18860},
+{37793,0,18854},{37795,6,9444},{37798,14,9446},{37803,0,22791},
+{37804,5,7017},{37806,0,3039},{37808,0,7016},{37812,9,22792},
+{37817,10,9450},{37825,0,15244},{37827,0,7026},{37828,5,22795},
+{37830,30,9453},{37840,6,9461},{37843,0,22800},{37846,5,7021},
+{37848,6,9463},{37852,14,9465},{37857,6,9469},{37860,18,9471},
+{37873,0,18864},{37877,0,18861},{37879,18,9476},{37885,0,15248},
+{37889,14,9481},{37895,10,9485},{37901,5,19938},{37903,6,9488},
+{37907,10,9490},{37910,5,18869},{37912,10,9493},{37919,0,22806},
+{37921,0,7040},{37931,0,7038},{37934,6,9496},{37937,22,9498},
+{37944,0,2904},{37946,6,9504},{37949,0,22808},{37951,0,15251},
+{37953,0,7042},{37955,10,9506},{37960,0,8684},{37962,0,17173},
+{37964,0,19941},{37969,10,9509},{37973,0,15252},{37977,14,9512},
+{37982,22,9516},{37992,0,22814},{37994,6,9522},{37997,22,9524},
+{38005,0,7052},{38007,0,7053},{38012,14,9530},{38017,0,7058},
+{38019,6,9534},{38263,10,9536},{38270,0,22818},{38272,0,3827},
+{38274,10,9539},{38278,22,9542},{38284,5,18880},{38286,6,9548},
+{38289,14,9550},{38294,0,7064},{38296,5,7065},{38301,5,22820},
+{38303,42,9554},{38315,10,9565},{38321,6,9568},{38324,0,15259},
+{38326,0,17179},{38329,26,9570},{38339,0,7077},{38342,30,9577},
+{38352,0,17181},{38353,5,19947},{38355,14,9585},{38360,10,9589},
+{38364,26,9592},{38372,10,9599},{38376,0,14061},{38428,10,9602},
+{38433,6,9605},{38436,0,19952},{38437,5,22828},{38440,0,7088},
+{38442,0,2133},{38444,0,18887},{38446,5,7089},{38449,6,9607},
+{38451,5,18888},{38455,6,9609},{38457,5,22831},{38459,10,9611},
+{38463,14,9614},{38468,0,3551},{38475,10,9618},{38479,6,9621},
+{38482,0,22833},{38484,0,19956},{38486,5,22834},{38488,0,15264},
+{38491,18,9623},{38497,22,9628},{38506,0,3356},{38508,0,7102},
+{38510,0,22836},{38512,0,1220},{38514,26,9634},{38522,22,9641},
+{38529,22,9647},{38536,14,9653},{38541,10,9657},{38545,0,22839},
+{38548,38,9660},{38559,6,9670},{38563,30,9672},{38574,10,9680},
+{38577,5,7109},{38579,6,9683},{38582,6,9685},{38584,5,7114},
+{38586,14,9687},{38592,6,9691},{38596,14,9693},{38601,22,9697},
+{38609,6,9703},{38613,6,9705},{38616,30,9707},{38626,6,9715},
+{38632,14,9717},{38639,14,9721},{38646,6,9725},{38649,10,9727},
+{38656,0,2343},{38658,34,9730},{38669,10,9739},{38673,0,7130},
+{38675,6,9742},{38678,0,7132},{38681,22,9744},{38689,5,19967},
+{38691,6,9750},{38695,6,9752},{38698,0,7135},{38704,14,9754},
+{38710,0,18911},{38712,6,9758},{38715,0,8691},{38717,5,7138},
+{38721,14,9760},{38726,18,9764},{38733,10,9769},{38737,6,9772},
+{38741,30,9774},{38750,0,3463},{38752,18,9782},{38758,22,9787},
+{38765,6,9793},{38769,0,7152},{38771,6,9795},{38774,0,19972},
+{38775,5,22852},{38777,18,9797},{38783,10,9802},{38788,10,9805},
+{38793,0,22856},{38795,0,7159},{38797,0,1164},{38799,5,7160},
+{38805,22,9808},{38812,0,7162},{38814,10,9814},{38818,6,9817},
+{38822,0,7164},{38824,0,7163},{38827,14,9819},{38833,5,18921},
+{38835,5,7166},{38837,5,15281},{38840,10,9823},{38844,0,22859},
+{38846,6,9826},{38849,0,17191},{38851,0,7168},{38852,5,22861},
+{38854,34,9828},{38864,6,9837},{38867,6,9839},{38871,10,9841},
+{38875,14,9844},{38880,6,9848},{38884,0,22869},{38893,10,9850},
+{38897,22,9853},{38903,5,22870},{38906,6,9859},{38911,0,1721},
+{38913,30,9861},{38922,0,15286},{38924,34,9869},{38934,18,9878},
+{38940,0,22874},{38942,0,15288},{38944,6,9883},{38947,14,9885},
+{38955,22,9889},{38962,5,18936},{38964,6,9895},{38967,10,9897},
+{38971,14,9900},{38980,0,22878},{38982,6,9904},{38986,10,9906},
+{38989,5,1465},{38991,0,7187},{38993,0,22880},{38994,5,15292},
+{38996,30,9909},{39006,0,4008},{39010,5,19985},{39013,10,9917},
+{39018,10,9920},{39023,9,7190},{39027,6,9923},{39080,0,3561},
+{39082,6,9925},{39085,18,9927},{39092,0,19987},{39094,10,9932},
+{39098,0,15297},{39099,5,18946},{39103,0,15298},{39106,26,9935},
+{39115,6,9942},{39131,6,9944},{39135,18,9946},{39141,10,9951},
+{39145,10,9954},{39149,10,9957},{39152,5,18954},{39154,10,9960},
+{39158,0,22885},{39164,10,9963},{39170,6,9966},{39173,0,3819},
+{39175,14,9968},{39180,0,1252},{39184,22,9972},{39190,5,18960},
+{39192,0,7208},{39194,9,18963},{39197,5,7210},{39199,14,9978},
+{39204,0,7212},{39206,10,9982},{39211,6,9985},{39214,0,7215},
+{39217,0,18967},{39218,5,15301},{39220,6,9987},{39225,0,22892},
+{39226,9,18968},{39229,5,7216},{39232,10,9989},{39237,18,9992},
+{39243,14,9997},{39248,0,7221},{39249,5,7223},{39252,6,10001},
+{39255,10,10003},{39259,6,10006},{39262,10,10008},{39318,0,2335},
+{39319,5,7227},{39321,0,2035},{39323,0,22896},{39325,10,10011},
+{39331,0,18975},{39333,6,10014},{39336,0,1436},{39340,0,3333},
+{39341,5,7230},{39344,22,10016},{39353,5,15308},{39356,6,10022},
+{39359,0,18978},{39361,0,3379},{39363,14,10024},{39368,6,10028},
+{39376,22,10030},{39384,30,10036},{39393,6,10044},{39399,0,22905},
+{39402,9,22906},{39405,5,7238},{39408,0,18984},{39409,5,7240},
+{39412,5,22909},{39416,6,10046},{39419,6,10048},{39421,5,22911},
+{39423,0,2403},{39425,18,10050},{39432,0,14266},{39434,10,10055},
+{39438,22,10058},{39446,0,15312},{39449,6,10064},{39454,0,22915},
+{39456,0,18990},{39458,10,10066},{39463,6,10069},{39467,0,7249},
+{39469,5,15315},{39472,6,10071},{39475,0,22917},{39477,14,10073},
+{39486,0,7255},{39488,22,10077},{39495,0,22919},{39498,18,10083},
+{39505,6,10088},{39508,18,10090},{39514,6,10095},{39517,0,22923},
+{39519,0,7260},{39522,0,7261},{39524,6,10097},{39529,10,10099},
+{39592,0,2062},{39594,0,22924},{39596,18,10102},{39602,0,22927},
+{39604,0,22928},{39605,5,15321},{39607,10,10107},{39611,6,10110},
+{39613,5,20002},{39615,10,10112},{39619,6,10115},{39622,0,19002},
+{39624,0,22931},{39630,18,10117},{39635,5,7273},{39637,18,10122},
+{39643,6,10127},{39646,5,7275},{39648,0,19006},{39650,5,7277},
+{39652,14,10129},{39657,26,10133},{39665,0,7284},{39666,5,22937},
+{39668,6,10140},{39671,0,7285},{39673,10,10142},{39677,0,22941},
+{39679,5,22942},{39681,10,10145},{39684,5,22944},{39686,0,7287},
+{39688,6,10148},{39691,6,10150},{39693,5,20007},{39696,0,19010},
+{39698,0,19011},{39702,0,19012},{39704,22,10152},{39711,6,10158},
+{39714,5,7291},{39717,6,10160},{39719,13,7294},{39723,10,10162},
+{39726,5,7298},{39729,6,10165},{39731,5,15326},{39733,0,20010},
+{39735,0,22949},{39737,5,22950},{39739,10,10167},{39745,18,10170},
+{39752,0,20011},{39755,6,10175},{39757,5,7304},{39759,0,7303},
+{39761,0,7306},{39764,6,10177},{39766,5,22953},{39768,0,7307},
+{39770,6,10179},{39774,0,17206},{39777,0,22956},{39779,0,19018},
+{39781,6,10181},{39784,0,20013},{39786,0,22957},{39787,5,19020},
+{39789,5,22958},{39791,0,4043},{39794,14,10183},{39798,5,19022},
+{39800,6,10187},{39807,6,10189},{39811,18,10191},{39817,10,10196},
+{39821,30,10199},{39830,5,7312},{39834,0,22968},{39837,6,10207},
+{39839,5,7314},{39846,34,10209},{39856,10,10218},{39860,0,7317},
+{39863,10,10221},{39867,6,10224},{39870,14,10226},{39878,18,10230},
+{39886,10,10235},{39889,5,7323},{39892,0,7328},{39894,10,10238},
+{39899,0,2884},{39901,0,19032},{39903,0,14271},{39905,18,10241},
+{39911,6,10246},{39914,6,10248},{39918,22,10250},{39925,0,1143},
+{39927,14,10256},{39933,0,15338},{39935,6,10260},{39938,0,20022},
+{39940,0,7343},{39942,0,7339},{39944,22,10262},{39951,30,10268},
+{39960,9,19040},{39963,14,10276},{39969,38,10280},{39981,22,10290},
+{39989,10,10296},{39993,10,10299},{39997,6,10302},{40001,0,15343},
+{40003,22,10304},{40009,5,19052},{40014,0,22981},{40015,5,17215},
+{40018,10,10310},{40022,10,10313},{40026,30,10316},{40035,0,15345},
+{40037,0,17217},{40039,6,10324},{40041,9,19060},{40045,5,19063},
+{40048,0,15346},{40050,0,19065},{40053,14,10326},{40058,6,10330},
+{40165,10,10332},{40169,0,3403},{40171,6,10335},{40176,0,7361},
+{40178,10,10337},{40182,6,10340},{40185,0,22985},{40194,6,10342},
+{40198,14,10344},{40203,0,19070},{40206,0,1322},{40209,6,10348},
+{40213,0,7373},{40215,5,19073},{40219,6,10350},{40221,5,17218},
+{40223,0,7371},{40227,0,7370},{40230,0,7368},{40232,0,1497},
+{40234,10,10352},{40239,6,10355},{40242,0,19078},{40243,5,22988},
+{40250,22,10357},{40257,30,10363},{40266,0,19080},{40272,10,10371},
+{40275,5,22993},{40281,0,7385},{40284,0,1231},{40285,5,7380},
+{40287,26,10374},{40297,14,10381},{40303,6,10385},{40306,6,10387},
+{40310,5,19086},{40314,10,10389},{40318,0,15354},{40323,6,10392},
+{40326,6,10394},{40329,6,10396},{40333,10,10398},{40338,5,22999},
+{40341,6,10401},{40343,5,23002},{40345,6,10403},{40353,0,19090},
+{40356,0,7393},{40361,14,10405},{40366,6,10409},{40369,6,10411},
+{40372,6,10413},{40376,22,10415},{40383,22,10421},{40390,6,10427},
+{40393,6,10429},{40399,0,7402},{40403,0,7405},{40404,5,23008},
+{40406,6,10431},{40409,6,10433},{40414,10,10435},{40419,0,19098},
+{40421,10,10438},{40425,0,20034},{40427,0,15361},{40429,14,10441},
+{40434,10,10445},{40440,10,10448},{40445,6,10451},{40450,0,19101},
+{40455,0,17229},{40458,0,19100},{40461,6,10453},{40464,9,23015},
+{40469,6,10455},{40473,0,8716},{40474,5,7411},{40476,10,10457},
+{40565,0,7414},{40568,22,10460},{40575,10,10466},{40578,9,20037},
+{40581,0,19107},{40583,6,10469},{40587,5,7419},{40590,5,23020},
+{40593,10,10471},{40597,14,10474},{40603,0,19108},{40605,10,10478},
+{40612,10,10481},{40616,10,10484},{40620,18,10487},{40627,10,10492},
+{40632,30,10495},{40643,6,10503},{40646,0,23026},{40648,0,23027},
+{40651,10,10505},{40654,9,7432},{40657,6,10508},{40660,6,10510},
+{40664,6,10512},{40667,22,10514},{40676,6,10520},{40679,6,10522},
+{40684,5,23030},{40686,18,10524},{40692,6,10529},{40694,5,7444},
+{40696,6,10531},{40699,9,7447},{40703,0,19113},{40706,6,10533},
+{40711,5,7450},{40713,0,20044},{40718,38,10535},{40729,10,10545},
+{40735,14,10548},{40742,0,20049},{40746,5,20050},{40748,0,7455},
+{40751,0,15374},{40753,5,23039},{40756,0,20052},{40759,0,15375},
+{40761,26,10552},{40769,0,15377},{40771,5,23043},{40773,10,10559},
+{40778,6,10562},{40782,6,10564},{40786,26,10566},{40794,0,20053},
+{40797,6,10573},{40799,9,7461},{40802,6,10575},{40806,5,7464},
+{40808,10,10577},{40812,30,10580},{40821,10,10588},{40826,0,23050},
+{40829,0,23051},{40845,0,3966},{40847,6,10591},{40849,5,23053},
+{40852,14,10593},{40860,10,10597},{40864,14,10600},{40869,0,20056},
+{40884,0,14048},{40892,10,10604},{40895,13,20068},{56322,0,18398},
+{56324,0,15388},{56327,0,17319},{56331,6,10607},{56332,0,18754},
+{56335,6,10609},{56341,14,10611},{56346,0,19077},{56346,0,13954},
+{56349,0,17682},{56354,0,13684},{56356,0,17686},{56356,0,17880},
+{56360,6,10615},{56364,0,14109},{56366,6,10617},{56371,0,13719},
+{56375,0,19111},{56378,0,17321},{56380,6,10619},{56383,0,13815},
+{56390,0,20062},{56393,6,10621},{56394,0,17782},{56394,6,10623},
+{56395,0,20168},{56395,0,18302},{56401,6,10625},{56405,0,18183},
+{56405,6,10627},{56411,0,17647},{56416,0,18355},{56418,0,13998},
+{56420,6,10629},{56429,0,17462},{56429,6,10631},{56435,0,18506},
+{56435,6,10633},{56439,0,7754},{56447,0,17910},{56450,0,19084},
+{56452,0,7734},{56457,6,10635},{56458,0,18727},{56462,0,17005},
+{56464,0,18935},{56470,0,17998},{56470,0,18077},{56473,6,10637},
+{56478,0,20206},{56482,0,17240},{56484,0,17243},{56486,0,20064},
+{56491,6,10639},{56496,0,14209},{56498,0,13867},{56502,0,14129},
+{56504,6,10641},{56507,0,18733},{56509,6,10643},{56518,0,18983},
+{56531,0,7816},{56537,0,18217},{56539,10,10645},{56541,0,18515},
+{56541,0,7641},{56545,0,14291},{56548,6,10648},{56554,0,18446},
+{56554,0,13679},{56557,0,18365},{56557,0,7665},{56564,6,10650},
+{56569,0,19083},{56572,0,13656},{56574,0,13904},{56576,0,17925},
+{56579,0,18003},{56579,0,13768},{56585,0,17299},{56587,0,13801},
+{56589,6,10652},{56590,0,18394},{56590,10,10654},{56596,0,13995},
+{56602,0,13916},{56608,10,10657},{56621,0,17544},{56633,0,18574},
+{56639,6,10660},{56645,0,17359},{56645,0,17545},{56645,10,10662},
+{56649,0,18811},{56651,0,13717},{56657,0,13646},{56664,0,20075},
+{56664,0,20090},{56666,0,17815},{56674,0,17547},{56683,0,18770},
+{56683,6,10665},{56687,0,18450},{56689,0,18883},{56691,0,20060},
+{56696,0,17546},{56699,6,10667},{56708,6,10669},{56711,6,10671},
+{56719,6,10673},{56722,0,17556},{56724,6,10675},{56729,0,14134},
+{56732,6,10677},{56736,6,10679},{56737,6,10681},{56743,0,18229},
+{56745,0,18190},{56753,0,20080},{56756,0,20133},{56758,6,10683},
+{56762,5,18834},{56771,0,17525},{56771,6,10685},{56772,0,16905},
+{56772,0,17024},{56774,0,18015},{56776,5,18773},{56780,6,10687},
+{56783,6,10689},{56787,6,10691},{56790,6,10693},{56795,0,19026},
+{56797,18,10695},{56801,0,17710},{56805,0,18192},{56817,0,19123},
+{56820,6,10700},{56825,10,10702},{56830,0,18018},{56833,6,10705},
+{56836,0,20058},{56841,0,15443},{56846,0,18158},{56848,6,10707},
+{56851,10,10709},{56853,0,19036},{56855,6,10712},{56858,0,7825},
+{56858,0,20316},{56862,0,18195},{56862,0,18455},{56862,6,10714},
+{56866,0,13691},{56872,6,10716},{56873,0,18844},{56878,0,18318},
+{56881,0,18640},{56883,6,10718},{56886,18,10720},{56893,0,13953},
+{56893,0,20315},{56896,0,17089},{56898,6,10725},{56903,0,17480},
+{56903,0,17842},{56905,0,19038},{56908,6,10727},{56917,6,10729},
+{56920,0,18459},{56930,0,18322},{56932,0,13755},{56932,6,10731},
+{56933,0,18528},{56938,0,18167},{56938,0,14189},{56941,0,17380},
+{56944,10,10733},{56948,0,17421},{56951,0,17140},{56955,0,17417},
+{56958,6,10736},{56959,0,13849},{56962,0,18745},{56964,0,17117},
+{56964,0,18684},{56966,0,18386},{56969,14,10738},{56979,0,18645},
+{56981,0,17379},{56984,6,10742},{56992,0,18917},{56997,0,18055},
+{57008,10,10744},{57010,0,19129},{57012,0,16838},{57015,6,10747},
+{57026,0,18327},{57028,0,19046},{57037,0,18856},{57043,0,17337},
+{57047,0,17429},{57047,0,13922},{57047,6,10749},{57051,0,19054},
+{57053,0,18863},{57059,6,10751},{57060,0,18276},{57060,0,18862},
+{57064,6,10753},{57067,6,10755},{57070,0,14282},{57072,6,10757},
+{57075,0,17632},{57075,0,18747},{57078,0,7673},{57082,0,18787},
+{57085,0,17435},{57087,0,17063},{57094,0,17492},{57100,0,17863},
+{57102,0,18650},{57113,0,18962},{57115,10,10759},{57117,6,10762},
+{57118,0,17605},{57123,0,18330},{57123,0,18652},{57131,0,17282},
+{57138,0,18897},{57142,0,17437},{57151,0,16914},{57154,0,17493},
+{57156,0,17438},{57158,0,17680},{57164,0,20311},{57167,0,17312},
+{57167,5,17671},{57168,0,18966},{57170,0,18656},{57174,0,18117},
+{57180,0,18332},{57183,0,17391},{57187,6,10764},{57199,0,18119},
+{57201,0,17291},{57201,6,10766},{57206,0,17582},{57214,0,17983},
+{57217,0,17289},{57228,0,19109},{57236,0,18544},{57247,0,13803},
+{57254,0,17683},{57257,0,18248},{57261,0,17608},{57266,10,10768},
+{57271,0,13706},{57271,0,13898},{57276,0,18039},{57278,0,18701},
+{57281,0,18874},{57284,0,17449},{57287,6,10771},{57293,6,10773},
+{57296,0,17768},{57296,0,7838},{57298,14,10775},{57303,0,19071},
+{57306,0,17772},{57306,6,10779},{57311,6,10781},{57316,0,17769},
+{57319,0,17875},{57323,0,20130},{57327,0,18875},{57329,6,10783},
+{57334,5,18554},{57336,0,18553},{57336,14,10785},{57342,0,15422},
+{57342,6,10789},{63584,9,15444},{63610,0,15447},{63615,0,15448},
+{63753,0,13739},{63773,0,13392},{63775,0,14084},{63784,6,10791},
+{63798,0,13394},{63839,0,13971},{63856,0,13344},{63875,0,14088},
+{63890,5,7809},{63897,6,10793},{63906,0,14095},{63939,0,7808},
+{63952,0,13396},{63964,0,13393},{63980,0,7750},{64003,0,13956},
+{64014,38,10795},{64024,9,8579},{64027,18,10805},{64032,5,8612},
+{64034,30,10810},{64042,5,8699},{64044,6,10818},{64048,170,10820},
+{64091,5,13349},{64093,54,10863},{64256,0,9358},{64257,5,112},
+{64259,5,9359},{65040,0,8268},{65041,5,7887},{65049,0,7897},
+{65072,0,7898},{65073,5,7892},{65075,0,7890},{65077,5,7899},
+{65079,5,7905},{65081,5,7901},{65083,5,7915},{65085,5,7909},
+{65087,5,7907},{65089,13,7911},{65093,5,12639},{65095,5,7903},
+{65281,26,10877},{65288,5,674},{65290,22,10884},{65296,37,780},
+{65306,5,639},{65308,18,10890},{65313,101,790},{65339,22,10895},
+{65345,101,816},{65371,14,10901},{65375,5,12131},{65377,249,327},
+{65504,5,713},{65506,14,10905},{65512,0,323},
+};
+
+static const unsigned short cmap_UniJIS_UTF16_H_table[10909] = {
+99,94,100,107,61,93,720,647,152,140,109,153,
+151,154,129,707,694,645,159,778,117,134,160,144,
+123,695,142,696,148,9366,9361,15756,15769,15737,15745,15758,
+15771,15783,15789,20333,20352,15759,15772,15761,15774,20322,15775,9369,
+9364,20334,20353,15760,15773,9395,9407,15784,15790,20335,20355,20337,
+20356,20336,15785,15791,20323,15816,9400,9412,9367,9362,20339,20357,
+20338,146,20324,20328,15786,15792,20340,20358,20329,15757,15770,20342,
+20360,15739,15747,20325,20330,141,147,15762,15776,20343,20361,15763,
+15777,20331,20326,9436,9370,9365,15764,15778,143,149,15755,15768,
+20344,20362,15765,15779,15740,15748,15787,15793,15741,15750,223,227,
+15767,15781,15742,15751,20327,20332,9405,9417,9368,9363,15788,15794,
+9404,9416,15766,15780,20345,20363,20350,20364,20351,20365,224,15743,
+15752,15744,15754,225,229,105,15826,9394,9406,9398,9410,9401,
+9413,9403,9415,20349,15733,20346,15734,20348,15735,20347,15736,15832,
+9418,15836,15822,9423,15841,15802,15823,15829,9426,9429,9432,15830,
+15831,15809,15825,15813,15835,15838,15819,15844,15827,15798,15808,15799,
+15833,15814,15795,15810,15803,15886,9437,15887,15888,15800,15843,15807,
+15804,15797,15889,15815,15805,9442,15824,15801,15828,15834,15796,9438,
+15837,15812,15890,15806,15842,9441,15818,15817,15820,15891,15892,15811,
+15840,15839,98,96,128,15749,15846,9443,15848,15738,15782,133,
+15746,95,15753,15867,95,129,226,133,135,137,15868,15858,
+134,136,15865,15876,15866,15869,15870,15864,20433,20435,20441,20431,
+20434,20440,20444,12090,12096,9397,9409,9420,9419,9434,9433,231,
+633,662,14,114,114,138,661,666,98,96,120,108,
+122,121,669,668,734,12111,226,15849,16328,11035,8305,8304,
+8055,228,9355,15515,736,739,12201,12207,12206,8013,8012,8014,
+8011,759,755,12184,20367,760,741,15476,12091,742,7625,693,
+12118,117,765,767,703,7629,756,748,747,8195,7624,704,
+768,100,766,698,761,15505,12188,12186,12189,12187,12143,12167,
+12167,12146,12151,12167,12167,12154,8250,8249,8244,8243,8242,8241,
+8240,8239,8238,729,728,8015,12239,12237,16235,731,730,12195,
+8010,733,732,12194,8009,727,726,8210,20371,723,10502,725,
+724,8258,8257,12254,722,721,8219,8222,8211,8017,8019,8213,
+8018,8212,8214,8016,775,16200,12100,774,16199,773,12229,12228,
+4209,14476,4646,3762,4739,4779,15391,14530,13852,14561,5059,17893,
+3644,3773,14749,15398,14780,13729,13995,14999,19130,14905,13922,15000,
+14999,14189,13747,13646,1931,15114,13870,2658,15403,15184,3029,15255,
+15262,13645,2664,13847,13849,13848,3380,1323,1200,8371,4095,4097,
+1333,4102,3275,4110,2579,4208,3286,3392,4219,4227,4233,4243,
+4248,3163,3991,4294,4307,2375,3708,4316,4321,4328,3746,1969,
+4459,3156,2204,3878,2887,2433,2208,4622,2631,2454,4646,4648,
+4658,2177,4716,1979,1918,1738,1519,4739,4741,4761,4763,4768,
+1655,14521,4783,4785,2554,4930,1921,2326,2215,5058,3592,3143,
+1740,3661,5088,3284,5132,1860,3814,1853,2221,5349,5364,5368,
+3450,3807,2223,5378,2603,1360,3066,3541,5604,5606,3618,1383,
+1671,1880,1904,1732,1245,1504,1537,2652,3899,3134,3479,14848,
+5783,3368,3453,2172,3816,3779,3836,2676,2260,14913,1363,1856,
+3953,2971,3606,2227,1544,6163,3901,1227,4061,2261,6205,2262,
+6227,3281,2569,2263,2232,1235,2697,2726,2360,2081,2541,6322,
+6479,2988,1858,2022,1189,6635,1887,1455,1908,2921,3198,6742,
+6745,1419,2682,2808,2829,2574,2306,2575,2914,15183,3874,3243,
+3428,3948,1754,3029,3827,3550,7113,7115,1229,8695,3463,3800,
+1461,7171,7173,1339,3607,3561,3464,2543,2335,2035,3333,2062,
+2036,7276,7293,1614,1685,3031,7414,2267,7425,3729,13323,1642,
+2055,7446,7449,3102,1937,2767,3475,655,8308,735,740,665,
+7608,7609,8058,12106,16194,12179,12181,16205,638,660,8143,8141,
+8148,8147,8204,8142,7620,8151,8149,8144,8139,8146,8140,8150,
+8205,8145,8138,10471,8161,8160,8162,8156,10495,8165,10492,8158,
+8223,10489,10488,10494,8319,8191,10479,10491,10490,8154,8157,8159,
+8163,8153,8164,8155,8152,8042,11876,8183,11877,11881,11879,11884,
+11882,11886,11888,7595,7586,8041,8039,11896,8040,11898,8038,8043,
+11907,11909,7596,7590,8052,7598,8049,11921,8327,7592,11930,11932,
+8046,11933,8047,11926,11934,11935,8045,8050,11943,7585,7599,7588,
+8328,7593,11950,11954,11951,8323,7623,7622,7621,8054,8037,8024,
+8026,8186,8020,7607,8021,8187,8030,8029,8028,8027,8034,8182,
+7611,15387,17242,17533,17532,17731,17758,17826,13965,16968,20170,18634,
+19136,15441,18669,1200,3000,17234,2275,3754,2510,2174,2509,1340,
+19140,3526,3881,17235,4091,1233,17236,1484,4092,2632,4311,1648,
+3594,2511,14298,8371,17237,4093,14299,14157,2980,17238,4094,1778,
+21075,4095,13981,1561,2926,2323,4096,4098,3307,14304,1649,17239,
+14126,3259,1911,3681,6480,4099,2512,4100,1333,14305,21076,1757,
+1956,3829,4659,21077,21078,17244,1505,14306,1615,4102,3971,3879,
+2794,4104,2244,3275,14307,4107,1248,1939,1938,1194,14308,21081,
+4081,4080,2083,1125,17245,3682,4111,1958,1195,3744,3070,3972,
+21082,4112,14309,2579,13856,17247,2372,2580,4119,17248,4117,4118,
+1650,17249,2067,1392,4116,4115,3577,14310,2196,2195,2846,4120,
+3527,2699,17251,21083,656,4121,4123,14311,8372,21084,2885,4009,
+1166,4122,1342,21086,1724,17252,2981,19144,17253,1861,4124,3290,
+8373,14312,21087,14313,8374,1575,21088,8375,21089,4125,1167,14314,
+19145,1940,1576,3564,3398,1651,21090,14315,17254,21091,19146,1393,
+4160,3131,19148,3362,4127,19149,21092,3408,21093,4010,17256,2547,
+8376,2197,14317,2245,1344,17257,21095,3053,2912,4131,16779,14318,
+1168,3071,2373,2084,3854,21098,2862,14319,1343,8377,4130,17258,
+3880,4126,4128,2142,4129,4563,16780,14316,21099,17255,4137,16781,
+21100,4140,4138,21101,3595,4132,21102,14320,4136,1959,21103,17262,
+1506,19150,17263,4141,4133,21104,8379,4011,21105,2246,21106,4134,
+21107,4139,8378,21108,8381,4142,14323,4135,21109,8380,1689,1169,
+19151,21110,1690,1345,3751,3552,1960,2549,3967,19152,14324,3624,
+1806,2821,1380,17266,21117,21118,8364,2397,17267,21119,8382,4146,
+14325,4151,4149,17268,15407,4144,2831,4147,4150,4148,21120,3629,
+4145,7660,2548,21121,3745,2350,4166,21122,13731,17270,3334,3496,
+4161,21123,14326,4165,8385,19153,4159,4168,21124,2772,21125,1912,
+19154,3346,16783,5632,14329,4167,3159,17271,4156,1962,21126,16784,
+1961,4154,14330,17272,21127,8386,2310,4162,8384,3647,2955,4158,
+1863,14331,4155,4163,4157,3993,4164,4071,14332,21131,1758,8383,
+16785,8389,4169,21132,8387,4170,4174,1170,21133,17273,3616,4173,
+4172,4176,14333,21136,4175,19156,21137,19157,17275,1864,14334,21138,
+4177,21139,8388,21140,2289,2822,3073,1774,19158,4178,4179,21141,
+4181,21144,3683,19159,14337,21146,1852,8390,17280,14338,2175,3467,
+4180,21147,14339,19161,17276,2101,3885,17283,4183,4186,4182,2100,
+21154,1807,4187,19162,17286,1735,14340,3207,17290,2814,16787,1691,
+21156,17292,3707,4188,8392,15408,3973,4189,21159,17293,21160,4192,
+21161,4190,14341,2768,19163,14342,4191,4193,14343,15409,19164,16786,
+17288,8391,4195,21162,4194,21163,3608,16789,1327,16788,19166,14344,
+4196,4201,4200,4199,17296,4143,21165,4202,14347,14348,2440,21174,
+3813,19170,21175,16790,4205,19171,21176,4204,4207,4206,1208,21177,
+1897,1809,2374,3001,1692,2700,1963,8393,2048,4211,3796,3136,
+21178,2247,4210,21179,4212,16791,16792,21180,14349,17298,8394,3286,
+21181,13966,2742,3392,1964,4065,4217,17300,19172,3596,2838,1769,
+3119,14201,18393,1865,4219,17301,19173,3258,1281,4222,2157,17302,
+4221,2102,21183,4223,6235,4224,3695,4225,2513,17304,2296,1507,
+14350,4230,17305,4228,3785,4229,3161,17306,4234,2131,4238,3830,
+4012,19174,14351,4239,8396,21184,21185,15410,2636,4240,2404,19176,
+4241,16794,3002,3975,3162,19178,21186,21187,4314,4242,8284,1725,
+20300,19182,4243,3724,16795,21188,2418,2908,4245,3260,8397,4246,
+14353,4247,1420,21189,17309,14354,4248,1695,21190,3236,1308,2394,
+3381,4249,2581,4250,19183,3580,2686,1502,1509,4251,1808,17310,
+14357,4252,8398,17311,4027,21191,3409,3612,19184,4254,19185,3938,
+4255,19186,19189,2637,2158,1866,4258,2199,2049,19190,3074,4260,
+21193,14358,2143,4264,17313,3684,16796,21194,19191,2038,17314,7774,
+4263,21195,19192,14359,1867,2126,3363,14360,4267,4265,19193,3565,
+2514,4274,1474,4268,4266,2769,4269,21196,17318,1442,17317,21197,
+1846,4275,3957,19196,19197,4271,4276,4273,14361,4272,21201,3991,
+8399,1965,1347,4028,17322,21202,8400,21203,2431,3154,2039,8573,
+21204,4013,4049,4282,4281,21208,1421,8401,4283,3716,21209,3032,
+21210,3856,14362,3625,17325,16797,4284,21211,14056,17326,7150,21212,
+3208,16798,4285,1510,3775,8402,21213,2441,4286,3639,4290,19198,
+2638,4287,1736,21214,4288,1511,21215,19199,21216,14363,19200,1796,
+4291,21218,4292,21219,17328,2311,16799,1967,3818,8403,3828,3279,
+19201,3649,4295,20301,4296,21220,4298,4300,4299,19202,4301,1341,
+3706,21222,2156,4302,21223,16800,2779,21224,19203,2442,1697,4303,
+8405,21225,4304,21231,4305,19205,4306,4307,3478,1760,1193,21232,
+19206,14366,3223,4308,2375,17330,2701,4310,4309,2443,1941,4312,
+3410,14368,14367,4313,3440,2836,2894,1696,3270,2927,21233,3364,
+21234,3708,2702,14369,19207,1803,17333,14370,19208,4317,1230,1209,
+1577,8406,2824,1643,3931,4320,1335,19209,17334,4319,13365,19210,
+1698,4321,21236,3837,8407,19211,3994,19212,1968,1898,4323,21240,
+17335,4325,4324,2597,1243,19213,14371,1280,4326,19214,4327,8408,
+1899,17336,21241,4328,17338,21242,19215,1672,17339,19216,2176,4329,
+3746,2085,1652,3857,2770,3411,2345,21244,2385,17343,2324,2337,
+2432,14372,3412,8409,21247,4332,19219,1253,2771,1969,1913,1759,
+14373,21249,4336,2911,2910,1699,2444,4337,4335,1348,2886,2276,
+2201,1224,17345,14374,1486,2040,2200,4339,21250,1635,1444,2041,
+1634,3067,1223,3209,3786,1971,3939,3137,1970,16803,19220,21251,
+1797,4348,13964,1755,3704,21252,3441,14375,17347,4347,19221,1562,
+4345,21253,1653,2599,3581,4344,4340,1943,13775,4341,4042,17349,
+21254,3650,21255,3076,1942,2050,19225,14376,4349,21256,21257,4353,
+14377,21259,2346,21260,2338,14378,17351,4356,4354,3759,14379,4351,
+4360,4355,4358,1914,3787,16804,4359,21263,21264,4361,21265,4363,
+16805,21266,8412,2144,4072,14380,4352,4350,4362,21267,4357,17352,
+14381,21268,17353,14382,4365,4374,4367,17354,19226,4371,8413,19227,
+4372,4368,14383,17355,4401,19228,2137,1423,17356,4366,14384,17357,
+19229,4376,1210,4375,14385,1129,3516,4373,17358,4369,14386,4364,
+4370,2104,21269,14387,19230,21270,1211,4386,2445,3735,19231,17360,
+4384,4383,17361,17362,3113,17363,19232,4382,21272,8414,1238,19233,
+2086,2550,19234,17366,14388,4380,3164,4381,19235,1126,19237,14389,
+4391,3853,2447,21275,4397,14390,19238,4396,4387,21276,17367,21277,
+2851,4388,17368,2895,4393,2446,17370,21278,14391,4390,21279,3824,
+16806,19239,4392,4398,7633,14392,20308,4389,17372,4404,4409,17374,
+4405,21283,4400,16807,17375,4410,2739,8415,4412,14394,1972,4402,
+3003,14395,19241,17376,19242,21284,19243,21285,4406,4399,1513,1578,
+1475,4407,4403,21286,19244,1868,4413,4411,2773,1636,1700,16808,
+4408,19246,4417,4415,19247,4472,21288,17383,17384,17378,19248,4420,
+4414,19249,4418,17385,21291,4416,17387,2202,4419,19253,4422,19254,
+4427,4425,4424,21292,19255,2928,17392,14396,1349,21294,4423,2448,
+1237,21295,17390,1374,4437,17394,2532,4433,21296,4431,19260,4432,
+14399,4434,19261,16810,21297,17396,14400,17397,21298,1247,21301,17398,
+14402,2747,19262,4428,14403,4429,7963,19263,1579,14405,4439,4435,
+4438,17401,3582,21305,15411,21306,19264,4440,1443,17403,4442,21307,
+17404,4444,14409,7654,14410,17405,16811,19265,4443,4446,19266,21308,
+17406,16812,14413,17407,16813,4449,4448,19267,4454,4452,4450,4453,
+4455,14414,7770,21311,19268,17409,4456,19269,21312,4457,4459,4220,
+19270,2344,2203,21313,14415,1395,17410,1212,19271,2946,14416,19273,
+4460,2068,19274,1171,2596,4461,1915,4463,4462,3632,4464,19275,
+4466,4465,14417,4467,19276,4468,21319,1282,4469,14418,4471,4473,
+19279,3156,21320,13952,21321,14419,4474,1145,2127,17416,21324,19280,
+1811,19281,14420,2957,21325,4479,14423,17420,4477,4480,2097,1973,
+21326,4484,21327,2069,8417,2929,21328,17422,4481,3062,19285,19286,
+21329,17423,14424,21330,21331,19287,17427,16815,21332,4485,21333,2600,
+19288,4483,4486,1813,14425,4487,21334,21338,21335,17430,21336,4488,
+21337,1974,1438,4490,21339,17433,21340,4491,4494,8420,8419,3730,
+17436,2515,16817,4495,19291,4499,17434,3310,21342,17439,1196,3528,
+21347,4500,16818,14428,19292,2277,17442,3347,1580,17443,2139,17444,
+21344,14432,3719,3210,21345,17445,1870,2863,21346,14433,4498,4501,
+21348,19293,4503,17446,21350,14434,4505,19294,17447,7474,1283,3651,
+14435,2516,3138,17448,2134,21352,3597,4005,17450,1396,4507,17451,
+19295,19296,21353,2748,4510,3165,21354,3139,3166,3405,3049,2105,
+19297,7751,4506,17452,21355,1304,21356,4512,2392,19299,14437,19300,
+21359,17455,3640,17458,21360,2815,19301,3042,17459,8423,4515,3709,
+14438,17460,4516,17461,8424,3583,4520,4514,4517,4519,19302,3609,
+21366,17463,21365,4522,2947,21367,2517,17464,14439,14440,4524,16822,
+4523,14441,2042,21368,4525,4527,4526,14442,4529,21369,4518,4531,
+16823,21370,17465,4530,4528,2204,2583,2774,4532,2656,1201,3354,
+4534,4533,3617,4539,8425,14444,17470,1350,4540,17471,3878,1422,
+4318,2386,2847,4541,3831,21374,21375,3776,19304,14445,4543,2887,
+21376,3121,2848,3529,1309,14446,21377,2278,4546,21378,1172,4547,
+14117,17474,4548,21381,21382,1284,17476,1581,3256,3652,4552,2775,
+4551,1814,21383,8426,3721,4550,3167,4554,19305,4553,8427,8428,
+21384,17479,4556,14447,4555,8429,4557,2449,4559,2915,21385,4558,
+14448,3587,21386,21387,2433,3157,4560,19306,21388,17483,1975,4561,
+3287,3442,3805,3291,16825,21389,4570,21390,16826,1618,21391,3887,
+19307,4565,8430,2853,21392,3686,3140,21393,17485,19308,21394,4566,
+19309,3731,8431,2106,17486,16827,21397,17487,2206,14449,2205,1149,
+1916,14450,2639,1173,4569,14451,17489,19310,1242,1515,17490,4568,
+3793,3491,13997,17491,21398,19311,21399,1132,21401,19312,2207,21402,
+1174,1127,14454,14455,17495,21403,4575,21404,16828,17496,3784,4578,
+13761,4576,21405,4574,2551,14456,21406,4573,17497,21407,3626,21408,
+1944,21409,4579,4050,3330,14457,21412,4581,4584,14459,17499,3530,
+16829,4580,14460,17500,21416,14461,3783,3348,21418,21420,4586,3492,
+17502,17506,19313,14465,17508,21421,4587,4591,4588,17509,1351,4590,
+21423,2279,4589,1871,21424,4603,4596,4593,14466,2978,17512,4594,
+4595,19315,17515,19316,14467,21426,17516,1582,4600,4599,4601,17517,
+19319,2518,3064,14470,4609,14471,21427,17519,2208,4610,17520,1976,
+4611,8432,2248,2840,2216,1977,21428,3806,1602,1917,4614,1462,
+17521,4615,21429,17522,4616,4656,4618,14120,14472,16834,4622,17523,
+13840,4623,17524,2896,21430,1225,2325,1158,14475,2777,1516,2273,
+21431,1978,16835,21434,3168,17526,2347,1517,2982,3078,1148,1619,
+3653,1644,2703,2280,3858,4624,17527,21437,1654,21438,2107,1424,
+1285,2452,1352,19321,4625,3888,21441,2387,8433,21443,2320,4626,
+1583,3242,3765,4627,3531,21444,17530,21445,4630,1508,1775,4629,
+17531,19322,8435,2552,4634,2159,19323,1353,4633,4631,4635,4632,
+3297,5262,2553,4636,20302,3976,21448,4637,17534,4639,21449,3004,
+4638,17535,2864,2339,3559,2704,17537,2297,4640,2453,1175,2842,
+2584,21450,4643,3211,2454,2455,16836,4644,14122,2705,21451,13835,
+2456,8437,19324,4645,4646,14476,3820,4647,17538,19325,14477,19326,
+1726,21453,14478,2348,21454,21455,19327,2312,2546,3276,2586,3468,
+3288,1729,4650,1673,4651,3239,1328,2209,4652,4655,4654,1781,
+19328,21456,7826,19329,2832,17540,3141,2292,7693,14479,2778,3940,
+4657,19330,4658,3246,17543,2177,4661,16839,21459,14481,21460,21461,
+17548,16840,1584,4663,21462,16841,17553,1324,17554,16842,8438,17555,
+2749,1568,16843,4666,3764,17557,2866,21464,1463,21465,17558,4668,
+4670,1563,8439,4667,4669,3221,1702,1381,4675,4680,4678,21467,
+3655,3654,14484,8440,3169,4677,2398,17563,2616,16846,2138,17564,
+4687,21470,4688,4682,1425,4683,4692,4691,4690,4686,4685,17567,
+4689,21471,14485,14486,8441,8444,14487,14488,16847,21473,14489,4696,
+4693,3932,21475,4694,8442,17571,21478,2617,17572,4697,8445,2087,
+17574,19336,21482,16848,4702,19337,4701,4700,17577,21483,3170,4679,
+14490,21484,14491,21485,21487,14493,21488,4705,4710,4707,16851,1564,
+4712,21490,8448,17583,4714,4713,4715,17584,14494,21491,2706,2349,
+14495,2414,13362,2789,17586,1979,2088,1980,1674,17587,1918,4718,
+3762,3321,4719,1981,14496,19339,2917,1738,13794,14497,2210,3533,
+3413,21492,4720,1585,21493,4723,14498,14501,4722,4721,4724,17591,
+21494,2670,14502,2867,1596,19341,3006,3687,17592,4728,4727,3567,
+21495,3720,4732,3737,17595,4731,14503,19343,21498,16852,4733,3388,
+4734,3598,4735,1519,3599,3301,19346,1982,1520,4739,1900,3886,
+3859,1586,4741,19347,3007,1983,2457,2458,19348,21500,2434,3080,
+3657,3123,14000,1984,21502,17600,3155,2098,14506,14507,1919,17601,
+3081,1159,2424,1985,3889,17602,4745,4031,4051,15390,21504,21505,
+4747,4746,19351,14511,1445,21506,4750,21507,3506,2459,4754,4753,
+4749,21509,4757,4760,4758,4759,4761,1286,3082,4762,16853,1872,
+1398,3308,17606,4763,3283,16854,3627,16855,4764,4052,21510,14512,
+17607,4765,3600,4768,4090,4106,14513,2268,3277,4769,1655,3008,
+1214,4770,3574,1986,21511,17609,3083,8449,14516,16856,21512,3835,
+1901,1920,14517,4771,4772,21515,4778,21516,2321,8450,3009,14518,
+1703,4773,13720,14519,3485,16857,2948,21517,14520,4774,21518,8370,
+17610,4775,4776,19354,4777,14521,4779,3184,16858,14522,4782,21519,
+4767,4766,21520,4783,1815,17611,14523,13996,3481,8451,2108,3497,
+3010,3517,4784,21521,2460,1256,17612,4785,4786,21524,3838,21525,
+3444,16859,17613,4789,1311,2640,4788,4787,1816,2868,4793,4791,
+14524,4790,3951,1945,21526,17614,2435,4792,3142,2376,21527,3224,
+4796,4795,14525,21528,4794,4797,1946,17615,14526,4798,3566,2405,
+21529,19355,4799,3469,14528,3225,3011,13368,8452,14529,3114,4800,
+1605,2554,14530,3486,17616,21532,14531,17617,1587,3292,4801,2212,
+1312,4806,8453,2983,14532,17621,21535,14533,19356,1399,21536,14534,
+4854,4805,21537,17624,3302,21538,21539,4802,14535,2060,16860,4814,
+4820,4812,3158,21541,16861,4817,3535,14536,16862,4811,14537,4816,
+4015,2213,21542,2869,4809,17626,17627,1656,4819,2641,1287,4813,
+1400,4818,21544,4823,4833,4831,4828,16864,21545,19358,4827,4032,
+17629,4829,1706,21546,1987,19359,2436,4836,4822,4826,4810,14539,
+1402,4830,4832,2959,19360,2072,1336,4824,4835,4834,1707,2825,
+1476,21549,21550,14540,4837,21551,4840,4842,8455,21552,21553,2281,
+8456,4848,3084,4838,21554,21555,4846,21556,1401,17630,4841,4843,
+16865,14541,1947,3860,21559,1521,14542,21560,1275,4847,17631,3312,
+1137,14543,17633,3445,4807,4853,4857,3825,21561,4850,19361,3171,
+4855,17634,19362,2520,4856,3247,17635,4852,16866,8458,4858,17636,
+2061,14545,2671,16867,8457,1176,4851,4849,21567,2780,4839,2178,
+2854,4870,8460,2781,4865,17638,14546,2322,4866,4869,21569,19363,
+4864,2351,21570,4867,4861,21571,3848,3847,19364,1177,17639,8461,
+4860,19365,21573,17640,1770,1130,14550,17641,1522,8459,4868,21574,
+4876,4875,19366,16868,4880,8463,21575,4881,21576,19367,8462,21577,
+17642,4879,4882,4874,4878,17644,4883,4884,21578,17645,4873,2250,
+21579,4877,2870,1988,4859,2555,4896,19368,4895,17646,3755,1523,
+19369,4893,1819,1426,4890,21580,3968,4892,1178,4894,21581,4885,
+4891,4898,1818,4886,21582,19370,14551,19371,3911,19372,4905,21587,
+14552,2816,4033,4906,4900,17650,8464,4899,4904,21588,19373,14553,
+21589,3584,17651,3212,14554,1820,21590,4907,4902,17652,4908,19374,
+16870,4916,14555,4914,4915,2073,4913,4911,4910,4917,4909,4919,
+19375,17655,21595,14556,21596,19376,4921,19377,4920,21597,19378,21598,
+4924,17656,4922,4912,1874,4927,4926,4928,4925,4929,21602,21603,
+19379,4933,4932,2377,2642,1382,1404,8465,4934,14557,1155,2672,
+4935,21604,6756,4936,1847,21605,4937,16871,17658,2707,21606,14558,
+4938,21607,4939,1620,4940,19381,1921,19382,19383,13390,3690,2420,
+4943,21608,14559,21609,14560,2708,6938,3446,2326,14561,2109,4944,
+21610,14562,17659,2855,21611,3575,14563,16872,4947,21612,4948,17660,
+4946,17661,17663,3585,16873,3447,19384,17662,4950,21613,4953,2461,
+1621,4951,4958,2462,13765,4952,3322,19385,3912,4959,3172,4956,
+1989,2690,17665,4973,3400,3448,5042,3747,21620,4962,1313,2984,
+14564,2930,4965,4972,4967,4974,4970,4969,3365,21623,4963,1405,
+4961,1675,2899,4957,17666,16874,4960,1990,2687,19387,2463,4968,
+3336,1676,1446,1477,2535,4976,4981,4977,21625,1875,19388,4982,
+2160,2043,14565,17668,2352,4964,2251,4979,17669,21626,2214,4980,
+1160,14566,21627,4975,14567,17670,3013,14568,1677,4978,1131,21629,
+19390,2099,17674,19391,14569,3086,3432,4984,2784,2826,21631,19393,
+2169,4985,17679,4987,4983,21632,19394,21633,3633,3033,21634,17681,
+21635,2782,14572,21636,3659,2298,4999,4998,17684,21637,2622,19395,
+1876,14573,19396,4992,2465,21638,3264,3303,16875,14574,19397,4990,
+19398,2783,14575,14576,2340,4995,19399,4989,4994,14577,17687,21639,
+4988,1783,17685,21640,1467,14578,4996,3955,2110,2931,4993,21641,
+2688,21642,1991,2602,1288,2750,4991,1631,21643,3051,4997,17688,
+5000,5002,21644,2839,5008,21645,5003,21646,5005,21647,3507,3087,
+14579,5006,21648,3890,1525,14580,17691,1138,5001,19402,13340,1588,
+17694,21649,1289,8467,5007,13892,14581,21650,5018,14582,19405,5012,
+7724,5009,5016,19406,19408,17696,5013,5017,17697,19409,3414,3173,
+17698,21651,5010,19410,5014,19411,2145,19412,5022,21653,7747,19413,
+21654,14584,17699,14585,21655,17700,19414,8468,21656,17701,19415,3802,
+16877,2630,14587,17703,5028,21659,19416,17704,2179,5025,3304,21660,
+8469,3213,17705,21662,3115,5026,21663,21664,5027,3553,19419,3323,
+2161,3710,19420,5034,5029,21665,3892,5036,16878,5032,21666,13341,
+2786,8470,16879,21667,5031,4966,17708,17709,5035,3105,5043,17711,
+14590,2162,5038,1622,19421,5044,19422,5037,5048,5047,21670,5046,
+14591,5049,14592,5051,2521,17712,5050,21671,14593,5054,21675,17715,
+5052,14595,19423,5053,5015,17717,19424,7831,5056,5055,16880,5023,
+5057,5045,19425,2215,21677,17718,5061,5060,5062,1406,21678,1992,
+3660,2643,21681,17719,1922,14596,5064,19426,5067,8471,3524,21682,
+1657,21683,17720,5066,5065,3338,5068,1709,5070,5069,21684,19427,
+1526,2180,3248,14597,17721,1823,2644,3106,3537,5072,17723,14599,
+3592,4620,2666,17724,3449,3415,19428,3143,21686,3977,5076,2300,
+16881,5077,21687,1146,21688,1740,2673,21689,3538,5078,2192,2949,
+21690,2217,2557,17725,21691,19430,17726,5079,17727,3661,1305,2218,
+19431,17728,5082,14600,5080,5083,3969,5081,19432,17729,2719,5084,
+19433,2834,19434,21692,1590,21693,5087,1591,13701,3284,2932,1670,
+2219,2787,2406,1140,14601,5090,14602,17732,1314,5094,17733,1993,
+5093,17734,2075,2466,17735,8474,5092,2467,21699,3788,2074,1179,
+2674,8473,21702,5099,21703,20304,2645,1257,17736,16883,21704,8477,
+2399,21705,3732,2146,21706,17737,16884,14603,2468,8475,2635,16885,
+8366,16886,5098,21707,16882,7680,2985,5129,21709,5103,2252,1994,
+5101,17738,21710,16887,5102,21711,2558,14604,17740,5100,17739,2173,
+8479,21712,8480,13377,5105,5104,5109,21713,14607,5110,14138,5106,
+8478,1408,3433,17745,14608,3539,1824,5111,8482,2646,21714,2469,
+21716,2960,17748,21717,19436,21715,17749,1727,5112,5116,1355,5113,
+5115,16891,5114,17750,2421,17751,2950,1161,5117,8483,21721,8484,
+17753,3643,17754,8485,19439,3691,17755,5125,5120,16892,5123,5122,
+8486,19440,5119,13397,3254,14611,5121,21726,19441,2422,5127,16893,
+3893,3374,21728,5128,16894,5131,21729,14612,1730,1258,1995,5133,
+5134,2427,2788,8487,8369,4333,2752,2751,2872,2103,17759,21731,
+1860,3863,3568,8488,5135,17760,14614,2147,3035,5136,4053,3692,
+21732,3015,5137,1592,21733,3760,3748,3722,2163,5141,14615,3711,
+19443,5143,5146,5145,1658,21735,5142,21736,5147,16895,14616,2623,
+14617,17765,3941,1165,2128,2844,2313,17766,19444,2523,3144,17767,
+5148,2827,5149,2522,3817,3922,8490,21737,1996,13681,3339,5154,
+3174,5091,5095,17771,1641,14618,3325,14619,5156,2470,3416,19445,
+16896,21738,5162,5159,5158,21739,19446,2675,19447,17773,16897,3739,
+21740,3995,16898,21741,3733,16899,1356,2220,4078,5161,2619,1923,
+14620,19449,14621,5167,5165,19450,1357,5163,5169,5175,8493,2856,
+21744,17777,3601,21745,5177,17778,21746,3476,5176,3366,3693,1527,
+17779,2715,2378,14623,3055,14624,3864,17780,21747,5172,5171,21748,
+5173,21749,5178,5174,5164,14625,2986,21750,3844,2290,2148,21751,
+17781,14622,7834,2090,16900,3741,1439,14066,3050,3234,1259,7687,
+2710,21752,2648,1792,17785,21753,16901,5180,17786,1997,1498,21754,
+19452,5182,1490,5188,14626,17787,5185,17789,2711,1449,2076,17790,
+1448,2111,17791,21756,5183,1851,1825,3175,8495,17792,5181,1162,
+17793,21757,17794,5184,5186,1733,1794,8492,1528,1637,17795,17796,
+21758,5189,14629,2153,3743,5202,14631,1331,5191,21762,14632,21763,
+17800,5208,5192,3978,17801,5199,14633,3349,19453,5207,7836,5194,
+17802,1144,5196,17803,1998,5198,17808,5197,5193,5204,21765,2471,
+16902,14634,4542,1948,3942,21766,5195,21767,3088,1409,2077,14635,
+5187,17811,5203,1471,5201,5205,17812,3176,17816,1594,17817,5235,
+8367,3797,5210,1593,17818,5217,8496,14636,21768,3694,21769,5218,
+5220,14637,5224,5212,17819,2920,3177,5228,5215,5219,14638,21772,
+19454,17822,14639,2559,5229,19455,21773,17823,5227,1529,17813,14642,
+21774,4086,5209,17824,5223,1180,21775,17825,5211,21776,16903,3782,
+5216,2536,3043,5206,21777,14643,5222,14644,21778,19456,2624,5232,
+1487,1877,5234,5213,5233,5226,5214,5248,21779,19457,3238,14645,
+5221,19458,5244,21780,17829,16904,3894,3560,5241,2858,5247,2753,
+19459,5238,5251,5250,3271,5249,3266,14648,16907,19460,21782,8498,
+17830,5253,5240,17831,1728,5243,2407,14649,3350,5245,1731,5237,
+5239,5236,17832,21785,4054,1464,5242,5252,1427,21786,1279,5269,
+17833,4055,5272,17835,2560,5271,5270,21787,16908,14652,5267,19461,
+14653,5255,19463,17836,5284,5254,14654,21788,17837,5265,17838,5260,
+5257,17839,5258,7475,21790,5263,1999,3044,2790,5261,16909,5256,
+17840,3895,3736,5264,5274,8501,17844,5282,5275,16912,13329,5288,
+19465,5281,17847,17849,16913,14143,2791,17850,5278,21792,14657,5276,
+21793,5289,3465,5295,17851,5290,5293,5287,14659,3498,17852,5277,
+17853,5285,2472,21794,3803,5305,5292,21795,14660,1878,1315,1469,
+14661,2473,5297,21796,5304,2341,1488,16915,2924,14662,17857,5294,
+14663,8504,5299,5303,17858,19466,1710,15412,19467,14666,1638,5301,
+3235,5300,5302,19468,21798,8503,19469,5296,8505,8506,1470,2951,
+21799,14668,5309,5307,1949,5306,14670,21802,5179,5308,17866,5323,
+17868,5319,5200,19470,5318,21805,5291,5316,5315,17872,5321,4044,
+17871,5324,1779,14674,17873,5320,5322,14675,3387,5329,5326,21812,
+17879,21813,19473,3933,5327,21816,5279,17881,5331,17886,1239,14677,
+5333,1853,2253,1741,14678,1316,21817,21818,16921,14679,21819,5335,
+5334,5337,1623,19474,1742,1530,19475,14680,5339,5341,17889,1358,
+21820,2933,21821,1531,5344,17890,5343,5346,14682,5347,2221,2649,
+2065,13386,3554,16922,3634,4074,21823,17891,21824,2243,21825,13785,
+2112,4026,17892,17893,2222,17894,14683,5353,5352,21826,3718,2408,
+2328,2194,5356,2537,21827,5355,21832,16923,21833,16924,17896,5361,
+19478,5363,5362,5364,1317,2952,2164,1450,5366,17898,14684,3132,
+4509,1597,5367,5368,14148,3644,3734,13388,3231,5369,3450,8509,
+16925,3471,17902,3807,5372,5371,17905,5374,19481,16927,5376,19482,
+17907,19483,17908,2223,14687,3773,21839,5381,5380,14688,2603,14689,
+17909,3499,1260,20309,21846,3417,8510,3089,2379,1659,19485,21847,
+17911,3418,21848,2266,19487,5383,14691,1306,17912,8511,3274,5382,
+2000,2961,17930,5392,5385,21849,8513,2849,1660,5393,16928,21850,
+19488,1854,14693,1599,5391,5389,5386,3914,17914,14694,8512,21851,
+3036,17915,3249,5387,5394,1785,17917,14695,1325,17918,16929,2091,
+5388,5390,14696,3717,2900,14153,3749,19489,17919,5403,21853,5404,
+21854,1359,19490,3576,3849,5406,2255,2474,5399,5405,1290,1711,
+17920,5396,5401,16931,2712,3367,3451,21855,21856,14697,21857,19491,
+5398,14698,3663,14699,5400,5409,8514,5407,17922,5402,14700,3664,
+3326,1661,21858,2987,17923,5410,17924,14703,5408,2873,5397,21859,
+1261,21860,17926,15413,14704,3896,5421,14705,21862,14706,5420,21863,
+5417,21864,3926,3214,5411,17927,3041,21865,1262,2001,5414,14707,
+17931,16932,2353,5419,17950,5418,5413,5416,16933,1478,17932,5415,
+3327,16934,2524,2713,14708,16935,5427,5425,17933,3519,14709,21866,
+17934,19492,5422,5424,14710,1244,21867,2002,4056,3540,8517,17935,
+1410,2561,5426,8516,2475,13354,17938,3866,17939,5428,17940,21868,
+5423,16936,5429,8518,21869,17941,4006,3181,3226,16937,17946,8519,
+17947,1428,17948,5435,21870,5438,19494,3979,21871,14712,3918,14713,
+5445,5439,5436,17951,14714,3996,5442,17952,8520,15414,2388,5444,
+5449,14715,3179,5447,13395,16938,16939,5441,17953,21872,2934,21873,
+5448,21874,5437,5443,14716,5450,1216,5440,5451,21875,19495,2562,
+8522,2409,21876,3573,17954,2078,8521,5432,5446,3124,8523,21878,
+2650,1479,2113,2476,5434,2380,5455,2423,1902,5470,17956,5464,
+1678,3145,14717,5459,5468,1139,1236,8526,5461,2828,5452,5454,
+2003,5471,8524,5466,21879,8527,15415,5465,16940,19496,5463,5467,
+17963,14718,21880,1924,17966,2477,2935,8525,21881,16941,5457,21882,
+17967,3865,21883,5453,3180,5456,19497,19499,4087,2282,3756,3394,
+21884,5484,1903,5474,21885,3959,2004,5487,21886,5473,13324,16942,
+5481,21889,17971,3897,5476,3112,21890,19501,5478,8528,21891,16943,
+5486,17972,5480,3795,14719,21892,5475,14720,2254,5499,21893,14721,
+21894,2892,2874,17974,5491,5502,5492,17975,14722,5493,5469,1683,
+3500,21898,2057,17977,17978,21899,4057,16944,5489,5501,1291,2792,
+21900,14723,21901,1533,4034,17980,19504,19505,14724,3757,3054,21903,
+14725,19506,5496,5498,14726,17973,17981,21902,17982,5500,5494,7776,
+17984,21905,1855,17985,5514,16945,14727,5509,2716,21906,14728,1473,
+17986,16946,14729,21907,5511,3016,5508,3061,5513,14730,16947,5507,
+5506,5512,21908,2629,5503,19507,8529,14731,16948,14732,5515,17988,
+5516,14733,21909,14734,17989,1534,13884,17991,16949,5521,5520,5522,
+17992,21910,19509,17993,21911,3133,8530,14738,19510,1849,2905,5517,
+3313,21912,5524,16951,5529,5527,14739,5533,14740,5526,2044,3294,
+21913,17997,3934,5528,5532,2901,16953,5531,8531,7076,15395,5536,
+17999,21914,5540,18000,5538,8532,7760,8533,5534,18001,5535,21915,
+5545,5542,5541,5544,3244,5546,19512,2995,2893,8534,21916,5547,
+14742,18004,18005,21919,18006,21920,19513,20306,18007,5490,14745,21921,
+5551,14748,18009,1360,14749,18011,3182,1411,16955,18012,2314,2114,
+14750,8535,18013,4045,2604,21922,14752,21923,18014,19514,5552,8536,
+5556,2936,5559,5554,19515,18017,5558,21925,14753,5557,3130,1181,
+8365,18020,5561,14756,5563,14757,5562,3665,21926,18022,8538,21927,
+18023,14758,18024,5564,21928,18025,5567,3586,14759,3777,21929,16960,
+18027,7644,14760,4035,14761,21932,5573,18028,16961,14762,18029,5569,
+5574,21934,1294,21935,3351,5568,5571,2480,16962,3429,5578,16963,
+16964,5570,3898,5579,18032,8285,21937,18034,2393,18035,21938,3300,
+19519,15397,5583,16965,3305,16966,3183,5586,14767,21941,5585,14768,
+5587,1295,14769,5582,18040,21942,4430,5589,2793,2182,5591,5590,
+2538,4334,19520,5592,21943,5594,5577,5593,8544,5595,14770,3376,
+18042,21947,5598,3066,14772,5601,5600,21949,5602,18044,2315,3541,
+14773,18045,3832,2776,2256,14774,18046,19523,21950,5608,3618,3419,
+5609,3341,3017,14775,18047,5610,1383,19526,1671,14778,3794,21952,
+3778,19527,1332,4058,18048,3712,19528,3578,21954,2651,19529,18052,
+3227,1879,5612,18053,2116,5614,5613,14779,18054,5616,21958,5619,
+21959,1880,14780,18056,3420,18057,8545,5621,13355,18058,1712,5622,
+5624,5623,14782,1761,21962,2754,3232,1713,18063,19533,5631,2922,
+5630,18064,14783,4059,3352,21964,5634,19535,18066,21966,5636,5633,
+3808,5635,5637,19536,3980,8547,5641,16971,14786,5640,2996,3299,
+18071,1881,5639,14787,21967,18072,5638,21968,18073,5642,1296,14788,
+2056,2224,21969,5646,19541,16973,19542,5648,21974,5647,18076,14789,
+5649,18080,1451,8549,5650,21975,5653,5652,14790,21976,18081,14791,
+1904,1732,18082,1318,21979,18083,14794,1762,21980,18084,18086,14798,
+15423,1565,21981,14799,4016,5655,18087,13802,5657,14802,8550,18088,
+5658,18089,21983,5654,8551,2183,18090,21984,3037,5656,14803,8554,
+21985,21986,5661,2330,18091,8553,15417,5659,21987,18092,14805,1812,
+3421,5660,14806,8556,21988,5666,18093,18095,21989,14807,1905,21990,
+21991,18096,1663,14808,5663,3943,8555,3960,14809,15418,2902,14812,
+5665,8557,14813,8559,8558,16975,14814,21993,8560,5667,3998,1743,
+3472,3328,14818,5668,5670,18098,5673,18099,14819,16976,14820,14823,
+18100,18097,5672,1950,1263,5674,18101,2614,5671,4004,16977,5677,
+7477,5675,5678,14826,16978,21996,5664,5676,14827,19543,2092,14828,
+18102,18103,8562,21997,14832,21998,18105,18106,14833,18107,21999,5682,
+8563,14835,18108,5662,14836,18109,16979,5683,14837,16980,18110,14838,
+22000,19544,1536,18111,18113,18112,14841,16981,5684,5685,22004,22005,
+5686,14842,22007,1245,14843,19545,5688,3501,5689,19546,1504,5690,
+22008,5691,22009,18116,5692,14160,3525,5697,5696,18118,19548,22011,
+5699,5698,5700,22012,5701,5703,5702,2059,22013,5705,5704,19549,
+16983,1537,5706,2652,18120,19550,13790,2184,18121,1307,5707,22014,
+3899,22015,18122,3635,5708,8434,3134,3869,2005,2563,22016,2953,
+4297,22017,3018,1384,5709,19551,18127,22018,5710,5715,22019,18128,
+5713,5712,5063,1412,5711,14844,1182,18129,3390,18130,3961,5716,
+5714,2970,2634,19552,22021,3391,22022,3487,5718,3956,1827,5719,
+5717,3434,5720,15419,5721,8565,1183,18132,18131,2526,5726,14161,
+5723,3269,5722,14845,18133,14846,5729,5728,5727,3479,18136,2756,
+2755,14847,1625,5730,22026,19553,5731,22027,5732,18138,5734,19554,
+5733,18140,5742,3452,5736,14850,5738,18141,5740,2564,22028,5741,
+5739,2284,19555,5735,5737,19556,3508,18144,2481,19557,5743,16985,
+18145,5745,18146,2258,2079,19558,3185,5746,3047,19559,18147,5748,
+19560,3945,5747,14851,18151,19561,5753,18152,14852,5754,14853,5752,
+16986,18153,19562,18155,16987,5759,14854,5757,19563,5758,22029,18159,
+18154,14857,19564,14858,5760,22030,5765,18163,13893,5761,18164,22031,
+19565,18166,5766,14860,5768,18165,22034,18169,3981,14861,22035,19567,
+5771,18171,19568,14862,1566,18172,3610,5773,22036,16988,14863,5780,
+14864,18174,14865,5781,14866,5782,3395,3146,5785,3368,3494,5786,
+16989,8566,5787,3108,22037,1413,2006,5788,18175,5791,8569,8567,
+16990,8568,22040,18177,18176,19570,3453,18180,5795,16992,7452,22043,
+5800,3340,14870,3725,1264,18182,1273,22044,14871,5801,16993,5802,
+3178,2653,5336,5804,3789,22046,5805,1538,3435,5806,16995,5807,
+18184,5808,19573,14872,19574,16996,3809,2796,19575,5810,14873,19576,
+2482,22048,5812,5811,3473,16997,1539,1885,16998,18187,5819,22052,
+5816,2565,3774,19579,5814,18188,22053,19580,14874,18189,14875,19581,
+3019,1567,22054,19582,19583,8572,5822,5823,5826,14876,2605,7877,
+3228,19587,5827,3713,19588,5824,14165,5825,19589,5830,17001,18196,
+14880,5829,5828,17002,17003,14881,19593,5835,18200,5834,18202,3613,
+14166,14882,2400,3982,22064,19595,5836,22065,22066,5837,19596,19597,
+5839,19599,22068,19600,5846,3779,5847,3836,5848,18205,2956,14883,
+3360,1763,18206,18207,2937,5849,1714,14884,19601,2676,14885,18208,
+5850,18210,14886,5851,18212,22071,22072,5852,1882,2117,5854,8574,
+14887,22074,3152,2118,1640,3329,14891,17006,22075,5856,18215,22076,
+8575,13342,15420,22078,19603,2483,22079,22082,8576,18216,3962,2007,
+17007,1883,5859,3090,5862,1429,5857,22083,1234,18219,2140,4088,
+19605,18221,14893,18222,5863,18220,3611,22084,2685,5865,22085,17010,
+5866,17008,19607,22086,19608,1452,18223,5872,22087,5871,22088,5873,
+5868,22089,14894,19609,5874,5869,14895,3436,5867,22090,19610,5870,
+18224,22091,5877,22092,18225,5876,3727,14900,22095,5879,22096,14901,
+5878,18228,22097,17011,2484,22098,5880,18230,5882,5881,5883,22099,
+18231,17012,22100,19612,22101,18232,5853,22102,5855,5885,5884,22103,
+17013,8578,14903,17014,22104,2260,14905,4017,14906,2302,19615,5886,
+1805,19616,22105,14907,17015,1626,1601,2225,18233,22106,22107,3870,
+22108,5892,19617,5891,2758,5888,18234,2389,2566,5889,5887,18236,
+3502,22109,17016,5893,22110,19619,22111,5894,5916,1744,4067,2743,
+5895,14910,22112,1362,3091,3569,22114,8582,18238,14911,8584,22115,
+5896,1684,5897,22116,18240,5899,19620,5900,22117,3295,7758,5901,
+18241,1745,1363,3229,2354,2226,18242,18243,17017,5904,14915,2355,
+1354,3509,17019,5905,18246,22119,17020,2759,22120,5908,22121,5909,
+3359,22122,2567,5906,2975,19622,17021,5907,17022,2486,22123,1184,
+22125,19623,14917,22126,5910,14918,18251,3092,19624,5911,2667,3769,
+18252,2963,18253,3983,14920,5915,5914,22127,14921,2331,22130,19625,
+5917,1204,5920,18255,14922,19626,5918,1364,1828,5919,2008,2052,
+3638,5921,19627,14923,3714,18256,22133,5923,14924,2677,1265,1338,
+1136,22134,18257,5922,18259,14925,18260,20310,5926,18262,1453,1856,
+18263,1664,14928,5929,1773,5930,22136,2720,19628,3237,18264,2692,
+2149,17023,19629,18265,22137,18266,22138,2976,2797,19630,5933,5935,
+5932,5934,22139,1784,14929,5936,1788,1665,3900,5938,19631,5939,
+18270,1232,19632,18271,5942,1492,5941,5940,14934,5944,5937,22140,
+5945,3953,18273,5946,17025,5947,8585,4549,5949,22141,3965,5952,
+7176,2487,3216,5955,8586,18274,22142,2918,8588,22143,5956,2938,
+5957,22144,4214,2971,2271,22145,17026,19633,1540,5961,14935,1666,
+5960,5973,2488,17027,5965,22146,1468,2592,3542,14937,5967,22148,
+18280,19634,2888,17028,22149,14938,5962,22150,5966,5968,5975,3488,
+14939,3386,3187,1746,5974,5972,14940,3401,5969,2972,3189,14173,
+3188,18288,2150,18290,5977,18291,5979,14942,22153,5982,14943,5983,
+17030,14944,18292,5978,5976,18289,5970,3615,1365,5987,22156,5992,
+18295,14945,5991,3369,3763,22157,2185,5985,5994,5989,18296,5988,
+5984,8589,5986,19636,1541,19637,2721,14946,19638,3382,22159,5999,
+18298,22160,18299,22163,2693,5996,22164,3427,18300,6000,3619,22165,
+2969,18301,5995,5997,18305,14947,14948,18306,22166,3230,6006,6005,
+19639,6002,18307,19640,6011,6015,6012,19641,6008,17031,22171,18309,
+22172,22173,6009,14949,22174,6014,18310,14950,6003,4330,6010,6004,
+7739,6019,14951,1542,22177,14952,6017,19645,6018,6021,22178,17032,
+22179,14954,6020,3466,6022,4036,3645,6027,19647,6024,18311,22182,
+6023,2678,6026,6028,14955,6025,22183,6032,18313,6029,14956,22184,
+18314,6030,6007,18315,22185,6031,6033,6034,17034,14958,18317,14959,
+19653,3606,14094,22187,19654,3822,1734,1791,6036,22188,19655,17036,
+6037,17037,3370,2760,3306,19656,1156,17038,6042,6040,6038,1501,
+18321,2489,6043,6039,6047,22189,6046,6045,6044,6048,19657,22190,
+14960,6049,2654,14961,6050,18326,6051,18328,2746,22191,6054,19659,
+22192,17039,3190,14964,6053,14965,19660,6055,14966,3589,2798,2009,
+18331,3984,6060,18333,6061,6062,1829,6064,18334,3839,2010,6063,
+6067,3826,22194,3493,22195,18336,14971,2413,6066,22196,2303,2011,
+2228,1667,3590,6065,14972,18337,2761,3696,2151,14973,22198,2229,
+3065,22199,6070,4007,2121,17040,6071,2568,2490,2080,6072,18342,
+14974,2356,1906,2762,6068,6074,18343,8591,6069,1830,19662,6077,
+6081,1857,22200,13882,6076,22201,14976,18347,6085,17041,14977,2012,
+3927,1152,6082,22202,1669,22203,6079,18349,3191,6078,6075,1414,
+2696,22204,1884,14978,22205,22206,19663,17042,19664,14979,18353,6084,
+22207,18354,1831,2835,6088,2800,18356,19667,6101,8594,6097,6091,
+17043,18357,18358,6095,2342,1185,6090,6098,6102,2013,3810,19668,
+3058,6092,18359,8593,6100,19669,6089,2940,6094,1153,3798,18360,
+1747,3456,14982,2799,19670,3992,2425,6141,8595,18361,6103,18362,
+2722,6099,6104,6106,3093,6109,22215,13322,6105,19671,18363,3620,
+1543,22216,14983,3799,22217,14984,6108,14985,22218,6107,22214,1297,
+3268,6110,14986,6117,6111,6118,18367,14987,6114,3377,22219,18369,
+2294,6116,14989,6113,6119,6112,2382,18370,17045,3667,18371,22220,
+2390,19674,6115,6127,22221,6123,19675,6126,6124,6128,6122,6096,
+2679,22222,6125,19676,18372,6120,14990,14183,2723,1832,2357,22223,
+2539,2744,6131,6130,6132,22226,7697,14991,22227,6121,6129,6137,
+6136,7671,3752,14992,19677,1793,19678,6135,6139,6138,6142,18374,
+6144,19679,2186,6140,6147,14994,6153,3125,6149,14995,6148,22228,
+6152,6157,18381,18380,19680,18382,22231,18383,14997,6158,6165,6164,
+19681,22232,19682,19683,22233,6171,2129,1833,18389,2964,3399,19684,
+2426,3457,6172,4918,6173,6175,3919,6174,6177,6176,3901,19687,
+6178,22235,3474,22236,18392,15002,18395,17046,18396,6181,6180,8598,
+19688,6183,1800,2724,1627,22238,18397,6187,6184,6189,6186,22240,
+1227,15003,22241,1319,15004,18400,6195,6194,15005,2607,6196,15006,
+6197,22243,6198,1569,15007,18402,6199,6200,15010,3723,3917,3902,
+4061,14099,2015,6203,2304,6202,19692,18404,18403,6204,2261,19693,
+15011,22244,2865,15012,6205,22245,15013,2014,18405,3811,6208,22246,
+19694,2262,22250,17048,3833,17049,19695,15016,6212,15017,2941,22251,
+6211,22252,18408,22253,3593,6218,15018,2801,6219,4038,6223,15019,
+6222,6221,3020,15020,6224,2540,6226,4062,6227,6228,6230,6229,
+3385,19696,3281,4068,3389,3484,18411,6233,6231,18412,1546,15021,
+1928,2230,18413,3458,15022,18414,1886,3697,15023,6236,6234,2017,
+1197,18415,22257,3343,1187,6241,18417,2942,3342,22259,2875,19698,
+19699,18418,6243,6239,6242,6237,6240,3668,17051,1929,1217,6238,
+18419,19700,22261,6245,19701,6246,22262,17052,3217,18421,22263,19702,
+1715,22264,19703,18422,6257,3315,19704,2231,19705,1716,2668,4076,
+3770,6244,2680,22265,15026,19706,15027,1645,6247,22266,6249,18427,
+13913,18429,6250,19707,2916,3021,15028,22268,18431,6254,22269,6253,
+22270,15029,6251,15030,3543,6256,22271,6255,2018,4089,6272,17053,
+22272,17056,6259,19709,2058,6258,19710,6262,22273,3022,3570,2725,
+2876,6266,15031,6267,6263,15032,18436,22274,6265,19711,22275,2019,
+19712,6269,22276,3544,19713,3738,3482,19714,22277,6271,6270,3698,
+6274,18439,2745,15033,6276,6282,17057,6279,6277,3317,6280,18440,
+6281,18441,22279,1330,6288,6283,17058,19715,6284,22280,15034,19716,
+18442,17059,6287,6286,6289,18443,2569,18445,1385,6292,3999,2263,
+22281,18447,2359,2232,2965,22285,19721,22286,15035,1235,18448,6295,
+18449,19722,15036,18451,6298,6299,1717,5039,6300,19723,2697,6301,
+2295,22288,6302,6303,3630,1560,18453,19726,2726,2402,22289,3555,
+2360,15037,18454,22290,6304,2020,6305,3424,15038,6307,15039,2857,
+3371,1907,6306,2727,19727,22291,19728,18458,15040,3094,22292,15042,
+22294,18462,6310,6309,6312,18464,6311,6313,17061,6315,18465,6314,
+1547,22295,6316,19729,2081,3985,6320,2541,18468,6323,18469,18470,
+19730,19731,18471,1206,6324,15043,19732,6325,18472,22300,22302,3545,
+6327,22305,17064,1415,1142,17067,19733,6326,6329,3332,15044,2570,
+19734,1366,18475,3669,18476,15045,1843,1748,18477,6328,18478,1386,
+15046,17068,1503,15047,19735,1299,6333,4018,2877,17069,6345,22306,
+1367,6343,6341,6332,22307,6330,18479,6331,22308,2319,1764,2997,
+18480,19736,3241,6335,6334,19738,18481,6340,6336,6339,17070,15048,
+17071,8600,3804,6338,1368,1499,6342,18486,1135,18487,22314,17072,
+6365,6356,22315,17073,22316,6355,18488,6350,6349,22317,6347,6346,
+2977,22318,2907,6352,17074,18489,22319,22320,15049,18490,6354,7672,
+17075,2802,1835,1251,6353,15050,2021,22332,18485,15051,19739,18491,
+2803,8601,17775,1369,19740,1326,6369,17076,8602,22324,22326,6359,
+15052,6367,6374,6368,15053,6366,15054,6337,15055,22327,6360,18497,
+22328,18498,1548,6362,6373,22329,17077,6375,15056,6361,3378,22330,
+22335,6392,22331,18499,1632,6379,17078,18500,17079,1371,18501,2122,
+18502,3147,6387,17080,22333,3646,15059,6378,1370,1930,3483,6388,
+8604,6385,19741,18504,6395,19742,6380,6381,3218,17082,6386,7807,
+6383,3670,6389,1188,15060,3361,6397,6393,18508,6398,3928,22337,
+6407,22338,8605,3903,15062,22339,3954,18509,22340,2998,19743,1481,
+18514,17083,22342,3556,6413,3193,22343,18516,1141,22344,6406,22345,
+6402,2804,6396,6404,6409,17084,3298,17085,22346,1134,15063,6401,
+18517,6410,3562,18518,22347,18519,6405,6400,17086,22348,19744,2264,
+22349,17087,6416,19745,1493,2528,6414,17088,6419,2805,19746,18523,
+6415,15066,6422,15067,3904,6412,1430,22354,6418,6421,3768,6417,
+6420,4039,18531,15068,18532,22355,18533,19747,6435,15069,6427,2287,
+6394,22359,22361,3614,3758,6434,6433,1240,18534,22362,17091,6432,
+6426,22363,7706,3057,22364,22365,18537,6431,1218,17090,22366,15071,
+2818,22367,3603,7861,22368,6436,6440,6439,2494,2293,6442,1718,
+18538,22369,18541,22370,8607,6443,19749,3563,6438,8608,6399,22371,
+19750,15072,6437,17093,4085,3194,3557,8609,22375,17094,18545,18546,
+6457,18547,6444,18548,3372,19751,18549,6454,6446,22376,6448,22377,
+17095,15073,6458,6447,18550,6451,1300,19752,3261,6452,6455,18551,
+18552,22378,6445,22379,2728,22380,6449,2165,2571,1798,3840,15076,
+3845,2428,8611,22382,15074,22383,6462,6460,4084,22387,6459,18558,
+17097,3935,15075,6461,6463,6467,6465,18561,22389,18562,3195,6466,
+18563,22390,3425,6453,22391,14208,18564,2429,6468,6473,2806,22392,
+6472,17099,18565,6474,2763,6469,6471,17102,18566,15077,6470,5328,
+5313,17104,22395,6476,22396,18568,6475,5809,6477,17105,18572,22398,
+18573,22399,6478,18575,16824,19753,6479,1931,15079,18576,6481,4244,
+18577,17106,1679,13336,3970,22402,1771,6482,17107,15080,22405,2988,
+15081,17109,22407,18578,3282,15083,1150,18579,22425,18580,1379,2187,
+22408,6486,3320,6492,6495,18583,6491,22415,17110,22416,22417,19755,
+18585,18586,6493,22418,6494,2308,1836,1440,18587,22419,6499,18588,
+1437,22420,6504,22421,6500,6503,22422,18590,3406,22423,18591,22424,
+6502,3514,3438,6505,2909,6515,15089,6511,17111,15090,1387,3672,
+6510,22426,18593,6507,18594,6508,6513,6516,15091,6514,18595,22427,
+18596,6512,6506,15092,19756,2966,15093,6523,15094,18597,18598,19757,
+18599,15095,6522,19758,22428,18600,22429,19759,18601,6520,15096,6518,
+18602,4063,6527,22433,6528,6530,18605,6533,6525,6524,22434,6532,
+22435,15097,18608,19761,18609,17112,15098,18613,18614,19762,3877,19763,
+19766,6539,18616,6538,19767,19768,6541,3920,6552,6543,18619,19769,
+6544,18621,6551,6550,22444,19770,22445,6542,22446,15103,22447,19771,
+18623,6555,22449,18625,22450,18628,15104,7715,15105,22451,6554,22452,
+22453,1416,22454,1628,6558,22455,6537,15108,8614,22456,17114,15109,
+6557,6561,6556,17115,6563,22458,18629,15110,6565,6564,19772,22457,
+22459,19773,15111,22460,7813,6567,6566,6497,6571,18630,19774,18631,
+22461,6568,18632,22462,6569,6570,19775,6572,18633,1858,22463,6574,
+22464,6573,19776,2362,18635,19777,2022,5412,19778,22468,6575,2395,
+19779,15112,1431,18636,6576,19780,1268,22469,2495,6577,15113,22470,
+2023,6578,1189,15114,3503,18639,19781,18641,2608,22471,6586,6584,
+6581,1750,22474,6580,6587,2837,6588,15115,6591,6582,22475,18642,
+15116,3459,6595,6597,1927,6585,6596,18644,2123,4030,2807,14217,
+19785,17116,3946,18646,15120,18647,6600,3871,15121,3636,6603,22480,
+2096,19786,3947,22481,6608,6609,2496,6607,8615,22482,3921,6604,
+6606,2657,2628,18649,6605,15124,3571,6611,22483,3673,6613,8360,
+6625,6615,6616,19790,15128,22487,15129,22488,17118,19791,6622,18651,
+6623,17119,22489,6621,17120,6619,18653,6614,6620,18654,22490,6624,
+7120,1320,22493,19792,22494,19793,6627,1751,6626,22495,18657,22496,
+6629,6631,19794,6630,22497,6632,19795,2363,22498,6633,22499,22500,
+15131,19796,22501,6635,2658,13870,3905,3572,3324,6637,18658,6638,
+1887,1606,18659,6639,17121,22503,2233,3319,6640,18660,22506,6641,
+19797,6643,3937,6642,2572,6645,18661,6646,1549,22507,19798,22508,
+18662,19799,6648,15132,19800,15133,22509,18663,15134,2542,6654,18666,
+6655,6656,22512,18668,1908,13756,3095,6657,15136,1837,3196,15137,
+6659,18670,8616,1799,18671,15138,6658,2903,1607,6662,22515,2497,
+22516,18673,15139,1859,22517,6663,22518,3841,2764,18674,6664,8617,
+2573,2990,2498,22522,18675,22523,6665,18676,6668,17123,6669,19801,
+18677,15140,2094,2850,6667,22525,2499,3504,22526,19802,18678,6666,
+22527,17124,2234,1269,17125,6673,1838,22528,2236,19803,4083,6672,
+6671,2729,1639,4073,1432,2500,19804,15141,22533,6675,22534,6676,
+6674,19805,1932,22535,2237,3293,22536,18680,6679,22537,2660,2944,
+19806,22538,3872,22539,6682,1952,22540,2659,6678,6683,1953,8619,
+6677,22541,13880,2694,3233,18679,22542,2925,1373,22543,19807,18681,
+22544,1629,8620,3024,6686,22545,6684,22546,2954,22547,19808,22548,
+2661,1550,6685,2593,17127,19809,3986,4070,18682,6687,6698,3025,
+19810,6697,8621,6694,6702,6695,3096,6690,6688,19811,3851,2238,
+22552,6692,6689,15142,19812,8623,6696,2430,2906,22553,3699,1276,
+1190,3197,18686,19813,6700,18685,22554,6699,18687,3262,19814,6704,
+19815,6703,6705,1888,6701,2024,18688,2305,22555,15143,6706,3906,
+6710,3495,18689,6713,22558,19816,17128,22559,6717,6714,22560,6716,
+6715,18691,19817,8624,15147,2269,17129,6720,6719,3546,18692,6722,
+6721,6723,19818,6724,1630,6190,2529,18693,1954,19819,22562,19820,
+6726,19821,8625,6727,18694,2188,22563,19822,5075,18695,6728,22564,
+6729,22565,2364,15148,17131,15149,19823,2921,22566,18698,6735,18700,
+22567,6737,18703,3198,15150,6738,17132,3675,19824,6739,6740,18704,
+6741,22568,19825,15151,6742,18705,22569,22572,3250,22570,2501,6743,
+17133,18706,2045,4103,6744,18707,6745,3505,6746,19826,6754,6748,
+6750,22581,3700,18710,18709,6753,6755,18711,18713,22584,1419,3075,
+13644,3547,2130,2025,3521,1375,3426,6758,1551,2681,6757,6762,
+2999,3823,6763,3353,2879,22585,19827,3461,3127,6759,3701,1388,
+6765,4046,3038,4075,19828,22586,2239,6764,19829,2833,22587,6781,
+2730,22588,3280,19830,3522,18715,18714,15154,6768,2189,2240,22589,
+2502,3355,15155,1889,6767,6766,19831,3148,22591,8626,18717,22592,
+8627,19832,19833,15156,2026,6769,15157,22593,6775,2819,18719,6774,
+1570,6777,18720,6776,6778,8628,6780,6782,6783,19836,15158,19837,
+2682,22594,2299,6784,1456,15160,6785,19838,2808,6786,6787,3549,
+8629,1609,6788,22596,15161,3026,22598,19839,22599,19840,22600,19841,
+22601,19842,2829,22604,6792,22605,22613,22607,15165,22608,18721,22609,
+6798,6796,15166,6793,22610,19843,6795,17136,18722,6794,6797,6802,
+15167,22611,19844,1933,4047,22612,3027,19847,2731,6803,18725,3907,
+19849,18723,3199,6809,22616,6810,15169,19850,18732,6813,19851,22617,
+6814,6812,18735,6816,6820,6817,6815,15170,6818,19854,22620,19855,
+6819,18737,6826,22621,19856,2684,6823,19857,18738,6825,6822,15171,
+18739,18740,15172,19859,6828,2365,19860,6827,19861,22624,15173,17139,
+6829,6833,6832,19862,6835,6834,19863,6837,15174,6836,6838,19864,
+18741,6839,19865,22627,22628,18742,6841,22629,19867,6840,2574,6842,
+19868,15175,1765,6843,6845,18743,14083,22630,18744,7663,22631,6847,
+6844,22634,6848,2306,6849,1610,1801,15177,1890,6850,22635,3128,
+6851,22639,22636,19870,22637,22638,2272,15179,17142,6853,6852,1840,
+6855,22640,1457,19871,18749,2124,6856,6859,6861,3637,6858,22643,
+15180,19872,6860,6864,6862,1611,17143,6863,19873,6866,19874,22647,
+3344,4000,18750,19875,17144,22648,2366,6867,22649,19876,15181,22650,
+3852,6869,19877,6868,6872,3883,18751,22651,6871,19878,1483,6870,
+6875,19879,6874,18752,6873,3116,6876,22652,17145,19881,6877,18753,
+2575,6882,22658,2265,6883,6884,18755,19885,15182,4278,4277,6885,
+6143,6886,2914,2545,3318,6887,22659,3621,3056,2064,22660,2919,
+22661,18758,1228,3750,2589,18759,18761,22662,18762,1844,22663,1753,
+22664,18763,3622,18764,6890,22665,15187,6889,1376,17147,3278,6891,
+3373,3117,17148,6892,2396,18765,6894,18766,15188,3790,6909,3045,
+22666,2880,2809,15189,3200,19886,6895,1647,6904,18768,6901,6914,
+3201,2974,6898,3098,3149,6899,6903,2598,22667,3357,3048,19887,
+2662,6902,2830,2820,6900,1133,4040,15190,17150,2881,19888,2367,
+2576,6907,6906,18769,1203,6908,6916,22673,3251,2609,18771,15191,
+2967,6915,3873,1249,19889,3623,1377,3219,2913,1191,6917,6918,
+7476,19890,2845,18772,6919,1301,2766,22674,1891,3908,22675,8634,
+6920,3110,22676,2810,2307,6921,19891,19892,2415,6922,2733,2732,
+19893,1192,3987,6926,3462,6928,6927,6925,5943,1552,18775,6893,
+15192,6930,6929,19894,18776,22677,6931,18777,3874,17151,19895,15194,
+19896,18778,15196,3257,22678,3676,6933,18780,6934,19897,17152,15197,
+6935,18781,19898,17153,17156,18783,19899,2027,6939,18785,15199,8635,
+18786,1802,6936,6937,22683,17157,19900,15200,3875,18788,1719,18794,
+19901,18795,17158,8637,17159,15201,18796,6942,22688,3100,22691,17162,
+6944,15203,6943,22692,18798,18799,15204,22693,15205,15206,3243,6945,
+2368,2316,3345,2991,22695,2334,22696,2610,6946,18802,6947,18803,
+19903,15207,15208,2595,6948,15209,6949,6950,3929,2369,22697,6952,
+6951,18804,2028,2053,2190,18805,19905,22698,22699,6955,17164,18806,
+22700,2416,6954,19906,6953,2889,15210,1955,19907,2663,3396,22703,
+22704,6956,6959,6957,7707,6958,19909,7777,15215,18807,6961,6960,
+18808,6962,19910,15216,19911,19913,3428,2115,2317,6965,6966,3948,
+2383,3834,3988,6967,1754,6968,8640,3101,22709,8639,6971,1494,
+2577,8641,6969,3715,1780,22712,15217,17165,15219,6972,22714,6976,
+19914,18814,8646,15220,19915,8648,22717,3255,1441,8647,6980,6977,
+6979,15221,7050,15222,4019,1934,15223,8655,8649,22731,6988,8650,
+18818,15224,3118,6983,22732,15225,6986,6984,18819,6989,22733,8652,
+15226,6990,8654,18820,6982,22734,8653,6995,1302,15227,18821,3393,
+6985,18822,2504,8656,18823,22737,22741,19917,3702,18827,1756,8362,
+18828,22744,18829,19918,2735,22745,6993,6987,6992,18830,3791,18831,
+3028,6994,6991,18832,22746,8657,22749,18836,13652,22750,6998,22751,
+6997,22752,19922,15228,19923,19924,18839,22754,19925,22755,18840,6996,
+8663,3677,8667,8661,22756,8662,15231,8666,22759,22760,2437,18841,
+8660,22761,6999,3631,22762,1270,22763,3512,2992,18845,1682,8368,
+7001,8670,2031,8673,22765,7000,2611,18842,19926,15233,2612,7004,
+7006,22767,8674,8672,15234,2531,8669,7005,7007,22768,8668,1739,
+15235,3511,18846,22769,2318,4041,7003,2152,4069,19927,22770,7009,
+19928,22771,7008,7010,15236,8361,17166,13400,3265,22772,18849,15237,
+3059,22773,7015,8677,19929,18850,2945,7011,22776,15239,18851,1795,
+15240,7014,22777,8676,18852,18853,22778,1892,22779,7013,22781,2505,
+19930,19932,18858,1495,22784,7019,22786,2095,2811,22787,3046,15241,
+17169,8678,22789,1433,22790,15243,7020,15242,19933,8679,18865,7029,
+22797,15245,22798,19934,22799,7028,3111,7025,22801,18866,7027,8680,
+17170,1720,15246,7030,7024,19935,18867,7023,22802,8681,19936,15247,
+18871,22803,19937,7034,17171,7035,22804,18868,15249,7036,7033,7032,
+22805,2506,3202,7031,19940,22807,8682,18872,17172,15250,7039,7037,
+7041,18873,22809,7044,8683,1553,7043,3846,22810,7055,7045,22811,
+7048,22812,7046,22813,7047,17174,7049,15253,18876,22815,18877,7051,
+17175,15254,7056,7054,7057,7059,22817,22816,3029,15255,18878,7060,
+2736,22819,18879,7061,19942,3604,7062,1417,17176,1246,1555,8685,
+1554,7063,17177,7067,19943,1556,1459,2032,3402,15256,7069,7068,
+15257,20313,17178,7070,13653,1278,7073,22822,7072,7071,15260,7074,
+19944,19945,1163,18884,19946,7075,17180,7079,7078,17182,7081,7080,
+7082,3206,22823,15261,7083,22824,17184,22825,19949,7084,7086,19950,
+7085,19951,3550,15262,22826,7087,22827,19953,3703,22830,19954,2765,
+18891,19955,1128,2859,15263,7091,7094,7092,2033,7093,1910,3605,
+7096,7098,7097,7099,18892,1219,2590,2438,1557,7100,7101,3040,
+19957,3989,3203,7095,3950,1893,19958,22837,3909,22838,19959,19960,
+18894,19961,15265,1777,3964,1790,19962,2882,6252,7103,1418,2613,
+1460,7105,19963,7106,7104,1850,18896,2125,2507,8688,22840,1221,
+4001,15266,17185,22841,7108,6923,15267,7107,19964,8689,7111,18899,
+7112,7113,4020,18900,2669,3407,18901,2627,1571,3876,1389,2370,
+1935,7118,22842,7117,2241,7119,7116,2166,15268,7123,6546,18904,
+4331,18905,2621,7121,18906,15270,22844,3949,3273,1229,15271,2695,
+2274,17186,3591,15272,1250,4021,3925,7124,22845,3135,15273,19965,
+7125,22846,7126,2578,7127,15274,4022,7122,7129,7131,7128,18908,
+7133,22847,19966,2812,22848,1378,18909,7134,3780,19969,7136,19970,
+4048,8690,5140,7137,18912,7143,8692,7140,7141,18913,7142,7144,
+22850,8693,17187,8694,8695,2664,20314,3843,18914,22851,2665,15275,
+18915,7145,7146,7430,3800,15276,7147,7148,19971,7149,1461,18916,
+7151,2591,15277,15278,1786,7153,7157,22854,7155,19973,19974,22855,
+7156,1489,7154,7158,17188,18919,22857,2508,19975,15279,18920,19976,
+1633,15280,7165,6708,19977,3628,17189,22858,19978,17190,18923,22860,
+7169,22863,7170,17192,22864,7171,18924,19979,22865,22866,18925,1558,
+18926,22867,18927,15283,17193,7172,22868,15284,19980,18928,7173,3289,
+19981,18929,7175,1339,15285,7178,7177,22872,1222,3607,3030,2066,
+18930,2034,2417,19982,2594,7180,18931,15287,7179,3884,1572,3430,
+3252,18932,18933,2626,3990,22873,1841,22875,7183,15289,7182,18938,
+19983,15290,3705,3204,19984,22876,7795,1266,22877,7184,7181,14259,
+3523,3924,7185,15291,7186,18939,22879,7188,2890,1573,1894,17194,
+8697,1574,15294,7752,3129,8698,18940,1936,22881,7189,15295,7194,
+7193,7195,18941,18942,22882,7196,18943,7197,7198,18945,15296,18948,
+7200,7199,19988,7201,18949,15299,18950,22883,3464,6201,2543,13848,
+18951,1612,18952,15300,22884,17195,7202,18953,7203,4289,5338,3431,
+1215,18956,1151,2242,3678,2534,19989,7204,22886,18957,7205,3910,
+2191,19990,7206,1390,7207,19991,22887,7213,7209,22888,22889,8701,
+1559,22890,7214,22891,19992,15303,18971,7218,7220,18972,22893,19993,
+7219,7222,7225,15304,18973,19994,7226,1722,17196,22894,22895,15305,
+19995,15306,18974,22897,8703,22898,7229,18976,22899,15307,22900,2968,
+3267,22901,7232,18977,18979,2860,1274,1766,1767,15310,2993,7237,
+1768,22902,18980,1391,7236,18981,22903,7234,22904,7235,18982,7233,
+19996,7247,7243,18985,7242,18986,7244,15311,17197,22913,7246,18987,
+22914,19997,1613,7245,19998,18988,2813,1895,7248,18989,22916,19999,
+15313,15314,2861,3205,18991,22918,15317,7250,15318,7253,20000,7252,
+7254,18992,7251,15319,22921,18993,7257,8704,20001,7727,22922,7256,
+15320,7259,18994,1723,7258,7263,7262,7264,7266,7265,22925,7267,
+22926,18996,7268,18998,1434,19000,22929,7269,22930,7270,17198,17199,
+2615,17200,7271,19003,7272,19004,19005,17201,22932,2036,8705,22933,
+8706,22934,19007,7279,22935,19008,3397,7281,22936,3480,7282,7280,
+7283,22939,15323,22940,7286,20004,17202,15324,17203,20005,20006,19009,
+7288,20009,7289,22946,19013,20297,7290,15325,7293,22947,19014,20298,
+17205,5332,7300,6057,1614,19015,1407,2082,7302,7301,3761,19017,
+22952,3728,20012,1685,22955,19019,17207,8708,15328,7308,8707,22960,
+15329,22961,20014,7310,17208,22962,20015,22963,22964,17209,22965,22966,
+1154,8709,20016,7311,3579,7309,22967,20017,17210,19024,15330,7316,
+22969,3740,2171,19025,2154,2737,20018,8710,19027,22970,19028,7320,
+8711,22971,19029,20019,7318,15331,7321,15332,20020,1957,7319,17211,
+7322,22972,2168,15333,19031,7329,7326,7325,7327,17212,15334,1845,
+19033,15335,19035,19034,7333,7332,7331,19030,15336,17213,22973,15337,
+20021,8712,7340,7336,7342,15339,7338,1472,22974,4082,22975,7341,
+7337,7335,7334,19039,7345,20023,19043,22976,7348,19044,17214,7347,
+7346,22977,15340,22978,19045,15341,3515,7344,1207,7349,19047,7351,
+20024,15342,19048,1485,7330,1241,22979,7353,22980,20025,19049,7352,
+7350,2923,3742,15344,19055,20026,4002,19056,7354,19057,19050,19058,
+22982,19059,7355,20027,7356,20028,19066,7357,15347,7358,19067,22983,
+3031,19068,7359,7364,7360,19069,3679,3792,3240,22984,15348,7365,
+7366,3222,7363,7362,19072,7374,1303,22986,7367,2270,1321,22987,
+20029,22990,2037,22991,20030,7377,7376,7375,15349,17220,7372,22992,
+7378,15350,7379,7384,7383,17221,19081,2054,3781,19082,15351,7382,
+22995,15352,20031,8714,3680,7390,8713,7386,19085,7391,20032,15353,
+22996,19088,22997,7388,7387,17222,15355,22998,1842,23001,17223,19089,
+7392,7394,23004,7389,17225,23005,7369,15356,7395,3069,19092,7399,
+19093,7400,7398,17226,19094,19091,17224,7397,7403,15357,7396,7401,
+15358,19095,23007,15359,7646,7404,19096,23010,15360,19097,20033,7407,
+17228,7408,23011,7409,23012,4079,20035,15362,7406,2891,2141,7410,
+23013,19102,23014,15363,23018,19103,15364,7413,1896,7415,20036,19104,
+7677,7416,2267,19106,7417,23019,7418,7423,7421,4066,7422,23022,
+4023,23023,7424,17230,4003,15365,7425,3380,15366,7426,7428,15367,
+7429,23024,17231,20040,23025,7682,7797,7427,2047,3801,3729,4740,
+19110,5375,3753,13323,1323,23028,7431,1642,8717,2055,7435,23029,
+5645,3815,2883,7436,7438,7437,19112,7439,20041,7440,15368,7441,
+15369,7442,20042,23032,20043,7443,23033,23034,7446,19114,19116,3102,
+20045,15370,23035,15371,1937,20046,7453,23036,15372,15373,23037,20047,
+23038,2767,7454,20048,15376,19117,3475,23041,19118,7456,23042,15378,
+19119,23045,7457,5898,6779,7174,7458,19120,7459,19121,23046,15379,
+19122,19124,23047,4024,7460,15380,19126,7467,7466,19127,23048,20054,
+19128,15381,7469,23049,15382,7470,7468,23052,15383,15384,7471,23055,
+17232,7472,5927,20055,7473,23056,15385,23057,15431,15429,15434,13839,
+18344,7814,18620,20061,18124,18352,7817,13807,17478,18209,19075,20220,
+17885,18624,17297,18181,17784,17783,13841,18757,17539,18303,17788,14121,
+16821,13832,7670,17233,14108,20063,13928,17653,13750,18708,17327,16833,
+14293,14140,7695,18444,17814,20065,17103,20057,18571,13523,17009,13932,
+18882,7839,13809,18185,14188,17942,13357,18812,13854,18817,14180,17599,
+17331,14109,18672,14253,18824,17657,17227,17827,13670,17552,17332,18716,
+17551,17033,13857,17744,17559,17742,16888,20112,18193,18944,14068,17945,
+18268,17308,17472,18452,20066,14069,17561,17373,15269,17743,17944,17943,
+18885,17414,19125,18718,14294,17259,18638,18637,14256,19105,18843,18886,
+14105,18049,17562,16845,18890,18162,17843,17841,15393,20124,18848,18197,
+18104,17415,18319,17388,18320,18385,18847,19001,18416,14075,18893,19037,
+18170,18463,17897,18855,14100,18918,20072,18466,17667,18784,18325,18277,
+17428,18329,19051,18895,20083,18959,18278,16816,17854,17340,18430,17575,
+16916,17867,17018,17761,18293,18699,18249,18702,20128,17146,19071,17764,
+17763,18339,17770,18611,18610,17774,18338,16970,20059,18903,17295,17585,
+18345,18617,17874,20303,20305,7811,14097,8410,8421,7746,14290,8481,
+8497,8499,20307,8548,8571,8583,8587,8590,8599,8610,8622,8630,
+18760,8633,8636,8664,8671,8687,8702,8715,13382,13360,13389,13385,
+13338,13378,7651,13366,13333,13384,13387,13361,16837,13326,13328,13363,
+13369,13381,13334,13352,13375,13327,7700,13332,13347,15398,7732,13379,
+13348,13345,13335,13391,13359,13351,13325,13371,13343,13373,13358,13399,
+18366,13376,13353,14199,14198,13367,13331,13346,13321,13339,13380,13364,
+15403,13320,13374,13337,7788,642,8007,716,712,715,717,8006,
+718,692,636,693,637,663,699,697,700,641,719,678,
+664,679,648,650,646,680,667,681,665,751,649,8005,
+711,
+};
+
+static pdf_cmap cmap_UniJIS_UTF16_H = {
+	-1, "UniJIS-UTF16-H", "", 0, 0, 3,
+	{ {2,0,55295},{4,56320,57343},{2,57344,65535}, },
+	5727, 5727, (pdf_range*) cmap_UniJIS_UTF16_H_ranges,
+	10909, 10909, (unsigned short*) cmap_UniJIS_UTF16_H_table,
+};
+
+/* UniJIS-UTF16-V */
+
+static const pdf_range cmap_UniJIS_UTF16_V_ranges[] = {
+{176,0,8269},{8208,0,7893},{8213,6,0},{8229,6,2},
+{8242,6,4},{8592,14,6},{8644,10,10},{8678,14,13},
+{9115,74,17},{9136,5,16350},{9472,5,7481},{9474,5,7479},
+{9476,5,7485},{9478,5,7483},{9480,5,7489},{9482,5,7487},
+{9484,90,36},{9507,5,7530},{9509,30,59},{9517,9,7517},
+{9520,0,7516},{9521,9,7520},{9524,0,7507},{9525,9,7509},
+{9528,0,7508},{9529,9,7512},{9533,9,7543},{9536,34,67},
+{9545,5,7550},{9756,14,76},{9986,0,12178},{10145,0,8209},
+{12289,5,7887},{12296,37,7907},{12308,5,7901},{12310,5,16329},
+{12312,5,12139},{12316,6,80},{12319,0,7957},{12353,0,7918},
+{12355,0,7919},{12357,0,7920},{12359,0,7921},{12361,0,7922},
+{12387,0,7923},{12419,0,7924},{12421,0,7925},{12423,0,7926},
+{12430,0,7927},{12437,5,8264},{12443,6,82},{12448,6,84},
+{12451,0,7929},{12453,0,7930},{12455,0,7931},{12457,0,7932},
+{12483,0,7933},{12515,0,7934},{12517,0,7935},{12519,0,7936},
+{12526,0,7937},{12533,5,7938},{12540,0,7891},{12784,37,16333},
+{12794,21,16344},{13056,0,8350},{13057,5,11958},{13059,42,86},
+{13070,21,11973},{13076,22,97},{13082,13,11984},{13086,0,8353},
+{13087,9,11988},{13090,22,103},{13096,5,11996},{13098,6,109},
+{13101,0,11999},{13102,9,12002},{13105,10,111},{13108,5,12008},
+{13110,30,114},{13118,9,12020},{13121,6,122},{13123,13,12023},
+{13127,14,124},{13131,5,12028},{13133,6,128},{13135,5,12030},
+{13137,14,130},{13141,5,12039},{13143,0,8344},{13183,0,8324},
+{65288,5,7899},{65292,0,8268},{65294,0,8274},{65309,0,7917},
+{65339,0,7903},{65341,0,7904},{65343,0,7890},{65371,14,134},
+{65375,5,12141},{65507,0,7889},
+};
+
+static const unsigned short cmap_UniJIS_UTF16_V_table[138] = {
+7892,7895,7898,7897,8273,8283,738,736,739,737,8311,8310,
+8312,8012,8014,8011,8013,12148,12168,12147,12150,12168,12149,12156,
+12168,12155,12158,12168,12157,8168,8167,8166,12168,8172,8171,8170,
+7495,7497,7496,7498,7503,7505,7504,7506,7491,7493,7492,7494,
+7499,7501,7500,7502,7523,7527,7525,7524,7526,7529,7528,7535,
+7533,7532,7534,7537,7536,7538,7515,7541,7540,7542,7547,7549,
+7546,7548,7553,7552,8221,8219,8222,8220,7894,7956,8272,8271,
+16331,7928,8338,11960,8333,11961,11965,11963,11968,11966,11970,11972,
+7950,7941,8340,8330,11980,8339,11982,8329,8348,11991,11993,7951,
+7945,8356,7953,8358,12005,8334,7947,12014,12016,8343,12017,8349,
+12010,12018,12019,8347,8357,12027,7940,7954,7943,8337,7948,12034,
+12038,12035,7905,7896,7906,7894,
+};
+
+static pdf_cmap cmap_UniJIS_UTF16_V = {
+	-1, "UniJIS-UTF16-V", "UniJIS-UTF16-H", 0, 1, 0,
+	{ {0,0,0}, },
+	102, 102, (pdf_range*) cmap_UniJIS_UTF16_V_ranges,
+	138, 138, (unsigned short*) cmap_UniJIS_UTF16_V_table,
+};
+
+/* UniJISPro-UCS2-HW-V */
+
+static const pdf_range cmap_UniJISPro_UCS2_HW_V_ranges[] = {
+{32,237,231},{92,0,8719},{93,133,292},{165,0,291},
+{176,0,8269},{8208,0,7893},{8213,6,0},{8216,5,12173},
+{8220,5,7956},{8229,6,2},{8242,6,4},{8592,14,6},
+{8597,0,12214},{8644,10,10},{8678,14,13},{8741,0,7895},
+{8764,0,7894},{8943,0,7897},{9472,5,7481},{9474,5,7479},
+{9476,5,7485},{9478,5,7483},{9480,5,7489},{9482,5,7487},
+{9484,90,17},{9507,5,7530},{9509,30,40},{9517,9,7517},
+{9520,0,7516},{9521,9,7520},{9524,0,7507},{9525,9,7509},
+{9528,0,7508},{9529,9,7512},{9533,9,7543},{9536,34,48},
+{9545,5,7550},{9756,14,57},{9986,0,12178},{10145,0,8209},
+{12289,5,7887},{12296,37,7907},{12307,0,8270},{12308,5,7901},
+{12316,6,61},{12319,0,7957},{12353,0,7918},{12355,0,7919},
+{12357,0,7920},{12359,0,7921},{12361,0,7922},{12387,0,7923},
+{12419,0,7924},{12421,0,7925},{12423,0,7926},{12430,0,7927},
+{12443,6,63},{12449,0,7928},{12451,0,7929},{12453,0,7930},
+{12455,0,7931},{12457,0,7932},{12483,0,7933},{12515,0,7934},
+{12517,0,7935},{12519,0,7936},{12526,0,7937},{12533,5,7938},
+{12540,0,7891},{13056,0,8350},{13057,5,11958},{13059,42,65},
+{13070,21,11973},{13076,22,76},{13082,13,11984},{13086,0,8353},
+{13087,9,11988},{13090,22,82},{13096,5,11996},{13098,6,88},
+{13101,0,11999},{13102,9,12002},{13105,10,90},{13108,5,12008},
+{13110,30,93},{13118,9,12020},{13121,6,101},{13123,13,12023},
+{13127,14,103},{13131,5,12028},{13133,6,107},{13135,5,12030},
+{13137,14,109},{13141,5,12039},{13143,0,8344},{13179,18,113},
+{65288,5,7899},{65292,0,8268},{65294,0,8274},{65306,0,12101},
+{65309,0,7917},{65339,0,7903},{65341,0,7904},{65343,0,7890},
+{65371,14,118},{65507,0,7889},
+};
+
+static const unsigned short cmap_UniJISPro_UCS2_HW_V_table[122] = {
+7892,7895,7898,7897,8273,8283,738,736,739,737,8311,8310,
+8312,8012,8014,8011,8013,7495,7497,7496,7498,7503,7505,7504,
+7506,7491,7493,7492,7494,7499,7501,7500,7502,7523,7527,7525,
+7524,7526,7529,7528,7535,7533,7532,7534,7537,7536,7538,7515,
+7541,7540,7542,7547,7549,7546,7548,7553,7552,8221,8219,8222,
+8220,7894,7956,8272,8271,8338,11960,8333,11961,11965,11963,11968,
+11966,11970,11972,7950,7941,8340,8330,11980,8339,11982,8329,8348,
+11991,11993,7951,7945,8356,7953,8358,12005,8334,7947,12014,12016,
+8343,12017,8349,12010,12018,12019,8347,8357,12027,7940,7954,7943,
+8337,7948,12034,12038,12035,12044,12043,12042,12041,8324,7905,7896,
+7906,7894,
+};
+
+static pdf_cmap cmap_UniJISPro_UCS2_HW_V = {
+	-1, "UniJISPro-UCS2-HW-V", "UniJIS-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	106, 106, (pdf_range*) cmap_UniJISPro_UCS2_HW_V_ranges,
+	122, 122, (unsigned short*) cmap_UniJISPro_UCS2_HW_V_table,
+};
+
+/* UniJISPro-UCS2-V */
+
+static const pdf_range cmap_UniJISPro_UCS2_V_ranges[] = {
+{176,0,8269},{8208,0,7893},{8213,6,0},{8216,5,12173},
+{8220,5,7956},{8229,6,2},{8242,6,4},{8592,14,6},
+{8597,0,12214},{8644,10,10},{8678,14,13},{8741,0,7895},
+{8764,0,7894},{8943,0,7897},{9472,5,7481},{9474,5,7479},
+{9476,5,7485},{9478,5,7483},{9480,5,7489},{9482,5,7487},
+{9484,90,17},{9507,5,7530},{9509,30,40},{9517,9,7517},
+{9520,0,7516},{9521,9,7520},{9524,0,7507},{9525,9,7509},
+{9528,0,7508},{9529,9,7512},{9533,9,7543},{9536,34,48},
+{9545,5,7550},{9756,14,57},{9986,0,12178},{10145,0,8209},
+{12289,5,7887},{12296,37,7907},{12307,0,8270},{12308,5,7901},
+{12316,6,61},{12319,0,7957},{12353,0,7918},{12355,0,7919},
+{12357,0,7920},{12359,0,7921},{12361,0,7922},{12387,0,7923},
+{12419,0,7924},{12421,0,7925},{12423,0,7926},{12430,0,7927},
+{12443,6,63},{12449,0,7928},{12451,0,7929},{12453,0,7930},
+{12455,0,7931},{12457,0,7932},{12483,0,7933},{12515,0,7934},
+{12517,0,7935},{12519,0,7936},{12526,0,7937},{12533,5,7938},
+{12540,0,7891},{13056,0,8350},{13057,5,11958},{13059,42,65},
+{13070,21,11973},{13076,22,76},{13082,13,11984},{13086,0,8353},
+{13087,9,11988},{13090,22,82},{13096,5,11996},{13098,6,88},
+{13101,0,11999},{13102,9,12002},{13105,10,90},{13108,5,12008},
+{13110,30,93},{13118,9,12020},{13121,6,101},{13123,13,12023},
+{13127,14,103},{13131,5,12028},{13133,6,107},{13135,5,12030},
+{13137,14,109},{13141,5,12039},{13143,0,8344},{13179,18,113},
+{65288,5,7899},{65292,0,8268},{65294,0,8274},{65306,0,12101},
+{65309,0,7917},{65339,0,7903},{65341,0,7904},{65343,0,7890},
+{65371,14,118},{65507,0,7889},
+};
+
+static const unsigned short cmap_UniJISPro_UCS2_V_table[122] = {
+7892,7895,7898,7897,8273,8283,738,736,739,737,8311,8310,
+8312,8012,8014,8011,8013,7495,7497,7496,7498,7503,7505,7504,
+7506,7491,7493,7492,7494,7499,7501,7500,7502,7523,7527,7525,
+7524,7526,7529,7528,7535,7533,7532,7534,7537,7536,7538,7515,
+7541,7540,7542,7547,7549,7546,7548,7553,7552,8221,8219,8222,
+8220,7894,7956,8272,8271,8338,11960,8333,11961,11965,11963,11968,
+11966,11970,11972,7950,7941,8340,8330,11980,8339,11982,8329,8348,
+11991,11993,7951,7945,8356,7953,8358,12005,8334,7947,12014,12016,
+8343,12017,8349,12010,12018,12019,8347,8357,12027,7940,7954,7943,
+8337,7948,12034,12038,12035,12044,12043,12042,12041,8324,7905,7896,
+7906,7894,
+};
+
+static pdf_cmap cmap_UniJISPro_UCS2_V = {
+	-1, "UniJISPro-UCS2-V", "UniJIS-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	102, 102, (pdf_range*) cmap_UniJISPro_UCS2_V_ranges,
+	122, 122, (unsigned short*) cmap_UniJISPro_UCS2_V_table,
+};
+
+/* V */
+
+static const pdf_range cmap_V_ranges[] = {
+{8482,5,7887},{8497,5,7889},{8508,9,7891},{8513,17,7894},
+{8522,69,7899},{8545,0,7917},{9249,0,7918},{9251,0,7919},
+{9253,0,7920},{9255,0,7921},{9257,0,7922},{9283,0,7923},
+{9315,0,7924},{9317,0,7925},{9319,0,7926},{9326,0,7927},
+{9505,0,7928},{9507,0,7929},{9509,0,7930},{9511,0,7931},
+{9513,0,7932},{9539,0,7933},{9571,0,7934},{9573,0,7935},
+{9575,0,7936},{9582,0,7937},{9589,5,7938},
+};
+
+static const unsigned short cmap_V_table[] = { 0 };
+
+static pdf_cmap cmap_V = {
+	-1, "V", "H", 0, 1, 0,
+	{ {0,0,0}, },
+	27, 27, (pdf_range*) cmap_V_ranges,
+	0, 0, (unsigned short*) cmap_V_table,
+};
+
+/* WP-Symbol */
+
+static const pdf_range cmap_WP_Symbol_ranges[] = {
+{1,14,0},{5,77,8061},{25,37,8092},{35,0,8186},
+{36,5,8020},{38,0,8187},{39,5,8022},{41,6,4},
+{43,9,8024},{46,5,8189},{48,5,8192},{50,5,7899},
+{52,10,6},{55,9,8027},{58,0,8195},{59,101,8112},
+{85,33,8197},{94,0,8151},{97,65,8206},{114,0,8057},
+{115,17,8223},
+};
+
+static const unsigned short cmap_WP_Symbol_table[9] = {
+8056,8058,8191,8196,8188,8037,7894,8194,8035,
+};
+
+static pdf_cmap cmap_WP_Symbol = {
+	-1, "WP-Symbol", "", 0, 0, 1,
+	{ {1,0,255}, },
+	21, 21, (pdf_range*) cmap_WP_Symbol_ranges,
+	9, 9, (unsigned short*) cmap_WP_Symbol_table,
+};
@@ -0,0 +1,7144 @@
+/* This is an automatically generated file. Do not edit. */
+
+/* Adobe-Korea1-0 */
+
+static const pdf_range cmap_Adobe_Korea1_0_ranges[] = {
+{0,37329,0},
+};
+
+static const unsigned short cmap_Adobe_Korea1_0_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Korea1_0 = {
+	-1, "Adobe-Korea1-0", "", 0, 0, 1,
+	{ {2,0,9471}, },
+	1, 1, (pdf_range*) cmap_Adobe_Korea1_0_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Korea1_0_table,
+};
+
+/* Adobe-Korea1-1 */
+
+static const pdf_range cmap_Adobe_Korea1_1_ranges[] = {
+{0,65533,0},{16384,7081,16384},
+};
+
+static const unsigned short cmap_Adobe_Korea1_1_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Korea1_1 = {
+	-1, "Adobe-Korea1-1", "", 0, 0, 1,
+	{ {2,0,18175}, },
+	2, 2, (pdf_range*) cmap_Adobe_Korea1_1_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Korea1_1_table,
+};
+
+/* Adobe-Korea1-2 */
+
+static const pdf_range cmap_Adobe_Korea1_2_ranges[] = {
+{0,65533,0},{16384,7869,16384},
+};
+
+static const unsigned short cmap_Adobe_Korea1_2_table[] = { 0 };
+
+static pdf_cmap cmap_Adobe_Korea1_2 = {
+	-1, "Adobe-Korea1-2", "", 0, 0, 1,
+	{ {2,0,18431}, },
+	2, 2, (pdf_range*) cmap_Adobe_Korea1_2_ranges,
+	0, 0, (unsigned short*) cmap_Adobe_Korea1_2_table,
+};
+
+/* Adobe-Korea1-UCS2 */
+
+static const pdf_range cmap_Adobe_Korea1_UCS2_ranges[] = {
+{0,0,65533},{1,377,32},{96,18,1848},{101,9,12288},
+{104,0,183},{105,5,8229},{107,6,1853},{109,5,8211},
+{111,10,1855},{114,5,8216},{116,5,8220},{118,5,12308},
+{120,37,12296},{130,14,1858},{134,5,8804},{136,10,1862},
+{139,5,8242},{141,6,1865},{143,5,65504},{145,102,1867},
+{171,5,8592},{173,5,8595},{175,0,12307},{176,5,8810},
+{178,14,1893},{182,5,8747},{184,6,1897},{186,5,8838},
+{188,5,8834},{190,6,1899},{192,5,8743},{194,110,1901},
+{222,5,9824},{224,22,1929},{230,5,9680},{232,0,9618},
+{233,5,9636},{235,38,1935},{245,5,8224},{247,22,1945},
+{253,5,9833},{255,34,1951},{264,233,65281},{323,0,65510},
+{324,129,65341},{357,0,65507},{358,201,12593},{409,165,12645},
+{451,37,8560},{461,37,8544},{471,65,913},{488,25,931},
+{495,65,945},{512,25,963},{519,158,1960},{559,5,9502},
+{561,5,9505},{563,5,9510},{565,5,9513},{567,5,9517},
+{569,5,9521},{571,5,9525},{573,5,9529},{575,5,9533},
+{577,5,9536},{579,29,9539},{587,9,13205},{590,10,2000},
+{593,13,13219},{597,37,13209},{607,0,13258},{608,9,13197},
+{611,0,13263},{612,5,13192},{614,0,13256},{615,5,13223},
+{617,37,13232},{627,17,13184},{632,21,13242},{638,17,13200},
+{643,0,8486},{644,5,13248},{646,9,13194},{649,6,2003},
+{651,9,13229},{654,0,13275},{655,13,13225},{659,78,2005},
+{679,109,12896},{707,101,9424},{733,57,9312},{748,0,189},
+{749,5,8531},{751,6,2025},{753,13,8539},{757,62,2027},
+{773,109,12800},{801,101,9372},{827,57,9332},{842,0,185},
+{843,5,178},{845,6,2043},{847,13,8321},{851,329,12353},
+{934,341,12449},{1020,21,1040},{1026,0,1025},{1027,125,1046},
+{1059,0,1105},{1060,101,1078},{1086,5,44032},{1088,0,44036},
+{1089,13,44039},{1093,29,44048},{1101,17,44057},{1106,6,2045},
+{1108,5,44076},{1110,9,44079},{1113,5,44088},{1115,26,2047},
+{1122,5,44144},{1124,0,44148},{1125,5,44151},{1127,0,44154},
+{1128,5,44160},{1130,13,44163},{1134,13,44169},{1138,6,2054},
+{1140,5,44188},{1142,9,44191},{1145,9,44200},{1148,0,44204},
+{1149,5,44207},{1151,5,44216},{1153,9,44219},{1156,22,2056},
+{1162,5,44256},{1164,0,44260},{1165,5,44263},{1167,6,2062},
+{1169,9,44271},{1172,0,44275},{1173,5,44277},{1175,5,44284},
+{1177,10,2064},{1180,5,44300},{1182,22,2067},{1188,5,44332},
+{1190,5,44340},{1192,6,2073},{1194,5,44356},{1196,26,2075},
+{1203,5,44396},{1205,0,44400},{1206,13,44403},{1210,9,44411},
+{1213,0,44415},{1214,5,44417},{1216,5,44424},{1218,6,2082},
+{1220,5,44444},{1222,6,2084},{1224,5,44480},{1226,6,2086},
+{1228,5,44496},{1230,14,2088},{1234,5,44536},{1236,0,44540},
+{1237,9,44543},{1240,5,44552},{1242,10,2092},{1245,5,44592},
+{1247,0,44596},{1248,5,44599},{1250,0,44602},{1251,5,44608},
+{1253,0,44611},{1254,5,44613},{1256,0,44618},{1257,9,44620},
+{1260,10,2095},{1263,5,44636},{1265,9,44639},{1268,0,44645},
+{1269,5,44648},{1271,6,2098},{1273,5,44664},{1275,9,44667},
+{1278,5,44676},{1280,0,44684},{1281,9,44732},{1284,6,2100},
+{1286,5,44748},{1288,9,44751},{1291,5,44760},{1293,26,2102},
+{1300,5,44807},{1302,6,2109},{1304,5,44844},{1306,10,2111},
+{1309,5,44860},{1311,0,44863},{1312,9,44865},{1315,5,44872},
+{1317,0,44880},{1318,5,44892},{1320,5,44900},{1322,14,2114},
+{1326,5,44944},{1328,6,2118},{1330,5,44984},{1332,6,2120},
+{1334,9,44999},{1337,0,45003},{1338,5,45005},{1340,6,2122},
+{1342,5,45032},{1344,5,45040},{1346,6,2124},{1348,5,45056},
+{1350,14,2126},{1354,5,45084},{1356,0,45096},{1357,5,45124},
+{1359,14,2130},{1363,9,45139},{1366,10,2134},{1369,5,45180},
+{1371,6,2137},{1373,5,45196},{1375,6,2139},{1377,9,45208},
+{1380,0,45212},{1381,13,45215},{1385,5,45224},{1387,17,45227},
+{1392,0,45233},{1393,9,45235},{1396,6,2141},{1398,5,45252},
+{1400,9,45255},{1403,5,45264},{1405,14,2143},{1409,5,45320},
+{1411,5,45323},{1413,0,45328},{1414,5,45330},{1416,5,45336},
+{1418,9,45339},{1421,9,45347},{1424,6,2147},{1426,5,45364},
+{1428,9,45367},{1431,5,45376},{1433,6,2149},{1435,5,45392},
+{1437,5,45396},{1439,10,2151},{1442,5,45432},{1444,10,2154},
+{1447,5,45448},{1449,6,2157},{1451,9,45458},{1454,22,2159},
+{1460,5,45532},{1462,0,45535},{1463,5,45544},{1465,18,2165},
+{1470,5,45572},{1472,0,45576},{1473,5,45579},{1475,5,45588},
+{1477,30,2170},{1485,5,45672},{1487,5,45684},{1489,0,45692},
+{1490,5,45700},{1492,0,45705},{1493,5,45712},{1495,0,45716},
+{1496,9,45720},{1499,5,45728},{1501,0,45731},{1502,5,45733},
+{1504,14,2178},{1508,5,45768},{1510,10,2182},{1513,5,45784},
+{1515,10,2185},{1518,9,45796},{1521,0,45800},{1522,17,45803},
+{1527,9,45811},{1530,17,45815},{1535,9,45823},{1538,6,2188},
+{1540,5,45840},{1542,9,45843},{1545,0,45852},{1546,9,45908},
+{1549,0,45912},{1550,5,45915},{1552,5,45918},{1554,5,45924},
+{1556,14,2190},{1560,5,45936},{1562,6,2194},{1564,5,45952},
+{1566,9,45955},{1569,10,2196},{1572,5,45984},{1574,6,2199},
+{1576,5,46020},{1578,0,46024},{1579,5,46027},{1581,6,2201},
+{1583,5,46036},{1585,46,2203},{1597,5,46120},{1599,6,2215},
+{1601,5,46160},{1603,6,2217},{1605,5,46176},{1607,66,2219},
+{1624,5,46300},{1626,0,46304},{1627,5,46307},{1629,0,46310},
+{1630,5,46316},{1632,10,2236},{1635,5,46356},{1637,0,46360},
+{1638,5,46363},{1640,5,46372},{1642,13,46375},{1646,5,46384},
+{1648,6,2239},{1650,5,46400},{1652,9,46403},{1655,9,46411},
+{1658,6,2241},{1660,5,46428},{1662,9,46431},{1665,5,46496},
+{1667,6,2243},{1669,5,46506},{1671,5,46512},{1673,9,46515},
+{1676,9,46523},{1679,6,2245},{1681,5,46540},{1683,9,46543},
+{1686,6,2247},{1688,5,46608},{1690,30,2249},{1698,5,46748},
+{1700,6,2257},{1702,5,46763},{1704,18,2259},{1709,5,46848},
+{1711,0,46853},{1712,5,46888},{1714,0,46892},{1715,5,46895},
+{1717,5,46904},{1719,14,2264},{1723,5,46932},{1725,10,2268},
+{1728,5,46960},{1730,6,2271},{1732,5,46972},{1734,6,2273},
+{1736,5,46988},{1738,13,46991},{1742,13,46998},{1746,6,2275},
+{1748,5,47016},{1750,9,47019},{1753,5,47028},{1755,10,2277},
+{1758,5,47084},{1760,6,2280},{1762,5,47100},{1764,9,47103},
+{1767,9,47111},{1770,6,2282},{1772,5,47128},{1774,6,2284},
+{1776,5,47140},{1778,6,2286},{1780,5,47156},{1782,9,47159},
+{1785,14,2288},{1789,5,47196},{1791,6,2292},{1793,5,47212},
+{1795,34,2294},{1804,5,47296},{1806,30,2303},{1814,5,47336},
+{1816,6,2311},{1818,5,47352},{1820,18,2313},{1825,5,47420},
+{1827,18,2318},{1832,5,47448},{1834,6,2323},{1836,5,47464},
+{1838,6,2325},{1840,5,47476},{1842,6,2327},{1844,5,47492},
+{1846,0,47495},{1847,5,47497},{1849,5,47501},{1851,5,47532},
+{1853,6,2329},{1855,5,47548},{1857,6,2331},{1859,5,47560},
+{1861,0,47564},{1862,17,47566},{1867,5,47576},{1869,0,47579},
+{1870,5,47581},{1872,0,47585},{1873,9,47587},{1876,6,2333},
+{1878,5,47604},{1880,13,47607},{1884,5,47616},{1886,6,2335},
+{1888,5,47672},{1890,10,2337},{1893,5,47688},{1895,0,47691},
+{1896,5,47693},{1898,9,47699},{1901,6,2340},{1903,5,47716},
+{1905,9,47719},{1908,5,47728},{1910,6,2342},{1912,9,47747},
+{1915,6,2344},{1917,5,47784},{1919,5,47787},{1921,6,2346},
+{1923,5,47800},{1925,14,2348},{1929,5,47832},{1931,42,2352},
+{1942,9,47924},{1945,0,47928},{1946,13,47931},{1950,5,47940},
+{1952,10,2363},{1955,5,47951},{1957,70,2366},{1975,5,48120},
+{1977,0,48124},{1978,5,48127},{1980,0,48130},{1981,5,48136},
+{1983,9,48139},{1986,6,2384},{1988,17,48148},{1993,17,48155},
+{1998,5,48164},{2000,10,2386},{2003,5,48176},{2005,6,2389},
+{2007,5,48192},{2009,9,48195},{2012,0,48201},{2013,5,48204},
+{2015,6,2391},{2017,5,48260},{2019,0,48264},{2020,5,48267},
+{2022,0,48270},{2023,5,48276},{2025,0,48279},{2026,5,48281},
+{2028,5,48288},{2030,0,48292},{2031,5,48295},{2033,5,48304},
+{2035,9,48307},{2038,5,48316},{2040,10,2393},{2043,9,48335},
+{2046,10,2396},{2049,9,48372},{2052,6,2399},{2054,5,48388},
+{2056,26,2401},{2063,5,48456},{2065,6,2408},{2067,5,48472},
+{2069,6,2410},{2071,5,48512},{2073,0,48516},{2074,13,48519},
+{2078,5,48528},{2080,6,2412},{2082,5,48537},{2084,14,2414},
+{2088,5,48596},{2090,34,2418},{2099,5,48652},{2101,6,2427},
+{2103,5,48668},{2105,0,48671},{2106,5,48708},{2108,10,2429},
+{2111,5,48724},{2113,0,48727},{2114,9,48729},{2117,5,48736},
+{2119,10,2432},{2122,5,48752},{2124,9,48755},{2127,9,48763},
+{2130,6,2435},{2132,5,48780},{2134,9,48783},{2137,5,48792},
+{2139,0,48808},{2140,5,48848},{2142,0,48852},{2143,5,48855},
+{2145,0,48864},{2146,9,48867},{2149,6,2437},{2151,5,48904},
+{2153,5,48920},{2155,9,48923},{2158,5,48960},{2160,6,2439},
+{2162,5,48976},{2164,14,2441},{2168,5,49100},{2170,38,2445},
+{2180,5,49256},{2182,5,49296},{2184,6,2455},{2186,5,49312},
+{2188,6,2457},{2190,5,49324},{2192,5,49327},{2194,13,49331},
+{2198,5,49340},{2200,9,49343},{2203,0,49349},{2204,5,49352},
+{2206,6,2459},{2208,5,49368},{2210,9,49371},{2213,5,49380},
+{2215,6,2461},{2217,5,49396},{2219,26,2463},{2226,17,49436},
+{2231,5,49443},{2233,5,49446},{2235,5,49452},{2237,9,49455},
+{2240,0,49462},{2241,5,49464},{2243,6,2470},{2245,5,49480},
+{2247,9,49483},{2250,5,49492},{2252,6,2472},{2254,5,49508},
+{2256,9,49511},{2259,14,2474},{2263,9,49548},{2266,10,2478},
+{2269,5,49564},{2271,10,2481},{2274,5,49576},{2276,26,2484},
+{2283,5,49623},{2285,10,2491},{2288,5,49648},{2290,0,49651},
+{2291,5,49660},{2293,6,2494},{2295,5,49676},{2297,6,2496},
+{2299,5,49688},{2301,0,49692},{2302,5,49695},{2304,5,49704},
+{2306,10,2498},{2309,5,49713},{2311,6,2501},{2313,5,49744},
+{2315,14,2503},{2319,5,49772},{2321,6,2507},{2323,5,49788},
+{2325,6,2509},{2327,5,49800},{2329,14,2511},{2333,5,49828},
+{2335,0,49832},{2336,5,49836},{2338,5,49844},{2340,6,2515},
+{2342,5,49884},{2344,0,49888},{2345,5,49891},{2347,9,49899},
+{2350,10,2517},{2353,5,49912},{2355,5,49915},{2357,0,49920},
+{2358,5,49928},{2360,5,49932},{2362,9,49939},{2365,6,2520},
+{2367,5,49956},{2369,5,49960},{2371,0,49989},{2372,5,50024},
+{2374,10,2522},{2377,5,50040},{2379,5,50044},{2381,14,2525},
+{2385,5,50136},{2387,0,50140},{2388,5,50143},{2390,0,50146},
+{2391,5,50152},{2393,0,50157},{2394,5,50164},{2396,26,2529},
+{2403,5,50236},{2405,0,50248},{2406,5,50276},{2408,6,2536},
+{2410,5,50292},{2412,26,2538},{2419,5,50416},{2421,10,2545},
+{2424,9,50431},{2427,14,2548},{2431,5,50472},{2433,6,2552},
+{2435,5,50488},{2437,6,2554},{2439,5,50500},{2441,9,50504},
+{2444,9,50508},{2447,9,50515},{2450,9,50519},{2453,5,50525},
+{2455,5,50528},{2457,6,2556},{2459,5,50544},{2461,9,50547},
+{2464,5,50556},{2466,10,2558},{2469,5,50572},{2471,10,2561},
+{2474,5,50583},{2476,10,2564},{2479,5,50612},{2481,5,50616},
+{2483,13,50619},{2487,25,50628},{2494,6,2567},{2496,5,50640},
+{2498,6,2569},{2500,5,50656},{2502,6,2571},{2504,9,50668},
+{2507,6,2573},{2509,5,50678},{2511,21,50684},{2517,13,50693},
+{2521,6,2575},{2523,5,50712},{2525,5,50715},{2527,5,50724},
+{2529,0,50728},{2530,9,50732},{2533,0,50736},{2534,9,50739},
+{2537,10,2577},{2540,5,50752},{2542,6,2580},{2544,5,50768},
+{2546,9,50771},{2549,5,50780},{2551,14,2582},{2555,5,50808},
+{2557,22,2586},{2563,5,50836},{2565,6,2592},{2567,5,50852},
+{2569,6,2594},{2571,5,50864},{2573,0,50868},{2574,9,50872},
+{2577,5,50880},{2579,6,2596},{2581,5,50892},{2583,6,2598},
+{2585,5,50908},{2587,5,50912},{2589,5,50920},{2591,6,2600},
+{2593,5,50936},{2595,0,50941},{2596,5,50948},{2598,6,2602},
+{2600,5,50964},{2602,6,2604},{2604,5,50976},{2606,6,2606},
+{2608,5,50992},{2610,10,2608},{2613,5,51004},{2615,10,2611},
+{2618,5,51020},{2620,0,51023},{2621,29,51025},{2629,14,2614},
+{2633,5,51060},{2635,0,51064},{2636,9,51068},{2639,9,51075},
+{2642,13,51079},{2646,0,51086},{2647,5,51088},{2649,0,51092},
+{2650,9,51094},{2653,0,51098},{2654,5,51104},{2656,13,51107},
+{2660,5,51116},{2662,6,2618},{2664,5,51132},{2666,9,51135},
+{2669,5,51144},{2671,30,2620},{2679,5,51200},{2681,10,2628},
+{2684,5,51216},{2686,0,51219},{2687,5,51221},{2689,5,51228},
+{2691,6,2631},{2693,5,51244},{2695,18,2633},{2700,5,51272},
+{2702,5,51276},{2704,0,51284},{2705,5,51312},{2707,10,2638},
+{2710,5,51328},{2712,0,51331},{2713,9,51333},{2716,9,51339},
+{2719,18,2641},{2724,5,51388},{2726,10,2646},{2729,5,51412},
+{2731,6,2649},{2733,5,51424},{2735,6,2651},{2737,5,51452},
+{2739,0,51456},{2740,9,51460},{2743,5,51468},{2745,18,2653},
+{2750,5,51536},{2752,6,2658},{2754,5,51552},{2756,18,2660},
+{2761,5,51592},{2763,6,2665},{2765,5,51608},{2767,6,2667},
+{2769,5,51648},{2771,0,51652},{2772,5,51655},{2774,0,51658},
+{2775,5,51664},{2777,0,51667},{2778,5,51669},{2780,5,51673},
+{2782,5,51676},{2784,14,2669},{2788,5,51692},{2790,9,51695},
+{2793,5,51704},{2795,6,2673},{2797,5,51720},{2799,9,51723},
+{2802,10,2675},{2805,5,51788},{2807,6,2678},{2809,5,51804},
+{2811,9,51807},{2814,14,2680},{2818,5,51900},{2820,6,2684},
+{2822,5,51916},{2824,10,2686},{2827,5,51928},{2829,26,2689},
+{2836,5,52000},{2838,0,52033},{2839,5,52040},{2841,6,2696},
+{2843,5,52056},{2845,6,2698},{2847,5,52088},{2849,22,2700},
+{2855,5,52236},{2857,6,2706},{2859,5,52252},{2861,5,52257},
+{2863,9,52263},{2866,10,2708},{2869,5,52280},{2871,13,52283},
+{2875,5,52292},{2877,6,2711},{2879,5,52308},{2881,9,52311},
+{2884,22,2713},{2890,5,52376},{2892,6,2719},{2894,5,52392},
+{2896,9,52395},{2899,5,52404},{2901,6,2721},{2903,5,52420},
+{2905,30,2723},{2913,5,52488},{2915,6,2731},{2917,5,52504},
+{2919,34,2733},{2928,5,52588},{2930,14,2742},{2934,5,52628},
+{2936,6,2746},{2938,5,52644},{2940,34,2748},{2949,5,52728},
+{2951,26,2757},{2958,5,52768},{2960,6,2764},{2962,5,52784},
+{2964,6,2766},{2966,5,52824},{2968,0,52828},{2969,9,52831},
+{2972,5,52840},{2974,6,2768},{2976,5,52852},{2978,6,2770},
+{2980,5,52868},{2982,6,2772},{2984,5,52880},{2986,6,2774},
+{2988,5,52896},{2990,9,52899},{2993,5,52908},{2995,0,52929},
+{2996,5,52964},{2998,0,52968},{2999,5,52971},{3001,5,52980},
+{3003,9,52983},{3006,5,52992},{3008,6,2776},{3010,5,53008},
+{3012,18,2778},{3017,5,53036},{3019,9,53039},{3022,0,53048},
+{3023,5,53076},{3025,6,2783},{3027,5,53092},{3029,6,2785},
+{3031,5,53104},{3033,34,2787},{3042,5,53216},{3044,6,2796},
+{3046,5,53232},{3048,30,2798},{3056,5,53300},{3058,6,2806},
+{3060,5,53316},{3062,22,2808},{3068,5,53356},{3070,6,2814},
+{3072,5,53372},{3074,0,53377},{3075,5,53412},{3077,6,2816},
+{3079,5,53428},{3081,6,2818},{3083,5,53440},{3085,0,53444},
+{3086,5,53448},{3088,5,53456},{3090,9,53459},{3093,5,53468},
+{3095,6,2820},{3097,5,53484},{3099,9,53487},{3102,6,2822},
+{3104,5,53552},{3106,10,2824},{3109,5,53568},{3111,9,53571},
+{3114,5,53580},{3116,6,2827},{3118,5,53596},{3120,26,2829},
+{3127,5,53664},{3129,6,2836},{3131,5,53680},{3133,42,2838},
+{3144,5,53804},{3146,6,2849},{3148,5,53820},{3150,18,2851},
+{3155,5,53888},{3157,6,2856},{3159,5,53904},{3161,22,2858},
+{3167,5,53944},{3169,0,53948},{3170,5,53951},{3172,0,53954},
+{3173,5,53960},{3175,14,2864},{3179,5,53988},{3181,5,54000},
+{3183,6,2868},{3185,5,54016},{3187,6,2870},{3189,9,54028},
+{3192,10,2872},{3195,5,54044},{3197,9,54047},{3200,0,54053},
+{3201,5,54056},{3203,6,2875},{3205,5,54072},{3207,9,54075},
+{3210,5,54084},{3212,5,54140},{3214,6,2877},{3216,5,54156},
+{3218,9,54159},{3221,5,54168},{3223,6,2879},{3225,5,54184},
+{3227,18,2881},{3232,5,54212},{3234,5,54216},{3236,14,2886},
+{3240,5,54252},{3242,6,2890},{3244,5,54268},{3246,42,2892},
+{3257,5,54392},{3259,0,54396},{3260,5,54399},{3262,0,54402},
+{3263,5,54408},{3265,70,2903},{3283,5,54548},{3285,0,54551},
+{3286,5,54588},{3288,6,2921},{3290,5,54604},{3292,6,2923},
+{3294,5,54616},{3296,10,2925},{3299,5,54632},{3301,6,2928},
+{3303,5,54644},{3305,6,2930},{3307,5,54660},{3309,9,54663},
+{3312,6,2932},{3314,5,54728},{3316,10,2934},{3319,5,54744},
+{3321,6,2937},{3323,5,54756},{3325,22,2939},{3331,5,54784},
+{3333,6,2945},{3335,5,54800},{3337,9,54803},{3340,14,2947},
+{3344,5,54840},{3346,10,2951},{3349,5,54856},{3351,10,2954},
+{3354,5,54868},{3356,14,2957},{3360,5,54896},{3362,10,2961},
+{3365,5,54924},{3367,38,2964},{3377,5,54980},{3379,42,2974},
+{3390,5,55036},{3392,10,2985},{3395,5,55064},{3397,6,2988},
+{3399,5,55080},{3401,6,2990},{3403,5,55092},{3405,18,2992},
+{3410,5,55120},{3412,0,55124},{3413,13,55126},{3417,5,55136},
+{3419,22,2997},{3425,5,55164},{3427,0,55169},{3428,5,55176},
+{3430,6,3003},{3432,5,55192},{3434,54,3005},{3448,5,26550},
+{3450,306,3019},{3527,5,37969},{3529,2070,3096},{4047,5,34942},
+{4049,134,3614},{4083,5,26398},{4085,74,3648},{4104,5,31047},
+{4106,62,3667},{4122,5,39438},{4124,2294,3683},{4698,5,24536},
+{4700,278,4257},{4770,5,25720},{4772,278,4327},{4842,5,32010},
+{4844,122,4397},{4875,5,26107},{4877,414,4428},{4981,5,35060},
+{4983,38,4532},{4993,5,30333},{4995,402,4542},{5096,5,23791},
+{5098,138,4643},{5133,5,33104},{5135,246,4678},{5197,9,27606},
+{5200,1678,4740},{5620,5,38567},{5622,1914,5160},{6101,5,31401},
+{6103,494,5639},{6227,5,38632},{6229,350,5763},{6317,5,24188},
+{6319,10,5851},{6322,5,24840},{6324,18,5854},{6329,5,26977},
+{6331,14,5859},{6335,5,29494},{6337,2990,5863},{7085,5,24920},
+{7087,2230,6611},{7645,5,38289},{7647,926,7169},{7879,5,30906},
+{7881,118,7401},{7911,5,26179},{7913,542,7431},{8049,5,29113},
+{8051,18,7567},{8056,5,12289},{8058,18,7572},{8063,5,12308},
+{8065,37,12296},{8075,6,7577},{8077,5,65288},{8079,6,7579},
+{8081,21,65306},{8087,10,7581},{8090,13,65371},{8094,373,32},
+{8188,18,7584},{8197,5,12302},{8199,5,12298},{8201,5,12296},
+{8203,5,40},{8207,3,0},{8208,3,3},{8209,3,6},
+{8210,3,9},{8213,5,40},{8217,5,12310},{8219,13,12310},
+{8223,6,7589},{8227,14,7591},{8231,5,8224},{8234,0,8727},
+{8237,6,7595},{8239,5,726},{8241,6,7597},{8244,10,7599},
+{8247,5,60},{8249,0,8800},{8250,5,8317},{8252,6,7602},
+{8256,5,8745},{8258,14,7604},{8263,9,12321},{8269,0,19971},
+{8272,0,21313},{8275,0,39},{8276,5,12308},{8278,0,42},
+{8280,6,7608},{8282,3,12},{8283,5,12289},{8285,3,15},
+{8286,3,18},{8287,3,21},{8288,3,24},{8289,5,40},
+{8291,5,12310},{8293,5,12304},{8297,3,27},{8298,3,30},
+{8299,3,33},{8300,3,36},{8301,3,39},{8302,3,42},
+{8303,3,45},{8304,3,48},{8305,3,51},{8306,3,54},
+{8307,3,59},{8308,3,64},{8309,3,69},{8310,3,74},
+{8311,3,79},{8312,3,84},{8313,3,89},{8314,3,94},
+{8315,3,99},{8316,3,104},{8317,0,182},{8320,6,7610},
+{8322,3,109},{8323,3,112},{8324,3,115},{8325,3,118},
+{8326,3,121},{8327,3,124},{8328,3,127},{8329,3,130},
+{8330,3,133},{8331,3,136},{8332,3,141},{8333,3,146},
+{8334,3,151},{8335,3,156},{8336,3,161},{8337,3,166},
+{8338,3,171},{8339,3,176},{8340,3,181},{8341,3,186},
+{8342,37,10122},{8362,3,191},{8363,3,195},{8364,3,199},
+{8365,3,203},{8366,3,207},{8367,3,211},{8368,3,215},
+{8369,3,219},{8370,3,223},{8371,3,227},{8372,3,231},
+{8373,3,235},{8374,3,239},{8375,3,243},{8376,3,247},
+{8377,3,251},{8378,3,255},{8379,3,259},{8380,3,263},
+{8381,3,267},{8382,3,271},{8383,3,275},{8384,3,279},
+{8385,3,283},{8386,3,287},{8387,3,291},{8388,101,9398},
+{8414,3,295},{8415,3,298},{8416,3,301},{8417,3,304},
+{8418,3,307},{8419,3,310},{8420,3,313},{8421,3,316},
+{8422,3,319},{8423,3,322},{8424,3,327},{8425,3,332},
+{8426,3,337},{8427,3,342},{8428,3,347},{8429,3,352},
+{8430,3,357},{8431,3,362},{8432,3,367},{8433,3,372},
+{8434,3,377},{8435,3,380},{8436,3,383},{8437,3,386},
+{8438,3,389},{8439,3,392},{8440,3,395},{8441,3,398},
+{8442,3,401},{8443,3,404},{8444,3,409},{8445,3,414},
+{8446,3,419},{8447,3,424},{8448,3,429},{8449,3,434},
+{8450,3,439},{8451,3,444},{8452,3,449},{8453,3,454},
+{8475,0,8911},{8476,5,8910},{8478,0,8910},{8479,5,8832},
+{8481,13,8816},{8486,0,8842},{8488,0,8843},{8489,5,8822},
+{8491,0,8825},{8492,5,8922},{8498,14,7612},{8503,6,7616},
+{8506,3,459},{8507,3,462},{8508,3,465},{8509,3,468},
+{8510,3,471},{8511,3,474},{8512,3,477},{8513,3,480},
+{8514,3,483},{8515,3,486},{8517,33,9312},{8526,3,489},
+{8527,3,492},{8528,3,495},{8529,3,498},{8530,3,501},
+{8531,3,504},{8532,3,507},{8533,3,510},{8534,3,513},
+{8535,3,516},{8536,3,519},{8537,3,522},{8538,3,525},
+{8539,3,528},{8540,3,531},{8541,3,534},{8542,3,537},
+{8543,3,540},{8544,3,543},{8545,3,546},{8546,3,549},
+{8547,3,552},{8548,3,555},{8549,3,558},{8550,3,561},
+{8551,3,564},{8552,3,567},{8553,3,570},{8554,3,573},
+{8555,3,576},{8556,3,579},{8557,3,582},{8558,3,585},
+{8559,3,588},{8560,3,591},{8561,3,594},{8562,3,597},
+{8563,3,600},{8564,3,603},{8565,3,606},{8566,3,609},
+{8567,3,612},{8568,3,615},{8569,3,618},{8570,3,621},
+{8571,3,624},{8572,3,627},{8573,3,630},{8574,3,633},
+{8575,3,636},{8576,3,639},{8577,3,642},{8578,18,7618},
+{8583,3,645},{8584,3,650},{8585,3,655},{8586,3,660},
+{8589,0,8224},{8590,3,665},{8591,3,668},{8592,3,671},
+{8593,14,7623},{8599,6,7627},{8603,6,7629},{8607,0,8226},
+{8608,3,675},{8609,3,678},{8611,3,681},{8612,13,12296},
+{8616,6,7631},{8620,3,684},{8622,3,687},{8623,3,690},
+{8628,3,693},{8629,3,696},{8630,6,7633},{8633,0,9711},
+{8639,0,9676},{8661,0,8361},{8664,0,9775},{8666,6,7635},
+{8671,0,12320},{8673,37,10102},{8693,3,699},{8694,3,704},
+{8695,3,709},{8696,3,714},{8697,3,719},{8698,3,724},
+{8699,26,7637},{8707,6,7644},{8712,0,9671},{8715,10,7646},
+{8719,5,8741},{8722,6,7649},{8724,5,8806},{8726,0,8723},
+{8727,9,8853},{8730,3,729},{8731,0,8980},{8734,0,8802},
+{8736,0,9649},{8738,18,7651},{8743,3,732},{8745,5,8814},
+{8747,34,7656},{8761,0,12958},{8763,0,8252},{8764,3,735},
+{8766,3,738},{8767,74,7665},{8787,18,7684},{8792,13,9364},
+{8796,3,741},{8797,3,746},{8798,3,751},{8799,3,756},
+{8800,3,761},{8801,3,766},{8802,3,771},{8803,3,776},
+{8804,3,781},{8805,3,786},{8806,0,8594},{8807,5,8592},
+{8809,0,8595},{8810,13,8598},{8814,14,7689},{8825,0,10132},
+{8837,0,10140},{8849,0,10170},{8854,6,7693},{8857,0,10142},
+{8861,0,10142},{8864,6,7695},{8867,10,7697},{8880,22,7700},
+{8890,6,7706},{8896,5,8644},{8898,3,791},{8899,3,794},
+{8900,3,797},{8901,3,800},{8902,3,803},{8903,3,806},
+{8904,3,809},{8905,3,812},{8906,3,815},{8907,3,818},
+{8908,3,821},{8909,3,824},{8910,3,827},{8911,3,830},
+{8912,3,833},{8913,3,836},{8914,3,839},{8915,3,842},
+{8916,3,845},{8917,3,848},{8918,3,851},{8919,3,854},
+{8920,3,857},{8921,3,860},{8922,3,863},{8923,3,866},
+{8924,3,869},{8925,3,872},{8926,3,875},{8927,3,878},
+{8928,3,881},{8929,3,884},{8930,3,887},{8931,3,890},
+{8932,3,893},{8933,3,896},{8934,3,899},{8935,3,902},
+{8936,3,905},{8937,3,908},{8938,3,911},{8939,3,914},
+{8940,3,917},{8941,3,920},{8942,3,923},{8943,3,926},
+{8944,3,929},{8945,3,932},{8946,3,935},{8947,3,938},
+{8948,3,941},{8949,3,944},{8950,3,947},{8951,3,950},
+{8952,3,953},{8953,3,956},{8954,3,959},{8955,3,962},
+{8956,3,965},{8957,3,968},{8958,3,971},{8959,3,974},
+{8960,3,977},{8961,3,980},{8962,3,983},{8963,3,986},
+{8964,3,989},{8965,3,992},{8966,3,995},{8967,3,998},
+{8968,3,1001},{8969,3,1004},{8970,3,1007},{8971,3,1010},
+{8972,3,1013},{8973,3,1016},{8974,3,1019},{8975,3,1022},
+{8976,3,1025},{8977,3,1028},{8978,3,1031},{8979,3,1034},
+{8980,3,1037},{8981,3,1040},{8982,3,1043},{8983,3,1046},
+{8984,3,1049},{8985,3,1052},{8986,3,1055},{8987,3,1058},
+{8988,3,1061},{8989,3,1064},{8990,3,1067},{8991,3,1070},
+{8992,3,1073},{8993,3,1076},{8994,3,1079},{8995,3,1082},
+{8996,3,1085},{8997,3,1088},{8998,3,1091},{8999,3,1094},
+{9000,3,1097},{9001,3,1100},{9002,3,1103},{9003,3,1106},
+{9004,3,1109},{9005,3,1112},{9006,3,1115},{9007,3,1118},
+{9008,3,1121},{9009,3,1124},{9010,3,1127},{9011,3,1130},
+{9012,3,1133},{9013,3,1136},{9014,3,1139},{9015,3,1142},
+{9016,3,1145},{9017,3,1148},{9018,3,1151},{9019,3,1154},
+{9020,3,1157},{9021,3,1160},{9022,3,1163},{9023,3,1166},
+{9024,3,1169},{9025,3,1172},{9026,3,1175},{9027,3,1178},
+{9028,3,1181},{9029,3,1184},{9030,3,1187},{9031,3,1190},
+{9032,3,1193},{9033,3,1196},{9034,3,1199},{9035,3,1202},
+{9036,3,1205},{9037,3,1208},{9038,3,1211},{9039,3,1214},
+{9040,3,1217},{9041,3,1220},{9042,17,9347},{9047,3,1223},
+{9048,3,1228},{9049,3,1233},{9050,3,1238},{9051,3,1243},
+{9052,3,1248},{9053,3,1253},{9054,3,1256},{9055,3,1259},
+{9056,3,1262},{9057,3,1265},{9058,3,1268},{9059,3,1271},
+{9060,3,1274},{9061,3,1277},{9062,3,1280},{9063,3,1283},
+{9064,3,1286},{9065,3,1289},{9066,3,1292},{9067,3,1295},
+{9068,3,1298},{9069,3,1301},{9070,3,1304},{9071,3,1307},
+{9072,3,1310},{9073,3,1313},{9074,3,1316},{9075,3,1319},
+{9076,3,1322},{9077,3,1325},{9078,3,1328},{9079,3,1331},
+{9080,0,12948},{9081,3,1334},{9082,3,1337},{9083,3,1340},
+{9084,3,1343},{9085,3,1346},{9086,3,1349},{9087,3,1352},
+{9088,3,1355},{9089,3,1358},{9090,3,1361},{9091,3,1364},
+{9092,3,1367},{9093,3,1370},{9094,3,1373},{9095,3,1376},
+{9096,0,12965},{9097,3,1379},{9098,3,1382},{9099,3,1385},
+{9100,3,1388},{9101,3,1391},{9102,3,1394},{9103,3,1397},
+{9104,3,1400},{9105,3,1403},{9106,3,1406},{9107,3,1409},
+{9108,3,1412},{9109,3,1415},{9110,3,1418},{9111,3,1421},
+{9112,3,1424},{9113,3,1427},{9114,3,1430},{9115,3,1433},
+{9116,3,1436},{9117,3,1439},{9118,3,1442},{9119,3,1445},
+{9120,3,1448},{9121,3,1451},{9122,3,1454},{9123,3,1457},
+{9124,3,1460},{9125,3,1463},{9126,3,1466},{9127,3,1469},
+{9128,3,1472},{9129,3,1475},{9130,3,1478},{9131,3,1481},
+{9132,3,1484},{9133,3,1487},{9134,3,1490},{9135,3,1493},
+{9136,3,1496},{9137,3,1499},{9138,3,1502},{9139,3,1505},
+{9140,3,1508},{9141,3,1511},{9142,3,1514},{9143,3,1517},
+{9144,3,1520},{9145,3,1523},{9146,3,1528},{9147,3,1533},
+{9148,3,1538},{9178,0,10132},{9190,13,8672},{9195,0,10145},
+{9198,14,7708},{9222,6,7712},{9226,3,1543},{9227,3,1546},
+{9228,3,1549},{9229,3,1552},{9230,3,1555},{9231,3,1558},
+{9232,3,1561},{9233,3,1564},{9234,3,1567},{9235,3,1570},
+{9236,3,1573},{9237,3,1576},{9238,3,1579},{9239,3,1582},
+{9240,3,1585},{9241,3,1588},{9242,3,1591},{9243,3,1596},
+{9244,3,1601},{9245,3,1606},{9246,3,1611},{9247,3,1616},
+{9248,3,1621},{9249,3,1626},{9250,3,1631},{9251,3,1636},
+{9252,3,1641},{9253,3,1646},{9254,3,1649},{9255,3,1652},
+{9256,3,1655},{9257,3,1658},{9258,3,1661},{9259,3,1664},
+{9260,3,1667},{9261,3,1670},{9262,3,1673},{9263,3,1676},
+{9264,3,1681},{9265,3,1686},{9266,3,1691},{9267,3,1696},
+{9268,3,1701},{9269,3,1706},{9270,3,1711},{9271,3,1716},
+{9272,3,1721},{9273,3,1726},{9274,3,1729},{9275,3,1732},
+{9276,3,1735},{9277,3,1738},{9278,3,1741},{9279,3,1744},
+{9280,3,1747},{9281,3,1750},{9282,3,1753},{9283,3,1756},
+{9284,3,1761},{9285,3,1766},{9286,3,1771},{9287,3,1776},
+{9288,3,1781},{9289,3,1786},{9290,3,1791},{9291,3,1796},
+{9292,3,1801},{9293,3,1806},{9294,3,1809},{9295,3,1812},
+{9296,3,1815},{9297,3,1818},{9298,3,1821},{9299,3,1824},
+{9300,0,12944},{9301,21,12938},{9307,3,1827},{9308,3,1830},
+{9309,3,1833},{9310,3,1836},{9311,3,1839},{9312,3,1842},
+{9313,3,1845},{9314,13,12300},{9318,0,8680},{9319,5,8678},
+{9321,26,7714},{9329,14,7721},{9333,5,44034},{9335,5,44037},
+{9337,17,44043},{9342,0,44056},{9343,5,44062},{9345,9,44065},
+{9348,25,44069},{9355,0,44078},{9356,21,44082},{9362,5,44090},
+{9364,9,44093},{9367,37,44097},{9377,0,44108},{9378,21,44110},
+{9384,9,44117},{9387,9,44121},{9390,73,44125},{9409,5,44146},
+{9411,5,44149},{9413,0,44153},{9414,17,44155},{9419,0,44162},
+{9420,5,44167},{9422,9,44173},{9425,9,44177},{9428,25,44181},
+{9435,0,44190},{9436,21,44194},{9442,0,44203},{9443,5,44205},
+{9445,25,44209},{9452,0,44218},{9453,9,44222},{9456,5,44226},
+{9458,9,44229},{9461,9,44233},{9464,29,44237},{9472,0,44246},
+{9473,29,44248},{9481,5,44258},{9483,5,44261},{9485,6,7725},
+{9487,5,44269},{9489,6,7727},{9491,17,44279},{9496,5,44286},
+{9498,9,44289},{9501,0,44293},{9502,17,44295},{9507,6,7729},
+{9509,21,44306},{9515,9,44313},{9518,9,44317},{9521,29,44321},
+{9529,5,44330},{9531,21,44334},{9537,5,44342},{9539,9,44345},
+{9542,25,44349},{9549,6,7731},{9551,21,44362},{9557,9,44369},
+{9560,9,44373},{9563,29,44377},{9571,0,44386},{9572,29,44388},
+{9580,5,44398},{9582,5,44401},{9584,13,44407},{9588,6,7733},
+{9590,17,44419},{9595,5,44426},{9597,9,44429},{9600,41,44433},
+{9611,21,44446},{9617,69,44453},{9635,29,44472},{9643,5,44482},
+{9645,9,44485},{9648,25,44489},{9655,0,44498},{9656,29,44500},
+{9664,9,44509},{9667,9,44513},{9670,73,44517},{9689,5,44538},
+{9691,5,44541},{9693,21,44546},{9699,6,7735},{9701,21,44558},
+{9707,105,44565},{9734,5,44594},{9736,5,44597},{9738,0,44601},
+{9739,17,44603},{9744,6,7737},{9746,9,44615},{9749,6,7739},
+{9751,9,44625},{9754,0,44629},{9755,17,44631},{9760,0,44638},
+{9761,9,44642},{9764,5,44646},{9766,5,44650},{9768,9,44653},
+{9771,25,44657},{9778,0,44666},{9779,21,44670},{9785,21,44678},
+{9791,185,44685},{9838,0,44735},{9839,9,44737},{9842,25,44741},
+{9849,0,44750},{9850,21,44754},{9856,5,44762},{9858,41,44765},
+{9869,5,44777},{9871,0,44780},{9872,21,44782},{9878,9,44789},
+{9881,9,44793},{9884,37,44797},{9894,13,44809},{9898,5,44814},
+{9900,105,44817},{9927,5,44846},{9929,6,7741},{9931,25,44853},
+{9938,6,7743},{9940,13,44868},{9944,21,44874},{9950,41,44881},
+{9961,21,44894},{9967,73,44902},{9986,21,44922},{9992,9,44929},
+{9995,9,44933},{9998,25,44937},{10005,9,44946},{10008,21,44950},
+{10014,105,44957},{10041,5,44986},{10043,9,44989},{10046,21,44993},
+{10052,6,7745},{10054,17,45007},{10059,25,45013},{10066,41,45021},
+{10077,21,45034},{10083,5,45042},{10085,9,45045},{10088,25,45049},
+{10095,5,45058},{10097,25,45061},{10104,9,45069},{10107,9,45073},
+{10110,25,45077},{10117,37,45086},{10127,105,45097},{10154,5,45126},
+{10156,10,7747},{10159,13,45135},{10163,6,7750},{10165,9,45146},
+{10168,117,45150},{10198,5,45182},{10200,9,45185},{10203,25,45189},
+{10210,6,7752},{10212,21,45202},{10218,0,45211},{10219,5,45213},
+{10221,17,45219},{10226,10,7754},{10229,5,45238},{10231,9,45241},
+{10234,25,45245},{10241,0,45254},{10242,21,45258},{10248,5,45266},
+{10250,9,45269},{10253,25,45273},{10260,13,45281},{10264,133,45286},
+{10298,0,45322},{10299,9,45325},{10302,0,45329},{10303,13,45332},
+{10307,0,45338},{10308,17,45342},{10313,5,45350},{10315,9,45353},
+{10318,25,45357},{10325,0,45366},{10326,21,45370},{10332,5,45378},
+{10334,9,45381},{10337,25,45385},{10344,5,45394},{10346,5,45398},
+{10348,9,45401},{10351,9,45405},{10354,89,45409},{10377,5,45434},
+{10379,9,45437},{10382,0,45441},{10383,17,45443},{10388,6,7757},
+{10390,13,45454},{10394,9,45461},{10397,9,45465},{10400,41,45469},
+{10411,137,45481},{10446,9,45517},{10449,9,45521},{10452,25,45525},
+{10459,0,45534},{10460,29,45536},{10468,5,45546},{10470,9,45549},
+{10473,29,45553},{10481,6,7759},{10483,21,45566},{10489,5,45574},
+{10491,5,45577},{10493,25,45581},{10500,6,7761},{10502,21,45594},
+{10508,73,45601},{10527,25,45621},{10534,105,45629},{10561,9,45657},
+{10564,9,45661},{10567,25,45665},{10574,37,45674},{10584,21,45686},
+{10590,25,45693},{10597,9,45702},{10600,21,45706},{10606,5,45714},
+{10608,9,45717},{10611,17,45723},{10616,6,7763},{10618,9,45735},
+{10621,0,45739},{10622,9,45741},{10625,9,45745},{10628,73,45749},
+{10647,5,45770},{10649,9,45773},{10652,0,45777},{10653,17,45779},
+{10658,6,7765},{10660,13,45790},{10664,6,7767},{10666,5,45801},
+{10668,9,45808},{10671,0,45814},{10672,9,45820},{10675,5,45826},
+{10677,9,45829},{10680,25,45833},{10687,0,45842},{10688,21,45846},
+{10694,217,45853},{10749,0,45911},{10750,5,45913},{10752,0,45917},
+{10753,13,45920},{10757,10,7769},{10760,5,45932},{10762,0,45935},
+{10763,5,45938},{10765,9,45941},{10768,25,45945},{10775,0,45954},
+{10776,21,45958},{10782,9,45965},{10785,9,45969},{10788,41,45973},
+{10799,21,45986},{10805,9,45993},{10808,89,45997},{10831,5,46022},
+{10833,5,46025},{10835,6,7772},{10837,9,46033},{10840,14,7774},
+{10844,5,46046},{10846,9,46049},{10849,9,46053},{10852,73,46057},
+{10871,73,46077},{10890,25,46097},{10897,9,46105},{10900,9,46109},
+{10903,25,46113},{10910,0,46122},{10911,29,46124},{10919,105,46133},
+{10946,5,46162},{10948,9,46165},{10951,25,46169},{10958,6,7778},
+{10960,21,46182},{10966,73,46189},{10985,25,46209},{10992,77,46217},
+{11012,21,46238},{11018,9,46245},{11021,9,46249},{11024,29,46253},
+{11032,6,7780},{11034,21,46266},{11040,9,46273},{11043,9,46277},
+{11046,25,46281},{11053,13,46289},{11057,21,46294},{11063,5,46302},
+{11065,5,46305},{11067,0,46309},{11068,17,46311},{11073,6,7782},
+{11075,21,46322},{11081,105,46329},{11108,5,46358},{11110,5,46361},
+{11112,25,46365},{11119,0,46374},{11120,17,46379},{11125,5,46386},
+{11127,9,46389},{11130,25,46393},{11137,0,46402},{11138,17,46406},
+{11143,5,46414},{11145,9,46417},{11148,25,46421},{11155,0,46430},
+{11156,245,46434},{11218,5,46498},{11220,9,46501},{11223,0,46505},
+{11224,13,46508},{11228,0,46514},{11229,17,46518},{11234,5,46526},
+{11236,9,46529},{11239,25,46533},{11246,0,46542},{11247,21,46546},
+{11253,73,46553},{11272,137,46573},{11307,5,46610},{11309,9,46613},
+{11312,45,46617},{11324,21,46630},{11330,25,46637},{11337,73,46645},
+{11356,105,46665},{11383,9,46693},{11386,201,46697},{11437,5,46750},
+{11439,9,46753},{11442,21,46757},{11448,13,46765},{11452,133,46770},
+{11486,105,46805},{11513,9,46833},{11516,9,46837},{11519,25,46841},
+{11526,9,46850},{11529,133,46854},{11563,5,46890},{11565,5,46893},
+{11567,25,46897},{11574,0,46906},{11575,29,46908},{11583,9,46917},
+{11586,9,46921},{11589,25,46925},{11596,37,46934},{11606,9,46945},
+{11609,9,46949},{11612,25,46953},{11619,6,7784},{11621,21,46966},
+{11627,5,46974},{11629,9,46977},{11632,25,46981},{11639,0,46990},
+{11640,9,46995},{11643,5,47002},{11645,9,47005},{11648,25,47009},
+{11655,0,47018},{11656,21,47022},{11662,5,47030},{11664,53,47033},
+{11678,0,47048},{11679,133,47050},{11713,5,47086},{11715,9,47089},
+{11718,25,47093},{11725,0,47102},{11726,17,47106},{11731,5,47114},
+{11733,9,47117},{11736,25,47121},{11743,6,7786},{11745,21,47134},
+{11751,5,47142},{11753,9,47145},{11756,25,47149},{11763,0,47158},
+{11764,21,47162},{11770,9,47169},{11773,45,47173},{11785,0,47186},
+{11786,29,47188},{11794,5,47198},{11796,9,47201},{11799,25,47205},
+{11806,6,7788},{11808,21,47218},{11814,9,47225},{11817,61,47229},
+{11833,101,47246},{11859,25,47273},{11866,9,47281},{11869,9,47285},
+{11872,25,47289},{11879,6,7790},{11881,21,47302},{11887,9,47309},
+{11890,9,47313},{11893,29,47317},{11901,6,7792},{11903,21,47330},
+{11909,5,47338},{11911,9,47341},{11914,25,47345},{11921,6,7794},
+{11923,21,47358},{11929,73,47365},{11948,25,47385},{11955,105,47393},
+{11982,5,47422},{11984,9,47425},{11987,25,47429},{11994,5,47437},
+{11996,0,47440},{11997,21,47442},{12003,5,47450},{12005,9,47453},
+{12008,25,47457},{12015,6,7796},{12017,21,47470},{12023,5,47478},
+{12025,9,47481},{12028,25,47485},{12035,6,7798},{12037,5,47499},
+{12039,113,47503},{12068,5,47534},{12070,9,47537},{12073,25,47541},
+{12080,6,7800},{12082,21,47554},{12088,5,47562},{12090,0,47565},
+{12091,17,47571},{12096,6,7802},{12098,5,47583},{12100,0,47586},
+{12101,5,47590},{12103,9,47593},{12106,25,47597},{12113,0,47606},
+{12114,17,47611},{12119,21,47618},{12125,45,47625},{12137,133,47638},
+{12171,5,47674},{12173,9,47677},{12176,0,47681},{12177,17,47683},
+{12182,6,7804},{12184,13,47695},{12188,5,47702},{12190,9,47705},
+{12193,25,47709},{12200,0,47718},{12201,21,47722},{12207,5,47730},
+{12209,9,47733},{12212,37,47737},{12222,0,47750},{12223,13,47752},
+{12227,105,47757},{12254,0,47786},{12255,9,47789},{12258,0,47793},
+{12259,17,47795},{12264,6,7806},{12266,21,47806},{12272,9,47813},
+{12275,57,47817},{12290,133,47834},{12324,9,47869},{12327,9,47873},
+{12330,29,47877},{12338,6,7808},{12340,21,47890},{12346,9,47897},
+{12349,9,47901},{12352,29,47905},{12360,0,47914},{12361,29,47916},
+{12369,0,47927},{12370,5,47929},{12372,17,47935},{12377,6,7810},
+{12379,9,47946},{12382,0,47950},{12383,9,47953},{12386,9,47957},
+{12389,29,47961},{12397,0,47970},{12398,29,47972},{12406,105,47981},
+{12433,9,48009},{12436,9,48013},{12439,73,48017},{12458,9,48037},
+{12461,9,48041},{12464,25,48045},{12471,5,48053},{12473,29,48056},
+{12481,9,48065},{12484,9,48069},{12487,25,48073},{12494,5,48081},
+{12496,141,48084},{12532,5,48122},{12534,5,48125},{12536,0,48129},
+{12537,17,48131},{12542,10,7812},{12545,5,48146},{12547,5,48153},
+{12549,13,48160},{12553,6,7815},{12555,9,48170},{12558,5,48174},
+{12560,5,48178},{12562,9,48181},{12565,25,48185},{12572,0,48194},
+{12573,9,48198},{12576,5,48202},{12578,5,48206},{12580,45,48209},
+{12592,149,48222},{12630,5,48262},{12632,5,48265},{12634,0,48269},
+{12635,17,48271},{12640,6,7817},{12642,17,48283},{12647,5,48290},
+{12649,5,48293},{12651,25,48297},{12658,0,48306},{12659,21,48310},
+{12665,5,48318},{12667,9,48321},{12670,29,48325},{12678,0,48334},
+{12679,9,48338},{12682,5,48342},{12684,9,48345},{12687,89,48349},
+{12710,0,48375},{12711,9,48377},{12714,25,48381},{12721,6,7819},
+{12723,21,48394},{12729,9,48401},{12732,57,48405},{12747,25,48421},
+{12754,73,48429},{12773,25,48449},{12780,5,48458},{12782,9,48461},
+{12785,25,48465},{12792,37,48474},{12802,9,48485},{12805,89,48489},
+{12828,5,48514},{12830,5,48517},{12832,17,48523},{12837,6,7821},
+{12839,9,48534},{12842,0,48539},{12843,25,48541},{12850,41,48549},
+{12861,25,48561},{12868,105,48569},{12895,5,48598},{12897,9,48601},
+{12900,45,48605},{12912,21,48618},{12918,9,48625},{12921,9,48629},
+{12924,25,48633},{12931,5,48641},{12933,0,48644},{12934,21,48646},
+{12940,5,48654},{12942,9,48657},{12945,25,48661},{12952,0,48670},
+{12953,141,48672},{12989,5,48710},{12991,9,48713},{12994,0,48717},
+{12995,17,48719},{13000,6,7823},{13002,13,48732},{13006,5,48738},
+{13008,9,48741},{13011,0,48745},{13012,17,48747},{13017,0,48754},
+{13018,17,48758},{13023,5,48766},{13025,9,48769},{13028,25,48773},
+{13035,0,48782},{13036,21,48786},{13042,53,48794},{13056,153,48809},
+{13095,5,48850},{13097,5,48853},{13099,25,48857},{13106,5,48865},
+{13108,21,48870},{13114,77,48877},{13134,21,48898},{13140,53,48906},
+{13154,0,48922},{13155,133,48926},{13189,5,48962},{13191,9,48965},
+{13194,25,48969},{13201,9,48978},{13204,245,48982},{13266,105,49045},
+{13293,77,49073},{13313,21,49094},{13319,5,49102},{13321,9,49105},
+{13324,25,49109},{13331,5,49117},{13333,0,49120},{13334,357,49122},
+{13424,77,49213},{13444,21,49234},{13450,9,49241},{13453,9,49245},
+{13456,25,49249},{13463,149,49258},{13501,5,49298},{13503,9,49301},
+{13506,25,49305},{13513,6,7825},{13515,21,49318},{13521,0,49326},
+{13522,5,49329},{13524,17,49335},{13529,0,49342},{13530,9,49346},
+{13533,5,49350},{13535,5,49354},{13537,9,49357},{13540,25,49361},
+{13547,0,49370},{13548,21,49374},{13554,5,49382},{13556,9,49385},
+{13559,25,49389},{13566,6,7827},{13568,21,49402},{13574,9,49409},
+{13577,9,49413},{13580,25,49417},{13587,13,49425},{13591,21,49430},
+{13597,5,49441},{13599,0,49445},{13600,13,49448},{13604,0,49454},
+{13605,13,49458},{13609,0,49463},{13610,5,49466},{13612,9,49469},
+{13615,25,49473},{13622,0,49482},{13623,21,49486},{13629,5,49494},
+{13631,9,49497},{13634,25,49501},{13641,0,49510},{13642,21,49514},
+{13648,9,49521},{13651,9,49525},{13654,45,49529},{13666,21,49542},
+{13672,0,49551},{13673,9,49553},{13676,0,49557},{13677,17,49559},
+{13682,6,7829},{13684,9,49570},{13687,5,49574},{13689,5,49578},
+{13691,9,49581},{13694,45,49585},{13706,21,49598},{13712,9,49605},
+{13715,9,49609},{13718,25,49613},{13725,5,49621},{13727,25,49625},
+{13734,9,49633},{13737,9,49637},{13740,25,49641},{13747,0,49650},
+{13748,29,49652},{13756,5,49662},{13758,9,49665},{13761,25,49669},
+{13768,6,7831},{13770,21,49682},{13776,5,49690},{13778,5,49693},
+{13780,25,49697},{13787,18,7833},{13792,73,49717},{13811,25,49737},
+{13818,5,49746},{13820,9,49749},{13823,25,49753},{13830,13,49761},
+{13834,21,49766},{13840,5,49774},{13842,9,49777},{13845,25,49781},
+{13852,6,7838},{13854,21,49794},{13860,21,49802},{13866,25,49809},
+{13873,5,49817},{13875,0,49820},{13876,21,49822},{13882,5,49830},
+{13884,9,49833},{13887,21,49838},{13893,6,7840},{13895,133,49850},
+{13929,5,49886},{13931,5,49889},{13933,21,49893},{13939,6,7842},
+{13941,13,49906},{13945,6,7844},{13947,9,49917},{13950,25,49921},
+{13957,5,49930},{13959,17,49934},{13964,5,49942},{13966,9,49945},
+{13969,25,49949},{13976,5,49958},{13978,105,49962},{14005,133,49990},
+{14039,5,50026},{14041,9,50029},{14044,0,50033},{14045,17,50035},
+{14050,5,50042},{14052,21,50046},{14058,9,50053},{14061,9,50057},
+{14064,201,50061},{14115,89,50113},{14138,5,50138},{14140,5,50141},
+{14142,0,50145},{14143,17,50147},{14148,9,50154},{14151,21,50158},
+{14157,5,50166},{14159,57,50169},{14174,25,50185},{14181,73,50193},
+{14200,25,50213},{14207,9,50221},{14210,9,50225},{14213,25,50229},
+{14220,37,50238},{14230,105,50249},{14257,5,50278},{14259,9,50281},
+{14262,25,50285},{14269,9,50294},{14272,21,50298},{14278,73,50305},
+{14297,25,50325},{14304,105,50333},{14331,9,50361},{14334,173,50365},
+{14378,21,50410},{14384,5,50418},{14386,9,50421},{14389,0,50425},
+{14390,13,50427},{14394,37,50434},{14404,9,50445},{14407,9,50449},
+{14410,25,50453},{14417,41,50461},{14428,5,50474},{14430,9,50477},
+{14433,25,50481},{14440,6,7846},{14442,21,50494},{14448,5,50502},
+{14450,0,50507},{14451,13,50511},{14455,0,50518},{14456,9,50522},
+{14459,0,50527},{14460,5,50530},{14462,9,50533},{14465,25,50537},
+{14472,0,50546},{14473,21,50550},{14479,5,50558},{14481,9,50561},
+{14484,5,50565},{14486,13,50568},{14490,6,7848},{14492,9,50578},
+{14495,0,50582},{14496,9,50585},{14499,9,50589},{14502,29,50593},
+{14510,37,50602},{14520,5,50614},{14522,0,50618},{14523,17,50623},
+{14528,10,7850},{14531,5,50642},{14533,9,50645},{14536,25,50649},
+{14543,6,7853},{14545,21,50662},{14551,0,50671},{14552,9,50673},
+{14555,0,50677},{14556,13,50680},{14560,9,50690},{14563,9,50697},
+{14566,9,50701},{14569,25,50705},{14576,0,50714},{14577,25,50717},
+{14584,5,50726},{14586,9,50729},{14589,0,50735},{14590,5,50737},
+{14592,10,7855},{14595,13,50748},{14599,5,50754},{14601,9,50757},
+{14604,25,50761},{14611,0,50770},{14612,21,50774},{14618,5,50782},
+{14620,41,50785},{14631,5,50797},{14633,0,50800},{14634,21,50802},
+{14640,5,50810},{14642,9,50813},{14645,25,50817},{14652,6,7858},
+{14654,21,50830},{14660,5,50838},{14662,9,50841},{14665,25,50845},
+{14672,6,7860},{14674,21,50858},{14680,5,50866},{14682,9,50869},
+{14685,17,50875},{14690,6,7862},{14692,21,50886},{14698,5,50894},
+{14700,9,50897},{14703,25,50901},{14710,5,50910},{14712,21,50914},
+{14718,5,50922},{14720,9,50925},{14723,25,50929},{14730,9,50938},
+{14733,21,50942},{14739,5,50950},{14741,9,50953},{14744,25,50957},
+{14751,6,7864},{14753,21,50970},{14759,5,50978},{14761,9,50981},
+{14764,25,50985},{14771,10,7866},{14774,13,51000},{14778,5,51006},
+{14780,9,51009},{14783,17,51013},{14788,10,7869},{14791,9,51033},
+{14794,9,51037},{14797,25,51041},{14804,5,51049},{14806,29,51052},
+{14814,5,51062},{14816,9,51065},{14819,13,51071},{14823,0,51078},
+{14824,9,51083},{14827,0,51087},{14828,5,51090},{14830,6,7872},
+{14832,17,51099},{14837,0,51106},{14838,17,51111},{14843,5,51118},
+{14845,9,51121},{14848,25,51125},{14855,0,51134},{14856,21,51138},
+{14862,5,51146},{14864,6,7874},{14866,25,51153},{14873,13,51161},
+{14877,21,51166},{14883,9,51173},{14886,9,51177},{14889,73,51181},
+{14908,5,51202},{14910,9,51205},{14913,0,51209},{14914,17,51211},
+{14919,6,7876},{14921,17,51223},{14926,5,51230},{14928,9,51233},
+{14931,25,51237},{14938,6,7878},{14940,21,51250},{14946,9,51257},
+{14949,9,51261},{14952,25,51265},{14959,5,51274},{14961,21,51278},
+{14967,105,51285},{14994,5,51314},{14996,9,51317},{14999,0,51321},
+{15000,17,51323},{15005,6,7880},{15007,9,51336},{15010,21,51342},
+{15016,29,51349},{15024,6,7882},{15026,21,51362},{15032,73,51369},
+{15051,21,51390},{15057,9,51397},{15060,9,51401},{15063,25,51405},
+{15070,6,7884},{15072,21,51418},{15078,5,51426},{15080,61,51429},
+{15096,21,51446},{15102,5,51454},{15104,9,51457},{15107,17,51463},
+{15112,6,7886},{15114,21,51474},{15120,73,51481},{15139,25,51501},
+{15146,105,51509},{15173,5,51538},{15175,9,51541},{15178,25,51545},
+{15185,0,51554},{15186,29,51556},{15194,9,51565},{15197,9,51569},
+{15200,25,51573},{15207,41,51581},{15218,5,51594},{15220,9,51597},
+{15223,25,51601},{15230,6,7888},{15232,133,51614},{15266,5,51650},
+{15268,5,51653},{15270,0,51657},{15271,17,51659},{15276,6,7890},
+{15278,5,51671},{15280,0,51675},{15281,5,51678},{15283,6,7892},
+{15285,5,51685},{15287,13,51688},{15291,0,51694},{15292,21,51698},
+{15298,5,51706},{15300,9,51709},{15303,25,51713},{15310,0,51722},
+{15311,21,51726},{15317,9,51733},{15320,61,51737},{15336,133,51754},
+{15370,5,51790},{15372,9,51793},{15375,25,51797},{15382,0,51806},
+{15383,21,51810},{15389,77,51817},{15409,21,51838},{15415,73,51845},
+{15434,137,51865},{15469,5,51902},{15471,9,51905},{15474,25,51909},
+{15481,10,7894},{15484,13,51924},{15488,21,51930},{15494,41,51937},
+{15505,25,51949},{15512,73,51957},{15531,25,51977},{15538,9,51985},
+{15541,9,51989},{15544,25,51993},{15551,121,52002},{15582,21,52034},
+{15588,5,52042},{15590,9,52045},{15593,25,52049},{15600,9,52058},
+{15603,21,52062},{15609,73,52069},{15628,133,52090},{15662,105,52125},
+{15689,105,52153},{15716,57,52181},{15731,5,52197},{15733,0,52200},
+{15734,133,52202},{15768,5,52238},{15770,9,52241},{15773,25,52245},
+{15780,9,52254},{15783,13,52259},{15787,5,52266},{15789,6,7897},
+{15791,25,52273},{15798,0,52282},{15799,17,52287},{15804,5,52294},
+{15806,9,52297},{15809,25,52301},{15816,0,52310},{15817,21,52314},
+{15823,9,52321},{15826,6,7899},{15828,25,52329},{15835,13,52337},
+{15839,133,52342},{15873,5,52378},{15875,9,52381},{15878,25,52385},
+{15885,0,52394},{15886,21,52398},{15892,5,52406},{15894,9,52409},
+{15897,25,52413},{15904,6,7901},{15906,21,52426},{15912,9,52433},
+{15915,57,52437},{15930,25,52453},{15937,9,52461},{15940,61,52465},
+{15956,21,52482},{15962,5,52490},{15964,9,52493},{15967,25,52497},
+{15974,6,7903},{15976,21,52510},{15982,9,52517},{15985,9,52521},
+{15988,45,52525},{16000,133,52538},{16034,9,52573},{16037,9,52577},
+{16040,25,52581},{16047,6,7905},{16049,21,52594},{16055,57,52601},
+{16070,41,52617},{16081,5,52630},{16083,9,52633},{16086,25,52637},
+{16093,6,7907},{16095,21,52650},{16101,73,52657},{16120,25,52677},
+{16127,9,52685},{16130,89,52689},{16153,9,52713},{16156,9,52717},
+{16159,25,52721},{16166,6,7909},{16168,21,52734},{16174,9,52741},
+{16177,9,52745},{16180,25,52749},{16187,13,52757},{16191,21,52762},
+{16197,5,52770},{16199,9,52773},{16202,25,52777},{16209,6,7911},
+{16211,133,52790},{16245,5,52826},{16247,5,52829},{16249,21,52834},
+{16255,6,7913},{16257,21,52846},{16263,5,52854},{16265,9,52857},
+{16268,25,52861},{16275,6,7915},{16277,21,52874},{16283,5,52882},
+{16285,9,52885},{16288,25,52889},{16295,0,52898},{16296,21,52902},
+{16302,73,52910},{16321,133,52930},{16355,5,52966},{16357,5,52969},
+{16359,25,52973},{16366,0,52982},{16367,21,52986},{16373,5,52994},
+{16375,9,52997},{16378,25,53001},{16385,6,7917},{16387,21,53014},
+{16393,9,53021},{16396,9,53025},{16399,25,53029},{16406,0,53038},
+{16407,21,53042},{16413,105,53049},{16440,5,53078},{16442,9,53081},
+{16445,25,53085},{16452,6,7919},{16454,21,53098},{16460,5,53106},
+{16462,9,53109},{16465,25,53113},{16472,13,53121},{16476,21,53126},
+{16482,77,53133},{16502,21,53154},{16508,25,53161},{16515,73,53169},
+{16534,105,53189},{16561,5,53218},{16563,9,53221},{16566,25,53225},
+{16573,6,7921},{16575,21,53238},{16581,9,53245},{16584,9,53249},
+{16587,45,53253},{16599,21,53266},{16605,77,53273},{16625,21,53294},
+{16631,5,53302},{16633,9,53305},{16636,25,53309},{16643,6,7923},
+{16645,21,53322},{16651,9,53329},{16654,9,53333},{16657,25,53337},
+{16664,41,53345},{16675,5,53358},{16677,9,53361},{16680,25,53365},
+{16687,9,53374},{16690,133,53378},{16724,5,53414},{16726,9,53417},
+{16729,25,53421},{16736,6,7925},{16738,21,53434},{16744,5,53442},
+{16746,9,53445},{16749,21,53450},{16755,0,53458},{16756,21,53462},
+{16762,5,53470},{16764,9,53473},{16767,25,53477},{16774,0,53486},
+{16775,21,53490},{16781,77,53497},{16801,133,53518},{16835,5,53554},
+{16837,9,53557},{16840,0,53561},{16841,17,53563},{16846,0,53570},
+{16847,21,53574},{16853,5,53582},{16855,9,53585},{16858,25,53589},
+{16865,6,7927},{16867,21,53602},{16873,9,53609},{16876,57,53613},
+{16891,25,53629},{16898,9,53637},{16901,89,53641},{16924,5,53666},
+{16926,9,53669},{16929,25,53673},{16936,6,7929},{16938,13,53686},
+{16942,0,53691},{16943,9,53693},{16946,89,53697},{16969,105,53721},
+{16996,9,53749},{16999,53,53753},{17013,0,53768},{17014,21,53770},
+{17020,105,53777},{17047,5,53806},{17049,9,53809},{17052,25,53813},
+{17059,6,7931},{17061,21,53826},{17067,73,53833},{17086,25,53853},
+{17093,105,53861},{17120,5,53890},{17122,9,53893},{17125,25,53897},
+{17132,9,53906},{17135,21,53910},{17141,9,53917},{17144,9,53921},
+{17147,25,53925},{17154,13,53933},{17158,21,53938},{17164,5,53946},
+{17166,5,53949},{17168,0,53953},{17169,17,53955},{17174,0,53962},
+{17175,29,53964},{17183,9,53973},{17186,9,53977},{17189,25,53981},
+{17196,37,53990},{17206,5,54002},{17208,9,54005},{17211,25,54009},
+{17218,6,7933},{17220,21,54022},{17226,0,54031},{17227,9,54033},
+{17230,0,54037},{17231,17,54039},{17236,0,54046},{17237,9,54050},
+{17240,5,54054},{17242,5,54058},{17244,9,54061},{17247,25,54065},
+{17254,0,54074},{17255,21,54078},{17261,213,54086},{17315,5,54142},
+{17317,9,54145},{17320,25,54149},{17327,0,54158},{17328,21,54162},
+{17334,5,54170},{17336,9,54173},{17339,25,54177},{17346,6,7935},
+{17348,21,54190},{17354,9,54197},{17357,9,54201},{17360,25,54205},
+{17367,5,54214},{17369,21,54218},{17375,25,54225},{17382,29,54233},
+{17390,0,54242},{17391,29,54244},{17399,5,54254},{17401,9,54257},
+{17404,25,54261},{17411,6,7937},{17413,21,54274},{17419,77,54281},
+{17439,133,54302},{17473,9,54337},{17476,89,54341},{17499,9,54365},
+{17502,9,54369},{17505,29,54373},{17513,0,54382},{17514,29,54384},
+{17522,5,54394},{17524,5,54397},{17526,0,54401},{17527,17,54403},
+{17532,6,7939},{17534,21,54414},{17540,77,54421},{17560,133,54442},
+{17594,9,54477},{17597,9,54481},{17600,25,54485},{17607,5,54493},
+{17609,29,54496},{17617,9,54505},{17620,9,54509},{17623,25,54513},
+{17630,5,54521},{17632,0,54524},{17633,21,54526},{17639,9,54533},
+{17642,9,54537},{17645,25,54541},{17652,0,54550},{17653,141,54552},
+{17689,5,54590},{17691,9,54593},{17694,25,54597},{17701,6,7941},
+{17703,21,54610},{17709,5,54618},{17711,9,54621},{17714,13,54625},
+{17718,5,54630},{17720,6,7943},{17722,21,54638},{17728,5,54646},
+{17730,9,54649},{17733,25,54653},{17740,0,54662},{17741,21,54666},
+{17747,77,54673},{17767,133,54694},{17801,5,54730},{17803,9,54733},
+{17806,0,54737},{17807,17,54739},{17812,6,7945},{17814,21,54750},
+{17820,5,54758},{17822,9,54761},{17825,25,54765},{17832,6,7947},
+{17834,21,54778},{17840,5,54786},{17842,9,54789},{17845,25,54793},
+{17852,0,54802},{17853,21,54806},{17859,9,54813},{17862,9,54817},
+{17865,29,54821},{17873,37,54830},{17883,5,54842},{17885,9,54845},
+{17888,13,54849},{17892,5,54854},{17894,6,7949},{17896,9,54862},
+{17899,5,54866},{17901,5,54870},{17903,9,54873},{17906,37,54877},
+{17916,0,54888},{17917,21,54890},{17923,5,54898},{17925,53,54901},
+{17939,0,54916},{17940,21,54918},{17946,5,54926},{17948,9,54929},
+{17951,29,54933},{17959,6,7951},{17961,21,54946},{17967,9,54953},
+{17970,9,54957},{17973,29,54961},{17981,0,54970},{17982,29,54972},
+{17990,5,54982},{17992,9,54985},{17995,13,54989},{17999,5,54994},
+{18001,5,54997},{18003,0,55000},{18004,21,55002},{18010,9,55009},
+{18013,9,55013},{18016,25,55017},{18023,13,55025},{18027,21,55030},
+{18033,5,55038},{18035,9,55041},{18038,45,55045},{18050,21,55058},
+{18056,5,55066},{18058,9,55069},{18061,25,55073},{18068,6,7953},
+{18070,21,55086},{18076,5,55094},{18078,9,55097},{18081,25,55101},
+{18088,5,55109},{18090,0,55112},{18091,21,55114},{18097,5,55122},
+{18099,0,55125},{18100,21,55130},{18106,6,7955},{18108,9,55142},
+{18111,5,55146},{18113,9,55149},{18116,9,55153},{18119,25,55157},
+{18126,9,55166},{18129,21,55170},{18135,5,55178},{18137,9,55181},
+{18140,25,55185},{18147,6,7957},{18149,21,55198},{18155,377,32},
+{18250,18,7959},{18255,373,32},{18349,10,7964},
+};
+
+static const unsigned short cmap_Adobe_Korea1_UCS2_table[7967] = {
+2,40,40,2,41,41,2,40,40,2,41,41,
+2,52685,52685,2,40,40,2,41,41,2,40,40,
+2,41,41,2,49,8414,2,50,8414,2,51,8414,
+2,52,8414,2,53,8414,2,54,8414,2,55,8414,
+2,56,8414,2,57,8414,4,91,49,48,93,4,
+91,49,49,93,4,91,49,50,93,4,91,49,
+51,93,4,91,49,52,93,4,91,49,53,93,
+4,91,49,54,93,4,91,49,55,93,4,91,
+49,56,93,4,91,49,57,93,4,91,50,48,
+93,2,49,8414,2,50,8414,2,51,8414,2,52,
+8414,2,53,8414,2,54,8414,2,55,8414,2,56,
+8414,2,57,8414,4,91,49,48,93,4,91,49,
+49,93,4,91,49,50,93,4,91,49,51,93,
+4,91,49,52,93,4,91,49,53,93,4,91,
+49,54,93,4,91,49,55,93,4,91,49,56,
+93,4,91,49,57,93,4,91,50,48,93,3,
+40,65,41,3,40,66,41,3,40,67,41,3,
+40,68,41,3,40,69,41,3,40,70,41,3,
+40,71,41,3,40,72,41,3,40,73,41,3,
+40,74,41,3,40,75,41,3,40,76,41,3,
+40,77,41,3,40,78,41,3,40,79,41,3,
+40,80,41,3,40,81,41,3,40,82,41,3,
+40,83,41,3,40,84,41,3,40,85,41,3,
+40,86,41,3,40,87,41,3,40,88,41,3,
+40,89,41,3,40,90,41,2,49,8414,2,50,
+8414,2,51,8414,2,52,8414,2,53,8414,2,54,
+8414,2,55,8414,2,56,8414,2,57,8414,4,91,
+49,48,93,4,91,49,49,93,4,91,49,50,
+93,4,91,49,51,93,4,91,49,52,93,4,
+91,49,53,93,4,91,49,54,93,4,91,49,
+55,93,4,91,49,56,93,4,91,49,57,93,
+4,91,50,48,93,2,49,8414,2,50,8414,2,
+51,8414,2,52,8414,2,53,8414,2,54,8414,2,
+55,8414,2,56,8414,2,57,8414,4,91,49,48,
+93,4,91,49,49,93,4,91,49,50,93,4,
+91,49,51,93,4,91,49,52,93,4,91,49,
+53,93,4,91,49,54,93,4,91,49,55,93,
+4,91,49,56,93,4,91,49,57,93,4,91,
+50,48,93,2,48,8414,2,49,8414,2,50,8414,
+2,51,8414,2,52,8414,2,53,8414,2,54,8414,
+2,55,8414,2,56,8414,2,57,8414,2,65,41,
+2,66,41,2,67,41,2,68,41,2,69,41,
+2,70,41,2,71,41,2,72,41,2,73,41,
+2,74,41,2,75,41,2,76,41,2,77,41,
+2,78,41,2,79,41,2,80,41,2,81,41,
+2,82,41,2,83,41,2,84,41,2,85,41,
+2,86,41,2,87,41,2,88,41,2,89,41,
+2,90,41,2,97,41,2,98,41,2,99,41,
+2,100,41,2,101,41,2,102,41,2,103,41,
+2,104,41,2,105,41,2,106,41,2,107,41,
+2,108,41,2,109,41,2,110,41,2,111,41,
+2,112,41,2,113,41,2,114,41,2,115,41,
+2,116,41,2,117,41,2,118,41,2,119,41,
+2,120,41,2,121,41,2,122,41,4,40,50,
+55,41,4,40,50,56,41,4,40,50,57,41,
+4,40,51,48,41,2,8224,8224,2,8225,8225,3,
+8224,8224,8224,2,9632,8415,2,9671,8415,2,9633,8415,
+2,9671,8414,2,9633,8414,2,9670,8414,2,9651,8413,
+2,9650,8413,4,40,50,49,41,4,40,50,50,
+41,4,40,50,51,41,4,40,50,52,41,4,
+40,50,53,41,4,40,50,54,41,2,247,8413,
+2,8869,824,2,33,63,2,63,63,4,40,50,
+49,41,4,40,50,50,41,4,40,50,51,41,
+4,40,50,52,41,4,40,50,53,41,4,40,
+50,54,41,4,40,50,55,41,4,40,50,56,
+41,4,40,50,57,41,4,40,51,48,41,2,
+65,46,2,66,46,2,67,46,2,68,46,2,
+69,46,2,70,46,2,71,46,2,72,46,2,
+73,46,2,74,46,2,75,46,2,76,46,2,
+77,46,2,78,46,2,79,46,2,80,46,2,
+81,46,2,82,46,2,83,46,2,84,46,2,
+85,46,2,86,46,2,87,46,2,88,46,2,
+89,46,2,90,46,2,97,46,2,98,46,2,
+99,46,2,100,46,2,101,46,2,102,46,2,
+103,46,2,104,46,2,105,46,2,106,46,2,
+107,46,2,108,46,2,109,46,2,110,46,2,
+111,46,2,112,46,2,113,46,2,114,46,2,
+115,46,2,116,46,2,117,46,2,118,46,2,
+119,46,2,120,46,2,121,46,2,122,46,2,
+50868,8414,2,45813,8414,2,51452,8414,2,47749,8414,2,
+45824,8414,2,54805,8414,2,48512,8414,2,51204,8414,2,
+51217,8414,2,49688,8414,2,46041,8414,2,48708,8414,2,
+48152,8414,2,51088,8414,2,53440,8414,2,44048,8414,2,
+50557,8414,2,51064,8414,2,46907,8414,2,21360,8414,2,
+35387,8414,2,50696,8414,2,24863,8414,2,20896,8414,2,
+31572,8414,2,20195,8414,2,38957,8414,2,21205,8414,2,
+21517,8414,2,30446,8414,2,21453,8414,2,35036,8414,2,
+26412,8414,2,21103,8414,2,24207,8414,2,36899,8414,2,
+24433,8414,2,20363,8414,2,28304,8414,2,23376,8414,2,
+21069,8414,2,31680,8414,2,25509,8414,2,21161,8414,2,
+25351,8414,2,20182,8414,2,27966,8414,2,24418,8414,2,
+51312,8414,2,47928,8414,2,45813,8414,2,51452,8414,2,
+46907,8414,2,35387,8414,2,44368,8414,2,50669,8414,2,
+51020,8414,2,51221,8414,2,54644,8414,2,50696,8414,2,
+51316,8413,2,46972,8413,2,47560,8413,2,48148,8413,2,
+49324,8413,2,50500,8413,2,51088,8413,2,52264,8413,2,
+52852,8413,2,53440,8413,2,54028,8413,2,45458,8413,2,
+45230,8413,2,47749,8413,2,45824,8413,2,54805,8413,2,
+48512,8413,2,51204,8413,2,51217,8413,2,49688,8413,2,
+46041,8413,2,48708,8413,2,44172,8413,2,48152,8413,2,
+49549,8413,2,51064,8413,2,48376,8413,2,50557,8413,2,
+49689,8413,2,50976,8413,2,44288,8413,2,20896,8413,4,
+40,50,49,41,4,40,50,50,41,4,40,50,
+51,41,4,40,50,52,41,4,40,50,53,41,
+4,40,50,54,41,2,51312,8413,2,44397,8413,2,
+44048,8413,2,21360,8413,2,34915,8413,2,26411,8413,2,
+44144,8413,2,45813,8413,2,48320,8413,2,49345,8413,2,
+49468,8413,2,49888,8413,2,50668,8413,2,50696,8413,2,
+50896,8413,2,51089,8413,2,51456,8413,2,53433,8413,2,
+50808,8413,2,54876,8413,2,44036,8413,2,44057,8413,2,
+49892,8413,2,24863,8413,2,24931,8413,2,20195,8413,2,
+21205,8413,2,21453,8413,2,21103,8413,2,33258,8413,2,
+21069,8413,2,38651,8413,2,25509,8413,2,21161,8413,2,
+27880,8413,2,21443,8413,2,26412,8413,2,26032,8413,2,
+29694,8413,2,24418,8413,2,38291,8413,2,22283,8413,2,
+20182,8413,2,48736,8413,2,49884,8413,2,51077,8413,2,
+51004,8413,2,51020,8413,2,51649,8413,2,54364,8413,2,
+44032,8413,2,45208,8413,2,45796,8413,2,54616,8413,2,
+47560,8413,2,48148,8413,2,49324,8413,2,50500,8413,2,
+51088,8413,2,52264,8413,2,52852,8413,2,53440,8413,2,
+54028,8413,2,54616,8413,2,48708,8413,2,45813,8413,2,
+48736,8413,2,48376,8413,2,45800,8413,2,49468,8413,2,
+49884,8413,2,50668,8413,2,50696,8413,2,51004,8413,2,
+51020,8413,2,51077,8413,2,51228,8413,2,51316,8413,2,
+51456,8413,2,54364,8413,2,54644,8413,2,45712,8413,2,
+45458,8413,2,45230,8413,2,48152,8413,2,44032,8413,2,
+45208,8413,2,45796,8413,2,46972,8413,2,50808,8413,4,
+40,50,55,41,4,40,50,56,41,4,40,50,
+57,41,4,40,51,48,41,2,45800,8413,2,52280,
+8413,2,49548,8413,2,51473,8413,2,51068,8413,2,51060,
+8413,2,55092,8413,2,49,8414,2,50,8414,2,51,
+8414,2,52,8414,2,53,8414,2,54,8414,2,55,
+8414,2,56,8414,2,57,8414,4,91,49,48,93,
+4,91,49,49,93,4,91,49,50,93,4,91,
+49,51,93,4,91,49,52,93,4,91,49,53,
+93,4,91,49,54,93,4,91,49,55,93,4,
+91,49,56,93,4,91,49,57,93,4,91,50,
+48,93,2,19968,8414,2,20108,8414,2,19977,8414,2,
+22235,8414,2,20116,8414,2,20845,8414,2,19971,8414,2,
+20843,8414,2,20061,8414,2,21313,8414,4,91,21313,19968,
+93,4,91,21313,20108,93,4,91,21313,19977,93,4,
+91,21313,22235,93,4,91,21313,20116,93,4,91,21313,
+20845,93,4,91,21313,19971,93,4,91,21313,20843,93,
+4,91,21313,20061,93,4,91,20108,21313,93,2,19968,
+8414,2,20108,8414,2,19977,8414,2,22235,8414,2,20116,
+8414,2,20845,8414,2,19971,8414,2,20843,8414,2,20061,
+8414,2,21313,8414,4,91,21313,19968,93,4,91,21313,
+20108,93,4,91,21313,19977,93,4,91,21313,22235,93,
+4,91,21313,20116,93,4,91,21313,20845,93,4,91,
+21313,19971,93,4,91,21313,20843,93,4,91,21313,20061,
+93,4,91,20108,21313,93,2,26085,8414,2,26376,8414,
+2,28779,8414,2,27700,8414,2,26408,8414,2,37329,8414,
+2,22303,8414,2,26085,8414,2,26376,8414,2,28779,8414,
+2,27700,8414,2,26408,8414,2,37329,8414,2,22303,8414,
+8361,8208,169,8482,8943,168,12291,8214,65340,8764,177,215,
+247,8800,8734,8756,176,8451,8491,65509,9794,9792,8736,8869,
+8978,8706,8711,8801,8786,167,8251,9734,9733,9675,9679,9678,
+9671,9670,9633,9632,9651,9650,9661,9660,8594,8730,8765,8733,
+8757,8712,8715,8746,8745,65506,8658,8660,8704,8707,180,732,
+711,728,733,730,729,184,731,161,191,8758,8750,8721,
+8719,164,8457,8240,9665,9664,9655,9654,9828,9829,9831,9827,
+8857,9672,9635,9640,9639,9638,9641,9832,9743,9742,9756,9758,
+182,8597,8599,8601,8598,8600,9837,9836,12927,12828,8470,13255,
+8482,13250,13272,8481,9472,9474,9484,9488,9496,9492,9500,9516,
+9508,9524,9532,9473,9475,9487,9491,9499,9495,9507,9523,9515,
+9531,9547,9504,9519,9512,9527,9535,9501,9520,9509,9528,9538,
+9490,9489,9498,9497,9494,9493,9486,9485,8467,13208,13252,13270,
+13253,13277,13264,13267,13251,13257,13276,13254,198,208,170,294,
+306,319,321,216,338,186,222,358,330,188,190,230,
+273,240,295,305,307,312,320,322,248,339,223,254,
+359,331,329,8308,8319,44064,44068,44092,44096,44107,44109,44116,
+44120,44124,44176,44180,44225,44228,44232,44236,44245,44247,44266,44268,
+44288,44292,44294,44303,44305,44312,44316,44320,44329,44344,44348,44359,
+44361,44368,44372,44376,44385,44387,44428,44432,44452,44471,44484,44488,
+44499,44508,44512,44516,44555,44557,44564,44624,44628,44630,44652,44656,
+44736,44740,44764,44776,44779,44781,44788,44792,44796,44813,44816,44848,
+44850,44852,44921,44928,44932,44936,44949,44956,44988,44992,45012,45020,
+45044,45048,45060,45068,45072,45076,45128,45130,45132,45134,45143,45145,
+45149,45184,45188,45199,45201,45240,45244,45268,45272,45280,45285,45352,
+45356,45380,45384,45400,45404,45408,45436,45440,45442,45451,45453,45464,
+45468,45480,45516,45520,45524,45548,45552,45561,45563,45565,45591,45593,
+45600,45620,45628,45656,45660,45664,45738,45740,45744,45748,45772,45776,
+45778,45787,45789,45794,45828,45832,45927,45929,45931,45934,45940,45944,
+45964,45968,45972,45992,45996,46030,46032,46039,46041,46043,46045,46048,
+46052,46056,46076,46096,46104,46108,46112,46123,46132,46164,46168,46179,
+46181,46188,46208,46216,46237,46244,46248,46252,46261,46263,46265,46272,
+46276,46280,46288,46293,46319,46321,46328,46388,46392,46416,46420,46500,
+46504,46528,46532,46552,46572,46612,46616,46629,46636,46644,46664,46692,
+46696,46752,46756,46769,46804,46832,46836,46840,46907,46916,46920,46924,
+46944,46948,46952,46963,46965,46976,46980,47004,47008,47032,47047,47049,
+47088,47092,47116,47120,47131,47133,47144,47148,47168,47172,47185,47187,
+47200,47204,47215,47217,47224,47228,47245,47272,47280,47284,47288,47299,
+47301,47308,47312,47316,47325,47327,47329,47340,47344,47355,47357,47364,
+47384,47392,47424,47428,47436,47439,47441,47452,47456,47467,47469,47480,
+47484,47536,47540,47551,47553,47592,47596,47624,47637,47676,47680,47682,
+47704,47708,47732,47736,47751,47756,47792,47794,47803,47805,47812,47816,
+47868,47872,47876,47885,47887,47889,47896,47900,47904,47913,47915,47943,
+47945,47949,47956,47960,47969,47971,47980,48008,48012,48016,48036,48040,
+48044,48052,48055,48064,48068,48072,48080,48083,48143,48145,48167,48169,
+48173,48180,48184,48208,48221,48320,48324,48333,48341,48344,48348,48376,
+48380,48391,48393,48400,48404,48420,48428,48448,48460,48464,48484,48488,
+48531,48533,48540,48548,48560,48568,48600,48604,48617,48624,48628,48632,
+48640,48643,48645,48656,48660,48712,48716,48718,48740,48744,48746,48768,
+48772,48876,48897,48964,48968,48981,49044,49072,49093,49104,49108,49116,
+49119,49121,49212,49233,49240,49244,49248,49300,49304,49315,49317,49356,
+49360,49384,49388,49399,49401,49408,49412,49416,49424,49429,49468,49472,
+49496,49500,49520,49524,49528,49541,49552,49556,49558,49567,49569,49573,
+49580,49584,49597,49604,49608,49612,49620,49632,49636,49640,49664,49668,
+49679,49681,49707,49709,49711,49716,49736,49748,49752,49760,49765,49776,
+49780,49791,49793,49808,49816,49819,49821,49847,49849,49903,49905,49910,
+49944,49948,50028,50032,50034,50052,50056,50060,50112,50168,50184,50192,
+50212,50220,50224,50228,50280,50284,50297,50304,50324,50332,50360,50364,
+50409,50420,50424,50426,50444,50448,50452,50460,50476,50480,50491,50493,
+50532,50536,50560,50564,50567,50575,50577,50581,50588,50592,50601,50636,
+50638,50644,50648,50659,50661,50672,50676,50700,50704,50743,50745,50747,
+50756,50760,50784,50796,50799,50801,50812,50816,50824,50825,50827,50829,
+50840,50844,50855,50857,50883,50885,50896,50900,50924,50928,50952,50956,
+50967,50969,50980,50984,50995,50997,50999,51008,51012,51018,51036,51040,
+51048,51051,51120,51124,51148,51150,51152,51160,51165,51172,51176,51180,
+51204,51208,51210,51232,51236,51247,51249,51256,51260,51264,51316,51320,
+51322,51348,51357,51359,51361,51368,51396,51400,51404,51415,51417,51428,
+51445,51471,51473,51480,51500,51508,51540,51544,51555,51564,51568,51572,
+51580,51596,51600,51611,51613,51680,51682,51684,51687,51708,51712,51732,
+51736,51753,51792,51796,51816,51837,51844,51864,51904,51908,51919,51921,
+51923,51936,51948,51956,51976,51984,51988,51992,52044,52048,52061,52068,
+52124,52152,52180,52196,52199,52201,52240,52244,52268,52270,52272,52296,
+52300,52320,52324,52326,52328,52336,52341,52380,52384,52408,52412,52423,
+52425,52432,52436,52452,52460,52464,52481,52492,52496,52507,52509,52516,
+52520,52524,52537,52572,52576,52580,52591,52593,52600,52616,52632,52636,
+52647,52649,52656,52676,52684,52688,52712,52716,52720,52731,52733,52740,
+52744,52748,52756,52761,52772,52776,52787,52789,52843,52845,52856,52860,
+52871,52873,52884,52888,52996,53000,53011,53013,53020,53024,53028,53080,
+53084,53095,53097,53108,53112,53120,53125,53132,53153,53160,53168,53188,
+53220,53224,53235,53237,53244,53248,53252,53265,53272,53293,53304,53308,
+53319,53321,53328,53332,53336,53344,53360,53364,53416,53420,53431,53433,
+53472,53476,53496,53517,53556,53560,53562,53584,53588,53599,53601,53608,
+53612,53628,53636,53640,53668,53672,53683,53685,53690,53692,53696,53720,
+53748,53752,53767,53769,53776,53808,53812,53823,53825,53832,53852,53860,
+53892,53896,53909,53916,53920,53924,53932,53937,53963,53972,53976,53980,
+54004,54008,54019,54021,54032,54036,54038,54060,54064,54144,54148,54172,
+54176,54187,54189,54196,54200,54204,54224,54232,54241,54243,54256,54260,
+54271,54273,54280,54301,54336,54340,54364,54368,54372,54381,54383,54411,
+54413,54420,54441,54476,54480,54484,54492,54495,54504,54508,54512,54520,
+54523,54525,54532,54536,54540,54592,54596,54607,54609,54620,54624,54629,
+54635,54637,54648,54652,54672,54693,54732,54736,54738,54747,54749,54760,
+54764,54772,54773,54775,54777,54788,54792,54812,54816,54820,54829,54844,
+54848,54853,54859,54861,54865,54872,54876,54887,54889,54900,54915,54917,
+54928,54932,54941,54943,54945,54952,54956,54960,54969,54971,54984,54988,
+54993,54996,54999,55001,55008,55012,55016,55024,55029,55040,55044,55057,
+55068,55072,55083,55085,55096,55100,55108,55111,55113,55139,55141,55145,
+55148,55152,55156,55180,55184,55195,55197,20285,20339,20551,20729,21152,
+21487,21621,21733,22025,23233,23478,26247,26607,27468,29634,30146,31292,
+33499,33540,34903,34952,35382,36040,36303,36603,36838,39381,21051,21364,
+21508,24682,24932,27580,29647,33050,35258,35282,38307,20355,21002,22718,
+22904,23014,24178,24185,25031,25536,26438,26604,26751,28567,30286,30475,
+30965,31240,31487,31777,32925,33390,33393,35563,38291,20075,21917,26359,
+28212,30883,31469,33883,35088,34638,38824,21208,22350,22570,23884,24863,
+25022,25121,25954,26577,27204,28187,29976,30131,30435,30640,32058,37039,
+40853,21283,23724,30002,32987,37440,38296,21083,22536,23004,23713,23831,
+24247,24378,24394,24951,27743,30074,30086,31968,32115,32177,32652,33108,
+33313,34193,35137,35611,37628,38477,40007,20171,20215,20491,20977,22607,
+24887,24894,24936,25913,27114,28433,30117,30342,30422,31623,33445,33995,
+37799,38283,21888,23458,22353,31923,32697,37301,20520,21435,23621,24040,
+25298,25454,25818,25831,28192,28844,31067,36317,36382,36989,37445,37624,
+20094,20214,20581,24062,24314,24838,26967,33137,34388,36423,37749,39467,
+20062,20625,26480,26688,20745,21133,21138,27298,30652,37392,40660,21163,
+24623,36850,20552,25001,25581,25802,26684,27268,28608,33160,35233,38548,
+22533,29309,29356,29956,32121,32365,32937,35211,35700,36963,40273,25225,
+27770,28500,32080,32570,35363,20860,24906,31645,35609,37463,37772,20140,
+20435,20510,20670,20742,21185,21197,21375,22384,22659,24218,24465,24950,
+25004,25806,25964,26223,26299,26356,26775,28039,28805,28913,29855,29861,
+29898,30169,30828,30956,31455,31478,32069,32147,32789,32831,33051,33686,
+35686,36629,36885,37857,38915,38968,39514,39912,20418,21843,22586,22865,
+23395,23622,24760,25106,26690,26800,26856,28330,30028,30328,30926,31293,
+31995,32363,32380,35336,35489,35903,38542,40388,21476,21481,21578,21617,
+22266,22993,23396,23611,24235,25335,25911,25925,25970,26272,26543,27073,
+27837,30204,30352,30590,31295,32660,32771,32929,33167,33510,33533,33776,
+34241,34865,34996,35493,36764,37678,38599,39015,39640,40723,21741,26011,
+26354,26767,31296,35895,40288,22256,22372,23825,26118,26801,26829,28414,
+29736,34974,39908,27752,39592,20379,20844,20849,21151,23380,24037,24656,
+24685,25329,25511,25915,29657,31354,34467,36002,38799,20018,23521,25096,
+26524,29916,31185,33747,35463,35506,36328,36942,37707,38982,24275,27112,
+34303,37101,20896,23448,23532,24931,26874,27454,28748,29743,29912,31649,
+32592,33733,35264,36011,38364,39208,21038,24669,25324,36866,20362,20809,
+21281,22745,24291,26336,27960,28826,29378,29654,31568,33009,37979,21350,
+25499,32619,20054,20608,22602,22750,24618,24871,25296,27088,39745,23439,
+32024,32945,36703,20132,20689,21676,21932,23308,23968,24039,25898,25934,
+26657,27211,29409,30350,30703,32094,32761,33184,34126,34527,36611,36686,
+37066,39171,39509,39851,19992,20037,20061,20167,20465,20855,21246,21312,
+21475,21477,21646,22036,22389,22434,23495,23943,24272,25084,25304,25937,
+26552,26601,27083,27472,27590,27628,27714,28317,28792,29399,29590,29699,
+30655,30697,31350,32127,32777,33276,33285,33290,33503,34914,35635,36092,
+36544,36881,37041,37476,37558,39378,39493,40169,40407,40860,22283,23616,
+33738,38816,38827,40628,21531,31384,32676,35033,36557,37089,22528,23624,
+25496,31391,23470,24339,31353,31406,33422,36524,20518,21048,21240,21367,
+22280,25331,25458,27402,28099,30519,21413,29527,34152,36470,38357,26426,
+27331,28528,35437,36556,39243,26231,27512,36020,39740,21483,22317,22862,
+25542,27131,29674,30789,31418,31429,31998,33909,35215,36211,36917,38312,
+21243,22343,30023,31584,33740,37406,27224,20811,21067,21127,25119,26840,
+26997,38553,20677,21156,21220,25027,26020,26681,27135,29822,31563,33465,
+33771,35250,35641,36817,39241,20170,22935,25810,26129,27278,29748,31105,
+31165,33449,35167,37670,20235,21450,24613,25201,27762,32026,32102,20120,
+20834,30684,32943,20225,20238,20854,20864,21980,22120,22331,22522,22524,
+22804,22855,22931,23492,23696,23822,24049,24190,24524,25216,26071,26083,
+26462,26827,26820,27231,27450,27683,27773,27778,28103,29592,29734,29738,
+29826,29859,30072,30079,30849,30959,31041,31098,31637,32000,32186,32648,
+32774,32813,32908,35352,35663,35912,36215,37665,37668,39138,39249,39525,
+40594,32202,20342,21513,25326,26708,37329,21931,20794,23068,25062,25295,
+25343,37027,35582,26262,29014,38627,25423,25466,21335,26511,26976,28275,
+30007,32013,34930,22218,23064,20035,20839,22856,26608,32784,22899,24180,
+25754,31178,24565,24684,25288,25467,23527,23511,21162,22900,24361,24594,
+29785,39377,28611,33215,36786,24817,33126,23615,23273,35365,26491,32016,
+33021,23612,27877,21311,28346,22810,33590,20025,20150,20294,21934,22296,
+22727,24406,26039,26086,27264,27573,28237,30701,31471,31774,32222,34507,
+34962,37170,37723,25787,28606,29562,30136,36948,21846,22349,25018,25812,
+26311,28129,28251,28525,28601,30192,32835,33213,34113,35203,35527,35674,
+37663,27795,30035,31572,36367,36957,21776,22530,22616,24162,25095,25758,
+26848,30070,31958,34739,40680,20195,22408,22382,22823,23565,23729,24118,
+24453,25140,25825,29619,33274,34955,36024,38538,40667,23429,24503,24755,
+20498,20992,21040,22294,22581,22615,23566,23648,23798,23947,24230,24466,
+24764,25361,25481,25623,26691,26873,27330,28120,28193,28372,28644,29182,
+30428,30585,31153,31291,33796,35241,36077,36339,36424,36867,36884,36947,
+37117,37709,38518,38876,27602,28678,29272,29346,29544,30563,31167,31716,
+32411,35712,22697,24775,25958,26109,26302,27788,28958,29129,35930,38931,
+20077,31361,20189,20908,20941,21205,21516,24999,26481,26704,26847,27934,
+28540,30140,30643,31461,33012,33891,37509,20828,26007,26460,26515,30168,
+31431,33651,35910,36887,38957,23663,33216,33434,36929,36975,37389,24471,
+23965,27225,29128,30331,31561,34276,35588,37159,39472,21895,25078,30313,
+32645,34367,34746,35064,37007,27931,28889,29662,32097,33853,37226,39409,
+20098,21365,27396,27410,28734,29211,34349,40478,21068,36771,23888,25829,
+25900,27414,28651,31811,32412,34253,35172,35261,25289,33240,34847,24266,
+26391,28010,29436,29701,29807,34690,37086,20358,23821,24480,33802,20919,
+25504,30053,20142,20486,20841,20937,26753,27153,31918,31921,31975,33391,
+35538,36635,37327,20406,20791,21237,21570,24300,24942,25150,26053,27354,
+28670,31018,34268,34851,38317,39522,39530,40599,40654,21147,26310,27511,
+28701,31019,36706,38722,24976,25088,25891,28451,29001,29833,32244,32879,
+34030,36646,36899,37706,20925,21015,21155,27916,28872,35010,24265,25986,
+27566,28610,31806,29557,20196,20278,22265,23738,23994,24604,29618,31533,
+32666,32718,32838,36894,37428,38646,38728,38936,40801,20363,28583,31150,
+37300,38583,21214,25736,25796,27347,28510,28696,29200,30439,32769,34310,
+34396,36335,36613,38706,39791,40442,40565,30860,31103,32160,33737,37636,
+40575,40595,35542,22751,24324,26407,28711,29903,31840,32894,20769,28712,
+29282,30922,36034,36058,36084,38647,20102,20698,23534,24278,26009,29134,
+30274,30637,32842,34044,36988,39719,40845,22744,23105,23650,27155,28122,
+28431,30267,32047,32311,34078,35128,37860,38475,21129,26066,26611,27060,
+27969,28316,28687,29705,29792,30041,30244,30827,35628,39006,20845,25134,
+38520,20374,20523,23833,28138,32184,36650,24459,24900,26647,38534,21202,
+32907,20956,20940,26974,31260,32190,33777,38517,20442,21033,21400,21519,
+21774,23653,24743,26446,26792,28012,29313,29432,29702,29827,30178,31852,
+32633,32696,33673,35023,35041,37324,37328,38626,39881,21533,28542,29136,
+29848,34298,36522,38563,40023,40607,26519,28107,29747,33256,38678,30764,
+31435,31520,31890,25705,29802,30194,30908,30952,39340,39764,40635,23518,
+24149,28448,33180,33707,37000,19975,21325,23081,24018,24398,24930,25405,
+26217,26364,28415,28459,28771,30622,33836,34067,34875,36627,39237,39995,
+21788,25273,26411,27819,33545,35178,38778,20129,22916,26395,32178,32596,
+33426,33579,33725,36638,37017,22475,22969,23186,23504,26151,26522,26757,
+27599,29028,32629,36023,36067,36993,39749,33032,35978,38476,39488,40613,
+23391,27667,29467,30450,30431,33804,20906,35219,20813,20885,21193,26825,
+27796,30468,30496,32191,32236,38754,40629,28357,34065,20901,21517,21629,
+26126,26269,26919,28319,30399,30609,33559,33986,34719,37225,37528,40180,
+34946,20398,20882,21215,22982,24125,24917,26286,26576,27169,27597,27611,
+29279,29281,29761,30520,30683,32791,33468,33541,35584,35624,35980,26408,
+27792,29287,30446,30566,31302,40361,27519,27794,22818,26406,33945,21359,
+22675,22937,24287,25551,26164,26483,28218,29483,31447,33495,37672,21209,
+24043,25006,25035,25098,25287,25771,26080,26969,27494,27595,28961,29687,
+30045,32326,33310,33538,34154,35491,36031,38695,40289,22696,40664,20497,
+21006,21563,21839,25991,27766,32862,34442,38272,38639,21247,27797,29289,
+21619,23194,23614,23883,24396,24494,26410,26806,26979,28220,28228,30473,
+31859,32654,34183,35598,36855,38753,40692,23735,24758,24845,25003,25935,
+27665,27887,29599,29641,32225,38292,23494,34588,35600,21085,21338,25293,
+25615,25778,26420,27192,27850,29632,29854,31636,31893,32283,33162,33334,
+34180,36843,38649,39361,20276,21322,21453,21467,25292,25644,25856,26001,
+27075,27886,28504,29677,30036,30242,30436,30460,30928,30971,31020,32070,
+33324,34784,36820,38930,39151,21187,25300,25765,28196,28497,30332,36299,
+37297,37474,39662,39747,20515,20621,22346,22952,23592,24135,24439,25151,
+25918,26041,26049,26121,26507,27036,28354,30917,32033,32938,33152,33323,
+33459,33953,34444,35370,35607,37030,38450,40848,20493,20467,22521,24472,
+25308,25490,26479,28227,28953,30403,32972,32986,35097,36064,36649,37197,
+38506,20271,20336,24091,26575,26658,39748,24161,27146,29033,29140,30058,
+32321,34115,34281,39132,20240,31567,32624,38309,20961,24070,26805,27710,
+27726,27867,29359,31684,33539,27861,29754,20731,21128,22721,25816,27287,
+29863,30294,30887,34327,38370,38713,21342,24321,35722,36776,36783,37002,
+21029,30629,40009,40712,19993,20482,20853,23643,24183,26142,26170,26564,
+26821,28851,29953,30149,31177,31453,36647,39200,39432,20445,22561,22577,
+23542,26222,27493,27921,28282,28541,29668,29995,33769,35036,35091,35676,
+36628,20239,20693,21264,21340,23443,24489,26381,31119,33145,33583,34068,
+35079,35206,36665,36667,39333,39954,26412,20086,20472,22857,23553,25447,
+26834,28925,29090,29739,32299,34028,34562,36898,37586,40179,19981,20184,
+20463,20613,21078,21103,21542,21648,22496,22827,23142,23386,23413,23500,
+24220,25206,25975,26023,28014,28325,29238,31526,31807,32566,33178,33344,
+33433,33705,35331,36000,36070,36091,36212,36282,37096,37340,38428,38468,
+39385,40167,21271,20998,21545,22132,22707,22868,22894,24575,24996,25198,
+26128,27774,28954,30406,31881,31966,32027,33452,36033,38640,20315,24343,
+24447,25282,23849,26379,26842,30844,32323,40300,19989,20633,21269,21290,
+21329,22915,23138,24199,24754,24970,25161,25209,26000,26503,27047,27604,
+27832,29749,30202,30738,30865,31189,31192,31875,32203,32737,32933,33086,
+33218,33778,34586,35048,35513,35692,36027,37145,38750,39131,40763,22188,
+23338,24428,25996,27315,27567,27996,28657,28693,29277,29613,36007,36051,
+38971,24977,27703,32856,39425,20045,20107,20123,20181,20282,20284,20351,
+20447,20735,21490,21496,21766,21987,22235,22763,22882,23057,23531,23546,
+23556,24051,24107,24473,24605,25448,26012,26031,26614,26619,26797,27515,
+27801,27863,28195,28681,29509,30722,31038,31040,31072,31169,31721,32023,
+32114,32902,33293,33678,34001,34503,35039,35408,35422,35613,36060,36198,
+36781,37034,39164,39391,40605,21066,26388,20632,21034,23665,25955,27733,
+29642,29987,30109,31639,33948,37240,38704,20087,25746,27578,29022,34217,
+19977,26441,26862,28183,33439,34072,34923,25591,28545,37394,39087,19978,
+20663,20687,20767,21830,21930,22039,23360,23577,23776,24120,24202,24224,
+24258,24819,26705,27233,28248,29245,29248,29376,30456,31077,31665,32724,
+35059,35316,35443,35937,36062,38684,22622,29885,36093,21959,31329,32034,
+33394,29298,29983,29989,31513,22661,22779,23996,24207,24246,24464,24661,
+25234,25471,25933,26257,26329,26360,26646,26866,29312,29790,31598,32110,
+32214,32626,32997,33298,34223,35199,35475,36893,37604,40653,40736,22805,
+22893,24109,24796,26132,26227,26512,27728,28101,28511,30707,30889,33990,
+37323,37675,20185,20682,20808,21892,23307,23459,25159,25982,26059,28210,
+29053,29697,29764,29831,29887,30316,31146,32218,32341,32680,33146,33203,
+33337,34330,34796,35445,36323,36984,37521,37925,39245,39854,21352,23633,
+26964,27844,27945,28203,33292,34203,35131,35373,35498,38634,40807,21089,
+26297,27570,32406,34814,36109,38275,38493,25885,28041,29166,22478,22995,
+23468,24615,24826,25104,26143,26207,29481,29689,30427,30465,31596,32854,
+32882,33125,35488,37266,19990,21218,27506,27927,31237,31545,32048,36016,
+21484,22063,22609,23477,23567,23569,24034,25152,25475,25620,26157,26803,
+27836,28040,28335,28703,28836,29138,29990,30095,30094,30233,31505,31712,
+31787,32032,32057,34092,34157,34311,35380,36877,36961,37045,37559,38902,
+39479,20439,23660,26463,28049,31903,32396,35606,36118,36895,23403,24061,
+25613,33984,36956,39137,29575,23435,24730,26494,28126,35359,35494,36865,
+38924,21047,28753,30862,37782,34928,37335,20462,21463,22013,22234,22402,
+22781,23234,23432,23723,23744,24101,24833,25101,25163,25480,25628,25910,
+25976,27193,27530,27700,27929,28465,29159,29417,29560,29703,29874,30246,
+30561,31168,31319,31466,31929,32143,32172,32353,32670,33065,33585,33936,
+34010,34282,34966,35504,35728,36664,36930,36995,37228,37526,37561,38539,
+38614,38656,38920,39318,39635,39706,21460,22654,22809,23408,23487,28113,
+28506,29087,29729,29881,32901,33789,24033,24455,24490,24642,26092,26642,
+26991,27219,27529,27957,28147,29667,30462,30636,31565,32020,33059,33308,
+33600,34036,34147,35426,35524,37255,37662,38918,39348,25100,34899,36848,
+37477,23815,23847,23913,29791,33181,34664,28629,25342,32722,35126,35186,
+19998,20056,20711,21213,21319,25215,26119,32361,34821,38494,20365,21273,
+22070,22987,23204,23608,23630,23629,24066,24337,24643,26045,26159,26178,
+26558,26612,29468,30690,31034,32709,33940,33997,35222,35430,35433,35553,
+35925,35962,22516,23508,24335,24687,25325,26893,27542,28252,29060,31698,
+34645,35672,36606,39135,39166,20280,20353,20449,21627,23072,23480,24892,
+26032,26216,29180,30003,31070,32051,33102,33251,33688,34218,34254,34563,
+35338,36523,36763,36805,22833,23460,23526,24713,23529,23563,24515,27777,
+28145,28683,29978,33455,35574,20160,21313,38617,27663,20126,20420,20818,
+21854,23077,23784,25105,29273,33469,33706,34558,34905,35357,38463,38597,
+39187,40201,40285,22538,23731,23997,24132,24801,24853,25569,27138,28197,
+37122,37716,38990,39952,40823,23433,23736,25353,26191,26696,30524,38593,
+38797,38996,39839,26017,35585,36555,38332,21813,23721,24022,24245,26263,
+30284,33780,38343,22739,25276,29390,40232,20208,22830,24591,26171,27523,
+31207,40230,21395,21696,22467,23830,24859,26326,28079,30861,33406,38552,
+38724,21380,25212,25494,28082,32266,33099,38989,27387,32588,40367,40474,
+20063,20539,20918,22812,24825,25590,26928,29242,32822,37326,24369,32004,
+33509,33903,33979,34277,36493,20335,22756,23363,24665,25562,25880,25965,
+26264,26954,27171,27915,28673,29036,30162,30221,31155,31344,32650,35140,
+35731,37312,38525,39178,22276,24481,26044,28417,30208,31142,35486,39341,
+39770,40812,20740,25014,25233,27277,33222,20547,22576,24422,28937,35328,
+35578,23420,34326,20474,20796,22196,22852,25513,28153,23978,26989,20870,
+20104,20313,22914,27487,27741,29877,30998,33287,33349,33593,36671,36701,
+39192,20134,22495,24441,26131,30123,32377,35695,36870,39515,22181,22567,
+23032,23071,23476,24310,25424,25403,26941,27783,27839,28046,28051,28149,
+28436,28895,28982,29017,29123,29141,30799,30831,31605,32227,32303,34893,
+36575,37467,40182,24709,28037,29105,38321,21421,26579,28814,28976,29744,
+33398,33490,38331,39653,40573,26308,29121,33865,22603,23992,24433,26144,
+26254,27001,27054,27704,27891,28214,28481,28634,28699,28719,29008,29151,
+29552,29787,29908,30408,31310,32403,33521,35424,36814,37704,38681,20034,
+20522,21000,21473,26355,27757,28618,29450,30591,31330,33454,34269,34306,
+35028,35427,35709,35947,37555,38675,38928,20116,20237,20425,20658,21320,
+21566,21555,21978,22626,22714,22887,23067,23524,24735,25034,25942,26111,
+26212,26791,27738,28595,28879,29100,29522,31613,34568,35492,39986,40711,
+23627,27779,29508,29577,37434,28331,29797,30239,31337,32277,34314,20800,
+22725,25793,29934,29973,30320,32705,37013,38605,39252,28198,29926,33253,
+34521,34680,35355,23113,23436,23451,26785,26880,28003,29609,29715,29740,
+30871,32233,32747,33048,33109,33694,35916,38446,38929,26352,24448,26106,
+26505,27754,29579,20525,23043,27498,30702,22806,23916,24013,29477,30031,
+20709,20985,22575,22829,22934,23002,23525,23970,25303,25622,25747,25854,
+26332,27208,29183,29796,31368,31407,32327,32350,32768,33136,34799,35201,
+35616,36953,36992,39250,24958,27442,28020,32287,35109,36785,20433,20653,
+20887,21191,22471,22665,23481,24248,24898,27029,28044,28263,28342,29076,
+29794,29992,29996,32883,33592,33993,36362,37780,37854,20110,20305,20598,
+20778,21448,21451,21491,23431,23507,23588,24858,24962,26100,29275,29591,
+29760,30402,31056,31121,31161,32006,32701,33419,34261,34398,36802,36935,
+37109,37354,38533,21206,24423,26093,26161,26671,29020,31286,37057,38922,
+20113,27218,27550,28560,29065,32792,33464,34131,36939,38549,38642,38907,
+34074,39729,20112,29066,38596,20803,21407,21729,22291,22290,22435,23195,
+23236,23491,24616,24895,25588,27781,27961,28274,28304,29232,29503,29783,
+33489,34945,36677,36960,38498,39000,40219,26376,36234,37470,20301,20553,
+20702,21361,22285,22996,23041,23561,24944,26256,28205,29234,29771,32239,
+32963,33806,33894,34111,34655,34907,35096,35586,36949,38859,39759,20083,
+20369,20754,20842,21807,21929,23418,23461,24254,24736,24799,25540,25912,
+26377,26580,26586,27833,27943,28216,28641,29788,30001,30290,32173,33278,
+33848,35029,35480,35547,35565,36400,36418,36938,36926,36986,37193,37321,
+37742,22537,27603,32905,32946,20801,22891,23609,28516,29607,32996,36103,
+37399,38287,32895,25102,28700,32104,34701,22432,24681,24903,27575,35518,
+37504,38577,20057,21535,28139,34093,38512,38899,39150,25558,27875,37009,
+20957,25033,33210,40441,20381,20506,20736,23452,24847,25087,25836,26885,
+27589,30097,30691,32681,33380,34191,34811,34915,35516,35696,37291,20108,
+20197,20234,22839,23016,24050,24347,24411,24609,29246,29669,30064,30157,
+31227,32780,32819,32900,33505,33617,36029,36019,36999,39156,39180,28727,
+30410,32714,32716,32764,35610,20154,20161,20995,21360,21693,22240,23035,
+23493,24341,24525,28270,32106,33589,34451,35469,38765,38775,19968,20314,
+20350,22777,26085,28322,36920,37808,39353,20219,22764,22922,23001,24641,
+31252,33615,36035,20837,21316,20173,21097,23381,33471,20180,21050,21672,
+22985,23039,23376,23383,23388,24675,24904,28363,28825,29038,29574,29943,
+30133,30913,32043,32773,33258,33576,34071,34249,35566,36039,38604,20316,
+21242,22204,26027,26152,28796,28856,29237,32189,33421,37196,38592,40306,
+23409,26855,27544,28538,30430,23697,26283,28507,31668,31786,34870,38620,
+19976,20183,21280,22580,22715,22767,22892,23559,24115,24196,24373,25484,
+26290,26454,27167,27299,27404,28479,29254,29520,29835,31456,31911,33144,
+33247,33255,33674,33900,34083,34196,34255,35037,36115,37292,38263,38556,
+20877,21705,22312,23472,25165,26448,26685,26771,28221,28371,28797,32289,
+35009,36001,36617,40779,40782,29229,31631,35533,37658,20295,20302,20786,
+21632,22992,24213,25269,26485,26990,27159,27822,28186,29401,29482,30141,
+31672,32053,33511,33785,33879,34295,35419,36015,36487,36889,37048,38606,
+40799,21219,21514,23265,23490,25688,25973,28404,29380,30340,31309,31515,
+31821,32318,32735,33659,35627,36042,36196,36321,36447,36842,36857,36969,
+37841,20291,20346,20659,20840,20856,21069,21098,22625,22652,22880,23560,
+23637,24283,24731,25136,26643,27583,27656,28593,29006,29728,30000,30008,
+30033,30322,31564,31627,31661,31686,32399,35438,36670,36681,37439,37523,
+37666,37931,38651,39002,39019,39198,20999,25130,25240,27993,30308,31434,
+31680,32118,21344,23742,24215,28472,28857,31896,38673,39822,40670,25509,
+25722,34678,19969,20117,20141,20572,20597,21576,22979,23450,24128,24237,
+24311,24449,24773,25402,25919,25972,26060,26230,26232,26622,26984,27273,
+27491,27712,28096,28136,28191,28254,28702,28833,29582,29693,30010,30555,
+30855,31118,31243,31357,31934,32142,33351,35330,35562,35998,37165,37194,
+37336,37478,37580,37664,38662,38742,38748,38914,40718,21046,21137,21884,
+22564,24093,24351,24716,25552,26799,28639,31085,31532,33229,34234,35069,
+35576,36420,37261,38500,38555,38717,38988,40778,20430,20806,20939,21161,
+22066,24340,24427,25514,25805,26089,26177,26362,26361,26397,26781,26839,
+27133,28437,28526,29031,29157,29226,29866,30522,31062,31066,31199,31264,
+31381,31895,31967,32068,32368,32903,34299,34468,35412,35519,36249,36481,
+36896,36973,37347,38459,38613,40165,26063,31751,36275,37827,23384,23562,
+21330,25305,29469,20519,23447,24478,24752,24939,26837,28121,29742,31278,
+32066,32156,32305,33131,36394,36405,37758,37912,20304,22352,24038,24231,
+25387,32618,20027,20303,20367,20570,23005,32964,21610,21608,22014,22863,
+23449,24030,24282,26205,26417,26609,26666,27880,27954,28234,28557,28855,
+29664,30087,31820,32002,32044,32162,33311,34523,35387,35461,36208,36490,
+36659,36913,37198,37202,37956,39376,31481,31909,20426,20737,20934,22472,
+23535,23803,26201,27197,27994,28310,28652,28940,30063,31459,34850,36897,
+36981,38603,39423,33537,20013,20210,34886,37325,21373,27355,26987,27713,
+33914,22686,24974,26366,25327,28893,29969,30151,32338,33976,35657,36104,
+20043,21482,21675,22320,22336,24535,25345,25351,25711,25903,26088,26234,
+26525,26547,27490,27744,27802,28460,30693,30757,31049,31063,32025,32930,
+33026,33267,33437,33463,34584,35468,36100,36286,36978,30452,31257,31287,
+32340,32887,21767,21972,22645,25391,25634,26185,26187,26733,27035,27524,
+27941,28337,29645,29800,29857,30043,30137,30433,30494,30603,31206,32265,
+32285,33275,34095,34967,35386,36049,36587,36784,36914,37805,38499,38515,
+38663,20356,21489,23018,23241,24089,26702,29894,30142,31209,31378,33187,
+34541,36074,36300,36845,26015,26389,22519,28503,32221,36655,37878,38598,
+24501,25074,28548,19988,20376,20511,21449,21983,23919,24046,27425,27492,
+30923,31642,36425,36554,36974,25417,25662,30528,31364,37679,38015,40810,
+25776,28591,29158,29864,29914,31428,31762,32386,31922,32408,35738,36106,
+38013,39184,39244,21049,23519,25830,26413,32046,20717,21443,22649,25082,
+26028,31449,35730,35734,20489,20513,21109,21809,23100,24288,24432,24884,
+25950,26124,26166,26274,27085,28356,28466,29462,30241,31379,33081,33369,
+33750,33980,20661,22512,23488,23528,24425,25505,30758,32181,33756,34081,
+37319,37365,20874,26613,31574,36012,20932,22971,24765,34389,20508,21076,
+23610,24957,25114,25299,25842,26021,28364,30240,33034,36448,38495,38587,
+20191,21315,21912,22825,24029,25797,27849,28154,29588,31359,33307,34214,
+36068,36368,36983,37351,38369,38433,38854,20984,21746,21894,24505,25764,
+28552,32180,36639,36685,37941,20681,23574,27838,28155,29979,30651,31805,
+31844,35449,35522,22558,22974,24086,25463,29266,30090,30571,35548,36028,
+36626,24307,26228,28152,32893,33729,35531,38737,39894,21059,26367,28053,
+28399,32224,35558,36910,36958,39636,21021,21119,21736,24980,25220,25307,
+26786,26898,26970,27189,28818,28966,30813,30977,30990,31186,31245,32918,
+33400,33493,33609,34121,35970,36229,37218,37259,37294,20419,22225,29165,
+30679,34560,35320,23544,24534,26449,37032,21474,22618,23541,24740,24961,
+25696,32317,32880,34085,37507,25774,20652,23828,26368,22684,25277,25512,
+26894,27000,27166,28267,30394,31179,33467,33833,35535,36264,36861,37138,
+37195,37276,37648,37656,37786,38619,39478,39949,19985,30044,31069,31482,
+31569,31689,32302,33988,36441,36468,36600,36880,26149,26943,29763,20986,
+26414,40668,20805,24544,27798,34802,34909,34935,24756,33205,33795,36101,
+21462,21561,22068,23094,23601,28810,32736,32858,33030,33261,36259,37257,
+39519,40434,20596,20164,21408,24827,28204,23652,20360,20516,21988,23769,
+24159,24677,26772,27835,28100,29118,30164,30196,30305,31258,31305,32199,
+32251,32622,33268,34473,36636,38601,39347,40786,21063,21189,39149,35242,
+19971,26578,28422,20405,23522,26517,27784,28024,29723,30759,37341,37756,
+34756,31204,31281,24555,20182,21668,21822,22702,22949,24816,25171,25302,
+26422,26965,33333,38464,39345,39389,20524,21331,21828,22396,25176,25826,
+26219,26589,28609,28655,29730,29752,35351,37944,21585,22022,22374,24392,
+24986,27470,28760,28845,32187,35477,22890,33067,25506,30472,32829,36010,
+22612,25645,27067,23445,24081,28271,34153,20812,21488,22826,24608,24907,
+27526,27760,27888,31518,32974,33492,36294,37040,39089,25799,28580,25745,
+25860,20814,21520,22303,35342,24927,26742,30171,31570,32113,36890,22534,
+27084,33151,35114,36864,38969,20600,22871,22956,25237,36879,39722,24925,
+29305,38358,22369,23110,24052,25226,25773,25850,26487,27874,27966,29228,
+29750,30772,32631,33453,36315,38935,21028,22338,26495,29256,29923,36009,
+36774,37393,38442,20843,21485,25420,20329,21764,24726,25943,27803,28031,
+29260,29437,31255,35207,35997,24429,28558,28921,33192,24846,20415,20559,
+25153,29255,31687,32232,32745,36941,38829,39449,36022,22378,24179,26544,
+33805,35413,21536,23318,24163,24290,24330,25987,32954,34109,38281,38491,
+20296,21253,21261,21263,21638,21754,22275,24067,24598,25243,25265,25429,
+27873,28006,30129,30770,32990,33071,33502,33889,33970,34957,35090,36875,
+37610,39165,39825,24133,26292,26333,28689,29190,20469,21117,24426,24915,
+26451,27161,28418,29922,31080,34920,35961,39111,39108,39491,21697,31263,
+26963,35575,35914,39080,39342,24444,25259,30130,30382,34987,36991,38466,
+21305,24380,24517,27852,29644,30050,30091,31558,33534,39325,20047,36924,
+19979,20309,21414,22799,24264,26160,27827,29781,33655,34662,36032,36944,
+38686,39957,22737,23416,34384,35604,40372,23506,24680,24717,26097,27735,
+28450,28579,28698,32597,32752,38480,38867,21106,36676,20989,21547,21688,
+21859,21898,27323,28085,32216,33382,37532,38519,40569,21512,21704,30418,
+34532,38308,38356,38492,20130,20233,23022,23270,24055,24658,25239,26477,
+26689,27782,28207,32568,32923,33322,38917,20133,20565,21683,22419,22874,
+23401,23475,25032,26999,28023,28707,34809,35299,35442,35559,36994,39405,
+39608,21182,26680,20502,24184,26447,33607,34892,20139,21521,22190,29670,
+37141,38911,39177,39255,39321,22099,22687,34395,35377,25010,27382,29563,
+36562,27463,38570,39511,22869,29184,36203,38761,20436,23796,24358,25080,
+26203,27883,28843,29572,29625,29694,30505,30541,32067,32098,32291,33335,
+34898,36066,37449,39023,23377,31348,34880,38913,23244,20448,21332,22846,
+23805,25406,28025,29433,33029,33031,33698,37583,38960,20136,20804,21009,
+22411,24418,27842,28366,28677,28752,28847,29074,29673,29801,33610,34722,
+34913,36872,37026,37795,39336,20846,24407,24800,24935,26291,34137,36426,
+37295,38795,20046,20114,21628,22741,22778,22909,23733,24359,25142,25160,
+26122,26215,27627,28009,28111,28246,28408,28564,28640,28649,28765,29392,
+29733,29786,29920,30355,31068,31946,32286,32993,33446,33899,33983,34382,
+34399,34676,35703,35946,37804,38912,39013,24785,25110,37239,23130,26127,
+28151,28222,29759,39746,24573,24794,31503,21700,24344,27742,27859,27946,
+28888,32005,34425,35340,40251,21270,21644,23301,27194,28779,30069,31117,
+31166,33457,33775,35441,35649,36008,38772,25844,25899,31339,20024,21914,
+22864,23462,24187,24739,25563,27489,26213,26707,28185,29029,29872,32008,
+36996,39529,39973,27963,28369,29502,35905,38346,20976,24140,24488,24653,
+24822,24880,24908,27045,27841,28255,28361,28514,29004,29852,30343,31681,
+31783,33618,34647,36945,38541,40643,21295,22238,24315,24458,24674,24724,
+25079,26214,26371,27292,28142,28590,28784,29546,32362,33214,33588,34516,
+35496,36036,21123,29554,23446,27243,37892,21742,22150,23389,25928,25989,
+26313,26783,28045,28102,29243,32948,37237,39501,20399,20505,21402,21518,
+21564,21897,21957,24127,24460,26429,29030,29661,36869,21211,21235,22628,
+22734,28932,29071,29179,34224,35347,26248,34216,21927,26244,29002,33841,
+21321,21913,27585,24409,24509,25582,26249,28999,35569,36637,40638,20241,
+25658,28875,30054,34407,24676,35662,40440,20807,20982,21256,27958,33016,
+40657,26133,27427,28824,30165,21507,23673,32007,35350,27424,27453,27462,
+21560,24688,27965,32725,33288,20694,20958,21916,22123,22221,23020,23305,
+24076,24985,24984,25137,26206,26342,29081,29351,31143,31232,32690,35440,
+8229,173,8213,8741,65374,12307,65281,65292,65294,65339,65341,65343,
+8254,126,92,8988,8991,91,93,9790,9789,8225,8225,8223,
+8219,215,8734,177,8723,62,123,125,8834,8712,931,33,
+8727,42,8943,8759,8737,8773,8771,8776,8868,8875,33,176,
+39,34,8244,167,35,42,42,8258,42,8258,42,9756,
+9758,10010,10006,9775,9775,9794,8873,12342,9675,9683,9633,8962,
+9645,9645,8710,8895,8990,8787,8785,8738,8784,216,9034,8867,
+8837,8836,8713,8716,8891,22,8794,8966,36,8900,9671,8900,
+9670,9643,9633,9643,9632,9702,9675,9702,9679,9661,9651,9655,
+9665,10022,9679,9632,9674,12849,12857,13259,9347,8656,8655,8653,
+8660,8657,8659,8629,8625,8628,8624,8627,8678,8680,8679,8681,
+8636,8640,8640,8636,8678,8680,8679,8681,9757,9759,8681,34,
+12319,12317,8246,96,12289,33,12321,44,12290,44265,44267,44274,
+44276,44302,44304,44358,44360,44414,44416,44554,44556,44610,44612,44619,
+44623,44849,44851,44862,44864,45002,45004,45129,45131,45133,45142,45144,
+45198,45200,45226,45232,45234,45450,45452,45562,45564,45590,45592,45730,
+45732,45786,45788,45795,45799,45926,45928,45930,46029,46031,46038,46040,
+46042,46044,46178,46180,46262,46264,46318,46320,46962,46964,47130,47132,
+47214,47216,47298,47300,47326,47328,47354,47356,47466,47468,47494,47496,
+47550,47552,47578,47580,47690,47692,47802,47804,47886,47888,47942,47944,
+48138,48142,48144,48166,48168,48278,48280,48390,48392,48530,48532,48726,
+48728,49314,49316,49398,49400,49566,49568,49678,49680,49706,49708,49710,
+49712,49715,49790,49792,49846,49848,49902,49904,49911,49914,50490,50492,
+50574,50576,50635,50637,50639,50658,50660,50742,50744,50746,50826,50828,
+50854,50856,50882,50884,50966,50968,50994,50996,50998,51019,51022,51024,
+51093,51097,51149,51151,51218,51220,51246,51248,51330,51332,51358,51360,
+51414,51416,51470,51472,51610,51612,51666,51668,51681,51683,51918,51920,
+51922,52269,52271,52325,52327,52422,52424,52506,52508,52590,52592,52646,
+52648,52730,52732,52786,52788,52842,52844,52870,52872,53010,53012,53094,
+53096,53234,53236,53318,53320,53430,53432,53598,53600,53682,53684,53822,
+53824,54018,54020,54186,54188,54270,54272,54410,54412,54606,54608,54634,
+54636,54746,54748,54774,54776,54858,54860,54942,54944,55082,55084,55138,
+55140,55194,55196,8361,8208,169,8482,8943,8254,126,92,
+};
+
+static pdf_cmap cmap_Adobe_Korea1_UCS2 = {
+	-1, "Adobe-Korea1-UCS2", "", 0, 0, 1,
+	{ {2,0,65535}, },
+	3251, 3251, (pdf_range*) cmap_Adobe_Korea1_UCS2_ranges,
+	7967, 7967, (unsigned short*) cmap_Adobe_Korea1_UCS2_table,
+};
+
+/* KSC-EUC-H */
+
+static const pdf_range cmap_KSC_EUC_H_ranges[] = {
+{32,377,8094},{41377,373,101},{41633,273,195},{41889,373,264},
+{42145,201,358},{42197,165,409},{42401,37,451},{42416,37,461},
+{42433,93,471},{42465,93,495},{42657,269,519},{42913,313,587},
+{43169,13,666},{43174,0,670},{43176,29,671},{43185,309,679},
+{43425,373,757},{43681,329,851},{43937,341,934},{44193,129,1020},
+{44241,129,1053},{45217,373,1086},{45473,373,1180},{45729,373,1274},
+{45985,373,1368},{46241,373,1462},{46497,373,1556},{46753,373,1650},
+{47009,373,1744},{47265,373,1838},{47521,373,1932},{47777,373,2026},
+{48033,373,2120},{48289,373,2214},{48545,373,2308},{48801,373,2402},
+{49057,373,2496},{49313,373,2590},{49569,373,2684},{49825,373,2778},
+{50081,373,2872},{50337,373,2966},{50593,373,3060},{50849,373,3154},
+{51105,373,3248},{51361,373,3342},{51873,373,3436},{52129,185,3530},
+{52176,0,4116},{52177,17,3577},{52182,0,3678},{52183,61,3582},
+{52199,0,7053},{52200,89,3598},{52385,373,3621},{52641,181,3715},
+{52687,0,3460},{52688,93,3761},{52712,0,7900},{52713,85,3785},
+{52897,45,3807},{52909,0,3802},{52910,321,3819},{53153,357,3900},
+{53243,0,3902},{53244,9,3990},{53409,6,0},{53411,81,3994},
+{53432,0,3946},{53433,89,4015},{53456,0,3708},{53457,45,4038},
+{53469,0,4131},{53470,129,4050},{53665,201,4083},{53716,6,2},
+{53718,5,4134},{53720,0,4375},{53721,5,4136},{53723,21,4376},
+{53729,6,4},{53731,9,4382},{53734,6,6},{53736,13,4387},
+{53740,10,8},{53743,5,4394},{53745,6,11},{53747,9,4143},
+{53750,0,4399},{53751,9,4146},{53754,6,13},{53756,5,4406},
+{53758,0,4409},{53921,0,4150},{53922,5,4410},{53924,9,4151},
+{53927,13,4412},{53931,10,15},{53934,13,4155},{53938,0,4424},
+{53939,41,4159},{53950,0,4511},{53951,9,4170},{53954,5,4513},
+{53956,6,18},{53958,17,4518},{53963,6,20},{53965,5,4525},
+{53967,21,4528},{53973,9,4535},{53976,0,4175},{53977,5,4541},
+{53979,9,4176},{53982,5,4545},{53984,18,22},{53989,13,4566},
+{53993,5,4571},{53995,0,4576},{53996,13,4181},{54000,13,4604},
+{54004,5,4609},{54006,0,4185},{54007,5,4611},{54009,21,4186},
+{54177,373,4192},{54433,273,4286},{54502,0,4318},{54503,81,4355},
+{54524,0,4136},{54525,5,4376},{54689,13,4378},{54693,0,5800},
+{54694,17,4382},{54699,0,4139},{54700,5,4387},{54702,0,4192},
+{54703,317,4389},{54945,89,4469},{54968,0,4167},{54969,77,4492},
+{54989,0,4172},{54990,193,4512},{55201,165,4561},{55243,0,5552},
+{55244,93,4603},{55268,0,6424},{55269,101,4627},{55457,373,4653},
+{55713,373,4747},{55969,373,4841},{56225,141,4935},{56261,0,5151},
+{56262,117,4971},{56292,0,4922},{56293,101,5001},{56481,13,5027},
+{56485,0,7518},{56486,353,5031},{56737,13,5120},{56741,0,5079},
+{56742,185,5124},{56789,0,5109},{56790,117,5171},{56820,0,7607},
+{56821,37,5201},{56993,361,5211},{57084,10,27},{57249,69,5303},
+{57267,0,7083},{57268,177,5321},{57313,0,5362},{57314,21,5366},
+{57320,0,5485},{57321,85,5372},{57505,317,5394},{57585,0,6001},
+{57586,49,5474},{57761,45,5487},{57773,0,5460},{57774,249,5499},
+{57837,0,5317},{57838,65,5562},{58017,373,5579},{58273,333,5673},
+{58357,0,7009},{58358,33,5757},{58529,0,7370},{58530,25,5766},
+{58537,0,5678},{58538,337,5773},{58785,49,5858},{58798,0,5874},
+{58799,5,5871},{58801,5,4425},{58803,21,5873},{58809,6,30},
+{58811,5,4429},{58813,25,5880},{58820,0,4431},{58821,33,5887},
+{58830,18,32},{58835,9,5898},{58838,0,4439},{58839,137,5901},
+{58874,5,4442},{58876,10,37},{59041,0,4447},{59042,5,5937},
+{59044,0,4449},{59045,5,5939},{59047,0,4450},{59048,17,5941},
+{59053,6,40},{59055,9,4455},{59058,6,42},{59060,9,5948},
+{59063,5,4459},{59065,9,5951},{59068,0,4463},{59069,25,5954},
+{59076,6,44},{59078,5,4465},{59080,5,5962},{59082,0,4161},
+{59083,25,5964},{59090,0,4468},{59091,9,5971},{59094,0,4469},
+{59095,5,5974},{59097,0,4470},{59098,5,5976},{59100,0,4162},
+{59101,5,5978},{59103,10,46},{59106,5,5981},{59108,22,49},
+{59114,5,4478},{59116,0,6447},{59117,5,5985},{59119,14,55},
+{59123,5,5988},{59125,18,59},{59130,17,5991},{59297,0,4487},
+{59298,13,5996},{59302,0,4488},{59303,5,6000},{59305,18,64},
+{59310,5,6003},{59312,0,4494},{59313,53,6005},{59327,10,69},
+{59330,13,6020},{59334,6,72},{59336,9,6024},{59339,14,74},
+{59343,5,4503},{59345,5,6029},{59347,0,4506},{59348,41,6031},
+{59359,0,4508},{59360,13,6042},{59364,10,78},{59367,61,6047},
+{59383,0,5797},{59384,25,6063},{59553,277,6070},{59623,5,4551},
+{59625,25,6140},{59632,6,81},{59634,17,6147},{59639,18,83},
+{59644,5,6154},{59646,0,4557},{59809,21,6156},{59815,0,4560},
+{59816,13,6162},{59820,0,4561},{59821,121,6166},{59852,0,4563},
+{59853,165,6197},{59895,0,7988},{59896,25,6239},{60065,125,6246},
+{60097,0,6123},{60098,137,6278},{60133,0,4577},{60134,53,6313},
+{60148,0,4183},{60149,5,6327},{60151,0,4579},{60152,13,6329},
+{60156,10,88},{60321,9,6334},{60324,0,4584},{60325,5,6337},
+{60327,14,91},{60331,57,6340},{60346,5,4590},{60348,6,95},
+{60350,9,6356},{60353,6,97},{60355,9,6359},{60358,5,4596},
+{60360,13,6362},{60364,0,4599},{60365,5,6366},{60367,9,4600},
+{60370,0,5552},{60371,17,6368},{60376,0,4603},{60377,149,6373},
+{60577,17,6411},{60582,6,99},{60584,5,6416},{60586,0,4618},
+{60587,13,6418},{60591,0,5950},{60592,5,4620},{60594,0,4187},
+{60595,5,6422},{60597,0,4625},{60598,5,6424},{60600,10,101},
+{60603,17,6427},{60608,5,4632},{60610,9,6432},{60613,6,104},
+{60615,5,6435},{60617,5,4188},{60619,37,6437},{60629,0,4638},
+{60630,25,6447},{60637,5,4640},{60639,5,6454},{60641,0,4642},
+{60642,5,6456},{60644,0,4644},{60645,5,6458},{60647,5,4645},
+{60649,53,6460},{60663,5,4647},{60665,6,106},{60667,13,6475},
+{60833,9,4653},{60836,293,6479},{60910,0,5351},{60911,61,6553},
+{61089,229,6569},{61147,0,6494},{61148,137,6627},{61345,373,6662},
+{61601,373,6756},{61857,373,6850},{62113,109,6944},{62141,0,5731},
+{62142,237,6972},{62202,0,5771},{62203,13,7032},{62369,61,7036},
+{62385,0,4191},{62386,305,7052},{62625,21,7129},{62631,0,6484},
+{62632,277,7135},{62702,0,6684},{62703,61,7205},{62881,373,7221},
+{63137,329,7315},{63220,10,108},{63223,29,7399},{63393,89,7407},
+{63416,0,4247},{63417,57,7430},{63432,0,4266},{63433,37,7445},
+{63443,0,4340},{63444,169,7455},{63649,229,7498},{63707,0,7572},
+{63708,77,7556},{63728,0,5088},{63729,53,7576},{63905,373,7590},
+{64161,6,111},{64163,265,7684},{64230,0,3644},{64231,93,7751},
+{64417,373,7775},{64673,29,7869},{64681,0,3815},{64682,337,7877},
+{64929,373,7962},
+};
+
+static const unsigned short cmap_KSC_EUC_H_table[113] = {
+3993,3946,4374,4156,4138,5800,4386,4139,4140,4391,4141,4142,
+4396,4403,4149,4419,4154,4420,4517,4173,4524,4174,4179,4547,
+4550,4180,4564,5584,5302,5367,4427,5879,4435,5896,4436,5897,
+4437,4159,5936,4444,4453,5946,5947,4458,4160,5961,4471,5980,
+4472,4474,4473,4475,5983,4476,5984,4481,5987,4482,5460,4483,
+4163,4166,5990,4485,4489,4491,6002,4167,4493,4495,6019,7783,
+4497,4499,4501,6027,4502,6028,4509,6046,4510,4553,4180,4555,
+6152,5800,6153,4556,4581,6333,4582,4586,6339,4588,4184,6355,
+4592,4593,4595,4614,4616,4627,6426,4629,4634,4636,6474,4650,
+4279,7398,7139,7709,3558,
+};
+
+static pdf_cmap cmap_KSC_EUC_H = {
+	-1, "KSC-EUC-H", "", 0, 0, 2,
+	{ {1,0,128},{2,41377,65278}, },
+	393, 393, (pdf_range*) cmap_KSC_EUC_H_ranges,
+	113, 113, (unsigned short*) cmap_KSC_EUC_H_table,
+};
+
+/* KSC-EUC-V */
+
+static const pdf_range cmap_KSC_EUC_V_ranges[] = {
+{41378,5,8056},{41381,6,0},{41385,9,8059},{41389,0,8062},
+{41394,45,8063},{41451,0,8075},{41889,0,8076},{41896,5,8077},
+{41900,0,8079},{41902,0,8080},{41914,21,8081},{41947,0,8087},
+{41949,0,8088},{41951,0,8089},{41979,13,8090},
+};
+
+static const unsigned short cmap_KSC_EUC_V_table[2] = {
+8058,8320,
+};
+
+static pdf_cmap cmap_KSC_EUC_V = {
+	-1, "KSC-EUC-V", "KSC-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	15, 15, (pdf_range*) cmap_KSC_EUC_V_ranges,
+	2, 2, (unsigned short*) cmap_KSC_EUC_V_table,
+};
+
+/* KSC-H */
+
+static const pdf_range cmap_KSC_H_ranges[] = {
+{8481,373,101},{8737,273,195},{8993,373,264},{9249,201,358},
+{9301,165,409},{9505,37,451},{9520,37,461},{9537,93,471},
+{9569,93,495},{9761,269,519},{10017,313,587},{10273,13,666},
+{10278,0,670},{10280,29,671},{10289,309,679},{10529,373,757},
+{10785,329,851},{11041,341,934},{11297,129,1020},{11345,129,1053},
+{12321,373,1086},{12577,373,1180},{12833,373,1274},{13089,373,1368},
+{13345,373,1462},{13601,373,1556},{13857,373,1650},{14113,373,1744},
+{14369,373,1838},{14625,373,1932},{14881,373,2026},{15137,373,2120},
+{15393,373,2214},{15649,373,2308},{15905,373,2402},{16161,373,2496},
+{16417,373,2590},{16673,373,2684},{16929,373,2778},{17185,373,2872},
+{17441,373,2966},{17697,373,3060},{17953,373,3154},{18209,373,3248},
+{18465,373,3342},{18977,373,3436},{19233,185,3530},{19280,0,4116},
+{19281,17,3577},{19286,0,3678},{19287,61,3582},{19303,0,7053},
+{19304,89,3598},{19489,373,3621},{19745,181,3715},{19791,0,3460},
+{19792,93,3761},{19816,0,7900},{19817,85,3785},{20001,45,3807},
+{20013,0,3802},{20014,321,3819},{20257,357,3900},{20347,0,3902},
+{20348,9,3990},{20513,6,0},{20515,81,3994},{20536,0,3946},
+{20537,89,4015},{20560,0,3708},{20561,45,4038},{20573,0,4131},
+{20574,129,4050},{20769,201,4083},{20820,6,2},{20822,5,4134},
+{20824,0,4375},{20825,5,4136},{20827,21,4376},{20833,6,4},
+{20835,9,4382},{20838,6,6},{20840,13,4387},{20844,10,8},
+{20847,5,4394},{20849,6,11},{20851,9,4143},{20854,0,4399},
+{20855,9,4146},{20858,6,13},{20860,5,4406},{20862,0,4409},
+{21025,0,4150},{21026,5,4410},{21028,9,4151},{21031,13,4412},
+{21035,10,15},{21038,13,4155},{21042,0,4424},{21043,41,4159},
+{21054,0,4511},{21055,9,4170},{21058,5,4513},{21060,6,18},
+{21062,17,4518},{21067,6,20},{21069,5,4525},{21071,21,4528},
+{21077,9,4535},{21080,0,4175},{21081,5,4541},{21083,9,4176},
+{21086,5,4545},{21088,18,22},{21093,13,4566},{21097,5,4571},
+{21099,0,4576},{21100,13,4181},{21104,13,4604},{21108,5,4609},
+{21110,0,4185},{21111,5,4611},{21113,21,4186},{21281,373,4192},
+{21537,273,4286},{21606,0,4318},{21607,81,4355},{21628,0,4136},
+{21629,5,4376},{21793,13,4378},{21797,0,5800},{21798,17,4382},
+{21803,0,4139},{21804,5,4387},{21806,0,4192},{21807,317,4389},
+{22049,89,4469},{22072,0,4167},{22073,77,4492},{22093,0,4172},
+{22094,193,4512},{22305,165,4561},{22347,0,5552},{22348,93,4603},
+{22372,0,6424},{22373,101,4627},{22561,373,4653},{22817,373,4747},
+{23073,373,4841},{23329,141,4935},{23365,0,5151},{23366,117,4971},
+{23396,0,4922},{23397,101,5001},{23585,13,5027},{23589,0,7518},
+{23590,353,5031},{23841,13,5120},{23845,0,5079},{23846,185,5124},
+{23893,0,5109},{23894,117,5171},{23924,0,7607},{23925,37,5201},
+{24097,361,5211},{24188,10,27},{24353,69,5303},{24371,0,7083},
+{24372,177,5321},{24417,0,5362},{24418,21,5366},{24424,0,5485},
+{24425,85,5372},{24609,317,5394},{24689,0,6001},{24690,49,5474},
+{24865,45,5487},{24877,0,5460},{24878,249,5499},{24941,0,5317},
+{24942,65,5562},{25121,373,5579},{25377,333,5673},{25461,0,7009},
+{25462,33,5757},{25633,0,7370},{25634,25,5766},{25641,0,5678},
+{25642,337,5773},{25889,49,5858},{25902,0,5874},{25903,5,5871},
+{25905,5,4425},{25907,21,5873},{25913,6,30},{25915,5,4429},
+{25917,25,5880},{25924,0,4431},{25925,33,5887},{25934,18,32},
+{25939,9,5898},{25942,0,4439},{25943,137,5901},{25978,5,4442},
+{25980,10,37},{26145,0,4447},{26146,5,5937},{26148,0,4449},
+{26149,5,5939},{26151,0,4450},{26152,17,5941},{26157,6,40},
+{26159,9,4455},{26162,6,42},{26164,9,5948},{26167,5,4459},
+{26169,9,5951},{26172,0,4463},{26173,25,5954},{26180,6,44},
+{26182,5,4465},{26184,5,5962},{26186,0,4161},{26187,25,5964},
+{26194,0,4468},{26195,9,5971},{26198,0,4469},{26199,5,5974},
+{26201,0,4470},{26202,5,5976},{26204,0,4162},{26205,5,5978},
+{26207,10,46},{26210,5,5981},{26212,22,49},{26218,5,4478},
+{26220,0,6447},{26221,5,5985},{26223,14,55},{26227,5,5988},
+{26229,18,59},{26234,17,5991},{26401,0,4487},{26402,13,5996},
+{26406,0,4488},{26407,5,6000},{26409,18,64},{26414,5,6003},
+{26416,0,4494},{26417,53,6005},{26431,10,69},{26434,13,6020},
+{26438,6,72},{26440,9,6024},{26443,14,74},{26447,5,4503},
+{26449,5,6029},{26451,0,4506},{26452,41,6031},{26463,0,4508},
+{26464,13,6042},{26468,10,78},{26471,61,6047},{26487,0,5797},
+{26488,25,6063},{26657,277,6070},{26727,5,4551},{26729,25,6140},
+{26736,6,81},{26738,17,6147},{26743,18,83},{26748,5,6154},
+{26750,0,4557},{26913,21,6156},{26919,0,4560},{26920,13,6162},
+{26924,0,4561},{26925,121,6166},{26956,0,4563},{26957,165,6197},
+{26999,0,7988},{27000,25,6239},{27169,125,6246},{27201,0,6123},
+{27202,137,6278},{27237,0,4577},{27238,53,6313},{27252,0,4183},
+{27253,5,6327},{27255,0,4579},{27256,13,6329},{27260,10,88},
+{27425,9,6334},{27428,0,4584},{27429,5,6337},{27431,14,91},
+{27435,57,6340},{27450,5,4590},{27452,6,95},{27454,9,6356},
+{27457,6,97},{27459,9,6359},{27462,5,4596},{27464,13,6362},
+{27468,0,4599},{27469,5,6366},{27471,9,4600},{27474,0,5552},
+{27475,17,6368},{27480,0,4603},{27481,149,6373},{27681,17,6411},
+{27686,6,99},{27688,5,6416},{27690,0,4618},{27691,13,6418},
+{27695,0,5950},{27696,5,4620},{27698,0,4187},{27699,5,6422},
+{27701,0,4625},{27702,5,6424},{27704,10,101},{27707,17,6427},
+{27712,5,4632},{27714,9,6432},{27717,6,104},{27719,5,6435},
+{27721,5,4188},{27723,37,6437},{27733,0,4638},{27734,25,6447},
+{27741,5,4640},{27743,5,6454},{27745,0,4642},{27746,5,6456},
+{27748,0,4644},{27749,5,6458},{27751,5,4645},{27753,53,6460},
+{27767,5,4647},{27769,6,106},{27771,13,6475},{27937,9,4653},
+{27940,293,6479},{28014,0,5351},{28015,61,6553},{28193,229,6569},
+{28251,0,6494},{28252,137,6627},{28449,373,6662},{28705,373,6756},
+{28961,373,6850},{29217,109,6944},{29245,0,5731},{29246,237,6972},
+{29306,0,5771},{29307,13,7032},{29473,61,7036},{29489,0,4191},
+{29490,305,7052},{29729,21,7129},{29735,0,6484},{29736,277,7135},
+{29806,0,6684},{29807,61,7205},{29985,373,7221},{30241,329,7315},
+{30324,10,108},{30327,29,7399},{30497,89,7407},{30520,0,4247},
+{30521,57,7430},{30536,0,4266},{30537,37,7445},{30547,0,4340},
+{30548,169,7455},{30753,229,7498},{30811,0,7572},{30812,77,7556},
+{30832,0,5088},{30833,53,7576},{31009,373,7590},{31265,6,111},
+{31267,265,7684},{31334,0,3644},{31335,93,7751},{31521,373,7775},
+{31777,29,7869},{31785,0,3815},{31786,337,7877},{32033,373,7962},
+};
+
+static const unsigned short cmap_KSC_H_table[113] = {
+3993,3946,4374,4156,4138,5800,4386,4139,4140,4391,4141,4142,
+4396,4403,4149,4419,4154,4420,4517,4173,4524,4174,4179,4547,
+4550,4180,4564,5584,5302,5367,4427,5879,4435,5896,4436,5897,
+4437,4159,5936,4444,4453,5946,5947,4458,4160,5961,4471,5980,
+4472,4474,4473,4475,5983,4476,5984,4481,5987,4482,5460,4483,
+4163,4166,5990,4485,4489,4491,6002,4167,4493,4495,6019,7783,
+4497,4499,4501,6027,4502,6028,4509,6046,4510,4553,4180,4555,
+6152,5800,6153,4556,4581,6333,4582,4586,6339,4588,4184,6355,
+4592,4593,4595,4614,4616,4627,6426,4629,4634,4636,6474,4650,
+4279,7398,7139,7709,3558,
+};
+
+static pdf_cmap cmap_KSC_H = {
+	-1, "KSC-H", "", 0, 0, 1,
+	{ {2,8481,32382}, },
+	392, 392, (pdf_range*) cmap_KSC_H_ranges,
+	113, 113, (unsigned short*) cmap_KSC_H_table,
+};
+
+/* KSC-Johab-H */
+
+static const pdf_range cmap_KSC_Johab_H_ranges[] = {
+{32,377,1},{33858,25,358},{33865,33,366},{33875,0,375},
+{33876,17,377},{33881,17,383},{33889,0,388},{33921,0,389},
+{33953,0,390},{33985,0,391},{34017,0,392},{34113,0,393},
+{34145,0,394},{34177,0,395},{34209,0,396},{34241,0,397},
+{34273,0,398},{34369,0,399},{34401,0,400},{34433,0,401},
+{34465,0,402},{34497,0,403},{34529,0,404},{34625,0,405},
+{34657,0,406},{34689,0,407},{34721,0,408},{34881,0,358},
+{34913,5,1086},{34915,5,9333},{34917,0,1088},{34918,5,9335},
+{34920,13,1089},{34924,17,9337},{34929,0,1093},{34931,25,1094},
+{34938,0,9342},{34939,9,1101},{34945,5,1104},{34947,5,9343},
+{34949,0,1106},{34950,9,9345},{34953,0,1107},{34954,25,9348},
+{34961,0,1108},{34963,6,0},{34965,9,1110},{34968,21,9356},
+{34977,5,1113},{34979,5,9362},{34981,0,1115},{34982,9,9364},
+{34985,0,1116},{34986,29,9367},{34995,5,9375},{34997,10,2},
+{35000,21,9378},{35009,0,1119},{35010,9,9384},{35013,0,1120},
+{35014,9,9387},{35017,0,1121},{35018,29,9390},{35027,41,9398},
+{35041,5,1122},{35043,5,9409},{35045,0,1124},{35046,5,9411},
+{35048,5,1125},{35050,6,5},{35052,17,9414},{35057,0,1128},
+{35059,6,7},{35061,13,1130},{35065,5,9420},{35067,9,1134},
+{35137,0,1137},{35138,9,9422},{35141,0,1138},{35142,9,9425},
+{35145,0,1139},{35146,25,9428},{35153,0,1140},{35155,6,9},
+{35157,9,1142},{35160,21,9436},{35169,9,1145},{35172,6,11},
+{35174,5,9443},{35176,5,1149},{35178,25,9445},{35185,0,1151},
+{35187,6,13},{35189,9,1153},{35192,9,9453},{35195,0,1156},
+{35196,5,9456},{35201,0,1157},{35202,9,9458},{35205,0,1158},
+{35206,9,9461},{35209,0,1159},{35210,29,9464},{35219,10,15},
+{35222,29,9473},{35233,5,1162},{35235,5,9481},{35237,0,1164},
+{35238,5,9483},{35240,5,1165},{35242,14,18},{35246,5,9487},
+{35248,5,1169},{35251,14,22},{35255,5,1173},{35257,17,9491},
+{35265,5,1175},{35267,5,9496},{35269,0,1177},{35270,9,9498},
+{35273,10,26},{35276,17,9502},{35281,0,1180},{35283,18,29},
+{35288,21,9509},{35297,0,1184},{35298,9,9515},{35301,0,1185},
+{35302,9,9518},{35305,0,1186},{35306,29,9521},{35315,0,1187},
+{35316,5,9529},{35318,5,1188},{35320,21,9531},{35393,5,1190},
+{35395,5,9537},{35397,0,1192},{35398,9,9539},{35401,0,1193},
+{35402,25,9542},{35409,0,1194},{35411,18,34},{35416,21,9551},
+{35425,0,1198},{35426,9,9557},{35429,0,1199},{35430,9,9560},
+{35433,0,1200},{35434,29,9563},{35443,10,39},{35446,29,9572},
+{35457,5,1203},{35459,5,9580},{35461,0,1205},{35462,5,9582},
+{35464,13,1206},{35468,13,9584},{35472,5,1210},{35475,14,42},
+{35479,5,1214},{35481,17,9590},{35489,5,1216},{35491,5,9595},
+{35493,0,1218},{35494,9,9597},{35497,0,1219},{35498,29,9600},
+{35507,9,9608},{35510,5,1220},{35512,21,9611},{35521,0,1222},
+{35522,61,9617},{35539,5,9633},{35541,0,1223},{35542,29,9635},
+{35553,5,1224},{35555,5,9643},{35557,0,1226},{35558,9,9645},
+{35561,0,1227},{35562,25,9648},{35569,0,1228},{35571,10,46},
+{35574,29,9656},{35649,0,1231},{35650,9,9664},{35653,0,1232},
+{35654,9,9667},{35657,0,1233},{35658,29,9670},{35667,41,9678},
+{35681,5,1234},{35683,5,9689},{35685,0,1236},{35686,5,9691},
+{35688,9,1237},{35691,21,9693},{35697,0,1240},{35699,18,49},
+{35704,21,9701},{35713,0,1244},{35714,61,9707},{35731,41,9723},
+{35745,5,1245},{35747,5,9734},{35749,0,1247},{35750,5,9736},
+{35752,5,1248},{35754,6,54},{35756,17,9739},{35761,0,1251},
+{35763,14,56},{35767,5,1254},{35769,9,9746},{35772,6,60},
+{35905,0,359},{35937,9,1257},{35940,6,62},{35942,9,9751},
+{35945,10,64},{35948,17,9755},{35953,0,1263},{35955,6,67},
+{35957,9,1265},{35960,9,9761},{35963,0,1268},{35964,5,9764},
+{35969,5,1269},{35971,5,9766},{35973,0,1271},{35974,9,9768},
+{35977,0,1272},{35978,25,9771},{35985,0,1273},{35987,6,69},
+{35989,9,1275},{35992,21,9779},{36001,5,1278},{36003,21,9785},
+{36009,0,1280},{36010,29,9791},{36019,41,9799},{36033,65,9810},
+{36051,41,9827},{36065,9,1281},{36068,6,71},{36070,9,9839},
+{36073,0,1285},{36074,25,9842},{36081,0,1286},{36083,6,73},
+{36085,9,1288},{36088,21,9850},{36161,5,1291},{36163,5,9856},
+{36165,0,1293},{36166,41,9858},{36177,0,1294},{36179,5,9869},
+{36181,10,75},{36184,21,9872},{36193,0,1297},{36194,9,9878},
+{36197,0,1298},{36198,9,9881},{36201,0,1299},{36202,29,9884},
+{36211,5,9892},{36213,5,1300},{36215,13,9894},{36219,0,1302},
+{36220,5,9898},{36225,0,1303},{36226,61,9900},{36243,41,9916},
+{36257,5,1304},{36259,5,9927},{36261,18,78},{36266,25,9931},
+{36273,0,1309},{36275,14,83},{36279,9,1312},{36282,13,9940},
+{36289,5,1315},{36291,21,9944},{36297,0,1317},{36298,29,9950},
+{36307,9,9958},{36310,5,1318},{36312,21,9961},{36321,5,1320},
+{36323,57,9967},{36339,13,9982},{36343,0,1322},{36344,21,9986},
+{36417,0,1323},{36418,9,9992},{36421,0,1324},{36422,9,9995},
+{36425,0,1325},{36426,25,9998},{36433,0,1326},{36435,0,1327},
+{36436,9,10005},{36439,0,1328},{36440,21,10008},{36449,0,1329},
+{36450,61,10014},{36467,41,10030},{36481,5,1330},{36483,5,10041},
+{36485,0,1332},{36486,9,10043},{36489,0,1333},{36490,21,10046},
+{36496,5,1334},{36499,14,87},{36503,5,1338},{36505,17,10054},
+{36513,0,1340},{36514,25,10059},{36521,0,1341},{36522,29,10066},
+{36531,9,10074},{36534,5,1342},{36536,21,10077},{36545,5,1344},
+{36547,5,10083},{36549,0,1346},{36550,9,10085},{36553,0,1347},
+{36554,25,10088},{36561,0,1348},{36563,0,1349},{36564,5,10095},
+{36566,0,1350},{36567,25,10097},{36577,0,1351},{36578,9,10104},
+{36581,0,1352},{36582,9,10107},{36585,0,1353},{36586,25,10110},
+{36593,0,1354},{36595,0,1355},{36596,37,10117},{36673,0,1356},
+{36674,61,10127},{36691,41,10143},{36705,5,1357},{36707,5,10154},
+{36709,26,91},{36716,13,10159},{36720,5,1363},{36723,18,98},
+{36728,9,10165},{36731,0,1368},{36732,5,10168},{36737,65,10170},
+{36755,41,10187},{36769,5,1369},{36771,5,10198},{36773,0,1371},
+{36774,9,10200},{36777,0,1372},{36778,25,10203},{36785,0,1373},
+{36787,18,103},{36792,21,10212},{36929,0,361},{36961,9,1377},
+{36964,6,108},{36966,5,10219},{36968,13,1381},{36972,17,10221},
+{36977,0,1385},{36979,6,110},{36981,17,1387},{36986,14,112},
+{36993,5,1394},{36995,5,10229},{36997,0,1396},{36998,9,10231},
+{37001,0,1397},{37002,25,10234},{37009,0,1398},{37011,6,116},
+{37013,9,1400},{37016,21,10242},{37025,5,1403},{37027,5,10248},
+{37029,0,1405},{37030,9,10250},{37033,0,1406},{37034,25,10253},
+{37041,0,1407},{37043,13,10260},{37047,0,1408},{37048,21,10264},
+{37057,65,10270},{37075,41,10287},{37089,5,1409},{37091,0,10298},
+{37092,5,1411},{37094,9,10299},{37097,6,118},{37099,5,1414},
+{37101,13,10303},{37105,0,1416},{37107,6,120},{37109,9,1418},
+{37112,17,10308},{37117,0,1421},{37185,5,1422},{37187,5,10313},
+{37189,0,1424},{37190,9,10315},{37193,0,1425},{37194,25,10318},
+{37201,0,1426},{37203,6,122},{37205,9,1428},{37208,21,10326},
+{37217,5,1431},{37219,5,10332},{37221,0,1433},{37222,9,10334},
+{37225,0,1434},{37226,25,10337},{37233,0,1435},{37235,0,1436},
+{37236,5,10344},{37238,5,1437},{37240,5,10346},{37242,0,1439},
+{37243,9,10348},{37249,0,1440},{37250,9,10351},{37253,0,1441},
+{37254,45,10354},{37267,41,10366},{37281,5,1442},{37283,5,10377},
+{37285,0,1444},{37286,9,10379},{37289,10,124},{37292,17,10383},
+{37297,0,1447},{37299,18,127},{37304,13,10390},{37308,5,1451},
+{37313,0,1453},{37314,9,10394},{37317,0,1454},{37318,9,10397},
+{37321,0,1455},{37322,29,10400},{37331,9,10408},{37334,0,1456},
+{37335,25,10411},{37345,65,10418},{37363,41,10435},{37441,0,1457},
+{37442,9,10446},{37445,0,1458},{37446,9,10449},{37449,0,1459},
+{37450,25,10452},{37457,0,1460},{37459,10,132},{37462,29,10460},
+{37473,5,1463},{37475,5,10468},{37477,0,1465},{37478,9,10470},
+{37481,0,1466},{37482,29,10473},{37491,18,135},{37496,21,10483},
+{37505,5,1470},{37507,5,10489},{37509,0,1472},{37510,5,10491},
+{37512,5,1473},{37514,25,10493},{37521,0,1475},{37523,18,140},
+{37528,21,10502},{37537,0,1479},{37538,61,10508},{37555,9,10524},
+{37558,0,1480},{37559,25,10527},{37569,0,1481},{37570,61,10534},
+{37587,41,10550},{37601,0,1482},{37602,9,10561},{37605,0,1483},
+{37606,9,10564},{37609,0,1484},{37610,25,10567},{37617,0,1485},
+{37619,0,1486},{37620,37,10574},{37697,5,1487},{37699,21,10584},
+{37705,0,1489},{37706,25,10590},{37713,0,1490},{37715,0,1491},
+{37716,9,10597},{37719,0,1492},{37720,21,10600},{37729,5,1493},
+{37731,5,10606},{37733,0,1495},{37734,9,10608},{37737,9,1496},
+{37740,17,10611},{37745,0,1499},{37747,14,145},{37751,5,1502},
+{37753,9,10618},{37756,6,149},{37761,0,1505},{37762,9,10622},
+{37765,0,1506},{37766,9,10625},{37769,0,1507},{37770,29,10628},
+{37779,41,10636},{37793,5,1508},{37795,5,10647},{37797,0,1510},
+{37798,9,10649},{37801,10,151},{37804,17,10653},{37809,0,1513},
+{37811,18,154},{37816,13,10660},{37820,6,159},{37953,0,364},
+{37985,9,1518},{37988,6,161},{37990,5,10666},{37992,17,1522},
+{37997,9,10668},{38000,5,1527},{38003,6,163},{38005,17,1530},
+{38010,9,10672},{38013,0,1535},{38017,5,1536},{38019,5,10675},
+{38021,0,1538},{38022,9,10677},{38025,0,1539},{38026,25,10680},
+{38033,0,1540},{38035,6,165},{38037,9,1542},{38040,21,10688},
+{38049,0,1545},{38050,61,10694},{38067,41,10710},{38081,65,10721},
+{38099,41,10738},{38113,9,1546},{38116,6,167},{38118,5,10750},
+{38120,5,1550},{38122,0,10752},{38123,5,1552},{38125,13,10753},
+{38129,0,1554},{38131,26,169},{38138,5,10760},{38140,6,176},
+{38209,5,1560},{38211,5,10763},{38213,0,1562},{38214,9,10765},
+{38217,0,1563},{38218,25,10768},{38225,0,1564},{38227,6,178},
+{38229,9,1566},{38232,21,10776},{38241,0,1569},{38242,9,10782},
+{38245,0,1570},{38246,9,10785},{38249,0,1571},{38250,29,10788},
+{38259,9,10796},{38262,5,1572},{38264,21,10799},{38273,0,1574},
+{38274,9,10805},{38277,0,1575},{38278,45,10808},{38291,41,10820},
+{38305,5,1576},{38307,5,10831},{38309,0,1578},{38310,5,10833},
+{38312,5,1579},{38314,14,180},{38318,9,10837},{38321,0,1583},
+{38323,34,184},{38332,5,10844},{38337,0,1589},{38338,9,10846},
+{38341,0,1590},{38342,9,10849},{38345,0,1591},{38346,29,10852},
+{38355,41,10860},{38369,0,1592},{38370,61,10871},{38387,9,10887},
+{38390,0,1593},{38391,25,10890},{38465,0,1594},{38466,9,10897},
+{38469,0,1595},{38470,9,10900},{38473,0,1596},{38474,25,10903},
+{38481,0,1597},{38483,10,193},{38486,29,10911},{38497,0,1600},
+{38498,61,10919},{38515,41,10935},{38529,5,1601},{38531,5,10946},
+{38533,0,1603},{38534,9,10948},{38537,0,1604},{38538,25,10951},
+{38545,0,1605},{38547,18,196},{38552,21,10960},{38561,0,1609},
+{38562,61,10966},{38579,9,10982},{38582,0,1610},{38583,25,10985},
+{38593,0,1611},{38594,61,10992},{38611,13,11008},{38615,0,1612},
+{38616,21,11012},{38625,0,1613},{38626,9,11018},{38629,0,1614},
+{38630,9,11021},{38633,0,1615},{38634,29,11024},{38643,18,201},
+{38648,21,11034},{38721,0,1619},{38722,9,11040},{38725,0,1620},
+{38726,9,11043},{38729,0,1621},{38730,25,11046},{38737,0,1622},
+{38739,13,11053},{38743,0,1623},{38744,21,11057},{38753,5,1624},
+{38755,5,11063},{38757,0,1626},{38758,5,11065},{38760,5,1627},
+{38762,6,206},{38764,17,11068},{38769,0,1630},{38771,18,208},
+{38776,21,11075},{38785,0,1634},{38786,61,11081},{38803,41,11097},
+{38817,5,1635},{38819,5,11108},{38821,0,1637},{38822,5,11110},
+{38824,5,1638},{38826,25,11112},{38833,0,1640},{38835,6,213},
+{38837,13,1642},{38841,17,11120},{38977,0,365},{39009,5,1646},
+{39011,5,11125},{39013,0,1648},{39014,9,11127},{39017,0,1649},
+{39018,25,11130},{39025,0,1650},{39027,6,215},{39029,9,1652},
+{39032,17,11138},{39037,0,1655},{39041,5,1656},{39043,5,11143},
+{39045,0,1658},{39046,9,11145},{39049,0,1659},{39050,25,11148},
+{39057,0,1660},{39059,6,217},{39061,9,1662},{39064,21,11156},
+{39073,65,11162},{39091,41,11179},{39105,65,11190},{39123,41,11207},
+{39137,5,1665},{39139,5,11218},{39141,0,1667},{39142,9,11220},
+{39145,6,219},{39147,5,1669},{39149,13,11224},{39153,0,1671},
+{39155,6,221},{39157,9,1673},{39160,17,11229},{39165,0,1676},
+{39233,5,1677},{39235,5,11234},{39237,0,1679},{39238,9,11236},
+{39241,0,1680},{39242,25,11239},{39249,0,1681},{39251,6,223},
+{39253,9,1683},{39256,21,11247},{39265,0,1686},{39266,61,11253},
+{39283,9,11269},{39286,0,1687},{39287,25,11272},{39297,65,11279},
+{39315,41,11296},{39329,5,1688},{39331,5,11307},{39333,0,1690},
+{39334,9,11309},{39337,0,1691},{39338,29,11312},{39347,13,11320},
+{39351,0,1692},{39352,21,11324},{39361,0,1693},{39362,25,11330},
+{39369,0,1694},{39370,29,11337},{39379,41,11345},{39393,0,1695},
+{39394,61,11356},{39411,41,11372},{39489,0,1696},{39490,9,11383},
+{39493,0,1697},{39494,45,11386},{39507,41,11398},{39521,65,11409},
+{39539,41,11426},{39553,5,1698},{39555,5,11437},{39557,0,1700},
+{39558,9,11439},{39561,0,1701},{39562,21,11442},{39568,5,1702},
+{39571,13,11448},{39575,0,1704},{39576,21,11452},{39585,65,11458},
+{39603,41,11475},{39617,0,1705},{39618,61,11486},{39635,41,11502},
+{39649,0,1706},{39650,9,11513},{39653,0,1707},{39654,9,11516},
+{39657,0,1708},{39658,25,11519},{39665,0,1709},{39667,0,1710},
+{39668,9,11526},{39671,0,1711},{39672,21,11529},{39745,65,11535},
+{39763,41,11552},{39777,5,1712},{39779,5,11563},{39781,0,1714},
+{39782,5,11565},{39784,5,1715},{39786,25,11567},{39793,0,1717},
+{39795,10,225},{39798,29,11575},{39809,0,1720},{39810,9,11583},
+{39813,0,1721},{39814,9,11586},{39817,0,1722},{39818,25,11589},
+{39825,0,1723},{39827,0,1724},{39828,37,11596},{39841,0,1725},
+{39842,9,11606},{39845,0,1726},{39846,9,11609},{39849,0,1727},
+{39850,25,11612},{39857,0,1728},{39859,18,228},{39864,21,11621},
+{40001,0,366},{40033,5,1732},{40035,5,11627},{40037,0,1734},
+{40038,9,11629},{40041,0,1735},{40042,25,11632},{40049,0,1736},
+{40051,6,233},{40053,13,1738},{40057,9,11640},{40060,5,1742},
+{40065,5,1744},{40067,5,11643},{40069,0,1746},{40070,9,11645},
+{40073,0,1747},{40074,25,11648},{40081,0,1748},{40083,6,235},
+{40085,9,1750},{40088,21,11656},{40097,5,1753},{40099,5,11662},
+{40101,0,1755},{40102,45,11664},{40115,5,11676},{40117,10,237},
+{40120,21,11679},{40129,65,11685},{40147,41,11702},{40161,5,1758},
+{40163,5,11713},{40165,0,1760},{40166,9,11715},{40169,0,1761},
+{40170,25,11718},{40177,0,1762},{40179,6,240},{40181,9,1764},
+{40184,17,11726},{40189,0,1767},{40257,5,1768},{40259,5,11731},
+{40261,0,1770},{40262,9,11733},{40265,0,1771},{40266,25,11736},
+{40273,0,1772},{40275,18,242},{40280,21,11745},{40289,5,1776},
+{40291,5,11751},{40293,0,1778},{40294,9,11753},{40297,0,1779},
+{40298,25,11756},{40305,0,1780},{40307,6,247},{40309,9,1782},
+{40312,21,11764},{40321,0,1785},{40322,9,11770},{40325,0,1786},
+{40326,45,11773},{40339,10,249},{40342,29,11786},{40353,5,1789},
+{40355,5,11794},{40357,0,1791},{40358,9,11796},{40361,0,1792},
+{40362,25,11799},{40369,0,1793},{40371,18,252},{40376,21,11808},
+{40385,0,1797},{40386,9,11814},{40389,0,1798},{40390,45,11817},
+{40403,13,11829},{40407,0,1799},{40408,21,11833},{40417,65,11839},
+{40435,9,11856},{40438,0,1800},{40439,25,11859},{40513,0,1801},
+{40514,9,11866},{40517,0,1802},{40518,9,11869},{40521,0,1803},
+{40522,25,11872},{40529,0,1804},{40531,18,257},{40536,21,11881},
+{40545,0,1808},{40546,9,11887},{40549,0,1809},{40550,9,11890},
+{40553,0,1810},{40554,29,11893},{40563,18,262},{40568,21,11903},
+{40577,5,1814},{40579,5,11909},{40581,0,1816},{40582,9,11911},
+{40585,0,1817},{40586,25,11914},{40593,0,1818},{40595,18,267},
+{40600,21,11923},{40609,0,1822},{40610,61,11929},{40627,9,11945},
+{40630,0,1823},{40631,25,11948},{40641,0,1824},{40642,61,11955},
+{40659,41,11971},{40673,5,1825},{40675,5,11982},{40677,0,1827},
+{40678,9,11984},{40681,0,1828},{40682,25,11987},{40689,0,1829},
+{40691,5,11994},{40693,10,272},{40696,21,11997},{40769,5,1832},
+{40771,5,12003},{40773,0,1834},{40774,9,12005},{40777,0,1835},
+{40778,25,12008},{40785,0,1836},{40787,18,275},{40792,21,12017},
+{40801,5,1840},{40803,5,12023},{40805,0,1842},{40806,9,12025},
+{40809,0,1843},{40810,25,12028},{40817,0,1844},{40819,14,280},
+{40823,5,1847},{40825,5,12037},{40827,5,1849},{40829,0,12039},
+{40833,65,12040},{40851,41,12057},{40865,5,1851},{40867,5,12068},
+{40869,0,1853},{40870,9,12070},{40873,0,1854},{40874,25,12073},
+{40881,0,1855},{40883,18,284},{40888,21,12082},{41025,0,374},
+{41057,5,1859},{41059,5,12088},{41061,6,289},{41063,17,1862},
+{41068,17,12091},{41073,0,1867},{41075,14,291},{41079,5,1870},
+{41081,5,12098},{41083,10,295},{41089,5,1874},{41091,5,12101},
+{41093,0,1876},{41094,9,12103},{41097,0,1877},{41098,25,12106},
+{41105,0,1878},{41107,6,298},{41109,13,1880},{41113,17,12114},
+{41121,5,1884},{41123,21,12119},{41129,0,1886},{41130,29,12125},
+{41139,13,12133},{41143,0,1887},{41144,21,12137},{41153,65,12143},
+{41171,41,12160},{41185,5,1888},{41187,5,12171},{41189,0,1890},
+{41190,9,12173},{41193,10,300},{41196,17,12177},{41201,0,1893},
+{41203,14,303},{41207,5,1896},{41209,13,12184},{41213,0,1898},
+{41281,5,1899},{41283,5,12188},{41285,0,1901},{41286,9,12190},
+{41289,0,1902},{41290,25,12193},{41297,0,1903},{41299,6,307},
+{41301,9,1905},{41304,21,12201},{41313,5,1908},{41315,5,12207},
+{41317,0,1910},{41318,9,12209},{41321,0,1911},{41322,29,12212},
+{41331,5,12220},{41333,9,1912},{41336,6,309},{41338,13,12223},
+{41345,0,1916},{41346,61,12227},{41363,41,12243},{41377,5,1917},
+{41379,0,12254},{41380,5,1919},{41382,9,12255},{41385,10,311},
+{41388,17,12259},{41393,0,1923},{41395,18,314},{41400,21,12266},
+{41409,0,1927},{41410,9,12272},{41413,0,1928},{41414,45,12275},
+{41427,9,12287},{41430,5,1929},{41432,21,12290},{41441,65,12296},
+{41459,41,12313},{41537,0,1931},{41538,9,12324},{41541,0,1932},
+{41542,9,12327},{41545,0,1933},{41546,29,12330},{41555,18,319},
+{41560,21,12340},{41569,0,1937},{41570,9,12346},{41573,0,1938},
+{41574,9,12349},{41577,0,1939},{41578,29,12352},{41587,10,324},
+{41590,29,12361},{41601,9,1942},{41604,6,327},{41606,5,12370},
+{41608,13,1946},{41612,17,12372},{41617,0,1950},{41619,18,329},
+{41624,9,12379},{41627,10,334},{41633,0,1956},{41634,9,12383},
+{41637,0,1957},{41638,9,12386},{41641,0,1958},{41642,29,12389},
+{41651,10,337},{41654,29,12398},{41665,0,1961},{41666,61,12406},
+{41683,41,12422},{41697,0,1962},{41698,9,12433},{41701,0,1963},
+{41702,9,12436},{41705,0,1964},{41706,29,12439},{41715,41,12447},
+{41793,0,1965},{41794,9,12458},{41797,0,1966},{41798,9,12461},
+{41801,0,1967},{41802,25,12464},{41809,0,1968},{41811,5,12471},
+{41813,0,1969},{41814,29,12473},{41825,0,1970},{41826,9,12481},
+{41829,0,1971},{41830,9,12484},{41833,0,1972},{41834,25,12487},
+{41841,0,1973},{41843,5,12494},{41845,0,1974},{41846,29,12496},
+{41857,65,12504},{41875,41,12521},{41889,5,1975},{41891,5,12532},
+{41893,0,1977},{41894,5,12534},{41896,5,1978},{41898,6,340},
+{41900,17,12537},{41905,0,1981},{41907,6,342},{41909,9,1983},
+{41912,14,344},{41916,5,12545},{42049,0,375},{42081,17,1988},
+{42086,5,12547},{42088,17,1993},{42093,13,12549},{42097,0,1998},
+{42099,18,348},{42104,9,12555},{42107,0,2002},{42108,5,12558},
+{42113,5,2003},{42115,5,12560},{42117,0,2005},{42118,9,12562},
+{42121,0,2006},{42122,25,12565},{42129,0,2007},{42131,6,353},
+{42133,9,2009},{42136,9,12573},{42139,0,2012},{42140,5,12576},
+{42145,5,2013},{42147,5,12578},{42149,0,2015},{42150,45,12580},
+{42163,0,2016},{42164,37,12592},{42177,65,12602},{42195,41,12619},
+{42209,5,2017},{42211,5,12630},{42213,0,2019},{42214,5,12632},
+{42216,5,2020},{42218,6,355},{42220,17,12635},{42225,0,2023},
+{42227,14,357},{42231,5,2026},{42233,17,12642},{42305,5,2028},
+{42307,5,12647},{42309,0,2030},{42310,5,12649},{42312,5,2031},
+{42314,25,12651},{42321,0,2033},{42323,6,361},{42325,9,2035},
+{42328,21,12659},{42337,5,2038},{42339,5,12665},{42341,0,2040},
+{42342,9,12667},{42345,0,2041},{42346,29,12670},{42355,6,363},
+{42357,9,2043},{42360,9,12679},{42363,0,2046},{42364,5,12682},
+{42369,0,2047},{42370,9,12684},{42373,0,2048},{42374,45,12687},
+{42387,41,12699},{42401,9,2049},{42404,6,365},{42406,9,12711},
+{42409,0,2053},{42410,25,12714},{42417,0,2054},{42419,18,367},
+{42424,21,12723},{42433,0,2058},{42434,9,12729},{42437,0,2059},
+{42438,45,12732},{42451,9,12744},{42454,0,2060},{42455,25,12747},
+{42465,0,2061},{42466,61,12754},{42483,9,12770},{42486,0,2062},
+{42487,25,12773},{42561,5,2063},{42563,5,12780},{42565,0,2065},
+{42566,9,12782},{42569,0,2066},{42570,25,12785},{42577,0,2067},
+{42579,0,2068},{42580,37,12792},{42593,0,2069},{42594,9,12802},
+{42597,0,2070},{42598,45,12805},{42611,41,12817},{42625,5,2071},
+{42627,5,12828},{42629,0,2073},{42630,5,12830},{42632,13,2074},
+{42636,17,12832},{42641,0,2078},{42643,18,372},{42648,9,12839},
+{42651,5,2082},{42653,0,12842},{42657,0,2084},{42658,25,12843},
+{42665,0,2085},{42666,29,12850},{42675,9,12858},{42678,0,2086},
+{42679,25,12861},{42689,0,2087},{42690,61,12868},{42707,41,12884},
+{42721,5,2088},{42723,5,12895},{42725,0,2090},{42726,9,12897},
+{42729,0,2091},{42730,29,12900},{42739,13,12908},{42743,0,2092},
+{42744,21,12912},{42817,0,2093},{42818,9,12918},{42821,0,2094},
+{42822,9,12921},{42825,0,2095},{42826,25,12924},{42833,0,2096},
+{42835,5,12931},{42837,10,377},{42840,21,12934},{42849,5,2099},
+{42851,5,12940},{42853,0,2101},{42854,9,12942},{42857,0,2102},
+{42858,25,12945},{42865,0,2103},{42867,10,380},{42870,29,12953},
+{42881,65,12961},{42899,41,12978},{42913,5,2106},{42915,5,12989},
+{42917,0,2108},{42918,9,12991},{42921,10,383},{42924,17,12995},
+{42929,0,2111},{42931,14,386},{42935,9,2114},{42938,13,13002},
+{43073,0,376},{43105,5,2117},{43107,5,13006},{43109,0,2119},
+{43110,9,13008},{43113,10,390},{43116,17,13012},{43121,0,2122},
+{43123,6,393},{43125,9,2124},{43128,17,13018},{43133,0,2127},
+{43137,5,2128},{43139,5,13023},{43141,0,2130},{43142,9,13025},
+{43145,0,2131},{43146,25,13028},{43153,0,2132},{43155,6,395},
+{43157,9,2134},{43160,21,13036},{43169,5,2137},{43171,53,13042},
+{43185,0,2139},{43187,41,13056},{43201,65,13067},{43219,41,13084},
+{43233,5,2140},{43235,5,13095},{43237,0,2142},{43238,5,13097},
+{43240,5,2143},{43242,25,13099},{43249,0,2145},{43251,5,13106},
+{43253,9,2146},{43256,21,13108},{43329,0,2149},{43330,61,13114},
+{43347,13,13130},{43351,0,2150},{43352,21,13134},{43361,5,2151},
+{43363,53,13140},{43377,0,2153},{43379,6,397},{43381,9,2155},
+{43384,21,13155},{43393,65,13161},{43411,41,13178},{43425,5,2158},
+{43427,5,13189},{43429,0,2160},{43430,9,13191},{43433,0,2161},
+{43434,25,13194},{43441,0,2162},{43443,0,2163},{43444,9,13201},
+{43447,0,2164},{43448,21,13204},{43457,65,13210},{43475,41,13227},
+{43489,65,13238},{43507,41,13255},{43585,0,2165},{43586,61,13266},
+{43603,41,13282},{43617,0,2166},{43618,61,13293},{43635,13,13309},
+{43639,0,2167},{43640,21,13313},{43649,5,2168},{43651,5,13319},
+{43653,0,2170},{43654,9,13321},{43657,0,2171},{43658,25,13324},
+{43665,0,2172},{43667,5,13331},{43669,10,399},{43672,21,13334},
+{43681,65,13340},{43699,41,13357},{43713,65,13368},{43731,41,13385},
+{43745,65,13396},{43763,41,13413},{43841,0,2175},{43842,61,13424},
+{43859,13,13440},{43863,0,2176},{43864,21,13444},{43873,0,2177},
+{43874,9,13450},{43877,0,2178},{43878,9,13453},{43881,0,2179},
+{43882,25,13456},{43889,0,2180},{43891,0,2181},{43892,37,13463},
+{43905,65,13473},{43923,41,13490},{43937,5,2182},{43939,5,13501},
+{43941,0,2184},{43942,9,13503},{43945,0,2185},{43946,25,13506},
+{43953,0,2186},{43955,18,402},{43960,21,13515},{44097,0,378},
+{44129,5,2190},{44131,0,13521},{44132,5,2192},{44134,5,13522},
+{44136,13,2194},{44140,17,13524},{44145,0,2198},{44147,6,407},
+{44149,9,2200},{44152,9,13530},{44155,0,2203},{44156,5,13533},
+{44161,5,2204},{44163,5,13535},{44165,0,2206},{44166,9,13537},
+{44169,0,2207},{44170,25,13540},{44177,0,2208},{44179,6,409},
+{44181,9,2210},{44184,21,13548},{44193,5,2213},{44195,5,13554},
+{44197,0,2215},{44198,9,13556},{44201,0,2216},{44202,25,13559},
+{44209,0,2217},{44211,18,411},{44216,21,13568},{44225,0,2221},
+{44226,9,13574},{44229,0,2222},{44230,9,13577},{44233,0,2223},
+{44234,25,13580},{44241,0,2224},{44243,13,13587},{44247,0,2225},
+{44248,21,13591},{44257,17,2226},{44262,5,13597},{44264,5,2231},
+{44266,0,13599},{44267,5,2233},{44269,13,13600},{44273,0,2235},
+{44275,6,416},{44277,9,2237},{44280,13,13605},{44284,6,418},
+{44353,5,2241},{44355,5,13610},{44357,0,2243},{44358,9,13612},
+{44361,0,2244},{44362,25,13615},{44369,0,2245},{44371,6,420},
+{44373,9,2247},{44376,21,13623},{44385,5,2250},{44387,5,13629},
+{44389,0,2252},{44390,9,13631},{44393,0,2253},{44394,25,13634},
+{44401,0,2254},{44403,6,422},{44405,9,2256},{44408,21,13642},
+{44417,0,2259},{44418,9,13648},{44421,0,2260},{44422,9,13651},
+{44425,0,2261},{44426,29,13654},{44435,13,13662},{44439,0,2262},
+{44440,21,13666},{44449,9,2263},{44452,6,424},{44454,9,13673},
+{44457,10,426},{44460,17,13677},{44465,0,2269},{44467,18,429},
+{44472,9,13684},{44475,0,2273},{44476,5,13687},{44481,5,2274},
+{44483,5,13689},{44485,0,2276},{44486,9,13691},{44489,0,2277},
+{44490,29,13694},{44499,13,13702},{44503,0,2278},{44504,21,13706},
+{44513,0,2279},{44514,9,13712},{44517,0,2280},{44518,9,13715},
+{44521,0,2281},{44522,25,13718},{44529,0,2282},{44531,5,13725},
+{44533,5,2283},{44535,25,13727},{44609,0,2285},{44610,9,13734},
+{44613,0,2286},{44614,9,13737},{44617,0,2287},{44618,25,13740},
+{44625,0,2288},{44627,10,434},{44630,29,13748},{44641,5,2291},
+{44643,5,13756},{44645,0,2293},{44646,9,13758},{44649,0,2294},
+{44650,25,13761},{44657,0,2295},{44659,18,437},{44664,21,13770},
+{44673,5,2299},{44675,5,13776},{44677,0,2301},{44678,5,13778},
+{44680,5,2302},{44682,25,13780},{44689,0,2304},{44691,30,442},
+{44699,5,2309},{44701,0,13791},{44705,0,2311},{44706,61,13792},
+{44723,9,13808},{44726,0,2312},{44727,25,13811},{44737,5,2313},
+{44739,5,13818},{44741,0,2315},{44742,9,13820},{44745,0,2316},
+{44746,25,13823},{44753,0,2317},{44755,13,13830},{44759,0,2318},
+{44760,21,13834},{44769,5,2319},{44771,5,13840},{44773,0,2321},
+{44774,9,13842},{44777,0,2322},{44778,25,13845},{44785,0,2323},
+{44787,18,450},{44792,21,13854},{44865,5,2327},{44867,21,13860},
+{44873,0,2329},{44874,25,13866},{44881,0,2330},{44883,5,13873},
+{44885,10,455},{44888,21,13876},{44897,5,2333},{44899,5,13882},
+{44901,0,2335},{44902,9,13884},{44905,5,2336},{44907,21,13887},
+{44913,0,2338},{44915,18,458},{44920,21,13895},{44929,65,13901},
+{44947,41,13918},{44961,5,2342},{44963,5,13929},{44965,0,2344},
+{44966,5,13931},{44968,5,2345},{44970,21,13933},{44976,5,2347},
+{44979,18,463},{44984,13,13941},{44988,6,468},{45121,0,379},
+{45153,5,2353},{45155,0,13946},{45156,5,2355},{45158,9,13947},
+{45161,0,2357},{45162,25,13950},{45169,0,2358},{45171,0,2359},
+{45172,5,13957},{45174,5,2360},{45176,17,13959},{45181,0,2362},
+{45185,5,2363},{45187,5,13964},{45189,0,2365},{45190,9,13966},
+{45193,0,2366},{45194,25,13969},{45201,0,2367},{45203,0,2368},
+{45204,5,13976},{45206,5,2369},{45208,21,13978},{45217,65,13984},
+{45235,13,14001},{45239,0,2371},{45240,21,14005},{45249,65,14011},
+{45267,41,14028},{45281,5,2372},{45283,5,14039},{45285,0,2374},
+{45286,9,14041},{45289,10,470},{45292,17,14045},{45297,0,2377},
+{45299,0,2378},{45300,5,14050},{45302,5,2379},{45304,21,14052},
+{45377,0,2381},{45378,9,14058},{45381,0,2382},{45382,9,14061},
+{45385,0,2383},{45386,29,14064},{45395,41,14072},{45409,65,14083},
+{45427,41,14100},{45441,13,14111},{45445,0,2384},{45446,45,14115},
+{45459,41,14127},{45473,5,2385},{45475,5,14138},{45477,0,2387},
+{45478,5,14140},{45480,5,2388},{45482,6,473},{45484,17,14143},
+{45489,0,2391},{45491,0,2392},{45492,9,14148},{45495,0,2393},
+{45496,21,14151},{45505,5,2394},{45507,5,14157},{45509,0,2396},
+{45510,45,14159},{45523,9,14171},{45526,0,2397},{45527,25,14174},
+{45537,0,2398},{45538,61,14181},{45555,9,14197},{45558,0,2399},
+{45559,25,14200},{45633,0,2400},{45634,9,14207},{45637,0,2401},
+{45638,9,14210},{45641,0,2402},{45642,25,14213},{45649,0,2403},
+{45651,0,2404},{45652,37,14220},{45665,0,2405},{45666,61,14230},
+{45683,41,14246},{45697,5,2406},{45699,5,14257},{45701,0,2408},
+{45702,9,14259},{45705,0,2409},{45706,25,14262},{45713,0,2410},
+{45715,0,2411},{45716,9,14269},{45719,0,2412},{45720,21,14272},
+{45729,0,2413},{45730,61,14278},{45747,9,14294},{45750,0,2414},
+{45751,25,14297},{45761,0,2415},{45762,61,14304},{45779,41,14320},
+{45793,0,2416},{45794,9,14331},{45797,0,2417},{45798,45,14334},
+{45811,41,14346},{45889,65,14357},{45907,13,14374},{45911,0,2418},
+{45912,21,14378},{45921,5,2419},{45923,5,14384},{45925,0,2421},
+{45926,9,14386},{45929,10,475},{45932,13,14390},{45936,5,2424},
+{45939,0,2426},{45940,37,14394},{45953,0,2427},{45954,9,14404},
+{45957,0,2428},{45958,9,14407},{45961,0,2429},{45962,25,14410},
+{45969,0,2430},{45971,41,14417},{45985,5,2431},{45987,5,14428},
+{45989,0,2433},{45990,9,14430},{45993,0,2434},{45994,25,14433},
+{46001,0,2435},{46003,18,478},{46008,21,14442},{46145,0,380},
+{46177,5,2439},{46179,5,14448},{46181,9,2441},{46184,0,14450},
+{46185,9,2444},{46188,13,14451},{46192,5,2447},{46195,6,483},
+{46197,9,2450},{46200,9,14456},{46203,5,2453},{46205,0,14459},
+{46209,5,2455},{46211,5,14460},{46213,0,2457},{46214,9,14462},
+{46217,0,2458},{46218,25,14465},{46225,0,2459},{46227,6,485},
+{46229,9,2461},{46232,21,14473},{46241,5,2464},{46243,5,14479},
+{46245,0,2466},{46246,9,14481},{46249,0,2467},{46250,5,14484},
+{46252,0,2468},{46253,13,14486},{46257,0,2469},{46259,18,487},
+{46264,9,14492},{46267,10,492},{46273,0,2475},{46274,9,14496},
+{46277,0,2476},{46278,9,14499},{46281,0,2477},{46282,29,14502},
+{46291,0,2478},{46292,37,14510},{46305,5,2479},{46307,5,14520},
+{46309,5,2481},{46311,0,14522},{46312,13,2483},{46316,17,14523},
+{46321,0,2487},{46323,21,2488},{46329,18,495},{46401,5,2496},
+{46403,5,14531},{46405,0,2498},{46406,9,14533},{46409,0,2499},
+{46410,25,14536},{46417,0,2500},{46419,18,500},{46424,21,14545},
+{46433,9,2504},{46436,6,505},{46438,9,14552},{46441,6,507},
+{46443,5,2509},{46445,13,14556},{46449,0,2511},{46451,17,2512},
+{46456,9,14560},{46459,9,2517},{46465,0,2520},{46466,9,14563},
+{46469,0,2521},{46470,9,14566},{46473,0,2522},{46474,25,14569},
+{46481,0,2523},{46483,6,509},{46485,5,2525},{46487,25,14577},
+{46497,5,2527},{46499,5,14584},{46501,0,2529},{46502,9,14586},
+{46505,9,2530},{46508,6,511},{46510,5,14590},{46512,5,2534},
+{46515,26,513},{46522,13,14595},{46529,5,2540},{46531,5,14599},
+{46533,0,2542},{46534,9,14601},{46537,0,2543},{46538,25,14604},
+{46545,0,2544},{46547,6,520},{46549,9,2546},{46552,21,14612},
+{46561,5,2549},{46563,5,14618},{46565,0,2551},{46566,41,14620},
+{46577,0,2552},{46579,5,14631},{46581,10,522},{46584,21,14634},
+{46657,5,2555},{46659,5,14640},{46661,0,2557},{46662,9,14642},
+{46665,0,2558},{46666,25,14645},{46673,0,2559},{46675,18,525},
+{46680,21,14654},{46689,5,2563},{46691,5,14660},{46693,0,2565},
+{46694,9,14662},{46697,0,2566},{46698,25,14665},{46705,0,2567},
+{46707,18,530},{46712,21,14674},{46721,5,2571},{46723,5,14680},
+{46725,0,2573},{46726,9,14682},{46729,9,2574},{46732,17,14685},
+{46737,0,2577},{46739,18,535},{46744,21,14692},{46753,5,2581},
+{46755,5,14698},{46757,0,2583},{46758,9,14700},{46761,0,2584},
+{46762,25,14703},{46769,0,2585},{46771,0,2586},{46772,5,14710},
+{46774,5,2587},{46776,21,14712},{46785,5,2589},{46787,5,14718},
+{46789,0,2591},{46790,9,14720},{46793,0,2592},{46794,25,14723},
+{46801,0,2593},{46803,0,2594},{46804,9,14730},{46807,0,2595},
+{46808,21,14733},{46817,5,2596},{46819,5,14739},{46821,0,2598},
+{46822,9,14741},{46825,0,2599},{46826,25,14744},{46833,0,2600},
+{46835,18,540},{46840,21,14753},{46913,5,2604},{46915,5,14759},
+{46917,0,2606},{46918,9,14761},{46921,0,2607},{46922,25,14764},
+{46929,0,2608},{46931,26,545},{46938,13,14774},{46945,5,2613},
+{46947,5,14778},{46949,0,2615},{46950,9,14780},{46953,0,2616},
+{46954,17,14783},{46959,10,552},{46963,14,555},{46967,25,2621},
+{46977,0,2628},{46978,9,14791},{46981,0,2629},{46982,9,14794},
+{46985,0,2630},{46986,25,14797},{46993,0,2631},{46995,5,14804},
+{46997,0,2632},{46998,29,14806},{47009,5,2633},{47011,5,14814},
+{47013,0,2635},{47014,9,14816},{47017,9,2636},{47020,13,14819},
+{47024,5,2639},{47027,6,559},{47029,13,2642},{47033,9,14824},
+{47036,6,561},{47169,0,381},{47201,5,2647},{47203,5,14828},
+{47205,6,563},{47207,9,2650},{47210,6,565},{47212,17,14832},
+{47217,0,2654},{47219,6,567},{47221,13,2656},{47225,17,14838},
+{47233,5,2660},{47235,5,14843},{47237,0,2662},{47238,9,14845},
+{47241,0,2663},{47242,25,14848},{47249,0,2664},{47251,6,569},
+{47253,9,2666},{47256,21,14856},{47265,5,2669},{47267,5,14862},
+{47269,18,571},{47274,25,14866},{47281,0,2674},{47283,13,14873},
+{47287,0,2675},{47288,21,14877},{47297,0,2676},{47298,9,14883},
+{47301,0,2677},{47302,9,14886},{47305,0,2678},{47306,29,14889},
+{47315,41,14897},{47329,5,2679},{47331,5,14908},{47333,0,2681},
+{47334,9,14910},{47337,10,576},{47340,17,14914},{47345,0,2684},
+{47347,14,579},{47351,5,2687},{47353,17,14921},{47425,5,2689},
+{47427,5,14926},{47429,0,2691},{47430,9,14928},{47433,0,2692},
+{47434,25,14931},{47441,0,2693},{47443,18,583},{47448,21,14940},
+{47457,0,2697},{47458,9,14946},{47461,0,2698},{47462,9,14949},
+{47465,0,2699},{47466,25,14952},{47473,0,2700},{47475,0,2701},
+{47476,5,14959},{47478,5,2702},{47480,21,14961},{47489,0,2704},
+{47490,61,14967},{47507,41,14983},{47521,5,2705},{47523,5,14994},
+{47525,0,2707},{47526,9,14996},{47529,10,588},{47532,17,15000},
+{47537,0,2710},{47539,14,591},{47543,9,2713},{47546,9,15007},
+{47549,0,2716},{47553,5,2717},{47555,21,15010},{47561,0,2719},
+{47562,29,15016},{47571,18,595},{47576,21,15026},{47585,0,2723},
+{47586,61,15032},{47603,9,15048},{47606,5,2724},{47608,21,15051},
+{47681,0,2726},{47682,9,15057},{47685,0,2727},{47686,9,15060},
+{47689,0,2728},{47690,25,15063},{47697,0,2729},{47699,18,600},
+{47704,21,15072},{47713,5,2733},{47715,5,15078},{47717,0,2735},
+{47718,45,15080},{47731,13,15092},{47735,0,2736},{47736,21,15096},
+{47745,5,2737},{47747,5,15102},{47749,0,2739},{47750,9,15104},
+{47753,9,2740},{47756,17,15107},{47761,0,2743},{47763,18,605},
+{47768,21,15114},{47777,0,2747},{47778,61,15120},{47795,9,15136},
+{47798,0,2748},{47799,25,15139},{47809,0,2749},{47810,61,15146},
+{47827,41,15162},{47841,5,2750},{47843,5,15173},{47845,0,2752},
+{47846,9,15175},{47849,0,2753},{47850,25,15178},{47857,0,2754},
+{47859,10,610},{47862,29,15186},{47937,0,2757},{47938,9,15194},
+{47941,0,2758},{47942,9,15197},{47945,0,2759},{47946,25,15200},
+{47953,0,2760},{47955,41,15207},{47969,5,2761},{47971,5,15218},
+{47973,0,2763},{47974,9,15220},{47977,0,2764},{47978,25,15223},
+{47985,0,2765},{47987,18,613},{47992,21,15232},{48001,65,15238},
+{48019,41,15255},{48033,5,2769},{48035,5,15266},{48037,0,2771},
+{48038,5,15268},{48040,5,2772},{48042,6,618},{48044,17,15271},
+{48049,0,2775},{48051,14,620},{48055,5,2778},{48057,5,15278},
+{48059,5,2780},{48061,0,15280},{48193,0,382},{48225,5,2782},
+{48227,5,15281},{48229,18,624},{48234,5,15285},{48236,0,2787},
+{48237,13,15287},{48241,0,2788},{48243,6,629},{48245,9,2790},
+{48248,21,15292},{48257,5,2793},{48259,5,15298},{48261,0,2795},
+{48262,9,15300},{48265,0,2796},{48266,25,15303},{48273,0,2797},
+{48275,6,631},{48277,9,2799},{48280,21,15311},{48289,0,2802},
+{48290,9,15317},{48293,0,2803},{48294,45,15320},{48307,13,15332},
+{48311,0,2804},{48312,21,15336},{48321,65,15342},{48339,41,15359},
+{48353,5,2805},{48355,5,15370},{48357,0,2807},{48358,9,15372},
+{48361,0,2808},{48362,25,15375},{48369,0,2809},{48371,6,633},
+{48373,9,2811},{48376,21,15383},{48449,0,2814},{48450,61,15389},
+{48467,13,15405},{48471,0,2815},{48472,21,15409},{48481,0,2816},
+{48482,61,15415},{48499,9,15431},{48502,0,2817},{48503,25,15434},
+{48513,65,15441},{48531,41,15458},{48545,5,2818},{48547,5,15469},
+{48549,0,2820},{48550,9,15471},{48553,0,2821},{48554,25,15474},
+{48561,0,2822},{48563,26,635},{48570,13,15484},{48577,5,2827},
+{48579,21,15488},{48585,0,2829},{48586,29,15494},{48595,9,15502},
+{48598,0,2830},{48599,25,15505},{48609,0,2831},{48610,61,15512},
+{48627,9,15528},{48630,0,2832},{48631,25,15531},{48705,0,2833},
+{48706,9,15538},{48709,0,2834},{48710,9,15541},{48713,0,2835},
+{48714,25,15544},{48721,0,2836},{48723,0,2837},{48724,37,15551},
+{48737,65,15561},{48755,13,15578},{48759,0,2838},{48760,21,15582},
+{48769,5,2839},{48771,5,15588},{48773,0,2841},{48774,9,15590},
+{48777,0,2842},{48778,25,15593},{48785,0,2843},{48787,0,2844},
+{48788,9,15600},{48791,0,2845},{48792,21,15603},{48801,0,2846},
+{48802,61,15609},{48819,9,15625},{48822,5,2847},{48824,21,15628},
+{48833,65,15634},{48851,41,15651},{48865,0,2849},{48866,61,15662},
+{48883,41,15678},{48961,0,2850},{48962,61,15689},{48979,41,15705},
+{48993,0,2851},{48994,57,15716},{49009,0,2852},{49011,5,15731},
+{49013,10,642},{49016,21,15734},{49025,65,15740},{49043,41,15757},
+{49057,5,2855},{49059,5,15768},{49061,0,2857},{49062,9,15770},
+{49065,0,2858},{49066,25,15773},{49073,0,2859},{49075,0,2860},
+{49076,9,15780},{49079,5,2861},{49081,13,15783},{49085,0,2863},
+{49217,0,383},{49249,5,2864},{49251,5,15787},{49253,18,645},
+{49258,25,15791},{49265,0,2869},{49267,6,650},{49269,13,2871},
+{49273,17,15799},{49281,5,2875},{49283,5,15804},{49285,0,2877},
+{49286,9,15806},{49289,0,2878},{49290,25,15809},{49297,0,2879},
+{49299,6,652},{49301,9,2881},{49304,21,15817},{49313,0,2884},
+{49314,9,15823},{49317,18,654},{49322,25,15828},{49329,0,2888},
+{49331,13,15835},{49335,0,2889},{49336,21,15839},{49345,65,15845},
+{49363,41,15862},{49377,5,2890},{49379,5,15873},{49381,0,2892},
+{49382,9,15875},{49385,0,2893},{49386,25,15878},{49393,0,2894},
+{49395,6,659},{49397,9,2896},{49400,21,15886},{49473,5,2899},
+{49475,5,15892},{49477,0,2901},{49478,9,15894},{49481,0,2902},
+{49482,25,15897},{49489,0,2903},{49491,18,661},{49496,21,15906},
+{49505,0,2907},{49506,9,15912},{49509,0,2908},{49510,45,15915},
+{49523,9,15927},{49526,0,2909},{49527,25,15930},{49537,0,2910},
+{49538,9,15937},{49541,0,2911},{49542,45,15940},{49555,13,15952},
+{49559,0,2912},{49560,21,15956},{49569,5,2913},{49571,5,15962},
+{49573,0,2915},{49574,9,15964},{49577,0,2916},{49578,25,15967},
+{49585,0,2917},{49587,18,666},{49592,21,15976},{49601,0,2921},
+{49602,9,15982},{49605,0,2922},{49606,9,15985},{49609,0,2923},
+{49610,29,15988},{49619,13,15996},{49623,0,2924},{49624,21,16000},
+{49633,65,16006},{49651,41,16023},{49729,0,2925},{49730,9,16034},
+{49733,0,2926},{49734,9,16037},{49737,0,2927},{49738,25,16040},
+{49745,0,2928},{49747,18,671},{49752,21,16049},{49761,0,2932},
+{49762,57,16055},{49777,0,2933},{49779,41,16070},{49793,5,2934},
+{49795,5,16081},{49797,0,2936},{49798,9,16083},{49801,0,2937},
+{49802,25,16086},{49809,0,2938},{49811,18,676},{49816,21,16095},
+{49825,0,2942},{49826,61,16101},{49843,9,16117},{49846,0,2943},
+{49847,25,16120},{49857,0,2944},{49858,9,16127},{49861,0,2945},
+{49862,45,16130},{49875,41,16142},{49889,0,2946},{49890,9,16153},
+{49893,0,2947},{49894,9,16156},{49897,0,2948},{49898,25,16159},
+{49905,0,2949},{49907,18,681},{49912,21,16168},{49985,0,2953},
+{49986,9,16174},{49989,0,2954},{49990,9,16177},{49993,0,2955},
+{49994,25,16180},{50001,0,2956},{50003,13,16187},{50007,0,2957},
+{50008,21,16191},{50017,5,2958},{50019,5,16197},{50021,0,2960},
+{50022,9,16199},{50025,0,2961},{50026,25,16202},{50033,0,2962},
+{50035,18,686},{50040,21,16211},{50049,65,16217},{50067,41,16234},
+{50081,5,2966},{50083,5,16245},{50085,0,2968},{50086,5,16247},
+{50088,9,2969},{50091,21,16249},{50097,0,2972},{50099,18,691},
+{50104,21,16257},{50241,0,384},{50273,5,2976},{50275,5,16263},
+{50277,0,2978},{50278,9,16265},{50281,0,2979},{50282,25,16268},
+{50289,0,2980},{50291,18,696},{50296,21,16277},{50305,5,2984},
+{50307,5,16283},{50309,0,2986},{50310,9,16285},{50313,0,2987},
+{50314,25,16288},{50321,0,2988},{50323,6,701},{50325,9,2990},
+{50328,21,16296},{50337,5,2993},{50339,57,16302},{50355,13,16317},
+{50359,0,2995},{50360,21,16321},{50369,65,16327},{50387,41,16344},
+{50401,5,2996},{50403,5,16355},{50405,0,2998},{50406,5,16357},
+{50408,5,2999},{50410,25,16359},{50417,0,3001},{50419,6,703},
+{50421,9,3003},{50424,21,16367},{50497,5,3006},{50499,5,16373},
+{50501,0,3008},{50502,9,16375},{50505,0,3009},{50506,25,16378},
+{50513,0,3010},{50515,18,705},{50520,21,16387},{50529,0,3014},
+{50530,9,16393},{50533,0,3015},{50534,9,16396},{50537,0,3016},
+{50538,25,16399},{50545,0,3017},{50547,6,710},{50549,9,3019},
+{50552,21,16407},{50561,0,3022},{50562,61,16413},{50579,41,16429},
+{50593,5,3023},{50595,5,16440},{50597,0,3025},{50598,9,16442},
+{50601,0,3026},{50602,25,16445},{50609,0,3027},{50611,18,712},
+{50616,21,16454},{50625,5,3031},{50627,5,16460},{50629,0,3033},
+{50630,9,16462},{50633,0,3034},{50634,25,16465},{50641,0,3035},
+{50643,13,16472},{50647,0,3036},{50648,21,16476},{50657,0,3037},
+{50658,61,16482},{50675,13,16498},{50679,0,3038},{50680,21,16502},
+{50753,0,3039},{50754,25,16508},{50761,0,3040},{50762,29,16515},
+{50771,41,16523},{50785,0,3041},{50786,61,16534},{50803,41,16550},
+{50817,5,3042},{50819,5,16561},{50821,0,3044},{50822,9,16563},
+{50825,0,3045},{50826,25,16566},{50833,0,3046},{50835,18,717},
+{50840,21,16575},{50849,0,3050},{50850,9,16581},{50853,0,3051},
+{50854,9,16584},{50857,0,3052},{50858,29,16587},{50867,13,16595},
+{50871,0,3053},{50872,21,16599},{50881,0,3054},{50882,61,16605},
+{50899,13,16621},{50903,0,3055},{50904,21,16625},{50913,5,3056},
+{50915,5,16631},{50917,0,3058},{50918,9,16633},{50921,0,3059},
+{50922,25,16636},{50929,0,3060},{50931,18,722},{50936,21,16645},
+{51009,0,3064},{51010,9,16651},{51013,0,3065},{51014,9,16654},
+{51017,0,3066},{51018,25,16657},{51025,0,3067},{51027,41,16664},
+{51041,5,3068},{51043,5,16675},{51045,0,3070},{51046,9,16677},
+{51049,0,3071},{51050,25,16680},{51057,0,3072},{51059,0,3073},
+{51060,9,16687},{51063,0,3074},{51064,21,16690},{51073,65,16696},
+{51091,41,16713},{51105,5,3075},{51107,5,16724},{51109,0,3077},
+{51110,9,16726},{51113,0,3078},{51114,25,16729},{51121,0,3079},
+{51123,18,727},{51128,21,16738},{51265,0,385},{51297,5,3083},
+{51299,5,16744},{51301,0,3085},{51302,9,16746},{51305,5,3086},
+{51307,21,16749},{51313,0,3088},{51315,6,732},{51317,9,3090},
+{51320,21,16756},{51329,5,3093},{51331,5,16762},{51333,0,3095},
+{51334,9,16764},{51337,0,3096},{51338,25,16767},{51345,0,3097},
+{51347,6,734},{51349,9,3099},{51352,21,16775},{51361,0,3102},
+{51362,61,16781},{51379,13,16797},{51383,0,3103},{51384,21,16801},
+{51393,65,16807},{51411,41,16824},{51425,5,3104},{51427,5,16835},
+{51429,0,3106},{51430,9,16837},{51433,10,736},{51436,17,16841},
+{51441,0,3109},{51443,6,739},{51445,9,3111},{51448,21,16847},
+{51521,5,3114},{51523,5,16853},{51525,0,3116},{51526,9,16855},
+{51529,0,3117},{51530,25,16858},{51537,0,3118},{51539,18,741},
+{51544,21,16867},{51553,0,3122},{51554,9,16873},{51557,0,3123},
+{51558,45,16876},{51571,9,16888},{51574,0,3124},{51575,25,16891},
+{51585,0,3125},{51586,9,16898},{51589,0,3126},{51590,45,16901},
+{51603,41,16913},{51617,5,3127},{51619,5,16924},{51621,0,3129},
+{51622,9,16926},{51625,0,3130},{51626,25,16929},{51633,0,3131},
+{51635,18,746},{51640,13,16938},{51644,6,751},{51649,0,3136},
+{51650,9,16943},{51653,0,3137},{51654,45,16946},{51667,41,16958},
+{51681,0,3138},{51682,61,16969},{51699,41,16985},{51777,0,3139},
+{51778,9,16996},{51781,0,3140},{51782,45,16999},{51795,5,17011},
+{51797,10,753},{51800,21,17014},{51809,0,3143},{51810,61,17020},
+{51827,41,17036},{51841,5,3144},{51843,5,17047},{51845,0,3146},
+{51846,9,17049},{51849,0,3147},{51850,25,17052},{51857,0,3148},
+{51859,18,756},{51864,21,17061},{51873,0,3152},{51874,61,17067},
+{51891,9,17083},{51894,0,3153},{51895,25,17086},{51905,0,3154},
+{51906,61,17093},{51923,41,17109},{51937,5,3155},{51939,5,17120},
+{51941,0,3157},{51942,9,17122},{51945,0,3158},{51946,25,17125},
+{51953,0,3159},{51955,0,3160},{51956,9,17132},{51959,0,3161},
+{51960,21,17135},{52033,0,3162},{52034,9,17141},{52037,0,3163},
+{52038,9,17144},{52041,0,3164},{52042,25,17147},{52049,0,3165},
+{52051,13,17154},{52055,0,3166},{52056,21,17158},{52065,5,3167},
+{52067,5,17164},{52069,0,3169},{52070,5,17166},{52072,5,3170},
+{52074,6,761},{52076,17,17169},{52081,0,3173},{52083,10,763},
+{52086,29,17175},{52097,0,3176},{52098,9,17183},{52101,0,3177},
+{52102,9,17186},{52105,0,3178},{52106,25,17189},{52113,0,3179},
+{52115,0,3180},{52116,37,17196},{52129,5,3181},{52131,5,17206},
+{52133,0,3183},{52134,9,17208},{52137,0,3184},{52138,25,17211},
+{52145,0,3185},{52147,18,766},{52152,21,17220},{52289,0,386},
+{52321,9,3189},{52324,6,771},{52326,9,17227},{52329,10,773},
+{52332,17,17231},{52337,0,3195},{52339,6,776},{52341,9,3197},
+{52344,9,17237},{52347,0,3200},{52348,5,17240},{52353,5,3201},
+{52355,5,17242},{52357,0,3203},{52358,9,17244},{52361,0,3204},
+{52362,25,17247},{52369,0,3205},{52371,6,778},{52373,9,3207},
+{52376,21,17255},{52385,5,3210},{52387,57,17261},{52403,41,17276},
+{52417,65,17287},{52435,41,17304},{52449,5,3212},{52451,5,17315},
+{52453,0,3214},{52454,9,17317},{52457,0,3215},{52458,25,17320},
+{52465,0,3216},{52467,6,780},{52469,9,3218},{52472,21,17328},
+{52545,5,3221},{52547,5,17334},{52549,0,3223},{52550,9,17336},
+{52553,0,3224},{52554,25,17339},{52561,0,3225},{52563,18,782},
+{52568,21,17348},{52577,0,3229},{52578,9,17354},{52581,0,3230},
+{52582,9,17357},{52585,0,3231},{52586,25,17360},{52593,0,3232},
+{52595,0,3233},{52596,5,17367},{52598,5,3234},{52600,21,17369},
+{52609,0,3236},{52610,25,17375},{52617,0,3237},{52618,29,17382},
+{52627,10,787},{52630,29,17391},{52641,5,3240},{52643,5,17399},
+{52645,0,3242},{52646,9,17401},{52649,0,3243},{52650,25,17404},
+{52657,0,3244},{52659,18,790},{52664,21,17413},{52673,0,3248},
+{52674,61,17419},{52691,13,17435},{52695,0,3249},{52696,21,17439},
+{52705,65,17445},{52723,41,17462},{52801,0,3250},{52802,9,17473},
+{52805,0,3251},{52806,45,17476},{52819,41,17488},{52833,0,3252},
+{52834,9,17499},{52837,0,3253},{52838,9,17502},{52841,0,3254},
+{52842,29,17505},{52851,10,795},{52854,29,17514},{52865,5,3257},
+{52867,5,17522},{52869,0,3259},{52870,5,17524},{52872,5,3260},
+{52874,6,798},{52876,17,17527},{52881,0,3263},{52883,18,800},
+{52888,21,17534},{52897,0,3267},{52898,61,17540},{52915,13,17556},
+{52919,0,3268},{52920,21,17560},{52929,65,17566},{52947,41,17583},
+{52961,0,3269},{52962,9,17594},{52965,0,3270},{52966,9,17597},
+{52969,0,3271},{52970,25,17600},{52977,0,3272},{52979,5,17607},
+{52981,0,3273},{52982,29,17609},{53057,0,3274},{53058,9,17617},
+{53061,0,3275},{53062,9,17620},{53065,0,3276},{53066,25,17623},
+{53073,0,3277},{53075,5,17630},{53077,10,805},{53080,21,17633},
+{53089,0,3280},{53090,9,17639},{53093,0,3281},{53094,9,17642},
+{53097,0,3282},{53098,25,17645},{53105,0,3283},{53107,10,808},
+{53110,29,17653},{53121,65,17661},{53139,41,17678},{53153,5,3286},
+{53155,5,17689},{53157,0,3288},{53158,9,17691},{53161,0,3289},
+{53162,25,17694},{53169,0,3290},{53171,18,811},{53176,21,17703},
+{53313,0,387},{53345,5,3294},{53347,5,17709},{53349,0,3296},
+{53350,9,17711},{53353,0,3297},{53354,13,17714},{53358,0,3298},
+{53359,5,17718},{53361,0,3299},{53363,18,816},{53368,21,17722},
+{53377,5,3303},{53379,5,17728},{53381,0,3305},{53382,9,17730},
+{53385,0,3306},{53386,25,17733},{53393,0,3307},{53395,6,821},
+{53397,9,3309},{53400,21,17741},{53409,0,3312},{53410,61,17747},
+{53427,13,17763},{53431,0,3313},{53432,21,17767},{53441,65,17773},
+{53459,41,17790},{53473,5,3314},{53475,5,17801},{53477,0,3316},
+{53478,9,17803},{53481,10,823},{53484,17,17807},{53489,0,3319},
+{53491,18,826},{53496,21,17814},{53569,5,3323},{53571,5,17820},
+{53573,0,3325},{53574,9,17822},{53577,0,3326},{53578,25,17825},
+{53585,0,3327},{53587,18,831},{53592,21,17834},{53601,5,3331},
+{53603,5,17840},{53605,0,3333},{53606,9,17842},{53609,0,3334},
+{53610,25,17845},{53617,0,3335},{53619,6,836},{53621,9,3337},
+{53624,21,17853},{53633,0,3340},{53634,9,17859},{53637,0,3341},
+{53638,9,17862},{53641,0,3342},{53642,29,17865},{53651,0,3343},
+{53652,37,17873},{53665,5,3344},{53667,5,17883},{53669,0,3346},
+{53670,9,17885},{53673,0,3347},{53674,13,17888},{53678,0,3348},
+{53679,5,17892},{53681,0,3349},{53683,18,838},{53688,9,17896},
+{53691,0,3353},{53692,5,17899},{53697,5,3354},{53699,5,17901},
+{53701,0,3356},{53702,9,17903},{53705,0,3357},{53706,29,17906},
+{53715,5,17914},{53717,10,843},{53720,21,17917},{53729,5,3360},
+{53731,5,17923},{53733,0,3362},{53734,45,17925},{53747,5,17937},
+{53749,10,846},{53752,21,17940},{53825,5,3365},{53827,5,17946},
+{53829,0,3367},{53830,9,17948},{53833,0,3368},{53834,29,17951},
+{53843,18,849},{53848,21,17961},{53857,0,3372},{53858,9,17967},
+{53861,0,3373},{53862,9,17970},{53865,0,3374},{53866,29,17973},
+{53875,10,854},{53878,29,17982},{53889,5,3377},{53891,5,17990},
+{53893,0,3379},{53894,9,17992},{53897,0,3380},{53898,13,17995},
+{53902,0,3381},{53903,5,17999},{53905,0,3382},{53907,5,18001},
+{53909,10,857},{53912,21,18004},{53921,0,3385},{53922,9,18010},
+{53925,0,3386},{53926,9,18013},{53929,0,3387},{53930,25,18016},
+{53937,0,3388},{53939,13,18023},{53943,0,3389},{53944,21,18027},
+{53953,5,3390},{53955,5,18033},{53957,0,3392},{53958,9,18035},
+{53961,0,3393},{53962,29,18038},{53971,13,18046},{53975,0,3394},
+{53976,21,18050},{53985,5,3395},{53987,5,18056},{53989,0,3397},
+{53990,9,18058},{53993,0,3398},{53994,25,18061},{54001,0,3399},
+{54003,18,860},{54008,21,18070},{54081,5,3403},{54083,5,18076},
+{54085,0,3405},{54086,9,18078},{54089,0,3406},{54090,25,18081},
+{54097,0,3407},{54099,5,18088},{54101,10,865},{54104,21,18091},
+{54113,5,3410},{54115,5,18097},{54117,6,868},{54119,13,3413},
+{54123,21,18100},{54129,0,3417},{54131,18,870},{54136,9,18108},
+{54139,0,3421},{54140,5,18111},{54145,0,3422},{54146,9,18113},
+{54149,0,3423},{54150,9,18116},{54153,0,3424},{54154,25,18119},
+{54161,0,3425},{54163,0,3426},{54164,9,18126},{54167,0,3427},
+{54168,21,18129},{54177,5,3428},{54179,5,18135},{54181,0,3430},
+{54182,9,18137},{54185,0,3431},{54186,25,18140},{54193,0,3432},
+{54195,18,875},{54200,21,18149},{55601,309,101},{55697,337,179},
+{55857,309,264},{55953,61,342},{56021,165,409},{56113,37,451},
+{56128,37,461},{56145,93,471},{56177,53,495},{56209,37,509},
+{56225,269,519},{56369,309,587},{56465,0,665},{56481,13,666},
+{56486,0,670},{56488,29,671},{56497,309,679},{56625,309,757},
+{56721,393,835},{56881,309,934},{56977,29,1012},{56993,129,1020},
+{57041,129,1053},{57393,309,3436},{57489,249,3514},{57552,0,4116},
+{57553,17,3577},{57558,0,3678},{57559,61,3582},{57575,0,7053},
+{57576,89,3598},{57649,309,3621},{57745,245,3699},{57807,0,3460},
+{57808,93,3761},{57832,0,7900},{57833,85,3785},{57905,45,3807},
+{57917,0,3802},{57918,257,3819},{58001,421,3884},{58107,0,3902},
+{58108,9,3990},{58161,6,880},{58163,81,3994},{58184,0,3946},
+{58185,89,4015},{58208,0,3708},{58209,45,4038},{58221,0,4131},
+{58222,65,4050},{58257,265,4067},{58324,6,882},{58326,5,4134},
+{58328,0,4375},{58329,5,4136},{58331,21,4376},{58337,6,884},
+{58339,9,4382},{58342,6,886},{58344,13,4387},{58348,10,888},
+{58351,5,4394},{58353,6,891},{58355,9,4143},{58358,0,4399},
+{58359,9,4146},{58362,6,893},{58364,5,4406},{58366,0,4409},
+{58417,0,4150},{58418,5,4410},{58420,9,4151},{58423,13,4412},
+{58427,10,895},{58430,13,4155},{58434,0,4424},{58435,41,4159},
+{58446,0,4511},{58447,9,4170},{58450,5,4513},{58452,6,898},
+{58454,17,4518},{58459,6,900},{58461,5,4525},{58463,21,4528},
+{58469,9,4535},{58472,0,4175},{58473,5,4541},{58475,9,4176},
+{58478,5,4545},{58480,18,902},{58485,13,4566},{58489,5,4571},
+{58491,0,4576},{58492,9,4181},{58513,0,4184},{58514,13,4604},
+{58518,5,4609},{58520,0,4185},{58521,5,4611},{58523,397,4186},
+{58673,273,4286},{58742,0,4318},{58743,29,4355},{58769,49,4363},
+{58782,0,4136},{58783,21,4376},{58789,0,5800},{58790,17,4382},
+{58795,0,4139},{58796,5,4387},{58798,0,4192},{58799,317,4389},
+{58929,89,4469},{58952,0,4167},{58953,77,4492},{58973,0,4172},
+{58974,129,4512},{59025,229,4545},{59083,0,5552},{59084,93,4603},
+{59108,0,6424},{59109,101,4627},{59185,309,4653},{59281,437,4731},
+{59441,309,4841},{59537,205,4919},{59589,0,5151},{59590,117,4971},
+{59620,0,4922},{59621,101,5001},{59697,13,5027},{59701,0,7518},
+{59702,289,5031},{59793,77,5104},{59813,0,5079},{59814,185,5124},
+{59861,0,5109},{59862,117,5171},{59892,0,7607},{59893,37,5201},
+{59953,309,5211},{60049,49,5289},{60062,10,907},{60065,69,5303},
+{60083,0,7083},{60084,177,5321},{60129,0,5362},{60130,21,5366},
+{60136,0,5485},{60137,85,5372},{60209,309,5394},{60305,5,5472},
+{60307,0,6001},{60308,97,5474},{60333,0,5460},{60334,249,5499},
+{60397,0,5317},{60398,65,5562},{60465,309,5579},{60561,397,5657},
+{60661,0,7009},{60662,33,5757},{60721,0,7370},{60722,25,5766},
+{60729,0,5678},{60730,273,5773},{60817,113,5842},{60846,0,5874},
+{60847,5,5871},{60849,5,4425},{60851,21,5873},{60857,6,910},
+{60859,5,4429},{60861,25,5880},{60868,0,4431},{60869,33,5887},
+{60878,18,912},{60883,9,5898},{60886,0,4439},{60887,137,5901},
+{60922,5,4442},{60924,10,917},{60977,0,4447},{60978,5,5937},
+{60980,0,4449},{60981,5,5939},{60983,0,4450},{60984,17,5941},
+{60989,6,920},{60991,9,4455},{60994,6,922},{60996,9,5948},
+{60999,5,4459},{61001,9,5951},{61004,0,4463},{61005,25,5954},
+{61012,6,924},{61014,5,4465},{61016,5,5962},{61018,0,4161},
+{61019,25,5964},{61026,0,4468},{61027,9,5971},{61030,0,4469},
+{61031,5,5974},{61033,0,4470},{61034,5,5976},{61036,0,4162},
+{61037,5,5978},{61039,10,926},{61042,5,5981},{61044,22,929},
+{61050,5,4478},{61052,0,6447},{61053,5,5985},{61073,14,935},
+{61077,5,5988},{61079,18,939},{61084,17,5991},{61089,0,4487},
+{61090,13,5996},{61094,0,4488},{61095,5,6000},{61097,18,944},
+{61102,5,6003},{61104,0,4494},{61105,53,6005},{61119,10,949},
+{61122,13,6020},{61126,6,952},{61128,9,6024},{61131,14,954},
+{61135,5,4503},{61137,5,6029},{61139,0,4506},{61140,41,6031},
+{61151,0,4508},{61152,13,6042},{61156,10,958},{61159,61,6047},
+{61175,0,5797},{61176,25,6063},{61233,277,6070},{61303,5,4551},
+{61305,21,6140},{61329,10,961},{61332,17,6147},{61337,18,964},
+{61342,5,6154},{61344,0,4557},{61345,21,6156},{61351,0,4560},
+{61352,13,6162},{61356,0,4561},{61357,121,6166},{61388,0,4563},
+{61389,165,6197},{61431,0,7988},{61432,25,6239},{61489,125,6246},
+{61521,0,6123},{61522,137,6278},{61557,0,4577},{61558,33,6313},
+{61585,17,6322},{61590,0,4183},{61591,5,6327},{61593,0,4579},
+{61594,13,6329},{61598,10,969},{61601,9,6334},{61604,0,4584},
+{61605,5,6337},{61607,14,972},{61611,57,6340},{61626,5,4590},
+{61628,6,976},{61630,9,6356},{61633,6,978},{61635,9,6359},
+{61638,5,4596},{61640,13,6362},{61644,0,4599},{61645,5,6366},
+{61647,9,4600},{61650,0,5552},{61651,17,6368},{61656,0,4603},
+{61657,149,6373},{61745,17,6411},{61750,6,980},{61752,5,6416},
+{61754,0,4618},{61755,13,6418},{61759,0,5950},{61760,5,4620},
+{61762,0,4187},{61763,5,6422},{61765,0,4625},{61766,5,6424},
+{61768,10,982},{61771,17,6427},{61776,5,4632},{61778,9,6432},
+{61781,6,985},{61783,5,6435},{61785,5,4188},{61787,37,6437},
+{61797,0,4638},{61798,25,6447},{61805,5,4640},{61807,5,6454},
+{61809,0,4642},{61810,5,6456},{61812,0,4644},{61813,5,6458},
+{61815,5,4645},{61817,21,6460},{61841,29,6466},{61849,5,4647},
+{61851,6,987},{61853,13,6475},{61857,9,4653},{61860,293,6479},
+{61934,0,5351},{61935,61,6553},{62001,229,6569},{62059,0,6494},
+{62060,73,6627},{62097,437,6646},{62257,309,6756},{62353,437,6834},
+{62513,109,6944},{62541,0,5731},{62542,193,6972},{62609,41,7021},
+{62620,0,5771},{62621,77,7032},{62641,0,4191},{62642,305,7052},
+{62769,21,7129},{62775,0,6484},{62776,277,7135},{62846,0,6684},
+{62865,437,7205},{63025,309,7315},{63121,17,7393},{63126,10,989},
+{63129,121,7399},{63160,0,4247},{63161,57,7430},{63176,0,4266},
+{63177,37,7445},{63187,0,4340},{63188,169,7455},{63281,229,7498},
+{63339,0,7572},{63340,73,7556},{63377,6,992},{63379,429,7576},
+{63537,6,994},{63539,265,7684},{63606,0,3644},{63607,29,7751},
+{63633,437,7759},{63793,29,7869},{63801,0,3815},{63802,273,7877},
+{63889,437,7946},
+};
+
+static const unsigned short cmap_KSC_Johab_H_table[996] = {
+1109,9355,1117,9377,1118,9413,1127,1129,9419,1141,9435,9442,
+1148,1152,9452,1160,9472,1161,9485,1167,9486,1168,1171,9489,
+1172,9490,1178,9501,1179,1181,9507,1182,9508,1183,1195,9549,
+1196,9550,1197,1201,9571,1202,1212,9588,1213,9589,1229,9655,
+1230,1241,9699,1242,9700,1243,9738,1250,1252,9744,1253,9745,
+1256,9749,9750,1260,1261,9754,1262,1264,9760,1274,9778,9838,
+1284,1287,9849,1295,9871,1296,1306,9929,1307,9930,1308,1310,
+9938,1311,9939,1336,10052,1337,10053,1359,10156,1360,10157,1361,
+10158,1362,1365,10163,1366,10164,1367,1374,10210,1375,10211,1376,
+10218,1380,1386,10226,10227,1392,10228,1393,1399,10241,1413,10302,
+1417,10307,1427,10325,1445,10382,1446,1448,10388,1449,10389,1450,
+1461,10459,1462,1467,10481,1468,10482,1469,1476,10500,1477,10501,
+1478,1500,10616,1501,10617,1504,10621,1511,10652,1512,1514,10658,
+1515,10659,1516,1517,10664,10665,1521,1529,10671,1541,10687,10749,
+1549,1555,10757,1556,10758,1557,10759,1558,1559,10762,1565,10775,
+10835,1581,10836,1582,1584,10840,1585,10841,1586,10842,1587,10843,
+1588,1598,10910,1599,1606,10958,1607,10959,1608,1616,11032,1617,
+11033,1618,11067,1629,1631,11073,1632,11074,1633,1641,11119,1651,
+11137,1661,11155,1668,11223,1672,11228,1682,11246,1718,11574,1719,
+1729,11619,1730,11620,1731,1737,11639,1749,11655,1756,11678,1757,
+1763,11725,1773,11743,1774,11744,1775,1781,11763,1787,11785,1788,
+1794,11806,1795,11807,1796,1805,11879,1806,11880,1807,1811,11901,
+1812,11902,1813,1819,11921,1820,11922,1821,1830,11996,1831,1837,
+12015,1838,12016,1839,1845,12035,1846,12036,1856,12080,1857,12081,
+1858,1861,12090,1868,12096,1869,12097,1872,12100,1873,1879,12113,
+1891,12176,1892,1894,12182,1895,12183,1904,12200,12222,1915,1921,
+12258,1922,1924,12264,1925,12265,1926,1934,12338,1935,12339,1936,
+1940,12360,1941,12369,1945,1951,12377,1952,12378,1953,1954,12382,
+1955,1959,12397,1960,12536,1980,1982,12542,12543,1986,12544,1987,
+1999,12553,2000,12554,2001,2008,12572,12634,2022,2024,12640,2025,
+12641,2034,12658,2042,12678,12710,2052,2055,12721,2056,12722,2057,
+2079,12837,2080,12838,2081,2097,12933,2098,2104,12952,2105,2109,
+12994,2110,2112,13000,2113,13001,2120,13011,2121,2123,13017,2133,
+13035,2154,13154,2173,13333,2174,2187,13513,2188,13514,2189,2199,
+13529,2209,13547,2218,13566,2219,13567,2220,2236,13604,2240,13609,
+2246,13622,2255,13641,13672,2266,2267,13676,2268,2270,13682,2271,
+13683,2272,2289,13747,2290,2296,13768,2297,13769,2298,2305,13787,
+2306,13788,2307,13789,2308,13790,2324,13852,2325,13853,2326,2331,
+13875,2332,2339,13893,2340,13894,2341,2349,13939,2350,13940,2351,
+2352,13945,2375,14044,2376,14142,2390,2422,14389,2423,2436,14440,
+2437,14441,2438,2449,14455,2460,14472,2470,14490,2471,14491,2472,
+2473,14495,2474,14528,2494,14529,2495,14530,2501,14543,2502,14544,
+2503,14551,2507,2508,14555,2524,14576,14589,2533,2536,14592,2537,
+14593,2538,14594,2539,2545,14611,2553,14633,2554,2560,14652,2561,
+14653,2562,2568,14672,2569,14673,2570,2578,14690,2579,14691,2580,
+2601,14751,2602,14752,2603,2609,14771,2610,14772,2611,14773,2612,
+2617,14788,2618,2619,14789,2620,14790,2641,14823,2646,14827,2649,
+14830,14831,2653,2655,14837,2665,14855,2671,14864,2672,14865,2673,
+2682,14913,2683,2685,14919,2686,14920,2694,14938,2695,14939,2696,
+2708,14999,2709,2711,15005,2712,15006,2720,15024,2721,15025,2722,
+2730,15070,2731,15071,2732,2744,15112,2745,15113,2746,2755,15185,
+2756,2766,15230,2767,15231,2768,15270,2774,2776,15276,2777,15277,
+2784,15283,2785,15284,2786,2789,15291,2798,15310,2810,15382,2823,
+15481,2824,15482,2825,15483,2826,2853,15733,2854,2866,15789,2867,
+15790,2868,2870,15798,2880,15816,2885,15826,2886,15827,2887,2895,
+15885,2904,15904,2905,15905,2906,2918,15974,2919,15975,2920,2929,
+16047,2930,16048,2931,2939,16093,2940,16094,2941,2950,16166,2951,
+16167,2952,2963,16209,2964,16210,2965,2973,16255,2974,16256,2975,
+2981,16275,2982,16276,2983,2989,16295,3002,16366,3011,16385,3012,
+16386,3013,3018,16406,3028,16452,3029,16453,3030,3047,16573,3048,
+16574,3049,3061,16643,3062,16644,3063,3080,16736,3081,16737,3082,
+3089,16755,3098,16774,3107,16840,3108,3110,16846,3119,16865,3120,
+16866,3121,3132,16936,3133,16937,3134,3135,16942,3141,17013,3142,
+3149,17059,3150,17060,3151,17168,3172,3174,17174,3175,3186,17218,
+3187,17219,3188,17226,3192,3193,17230,3194,3196,17236,3206,17254,
+3217,17327,3226,17346,3227,17347,3228,3238,17390,3239,3245,17411,
+3246,17412,3247,3255,17513,3256,17526,3262,3264,17532,3265,17533,
+3266,3278,17632,3279,3284,17652,3285,3291,17701,3292,17702,3293,
+3300,17720,3301,17721,3302,3308,17740,3317,17806,3318,3320,17812,
+3321,17813,3322,3328,17832,3329,17833,3330,3336,17852,3350,17894,
+3351,17895,3352,3358,17916,3359,3363,17939,3364,3369,17959,3370,
+17960,3371,3375,17981,3376,3383,18003,3384,3400,18068,3401,18069,
+3402,3408,18090,3409,3412,18099,3418,18106,3419,18107,3420,3433,
+18147,3434,18148,3435,3993,3946,4374,4156,4138,5800,4386,4139,
+4140,4391,4141,4142,4396,4403,4149,4419,4154,4420,4517,4173,
+4524,4174,4179,4547,4550,4180,4564,5584,5302,5367,4427,5879,
+4435,5896,4436,5897,4437,4159,5936,4444,4453,5946,5947,4458,
+4160,5961,4471,5980,4472,4474,4473,4475,5983,4476,5984,4481,
+5987,4482,5460,4483,4163,4166,5990,4485,4489,4491,6002,4167,
+4493,4495,6019,7783,4497,4499,4501,6027,4502,6028,4509,6046,
+4510,6146,4553,4180,4555,6152,5800,6153,4556,4581,6333,4582,
+4586,6339,4588,4184,6355,4592,4593,4595,4614,4616,4627,6426,
+4629,4634,4636,6474,4650,4279,7398,7139,7575,5088,7709,3558,
+};
+
+static pdf_cmap cmap_KSC_Johab_H = {
+	-1, "KSC-Johab-H", "", 0, 0, 4,
+	{ {1,0,128},{2,33857,54270},{2,55345,57086},{2,57393,63998}, },
+	3437, 3437, (pdf_range*) cmap_KSC_Johab_H_ranges,
+	996, 996, (unsigned short*) cmap_KSC_Johab_H_table,
+};
+
+/* KSC-Johab-V */
+
+static const pdf_range cmap_KSC_Johab_V_ranges[] = {
+{55602,5,8056},{55605,6,0},{55609,9,8059},{55613,0,8062},
+{55618,45,8063},{55675,0,8075},{55857,0,8076},{55864,5,8077},
+{55868,0,8079},{55870,0,8080},{55882,21,8081},{55915,0,8087},
+{55917,0,8088},{55919,0,8089},{55965,13,8090},
+};
+
+static const unsigned short cmap_KSC_Johab_V_table[2] = {
+8058,8320,
+};
+
+static pdf_cmap cmap_KSC_Johab_V = {
+	-1, "KSC-Johab-V", "KSC-Johab-H", 0, 1, 0,
+	{ {0,0,0}, },
+	15, 15, (pdf_range*) cmap_KSC_Johab_V_ranges,
+	2, 2, (unsigned short*) cmap_KSC_Johab_V_table,
+};
+
+/* KSC-V */
+
+static const pdf_range cmap_KSC_V_ranges[] = {
+{8482,5,8056},{8485,6,0},{8489,9,8059},{8493,0,8062},
+{8498,45,8063},{8555,0,8075},{8993,0,8076},{9000,5,8077},
+{9004,0,8079},{9006,0,8080},{9018,21,8081},{9051,0,8087},
+{9053,0,8088},{9055,0,8089},{9083,13,8090},
+};
+
+static const unsigned short cmap_KSC_V_table[2] = {
+8058,8320,
+};
+
+static pdf_cmap cmap_KSC_V = {
+	-1, "KSC-V", "KSC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	15, 15, (pdf_range*) cmap_KSC_V_ranges,
+	2, 2, (unsigned short*) cmap_KSC_V_table,
+};
+
+/* KSCms-UHC-H */
+
+static const pdf_range cmap_KSCms_UHC_H_ranges[] = {
+{32,377,1},{33089,101,9333},{33121,101,9359},{33153,501,9385},
+{33345,101,9511},{33377,101,9537},{33409,501,9563},{33601,101,9689},
+{33633,101,9715},{33665,501,9741},{33857,101,9867},{33889,101,9893},
+{33921,501,9919},{34113,101,10045},{34145,101,10071},{34177,501,10097},
+{34369,101,10223},{34401,101,10249},{34433,501,10275},{34625,101,10401},
+{34657,101,10427},{34689,501,10453},{34881,101,10579},{34913,101,10605},
+{34945,501,10631},{35137,101,10757},{35169,101,10783},{35201,501,10809},
+{35393,101,10935},{35425,101,10961},{35457,501,10987},{35649,101,11113},
+{35681,101,11139},{35713,501,11165},{35905,101,11291},{35937,101,11317},
+{35969,501,11343},{36161,101,11469},{36193,101,11495},{36225,501,11521},
+{36417,101,11647},{36449,101,11673},{36481,501,11699},{36673,101,11825},
+{36705,101,11851},{36737,501,11877},{36929,101,12003},{36961,101,12029},
+{36993,501,12055},{37185,101,12181},{37217,101,12207},{37249,501,12233},
+{37441,101,12359},{37473,101,12385},{37505,501,12411},{37697,101,12537},
+{37729,101,12563},{37761,501,12589},{37953,101,12715},{37985,101,12741},
+{38017,501,12767},{38209,101,12893},{38241,101,12919},{38273,501,12945},
+{38465,101,13071},{38497,101,13097},{38529,501,13123},{38721,101,13249},
+{38753,101,13275},{38785,501,13301},{38977,101,13427},{39009,101,13453},
+{39041,501,13479},{39233,101,13605},{39265,101,13631},{39297,501,13657},
+{39489,101,13783},{39521,101,13809},{39553,501,13835},{39745,101,13961},
+{39777,101,13987},{39809,501,14013},{40001,101,14139},{40033,101,14165},
+{40065,501,14191},{40257,101,14317},{40289,101,14343},{40321,501,14369},
+{40513,101,14495},{40545,101,14521},{40577,501,14547},{40769,101,14673},
+{40801,101,14699},{40833,501,14725},{41025,101,14851},{41057,101,14877},
+{41089,501,14903},{41281,101,15029},{41313,101,15055},{41345,125,15081},
+{41377,373,101},{41537,101,15113},{41569,101,15139},{41601,125,15165},
+{41633,273,195},{41793,101,15197},{41825,101,15223},{41857,125,15249},
+{41889,373,264},{42049,101,15281},{42081,101,15307},{42113,125,15333},
+{42145,201,358},{42197,165,409},{42305,101,15365},{42337,101,15391},
+{42369,125,15417},{42401,37,451},{42416,37,461},{42433,93,471},
+{42465,93,495},{42561,101,15449},{42593,101,15475},{42625,125,15501},
+{42657,269,519},{42817,101,15533},{42849,101,15559},{42881,125,15585},
+{42913,313,587},{43073,101,15617},{43105,101,15643},{43137,125,15669},
+{43169,13,666},{43174,0,670},{43176,29,671},{43185,309,679},
+{43329,101,15701},{43361,101,15727},{43393,125,15753},{43425,373,757},
+{43585,101,15785},{43617,101,15811},{43649,125,15837},{43681,329,851},
+{43841,101,15869},{43873,101,15895},{43905,125,15921},{43937,341,934},
+{44097,101,15953},{44129,101,15979},{44161,125,16005},{44193,129,1020},
+{44241,129,1053},{44353,101,16037},{44385,101,16063},{44417,125,16089},
+{44609,101,16121},{44641,101,16147},{44673,125,16173},{44865,101,16205},
+{44897,101,16231},{44929,125,16257},{45121,101,16289},{45153,101,16315},
+{45185,125,16341},{45217,373,1086},{45377,101,16373},{45409,101,16399},
+{45441,125,16425},{45473,373,1180},{45633,101,16457},{45665,101,16483},
+{45697,125,16509},{45729,373,1274},{45889,101,16541},{45921,101,16567},
+{45953,125,16593},{45985,373,1368},{46145,101,16625},{46177,101,16651},
+{46209,125,16677},{46241,373,1462},{46401,101,16709},{46433,101,16735},
+{46465,125,16761},{46497,373,1556},{46657,101,16793},{46689,101,16819},
+{46721,125,16845},{46753,373,1650},{46913,101,16877},{46945,101,16903},
+{46977,125,16929},{47009,373,1744},{47169,101,16961},{47201,101,16987},
+{47233,125,17013},{47265,373,1838},{47425,101,17045},{47457,101,17071},
+{47489,125,17097},{47521,373,1932},{47681,101,17129},{47713,101,17155},
+{47745,125,17181},{47777,373,2026},{47937,101,17213},{47969,101,17239},
+{48001,125,17265},{48033,373,2120},{48193,101,17297},{48225,101,17323},
+{48257,125,17349},{48289,373,2214},{48449,101,17381},{48481,101,17407},
+{48513,125,17433},{48545,373,2308},{48705,101,17465},{48737,101,17491},
+{48769,125,17517},{48801,373,2402},{48961,101,17549},{48993,101,17575},
+{49025,125,17601},{49057,373,2496},{49217,101,17633},{49249,101,17659},
+{49281,125,17685},{49313,373,2590},{49473,101,17717},{49505,101,17743},
+{49537,125,17769},{49569,373,2684},{49729,101,17801},{49761,101,17827},
+{49793,125,17853},{49825,373,2778},{49985,101,17885},{50017,101,17911},
+{50049,125,17937},{50081,373,2872},{50241,101,17969},{50273,101,17995},
+{50305,125,18021},{50337,373,2966},{50497,101,18053},{50529,101,18079},
+{50561,125,18105},{50593,373,3060},{50753,69,18137},{50849,373,3154},
+{51105,373,3248},{51361,373,3342},{51873,373,3436},{52129,185,3530},
+{52176,0,4116},{52177,17,3577},{52182,0,3678},{52183,61,3582},
+{52199,0,7053},{52200,89,3598},{52385,373,3621},{52641,181,3715},
+{52687,0,3460},{52688,93,3761},{52712,0,7900},{52713,85,3785},
+{52897,45,3807},{52909,0,3802},{52910,321,3819},{53153,357,3900},
+{53243,0,3902},{53244,9,3990},{53409,6,0},{53411,81,3994},
+{53432,0,3946},{53433,89,4015},{53456,0,3708},{53457,45,4038},
+{53469,0,4131},{53470,129,4050},{53665,201,4083},{53716,6,2},
+{53718,5,4134},{53720,0,4375},{53721,5,4136},{53723,21,4376},
+{53729,6,4},{53731,9,4382},{53734,6,6},{53736,13,4387},
+{53740,10,8},{53743,5,4394},{53745,6,11},{53747,9,4143},
+{53750,0,4399},{53751,9,4146},{53754,6,13},{53756,5,4406},
+{53758,0,4409},{53921,0,4150},{53922,5,4410},{53924,9,4151},
+{53927,13,4412},{53931,10,15},{53934,13,4155},{53938,0,4424},
+{53939,41,4159},{53950,0,4511},{53951,9,4170},{53954,5,4513},
+{53956,6,18},{53958,17,4518},{53963,6,20},{53965,5,4525},
+{53967,21,4528},{53973,9,4535},{53976,0,4175},{53977,5,4541},
+{53979,9,4176},{53982,5,4545},{53984,18,22},{53989,13,4566},
+{53993,5,4571},{53995,0,4576},{53996,13,4181},{54000,13,4604},
+{54004,5,4609},{54006,0,4185},{54007,5,4611},{54009,21,4186},
+{54177,373,4192},{54433,273,4286},{54502,0,4318},{54503,81,4355},
+{54524,0,4136},{54525,5,4376},{54689,13,4378},{54693,0,5800},
+{54694,17,4382},{54699,0,4139},{54700,5,4387},{54702,0,4192},
+{54703,317,4389},{54945,89,4469},{54968,0,4167},{54969,77,4492},
+{54989,0,4172},{54990,193,4512},{55201,165,4561},{55243,0,5552},
+{55244,93,4603},{55268,0,6424},{55269,101,4627},{55457,373,4653},
+{55713,373,4747},{55969,373,4841},{56225,141,4935},{56261,0,5151},
+{56262,117,4971},{56292,0,4922},{56293,101,5001},{56481,13,5027},
+{56485,0,7518},{56486,353,5031},{56737,13,5120},{56741,0,5079},
+{56742,185,5124},{56789,0,5109},{56790,117,5171},{56820,0,7607},
+{56821,37,5201},{56993,361,5211},{57084,10,27},{57249,69,5303},
+{57267,0,7083},{57268,177,5321},{57313,0,5362},{57314,21,5366},
+{57320,0,5485},{57321,85,5372},{57505,317,5394},{57585,0,6001},
+{57586,49,5474},{57761,45,5487},{57773,0,5460},{57774,249,5499},
+{57837,0,5317},{57838,65,5562},{58017,373,5579},{58273,333,5673},
+{58357,0,7009},{58358,33,5757},{58529,0,7370},{58530,25,5766},
+{58537,0,5678},{58538,337,5773},{58785,49,5858},{58798,0,5874},
+{58799,5,5871},{58801,5,4425},{58803,21,5873},{58809,6,30},
+{58811,5,4429},{58813,25,5880},{58820,0,4431},{58821,33,5887},
+{58830,18,32},{58835,9,5898},{58838,0,4439},{58839,137,5901},
+{58874,5,4442},{58876,10,37},{59041,0,4447},{59042,5,5937},
+{59044,0,4449},{59045,5,5939},{59047,0,4450},{59048,17,5941},
+{59053,6,40},{59055,9,4455},{59058,6,42},{59060,9,5948},
+{59063,5,4459},{59065,9,5951},{59068,0,4463},{59069,25,5954},
+{59076,6,44},{59078,5,4465},{59080,5,5962},{59082,0,4161},
+{59083,25,5964},{59090,0,4468},{59091,9,5971},{59094,0,4469},
+{59095,5,5974},{59097,0,4470},{59098,5,5976},{59100,0,4162},
+{59101,5,5978},{59103,10,46},{59106,5,5981},{59108,22,49},
+{59114,5,4478},{59116,0,6447},{59117,5,5985},{59119,14,55},
+{59123,5,5988},{59125,18,59},{59130,17,5991},{59297,0,4487},
+{59298,13,5996},{59302,0,4488},{59303,5,6000},{59305,18,64},
+{59310,5,6003},{59312,0,4494},{59313,53,6005},{59327,10,69},
+{59330,13,6020},{59334,6,72},{59336,9,6024},{59339,14,74},
+{59343,5,4503},{59345,5,6029},{59347,0,4506},{59348,41,6031},
+{59359,0,4508},{59360,13,6042},{59364,10,78},{59367,61,6047},
+{59383,0,5797},{59384,25,6063},{59553,277,6070},{59623,5,4551},
+{59625,25,6140},{59632,6,81},{59634,17,6147},{59639,18,83},
+{59644,5,6154},{59646,0,4557},{59809,21,6156},{59815,0,4560},
+{59816,13,6162},{59820,0,4561},{59821,121,6166},{59852,0,4563},
+{59853,165,6197},{59895,0,7988},{59896,25,6239},{60065,125,6246},
+{60097,0,6123},{60098,137,6278},{60133,0,4577},{60134,53,6313},
+{60148,0,4183},{60149,5,6327},{60151,0,4579},{60152,13,6329},
+{60156,10,88},{60321,9,6334},{60324,0,4584},{60325,5,6337},
+{60327,14,91},{60331,57,6340},{60346,5,4590},{60348,6,95},
+{60350,9,6356},{60353,6,97},{60355,9,6359},{60358,5,4596},
+{60360,13,6362},{60364,0,4599},{60365,5,6366},{60367,9,4600},
+{60370,0,5552},{60371,17,6368},{60376,0,4603},{60377,149,6373},
+{60577,17,6411},{60582,6,99},{60584,5,6416},{60586,0,4618},
+{60587,13,6418},{60591,0,5950},{60592,5,4620},{60594,0,4187},
+{60595,5,6422},{60597,0,4625},{60598,5,6424},{60600,10,101},
+{60603,17,6427},{60608,5,4632},{60610,9,6432},{60613,6,104},
+{60615,5,6435},{60617,5,4188},{60619,37,6437},{60629,0,4638},
+{60630,25,6447},{60637,5,4640},{60639,5,6454},{60641,0,4642},
+{60642,5,6456},{60644,0,4644},{60645,5,6458},{60647,5,4645},
+{60649,53,6460},{60663,5,4647},{60665,6,106},{60667,13,6475},
+{60833,9,4653},{60836,293,6479},{60910,0,5351},{60911,61,6553},
+{61089,229,6569},{61147,0,6494},{61148,137,6627},{61345,373,6662},
+{61601,373,6756},{61857,373,6850},{62113,109,6944},{62141,0,5731},
+{62142,237,6972},{62202,0,5771},{62203,13,7032},{62369,61,7036},
+{62385,0,4191},{62386,305,7052},{62625,21,7129},{62631,0,6484},
+{62632,277,7135},{62702,0,6684},{62703,61,7205},{62881,373,7221},
+{63137,329,7315},{63220,10,108},{63223,29,7399},{63393,89,7407},
+{63416,0,4247},{63417,57,7430},{63432,0,4266},{63433,37,7445},
+{63443,0,4340},{63444,169,7455},{63649,229,7498},{63707,0,7572},
+{63708,77,7556},{63728,0,5088},{63729,53,7576},{63905,373,7590},
+{64161,6,111},{64163,265,7684},{64230,0,3644},{64231,93,7751},
+{64417,373,7775},{64673,29,7869},{64681,0,3815},{64682,337,7877},
+{64929,373,7962},
+};
+
+static const unsigned short cmap_KSCms_UHC_H_table[113] = {
+3993,3946,4374,4156,4138,5800,4386,4139,4140,4391,4141,4142,
+4396,4403,4149,4419,4154,4420,4517,4173,4524,4174,4179,4547,
+4550,4180,4564,5584,5302,5367,4427,5879,4435,5896,4436,5897,
+4437,4159,5936,4444,4453,5946,5947,4458,4160,5961,4471,5980,
+4472,4474,4473,4475,5983,4476,5984,4481,5987,4482,5460,4483,
+4163,4166,5990,4485,4489,4491,6002,4167,4493,4495,6019,7783,
+4497,4499,4501,6027,4502,6028,4509,6046,4510,4553,4180,4555,
+6152,5800,6153,4556,4581,6333,4582,4586,6339,4588,4184,6355,
+4592,4593,4595,4614,4616,4627,6426,4629,4634,4636,6474,4650,
+4279,7398,7139,7709,3558,
+};
+
+static pdf_cmap cmap_KSCms_UHC_H = {
+	-1, "KSCms-UHC-H", "", 0, 0, 2,
+	{ {1,0,128},{2,33089,65278}, },
+	601, 601, (pdf_range*) cmap_KSCms_UHC_H_ranges,
+	113, 113, (unsigned short*) cmap_KSCms_UHC_H_table,
+};
+
+/* KSCms-UHC-HW-H */
+
+static const pdf_range cmap_KSCms_UHC_HW_H_ranges[] = {
+{32,377,8094},{33089,101,9333},{33121,101,9359},{33153,501,9385},
+{33345,101,9511},{33377,101,9537},{33409,501,9563},{33601,101,9689},
+{33633,101,9715},{33665,501,9741},{33857,101,9867},{33889,101,9893},
+{33921,501,9919},{34113,101,10045},{34145,101,10071},{34177,501,10097},
+{34369,101,10223},{34401,101,10249},{34433,501,10275},{34625,101,10401},
+{34657,101,10427},{34689,501,10453},{34881,101,10579},{34913,101,10605},
+{34945,501,10631},{35137,101,10757},{35169,101,10783},{35201,501,10809},
+{35393,101,10935},{35425,101,10961},{35457,501,10987},{35649,101,11113},
+{35681,101,11139},{35713,501,11165},{35905,101,11291},{35937,101,11317},
+{35969,501,11343},{36161,101,11469},{36193,101,11495},{36225,501,11521},
+{36417,101,11647},{36449,101,11673},{36481,501,11699},{36673,101,11825},
+{36705,101,11851},{36737,501,11877},{36929,101,12003},{36961,101,12029},
+{36993,501,12055},{37185,101,12181},{37217,101,12207},{37249,501,12233},
+{37441,101,12359},{37473,101,12385},{37505,501,12411},{37697,101,12537},
+{37729,101,12563},{37761,501,12589},{37953,101,12715},{37985,101,12741},
+{38017,501,12767},{38209,101,12893},{38241,101,12919},{38273,501,12945},
+{38465,101,13071},{38497,101,13097},{38529,501,13123},{38721,101,13249},
+{38753,101,13275},{38785,501,13301},{38977,101,13427},{39009,101,13453},
+{39041,501,13479},{39233,101,13605},{39265,101,13631},{39297,501,13657},
+{39489,101,13783},{39521,101,13809},{39553,501,13835},{39745,101,13961},
+{39777,101,13987},{39809,501,14013},{40001,101,14139},{40033,101,14165},
+{40065,501,14191},{40257,101,14317},{40289,101,14343},{40321,501,14369},
+{40513,101,14495},{40545,101,14521},{40577,501,14547},{40769,101,14673},
+{40801,101,14699},{40833,501,14725},{41025,101,14851},{41057,101,14877},
+{41089,501,14903},{41281,101,15029},{41313,101,15055},{41345,125,15081},
+{41377,373,101},{41537,101,15113},{41569,101,15139},{41601,125,15165},
+{41633,273,195},{41793,101,15197},{41825,101,15223},{41857,125,15249},
+{41889,373,264},{42049,101,15281},{42081,101,15307},{42113,125,15333},
+{42145,201,358},{42197,165,409},{42305,101,15365},{42337,101,15391},
+{42369,125,15417},{42401,37,451},{42416,37,461},{42433,93,471},
+{42465,93,495},{42561,101,15449},{42593,101,15475},{42625,125,15501},
+{42657,269,519},{42817,101,15533},{42849,101,15559},{42881,125,15585},
+{42913,313,587},{43073,101,15617},{43105,101,15643},{43137,125,15669},
+{43169,13,666},{43174,0,670},{43176,29,671},{43185,309,679},
+{43329,101,15701},{43361,101,15727},{43393,125,15753},{43425,373,757},
+{43585,101,15785},{43617,101,15811},{43649,125,15837},{43681,329,851},
+{43841,101,15869},{43873,101,15895},{43905,125,15921},{43937,341,934},
+{44097,101,15953},{44129,101,15979},{44161,125,16005},{44193,129,1020},
+{44241,129,1053},{44353,101,16037},{44385,101,16063},{44417,125,16089},
+{44609,101,16121},{44641,101,16147},{44673,125,16173},{44865,101,16205},
+{44897,101,16231},{44929,125,16257},{45121,101,16289},{45153,101,16315},
+{45185,125,16341},{45217,373,1086},{45377,101,16373},{45409,101,16399},
+{45441,125,16425},{45473,373,1180},{45633,101,16457},{45665,101,16483},
+{45697,125,16509},{45729,373,1274},{45889,101,16541},{45921,101,16567},
+{45953,125,16593},{45985,373,1368},{46145,101,16625},{46177,101,16651},
+{46209,125,16677},{46241,373,1462},{46401,101,16709},{46433,101,16735},
+{46465,125,16761},{46497,373,1556},{46657,101,16793},{46689,101,16819},
+{46721,125,16845},{46753,373,1650},{46913,101,16877},{46945,101,16903},
+{46977,125,16929},{47009,373,1744},{47169,101,16961},{47201,101,16987},
+{47233,125,17013},{47265,373,1838},{47425,101,17045},{47457,101,17071},
+{47489,125,17097},{47521,373,1932},{47681,101,17129},{47713,101,17155},
+{47745,125,17181},{47777,373,2026},{47937,101,17213},{47969,101,17239},
+{48001,125,17265},{48033,373,2120},{48193,101,17297},{48225,101,17323},
+{48257,125,17349},{48289,373,2214},{48449,101,17381},{48481,101,17407},
+{48513,125,17433},{48545,373,2308},{48705,101,17465},{48737,101,17491},
+{48769,125,17517},{48801,373,2402},{48961,101,17549},{48993,101,17575},
+{49025,125,17601},{49057,373,2496},{49217,101,17633},{49249,101,17659},
+{49281,125,17685},{49313,373,2590},{49473,101,17717},{49505,101,17743},
+{49537,125,17769},{49569,373,2684},{49729,101,17801},{49761,101,17827},
+{49793,125,17853},{49825,373,2778},{49985,101,17885},{50017,101,17911},
+{50049,125,17937},{50081,373,2872},{50241,101,17969},{50273,101,17995},
+{50305,125,18021},{50337,373,2966},{50497,101,18053},{50529,101,18079},
+{50561,125,18105},{50593,373,3060},{50753,69,18137},{50849,373,3154},
+{51105,373,3248},{51361,373,3342},{51873,373,3436},{52129,185,3530},
+{52176,0,4116},{52177,17,3577},{52182,0,3678},{52183,61,3582},
+{52199,0,7053},{52200,89,3598},{52385,373,3621},{52641,181,3715},
+{52687,0,3460},{52688,93,3761},{52712,0,7900},{52713,85,3785},
+{52897,45,3807},{52909,0,3802},{52910,321,3819},{53153,357,3900},
+{53243,0,3902},{53244,9,3990},{53409,6,0},{53411,81,3994},
+{53432,0,3946},{53433,89,4015},{53456,0,3708},{53457,45,4038},
+{53469,0,4131},{53470,129,4050},{53665,201,4083},{53716,6,2},
+{53718,5,4134},{53720,0,4375},{53721,5,4136},{53723,21,4376},
+{53729,6,4},{53731,9,4382},{53734,6,6},{53736,13,4387},
+{53740,10,8},{53743,5,4394},{53745,6,11},{53747,9,4143},
+{53750,0,4399},{53751,9,4146},{53754,6,13},{53756,5,4406},
+{53758,0,4409},{53921,0,4150},{53922,5,4410},{53924,9,4151},
+{53927,13,4412},{53931,10,15},{53934,13,4155},{53938,0,4424},
+{53939,41,4159},{53950,0,4511},{53951,9,4170},{53954,5,4513},
+{53956,6,18},{53958,17,4518},{53963,6,20},{53965,5,4525},
+{53967,21,4528},{53973,9,4535},{53976,0,4175},{53977,5,4541},
+{53979,9,4176},{53982,5,4545},{53984,18,22},{53989,13,4566},
+{53993,5,4571},{53995,0,4576},{53996,13,4181},{54000,13,4604},
+{54004,5,4609},{54006,0,4185},{54007,5,4611},{54009,21,4186},
+{54177,373,4192},{54433,273,4286},{54502,0,4318},{54503,81,4355},
+{54524,0,4136},{54525,5,4376},{54689,13,4378},{54693,0,5800},
+{54694,17,4382},{54699,0,4139},{54700,5,4387},{54702,0,4192},
+{54703,317,4389},{54945,89,4469},{54968,0,4167},{54969,77,4492},
+{54989,0,4172},{54990,193,4512},{55201,165,4561},{55243,0,5552},
+{55244,93,4603},{55268,0,6424},{55269,101,4627},{55457,373,4653},
+{55713,373,4747},{55969,373,4841},{56225,141,4935},{56261,0,5151},
+{56262,117,4971},{56292,0,4922},{56293,101,5001},{56481,13,5027},
+{56485,0,7518},{56486,353,5031},{56737,13,5120},{56741,0,5079},
+{56742,185,5124},{56789,0,5109},{56790,117,5171},{56820,0,7607},
+{56821,37,5201},{56993,361,5211},{57084,10,27},{57249,69,5303},
+{57267,0,7083},{57268,177,5321},{57313,0,5362},{57314,21,5366},
+{57320,0,5485},{57321,85,5372},{57505,317,5394},{57585,0,6001},
+{57586,49,5474},{57761,45,5487},{57773,0,5460},{57774,249,5499},
+{57837,0,5317},{57838,65,5562},{58017,373,5579},{58273,333,5673},
+{58357,0,7009},{58358,33,5757},{58529,0,7370},{58530,25,5766},
+{58537,0,5678},{58538,337,5773},{58785,49,5858},{58798,0,5874},
+{58799,5,5871},{58801,5,4425},{58803,21,5873},{58809,6,30},
+{58811,5,4429},{58813,25,5880},{58820,0,4431},{58821,33,5887},
+{58830,18,32},{58835,9,5898},{58838,0,4439},{58839,137,5901},
+{58874,5,4442},{58876,10,37},{59041,0,4447},{59042,5,5937},
+{59044,0,4449},{59045,5,5939},{59047,0,4450},{59048,17,5941},
+{59053,6,40},{59055,9,4455},{59058,6,42},{59060,9,5948},
+{59063,5,4459},{59065,9,5951},{59068,0,4463},{59069,25,5954},
+{59076,6,44},{59078,5,4465},{59080,5,5962},{59082,0,4161},
+{59083,25,5964},{59090,0,4468},{59091,9,5971},{59094,0,4469},
+{59095,5,5974},{59097,0,4470},{59098,5,5976},{59100,0,4162},
+{59101,5,5978},{59103,10,46},{59106,5,5981},{59108,22,49},
+{59114,5,4478},{59116,0,6447},{59117,5,5985},{59119,14,55},
+{59123,5,5988},{59125,18,59},{59130,17,5991},{59297,0,4487},
+{59298,13,5996},{59302,0,4488},{59303,5,6000},{59305,18,64},
+{59310,5,6003},{59312,0,4494},{59313,53,6005},{59327,10,69},
+{59330,13,6020},{59334,6,72},{59336,9,6024},{59339,14,74},
+{59343,5,4503},{59345,5,6029},{59347,0,4506},{59348,41,6031},
+{59359,0,4508},{59360,13,6042},{59364,10,78},{59367,61,6047},
+{59383,0,5797},{59384,25,6063},{59553,277,6070},{59623,5,4551},
+{59625,25,6140},{59632,6,81},{59634,17,6147},{59639,18,83},
+{59644,5,6154},{59646,0,4557},{59809,21,6156},{59815,0,4560},
+{59816,13,6162},{59820,0,4561},{59821,121,6166},{59852,0,4563},
+{59853,165,6197},{59895,0,7988},{59896,25,6239},{60065,125,6246},
+{60097,0,6123},{60098,137,6278},{60133,0,4577},{60134,53,6313},
+{60148,0,4183},{60149,5,6327},{60151,0,4579},{60152,13,6329},
+{60156,10,88},{60321,9,6334},{60324,0,4584},{60325,5,6337},
+{60327,14,91},{60331,57,6340},{60346,5,4590},{60348,6,95},
+{60350,9,6356},{60353,6,97},{60355,9,6359},{60358,5,4596},
+{60360,13,6362},{60364,0,4599},{60365,5,6366},{60367,9,4600},
+{60370,0,5552},{60371,17,6368},{60376,0,4603},{60377,149,6373},
+{60577,17,6411},{60582,6,99},{60584,5,6416},{60586,0,4618},
+{60587,13,6418},{60591,0,5950},{60592,5,4620},{60594,0,4187},
+{60595,5,6422},{60597,0,4625},{60598,5,6424},{60600,10,101},
+{60603,17,6427},{60608,5,4632},{60610,9,6432},{60613,6,104},
+{60615,5,6435},{60617,5,4188},{60619,37,6437},{60629,0,4638},
+{60630,25,6447},{60637,5,4640},{60639,5,6454},{60641,0,4642},
+{60642,5,6456},{60644,0,4644},{60645,5,6458},{60647,5,4645},
+{60649,53,6460},{60663,5,4647},{60665,6,106},{60667,13,6475},
+{60833,9,4653},{60836,293,6479},{60910,0,5351},{60911,61,6553},
+{61089,229,6569},{61147,0,6494},{61148,137,6627},{61345,373,6662},
+{61601,373,6756},{61857,373,6850},{62113,109,6944},{62141,0,5731},
+{62142,237,6972},{62202,0,5771},{62203,13,7032},{62369,61,7036},
+{62385,0,4191},{62386,305,7052},{62625,21,7129},{62631,0,6484},
+{62632,277,7135},{62702,0,6684},{62703,61,7205},{62881,373,7221},
+{63137,329,7315},{63220,10,108},{63223,29,7399},{63393,89,7407},
+{63416,0,4247},{63417,57,7430},{63432,0,4266},{63433,37,7445},
+{63443,0,4340},{63444,169,7455},{63649,229,7498},{63707,0,7572},
+{63708,77,7556},{63728,0,5088},{63729,53,7576},{63905,373,7590},
+{64161,6,111},{64163,265,7684},{64230,0,3644},{64231,93,7751},
+{64417,373,7775},{64673,29,7869},{64681,0,3815},{64682,337,7877},
+{64929,373,7962},
+};
+
+static const unsigned short cmap_KSCms_UHC_HW_H_table[113] = {
+3993,3946,4374,4156,4138,5800,4386,4139,4140,4391,4141,4142,
+4396,4403,4149,4419,4154,4420,4517,4173,4524,4174,4179,4547,
+4550,4180,4564,5584,5302,5367,4427,5879,4435,5896,4436,5897,
+4437,4159,5936,4444,4453,5946,5947,4458,4160,5961,4471,5980,
+4472,4474,4473,4475,5983,4476,5984,4481,5987,4482,5460,4483,
+4163,4166,5990,4485,4489,4491,6002,4167,4493,4495,6019,7783,
+4497,4499,4501,6027,4502,6028,4509,6046,4510,4553,4180,4555,
+6152,5800,6153,4556,4581,6333,4582,4586,6339,4588,4184,6355,
+4592,4593,4595,4614,4616,4627,6426,4629,4634,4636,6474,4650,
+4279,7398,7139,7709,3558,
+};
+
+static pdf_cmap cmap_KSCms_UHC_HW_H = {
+	-1, "KSCms-UHC-HW-H", "", 0, 0, 2,
+	{ {1,0,128},{2,33089,65278}, },
+	601, 601, (pdf_range*) cmap_KSCms_UHC_HW_H_ranges,
+	113, 113, (unsigned short*) cmap_KSCms_UHC_HW_H_table,
+};
+
+/* KSCms-UHC-HW-V */
+
+static const pdf_range cmap_KSCms_UHC_HW_V_ranges[] = {
+{41378,5,8056},{41381,6,0},{41385,9,8059},{41389,0,8062},
+{41394,45,8063},{41451,0,8075},{41889,0,8076},{41896,5,8077},
+{41900,0,8079},{41902,0,8080},{41914,21,8081},{41947,0,8087},
+{41949,0,8088},{41951,0,8089},{41979,13,8090},
+};
+
+static const unsigned short cmap_KSCms_UHC_HW_V_table[2] = {
+8058,8320,
+};
+
+static pdf_cmap cmap_KSCms_UHC_HW_V = {
+	-1, "KSCms-UHC-HW-V", "KSCms-UHC-HW-H", 0, 1, 0,
+	{ {0,0,0}, },
+	15, 15, (pdf_range*) cmap_KSCms_UHC_HW_V_ranges,
+	2, 2, (unsigned short*) cmap_KSCms_UHC_HW_V_table,
+};
+
+/* KSCms-UHC-V */
+
+static const pdf_range cmap_KSCms_UHC_V_ranges[] = {
+{41378,5,8056},{41381,6,0},{41385,9,8059},{41389,0,8062},
+{41394,45,8063},{41451,0,8075},{41889,0,8076},{41896,5,8077},
+{41900,0,8079},{41902,0,8080},{41914,21,8081},{41947,0,8087},
+{41949,0,8088},{41951,0,8089},{41979,13,8090},
+};
+
+static const unsigned short cmap_KSCms_UHC_V_table[2] = {
+8058,8320,
+};
+
+static pdf_cmap cmap_KSCms_UHC_V = {
+	-1, "KSCms-UHC-V", "KSCms-UHC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	15, 15, (pdf_range*) cmap_KSCms_UHC_V_ranges,
+	2, 2, (unsigned short*) cmap_KSCms_UHC_V_table,
+};
+
+/* KSCpc-EUC-H */
+
+static const pdf_range cmap_KSCpc_EUC_H_ranges[] = {
+{32,377,1},{129,9,96},{254,5,99},{41281,241,8191},
+{41345,101,8252},{41372,17,8278},{41377,0,101},{41378,5,8283},
+{41380,361,104},{41537,45,8285},{41633,273,195},{41702,97,8297},
+{41793,241,8322},{41857,121,8383},{41889,373,264},{42049,241,8414},
+{42113,121,8475},{42145,201,358},{42197,165,409},{42305,241,8506},
+{42369,41,8567},{42401,37,451},{42416,37,461},{42433,93,471},
+{42458,17,8578},{42465,93,495},{42489,13,8583},{42561,241,8587},
+{42625,37,8648},{42637,25,8658},{42646,21,8665},{42654,5,8671},
+{42657,269,519},{42725,101,8673},{42817,241,8699},{42881,121,8760},
+{42913,313,587},{42992,57,8791},{43073,241,8806},{43137,121,8867},
+{43169,13,666},{43174,0,670},{43176,29,671},{43185,309,679},
+{43329,205,8898},{43425,373,757},{43585,241,8950},{43649,121,9011},
+{43681,329,851},{43764,41,9042},{43841,241,9053},{43905,121,9114},
+{43937,341,934},{44023,13,9145},{44027,9,9330},{44097,241,9149},
+{44161,89,9210},{44193,129,1020},{44226,57,9233},{44241,129,1053},
+{44274,17,9248},{44353,241,9253},{44449,61,9314},{45217,373,1086},
+{45473,373,1180},{45729,373,1274},{45985,373,1368},{46241,373,1462},
+{46497,373,1556},{46753,373,1650},{47009,373,1744},{47265,373,1838},
+{47521,373,1932},{47777,373,2026},{48033,373,2120},{48289,373,2214},
+{48545,373,2308},{48801,373,2402},{49057,373,2496},{49313,373,2590},
+{49569,373,2684},{49825,373,2778},{50081,373,2872},{50337,373,2966},
+{50593,373,3060},{50849,373,3154},{51105,373,3248},{51361,373,3342},
+{51873,373,3436},{52129,185,3530},{52176,0,4116},{52177,17,3577},
+{52182,0,3678},{52183,61,3582},{52199,0,7053},{52200,89,3598},
+{52385,373,3621},{52641,181,3715},{52687,0,3460},{52688,93,3761},
+{52712,0,7900},{52713,85,3785},{52897,45,3807},{52909,0,3802},
+{52910,321,3819},{53153,357,3900},{53243,0,3902},{53244,9,3990},
+{53409,6,0},{53411,81,3994},{53432,0,3946},{53433,89,4015},
+{53456,0,3708},{53457,45,4038},{53469,0,4131},{53470,129,4050},
+{53665,201,4083},{53716,6,2},{53718,5,4134},{53720,0,4375},
+{53721,5,4136},{53723,21,4376},{53729,6,4},{53731,9,4382},
+{53734,6,6},{53736,13,4387},{53740,10,8},{53743,5,4394},
+{53745,6,11},{53747,9,4143},{53750,0,4399},{53751,9,4146},
+{53754,6,13},{53756,5,4406},{53758,0,4409},{53921,0,4150},
+{53922,5,4410},{53924,9,4151},{53927,13,4412},{53931,10,15},
+{53934,13,4155},{53938,0,4424},{53939,41,4159},{53950,0,4511},
+{53951,9,4170},{53954,5,4513},{53956,6,18},{53958,17,4518},
+{53963,6,20},{53965,5,4525},{53967,21,4528},{53973,9,4535},
+{53976,0,4175},{53977,5,4541},{53979,9,4176},{53982,5,4545},
+{53984,18,22},{53989,13,4566},{53993,5,4571},{53995,0,4576},
+{53996,13,4181},{54000,13,4604},{54004,5,4609},{54006,0,4185},
+{54007,5,4611},{54009,21,4186},{54177,373,4192},{54433,273,4286},
+{54502,0,4318},{54503,81,4355},{54524,0,4136},{54525,5,4376},
+{54689,13,4378},{54693,0,5800},{54694,17,4382},{54699,0,4139},
+{54700,5,4387},{54702,0,4192},{54703,317,4389},{54945,89,4469},
+{54968,0,4167},{54969,77,4492},{54989,0,4172},{54990,193,4512},
+{55201,165,4561},{55243,0,5552},{55244,93,4603},{55268,0,6424},
+{55269,101,4627},{55457,373,4653},{55713,373,4747},{55969,373,4841},
+{56225,141,4935},{56261,0,5151},{56262,117,4971},{56292,0,4922},
+{56293,101,5001},{56481,13,5027},{56485,0,7518},{56486,353,5031},
+{56737,13,5120},{56741,0,5079},{56742,185,5124},{56789,0,5109},
+{56790,117,5171},{56820,0,7607},{56821,37,5201},{56993,361,5211},
+{57084,10,27},{57249,69,5303},{57267,0,7083},{57268,177,5321},
+{57313,0,5362},{57314,21,5366},{57320,0,5485},{57321,85,5372},
+{57505,317,5394},{57585,0,6001},{57586,49,5474},{57761,45,5487},
+{57773,0,5460},{57774,249,5499},{57837,0,5317},{57838,65,5562},
+{58017,373,5579},{58273,333,5673},{58357,0,7009},{58358,33,5757},
+{58529,0,7370},{58530,25,5766},{58537,0,5678},{58538,337,5773},
+{58785,49,5858},{58798,0,5874},{58799,5,5871},{58801,5,4425},
+{58803,21,5873},{58809,6,30},{58811,5,4429},{58813,25,5880},
+{58820,0,4431},{58821,33,5887},{58830,18,32},{58835,9,5898},
+{58838,0,4439},{58839,137,5901},{58874,5,4442},{58876,10,37},
+{59041,0,4447},{59042,5,5937},{59044,0,4449},{59045,5,5939},
+{59047,0,4450},{59048,17,5941},{59053,6,40},{59055,9,4455},
+{59058,6,42},{59060,9,5948},{59063,5,4459},{59065,9,5951},
+{59068,0,4463},{59069,25,5954},{59076,6,44},{59078,5,4465},
+{59080,5,5962},{59082,0,4161},{59083,25,5964},{59090,0,4468},
+{59091,9,5971},{59094,0,4469},{59095,5,5974},{59097,0,4470},
+{59098,5,5976},{59100,0,4162},{59101,5,5978},{59103,10,46},
+{59106,5,5981},{59108,22,49},{59114,5,4478},{59116,0,6447},
+{59117,5,5985},{59119,14,55},{59123,5,5988},{59125,18,59},
+{59130,17,5991},{59297,0,4487},{59298,13,5996},{59302,0,4488},
+{59303,5,6000},{59305,18,64},{59310,5,6003},{59312,0,4494},
+{59313,53,6005},{59327,10,69},{59330,13,6020},{59334,6,72},
+{59336,9,6024},{59339,14,74},{59343,5,4503},{59345,5,6029},
+{59347,0,4506},{59348,41,6031},{59359,0,4508},{59360,13,6042},
+{59364,10,78},{59367,61,6047},{59383,0,5797},{59384,25,6063},
+{59553,277,6070},{59623,5,4551},{59625,25,6140},{59632,6,81},
+{59634,17,6147},{59639,18,83},{59644,5,6154},{59646,0,4557},
+{59809,21,6156},{59815,0,4560},{59816,13,6162},{59820,0,4561},
+{59821,121,6166},{59852,0,4563},{59853,165,6197},{59895,0,7988},
+{59896,25,6239},{60065,125,6246},{60097,0,6123},{60098,137,6278},
+{60133,0,4577},{60134,53,6313},{60148,0,4183},{60149,5,6327},
+{60151,0,4579},{60152,13,6329},{60156,10,88},{60321,9,6334},
+{60324,0,4584},{60325,5,6337},{60327,14,91},{60331,57,6340},
+{60346,5,4590},{60348,6,95},{60350,9,6356},{60353,6,97},
+{60355,9,6359},{60358,5,4596},{60360,13,6362},{60364,0,4599},
+{60365,5,6366},{60367,9,4600},{60370,0,5552},{60371,17,6368},
+{60376,0,4603},{60377,149,6373},{60577,17,6411},{60582,6,99},
+{60584,5,6416},{60586,0,4618},{60587,13,6418},{60591,0,5950},
+{60592,5,4620},{60594,0,4187},{60595,5,6422},{60597,0,4625},
+{60598,5,6424},{60600,10,101},{60603,17,6427},{60608,5,4632},
+{60610,9,6432},{60613,6,104},{60615,5,6435},{60617,5,4188},
+{60619,37,6437},{60629,0,4638},{60630,25,6447},{60637,5,4640},
+{60639,5,6454},{60641,0,4642},{60642,5,6456},{60644,0,4644},
+{60645,5,6458},{60647,5,4645},{60649,53,6460},{60663,5,4647},
+{60665,6,106},{60667,13,6475},{60833,9,4653},{60836,293,6479},
+{60910,0,5351},{60911,61,6553},{61089,229,6569},{61147,0,6494},
+{61148,137,6627},{61345,373,6662},{61601,373,6756},{61857,373,6850},
+{62113,109,6944},{62141,0,5731},{62142,237,6972},{62202,0,5771},
+{62203,13,7032},{62369,61,7036},{62385,0,4191},{62386,305,7052},
+{62625,21,7129},{62631,0,6484},{62632,277,7135},{62702,0,6684},
+{62703,61,7205},{62881,373,7221},{63137,329,7315},{63220,10,108},
+{63223,29,7399},{63393,89,7407},{63416,0,4247},{63417,57,7430},
+{63432,0,4266},{63433,37,7445},{63443,0,4340},{63444,169,7455},
+{63649,229,7498},{63707,0,7572},{63708,77,7556},{63728,0,5088},
+{63729,53,7576},{63905,373,7590},{64161,6,111},{64163,265,7684},
+{64230,0,3644},{64231,93,7751},{64417,373,7775},{64673,29,7869},
+{64681,0,3815},{64682,337,7877},{64929,373,7962},
+};
+
+static const unsigned short cmap_KSCpc_EUC_H_table[113] = {
+3993,3946,4374,4156,4138,5800,4386,4139,4140,4391,4141,4142,
+4396,4403,4149,4419,4154,4420,4517,4173,4524,4174,4179,4547,
+4550,4180,4564,5584,5302,5367,4427,5879,4435,5896,4436,5897,
+4437,4159,5936,4444,4453,5946,5947,4458,4160,5961,4471,5980,
+4472,4474,4473,4475,5983,4476,5984,4481,5987,4482,5460,4483,
+4163,4166,5990,4485,4489,4491,6002,4167,4493,4495,6019,7783,
+4497,4499,4501,6027,4502,6028,4509,6046,4510,4553,4180,4555,
+6152,5800,6153,4556,4581,6333,4582,4586,6339,4588,4184,6355,
+4592,4593,4595,4614,4616,4627,6426,4629,4634,4636,6474,4650,
+4279,7398,7139,7709,3558,
+};
+
+static pdf_cmap cmap_KSCpc_EUC_H = {
+	-1, "KSCpc-EUC-H", "", 0, 0, 3,
+	{ {1,0,132},{2,41281,65022},{1,254,255}, },
+	435, 435, (pdf_range*) cmap_KSCpc_EUC_H_ranges,
+	113, 113, (unsigned short*) cmap_KSCpc_EUC_H_table,
+};
+
+/* KSCpc-EUC-V */
+
+static const pdf_range cmap_KSCpc_EUC_V_ranges[] = {
+{41378,5,8056},{41381,6,0},{41385,9,8059},{41389,0,8062},
+{41394,45,8063},{41451,0,8075},{41889,0,8076},{41896,5,8077},
+{41900,0,8079},{41902,0,8080},{41914,21,8081},{41947,0,8087},
+{41949,0,8088},{41951,0,8089},{41979,13,8090},
+};
+
+static const unsigned short cmap_KSCpc_EUC_V_table[2] = {
+8058,8320,
+};
+
+static pdf_cmap cmap_KSCpc_EUC_V = {
+	-1, "KSCpc-EUC-V", "KSCpc-EUC-H", 0, 1, 0,
+	{ {0,0,0}, },
+	15, 15, (pdf_range*) cmap_KSCpc_EUC_V_ranges,
+	2, 2, (unsigned short*) cmap_KSCpc_EUC_V_table,
+};
+
+/* UniKS-UCS2-H */
+
+static const pdf_range cmap_UniKS_UCS2_H_ranges[] = {
+{32,377,1},{161,0,208},{164,0,214},{167,6,0},
+{170,6,2},{176,6,4},{178,5,843},{180,0,199},
+{182,0,244},{184,30,6},{198,0,666},{208,0,667},
+{215,6,14},{222,6,16},{230,0,757},{240,0,759},
+{247,6,18},{254,0,769},{273,0,758},{294,6,20},
+{305,10,22},{312,0,763},{319,14,25},{329,10,29},
+{338,6,32},{358,6,34},{700,0,8275},{711,0,201},
+{728,22,36},{913,65,471},{931,25,488},{945,65,495},
+{963,25,512},{1025,0,1026},{1040,21,1020},{1046,125,1027},
+{1078,101,1060},{1105,0,1059},{8211,5,109},{8214,0,111},
+{8216,5,114},{8219,0,8238},{8220,5,116},{8223,0,8237},
+{8224,5,245},{8226,0,8607},{8229,5,105},{8240,0,216},
+{8242,5,139},{8244,10,42},{8249,5,8612},{8251,6,45},
+{8258,0,8599},{8308,0,845},{8314,5,8239},{8316,0,8248},
+{8317,5,8250},{8319,0,846},{8321,13,847},{8451,0,141},
+{8457,0,215},{8467,0,590},{8470,0,258},{8481,6,47},
+{8486,0,643},{8491,0,142},{8531,5,749},{8539,13,753},
+{8544,37,461},{8560,37,451},{8592,5,171},{8594,0,170},
+{8595,5,173},{8597,18,49},{8624,18,54},{8636,0,8884},
+{8640,0,8885},{8644,5,8896},{8653,0,8816},{8655,22,59},
+{8672,14,65},{8678,14,69},{8704,0,197},{8706,6,73},
+{8710,14,75},{8715,6,79},{8719,0,213},{8721,0,212},
+{8723,0,8726},{8730,0,178},{8733,14,81},{8738,0,8738},
+{8741,5,8719},{8743,5,192},{8745,6,85},{8747,5,182},
+{8750,0,211},{8756,14,87},{8765,0,179},{8771,0,8500},
+{8773,0,8499},{8776,0,8501},{8784,14,91},{8794,0,8753},
+{8800,10,95},{8804,5,134},{8806,5,8724},{8814,5,8745},
+{8816,13,8481},{8822,5,8489},{8825,0,8491},{8826,5,8475},
+{8832,5,8479},{8834,5,188},{8836,6,98},{8838,5,186},
+{8842,6,100},{8853,9,8727},{8867,10,102},{8891,5,8751},
+{8910,5,8477},{8922,5,8492},{8942,6,105},{8966,0,8754},
+{8978,0,150},{8980,0,8731},{9312,57,733},{9327,17,8791},
+{9332,57,827},{9347,17,9042},{9372,101,801},{9398,101,8388},
+{9424,101,707},{9472,14,107},{9484,70,111},{9502,5,559},
+{9504,0,541},{9505,5,561},{9507,10,129},{9510,5,563},
+{9512,0,543},{9513,5,565},{9515,6,132},{9517,5,567},
+{9519,6,134},{9521,5,569},{9523,6,136},{9525,5,571},
+{9527,6,138},{9529,5,573},{9531,6,140},{9533,5,575},
+{9535,0,545},{9536,5,577},{9538,0,550},{9539,29,579},
+{9547,0,540},{9618,0,232},{9632,6,142},{9635,0,229},
+{9636,5,233},{9638,14,144},{9649,10,148},{9653,10,151},
+{9657,0,8781},{9660,6,154},{9663,10,156},{9667,0,8782},
+{9670,26,159},{9678,6,166},{9680,5,230},{9702,0,8775},
+{9711,0,8633},{9733,6,168},{9742,6,170},{9756,14,172},
+{9775,0,8664},{9792,0,147},{9794,0,146},{9824,5,222},
+{9827,10,176},{9831,6,179},{9833,5,253},{9836,6,181},
+{9839,0,8594},{10006,0,8631},{10010,0,8630},{10045,0,8604},
+{10070,0,8637},{10102,37,8673},{10122,37,8342},{12288,9,101},
+{12291,0,108},{12296,37,120},{12306,6,183},{12308,5,118},
+{12310,13,8219},{12318,5,9322},{12320,0,8671},{12342,0,8701},
+{12353,329,851},{12449,341,934},{12539,6,185},{12593,201,358},
+{12644,0,101},{12645,165,409},{12800,109,773},{12828,0,257},
+{12849,0,8788},{12857,0,8789},{12896,109,679},{12927,0,256},
+{12938,21,9301},{12944,0,9300},{12948,0,9080},{12958,0,8761},
+{12965,0,9096},{13184,17,627},{13192,5,612},{13194,9,646},
+{13197,9,608},{13200,17,638},{13205,9,587},{13208,0,591},
+{13209,37,597},{13219,13,593},{13223,5,615},{13225,13,655},
+{13229,9,651},{13232,37,617},{13242,21,632},{13248,5,644},
+{13250,38,187},{13263,6,197},{13267,0,661},{13270,0,649},
+{13272,0,262},{13275,10,199},{19968,6,202},{19971,0,7364},
+{19975,18,204},{19981,0,5109},{19985,0,7288},{19988,10,209},
+{19992,6,212},{19998,0,5682},{20013,0,6922},{20018,0,3802},
+{20024,6,214},{20027,0,6860},{20034,6,216},{20037,0,3894},
+{20043,0,6942},{20045,10,218},{20054,0,3855},{20056,6,221},
+{20061,10,223},{20075,0,3500},{20077,0,4329},{20083,0,6309},
+{20086,6,226},{20094,0,3601},{20098,0,4389},{20102,0,4551},
+{20104,0,5934},{20107,6,228},{20110,0,6197},{20112,10,230},
+{20116,6,233},{20120,0,4058},{20123,0,5243},{20126,0,5775},
+{20129,6,235},{20132,10,237},{20136,0,7771},{20139,14,240},
+{20150,0,4193},{20154,0,6443},{20160,6,244},{20164,0,7331},
+{20167,0,3896},{20170,6,246},{20173,0,6479},{20180,22,248},
+{20189,0,4331},{20191,0,7148},{20195,10,254},{20208,0,5833},
+{20210,0,6923},{20214,6,257},{20219,0,6469},{20225,0,4062},
+{20233,10,259},{20237,18,262},{20271,0,4988},{20276,0,4905},
+{20278,0,4490},{20280,0,5735},{20282,0,5245},{20284,6,267},
+{20291,0,6643},{20294,10,269},{20301,18,272},{20309,0,7617},
+{20313,14,277},{20329,0,7502},{20335,6,281},{20339,0,3437},
+{20342,0,4127},{20346,0,6644},{20350,6,283},{20353,0,5736},
+{20355,6,285},{20358,0,4420},{20360,0,7336},{20362,6,287},
+{20365,0,5692},{20367,0,6862},{20369,0,6310},{20374,0,4594},
+{20376,0,7042},{20379,0,3786},{20381,0,6394},{20398,6,289},
+{20405,6,291},{20415,0,7518},{20418,10,293},{20425,6,296},
+{20430,0,6782},{20433,0,6174},{20435,6,298},{20439,0,5537},
+{20442,0,4613},{20445,0,5058},{20447,10,300},{20462,6,303},
+{20465,0,3897},{20467,0,4970},{20469,0,7576},{20472,0,5093},
+{20474,0,5925},{20482,0,5042},{20486,0,4428},{20489,0,7092},
+{20491,0,3562},{20493,0,4969},{20497,6,305},{20502,0,7705},
+{20505,6,307},{20508,0,7134},{20510,6,309},{20513,0,7093},
+{20515,6,311},{20518,10,313},{20522,14,316},{20539,0,5863},
+{20547,0,5917},{20551,10,320},{20559,0,7519},{20565,0,7686},
+{20570,0,6863},{20572,0,6707},{20581,0,3603},{20596,10,323},
+{20600,0,7465},{20608,0,3856},{20613,0,5112},{20621,0,4942},
+{20625,0,3614},{20632,6,326},{20652,6,328},{20658,6,330},
+{20661,0,7114},{20663,0,5332},{20670,0,3663},{20677,0,4023},
+{20681,6,332},{20687,0,5333},{20689,0,3869},{20693,6,334},
+{20698,0,4552},{20702,0,6286},{20709,0,6140},{20711,0,5684},
+{20717,0,7082},{20729,0,3439},{20731,0,5020},{20735,10,336},
+{20740,0,5912},{20742,0,3664},{20745,0,3617},{20754,0,6311},
+{20767,0,5334},{20769,0,4543},{20778,0,6200},{20786,0,6593},
+{20791,0,4441},{20794,0,4133},{20796,0,5926},{20800,6,339},
+{20803,26,341},{20811,14,348},{20818,0,5777},{20828,0,4348},
+{20834,0,4059},{20837,0,6477},{20839,30,352},{20849,0,3788},
+{20853,14,360},{20860,0,3654},{20864,0,4065},{20870,0,5933},
+{20874,0,7126},{20877,0,6570},{20882,0,4765},{20885,0,4736},
+{20887,0,6176},{20896,0,3819},{20901,0,4748},{20906,0,4733},
+{20908,0,4332},{20918,6,364},{20925,0,4477},{20932,0,7130},
+{20934,0,6904},{20937,0,4430},{20939,10,366},{20956,10,369},
+{20961,0,5009},{20976,6,372},{20982,0,8014},{20984,10,374},
+{20989,0,7651},{20992,0,4270},{20995,0,6445},{20998,10,377},
+{21002,0,3477},{21006,0,4837},{21009,0,7773},{21015,0,4478},
+{21021,0,7214},{21028,6,380},{21033,6,382},{21038,0,3835},
+{21040,0,4271},{21046,22,384},{21059,0,7205},{21063,0,7360},
+{21066,14,390},{21076,0,7135},{21078,0,5113},{21083,0,3536},
+{21085,0,4886},{21089,0,5463},{21097,6,394},{21103,0,5114},
+{21106,0,7649},{21109,0,7094},{21117,0,7577},{21119,0,7215},
+{21123,0,7948},{21127,10,396},{21133,0,3618},{21137,6,399},
+{21147,0,4458},{21151,6,401},{21155,6,403},{21161,10,405},
+{21182,0,7703},{21185,0,3665},{21187,0,4930},{21189,0,7361},
+{21191,0,6177},{21193,0,4737},{21197,0,3666},{21202,0,4604},
+{21205,6,408},{21208,6,410},{21211,0,7979},{21213,10,412},
+{21218,10,415},{21235,0,7980},{21237,0,4442},{21240,0,3971},
+{21242,6,418},{21246,6,420},{21253,0,7545},{21256,0,8015},
+{21261,0,7546},{21263,6,422},{21269,10,424},{21273,0,5693},
+{21280,6,427},{21283,0,3530},{21290,0,5184},{21295,0,7928},
+{21305,0,7604},{21311,10,429},{21315,6,432},{21319,14,434},
+{21325,0,4671},{21329,14,438},{21335,0,4145},{21338,0,4887},
+{21340,0,5077},{21342,0,5031},{21344,0,6692},{21350,0,3852},
+{21352,0,5450},{21359,10,442},{21364,6,445},{21367,0,3972},
+{21373,0,6926},{21375,0,3667},{21380,0,5851},{21395,0,5840},
+{21400,0,4615},{21402,0,7968},{21407,6,447},{21413,6,449},
+{21421,0,5989},{21435,0,3586},{21443,0,7083},{21448,14,451},
+{21453,0,4907},{21460,0,5628},{21462,6,455},{21467,0,4908},
+{21473,18,457},{21481,18,462},{21487,18,467},{21496,0,5251},
+{21507,6,472},{21512,10,474},{21516,22,477},{21531,0,3953},
+{21533,0,4638},{21535,6,483},{21542,0,5115},{21545,0,5153},
+{21547,0,7652},{21555,0,6055},{21560,6,485},{21563,6,487},
+{21566,0,6054},{21570,0,4443},{21576,0,6709},{21578,0,3731},
+{21585,0,7408},{21608,0,6867},{21610,0,6866},{21617,0,3732},
+{21619,0,4851},{21621,0,3442},{21627,10,489},{21632,0,6594},
+{21638,0,7548},{21644,0,7864},{21646,0,3903},{21648,0,5116},
+{21668,0,7381},{21672,0,6485},{21675,6,492},{21683,0,7687},
+{21688,0,7653},{21693,0,6447},{21696,6,494},{21700,0,7853},
+{21704,6,496},{21729,0,6257},{21733,0,3443},{21736,0,7216},
+{21741,6,498},{21746,0,7168},{21754,0,7549},{21764,0,7503},
+{21766,6,500},{21774,0,4617},{21776,0,4239},{21788,0,4689},
+{21807,0,6313},{21809,0,7095},{21813,0,5821},{21822,0,7382},
+{21828,0,7396},{21830,0,5335},{21839,0,4839},{21843,0,3706},
+{21846,0,4217},{21854,0,5778},{21859,0,7654},{21884,0,6761},
+{21888,0,3579},{21892,0,5421},{21894,6,502},{21897,6,504},
+{21912,10,506},{21916,6,509},{21927,0,7990},{21929,14,511},
+{21934,0,4195},{21957,0,7972},{21959,0,5365},{21972,0,6981},
+{21978,0,6056},{21980,0,4066},{21983,0,7045},{21987,6,515},
+{22013,6,517},{22022,0,7409},{22025,0,3444},{22036,0,3904},
+{22039,0,5337},{22063,0,5501},{22066,0,6786},{22068,0,7318},
+{22070,0,5694},{22099,0,7719},{22120,0,4067},{22123,0,8038},
+{22132,0,5154},{22150,0,7954},{22181,0,5956},{22188,0,5223},
+{22190,0,7712},{22196,0,5927},{22204,0,6511},{22218,0,4152},
+{22221,0,8039},{22225,0,7242},{22234,6,519},{22238,0,7929},
+{22240,0,6448},{22256,0,3774},{22265,6,521},{22275,6,523},
+{22280,0,3973},{22283,0,3947},{22285,0,6288},{22290,6,525},
+{22294,0,4272},{22296,0,4196},{22303,0,7451},{22312,0,6572},
+{22317,0,3995},{22320,0,6945},{22331,0,4068},{22336,0,6946},
+{22338,0,7491},{22343,0,4010},{22346,0,4943},{22349,6,527},
+{22352,6,529},{22369,0,7474},{22372,0,3775},{22374,0,7410},
+{22378,0,7529},{22382,0,4252},{22384,0,3668},{22389,0,3905},
+{22396,0,7397},{22402,0,5571},{22408,0,4251},{22411,0,7774},
+{22419,0,7688},{22432,0,6373},{22434,6,531},{22467,0,5842},
+{22471,6,533},{22475,0,4708},{22478,0,5474},{22495,6,535},
+{22512,0,7115},{22516,0,5720},{22519,0,7032},{22521,6,537},
+{22524,0,4070},{22528,0,3959},{22530,0,4240},{22533,6,539},
+{22536,10,541},{22558,0,7187},{22561,0,5059},{22564,0,6762},
+{22567,0,5957},{22570,0,3512},{22575,10,544},{22580,6,547},
+{22586,0,3707},{22602,6,549},{22607,0,3564},{22609,0,5502},
+{22612,0,7424},{22615,6,551},{22618,0,7252},{22622,0,5362},
+{22625,6,553},{22628,0,7981},{22645,0,6982},{22649,0,7084},
+{22652,0,6651},{22654,0,5629},{22659,0,3669},{22661,0,5373},
+{22665,0,6179},{22675,0,4801},{22684,0,7265},{22686,6,555},
+{22696,6,557},{22702,0,7383},{22707,0,5155},{22714,6,559},
+{22718,0,3478},{22721,0,5022},{22725,0,6090},{22727,0,4197},
+{22734,0,7982},{22737,0,7630},{22739,0,5829},{22741,0,7803},
+{22744,6,561},{22750,6,563},{22756,0,5880},{22763,6,565},
+{22767,0,6539},{22777,10,567},{22781,0,5572},{22799,0,7619},
+{22804,10,570},{22809,6,573},{22812,0,5865},{22818,0,4797},
+{22823,0,4253},{22825,10,575},{22829,6,578},{22833,0,5758},
+{22839,0,6416},{22846,0,7761},{22852,0,5928},{22855,10,580},
+{22862,14,583},{22868,6,587},{22871,0,7466},{22874,0,7689},
+{22880,0,6652},{22882,0,5256},{22887,0,6059},{22890,18,589},
+{22899,6,594},{22904,0,3479},{22909,0,7805},{22914,10,596},
+{22922,0,6471},{22931,0,4073},{22934,6,599},{22937,0,4802},
+{22949,0,7384},{22952,0,4944},{22956,0,7467},{22969,0,4709},
+{22971,0,7131},{22974,0,7188},{22979,0,6710},{22982,0,4767},
+{22985,0,6486},{22987,0,5695},{22992,6,601},{22995,6,603},
+{23001,6,605},{23004,6,607},{23014,0,3480},{23016,0,6417},
+{23018,0,7017},{23020,0,8040},{23022,0,7672},{23032,0,5958},
+{23035,0,6449},{23039,0,6487},{23041,0,6290},{23043,0,6132},
+{23057,0,5257},{23064,0,4153},{23067,6,609},{23071,6,611},
+{23077,0,5779},{23081,0,4672},{23094,0,7319},{23100,0,7096},
+{23105,0,4565},{23110,0,7475},{23113,0,6107},{23130,0,7844},
+{23138,0,5187},{23142,0,5119},{23186,0,4710},{23194,6,613},
+{23204,0,5696},{23233,6,615},{23236,0,6262},{23241,0,7018},
+{23244,0,7758},{23265,0,6621},{23270,0,7673},{23273,0,4181},
+{23301,0,7865},{23305,0,8041},{23307,6,617},{23318,0,7535},
+{23338,0,5224},{23360,0,5338},{23363,0,5881},{23376,6,619},
+{23380,6,621},{23383,6,623},{23386,0,5120},{23388,6,625},
+{23391,0,4727},{23395,6,627},{23401,0,7690},{23403,0,5546},
+{23408,6,629},{23413,0,5121},{23416,0,7631},{23418,0,6315},
+{23420,0,5923},{23429,0,4266},{23431,10,631},{23435,6,634},
+{23439,0,3864},{23443,0,5078},{23445,30,636},{23458,18,644},
+{23468,0,5476},{23470,0,3963},{23472,0,6573},{23475,14,649},
+{23480,6,653},{23487,6,655},{23490,22,657},{23500,0,5122},
+{23504,0,4711},{23506,10,663},{23511,0,4168},{23518,6,666},
+{23521,6,668},{23524,22,670},{23531,6,676},{23534,6,678},
+{23541,6,680},{23544,0,7247},{23546,0,5259},{23553,0,5095},
+{23556,0,5260},{23559,18,682},{23565,10,687},{23569,0,5505},
+{23574,0,7178},{23577,0,5339},{23588,0,6206},{23592,0,4945},
+{23601,0,7320},{23608,18,690},{23614,10,695},{23621,6,698},
+{23624,0,3960},{23627,0,6078},{23629,6,700},{23633,0,5451},
+{23637,0,6654},{23643,0,5044},{23648,0,4276},{23650,0,4566},
+{23652,6,702},{23660,0,5538},{23663,0,4358},{23665,0,5305},
+{23673,0,8024},{23696,6,704},{23713,0,3539},{23721,0,5822},
+{23723,6,706},{23729,0,4255},{23731,0,5794},{23733,0,7806},
+{23735,6,708},{23738,0,4492},{23742,0,6693},{23744,0,5576},
+{23769,0,7339},{23776,0,5340},{23784,0,5780},{23791,5,5096},
+{23796,0,7735},{23798,0,4277},{23803,0,6907},{23805,0,7762},
+{23815,0,5671},{23821,6,710},{23825,0,3776},{23828,0,7263},
+{23830,6,712},{23833,0,4596},{23847,0,5672},{23849,0,5175},
+{23883,6,714},{23888,0,4399},{23913,0,5673},{23916,0,6136},
+{23919,0,7046},{23943,0,3908},{23947,0,4278},{23965,0,4365},
+{23968,0,3873},{23970,0,6147},{23978,0,5931},{23992,0,6003},
+{23994,0,4493},{23996,6,716},{24013,0,6137},{24018,0,4673},
+{24022,0,5823},{24029,6,718},{24033,6,720},{24037,14,722},
+{24043,0,4813},{24046,0,7047},{24049,14,726},{24055,0,7674},
+{24061,6,730},{24066,6,732},{24070,0,5010},{24076,0,8042},
+{24081,0,7428},{24086,0,7189},{24089,0,7019},{24091,0,4990},
+{24093,0,6763},{24101,0,5577},{24107,0,5262},{24109,0,5405},
+{24115,0,6542},{24118,0,4256},{24120,0,5341},{24125,0,4768},
+{24127,6,734},{24132,6,736},{24135,0,4946},{24140,0,7905},
+{24149,0,4665},{24159,0,7340},{24161,10,738},{24178,10,741},
+{24183,10,744},{24187,0,7886},{24188,5,6317},{24190,0,4078},
+{24196,0,6543},{24199,0,5188},{24202,0,5342},{24207,0,5376},
+{24213,0,6596},{24215,0,6694},{24218,0,3670},{24220,0,5123},
+{24224,0,5343},{24230,6,747},{24235,0,3737},{24237,0,6713},
+{24245,14,749},{24254,0,6319},{24258,0,5344},{24264,10,753},
+{24272,0,3909},{24275,0,3815},{24278,0,4554},{24282,6,756},
+{24287,6,758},{24290,6,760},{24300,0,4444},{24307,0,7197},
+{24310,6,762},{24314,6,764},{24321,0,5032},{24324,0,4537},
+{24330,0,7538},{24335,0,5722},{24337,0,5701},{24339,10,766},
+{24343,6,769},{24347,0,6419},{24351,0,6764},{24358,6,771},
+{24361,0,4171},{24369,0,5872},{24373,0,6544},{24378,0,3542},
+{24380,0,7605},{24392,0,7411},{24394,0,3543},{24396,0,4855},
+{24398,0,4674},{24406,6,773},{24409,0,7997},{24411,0,6420},
+{24418,0,7775},{24422,6,775},{24425,18,777},{24432,6,782},
+{24439,0,4947},{24441,0,5949},{24444,0,7597},{24447,10,784},
+{24453,0,4257},{24455,0,5641},{24458,10,787},{24464,10,790},
+{24471,10,793},{24478,0,6839},{24480,6,796},{24488,10,798},
+{24494,0,4856},{24501,0,7038},{24503,0,4267},{24505,0,7170},
+{24509,0,7998},{24515,0,5764},{24517,0,7606},{24524,6,801},
+{24534,6,803},{24536,5,4698},{24544,0,7307},{24555,0,7379},
+{24565,0,4163},{24573,0,7850},{24575,0,5158},{24591,0,5835},
+{24594,0,4172},{24598,0,7552},{24604,6,805},{24608,6,807},
+{24613,0,4053},{24615,6,809},{24618,0,3859},{24623,0,3625},
+{24641,10,811},{24653,0,7907},{24656,0,3792},{24658,0,7675},
+{24661,0,5379},{24665,0,5882},{24669,0,3836},{24674,14,814},
+{24680,10,818},{24684,6,821},{24687,6,823},{24709,0,5985},
+{24713,0,5761},{24716,6,825},{24724,0,7933},{24726,0,7504},
+{24730,6,827},{24735,6,829},{24739,6,831},{24743,0,4619},
+{24752,0,6840},{24754,10,833},{24758,0,4871},{24760,0,3711},
+{24764,6,836},{24773,0,6716},{24775,0,4320},{24785,0,7841},
+{24794,0,7851},{24796,0,5406},{24799,10,838},{24816,6,841},
+{24819,0,5345},{24822,0,7908},{24825,10,843},{24833,0,5578},
+{24838,0,3606},{24840,5,6322},{24845,10,846},{24853,0,5798},
+{24858,6,849},{24863,0,3514},{24871,0,3860},{24880,0,7909},
+{24884,0,7099},{24887,0,3565},{24892,0,5741},{24894,6,851},
+{24898,0,6182},{24900,0,4601},{24903,6,853},{24906,10,855},
+{24915,0,7579},{24917,0,4769},{24920,5,7085},{24925,0,7471},
+{24927,0,7453},{24930,10,858},{24935,6,861},{24939,0,6841},
+{24942,0,4445},{24944,0,6292},{24950,6,863},{24957,6,865},
+{24961,6,867},{24970,0,5190},{24974,0,6932},{24976,6,869},
+{24980,0,7217},{24984,10,871},{24996,0,5159},{24999,0,4336},
+{25001,0,3628},{25003,6,874},{25006,0,4814},{25010,0,7723},
+{25014,0,5913},{25018,0,4219},{25022,0,3515},{25027,0,4026},
+{25031,18,876},{25062,0,4135},{25074,0,7039},{25078,10,881},
+{25082,0,7087},{25084,0,3910},{25087,6,884},{25095,6,886},
+{25098,0,4816},{25100,10,888},{25104,10,891},{25110,0,7842},
+{25114,0,7138},{25119,0,4019},{25121,0,3516},{25130,0,6685},
+{25134,0,4592},{25136,6,894},{25140,0,4258},{25142,0,7808},
+{25150,14,896},{25159,10,900},{25163,0,5580},{25165,0,6574},
+{25171,0,7386},{25176,0,7398},{25198,0,5160},{25201,0,4054},
+{25206,0,5124},{25209,0,5192},{25212,0,5852},{25215,6,903},
+{25220,0,7218},{25225,6,905},{25233,6,907},{25237,0,7468},
+{25239,6,909},{25243,0,7553},{25259,0,7598},{25265,0,7554},
+{25269,0,6597},{25273,0,4690},{25276,6,911},{25282,0,5174},
+{25287,10,913},{25292,6,916},{25295,6,918},{25298,10,920},
+{25302,14,923},{25307,6,927},{25324,14,929},{25329,0,3794},
+{25331,0,3974},{25335,0,3738},{25342,6,933},{25345,0,6948},
+{25351,0,6949},{25353,0,5809},{25361,0,4282},{25387,0,6858},
+{25391,0,6983},{25402,6,935},{25405,6,937},{25417,0,7055},
+{25420,0,7501},{25423,6,939},{25429,0,7555},{25447,6,941},
+{25454,0,3590},{25458,0,3975},{25463,0,7190},{25466,6,943},
+{25471,0,5381},{25475,0,5508},{25480,6,945},{25484,0,6545},
+{25490,0,4974},{25494,0,5853},{25496,0,3961},{25499,0,3853},
+{25504,10,947},{25509,0,6701},{25511,14,950},{25536,0,3484},
+{25540,0,6324},{25542,0,3997},{25551,6,954},{25558,0,6387},
+{25562,6,956},{25569,0,5799},{25581,6,958},{25588,0,6266},
+{25590,6,960},{25613,0,5548},{25615,0,4889},{25620,0,5509},
+{25622,6,962},{25628,0,5582},{25634,0,6984},{25644,6,964},
+{25658,0,8006},{25662,0,7056},{25688,0,6623},{25696,0,7256},
+{25705,0,4656},{25711,0,6950},{25720,5,4770},{25722,0,6702},
+{25736,0,4512},{25745,10,966},{25754,0,4161},{25758,0,4244},
+{25764,6,969},{25771,0,4818},{25773,6,971},{25776,0,7062},
+{25778,0,4890},{25787,0,4212},{25793,0,6091},{25796,6,973},
+{25799,0,7445},{25802,0,3630},{25805,6,975},{25810,0,4040},
+{25812,0,4220},{25816,0,5023},{25818,0,3591},{25825,6,977},
+{25829,10,979},{25836,0,6400},{25842,0,7140},{25844,0,7877},
+{25850,0,7479},{25854,0,6151},{25856,0,4911},{25860,0,7448},
+{25880,0,5884},{25885,0,5471},{25891,0,4467},{25898,10,982},
+{25903,0,6951},{25910,14,985},{25915,0,3796},{25918,6,989},
+{25925,0,3740},{25928,0,7956},{25933,10,991},{25937,0,3912},
+{25942,6,994},{25950,0,7100},{25954,6,996},{25958,0,4321},
+{25964,6,998},{25970,0,3741},{25972,6,1000},{25975,6,1002},
+{25982,0,5425},{25986,6,1004},{25989,0,7957},{25991,0,4840},
+{25996,0,5226},{26000,6,1006},{26007,0,4349},{26009,0,4555},
+{26011,6,1008},{26015,0,7030},{26017,0,5817},{26020,6,1010},
+{26023,0,5126},{26027,6,1012},{26031,6,1014},{26039,0,4199},
+{26041,0,4950},{26044,6,1016},{26049,0,4951},{26053,0,4447},
+{26059,6,1018},{26063,0,6828},{26066,0,4578},{26071,0,4081},
+{26080,0,4819},{26083,0,4082},{26085,6,1020},{26088,6,1022},
+{26092,6,1024},{26097,0,7638},{26100,0,6209},{26106,0,6127},
+{26107,5,4875},{26109,0,4322},{26111,0,6065},{26118,6,1026},
+{26121,6,1028},{26124,0,7101},{26126,14,1030},{26131,10,1034},
+{26142,10,1037},{26149,0,7300},{26151,6,1040},{26157,0,5510},
+{26159,10,1042},{26164,0,4805},{26166,0,7102},{26170,6,1045},
+{26177,6,1047},{26179,5,7911},{26185,0,6985},{26187,0,6986},
+{26191,0,5810},{26201,0,6908},{26203,0,7738},{26205,10,1049},
+{26212,22,1052},{26219,0,7400},{26222,6,1058},{26227,6,1060},
+{26230,10,1062},{26234,0,6953},{26244,0,7991},{26247,10,1065},
+{26254,0,6006},{26256,6,1068},{26262,10,1070},{26269,0,4752},
+{26272,0,3742},{26274,0,7103},{26283,0,6528},{26286,0,4772},
+{26290,10,1073},{26297,0,5464},{26299,0,3677},{26302,0,4323},
+{26308,0,5999},{26310,6,1076},{26313,0,7958},{26326,0,5845},
+{26329,0,5384},{26332,6,1078},{26336,0,3844},{26342,0,8047},
+{26352,0,6125},{26354,10,1080},{26359,14,1083},{26364,0,4678},
+{26366,10,1087},{26371,0,7936},{26376,6,1090},{26379,0,5176},
+{26381,0,5080},{26388,6,1092},{26391,0,4413},{26395,0,4700},
+{26397,0,6795},{26398,5,4083},{26406,10,1094},{26410,18,1097},
+{26417,0,6874},{26420,0,4891},{26422,0,7388},{26426,0,3984},
+{26429,0,7975},{26438,0,3485},{26441,0,5321},{26446,14,1102},
+{26451,0,7580},{26454,0,6547},{26460,0,4350},{26462,6,1106},
+{26477,0,7677},{26479,10,1108},{26483,0,4806},{26485,0,6598},
+{26487,0,7480},{26491,0,4183},{26494,6,1111},{26503,0,5194},
+{26505,0,6128},{26507,0,4953},{26511,6,1113},{26515,0,4351},
+{26517,0,7369},{26519,0,4647},{26522,0,4713},{26524,6,1115},
+{26543,6,1117},{26547,0,6955},{26550,5,3448},{26552,0,3913},
+{26558,0,5706},{26564,0,5048},{26575,22,1119},{26586,0,6328},
+{26589,0,7401},{26601,0,3914},{26604,0,3486},{26607,10,1125},
+{26611,14,1128},{26619,0,5269},{26622,0,6723},{26642,6,1132},
+{26646,6,1134},{26657,6,1136},{26666,0,6876},{26671,0,6233},
+{26680,6,1138},{26684,6,1140},{26688,14,1142},{26696,0,5811},
+{26702,0,7020},{26704,6,1146},{26707,6,1148},{26733,0,6987},
+{26742,0,7454},{26751,0,3487},{26753,0,4431},{26757,0,4714},
+{26767,0,3770},{26771,6,1150},{26775,0,3679},{26781,0,6796},
+{26783,0,7959},{26785,6,1152},{26791,6,1154},{26797,0,5270},
+{26799,10,1156},{26803,0,5511},{26805,6,1159},{26820,6,1161},
+{26825,0,4738},{26827,0,4086},{26829,0,3779},{26834,0,5099},
+{26837,0,6842},{26839,6,1163},{26842,0,5177},{26847,6,1165},
+{26855,6,1167},{26862,0,5322},{26866,0,5387},{26873,6,1169},
+{26880,0,6111},{26885,0,6401},{26893,6,1171},{26898,0,7221},
+{26919,0,4753},{26928,0,5868},{26941,0,5964},{26943,0,7301},
+{26954,0,5887},{26963,10,1173},{26967,0,3607},{26969,6,1176},
+{26974,0,4608},{26976,0,4147},{26977,5,6329},{26979,0,4859},
+{26984,0,6724},{26987,0,6928},{26989,10,1178},{26997,0,4021},
+{26999,10,1181},{27029,0,6183},{27035,6,1184},{27045,0,7913},
+{27047,0,5195},{27054,0,6008},{27060,0,4580},{27067,0,7426},
+{27073,0,3744},{27075,0,4913},{27083,10,1186},{27088,0,3862},
+{27112,0,3816},{27114,0,3569},{27131,0,3998},{27133,0,6798},
+{27135,0,4029},{27138,0,5800},{27146,0,4997},{27153,0,4432},
+{27155,0,4567},{27159,0,6600},{27161,0,7581},{27166,6,1189},
+{27169,0,4774},{27171,0,5888},{27189,0,7223},{27192,10,1191},
+{27197,0,6909},{27204,0,3519},{27208,0,6153},{27211,0,3878},
+{27218,6,1194},{27224,6,1196},{27231,0,4088},{27233,0,5347},
+{27243,0,7951},{27264,0,4201},{27268,0,3632},{27273,0,6725},
+{27277,6,1198},{27287,0,5024},{27292,0,7937},{27298,6,1200},
+{27315,0,5227},{27323,0,7656},{27330,6,1202},{27347,0,4514},
+{27354,6,1204},{27382,0,7724},{27387,0,5858},{27396,0,4391},
+{27402,0,3976},{27404,0,6550},{27410,0,4392},{27414,0,4402},
+{27424,6,1206},{27427,0,8020},{27442,0,6169},{27450,0,4089},
+{27453,6,1208},{27462,6,1210},{27468,0,3451},{27470,0,7413},
+{27472,0,3916},{27487,0,5937},{27489,22,1212},{27498,0,6133},
+{27506,0,5494},{27511,6,1218},{27515,0,5271},{27519,0,4795},
+{27523,6,1220},{27526,0,7436},{27529,6,1222},{27542,0,5726},
+{27544,0,6524},{27550,0,6240},{27566,6,1224},{27570,0,5465},
+{27573,0,4202},{27575,0,6376},{27578,0,5317},{27580,0,3470},
+{27583,0,6659},{27585,0,7996},{27589,6,1226},{27595,0,4822},
+{27597,0,4775},{27599,0,4715},{27602,10,1228},{27606,9,5197},
+{27611,0,4776},{27627,6,1231},{27656,0,6660},{27663,0,5774},
+{27665,0,4877},{27667,0,4728},{27683,0,4090},{27700,0,5587},
+{27703,6,1233},{27710,0,5012},{27712,10,1235},{27726,0,5013},
+{27728,0,5410},{27733,0,5307},{27735,0,7639},{27738,0,6068},
+{27741,14,1238},{27752,0,3784},{27754,0,6129},{27757,0,6034},
+{27760,0,7437},{27762,0,4055},{27766,0,4841},{27770,0,3649},
+{27773,6,1242},{27777,10,1244},{27781,14,1247},{27788,0,4324},
+{27792,0,4789},{27794,18,1251},{27801,10,1256},{27819,0,4692},
+{27822,0,6601},{27827,0,7622},{27832,6,1259},{27835,18,1261},
+{27841,6,1266},{27844,0,5453},{27849,6,1268},{27852,0,7607},
+{27859,0,7856},{27861,0,5018},{27863,0,5273},{27867,0,5014},
+{27873,10,1270},{27877,0,4187},{27880,0,6877},{27883,0,7739},
+{27886,10,1273},{27891,0,6010},{27915,6,1276},{27921,0,5064},
+{27927,0,5495},{27929,0,5588},{27931,0,4382},{27934,0,4340},
+{27941,0,6990},{27943,0,6332},{27945,6,1278},{27954,0,6878},
+{27957,6,1280},{27960,6,1282},{27963,0,7899},{27965,6,1284},
+{27969,0,4581},{27993,6,1286},{27996,0,5229},{28003,0,6112},
+{28006,0,7557},{28009,6,1288},{28012,0,4622},{28014,0,5127},
+{28020,0,6170},{28023,10,1290},{28031,0,7507},{28037,0,5986},
+{28039,10,1293},{28044,10,1296},{28049,0,5540},{28051,0,5968},
+{28053,0,7207},{28079,0,5846},{28082,0,5854},{28085,0,7657},
+{28096,0,6728},{28099,18,1299},{28107,0,4648},{28111,0,7814},
+{28113,0,5633},{28120,10,1304},{28126,0,5556},{28129,0,4222},
+{28136,0,6729},{28138,6,1307},{28142,0,7938},{28145,0,5766},
+{28147,0,5650},{28149,0,5969},{28151,18,1309},{28183,0,5323},
+{28185,10,1314},{28191,10,1317},{28195,14,1320},{28203,10,1324},
+{28207,0,7680},{28210,0,5427},{28212,0,3503},{28214,0,6011},
+{28216,0,6333},{28218,0,4807},{28220,10,1327},{28227,6,1330},
+{28234,0,6879},{28237,0,4203},{28246,0,7815},{28248,0,5348},
+{28251,6,1332},{28254,6,1334},{28263,0,6185},{28267,0,7271},
+{28270,6,1336},{28274,6,1338},{28282,0,5065},{28304,0,6270},
+{28310,0,6911},{28316,6,1340},{28319,0,4754},{28322,0,6465},
+{28325,0,5128},{28330,6,1342},{28335,0,5514},{28337,0,6991},
+{28342,0,6186},{28346,0,4189},{28354,0,4955},{28356,6,1344},
+{28361,0,7916},{28363,6,1346},{28366,0,7777},{28369,0,7900},
+{28371,6,1348},{28399,0,7208},{28404,0,6625},{28408,0,7816},
+{28414,6,1350},{28417,6,1352},{28422,0,7366},{28431,0,4569},
+{28433,0,3570},{28436,6,1354},{28448,0,4666},{28450,6,1356},
+{28459,6,1358},{28465,6,1360},{28472,0,6695},{28479,0,6551},
+{28481,0,6012},{28497,0,4934},{28500,0,3650},{28503,6,1362},
+{28506,6,1364},{28510,6,1366},{28514,0,7917},{28516,0,6362},
+{28525,6,1368},{28528,0,3986},{28538,0,6525},{28540,10,1370},
+{28545,0,5328},{28548,0,7040},{28552,0,7172},{28557,6,1373},
+{28560,0,6241},{28564,0,7817},{28567,0,3488},{28579,6,1375},
+{28583,0,4507},{28590,6,1377},{28593,0,6661},{28595,0,6069},
+{28601,0,4225},{28606,0,4213},{28608,14,1379},{28618,0,6035},
+{28629,0,5677},{28634,0,6013},{28639,10,1383},{28644,0,4291},
+{28649,0,7819},{28651,6,1386},{28655,0,7403},{28657,0,5230},
+{28670,0,4449},{28673,0,5890},{28677,6,1388},{28681,0,5275},
+{28683,0,5767},{28687,0,4583},{28689,0,7574},{28693,0,5231},
+{28696,0,4516},{28698,22,1390},{28707,0,7695},{28711,6,1396},
+{28719,0,6015},{28727,0,6437},{28734,0,4393},{28748,0,3825},
+{28752,6,1398},{28760,0,7414},{28765,0,7820},{28771,0,4681},
+{28779,0,7867},{28784,0,7940},{28792,0,3921},{28796,6,1400},
+{28805,0,3681},{28810,0,7321},{28814,0,5991},{28818,0,7224},
+{28824,10,1402},{28833,0,6733},{28836,0,5516},{28843,10,1405},
+{28847,0,7780},{28851,0,5050},{28855,10,1408},{28872,0,4481},
+{28875,0,8007},{28879,0,6070},{28888,6,1411},{28893,0,6935},
+{28895,0,5971},{28913,0,3682},{28921,0,7515},{28925,0,5100},
+{28932,0,7983},{28937,0,5920},{28940,0,6913},{28953,6,1413},
+{28958,0,4325},{28961,0,4823},{28966,0,7225},{28976,0,5992},
+{28982,0,5972},{28999,0,8001},{29001,6,1415},{29004,0,7918},
+{29006,0,6662},{29008,0,6016},{29014,0,4141},{29017,0,5973},
+{29020,0,6234},{29022,0,5318},{29028,14,1417},{29033,0,4998},
+{29036,0,5891},{29038,0,6495},{29053,0,5428},{29060,0,5728},
+{29065,6,1421},{29071,0,7984},{29074,0,7781},{29076,0,6187},
+{29081,0,8048},{29087,0,5635},{29090,0,5101},{29100,0,6071},
+{29105,0,5987},{29113,5,8049},{29118,0,7345},{29121,0,6000},
+{29123,0,5974},{29128,6,1423},{29134,0,4556},{29136,0,4640},
+{29138,0,5517},{29140,6,1425},{29151,0,6017},{29157,10,1427},
+{29165,6,1430},{29179,6,1432},{29182,10,1434},{29190,0,7575},
+{29200,0,4517},{29211,0,4394},{29226,0,6803},{29228,6,1437},
+{29232,0,6271},{29234,0,6295},{29237,6,1439},{29242,6,1441},
+{29245,6,1443},{29248,0,5350},{29254,10,1445},{29260,0,7508},
+{29266,0,7191},{29272,6,1448},{29275,0,6210},{29277,0,5232},
+{29279,0,4777},{29281,6,1450},{29287,0,4790},{29289,0,4850},
+{29298,0,5369},{29305,0,7472},{29309,0,3638},{29312,6,1452},
+{29346,0,4312},{29351,0,8051},{29356,0,3639},{29359,0,5015},
+{29376,0,5351},{29378,0,3847},{29380,0,6626},{29390,0,5831},
+{29392,0,7821},{29399,0,3922},{29401,0,6603},{29409,0,3879},
+{29417,0,5591},{29432,6,1454},{29436,6,1456},{29450,0,6036},
+{29462,0,7107},{29467,10,1458},{29477,0,6138},{29481,10,1461},
+{29494,5,6335},{29502,6,1464},{29508,6,1466},{29520,0,6553},
+{29522,0,6072},{29527,0,3980},{29544,0,4313},{29546,0,7941},
+{29552,0,6018},{29554,0,7949},{29557,0,4488},{29560,0,5592},
+{29562,6,1468},{29572,0,7741},{29574,6,1470},{29577,0,6081},
+{29579,0,6130},{29582,0,6734},{29588,0,7156},{29590,10,1472},
+{29599,0,4879},{29607,0,6363},{29609,0,6113},{29613,0,5233},
+{29618,6,1475},{29625,0,7742},{29632,0,4894},{29634,0,3452},
+{29641,6,1477},{29644,6,1479},{29647,0,3471},{29654,0,3848},
+{29657,0,3797},{29661,6,1481},{29664,0,6882},{29667,14,1483},
+{29673,6,1487},{29677,0,4916},{29687,0,4824},{29689,0,5483},
+{29693,6,1489},{29697,0,5429},{29699,0,3924},{29701,10,1491},
+{29705,0,4584},{29715,0,6114},{29723,0,7372},{29728,10,1494},
+{29733,6,1497},{29736,0,3781},{29738,10,1499},{29742,10,1502},
+{29747,14,1505},{29752,0,7405},{29754,0,5019},{29759,10,1509},
+{29763,6,1512},{29771,0,6296},{29781,0,7623},{29783,0,6273},
+{29785,14,1514},{29790,10,1518},{29794,0,6188},{29796,6,1521},
+{29800,10,1523},{29807,0,4417},{29822,0,4030},{29826,6,1526},
+{29831,0,5431},{29833,0,4470},{29835,0,6554},{29848,0,4641},
+{29852,0,7919},{29854,6,1528},{29857,0,6994},{29859,0,4098},
+{29861,0,3684},{29863,6,1530},{29866,0,6804},{29872,0,7894},
+{29874,0,5594},{29877,0,5939},{29881,0,5637},{29885,0,5363},
+{29887,0,5432},{29894,0,7021},{29898,0,3685},{29903,0,4540},
+{29908,0,6020},{29912,0,3827},{29914,0,7066},{29916,0,3806},
+{29920,0,7824},{29922,6,1532},{29926,0,6100},{29934,0,6092},
+{29943,0,6497},{29953,0,5051},{29956,0,3640},{29969,0,6936},
+{29973,0,6093},{29976,0,3521},{29978,6,1534},{29983,0,5370},
+{29987,0,5309},{29989,6,1536},{29992,0,6189},{29995,6,1538},
+{30000,14,1540},{30007,6,1544},{30010,0,6736},{30023,0,4011},
+{30028,0,3717},{30031,0,6139},{30033,0,6666},{30035,6,1546},
+{30041,0,4586},{30043,10,1548},{30050,0,7609},{30053,6,1551},
+{30058,0,5000},{30063,6,1553},{30069,6,1555},{30072,0,4099},
+{30074,0,3546},{30079,0,4100},{30086,6,1557},{30090,6,1559},
+{30094,6,1561},{30097,0,6403},{30109,0,5310},{30117,0,3571},
+{30123,0,5951},{30129,10,1563},{30133,0,6498},{30136,6,1566},
+{30140,10,1568},{30146,0,3453},{30149,0,5052},{30151,0,6937},
+{30157,0,6425},{30162,0,5892},{30164,6,1571},{30168,6,1573},
+{30171,0,7455},{30178,0,4627},{30192,0,4226},{30194,0,4658},
+{30196,0,7347},{30202,0,5202},{30204,0,3746},{30208,0,5906},
+{30221,0,5893},{30233,0,5521},{30239,14,1575},{30244,0,4587},
+{30246,0,5595},{30267,0,4570},{30274,0,4557},{30284,0,5826},
+{30286,0,3489},{30290,0,6339},{30294,0,5026},{30305,0,7348},
+{30308,0,6688},{30313,0,4376},{30316,0,5433},{30320,0,6094},
+{30322,0,6667},{30328,0,3718},{30331,6,1579},{30333,5,4993},
+{30340,0,6627},{30342,6,1581},{30350,0,3880},{30352,0,3747},
+{30355,0,7825},{30382,0,7600},{30394,0,7272},{30399,0,4755},
+{30402,6,1583},{30406,0,5164},{30408,0,6021},{30410,0,6438},
+{30418,0,7665},{30422,0,3573},{30427,6,1585},{30430,6,1587},
+{30433,0,6997},{30435,6,1589},{30439,0,4518},{30446,0,4791},
+{30450,0,4730},{30452,0,6975},{30456,0,5352},{30460,0,4920},
+{30462,0,5652},{30465,0,5485},{30468,0,4740},{30472,6,1591},
+{30475,0,3490},{30494,0,6998},{30496,0,4741},{30505,0,7744},
+{30519,6,1593},{30522,0,6805},{30524,0,5812},{30528,0,7057},
+{30541,0,7745},{30555,0,6737},{30561,0,5596},{30563,0,4314},
+{30566,0,4792},{30571,0,7193},{30585,0,4294},{30590,6,1595},
+{30603,0,6999},{30609,0,4756},{30622,0,4682},{30629,0,5038},
+{30636,6,1597},{30640,0,3524},{30643,0,4343},{30651,6,1599},
+{30655,0,3925},{30679,0,7244},{30683,6,1601},{30690,6,1603},
+{30693,0,6960},{30697,0,3926},{30701,10,1605},{30707,0,5413},
+{30722,0,5277},{30738,0,5203},{30757,10,1608},{30764,0,4652},
+{30770,0,7559},{30772,0,7485},{30789,0,4000},{30799,0,5976},
+{30813,0,7226},{30827,6,1611},{30831,0,5977},{30844,0,5178},
+{30849,0,4101},{30855,0,6738},{30860,10,1613},{30865,0,5204},
+{30871,0,6116},{30883,0,3504},{30887,0,5027},{30889,0,5414},
+{30906,5,7879},{30908,0,4659},{30913,0,6499},{30917,0,4956},
+{30922,6,1616},{30926,0,3719},{30928,0,4921},{30952,0,4660},
+{30956,0,3688},{30959,0,4102},{30965,0,3491},{30971,0,4922},
+{30977,0,7227},{30990,0,7228},{30998,0,5940},{31018,10,1618},
+{31034,0,5710},{31038,0,5278},{31040,6,1621},{31047,5,4104},
+{31049,0,6962},{31056,0,6214},{31062,6,1623},{31066,18,1625},
+{31072,0,5280},{31077,0,5353},{31080,0,7584},{31085,0,6769},
+{31098,0,4106},{31103,0,4529},{31105,0,4044},{31117,10,1630},
+{31121,0,6215},{31142,6,1633},{31146,0,5434},{31150,0,4508},
+{31153,0,4295},{31155,0,5894},{31161,0,6216},{31165,18,1635},
+{31177,10,1640},{31185,6,1643},{31189,0,5205},{31192,0,5206},
+{31199,0,6808},{31204,0,7377},{31206,6,1645},{31209,0,7023},
+{31227,0,6426},{31232,0,8053},{31237,0,5496},{31240,0,3492},
+{31243,0,6740},{31245,0,7230},{31252,0,6474},{31255,0,7510},
+{31257,6,1647},{31260,0,4609},{31263,6,1649},{31278,0,6845},
+{31281,0,7378},{31286,6,1651},{31291,10,1653},{31295,6,1656},
+{31302,0,4793},{31305,0,7350},{31309,6,1658},{31319,0,5598},
+{31329,6,1660},{31337,0,6086},{31339,0,7881},{31344,0,5895},
+{31348,0,7755},{31350,0,3927},{31353,6,1662},{31357,0,6741},
+{31359,0,7157},{31361,0,4330},{31364,0,7058},{31368,0,6156},
+{31378,6,1664},{31381,0,6810},{31384,0,3954},{31391,0,3962},
+{31401,5,6101},{31406,6,1666},{31418,0,4001},{31428,6,1668},
+{31431,0,4353},{31434,6,1670},{31447,0,4809},{31449,0,7089},
+{31453,0,5054},{31455,6,1672},{31459,0,6915},{31461,0,4344},
+{31466,0,5599},{31469,0,3505},{31471,0,4205},{31478,0,3690},
+{31481,6,1674},{31487,0,3493},{31503,0,7852},{31505,0,5522},
+{31513,0,5372},{31515,0,6629},{31518,0,7439},{31520,0,4654},
+{31526,0,5130},{31532,6,1676},{31545,0,5497},{31558,0,7611},
+{31561,0,4369},{31563,10,1678},{31567,14,1681},{31572,0,4236},
+{31574,0,7128},{31584,0,4012},{31596,0,5486},{31598,0,5390},
+{31605,0,5978},{31613,0,6073},{31623,0,3574},{31627,0,6669},
+{31631,0,6588},{31636,6,1685},{31639,0,5311},{31642,0,7051},
+{31645,0,3656},{31649,0,3828},{31661,0,6670},{31665,0,5354},
+{31668,0,6530},{31672,0,6606},{31680,6,1687},{31684,0,5016},
+{31686,6,1689},{31689,0,7293},{31698,0,5729},{31712,0,5523},
+{31716,0,4316},{31721,0,5282},{31751,0,6829},{31762,0,7068},
+{31774,0,4206},{31777,0,3494},{31783,0,7922},{31786,6,1691},
+{31805,10,1693},{31811,0,4404},{31820,6,1696},{31840,0,4541},
+{31844,0,7184},{31852,0,4628},{31859,0,4863},{31875,0,5207},
+{31881,0,5165},{31890,0,4655},{31893,0,4897},{31895,6,1698},
+{31903,0,5541},{31909,0,6901},{31911,0,6556},{31918,0,4433},
+{31921,10,1700},{31929,0,5600},{31934,0,6742},{31946,0,7827},
+{31958,0,4247},{31966,10,1703},{31975,0,4435},{31995,0,3721},
+{31998,0,4003},{32000,0,4108},{32002,0,6885},{32004,18,1706},
+{32010,5,4842},{32013,0,4150},{32016,0,4184},{32020,0,5655},
+{32023,18,1711},{32032,10,1716},{32043,6,1719},{32046,10,1721},
+{32051,0,5747},{32053,0,6607},{32057,6,1724},{32066,18,1726},
+{32080,0,3651},{32094,0,3882},{32097,6,1731},{32102,0,4057},
+{32104,0,6371},{32106,0,6454},{32110,0,5391},{32113,10,1733},
+{32118,0,6691},{32121,0,3641},{32127,0,3928},{32142,6,1736},
+{32147,0,3692},{32156,0,6847},{32160,0,4530},{32162,0,6887},
+{32172,6,1738},{32177,6,1740},{32180,6,1742},{32184,0,4598},
+{32186,6,1744},{32189,10,1746},{32199,0,7351},{32202,6,1749},
+{32214,0,5392},{32216,0,7658},{32218,0,5435},{32221,6,1751},
+{32224,6,1753},{32227,0,5979},{32232,6,1755},{32236,0,4743},
+{32239,0,6297},{32244,0,4471},{32251,0,7352},{32265,6,1757},
+{32277,0,6087},{32283,0,4898},{32285,10,1759},{32289,0,6581},
+{32291,0,7748},{32299,0,5103},{32302,6,1762},{32305,0,6848},
+{32311,0,4572},{32317,6,1764},{32321,0,5001},{32323,0,5179},
+{32326,6,1766},{32338,0,6938},{32340,6,1768},{32350,0,6159},
+{32353,0,5603},{32361,10,1770},{32365,0,3642},{32368,0,6814},
+{32377,0,5952},{32380,0,3723},{32386,0,7069},{32396,0,5542},
+{32399,0,6672},{32403,0,6023},{32406,0,5466},{32408,0,7071},
+{32411,6,1773},{32566,0,5132},{32568,0,7681},{32570,0,3652},
+{32588,0,5859},{32592,0,3829},{32596,6,1775},{32618,6,1777},
+{32622,0,7353},{32624,0,5007},{32626,0,5393},{32629,0,4717},
+{32631,0,7486},{32633,0,4629},{32645,0,4377},{32648,0,4110},
+{32650,0,5896},{32652,0,3551},{32654,0,4864},{32660,0,3750},
+{32666,0,4497},{32670,0,5604},{32676,0,3955},{32680,6,1779},
+{32690,0,8054},{32696,6,1781},{32701,0,6218},{32705,0,6095},
+{32709,0,5711},{32714,0,6439},{32716,0,6440},{32718,0,4498},
+{32722,0,5679},{32724,6,1783},{32735,10,1785},{32745,0,7524},
+{32747,0,6118},{32752,0,7644},{32761,0,3883},{32764,0,6441},
+{32768,6,1788},{32771,0,3751},{32773,6,1790},{32777,0,3929},
+{32780,0,6427},{32784,0,4158},{32789,0,3693},{32791,6,1792},
+{32813,0,4112},{32819,0,6428},{32822,0,5870},{32829,0,7422},
+{32831,0,3694},{32835,0,4227},{32838,0,4499},{32842,0,4559},
+{32854,0,5487},{32856,0,5239},{32858,0,7323},{32862,0,4844},
+{32879,6,1794},{32882,6,1796},{32887,0,6979},{32893,10,1798},
+{32900,14,1801},{32905,0,6357},{32907,6,1805},{32918,0,7231},
+{32923,0,7682},{32925,0,3495},{32929,6,1807},{32933,0,5210},
+{32937,6,1809},{32943,0,4061},{32945,6,1811},{32948,0,7963},
+{32954,0,7540},{32963,6,1813},{32972,0,4979},{32974,0,7440},
+{32986,6,1815},{32990,0,7560},{32993,0,7829},{32996,6,1817},
+{33009,0,3850},{33012,0,4345},{33016,0,8017},{33021,0,4185},
+{33026,0,6966},{33029,14,1819},{33034,0,7144},{33048,0,6119},
+{33050,6,1823},{33059,0,5656},{33065,0,5605},{33067,0,7419},
+{33071,0,7561},{33081,0,7110},{33086,0,5211},{33099,0,5856},
+{33102,0,5748},{33104,5,5133},{33108,6,1825},{33125,6,1827},
+{33131,0,6849},{33136,6,1829},{33144,10,1831},{33151,6,1834},
+{33160,0,3634},{33162,0,4899},{33167,0,3753},{33178,0,5135},
+{33180,6,1836},{33184,0,3884},{33187,0,7025},{33192,0,7516},
+{33203,0,5439},{33205,0,7313},{33210,0,6392},{33213,14,1838},
+{33218,0,5212},{33222,0,5916},{33229,0,6771},{33240,0,4410},
+{33247,0,6558},{33251,0,5749},{33253,0,6103},{33255,6,1842},
+{33258,0,6502},{33261,0,7325},{33267,6,1844},{33274,10,1846},
+{33278,0,6341},{33285,0,3931},{33287,6,1849},{33290,0,3932},
+{33292,6,1851},{33298,0,5395},{33307,6,1853},{33310,6,1855},
+{33313,0,3553},{33322,10,1857},{33333,10,1860},{33337,0,5440},
+{33344,0,5136},{33349,0,5942},{33351,0,6744},{33369,0,7111},
+{33380,0,6406},{33382,0,7659},{33390,6,1863},{33393,6,1865},
+{33398,0,5994},{33400,0,7232},{33406,0,5848},{33419,0,6219},
+{33421,6,1867},{33426,0,4703},{33433,6,1869},{33437,0,6968},
+{33439,0,5324},{33445,6,1871},{33449,0,4046},{33452,14,1873},
+{33457,0,7871},{33459,0,4961},{33463,10,1877},{33467,10,1880},
+{33471,0,6482},{33489,6,1883},{33492,6,1885},{33495,0,4810},
+{33499,0,3455},{33502,6,1887},{33505,0,6430},{33509,10,1889},
+{33521,0,6024},{33533,6,1892},{33537,18,1894},{33545,0,4693},
+{33559,0,4757},{33576,0,6503},{33579,0,4704},{33583,0,5083},
+{33585,0,5606},{33588,10,1899},{33592,6,1902},{33600,0,5658},
+{33607,0,7708},{33609,6,1904},{33615,0,6475},{33617,6,1906},
+{33651,0,4354},{33655,0,7624},{33659,0,6633},{33673,6,1908},
+{33678,0,5287},{33686,0,3696},{33688,0,5750},{33694,0,6121},
+{33698,0,7768},{33705,10,1910},{33725,0,4705},{33729,0,7201},
+{33733,0,3830},{33737,6,1913},{33740,0,4013},{33747,0,3808},
+{33750,0,7112},{33756,0,7122},{33769,0,5069},{33771,0,4033},
+{33775,14,1915},{33780,0,5827},{33785,0,6609},{33789,0,5639},
+{33795,6,1919},{33802,0,4423},{33804,10,1921},{33833,0,7275},
+{33836,0,4683},{33841,0,7993},{33848,0,6342},{33853,0,4386},
+{33865,0,6001},{33879,0,6610},{33883,0,3506},{33889,0,7563},
+{33891,0,4346},{33894,0,6300},{33899,6,1924},{33903,0,5875},
+{33909,0,4004},{33914,0,6930},{33936,0,5607},{33940,0,5712},
+{33945,0,4799},{33948,0,5312},{33953,0,4962},{33970,0,7564},
+{33976,0,6939},{33979,6,1926},{33983,6,1928},{33986,0,4758},
+{33988,0,7295},{33990,0,5415},{33993,0,6193},{33995,0,3576},
+{33997,0,5713},{34001,0,5288},{34010,0,5608},{34028,0,5104},
+{34030,0,4473},{34036,0,5659},{34044,0,4560},{34065,0,4747},
+{34067,6,1930},{34071,6,1932},{34074,0,6250},{34078,0,4573},
+{34081,0,7123},{34083,0,6562},{34085,0,7259},{34092,6,1934},
+{34095,0,7004},{34109,0,7541},{34111,0,6301},{34113,0,4229},
+{34115,0,5002},{34121,0,7235},{34126,0,3885},{34131,0,6245},
+{34137,0,7796},{34147,0,5660},{34152,10,1936},{34157,0,5528},
+{34180,0,4901},{34183,0,4865},{34191,0,6407},{34193,0,3554},
+{34196,0,6563},{34203,0,5457},{34214,0,7159},{34216,10,1939},
+{34223,6,1942},{34234,0,6772},{34241,0,3757},{34249,0,6505},
+{34253,10,1944},{34261,0,6220},{34268,6,1947},{34276,6,1949},
+{34281,6,1951},{34295,0,6611},{34298,6,1953},{34303,0,3817},
+{34306,0,6041},{34310,6,1955},{34314,0,6088},{34326,6,1957},
+{34330,0,5441},{34349,0,4395},{34367,0,4378},{34382,0,7833},
+{34384,0,7632},{34388,6,1959},{34395,6,1961},{34398,6,1963},
+{34407,0,8009},{34425,0,7860},{34442,0,4845},{34444,0,4963},
+{34451,0,6456},{34467,6,1965},{34473,0,7355},{34503,0,5289},
+{34507,0,4208},{34516,0,7945},{34521,0,6104},{34523,0,6889},
+{34527,0,3886},{34532,0,7666},{34541,0,7026},{34558,0,5785},
+{34560,0,7245},{34562,6,1967},{34568,0,6074},{34584,0,6970},
+{34586,0,5214},{34588,0,4884},{34638,0,3508},{34645,0,5730},
+{34647,0,7924},{34655,0,6302},{34662,0,7625},{34664,0,5676},
+{34676,0,7835},{34678,0,6703},{34680,0,6105},{34690,0,4418},
+{34701,0,6372},{34719,0,4759},{34722,0,7785},{34739,0,4248},
+{34746,0,4379},{34756,0,7376},{34784,0,4926},{34796,0,5442},
+{34799,0,6162},{34802,0,7309},{34809,0,7696},{34811,0,6408},
+{34814,0,5467},{34821,0,5690},{34847,0,4411},{34850,6,1969},
+{34865,0,3758},{34870,0,6532},{34875,0,4685},{34880,0,7756},
+{34886,0,6924},{34892,6,1971},{34898,6,1973},{34903,0,3457},
+{34905,0,5786},{34907,0,6303},{34909,0,7310},{34913,10,1975},
+{34920,0,7585},{34923,0,5326},{34928,0,5565},{34930,0,4151},
+{34935,0,7311},{34942,5,4047},{34945,6,1978},{34952,0,3458},
+{34955,0,4262},{34957,0,7565},{34962,0,4209},{34966,6,1980},
+{34974,0,3782},{34987,0,7601},{34996,0,3759},{35009,6,1982},
+{35023,0,4632},{35028,6,1984},{35033,0,3956},{35036,6,1986},
+{35039,0,5290},{35041,0,4633},{35048,0,5215},{35059,0,5356},
+{35060,5,4981},{35064,0,4380},{35069,0,6773},{35079,0,5085},
+{35088,0,3507},{35090,6,1988},{35096,6,1990},{35109,0,6172},
+{35114,0,7462},{35126,0,5680},{35128,0,4574},{35131,0,5458},
+{35137,0,3555},{35140,0,5897},{35167,0,4049},{35172,0,4407},
+{35178,0,4694},{35186,0,5681},{35199,0,5397},{35201,0,6163},
+{35203,0,4230},{35206,6,1992},{35211,0,3644},{35215,0,4005},
+{35219,0,4734},{35222,0,5714},{35233,0,3635},{35241,6,1994},
+{35250,0,4034},{35258,0,3473},{35261,0,4408},{35264,0,3831},
+{35282,0,3474},{35299,0,7697},{35316,0,5357},{35320,0,7246},
+{35328,0,5921},{35330,6,1996},{35336,0,3724},{35338,0,5754},
+{35340,0,7861},{35342,0,7452},{35347,0,7987},{35350,10,1998},
+{35355,0,6106},{35357,0,5787},{35359,0,5557},{35363,0,3653},
+{35365,0,4182},{35370,0,4964},{35373,0,5459},{35377,0,7722},
+{35380,0,5530},{35382,0,3459},{35386,6,2001},{35408,0,5291},
+{35412,6,2003},{35419,0,6612},{35422,0,5292},{35424,0,6025},
+{35426,6,2005},{35430,0,5715},{35433,0,5716},{35437,6,2007},
+{35440,14,2009},{35445,0,5443},{35449,0,7185},{35461,0,6891},
+{35463,0,3809},{35468,6,2013},{35475,0,5398},{35477,0,7417},
+{35480,0,6344},{35486,0,5908},{35488,6,2015},{35491,14,2017},
+{35496,0,7946},{35498,0,5460},{35504,0,5611},{35506,0,3810},
+{35513,0,5216},{35516,0,6410},{35518,6,2021},{35522,0,7186},
+{35524,0,5662},{35527,0,4231},{35531,0,7202},{35533,0,6589},
+{35535,0,7276},{35538,0,4437},{35542,0,4535},{35547,6,2023},
+{35553,0,5717},{35558,6,2025},{35562,6,2027},{35565,6,2029},
+{35569,0,8002},{35574,10,2031},{35578,0,5922},{35582,0,4139},
+{35584,10,2034},{35588,0,4371},{35598,0,4866},{35600,0,4885},
+{35604,0,7633},{35606,6,2037},{35609,10,2039},{35613,0,5293},
+{35616,0,6164},{35624,0,4786},{35627,6,2042},{35635,0,3935},
+{35641,0,4035},{35649,0,7874},{35657,0,6940},{35662,6,2044},
+{35672,0,5731},{35674,0,4232},{35676,0,5072},{35686,0,3697},
+{35692,0,5217},{35695,6,2046},{35700,0,3645},{35703,0,7836},
+{35709,0,6044},{35712,0,4318},{35722,0,5033},{35728,0,5612},
+{35730,6,2048},{35734,0,7091},{35738,0,7072},{35895,0,3772},
+{35903,0,3726},{35905,0,7902},{35910,0,4355},{35912,0,4116},
+{35914,0,7594},{35916,0,6122},{35925,0,5718},{35930,0,4327},
+{35937,0,5359},{35946,6,2050},{35961,6,2052},{35970,0,7236},
+{35978,0,4723},{35980,0,4787},{35997,6,2054},{36000,10,2056},
+{36007,22,2059},{36015,6,2065},{36019,6,2067},{36022,10,2069},
+{36027,10,2072},{36031,22,2075},{36039,6,2081},{36042,0,6635},
+{36049,0,7007},{36051,0,5235},{36058,0,4548},{36060,0,5294},
+{36062,0,5360},{36064,0,4984},{36066,10,2083},{36070,0,5141},
+{36074,0,7027},{36077,0,4299},{36084,0,4549},{36091,10,2086},
+{36100,6,2089},{36103,6,2091},{36106,0,7073},{36109,0,5468},
+{36115,0,6566},{36118,0,5544},{36196,0,6636},{36198,0,5295},
+{36203,0,7732},{36208,0,6892},{36211,6,2093},{36215,0,4117},
+{36229,0,7237},{36234,0,6282},{36249,0,6820},{36259,0,7326},
+{36264,0,7277},{36275,0,6830},{36282,0,5144},{36286,0,6973},
+{36294,0,7442},{36299,6,2095},{36303,0,3461},{36315,0,7488},
+{36317,0,3596},{36321,0,6637},{36323,0,5444},{36328,0,3811},
+{36335,0,4522},{36339,0,4300},{36362,0,6194},{36367,6,2097},
+{36382,0,3597},{36394,0,6850},{36400,0,6347},{36405,0,6851},
+{36418,0,6348},{36420,0,6775},{36423,14,2099},{36441,0,7296},
+{36447,6,2103},{36468,0,7297},{36470,0,3982},{36481,0,6821},
+{36487,0,6614},{36490,0,6893},{36493,0,5878},{36522,10,2105},
+{36544,0,3937},{36554,14,2108},{36562,0,7726},{36575,0,5982},
+{36587,0,7008},{36600,0,7298},{36603,0,3462},{36606,0,5732},
+{36611,0,3887},{36613,0,4523},{36617,0,6584},{36626,14,2112},
+{36635,18,2116},{36646,6,2121},{36649,6,2123},{36655,0,7035},
+{36659,0,6894},{36664,6,2125},{36667,0,5088},{36670,6,2127},
+{36676,6,2129},{36681,0,6675},{36685,6,2131},{36701,0,5945},
+{36703,0,3867},{36706,0,4463},{36763,6,2133},{36771,0,4398},
+{36774,0,7496},{36776,0,5034},{36781,0,5296},{36783,14,2135},
+{36802,0,6222},{36805,0,5757},{36814,0,6026},{36817,0,4036},
+{36820,0,4927},{36838,0,3463},{36842,6,2139},{36845,0,7029},
+{36848,0,5669},{36850,0,3626},{36855,0,4867},{36857,0,6640},
+{36861,0,7278},{36864,14,2141},{36869,6,2145},{36872,0,7787},
+{36875,0,7567},{36877,0,5531},{36879,10,2147},{36884,6,2150},
+{36887,0,4356},{36889,6,2152},{36893,26,2154},{36910,0,7211},
+{36913,6,2161},{36917,0,4007},{36920,0,6466},{36924,0,7615},
+{36926,0,6350},{36929,6,2163},{36935,0,6223},{36938,6,2165},
+{36941,6,2167},{36944,6,2169},{36947,10,2171},{36953,0,6165},
+{36956,10,2174},{36960,6,2177},{36963,0,3646},{36969,0,6641},
+{36973,10,2179},{36978,0,6974},{36981,0,6918},{36983,6,2182},
+{36986,0,6351},{36988,6,2184},{36991,22,2186},{36999,6,2192},
+{37002,0,5036},{37007,0,4381},{37009,0,6389},{37013,0,6096},
+{37017,0,4707},{37026,6,2194},{37030,0,4966},{37032,0,7250},
+{37034,0,5297},{37039,10,2196},{37045,0,5533},{37048,0,6616},
+{37057,0,6236},{37066,0,3889},{37086,0,4419},{37089,0,3958},
+{37096,0,5145},{37101,0,3818},{37109,0,6224},{37117,0,4305},
+{37122,0,5802},{37138,0,7279},{37141,0,7714},{37145,0,5219},
+{37159,0,4372},{37165,0,6748},{37170,0,4210},{37193,22,2199},
+{37202,0,6897},{37218,0,7238},{37225,6,2205},{37228,0,5616},
+{37237,0,7964},{37239,6,2207},{37255,0,5663},{37257,0,7327},
+{37259,0,7239},{37261,0,6776},{37266,0,5491},{37276,0,7281},
+{37291,6,2209},{37294,6,2211},{37297,0,4937},{37300,6,2213},
+{37312,0,5899},{37319,0,7124},{37321,0,6353},{37323,26,2215},
+{37335,6,2222},{37340,6,2224},{37347,0,6824},{37351,0,7163},
+{37354,0,6225},{37365,0,7125},{37389,0,4363},{37392,10,2226},
+{37399,0,6366},{37406,0,4014},{37428,0,4501},{37434,0,6082},
+{37439,6,2229},{37445,0,3599},{37449,0,7752},{37463,0,3658},
+{37467,0,5983},{37470,0,6283},{37474,0,4938},{37476,10,2231},
+{37504,0,6378},{37507,0,7260},{37509,0,4347},{37521,0,5446},
+{37523,0,6677},{37526,0,5617},{37528,0,4761},{37532,0,7660},
+{37555,0,6046},{37558,6,2234},{37561,0,5618},{37580,0,6752},
+{37583,0,7769},{37586,0,5107},{37604,0,5400},{37610,0,7568},
+{37624,0,3600},{37628,0,3557},{37636,0,4532},{37648,0,7282},
+{37656,0,7283},{37658,0,6590},{37662,18,2236},{37668,0,4119},
+{37670,0,4050},{37672,0,4811},{37675,0,5417},{37678,6,2241},
+{37704,0,6027},{37706,6,2243},{37709,0,4306},{37716,0,5803},
+{37723,0,4211},{37742,0,6354},{37749,0,3611},{37756,0,7375},
+{37758,0,6852},{37772,0,3659},{37780,0,6195},{37782,0,5564},
+{37786,0,7284},{37795,0,7789},{37799,0,3577},{37804,6,2245},
+{37808,0,6467},{37827,0,6831},{37841,0,6642},{37854,0,6196},
+{37857,0,3700},{37860,0,4575},{37878,0,7036},{37892,0,7952},
+{37912,0,6853},{37925,0,5447},{37931,0,6679},{37941,0,7176},
+{37944,0,7407},{37956,0,6898},{37969,5,3527},{37979,0,3851},
+{38013,0,7074},{38015,0,7060},{38263,0,6568},{38272,0,4846},
+{38275,0,5469},{38281,0,7542},{38283,0,3578},{38287,0,6367},
+{38289,5,7645},{38291,6,2247},{38296,0,3535},{38307,10,2249},
+{38312,0,4008},{38317,0,4453},{38321,0,5988},{38331,6,2252},
+{38343,0,5828},{38346,0,7903},{38356,10,2254},{38364,0,3833},
+{38369,6,2257},{38428,0,5147},{38433,0,7165},{38442,0,7498},
+{38446,0,6123},{38450,0,4967},{38459,0,6825},{38463,6,2259},
+{38466,0,7603},{38468,0,5148},{38475,10,2261},{38480,0,7647},
+{38491,18,2264},{38498,10,2269},{38506,0,4987},{38512,0,6384},
+{38515,0,7013},{38517,14,2272},{38525,0,5900},{38533,6,2276},
+{38538,6,2278},{38541,6,2280},{38548,6,2282},{38552,6,2284},
+{38555,6,2286},{38563,0,4644},{38567,5,5620},{38570,0,7728},
+{38577,0,6379},{38583,0,4510},{38587,0,7147},{38592,6,2288},
+{38596,14,2290},{38601,0,7357},{38603,14,2294},{38613,6,2298},
+{38617,0,5773},{38619,6,2300},{38626,6,2302},{38632,5,6227},
+{38634,0,5461},{38639,6,2304},{38642,0,6248},{38646,6,2306},
+{38649,0,4903},{38651,0,6680},{38656,0,5623},{38662,6,2308},
+{38673,0,6698},{38675,0,6047},{38678,0,4651},{38681,0,6028},
+{38684,0,5361},{38686,0,7628},{38695,0,4832},{38704,0,5314},
+{38706,0,4524},{38713,0,5030},{38717,0,6779},{38722,0,4464},
+{38724,0,5850},{38728,0,4503},{38737,0,7203},{38742,0,6755},
+{38748,0,6756},{38750,0,5220},{38753,6,2310},{38761,0,7733},
+{38765,0,6458},{38772,0,7876},{38775,0,6459},{38778,0,4695},
+{38795,0,7799},{38797,0,5814},{38799,0,3801},{38816,0,3950},
+{38824,0,3509},{38827,0,3951},{38829,0,7526},{38854,0,7166},
+{38859,0,6307},{38867,0,7648},{38876,0,4308},{38899,0,6385},
+{38902,0,5535},{38907,0,6249},{38911,18,2312},{38917,6,2317},
+{38920,0,5624},{38922,0,6237},{38924,0,5560},{38928,14,2319},
+{38935,6,2323},{38957,0,4357},{38960,0,7770},{38968,6,2325},
+{38971,0,5236},{38982,0,3814},{38988,10,2327},{38996,0,5815},
+{39000,0,6279},{39002,0,6681},{39006,0,4590},{39013,0,7840},
+{39015,0,3764},{39019,0,6682},{39023,0,7753},{39080,0,7595},
+{39087,0,5330},{39089,0,7444},{39108,0,7588},{39111,0,7587},
+{39131,6,2330},{39135,0,5733},{39137,6,2332},{39149,10,2334},
+{39156,0,6435},{39164,10,2337},{39171,0,3890},{39177,6,2340},
+{39180,0,6436},{39184,0,7075},{39187,0,5790},{39192,0,5946},
+{39198,0,6683},{39200,0,5056},{39208,0,3834},{39237,0,4687},
+{39241,0,4037},{39243,10,2342},{39249,6,2345},{39252,0,6098},
+{39255,0,7717},{39318,0,5625},{39321,0,7718},{39325,0,7613},
+{39333,0,5089},{39336,0,7790},{39340,10,2347},{39345,0,7392},
+{39347,6,2350},{39353,0,6468},{39361,0,4904},{39376,10,2352},
+{39381,0,3464},{39385,0,5149},{39389,0,7393},{39391,0,5299},
+{39405,0,7701},{39409,0,4388},{39423,0,6920},{39425,0,5240},
+{39432,0,5057},{39438,5,4122},{39449,0,7527},{39467,0,3612},
+{39472,0,4373},{39478,6,2355},{39488,0,4725},{39491,0,7589},
+{39493,0,3943},{39501,0,7965},{39509,0,3891},{39511,0,7729},
+{39514,6,2357},{39519,0,7328},{39522,0,4454},{39525,0,4124},
+{39529,6,2359},{39592,0,3785},{39608,0,7702},{39635,6,2361},
+{39640,0,3765},{39653,0,5997},{39662,0,4939},{39706,0,5627},
+{39719,0,4562},{39722,0,7470},{39729,0,6251},{39740,0,3993},
+{39745,18,2363},{39759,0,6308},{39764,0,4662},{39770,0,5910},
+{39791,0,4525},{39822,0,6699},{39825,0,7570},{39839,0,5816},
+{39851,0,3892},{39854,0,5449},{39881,0,4637},{39894,0,7204},
+{39908,0,3783},{39912,0,3704},{39949,0,7287},{39952,0,5805},
+{39954,0,5090},{39957,0,7629},{39973,0,7898},{39986,0,6076},
+{39995,0,4688},{40007,0,3559},{40009,0,5039},{40023,0,4645},
+{40165,0,6827},{40167,0,5150},{40169,0,3944},{40179,6,2368},
+{40182,0,5984},{40201,0,5791},{40219,0,6280},{40230,0,5839},
+{40232,0,5832},{40251,0,7862},{40273,0,3647},{40285,0,5792},
+{40288,6,2370},{40300,0,5180},{40306,0,6521},{40361,0,4794},
+{40367,0,5860},{40372,0,7634},{40388,0,3728},{40407,0,3945},
+{40434,0,7329},{40440,10,2372},{40474,0,5861},{40478,0,4396},
+{40565,0,4527},{40569,0,7662},{40573,0,5998},{40575,0,4533},
+{40594,6,2375},{40599,0,4456},{40605,0,5300},{40607,0,4646},
+{40613,0,4726},{40628,6,2377},{40635,0,4663},{40638,0,8004},
+{40643,0,7927},{40653,6,2379},{40657,0,8018},{40660,0,3623},
+{40664,0,4835},{40667,6,2381},{40670,0,6700},{40680,0,4249},
+{40692,0,4869},{40711,6,2383},{40718,0,6758},{40723,0,3766},
+{40736,0,5402},{40763,0,5222},{40778,6,2385},{40782,0,6586},
+{40786,0,7359},{40799,0,6618},{40801,0,4505},{40807,0,5462},
+{40810,0,7061},{40812,0,5911},{40823,0,5806},{40845,0,4563},
+{40848,0,4968},{40853,0,3529},{40860,0,3946},{44032,5,1086},
+{44034,5,9333},{44036,0,1088},{44037,5,9335},{44039,13,1089},
+{44043,17,9337},{44048,29,1093},{44056,0,9342},{44057,17,1101},
+{44062,5,9343},{44064,0,1106},{44065,9,9345},{44068,0,1107},
+{44069,25,9348},{44076,5,1108},{44078,0,9355},{44079,9,1110},
+{44082,21,9356},{44088,5,1113},{44090,5,9362},{44092,0,1115},
+{44093,9,9364},{44096,0,1116},{44097,37,9367},{44107,10,2387},
+{44110,21,9378},{44116,0,1119},{44117,9,9384},{44120,0,1120},
+{44121,9,9387},{44124,0,1121},{44125,73,9390},{44144,5,1122},
+{44146,5,9409},{44148,0,1124},{44149,5,9411},{44151,5,1125},
+{44153,6,2390},{44155,17,9414},{44160,5,1128},{44162,0,9419},
+{44163,13,1130},{44167,5,9420},{44169,13,1134},{44173,9,9422},
+{44176,0,1138},{44177,9,9425},{44180,0,1139},{44181,25,9428},
+{44188,5,1140},{44190,0,9435},{44191,9,1142},{44194,21,9436},
+{44200,9,1145},{44203,6,2392},{44205,5,9443},{44207,5,1149},
+{44209,25,9445},{44216,5,1151},{44218,0,9452},{44219,9,1153},
+{44222,9,9453},{44225,0,1156},{44226,5,9456},{44228,0,1157},
+{44229,9,9458},{44232,0,1158},{44233,9,9461},{44236,0,1159},
+{44237,29,9464},{44245,10,2394},{44248,29,9473},{44256,5,1162},
+{44258,5,9481},{44260,0,1164},{44261,5,9483},{44263,5,1165},
+{44265,14,2397},{44269,5,9487},{44271,9,1169},{44274,10,2401},
+{44277,5,1173},{44279,17,9491},{44284,5,1175},{44286,5,9496},
+{44288,0,1177},{44289,9,9498},{44292,10,2404},{44295,17,9502},
+{44300,5,1180},{44302,14,2407},{44306,21,9509},{44312,0,1184},
+{44313,9,9515},{44316,0,1185},{44317,9,9518},{44320,0,1186},
+{44321,29,9521},{44329,0,1187},{44330,5,9529},{44332,5,1188},
+{44334,21,9531},{44340,5,1190},{44342,5,9537},{44344,0,1192},
+{44345,9,9539},{44348,0,1193},{44349,25,9542},{44356,5,1194},
+{44358,14,2411},{44362,21,9551},{44368,0,1198},{44369,9,9557},
+{44372,0,1199},{44373,9,9560},{44376,0,1200},{44377,29,9563},
+{44385,10,2415},{44388,29,9572},{44396,5,1203},{44398,5,9580},
+{44400,0,1205},{44401,5,9582},{44403,13,1206},{44407,13,9584},
+{44411,9,1210},{44414,10,2418},{44417,5,1214},{44419,17,9590},
+{44424,5,1216},{44426,5,9595},{44428,0,1218},{44429,9,9597},
+{44432,0,1219},{44433,41,9600},{44444,5,1220},{44446,21,9611},
+{44452,0,1222},{44453,69,9617},{44471,0,1223},{44472,29,9635},
+{44480,5,1224},{44482,5,9643},{44484,0,1226},{44485,9,9645},
+{44488,0,1227},{44489,25,9648},{44496,5,1228},{44498,6,2421},
+{44500,29,9656},{44508,0,1231},{44509,9,9664},{44512,0,1232},
+{44513,9,9667},{44516,0,1233},{44517,73,9670},{44536,5,1234},
+{44538,5,9689},{44540,0,1236},{44541,5,9691},{44543,9,1237},
+{44546,21,9693},{44552,5,1240},{44554,14,2423},{44558,21,9701},
+{44564,0,1244},{44565,105,9707},{44592,5,1245},{44594,5,9734},
+{44596,0,1247},{44597,5,9736},{44599,5,1248},{44601,6,2427},
+{44603,17,9739},{44608,5,1251},{44610,10,2429},{44613,5,1254},
+{44615,9,9746},{44618,6,2432},{44620,9,1257},{44623,6,2434},
+{44625,9,9751},{44628,10,2436},{44631,17,9755},{44636,5,1263},
+{44638,0,9760},{44639,9,1265},{44642,9,9761},{44645,0,1268},
+{44646,5,9764},{44648,5,1269},{44650,5,9766},{44652,0,1271},
+{44653,9,9768},{44656,0,1272},{44657,25,9771},{44664,5,1273},
+{44666,0,9778},{44667,9,1275},{44670,21,9779},{44676,5,1278},
+{44678,21,9785},{44684,0,1280},{44685,185,9791},{44732,9,1281},
+{44735,6,2439},{44737,9,9839},{44740,0,1285},{44741,25,9842},
+{44748,5,1286},{44750,0,9849},{44751,9,1288},{44754,21,9850},
+{44760,5,1291},{44762,5,9856},{44764,0,1293},{44765,41,9858},
+{44776,0,1294},{44777,5,9869},{44779,10,2441},{44782,21,9872},
+{44788,0,1297},{44789,9,9878},{44792,0,1298},{44793,9,9881},
+{44796,0,1299},{44797,37,9884},{44807,5,1300},{44809,13,9894},
+{44813,0,1302},{44814,5,9898},{44816,0,1303},{44817,105,9900},
+{44844,5,1304},{44846,5,9927},{44848,18,2444},{44853,25,9931},
+{44860,5,1309},{44862,10,2449},{44865,9,1312},{44868,13,9940},
+{44872,5,1315},{44874,21,9944},{44880,0,1317},{44881,41,9950},
+{44892,5,1318},{44894,21,9961},{44900,5,1320},{44902,73,9967},
+{44921,0,1322},{44922,21,9986},{44928,0,1323},{44929,9,9992},
+{44932,0,1324},{44933,9,9995},{44936,0,1325},{44937,25,9998},
+{44944,5,1326},{44946,9,10005},{44949,0,1328},{44950,21,10008},
+{44956,0,1329},{44957,105,10014},{44984,5,1330},{44986,5,10041},
+{44988,0,1332},{44989,9,10043},{44992,0,1333},{44993,21,10046},
+{44999,9,1334},{45002,10,2452},{45005,5,1338},{45007,17,10054},
+{45012,0,1340},{45013,25,10059},{45020,0,1341},{45021,41,10066},
+{45032,5,1342},{45034,21,10077},{45040,5,1344},{45042,5,10083},
+{45044,0,1346},{45045,9,10085},{45048,0,1347},{45049,25,10088},
+{45056,5,1348},{45058,5,10095},{45060,0,1350},{45061,25,10097},
+{45068,0,1351},{45069,9,10104},{45072,0,1352},{45073,9,10107},
+{45076,0,1353},{45077,25,10110},{45084,5,1354},{45086,37,10117},
+{45096,0,1356},{45097,105,10127},{45124,5,1357},{45126,5,10154},
+{45128,26,2455},{45135,13,10159},{45139,9,1363},{45142,14,2462},
+{45146,9,10165},{45149,0,1368},{45150,117,10168},{45180,5,1369},
+{45182,5,10198},{45184,0,1371},{45185,9,10200},{45188,0,1372},
+{45189,25,10203},{45196,5,1373},{45198,14,2466},{45202,21,10212},
+{45208,9,1377},{45211,6,2470},{45213,5,10219},{45215,13,1381},
+{45219,17,10221},{45224,5,1385},{45226,0,10226},{45227,17,1387},
+{45232,10,2472},{45235,9,1393},{45238,5,10229},{45240,0,1396},
+{45241,9,10231},{45244,0,1397},{45245,25,10234},{45252,5,1398},
+{45254,0,10241},{45255,9,1400},{45258,21,10242},{45264,5,1403},
+{45266,5,10248},{45268,0,1405},{45269,9,10250},{45272,0,1406},
+{45273,25,10253},{45280,0,1407},{45281,13,10260},{45285,0,1408},
+{45286,133,10264},{45320,5,1409},{45322,0,10298},{45323,5,1411},
+{45325,9,10299},{45328,6,2475},{45330,5,1414},{45332,13,10303},
+{45336,5,1416},{45338,0,10307},{45339,9,1418},{45342,17,10308},
+{45347,9,1421},{45350,5,10313},{45352,0,1424},{45353,9,10315},
+{45356,0,1425},{45357,25,10318},{45364,5,1426},{45366,0,10325},
+{45367,9,1428},{45370,21,10326},{45376,5,1431},{45378,5,10332},
+{45380,0,1433},{45381,9,10334},{45384,0,1434},{45385,25,10337},
+{45392,5,1435},{45394,5,10344},{45396,5,1437},{45398,5,10346},
+{45400,0,1439},{45401,9,10348},{45404,0,1440},{45405,9,10351},
+{45408,0,1441},{45409,89,10354},{45432,5,1442},{45434,5,10377},
+{45436,0,1444},{45437,9,10379},{45440,10,2477},{45443,17,10383},
+{45448,5,1447},{45450,14,2480},{45454,13,10390},{45458,9,1451},
+{45461,9,10394},{45464,0,1454},{45465,9,10397},{45468,0,1455},
+{45469,41,10400},{45480,0,1456},{45481,137,10411},{45516,0,1457},
+{45517,9,10446},{45520,0,1458},{45521,9,10449},{45524,0,1459},
+{45525,25,10452},{45532,5,1460},{45534,6,2484},{45536,29,10460},
+{45544,5,1463},{45546,5,10468},{45548,0,1465},{45549,9,10470},
+{45552,0,1466},{45553,29,10473},{45561,18,2486},{45566,21,10483},
+{45572,5,1470},{45574,5,10489},{45576,0,1472},{45577,5,10491},
+{45579,5,1473},{45581,25,10493},{45588,5,1475},{45590,14,2491},
+{45594,21,10502},{45600,0,1479},{45601,73,10508},{45620,0,1480},
+{45621,25,10527},{45628,0,1481},{45629,105,10534},{45656,0,1482},
+{45657,9,10561},{45660,0,1483},{45661,9,10564},{45664,0,1484},
+{45665,25,10567},{45672,5,1485},{45674,37,10574},{45684,5,1487},
+{45686,21,10584},{45692,0,1489},{45693,25,10590},{45700,5,1490},
+{45702,9,10597},{45705,0,1492},{45706,21,10600},{45712,5,1493},
+{45714,5,10606},{45716,0,1495},{45717,9,10608},{45720,9,1496},
+{45723,17,10611},{45728,5,1499},{45730,10,2495},{45733,5,1502},
+{45735,9,10618},{45738,10,2498},{45741,9,10622},{45744,0,1506},
+{45745,9,10625},{45748,0,1507},{45749,73,10628},{45768,5,1508},
+{45770,5,10647},{45772,0,1510},{45773,9,10649},{45776,10,2501},
+{45779,17,10653},{45784,5,1513},{45786,14,2504},{45790,13,10660},
+{45794,6,2508},{45796,9,1518},{45799,6,2510},{45801,5,10666},
+{45803,17,1522},{45808,9,10668},{45811,9,1527},{45814,0,10671},
+{45815,17,1530},{45820,9,10672},{45823,9,1535},{45826,5,10675},
+{45828,0,1538},{45829,9,10677},{45832,0,1539},{45833,25,10680},
+{45840,5,1540},{45842,0,10687},{45843,9,1542},{45846,21,10688},
+{45852,0,1545},{45853,217,10694},{45908,9,1546},{45911,6,2512},
+{45913,5,10750},{45915,5,1550},{45917,0,10752},{45918,5,1552},
+{45920,13,10753},{45924,5,1554},{45926,22,2514},{45932,5,10760},
+{45934,6,2520},{45936,5,1560},{45938,5,10763},{45940,0,1562},
+{45941,9,10765},{45944,0,1563},{45945,25,10768},{45952,5,1564},
+{45954,0,10775},{45955,9,1566},{45958,21,10776},{45964,0,1569},
+{45965,9,10782},{45968,0,1570},{45969,9,10785},{45972,0,1571},
+{45973,41,10788},{45984,5,1572},{45986,21,10799},{45992,0,1574},
+{45993,9,10805},{45996,0,1575},{45997,89,10808},{46020,5,1576},
+{46022,5,10831},{46024,0,1578},{46025,5,10833},{46027,5,1579},
+{46029,14,2522},{46033,9,10837},{46036,5,1583},{46038,30,2526},
+{46046,5,10844},{46048,0,1589},{46049,9,10846},{46052,0,1590},
+{46053,9,10849},{46056,0,1591},{46057,73,10852},{46076,0,1592},
+{46077,73,10871},{46096,0,1593},{46097,25,10890},{46104,0,1594},
+{46105,9,10897},{46108,0,1595},{46109,9,10900},{46112,0,1596},
+{46113,25,10903},{46120,5,1597},{46122,6,2534},{46124,29,10911},
+{46132,0,1600},{46133,105,10919},{46160,5,1601},{46162,5,10946},
+{46164,0,1603},{46165,9,10948},{46168,0,1604},{46169,25,10951},
+{46176,5,1605},{46178,14,2536},{46182,21,10960},{46188,0,1609},
+{46189,73,10966},{46208,0,1610},{46209,25,10985},{46216,0,1611},
+{46217,77,10992},{46237,0,1612},{46238,21,11012},{46244,0,1613},
+{46245,9,11018},{46248,0,1614},{46249,9,11021},{46252,0,1615},
+{46253,29,11024},{46261,18,2540},{46266,21,11034},{46272,0,1619},
+{46273,9,11040},{46276,0,1620},{46277,9,11043},{46280,0,1621},
+{46281,25,11046},{46288,0,1622},{46289,13,11053},{46293,0,1623},
+{46294,21,11057},{46300,5,1624},{46302,5,11063},{46304,0,1626},
+{46305,5,11065},{46307,5,1627},{46309,6,2545},{46311,17,11068},
+{46316,5,1630},{46318,14,2547},{46322,21,11075},{46328,0,1634},
+{46329,105,11081},{46356,5,1635},{46358,5,11108},{46360,0,1637},
+{46361,5,11110},{46363,5,1638},{46365,25,11112},{46372,5,1640},
+{46374,0,11119},{46375,13,1642},{46379,17,11120},{46384,5,1646},
+{46386,5,11125},{46388,0,1648},{46389,9,11127},{46392,0,1649},
+{46393,25,11130},{46400,5,1650},{46402,0,11137},{46403,9,1652},
+{46406,17,11138},{46411,9,1655},{46414,5,11143},{46416,0,1658},
+{46417,9,11145},{46420,0,1659},{46421,25,11148},{46428,5,1660},
+{46430,0,11155},{46431,9,1662},{46434,245,11156},{46496,5,1665},
+{46498,5,11218},{46500,0,1667},{46501,9,11220},{46504,6,2551},
+{46506,5,1669},{46508,13,11224},{46512,5,1671},{46514,0,11228},
+{46515,9,1673},{46518,17,11229},{46523,9,1676},{46526,5,11234},
+{46528,0,1679},{46529,9,11236},{46532,0,1680},{46533,25,11239},
+{46540,5,1681},{46542,0,11246},{46543,9,1683},{46546,21,11247},
+{46552,0,1686},{46553,73,11253},{46572,0,1687},{46573,137,11272},
+{46608,5,1688},{46610,5,11307},{46612,0,1690},{46613,9,11309},
+{46616,0,1691},{46617,45,11312},{46629,0,1692},{46630,21,11324},
+{46636,0,1693},{46637,25,11330},{46644,0,1694},{46645,73,11337},
+{46664,0,1695},{46665,105,11356},{46692,0,1696},{46693,9,11383},
+{46696,0,1697},{46697,201,11386},{46748,5,1698},{46750,5,11437},
+{46752,0,1700},{46753,9,11439},{46756,0,1701},{46757,21,11442},
+{46763,5,1702},{46765,13,11448},{46769,0,1704},{46770,133,11452},
+{46804,0,1705},{46805,105,11486},{46832,0,1706},{46833,9,11513},
+{46836,0,1707},{46837,9,11516},{46840,0,1708},{46841,25,11519},
+{46848,5,1709},{46850,9,11526},{46853,0,1711},{46854,133,11529},
+{46888,5,1712},{46890,5,11563},{46892,0,1714},{46893,5,11565},
+{46895,5,1715},{46897,25,11567},{46904,5,1717},{46906,6,2553},
+{46908,29,11575},{46916,0,1720},{46917,9,11583},{46920,0,1721},
+{46921,9,11586},{46924,0,1722},{46925,25,11589},{46932,5,1723},
+{46934,37,11596},{46944,0,1725},{46945,9,11606},{46948,0,1726},
+{46949,9,11609},{46952,0,1727},{46953,25,11612},{46960,5,1728},
+{46962,14,2555},{46966,21,11621},{46972,5,1732},{46974,5,11627},
+{46976,0,1734},{46977,9,11629},{46980,0,1735},{46981,25,11632},
+{46988,5,1736},{46990,0,11639},{46991,13,1738},{46995,9,11640},
+{46998,13,1742},{47002,5,11643},{47004,0,1746},{47005,9,11645},
+{47008,0,1747},{47009,25,11648},{47016,5,1748},{47018,0,11655},
+{47019,9,1750},{47022,21,11656},{47028,5,1753},{47030,5,11662},
+{47032,0,1755},{47033,53,11664},{47047,10,2559},{47050,133,11679},
+{47084,5,1758},{47086,5,11713},{47088,0,1760},{47089,9,11715},
+{47092,0,1761},{47093,25,11718},{47100,5,1762},{47102,6,2562},
+{47104,5,1765},{47106,17,11726},{47111,9,1767},{47114,5,11731},
+{47116,0,1770},{47117,9,11733},{47120,0,1771},{47121,25,11736},
+{47128,5,1772},{47130,14,2564},{47134,21,11745},{47140,5,1776},
+{47142,5,11751},{47144,0,1778},{47145,9,11753},{47148,0,1779},
+{47149,25,11756},{47156,5,1780},{47158,0,11763},{47159,9,1782},
+{47162,21,11764},{47168,0,1785},{47169,9,11770},{47172,0,1786},
+{47173,45,11773},{47185,10,2568},{47188,29,11786},{47196,5,1789},
+{47198,5,11794},{47200,0,1791},{47201,9,11796},{47204,0,1792},
+{47205,25,11799},{47212,5,1793},{47214,14,2571},{47218,21,11808},
+{47224,0,1797},{47225,9,11814},{47228,0,1798},{47229,61,11817},
+{47245,0,1799},{47246,101,11833},{47272,0,1800},{47273,25,11859},
+{47280,0,1801},{47281,9,11866},{47284,0,1802},{47285,9,11869},
+{47288,0,1803},{47289,25,11872},{47296,5,1804},{47298,14,2575},
+{47302,21,11881},{47308,0,1808},{47309,9,11887},{47312,0,1809},
+{47313,9,11890},{47316,0,1810},{47317,29,11893},{47325,18,2579},
+{47330,21,11903},{47336,5,1814},{47338,5,11909},{47340,0,1816},
+{47341,9,11911},{47344,0,1817},{47345,25,11914},{47352,5,1818},
+{47354,14,2584},{47358,21,11923},{47364,0,1822},{47365,73,11929},
+{47384,0,1823},{47385,25,11948},{47392,0,1824},{47393,105,11955},
+{47420,5,1825},{47422,5,11982},{47424,0,1827},{47425,9,11984},
+{47428,0,1828},{47429,25,11987},{47436,0,1829},{47437,5,11994},
+{47439,10,2588},{47442,21,11997},{47448,5,1832},{47450,5,12003},
+{47452,0,1834},{47453,9,12005},{47456,0,1835},{47457,25,12008},
+{47464,5,1836},{47466,14,2591},{47470,21,12017},{47476,5,1840},
+{47478,5,12023},{47480,0,1842},{47481,9,12025},{47484,0,1843},
+{47485,25,12028},{47492,5,1844},{47494,10,2595},{47497,5,1847},
+{47499,5,12037},{47501,5,1849},{47503,113,12039},{47532,5,1851},
+{47534,5,12068},{47536,0,1853},{47537,9,12070},{47540,0,1854},
+{47541,25,12073},{47548,5,1855},{47550,14,2598},{47554,21,12082},
+{47560,5,1859},{47562,5,12088},{47564,6,2602},{47566,17,1862},
+{47571,17,12091},{47576,5,1867},{47578,10,2604},{47581,5,1870},
+{47583,5,12098},{47585,6,2607},{47587,9,1873},{47590,5,12101},
+{47592,0,1876},{47593,9,12103},{47596,0,1877},{47597,25,12106},
+{47604,5,1878},{47606,0,12113},{47607,13,1880},{47611,17,12114},
+{47616,5,1884},{47618,21,12119},{47624,0,1886},{47625,45,12125},
+{47637,0,1887},{47638,133,12137},{47672,5,1888},{47674,5,12171},
+{47676,0,1890},{47677,9,12173},{47680,10,2609},{47683,17,12177},
+{47688,5,1893},{47690,10,2612},{47693,5,1896},{47695,13,12184},
+{47699,9,1898},{47702,5,12188},{47704,0,1901},{47705,9,12190},
+{47708,0,1902},{47709,25,12193},{47716,5,1903},{47718,0,12200},
+{47719,9,1905},{47722,21,12201},{47728,5,1908},{47730,5,12207},
+{47732,0,1910},{47733,9,12209},{47736,0,1911},{47737,37,12212},
+{47747,9,1912},{47750,6,2615},{47752,13,12223},{47756,0,1916},
+{47757,105,12227},{47784,5,1917},{47786,0,12254},{47787,5,1919},
+{47789,9,12255},{47792,10,2617},{47795,17,12259},{47800,5,1923},
+{47802,14,2620},{47806,21,12266},{47812,0,1927},{47813,9,12272},
+{47816,0,1928},{47817,57,12275},{47832,5,1929},{47834,133,12290},
+{47868,0,1931},{47869,9,12324},{47872,0,1932},{47873,9,12327},
+{47876,0,1933},{47877,29,12330},{47885,18,2624},{47890,21,12340},
+{47896,0,1937},{47897,9,12346},{47900,0,1938},{47901,9,12349},
+{47904,0,1939},{47905,29,12352},{47913,10,2629},{47916,29,12361},
+{47924,9,1942},{47927,6,2632},{47929,5,12370},{47931,13,1946},
+{47935,17,12372},{47940,5,1950},{47942,14,2634},{47946,9,12379},
+{47949,6,2638},{47951,5,1955},{47953,9,12383},{47956,0,1957},
+{47957,9,12386},{47960,0,1958},{47961,29,12389},{47969,10,2640},
+{47972,29,12398},{47980,0,1961},{47981,105,12406},{48008,0,1962},
+{48009,9,12433},{48012,0,1963},{48013,9,12436},{48016,0,1964},
+{48017,73,12439},{48036,0,1965},{48037,9,12458},{48040,0,1966},
+{48041,9,12461},{48044,0,1967},{48045,25,12464},{48052,0,1968},
+{48053,5,12471},{48055,0,1969},{48056,29,12473},{48064,0,1970},
+{48065,9,12481},{48068,0,1971},{48069,9,12484},{48072,0,1972},
+{48073,25,12487},{48080,0,1973},{48081,5,12494},{48083,0,1974},
+{48084,141,12496},{48120,5,1975},{48122,5,12532},{48124,0,1977},
+{48125,5,12534},{48127,5,1978},{48129,6,2643},{48131,17,12537},
+{48136,5,1981},{48138,0,12542},{48139,9,1983},{48142,14,2645},
+{48146,5,12545},{48148,17,1988},{48153,5,12547},{48155,17,1993},
+{48160,13,12549},{48164,5,1998},{48166,14,2649},{48170,9,12555},
+{48173,0,2002},{48174,5,12558},{48176,5,2003},{48178,5,12560},
+{48180,0,2005},{48181,9,12562},{48184,0,2006},{48185,25,12565},
+{48192,5,2007},{48194,0,12572},{48195,9,2009},{48198,9,12573},
+{48201,0,2012},{48202,5,12576},{48204,5,2013},{48206,5,12578},
+{48208,0,2015},{48209,45,12580},{48221,0,2016},{48222,149,12592},
+{48260,5,2017},{48262,5,12630},{48264,0,2019},{48265,5,12632},
+{48267,5,2020},{48269,6,2653},{48271,17,12635},{48276,5,2023},
+{48278,10,2655},{48281,5,2026},{48283,17,12642},{48288,5,2028},
+{48290,5,12647},{48292,0,2030},{48293,5,12649},{48295,5,2031},
+{48297,25,12651},{48304,5,2033},{48306,0,12658},{48307,9,2035},
+{48310,21,12659},{48316,5,2038},{48318,5,12665},{48320,0,2040},
+{48321,9,12667},{48324,0,2041},{48325,29,12670},{48333,6,2658},
+{48335,9,2043},{48338,9,12679},{48341,0,2046},{48342,5,12682},
+{48344,0,2047},{48345,9,12684},{48348,0,2048},{48349,89,12687},
+{48372,9,2049},{48375,6,2660},{48377,9,12711},{48380,0,2053},
+{48381,25,12714},{48388,5,2054},{48390,14,2662},{48394,21,12723},
+{48400,0,2058},{48401,9,12729},{48404,0,2059},{48405,57,12732},
+{48420,0,2060},{48421,25,12747},{48428,0,2061},{48429,73,12754},
+{48448,0,2062},{48449,25,12773},{48456,5,2063},{48458,5,12780},
+{48460,0,2065},{48461,9,12782},{48464,0,2066},{48465,25,12785},
+{48472,5,2067},{48474,37,12792},{48484,0,2069},{48485,9,12802},
+{48488,0,2070},{48489,89,12805},{48512,5,2071},{48514,5,12828},
+{48516,0,2073},{48517,5,12830},{48519,13,2074},{48523,17,12832},
+{48528,5,2078},{48530,14,2666},{48534,9,12839},{48537,5,2082},
+{48539,6,2670},{48541,25,12843},{48548,0,2085},{48549,41,12850},
+{48560,0,2086},{48561,25,12861},{48568,0,2087},{48569,105,12868},
+{48596,5,2088},{48598,5,12895},{48600,0,2090},{48601,9,12897},
+{48604,0,2091},{48605,45,12900},{48617,0,2092},{48618,21,12912},
+{48624,0,2093},{48625,9,12918},{48628,0,2094},{48629,9,12921},
+{48632,0,2095},{48633,25,12924},{48640,0,2096},{48641,5,12931},
+{48643,10,2672},{48646,21,12934},{48652,5,2099},{48654,5,12940},
+{48656,0,2101},{48657,9,12942},{48660,0,2102},{48661,25,12945},
+{48668,5,2103},{48670,6,2675},{48672,141,12953},{48708,5,2106},
+{48710,5,12989},{48712,0,2108},{48713,9,12991},{48716,10,2677},
+{48719,17,12995},{48724,5,2111},{48726,10,2680},{48729,9,2114},
+{48732,13,13002},{48736,5,2117},{48738,5,13006},{48740,0,2119},
+{48741,9,13008},{48744,10,2683},{48747,17,13012},{48752,5,2122},
+{48754,0,13017},{48755,9,2124},{48758,17,13018},{48763,9,2127},
+{48766,5,13023},{48768,0,2130},{48769,9,13025},{48772,0,2131},
+{48773,25,13028},{48780,5,2132},{48782,0,13035},{48783,9,2134},
+{48786,21,13036},{48792,5,2137},{48794,53,13042},{48808,0,2139},
+{48809,153,13056},{48848,5,2140},{48850,5,13095},{48852,0,2142},
+{48853,5,13097},{48855,5,2143},{48857,25,13099},{48864,0,2145},
+{48865,5,13106},{48867,9,2146},{48870,21,13108},{48876,0,2149},
+{48877,77,13114},{48897,0,2150},{48898,21,13134},{48904,5,2151},
+{48906,53,13140},{48920,5,2153},{48922,0,13154},{48923,9,2155},
+{48926,133,13155},{48960,5,2158},{48962,5,13189},{48964,0,2160},
+{48965,9,13191},{48968,0,2161},{48969,25,13194},{48976,5,2162},
+{48978,9,13201},{48981,0,2164},{48982,245,13204},{49044,0,2165},
+{49045,105,13266},{49072,0,2166},{49073,77,13293},{49093,0,2167},
+{49094,21,13313},{49100,5,2168},{49102,5,13319},{49104,0,2170},
+{49105,9,13321},{49108,0,2171},{49109,25,13324},{49116,0,2172},
+{49117,5,13331},{49119,10,2686},{49122,357,13334},{49212,0,2175},
+{49213,77,13424},{49233,0,2176},{49234,21,13444},{49240,0,2177},
+{49241,9,13450},{49244,0,2178},{49245,9,13453},{49248,0,2179},
+{49249,25,13456},{49256,5,2180},{49258,149,13463},{49296,5,2182},
+{49298,5,13501},{49300,0,2184},{49301,9,13503},{49304,0,2185},
+{49305,25,13506},{49312,5,2186},{49314,14,2689},{49318,21,13515},
+{49324,5,2190},{49326,0,13521},{49327,5,2192},{49329,5,13522},
+{49331,13,2194},{49335,17,13524},{49340,5,2198},{49342,0,13529},
+{49343,9,2200},{49346,9,13530},{49349,0,2203},{49350,5,13533},
+{49352,5,2204},{49354,5,13535},{49356,0,2206},{49357,9,13537},
+{49360,0,2207},{49361,25,13540},{49368,5,2208},{49370,0,13547},
+{49371,9,2210},{49374,21,13548},{49380,5,2213},{49382,5,13554},
+{49384,0,2215},{49385,9,13556},{49388,0,2216},{49389,25,13559},
+{49396,5,2217},{49398,14,2693},{49402,21,13568},{49408,0,2221},
+{49409,9,13574},{49412,0,2222},{49413,9,13577},{49416,0,2223},
+{49417,25,13580},{49424,0,2224},{49425,13,13587},{49429,0,2225},
+{49430,21,13591},{49436,17,2226},{49441,5,13597},{49443,5,2231},
+{49445,0,13599},{49446,5,2233},{49448,13,13600},{49452,5,2235},
+{49454,0,13604},{49455,9,2237},{49458,13,13605},{49462,6,2697},
+{49464,5,2241},{49466,5,13610},{49468,0,2243},{49469,9,13612},
+{49472,0,2244},{49473,25,13615},{49480,5,2245},{49482,0,13622},
+{49483,9,2247},{49486,21,13623},{49492,5,2250},{49494,5,13629},
+{49496,0,2252},{49497,9,13631},{49500,0,2253},{49501,25,13634},
+{49508,5,2254},{49510,0,13641},{49511,9,2256},{49514,21,13642},
+{49520,0,2259},{49521,9,13648},{49524,0,2260},{49525,9,13651},
+{49528,0,2261},{49529,45,13654},{49541,0,2262},{49542,21,13666},
+{49548,9,2263},{49551,6,2699},{49553,9,13673},{49556,10,2701},
+{49559,17,13677},{49564,5,2269},{49566,14,2704},{49570,9,13684},
+{49573,0,2273},{49574,5,13687},{49576,5,2274},{49578,5,13689},
+{49580,0,2276},{49581,9,13691},{49584,0,2277},{49585,45,13694},
+{49597,0,2278},{49598,21,13706},{49604,0,2279},{49605,9,13712},
+{49608,0,2280},{49609,9,13715},{49612,0,2281},{49613,25,13718},
+{49620,0,2282},{49621,5,13725},{49623,5,2283},{49625,25,13727},
+{49632,0,2285},{49633,9,13734},{49636,0,2286},{49637,9,13737},
+{49640,0,2287},{49641,25,13740},{49648,5,2288},{49650,6,2708},
+{49652,29,13748},{49660,5,2291},{49662,5,13756},{49664,0,2293},
+{49665,9,13758},{49668,0,2294},{49669,25,13761},{49676,5,2295},
+{49678,14,2710},{49682,21,13770},{49688,5,2299},{49690,5,13776},
+{49692,0,2301},{49693,5,13778},{49695,5,2302},{49697,25,13780},
+{49704,5,2304},{49706,26,2714},{49713,5,2309},{49715,6,2721},
+{49717,73,13792},{49736,0,2312},{49737,25,13811},{49744,5,2313},
+{49746,5,13818},{49748,0,2315},{49749,9,13820},{49752,0,2316},
+{49753,25,13823},{49760,0,2317},{49761,13,13830},{49765,0,2318},
+{49766,21,13834},{49772,5,2319},{49774,5,13840},{49776,0,2321},
+{49777,9,13842},{49780,0,2322},{49781,25,13845},{49788,5,2323},
+{49790,14,2723},{49794,21,13854},{49800,5,2327},{49802,21,13860},
+{49808,0,2329},{49809,25,13866},{49816,0,2330},{49817,5,13873},
+{49819,10,2727},{49822,21,13876},{49828,5,2333},{49830,5,13882},
+{49832,0,2335},{49833,9,13884},{49836,5,2336},{49838,21,13887},
+{49844,5,2338},{49846,14,2730},{49850,133,13895},{49884,5,2342},
+{49886,5,13929},{49888,0,2344},{49889,5,13931},{49891,5,2345},
+{49893,21,13933},{49899,9,2347},{49902,14,2734},{49906,13,13941},
+{49910,6,2738},{49912,5,2353},{49914,0,13946},{49915,5,2355},
+{49917,9,13947},{49920,0,2357},{49921,25,13950},{49928,5,2358},
+{49930,5,13957},{49932,5,2360},{49934,17,13959},{49939,9,2362},
+{49942,5,13964},{49944,0,2365},{49945,9,13966},{49948,0,2366},
+{49949,25,13969},{49956,5,2367},{49958,5,13976},{49960,5,2369},
+{49962,105,13978},{49989,0,2371},{49990,133,14005},{50024,5,2372},
+{50026,5,14039},{50028,0,2374},{50029,9,14041},{50032,10,2740},
+{50035,17,14045},{50040,5,2377},{50042,5,14050},{50044,5,2379},
+{50046,21,14052},{50052,0,2381},{50053,9,14058},{50056,0,2382},
+{50057,9,14061},{50060,0,2383},{50061,201,14064},{50112,0,2384},
+{50113,89,14115},{50136,5,2385},{50138,5,14138},{50140,0,2387},
+{50141,5,14140},{50143,5,2388},{50145,6,2743},{50147,17,14143},
+{50152,5,2391},{50154,9,14148},{50157,0,2393},{50158,21,14151},
+{50164,5,2394},{50166,5,14157},{50168,0,2396},{50169,57,14159},
+{50184,0,2397},{50185,25,14174},{50192,0,2398},{50193,73,14181},
+{50212,0,2399},{50213,25,14200},{50220,0,2400},{50221,9,14207},
+{50224,0,2401},{50225,9,14210},{50228,0,2402},{50229,25,14213},
+{50236,5,2403},{50238,37,14220},{50248,0,2405},{50249,105,14230},
+{50276,5,2406},{50278,5,14257},{50280,0,2408},{50281,9,14259},
+{50284,0,2409},{50285,25,14262},{50292,5,2410},{50294,9,14269},
+{50297,0,2412},{50298,21,14272},{50304,0,2413},{50305,73,14278},
+{50324,0,2414},{50325,25,14297},{50332,0,2415},{50333,105,14304},
+{50360,0,2416},{50361,9,14331},{50364,0,2417},{50365,173,14334},
+{50409,0,2418},{50410,21,14378},{50416,5,2419},{50418,5,14384},
+{50420,0,2421},{50421,9,14386},{50424,10,2745},{50427,13,14390},
+{50431,9,2424},{50434,37,14394},{50444,0,2427},{50445,9,14404},
+{50448,0,2428},{50449,9,14407},{50452,0,2429},{50453,25,14410},
+{50460,0,2430},{50461,41,14417},{50472,5,2431},{50474,5,14428},
+{50476,0,2433},{50477,9,14430},{50480,0,2434},{50481,25,14433},
+{50488,5,2435},{50490,14,2748},{50494,21,14442},{50500,5,2439},
+{50502,5,14448},{50504,9,2441},{50507,0,14450},{50508,9,2444},
+{50511,13,14451},{50515,9,2447},{50518,0,14455},{50519,9,2450},
+{50522,9,14456},{50525,5,2453},{50527,0,14459},{50528,5,2455},
+{50530,5,14460},{50532,0,2457},{50533,9,14462},{50536,0,2458},
+{50537,25,14465},{50544,5,2459},{50546,0,14472},{50547,9,2461},
+{50550,21,14473},{50556,5,2464},{50558,5,14479},{50560,0,2466},
+{50561,9,14481},{50564,0,2467},{50565,5,14484},{50567,0,2468},
+{50568,13,14486},{50572,5,2469},{50574,14,2752},{50578,9,14492},
+{50581,6,2756},{50583,5,2474},{50585,9,14496},{50588,0,2476},
+{50589,9,14499},{50592,0,2477},{50593,29,14502},{50601,0,2478},
+{50602,37,14510},{50612,5,2479},{50614,5,14520},{50616,5,2481},
+{50618,0,14522},{50619,13,2483},{50623,17,14523},{50628,25,2487},
+{50635,18,2758},{50640,5,2496},{50642,5,14531},{50644,0,2498},
+{50645,9,14533},{50648,0,2499},{50649,25,14536},{50656,5,2500},
+{50658,14,2763},{50662,21,14545},{50668,9,2504},{50671,6,2767},
+{50673,9,14552},{50676,6,2769},{50678,5,2509},{50680,13,14556},
+{50684,21,2511},{50690,9,14560},{50693,13,2517},{50697,9,14563},
+{50700,0,2521},{50701,9,14566},{50704,0,2522},{50705,25,14569},
+{50712,5,2523},{50714,0,14576},{50715,5,2525},{50717,25,14577},
+{50724,5,2527},{50726,5,14584},{50728,0,2529},{50729,9,14586},
+{50732,9,2530},{50735,6,2771},{50737,5,14590},{50739,9,2534},
+{50742,22,2773},{50748,13,14595},{50752,5,2540},{50754,5,14599},
+{50756,0,2542},{50757,9,14601},{50760,0,2543},{50761,25,14604},
+{50768,5,2544},{50770,0,14611},{50771,9,2546},{50774,21,14612},
+{50780,5,2549},{50782,5,14618},{50784,0,2551},{50785,41,14620},
+{50796,0,2552},{50797,5,14631},{50799,10,2779},{50802,21,14634},
+{50808,5,2555},{50810,5,14640},{50812,0,2557},{50813,9,14642},
+{50816,0,2558},{50817,25,14645},{50824,5,2559},{50826,14,2782},
+{50830,21,14654},{50836,5,2563},{50838,5,14660},{50840,0,2565},
+{50841,9,14662},{50844,0,2566},{50845,25,14665},{50852,5,2567},
+{50854,14,2786},{50858,21,14674},{50864,5,2571},{50866,5,14680},
+{50868,0,2573},{50869,9,14682},{50872,9,2574},{50875,17,14685},
+{50880,5,2577},{50882,14,2790},{50886,21,14692},{50892,5,2581},
+{50894,5,14698},{50896,0,2583},{50897,9,14700},{50900,0,2584},
+{50901,25,14703},{50908,5,2585},{50910,5,14710},{50912,5,2587},
+{50914,21,14712},{50920,5,2589},{50922,5,14718},{50924,0,2591},
+{50925,9,14720},{50928,0,2592},{50929,25,14723},{50936,5,2593},
+{50938,9,14730},{50941,0,2595},{50942,21,14733},{50948,5,2596},
+{50950,5,14739},{50952,0,2598},{50953,9,14741},{50956,0,2599},
+{50957,25,14744},{50964,5,2600},{50966,14,2794},{50970,21,14753},
+{50976,5,2604},{50978,5,14759},{50980,0,2606},{50981,9,14761},
+{50984,0,2607},{50985,25,14764},{50992,5,2608},{50994,22,2798},
+{51000,13,14774},{51004,5,2613},{51006,5,14778},{51008,0,2615},
+{51009,9,14780},{51012,0,2616},{51013,17,14783},{51018,6,2804},
+{51020,5,2618},{51022,10,2806},{51025,29,2621},{51033,9,14791},
+{51036,0,2629},{51037,9,14794},{51040,0,2630},{51041,25,14797},
+{51048,0,2631},{51049,5,14804},{51051,0,2632},{51052,29,14806},
+{51060,5,2633},{51062,5,14814},{51064,0,2635},{51065,9,14816},
+{51068,9,2636},{51071,13,14819},{51075,9,2639},{51078,0,14823},
+{51079,13,2642},{51083,9,14824},{51086,6,2809},{51088,5,2647},
+{51090,5,14828},{51092,6,2811},{51094,9,2650},{51097,6,2813},
+{51099,17,14832},{51104,5,2654},{51106,0,14837},{51107,13,2656},
+{51111,17,14838},{51116,5,2660},{51118,5,14843},{51120,0,2662},
+{51121,9,14845},{51124,0,2663},{51125,25,14848},{51132,5,2664},
+{51134,0,14855},{51135,9,2666},{51138,21,14856},{51144,5,2669},
+{51146,5,14862},{51148,18,2815},{51153,25,14866},{51160,0,2674},
+{51161,13,14873},{51165,0,2675},{51166,21,14877},{51172,0,2676},
+{51173,9,14883},{51176,0,2677},{51177,9,14886},{51180,0,2678},
+{51181,73,14889},{51200,5,2679},{51202,5,14908},{51204,0,2681},
+{51205,9,14910},{51208,10,2820},{51211,17,14914},{51216,5,2684},
+{51218,10,2823},{51221,5,2687},{51223,17,14921},{51228,5,2689},
+{51230,5,14926},{51232,0,2691},{51233,9,14928},{51236,0,2692},
+{51237,25,14931},{51244,5,2693},{51246,14,2826},{51250,21,14940},
+{51256,0,2697},{51257,9,14946},{51260,0,2698},{51261,9,14949},
+{51264,0,2699},{51265,25,14952},{51272,5,2700},{51274,5,14959},
+{51276,5,2702},{51278,21,14961},{51284,0,2704},{51285,105,14967},
+{51312,5,2705},{51314,5,14994},{51316,0,2707},{51317,9,14996},
+{51320,10,2830},{51323,17,15000},{51328,5,2710},{51330,10,2833},
+{51333,9,2713},{51336,9,15007},{51339,9,2716},{51342,21,15010},
+{51348,0,2719},{51349,29,15016},{51357,18,2836},{51362,21,15026},
+{51368,0,2723},{51369,73,15032},{51388,5,2724},{51390,21,15051},
+{51396,0,2726},{51397,9,15057},{51400,0,2727},{51401,9,15060},
+{51404,0,2728},{51405,25,15063},{51412,5,2729},{51414,14,2841},
+{51418,21,15072},{51424,5,2733},{51426,5,15078},{51428,0,2735},
+{51429,61,15080},{51445,0,2736},{51446,21,15096},{51452,5,2737},
+{51454,5,15102},{51456,0,2739},{51457,9,15104},{51460,9,2740},
+{51463,17,15107},{51468,5,2743},{51470,14,2845},{51474,21,15114},
+{51480,0,2747},{51481,73,15120},{51500,0,2748},{51501,25,15139},
+{51508,0,2749},{51509,105,15146},{51536,5,2750},{51538,5,15173},
+{51540,0,2752},{51541,9,15175},{51544,0,2753},{51545,25,15178},
+{51552,5,2754},{51554,6,2849},{51556,29,15186},{51564,0,2757},
+{51565,9,15194},{51568,0,2758},{51569,9,15197},{51572,0,2759},
+{51573,25,15200},{51580,0,2760},{51581,41,15207},{51592,5,2761},
+{51594,5,15218},{51596,0,2763},{51597,9,15220},{51600,0,2764},
+{51601,25,15223},{51608,5,2765},{51610,14,2851},{51614,133,15232},
+{51648,5,2769},{51650,5,15266},{51652,0,2771},{51653,5,15268},
+{51655,5,2772},{51657,6,2855},{51659,17,15271},{51664,5,2775},
+{51666,10,2857},{51669,5,2778},{51671,5,15278},{51673,5,2780},
+{51675,0,15280},{51676,5,2782},{51678,5,15281},{51680,18,2860},
+{51685,5,15285},{51687,0,2787},{51688,13,15287},{51692,5,2788},
+{51694,0,15291},{51695,9,2790},{51698,21,15292},{51704,5,2793},
+{51706,5,15298},{51708,0,2795},{51709,9,15300},{51712,0,2796},
+{51713,25,15303},{51720,5,2797},{51722,0,15310},{51723,9,2799},
+{51726,21,15311},{51732,0,2802},{51733,9,15317},{51736,0,2803},
+{51737,61,15320},{51753,0,2804},{51754,133,15336},{51788,5,2805},
+{51790,5,15370},{51792,0,2807},{51793,9,15372},{51796,0,2808},
+{51797,25,15375},{51804,5,2809},{51806,0,15382},{51807,9,2811},
+{51810,21,15383},{51816,0,2814},{51817,77,15389},{51837,0,2815},
+{51838,21,15409},{51844,0,2816},{51845,73,15415},{51864,0,2817},
+{51865,137,15434},{51900,5,2818},{51902,5,15469},{51904,0,2820},
+{51905,9,15471},{51908,0,2821},{51909,25,15474},{51916,5,2822},
+{51918,22,2865},{51924,13,15484},{51928,5,2827},{51930,21,15488},
+{51936,0,2829},{51937,41,15494},{51948,0,2830},{51949,25,15505},
+{51956,0,2831},{51957,73,15512},{51976,0,2832},{51977,25,15531},
+{51984,0,2833},{51985,9,15538},{51988,0,2834},{51989,9,15541},
+{51992,0,2835},{51993,25,15544},{52000,5,2836},{52002,121,15551},
+{52033,0,2838},{52034,21,15582},{52040,5,2839},{52042,5,15588},
+{52044,0,2841},{52045,9,15590},{52048,0,2842},{52049,25,15593},
+{52056,5,2843},{52058,9,15600},{52061,0,2845},{52062,21,15603},
+{52068,0,2846},{52069,73,15609},{52088,5,2847},{52090,133,15628},
+{52124,0,2849},{52125,105,15662},{52152,0,2850},{52153,105,15689},
+{52180,0,2851},{52181,57,15716},{52196,0,2852},{52197,5,15731},
+{52199,10,2871},{52202,133,15734},{52236,5,2855},{52238,5,15768},
+{52240,0,2857},{52241,9,15770},{52244,0,2858},{52245,25,15773},
+{52252,5,2859},{52254,9,15780},{52257,5,2861},{52259,13,15783},
+{52263,9,2863},{52266,5,15787},{52268,18,2874},{52273,25,15791},
+{52280,5,2869},{52282,0,15798},{52283,13,2871},{52287,17,15799},
+{52292,5,2875},{52294,5,15804},{52296,0,2877},{52297,9,15806},
+{52300,0,2878},{52301,25,15809},{52308,5,2879},{52310,0,15816},
+{52311,9,2881},{52314,21,15817},{52320,0,2884},{52321,9,15823},
+{52324,18,2879},{52329,25,15828},{52336,0,2888},{52337,13,15835},
+{52341,0,2889},{52342,133,15839},{52376,5,2890},{52378,5,15873},
+{52380,0,2892},{52381,9,15875},{52384,0,2893},{52385,25,15878},
+{52392,5,2894},{52394,0,15885},{52395,9,2896},{52398,21,15886},
+{52404,5,2899},{52406,5,15892},{52408,0,2901},{52409,9,15894},
+{52412,0,2902},{52413,25,15897},{52420,5,2903},{52422,14,2884},
+{52426,21,15906},{52432,0,2907},{52433,9,15912},{52436,0,2908},
+{52437,57,15915},{52452,0,2909},{52453,25,15930},{52460,0,2910},
+{52461,9,15937},{52464,0,2911},{52465,61,15940},{52481,0,2912},
+{52482,21,15956},{52488,5,2913},{52490,5,15962},{52492,0,2915},
+{52493,9,15964},{52496,0,2916},{52497,25,15967},{52504,5,2917},
+{52506,14,2888},{52510,21,15976},{52516,0,2921},{52517,9,15982},
+{52520,0,2922},{52521,9,15985},{52524,0,2923},{52525,45,15988},
+{52537,0,2924},{52538,133,16000},{52572,0,2925},{52573,9,16034},
+{52576,0,2926},{52577,9,16037},{52580,0,2927},{52581,25,16040},
+{52588,5,2928},{52590,14,2892},{52594,21,16049},{52600,0,2932},
+{52601,57,16055},{52616,0,2933},{52617,41,16070},{52628,5,2934},
+{52630,5,16081},{52632,0,2936},{52633,9,16083},{52636,0,2937},
+{52637,25,16086},{52644,5,2938},{52646,14,2896},{52650,21,16095},
+{52656,0,2942},{52657,73,16101},{52676,0,2943},{52677,25,16120},
+{52684,0,2944},{52685,9,16127},{52688,0,2945},{52689,89,16130},
+{52712,0,2946},{52713,9,16153},{52716,0,2947},{52717,9,16156},
+{52720,0,2948},{52721,25,16159},{52728,5,2949},{52730,14,2900},
+{52734,21,16168},{52740,0,2953},{52741,9,16174},{52744,0,2954},
+{52745,9,16177},{52748,0,2955},{52749,25,16180},{52756,0,2956},
+{52757,13,16187},{52761,0,2957},{52762,21,16191},{52768,5,2958},
+{52770,5,16197},{52772,0,2960},{52773,9,16199},{52776,0,2961},
+{52777,25,16202},{52784,5,2962},{52786,14,2904},{52790,133,16211},
+{52824,5,2966},{52826,5,16245},{52828,0,2968},{52829,5,16247},
+{52831,9,2969},{52834,21,16249},{52840,5,2972},{52842,14,2908},
+{52846,21,16257},{52852,5,2976},{52854,5,16263},{52856,0,2978},
+{52857,9,16265},{52860,0,2979},{52861,25,16268},{52868,5,2980},
+{52870,14,2912},{52874,21,16277},{52880,5,2984},{52882,5,16283},
+{52884,0,2986},{52885,9,16285},{52888,0,2987},{52889,25,16288},
+{52896,5,2988},{52898,0,16295},{52899,9,2990},{52902,21,16296},
+{52908,5,2993},{52910,73,16302},{52929,0,2995},{52930,133,16321},
+{52964,5,2996},{52966,5,16355},{52968,0,2998},{52969,5,16357},
+{52971,5,2999},{52973,25,16359},{52980,5,3001},{52982,0,16366},
+{52983,9,3003},{52986,21,16367},{52992,5,3006},{52994,5,16373},
+{52996,0,3008},{52997,9,16375},{53000,0,3009},{53001,25,16378},
+{53008,5,3010},{53010,14,2916},{53014,21,16387},{53020,0,3014},
+{53021,9,16393},{53024,0,3015},{53025,9,16396},{53028,0,3016},
+{53029,25,16399},{53036,5,3017},{53038,0,16406},{53039,9,3019},
+{53042,21,16407},{53048,0,3022},{53049,105,16413},{53076,5,3023},
+{53078,5,16440},{53080,0,3025},{53081,9,16442},{53084,0,3026},
+{53085,25,16445},{53092,5,3027},{53094,14,2920},{53098,21,16454},
+{53104,5,3031},{53106,5,16460},{53108,0,3033},{53109,9,16462},
+{53112,0,3034},{53113,25,16465},{53120,0,3035},{53121,13,16472},
+{53125,0,3036},{53126,21,16476},{53132,0,3037},{53133,77,16482},
+{53153,0,3038},{53154,21,16502},{53160,0,3039},{53161,25,16508},
+{53168,0,3040},{53169,73,16515},{53188,0,3041},{53189,105,16534},
+{53216,5,3042},{53218,5,16561},{53220,0,3044},{53221,9,16563},
+{53224,0,3045},{53225,25,16566},{53232,5,3046},{53234,14,2924},
+{53238,21,16575},{53244,0,3050},{53245,9,16581},{53248,0,3051},
+{53249,9,16584},{53252,0,3052},{53253,45,16587},{53265,0,3053},
+{53266,21,16599},{53272,0,3054},{53273,77,16605},{53293,0,3055},
+{53294,21,16625},{53300,5,3056},{53302,5,16631},{53304,0,3058},
+{53305,9,16633},{53308,0,3059},{53309,25,16636},{53316,5,3060},
+{53318,14,2928},{53322,21,16645},{53328,0,3064},{53329,9,16651},
+{53332,0,3065},{53333,9,16654},{53336,0,3066},{53337,25,16657},
+{53344,0,3067},{53345,41,16664},{53356,5,3068},{53358,5,16675},
+{53360,0,3070},{53361,9,16677},{53364,0,3071},{53365,25,16680},
+{53372,5,3072},{53374,9,16687},{53377,0,3074},{53378,133,16690},
+{53412,5,3075},{53414,5,16724},{53416,0,3077},{53417,9,16726},
+{53420,0,3078},{53421,25,16729},{53428,5,3079},{53430,14,2932},
+{53434,21,16738},{53440,5,3083},{53442,5,16744},{53444,0,3085},
+{53445,9,16746},{53448,5,3086},{53450,21,16749},{53456,5,3088},
+{53458,0,16755},{53459,9,3090},{53462,21,16756},{53468,5,3093},
+{53470,5,16762},{53472,0,3095},{53473,9,16764},{53476,0,3096},
+{53477,25,16767},{53484,5,3097},{53486,0,16774},{53487,9,3099},
+{53490,21,16775},{53496,0,3102},{53497,77,16781},{53517,0,3103},
+{53518,133,16801},{53552,5,3104},{53554,5,16835},{53556,0,3106},
+{53557,9,16837},{53560,10,2936},{53563,17,16841},{53568,5,3109},
+{53570,0,16846},{53571,9,3111},{53574,21,16847},{53580,5,3114},
+{53582,5,16853},{53584,0,3116},{53585,9,16855},{53588,0,3117},
+{53589,25,16858},{53596,5,3118},{53598,14,2939},{53602,21,16867},
+{53608,0,3122},{53609,9,16873},{53612,0,3123},{53613,57,16876},
+{53628,0,3124},{53629,25,16891},{53636,0,3125},{53637,9,16898},
+{53640,0,3126},{53641,89,16901},{53664,5,3127},{53666,5,16924},
+{53668,0,3129},{53669,9,16926},{53672,0,3130},{53673,25,16929},
+{53680,5,3131},{53682,14,2943},{53686,13,16938},{53690,10,2947},
+{53693,9,16943},{53696,0,3137},{53697,89,16946},{53720,0,3138},
+{53721,105,16969},{53748,0,3139},{53749,9,16996},{53752,0,3140},
+{53753,53,16999},{53767,10,2950},{53770,21,17014},{53776,0,3143},
+{53777,105,17020},{53804,5,3144},{53806,5,17047},{53808,0,3146},
+{53809,9,17049},{53812,0,3147},{53813,25,17052},{53820,5,3148},
+{53822,14,2953},{53826,21,17061},{53832,0,3152},{53833,73,17067},
+{53852,0,3153},{53853,25,17086},{53860,0,3154},{53861,105,17093},
+{53888,5,3155},{53890,5,17120},{53892,0,3157},{53893,9,17122},
+{53896,0,3158},{53897,25,17125},{53904,5,3159},{53906,9,17132},
+{53909,0,3161},{53910,21,17135},{53916,0,3162},{53917,9,17141},
+{53920,0,3163},{53921,9,17144},{53924,0,3164},{53925,25,17147},
+{53932,0,3165},{53933,13,17154},{53937,0,3166},{53938,21,17158},
+{53944,5,3167},{53946,5,17164},{53948,0,3169},{53949,5,17166},
+{53951,5,3170},{53953,6,2957},{53955,17,17169},{53960,5,3173},
+{53962,6,2959},{53964,29,17175},{53972,0,3176},{53973,9,17183},
+{53976,0,3177},{53977,9,17186},{53980,0,3178},{53981,25,17189},
+{53988,5,3179},{53990,37,17196},{54000,5,3181},{54002,5,17206},
+{54004,0,3183},{54005,9,17208},{54008,0,3184},{54009,25,17211},
+{54016,5,3185},{54018,14,2961},{54022,21,17220},{54028,9,3189},
+{54031,6,2965},{54033,9,17227},{54036,10,2967},{54039,17,17231},
+{54044,5,3195},{54046,0,17236},{54047,9,3197},{54050,9,17237},
+{54053,0,3200},{54054,5,17240},{54056,5,3201},{54058,5,17242},
+{54060,0,3203},{54061,9,17244},{54064,0,3204},{54065,25,17247},
+{54072,5,3205},{54074,0,17254},{54075,9,3207},{54078,21,17255},
+{54084,5,3210},{54086,213,17261},{54140,5,3212},{54142,5,17315},
+{54144,0,3214},{54145,9,17317},{54148,0,3215},{54149,25,17320},
+{54156,5,3216},{54158,0,17327},{54159,9,3218},{54162,21,17328},
+{54168,5,3221},{54170,5,17334},{54172,0,3223},{54173,9,17336},
+{54176,0,3224},{54177,25,17339},{54184,5,3225},{54186,14,2970},
+{54190,21,17348},{54196,0,3229},{54197,9,17354},{54200,0,3230},
+{54201,9,17357},{54204,0,3231},{54205,25,17360},{54212,5,3232},
+{54214,5,17367},{54216,5,3234},{54218,21,17369},{54224,0,3236},
+{54225,25,17375},{54232,0,3237},{54233,29,17382},{54241,10,2974},
+{54244,29,17391},{54252,5,3240},{54254,5,17399},{54256,0,3242},
+{54257,9,17401},{54260,0,3243},{54261,25,17404},{54268,5,3244},
+{54270,14,2977},{54274,21,17413},{54280,0,3248},{54281,77,17419},
+{54301,0,3249},{54302,133,17439},{54336,0,3250},{54337,9,17473},
+{54340,0,3251},{54341,89,17476},{54364,0,3252},{54365,9,17499},
+{54368,0,3253},{54369,9,17502},{54372,0,3254},{54373,29,17505},
+{54381,10,2981},{54384,29,17514},{54392,5,3257},{54394,5,17522},
+{54396,0,3259},{54397,5,17524},{54399,5,3260},{54401,6,2984},
+{54403,17,17527},{54408,5,3263},{54410,14,2986},{54414,21,17534},
+{54420,0,3267},{54421,77,17540},{54441,0,3268},{54442,133,17560},
+{54476,0,3269},{54477,9,17594},{54480,0,3270},{54481,9,17597},
+{54484,0,3271},{54485,25,17600},{54492,0,3272},{54493,5,17607},
+{54495,0,3273},{54496,29,17609},{54504,0,3274},{54505,9,17617},
+{54508,0,3275},{54509,9,17620},{54512,0,3276},{54513,25,17623},
+{54520,0,3277},{54521,5,17630},{54523,10,2990},{54526,21,17633},
+{54532,0,3280},{54533,9,17639},{54536,0,3281},{54537,9,17642},
+{54540,0,3282},{54541,25,17645},{54548,5,3283},{54550,6,2993},
+{54552,141,17653},{54588,5,3286},{54590,5,17689},{54592,0,3288},
+{54593,9,17691},{54596,0,3289},{54597,25,17694},{54604,5,3290},
+{54606,14,2995},{54610,21,17703},{54616,5,3294},{54618,5,17709},
+{54620,0,3296},{54621,9,17711},{54624,0,3297},{54625,13,17714},
+{54629,0,3298},{54630,5,17718},{54632,5,3299},{54634,14,2999},
+{54638,21,17722},{54644,5,3303},{54646,5,17728},{54648,0,3305},
+{54649,9,17730},{54652,0,3306},{54653,25,17733},{54660,5,3307},
+{54662,0,17740},{54663,9,3309},{54666,21,17741},{54672,0,3312},
+{54673,77,17747},{54693,0,3313},{54694,133,17767},{54728,5,3314},
+{54730,5,17801},{54732,0,3316},{54733,9,17803},{54736,10,3003},
+{54739,17,17807},{54744,5,3319},{54746,14,3006},{54750,21,17814},
+{54756,5,3323},{54758,5,17820},{54760,0,3325},{54761,9,17822},
+{54764,0,3326},{54765,25,17825},{54772,5,3327},{54774,14,3010},
+{54778,21,17834},{54784,5,3331},{54786,5,17840},{54788,0,3333},
+{54789,9,17842},{54792,0,3334},{54793,25,17845},{54800,5,3335},
+{54802,0,17852},{54803,9,3337},{54806,21,17853},{54812,0,3340},
+{54813,9,17859},{54816,0,3341},{54817,9,17862},{54820,0,3342},
+{54821,29,17865},{54829,0,3343},{54830,37,17873},{54840,5,3344},
+{54842,5,17883},{54844,0,3346},{54845,9,17885},{54848,0,3347},
+{54849,13,17888},{54853,0,3348},{54854,5,17892},{54856,5,3349},
+{54858,14,3014},{54862,9,17896},{54865,0,3353},{54866,5,17899},
+{54868,5,3354},{54870,5,17901},{54872,0,3356},{54873,9,17903},
+{54876,0,3357},{54877,37,17906},{54887,10,3018},{54890,21,17917},
+{54896,5,3360},{54898,5,17923},{54900,0,3362},{54901,53,17925},
+{54915,10,3021},{54918,21,17940},{54924,5,3365},{54926,5,17946},
+{54928,0,3367},{54929,9,17948},{54932,0,3368},{54933,29,17951},
+{54941,18,3024},{54946,21,17961},{54952,0,3372},{54953,9,17967},
+{54956,0,3373},{54957,9,17970},{54960,0,3374},{54961,29,17973},
+{54969,10,3029},{54972,29,17982},{54980,5,3377},{54982,5,17990},
+{54984,0,3379},{54985,9,17992},{54988,0,3380},{54989,13,17995},
+{54993,0,3381},{54994,5,17999},{54996,0,3382},{54997,5,18001},
+{54999,10,3032},{55002,21,18004},{55008,0,3385},{55009,9,18010},
+{55012,0,3386},{55013,9,18013},{55016,0,3387},{55017,25,18016},
+{55024,0,3388},{55025,13,18023},{55029,0,3389},{55030,21,18027},
+{55036,5,3390},{55038,5,18033},{55040,0,3392},{55041,9,18035},
+{55044,0,3393},{55045,45,18038},{55057,0,3394},{55058,21,18050},
+{55064,5,3395},{55066,5,18056},{55068,0,3397},{55069,9,18058},
+{55072,0,3398},{55073,25,18061},{55080,5,3399},{55082,14,3035},
+{55086,21,18070},{55092,5,3403},{55094,5,18076},{55096,0,3405},
+{55097,9,18078},{55100,0,3406},{55101,25,18081},{55108,0,3407},
+{55109,5,18088},{55111,10,3039},{55114,21,18091},{55120,5,3410},
+{55122,5,18097},{55124,6,3042},{55126,13,3413},{55130,21,18100},
+{55136,5,3417},{55138,14,3044},{55142,9,18108},{55145,0,3421},
+{55146,5,18111},{55148,0,3422},{55149,9,18113},{55152,0,3423},
+{55153,9,18116},{55156,0,3424},{55157,25,18119},{55164,5,3425},
+{55166,9,18126},{55169,0,3427},{55170,21,18129},{55176,5,3428},
+{55178,5,18135},{55180,0,3430},{55181,9,18137},{55184,0,3431},
+{55185,25,18140},{55192,5,3432},{55194,14,3048},{55198,21,18149},
+{63744,50,3052},{63757,25,4375},{63764,0,5800},{63765,9,4382},
+{63768,21,4386},{63774,9,4394},{63777,6,3065},{63779,5,4406},
+{63781,25,4409},{63788,5,4419},{63790,6,3067},{63792,5,4513},
+{63794,21,4517},{63800,9,4524},{63803,21,4528},{63809,9,4535},
+{63812,5,4541},{63814,9,4545},{63817,6,3069},{63819,13,4566},
+{63823,5,4571},{63825,0,4576},{63826,13,4604},{63830,13,4609},
+{63834,106,3071},{63861,9,4425},{63864,9,4429},{63867,9,4435},
+{63870,0,4439},{63871,5,4442},{63873,10,3098},{63876,5,4449},
+{63878,0,4453},{63879,21,4455},{63885,6,3101},{63887,5,4465},
+{63889,0,4161},{63890,9,4468},{63893,0,4162},{63894,5,4471},
+{63896,6,3103},{63898,5,4475},{63900,5,4478},{63902,0,6447},
+{63903,5,4481},{63905,18,3105},{63910,9,4487},{63913,6,3110},
+{63915,9,4493},{63918,10,3112},{63921,13,4501},{63925,0,4506},
+{63926,9,4508},{63929,0,5797},{63930,9,4551},{63933,10,3115},
+{63936,5,4556},{63938,5,4560},{63940,22,3118},{63946,5,4581},
+{63948,14,3124},{63952,13,4590},{63956,9,4595},{63959,13,4599},
+{63963,22,3128},{63969,5,4620},{63971,14,3134},{63975,9,4632},
+{63978,0,4636},{63979,5,4188},{63981,0,4638},{63982,9,4640},
+{63985,17,4644},{63990,0,4650},{63991,9,4653},{63994,70,3138},
+{65281,233,264},{65340,0,112},{65341,129,324},{65374,0,113},
+{65504,5,143},{65506,6,3156},{65509,6,3158},
+};
+
+static const unsigned short cmap_UniKS_UCS2_H_table[3160] = {
+155,107,668,176,138,130,206,842,675,177,751,748,
+752,209,131,673,676,768,132,766,669,760,761,670,
+762,671,764,672,765,772,678,771,674,767,677,770,
+202,205,204,207,200,203,8582,9326,9324,156,8763,263,
+260,247,250,248,251,249,8868,8865,8864,8869,8867,8815,
+8814,8854,195,8855,196,9190,9192,9191,9193,9198,9200,9199,
+9201,151,198,8715,152,184,8749,185,8750,180,136,8717,
+148,191,190,137,181,210,8321,8739,8723,154,8722,133,
+153,8734,8748,8747,8486,8488,8742,8503,149,8320,106,519,
+530,520,531,521,558,557,532,522,552,551,533,524,
+556,555,535,523,554,553,534,525,546,536,527,548,
+538,526,542,547,537,528,544,549,539,529,165,164,
+237,236,235,238,8736,167,166,8780,220,219,169,168,
+8779,218,217,163,162,228,227,8787,159,8639,161,160,
+158,157,241,240,242,9222,243,9223,226,221,224,225,
+239,255,252,8700,175,104,9330,261,662,592,650,665,
+259,614,663,607,8790,611,660,654,664,659,6460,6704,
+4670,6534,5320,5331,7616,7041,5181,5492,3893,5041,7882,4192,
+6029,4154,5241,7800,7614,5683,6380,3895,3613,5862,5092,5315,
+5242,6413,6252,6238,7801,6049,6705,4696,7670,3868,7685,5947,
+7710,3660,6706,4427,5771,6444,4038,3560,6483,5244,7380,6535,
+5110,5418,4250,4489,6414,3602,3561,7671,6415,4051,6050,4063,
+5074,5005,8005,5246,3436,4194,6591,7544,6284,6592,6861,6854,
+6198,5935,6461,5171,6509,5879,4989,6462,5247,3476,7015,3839,
+4506,4764,7966,7367,4440,3705,7241,5776,6051,6902,3661,7734,
+5248,7759,5737,5567,5111,4836,4269,7967,6395,3662,7043,4941,
+7337,3969,6837,3585,6030,4595,7394,6131,3438,3627,6285,7330,
+6708,6199,5303,5182,7262,6175,6052,6645,7177,5419,5075,8035,
+5249,6396,6903,6089,6359,6255,7772,7306,6783,8013,5420,3840,
+4016,7431,4735,7449,4155,6646,4429,6312,7499,3787,4591,7791,
+5043,4064,3898,6647,5864,4424,6784,4607,4333,4606,6390,8036,
+7904,3563,7167,6141,7303,5152,6684,6031,7490,5037,4614,5304,
+6759,5561,3970,7077,6484,3465,5301,4017,4397,6648,6480,6649,
+4018,5021,4577,6760,3619,3789,3440,4479,4024,6785,4169,3624,
+4334,6229,3510,4812,5685,4511,4766,5493,6619,4025,6510,4009,
+3899,4848,7547,5076,5183,7863,5151,6536,3841,4188,3900,5772,
+7149,6478,5686,6053,7994,4906,5185,6834,7395,7760,4800,6446,
+6287,3466,4390,6256,7332,3979,7618,6201,7044,4052,6202,7316,
+5568,6032,7251,3901,3729,3902,3730,6943,3994,5500,7500,3441,
+7432,7016,5250,6203,8023,3467,7663,4128,6620,4335,4749,7969,
+4616,7450,7711,6381,7534,8030,7317,4838,7970,5738,7802,4750,
+6944,3870,5841,7590,7664,6571,3767,7953,5252,6980,7169,4374,
+7971,7655,7150,7995,7883,8037,3501,6314,5336,4132,3871,5253,
+7338,5569,6868,5570,5254,4491,3733,7550,5902,6259,6258,4218,
+3511,6855,3581,3906,6260,6178,6905,5948,5117,4971,4069,3637,
+7459,3537,6355,5793,6142,5918,5060,6537,4273,3857,6002,4274,
+4241,6650,6057,6931,7720,4834,4319,6058,6538,4564,3842,3858,
+4536,5255,6470,6463,7804,5374,4071,5403,6135,5630,4190,7151,
+7433,5118,6143,5834,4072,4156,5094,3996,6869,7884,3708,5156,
+7730,7418,6360,6540,5404,5157,4159,4170,5936,5186,4697,6144,
+4039,6595,3734,5475,6289,6472,6145,3538,6864,6060,4134,5959,
+5739,4852,6261,3445,5573,5422,3872,6488,7754,3790,6481,6489,
+6832,6490,7955,3709,3735,5631,6522,6204,5574,5807,5553,6108,
+7427,7950,6838,3820,6870,6711,6109,6397,3580,5423,5759,6316,
+7885,7691,5960,5503,3446,5740,6180,5632,7116,6622,6263,4074,
+6450,4883,3907,7635,6205,5721,4664,7078,3803,7368,6061,6146,
+5760,4167,7117,5762,5258,3821,4553,6906,7253,5061,6541,6653,
+6291,6833,5763,4254,4275,5504,5697,6361,7136,3736,4186,4853,
+4180,3948,3587,3710,5699,5698,7335,4618,4075,6527,5575,3531,
+4870,5808,4421,4076,5843,3540,4854,3513,5375,5795,7152,6871,
+5640,5506,3791,6856,3874,3588,4077,6418,5261,7476,5547,3604,
+5700,7551,7973,6712,5796,7571,4996,4242,7536,3481,7530,4160,
+5045,7706,3482,4279,6857,5824,5377,3541,6181,7620,4483,4412,
+6872,6655,4803,7097,7537,3843,5961,6714,3605,7930,3964,6787,
+6451,5172,7854,7736,7807,4198,7792,5919,6230,7118,7578,6788,
+5225,7513,7098,6004,5173,6126,6715,7931,4600,7974,5378,3671,
+4280,4364,4972,5263,4422,5903,7906,5079,5642,4079,6452,7248,
+6947,4494,5264,7434,6421,5477,6264,6473,5643,5702,7932,6491,
+8010,7341,7636,6374,3468,4164,3793,5723,8031,6765,7637,5554,
+6656,6062,6320,7887,7254,5189,4268,7312,4281,7132,6321,7793,
+5797,7385,4178,5866,5478,7333,4872,7517,6398,6207,5844,3566,
+6265,6375,6492,3655,7435,7910,4675,3822,3469,7794,3567,3672,
+3544,7137,6168,7255,6208,4465,5237,8044,8043,7412,4873,3673,
+3483,7692,6391,6063,4815,4375,7934,7737,6399,4466,4243,3804,
+5667,5579,6369,5479,5781,3712,6657,8045,4446,4948,5507,7520,
+5424,7809,5191,5687,4080,3648,7477,5914,5380,7676,6686,5830,
+7266,4817,4165,4409,4909,4888,4136,3861,3589,7139,4931,7387,
+6148,3911,6835,7219,4973,3837,5724,4129,6934,5678,4137,6717,
+5963,4676,7763,4143,5962,5098,5265,4144,4166,5581,4283,4425,
+7119,7420,3795,7267,5929,6789,4804,6766,5883,7888,3629,7999,
+5867,5327,6149,4284,4910,7425,7447,5316,6150,7171,4932,7478,
+7261,4513,7153,6790,3674,4259,7399,4400,7079,3592,3875,7878,
+4401,5583,3739,6325,3568,4949,6718,5382,3876,4874,6064,7505,
+3517,5306,3675,5885,6719,6624,5125,5584,4484,7539,5193,4912,
+3768,5266,4027,7141,6512,7088,5267,5742,5904,5703,5426,6720,
+6464,4200,6952,6791,5644,6231,3777,5688,4952,7810,4751,7845,
+5161,4041,5950,5407,8019,5046,5480,6005,4712,6513,5704,7621,
+6232,5047,5836,6792,5705,6873,8046,5481,6066,7890,7935,7811,
+5743,4677,5062,3676,5408,7198,6721,3990,6722,3447,7988,8000,
+6293,5383,4140,5825,5886,6546,7795,7572,4459,4221,6152,7573,
+3769,6033,3678,3502,5385,6794,6793,6933,7206,7264,6281,6326,
+5302,7031,4798,4538,4788,4857,4691,5091,7080,7304,4620,7707,
+6575,7249,4085,5539,4975,3615,4337,5555,7492,4146,5409,3805,
+6954,3743,7531,4991,4773,3518,7365,5990,6327,3450,4157,6875,
+4579,5707,7127,5268,5645,6658,5386,4602,3877,4992,7704,4028,
+3631,6576,3616,7678,3713,4285,4338,5346,7891,4130,6577,7342,
+6110,7220,6067,4621,6767,3714,3778,5011,4858,4087,5049,6797,
+4020,4339,4245,6523,3715,4286,3823,5725,7268,7592,5452,7389,
+4820,7222,5932,6599,5646,7693,7269,6007,6988,4954,3915,7460,
+7104,7270,6548,4892,5585,7866,6239,5647,4015,4366,5915,4042,
+3620,6549,4287,3985,4448,6927,8027,7048,8028,3824,8029,7727,
+7889,6956,6726,7049,5063,4821,4460,3991,5837,6989,5648,5586,
+4485,5228,6402,3917,4309,6356,5196,7812,3918,5238,6009,6727,
+6929,3919,5938,7855,3545,6957,4091,5162,5765,4092,6079,6267,
+7679,5965,7370,4796,4234,4739,4849,7308,5272,6958,7506,5200,
+6331,7343,5512,3745,7179,5966,7914,7776,7154,4893,7556,7481,
+6388,4914,4878,7438,5889,4480,5454,7857,5649,8016,3845,6268,
+8032,7482,6687,6910,7813,4414,7694,7371,7764,3680,5513,5472,
+6184,7960,5967,3977,7344,5411,7961,4093,4288,6843,4568,4597,
+6382,7846,7199,5930,7155,7180,7892,6602,3520,6730,3593,4289,
+5274,4933,5801,6099,5455,7334,6294,4860,6578,7847,4976,4861,
+4223,5727,6731,7915,6453,7429,6269,4148,4582,3920,3716,6083,
+7105,4746,6493,7142,6579,4290,3780,4679,5905,7582,5970,6799,
+7640,4468,4680,6959,5589,7106,7033,4915,5634,6529,4515,5412,
+4224,6800,4341,5066,4639,6880,7514,7641,7446,7939,7063,3633,
+7402,4486,4175,6768,7818,6334,4403,6912,7778,4310,7642,6014,
+6370,4461,6732,5515,4539,4544,7779,5562,6514,6580,8021,6494,
+3846,7740,3594,7415,6881,6515,6696,7858,4383,4977,5163,4469,
+7992,4716,7893,7976,6801,6242,6253,4367,4326,4999,5975,6802,
+7064,5590,7243,5473,7985,5744,4292,6154,7731,7483,6587,6516,
+5129,5869,7962,5349,6422,6552,7521,7493,4311,5782,4778,4545,
+5388,4623,4624,7765,4415,7509,4729,5708,6836,5482,6604,4808,
+7901,6272,6080,5276,4214,7725,6496,5552,3923,6211,4094,4495,
+4260,4880,5308,7608,6992,7977,4384,5651,5067,6423,7713,7782,
+3999,6735,7743,4416,4625,5593,6663,5636,7404,7822,4095,4096,
+5102,6115,6844,3826,5993,4649,4043,5201,7484,7848,6212,4779,
+7302,5430,4173,7823,6019,6337,5389,5674,4585,6155,6084,6993,
+7783,4657,4097,4626,4895,3683,5025,7065,7583,7494,5768,7181,
+5371,5518,5068,6190,6664,6338,3532,5745,4149,6665,4235,4917,
+6995,7289,4825,4426,8008,6914,6424,7868,4246,3547,6883,7192,
+7610,5520,5519,7558,7599,3522,4215,6996,4342,6605,7022,7346,
+8022,4352,3686,6085,7143,7108,4918,4368,4935,3572,7920,6213,
+4978,5484,4293,6526,4731,3523,4919,7421,4862,3978,4780,3748,
+6037,5653,4558,7182,3621,4781,4060,5709,6404,4204,6134,3881,
+6961,7120,7373,4588,3687,4528,5847,5563,4546,7050,4450,4462,
+4923,5279,4103,6806,6963,6807,3595,7826,7290,5746,7869,6739,
+5081,5907,8052,4045,7870,4315,5597,5281,5053,4162,7273,3807,
+7229,7000,5838,6976,7349,7591,6809,6235,6977,4296,3454,3720,
+3749,3771,6628,6022,5366,6038,3965,3798,7024,7109,3966,6157,
+7067,4002,6689,4653,3689,6555,6900,7291,6770,4496,4031,6668,
+5654,5006,3849,7292,7456,4896,4107,6690,7921,6671,7522,6531,
+5524,7183,4487,5131,6884,6630,6811,6697,4434,7070,3582,5166,
+6812,3548,5873,7859,6217,8025,7895,5283,3865,6964,4056,5167,
+5525,4957,5367,6500,6886,7081,4571,5498,5526,3525,6846,7746,
+6813,3691,4924,4385,7747,7457,5284,3549,6743,5601,5602,6340,
+3550,4701,7173,7121,4109,7416,6517,4610,4742,4126,5208,7034,
+4207,7209,4881,7523,6117,7001,5855,7002,7828,6171,7294,5980,
+7257,6631,4826,6158,6978,5436,5689,7942,3722,4317,4405,4702,
+7643,6859,3854,5437,6405,4630,3583,5355,8033,6632,7322,5209,
+6160,4519,6501,4111,4782,6243,4472,7258,5488,6191,7200,4542,
+6368,6429,5638,5285,6815,4605,4113,3752,6965,3643,4958,3866,
+6358,6298,6865,4980,3533,6364,5394,7766,7324,7767,4722,3472,
+3695,3552,6120,5489,4179,6161,3608,6557,5082,5438,7461,4959,
+4667,5675,4228,7943,4176,4359,6559,4650,6967,7354,4261,7003,
+3930,5941,8034,5456,5286,7158,5657,4827,6888,7683,4960,4925,
+7390,4900,7749,3496,4436,3497,5368,6518,3967,5137,4360,3575,
+7830,5168,7487,6039,5769,6969,6244,4032,7274,4783,5783,6274,
+5995,7441,7233,7562,3933,5874,3754,6608,3755,7612,6921,4828,
+5017,3456,4784,7944,6455,4191,6192,5943,7234,7784,6431,7923,
+4631,6560,5138,5784,4668,4531,3949,7872,3756,4611,5213,7314,
+4297,4732,7532,6299,7831,6561,5876,7113,7832,5549,4684,5084,
+6504,5325,5527,6383,3981,7430,4829,7989,5319,5751,5396,7986,
+4406,5752,6564,4451,6040,4370,5877,5003,5609,4642,6816,4520,
+5529,5924,5028,3609,7133,7721,4521,6221,7834,3799,6817,5105,
+5753,6916,4452,7709,5981,7750,5668,7786,3934,6409,6275,4763,
+5610,7005,6582,4482,6042,6343,5070,6565,7566,5071,6304,4983,
+5086,7511,4298,7363,6745,5139,8026,7406,4114,7006,6890,6818,
+7533,5661,6043,3987,6673,8055,7873,7698,5358,6971,6457,5490,
+3725,4830,6075,3760,5558,6377,6819,6345,7194,7210,7699,6746,
+3498,6346,6506,5770,7593,6774,4785,5818,6305,5543,4965,3657,
+6442,3556,6634,4589,8011,4115,5953,6411,7090,5898,7837,6045,
+7586,5719,7512,6747,5140,6583,3800,5234,7875,7495,7423,3832,
+7129,6613,5499,6433,3992,7528,4718,4263,5218,7195,6432,4831,
+7626,5169,4547,6476,7947,6507,3460,7751,4719,7160,5142,3936,
+5364,6972,7315,6365,6941,4006,5143,4936,7028,4237,7161,3610,
+4301,7052,7797,6638,7145,4643,5755,3968,7053,5819,3988,3957,
+7196,4686,5073,3698,4438,7356,8003,4706,7174,4474,5055,4985,
+4599,5613,5087,6674,5944,7650,6276,7175,3888,5756,3761,5035,
+7009,6173,4177,6639,4902,7463,5559,3838,4302,7978,5954,7469,
+7299,3938,4303,3699,6615,7458,5399,4500,5545,6822,6917,5106,
+4475,6895,7010,4361,5614,6349,6246,7525,3812,7627,7925,4304,
+4216,6306,5550,4238,7212,6277,5532,6823,7054,4362,7162,5445,
+4561,3598,7602,6166,4720,7700,5615,7896,6434,4669,7788,4138,
+3526,7443,3939,6352,6749,7280,6519,4986,6896,4760,4387,7843,
+5313,6412,6567,7240,7798,4509,3584,5416,4634,6925,5871,4439,
+4635,4131,5566,6750,5146,7374,3622,7497,5329,6676,3534,3940,
+5670,6751,3941,5534,5664,4233,6753,4118,6678,3762,7059,4476,
+3813,7838,7011,3499,4882,3475,7667,5008,5996,5820,7668,3983,
+7473,7164,5029,5788,7391,4576,4724,3558,7543,7669,5470,5691,
+7146,6278,7012,6777,4612,4307,7661,4593,6226,4603,4264,5619,
+7926,3727,3636,6247,5849,4022,6778,6569,6520,5813,6254,5789,
+7037,3763,6919,6508,6097,6617,6826,5622,7285,6533,4636,4142,
+4847,5170,4502,4550,6754,7014,4868,4744,7715,7839,7757,6757,
+3701,7684,5665,6048,6124,4928,4328,7489,4504,3702,7464,6780,
+5857,5804,5221,5004,5551,4120,7362,6386,4929,5298,7569,5734,
+7716,5901,3989,7076,5448,4121,6167,4661,5909,7596,7358,5666,
+6899,4174,3942,7286,5536,3703,5955,7897,4455,5626,7213,3863,
+7849,4940,4995,4721,5108,4762,3773,4833,8012,6393,4526,4125,
+4534,3952,4745,5401,4457,4265,7305,6077,5040,6781,6585,1117,
+9377,1118,9413,1127,9442,1148,1160,9472,1161,9485,1167,9486,
+1168,9489,1172,9490,1178,9501,1179,9507,1182,9508,1183,9549,
+1196,9550,1197,1201,9571,1202,9588,1213,9589,9655,1230,9699,
+1242,9700,1243,9738,1250,9744,1253,9745,1256,9749,9750,1260,
+1261,9754,1262,9838,1284,1295,9871,1296,1306,9929,1307,9930,
+1308,9938,1311,9939,10052,1337,10053,1359,10156,1360,10157,1361,
+10158,1362,10163,1366,10164,1367,10210,1375,10211,1376,10218,1380,
+10227,1392,10228,1413,10302,1445,10382,1446,10388,1449,10389,1450,
+10459,1462,1467,10481,1468,10482,1469,10500,1477,10501,1478,10616,
+1501,10617,1504,10621,1505,1511,10652,1512,10658,1515,10659,1516,
+1517,10664,10665,1521,10749,1549,10757,1556,10758,1557,10759,1558,
+1559,10762,10835,1581,10836,1582,10840,1585,10841,1586,10842,1587,
+10843,1588,10910,1599,10958,1607,10959,1608,1616,11032,1617,11033,
+1618,11067,1629,11073,1632,11074,1633,1668,11223,11574,1719,11619,
+1730,11620,1731,1756,11678,1757,11725,1764,11743,1774,11744,1775,
+1787,11785,1788,11806,1795,11807,1796,11879,1806,11880,1807,1811,
+11901,1812,11902,1813,11921,1820,11922,1821,1830,11996,1831,12015,
+1838,12016,1839,12035,1846,12036,12080,1857,12081,1858,1861,12090,
+12096,1869,12097,1872,12100,1891,12176,1892,12182,1895,12183,12222,
+1915,1921,12258,1922,12264,1925,12265,1926,1934,12338,1935,12339,
+1936,1940,12360,1941,12369,1945,12377,1952,12378,1953,1954,12382,
+1959,12397,1960,12536,1980,12543,1986,12544,1987,12553,2000,12554,
+2001,12634,2022,12640,2025,12641,2042,12678,12710,2052,12721,2056,
+12722,2057,12837,2080,12838,2081,12842,2084,2097,12933,2098,12952,
+2105,2109,12994,2110,13000,2113,13001,2120,13011,2121,2173,13333,
+2174,13513,2188,13514,2189,13566,2219,13567,2220,2240,13609,13672,
+2266,2267,13676,2268,13682,2271,13683,2272,13747,2290,13768,2297,
+13769,2298,13787,2306,13788,2307,13789,2308,13790,13791,2311,13852,
+2325,13853,2326,2331,13875,2332,13893,2340,13894,2341,13939,2350,
+13940,2351,2352,13945,2375,14044,2376,14142,2390,2422,14389,2423,
+14440,2437,14441,2438,14490,2471,14491,2472,2473,14495,14528,2494,
+14529,2495,14530,14543,2502,14544,2503,14551,2507,2508,14555,14589,
+2533,14592,2537,14593,2538,14594,2539,2553,14633,2554,14652,2561,
+14653,2562,14672,2569,14673,2570,14690,2579,14691,2580,14751,2602,
+14752,2603,14771,2610,14772,2611,14773,2612,2617,14788,14789,2620,
+14790,2646,14827,2649,14830,14831,2653,2671,14864,2672,14865,2673,
+2682,14913,2683,14919,2686,14920,14938,2695,14939,2696,2708,14999,
+2709,15005,2712,15006,2720,15024,2721,15025,2722,15070,2731,15071,
+2732,15112,2745,15113,2746,15185,2756,15230,2767,15231,2768,15270,
+2774,15276,2777,15277,2784,15283,2785,15284,2786,15481,2824,15482,
+2825,15483,2826,2853,15733,2854,2866,15789,2867,15790,2868,2885,
+15826,2886,15827,2887,15904,2905,15905,2906,15974,2919,15975,2920,
+16047,2930,16048,2931,16093,2940,16094,2941,16166,2951,16167,2952,
+16209,2964,16210,2965,16255,2974,16256,2975,16275,2982,16276,2983,
+16385,3012,16386,3013,16452,3029,16453,3030,16573,3048,16574,3049,
+16643,3062,16644,3063,16736,3081,16737,3082,3107,16840,3108,16865,
+3120,16866,3121,16936,3133,16937,3134,3135,16942,3136,3141,17013,
+3142,17059,3150,17060,3151,17168,3172,17174,3175,17218,3187,17219,
+3188,17226,3192,3193,17230,3194,17346,3227,17347,3228,3238,17390,
+3239,17411,3246,17412,3247,3255,17513,3256,17526,3262,17532,3265,
+17533,3266,3278,17632,3279,17652,3285,17701,3292,17702,3293,17720,
+3301,17721,3302,3317,17806,3318,17812,3321,17813,3322,17832,3329,
+17833,3330,17894,3351,17895,3352,3358,17916,3359,3363,17939,3364,
+3369,17959,3370,17960,3371,3375,17981,3376,3383,18003,3384,18068,
+3401,18069,3402,3408,18090,3409,3412,18099,18106,3419,18107,3420,
+18147,3434,18148,3435,4116,3678,7053,3460,7900,3802,3902,3946,
+3946,3708,4131,4374,4156,4399,4403,4424,4511,4550,4564,4318,
+4136,5800,4139,4192,4167,4172,5552,6424,5151,4922,7518,5079,
+5109,7607,5584,5367,7083,5362,5485,6001,5460,5317,7009,7370,
+5678,5874,4159,4444,4447,4463,4160,4474,4473,5460,4483,4163,
+4166,4485,4491,4167,7783,4497,4499,4180,4555,5800,4563,7988,
+6123,4577,4183,4579,4584,4586,4588,4184,5552,4603,4614,4616,
+4618,5950,4187,4625,4627,4629,5351,6494,5731,5771,4191,6484,
+6684,4279,7139,4247,4266,4340,7572,5088,7709,3558,3644,3815,
+194,357,145,323,
+};
+
+static pdf_cmap cmap_UniKS_UCS2_H = {
+	-1, "UniKS-UCS2-H", "", 0, 0, 2,
+	{ {2,0,55295},{2,57344,65535}, },
+	6355, 6355, (pdf_range*) cmap_UniKS_UCS2_H_ranges,
+	3160, 3160, (unsigned short*) cmap_UniKS_UCS2_H_table,
+};
+
+/* UniKS-UCS2-V */
+
+static const pdf_range cmap_UniKS_UCS2_V_ranges[] = {
+{8211,5,8059},{8214,0,8061},{8229,0,8058},{12289,5,8056},
+{12296,37,8065},{12307,0,8075},{12308,5,8063},{65281,0,8076},
+{65288,5,8077},{65292,0,8079},{65294,0,8080},{65306,21,8081},
+{65339,0,8087},{65341,0,8088},{65343,0,8089},{65371,9,8090},
+{65374,0,8062},{65507,0,8093},
+};
+
+static const unsigned short cmap_UniKS_UCS2_V_table[] = { 0 };
+
+static pdf_cmap cmap_UniKS_UCS2_V = {
+	-1, "UniKS-UCS2-V", "UniKS-UCS2-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_UniKS_UCS2_V_ranges,
+	0, 0, (unsigned short*) cmap_UniKS_UCS2_V_table,
+};
+
+/* UniKS-UTF16-H */
+
+static const pdf_range cmap_UniKS_UTF16_H_ranges[] = {
+{32,377,1},{161,0,208},{164,0,214},{167,18,0},
+{176,6,5},{178,5,843},{180,0,199},{182,38,7},
+{198,0,666},{208,0,667},{215,6,17},{222,6,19},
+{230,0,757},{240,0,759},{247,6,21},{254,0,769},
+{273,0,758},{294,6,23},{305,10,25},{312,0,763},
+{319,14,28},{329,10,32},{338,6,35},{358,6,37},
+{700,0,8275},{711,0,201},{728,22,39},{913,65,471},
+{931,25,488},{945,65,495},{963,25,512},{1025,0,1026},
+{1040,21,1020},{1046,125,1027},{1078,101,1060},{1105,0,1059},
+{8208,0,97},{8211,5,109},{8214,0,111},{8216,5,114},
+{8219,0,8238},{8220,5,116},{8223,0,8237},{8224,5,245},
+{8226,0,8607},{8229,5,105},{8240,0,216},{8242,5,139},
+{8244,10,45},{8249,5,8612},{8251,6,48},{8258,0,8599},
+{8308,0,845},{8314,5,8239},{8316,0,8248},{8317,5,8250},
+{8319,0,846},{8321,13,847},{8361,0,96},{8451,0,141},
+{8457,0,215},{8467,0,590},{8470,0,258},{8481,6,50},
+{8486,0,643},{8491,0,142},{8531,5,749},{8539,13,753},
+{8544,37,461},{8560,37,451},{8592,5,171},{8594,0,170},
+{8595,5,173},{8597,18,52},{8624,18,57},{8636,0,8884},
+{8640,0,8885},{8644,5,8896},{8653,0,8816},{8655,22,62},
+{8672,14,68},{8678,14,72},{8704,0,197},{8706,6,76},
+{8710,14,78},{8715,6,82},{8719,0,213},{8721,0,212},
+{8723,0,8726},{8730,0,178},{8733,14,84},{8738,0,8738},
+{8741,5,8719},{8743,5,192},{8745,6,88},{8747,5,182},
+{8750,0,211},{8756,14,90},{8765,0,179},{8771,0,8500},
+{8773,0,8499},{8776,0,8501},{8784,14,94},{8794,0,8753},
+{8800,10,98},{8804,5,134},{8806,5,8724},{8814,5,8745},
+{8816,13,8481},{8822,5,8489},{8825,0,8491},{8826,5,8475},
+{8832,5,8479},{8834,5,188},{8836,6,101},{8838,5,186},
+{8842,6,103},{8853,9,8727},{8867,10,105},{8891,5,8751},
+{8910,5,8477},{8922,5,8492},{8942,6,108},{8966,0,8754},
+{8978,0,150},{8980,0,8731},{9312,57,733},{9327,17,8791},
+{9332,57,827},{9347,17,9042},{9372,101,801},{9398,101,8388},
+{9424,101,707},{9472,14,110},{9484,70,114},{9502,5,559},
+{9504,0,541},{9505,5,561},{9507,10,132},{9510,5,563},
+{9512,0,543},{9513,5,565},{9515,6,135},{9517,5,567},
+{9519,6,137},{9521,5,569},{9523,6,139},{9525,5,571},
+{9527,6,141},{9529,5,573},{9531,6,143},{9533,5,575},
+{9535,0,545},{9536,5,577},{9538,0,550},{9539,29,579},
+{9547,0,540},{9618,0,232},{9632,6,145},{9635,0,229},
+{9636,5,233},{9638,14,147},{9649,10,151},{9653,10,154},
+{9657,0,8781},{9660,6,157},{9663,10,159},{9667,0,8782},
+{9670,26,162},{9678,6,169},{9680,5,230},{9702,0,8775},
+{9711,0,8633},{9733,6,171},{9742,6,173},{9756,14,175},
+{9775,0,8664},{9792,0,147},{9794,0,146},{9824,5,222},
+{9827,10,179},{9831,6,182},{9833,5,253},{9836,6,184},
+{9839,0,8594},{10006,0,8631},{10010,0,8630},{10045,0,8604},
+{10070,0,8637},{10102,37,8673},{10122,37,8342},{12032,0,6460},
+{12036,0,6380},{12038,0,6413},{12040,0,6443},{12042,6,186},
+{12049,6,188},{12052,0,5183},{12055,6,190},{12060,6,192},
+{12063,6,194},{12067,14,196},{12072,6,200},{12075,0,5697},
+{12077,0,5305},{12079,14,202},{12088,0,3964},{12092,18,206},
+{12098,42,211},{12111,14,222},{12116,18,226},{12122,50,231},
+{12137,30,244},{12146,18,252},{12152,0,5132},{12154,14,257},
+{12159,50,261},{12174,10,274},{12178,22,277},{12185,30,283},
+{12194,6,291},{12197,18,293},{12204,22,298},{12211,38,304},
+{12225,38,314},{12237,30,324},{12288,9,101},{12291,0,108},
+{12296,37,120},{12306,6,332},{12308,5,118},{12310,13,8219},
+{12318,5,9322},{12320,0,8671},{12342,0,8701},{12353,329,851},
+{12449,341,934},{12539,6,334},{12593,201,358},{12644,0,101},
+{12645,165,409},{12800,109,773},{12828,0,257},{12849,0,8788},
+{12857,0,8789},{12896,109,679},{12927,0,256},{12938,21,9301},
+{12944,0,9300},{12948,0,9080},{12958,0,8761},{12965,0,9096},
+{13184,17,627},{13192,5,612},{13194,9,646},{13197,9,608},
+{13200,17,638},{13205,9,587},{13208,0,591},{13209,37,597},
+{13219,13,593},{13223,5,615},{13225,13,655},{13229,9,651},
+{13232,37,617},{13242,21,632},{13248,5,644},{13250,38,336},
+{13263,6,346},{13267,0,661},{13270,0,649},{13272,0,262},
+{13275,10,348},{19968,6,351},{19971,0,7364},{19975,18,353},
+{19981,0,5109},{19985,0,7288},{19988,10,358},{19992,6,361},
+{19998,0,5682},{20013,0,6922},{20018,0,3802},{20024,6,363},
+{20027,0,6860},{20034,6,365},{20037,0,3894},{20043,0,6942},
+{20045,10,367},{20054,0,3855},{20056,6,370},{20061,10,372},
+{20075,0,3500},{20077,0,4329},{20083,0,6309},{20086,6,375},
+{20094,0,3601},{20098,0,4389},{20102,0,4551},{20104,0,5934},
+{20107,6,377},{20110,0,6197},{20112,10,379},{20116,6,382},
+{20120,0,4058},{20123,0,5243},{20126,0,5775},{20129,6,384},
+{20132,10,386},{20136,0,7771},{20139,14,389},{20150,0,4193},
+{20154,0,6443},{20160,6,393},{20164,0,7331},{20167,0,3896},
+{20170,6,395},{20173,0,6479},{20180,22,397},{20189,0,4331},
+{20191,0,7148},{20195,10,403},{20208,0,5833},{20210,0,6923},
+{20214,6,406},{20219,0,6469},{20225,0,4062},{20233,10,408},
+{20237,18,411},{20271,0,4988},{20276,0,4905},{20278,0,4490},
+{20280,0,5735},{20282,0,5245},{20284,6,416},{20291,0,6643},
+{20294,10,418},{20301,18,421},{20309,0,7617},{20313,14,426},
+{20329,0,7502},{20335,6,430},{20339,0,3437},{20342,0,4127},
+{20346,0,6644},{20350,6,432},{20353,0,5736},{20355,6,434},
+{20358,0,4420},{20360,0,7336},{20362,6,436},{20365,0,5692},
+{20367,0,6862},{20369,0,6310},{20374,0,4594},{20376,0,7042},
+{20379,0,3786},{20381,0,6394},{20398,6,438},{20405,6,440},
+{20415,0,7518},{20418,10,442},{20425,6,445},{20430,0,6782},
+{20433,0,6174},{20435,6,447},{20439,0,5537},{20442,0,4613},
+{20445,0,5058},{20447,10,449},{20462,6,452},{20465,0,3897},
+{20467,0,4970},{20469,0,7576},{20472,0,5093},{20474,0,5925},
+{20482,0,5042},{20486,0,4428},{20489,0,7092},{20491,0,3562},
+{20493,0,4969},{20497,6,454},{20502,0,7705},{20505,6,456},
+{20508,0,7134},{20510,6,458},{20513,0,7093},{20515,6,460},
+{20518,10,462},{20522,14,465},{20539,0,5863},{20547,0,5917},
+{20551,10,469},{20559,0,7519},{20565,0,7686},{20570,0,6863},
+{20572,0,6707},{20581,0,3603},{20596,10,472},{20600,0,7465},
+{20608,0,3856},{20613,0,5112},{20621,0,4942},{20625,0,3614},
+{20632,6,475},{20652,6,477},{20658,6,479},{20661,0,7114},
+{20663,0,5332},{20670,0,3663},{20677,0,4023},{20681,6,481},
+{20687,0,5333},{20689,0,3869},{20693,6,483},{20698,0,4552},
+{20702,0,6286},{20709,0,6140},{20711,0,5684},{20717,0,7082},
+{20729,0,3439},{20731,0,5020},{20735,10,485},{20740,0,5912},
+{20742,0,3664},{20745,0,3617},{20754,0,6311},{20767,0,5334},
+{20769,0,4543},{20778,0,6200},{20786,0,6593},{20791,0,4441},
+{20794,0,4133},{20796,0,5926},{20800,6,488},{20803,26,490},
+{20811,14,497},{20818,0,5777},{20828,0,4348},{20834,0,4059},
+{20837,0,6477},{20839,30,501},{20849,0,3788},{20853,14,509},
+{20860,0,3654},{20864,0,4065},{20870,0,5933},{20874,0,7126},
+{20877,0,6570},{20882,0,4765},{20885,0,4736},{20887,0,6176},
+{20896,0,3819},{20901,0,4748},{20906,0,4733},{20908,0,4332},
+{20918,6,513},{20925,0,4477},{20932,0,7130},{20934,0,6904},
+{20937,0,4430},{20939,10,515},{20956,10,518},{20961,0,5009},
+{20976,6,521},{20982,0,8014},{20984,10,523},{20989,0,7651},
+{20992,0,4270},{20995,0,6445},{20998,10,526},{21002,0,3477},
+{21006,0,4837},{21009,0,7773},{21015,0,4478},{21021,0,7214},
+{21028,6,529},{21033,6,531},{21038,0,3835},{21040,0,4271},
+{21046,22,533},{21059,0,7205},{21063,0,7360},{21066,14,539},
+{21076,0,7135},{21078,0,5113},{21083,0,3536},{21085,0,4886},
+{21089,0,5463},{21097,6,543},{21103,0,5114},{21106,0,7649},
+{21109,0,7094},{21117,0,7577},{21119,0,7215},{21123,0,7948},
+{21127,10,545},{21133,0,3618},{21137,6,548},{21147,0,4458},
+{21151,6,550},{21155,6,552},{21161,10,554},{21182,0,7703},
+{21185,0,3665},{21187,0,4930},{21189,0,7361},{21191,0,6177},
+{21193,0,4737},{21197,0,3666},{21202,0,4604},{21205,6,557},
+{21208,6,559},{21211,0,7979},{21213,10,561},{21218,10,564},
+{21235,0,7980},{21237,0,4442},{21240,0,3971},{21242,6,567},
+{21246,6,569},{21253,0,7545},{21256,0,8015},{21261,0,7546},
+{21263,6,571},{21269,10,573},{21273,0,5693},{21280,6,576},
+{21283,0,3530},{21290,0,5184},{21295,0,7928},{21305,0,7604},
+{21311,10,578},{21315,6,581},{21319,14,583},{21325,0,4671},
+{21329,14,587},{21335,0,4145},{21338,0,4887},{21340,0,5077},
+{21342,0,5031},{21344,0,6692},{21350,0,3852},{21352,0,5450},
+{21359,10,591},{21364,6,594},{21367,0,3972},{21373,0,6926},
+{21375,0,3667},{21380,0,5851},{21395,0,5840},{21400,0,4615},
+{21402,0,7968},{21407,6,596},{21413,6,598},{21421,0,5989},
+{21435,0,3586},{21443,0,7083},{21448,14,600},{21453,0,4907},
+{21460,0,5628},{21462,6,604},{21467,0,4908},{21473,18,606},
+{21481,18,611},{21487,18,616},{21496,0,5251},{21507,6,621},
+{21512,10,623},{21516,22,626},{21531,0,3953},{21533,0,4638},
+{21535,6,632},{21542,0,5115},{21545,0,5153},{21547,0,7652},
+{21555,0,6055},{21560,6,634},{21563,6,636},{21566,0,6054},
+{21570,0,4443},{21576,0,6709},{21578,0,3731},{21585,0,7408},
+{21608,0,6867},{21610,0,6866},{21617,0,3732},{21619,0,4851},
+{21621,0,3442},{21627,10,638},{21632,0,6594},{21638,0,7548},
+{21644,0,7864},{21646,0,3903},{21648,0,5116},{21668,0,7381},
+{21672,0,6485},{21675,6,641},{21683,0,7687},{21688,0,7653},
+{21693,0,6447},{21696,6,643},{21700,0,7853},{21704,6,645},
+{21729,0,6257},{21733,0,3443},{21736,0,7216},{21741,6,647},
+{21746,0,7168},{21754,0,7549},{21764,0,7503},{21766,6,649},
+{21774,0,4617},{21776,0,4239},{21788,0,4689},{21807,0,6313},
+{21809,0,7095},{21813,0,5821},{21822,0,7382},{21828,0,7396},
+{21830,0,5335},{21839,0,4839},{21843,0,3706},{21846,0,4217},
+{21854,0,5778},{21859,0,7654},{21884,0,6761},{21888,0,3579},
+{21892,0,5421},{21894,6,651},{21897,6,653},{21912,10,655},
+{21916,6,658},{21927,0,7990},{21929,14,660},{21934,0,4195},
+{21957,0,7972},{21959,0,5365},{21972,0,6981},{21978,0,6056},
+{21980,0,4066},{21983,0,7045},{21987,6,664},{22013,6,666},
+{22022,0,7409},{22025,0,3444},{22036,0,3904},{22039,0,5337},
+{22063,0,5501},{22066,0,6786},{22068,0,7318},{22070,0,5694},
+{22099,0,7719},{22120,0,4067},{22123,0,8038},{22132,0,5154},
+{22150,0,7954},{22181,0,5956},{22188,0,5223},{22190,0,7712},
+{22196,0,5927},{22204,0,6511},{22218,0,4152},{22221,0,8039},
+{22225,0,7242},{22234,6,668},{22238,0,7929},{22240,0,6448},
+{22256,0,3774},{22265,6,670},{22275,6,672},{22280,0,3973},
+{22283,0,3947},{22285,0,6288},{22290,6,674},{22294,0,4272},
+{22296,0,4196},{22303,0,7451},{22312,0,6572},{22317,0,3995},
+{22320,0,6945},{22331,0,4068},{22336,0,6946},{22338,0,7491},
+{22343,0,4010},{22346,0,4943},{22349,6,676},{22352,6,678},
+{22369,0,7474},{22372,0,3775},{22374,0,7410},{22378,0,7529},
+{22382,0,4252},{22384,0,3668},{22389,0,3905},{22396,0,7397},
+{22402,0,5571},{22408,0,4251},{22411,0,7774},{22419,0,7688},
+{22432,0,6373},{22434,6,680},{22467,0,5842},{22471,6,682},
+{22475,0,4708},{22478,0,5474},{22495,6,684},{22512,0,7115},
+{22516,0,5720},{22519,0,7032},{22521,6,686},{22524,0,4070},
+{22528,0,3959},{22530,0,4240},{22533,6,688},{22536,10,690},
+{22558,0,7187},{22561,0,5059},{22564,0,6762},{22567,0,5957},
+{22570,0,3512},{22575,10,693},{22580,6,696},{22586,0,3707},
+{22602,6,698},{22607,0,3564},{22609,0,5502},{22612,0,7424},
+{22615,6,700},{22618,0,7252},{22622,0,5362},{22625,6,702},
+{22628,0,7981},{22645,0,6982},{22649,0,7084},{22652,0,6651},
+{22654,0,5629},{22659,0,3669},{22661,0,5373},{22665,0,6179},
+{22675,0,4801},{22684,0,7265},{22686,6,704},{22696,6,706},
+{22702,0,7383},{22707,0,5155},{22714,6,708},{22718,0,3478},
+{22721,0,5022},{22725,0,6090},{22727,0,4197},{22734,0,7982},
+{22737,0,7630},{22739,0,5829},{22741,0,7803},{22744,6,710},
+{22750,6,712},{22756,0,5880},{22763,6,714},{22767,0,6539},
+{22777,10,716},{22781,0,5572},{22799,0,7619},{22804,10,719},
+{22809,6,722},{22812,0,5865},{22818,0,4797},{22823,0,4253},
+{22825,10,724},{22829,6,727},{22833,0,5758},{22839,0,6416},
+{22846,0,7761},{22852,0,5928},{22855,10,729},{22862,14,732},
+{22868,6,736},{22871,0,7466},{22874,0,7689},{22880,0,6652},
+{22882,0,5256},{22887,0,6059},{22890,18,738},{22899,6,743},
+{22904,0,3479},{22909,0,7805},{22914,10,745},{22922,0,6471},
+{22931,0,4073},{22934,6,748},{22937,0,4802},{22949,0,7384},
+{22952,0,4944},{22956,0,7467},{22969,0,4709},{22971,0,7131},
+{22974,0,7188},{22979,0,6710},{22982,0,4767},{22985,0,6486},
+{22987,0,5695},{22992,6,750},{22995,6,752},{23001,6,754},
+{23004,6,756},{23014,0,3480},{23016,0,6417},{23018,0,7017},
+{23020,0,8040},{23022,0,7672},{23032,0,5958},{23035,0,6449},
+{23039,0,6487},{23041,0,6290},{23043,0,6132},{23057,0,5257},
+{23064,0,4153},{23067,6,758},{23071,6,760},{23077,0,5779},
+{23081,0,4672},{23094,0,7319},{23100,0,7096},{23105,0,4565},
+{23110,0,7475},{23113,0,6107},{23130,0,7844},{23138,0,5187},
+{23142,0,5119},{23186,0,4710},{23194,6,762},{23204,0,5696},
+{23233,6,764},{23236,0,6262},{23241,0,7018},{23244,0,7758},
+{23265,0,6621},{23270,0,7673},{23273,0,4181},{23301,0,7865},
+{23305,0,8041},{23307,6,766},{23318,0,7535},{23338,0,5224},
+{23360,0,5338},{23363,0,5881},{23376,6,768},{23380,6,770},
+{23383,6,772},{23386,0,5120},{23388,6,774},{23391,0,4727},
+{23395,6,776},{23401,0,7690},{23403,0,5546},{23408,6,778},
+{23413,0,5121},{23416,0,7631},{23418,0,6315},{23420,0,5923},
+{23429,0,4266},{23431,10,780},{23435,6,783},{23439,0,3864},
+{23443,0,5078},{23445,30,785},{23458,18,793},{23468,0,5476},
+{23470,0,3963},{23472,0,6573},{23475,14,798},{23480,6,802},
+{23487,6,804},{23490,22,806},{23500,0,5122},{23504,0,4711},
+{23506,10,812},{23511,0,4168},{23518,6,815},{23521,6,817},
+{23524,22,819},{23531,6,825},{23534,6,827},{23541,6,829},
+{23544,0,7247},{23546,0,5259},{23553,0,5095},{23556,0,5260},
+{23559,18,831},{23565,10,836},{23569,0,5505},{23574,0,7178},
+{23577,0,5339},{23588,0,6206},{23592,0,4945},{23601,0,7320},
+{23608,18,839},{23614,10,844},{23621,6,847},{23624,0,3960},
+{23627,0,6078},{23629,6,849},{23633,0,5451},{23637,0,6654},
+{23643,0,5044},{23648,0,4276},{23650,0,4566},{23652,6,851},
+{23660,0,5538},{23663,0,4358},{23665,0,5305},{23673,0,8024},
+{23696,6,853},{23713,0,3539},{23721,0,5822},{23723,6,855},
+{23729,0,4255},{23731,0,5794},{23733,0,7806},{23735,6,857},
+{23738,0,4492},{23742,0,6693},{23744,0,5576},{23769,0,7339},
+{23776,0,5340},{23784,0,5780},{23791,5,5096},{23796,0,7735},
+{23798,0,4277},{23803,0,6907},{23805,0,7762},{23815,0,5671},
+{23821,6,859},{23825,0,3776},{23828,0,7263},{23830,6,861},
+{23833,0,4596},{23847,0,5672},{23849,0,5175},{23883,6,863},
+{23888,0,4399},{23913,0,5673},{23916,0,6136},{23919,0,7046},
+{23943,0,3908},{23947,0,4278},{23965,0,4365},{23968,0,3873},
+{23970,0,6147},{23978,0,5931},{23992,0,6003},{23994,0,4493},
+{23996,6,865},{24013,0,6137},{24018,0,4673},{24022,0,5823},
+{24029,6,867},{24033,6,869},{24037,14,871},{24043,0,4813},
+{24046,0,7047},{24049,14,875},{24055,0,7674},{24061,6,879},
+{24066,6,881},{24070,0,5010},{24076,0,8042},{24081,0,7428},
+{24086,0,7189},{24089,0,7019},{24091,0,4990},{24093,0,6763},
+{24101,0,5577},{24107,0,5262},{24109,0,5405},{24115,0,6542},
+{24118,0,4256},{24120,0,5341},{24125,0,4768},{24127,6,883},
+{24132,6,885},{24135,0,4946},{24140,0,7905},{24149,0,4665},
+{24159,0,7340},{24161,10,887},{24178,10,890},{24183,10,893},
+{24187,0,7886},{24188,5,6317},{24190,0,4078},{24196,0,6543},
+{24199,0,5188},{24202,0,5342},{24207,0,5376},{24213,0,6596},
+{24215,0,6694},{24218,0,3670},{24220,0,5123},{24224,0,5343},
+{24230,6,896},{24235,0,3737},{24237,0,6713},{24245,14,898},
+{24254,0,6319},{24258,0,5344},{24264,10,902},{24272,0,3909},
+{24275,0,3815},{24278,0,4554},{24282,6,905},{24287,6,907},
+{24290,6,909},{24300,0,4444},{24307,0,7197},{24310,6,911},
+{24314,6,913},{24321,0,5032},{24324,0,4537},{24330,0,7538},
+{24335,0,5722},{24337,0,5701},{24339,10,915},{24343,6,918},
+{24347,0,6419},{24351,0,6764},{24358,6,920},{24361,0,4171},
+{24369,0,5872},{24373,0,6544},{24378,0,3542},{24380,0,7605},
+{24392,0,7411},{24394,0,3543},{24396,0,4855},{24398,0,4674},
+{24406,6,922},{24409,0,7997},{24411,0,6420},{24418,0,7775},
+{24422,6,924},{24425,18,926},{24432,6,931},{24439,0,4947},
+{24441,0,5949},{24444,0,7597},{24447,10,933},{24453,0,4257},
+{24455,0,5641},{24458,10,936},{24464,10,939},{24471,10,942},
+{24478,0,6839},{24480,6,945},{24488,10,947},{24494,0,4856},
+{24501,0,7038},{24503,0,4267},{24505,0,7170},{24509,0,7998},
+{24515,0,5764},{24517,0,7606},{24524,6,950},{24534,6,952},
+{24536,5,4698},{24544,0,7307},{24555,0,7379},{24565,0,4163},
+{24573,0,7850},{24575,0,5158},{24591,0,5835},{24594,0,4172},
+{24598,0,7552},{24604,6,954},{24608,6,956},{24613,0,4053},
+{24615,6,958},{24618,0,3859},{24623,0,3625},{24641,10,960},
+{24653,0,7907},{24656,0,3792},{24658,0,7675},{24661,0,5379},
+{24665,0,5882},{24669,0,3836},{24674,14,963},{24680,10,967},
+{24684,6,970},{24687,6,972},{24709,0,5985},{24713,0,5761},
+{24716,6,974},{24724,0,7933},{24726,0,7504},{24730,6,976},
+{24735,6,978},{24739,6,980},{24743,0,4619},{24752,0,6840},
+{24754,10,982},{24758,0,4871},{24760,0,3711},{24764,6,985},
+{24773,0,6716},{24775,0,4320},{24785,0,7841},{24794,0,7851},
+{24796,0,5406},{24799,10,987},{24816,6,990},{24819,0,5345},
+{24822,0,7908},{24825,10,992},{24833,0,5578},{24838,0,3606},
+{24840,5,6322},{24845,10,995},{24853,0,5798},{24858,6,998},
+{24863,0,3514},{24871,0,3860},{24880,0,7909},{24884,0,7099},
+{24887,0,3565},{24892,0,5741},{24894,6,1000},{24898,0,6182},
+{24900,0,4601},{24903,6,1002},{24906,10,1004},{24915,0,7579},
+{24917,0,4769},{24920,5,7085},{24925,0,7471},{24927,0,7453},
+{24930,10,1007},{24935,6,1010},{24939,0,6841},{24942,0,4445},
+{24944,0,6292},{24950,6,1012},{24957,6,1014},{24961,6,1016},
+{24970,0,5190},{24974,0,6932},{24976,6,1018},{24980,0,7217},
+{24984,10,1020},{24996,0,5159},{24999,0,4336},{25001,0,3628},
+{25003,6,1023},{25006,0,4814},{25010,0,7723},{25014,0,5913},
+{25018,0,4219},{25022,0,3515},{25027,0,4026},{25031,18,1025},
+{25062,0,4135},{25074,0,7039},{25078,10,1030},{25082,0,7087},
+{25084,0,3910},{25087,6,1033},{25095,6,1035},{25098,0,4816},
+{25100,10,1037},{25104,10,1040},{25110,0,7842},{25114,0,7138},
+{25119,0,4019},{25121,0,3516},{25130,0,6685},{25134,0,4592},
+{25136,6,1043},{25140,0,4258},{25142,0,7808},{25150,14,1045},
+{25159,10,1049},{25163,0,5580},{25165,0,6574},{25171,0,7386},
+{25176,0,7398},{25198,0,5160},{25201,0,4054},{25206,0,5124},
+{25209,0,5192},{25212,0,5852},{25215,6,1052},{25220,0,7218},
+{25225,6,1054},{25233,6,1056},{25237,0,7468},{25239,6,1058},
+{25243,0,7553},{25259,0,7598},{25265,0,7554},{25269,0,6597},
+{25273,0,4690},{25276,6,1060},{25282,0,5174},{25287,10,1062},
+{25292,6,1065},{25295,6,1067},{25298,10,1069},{25302,14,1072},
+{25307,6,1076},{25324,14,1078},{25329,0,3794},{25331,0,3974},
+{25335,0,3738},{25342,6,1082},{25345,0,6948},{25351,0,6949},
+{25353,0,5809},{25361,0,4282},{25387,0,6858},{25391,0,6983},
+{25402,6,1084},{25405,6,1086},{25417,0,7055},{25420,0,7501},
+{25423,6,1088},{25429,0,7555},{25447,6,1090},{25454,0,3590},
+{25458,0,3975},{25463,0,7190},{25466,6,1092},{25471,0,5381},
+{25475,0,5508},{25480,6,1094},{25484,0,6545},{25490,0,4974},
+{25494,0,5853},{25496,0,3961},{25499,0,3853},{25504,10,1096},
+{25509,0,6701},{25511,14,1099},{25536,0,3484},{25540,0,6324},
+{25542,0,3997},{25551,6,1103},{25558,0,6387},{25562,6,1105},
+{25569,0,5799},{25581,6,1107},{25588,0,6266},{25590,6,1109},
+{25613,0,5548},{25615,0,4889},{25620,0,5509},{25622,6,1111},
+{25628,0,5582},{25634,0,6984},{25644,6,1113},{25658,0,8006},
+{25662,0,7056},{25688,0,6623},{25696,0,7256},{25705,0,4656},
+{25711,0,6950},{25720,5,4770},{25722,0,6702},{25736,0,4512},
+{25745,10,1115},{25754,0,4161},{25758,0,4244},{25764,6,1118},
+{25771,0,4818},{25773,6,1120},{25776,0,7062},{25778,0,4890},
+{25787,0,4212},{25793,0,6091},{25796,6,1122},{25799,0,7445},
+{25802,0,3630},{25805,6,1124},{25810,0,4040},{25812,0,4220},
+{25816,0,5023},{25818,0,3591},{25825,6,1126},{25829,10,1128},
+{25836,0,6400},{25842,0,7140},{25844,0,7877},{25850,0,7479},
+{25854,0,6151},{25856,0,4911},{25860,0,7448},{25880,0,5884},
+{25885,0,5471},{25891,0,4467},{25898,10,1131},{25903,0,6951},
+{25910,14,1134},{25915,0,3796},{25918,6,1138},{25925,0,3740},
+{25928,0,7956},{25933,10,1140},{25937,0,3912},{25942,6,1143},
+{25950,0,7100},{25954,6,1145},{25958,0,4321},{25964,6,1147},
+{25970,0,3741},{25972,6,1149},{25975,6,1151},{25982,0,5425},
+{25986,6,1153},{25989,0,7957},{25991,0,4840},{25996,0,5226},
+{26000,6,1155},{26007,0,4349},{26009,0,4555},{26011,6,1157},
+{26015,0,7030},{26017,0,5817},{26020,6,1159},{26023,0,5126},
+{26027,6,1161},{26031,6,1163},{26039,0,4199},{26041,0,4950},
+{26044,6,1165},{26049,0,4951},{26053,0,4447},{26059,6,1167},
+{26063,0,6828},{26066,0,4578},{26071,0,4081},{26080,0,4819},
+{26083,0,4082},{26085,6,1169},{26088,6,1171},{26092,6,1173},
+{26097,0,7638},{26100,0,6209},{26106,0,6127},{26107,5,4875},
+{26109,0,4322},{26111,0,6065},{26118,6,1175},{26121,6,1177},
+{26124,0,7101},{26126,14,1179},{26131,10,1183},{26142,10,1186},
+{26149,0,7300},{26151,6,1189},{26157,0,5510},{26159,10,1191},
+{26164,0,4805},{26166,0,7102},{26170,6,1194},{26177,6,1196},
+{26179,5,7911},{26185,0,6985},{26187,0,6986},{26191,0,5810},
+{26201,0,6908},{26203,0,7738},{26205,10,1198},{26212,22,1201},
+{26219,0,7400},{26222,6,1207},{26227,6,1209},{26230,10,1211},
+{26234,0,6953},{26244,0,7991},{26247,10,1214},{26254,0,6006},
+{26256,6,1217},{26262,10,1219},{26269,0,4752},{26272,0,3742},
+{26274,0,7103},{26283,0,6528},{26286,0,4772},{26290,10,1222},
+{26297,0,5464},{26299,0,3677},{26302,0,4323},{26308,0,5999},
+{26310,6,1225},{26313,0,7958},{26326,0,5845},{26329,0,5384},
+{26332,6,1227},{26336,0,3844},{26342,0,8047},{26352,0,6125},
+{26354,10,1229},{26359,14,1232},{26364,0,4678},{26366,10,1236},
+{26371,0,7936},{26376,6,1239},{26379,0,5176},{26381,0,5080},
+{26388,6,1241},{26391,0,4413},{26395,0,4700},{26397,0,6795},
+{26398,5,4083},{26406,10,1243},{26410,18,1246},{26417,0,6874},
+{26420,0,4891},{26422,0,7388},{26426,0,3984},{26429,0,7975},
+{26438,0,3485},{26441,0,5321},{26446,14,1251},{26451,0,7580},
+{26454,0,6547},{26460,0,4350},{26462,6,1255},{26477,0,7677},
+{26479,10,1257},{26483,0,4806},{26485,0,6598},{26487,0,7480},
+{26491,0,4183},{26494,6,1260},{26503,0,5194},{26505,0,6128},
+{26507,0,4953},{26511,6,1262},{26515,0,4351},{26517,0,7369},
+{26519,0,4647},{26522,0,4713},{26524,6,1264},{26543,6,1266},
+{26547,0,6955},{26550,5,3448},{26552,0,3913},{26558,0,5706},
+{26564,0,5048},{26575,22,1268},{26586,0,6328},{26589,0,7401},
+{26601,0,3914},{26604,0,3486},{26607,10,1274},{26611,14,1277},
+{26619,0,5269},{26622,0,6723},{26642,6,1281},{26646,6,1283},
+{26657,6,1285},{26666,0,6876},{26671,0,6233},{26680,6,1287},
+{26684,6,1289},{26688,14,1291},{26696,0,5811},{26702,0,7020},
+{26704,6,1295},{26707,6,1297},{26733,0,6987},{26742,0,7454},
+{26751,0,3487},{26753,0,4431},{26757,0,4714},{26767,0,3770},
+{26771,6,1299},{26775,0,3679},{26781,0,6796},{26783,0,7959},
+{26785,6,1301},{26791,6,1303},{26797,0,5270},{26799,10,1305},
+{26803,0,5511},{26805,6,1308},{26820,6,1310},{26825,0,4738},
+{26827,0,4086},{26829,0,3779},{26834,0,5099},{26837,0,6842},
+{26839,6,1312},{26842,0,5177},{26847,6,1314},{26855,6,1316},
+{26862,0,5322},{26866,0,5387},{26873,6,1318},{26880,0,6111},
+{26885,0,6401},{26893,6,1320},{26898,0,7221},{26919,0,4753},
+{26928,0,5868},{26941,0,5964},{26943,0,7301},{26954,0,5887},
+{26963,10,1322},{26967,0,3607},{26969,6,1325},{26974,0,4608},
+{26976,0,4147},{26977,5,6329},{26979,0,4859},{26984,0,6724},
+{26987,0,6928},{26989,10,1327},{26997,0,4021},{26999,10,1330},
+{27029,0,6183},{27035,6,1333},{27045,0,7913},{27047,0,5195},
+{27054,0,6008},{27060,0,4580},{27067,0,7426},{27073,0,3744},
+{27075,0,4913},{27083,10,1335},{27088,0,3862},{27112,0,3816},
+{27114,0,3569},{27131,0,3998},{27133,0,6798},{27135,0,4029},
+{27138,0,5800},{27146,0,4997},{27153,0,4432},{27155,0,4567},
+{27159,0,6600},{27161,0,7581},{27166,6,1338},{27169,0,4774},
+{27171,0,5888},{27189,0,7223},{27192,10,1340},{27197,0,6909},
+{27204,0,3519},{27208,0,6153},{27211,0,3878},{27218,6,1343},
+{27224,6,1345},{27231,0,4088},{27233,0,5347},{27243,0,7951},
+{27264,0,4201},{27268,0,3632},{27273,0,6725},{27277,6,1347},
+{27287,0,5024},{27292,0,7937},{27298,6,1349},{27315,0,5227},
+{27323,0,7656},{27330,6,1351},{27347,0,4514},{27354,6,1353},
+{27382,0,7724},{27387,0,5858},{27396,0,4391},{27402,0,3976},
+{27404,0,6550},{27410,0,4392},{27414,0,4402},{27424,6,1355},
+{27427,0,8020},{27442,0,6169},{27450,0,4089},{27453,6,1357},
+{27462,6,1359},{27468,0,3451},{27470,0,7413},{27472,0,3916},
+{27487,0,5937},{27489,22,1361},{27498,0,6133},{27506,0,5494},
+{27511,6,1367},{27515,0,5271},{27519,0,4795},{27523,6,1369},
+{27526,0,7436},{27529,6,1371},{27542,0,5726},{27544,0,6524},
+{27550,0,6240},{27566,6,1373},{27570,0,5465},{27573,0,4202},
+{27575,0,6376},{27578,0,5317},{27580,0,3470},{27583,0,6659},
+{27585,0,7996},{27589,6,1375},{27595,0,4822},{27597,0,4775},
+{27599,0,4715},{27602,10,1377},{27606,9,5197},{27611,0,4776},
+{27627,6,1380},{27656,0,6660},{27663,0,5774},{27665,0,4877},
+{27667,0,4728},{27683,0,4090},{27700,0,5587},{27703,6,1382},
+{27710,0,5012},{27712,10,1384},{27726,0,5013},{27728,0,5410},
+{27733,0,5307},{27735,0,7639},{27738,0,6068},{27741,14,1387},
+{27752,0,3784},{27754,0,6129},{27757,0,6034},{27760,0,7437},
+{27762,0,4055},{27766,0,4841},{27770,0,3649},{27773,6,1391},
+{27777,10,1393},{27781,14,1396},{27788,0,4324},{27792,0,4789},
+{27794,18,1400},{27801,10,1405},{27819,0,4692},{27822,0,6601},
+{27827,0,7622},{27832,6,1408},{27835,18,1410},{27841,6,1415},
+{27844,0,5453},{27849,6,1417},{27852,0,7607},{27859,0,7856},
+{27861,0,5018},{27863,0,5273},{27867,0,5014},{27873,10,1419},
+{27877,0,4187},{27880,0,6877},{27883,0,7739},{27886,10,1422},
+{27891,0,6010},{27915,6,1425},{27921,0,5064},{27927,0,5495},
+{27929,0,5588},{27931,0,4382},{27934,0,4340},{27941,0,6990},
+{27943,0,6332},{27945,6,1427},{27954,0,6878},{27957,6,1429},
+{27960,6,1431},{27963,0,7899},{27965,6,1433},{27969,0,4581},
+{27993,6,1435},{27996,0,5229},{28003,0,6112},{28006,0,7557},
+{28009,6,1437},{28012,0,4622},{28014,0,5127},{28020,0,6170},
+{28023,10,1439},{28031,0,7507},{28037,0,5986},{28039,10,1442},
+{28044,10,1445},{28049,0,5540},{28051,0,5968},{28053,0,7207},
+{28079,0,5846},{28082,0,5854},{28085,0,7657},{28096,0,6728},
+{28099,18,1448},{28107,0,4648},{28111,0,7814},{28113,0,5633},
+{28120,10,1453},{28126,0,5556},{28129,0,4222},{28136,0,6729},
+{28138,6,1456},{28142,0,7938},{28145,0,5766},{28147,0,5650},
+{28149,0,5969},{28151,18,1458},{28183,0,5323},{28185,10,1463},
+{28191,10,1466},{28195,14,1469},{28203,10,1473},{28207,0,7680},
+{28210,0,5427},{28212,0,3503},{28214,0,6011},{28216,0,6333},
+{28218,0,4807},{28220,10,1476},{28227,6,1479},{28234,0,6879},
+{28237,0,4203},{28246,0,7815},{28248,0,5348},{28251,6,1481},
+{28254,6,1483},{28263,0,6185},{28267,0,7271},{28270,6,1485},
+{28274,6,1487},{28282,0,5065},{28304,0,6270},{28310,0,6911},
+{28316,6,1489},{28319,0,4754},{28322,0,6465},{28325,0,5128},
+{28330,6,1491},{28335,0,5514},{28337,0,6991},{28342,0,6186},
+{28346,0,4189},{28354,0,4955},{28356,6,1493},{28361,0,7916},
+{28363,6,1495},{28366,0,7777},{28369,0,7900},{28371,6,1497},
+{28399,0,7208},{28404,0,6625},{28408,0,7816},{28414,6,1499},
+{28417,6,1501},{28422,0,7366},{28431,0,4569},{28433,0,3570},
+{28436,6,1503},{28448,0,4666},{28450,6,1505},{28459,6,1507},
+{28465,6,1509},{28472,0,6695},{28479,0,6551},{28481,0,6012},
+{28497,0,4934},{28500,0,3650},{28503,6,1511},{28506,6,1513},
+{28510,6,1515},{28514,0,7917},{28516,0,6362},{28525,6,1517},
+{28528,0,3986},{28538,0,6525},{28540,10,1519},{28545,0,5328},
+{28548,0,7040},{28552,0,7172},{28557,6,1522},{28560,0,6241},
+{28564,0,7817},{28567,0,3488},{28579,6,1524},{28583,0,4507},
+{28590,6,1526},{28593,0,6661},{28595,0,6069},{28601,0,4225},
+{28606,0,4213},{28608,14,1528},{28618,0,6035},{28629,0,5677},
+{28634,0,6013},{28639,10,1532},{28644,0,4291},{28649,0,7819},
+{28651,6,1535},{28655,0,7403},{28657,0,5230},{28670,0,4449},
+{28673,0,5890},{28677,6,1537},{28681,0,5275},{28683,0,5767},
+{28687,0,4583},{28689,0,7574},{28693,0,5231},{28696,0,4516},
+{28698,22,1539},{28707,0,7695},{28711,6,1545},{28719,0,6015},
+{28727,0,6437},{28734,0,4393},{28748,0,3825},{28752,6,1547},
+{28760,0,7414},{28765,0,7820},{28771,0,4681},{28779,0,7867},
+{28784,0,7940},{28792,0,3921},{28796,6,1549},{28805,0,3681},
+{28810,0,7321},{28814,0,5991},{28818,0,7224},{28824,10,1551},
+{28833,0,6733},{28836,0,5516},{28843,10,1554},{28847,0,7780},
+{28851,0,5050},{28855,10,1557},{28872,0,4481},{28875,0,8007},
+{28879,0,6070},{28888,6,1560},{28893,0,6935},{28895,0,5971},
+{28913,0,3682},{28921,0,7515},{28925,0,5100},{28932,0,7983},
+{28937,0,5920},{28940,0,6913},{28953,6,1562},{28958,0,4325},
+{28961,0,4823},{28966,0,7225},{28976,0,5992},{28982,0,5972},
+{28999,0,8001},{29001,6,1564},{29004,0,7918},{29006,0,6662},
+{29008,0,6016},{29014,0,4141},{29017,0,5973},{29020,0,6234},
+{29022,0,5318},{29028,14,1566},{29033,0,4998},{29036,0,5891},
+{29038,0,6495},{29053,0,5428},{29060,0,5728},{29065,6,1570},
+{29071,0,7984},{29074,0,7781},{29076,0,6187},{29081,0,8048},
+{29087,0,5635},{29090,0,5101},{29100,0,6071},{29105,0,5987},
+{29113,5,8049},{29118,0,7345},{29121,0,6000},{29123,0,5974},
+{29128,6,1572},{29134,0,4556},{29136,0,4640},{29138,0,5517},
+{29140,6,1574},{29151,0,6017},{29157,10,1576},{29165,6,1579},
+{29179,6,1581},{29182,10,1583},{29190,0,7575},{29200,0,4517},
+{29211,0,4394},{29226,0,6803},{29228,6,1586},{29232,0,6271},
+{29234,0,6295},{29237,6,1588},{29242,6,1590},{29245,6,1592},
+{29248,0,5350},{29254,10,1594},{29260,0,7508},{29266,0,7191},
+{29272,6,1597},{29275,0,6210},{29277,0,5232},{29279,0,4777},
+{29281,6,1599},{29287,0,4790},{29289,0,4850},{29298,0,5369},
+{29305,0,7472},{29309,0,3638},{29312,6,1601},{29346,0,4312},
+{29351,0,8051},{29356,0,3639},{29359,0,5015},{29376,0,5351},
+{29378,0,3847},{29380,0,6626},{29390,0,5831},{29392,0,7821},
+{29399,0,3922},{29401,0,6603},{29409,0,3879},{29417,0,5591},
+{29432,6,1603},{29436,6,1605},{29450,0,6036},{29462,0,7107},
+{29467,10,1607},{29477,0,6138},{29481,10,1610},{29494,5,6335},
+{29502,6,1613},{29508,6,1615},{29520,0,6553},{29522,0,6072},
+{29527,0,3980},{29544,0,4313},{29546,0,7941},{29552,0,6018},
+{29554,0,7949},{29557,0,4488},{29560,0,5592},{29562,6,1617},
+{29572,0,7741},{29574,6,1619},{29577,0,6081},{29579,0,6130},
+{29582,0,6734},{29588,0,7156},{29590,10,1621},{29599,0,4879},
+{29607,0,6363},{29609,0,6113},{29613,0,5233},{29618,6,1624},
+{29625,0,7742},{29632,0,4894},{29634,0,3452},{29641,6,1626},
+{29644,6,1628},{29647,0,3471},{29654,0,3848},{29657,0,3797},
+{29661,6,1630},{29664,0,6882},{29667,14,1632},{29673,6,1636},
+{29677,0,4916},{29687,0,4824},{29689,0,5483},{29693,6,1638},
+{29697,0,5429},{29699,0,3924},{29701,10,1640},{29705,0,4584},
+{29715,0,6114},{29723,0,7372},{29728,10,1643},{29733,6,1646},
+{29736,0,3781},{29738,10,1648},{29742,10,1651},{29747,14,1654},
+{29752,0,7405},{29754,0,5019},{29759,10,1658},{29763,6,1661},
+{29771,0,6296},{29781,0,7623},{29783,0,6273},{29785,14,1663},
+{29790,10,1667},{29794,0,6188},{29796,6,1670},{29800,10,1672},
+{29807,0,4417},{29822,0,4030},{29826,6,1675},{29831,0,5431},
+{29833,0,4470},{29835,0,6554},{29848,0,4641},{29852,0,7919},
+{29854,6,1677},{29857,0,6994},{29859,0,4098},{29861,0,3684},
+{29863,6,1679},{29866,0,6804},{29872,0,7894},{29874,0,5594},
+{29877,0,5939},{29881,0,5637},{29885,0,5363},{29887,0,5432},
+{29894,0,7021},{29898,0,3685},{29903,0,4540},{29908,0,6020},
+{29912,0,3827},{29914,0,7066},{29916,0,3806},{29920,0,7824},
+{29922,6,1681},{29926,0,6100},{29934,0,6092},{29943,0,6497},
+{29953,0,5051},{29956,0,3640},{29969,0,6936},{29973,0,6093},
+{29976,0,3521},{29978,6,1683},{29983,0,5370},{29987,0,5309},
+{29989,6,1685},{29992,0,6189},{29995,6,1687},{30000,14,1689},
+{30007,6,1693},{30010,0,6736},{30023,0,4011},{30028,0,3717},
+{30031,0,6139},{30033,0,6666},{30035,6,1695},{30041,0,4586},
+{30043,10,1697},{30050,0,7609},{30053,6,1700},{30058,0,5000},
+{30063,6,1702},{30069,6,1704},{30072,0,4099},{30074,0,3546},
+{30079,0,4100},{30086,6,1706},{30090,6,1708},{30094,6,1710},
+{30097,0,6403},{30109,0,5310},{30117,0,3571},{30123,0,5951},
+{30129,10,1712},{30133,0,6498},{30136,6,1715},{30140,10,1717},
+{30146,0,3453},{30149,0,5052},{30151,0,6937},{30157,0,6425},
+{30162,0,5892},{30164,6,1720},{30168,6,1722},{30171,0,7455},
+{30178,0,4627},{30192,0,4226},{30194,0,4658},{30196,0,7347},
+{30202,0,5202},{30204,0,3746},{30208,0,5906},{30221,0,5893},
+{30233,0,5521},{30239,14,1724},{30244,0,4587},{30246,0,5595},
+{30267,0,4570},{30274,0,4557},{30284,0,5826},{30286,0,3489},
+{30290,0,6339},{30294,0,5026},{30305,0,7348},{30308,0,6688},
+{30313,0,4376},{30316,0,5433},{30320,0,6094},{30322,0,6667},
+{30328,0,3718},{30331,6,1728},{30333,5,4993},{30340,0,6627},
+{30342,6,1730},{30350,0,3880},{30352,0,3747},{30355,0,7825},
+{30382,0,7600},{30394,0,7272},{30399,0,4755},{30402,6,1732},
+{30406,0,5164},{30408,0,6021},{30410,0,6438},{30418,0,7665},
+{30422,0,3573},{30427,6,1734},{30430,6,1736},{30433,0,6997},
+{30435,6,1738},{30439,0,4518},{30446,0,4791},{30450,0,4730},
+{30452,0,6975},{30456,0,5352},{30460,0,4920},{30462,0,5652},
+{30465,0,5485},{30468,0,4740},{30472,6,1740},{30475,0,3490},
+{30494,0,6998},{30496,0,4741},{30505,0,7744},{30519,6,1742},
+{30522,0,6805},{30524,0,5812},{30528,0,7057},{30541,0,7745},
+{30555,0,6737},{30561,0,5596},{30563,0,4314},{30566,0,4792},
+{30571,0,7193},{30585,0,4294},{30590,6,1744},{30603,0,6999},
+{30609,0,4756},{30622,0,4682},{30629,0,5038},{30636,6,1746},
+{30640,0,3524},{30643,0,4343},{30651,6,1748},{30655,0,3925},
+{30679,0,7244},{30683,6,1750},{30690,6,1752},{30693,0,6960},
+{30697,0,3926},{30701,10,1754},{30707,0,5413},{30722,0,5277},
+{30738,0,5203},{30757,10,1757},{30764,0,4652},{30770,0,7559},
+{30772,0,7485},{30789,0,4000},{30799,0,5976},{30813,0,7226},
+{30827,6,1760},{30831,0,5977},{30844,0,5178},{30849,0,4101},
+{30855,0,6738},{30860,10,1762},{30865,0,5204},{30871,0,6116},
+{30883,0,3504},{30887,0,5027},{30889,0,5414},{30906,5,7879},
+{30908,0,4659},{30913,0,6499},{30917,0,4956},{30922,6,1765},
+{30926,0,3719},{30928,0,4921},{30952,0,4660},{30956,0,3688},
+{30959,0,4102},{30965,0,3491},{30971,0,4922},{30977,0,7227},
+{30990,0,7228},{30998,0,5940},{31018,10,1767},{31034,0,5710},
+{31038,0,5278},{31040,6,1770},{31047,5,4104},{31049,0,6962},
+{31056,0,6214},{31062,6,1772},{31066,18,1774},{31072,0,5280},
+{31077,0,5353},{31080,0,7584},{31085,0,6769},{31098,0,4106},
+{31103,0,4529},{31105,0,4044},{31117,10,1779},{31121,0,6215},
+{31142,6,1782},{31146,0,5434},{31150,0,4508},{31153,0,4295},
+{31155,0,5894},{31161,0,6216},{31165,18,1784},{31177,10,1789},
+{31185,6,1792},{31189,0,5205},{31192,0,5206},{31199,0,6808},
+{31204,0,7377},{31206,6,1794},{31209,0,7023},{31227,0,6426},
+{31232,0,8053},{31237,0,5496},{31240,0,3492},{31243,0,6740},
+{31245,0,7230},{31252,0,6474},{31255,0,7510},{31257,6,1796},
+{31260,0,4609},{31263,6,1798},{31278,0,6845},{31281,0,7378},
+{31286,6,1800},{31291,10,1802},{31295,6,1805},{31302,0,4793},
+{31305,0,7350},{31309,6,1807},{31319,0,5598},{31329,6,1809},
+{31337,0,6086},{31339,0,7881},{31344,0,5895},{31348,0,7755},
+{31350,0,3927},{31353,6,1811},{31357,0,6741},{31359,0,7157},
+{31361,0,4330},{31364,0,7058},{31368,0,6156},{31378,6,1813},
+{31381,0,6810},{31384,0,3954},{31391,0,3962},{31401,5,6101},
+{31406,6,1815},{31418,0,4001},{31428,6,1817},{31431,0,4353},
+{31434,6,1819},{31447,0,4809},{31449,0,7089},{31453,0,5054},
+{31455,6,1821},{31459,0,6915},{31461,0,4344},{31466,0,5599},
+{31469,0,3505},{31471,0,4205},{31478,0,3690},{31481,6,1823},
+{31487,0,3493},{31503,0,7852},{31505,0,5522},{31513,0,5372},
+{31515,0,6629},{31518,0,7439},{31520,0,4654},{31526,0,5130},
+{31532,6,1825},{31545,0,5497},{31558,0,7611},{31561,0,4369},
+{31563,10,1827},{31567,14,1830},{31572,0,4236},{31574,0,7128},
+{31584,0,4012},{31596,0,5486},{31598,0,5390},{31605,0,5978},
+{31613,0,6073},{31623,0,3574},{31627,0,6669},{31631,0,6588},
+{31636,6,1834},{31639,0,5311},{31642,0,7051},{31645,0,3656},
+{31649,0,3828},{31661,0,6670},{31665,0,5354},{31668,0,6530},
+{31672,0,6606},{31680,6,1836},{31684,0,5016},{31686,6,1838},
+{31689,0,7293},{31698,0,5729},{31712,0,5523},{31716,0,4316},
+{31721,0,5282},{31751,0,6829},{31762,0,7068},{31774,0,4206},
+{31777,0,3494},{31783,0,7922},{31786,6,1840},{31805,10,1842},
+{31811,0,4404},{31820,6,1845},{31840,0,4541},{31844,0,7184},
+{31852,0,4628},{31859,0,4863},{31875,0,5207},{31881,0,5165},
+{31890,0,4655},{31893,0,4897},{31895,6,1847},{31903,0,5541},
+{31909,0,6901},{31911,0,6556},{31918,0,4433},{31921,10,1849},
+{31929,0,5600},{31934,0,6742},{31946,0,7827},{31958,0,4247},
+{31966,10,1852},{31975,0,4435},{31995,0,3721},{31998,0,4003},
+{32000,0,4108},{32002,0,6885},{32004,18,1855},{32010,5,4842},
+{32013,0,4150},{32016,0,4184},{32020,0,5655},{32023,18,1860},
+{32032,10,1865},{32043,6,1868},{32046,10,1870},{32051,0,5747},
+{32053,0,6607},{32057,6,1873},{32066,18,1875},{32080,0,3651},
+{32094,0,3882},{32097,6,1880},{32102,0,4057},{32104,0,6371},
+{32106,0,6454},{32110,0,5391},{32113,10,1882},{32118,0,6691},
+{32121,0,3641},{32127,0,3928},{32142,6,1885},{32147,0,3692},
+{32156,0,6847},{32160,0,4530},{32162,0,6887},{32172,6,1887},
+{32177,6,1889},{32180,6,1891},{32184,0,4598},{32186,6,1893},
+{32189,10,1895},{32199,0,7351},{32202,6,1898},{32214,0,5392},
+{32216,0,7658},{32218,0,5435},{32221,6,1900},{32224,6,1902},
+{32227,0,5979},{32232,6,1904},{32236,0,4743},{32239,0,6297},
+{32244,0,4471},{32251,0,7352},{32265,6,1906},{32277,0,6087},
+{32283,0,4898},{32285,10,1908},{32289,0,6581},{32291,0,7748},
+{32299,0,5103},{32302,6,1911},{32305,0,6848},{32311,0,4572},
+{32317,6,1913},{32321,0,5001},{32323,0,5179},{32326,6,1915},
+{32338,0,6938},{32340,6,1917},{32350,0,6159},{32353,0,5603},
+{32361,10,1919},{32365,0,3642},{32368,0,6814},{32377,0,5952},
+{32380,0,3723},{32386,0,7069},{32396,0,5542},{32399,0,6672},
+{32403,0,6023},{32406,0,5466},{32408,0,7071},{32411,6,1922},
+{32566,0,5132},{32568,0,7681},{32570,0,3652},{32588,0,5859},
+{32592,0,3829},{32596,6,1924},{32618,6,1926},{32622,0,7353},
+{32624,0,5007},{32626,0,5393},{32629,0,4717},{32631,0,7486},
+{32633,0,4629},{32645,0,4377},{32648,0,4110},{32650,0,5896},
+{32652,0,3551},{32654,0,4864},{32660,0,3750},{32666,0,4497},
+{32670,0,5604},{32676,0,3955},{32680,6,1928},{32690,0,8054},
+{32696,6,1930},{32701,0,6218},{32705,0,6095},{32709,0,5711},
+{32714,0,6439},{32716,0,6440},{32718,0,4498},{32722,0,5679},
+{32724,6,1932},{32735,10,1934},{32745,0,7524},{32747,0,6118},
+{32752,0,7644},{32761,0,3883},{32764,0,6441},{32768,6,1937},
+{32771,0,3751},{32773,6,1939},{32777,0,3929},{32780,0,6427},
+{32784,0,4158},{32789,0,3693},{32791,6,1941},{32813,0,4112},
+{32819,0,6428},{32822,0,5870},{32829,0,7422},{32831,0,3694},
+{32835,0,4227},{32838,0,4499},{32842,0,4559},{32854,0,5487},
+{32856,0,5239},{32858,0,7323},{32862,0,4844},{32879,6,1943},
+{32882,6,1945},{32887,0,6979},{32893,10,1947},{32900,14,1950},
+{32905,0,6357},{32907,6,1954},{32918,0,7231},{32923,0,7682},
+{32925,0,3495},{32929,6,1956},{32933,0,5210},{32937,6,1958},
+{32943,0,4061},{32945,6,1960},{32948,0,7963},{32954,0,7540},
+{32963,6,1962},{32972,0,4979},{32974,0,7440},{32986,6,1964},
+{32990,0,7560},{32993,0,7829},{32996,6,1966},{33009,0,3850},
+{33012,0,4345},{33016,0,8017},{33021,0,4185},{33026,0,6966},
+{33029,14,1968},{33034,0,7144},{33048,0,6119},{33050,6,1972},
+{33059,0,5656},{33065,0,5605},{33067,0,7419},{33071,0,7561},
+{33081,0,7110},{33086,0,5211},{33099,0,5856},{33102,0,5748},
+{33104,5,5133},{33108,6,1974},{33125,6,1976},{33131,0,6849},
+{33136,6,1978},{33144,10,1980},{33151,6,1983},{33160,0,3634},
+{33162,0,4899},{33167,0,3753},{33178,0,5135},{33180,6,1985},
+{33184,0,3884},{33187,0,7025},{33192,0,7516},{33203,0,5439},
+{33205,0,7313},{33210,0,6392},{33213,14,1987},{33218,0,5212},
+{33222,0,5916},{33229,0,6771},{33240,0,4410},{33247,0,6558},
+{33251,0,5749},{33253,0,6103},{33255,6,1991},{33258,0,6502},
+{33261,0,7325},{33267,6,1993},{33274,10,1995},{33278,0,6341},
+{33285,0,3931},{33287,6,1998},{33290,0,3932},{33292,6,2000},
+{33298,0,5395},{33307,6,2002},{33310,6,2004},{33313,0,3553},
+{33322,10,2006},{33333,10,2009},{33337,0,5440},{33344,0,5136},
+{33349,0,5942},{33351,0,6744},{33369,0,7111},{33380,0,6406},
+{33382,0,7659},{33390,6,2012},{33393,6,2014},{33398,0,5994},
+{33400,0,7232},{33406,0,5848},{33419,0,6219},{33421,6,2016},
+{33426,0,4703},{33433,6,2018},{33437,0,6968},{33439,0,5324},
+{33445,6,2020},{33449,0,4046},{33452,14,2022},{33457,0,7871},
+{33459,0,4961},{33463,10,2026},{33467,10,2029},{33471,0,6482},
+{33489,6,2032},{33492,6,2034},{33495,0,4810},{33499,0,3455},
+{33502,6,2036},{33505,0,6430},{33509,10,2038},{33521,0,6024},
+{33533,6,2041},{33537,18,2043},{33545,0,4693},{33559,0,4757},
+{33576,0,6503},{33579,0,4704},{33583,0,5083},{33585,0,5606},
+{33588,10,2048},{33592,6,2051},{33600,0,5658},{33607,0,7708},
+{33609,6,2053},{33615,0,6475},{33617,6,2055},{33651,0,4354},
+{33655,0,7624},{33659,0,6633},{33673,6,2057},{33678,0,5287},
+{33686,0,3696},{33688,0,5750},{33694,0,6121},{33698,0,7768},
+{33705,10,2059},{33725,0,4705},{33729,0,7201},{33733,0,3830},
+{33737,6,2062},{33740,0,4013},{33747,0,3808},{33750,0,7112},
+{33756,0,7122},{33769,0,5069},{33771,0,4033},{33775,14,2064},
+{33780,0,5827},{33785,0,6609},{33789,0,5639},{33795,6,2068},
+{33802,0,4423},{33804,10,2070},{33833,0,7275},{33836,0,4683},
+{33841,0,7993},{33848,0,6342},{33853,0,4386},{33865,0,6001},
+{33879,0,6610},{33883,0,3506},{33889,0,7563},{33891,0,4346},
+{33894,0,6300},{33899,6,2073},{33903,0,5875},{33909,0,4004},
+{33914,0,6930},{33936,0,5607},{33940,0,5712},{33945,0,4799},
+{33948,0,5312},{33953,0,4962},{33970,0,7564},{33976,0,6939},
+{33979,6,2075},{33983,6,2077},{33986,0,4758},{33988,0,7295},
+{33990,0,5415},{33993,0,6193},{33995,0,3576},{33997,0,5713},
+{34001,0,5288},{34010,0,5608},{34028,0,5104},{34030,0,4473},
+{34036,0,5659},{34044,0,4560},{34065,0,4747},{34067,6,2079},
+{34071,6,2081},{34074,0,6250},{34078,0,4573},{34081,0,7123},
+{34083,0,6562},{34085,0,7259},{34092,6,2083},{34095,0,7004},
+{34109,0,7541},{34111,0,6301},{34113,0,4229},{34115,0,5002},
+{34121,0,7235},{34126,0,3885},{34131,0,6245},{34137,0,7796},
+{34147,0,5660},{34152,10,2085},{34157,0,5528},{34180,0,4901},
+{34183,0,4865},{34191,0,6407},{34193,0,3554},{34196,0,6563},
+{34203,0,5457},{34214,0,7159},{34216,10,2088},{34223,6,2091},
+{34234,0,6772},{34241,0,3757},{34249,0,6505},{34253,10,2093},
+{34261,0,6220},{34268,6,2096},{34276,6,2098},{34281,6,2100},
+{34295,0,6611},{34298,6,2102},{34303,0,3817},{34306,0,6041},
+{34310,6,2104},{34314,0,6088},{34326,6,2106},{34330,0,5441},
+{34349,0,4395},{34367,0,4378},{34382,0,7833},{34384,0,7632},
+{34388,6,2108},{34395,6,2110},{34398,6,2112},{34407,0,8009},
+{34425,0,7860},{34442,0,4845},{34444,0,4963},{34451,0,6456},
+{34467,6,2114},{34473,0,7355},{34503,0,5289},{34507,0,4208},
+{34516,0,7945},{34521,0,6104},{34523,0,6889},{34527,0,3886},
+{34532,0,7666},{34541,0,7026},{34558,0,5785},{34560,0,7245},
+{34562,6,2116},{34568,0,6074},{34584,0,6970},{34586,0,5214},
+{34588,0,4884},{34638,0,3508},{34645,0,5730},{34647,0,7924},
+{34655,0,6302},{34662,0,7625},{34664,0,5676},{34676,0,7835},
+{34678,0,6703},{34680,0,6105},{34690,0,4418},{34701,0,6372},
+{34719,0,4759},{34722,0,7785},{34739,0,4248},{34746,0,4379},
+{34756,0,7376},{34784,0,4926},{34796,0,5442},{34799,0,6162},
+{34802,0,7309},{34809,0,7696},{34811,0,6408},{34814,0,5467},
+{34821,0,5690},{34847,0,4411},{34850,6,2118},{34865,0,3758},
+{34870,0,6532},{34875,0,4685},{34880,0,7756},{34886,0,6924},
+{34892,6,2120},{34898,6,2122},{34903,0,3457},{34905,0,5786},
+{34907,0,6303},{34909,0,7310},{34913,10,2124},{34920,0,7585},
+{34923,0,5326},{34928,0,5565},{34930,0,4151},{34935,0,7311},
+{34942,5,4047},{34945,6,2127},{34952,0,3458},{34955,0,4262},
+{34957,0,7565},{34962,0,4209},{34966,6,2129},{34974,0,3782},
+{34987,0,7601},{34996,0,3759},{35009,6,2131},{35023,0,4632},
+{35028,6,2133},{35033,0,3956},{35036,6,2135},{35039,0,5290},
+{35041,0,4633},{35048,0,5215},{35059,0,5356},{35060,5,4981},
+{35064,0,4380},{35069,0,6773},{35079,0,5085},{35088,0,3507},
+{35090,6,2137},{35096,6,2139},{35109,0,6172},{35114,0,7462},
+{35126,0,5680},{35128,0,4574},{35131,0,5458},{35137,0,3555},
+{35140,0,5897},{35167,0,4049},{35172,0,4407},{35178,0,4694},
+{35186,0,5681},{35199,0,5397},{35201,0,6163},{35203,0,4230},
+{35206,6,2141},{35211,0,3644},{35215,0,4005},{35219,0,4734},
+{35222,0,5714},{35233,0,3635},{35241,6,2143},{35250,0,4034},
+{35258,0,3473},{35261,0,4408},{35264,0,3831},{35282,0,3474},
+{35299,0,7697},{35316,0,5357},{35320,0,7246},{35328,0,5921},
+{35330,6,2145},{35336,0,3724},{35338,0,5754},{35340,0,7861},
+{35342,0,7452},{35347,0,7987},{35350,10,2147},{35355,0,6106},
+{35357,0,5787},{35359,0,5557},{35363,0,3653},{35365,0,4182},
+{35370,0,4964},{35373,0,5459},{35377,0,7722},{35380,0,5530},
+{35382,0,3459},{35386,6,2150},{35408,0,5291},{35412,6,2152},
+{35419,0,6612},{35422,0,5292},{35424,0,6025},{35426,6,2154},
+{35430,0,5715},{35433,0,5716},{35437,6,2156},{35440,14,2158},
+{35445,0,5443},{35449,0,7185},{35461,0,6891},{35463,0,3809},
+{35468,6,2162},{35475,0,5398},{35477,0,7417},{35480,0,6344},
+{35486,0,5908},{35488,6,2164},{35491,14,2166},{35496,0,7946},
+{35498,0,5460},{35504,0,5611},{35506,0,3810},{35513,0,5216},
+{35516,0,6410},{35518,6,2170},{35522,0,7186},{35524,0,5662},
+{35527,0,4231},{35531,0,7202},{35533,0,6589},{35535,0,7276},
+{35538,0,4437},{35542,0,4535},{35547,6,2172},{35553,0,5717},
+{35558,6,2174},{35562,6,2176},{35565,6,2178},{35569,0,8002},
+{35574,10,2180},{35578,0,5922},{35582,0,4139},{35584,10,2183},
+{35588,0,4371},{35598,0,4866},{35600,0,4885},{35604,0,7633},
+{35606,6,2186},{35609,10,2188},{35613,0,5293},{35616,0,6164},
+{35624,0,4786},{35627,6,2191},{35635,0,3935},{35641,0,4035},
+{35649,0,7874},{35657,0,6940},{35662,6,2193},{35672,0,5731},
+{35674,0,4232},{35676,0,5072},{35686,0,3697},{35692,0,5217},
+{35695,6,2195},{35700,0,3645},{35703,0,7836},{35709,0,6044},
+{35712,0,4318},{35722,0,5033},{35728,0,5612},{35730,6,2197},
+{35734,0,7091},{35738,0,7072},{35895,0,3772},{35903,0,3726},
+{35905,0,7902},{35910,0,4355},{35912,0,4116},{35914,0,7594},
+{35916,0,6122},{35925,0,5718},{35930,0,4327},{35937,0,5359},
+{35946,6,2199},{35961,6,2201},{35970,0,7236},{35978,0,4723},
+{35980,0,4787},{35997,6,2203},{36000,10,2205},{36007,22,2208},
+{36015,6,2214},{36019,6,2216},{36022,10,2218},{36027,10,2221},
+{36031,22,2224},{36039,6,2230},{36042,0,6635},{36049,0,7007},
+{36051,0,5235},{36058,0,4548},{36060,0,5294},{36062,0,5360},
+{36064,0,4984},{36066,10,2232},{36070,0,5141},{36074,0,7027},
+{36077,0,4299},{36084,0,4549},{36091,10,2235},{36100,6,2238},
+{36103,6,2240},{36106,0,7073},{36109,0,5468},{36115,0,6566},
+{36118,0,5544},{36196,0,6636},{36198,0,5295},{36203,0,7732},
+{36208,0,6892},{36211,6,2242},{36215,0,4117},{36229,0,7237},
+{36234,0,6282},{36249,0,6820},{36259,0,7326},{36264,0,7277},
+{36275,0,6830},{36282,0,5144},{36286,0,6973},{36294,0,7442},
+{36299,6,2244},{36303,0,3461},{36315,0,7488},{36317,0,3596},
+{36321,0,6637},{36323,0,5444},{36328,0,3811},{36335,0,4522},
+{36339,0,4300},{36362,0,6194},{36367,6,2246},{36382,0,3597},
+{36394,0,6850},{36400,0,6347},{36405,0,6851},{36418,0,6348},
+{36420,0,6775},{36423,14,2248},{36441,0,7296},{36447,6,2252},
+{36468,0,7297},{36470,0,3982},{36481,0,6821},{36487,0,6614},
+{36490,0,6893},{36493,0,5878},{36522,10,2254},{36544,0,3937},
+{36554,14,2257},{36562,0,7726},{36575,0,5982},{36587,0,7008},
+{36600,0,7298},{36603,0,3462},{36606,0,5732},{36611,0,3887},
+{36613,0,4523},{36617,0,6584},{36626,14,2261},{36635,18,2265},
+{36646,6,2270},{36649,6,2272},{36655,0,7035},{36659,0,6894},
+{36664,6,2274},{36667,0,5088},{36670,6,2276},{36676,6,2278},
+{36681,0,6675},{36685,6,2280},{36701,0,5945},{36703,0,3867},
+{36706,0,4463},{36763,6,2282},{36771,0,4398},{36774,0,7496},
+{36776,0,5034},{36781,0,5296},{36783,14,2284},{36802,0,6222},
+{36805,0,5757},{36814,0,6026},{36817,0,4036},{36820,0,4927},
+{36838,0,3463},{36842,6,2288},{36845,0,7029},{36848,0,5669},
+{36850,0,3626},{36855,0,4867},{36857,0,6640},{36861,0,7278},
+{36864,14,2290},{36869,6,2294},{36872,0,7787},{36875,0,7567},
+{36877,0,5531},{36879,10,2296},{36884,6,2299},{36887,0,4356},
+{36889,6,2301},{36893,26,2303},{36910,0,7211},{36913,6,2310},
+{36917,0,4007},{36920,0,6466},{36924,0,7615},{36926,0,6350},
+{36929,6,2312},{36935,0,6223},{36938,6,2314},{36941,6,2316},
+{36944,6,2318},{36947,10,2320},{36953,0,6165},{36956,10,2323},
+{36960,6,2326},{36963,0,3646},{36969,0,6641},{36973,10,2328},
+{36978,0,6974},{36981,0,6918},{36983,6,2331},{36986,0,6351},
+{36988,6,2333},{36991,22,2335},{36999,6,2341},{37002,0,5036},
+{37007,0,4381},{37009,0,6389},{37013,0,6096},{37017,0,4707},
+{37026,6,2343},{37030,0,4966},{37032,0,7250},{37034,0,5297},
+{37039,10,2345},{37045,0,5533},{37048,0,6616},{37057,0,6236},
+{37066,0,3889},{37086,0,4419},{37089,0,3958},{37096,0,5145},
+{37101,0,3818},{37109,0,6224},{37117,0,4305},{37122,0,5802},
+{37138,0,7279},{37141,0,7714},{37145,0,5219},{37159,0,4372},
+{37165,0,6748},{37170,0,4210},{37193,22,2348},{37202,0,6897},
+{37218,0,7238},{37225,6,2354},{37228,0,5616},{37237,0,7964},
+{37239,6,2356},{37255,0,5663},{37257,0,7327},{37259,0,7239},
+{37261,0,6776},{37266,0,5491},{37276,0,7281},{37291,6,2358},
+{37294,6,2360},{37297,0,4937},{37300,6,2362},{37312,0,5899},
+{37319,0,7124},{37321,0,6353},{37323,26,2364},{37335,6,2371},
+{37340,6,2373},{37347,0,6824},{37351,0,7163},{37354,0,6225},
+{37365,0,7125},{37389,0,4363},{37392,10,2375},{37399,0,6366},
+{37406,0,4014},{37428,0,4501},{37434,0,6082},{37439,6,2378},
+{37445,0,3599},{37449,0,7752},{37463,0,3658},{37467,0,5983},
+{37470,0,6283},{37474,0,4938},{37476,10,2380},{37504,0,6378},
+{37507,0,7260},{37509,0,4347},{37521,0,5446},{37523,0,6677},
+{37526,0,5617},{37528,0,4761},{37532,0,7660},{37555,0,6046},
+{37558,6,2383},{37561,0,5618},{37580,0,6752},{37583,0,7769},
+{37586,0,5107},{37604,0,5400},{37610,0,7568},{37624,0,3600},
+{37628,0,3557},{37636,0,4532},{37648,0,7282},{37656,0,7283},
+{37658,0,6590},{37662,18,2385},{37668,0,4119},{37670,0,4050},
+{37672,0,4811},{37675,0,5417},{37678,6,2390},{37704,0,6027},
+{37706,6,2392},{37709,0,4306},{37716,0,5803},{37723,0,4211},
+{37742,0,6354},{37749,0,3611},{37756,0,7375},{37758,0,6852},
+{37772,0,3659},{37780,0,6195},{37782,0,5564},{37786,0,7284},
+{37795,0,7789},{37799,0,3577},{37804,6,2394},{37808,0,6467},
+{37827,0,6831},{37841,0,6642},{37854,0,6196},{37857,0,3700},
+{37860,0,4575},{37878,0,7036},{37892,0,7952},{37912,0,6853},
+{37925,0,5447},{37931,0,6679},{37941,0,7176},{37944,0,7407},
+{37956,0,6898},{37969,5,3527},{37979,0,3851},{38013,0,7074},
+{38015,0,7060},{38263,0,6568},{38272,0,4846},{38275,0,5469},
+{38281,0,7542},{38283,0,3578},{38287,0,6367},{38289,5,7645},
+{38291,6,2396},{38296,0,3535},{38307,10,2398},{38312,0,4008},
+{38317,0,4453},{38321,0,5988},{38331,6,2401},{38343,0,5828},
+{38346,0,7903},{38356,10,2403},{38364,0,3833},{38369,6,2406},
+{38428,0,5147},{38433,0,7165},{38442,0,7498},{38446,0,6123},
+{38450,0,4967},{38459,0,6825},{38463,6,2408},{38466,0,7603},
+{38468,0,5148},{38475,10,2410},{38480,0,7647},{38491,18,2413},
+{38498,10,2418},{38506,0,4987},{38512,0,6384},{38515,0,7013},
+{38517,14,2421},{38525,0,5900},{38533,6,2425},{38538,6,2427},
+{38541,6,2429},{38548,6,2431},{38552,6,2433},{38555,6,2435},
+{38563,0,4644},{38567,5,5620},{38570,0,7728},{38577,0,6379},
+{38583,0,4510},{38587,0,7147},{38592,6,2437},{38596,14,2439},
+{38601,0,7357},{38603,14,2443},{38613,6,2447},{38617,0,5773},
+{38619,6,2449},{38626,6,2451},{38632,5,6227},{38634,0,5461},
+{38639,6,2453},{38642,0,6248},{38646,6,2455},{38649,0,4903},
+{38651,0,6680},{38656,0,5623},{38662,6,2457},{38673,0,6698},
+{38675,0,6047},{38678,0,4651},{38681,0,6028},{38684,0,5361},
+{38686,0,7628},{38695,0,4832},{38704,0,5314},{38706,0,4524},
+{38713,0,5030},{38717,0,6779},{38722,0,4464},{38724,0,5850},
+{38728,0,4503},{38737,0,7203},{38742,0,6755},{38748,0,6756},
+{38750,0,5220},{38753,6,2459},{38761,0,7733},{38765,0,6458},
+{38772,0,7876},{38775,0,6459},{38778,0,4695},{38795,0,7799},
+{38797,0,5814},{38799,0,3801},{38816,0,3950},{38824,0,3509},
+{38827,0,3951},{38829,0,7526},{38854,0,7166},{38859,0,6307},
+{38867,0,7648},{38876,0,4308},{38899,0,6385},{38902,0,5535},
+{38907,0,6249},{38911,18,2461},{38917,6,2466},{38920,0,5624},
+{38922,0,6237},{38924,0,5560},{38928,14,2468},{38935,6,2472},
+{38957,0,4357},{38960,0,7770},{38968,6,2474},{38971,0,5236},
+{38982,0,3814},{38988,10,2476},{38996,0,5815},{39000,0,6279},
+{39002,0,6681},{39006,0,4590},{39013,0,7840},{39015,0,3764},
+{39019,0,6682},{39023,0,7753},{39080,0,7595},{39087,0,5330},
+{39089,0,7444},{39108,0,7588},{39111,0,7587},{39131,6,2479},
+{39135,0,5733},{39137,6,2481},{39149,10,2483},{39156,0,6435},
+{39164,10,2486},{39171,0,3890},{39177,6,2489},{39180,0,6436},
+{39184,0,7075},{39187,0,5790},{39192,0,5946},{39198,0,6683},
+{39200,0,5056},{39208,0,3834},{39237,0,4687},{39241,0,4037},
+{39243,10,2491},{39249,6,2494},{39252,0,6098},{39255,0,7717},
+{39318,0,5625},{39321,0,7718},{39325,0,7613},{39333,0,5089},
+{39336,0,7790},{39340,10,2496},{39345,0,7392},{39347,6,2499},
+{39353,0,6468},{39361,0,4904},{39376,10,2501},{39381,0,3464},
+{39385,0,5149},{39389,0,7393},{39391,0,5299},{39405,0,7701},
+{39409,0,4388},{39423,0,6920},{39425,0,5240},{39432,0,5057},
+{39438,5,4122},{39449,0,7527},{39467,0,3612},{39472,0,4373},
+{39478,6,2504},{39488,0,4725},{39491,0,7589},{39493,0,3943},
+{39501,0,7965},{39509,0,3891},{39511,0,7729},{39514,6,2506},
+{39519,0,7328},{39522,0,4454},{39525,0,4124},{39529,6,2508},
+{39592,0,3785},{39608,0,7702},{39635,6,2510},{39640,0,3765},
+{39653,0,5997},{39662,0,4939},{39706,0,5627},{39719,0,4562},
+{39722,0,7470},{39729,0,6251},{39740,0,3993},{39745,18,2512},
+{39759,0,6308},{39764,0,4662},{39770,0,5910},{39791,0,4525},
+{39822,0,6699},{39825,0,7570},{39839,0,5816},{39851,0,3892},
+{39854,0,5449},{39881,0,4637},{39894,0,7204},{39908,0,3783},
+{39912,0,3704},{39949,0,7287},{39952,0,5805},{39954,0,5090},
+{39957,0,7629},{39973,0,7898},{39986,0,6076},{39995,0,4688},
+{40007,0,3559},{40009,0,5039},{40023,0,4645},{40165,0,6827},
+{40167,0,5150},{40169,0,3944},{40179,6,2517},{40182,0,5984},
+{40201,0,5791},{40219,0,6280},{40230,0,5839},{40232,0,5832},
+{40251,0,7862},{40273,0,3647},{40285,0,5792},{40288,6,2519},
+{40300,0,5180},{40306,0,6521},{40361,0,4794},{40367,0,5860},
+{40372,0,7634},{40388,0,3728},{40407,0,3945},{40434,0,7329},
+{40440,10,2521},{40474,0,5861},{40478,0,4396},{40565,0,4527},
+{40569,0,7662},{40573,0,5998},{40575,0,4533},{40594,6,2524},
+{40599,0,4456},{40605,0,5300},{40607,0,4646},{40613,0,4726},
+{40628,6,2526},{40635,0,4663},{40638,0,8004},{40643,0,7927},
+{40653,6,2528},{40657,0,8018},{40660,0,3623},{40664,0,4835},
+{40667,6,2530},{40670,0,6700},{40680,0,4249},{40692,0,4869},
+{40711,6,2532},{40718,0,6758},{40723,0,3766},{40736,0,5402},
+{40763,0,5222},{40778,6,2534},{40782,0,6586},{40786,0,7359},
+{40799,0,6618},{40801,0,4505},{40807,0,5462},{40810,0,7061},
+{40812,0,5911},{40823,0,5806},{40845,0,4563},{40848,0,4968},
+{40853,0,3529},{40860,0,3946},{44032,5,1086},{44034,5,9333},
+{44036,0,1088},{44037,5,9335},{44039,13,1089},{44043,17,9337},
+{44048,29,1093},{44056,0,9342},{44057,17,1101},{44062,5,9343},
+{44064,0,1106},{44065,9,9345},{44068,0,1107},{44069,25,9348},
+{44076,5,1108},{44078,0,9355},{44079,9,1110},{44082,21,9356},
+{44088,5,1113},{44090,5,9362},{44092,0,1115},{44093,9,9364},
+{44096,0,1116},{44097,37,9367},{44107,10,2536},{44110,21,9378},
+{44116,0,1119},{44117,9,9384},{44120,0,1120},{44121,9,9387},
+{44124,0,1121},{44125,73,9390},{44144,5,1122},{44146,5,9409},
+{44148,0,1124},{44149,5,9411},{44151,5,1125},{44153,6,2539},
+{44155,17,9414},{44160,5,1128},{44162,0,9419},{44163,13,1130},
+{44167,5,9420},{44169,13,1134},{44173,9,9422},{44176,0,1138},
+{44177,9,9425},{44180,0,1139},{44181,25,9428},{44188,5,1140},
+{44190,0,9435},{44191,9,1142},{44194,21,9436},{44200,9,1145},
+{44203,6,2541},{44205,5,9443},{44207,5,1149},{44209,25,9445},
+{44216,5,1151},{44218,0,9452},{44219,9,1153},{44222,9,9453},
+{44225,0,1156},{44226,5,9456},{44228,0,1157},{44229,9,9458},
+{44232,0,1158},{44233,9,9461},{44236,0,1159},{44237,29,9464},
+{44245,10,2543},{44248,29,9473},{44256,5,1162},{44258,5,9481},
+{44260,0,1164},{44261,5,9483},{44263,5,1165},{44265,14,2546},
+{44269,5,9487},{44271,9,1169},{44274,10,2550},{44277,5,1173},
+{44279,17,9491},{44284,5,1175},{44286,5,9496},{44288,0,1177},
+{44289,9,9498},{44292,10,2553},{44295,17,9502},{44300,5,1180},
+{44302,14,2556},{44306,21,9509},{44312,0,1184},{44313,9,9515},
+{44316,0,1185},{44317,9,9518},{44320,0,1186},{44321,29,9521},
+{44329,0,1187},{44330,5,9529},{44332,5,1188},{44334,21,9531},
+{44340,5,1190},{44342,5,9537},{44344,0,1192},{44345,9,9539},
+{44348,0,1193},{44349,25,9542},{44356,5,1194},{44358,14,2560},
+{44362,21,9551},{44368,0,1198},{44369,9,9557},{44372,0,1199},
+{44373,9,9560},{44376,0,1200},{44377,29,9563},{44385,10,2564},
+{44388,29,9572},{44396,5,1203},{44398,5,9580},{44400,0,1205},
+{44401,5,9582},{44403,13,1206},{44407,13,9584},{44411,9,1210},
+{44414,10,2567},{44417,5,1214},{44419,17,9590},{44424,5,1216},
+{44426,5,9595},{44428,0,1218},{44429,9,9597},{44432,0,1219},
+{44433,41,9600},{44444,5,1220},{44446,21,9611},{44452,0,1222},
+{44453,69,9617},{44471,0,1223},{44472,29,9635},{44480,5,1224},
+{44482,5,9643},{44484,0,1226},{44485,9,9645},{44488,0,1227},
+{44489,25,9648},{44496,5,1228},{44498,6,2570},{44500,29,9656},
+{44508,0,1231},{44509,9,9664},{44512,0,1232},{44513,9,9667},
+{44516,0,1233},{44517,73,9670},{44536,5,1234},{44538,5,9689},
+{44540,0,1236},{44541,5,9691},{44543,9,1237},{44546,21,9693},
+{44552,5,1240},{44554,14,2572},{44558,21,9701},{44564,0,1244},
+{44565,105,9707},{44592,5,1245},{44594,5,9734},{44596,0,1247},
+{44597,5,9736},{44599,5,1248},{44601,6,2576},{44603,17,9739},
+{44608,5,1251},{44610,10,2578},{44613,5,1254},{44615,9,9746},
+{44618,6,2581},{44620,9,1257},{44623,6,2583},{44625,9,9751},
+{44628,10,2585},{44631,17,9755},{44636,5,1263},{44638,0,9760},
+{44639,9,1265},{44642,9,9761},{44645,0,1268},{44646,5,9764},
+{44648,5,1269},{44650,5,9766},{44652,0,1271},{44653,9,9768},
+{44656,0,1272},{44657,25,9771},{44664,5,1273},{44666,0,9778},
+{44667,9,1275},{44670,21,9779},{44676,5,1278},{44678,21,9785},
+{44684,0,1280},{44685,185,9791},{44732,9,1281},{44735,6,2588},
+{44737,9,9839},{44740,0,1285},{44741,25,9842},{44748,5,1286},
+{44750,0,9849},{44751,9,1288},{44754,21,9850},{44760,5,1291},
+{44762,5,9856},{44764,0,1293},{44765,41,9858},{44776,0,1294},
+{44777,5,9869},{44779,10,2590},{44782,21,9872},{44788,0,1297},
+{44789,9,9878},{44792,0,1298},{44793,9,9881},{44796,0,1299},
+{44797,37,9884},{44807,5,1300},{44809,13,9894},{44813,0,1302},
+{44814,5,9898},{44816,0,1303},{44817,105,9900},{44844,5,1304},
+{44846,5,9927},{44848,18,2593},{44853,25,9931},{44860,5,1309},
+{44862,10,2598},{44865,9,1312},{44868,13,9940},{44872,5,1315},
+{44874,21,9944},{44880,0,1317},{44881,41,9950},{44892,5,1318},
+{44894,21,9961},{44900,5,1320},{44902,73,9967},{44921,0,1322},
+{44922,21,9986},{44928,0,1323},{44929,9,9992},{44932,0,1324},
+{44933,9,9995},{44936,0,1325},{44937,25,9998},{44944,5,1326},
+{44946,9,10005},{44949,0,1328},{44950,21,10008},{44956,0,1329},
+{44957,105,10014},{44984,5,1330},{44986,5,10041},{44988,0,1332},
+{44989,9,10043},{44992,0,1333},{44993,21,10046},{44999,9,1334},
+{45002,10,2601},{45005,5,1338},{45007,17,10054},{45012,0,1340},
+{45013,25,10059},{45020,0,1341},{45021,41,10066},{45032,5,1342},
+{45034,21,10077},{45040,5,1344},{45042,5,10083},{45044,0,1346},
+{45045,9,10085},{45048,0,1347},{45049,25,10088},{45056,5,1348},
+{45058,5,10095},{45060,0,1350},{45061,25,10097},{45068,0,1351},
+{45069,9,10104},{45072,0,1352},{45073,9,10107},{45076,0,1353},
+{45077,25,10110},{45084,5,1354},{45086,37,10117},{45096,0,1356},
+{45097,105,10127},{45124,5,1357},{45126,5,10154},{45128,26,2604},
+{45135,13,10159},{45139,9,1363},{45142,14,2611},{45146,9,10165},
+{45149,0,1368},{45150,117,10168},{45180,5,1369},{45182,5,10198},
+{45184,0,1371},{45185,9,10200},{45188,0,1372},{45189,25,10203},
+{45196,5,1373},{45198,14,2615},{45202,21,10212},{45208,9,1377},
+{45211,6,2619},{45213,5,10219},{45215,13,1381},{45219,17,10221},
+{45224,5,1385},{45226,0,10226},{45227,17,1387},{45232,10,2621},
+{45235,9,1393},{45238,5,10229},{45240,0,1396},{45241,9,10231},
+{45244,0,1397},{45245,25,10234},{45252,5,1398},{45254,0,10241},
+{45255,9,1400},{45258,21,10242},{45264,5,1403},{45266,5,10248},
+{45268,0,1405},{45269,9,10250},{45272,0,1406},{45273,25,10253},
+{45280,0,1407},{45281,13,10260},{45285,0,1408},{45286,133,10264},
+{45320,5,1409},{45322,0,10298},{45323,5,1411},{45325,9,10299},
+{45328,6,2624},{45330,5,1414},{45332,13,10303},{45336,5,1416},
+{45338,0,10307},{45339,9,1418},{45342,17,10308},{45347,9,1421},
+{45350,5,10313},{45352,0,1424},{45353,9,10315},{45356,0,1425},
+{45357,25,10318},{45364,5,1426},{45366,0,10325},{45367,9,1428},
+{45370,21,10326},{45376,5,1431},{45378,5,10332},{45380,0,1433},
+{45381,9,10334},{45384,0,1434},{45385,25,10337},{45392,5,1435},
+{45394,5,10344},{45396,5,1437},{45398,5,10346},{45400,0,1439},
+{45401,9,10348},{45404,0,1440},{45405,9,10351},{45408,0,1441},
+{45409,89,10354},{45432,5,1442},{45434,5,10377},{45436,0,1444},
+{45437,9,10379},{45440,10,2626},{45443,17,10383},{45448,5,1447},
+{45450,14,2629},{45454,13,10390},{45458,9,1451},{45461,9,10394},
+{45464,0,1454},{45465,9,10397},{45468,0,1455},{45469,41,10400},
+{45480,0,1456},{45481,137,10411},{45516,0,1457},{45517,9,10446},
+{45520,0,1458},{45521,9,10449},{45524,0,1459},{45525,25,10452},
+{45532,5,1460},{45534,6,2633},{45536,29,10460},{45544,5,1463},
+{45546,5,10468},{45548,0,1465},{45549,9,10470},{45552,0,1466},
+{45553,29,10473},{45561,18,2635},{45566,21,10483},{45572,5,1470},
+{45574,5,10489},{45576,0,1472},{45577,5,10491},{45579,5,1473},
+{45581,25,10493},{45588,5,1475},{45590,14,2640},{45594,21,10502},
+{45600,0,1479},{45601,73,10508},{45620,0,1480},{45621,25,10527},
+{45628,0,1481},{45629,105,10534},{45656,0,1482},{45657,9,10561},
+{45660,0,1483},{45661,9,10564},{45664,0,1484},{45665,25,10567},
+{45672,5,1485},{45674,37,10574},{45684,5,1487},{45686,21,10584},
+{45692,0,1489},{45693,25,10590},{45700,5,1490},{45702,9,10597},
+{45705,0,1492},{45706,21,10600},{45712,5,1493},{45714,5,10606},
+{45716,0,1495},{45717,9,10608},{45720,9,1496},{45723,17,10611},
+{45728,5,1499},{45730,10,2644},{45733,5,1502},{45735,9,10618},
+{45738,10,2647},{45741,9,10622},{45744,0,1506},{45745,9,10625},
+{45748,0,1507},{45749,73,10628},{45768,5,1508},{45770,5,10647},
+{45772,0,1510},{45773,9,10649},{45776,10,2650},{45779,17,10653},
+{45784,5,1513},{45786,14,2653},{45790,13,10660},{45794,6,2657},
+{45796,9,1518},{45799,6,2659},{45801,5,10666},{45803,17,1522},
+{45808,9,10668},{45811,9,1527},{45814,0,10671},{45815,17,1530},
+{45820,9,10672},{45823,9,1535},{45826,5,10675},{45828,0,1538},
+{45829,9,10677},{45832,0,1539},{45833,25,10680},{45840,5,1540},
+{45842,0,10687},{45843,9,1542},{45846,21,10688},{45852,0,1545},
+{45853,217,10694},{45908,9,1546},{45911,6,2661},{45913,5,10750},
+{45915,5,1550},{45917,0,10752},{45918,5,1552},{45920,13,10753},
+{45924,5,1554},{45926,22,2663},{45932,5,10760},{45934,6,2669},
+{45936,5,1560},{45938,5,10763},{45940,0,1562},{45941,9,10765},
+{45944,0,1563},{45945,25,10768},{45952,5,1564},{45954,0,10775},
+{45955,9,1566},{45958,21,10776},{45964,0,1569},{45965,9,10782},
+{45968,0,1570},{45969,9,10785},{45972,0,1571},{45973,41,10788},
+{45984,5,1572},{45986,21,10799},{45992,0,1574},{45993,9,10805},
+{45996,0,1575},{45997,89,10808},{46020,5,1576},{46022,5,10831},
+{46024,0,1578},{46025,5,10833},{46027,5,1579},{46029,14,2671},
+{46033,9,10837},{46036,5,1583},{46038,30,2675},{46046,5,10844},
+{46048,0,1589},{46049,9,10846},{46052,0,1590},{46053,9,10849},
+{46056,0,1591},{46057,73,10852},{46076,0,1592},{46077,73,10871},
+{46096,0,1593},{46097,25,10890},{46104,0,1594},{46105,9,10897},
+{46108,0,1595},{46109,9,10900},{46112,0,1596},{46113,25,10903},
+{46120,5,1597},{46122,6,2683},{46124,29,10911},{46132,0,1600},
+{46133,105,10919},{46160,5,1601},{46162,5,10946},{46164,0,1603},
+{46165,9,10948},{46168,0,1604},{46169,25,10951},{46176,5,1605},
+{46178,14,2685},{46182,21,10960},{46188,0,1609},{46189,73,10966},
+{46208,0,1610},{46209,25,10985},{46216,0,1611},{46217,77,10992},
+{46237,0,1612},{46238,21,11012},{46244,0,1613},{46245,9,11018},
+{46248,0,1614},{46249,9,11021},{46252,0,1615},{46253,29,11024},
+{46261,18,2689},{46266,21,11034},{46272,0,1619},{46273,9,11040},
+{46276,0,1620},{46277,9,11043},{46280,0,1621},{46281,25,11046},
+{46288,0,1622},{46289,13,11053},{46293,0,1623},{46294,21,11057},
+{46300,5,1624},{46302,5,11063},{46304,0,1626},{46305,5,11065},
+{46307,5,1627},{46309,6,2694},{46311,17,11068},{46316,5,1630},
+{46318,14,2696},{46322,21,11075},{46328,0,1634},{46329,105,11081},
+{46356,5,1635},{46358,5,11108},{46360,0,1637},{46361,5,11110},
+{46363,5,1638},{46365,25,11112},{46372,5,1640},{46374,0,11119},
+{46375,13,1642},{46379,17,11120},{46384,5,1646},{46386,5,11125},
+{46388,0,1648},{46389,9,11127},{46392,0,1649},{46393,25,11130},
+{46400,5,1650},{46402,0,11137},{46403,9,1652},{46406,17,11138},
+{46411,9,1655},{46414,5,11143},{46416,0,1658},{46417,9,11145},
+{46420,0,1659},{46421,25,11148},{46428,5,1660},{46430,0,11155},
+{46431,9,1662},{46434,245,11156},{46496,5,1665},{46498,5,11218},
+{46500,0,1667},{46501,9,11220},{46504,6,2700},{46506,5,1669},
+{46508,13,11224},{46512,5,1671},{46514,0,11228},{46515,9,1673},
+{46518,17,11229},{46523,9,1676},{46526,5,11234},{46528,0,1679},
+{46529,9,11236},{46532,0,1680},{46533,25,11239},{46540,5,1681},
+{46542,0,11246},{46543,9,1683},{46546,21,11247},{46552,0,1686},
+{46553,73,11253},{46572,0,1687},{46573,137,11272},{46608,5,1688},
+{46610,5,11307},{46612,0,1690},{46613,9,11309},{46616,0,1691},
+{46617,45,11312},{46629,0,1692},{46630,21,11324},{46636,0,1693},
+{46637,25,11330},{46644,0,1694},{46645,73,11337},{46664,0,1695},
+{46665,105,11356},{46692,0,1696},{46693,9,11383},{46696,0,1697},
+{46697,201,11386},{46748,5,1698},{46750,5,11437},{46752,0,1700},
+{46753,9,11439},{46756,0,1701},{46757,21,11442},{46763,5,1702},
+{46765,13,11448},{46769,0,1704},{46770,133,11452},{46804,0,1705},
+{46805,105,11486},{46832,0,1706},{46833,9,11513},{46836,0,1707},
+{46837,9,11516},{46840,0,1708},{46841,25,11519},{46848,5,1709},
+{46850,9,11526},{46853,0,1711},{46854,133,11529},{46888,5,1712},
+{46890,5,11563},{46892,0,1714},{46893,5,11565},{46895,5,1715},
+{46897,25,11567},{46904,5,1717},{46906,6,2702},{46908,29,11575},
+{46916,0,1720},{46917,9,11583},{46920,0,1721},{46921,9,11586},
+{46924,0,1722},{46925,25,11589},{46932,5,1723},{46934,37,11596},
+{46944,0,1725},{46945,9,11606},{46948,0,1726},{46949,9,11609},
+{46952,0,1727},{46953,25,11612},{46960,5,1728},{46962,14,2704},
+{46966,21,11621},{46972,5,1732},{46974,5,11627},{46976,0,1734},
+{46977,9,11629},{46980,0,1735},{46981,25,11632},{46988,5,1736},
+{46990,0,11639},{46991,13,1738},{46995,9,11640},{46998,13,1742},
+{47002,5,11643},{47004,0,1746},{47005,9,11645},{47008,0,1747},
+{47009,25,11648},{47016,5,1748},{47018,0,11655},{47019,9,1750},
+{47022,21,11656},{47028,5,1753},{47030,5,11662},{47032,0,1755},
+{47033,53,11664},{47047,10,2708},{47050,133,11679},{47084,5,1758},
+{47086,5,11713},{47088,0,1760},{47089,9,11715},{47092,0,1761},
+{47093,25,11718},{47100,5,1762},{47102,6,2711},{47104,5,1765},
+{47106,17,11726},{47111,9,1767},{47114,5,11731},{47116,0,1770},
+{47117,9,11733},{47120,0,1771},{47121,25,11736},{47128,5,1772},
+{47130,14,2713},{47134,21,11745},{47140,5,1776},{47142,5,11751},
+{47144,0,1778},{47145,9,11753},{47148,0,1779},{47149,25,11756},
+{47156,5,1780},{47158,0,11763},{47159,9,1782},{47162,21,11764},
+{47168,0,1785},{47169,9,11770},{47172,0,1786},{47173,45,11773},
+{47185,10,2717},{47188,29,11786},{47196,5,1789},{47198,5,11794},
+{47200,0,1791},{47201,9,11796},{47204,0,1792},{47205,25,11799},
+{47212,5,1793},{47214,14,2720},{47218,21,11808},{47224,0,1797},
+{47225,9,11814},{47228,0,1798},{47229,61,11817},{47245,0,1799},
+{47246,101,11833},{47272,0,1800},{47273,25,11859},{47280,0,1801},
+{47281,9,11866},{47284,0,1802},{47285,9,11869},{47288,0,1803},
+{47289,25,11872},{47296,5,1804},{47298,14,2724},{47302,21,11881},
+{47308,0,1808},{47309,9,11887},{47312,0,1809},{47313,9,11890},
+{47316,0,1810},{47317,29,11893},{47325,18,2728},{47330,21,11903},
+{47336,5,1814},{47338,5,11909},{47340,0,1816},{47341,9,11911},
+{47344,0,1817},{47345,25,11914},{47352,5,1818},{47354,14,2733},
+{47358,21,11923},{47364,0,1822},{47365,73,11929},{47384,0,1823},
+{47385,25,11948},{47392,0,1824},{47393,105,11955},{47420,5,1825},
+{47422,5,11982},{47424,0,1827},{47425,9,11984},{47428,0,1828},
+{47429,25,11987},{47436,0,1829},{47437,5,11994},{47439,10,2737},
+{47442,21,11997},{47448,5,1832},{47450,5,12003},{47452,0,1834},
+{47453,9,12005},{47456,0,1835},{47457,25,12008},{47464,5,1836},
+{47466,14,2740},{47470,21,12017},{47476,5,1840},{47478,5,12023},
+{47480,0,1842},{47481,9,12025},{47484,0,1843},{47485,25,12028},
+{47492,5,1844},{47494,10,2744},{47497,5,1847},{47499,5,12037},
+{47501,5,1849},{47503,113,12039},{47532,5,1851},{47534,5,12068},
+{47536,0,1853},{47537,9,12070},{47540,0,1854},{47541,25,12073},
+{47548,5,1855},{47550,14,2747},{47554,21,12082},{47560,5,1859},
+{47562,5,12088},{47564,6,2751},{47566,17,1862},{47571,17,12091},
+{47576,5,1867},{47578,10,2753},{47581,5,1870},{47583,5,12098},
+{47585,6,2756},{47587,9,1873},{47590,5,12101},{47592,0,1876},
+{47593,9,12103},{47596,0,1877},{47597,25,12106},{47604,5,1878},
+{47606,0,12113},{47607,13,1880},{47611,17,12114},{47616,5,1884},
+{47618,21,12119},{47624,0,1886},{47625,45,12125},{47637,0,1887},
+{47638,133,12137},{47672,5,1888},{47674,5,12171},{47676,0,1890},
+{47677,9,12173},{47680,10,2758},{47683,17,12177},{47688,5,1893},
+{47690,10,2761},{47693,5,1896},{47695,13,12184},{47699,9,1898},
+{47702,5,12188},{47704,0,1901},{47705,9,12190},{47708,0,1902},
+{47709,25,12193},{47716,5,1903},{47718,0,12200},{47719,9,1905},
+{47722,21,12201},{47728,5,1908},{47730,5,12207},{47732,0,1910},
+{47733,9,12209},{47736,0,1911},{47737,37,12212},{47747,9,1912},
+{47750,6,2764},{47752,13,12223},{47756,0,1916},{47757,105,12227},
+{47784,5,1917},{47786,0,12254},{47787,5,1919},{47789,9,12255},
+{47792,10,2766},{47795,17,12259},{47800,5,1923},{47802,14,2769},
+{47806,21,12266},{47812,0,1927},{47813,9,12272},{47816,0,1928},
+{47817,57,12275},{47832,5,1929},{47834,133,12290},{47868,0,1931},
+{47869,9,12324},{47872,0,1932},{47873,9,12327},{47876,0,1933},
+{47877,29,12330},{47885,18,2773},{47890,21,12340},{47896,0,1937},
+{47897,9,12346},{47900,0,1938},{47901,9,12349},{47904,0,1939},
+{47905,29,12352},{47913,10,2778},{47916,29,12361},{47924,9,1942},
+{47927,6,2781},{47929,5,12370},{47931,13,1946},{47935,17,12372},
+{47940,5,1950},{47942,14,2783},{47946,9,12379},{47949,6,2787},
+{47951,5,1955},{47953,9,12383},{47956,0,1957},{47957,9,12386},
+{47960,0,1958},{47961,29,12389},{47969,10,2789},{47972,29,12398},
+{47980,0,1961},{47981,105,12406},{48008,0,1962},{48009,9,12433},
+{48012,0,1963},{48013,9,12436},{48016,0,1964},{48017,73,12439},
+{48036,0,1965},{48037,9,12458},{48040,0,1966},{48041,9,12461},
+{48044,0,1967},{48045,25,12464},{48052,0,1968},{48053,5,12471},
+{48055,0,1969},{48056,29,12473},{48064,0,1970},{48065,9,12481},
+{48068,0,1971},{48069,9,12484},{48072,0,1972},{48073,25,12487},
+{48080,0,1973},{48081,5,12494},{48083,0,1974},{48084,141,12496},
+{48120,5,1975},{48122,5,12532},{48124,0,1977},{48125,5,12534},
+{48127,5,1978},{48129,6,2792},{48131,17,12537},{48136,5,1981},
+{48138,0,12542},{48139,9,1983},{48142,14,2794},{48146,5,12545},
+{48148,17,1988},{48153,5,12547},{48155,17,1993},{48160,13,12549},
+{48164,5,1998},{48166,14,2798},{48170,9,12555},{48173,0,2002},
+{48174,5,12558},{48176,5,2003},{48178,5,12560},{48180,0,2005},
+{48181,9,12562},{48184,0,2006},{48185,25,12565},{48192,5,2007},
+{48194,0,12572},{48195,9,2009},{48198,9,12573},{48201,0,2012},
+{48202,5,12576},{48204,5,2013},{48206,5,12578},{48208,0,2015},
+{48209,45,12580},{48221,0,2016},{48222,149,12592},{48260,5,2017},
+{48262,5,12630},{48264,0,2019},{48265,5,12632},{48267,5,2020},
+{48269,6,2802},{48271,17,12635},{48276,5,2023},{48278,10,2804},
+{48281,5,2026},{48283,17,12642},{48288,5,2028},{48290,5,12647},
+{48292,0,2030},{48293,5,12649},{48295,5,2031},{48297,25,12651},
+{48304,5,2033},{48306,0,12658},{48307,9,2035},{48310,21,12659},
+{48316,5,2038},{48318,5,12665},{48320,0,2040},{48321,9,12667},
+{48324,0,2041},{48325,29,12670},{48333,6,2807},{48335,9,2043},
+{48338,9,12679},{48341,0,2046},{48342,5,12682},{48344,0,2047},
+{48345,9,12684},{48348,0,2048},{48349,89,12687},{48372,9,2049},
+{48375,6,2809},{48377,9,12711},{48380,0,2053},{48381,25,12714},
+{48388,5,2054},{48390,14,2811},{48394,21,12723},{48400,0,2058},
+{48401,9,12729},{48404,0,2059},{48405,57,12732},{48420,0,2060},
+{48421,25,12747},{48428,0,2061},{48429,73,12754},{48448,0,2062},
+{48449,25,12773},{48456,5,2063},{48458,5,12780},{48460,0,2065},
+{48461,9,12782},{48464,0,2066},{48465,25,12785},{48472,5,2067},
+{48474,37,12792},{48484,0,2069},{48485,9,12802},{48488,0,2070},
+{48489,89,12805},{48512,5,2071},{48514,5,12828},{48516,0,2073},
+{48517,5,12830},{48519,13,2074},{48523,17,12832},{48528,5,2078},
+{48530,14,2815},{48534,9,12839},{48537,5,2082},{48539,6,2819},
+{48541,25,12843},{48548,0,2085},{48549,41,12850},{48560,0,2086},
+{48561,25,12861},{48568,0,2087},{48569,105,12868},{48596,5,2088},
+{48598,5,12895},{48600,0,2090},{48601,9,12897},{48604,0,2091},
+{48605,45,12900},{48617,0,2092},{48618,21,12912},{48624,0,2093},
+{48625,9,12918},{48628,0,2094},{48629,9,12921},{48632,0,2095},
+{48633,25,12924},{48640,0,2096},{48641,5,12931},{48643,10,2821},
+{48646,21,12934},{48652,5,2099},{48654,5,12940},{48656,0,2101},
+{48657,9,12942},{48660,0,2102},{48661,25,12945},{48668,5,2103},
+{48670,6,2824},{48672,141,12953},{48708,5,2106},{48710,5,12989},
+{48712,0,2108},{48713,9,12991},{48716,10,2826},{48719,17,12995},
+{48724,5,2111},{48726,10,2829},{48729,9,2114},{48732,13,13002},
+{48736,5,2117},{48738,5,13006},{48740,0,2119},{48741,9,13008},
+{48744,10,2832},{48747,17,13012},{48752,5,2122},{48754,0,13017},
+{48755,9,2124},{48758,17,13018},{48763,9,2127},{48766,5,13023},
+{48768,0,2130},{48769,9,13025},{48772,0,2131},{48773,25,13028},
+{48780,5,2132},{48782,0,13035},{48783,9,2134},{48786,21,13036},
+{48792,5,2137},{48794,53,13042},{48808,0,2139},{48809,153,13056},
+{48848,5,2140},{48850,5,13095},{48852,0,2142},{48853,5,13097},
+{48855,5,2143},{48857,25,13099},{48864,0,2145},{48865,5,13106},
+{48867,9,2146},{48870,21,13108},{48876,0,2149},{48877,77,13114},
+{48897,0,2150},{48898,21,13134},{48904,5,2151},{48906,53,13140},
+{48920,5,2153},{48922,0,13154},{48923,9,2155},{48926,133,13155},
+{48960,5,2158},{48962,5,13189},{48964,0,2160},{48965,9,13191},
+{48968,0,2161},{48969,25,13194},{48976,5,2162},{48978,9,13201},
+{48981,0,2164},{48982,245,13204},{49044,0,2165},{49045,105,13266},
+{49072,0,2166},{49073,77,13293},{49093,0,2167},{49094,21,13313},
+{49100,5,2168},{49102,5,13319},{49104,0,2170},{49105,9,13321},
+{49108,0,2171},{49109,25,13324},{49116,0,2172},{49117,5,13331},
+{49119,10,2835},{49122,357,13334},{49212,0,2175},{49213,77,13424},
+{49233,0,2176},{49234,21,13444},{49240,0,2177},{49241,9,13450},
+{49244,0,2178},{49245,9,13453},{49248,0,2179},{49249,25,13456},
+{49256,5,2180},{49258,149,13463},{49296,5,2182},{49298,5,13501},
+{49300,0,2184},{49301,9,13503},{49304,0,2185},{49305,25,13506},
+{49312,5,2186},{49314,14,2838},{49318,21,13515},{49324,5,2190},
+{49326,0,13521},{49327,5,2192},{49329,5,13522},{49331,13,2194},
+{49335,17,13524},{49340,5,2198},{49342,0,13529},{49343,9,2200},
+{49346,9,13530},{49349,0,2203},{49350,5,13533},{49352,5,2204},
+{49354,5,13535},{49356,0,2206},{49357,9,13537},{49360,0,2207},
+{49361,25,13540},{49368,5,2208},{49370,0,13547},{49371,9,2210},
+{49374,21,13548},{49380,5,2213},{49382,5,13554},{49384,0,2215},
+{49385,9,13556},{49388,0,2216},{49389,25,13559},{49396,5,2217},
+{49398,14,2842},{49402,21,13568},{49408,0,2221},{49409,9,13574},
+{49412,0,2222},{49413,9,13577},{49416,0,2223},{49417,25,13580},
+{49424,0,2224},{49425,13,13587},{49429,0,2225},{49430,21,13591},
+{49436,17,2226},{49441,5,13597},{49443,5,2231},{49445,0,13599},
+{49446,5,2233},{49448,13,13600},{49452,5,2235},{49454,0,13604},
+{49455,9,2237},{49458,13,13605},{49462,6,2846},{49464,5,2241},
+{49466,5,13610},{49468,0,2243},{49469,9,13612},{49472,0,2244},
+{49473,25,13615},{49480,5,2245},{49482,0,13622},{49483,9,2247},
+{49486,21,13623},{49492,5,2250},{49494,5,13629},{49496,0,2252},
+{49497,9,13631},{49500,0,2253},{49501,25,13634},{49508,5,2254},
+{49510,0,13641},{49511,9,2256},{49514,21,13642},{49520,0,2259},
+{49521,9,13648},{49524,0,2260},{49525,9,13651},{49528,0,2261},
+{49529,45,13654},{49541,0,2262},{49542,21,13666},{49548,9,2263},
+{49551,6,2848},{49553,9,13673},{49556,10,2850},{49559,17,13677},
+{49564,5,2269},{49566,14,2853},{49570,9,13684},{49573,0,2273},
+{49574,5,13687},{49576,5,2274},{49578,5,13689},{49580,0,2276},
+{49581,9,13691},{49584,0,2277},{49585,45,13694},{49597,0,2278},
+{49598,21,13706},{49604,0,2279},{49605,9,13712},{49608,0,2280},
+{49609,9,13715},{49612,0,2281},{49613,25,13718},{49620,0,2282},
+{49621,5,13725},{49623,5,2283},{49625,25,13727},{49632,0,2285},
+{49633,9,13734},{49636,0,2286},{49637,9,13737},{49640,0,2287},
+{49641,25,13740},{49648,5,2288},{49650,6,2857},{49652,29,13748},
+{49660,5,2291},{49662,5,13756},{49664,0,2293},{49665,9,13758},
+{49668,0,2294},{49669,25,13761},{49676,5,2295},{49678,14,2859},
+{49682,21,13770},{49688,5,2299},{49690,5,13776},{49692,0,2301},
+{49693,5,13778},{49695,5,2302},{49697,25,13780},{49704,5,2304},
+{49706,26,2863},{49713,5,2309},{49715,6,2870},{49717,73,13792},
+{49736,0,2312},{49737,25,13811},{49744,5,2313},{49746,5,13818},
+{49748,0,2315},{49749,9,13820},{49752,0,2316},{49753,25,13823},
+{49760,0,2317},{49761,13,13830},{49765,0,2318},{49766,21,13834},
+{49772,5,2319},{49774,5,13840},{49776,0,2321},{49777,9,13842},
+{49780,0,2322},{49781,25,13845},{49788,5,2323},{49790,14,2872},
+{49794,21,13854},{49800,5,2327},{49802,21,13860},{49808,0,2329},
+{49809,25,13866},{49816,0,2330},{49817,5,13873},{49819,10,2876},
+{49822,21,13876},{49828,5,2333},{49830,5,13882},{49832,0,2335},
+{49833,9,13884},{49836,5,2336},{49838,21,13887},{49844,5,2338},
+{49846,14,2879},{49850,133,13895},{49884,5,2342},{49886,5,13929},
+{49888,0,2344},{49889,5,13931},{49891,5,2345},{49893,21,13933},
+{49899,9,2347},{49902,14,2883},{49906,13,13941},{49910,6,2887},
+{49912,5,2353},{49914,0,13946},{49915,5,2355},{49917,9,13947},
+{49920,0,2357},{49921,25,13950},{49928,5,2358},{49930,5,13957},
+{49932,5,2360},{49934,17,13959},{49939,9,2362},{49942,5,13964},
+{49944,0,2365},{49945,9,13966},{49948,0,2366},{49949,25,13969},
+{49956,5,2367},{49958,5,13976},{49960,5,2369},{49962,105,13978},
+{49989,0,2371},{49990,133,14005},{50024,5,2372},{50026,5,14039},
+{50028,0,2374},{50029,9,14041},{50032,10,2889},{50035,17,14045},
+{50040,5,2377},{50042,5,14050},{50044,5,2379},{50046,21,14052},
+{50052,0,2381},{50053,9,14058},{50056,0,2382},{50057,9,14061},
+{50060,0,2383},{50061,201,14064},{50112,0,2384},{50113,89,14115},
+{50136,5,2385},{50138,5,14138},{50140,0,2387},{50141,5,14140},
+{50143,5,2388},{50145,6,2892},{50147,17,14143},{50152,5,2391},
+{50154,9,14148},{50157,0,2393},{50158,21,14151},{50164,5,2394},
+{50166,5,14157},{50168,0,2396},{50169,57,14159},{50184,0,2397},
+{50185,25,14174},{50192,0,2398},{50193,73,14181},{50212,0,2399},
+{50213,25,14200},{50220,0,2400},{50221,9,14207},{50224,0,2401},
+{50225,9,14210},{50228,0,2402},{50229,25,14213},{50236,5,2403},
+{50238,37,14220},{50248,0,2405},{50249,105,14230},{50276,5,2406},
+{50278,5,14257},{50280,0,2408},{50281,9,14259},{50284,0,2409},
+{50285,25,14262},{50292,5,2410},{50294,9,14269},{50297,0,2412},
+{50298,21,14272},{50304,0,2413},{50305,73,14278},{50324,0,2414},
+{50325,25,14297},{50332,0,2415},{50333,105,14304},{50360,0,2416},
+{50361,9,14331},{50364,0,2417},{50365,173,14334},{50409,0,2418},
+{50410,21,14378},{50416,5,2419},{50418,5,14384},{50420,0,2421},
+{50421,9,14386},{50424,10,2894},{50427,13,14390},{50431,9,2424},
+{50434,37,14394},{50444,0,2427},{50445,9,14404},{50448,0,2428},
+{50449,9,14407},{50452,0,2429},{50453,25,14410},{50460,0,2430},
+{50461,41,14417},{50472,5,2431},{50474,5,14428},{50476,0,2433},
+{50477,9,14430},{50480,0,2434},{50481,25,14433},{50488,5,2435},
+{50490,14,2897},{50494,21,14442},{50500,5,2439},{50502,5,14448},
+{50504,9,2441},{50507,0,14450},{50508,9,2444},{50511,13,14451},
+{50515,9,2447},{50518,0,14455},{50519,9,2450},{50522,9,14456},
+{50525,5,2453},{50527,0,14459},{50528,5,2455},{50530,5,14460},
+{50532,0,2457},{50533,9,14462},{50536,0,2458},{50537,25,14465},
+{50544,5,2459},{50546,0,14472},{50547,9,2461},{50550,21,14473},
+{50556,5,2464},{50558,5,14479},{50560,0,2466},{50561,9,14481},
+{50564,0,2467},{50565,5,14484},{50567,0,2468},{50568,13,14486},
+{50572,5,2469},{50574,14,2901},{50578,9,14492},{50581,6,2905},
+{50583,5,2474},{50585,9,14496},{50588,0,2476},{50589,9,14499},
+{50592,0,2477},{50593,29,14502},{50601,0,2478},{50602,37,14510},
+{50612,5,2479},{50614,5,14520},{50616,5,2481},{50618,0,14522},
+{50619,13,2483},{50623,17,14523},{50628,25,2487},{50635,18,2907},
+{50640,5,2496},{50642,5,14531},{50644,0,2498},{50645,9,14533},
+{50648,0,2499},{50649,25,14536},{50656,5,2500},{50658,14,2912},
+{50662,21,14545},{50668,9,2504},{50671,6,2916},{50673,9,14552},
+{50676,6,2918},{50678,5,2509},{50680,13,14556},{50684,21,2511},
+{50690,9,14560},{50693,13,2517},{50697,9,14563},{50700,0,2521},
+{50701,9,14566},{50704,0,2522},{50705,25,14569},{50712,5,2523},
+{50714,0,14576},{50715,5,2525},{50717,25,14577},{50724,5,2527},
+{50726,5,14584},{50728,0,2529},{50729,9,14586},{50732,9,2530},
+{50735,6,2920},{50737,5,14590},{50739,9,2534},{50742,22,2922},
+{50748,13,14595},{50752,5,2540},{50754,5,14599},{50756,0,2542},
+{50757,9,14601},{50760,0,2543},{50761,25,14604},{50768,5,2544},
+{50770,0,14611},{50771,9,2546},{50774,21,14612},{50780,5,2549},
+{50782,5,14618},{50784,0,2551},{50785,41,14620},{50796,0,2552},
+{50797,5,14631},{50799,10,2928},{50802,21,14634},{50808,5,2555},
+{50810,5,14640},{50812,0,2557},{50813,9,14642},{50816,0,2558},
+{50817,25,14645},{50824,5,2559},{50826,14,2931},{50830,21,14654},
+{50836,5,2563},{50838,5,14660},{50840,0,2565},{50841,9,14662},
+{50844,0,2566},{50845,25,14665},{50852,5,2567},{50854,14,2935},
+{50858,21,14674},{50864,5,2571},{50866,5,14680},{50868,0,2573},
+{50869,9,14682},{50872,9,2574},{50875,17,14685},{50880,5,2577},
+{50882,14,2939},{50886,21,14692},{50892,5,2581},{50894,5,14698},
+{50896,0,2583},{50897,9,14700},{50900,0,2584},{50901,25,14703},
+{50908,5,2585},{50910,5,14710},{50912,5,2587},{50914,21,14712},
+{50920,5,2589},{50922,5,14718},{50924,0,2591},{50925,9,14720},
+{50928,0,2592},{50929,25,14723},{50936,5,2593},{50938,9,14730},
+{50941,0,2595},{50942,21,14733},{50948,5,2596},{50950,5,14739},
+{50952,0,2598},{50953,9,14741},{50956,0,2599},{50957,25,14744},
+{50964,5,2600},{50966,14,2943},{50970,21,14753},{50976,5,2604},
+{50978,5,14759},{50980,0,2606},{50981,9,14761},{50984,0,2607},
+{50985,25,14764},{50992,5,2608},{50994,22,2947},{51000,13,14774},
+{51004,5,2613},{51006,5,14778},{51008,0,2615},{51009,9,14780},
+{51012,0,2616},{51013,17,14783},{51018,6,2953},{51020,5,2618},
+{51022,10,2955},{51025,29,2621},{51033,9,14791},{51036,0,2629},
+{51037,9,14794},{51040,0,2630},{51041,25,14797},{51048,0,2631},
+{51049,5,14804},{51051,0,2632},{51052,29,14806},{51060,5,2633},
+{51062,5,14814},{51064,0,2635},{51065,9,14816},{51068,9,2636},
+{51071,13,14819},{51075,9,2639},{51078,0,14823},{51079,13,2642},
+{51083,9,14824},{51086,6,2958},{51088,5,2647},{51090,5,14828},
+{51092,6,2960},{51094,9,2650},{51097,6,2962},{51099,17,14832},
+{51104,5,2654},{51106,0,14837},{51107,13,2656},{51111,17,14838},
+{51116,5,2660},{51118,5,14843},{51120,0,2662},{51121,9,14845},
+{51124,0,2663},{51125,25,14848},{51132,5,2664},{51134,0,14855},
+{51135,9,2666},{51138,21,14856},{51144,5,2669},{51146,5,14862},
+{51148,18,2964},{51153,25,14866},{51160,0,2674},{51161,13,14873},
+{51165,0,2675},{51166,21,14877},{51172,0,2676},{51173,9,14883},
+{51176,0,2677},{51177,9,14886},{51180,0,2678},{51181,73,14889},
+{51200,5,2679},{51202,5,14908},{51204,0,2681},{51205,9,14910},
+{51208,10,2969},{51211,17,14914},{51216,5,2684},{51218,10,2972},
+{51221,5,2687},{51223,17,14921},{51228,5,2689},{51230,5,14926},
+{51232,0,2691},{51233,9,14928},{51236,0,2692},{51237,25,14931},
+{51244,5,2693},{51246,14,2975},{51250,21,14940},{51256,0,2697},
+{51257,9,14946},{51260,0,2698},{51261,9,14949},{51264,0,2699},
+{51265,25,14952},{51272,5,2700},{51274,5,14959},{51276,5,2702},
+{51278,21,14961},{51284,0,2704},{51285,105,14967},{51312,5,2705},
+{51314,5,14994},{51316,0,2707},{51317,9,14996},{51320,10,2979},
+{51323,17,15000},{51328,5,2710},{51330,10,2982},{51333,9,2713},
+{51336,9,15007},{51339,9,2716},{51342,21,15010},{51348,0,2719},
+{51349,29,15016},{51357,18,2985},{51362,21,15026},{51368,0,2723},
+{51369,73,15032},{51388,5,2724},{51390,21,15051},{51396,0,2726},
+{51397,9,15057},{51400,0,2727},{51401,9,15060},{51404,0,2728},
+{51405,25,15063},{51412,5,2729},{51414,14,2990},{51418,21,15072},
+{51424,5,2733},{51426,5,15078},{51428,0,2735},{51429,61,15080},
+{51445,0,2736},{51446,21,15096},{51452,5,2737},{51454,5,15102},
+{51456,0,2739},{51457,9,15104},{51460,9,2740},{51463,17,15107},
+{51468,5,2743},{51470,14,2994},{51474,21,15114},{51480,0,2747},
+{51481,73,15120},{51500,0,2748},{51501,25,15139},{51508,0,2749},
+{51509,105,15146},{51536,5,2750},{51538,5,15173},{51540,0,2752},
+{51541,9,15175},{51544,0,2753},{51545,25,15178},{51552,5,2754},
+{51554,6,2998},{51556,29,15186},{51564,0,2757},{51565,9,15194},
+{51568,0,2758},{51569,9,15197},{51572,0,2759},{51573,25,15200},
+{51580,0,2760},{51581,41,15207},{51592,5,2761},{51594,5,15218},
+{51596,0,2763},{51597,9,15220},{51600,0,2764},{51601,25,15223},
+{51608,5,2765},{51610,14,3000},{51614,133,15232},{51648,5,2769},
+{51650,5,15266},{51652,0,2771},{51653,5,15268},{51655,5,2772},
+{51657,6,3004},{51659,17,15271},{51664,5,2775},{51666,10,3006},
+{51669,5,2778},{51671,5,15278},{51673,5,2780},{51675,0,15280},
+{51676,5,2782},{51678,5,15281},{51680,18,3009},{51685,5,15285},
+{51687,0,2787},{51688,13,15287},{51692,5,2788},{51694,0,15291},
+{51695,9,2790},{51698,21,15292},{51704,5,2793},{51706,5,15298},
+{51708,0,2795},{51709,9,15300},{51712,0,2796},{51713,25,15303},
+{51720,5,2797},{51722,0,15310},{51723,9,2799},{51726,21,15311},
+{51732,0,2802},{51733,9,15317},{51736,0,2803},{51737,61,15320},
+{51753,0,2804},{51754,133,15336},{51788,5,2805},{51790,5,15370},
+{51792,0,2807},{51793,9,15372},{51796,0,2808},{51797,25,15375},
+{51804,5,2809},{51806,0,15382},{51807,9,2811},{51810,21,15383},
+{51816,0,2814},{51817,77,15389},{51837,0,2815},{51838,21,15409},
+{51844,0,2816},{51845,73,15415},{51864,0,2817},{51865,137,15434},
+{51900,5,2818},{51902,5,15469},{51904,0,2820},{51905,9,15471},
+{51908,0,2821},{51909,25,15474},{51916,5,2822},{51918,22,3014},
+{51924,13,15484},{51928,5,2827},{51930,21,15488},{51936,0,2829},
+{51937,41,15494},{51948,0,2830},{51949,25,15505},{51956,0,2831},
+{51957,73,15512},{51976,0,2832},{51977,25,15531},{51984,0,2833},
+{51985,9,15538},{51988,0,2834},{51989,9,15541},{51992,0,2835},
+{51993,25,15544},{52000,5,2836},{52002,121,15551},{52033,0,2838},
+{52034,21,15582},{52040,5,2839},{52042,5,15588},{52044,0,2841},
+{52045,9,15590},{52048,0,2842},{52049,25,15593},{52056,5,2843},
+{52058,9,15600},{52061,0,2845},{52062,21,15603},{52068,0,2846},
+{52069,73,15609},{52088,5,2847},{52090,133,15628},{52124,0,2849},
+{52125,105,15662},{52152,0,2850},{52153,105,15689},{52180,0,2851},
+{52181,57,15716},{52196,0,2852},{52197,5,15731},{52199,10,3020},
+{52202,133,15734},{52236,5,2855},{52238,5,15768},{52240,0,2857},
+{52241,9,15770},{52244,0,2858},{52245,25,15773},{52252,5,2859},
+{52254,9,15780},{52257,5,2861},{52259,13,15783},{52263,9,2863},
+{52266,5,15787},{52268,18,3023},{52273,25,15791},{52280,5,2869},
+{52282,0,15798},{52283,13,2871},{52287,17,15799},{52292,5,2875},
+{52294,5,15804},{52296,0,2877},{52297,9,15806},{52300,0,2878},
+{52301,25,15809},{52308,5,2879},{52310,0,15816},{52311,9,2881},
+{52314,21,15817},{52320,0,2884},{52321,9,15823},{52324,18,3028},
+{52329,25,15828},{52336,0,2888},{52337,13,15835},{52341,0,2889},
+{52342,133,15839},{52376,5,2890},{52378,5,15873},{52380,0,2892},
+{52381,9,15875},{52384,0,2893},{52385,25,15878},{52392,5,2894},
+{52394,0,15885},{52395,9,2896},{52398,21,15886},{52404,5,2899},
+{52406,5,15892},{52408,0,2901},{52409,9,15894},{52412,0,2902},
+{52413,25,15897},{52420,5,2903},{52422,14,3033},{52426,21,15906},
+{52432,0,2907},{52433,9,15912},{52436,0,2908},{52437,57,15915},
+{52452,0,2909},{52453,25,15930},{52460,0,2910},{52461,9,15937},
+{52464,0,2911},{52465,61,15940},{52481,0,2912},{52482,21,15956},
+{52488,5,2913},{52490,5,15962},{52492,0,2915},{52493,9,15964},
+{52496,0,2916},{52497,25,15967},{52504,5,2917},{52506,14,3037},
+{52510,21,15976},{52516,0,2921},{52517,9,15982},{52520,0,2922},
+{52521,9,15985},{52524,0,2923},{52525,45,15988},{52537,0,2924},
+{52538,133,16000},{52572,0,2925},{52573,9,16034},{52576,0,2926},
+{52577,9,16037},{52580,0,2927},{52581,25,16040},{52588,5,2928},
+{52590,14,3041},{52594,21,16049},{52600,0,2932},{52601,57,16055},
+{52616,0,2933},{52617,41,16070},{52628,5,2934},{52630,5,16081},
+{52632,0,2936},{52633,9,16083},{52636,0,2937},{52637,25,16086},
+{52644,5,2938},{52646,14,3045},{52650,21,16095},{52656,0,2942},
+{52657,73,16101},{52676,0,2943},{52677,25,16120},{52684,0,2944},
+{52685,9,16127},{52688,0,2945},{52689,89,16130},{52712,0,2946},
+{52713,9,16153},{52716,0,2947},{52717,9,16156},{52720,0,2948},
+{52721,25,16159},{52728,5,2949},{52730,14,3049},{52734,21,16168},
+{52740,0,2953},{52741,9,16174},{52744,0,2954},{52745,9,16177},
+{52748,0,2955},{52749,25,16180},{52756,0,2956},{52757,13,16187},
+{52761,0,2957},{52762,21,16191},{52768,5,2958},{52770,5,16197},
+{52772,0,2960},{52773,9,16199},{52776,0,2961},{52777,25,16202},
+{52784,5,2962},{52786,14,3053},{52790,133,16211},{52824,5,2966},
+{52826,5,16245},{52828,0,2968},{52829,5,16247},{52831,9,2969},
+{52834,21,16249},{52840,5,2972},{52842,14,3057},{52846,21,16257},
+{52852,5,2976},{52854,5,16263},{52856,0,2978},{52857,9,16265},
+{52860,0,2979},{52861,25,16268},{52868,5,2980},{52870,14,3061},
+{52874,21,16277},{52880,5,2984},{52882,5,16283},{52884,0,2986},
+{52885,9,16285},{52888,0,2987},{52889,25,16288},{52896,5,2988},
+{52898,0,16295},{52899,9,2990},{52902,21,16296},{52908,5,2993},
+{52910,73,16302},{52929,0,2995},{52930,133,16321},{52964,5,2996},
+{52966,5,16355},{52968,0,2998},{52969,5,16357},{52971,5,2999},
+{52973,25,16359},{52980,5,3001},{52982,0,16366},{52983,9,3003},
+{52986,21,16367},{52992,5,3006},{52994,5,16373},{52996,0,3008},
+{52997,9,16375},{53000,0,3009},{53001,25,16378},{53008,5,3010},
+{53010,14,3065},{53014,21,16387},{53020,0,3014},{53021,9,16393},
+{53024,0,3015},{53025,9,16396},{53028,0,3016},{53029,25,16399},
+{53036,5,3017},{53038,0,16406},{53039,9,3019},{53042,21,16407},
+{53048,0,3022},{53049,105,16413},{53076,5,3023},{53078,5,16440},
+{53080,0,3025},{53081,9,16442},{53084,0,3026},{53085,25,16445},
+{53092,5,3027},{53094,14,3069},{53098,21,16454},{53104,5,3031},
+{53106,5,16460},{53108,0,3033},{53109,9,16462},{53112,0,3034},
+{53113,25,16465},{53120,0,3035},{53121,13,16472},{53125,0,3036},
+{53126,21,16476},{53132,0,3037},{53133,77,16482},{53153,0,3038},
+{53154,21,16502},{53160,0,3039},{53161,25,16508},{53168,0,3040},
+{53169,73,16515},{53188,0,3041},{53189,105,16534},{53216,5,3042},
+{53218,5,16561},{53220,0,3044},{53221,9,16563},{53224,0,3045},
+{53225,25,16566},{53232,5,3046},{53234,14,3073},{53238,21,16575},
+{53244,0,3050},{53245,9,16581},{53248,0,3051},{53249,9,16584},
+{53252,0,3052},{53253,45,16587},{53265,0,3053},{53266,21,16599},
+{53272,0,3054},{53273,77,16605},{53293,0,3055},{53294,21,16625},
+{53300,5,3056},{53302,5,16631},{53304,0,3058},{53305,9,16633},
+{53308,0,3059},{53309,25,16636},{53316,5,3060},{53318,14,3077},
+{53322,21,16645},{53328,0,3064},{53329,9,16651},{53332,0,3065},
+{53333,9,16654},{53336,0,3066},{53337,25,16657},{53344,0,3067},
+{53345,41,16664},{53356,5,3068},{53358,5,16675},{53360,0,3070},
+{53361,9,16677},{53364,0,3071},{53365,25,16680},{53372,5,3072},
+{53374,9,16687},{53377,0,3074},{53378,133,16690},{53412,5,3075},
+{53414,5,16724},{53416,0,3077},{53417,9,16726},{53420,0,3078},
+{53421,25,16729},{53428,5,3079},{53430,14,3081},{53434,21,16738},
+{53440,5,3083},{53442,5,16744},{53444,0,3085},{53445,9,16746},
+{53448,5,3086},{53450,21,16749},{53456,5,3088},{53458,0,16755},
+{53459,9,3090},{53462,21,16756},{53468,5,3093},{53470,5,16762},
+{53472,0,3095},{53473,9,16764},{53476,0,3096},{53477,25,16767},
+{53484,5,3097},{53486,0,16774},{53487,9,3099},{53490,21,16775},
+{53496,0,3102},{53497,77,16781},{53517,0,3103},{53518,133,16801},
+{53552,5,3104},{53554,5,16835},{53556,0,3106},{53557,9,16837},
+{53560,10,3085},{53563,17,16841},{53568,5,3109},{53570,0,16846},
+{53571,9,3111},{53574,21,16847},{53580,5,3114},{53582,5,16853},
+{53584,0,3116},{53585,9,16855},{53588,0,3117},{53589,25,16858},
+{53596,5,3118},{53598,14,3088},{53602,21,16867},{53608,0,3122},
+{53609,9,16873},{53612,0,3123},{53613,57,16876},{53628,0,3124},
+{53629,25,16891},{53636,0,3125},{53637,9,16898},{53640,0,3126},
+{53641,89,16901},{53664,5,3127},{53666,5,16924},{53668,0,3129},
+{53669,9,16926},{53672,0,3130},{53673,25,16929},{53680,5,3131},
+{53682,14,3092},{53686,13,16938},{53690,10,3096},{53693,9,16943},
+{53696,0,3137},{53697,89,16946},{53720,0,3138},{53721,105,16969},
+{53748,0,3139},{53749,9,16996},{53752,0,3140},{53753,53,16999},
+{53767,10,3099},{53770,21,17014},{53776,0,3143},{53777,105,17020},
+{53804,5,3144},{53806,5,17047},{53808,0,3146},{53809,9,17049},
+{53812,0,3147},{53813,25,17052},{53820,5,3148},{53822,14,3102},
+{53826,21,17061},{53832,0,3152},{53833,73,17067},{53852,0,3153},
+{53853,25,17086},{53860,0,3154},{53861,105,17093},{53888,5,3155},
+{53890,5,17120},{53892,0,3157},{53893,9,17122},{53896,0,3158},
+{53897,25,17125},{53904,5,3159},{53906,9,17132},{53909,0,3161},
+{53910,21,17135},{53916,0,3162},{53917,9,17141},{53920,0,3163},
+{53921,9,17144},{53924,0,3164},{53925,25,17147},{53932,0,3165},
+{53933,13,17154},{53937,0,3166},{53938,21,17158},{53944,5,3167},
+{53946,5,17164},{53948,0,3169},{53949,5,17166},{53951,5,3170},
+{53953,6,3106},{53955,17,17169},{53960,5,3173},{53962,6,3108},
+{53964,29,17175},{53972,0,3176},{53973,9,17183},{53976,0,3177},
+{53977,9,17186},{53980,0,3178},{53981,25,17189},{53988,5,3179},
+{53990,37,17196},{54000,5,3181},{54002,5,17206},{54004,0,3183},
+{54005,9,17208},{54008,0,3184},{54009,25,17211},{54016,5,3185},
+{54018,14,3110},{54022,21,17220},{54028,9,3189},{54031,6,3114},
+{54033,9,17227},{54036,10,3116},{54039,17,17231},{54044,5,3195},
+{54046,0,17236},{54047,9,3197},{54050,9,17237},{54053,0,3200},
+{54054,5,17240},{54056,5,3201},{54058,5,17242},{54060,0,3203},
+{54061,9,17244},{54064,0,3204},{54065,25,17247},{54072,5,3205},
+{54074,0,17254},{54075,9,3207},{54078,21,17255},{54084,5,3210},
+{54086,213,17261},{54140,5,3212},{54142,5,17315},{54144,0,3214},
+{54145,9,17317},{54148,0,3215},{54149,25,17320},{54156,5,3216},
+{54158,0,17327},{54159,9,3218},{54162,21,17328},{54168,5,3221},
+{54170,5,17334},{54172,0,3223},{54173,9,17336},{54176,0,3224},
+{54177,25,17339},{54184,5,3225},{54186,14,3119},{54190,21,17348},
+{54196,0,3229},{54197,9,17354},{54200,0,3230},{54201,9,17357},
+{54204,0,3231},{54205,25,17360},{54212,5,3232},{54214,5,17367},
+{54216,5,3234},{54218,21,17369},{54224,0,3236},{54225,25,17375},
+{54232,0,3237},{54233,29,17382},{54241,10,3123},{54244,29,17391},
+{54252,5,3240},{54254,5,17399},{54256,0,3242},{54257,9,17401},
+{54260,0,3243},{54261,25,17404},{54268,5,3244},{54270,14,3126},
+{54274,21,17413},{54280,0,3248},{54281,77,17419},{54301,0,3249},
+{54302,133,17439},{54336,0,3250},{54337,9,17473},{54340,0,3251},
+{54341,89,17476},{54364,0,3252},{54365,9,17499},{54368,0,3253},
+{54369,9,17502},{54372,0,3254},{54373,29,17505},{54381,10,3130},
+{54384,29,17514},{54392,5,3257},{54394,5,17522},{54396,0,3259},
+{54397,5,17524},{54399,5,3260},{54401,6,3133},{54403,17,17527},
+{54408,5,3263},{54410,14,3135},{54414,21,17534},{54420,0,3267},
+{54421,77,17540},{54441,0,3268},{54442,133,17560},{54476,0,3269},
+{54477,9,17594},{54480,0,3270},{54481,9,17597},{54484,0,3271},
+{54485,25,17600},{54492,0,3272},{54493,5,17607},{54495,0,3273},
+{54496,29,17609},{54504,0,3274},{54505,9,17617},{54508,0,3275},
+{54509,9,17620},{54512,0,3276},{54513,25,17623},{54520,0,3277},
+{54521,5,17630},{54523,10,3139},{54526,21,17633},{54532,0,3280},
+{54533,9,17639},{54536,0,3281},{54537,9,17642},{54540,0,3282},
+{54541,25,17645},{54548,5,3283},{54550,6,3142},{54552,141,17653},
+{54588,5,3286},{54590,5,17689},{54592,0,3288},{54593,9,17691},
+{54596,0,3289},{54597,25,17694},{54604,5,3290},{54606,14,3144},
+{54610,21,17703},{54616,5,3294},{54618,5,17709},{54620,0,3296},
+{54621,9,17711},{54624,0,3297},{54625,13,17714},{54629,0,3298},
+{54630,5,17718},{54632,5,3299},{54634,14,3148},{54638,21,17722},
+{54644,5,3303},{54646,5,17728},{54648,0,3305},{54649,9,17730},
+{54652,0,3306},{54653,25,17733},{54660,5,3307},{54662,0,17740},
+{54663,9,3309},{54666,21,17741},{54672,0,3312},{54673,77,17747},
+{54693,0,3313},{54694,133,17767},{54728,5,3314},{54730,5,17801},
+{54732,0,3316},{54733,9,17803},{54736,10,3152},{54739,17,17807},
+{54744,5,3319},{54746,14,3155},{54750,21,17814},{54756,5,3323},
+{54758,5,17820},{54760,0,3325},{54761,9,17822},{54764,0,3326},
+{54765,25,17825},{54772,5,3327},{54774,14,3159},{54778,21,17834},
+{54784,5,3331},{54786,5,17840},{54788,0,3333},{54789,9,17842},
+{54792,0,3334},{54793,25,17845},{54800,5,3335},{54802,0,17852},
+{54803,9,3337},{54806,21,17853},{54812,0,3340},{54813,9,17859},
+{54816,0,3341},{54817,9,17862},{54820,0,3342},{54821,29,17865},
+{54829,0,3343},{54830,37,17873},{54840,5,3344},{54842,5,17883},
+{54844,0,3346},{54845,9,17885},{54848,0,3347},{54849,13,17888},
+{54853,0,3348},{54854,5,17892},{54856,5,3349},{54858,14,3163},
+{54862,9,17896},{54865,0,3353},{54866,5,17899},{54868,5,3354},
+{54870,5,17901},{54872,0,3356},{54873,9,17903},{54876,0,3357},
+{54877,37,17906},{54887,10,3167},{54890,21,17917},{54896,5,3360},
+{54898,5,17923},{54900,0,3362},{54901,53,17925},{54915,10,3170},
+{54918,21,17940},{54924,5,3365},{54926,5,17946},{54928,0,3367},
+{54929,9,17948},{54932,0,3368},{54933,29,17951},{54941,18,3173},
+{54946,21,17961},{54952,0,3372},{54953,9,17967},{54956,0,3373},
+{54957,9,17970},{54960,0,3374},{54961,29,17973},{54969,10,3178},
+{54972,29,17982},{54980,5,3377},{54982,5,17990},{54984,0,3379},
+{54985,9,17992},{54988,0,3380},{54989,13,17995},{54993,0,3381},
+{54994,5,17999},{54996,0,3382},{54997,5,18001},{54999,10,3181},
+{55002,21,18004},{55008,0,3385},{55009,9,18010},{55012,0,3386},
+{55013,9,18013},{55016,0,3387},{55017,25,18016},{55024,0,3388},
+{55025,13,18023},{55029,0,3389},{55030,21,18027},{55036,5,3390},
+{55038,5,18033},{55040,0,3392},{55041,9,18035},{55044,0,3393},
+{55045,45,18038},{55057,0,3394},{55058,21,18050},{55064,5,3395},
+{55066,5,18056},{55068,0,3397},{55069,9,18058},{55072,0,3398},
+{55073,25,18061},{55080,5,3399},{55082,14,3184},{55086,21,18070},
+{55092,5,3403},{55094,5,18076},{55096,0,3405},{55097,9,18078},
+{55100,0,3406},{55101,25,18081},{55108,0,3407},{55109,5,18088},
+{55111,10,3188},{55114,21,18091},{55120,5,3410},{55122,5,18097},
+{55124,6,3191},{55126,13,3413},{55130,21,18100},{55136,5,3417},
+{55138,14,3193},{55142,9,18108},{55145,0,3421},{55146,5,18111},
+{55148,0,3422},{55149,9,18113},{55152,0,3423},{55153,9,18116},
+{55156,0,3424},{55157,25,18119},{55164,5,3425},{55166,9,18126},
+{55169,0,3427},{55170,21,18129},{55176,5,3428},{55178,5,18135},
+{55180,0,3430},{55181,9,18137},{55184,0,3431},{55185,25,18140},
+{55192,5,3432},{55194,14,3197},{55198,21,18149},{63744,50,3201},
+{63757,25,4375},{63764,0,5800},{63765,9,4382},{63768,21,4386},
+{63774,9,4394},{63777,6,3214},{63779,5,4406},{63781,25,4409},
+{63788,5,4419},{63790,6,3216},{63792,5,4513},{63794,21,4517},
+{63800,9,4524},{63803,21,4528},{63809,9,4535},{63812,5,4541},
+{63814,9,4545},{63817,6,3218},{63819,13,4566},{63823,5,4571},
+{63825,0,4576},{63826,13,4604},{63830,13,4609},{63834,106,3220},
+{63861,9,4425},{63864,9,4429},{63867,9,4435},{63870,0,4439},
+{63871,5,4442},{63873,10,3247},{63876,5,4449},{63878,0,4453},
+{63879,21,4455},{63885,6,3250},{63887,5,4465},{63889,0,4161},
+{63890,9,4468},{63893,0,4162},{63894,5,4471},{63896,6,3252},
+{63898,5,4475},{63900,5,4478},{63902,0,6447},{63903,5,4481},
+{63905,18,3254},{63910,9,4487},{63913,6,3259},{63915,9,4493},
+{63918,10,3261},{63921,13,4501},{63925,0,4506},{63926,9,4508},
+{63929,0,5797},{63930,9,4551},{63933,10,3264},{63936,5,4556},
+{63938,5,4560},{63940,22,3267},{63946,5,4581},{63948,14,3273},
+{63952,13,4590},{63956,9,4595},{63959,13,4599},{63963,22,3277},
+{63969,5,4620},{63971,14,3283},{63975,9,4632},{63978,0,4636},
+{63979,5,4188},{63981,0,4638},{63982,9,4640},{63985,17,4644},
+{63990,0,4650},{63991,9,4653},{63994,70,3287},{65281,233,264},
+{65340,0,112},{65341,129,324},{65374,0,113},{65504,5,143},
+{65506,6,3305},{65509,6,3307},
+};
+
+static const unsigned short cmap_UniKS_UTF16_H_table[3309] = {
+155,107,98,668,176,138,130,244,104,206,842,675,
+177,751,748,752,209,131,673,676,768,132,766,669,
+760,761,670,762,671,764,672,765,772,678,771,674,
+767,677,770,202,205,204,207,200,203,8582,9326,9324,
+156,8763,263,260,247,250,248,251,249,8868,8865,8864,
+8869,8867,8815,8814,8854,195,8855,196,9190,9192,9191,9193,
+9198,9200,9199,9201,151,198,8715,152,184,8749,185,8750,
+180,136,8717,148,191,190,137,181,210,8321,8739,8723,
+154,8722,133,153,8734,8748,8747,8486,8488,8742,8503,149,
+8320,106,519,530,520,531,521,558,557,532,522,552,
+551,533,524,556,555,535,523,554,553,534,525,546,
+536,527,548,538,526,542,547,537,528,544,549,539,
+529,165,164,237,236,235,238,8736,167,166,8780,220,
+219,169,168,8779,218,217,163,162,228,227,8787,159,
+8639,161,160,158,157,241,240,242,9222,243,9223,226,
+221,224,225,239,255,252,6477,7499,4270,4458,5772,5077,
+6201,3901,7451,5255,5403,4253,4159,6488,7247,5504,3791,4077,
+3604,3481,5764,3804,7808,5580,6951,4840,4349,4027,4950,4819,
+6464,6125,6281,4788,8027,6956,4822,5196,4776,5774,5587,7867,
+6803,5129,7962,7521,5782,6210,3639,7741,6081,3806,6100,3521,
+5370,6189,6664,7610,4993,7600,4755,4791,4781,5709,5413,5710,
+7870,7755,4653,6900,4863,5896,6218,4519,6427,6428,6368,6357,
+5749,6502,6967,3930,5456,7158,6888,3496,5368,7232,7756,7709,
+6409,3644,3474,5921,3772,4355,5718,7512,6636,6892,6830,5755,
+7053,5756,7009,6389,6352,4634,4131,6568,4846,5147,6227,7203,
+5220,4744,7733,6307,6385,7757,7595,5221,5733,5625,7718,4661,
+3785,3765,3993,5910,6827,4527,4533,4726,4663,7927,5401,8018,
+6758,3766,5402,5222,6781,7359,4563,3946,8700,175,104,9330,
+261,662,592,650,665,259,614,663,607,8790,611,660,
+654,664,659,6460,6704,4670,6534,5320,5331,7616,7041,5181,
+5492,3893,5041,7882,4192,6029,4154,5241,7800,7614,5683,6380,
+3895,3613,5862,5092,5315,5242,6413,6252,6238,7801,6049,6705,
+4696,7670,3868,7685,5947,7710,3660,6706,4427,5771,6444,4038,
+3560,6483,5244,7380,6535,5110,5418,4250,4489,6414,3602,3561,
+7671,6415,4051,6050,4063,5074,5005,8005,5246,3436,4194,6591,
+7544,6284,6592,6861,6854,6198,5935,6461,5171,6509,5879,4989,
+6462,5247,3476,7015,3839,4506,4764,7966,7367,4440,3705,7241,
+5776,6051,6902,3661,7734,5248,7759,5737,5567,5111,4836,4269,
+7967,6395,3662,7043,4941,7337,3969,6837,3585,6030,4595,7394,
+6131,3438,3627,6285,7330,6708,6199,5303,5182,7262,6175,6052,
+6645,7177,5419,5075,8035,5249,6396,6903,6089,6359,6255,7772,
+7306,6783,8013,5420,3840,4016,7431,4735,7449,4155,6646,4429,
+6312,7499,3787,4591,7791,5043,4064,3898,6647,5864,4424,6784,
+4607,4333,4606,6390,8036,7904,3563,7167,6141,7303,5152,6684,
+6031,7490,5037,4614,5304,6759,5561,3970,7077,6484,3465,5301,
+4017,4397,6648,6480,6649,4018,5021,4577,6760,3619,3789,3440,
+4479,4024,6785,4169,3624,4334,6229,3510,4812,5685,4511,4766,
+5493,6619,4025,6510,4009,3899,4848,7547,5076,5183,7863,5151,
+6536,3841,4188,3900,5772,7149,6478,5686,6053,7994,4906,5185,
+6834,7395,7760,4800,6446,6287,3466,4390,6256,7332,3979,7618,
+6201,7044,4052,6202,7316,5568,6032,7251,3901,3729,3902,3730,
+6943,3994,5500,7500,3441,7432,7016,5250,6203,8023,3467,7663,
+4128,6620,4335,4749,7969,4616,7450,7711,6381,7534,8030,7317,
+4838,7970,5738,7802,4750,6944,3870,5841,7590,7664,6571,3767,
+7953,5252,6980,7169,4374,7971,7655,7150,7995,7883,8037,3501,
+6314,5336,4132,3871,5253,7338,5569,6868,5570,5254,4491,3733,
+7550,5902,6259,6258,4218,3511,6855,3581,3906,6260,6178,6905,
+5948,5117,4971,4069,3637,7459,3537,6355,5793,6142,5918,5060,
+6537,4273,3857,6002,4274,4241,6650,6057,6931,7720,4834,4319,
+6058,6538,4564,3842,3858,4536,5255,6470,6463,7804,5374,4071,
+5403,6135,5630,4190,7151,7433,5118,6143,5834,4072,4156,5094,
+3996,6869,7884,3708,5156,7730,7418,6360,6540,5404,5157,4159,
+4170,5936,5186,4697,6144,4039,6595,3734,5475,6289,6472,6145,
+3538,6864,6060,4134,5959,5739,4852,6261,3445,5573,5422,3872,
+6488,7754,3790,6481,6489,6832,6490,7955,3709,3735,5631,6522,
+6204,5574,5807,5553,6108,7427,7950,6838,3820,6870,6711,6109,
+6397,3580,5423,5759,6316,7885,7691,5960,5503,3446,5740,6180,
+5632,7116,6622,6263,4074,6450,4883,3907,7635,6205,5721,4664,
+7078,3803,7368,6061,6146,5760,4167,7117,5762,5258,3821,4553,
+6906,7253,5061,6541,6653,6291,6833,5763,4254,4275,5504,5697,
+6361,7136,3736,4186,4853,4180,3948,3587,3710,5699,5698,7335,
+4618,4075,6527,5575,3531,4870,5808,4421,4076,5843,3540,4854,
+3513,5375,5795,7152,6871,5640,5506,3791,6856,3874,3588,4077,
+6418,5261,7476,5547,3604,5700,7551,7973,6712,5796,7571,4996,
+4242,7536,3481,7530,4160,5045,7706,3482,4279,6857,5824,5377,
+3541,6181,7620,4483,4412,6872,6655,4803,7097,7537,3843,5961,
+6714,3605,7930,3964,6787,6451,5172,7854,7736,7807,4198,7792,
+5919,6230,7118,7578,6788,5225,7513,7098,6004,5173,6126,6715,
+7931,4600,7974,5378,3671,4280,4364,4972,5263,4422,5903,7906,
+5079,5642,4079,6452,7248,6947,4494,5264,7434,6421,5477,6264,
+6473,5643,5702,7932,6491,8010,7341,7636,6374,3468,4164,3793,
+5723,8031,6765,7637,5554,6656,6062,6320,7887,7254,5189,4268,
+7312,4281,7132,6321,7793,5797,7385,4178,5866,5478,7333,4872,
+7517,6398,6207,5844,3566,6265,6375,6492,3655,7435,7910,4675,
+3822,3469,7794,3567,3672,3544,7137,6168,7255,6208,4465,5237,
+8044,8043,7412,4873,3673,3483,7692,6391,6063,4815,4375,7934,
+7737,6399,4466,4243,3804,5667,5579,6369,5479,5781,3712,6657,
+8045,4446,4948,5507,7520,5424,7809,5191,5687,4080,3648,7477,
+5914,5380,7676,6686,5830,7266,4817,4165,4409,4909,4888,4136,
+3861,3589,7139,4931,7387,6148,3911,6835,7219,4973,3837,5724,
+4129,6934,5678,4137,6717,5963,4676,7763,4143,5962,5098,5265,
+4144,4166,5581,4283,4425,7119,7420,3795,7267,5929,6789,4804,
+6766,5883,7888,3629,7999,5867,5327,6149,4284,4910,7425,7447,
+5316,6150,7171,4932,7478,7261,4513,7153,6790,3674,4259,7399,
+4400,7079,3592,3875,7878,4401,5583,3739,6325,3568,4949,6718,
+5382,3876,4874,6064,7505,3517,5306,3675,5885,6719,6624,5125,
+5584,4484,7539,5193,4912,3768,5266,4027,7141,6512,7088,5267,
+5742,5904,5703,5426,6720,6464,4200,6952,6791,5644,6231,3777,
+5688,4952,7810,4751,7845,5161,4041,5950,5407,8019,5046,5480,
+6005,4712,6513,5704,7621,6232,5047,5836,6792,5705,6873,8046,
+5481,6066,7890,7935,7811,5743,4677,5062,3676,5408,7198,6721,
+3990,6722,3447,7988,8000,6293,5383,4140,5825,5886,6546,7795,
+7572,4459,4221,6152,7573,3769,6033,3678,3502,5385,6794,6793,
+6933,7206,7264,6281,6326,5302,7031,4798,4538,4788,4857,4691,
+5091,7080,7304,4620,7707,6575,7249,4085,5539,4975,3615,4337,
+5555,7492,4146,5409,3805,6954,3743,7531,4991,4773,3518,7365,
+5990,6327,3450,4157,6875,4579,5707,7127,5268,5645,6658,5386,
+4602,3877,4992,7704,4028,3631,6576,3616,7678,3713,4285,4338,
+5346,7891,4130,6577,7342,6110,7220,6067,4621,6767,3714,3778,
+5011,4858,4087,5049,6797,4020,4339,4245,6523,3715,4286,3823,
+5725,7268,7592,5452,7389,4820,7222,5932,6599,5646,7693,7269,
+6007,6988,4954,3915,7460,7104,7270,6548,4892,5585,7866,6239,
+5647,4015,4366,5915,4042,3620,6549,4287,3985,4448,6927,8027,
+7048,8028,3824,8029,7727,7889,6956,6726,7049,5063,4821,4460,
+3991,5837,6989,5648,5586,4485,5228,6402,3917,4309,6356,5196,
+7812,3918,5238,6009,6727,6929,3919,5938,7855,3545,6957,4091,
+5162,5765,4092,6079,6267,7679,5965,7370,4796,4234,4739,4849,
+7308,5272,6958,7506,5200,6331,7343,5512,3745,7179,5966,7914,
+7776,7154,4893,7556,7481,6388,4914,4878,7438,5889,4480,5454,
+7857,5649,8016,3845,6268,8032,7482,6687,6910,7813,4414,7694,
+7371,7764,3680,5513,5472,6184,7960,5967,3977,7344,5411,7961,
+4093,4288,6843,4568,4597,6382,7846,7199,5930,7155,7180,7892,
+6602,3520,6730,3593,4289,5274,4933,5801,6099,5455,7334,6294,
+4860,6578,7847,4976,4861,4223,5727,6731,7915,6453,7429,6269,
+4148,4582,3920,3716,6083,7105,4746,6493,7142,6579,4290,3780,
+4679,5905,7582,5970,6799,7640,4468,4680,6959,5589,7106,7033,
+4915,5634,6529,4515,5412,4224,6800,4341,5066,4639,6880,7514,
+7641,7446,7939,7063,3633,7402,4486,4175,6768,7818,6334,4403,
+6912,7778,4310,7642,6014,6370,4461,6732,5515,4539,4544,7779,
+5562,6514,6580,8021,6494,3846,7740,3594,7415,6881,6515,6696,
+7858,4383,4977,5163,4469,7992,4716,7893,7976,6801,6242,6253,
+4367,4326,4999,5975,6802,7064,5590,7243,5473,7985,5744,4292,
+6154,7731,7483,6587,6516,5129,5869,7962,5349,6422,6552,7521,
+7493,4311,5782,4778,4545,5388,4623,4624,7765,4415,7509,4729,
+5708,6836,5482,6604,4808,7901,6272,6080,5276,4214,7725,6496,
+5552,3923,6211,4094,4495,4260,4880,5308,7608,6992,7977,4384,
+5651,5067,6423,7713,7782,3999,6735,7743,4416,4625,5593,6663,
+5636,7404,7822,4095,4096,5102,6115,6844,3826,5993,4649,4043,
+5201,7484,7848,6212,4779,7302,5430,4173,7823,6019,6337,5389,
+5674,4585,6155,6084,6993,7783,4657,4097,4626,4895,3683,5025,
+7065,7583,7494,5768,7181,5371,5518,5068,6190,6664,6338,3532,
+5745,4149,6665,4235,4917,6995,7289,4825,4426,8008,6914,6424,
+7868,4246,3547,6883,7192,7610,5520,5519,7558,7599,3522,4215,
+6996,4342,6605,7022,7346,8022,4352,3686,6085,7143,7108,4918,
+4368,4935,3572,7920,6213,4978,5484,4293,6526,4731,3523,4919,
+7421,4862,3978,4780,3748,6037,5653,4558,7182,3621,4781,4060,
+5709,6404,4204,6134,3881,6961,7120,7373,4588,3687,4528,5847,
+5563,4546,7050,4450,4462,4923,5279,4103,6806,6963,6807,3595,
+7826,7290,5746,7869,6739,5081,5907,8052,4045,7870,4315,5597,
+5281,5053,4162,7273,3807,7229,7000,5838,6976,7349,7591,6809,
+6235,6977,4296,3454,3720,3749,3771,6628,6022,5366,6038,3965,
+3798,7024,7109,3966,6157,7067,4002,6689,4653,3689,6555,6900,
+7291,6770,4496,4031,6668,5654,5006,3849,7292,7456,4896,4107,
+6690,7921,6671,7522,6531,5524,7183,4487,5131,6884,6630,6811,
+6697,4434,7070,3582,5166,6812,3548,5873,7859,6217,8025,7895,
+5283,3865,6964,4056,5167,5525,4957,5367,6500,6886,7081,4571,
+5498,5526,3525,6846,7746,6813,3691,4924,4385,7747,7457,5284,
+3549,6743,5601,5602,6340,3550,4701,7173,7121,4109,7416,6517,
+4610,4742,4126,5208,7034,4207,7209,4881,7523,6117,7001,5855,
+7002,7828,6171,7294,5980,7257,6631,4826,6158,6978,5436,5689,
+7942,3722,4317,4405,4702,7643,6859,3854,5437,6405,4630,3583,
+5355,8033,6632,7322,5209,6160,4519,6501,4111,4782,6243,4472,
+7258,5488,6191,7200,4542,6368,6429,5638,5285,6815,4605,4113,
+3752,6965,3643,4958,3866,6358,6298,6865,4980,3533,6364,5394,
+7766,7324,7767,4722,3472,3695,3552,6120,5489,4179,6161,3608,
+6557,5082,5438,7461,4959,4667,5675,4228,7943,4176,4359,6559,
+4650,6967,7354,4261,7003,3930,5941,8034,5456,5286,7158,5657,
+4827,6888,7683,4960,4925,7390,4900,7749,3496,4436,3497,5368,
+6518,3967,5137,4360,3575,7830,5168,7487,6039,5769,6969,6244,
+4032,7274,4783,5783,6274,5995,7441,7233,7562,3933,5874,3754,
+6608,3755,7612,6921,4828,5017,3456,4784,7944,6455,4191,6192,
+5943,7234,7784,6431,7923,4631,6560,5138,5784,4668,4531,3949,
+7872,3756,4611,5213,7314,4297,4732,7532,6299,7831,6561,5876,
+7113,7832,5549,4684,5084,6504,5325,5527,6383,3981,7430,4829,
+7989,5319,5751,5396,7986,4406,5752,6564,4451,6040,4370,5877,
+5003,5609,4642,6816,4520,5529,5924,5028,3609,7133,7721,4521,
+6221,7834,3799,6817,5105,5753,6916,4452,7709,5981,7750,5668,
+7786,3934,6409,6275,4763,5610,7005,6582,4482,6042,6343,5070,
+6565,7566,5071,6304,4983,5086,7511,4298,7363,6745,5139,8026,
+7406,4114,7006,6890,6818,7533,5661,6043,3987,6673,8055,7873,
+7698,5358,6971,6457,5490,3725,4830,6075,3760,5558,6377,6819,
+6345,7194,7210,7699,6746,3498,6346,6506,5770,7593,6774,4785,
+5818,6305,5543,4965,3657,6442,3556,6634,4589,8011,4115,5953,
+6411,7090,5898,7837,6045,7586,5719,7512,6747,5140,6583,3800,
+5234,7875,7495,7423,3832,7129,6613,5499,6433,3992,7528,4718,
+4263,5218,7195,6432,4831,7626,5169,4547,6476,7947,6507,3460,
+7751,4719,7160,5142,3936,5364,6972,7315,6365,6941,4006,5143,
+4936,7028,4237,7161,3610,4301,7052,7797,6638,7145,4643,5755,
+3968,7053,5819,3988,3957,7196,4686,5073,3698,4438,7356,8003,
+4706,7174,4474,5055,4985,4599,5613,5087,6674,5944,7650,6276,
+7175,3888,5756,3761,5035,7009,6173,4177,6639,4902,7463,5559,
+3838,4302,7978,5954,7469,7299,3938,4303,3699,6615,7458,5399,
+4500,5545,6822,6917,5106,4475,6895,7010,4361,5614,6349,6246,
+7525,3812,7627,7925,4304,4216,6306,5550,4238,7212,6277,5532,
+6823,7054,4362,7162,5445,4561,3598,7602,6166,4720,7700,5615,
+7896,6434,4669,7788,4138,3526,7443,3939,6352,6749,7280,6519,
+4986,6896,4760,4387,7843,5313,6412,6567,7240,7798,4509,3584,
+5416,4634,6925,5871,4439,4635,4131,5566,6750,5146,7374,3622,
+7497,5329,6676,3534,3940,5670,6751,3941,5534,5664,4233,6753,
+4118,6678,3762,7059,4476,3813,7838,7011,3499,4882,3475,7667,
+5008,5996,5820,7668,3983,7473,7164,5029,5788,7391,4576,4724,
+3558,7543,7669,5470,5691,7146,6278,7012,6777,4612,4307,7661,
+4593,6226,4603,4264,5619,7926,3727,3636,6247,5849,4022,6778,
+6569,6520,5813,6254,5789,7037,3763,6919,6508,6097,6617,6826,
+5622,7285,6533,4636,4142,4847,5170,4502,4550,6754,7014,4868,
+4744,7715,7839,7757,6757,3701,7684,5665,6048,6124,4928,4328,
+7489,4504,3702,7464,6780,5857,5804,5221,5004,5551,4120,7362,
+6386,4929,5298,7569,5734,7716,5901,3989,7076,5448,4121,6167,
+4661,5909,7596,7358,5666,6899,4174,3942,7286,5536,3703,5955,
+7897,4455,5626,7213,3863,7849,4940,4995,4721,5108,4762,3773,
+4833,8012,6393,4526,4125,4534,3952,4745,5401,4457,4265,7305,
+6077,5040,6781,6585,1117,9377,1118,9413,1127,9442,1148,1160,
+9472,1161,9485,1167,9486,1168,9489,1172,9490,1178,9501,1179,
+9507,1182,9508,1183,9549,1196,9550,1197,1201,9571,1202,9588,
+1213,9589,9655,1230,9699,1242,9700,1243,9738,1250,9744,1253,
+9745,1256,9749,9750,1260,1261,9754,1262,9838,1284,1295,9871,
+1296,1306,9929,1307,9930,1308,9938,1311,9939,10052,1337,10053,
+1359,10156,1360,10157,1361,10158,1362,10163,1366,10164,1367,10210,
+1375,10211,1376,10218,1380,10227,1392,10228,1413,10302,1445,10382,
+1446,10388,1449,10389,1450,10459,1462,1467,10481,1468,10482,1469,
+10500,1477,10501,1478,10616,1501,10617,1504,10621,1505,1511,10652,
+1512,10658,1515,10659,1516,1517,10664,10665,1521,10749,1549,10757,
+1556,10758,1557,10759,1558,1559,10762,10835,1581,10836,1582,10840,
+1585,10841,1586,10842,1587,10843,1588,10910,1599,10958,1607,10959,
+1608,1616,11032,1617,11033,1618,11067,1629,11073,1632,11074,1633,
+1668,11223,11574,1719,11619,1730,11620,1731,1756,11678,1757,11725,
+1764,11743,1774,11744,1775,1787,11785,1788,11806,1795,11807,1796,
+11879,1806,11880,1807,1811,11901,1812,11902,1813,11921,1820,11922,
+1821,1830,11996,1831,12015,1838,12016,1839,12035,1846,12036,12080,
+1857,12081,1858,1861,12090,12096,1869,12097,1872,12100,1891,12176,
+1892,12182,1895,12183,12222,1915,1921,12258,1922,12264,1925,12265,
+1926,1934,12338,1935,12339,1936,1940,12360,1941,12369,1945,12377,
+1952,12378,1953,1954,12382,1959,12397,1960,12536,1980,12543,1986,
+12544,1987,12553,2000,12554,2001,12634,2022,12640,2025,12641,2042,
+12678,12710,2052,12721,2056,12722,2057,12837,2080,12838,2081,12842,
+2084,2097,12933,2098,12952,2105,2109,12994,2110,13000,2113,13001,
+2120,13011,2121,2173,13333,2174,13513,2188,13514,2189,13566,2219,
+13567,2220,2240,13609,13672,2266,2267,13676,2268,13682,2271,13683,
+2272,13747,2290,13768,2297,13769,2298,13787,2306,13788,2307,13789,
+2308,13790,13791,2311,13852,2325,13853,2326,2331,13875,2332,13893,
+2340,13894,2341,13939,2350,13940,2351,2352,13945,2375,14044,2376,
+14142,2390,2422,14389,2423,14440,2437,14441,2438,14490,2471,14491,
+2472,2473,14495,14528,2494,14529,2495,14530,14543,2502,14544,2503,
+14551,2507,2508,14555,14589,2533,14592,2537,14593,2538,14594,2539,
+2553,14633,2554,14652,2561,14653,2562,14672,2569,14673,2570,14690,
+2579,14691,2580,14751,2602,14752,2603,14771,2610,14772,2611,14773,
+2612,2617,14788,14789,2620,14790,2646,14827,2649,14830,14831,2653,
+2671,14864,2672,14865,2673,2682,14913,2683,14919,2686,14920,14938,
+2695,14939,2696,2708,14999,2709,15005,2712,15006,2720,15024,2721,
+15025,2722,15070,2731,15071,2732,15112,2745,15113,2746,15185,2756,
+15230,2767,15231,2768,15270,2774,15276,2777,15277,2784,15283,2785,
+15284,2786,15481,2824,15482,2825,15483,2826,2853,15733,2854,2866,
+15789,2867,15790,2868,2885,15826,2886,15827,2887,15904,2905,15905,
+2906,15974,2919,15975,2920,16047,2930,16048,2931,16093,2940,16094,
+2941,16166,2951,16167,2952,16209,2964,16210,2965,16255,2974,16256,
+2975,16275,2982,16276,2983,16385,3012,16386,3013,16452,3029,16453,
+3030,16573,3048,16574,3049,16643,3062,16644,3063,16736,3081,16737,
+3082,3107,16840,3108,16865,3120,16866,3121,16936,3133,16937,3134,
+3135,16942,3136,3141,17013,3142,17059,3150,17060,3151,17168,3172,
+17174,3175,17218,3187,17219,3188,17226,3192,3193,17230,3194,17346,
+3227,17347,3228,3238,17390,3239,17411,3246,17412,3247,3255,17513,
+3256,17526,3262,17532,3265,17533,3266,3278,17632,3279,17652,3285,
+17701,3292,17702,3293,17720,3301,17721,3302,3317,17806,3318,17812,
+3321,17813,3322,17832,3329,17833,3330,17894,3351,17895,3352,3358,
+17916,3359,3363,17939,3364,3369,17959,3370,17960,3371,3375,17981,
+3376,3383,18003,3384,18068,3401,18069,3402,3408,18090,3409,3412,
+18099,18106,3419,18107,3420,18147,3434,18148,3435,4116,3678,7053,
+3460,7900,3802,3902,3946,3946,3708,4131,4374,4156,4399,4403,
+4424,4511,4550,4564,4318,4136,5800,4139,4192,4167,4172,5552,
+6424,5151,4922,7518,5079,5109,7607,5584,5367,7083,5362,5485,
+6001,5460,5317,7009,7370,5678,5874,4159,4444,4447,4463,4160,
+4474,4473,5460,4483,4163,4166,4485,4491,4167,7783,4497,4499,
+4180,4555,5800,4563,7988,6123,4577,4183,4579,4584,4586,4588,
+4184,5552,4603,4614,4616,4618,5950,4187,4625,4627,4629,5351,
+6494,5731,5771,4191,6484,6684,4279,7139,4247,4266,4340,7572,
+5088,7709,3558,3644,3815,194,357,145,323,
+};
+
+static pdf_cmap cmap_UniKS_UTF16_H = {
+	-1, "UniKS-UTF16-H", "", 0, 0, 3,
+	{ {2,0,55295},{4,56320,57343},{2,57344,65535}, },
+	6390, 6390, (pdf_range*) cmap_UniKS_UTF16_H_ranges,
+	3309, 3309, (unsigned short*) cmap_UniKS_UTF16_H_table,
+};
+
+/* UniKS-UTF16-V */
+
+static const pdf_range cmap_UniKS_UTF16_V_ranges[] = {
+{8211,5,8059},{8214,0,8061},{8229,0,8058},{12289,5,8056},
+{12296,37,8065},{12307,0,8075},{12308,5,8063},{65281,0,8076},
+{65288,5,8077},{65292,0,8079},{65294,0,8080},{65306,21,8081},
+{65339,0,8087},{65341,0,8088},{65343,0,8089},{65371,9,8090},
+{65374,0,8062},{65507,0,8093},
+};
+
+static const unsigned short cmap_UniKS_UTF16_V_table[] = { 0 };
+
+static pdf_cmap cmap_UniKS_UTF16_V = {
+	-1, "UniKS-UTF16-V", "UniKS-UTF16-H", 0, 1, 0,
+	{ {0,0,0}, },
+	18, 18, (pdf_range*) cmap_UniKS_UTF16_V_ranges,
+	0, 0, (unsigned short*) cmap_UniKS_UTF16_V_table,
+};
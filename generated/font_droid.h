@@ -0,0 +1,12441 @@
+#ifndef __STRICT_ANSI__
+#if defined(__linux__) || defined(__FreeBSD__)
+#define HAVE_INCBIN
+#endif
+#endif
+
+#ifdef HAVE_INCBIN
+extern const unsigned char pdf_font_DroidSans[190776];
+asm(".globl pdf_font_DroidSans");
+asm(".balign 8");
+asm("pdf_font_DroidSans:");
+asm(".incbin \"fonts/droid/DroidSans.ttf\"");
+#else
+static const unsigned char pdf_font_DroidSans[190776] = {
+0,1,0,0,0,19,1,0,0,4,0,48,71,68,69,70,0,38,3,138,0,2,63,104,0,0,0,30,71,80,
+79,83,242,135,173,167,0,2,63,136,0,0,169,142,71,83,85,66,108,145,116,143,
+0,2,233,24,0,0,0,32,76,84,83,72,216,155,196,62,0,0,16,44,0,0,3,137,79,83,
+47,50,160,203,149,139,0,0,1,184,0,0,0,96,99,109,97,112,2,94,9,135,0,0,86,
+216,0,0,8,54,99,118,116,32,57,126,62,76,0,0,105,4,0,0,1,252,102,112,103,109,
+115,211,35,176,0,0,95,16,0,0,7,5,103,97,115,112,0,4,0,7,0,2,63,92,0,0,0,12,
+103,108,121,102,150,0,169,153,0,0,114,12,0,1,169,76,104,100,109,120,149,161,
+91,175,0,0,19,184,0,0,67,32,104,101,97,100,239,41,116,204,0,0,1,60,0,0,0,
+54,104,104,101,97,12,83,9,169,0,0,1,116,0,0,0,36,104,109,116,120,225,158,
+46,221,0,0,2,24,0,0,14,20,108,111,99,97,95,74,202,46,0,0,107,0,0,0,7,12,109,
+97,120,112,6,57,2,133,0,0,1,152,0,0,0,32,110,97,109,101,181,90,144,86,0,2,
+27,88,0,0,6,162,112,111,115,116,155,239,89,140,0,2,33,252,0,0,29,93,112,114,
+101,112,130,220,33,19,0,0,102,24,0,0,2,236,0,1,0,0,0,1,0,0,227,159,8,60,95,
+15,60,245,0,25,8,0,0,0,0,0,193,154,51,0,0,0,0,0,201,126,246,154,251,137,253,
+213,9,90,8,98,0,0,0,6,0,2,0,0,0,0,0,0,0,1,0,0,7,109,254,29,0,0,9,100,251,
+137,254,162,9,90,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,133,0,1,0,0,3,133,0,160,
+0,22,0,122,0,5,0,2,0,16,0,47,0,90,0,0,2,43,1,57,0,3,0,1,0,3,4,153,1,144,0,
+5,0,8,5,154,5,51,0,0,1,30,5,154,5,51,0,0,3,208,0,102,1,242,0,0,2,11,6,6,3,
+8,4,2,2,4,224,0,2,239,64,0,32,91,0,0,0,40,0,0,0,0,49,65,83,67,0,64,0,32,255,
+253,6,31,254,20,0,132,7,109,1,227,32,0,1,159,0,0,0,0,4,74,5,182,0,0,0,32,
+0,2,4,205,0,193,0,0,0,0,4,20,0,0,2,20,0,0,2,39,0,147,3,55,0,133,5,43,0,51,
+4,104,0,123,6,154,0,102,5,158,0,109,1,207,0,133,2,104,0,82,2,104,0,61,4,104,
+0,82,4,104,0,102,2,0,0,63,2,147,0,82,2,37,0,147,2,252,0,20,4,104,0,98,4,104,
+0,178,4,104,0,96,4,104,0,82,4,104,0,23,4,104,0,131,4,104,0,113,4,104,0,90,
+4,104,0,106,4,104,0,106,2,37,0,147,2,37,0,63,4,104,0,102,4,104,0,102,4,104,
+0,102,3,104,0,37,6,238,0,109,4,221,0,0,4,248,0,199,4,211,0,125,5,121,0,199,
+4,57,0,199,3,238,0,199,5,133,0,125,5,156,0,199,2,182,0,82,2,43,255,72,4,162,
+0,199,3,238,0,199,6,246,0,199,5,213,0,199,5,240,0,125,4,156,0,199,5,240,0,
+125,4,184,0,199,4,39,0,104,4,39,0,20,5,150,0,184,4,139,0,0,7,18,0,20,4,96,
+0,0,4,55,0,0,4,80,0,82,2,109,0,164,2,252,0,23,2,109,0,51,4,66,0,41,3,74,255,
+252,4,158,1,137,4,63,0,94,4,176,0,174,3,180,0,113,4,176,0,113,4,72,0,113,
+2,162,0,29,4,37,0,37,4,182,0,174,2,18,0,160,2,18,255,188,3,248,0,174,2,18,
+0,174,7,43,0,174,4,182,0,174,4,158,0,113,4,176,0,174,4,176,0,113,3,49,0,174,
+3,156,0,90,2,182,0,33,4,182,0,164,3,213,0,0,5,248,0,20,4,0,0,35,3,233,0,10,
+3,135,0,82,2,213,0,61,4,104,1,233,2,213,0,51,4,104,0,102,2,20,0,0,2,39,0,
+147,4,104,0,188,4,104,0,68,4,104,0,123,4,104,0,29,4,104,1,233,3,227,0,121,
+4,158,1,51,6,168,0,100,2,166,0,68,3,229,0,82,4,104,0,102,2,147,0,82,6,168,
+0,100,4,0,255,250,3,109,0,123,4,104,0,102,2,166,0,49,2,166,0,31,4,158,1,137,
+4,193,0,174,5,61,0,113,2,37,0,147,1,164,0,35,2,166,0,63,2,205,0,66,3,229,
+0,84,5,229,0,63,5,229,0,44,5,229,0,31,3,104,0,68,4,221,0,0,4,221,0,0,4,221,
+0,0,4,221,0,0,4,221,0,0,4,221,0,0,6,209,255,254,4,211,0,125,4,57,0,199,4,
+57,0,199,4,57,0,199,4,57,0,199,2,182,0,62,2,182,0,82,2,182,0,17,2,182,0,64,
+5,121,0,47,5,213,0,199,5,240,0,125,5,240,0,125,5,240,0,125,5,240,0,125,5,
+240,0,125,4,104,0,141,5,240,0,125,5,150,0,184,5,150,0,184,5,150,0,184,5,150,
+0,184,4,55,0,0,4,156,0,199,4,209,0,174,4,63,0,94,4,63,0,94,4,63,0,94,4,63,
+0,94,4,63,0,94,4,63,0,94,6,170,0,94,3,180,0,113,4,72,0,113,4,72,0,113,4,72,
+0,113,4,72,0,113,2,18,255,222,2,18,0,174,2,18,255,189,2,18,255,238,4,158,
+0,111,4,182,0,174,4,158,0,113,4,158,0,113,4,158,0,113,4,158,0,113,4,158,0,
+113,4,104,0,102,4,158,0,115,4,182,0,164,4,182,0,164,4,182,0,164,4,182,0,164,
+3,233,0,10,4,176,0,174,3,233,0,10,4,221,0,0,4,63,0,94,4,221,0,0,4,63,0,94,
+4,221,0,0,4,63,0,94,4,211,0,125,3,180,0,113,4,211,0,125,3,180,0,113,4,211,
+0,125,3,180,0,113,4,211,0,125,3,180,0,113,5,121,0,199,4,176,0,113,5,121,0,
+47,4,176,0,113,4,57,0,199,4,72,0,113,4,57,0,199,4,72,0,113,4,57,0,199,4,72,
+0,113,4,57,0,199,4,72,0,113,4,57,0,199,4,72,0,113,5,133,0,125,4,37,0,37,5,
+133,0,125,4,37,0,37,5,133,0,125,4,37,0,37,5,133,0,125,4,37,0,37,5,156,0,199,
+4,182,0,174,5,156,0,0,4,182,0,18,2,182,255,245,2,18,255,163,2,182,0,61,2,
+18,255,235,2,182,0,48,2,18,255,222,2,182,0,82,2,18,0,68,2,182,0,82,2,18,0,
+174,4,225,0,82,4,37,0,160,2,43,255,72,2,18,255,188,4,162,0,199,3,248,0,174,
+3,248,0,174,3,238,0,199,2,18,0,171,3,238,0,199,2,18,0,102,3,238,0,199,2,18,
+0,174,3,238,0,199,2,102,0,174,3,238,0,29,2,18,255,246,5,213,0,199,4,182,0,
+174,5,213,0,199,4,182,0,174,5,213,0,199,4,182,0,174,5,70,255,255,5,213,0,
+199,4,182,0,174,5,240,0,125,4,158,0,113,5,240,0,125,4,158,0,113,5,240,0,125,
+4,158,0,113,7,31,0,125,7,72,0,113,4,184,0,199,3,49,0,174,4,184,0,199,3,49,
+0,96,4,184,0,199,3,49,0,114,4,39,0,104,3,156,0,90,4,39,0,104,3,156,0,90,4,
+39,0,104,3,156,0,90,4,39,0,104,3,156,0,90,4,39,0,20,2,182,0,33,4,39,0,20,
+2,182,0,33,4,39,0,20,2,182,0,33,5,150,0,184,4,182,0,164,5,150,0,184,4,182,
+0,164,5,150,0,184,4,182,0,164,5,150,0,184,4,182,0,164,5,150,0,184,4,182,0,
+164,5,150,0,184,4,182,0,164,7,18,0,20,5,248,0,20,4,55,0,0,3,233,0,10,4,55,
+0,0,4,80,0,82,3,135,0,82,4,80,0,82,3,135,0,82,4,80,0,82,3,135,0,82,2,76,0,
+174,4,104,0,203,4,221,0,0,4,63,0,94,6,209,255,254,6,170,0,94,5,240,0,125,
+4,158,0,115,4,39,0,104,3,156,0,90,4,158,1,2,4,158,1,2,4,117,1,27,4,158,1,
+33,2,18,0,160,4,158,1,109,1,123,0,31,4,158,1,2,4,158,0,223,4,158,1,248,4,
+158,1,20,4,221,255,233,2,37,0,147,4,201,255,231,6,23,255,231,3,178,255,231,
+6,66,255,231,5,84,255,231,6,74,255,231,2,158,255,228,4,221,0,0,4,248,0,199,
+3,238,0,199,4,139,0,37,4,57,0,199,4,80,0,82,5,156,0,199,5,240,0,125,2,182,
+0,82,4,162,0,199,4,139,0,0,6,246,0,199,5,213,0,199,4,63,0,82,5,240,0,125,
+5,135,0,199,4,156,0,199,4,66,0,78,4,39,0,20,4,55,0,0,6,35,0,104,4,96,0,0,
+6,35,0,104,5,240,0,78,2,182,0,64,4,55,0,0,4,176,0,113,3,160,0,90,4,182,0,
+174,2,158,0,164,4,184,0,164,4,176,0,113,4,209,0,174,3,233,0,10,4,158,0,111,
+3,160,0,90,3,164,0,113,4,182,0,174,4,135,0,113,2,158,0,164,3,248,0,174,4,
+23,255,242,4,193,0,174,4,35,0,0,3,164,0,113,4,158,0,113,5,10,0,25,4,158,0,
+164,3,164,0,113,4,180,0,113,3,152,0,18,4,184,0,164,5,150,0,113,4,49,255,236,
+5,236,0,164,6,6,0,113,2,158,0,21,4,184,0,164,4,158,0,113,4,184,0,164,6,6,
+0,113,4,57,0,199,5,160,0,20,3,238,0,199,4,211,0,125,4,39,0,104,2,182,0,82,
+2,182,0,64,2,43,255,72,7,72,0,0,7,117,0,199,5,160,0,20,4,162,0,199,4,174,
+0,25,5,135,0,199,4,221,0,0,4,156,0,199,4,248,0,199,3,238,0,199,5,51,0,14,
+4,57,0,199,6,133,0,4,4,92,0,72,5,213,0,201,5,213,0,201,4,162,0,199,5,90,0,
+0,6,246,0,199,5,156,0,199,5,240,0,125,5,135,0,199,4,156,0,199,4,211,0,125,
+4,39,0,20,4,174,0,25,6,35,0,104,4,96,0,0,5,154,0,199,5,72,0,166,7,250,0,199,
+7,250,0,199,5,61,0,20,6,150,0,199,4,156,0,199,4,193,0,59,8,29,0,199,4,184,
+0,25,4,63,0,94,4,143,0,117,4,137,0,174,3,51,0,174,4,96,0,41,4,72,0,113,5,
+195,0,4,3,174,0,68,4,233,0,174,4,233,0,174,3,238,0,174,4,94,0,16,5,190,0,
+174,4,233,0,174,4,158,0,113,4,193,0,174,4,176,0,174,3,180,0,113,3,135,0,41,
+3,233,0,10,5,147,0,113,4,0,0,35,4,209,0,174,4,172,0,154,6,244,0,174,7,4,0,
+174,5,109,0,41,5,254,0,174,4,137,0,174,3,178,0,55,6,121,0,174,4,63,0,35,4,
+72,0,113,4,182,0,18,3,51,0,174,3,180,0,113,3,156,0,90,2,18,0,160,2,18,255,
+238,2,18,255,188,6,131,0,16,6,229,0,174,4,182,0,18,3,238,0,174,3,233,0,10,
+4,193,0,174,3,238,0,199,3,51,0,174,7,18,0,20,5,248,0,20,7,18,0,20,5,248,0,
+20,7,18,0,20,5,248,0,20,4,55,0,0,3,233,0,10,4,0,0,82,8,0,0,82,8,0,0,82,3,
+74,255,252,1,102,0,23,1,102,0,23,2,0,0,63,1,102,0,25,2,231,0,23,2,231,0,23,
+3,129,0,63,3,227,0,123,3,248,0,123,3,2,0,150,6,111,0,147,9,90,0,102,1,207,
+0,133,3,55,0,133,2,78,0,82,2,78,0,82,3,246,0,147,1,10,254,160,2,248,0,106,
+4,104,0,96,4,104,0,68,6,0,0,150,4,104,0,63,6,104,0,141,4,0,0,119,7,231,0,
+199,5,254,0,37,5,240,0,78,4,244,0,102,6,14,0,83,6,14,0,51,6,14,0,79,6,14,
+0,113,4,166,0,98,4,139,0,41,5,238,0,199,5,12,0,74,4,104,0,102,4,100,0,37,
+5,168,0,119,3,25,0,16,4,104,0,102,4,104,0,102,4,104,0,102,4,104,0,102,4,170,
+0,109,4,180,0,29,4,180,0,29,4,158,0,207,2,18,255,188,4,0,1,135,4,0,1,111,
+4,0,1,125,2,166,0,37,2,166,0,12,2,166,0,59,2,166,0,37,2,166,0,47,2,166,0,
+49,2,166,0,33,4,0,0,0,8,0,0,0,4,0,0,0,8,0,0,0,2,171,0,0,2,0,0,0,1,85,0,0,
+4,104,0,0,2,37,0,0,1,154,0,0,0,205,0,0,0,0,0,0,0,0,0,0,8,0,0,84,8,0,0,84,
+2,18,255,188,1,102,0,23,4,205,0,10,4,82,0,0,6,160,0,18,6,246,0,199,7,43,0,
+174,4,221,0,0,4,63,0,94,6,66,254,211,2,170,0,115,3,51,0,147,7,86,0,29,7,86,
+0,29,5,240,0,125,4,170,0,113,5,244,0,184,5,47,0,164,0,0,252,143,0,0,253,72,
+0,0,252,70,0,0,253,4,0,0,253,49,4,57,0,199,5,213,0,201,4,72,0,113,4,233,0,
+174,7,219,0,125,6,111,0,0,5,37,0,20,4,221,0,20,7,39,0,199,5,182,0,174,5,47,
+0,0,4,100,0,10,7,41,0,199,6,18,0,174,5,127,0,20,4,240,0,10,7,139,0,199,6,
+162,0,174,4,94,0,57,3,174,0,23,6,35,0,104,5,236,0,164,5,240,0,125,4,158,0,
+113,4,193,0,0,3,221,0,0,4,193,0,0,3,221,0,0,9,100,0,125,8,88,0,113,6,63,0,
+125,5,25,0,113,7,178,0,125,6,80,0,113,7,219,0,125,6,111,0,0,4,211,0,125,3,
+180,0,113,4,223,0,104,4,117,0,201,4,158,0,244,4,158,1,225,4,158,1,225,7,233,
+0,41,7,166,0,41,5,231,0,201,4,252,0,174,4,156,0,47,4,137,0,18,4,156,0,199,
+4,176,0,174,3,238,0,47,3,51,0,18,5,0,0,199,4,8,0,174,6,233,0,4,6,35,0,4,4,
+92,0,72,3,174,0,68,5,10,0,199,4,74,0,174,4,162,0,199,4,43,0,174,4,162,0,47,
+3,248,0,18,5,68,0,20,4,209,0,41,5,205,0,229,4,250,0,174,6,92,0,229,5,172,
+0,174,8,68,0,199,6,184,0,174,5,236,0,125,4,242,0,113,4,211,0,125,3,180,0,
+113,4,39,0,20,3,135,0,41,4,55,0,0,3,213,0,0,4,55,0,0,3,213,0,0,4,211,0,0,
+4,61,0,35,6,137,0,20,5,139,0,41,5,72,0,166,4,188,0,154,5,72,0,166,4,172,0,
+154,5,72,0,199,4,172,0,174,6,119,0,61,5,29,0,51,6,119,0,61,5,29,0,51,2,182,
+0,82,6,133,0,4,5,195,0,4,5,74,0,199,4,45,0,174,5,106,0,0,4,113,0,16,5,156,
+0,229,4,233,0,174,5,203,0,229,4,252,0,174,5,72,0,166,4,172,0,154,7,6,0,199,
+5,209,0,174,2,182,0,82,4,221,0,0,4,63,0,94,4,221,0,0,4,63,0,94,6,209,255,
+254,6,170,0,94,4,57,0,199,4,72,0,113,5,143,0,113,4,72,0,102,5,143,0,113,4,
+72,0,102,6,133,0,4,5,195,0,4,4,92,0,72,3,174,0,68,4,92,0,72,3,184,0,27,5,
+213,0,201,4,233,0,174,5,213,0,201,4,233,0,174,5,240,0,125,4,158,0,113,5,240,
+0,125,4,158,0,113,5,240,0,125,4,158,0,113,4,193,0,59,3,178,0,55,4,174,0,25,
+3,233,0,10,4,174,0,25,3,233,0,10,4,174,0,25,3,233,0,10,5,72,0,166,4,172,0,
+154,3,238,0,199,3,51,0,174,6,150,0,199,5,254,0,174,3,238,0,47,3,51,0,18,4,
+195,0,0,4,47,0,35,4,96,0,0,4,0,0,35,4,156,0,137,4,176,0,113,6,244,0,137,6,
+254,0,113,6,252,0,78,6,70,0,80,4,197,0,78,4,16,0,80,7,164,0,0,6,164,0,16,
+7,229,0,199,7,47,0,174,5,195,0,125,4,225,0,113,5,129,0,20,5,18,0,41,4,92,
+0,111,3,174,0,92,5,90,0,0,4,94,0,16,4,221,0,0,4,63,0,94,4,221,0,0,4,63,0,
+94,4,221,0,0,4,63,0,94,4,221,0,0,4,63,0,18,4,221,0,0,4,63,0,94,4,221,0,0,
+4,63,0,94,4,221,0,0,4,63,0,94,4,221,0,0,4,63,0,94,4,221,0,0,4,63,0,94,4,221,
+0,0,4,63,0,94,4,221,0,0,4,63,0,94,4,221,0,0,4,63,0,94,4,57,0,199,4,72,0,113,
+4,57,0,199,4,72,0,113,4,57,0,199,4,72,0,113,4,57,0,199,4,72,0,113,4,57,0,
+39,4,72,0,18,4,57,0,199,4,72,0,113,4,57,0,199,4,72,0,113,4,57,0,199,4,72,
+0,113,2,182,0,82,2,18,0,98,2,182,0,82,2,18,0,158,5,240,0,125,4,158,0,113,
+5,240,0,125,4,158,0,113,5,240,0,125,4,158,0,113,5,240,0,125,4,158,0,51,5,
+240,0,125,4,158,0,113,5,240,0,125,4,158,0,113,5,240,0,125,4,158,0,113,5,240,
+0,125,4,170,0,113,5,240,0,125,4,170,0,113,5,240,0,125,4,170,0,113,5,240,0,
+125,4,170,0,113,5,240,0,125,4,170,0,113,5,150,0,184,4,182,0,164,5,150,0,184,
+4,182,0,164,5,244,0,184,5,47,0,164,5,244,0,184,5,47,0,164,5,244,0,184,5,47,
+0,164,5,244,0,184,5,47,0,164,5,244,0,184,5,47,0,164,4,55,0,0,3,233,0,10,4,
+55,0,0,3,233,0,10,4,55,0,0,3,233,0,10,4,176,0,113,0,0,251,219,0,0,252,106,
+0,0,251,137,0,0,252,106,0,0,252,100,0,0,252,115,0,0,252,115,0,0,252,115,0,
+0,252,100,1,164,0,49,1,164,0,16,1,164,0,16,4,176,0,113,4,39,0,20,2,182,0,
+33,0,0,3,133,1,1,1,26,40,24,1,1,10,1,43,1,1,10,11,22,1,20,5,11,11,11,11,11,
+11,11,11,11,11,20,20,11,11,11,28,11,38,34,20,11,1,18,11,21,25,21,21,20,28,
+25,34,19,34,22,27,27,21,23,16,16,38,18,1,5,1,32,1,1,17,11,28,11,21,42,25,
+46,12,12,10,12,24,46,21,11,11,18,42,11,46,25,11,26,22,18,25,24,25,11,26,40,
+11,11,11,11,24,21,1,4,20,39,11,1,4,1,16,11,17,17,1,18,11,20,1,17,10,39,1,
+1,10,28,38,38,38,38,38,38,1,20,1,1,1,1,25,25,25,25,11,25,34,34,34,34,34,11,
+34,21,21,21,21,38,19,22,17,17,17,17,17,17,22,28,21,21,21,21,12,12,12,12,21,
+46,21,21,21,21,21,11,21,46,46,46,46,22,11,22,38,17,38,17,38,17,20,28,20,28,
+20,28,20,28,11,11,11,11,1,21,1,21,1,21,1,21,1,21,11,25,11,25,11,25,11,25,
+21,46,21,46,25,12,25,12,25,12,25,12,25,12,21,23,21,12,21,10,10,20,12,20,12,
+20,12,20,36,20,12,25,46,25,46,25,46,24,25,46,34,21,34,21,34,21,42,40,22,18,
+22,18,22,18,27,42,27,42,27,42,27,42,27,11,27,11,27,11,21,46,21,46,21,46,21,
+46,21,46,21,46,16,11,38,22,38,18,18,18,18,18,18,48,11,38,17,1,22,34,21,27,
+42,1,1,36,1,1,1,1,1,1,1,1,38,20,21,45,12,21,13,21,22,38,34,25,23,1,18,21,
+34,25,21,25,28,25,17,34,21,19,32,27,38,25,16,25,34,25,38,11,22,46,22,18,11,
+12,22,21,22,22,46,23,22,10,45,18,24,24,21,24,19,24,24,1,18,25,19,19,24,22,
+18,21,18,24,1,14,25,20,27,25,25,21,40,25,14,21,48,21,38,19,34,25,31,1,24,
+18,25,25,21,16,28,21,34,21,19,20,27,48,25,16,21,20,25,25,23,16,25,22,36,22,
+17,20,25,20,22,21,25,26,25,25,10,22,19,25,21,18,11,28,25,22,25,26,22,18,25,
+25,23,24,25,17,25,17,21,46,20,28,42,12,12,12,24,24,46,10,22,18,23,1,16,11,
+16,11,16,11,38,22,1,1,1,1,21,21,25,21,21,21,25,25,25,25,25,20,43,24,25,25,
+12,1,25,11,11,17,11,1,1,42,25,34,1,12,12,12,12,38,23,30,43,1,1,23,23,11,11,
+11,11,25,20,20,25,12,1,1,1,17,17,17,17,17,17,17,1,1,1,1,1,1,46,1,1,1,1,1,
+1,1,1,12,21,17,22,24,28,24,38,17,1,1,1,20,20,34,21,25,28,1,1,1,1,1,1,25,21,
+25,29,23,32,38,1,1,28,24,24,22,25,25,23,20,1,26,25,19,34,21,24,22,24,22,24,
+1,20,21,25,1,29,24,20,28,13,36,1,1,1,46,1,22,25,1,23,19,11,18,20,21,25,25,
+25,18,26,21,1,21,25,21,10,11,24,24,25,25,25,46,25,18,19,20,28,27,25,38,25,
+38,25,25,25,42,21,19,22,20,18,25,24,10,22,10,22,25,24,25,32,24,24,20,21,25,
+24,25,20,18,21,21,25,38,17,38,17,1,22,1,21,21,21,21,21,24,25,18,26,18,17,
+25,25,25,25,34,21,34,21,34,21,22,17,48,22,48,22,48,22,20,18,25,20,16,24,18,
+20,22,1,16,26,19,11,23,21,24,24,25,22,23,24,39,25,21,25,19,23,18,26,16,22,
+38,17,38,17,38,17,38,17,38,17,38,17,38,17,38,17,38,17,38,17,38,17,38,17,1,
+21,1,21,1,21,1,21,1,21,1,21,1,21,1,21,25,12,25,12,34,21,34,21,34,21,34,21,
+34,21,34,21,34,21,34,21,34,21,34,21,34,21,34,21,21,46,21,46,25,28,25,28,25,
+28,25,28,25,28,38,22,38,22,38,22,11,1,1,1,1,1,1,1,1,1,1,1,1,11,27,11,0,0,
+0,0,0,0,19,0,0,3,136,6,7,4,0,3,2,2,2,4,3,5,4,1,2,2,3,3,2,2,2,2,3,3,3,3,3,
+3,3,3,3,3,2,2,3,3,3,3,5,4,4,4,4,3,3,4,4,2,2,3,3,5,4,4,4,4,4,3,3,4,4,5,3,3,
+3,2,2,2,3,2,3,4,4,3,4,3,2,3,4,2,2,3,2,5,4,4,4,4,2,3,2,4,3,4,4,3,3,2,3,2,3,
+2,2,3,3,3,3,3,3,3,5,2,3,3,2,5,3,3,3,3,3,3,4,4,2,1,3,2,3,4,4,4,3,4,4,4,4,4,
+4,5,4,3,3,3,3,2,2,2,2,4,4,4,4,4,4,4,3,4,4,4,4,4,3,3,4,4,4,4,4,4,4,5,3,3,3,
+3,3,2,2,2,2,4,4,4,4,4,4,4,3,4,4,4,4,4,3,4,3,4,4,4,4,4,4,4,3,4,3,4,3,4,3,4,
+4,4,4,3,3,3,3,3,3,3,3,3,3,4,3,4,3,4,3,4,3,4,4,4,4,2,2,2,2,2,2,2,2,2,2,4,4,
+2,2,3,3,3,3,2,3,2,3,2,3,2,3,2,4,4,4,4,4,4,5,4,4,4,4,4,4,4,4,5,5,4,2,4,2,4,
+2,3,3,3,3,3,3,3,3,3,2,3,2,3,2,4,4,4,4,4,4,4,4,4,4,4,4,5,4,3,3,3,3,3,3,3,3,
+3,2,3,4,3,5,5,4,4,3,3,3,3,3,3,2,3,1,3,3,3,3,4,2,4,5,3,5,4,5,2,4,4,3,4,3,3,
+4,4,2,3,4,5,4,3,4,4,4,4,3,3,6,3,6,4,2,3,4,3,4,2,4,4,4,3,4,3,3,4,4,2,3,4,4,
+4,3,4,4,4,3,4,3,4,5,4,5,6,2,4,4,4,6,3,5,3,4,3,2,2,2,6,6,5,3,4,4,4,4,4,3,4,
+3,5,3,4,4,3,4,5,4,4,4,4,4,3,4,6,3,4,4,6,6,5,6,4,4,6,4,4,4,4,2,3,3,4,3,4,4,
+3,4,5,4,4,4,4,3,3,3,5,4,4,4,6,6,4,5,3,3,6,4,3,4,2,3,3,2,2,2,5,5,4,3,3,4,3,
+2,5,4,5,4,5,4,3,3,3,6,6,2,1,1,2,1,2,2,3,3,3,2,6,7,1,2,2,2,3,1,2,3,3,5,3,5,
+3,6,5,4,4,5,5,5,5,4,4,4,4,3,3,4,2,3,3,3,3,4,4,4,3,2,3,3,3,3,3,3,3,3,3,3,3,
+6,3,6,2,2,1,3,2,1,1,0,0,6,6,2,1,4,3,6,5,5,4,4,5,2,2,6,6,4,4,4,4,0,0,0,0,0,
+3,4,3,4,6,5,4,4,5,4,4,3,5,5,4,4,6,5,3,3,6,5,4,4,4,3,4,3,7,6,5,4,6,5,6,5,4,
+3,4,3,3,3,3,6,6,4,4,3,3,4,4,3,2,4,3,5,5,3,3,4,3,3,3,3,3,4,4,4,4,4,4,6,5,4,
+4,4,3,3,3,3,3,3,3,4,3,5,4,4,4,4,4,4,4,5,4,5,4,2,5,4,4,3,4,3,4,4,4,4,4,4,5,
+5,2,4,4,4,4,5,5,3,3,4,3,4,3,5,4,3,3,3,3,4,4,4,4,4,4,4,4,4,4,4,3,4,3,4,3,4,
+3,4,4,3,2,6,5,3,2,4,3,3,4,3,4,6,6,5,5,4,3,6,5,6,6,4,4,4,5,3,3,4,4,4,4,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,2,
+2,2,2,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,4,4,4,3,3,3,3,3,3,4,0,0,0,0,0,0,0,0,0,1,1,1,4,3,2,0,7,9,4,0,4,2,2,3,5,4,
+6,5,2,2,2,4,4,2,2,2,3,4,4,4,4,4,4,4,4,4,4,2,2,4,4,4,3,6,5,4,4,5,4,4,5,5,4,
+2,4,3,6,5,5,4,5,4,4,4,5,5,6,4,4,4,2,3,2,4,3,4,4,4,3,4,4,3,4,4,2,2,4,2,6,4,
+4,4,4,3,3,2,4,4,6,4,4,3,2,4,2,4,2,2,4,4,4,4,4,3,4,6,2,3,4,2,6,4,3,4,3,3,4,
+4,5,2,1,3,2,3,5,5,5,3,5,5,5,5,5,5,6,4,4,4,4,4,4,4,4,4,5,5,5,5,5,5,5,4,5,5,
+5,5,5,4,4,4,4,4,4,4,4,4,6,3,4,4,4,4,2,2,2,2,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+4,5,4,5,4,5,4,4,3,4,3,4,3,4,3,5,4,5,4,4,4,4,4,4,4,4,4,4,4,5,4,5,4,5,4,5,4,
+5,4,5,4,4,2,4,2,4,2,4,2,4,2,5,4,2,2,4,4,4,3,2,3,2,3,2,3,2,3,2,5,4,5,4,5,4,
+5,5,4,5,4,5,4,5,4,6,6,4,3,4,3,4,3,4,3,4,3,4,3,4,3,4,2,4,2,4,2,5,4,5,4,5,4,
+5,4,5,4,5,4,6,6,4,4,4,4,3,4,3,4,3,2,4,5,4,6,6,5,4,4,3,4,4,4,4,2,4,1,4,4,4,
+4,5,2,4,5,5,5,5,6,2,5,4,3,5,4,4,5,5,4,4,5,6,5,4,5,5,4,4,4,4,6,4,6,5,4,4,4,
+3,4,2,4,4,4,4,4,3,3,4,4,2,4,4,4,4,3,4,4,4,3,4,3,4,6,4,6,6,2,4,4,4,6,4,5,3,
+4,4,4,4,2,7,7,5,4,4,5,5,4,4,3,5,4,6,4,5,5,4,5,6,5,5,5,4,4,4,4,6,4,5,5,8,8,
+5,6,4,4,7,4,4,4,4,3,4,4,6,3,4,4,3,4,5,4,4,4,4,3,3,4,6,4,4,4,6,6,5,6,4,3,6,
+4,4,4,3,3,3,2,2,2,6,6,4,3,4,4,3,3,6,6,6,6,6,6,4,4,4,7,7,3,1,1,2,1,3,3,3,3,
+3,3,6,8,2,3,2,2,3,1,3,4,4,5,4,6,4,7,5,5,4,5,5,5,5,4,5,5,4,4,4,5,3,4,4,4,4,
+4,4,4,4,2,4,4,4,3,3,3,3,3,3,3,4,7,4,7,2,2,1,4,2,1,1,0,0,7,7,2,1,4,4,6,6,6,
+5,4,5,2,3,6,6,5,4,5,4,0,0,0,0,0,4,5,4,4,6,6,5,4,6,5,5,4,6,5,6,4,7,5,4,4,6,
+6,5,4,5,4,5,4,9,7,5,4,6,6,6,6,4,3,4,4,4,4,4,7,7,5,4,4,4,4,4,4,3,4,4,6,6,4,
+3,4,4,4,3,4,3,5,4,5,4,5,4,7,6,6,6,4,3,4,3,4,4,4,4,4,4,7,6,6,4,5,4,5,4,6,5,
+6,5,4,6,6,5,4,5,4,5,4,5,4,5,4,6,5,4,5,4,5,4,6,6,4,4,5,4,5,4,6,6,4,3,4,4,5,
+4,5,4,5,4,5,4,5,4,4,3,4,4,4,4,4,4,5,4,3,3,6,6,4,3,4,4,4,4,4,4,6,6,6,5,4,4,
+7,6,7,6,5,4,5,5,4,3,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,4,
+4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,2,4,2,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,
+5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,5,4,4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,1,
+1,1,4,4,2,0,8,10,5,0,4,2,2,3,5,4,7,6,2,2,2,4,4,2,3,2,3,4,4,4,4,4,4,4,4,4,
+4,2,2,4,4,4,4,7,6,5,5,5,4,4,6,6,4,2,5,4,8,6,6,5,6,5,4,4,6,6,8,5,4,5,2,3,2,
+4,3,5,4,5,4,5,4,3,4,5,2,2,4,2,8,5,5,5,5,3,4,3,5,4,6,4,4,4,3,4,3,4,2,2,4,4,
+4,4,4,4,5,7,3,4,4,3,7,4,3,4,4,4,5,5,5,2,2,4,3,4,6,6,6,4,6,6,6,6,6,6,7,5,4,
+4,4,4,4,4,4,4,5,6,6,6,6,6,6,4,6,6,6,6,6,4,5,5,4,4,4,4,4,4,7,4,4,4,4,4,2,2,
+2,2,5,5,5,5,5,5,5,4,5,5,5,5,5,4,5,4,6,4,6,4,6,4,5,4,5,4,5,4,5,4,5,5,5,5,4,
+4,4,4,4,4,4,4,4,4,6,4,6,4,6,4,6,4,6,5,6,5,4,2,4,2,4,2,4,2,4,2,5,4,2,2,5,4,
+4,4,2,4,2,4,2,4,2,4,2,6,5,6,5,6,5,6,6,5,6,5,6,5,6,5,7,7,5,3,5,3,5,3,4,4,4,
+4,4,4,4,4,4,3,4,3,4,3,6,5,6,5,6,5,6,5,6,5,6,5,8,6,4,4,4,5,4,5,4,5,4,2,4,6,
+4,7,7,6,5,4,4,5,5,4,5,2,5,1,5,5,5,5,6,2,5,6,5,6,5,6,2,6,5,4,6,4,5,6,6,4,5,
+6,8,6,4,6,6,5,5,4,4,6,5,6,6,4,4,5,4,5,2,5,5,5,4,5,4,4,5,5,2,4,4,5,4,4,5,5,
+5,4,5,4,5,6,4,6,6,2,5,5,5,6,4,6,4,5,4,4,4,2,8,8,6,5,5,6,6,5,5,4,6,4,8,4,6,
+6,5,6,8,6,6,6,5,5,4,5,6,5,6,5,8,8,6,7,5,5,8,5,4,5,5,3,4,4,6,4,5,5,4,5,6,5,
+5,5,5,4,4,4,6,4,5,5,8,8,5,6,4,4,7,4,4,5,3,4,4,2,2,2,7,7,5,4,4,5,4,3,8,6,8,
+6,8,6,4,4,4,8,8,3,1,1,2,1,3,3,4,4,4,3,6,9,2,3,2,2,4,1,3,4,4,6,4,6,4,8,6,6,
+5,6,6,6,6,5,6,6,5,4,4,6,3,4,4,4,4,5,5,5,5,2,4,4,4,4,4,4,4,4,4,4,4,8,4,8,3,
+2,1,4,2,2,1,0,0,8,8,2,1,5,4,7,8,8,6,4,6,3,3,7,7,6,5,6,5,0,0,0,0,0,4,6,4,5,
+8,6,5,5,7,6,6,4,7,5,6,6,8,7,4,4,6,6,6,5,6,4,6,4,10,8,6,5,8,6,8,6,5,4,5,4,
+5,5,5,8,8,6,5,5,5,5,5,4,3,5,4,8,6,4,4,5,4,5,4,5,4,5,5,6,5,6,5,8,6,7,6,5,4,
+4,4,4,4,4,4,5,4,7,7,6,5,5,5,5,5,7,5,7,5,4,8,6,5,4,6,5,6,5,6,5,5,5,8,6,4,6,
+4,6,4,7,7,4,4,6,4,6,4,8,6,4,4,4,4,6,5,6,5,6,5,6,5,6,5,5,4,5,4,5,4,5,4,5,5,
+4,3,7,6,4,3,5,4,5,4,5,5,7,8,6,6,4,4,8,7,9,7,6,5,5,5,4,4,6,5,6,4,6,4,6,4,6,
+4,6,4,6,4,6,4,6,4,6,4,6,4,6,4,6,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,2,4,2,
+6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+5,4,4,4,4,4,4,5,0,0,0,0,0,0,0,0,0,2,2,2,5,4,3,0,9,12,5,0,5,2,2,4,6,5,8,6,
+2,3,3,6,5,2,3,2,3,5,5,5,5,5,5,5,5,5,5,2,2,5,5,5,4,8,6,5,5,6,5,5,6,6,4,3,5,
+4,8,6,7,5,7,5,5,4,6,6,8,6,6,5,3,3,3,5,4,5,5,5,4,5,5,4,5,5,2,2,5,2,8,5,5,5,
+5,4,4,4,5,5,6,5,5,4,3,5,3,5,2,2,5,5,5,5,5,4,5,7,4,5,5,3,7,5,4,5,4,4,5,5,6,
+2,2,4,4,5,7,7,8,4,6,6,6,6,6,6,8,5,5,5,5,5,4,4,4,4,6,6,7,7,7,7,7,5,7,6,6,6,
+6,6,5,5,5,5,5,5,5,5,8,4,5,5,5,5,2,2,2,2,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,
+5,6,5,6,5,5,4,5,4,5,4,5,4,6,5,6,5,5,5,5,5,5,5,5,5,5,5,6,5,6,5,6,5,6,5,6,5,
+6,5,4,2,4,2,4,2,4,2,4,2,6,4,3,2,5,5,5,4,2,4,2,4,2,4,3,4,2,6,5,6,5,6,5,6,6,
+5,7,5,7,5,7,5,9,8,5,4,5,4,5,4,5,4,5,4,5,4,5,4,4,4,4,4,4,4,6,5,6,5,6,5,6,5,
+6,5,6,5,8,6,6,5,6,5,4,5,4,5,4,2,5,6,5,8,8,7,5,5,4,5,5,5,5,2,5,2,5,5,5,5,6,
+2,6,7,5,8,7,8,2,6,5,5,6,5,5,6,7,4,5,6,8,6,5,7,6,5,5,4,6,6,6,6,7,4,6,5,4,5,
+2,5,5,5,5,5,4,4,5,5,2,5,5,5,5,4,5,6,5,4,5,4,5,6,6,6,6,2,5,5,5,6,5,6,5,5,5,
+4,4,3,9,9,6,5,6,6,6,5,5,5,6,5,8,5,6,6,5,7,8,6,7,6,5,5,4,6,6,6,6,6,8,8,7,7,
+5,5,9,5,5,5,5,4,5,5,6,4,5,5,5,5,6,5,5,5,5,4,4,5,6,5,5,5,8,8,6,7,5,4,7,5,5,
+5,4,4,4,2,2,2,8,8,5,5,5,5,5,4,8,6,8,6,8,6,6,5,5,9,9,4,2,2,2,2,4,4,4,4,4,3,
+6,11,2,4,3,3,4,1,4,5,5,8,5,7,5,9,8,7,6,8,8,8,8,5,6,6,6,5,5,7,3,5,5,5,5,6,
+6,6,4,2,5,5,5,4,4,4,4,4,4,4,5,9,5,9,3,2,2,5,2,2,1,0,0,9,9,2,2,6,6,6,8,8,6,
+5,7,3,4,9,9,7,5,6,5,0,0,0,0,0,5,6,5,5,8,7,6,5,8,6,6,6,8,7,6,6,8,7,5,4,6,6,
+7,5,6,5,6,5,12,9,7,5,8,7,8,7,5,4,5,5,5,5,5,9,9,6,5,5,5,5,5,5,4,5,5,8,6,5,
+4,6,5,5,5,5,5,6,6,6,5,6,5,9,8,7,6,5,4,4,4,6,4,6,4,6,5,8,7,7,6,6,5,6,5,8,6,
+8,6,4,8,6,6,5,7,5,6,5,6,5,6,5,8,6,4,6,5,6,5,8,8,5,5,7,5,7,5,8,6,5,4,5,4,6,
+5,6,5,7,5,7,5,7,5,5,4,6,5,6,5,6,5,6,5,5,4,7,7,5,4,5,5,6,5,5,5,8,8,8,7,5,5,
+10,7,9,8,6,5,6,5,5,4,7,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,
+5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,4,2,4,2,7,5,7,5,7,5,7,5,7,5,7,5,7,5,7,5,7,
+5,7,5,7,5,7,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,5,0,0,0,0,0,0,0,0,0,
+2,2,2,5,4,4,0,10,12,6,0,5,3,2,4,6,6,8,7,2,3,3,6,5,2,3,2,4,5,5,5,5,5,5,5,5,
+5,5,2,2,5,5,5,4,8,6,6,6,6,5,5,6,6,4,3,5,4,8,6,7,5,7,5,5,4,6,6,8,6,6,5,3,4,
+3,5,4,6,5,5,4,5,5,4,5,5,2,2,5,2,8,5,5,5,5,4,4,4,5,5,6,5,5,4,4,5,4,5,3,2,5,
+5,5,5,5,5,6,8,4,5,5,3,8,5,4,5,4,4,6,5,6,2,2,4,4,5,7,7,7,4,6,6,6,6,6,6,9,6,
+5,5,5,5,4,4,4,4,6,6,7,7,7,7,7,5,7,6,6,6,6,6,5,5,5,5,5,5,5,5,8,4,5,5,5,5,2,
+2,2,2,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,6,5,6,5,6,5,6,4,6,4,6,4,6,4,6,5,6,5,
+5,5,5,5,5,5,5,5,5,5,6,5,6,5,6,5,6,5,6,5,6,5,4,2,4,2,4,2,4,2,4,2,6,5,3,2,5,
+5,5,4,2,4,2,4,2,4,4,4,2,6,5,6,5,6,5,7,6,5,7,5,7,5,7,5,9,8,5,4,5,4,5,4,5,4,
+5,4,5,4,5,4,4,4,4,4,4,4,6,5,6,5,6,5,6,5,6,5,6,5,8,6,6,5,6,5,4,5,4,5,4,2,5,
+6,5,9,8,7,5,5,4,6,6,6,6,3,6,2,6,6,6,6,6,2,6,7,5,8,7,8,2,6,6,5,6,5,5,6,7,4,
+5,6,8,6,5,7,6,5,5,4,6,8,6,8,7,4,6,5,4,5,2,5,5,5,5,5,4,4,5,5,2,5,5,5,5,4,5,
+6,5,4,5,4,5,6,6,6,6,2,5,5,5,6,5,7,5,6,5,4,4,3,9,9,7,5,6,6,6,6,6,5,6,5,8,5,
+6,6,5,7,8,6,7,6,5,6,4,6,8,6,6,6,10,10,7,8,6,6,10,5,5,5,5,4,5,5,6,4,5,5,5,
+5,6,5,5,5,5,4,4,5,6,5,5,5,8,8,7,7,5,4,8,5,5,5,4,4,4,2,2,2,8,8,5,5,5,5,5,4,
+8,6,8,6,8,6,6,5,5,10,10,4,2,2,2,2,4,4,4,4,4,3,9,12,2,4,3,3,4,1,4,5,5,8,5,
+8,5,9,7,7,6,8,8,8,8,5,6,7,6,6,5,7,3,5,5,5,5,6,6,6,6,2,5,5,5,4,4,4,4,4,4,4,
+5,10,5,10,3,3,2,6,3,2,1,0,0,10,10,2,2,6,6,6,8,8,6,5,8,3,4,9,9,7,5,6,5,0,0,
+0,0,0,5,6,5,5,10,7,6,6,9,7,6,6,9,8,8,6,10,7,5,4,8,6,7,5,6,5,6,5,12,10,7,5,
+10,8,10,7,6,4,6,6,6,6,6,10,10,6,5,6,6,5,5,5,4,6,5,8,6,5,4,6,5,5,5,5,5,6,6,
+6,5,7,6,10,8,7,6,6,4,4,4,6,4,6,4,6,5,8,7,7,6,6,5,6,5,8,6,8,6,4,8,6,6,5,7,
+5,6,5,6,5,6,5,8,6,4,6,5,6,5,9,8,5,5,7,5,7,5,8,6,5,4,5,4,6,5,6,5,7,5,7,5,7,
+5,6,4,6,5,6,5,6,5,6,5,5,4,8,7,5,4,6,5,6,5,5,5,8,8,8,7,5,5,10,8,9,8,7,5,7,
+5,5,4,7,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,5,5,5,5,5,5,5,5,
+5,5,5,5,5,5,5,5,4,2,4,2,7,5,7,5,7,5,7,5,7,5,7,5,7,5,7,5,7,5,7,5,7,5,7,5,6,
+5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,5,0,0,0,0,0,0,0,0,0,2,2,2,5,4,4,0,11,
+14,7,0,6,3,3,5,7,6,9,8,3,3,3,6,6,3,4,3,4,6,6,6,6,6,6,6,6,6,6,3,3,6,6,6,5,
+10,7,7,7,8,6,5,8,8,3,3,7,5,10,8,9,6,9,7,6,5,8,7,9,6,7,7,3,4,3,6,5,6,6,6,5,
+6,6,4,6,6,2,2,5,2,10,6,6,6,6,4,5,4,6,6,8,6,6,5,4,5,4,6,3,3,6,6,6,6,5,5,6,
+9,4,5,6,4,9,6,5,6,4,4,6,6,7,3,2,4,4,5,8,8,8,5,7,7,7,7,7,7,9,7,6,6,6,6,3,3,
+3,3,8,8,9,9,9,9,9,6,9,8,8,8,8,7,6,6,6,6,6,6,6,6,10,5,6,6,6,6,2,2,2,2,6,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,6,7,6,7,6,7,5,7,5,7,5,7,5,8,6,8,6,6,6,6,6,6,
+6,6,6,6,6,8,6,8,6,8,6,8,6,8,6,8,6,3,2,3,2,3,2,3,2,3,2,7,5,3,2,7,5,5,5,2,5,
+2,5,2,5,3,5,2,8,6,8,6,8,6,8,8,6,9,6,9,6,9,6,10,10,7,4,7,4,7,4,6,5,6,5,6,5,
+6,5,5,4,5,4,5,4,8,6,8,6,8,6,8,6,8,6,8,6,9,8,7,6,7,7,5,7,5,7,5,2,6,7,6,9,10,
+9,6,6,5,6,6,6,6,3,6,2,6,6,6,6,7,3,7,9,4,9,8,9,4,7,7,6,7,6,7,8,9,3,7,7,10,
+8,5,9,8,6,6,5,7,9,6,9,9,3,7,6,5,6,4,6,6,6,6,6,5,5,6,6,4,5,6,6,6,5,6,8,6,5,
+6,5,6,8,6,8,8,4,6,6,6,8,6,8,6,7,6,3,3,3,10,10,8,7,6,8,7,7,7,6,7,6,9,6,8,8,
+7,7,10,8,9,8,6,7,5,6,9,6,8,8,11,11,8,9,7,7,12,7,6,6,6,4,7,6,8,5,6,6,5,6,7,
+6,6,6,6,5,6,6,8,6,6,6,10,10,8,8,6,5,9,6,6,6,4,5,5,2,2,2,10,9,6,5,6,6,5,4,
+9,8,9,8,9,8,7,6,6,11,11,5,2,2,2,2,4,4,4,5,5,5,9,13,3,5,3,3,6,1,4,6,6,9,6,
+9,6,11,9,9,7,9,9,9,9,6,7,8,7,6,6,8,4,6,6,6,6,7,6,6,6,2,6,6,6,4,4,4,4,4,4,
+4,6,11,6,11,4,3,2,6,3,2,1,0,0,11,11,2,2,7,7,8,10,10,7,6,9,4,4,10,10,9,6,8,
+7,0,0,0,0,0,6,8,6,6,11,8,7,7,10,8,7,6,10,8,7,8,10,10,6,5,9,8,9,6,8,6,8,6,
+14,11,9,6,11,9,11,8,7,5,6,6,6,6,6,11,11,8,6,6,6,6,6,5,4,7,6,9,8,6,5,7,6,7,
+5,7,5,7,7,8,6,9,7,11,10,9,7,7,5,5,6,7,6,7,6,6,6,10,9,8,7,8,6,8,6,9,7,9,7,
+3,9,8,7,6,7,6,8,6,8,6,8,6,10,7,3,7,6,7,6,9,10,6,6,9,6,9,6,9,8,6,5,6,5,8,6,
+8,6,9,6,9,6,9,6,7,5,6,6,6,6,6,6,8,6,6,4,9,8,5,4,7,6,6,6,6,6,9,10,9,9,6,6,
+10,9,11,9,8,6,8,7,6,5,7,6,7,6,7,6,7,6,7,6,7,6,7,6,7,6,7,6,7,6,7,6,7,6,7,6,
+6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,3,2,3,2,9,6,9,6,9,6,9,6,9,6,9,6,9,6,9,6,9,
+6,9,6,9,6,9,6,8,6,8,6,8,7,8,7,8,7,8,7,8,7,7,6,7,6,7,6,6,0,0,0,0,0,0,0,0,0,
+2,2,2,6,5,4,0,12,15,7,0,6,3,3,5,8,7,10,8,3,4,4,7,7,3,4,3,4,7,7,7,7,7,7,7,
+7,7,7,3,3,7,7,7,5,10,7,7,7,8,6,6,8,8,4,3,7,6,11,9,9,7,9,7,7,7,8,7,11,7,7,
+7,4,4,4,6,5,7,7,7,6,7,7,3,6,7,3,3,6,3,11,7,7,7,7,4,6,4,7,5,9,6,5,6,4,7,4,
+7,3,3,7,7,7,7,7,6,7,10,4,6,7,4,10,6,5,7,4,4,7,7,8,3,2,4,4,6,9,9,9,5,7,7,7,
+7,7,7,10,7,6,6,6,6,4,4,4,4,8,9,9,9,9,9,9,7,9,8,8,8,8,7,7,7,7,7,7,7,7,7,11,
+6,7,7,7,7,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,5,7,5,7,7,7,7,7,7,7,6,7,6,7,6,
+7,6,8,7,8,7,6,7,6,7,6,7,6,7,6,7,8,6,8,6,8,6,8,6,8,7,8,7,4,3,4,3,4,3,4,3,4,
+3,7,6,3,3,7,6,6,6,3,6,3,6,3,6,4,6,3,9,7,9,7,9,7,8,9,7,9,7,9,7,9,7,11,11,7,
+4,7,4,7,4,7,6,7,6,7,6,7,6,7,4,7,4,7,4,8,7,8,7,8,7,8,7,8,7,8,7,11,9,7,5,7,
+7,6,7,6,7,6,3,7,7,7,10,11,9,7,7,6,7,7,7,7,3,7,2,7,7,7,7,7,3,7,9,6,9,9,9,4,
+7,7,6,7,6,7,8,9,4,7,7,11,9,7,9,8,7,7,7,7,9,7,9,9,4,7,7,6,7,4,7,7,7,5,7,6,
+5,7,7,4,6,5,7,6,6,7,8,7,6,7,5,7,9,6,9,9,4,7,7,7,9,6,9,6,7,7,4,4,3,11,11,9,
+7,7,8,7,7,7,6,8,6,9,7,9,9,7,8,11,8,9,8,7,7,7,7,9,7,8,8,11,11,8,10,7,7,12,
+7,7,7,7,5,6,7,9,6,7,7,6,7,9,7,7,7,7,6,5,5,9,6,7,7,11,11,8,9,7,6,10,7,7,7,
+5,6,6,3,3,3,11,11,7,6,5,7,6,5,11,9,11,9,11,9,7,5,6,12,12,5,2,2,2,2,4,4,4,
+5,5,5,9,15,3,5,4,4,6,2,4,7,7,10,7,10,6,13,10,9,7,9,9,9,9,7,7,8,8,7,7,9,5,
+7,7,7,7,7,7,7,7,3,6,6,6,4,4,4,4,4,4,4,6,12,6,12,4,3,2,7,3,2,1,0,0,12,12,3,
+2,7,7,9,11,11,7,7,9,4,5,11,11,9,7,9,8,0,0,0,0,0,6,9,7,7,11,9,7,7,11,9,7,7,
+10,10,7,7,10,10,7,6,9,9,9,7,8,5,8,5,14,13,9,7,11,9,11,9,7,6,6,7,7,7,7,12,
+11,9,7,7,7,7,7,6,5,7,7,10,9,7,6,8,6,7,6,7,6,8,7,8,7,9,8,12,11,10,9,7,6,7,
+5,7,5,7,5,7,6,10,8,9,7,8,7,8,7,10,8,10,8,4,9,9,8,7,8,7,8,7,8,7,8,7,11,9,4,
+7,7,7,7,10,11,6,7,9,7,9,7,9,9,7,6,7,6,9,7,9,7,9,7,9,7,9,7,7,6,7,5,7,5,7,5,
+8,7,6,5,10,9,6,5,7,6,7,6,7,7,11,11,10,9,7,6,11,10,12,11,9,7,9,7,7,6,8,7,7,
+7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,6,7,6,7,6,7,6,7,6,7,6,7,6,7,
+6,7,4,3,4,3,9,7,9,7,9,7,9,7,9,7,9,7,9,7,9,7,9,7,9,7,9,7,9,7,8,7,8,7,9,8,9,
+8,9,8,9,8,9,8,7,5,7,5,7,5,7,0,0,0,0,0,0,0,0,0,2,2,2,7,7,4,0,13,16,8,0,7,3,
+4,5,8,7,11,9,3,4,4,7,7,3,4,3,5,7,7,7,7,7,7,7,7,7,7,3,3,7,7,7,6,11,8,8,8,9,
+7,6,9,9,5,3,8,6,11,9,10,7,10,8,7,7,9,7,11,7,7,7,4,5,4,7,5,8,7,8,6,8,7,4,7,
+8,3,3,6,3,11,8,8,8,8,5,6,4,8,6,10,7,6,6,5,7,5,7,3,4,7,7,7,7,7,6,8,11,5,6,
+7,4,11,7,6,7,5,5,8,8,9,3,3,5,5,6,10,10,10,6,8,8,8,8,8,8,11,8,7,7,7,7,5,5,
+5,5,9,9,10,10,10,10,10,7,10,9,9,9,9,7,7,8,7,7,7,7,7,7,11,6,7,7,7,7,3,3,3,
+3,8,8,8,8,8,8,8,7,8,8,8,8,8,6,8,6,8,7,8,7,8,7,8,6,8,6,8,6,8,6,9,8,9,8,7,7,
+7,7,7,7,7,7,7,7,9,7,9,7,9,7,9,7,9,8,9,8,5,3,5,3,5,3,5,3,5,3,8,6,3,3,8,6,6,
+6,3,6,3,6,3,6,4,6,3,9,8,9,8,9,8,9,9,8,10,8,10,8,10,8,12,12,8,5,8,5,8,5,7,
+6,7,6,7,6,7,6,7,4,7,4,7,4,9,8,9,8,9,8,9,8,9,8,9,8,11,10,7,6,7,7,6,7,6,7,6,
+4,7,8,7,11,11,10,8,7,6,8,8,7,8,3,8,2,8,8,8,8,8,3,8,10,6,10,9,10,4,8,8,7,7,
+7,7,9,10,5,8,8,11,9,7,10,9,7,7,7,7,10,7,10,10,5,7,8,6,8,4,8,8,8,6,8,6,6,8,
+8,4,6,7,8,7,6,8,8,8,6,8,6,8,10,7,10,11,4,8,8,8,11,7,10,7,8,7,5,5,3,12,12,
+10,8,8,9,8,8,8,7,8,7,11,7,9,9,8,9,11,9,10,9,7,8,7,8,10,7,9,9,13,13,9,11,8,
+8,13,8,7,8,7,5,7,7,9,6,8,8,6,7,9,8,8,8,8,6,5,6,9,7,8,8,11,11,8,10,7,6,11,
+7,7,8,5,6,6,3,3,3,11,11,8,6,6,8,6,5,11,10,11,10,11,10,7,6,7,13,13,5,2,2,2,
+2,5,5,5,5,5,5,9,16,3,5,4,4,6,2,5,7,7,11,7,10,7,13,10,10,8,10,10,10,10,8,7,
+9,8,7,7,9,5,7,7,7,7,7,7,7,7,3,7,7,7,5,5,5,5,5,5,5,7,13,7,13,4,3,2,7,3,3,1,
+0,0,13,13,3,2,8,7,11,11,11,8,7,10,4,5,11,11,10,8,10,9,0,0,0,0,0,7,9,7,8,13,
+10,8,8,12,9,8,7,12,10,9,7,12,10,7,6,10,10,10,8,8,6,8,6,15,14,10,8,13,10,13,
+10,8,6,8,7,8,8,8,13,12,10,8,7,8,7,8,6,5,8,7,11,9,7,6,8,7,8,6,8,6,9,7,9,8,
+10,9,13,11,10,10,8,6,7,5,7,6,7,6,7,7,11,9,9,8,9,8,9,8,11,9,11,9,5,11,9,8,
+8,9,7,9,8,9,8,9,8,11,9,5,8,7,8,7,11,11,7,7,10,7,10,7,11,9,7,6,7,7,9,8,9,8,
+10,8,10,8,10,8,8,6,8,6,8,6,8,6,9,8,7,5,11,10,6,5,8,7,7,7,7,8,11,12,11,10,
+8,7,13,11,13,12,9,8,9,8,7,6,9,7,8,7,8,7,8,7,8,7,8,7,8,7,8,7,8,7,8,7,8,7,8,
+7,8,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,5,3,5,3,10,8,10,8,10,8,10,8,10,8,10,
+8,10,8,10,8,10,8,10,8,10,8,10,8,9,8,9,8,10,9,10,9,10,9,10,9,10,9,7,6,7,6,
+7,6,8,0,0,0,0,0,0,0,0,0,3,3,3,8,7,4,0,14,17,8,0,7,4,4,6,9,8,12,10,3,4,4,8,
+8,4,5,4,5,8,8,8,8,8,8,8,8,8,8,4,4,8,8,8,6,12,9,9,8,10,7,7,10,10,5,3,8,7,12,
+10,11,8,11,8,7,7,10,8,13,8,7,8,4,5,4,7,6,8,7,8,7,8,8,4,7,8,4,4,7,4,13,8,8,
+8,8,5,7,5,8,7,10,7,7,7,5,7,5,8,4,4,8,8,8,8,7,7,8,12,5,7,8,5,12,7,6,8,5,5,
+8,8,9,4,3,5,5,7,10,10,10,6,9,9,9,9,9,9,12,8,7,7,7,7,5,5,5,5,10,10,11,11,11,
+11,11,8,11,10,10,10,10,7,8,8,7,7,7,7,7,7,12,7,8,8,8,8,4,4,4,4,8,8,8,8,8,8,
+8,8,8,8,8,8,8,7,8,7,9,7,9,7,9,7,8,7,8,7,8,7,8,7,10,8,10,8,7,8,7,8,7,8,7,8,
+7,8,10,7,10,7,10,7,10,7,10,8,10,8,5,4,5,4,5,4,5,4,5,4,8,8,3,4,8,7,7,7,4,7,
+4,7,4,7,5,7,4,10,8,10,8,10,8,10,10,8,11,8,11,8,11,8,12,13,8,5,8,5,8,5,7,7,
+7,7,7,7,7,7,7,5,7,5,7,5,10,8,10,8,10,8,10,8,10,8,10,8,13,10,7,7,7,8,7,8,7,
+8,7,4,8,9,7,12,12,11,8,7,7,8,8,8,8,4,8,3,8,8,8,8,9,4,8,11,6,11,9,11,4,9,9,
+7,9,7,8,10,11,5,8,9,12,10,8,11,10,8,8,7,7,11,8,11,11,5,7,8,7,8,4,8,8,8,7,
+8,7,6,8,8,4,7,7,8,7,7,8,9,8,7,8,6,8,10,7,10,11,4,8,8,8,11,7,10,7,8,7,5,5,
+3,13,13,10,8,8,10,9,8,9,7,9,7,11,8,10,10,8,9,12,10,11,10,8,8,7,8,11,8,10,
+9,13,13,9,12,9,8,15,8,7,8,8,5,8,8,9,7,8,8,7,8,10,8,8,8,8,7,5,7,9,7,8,8,11,
+11,9,11,8,7,11,8,8,8,5,7,7,4,4,4,12,12,8,7,7,8,7,6,13,10,13,10,13,10,7,7,
+7,14,14,6,3,3,3,3,6,6,6,7,7,6,12,17,3,6,4,4,7,2,5,8,8,12,8,11,7,14,10,11,
+9,11,11,11,11,8,9,10,9,8,8,10,5,8,8,8,8,7,8,8,8,4,7,7,7,5,5,5,5,5,5,5,7,14,
+7,14,5,4,2,8,4,3,1,0,0,14,14,4,3,8,8,11,12,13,9,7,11,5,6,13,13,11,8,11,9,
+0,0,0,0,0,7,10,8,8,13,11,9,8,13,10,9,7,12,10,9,9,13,12,8,7,11,10,11,8,9,7,
+9,7,17,15,11,8,13,11,13,11,8,7,9,8,8,8,8,14,13,10,8,8,8,8,8,7,5,9,8,11,10,
+8,7,9,8,8,7,8,7,9,8,10,8,11,10,15,12,11,10,8,7,7,5,7,7,7,7,8,7,11,10,10,9,
+9,8,10,8,11,9,11,9,5,11,9,9,8,9,8,10,8,10,8,9,8,12,10,5,9,7,9,7,12,12,7,8,
+11,8,11,8,11,9,8,7,8,7,10,8,10,8,11,8,11,8,11,8,8,7,8,7,8,7,8,7,9,8,7,5,12,
+11,7,5,8,7,8,7,8,8,12,12,12,11,8,7,13,12,14,12,10,8,10,9,8,7,9,8,9,7,9,7,
+9,7,9,7,9,7,9,7,9,7,9,7,9,7,9,7,9,7,9,7,7,8,7,8,7,8,7,8,7,8,7,8,7,8,7,8,5,
+4,5,4,11,8,11,8,11,8,11,8,11,8,11,8,11,8,11,8,11,8,11,8,11,8,11,8,10,8,10,
+8,11,9,11,9,11,9,11,9,11,9,7,7,7,7,7,7,8,0,0,0,0,0,0,0,0,0,3,3,3,8,7,5,0,
+15,18,9,0,8,4,4,7,10,8,12,11,4,5,5,8,8,4,5,4,6,8,8,8,8,8,8,8,8,8,8,4,4,8,
+8,8,6,13,10,10,9,10,8,8,10,11,6,4,9,7,13,11,11,9,11,9,7,8,11,9,14,9,8,8,5,
+6,5,8,6,9,8,9,7,9,8,4,8,8,4,4,7,4,13,8,9,9,9,6,7,5,8,7,11,7,7,7,5,7,5,8,4,
+4,8,8,8,8,7,7,9,12,5,7,8,5,12,8,7,8,5,5,9,8,10,4,3,5,5,7,11,11,11,6,10,10,
+10,10,10,10,13,9,8,8,8,8,6,6,6,6,10,11,11,11,11,11,11,8,11,11,11,11,11,8,
+9,9,8,8,8,8,8,8,13,7,8,8,8,8,4,4,4,4,9,8,9,9,9,9,9,8,9,8,8,8,8,7,9,7,10,8,
+10,8,10,8,9,7,9,7,9,7,9,7,10,9,10,9,8,8,8,8,8,8,8,8,8,8,10,8,10,8,10,8,10,
+8,11,8,11,8,6,4,6,4,6,4,6,4,6,4,9,8,4,4,9,7,7,7,4,7,4,7,4,7,5,7,4,11,8,11,
+8,11,8,10,11,8,11,9,11,9,11,9,13,14,9,6,9,6,9,6,7,7,7,7,7,7,7,7,8,5,8,5,8,
+5,11,8,11,8,11,8,11,8,11,8,11,8,14,11,8,7,8,8,7,8,7,8,7,4,8,10,8,13,13,11,
+9,7,7,9,9,8,9,4,9,3,9,9,9,9,10,4,9,12,7,12,10,12,4,10,10,8,10,8,8,11,11,6,
+9,10,13,11,8,11,11,9,8,8,8,11,9,11,11,6,8,9,7,8,4,8,9,9,7,9,7,7,8,9,4,7,7,
+8,8,7,9,9,9,7,9,7,8,11,8,10,12,4,8,9,8,12,8,11,8,9,7,6,6,4,14,15,11,9,9,11,
+10,9,10,8,10,8,12,8,11,11,9,11,13,11,11,11,9,9,8,9,11,9,11,10,14,14,10,13,
+10,9,16,9,8,9,8,6,8,8,11,7,8,8,7,8,11,8,9,8,9,7,7,7,11,7,8,8,13,13,10,11,
+8,7,12,8,8,8,6,7,7,4,4,4,12,13,8,7,7,8,7,6,14,11,14,11,14,11,8,7,8,15,15,
+6,3,3,3,3,6,6,6,8,8,7,12,18,4,7,4,4,7,2,5,8,8,12,8,12,8,15,12,11,9,11,11,
+11,11,9,10,11,9,8,8,11,6,8,8,8,8,9,9,9,9,4,8,8,8,5,5,5,5,5,5,5,8,15,8,15,
+5,4,3,8,4,3,2,0,0,15,15,4,3,9,8,12,13,13,10,8,12,5,6,14,14,11,9,11,9,0,0,
+0,0,0,8,11,8,8,15,12,10,9,13,11,10,8,13,10,10,9,14,12,8,7,11,10,11,9,9,7,
+9,7,18,16,11,9,13,12,15,12,9,7,9,8,9,9,9,15,14,11,8,9,9,9,9,8,6,10,8,12,11,
+8,7,9,8,9,7,9,7,10,9,11,8,12,10,16,13,11,10,9,7,8,7,8,7,8,7,9,7,13,10,10,
+9,10,8,11,8,12,9,12,9,6,12,11,10,8,11,8,11,8,11,8,10,8,13,11,6,10,8,10,8,
+13,13,8,8,11,8,11,8,12,11,8,7,8,7,11,8,11,8,11,9,11,9,11,9,9,7,9,7,9,7,9,
+7,10,8,8,6,13,11,8,6,9,8,9,7,9,9,14,14,14,12,9,8,15,12,15,12,11,9,11,10,8,
+7,11,8,10,8,10,8,10,8,10,8,10,8,10,8,10,8,10,8,10,8,10,8,10,8,10,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,6,4,6,4,11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,9,
+11,9,11,9,11,9,11,9,11,8,11,8,11,9,11,9,11,9,11,9,11,9,8,7,8,7,8,7,9,0,0,
+0,0,0,0,0,0,0,3,3,3,9,8,5,0,16,20,10,0,8,4,4,7,10,9,13,11,4,5,5,9,9,4,5,4,
+6,9,9,9,9,9,9,9,9,9,9,4,4,9,9,9,7,14,11,11,10,11,8,8,11,11,6,4,9,8,14,12,
+11,9,11,10,8,8,11,10,14,9,8,9,5,6,5,9,7,9,9,9,8,9,9,4,8,9,4,4,8,4,14,9,9,
+9,9,6,7,5,9,8,12,8,8,8,6,9,6,9,4,4,9,9,9,9,9,8,9,13,6,8,9,5,13,8,7,9,6,6,
+9,9,10,4,3,6,6,8,12,12,12,7,11,11,11,11,11,11,14,10,8,8,8,8,6,6,6,6,11,12,
+11,11,11,11,11,9,11,11,11,11,11,8,9,10,9,9,9,9,9,9,14,8,9,9,9,9,4,4,4,4,9,
+9,9,9,9,9,9,9,9,9,9,9,9,8,9,8,11,9,11,9,11,9,10,8,10,8,10,8,10,8,11,9,11,
+9,8,9,8,9,8,9,8,9,8,9,11,8,11,8,11,8,11,8,11,9,11,9,6,4,6,4,6,4,6,4,6,4,10,
+8,4,4,9,8,8,8,4,8,4,8,4,8,6,8,4,12,9,12,9,12,9,11,12,9,11,9,11,9,11,9,14,
+15,10,6,10,6,10,6,8,7,8,7,8,7,8,7,8,5,8,5,8,5,11,9,11,9,11,9,11,9,11,9,11,
+9,14,12,8,8,8,9,8,9,8,9,8,5,9,11,9,14,14,11,9,8,7,9,9,9,9,4,9,3,9,9,9,9,11,
+4,10,12,7,13,11,13,5,11,11,8,10,8,9,11,11,6,9,10,14,12,9,11,11,9,9,8,8,13,
+9,13,11,6,8,9,7,9,5,9,9,10,8,9,7,7,9,9,5,8,8,9,8,8,9,10,9,8,9,7,9,11,8,12,
+12,5,9,9,9,12,8,11,8,10,8,6,6,4,15,15,11,9,10,11,11,9,11,8,10,8,14,9,12,12,
+9,11,14,11,11,11,9,10,8,10,13,9,11,10,16,16,11,13,10,10,16,10,9,9,9,6,9,9,
+11,7,9,9,8,9,11,9,9,9,9,8,7,8,11,8,9,9,14,14,11,12,9,8,13,9,9,9,6,8,7,4,4,
+4,14,14,9,8,8,9,8,6,14,12,14,12,14,12,8,8,8,16,16,7,3,3,3,3,6,6,6,8,8,7,12,
+20,4,7,5,5,8,2,6,9,9,13,9,13,8,16,13,11,10,12,12,12,12,9,10,11,10,9,9,11,
+6,9,9,9,9,9,9,9,10,4,8,8,8,6,6,6,6,6,6,6,8,16,8,16,5,4,3,9,4,3,2,0,0,16,16,
+4,3,9,9,12,14,14,11,9,13,5,6,14,14,11,9,11,10,0,0,0,0,0,8,12,9,9,16,13,11,
+9,14,11,11,9,14,12,11,9,15,14,9,7,13,12,11,9,10,8,10,8,19,17,11,9,14,13,16,
+13,10,8,10,9,9,9,9,16,15,12,9,9,9,9,9,8,6,11,8,14,11,9,7,10,9,9,8,9,8,11,
+10,11,9,12,11,17,13,13,10,10,8,8,7,8,7,8,7,9,8,13,11,11,10,10,9,11,9,13,10,
+13,10,6,14,11,11,9,11,9,11,9,11,9,10,9,14,11,6,11,9,11,9,14,14,8,9,11,9,11,
+9,14,11,9,7,9,8,12,9,12,9,11,9,11,9,11,9,10,8,10,8,10,8,10,8,10,9,8,6,13,
+12,8,6,10,8,9,8,9,9,14,14,15,13,10,8,16,14,16,14,11,9,11,10,9,7,11,9,11,9,
+11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,9,8,9,8,9,8,9,8,9,8,
+9,8,9,8,9,8,9,6,4,6,4,11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,9,11,
+9,11,9,11,9,11,9,11,10,11,10,11,10,11,10,11,10,8,8,8,8,8,8,9,0,0,0,0,0,0,
+0,0,0,3,3,3,9,8,5,0,17,20,10,0,9,4,4,7,11,9,14,12,4,5,5,9,9,4,5,4,6,9,9,9,
+9,9,9,9,9,9,9,4,4,9,9,9,7,15,10,11,10,12,9,9,12,12,6,5,10,8,15,13,13,10,13,
+11,9,9,12,10,15,9,9,10,5,6,5,9,7,10,9,10,8,10,9,6,8,9,4,4,8,4,15,9,10,10,
+10,6,8,6,9,8,13,8,8,8,6,9,6,9,4,4,9,9,9,9,9,8,10,14,6,8,9,5,14,9,7,9,6,6,
+10,9,11,4,3,6,6,8,13,13,13,7,10,10,10,10,10,10,14,10,9,9,9,9,6,6,6,6,12,13,
+13,13,13,13,13,9,13,12,12,12,12,9,10,10,9,9,9,9,9,9,14,8,9,9,9,9,4,4,4,4,
+10,9,10,10,10,10,10,9,10,9,9,9,9,8,10,8,10,9,10,9,10,9,10,8,10,8,10,8,10,
+8,12,10,12,10,9,9,9,9,9,9,9,9,9,9,12,8,12,8,12,8,12,8,12,9,12,9,6,4,6,4,6,
+4,6,4,6,4,11,8,5,4,10,8,8,8,4,8,4,8,4,8,6,8,4,13,9,13,9,13,9,11,13,9,13,10,
+13,10,13,10,15,15,11,6,11,6,11,6,9,8,9,8,9,8,9,8,9,6,9,6,9,6,12,9,12,9,12,
+9,12,9,12,9,12,9,15,13,9,8,9,10,8,10,8,10,8,5,9,10,9,14,14,13,10,9,8,10,10,
+9,10,4,10,3,10,10,10,10,10,4,10,13,8,13,11,13,5,10,11,9,10,9,10,12,13,6,10,
+10,15,13,9,13,12,10,9,9,9,14,9,14,13,6,9,10,8,9,5,9,10,10,8,10,8,8,9,10,5,
+8,9,9,8,8,10,11,10,8,10,8,9,12,9,12,13,5,9,10,9,13,9,12,9,10,9,6,6,5,15,16,
+12,10,10,12,10,10,11,9,11,9,14,10,13,13,10,11,15,12,13,12,10,10,9,10,14,9,
+12,11,17,17,11,14,11,10,18,11,9,10,9,6,9,9,12,8,9,9,8,9,12,9,10,9,10,8,8,
+8,12,8,9,9,15,15,11,12,9,8,14,9,9,9,6,8,8,4,4,4,14,14,9,8,8,9,8,7,15,13,15,
+13,15,13,9,8,9,17,17,7,3,3,3,3,6,6,6,8,8,6,15,20,4,7,5,5,8,2,6,9,9,13,9,14,
+9,18,14,13,11,13,13,13,13,10,10,12,11,9,9,12,7,9,9,9,9,9,10,10,10,4,9,9,9,
+6,6,6,6,6,6,6,9,17,9,17,6,4,3,9,5,3,2,0,0,17,17,4,3,10,10,13,15,15,10,9,13,
+6,7,16,16,13,10,12,10,0,0,0,0,0,9,13,9,9,17,14,11,10,15,12,10,9,15,12,12,
+11,17,14,9,8,14,12,13,10,10,8,10,8,20,18,13,10,15,13,17,14,10,8,10,9,10,10,
+10,17,16,14,9,10,10,10,10,9,6,11,9,14,12,10,8,11,9,10,8,10,8,11,10,12,9,13,
+11,18,15,14,11,10,8,9,8,9,7,9,7,9,8,13,12,12,10,11,9,12,9,14,10,14,10,6,14,
+12,11,9,11,9,12,9,12,9,11,9,15,12,6,10,9,10,9,14,14,9,9,13,9,13,9,14,12,10,
+8,10,8,13,9,13,9,13,10,13,10,13,10,10,8,10,8,10,8,10,8,11,9,9,6,14,12,9,6,
+10,9,9,8,10,10,15,15,16,13,11,9,16,14,17,14,12,10,13,11,10,8,11,9,10,9,10,
+9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,9,9,9,9,9,9,9,9,9,9,9,
+9,9,9,9,9,6,4,6,4,13,10,13,10,13,10,13,10,13,10,13,10,13,10,13,10,13,10,13,
+10,13,10,13,10,12,9,12,9,12,10,12,10,12,10,12,10,12,10,9,8,9,8,9,8,10,0,0,
+0,0,0,0,0,0,0,3,3,3,10,9,6,0,18,22,11,0,9,5,4,7,12,10,15,13,4,5,5,10,10,4,
+6,4,7,10,10,10,10,10,10,10,10,10,10,4,4,10,10,10,8,16,11,11,11,12,10,9,12,
+13,6,5,10,9,16,13,13,11,13,11,9,9,13,10,16,10,9,10,5,7,5,10,7,10,10,11,8,
+11,10,7,10,11,5,5,9,5,16,11,10,11,11,7,9,6,11,10,13,9,10,8,6,10,6,10,5,4,
+10,10,10,10,10,9,10,15,6,10,10,6,15,9,8,10,6,6,10,11,12,4,4,6,6,10,13,13,
+13,8,11,11,11,11,11,11,15,11,10,10,10,10,6,6,6,6,12,13,13,13,13,13,13,10,
+13,13,13,13,13,9,11,11,10,10,10,10,10,10,15,8,10,10,10,10,5,5,5,5,10,11,10,
+10,10,10,10,10,10,11,11,11,11,10,11,10,11,10,11,10,11,10,11,8,11,8,11,8,11,
+8,12,11,12,11,10,10,10,10,10,10,10,10,10,10,12,10,12,10,12,10,12,10,13,11,
+13,11,6,5,6,5,6,5,6,5,6,5,11,10,5,5,10,9,9,9,5,9,5,9,5,9,6,9,5,13,11,13,11,
+13,11,13,13,11,13,10,13,10,13,10,16,16,11,7,11,7,11,7,9,9,9,9,9,9,9,9,9,6,
+9,6,9,6,13,11,13,11,13,11,13,11,13,11,13,11,16,13,9,10,9,10,8,10,8,10,8,5,
+10,11,10,15,15,13,10,9,9,10,10,10,10,5,10,3,10,10,10,10,11,4,11,14,8,14,12,
+14,6,11,11,10,11,10,10,13,13,6,10,11,16,13,10,13,13,11,10,9,9,14,10,14,13,
+6,9,11,8,11,6,11,11,11,10,10,8,8,11,10,6,9,9,11,9,8,10,12,11,8,10,8,11,13,
+10,12,13,6,11,10,11,13,10,13,10,11,9,6,6,5,16,17,13,10,11,13,11,11,11,10,
+12,10,14,10,13,13,10,12,16,13,13,13,11,11,9,11,14,10,13,12,18,18,12,15,11,
+11,19,11,10,10,10,7,10,10,13,8,11,11,9,10,14,11,10,11,11,8,8,10,13,9,11,11,
+16,16,12,14,10,8,15,10,10,11,7,8,9,5,5,5,15,16,11,9,10,11,9,7,16,13,16,13,
+16,13,9,10,9,18,18,7,3,3,4,3,6,6,6,8,8,7,15,21,4,7,6,6,9,2,7,10,10,14,10,
+14,9,19,14,13,11,14,14,14,14,10,11,13,11,10,10,13,7,10,10,10,10,11,11,11,
+11,5,9,9,9,6,6,6,6,6,6,6,9,18,9,18,6,5,3,10,5,4,2,0,0,18,18,5,3,11,10,15,
+16,16,11,10,14,6,7,17,17,13,10,13,12,0,0,0,0,0,10,13,10,11,18,14,12,11,16,
+13,11,10,16,14,12,11,17,14,10,8,14,12,13,10,10,10,10,10,22,19,13,10,17,14,
+18,14,11,8,11,10,10,10,10,18,17,13,11,10,11,11,11,9,7,11,9,14,13,10,8,11,
+10,10,9,10,9,12,11,13,11,14,12,19,15,13,12,11,8,9,8,9,9,9,9,10,9,15,13,13,
+11,12,11,13,11,15,12,15,12,6,14,13,12,10,12,10,13,11,13,11,12,11,16,14,6,
+11,10,11,10,15,15,10,10,13,10,13,10,14,13,10,8,10,8,13,11,13,11,13,10,13,
+10,13,10,11,8,11,10,11,10,11,10,12,11,10,7,15,14,9,7,11,9,10,9,11,11,16,17,
+16,15,11,9,18,15,19,16,13,10,13,12,10,8,12,10,11,10,11,10,11,10,11,10,11,
+10,11,10,11,10,11,10,11,10,11,10,11,10,11,10,10,10,10,10,10,10,10,10,10,10,
+10,10,10,10,10,10,6,5,6,5,13,10,13,10,13,10,13,10,13,10,13,10,13,10,13,10,
+13,10,13,10,13,10,13,10,13,11,13,11,13,12,13,12,13,12,13,12,13,12,9,10,9,
+10,9,10,11,0,0,0,0,0,0,0,0,0,4,4,4,11,9,6,0,19,23,11,0,10,5,4,8,12,10,16,
+13,4,6,6,10,10,4,6,4,7,10,10,10,10,10,10,10,10,10,10,4,4,10,10,10,8,16,12,
+12,12,13,10,9,13,14,6,5,11,10,17,14,14,11,14,12,10,10,14,11,17,10,10,10,6,
+7,6,10,8,11,10,11,9,11,10,7,10,11,5,5,9,5,17,11,10,11,11,8,9,6,11,10,14,10,
+10,8,7,10,7,10,5,4,10,10,10,10,10,10,11,16,7,10,10,6,16,10,8,10,6,6,11,11,
+12,4,4,6,7,10,14,14,14,8,12,12,12,12,12,12,16,12,10,10,10,10,6,6,6,6,13,14,
+14,14,14,14,14,10,14,14,14,14,14,10,11,11,10,10,10,10,10,10,16,9,10,10,10,
+10,5,5,5,5,10,11,10,10,10,10,10,10,10,11,11,11,11,10,11,10,12,10,12,10,12,
+10,12,9,12,9,12,9,12,9,13,11,13,11,10,10,10,10,10,10,10,10,10,10,13,10,13,
+10,13,10,13,10,14,11,14,11,6,5,6,5,6,5,6,5,6,5,11,10,5,5,11,9,9,10,5,10,5,
+10,5,10,6,10,5,14,11,14,11,14,11,13,14,11,14,10,14,10,14,10,17,17,12,8,12,
+8,12,8,10,9,10,9,10,9,10,9,10,6,10,6,10,6,14,11,14,11,14,11,14,11,14,11,14,
+11,17,14,10,10,10,10,8,10,8,10,8,5,10,12,10,16,16,14,10,10,9,11,11,11,11,
+5,11,4,11,11,11,11,12,4,11,14,9,15,13,15,6,12,12,10,11,10,10,14,14,6,11,12,
+17,14,10,14,14,11,10,10,10,14,10,14,14,6,10,11,8,11,6,11,11,11,10,10,8,9,
+11,10,6,9,10,11,10,9,10,12,11,9,10,9,11,13,10,14,14,6,11,10,11,14,10,13,10,
+12,10,6,6,5,17,18,13,11,11,14,12,11,12,10,12,10,16,10,14,14,11,13,17,14,14,
+14,11,12,10,11,14,10,14,12,18,18,12,16,12,12,20,12,10,10,10,7,11,10,14,8,
+11,11,9,10,14,11,10,11,11,9,9,10,13,10,11,11,17,17,13,15,10,9,15,10,10,11,
+7,9,9,5,5,5,15,16,11,9,10,11,10,8,17,14,17,14,17,14,10,10,10,19,19,8,3,3,
+4,3,7,7,7,8,8,7,15,23,4,8,6,6,9,2,7,10,10,14,10,15,10,19,14,14,12,14,14,14,
+14,11,11,14,11,10,10,13,7,10,10,10,10,11,12,12,11,5,10,10,10,6,6,6,6,6,6,
+6,10,19,10,19,6,5,3,10,5,4,2,0,0,19,19,5,3,11,10,16,17,17,12,10,15,6,8,18,
+18,14,10,14,12,0,0,0,0,0,10,14,10,11,19,15,12,11,17,14,12,11,17,15,14,13,
+19,17,10,8,14,14,14,10,11,10,11,10,22,20,14,11,18,15,19,15,12,9,12,11,11,
+11,11,19,18,14,11,11,11,11,11,9,7,12,10,16,14,10,8,12,10,11,9,11,9,13,11,
+14,11,15,12,20,16,14,12,12,9,10,9,10,9,10,9,10,10,16,13,13,11,12,11,14,11,
+15,12,15,12,6,16,14,13,10,13,10,14,11,14,11,12,11,17,14,6,12,10,12,10,16,
+16,10,10,14,10,14,10,16,14,10,8,10,9,14,11,14,11,14,10,14,10,14,10,12,9,11,
+10,11,10,11,10,12,11,10,7,16,15,9,7,11,10,10,10,11,11,17,17,17,15,11,9,19,
+16,20,17,14,10,13,12,10,8,13,10,12,10,12,10,12,10,12,10,12,10,12,10,12,10,
+12,10,12,10,12,10,12,10,12,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+10,6,5,6,5,14,10,14,10,14,10,14,10,14,10,14,10,14,10,14,10,14,10,14,10,14,
+10,14,10,14,11,14,11,14,12,14,12,14,12,14,12,14,12,10,10,10,10,10,10,11,0,
+0,0,0,0,0,0,0,0,4,4,4,11,10,6,0,20,24,12,0,10,5,5,8,13,11,17,14,5,6,6,11,
+11,5,6,5,7,11,11,11,11,11,11,11,11,11,11,5,5,11,11,11,9,17,13,12,12,14,11,
+10,14,13,7,6,11,10,17,14,16,12,16,12,11,11,13,12,18,11,11,11,6,7,6,11,8,12,
+11,12,9,12,10,7,11,12,5,5,10,5,19,12,11,12,12,8,9,7,12,10,15,10,10,9,7,11,
+7,11,5,5,11,11,11,11,11,9,12,17,7,10,11,6,17,10,9,11,7,7,12,12,13,5,4,7,7,
+10,15,15,15,9,13,13,13,13,13,13,17,12,11,11,11,11,7,7,7,7,14,14,16,16,16,
+16,16,11,16,13,13,13,13,11,12,12,11,11,11,11,11,11,17,9,10,10,10,10,5,5,5,
+5,11,12,11,11,11,11,11,11,11,12,12,12,12,10,12,10,13,11,13,11,13,11,12,9,
+12,9,12,9,12,9,14,12,14,12,11,10,11,10,11,10,11,10,11,10,14,11,14,11,14,11,
+14,11,13,12,13,12,7,5,7,5,7,5,7,5,7,5,13,10,6,5,11,10,10,10,5,10,5,10,5,10,
+6,10,5,14,12,14,12,14,12,14,14,12,16,11,16,11,16,11,18,18,12,8,12,8,12,8,
+11,9,11,9,11,9,11,9,11,7,11,7,11,7,13,12,13,12,13,12,13,12,13,12,13,12,18,
+15,11,10,11,11,9,11,9,11,9,6,11,13,11,17,17,16,11,11,9,12,12,11,12,5,12,4,
+12,12,12,12,13,5,13,15,9,17,13,17,6,13,12,11,12,11,11,13,16,7,11,12,17,14,
+11,16,13,12,11,11,11,15,11,15,16,7,11,12,8,12,6,12,12,12,11,11,8,9,12,11,
+6,10,10,12,10,9,11,13,12,9,11,9,12,13,10,15,15,6,12,11,12,15,11,14,11,12,
+11,7,7,6,19,19,14,11,12,13,13,12,12,11,13,11,17,11,14,14,11,13,17,13,16,13,
+12,12,11,12,15,11,13,13,19,19,13,16,12,13,21,12,11,11,11,8,11,10,15,8,12,
+12,10,11,14,12,11,12,12,9,9,10,15,10,12,12,17,17,14,16,11,9,17,11,10,12,8,
+9,9,5,5,5,17,17,12,10,10,12,9,8,18,15,18,15,18,15,11,10,10,20,20,8,4,4,4,
+4,8,8,8,10,10,8,15,23,5,8,6,6,10,3,7,11,11,15,11,16,10,20,15,16,12,15,15,
+15,15,12,12,14,12,11,11,14,8,11,11,11,11,11,12,12,12,5,10,10,10,7,7,7,7,7,
+7,7,10,20,10,20,7,5,3,11,5,4,2,0,0,20,20,5,4,12,11,17,17,19,13,11,16,7,8,
+18,18,16,11,15,13,0,0,0,0,0,11,14,10,12,19,16,13,12,18,14,13,11,18,15,15,
+13,19,17,11,8,15,15,16,11,12,10,12,10,24,21,16,12,18,16,19,16,12,9,12,11,
+12,12,12,20,19,14,12,12,12,12,12,10,8,12,10,17,15,11,8,12,11,11,10,11,10,
+13,12,13,12,15,14,21,17,15,12,12,9,11,9,11,11,11,11,11,10,17,15,13,13,13,
+12,13,12,16,13,16,13,7,17,15,13,11,13,11,13,12,13,12,13,12,17,14,7,13,11,
+13,11,17,17,11,10,15,10,15,10,17,15,11,8,11,9,14,12,14,12,16,11,16,11,16,
+11,13,9,12,10,12,10,12,10,13,12,11,8,16,16,10,8,12,10,11,10,12,12,18,18,17,
+15,11,9,19,17,19,18,15,11,14,14,11,8,13,11,13,11,13,11,13,11,13,11,13,11,
+13,11,13,11,13,11,13,11,13,11,13,11,13,11,11,10,11,10,11,10,11,10,11,10,11,
+10,11,10,11,10,7,5,7,5,16,11,16,11,16,11,16,11,16,11,16,11,16,11,16,11,16,
+11,16,11,16,11,16,11,13,12,13,12,15,13,15,13,15,13,15,13,15,13,11,10,11,10,
+11,10,12,0,0,0,0,0,0,0,0,0,4,4,4,12,11,7,0,21,26,13,0,11,5,6,8,14,12,17,15,
+4,6,6,12,12,6,7,6,8,12,12,12,12,12,12,12,12,12,12,6,6,12,12,12,9,18,13,13,
+13,14,11,10,14,15,8,6,12,10,18,15,15,12,15,13,11,10,15,12,19,11,12,11,6,8,
+6,11,9,12,11,12,10,12,11,7,11,12,5,5,10,5,19,12,12,12,12,8,9,7,12,11,16,11,
+11,9,7,12,7,12,5,6,12,12,12,12,12,10,12,17,7,10,12,7,17,11,9,12,7,7,12,12,
+14,6,4,7,7,10,15,15,15,9,13,13,13,13,13,13,18,13,11,11,11,11,8,8,8,8,14,15,
+15,15,15,15,15,12,15,15,15,15,15,12,12,12,11,11,11,11,11,11,18,10,11,11,11,
+11,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,11,12,11,13,11,13,11,13,
+11,13,10,13,10,13,10,13,10,14,12,14,12,11,11,11,11,11,11,11,11,11,11,14,11,
+14,11,14,11,14,11,15,12,15,12,8,5,8,5,8,5,8,5,8,5,13,11,6,5,12,10,10,10,5,
+10,5,10,5,10,6,10,5,15,12,15,12,15,12,14,15,12,15,12,15,12,15,12,19,20,13,
+8,13,8,13,8,11,9,11,9,11,9,11,9,10,7,10,7,10,7,15,12,15,12,15,12,15,12,15,
+12,15,12,19,16,12,11,12,11,9,11,9,11,9,6,12,13,11,18,18,15,12,11,9,12,12,
+12,12,5,12,4,12,12,12,12,13,6,13,16,10,16,14,17,6,13,13,11,12,11,11,15,15,
+8,12,13,18,15,11,15,15,12,11,10,12,16,11,16,15,8,12,12,9,12,6,12,12,13,11,
+12,9,9,12,12,6,10,11,12,11,10,12,13,12,10,12,9,12,15,11,16,15,6,12,12,12,
+15,11,15,11,13,11,8,8,6,19,20,15,12,12,15,13,12,13,11,14,11,18,11,15,15,12,
+14,18,15,15,15,12,13,10,12,16,11,15,14,20,20,14,17,13,13,21,13,11,12,11,8,
+12,11,15,9,12,12,10,12,15,12,12,12,12,10,9,11,15,11,12,12,17,17,14,16,11,
+10,18,11,11,12,8,10,9,5,5,5,17,18,12,10,11,12,10,8,19,16,19,16,19,16,12,11,
+11,21,21,9,4,4,4,4,8,8,8,10,10,9,18,25,4,8,6,6,10,3,7,12,12,16,12,17,11,21,
+17,15,13,16,16,16,16,12,12,15,12,12,12,15,8,12,12,12,12,11,12,12,12,5,11,
+11,11,7,7,7,7,7,7,7,11,21,11,21,7,5,4,12,6,4,2,0,0,21,21,5,4,13,12,17,18,
+19,13,11,16,7,8,19,19,15,12,16,13,0,0,0,0,0,11,15,11,12,20,17,13,12,19,15,
+13,11,18,15,14,13,20,17,11,9,16,16,15,12,12,11,12,11,26,22,16,13,19,17,20,
+17,13,10,13,12,12,12,12,21,20,16,12,12,12,12,12,10,8,13,11,18,15,11,9,13,
+11,12,10,12,10,14,13,15,12,17,14,22,18,16,13,13,10,10,9,12,11,12,11,11,11,
+17,15,14,13,14,12,15,12,17,14,17,14,8,18,15,14,11,14,12,15,12,15,12,14,12,
+18,15,8,13,11,13,11,18,18,11,11,15,11,15,11,18,15,11,9,11,10,15,12,15,12,
+15,12,15,12,15,12,13,10,12,11,12,11,12,11,14,12,11,8,17,16,10,8,13,11,11,
+11,12,12,18,18,18,16,12,10,20,18,21,18,15,12,14,14,11,9,14,12,13,11,13,11,
+13,11,13,11,13,11,13,11,13,11,13,11,13,11,13,11,13,11,13,11,11,11,11,11,11,
+11,11,11,11,11,11,11,11,11,11,11,8,5,8,5,15,12,15,12,15,12,15,12,15,12,15,
+12,15,12,15,12,15,12,15,12,15,12,15,12,15,12,15,12,16,13,16,13,16,13,16,13,
+16,13,12,11,12,11,12,11,12,0,0,0,0,0,0,0,0,0,4,4,4,12,10,7,0,22,26,13,0,11,
+6,6,8,14,12,18,15,4,7,7,12,12,6,7,6,8,12,12,12,12,12,12,12,12,12,12,6,6,12,
+12,12,9,19,13,14,13,15,12,11,15,15,8,6,13,11,19,16,16,13,16,13,11,11,15,13,
+19,12,12,12,7,8,7,12,9,13,12,13,10,13,12,7,11,13,6,6,11,6,20,13,13,13,13,
+9,10,7,13,11,16,11,11,10,8,12,8,12,6,6,12,12,12,12,12,11,13,18,7,11,12,7,
+18,11,9,12,7,7,13,13,14,6,5,7,8,11,16,16,16,9,13,13,13,13,13,13,19,13,12,
+12,12,12,8,8,8,8,15,16,16,16,16,16,16,12,16,15,15,15,15,12,13,13,12,12,12,
+12,12,12,18,10,12,12,12,12,6,6,6,6,13,13,13,13,13,13,13,12,13,13,13,13,13,
+11,13,11,13,12,13,12,13,12,13,10,13,10,13,10,13,10,15,13,15,13,12,12,12,12,
+12,12,12,12,12,12,15,11,15,11,15,11,15,11,15,13,15,13,8,6,8,6,8,6,8,6,8,6,
+13,12,6,6,13,11,11,11,6,11,6,11,6,11,7,11,6,16,13,16,13,16,13,15,16,13,16,
+13,16,13,16,13,20,21,13,9,13,9,13,9,11,10,11,10,11,10,11,10,11,7,11,7,11,
+7,15,13,15,13,15,13,15,13,15,13,15,13,19,16,12,11,12,12,10,12,10,12,10,6,
+12,13,12,19,18,16,13,11,10,13,13,12,13,6,13,4,13,13,13,13,13,6,13,17,10,17,
+15,17,7,13,14,12,13,12,12,15,16,8,13,13,19,16,12,16,15,13,12,11,12,16,12,
+16,16,8,12,13,10,13,7,13,13,13,11,13,10,10,13,13,7,11,11,13,11,10,13,14,13,
+10,13,10,13,16,12,16,16,7,13,13,13,16,12,15,12,13,11,8,8,6,20,21,15,13,13,
+15,13,13,14,12,14,12,18,12,16,16,13,15,19,15,16,15,13,13,11,13,16,12,15,15,
+22,22,15,18,14,13,23,13,12,13,12,9,12,12,16,10,13,13,11,12,16,13,13,13,13,
+10,10,11,16,11,13,13,20,20,14,17,12,10,19,12,12,13,9,10,10,6,6,6,18,19,13,
+11,11,13,10,9,19,16,19,16,19,16,12,11,11,22,22,9,4,4,5,4,8,8,8,11,11,8,18,
+26,4,8,7,7,11,3,8,12,12,17,12,18,11,22,17,16,14,17,17,17,17,13,13,15,13,12,
+12,15,8,12,12,12,12,13,13,13,12,6,11,11,11,7,7,7,7,7,7,7,11,22,11,22,7,6,
+4,12,6,4,2,0,0,22,22,6,4,13,12,18,19,20,13,12,17,7,9,20,20,16,13,16,14,0,
+0,0,0,0,12,16,12,13,22,17,14,13,20,16,13,12,19,17,14,14,20,18,12,10,16,16,
+16,13,13,11,13,11,26,23,17,14,21,17,22,18,13,10,13,12,13,13,13,22,21,16,13,
+13,13,13,13,11,9,14,12,18,16,12,10,14,12,13,11,13,11,14,13,15,13,17,15,23,
+19,16,14,13,10,11,10,12,10,12,10,12,11,18,15,15,13,15,13,15,13,18,14,18,14,
+8,18,16,15,12,15,12,15,13,15,13,15,13,19,16,8,13,12,13,12,19,18,12,12,15,
+12,15,12,18,16,12,10,12,10,16,13,16,13,16,13,16,13,16,13,13,10,13,11,13,11,
+13,11,15,13,12,9,18,17,11,9,13,12,12,11,13,13,20,19,20,17,13,11,22,18,22,
+19,16,13,15,15,12,10,15,12,13,12,13,12,13,12,13,12,13,12,13,12,13,12,13,12,
+13,12,13,12,13,12,13,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,8,
+6,8,6,16,13,16,13,16,13,16,13,16,13,16,13,16,13,16,13,16,13,16,13,16,13,16,
+13,15,13,15,13,16,14,16,14,16,14,16,14,16,14,12,11,12,11,12,11,13,0,0,0,0,
+0,0,0,0,0,5,5,5,13,11,7,0,23,28,14,0,12,6,6,8,15,13,19,16,4,7,7,13,13,6,7,
+6,9,13,13,13,13,13,13,13,13,13,13,6,6,13,13,13,10,20,14,14,14,16,12,11,16,
+16,8,6,13,11,20,17,17,13,17,14,12,12,16,13,20,13,12,12,7,9,7,12,9,13,12,13,
+11,13,12,8,12,14,6,6,11,6,20,14,13,13,13,9,10,8,14,11,17,11,11,10,8,12,8,
+13,6,6,13,13,13,13,12,11,13,19,8,11,13,7,19,12,10,13,8,8,13,14,15,6,5,8,8,
+11,17,17,17,10,14,14,14,14,14,14,20,14,12,12,12,12,8,8,8,8,16,17,17,17,17,
+17,17,13,17,16,16,16,16,12,13,14,12,12,12,12,12,12,19,11,12,12,12,12,6,6,
+6,6,13,14,13,13,13,13,13,13,13,14,14,14,14,11,13,11,14,12,14,12,14,12,14,
+11,14,11,14,11,14,11,16,13,16,13,12,12,12,12,12,12,12,12,12,12,16,12,16,12,
+16,12,16,12,16,14,16,14,8,6,8,6,8,6,8,6,8,6,14,12,6,6,13,11,11,11,6,11,6,
+11,6,11,8,11,6,17,14,17,14,17,14,16,17,14,17,13,17,13,17,13,20,21,14,9,14,
+9,14,9,12,10,12,10,12,10,12,10,12,8,12,8,12,8,16,14,16,14,16,14,16,14,16,
+14,16,14,20,17,12,11,12,12,10,12,10,12,10,7,13,14,12,20,19,17,13,12,10,13,
+13,13,13,6,13,4,13,13,13,13,14,6,14,18,11,18,15,18,8,14,14,12,13,12,12,16,
+17,8,13,14,20,17,12,17,16,13,12,12,12,18,13,18,17,8,12,13,10,14,8,14,13,14,
+11,13,10,10,14,13,8,11,12,14,11,11,13,15,13,11,13,10,14,16,12,17,16,8,14,
+13,14,16,12,16,12,14,12,8,8,6,21,22,16,13,13,16,14,13,14,12,15,12,18,13,17,
+17,13,15,20,16,17,16,13,14,12,13,18,13,16,15,22,22,15,19,14,14,24,14,12,13,
+13,9,13,12,16,11,14,14,11,13,17,14,13,14,13,11,10,11,16,11,14,13,20,20,16,
+18,13,11,19,12,12,14,9,11,10,6,6,6,20,21,14,11,11,14,11,9,20,17,20,17,20,
+17,12,11,12,23,23,9,4,4,5,4,8,8,8,10,10,10,18,27,4,8,8,8,11,3,8,13,13,17,
+13,18,12,23,18,17,14,17,17,17,17,13,13,16,14,13,13,16,9,13,13,13,13,13,14,
+14,13,6,12,12,12,8,8,8,8,8,8,8,12,23,12,23,8,6,4,13,6,5,2,0,0,23,23,6,4,14,
+12,18,20,20,14,12,18,8,9,21,21,17,13,17,15,0,0,0,0,0,12,17,12,14,22,18,14,
+13,21,16,14,12,20,17,16,14,22,19,13,11,18,17,17,13,13,11,13,11,28,24,18,15,
+21,18,22,19,14,11,14,13,13,13,13,23,22,17,14,13,13,13,13,11,9,14,13,18,16,
+13,11,14,12,13,11,13,11,15,13,16,14,18,16,24,20,17,14,14,11,12,10,12,11,12,
+11,13,11,19,16,15,14,15,13,16,14,19,15,19,15,8,18,16,15,13,15,13,16,14,16,
+14,15,13,20,17,8,14,12,14,12,20,19,12,12,16,12,16,12,18,16,13,11,13,11,17,
+14,17,14,17,13,17,13,17,13,14,11,13,11,13,11,13,11,15,13,12,9,19,18,11,9,
+14,12,13,11,13,13,20,20,21,19,14,12,22,20,23,21,17,13,16,15,13,11,15,13,14,
+12,14,12,14,12,14,12,14,12,14,12,14,12,14,12,14,12,14,12,14,12,14,12,12,12,
+12,12,12,12,12,12,12,12,12,12,12,12,12,12,8,6,8,6,17,13,17,13,17,13,17,13,
+17,13,17,13,17,13,17,13,17,13,17,13,17,13,17,13,16,14,16,14,17,15,17,15,17,
+15,17,15,17,15,12,11,12,11,12,11,13,0,0,0,0,0,0,0,0,0,5,5,5,13,12,8,0,24,
+28,14,0,12,6,6,10,16,13,20,17,5,7,7,13,13,6,8,6,9,13,13,13,13,13,13,13,13,
+13,13,6,6,13,13,13,10,21,15,15,14,16,13,12,17,17,9,7,14,12,21,18,18,14,18,
+14,13,13,17,14,21,13,13,13,7,9,7,13,10,14,13,14,11,14,13,8,13,14,6,6,12,6,
+22,14,14,14,14,10,11,8,14,12,18,12,12,11,9,13,9,13,6,6,13,13,13,13,13,12,
+14,20,8,12,13,8,20,12,10,13,8,8,14,14,16,6,5,8,8,12,18,18,18,10,15,15,15,
+15,15,15,20,14,13,13,13,13,9,9,9,9,16,18,18,18,18,18,18,13,18,17,17,17,17,
+13,14,14,13,13,13,13,13,13,20,11,13,13,13,13,6,6,6,6,14,14,14,14,14,14,14,
+13,14,14,14,14,14,12,14,12,15,13,15,13,15,13,14,11,14,11,14,11,14,11,16,14,
+16,14,13,13,13,13,13,13,13,13,13,13,17,13,17,13,17,13,17,13,17,14,17,14,9,
+6,9,6,9,6,9,6,9,6,15,12,7,6,14,12,12,12,6,12,6,12,6,12,8,12,6,18,14,18,14,
+18,14,16,18,14,18,14,18,14,18,14,21,22,14,10,14,10,14,10,13,11,13,11,13,11,
+13,11,13,8,13,8,13,8,17,14,17,14,17,14,17,14,17,14,17,14,21,18,13,12,13,13,
+11,13,11,13,11,7,13,15,13,20,20,18,14,13,11,14,14,13,14,6,14,4,14,14,14,14,
+15,6,14,18,11,19,16,19,8,15,15,13,14,13,13,17,18,9,14,15,21,18,13,18,17,14,
+13,13,13,19,13,19,18,9,13,14,11,14,8,14,14,14,12,14,11,11,14,14,8,12,12,14,
+12,11,14,15,14,11,14,11,14,16,13,18,18,8,14,14,14,18,13,17,13,14,13,9,9,7,
+22,23,17,14,14,17,15,14,15,13,16,13,20,13,18,18,14,16,21,17,18,17,14,14,13,
+14,19,13,17,16,23,23,16,20,15,14,25,14,13,14,13,10,13,13,16,11,14,14,12,13,
+17,14,14,14,14,11,10,12,16,12,14,14,20,20,16,18,13,11,20,13,13,14,10,11,11,
+6,6,6,20,21,14,12,12,14,12,10,21,18,21,18,21,18,13,12,12,24,24,10,4,4,5,4,
+9,9,9,11,11,10,18,28,5,10,8,8,12,3,8,13,13,18,13,19,12,24,19,18,15,18,18,
+18,18,14,14,17,14,13,13,17,9,13,13,13,13,15,14,14,13,6,12,12,12,8,8,8,8,8,
+8,8,12,24,12,24,8,6,4,13,6,5,2,0,0,24,24,6,4,14,13,20,21,22,15,13,19,8,10,
+22,22,18,14,17,15,0,0,0,0,0,13,18,13,14,23,19,15,14,21,17,15,13,21,18,17,
+14,23,20,13,11,19,18,18,14,14,12,14,12,28,25,19,15,22,19,23,19,14,11,15,13,
+14,14,14,24,23,18,14,14,14,14,14,12,10,15,13,20,16,13,11,15,13,14,12,14,12,
+16,14,17,14,18,16,25,21,18,15,14,11,13,10,13,12,13,12,13,12,20,17,16,14,16,
+14,17,14,19,15,19,15,9,20,16,16,13,16,13,17,14,17,14,16,14,21,17,9,15,13,
+15,13,20,20,13,13,17,13,17,13,20,16,13,11,13,11,18,14,18,14,18,14,18,14,18,
+14,14,11,14,12,14,12,14,12,16,14,13,10,20,18,12,10,14,13,13,12,14,14,21,21,
+21,19,13,12,23,20,24,21,17,14,17,15,13,11,16,13,15,13,15,13,15,13,15,13,15,
+13,15,13,15,13,15,13,15,13,15,13,15,13,15,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,9,6,9,6,18,14,18,14,18,14,18,14,18,14,18,14,18,14,18,14,
+18,14,18,14,18,14,18,14,17,14,17,14,17,15,17,15,17,15,17,15,17,15,13,12,13,
+12,13,12,14,0,0,0,0,0,0,0,0,0,5,5,5,14,13,8,0,0,0,0,3,0,0,0,3,0,0,0,28,0,
+1,0,0,0,0,3,36,0,3,0,1,0,0,5,46,0,4,3,8,0,0,0,146,0,128,0,6,0,18,0,126,1,
+97,1,127,1,146,1,161,1,176,1,240,1,255,2,27,2,188,2,199,2,201,2,221,2,243,
+3,1,3,3,3,9,3,15,3,35,3,138,3,140,3,161,3,206,3,210,3,214,4,13,4,79,4,95,
+4,134,4,145,5,19,30,1,30,63,30,133,30,241,30,249,31,77,32,11,32,21,32,30,
+32,34,32,38,32,48,32,51,32,58,32,60,32,68,32,127,32,164,32,167,32,172,33,
+5,33,19,33,22,33,34,33,38,33,46,33,94,34,2,34,6,34,15,34,18,34,26,34,30,34,
+43,34,72,34,96,34,101,37,202,251,4,254,255,255,253,255,255,0,0,0,32,0,160,
+1,98,1,146,1,160,1,175,1,240,1,250,2,24,2,188,2,198,2,201,2,216,2,243,3,0,
+3,3,3,9,3,15,3,35,3,132,3,140,3,142,3,163,3,209,3,214,4,0,4,14,4,80,4,96,
+4,136,4,146,30,0,30,62,30,128,30,160,30,242,31,77,32,0,32,19,32,23,32,32,
+32,38,32,48,32,50,32,57,32,60,32,68,32,127,32,163,32,167,32,171,33,5,33,19,
+33,22,33,34,33,38,33,46,33,91,34,2,34,6,34,15,34,17,34,26,34,30,34,43,34,
+72,34,96,34,100,37,202,251,1,254,255,255,252,255,255,255,227,255,194,0,0,
+255,176,0,191,0,178,0,97,255,73,0,0,255,150,254,133,254,132,254,118,255,104,
+255,99,255,98,255,93,0,103,255,68,253,208,253,207,253,206,253,205,254,130,
+254,127,0,0,253,154,0,0,254,12,0,0,254,9,228,88,228,24,227,122,228,125,0,
+0,227,13,226,66,225,239,225,238,225,237,225,234,225,225,225,224,225,219,225,
+218,225,211,225,153,225,118,225,116,0,0,225,24,225,11,225,9,224,254,224,251,
+224,244,224,200,224,37,224,34,224,26,224,25,224,18,224,15,224,3,223,231,223,
+208,223,205,220,105,0,0,3,79,2,83,0,1,0,0,0,0,0,142,0,0,0,0,0,0,0,0,0,0,0,
+190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,
+0,0,0,188,0,0,0,216,0,0,0,0,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,0,0,0,0,0,0,3,131,3,132,1,38,1,39,1,
+40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,
+1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,73,1,74,1,36,1,37,
+2,104,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,
+167,2,105,2,106,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,
+1,244,1,245,2,107,1,246,1,247,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,
+154,1,248,1,249,2,0,2,1,3,111,3,112,3,113,3,114,3,115,3,116,3,117,2,28,2,
+52,2,53,2,93,2,94,0,6,2,10,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,2,0,2,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,0,0,0,0,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,
+0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,
+0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,
+0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,
+0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,
+0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,
+0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,0,0,0,134,0,135,0,137,0,139,0,147,
+0,152,0,158,0,163,0,162,0,164,0,166,0,165,0,167,0,169,0,171,0,170,0,172,0,
+173,0,175,0,174,0,176,0,177,0,179,0,181,0,180,0,182,0,184,0,183,0,188,0,187,
+0,189,0,190,2,13,0,114,0,100,0,101,0,105,2,15,0,120,0,161,0,112,0,107,2,32,
+0,118,0,106,2,48,0,136,0,154,2,45,0,115,2,49,2,50,0,103,0,119,2,39,2,42,2,
+41,1,141,2,46,0,108,0,124,2,33,0,168,0,186,0,129,0,99,0,110,2,44,1,66,2,47,
+2,40,0,109,0,125,2,16,0,98,0,130,0,133,0,151,1,20,1,21,2,2,2,3,2,10,2,11,
+2,6,2,7,0,185,2,51,0,193,1,58,2,23,2,28,2,20,2,21,2,52,2,53,2,14,0,121,2,
+8,2,12,2,17,0,132,0,140,0,131,0,141,0,138,0,143,0,144,0,145,0,142,0,149,0,
+150,0,0,0,148,0,156,0,157,0,155,0,243,1,75,1,82,0,113,1,78,1,79,1,80,0,122,
+1,83,1,81,1,76,0,4,3,8,0,0,0,146,0,128,0,6,0,18,0,126,1,97,1,127,1,146,1,
+161,1,176,1,240,1,255,2,27,2,188,2,199,2,201,2,221,2,243,3,1,3,3,3,9,3,15,
+3,35,3,138,3,140,3,161,3,206,3,210,3,214,4,13,4,79,4,95,4,134,4,145,5,19,
+30,1,30,63,30,133,30,241,30,249,31,77,32,11,32,21,32,30,32,34,32,38,32,48,
+32,51,32,58,32,60,32,68,32,127,32,164,32,167,32,172,33,5,33,19,33,22,33,34,
+33,38,33,46,33,94,34,2,34,6,34,15,34,18,34,26,34,30,34,43,34,72,34,96,34,
+101,37,202,251,4,254,255,255,253,255,255,0,0,0,32,0,160,1,98,1,146,1,160,
+1,175,1,240,1,250,2,24,2,188,2,198,2,201,2,216,2,243,3,0,3,3,3,9,3,15,3,35,
+3,132,3,140,3,142,3,163,3,209,3,214,4,0,4,14,4,80,4,96,4,136,4,146,30,0,30,
+62,30,128,30,160,30,242,31,77,32,0,32,19,32,23,32,32,32,38,32,48,32,50,32,
+57,32,60,32,68,32,127,32,163,32,167,32,171,33,5,33,19,33,22,33,34,33,38,33,
+46,33,91,34,2,34,6,34,15,34,17,34,26,34,30,34,43,34,72,34,96,34,100,37,202,
+251,1,254,255,255,252,255,255,255,227,255,194,0,0,255,176,0,191,0,178,0,97,
+255,73,0,0,255,150,254,133,254,132,254,118,255,104,255,99,255,98,255,93,0,
+103,255,68,253,208,253,207,253,206,253,205,254,130,254,127,0,0,253,154,0,
+0,254,12,0,0,254,9,228,88,228,24,227,122,228,125,0,0,227,13,226,66,225,239,
+225,238,225,237,225,234,225,225,225,224,225,219,225,218,225,211,225,153,225,
+118,225,116,0,0,225,24,225,11,225,9,224,254,224,251,224,244,224,200,224,37,
+224,34,224,26,224,25,224,18,224,15,224,3,223,231,223,208,223,205,220,105,
+0,0,3,79,2,83,0,1,0,0,0,0,0,142,0,0,0,0,0,0,0,0,0,0,0,190,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,0,0,0,188,0,0,0,216,
+0,0,0,0,0,0,0,0,0,0,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,176,0,0,0,0,0,0,3,131,3,132,1,38,1,39,1,40,1,41,1,42,1,43,1,
+44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,
+1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,73,1,74,1,36,1,37,2,104,1,156,1,157,
+1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,2,105,2,106,1,
+234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,2,107,
+1,246,1,247,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,1,248,1,249,2,
+0,2,1,3,111,3,112,3,113,3,114,3,115,3,116,3,117,2,28,2,52,2,53,2,93,2,94,
+0,0,64,69,89,88,85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,
+66,65,64,63,62,61,60,59,58,57,56,55,54,53,49,48,47,46,45,44,40,39,38,37,36,
+35,34,33,31,24,20,17,16,15,14,13,11,10,9,8,7,6,5,4,3,2,1,0,44,69,35,70,96,
+32,176,38,96,176,4,38,35,72,72,45,44,69,35,70,35,97,32,176,38,97,176,4,38,
+35,72,72,45,44,69,35,70,96,176,32,97,32,176,70,96,176,4,38,35,72,72,45,44,
+69,35,70,35,97,176,32,96,32,176,38,97,176,32,97,176,4,38,35,72,72,45,44,69,
+35,70,96,176,64,97,32,176,102,96,176,4,38,35,72,72,45,44,69,35,70,35,97,176,
+64,96,32,176,38,97,176,64,97,176,4,38,35,72,72,45,44,1,16,32,60,0,60,45,44,
+32,69,35,32,176,205,68,35,32,184,1,90,81,88,35,32,176,141,68,35,89,32,176,
+237,81,88,35,32,176,77,68,35,89,32,176,4,38,81,88,35,32,176,13,68,35,89,33,
+33,45,44,32,32,69,24,104,68,32,176,1,96,32,69,176,70,118,104,138,69,96,68,
+45,44,1,177,11,10,67,35,67,101,10,45,44,0,177,10,11,67,35,67,11,45,44,0,176,
+40,35,112,177,1,40,62,1,176,40,35,112,177,2,40,69,58,177,2,0,8,13,45,44,32,
+69,176,3,37,69,97,100,176,80,81,88,69,68,27,33,33,89,45,44,73,176,14,35,68,
+45,44,32,69,176,0,67,96,68,45,44,1,176,6,67,176,7,67,101,10,45,44,32,105,
+176,64,97,176,0,139,32,177,44,192,138,140,184,16,0,98,96,43,12,100,35,100,
+97,92,88,176,3,97,89,45,44,138,3,69,138,138,135,176,17,43,176,41,35,68,176,
+41,122,228,24,45,44,69,101,176,44,35,68,69,176,43,35,68,45,44,75,82,88,69,
+68,27,33,33,89,45,44,75,81,88,69,68,27,33,33,89,45,44,1,176,5,37,16,35,32,
+138,245,0,176,1,96,35,237,236,45,44,1,176,5,37,16,35,32,138,245,0,176,1,97,
+35,237,236,45,44,1,176,6,37,16,245,0,237,236,45,44,70,35,70,96,138,138,70,
+35,32,70,138,96,138,97,184,255,128,98,35,32,16,35,138,177,12,12,138,112,69,
+96,32,176,0,80,88,176,1,97,184,255,186,139,27,176,70,140,89,176,16,96,104,
+1,58,45,44,32,69,176,3,37,70,82,75,176,19,81,91,88,176,2,37,70,32,104,97,
+176,3,37,176,3,37,63,35,33,56,27,33,17,89,45,44,32,69,176,3,37,70,80,88,176,
+2,37,70,32,104,97,176,3,37,176,3,37,63,35,33,56,27,33,17,89,45,44,0,176,7,
+67,176,6,67,11,45,44,33,33,12,100,35,100,139,184,64,0,98,45,44,33,176,128,
+81,88,12,100,35,100,139,184,32,0,98,27,178,0,64,47,43,89,176,2,96,45,44,33,
+176,192,81,88,12,100,35,100,139,184,21,85,98,27,178,0,128,47,43,89,176,2,
+96,45,44,12,100,35,100,139,184,64,0,98,96,35,33,45,44,75,83,88,138,176,4,
+37,73,100,35,69,105,176,64,139,97,176,128,98,176,32,97,106,176,14,35,68,35,
+16,176,14,246,27,33,35,138,18,17,32,57,47,89,45,44,75,83,88,32,176,3,37,73,
+100,105,32,176,5,38,176,6,37,73,100,35,97,176,128,98,176,32,97,106,176,14,
+35,68,176,4,38,16,176,14,246,138,16,176,14,35,68,176,14,246,176,14,35,68,
+176,14,237,27,138,176,4,38,17,18,32,57,35,32,57,47,47,89,45,44,69,35,69,96,
+35,69,96,35,69,96,35,118,104,24,176,128,98,32,45,44,176,72,43,45,44,32,69,
+176,0,84,88,176,64,68,32,69,176,64,97,68,27,33,33,89,45,44,69,177,48,47,69,
+35,69,97,96,176,1,96,105,68,45,44,75,81,88,176,47,35,112,176,20,35,66,27,
+33,33,89,45,44,75,81,88,32,176,3,37,69,105,83,88,68,27,33,33,89,27,33,33,
+89,45,44,69,176,20,67,176,0,96,99,176,1,96,105,68,45,44,176,47,69,68,45,44,
+69,35,32,69,138,96,68,45,44,69,35,69,96,68,45,44,75,35,81,88,185,0,51,255,
+224,177,52,32,27,179,51,0,52,0,89,68,68,45,44,176,22,67,88,176,3,38,69,138,
+88,100,102,176,31,96,27,100,176,32,96,102,32,88,27,33,176,64,89,176,1,97,
+89,35,88,101,89,176,41,35,68,35,16,176,41,224,27,33,33,33,33,33,89,45,44,
+176,2,67,84,88,75,83,35,75,81,90,88,56,27,33,33,89,27,33,33,33,33,89,45,44,
+176,22,67,88,176,4,37,69,100,176,32,96,102,32,88,27,33,176,64,89,176,1,97,
+35,88,27,101,89,176,41,35,68,176,5,37,176,8,37,8,32,88,2,27,3,89,176,4,37,
+16,176,5,37,32,70,176,4,37,35,66,60,176,4,37,176,7,37,8,176,7,37,16,176,6,
+37,32,70,176,4,37,176,1,96,35,66,60,32,88,1,27,0,89,176,4,37,16,176,5,37,
+176,41,224,176,41,32,69,101,68,176,7,37,16,176,6,37,176,41,224,176,5,37,176,
+8,37,8,32,88,2,27,3,89,176,5,37,176,3,37,67,72,176,4,37,176,7,37,8,176,6,
+37,176,3,37,176,1,96,67,72,27,33,89,33,33,33,33,33,33,33,45,44,2,176,4,37,
+32,32,70,176,4,37,35,66,176,5,37,8,176,3,37,69,72,33,33,33,33,45,44,2,176,
+3,37,32,176,4,37,8,176,2,37,67,72,33,33,33,45,44,69,35,32,69,24,32,176,0,
+80,32,88,35,101,35,89,35,104,32,176,64,80,88,33,176,64,89,35,88,101,89,138,
+96,68,45,44,75,83,35,75,81,90,88,32,69,138,96,68,27,33,33,89,45,44,75,84,
+88,32,69,138,96,68,27,33,33,89,45,44,75,83,35,75,81,90,88,56,27,33,33,89,
+45,44,176,0,33,75,84,88,56,27,33,33,89,45,44,176,2,67,84,88,176,70,43,27,
+33,33,33,33,89,45,44,176,2,67,84,88,176,71,43,27,33,33,33,89,45,44,176,2,
+67,84,88,176,72,43,27,33,33,33,33,89,45,44,176,2,67,84,88,176,73,43,27,33,
+33,33,89,45,44,32,138,8,35,75,83,138,75,81,90,88,35,56,27,33,33,89,45,44,
+0,176,2,37,73,176,0,83,88,32,176,64,56,17,27,33,89,45,44,1,70,35,70,96,35,
+70,97,35,32,16,32,70,138,97,184,255,128,98,138,177,64,64,138,112,69,96,104,
+58,45,44,32,138,35,73,100,138,35,83,88,60,27,33,89,45,44,75,82,88,125,27,
+122,89,45,44,176,18,0,75,1,75,84,66,45,44,177,2,0,66,177,35,1,136,81,177,
+64,1,136,83,90,88,185,16,0,0,32,136,84,88,178,2,1,2,67,96,66,89,177,36,1,
+136,81,88,185,32,0,0,64,136,84,88,178,2,2,2,67,96,66,177,36,1,136,84,88,178,
+2,32,2,67,96,66,0,75,1,75,82,88,178,2,8,2,67,96,66,89,27,185,64,0,0,128,136,
+84,88,178,2,4,2,67,96,66,89,185,64,0,0,128,99,184,1,0,136,84,88,178,2,8,2,
+67,96,66,89,185,64,0,1,0,99,184,2,0,136,84,88,178,2,16,2,67,96,66,89,185,
+64,0,2,0,99,184,4,0,136,84,88,178,2,64,2,67,96,66,89,89,89,89,89,45,44,69,
+24,104,35,75,81,88,35,32,69,32,100,176,64,80,88,124,89,104,138,96,89,68,45,
+44,176,0,22,176,2,37,176,2,37,1,176,1,35,62,0,176,2,35,62,177,1,2,6,12,176,
+10,35,101,66,176,11,35,66,1,176,1,35,63,0,176,2,35,63,177,1,2,6,12,176,6,
+35,101,66,176,7,35,66,176,1,22,1,45,44,122,138,16,69,35,245,24,45,0,0,0,64,
+16,9,248,3,255,31,143,247,159,247,2,127,243,1,96,242,1,184,255,232,64,43,
+235,12,16,70,223,51,221,85,222,255,220,85,48,221,1,221,1,3,85,220,3,250,31,
+48,194,1,111,192,239,192,2,252,182,24,31,48,183,1,96,183,128,183,2,184,255,
+192,64,56,183,15,19,70,231,177,1,31,175,47,175,63,175,3,79,175,95,175,111,
+175,3,64,175,15,19,70,172,81,24,31,31,156,95,156,2,224,155,1,3,43,154,1,31,
+154,1,144,154,160,154,2,115,154,131,154,2,5,184,255,234,64,25,154,9,11,70,
+175,151,191,151,2,3,43,150,1,31,150,1,159,150,175,150,2,124,150,1,5,184,255,
+234,64,133,150,9,11,70,47,146,63,146,79,146,3,64,146,12,15,70,47,145,1,159,
+145,1,135,134,24,31,64,124,80,124,2,3,16,116,32,116,48,116,3,2,116,1,242,
+116,1,10,111,1,255,111,1,169,111,1,151,111,1,117,111,133,111,2,75,111,1,10,
+110,1,255,110,1,169,110,1,151,110,1,75,110,1,6,26,1,24,85,25,19,255,31,7,
+4,255,31,6,3,255,31,63,103,1,31,103,47,103,63,103,255,103,4,64,102,80,102,
+160,102,176,102,4,63,101,1,15,101,175,101,2,5,160,100,224,100,2,3,184,255,
+192,64,79,100,6,10,70,97,95,43,31,96,95,71,31,95,80,34,31,247,91,1,236,91,
+1,84,91,132,91,2,73,91,1,59,91,1,249,90,1,239,90,1,107,90,1,75,90,1,59,90,
+1,6,19,51,18,85,5,1,3,85,4,51,3,85,31,3,1,15,3,63,3,175,3,3,15,87,31,87,47,
+87,3,3,184,255,192,179,86,18,21,70,184,255,224,179,86,7,11,70,184,255,192,
+179,84,18,21,70,184,255,192,64,109,84,6,11,70,82,80,43,31,63,80,79,80,95,
+80,3,250,72,1,239,72,1,135,72,1,101,72,1,86,72,1,58,72,1,250,71,1,239,71,
+1,135,71,1,59,71,1,6,28,27,255,31,22,51,21,85,17,1,15,85,16,51,15,85,2,1,
+0,85,1,71,0,85,251,250,43,31,250,27,18,31,15,15,1,31,15,207,15,2,15,15,255,
+15,2,6,111,0,127,0,175,0,239,0,4,16,0,1,128,22,1,5,1,184,1,144,177,84,83,
+43,43,75,184,7,255,82,75,176,6,80,91,176,1,136,176,37,83,176,1,136,176,64,
+81,90,176,6,136,176,0,85,90,91,88,177,1,1,142,89,133,141,141,0,66,29,75,176,
+50,83,88,176,96,29,89,75,176,100,83,88,176,64,29,89,75,176,128,83,88,176,
+16,29,177,22,0,66,89,115,115,94,115,116,117,43,43,43,43,43,43,43,43,1,95,
+115,115,115,115,115,115,115,115,115,115,0,115,43,1,43,43,43,43,95,115,0,115,
+116,43,43,43,1,95,115,115,115,115,115,115,115,115,115,115,0,43,43,43,1,43,
+95,115,94,115,116,115,115,116,0,43,43,43,43,1,95,115,115,115,115,116,115,
+115,115,115,115,116,0,115,116,116,1,95,115,43,0,115,116,43,115,1,43,95,115,
+115,116,116,95,115,43,95,115,115,116,116,0,95,115,115,1,43,0,43,115,116,1,
+115,0,43,115,116,43,1,115,0,115,43,43,115,43,43,1,43,115,115,115,0,43,24,
+94,6,20,0,11,0,78,5,182,0,23,0,117,5,182,5,205,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,4,74,0,20,0,143,0,0,255,236,0,0,0,0,255,236,0,0,0,0,255,236,0,0,254,20,
+254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8,0,0,0,0,0,0,172,0,182,0,188,0,0,0,213,0,0,0,0,0,0,0,85,0,131,
+0,151,0,159,0,125,0,229,0,174,0,174,0,113,0,113,0,0,0,0,0,186,0,197,0,186,
+0,0,0,0,0,164,0,159,0,140,0,0,0,0,0,199,0,199,0,125,0,125,0,0,0,0,0,0,0,0,
+0,0,0,0,0,176,0,185,0,138,0,0,0,0,0,155,0,166,0,143,0,119,0,0,0,0,0,0,0,0,
+0,0,0,150,0,0,0,0,0,0,0,0,0,0,0,105,0,110,0,144,0,180,0,193,0,213,0,0,0,0,
+0,0,0,0,0,102,0,111,0,120,0,150,0,192,0,213,1,71,0,0,0,0,0,0,0,254,1,58,0,
+197,0,120,0,254,1,22,1,246,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+238,0,0,0,150,0,136,0,174,0,150,0,137,1,12,0,150,1,24,0,0,3,29,0,148,2,90,
+0,130,3,150,0,0,0,168,0,140,0,0,0,0,2,121,0,217,0,180,1,10,0,0,1,131,0,109,
+0,127,0,160,0,0,0,0,0,109,0,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,0,160,
+0,0,0,130,0,137,0,0,0,0,0,0,0,0,0,0,5,182,252,148,0,17,255,239,0,131,0,143,
+0,0,0,0,0,109,0,123,0,0,0,0,0,0,0,0,0,0,0,188,1,170,3,84,0,0,0,0,0,188,0,
+182,1,215,1,149,0,0,0,150,1,0,0,174,5,182,254,188,254,111,254,131,0,111,2,
+173,0,0,0,42,0,42,0,42,0,42,0,111,0,161,1,41,1,226,2,113,3,41,3,77,3,124,
+3,172,3,226,4,15,4,68,4,91,4,149,4,180,5,6,5,63,5,148,6,18,6,101,6,204,7,
+63,7,103,8,17,8,130,8,218,9,61,9,121,9,187,9,247,10,106,11,52,11,160,12,23,
+12,116,12,179,12,236,13,57,13,151,13,205,14,16,14,73,14,151,14,183,15,43,
+15,124,15,213,16,34,16,134,16,247,17,97,17,162,17,224,18,51,18,233,19,72,
+19,153,19,204,19,242,20,18,20,54,20,84,20,107,20,144,21,3,21,100,21,169,22,
+9,22,102,22,201,23,157,23,222,24,15,24,90,24,170,24,195,25,52,25,114,25,187,
+26,29,26,126,26,196,27,52,27,137,27,202,28,34,28,207,29,96,29,201,30,22,30,
+112,30,148,30,240,31,67,31,67,31,139,31,239,32,101,32,252,33,111,33,159,34,
+88,34,156,35,69,35,175,36,3,36,48,36,56,37,7,37,30,37,121,37,181,38,5,38,
+122,38,159,38,233,39,38,39,96,39,166,39,221,40,37,40,117,40,158,40,195,40,
+242,41,104,41,128,41,151,41,175,41,198,41,223,42,4,42,109,42,128,42,152,42,
+175,42,199,42,224,42,248,43,15,43,38,43,63,43,163,43,186,43,210,43,233,44,
+0,44,24,44,49,44,150,45,23,45,47,45,70,45,94,45,119,45,142,45,216,46,115,
+46,138,46,160,46,182,46,204,46,228,46,252,47,172,47,191,47,214,47,236,48,
+2,48,26,48,50,48,73,48,96,48,121,49,9,49,31,49,54,49,76,49,99,49,122,49,147,
+50,4,50,125,50,148,50,170,50,192,50,217,50,239,51,84,51,108,51,132,51,154,
+51,177,51,199,51,222,51,251,52,18,52,42,52,65,52,89,52,112,52,137,52,160,
+52,184,52,208,52,227,52,235,53,100,53,123,53,145,53,168,53,190,53,213,53,
+236,54,0,54,33,54,56,54,78,54,101,54,123,54,146,54,169,54,192,54,216,54,235,
+55,1,55,25,55,54,55,135,55,226,55,249,56,16,56,39,56,62,56,85,56,108,56,127,
+56,147,56,170,56,195,56,236,57,16,57,39,57,62,57,81,57,100,57,173,57,197,
+57,226,57,245,58,9,58,33,58,57,58,76,58,111,58,188,59,9,59,32,59,54,59,74,
+59,93,59,116,59,139,59,173,60,14,60,103,60,126,60,148,60,171,60,194,60,219,
+60,243,61,100,61,242,62,10,62,32,62,51,62,71,62,95,62,119,62,142,62,164,62,
+187,62,209,62,229,62,248,63,15,63,37,63,56,63,76,63,99,63,117,63,204,64,54,
+64,78,64,100,64,124,64,146,64,169,64,191,64,216,64,240,65,9,65,33,65,52,65,
+71,65,94,65,117,65,140,65,162,65,187,65,210,65,232,65,255,66,22,66,45,66,
+67,66,118,66,218,67,188,68,145,68,169,68,192,68,215,68,237,69,0,69,19,69,
+73,69,127,69,151,69,210,69,249,70,73,70,118,70,189,71,0,71,45,71,158,71,183,
+71,241,72,22,72,60,72,125,72,174,72,226,73,10,73,35,73,43,73,51,73,101,73,
+177,73,185,73,193,73,201,74,56,74,64,74,72,74,148,74,156,74,164,74,241,74,
+249,75,36,75,44,75,116,75,124,75,132,76,19,76,27,76,137,77,11,77,36,77,61,
+77,83,77,105,77,127,77,151,77,172,78,30,78,160,78,255,79,135,80,3,80,105,
+80,169,81,27,81,89,81,97,81,221,82,43,82,109,83,13,83,21,83,105,83,195,84,
+50,84,139,84,213,85,23,85,149,86,41,86,138,87,20,87,45,87,70,87,92,87,114,
+87,144,87,169,88,35,88,58,88,165,88,173,88,181,88,206,88,214,89,109,89,204,
+90,42,90,65,90,88,90,161,90,169,90,252,91,4,91,12,91,127,91,135,92,20,92,
+151,92,246,93,14,93,86,93,186,93,194,93,202,93,210,93,218,93,226,93,234,93,
+242,94,98,94,106,94,114,94,167,94,238,95,54,95,140,95,226,96,56,96,134,96,
+233,97,96,97,221,97,229,98,96,98,210,98,250,99,96,99,104,99,221,100,91,100,
+159,100,182,100,240,101,59,101,160,101,230,101,238,102,23,102,31,102,39,102,
+102,102,110,102,235,102,243,103,45,103,109,103,184,104,17,104,110,104,208,
+105,26,105,131,105,247,106,78,106,102,106,213,106,235,107,71,107,79,107,87,
+107,112,107,120,107,240,108,79,108,169,108,191,108,213,109,26,109,79,109,
+122,109,146,109,169,109,192,109,215,109,241,110,11,110,35,110,59,110,86,110,
+113,110,140,110,181,110,224,111,12,111,63,111,109,111,201,112,37,112,143,
+112,234,113,112,113,179,114,88,115,37,115,45,115,53,115,104,115,157,115,175,
+115,205,116,16,116,107,116,242,117,124,118,16,118,190,119,60,119,242,120,
+121,120,129,120,228,121,13,121,60,121,107,121,150,122,16,122,93,122,140,122,
+214,122,252,123,40,123,196,124,21,124,158,125,22,125,91,125,159,125,235,126,
+10,126,40,126,107,126,158,126,196,126,233,127,14,127,81,127,154,127,247,128,
+86,128,133,129,34,129,140,129,140,129,140,129,140,129,140,129,140,129,140,
+129,140,129,140,129,140,129,140,129,140,129,140,129,140,130,214,131,73,131,
+85,131,93,132,6,132,131,133,31,133,54,133,77,133,97,133,117,133,162,133,239,
+134,66,134,111,134,155,135,16,135,119,135,214,136,57,136,94,136,131,136,202,
+137,9,137,41,137,65,137,89,137,112,137,135,138,36,138,223,139,96,139,213,
+140,70,140,183,141,59,141,206,142,102,143,18,143,179,144,87,145,5,145,181,
+146,159,147,142,147,150,147,158,148,11,148,107,148,203,149,51,149,77,149,
+103,150,39,150,61,150,195,151,65,152,69,153,46,153,244,154,225,155,67,155,
+146,156,81,156,150,156,217,157,8,157,57,158,24,158,182,159,92,159,228,160,
+63,160,163,161,31,161,173,162,12,162,92,162,202,163,46,163,204,164,129,164,
+151,164,173,165,33,165,140,165,250,166,109,166,211,167,63,167,137,167,219,
+168,41,168,130,168,203,169,25,169,132,169,247,170,168,171,82,171,102,171,
+122,171,201,172,24,172,32,172,131,172,244,173,99,174,10,174,202,175,49,175,
+143,175,238,176,74,176,177,177,20,177,98,177,168,178,42,178,186,179,71,179,
+225,179,233,180,0,180,23,180,133,180,244,181,103,181,191,182,17,182,114,182,
+185,183,18,183,108,183,184,184,60,184,188,184,196,184,219,184,241,185,10,
+185,34,185,42,185,50,185,73,185,95,185,197,186,35,186,61,186,86,186,111,186,
+137,186,163,186,189,187,39,187,143,187,167,187,190,187,216,187,241,188,10,
+188,35,188,43,188,51,188,76,188,100,188,126,188,152,188,176,188,198,188,224,
+188,248,189,17,189,41,189,66,189,90,189,161,189,220,189,245,190,14,190,32,
+190,50,190,75,190,97,190,226,191,149,191,223,191,231,192,97,192,237,193,134,
+194,24,194,157,195,35,195,182,196,35,196,127,196,230,197,74,197,198,198,33,
+198,130,199,0,199,132,199,152,199,172,199,195,199,218,199,241,200,8,200,34,
+200,59,200,85,200,110,200,136,200,161,200,187,200,212,200,248,201,25,201,
+50,201,75,201,100,201,125,201,150,201,175,201,200,201,225,202,3,202,36,202,
+59,202,82,202,105,202,128,202,152,202,174,202,200,202,225,202,251,203,20,
+203,46,203,71,203,97,203,122,203,158,203,191,203,214,203,237,204,5,204,29,
+204,52,204,76,204,99,204,122,204,147,204,173,204,198,204,224,204,249,205,
+19,205,44,205,70,205,104,205,140,205,163,205,186,205,210,205,233,206,1,206,
+25,206,49,206,72,206,96,206,120,206,143,206,167,206,190,206,213,206,237,207,
+2,207,26,207,47,207,69,207,91,207,115,207,136,207,160,207,184,207,208,207,
+230,207,253,208,20,208,43,208,65,208,85,208,152,208,241,209,70,209,181,210,
+42,210,117,210,195,211,36,211,141,211,186,211,226,212,10,212,127,212,146,
+212,166,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,43,64,11,5,2,2,9,4,112,3,128,3,
+2,3,184,255,192,64,9,6,9,72,3,4,3,7,0,3,0,63,50,47,51,1,47,43,93,51,17,51,
+47,51,49,48,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,
+182,250,74,104,4,230,0,2,0,147,255,227,1,145,5,182,0,3,0,23,0,58,185,0,1,
+255,240,64,19,10,20,72,16,25,128,25,144,25,160,25,4,3,14,154,4,2,2,4,184,
+255,192,64,10,7,10,72,4,1,9,155,19,2,3,0,63,47,245,206,1,47,43,51,47,16,225,
+50,93,49,48,43,1,35,3,51,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,80,
+121,51,223,240,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,1,158,4,24,
+250,185,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,0,2,0,133,3,166,2,
+178,5,182,0,3,0,7,0,55,64,35,4,152,7,7,9,208,9,224,9,2,47,9,111,9,127,9,3,
+0,152,0,3,16,3,224,3,240,3,4,3,6,2,2,7,3,3,0,63,51,51,47,51,1,47,93,225,93,
+93,18,57,47,225,49,48,1,3,35,3,33,3,35,3,1,74,41,115,41,2,45,41,114,41,5,
+182,253,240,2,16,253,240,2,16,0,0,2,0,51,0,0,4,248,5,182,0,27,0,31,0,153,
+64,88,3,3,26,26,24,22,30,29,7,4,6,23,23,6,25,0,1,4,4,5,177,24,24,33,21,31,
+28,8,4,9,20,20,18,15,14,11,4,19,177,10,80,16,1,16,16,12,12,9,80,10,1,10,28,
+1,72,13,1,13,174,12,8,4,12,31,0,16,174,17,25,21,17,63,17,79,17,223,17,3,12,
+17,12,17,5,23,19,6,10,5,0,47,51,63,51,18,57,57,47,47,93,17,51,51,16,225,50,
+50,17,51,51,16,225,93,50,50,1,47,93,51,51,47,51,47,93,16,228,23,57,50,17,
+18,23,57,17,51,47,228,23,57,50,51,17,18,23,57,17,51,47,51,47,49,48,1,3,33,
+21,33,3,35,19,33,3,35,19,33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,1,
+33,19,33,3,215,63,1,24,254,205,82,147,84,254,221,82,144,78,254,254,1,29,65,
+254,238,1,43,82,147,82,1,37,84,144,84,1,6,252,235,1,35,64,254,221,3,125,254,
+184,137,254,84,1,172,254,84,1,172,137,1,72,137,1,176,254,80,1,176,254,80,
+137,254,184,1,72,0,3,0,123,255,137,3,217,6,18,0,45,0,54,0,63,0,180,64,51,
+52,47,41,1,41,47,33,1,33,6,112,47,60,1,60,47,30,1,30,19,32,7,1,7,7,13,46,
+110,36,15,0,31,0,2,255,0,1,0,0,1,7,0,65,13,13,55,110,224,25,1,25,184,255,
+192,64,48,8,11,72,25,51,20,20,41,60,60,19,46,55,8,61,40,115,33,37,33,31,64,
+14,17,72,31,31,30,80,33,1,15,33,31,33,2,8,33,52,19,115,8,14,8,6,6,5,8,184,
+255,192,179,10,13,72,8,0,47,43,51,51,47,17,51,16,225,50,47,94,93,93,51,51,
+47,43,17,51,16,225,50,18,57,57,18,57,17,51,51,17,51,1,47,43,93,225,51,47,
+16,214,94,93,93,113,50,225,17,57,47,93,51,51,93,51,93,225,50,93,50,93,50,
+49,48,1,20,14,2,7,21,35,53,34,46,2,39,53,30,3,51,17,46,3,53,52,62,2,55,53,
+51,21,22,22,23,7,38,38,39,17,30,3,7,52,46,2,39,17,54,54,1,20,30,2,23,17,6,
+6,3,217,50,93,133,84,138,50,102,96,84,32,33,87,96,101,47,89,131,86,42,49,
+91,129,79,138,100,169,67,66,56,140,74,88,135,91,46,176,20,43,70,51,93,91,
+254,18,17,40,66,49,89,83,1,190,70,114,84,55,12,230,221,9,18,26,17,172,16,
+33,26,17,1,178,30,66,85,110,74,67,111,83,53,9,180,176,5,42,31,145,25,41,6,
+254,90,31,66,83,107,72,33,55,45,38,18,254,139,14,98,2,163,36,57,47,38,17,
+1,113,16,89,0,0,5,0,102,255,236,6,51,5,203,0,9,0,29,0,39,0,59,0,63,0,93,178,
+60,16,62,184,255,240,64,51,60,62,60,62,40,20,30,180,50,181,35,180,40,65,15,
+65,1,5,180,10,181,0,180,16,20,32,20,48,20,3,20,63,6,62,24,37,182,55,183,33,
+182,45,25,3,182,15,183,7,182,25,7,0,63,225,244,225,63,225,244,225,63,63,1,
+47,93,225,244,225,93,16,222,225,244,225,17,18,57,57,47,47,56,56,49,48,19,
+20,22,51,50,17,16,35,34,6,5,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,20,
+22,51,50,17,16,35,34,6,5,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,1,35,
+1,250,71,80,156,156,80,71,1,199,36,74,115,79,73,112,76,38,35,73,113,78,75,
+113,77,39,1,172,71,80,156,156,80,71,1,198,35,74,115,79,74,112,75,38,35,73,
+113,78,75,113,76,39,255,0,252,213,158,3,44,4,2,165,165,1,74,1,72,163,165,
+108,172,118,63,63,118,172,108,108,170,117,62,62,117,170,253,74,165,164,1,
+73,1,72,163,165,108,171,118,63,63,118,171,108,108,170,117,62,62,117,170,3,
+146,250,74,5,182,0,0,3,0,109,255,236,5,125,5,205,0,17,0,33,0,83,0,128,64,
+77,39,24,23,74,4,73,44,73,72,10,71,54,65,71,66,32,66,1,54,66,54,66,29,5,59,
+60,71,4,72,0,71,0,44,16,44,2,8,44,44,34,32,72,1,72,85,29,72,16,34,32,34,2,
+34,65,65,49,18,81,79,22,39,24,23,74,4,15,71,60,59,5,4,49,73,21,15,80,49,0,
+47,225,63,18,23,57,18,23,57,63,225,17,57,47,1,47,93,225,16,198,93,17,57,47,
+94,93,225,17,23,57,18,57,57,47,47,93,16,225,16,225,17,51,17,18,23,57,49,48,
+1,20,30,2,23,62,3,53,52,46,2,35,34,6,19,50,62,2,55,1,14,3,21,20,30,2,37,52,
+62,2,55,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,1,62,3,55,51,14,3,7,1,35,
+39,14,3,35,34,46,2,1,166,16,33,52,36,59,86,56,28,25,47,66,42,86,100,135,58,
+98,84,72,32,254,125,52,80,55,28,35,66,96,254,125,40,77,111,71,31,60,45,28,
+50,94,138,88,83,131,91,48,50,84,109,60,1,96,27,43,34,27,10,184,15,41,53,65,
+39,1,21,225,168,49,96,108,124,78,105,167,115,61,4,141,34,65,65,67,37,35,62,
+64,70,41,36,61,44,25,89,251,175,23,40,54,31,1,151,33,63,72,85,56,54,91,65,
+36,240,78,122,100,86,42,36,77,87,99,57,75,119,83,43,43,83,119,75,64,109,93,
+79,36,254,140,29,60,68,78,47,66,111,98,85,41,254,219,172,45,71,49,27,53,103,
+149,0,1,0,133,3,166,1,74,5,182,0,3,0,42,64,28,192,5,208,5,224,5,3,47,5,111,
+5,2,0,152,0,3,16,3,224,3,240,3,4,3,2,2,3,3,0,63,51,47,1,47,93,225,93,93,49,
+48,1,3,35,3,1,74,41,115,41,5,182,253,240,2,16,0,0,1,0,82,254,188,2,43,5,182,
+0,19,0,26,64,13,6,14,242,9,240,63,0,1,0,14,249,5,248,0,63,63,1,47,93,225,
+228,50,49,48,19,52,62,2,55,51,6,2,21,20,30,2,23,35,46,3,82,36,74,113,78,172,
+140,145,37,71,106,69,170,78,113,74,36,2,49,125,243,229,211,93,193,254,50,
+244,119,236,226,212,94,90,206,225,240,0,0,1,0,61,254,188,2,23,5,182,0,19,
+0,28,64,14,6,14,242,11,240,176,0,1,0,21,14,248,5,249,0,63,63,1,16,222,93,
+225,228,50,49,48,1,20,14,2,7,35,62,3,53,52,2,39,51,30,3,2,23,36,75,113,78,
+170,69,106,72,36,144,141,172,78,113,75,36,2,49,124,240,225,206,90,94,212,
+226,236,119,244,1,206,193,93,211,229,243,0,0,1,0,82,2,119,4,20,6,20,0,14,
+0,36,64,21,31,16,1,0,152,0,14,128,14,144,14,3,8,14,31,6,1,6,6,0,0,0,63,50,
+47,93,1,47,94,93,229,93,49,48,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,2,152,
+43,1,141,26,254,134,245,178,176,158,184,242,254,137,29,1,135,43,6,20,254,
+119,111,193,28,254,186,96,1,102,254,154,96,1,70,28,193,111,1,137,0,0,1,0,
+102,1,6,4,2,4,162,0,11,0,41,64,24,16,13,1,6,9,170,3,239,0,1,32,0,96,0,160,
+0,3,0,9,0,173,6,3,179,0,63,51,225,50,1,47,93,93,50,225,50,93,49,48,1,33,53,
+33,17,51,17,33,21,33,17,35,1,233,254,125,1,131,150,1,131,254,125,150,2,135,
+150,1,133,254,123,150,254,127,0,0,1,0,63,254,248,1,121,0,238,0,12,0,56,64,
+20,207,14,1,16,14,144,14,160,14,3,27,12,43,12,2,12,1,151,6,7,184,255,192,
+64,13,16,20,72,95,7,1,16,7,1,7,6,156,12,0,47,237,1,47,93,93,43,51,237,50,
+93,93,93,49,48,37,23,14,3,7,35,62,3,55,1,106,15,14,39,47,51,25,138,15,29,
+27,22,8,238,23,54,122,124,123,56,61,132,131,125,53,0,0,1,0,82,1,209,2,66,
+2,121,0,3,0,21,64,9,2,5,64,0,1,0,0,185,1,0,47,225,1,47,93,16,206,49,48,19,
+53,33,21,82,1,240,1,209,168,168,0,1,0,147,255,227,1,145,0,250,0,19,0,53,64,
+27,128,21,144,21,160,21,3,17,21,1,10,150,192,0,208,0,2,52,0,68,0,100,0,116,
+0,4,0,184,255,192,182,7,10,72,0,5,155,15,0,47,237,1,47,43,93,93,237,93,93,
+49,48,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,
+20,20,34,47,26,27,46,34,20,111,38,53,33,15,15,33,53,38,37,53,34,16,16,34,
+53,0,1,0,20,0,0,2,231,5,182,0,3,0,30,177,1,2,184,255,240,64,9,2,3,0,16,0,
+5,1,0,3,0,63,47,17,1,51,56,50,47,56,51,49,48,1,1,35,1,2,231,253,224,179,2,
+33,5,182,250,74,5,182,0,0,2,0,98,255,236,4,8,5,205,0,19,0,39,0,38,64,21,30,
+111,0,41,16,41,1,20,111,32,10,1,10,35,115,15,7,25,115,5,25,0,63,225,63,225,
+1,47,93,225,93,16,222,225,49,48,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,
+50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,4,8,51,113,178,127,
+118,175,115,57,51,111,177,126,119,176,116,58,253,19,30,66,107,77,77,108,69,
+31,31,69,108,77,77,107,66,30,2,221,177,254,232,194,102,102,194,1,24,177,177,
+1,24,193,102,101,193,254,232,178,150,224,149,75,74,148,225,151,150,224,148,
+74,74,148,224,0,0,1,0,178,0,0,2,199,5,182,0,16,0,53,64,33,64,18,1,15,1,14,
+14,0,110,191,1,255,1,2,126,1,1,0,1,16,1,32,1,64,1,4,6,1,13,15,6,0,24,0,63,
+63,205,1,47,94,93,93,93,225,51,47,17,51,93,49,48,33,35,17,52,62,2,55,14,3,
+7,7,39,1,51,2,199,176,1,3,3,1,17,26,27,30,21,148,96,1,127,150,3,145,43,98,
+97,89,34,18,26,24,27,18,121,123,1,43,0,1,0,96,0,0,3,240,5,203,0,35,0,60,64,
+32,35,8,111,27,27,37,16,37,1,34,111,1,33,1,17,17,32,1,1,1,8,34,16,13,115,
+22,7,2,34,116,1,24,0,63,225,50,63,225,51,18,57,1,47,93,51,47,17,51,16,237,
+93,17,51,47,225,51,49,48,33,33,53,1,62,3,53,52,46,2,35,34,6,7,39,62,3,51,
+50,30,2,21,20,14,2,7,1,21,33,3,240,252,112,1,94,75,118,83,44,34,63,86,53,
+95,153,69,102,40,92,106,118,65,96,155,108,59,53,93,129,75,254,231,2,177,156,
+1,125,81,134,128,129,76,59,90,63,32,77,60,119,36,63,46,27,54,101,145,91,85,
+154,149,150,81,254,213,8,0,0,1,0,82,255,236,3,238,5,203,0,57,0,93,64,11,33,
+48,33,48,18,26,111,9,39,111,0,184,255,192,64,40,20,23,72,0,0,9,59,32,59,1,
+79,18,1,18,6,32,115,171,33,1,121,33,1,11,33,1,8,33,33,21,47,44,115,53,7,21,
+115,18,14,25,0,63,51,225,63,225,51,18,57,47,94,93,93,93,225,57,1,47,93,93,
+16,206,50,47,43,225,16,225,17,57,57,47,47,49,48,1,20,14,2,7,21,22,22,21,20,
+14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,46,2,35,35,53,51,50,62,2,53,52,
+46,2,35,34,6,7,39,62,3,51,50,30,2,3,193,46,83,116,71,177,184,65,132,202,138,
+109,193,85,87,203,93,92,134,87,41,53,98,141,89,133,133,81,126,85,44,36,66,
+92,56,107,163,74,92,38,93,110,125,70,108,163,110,56,4,96,73,120,88,57,12,
+6,22,181,145,96,160,116,64,34,45,170,46,50,40,74,108,67,68,97,63,30,151,40,
+74,102,61,52,82,57,30,67,54,125,31,54,41,24,54,97,133,0,2,0,23,0,0,4,63,5,
+190,0,10,0,24,0,78,64,44,9,86,0,1,0,0,2,110,17,12,11,7,32,3,1,3,3,26,16,26,
+1,119,24,135,24,2,24,95,5,1,5,9,6,24,116,1,5,5,2,17,7,6,2,24,0,63,63,51,18,
+57,47,51,225,50,50,1,47,93,51,93,93,18,57,47,93,51,51,51,51,225,50,47,93,
+50,49,48,1,35,17,35,17,33,53,1,51,17,51,33,17,52,62,2,55,35,14,3,7,1,4,63,
+213,176,253,93,2,151,188,213,254,123,3,4,5,1,9,7,21,25,26,11,254,101,1,72,
+254,184,1,72,159,3,215,252,48,1,100,56,123,117,102,34,20,49,49,46,16,253,
+160,0,0,1,0,131,255,236,3,246,5,182,0,42,0,78,64,24,38,26,111,5,44,16,44,
+1,39,36,36,40,104,35,1,89,35,1,35,35,240,15,1,15,184,255,192,64,18,8,11,72,
+15,29,115,0,0,21,39,116,36,6,21,115,16,10,25,0,63,51,225,63,225,18,57,47,
+225,1,47,43,93,51,47,93,93,51,51,17,51,93,16,222,225,51,49,48,1,50,30,2,21,
+20,14,2,35,34,46,2,39,53,30,3,51,50,62,2,53,52,38,35,34,14,2,7,39,19,33,21,
+33,3,54,54,2,33,99,171,127,72,68,134,197,128,51,99,91,82,33,33,89,98,99,42,
+79,124,86,46,176,168,27,63,63,57,21,90,55,2,178,253,236,39,32,105,3,129,55,
+108,160,105,114,182,126,67,10,19,30,20,172,23,36,24,13,37,78,118,81,143,151,
+5,8,9,4,57,2,176,166,254,93,6,14,0,0,2,0,113,255,236,4,10,5,203,0,43,0,63,
+0,55,64,32,49,110,12,34,65,16,65,1,23,59,111,0,0,16,0,32,0,3,0,54,117,29,
+29,7,44,115,39,25,16,115,7,7,0,63,225,63,225,17,57,47,225,1,47,93,225,50,
+93,16,222,50,225,49,48,19,52,62,4,51,50,30,2,23,21,38,38,35,34,14,4,7,51,
+62,3,51,50,30,2,21,20,14,2,35,34,46,2,1,50,62,2,53,52,46,2,35,34,14,2,21,
+20,30,2,113,21,53,92,142,198,133,19,46,47,43,17,35,88,43,90,137,100,67,42,
+20,3,12,20,57,76,95,59,95,154,108,59,62,116,164,102,100,175,128,74,1,219,
+60,99,72,39,33,66,99,66,67,111,78,43,37,73,110,2,113,105,208,191,164,121,
+69,2,5,7,5,155,12,12,43,78,108,131,148,80,36,63,45,26,59,114,165,106,114,
+182,127,68,78,160,242,254,185,41,83,127,87,70,111,78,42,47,75,96,48,67,133,
+106,67,0,1,0,90,0,0,4,6,5,182,0,6,0,43,177,6,0,184,255,240,64,17,0,0,2,1,
+5,8,16,8,1,2,5,2,116,3,6,0,24,0,63,63,225,50,1,47,93,16,206,50,17,57,47,56,
+51,49,48,33,1,33,53,33,21,1,1,25,2,51,253,14,3,172,253,213,5,16,166,145,250,
+219,0,3,0,106,255,236,4,0,5,205,0,39,0,58,0,74,0,128,64,83,30,35,50,110,15,
+10,40,72,110,195,5,211,5,2,181,5,1,5,5,15,76,16,76,1,40,110,25,62,110,213,
+35,1,204,35,1,186,35,1,35,35,16,25,32,25,2,25,10,30,104,56,152,56,2,89,56,
+1,40,56,56,56,72,56,3,56,147,67,1,38,67,86,67,2,67,67,0,45,115,20,25,59,115,
+0,7,0,63,225,63,225,17,57,47,93,93,193,93,93,93,57,57,1,47,93,51,47,93,93,
+93,225,16,225,93,16,206,50,47,93,93,225,18,57,16,225,17,57,49,48,1,50,30,
+2,21,20,14,2,7,30,3,21,20,14,2,35,34,46,2,53,52,62,2,55,46,3,53,52,62,2,3,
+20,30,2,51,50,62,2,53,52,46,2,39,39,6,6,1,34,6,21,20,30,2,23,62,3,53,52,38,
+2,53,84,149,113,66,40,70,96,56,58,111,87,53,67,121,169,102,110,171,117,61,
+45,76,104,58,49,86,63,37,67,114,149,199,32,68,104,72,70,107,72,36,39,73,102,
+63,30,126,128,1,22,106,125,35,62,87,51,48,85,63,36,126,5,205,44,88,132,88,
+67,108,87,69,28,31,76,95,118,73,92,149,104,56,54,101,146,92,75,120,96,74,
+28,31,73,90,109,66,87,131,88,44,251,166,53,89,63,35,35,65,92,56,52,84,72,
+64,31,14,60,155,3,84,106,101,57,82,64,51,24,22,52,66,84,54,101,106,0,0,2,
+0,106,255,236,4,4,5,203,0,41,0,61,0,53,64,30,57,21,111,0,63,16,63,1,47,110,
+12,16,32,32,32,2,32,52,117,27,27,7,42,115,37,7,16,117,7,26,0,63,225,63,225,
+17,57,47,225,1,47,93,51,225,93,16,222,225,50,49,48,1,20,14,4,35,34,46,2,39,
+53,22,22,51,50,62,2,55,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,1,34,14,2,
+21,20,30,2,51,50,62,2,53,52,46,2,4,4,21,53,92,142,198,133,19,46,46,44,17,
+35,88,43,135,174,102,43,5,13,20,56,76,96,59,95,154,108,59,63,115,165,102,
+101,174,128,74,254,37,60,99,72,39,33,66,99,66,68,110,78,43,37,73,110,3,70,
+105,209,190,165,120,69,2,5,6,5,156,13,12,94,161,214,119,36,62,46,26,59,114,
+165,106,114,183,127,68,78,160,243,1,71,40,84,127,87,70,111,78,42,47,75,96,
+48,67,133,107,66,0,0,2,0,147,255,227,1,145,4,102,0,19,0,39,0,62,64,28,16,
+41,128,41,144,41,160,41,4,30,10,150,20,192,0,208,0,2,52,0,68,0,100,0,116,
+0,4,0,184,255,192,64,11,7,10,72,0,35,155,25,16,5,155,15,0,47,237,63,237,1,
+47,43,93,93,51,229,50,93,49,48,55,52,62,2,51,50,30,2,21,20,14,2,35,34,46,
+2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,20,
+20,34,47,26,27,46,34,20,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,111,
+38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,3,145,39,53,33,14,14,33,53,39,
+37,52,34,16,16,34,52,0,2,0,63,254,248,1,145,4,102,0,12,0,32,0,97,64,47,16,
+34,128,34,144,34,160,34,4,23,150,192,13,208,13,2,100,13,116,13,2,80,13,1,
+68,13,1,59,13,1,31,13,47,13,2,13,13,27,12,43,12,2,12,1,151,6,7,184,255,192,
+64,17,16,20,72,95,7,1,16,7,1,7,28,155,18,16,6,156,12,0,47,237,63,237,1,47,
+93,93,43,51,237,50,93,51,47,93,93,93,93,93,93,229,93,49,48,37,23,14,3,7,35,
+62,3,55,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,106,15,14,39,47,51,25,
+138,15,29,27,22,8,17,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,238,
+23,54,122,124,123,56,61,132,131,125,53,2,237,39,53,33,14,14,33,53,39,37,52,
+34,16,16,34,52,0,1,0,102,0,238,4,2,4,221,0,6,0,78,64,48,0,8,64,8,1,64,1,1,
+1,2,1,5,5,3,6,111,0,127,0,2,48,0,1,0,0,4,32,3,1,80,3,112,3,128,3,208,3,240,
+3,5,63,3,1,0,3,1,6,3,0,47,94,93,93,93,113,51,51,47,93,93,50,18,57,61,47,51,
+51,1,24,47,93,93,16,206,49,48,37,1,53,1,21,1,1,4,2,252,100,3,156,253,33,2,
+223,238,1,168,102,1,225,160,254,148,254,190,0,2,0,102,1,186,4,2,3,233,0,3,
+0,7,0,92,64,61,7,2,9,64,9,1,4,198,0,1,187,0,1,169,0,1,134,0,1,123,0,1,104,
+0,1,66,0,1,57,0,1,0,4,173,31,5,47,5,2,127,5,1,0,5,16,5,2,6,5,5,0,173,240,
+1,1,15,1,111,1,2,1,0,47,93,93,225,51,47,94,93,93,113,225,1,47,93,93,93,93,
+93,93,93,93,51,93,16,206,50,49,48,19,53,33,21,1,53,33,21,102,3,156,252,100,
+3,156,3,84,149,149,254,102,150,150,0,0,1,0,102,0,238,4,2,4,221,0,6,0,78,64,
+48,5,8,64,8,1,64,6,1,6,5,4,1,1,3,0,111,6,127,6,2,48,6,1,6,6,2,32,3,1,80,3,
+112,3,128,3,208,3,240,3,5,63,3,1,0,3,1,6,3,0,47,94,93,93,93,113,51,51,47,
+93,93,51,18,57,61,47,51,51,1,24,47,93,93,16,206,49,48,19,1,1,53,1,21,1,102,
+2,224,253,32,3,156,252,100,1,143,1,66,1,108,160,254,31,102,254,88,0,2,0,37,
+255,227,3,37,5,203,0,39,0,59,0,62,64,33,50,154,40,40,39,70,0,0,20,11,70,28,
+61,47,61,1,20,11,23,15,0,1,6,0,0,45,155,55,19,16,81,23,4,0,63,225,51,47,229,
+50,47,94,93,18,57,1,47,93,16,222,225,17,57,47,225,51,47,225,49,48,1,53,52,
+62,2,55,62,3,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,20,14,2,7,14,3,21,
+21,3,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,1,25,15,39,66,50,48,68,43,21,
+30,57,85,56,83,150,70,63,81,188,97,93,149,104,56,27,54,80,54,52,66,38,14,
+187,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,1,158,37,57,92,80,77,
+42,41,67,69,79,53,48,79,57,31,52,34,145,42,59,51,96,139,87,67,105,90,84,47,
+45,67,63,66,44,18,254,209,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,0,
+2,0,109,255,74,6,129,5,182,0,87,0,104,0,111,64,63,88,23,96,39,31,23,1,127,
+39,1,23,39,70,70,39,23,3,78,49,32,0,1,0,106,64,106,1,59,64,78,1,78,44,12,
+91,18,7,18,100,28,15,18,31,18,191,18,3,6,0,28,1,7,18,28,18,28,64,54,83,3,
+64,69,73,0,47,51,193,63,193,18,57,57,47,47,94,93,94,93,16,193,17,51,16,193,
+50,50,1,47,93,193,93,16,222,113,193,17,23,57,47,47,47,93,93,16,193,16,193,
+49,48,1,20,14,4,35,34,46,2,39,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,
+3,6,6,20,20,21,20,30,2,51,50,62,2,53,52,46,2,35,34,4,6,2,21,20,30,2,51,50,
+62,2,55,21,6,6,35,34,36,38,2,53,52,18,54,36,51,50,4,22,18,1,20,22,51,50,62,
+2,55,55,38,38,35,34,14,2,6,129,19,37,57,76,97,58,45,73,52,33,6,4,18,54,71,
+89,53,77,119,82,43,59,111,158,98,45,90,82,69,23,23,1,1,21,34,43,23,46,70,
+47,24,86,152,209,123,169,254,254,175,90,79,153,227,147,61,119,111,100,43,
+86,216,130,179,254,231,195,102,118,219,1,55,193,156,1,6,191,106,252,21,101,
+85,55,78,50,26,4,14,28,77,42,74,101,63,28,2,219,62,125,113,97,72,41,30,50,
+65,35,37,66,49,28,56,101,142,86,101,168,122,68,8,14,17,8,254,96,22,27,16,
+8,3,53,68,40,15,61,104,140,78,142,221,152,79,111,199,254,239,162,151,234,
+160,82,14,24,31,17,141,38,44,102,195,1,25,179,188,1,69,238,136,101,189,254,
+241,254,213,133,119,45,83,115,69,253,8,13,58,94,120,0,0,2,0,0,0,0,4,221,5,
+188,0,7,0,20,0,132,64,36,6,5,70,2,1,70,20,1,2,20,3,73,8,1,73,1,1,8,1,0,14,
+14,3,0,0,16,7,1,128,7,144,7,208,7,3,7,184,255,192,64,24,6,10,72,7,16,7,7,
+22,15,22,31,22,47,22,143,22,159,22,223,22,6,7,3,4,184,255,240,64,17,4,2,95,
+14,32,10,14,72,14,5,20,20,5,3,4,0,18,0,63,50,63,57,47,18,57,43,225,1,47,56,
+51,94,93,17,51,47,56,43,93,113,51,17,18,57,61,47,18,57,57,93,93,18,57,57,
+93,93,51,51,49,48,33,3,33,3,35,1,51,1,1,3,46,3,39,14,3,7,3,4,31,160,253,223,
+162,188,2,25,170,2,26,254,103,148,6,17,18,18,8,7,18,18,17,6,145,1,197,254,
+59,5,188,250,68,2,106,1,168,18,52,60,65,31,31,66,61,51,17,254,88,0,0,3,0,
+199,0,0,4,135,5,182,0,23,0,34,0,47,0,98,64,62,11,30,90,5,6,1,229,6,245,6,
+2,214,6,1,6,6,36,42,91,112,17,128,17,2,17,103,49,127,49,143,49,2,16,49,1,
+24,36,90,23,100,48,11,35,96,121,24,1,11,24,1,8,24,24,0,36,96,23,18,34,96,
+0,3,0,63,225,63,225,17,57,47,94,93,93,225,57,1,16,246,225,50,93,93,16,246,
+93,225,18,57,47,93,93,113,225,50,49,48,19,33,50,30,2,21,20,14,2,7,21,30,3,
+21,20,14,2,35,33,19,51,50,62,2,53,52,38,35,35,17,17,33,50,62,2,53,52,46,2,
+35,199,1,143,128,195,131,66,39,74,109,69,69,121,90,52,65,123,176,111,254,
+27,186,244,84,114,70,31,154,166,223,1,10,88,119,73,32,33,75,124,92,5,182,
+39,87,141,103,62,108,82,55,9,10,12,45,79,120,86,100,157,109,58,3,74,30,59,
+89,59,120,104,253,151,253,240,40,72,101,61,56,94,67,37,0,0,1,0,125,255,236,
+4,152,5,203,0,35,0,76,64,20,175,14,1,14,64,21,24,72,14,14,24,186,32,1,96,
+32,112,32,2,32,184,255,192,64,24,6,10,72,32,32,37,175,37,1,5,91,24,102,36,
+33,0,95,29,4,13,10,95,19,19,0,63,225,51,63,225,51,1,16,246,225,93,17,51,47,
+43,93,93,18,57,47,43,93,49,48,1,34,14,2,21,20,30,2,51,50,54,55,21,14,3,35,
+34,38,38,2,53,52,18,54,54,51,50,22,23,7,38,38,3,25,107,174,123,67,59,118,
+176,118,89,160,78,39,78,85,97,59,164,240,157,76,87,169,250,162,108,196,79,
+78,63,148,5,39,81,152,218,137,141,219,150,78,35,23,162,15,23,14,7,108,198,
+1,22,169,166,1,20,198,110,44,42,156,32,46,0,2,0,199,0,0,4,252,5,182,0,12,
+0,23,0,38,64,21,13,91,0,103,25,16,25,1,20,90,6,100,24,19,96,7,3,20,96,6,18,
+0,63,225,63,225,1,16,246,225,93,16,246,225,49,48,1,20,2,6,4,35,33,17,33,50,
+22,22,18,7,52,46,2,35,35,17,51,32,0,4,252,96,182,254,247,168,254,146,1,151,
+153,248,174,95,197,66,126,184,117,201,162,1,8,1,12,2,233,185,254,233,187,
+94,5,182,92,181,254,244,182,146,213,138,67,251,137,1,36,0,0,1,0,199,0,0,3,
+190,5,182,0,11,0,66,64,38,20,8,1,8,8,1,4,0,103,13,6,10,90,1,100,12,9,95,79,
+6,1,15,6,175,6,2,8,6,6,10,5,95,2,3,10,95,1,18,0,63,225,63,225,18,57,47,94,
+93,113,225,1,16,246,225,50,16,230,50,17,57,47,93,49,48,33,33,17,33,21,33,
+17,33,21,33,17,33,3,190,253,9,2,247,253,195,2,23,253,233,2,61,5,182,164,254,
+60,162,253,248,0,1,0,199,0,0,3,190,5,182,0,9,0,112,64,17,8,8,1,15,3,1,255,
+3,1,128,3,144,3,208,3,3,3,184,255,192,64,56,7,10,72,3,3,11,15,11,47,11,143,
+11,175,11,4,7,6,0,90,1,100,10,9,95,15,6,1,15,6,63,6,111,6,255,6,4,8,6,64,
+26,29,72,6,64,16,21,72,6,6,0,5,95,2,3,0,18,0,63,63,225,18,57,47,43,43,94,
+93,113,225,1,16,246,225,50,94,93,17,51,47,43,93,93,113,18,57,47,49,48,33,
+35,17,33,21,33,17,33,21,33,1,129,186,2,247,253,195,2,23,253,233,5,182,164,
+253,252,164,0,0,1,0,125,255,236,4,242,5,203,0,43,0,55,64,30,43,43,12,41,90,
+20,2,103,45,16,45,1,31,91,12,102,44,43,95,0,0,36,26,95,17,4,36,95,7,19,0,
+63,225,63,225,18,57,47,225,1,16,246,225,93,16,246,50,225,17,57,47,49,48,1,
+33,17,14,3,35,34,38,38,2,53,52,18,54,36,51,50,22,23,7,46,3,35,34,14,2,21,
+20,30,2,51,50,62,2,55,17,33,3,14,1,228,55,112,118,130,75,157,242,166,86,95,
+182,1,11,171,111,204,88,72,36,83,88,93,46,122,188,127,66,55,120,190,134,44,
+73,62,55,26,254,213,3,4,253,51,18,28,19,10,105,195,1,23,174,172,1,22,195,
+105,44,42,162,17,30,23,14,81,152,218,137,130,216,156,86,5,8,11,5,1,180,0,
+0,1,0,199,0,0,4,213,5,182,0,11,0,61,64,35,9,1,90,0,101,13,192,13,1,191,13,
+1,32,13,1,8,4,90,5,100,12,3,95,15,8,1,8,8,8,10,6,3,5,0,18,0,63,50,63,51,57,
+47,94,93,225,1,16,246,225,50,93,93,93,16,246,225,50,49,48,33,35,17,33,17,
+35,17,51,17,33,17,51,4,213,186,253,102,186,186,2,154,186,2,170,253,86,5,182,
+253,152,2,104,0,0,1,0,82,0,0,2,100,5,182,0,11,0,87,64,38,11,13,43,13,2,123,
+13,155,13,171,13,251,13,4,84,13,1,43,13,59,13,75,13,3,31,13,1,2,8,11,10,90,
+5,2,201,3,1,3,184,255,248,64,16,13,16,72,0,3,1,6,3,9,4,6,3,3,10,0,18,0,63,
+193,50,63,193,50,1,47,94,93,43,93,193,50,241,193,50,95,93,93,93,93,113,49,
+48,33,33,53,55,17,39,53,33,21,7,17,23,2,100,253,238,172,172,2,18,172,172,
+102,41,4,152,41,102,102,41,251,104,41,0,1,255,72,254,123,1,115,5,182,0,19,
+0,47,64,28,223,21,1,96,21,112,21,2,47,21,1,15,90,12,3,3,0,12,16,12,2,7,12,
+13,3,7,95,0,0,47,225,63,1,47,94,93,51,47,16,225,93,93,93,49,48,3,34,38,39,
+53,22,22,51,50,62,2,53,17,51,17,20,14,2,29,51,76,28,34,78,45,37,75,61,38,
+187,59,105,147,254,123,13,11,160,9,11,19,50,88,68,5,182,250,94,105,154,101,
+49,0,0,1,0,199,0,0,4,162,5,182,0,12,0,100,64,45,2,12,102,12,1,12,0,10,11,
+16,11,11,1,0,0,16,0,2,7,0,16,0,0,14,176,14,1,47,14,1,16,14,1,8,4,90,5,100,
+13,2,16,11,16,72,8,184,255,240,64,12,11,16,72,2,8,5,10,6,3,0,5,18,0,63,51,
+63,51,18,57,57,43,43,1,16,246,225,50,93,93,93,17,51,47,56,94,93,51,51,47,
+56,51,17,57,93,17,51,49,48,33,35,1,7,17,35,17,51,17,55,1,51,1,4,162,211,254,
+61,139,186,186,121,1,196,209,253,248,2,186,114,253,184,5,182,253,37,168,2,
+51,253,131,0,0,1,0,199,0,0,3,190,5,182,0,5,0,35,64,19,4,7,175,7,1,16,7,1,
+3,90,0,100,6,1,3,3,95,0,18,0,63,225,63,1,16,246,225,93,93,17,51,49,48,51,
+17,51,17,33,21,199,186,2,61,5,182,250,240,166,0,1,0,199,0,0,6,47,5,182,0,
+25,0,139,64,19,54,25,1,57,0,1,23,14,8,12,15,72,57,14,1,14,17,90,25,184,255,
+248,64,28,12,15,72,25,0,8,12,15,72,0,13,13,12,9,16,101,27,79,27,1,32,27,1,
+15,27,1,8,11,184,255,248,64,26,12,15,72,38,11,1,11,2,8,90,9,100,26,24,1,1,
+16,9,18,72,1,14,11,3,17,12,184,255,240,182,9,18,72,12,8,0,18,0,63,50,50,43,
+50,63,51,51,43,17,51,1,16,246,225,50,50,93,43,94,93,93,93,16,246,17,57,57,
+17,51,43,51,43,225,50,93,43,50,49,48,93,93,33,1,35,22,23,22,22,21,17,35,17,
+33,1,51,1,33,17,35,17,52,54,55,54,55,35,1,3,35,254,69,8,6,4,4,5,172,1,20,
+1,156,6,1,158,1,20,186,4,3,4,3,8,254,65,5,0,74,73,63,139,57,252,150,5,182,
+251,88,4,168,250,74,3,119,52,134,61,71,73,251,2,0,1,0,199,0,0,5,14,5,182,
+0,23,0,81,64,41,14,40,1,1,1,21,90,0,101,25,176,25,1,143,25,1,0,25,16,25,2,
+39,12,1,12,3,9,90,10,100,24,22,2,16,6,24,72,2,11,3,13,184,255,240,182,6,24,
+72,13,10,0,18,0,63,50,50,43,63,51,43,51,1,16,246,225,50,50,93,93,93,93,16,
+246,225,50,93,50,49,48,33,35,1,35,22,23,22,22,21,17,35,17,51,1,51,38,39,46,
+3,53,17,51,5,14,215,253,49,8,6,4,4,5,172,213,2,204,7,3,4,1,3,3,1,174,4,186,
+77,76,65,142,57,252,231,5,182,251,76,76,74,32,67,67,62,26,3,32,0,0,2,0,125,
+255,236,5,113,5,205,0,19,0,39,0,52,64,32,30,91,0,103,41,192,41,1,191,41,1,
+112,41,1,47,41,95,41,2,20,91,10,102,40,35,95,15,4,25,95,5,19,0,63,225,63,
+225,1,16,246,225,93,93,93,93,16,246,225,49,48,1,20,2,6,6,35,34,38,38,2,53,
+52,18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,5,113,
+81,160,237,155,163,239,157,76,76,158,240,163,155,235,160,81,251,209,52,107,
+165,114,114,165,107,50,50,106,164,114,114,166,108,52,2,221,169,254,234,198,
+108,108,198,1,23,170,170,1,21,196,107,107,197,254,235,171,137,219,153,81,
+81,153,219,137,138,218,151,81,81,151,218,0,0,2,0,199,0,0,4,51,5,182,0,14,
+0,25,0,70,64,44,21,91,40,0,56,0,72,0,3,0,103,27,207,27,1,64,27,1,15,27,1,
+6,15,7,90,8,100,26,15,96,48,6,64,6,2,6,6,7,25,96,9,3,7,18,0,63,63,225,17,
+57,47,93,225,1,16,246,225,50,94,93,93,93,16,246,93,225,49,48,1,20,14,2,35,
+35,17,35,17,33,50,30,2,1,51,50,62,2,53,52,38,35,35,4,51,55,126,207,152,150,
+186,1,106,134,194,126,60,253,78,129,93,139,91,46,164,174,160,4,10,91,168,
+129,77,253,199,5,182,57,109,160,254,103,32,71,113,81,142,137,0,2,0,125,254,
+164,5,113,5,205,0,25,0,45,0,56,64,34,36,91,0,103,47,192,47,1,191,47,1,112,
+47,1,47,47,95,47,2,26,91,16,102,46,41,95,21,4,31,95,5,11,19,7,0,47,63,51,
+225,63,225,1,16,246,225,93,93,93,93,16,246,225,49,48,1,20,14,2,7,1,35,1,6,
+6,35,34,38,38,2,53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,
+46,2,35,34,14,2,5,113,49,95,142,93,1,82,244,254,235,17,36,18,163,239,157,
+76,76,158,239,164,154,236,160,81,251,209,52,107,165,114,114,165,107,50,50,
+106,164,114,114,166,108,52,2,221,131,226,181,133,37,254,139,1,76,2,2,108,
+198,1,23,170,170,1,21,196,107,107,197,254,235,171,137,219,153,81,81,153,219,
+137,138,218,151,81,81,151,218,0,2,0,199,0,0,4,160,5,182,0,15,0,28,0,130,64,
+86,9,15,25,15,2,249,15,1,15,8,11,15,72,15,12,9,12,1,7,12,1,22,91,8,7,24,7,
+2,7,7,9,14,1,233,14,249,14,2,14,8,11,15,72,14,13,16,13,30,63,30,143,30,159,
+30,191,30,223,30,5,32,30,1,16,1,90,2,100,29,12,3,16,96,0,0,1,8,0,0,1,28,96,
+3,3,14,1,18,0,63,51,63,225,17,57,47,94,93,225,18,57,1,16,246,225,50,93,93,
+16,206,56,50,43,93,113,50,47,93,225,18,57,94,93,17,51,43,93,113,49,48,1,17,
+35,17,33,32,22,21,20,14,2,7,1,35,1,39,51,50,62,2,53,52,46,2,35,35,1,129,186,
+1,100,1,10,254,49,81,104,55,1,142,219,254,161,229,164,90,126,81,37,41,83,
+127,87,160,2,92,253,164,5,182,206,209,87,130,93,62,20,253,113,2,92,158,35,
+69,103,69,72,100,64,29,0,1,0,104,255,236,3,201,5,203,0,51,0,66,64,39,89,35,
+1,35,17,90,0,103,53,191,53,255,53,2,96,53,1,63,53,1,42,90,9,27,102,52,17,
+42,5,39,95,36,32,4,14,96,9,5,19,0,63,51,225,63,51,225,18,57,57,1,16,246,50,
+225,93,93,93,16,246,225,51,93,49,48,1,20,14,2,35,34,38,39,53,30,3,51,50,54,
+53,52,46,2,39,46,3,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,20,30,2,23,30,
+3,3,201,69,128,184,115,111,193,65,34,87,96,102,50,160,153,29,73,122,93,89,
+131,85,41,64,116,161,97,119,190,74,67,65,165,88,122,134,30,70,115,84,91,137,
+92,47,1,135,97,153,106,55,35,34,178,16,31,24,15,120,112,54,80,67,63,37,35,
+83,104,132,84,88,138,95,50,45,35,156,29,43,113,96,57,83,67,59,33,36,76,96,
+126,0,1,0,20,0,0,4,18,5,182,0,7,0,94,64,50,15,9,1,208,9,1,79,9,207,9,2,16,
+9,32,9,48,9,3,175,6,239,6,2,132,6,1,6,6,7,90,2,64,3,224,3,2,15,3,1,8,3,3,
+87,2,103,2,119,2,3,2,184,255,192,64,11,7,10,72,2,7,3,95,4,3,0,18,0,63,63,
+225,50,1,47,43,93,51,47,94,93,93,16,225,50,47,93,93,93,93,93,113,49,48,33,
+35,17,33,53,33,21,33,2,113,187,254,94,3,254,254,95,5,18,164,164,0,0,1,0,184,
+255,236,4,221,5,184,0,23,0,47,64,28,22,90,1,101,25,176,25,1,111,25,175,25,
+2,16,25,1,14,90,11,100,24,17,95,6,19,12,0,3,0,63,50,63,225,1,16,246,225,93,
+93,93,16,246,225,49,48,1,17,20,14,2,35,34,46,2,53,17,51,17,20,22,51,50,62,
+2,55,17,4,221,66,133,201,136,128,196,133,68,187,173,175,89,128,82,40,1,5,
+184,252,76,114,196,144,82,77,142,199,122,3,174,252,72,175,192,54,98,136,81,
+3,184,0,1,0,0,0,0,4,139,5,182,0,12,0,108,64,16,3,2,9,9,4,0,96,1,112,1,176,
+1,240,1,4,1,184,255,192,64,22,6,10,72,1,16,1,1,14,47,14,127,14,191,14,3,14,
+64,6,9,72,5,4,184,255,240,180,4,5,4,3,9,184,255,224,179,10,17,72,9,184,255,
+240,64,10,6,9,72,9,2,3,18,0,1,3,0,63,51,63,51,51,43,43,63,51,1,47,56,51,43,
+93,17,51,47,56,43,93,51,18,57,61,47,51,51,49,48,1,51,1,35,1,51,1,22,22,23,
+54,54,55,3,197,198,254,23,187,254,25,197,1,39,29,42,17,15,46,31,5,182,250,
+74,5,182,252,97,91,169,74,74,169,97,0,1,0,20,0,0,6,254,5,182,0,42,0,223,182,
+16,8,21,24,72,16,15,184,255,248,181,21,24,72,15,7,1,184,255,248,64,18,21,
+24,72,1,0,8,21,24,72,0,22,29,8,21,24,72,29,28,184,255,248,64,47,21,24,72,
+28,37,20,7,1,4,7,68,7,180,7,3,7,4,37,20,37,36,37,68,37,84,37,5,7,22,37,37,
+22,7,3,30,13,0,14,1,112,14,128,14,192,14,3,14,184,255,192,64,24,7,10,72,14,
+16,14,14,44,111,44,127,44,2,32,44,48,44,2,15,44,1,8,31,30,184,255,240,64,
+19,30,22,32,10,17,72,22,16,6,9,72,22,13,0,30,3,7,37,37,184,255,224,179,10,
+17,72,37,184,255,240,182,6,9,72,37,16,29,18,0,63,51,51,43,43,17,51,63,51,
+51,51,43,43,1,47,56,51,94,93,93,93,17,51,47,56,43,93,113,51,18,23,57,61,47,
+47,47,93,94,93,113,17,51,43,51,43,17,51,43,51,43,17,51,43,51,43,49,48,1,51,
+19,30,3,23,62,3,55,19,51,1,35,3,38,38,39,38,39,6,7,6,6,7,3,35,1,51,19,30,
+3,23,62,3,55,3,41,197,229,15,29,25,19,6,4,12,16,19,11,200,199,254,145,188,
+254,14,26,11,12,11,11,11,10,25,14,242,188,254,126,197,223,12,20,17,14,5,5,
+15,20,23,13,5,182,252,168,56,112,105,94,38,38,90,99,103,49,3,114,250,74,3,
+170,51,108,47,55,52,51,55,47,112,54,252,92,5,182,252,135,46,99,98,91,38,37,
+98,108,111,49,0,1,0,0,0,0,4,96,5,182,0,11,0,129,64,29,9,10,16,10,10,0,55,
+11,1,11,8,56,5,1,5,2,2,1,0,0,1,112,0,128,0,192,0,3,0,184,255,192,64,20,7,
+10,72,0,16,0,0,13,15,13,31,13,47,13,127,13,4,8,7,6,184,255,240,179,6,6,3,
+4,184,255,240,64,16,4,40,2,1,39,8,1,2,8,4,9,6,3,4,0,18,0,63,50,63,51,18,57,
+57,93,93,1,47,56,50,50,47,56,51,94,93,17,51,47,56,43,93,113,51,57,61,47,51,
+93,51,51,93,17,51,24,47,56,51,49,48,33,35,1,1,35,1,1,51,1,1,51,1,4,96,211,
+254,158,254,145,188,1,197,254,90,198,1,76,1,78,190,254,91,2,123,253,133,2,
+252,2,186,253,209,2,47,253,76,0,0,1,0,0,0,0,4,55,5,182,0,8,0,115,64,25,239,
+10,1,10,64,9,12,72,8,171,7,1,152,7,1,64,7,1,27,7,1,15,7,1,7,184,255,240,64,
+47,7,7,5,1,128,2,1,79,2,1,27,2,1,2,16,2,2,0,4,90,119,5,135,5,151,5,3,79,5,
+1,0,5,16,5,2,7,5,54,0,1,0,1,4,18,7,1,3,0,63,51,63,18,57,93,1,47,94,93,93,
+93,225,57,50,47,56,93,93,93,51,17,51,47,56,93,93,93,93,93,51,43,93,49,48,
+1,1,51,1,17,35,17,1,51,2,27,1,84,200,254,66,187,254,66,203,2,211,2,227,252,
+131,253,199,2,47,3,135,0,0,1,0,82,0,0,3,254,5,182,0,9,0,56,64,32,9,9,3,7,
+103,11,15,11,63,11,79,11,159,11,4,8,8,4,4,1,102,10,7,4,95,5,3,2,8,95,1,18,
+0,63,225,57,63,225,57,1,16,230,50,47,50,94,93,16,230,50,50,47,49,48,33,33,
+53,1,33,53,33,21,1,33,3,254,252,84,2,199,253,77,3,131,253,58,2,219,145,4,
+127,166,145,251,129,0,0,1,0,164,254,188,2,57,5,182,0,7,0,38,64,23,4,0,243,
+6,241,0,1,16,1,176,1,192,1,4,1,5,245,2,248,6,245,1,249,0,63,225,63,225,1,
+47,93,225,237,50,49,48,1,33,17,33,21,35,17,51,2,57,254,107,1,149,223,223,
+254,188,6,250,149,250,49,0,0,1,0,23,0,0,2,233,5,182,0,3,0,33,183,2,1,1,16,
+1,5,0,3,184,255,240,180,3,2,1,0,3,0,63,47,47,1,47,56,51,17,51,56,17,51,49,
+48,19,1,35,1,201,2,32,178,253,224,5,182,250,74,5,182,0,0,1,0,51,254,188,1,
+201,5,182,0,7,0,36,64,20,3,0,243,1,241,96,6,112,6,2,6,9,0,245,7,249,3,245,
+4,248,0,63,225,63,225,1,16,214,93,225,237,50,49,48,23,51,17,35,53,33,17,33,
+51,223,223,1,150,254,106,174,5,207,149,249,6,0,0,1,0,41,2,37,4,25,5,193,0,
+6,0,18,182,3,3,8,0,0,1,6,0,63,205,1,47,17,51,47,49,48,19,1,51,1,35,1,1,41,
+1,203,102,1,191,161,254,175,254,163,2,37,3,156,252,100,2,223,253,33,0,1,255,
+252,254,188,3,78,255,72,0,3,0,18,182,0,0,5,1,1,186,2,0,47,225,1,47,17,51,
+47,49,48,1,33,53,33,3,78,252,174,3,82,254,188,140,0,0,1,1,137,4,217,3,18,
+6,33,0,13,0,22,64,10,0,6,8,128,15,0,95,0,2,0,0,47,93,26,204,1,47,205,49,48,
+1,35,46,3,39,53,51,30,3,23,3,18,120,35,82,77,63,16,219,16,43,46,48,21,4,217,
+28,83,88,81,27,21,34,81,81,76,29,0,0,2,0,94,255,236,3,156,4,94,0,35,0,50,
+0,84,64,17,16,1,41,71,35,85,52,15,52,111,52,2,6,48,72,12,26,184,255,208,64,
+30,13,17,72,26,16,9,12,72,26,26,12,86,51,25,22,80,29,42,82,16,16,29,16,36,
+80,2,7,22,0,21,0,63,63,51,225,63,57,47,225,16,225,50,1,16,230,50,47,43,43,
+16,225,94,93,16,246,225,50,50,49,48,33,39,35,14,3,35,34,46,2,53,52,54,55,
+55,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,17,37,50,62,2,53,53,7,14,3,
+21,20,22,3,25,37,8,33,66,78,96,63,69,116,85,48,231,236,184,29,55,81,52,83,
+143,66,64,74,182,100,102,149,97,48,254,47,61,104,76,43,143,90,122,73,32,97,
+152,45,65,42,20,39,81,123,84,164,176,8,7,69,67,90,55,24,48,34,137,40,56,41,
+89,138,98,253,16,127,38,77,117,79,99,7,4,32,57,81,51,92,86,0,0,2,0,174,255,
+236,4,63,6,20,0,31,0,47,0,56,181,45,72,5,87,49,49,184,255,184,64,23,10,73,
+21,16,37,71,18,84,48,19,0,18,21,42,80,15,10,22,32,80,27,0,16,0,63,50,225,
+63,51,225,63,63,1,16,246,225,50,50,43,16,246,225,49,48,1,50,30,2,21,20,14,
+2,35,34,46,2,39,35,7,35,17,51,17,20,6,7,6,7,51,62,3,23,34,14,2,21,20,30,2,
+51,50,54,53,52,38,2,158,94,154,109,60,60,109,154,94,59,96,77,59,23,12,37,
+133,182,2,2,2,2,8,23,58,77,96,25,80,107,65,27,27,65,108,81,135,127,127,4,
+94,72,143,212,140,141,213,144,73,26,43,58,32,139,6,20,254,136,35,79,34,40,
+38,35,60,44,25,151,51,104,156,105,101,157,107,55,218,204,208,206,0,1,0,113,
+255,236,3,111,4,94,0,31,0,42,64,24,29,13,33,95,33,127,33,2,16,33,1,22,72,
+5,86,32,19,81,10,16,25,81,0,22,0,63,225,63,225,1,16,246,225,93,93,16,206,
+50,49,48,5,34,46,2,53,52,62,2,51,50,22,23,7,46,3,35,34,6,21,20,22,51,50,54,
+55,21,6,6,2,82,101,176,130,74,76,133,178,102,78,149,50,54,23,56,60,58,26,
+157,144,145,148,81,131,54,54,123,20,63,137,213,150,157,219,137,62,34,25,154,
+10,19,15,9,201,212,211,195,37,25,162,29,30,0,0,2,0,113,255,236,4,2,6,20,0,
+31,0,48,0,52,64,29,38,0,27,71,30,85,50,16,50,1,46,72,11,86,49,31,21,28,0,
+43,80,22,16,16,32,80,1,6,22,0,63,51,225,63,51,225,63,63,1,16,246,225,93,16,
+246,225,50,50,49,48,37,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,51,38,
+39,38,38,53,17,51,17,35,37,50,62,2,55,53,52,46,2,35,34,6,21,20,22,3,84,8,
+22,59,77,96,60,93,154,110,60,60,110,154,93,59,96,77,60,22,12,3,3,2,4,182,
+147,254,198,76,105,65,31,2,27,65,108,81,135,127,127,147,34,61,46,26,72,143,
+212,140,141,213,144,73,26,44,58,32,34,31,26,55,16,1,180,249,236,131,46,94,
+141,94,41,101,157,107,55,218,204,209,205,0,2,0,113,255,236,3,225,4,94,0,30,
+0,39,0,67,64,40,35,72,25,16,87,41,224,41,1,111,41,1,34,17,72,5,86,40,17,80,
+27,34,43,34,2,15,34,1,6,34,34,20,31,80,10,16,20,81,0,22,0,63,225,63,225,18,
+57,47,94,93,93,225,1,16,246,225,50,93,93,16,246,50,225,49,48,5,34,46,2,53,
+52,62,2,51,50,30,2,21,21,33,22,22,51,50,62,2,55,21,14,3,3,34,6,7,33,52,46,
+2,2,96,110,182,131,72,66,120,167,101,99,158,110,59,253,76,5,153,151,51,87,
+81,76,39,40,77,81,87,96,114,133,11,1,236,27,57,88,20,74,142,210,135,136,214,
+149,78,71,129,181,110,113,193,182,10,19,29,18,162,19,28,18,8,3,219,156,149,
+68,113,80,44,0,1,0,29,0,0,2,240,6,31,0,27,0,112,64,78,207,29,223,29,2,96,
+29,128,29,144,29,160,29,4,31,29,63,29,79,29,3,27,27,127,16,191,16,2,16,16,
+26,2,71,3,7,3,15,5,31,5,47,5,175,5,4,5,5,0,3,16,3,32,3,128,3,144,3,160,3,
+6,6,3,1,5,79,7,0,26,1,7,26,15,20,80,13,1,2,21,0,63,63,225,63,94,93,51,225,
+50,1,47,94,93,51,47,93,17,51,16,225,50,50,47,93,57,47,93,93,93,49,48,1,35,
+17,35,17,35,53,55,53,52,62,2,51,50,22,23,7,38,38,35,34,14,2,21,21,51,2,139,
+245,183,194,194,45,85,124,78,59,99,39,47,31,73,40,40,58,38,19,245,3,193,252,
+63,3,193,75,68,96,107,141,84,35,23,14,141,11,17,19,48,83,65,104,0,0,3,0,37,
+254,20,3,252,4,94,0,63,0,82,0,94,0,167,64,25,13,50,5,83,71,55,18,47,96,55,
+112,55,128,55,3,55,47,55,47,39,72,29,89,71,5,184,255,192,64,77,7,10,72,5,
+5,1,10,29,1,253,29,1,176,29,1,136,29,1,32,29,48,29,64,29,3,29,29,96,31,96,
+1,191,96,223,96,2,160,96,1,64,39,64,12,15,72,39,2,5,50,13,4,60,86,82,10,10,
+34,92,79,60,44,78,15,23,1,7,23,23,60,16,69,79,34,27,1,0,15,0,63,193,63,225,
+63,57,47,94,93,193,57,16,225,17,57,47,225,18,23,57,1,47,43,193,93,93,113,
+17,51,47,93,93,93,93,113,51,57,47,43,225,16,193,17,57,57,47,47,93,16,193,
+16,225,18,57,57,49,48,1,21,7,22,22,21,20,14,2,35,34,38,39,14,3,21,20,30,2,
+51,51,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,55,38,38,53,52,54,55,46,3,
+53,52,62,2,51,50,22,23,1,20,30,2,51,50,54,53,52,46,2,35,35,34,14,2,19,20,
+22,51,50,54,53,52,38,35,34,6,3,252,197,28,38,47,95,140,93,22,44,14,17,33,
+27,17,24,41,56,31,176,93,128,81,36,65,134,205,139,107,160,106,53,39,66,87,
+47,42,54,64,69,43,71,49,27,50,98,146,97,37,79,27,254,64,26,59,97,72,186,185,
+24,55,90,65,176,35,76,63,41,92,108,99,100,103,105,100,99,106,4,74,113,27,
+35,109,69,76,129,94,53,1,3,10,25,32,40,24,27,33,18,6,47,80,109,61,88,140,
+97,52,42,80,113,71,60,91,66,42,11,19,82,53,61,89,42,18,63,81,96,51,89,140,
+98,52,11,9,251,2,37,64,46,27,115,108,46,58,33,12,16,44,77,3,96,115,112,111,
+119,123,116,120,0,1,0,174,0,0,4,18,6,20,0,25,0,50,64,29,0,71,25,85,27,16,
+27,96,27,128,27,3,15,14,10,71,11,84,26,16,4,80,21,16,12,0,11,0,21,0,63,50,
+63,63,225,51,1,16,246,225,50,50,93,16,246,225,49,48,33,17,52,38,35,34,14,
+2,21,17,35,17,51,17,7,51,62,3,51,50,22,21,17,3,92,105,112,81,110,67,29,182,
+182,8,10,25,69,82,92,48,183,185,2,195,130,130,52,102,148,96,253,199,6,20,
+254,50,144,43,63,42,20,191,210,253,51,0,0,2,0,160,0,0,1,117,5,229,0,3,0,17,
+0,37,64,20,16,19,32,19,2,12,0,71,4,1,84,18,7,83,15,15,2,15,0,21,0,63,63,51,
+47,229,1,16,246,50,225,50,93,49,48,33,35,17,51,3,52,54,51,50,30,2,21,20,6,
+35,34,38,1,100,182,182,196,61,45,22,39,29,17,63,44,45,61,4,74,1,41,60,54,
+13,28,43,30,58,57,56,0,2,255,188,254,20,1,117,5,229,0,19,0,33,0,46,64,25,
+16,35,32,35,2,28,15,71,12,20,3,3,12,84,34,23,83,31,31,13,15,7,80,0,27,0,63,
+225,63,51,47,229,1,16,230,50,47,50,16,225,50,93,49,48,19,34,38,39,53,22,22,
+51,50,62,2,53,17,51,17,20,14,2,19,52,54,51,50,30,2,21,20,6,35,34,38,66,48,
+63,23,26,54,35,27,46,35,19,182,34,72,109,19,61,45,22,39,29,17,63,44,45,61,
+254,20,14,11,148,10,11,15,39,65,51,4,244,251,24,77,123,87,47,7,95,60,54,13,
+28,43,30,58,57,56,0,0,1,0,174,0,0,3,240,6,20,0,14,0,94,64,11,7,4,4,2,3,3,
+6,68,5,1,5,184,255,192,64,23,7,10,72,5,16,5,5,16,15,16,47,16,2,7,13,9,71,
+10,84,15,11,0,0,184,255,248,64,16,12,15,72,7,8,12,15,72,0,7,3,6,10,21,3,15,
+0,63,63,51,18,57,57,43,43,63,1,16,246,225,50,94,93,17,51,47,56,43,93,51,51,
+17,51,57,17,51,49,48,1,55,1,51,1,1,35,1,7,17,35,17,51,17,3,1,86,135,1,37,
+211,254,111,1,172,209,254,176,109,180,180,16,2,55,170,1,105,254,37,253,145,
+1,248,82,254,90,6,20,253,54,254,237,0,1,0,174,0,0,1,100,6,20,0,3,0,26,64,
+14,16,5,32,5,2,0,71,1,84,4,2,0,0,21,0,63,63,1,16,246,225,93,49,48,33,35,17,
+51,1,100,182,182,6,20,0,1,0,174,0,0,6,135,4,94,0,44,0,101,64,63,35,10,71,
+185,11,1,150,11,166,11,2,137,11,1,103,11,119,11,2,11,11,22,0,71,44,85,46,
+240,46,1,207,46,1,32,46,80,46,2,15,46,1,8,25,21,71,22,84,45,35,26,26,4,15,
+80,40,31,16,23,15,22,11,0,21,0,63,50,50,63,63,51,225,50,50,17,51,1,16,246,
+225,50,94,93,93,93,93,16,246,225,17,57,47,93,93,93,93,225,50,49,48,33,17,
+52,38,35,34,14,2,21,17,35,17,52,38,35,34,14,2,21,17,35,17,51,23,51,62,3,51,
+50,22,23,51,62,3,51,50,22,21,17,5,209,100,105,73,102,65,30,183,99,105,77,
+104,63,27,182,148,26,10,24,66,79,89,46,120,159,38,8,26,73,87,96,50,175,177,
+2,195,130,130,47,91,135,88,253,162,2,195,130,130,52,102,148,96,253,199,4,
+74,148,43,63,42,20,88,94,47,68,45,22,191,210,253,51,0,1,0,174,0,0,4,18,4,
+94,0,24,0,48,64,28,0,71,24,85,26,16,26,96,26,128,26,3,14,10,71,11,84,25,15,
+4,80,20,16,12,15,11,0,21,0,63,50,63,63,225,51,1,16,246,225,50,93,16,246,225,
+49,48,33,17,52,38,35,34,14,2,21,17,35,17,51,23,51,62,3,51,50,22,21,17,3,92,
+105,112,81,110,67,29,182,148,26,10,25,69,82,92,48,183,185,2,195,130,130,52,
+102,148,96,253,199,4,74,148,43,63,42,20,191,210,253,51,0,2,0,113,255,236,
+4,45,4,94,0,19,0,31,0,48,64,29,26,72,0,87,33,64,33,208,33,224,33,3,15,33,
+1,6,20,72,10,86,32,29,80,15,16,23,80,5,22,0,63,225,63,225,1,16,246,225,94,
+93,93,16,246,225,49,48,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,20,22,
+51,50,54,53,52,38,35,34,6,4,45,67,125,178,111,103,174,127,71,67,124,179,111,
+103,174,127,71,253,0,137,154,154,135,137,154,154,135,2,39,137,213,145,76,
+76,145,213,137,136,211,145,75,75,145,211,136,209,211,211,209,209,207,207,
+0,0,2,0,174,254,20,4,63,4,94,0,31,0,48,0,54,64,30,46,72,27,87,50,16,50,1,
+38,16,6,12,71,13,84,49,32,80,17,22,16,14,15,12,27,43,80,5,0,22,0,63,50,225,
+63,63,63,51,225,1,16,246,225,50,50,50,93,16,246,225,49,48,5,34,46,2,39,35,
+22,23,22,22,21,17,35,17,51,23,51,62,3,51,50,30,2,21,20,14,2,3,34,14,2,7,21,
+20,30,2,51,50,54,53,52,38,2,158,59,96,77,59,23,12,3,3,2,4,182,148,26,8,23,
+58,77,96,60,94,154,109,60,60,109,154,129,76,105,65,31,2,27,65,108,81,135,
+127,127,20,26,43,58,32,34,31,26,55,16,254,43,6,54,148,35,61,45,27,72,143,
+212,140,141,213,144,73,3,219,46,94,140,95,41,101,157,107,55,218,204,208,206,
+0,0,2,0,113,254,20,4,2,4,94,0,16,0,48,0,54,64,30,43,32,5,37,71,36,85,50,16,
+50,1,14,72,22,86,49,36,27,34,15,32,11,80,27,16,44,0,80,17,22,0,63,225,51,
+63,225,51,63,63,1,16,246,225,93,16,246,225,50,50,50,49,48,37,50,62,2,55,53,
+52,46,2,35,34,6,21,20,22,23,34,46,2,53,52,62,2,51,50,30,2,23,51,55,51,17,
+35,17,52,54,55,54,55,35,14,3,2,53,76,105,65,31,2,27,65,108,81,135,127,127,
+102,93,154,110,60,60,110,154,93,59,96,76,60,23,8,27,147,182,4,2,3,3,12,22,
+59,77,96,131,46,94,141,94,41,101,157,107,55,218,204,209,205,151,72,143,212,
+140,141,213,144,73,27,45,61,35,148,249,202,1,213,19,58,27,32,34,34,61,46,
+26,0,1,0,174,0,0,3,8,4,94,0,22,0,65,64,11,178,3,194,3,2,144,3,160,3,2,3,184,
+255,192,64,27,7,11,72,3,3,24,48,24,80,24,128,24,3,17,13,71,14,84,23,15,15,
+13,21,18,7,0,16,0,63,193,51,63,63,1,16,246,225,50,93,17,51,47,43,93,93,49,
+48,1,50,22,23,7,38,38,35,34,14,2,21,17,35,17,51,23,51,62,3,2,137,29,72,26,
+24,28,59,26,63,104,75,41,182,148,22,8,25,57,71,88,4,94,5,5,168,5,7,51,95,
+133,81,253,176,4,74,201,43,80,61,37,0,1,0,90,255,236,3,63,4,94,0,53,0,72,
+64,45,37,19,71,144,0,160,0,2,0,87,55,63,55,95,55,159,55,3,16,55,1,44,71,9,
+159,29,175,29,2,29,86,54,38,41,80,19,44,5,34,16,9,14,80,5,22,0,63,225,50,
+63,18,57,57,225,50,1,16,246,93,50,225,93,93,16,246,93,225,51,49,48,1,20,14,
+2,35,34,38,39,53,30,3,51,50,62,2,53,52,46,2,39,46,3,53,52,62,2,51,50,22,23,
+7,38,38,35,34,6,21,20,30,2,23,30,3,3,63,58,109,154,96,109,156,59,31,76,84,
+89,44,65,91,57,26,20,53,92,72,72,115,80,43,55,100,140,86,97,161,72,63,65,
+137,71,102,98,23,56,94,70,72,113,80,42,1,45,80,120,81,40,35,34,166,16,31,
+24,15,22,41,59,36,31,50,49,50,31,31,60,74,97,67,70,109,74,38,42,34,147,29,
+43,67,62,35,52,46,47,29,30,60,75,96,0,0,1,0,33,255,236,2,143,5,70,0,29,0,
+80,177,25,5,184,255,192,64,47,8,11,72,5,5,31,63,31,79,31,2,23,27,71,20,31,
+18,47,18,2,18,0,16,16,16,32,16,176,16,192,16,208,16,6,6,16,26,18,79,22,20,
+23,15,0,80,11,22,0,63,225,63,51,51,225,50,1,47,94,93,198,93,51,225,50,93,
+17,51,47,43,51,49,48,37,50,62,2,55,21,14,3,35,34,46,2,53,17,35,53,55,55,51,
+21,33,21,33,17,20,22,1,250,18,45,42,35,9,13,40,48,52,25,62,106,77,44,155,
+155,78,105,1,20,254,236,63,129,4,6,8,3,138,6,12,9,5,32,78,133,101,2,125,81,
+78,230,252,137,253,131,97,98,0,1,0,164,255,236,4,8,4,74,0,26,0,48,64,28,1,
+23,71,26,85,28,16,28,96,28,128,28,3,15,71,12,84,27,24,13,15,18,80,2,7,22,
+0,21,0,63,63,51,225,63,51,1,16,246,225,93,16,246,225,50,49,48,33,39,35,14,
+3,35,34,46,2,53,17,51,17,20,22,51,50,62,2,53,17,51,17,3,117,27,10,25,69,82,
+92,48,91,138,92,47,182,106,111,81,110,67,29,182,147,43,63,41,20,46,98,152,
+105,2,205,253,61,130,130,52,101,148,96,2,58,251,182,0,0,1,0,0,0,0,3,213,4,
+74,0,17,0,109,185,0,17,255,248,64,15,10,14,72,17,0,8,10,14,72,0,9,9,1,15,
+16,184,255,192,179,18,21,72,16,184,255,192,64,28,7,11,72,16,16,16,16,19,191,
+19,207,19,239,19,3,80,19,1,15,19,47,19,79,19,3,7,2,1,184,255,240,64,10,1,
+71,9,1,9,15,1,15,0,21,0,63,63,51,57,93,1,47,56,193,94,93,93,93,17,51,47,56,
+43,43,193,18,57,61,47,51,43,51,43,49,48,33,1,51,19,30,3,23,51,62,3,55,19,
+51,1,1,119,254,137,188,199,11,30,30,25,4,7,5,24,30,30,11,199,188,254,137,
+4,74,253,157,33,104,108,96,25,25,96,108,104,33,2,99,251,182,0,1,0,20,0,0,
+5,227,4,74,0,47,0,195,185,0,47,255,248,64,12,10,14,72,47,0,8,9,14,72,0,39,
+32,184,255,248,64,18,9,14,72,32,31,8,9,14,72,31,9,16,8,10,14,72,16,15,184,
+255,248,64,9,9,14,72,15,24,84,39,1,39,184,255,224,64,21,7,10,72,91,24,1,24,
+32,7,10,72,39,9,24,24,9,39,3,17,45,46,184,255,192,179,18,21,72,46,184,255,
+192,64,19,7,11,72,46,16,46,46,49,32,49,48,49,2,15,49,1,7,18,17,184,255,240,
+64,22,17,45,31,9,9,1,9,17,15,39,25,6,25,102,25,118,25,3,25,0,16,21,0,63,51,
+51,93,17,51,63,51,93,51,51,1,47,56,51,94,93,93,17,51,47,56,43,43,51,18,23,
+57,61,47,47,47,43,93,43,93,17,51,43,51,43,17,51,43,51,43,17,51,43,51,43,49,
+48,33,3,46,3,39,38,39,35,6,7,6,6,7,3,35,1,51,19,30,3,23,51,62,3,55,19,51,
+19,30,3,23,51,62,3,55,19,51,1,3,240,168,4,12,12,13,6,14,15,6,14,13,11,25,
+11,172,211,254,231,191,131,10,20,18,14,4,6,5,17,21,22,10,179,196,172,9,23,
+22,18,4,6,3,13,18,21,11,137,186,254,228,2,104,18,45,50,52,25,58,62,63,58,
+50,106,37,253,156,4,74,253,184,45,105,103,91,29,26,87,97,95,33,2,107,253,
+149,34,92,95,88,29,26,87,104,109,47,2,72,251,182,0,1,0,35,0,0,3,219,4,74,
+0,11,0,229,64,161,137,9,1,134,3,1,6,4,1,247,4,1,229,4,1,54,4,1,4,5,232,6,
+1,6,3,231,0,1,0,9,9,2,1,248,2,1,234,2,1,57,2,1,2,1,107,5,123,5,2,87,5,1,58,
+5,74,5,2,100,1,116,1,2,88,1,1,53,1,69,1,2,5,1,9,1,9,5,3,11,6,8,1,247,8,1,
+229,8,1,54,8,1,8,7,64,22,25,72,7,64,14,17,72,107,7,123,7,2,87,7,1,58,7,74,
+7,2,7,13,16,13,48,13,2,144,13,176,13,2,15,13,1,6,217,10,1,200,10,1,186,10,
+1,9,10,1,10,59,11,75,11,2,40,11,1,5,11,21,11,2,11,7,21,1,15,0,63,63,1,47,
+93,93,93,193,93,93,93,93,94,93,93,113,16,222,93,93,93,43,43,193,93,93,93,
+113,18,23,57,61,47,24,47,47,93,93,93,93,93,93,16,193,93,93,93,113,17,51,93,
+51,51,93,16,193,93,93,93,113,49,48,0,93,93,1,1,51,19,19,51,1,1,35,1,1,35,
+1,152,254,159,207,250,250,207,254,157,1,117,207,254,244,254,242,207,2,51,
+2,23,254,102,1,154,253,233,253,205,1,180,254,76,0,0,1,0,10,254,20,3,223,4,
+74,0,34,0,100,182,34,16,8,8,0,14,15,184,255,192,179,18,21,72,15,184,255,192,
+64,29,7,11,72,15,16,15,15,36,191,36,207,36,239,36,3,80,36,1,15,36,47,36,79,
+36,3,7,24,1,0,184,255,240,64,12,0,34,16,8,35,28,80,21,27,14,0,15,0,63,50,
+63,225,17,51,51,51,1,47,56,193,51,94,93,93,93,17,51,47,56,43,43,193,18,57,
+61,47,51,51,49,48,19,51,19,30,3,23,51,62,3,55,19,51,1,14,3,35,34,38,39,53,
+22,22,51,50,62,2,55,55,10,189,215,14,29,25,18,4,6,5,22,27,29,11,199,188,254,
+78,28,65,86,116,80,52,76,27,21,64,35,48,70,52,37,15,57,4,74,253,155,40,88,
+88,82,35,25,86,97,94,33,2,99,251,39,81,129,90,49,11,6,145,5,7,23,44,64,41,
+160,0,0,1,0,82,0,0,3,53,4,74,0,9,0,108,64,11,9,151,3,1,3,8,9,13,72,3,7,184,
+255,192,64,17,7,10,72,7,7,11,63,11,95,11,127,11,3,152,8,1,8,184,255,248,181,
+9,13,72,8,4,2,184,255,192,183,18,21,72,63,2,1,2,7,184,255,240,64,18,7,12,
+72,7,4,79,5,15,2,16,7,12,72,2,8,79,1,21,0,63,225,50,43,63,225,50,43,1,47,
+93,43,51,51,43,93,93,17,51,47,43,51,43,93,51,49,48,33,33,53,1,33,53,33,21,
+1,33,3,53,253,29,2,24,254,9,2,176,253,244,2,30,125,3,68,137,146,252,209,0,
+0,1,0,61,254,188,2,162,5,182,0,39,0,64,64,37,26,5,5,247,32,39,241,35,19,15,
+246,16,12,1,12,35,15,245,217,16,1,15,16,95,16,2,16,16,41,26,245,25,248,5,
+245,6,249,0,63,225,63,225,18,57,47,93,93,225,57,1,47,93,230,51,51,241,50,
+226,47,50,49,48,5,20,30,2,23,21,46,3,53,17,52,38,35,53,50,54,53,17,52,62,
+2,55,21,14,3,21,17,20,6,7,21,22,22,21,1,244,24,45,65,40,77,131,95,54,131,
+125,125,131,54,95,131,77,40,65,45,24,119,115,115,119,16,48,61,35,13,1,150,
+1,33,71,110,78,1,78,103,86,155,86,103,1,77,78,110,71,33,1,149,1,13,35,61,
+48,254,180,105,123,20,12,20,122,106,0,0,1,1,233,254,20,2,127,6,20,0,3,0,45,
+64,31,0,5,1,48,5,64,5,112,5,128,5,4,2,170,0,3,16,3,64,3,128,3,192,3,5,7,3,
+2,27,0,0,0,63,63,1,47,94,93,225,93,113,49,48,1,51,17,35,1,233,150,150,6,20,
+248,0,0,0,1,0,51,254,188,2,152,5,182,0,41,0,64,64,37,13,36,36,247,7,0,241,
+26,246,20,3,144,29,1,29,4,26,245,239,25,255,25,2,217,25,1,25,25,14,36,245,
+35,249,13,245,14,248,0,63,225,63,225,17,57,47,93,93,225,57,1,47,93,51,51,
+230,241,50,226,47,50,49,48,19,52,54,55,53,38,38,53,17,52,46,2,39,53,30,3,
+21,17,20,30,2,51,21,34,6,21,17,20,14,2,7,53,62,3,53,225,119,115,115,119,24,
+45,65,40,77,131,95,54,33,65,96,62,125,131,54,95,131,77,40,65,45,24,1,59,106,
+122,20,12,20,123,105,1,76,48,61,35,13,1,149,1,33,71,110,78,254,179,52,72,
+45,20,155,86,103,254,178,78,110,71,33,1,150,1,13,35,61,48,0,1,0,102,2,74,
+4,2,3,90,0,35,0,60,64,13,29,37,16,37,1,16,10,1,10,23,173,10,31,184,255,192,
+64,22,16,19,72,31,31,5,173,28,15,13,31,13,63,13,79,13,111,13,143,13,6,13,
+0,47,93,51,241,200,47,43,50,225,1,47,93,93,16,206,49,48,1,46,3,35,34,14,2,
+7,53,54,51,50,30,2,23,30,3,51,50,62,2,55,21,6,35,34,46,2,2,18,37,55,45,41,
+22,28,60,59,56,25,100,148,29,50,55,67,47,37,55,47,40,22,28,60,59,56,24,99,
+149,29,50,55,67,2,139,16,22,13,5,19,33,44,25,162,108,5,13,25,20,16,22,13,
+5,19,33,44,25,162,108,5,13,25,0,2,0,147,254,139,1,145,4,94,0,3,0,23,0,65,
+185,0,0,255,240,64,19,10,20,72,48,25,160,25,176,25,192,25,4,2,4,154,14,3,
+3,14,184,255,192,64,15,7,10,72,14,0,9,155,19,0,2,16,2,2,7,2,0,47,94,93,47,
+245,206,1,47,43,51,47,16,225,50,93,49,48,43,19,51,19,35,19,20,14,2,35,34,
+46,2,53,52,62,2,51,50,30,2,213,121,51,223,239,19,35,46,27,26,46,35,20,20,
+35,46,26,27,46,35,19,2,164,251,231,5,72,38,53,33,15,15,33,53,38,37,52,34,
+16,16,34,52,0,0,1,0,188,255,236,3,186,5,203,0,37,0,90,64,37,18,3,70,15,4,
+4,10,37,21,39,64,39,1,30,72,0,10,48,10,64,10,208,10,4,6,10,27,115,15,18,15,
+33,115,5,2,5,15,184,255,192,64,12,15,18,72,15,5,15,5,3,16,7,3,25,0,63,63,
+18,57,57,47,47,43,17,51,16,225,17,51,16,225,1,47,94,93,225,93,16,198,50,17,
+57,47,51,225,50,49,48,36,6,7,21,35,53,46,3,53,52,62,2,55,53,51,21,22,22,23,
+7,46,3,35,34,6,21,20,22,51,50,54,55,21,3,118,110,76,137,87,138,98,52,53,97,
+139,86,137,72,136,46,53,23,56,60,59,25,157,144,145,148,81,131,54,212,30,2,
+200,206,13,75,133,199,137,141,203,136,75,13,172,164,3,33,23,154,10,19,15,
+9,202,212,210,195,37,24,161,0,0,1,0,68,0,0,4,35,5,201,0,40,0,117,64,17,13,
+17,111,35,15,15,31,15,2,7,31,15,31,15,25,3,23,184,255,192,179,10,14,72,23,
+184,255,200,64,48,6,9,72,23,23,42,16,42,1,33,25,64,11,14,72,25,25,41,16,33,
+117,13,47,34,127,34,143,34,175,34,191,34,223,34,255,34,7,34,34,0,22,116,25,
+24,7,115,0,7,0,63,225,63,225,17,57,47,93,51,225,50,17,1,51,47,43,51,93,17,
+51,47,43,43,51,18,57,57,47,47,94,93,51,225,50,49,48,1,50,22,23,7,38,38,35,
+34,14,2,21,17,33,21,33,21,20,14,2,7,33,21,33,53,62,3,53,53,35,53,51,17,52,
+62,2,2,154,106,174,66,66,56,141,75,48,82,60,33,1,120,254,136,23,39,51,27,
+2,236,252,33,44,73,53,30,198,198,59,105,146,5,201,45,35,144,29,43,27,59,94,
+66,254,217,137,211,62,89,64,43,16,166,154,11,41,68,97,67,213,137,1,68,87,
+137,95,50,0,2,0,123,1,29,3,236,4,139,0,35,0,55,0,134,64,35,14,143,22,1,22,
+22,46,171,21,15,12,24,6,30,33,3,8,0,112,18,1,18,18,57,16,57,1,4,32,36,170,
+128,0,1,0,184,255,192,64,49,6,10,72,0,0,56,23,128,31,1,31,12,6,24,30,15,6,
+4,9,41,174,0,27,1,27,13,5,51,174,207,9,239,9,2,144,9,160,9,176,9,3,31,9,63,
+9,111,9,3,9,0,47,93,93,93,225,198,50,47,93,225,18,23,57,17,51,198,93,50,17,
+1,51,47,43,93,225,198,50,93,17,51,47,93,18,23,57,241,192,47,93,50,49,48,19,
+52,54,55,39,55,23,54,54,51,50,22,23,55,23,7,22,22,21,20,6,7,23,7,39,6,6,35,
+34,38,39,7,39,55,38,38,55,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,186,35,
+31,129,98,127,47,108,60,60,107,46,129,99,130,31,37,35,33,127,96,129,46,107,
+60,60,110,45,127,96,127,31,35,138,37,65,87,50,51,89,66,38,38,66,89,51,50,
+87,65,37,2,211,59,107,47,129,98,129,32,36,36,32,129,96,129,46,109,60,60,110,
+45,127,96,127,31,35,36,32,127,96,127,45,108,60,50,87,65,38,38,65,87,50,51,
+89,66,38,38,66,89,0,0,1,0,29,0,0,4,76,5,182,0,22,0,149,64,91,48,24,1,15,19,
+12,22,170,21,1,21,21,12,4,8,1,171,2,1,31,2,1,2,2,152,0,1,0,7,3,11,90,153,
+20,1,20,16,15,12,1,138,12,1,0,12,16,12,64,12,3,7,12,10,14,96,15,7,15,6,18,
+96,19,3,0,19,127,15,143,15,2,48,19,1,208,19,1,15,19,31,19,2,15,19,15,19,1,
+11,18,21,1,3,0,63,51,63,18,57,57,47,47,93,93,113,93,17,51,51,16,225,50,17,
+51,16,225,50,1,47,94,93,93,113,51,51,93,225,50,50,57,93,50,47,93,93,51,57,
+57,17,51,47,93,51,18,57,57,93,49,48,1,1,51,1,51,21,33,21,33,21,33,17,35,17,
+33,53,33,53,33,53,51,1,51,2,51,1,90,191,254,127,239,254,211,1,45,254,211,
+178,254,211,1,45,254,211,234,254,133,192,2,211,2,227,253,0,137,158,137,254,
+250,1,6,137,158,137,3,0,0,0,2,1,233,254,20,2,127,6,20,0,3,0,7,0,57,64,37,
+0,9,1,48,9,64,9,112,9,128,9,4,2,6,170,3,0,7,16,7,64,7,128,7,192,7,5,7,7,4,
+3,4,3,6,27,0,0,0,63,63,57,57,47,47,1,47,94,93,51,225,50,93,113,49,48,1,51,
+17,35,17,51,17,35,1,233,150,150,150,150,6,20,252,244,254,25,252,243,0,0,2,
+0,121,255,246,3,94,6,31,0,69,0,90,0,121,64,75,5,86,8,81,70,33,38,76,70,60,
+70,41,41,16,255,33,1,160,33,176,33,2,33,92,192,92,1,191,92,1,70,70,0,23,70,
+8,8,49,0,0,1,0,0,16,0,48,0,192,0,208,0,240,0,6,8,0,91,38,76,5,86,23,86,76,
+41,4,13,55,80,46,21,20,80,13,1,0,63,225,63,225,18,23,57,17,51,17,51,1,16,
+198,94,93,113,50,50,47,225,16,225,93,93,16,206,93,93,50,50,47,225,18,57,57,
+16,225,17,57,57,49,48,19,52,62,2,55,38,38,53,52,62,2,51,50,22,23,7,38,38,
+35,34,6,21,20,30,2,23,30,3,21,20,14,2,7,22,22,21,20,14,2,35,34,38,39,53,30,
+3,51,50,62,2,53,52,46,2,39,46,3,55,20,30,2,23,23,62,3,53,52,46,2,39,14,3,
+137,26,45,58,31,75,85,55,100,140,86,97,157,72,56,65,140,71,99,102,24,57,95,
+70,72,113,78,42,24,41,52,28,69,76,59,108,155,96,108,156,59,31,76,84,89,43,
+69,93,55,23,17,51,94,76,73,115,80,41,154,28,63,101,72,35,20,41,33,21,26,65,
+108,82,25,47,38,23,3,41,51,83,64,45,15,38,114,84,61,98,68,37,40,32,139,28,
+39,59,57,27,46,44,47,29,28,65,78,97,62,52,85,68,49,16,38,109,78,71,111,77,
+40,33,32,158,15,30,23,14,24,39,51,27,29,45,45,49,31,31,62,78,100,89,37,63,
+58,55,30,15,13,36,46,56,34,38,64,59,57,30,8,31,45,58,0,0,2,1,51,5,12,3,106,
+5,217,0,11,0,25,0,53,64,33,12,134,175,20,1,20,192,6,134,0,0,16,0,64,0,80,
+0,4,6,0,15,3,145,23,159,9,207,9,2,48,9,1,9,0,47,93,93,51,229,50,1,47,94,93,
+225,26,220,93,225,49,48,1,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,
+30,2,21,20,6,35,34,38,1,51,56,40,39,58,58,39,40,56,1,119,56,40,19,35,26,16,
+58,38,40,56,5,115,54,48,49,53,53,50,50,53,54,48,12,25,38,27,53,50,50,0,0,
+3,0,100,255,236,6,68,5,203,0,37,0,65,0,85,0,106,64,67,5,197,26,15,15,34,26,
+34,26,34,38,76,195,0,52,1,192,52,1,52,87,66,195,38,10,201,21,0,201,31,15,
+21,31,21,47,21,127,21,143,21,159,21,6,8,0,31,16,31,96,31,112,31,128,31,5,
+21,31,21,31,45,71,200,59,81,200,45,4,0,63,225,47,225,17,57,57,47,47,93,94,
+93,16,225,16,225,1,47,225,16,222,93,113,225,17,57,57,47,47,17,51,47,16,225,
+49,48,1,34,14,2,21,20,30,2,51,50,62,2,55,21,14,3,35,34,46,2,53,52,62,2,51,
+50,22,23,7,38,38,1,52,62,4,51,50,30,4,21,20,14,4,35,34,46,4,55,20,30,2,51,
+50,62,2,53,52,46,2,35,34,14,2,3,123,61,94,64,33,29,61,95,67,23,54,57,56,25,
+24,49,53,60,35,102,152,101,51,54,105,153,100,63,132,59,62,52,97,252,190,54,
+97,138,167,192,104,104,192,167,138,97,54,54,97,138,167,192,104,104,192,167,
+138,97,54,109,101,175,234,133,133,234,175,101,101,175,234,133,133,234,175,
+101,4,29,44,83,120,75,78,120,82,43,7,12,17,9,131,11,18,14,7,66,122,170,103,
+101,167,120,67,33,29,127,26,28,254,190,104,192,167,138,97,54,54,97,138,167,
+192,104,104,192,167,137,98,53,53,98,137,167,192,104,133,234,175,101,101,175,
+234,133,133,234,175,101,101,175,234,0,0,2,0,68,3,16,2,66,5,199,0,30,0,45,
+0,78,64,47,45,1,15,224,0,29,16,29,2,29,47,15,47,31,47,79,47,127,47,175,47,
+5,36,224,11,23,23,96,11,1,11,46,45,228,15,15,26,1,39,228,0,6,192,19,228,26,
+222,0,63,225,26,220,196,225,57,17,57,47,225,1,16,198,93,50,47,16,225,93,16,
+214,93,225,50,50,49,48,1,39,14,3,35,34,46,2,53,52,54,55,55,53,52,38,35,34,
+6,7,39,54,54,51,50,22,21,17,3,14,3,21,20,22,51,50,62,2,53,53,1,231,28,18,
+39,47,56,35,43,72,52,29,141,143,99,61,56,48,90,42,48,51,117,60,125,119,201,
+51,68,41,18,50,42,34,58,43,25,3,29,82,22,35,25,13,26,51,77,51,102,108,5,4,
+31,72,57,29,22,100,26,36,106,122,254,58,1,57,3,18,30,43,29,51,45,21,44,65,
+44,49,0,2,0,82,0,115,3,147,3,199,0,6,0,13,0,96,64,17,2,4,13,235,10,80,4,96,
+4,2,4,10,4,10,6,11,9,184,255,192,64,33,9,12,72,9,15,15,15,159,15,175,15,3,
+6,235,159,3,1,3,6,0,3,13,7,10,10,5,3,3,1,12,5,8,1,0,47,51,47,51,18,57,61,
+47,18,57,17,51,51,17,51,51,1,24,47,93,225,93,16,198,43,50,17,57,57,47,47,
+93,16,225,17,51,49,48,19,1,23,3,19,7,1,37,1,23,3,19,7,1,82,1,53,117,238,238,
+117,254,203,1,151,1,54,116,237,237,116,254,202,2,41,1,158,78,254,164,254,
+164,78,1,155,27,1,158,78,254,164,254,164,78,1,155,0,1,0,102,1,6,4,2,3,29,
+0,5,0,57,64,36,2,170,1,7,16,7,1,150,4,1,139,4,1,121,4,1,86,4,1,75,4,1,56,
+4,1,18,4,1,9,4,1,4,4,173,5,179,0,63,225,1,47,93,93,93,93,93,93,93,93,93,16,
+222,225,49,48,1,17,35,17,33,53,4,2,149,252,249,3,29,253,233,1,129,150,0,255,
+255,0,82,1,209,2,66,2,121,2,6,0,16,0,0,0,4,0,100,255,236,6,68,5,203,0,8,0,
+30,0,58,0,78,0,194,64,125,164,22,180,22,196,22,3,180,23,196,23,2,23,22,1,
+82,21,14,23,14,22,197,21,14,20,21,21,14,14,9,0,25,197,26,9,197,4,21,4,0,26,
+1,0,26,192,26,208,26,3,7,143,4,1,26,4,26,4,31,69,195,0,45,1,192,45,1,45,80,
+59,195,31,14,24,201,0,0,22,27,22,21,26,8,201,27,0,26,1,15,26,31,26,47,26,
+127,26,143,26,159,26,6,8,0,27,16,27,96,27,112,27,128,27,5,26,27,26,27,38,
+64,200,52,19,74,200,38,4,0,63,225,63,225,17,57,57,47,47,93,94,93,113,16,225,
+17,51,51,17,18,57,16,225,50,1,47,225,16,222,93,113,225,17,57,57,47,47,93,
+94,93,113,17,57,16,225,16,225,50,17,57,135,16,43,16,0,193,135,5,43,16,196,
+1,93,49,48,93,1,51,50,54,53,52,38,35,35,5,20,14,2,7,22,23,30,2,23,23,35,3,
+35,17,35,17,51,50,22,1,52,62,4,51,50,30,4,21,20,14,4,35,34,46,4,55,20,30,
+2,51,50,62,2,53,52,46,2,35,34,14,2,2,231,72,91,79,83,89,70,1,146,27,45,57,
+31,67,53,23,42,33,10,10,179,206,95,157,233,168,158,251,235,54,97,138,167,
+192,104,104,192,167,138,97,54,54,97,138,167,192,104,104,192,167,138,97,54,
+109,101,175,234,133,133,234,175,101,101,175,234,133,133,234,175,101,3,0,72,
+69,74,59,129,48,75,57,40,13,110,87,37,71,56,17,17,1,96,254,160,3,125,130,
+254,195,104,192,167,138,97,54,54,97,138,167,192,104,104,192,167,137,98,53,
+53,98,137,167,192,104,133,234,175,101,101,175,234,133,133,234,175,101,101,
+175,234,0,0,1,255,250,6,20,4,6,6,160,0,3,0,18,182,0,0,5,1,1,186,2,0,47,225,
+1,47,17,51,47,49,48,1,33,53,33,4,6,251,244,4,12,6,20,140,0,0,2,0,123,3,86,
+2,242,5,203,0,19,0,39,0,67,64,44,30,171,10,41,159,41,1,20,170,48,0,64,0,2,
+0,25,174,16,15,32,15,2,224,15,240,15,2,111,15,1,0,15,16,15,32,15,3,6,15,15,
+35,174,5,4,0,63,225,51,47,94,93,93,93,113,225,1,47,93,225,93,16,214,225,49,
+48,19,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,55,20,30,2,51,50,62,2,53,52,
+46,2,35,34,14,2,123,50,85,115,65,65,115,86,50,50,86,115,65,65,115,85,50,123,
+30,52,70,40,40,70,53,30,30,53,70,40,40,70,52,30,4,143,65,115,86,50,50,86,
+115,65,65,114,85,49,49,85,114,65,39,69,52,30,30,52,69,39,40,71,53,31,31,53,
+71,0,2,0,102,0,0,4,2,4,162,0,11,0,15,0,58,64,33,16,17,1,15,8,8,6,9,170,12,
+1,1,3,239,0,1,32,0,96,0,160,0,3,0,13,173,12,9,0,173,6,3,179,0,63,51,225,50,
+47,225,1,47,93,93,51,51,17,51,225,50,50,17,51,93,49,48,1,33,53,33,17,51,17,
+33,21,33,17,35,1,53,33,21,1,233,254,125,1,131,150,1,131,254,125,150,254,125,
+3,156,2,135,150,1,133,254,123,150,254,127,254,250,150,150,0,1,0,49,2,74,2,
+109,5,201,0,30,0,64,64,21,8,225,0,23,32,79,32,127,32,2,32,64,6,10,72,29,225,
+1,15,15,1,184,255,192,64,14,21,24,72,1,8,29,11,229,18,222,29,229,1,221,0,
+63,225,63,225,18,57,1,47,43,51,47,16,225,43,93,16,222,50,225,49,48,1,33,53,
+55,62,3,53,52,38,35,34,6,7,39,54,54,51,50,30,2,21,20,14,2,7,7,33,2,109,253,
+196,209,57,72,40,15,66,54,51,93,45,78,54,133,82,60,97,68,37,29,54,79,51,148,
+1,140,2,74,112,228,62,85,67,59,34,65,64,50,38,94,48,65,33,63,91,57,50,86,
+85,91,55,157,0,1,0,31,2,57,2,104,5,201,0,48,0,97,64,60,3,0,25,25,14,6,30,
+225,0,0,21,225,6,50,95,50,143,50,2,50,64,6,10,72,39,39,14,64,25,32,72,14,
+3,25,228,15,26,31,26,47,26,95,26,223,26,5,8,26,26,18,38,35,229,44,222,18,
+229,15,11,223,0,63,51,225,63,225,51,18,57,47,94,93,225,57,1,47,43,51,47,43,
+93,16,222,225,51,47,225,17,18,57,47,18,57,49,48,1,20,6,7,22,22,21,20,14,2,
+35,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,46,2,35,34,
+6,7,39,62,3,51,50,30,2,2,78,81,69,88,88,40,83,126,86,70,123,57,63,132,53,
+98,88,107,96,98,98,92,84,20,35,47,27,59,97,51,69,29,61,68,76,44,69,105,70,
+35,4,231,78,106,24,23,106,78,60,100,71,40,25,31,133,34,38,83,73,74,67,113,
+79,64,32,47,30,14,41,37,96,23,37,26,15,34,60,83,0,1,1,137,4,217,3,18,6,33,
+0,13,0,22,64,10,6,0,5,128,15,12,95,12,2,12,0,47,93,26,205,1,47,205,49,48,
+1,62,3,55,51,21,14,3,7,35,1,137,22,47,47,42,16,219,16,63,77,81,35,121,4,244,
+29,76,81,81,34,21,27,81,88,83,28,0,0,1,0,174,254,20,4,18,4,74,0,29,0,55,64,
+34,13,9,71,10,85,31,16,31,32,31,96,31,112,31,128,31,5,20,29,71,28,84,30,26,
+27,3,80,17,22,11,21,28,9,15,0,63,51,63,63,225,63,1,16,246,225,50,93,16,246,
+225,50,49,48,1,20,22,51,50,62,2,53,17,51,17,35,39,35,6,6,35,34,38,39,22,23,
+22,22,21,17,35,17,51,1,100,106,111,82,110,67,28,182,147,27,10,48,144,103,
+72,106,35,1,2,2,1,182,182,1,135,130,130,52,101,148,96,2,58,251,182,147,83,
+84,46,42,38,40,35,85,42,254,192,6,54,0,1,0,113,254,252,4,102,6,20,0,19,0,
+55,64,33,4,153,0,5,48,5,64,5,80,5,4,6,5,5,13,1,153,0,21,16,21,1,0,13,16,13,
+2,13,3,18,0,5,0,0,47,50,63,193,1,47,93,93,16,214,225,18,57,47,94,93,225,49,
+48,1,35,17,35,17,35,17,6,35,34,46,2,53,52,62,2,51,33,4,102,120,207,121,61,
+85,95,155,109,60,65,119,166,100,2,51,254,252,6,121,249,135,3,51,18,51,118,
+192,140,147,197,120,50,0,0,1,0,147,2,72,1,145,3,94,0,19,0,51,64,26,16,21,
+128,21,144,21,160,21,4,10,150,192,0,208,0,2,52,0,68,0,100,0,116,0,4,0,184,
+255,192,182,7,10,72,0,5,155,15,0,47,229,1,47,43,93,93,237,93,49,48,19,52,
+62,2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,46,27,26,47,34,20,20,34,47,
+26,27,46,34,20,2,211,38,53,33,15,15,33,53,38,37,52,34,16,16,34,52,0,0,1,0,
+35,254,20,1,152,0,0,0,25,0,57,64,31,20,19,19,21,127,18,143,18,2,18,18,6,13,
+132,0,27,6,26,18,140,21,64,9,14,72,21,21,19,10,141,3,0,47,225,47,57,47,43,
+225,1,16,198,16,214,225,17,57,47,93,51,51,17,51,49,48,1,20,6,35,34,38,39,
+53,22,22,51,50,54,53,52,46,2,39,55,51,7,30,3,1,152,141,150,22,45,15,15,49,
+16,71,80,26,46,63,37,90,121,57,34,58,43,25,254,225,97,108,6,3,108,3,3,43,
+49,24,35,26,19,9,176,115,8,26,41,58,0,0,1,0,63,2,74,1,186,5,182,0,14,0,52,
+64,33,79,16,127,16,2,16,64,6,10,72,14,14,2,225,0,127,3,143,3,2,32,3,48,3,
+2,3,2,221,13,9,229,0,220,0,63,225,205,63,1,47,93,93,51,225,51,47,43,93,49,
+48,1,51,17,35,17,52,62,2,55,6,6,7,7,39,1,51,135,145,1,3,3,1,14,38,22,94,74,
+5,182,252,148,2,4,25,60,60,56,22,17,40,17,73,96,0,0,2,0,66,3,16,2,139,5,199,
+0,19,0,31,0,46,178,26,224,0,184,255,192,64,20,9,15,72,0,33,15,33,1,20,224,
+10,32,23,228,5,192,29,228,15,222,0,63,225,26,220,225,1,16,214,225,93,16,214,
+43,225,49,48,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,20,22,51,50,54,
+53,52,38,35,34,6,2,139,41,77,109,68,63,106,78,43,41,76,109,68,62,107,78,44,
+254,58,75,86,85,75,75,85,86,75,4,109,83,130,89,47,47,89,130,83,83,129,88,
+46,46,88,129,83,119,121,121,119,120,115,115,0,0,2,0,84,0,115,3,150,3,199,
+0,6,0,13,0,86,64,47,15,15,159,15,175,15,3,7,235,4,2,10,2,10,2,3,11,9,14,0,
+235,159,3,1,16,3,32,3,64,3,3,3,13,7,10,6,0,3,10,3,10,3,1,12,5,8,1,0,47,51,
+47,51,18,57,57,61,47,47,17,51,51,17,51,51,1,24,47,93,93,225,16,198,50,17,
+57,57,47,47,17,51,225,93,49,48,1,1,39,19,3,55,1,5,1,39,19,3,55,1,3,150,254,
+202,116,237,237,116,1,54,254,104,254,203,117,238,238,117,1,53,2,14,254,101,
+78,1,92,1,92,78,254,98,27,254,101,78,1,92,1,92,78,254,98,0,255,255,0,63,0,
+0,5,139,5,182,0,38,0,123,0,0,0,39,2,23,2,74,0,0,1,7,2,60,2,252,253,183,0,
+48,64,29,3,2,22,24,3,2,191,22,1,143,22,1,63,22,1,22,1,64,17,1,0,17,1,17,0,
+64,0,1,0,17,93,53,17,93,93,53,17,93,93,93,53,53,0,63,53,53,255,255,0,44,0,
+0,5,160,5,182,0,38,0,123,237,0,0,39,2,23,2,53,0,0,1,7,0,116,3,51,253,183,
+0,40,64,24,2,20,24,2,0,20,1,20,1,176,17,1,64,17,1,17,0,112,0,1,64,0,1,0,17,
+93,93,53,17,93,93,53,17,93,53,0,63,53,255,255,0,31,0,0,5,206,5,201,0,38,0,
+117,0,0,0,39,2,23,2,168,0,0,1,7,2,60,3,63,253,183,0,60,64,39,3,2,56,24,3,
+2,112,56,1,80,56,1,56,1,180,51,1,164,51,1,132,51,1,100,51,1,80,51,1,48,51,
+1,32,51,1,51,15,76,1,93,17,93,93,93,93,93,93,93,53,17,93,93,53,53,0,63,53,
+53,0,2,0,68,254,119,3,68,4,94,0,39,0,59,0,68,64,18,50,154,40,40,39,70,0,0,
+11,20,61,15,61,1,8,11,70,28,184,255,192,64,16,15,27,72,28,11,23,39,39,45,
+155,55,16,19,16,81,23,0,47,225,51,63,229,50,47,18,57,1,47,43,225,94,93,16,
+206,17,57,47,225,51,47,225,49,48,1,21,20,14,2,7,14,3,21,20,30,2,51,50,54,
+55,23,6,6,35,34,46,2,53,52,62,2,55,62,3,53,53,19,20,14,2,35,34,46,2,53,52,
+62,2,51,50,30,2,2,80,16,39,65,50,48,68,43,21,30,57,85,55,84,150,69,64,82,
+188,97,93,149,103,56,27,53,81,54,52,66,38,14,186,19,35,46,27,26,46,35,20,
+20,35,46,26,27,46,35,19,2,164,37,58,91,81,76,42,41,67,69,79,53,48,79,57,31,
+51,35,146,42,58,51,96,138,88,68,104,90,84,47,45,67,62,67,43,19,1,47,38,53,
+33,15,15,33,53,38,37,52,34,16,16,34,52,255,255,0,0,0,0,4,221,7,115,2,38,0,
+36,0,0,1,7,0,67,255,189,1,82,0,21,180,2,21,5,38,2,184,255,156,180,27,21,4,
+7,37,1,43,53,0,43,53,0,255,255,0,0,0,0,4,221,7,115,2,38,0,36,0,0,1,7,0,118,
+0,141,1,82,0,19,64,11,2,33,5,38,2,108,21,27,4,7,37,1,43,53,0,43,53,0,255,
+255,0,0,0,0,4,221,7,115,2,38,0,36,0,0,1,7,1,75,0,31,1,82,0,21,180,2,21,5,
+38,2,184,255,255,180,29,21,4,7,37,1,43,53,0,43,53,0,255,255,0,0,0,0,4,221,
+7,53,2,38,0,36,0,0,1,7,1,82,0,6,1,82,0,19,64,11,2,29,5,38,2,1,30,44,4,7,37,
+1,43,53,0,43,53,0,255,255,0,0,0,0,4,221,7,43,2,38,0,36,0,0,1,7,0,106,0,33,
+1,82,0,23,64,13,3,2,30,5,38,3,2,1,21,41,4,7,37,1,43,53,53,0,43,53,53,0,255,
+255,0,0,0,0,4,221,7,4,2,38,0,36,0,0,1,6,1,80,31,125,0,49,64,32,3,2,239,26,
+1,223,26,1,80,26,1,64,26,1,32,26,1,16,26,1,0,26,1,26,3,2,0,31,21,4,7,37,1,
+43,53,53,0,17,93,93,93,93,93,93,93,53,53,0,0,2,255,254,0,0,6,86,5,182,0,15,
+0,19,0,132,64,42,6,19,10,14,90,1,17,1,16,3,4,19,169,19,1,36,19,52,19,84,19,
+3,16,1,1,20,12,1,19,1,12,12,1,19,3,5,8,0,103,21,4,5,184,255,240,64,32,5,9,
+19,95,6,3,95,16,13,95,10,79,10,1,15,10,175,10,2,8,16,10,16,10,6,3,4,14,95,
+5,1,18,0,63,51,225,47,63,57,57,47,47,94,93,113,16,225,16,225,16,225,50,1,
+47,56,51,16,230,50,17,23,57,47,47,47,93,93,93,93,125,135,196,196,17,1,51,
+16,225,50,17,51,49,48,33,33,17,33,3,35,1,33,21,33,17,33,21,33,17,33,1,33,
+17,35,6,86,253,8,254,37,203,186,2,143,3,201,253,195,2,22,253,234,2,61,251,
+117,1,147,108,1,197,254,59,5,182,164,254,60,162,253,248,1,198,2,168,0,255,
+255,0,125,254,20,4,152,5,203,2,38,0,38,0,0,1,7,0,122,1,252,0,0,0,11,182,1,
+79,42,36,24,32,37,1,43,53,0,255,255,0,199,0,0,3,190,7,115,2,38,0,40,0,0,1,
+7,0,67,255,183,1,82,0,21,180,1,12,5,38,1,184,255,194,180,18,12,1,0,37,1,43,
+53,0,43,53,0,255,255,0,199,0,0,3,190,7,115,2,38,0,40,0,0,1,7,0,118,0,63,1,
+82,0,19,64,11,1,24,5,38,1,74,12,18,1,0,37,1,43,53,0,43,53,0,255,255,0,199,
+0,0,3,190,7,115,2,38,0,40,0,0,1,7,1,75,255,241,1,82,0,21,180,1,12,5,38,1,
+184,255,253,180,20,12,1,0,37,1,43,53,0,43,53,0,255,255,0,199,0,0,3,190,7,
+43,2,38,0,40,0,0,1,7,0,106,255,245,1,82,0,23,64,13,2,1,21,5,38,2,1,1,12,32,
+1,0,37,1,43,53,53,0,43,53,53,0,255,255,0,62,0,0,2,100,7,115,2,38,0,44,0,0,
+1,7,0,67,254,181,1,82,0,21,180,1,12,5,38,1,184,255,168,180,18,12,1,0,37,1,
+43,53,0,43,53,0,255,255,0,82,0,0,2,138,7,115,2,38,0,44,0,0,1,7,0,118,255,
+120,1,82,0,19,64,11,1,24,5,38,1,106,12,18,1,0,37,1,43,53,0,43,53,0,255,255,
+0,17,0,0,2,169,7,115,2,38,0,44,0,0,1,7,1,75,255,15,1,82,0,19,64,11,1,12,5,
+38,1,2,20,12,1,0,37,1,43,53,0,43,53,0,255,255,0,64,0,0,2,119,7,43,2,38,0,
+44,0,0,1,7,0,106,255,13,1,82,0,23,64,13,2,1,21,5,38,2,1,0,12,32,1,0,37,1,
+43,53,53,0,43,53,53,0,0,2,0,47,0,0,4,252,5,182,0,16,0,31,0,93,64,58,26,26,
+14,17,91,8,103,33,32,33,1,24,28,90,14,16,16,1,14,100,32,27,16,95,24,15,0,
+1,15,0,63,0,111,0,175,0,223,0,255,0,6,8,0,64,26,29,72,0,0,2,28,96,14,18,23,
+96,2,3,0,63,225,63,225,17,57,47,43,94,93,113,51,225,50,1,16,230,50,50,47,
+16,225,50,93,16,246,225,17,57,47,49,48,19,51,17,33,50,22,22,18,21,20,2,6,
+4,35,33,17,35,37,52,46,2,35,35,17,33,21,33,17,51,32,0,47,152,1,151,153,248,
+174,95,96,182,254,247,168,254,146,152,4,8,66,126,184,117,201,1,80,254,176,
+162,1,8,1,12,3,37,2,145,92,181,254,244,176,185,254,233,187,94,2,131,96,146,
+213,138,67,254,14,162,254,29,1,36,255,255,0,199,0,0,5,14,7,53,2,38,0,49,0,
+0,1,7,1,82,0,139,1,82,0,19,64,11,1,32,5,38,1,10,33,47,10,0,37,1,43,53,0,43,
+53,0,255,255,0,125,255,236,5,113,7,115,2,38,0,50,0,0,1,7,0,67,0,84,1,82,0,
+21,180,2,40,5,38,2,184,255,171,180,46,40,10,0,37,1,43,53,0,43,53,0,255,255,
+0,125,255,236,5,113,7,115,2,38,0,50,0,0,1,7,0,118,1,2,1,82,0,19,64,11,2,52,
+5,38,2,88,40,46,10,0,37,1,43,53,0,43,53,0,255,255,0,125,255,236,5,113,7,115,
+2,38,0,50,0,0,1,7,1,75,0,174,1,82,0,19,64,11,2,40,5,38,2,5,48,40,10,0,37,
+1,43,53,0,43,53,0,255,255,0,125,255,236,5,113,7,53,2,38,0,50,0,0,1,7,1,82,
+0,125,1,82,0,21,180,2,48,5,38,2,184,255,240,180,49,63,10,0,37,1,43,53,0,43,
+53,0,255,255,0,125,255,236,5,113,7,43,2,38,0,50,0,0,1,7,0,106,0,170,1,82,
+0,23,64,13,3,2,49,5,38,3,2,1,40,60,10,0,37,1,43,53,53,0,43,53,53,0,0,1,0,
+141,1,45,3,221,4,123,0,11,0,135,185,0,6,255,240,179,20,23,72,6,184,255,224,
+64,24,15,18,72,0,16,20,23,72,0,32,15,18,72,9,16,20,23,72,9,32,15,18,72,3,
+184,255,240,179,20,23,72,3,184,255,224,64,48,15,18,72,64,13,1,7,5,5,3,11,
+1,1,80,3,1,3,8,10,10,4,2,2,32,0,1,0,0,32,0,80,0,112,0,128,0,160,0,192,0,208,
+0,240,0,9,6,0,179,0,25,63,94,93,113,50,17,51,50,17,51,1,47,93,51,17,51,17,
+51,17,51,93,49,48,0,43,43,43,43,1,43,43,43,43,1,1,55,1,1,23,1,1,7,1,1,39,
+1,203,254,194,105,1,61,1,66,104,254,191,1,63,102,254,190,254,195,103,2,211,
+1,63,105,254,194,1,62,103,254,191,254,192,102,1,61,254,197,103,0,0,3,0,125,
+255,180,5,113,5,252,0,26,0,38,0,49,0,92,64,58,41,31,42,30,4,27,39,91,1,25,
+11,14,4,17,4,103,51,192,51,1,191,51,1,112,51,1,47,51,95,51,2,27,91,17,102,
+50,31,41,30,42,4,45,34,95,25,1,14,11,4,9,26,22,4,45,95,12,9,19,0,63,51,225,
+63,51,18,23,57,225,17,23,57,1,16,246,225,93,93,93,93,16,246,17,23,57,225,
+17,23,57,49,48,1,7,22,18,21,20,2,6,6,35,34,39,7,39,55,38,2,53,52,18,54,54,
+51,50,22,23,55,1,20,22,23,1,38,38,35,34,14,2,5,16,39,1,22,22,51,50,62,2,5,
+20,92,91,94,81,160,237,155,189,133,78,137,90,97,91,76,158,240,163,94,161,
+66,80,252,183,46,48,2,67,48,114,71,114,166,108,52,3,106,88,253,190,47,114,
+69,114,165,107,50,5,174,149,99,254,222,183,169,254,234,198,108,71,127,78,
+145,100,1,42,190,170,1,21,196,107,42,38,127,252,225,131,209,78,3,177,29,32,
+81,151,218,138,1,1,151,252,84,28,30,81,153,219,255,255,0,184,255,236,4,221,
+7,115,2,38,0,56,0,0,1,7,0,67,0,61,1,82,0,21,180,1,24,5,38,1,184,255,192,180,
+30,24,11,0,37,1,43,53,0,43,53,0,255,255,0,184,255,236,4,221,7,115,2,38,0,
+56,0,0,1,7,0,118,0,197,1,82,0,19,64,11,1,36,5,38,1,72,24,30,11,0,37,1,43,
+53,0,43,53,0,255,255,0,184,255,236,4,221,7,115,2,38,0,56,0,0,1,7,1,75,0,121,
+1,82,0,21,180,1,24,5,38,1,184,255,253,180,32,24,11,0,37,1,43,53,0,43,53,0,
+255,255,0,184,255,236,4,221,7,43,2,38,0,56,0,0,1,7,0,106,0,125,1,82,0,23,
+64,13,2,1,33,5,38,2,1,1,24,44,11,0,37,1,43,53,53,0,43,53,53,0,255,255,0,0,
+0,0,4,55,7,115,2,38,0,60,0,0,1,7,0,118,0,49,1,82,0,19,64,11,1,21,5,38,1,99,
+9,15,7,2,37,1,43,53,0,43,53,0,0,2,0,199,0,0,4,51,5,182,0,16,0,27,0,60,64,
+33,23,91,0,103,29,159,29,1,16,29,1,17,11,7,90,8,100,28,17,96,6,27,96,11,6,
+11,6,11,7,9,3,7,18,0,63,63,18,57,57,47,47,16,225,16,225,1,16,246,225,50,50,
+93,93,16,246,225,49,48,1,20,14,2,35,35,17,35,17,51,21,51,50,30,2,1,51,50,
+62,2,53,52,38,35,35,4,51,55,126,207,152,150,186,186,176,134,194,126,60,253,
+78,129,93,139,91,46,164,174,160,3,14,91,168,129,77,254,195,5,182,252,57,109,
+160,254,103,32,71,113,81,143,136,0,0,1,0,174,255,236,4,117,6,31,0,75,0,109,
+64,72,7,70,46,53,71,0,15,25,31,25,47,25,3,25,64,13,19,72,95,46,111,46,2,15,
+0,31,0,47,0,3,8,25,46,0,0,46,25,3,65,36,71,17,87,77,16,77,32,77,192,77,3,
+64,71,65,84,76,36,7,53,3,22,58,80,71,1,65,21,31,80,26,22,22,0,63,51,225,63,
+63,225,18,23,57,1,16,246,225,93,16,246,225,18,23,57,47,47,47,94,93,93,43,
+93,16,225,16,225,49,48,1,20,14,4,21,20,30,2,23,30,3,21,20,14,2,35,34,38,39,
+53,30,3,51,50,62,2,53,52,46,2,39,46,3,53,52,62,4,53,52,46,2,35,34,14,2,21,
+17,35,17,52,62,2,51,50,30,2,3,242,43,63,75,63,43,14,39,70,57,56,88,61,33,
+56,101,141,85,97,139,53,26,65,72,76,37,56,81,52,24,17,43,72,56,63,85,53,22,
+41,62,72,62,41,33,60,83,51,49,88,66,39,182,63,113,156,92,92,152,108,60,4,
+236,57,89,73,60,55,54,30,21,33,39,49,38,37,72,82,96,62,87,126,81,39,35,34,
+166,16,31,24,15,25,45,64,40,36,59,56,58,35,40,68,67,70,42,54,79,63,54,58,
+67,44,42,62,41,19,19,48,83,65,251,78,4,176,104,141,85,37,38,76,116,255,255,
+0,94,255,236,3,156,6,33,2,38,0,68,0,0,1,6,0,67,148,0,0,21,180,2,51,17,38,
+2,184,255,229,180,57,51,12,34,37,1,43,53,0,43,53,0,255,255,0,94,255,236,3,
+156,6,33,2,38,0,68,0,0,1,6,0,118,53,0,0,19,64,11,2,63,17,38,2,133,51,57,12,
+34,37,1,43,53,0,43,53,0,255,255,0,94,255,236,3,156,6,33,2,38,0,68,0,0,1,6,
+1,75,226,0,0,19,64,11,2,51,17,38,2,51,59,51,12,34,37,1,43,53,0,43,53,0,255,
+255,0,94,255,236,3,156,5,227,2,38,0,68,0,0,1,6,1,82,189,0,0,19,64,11,2,59,
+17,38,2,41,60,74,12,34,37,1,43,53,0,43,53,0,255,255,0,94,255,236,3,156,5,
+217,2,38,0,68,0,0,1,6,0,106,222,0,0,23,64,13,3,2,60,17,38,3,2,47,51,71,12,
+34,37,1,43,53,53,0,43,53,53,0,255,255,0,94,255,236,3,156,6,135,2,38,0,68,
+0,0,1,6,1,80,222,0,0,23,64,13,3,2,56,17,38,3,2,48,61,51,12,34,37,1,43,53,
+53,0,43,53,53,0,0,3,0,94,255,236,6,68,4,94,0,56,0,71,0,80,0,124,64,26,47,
+20,75,30,72,4,66,66,0,76,72,38,29,87,82,79,82,95,82,159,82,3,57,72,0,14,184,
+255,192,64,46,13,17,72,14,14,0,86,81,0,66,16,66,2,66,30,80,0,4,16,4,2,4,15,
+75,31,75,2,7,75,75,17,33,60,80,47,44,52,22,72,13,10,80,23,20,17,16,0,63,51,
+51,225,50,50,63,51,51,225,50,17,57,47,94,93,51,93,225,50,93,1,16,230,50,47,
+43,16,225,93,16,246,50,225,17,57,47,51,225,50,57,57,49,48,19,52,54,55,55,
+53,52,46,2,35,34,6,7,39,54,54,51,50,22,23,54,54,51,50,30,2,21,21,33,22,22,
+51,50,62,2,55,21,14,3,35,34,38,39,14,3,35,34,46,2,55,20,22,51,50,62,2,53,
+53,7,14,3,1,34,6,7,33,52,46,2,94,231,236,184,29,55,81,52,83,143,66,64,74,
+182,100,131,166,43,51,166,103,97,154,108,57,253,96,5,147,147,49,85,78,74,
+37,39,75,79,85,49,138,202,62,34,76,95,116,74,71,123,90,52,189,97,79,61,104,
+76,43,143,90,122,73,32,3,133,110,127,11,1,215,26,55,84,1,51,164,176,8,7,69,
+67,90,55,24,48,34,137,40,56,85,93,85,93,71,129,181,110,113,193,182,10,19,
+29,18,162,19,28,18,8,114,115,54,85,59,31,39,81,123,82,92,86,38,77,117,79,
+99,7,4,32,57,81,2,99,156,149,68,113,80,44,0,255,255,0,113,254,20,3,111,4,
+94,2,38,0,70,0,0,1,7,0,122,1,66,0,0,0,11,182,1,47,38,32,5,13,37,1,43,53,0,
+255,255,0,113,255,236,3,225,6,33,2,38,0,72,0,0,1,6,0,67,148,0,0,21,180,2,
+40,17,38,2,184,255,185,180,46,40,5,15,37,1,43,53,0,43,53,0,255,255,0,113,
+255,236,3,225,6,33,2,38,0,72,0,0,1,6,0,118,82,0,0,19,64,11,2,52,17,38,2,118,
+40,46,5,15,37,1,43,53,0,43,53,0,255,255,0,113,255,236,3,225,6,33,2,38,0,72,
+0,0,1,6,1,75,222,0,0,19,64,11,2,40,17,38,2,3,48,40,5,15,37,1,43,53,0,43,53,
+0,255,255,0,113,255,236,3,225,5,217,2,38,0,72,0,0,1,6,0,106,218,0,0,23,64,
+13,3,2,49,17,38,3,2,0,40,60,5,15,37,1,43,53,53,0,43,53,53,0,255,255,255,222,
+0,0,1,103,6,33,2,38,0,243,0,0,1,7,0,67,254,85,0,0,0,21,180,1,4,17,38,1,184,
+255,154,180,10,4,1,0,37,1,43,53,0,43,53,0,255,255,0,174,0,0,2,66,6,33,2,38,
+0,243,0,0,1,7,0,118,255,48,0,0,0,19,64,11,1,16,17,38,1,116,4,10,1,0,37,1,
+43,53,0,43,53,0,255,255,255,189,0,0,2,85,6,33,2,38,0,243,0,0,1,7,1,75,254,
+187,0,0,0,19,64,11,1,4,17,38,1,0,12,4,1,0,37,1,43,53,0,43,53,0,255,255,255,
+238,0,0,2,37,5,217,2,38,0,243,0,0,1,7,0,106,254,187,0,0,0,23,64,13,2,1,13,
+17,38,2,1,0,4,24,1,0,37,1,43,53,53,0,43,53,53,0,0,2,0,111,255,236,4,45,6,
+35,0,39,0,57,0,116,64,70,18,40,72,0,35,32,22,25,4,28,34,24,28,34,34,28,24,
+3,10,0,87,59,64,59,208,59,224,59,3,15,59,1,6,50,72,10,86,58,32,25,35,22,4,
+23,33,33,29,45,80,15,18,15,175,15,191,15,2,48,15,1,23,15,23,15,29,1,55,80,
+5,22,0,63,225,63,57,57,47,47,93,93,17,51,16,225,17,51,17,18,23,57,1,16,246,
+225,94,93,93,16,230,17,23,57,47,47,47,17,18,23,57,16,225,50,49,48,1,20,14,
+2,35,34,46,2,53,52,62,2,51,50,22,23,55,38,38,39,5,39,55,38,38,39,55,22,22,
+23,55,23,7,30,3,7,52,46,2,35,34,14,2,21,20,30,2,51,50,54,4,45,67,125,178,
+111,104,175,127,71,63,118,168,105,102,154,43,8,31,120,90,255,0,74,217,40,
+85,47,70,65,122,59,227,74,195,67,111,79,44,188,34,70,110,75,77,109,70,33,
+33,71,109,76,154,135,2,61,142,220,152,79,66,127,185,119,119,184,126,65,59,
+60,4,118,192,81,153,114,131,28,55,26,123,32,72,44,138,113,117,65,156,187,
+221,176,56,107,82,50,46,88,131,85,76,125,90,49,199,0,255,255,0,174,0,0,4,
+18,5,227,2,38,0,81,0,0,1,6,1,82,249,0,0,19,64,11,1,33,17,38,1,2,34,48,11,
+23,37,1,43,53,0,43,53,0,255,255,0,113,255,236,4,45,6,33,2,38,0,82,0,0,1,6,
+0,67,216,0,0,21,180,2,32,17,38,2,184,255,215,180,38,32,10,0,37,1,43,53,0,
+43,53,0,255,255,0,113,255,236,4,45,6,33,2,38,0,82,0,0,1,6,0,118,80,0,0,19,
+64,11,2,44,17,38,2,78,32,38,10,0,37,1,43,53,0,43,53,0,255,255,0,113,255,236,
+4,45,6,33,2,38,0,82,0,0,1,6,1,75,251,0,0,21,180,2,32,17,38,2,184,255,250,
+180,40,32,10,0,37,1,43,53,0,43,53,0,255,255,0,113,255,236,4,45,5,227,2,38,
+0,82,0,0,1,6,1,82,226,0,0,21,180,2,40,17,38,2,184,255,253,180,41,55,10,0,
+37,1,43,53,0,43,53,0,255,255,0,113,255,236,4,45,5,217,2,38,0,82,0,0,1,6,0,
+106,249,0,0,25,182,3,2,41,17,38,3,2,184,255,249,180,32,52,10,0,37,1,43,53,
+53,0,43,53,53,0,0,3,0,102,0,248,4,2,4,172,0,3,0,23,0,43,0,96,64,21,48,45,
+1,34,170,24,24,14,170,86,3,102,3,2,40,3,56,3,2,3,0,184,255,240,64,40,9,13,
+72,0,4,39,173,16,29,1,15,29,1,29,29,1,9,173,0,19,16,19,32,19,96,19,176,19,
+192,19,208,19,7,7,19,19,0,173,1,179,0,63,225,51,47,94,93,225,17,51,47,93,
+113,225,1,47,51,43,51,93,93,225,51,47,225,93,49,48,19,53,33,21,1,52,62,2,
+51,50,30,2,21,20,14,2,35,34,46,2,17,52,62,2,51,50,30,2,21,20,14,2,35,34,46,
+2,102,3,156,253,191,18,31,41,24,23,42,32,18,18,32,42,23,24,41,31,18,18,31,
+41,24,23,42,32,18,18,32,42,23,24,41,31,18,2,135,150,150,254,238,35,47,30,
+13,13,30,47,35,33,47,31,14,14,31,47,2,219,35,47,30,13,13,30,47,35,33,47,31,
+14,14,31,47,0,0,3,0,115,255,180,4,47,4,145,0,26,0,36,0,45,0,92,64,59,39,31,
+40,30,4,27,37,72,23,24,22,21,7,8,10,9,8,13,0,87,47,64,47,208,47,224,47,3,
+15,47,1,6,27,72,13,86,46,40,30,39,31,4,43,34,80,7,10,24,21,4,5,22,18,16,43,
+80,8,5,22,0,63,198,225,63,198,18,23,57,225,17,23,57,1,16,246,225,94,93,93,
+16,246,17,23,57,225,17,23,57,49,48,1,20,14,2,35,34,39,7,39,55,38,38,53,52,
+62,2,51,50,22,23,55,23,7,22,22,5,20,22,23,1,38,38,35,34,6,5,52,39,1,22,22,
+51,50,54,4,47,67,125,178,111,125,98,68,131,80,63,70,67,124,179,111,63,113,
+49,68,131,80,62,69,253,0,19,22,1,141,29,75,45,154,135,2,68,39,254,114,31,
+72,45,154,135,2,39,137,213,145,76,53,109,74,131,72,213,137,136,211,145,75,
+29,28,108,73,129,73,209,134,84,131,51,2,135,17,18,207,209,159,99,253,123,
+17,16,211,0,255,255,0,164,255,236,4,8,6,33,2,38,0,88,0,0,1,6,0,67,163,0,0,
+21,180,1,27,17,38,1,184,255,155,180,33,27,12,25,37,1,43,53,0,43,53,0,255,
+255,0,164,255,236,4,8,6,33,2,38,0,88,0,0,1,6,0,118,96,0,0,19,64,11,1,39,17,
+38,1,87,27,33,12,25,37,1,43,53,0,43,53,0,255,255,0,164,255,236,4,8,6,33,2,
+38,0,88,0,0,1,6,1,75,8,0,0,19,64,11,1,27,17,38,1,0,35,27,12,25,37,1,43,53,
+0,43,53,0,255,255,0,164,255,236,4,8,5,217,2,38,0,88,0,0,1,6,0,106,2,0,0,25,
+182,2,1,36,17,38,2,1,184,255,251,180,27,47,12,25,37,1,43,53,53,0,43,53,53,
+0,255,255,0,10,254,20,3,223,6,33,2,38,0,92,0,0,1,6,0,118,14,0,0,19,64,11,
+1,47,17,38,1,103,35,41,0,15,37,1,43,53,0,43,53,0,0,2,0,174,254,20,4,63,6,
+20,0,32,0,49,0,56,64,31,47,72,10,87,51,16,51,1,39,32,31,21,27,71,28,84,50,
+29,0,27,27,44,80,21,15,22,33,80,0,5,16,0,63,51,225,63,51,225,63,63,1,16,246,
+225,50,50,50,50,93,16,246,225,49,48,1,62,3,51,50,30,2,21,20,14,2,35,34,46,
+2,39,35,22,23,22,22,21,17,35,17,51,17,7,37,34,14,2,7,21,20,30,2,51,50,54,
+53,52,38,1,100,23,58,77,96,60,94,154,109,60,60,109,154,94,59,96,77,59,23,
+12,3,3,2,4,182,182,8,1,31,76,105,65,31,2,27,65,108,81,135,127,127,3,182,35,
+61,45,27,72,143,212,140,141,213,144,73,26,43,58,32,34,31,26,55,16,254,43,
+8,0,254,54,148,17,46,94,140,95,41,101,157,107,55,218,204,208,206,0,255,255,
+0,10,254,20,3,223,5,217,2,38,0,92,0,0,1,6,0,106,177,0,0,23,64,13,2,1,44,17,
+38,2,1,11,35,55,0,15,37,1,43,53,53,0,43,53,53,0,255,255,0,0,0,0,4,221,6,193,
+2,38,0,36,0,0,1,7,1,77,0,51,1,82,0,21,180,2,23,5,38,2,184,255,255,180,21,
+22,4,7,37,1,43,53,0,43,53,0,255,255,0,94,255,236,3,156,5,111,2,38,0,68,0,
+0,1,6,1,77,230,0,0,19,64,11,2,53,17,38,2,35,51,52,12,34,37,1,43,53,0,43,53,
+0,255,255,0,0,0,0,4,221,7,64,2,38,0,36,0,0,1,7,1,78,0,33,1,82,0,19,64,11,
+2,26,5,38,2,0,31,21,4,7,37,1,43,53,0,43,53,0,255,255,0,94,255,236,3,156,5,
+238,2,38,0,68,0,0,1,6,1,78,212,0,0,19,64,11,2,56,17,38,2,37,61,51,12,34,37,
+1,43,53,0,43,53,0,255,255,0,0,254,66,4,221,5,188,2,38,0,36,0,0,1,7,1,81,3,
+98,0,0,0,20,64,13,2,128,39,1,48,39,1,0,39,39,0,0,37,1,43,93,93,53,255,255,
+0,94,254,66,3,184,4,94,2,38,0,68,0,0,1,7,1,81,2,90,0,0,0,32,64,22,2,240,69,
+1,160,69,1,144,69,1,128,69,1,48,69,1,0,69,69,0,0,37,1,43,93,93,93,93,93,53,
+255,255,0,125,255,236,4,152,7,115,2,38,0,38,0,0,1,7,0,118,1,10,1,82,0,19,
+64,11,1,48,5,38,1,205,36,42,24,32,37,1,43,53,0,43,53,0,255,255,0,113,255,
+236,3,111,6,33,2,38,0,70,0,0,1,6,0,118,74,0,0,23,64,14,1,44,17,38,1,16,32,
+1,167,32,38,5,13,37,1,43,93,53,0,43,53,0,255,255,0,125,255,236,4,152,7,115,
+2,38,0,38,0,0,1,7,1,75,0,180,1,82,0,19,64,11,1,36,5,38,1,119,44,36,24,32,
+37,1,43,53,0,43,53,0,255,255,0,113,255,236,3,143,6,33,2,38,0,70,0,0,1,6,1,
+75,245,0,0,23,64,14,1,32,17,38,1,16,40,1,83,40,32,5,13,37,1,43,93,53,0,43,
+53,0,255,255,0,125,255,236,4,152,7,55,2,38,0,38,0,0,1,7,1,79,2,0,1,82,0,19,
+64,11,1,47,5,38,1,128,36,44,24,32,37,1,43,53,0,43,53,0,255,255,0,113,255,
+236,3,111,5,229,2,38,0,70,0,0,1,7,1,79,1,51,0,0,0,23,64,14,1,43,17,38,1,16,
+32,1,77,32,40,5,13,37,1,43,93,53,0,43,53,0,255,255,0,125,255,236,4,152,7,
+115,2,38,0,38,0,0,1,7,1,76,0,168,1,82,0,19,64,11,1,41,5,38,1,107,47,36,24,
+32,37,1,43,53,0,43,53,0,255,255,0,113,255,236,3,160,6,33,2,38,0,70,0,0,1,
+6,1,76,6,0,0,23,64,14,1,37,17,38,1,16,43,1,100,43,32,5,13,37,1,43,93,53,0,
+43,53,0,255,255,0,199,0,0,4,252,7,115,2,38,0,39,0,0,1,7,1,76,0,74,1,82,0,
+21,180,2,29,5,38,2,184,255,183,180,35,24,6,0,37,1,43,53,0,43,53,0,255,255,
+0,113,255,236,5,82,6,20,2,38,0,71,0,0,1,7,2,56,2,217,0,0,0,11,182,2,94,62,
+62,29,29,37,1,43,53,0,255,255,0,47,0,0,4,252,5,182,2,6,0,146,0,0,0,2,0,113,
+255,236,4,158,6,20,0,39,0,56,0,85,64,49,31,27,0,45,71,38,29,29,11,34,38,85,
+58,16,58,1,54,72,11,86,57,39,21,37,29,79,34,30,30,16,32,0,51,80,22,0,16,16,
+16,32,16,3,16,16,40,80,0,6,22,0,63,51,225,63,93,51,225,63,18,57,47,51,225,
+50,63,1,16,246,225,93,16,230,50,17,57,47,16,225,50,50,50,49,48,37,35,14,3,
+35,34,46,2,53,52,62,2,51,50,30,2,23,51,38,39,38,38,53,53,33,53,33,53,51,21,
+51,21,35,17,35,37,50,62,2,55,53,52,46,2,35,34,6,21,20,22,3,84,8,22,59,77,
+96,60,93,154,110,60,60,110,154,93,59,96,77,60,22,12,3,3,2,4,254,133,1,123,
+182,156,156,147,254,198,76,105,65,31,2,27,65,108,81,135,127,127,147,34,61,
+46,26,70,138,204,134,135,206,139,71,25,44,58,32,33,31,26,55,16,158,137,182,
+182,137,251,43,131,44,89,133,90,39,97,149,102,52,207,195,198,195,255,255,
+0,199,0,0,3,190,6,193,2,38,0,40,0,0,1,7,1,77,0,10,1,82,0,19,64,11,1,14,5,
+38,1,2,12,13,1,0,37,1,43,53,0,43,53,0,255,255,0,113,255,236,3,225,5,111,2,
+38,0,72,0,0,1,6,1,77,0,0,0,19,64,11,2,42,17,38,2,17,40,41,5,15,37,1,43,53,
+0,43,53,0,255,255,0,199,0,0,3,190,7,64,2,38,0,40,0,0,1,7,1,78,255,251,1,82,
+0,19,64,11,1,17,5,38,1,6,22,12,1,0,37,1,43,53,0,43,53,0,255,255,0,113,255,
+236,3,225,5,238,2,38,0,72,0,0,1,6,1,78,234,0,0,19,64,11,2,45,17,38,2,15,50,
+40,5,15,37,1,43,53,0,43,53,0,255,255,0,199,0,0,3,190,7,26,2,38,0,40,0,0,1,
+7,1,79,1,63,1,53,0,19,64,11,1,23,5,38,1,7,12,20,1,0,37,1,43,53,0,43,53,0,
+255,255,0,113,255,236,3,225,5,229,2,38,0,72,0,0,1,7,1,79,1,43,0,0,0,19,64,
+11,2,51,17,38,2,12,40,48,5,15,37,1,43,53,0,43,53,0,255,255,0,199,254,66,3,
+190,5,182,2,38,0,40,0,0,1,7,1,81,2,33,0,0,0,14,185,0,1,255,193,180,18,18,
+0,0,37,1,43,53,255,255,0,113,254,97,3,225,4,94,2,38,0,72,0,0,1,7,1,81,2,59,
+0,31,0,39,64,19,2,240,59,1,224,59,1,160,59,1,144,59,1,80,59,1,0,59,1,184,
+255,202,180,59,59,26,26,37,1,43,93,93,93,93,93,93,53,0,255,255,0,199,0,0,
+3,190,7,115,2,38,0,40,0,0,1,7,1,76,255,249,1,82,0,19,64,11,1,17,5,38,1,4,
+23,12,1,0,37,1,43,53,0,43,53,0,255,255,0,113,255,236,3,225,6,33,2,38,0,72,
+0,0,1,6,1,76,228,0,0,19,64,11,2,45,17,38,2,9,51,40,5,15,37,1,43,53,0,43,53,
+0,255,255,0,125,255,236,4,242,7,115,2,38,0,42,0,0,1,7,1,75,0,215,1,82,0,19,
+64,11,1,44,5,38,1,109,52,44,12,1,37,1,43,53,0,43,53,0,255,255,0,37,254,20,
+3,252,6,33,2,38,0,74,0,0,1,6,1,75,198,0,0,19,64,11,3,95,17,38,3,3,103,95,
+39,0,37,1,43,53,0,43,53,0,255,255,0,125,255,236,4,242,7,64,2,38,0,42,0,0,
+1,7,1,78,0,201,1,82,0,19,64,11,1,49,5,38,1,95,54,44,12,1,37,1,43,53,0,43,
+53,0,255,255,0,37,254,20,3,252,5,238,2,38,0,74,0,0,1,6,1,78,177,0,0,21,180,
+3,100,17,38,3,184,255,239,180,105,95,39,0,37,1,43,53,0,43,53,0,255,255,0,
+125,255,236,4,242,7,55,2,38,0,42,0,0,1,7,1,79,2,12,1,82,0,19,64,11,1,55,5,
+38,1,95,44,52,12,1,37,1,43,53,0,43,53,0,255,255,0,37,254,20,3,252,5,229,2,
+38,0,74,0,0,1,7,1,79,0,242,0,0,0,21,180,3,106,17,38,3,184,255,236,180,95,
+103,39,0,37,1,43,53,0,43,53,0,255,255,0,125,254,59,4,242,5,203,2,38,0,42,
+0,0,1,7,2,57,1,23,0,0,0,11,182,1,81,44,50,12,1,37,1,43,53,0,255,255,0,37,
+254,20,3,252,6,33,2,38,0,74,0,0,1,6,2,58,45,0,0,19,64,11,3,100,17,38,3,28,
+101,95,39,0,37,1,43,53,0,43,53,0,255,255,0,199,0,0,4,213,7,115,2,38,0,43,
+0,0,1,7,1,75,0,127,1,82,0,21,180,1,12,5,38,1,184,255,255,180,20,12,5,0,37,
+1,43,53,0,43,53,0,255,255,0,174,0,0,4,18,7,170,2,38,0,75,0,0,1,7,1,75,0,43,
+1,137,0,31,64,20,112,13,1,112,12,1,1,112,26,1,26,2,38,1,25,34,26,11,24,37,
+1,43,53,0,43,93,53,93,93,0,0,2,0,0,0,0,5,156,5,182,0,19,0,23,0,86,64,47,20,
+4,12,90,7,11,101,25,176,25,1,175,25,1,16,25,1,23,3,15,90,0,16,100,24,14,95,
+23,22,10,18,96,19,7,3,19,23,19,23,19,1,16,11,18,5,1,3,0,63,51,63,51,18,57,
+57,47,47,17,51,51,16,225,50,50,16,225,1,16,246,50,225,50,50,93,93,93,16,246,
+50,225,50,50,49,48,19,53,51,21,33,53,51,21,51,21,35,17,35,17,33,17,35,17,
+35,53,1,53,33,21,199,186,2,154,186,199,199,186,253,102,186,199,4,27,253,102,
+4,195,243,243,243,243,150,251,211,2,170,253,86,4,45,150,254,139,223,223,0,
+1,0,18,0,0,4,18,6,20,0,33,0,85,64,52,19,11,0,71,33,85,35,16,35,96,35,128,
+35,3,23,22,18,10,71,15,11,84,34,21,13,79,18,191,14,207,14,2,14,14,16,23,4,
+80,0,29,16,29,32,29,3,29,16,16,0,11,0,21,0,63,50,63,63,93,225,51,18,57,47,
+93,51,225,50,1,16,246,50,225,50,50,50,93,16,246,225,18,57,49,48,33,17,52,
+38,35,34,14,2,21,17,35,17,35,53,51,53,51,21,33,21,33,21,7,51,62,3,51,50,22,
+21,17,3,92,105,112,81,110,67,29,182,156,156,182,1,123,254,133,8,10,25,69,
+82,92,48,183,185,2,154,130,130,52,102,148,96,253,240,4,213,137,182,182,137,
+184,144,43,63,42,20,191,210,253,92,0,255,255,255,245,0,0,2,196,7,53,2,38,
+0,44,0,0,1,7,1,82,254,243,1,82,0,19,64,11,1,20,5,38,1,1,21,35,1,0,37,1,43,
+53,0,43,53,0,255,255,255,163,0,0,2,114,5,227,2,38,0,243,0,0,1,7,1,82,254,
+161,0,0,0,19,64,11,1,12,17,38,1,1,13,27,1,0,37,1,43,53,0,43,53,0,255,255,
+0,61,0,0,2,124,6,193,2,38,0,44,0,0,1,7,1,77,255,34,1,82,0,19,64,11,1,14,5,
+38,1,1,12,13,1,0,37,1,43,53,0,43,53,0,255,255,255,235,0,0,2,42,5,111,2,38,
+0,243,0,0,1,7,1,77,254,208,0,0,0,19,64,11,1,6,17,38,1,1,4,5,1,0,37,1,43,53,
+0,43,53,0,255,255,0,48,0,0,2,138,7,64,2,38,0,44,0,0,1,7,1,78,255,15,1,82,
+0,19,64,11,1,17,5,38,1,2,22,12,1,0,37,1,43,53,0,43,53,0,255,255,255,222,0,
+0,2,56,5,238,2,38,0,243,0,0,1,7,1,78,254,189,0,0,0,19,64,11,1,9,17,38,1,2,
+14,4,1,0,37,1,43,53,0,43,53,0,255,255,0,82,254,66,2,100,5,182,2,38,0,44,0,
+0,1,7,1,81,0,156,0,0,0,11,182,1,0,25,18,1,0,37,1,43,53,0,255,255,0,68,254,
+66,1,131,5,229,2,38,0,76,0,0,1,6,1,81,37,0,0,16,64,10,2,111,37,1,0,37,37,
+0,0,37,1,43,93,53,255,255,0,82,0,0,2,100,7,55,2,38,0,44,0,0,1,7,1,79,0,80,
+1,82,0,19,64,11,1,23,5,38,1,0,12,20,1,0,37,1,43,53,0,43,53,0,0,1,0,174,0,
+0,1,100,4,74,0,3,0,26,64,14,16,5,32,5,2,0,71,1,84,4,2,15,0,21,0,63,63,1,16,
+246,225,93,49,48,33,35,17,51,1,100,182,182,4,74,255,255,0,82,254,123,4,41,
+5,182,0,38,0,44,0,0,1,7,0,45,2,182,0,0,0,56,64,14,1,24,127,24,1,79,24,1,24,
+64,7,7,72,24,184,255,192,64,23,6,6,72,191,33,1,160,33,1,143,33,1,80,33,1,
+15,33,1,33,64,7,7,72,43,93,93,93,93,93,43,43,93,93,17,53,255,255,0,160,254,
+20,3,135,5,229,0,38,0,76,0,0,1,7,0,77,2,18,0,0,0,46,64,32,3,2,30,207,30,1,
+223,53,1,159,53,1,128,53,1,95,53,1,64,53,1,32,53,1,0,53,1,53,64,6,6,72,43,
+93,93,93,93,93,93,93,93,17,53,53,255,255,255,72,254,123,2,100,7,115,2,38,
+0,45,0,0,1,7,1,75,254,202,1,82,0,19,64,11,1,20,5,38,1,0,28,20,13,14,37,1,
+43,53,0,43,53,0,255,255,255,188,254,20,2,87,6,33,2,38,2,55,0,0,1,7,1,75,254,
+189,0,0,0,19,64,11,1,20,17,38,1,0,28,20,13,14,37,1,43,53,0,43,53,0,255,255,
+0,199,254,59,4,162,5,182,2,38,0,46,0,0,1,6,2,57,115,0,0,14,185,0,1,255,177,
+180,13,19,5,0,37,1,43,53,255,255,0,174,254,59,3,240,6,20,2,38,0,78,0,0,1,
+6,2,57,33,0,0,14,185,0,1,255,196,180,15,21,10,5,37,1,43,53,0,1,0,174,0,0,
+3,240,4,74,0,17,0,73,64,10,1,16,16,14,15,15,68,17,1,17,184,255,192,64,28,
+7,10,72,17,16,17,17,19,15,19,47,19,2,7,7,3,71,4,84,18,12,1,14,5,15,4,0,21,
+0,63,50,63,51,57,57,1,16,246,225,50,94,93,17,51,47,56,43,93,51,17,51,57,17,
+51,49,48,33,1,7,17,35,17,51,17,20,6,7,6,7,55,1,51,1,1,3,35,254,172,109,180,
+180,5,3,4,4,131,1,51,205,254,111,1,172,1,233,81,254,104,4,74,254,231,60,102,
+38,44,36,176,1,129,254,22,253,160,0,255,255,0,199,0,0,3,190,7,115,2,38,0,
+47,0,0,1,7,0,118,255,101,1,82,0,21,180,1,18,5,38,1,184,255,112,180,6,12,0,
+4,37,1,43,53,0,43,53,0,255,255,0,171,0,0,2,52,7,172,2,38,0,79,0,0,1,7,0,118,
+255,34,1,139,0,31,64,20,112,3,1,112,2,1,1,112,16,1,16,2,38,1,102,4,10,1,0,
+37,1,43,53,0,43,93,53,93,93,0,255,255,0,199,254,59,3,190,5,182,2,38,0,47,
+0,0,1,6,2,57,45,0,0,14,185,0,1,255,221,180,6,12,0,4,37,1,43,53,255,255,0,
+102,254,59,1,108,6,20,2,38,0,79,0,0,1,7,2,57,254,247,0,0,0,14,185,0,1,255,
+224,180,4,10,1,0,37,1,43,53,255,255,0,199,0,0,3,190,5,183,2,38,0,47,0,0,1,
+7,2,56,1,0,255,163,0,22,64,13,1,11,3,1,16,6,1,96,6,12,2,4,37,1,43,93,53,0,
+63,53,255,255,0,174,0,0,2,180,6,20,2,38,0,79,0,0,1,6,2,56,59,0,0,24,64,17,
+1,4,64,14,16,72,4,64,6,9,72,94,4,4,3,3,37,1,43,43,43,53,255,255,0,199,0,0,
+3,190,5,182,2,38,0,47,0,0,1,7,1,79,1,227,253,101,0,11,182,1,171,6,14,0,4,
+37,1,43,53,0,255,255,0,174,0,0,2,162,6,20,0,38,0,79,0,0,1,7,1,79,1,45,253,
+56,0,43,64,22,255,19,1,239,19,1,159,19,1,143,19,1,127,19,1,95,19,1,31,19,
+1,1,184,1,46,180,4,12,1,0,37,1,43,53,93,93,93,93,93,93,93,0,0,1,0,29,0,0,
+3,190,5,182,0,13,0,97,64,50,11,6,5,12,5,0,3,4,13,4,4,5,5,10,8,8,15,175,15,
+1,16,15,1,12,13,13,6,3,7,90,11,0,10,100,14,5,4,13,12,4,12,4,12,1,7,95,10,
+18,1,3,0,63,63,225,18,57,57,47,47,17,51,17,51,1,16,246,50,50,225,50,50,51,
+47,51,93,93,17,51,17,18,57,47,51,16,125,135,4,196,196,16,135,196,196,49,48,
+19,17,51,17,55,23,5,17,33,21,33,17,7,39,199,186,227,78,254,207,2,61,253,9,
+97,73,2,164,3,18,253,99,143,125,190,254,57,166,1,248,60,125,0,0,1,255,246,
+0,0,2,29,6,20,0,11,0,105,64,59,64,13,80,13,2,9,6,5,10,5,0,3,4,11,10,11,11,
+8,4,221,5,1,187,5,203,5,2,15,5,31,5,47,5,3,6,5,5,6,3,7,71,9,0,8,84,12,11,
+10,5,4,10,4,10,4,1,7,21,1,0,0,63,63,18,57,57,47,47,17,51,17,51,1,16,246,50,
+50,225,50,50,50,47,94,93,93,93,51,17,51,47,51,125,135,4,196,196,16,135,196,
+196,1,93,49,48,19,17,51,17,55,23,7,17,35,17,7,39,174,182,107,78,185,182,106,
+78,2,246,3,30,253,89,69,121,120,253,63,2,74,70,121,255,255,0,199,0,0,5,14,
+7,115,2,38,0,49,0,0,1,7,0,118,0,242,1,82,0,19,64,11,1,36,5,38,1,85,24,30,
+10,0,37,1,43,53,0,43,53,0,255,255,0,174,0,0,4,18,6,33,2,38,0,81,0,0,1,6,0,
+118,111,0,0,19,64,11,1,37,17,38,1,92,25,31,11,23,37,1,43,53,0,43,53,0,255,
+255,0,199,254,59,5,14,5,182,2,38,0,49,0,0,1,7,2,57,0,217,0,0,0,14,185,0,1,
+255,225,180,24,30,10,0,37,1,43,53,255,255,0,174,254,59,4,18,4,94,2,38,0,81,
+0,0,1,6,2,57,76,0,0,14,185,0,1,255,222,180,25,31,11,23,37,1,43,53,255,255,
+0,199,0,0,5,14,7,115,2,38,0,49,0,0,1,7,1,76,0,156,1,82,0,19,64,11,1,29,5,
+38,1,0,35,24,10,0,37,1,43,53,0,43,53,0,255,255,0,174,0,0,4,18,6,33,2,38,0,
+81,0,0,1,6,1,76,12,0,0,21,180,1,30,17,38,1,184,255,250,180,36,25,11,23,37,
+1,43,53,0,43,53,0,255,255,255,255,0,0,4,161,5,182,0,39,0,81,0,143,0,0,1,6,
+2,7,232,0,0,41,64,29,0,24,85,39,239,39,1,191,39,1,159,39,1,95,39,1,47,39,
+1,39,64,8,8,72,39,64,6,6,72,43,43,93,93,93,93,93,16,246,52,0,0,1,0,199,254,
+123,5,14,5,182,0,37,0,74,64,42,24,12,31,90,32,4,4,21,32,101,39,176,39,1,143,
+39,1,0,39,16,39,2,23,19,14,20,90,21,100,38,31,13,22,3,21,18,24,12,18,7,95,
+0,0,47,225,63,51,63,63,51,51,1,16,246,225,50,50,50,93,93,93,16,230,17,57,
+47,16,225,50,50,49,48,1,34,38,39,53,22,22,51,50,62,2,53,1,35,22,23,22,22,
+21,17,35,17,51,1,51,38,39,38,38,53,17,51,17,20,14,2,3,139,51,77,27,34,78,
+45,37,75,61,38,253,8,8,6,4,4,5,172,213,2,204,7,3,4,3,5,174,55,100,143,254,
+123,13,11,160,9,11,19,50,88,68,4,186,77,76,65,142,57,252,231,5,182,251,117,
+65,65,56,125,52,3,32,250,94,105,154,101,49,0,0,1,0,174,254,20,4,18,4,94,0,
+40,0,58,64,34,3,3,23,12,71,36,85,42,16,42,96,42,128,42,3,26,22,71,23,84,41,
+26,16,80,32,16,24,15,23,21,7,80,0,27,0,63,225,63,63,63,225,51,1,16,246,225,
+50,93,16,246,225,17,57,47,49,48,1,34,38,39,53,22,22,51,50,62,2,53,19,52,38,
+35,34,14,2,21,17,35,17,51,23,51,62,3,51,50,22,21,3,20,14,2,2,238,48,63,23,
+26,54,35,27,46,35,19,2,105,112,81,110,67,29,182,148,26,10,25,69,82,92,48,
+183,185,2,34,72,109,254,20,14,11,148,10,11,15,39,65,51,3,109,130,130,52,102,
+148,96,253,199,4,74,148,43,63,42,20,191,210,252,149,77,123,87,47,255,255,
+0,125,255,236,5,113,6,193,2,38,0,50,0,0,1,7,1,77,0,188,1,82,0,19,64,11,2,
+42,5,38,2,0,40,41,10,0,37,1,43,53,0,43,53,0,255,255,0,113,255,236,4,45,5,
+111,2,38,0,82,0,0,1,6,1,77,20,0,0,19,64,11,2,34,17,38,2,0,32,33,10,0,37,1,
+43,53,0,43,53,0,255,255,0,125,255,236,5,113,7,64,2,38,0,50,0,0,1,7,1,78,0,
+170,1,82,0,19,64,11,2,45,5,38,2,1,50,40,10,0,37,1,43,53,0,43,53,0,255,255,
+0,113,255,236,4,45,5,238,2,38,0,82,0,0,1,6,1,78,0,0,0,21,180,2,37,17,38,2,
+184,255,255,180,42,32,10,0,37,1,43,53,0,43,53,0,255,255,0,125,255,236,5,113,
+7,115,2,38,0,50,0,0,1,7,1,83,0,236,1,82,0,23,64,13,3,2,52,5,38,3,2,67,40,
+60,10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,113,255,236,4,45,6,33,2,38,0,
+82,0,0,1,6,1,83,70,0,0,23,64,13,3,2,44,17,38,3,2,69,32,52,10,0,37,1,43,53,
+53,0,43,53,53,0,0,2,0,125,255,236,6,164,5,205,0,25,0,42,0,91,64,54,20,22,
+1,22,22,0,20,24,90,39,39,9,18,0,103,44,31,44,1,31,91,9,102,43,23,95,79,20,
+1,15,20,175,20,2,8,20,20,25,18,95,17,3,26,95,14,4,36,95,4,19,25,95,0,18,0,
+63,225,63,225,63,225,63,225,18,57,47,94,93,113,225,1,16,246,225,93,16,230,
+50,17,57,47,225,50,17,57,47,93,49,48,33,33,6,6,35,34,38,38,2,53,52,18,54,
+54,51,50,23,33,21,33,17,33,21,33,17,33,1,34,14,2,21,20,30,2,51,50,54,55,17,
+38,38,6,164,253,10,43,91,48,163,239,157,76,76,158,240,163,98,84,2,244,253,
+194,2,23,253,233,2,62,252,86,114,166,108,52,52,107,165,114,52,90,38,38,89,
+9,11,108,198,1,23,170,170,1,21,196,107,23,164,254,60,162,253,248,4,133,81,
+151,218,138,137,219,153,81,18,15,4,88,16,17,0,0,3,0,113,255,236,6,225,4,94,
+0,42,0,54,0,63,0,100,64,59,19,3,63,29,72,208,49,1,49,49,11,55,72,37,28,87,
+65,15,65,1,255,65,1,64,65,1,43,72,11,86,64,29,80,27,63,43,63,2,15,63,1,6,
+63,63,46,60,52,80,22,19,16,16,32,46,80,3,0,6,22,0,63,51,51,225,50,63,51,51,
+225,50,18,57,47,94,93,93,225,1,16,246,225,93,93,113,16,246,50,225,17,57,47,
+93,225,50,57,57,49,48,5,34,38,39,6,6,35,34,46,2,53,52,62,2,51,50,22,23,54,
+54,51,50,30,2,21,21,33,22,22,51,50,62,2,55,21,14,3,1,20,22,51,50,54,53,52,
+38,35,34,6,5,52,46,2,35,34,6,7,5,96,130,204,65,63,198,128,103,174,127,71,
+67,124,179,111,121,195,63,60,185,117,99,158,110,59,253,76,5,153,151,51,87,
+81,76,39,40,77,81,87,251,154,137,154,150,139,140,151,154,135,4,240,27,57,
+88,62,114,133,11,20,112,109,109,112,76,145,213,137,136,211,145,75,111,106,
+105,112,71,129,181,110,113,193,182,10,19,29,18,162,19,28,18,8,2,59,209,211,
+201,209,220,206,207,98,68,113,80,44,156,149,0,255,255,0,199,0,0,4,160,7,115,
+2,38,0,53,0,0,1,7,0,118,0,84,1,82,0,21,180,2,41,5,38,2,184,255,238,180,29,
+35,2,13,37,1,43,53,0,43,53,0,255,255,0,174,0,0,3,8,6,33,2,38,0,85,0,0,1,6,
+0,118,206,0,0,19,64,11,1,35,17,38,1,64,23,29,14,3,37,1,43,53,0,43,53,0,255,
+255,0,199,254,59,4,160,5,182,2,38,0,53,0,0,1,6,2,57,119,0,0,14,185,0,2,255,
+182,180,29,35,2,13,37,1,43,53,255,255,0,96,254,59,3,8,4,94,2,38,0,85,0,0,
+1,7,2,57,254,241,0,0,0,14,185,0,1,255,8,180,23,29,14,3,37,1,43,53,255,255,
+0,199,0,0,4,160,7,115,2,38,0,53,0,0,1,7,1,76,0,14,1,82,0,21,180,2,34,5,38,
+2,184,255,169,180,40,29,2,13,37,1,43,53,0,43,53,0,255,255,0,114,0,0,3,10,
+6,33,2,38,0,85,0,0,1,7,1,76,255,112,0,0,0,21,180,1,28,17,38,1,184,255,227,
+180,34,23,14,3,37,1,43,53,0,43,53,0,255,255,0,104,255,236,3,201,7,115,2,38,
+0,54,0,0,1,7,0,118,0,59,1,82,0,19,64,11,1,64,5,38,1,112,52,58,8,0,37,1,43,
+53,0,43,53,0,255,255,0,90,255,236,3,63,6,33,2,38,0,86,0,0,1,6,0,118,220,0,
+0,19,64,11,1,66,17,38,1,93,54,60,8,0,37,1,43,53,0,43,53,0,255,255,0,104,255,
+236,3,201,7,115,2,38,0,54,0,0,1,7,1,75,255,237,1,82,0,19,64,11,1,52,5,38,
+1,34,60,52,8,0,37,1,43,53,0,43,53,0,255,255,0,90,255,236,3,63,6,33,2,38,0,
+86,0,0,1,6,1,75,155,0,0,19,64,11,1,54,17,38,1,28,62,54,8,0,37,1,43,53,0,43,
+53,0,255,255,0,104,254,20,3,201,5,203,2,38,0,54,0,0,1,7,0,122,1,53,0,0,0,
+14,185,0,1,255,250,180,58,52,8,0,37,1,43,53,255,255,0,90,254,20,3,63,4,94,
+2,38,0,86,0,0,1,7,0,122,0,240,0,0,0,11,182,1,1,60,54,8,0,37,1,43,53,0,255,
+255,0,104,255,236,3,201,7,115,2,38,0,54,0,0,1,7,1,76,255,230,1,82,0,19,64,
+11,1,57,5,38,1,27,63,52,8,0,37,1,43,53,0,43,53,0,255,255,0,90,255,236,3,63,
+6,33,2,38,0,86,0,0,1,6,1,76,151,0,0,19,64,11,1,59,17,38,1,24,65,54,8,0,37,
+1,43,53,0,43,53,0,255,255,0,20,254,59,4,18,5,182,2,38,0,55,0,0,1,6,2,57,249,
+0,0,14,185,0,1,255,216,180,8,14,3,5,37,1,43,53,255,255,0,33,254,59,2,143,
+5,70,2,38,0,87,0,0,1,7,2,57,255,93,0,0,0,14,185,0,1,255,247,180,30,36,18,
+5,37,1,43,53,255,255,0,20,0,0,4,18,7,115,2,38,0,55,0,0,1,7,1,76,255,200,1,
+82,0,19,64,11,1,13,5,38,1,3,19,8,3,5,37,1,43,53,0,43,53,0,255,255,0,33,255,
+236,2,232,6,20,2,38,0,87,0,0,1,6,2,56,111,0,0,11,182,1,97,36,36,24,24,37,
+1,43,53,0,0,1,0,20,0,0,4,18,5,182,0,15,0,115,64,76,31,17,1,224,17,1,95,17,
+223,17,2,32,17,48,17,64,17,3,8,191,5,255,5,2,5,5,10,6,90,1,15,1,80,2,240,
+2,2,31,2,1,2,2,13,119,1,135,1,151,1,3,49,1,1,0,1,16,1,32,1,3,7,1,10,13,96,
+7,0,0,3,11,18,6,2,95,3,3,0,63,225,50,63,18,57,47,51,225,50,1,47,94,93,93,
+93,51,51,47,93,93,18,57,16,225,50,50,47,93,57,93,93,93,113,49,48,1,17,33,
+53,33,21,33,17,33,21,33,17,35,17,33,53,1,182,254,94,3,254,254,95,1,39,254,
+217,187,254,215,3,51,1,223,164,164,254,33,149,253,98,2,158,149,0,1,0,33,255,
+236,2,143,5,70,0,37,0,106,182,20,31,1,32,28,28,5,184,255,192,64,55,8,11,72,
+5,5,39,47,39,63,39,2,31,27,35,71,19,15,22,31,22,2,22,24,20,0,16,16,16,160,
+16,176,16,192,16,5,7,16,17,34,79,20,31,31,11,21,30,79,26,24,27,15,0,80,11,
+22,0,63,225,63,51,51,225,50,18,57,47,51,225,50,1,47,94,93,51,51,196,93,50,
+225,50,50,93,17,51,47,43,51,17,51,0,93,49,48,37,50,62,2,55,21,14,3,35,34,
+46,2,53,53,35,53,51,53,35,53,55,55,51,21,33,21,33,21,33,21,33,21,20,22,1,
+250,18,45,42,35,9,13,40,48,52,25,62,106,77,44,139,139,155,155,78,105,1,20,
+254,236,1,2,254,254,63,129,4,6,8,3,138,6,12,9,5,32,78,133,101,251,138,248,
+81,78,230,252,137,248,138,251,97,98,255,255,0,184,255,236,4,221,7,53,2,38,
+0,56,0,0,1,7,1,82,0,96,1,82,0,21,180,1,32,5,38,1,184,255,255,180,33,47,11,
+0,37,1,43,53,0,43,53,0,255,255,0,164,255,236,4,8,5,227,2,38,0,88,0,0,1,6,
+1,82,243,0,0,19,64,11,1,35,17,38,1,6,36,50,12,25,37,1,43,53,0,43,53,0,255,
+255,0,184,255,236,4,221,6,193,2,38,0,56,0,0,1,7,1,77,0,143,1,82,0,21,180,
+1,26,5,38,1,184,255,255,180,24,25,11,0,37,1,43,53,0,43,53,0,255,255,0,164,
+255,236,4,8,5,111,2,38,0,88,0,0,1,6,1,77,33,0,0,19,64,11,1,29,17,38,1,5,27,
+28,12,25,37,1,43,53,0,43,53,0,255,255,0,184,255,236,4,221,7,64,2,38,0,56,
+0,0,1,7,1,78,0,125,1,82,0,19,64,11,1,29,5,38,1,0,34,24,11,0,37,1,43,53,0,
+43,53,0,255,255,0,164,255,236,4,8,5,238,2,38,0,88,0,0,1,6,1,78,12,0,0,19,
+64,11,1,32,17,38,1,4,37,27,12,25,37,1,43,53,0,43,53,0,255,255,0,184,255,236,
+4,221,7,217,2,38,0,56,0,0,1,7,1,80,0,123,1,82,0,23,64,13,2,1,29,5,38,2,1,
+0,34,24,11,0,37,1,43,53,53,0,43,53,53,0,255,255,0,164,255,236,4,8,6,135,2,
+38,0,88,0,0,1,6,1,80,12,0,0,23,64,13,2,1,32,17,38,2,1,5,37,27,12,25,37,1,
+43,53,53,0,43,53,53,0,255,255,0,184,255,236,4,221,7,115,2,38,0,56,0,0,1,7,
+1,83,0,178,1,82,0,23,64,13,2,1,36,5,38,2,1,54,24,44,11,0,37,1,43,53,53,0,
+43,53,53,0,255,255,0,164,255,236,4,14,6,33,2,38,0,88,0,0,1,6,1,83,80,0,0,
+23,64,13,2,1,39,17,38,2,1,72,27,47,12,25,37,1,43,53,53,0,43,53,53,0,255,255,
+0,184,254,66,4,221,5,184,2,38,0,56,0,0,1,7,1,81,2,25,0,0,0,11,182,1,13,37,
+30,11,0,37,1,43,53,0,255,255,0,164,254,66,4,22,4,74,2,38,0,88,0,0,1,7,1,81,
+2,184,0,0,0,11,182,1,14,33,33,26,26,37,1,43,53,0,255,255,0,20,0,0,6,254,7,
+115,2,38,0,58,0,0,1,7,1,75,1,59,1,82,0,19,64,11,1,43,5,38,1,0,51,43,30,14,
+37,1,43,53,0,43,53,0,255,255,0,20,0,0,5,227,6,33,2,38,0,90,0,0,1,7,1,75,0,
+174,0,0,0,19,64,11,1,48,17,38,1,0,56,48,17,46,37,1,43,53,0,43,53,0,255,255,
+0,0,0,0,4,55,7,115,2,38,0,60,0,0,1,7,1,75,255,208,1,82,0,19,64,11,1,9,5,38,
+1,2,17,9,7,2,37,1,43,53,0,43,53,0,255,255,0,10,254,20,3,223,6,33,2,38,0,92,
+0,0,1,6,1,75,169,0,0,19,64,11,1,35,17,38,1,2,43,35,0,15,37,1,43,53,0,43,53,
+0,255,255,0,0,0,0,4,55,7,43,2,38,0,60,0,0,1,7,0,106,255,206,1,82,0,23,64,
+13,2,1,18,5,38,2,1,1,9,29,7,2,37,1,43,53,53,0,43,53,53,0,255,255,0,82,0,0,
+3,254,7,115,2,38,0,61,0,0,1,7,0,118,0,57,1,82,0,19,64,11,1,22,5,38,1,94,10,
+16,1,0,37,1,43,53,0,43,53,0,255,255,0,82,0,0,3,53,6,33,2,38,0,93,0,0,1,6,
+0,118,214,0,0,19,64,11,1,22,17,38,1,96,10,16,1,0,37,1,43,53,0,43,53,0,255,
+255,0,82,0,0,3,254,7,55,2,38,0,61,0,0,1,7,1,79,1,41,1,82,0,19,64,11,1,21,
+5,38,1,11,10,18,1,0,37,1,43,53,0,43,53,0,255,255,0,82,0,0,3,53,5,229,2,38,
+0,93,0,0,1,7,1,79,0,205,0,0,0,19,64,11,1,21,17,38,1,20,10,18,1,0,37,1,43,
+53,0,43,53,0,255,255,0,82,0,0,3,254,7,115,2,38,0,61,0,0,1,7,1,76,255,224,
+1,82,0,19,64,11,1,15,5,38,1,6,21,10,1,0,37,1,43,53,0,43,53,0,255,255,0,82,
+0,0,3,53,6,33,2,38,0,93,0,0,1,6,1,76,134,0,0,19,64,11,1,15,17,38,1,16,21,
+10,1,0,37,1,43,53,0,43,53,0,0,1,0,174,0,0,2,190,6,31,0,19,0,37,64,21,9,9,
+21,0,21,16,21,32,21,3,19,71,0,84,20,13,80,6,1,0,21,0,63,63,225,1,16,246,225,
+93,17,51,47,49,48,51,17,52,62,2,51,50,22,23,7,38,38,35,34,14,2,21,17,174,
+45,85,124,78,59,99,38,47,31,72,40,40,58,39,19,4,176,107,141,84,35,23,14,141,
+11,17,19,48,83,65,251,78,0,1,0,203,254,20,3,233,5,203,0,43,0,74,64,42,48,
+45,1,41,31,31,1,71,18,22,18,20,20,18,10,10,0,18,16,18,48,18,64,18,4,7,18,
+19,0,96,22,41,41,13,35,80,28,7,13,80,6,27,0,63,225,63,225,18,57,47,51,225,
+50,1,47,94,93,51,47,17,51,47,17,51,16,225,50,47,50,93,49,48,1,17,20,14,2,
+35,34,38,39,53,22,22,51,50,62,2,53,17,35,53,55,53,52,62,2,51,50,22,23,7,38,
+38,35,34,14,2,21,21,51,21,2,143,45,85,123,78,32,61,28,26,57,31,40,59,38,19,
+194,194,45,85,124,78,59,99,38,47,31,72,40,40,58,39,19,246,3,68,252,63,107,
+141,84,35,9,6,153,8,10,19,48,83,65,3,195,75,68,137,107,141,84,35,23,14,141,
+11,17,19,48,83,65,145,137,0,0,4,0,0,0,0,4,221,7,170,0,22,0,35,0,49,0,62,1,
+1,64,94,137,41,1,41,190,42,42,48,49,49,29,56,131,15,13,31,13,2,16,13,32,13,
+2,13,13,86,35,102,35,2,35,7,8,89,23,105,23,2,6,23,5,29,50,131,15,0,31,0,111,
+0,3,0,0,214,10,1,55,10,71,10,87,10,199,10,4,10,217,3,1,56,3,72,3,88,3,200,
+3,4,3,29,29,9,5,16,4,1,128,4,144,4,208,4,3,4,184,255,192,64,24,6,10,72,4,
+16,4,4,64,15,64,31,64,47,64,143,64,159,64,223,64,6,7,8,9,184,255,240,64,49,
+9,7,95,35,29,32,10,14,72,29,10,3,60,25,53,1,53,140,18,16,60,1,143,18,239,
+18,2,96,18,1,16,49,32,49,2,35,60,18,49,49,18,60,35,4,4,41,9,4,18,0,63,51,
+47,18,23,57,47,47,47,47,93,93,93,93,16,225,93,17,51,51,51,43,16,225,1,47,
+56,51,94,93,17,51,47,56,43,93,113,51,18,57,61,47,51,93,93,51,93,93,51,24,
+47,93,225,17,18,57,57,93,18,57,57,93,51,47,93,113,225,17,51,47,51,51,47,237,
+93,49,48,1,20,6,7,1,35,3,33,3,35,1,38,38,53,52,62,2,51,50,30,2,3,3,46,3,39,
+14,3,7,3,19,62,3,55,51,21,14,3,7,35,19,52,38,35,34,6,21,20,22,23,51,50,54,
+3,80,60,51,1,252,190,154,253,211,156,188,1,248,51,58,32,59,82,50,49,84,62,
+35,12,148,6,17,18,18,8,7,18,18,17,6,145,133,21,48,47,42,16,219,16,63,77,81,
+35,121,188,63,50,49,63,51,49,12,50,63,5,156,70,96,25,251,35,1,135,254,121,
+4,219,25,96,70,51,79,56,29,29,55,79,252,95,1,125,16,46,54,59,28,28,60,54,
+46,15,254,131,4,139,24,61,65,64,28,16,22,65,71,66,22,254,246,52,60,60,52,
+51,59,3,60,0,5,0,94,255,236,3,156,7,170,0,13,0,49,0,64,0,84,0,96,0,156,64,
+35,85,131,15,65,31,65,47,65,3,65,65,91,131,75,6,13,75,13,75,13,26,30,15,55,
+71,49,85,98,63,98,1,62,72,26,40,184,255,208,64,58,13,17,72,40,16,9,12,72,
+40,40,26,86,97,88,140,80,80,13,96,13,112,13,3,13,13,80,80,5,94,140,64,70,
+80,70,2,70,70,39,36,80,43,56,82,30,30,43,16,50,80,15,21,22,14,21,15,5,1,5,
+0,47,93,63,63,51,225,63,57,47,225,16,225,50,51,47,93,225,17,57,47,51,47,93,
+16,225,1,16,230,50,47,43,43,16,225,93,16,246,225,50,50,17,57,57,47,47,16,
+205,16,225,51,47,93,225,49,48,1,62,3,55,51,21,14,3,7,35,1,39,35,14,3,35,34,
+46,2,53,52,54,55,55,53,52,46,2,35,34,6,7,39,54,54,51,50,30,2,21,17,37,50,
+62,2,53,53,7,14,3,21,20,22,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,
+38,35,34,6,21,20,22,51,50,54,1,199,21,48,47,42,16,219,16,63,77,82,35,120,
+1,82,37,8,33,66,78,96,63,69,116,85,48,231,236,184,29,55,81,52,83,143,66,64,
+74,182,100,102,149,97,48,254,47,61,104,76,43,143,90,122,73,32,97,1,134,35,
+61,84,49,50,82,59,33,33,59,82,50,48,84,62,35,117,63,49,50,63,57,56,49,63,
+6,184,24,61,65,64,28,16,22,65,71,66,22,249,92,152,45,65,42,20,39,81,123,84,
+164,176,8,7,69,67,90,55,24,48,34,137,40,56,41,89,138,98,253,16,127,38,77,
+117,79,99,7,4,32,57,81,51,92,86,5,8,51,81,56,29,29,56,79,51,51,79,56,29,29,
+55,79,52,53,60,60,53,53,60,60,255,255,255,254,0,0,6,86,7,115,2,38,0,136,0,
+0,1,7,0,118,2,37,1,82,0,21,180,2,32,5,38,2,184,1,72,180,20,26,5,0,37,1,43,
+53,0,43,53,0,255,255,0,94,255,236,6,68,6,33,2,38,0,168,0,0,1,7,0,118,1,117,
+0,0,0,19,64,11,3,93,17,38,3,113,81,87,0,28,37,1,43,53,0,43,53,0,255,255,0,
+125,255,180,5,113,7,115,2,38,0,154,0,0,1,7,0,118,1,2,1,82,0,19,64,11,3,62,
+5,38,3,88,50,56,17,4,37,1,43,53,0,43,53,0,255,255,0,115,255,180,4,47,6,33,
+2,38,0,186,0,0,1,6,0,118,80,0,0,19,64,11,3,58,17,38,3,76,46,52,13,0,37,1,
+43,53,0,43,53,0,255,255,0,104,254,59,3,201,5,203,2,38,0,54,0,0,1,6,2,57,0,
+0,0,14,185,0,1,255,218,180,52,58,8,0,37,1,43,53,255,255,0,90,254,59,3,63,
+4,94,2,38,0,86,0,0,1,6,2,57,187,0,0,14,185,0,1,255,225,180,54,60,8,0,37,1,
+43,53,0,1,1,2,4,217,3,154,6,33,0,20,0,37,64,17,15,14,4,4,0,192,8,4,14,128,
+0,15,8,95,8,2,8,0,47,93,51,26,204,50,1,47,26,204,57,61,47,51,51,49,48,1,35,
+38,38,39,6,6,7,35,53,62,3,55,51,30,3,23,3,154,121,51,108,52,54,106,51,121,
+26,68,67,59,16,192,16,59,67,69,25,4,217,34,97,55,55,97,34,27,29,76,81,81,
+34,34,81,81,76,29,0,1,1,2,4,217,3,154,6,33,0,20,0,37,64,17,6,5,16,16,0,192,
+11,19,13,128,16,15,6,95,6,2,6,0,47,93,51,26,205,50,1,47,26,204,57,61,47,51,
+51,49,48,1,14,3,7,35,46,3,39,53,51,22,22,23,54,54,55,51,3,154,25,69,67,59,
+16,192,16,59,67,68,26,121,51,106,54,52,108,51,121,6,6,29,76,81,80,35,35,80,
+81,76,29,27,34,97,56,56,97,34,0,1,1,27,4,217,3,90,5,111,0,3,0,21,64,10,1,
+0,0,143,15,3,95,3,2,3,0,47,93,225,1,47,205,49,48,1,33,21,33,1,27,2,63,253,
+193,5,111,150,0,1,1,33,4,217,3,123,5,238,0,21,0,47,64,28,21,131,255,0,1,0,
+192,11,131,10,0,127,10,143,10,159,10,3,10,128,16,143,15,5,95,5,2,5,0,47,93,
+225,26,205,93,50,1,47,225,26,220,93,225,49,48,1,14,3,35,34,46,2,39,51,30,
+3,51,50,62,2,55,3,123,4,44,77,109,71,73,109,73,39,3,108,4,28,48,67,44,36,
+65,51,34,4,5,238,61,101,74,41,39,73,102,63,43,50,25,7,9,27,49,40,0,1,0,160,
+5,0,1,117,5,229,0,13,0,28,64,16,8,135,0,3,145,159,11,207,11,239,11,3,48,11,
+1,11,0,47,93,93,229,1,47,225,49,48,19,52,54,51,50,30,2,21,20,6,35,34,38,160,
+61,45,22,39,29,17,63,44,45,61,5,115,60,54,13,28,43,30,58,57,56,0,0,2,1,109,
+4,217,3,49,6,135,0,19,0,31,0,64,64,45,20,131,15,0,63,0,79,0,95,0,4,0,26,131,
+48,10,1,10,23,140,15,15,31,15,63,15,79,15,95,15,175,15,255,15,7,6,15,29,140,
+15,5,95,5,2,5,0,47,93,225,212,94,93,225,1,47,93,225,212,93,225,49,48,1,20,
+14,2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,3,
+49,35,61,84,49,50,82,59,32,32,59,82,50,48,84,62,35,117,63,49,50,63,57,56,
+49,63,5,178,51,81,56,29,29,56,79,51,51,79,56,29,29,55,79,52,53,60,60,53,53,
+60,60,0,1,0,31,254,66,1,94,0,0,0,20,0,22,64,9,6,128,0,132,13,18,3,142,10,
+0,47,225,47,1,47,225,26,204,49,48,23,20,22,51,50,54,55,21,6,6,35,34,38,53,
+52,62,2,55,51,6,180,52,34,25,45,14,26,64,29,100,100,30,47,56,26,129,139,238,
+45,43,5,4,113,8,8,104,90,42,75,64,52,19,133,0,0,1,1,2,4,217,3,209,5,227,0,
+27,0,56,64,35,15,23,47,23,2,23,0,9,32,9,2,7,9,22,5,143,14,64,16,19,72,14,
+64,7,11,72,14,14,19,143,9,15,0,1,0,0,47,93,50,225,51,47,43,43,225,51,1,47,
+94,93,204,93,49,48,1,34,46,2,35,34,6,7,35,62,3,51,50,30,2,51,50,54,55,51,
+14,3,2,254,40,79,76,70,32,45,48,14,104,5,33,53,74,46,42,81,76,69,29,45,46,
+15,105,5,33,53,74,4,219,35,43,35,53,62,60,98,69,37,35,42,35,52,62,60,97,69,
+38,0,0,2,0,223,4,217,3,190,6,33,0,13,0,27,0,45,64,25,20,14,14,7,64,80,0,1,
+63,0,79,0,2,0,19,5,146,128,27,15,12,95,12,2,12,0,47,93,51,26,237,50,1,47,
+93,93,26,205,57,47,205,49,48,19,62,3,55,51,21,14,3,7,35,37,62,3,55,51,21,
+14,3,7,35,223,22,47,47,42,16,199,16,63,77,81,35,101,1,107,21,48,47,42,16,
+198,16,63,77,81,35,100,4,244,29,76,81,81,34,21,27,81,88,83,28,27,29,76,81,
+81,34,21,27,81,88,83,28,0,0,1,1,248,4,217,3,4,6,33,0,13,0,39,64,22,5,16,12,
+17,72,5,6,64,12,0,0,1,0,5,146,128,15,12,95,12,2,12,0,47,93,26,237,1,47,93,
+51,26,205,50,43,49,48,1,62,3,55,51,21,14,3,7,35,1,248,10,20,19,16,4,199,6,
+33,45,52,24,108,4,244,30,77,81,80,33,21,24,78,87,86,32,0,3,1,20,5,12,3,137,
+6,180,0,13,0,27,0,41,0,102,64,25,28,132,15,36,31,36,2,15,36,31,36,207,36,
+3,36,64,9,12,72,36,36,13,22,132,14,184,255,192,64,39,9,13,72,14,14,5,16,12,
+17,72,5,6,12,13,5,146,12,12,31,17,145,39,255,25,1,96,25,176,25,208,25,3,15,
+25,31,25,2,6,25,0,47,94,93,93,93,51,229,50,57,47,237,1,47,51,205,50,43,51,
+47,43,225,17,51,47,43,93,113,225,49,48,1,62,3,55,51,21,14,3,7,35,39,52,54,
+51,50,30,2,21,20,6,35,34,38,37,52,54,51,50,30,2,21,20,6,35,34,38,1,254,11,
+25,24,22,8,207,18,48,56,61,32,82,234,56,41,19,35,26,16,58,38,41,56,1,181,
+56,40,19,35,26,16,58,38,40,56,5,135,30,75,79,81,36,20,32,77,80,81,37,6,54,
+48,12,25,38,27,53,50,50,53,54,48,12,25,38,27,53,50,50,255,255,255,233,0,0,
+4,221,5,188,2,38,0,36,0,0,1,7,1,84,253,241,255,151,0,24,182,2,26,3,2,48,34,
+1,184,255,233,180,34,34,4,4,37,1,43,93,53,0,63,53,0,1,0,147,2,72,1,145,3,
+94,0,19,0,51,64,26,16,21,128,21,144,21,160,21,4,10,150,192,0,208,0,2,52,0,
+68,0,100,0,116,0,4,0,184,255,192,182,7,10,72,0,5,155,15,0,47,229,1,47,43,
+93,93,237,93,49,48,19,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,147,20,34,
+46,27,26,47,34,20,20,34,47,26,27,46,34,20,2,211,38,53,33,15,15,33,53,38,37,
+52,34,16,16,34,52,0,255,255,255,231,0,0,4,77,5,184,0,39,0,40,0,143,0,0,1,
+7,1,84,253,239,255,151,0,46,180,1,17,3,1,18,184,255,192,178,8,15,72,184,255,
+157,64,15,18,18,2,2,37,0,0,103,27,191,27,1,15,27,1,1,93,93,16,254,52,1,43,
+43,53,0,63,53,255,255,255,231,0,0,5,80,5,184,0,38,0,43,123,0,1,7,1,84,253,
+239,255,151,0,49,180,1,17,3,1,18,184,255,192,178,8,17,72,184,255,177,64,18,
+18,18,6,6,37,0,0,101,111,27,1,47,27,1,16,27,1,27,1,16,93,93,93,254,52,43,
+43,53,0,63,53,0,255,255,255,231,0,0,3,96,5,184,0,39,0,44,0,252,0,0,1,7,1,
+84,253,239,255,151,0,102,64,22,1,17,3,1,192,18,1,160,18,1,48,18,1,32,18,1,
+16,18,1,0,18,1,184,255,165,64,47,18,18,6,6,37,0,240,0,1,208,0,1,192,0,1,175,
+0,1,112,0,1,96,0,1,80,0,1,64,0,1,63,0,1,0,32,27,1,27,64,7,7,72,27,64,7,9,
+72,1,43,43,93,17,93,93,93,93,93,93,93,93,93,53,43,93,93,93,93,93,93,53,0,
+63,53,255,255,255,231,255,236,5,195,5,205,0,38,0,50,82,0,1,7,1,84,253,239,
+255,151,0,71,64,48,2,45,3,2,160,46,1,128,46,1,112,46,1,80,46,1,32,46,1,16,
+46,1,0,46,1,36,46,46,10,10,37,1,0,80,0,1,80,0,1,0,103,191,55,1,15,55,1,55,
+1,16,93,93,254,93,93,52,52,43,93,93,93,93,93,93,93,53,0,63,53,0,255,255,255,
+231,0,0,5,84,5,184,0,39,0,60,1,29,0,0,1,7,1,84,253,239,255,151,0,75,180,1,
+14,3,1,15,184,255,192,182,22,23,72,160,15,1,15,184,255,192,178,9,17,72,184,
+255,214,64,28,15,15,7,7,37,0,192,5,1,176,5,1,127,5,1,32,5,1,5,63,24,1,47,
+24,1,15,24,1,1,93,93,93,17,93,93,93,93,53,43,43,93,43,53,0,63,53,0,255,255,
+255,231,0,0,6,0,5,205,0,38,1,118,90,0,1,7,1,84,253,239,255,151,0,53,64,35,
+1,53,3,1,32,54,1,16,54,1,0,54,1,22,54,54,19,19,37,0,80,29,1,80,29,1,29,103,
+191,63,1,15,63,1,63,1,16,93,93,254,93,93,52,43,93,93,93,53,0,63,53,0,255,
+255,255,228,255,236,2,119,6,180,2,38,1,134,0,0,1,7,1,85,254,208,0,0,0,24,
+64,15,3,2,1,192,36,1,64,36,1,32,36,58,21,0,37,1,43,93,93,53,53,53,255,255,
+0,0,0,0,4,221,5,188,2,6,0,36,0,0,255,255,0,199,0,0,4,135,5,182,2,6,0,37,0,
+0,0,1,0,199,0,0,3,190,5,182,0,5,0,67,64,10,196,0,244,0,2,176,0,1,2,0,184,
+255,192,64,31,8,19,72,0,0,7,15,7,47,7,79,7,111,7,4,7,64,17,24,72,3,90,4,100,
+6,2,95,5,3,3,18,0,63,63,225,1,16,246,225,43,93,17,51,47,43,95,93,93,49,48,
+1,21,33,17,35,17,3,190,253,195,186,5,182,166,250,240,5,182,0,0,2,0,37,0,0,
+4,104,5,182,0,5,0,14,0,88,64,17,5,4,6,6,2,11,91,96,1,112,1,176,1,240,1,4,
+1,184,255,192,64,39,6,10,72,1,1,16,47,16,95,16,111,16,127,16,159,16,191,16,
+6,16,64,6,9,72,10,91,2,6,32,10,17,72,6,4,3,10,95,2,18,0,63,225,63,51,43,1,
+47,225,43,93,17,51,47,43,93,225,18,57,61,47,51,51,49,48,37,21,33,53,1,51,
+7,6,6,7,3,33,3,38,38,4,104,251,189,1,194,187,94,17,42,29,254,2,174,252,31,
+46,125,125,133,5,49,205,74,168,91,253,10,2,240,97,168,0,255,255,0,199,0,0,
+3,190,5,182,2,6,0,40,0,0,255,255,0,82,0,0,3,254,5,182,2,6,0,61,0,0,255,255,
+0,199,0,0,4,213,5,182,2,6,0,43,0,0,0,3,0,125,255,236,5,113,5,205,0,3,0,23,
+0,43,0,83,64,52,0,1,0,1,14,34,91,4,103,45,208,45,1,207,45,1,128,45,1,63,45,
+111,45,2,24,91,14,102,44,3,96,15,0,175,0,223,0,255,0,4,8,0,0,29,39,95,19,
+4,29,95,9,19,0,63,225,63,225,18,57,47,94,93,225,1,16,246,225,93,93,93,93,
+16,246,225,18,57,57,47,47,49,48,1,33,21,33,37,20,2,6,6,35,34,38,38,2,53,52,
+18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,1,236,
+2,22,253,234,3,133,81,160,237,155,163,239,157,76,76,158,240,163,155,235,160,
+81,251,209,52,107,165,114,114,165,107,50,50,106,164,114,114,166,108,52,3,
+57,161,69,169,254,234,198,108,108,198,1,23,170,170,1,21,196,107,107,197,254,
+235,171,137,219,153,81,81,153,219,137,138,218,151,81,81,151,218,255,255,0,
+82,0,0,2,100,5,182,2,6,0,44,0,0,255,255,0,199,0,0,4,162,5,182,2,6,0,46,0,
+0,0,1,0,0,0,0,4,139,5,182,0,12,0,95,64,28,47,14,239,14,255,14,3,14,64,18,
+21,72,14,64,13,16,72,14,64,6,9,72,12,11,5,5,9,10,184,255,240,64,34,10,1,47,
+0,79,0,95,0,159,0,175,0,207,0,239,0,7,16,0,1,0,16,0,5,32,10,14,72,5,11,3,
+10,0,18,0,63,50,63,51,43,1,47,56,93,93,50,47,56,51,57,61,47,51,51,43,43,43,
+93,49,48,33,35,1,38,38,39,6,6,7,1,35,1,51,4,139,198,254,219,31,46,15,17,42,
+29,254,217,197,1,231,187,3,154,97,168,75,75,168,91,252,96,5,182,0,255,255,
+0,199,0,0,6,47,5,182,2,6,0,48,0,0,255,255,0,199,0,0,5,14,5,182,2,6,0,49,0,
+0,0,3,0,82,0,0,3,238,5,182,0,3,0,7,0,11,0,99,64,62,20,0,1,27,1,1,0,1,0,1,
+11,6,6,0,8,1,192,8,1,63,8,1,8,13,79,13,111,13,2,48,13,1,7,7,112,11,128,11,
+2,79,11,1,11,3,95,15,0,175,0,2,8,0,0,4,11,95,10,18,7,95,4,3,0,63,225,63,225,
+17,57,47,94,93,225,1,47,93,93,51,47,93,93,16,206,93,93,113,50,47,17,57,57,
+47,47,93,93,49,48,19,33,21,33,3,33,21,33,1,21,33,53,205,2,166,253,90,82,3,
+74,252,182,3,115,252,100,3,78,162,3,10,164,251,146,164,164,0,255,255,0,125,
+255,236,5,113,5,205,2,6,0,50,0,0,0,1,0,199,0,0,4,193,5,182,0,7,0,49,64,30,
+1,90,0,101,9,176,9,1,111,9,159,9,175,9,3,16,9,1,4,90,5,100,8,3,95,6,3,5,0,
+18,0,63,50,63,225,1,16,246,225,93,93,93,16,246,225,49,48,33,35,17,33,17,35,
+17,33,4,193,187,253,123,186,3,250,5,18,250,238,5,182,0,255,255,0,199,0,0,
+4,51,5,182,2,6,0,51,0,0,0,1,0,78,0,0,4,18,5,182,0,11,0,90,64,13,8,91,6,32,
+20,23,72,2,6,2,6,1,10,184,255,192,64,38,6,21,72,10,10,13,15,13,47,13,111,
+13,143,13,4,6,7,9,91,3,47,1,63,1,2,1,8,2,2,9,7,95,4,3,9,95,0,18,0,63,225,
+63,225,18,57,61,47,51,1,24,47,93,51,225,50,94,93,17,51,47,43,18,57,57,47,
+47,43,225,49,48,51,53,1,1,53,33,21,33,1,1,33,21,78,1,158,254,110,3,125,253,
+88,1,133,254,103,2,247,152,2,102,2,37,147,164,253,238,253,164,164,0,255,255,
+0,20,0,0,4,18,5,182,2,6,0,55,0,0,255,255,0,0,0,0,4,55,5,182,2,6,0,60,0,0,
+0,3,0,104,255,236,5,186,5,203,0,33,0,46,0,59,0,129,64,80,34,2,103,17,1,17,
+90,59,33,154,18,1,135,18,1,122,18,1,18,18,27,40,91,8,103,61,47,61,1,0,61,
+1,208,61,1,175,61,191,61,2,144,61,1,95,61,1,48,61,1,15,61,31,61,2,6,53,91,
+27,102,60,34,59,96,19,16,19,46,47,96,33,2,33,19,33,19,33,17,19,0,4,0,63,63,
+57,57,47,47,17,51,16,225,50,17,51,16,225,50,1,16,246,225,94,93,93,93,93,93,
+93,113,113,16,246,225,17,57,47,93,93,93,51,51,225,93,50,50,49,48,1,51,21,
+51,50,30,2,21,20,14,4,35,35,21,35,53,35,34,46,4,53,52,62,2,51,51,19,51,50,
+62,2,53,52,46,2,43,3,34,14,2,21,20,30,2,51,51,2,180,187,73,134,194,126,60,
+24,52,84,120,159,101,47,187,47,101,159,120,84,53,24,61,126,194,133,74,187,
+26,93,139,91,46,41,83,127,87,57,187,57,87,127,84,40,46,91,139,93,26,5,203,
+180,94,153,196,102,61,129,123,110,82,48,225,225,48,82,110,123,129,61,102,
+196,153,94,252,83,59,105,148,88,78,139,104,60,60,104,139,78,88,148,105,59,
+255,255,0,0,0,0,4,96,5,182,2,6,0,59,0,0,0,1,0,104,0,0,5,186,5,182,0,37,0,
+112,64,71,31,103,9,1,9,90,28,154,10,1,135,10,1,122,10,1,10,10,19,35,91,0,
+103,39,47,39,1,0,39,1,208,39,1,175,39,191,39,2,144,39,1,95,39,1,48,39,1,15,
+39,31,39,2,6,22,91,19,102,38,31,28,96,8,11,11,9,36,29,20,3,9,18,0,63,63,51,
+51,18,57,47,51,225,50,1,16,246,225,94,93,93,93,93,93,93,113,113,16,246,225,
+17,57,47,93,93,93,51,225,93,50,49,48,1,20,14,4,35,35,17,35,17,35,34,46,4,
+53,17,51,17,20,30,2,51,51,17,51,17,51,50,54,53,17,51,5,186,24,52,84,120,159,
+101,47,187,47,101,159,120,84,53,24,193,46,91,139,93,26,187,26,186,183,192,
+3,215,61,127,119,106,78,46,254,66,1,190,45,78,104,119,126,61,1,227,254,33,
+88,141,98,52,3,90,252,166,198,177,1,227,0,0,1,0,78,0,0,5,166,5,205,0,47,0,
+124,64,81,14,91,11,34,91,37,32,11,48,11,2,4,11,1,47,37,63,37,223,37,239,37,
+4,11,37,1,7,11,37,11,37,19,43,91,6,35,22,35,2,35,29,103,49,208,49,1,207,49,
+1,128,49,1,63,49,111,49,2,9,13,25,13,2,8,13,5,91,19,102,48,0,95,24,4,38,34,
+10,13,95,37,12,18,0,63,51,225,50,50,50,63,225,1,16,246,225,51,94,93,93,93,
+93,93,16,246,50,93,225,17,57,57,47,47,94,93,93,93,93,16,225,16,225,49,48,
+1,34,14,2,21,20,30,2,23,21,33,53,33,46,3,53,52,62,2,51,50,30,2,21,20,14,2,
+7,33,21,33,53,62,3,53,52,46,2,2,250,114,164,106,50,35,81,131,95,253,176,1,
+98,64,111,80,46,81,160,236,154,155,235,160,81,46,80,110,65,1,98,253,176,95,
+131,81,35,50,106,164,5,41,68,129,186,117,100,187,171,151,65,147,164,48,135,
+168,199,111,150,244,172,94,94,172,244,150,111,199,168,135,48,164,147,65,151,
+171,187,100,117,186,129,68,0,255,255,0,64,0,0,2,119,7,43,2,38,0,44,0,0,1,
+7,0,106,255,13,1,82,0,23,64,13,2,1,21,5,38,2,1,0,12,32,1,0,37,1,43,53,53,
+0,43,53,53,0,255,255,0,0,0,0,4,55,7,43,2,38,0,60,0,0,1,7,0,106,255,206,1,
+82,0,23,64,13,2,1,18,5,38,2,1,1,9,29,7,2,37,1,43,53,53,0,43,53,53,0,255,255,
+0,113,255,236,4,145,6,33,2,38,1,126,0,0,1,6,1,84,25,0,0,19,64,11,2,74,17,
+38,2,22,62,68,22,47,37,1,43,53,0,43,53,0,255,255,0,90,255,236,3,92,6,33,2,
+38,1,130,0,0,1,6,1,84,202,0,0,19,64,11,1,70,17,38,1,109,58,64,24,45,37,1,
+43,53,0,43,53,0,255,255,0,174,254,20,4,18,6,33,2,38,1,132,0,0,1,6,1,84,68,
+0,0,19,64,11,1,37,17,38,1,98,25,31,11,23,37,1,43,53,0,43,53,0,255,255,0,164,
+255,236,2,119,6,33,2,38,1,134,0,0,1,7,1,84,254,206,0,0,0,21,180,1,34,17,38,
+1,184,255,253,180,22,34,21,0,37,1,43,53,0,43,53,0,255,255,0,164,255,236,4,
+61,6,180,2,38,1,146,0,0,1,6,1,85,16,0,0,18,178,3,2,1,184,255,238,180,44,66,
+5,27,37,1,43,53,53,53,0,2,0,113,255,236,4,145,4,94,0,16,0,61,0,56,64,30,56,
+30,5,71,47,40,63,16,63,1,14,72,22,86,62,34,15,30,11,80,27,15,56,47,44,0,80,
+51,17,22,0,63,51,225,50,50,50,63,225,51,63,1,16,246,225,93,16,212,50,225,
+50,50,49,48,37,50,62,2,55,53,52,46,2,35,34,6,21,20,22,23,34,46,2,53,52,62,
+2,51,50,22,23,51,54,54,55,51,14,3,21,17,20,22,51,50,54,55,21,6,6,35,34,46,
+2,39,35,14,3,2,53,76,105,65,31,2,27,65,108,81,135,127,127,102,93,154,110,
+60,61,113,162,100,112,144,49,12,10,33,25,143,11,19,13,8,50,34,14,37,8,15,
+65,34,38,63,50,36,12,12,22,59,77,96,131,47,98,152,104,15,101,157,107,55,218,
+204,209,205,151,72,143,212,140,141,213,144,73,83,85,35,82,31,33,104,121,126,
+55,254,93,60,51,7,3,133,9,17,16,39,64,48,34,61,46,26,0,2,0,174,254,20,4,117,
+6,31,0,27,0,61,0,89,64,52,57,72,5,8,5,31,51,47,51,2,51,5,51,5,21,44,71,12,
+87,63,32,63,48,63,2,34,21,71,22,84,62,21,27,8,50,80,15,51,1,8,51,51,0,34,
+39,80,17,22,28,80,0,1,0,63,225,63,225,50,17,57,47,94,93,225,57,63,1,16,246,
+225,50,93,16,246,225,18,57,57,47,47,93,18,57,16,225,49,48,1,50,30,2,21,20,
+6,7,21,22,22,21,20,14,2,35,34,38,39,17,35,17,52,62,2,23,34,14,2,21,17,30,
+3,51,50,62,2,53,52,46,2,35,35,53,51,50,62,2,53,52,46,2,2,119,96,163,118,67,
+152,143,176,185,63,120,173,109,96,164,60,182,69,121,168,99,56,100,75,44,32,
+78,82,82,36,80,111,70,31,53,96,132,79,102,77,82,119,78,37,38,68,95,6,31,49,
+98,148,98,149,173,23,6,21,202,186,108,162,109,55,32,31,253,233,6,52,123,178,
+115,55,150,31,76,127,96,252,146,18,30,21,11,40,77,111,71,80,117,77,37,152,
+40,73,102,61,63,94,62,31,0,1,0,10,254,20,3,223,4,74,0,27,0,99,64,22,29,64,
+18,21,72,80,29,1,15,29,47,29,79,29,3,7,26,5,1,5,72,6,184,255,240,64,21,6,
+6,11,0,19,19,12,26,0,27,32,27,64,27,3,8,27,16,27,13,12,184,255,240,64,10,
+12,26,12,15,19,0,11,21,5,27,0,63,63,51,51,63,51,1,47,56,51,47,56,94,93,51,
+18,57,61,47,51,51,51,24,47,56,225,93,94,93,93,43,49,48,37,14,3,21,35,52,62,
+2,55,1,51,19,30,3,23,51,62,3,55,19,51,2,96,22,34,24,12,190,15,27,37,21,254,
+96,189,217,14,30,26,20,4,6,5,20,25,27,11,199,188,18,62,136,134,126,52,42,
+121,137,141,63,4,62,253,186,40,93,90,80,27,26,82,93,90,33,2,76,0,0,2,0,111,
+255,236,4,45,6,31,0,50,0,68,0,81,64,46,26,70,0,56,5,5,46,51,72,15,36,87,70,
+64,70,208,70,224,70,3,15,70,1,6,61,72,46,86,69,0,36,66,26,10,56,56,10,66,
+80,41,22,21,80,16,10,1,0,63,51,225,63,225,17,57,47,18,57,18,57,51,1,16,246,
+225,94,93,93,16,246,50,225,17,57,47,57,57,225,49,48,1,46,3,53,52,62,2,51,
+50,30,2,23,7,46,3,35,34,14,2,21,20,30,2,23,30,3,21,20,14,2,35,34,46,2,53,
+52,62,2,1,52,46,2,39,14,3,21,20,30,2,51,50,54,2,20,56,93,67,37,51,92,125,
+74,68,113,96,81,35,74,32,73,81,91,51,42,60,39,18,27,60,98,71,85,134,92,49,
+69,127,178,109,103,174,127,71,67,114,153,1,180,30,57,82,53,58,126,104,68,
+38,73,105,67,142,153,3,170,32,75,86,98,57,72,105,70,34,20,31,39,19,145,20,
+38,30,18,23,37,50,27,37,62,61,65,41,49,108,126,147,88,127,193,131,67,61,117,
+170,110,106,163,122,83,254,81,69,111,89,73,31,16,58,98,145,103,66,111,81,
+45,180,0,1,0,90,255,236,3,92,4,94,0,57,0,89,64,55,29,35,1,1,24,16,45,87,59,
+160,59,176,59,192,59,3,63,59,95,59,2,16,59,1,52,70,35,35,5,71,24,86,58,30,
+2,80,191,57,1,121,57,137,57,2,57,57,10,49,80,40,16,10,80,19,22,0,63,225,63,
+225,18,57,47,93,93,225,57,1,16,246,225,51,47,225,93,93,93,16,230,50,17,57,
+47,18,57,49,48,1,21,35,34,6,21,20,30,2,51,50,62,2,55,21,6,6,35,34,46,2,53,
+52,62,2,55,53,46,3,53,52,62,2,51,50,30,2,23,7,38,38,35,34,6,21,20,30,2,51,
+2,156,129,138,133,41,70,96,55,51,92,81,71,31,59,158,109,113,166,108,53,38,
+63,82,44,43,70,51,28,58,105,144,86,53,90,82,77,40,63,75,129,71,108,115,39,
+72,100,61,2,135,153,91,94,51,69,42,18,15,24,31,16,160,34,41,49,86,117,67,
+62,88,62,41,15,11,14,43,62,80,50,70,109,74,38,9,19,28,20,147,34,38,77,77,
+45,64,39,18,0,1,0,113,254,111,3,106,6,20,0,51,0,57,64,31,46,3,3,31,70,26,
+32,20,1,20,53,16,53,192,53,2,10,72,41,0,0,41,86,52,25,46,3,0,80,1,0,0,63,
+225,50,50,47,1,16,230,50,47,16,225,93,16,214,93,50,225,51,47,51,49,48,19,
+53,33,21,14,5,21,20,30,2,23,30,3,21,20,14,2,7,35,62,3,53,52,46,2,39,46,3,
+53,52,18,54,54,55,6,7,6,6,35,174,2,182,128,184,126,76,40,13,45,84,120,75,
+71,95,58,25,21,34,43,22,170,24,43,34,20,14,48,91,77,89,135,92,46,92,154,201,
+108,43,47,40,96,47,5,123,153,141,118,205,179,154,133,111,48,89,108,64,35,
+17,15,46,59,72,42,45,88,82,75,31,32,72,72,67,29,20,37,34,31,15,17,66,108,
+152,102,148,1,1,232,217,108,3,3,2,4,0,1,0,174,254,20,4,18,4,94,0,24,0,49,
+64,29,0,71,24,85,26,16,26,96,26,128,26,3,14,10,71,11,84,25,14,4,80,20,16,
+12,15,11,21,0,27,0,63,63,63,63,225,51,1,16,246,225,50,93,16,246,225,49,48,
+1,17,52,38,35,34,14,2,21,17,35,17,51,23,51,62,3,51,50,22,21,17,3,92,105,112,
+81,110,67,29,182,148,26,10,25,69,82,92,48,183,185,254,20,4,175,130,130,52,
+102,148,96,253,199,4,74,148,43,63,42,20,191,210,251,71,0,0,3,0,113,255,236,
+4,23,6,43,0,19,0,30,0,39,0,91,64,58,37,25,71,0,87,41,15,41,1,208,41,1,127,
+41,159,41,2,64,41,1,15,41,1,6,36,26,71,10,86,40,26,80,203,36,1,186,36,1,137,
+36,153,36,2,15,36,1,8,36,36,20,31,80,15,1,20,80,5,22,0,63,225,63,225,18,57,
+47,94,93,93,93,93,225,1,16,246,225,50,94,93,93,93,93,113,16,246,225,50,49,
+48,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,22,18,1,50,62,2,55,33,
+30,3,19,34,14,2,7,33,2,2,4,23,52,112,179,126,118,175,116,56,51,111,177,126,
+118,176,117,58,254,43,73,104,69,35,3,253,203,2,33,68,104,74,71,102,68,35,
+5,2,51,9,132,3,12,188,254,215,206,109,109,206,1,41,188,188,1,41,206,108,107,
+205,254,215,252,185,74,148,223,149,147,223,149,75,5,16,69,137,205,137,1,17,
+1,19,0,0,1,0,164,255,236,2,119,4,72,0,21,0,53,64,35,48,9,1,9,9,23,0,23,16,
+23,32,23,96,23,112,23,144,23,192,23,208,23,8,8,1,71,20,84,22,4,80,15,22,0,
+15,0,63,63,225,1,16,246,225,94,93,17,51,47,93,49,48,1,17,20,22,51,50,62,2,
+55,21,14,3,35,34,46,2,53,17,1,90,63,72,18,45,42,36,9,13,41,48,52,24,62,106,
+77,44,4,72,252,252,97,98,4,6,8,3,138,6,12,9,5,32,78,133,101,3,4,255,255,0,
+174,0,0,3,240,4,74,2,6,0,250,0,0,0,1,255,242,255,236,4,23,6,33,0,46,0,104,
+64,42,34,21,21,26,18,18,1,41,10,41,10,41,0,80,26,1,52,26,68,26,2,0,26,16,
+26,32,26,3,26,26,48,96,48,144,48,2,15,48,1,6,46,0,184,255,240,64,15,0,46,
+21,41,1,1,14,23,80,30,22,7,80,14,1,0,63,225,63,225,17,57,47,51,63,1,47,56,
+51,94,93,93,17,51,47,93,93,93,18,57,57,61,47,24,47,17,51,51,17,18,57,17,51,
+49,48,35,1,39,46,3,35,34,6,7,53,54,54,51,50,30,2,23,1,22,22,51,50,54,55,21,
+6,6,35,34,46,2,39,3,46,3,39,35,6,6,7,3,14,1,184,53,13,31,43,61,43,34,50,20,
+26,66,35,74,105,79,63,31,1,72,18,46,38,14,38,8,23,55,37,39,59,47,37,15,135,
+11,29,27,22,5,6,13,53,31,229,4,51,160,41,67,49,27,7,5,145,7,10,42,89,135,
+93,252,54,54,57,7,3,133,12,14,17,40,64,46,1,162,33,94,97,87,25,77,170,79,
+253,193,0,0,1,0,174,254,20,4,18,4,74,0,29,0,63,64,38,13,12,9,71,10,85,31,
+16,31,32,31,96,31,112,31,128,31,5,20,0,26,71,27,84,30,26,27,20,13,3,80,17,
+22,11,21,28,9,15,0,63,51,63,63,225,51,51,63,1,16,246,225,50,50,93,16,246,
+225,50,50,49,48,1,20,22,51,50,62,2,53,17,51,17,35,39,35,6,6,35,34,38,39,22,
+23,22,22,21,17,35,17,51,1,100,106,111,82,110,67,28,182,147,27,10,48,144,103,
+72,106,35,1,2,2,1,182,182,1,135,130,130,52,101,148,96,2,58,251,182,147,83,
+84,46,42,38,40,35,85,42,254,192,6,54,0,1,0,0,0,0,3,207,4,74,0,20,0,59,64,
+22,20,19,7,7,0,13,71,14,87,22,16,22,1,176,22,1,15,22,1,6,1,0,184,255,240,
+182,0,7,20,21,13,0,15,0,63,50,63,51,1,47,56,50,94,93,93,113,16,246,225,18,
+57,61,47,51,51,49,48,17,51,19,30,3,23,51,62,2,18,53,51,20,2,2,6,7,35,188,
+201,12,31,30,25,5,6,90,114,66,25,182,37,92,154,117,192,4,74,253,176,33,99,
+103,92,25,96,205,231,1,5,151,163,254,224,254,245,253,127,0,0,1,0,113,254,
+111,3,106,6,20,0,70,0,126,64,78,50,59,59,17,42,1,65,70,56,45,45,36,28,0,1,
+16,1,32,1,3,8,1,1,28,70,32,17,1,17,72,63,72,95,72,127,72,239,72,4,16,72,1,
+7,72,36,86,71,60,50,56,80,57,42,0,73,28,89,28,105,28,3,56,28,1,7,36,28,3,
+22,1,79,0,0,22,57,0,22,250,0,63,63,18,57,47,225,17,23,57,93,93,17,57,16,225,
+50,50,1,16,246,225,93,93,16,214,93,241,192,47,94,93,17,18,57,47,51,225,18,
+57,17,51,47,51,49,48,1,21,35,34,14,2,21,20,30,2,23,30,3,21,20,14,2,7,35,62,
+3,53,52,46,2,39,38,38,53,52,62,2,55,53,38,38,53,52,62,2,55,6,7,6,6,35,35,
+53,33,21,35,34,14,2,21,20,30,2,51,3,35,162,81,127,87,45,45,84,120,75,71,95,
+58,25,21,34,43,22,170,24,43,34,20,14,48,91,77,178,184,47,78,102,55,101,114,
+45,79,107,62,34,39,33,85,46,62,2,129,55,73,145,115,71,32,70,114,81,3,119,
+137,49,85,113,65,78,96,59,34,17,15,46,59,72,42,45,88,82,75,31,32,72,72,67,
+29,20,37,34,31,15,34,199,181,77,127,99,67,17,12,28,134,117,72,102,73,49,19,
+3,3,2,4,153,141,38,78,117,78,53,81,55,28,0,255,255,0,113,255,236,4,45,4,94,
+2,6,0,82,0,0,0,1,0,25,255,236,4,201,4,74,0,24,0,88,64,56,10,71,143,22,1,22,
+22,14,3,20,20,0,3,16,3,2,3,3,26,47,26,159,26,239,26,3,16,13,71,47,14,239,
+14,255,14,3,14,64,16,21,72,14,84,25,21,12,16,80,18,15,14,21,0,80,7,22,0,63,
+225,63,63,225,50,50,1,16,246,43,93,225,51,93,17,51,47,93,51,47,17,18,57,47,
+93,225,49,48,37,50,54,55,21,6,6,35,34,38,53,17,33,17,35,17,35,53,55,33,21,
+35,17,20,22,4,80,28,47,15,15,74,48,113,113,254,109,182,221,137,4,39,211,47,
+129,13,8,144,9,17,132,130,2,190,252,80,3,176,74,80,154,253,78,70,55,0,0,2,
+0,164,254,20,4,45,4,94,0,26,0,39,0,57,64,33,37,72,0,87,41,207,41,1,64,41,
+1,15,41,1,6,31,9,15,71,16,84,40,27,80,22,16,15,27,34,80,8,5,22,0,63,51,225,
+63,63,225,1,16,246,225,50,50,94,93,93,93,16,246,225,49,48,1,20,14,2,35,34,
+38,39,35,22,23,22,22,21,17,35,17,52,62,2,51,50,30,2,1,34,6,7,17,22,22,51,
+50,54,53,52,38,4,45,63,117,167,104,75,143,54,6,1,2,2,1,182,65,120,169,105,
+97,163,119,67,254,59,137,130,3,54,143,75,140,123,125,2,39,137,213,145,76,
+45,45,43,46,39,97,46,254,221,4,19,136,211,145,75,75,145,211,1,24,196,200,
+254,172,51,49,211,209,209,207,0,1,0,113,254,111,3,111,4,94,0,49,0,81,64,54,
+39,39,21,70,16,0,10,16,10,32,10,3,10,51,63,51,95,51,127,51,239,51,4,16,51,
+1,0,72,31,86,50,40,45,81,55,10,1,40,21,56,21,72,21,3,21,10,31,0,4,15,36,16,
+15,250,0,63,63,18,23,57,93,93,225,50,1,16,246,225,93,93,16,214,93,50,225,
+51,47,49,48,1,20,30,2,23,30,3,21,20,14,2,7,35,62,3,53,52,46,2,39,46,3,53,
+52,62,2,51,50,22,23,7,46,3,35,34,14,2,1,45,28,73,126,97,71,95,58,25,21,34,
+43,22,170,24,43,34,20,14,48,91,77,77,132,98,55,73,131,179,106,78,149,50,54,
+23,56,60,58,26,80,114,73,34,2,6,96,121,78,47,22,15,46,59,72,42,45,88,82,75,
+31,32,72,72,67,29,20,37,34,31,15,15,65,118,180,130,154,226,149,73,34,25,154,
+10,19,15,9,57,112,164,0,2,0,113,255,236,4,133,4,74,0,22,0,41,0,54,64,33,36,
+33,72,18,16,0,87,43,16,43,144,43,160,43,176,43,224,43,5,23,72,10,86,42,18,
+37,80,15,15,28,80,5,22,0,63,225,63,225,50,1,16,246,225,93,16,246,50,50,225,
+50,49,48,1,20,14,2,35,34,46,2,53,52,62,2,51,33,21,33,30,3,5,20,30,2,51,50,
+62,2,53,52,38,39,35,34,14,2,4,45,62,122,180,117,107,175,125,68,77,144,206,
+128,1,233,254,246,37,65,48,28,253,0,33,71,110,77,76,109,71,33,79,75,59,95,
+139,90,43,1,248,111,192,141,80,70,138,203,133,156,218,138,62,154,41,93,108,
+124,54,85,144,105,59,55,98,134,78,144,215,89,44,99,161,0,0,1,0,18,255,229,
+3,102,4,74,0,28,0,58,64,36,1,15,13,31,13,2,6,13,87,30,16,30,1,43,26,59,26,
+2,26,3,71,16,24,224,24,2,24,2,25,80,28,15,8,80,19,22,0,63,225,63,225,50,1,
+47,93,225,198,93,93,16,230,94,93,50,49,48,1,21,33,17,20,30,2,51,50,62,2,55,
+21,14,3,35,34,46,2,53,17,33,53,55,3,102,254,140,25,45,62,36,18,42,40,36,13,
+13,39,46,53,27,64,117,89,52,254,215,134,4,74,154,253,162,59,82,51,23,3,6,
+7,4,135,6,12,11,6,29,77,134,104,2,115,74,80,0,0,1,0,164,255,236,4,61,4,74,
+0,29,0,41,64,24,16,71,27,87,31,16,31,96,31,128,31,3,8,71,5,84,30,21,6,15,
+13,80,0,22,0,63,225,63,51,1,16,246,225,93,16,246,225,49,48,5,34,46,2,53,17,
+51,17,20,30,2,51,50,54,53,52,46,2,39,51,30,3,21,16,2,2,92,129,170,100,41,
+182,32,66,102,70,146,141,9,16,23,15,182,15,24,16,8,244,20,80,140,189,109,
+2,88,253,178,86,140,99,54,232,247,71,125,117,116,61,61,114,119,129,75,254,
+193,254,211,0,2,0,113,254,20,5,37,4,94,0,37,0,53,0,94,64,60,49,37,71,22,150,
+0,166,0,2,0,0,6,38,72,31,87,55,32,55,1,15,55,1,224,55,1,111,55,127,55,159,
+55,3,64,55,1,15,55,31,55,2,6,17,71,6,86,54,43,80,11,26,16,49,22,80,36,1,22,
+0,27,0,63,63,51,225,50,63,51,225,1,16,246,225,94,93,93,93,93,113,113,16,246,
+225,17,57,47,93,51,225,50,49,48,1,17,46,3,53,52,62,2,55,23,14,3,21,20,30,
+2,23,17,52,54,51,50,30,2,21,20,14,2,7,17,1,52,46,2,35,34,14,2,21,17,62,3,
+2,102,109,183,134,75,32,56,78,45,141,37,63,45,25,51,88,116,64,165,145,90,
+146,102,55,86,144,190,104,1,79,30,54,73,43,27,49,37,22,72,123,89,51,254,20,
+1,218,5,67,137,213,151,83,152,138,125,55,96,51,104,114,125,71,111,153,97,
+48,7,2,94,188,193,80,144,201,122,149,217,144,74,5,254,38,4,37,98,148,101,
+51,23,53,87,65,253,160,7,59,107,159,0,0,1,255,236,254,20,4,37,4,78,0,40,0,
+160,64,26,104,31,120,31,2,31,103,9,119,9,199,9,3,9,6,118,28,1,55,28,1,28,
+28,30,7,8,184,255,192,64,14,19,22,72,52,8,1,8,16,8,8,192,18,1,18,184,255,
+192,64,25,6,11,72,18,18,42,15,42,63,42,79,42,207,42,4,6,176,37,192,37,2,37,
+37,29,30,184,255,240,64,31,30,30,41,30,27,23,6,39,6,2,24,28,40,28,2,28,9,
+31,6,4,0,15,80,22,27,7,15,35,80,0,15,0,63,225,63,63,225,18,23,57,93,93,63,
+17,1,51,47,56,51,51,47,93,94,93,17,51,47,43,93,51,47,56,93,43,51,18,57,61,
+47,93,93,51,51,93,51,93,49,48,19,50,30,2,23,19,1,51,1,19,30,3,51,50,54,55,
+21,6,6,35,34,46,2,39,3,1,35,1,3,38,38,35,34,7,53,54,54,188,45,73,58,49,21,
+123,1,31,178,254,115,178,14,29,38,52,37,26,46,16,22,57,40,67,95,71,51,23,
+131,254,182,194,1,198,160,27,71,53,36,28,22,62,4,78,31,62,92,61,254,168,2,
+74,252,248,254,32,38,66,51,29,5,3,141,6,11,38,70,102,65,1,106,253,131,3,62,
+1,190,79,89,10,143,7,10,0,0,1,0,164,254,20,5,113,6,18,0,39,0,76,64,47,1,23,
+71,38,24,24,30,6,71,17,87,41,48,41,64,41,144,41,176,41,192,41,5,15,41,31,
+41,2,6,33,71,30,84,40,11,31,15,1,38,80,22,25,22,23,27,0,0,0,63,63,63,51,225,
+50,63,51,1,16,246,225,94,93,93,16,246,225,17,57,47,51,225,50,49,48,1,17,62,
+3,53,52,46,2,39,51,30,3,21,20,14,2,7,17,35,17,46,3,53,17,51,17,20,30,2,23,
+17,3,86,78,131,95,52,8,15,24,16,182,16,24,16,8,87,147,196,109,178,111,188,
+137,76,182,54,90,120,66,6,18,250,115,9,60,108,156,103,71,128,126,131,73,72,
+131,126,126,68,157,220,140,69,7,254,38,1,218,4,65,136,214,154,2,31,253,217,
+114,154,97,46,5,5,143,0,1,0,113,255,236,5,150,4,74,0,59,0,112,64,72,56,103,
+29,1,29,71,213,26,1,183,26,1,169,26,1,154,26,1,3,26,26,5,37,72,48,87,61,4,
+61,20,61,2,196,61,244,61,2,123,61,155,61,2,64,61,1,2,48,61,1,15,61,31,61,
+2,6,16,72,5,86,60,27,27,42,10,15,32,21,80,57,53,0,22,0,63,50,50,225,50,63,
+51,57,47,1,16,246,225,94,93,93,95,93,93,93,113,16,246,225,17,57,47,95,93,
+93,93,93,225,93,57,49,48,5,34,46,2,53,52,62,2,55,51,14,3,21,20,30,2,51,50,
+62,2,53,17,51,17,20,22,51,50,62,2,53,52,46,2,39,51,30,3,21,20,14,2,35,34,
+38,39,35,6,6,1,233,90,140,96,50,15,31,47,32,186,32,47,31,15,29,54,75,45,46,
+68,44,22,178,99,81,45,75,54,29,15,31,47,32,187,32,47,31,15,50,96,141,90,107,
+139,31,10,31,139,20,82,146,203,121,81,143,135,135,72,73,134,135,142,82,98,
+150,101,52,41,72,98,57,1,50,254,206,129,139,52,101,150,98,82,142,135,134,
+73,72,135,135,143,81,121,203,146,82,87,91,91,87,0,255,255,0,21,255,236,2,
+119,5,217,2,38,1,134,0,0,1,7,0,106,254,226,0,0,0,23,64,13,2,1,31,17,38,2,
+1,50,22,42,20,0,37,1,43,53,53,0,43,53,53,0,255,255,0,164,255,236,4,61,5,217,
+2,38,1,146,0,0,1,6,0,106,0,0,0,25,182,2,1,39,17,38,2,1,184,255,222,180,30,
+50,5,27,37,1,43,53,53,0,43,53,53,0,255,255,0,113,255,236,4,45,6,33,2,38,0,
+82,0,0,1,6,1,84,14,0,0,19,64,11,2,44,17,38,2,61,32,38,10,0,37,1,43,53,0,43,
+53,0,255,255,0,164,255,236,4,61,6,33,2,38,1,146,0,0,1,6,1,84,16,0,0,19,64,
+11,1,42,17,38,1,29,30,36,5,27,37,1,43,53,0,43,53,0,255,255,0,113,255,236,
+5,150,6,33,2,38,1,150,0,0,1,7,1,84,0,195,0,0,0,33,64,9,1,72,17,38,1,96,60,
+1,60,184,255,192,64,9,9,11,72,61,60,66,5,48,37,1,43,43,93,53,0,43,53,0,255,
+255,0,199,0,0,3,190,7,43,2,38,0,40,0,0,1,7,0,106,255,245,1,82,0,23,64,13,
+2,1,21,5,38,2,1,1,12,32,1,0,37,1,43,53,53,0,43,53,53,0,0,1,0,20,255,236,5,
+6,5,182,0,37,0,133,64,90,4,4,19,12,90,15,33,1,223,33,255,33,2,33,85,39,15,
+39,111,39,127,39,3,6,26,244,24,1,160,24,176,24,2,116,24,1,24,24,18,90,19,
+0,21,48,21,64,21,80,21,192,21,5,21,21,176,19,1,103,19,119,19,2,94,19,1,63,
+19,79,19,2,0,19,1,19,17,95,26,26,7,25,21,95,22,3,19,18,7,95,0,19,0,63,225,
+63,63,225,50,18,57,47,225,1,47,93,93,93,93,93,51,47,93,16,225,50,47,93,93,
+93,50,94,93,16,246,93,113,225,18,57,47,49,48,5,34,38,39,53,22,22,51,50,62,
+2,53,53,52,38,35,33,17,35,17,33,53,33,21,33,17,33,50,30,2,21,21,20,14,2,3,
+158,47,70,25,29,68,39,32,64,51,33,105,123,254,187,187,254,172,3,177,254,94,
+1,90,93,146,101,53,53,95,132,20,13,11,160,9,12,19,51,87,69,133,115,116,253,
+35,5,18,164,164,254,111,49,94,139,89,137,105,154,101,49,255,255,0,199,0,0,
+3,190,7,115,2,38,1,97,0,0,1,7,0,118,0,51,1,82,0,19,64,11,1,18,5,38,1,62,6,
+12,4,0,37,1,43,53,0,43,53,0,0,1,0,125,255,236,4,152,5,203,0,38,0,95,64,19,
+17,64,19,24,72,7,17,7,17,27,202,35,1,112,35,128,35,2,35,184,255,192,64,36,
+7,10,72,35,35,40,191,40,1,5,8,91,27,102,39,8,95,15,5,175,5,2,8,5,5,13,36,
+0,95,32,4,13,95,16,22,19,0,63,51,225,63,225,51,18,57,47,94,93,225,1,16,246,
+225,50,93,17,51,47,43,93,93,18,57,57,47,47,43,49,48,1,34,14,2,7,33,21,33,
+30,3,51,50,54,55,21,14,3,35,34,38,38,2,53,52,18,54,54,51,50,22,23,7,38,38,
+3,25,95,160,120,77,13,2,116,253,134,5,64,118,171,113,89,160,78,39,78,85,97,
+59,164,240,157,76,87,169,250,162,108,196,79,78,63,148,5,39,65,122,175,111,
+162,130,201,138,72,35,23,162,15,23,14,7,108,198,1,22,169,166,1,20,198,110,
+44,42,156,32,46,255,255,0,104,255,236,3,201,5,203,2,6,0,54,0,0,255,255,0,
+82,0,0,2,100,5,182,2,6,0,44,0,0,255,255,0,64,0,0,2,119,7,43,2,38,0,44,0,0,
+1,7,0,106,255,13,1,82,0,23,64,13,2,1,21,5,38,2,1,0,12,32,1,0,37,1,43,53,53,
+0,43,53,53,0,255,255,255,72,254,123,1,115,5,182,2,6,0,45,0,0,0,2,0,0,255,
+233,6,223,5,182,0,42,0,53,0,141,181,37,43,90,6,13,8,184,255,248,64,83,20,
+23,72,8,90,35,153,30,1,30,16,30,35,0,6,144,6,2,6,224,35,1,180,35,196,35,212,
+35,3,0,35,80,35,144,35,160,35,4,7,6,35,6,35,21,47,91,0,103,55,207,55,1,55,
+64,6,9,72,21,21,54,53,95,15,37,175,37,2,8,37,37,43,8,95,35,3,25,96,18,19,
+43,96,6,18,0,63,225,63,225,63,225,18,57,47,94,93,225,17,1,51,47,43,93,16,
+246,225,17,57,57,47,47,94,93,93,93,94,93,17,51,56,93,16,225,43,50,16,225,
+50,49,48,1,20,14,2,35,33,17,33,14,3,7,14,3,35,34,38,39,53,22,22,51,50,62,
+2,55,54,54,18,18,55,33,17,51,50,30,2,1,51,50,54,53,52,46,2,35,35,6,223,60,
+126,194,134,254,191,254,194,15,31,33,34,16,20,53,79,110,78,35,74,28,23,58,
+32,48,62,42,26,12,12,32,39,43,22,2,147,109,152,207,126,55,253,119,119,174,
+164,46,91,139,93,88,1,172,97,158,112,61,5,18,113,244,236,212,81,103,162,111,
+59,14,11,154,13,16,63,98,117,54,57,200,1,6,1,58,170,253,152,66,113,152,254,
+157,132,136,70,97,60,27,0,2,0,199,0,0,7,12,5,182,0,22,0,33,0,83,64,50,17,
+23,90,14,6,6,10,27,91,0,103,35,15,35,1,15,35,31,35,127,35,255,35,4,13,9,90,
+10,100,34,33,8,95,17,15,13,175,13,2,8,13,13,15,11,3,23,96,10,6,18,0,63,51,
+225,63,51,57,47,94,93,51,225,50,1,16,246,225,50,93,113,16,246,225,17,57,47,
+51,225,50,49,48,1,20,14,2,35,33,17,33,17,35,17,51,17,33,17,51,17,51,50,30,
+2,1,51,50,54,53,52,46,2,35,35,7,12,60,126,194,134,254,191,253,184,186,186,
+2,72,186,109,152,207,126,55,253,119,119,174,164,46,91,139,93,88,1,172,97,
+158,112,61,2,170,253,86,5,182,253,152,2,104,253,152,66,113,152,254,157,132,
+136,70,97,60,27,0,0,1,0,20,0,0,5,6,5,182,0,21,0,115,64,77,8,90,7,85,23,15,
+23,111,23,127,23,3,6,244,20,1,160,20,176,20,2,116,20,1,20,20,0,14,90,15,0,
+17,48,17,64,17,80,17,192,17,5,17,17,176,15,1,103,15,119,15,2,94,15,1,63,15,
+79,15,2,0,15,1,15,21,17,95,18,13,95,0,0,7,18,3,15,7,18,0,63,51,63,18,57,47,
+225,16,225,50,1,47,93,93,93,93,93,51,47,93,16,225,50,50,47,93,93,93,94,93,
+16,246,225,49,48,1,33,50,30,2,21,17,35,17,52,38,35,33,17,35,17,33,53,33,21,
+33,2,35,1,90,93,146,101,53,186,105,123,254,187,187,254,172,3,177,254,94,3,
+129,49,94,139,89,253,242,1,246,115,116,253,35,5,18,164,164,255,255,0,199,
+0,0,4,162,7,115,2,38,1,180,0,0,1,7,0,118,0,137,1,82,0,19,64,11,1,23,5,38,
+1,34,11,17,4,0,37,1,43,53,0,43,53,0,255,255,0,25,255,236,4,174,7,105,2,38,
+1,189,0,0,1,7,2,54,0,35,1,82,0,19,64,11,1,39,5,38,1,13,44,34,19,0,37,1,43,
+53,0,43,53,0,0,1,0,199,254,127,4,193,5,182,0,11,0,99,64,65,198,2,214,2,2,
+2,90,197,3,213,3,2,168,3,1,150,3,1,3,16,14,17,72,71,3,1,58,3,1,3,3,5,9,90,
+0,101,13,176,13,1,111,13,159,13,175,13,3,16,13,1,8,90,5,100,12,10,6,3,8,95,
+5,2,2,1,5,0,47,51,51,47,16,225,63,51,1,16,246,225,93,93,93,16,246,225,17,
+57,47,93,93,43,93,93,93,225,93,49,48,33,33,17,35,17,33,17,51,17,33,17,51,
+4,193,254,90,177,254,93,186,2,133,187,254,127,1,129,5,182,250,240,5,16,255,
+255,0,0,0,0,4,221,5,188,2,6,0,36,0,0,0,2,0,199,0,0,4,51,5,182,0,16,0,27,0,
+75,64,46,95,8,1,8,8,17,21,91,0,103,29,15,29,95,29,127,29,207,29,4,6,11,17,
+90,6,100,28,27,95,15,11,175,11,2,8,11,11,17,10,95,7,3,17,96,6,18,0,63,225,
+63,225,18,57,47,94,93,225,1,16,246,225,50,94,93,16,246,225,18,57,47,93,49,
+48,1,20,14,2,35,33,17,33,21,33,17,51,50,30,2,1,51,50,54,53,52,46,2,35,35,
+4,51,60,126,194,134,254,150,3,20,253,166,150,152,207,126,55,253,78,160,174,
+164,46,91,139,93,129,1,172,97,158,112,61,5,182,164,254,60,66,113,152,254,
+157,132,136,70,97,60,27,0,255,255,0,199,0,0,4,135,5,182,2,6,0,37,0,0,255,
+255,0,199,0,0,3,190,5,182,2,6,1,97,0,0,0,2,0,14,254,127,5,10,5,182,0,17,0,
+27,0,139,64,11,24,27,40,27,2,27,7,55,20,1,20,184,255,248,64,11,20,23,72,20,
+90,14,15,7,1,7,7,184,255,240,64,16,48,14,192,14,2,7,14,7,14,5,18,90,16,1,
+90,0,184,255,192,64,37,16,21,72,0,0,16,101,29,32,29,1,15,29,1,8,4,90,5,5,
+28,20,95,14,3,9,81,8,27,16,6,95,3,0,5,5,3,18,0,63,51,47,51,16,225,50,50,47,
+226,63,225,17,1,51,47,225,94,93,93,16,228,50,47,43,225,16,225,17,57,57,47,
+47,93,56,94,93,16,225,43,93,17,51,93,49,48,1,35,17,33,17,35,17,51,62,5,55,
+33,17,51,33,17,33,14,5,7,5,10,176,252,100,176,113,47,86,77,65,48,29,4,2,101,
+194,254,131,254,250,4,31,46,61,70,77,39,254,127,1,129,254,127,2,39,85,200,
+217,230,232,227,105,250,240,4,106,76,185,202,209,200,183,75,0,255,255,0,199,
+0,0,3,190,5,182,2,6,0,40,0,0,0,1,0,4,0,0,6,129,5,182,0,17,0,203,64,78,102,
+9,118,9,134,9,3,55,9,71,9,87,9,3,9,6,6,71,13,247,13,2,13,90,105,0,121,0,137,
+0,3,56,0,72,0,88,0,3,0,3,3,168,14,184,14,2,153,14,1,134,14,1,87,14,103,14,
+119,14,3,14,14,17,10,7,8,8,11,0,10,1,112,10,128,10,192,10,3,10,184,255,192,
+64,38,7,10,72,10,16,10,10,19,240,19,1,191,19,207,19,223,19,3,160,19,1,143,
+19,1,64,19,1,15,19,31,19,2,8,2,1,1,16,17,184,255,240,64,15,17,17,18,6,3,3,
+4,17,10,14,18,7,1,4,3,0,63,51,51,63,51,51,18,57,17,51,17,1,51,47,56,51,51,
+17,51,94,93,93,93,93,93,93,17,51,47,56,43,93,113,51,51,17,51,17,18,57,47,
+93,93,93,93,51,17,51,93,93,225,93,50,17,51,93,93,49,48,1,1,51,1,17,51,17,
+1,51,1,1,35,1,17,35,17,1,35,2,37,253,237,205,2,10,179,2,10,205,253,237,2,
+33,211,253,238,179,253,238,211,2,242,2,196,253,60,2,196,253,60,2,196,253,
+60,253,14,2,229,253,27,2,229,253,27,0,0,1,0,72,255,236,3,236,5,203,0,57,0,
+104,64,63,39,91,0,5,33,0,48,33,0,0,33,48,3,19,28,91,11,103,59,159,59,1,112,
+19,128,19,2,63,19,79,19,95,19,3,19,19,58,5,32,96,170,33,1,120,33,1,15,33,
+1,8,33,33,25,47,44,96,53,4,25,96,20,16,19,0,63,51,225,63,225,51,18,57,47,
+94,93,93,93,225,57,17,1,51,47,93,93,93,16,246,225,18,23,57,47,47,47,17,18,
+57,16,225,49,48,1,20,14,2,7,21,30,3,21,20,14,2,35,34,38,39,53,30,3,51,50,
+54,53,52,38,35,35,53,51,50,62,2,53,52,46,2,35,34,6,7,39,62,3,51,50,30,2,3,
+209,51,91,125,75,87,138,94,50,67,136,205,137,110,192,85,43,96,99,99,46,178,
+176,207,186,191,176,92,142,97,50,37,68,95,58,110,169,75,92,38,98,116,131,
+71,109,166,113,57,4,96,73,120,88,57,12,6,11,57,89,119,72,96,160,116,64,34,
+45,170,23,36,24,13,148,135,135,129,151,39,72,101,61,54,83,58,30,67,54,125,
+31,54,41,24,54,97,133,0,0,1,0,201,0,0,5,16,5,182,0,23,0,107,64,27,20,11,14,
+90,13,101,25,208,25,1,175,25,1,32,25,48,25,2,22,9,2,90,23,100,24,23,9,184,
+255,232,179,20,24,72,9,184,255,224,64,35,10,19,72,6,9,22,9,38,9,3,9,13,18,
+20,24,20,24,72,20,32,10,19,72,9,20,25,20,41,20,3,7,20,11,0,3,0,63,50,50,94,
+93,43,43,63,51,93,43,43,51,1,16,246,225,50,50,93,93,93,16,246,225,50,50,49,
+48,19,51,17,20,14,2,7,6,7,51,1,51,17,35,17,52,54,55,54,55,35,1,35,201,174,
+1,2,2,2,4,4,7,2,204,213,172,6,4,4,5,8,253,49,215,5,182,252,224,26,62,67,67,
+32,74,76,4,180,250,74,3,25,57,142,65,76,77,251,70,0,255,255,0,201,0,0,5,16,
+7,105,2,38,1,178,0,0,1,7,2,54,0,137,1,82,0,21,180,1,29,5,38,1,184,255,235,
+180,34,24,0,12,37,1,43,53,0,43,53,0,0,1,0,199,0,0,4,162,5,182,0,10,0,94,64,
+33,8,9,9,16,9,1,0,0,16,0,2,7,0,16,0,0,12,176,12,1,47,12,1,16,12,1,151,10,
+1,86,10,1,10,184,255,248,64,20,8,12,72,10,7,7,3,90,4,100,11,7,2,4,8,5,3,4,
+0,18,0,63,50,63,51,18,57,57,1,16,246,225,50,17,51,43,93,93,93,93,93,17,51,
+47,56,94,93,51,51,56,17,51,49,48,33,35,1,17,35,17,51,17,1,51,1,4,162,219,
+253,186,186,186,2,53,207,253,203,2,229,253,27,5,182,253,60,2,196,253,66,0,
+0,1,0,0,255,233,4,147,5,182,0,31,0,98,177,8,3,184,255,248,64,59,20,23,72,
+3,90,137,25,1,25,16,25,224,30,1,180,30,196,30,212,30,3,0,30,80,30,128,30,
+3,7,30,30,16,1,90,0,101,33,15,33,31,33,127,33,3,8,16,16,32,3,95,30,3,20,96,
+17,13,19,0,18,0,63,63,51,225,63,225,17,1,51,47,94,93,16,246,225,17,57,47,
+94,93,93,93,51,56,93,225,43,50,49,48,33,35,17,33,14,3,7,14,3,35,34,38,39,
+53,22,22,51,50,62,2,55,54,54,18,18,55,33,4,147,186,254,133,15,31,33,34,16,
+20,53,79,110,78,35,74,28,23,58,32,48,62,42,26,12,12,32,39,43,22,2,208,5,18,
+113,244,236,212,81,103,162,111,59,14,11,154,13,16,63,98,117,54,57,200,1,6,
+1,58,170,0,255,255,0,199,0,0,6,47,5,182,2,6,0,48,0,0,255,255,0,199,0,0,4,
+213,5,182,2,6,0,43,0,0,255,255,0,125,255,236,5,113,5,205,2,6,0,50,0,0,255,
+255,0,199,0,0,4,193,5,182,2,6,1,110,0,0,255,255,0,199,0,0,4,51,5,182,2,6,
+0,51,0,0,255,255,0,125,255,236,4,152,5,203,2,6,0,38,0,0,255,255,0,20,0,0,
+4,18,5,182,2,6,0,55,0,0,0,1,0,25,255,236,4,174,5,182,0,33,0,111,64,16,18,
+1,27,27,19,33,96,0,112,0,176,0,240,0,4,0,184,255,192,64,16,6,10,72,0,16,0,
+0,35,15,35,127,35,2,20,9,19,184,255,240,64,12,19,19,34,231,26,247,26,2,214,
+26,1,26,184,255,224,64,16,10,14,72,18,1,26,3,0,13,95,10,6,19,19,0,3,0,63,
+50,63,51,225,17,23,57,43,93,93,17,1,51,47,56,51,51,93,17,51,47,56,43,93,51,
+18,57,17,51,51,49,48,1,1,14,3,35,34,38,39,53,22,22,51,50,62,2,55,1,51,1,30,
+3,23,51,62,3,55,1,4,174,254,84,38,83,112,156,111,51,90,37,37,89,52,53,82,
+66,56,28,253,238,204,1,127,5,10,9,9,4,2,3,11,11,11,3,1,55,5,182,251,250,93,
+164,123,72,15,15,185,20,25,23,53,86,63,4,63,252,215,10,24,26,23,9,9,31,33,
+29,7,3,24,0,255,255,0,104,255,236,5,186,5,203,2,6,1,115,0,0,255,255,0,0,0,
+0,4,96,5,182,2,6,0,59,0,0,0,1,0,199,254,127,5,113,5,182,0,11,0,59,64,33,3,
+90,2,2,9,90,0,13,176,13,1,175,13,1,16,13,1,8,90,5,100,12,10,6,3,0,8,95,5,
+2,2,5,18,0,63,51,47,16,225,50,63,51,1,16,246,225,93,93,93,16,212,225,51,47,
+225,49,48,37,51,17,35,17,33,17,51,17,33,17,51,4,193,176,176,252,6,186,2,133,
+187,166,253,217,1,129,5,182,250,240,5,16,0,1,0,166,0,0,4,129,5,182,0,21,0,
+72,64,29,19,1,90,0,101,23,112,23,160,23,2,47,23,1,16,23,1,13,90,96,10,112,
+10,160,10,176,10,4,10,184,255,192,64,14,7,10,72,10,19,16,95,5,5,20,11,3,0,
+18,0,63,63,51,57,47,225,51,1,47,43,93,225,93,93,93,16,246,225,50,49,48,33,
+35,17,6,6,35,34,46,2,53,17,51,17,20,22,51,50,54,55,17,51,4,129,186,115,195,
+98,93,146,101,53,186,105,123,90,185,112,186,2,86,44,46,49,95,138,89,2,71,
+253,209,115,116,40,40,2,198,0,1,0,199,0,0,7,51,5,182,0,11,0,96,64,66,86,8,
+1,8,90,23,5,1,134,5,150,5,166,5,3,103,5,119,5,2,5,5,1,9,90,0,101,13,0,13,
+16,13,2,32,13,80,13,112,13,128,13,192,13,208,13,224,13,7,15,13,1,7,4,90,1,
+100,12,10,6,2,3,8,4,95,1,18,0,63,225,50,63,51,51,1,16,246,225,94,93,93,113,
+16,246,225,17,57,47,93,93,113,225,93,49,48,33,33,17,51,17,33,17,51,17,33,
+17,51,7,51,249,148,186,2,31,186,2,31,186,5,182,250,240,5,16,250,240,5,16,
+0,0,1,0,199,254,127,7,227,5,182,0,15,0,113,64,75,86,12,1,12,90,23,9,1,134,
+9,150,9,166,9,3,103,9,119,9,2,9,9,5,13,90,0,3,90,2,2,0,101,17,0,17,16,17,
+2,32,17,80,17,112,17,128,17,192,17,208,17,224,17,7,15,17,1,7,8,90,5,100,16,
+14,10,6,3,12,0,8,95,5,2,2,5,18,0,63,51,47,16,225,50,50,63,51,51,1,16,246,
+225,94,93,93,113,16,228,50,47,225,16,225,17,57,47,93,93,113,225,93,49,48,
+37,51,17,35,17,33,17,51,17,33,17,51,17,33,17,51,7,51,176,176,249,148,186,
+2,31,186,2,31,186,166,253,217,1,129,5,182,250,240,5,16,250,240,5,16,0,0,2,
+0,20,0,0,4,213,5,182,0,16,0,27,0,82,64,51,11,17,90,144,6,1,6,6,8,21,91,0,
+103,29,15,29,1,15,29,47,29,63,29,95,29,175,29,5,6,8,8,28,27,95,15,11,175,
+11,2,8,11,11,17,8,95,9,3,17,96,6,18,0,63,225,63,225,18,57,47,94,93,225,17,
+1,51,47,94,93,113,16,246,225,17,57,47,93,225,50,49,48,1,20,14,2,35,33,17,
+33,53,33,17,51,50,30,2,1,51,50,54,53,52,46,2,35,35,4,213,60,126,194,134,254,
+149,254,172,2,15,149,152,207,127,55,253,78,160,174,163,45,92,138,93,129,1,
+172,97,158,112,61,5,18,164,253,152,66,113,152,254,157,132,136,70,97,60,27,
+0,3,0,199,0,0,5,207,5,182,0,14,0,25,0,29,0,73,64,43,19,91,0,0,1,0,0,6,26,
+90,29,101,31,15,31,159,31,2,6,9,15,90,6,100,30,25,95,15,9,175,9,2,8,9,9,27,
+7,3,15,96,26,6,18,0,63,51,225,63,51,57,47,94,93,225,1,16,246,225,50,94,93,
+16,246,225,17,57,47,93,225,49,48,1,20,14,2,35,33,17,51,17,51,50,30,2,1,51,
+50,54,53,52,46,2,35,35,1,17,51,17,4,51,60,126,194,134,254,150,186,150,152,
+207,126,55,253,78,160,174,164,46,91,139,93,129,3,147,187,1,172,97,158,112,
+61,5,182,253,152,66,113,152,254,157,132,136,70,97,60,27,253,86,5,182,250,
+74,0,2,0,199,0,0,4,51,5,182,0,14,0,25,0,72,64,46,19,91,144,0,1,0,103,27,15,
+27,95,27,2,6,27,64,21,24,72,27,64,13,19,72,9,15,90,6,100,26,25,95,15,9,175,
+9,2,8,9,9,7,3,15,96,6,18,0,63,225,63,57,47,94,93,225,1,16,246,225,50,43,43,
+94,93,16,246,93,225,49,48,1,20,14,2,35,33,17,51,17,51,50,30,2,1,51,50,54,
+53,52,46,2,35,35,4,51,60,126,194,134,254,150,186,150,152,207,126,55,253,78,
+160,174,164,46,91,139,93,129,1,172,97,158,112,61,5,182,253,152,66,113,152,
+254,157,132,136,70,97,60,27,0,1,0,59,255,236,4,68,5,203,0,36,0,81,64,47,29,
+32,91,12,22,30,22,30,4,12,103,38,191,38,207,38,223,38,3,4,4,37,30,95,170,
+31,1,120,31,1,15,31,1,8,31,31,7,26,95,23,17,19,3,0,95,7,4,0,63,225,51,63,
+51,225,17,57,47,94,93,93,93,225,17,1,51,47,93,16,230,17,57,57,47,47,16,225,
+50,49,48,1,34,6,7,39,54,54,51,50,22,22,18,21,20,2,6,6,35,34,46,2,39,53,22,
+22,51,50,18,19,33,53,33,46,3,1,186,94,148,63,78,79,196,108,162,244,162,82,
+82,165,247,164,58,97,86,78,39,78,160,89,237,247,6,253,139,2,113,9,71,115,
+157,5,39,46,32,156,42,44,109,193,254,246,157,179,254,224,202,109,7,14,23,
+15,162,23,35,1,23,1,6,162,111,176,122,64,0,2,0,199,255,236,7,158,5,205,0,
+26,0,46,0,94,64,60,27,91,10,144,17,1,17,17,13,37,91,0,103,48,15,48,1,63,48,
+111,48,127,48,239,48,255,48,5,48,64,17,20,72,16,12,90,13,100,47,42,95,22,
+4,11,95,15,16,1,8,16,16,13,14,3,13,18,32,95,5,19,0,63,225,63,63,18,57,47,
+94,93,225,63,225,1,16,246,225,50,43,93,113,16,246,225,17,57,47,93,51,225,
+49,48,1,20,2,6,6,35,34,38,38,2,39,33,17,35,17,51,17,33,62,3,51,50,22,22,18,
+5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,7,158,79,155,229,150,151,225,152,
+80,6,254,174,186,186,1,86,11,85,152,219,145,149,229,154,79,251,250,49,103,
+157,108,109,157,102,48,48,101,157,108,109,158,103,49,2,221,169,254,234,198,
+108,100,183,1,3,160,253,86,5,182,253,152,146,236,167,90,107,197,254,235,171,
+137,219,153,81,81,153,219,137,138,218,151,81,81,151,218,0,0,2,0,25,0,0,3,
+242,5,182,0,15,0,28,0,155,64,9,6,0,1,230,0,246,0,2,0,184,255,248,64,36,11,
+15,72,28,14,90,3,0,0,8,13,101,30,63,30,143,30,159,30,191,30,223,30,5,32,30,
+1,6,1,1,230,1,246,1,2,1,184,255,248,64,13,11,15,72,1,75,2,1,2,64,8,11,72,
+2,184,255,240,64,38,2,2,22,91,223,8,239,8,255,8,3,8,64,15,19,72,7,8,23,8,
+2,8,8,102,29,28,96,3,15,15,1,17,96,11,3,14,1,18,0,63,51,63,225,18,57,47,51,
+225,1,16,246,94,93,43,93,225,51,47,56,43,93,51,43,93,113,93,93,16,246,17,
+57,17,51,225,50,43,93,113,49,48,1,1,35,1,46,3,53,52,54,51,33,17,35,17,17,
+35,34,14,2,21,20,30,2,51,51,2,66,254,178,219,1,125,55,99,75,44,253,251,1,
+117,187,188,74,115,79,41,39,78,119,81,180,2,92,253,164,2,143,20,62,97,136,
+93,198,201,250,74,2,92,2,187,29,62,97,68,66,105,74,40,0,255,255,0,94,255,
+236,3,156,4,94,2,6,0,68,0,0,0,2,0,117,255,236,4,33,6,35,0,39,0,59,0,73,64,
+44,45,72,9,30,87,61,208,61,1,127,61,1,64,61,1,15,61,1,6,19,55,72,0,86,60,
+50,80,19,25,25,8,40,80,35,22,9,8,11,16,72,9,81,8,1,0,63,225,43,63,225,17,
+57,47,51,225,1,16,246,225,50,94,93,93,93,93,16,246,50,225,49,48,19,52,18,
+54,54,55,54,54,55,23,14,3,7,14,3,7,51,62,3,51,50,30,2,21,20,14,2,35,34,46,
+2,1,50,62,2,53,52,46,2,35,34,14,2,7,20,30,2,117,49,104,162,113,125,242,102,
+33,50,123,125,117,44,62,100,72,41,4,13,18,62,84,107,64,99,150,101,50,69,124,
+174,104,107,173,123,66,1,225,60,98,70,38,26,58,90,65,61,106,83,57,13,25,65,
+114,2,147,181,1,25,203,126,25,27,49,20,160,8,22,24,24,10,14,66,113,165,113,
+29,60,49,32,73,131,180,108,137,206,138,69,89,173,253,254,148,39,88,143,105,
+84,134,95,51,48,68,73,26,100,188,147,89,0,3,0,174,0,0,4,25,4,74,0,21,0,32,
+0,43,0,92,64,58,3,27,33,70,0,0,15,22,71,9,87,45,32,45,1,64,45,144,45,176,
+45,208,45,240,45,5,15,45,1,6,38,27,71,15,84,44,3,26,80,191,38,1,121,38,137,
+38,2,38,38,27,37,80,16,15,27,80,15,21,0,63,225,63,225,18,57,47,93,93,225,
+57,1,16,246,225,50,94,93,93,113,16,246,225,18,57,47,225,18,57,49,48,1,20,
+6,7,21,30,3,21,20,14,2,35,33,17,33,50,30,2,3,52,38,35,33,17,33,50,62,2,3,
+52,38,35,33,17,51,50,62,2,3,246,123,107,56,97,71,41,47,101,159,113,254,57,
+1,197,83,142,103,59,144,130,128,255,0,1,4,56,93,67,38,30,109,108,254,245,
+236,62,92,63,31,3,53,104,117,18,7,7,36,61,91,63,67,116,86,48,4,74,28,64,107,
+253,199,92,72,254,168,18,42,69,2,12,77,64,254,215,15,36,60,0,0,1,0,174,0,
+0,3,10,4,74,0,5,0,47,64,28,0,0,16,0,2,0,0,7,160,7,1,129,7,1,80,7,1,2,71,3,
+84,6,1,80,4,15,2,21,0,63,63,225,1,16,246,225,93,93,93,17,51,47,93,49,48,1,
+33,17,35,17,33,3,10,254,90,182,2,92,3,176,252,80,4,74,0,2,0,41,254,131,4,
+55,4,74,0,15,0,23,0,121,64,16,23,7,18,70,12,47,7,63,7,2,11,7,27,7,2,7,184,
+255,240,64,57,162,12,178,12,2,4,12,20,12,2,7,12,7,12,5,16,71,14,1,70,0,0,
+32,14,1,14,85,25,175,25,207,25,2,48,25,1,47,25,1,4,70,5,5,24,18,79,12,15,
+23,14,6,80,3,21,5,0,251,0,63,50,63,225,50,50,63,225,17,1,51,47,225,93,93,
+93,16,228,93,50,47,225,16,225,17,57,57,47,47,93,93,56,93,93,16,225,17,51,
+49,48,1,35,17,33,17,35,17,51,62,2,18,55,33,17,51,33,17,35,14,3,7,4,55,174,
+253,78,174,86,65,99,67,34,1,2,23,151,254,178,192,7,36,58,81,52,254,131,1,
+125,254,131,2,23,95,223,243,1,0,127,252,80,3,36,103,215,209,194,83,255,255,
+0,113,255,236,3,225,4,94,2,6,0,72,0,0,0,1,0,4,0,0,5,190,4,74,0,17,0,156,64,
+31,6,3,3,10,70,15,0,0,214,11,1,185,11,201,11,2,166,11,1,151,11,1,11,11,14,
+7,4,5,5,8,7,184,255,192,179,18,21,72,7,184,255,192,64,36,7,11,72,15,7,1,6,
+7,16,7,7,19,0,19,16,19,2,223,19,1,48,19,112,19,144,19,3,15,19,1,7,17,16,16,
+13,14,184,255,240,64,15,14,14,18,3,0,0,1,13,8,10,21,17,4,1,15,0,63,51,51,
+63,51,51,18,57,17,51,17,1,51,47,56,51,51,17,51,94,93,93,93,113,17,51,47,56,
+94,93,43,43,51,51,17,51,17,18,57,47,93,93,93,93,51,17,51,225,50,17,51,49,
+48,1,17,51,17,1,51,1,1,35,1,17,35,17,1,35,1,1,51,2,143,164,1,160,197,254,
+88,1,206,206,254,67,164,254,68,207,1,207,254,88,197,2,53,2,21,253,235,2,21,
+253,235,253,203,2,45,253,211,2,45,253,211,2,53,2,21,0,1,0,68,255,236,3,82,
+4,94,0,57,0,95,64,58,5,70,22,27,22,57,22,57,22,12,52,71,33,87,59,176,59,192,
+59,208,59,3,111,59,1,32,59,1,41,12,86,58,27,56,80,207,57,1,137,57,153,57,
+2,15,57,1,8,57,57,17,47,80,38,22,8,80,17,16,0,63,225,63,225,17,57,47,94,93,
+93,93,225,57,1,16,230,50,93,93,93,16,246,225,18,57,57,47,47,18,57,16,225,
+49,48,1,50,62,2,53,52,38,35,34,6,7,39,62,3,51,50,30,2,21,20,14,2,7,21,30,
+3,21,20,14,2,35,34,38,39,53,30,3,51,50,62,2,53,52,38,35,35,53,1,113,61,100,
+72,39,115,108,71,129,75,63,40,77,82,90,53,86,144,105,58,28,51,70,43,44,82,
+63,38,53,108,166,113,109,175,58,31,76,87,97,51,55,96,70,41,133,138,129,2,
+135,18,39,64,45,77,77,38,34,147,20,28,19,9,38,74,109,70,50,77,59,41,14,11,
+14,44,66,90,62,67,117,86,49,35,34,166,16,31,24,15,18,42,69,51,94,91,153,0,
+1,0,174,0,0,4,59,4,74,0,11,0,81,64,27,3,16,9,24,72,3,6,70,5,85,13,0,13,16,
+13,32,13,160,13,192,13,208,13,240,13,7,13,184,255,192,179,14,17,72,9,184,
+255,240,64,17,9,24,72,9,0,70,10,84,12,8,3,11,15,6,2,10,21,0,63,51,51,63,51,
+51,1,16,246,225,50,43,43,93,16,246,225,50,43,49,48,1,17,7,1,51,17,35,17,19,
+1,35,17,1,90,12,2,4,233,172,11,253,254,234,4,74,253,100,252,3,152,251,182,
+2,135,1,15,252,106,4,74,0,255,255,0,174,0,0,4,59,6,23,2,38,1,210,0,0,1,6,
+2,54,37,0,0,21,180,1,17,17,38,1,184,255,255,180,22,12,10,4,37,1,43,53,0,43,
+53,0,0,1,0,174,0,0,3,229,4,74,0,10,0,65,64,35,0,1,1,4,0,3,16,3,2,3,16,3,3,
+12,15,12,1,10,2,6,71,7,84,11,5,2,10,10,7,0,8,15,4,7,21,0,63,51,63,51,18,57,
+17,51,51,1,16,246,225,50,50,93,17,51,47,56,93,51,51,17,51,49,48,1,51,1,1,
+35,1,17,35,17,51,17,2,250,196,254,97,1,198,206,254,75,180,180,4,74,253,241,
+253,197,2,45,253,211,4,74,253,235,0,1,0,16,255,242,3,176,4,74,0,20,0,76,64,
+49,3,70,4,19,1,244,19,1,128,19,144,19,192,19,208,19,4,84,19,1,19,19,11,1,
+71,0,85,22,15,22,47,22,255,22,3,6,11,11,21,3,80,19,15,14,79,8,22,1,21,0,63,
+63,225,63,225,17,1,51,47,94,93,16,246,225,17,57,47,93,93,93,113,225,49,48,
+33,35,17,33,2,2,6,6,35,34,38,39,53,22,51,50,54,54,18,55,33,3,176,182,254,
+254,20,64,95,130,86,28,49,16,23,27,55,89,69,51,18,2,84,3,176,254,253,254,
+148,230,105,6,6,131,6,117,241,1,111,250,0,1,0,174,0,0,5,16,4,74,0,32,0,94,
+64,63,31,1,70,0,85,34,207,34,1,64,34,80,34,2,15,34,1,6,19,16,70,17,84,33,
+2,15,59,15,75,15,91,15,3,9,15,25,15,41,15,3,15,31,18,15,52,25,68,25,84,25,
+3,6,25,22,25,38,25,3,25,9,1,17,21,0,63,51,51,51,93,93,63,51,51,93,93,17,51,
+1,16,246,225,50,94,93,93,93,16,246,225,50,49,48,33,35,17,14,3,7,1,35,1,46,
+3,39,17,35,17,51,1,30,3,23,62,3,55,1,51,5,16,161,6,17,20,18,7,254,248,135,
+254,247,5,17,20,18,7,162,221,1,11,13,22,19,15,4,6,14,19,22,13,1,14,217,3,
+129,21,57,59,54,18,253,80,2,176,13,49,59,62,26,252,127,4,74,253,71,34,67,
+60,50,16,17,49,59,65,33,2,189,0,1,0,174,0,0,4,59,4,74,0,11,0,91,64,23,2,6,
+71,5,85,13,0,13,32,13,2,48,13,64,13,80,13,208,13,240,13,5,13,184,255,192,
+64,35,14,17,72,1,9,71,10,84,12,8,80,235,1,1,169,1,185,1,2,15,1,31,1,47,1,
+3,6,1,1,10,5,21,3,0,15,0,63,50,63,51,57,47,94,93,93,93,225,1,16,246,225,50,
+43,93,113,16,246,225,50,49,48,1,17,33,17,51,17,35,17,33,17,35,17,1,100,2,
+33,182,182,253,223,182,4,74,254,57,1,199,251,182,1,233,254,23,4,74,255,255,
+0,113,255,236,4,45,4,94,2,6,0,82,0,0,0,1,0,174,0,0,4,18,4,74,0,7,0,45,64,
+28,5,71,4,85,9,16,9,32,9,96,9,112,9,128,9,5,0,71,1,84,8,7,80,2,15,5,0,21,
+0,63,50,63,225,1,16,246,225,93,16,246,225,49,48,33,35,17,33,17,35,17,33,1,
+100,182,3,100,182,254,8,4,74,251,182,3,176,0,255,255,0,174,254,20,4,63,4,
+94,2,6,0,83,0,0,255,255,0,113,255,236,3,111,4,94,2,6,0,70,0,0,0,1,0,41,0,
+0,3,94,4,74,0,7,0,88,64,60,32,9,1,223,9,1,112,9,128,9,2,95,9,1,15,0,1,204,
+0,1,15,0,191,0,2,6,0,0,2,71,3,96,5,112,5,208,5,3,31,5,1,5,5,0,3,16,3,176,
+3,192,3,4,3,1,5,80,6,15,2,21,0,63,63,225,50,1,47,93,51,47,93,93,16,225,50,
+47,94,93,93,113,93,93,93,113,49,48,1,33,17,35,17,33,53,33,3,94,254,193,183,
+254,193,3,53,3,176,252,80,3,176,154,255,255,0,10,254,20,3,223,4,74,2,6,0,
+92,0,0,0,3,0,113,254,20,5,35,6,20,0,25,0,34,0,41,0,116,64,75,39,0,11,70,29,
+23,12,13,19,73,185,12,201,12,2,151,12,167,12,2,12,12,18,35,72,5,87,43,32,
+43,1,15,43,1,159,43,239,43,2,128,43,1,111,43,1,64,43,1,15,43,31,43,2,6,26,
+72,18,86,42,24,0,38,30,80,0,23,16,39,29,80,10,13,22,11,27,0,63,63,51,225,
+50,63,51,225,50,63,1,16,246,225,94,93,93,93,93,93,113,113,16,246,225,17,57,
+47,93,93,43,51,51,225,50,50,49,48,1,30,3,21,20,14,2,7,17,35,17,46,3,53,52,
+62,2,55,17,51,1,20,22,23,17,14,3,5,52,38,39,17,54,54,3,33,113,189,136,76,
+71,134,190,119,170,114,191,137,76,71,133,193,121,170,254,12,156,174,88,125,
+80,37,3,57,155,170,172,153,4,90,12,85,143,198,125,125,200,145,86,11,254,36,
+1,220,10,86,144,201,126,125,199,143,85,11,1,186,252,19,187,210,19,3,60,9,
+61,103,145,94,186,204,20,252,198,20,209,0,255,255,0,35,0,0,3,219,4,74,2,6,
+0,91,0,0,0,1,0,174,254,131,4,178,4,74,0,11,0,68,64,43,1,71,15,0,1,6,0,0,7,
+71,143,10,1,10,13,16,13,32,13,96,13,112,13,128,13,192,13,6,6,71,3,84,12,8,
+4,15,10,6,80,3,21,1,251,0,63,63,225,50,63,51,1,16,246,225,93,16,212,93,225,
+51,47,94,93,225,49,48,1,35,17,33,17,51,17,33,17,51,17,51,4,178,182,252,178,
+182,1,248,182,160,254,131,1,125,4,74,252,80,3,176,252,80,0,1,0,154,0,0,3,
+254,4,74,0,24,0,49,64,28,8,12,71,11,85,26,16,26,96,26,128,26,3,1,71,23,84,
+25,8,3,80,18,18,11,21,9,0,15,0,63,50,63,57,47,225,51,1,16,246,225,93,16,246,
+225,50,49,48,1,17,20,51,50,62,2,55,17,51,17,35,17,14,3,35,34,46,2,53,17,1,
+80,184,45,80,76,77,42,182,182,44,80,85,94,58,78,122,82,43,4,74,254,102,174,
+15,28,44,28,1,213,251,182,1,233,30,48,32,17,47,84,115,68,1,166,0,1,0,174,
+0,0,6,70,4,74,0,11,0,102,64,67,0,71,182,9,198,9,2,169,9,1,3,116,9,132,9,148,
+9,3,103,9,1,6,9,9,5,1,71,4,85,13,32,13,1,15,13,1,128,13,240,13,2,111,13,1,
+64,13,1,15,13,47,13,2,6,8,71,5,84,12,0,8,80,5,21,10,6,2,15,0,63,51,51,63,
+225,50,1,16,246,225,94,93,93,93,93,113,113,16,246,225,17,57,47,95,93,93,95,
+93,93,225,49,48,37,33,17,51,17,33,17,51,17,33,17,51,3,213,1,186,183,250,104,
+182,1,187,182,154,3,176,251,182,4,74,252,80,3,176,0,1,0,174,254,131,6,229,
+4,74,0,15,0,119,64,78,10,71,182,7,198,7,2,169,7,1,3,116,7,132,7,148,7,3,103,
+7,1,6,7,7,3,11,71,14,1,71,14,0,1,0,0,191,14,1,14,17,32,17,1,15,17,1,64,17,
+128,17,224,17,240,17,4,15,17,47,17,2,6,6,71,3,84,16,12,8,4,15,14,10,6,80,
+3,21,1,251,0,63,63,225,50,50,63,51,51,1,16,246,225,94,93,93,113,113,16,196,
+93,50,47,93,225,16,225,17,57,47,95,93,93,95,93,93,225,49,48,1,35,17,33,17,
+51,17,33,17,51,17,33,17,51,17,51,6,229,182,250,127,182,1,187,182,1,186,183,
+159,254,131,1,125,4,74,252,80,3,176,252,80,3,176,252,80,0,2,0,41,0,0,4,252,
+4,74,0,14,0,27,0,92,64,62,15,71,4,87,29,80,29,96,29,144,29,224,29,4,63,29,
+1,0,22,71,10,0,12,16,12,2,176,12,240,12,2,12,12,0,10,16,10,80,10,96,10,160,
+10,5,8,10,21,80,191,0,1,0,0,22,12,80,13,15,22,80,10,21,0,63,225,63,225,18,
+57,47,93,225,1,47,94,93,51,47,93,113,16,225,50,93,93,16,246,225,49,48,1,33,
+50,22,21,20,14,2,35,33,17,33,53,33,1,52,46,2,35,33,17,33,50,62,2,2,72,1,20,
+212,204,47,101,159,113,254,57,254,152,2,31,2,2,33,65,96,64,255,0,1,4,55,93,
+68,38,2,135,156,155,77,124,88,47,3,176,154,252,248,49,66,40,17,254,168,17,
+41,66,0,0,3,0,174,0,0,5,80,4,74,0,12,0,16,0,29,0,97,64,64,24,71,0,4,16,4,
+32,4,112,4,208,4,5,6,4,4,10,14,71,13,85,31,15,31,1,191,31,207,31,223,31,255,
+31,4,160,31,1,15,31,127,31,2,7,0,18,71,10,84,30,17,80,191,0,1,0,0,15,11,15,
+18,80,14,10,21,0,63,51,225,63,51,57,47,93,225,1,16,246,225,50,94,93,93,93,
+113,16,246,225,17,57,47,94,93,225,49,48,1,51,50,22,21,20,14,2,35,33,17,51,
+1,35,17,51,1,17,51,50,62,2,53,52,46,2,35,1,100,236,212,204,47,101,159,113,
+254,98,182,3,236,182,182,252,20,219,56,93,67,38,33,65,96,64,2,135,156,155,
+77,124,88,47,4,74,251,182,4,74,253,164,254,168,17,41,66,48,49,66,40,17,0,
+0,2,0,174,0,0,4,25,4,74,0,12,0,25,0,64,64,41,20,71,4,87,27,0,27,1,0,27,32,
+27,112,27,144,27,176,27,208,27,6,8,0,14,71,10,84,26,13,80,191,0,1,0,0,11,
+15,14,80,10,21,0,63,225,63,57,47,93,225,1,16,246,225,50,94,93,113,16,246,
+225,49,48,1,33,50,22,21,20,14,2,35,33,17,51,17,17,33,50,62,2,53,52,46,2,35,
+1,100,1,21,212,204,47,101,159,113,254,57,182,1,4,56,93,67,38,33,65,96,64,
+2,135,156,155,77,124,88,47,4,74,253,164,254,168,17,41,66,48,49,66,40,17,0,
+1,0,55,255,236,3,66,4,94,0,38,0,94,64,62,14,14,4,12,15,72,34,87,40,143,40,
+175,40,2,64,40,1,24,15,4,31,4,47,4,3,4,64,12,17,72,4,88,39,13,80,239,14,1,
+169,14,185,14,2,15,14,31,14,47,14,3,6,14,14,7,18,81,29,16,7,81,0,22,0,63,
+225,63,225,18,57,47,94,93,93,93,225,1,16,230,43,113,50,93,93,16,246,225,50,
+17,57,47,49,48,5,34,38,39,53,22,22,51,50,62,2,55,33,53,33,38,38,35,34,14,
+2,7,39,62,3,51,50,30,2,21,20,14,2,1,66,89,124,54,54,131,82,73,116,82,48,4,
+254,35,1,219,13,146,140,25,59,60,56,23,53,24,64,72,78,38,102,179,132,77,81,
+140,186,20,30,29,162,25,37,40,84,132,92,154,166,151,9,15,19,10,154,12,22,
+16,9,62,137,219,157,146,212,138,67,0,0,2,0,174,255,236,6,8,4,94,0,26,0,38,
+0,114,64,75,27,72,10,32,17,1,79,17,1,17,17,13,33,72,0,87,40,15,40,47,40,2,
+239,40,255,40,2,71,40,1,15,40,47,40,2,16,12,71,13,84,39,36,80,22,16,11,80,
+239,16,1,169,16,185,16,2,44,16,1,11,16,27,16,2,6,16,16,13,14,15,13,21,30,
+80,5,22,0,63,225,63,63,18,57,47,94,93,93,93,93,225,63,225,1,16,246,225,50,
+93,93,93,113,16,246,225,17,57,47,93,113,51,225,49,48,1,20,14,2,35,34,46,2,
+39,33,17,35,17,51,17,33,62,3,51,50,30,2,5,20,22,51,50,54,53,52,38,35,34,6,
+6,8,64,120,171,106,98,162,117,70,7,254,239,182,182,1,19,10,72,118,160,99,
+98,167,121,68,253,41,128,142,143,126,128,143,142,126,2,39,137,213,145,76,
+66,129,190,124,254,23,4,74,254,57,116,177,120,62,75,145,211,136,209,211,211,
+209,209,207,207,0,0,2,0,35,0,0,3,145,4,74,0,17,0,28,0,83,64,20,2,17,17,7,
+24,15,71,14,85,30,15,30,111,30,143,30,3,6,0,1,184,255,240,64,25,1,1,18,70,
+7,64,18,21,72,7,86,29,2,16,80,24,24,0,25,80,13,15,15,0,21,0,63,50,63,225,
+18,57,47,225,50,1,16,246,43,225,51,47,56,51,94,93,16,246,225,50,17,57,17,
+51,49,48,51,35,1,46,3,53,52,62,2,51,33,17,35,17,35,3,20,30,2,51,51,17,35,
+34,6,233,198,1,35,45,84,65,40,56,100,138,83,1,188,182,244,221,37,65,90,54,
+219,254,107,104,1,205,12,48,76,108,71,78,121,81,42,251,182,1,176,1,84,48,
+70,46,22,1,102,95,0,255,255,0,113,255,236,3,225,5,217,2,38,0,72,0,0,1,6,0,
+106,218,0,0,23,64,13,3,2,49,17,38,3,2,0,40,60,5,15,37,1,43,53,53,0,43,53,
+53,0,0,1,0,18,254,20,4,18,6,20,0,49,0,83,64,50,31,23,12,71,45,85,51,16,51,
+96,51,128,51,3,35,34,30,22,71,27,23,84,50,33,25,79,30,26,26,28,35,16,80,0,
+41,16,41,32,41,3,41,15,28,0,23,21,7,80,0,27,0,63,225,63,63,63,93,225,51,18,
+57,47,51,225,50,1,16,246,50,225,50,50,50,93,16,246,225,18,57,49,48,1,34,38,
+39,53,22,22,51,50,62,2,53,17,52,38,35,34,14,2,21,17,35,17,35,53,51,53,51,
+21,33,21,33,21,7,51,62,3,51,50,22,21,17,20,14,2,2,240,48,63,23,26,54,35,27,
+46,35,19,105,112,81,110,67,29,182,156,156,182,1,123,254,133,8,10,25,69,82,
+92,48,183,185,34,72,109,254,20,14,11,148,10,11,15,39,65,51,3,68,130,130,52,
+102,148,96,253,240,4,213,137,182,182,137,184,144,43,63,42,20,191,210,252,
+190,77,123,87,47,0,255,255,0,174,0,0,3,10,6,33,2,38,1,205,0,0,1,6,0,118,212,
+0,0,19,64,11,1,18,17,38,1,69,6,12,3,0,37,1,43,53,0,43,53,0,0,1,0,113,255,
+236,3,111,4,94,0,34,0,79,64,49,23,23,22,31,13,36,143,36,175,36,2,64,36,1,
+22,25,72,5,86,35,25,80,239,22,1,169,22,185,22,2,15,22,31,22,47,22,3,6,22,
+22,28,19,81,10,16,28,81,0,22,0,63,225,63,225,18,57,47,94,93,93,93,225,1,16,
+246,225,50,93,93,16,206,50,17,57,47,49,48,5,34,46,2,53,52,62,2,51,50,22,23,
+7,46,3,35,34,6,7,33,21,33,22,22,51,50,54,55,21,6,6,2,82,101,176,130,74,76,
+133,178,102,78,149,50,54,23,56,60,58,26,139,146,14,1,219,254,35,9,146,138,
+81,131,54,54,123,20,63,137,213,150,157,219,137,62,34,25,154,10,19,15,9,151,
+166,154,184,164,37,25,162,29,30,255,255,0,90,255,236,3,63,4,94,2,6,0,86,0,
+0,255,255,0,160,0,0,1,117,5,229,2,6,0,76,0,0,255,255,255,238,0,0,2,37,5,217,
+2,38,0,243,0,0,1,7,0,106,254,187,0,0,0,23,64,13,2,1,13,17,38,2,1,0,4,24,1,
+0,37,1,43,53,53,0,43,53,53,0,255,255,255,188,254,20,1,117,5,229,2,6,0,77,
+0,0,0,2,0,16,255,242,6,18,4,74,0,29,0,42,0,107,64,69,12,70,28,0,37,71,10,
+212,28,1,144,28,160,28,2,36,28,1,0,28,1,28,10,28,10,20,30,71,4,87,44,15,44,
+47,44,63,44,95,44,127,44,191,44,239,44,7,20,20,43,36,80,191,0,1,0,0,37,12,
+80,28,15,23,79,17,22,37,80,10,21,0,63,225,63,225,63,225,18,57,47,93,225,17,
+1,51,47,93,16,246,225,17,57,57,47,47,93,93,93,93,16,225,50,16,225,49,48,1,
+51,50,22,21,20,14,2,35,33,17,35,2,2,6,6,35,34,38,39,53,22,51,50,54,54,18,
+55,33,1,52,46,2,35,35,17,51,50,62,2,3,135,236,212,203,46,101,159,113,254,
+98,217,20,64,95,130,86,28,49,16,23,27,55,89,69,51,18,2,43,1,217,33,65,96,
+64,215,219,56,93,67,38,2,135,156,155,77,124,88,47,3,176,254,253,254,148,230,
+105,6,6,131,6,117,241,1,111,250,252,248,49,66,40,17,254,168,17,41,66,0,2,
+0,174,0,0,6,117,4,74,0,20,0,33,0,83,64,48,5,28,71,2,15,15,19,21,71,9,87,35,
+239,35,1,128,35,1,63,35,1,16,35,1,1,18,71,19,84,34,27,17,80,5,191,1,1,1,1,
+0,28,80,19,15,21,3,0,15,0,63,50,63,51,225,17,57,47,93,51,225,50,1,16,246,
+225,50,93,93,93,93,16,246,225,17,57,47,51,225,50,49,48,1,17,33,17,51,17,51,
+50,22,21,20,14,2,35,33,17,33,17,35,17,1,52,46,2,35,35,17,51,50,62,2,1,100,
+1,207,182,236,212,204,47,101,159,113,254,98,254,49,182,5,21,33,65,97,63,216,
+220,55,93,68,38,4,74,254,57,1,199,254,61,156,155,77,124,88,47,1,233,254,23,
+4,74,252,248,49,66,40,17,254,168,17,41,66,0,1,0,18,0,0,4,18,6,20,0,33,0,83,
+64,50,104,20,1,20,11,0,71,33,85,35,16,35,96,35,128,35,3,23,22,18,10,71,15,
+11,84,34,21,13,79,18,14,14,16,23,4,80,0,29,16,29,32,29,3,29,15,16,0,11,0,
+21,0,63,50,63,63,93,225,51,18,57,47,51,225,50,1,16,246,50,225,50,50,50,93,
+16,246,225,17,57,93,49,48,33,17,52,38,35,34,14,2,21,17,35,17,35,53,51,53,
+51,21,33,21,33,21,7,51,62,3,51,50,22,21,17,3,92,105,112,81,110,67,29,182,
+156,156,182,1,123,254,133,8,10,25,69,82,92,48,183,185,2,154,130,130,52,102,
+148,96,253,240,4,213,137,182,182,137,184,144,43,63,42,20,191,210,253,92,0,
+255,255,0,174,0,0,3,229,6,33,2,38,1,212,0,0,1,6,0,118,8,0,0,19,64,11,1,23,
+17,38,1,12,11,17,7,3,37,1,43,53,0,43,53,0,255,255,0,10,254,20,3,223,6,23,
+2,38,0,92,0,0,1,6,2,54,177,0,0,19,64,11,1,40,17,38,1,10,45,35,0,15,37,1,43,
+53,0,43,53,0,0,1,0,174,254,131,4,18,4,74,0,11,0,89,64,61,214,6,1,183,6,199,
+6,2,6,71,181,7,197,7,213,7,3,118,7,134,7,2,74,7,90,7,2,7,7,9,1,71,4,85,13,
+16,13,32,13,96,13,112,13,128,13,5,0,71,9,84,12,5,0,80,9,21,6,251,10,2,15,
+0,63,51,63,63,225,51,1,16,246,225,93,16,246,225,17,57,47,93,93,93,225,93,
+93,49,48,37,33,17,51,17,33,17,35,17,33,17,51,1,100,1,248,182,254,179,183,
+254,160,182,154,3,176,251,182,254,131,1,125,4,74,0,0,1,0,199,0,0,3,190,6,
+227,0,7,0,68,64,44,0,90,223,3,239,3,255,3,3,0,3,16,3,2,3,3,9,176,9,208,9,
+2,15,9,175,9,2,5,90,6,100,8,4,95,7,32,1,1,1,1,7,3,6,18,0,63,63,51,47,93,16,
+225,1,16,246,225,93,93,17,51,47,93,93,225,49,48,1,17,51,17,33,17,35,17,3,
+14,176,253,195,186,5,182,1,45,254,45,250,240,5,182,0,1,0,174,0,0,3,10,5,137,
+0,7,0,48,64,28,5,71,0,0,16,0,2,0,0,9,2,71,3,84,8,16,6,32,6,2,6,6,1,79,4,15,
+2,21,0,63,63,225,51,47,93,1,16,246,225,17,51,47,93,225,49,48,1,33,17,35,17,
+33,17,51,3,10,254,90,182,1,166,182,3,193,252,63,4,74,1,63,255,255,0,20,0,
+0,6,254,7,115,2,38,0,58,0,0,1,7,0,67,0,231,1,82,0,21,180,1,43,5,38,1,184,
+255,172,180,49,43,30,14,37,1,43,53,0,43,53,0,255,255,0,20,0,0,5,227,6,33,
+2,38,0,90,0,0,1,6,0,67,76,0,0,21,180,1,48,17,38,1,184,255,158,180,54,48,17,
+46,37,1,43,53,0,43,53,0,255,255,0,20,0,0,6,254,7,115,2,38,0,58,0,0,1,7,0,
+118,1,160,1,82,0,19,64,11,1,55,5,38,1,100,43,49,30,14,37,1,43,53,0,43,53,
+0,255,255,0,20,0,0,5,227,6,33,2,38,0,90,0,0,1,7,0,118,1,23,0,0,0,19,64,11,
+1,60,17,38,1,105,48,54,17,46,37,1,43,53,0,43,53,0,255,255,0,20,0,0,6,254,
+7,43,2,38,0,58,0,0,1,7,0,106,1,57,1,82,0,25,182,2,1,52,5,38,2,1,184,255,255,
+180,43,63,30,14,37,1,43,53,53,0,43,53,53,0,255,255,0,20,0,0,5,227,5,217,2,
+38,0,90,0,0,1,7,0,106,0,172,0,0,0,25,182,2,1,57,17,38,2,1,184,255,255,180,
+48,68,17,46,37,1,43,53,53,0,43,53,53,0,255,255,0,0,0,0,4,55,7,115,2,38,0,
+60,0,0,1,7,0,67,255,114,1,82,0,21,180,1,9,5,38,1,184,255,164,180,15,9,7,2,
+37,1,43,53,0,43,53,0,255,255,0,10,254,20,3,223,6,33,2,38,0,92,0,0,1,7,0,67,
+255,75,0,0,0,21,180,1,35,17,38,1,184,255,164,180,41,35,0,15,37,1,43,53,0,
+43,53,0,0,1,0,82,1,209,3,174,2,121,0,3,0,29,185,0,2,255,192,64,11,6,12,72,
+2,2,5,0,0,185,1,189,0,63,225,1,47,17,51,47,43,49,48,19,53,33,21,82,3,92,1,
+209,168,168,0,1,0,82,1,209,7,174,2,121,0,3,0,29,185,0,2,255,192,64,11,6,12,
+72,2,2,5,0,0,185,1,189,0,63,225,1,47,17,51,47,43,49,48,19,53,33,21,82,7,92,
+1,209,168,168,0,1,0,82,1,209,7,174,2,121,0,3,0,29,185,0,2,255,192,64,11,6,
+12,72,2,2,5,0,0,185,1,189,0,63,225,1,47,17,51,47,43,49,48,19,53,33,21,82,
+7,92,1,209,168,168,0,2,255,252,254,49,3,78,255,211,0,3,0,7,0,42,64,24,4,0,
+0,9,5,1,5,186,239,6,255,6,2,6,2,186,0,1,16,1,32,1,3,1,0,47,93,225,47,93,225,
+1,47,51,17,51,47,51,49,48,1,33,53,33,53,33,53,33,3,78,252,174,3,82,252,174,
+3,82,254,49,139,140,139,0,0,1,0,23,3,193,1,80,5,182,0,12,0,37,64,23,95,14,
+1,6,15,7,95,7,111,7,191,7,207,7,5,7,12,152,1,12,156,6,3,0,63,229,1,47,225,
+47,93,51,93,49,48,19,39,62,3,55,51,14,3,7,37,14,14,39,46,52,25,137,15,29,
+26,22,8,3,193,22,54,122,124,123,56,61,132,131,124,53,0,1,0,23,3,193,1,80,
+5,182,0,12,0,37,64,23,95,14,1,6,7,12,152,15,1,95,1,111,1,191,1,207,1,5,1,
+6,156,0,3,0,63,229,1,47,93,225,47,51,93,49,48,1,23,14,3,7,35,62,3,55,1,66,
+14,14,39,47,51,25,137,14,29,27,22,8,5,182,22,55,121,125,122,56,60,132,132,
+124,53,0,0,1,0,63,254,248,1,121,0,238,0,12,0,53,185,0,14,255,192,64,20,10,
+24,72,12,152,15,1,95,1,111,1,127,1,207,1,5,1,1,6,7,184,255,192,183,16,21,
+72,7,6,156,0,168,0,63,229,1,47,43,51,51,47,93,225,43,49,48,37,23,14,3,7,35,
+62,3,55,1,106,15,14,39,47,51,25,138,15,29,27,22,8,238,23,54,122,124,123,56,
+61,132,131,125,53,0,1,0,25,3,193,1,82,5,182,0,12,0,43,64,28,95,14,1,6,15,
+5,95,5,111,5,127,5,191,5,207,5,223,5,7,5,5,0,152,11,6,156,0,3,0,63,229,1,
+47,225,51,47,93,51,93,49,48,19,30,3,23,35,46,3,39,55,238,8,22,26,29,15,137,
+25,52,46,39,14,14,5,182,53,124,132,132,60,56,122,125,121,55,22,0,2,0,23,3,
+193,2,209,5,182,0,12,0,25,0,98,64,72,191,27,1,144,27,1,15,27,95,27,111,27,
+3,19,15,20,95,20,111,20,127,20,191,20,207,20,223,20,7,20,20,25,152,14,12,
+152,0,1,80,1,96,1,112,1,176,1,192,1,208,1,7,1,1,6,15,7,95,7,111,7,191,7,207,
+7,5,7,25,12,156,19,6,3,0,63,51,229,50,1,47,93,51,51,47,93,225,47,225,51,47,
+93,51,93,93,93,49,48,1,39,62,3,55,51,14,3,7,33,39,62,3,55,51,14,3,7,1,166,
+14,14,39,46,52,25,137,15,29,26,22,8,253,184,14,14,39,46,52,25,137,15,29,26,
+22,8,3,193,22,54,122,124,123,56,61,132,131,124,53,22,54,122,124,123,56,61,
+132,131,124,53,0,2,0,23,3,193,2,209,5,182,0,12,0,25,0,98,64,72,191,27,1,144,
+27,1,15,27,95,27,111,27,3,19,0,20,80,20,96,20,112,20,176,20,192,20,208,20,
+7,20,20,25,152,15,14,95,14,111,14,191,14,207,14,5,14,12,152,15,1,95,1,111,
+1,127,1,191,1,207,1,223,1,7,1,1,6,7,19,6,156,13,0,3,0,63,50,229,50,1,47,51,
+51,47,93,225,47,93,225,51,47,93,51,93,93,93,49,48,1,23,14,3,7,35,62,3,55,
+33,23,14,3,7,35,62,3,55,1,66,14,14,39,47,51,25,137,14,29,27,22,8,2,72,14,
+14,39,47,51,25,137,14,29,27,22,8,5,182,22,55,121,125,122,56,60,132,132,124,
+53,22,55,121,125,122,56,60,132,132,124,53,0,2,0,63,254,248,2,250,0,238,0,
+12,0,25,0,126,64,81,208,27,224,27,240,27,3,164,27,180,27,196,27,3,144,27,
+1,2,32,27,48,27,64,27,96,27,112,27,128,27,6,19,0,20,80,20,96,20,112,20,192,
+20,208,20,6,20,20,25,152,144,14,224,14,240,14,3,15,14,95,14,2,14,12,152,15,
+1,95,1,111,1,127,1,207,1,223,1,6,1,1,6,7,184,255,192,64,10,16,24,72,7,19,
+6,156,13,0,168,0,63,50,229,50,1,47,43,51,51,47,93,225,47,93,93,225,51,47,
+93,51,93,95,93,93,93,49,48,37,23,14,3,7,35,62,3,55,33,23,14,3,7,35,62,3,55,
+1,106,15,14,39,47,51,25,138,15,29,27,22,8,2,72,14,14,39,47,51,25,137,14,29,
+27,22,8,238,23,54,122,124,123,56,61,132,131,125,53,23,54,122,124,123,56,61,
+132,131,125,53,0,0,1,0,123,0,0,3,104,6,20,0,11,0,124,64,82,144,13,160,13,
+224,13,240,13,4,111,13,1,16,13,48,13,64,13,3,7,6,192,4,8,8,3,228,11,244,11,
+2,214,11,1,119,11,1,106,11,1,84,11,1,69,11,1,38,11,1,11,192,9,10,1,9,9,54,
+2,1,2,190,0,3,16,3,160,3,3,3,4,1,0,5,191,11,10,7,6,194,8,0,3,0,47,63,246,
+50,50,50,225,50,50,50,1,47,93,225,93,50,17,51,51,16,230,93,93,93,93,93,93,
+93,17,51,47,51,230,51,93,93,93,49,48,1,37,19,35,19,5,53,5,3,51,3,37,3,104,
+254,181,55,217,55,254,201,1,55,55,217,55,1,75,3,221,31,252,4,3,252,31,180,
+30,1,161,254,95,30,0,0,1,0,123,0,0,3,125,6,20,0,21,0,176,64,113,0,23,1,160,
+23,176,23,240,23,3,127,23,1,32,23,64,23,80,23,3,8,13,192,14,11,15,15,5,1,
+4,18,1,244,18,1,230,18,1,135,18,1,122,18,1,100,18,1,85,18,1,54,18,70,18,2,
+18,192,16,20,17,16,16,21,3,0,4,190,5,10,10,9,6,0,5,1,0,5,16,5,32,5,80,5,160,
+5,176,5,6,8,5,20,19,11,12,191,18,17,14,13,194,15,0,9,1,0,8,191,6,3,2,7,194,
+5,0,47,246,50,50,50,225,50,50,50,63,246,50,50,50,225,50,50,50,1,47,94,93,
+113,51,51,51,47,16,225,50,50,50,50,17,51,51,16,230,93,93,93,93,93,93,93,113,
+50,17,51,47,51,51,230,50,93,93,93,113,49,48,1,37,21,37,19,35,19,5,53,5,3,
+19,5,53,5,3,51,3,37,21,37,19,2,49,1,76,254,180,55,217,56,254,180,1,76,47,
+47,254,180,1,76,56,217,55,1,76,254,180,47,1,240,30,180,31,254,135,1,121,31,
+180,30,1,34,1,19,31,180,30,1,120,254,136,30,180,31,254,237,0,0,1,0,150,1,
+229,2,109,3,242,0,19,0,70,64,36,47,21,95,21,111,21,127,21,207,21,239,21,255,
+21,7,16,21,1,95,10,111,10,159,10,175,10,223,10,239,10,6,10,208,0,1,0,184,
+255,192,64,12,7,10,72,0,31,15,1,15,16,5,1,5,0,47,93,197,93,1,47,43,93,197,
+93,93,93,49,48,19,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,150,36,63,86,50,
+49,86,64,37,37,64,86,49,50,86,63,36,2,236,71,100,63,28,28,63,100,71,70,100,
+63,30,30,63,100,0,3,0,147,255,227,5,219,0,250,0,19,0,39,0,57,0,168,64,118,
+20,59,36,59,2,251,59,1,228,59,1,187,59,203,59,2,164,59,1,139,59,1,100,59,
+116,59,2,75,59,1,52,59,1,11,59,1,30,150,102,20,118,20,2,20,20,0,40,150,36,
+50,1,251,50,1,224,50,1,212,50,1,187,50,1,164,50,1,139,50,1,114,50,1,102,50,
+1,75,50,1,48,50,1,2,32,50,1,15,50,1,6,50,10,150,224,0,240,0,2,84,0,100,0,
+2,0,0,16,0,32,0,3,7,0,45,25,5,155,55,35,15,0,47,51,51,237,50,50,1,47,94,93,
+93,93,237,47,94,93,93,95,93,93,93,93,93,93,93,93,93,93,113,237,17,57,47,93,
+237,93,93,93,93,93,93,93,93,93,113,49,48,55,52,62,2,51,50,30,2,21,20,14,2,
+35,34,46,2,37,52,62,2,51,50,30,2,21,20,14,2,35,34,46,2,37,52,62,2,51,50,30,
+2,21,20,14,2,35,34,38,147,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,
+2,37,20,34,46,27,26,47,34,20,20,34,47,26,27,46,34,20,2,37,19,35,46,27,26,
+47,34,20,20,34,47,26,54,73,111,38,53,33,15,15,33,53,38,37,53,34,16,16,34,
+53,37,38,53,33,15,15,33,53,38,37,53,34,16,16,34,53,37,38,53,33,15,15,33,53,
+38,37,53,34,16,66,0,7,0,102,255,236,8,244,5,203,0,9,0,29,0,39,0,59,0,63,0,
+73,0,93,0,137,64,92,64,180,84,181,74,30,180,50,181,35,180,40,160,62,1,48,
+60,64,60,176,60,3,48,40,64,40,2,62,60,40,40,60,62,3,20,69,180,74,95,63,95,
+79,95,95,95,127,95,175,95,5,5,180,10,181,0,180,16,20,32,20,48,20,3,20,71,
+182,89,183,67,182,79,25,63,6,62,24,37,182,55,183,33,182,45,25,3,182,15,183,
+7,182,25,7,0,63,225,244,225,63,225,244,225,63,63,63,225,244,225,1,47,93,225,
+244,225,93,16,222,225,18,23,57,47,47,47,93,93,93,16,225,244,225,16,244,225,
+49,48,19,20,22,51,50,17,16,35,34,6,5,20,14,2,35,34,46,2,53,52,62,2,51,50,
+30,2,1,20,22,51,50,17,16,35,34,6,5,20,14,2,35,34,46,2,53,52,62,2,51,50,30,
+2,1,1,35,1,1,20,22,51,50,17,16,35,34,6,5,20,14,2,35,34,46,2,53,52,62,2,51,
+50,30,2,250,71,80,156,156,80,71,1,199,36,74,115,79,73,112,76,38,35,73,113,
+78,75,113,77,39,1,172,71,80,156,156,80,71,1,198,35,74,115,79,74,112,75,38,
+35,73,113,78,75,113,76,39,255,0,252,213,158,3,44,2,151,71,81,155,155,81,71,
+1,199,35,74,115,79,74,112,75,38,35,73,113,78,74,114,76,39,4,2,165,165,1,74,
+1,72,163,165,108,172,118,63,63,118,172,108,108,170,117,62,62,117,170,253,
+74,165,164,1,73,1,72,163,165,108,171,118,63,63,118,171,108,108,170,117,62,
+62,117,170,3,146,250,74,5,182,252,2,165,164,1,73,1,72,163,165,108,171,118,
+63,63,118,171,108,108,170,117,62,62,117,170,255,255,0,133,3,166,1,74,5,182,
+2,6,0,10,0,0,255,255,0,133,3,166,2,178,5,182,2,6,0,5,0,0,0,1,0,82,0,115,1,
+252,3,199,0,6,0,60,177,4,2,184,255,192,64,31,9,12,72,2,8,63,8,159,8,175,8,
+223,8,239,8,255,8,6,6,235,159,3,1,3,6,0,3,3,1,5,1,0,47,47,18,57,61,47,51,
+51,1,24,47,93,225,93,16,198,43,50,49,48,19,1,23,3,19,7,1,82,1,53,117,238,
+238,117,254,203,2,41,1,158,78,254,164,254,164,78,1,155,0,1,0,82,0,115,1,252,
+3,199,0,6,0,63,64,40,0,235,223,3,239,3,255,3,3,16,3,32,3,2,3,63,8,159,8,175,
+8,223,8,239,8,255,8,6,4,63,2,1,2,6,0,3,3,1,5,1,0,47,47,18,57,61,47,51,51,
+1,24,47,93,51,93,47,93,93,225,49,48,1,1,39,19,3,55,1,1,252,254,203,117,237,
+237,117,1,53,2,14,254,101,78,1,92,1,92,78,254,98,255,255,0,147,255,227,3,
+98,5,182,0,39,0,4,1,209,0,0,1,6,0,4,0,0,0,9,181,47,49,1,16,49,1,93,93,0,0,
+1,254,160,0,0,2,104,5,182,0,3,0,29,177,1,2,184,255,240,64,9,2,3,0,16,0,1,
+18,0,3,0,63,63,1,47,56,50,47,56,51,49,48,1,1,35,1,2,104,252,213,157,3,43,
+5,182,250,74,5,182,0,1,0,106,3,29,2,147,5,199,0,20,0,65,64,23,0,224,0,20,
+1,20,22,96,22,192,22,224,22,240,22,4,15,22,1,14,10,224,11,184,255,192,64,
+14,10,15,72,11,10,0,192,14,4,228,17,222,12,220,0,63,63,225,51,26,204,50,1,
+47,43,225,50,93,93,16,214,93,225,49,48,1,17,52,38,35,34,14,2,21,17,35,17,
+51,23,51,54,51,50,21,17,2,20,63,63,45,65,42,21,127,105,16,9,64,130,229,3,
+29,1,166,81,68,21,52,87,65,254,166,2,157,88,101,250,254,80,0,0,1,0,96,0,0,
+4,0,5,182,0,17,0,118,64,72,2,16,2,16,5,0,11,16,11,32,11,3,11,11,19,48,19,
+1,14,0,4,90,5,9,5,223,7,1,7,7,0,5,16,5,192,5,3,7,5,3,7,96,8,0,8,17,95,14,
+15,14,63,14,111,14,3,8,14,64,16,21,72,8,14,8,14,4,13,95,10,3,4,18,0,63,63,
+225,18,57,57,47,47,43,94,93,16,225,17,51,16,225,50,1,47,94,93,51,47,93,17,
+51,16,225,50,50,93,17,51,47,93,18,57,57,47,47,49,48,1,33,21,33,17,35,17,35,
+53,51,17,33,21,33,17,33,21,33,1,195,1,36,254,220,179,176,176,2,240,253,195,
+2,22,253,234,1,143,137,254,250,1,6,137,4,39,164,253,252,164,0,0,1,0,68,0,
+0,4,35,5,201,0,48,0,135,64,16,17,13,21,111,43,39,35,15,19,35,19,35,19,30,
+3,27,184,255,192,64,62,9,14,72,27,27,50,16,50,1,41,37,30,64,11,14,72,30,20,
+37,117,38,17,38,16,41,117,42,13,42,111,38,1,208,42,1,15,42,31,42,63,42,79,
+42,175,42,191,42,6,38,42,38,42,0,30,26,116,29,24,7,115,0,7,0,63,225,63,225,
+50,17,57,57,47,47,93,93,93,17,51,16,225,50,17,51,16,225,50,1,47,43,51,51,
+93,17,51,47,43,51,18,57,57,47,47,17,51,17,51,51,225,50,50,49,48,1,50,22,23,
+7,38,38,35,34,14,2,21,21,33,21,33,21,33,21,33,21,20,14,2,7,33,21,33,53,62,
+3,53,53,35,53,51,53,35,53,51,53,52,62,2,2,154,106,174,66,66,56,141,75,48,
+82,60,33,1,120,254,136,1,120,254,136,23,39,51,27,2,236,252,33,44,73,53,30,
+198,198,198,198,59,105,146,5,201,45,35,144,29,43,27,59,94,66,192,137,158,
+137,19,62,89,64,43,16,166,154,11,41,68,97,67,21,137,158,137,221,87,137,95,
+50,0,3,0,150,255,236,5,182,5,182,0,27,0,42,0,53,0,121,64,24,49,111,28,18,
+16,15,110,24,21,24,28,24,28,24,36,255,5,1,5,64,18,21,72,5,184,255,192,64,
+44,9,14,72,5,5,55,15,55,1,55,64,11,16,72,43,35,110,36,124,54,15,24,117,21,
+18,21,43,115,34,21,34,21,34,36,53,115,37,6,36,24,0,117,9,25,0,63,225,63,63,
+225,18,57,57,47,47,16,225,17,51,16,225,50,1,16,246,225,50,43,93,17,51,47,
+43,43,93,18,57,57,47,47,17,51,16,225,50,50,16,225,49,48,37,50,62,2,55,21,
+6,6,35,34,46,2,53,17,35,53,55,55,51,21,51,21,35,17,20,22,1,20,14,2,35,35,
+17,35,17,51,50,30,2,1,51,50,62,2,53,52,38,35,35,5,59,15,36,35,30,7,23,80,
+63,53,88,64,36,156,156,65,107,209,209,52,254,140,52,124,204,152,47,178,251,
+134,191,123,58,253,189,26,93,139,91,46,164,174,57,129,4,6,8,3,138,12,20,34,
+70,106,72,1,191,82,77,189,211,137,254,86,76,78,3,137,91,168,129,77,253,199,
+5,182,57,109,160,254,103,32,71,113,81,142,137,0,1,0,63,255,236,4,74,5,203,
+0,57,0,134,180,18,7,40,54,25,184,255,192,64,75,9,13,72,25,25,59,16,59,1,44,
+35,35,19,5,13,111,46,34,99,40,1,40,40,58,19,35,96,36,16,36,8,44,96,45,5,45,
+95,36,127,36,143,36,239,36,255,36,5,15,45,31,45,47,45,95,45,159,45,207,45,
+6,36,45,36,45,22,55,0,116,51,7,22,95,25,29,25,0,63,51,225,63,225,51,18,57,
+57,47,47,93,93,17,51,16,225,50,17,51,16,225,50,17,1,51,47,93,51,51,225,50,
+50,51,17,51,93,17,51,47,43,51,18,57,57,49,48,1,34,14,2,7,33,21,33,20,7,6,
+20,21,20,20,23,33,21,33,22,22,51,50,54,55,21,6,6,35,34,46,2,39,35,53,51,38,
+52,53,52,54,53,35,53,51,62,3,51,50,22,23,7,38,38,3,8,69,118,94,67,18,1,176,
+254,65,1,1,2,1,129,254,146,34,185,149,75,135,59,59,133,91,115,182,135,88,
+21,164,148,2,2,148,160,18,88,135,184,114,97,160,79,80,51,119,5,39,52,99,143,
+91,137,15,14,12,26,9,19,41,22,137,175,184,32,26,162,28,31,73,135,193,121,
+137,23,30,29,22,46,8,137,125,202,144,78,43,49,146,31,43,0,0,4,0,141,255,248,
+5,219,5,193,0,3,0,23,0,43,0,72,0,134,64,10,1,2,57,70,24,180,14,3,0,2,184,
+255,240,64,74,112,70,144,70,160,70,208,70,4,223,14,1,0,16,2,70,14,0,0,14,
+70,2,4,49,34,180,15,4,1,239,4,255,4,2,4,74,64,180,0,49,1,0,49,16,49,32,49,
+224,49,240,49,5,8,49,66,252,44,253,61,252,54,7,39,252,19,253,29,252,9,25,
+3,6,1,24,0,63,63,63,225,244,225,63,225,244,225,1,47,94,93,113,225,16,222,
+93,113,225,17,23,57,47,47,47,47,56,93,93,56,17,51,16,225,17,51,17,51,49,48,
+1,1,35,1,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,20,30,2,51,50,62,2,
+53,52,46,2,35,34,14,2,1,34,46,2,53,52,62,2,51,50,22,23,7,38,38,35,34,6,21,
+20,51,50,54,55,21,6,6,5,10,252,213,157,3,43,1,110,45,80,112,68,63,110,81,
+47,44,80,113,68,62,110,82,47,254,51,17,38,60,43,42,60,37,17,17,37,60,42,43,
+60,38,17,253,203,69,121,90,52,53,92,125,72,51,100,32,33,31,85,34,103,95,194,
+51,90,35,35,99,5,182,250,74,5,182,251,152,83,127,87,45,45,87,127,83,83,127,
+87,45,45,87,127,83,51,86,62,35,35,62,86,51,52,85,61,33,33,61,85,1,146,38,
+82,128,90,95,132,82,38,22,15,107,13,20,116,118,229,17,16,107,18,19,0,0,2,
+0,119,255,236,3,123,5,203,0,45,0,58,0,85,64,50,46,112,35,64,16,20,72,35,35,
+17,5,6,60,53,40,110,25,20,16,17,32,17,48,17,128,17,144,17,5,17,24,21,54,118,
+20,17,40,40,0,48,118,30,7,0,117,11,6,6,11,25,0,63,51,47,16,225,63,225,18,
+57,47,51,51,225,50,50,1,47,93,197,51,225,50,16,214,193,18,57,47,43,225,49,
+48,37,50,62,2,55,51,14,3,35,34,46,2,53,53,6,6,7,53,54,54,55,17,52,62,2,51,
+50,30,2,21,20,14,2,7,17,20,30,2,19,52,35,34,14,2,21,17,62,3,2,111,32,57,46,
+30,3,100,4,38,70,105,70,58,106,81,48,46,97,49,52,95,45,28,64,104,75,54,87,
+61,33,53,92,124,71,17,36,55,99,102,32,41,23,9,54,78,51,24,119,22,50,82,59,
+83,131,90,48,37,84,136,99,231,17,28,12,121,14,30,15,1,238,59,108,83,49,42,
+79,111,69,99,166,134,104,38,254,211,48,81,59,33,4,33,188,27,50,69,42,254,
+106,33,78,98,121,0,4,0,199,0,0,7,137,5,182,0,23,0,43,0,55,0,59,0,186,64,114,
+14,1,21,90,0,57,57,44,225,34,16,0,1,176,0,1,159,0,1,48,0,64,0,2,0,34,0,34,
+10,50,225,24,15,58,31,58,47,58,3,58,58,239,24,1,24,103,61,111,61,191,61,207,
+61,3,64,61,1,12,8,3,9,90,10,100,60,47,229,29,53,229,39,207,29,223,29,239,
+29,3,29,64,6,11,72,15,39,31,39,95,39,111,39,127,39,239,39,6,6,29,39,29,39,
+22,3,16,6,24,72,3,11,3,57,229,56,14,184,255,240,182,6,24,72,14,1,10,18,0,
+63,51,51,43,51,224,63,51,43,51,57,57,47,47,94,93,43,93,16,225,16,225,1,16,
+246,225,50,50,50,93,93,16,230,93,50,47,113,16,225,17,57,57,47,47,93,93,93,
+113,16,225,51,47,16,225,50,50,49,48,33,35,1,35,22,23,22,22,21,17,35,17,51,
+1,51,38,39,46,3,53,17,51,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,5,20,
+22,51,50,54,53,52,38,35,34,6,3,53,33,21,4,168,205,253,135,8,6,4,4,5,166,207,
+2,118,6,3,4,1,3,2,1,164,2,225,41,77,109,68,63,107,77,44,41,77,109,68,62,107,
+78,44,254,66,72,81,81,71,71,81,81,72,99,1,240,4,186,77,76,65,142,57,252,231,
+5,182,251,76,76,74,32,67,67,62,26,3,32,252,185,83,130,89,47,47,89,130,83,
+83,129,88,46,46,88,129,83,113,115,115,113,114,109,109,253,31,147,147,0,2,
+0,37,2,229,5,80,5,182,0,7,0,32,0,163,64,93,0,196,1,19,10,16,196,17,192,6,
+208,6,224,6,3,111,6,1,48,6,64,6,80,6,3,31,6,1,4,6,1,32,17,208,17,2,1,6,17,
+17,6,1,3,3,30,25,21,24,196,159,23,175,23,2,23,34,15,34,47,34,63,34,3,34,64,
+21,24,72,34,64,15,18,72,207,3,239,3,2,3,31,9,9,32,12,24,72,9,7,3,200,4,24,
+20,184,255,224,64,12,12,24,72,20,17,8,1,1,21,18,4,3,0,63,51,51,51,47,51,51,
+51,43,51,16,225,50,51,43,17,51,1,47,93,43,43,93,16,214,93,225,50,50,50,17,
+23,57,47,47,47,93,93,93,93,93,93,16,225,50,50,16,225,49,48,1,35,17,35,53,
+33,21,35,1,3,35,30,3,21,17,35,17,51,19,19,51,17,35,17,52,62,2,55,35,3,1,104,
+127,196,2,10,199,2,64,186,7,1,2,1,1,123,186,180,191,178,127,1,1,1,1,6,195,
+2,229,2,101,108,108,253,155,2,37,16,34,30,24,6,254,73,2,209,253,217,2,39,
+253,47,1,172,9,30,35,35,12,253,219,255,255,0,78,0,0,5,166,5,205,2,6,1,118,
+0,0,0,2,0,102,255,221,4,139,4,72,0,34,0,47,0,59,64,33,35,74,30,17,49,47,19,
+74,16,5,1,5,29,29,24,18,78,43,47,59,47,2,47,47,24,41,78,12,15,24,78,0,22,
+0,63,225,63,225,18,57,47,93,225,17,57,47,1,47,93,225,50,16,222,50,225,49,
+48,5,34,46,2,53,52,62,4,51,50,30,2,21,33,17,30,3,51,50,62,2,55,23,14,3,19,
+17,46,3,35,34,14,2,7,17,2,121,130,198,134,69,44,76,102,118,128,63,113,194,
+142,81,252,197,22,64,77,88,46,74,116,94,77,34,72,36,83,110,143,204,19,59,
+77,93,53,51,87,73,60,24,35,94,157,204,110,99,160,126,92,60,29,79,147,209,
+131,254,156,24,44,34,21,32,60,87,55,41,57,101,77,44,2,139,1,21,20,42,35,22,
+19,33,42,23,254,233,255,255,0,83,255,236,5,211,5,182,0,38,0,123,20,0,0,39,
+2,23,2,94,0,0,1,7,2,64,3,98,253,179,0,48,64,31,4,3,2,39,25,1,244,17,1,228,
+17,1,208,17,1,176,17,1,160,17,1,48,17,1,17,47,89,1,15,89,1,93,93,17,93,93,
+93,93,93,93,53,0,63,53,53,53,255,255,0,51,255,236,5,211,5,201,0,38,0,117,
+20,0,0,39,2,23,2,139,0,0,1,7,2,64,3,98,253,179,0,60,64,40,4,3,2,73,25,1,240,
+51,1,208,51,1,196,51,1,180,51,1,160,51,1,148,51,1,96,51,1,48,51,1,36,51,1,
+51,47,123,1,15,123,1,93,93,17,93,93,93,93,93,93,93,93,93,53,0,63,53,53,53,
+255,255,0,79,255,236,5,211,5,182,0,38,2,61,20,0,0,39,2,23,2,139,0,0,1,7,2,
+64,3,98,253,179,0,60,64,40,4,3,2,61,25,1,240,39,1,208,39,1,196,39,1,180,39,
+1,160,39,1,148,39,1,96,39,1,48,39,1,36,39,1,39,47,111,1,15,111,1,93,93,17,
+93,93,93,93,93,93,93,93,93,53,0,63,53,53,53,255,255,0,113,255,236,5,211,5,
+182,0,38,2,63,66,0,0,39,2,23,2,57,0,0,1,7,2,64,3,98,253,179,0,52,64,34,4,
+3,2,31,25,1,244,9,1,235,9,1,203,9,1,180,9,1,155,9,1,127,9,1,43,9,1,9,47,81,
+1,15,81,1,93,93,17,93,93,93,93,93,93,93,53,0,63,53,53,53,0,2,0,98,255,236,
+4,59,5,197,0,43,0,67,0,59,64,33,51,25,71,0,87,69,64,69,1,15,69,1,6,63,72,
+33,12,86,68,56,79,19,19,44,33,28,80,39,4,44,80,7,22,0,63,225,63,225,51,18,
+57,47,225,1,16,246,50,225,94,93,93,16,246,225,50,49,48,1,20,14,4,35,34,46,
+2,53,52,62,4,51,50,22,23,54,52,53,52,38,35,34,14,2,7,53,62,3,51,50,30,2,1,
+50,62,4,55,46,3,35,34,14,4,21,20,30,2,4,59,32,65,101,138,177,109,106,140,
+83,34,23,50,81,115,153,98,91,147,45,2,139,137,31,68,67,65,27,24,67,75,79,
+37,125,166,99,42,253,158,53,94,81,67,53,37,10,10,41,59,73,42,62,102,79,58,
+37,18,21,45,70,3,166,106,225,212,188,141,82,66,110,143,76,60,141,141,131,
+101,61,79,69,19,42,11,190,201,12,22,31,19,174,12,23,17,10,89,150,196,252,
+115,44,77,104,122,133,67,40,69,51,30,48,81,104,111,110,47,50,86,64,36,0,0,
+2,0,41,0,0,4,98,5,182,0,5,0,14,0,88,64,17,2,1,9,9,5,14,91,96,4,112,4,176,
+4,240,4,4,4,184,255,192,64,39,6,10,72,4,4,16,47,16,95,16,111,16,127,16,159,
+16,191,16,6,16,64,6,9,72,13,91,5,13,95,5,18,9,32,10,17,72,9,1,3,0,63,51,43,
+63,225,1,47,225,43,93,17,51,47,43,93,225,18,57,61,47,51,51,49,48,55,1,51,
+1,21,33,1,38,38,39,6,6,7,3,33,41,1,190,187,1,192,251,199,2,119,32,45,15,17,
+42,29,250,2,166,113,5,69,250,185,111,3,154,97,168,75,75,168,91,253,4,0,1,
+0,199,254,20,5,39,5,182,0,7,0,55,64,17,0,90,7,101,9,0,9,48,9,64,9,112,9,128,
+9,5,9,184,255,192,64,15,20,24,72,3,90,4,100,8,2,95,5,3,4,0,27,0,63,50,63,
+225,1,16,246,225,43,93,16,246,225,49,48,1,17,33,17,35,17,33,17,4,109,253,
+20,186,4,96,254,20,6,252,249,4,7,162,248,94,0,1,0,74,254,20,4,227,5,182,0,
+11,0,92,64,11,8,91,112,6,1,2,6,2,6,0,10,184,255,192,183,9,14,72,10,10,13,
+7,9,184,255,224,64,9,15,24,72,9,3,0,0,12,13,184,255,192,64,15,19,24,72,8,
+2,2,9,7,95,4,3,9,95,0,27,0,63,225,63,225,18,57,61,47,51,1,43,17,51,24,47,
+51,51,43,50,17,51,47,43,18,57,57,47,47,93,225,49,48,19,53,1,1,53,33,21,33,
+1,1,33,21,74,2,112,253,160,4,72,252,188,2,58,253,176,3,155,254,20,115,3,146,
+3,43,114,164,253,9,252,157,164,0,0,1,0,102,2,135,4,2,3,29,0,3,0,50,64,31,
+2,5,150,0,1,139,0,1,121,0,1,86,0,1,75,0,1,56,0,1,20,0,1,9,0,1,0,0,173,1,179,
+0,63,225,1,47,93,93,93,93,93,93,93,93,16,206,49,48,19,53,33,21,102,3,156,
+2,135,150,150,0,0,1,0,37,255,242,4,197,6,160,0,8,0,44,64,19,1,0,6,5,2,6,2,
+6,7,8,16,8,3,3,174,4,4,7,0,0,47,47,57,47,225,1,47,47,56,51,57,57,25,47,24,
+47,51,17,51,51,49,48,5,35,1,35,53,33,19,1,51,2,115,133,254,235,180,1,41,229,
+2,0,146,14,3,10,143,253,105,5,172,0,0,3,0,119,1,145,5,49,4,14,0,35,0,51,0,
+67,0,118,64,79,73,23,1,72,13,1,240,69,1,47,69,95,69,2,58,39,74,39,106,39,
+3,42,55,1,55,26,8,39,4,63,119,47,151,47,2,47,170,32,18,48,18,2,18,120,63,
+1,63,171,0,52,42,174,23,58,36,174,8,55,39,26,4,23,5,0,13,16,13,2,7,13,13,
+31,159,23,1,32,23,1,23,0,47,93,93,51,51,47,94,93,51,18,23,57,225,50,16,225,
+50,1,47,225,93,47,93,225,93,18,23,57,93,93,93,93,49,48,93,93,1,20,14,2,35,
+34,38,39,14,3,35,34,46,2,53,52,62,2,51,50,22,23,62,3,51,50,30,2,5,50,54,55,
+38,38,35,34,14,2,21,20,30,2,1,34,6,7,22,22,51,50,62,2,53,52,46,2,5,49,43,
+77,109,66,93,155,65,29,70,78,83,43,65,110,79,45,43,78,111,67,85,158,62,29,
+68,79,87,48,66,109,77,43,252,123,63,108,52,49,107,69,40,64,44,24,21,44,65,
+2,124,63,107,55,51,108,68,39,64,45,24,25,46,64,2,205,63,114,87,52,105,115,
+48,79,56,30,44,82,117,72,65,115,86,49,107,112,48,78,56,31,45,82,117,249,87,
+97,94,90,29,51,68,38,36,66,50,30,1,106,87,97,93,92,29,51,68,39,38,67,49,28,
+0,1,0,16,254,20,3,6,6,20,0,35,0,55,64,35,16,37,208,37,2,20,4,1,6,4,1,4,13,
+172,27,21,1,9,21,1,21,16,30,32,30,2,30,25,174,18,28,7,174,0,0,0,63,225,63,
+225,1,47,93,51,93,93,225,50,93,93,93,49,48,1,50,22,23,21,38,38,35,34,14,2,
+21,17,20,14,2,35,34,38,39,53,22,22,51,50,62,2,53,17,52,62,2,2,131,34,75,22,
+18,61,36,51,66,39,16,50,89,124,74,36,75,23,20,62,35,51,69,42,18,47,87,121,
+6,20,9,9,147,9,17,39,65,84,45,250,215,94,134,86,41,11,8,147,8,16,37,64,84,
+48,5,39,94,134,86,40,0,2,0,102,1,123,4,2,4,37,0,35,0,71,0,75,64,46,65,29,
+73,16,73,1,46,16,10,32,10,2,10,64,41,173,49,175,67,23,173,10,31,175,28,5,
+173,223,13,239,13,255,13,3,13,64,15,18,72,13,13,59,173,46,67,179,0,63,51,
+225,51,47,43,93,225,51,245,50,225,16,245,225,51,1,47,93,51,93,16,206,50,49,
+48,1,46,3,35,34,14,2,7,53,54,51,50,30,2,23,30,3,51,50,62,2,55,21,6,35,34,
+46,2,3,46,3,35,34,14,2,7,53,54,51,50,30,2,23,30,3,51,50,62,2,55,21,6,35,34,
+46,2,2,18,37,55,45,41,22,28,60,59,56,25,100,148,29,50,55,67,47,37,55,47,40,
+22,28,60,59,56,24,99,149,29,50,55,67,47,37,55,45,41,22,28,60,59,56,25,100,
+148,29,50,55,67,47,37,55,47,40,22,28,60,59,56,24,97,151,29,50,55,67,1,188,
+16,22,13,5,19,33,44,25,162,108,5,13,25,20,16,22,13,5,19,33,44,25,162,108,
+5,13,25,1,174,16,21,13,5,19,32,44,26,162,109,5,14,25,20,16,21,13,5,19,32,
+45,25,162,108,5,13,25,0,1,0,102,0,164,4,2,5,4,0,19,0,166,64,17,10,13,14,17,
+18,9,18,18,0,3,4,7,8,19,8,9,19,184,255,240,64,79,9,16,19,9,19,9,6,16,11,21,
+64,21,1,1,198,6,1,187,6,1,169,6,1,134,6,1,123,6,1,104,6,1,66,6,1,57,6,1,6,
+9,8,8,13,4,173,7,19,18,18,17,0,173,14,31,3,47,3,2,127,3,1,0,3,16,3,2,6,3,
+3,10,240,7,1,15,7,111,7,2,7,0,47,93,93,51,51,47,94,93,93,113,51,225,50,50,
+17,51,16,225,50,51,17,51,1,47,93,93,93,93,93,93,93,93,51,93,16,206,50,17,
+57,57,47,47,56,56,17,51,125,135,196,196,196,196,1,51,16,135,196,196,196,196,
+49,48,1,35,53,33,19,33,53,33,19,23,7,51,21,33,3,33,21,33,3,39,1,94,248,1,
+62,121,254,73,1,252,133,138,105,250,254,193,123,1,186,254,0,129,137,1,186,
+150,1,4,149,1,27,59,224,149,254,252,150,254,234,57,0,2,0,102,0,0,4,2,4,221,
+0,6,0,10,0,82,64,50,9,0,12,64,12,1,8,64,1,1,1,2,1,5,5,3,6,111,0,127,0,2,48,
+0,1,0,0,4,32,3,1,80,3,112,3,128,3,208,3,240,3,5,63,3,1,0,3,1,6,3,0,47,94,
+93,93,93,113,51,51,47,93,93,50,18,57,61,47,51,51,1,24,47,93,51,93,16,206,
+50,49,48,37,1,53,1,21,9,2,53,33,21,4,2,252,100,3,156,253,33,2,223,252,100,
+3,156,238,1,168,102,1,225,160,254,148,254,190,254,113,150,150,0,0,2,0,102,
+0,0,4,2,4,221,0,6,0,10,0,82,64,50,9,5,12,64,12,1,8,64,6,1,6,5,4,1,1,3,0,111,
+6,127,6,2,48,6,1,6,6,2,32,3,1,80,3,112,3,128,3,208,3,240,3,5,63,3,1,0,3,1,
+6,3,0,47,94,93,93,93,113,51,51,47,93,93,51,18,57,61,47,51,51,1,24,47,93,51,
+93,16,206,50,49,48,19,1,1,53,1,21,1,21,53,33,21,102,2,226,253,30,3,156,252,
+100,3,156,1,143,1,66,1,106,162,254,31,102,254,88,238,150,150,0,0,2,0,109,
+0,0,4,63,5,195,0,5,0,9,0,93,64,54,2,1,9,5,4,7,9,7,3,6,172,0,11,255,11,1,64,
+11,80,11,128,11,176,11,192,11,5,15,11,47,11,2,8,170,16,3,1,3,3,8,0,6,8,6,
+8,6,2,7,173,4,7,9,173,2,0,47,225,63,225,18,57,57,61,47,47,17,51,17,51,1,24,
+47,93,225,93,93,93,16,222,225,18,57,57,17,51,51,17,51,51,49,48,1,1,35,1,1,
+51,9,3,4,63,254,60,76,254,62,1,194,76,1,12,254,207,254,207,1,49,2,225,253,
+31,2,223,2,228,253,30,2,0,254,0,253,254,0,255,255,0,29,0,0,4,23,6,31,0,38,
+0,73,0,0,1,7,0,76,2,162,0,0,0,36,64,24,2,1,175,29,1,80,29,1,31,29,1,15,29,
+1,29,175,47,1,64,47,1,15,47,1,93,93,93,17,93,93,93,93,53,53,255,255,0,29,
+0,0,4,6,6,31,0,38,0,73,0,0,1,7,0,79,2,162,0,0,0,34,64,23,1,175,29,1,80,29,
+1,31,29,1,15,29,1,29,175,33,1,64,33,1,15,33,1,93,93,93,17,93,93,93,93,53,
+0,1,0,207,4,217,3,205,6,23,0,21,0,63,64,41,0,23,32,23,2,175,23,207,23,2,48,
+23,112,23,2,15,0,1,0,0,0,10,48,10,2,6,10,10,127,0,1,0,64,6,9,72,0,0,16,142,
+5,0,47,225,51,47,43,93,51,1,47,94,93,51,47,93,93,93,113,49,48,1,14,3,35,34,
+46,2,39,51,30,3,51,50,62,2,55,3,205,6,49,93,141,100,103,140,88,41,5,170,5,
+27,50,76,53,44,73,54,34,6,6,23,78,118,81,41,39,80,119,80,57,73,41,16,19,43,
+72,53,0,1,255,188,254,20,1,100,4,74,0,19,0,35,64,19,16,21,32,21,2,15,71,12,
+3,3,12,84,20,13,15,7,80,0,27,0,63,225,63,1,16,230,50,47,16,225,93,49,48,19,
+34,38,39,53,22,22,51,50,62,2,53,17,51,17,20,14,2,66,48,63,23,26,54,35,27,
+46,35,19,182,34,72,109,254,20,14,11,148,10,11,15,39,65,51,4,244,251,24,77,
+123,87,47,0,0,1,1,135,4,205,2,121,6,20,0,13,0,25,64,12,5,133,63,6,1,6,12,
+0,12,146,5,0,0,63,229,1,47,51,221,93,225,49,48,1,62,3,55,51,21,14,3,7,35,
+1,135,9,18,17,14,4,180,6,31,41,46,22,96,4,231,30,77,81,80,33,20,25,78,86,
+86,32,0,1,1,111,254,59,2,117,255,131,0,13,0,22,64,9,12,0,0,5,133,6,12,146,
+5,0,47,229,1,47,225,50,47,51,49,48,1,62,3,55,51,21,14,3,7,35,1,111,11,26,
+24,19,4,178,6,31,44,54,29,98,254,86,25,76,84,83,33,20,25,77,87,86,33,0,0,
+1,1,125,4,217,2,131,6,33,0,13,0,23,64,10,12,0,0,5,133,6,5,146,12,0,0,63,229,
+1,47,225,50,47,51,49,48,1,14,3,7,35,53,62,3,55,51,2,131,12,26,24,18,4,178,
+5,31,45,55,28,98,6,6,25,76,84,83,33,21,24,78,86,86,33,0,2,0,37,2,57,2,127,
+5,199,0,11,0,29,0,42,64,25,6,225,12,31,79,31,127,31,2,31,64,6,10,72,0,225,
+22,9,229,27,222,3,229,17,223,0,63,225,63,225,1,47,225,43,93,16,222,225,49,
+48,19,20,22,51,50,54,53,52,38,35,34,6,5,20,14,2,35,34,46,2,53,52,62,2,51,
+50,22,184,71,81,78,78,78,78,81,71,1,199,35,74,115,79,74,112,75,38,35,73,113,
+78,149,154,4,2,165,161,159,167,165,159,159,165,108,170,117,62,62,117,170,
+108,108,169,116,60,236,0,0,2,0,12,2,74,2,143,5,188,0,10,0,21,0,70,64,42,9,
+2,225,11,7,3,3,23,95,23,143,23,2,23,64,6,10,72,21,225,5,1,4,229,9,15,11,31,
+11,47,11,3,8,11,11,2,15,229,7,220,2,221,0,63,63,225,18,57,47,94,93,51,225,
+50,1,47,225,43,93,18,57,47,51,51,225,50,49,48,1,35,21,35,53,33,53,1,51,17,
+51,33,53,52,54,55,14,3,7,7,2,143,125,143,254,137,1,121,141,125,254,244,3,
+3,5,20,22,24,9,155,3,10,192,192,111,2,67,253,205,195,42,99,49,11,37,42,40,
+15,240,0,0,1,0,59,2,55,2,102,5,182,0,36,0,74,64,23,33,34,34,30,29,29,11,32,
+20,225,5,38,79,38,127,38,2,38,64,6,10,72,11,184,255,192,64,17,18,24,72,11,
+23,229,0,0,17,33,229,30,220,17,229,8,223,0,63,225,63,225,18,57,47,225,1,47,
+43,43,93,16,222,225,51,18,57,47,51,51,17,51,49,48,1,50,30,2,21,20,6,35,34,
+38,39,53,30,3,51,50,54,53,52,38,35,34,14,2,7,39,19,33,21,33,7,54,54,1,66,
+61,107,79,45,166,161,63,121,44,26,60,61,59,24,85,95,95,89,13,37,39,37,14,
+67,33,1,186,254,190,18,20,57,4,109,35,68,101,65,140,157,28,26,141,18,27,19,
+10,76,88,77,85,4,6,7,2,43,1,168,123,215,3,6,0,0,2,0,37,2,57,2,127,5,213,0,
+29,0,45,0,56,64,32,16,10,33,225,0,47,79,47,127,47,2,47,64,6,10,72,21,41,225,
+10,36,228,21,25,25,16,15,222,30,229,5,223,0,63,225,63,51,57,47,51,225,1,47,
+225,50,43,93,16,222,225,18,57,49,48,1,20,14,2,35,34,46,2,53,52,62,2,55,23,
+14,3,7,51,54,54,51,50,30,2,5,50,54,53,52,38,35,34,14,2,21,20,30,2,2,127,42,
+78,111,68,64,110,82,47,69,126,178,110,45,79,127,96,64,15,11,27,99,74,54,90,
+64,36,254,219,68,84,77,71,39,63,45,25,25,45,61,3,102,65,111,80,45,45,88,128,
+83,110,179,143,109,39,109,27,64,79,96,59,43,49,37,72,105,247,92,86,82,90,
+25,41,55,30,44,73,53,29,0,1,0,47,2,74,2,100,5,182,0,6,0,56,185,0,0,255,240,
+64,31,0,0,2,1,225,5,8,79,8,127,8,2,8,64,6,10,72,208,2,224,2,240,2,3,2,2,229,
+3,220,0,221,0,63,63,225,1,47,93,43,93,16,222,225,17,57,47,56,49,48,19,1,33,
+53,33,21,1,141,1,64,254,98,2,53,254,191,2,74,2,241,123,100,252,248,0,3,0,
+49,2,57,2,113,5,199,0,37,0,52,0,68,0,119,64,34,56,225,33,66,225,5,10,61,50,
+28,4,5,33,5,33,5,23,44,225,15,70,79,70,127,70,2,70,64,6,10,72,38,225,23,184,
+255,192,64,39,21,24,72,23,10,28,61,50,75,50,91,50,107,50,155,50,171,50,5,
+50,20,53,182,61,198,61,214,61,3,61,0,41,229,20,223,53,229,0,222,0,63,225,
+63,225,17,57,93,17,18,57,93,17,18,57,57,1,47,43,225,43,93,16,222,225,18,57,
+57,47,47,18,23,57,16,225,16,225,49,48,1,50,30,2,21,20,14,2,7,30,3,21,20,14,
+2,35,34,38,53,52,62,2,55,46,3,53,52,62,2,3,20,22,51,50,54,53,52,46,2,39,39,
+6,6,19,34,6,21,20,30,2,23,62,3,53,52,38,1,82,52,94,70,42,22,39,52,30,34,62,
+48,28,42,77,105,63,139,150,25,42,56,31,27,46,35,19,43,72,95,98,74,72,74,75,
+22,39,55,33,15,65,66,148,56,63,18,32,45,26,24,44,32,19,65,5,199,27,55,84,
+56,37,62,50,40,17,19,45,55,69,42,57,93,66,36,131,115,42,69,56,43,17,20,43,
+53,62,37,56,83,55,28,253,104,59,70,70,59,30,48,39,32,15,6,34,77,1,232,55,
+54,27,42,36,29,13,12,28,35,44,28,54,55,0,2,0,33,2,57,2,123,5,201,0,37,0,53,
+0,59,64,34,49,17,224,9,28,0,55,79,55,127,55,2,55,64,6,10,72,41,225,28,44,
+228,17,23,23,5,38,229,33,222,12,229,5,223,0,63,225,63,225,18,57,47,51,225,
+1,47,225,43,93,16,222,17,57,225,50,49,48,1,20,14,2,35,34,38,39,53,22,22,51,
+50,62,2,55,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,37,34,6,21,20,22,51,50,
+62,2,53,52,46,2,2,123,33,90,162,129,25,64,21,21,54,25,83,108,64,29,3,9,13,
+36,48,61,38,60,96,68,36,41,75,108,67,65,114,84,48,254,203,68,86,74,76,38,
+63,45,24,21,42,62,4,66,96,187,147,91,8,7,125,13,10,53,87,114,61,18,36,27,
+17,37,71,102,65,66,111,81,45,47,97,147,172,94,88,76,88,25,41,51,26,36,72,
+59,36,0,0,22,0,84,254,129,7,193,5,238,0,5,0,11,0,17,0,23,0,27,0,31,0,35,0,
+39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,83,0,95,0,111,0,120,0,129,0,
+144,0,228,64,89,52,44,32,28,56,24,87,81,122,112,111,116,103,100,100,130,126,
+107,112,81,192,81,208,81,3,81,111,107,107,111,81,3,93,137,79,140,95,140,2,
+140,140,68,40,36,9,23,93,80,75,96,75,2,75,75,65,61,49,0,12,42,66,70,62,38,
+50,134,143,143,111,121,103,112,112,122,96,122,111,84,72,72,112,111,128,111,
+2,97,111,1,111,184,255,192,64,37,7,12,72,111,111,96,90,78,78,138,120,31,96,
+47,96,63,96,111,96,4,96,96,1,44,28,24,18,12,57,53,33,7,15,1,1,7,1,0,47,94,
+93,51,51,51,51,47,51,51,51,51,18,57,47,93,51,51,51,47,51,17,51,47,43,93,93,
+51,47,51,17,51,17,18,57,47,51,51,17,51,47,51,47,51,47,51,47,51,1,47,51,51,
+51,51,51,47,93,51,47,51,51,51,51,51,47,93,51,18,23,57,47,47,47,93,17,51,51,
+51,47,51,51,17,51,51,17,51,47,51,47,51,47,51,49,48,19,17,33,21,35,21,37,53,
+33,17,35,53,1,17,51,21,51,21,33,53,51,53,51,17,33,53,33,21,33,53,33,21,1,
+53,33,21,1,35,17,51,17,35,17,51,1,53,33,21,1,35,17,51,1,53,33,21,51,53,33,
+21,1,35,17,51,53,35,17,51,1,35,17,51,1,34,38,53,52,54,55,50,22,21,20,6,39,
+50,54,53,52,38,35,34,6,21,20,22,1,51,50,22,21,20,6,7,21,22,22,21,20,6,35,
+35,19,51,50,54,53,52,38,35,35,21,21,51,50,54,53,52,38,35,5,53,22,22,51,50,
+54,53,17,51,17,20,6,35,34,84,1,47,192,5,206,1,48,109,249,0,111,192,5,14,195,
+109,253,73,1,17,251,225,1,14,254,242,1,14,4,183,109,109,109,109,251,194,1,
+16,252,48,111,111,2,192,1,16,119,1,17,250,168,111,111,111,111,6,254,109,109,
+250,153,127,135,135,127,127,135,135,127,72,63,63,72,69,66,66,1,159,172,109,
+112,45,45,56,51,109,94,207,123,66,46,36,41,48,59,74,49,37,38,52,1,14,16,32,
+20,37,49,125,104,95,61,4,190,1,48,111,193,193,111,254,208,193,249,2,1,47,
+194,109,109,194,254,209,109,109,109,109,6,254,111,111,250,168,1,14,2,2,1,
+15,250,59,109,109,1,166,1,14,4,74,111,111,111,111,252,47,1,16,121,1,15,253,
+104,1,16,254,138,159,142,145,155,1,156,145,142,159,104,103,94,94,102,102,
+94,94,103,1,234,67,83,49,68,8,4,11,68,58,81,89,1,98,34,32,34,29,227,154,43,
+37,32,42,252,102,3,5,36,50,1,146,254,114,94,100,0,3,0,84,254,193,7,170,6,
+20,0,3,0,35,0,47,0,80,64,40,4,35,35,36,32,42,48,42,64,42,3,42,42,79,36,1,
+36,36,2,28,11,11,2,21,21,2,35,35,48,45,1,45,45,39,39,3,25,16,16,3,0,25,47,
+51,24,47,51,17,51,47,51,47,93,51,47,1,25,47,51,24,47,17,51,47,51,17,51,47,
+93,51,47,93,17,51,47,51,49,48,9,3,5,53,52,54,55,54,54,53,52,46,2,35,34,14,
+2,7,23,54,54,51,50,22,21,20,6,7,6,6,21,21,3,20,22,51,50,54,53,52,38,35,34,
+6,3,254,3,172,252,84,252,86,3,235,33,76,99,77,49,91,131,81,43,90,87,82,34,
+82,68,126,56,63,62,39,82,69,74,27,71,70,68,71,71,68,70,71,6,20,252,86,252,
+87,3,169,251,47,44,62,58,76,131,89,69,107,74,39,16,27,35,20,178,34,46,58,
+47,49,68,65,53,121,80,59,254,237,62,73,73,62,64,73,73,0,255,255,255,188,254,
+20,2,85,6,33,2,38,2,55,0,0,0,7,1,76,254,187,0,0,255,255,0,23,3,193,1,80,5,
+182,2,6,2,7,0,0,0,2,0,10,255,236,4,178,6,43,0,12,0,79,0,117,64,71,77,13,67,
+16,62,0,59,8,71,67,67,26,59,71,79,0,16,1,16,16,81,160,81,1,63,81,1,51,71,
+0,26,16,26,32,26,3,26,34,80,41,62,79,79,78,0,78,0,41,16,41,48,41,64,41,80,
+41,5,6,41,78,41,78,56,5,80,72,1,56,80,21,22,0,63,225,63,225,18,57,57,47,47,
+94,93,17,51,16,225,50,16,225,1,47,93,225,93,93,17,51,47,93,51,225,17,57,47,
+225,17,57,57,17,18,57,57,49,48,1,46,3,35,34,6,21,20,30,2,5,22,22,21,20,2,
+6,6,35,34,46,2,53,52,62,2,53,52,38,35,34,6,7,39,54,54,51,50,30,2,21,20,14,
+2,21,20,30,2,51,50,18,17,52,38,39,46,3,53,52,62,2,51,50,30,2,23,51,21,3,106,
+13,57,77,91,48,76,86,46,106,171,1,60,2,2,64,129,196,131,111,146,86,34,10,
+11,10,31,31,24,54,16,37,37,100,54,50,69,44,19,10,11,10,21,48,78,58,164,164,
+2,2,174,242,150,67,39,81,127,89,104,161,117,75,18,143,3,209,108,170,116,61,
+88,72,56,105,82,51,138,22,58,31,159,254,238,201,115,55,95,125,69,40,93,89,
+75,24,45,33,15,10,127,17,26,28,50,68,40,35,86,93,97,45,42,74,54,31,1,50,1,
+48,23,62,20,2,75,120,154,81,67,112,82,46,84,156,223,139,137,0,0,1,0,0,0,0,
+4,72,5,195,0,34,0,143,64,27,175,36,239,36,2,36,64,9,12,72,34,171,33,1,152,
+33,1,64,33,1,27,33,1,15,33,1,33,184,255,240,64,68,33,33,0,31,27,13,1,15,13,
+1,13,32,18,22,72,159,13,175,13,2,125,13,1,107,13,1,90,13,1,79,13,1,43,13,
+59,13,2,13,13,30,90,119,31,135,31,151,31,3,79,31,1,0,31,16,31,2,7,31,29,0,
+31,33,3,31,18,17,10,4,0,63,193,63,63,18,57,57,1,47,94,93,93,93,225,50,47,
+93,93,93,93,93,93,43,113,113,17,57,51,47,56,93,93,93,93,93,51,43,93,49,48,
+1,62,3,55,62,3,51,50,22,23,21,38,38,35,34,14,2,7,14,5,7,17,35,17,1,51,2,29,
+25,61,63,60,24,22,47,53,64,41,35,43,17,13,32,13,11,28,32,35,19,13,40,50,54,
+54,50,19,187,254,66,203,2,219,75,168,160,137,44,40,61,39,20,9,8,145,3,5,7,
+23,42,35,24,85,110,128,133,133,60,253,227,2,47,3,135,0,2,0,18,255,236,6,96,
+4,74,0,28,0,60,0,143,64,71,25,103,47,1,47,71,213,44,1,183,44,1,169,44,1,154,
+44,1,3,44,44,3,55,72,171,18,187,18,2,18,18,62,20,62,1,84,62,100,62,132,62,
+164,62,180,62,5,64,62,1,2,48,62,1,15,62,1,34,72,0,3,16,3,48,3,64,3,80,3,5,
+6,3,184,255,192,64,21,18,21,72,3,26,0,45,45,39,29,14,8,80,11,15,50,39,80,
+22,0,22,0,63,50,225,50,63,225,50,50,18,57,47,18,57,1,47,43,94,93,225,93,93,
+95,93,93,113,17,51,47,93,225,17,57,47,95,93,93,93,93,225,93,57,49,48,5,34,
+38,53,52,62,2,55,33,53,55,33,21,35,30,3,21,20,6,35,34,38,39,35,6,6,3,14,3,
+21,20,30,2,51,50,62,2,53,53,51,21,20,22,51,50,62,2,53,52,46,2,39,2,41,182,
+195,18,32,43,26,254,235,134,5,200,243,24,38,27,15,196,181,106,139,31,11,31,
+139,186,22,40,31,18,29,54,75,45,46,68,44,22,179,98,82,45,75,54,29,15,25,36,
+21,20,234,243,57,125,126,123,56,74,80,154,56,123,126,125,57,243,234,87,91,
+91,87,3,196,54,118,121,122,58,98,131,78,33,41,72,98,57,176,176,130,138,33,
+78,131,98,58,122,121,118,54,0,255,255,0,199,0,0,6,47,7,117,2,38,0,48,0,0,
+1,7,0,118,1,121,1,84,0,19,64,11,1,39,5,38,1,75,26,32,9,15,37,1,43,53,0,43,
+53,0,255,255,0,174,0,0,6,135,6,33,2,38,0,80,0,0,1,7,0,118,1,199,0,0,0,19,
+64,11,1,58,17,38,1,122,45,51,22,43,37,1,43,53,0,43,53,0,255,255,0,0,253,213,
+4,221,5,188,2,38,0,36,0,0,1,7,2,91,1,27,0,0,0,13,183,3,2,1,31,21,4,7,37,1,
+43,53,53,0,255,255,0,94,253,213,3,156,4,94,2,38,0,68,0,0,1,7,2,91,0,188,0,
+0,0,13,183,3,2,20,61,51,12,34,37,1,43,53,53,0,255,255,254,211,255,236,5,195,
+5,205,0,38,0,50,82,0,1,7,2,92,254,64,0,0,0,63,182,3,2,45,3,3,2,53,184,255,
+192,178,9,15,72,184,255,33,64,26,53,53,10,10,37,1,0,176,0,1,128,0,1,127,0,
+1,80,0,1,64,0,1,31,0,1,0,17,93,93,93,93,93,93,53,53,43,43,53,53,0,63,53,53,
+0,0,2,0,115,253,213,2,55,255,131,0,19,0,31,0,58,64,40,20,131,15,0,63,0,79,
+0,95,0,4,0,26,131,48,10,1,10,29,140,0,5,16,5,48,5,64,5,80,5,160,5,240,5,7,
+6,5,23,140,15,0,47,225,212,94,93,225,1,47,93,225,212,93,225,49,48,1,20,14,
+2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,38,35,34,6,21,20,22,51,50,54,2,55,
+35,61,84,49,50,82,59,32,32,59,82,50,48,84,62,35,116,64,49,50,63,57,56,49,
+64,254,174,51,81,56,29,29,56,79,51,51,79,56,29,29,55,79,52,53,60,60,53,53,
+60,60,0,2,0,147,4,104,2,217,5,199,0,13,0,31,0,66,64,9,21,48,14,64,14,2,14,
+17,26,184,255,192,64,28,9,16,72,26,26,43,13,1,4,13,20,13,2,13,6,5,12,5,12,
+63,17,79,17,95,17,3,17,29,0,47,204,93,57,57,47,47,1,47,205,93,93,50,47,43,
+51,205,93,57,49,48,1,62,3,55,51,21,14,3,7,35,37,52,54,55,21,6,6,21,20,30,
+2,21,20,6,35,34,38,1,176,11,25,24,22,8,207,18,48,56,62,31,82,254,227,120,
+122,60,57,31,37,31,50,47,58,69,4,137,30,75,79,81,36,20,32,77,80,81,37,120,
+78,115,31,76,22,46,24,19,18,16,26,28,37,39,70,0,255,255,0,29,0,0,6,185,6,
+31,0,38,0,73,0,0,0,39,0,73,2,162,0,0,1,7,0,76,5,68,0,0,0,56,64,38,3,2,143,
+57,1,112,57,1,64,57,1,47,57,1,15,57,1,57,1,224,31,1,176,31,1,31,175,75,1,
+112,75,1,64,75,1,15,75,1,93,93,93,93,17,93,93,53,17,93,93,93,93,93,53,53,
+255,255,0,29,0,0,6,168,6,31,0,38,0,73,0,0,0,39,0,73,2,162,0,0,1,7,0,79,5,
+68,0,0,0,54,64,37,2,143,57,1,112,57,1,64,57,1,47,57,1,15,57,1,57,1,224,31,
+1,176,31,1,31,175,61,1,112,61,1,64,61,1,15,61,1,93,93,93,93,17,93,93,53,17,
+93,93,93,93,93,53,0,2,0,125,255,236,6,37,6,20,0,32,0,52,0,75,64,44,27,6,19,
+9,32,91,1,1,43,91,9,103,54,192,54,1,191,54,1,112,54,1,47,54,95,54,2,33,91,
+19,102,53,6,27,14,48,95,32,24,4,38,95,14,19,0,63,225,63,206,225,18,57,57,
+1,16,246,225,93,93,93,93,16,246,225,51,47,225,17,18,57,57,49,48,1,23,14,3,
+7,22,22,21,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,23,62,3,53,1,20,
+30,2,51,50,62,2,53,52,46,2,35,34,14,2,6,23,14,12,40,63,90,63,43,45,81,160,
+237,155,163,239,157,76,76,158,239,164,158,236,81,41,49,25,8,251,242,52,107,
+165,114,114,165,107,50,50,106,164,114,114,166,108,52,6,20,22,60,112,97,76,
+24,89,216,127,170,254,235,198,108,108,198,1,23,170,170,1,21,196,107,111,102,
+12,53,74,93,52,252,201,137,219,153,81,81,153,219,137,138,218,151,81,81,151,
+218,0,0,2,0,113,255,236,4,244,4,242,0,32,0,44,0,74,64,44,23,74,25,25,30,18,
+10,39,72,0,0,16,0,2,7,0,0,46,16,46,144,46,160,46,176,46,4,33,72,10,86,45,
+18,30,5,42,80,23,15,16,36,80,5,22,0,63,225,63,198,225,18,57,57,1,16,246,225,
+93,17,51,47,94,93,225,18,57,57,51,47,225,49,48,1,20,14,2,35,34,46,2,53,52,
+62,2,51,50,22,23,62,3,53,51,23,14,3,7,22,22,5,20,22,51,50,54,53,52,38,35,
+34,6,4,45,67,125,178,111,103,174,127,71,67,124,179,111,100,169,63,46,52,25,
+6,198,15,16,45,63,86,57,32,36,253,0,137,154,154,135,137,154,154,135,2,39,
+137,213,145,76,76,145,213,137,136,211,145,75,71,68,13,55,75,93,51,23,74,120,
+94,67,20,65,158,94,209,211,211,209,208,208,208,0,0,1,0,184,255,236,6,78,6,
+20,0,36,0,81,64,50,6,91,8,8,35,90,1,159,14,1,176,14,1,175,14,1,14,14,38,112,
+38,128,38,240,38,3,95,38,1,0,38,16,38,2,27,90,24,100,37,1,13,13,36,6,25,3,
+30,95,19,19,0,63,225,63,206,51,51,47,51,1,16,246,225,93,93,93,17,51,47,93,
+93,113,51,225,51,47,225,49,48,1,21,62,3,53,51,23,14,3,7,17,20,14,2,35,34,
+46,2,53,17,51,17,20,22,51,50,62,2,55,17,4,221,52,62,32,10,198,15,15,50,85,
+128,91,66,133,201,136,128,196,133,68,187,172,176,89,128,82,40,1,5,182,196,
+6,50,78,100,56,22,71,130,105,74,15,253,145,114,196,144,82,77,142,199,122,
+3,174,252,72,176,191,54,98,136,81,3,182,0,1,0,164,255,236,5,121,4,242,0,39,
+0,84,64,51,31,74,33,33,1,23,71,26,39,39,41,16,41,1,128,41,160,41,224,41,3,
+111,41,1,0,41,32,41,48,41,3,7,15,71,12,84,40,26,38,38,31,24,13,15,18,80,2,
+7,22,0,21,0,63,63,51,225,63,51,198,51,47,51,1,16,246,225,94,93,93,93,113,
+17,51,47,51,225,50,51,47,225,49,48,33,39,35,14,3,35,34,46,2,53,17,51,17,20,
+22,51,50,62,2,53,17,51,21,62,3,53,51,23,14,3,7,17,3,117,27,10,25,69,82,92,
+48,91,138,92,47,182,106,111,81,110,67,29,182,52,62,32,10,198,15,15,50,85,
+128,91,147,43,63,41,20,46,98,152,105,2,205,253,61,130,130,52,101,148,96,2,
+58,123,6,50,78,101,56,23,71,136,109,72,7,252,176,0,0,1,252,143,4,217,254,
+25,6,33,0,13,0,22,64,10,0,6,8,128,15,0,95,0,2,0,0,47,93,26,204,1,47,205,49,
+48,1,35,46,3,39,53,51,30,3,23,254,25,121,35,81,77,64,16,219,16,43,46,48,22,
+4,217,28,83,88,81,27,21,35,80,81,76,29,0,0,1,253,72,4,217,254,209,6,33,0,
+13,0,22,64,10,6,0,5,128,15,12,95,12,2,12,0,47,93,26,205,1,47,205,49,48,1,
+62,3,55,51,21,14,3,7,35,253,72,21,48,46,43,16,219,16,63,77,82,34,121,4,244,
+29,76,81,80,35,21,27,81,88,83,28,0,0,1,252,70,4,217,255,20,5,227,0,27,0,56,
+64,35,15,23,47,23,2,23,0,9,32,9,2,7,9,22,5,143,14,64,16,19,72,14,64,7,11,
+72,14,14,19,143,9,15,0,1,0,0,47,93,50,225,51,47,43,43,225,51,1,47,94,93,204,
+93,49,48,1,34,46,2,35,34,6,7,35,62,3,51,50,30,2,51,50,54,55,51,14,3,254,66,
+40,79,76,71,31,45,48,14,104,5,33,53,74,46,41,81,77,69,29,45,46,15,104,5,33,
+53,73,4,219,35,43,35,53,62,60,97,69,38,35,42,35,52,62,60,97,69,38,0,0,1,253,
+4,4,184,254,121,6,143,0,27,0,38,64,18,5,8,8,13,0,21,5,8,8,18,15,25,31,25,
+2,25,128,6,0,47,26,204,93,50,57,17,51,1,47,204,50,57,17,51,49,48,1,20,14,
+2,7,7,35,39,62,3,53,52,46,2,35,34,6,7,53,54,54,51,50,22,254,121,27,45,60,
+34,10,113,14,37,60,42,23,21,36,50,29,28,52,16,16,50,41,133,133,5,211,39,58,
+41,27,7,111,176,6,16,24,33,24,24,32,19,7,3,3,108,3,5,91,0,0,1,253,49,254,
+152,254,6,255,125,0,13,0,15,181,8,135,0,11,145,3,0,47,229,1,47,225,49,48,
+5,52,54,51,50,22,21,20,14,2,35,34,38,253,49,62,45,43,63,17,29,39,21,45,62,
+246,60,55,55,60,29,43,28,14,55,255,255,0,199,0,0,3,190,7,115,2,38,0,40,0,
+0,1,7,0,67,255,183,1,82,0,21,180,1,12,5,38,1,184,255,194,180,18,12,1,0,37,
+1,43,53,0,43,53,0,255,255,0,201,0,0,5,16,7,115,2,38,1,178,0,0,1,7,0,67,0,
+66,1,82,0,21,180,1,24,5,38,1,184,255,163,180,30,24,0,12,37,1,43,53,0,43,53,
+0,255,255,0,113,255,236,3,225,6,33,2,38,0,72,0,0,1,6,0,67,148,0,0,21,180,
+2,40,17,38,2,184,255,185,180,46,40,5,15,37,1,43,53,0,43,53,0,255,255,0,174,
+0,0,4,59,6,33,2,38,1,210,0,0,1,6,0,67,202,0,0,21,180,1,12,17,38,1,184,255,
+163,180,18,12,10,4,37,1,43,53,0,43,53,0,0,1,0,125,255,236,7,94,5,201,0,69,
+0,113,64,72,20,4,57,90,37,197,54,1,150,54,166,54,2,137,54,1,54,54,29,65,91,
+12,103,71,0,71,16,71,2,0,71,32,71,80,71,112,71,208,71,224,71,6,7,46,91,29,
+102,70,55,55,51,0,41,95,3,38,38,7,34,4,20,32,9,14,72,20,60,51,95,17,24,19,
+0,63,51,225,50,50,43,63,51,51,17,51,225,50,18,57,47,1,16,246,225,94,93,113,
+16,246,225,17,57,47,93,93,93,51,225,50,57,49,48,1,34,6,7,39,54,54,51,50,22,
+22,18,21,20,2,6,6,35,34,38,39,35,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,
+23,7,38,38,35,34,14,2,21,20,30,2,51,50,54,55,17,51,17,22,22,51,50,62,2,53,
+52,46,2,5,104,60,94,42,76,59,143,81,119,183,125,64,63,129,198,136,111,170,
+73,2,75,168,110,136,198,129,63,64,125,183,119,81,143,59,76,41,95,60,69,113,
+80,43,46,92,138,92,57,118,46,187,46,118,59,92,139,92,46,44,80,113,5,37,46,
+32,156,42,44,99,184,254,248,166,170,254,223,210,119,50,48,48,50,119,210,1,
+33,170,166,1,8,184,99,44,42,156,32,46,70,138,207,136,141,229,164,89,36,38,
+1,189,254,67,38,36,89,164,229,141,136,207,138,70,0,1,0,0,0,0,5,244,4,74,0,
+44,0,231,64,9,101,16,1,201,34,249,34,2,33,184,255,240,179,10,16,72,44,184,
+255,240,179,18,27,72,44,184,255,240,64,25,10,15,72,0,16,10,27,72,38,13,34,
+14,33,34,21,44,0,6,86,15,102,15,2,15,14,184,255,240,64,72,31,14,1,111,14,
+127,14,159,14,223,14,4,89,14,1,79,14,1,116,21,1,107,21,1,36,21,52,21,2,36,
+6,52,6,68,6,116,6,148,6,5,14,6,21,21,14,6,3,1,27,71,0,28,16,28,2,7,28,28,
+46,16,46,32,46,48,46,208,46,224,46,5,2,1,184,255,240,64,30,1,38,64,21,29,
+72,38,32,12,20,72,38,13,16,3,27,14,1,15,21,6,38,6,54,6,2,6,34,0,21,0,63,50,
+50,93,17,51,63,51,51,23,57,43,43,1,47,56,51,93,17,51,47,94,93,225,18,23,57,
+61,47,47,24,47,93,93,93,93,93,93,93,113,56,51,93,17,51,51,17,51,51,17,18,
+57,57,43,43,43,43,93,49,48,93,33,1,51,19,22,22,23,51,62,3,55,19,3,51,19,30,
+3,23,51,62,3,53,51,20,2,2,6,7,35,3,38,38,53,14,3,7,3,1,119,254,137,188,224,
+28,38,9,7,7,21,26,29,15,119,162,188,201,12,31,30,24,5,7,90,114,65,25,183,
+37,92,154,117,192,119,12,13,1,6,9,10,4,152,4,74,253,86,87,157,51,22,58,65,
+69,32,1,12,1,207,253,176,33,99,103,92,25,103,208,226,255,152,163,254,223,
+254,245,252,127,1,84,32,53,3,1,19,27,29,10,254,170,0,0,2,0,20,0,0,4,188,6,
+20,0,22,0,33,0,155,64,10,19,0,23,90,12,21,21,6,16,12,184,255,192,64,13,26,
+39,72,32,12,1,2,144,12,160,12,2,12,184,255,192,179,19,24,72,12,184,255,192,
+64,64,11,14,72,12,12,14,27,91,6,103,35,0,35,48,35,80,35,96,35,128,35,5,224,
+35,1,159,35,1,80,35,1,14,33,95,0,22,13,95,16,19,16,176,0,1,137,0,1,79,0,1,
+15,16,1,7,0,16,0,16,17,0,23,96,12,18,0,63,225,63,57,57,47,47,94,93,93,93,
+93,17,51,16,225,50,16,225,1,47,93,93,93,113,16,246,225,17,57,47,43,43,93,
+95,113,43,51,18,57,47,16,225,50,50,49,48,1,51,50,30,2,21,20,14,2,35,33,17,
+33,53,33,17,51,17,33,21,33,17,51,50,54,53,52,46,2,35,35,2,10,150,152,207,
+126,55,60,126,194,134,254,150,254,196,1,60,186,1,121,254,135,160,174,164,
+46,91,139,93,129,3,78,66,113,152,87,97,158,112,61,4,96,164,1,16,254,240,164,
+252,64,132,136,70,97,60,27,0,2,0,20,0,0,4,109,5,39,0,20,0,33,0,129,64,9,19,
+2,22,71,16,0,12,1,12,184,255,192,64,71,13,26,72,12,0,12,0,14,28,71,6,87,35,
+0,35,16,35,2,112,35,144,35,192,35,224,35,4,14,21,80,2,1,13,80,16,19,16,15,
+2,31,2,2,2,64,12,30,72,15,16,1,15,16,31,16,2,7,2,16,2,16,127,17,1,48,17,1,
+17,22,80,12,21,0,63,225,47,93,93,57,57,47,47,94,93,113,43,93,17,51,16,225,
+50,16,225,1,47,93,113,16,246,225,18,57,57,47,47,43,93,51,225,50,50,49,48,
+1,33,17,33,50,22,21,20,14,2,35,33,17,35,53,51,53,51,21,33,1,17,33,50,62,2,
+53,52,46,2,35,2,227,254,213,1,21,211,205,47,101,159,113,254,57,238,238,182,
+1,43,254,213,1,4,55,94,67,38,33,65,96,64,3,176,254,215,156,155,77,124,88,
+47,3,176,154,221,221,253,164,254,168,17,41,66,48,49,66,40,17,0,1,0,199,255,
+236,6,236,5,203,0,45,0,88,64,47,8,5,91,27,34,7,17,17,7,34,3,30,42,42,47,33,
+29,90,30,100,46,43,0,95,39,4,27,8,28,95,34,5,15,33,1,8,33,33,31,3,30,18,13,
+95,16,22,19,0,63,51,225,63,63,57,47,94,93,51,51,225,50,50,63,225,51,1,16,
+246,225,50,17,51,125,47,18,23,57,24,47,47,47,51,225,50,49,48,1,34,14,2,7,
+33,21,33,30,3,51,50,54,55,21,14,3,35,34,38,38,2,39,33,17,35,17,51,17,33,62,
+3,51,50,22,23,7,38,38,5,109,95,160,120,77,13,2,116,253,134,5,64,117,172,113,
+89,160,78,39,78,86,97,58,158,235,157,82,5,254,176,186,186,1,86,14,99,167,
+233,149,108,196,79,78,63,149,5,39,65,122,175,111,162,130,201,138,72,35,23,
+162,15,23,14,7,100,184,1,3,159,253,86,5,182,253,152,143,235,167,92,44,42,
+156,32,46,0,0,1,0,174,255,236,5,113,4,94,0,41,0,100,64,57,32,29,72,5,79,12,
+1,12,31,12,31,8,39,20,20,43,11,7,71,8,84,42,26,81,21,17,16,32,5,6,80,29,12,
+169,11,185,11,2,15,11,31,11,47,11,3,6,11,11,9,15,8,21,35,81,38,0,22,0,63,
+50,225,63,63,57,47,94,93,93,51,51,225,50,50,63,51,225,1,16,246,225,50,17,
+51,125,47,51,18,57,57,24,47,47,93,51,225,50,49,48,5,34,46,2,39,33,17,35,17,
+51,17,33,62,3,51,50,22,23,7,46,3,35,34,6,7,33,21,33,22,22,51,50,54,55,21,
+6,6,4,84,97,169,129,79,7,254,241,182,182,1,19,12,85,129,165,94,78,149,50,
+54,23,56,60,59,25,140,145,14,1,219,254,35,9,146,138,82,130,54,53,124,20,58,
+123,193,135,254,23,4,74,254,57,128,181,114,52,34,25,154,10,19,15,9,151,166,
+154,184,164,37,25,162,29,30,0,0,2,0,0,0,0,5,47,5,182,0,11,0,24,0,174,64,73,
+8,6,1,216,6,232,6,2,7,7,1,215,7,231,7,2,166,7,1,155,1,1,119,0,167,0,2,13,
+10,9,12,3,4,7,6,19,19,8,167,0,1,0,1,1,5,9,0,8,1,0,8,16,8,32,8,112,8,128,8,
+192,8,6,8,16,8,8,26,144,26,160,26,2,26,184,255,192,64,15,21,24,72,143,26,
+1,64,26,1,15,26,1,8,4,5,184,255,240,64,19,5,11,3,95,19,16,10,14,72,19,12,
+12,6,4,0,9,18,6,3,0,63,63,51,51,18,57,47,57,43,225,50,1,47,56,51,94,93,93,
+93,43,93,17,51,47,56,93,113,51,18,57,47,51,93,17,57,61,47,51,51,18,57,57,
+18,57,57,93,93,93,93,113,93,113,49,48,33,35,17,35,1,35,1,51,1,35,1,35,39,
+33,39,46,3,39,14,3,7,2,236,166,127,254,254,197,2,57,187,2,59,199,254,254,
+122,232,1,35,53,18,28,22,17,7,9,17,21,25,17,2,170,253,86,5,182,250,74,2,170,
+164,143,48,76,67,65,37,37,65,67,73,45,0,0,2,0,10,0,0,4,90,4,74,0,11,0,23,
+0,207,64,56,57,2,89,2,121,2,137,2,4,27,2,43,2,2,181,5,1,150,5,166,5,2,135,
+5,1,9,3,25,3,2,6,8,22,8,2,9,18,25,18,2,6,17,22,17,2,7,18,3,2,17,8,9,182,0,
+1,0,184,255,248,64,27,10,15,72,185,11,1,11,8,10,15,72,0,11,180,12,1,12,12,
+5,5,6,6,10,1,16,2,1,184,255,192,179,18,21,72,1,184,255,192,64,24,7,11,72,
+1,1,25,192,25,224,25,2,175,25,1,80,25,1,15,25,31,25,2,9,10,184,255,240,64,
+15,10,4,8,80,12,11,17,17,1,11,15,10,6,1,21,0,63,51,51,63,18,57,47,18,57,225,
+50,1,47,56,51,93,93,93,93,17,51,47,43,43,51,56,18,57,47,51,18,57,61,47,93,
+51,51,43,93,43,93,18,57,57,18,57,57,94,93,93,93,93,93,93,93,49,48,93,93,1,
+1,35,3,35,17,35,17,35,3,35,1,23,14,3,7,51,46,3,39,2,166,1,180,188,187,96,
+162,96,186,189,1,180,113,5,27,35,37,13,240,14,37,35,27,4,4,74,251,182,1,233,
+254,23,1,233,254,23,4,74,121,25,85,96,94,34,34,95,96,84,25,0,0,2,0,199,0,
+0,7,41,5,182,0,19,0,32,0,191,64,27,155,1,1,119,0,167,0,2,13,6,14,5,21,18,
+17,20,3,27,4,4,5,0,1,15,14,27,5,184,255,240,64,93,128,1,1,203,27,1,132,27,
+1,43,27,123,27,2,15,5,31,5,47,5,127,5,207,5,223,5,255,5,7,8,5,1,27,27,1,5,
+3,17,16,16,0,16,16,16,112,16,176,16,240,16,5,16,16,34,48,34,80,34,192,34,
+208,34,224,34,5,12,8,90,9,100,33,19,6,3,95,13,27,32,9,16,72,27,20,20,14,9,
+4,1,17,18,10,14,3,0,63,51,63,51,51,51,18,57,47,57,43,51,225,50,50,1,16,246,
+225,50,93,17,51,47,93,56,51,23,57,61,47,24,47,47,94,93,93,93,93,93,56,17,
+51,51,17,51,17,51,17,18,57,57,17,57,57,17,18,57,57,93,93,49,48,33,35,17,35,
+1,35,1,33,17,35,17,51,17,33,19,51,1,35,1,35,39,33,39,46,3,39,14,3,7,4,231,
+165,129,254,253,196,1,8,254,127,186,186,1,193,241,187,2,59,199,254,254,121,
+233,1,35,53,19,28,21,17,8,8,17,21,25,17,2,170,253,86,2,170,253,86,5,182,253,
+152,2,104,250,74,2,170,164,143,48,76,67,65,37,37,65,67,73,45,0,0,2,0,174,
+0,0,6,8,4,74,0,19,0,31,0,235,64,49,165,5,1,134,5,150,5,2,119,5,1,6,9,22,9,
+2,25,2,41,2,73,2,105,2,121,2,5,11,2,1,26,3,2,25,8,20,9,18,11,19,10,17,13,
+71,14,198,0,1,0,184,255,248,64,23,10,15,72,201,19,1,19,8,10,15,72,0,19,196,
+20,1,20,20,5,5,6,9,10,184,255,240,64,19,47,10,63,10,175,10,3,10,6,10,6,1,
+14,84,32,2,1,16,1,184,255,192,179,18,21,72,1,184,255,192,64,44,7,11,72,1,
+1,33,208,33,1,191,33,1,96,33,112,33,144,33,3,79,33,1,0,33,1,8,11,4,8,80,18,
+20,19,25,25,2,15,19,15,14,9,6,2,21,0,63,51,51,51,63,51,18,57,47,18,57,51,
+225,50,50,1,94,93,93,93,93,93,17,51,47,43,43,56,51,16,230,17,57,57,47,47,
+93,56,51,17,51,18,57,61,47,93,51,51,43,93,43,93,16,225,50,17,18,57,57,17,
+18,57,57,17,57,57,93,93,93,93,93,93,49,48,1,1,35,3,35,17,35,17,35,3,35,19,
+33,17,35,17,51,17,33,19,23,14,3,7,51,46,3,39,4,84,1,180,188,187,96,162,96,
+186,189,195,254,233,182,182,1,84,181,112,5,27,35,37,13,240,14,37,35,27,4,
+4,74,251,182,1,233,254,23,1,233,254,23,1,233,254,23,4,74,254,57,1,199,121,
+25,84,96,95,34,34,95,96,84,25,0,0,2,0,20,0,0,5,106,5,182,0,35,0,38,0,192,
+64,17,134,34,1,134,26,1,89,18,137,18,2,37,16,9,12,72,38,184,255,240,64,44,
+9,12,72,37,10,11,6,36,36,26,90,27,38,7,0,10,16,10,32,10,3,10,27,7,7,27,10,
+3,0,18,16,17,32,17,2,208,17,1,128,17,144,17,2,17,184,255,192,64,59,7,10,72,
+17,17,40,31,40,1,240,40,1,207,40,223,40,2,64,40,80,40,112,40,3,15,40,63,40,
+2,7,35,0,25,28,97,36,11,79,6,1,15,6,175,6,2,8,6,6,0,10,7,38,95,8,3,27,18,
+0,18,0,63,50,50,63,225,50,50,18,57,47,94,93,113,51,51,225,50,1,47,51,94,93,
+93,93,93,113,17,51,47,43,93,93,113,51,18,23,57,47,47,47,93,17,51,16,225,57,
+61,47,51,51,17,51,43,43,93,93,49,48,93,51,19,62,3,55,1,53,33,21,1,30,3,23,
+19,35,3,46,3,35,35,17,35,17,35,34,14,2,7,3,1,1,33,20,123,24,54,84,124,95,
+254,144,4,73,254,133,97,128,86,55,24,122,190,123,20,38,54,79,61,24,187,24,
+61,79,54,38,20,123,1,235,1,74,253,111,1,197,85,136,98,58,6,1,231,139,139,
+254,25,6,56,98,137,86,254,59,1,193,72,95,57,23,253,72,2,184,23,57,95,72,254,
+63,3,90,1,184,0,0,2,0,10,0,0,4,229,4,74,0,35,0,38,0,199,64,13,118,26,134,
+26,150,26,3,37,16,7,12,72,38,184,255,240,64,24,7,12,72,9,18,1,6,35,1,11,6,
+36,36,26,70,27,37,10,38,7,167,27,1,10,184,255,192,64,16,22,25,72,10,27,7,
+7,27,10,3,0,18,32,17,1,17,184,255,192,179,18,21,72,17,184,255,192,64,63,7,
+11,72,17,17,40,16,40,1,207,40,223,40,2,96,40,144,40,2,31,40,79,40,2,35,0,
+10,7,38,80,8,25,28,82,22,36,38,36,54,36,166,36,4,36,11,15,6,31,6,79,6,95,
+6,4,7,6,6,8,15,27,18,0,21,0,63,50,50,63,57,47,94,93,51,51,93,225,50,16,225,
+50,50,1,47,51,93,93,93,113,17,51,47,43,43,113,51,18,23,57,47,47,47,43,93,
+17,51,17,51,16,225,57,61,47,51,51,93,93,43,43,93,49,48,51,19,62,3,55,1,53,
+33,21,1,30,3,23,19,35,3,46,3,35,35,17,35,17,35,34,14,2,7,3,1,19,33,10,123,
+22,44,66,103,83,254,206,3,207,254,201,83,104,67,44,23,123,186,123,20,36,48,
+68,53,4,166,4,53,70,48,37,20,122,1,180,252,254,10,1,84,61,101,77,49,9,1,100,
+105,105,254,156,8,49,76,103,61,254,172,1,80,54,72,43,17,253,246,2,10,17,43,
+72,54,254,176,2,131,1,45,0,0,2,0,199,0,0,7,137,5,182,0,40,0,43,0,202,64,21,
+134,31,1,89,23,137,23,2,16,11,41,41,31,90,32,42,16,9,12,72,43,184,255,240,
+64,51,9,12,72,42,15,43,12,0,15,16,15,32,15,3,7,15,12,32,32,12,15,3,22,40,
+176,0,192,0,2,15,0,31,0,2,0,0,7,23,0,22,16,22,2,112,22,128,22,192,22,3,22,
+184,255,192,64,52,7,10,72,22,22,45,224,45,1,159,45,191,45,2,64,45,1,47,45,
+1,10,6,90,7,100,44,15,12,43,95,13,30,5,33,97,41,16,15,11,1,8,11,11,8,13,3,
+7,23,32,3,0,18,0,63,23,50,63,51,57,47,94,93,51,51,225,50,50,16,225,50,50,
+1,16,246,225,50,93,93,93,93,17,51,47,43,93,113,51,18,57,47,93,93,51,18,23,
+57,47,47,47,94,93,17,51,17,51,43,43,16,225,57,61,47,51,51,93,93,49,48,33,
+19,54,54,55,33,17,35,17,51,17,33,1,53,33,21,1,30,3,23,19,35,3,46,3,35,35,
+17,35,17,35,34,14,2,7,3,1,1,33,2,51,123,19,41,28,254,123,186,186,2,164,254,
+149,4,74,254,133,97,128,85,55,24,123,190,123,20,38,54,79,61,25,186,25,60,
+79,54,38,20,123,1,235,1,74,253,111,1,197,68,115,46,253,86,5,182,253,152,1,
+221,139,139,254,25,6,56,98,137,86,254,59,1,193,72,95,57,23,253,72,2,184,23,
+57,95,72,254,63,3,90,1,184,0,0,2,0,174,0,0,6,152,4,74,0,40,0,43,0,207,64,
+13,118,31,134,31,150,31,3,42,16,7,12,72,43,184,255,240,64,44,7,12,72,9,23,
+1,16,11,41,41,31,70,32,42,15,43,12,167,32,1,15,32,12,12,32,15,3,22,31,0,47,
+0,2,255,0,1,0,0,7,23,32,22,1,22,184,255,192,179,18,21,72,22,184,255,192,64,
+63,7,11,72,22,22,45,207,45,1,176,45,1,159,45,1,96,45,1,79,45,1,0,45,48,45,
+2,10,6,71,7,84,44,15,12,43,80,13,30,5,33,82,166,41,1,41,16,15,11,31,11,2,
+7,11,11,8,13,15,7,23,32,3,0,21,0,63,23,50,63,51,57,47,94,93,51,51,93,225,
+50,50,16,225,50,50,1,16,246,225,50,93,93,93,93,93,93,17,51,47,43,43,113,51,
+18,57,47,93,113,18,23,57,47,47,47,93,17,51,17,51,16,225,57,61,47,51,51,93,
+43,43,93,49,48,33,19,54,54,55,33,17,35,17,51,17,33,1,53,33,21,1,30,3,23,19,
+35,3,46,3,35,35,17,35,17,35,34,14,2,7,3,1,19,33,1,188,123,16,29,19,254,237,
+182,182,2,11,254,213,3,206,254,201,83,104,67,45,23,123,187,123,20,36,48,68,
+53,4,166,4,53,69,49,36,20,123,1,180,252,254,10,1,84,42,75,32,254,23,4,74,
+254,57,1,94,105,105,254,156,8,49,76,103,61,254,172,1,80,54,72,43,17,253,246,
+2,10,17,43,72,54,254,176,2,131,1,45,0,0,1,0,57,254,70,3,236,6,213,0,118,0,
+159,64,39,33,24,9,14,72,89,98,89,81,77,77,71,81,59,91,103,108,81,103,68,53,
+103,20,81,20,103,81,53,68,5,36,46,91,114,103,120,5,90,36,184,255,192,64,54,
+20,24,72,36,93,82,77,143,86,159,86,175,86,3,86,64,7,11,72,86,86,71,108,52,
+96,79,53,1,15,53,175,53,2,8,53,53,41,67,81,98,3,64,97,71,3,21,10,95,31,251,
+41,96,0,19,0,63,225,63,225,51,63,225,23,51,18,57,47,94,93,113,225,57,17,51,
+47,43,93,51,225,1,47,43,225,16,246,225,18,23,57,61,47,24,47,47,47,47,17,18,
+57,16,225,17,51,51,47,17,51,51,47,49,48,0,43,5,34,14,2,21,20,30,2,51,50,62,
+2,51,50,30,2,23,21,46,3,35,34,14,2,35,34,46,2,53,52,62,2,51,50,62,2,53,52,
+46,2,35,35,53,51,50,62,2,53,52,46,2,35,34,6,7,39,54,54,55,46,3,39,53,51,22,
+22,23,62,3,51,50,22,23,21,38,38,35,34,14,2,7,30,3,21,20,14,2,7,21,30,3,21,
+20,14,2,1,225,71,90,52,20,14,36,61,47,65,97,83,81,50,43,66,49,35,12,8,31,
+54,77,53,49,71,74,92,70,104,136,79,32,49,102,157,108,89,128,81,38,57,103,
+145,88,191,176,92,142,97,50,37,68,95,58,110,169,75,92,59,166,103,24,55,54,
+50,20,121,51,97,54,26,59,67,75,42,31,47,14,11,34,17,22,48,48,46,20,82,126,
+85,43,51,91,125,75,87,138,94,50,67,131,196,20,18,32,41,24,22,36,26,14,4,4,
+4,7,10,15,7,182,7,18,16,12,3,3,2,41,72,96,55,60,98,70,38,38,72,105,68,71,
+101,63,29,151,39,72,100,62,54,83,58,30,67,54,125,48,75,17,30,65,63,58,23,
+27,34,97,56,36,70,56,35,9,5,119,5,7,23,41,56,33,13,63,92,118,69,74,119,88,
+57,12,6,11,57,89,119,72,96,160,116,64,0,1,0,23,254,115,3,82,5,82,0,112,0,
+183,64,113,64,24,9,14,72,104,104,98,108,3,12,3,108,88,70,17,22,108,17,224,
+95,1,95,82,17,51,108,51,17,108,82,95,5,67,77,71,28,87,114,192,114,208,114,
+224,114,3,127,114,1,48,114,1,15,114,1,7,38,70,67,64,12,17,72,67,22,22,81,
+80,137,82,153,82,2,15,82,1,8,82,82,98,72,104,7,82,0,64,16,20,72,0,64,7,12,
+72,0,94,108,0,3,91,80,12,98,16,52,43,80,62,251,72,80,33,22,0,63,225,63,225,
+51,63,51,225,23,51,47,43,43,225,51,17,18,57,47,94,93,93,225,57,61,47,1,24,
+47,43,225,94,93,93,93,93,16,246,225,18,23,57,61,47,24,47,47,47,47,93,17,18,
+57,16,225,17,51,51,47,17,51,51,47,49,48,0,43,1,50,22,23,21,38,38,35,34,14,
+2,7,30,3,21,20,14,2,7,21,30,3,21,20,14,2,35,34,14,2,21,20,30,2,51,50,62,2,
+51,50,22,23,21,46,3,35,34,14,2,35,34,46,2,53,52,62,2,51,50,62,2,53,52,38,
+35,35,53,51,50,62,2,53,52,38,35,34,6,7,39,54,54,55,46,3,39,53,51,22,22,23,
+62,3,2,207,31,47,14,11,33,17,21,46,46,45,19,55,89,63,35,28,51,70,43,44,82,
+63,38,53,108,166,113,75,89,47,15,14,34,58,44,50,99,93,83,33,66,71,13,9,34,
+40,44,19,32,85,100,111,57,88,112,64,24,34,86,144,110,55,100,76,44,133,138,
+129,97,61,100,72,39,115,108,71,129,75,63,57,107,65,23,49,48,44,18,121,51,
+98,54,26,58,67,75,5,82,9,5,119,5,7,21,38,51,31,14,49,69,88,53,50,77,59,41,
+14,11,14,44,66,91,61,68,116,86,49,14,26,38,23,22,35,24,13,3,4,3,22,19,151,
+10,15,10,6,3,3,3,46,71,86,41,47,89,70,42,19,43,69,51,94,91,153,18,39,64,45,
+77,77,38,34,147,28,34,8,28,59,55,50,21,27,34,97,56,36,70,56,35,255,255,0,
+104,0,0,5,186,5,182,2,6,1,117,0,0,255,255,0,164,254,20,5,113,6,18,2,6,1,149,
+0,0,0,3,0,125,255,236,5,113,5,205,0,19,0,30,0,41,0,79,64,50,37,25,91,0,103,
+43,208,43,1,207,43,1,128,43,1,63,43,111,43,2,36,26,91,10,102,42,26,96,79,
+36,1,15,36,175,36,223,36,3,8,36,36,20,31,95,15,4,20,95,5,19,0,63,225,63,225,
+18,57,47,94,93,113,225,1,16,246,225,50,93,93,93,93,16,246,225,50,49,48,1,
+20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,22,18,1,50,62,2,55,33,30,3,
+19,34,14,2,7,33,46,3,5,113,81,160,237,155,163,239,157,76,76,158,239,164,154,
+236,160,81,253,135,106,158,107,57,6,252,154,6,58,107,158,109,105,156,108,
+61,8,3,100,8,59,105,155,2,221,170,254,235,198,108,108,198,1,23,170,170,1,
+21,196,107,107,197,254,235,253,7,71,134,194,122,122,194,134,71,4,154,67,128,
+184,117,117,184,128,67,0,0,3,0,113,255,236,4,45,4,94,0,19,0,26,0,33,0,79,
+64,51,31,23,72,0,87,35,64,35,208,35,224,35,3,15,35,1,30,24,72,10,86,34,24,
+80,239,30,1,169,30,185,30,2,15,30,31,30,47,30,3,6,30,30,20,27,80,15,16,20,
+80,5,22,0,63,225,63,225,18,57,47,94,93,93,93,225,1,16,246,225,50,93,93,16,
+246,225,50,49,48,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,1,50,54,55,33,
+22,22,19,34,6,7,33,38,38,4,45,67,125,178,111,103,174,127,71,67,124,179,111,
+103,174,127,71,254,35,141,136,10,253,190,9,140,140,137,136,14,2,62,13,138,
+2,39,137,213,145,76,76,145,213,137,136,211,145,75,75,145,211,253,212,178,
+178,178,178,3,68,162,164,164,162,0,0,1,0,0,0,0,5,2,5,195,0,28,0,90,64,41,
+7,6,11,13,1,251,13,1,13,13,8,144,25,208,25,2,25,25,30,0,30,1,176,30,1,15,
+30,31,30,47,30,79,30,95,30,127,30,6,7,9,8,184,255,240,64,12,8,0,96,22,4,9,
+8,3,13,6,7,18,0,63,51,51,63,51,63,225,1,47,56,51,94,93,93,113,17,51,47,93,
+18,57,61,47,93,113,51,51,49,48,1,34,14,2,7,1,35,1,51,1,22,22,23,54,54,55,
+19,62,3,51,50,22,23,21,38,38,4,150,36,53,42,36,18,254,215,205,254,25,197,
+1,39,29,46,17,14,42,26,141,31,61,76,103,75,35,68,26,23,53,5,45,37,72,103,
+66,251,233,5,182,252,97,91,175,79,78,188,97,2,0,113,156,98,43,13,8,151,9,
+13,0,0,1,0,0,0,0,4,14,4,82,0,31,0,109,185,0,30,255,248,64,22,10,14,72,31,
+8,10,14,72,31,30,7,32,13,17,72,7,7,0,224,22,1,22,184,255,224,64,26,7,10,72,
+22,22,33,191,33,207,33,239,33,3,80,33,1,15,33,47,33,79,33,3,7,1,0,184,255,
+240,64,12,0,30,7,31,21,26,79,19,15,1,0,15,0,63,50,63,225,63,51,51,1,47,56,
+51,94,93,93,93,17,51,47,43,93,18,57,61,47,43,51,51,43,43,49,48,17,51,19,30,
+3,23,51,62,3,55,19,62,3,51,50,22,23,21,38,38,35,34,6,7,3,35,188,201,11,32,
+31,26,5,6,4,20,24,25,9,86,25,53,67,88,60,26,34,17,11,38,18,47,58,24,224,243,
+4,74,253,162,33,106,110,97,25,25,95,108,103,33,1,64,94,117,66,24,5,5,135,
+3,5,80,88,252,223,255,255,0,0,0,0,5,2,7,115,2,38,2,128,0,0,1,7,3,118,4,184,
+1,82,0,25,182,2,1,29,5,38,2,1,184,255,130,180,49,29,8,25,37,1,43,53,53,0,
+43,53,53,0,255,255,0,0,0,0,4,14,6,33,2,38,2,129,0,0,1,7,3,118,4,80,0,0,0,
+25,182,2,1,32,17,38,2,1,184,255,148,180,52,32,0,22,37,1,43,53,53,0,43,53,
+53,0,0,3,0,125,254,20,9,90,5,205,0,19,0,39,0,74,0,161,64,10,0,91,30,56,74,
+47,47,55,41,40,184,255,240,64,35,40,40,64,0,64,16,64,2,240,64,1,31,64,47,
+64,63,64,3,0,30,1,30,64,30,64,10,54,55,16,208,55,224,55,2,55,184,255,192,
+64,52,7,11,72,55,55,76,15,76,1,15,76,31,76,47,76,79,76,127,76,191,76,223,
+76,239,76,8,7,20,91,10,102,75,56,47,74,74,40,68,80,61,27,54,40,15,35,95,15,
+4,25,95,5,19,0,63,225,63,225,63,51,63,225,17,57,17,51,51,1,16,246,225,94,
+93,113,17,51,47,43,93,56,193,18,57,57,47,47,93,93,93,113,17,51,47,56,193,
+18,57,61,47,51,51,16,225,49,48,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,51,
+50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,37,51,19,30,3,23,51,
+62,3,55,19,51,1,14,3,35,34,38,39,53,22,22,51,50,62,2,55,55,5,31,76,150,221,
+145,152,224,147,71,71,147,225,153,144,221,149,76,252,35,47,97,150,103,103,
+150,96,46,46,96,148,103,104,151,97,47,4,67,189,215,13,29,25,19,4,6,4,23,27,
+29,11,199,188,254,78,29,64,86,116,80,52,76,27,21,64,35,48,70,52,37,15,57,
+2,221,170,254,235,198,108,108,198,1,23,170,170,1,21,196,107,107,197,254,235,
+171,137,219,153,81,81,153,219,137,138,218,151,81,81,151,218,227,253,155,40,
+88,88,83,34,25,86,97,94,33,2,99,251,39,81,129,90,49,11,6,145,5,7,23,44,64,
+41,160,0,255,255,0,113,254,20,8,78,4,94,0,38,0,82,0,0,1,7,0,92,4,111,0,0,
+0,17,177,2,2,184,4,20,180,32,47,10,0,37,1,43,53,0,53,0,0,2,0,125,255,131,
+5,195,6,49,0,31,0,63,0,82,64,51,48,91,0,103,65,180,65,196,65,2,144,65,1,2,
+48,65,128,65,2,32,91,16,102,64,25,24,1,11,24,1,4,8,20,8,2,7,56,53,59,95,27,
+24,21,3,40,37,95,8,5,11,18,0,63,51,51,225,50,63,51,51,225,50,50,94,93,93,
+93,1,16,246,225,93,95,93,93,16,246,225,49,48,1,20,14,2,7,6,6,35,34,38,39,
+46,3,53,52,62,2,55,54,54,51,50,22,23,30,3,5,20,30,2,23,54,54,51,50,22,23,
+62,3,53,52,46,2,39,6,6,35,34,38,39,14,3,5,195,73,137,197,124,14,74,55,59,
+72,13,129,199,135,69,69,135,199,129,13,72,59,55,74,14,123,197,137,74,251,
+127,45,87,127,83,17,67,53,49,69,17,82,128,87,45,45,87,128,82,16,70,49,53,
+67,17,83,127,87,45,2,221,149,252,192,125,23,63,54,54,63,22,125,192,254,150,
+150,251,191,123,23,63,49,51,61,23,125,191,251,150,116,192,146,98,21,48,38,
+40,46,21,98,146,192,116,115,191,146,98,22,50,41,41,48,22,97,145,191,0,0,2,
+0,113,255,145,4,168,4,182,0,31,0,55,0,84,181,44,72,0,87,57,57,184,255,192,
+179,14,20,72,57,184,255,192,64,36,9,12,72,32,72,16,86,56,25,24,1,11,24,1,
+4,8,20,8,2,7,50,47,53,80,27,2,21,15,41,38,35,80,8,5,11,22,0,63,51,51,225,
+50,50,63,51,51,225,50,50,94,93,93,93,1,16,246,225,43,43,16,246,225,49,48,
+1,20,14,2,7,6,6,35,34,38,39,46,3,53,52,62,2,55,54,54,51,50,22,23,30,3,5,20,
+22,23,54,54,51,50,22,23,54,54,53,52,38,39,6,6,35,34,38,39,6,6,4,168,57,107,
+153,95,9,60,56,58,59,8,93,153,110,61,57,108,154,98,8,59,58,55,61,9,91,152,
+109,60,252,133,111,123,11,57,52,50,57,12,121,109,110,120,12,57,50,52,57,11,
+123,111,2,39,118,191,142,90,18,57,46,45,56,18,90,142,192,119,117,191,141,
+90,18,57,41,42,58,18,91,141,188,117,172,205,31,44,32,32,42,31,204,171,169,
+200,32,43,32,32,45,31,200,0,0,3,0,125,255,236,7,53,8,61,0,69,0,91,0,109,0,
+218,64,146,55,20,36,4,20,4,20,36,3,28,65,91,12,103,111,0,111,16,111,2,0,111,
+32,111,80,111,128,111,144,111,160,111,208,111,224,111,8,45,91,28,102,110,
+99,104,71,71,92,104,81,64,82,80,82,96,82,3,82,82,95,0,104,16,104,32,104,128,
+104,144,104,5,7,104,224,77,1,77,191,86,207,86,2,86,82,239,70,1,70,71,71,79,
+82,1,82,82,96,107,192,107,208,107,224,107,4,107,111,95,127,95,175,95,239,
+95,4,16,95,1,95,50,60,95,17,20,127,55,143,55,2,55,64,7,10,72,55,55,23,17,
+19,37,3,3,40,0,95,33,7,4,0,63,51,225,50,51,17,51,63,51,51,47,43,93,51,16,
+225,50,47,93,93,204,93,50,47,113,51,16,205,93,16,221,93,205,93,1,47,94,93,
+51,51,47,93,205,16,205,50,47,17,57,16,246,225,93,113,16,246,225,18,23,57,
+61,47,24,47,47,17,51,49,48,1,34,6,7,39,54,54,51,50,22,22,18,21,20,2,6,6,35,
+34,38,39,6,6,35,34,38,38,2,53,52,18,54,54,51,50,22,23,7,38,38,35,34,14,2,
+21,20,30,2,51,50,62,2,55,30,3,51,50,62,2,53,52,46,2,3,21,35,34,46,2,35,34,
+6,21,21,35,53,52,54,51,50,30,2,51,5,20,6,7,53,54,54,53,52,46,2,53,52,54,51,
+50,22,5,63,60,94,42,76,59,143,81,119,183,125,64,63,129,198,136,103,162,69,
+71,160,103,136,198,129,63,64,125,183,119,81,143,59,76,41,95,60,69,113,80,
+43,46,92,138,92,42,86,78,66,23,23,66,78,86,42,92,139,92,46,44,80,113,3,16,
+86,144,122,100,42,46,58,133,124,109,58,112,119,133,78,254,239,120,121,60,
+56,31,36,31,50,46,59,68,5,37,46,32,156,42,44,99,184,254,248,166,170,254,223,
+210,119,42,44,44,42,119,210,1,33,170,166,1,8,184,99,44,42,156,32,46,70,138,
+207,136,141,229,164,89,19,35,47,28,28,47,35,19,89,164,229,141,136,207,138,
+70,2,166,129,36,42,36,45,53,16,35,107,101,36,42,36,226,77,115,31,76,22,45,
+25,19,18,16,26,28,37,38,70,0,3,0,113,255,236,5,223,7,8,0,67,0,89,0,108,0,
+178,64,107,96,103,69,69,90,103,79,64,80,80,80,2,80,80,93,111,103,159,103,
+2,16,103,1,103,36,21,11,53,63,3,3,11,44,72,63,87,110,30,72,11,86,109,0,75,
+1,75,223,84,1,84,80,15,68,1,68,69,69,111,80,1,80,80,0,106,1,224,106,240,106,
+2,106,15,93,127,93,2,7,93,47,27,81,52,22,22,58,16,16,33,41,81,0,3,36,64,16,
+21,72,36,64,7,12,72,36,36,6,0,22,0,63,50,50,47,43,43,51,16,225,50,63,51,51,
+17,51,225,50,47,94,93,204,93,113,50,47,113,51,16,205,113,16,221,93,205,113,
+1,16,246,225,16,246,225,18,57,61,47,18,57,18,57,51,24,47,93,93,51,51,47,93,
+205,16,205,50,47,17,57,49,48,5,34,38,39,6,6,35,34,46,2,53,52,62,2,51,50,30,
+2,23,7,46,3,35,34,6,21,20,22,51,50,54,55,30,3,51,50,54,53,52,38,35,34,14,
+2,7,39,62,3,51,50,30,2,21,20,14,2,19,21,35,34,46,2,35,34,6,21,21,35,53,52,
+54,51,50,30,2,51,5,20,6,7,53,54,53,52,46,4,53,52,54,51,50,22,4,16,81,109,
+43,43,106,80,95,169,127,74,63,109,147,84,31,64,60,52,20,63,17,41,43,43,18,
+112,105,141,136,73,115,41,22,49,57,66,41,133,140,105,112,18,43,43,41,17,64,
+20,53,60,63,32,84,147,109,63,74,126,169,58,16,86,144,122,100,42,46,58,134,
+124,110,57,112,120,133,78,254,239,120,121,116,15,21,26,21,15,50,46,59,68,
+20,35,32,32,35,63,137,213,150,157,219,137,62,9,16,22,12,154,10,19,15,9,202,
+211,211,195,52,32,16,30,24,14,195,211,211,202,9,15,19,10,154,12,22,16,9,62,
+137,219,157,150,213,137,63,6,170,130,36,43,36,46,52,17,35,108,101,36,42,36,
+226,77,115,31,76,41,51,13,15,12,10,15,23,18,38,38,70,0,0,2,0,125,255,236,
+7,94,7,4,0,13,0,83,0,155,64,98,35,18,71,90,51,197,68,1,150,68,166,68,2,137,
+68,1,68,68,43,79,91,26,0,13,0,13,43,26,103,85,0,85,16,85,2,0,85,32,85,80,
+85,112,85,208,85,224,85,6,7,60,91,43,102,84,69,69,65,14,55,95,48,17,52,9,
+4,4,0,128,10,6,63,2,127,2,207,2,223,2,239,2,5,2,52,21,48,4,74,35,32,9,14,
+72,35,65,95,31,38,19,0,63,51,225,50,43,50,63,51,51,47,93,51,51,26,205,57,
+47,51,17,51,16,225,50,18,57,47,1,16,246,225,94,93,113,16,230,17,57,57,47,
+47,16,225,17,57,47,93,93,93,51,225,50,57,49,48,1,21,7,35,39,35,7,35,39,35,
+7,35,39,53,1,34,6,7,39,54,54,51,50,22,22,18,21,20,2,6,6,35,34,38,39,35,6,
+6,35,34,38,38,2,53,52,18,54,54,51,50,22,23,7,38,38,35,34,14,2,21,20,30,2,
+51,50,54,55,17,51,17,22,22,51,50,62,2,53,52,46,2,5,139,82,34,50,184,49,35,
+49,184,50,34,80,3,28,60,94,42,76,59,143,81,119,183,125,64,63,129,198,136,
+111,170,73,2,75,168,110,136,198,129,63,64,125,183,119,81,143,59,76,41,95,
+60,69,113,80,43,46,92,138,92,57,118,46,187,46,118,59,92,139,92,46,44,80,113,
+7,4,27,172,103,103,103,103,172,27,254,33,46,32,156,42,44,99,184,254,248,166,
+170,254,223,210,119,50,48,48,50,119,210,1,33,170,166,1,8,184,99,44,42,156,
+32,46,70,138,207,136,141,229,164,89,36,38,1,189,254,67,38,36,89,164,229,141,
+136,207,138,70,0,0,2,0,0,0,0,5,244,5,164,0,13,0,58,1,35,64,13,0,13,0,13,42,
+15,185,48,1,130,48,1,47,184,255,240,179,10,16,72,58,184,255,240,179,19,27,
+72,58,184,255,240,64,25,10,15,72,169,14,1,14,16,19,27,72,14,16,10,15,72,48,
+27,28,52,102,29,1,29,28,184,255,240,64,83,15,28,31,28,63,28,3,79,28,111,28,
+127,28,159,28,191,28,5,28,28,52,48,47,35,144,35,1,116,35,1,107,35,1,36,35,
+52,35,2,58,14,20,144,52,1,36,20,52,20,68,20,116,20,148,20,5,35,52,20,20,52,
+35,3,15,41,71,0,42,16,42,2,7,42,42,60,16,60,32,60,48,60,3,16,15,184,255,240,
+64,53,15,9,4,4,0,128,10,6,15,2,127,2,143,2,159,2,4,2,64,20,23,72,2,52,64,
+21,29,72,52,32,12,20,72,27,52,30,3,14,41,28,15,15,35,20,38,20,54,20,2,20,
+48,14,21,0,63,51,51,93,17,51,63,51,51,18,23,57,43,43,47,43,93,51,51,26,205,
+57,47,51,1,47,56,51,93,17,51,47,94,93,225,18,23,57,61,47,47,47,93,93,17,51,
+51,93,93,93,93,17,51,51,17,51,24,47,93,113,56,51,93,135,192,192,1,43,43,93,
+43,43,43,93,93,17,18,57,57,47,47,49,48,1,21,7,35,39,35,7,35,39,35,7,35,39,
+53,3,1,51,19,22,22,23,51,62,3,55,19,3,51,19,30,3,23,51,62,3,53,51,20,2,2,
+6,7,35,3,38,38,53,14,3,7,3,4,186,82,34,50,184,49,35,49,184,49,35,80,4,254,
+137,188,224,28,38,9,7,7,21,26,29,15,119,162,188,201,12,31,30,24,5,7,90,114,
+65,25,183,37,92,154,117,192,119,12,13,1,6,9,10,4,152,5,164,27,172,103,103,
+103,103,172,27,250,92,4,74,253,86,87,157,51,22,58,65,69,32,1,12,1,207,253,
+176,33,99,103,92,25,103,208,226,255,152,163,254,223,254,245,252,127,1,84,
+32,53,3,1,19,27,29,10,254,170,0,0,1,0,125,254,20,4,152,5,203,0,35,0,84,64,
+23,17,90,15,16,1,7,16,64,15,18,72,16,16,24,186,32,1,96,32,112,32,2,32,184,
+255,192,64,26,6,10,72,32,32,37,175,37,1,5,91,24,102,36,33,0,95,29,4,15,10,
+95,19,19,16,27,0,63,63,225,51,63,225,51,1,16,246,225,93,17,51,47,43,93,93,
+18,57,47,43,94,93,225,49,48,1,34,14,2,21,20,30,2,51,50,62,2,55,17,35,17,35,
+34,38,38,2,53,52,18,54,54,51,50,22,23,7,38,38,3,25,107,174,123,67,59,118,
+176,118,29,45,40,37,21,187,16,164,240,157,76,87,169,250,162,108,196,79,78,
+63,148,5,39,81,152,218,137,141,219,150,78,4,9,13,9,253,98,1,216,108,198,1,
+21,170,166,1,20,198,110,44,42,156,32,46,0,0,1,0,113,254,20,3,111,4,94,0,31,
+0,62,64,37,29,71,28,64,14,17,72,28,28,4,12,33,95,33,127,33,2,16,33,1,21,72,
+4,86,32,27,24,81,31,22,28,27,18,81,13,9,16,0,63,51,225,63,63,225,51,1,16,
+246,225,93,93,16,206,17,57,47,43,225,49,48,4,46,2,53,52,62,2,51,50,22,23,
+7,46,3,35,34,6,21,20,22,51,50,54,55,17,35,17,35,1,237,176,130,74,76,133,178,
+102,78,149,50,54,23,56,60,59,25,157,144,145,148,62,104,35,183,18,20,63,137,
+213,150,157,219,137,62,34,25,154,10,19,15,9,202,211,211,195,27,20,253,90,
+1,216,0,0,1,0,104,255,250,4,121,5,10,0,19,1,37,64,103,13,17,29,17,2,13,1,
+29,1,2,2,11,18,11,2,2,7,18,7,2,7,16,17,12,19,18,11,0,1,8,3,2,7,4,15,4,13,
+17,12,10,18,11,9,1,8,6,2,7,5,14,5,13,16,17,12,17,10,19,18,11,18,9,0,1,8,1,
+6,3,2,7,2,4,5,12,11,2,1,14,15,79,1,1,64,11,1,5,11,1,15,15,1,11,5,4,18,96,
+17,112,17,240,17,3,17,184,255,192,64,77,7,10,72,17,8,7,17,21,32,21,48,21,
+2,3,6,0,9,4,7,1,1,2,19,10,16,13,4,11,17,17,18,4,7,1,7,7,8,11,11,1,11,11,12,
+176,12,192,12,2,15,18,31,18,2,0,8,16,8,2,2,18,8,12,12,8,18,2,4,4,15,14,64,
+7,13,72,14,5,4,0,47,51,47,43,51,18,23,57,47,47,47,47,93,93,93,17,51,47,113,
+17,51,47,113,17,51,47,18,23,57,17,51,47,18,23,57,1,93,17,51,47,50,47,43,93,
+51,23,57,47,47,47,47,93,93,17,51,17,51,17,51,17,51,16,135,192,192,16,135,
+192,192,16,135,192,192,16,135,192,192,16,135,8,192,8,192,8,192,8,192,16,135,
+8,192,8,192,8,192,8,192,49,48,0,94,93,93,93,93,1,5,7,37,3,39,19,37,55,5,19,
+37,55,5,19,23,3,5,7,37,2,76,1,28,71,254,227,180,129,180,254,229,70,1,31,198,
+254,228,71,1,29,182,127,182,1,31,74,254,229,1,176,166,123,164,254,199,74,
+1,59,164,123,164,1,90,164,125,164,1,57,73,254,196,164,123,164,0,1,0,201,4,
+143,3,176,5,184,0,21,0,66,181,15,32,7,10,72,3,184,255,224,64,30,7,10,72,12,
+18,18,23,0,0,6,16,6,32,6,144,6,160,6,5,7,6,6,22,15,15,11,0,3,3,0,0,47,50,
+47,16,205,50,47,17,1,51,47,94,93,51,17,51,47,51,0,43,43,49,48,1,6,6,35,34,
+38,53,52,62,2,51,33,54,54,51,50,22,21,20,6,35,1,139,6,44,48,56,40,9,23,37,
+29,1,193,5,45,48,56,42,43,57,4,238,44,51,51,56,28,37,22,9,45,49,50,54,57,
+41,0,0,1,0,244,4,229,3,223,5,217,0,21,0,66,64,17,128,8,144,8,2,8,8,23,0,20,
+16,20,32,20,3,7,20,184,255,192,64,18,13,16,72,20,20,22,21,20,20,9,14,64,191,
+5,1,5,128,9,0,47,26,221,93,26,205,17,51,47,205,17,1,51,47,43,94,93,17,51,
+47,93,49,48,1,50,62,2,51,50,22,21,21,35,53,52,38,35,34,14,2,35,35,53,1,2,
+78,133,119,112,58,109,124,133,58,46,42,101,121,145,85,16,5,102,36,43,36,101,
+108,35,17,52,46,36,43,36,129,0,0,1,1,225,4,215,2,211,6,53,0,17,0,32,64,18,
+11,14,63,6,79,6,2,6,0,63,3,79,3,95,3,3,3,15,0,47,204,93,1,47,205,93,50,57,
+49,48,1,52,54,51,50,22,21,20,14,2,21,20,22,23,21,38,38,1,225,68,59,47,50,
+31,37,31,57,60,122,120,5,182,57,70,38,38,27,26,17,17,19,25,46,21,76,31,115,
+0,0,1,1,225,4,215,2,211,6,53,0,19,0,32,64,18,7,63,0,79,0,2,0,3,14,63,17,79,
+17,95,17,3,17,3,0,47,204,93,1,47,51,205,93,57,49,48,1,20,6,7,53,54,54,53,
+52,46,4,53,52,54,51,50,22,2,211,120,122,60,57,15,21,26,21,15,50,46,59,68,
+5,182,77,115,31,76,21,46,25,13,15,12,10,15,23,18,38,38,70,0,0,8,0,41,254,
+193,7,193,5,145,0,19,0,39,0,59,0,79,0,99,0,119,0,139,0,159,0,0,1,46,3,35,
+34,14,2,7,35,54,54,51,50,30,2,23,3,46,3,35,34,14,2,7,35,54,54,51,50,30,2,
+23,1,46,3,35,34,14,2,7,35,54,54,51,50,30,2,23,33,46,3,35,34,14,2,7,35,54,
+54,51,50,30,2,23,1,46,3,35,34,14,2,7,35,54,54,51,50,30,2,23,33,46,3,35,34,
+14,2,7,35,54,54,51,50,30,2,23,1,46,3,35,34,14,2,7,35,54,54,51,50,30,2,23,
+33,46,3,35,34,14,2,7,35,54,54,51,50,30,2,23,4,111,3,24,36,46,25,30,47,33,
+20,3,75,5,100,103,49,77,54,30,3,79,3,24,36,46,25,30,47,33,20,3,75,5,100,103,
+49,77,54,30,3,1,244,3,23,36,46,25,31,47,33,19,3,76,5,101,103,49,77,54,30,
+3,251,47,3,23,36,46,25,31,47,33,19,3,76,5,101,103,49,77,54,30,3,4,49,3,23,
+36,46,25,31,47,33,19,3,76,5,101,103,49,77,54,30,3,251,47,3,23,36,46,25,31,
+47,33,19,3,76,5,101,103,49,77,54,30,3,4,240,3,24,36,45,25,31,47,33,20,3,75,
+5,100,104,49,76,54,31,3,249,190,3,23,36,46,25,31,47,33,19,3,76,5,101,103,
+49,77,54,30,3,4,207,28,35,19,6,5,18,35,30,90,104,28,51,72,43,249,242,28,35,
+19,6,5,18,35,30,89,105,29,51,71,43,1,22,28,35,19,6,5,18,35,30,90,105,29,51,
+72,43,28,35,19,6,5,18,35,30,90,105,29,51,72,43,3,219,28,35,19,6,5,18,35,30,
+90,105,29,51,72,43,28,35,19,6,5,18,35,30,90,105,29,51,72,43,254,25,28,35,
+19,6,5,18,35,30,90,104,29,51,71,43,28,35,19,6,5,18,35,30,90,104,29,51,71,
+43,0,0,8,0,41,254,127,7,125,5,211,0,12,0,25,0,38,0,51,0,64,0,77,0,90,0,103,
+0,0,5,23,14,3,7,35,62,3,55,3,39,62,3,55,51,14,3,7,1,55,30,3,23,21,46,3,39,
+5,7,46,3,39,53,30,3,23,1,55,62,3,55,23,14,3,7,1,7,14,3,7,39,62,3,55,3,39,
+46,3,39,55,30,3,23,1,23,30,3,23,7,46,3,39,4,55,11,10,28,32,35,18,97,10,21,
+18,16,5,59,11,10,28,32,35,18,97,10,21,18,16,5,2,35,14,38,85,87,87,39,42,93,
+91,87,37,251,104,14,39,85,87,86,39,42,93,91,87,37,3,166,2,34,80,84,86,40,
+69,37,79,78,73,30,252,234,2,35,79,84,86,40,69,37,79,78,73,30,43,17,20,41,
+39,36,15,67,23,51,52,50,23,3,106,17,20,40,39,37,15,67,23,52,52,50,22,35,14,
+39,85,87,86,39,42,93,91,87,37,4,152,14,38,85,87,87,39,42,93,91,87,37,254,
+22,11,10,28,32,35,18,97,10,21,18,16,5,59,11,10,28,32,35,18,97,10,21,18,16,
+5,1,170,16,20,41,39,37,15,68,23,51,52,50,22,252,149,16,20,41,39,37,15,68,
+23,51,52,50,22,2,222,2,34,80,84,85,40,70,37,79,78,73,30,252,233,2,35,79,84,
+85,40,70,37,79,78,73,30,0,2,0,201,254,127,5,211,7,104,0,27,0,49,0,179,64,
+72,28,28,48,38,1,208,38,1,175,38,207,38,2,32,38,48,38,128,38,3,38,38,23,10,
+25,26,26,24,27,21,7,0,90,23,101,51,208,51,1,175,51,1,32,51,48,51,2,19,8,12,
+90,9,100,50,38,159,28,1,28,64,6,9,72,28,28,44,142,33,5,26,251,19,184,255,
+232,179,20,24,72,19,184,255,224,64,38,10,19,72,6,19,22,19,38,19,3,9,19,23,
+95,0,18,6,24,20,24,72,6,32,10,19,72,9,6,25,6,41,6,3,7,6,22,10,3,0,63,51,51,
+94,93,43,43,63,225,51,51,93,43,43,63,63,225,51,47,43,93,51,1,16,246,225,50,
+50,93,93,93,16,244,225,50,50,51,51,57,47,51,17,18,57,47,93,93,93,113,51,47,
+49,48,33,17,52,54,55,54,55,35,1,35,17,51,17,20,14,2,7,6,7,51,1,51,17,51,3,
+35,19,3,14,3,35,34,46,2,39,51,30,3,51,50,62,2,55,4,100,5,4,4,6,8,253,49,215,
+174,1,3,3,1,4,3,7,2,204,213,195,143,218,166,157,6,49,93,141,100,103,140,88,
+42,4,170,4,28,50,76,53,43,73,55,34,6,3,25,56,143,65,76,77,251,70,5,182,252,
+224,26,62,67,68,31,74,76,4,180,250,240,253,217,1,129,7,104,77,119,80,41,39,
+79,119,80,57,72,41,16,18,44,71,53,0,0,2,0,174,254,131,4,242,6,23,0,15,0,37,
+0,150,64,58,16,16,4,26,52,26,132,26,3,7,26,26,11,5,13,14,14,15,12,9,16,9,
+24,72,9,2,0,70,11,85,39,164,39,196,39,212,39,244,39,4,128,39,1,2,0,39,16,
+39,32,39,80,39,96,39,112,39,6,3,184,255,240,64,37,9,24,72,3,8,7,70,4,84,38,
+26,127,16,1,16,64,6,9,72,16,16,32,142,21,17,14,251,9,2,5,15,11,96,8,4,0,21,
+0,63,50,50,225,63,51,51,63,63,225,51,47,43,93,51,1,16,246,225,50,50,43,93,
+95,93,93,16,244,225,50,50,43,51,51,57,47,51,17,18,57,47,94,93,51,47,49,48,
+33,17,19,1,35,17,51,17,7,1,51,17,51,3,35,19,3,14,3,35,34,46,2,39,51,30,3,
+51,50,62,2,55,3,143,11,253,254,234,172,12,2,4,233,183,123,182,122,71,6,49,
+93,141,100,103,140,88,42,4,170,4,28,50,76,53,43,73,55,34,6,2,135,1,15,252,
+106,4,74,253,100,252,3,152,252,80,253,233,1,125,6,23,78,118,81,41,39,80,119,
+80,57,73,41,16,18,44,72,53,0,2,0,47,0,0,4,51,5,182,0,22,0,33,0,82,64,44,19,
+0,23,90,12,21,21,6,16,12,12,14,27,91,6,103,35,14,33,95,0,22,13,95,16,19,16,
+137,0,1,15,16,1,7,0,16,0,16,17,3,23,96,12,18,0,63,225,63,57,57,47,47,94,93,
+93,17,51,16,225,50,16,225,1,47,16,246,225,17,57,47,51,18,57,47,16,225,50,
+50,49,48,1,51,50,30,2,21,20,14,2,35,33,17,35,53,51,53,51,21,33,21,33,17,51,
+50,54,53,52,46,2,35,35,1,129,150,152,207,126,55,60,126,194,134,254,150,152,
+152,186,1,59,254,197,160,174,164,46,91,139,93,129,3,78,66,113,152,87,97,158,
+112,61,4,96,164,178,178,164,252,64,132,136,70,97,60,27,0,0,2,0,18,0,0,4,25,
+6,20,0,20,0,33,0,97,64,59,1,1,14,28,71,8,87,35,111,35,191,35,223,35,255,35,
+4,3,0,22,71,18,17,14,84,34,21,80,4,3,15,80,18,0,18,4,64,7,36,72,15,18,1,15,
+18,31,18,2,7,4,18,4,18,19,0,22,80,14,21,0,63,225,63,57,57,47,47,94,93,113,
+43,17,51,16,225,50,16,225,1,16,246,196,51,225,50,50,93,16,246,225,18,57,47,
+49,48,1,33,21,33,17,33,50,22,21,20,14,2,35,33,17,35,53,51,53,51,17,17,33,
+50,62,2,53,52,46,2,35,1,100,1,23,254,233,1,21,211,205,47,101,159,113,254,
+57,156,156,182,1,4,55,94,67,38,33,65,96,64,5,33,137,253,239,156,155,77,124,
+88,47,4,152,137,243,251,218,254,168,17,41,66,48,49,66,40,17,0,2,0,199,0,0,
+4,51,5,182,0,19,0,34,0,136,64,79,27,5,26,6,26,24,8,25,7,7,6,25,6,25,6,12,
+30,91,40,0,56,0,72,0,3,0,103,36,207,36,1,64,36,1,15,36,1,6,20,12,90,13,100,
+35,25,24,27,175,26,1,26,26,20,34,6,176,7,1,7,7,12,5,8,20,96,48,11,64,11,2,
+11,11,12,34,96,14,3,12,18,0,63,63,225,17,57,47,93,225,57,57,18,57,47,93,51,
+17,18,57,47,93,57,57,51,1,16,246,225,50,94,93,93,93,16,246,93,225,18,57,57,
+47,47,17,51,17,18,57,57,50,17,18,57,57,49,48,1,20,14,2,7,23,7,39,6,35,35,
+17,35,17,33,50,30,2,1,51,50,54,55,39,55,23,54,54,53,52,38,35,35,4,51,22,47,
+75,54,110,106,129,93,124,150,186,1,106,134,194,126,60,253,78,129,38,68,31,
+92,109,112,51,52,164,174,160,4,10,58,111,100,86,32,155,78,182,27,253,199,
+5,182,57,109,160,254,103,5,5,133,76,160,36,115,87,142,137,0,2,0,174,254,20,
+4,63,4,94,0,35,0,57,0,114,64,64,52,53,50,51,51,42,32,30,31,31,55,72,33,42,
+27,87,59,48,59,1,42,16,12,71,13,84,58,51,53,50,47,15,52,31,52,111,52,207,
+52,4,7,52,52,47,36,80,16,22,16,14,15,31,32,32,0,12,27,33,30,47,80,6,0,22,
+0,63,50,225,57,57,63,18,57,47,51,63,63,51,225,17,57,47,94,93,18,57,57,51,
+1,16,246,225,50,50,93,16,246,17,57,225,57,47,57,51,17,57,47,57,57,51,49,48,
+5,34,46,2,39,35,22,23,22,22,21,17,35,17,51,23,51,62,3,51,50,30,2,21,20,6,
+7,23,7,39,6,6,3,34,14,2,7,21,20,30,2,51,50,54,55,39,55,23,54,53,52,38,2,158,
+59,96,77,60,22,12,3,3,2,4,182,148,26,8,22,59,77,96,60,94,153,110,60,90,82,
+109,106,117,31,65,70,76,105,65,31,2,27,65,108,81,17,33,15,106,109,110,84,
+127,20,25,44,58,32,34,31,26,55,16,254,43,6,54,148,34,62,45,27,72,143,212,
+140,175,242,68,154,78,166,9,11,3,219,46,94,141,94,41,101,157,107,55,3,5,152,
+76,158,106,238,208,206,0,0,1,0,47,0,0,3,190,5,182,0,13,0,137,64,21,31,5,47,
+5,2,5,5,8,15,0,31,0,2,144,0,160,0,224,0,3,0,184,255,192,64,30,7,10,72,0,0,
+15,31,15,63,15,159,15,191,15,4,3,7,90,12,0,10,1,6,10,128,8,192,8,2,8,184,
+255,192,64,38,6,10,72,8,6,9,95,3,15,12,47,12,63,12,79,12,4,15,12,63,12,175,
+12,223,12,255,12,5,8,12,12,7,2,95,13,3,7,18,0,63,63,225,18,57,47,94,93,113,
+51,225,50,1,47,43,93,198,94,93,51,225,50,93,17,51,47,43,93,113,18,57,47,93,
+49,48,1,21,33,17,33,21,33,17,35,17,35,53,51,17,3,190,253,195,1,80,254,176,
+186,152,152,5,182,166,254,21,162,253,125,2,131,162,2,145,0,0,1,0,18,0,0,3,
+10,4,74,0,13,0,110,64,29,11,11,0,32,6,48,6,2,6,6,15,112,15,160,15,192,15,
+3,9,13,71,4,223,2,239,2,2,2,0,184,255,192,179,18,21,72,0,184,255,192,64,33,
+6,11,72,0,12,1,79,9,79,4,95,4,2,4,64,23,28,72,11,4,27,4,2,7,4,4,0,8,80,5,
+15,0,21,0,63,63,225,18,57,47,94,93,43,93,51,225,50,1,47,43,43,198,93,51,225,
+50,93,17,51,47,93,18,57,47,49,48,51,17,35,53,51,17,33,21,33,17,33,21,33,17,
+174,156,156,2,92,254,90,1,23,254,233,1,225,137,1,224,154,254,186,137,254,
+31,0,1,0,199,254,0,4,152,5,182,0,38,0,102,64,65,9,21,1,7,7,7,5,34,91,18,40,
+192,40,1,127,40,143,40,2,16,40,64,40,2,28,28,10,4,90,5,100,39,29,32,95,23,
+28,0,96,15,13,47,13,63,13,3,15,13,63,13,223,13,255,13,4,8,13,13,5,9,95,6,
+3,5,18,0,63,63,225,18,57,47,94,93,113,225,63,225,51,1,16,246,241,50,192,47,
+93,93,93,16,222,225,18,57,47,49,48,0,94,93,1,34,6,7,17,35,17,33,21,33,17,
+54,54,51,50,30,2,21,20,14,2,35,34,46,2,39,53,22,22,51,32,17,52,46,2,1,252,
+37,60,26,186,2,247,253,195,29,71,45,154,240,165,87,82,146,201,118,49,78,68,
+61,31,63,127,72,1,119,67,123,174,2,131,5,5,253,135,5,182,166,254,11,5,3,92,
+171,242,151,170,248,162,79,6,12,19,12,162,23,24,1,239,121,185,126,64,0,0,
+1,0,174,254,10,3,197,4,74,0,35,0,92,64,57,9,34,25,34,41,34,3,20,20,18,10,
+72,31,37,15,37,31,37,2,95,37,127,37,255,37,3,3,3,23,17,71,18,84,36,4,0,13,
+81,11,26,27,26,2,7,26,26,18,22,80,19,15,18,21,7,81,0,27,0,63,225,63,63,225,
+18,57,47,94,93,233,17,51,1,16,246,225,50,57,47,93,113,16,222,225,18,57,47,
+49,48,0,93,1,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,17,35,17,33,21,
+33,17,54,54,51,50,30,2,21,20,14,2,2,41,75,106,46,43,106,66,118,117,144,157,
+26,62,31,182,2,92,254,90,29,59,31,102,179,133,76,64,111,150,254,10,31,29,
+161,24,37,195,210,212,202,10,8,254,53,4,74,154,254,195,5,5,62,138,219,157,
+150,213,136,64,0,1,0,4,254,127,6,203,5,182,0,21,0,226,64,87,17,64,20,24,72,
+17,32,9,19,72,10,17,26,17,2,0,64,20,24,72,0,32,9,19,72,10,0,26,0,2,7,16,13,
+13,2,90,7,10,10,168,3,184,3,2,153,3,1,141,3,1,87,3,103,3,119,3,3,3,3,3,18,
+6,0,14,15,16,15,64,12,24,72,15,17,15,21,90,4,18,1,116,18,132,18,196,18,3,
+18,184,255,192,64,39,7,10,72,18,18,23,4,23,1,240,23,1,228,23,1,160,23,1,2,
+32,23,48,23,96,23,112,23,144,23,5,15,23,1,8,9,8,5,8,6,184,255,240,64,19,6,
+6,22,19,251,13,10,10,0,15,8,11,3,17,95,5,3,0,18,0,63,50,50,225,63,51,51,18,
+57,17,51,63,17,1,51,47,56,51,51,17,51,94,93,93,95,93,93,93,113,17,51,47,43,
+93,113,225,51,51,47,43,56,51,50,17,18,57,47,95,93,93,93,93,51,17,51,225,50,
+17,51,94,93,43,43,93,43,43,49,48,33,1,17,35,17,1,35,1,1,51,1,17,51,17,1,51,
+1,1,51,17,35,17,5,174,253,238,179,253,238,211,2,33,253,237,205,2,10,179,2,
+10,205,253,237,1,168,195,176,2,229,253,27,2,229,253,27,2,242,2,196,253,60,
+2,196,253,60,2,196,253,60,253,180,253,217,1,129,0,0,1,0,4,254,131,6,4,4,74,
+0,21,1,17,64,108,39,16,55,16,2,41,14,57,14,2,38,9,54,9,2,39,10,55,10,2,39,
+4,55,4,2,39,4,55,4,2,39,1,55,1,2,17,64,20,24,72,17,32,9,19,72,10,17,26,17,
+2,0,64,20,24,72,0,32,9,19,72,10,0,26,0,2,16,13,13,2,70,7,10,10,205,3,1,185,
+3,1,169,3,1,150,3,1,135,3,1,3,3,3,18,6,0,14,15,16,15,64,10,24,72,15,17,15,
+21,70,18,184,255,192,179,18,21,72,18,184,255,192,64,23,7,11,72,18,18,23,16,
+23,1,0,23,1,228,23,244,23,2,180,23,196,23,2,23,184,255,192,64,19,13,17,72,
+48,23,1,2,32,23,1,15,23,1,7,9,8,5,8,6,184,255,240,64,19,6,6,22,19,251,13,
+10,10,0,15,8,11,15,17,96,5,3,0,21,0,63,50,50,225,63,51,51,18,57,17,51,63,
+17,1,51,47,56,51,51,17,51,94,93,93,95,93,43,93,93,113,113,17,51,47,43,43,
+225,51,51,47,43,56,51,50,17,18,57,47,95,93,93,93,93,93,51,17,51,225,50,17,
+51,93,43,43,93,43,43,49,48,0,93,93,1,93,93,93,93,93,33,1,17,35,17,1,35,1,
+1,51,1,17,51,17,1,51,1,1,51,17,35,17,4,240,254,67,164,254,68,207,1,207,254,
+88,197,1,159,164,1,160,197,254,88,1,79,197,174,2,45,253,211,2,45,253,211,
+2,53,2,21,253,235,2,21,253,235,2,21,253,235,254,101,253,233,1,125,255,255,
+0,72,254,66,3,236,5,203,2,38,1,177,0,0,1,7,3,127,1,72,0,0,0,17,177,1,1,184,
+255,255,180,72,66,19,11,37,1,43,53,0,53,0,255,255,0,68,254,66,3,82,4,94,2,
+38,1,209,0,0,1,7,3,127,0,242,0,0,0,17,177,1,1,184,255,248,180,72,66,41,33,
+37,1,43,53,0,53,0,0,1,0,199,254,127,4,236,5,182,0,16,0,166,64,89,5,64,20,
+24,72,189,5,205,5,221,5,3,5,32,9,16,72,26,5,42,5,2,0,64,20,24,72,189,0,205,
+0,221,0,3,0,32,9,16,72,26,0,42,0,2,6,16,16,8,14,15,16,127,15,159,15,2,0,15,
+48,15,64,15,3,6,15,15,5,4,90,0,0,1,16,1,2,7,1,1,18,176,18,1,12,8,90,9,100,
+17,12,184,255,240,64,22,11,16,72,6,16,11,16,72,12,6,9,15,10,3,0,95,5,5,9,
+18,2,251,0,63,63,51,47,225,63,51,18,57,57,43,43,1,16,246,225,50,93,17,51,
+47,94,93,51,225,50,51,47,94,93,93,56,51,18,57,17,51,93,43,93,43,93,43,93,
+43,49,48,37,51,17,35,17,35,1,7,17,35,17,51,17,55,1,51,1,4,53,183,177,108,
+254,61,139,186,186,121,1,196,209,253,248,166,253,217,1,129,2,186,114,253,
+184,5,182,253,37,168,2,51,253,131,0,1,0,174,254,131,4,43,4,74,0,14,0,153,
+64,106,8,64,20,24,72,189,8,205,8,221,8,3,8,32,9,16,72,26,8,42,8,2,3,64,20,
+24,72,189,3,205,3,221,3,3,3,32,9,16,72,26,3,42,3,2,8,7,70,0,1,118,1,134,1,
+2,109,1,1,85,1,1,43,1,59,1,75,1,3,20,1,1,11,1,1,6,3,1,0,4,16,4,2,4,4,16,14,
+2,10,71,11,84,15,9,2,14,14,0,11,3,80,8,21,5,251,12,0,15,0,63,50,63,63,225,
+51,18,57,17,51,51,1,16,246,225,50,50,17,51,47,93,51,51,94,93,93,93,93,93,
+93,17,51,225,50,93,43,93,43,93,43,93,43,49,48,1,51,1,1,51,17,35,17,35,1,17,
+35,17,51,17,2,250,196,254,97,1,75,193,174,102,254,75,180,180,4,74,253,241,
+254,95,253,233,1,125,2,45,253,211,4,74,253,235,0,1,0,199,0,0,4,162,5,182,
+0,18,0,151,185,0,15,255,224,64,93,18,21,72,80,15,96,15,2,34,15,50,15,66,15,
+3,2,64,9,13,72,11,7,90,8,52,18,84,18,2,18,15,87,3,1,3,12,29,4,1,11,4,1,4,
+4,0,8,100,19,16,17,17,1,0,16,0,0,16,0,2,7,0,0,20,176,20,1,47,20,1,16,20,1,
+11,5,9,8,32,4,48,4,64,4,3,4,13,4,13,16,9,3,8,0,18,0,63,50,63,51,57,57,47,
+47,93,17,18,57,57,1,93,93,93,17,51,47,94,93,56,51,51,17,51,16,230,17,57,47,
+93,93,51,193,93,50,50,93,16,225,50,49,48,0,43,93,93,43,33,35,1,21,35,17,7,
+17,35,17,51,17,55,17,51,21,1,51,1,4,162,211,254,174,133,119,186,186,119,133,
+1,65,209,253,248,1,244,205,1,100,98,253,215,5,182,253,6,164,1,99,179,1,166,
+253,101,0,1,0,174,0,0,4,35,4,74,0,19,0,156,181,17,64,11,17,72,10,184,255,
+192,179,11,17,72,14,184,255,240,64,87,8,13,72,14,10,38,18,1,18,7,137,19,153,
+19,169,19,3,31,19,47,19,63,19,3,11,19,1,19,19,15,6,2,71,3,84,20,11,12,12,
+16,15,16,32,15,48,15,2,15,15,21,0,21,16,21,2,0,21,64,21,96,21,128,21,160,
+21,192,21,224,21,7,7,14,13,6,6,8,19,8,19,8,2,11,4,15,16,2,21,0,63,51,63,51,
+18,57,57,47,47,18,57,17,51,51,1,94,93,113,17,51,47,93,56,51,51,17,51,16,246,
+225,50,18,57,47,93,93,93,51,193,93,50,50,43,49,48,0,43,43,1,39,17,35,17,51,
+17,55,17,51,21,19,51,1,21,1,35,1,21,35,1,207,109,180,180,109,125,235,197,
+254,80,1,215,207,254,248,125,1,178,123,253,211,4,74,253,235,123,1,70,185,
+1,13,254,22,73,253,233,1,39,205,0,1,0,47,0,0,4,162,5,182,0,20,0,133,64,64,
+2,20,102,20,1,20,19,4,64,14,80,14,2,14,14,0,16,12,4,90,9,7,5,100,21,18,19,
+16,19,19,1,0,16,0,0,16,0,2,7,0,0,22,176,22,1,47,22,1,16,22,1,15,6,95,12,9,
+9,0,2,16,11,16,72,16,184,255,240,64,12,11,16,72,16,2,5,18,10,3,5,0,18,0,63,
+50,63,51,18,57,57,43,43,18,57,47,51,225,50,1,93,93,93,17,51,47,94,93,56,51,
+51,47,56,51,16,246,198,51,225,50,50,18,57,47,93,17,18,57,93,17,51,49,48,33,
+35,1,7,17,35,17,35,53,51,53,51,21,51,21,35,17,55,1,51,1,4,162,211,254,61,
+139,186,152,152,186,213,213,121,1,196,209,253,248,2,186,114,253,184,4,96,
+164,178,178,164,254,123,168,2,51,253,131,0,1,0,18,0,0,3,240,6,20,0,22,0,132,
+64,15,17,14,14,15,4,8,9,3,19,71,20,0,6,1,6,184,255,192,179,16,21,72,6,184,
+255,192,64,53,9,14,72,6,6,15,22,1,20,84,23,12,13,16,13,15,16,53,15,1,0,15,
+16,15,32,15,3,8,15,15,24,15,24,1,9,17,2,20,20,15,7,21,79,4,1,1,2,15,21,12,
+15,2,0,0,63,63,63,18,57,47,51,225,50,17,51,17,18,57,57,1,93,17,51,47,94,93,
+93,56,51,51,17,51,16,246,50,198,18,57,47,43,43,113,16,225,23,50,17,57,17,
+51,49,48,19,51,53,51,21,33,21,33,17,3,51,55,1,51,1,1,35,1,7,17,35,17,35,18,
+156,180,1,123,254,133,16,4,135,1,37,211,254,111,1,172,209,254,176,109,180,
+156,5,94,182,182,137,254,117,254,237,170,1,105,254,37,253,145,1,248,82,254,
+90,4,213,0,0,1,0,20,0,0,5,68,5,182,0,14,0,87,64,51,2,14,14,13,10,4,90,32,
+5,48,5,64,5,128,5,240,5,5,5,5,0,7,12,13,13,1,0,16,0,0,16,0,2,7,0,0,16,16,
+16,1,2,10,5,12,7,95,8,3,5,0,18,0,63,50,63,225,51,18,57,57,1,93,17,51,47,94,
+93,56,51,51,17,51,47,18,57,47,93,225,50,17,57,17,51,49,48,33,35,1,7,17,35,
+17,33,53,33,17,55,1,51,1,5,68,211,254,61,139,187,254,172,2,15,121,1,196,209,
+253,248,2,186,114,253,184,5,18,164,253,37,168,2,51,253,131,0,1,0,41,0,0,4,
+201,4,74,0,13,0,103,64,64,2,13,13,11,6,71,0,7,1,0,7,16,7,32,7,96,7,192,7,
+5,8,7,7,3,9,0,1,213,1,245,1,2,1,4,3,16,0,3,16,3,2,3,3,15,64,15,224,15,2,15,
+15,1,2,13,13,7,9,80,0,10,15,7,3,21,0,63,51,63,51,225,18,57,17,51,1,93,93,
+17,51,47,93,56,51,51,93,17,51,47,18,57,47,94,93,113,225,50,50,17,51,49,48,
+1,51,1,1,35,1,17,35,17,33,53,33,7,17,3,221,197,254,96,1,199,207,254,76,181,
+254,152,2,31,2,4,74,253,241,253,197,2,45,253,211,3,176,154,2,253,237,0,0,
+1,0,229,254,127,5,164,5,182,0,15,0,99,64,63,4,90,4,1,1,116,1,132,1,148,1,
+3,1,1,17,13,5,90,0,17,228,17,244,17,2,192,17,1,2,16,17,32,17,64,17,128,17,
+4,12,8,90,9,100,16,7,95,15,12,1,8,12,12,5,14,10,3,9,0,95,5,18,2,251,0,63,
+63,225,51,63,51,18,57,47,94,93,225,1,16,246,225,50,93,95,93,93,16,220,225,
+50,17,51,47,93,113,225,49,48,37,51,17,35,17,35,17,33,17,35,17,51,17,33,17,
+51,4,244,176,176,187,253,103,187,187,2,153,187,166,253,217,1,129,2,170,253,
+86,5,182,253,152,2,104,0,1,0,174,254,131,4,219,4,74,0,15,0,121,64,82,8,0,
+71,4,11,1,11,11,15,71,196,12,212,12,2,12,12,17,4,17,36,17,2,212,17,244,17,
+2,176,17,1,2,48,17,64,17,80,17,128,17,144,17,160,17,6,7,3,71,4,84,16,13,251,
+2,80,235,7,1,169,7,185,7,2,15,7,31,7,47,7,3,6,7,7,0,9,5,15,11,80,4,0,21,0,
+63,50,225,63,51,18,57,47,94,93,93,93,225,63,1,16,246,225,50,93,95,93,93,113,
+17,51,47,93,225,51,47,93,225,50,49,48,33,17,33,17,35,17,51,17,33,17,51,17,
+51,17,35,17,3,133,253,223,182,182,2,33,182,160,182,1,233,254,23,4,74,254,
+57,1,199,252,80,253,233,1,125,0,1,0,229,0,0,6,72,5,182,0,13,0,93,64,59,9,
+1,90,0,0,5,64,11,1,224,11,1,11,15,32,15,1,0,15,16,15,48,15,64,15,96,15,160,
+15,176,15,224,15,8,6,8,4,90,5,100,14,13,95,10,10,6,3,95,15,8,1,8,8,8,6,3,
+5,0,18,0,63,50,63,57,47,94,93,225,17,51,47,225,1,16,246,225,50,94,93,113,
+16,198,93,113,17,57,47,225,50,49,48,33,35,17,33,17,35,17,51,17,33,17,33,21,
+33,4,244,187,253,103,187,187,2,153,2,15,254,172,2,170,253,86,5,182,253,152,
+2,104,164,0,0,1,0,174,0,0,5,164,4,74,0,13,0,104,64,33,8,4,71,5,9,1,71,0,0,
+11,5,84,14,11,11,15,0,15,32,15,2,144,15,176,15,192,15,208,15,240,15,5,15,
+184,255,192,64,31,7,12,72,3,80,235,8,1,169,8,185,8,2,15,8,31,8,47,8,3,6,8,
+8,0,13,10,6,15,5,0,21,0,63,50,63,51,196,18,57,47,94,93,93,93,225,1,43,93,
+113,17,51,47,16,230,17,57,47,225,50,16,225,50,49,48,33,35,17,33,17,35,17,
+51,17,33,17,33,21,33,4,59,182,253,223,182,182,2,33,2,31,254,151,1,233,254,
+23,4,74,254,57,1,199,154,0,1,0,199,254,0,7,219,5,182,0,39,0,95,64,58,9,11,
+1,7,18,18,0,32,90,33,33,37,24,91,8,41,111,41,1,36,90,37,100,40,29,96,15,3,
+47,3,63,3,3,15,3,63,3,223,3,255,3,4,8,3,3,37,35,95,38,3,33,37,18,19,22,95,
+13,28,0,63,225,51,63,51,63,225,18,57,47,94,93,113,225,1,16,246,225,93,16,
+222,225,17,57,47,225,50,57,47,49,48,0,94,93,1,54,54,51,50,30,2,21,20,14,2,
+35,34,46,2,39,53,22,22,51,32,17,52,46,2,35,34,7,17,35,17,33,17,35,17,33,4,
+193,30,73,46,154,240,165,86,82,146,201,118,49,78,67,61,31,63,126,73,1,119,
+67,124,174,107,75,51,187,253,123,186,3,250,3,27,5,3,92,171,242,151,170,248,
+162,79,6,12,19,12,162,23,24,1,239,121,185,126,64,12,253,137,5,18,250,238,
+5,182,0,1,0,174,254,10,6,117,4,74,0,36,0,119,64,78,11,35,27,35,2,3,3,25,17,
+71,2,18,1,194,18,1,166,18,182,18,2,119,18,135,18,2,18,18,22,10,72,32,38,15,
+38,31,38,2,79,38,95,38,175,38,255,38,4,16,38,1,21,71,22,84,37,13,81,11,27,
+27,27,2,7,27,27,22,20,80,23,15,18,22,21,4,7,81,0,27,0,63,225,51,63,51,63,
+225,18,57,47,94,93,225,1,16,246,225,93,93,113,16,222,225,17,57,47,93,93,93,
+113,225,50,57,47,49,48,0,93,1,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,
+7,17,35,17,33,17,35,17,33,17,54,51,50,30,2,21,20,14,2,4,217,75,106,46,43,
+106,66,118,117,144,157,28,62,31,182,254,8,182,3,100,58,63,102,179,133,76,
+64,111,150,254,10,31,29,161,24,37,195,210,212,202,10,8,254,53,3,176,252,80,
+4,74,254,39,12,62,138,219,157,150,213,136,64,0,2,0,125,255,172,5,150,5,205,
+0,62,0,82,0,122,64,80,5,78,16,50,4,0,73,91,0,32,16,32,2,53,32,53,32,24,63,
+91,0,103,84,15,84,31,84,79,84,95,84,127,84,159,84,175,84,7,7,43,91,24,102,
+83,68,96,78,5,0,58,16,58,32,58,96,58,112,58,128,58,6,58,58,7,38,95,33,29,
+4,16,50,48,95,19,7,95,14,14,19,19,0,63,51,47,225,16,225,50,57,63,51,225,18,
+57,47,93,57,57,225,1,16,246,225,94,93,16,246,225,17,57,57,47,47,93,225,18,
+23,57,49,48,1,20,14,2,7,22,51,50,54,55,21,6,6,35,34,39,6,6,35,34,38,38,2,
+53,52,18,54,54,51,50,22,23,7,46,3,35,34,14,2,21,20,30,2,51,50,55,38,2,53,
+52,62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,30,2,23,62,3,5,111,39,65,85,
+45,54,81,37,70,31,29,79,38,166,139,50,124,60,150,232,157,81,77,158,242,166,
+66,120,37,53,10,40,48,51,21,118,169,108,51,60,112,160,100,48,38,79,91,55,
+96,131,76,75,133,98,57,197,22,42,61,39,41,61,41,21,24,41,54,31,42,66,46,24,
+2,166,101,175,144,111,36,25,14,11,170,13,12,98,17,17,106,192,1,14,165,181,
+1,31,199,105,22,15,156,5,10,9,5,81,154,222,141,148,218,144,70,7,105,1,22,
+155,133,193,123,59,56,123,198,149,84,137,99,54,55,98,135,80,72,133,118,101,
+39,33,98,119,136,0,0,2,0,113,255,197,4,164,4,94,0,13,0,77,0,121,64,73,68,
+5,17,50,4,63,0,72,84,33,100,33,2,53,33,53,33,25,8,72,63,74,74,63,87,79,123,
+79,139,79,187,79,3,95,79,111,79,2,27,79,1,15,79,1,7,2,42,72,25,86,78,11,68,
+5,58,58,71,37,80,34,30,16,17,50,47,80,20,71,80,14,14,20,22,0,63,51,47,225,
+16,225,50,57,63,51,233,18,57,47,57,57,193,1,16,246,225,95,94,93,93,93,93,
+16,230,50,47,16,225,17,57,57,47,47,93,225,18,23,57,49,48,1,20,30,2,23,54,
+54,53,52,38,35,34,6,1,34,38,39,6,6,35,34,46,2,53,52,62,2,51,50,22,23,7,38,
+38,35,34,14,2,21,20,30,2,51,50,54,55,38,38,53,52,62,2,51,50,30,2,21,20,14,
+2,7,22,22,51,50,54,55,21,6,6,2,221,20,32,42,21,57,72,56,61,62,65,1,76,69,
+136,57,40,98,71,117,179,122,63,60,120,180,121,66,82,26,41,19,74,42,84,112,
+67,28,30,67,110,80,37,50,3,57,74,49,85,114,65,64,111,82,46,30,52,69,39,20,
+55,29,26,57,28,25,66,1,244,53,92,75,57,18,40,150,107,103,122,122,253,104,
+42,37,17,23,87,151,204,117,131,214,151,83,16,6,150,5,16,58,111,160,103,89,
+148,107,60,8,2,66,180,119,94,136,89,43,39,86,138,99,70,120,99,77,27,10,13,
+6,8,147,9,7,255,255,0,125,254,66,4,152,5,203,2,38,0,38,0,0,1,7,3,127,2,47,
+0,0,0,14,183,1,1,117,50,44,24,32,37,1,43,53,0,53,255,255,0,113,254,66,3,111,
+4,94,2,38,0,70,0,0,1,7,3,127,1,113,0,0,0,14,183,1,1,82,46,40,5,13,37,1,43,
+53,0,53,0,1,0,20,254,127,4,18,5,182,0,11,0,111,64,57,31,13,1,224,13,1,95,
+13,223,13,2,32,13,48,13,64,13,3,4,90,15,1,31,1,2,7,1,1,175,10,239,10,2,10,
+10,11,90,6,64,7,224,7,2,15,7,1,8,7,7,87,6,103,6,119,6,3,6,184,255,192,64,
+15,7,10,72,6,11,7,95,8,3,0,95,5,18,2,251,0,63,63,225,63,225,50,1,47,43,93,
+51,47,94,93,93,16,225,50,47,93,57,47,94,93,225,93,93,93,113,49,48,37,51,17,
+35,17,35,17,33,53,33,21,33,2,113,176,176,187,254,94,3,254,254,95,166,253,
+217,1,129,5,18,164,164,0,0,1,0,41,254,131,3,94,4,74,0,11,0,111,64,77,240,
+13,1,175,13,1,64,13,80,13,2,47,13,1,11,71,175,8,191,8,207,8,3,8,64,7,10,72,
+8,8,223,5,1,157,5,1,143,5,1,5,5,7,71,0,96,2,112,2,208,2,3,31,2,1,2,2,0,0,
+16,0,176,0,192,0,4,0,9,251,6,2,80,3,15,7,80,0,21,0,63,225,63,225,50,63,1,
+47,93,51,47,93,93,16,225,50,47,93,93,93,57,47,43,93,225,93,93,93,93,49,48,
+33,17,33,53,33,21,33,17,51,17,35,17,1,104,254,193,3,53,254,193,159,182,3,
+176,154,154,252,234,253,233,1,125,0,255,255,0,0,0,0,4,55,5,182,2,6,0,60,0,
+0,0,1,0,0,254,20,3,213,4,74,0,19,0,124,64,19,10,10,0,71,166,1,1,135,1,151,
+1,2,1,1,3,17,18,16,18,184,255,192,179,18,21,72,18,184,255,192,64,32,7,11,
+72,18,18,21,240,21,1,223,21,239,21,2,80,21,144,21,160,21,3,79,21,1,48,21,
+1,15,21,1,4,3,184,255,240,64,16,3,17,3,15,5,10,21,10,2,7,19,10,2,21,0,27,
+0,63,63,51,51,94,93,63,51,1,47,56,51,93,93,93,93,93,93,17,51,47,43,43,56,
+51,18,57,47,93,93,225,57,61,47,49,48,1,35,17,1,51,19,30,3,23,51,62,3,55,19,
+51,1,2,70,183,254,113,188,199,16,32,27,20,5,7,4,21,27,32,16,199,188,254,113,
+254,20,1,232,4,78,253,207,46,100,94,79,25,25,79,94,100,46,2,49,251,178,0,
+1,0,0,0,0,4,55,5,182,0,16,0,159,64,25,239,18,1,18,64,9,12,72,0,0,4,8,90,9,
+13,9,150,9,1,119,9,135,9,2,6,184,255,192,64,13,21,24,72,11,9,6,6,9,11,3,2,
+16,15,184,255,240,64,56,171,15,1,144,15,1,20,15,1,15,1,2,16,16,2,1,239,2,
+1,208,2,1,191,2,1,128,2,1,79,2,95,2,2,20,2,1,0,2,1,7,2,2,18,7,10,95,4,0,13,
+13,1,8,18,15,1,3,0,63,51,63,18,57,47,57,51,225,50,17,1,51,47,94,93,93,93,
+93,93,93,93,113,56,51,47,93,93,93,56,51,18,23,57,47,47,47,43,93,93,17,51,
+16,225,50,57,61,47,43,93,49,48,1,1,51,1,21,33,21,33,17,35,17,33,53,33,53,
+1,51,2,27,1,84,200,254,66,1,39,254,217,187,254,218,1,38,254,66,203,2,211,
+2,227,252,131,61,164,254,168,1,88,164,51,3,135,0,0,1,0,0,254,20,3,213,4,74,
+0,25,0,133,64,21,14,14,23,1,71,6,166,2,1,135,2,151,2,2,2,2,7,21,22,16,22,
+184,255,192,179,18,21,72,22,184,255,192,64,32,7,11,72,22,22,27,240,27,1,223,
+27,239,27,2,80,27,144,27,160,27,3,79,27,1,48,27,1,15,27,1,8,7,184,255,240,
+64,19,7,21,7,15,0,3,79,5,14,21,14,2,7,14,23,6,21,1,27,0,63,63,51,51,94,93,
+225,50,63,51,1,47,56,51,93,93,93,93,93,93,17,51,47,43,43,56,51,18,57,47,93,
+93,51,225,50,57,61,47,49,48,5,17,35,17,33,53,33,1,51,19,30,3,23,51,62,3,55,
+19,51,1,33,21,2,70,183,254,246,1,8,254,115,188,199,16,32,27,20,5,7,4,21,27,
+32,16,199,188,254,113,1,10,137,254,157,1,99,137,4,74,253,207,46,100,94,79,
+25,25,79,94,100,46,2,49,251,182,137,0,1,0,0,254,127,4,180,5,182,0,15,1,6,
+64,136,71,15,1,72,9,1,3,15,0,11,6,5,10,7,14,7,12,0,11,9,5,10,8,13,8,12,15,
+0,11,0,9,6,5,10,5,9,12,15,3,6,6,14,8,10,5,1,170,5,186,5,202,5,234,5,250,5,
+5,5,48,11,14,72,5,4,90,1,13,14,16,11,14,1,171,14,187,14,203,14,235,14,251,
+14,5,14,64,11,14,72,14,10,0,1,170,0,186,0,202,0,234,0,250,0,5,0,48,11,14,
+72,14,0,4,1,20,1,2,7,1,1,17,212,17,228,17,244,17,3,192,17,1,2,32,17,64,17,
+2,17,184,255,192,64,11,16,20,72,15,17,1,11,10,10,7,8,184,255,240,64,20,8,
+40,6,1,39,12,1,12,6,5,13,10,3,7,0,95,5,18,2,251,0,63,63,225,51,63,51,18,57,
+57,93,93,1,47,56,51,51,17,51,93,43,93,95,93,93,17,51,47,94,93,51,51,43,93,
+113,47,43,93,113,56,51,16,225,50,43,93,113,17,18,57,61,47,23,51,16,135,14,
+192,4,192,16,135,192,14,192,16,135,8,192,8,192,16,135,8,192,8,192,1,95,93,
+93,49,48,37,51,17,35,17,35,1,1,35,1,1,51,1,1,51,1,3,254,182,176,119,254,158,
+254,145,188,1,197,254,90,198,1,76,1,78,190,254,91,166,253,217,1,129,2,123,
+253,133,2,252,2,186,253,209,2,47,253,76,0,0,1,0,35,254,131,4,31,4,74,0,15,
+1,57,64,37,89,13,1,86,3,1,180,12,1,12,32,14,17,72,61,12,1,41,12,1,11,12,27,
+12,2,12,11,70,8,0,3,6,3,13,13,1,4,184,255,240,64,113,21,24,72,181,4,1,153,
+4,169,4,2,106,4,122,4,138,4,3,69,4,85,4,2,6,4,1,4,5,219,2,235,2,251,2,3,201,
+2,1,187,2,1,150,2,166,2,2,101,2,117,2,133,2,3,74,2,90,2,2,2,1,223,5,239,5,
+255,5,3,5,64,14,17,72,59,5,75,5,2,39,5,1,10,5,26,5,2,52,1,68,1,2,40,1,1,5,
+1,21,1,2,5,1,5,1,15,59,7,1,7,32,14,17,72,7,8,184,255,192,64,73,7,12,72,8,
+8,17,96,17,128,17,144,17,176,17,208,17,224,17,240,17,7,219,14,1,201,14,1,
+186,14,1,101,14,117,14,133,14,3,74,14,90,14,2,9,14,1,14,59,15,75,15,2,40,
+15,1,5,15,21,15,2,15,3,13,1,14,7,80,12,21,9,251,4,1,15,0,63,51,63,63,225,
+51,18,57,57,1,47,93,93,93,197,93,93,93,93,93,93,93,17,51,47,43,51,43,93,18,
+57,57,47,47,93,93,93,93,93,93,43,93,16,197,93,93,93,93,93,93,16,197,93,93,
+93,93,93,43,18,57,61,47,23,51,16,225,50,93,93,93,43,93,49,48,0,93,93,1,1,
+51,19,19,51,1,1,51,17,35,17,35,1,1,35,1,152,254,159,207,250,250,207,254,157,
+1,15,170,174,101,254,244,254,242,207,2,51,2,23,254,102,1,154,253,233,254,
+103,253,233,1,125,1,180,254,76,0,0,1,0,20,254,127,6,96,5,182,0,15,0,148,64,
+13,1,90,4,4,8,90,16,5,1,208,5,1,5,184,255,192,64,68,7,18,72,5,5,17,223,17,
+1,160,17,1,15,17,47,17,79,17,143,17,4,7,16,14,32,14,64,14,80,14,96,14,128,
+14,6,14,14,0,90,9,15,11,31,11,47,11,95,11,111,11,175,11,6,8,11,11,48,9,64,
+9,80,9,128,9,144,9,5,9,184,255,192,64,17,7,10,72,9,15,11,95,2,12,3,4,0,95,
+9,18,6,251,0,63,63,225,50,63,51,225,50,1,47,43,93,51,47,94,93,16,225,50,47,
+93,94,93,93,93,17,51,47,43,93,113,225,51,47,225,49,48,37,33,17,51,17,51,17,
+35,17,33,17,33,53,33,21,33,2,113,2,133,186,176,176,252,6,254,94,3,254,254,
+95,166,5,16,250,240,253,217,1,129,5,18,164,164,0,1,0,41,254,131,5,109,4,74,
+0,15,0,128,182,11,71,14,14,2,71,15,184,255,192,179,14,24,72,15,184,255,192,
+64,51,7,11,72,15,15,17,15,17,31,17,47,17,79,17,191,17,223,17,6,7,96,8,224,
+8,240,8,3,8,8,10,71,3,31,5,239,5,255,5,3,5,5,0,3,16,3,96,3,112,3,4,3,184,
+255,192,64,17,20,24,72,3,9,5,80,12,6,15,14,10,80,3,21,0,251,0,63,63,225,50,
+63,51,225,50,1,47,43,93,51,47,93,16,225,50,47,93,94,93,17,51,47,43,43,225,
+51,47,225,49,48,1,35,17,33,17,33,53,33,21,33,17,33,17,51,17,51,5,109,183,
+252,178,254,193,3,53,254,193,1,248,182,160,254,131,1,125,3,176,154,154,252,
+234,3,176,252,80,0,0,1,0,166,254,127,5,49,5,182,0,29,0,99,64,18,11,13,27,
+13,2,26,4,90,144,29,160,29,2,29,29,3,90,0,184,255,192,64,44,7,16,72,0,0,31,
+15,31,31,31,47,31,79,31,95,31,127,31,175,31,191,31,8,7,18,90,15,100,30,21,
+95,26,10,10,4,27,16,3,29,95,4,18,1,251,0,63,63,225,63,51,18,57,47,51,225,
+1,16,246,225,94,93,17,51,47,43,225,51,47,93,225,50,49,48,93,37,17,35,17,35,
+17,14,3,35,34,46,2,53,17,51,17,20,22,51,50,62,2,55,17,51,17,5,49,176,186,
+58,105,99,97,49,93,146,101,53,186,105,123,45,90,94,102,56,186,166,253,217,
+1,129,2,86,22,34,22,12,49,94,139,89,2,71,253,209,115,116,10,20,30,20,2,198,
+250,240,0,1,0,154,254,131,4,158,4,74,0,28,0,97,64,23,11,9,27,9,43,9,3,7,21,
+0,71,24,24,28,71,0,25,16,25,32,25,3,25,184,255,192,64,37,14,21,72,25,25,30,
+15,30,95,30,127,30,191,30,207,30,5,14,71,11,84,29,26,251,21,16,80,6,6,0,22,
+12,15,24,80,0,21,0,63,225,63,51,18,57,47,225,51,63,1,16,246,225,93,17,51,
+47,43,93,225,51,47,225,50,49,48,94,93,33,17,14,3,35,34,46,2,53,17,51,17,20,
+51,50,62,2,55,17,51,17,51,17,35,17,3,72,44,80,85,94,58,78,122,82,43,182,184,
+45,80,76,77,42,182,160,183,1,233,30,48,32,17,47,84,115,68,1,166,254,102,174,
+15,28,43,29,1,213,252,80,253,233,1,125,0,1,0,166,0,0,4,129,5,182,0,29,0,112,
+64,46,11,4,27,4,2,28,15,29,4,14,20,14,2,7,14,14,6,19,23,90,22,101,31,112,
+31,160,31,2,47,31,1,16,31,1,9,90,96,6,112,6,160,6,176,6,4,6,184,255,192,64,
+22,7,10,72,6,14,16,14,29,19,27,29,3,12,95,1,1,23,20,7,3,23,18,0,63,63,51,
+18,57,47,225,23,51,47,50,50,47,1,47,43,93,225,93,93,93,16,246,225,50,17,57,
+47,94,93,51,193,50,49,48,93,1,35,34,46,2,53,17,51,17,20,22,51,51,17,51,17,
+54,54,55,17,51,17,35,17,6,6,7,17,35,2,80,33,93,146,101,53,186,105,123,12,
+133,56,118,68,186,186,66,119,57,133,1,252,49,94,139,89,2,71,253,209,115,116,
+1,88,254,180,9,34,25,2,198,250,74,2,86,26,37,11,254,201,0,1,0,154,0,0,3,254,
+4,74,0,28,0,107,64,66,11,4,27,4,2,7,27,14,28,80,13,1,4,13,20,13,36,13,3,8,
+13,13,6,18,22,90,21,85,30,16,30,96,30,128,30,3,9,90,6,84,29,32,13,48,13,64,
+13,3,13,15,13,28,18,26,28,3,11,95,1,1,22,19,7,15,22,21,0,63,63,51,18,57,47,
+225,23,51,47,50,50,47,93,1,16,246,225,93,16,246,225,50,17,57,47,94,93,93,
+51,193,50,49,48,94,93,49,48,1,35,34,46,2,53,17,51,17,20,51,51,17,51,17,54,
+54,55,17,51,17,35,17,6,6,7,17,35,2,14,47,78,122,82,43,182,184,6,125,47,91,
+51,182,182,50,89,50,125,1,106,47,84,115,68,1,166,254,102,174,1,45,254,229,
+14,48,35,1,213,251,182,1,233,35,51,16,255,0,0,1,0,199,0,0,4,162,5,182,0,23,
+0,80,64,54,4,7,20,7,2,7,12,90,11,101,25,47,25,95,25,111,25,143,25,159,25,
+175,25,207,25,239,25,255,25,9,16,25,1,2,22,90,23,100,24,21,16,95,0,5,16,5,
+2,5,5,23,11,18,0,3,0,63,63,51,57,47,93,225,51,1,16,246,225,50,93,93,16,246,
+225,49,48,0,94,93,19,51,17,54,54,51,50,30,2,21,17,35,17,52,38,35,34,14,2,
+7,17,35,199,186,115,195,98,93,146,101,53,187,104,123,45,90,95,101,56,186,
+5,182,253,170,45,45,49,94,138,89,253,184,2,47,115,117,10,20,30,20,253,57,
+0,1,0,174,0,0,4,18,4,74,0,24,0,63,185,0,20,255,224,64,34,7,10,72,0,71,24,
+85,26,239,26,1,16,26,96,26,128,26,3,13,9,71,10,84,25,8,3,80,18,18,11,15,10,
+0,21,0,63,50,63,57,47,225,51,1,16,246,225,50,93,93,16,246,225,49,48,0,43,
+33,17,52,35,34,14,2,7,17,35,17,51,17,62,3,51,50,30,2,21,17,3,92,184,45,80,
+76,77,42,182,182,44,80,85,94,58,78,122,82,43,1,154,174,15,28,44,28,254,43,
+4,74,254,22,31,47,32,17,47,83,115,68,254,90,0,2,0,61,255,236,6,6,5,205,0,
+43,0,54,0,100,64,62,50,91,20,11,103,56,15,56,31,56,2,41,32,34,1,34,34,49,
+12,91,0,112,31,128,31,192,31,3,31,55,31,12,96,49,79,43,1,15,43,175,43,255,
+43,3,15,37,1,8,43,37,43,37,5,17,95,20,26,19,44,95,5,4,0,63,225,63,51,225,
+17,57,57,47,47,94,93,93,113,51,225,50,1,16,214,93,50,225,50,51,47,93,193,
+93,16,246,50,225,49,48,1,62,3,51,50,22,22,18,21,21,33,30,3,51,50,54,55,21,
+14,3,35,34,46,2,39,34,38,53,52,54,55,51,6,6,21,20,51,1,34,14,2,7,33,52,46,
+2,1,102,10,91,156,221,141,153,214,136,62,252,37,7,63,116,169,112,128,207,
+91,42,91,105,124,76,152,235,164,92,9,143,154,18,11,156,6,15,103,2,137,91,
+149,110,65,7,3,18,37,86,139,3,57,154,244,171,91,107,197,254,235,171,69,122,
+194,134,71,44,32,170,15,26,18,10,97,179,253,155,117,122,42,66,23,15,62,35,
+97,1,240,65,126,185,120,117,184,128,67,0,0,2,0,51,255,236,4,182,4,94,0,44,
+0,53,0,132,64,43,49,72,39,30,87,55,255,55,1,144,55,176,55,2,31,55,127,55,
+2,48,31,72,5,15,223,8,1,8,8,19,0,5,16,5,32,5,3,64,5,80,5,2,5,184,255,192,
+64,40,16,19,72,5,54,5,31,80,48,27,18,43,18,2,15,18,1,27,11,43,11,2,15,11,
+1,6,18,11,18,11,34,45,80,24,16,34,81,39,0,22,0,63,50,225,63,225,18,57,57,
+47,47,94,93,93,93,93,51,225,50,1,16,198,43,93,113,50,50,47,93,193,16,225,
+50,93,93,93,16,246,50,225,49,48,5,34,46,2,39,38,38,53,52,54,55,51,6,6,21,
+20,22,51,51,62,3,51,50,30,2,21,21,33,22,22,51,50,62,2,55,21,14,3,3,34,6,7,
+33,52,46,2,3,53,107,179,130,75,4,133,142,18,9,149,6,14,49,49,27,14,76,116,
+152,90,99,158,110,59,253,76,5,153,151,51,87,81,76,39,40,77,81,87,96,114,133,
+11,1,236,27,57,89,20,70,136,199,129,2,111,114,39,63,21,14,58,34,47,49,108,
+169,117,62,71,129,181,110,113,193,182,10,19,29,18,162,19,28,18,8,3,219,156,
+149,68,113,80,44,0,0,2,0,61,254,127,6,6,5,205,0,46,0,57,0,114,64,70,27,90,
+28,28,34,53,91,20,11,103,59,15,59,31,59,2,44,32,37,1,37,37,52,12,91,0,112,
+34,128,34,192,34,3,34,58,34,12,96,52,79,46,1,15,46,63,46,175,46,3,15,40,1,
+8,46,40,46,40,5,26,20,17,96,29,18,27,251,47,95,5,4,0,63,225,63,63,225,51,
+51,18,57,57,47,47,94,93,93,113,51,225,50,1,16,214,93,50,225,50,51,47,93,193,
+93,16,246,50,225,18,57,47,225,49,48,1,62,3,51,50,22,22,18,21,21,33,30,3,51,
+50,54,55,21,14,3,7,17,35,17,46,3,39,34,38,53,52,54,55,51,6,6,21,20,51,1,34,
+14,2,7,33,52,46,2,1,102,10,91,156,221,141,153,214,136,62,252,37,7,63,116,
+169,112,128,207,91,37,78,88,100,58,182,128,196,138,77,8,143,154,18,11,156,
+6,15,103,2,137,91,149,110,65,7,3,18,37,86,139,3,57,154,244,171,91,107,197,
+254,235,171,69,122,194,134,71,44,32,170,14,23,17,11,2,254,145,1,115,16,109,
+176,235,142,117,122,42,66,23,15,62,35,97,1,240,65,126,185,120,117,184,128,
+67,0,2,0,51,254,131,4,182,4,94,0,45,0,54,0,146,64,48,4,71,5,5,11,50,72,45,
+36,87,56,255,56,1,144,56,176,56,2,31,56,127,56,2,49,37,72,11,21,223,14,1,
+14,14,25,0,11,16,11,32,11,3,64,11,80,11,2,11,184,255,192,64,43,16,19,72,11,
+55,11,37,80,49,27,24,43,24,2,15,24,1,27,17,43,17,2,15,17,1,6,24,17,24,17,
+40,46,80,30,16,40,81,45,3,6,22,4,251,0,63,63,51,51,225,63,225,18,57,57,47,
+47,94,93,93,93,93,51,225,50,1,16,198,43,93,113,50,50,47,93,193,16,225,50,
+93,93,93,16,246,50,225,18,57,47,225,49,48,37,6,6,7,17,35,17,46,3,39,38,38,
+53,52,54,55,51,6,6,21,20,22,51,51,62,3,51,50,30,2,21,21,33,22,22,51,50,62,
+2,55,1,34,6,7,33,52,46,2,4,133,66,128,76,182,84,137,99,56,3,133,142,18,9,
+149,6,14,49,49,27,14,76,116,152,90,99,158,110,59,253,76,5,153,151,51,87,81,
+76,39,254,131,114,133,11,1,236,27,57,89,53,32,35,4,254,149,1,117,17,84,132,
+178,111,2,111,114,39,63,21,14,58,34,47,49,108,169,117,62,71,129,181,110,113,
+193,182,10,19,29,18,2,240,156,149,68,113,80,44,0,255,255,0,82,0,0,2,100,5,
+182,2,6,0,44,0,0,255,255,0,4,0,0,6,129,7,105,2,38,1,176,0,0,1,7,2,54,0,244,
+1,82,0,19,64,11,1,23,5,38,1,0,28,18,17,10,37,1,43,53,0,43,53,0,255,255,0,
+4,0,0,5,190,6,23,2,38,1,208,0,0,1,7,2,54,0,147,0,0,0,19,64,11,1,23,17,38,
+1,0,28,18,14,7,37,1,43,53,0,43,53,0,0,1,0,199,254,0,4,225,5,182,0,37,0,103,
+64,63,27,27,5,33,91,17,9,10,16,10,64,12,24,72,10,10,4,17,39,16,39,64,39,2,
+11,8,8,4,90,5,100,38,31,95,28,22,28,8,3,0,96,47,12,95,12,239,12,255,12,4,
+12,64,16,21,72,12,12,5,9,6,3,5,18,0,63,63,51,18,57,47,43,93,225,51,51,63,
+51,225,1,16,246,225,50,17,51,93,16,206,17,57,47,43,56,51,16,225,17,57,47,
+49,48,1,34,6,7,17,35,17,51,17,1,51,1,51,50,30,2,21,20,14,2,35,34,46,2,39,
+53,22,22,51,32,17,52,46,2,2,70,65,92,40,186,186,2,53,207,253,209,6,154,240,
+165,86,82,146,201,118,49,78,67,61,31,63,127,72,1,119,67,124,174,2,111,17,
+14,253,176,5,182,253,60,2,196,253,88,85,163,236,151,170,248,162,79,6,12,19,
+12,162,23,24,1,239,121,179,118,58,0,1,0,174,254,10,3,233,4,74,0,35,0,114,
+64,71,11,8,27,8,2,34,35,16,31,35,1,35,35,29,5,13,13,30,20,72,5,37,15,37,1,
+95,37,111,37,127,37,159,37,191,37,223,37,255,37,7,0,33,33,29,71,30,84,36,
+33,28,25,81,11,0,27,0,2,7,0,0,30,34,31,15,30,21,17,81,14,10,27,0,63,51,225,
+63,63,51,18,57,47,94,93,225,51,51,1,16,246,225,50,17,51,93,113,16,222,225,
+17,57,47,17,18,57,47,113,56,51,49,48,0,93,1,30,3,21,20,14,2,35,34,38,39,53,
+22,22,51,50,54,53,52,46,2,35,34,6,7,17,35,17,51,17,1,51,2,43,94,163,120,69,
+63,111,150,87,76,105,47,44,105,67,118,117,35,74,114,78,32,85,41,180,180,1,
+152,196,2,106,5,64,132,208,148,150,213,136,64,31,29,161,24,37,195,210,106,
+151,96,45,16,13,254,80,4,74,254,10,1,246,0,1,0,0,254,127,5,86,5,182,0,35,
+0,115,177,7,2,184,255,248,64,70,20,23,72,2,90,137,24,1,24,16,24,224,29,1,
+180,29,196,29,212,29,3,0,29,80,29,2,7,29,29,31,15,33,34,34,0,90,35,32,31,
+37,144,37,192,37,240,37,3,15,37,31,37,127,37,3,8,15,33,251,2,95,29,3,19,96,
+12,19,31,95,0,18,0,63,225,63,225,63,225,63,1,47,94,93,93,16,212,50,50,225,
+57,47,51,17,18,57,47,94,93,93,93,51,56,93,225,43,50,49,48,33,17,33,14,3,7,
+14,3,35,34,38,39,53,22,22,51,50,62,2,55,54,54,18,18,55,33,17,51,3,35,19,3,
+217,254,133,15,32,33,33,16,20,53,79,110,78,35,74,28,23,58,32,48,62,42,26,
+12,12,32,39,43,22,2,208,195,143,217,165,5,18,113,245,235,212,81,103,162,111,
+59,14,11,154,13,16,63,98,117,54,57,200,1,6,1,58,170,250,240,253,217,1,129,
+0,0,1,0,16,254,131,4,102,4,74,0,24,0,88,64,56,2,70,212,18,228,18,2,96,18,
+112,18,160,18,176,18,4,52,18,1,18,18,10,22,23,23,0,71,24,21,20,85,26,32,26,
+176,26,2,15,26,1,8,10,22,251,2,80,18,15,13,79,7,22,20,80,0,21,0,63,225,63,
+225,63,225,63,1,47,94,93,93,16,244,50,50,225,57,47,51,17,57,47,93,93,93,225,
+49,48,33,17,33,2,2,6,6,35,34,38,39,53,22,51,50,54,54,18,55,33,17,51,3,35,
+19,2,250,254,254,20,64,95,130,86,28,49,16,22,28,55,89,69,51,18,2,84,182,122,
+183,123,3,176,254,253,254,148,230,105,6,6,131,6,117,241,1,111,250,252,80,
+253,233,1,125,0,0,1,0,229,254,0,4,244,5,182,0,27,0,75,64,43,5,5,16,20,12,
+90,23,101,29,192,29,1,191,29,1,32,29,1,19,15,90,16,100,28,14,95,15,19,1,8,
+19,19,16,21,17,3,16,18,9,95,6,0,28,0,63,50,225,63,63,51,18,57,47,94,93,225,
+1,16,246,225,50,93,93,93,16,246,225,50,17,57,47,49,48,1,34,46,2,39,53,22,
+22,51,50,54,53,17,33,17,35,17,51,17,33,17,51,17,20,14,2,2,209,49,78,68,61,
+31,63,127,72,187,198,253,103,187,187,2,153,187,82,146,201,254,0,6,12,19,12,
+162,23,24,240,247,2,31,253,86,5,182,253,152,2,104,250,221,170,248,162,79,
+0,1,0,174,254,10,4,59,4,74,0,27,0,105,64,26,3,3,16,20,12,71,23,85,29,0,29,
+32,29,2,48,29,64,29,80,29,208,29,240,29,5,29,184,255,192,64,40,14,17,72,19,
+15,71,16,84,28,14,80,235,19,1,169,19,185,19,2,15,19,31,19,47,19,3,6,19,19,
+16,21,17,15,16,21,7,81,4,0,27,0,63,50,225,63,63,51,18,57,47,94,93,93,93,225,
+1,16,246,225,50,43,93,113,16,246,225,50,17,57,47,49,48,1,34,38,39,53,22,22,
+51,50,62,2,53,17,33,17,35,17,51,17,33,17,51,17,20,14,2,2,160,76,105,47,44,
+105,66,59,91,61,31,253,223,182,182,2,33,182,63,111,150,254,10,31,29,161,24,
+37,45,97,150,105,1,178,254,23,4,74,254,57,1,199,251,243,150,213,136,64,0,
+1,0,229,254,127,5,182,5,182,0,15,0,82,64,50,2,3,3,13,5,90,4,1,0,17,16,17,
+32,17,64,17,128,17,192,17,224,17,240,17,7,12,8,90,9,100,16,7,95,15,12,1,8,
+12,12,5,14,10,3,9,0,95,5,18,2,251,0,63,63,225,51,63,51,18,57,47,94,93,225,
+1,16,246,225,50,93,16,212,50,50,225,50,57,47,51,49,48,37,51,3,35,19,35,17,
+33,17,35,17,51,17,33,17,51,4,244,194,143,217,166,187,253,103,187,187,2,153,
+187,166,253,217,1,129,2,170,253,86,5,182,253,152,2,104,0,0,1,0,174,254,131,
+4,242,4,74,0,15,0,118,64,79,13,14,14,8,0,71,15,12,171,11,187,11,2,11,17,4,
+17,36,17,2,212,17,244,17,2,176,17,1,2,48,17,64,17,80,17,128,17,144,17,160,
+17,6,7,3,71,4,84,16,13,251,2,80,235,7,1,169,7,185,7,2,15,7,31,7,47,7,3,6,
+7,7,0,9,5,15,11,80,4,0,21,0,63,50,225,63,51,18,57,47,94,93,93,93,225,63,1,
+16,246,225,50,93,95,93,93,113,16,212,93,50,50,225,50,57,47,51,49,48,33,17,
+33,17,35,17,51,17,33,17,51,17,51,3,35,19,3,133,253,223,182,182,2,33,182,183,
+123,182,122,1,233,254,23,4,74,254,57,1,199,252,80,253,233,1,125,0,0,1,0,166,
+254,127,4,129,5,182,0,29,0,89,64,33,29,90,26,26,22,0,90,25,101,31,112,31,
+160,31,2,47,31,1,16,31,1,14,90,96,11,112,11,160,11,176,11,4,11,184,255,192,
+64,20,7,10,72,11,22,17,95,6,6,12,26,27,251,29,95,26,18,23,12,3,0,63,51,63,
+225,63,17,18,57,47,225,51,1,47,43,93,225,93,93,93,16,246,225,50,50,47,225,
+49,48,37,17,14,3,35,34,46,2,53,17,51,17,20,22,51,50,62,2,55,17,51,17,35,17,
+35,17,3,199,58,105,99,97,49,93,146,101,53,186,105,123,45,90,94,102,56,186,
+186,176,166,1,176,22,34,22,12,49,94,139,89,2,71,253,209,115,116,10,20,30,
+20,2,198,250,74,254,127,2,39,0,1,0,154,254,131,3,254,4,74,0,28,0,64,64,37,
+27,71,24,24,20,28,71,23,85,30,16,30,96,30,128,30,3,13,71,10,84,29,25,251,
+20,15,80,5,5,11,27,80,24,21,21,11,15,0,63,51,63,225,18,57,47,225,51,63,1,
+16,246,225,93,16,246,225,50,50,47,225,49,48,1,14,3,35,34,46,2,53,17,51,17,
+20,51,50,62,2,55,17,51,17,35,17,35,17,51,3,72,44,80,85,94,58,78,122,82,43,
+182,184,45,80,76,77,42,182,160,182,160,1,233,30,48,32,17,47,84,115,68,1,166,
+254,102,174,15,28,43,29,1,213,251,182,254,131,2,23,0,1,0,199,254,127,6,242,
+5,182,0,31,0,154,182,54,31,1,57,0,1,31,184,255,248,64,44,12,15,72,31,0,8,
+12,15,72,0,13,13,12,16,9,18,19,19,14,8,12,15,72,57,14,1,14,29,21,90,20,17,
+16,33,32,33,192,33,2,15,33,1,8,11,184,255,248,64,16,12,15,72,38,11,1,11,2,
+8,90,9,100,32,16,95,12,184,255,240,64,22,9,18,72,0,9,12,3,21,18,18,251,30,
+1,1,16,9,18,72,1,14,10,3,0,63,51,51,43,17,51,63,63,23,51,43,225,1,16,246,
+225,50,50,93,43,94,93,93,16,212,50,50,225,50,50,93,43,57,47,51,17,18,57,57,
+17,51,43,51,43,49,48,93,93,33,1,35,22,23,22,22,21,17,35,17,33,1,51,1,33,17,
+51,3,35,19,35,17,52,62,2,55,54,55,35,1,3,35,254,69,8,5,4,4,6,172,1,20,1,156,
+6,1,158,1,20,195,144,217,166,186,1,2,2,2,3,4,8,254,65,5,0,74,73,63,139,57,
+252,150,5,182,251,88,4,168,250,240,253,217,1,129,3,119,25,61,65,66,30,71,
+73,251,2,0,1,0,174,254,131,5,199,4,74,0,36,0,135,64,90,8,7,24,24,16,32,34,
+35,35,30,0,70,36,33,175,32,191,32,2,32,38,224,38,1,207,38,1,48,38,64,38,80,
+38,160,38,4,15,38,1,6,18,15,70,16,84,37,34,251,1,59,14,75,14,91,14,3,11,14,
+27,14,43,14,3,14,14,30,17,15,32,80,52,24,68,24,84,24,3,5,24,21,24,37,24,3,
+8,16,24,3,0,21,0,63,23,50,93,93,225,63,51,51,47,93,93,51,63,1,16,246,225,
+50,94,93,93,93,93,16,212,93,50,50,225,50,57,47,51,17,18,57,17,51,51,49,48,
+33,17,14,3,7,1,35,1,46,3,39,17,35,17,51,1,30,3,23,62,3,55,1,51,17,51,3,35,
+19,4,111,6,17,20,18,7,254,248,135,254,247,5,17,20,18,7,162,221,1,11,13,22,
+19,14,5,6,14,19,22,13,1,14,217,183,123,182,122,3,129,21,57,59,54,18,253,80,
+2,176,13,49,59,62,26,252,127,4,74,253,71,34,67,60,50,16,17,49,59,65,33,2,
+189,252,80,253,233,1,125,255,255,0,82,0,0,2,100,5,182,2,6,0,44,0,0,255,255,
+0,0,0,0,4,221,7,105,2,38,0,36,0,0,1,7,2,54,0,33,1,82,0,19,64,11,2,26,5,38,
+2,0,31,21,4,7,37,1,43,53,0,43,53,0,255,255,0,94,255,236,3,161,6,23,2,38,0,
+68,0,0,1,6,2,54,212,0,0,19,64,11,2,56,17,38,2,37,61,51,12,34,37,1,43,53,0,
+43,53,0,255,255,0,0,0,0,4,221,7,43,2,38,0,36,0,0,1,7,0,106,0,33,1,82,0,23,
+64,13,3,2,30,5,38,3,2,1,21,41,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,94,
+255,236,3,156,5,217,2,38,0,68,0,0,1,6,0,106,222,0,0,23,64,13,3,2,60,17,38,
+3,2,47,51,71,12,34,37,1,43,53,53,0,43,53,53,0,255,255,255,254,0,0,6,86,5,
+182,2,6,0,136,0,0,255,255,0,94,255,236,6,68,4,94,2,6,0,168,0,0,255,255,0,
+199,0,0,3,200,7,105,2,38,0,40,0,0,1,7,2,54,255,251,1,82,0,19,64,11,1,17,5,
+38,1,6,22,12,1,0,37,1,43,53,0,43,53,0,255,255,0,113,255,236,3,225,6,23,2,
+38,0,72,0,0,1,6,2,54,234,0,0,19,64,11,2,45,17,38,2,15,50,40,5,15,37,1,43,
+53,0,43,53,0,0,2,0,113,255,236,5,18,5,205,0,30,0,41,0,73,64,47,36,26,91,14,
+103,43,15,43,143,43,175,43,191,43,4,43,64,11,15,72,37,91,3,25,102,42,37,95,
+47,25,95,25,127,25,3,25,25,9,31,95,19,19,3,0,95,9,4,0,63,225,51,63,225,17,
+57,47,93,225,1,16,246,50,225,43,93,16,246,225,50,49,48,1,34,6,7,53,62,3,51,
+50,22,22,18,21,20,2,6,6,35,34,38,38,2,53,53,33,46,3,3,50,62,2,55,33,20,30,
+2,2,121,128,207,91,42,90,105,125,76,160,244,165,84,81,157,232,150,153,215,
+135,62,3,219,7,64,115,169,67,91,149,109,66,7,252,237,38,85,140,5,41,44,32,
+170,15,26,19,10,108,198,254,233,171,174,254,235,194,104,107,196,1,21,171,
+70,122,193,134,71,251,102,65,126,185,120,117,184,127,68,0,0,2,0,102,255,236,
+3,215,4,94,0,30,0,39,0,67,64,41,34,17,72,5,87,41,176,41,1,63,41,1,35,72,25,
+16,86,40,35,80,159,16,175,16,207,16,223,16,4,16,16,0,31,80,10,22,25,20,81,
+0,16,0,63,225,51,63,225,17,57,47,93,225,1,16,246,50,225,93,93,16,246,225,
+50,49,48,1,50,30,2,21,20,14,2,35,34,46,2,53,53,33,38,38,35,34,14,2,7,53,62,
+3,19,50,54,55,33,20,30,2,1,231,110,182,131,73,66,120,167,102,99,158,110,59,
+2,181,5,154,151,51,87,80,76,39,40,76,81,87,96,115,133,11,254,20,27,57,88,
+4,94,74,142,210,135,136,214,149,78,71,129,181,110,113,192,182,10,19,28,18,
+161,19,28,18,9,252,37,156,149,68,113,80,44,0,255,255,0,113,255,236,5,18,7,
+43,2,38,2,225,0,0,1,7,0,106,0,70,1,82,0,25,182,3,2,51,5,38,3,2,184,255,211,
+180,42,62,24,14,37,1,43,53,53,0,43,53,53,0,255,255,0,102,255,236,3,215,5,
+217,2,38,2,226,0,0,1,6,0,106,196,0,0,25,182,3,2,49,17,38,3,2,184,255,244,
+180,40,60,15,5,37,1,43,53,53,0,43,53,53,0,255,255,0,4,0,0,6,129,7,43,2,38,
+1,176,0,0,1,7,0,106,0,244,1,82,0,23,64,13,2,1,27,5,38,2,1,0,18,38,17,10,37,
+1,43,53,53,0,43,53,53,0,255,255,0,4,0,0,5,190,5,217,2,38,1,208,0,0,1,7,0,
+106,0,145,0,0,0,25,182,2,1,27,17,38,2,1,184,255,255,180,18,38,14,7,37,1,43,
+53,53,0,43,53,53,0,255,255,0,72,255,236,3,236,7,43,2,38,1,177,0,0,1,7,0,106,
+255,191,1,82,0,25,182,2,1,67,5,38,2,1,184,255,244,180,58,78,19,11,37,1,43,
+53,53,0,43,53,53,0,255,255,0,68,255,236,3,82,5,217,2,38,1,209,0,0,1,7,0,106,
+255,85,0,0,0,25,182,2,1,67,17,38,2,1,184,255,217,180,58,78,41,33,37,1,43,
+53,53,0,43,53,53,0,0,1,0,72,255,236,3,236,5,182,0,32,0,114,64,45,0,91,27,
+28,91,32,32,64,16,24,72,29,27,32,32,27,29,3,13,22,91,5,103,34,159,34,1,112,
+13,128,13,2,63,13,79,13,95,13,3,13,32,29,95,30,27,184,255,240,64,24,7,13,
+72,27,25,170,0,1,120,0,1,15,0,1,8,0,0,30,3,19,96,14,10,19,0,63,51,225,63,
+57,47,94,93,93,93,51,51,43,16,225,50,1,47,93,93,93,16,246,225,18,23,57,47,
+47,47,43,16,225,16,225,49,48,1,30,3,21,20,14,2,35,34,38,39,53,30,3,51,50,
+54,53,52,38,35,35,53,1,33,53,33,21,1,244,115,186,132,71,67,136,205,137,110,
+192,85,43,96,99,99,46,178,176,207,186,123,1,166,253,166,3,61,3,59,5,53,100,
+151,102,96,160,116,64,34,45,170,23,36,24,13,148,135,135,129,151,1,209,166,
+145,0,1,0,27,254,20,3,117,4,74,0,36,0,100,64,62,0,74,31,32,74,36,36,64,19,
+24,72,33,31,36,36,31,33,3,13,24,71,5,87,38,111,38,159,38,2,48,38,1,15,38,
+1,7,13,64,12,17,72,13,36,33,80,34,31,29,0,32,9,12,72,0,0,34,15,19,80,14,10,
+27,0,63,51,225,63,57,47,43,51,51,16,225,50,1,47,43,94,93,93,93,16,246,225,
+18,23,57,47,47,47,43,16,225,16,225,49,48,1,30,3,21,20,14,2,35,34,38,39,53,
+30,3,51,50,62,2,53,52,46,2,35,35,53,1,33,53,33,21,1,168,95,168,125,73,71,
+132,186,115,115,181,58,31,78,91,102,54,71,119,86,48,55,99,139,84,109,1,146,
+253,198,3,6,1,213,7,65,117,166,108,110,183,132,73,36,34,166,16,31,24,15,46,
+87,125,78,86,125,82,39,125,1,237,154,133,255,255,0,201,0,0,5,16,6,193,2,38,
+1,178,0,0,1,7,1,77,0,176,1,82,0,21,180,1,26,5,38,1,184,255,254,180,24,25,
+0,12,37,1,43,53,0,43,53,0,255,255,0,174,0,0,4,59,5,111,2,38,1,210,0,0,1,6,
+1,77,57,0,0,21,180,1,14,17,38,1,184,255,255,180,12,13,10,4,37,1,43,53,0,43,
+53,0,255,255,0,201,0,0,5,16,7,43,2,38,1,178,0,0,1,7,0,106,0,156,1,82,0,25,
+182,2,1,33,5,38,2,1,184,255,254,180,24,44,0,12,37,1,43,53,53,0,43,53,53,0,
+255,255,0,174,0,0,4,59,5,217,2,38,1,210,0,0,1,6,0,106,37,0,0,25,182,2,1,21,
+17,38,2,1,184,255,255,180,12,32,10,4,37,1,43,53,53,0,43,53,53,0,255,255,0,
+125,255,236,5,113,7,43,2,38,0,50,0,0,1,7,0,106,0,170,1,82,0,23,64,13,3,2,
+49,5,38,3,2,1,40,60,10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,113,255,236,
+4,45,5,217,2,38,0,82,0,0,1,6,0,106,249,0,0,25,182,3,2,41,17,38,3,2,184,255,
+249,180,32,52,10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,125,255,236,5,113,
+5,205,2,6,2,126,0,0,255,255,0,113,255,236,4,45,4,94,2,6,2,127,0,0,255,255,
+0,125,255,236,5,113,7,43,2,38,2,126,0,0,1,7,0,106,0,170,1,82,0,23,64,13,4,
+3,51,5,38,4,3,1,42,62,10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,113,255,236,
+4,45,5,217,2,38,2,127,0,0,1,6,0,106,0,0,0,23,64,13,4,3,43,17,38,4,3,0,34,
+54,10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,59,255,236,4,68,7,43,2,38,1,
+199,0,0,1,7,0,106,255,151,1,82,0,25,182,2,1,46,5,38,2,1,184,255,166,180,37,
+57,4,12,37,1,43,53,53,0,43,53,53,0,255,255,0,55,255,236,3,66,5,217,2,38,1,
+231,0,0,1,7,0,106,255,56,0,0,0,25,182,2,1,48,17,38,2,1,184,255,202,180,39,
+59,3,34,37,1,43,53,53,0,43,53,53,0,255,255,0,25,255,236,4,174,6,193,2,38,
+1,189,0,0,1,7,1,77,0,39,1,82,0,21,180,1,36,5,38,1,184,255,254,180,34,35,19,
+0,37,1,43,53,0,43,53,0,255,255,0,10,254,20,3,223,5,111,2,38,0,92,0,0,1,6,
+1,77,187,0,0,19,64,11,1,37,17,38,1,1,35,36,0,15,37,1,43,53,0,43,53,0,255,
+255,0,25,255,236,4,174,7,43,2,38,1,189,0,0,1,7,0,106,0,18,1,82,0,25,182,2,
+1,43,5,38,2,1,184,255,253,180,34,54,19,0,37,1,43,53,53,0,43,53,53,0,255,255,
+0,10,254,20,3,223,5,217,2,38,0,92,0,0,1,6,0,106,167,0,0,23,64,13,2,1,44,17,
+38,2,1,1,35,55,0,15,37,1,43,53,53,0,43,53,53,0,255,255,0,25,255,236,4,174,
+7,115,2,38,1,189,0,0,1,7,1,83,0,102,1,82,0,23,64,13,2,1,46,5,38,2,1,81,34,
+54,19,0,37,1,43,53,53,0,43,53,53,0,255,255,0,10,254,20,3,223,6,33,2,38,0,
+92,0,0,1,6,1,83,0,0,0,23,64,13,2,1,47,17,38,2,1,90,35,55,0,15,37,1,43,53,
+53,0,43,53,53,0,255,255,0,166,0,0,4,129,7,43,2,38,1,193,0,0,1,7,0,106,0,84,
+1,82,0,23,64,13,2,1,31,5,38,2,1,15,22,42,10,0,37,1,43,53,53,0,43,53,53,0,
+255,255,0,154,0,0,3,254,5,217,2,38,1,225,0,0,1,6,0,106,6,0,0,23,64,13,2,1,
+34,17,38,2,1,8,25,45,23,10,37,1,43,53,53,0,43,53,53,0,0,1,0,199,254,127,3,
+190,5,182,0,9,0,100,64,11,20,0,1,228,0,1,208,0,1,2,0,184,255,192,64,53,8,
+19,72,0,0,11,47,11,79,11,111,11,143,11,4,11,64,17,24,72,7,90,191,4,207,4,
+2,132,4,1,15,4,31,4,2,7,4,4,3,90,8,100,10,2,95,9,3,3,95,7,18,6,251,0,63,63,
+225,63,225,1,16,246,225,50,47,94,93,93,93,225,43,93,17,51,47,43,95,93,93,
+113,49,48,1,21,33,17,51,17,35,17,35,17,3,190,253,195,176,176,186,5,182,166,
+251,150,253,217,1,129,5,182,0,1,0,174,254,131,3,10,4,74,0,9,0,78,64,50,32,
+2,48,2,2,2,2,11,192,11,1,161,11,1,112,11,1,9,71,191,6,207,6,2,132,6,1,15,
+6,31,6,2,7,6,6,5,71,0,84,10,5,80,9,21,8,251,4,80,1,15,0,63,225,63,63,225,
+1,16,246,225,50,47,94,93,93,93,225,93,93,93,17,51,47,93,49,48,51,17,33,21,
+33,17,51,17,35,17,174,2,92,254,90,160,182,4,74,154,252,234,253,233,1,125,
+255,255,0,199,0,0,5,207,7,43,2,38,1,197,0,0,1,7,0,106,0,252,1,82,0,23,64,
+13,4,3,39,5,38,4,3,0,30,50,6,28,37,1,43,53,53,0,43,53,53,0,255,255,0,174,
+0,0,5,80,5,217,2,38,1,229,0,0,1,7,0,106,0,176,0,0,0,23,64,13,4,3,39,17,38,
+4,3,0,30,50,10,13,37,1,43,53,53,0,43,53,53,0,255,255,0,47,254,109,3,190,5,
+182,2,38,2,155,0,0,1,7,3,128,0,166,0,0,0,10,179,1,31,31,7,1,16,60,17,53,255,
+255,0,18,254,109,3,10,4,74,2,38,2,156,0,0,1,7,3,129,0,137,0,0,0,10,179,1,
+31,31,13,1,16,60,17,53,255,255,0,0,254,109,4,154,5,182,0,38,0,59,0,0,1,7,
+3,128,3,35,0,0,0,23,177,1,29,184,255,192,178,19,21,72,184,255,158,180,29,
+29,0,0,37,1,43,43,53,0,255,255,0,35,254,109,4,17,4,74,0,38,0,91,0,0,1,7,3,
+129,2,154,0,0,0,18,179,1,80,29,1,184,255,154,180,29,29,7,7,37,1,43,93,53,
+0,1,0,0,0,0,4,96,5,182,0,17,0,178,64,39,70,15,86,15,2,73,9,89,9,2,54,0,1,
+57,6,1,6,9,15,0,4,12,3,3,1,48,17,1,63,7,1,7,17,7,17,5,1,11,10,184,255,240,
+179,10,10,4,5,184,255,240,64,20,5,13,14,16,14,14,2,1,16,0,1,1,112,1,128,1,
+192,1,3,1,184,255,192,64,39,7,10,72,1,1,19,15,19,31,19,47,19,127,19,4,8,0,
+6,95,15,9,40,3,1,39,12,1,3,12,10,9,9,1,13,10,3,5,1,18,0,63,51,63,51,18,57,
+47,17,57,57,93,93,17,51,225,50,1,94,93,17,51,47,43,93,113,56,51,51,47,56,
+51,47,56,51,51,47,56,51,17,18,57,57,47,47,93,93,17,57,61,47,51,23,51,93,93,
+93,93,49,48,1,1,35,1,1,35,1,33,53,33,1,51,1,1,51,1,33,21,2,197,1,155,211,
+254,158,254,145,188,1,154,254,223,1,20,254,146,198,1,76,1,78,190,254,142,
+1,28,2,180,253,76,2,123,253,133,2,180,164,2,94,253,209,2,47,253,162,164,0,
+1,0,35,0,0,3,219,4,74,0,17,1,23,64,191,128,8,144,8,2,8,0,8,0,11,15,6,5,1,
+247,5,1,229,5,1,54,5,1,5,6,7,10,10,4,13,1,16,16,13,9,3,1,248,3,1,234,3,1,
+57,3,1,3,2,107,6,123,6,2,87,6,1,58,6,74,6,2,100,2,116,2,2,88,2,1,53,2,69,
+2,2,6,2,13,2,13,6,3,15,6,12,1,247,12,1,229,12,1,54,12,1,12,11,64,22,25,72,
+11,64,14,17,72,107,11,123,11,2,87,11,1,58,11,74,11,2,11,11,19,16,19,48,19,
+2,144,19,176,19,2,15,19,1,9,14,1,248,14,1,234,14,1,57,14,1,14,107,15,123,
+15,2,88,15,1,53,15,69,15,2,15,13,10,16,79,4,7,239,1,1,11,1,27,1,43,1,91,1,
+107,1,5,6,1,1,2,15,11,21,5,2,15,0,63,51,63,51,18,57,47,94,93,93,51,51,225,
+50,50,1,47,93,93,93,193,93,93,93,113,93,93,113,16,206,47,93,93,93,43,43,193,
+93,93,93,113,18,23,57,61,47,24,47,47,93,93,93,93,93,93,16,193,93,93,93,113,
+17,51,17,51,17,51,51,17,51,16,193,93,93,93,113,17,18,57,57,47,47,93,49,48,
+19,33,1,51,19,19,51,1,33,21,33,1,35,1,1,35,1,33,104,1,0,254,207,207,250,250,
+207,254,205,1,4,254,247,1,74,207,254,244,254,242,207,1,74,254,251,2,123,1,
+207,254,102,1,154,254,49,137,254,14,1,180,254,76,1,242,0,0,2,0,137,0,0,3,
+246,5,182,0,14,0,25,0,64,64,41,6,25,90,9,101,27,159,27,1,16,27,1,21,91,0,
+102,26,15,95,63,6,79,6,111,6,159,6,191,6,223,6,6,6,6,7,25,95,9,18,7,3,0,63,
+63,225,17,57,47,93,225,1,16,246,225,93,93,16,246,225,50,49,48,19,52,62,2,
+51,51,17,51,17,33,34,46,2,1,35,34,14,2,21,20,22,51,51,137,55,127,207,152,
+149,187,254,149,134,194,126,60,2,178,129,93,138,91,46,163,175,159,1,172,87,
+152,113,66,2,104,250,74,61,112,158,1,95,27,60,97,70,136,132,0,255,255,0,113,
+255,236,4,2,6,20,2,6,0,71,0,0,0,2,0,137,255,236,6,59,5,182,0,35,0,50,0,99,
+64,63,24,9,50,90,26,26,17,34,90,1,101,52,15,52,1,111,52,159,52,239,52,3,64,
+52,80,52,2,15,52,1,6,42,91,17,102,51,36,95,23,35,35,63,23,79,23,111,23,191,
+23,223,23,5,23,23,24,3,29,45,96,9,6,14,19,0,63,51,51,225,50,63,57,47,93,51,
+47,16,225,1,16,246,225,94,93,93,93,113,16,246,225,17,57,47,225,57,50,49,48,
+1,17,20,14,2,35,34,38,39,14,3,35,34,38,53,52,62,2,51,51,17,51,17,20,22,51,
+50,62,2,53,17,5,35,34,14,2,21,20,22,51,50,62,2,53,6,59,45,91,140,94,114,153,
+43,24,63,82,103,63,215,228,65,138,215,150,122,187,103,97,44,72,51,28,253,
+186,129,93,139,91,45,126,134,67,91,56,23,3,80,254,24,81,139,102,58,97,77,
+38,63,46,25,210,214,103,163,114,60,2,104,251,178,112,105,30,57,80,50,1,232,
+166,30,67,107,77,128,130,37,62,77,41,0,0,2,0,113,255,236,6,90,6,20,0,50,0,
+67,0,92,64,57,16,44,56,71,80,46,1,46,46,27,3,71,6,85,69,111,69,127,69,159,
+69,207,69,239,69,5,64,69,1,15,69,47,69,2,6,65,72,27,86,68,4,4,51,62,80,37,
+32,16,44,0,0,51,80,16,11,22,22,0,63,51,51,225,50,63,63,51,225,18,57,47,1,
+16,246,225,94,93,93,93,16,246,225,17,57,47,93,225,50,57,49,48,37,50,54,53,
+17,51,17,20,14,2,35,34,46,2,39,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,
+51,38,39,38,38,53,17,51,17,30,3,33,50,62,2,55,53,52,46,2,35,34,6,21,20,22,
+4,211,111,98,182,47,92,139,91,65,103,81,61,23,6,27,68,91,121,81,93,154,110,
+60,60,110,154,93,59,96,77,59,23,12,3,3,2,4,182,1,15,44,81,253,166,76,105,
+65,31,2,27,65,108,81,135,127,127,131,130,130,1,53,254,193,105,152,98,46,30,
+54,74,44,41,74,55,32,72,143,212,140,141,213,144,73,26,44,58,32,34,31,26,54,
+17,1,180,251,146,62,106,78,45,46,94,140,95,41,101,157,107,55,218,204,209,
+205,0,0,1,0,78,255,236,6,68,5,203,0,63,0,133,64,86,13,91,32,0,91,43,37,32,
+7,32,43,43,32,7,3,22,51,90,54,101,65,127,65,143,65,159,65,239,65,255,65,5,
+0,65,32,65,48,65,3,112,22,128,22,2,63,22,79,22,2,22,22,64,37,6,96,7,0,52,
+1,52,52,223,7,1,170,7,1,120,7,1,15,7,1,8,7,7,27,48,95,59,19,21,18,96,27,4,
+0,63,225,51,63,225,17,57,47,94,93,93,93,93,51,47,93,16,225,57,17,1,51,47,
+93,93,93,93,16,246,225,17,23,57,47,47,47,18,57,16,225,16,225,49,48,1,52,46,
+2,35,35,53,51,50,62,2,53,52,46,2,35,34,6,7,39,62,3,51,50,30,2,21,20,14,2,
+7,21,30,3,21,20,30,2,51,50,54,53,17,51,17,20,14,2,35,34,46,2,3,41,53,101,
+146,93,191,176,92,142,97,50,37,68,95,58,110,169,75,92,38,98,116,131,71,109,
+166,113,57,51,91,125,75,87,138,94,50,24,50,79,55,111,98,183,56,102,145,89,
+87,148,108,60,1,135,77,109,70,33,151,39,72,100,62,54,83,58,30,67,54,125,31,
+54,41,24,54,97,133,79,74,119,88,57,12,6,11,57,89,119,72,74,104,65,30,119,
+129,1,201,254,45,105,152,98,46,47,100,156,0,0,1,0,80,255,236,5,162,4,94,0,
+59,0,129,64,35,21,71,0,32,70,49,54,49,25,0,49,25,25,49,0,3,39,8,71,11,85,
+61,15,61,1,208,61,1,191,61,1,48,61,1,39,184,255,192,64,41,18,21,72,95,39,
+1,39,39,60,54,25,80,26,9,9,223,26,1,153,26,169,26,2,11,26,27,26,2,7,26,26,
+5,38,35,80,44,16,5,80,16,22,0,63,225,63,225,51,18,57,47,94,93,93,93,51,47,
+16,225,57,17,1,51,47,93,43,93,93,93,113,16,246,225,17,23,57,47,47,47,17,18,
+57,16,225,16,225,49,48,1,20,30,2,51,50,54,53,17,51,17,20,14,2,35,34,46,2,
+53,52,38,35,35,53,51,50,62,2,53,52,38,35,34,6,7,39,62,3,51,50,30,2,21,20,
+14,2,7,21,30,3,3,82,21,49,80,59,105,96,182,47,95,143,96,92,144,100,53,133,
+138,129,97,61,100,72,39,115,108,71,129,75,63,40,77,82,90,53,86,144,105,58,
+28,51,70,43,50,83,60,34,1,76,39,73,56,33,130,130,1,53,254,193,105,152,98,
+46,43,84,123,79,94,91,153,18,39,64,45,77,77,38,34,147,19,29,19,9,38,74,109,
+70,50,77,59,41,14,11,9,41,62,82,0,0,1,0,78,254,127,4,156,5,203,0,49,0,131,
+64,84,15,91,39,9,34,9,34,9,24,1,90,112,46,128,46,2,46,46,0,90,47,47,51,0,
+51,1,192,51,208,51,2,159,51,1,0,51,32,51,48,51,3,112,24,128,24,2,63,24,79,
+24,2,24,24,50,48,251,39,8,96,223,9,1,170,9,1,120,9,1,15,9,1,8,9,9,1,23,20,
+96,29,4,46,95,1,18,0,63,225,63,225,51,18,57,47,94,93,93,93,93,225,57,63,17,
+1,51,47,93,93,93,93,93,113,17,51,47,225,50,47,93,225,18,57,57,47,47,18,57,
+225,49,48,33,35,17,52,46,2,35,35,53,51,50,62,2,53,52,46,2,35,34,6,7,39,62,
+3,51,50,30,2,21,20,14,2,7,21,30,3,21,21,51,17,35,3,236,187,56,103,149,93,
+191,176,92,142,97,50,37,68,95,58,110,169,75,92,38,98,116,131,71,109,166,113,
+57,51,91,125,75,87,138,94,50,176,176,1,160,67,100,65,32,151,39,72,100,62,
+54,83,58,30,67,54,125,31,54,41,24,54,97,133,79,74,119,88,57,12,6,11,57,89,
+119,72,250,253,217,0,1,0,80,254,131,3,242,4,94,0,45,0,141,64,26,12,70,29,
+34,29,6,29,6,29,19,0,71,41,41,45,71,32,42,48,42,64,42,96,42,4,42,184,255,
+192,64,14,15,19,72,42,42,47,192,47,208,47,224,47,3,19,184,255,192,64,45,18,
+21,72,95,19,1,19,19,46,43,251,34,5,80,223,6,1,153,6,169,6,2,79,6,95,6,2,11,
+6,27,6,2,7,6,6,0,18,15,80,24,16,41,80,0,21,0,63,225,63,225,51,18,57,47,94,
+93,93,93,93,233,57,63,17,1,51,47,93,43,93,17,51,47,43,93,225,50,47,225,18,
+57,57,47,47,18,57,16,225,49,48,33,17,52,38,35,35,53,51,50,62,2,53,52,38,35,
+34,6,7,39,62,3,51,50,30,2,21,20,14,2,7,21,30,3,21,21,51,17,35,17,2,156,129,
+138,129,97,61,100,72,39,115,108,71,129,75,63,40,77,82,90,53,86,144,105,58,
+28,51,70,43,44,82,63,38,160,183,1,43,94,101,153,18,39,64,45,77,77,38,34,147,
+19,29,19,9,38,74,109,70,50,77,59,41,14,11,14,44,66,91,61,145,253,233,1,125,
+0,0,1,0,0,255,233,6,236,5,182,0,49,0,146,64,101,215,6,231,6,2,6,7,1,1,215,
+1,247,1,2,1,90,28,23,16,16,24,72,139,23,1,23,16,7,14,72,23,28,49,90,30,176,
+30,1,224,28,1,180,28,196,28,212,28,3,0,28,80,28,144,28,160,28,4,7,28,30,28,
+30,14,36,90,39,101,51,79,51,111,51,127,51,159,51,175,51,223,51,6,32,51,1,
+15,51,1,14,37,37,18,1,95,28,3,33,18,96,44,11,19,0,63,51,225,50,63,225,18,
+57,47,1,47,93,93,93,16,246,225,17,57,57,47,47,94,93,93,93,93,16,225,17,51,
+43,93,43,16,225,93,113,50,93,49,48,1,33,14,3,7,14,3,35,34,38,39,53,22,22,
+51,50,62,2,55,54,54,18,18,55,33,17,20,22,51,50,54,53,17,51,17,20,14,2,35,
+34,46,2,53,3,217,254,133,15,32,33,33,16,20,53,79,110,78,35,74,28,23,58,32,
+48,62,42,26,12,12,32,39,43,22,2,208,99,110,111,98,183,56,102,145,89,87,146,
+104,58,5,18,113,245,235,212,81,103,162,111,59,14,11,154,13,16,63,98,117,54,
+57,200,1,6,1,58,170,251,209,129,119,119,129,1,201,254,45,105,152,98,46,44,
+96,153,108,0,0,1,0,16,255,236,6,0,4,74,0,40,0,92,64,57,1,70,17,40,71,19,160,
+19,1,219,17,1,196,17,1,144,17,160,17,2,36,17,1,16,17,1,17,19,17,19,9,27,71,
+30,85,42,127,42,207,42,239,42,3,9,28,28,12,1,80,17,15,24,12,79,35,6,22,0,
+63,51,225,50,63,225,18,57,47,1,47,93,16,246,225,17,57,57,47,47,93,93,93,93,
+93,93,16,225,16,225,49,48,1,33,2,2,6,6,35,34,38,39,53,22,51,50,54,54,18,55,
+33,17,20,30,2,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,2,250,254,254,20,
+64,95,130,86,28,49,16,22,28,55,89,69,51,18,2,84,21,49,80,59,105,96,182,47,
+95,143,96,92,145,102,54,3,176,254,253,254,148,230,105,6,6,131,6,117,241,1,
+111,250,253,61,65,98,65,32,130,130,1,53,254,193,105,152,98,46,46,98,150,105,
+0,0,1,0,199,255,236,7,45,5,182,0,29,0,92,64,55,27,19,90,160,0,1,0,0,23,6,
+90,9,101,31,192,31,1,175,31,191,31,2,32,31,1,15,31,1,26,22,90,23,100,30,21,
+95,26,7,7,15,26,1,8,26,26,23,28,24,3,23,18,3,95,14,19,0,63,225,63,63,51,18,
+57,47,94,93,51,47,16,225,1,16,246,225,50,93,93,93,93,16,246,225,17,57,47,
+93,225,50,49,48,1,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,33,
+17,35,17,51,17,33,17,51,4,213,98,111,110,99,182,56,102,144,89,88,145,104,
+58,253,102,186,186,2,154,186,1,135,129,119,119,129,1,201,254,45,105,152,98,
+46,44,96,153,108,1,45,253,86,5,182,253,152,2,104,0,1,0,174,255,236,6,139,
+4,74,0,31,0,108,64,71,2,26,71,5,5,30,13,71,16,85,33,0,33,32,33,2,64,33,80,
+33,128,33,144,33,176,33,240,33,6,15,33,1,1,29,71,30,84,32,28,80,1,14,14,235,
+1,1,169,1,185,1,2,15,1,31,1,47,1,3,6,1,1,30,3,31,15,30,21,10,80,21,22,0,63,
+225,63,63,51,18,57,47,94,93,93,93,51,47,16,225,1,16,246,225,50,93,93,113,
+16,246,225,17,57,47,225,50,49,48,1,17,33,17,51,17,20,30,2,51,50,54,53,17,
+51,17,20,14,2,35,34,46,2,53,53,33,17,35,17,1,100,2,33,182,21,49,80,59,106,
+95,182,47,95,143,96,91,146,102,54,253,223,182,4,74,254,57,1,199,253,61,65,
+98,65,32,130,130,1,53,254,193,105,152,98,46,46,98,150,105,110,254,23,4,74,
+0,0,1,0,125,255,236,5,82,5,203,0,42,0,71,64,41,42,42,12,41,91,1,20,64,9,14,
+72,20,20,1,103,44,191,44,1,112,44,1,31,91,12,102,43,42,95,0,0,36,26,95,21,
+17,4,36,95,7,19,0,63,225,63,51,225,18,57,47,225,1,16,246,225,93,93,16,230,
+50,47,43,16,225,18,57,47,49,48,1,33,21,20,2,6,6,35,34,38,38,2,53,52,18,54,
+36,51,50,22,23,7,46,3,35,34,14,2,21,20,30,2,51,50,62,2,53,33,3,23,2,59,66,
+142,222,156,157,242,166,86,95,182,1,11,171,111,204,88,72,36,83,88,93,46,122,
+188,127,66,54,112,171,117,108,149,93,41,254,136,2,246,86,168,254,254,175,
+91,105,195,1,23,174,172,1,22,195,105,44,42,162,17,30,23,14,81,152,218,137,
+130,216,156,86,66,119,166,100,0,1,0,113,255,236,4,123,4,94,0,40,0,129,64,
+90,40,40,12,39,71,1,20,64,12,17,72,20,20,1,87,42,20,42,36,42,2,228,42,244,
+42,2,208,42,1,2,64,42,80,42,128,42,160,42,192,42,5,29,72,12,86,41,40,80,0,
+64,21,25,72,203,0,219,0,235,0,3,169,0,185,0,2,143,0,159,0,2,11,0,27,0,43,
+0,3,6,0,0,34,24,80,21,17,16,34,80,7,22,0,63,225,63,51,225,18,57,47,94,93,
+93,93,93,43,225,1,16,246,225,93,95,93,93,113,16,230,50,47,43,16,225,18,57,
+47,49,48,1,33,21,20,14,2,35,34,46,2,53,52,62,2,51,50,22,23,7,38,38,35,34,
+14,2,21,20,30,2,51,50,62,2,53,33,2,123,2,0,57,120,186,129,135,203,136,68,
+76,149,219,143,111,173,77,62,60,148,91,97,149,101,52,41,86,135,94,81,116,
+74,35,254,184,2,74,68,130,200,137,71,79,147,211,132,130,211,148,80,37,39,
+141,29,41,58,109,157,98,93,155,112,62,45,80,112,68,0,0,1,0,20,255,236,4,201,
+5,182,0,25,0,101,64,47,6,90,9,101,27,79,27,127,27,159,27,175,27,4,0,27,1,
+175,24,239,24,2,132,24,1,24,24,0,90,19,64,21,1,15,21,1,8,21,21,87,19,103,
+19,119,19,3,19,184,255,192,64,16,7,10,72,19,25,21,95,22,7,7,22,3,3,95,14,
+19,0,63,225,63,57,47,16,225,50,1,47,43,93,51,47,94,93,93,16,225,50,47,93,
+93,93,93,16,246,225,49,48,1,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,
+53,17,33,53,33,21,33,2,113,98,111,110,98,183,56,102,144,89,88,145,105,58,
+254,94,3,254,254,95,1,135,129,119,119,129,1,201,254,45,105,152,98,46,44,96,
+153,108,3,149,164,164,0,1,0,41,255,236,4,111,4,74,0,27,0,109,64,74,13,71,
+16,85,29,15,29,1,207,29,239,29,255,29,3,48,29,64,29,96,29,3,15,29,31,29,2,
+15,3,1,204,3,1,15,3,191,3,2,6,3,3,5,71,26,96,0,112,0,208,0,3,31,0,1,0,0,0,
+26,16,26,2,26,14,14,1,10,80,21,22,4,0,80,1,15,0,63,225,50,63,225,17,57,47,
+1,47,93,51,47,93,93,16,225,50,47,94,93,93,113,93,93,93,113,16,246,225,49,
+48,19,53,33,21,33,17,20,30,2,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,
+41,3,53,254,193,21,49,80,59,105,95,183,47,95,143,96,92,146,102,54,3,176,154,
+154,253,215,65,98,65,32,130,130,1,53,254,193,105,152,98,46,46,98,150,105,
+2,53,0,1,0,111,255,236,4,12,5,203,0,57,0,93,180,19,91,52,26,0,184,255,192,
+64,46,23,26,72,0,26,0,26,47,10,10,39,59,159,59,1,32,91,47,102,58,52,27,96,
+170,24,1,120,24,1,15,24,1,8,24,24,5,35,96,38,42,19,14,96,11,5,4,0,63,51,225,
+63,51,225,17,57,47,94,93,93,93,225,57,1,16,246,225,93,16,206,50,47,18,57,
+57,47,47,43,18,57,225,49,48,19,52,62,2,51,50,30,2,23,7,38,38,35,34,14,2,21,
+20,30,2,51,51,21,35,34,14,2,21,20,22,51,50,54,55,21,6,6,35,34,46,2,53,52,
+62,2,55,53,46,3,156,59,115,169,109,72,123,105,90,38,92,75,162,103,57,95,68,
+38,44,87,130,87,195,191,93,146,101,53,170,164,108,204,83,83,192,128,128,195,
+131,66,49,95,137,87,74,120,84,45,4,96,79,133,97,54,24,41,54,31,125,54,67,
+30,58,83,54,62,100,72,39,151,33,67,101,67,137,142,49,43,170,38,37,60,111,
+156,96,72,123,94,61,11,6,12,57,88,119,0,0,1,0,92,255,236,3,106,4,94,0,55,
+0,109,180,50,70,30,1,35,184,255,192,64,61,23,26,72,35,1,35,1,24,43,15,57,
+208,57,224,57,240,57,3,143,57,1,64,57,1,5,71,24,86,56,29,2,80,239,55,1,169,
+55,185,55,2,15,55,31,55,47,55,3,6,55,55,10,47,80,44,40,16,10,80,15,19,22,
+0,63,51,225,63,51,225,18,57,47,94,93,93,93,225,57,1,16,246,225,93,93,93,16,
+206,50,17,57,57,47,47,43,18,57,225,49,48,1,21,35,34,6,21,20,30,2,51,50,62,
+2,55,21,6,6,35,34,46,2,53,52,62,2,55,53,46,3,53,52,62,2,51,50,22,23,7,38,
+38,35,34,6,21,20,30,2,51,2,158,129,138,133,41,70,96,55,51,97,87,77,30,60,
+175,115,110,162,107,53,40,67,89,48,43,73,53,30,58,105,144,86,90,162,80,63,
+75,131,71,102,109,38,68,95,57,2,135,153,91,94,51,69,42,18,14,22,30,16,162,
+29,40,48,86,120,71,61,91,64,41,13,11,14,41,59,77,50,70,109,74,38,37,39,147,
+34,38,77,77,45,64,39,18,0,255,255,0,0,254,109,5,47,5,182,2,38,1,181,0,0,1,
+7,3,128,3,184,0,0,0,13,180,1,1,49,49,0,1,16,60,17,53,0,53,0,255,255,0,16,
+254,109,4,76,4,74,2,38,1,213,0,0,1,7,3,129,2,213,0,0,0,13,180,1,1,38,38,0,
+1,16,60,17,53,0,53,0,255,255,0,0,254,152,4,221,5,188,2,38,0,36,0,0,1,7,2,
+103,4,211,0,0,0,19,64,11,2,24,20,39,2,0,21,27,4,7,37,1,43,53,0,43,53,0,255,
+255,0,94,254,152,3,156,4,94,2,38,0,68,0,0,1,7,2,103,4,111,0,0,0,19,64,11,
+2,54,23,39,2,13,51,57,12,34,37,1,43,53,0,43,53,0,255,255,0,0,0,0,4,221,7,
+225,2,38,0,36,0,0,1,7,2,102,4,209,1,82,0,19,64,11,2,27,5,38,2,33,42,21,4,
+7,37,1,43,53,0,43,53,0,255,255,0,94,255,236,3,156,6,143,2,38,0,68,0,0,1,7,
+2,102,4,117,0,0,0,19,64,11,2,57,17,38,2,54,72,51,12,34,37,1,43,53,0,43,53,
+0,255,255,0,0,0,0,4,221,7,209,2,38,0,36,0,0,1,7,3,119,4,203,1,82,0,25,182,
+3,2,21,5,38,3,2,184,255,255,180,29,21,4,7,37,1,43,53,53,0,43,53,53,0,255,
+255,0,94,255,236,4,71,6,127,2,38,0,68,0,0,1,7,3,119,4,137,0,0,0,23,64,13,
+3,2,51,17,38,3,2,51,59,51,12,34,37,1,43,53,53,0,43,53,53,0,255,255,0,0,0,
+0,4,221,7,209,2,38,0,36,0,0,1,7,3,120,4,203,1,82,0,25,182,3,2,29,5,38,3,2,
+184,255,255,180,37,29,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,18,255,236,
+3,156,6,127,2,38,0,68,0,0,1,7,3,120,4,137,0,0,0,23,64,13,3,2,59,17,38,3,2,
+51,67,59,12,34,37,1,43,53,53,0,43,53,53,0,255,255,0,0,0,0,4,221,8,74,2,38,
+0,36,0,0,1,7,3,121,4,203,1,82,0,25,182,3,2,21,5,38,3,2,184,255,255,180,29,
+21,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,94,255,236,4,6,6,248,2,38,0,68,
+0,0,1,7,3,121,4,137,0,0,0,23,64,13,3,2,51,17,38,3,2,51,59,51,12,34,37,1,43,
+53,53,0,43,53,53,0,255,255,0,0,0,0,4,221,8,98,2,38,0,36,0,0,1,7,3,122,4,203,
+1,82,0,25,182,3,2,29,5,38,3,2,184,255,255,180,37,29,4,7,37,1,43,53,53,0,43,
+53,53,0,255,255,0,94,255,236,3,156,7,16,2,38,0,68,0,0,1,7,3,122,4,137,0,0,
+0,23,64,13,3,2,59,17,38,3,2,11,59,51,12,34,37,1,43,53,53,0,43,53,53,0,255,
+255,0,0,254,152,4,221,7,115,2,38,0,36,0,0,0,39,1,75,0,31,1,82,1,7,2,103,4,
+211,0,0,0,37,64,16,3,45,20,39,2,21,5,38,3,0,42,48,4,7,37,2,184,255,255,180,
+29,21,4,7,37,1,43,53,43,53,0,43,53,43,53,0,255,255,0,94,254,152,3,156,6,33,
+2,38,0,68,0,0,0,38,1,75,212,0,1,7,2,103,4,111,0,0,0,34,64,22,3,75,23,39,2,
+51,17,38,3,13,72,78,12,34,37,2,37,59,51,12,34,37,1,43,53,43,53,0,43,53,43,
+53,255,255,0,0,0,0,4,221,8,19,2,38,0,36,0,0,1,7,3,123,4,203,1,82,0,23,64,
+13,3,2,38,5,38,3,2,0,41,33,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,94,255,
+236,3,156,6,193,2,38,0,68,0,0,1,7,3,123,4,123,0,0,0,23,64,13,3,2,68,17,38,
+3,2,30,71,63,12,34,37,1,43,53,53,0,43,53,53,0,255,255,0,0,0,0,4,221,8,19,
+2,38,0,36,0,0,1,7,3,124,4,203,1,82,0,23,64,13,3,2,38,5,38,3,2,0,41,33,4,7,
+37,1,43,53,53,0,43,53,53,0,255,255,0,94,255,236,3,156,6,193,2,38,0,68,0,0,
+1,7,3,124,4,123,0,0,0,23,64,13,3,2,68,17,38,3,2,30,71,63,12,34,37,1,43,53,
+53,0,43,53,53,0,255,255,0,0,0,0,4,221,8,88,2,38,0,36,0,0,1,7,3,125,4,203,
+1,82,0,23,64,13,3,2,26,5,38,3,2,0,29,21,4,7,37,1,43,53,53,0,43,53,53,0,255,
+255,0,94,255,236,3,156,7,6,2,38,0,68,0,0,1,7,3,125,4,123,0,0,0,23,64,13,3,
+2,56,17,38,3,2,30,59,51,12,34,37,1,43,53,53,0,43,53,53,0,255,255,0,0,0,0,
+4,221,8,98,2,38,0,36,0,0,1,7,3,126,4,203,1,82,0,23,64,13,3,2,26,5,38,3,2,
+0,29,21,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,94,255,236,3,156,7,16,2,
+38,0,68,0,0,1,7,3,126,4,123,0,0,0,23,64,13,3,2,56,17,38,3,2,30,80,94,12,34,
+37,1,43,53,53,0,43,53,53,0,255,255,0,0,254,152,4,221,7,91,2,38,0,36,0,0,0,
+39,1,78,0,33,1,109,1,7,2,103,4,211,0,0,0,34,64,22,3,46,20,39,2,26,5,38,3,
+0,43,49,4,7,37,2,0,31,21,4,7,37,1,43,53,43,53,0,43,53,43,53,255,255,0,94,
+254,152,3,156,5,238,2,38,0,68,0,0,0,38,1,78,212,0,1,7,2,103,4,111,0,0,0,34,
+64,22,3,76,23,39,2,56,17,38,3,13,73,79,12,34,37,2,30,61,51,12,34,37,1,43,
+53,43,53,0,43,53,43,53,255,255,0,199,254,152,3,190,5,182,2,38,0,40,0,0,1,
+7,2,103,4,170,0,0,0,19,64,11,1,15,20,39,1,3,12,18,1,0,37,1,43,53,0,43,53,
+0,255,255,0,113,254,152,3,225,4,94,2,38,0,72,0,0,1,7,2,103,4,190,0,0,0,19,
+64,11,2,43,23,39,2,48,40,46,5,15,37,1,43,53,0,43,53,0,255,255,0,199,0,0,3,
+190,7,225,2,38,0,40,0,0,1,7,2,102,4,145,1,82,0,19,64,11,1,18,5,38,1,13,33,
+12,1,0,37,1,43,53,0,43,53,0,255,255,0,113,255,236,3,225,6,143,2,38,0,72,0,
+0,1,7,2,102,4,152,0,0,0,19,64,11,2,46,17,38,2,45,61,40,5,15,37,1,43,53,0,
+43,53,0,255,255,0,199,0,0,3,190,7,53,2,38,0,40,0,0,1,7,1,82,255,212,1,82,
+0,21,180,1,20,5,38,1,184,255,251,180,21,35,1,0,37,1,43,53,0,43,53,0,255,255,
+0,113,255,236,3,225,5,227,2,38,0,72,0,0,1,6,1,82,222,0,0,19,64,11,2,48,17,
+38,2,30,49,63,5,15,37,1,43,53,0,43,53,0,255,255,0,199,0,0,4,92,7,209,2,38,
+0,40,0,0,1,7,3,119,4,158,1,82,0,25,182,2,1,12,5,38,2,1,184,255,253,180,20,
+12,1,0,37,1,43,53,53,0,43,53,53,0,255,255,0,113,255,236,4,71,6,127,2,38,0,
+72,0,0,1,7,3,119,4,137,0,0,0,23,64,13,3,2,40,17,38,3,2,3,48,40,5,15,37,1,
+43,53,53,0,43,53,53,0,255,255,0,39,0,0,3,190,7,209,2,38,0,40,0,0,1,7,3,120,
+4,158,1,82,0,25,182,2,1,20,5,38,2,1,184,255,253,180,28,20,1,0,37,1,43,53,
+53,0,43,53,53,0,255,255,0,18,255,236,3,225,6,127,2,38,0,72,0,0,1,7,3,120,
+4,137,0,0,0,23,64,13,3,2,48,17,38,3,2,3,56,48,5,15,37,1,43,53,53,0,43,53,
+53,0,255,255,0,199,0,0,4,27,8,74,2,38,0,40,0,0,1,7,3,121,4,158,1,82,0,25,
+182,2,1,12,5,38,2,1,184,255,253,180,20,12,1,0,37,1,43,53,53,0,43,53,53,0,
+255,255,0,113,255,236,4,6,6,248,2,38,0,72,0,0,1,7,3,121,4,137,0,0,0,23,64,
+13,3,2,40,17,38,3,2,3,48,40,5,15,37,1,43,53,53,0,43,53,53,0,255,255,0,199,
+0,0,3,190,8,98,2,38,0,40,0,0,1,7,3,122,4,158,1,82,0,25,182,2,1,20,5,38,2,
+1,184,255,253,180,28,20,1,0,37,1,43,53,53,0,43,53,53,0,255,255,0,113,255,
+236,3,225,7,16,2,38,0,72,0,0,1,7,3,122,4,137,0,0,0,23,64,13,3,2,48,17,38,
+3,2,3,56,48,5,15,37,1,43,53,53,0,43,53,53,0,255,255,0,199,254,152,3,190,7,
+115,2,38,0,40,0,0,0,39,1,75,255,241,1,82,1,7,2,103,4,170,0,0,0,37,64,16,2,
+36,20,39,1,12,5,38,2,3,33,39,1,0,37,1,184,255,253,180,20,12,1,0,37,1,43,53,
+43,53,0,43,53,43,53,0,255,255,0,113,254,152,3,225,6,33,2,38,0,72,0,0,0,38,
+1,75,222,0,1,7,2,103,4,170,0,0,0,34,64,22,3,64,23,39,2,40,17,38,3,28,61,67,
+5,15,37,2,3,48,40,5,15,37,1,43,53,43,53,0,43,53,43,53,255,255,0,82,0,0,2,
+100,7,225,2,38,0,44,0,0,1,7,2,102,3,176,1,82,0,19,64,11,1,18,5,38,1,19,33,
+12,1,0,37,1,43,53,0,43,53,0,255,255,0,98,0,0,1,215,6,143,2,38,0,243,0,0,1,
+7,2,102,3,94,0,0,0,19,64,11,1,10,17,38,1,19,25,4,1,0,37,1,43,53,0,43,53,0,
+255,255,0,82,254,152,2,100,5,182,2,38,0,44,0,0,1,7,2,103,3,190,0,0,0,21,180,
+1,15,20,39,1,184,255,255,180,12,18,1,0,37,1,43,53,0,43,53,0,255,255,0,158,
+254,152,1,117,5,229,2,38,0,76,0,0,1,7,2,103,3,109,0,0,0,21,180,2,21,23,39,
+2,184,255,254,180,18,24,4,12,37,1,43,53,0,43,53,0,255,255,0,125,254,152,5,
+113,5,205,2,38,0,50,0,0,1,7,2,103,5,92,0,0,0,19,64,11,2,43,20,39,2,0,40,46,
+10,0,37,1,43,53,0,43,53,0,255,255,0,113,254,152,4,45,4,94,2,38,0,82,0,0,1,
+7,2,103,4,178,0,0,0,21,180,2,35,23,39,2,184,255,255,180,32,38,10,0,37,1,43,
+53,0,43,53,0,255,255,0,125,255,236,5,113,7,225,2,38,0,50,0,0,1,7,2,102,5,
+78,1,82,0,19,64,11,2,46,5,38,2,21,61,40,10,0,37,1,43,53,0,43,53,0,255,255,
+0,113,255,236,4,45,6,143,2,38,0,82,0,0,1,7,2,102,4,164,0,0,0,19,64,11,2,38,
+17,38,2,19,53,32,10,0,37,1,43,53,0,43,53,0,255,255,0,125,255,236,5,113,7,
+209,2,38,0,50,0,0,1,7,3,119,5,88,1,82,0,23,64,13,3,2,40,5,38,3,2,5,48,40,
+10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,113,255,236,4,104,6,127,2,38,0,
+82,0,0,1,7,3,119,4,170,0,0,0,25,182,3,2,32,17,38,3,2,184,255,250,180,40,32,
+10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,125,255,236,5,113,7,209,2,38,0,
+50,0,0,1,7,3,120,5,88,1,82,0,23,64,13,3,2,48,5,38,3,2,5,56,48,10,0,37,1,43,
+53,53,0,43,53,53,0,255,255,0,51,255,236,4,45,6,127,2,38,0,82,0,0,1,7,3,120,
+4,170,0,0,0,25,182,3,2,40,17,38,3,2,184,255,250,180,48,40,10,0,37,1,43,53,
+53,0,43,53,53,0,255,255,0,125,255,236,5,113,8,74,2,38,0,50,0,0,1,7,3,121,
+5,88,1,82,0,23,64,13,3,2,40,5,38,3,2,5,48,40,10,0,37,1,43,53,53,0,43,53,53,
+0,255,255,0,113,255,236,4,45,6,248,2,38,0,82,0,0,1,7,3,121,4,170,0,0,0,25,
+182,3,2,32,17,38,3,2,184,255,250,180,40,32,10,0,37,1,43,53,53,0,43,53,53,
+0,255,255,0,125,255,236,5,113,8,98,2,38,0,50,0,0,1,7,3,122,5,88,1,82,0,23,
+64,13,3,2,48,5,38,3,2,5,56,48,10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,113,
+255,236,4,45,7,16,2,38,0,82,0,0,1,7,3,122,4,170,0,0,0,25,182,3,2,40,17,38,
+3,2,184,255,250,180,48,40,10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,125,254,
+152,5,113,7,115,2,38,0,50,0,0,0,39,1,75,0,174,1,82,1,7,2,103,5,92,0,0,0,34,
+64,22,3,64,20,39,2,40,5,38,3,0,61,67,10,0,37,2,5,48,40,10,0,37,1,43,53,43,
+53,0,43,53,43,53,255,255,0,113,254,152,4,45,6,33,2,38,0,82,0,0,0,38,1,75,
+251,0,1,7,2,103,4,178,0,0,0,40,64,9,3,56,23,39,2,32,17,38,3,184,255,255,181,
+53,59,10,0,37,2,184,255,250,180,40,32,10,0,37,1,43,53,43,53,0,43,53,43,53,
+255,255,0,125,255,236,6,37,7,115,2,38,2,95,0,0,1,7,0,118,1,6,1,82,0,19,64,
+11,2,65,5,38,2,2,53,59,19,1,37,1,43,53,0,43,53,0,255,255,0,113,255,236,4,
+244,6,33,2,38,2,96,0,0,1,6,0,118,80,0,0,21,180,2,58,17,38,2,184,255,235,180,
+45,51,10,25,37,1,43,53,0,43,53,0,255,255,0,125,255,236,6,37,7,115,2,38,2,
+95,0,0,1,7,0,67,0,84,1,82,0,21,180,2,53,5,38,2,184,255,81,180,59,53,19,1,
+37,1,43,53,0,43,53,0,255,255,0,113,255,236,4,244,6,33,2,38,2,96,0,0,1,6,0,
+67,216,0,0,21,180,2,46,17,38,2,184,255,215,180,52,45,10,0,37,1,43,53,0,43,
+53,0,255,255,0,125,255,236,6,37,7,225,2,38,2,95,0,0,1,7,2,102,5,78,1,82,0,
+21,180,2,60,5,38,2,184,255,188,180,74,53,19,1,37,1,43,53,0,43,53,0,255,255,
+0,113,255,236,4,244,6,143,2,38,2,96,0,0,1,7,2,102,4,164,0,0,0,21,180,2,52,
+17,38,2,184,255,176,180,66,45,10,25,37,1,43,53,0,43,53,0,255,255,0,125,255,
+236,6,37,7,53,2,38,2,95,0,0,1,7,1,82,0,125,1,82,0,21,180,2,61,5,38,2,184,
+255,150,180,62,76,19,1,37,1,43,53,0,43,53,0,255,255,0,113,255,236,4,244,5,
+227,2,38,2,96,0,0,1,6,1,82,226,0,0,21,180,2,45,17,38,2,184,255,253,180,54,
+68,10,0,37,1,43,53,0,43,53,0,255,255,0,125,254,152,6,37,6,20,2,38,2,95,0,
+0,1,7,2,103,5,92,0,0,0,21,180,2,56,20,39,2,184,255,167,180,53,59,19,1,37,
+1,43,53,0,43,53,0,255,255,0,113,254,152,4,244,4,242,2,38,2,96,0,0,1,7,2,103,
+4,178,0,0,0,21,180,2,48,23,39,2,184,255,155,180,45,51,10,25,37,1,43,53,0,
+43,53,0,255,255,0,184,254,152,4,221,5,184,2,38,0,56,0,0,1,7,2,103,5,47,0,
+0,0,19,64,11,1,27,20,39,1,0,24,30,11,0,37,1,43,53,0,43,53,0,255,255,0,164,
+254,152,4,8,4,74,2,38,0,88,0,0,1,7,2,103,4,184,0,0,0,21,180,1,30,23,39,1,
+184,255,254,180,27,33,12,25,37,1,43,53,0,43,53,0,255,255,0,184,255,236,4,
+221,7,225,2,38,0,56,0,0,1,7,2,102,5,29,1,82,0,19,64,11,1,30,5,38,1,17,45,
+24,11,0,37,1,43,53,0,43,53,0,255,255,0,164,255,236,4,8,6,143,2,38,0,88,0,
+0,1,7,2,102,4,166,0,0,0,19,64,11,1,33,17,38,1,14,48,27,12,25,37,1,43,53,0,
+43,53,0,255,255,0,184,255,236,6,78,7,115,2,38,2,97,0,0,1,7,0,118,0,197,1,
+82,0,21,180,1,49,5,38,1,184,255,144,180,37,43,24,8,37,1,43,53,0,43,53,0,255,
+255,0,164,255,236,5,121,6,33,2,38,2,98,0,0,1,6,0,118,96,0,0,17,177,1,1,184,
+255,159,180,40,46,12,33,37,1,43,53,0,53,0,255,255,0,184,255,236,6,78,7,115,
+2,38,2,97,0,0,1,7,0,67,0,61,1,82,0,21,180,1,37,5,38,1,184,255,8,180,43,37,
+24,8,37,1,43,53,0,43,53,0,255,255,0,164,255,236,5,121,6,33,2,38,2,98,0,0,
+1,6,0,67,163,0,0,17,177,1,1,184,254,226,180,46,40,12,33,37,1,43,53,0,53,0,
+255,255,0,184,255,236,6,78,7,225,2,38,2,97,0,0,1,7,2,102,5,29,1,82,0,17,177,
+1,1,184,255,89,180,58,37,24,8,37,1,43,53,0,53,0,255,255,0,164,255,236,5,121,
+6,143,2,38,2,98,0,0,1,7,2,102,4,166,0,0,0,17,177,1,1,184,255,86,180,61,40,
+12,33,37,1,43,53,0,53,0,255,255,0,184,255,236,6,78,7,53,2,38,2,97,0,0,1,7,
+1,82,0,96,1,82,0,21,180,1,45,5,38,1,184,255,71,180,46,60,24,8,37,1,43,53,
+0,43,53,0,255,255,0,164,255,236,5,121,5,227,2,38,2,98,0,0,1,6,1,82,243,0,
+0,17,177,1,1,184,255,78,180,49,63,12,33,37,1,43,53,0,53,0,255,255,0,184,254,
+152,6,78,6,20,2,38,2,97,0,0,1,7,2,103,5,47,0,0,0,21,180,1,40,20,39,1,184,
+255,72,180,37,43,24,8,37,1,43,53,0,43,53,0,255,255,0,164,254,152,5,121,4,
+242,2,38,2,98,0,0,1,7,2,103,4,184,0,0,0,21,180,1,43,23,39,1,184,255,69,180,
+40,46,12,33,37,1,43,53,0,43,53,0,255,255,0,0,254,152,4,55,5,182,2,38,0,60,
+0,0,1,7,2,103,4,127,0,0,0,21,180,1,12,20,39,1,184,255,255,180,9,15,7,2,37,
+1,43,53,0,43,53,0,255,255,0,10,254,20,3,223,4,74,2,38,0,92,0,0,1,7,2,103,
+5,139,0,0,0,17,177,1,1,184,1,50,180,35,41,0,15,37,1,43,53,0,53,0,255,255,
+0,0,0,0,4,55,7,225,2,38,0,60,0,0,1,7,2,102,4,113,1,82,0,19,64,11,1,15,5,38,
+1,20,30,9,7,2,37,1,43,53,0,43,53,0,255,255,0,10,254,20,3,223,6,143,2,38,0,
+92,0,0,1,7,2,102,4,74,0,0,0,19,64,11,1,41,17,38,1,20,56,35,0,15,37,1,43,53,
+0,43,53,0,255,255,0,0,0,0,4,55,7,53,2,38,0,60,0,0,1,7,1,82,255,179,1,82,0,
+19,64,11,1,17,5,38,1,1,18,32,7,2,37,1,43,53,0,43,53,0,255,255,0,10,254,20,
+3,223,5,227,2,38,0,92,0,0,1,6,1,82,140,0,0,19,64,11,1,43,17,38,1,1,44,58,
+0,15,37,1,43,53,0,43,53,0,255,255,0,113,254,188,4,158,6,20,2,38,0,211,0,0,
+1,7,0,66,0,180,0,0,0,14,185,0,2,255,210,180,58,57,11,35,37,1,43,53,0,2,251,
+219,4,217,254,186,6,33,0,13,0,27,0,45,64,25,20,14,14,7,64,80,0,1,63,0,79,
+0,2,0,21,7,146,128,15,15,1,95,1,2,1,0,47,93,51,26,237,50,1,47,93,93,26,205,
+57,47,205,49,48,1,35,46,3,39,53,51,30,3,23,5,35,46,3,39,53,51,30,3,23,254,
+186,100,35,81,77,63,16,198,16,42,47,48,21,254,150,100,35,82,77,63,16,199,
+16,42,47,48,21,4,217,28,83,88,81,27,21,35,80,81,76,29,27,28,83,88,81,27,21,
+35,80,81,76,29,0,2,252,106,4,217,255,190,6,127,0,16,0,28,0,82,64,49,13,12,
+4,16,23,1,23,64,47,28,63,28,79,28,3,28,4,4,28,47,0,95,0,143,0,159,0,4,0,192,
+8,22,27,27,4,127,12,143,12,2,12,128,0,15,8,95,8,2,8,0,47,93,51,26,204,93,
+50,57,47,205,1,47,26,204,93,57,57,61,47,24,47,93,26,205,93,17,51,51,49,48,
+1,35,38,38,39,6,6,7,35,53,54,54,55,51,22,22,23,39,62,3,55,51,21,6,6,7,35,
+254,217,100,51,108,52,54,106,51,101,51,117,48,192,48,116,51,78,20,33,29,29,
+16,180,45,106,55,101,4,217,34,84,48,48,84,34,27,59,132,69,69,132,59,194,25,
+45,46,52,33,21,60,103,43,0,2,251,137,4,217,254,221,6,127,0,16,0,28,0,74,64,
+42,4,3,12,31,22,1,22,64,28,12,12,28,47,8,95,8,143,8,159,8,4,8,192,0,22,18,
+18,12,127,3,143,3,2,3,128,16,15,8,95,8,2,8,0,47,93,51,26,205,93,50,57,47,
+205,1,47,26,204,93,57,57,61,47,24,47,26,205,93,17,51,51,49,48,1,54,54,55,
+51,22,22,23,21,35,38,38,39,6,6,7,35,55,35,38,38,39,53,51,30,3,23,252,111,
+51,116,48,192,48,116,51,100,51,106,54,53,107,51,100,77,100,56,106,45,180,
+16,29,30,32,20,4,244,59,132,69,69,132,59,27,34,84,48,48,84,34,195,43,103,
+60,21,33,52,46,45,25,0,2,252,106,4,217,255,125,6,248,0,16,0,40,0,94,64,56,
+22,25,25,32,6,14,72,25,28,17,128,47,35,63,35,79,35,3,35,4,4,35,47,0,95,0,
+143,0,159,0,4,0,192,8,22,25,25,31,38,24,24,4,127,12,143,12,2,12,128,0,15,
+8,95,8,2,8,0,47,93,51,26,204,93,50,57,47,204,50,57,17,51,1,47,26,204,93,57,
+57,61,47,24,47,93,26,205,50,57,43,17,51,49,48,1,35,38,38,39,6,6,7,35,53,54,
+54,55,51,22,22,23,19,20,14,2,7,7,35,39,54,54,53,52,38,35,34,6,7,53,54,54,
+51,50,22,254,217,100,51,108,52,54,106,51,101,51,117,48,192,48,116,51,164,
+20,34,46,25,6,86,10,55,65,57,43,22,39,11,11,38,31,99,100,4,217,34,84,48,48,
+84,34,27,59,132,69,69,132,59,1,118,29,43,30,21,6,81,131,9,31,37,37,25,3,3,
+82,3,3,69,0,2,252,100,4,217,254,233,7,16,0,16,0,44,0,97,64,59,4,3,12,12,0,
+40,40,47,8,95,8,143,8,159,8,4,8,0,192,26,26,0,39,22,142,207,31,223,31,239,
+31,3,31,64,9,13,72,31,31,36,142,25,17,17,12,127,3,143,3,2,3,128,16,15,8,95,
+8,2,8,0,47,93,51,26,205,93,50,50,47,51,225,51,47,43,93,225,51,1,47,51,47,
+26,16,204,93,50,47,17,57,61,47,51,51,49,48,1,54,54,55,51,22,22,23,21,35,38,
+38,39,6,6,7,35,1,34,46,2,35,34,6,7,35,62,3,51,50,30,2,51,50,54,55,51,14,3,
+252,111,51,116,48,192,48,116,51,100,51,106,54,53,107,51,100,1,190,36,71,69,
+64,28,40,42,14,93,5,29,48,65,42,37,74,69,62,26,40,42,14,92,5,28,48,65,4,244,
+59,132,69,69,132,59,27,34,84,48,48,84,34,1,90,28,34,28,42,50,48,81,59,33,
+28,34,28,43,49,48,81,59,33,0,0,2,252,115,4,217,254,205,6,193,0,11,0,31,0,
+50,64,25,6,128,11,11,31,47,12,1,12,192,21,20,5,11,11,31,20,128,26,15,17,95,
+17,2,17,0,47,93,51,26,205,50,50,47,204,1,47,51,26,204,93,50,57,47,26,205,
+49,48,1,62,3,55,51,21,6,6,7,35,37,14,3,35,34,38,39,51,30,3,51,50,62,2,55,
+253,94,20,32,30,29,16,180,45,106,55,101,1,111,5,43,77,110,70,146,145,6,108,
+4,27,48,68,44,36,65,51,33,5,5,248,25,44,46,53,33,21,60,103,44,6,60,99,69,
+38,140,126,43,50,25,7,9,27,49,40,0,2,252,115,4,217,254,205,6,193,0,11,0,31,
+0,56,64,30,5,128,11,64,19,22,72,11,11,31,47,12,1,12,192,21,20,5,0,0,31,20,
+128,26,15,17,95,17,2,17,0,47,93,51,26,205,50,50,47,205,1,47,51,26,204,93,
+50,57,47,43,26,205,49,48,1,35,38,38,39,53,51,30,3,23,23,14,3,35,34,38,39,
+51,30,3,51,50,62,2,55,253,209,100,56,106,45,180,16,29,30,32,20,252,5,43,77,
+110,70,146,145,6,108,4,27,48,68,44,36,65,51,33,5,5,221,44,103,60,21,33,53,
+46,44,25,21,60,99,69,38,140,126,43,50,25,7,9,27,49,40,0,0,2,252,115,4,217,
+254,205,7,6,0,19,0,42,0,66,64,33,25,28,28,31,20,128,37,37,19,47,0,1,0,9,8,
+25,28,28,34,40,192,27,27,19,8,128,14,15,5,95,5,2,5,0,47,93,51,26,205,50,57,
+47,26,204,50,57,17,51,1,47,51,204,93,50,57,47,26,204,50,57,17,51,49,48,1,
+14,3,35,34,38,39,51,30,3,51,50,62,2,55,39,20,14,2,7,7,35,39,54,54,53,52,38,
+35,34,6,7,53,54,51,50,22,254,205,5,43,77,110,70,146,145,6,108,4,27,48,68,
+44,36,65,51,33,5,43,20,34,46,25,6,86,10,56,65,57,44,21,39,11,21,58,100,99,
+5,227,60,99,69,38,140,126,43,50,25,7,9,27,49,40,150,29,43,31,20,6,41,90,9,
+32,37,37,24,3,3,82,6,69,0,0,2,252,100,4,217,254,233,7,16,0,19,0,47,0,72,64,
+39,28,29,29,8,42,43,43,19,47,0,1,0,192,9,8,42,25,207,34,223,34,239,34,3,34,
+39,28,20,20,19,8,128,14,15,5,95,5,2,5,0,47,93,51,26,205,50,50,47,51,51,205,
+93,50,50,1,47,51,26,204,93,50,50,47,51,17,51,47,51,49,48,1,14,3,35,34,38,
+39,51,30,3,51,50,62,2,55,39,34,46,2,35,34,6,7,35,62,3,51,50,30,2,51,50,54,
+55,51,14,3,254,205,5,43,77,110,70,146,145,6,108,4,27,48,68,44,36,65,51,33,
+5,47,36,71,69,64,28,40,42,14,93,5,29,48,65,42,37,74,69,62,26,40,42,14,92,
+5,28,48,65,5,227,60,99,69,38,140,126,43,50,25,7,9,27,49,40,80,28,34,28,42,
+50,48,81,59,33,28,34,28,43,49,48,81,59,33,0,0,1,0,49,254,66,1,113,0,0,0,20,
+0,24,64,9,15,128,0,8,8,2,18,11,2,0,47,47,51,1,47,51,47,51,26,204,49,48,23,
+52,39,51,30,3,21,20,6,35,34,38,39,53,22,22,51,50,54,219,139,129,26,57,47,
+30,101,100,29,64,26,14,45,25,34,52,238,105,133,19,52,64,75,42,90,104,8,8,
+113,4,5,43,0,1,0,16,254,109,1,119,0,166,0,17,0,18,182,9,1,16,13,6,250,0,0,
+47,63,51,1,47,51,196,49,48,37,17,14,3,35,34,38,39,53,22,22,51,50,54,53,17,
+1,119,1,26,57,89,63,38,63,22,14,59,34,46,50,166,254,217,66,102,70,36,17,9,
+150,7,14,49,49,1,60,0,0,1,0,16,254,109,1,119,0,154,0,17,0,18,182,9,1,16,13,
+6,250,0,0,47,63,51,1,47,51,196,49,48,37,17,14,3,35,34,38,39,53,22,22,51,50,
+54,53,17,1,119,1,26,57,89,63,38,63,22,14,59,34,46,50,154,254,229,66,102,70,
+36,17,9,150,7,14,49,49,1,48,0,0,2,0,113,254,20,4,2,4,94,0,16,0,62,0,59,64,
+33,45,44,62,6,71,47,85,64,16,64,1,14,72,54,33,86,63,57,80,50,27,46,15,44,
+11,80,38,16,22,0,80,28,22,0,63,225,51,63,225,51,63,63,225,1,16,246,196,225,
+93,16,246,225,50,50,50,49,48,37,50,62,2,55,53,52,46,2,35,34,6,21,20,22,5,
+52,54,55,54,55,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,51,55,51,17,20,
+6,35,34,38,39,53,22,22,51,50,62,2,53,2,53,76,105,65,31,2,27,65,108,81,135,
+127,127,1,160,1,1,1,1,4,23,58,77,96,60,93,154,110,60,60,110,154,93,59,96,
+76,60,23,8,27,147,235,232,119,176,69,69,191,108,70,105,71,35,131,46,94,140,
+95,41,101,157,107,55,218,204,209,205,119,12,45,23,26,29,35,60,46,26,72,143,
+212,140,141,213,144,73,27,45,62,34,148,251,162,238,234,36,34,166,40,46,45,
+80,112,68,255,255,0,20,254,20,4,18,5,182,2,38,0,55,0,0,1,7,0,122,1,34,0,0,
+0,11,182,1,3,27,28,1,0,37,1,43,53,0,255,255,0,33,254,20,2,143,5,70,2,38,0,
+87,0,0,1,7,0,122,0,190,0,0,0,14,185,0,1,255,246,180,37,30,16,6,37,1,43,53,
+0,0,0,27,1,74,0,1,0,0,0,0,0,0,0,52,0,0,0,1,0,0,0,0,0,1,0,10,0,52,0,1,0,0,
+0,0,0,2,0,7,0,62,0,1,0,0,0,0,0,3,0,21,0,69,0,1,0,0,0,0,0,4,0,10,0,52,0,1,
+0,0,0,0,0,5,0,12,0,90,0,1,0,0,0,0,0,6,0,9,0,102,0,1,0,0,0,0,0,7,0,78,0,111,
+0,1,0,0,0,0,0,8,0,20,0,189,0,1,0,0,0,0,0,10,0,103,0,209,0,1,0,0,0,0,0,13,
+0,46,1,56,0,1,0,0,0,0,0,14,0,42,1,102,0,1,0,0,0,0,0,18,0,10,0,52,0,3,0,1,
+4,9,0,0,0,104,1,144,0,3,0,1,4,9,0,1,0,20,1,248,0,3,0,1,4,9,0,2,0,14,2,12,
+0,3,0,1,4,9,0,3,0,42,2,26,0,3,0,1,4,9,0,4,0,20,1,248,0,3,0,1,4,9,0,5,0,44,
+2,68,0,3,0,1,4,9,0,6,0,18,2,112,0,3,0,1,4,9,0,7,0,156,2,130,0,3,0,1,4,9,0,
+8,0,40,3,30,0,3,0,1,4,9,0,10,0,206,3,70,0,3,0,1,4,9,0,11,0,56,4,20,0,3,0,
+1,4,9,0,12,0,92,4,76,0,3,0,1,4,9,0,13,0,92,4,168,0,3,0,1,4,9,0,14,0,84,5,
+4,68,105,103,105,116,105,122,101,100,32,100,97,116,97,32,99,111,112,121,114,
+105,103,104,116,32,169,32,50,48,48,55,44,32,71,111,111,103,108,101,32,67,
+111,114,112,111,114,97,116,105,111,110,46,68,114,111,105,100,32,83,97,110,
+115,82,101,103,117,108,97,114,65,115,99,101,110,100,101,114,32,45,32,68,114,
+111,105,100,32,83,97,110,115,86,101,114,115,105,111,110,32,49,46,48,48,68,
+114,111,105,100,83,97,110,115,68,114,111,105,100,32,105,115,32,97,32,116,
+114,97,100,101,109,97,114,107,32,111,102,32,71,111,111,103,108,101,32,97,
+110,100,32,109,97,121,32,98,101,32,114,101,103,105,115,116,101,114,101,100,
+32,105,110,32,99,101,114,116,97,105,110,32,106,117,114,105,115,100,105,99,
+116,105,111,110,115,46,65,115,99,101,110,100,101,114,32,67,111,114,112,111,
+114,97,116,105,111,110,68,114,111,105,100,32,83,97,110,115,32,105,115,32,
+97,32,104,117,109,97,110,105,115,116,32,115,97,110,115,32,115,101,114,105,
+102,32,116,121,112,101,102,97,99,101,32,100,101,115,105,103,110,101,100,32,
+102,111,114,32,117,115,101,114,32,105,110,116,101,114,102,97,99,101,115,32,
+97,110,100,32,101,108,101,99,116,114,111,110,105,99,32,99,111,109,109,117,
+110,105,99,97,116,105,111,110,46,76,105,99,101,110,115,101,100,32,117,110,
+100,101,114,32,116,104,101,32,65,112,97,99,104,101,32,76,105,99,101,110,115,
+101,44,32,86,101,114,115,105,111,110,32,50,46,48,104,116,116,112,58,47,47,
+119,119,119,46,97,112,97,99,104,101,46,111,114,103,47,108,105,99,101,110,
+115,101,115,47,76,73,67,69,78,83,69,45,50,46,48,0,68,0,105,0,103,0,105,0,
+116,0,105,0,122,0,101,0,100,0,32,0,100,0,97,0,116,0,97,0,32,0,99,0,111,0,
+112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,169,0,32,0,50,0,48,0,48,0,
+55,0,44,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,67,0,111,0,114,0,112,
+0,111,0,114,0,97,0,116,0,105,0,111,0,110,0,46,0,68,0,114,0,111,0,105,0,100,
+0,32,0,83,0,97,0,110,0,115,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,65,0,
+115,0,99,0,101,0,110,0,100,0,101,0,114,0,32,0,45,0,32,0,68,0,114,0,111,0,
+105,0,100,0,32,0,83,0,97,0,110,0,115,0,86,0,101,0,114,0,115,0,105,0,111,0,
+110,0,32,0,49,0,46,0,48,0,48,0,32,0,98,0,117,0,105,0,108,0,100,0,32,0,49,
+0,49,0,52,0,68,0,114,0,111,0,105,0,100,0,83,0,97,0,110,0,115,0,68,0,114,0,
+111,0,105,0,100,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,
+101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,
+108,0,101,0,32,0,97,0,110,0,100,0,32,0,109,0,97,0,121,0,32,0,98,0,101,0,32,
+0,114,0,101,0,103,0,105,0,115,0,116,0,101,0,114,0,101,0,100,0,32,0,105,0,
+110,0,32,0,99,0,101,0,114,0,116,0,97,0,105,0,110,0,32,0,106,0,117,0,114,0,
+105,0,115,0,100,0,105,0,99,0,116,0,105,0,111,0,110,0,115,0,46,0,65,0,115,
+0,99,0,101,0,110,0,100,0,101,0,114,0,32,0,67,0,111,0,114,0,112,0,111,0,114,
+0,97,0,116,0,105,0,111,0,110,0,68,0,114,0,111,0,105,0,100,0,32,0,83,0,97,
+0,110,0,115,0,32,0,105,0,115,0,32,0,97,0,32,0,104,0,117,0,109,0,97,0,110,
+0,105,0,115,0,116,0,32,0,115,0,97,0,110,0,115,0,32,0,115,0,101,0,114,0,105,
+0,102,0,32,0,116,0,121,0,112,0,101,0,102,0,97,0,99,0,101,0,32,0,100,0,101,
+0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,102,0,111,0,114,0,32,0,117,0,115,
+0,101,0,114,0,32,0,105,0,110,0,116,0,101,0,114,0,102,0,97,0,99,0,101,0,115,
+0,32,0,97,0,110,0,100,0,32,0,101,0,108,0,101,0,99,0,116,0,114,0,111,0,110,
+0,105,0,99,0,32,0,99,0,111,0,109,0,109,0,117,0,110,0,105,0,99,0,97,0,116,
+0,105,0,111,0,110,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,
+0,119,0,46,0,97,0,115,0,99,0,101,0,110,0,100,0,101,0,114,0,99,0,111,0,114,
+0,112,0,46,0,99,0,111,0,109,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,
+119,0,119,0,119,0,46,0,97,0,115,0,99,0,101,0,110,0,100,0,101,0,114,0,99,0,
+111,0,114,0,112,0,46,0,99,0,111,0,109,0,47,0,116,0,121,0,112,0,101,0,100,
+0,101,0,115,0,105,0,103,0,110,0,101,0,114,0,115,0,46,0,104,0,116,0,109,0,
+108,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,
+0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,65,0,112,0,97,0,99,0,104,0,101,
+0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,
+115,0,105,0,111,0,110,0,32,0,50,0,46,0,48,0,104,0,116,0,116,0,112,0,58,0,
+47,0,47,0,119,0,119,0,119,0,46,0,97,0,112,0,97,0,99,0,104,0,101,0,46,0,111,
+0,114,0,103,0,47,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,115,0,47,0,76,
+0,73,0,67,0,69,0,78,0,83,0,69,0,45,0,50,0,46,0,48,0,0,0,2,0,0,0,0,0,0,255,
+102,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,133,0,0,1,2,0,2,0,3,0,
+4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,
+20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,
+0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,
+0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,
+0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,
+0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,
+0,95,0,96,0,97,0,172,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,
+0,157,0,169,0,164,1,3,0,138,1,4,0,131,0,147,0,242,0,243,0,141,0,151,0,136,
+1,5,0,222,0,241,0,158,0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,
+0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,
+0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,
+235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,
+0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,
+124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,1,6,1,7,1,8,1,9,
+1,10,1,11,0,253,0,254,1,12,1,13,1,14,1,15,0,255,1,0,1,16,1,17,1,18,1,19,1,
+20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,0,248,0,249,1,32,
+1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,
+1,48,0,215,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,
+61,1,62,1,63,0,226,0,227,1,64,1,65,1,66,1,67,1,68,1,69,1,70,1,71,1,72,1,73,
+1,74,1,75,1,76,1,77,1,78,0,176,0,177,1,79,1,80,1,81,1,82,1,83,1,84,1,85,1,
+86,1,87,1,88,0,251,0,252,0,228,0,229,1,89,1,90,1,91,1,92,1,93,1,94,1,95,1,
+96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,
+109,1,110,0,187,1,111,1,112,1,113,1,114,0,230,0,231,1,115,0,166,1,116,1,117,
+1,118,1,119,1,120,1,121,1,122,1,123,0,216,0,225,1,124,0,219,0,220,0,221,0,
+224,0,217,0,223,1,125,1,126,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,
+1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,
+147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,
+1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,
+172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,0,155,1,182,1,183,
+1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,
+196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,
+1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,
+221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,
+1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,
+246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,
+2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,
+2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,
+2,35,2,36,2,37,2,38,2,39,2,40,2,41,0,178,0,179,2,42,2,43,0,182,0,183,0,196,
+2,44,0,180,0,181,0,197,0,130,0,194,0,135,0,171,0,198,2,45,2,46,0,190,0,191,
+2,47,0,188,2,48,0,247,2,49,2,50,2,51,2,52,2,53,2,54,0,140,0,159,2,55,2,56,
+2,57,2,58,2,59,0,152,2,60,0,154,0,153,0,239,0,165,0,146,0,156,0,167,0,143,
+0,148,0,149,0,185,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,
+2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,
+2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,
+101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,113,
+2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,
+126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,
+2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,
+151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,
+2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,
+176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,
+2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,2,
+201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,
+2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,
+226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,
+2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,2,
+251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,
+3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,
+3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,
+3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,
+3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,
+3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,
+3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,
+3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,3,111,3,112,3,
+113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,
+3,126,3,127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,
+138,3,139,3,140,3,141,5,46,110,117,108,108,7,117,110,105,48,48,65,68,9,111,
+118,101,114,115,99,111,114,101,14,112,101,114,105,111,100,99,101,110,116,
+101,114,101,100,7,65,109,97,99,114,111,110,7,97,109,97,99,114,111,110,6,65,
+98,114,101,118,101,6,97,98,114,101,118,101,7,65,111,103,111,110,101,107,7,
+97,111,103,111,110,101,107,11,67,99,105,114,99,117,109,102,108,101,120,11,
+99,99,105,114,99,117,109,102,108,101,120,4,67,100,111,116,4,99,100,111,116,
+6,68,99,97,114,111,110,6,100,99,97,114,111,110,6,68,99,114,111,97,116,6,100,
+99,114,111,97,116,7,69,109,97,99,114,111,110,7,101,109,97,99,114,111,110,
+6,69,98,114,101,118,101,6,101,98,114,101,118,101,10,69,100,111,116,97,99,
+99,101,110,116,10,101,100,111,116,97,99,99,101,110,116,7,69,111,103,111,110,
+101,107,7,101,111,103,111,110,101,107,6,69,99,97,114,111,110,6,101,99,97,
+114,111,110,11,71,99,105,114,99,117,109,102,108,101,120,11,103,99,105,114,
+99,117,109,102,108,101,120,4,71,100,111,116,4,103,100,111,116,12,71,99,111,
+109,109,97,97,99,99,101,110,116,12,103,99,111,109,109,97,97,99,99,101,110,
+116,11,72,99,105,114,99,117,109,102,108,101,120,11,104,99,105,114,99,117,
+109,102,108,101,120,4,72,98,97,114,4,104,98,97,114,6,73,116,105,108,100,101,
+6,105,116,105,108,100,101,7,73,109,97,99,114,111,110,7,105,109,97,99,114,
+111,110,6,73,98,114,101,118,101,6,105,98,114,101,118,101,7,73,111,103,111,
+110,101,107,7,105,111,103,111,110,101,107,10,73,100,111,116,97,99,99,101,
+110,116,2,73,74,2,105,106,11,74,99,105,114,99,117,109,102,108,101,120,11,
+106,99,105,114,99,117,109,102,108,101,120,12,75,99,111,109,109,97,97,99,99,
+101,110,116,12,107,99,111,109,109,97,97,99,99,101,110,116,12,107,103,114,
+101,101,110,108,97,110,100,105,99,6,76,97,99,117,116,101,6,108,97,99,117,
+116,101,12,76,99,111,109,109,97,97,99,99,101,110,116,12,108,99,111,109,109,
+97,97,99,99,101,110,116,6,76,99,97,114,111,110,6,108,99,97,114,111,110,4,
+76,100,111,116,4,108,100,111,116,6,78,97,99,117,116,101,6,110,97,99,117,116,
+101,12,78,99,111,109,109,97,97,99,99,101,110,116,12,110,99,111,109,109,97,
+97,99,99,101,110,116,6,78,99,97,114,111,110,6,110,99,97,114,111,110,11,110,
+97,112,111,115,116,114,111,112,104,101,3,69,110,103,3,101,110,103,7,79,109,
+97,99,114,111,110,7,111,109,97,99,114,111,110,6,79,98,114,101,118,101,6,111,
+98,114,101,118,101,13,79,104,117,110,103,97,114,117,109,108,97,117,116,13,
+111,104,117,110,103,97,114,117,109,108,97,117,116,6,82,97,99,117,116,101,
+6,114,97,99,117,116,101,12,82,99,111,109,109,97,97,99,99,101,110,116,12,114,
+99,111,109,109,97,97,99,99,101,110,116,6,82,99,97,114,111,110,6,114,99,97,
+114,111,110,6,83,97,99,117,116,101,6,115,97,99,117,116,101,11,83,99,105,114,
+99,117,109,102,108,101,120,11,115,99,105,114,99,117,109,102,108,101,120,12,
+84,99,111,109,109,97,97,99,99,101,110,116,12,116,99,111,109,109,97,97,99,
+99,101,110,116,6,84,99,97,114,111,110,6,116,99,97,114,111,110,4,84,98,97,
+114,4,116,98,97,114,6,85,116,105,108,100,101,6,117,116,105,108,100,101,7,
+85,109,97,99,114,111,110,7,117,109,97,99,114,111,110,6,85,98,114,101,118,
+101,6,117,98,114,101,118,101,5,85,114,105,110,103,5,117,114,105,110,103,13,
+85,104,117,110,103,97,114,117,109,108,97,117,116,13,117,104,117,110,103,97,
+114,117,109,108,97,117,116,7,85,111,103,111,110,101,107,7,117,111,103,111,
+110,101,107,11,87,99,105,114,99,117,109,102,108,101,120,11,119,99,105,114,
+99,117,109,102,108,101,120,11,89,99,105,114,99,117,109,102,108,101,120,11,
+121,99,105,114,99,117,109,102,108,101,120,6,90,97,99,117,116,101,6,122,97,
+99,117,116,101,10,90,100,111,116,97,99,99,101,110,116,10,122,100,111,116,
+97,99,99,101,110,116,5,108,111,110,103,115,10,65,114,105,110,103,97,99,117,
+116,101,10,97,114,105,110,103,97,99,117,116,101,7,65,69,97,99,117,116,101,
+7,97,101,97,99,117,116,101,11,79,115,108,97,115,104,97,99,117,116,101,11,
+111,115,108,97,115,104,97,99,117,116,101,12,83,99,111,109,109,97,97,99,99,
+101,110,116,12,115,99,111,109,109,97,97,99,99,101,110,116,6,109,97,99,114,
+111,110,5,116,111,110,111,115,13,100,105,101,114,101,115,105,115,116,111,
+110,111,115,10,65,108,112,104,97,116,111,110,111,115,9,97,110,111,116,101,
+108,101,105,97,12,69,112,115,105,108,111,110,116,111,110,111,115,8,69,116,
+97,116,111,110,111,115,9,73,111,116,97,116,111,110,111,115,12,79,109,105,
+99,114,111,110,116,111,110,111,115,12,85,112,115,105,108,111,110,116,111,
+110,111,115,10,79,109,101,103,97,116,111,110,111,115,17,105,111,116,97,100,
+105,101,114,101,115,105,115,116,111,110,111,115,5,65,108,112,104,97,4,66,
+101,116,97,5,71,97,109,109,97,7,117,110,105,48,51,57,52,7,69,112,115,105,
+108,111,110,4,90,101,116,97,3,69,116,97,5,84,104,101,116,97,4,73,111,116,
+97,5,75,97,112,112,97,6,76,97,109,98,100,97,2,77,117,2,78,117,2,88,105,7,
+79,109,105,99,114,111,110,2,80,105,3,82,104,111,5,83,105,103,109,97,3,84,
+97,117,7,85,112,115,105,108,111,110,3,80,104,105,3,67,104,105,3,80,115,105,
+7,117,110,105,48,51,65,57,12,73,111,116,97,100,105,101,114,101,115,105,115,
+15,85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,10,97,108,112,
+104,97,116,111,110,111,115,12,101,112,115,105,108,111,110,116,111,110,111,
+115,8,101,116,97,116,111,110,111,115,9,105,111,116,97,116,111,110,111,115,
+20,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,
+111,115,5,97,108,112,104,97,4,98,101,116,97,5,103,97,109,109,97,5,100,101,
+108,116,97,7,101,112,115,105,108,111,110,4,122,101,116,97,3,101,116,97,5,
+116,104,101,116,97,4,105,111,116,97,5,107,97,112,112,97,6,108,97,109,98,100,
+97,7,117,110,105,48,51,66,67,2,110,117,2,120,105,7,111,109,105,99,114,111,
+110,3,114,104,111,6,115,105,103,109,97,49,5,115,105,103,109,97,3,116,97,117,
+7,117,112,115,105,108,111,110,3,112,104,105,3,99,104,105,3,112,115,105,5,
+111,109,101,103,97,12,105,111,116,97,100,105,101,114,101,115,105,115,15,117,
+112,115,105,108,111,110,100,105,101,114,101,115,105,115,12,111,109,105,99,
+114,111,110,116,111,110,111,115,12,117,112,115,105,108,111,110,116,111,110,
+111,115,10,111,109,101,103,97,116,111,110,111,115,9,97,102,105,105,49,48,
+48,50,51,9,97,102,105,105,49,48,48,53,49,9,97,102,105,105,49,48,48,53,50,
+9,97,102,105,105,49,48,48,53,51,9,97,102,105,105,49,48,48,53,52,9,97,102,
+105,105,49,48,48,53,53,9,97,102,105,105,49,48,48,53,54,9,97,102,105,105,49,
+48,48,53,55,9,97,102,105,105,49,48,48,53,56,9,97,102,105,105,49,48,48,53,
+57,9,97,102,105,105,49,48,48,54,48,9,97,102,105,105,49,48,48,54,49,9,97,102,
+105,105,49,48,48,54,50,9,97,102,105,105,49,48,49,52,53,9,97,102,105,105,49,
+48,48,49,55,9,97,102,105,105,49,48,48,49,56,9,97,102,105,105,49,48,48,49,
+57,9,97,102,105,105,49,48,48,50,48,9,97,102,105,105,49,48,48,50,49,9,97,102,
+105,105,49,48,48,50,50,9,97,102,105,105,49,48,48,50,52,9,97,102,105,105,49,
+48,48,50,53,9,97,102,105,105,49,48,48,50,54,9,97,102,105,105,49,48,48,50,
+55,9,97,102,105,105,49,48,48,50,56,9,97,102,105,105,49,48,48,50,57,9,97,102,
+105,105,49,48,48,51,48,9,97,102,105,105,49,48,48,51,49,9,97,102,105,105,49,
+48,48,51,50,9,97,102,105,105,49,48,48,51,51,9,97,102,105,105,49,48,48,51,
+52,9,97,102,105,105,49,48,48,51,53,9,97,102,105,105,49,48,48,51,54,9,97,102,
+105,105,49,48,48,51,55,9,97,102,105,105,49,48,48,51,56,9,97,102,105,105,49,
+48,48,51,57,9,97,102,105,105,49,48,48,52,48,9,97,102,105,105,49,48,48,52,
+49,9,97,102,105,105,49,48,48,52,50,9,97,102,105,105,49,48,48,52,51,9,97,102,
+105,105,49,48,48,52,52,9,97,102,105,105,49,48,48,52,53,9,97,102,105,105,49,
+48,48,52,54,9,97,102,105,105,49,48,48,52,55,9,97,102,105,105,49,48,48,52,
+56,9,97,102,105,105,49,48,48,52,57,9,97,102,105,105,49,48,48,54,53,9,97,102,
+105,105,49,48,48,54,54,9,97,102,105,105,49,48,48,54,55,9,97,102,105,105,49,
+48,48,54,56,9,97,102,105,105,49,48,48,54,57,9,97,102,105,105,49,48,48,55,
+48,9,97,102,105,105,49,48,48,55,50,9,97,102,105,105,49,48,48,55,51,9,97,102,
+105,105,49,48,48,55,52,9,97,102,105,105,49,48,48,55,53,9,97,102,105,105,49,
+48,48,55,54,9,97,102,105,105,49,48,48,55,55,9,97,102,105,105,49,48,48,55,
+56,9,97,102,105,105,49,48,48,55,57,9,97,102,105,105,49,48,48,56,48,9,97,102,
+105,105,49,48,48,56,49,9,97,102,105,105,49,48,48,56,50,9,97,102,105,105,49,
+48,48,56,51,9,97,102,105,105,49,48,48,56,52,9,97,102,105,105,49,48,48,56,
+53,9,97,102,105,105,49,48,48,56,54,9,97,102,105,105,49,48,48,56,55,9,97,102,
+105,105,49,48,48,56,56,9,97,102,105,105,49,48,48,56,57,9,97,102,105,105,49,
+48,48,57,48,9,97,102,105,105,49,48,48,57,49,9,97,102,105,105,49,48,48,57,
+50,9,97,102,105,105,49,48,48,57,51,9,97,102,105,105,49,48,48,57,52,9,97,102,
+105,105,49,48,48,57,53,9,97,102,105,105,49,48,48,57,54,9,97,102,105,105,49,
+48,48,57,55,9,97,102,105,105,49,48,48,55,49,9,97,102,105,105,49,48,48,57,
+57,9,97,102,105,105,49,48,49,48,48,9,97,102,105,105,49,48,49,48,49,9,97,102,
+105,105,49,48,49,48,50,9,97,102,105,105,49,48,49,48,51,9,97,102,105,105,49,
+48,49,48,52,9,97,102,105,105,49,48,49,48,53,9,97,102,105,105,49,48,49,48,
+54,9,97,102,105,105,49,48,49,48,55,9,97,102,105,105,49,48,49,48,56,9,97,102,
+105,105,49,48,49,48,57,9,97,102,105,105,49,48,49,49,48,9,97,102,105,105,49,
+48,49,57,51,9,97,102,105,105,49,48,48,53,48,9,97,102,105,105,49,48,48,57,
+56,6,87,103,114,97,118,101,6,119,103,114,97,118,101,6,87,97,99,117,116,101,
+6,119,97,99,117,116,101,9,87,100,105,101,114,101,115,105,115,9,119,100,105,
+101,114,101,115,105,115,6,89,103,114,97,118,101,6,121,103,114,97,118,101,
+9,97,102,105,105,48,48,50,48,56,13,117,110,100,101,114,115,99,111,114,101,
+100,98,108,13,113,117,111,116,101,114,101,118,101,114,115,101,100,6,109,105,
+110,117,116,101,6,115,101,99,111,110,100,9,101,120,99,108,97,109,100,98,108,
+9,110,115,117,112,101,114,105,111,114,9,97,102,105,105,48,56,57,52,49,6,112,
+101,115,101,116,97,4,69,117,114,111,9,97,102,105,105,54,49,50,52,56,9,97,
+102,105,105,54,49,50,56,57,9,97,102,105,105,54,49,51,53,50,9,101,115,116,
+105,109,97,116,101,100,9,111,110,101,101,105,103,104,116,104,12,116,104,114,
+101,101,101,105,103,104,116,104,115,11,102,105,118,101,101,105,103,104,116,
+104,115,12,115,101,118,101,110,101,105,103,104,116,104,115,5,68,101,108,116,
+97,7,117,110,105,70,66,48,49,7,117,110,105,70,66,48,50,13,99,121,114,105,
+108,108,105,99,98,114,101,118,101,8,100,111,116,108,101,115,115,106,16,99,
+97,114,111,110,99,111,109,109,97,97,99,99,101,110,116,11,99,111,109,109,97,
+97,99,99,101,110,116,17,99,111,109,109,97,97,99,99,101,110,116,114,111,116,
+97,116,101,12,122,101,114,111,115,117,112,101,114,105,111,114,12,102,111,
+117,114,115,117,112,101,114,105,111,114,12,102,105,118,101,115,117,112,101,
+114,105,111,114,11,115,105,120,115,117,112,101,114,105,111,114,13,115,101,
+118,101,110,115,117,112,101,114,105,111,114,13,101,105,103,104,116,115,117,
+112,101,114,105,111,114,12,110,105,110,101,115,117,112,101,114,105,111,114,
+7,117,110,105,50,48,48,48,7,117,110,105,50,48,48,49,7,117,110,105,50,48,48,
+50,7,117,110,105,50,48,48,51,7,117,110,105,50,48,48,52,7,117,110,105,50,48,
+48,53,7,117,110,105,50,48,48,54,7,117,110,105,50,48,48,55,7,117,110,105,50,
+48,48,56,7,117,110,105,50,48,48,57,7,117,110,105,50,48,48,65,7,117,110,105,
+50,48,48,66,7,117,110,105,70,69,70,70,7,117,110,105,70,70,70,67,7,117,110,
+105,70,70,70,68,7,117,110,105,48,49,70,48,7,117,110,105,48,50,66,67,7,117,
+110,105,48,51,68,49,7,117,110,105,48,51,68,50,7,117,110,105,48,51,68,54,7,
+117,110,105,49,69,51,69,7,117,110,105,49,69,51,70,7,117,110,105,49,69,48,
+48,7,117,110,105,49,69,48,49,7,117,110,105,49,70,52,68,7,117,110,105,48,50,
+70,51,9,100,97,115,105,97,111,120,105,97,7,117,110,105,70,66,48,51,7,117,
+110,105,70,66,48,52,5,79,104,111,114,110,5,111,104,111,114,110,5,85,104,111,
+114,110,5,117,104,111,114,110,7,117,110,105,48,51,48,48,7,117,110,105,48,
+51,48,49,7,117,110,105,48,51,48,51,4,104,111,111,107,8,100,111,116,98,101,
+108,111,119,7,117,110,105,48,52,48,48,7,117,110,105,48,52,48,68,7,117,110,
+105,48,52,53,48,7,117,110,105,48,52,53,68,7,117,110,105,48,52,54,48,7,117,
+110,105,48,52,54,49,7,117,110,105,48,52,54,50,7,117,110,105,48,52,54,51,7,
+117,110,105,48,52,54,52,7,117,110,105,48,52,54,53,7,117,110,105,48,52,54,
+54,7,117,110,105,48,52,54,55,7,117,110,105,48,52,54,56,7,117,110,105,48,52,
+54,57,7,117,110,105,48,52,54,65,7,117,110,105,48,52,54,66,7,117,110,105,48,
+52,54,67,7,117,110,105,48,52,54,68,7,117,110,105,48,52,54,69,7,117,110,105,
+48,52,54,70,7,117,110,105,48,52,55,48,7,117,110,105,48,52,55,49,7,117,110,
+105,48,52,55,50,7,117,110,105,48,52,55,51,7,117,110,105,48,52,55,52,7,117,
+110,105,48,52,55,53,7,117,110,105,48,52,55,54,7,117,110,105,48,52,55,55,7,
+117,110,105,48,52,55,56,7,117,110,105,48,52,55,57,7,117,110,105,48,52,55,
+65,7,117,110,105,48,52,55,66,7,117,110,105,48,52,55,67,7,117,110,105,48,52,
+55,68,7,117,110,105,48,52,55,69,7,117,110,105,48,52,55,70,7,117,110,105,48,
+52,56,48,7,117,110,105,48,52,56,49,7,117,110,105,48,52,56,50,7,117,110,105,
+48,52,56,51,7,117,110,105,48,52,56,52,7,117,110,105,48,52,56,53,7,117,110,
+105,48,52,56,54,7,117,110,105,48,52,56,56,7,117,110,105,48,52,56,57,7,117,
+110,105,48,52,56,65,7,117,110,105,48,52,56,66,7,117,110,105,48,52,56,67,7,
+117,110,105,48,52,56,68,7,117,110,105,48,52,56,69,7,117,110,105,48,52,56,
+70,7,117,110,105,48,52,57,50,7,117,110,105,48,52,57,51,7,117,110,105,48,52,
+57,52,7,117,110,105,48,52,57,53,7,117,110,105,48,52,57,54,7,117,110,105,48,
+52,57,55,7,117,110,105,48,52,57,56,7,117,110,105,48,52,57,57,7,117,110,105,
+48,52,57,65,7,117,110,105,48,52,57,66,7,117,110,105,48,52,57,67,7,117,110,
+105,48,52,57,68,7,117,110,105,48,52,57,69,7,117,110,105,48,52,57,70,7,117,
+110,105,48,52,65,48,7,117,110,105,48,52,65,49,7,117,110,105,48,52,65,50,7,
+117,110,105,48,52,65,51,7,117,110,105,48,52,65,52,7,117,110,105,48,52,65,
+53,7,117,110,105,48,52,65,54,7,117,110,105,48,52,65,55,7,117,110,105,48,52,
+65,56,7,117,110,105,48,52,65,57,7,117,110,105,48,52,65,65,7,117,110,105,48,
+52,65,66,7,117,110,105,48,52,65,67,7,117,110,105,48,52,65,68,7,117,110,105,
+48,52,65,69,7,117,110,105,48,52,65,70,7,117,110,105,48,52,66,48,7,117,110,
+105,48,52,66,49,7,117,110,105,48,52,66,50,7,117,110,105,48,52,66,51,7,117,
+110,105,48,52,66,52,7,117,110,105,48,52,66,53,7,117,110,105,48,52,66,54,7,
+117,110,105,48,52,66,55,7,117,110,105,48,52,66,56,7,117,110,105,48,52,66,
+57,7,117,110,105,48,52,66,65,7,117,110,105,48,52,66,66,7,117,110,105,48,52,
+66,67,7,117,110,105,48,52,66,68,7,117,110,105,48,52,66,69,7,117,110,105,48,
+52,66,70,7,117,110,105,48,52,67,48,7,117,110,105,48,52,67,49,7,117,110,105,
+48,52,67,50,7,117,110,105,48,52,67,51,7,117,110,105,48,52,67,52,7,117,110,
+105,48,52,67,53,7,117,110,105,48,52,67,54,7,117,110,105,48,52,67,55,7,117,
+110,105,48,52,67,56,7,117,110,105,48,52,67,57,7,117,110,105,48,52,67,65,7,
+117,110,105,48,52,67,66,7,117,110,105,48,52,67,67,7,117,110,105,48,52,67,
+68,7,117,110,105,48,52,67,69,7,117,110,105,48,52,67,70,7,117,110,105,48,52,
+68,48,7,117,110,105,48,52,68,49,7,117,110,105,48,52,68,50,7,117,110,105,48,
+52,68,51,7,117,110,105,48,52,68,52,7,117,110,105,48,52,68,53,7,117,110,105,
+48,52,68,54,7,117,110,105,48,52,68,55,7,117,110,105,48,52,68,56,7,117,110,
+105,48,52,68,57,7,117,110,105,48,52,68,65,7,117,110,105,48,52,68,66,7,117,
+110,105,48,52,68,67,7,117,110,105,48,52,68,68,7,117,110,105,48,52,68,69,7,
+117,110,105,48,52,68,70,7,117,110,105,48,52,69,48,7,117,110,105,48,52,69,
+49,7,117,110,105,48,52,69,50,7,117,110,105,48,52,69,51,7,117,110,105,48,52,
+69,52,7,117,110,105,48,52,69,53,7,117,110,105,48,52,69,54,7,117,110,105,48,
+52,69,55,7,117,110,105,48,52,69,56,7,117,110,105,48,52,69,57,7,117,110,105,
+48,52,69,65,7,117,110,105,48,52,69,66,7,117,110,105,48,52,69,67,7,117,110,
+105,48,52,69,68,7,117,110,105,48,52,69,69,7,117,110,105,48,52,69,70,7,117,
+110,105,48,52,70,48,7,117,110,105,48,52,70,49,7,117,110,105,48,52,70,50,7,
+117,110,105,48,52,70,51,7,117,110,105,48,52,70,52,7,117,110,105,48,52,70,
+53,7,117,110,105,48,52,70,54,7,117,110,105,48,52,70,55,7,117,110,105,48,52,
+70,56,7,117,110,105,48,52,70,57,7,117,110,105,48,52,70,65,7,117,110,105,48,
+52,70,66,7,117,110,105,48,52,70,67,7,117,110,105,48,52,70,68,7,117,110,105,
+48,52,70,69,7,117,110,105,48,52,70,70,7,117,110,105,48,53,48,48,7,117,110,
+105,48,53,48,49,7,117,110,105,48,53,48,50,7,117,110,105,48,53,48,51,7,117,
+110,105,48,53,48,52,7,117,110,105,48,53,48,53,7,117,110,105,48,53,48,54,7,
+117,110,105,48,53,48,55,7,117,110,105,48,53,48,56,7,117,110,105,48,53,48,
+57,7,117,110,105,48,53,48,65,7,117,110,105,48,53,48,66,7,117,110,105,48,53,
+48,67,7,117,110,105,48,53,48,68,7,117,110,105,48,53,48,69,7,117,110,105,48,
+53,48,70,7,117,110,105,48,53,49,48,7,117,110,105,48,53,49,49,7,117,110,105,
+48,53,49,50,7,117,110,105,48,53,49,51,7,117,110,105,49,69,65,48,7,117,110,
+105,49,69,65,49,7,117,110,105,49,69,65,50,7,117,110,105,49,69,65,51,7,117,
+110,105,49,69,65,52,7,117,110,105,49,69,65,53,7,117,110,105,49,69,65,54,7,
+117,110,105,49,69,65,55,7,117,110,105,49,69,65,56,7,117,110,105,49,69,65,
+57,7,117,110,105,49,69,65,65,7,117,110,105,49,69,65,66,7,117,110,105,49,69,
+65,67,7,117,110,105,49,69,65,68,7,117,110,105,49,69,65,69,7,117,110,105,49,
+69,65,70,7,117,110,105,49,69,66,48,7,117,110,105,49,69,66,49,7,117,110,105,
+49,69,66,50,7,117,110,105,49,69,66,51,7,117,110,105,49,69,66,52,7,117,110,
+105,49,69,66,53,7,117,110,105,49,69,66,54,7,117,110,105,49,69,66,55,7,117,
+110,105,49,69,66,56,7,117,110,105,49,69,66,57,7,117,110,105,49,69,66,65,7,
+117,110,105,49,69,66,66,7,117,110,105,49,69,66,67,7,117,110,105,49,69,66,
+68,7,117,110,105,49,69,66,69,7,117,110,105,49,69,66,70,7,117,110,105,49,69,
+67,48,7,117,110,105,49,69,67,49,7,117,110,105,49,69,67,50,7,117,110,105,49,
+69,67,51,7,117,110,105,49,69,67,52,7,117,110,105,49,69,67,53,7,117,110,105,
+49,69,67,54,7,117,110,105,49,69,67,55,7,117,110,105,49,69,67,56,7,117,110,
+105,49,69,67,57,7,117,110,105,49,69,67,65,7,117,110,105,49,69,67,66,7,117,
+110,105,49,69,67,67,7,117,110,105,49,69,67,68,7,117,110,105,49,69,67,69,7,
+117,110,105,49,69,67,70,7,117,110,105,49,69,68,48,7,117,110,105,49,69,68,
+49,7,117,110,105,49,69,68,50,7,117,110,105,49,69,68,51,7,117,110,105,49,69,
+68,52,7,117,110,105,49,69,68,53,7,117,110,105,49,69,68,54,7,117,110,105,49,
+69,68,55,7,117,110,105,49,69,68,56,7,117,110,105,49,69,68,57,7,117,110,105,
+49,69,68,65,7,117,110,105,49,69,68,66,7,117,110,105,49,69,68,67,7,117,110,
+105,49,69,68,68,7,117,110,105,49,69,68,69,7,117,110,105,49,69,68,70,7,117,
+110,105,49,69,69,48,7,117,110,105,49,69,69,49,7,117,110,105,49,69,69,50,7,
+117,110,105,49,69,69,51,7,117,110,105,49,69,69,52,7,117,110,105,49,69,69,
+53,7,117,110,105,49,69,69,54,7,117,110,105,49,69,69,55,7,117,110,105,49,69,
+69,56,7,117,110,105,49,69,69,57,7,117,110,105,49,69,69,65,7,117,110,105,49,
+69,69,66,7,117,110,105,49,69,69,67,7,117,110,105,49,69,69,68,7,117,110,105,
+49,69,69,69,7,117,110,105,49,69,69,70,7,117,110,105,49,69,70,48,7,117,110,
+105,49,69,70,49,7,117,110,105,49,69,70,52,7,117,110,105,49,69,70,53,7,117,
+110,105,49,69,70,54,7,117,110,105,49,69,70,55,7,117,110,105,49,69,70,56,7,
+117,110,105,49,69,70,57,7,117,110,105,50,48,65,66,7,117,110,105,48,51,48,
+70,19,99,105,114,99,117,109,102,108,101,120,97,99,117,116,101,99,111,109,
+98,19,99,105,114,99,117,109,102,108,101,120,103,114,97,118,101,99,111,109,
+98,18,99,105,114,99,117,109,102,108,101,120,104,111,111,107,99,111,109,98,
+19,99,105,114,99,117,109,102,108,101,120,116,105,108,100,101,99,111,109,98,
+14,98,114,101,118,101,97,99,117,116,101,99,111,109,98,14,98,114,101,118,101,
+103,114,97,118,101,99,111,109,98,13,98,114,101,118,101,104,111,111,107,99,
+111,109,98,14,98,114,101,118,101,116,105,108,100,101,99,111,109,98,16,99,
+121,114,105,108,108,105,99,104,111,111,107,108,101,102,116,17,99,121,114,
+105,108,108,105,99,98,105,103,104,111,111,107,85,67,17,99,121,114,105,108,
+108,105,99,98,105,103,104,111,111,107,76,67,5,103,46,97,108,116,8,84,99,101,
+100,105,108,108,97,8,116,99,101,100,105,108,108,97,0,0,0,0,0,0,2,0,5,0,2,
+255,255,0,3,0,1,0,0,0,12,0,0,0,22,0,0,0,2,0,1,0,0,3,132,0,1,0,4,0,0,0,1,0,
+0,0,0,0,1,0,0,0,10,0,30,0,44,0,1,108,97,116,110,0,8,0,4,0,0,0,0,255,255,0,
+1,0,0,0,1,107,101,114,110,0,8,0,0,0,1,0,0,0,1,0,4,0,2,0,8,0,1,0,8,0,1,165,
+200,0,4,0,0,1,241,3,236,3,236,7,82,7,96,8,222,7,96,9,60,10,206,11,52,12,34,
+13,84,14,58,15,32,16,6,17,152,18,202,19,160,20,210,21,4,25,138,26,24,29,186,
+33,96,35,146,39,172,7,82,40,146,40,146,40,152,40,146,40,170,41,68,41,90,41,
+96,40,146,40,146,41,114,41,128,40,152,41,254,42,20,42,20,42,42,43,4,43,26,
+7,82,43,228,43,242,44,0,46,82,46,82,44,0,48,152,50,226,11,52,53,56,54,30,
+53,56,53,56,14,58,14,58,14,58,14,58,54,252,55,126,55,126,55,126,55,126,55,
+126,17,152,56,220,56,220,56,220,56,220,57,230,40,146,40,146,40,146,40,146,
+40,146,40,146,41,114,40,152,62,164,62,164,62,164,62,164,62,174,62,188,62,
+188,62,188,62,188,62,188,41,114,62,214,62,214,62,214,62,214,62,224,64,102,
+9,60,40,146,9,60,40,146,64,132,40,146,11,52,40,152,40,152,40,152,11,52,40,
+152,66,26,40,146,40,146,40,146,66,152,40,146,40,146,14,58,66,158,14,58,15,
+32,41,96,16,6,16,6,16,6,66,26,16,6,16,6,40,146,40,146,40,146,17,152,41,114,
+41,114,17,152,41,114,41,114,40,152,40,152,40,152,67,136,40,152,68,150,68,
+150,66,26,25,138,25,138,25,138,25,138,29,186,42,20,35,146,43,4,73,16,39,172,
+39,172,77,138,80,160,9,60,40,146,40,152,81,110,81,156,81,170,81,216,82,106,
+82,120,82,222,84,32,84,130,86,76,89,22,89,56,90,86,90,108,91,22,94,88,94,
+102,95,132,96,94,97,4,100,174,101,100,101,142,101,236,102,30,102,44,102,222,
+106,156,106,162,40,146,106,188,106,156,107,14,107,20,107,66,107,76,107,122,
+40,146,107,236,108,46,108,84,108,138,108,168,108,182,108,204,108,182,108,
+222,108,252,109,54,109,72,41,114,109,158,109,176,41,114,41,114,109,254,110,
+224,111,214,115,44,115,170,115,192,116,42,117,8,117,218,118,160,119,22,120,
+204,122,106,124,148,125,62,125,200,128,6,129,16,129,214,130,112,131,162,133,
+0,134,22,135,32,140,110,141,252,142,166,143,96,144,34,145,28,145,150,146,
+24,146,166,147,28,147,130,148,8,148,154,148,184,148,250,149,48,149,178,150,
+40,150,174,151,56,151,134,151,228,152,166,153,56,153,170,154,32,154,118,154,
+208,40,152,155,54,155,168,155,238,40,152,156,48,156,62,40,152,40,152,156,
+176,156,186,157,64,157,190,157,196,158,54,158,172,148,154,29,186,42,20,29,
+186,42,20,29,186,42,20,35,146,43,4,162,26,162,26,162,40,162,40,9,60,9,60,
+165,58,165,124,148,250,131,162,152,166,145,150,150,174,134,22,151,134,122,
+106,122,106,129,16,149,48,129,16,149,48,131,162,150,174,133,0,131,162,150,
+174,140,110,152,166,140,110,152,166,152,166,152,166,131,162,150,174,131,162,
+150,174,131,162,152,166,165,190,143,96,154,32,145,150,150,174,133,0,150,174,
+135,32,151,228,118,160,143,96,154,32,150,174,143,96,154,32,129,16,149,48,
+129,16,149,48,129,16,149,48,143,96,154,32,135,32,151,228,118,160,131,162,
+150,174,134,22,151,134,135,32,151,228,135,32,152,166,135,32,152,166,143,96,
+154,32,143,96,154,32,143,96,154,32,118,160,131,162,131,162,115,192,129,16,
+149,48,118,160,143,96,154,32,143,96,154,32,143,96,154,32,115,192,122,106,
+122,106,148,250,148,250,131,162,150,174,131,162,150,174,129,16,149,48,131,
+162,150,174,131,162,131,162,150,174,131,162,150,174,131,162,150,174,131,162,
+150,174,140,110,152,166,140,110,152,166,140,110,152,166,135,32,151,228,135,
+32,151,228,143,96,154,32,129,16,149,48,131,162,150,174,140,110,150,174,143,
+96,154,32,131,162,150,174,131,162,150,174,131,162,150,174,131,162,150,174,
+134,22,151,134,143,96,154,32,9,60,9,60,9,60,9,60,9,60,9,60,9,60,9,60,9,60,
+9,60,9,60,9,60,40,146,40,146,40,146,40,146,40,146,40,146,40,146,40,146,14,
+58,14,58,17,152,41,114,17,152,41,114,17,152,41,114,17,152,41,114,17,152,41,
+114,17,152,41,114,17,152,41,114,165,58,165,58,165,58,165,58,165,58,25,138,
+25,138,165,124,165,124,165,124,165,124,165,124,35,146,43,4,35,146,43,4,35,
+146,43,4,68,150,0,217,0,36,255,174,0,44,0,41,0,55,0,82,0,57,0,82,0,58,0,102,
+0,59,0,41,0,60,0,82,0,61,0,41,0,70,255,195,0,71,255,195,0,72,255,195,0,74,
+255,215,0,82,255,195,0,84,255,195,0,87,0,41,0,89,0,41,0,90,0,20,0,92,0,41,
+0,130,255,174,0,131,255,174,0,132,255,174,0,133,255,174,0,134,255,174,0,135,
+255,174,0,136,255,92,0,142,0,41,0,143,0,41,0,144,0,41,0,145,0,41,0,159,0,
+82,0,168,255,195,0,169,255,195,0,170,255,195,0,171,255,195,0,172,255,195,
+0,173,255,195,0,180,255,195,0,181,255,195,0,182,255,195,0,183,255,195,0,184,
+255,195,0,186,255,195,0,191,0,41,0,193,0,41,0,194,255,174,0,196,255,174,0,
+198,255,174,0,201,255,195,0,203,255,195,0,205,255,195,0,207,255,195,0,213,
+255,195,0,215,255,195,0,217,255,195,0,219,255,195,0,221,255,195,0,236,0,41,
+0,240,0,41,0,242,0,41,1,15,255,195,1,17,255,195,1,19,255,195,1,21,255,195,
+1,36,0,82,1,38,0,82,1,54,0,102,1,55,0,20,1,56,0,82,1,57,0,41,1,58,0,82,1,
+59,0,41,1,61,0,41,1,63,0,41,1,67,255,174,1,95,255,174,1,105,255,174,1,113,
+0,82,1,121,255,195,1,126,255,195,1,128,0,41,1,130,255,195,1,138,0,41,1,140,
+255,195,1,142,255,195,1,144,255,195,1,145,0,41,1,147,255,195,1,148,0,41,1,
+150,255,195,1,153,255,195,1,155,255,195,1,157,0,82,1,164,255,154,1,166,0,
+82,1,168,0,61,1,170,255,174,1,174,255,133,1,176,0,61,1,177,0,20,1,181,255,
+133,1,188,0,82,1,189,0,61,1,191,0,41,1,196,0,82,1,207,255,195,1,216,255,195,
+1,219,255,195,1,220,0,41,1,221,0,41,1,222,255,195,1,234,255,195,1,237,255,
+195,1,250,0,102,1,251,0,20,1,252,0,102,1,253,0,20,1,254,0,102,1,255,0,20,
+2,0,0,82,2,1,0,41,2,40,255,174,2,88,255,174,2,96,255,195,2,106,255,195,2,
+109,0,41,2,114,255,174,2,118,0,61,2,127,255,195,2,129,0,41,2,131,0,41,2,133,
+255,195,2,135,255,195,2,137,255,195,2,139,0,41,2,141,255,195,2,159,0,61,2,
+169,0,82,2,170,0,41,2,178,255,195,2,180,255,195,2,181,0,82,2,182,0,41,2,183,
+0,82,2,184,0,41,2,185,0,82,2,186,0,41,2,187,0,61,2,189,0,82,2,202,0,61,2,
+206,255,133,2,217,255,174,2,219,255,174,2,221,255,174,2,224,255,195,2,229,
+0,61,2,240,255,195,2,242,255,195,2,244,255,195,2,247,0,61,2,248,0,41,2,249,
+0,61,2,250,0,41,2,251,0,61,2,252,0,41,3,5,0,61,3,7,0,61,3,10,255,195,3,12,
+255,195,3,14,0,41,3,16,0,41,3,17,255,133,3,22,255,195,3,23,0,82,3,24,0,41,
+3,26,255,195,3,27,255,133,3,29,255,174,3,31,255,174,3,33,255,174,3,35,255,
+174,3,37,255,174,3,39,255,174,3,41,255,174,3,43,255,174,3,45,255,174,3,47,
+255,174,3,49,255,174,3,51,255,174,3,54,255,195,3,56,255,195,3,58,255,195,
+3,60,255,195,3,62,255,195,3,64,255,195,3,66,255,195,3,68,255,195,3,69,0,41,
+3,71,0,41,3,74,255,195,3,76,255,195,3,78,255,195,3,80,255,195,3,82,255,195,
+3,84,255,195,3,86,255,195,3,88,255,195,3,90,255,195,3,92,255,195,3,94,255,
+195,3,96,255,195,3,111,0,82,3,112,0,41,3,113,0,82,3,114,0,41,3,115,0,82,3,
+116,0,41,3,131,0,82,0,3,0,45,0,123,0,246,0,123,1,163,0,123,0,95,0,38,255,
+195,0,42,255,195,0,50,255,195,0,52,255,195,0,55,255,154,0,56,255,215,0,57,
+255,154,0,58,255,174,0,60,255,154,0,137,255,195,0,148,255,195,0,149,255,195,
+0,150,255,195,0,151,255,195,0,152,255,195,0,154,255,195,0,155,255,215,0,156,
+255,215,0,157,255,215,0,158,255,215,0,159,255,154,0,200,255,195,0,206,255,
+195,0,222,255,195,0,224,255,195,0,226,255,195,0,228,255,195,1,14,255,195,
+1,18,255,195,1,36,255,154,1,38,255,154,1,44,255,215,1,48,255,215,1,50,255,
+215,1,52,255,215,1,54,255,174,1,56,255,154,1,58,255,154,1,102,255,195,1,109,
+255,195,1,113,255,154,1,184,255,195,1,187,255,195,1,188,255,154,1,250,255,
+174,1,252,255,174,1,254,255,174,2,0,255,154,2,95,255,195,2,97,255,215,2,108,
+255,195,2,126,255,195,2,132,255,195,2,134,255,195,2,136,255,195,2,138,255,
+195,2,140,255,195,2,169,255,154,2,177,255,195,2,179,255,195,2,181,255,154,
+2,183,255,154,2,185,255,154,2,189,255,154,2,225,255,195,2,227,255,195,2,239,
+255,195,2,241,255,195,2,243,255,195,3,21,255,195,3,23,255,154,3,25,255,195,
+3,73,255,195,3,75,255,195,3,77,255,195,3,79,255,195,3,81,255,195,3,83,255,
+195,3,85,255,195,3,87,255,195,3,89,255,195,3,91,255,195,3,93,255,195,3,95,
+255,195,3,97,255,215,3,99,255,215,3,101,255,215,3,103,255,215,3,105,255,215,
+3,107,255,215,3,109,255,215,3,111,255,154,3,113,255,154,3,115,255,154,3,131,
+255,154,0,23,0,55,255,154,1,113,255,154,1,114,255,195,1,176,255,215,1,181,
+255,215,1,188,255,154,1,196,255,174,2,118,255,215,2,159,255,215,2,169,255,
+154,2,181,255,154,2,183,255,154,2,185,255,154,2,187,255,215,2,189,255,154,
+2,202,255,215,2,206,255,215,2,229,255,215,3,5,255,215,3,7,255,215,3,17,255,
+215,3,23,255,154,3,27,255,215,0,100,0,5,255,174,0,10,255,174,0,38,255,236,
+0,42,255,236,0,50,255,236,0,52,255,236,0,55,255,133,0,56,255,236,0,57,255,
+195,0,58,255,215,0,60,255,154,0,137,255,236,0,148,255,236,0,149,255,236,0,
+150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,0,155,255,236,0,156,
+255,236,0,157,255,236,0,158,255,236,0,159,255,154,0,200,255,236,0,206,255,
+236,0,222,255,236,0,224,255,236,0,226,255,236,0,228,255,236,1,14,255,236,
+1,18,255,236,1,20,255,215,1,36,255,133,1,38,255,133,1,44,255,236,1,48,255,
+236,1,50,255,236,1,52,255,236,1,54,255,215,1,56,255,154,1,58,255,154,1,102,
+255,236,1,109,255,236,1,113,255,133,1,184,255,236,1,187,255,236,1,188,255,
+133,1,250,255,215,1,252,255,215,1,254,255,215,2,0,255,154,2,7,255,174,2,11,
+255,174,2,95,255,236,2,97,255,236,2,108,255,236,2,126,255,236,2,132,255,236,
+2,134,255,236,2,136,255,236,2,138,255,236,2,140,255,236,2,169,255,133,2,177,
+255,236,2,179,255,236,2,181,255,133,2,183,255,133,2,185,255,133,2,189,255,
+133,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,255,236,
+3,21,255,236,3,23,255,133,3,25,255,236,3,73,255,236,3,75,255,236,3,77,255,
+236,3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,
+255,236,3,91,255,236,3,93,255,236,3,95,255,236,3,97,255,236,3,99,255,236,
+3,101,255,236,3,103,255,236,3,105,255,236,3,107,255,236,3,109,255,236,3,111,
+255,154,3,113,255,154,3,115,255,154,3,131,255,133,0,25,0,44,255,236,0,55,
+255,236,0,57,255,236,0,59,255,236,0,60,255,236,0,159,255,236,1,36,255,236,
+1,38,255,236,1,56,255,236,1,58,255,236,1,113,255,236,1,188,255,236,2,0,255,
+236,2,169,255,236,2,181,255,236,2,183,255,236,2,185,255,236,2,189,255,236,
+3,23,255,236,3,69,255,236,3,71,255,236,3,111,255,236,3,113,255,236,3,115,
+255,236,3,131,255,236,0,59,0,5,0,41,0,10,0,41,0,12,0,41,0,38,255,215,0,42,
+255,215,0,50,255,215,0,52,255,215,0,64,0,41,0,96,0,41,0,137,255,215,0,148,
+255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,255,215,0,154,255,
+215,0,200,255,215,0,206,255,215,0,222,255,215,0,224,255,215,0,226,255,215,
+0,228,255,215,1,14,255,215,1,18,255,215,1,102,255,215,1,109,255,215,1,184,
+255,215,1,187,255,215,2,7,0,41,2,11,0,41,2,95,255,215,2,108,255,215,2,126,
+255,215,2,132,255,215,2,134,255,215,2,136,255,215,2,138,255,215,2,140,255,
+215,2,177,255,215,2,179,255,215,2,225,255,215,2,227,255,215,2,239,255,215,
+2,241,255,215,2,243,255,215,3,21,255,215,3,25,255,215,3,73,255,215,3,75,255,
+215,3,77,255,215,3,79,255,215,3,81,255,215,3,83,255,215,3,85,255,215,3,87,
+255,215,3,89,255,215,3,91,255,215,3,93,255,215,3,95,255,215,0,76,0,15,255,
+195,0,17,255,195,0,36,255,236,0,44,255,236,0,55,255,195,0,57,255,236,0,58,
+255,236,0,59,255,236,0,60,255,215,0,61,255,236,0,130,255,236,0,131,255,236,
+0,132,255,236,0,133,255,236,0,134,255,236,0,135,255,236,0,136,255,195,0,142,
+255,236,0,143,255,236,0,144,255,236,0,145,255,236,0,159,255,215,0,194,255,
+236,0,196,255,236,0,198,255,236,0,236,255,236,0,240,255,236,0,242,255,236,
+1,36,255,195,1,38,255,195,1,54,255,236,1,56,255,215,1,58,255,215,1,59,255,
+236,1,61,255,236,1,63,255,236,1,67,255,236,1,95,255,236,1,105,255,236,1,113,
+255,195,1,170,255,236,1,188,255,195,1,250,255,236,1,252,255,236,1,254,255,
+236,2,0,255,215,2,40,255,236,2,88,255,236,2,114,255,236,2,169,255,195,2,181,
+255,195,2,183,255,195,2,185,255,195,2,189,255,195,2,217,255,236,2,219,255,
+236,2,221,255,236,3,23,255,195,3,29,255,236,3,31,255,236,3,33,255,236,3,35,
+255,236,3,37,255,236,3,39,255,236,3,41,255,236,3,43,255,236,3,45,255,236,
+3,47,255,236,3,49,255,236,3,51,255,236,3,69,255,236,3,71,255,236,3,111,255,
+215,3,113,255,215,3,115,255,215,3,131,255,195,0,57,0,5,0,61,0,10,0,61,0,12,
+0,41,0,15,255,154,0,17,255,154,0,34,0,41,0,36,255,215,0,57,0,20,0,58,0,20,
+0,60,0,20,0,64,0,41,0,96,0,41,0,130,255,215,0,131,255,215,0,132,255,215,0,
+133,255,215,0,134,255,215,0,135,255,215,0,136,255,195,0,159,0,20,0,194,255,
+215,0,196,255,215,0,198,255,215,1,54,0,20,1,56,0,20,1,58,0,20,1,67,255,215,
+1,95,255,215,1,105,255,215,1,170,255,215,1,250,0,20,1,252,0,20,1,254,0,20,
+2,0,0,20,2,7,0,61,2,11,0,61,2,40,255,215,2,88,255,215,2,114,255,215,2,217,
+255,215,2,219,255,215,2,221,255,215,3,29,255,215,3,31,255,215,3,33,255,215,
+3,35,255,215,3,37,255,215,3,39,255,215,3,41,255,215,3,43,255,215,3,45,255,
+215,3,47,255,215,3,49,255,215,3,51,255,215,3,111,0,20,3,113,0,20,3,115,0,
+20,0,57,0,5,0,41,0,10,0,41,0,38,255,236,0,42,255,236,0,50,255,236,0,52,255,
+236,0,137,255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,
+0,152,255,236,0,154,255,236,0,200,255,236,0,206,255,236,0,222,255,236,0,224,
+255,236,0,226,255,236,0,228,255,236,1,14,255,236,1,18,255,236,1,20,255,236,
+1,102,255,236,1,109,255,236,1,184,255,236,1,187,255,236,2,7,0,41,2,11,0,41,
+2,95,255,236,2,108,255,236,2,126,255,236,2,132,255,236,2,134,255,236,2,136,
+255,236,2,138,255,236,2,140,255,236,2,177,255,236,2,179,255,236,2,225,255,
+236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,255,236,3,21,255,236,
+3,25,255,236,3,73,255,236,3,75,255,236,3,77,255,236,3,79,255,236,3,81,255,
+236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,236,3,91,255,236,3,93,
+255,236,3,95,255,236,0,57,0,5,0,41,0,10,0,41,0,38,255,215,0,42,255,215,0,
+50,255,215,0,52,255,215,0,137,255,215,0,148,255,215,0,149,255,215,0,150,255,
+215,0,151,255,215,0,152,255,215,0,154,255,215,0,200,255,215,0,206,255,215,
+0,222,255,215,0,224,255,215,0,226,255,215,0,228,255,215,1,14,255,215,1,18,
+255,215,1,20,255,215,1,102,255,215,1,109,255,215,1,184,255,215,1,187,255,
+215,2,7,0,41,2,11,0,41,2,95,255,215,2,108,255,215,2,126,255,215,2,132,255,
+215,2,134,255,215,2,136,255,215,2,138,255,215,2,140,255,215,2,177,255,215,
+2,179,255,215,2,225,255,215,2,227,255,215,2,239,255,215,2,241,255,215,2,243,
+255,215,3,21,255,215,3,25,255,215,3,73,255,215,3,75,255,215,3,77,255,215,
+3,79,255,215,3,81,255,215,3,83,255,215,3,85,255,215,3,87,255,215,3,89,255,
+215,3,91,255,215,3,93,255,215,3,95,255,215,0,100,0,5,255,154,0,10,255,154,
+0,38,255,236,0,42,255,236,0,50,255,236,0,52,255,236,0,55,255,133,0,56,255,
+236,0,57,255,174,0,58,255,195,0,60,255,154,0,137,255,236,0,148,255,236,0,
+149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,0,155,
+255,236,0,156,255,236,0,157,255,236,0,158,255,236,0,159,255,154,0,200,255,
+236,0,206,255,236,0,222,255,236,0,224,255,236,0,226,255,236,0,228,255,236,
+1,14,255,236,1,18,255,236,1,20,255,236,1,36,255,133,1,38,255,133,1,44,255,
+236,1,48,255,236,1,50,255,236,1,52,255,236,1,54,255,195,1,56,255,154,1,58,
+255,154,1,102,255,236,1,109,255,236,1,113,255,133,1,184,255,236,1,187,255,
+236,1,188,255,133,1,250,255,195,1,252,255,195,1,254,255,195,2,0,255,154,2,
+7,255,154,2,11,255,154,2,95,255,236,2,97,255,236,2,108,255,236,2,126,255,
+236,2,132,255,236,2,134,255,236,2,136,255,236,2,138,255,236,2,140,255,236,
+2,169,255,133,2,177,255,236,2,179,255,236,2,181,255,133,2,183,255,133,2,185,
+255,133,2,189,255,133,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,
+236,2,243,255,236,3,21,255,236,3,23,255,133,3,25,255,236,3,73,255,236,3,75,
+255,236,3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,
+3,87,255,236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,236,3,97,255,
+236,3,99,255,236,3,101,255,236,3,103,255,236,3,105,255,236,3,107,255,236,
+3,109,255,236,3,111,255,154,3,113,255,154,3,115,255,154,3,131,255,133,0,76,
+0,15,255,195,0,17,255,195,0,36,255,236,0,44,255,236,0,55,255,195,0,57,255,
+215,0,58,255,236,0,59,255,215,0,60,255,215,0,61,255,236,0,130,255,236,0,131,
+255,236,0,132,255,236,0,133,255,236,0,134,255,236,0,135,255,236,0,136,255,
+215,0,142,255,236,0,143,255,236,0,144,255,236,0,145,255,236,0,159,255,215,
+0,194,255,236,0,196,255,236,0,198,255,236,0,236,255,236,0,240,255,236,0,242,
+255,236,1,36,255,195,1,38,255,195,1,54,255,236,1,56,255,215,1,58,255,215,
+1,59,255,236,1,61,255,236,1,63,255,236,1,67,255,236,1,95,255,236,1,105,255,
+236,1,113,255,195,1,170,255,236,1,188,255,195,1,250,255,236,1,252,255,236,
+1,254,255,236,2,0,255,215,2,40,255,236,2,88,255,236,2,114,255,236,2,169,255,
+195,2,181,255,195,2,183,255,195,2,185,255,195,2,189,255,195,2,217,255,236,
+2,219,255,236,2,221,255,236,3,23,255,195,3,29,255,236,3,31,255,236,3,33,255,
+236,3,35,255,236,3,37,255,236,3,39,255,236,3,41,255,236,3,43,255,236,3,45,
+255,236,3,47,255,236,3,49,255,236,3,51,255,236,3,69,255,236,3,71,255,236,
+3,111,255,215,3,113,255,215,3,115,255,215,3,131,255,195,0,53,0,15,255,51,
+0,17,255,51,0,36,255,174,0,38,255,236,0,59,255,236,0,60,255,236,0,61,255,
+215,0,130,255,174,0,131,255,174,0,132,255,174,0,133,255,174,0,134,255,174,
+0,135,255,174,0,136,255,113,0,137,255,236,0,159,255,236,0,194,255,174,0,196,
+255,174,0,198,255,174,0,200,255,236,0,206,255,236,1,56,255,236,1,58,255,236,
+1,59,255,215,1,61,255,215,1,63,255,215,1,67,255,174,1,95,255,174,1,105,255,
+174,1,170,255,174,1,187,255,236,2,0,255,236,2,40,255,174,2,88,255,174,2,114,
+255,174,2,217,255,174,2,219,255,174,2,221,255,174,3,29,255,174,3,31,255,174,
+3,33,255,174,3,35,255,174,3,37,255,174,3,39,255,174,3,41,255,174,3,43,255,
+174,3,45,255,174,3,47,255,174,3,49,255,174,3,51,255,174,3,111,255,236,3,113,
+255,236,3,115,255,236,0,76,0,15,255,195,0,17,255,195,0,36,255,236,0,44,255,
+236,0,55,255,195,0,57,255,215,0,58,255,236,0,59,255,215,0,60,255,215,0,61,
+255,236,0,130,255,236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,255,
+236,0,135,255,236,0,136,255,195,0,142,255,236,0,143,255,236,0,144,255,236,
+0,145,255,236,0,159,255,215,0,194,255,236,0,196,255,236,0,198,255,236,0,236,
+255,236,0,240,255,236,0,242,255,236,1,36,255,195,1,38,255,195,1,54,255,236,
+1,56,255,215,1,58,255,215,1,59,255,236,1,61,255,236,1,63,255,236,1,67,255,
+236,1,95,255,236,1,105,255,236,1,113,255,195,1,170,255,236,1,188,255,195,
+1,250,255,236,1,252,255,236,1,254,255,236,2,0,255,215,2,40,255,236,2,88,255,
+236,2,114,255,236,2,169,255,195,2,181,255,195,2,183,255,195,2,185,255,195,
+2,189,255,195,2,217,255,236,2,219,255,236,2,221,255,236,3,23,255,195,3,29,
+255,236,3,31,255,236,3,33,255,236,3,35,255,236,3,37,255,236,3,39,255,236,
+3,41,255,236,3,43,255,236,3,45,255,236,3,47,255,236,3,49,255,236,3,51,255,
+236,3,69,255,236,3,71,255,236,3,111,255,215,3,113,255,215,3,115,255,215,3,
+131,255,195,0,12,0,55,255,236,1,36,255,236,1,38,255,236,1,113,255,236,1,188,
+255,236,2,169,255,236,2,181,255,236,2,183,255,236,2,185,255,236,2,189,255,
+236,3,23,255,236,3,131,255,236,1,33,0,5,0,82,0,10,0,82,0,15,255,154,0,16,
+255,154,0,17,255,154,0,34,0,41,0,36,255,133,0,38,255,195,0,42,255,195,0,50,
+255,195,0,52,255,195,0,54,255,236,0,55,0,20,0,68,255,133,0,70,255,133,0,71,
+255,133,0,72,255,133,0,74,255,154,0,80,255,174,0,81,255,174,0,82,255,133,
+0,83,255,174,0,84,255,133,0,85,255,174,0,86,255,133,0,88,255,174,0,89,255,
+195,0,90,255,195,0,91,255,195,0,92,255,195,0,93,255,195,0,130,255,133,0,131,
+255,133,0,132,255,133,0,133,255,133,0,134,255,133,0,135,255,133,0,136,255,
+113,0,137,255,195,0,148,255,195,0,149,255,195,0,150,255,195,0,151,255,195,
+0,152,255,195,0,154,255,195,0,162,255,133,0,163,255,133,0,164,255,133,0,165,
+255,133,0,166,255,133,0,167,255,133,0,168,255,133,0,169,255,133,0,170,255,
+133,0,171,255,133,0,172,255,133,0,173,255,133,0,179,255,174,0,180,255,133,
+0,181,255,133,0,182,255,133,0,183,255,133,0,184,255,133,0,186,255,133,0,187,
+255,174,0,188,255,174,0,189,255,174,0,190,255,174,0,191,255,195,0,193,255,
+195,0,194,255,133,0,195,255,133,0,196,255,133,0,197,255,133,0,198,255,133,
+0,199,255,133,0,200,255,195,0,201,255,133,0,203,255,133,0,205,255,133,0,206,
+255,195,0,207,255,133,0,213,255,133,0,215,255,133,0,217,255,133,0,219,255,
+133,0,221,255,133,0,222,255,195,0,224,255,195,0,226,255,195,0,228,255,195,
+1,6,255,174,1,8,255,174,1,10,255,174,1,14,255,195,1,15,255,133,1,17,255,133,
+1,18,255,195,1,19,255,133,1,20,255,195,1,21,255,133,1,28,255,236,1,29,255,
+133,1,31,255,133,1,32,255,236,1,33,255,133,1,34,255,236,1,35,255,133,1,36,
+0,20,1,38,0,20,1,55,255,195,1,57,255,195,1,64,255,195,1,67,255,133,1,68,255,
+133,1,74,255,133,1,95,255,133,1,102,255,195,1,105,255,133,1,109,255,195,1,
+113,0,20,1,121,255,133,1,123,255,174,1,126,255,133,1,128,255,195,1,130,255,
+133,1,132,255,174,1,138,255,195,1,140,255,133,1,142,255,133,1,144,255,133,
+1,145,255,195,1,147,255,133,1,148,255,195,1,150,255,133,1,153,255,133,1,155,
+255,133,1,160,255,236,1,170,255,133,1,184,255,195,1,187,255,195,1,188,0,20,
+1,202,255,133,1,207,255,133,1,216,255,133,1,219,255,133,1,220,255,195,1,221,
+255,195,1,222,255,133,1,234,255,133,1,237,255,133,1,238,255,133,1,251,255,
+195,1,253,255,195,1,255,255,195,2,1,255,195,2,2,255,174,2,3,255,154,2,7,0,
+82,2,11,0,82,2,40,255,133,2,88,255,133,2,89,255,133,2,95,255,195,2,96,255,
+133,2,106,255,133,2,108,255,195,2,109,255,195,2,114,255,133,2,126,255,195,
+2,127,255,133,2,129,255,195,2,131,255,195,2,132,255,195,2,133,255,133,2,134,
+255,195,2,135,255,133,2,136,255,195,2,137,255,133,2,138,255,195,2,139,255,
+195,2,140,255,195,2,141,255,133,2,169,0,20,2,170,255,195,2,177,255,195,2,
+178,255,133,2,179,255,195,2,180,255,133,2,181,0,20,2,182,255,195,2,183,0,
+20,2,184,255,195,2,185,0,20,2,186,255,195,2,189,0,20,2,217,255,133,2,218,
+255,133,2,219,255,133,2,220,255,133,2,221,255,133,2,224,255,133,2,225,255,
+195,2,227,255,195,2,239,255,195,2,240,255,133,2,241,255,195,2,242,255,133,
+2,243,255,195,2,244,255,133,2,248,255,195,2,250,255,195,2,252,255,195,3,10,
+255,133,3,12,255,133,3,14,255,195,3,16,255,195,3,21,255,195,3,22,255,133,
+3,23,0,20,3,24,255,195,3,25,255,195,3,26,255,133,3,29,255,133,3,30,255,133,
+3,31,255,133,3,33,255,133,3,34,255,133,3,35,255,133,3,36,255,133,3,37,255,
+133,3,38,255,133,3,39,255,133,3,40,255,133,3,41,255,133,3,42,255,133,3,43,
+255,133,3,44,255,133,3,45,255,133,3,46,255,133,3,47,255,133,3,48,255,133,
+3,49,255,133,3,50,255,133,3,51,255,133,3,52,255,133,3,54,255,133,3,56,255,
+133,3,58,255,133,3,60,255,133,3,62,255,133,3,64,255,133,3,66,255,133,3,68,
+255,133,3,73,255,195,3,74,255,133,3,75,255,195,3,76,255,133,3,77,255,195,
+3,78,255,133,3,79,255,195,3,80,255,133,3,81,255,195,3,82,255,133,3,83,255,
+195,3,84,255,133,3,85,255,195,3,86,255,133,3,87,255,195,3,88,255,133,3,89,
+255,195,3,90,255,133,3,91,255,195,3,92,255,133,3,93,255,195,3,94,255,133,
+3,95,255,195,3,96,255,133,3,98,255,174,3,100,255,174,3,102,255,174,3,104,
+255,174,3,106,255,174,3,108,255,174,3,110,255,174,3,112,255,195,3,114,255,
+195,3,116,255,195,3,131,0,20,0,35,0,15,255,215,0,17,255,215,0,36,255,236,
+0,130,255,236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,255,236,0,135,
+255,236,0,136,255,215,0,194,255,236,0,196,255,236,0,198,255,236,1,67,255,
+236,1,95,255,236,1,105,255,236,1,170,255,236,2,40,255,236,2,88,255,236,2,
+114,255,236,2,217,255,236,2,219,255,236,2,221,255,236,3,29,255,236,3,31,255,
+236,3,33,255,236,3,35,255,236,3,37,255,236,3,39,255,236,3,41,255,236,3,43,
+255,236,3,45,255,236,3,47,255,236,3,49,255,236,3,51,255,236,0,232,0,5,0,82,
+0,10,0,82,0,15,255,154,0,17,255,154,0,34,0,41,0,36,255,195,0,38,255,215,0,
+42,255,215,0,50,255,215,0,52,255,215,0,68,255,195,0,70,255,195,0,71,255,195,
+0,72,255,195,0,74,255,195,0,80,255,215,0,81,255,215,0,82,255,195,0,83,255,
+215,0,84,255,195,0,85,255,215,0,86,255,215,0,88,255,215,0,130,255,195,0,131,
+255,195,0,132,255,195,0,133,255,195,0,134,255,195,0,135,255,195,0,136,255,
+133,0,137,255,215,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,
+0,152,255,215,0,154,255,215,0,162,255,195,0,163,255,195,0,164,255,195,0,165,
+255,195,0,166,255,195,0,167,255,195,0,168,255,195,0,169,255,195,0,170,255,
+195,0,171,255,195,0,172,255,195,0,173,255,195,0,179,255,215,0,180,255,195,
+0,181,255,195,0,182,255,195,0,183,255,195,0,184,255,195,0,186,255,195,0,187,
+255,215,0,188,255,215,0,189,255,215,0,190,255,215,0,194,255,195,0,195,255,
+195,0,196,255,195,0,197,255,195,0,198,255,195,0,199,255,195,0,200,255,215,
+0,201,255,195,0,203,255,195,0,205,255,195,0,206,255,215,0,207,255,195,0,213,
+255,195,0,215,255,195,0,217,255,195,0,219,255,195,0,221,255,195,0,222,255,
+215,0,224,255,215,0,226,255,215,0,228,255,215,1,6,255,215,1,8,255,215,1,10,
+255,215,1,14,255,215,1,15,255,195,1,17,255,195,1,18,255,215,1,19,255,195,
+1,20,255,215,1,21,255,195,1,29,255,215,1,31,255,215,1,33,255,215,1,35,255,
+215,1,67,255,195,1,68,255,195,1,74,255,215,1,95,255,195,1,102,255,215,1,105,
+255,195,1,109,255,215,1,121,255,195,1,123,255,215,1,126,255,195,1,130,255,
+195,1,132,255,215,1,140,255,195,1,142,255,195,1,144,255,195,1,147,255,195,
+1,150,255,195,1,153,255,195,1,155,255,195,1,170,255,195,1,184,255,215,1,187,
+255,215,1,202,255,195,1,207,255,195,1,216,255,195,1,219,255,195,1,222,255,
+195,1,234,255,195,1,237,255,195,1,238,255,215,2,7,0,82,2,11,0,82,2,40,255,
+195,2,88,255,195,2,89,255,195,2,95,255,215,2,96,255,195,2,106,255,195,2,108,
+255,215,2,114,255,195,2,126,255,215,2,127,255,195,2,132,255,215,2,133,255,
+195,2,134,255,215,2,135,255,195,2,136,255,215,2,137,255,195,2,138,255,215,
+2,140,255,215,2,141,255,195,2,177,255,215,2,178,255,195,2,179,255,215,2,180,
+255,195,2,217,255,195,2,218,255,195,2,219,255,195,2,220,255,195,2,221,255,
+195,2,224,255,195,2,225,255,215,2,227,255,215,2,239,255,215,2,240,255,195,
+2,241,255,215,2,242,255,195,2,243,255,215,2,244,255,195,3,10,255,195,3,12,
+255,195,3,21,255,215,3,22,255,195,3,25,255,215,3,26,255,195,3,29,255,195,
+3,30,255,195,3,31,255,195,3,33,255,195,3,34,255,195,3,35,255,195,3,36,255,
+195,3,37,255,195,3,38,255,195,3,39,255,195,3,40,255,195,3,41,255,195,3,42,
+255,195,3,43,255,195,3,44,255,195,3,45,255,195,3,46,255,195,3,47,255,195,
+3,48,255,195,3,49,255,195,3,50,255,195,3,51,255,195,3,52,255,195,3,54,255,
+195,3,56,255,195,3,58,255,195,3,60,255,195,3,62,255,195,3,64,255,195,3,66,
+255,195,3,68,255,195,3,73,255,215,3,74,255,195,3,75,255,215,3,76,255,195,
+3,77,255,215,3,78,255,195,3,79,255,215,3,80,255,195,3,81,255,215,3,82,255,
+195,3,83,255,215,3,84,255,195,3,85,255,215,3,86,255,195,3,87,255,215,3,88,
+255,195,3,89,255,215,3,90,255,195,3,91,255,215,3,92,255,195,3,93,255,215,
+3,94,255,195,3,95,255,215,3,96,255,195,3,98,255,215,3,100,255,215,3,102,255,
+215,3,104,255,215,3,106,255,215,3,108,255,215,3,110,255,215,0,233,0,5,0,102,
+0,10,0,102,0,15,255,174,0,17,255,174,0,36,255,215,0,38,255,236,0,42,255,236,
+0,50,255,236,0,52,255,236,0,68,255,215,0,70,255,215,0,71,255,215,0,72,255,
+215,0,74,255,236,0,80,255,236,0,81,255,236,0,82,255,215,0,83,255,236,0,84,
+255,215,0,85,255,236,0,86,255,215,0,88,255,236,0,93,255,236,0,130,255,215,
+0,131,255,215,0,132,255,215,0,133,255,215,0,134,255,215,0,135,255,215,0,136,
+255,174,0,137,255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,
+236,0,152,255,236,0,154,255,236,0,162,255,215,0,163,255,215,0,164,255,215,
+0,165,255,215,0,166,255,215,0,167,255,215,0,168,255,215,0,169,255,215,0,170,
+255,215,0,171,255,215,0,172,255,215,0,173,255,215,0,179,255,236,0,180,255,
+215,0,181,255,215,0,182,255,215,0,183,255,215,0,184,255,215,0,186,255,215,
+0,187,255,236,0,188,255,236,0,189,255,236,0,190,255,236,0,194,255,215,0,195,
+255,215,0,196,255,215,0,197,255,215,0,198,255,215,0,199,255,215,0,200,255,
+236,0,201,255,215,0,203,255,215,0,205,255,215,0,206,255,236,0,207,255,215,
+0,213,255,215,0,215,255,215,0,217,255,215,0,219,255,215,0,221,255,215,0,222,
+255,236,0,224,255,236,0,226,255,236,0,228,255,236,1,6,255,236,1,8,255,236,
+1,10,255,236,1,14,255,236,1,15,255,215,1,17,255,215,1,18,255,236,1,19,255,
+215,1,20,255,236,1,21,255,215,1,29,255,215,1,31,255,215,1,33,255,215,1,35,
+255,215,1,64,255,236,1,67,255,215,1,68,255,215,1,74,255,215,1,95,255,215,
+1,102,255,236,1,105,255,215,1,109,255,236,1,121,255,215,1,123,255,236,1,126,
+255,215,1,130,255,215,1,132,255,236,1,140,255,215,1,142,255,215,1,144,255,
+215,1,147,255,215,1,150,255,215,1,153,255,215,1,155,255,215,1,170,255,215,
+1,184,255,236,1,187,255,236,1,202,255,215,1,207,255,215,1,216,255,215,1,219,
+255,215,1,222,255,215,1,234,255,215,1,237,255,215,1,238,255,215,2,7,0,102,
+2,11,0,102,2,40,255,215,2,88,255,215,2,89,255,215,2,95,255,236,2,96,255,215,
+2,106,255,215,2,108,255,236,2,114,255,215,2,126,255,236,2,127,255,215,2,132,
+255,236,2,133,255,215,2,134,255,236,2,135,255,215,2,136,255,236,2,137,255,
+215,2,138,255,236,2,140,255,236,2,141,255,215,2,177,255,236,2,178,255,215,
+2,179,255,236,2,180,255,215,2,217,255,215,2,218,255,215,2,219,255,215,2,220,
+255,215,2,221,255,215,2,224,255,215,2,225,255,236,2,227,255,236,2,239,255,
+236,2,240,255,215,2,241,255,236,2,242,255,215,2,243,255,236,2,244,255,215,
+3,10,255,215,3,12,255,215,3,21,255,236,3,22,255,215,3,25,255,236,3,26,255,
+215,3,29,255,215,3,30,255,215,3,31,255,215,3,33,255,215,3,34,255,215,3,35,
+255,215,3,36,255,215,3,37,255,215,3,38,255,215,3,39,255,215,3,40,255,215,
+3,41,255,215,3,42,255,215,3,43,255,215,3,44,255,215,3,45,255,215,3,46,255,
+215,3,47,255,215,3,48,255,215,3,49,255,215,3,50,255,215,3,51,255,215,3,52,
+255,215,3,54,255,215,3,56,255,215,3,58,255,215,3,60,255,215,3,62,255,215,
+3,64,255,215,3,66,255,215,3,68,255,215,3,73,255,236,3,74,255,215,3,75,255,
+236,3,76,255,215,3,77,255,236,3,78,255,215,3,79,255,236,3,80,255,215,3,81,
+255,236,3,82,255,215,3,83,255,236,3,84,255,215,3,85,255,236,3,86,255,215,
+3,87,255,236,3,88,255,215,3,89,255,236,3,90,255,215,3,91,255,236,3,92,255,
+215,3,93,255,236,3,94,255,215,3,95,255,236,3,96,255,215,3,98,255,236,3,100,
+255,236,3,102,255,236,3,104,255,236,3,106,255,236,3,108,255,236,3,110,255,
+236,0,140,0,5,0,41,0,10,0,41,0,38,255,215,0,42,255,215,0,50,255,215,0,52,
+255,215,0,70,255,236,0,71,255,236,0,72,255,236,0,82,255,236,0,84,255,236,
+0,137,255,215,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,
+255,215,0,154,255,215,0,168,255,236,0,169,255,236,0,170,255,236,0,171,255,
+236,0,172,255,236,0,173,255,236,0,180,255,236,0,181,255,236,0,182,255,236,
+0,183,255,236,0,184,255,236,0,186,255,236,0,200,255,215,0,201,255,236,0,203,
+255,236,0,205,255,236,0,206,255,215,0,207,255,236,0,213,255,236,0,215,255,
+236,0,217,255,236,0,219,255,236,0,221,255,236,0,222,255,215,0,224,255,215,
+0,226,255,215,0,228,255,215,1,14,255,215,1,15,255,236,1,17,255,236,1,18,255,
+215,1,19,255,236,1,20,255,215,1,21,255,236,1,102,255,215,1,109,255,215,1,
+121,255,236,1,126,255,236,1,130,255,236,1,140,255,236,1,142,255,236,1,144,
+255,236,1,147,255,236,1,150,255,236,1,153,255,236,1,155,255,236,1,184,255,
+215,1,187,255,215,1,207,255,236,1,216,255,236,1,219,255,236,1,222,255,236,
+1,234,255,236,1,237,255,236,2,7,0,41,2,11,0,41,2,95,255,215,2,96,255,236,
+2,106,255,236,2,108,255,215,2,126,255,215,2,127,255,236,2,132,255,215,2,133,
+255,236,2,134,255,215,2,135,255,236,2,136,255,215,2,137,255,236,2,138,255,
+215,2,140,255,215,2,141,255,236,2,177,255,215,2,178,255,236,2,179,255,215,
+2,180,255,236,2,224,255,236,2,225,255,215,2,227,255,215,2,239,255,215,2,240,
+255,236,2,241,255,215,2,242,255,236,2,243,255,215,2,244,255,236,3,10,255,
+236,3,12,255,236,3,21,255,215,3,22,255,236,3,25,255,215,3,26,255,236,3,54,
+255,236,3,56,255,236,3,58,255,236,3,60,255,236,3,62,255,236,3,64,255,236,
+3,66,255,236,3,68,255,236,3,73,255,215,3,74,255,236,3,75,255,215,3,76,255,
+236,3,77,255,215,3,78,255,236,3,79,255,215,3,80,255,236,3,81,255,215,3,82,
+255,236,3,83,255,215,3,84,255,236,3,85,255,215,3,86,255,236,3,87,255,215,
+3,88,255,236,3,89,255,215,3,90,255,236,3,91,255,215,3,92,255,236,3,93,255,
+215,3,94,255,236,3,95,255,215,3,96,255,236,1,6,0,5,0,82,0,10,0,82,0,15,255,
+154,0,17,255,154,0,34,0,41,0,36,255,154,0,38,255,215,0,42,255,215,0,50,255,
+215,0,52,255,215,0,54,255,236,0,68,255,154,0,70,255,154,0,71,255,154,0,72,
+255,154,0,74,255,154,0,80,255,195,0,81,255,195,0,82,255,154,0,83,255,195,
+0,84,255,154,0,85,255,195,0,86,255,174,0,88,255,195,0,91,255,215,0,92,255,
+236,0,93,255,195,0,130,255,154,0,131,255,154,0,132,255,154,0,133,255,154,
+0,134,255,154,0,135,255,154,0,136,255,113,0,137,255,215,0,148,255,215,0,149,
+255,215,0,150,255,215,0,151,255,215,0,152,255,215,0,154,255,215,0,162,255,
+154,0,163,255,154,0,164,255,154,0,165,255,154,0,166,255,154,0,167,255,154,
+0,168,255,154,0,169,255,154,0,170,255,154,0,171,255,154,0,172,255,154,0,173,
+255,154,0,179,255,195,0,180,255,154,0,181,255,154,0,182,255,154,0,183,255,
+154,0,184,255,154,0,186,255,154,0,187,255,195,0,188,255,195,0,189,255,195,
+0,190,255,195,0,191,255,236,0,193,255,236,0,194,255,154,0,195,255,154,0,196,
+255,154,0,197,255,154,0,198,255,154,0,199,255,154,0,200,255,215,0,201,255,
+154,0,203,255,154,0,205,255,154,0,206,255,215,0,207,255,154,0,213,255,154,
+0,215,255,154,0,217,255,154,0,219,255,154,0,221,255,154,0,222,255,215,0,224,
+255,215,0,226,255,215,0,228,255,215,1,6,255,195,1,8,255,195,1,10,255,195,
+1,14,255,215,1,15,255,154,1,17,255,154,1,18,255,215,1,19,255,154,1,20,255,
+215,1,21,255,154,1,28,255,236,1,29,255,174,1,31,255,174,1,32,255,236,1,33,
+255,174,1,34,255,236,1,35,255,174,1,57,255,236,1,64,255,195,1,67,255,154,
+1,68,255,154,1,74,255,174,1,95,255,154,1,102,255,215,1,105,255,154,1,109,
+255,215,1,121,255,154,1,123,255,195,1,126,255,154,1,128,255,236,1,130,255,
+154,1,132,255,195,1,138,255,236,1,140,255,154,1,142,255,154,1,144,255,154,
+1,147,255,154,1,150,255,154,1,153,255,154,1,155,255,154,1,160,255,236,1,170,
+255,154,1,184,255,215,1,187,255,215,1,202,255,154,1,207,255,154,1,216,255,
+154,1,219,255,154,1,221,255,236,1,222,255,154,1,234,255,154,1,237,255,154,
+1,238,255,174,2,1,255,236,2,7,0,82,2,11,0,82,2,40,255,154,2,88,255,154,2,
+89,255,154,2,95,255,215,2,96,255,154,2,106,255,154,2,108,255,215,2,109,255,
+236,2,114,255,154,2,126,255,215,2,127,255,154,2,129,255,236,2,131,255,236,
+2,132,255,215,2,133,255,154,2,134,255,215,2,135,255,154,2,136,255,215,2,137,
+255,154,2,138,255,215,2,139,255,236,2,140,255,215,2,141,255,154,2,177,255,
+215,2,178,255,154,2,179,255,215,2,180,255,154,2,184,255,236,2,186,255,236,
+2,217,255,154,2,218,255,154,2,219,255,154,2,220,255,154,2,221,255,154,2,224,
+255,154,2,225,255,215,2,227,255,215,2,239,255,215,2,240,255,154,2,241,255,
+215,2,242,255,154,2,243,255,215,2,244,255,154,2,248,255,236,2,250,255,236,
+2,252,255,236,3,10,255,154,3,12,255,154,3,14,255,236,3,16,255,236,3,21,255,
+215,3,22,255,154,3,25,255,215,3,26,255,154,3,29,255,154,3,30,255,154,3,31,
+255,154,3,33,255,154,3,34,255,154,3,35,255,154,3,36,255,154,3,37,255,154,
+3,38,255,154,3,39,255,154,3,40,255,154,3,41,255,154,3,42,255,154,3,43,255,
+154,3,44,255,154,3,45,255,154,3,46,255,154,3,47,255,154,3,48,255,154,3,49,
+255,154,3,50,255,154,3,51,255,154,3,52,255,154,3,54,255,154,3,56,255,154,
+3,58,255,154,3,60,255,154,3,62,255,154,3,64,255,154,3,66,255,154,3,68,255,
+154,3,73,255,215,3,74,255,154,3,75,255,215,3,76,255,154,3,77,255,215,3,78,
+255,154,3,79,255,215,3,80,255,154,3,81,255,215,3,82,255,154,3,83,255,215,
+3,84,255,154,3,85,255,215,3,86,255,154,3,87,255,215,3,88,255,154,3,89,255,
+215,3,90,255,154,3,91,255,215,3,92,255,154,3,93,255,215,3,94,255,154,3,95,
+255,215,3,96,255,154,3,98,255,195,3,100,255,195,3,102,255,195,3,104,255,195,
+3,106,255,195,3,108,255,195,3,110,255,195,3,112,255,236,3,114,255,236,3,116,
+255,236,0,57,0,5,0,41,0,10,0,41,0,38,255,236,0,42,255,236,0,50,255,236,0,
+52,255,236,0,137,255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,
+255,236,0,152,255,236,0,154,255,236,0,200,255,236,0,206,255,236,0,222,255,
+236,0,224,255,236,0,226,255,236,0,228,255,236,1,14,255,236,1,18,255,236,1,
+20,255,215,1,102,255,236,1,109,255,236,1,184,255,236,1,187,255,236,2,7,0,
+41,2,11,0,41,2,95,255,236,2,108,255,236,2,126,255,236,2,132,255,236,2,134,
+255,236,2,136,255,236,2,138,255,236,2,140,255,236,2,177,255,236,2,179,255,
+236,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,255,236,
+3,21,255,236,3,25,255,236,3,73,255,236,3,75,255,236,3,77,255,236,3,79,255,
+236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,236,3,91,
+255,236,3,93,255,236,3,95,255,236,0,1,0,10,255,215,0,4,0,5,0,61,0,10,0,61,
+2,7,0,61,2,11,0,61,0,38,0,5,0,102,0,10,0,102,0,89,0,20,0,90,0,20,0,92,0,20,
+0,191,0,20,0,193,0,20,1,55,0,20,1,57,0,20,1,128,0,20,1,138,0,20,1,145,0,20,
+1,148,0,20,1,220,0,20,1,221,0,20,1,251,0,20,1,253,0,20,1,255,0,20,2,1,0,20,
+2,7,0,102,2,11,0,102,2,109,0,20,2,129,0,20,2,131,0,20,2,139,0,20,2,170,0,
+20,2,182,0,20,2,184,0,20,2,186,0,20,2,248,0,20,2,250,0,20,2,252,0,20,3,14,
+0,20,3,16,0,20,3,24,0,20,3,112,0,20,3,114,0,20,3,116,0,20,0,5,0,5,0,41,0,
+10,0,41,0,74,0,20,2,7,0,41,2,11,0,41,0,1,0,10,255,195,0,4,0,5,0,41,0,10,0,
+41,2,7,0,41,2,11,0,41,0,3,0,91,255,215,0,93,255,236,1,64,255,236,0,31,0,5,
+0,102,0,10,0,102,0,68,255,236,0,74,255,236,0,162,255,236,0,163,255,236,0,
+164,255,236,0,165,255,236,0,166,255,236,0,167,255,236,0,195,255,236,0,197,
+255,236,0,199,255,236,1,68,255,236,1,202,255,236,2,7,0,102,2,11,0,102,2,89,
+255,236,2,218,255,236,2,220,255,236,3,30,255,236,3,34,255,236,3,36,255,236,
+3,38,255,236,3,40,255,236,3,42,255,236,3,44,255,236,3,46,255,236,3,48,255,
+236,3,50,255,236,3,52,255,236,0,5,0,5,0,82,0,10,0,82,0,87,0,20,2,7,0,82,2,
+11,0,82,0,5,0,5,0,82,0,10,0,82,0,73,0,20,2,7,0,82,2,11,0,82,0,54,0,5,0,41,
+0,10,0,41,0,82,255,215,0,168,255,215,0,180,255,215,0,181,255,215,0,182,255,
+215,0,183,255,215,0,184,255,215,0,186,255,215,1,15,255,215,1,17,255,215,1,
+19,255,215,1,21,255,215,1,140,255,215,1,142,255,215,1,144,255,215,1,147,255,
+215,1,150,255,215,1,153,255,215,1,155,255,215,1,216,255,215,1,222,255,215,
+2,7,0,41,2,11,0,41,2,96,255,215,2,106,255,215,2,127,255,215,2,133,255,215,
+2,135,255,215,2,137,255,215,2,141,255,215,2,178,255,215,2,180,255,215,2,224,
+255,215,2,240,255,215,2,242,255,215,2,244,255,215,3,10,255,215,3,12,255,215,
+3,22,255,215,3,26,255,215,3,74,255,215,3,76,255,215,3,78,255,215,3,80,255,
+215,3,82,255,215,3,84,255,215,3,86,255,215,3,88,255,215,3,90,255,215,3,92,
+255,215,3,94,255,215,3,96,255,215,0,5,0,5,0,61,0,10,0,61,0,73,0,20,2,7,0,
+61,2,11,0,61,0,50,0,82,255,236,0,168,255,236,0,180,255,236,0,181,255,236,
+0,182,255,236,0,183,255,236,0,184,255,236,0,186,255,236,1,15,255,236,1,17,
+255,236,1,19,255,236,1,21,255,236,1,140,255,236,1,142,255,236,1,144,255,236,
+1,147,255,236,1,150,255,236,1,153,255,236,1,155,255,236,1,216,255,236,1,222,
+255,236,2,96,255,236,2,106,255,236,2,127,255,236,2,133,255,236,2,135,255,
+236,2,137,255,236,2,141,255,236,2,178,255,236,2,180,255,236,2,224,255,236,
+2,240,255,236,2,242,255,236,2,244,255,236,3,10,255,236,3,12,255,236,3,22,
+255,236,3,26,255,236,3,74,255,236,3,76,255,236,3,78,255,236,3,80,255,236,
+3,82,255,236,3,84,255,236,3,86,255,236,3,88,255,236,3,90,255,236,3,92,255,
+236,3,94,255,236,3,96,255,236,0,3,1,113,255,215,1,120,255,215,1,145,0,41,
+0,3,1,113,255,154,1,114,255,195,1,120,255,195,0,148,0,5,255,174,0,10,255,
+174,0,13,255,133,0,15,0,68,0,30,0,68,0,34,255,195,0,38,255,236,0,42,255,236,
+0,45,0,94,0,50,255,236,0,52,255,236,0,55,255,133,0,56,255,236,0,57,255,195,
+0,58,255,215,0,60,255,154,0,61,0,59,0,73,255,236,0,87,255,236,0,89,255,215,
+0,90,255,236,0,92,255,215,0,130,255,215,0,137,255,236,0,148,255,236,0,149,
+255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,0,155,255,
+236,0,156,255,236,0,157,255,236,0,158,255,236,0,159,255,154,0,191,255,215,
+0,193,255,215,0,200,255,236,0,206,255,236,0,222,255,236,0,224,255,236,0,226,
+255,236,0,228,255,236,0,246,0,94,1,14,255,236,1,18,255,236,1,20,255,215,1,
+36,255,133,1,38,255,133,1,44,255,236,1,48,255,236,1,50,255,236,1,52,255,236,
+1,54,255,215,1,55,255,236,1,56,255,154,1,57,255,215,1,58,255,154,1,59,0,59,
+1,61,0,59,1,63,0,59,1,102,255,236,1,109,255,236,1,113,255,133,1,128,255,215,
+1,138,255,215,1,145,255,215,1,148,255,215,1,163,0,94,1,184,255,236,1,187,
+255,236,1,188,255,133,1,220,255,215,1,221,255,215,1,250,255,215,1,251,255,
+236,1,252,255,215,1,253,255,236,1,254,255,215,1,255,255,236,2,0,255,154,2,
+1,255,215,2,7,255,174,2,11,255,174,2,95,255,236,2,97,255,236,2,108,255,236,
+2,109,255,215,2,126,255,236,2,129,255,215,2,131,255,215,2,132,255,236,2,134,
+255,236,2,136,255,236,2,138,255,236,2,139,255,215,2,140,255,236,2,169,255,
+133,2,170,255,215,2,177,255,236,2,179,255,236,2,181,255,133,2,182,255,215,
+2,183,255,133,2,184,255,215,2,185,255,133,2,186,255,215,2,189,255,133,2,225,
+255,236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,255,236,2,248,255,
+215,2,250,255,215,2,252,255,215,3,14,255,215,3,16,255,215,3,21,255,236,3,
+23,255,133,3,24,255,215,3,25,255,236,3,73,255,236,3,75,255,236,3,77,255,236,
+3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,
+236,3,91,255,236,3,93,255,236,3,95,255,236,3,97,255,236,3,99,255,236,3,101,
+255,236,3,103,255,236,3,105,255,236,3,107,255,236,3,109,255,236,3,111,255,
+154,3,112,255,215,3,113,255,154,3,114,255,215,3,115,255,154,3,116,255,215,
+3,131,255,133,0,145,0,5,255,174,0,10,255,174,0,13,255,133,0,15,0,68,0,30,
+0,68,0,34,255,195,0,38,255,236,0,42,255,236,0,50,255,236,0,52,255,236,0,55,
+255,133,0,56,255,236,0,57,255,195,0,58,255,215,0,60,255,154,0,61,0,59,0,73,
+255,236,0,87,255,236,0,89,255,215,0,90,255,236,0,92,255,215,0,137,255,236,
+0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,
+255,236,0,155,255,236,0,156,255,236,0,157,255,236,0,158,255,236,0,159,255,
+154,0,191,255,215,0,193,255,215,0,200,255,236,0,206,255,236,0,222,255,236,
+0,224,255,236,0,226,255,236,0,228,255,236,1,14,255,236,1,18,255,236,1,20,
+255,215,1,36,255,133,1,38,255,133,1,44,255,236,1,48,255,236,1,50,255,236,
+1,52,255,236,1,54,255,215,1,55,255,236,1,56,255,154,1,57,255,215,1,58,255,
+154,1,59,0,59,1,61,0,59,1,63,0,59,1,102,255,236,1,109,255,236,1,113,255,133,
+1,128,255,215,1,138,255,215,1,145,255,215,1,148,255,215,1,163,0,94,1,184,
+255,236,1,187,255,236,1,188,255,133,1,220,255,215,1,221,255,215,1,250,255,
+215,1,251,255,236,1,252,255,215,1,253,255,236,1,254,255,215,1,255,255,236,
+2,0,255,154,2,1,255,215,2,7,255,174,2,11,255,174,2,95,255,236,2,97,255,236,
+2,108,255,236,2,109,255,215,2,126,255,236,2,129,255,215,2,131,255,215,2,132,
+255,236,2,134,255,236,2,136,255,236,2,138,255,236,2,139,255,215,2,140,255,
+236,2,169,255,133,2,170,255,215,2,177,255,236,2,179,255,236,2,181,255,133,
+2,182,255,215,2,183,255,133,2,184,255,215,2,185,255,133,2,186,255,215,2,189,
+255,133,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,255,
+236,2,248,255,215,2,250,255,215,2,252,255,215,3,14,255,215,3,16,255,215,3,
+21,255,236,3,23,255,133,3,24,255,215,3,25,255,236,3,73,255,236,3,75,255,236,
+3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,
+236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,236,3,97,255,236,3,99,
+255,236,3,101,255,236,3,103,255,236,3,105,255,236,3,107,255,236,3,109,255,
+236,3,111,255,154,3,112,255,215,3,113,255,154,3,114,255,215,3,115,255,154,
+3,116,255,215,3,131,255,133,0,146,0,5,255,174,0,10,255,174,0,13,255,127,0,
+15,0,68,0,30,0,68,0,34,255,215,0,38,255,236,0,42,255,236,0,45,0,94,0,50,255,
+236,0,52,255,236,0,55,255,133,0,56,255,236,0,57,255,195,0,58,255,215,0,60,
+255,154,0,61,0,59,0,87,255,229,0,89,255,213,0,90,255,229,0,92,255,219,0,137,
+255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,
+236,0,154,255,236,0,155,255,236,0,156,255,236,0,157,255,236,0,158,255,236,
+0,159,255,154,0,191,255,219,0,193,255,219,0,200,255,236,0,206,255,236,0,222,
+255,236,0,224,255,236,0,226,255,236,0,228,255,236,0,246,0,94,1,14,255,236,
+1,18,255,236,1,20,255,215,1,36,255,133,1,38,255,133,1,44,255,236,1,48,255,
+236,1,50,255,236,1,52,255,236,1,54,255,215,1,55,255,229,1,56,255,154,1,57,
+255,219,1,58,255,154,1,59,0,59,1,61,0,59,1,63,0,59,1,102,255,236,1,109,255,
+236,1,113,255,133,1,128,255,219,1,138,255,213,1,145,255,213,1,148,255,213,
+1,163,0,94,1,184,255,236,1,187,255,236,1,188,255,133,1,220,255,213,1,221,
+255,219,1,250,255,215,1,251,255,229,1,252,255,215,1,253,255,229,1,254,255,
+215,1,255,255,229,2,0,255,154,2,1,255,219,2,7,255,174,2,11,255,174,2,95,255,
+236,2,97,255,236,2,108,255,236,2,109,255,219,2,126,255,236,2,129,255,219,
+2,131,255,219,2,132,255,236,2,134,255,236,2,136,255,236,2,138,255,236,2,139,
+255,219,2,140,255,236,2,169,255,133,2,170,255,213,2,177,255,236,2,179,255,
+236,2,181,255,133,2,182,255,213,2,183,255,133,2,184,255,219,2,185,255,133,
+2,186,255,219,2,189,255,133,2,225,255,236,2,227,255,236,2,239,255,236,2,241,
+255,236,2,243,255,236,2,248,255,219,2,250,255,219,2,252,255,219,3,14,255,
+219,3,16,255,219,3,21,255,236,3,23,255,133,3,24,255,213,3,25,255,236,3,73,
+255,236,3,75,255,236,3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,
+3,85,255,236,3,87,255,236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,
+236,3,97,255,236,3,99,255,236,3,101,255,236,3,103,255,236,3,105,255,236,3,
+107,255,236,3,109,255,236,3,111,255,154,3,112,255,219,3,113,255,154,3,114,
+255,219,3,115,255,154,3,116,255,219,3,131,255,133,0,149,0,5,255,102,0,10,
+255,102,0,13,255,127,0,15,0,68,0,30,0,68,0,34,255,215,0,38,255,236,0,42,255,
+236,0,45,0,94,0,50,255,236,0,52,255,236,0,55,255,133,0,56,255,236,0,57,255,
+195,0,58,255,215,0,60,255,154,0,61,0,59,0,87,255,229,0,89,255,213,0,90,255,
+229,0,92,255,219,0,137,255,236,0,148,255,236,0,149,255,236,0,150,255,236,
+0,151,255,236,0,152,255,236,0,154,255,236,0,155,255,236,0,156,255,236,0,157,
+255,236,0,158,255,236,0,159,255,154,0,191,255,219,0,193,255,219,0,200,255,
+236,0,206,255,236,0,222,255,236,0,224,255,236,0,226,255,236,0,228,255,236,
+0,246,0,94,1,14,255,236,1,18,255,236,1,20,255,215,1,36,255,133,1,38,255,133,
+1,44,255,236,1,48,255,236,1,50,255,236,1,52,255,236,1,54,255,215,1,55,255,
+229,1,56,255,154,1,57,255,219,1,58,255,154,1,59,0,59,1,61,0,59,1,63,0,59,
+1,102,255,236,1,109,255,236,1,113,255,133,1,128,255,219,1,138,255,213,1,145,
+255,213,1,148,255,213,1,163,0,94,1,184,255,236,1,187,255,236,1,188,255,133,
+1,220,255,213,1,221,255,219,1,250,255,215,1,251,255,229,1,252,255,215,1,253,
+255,229,1,254,255,215,1,255,255,229,2,0,255,154,2,1,255,219,2,6,255,102,2,
+7,255,174,2,10,255,102,2,11,255,174,2,32,255,154,2,95,255,236,2,97,255,236,
+2,108,255,236,2,109,255,219,2,126,255,236,2,129,255,219,2,131,255,219,2,132,
+255,236,2,134,255,236,2,136,255,236,2,138,255,236,2,139,255,219,2,140,255,
+236,2,169,255,133,2,170,255,213,2,177,255,236,2,179,255,236,2,181,255,133,
+2,182,255,213,2,183,255,133,2,184,255,219,2,185,255,133,2,186,255,219,2,189,
+255,133,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,255,
+236,2,248,255,219,2,250,255,219,2,252,255,219,3,14,255,219,3,16,255,219,3,
+21,255,236,3,23,255,133,3,24,255,213,3,25,255,236,3,73,255,236,3,75,255,236,
+3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,
+236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,236,3,97,255,236,3,99,
+255,236,3,101,255,236,3,103,255,236,3,105,255,236,3,107,255,236,3,109,255,
+236,3,111,255,154,3,112,255,219,3,113,255,154,3,114,255,219,3,115,255,154,
+3,116,255,219,3,131,255,133,0,57,0,5,0,41,0,10,0,41,0,16,255,215,0,38,255,
+236,0,50,255,236,0,52,255,236,0,132,255,236,0,137,255,236,0,138,255,236,0,
+143,255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,
+255,236,0,154,255,236,0,200,255,236,0,206,255,236,0,246,0,61,1,14,255,236,
+1,18,255,236,1,102,255,236,1,109,255,236,1,163,0,61,1,184,255,236,1,187,255,
+236,2,7,0,41,2,11,0,41,2,95,255,236,2,108,255,236,2,126,255,236,2,132,255,
+236,2,134,255,236,2,136,255,236,2,138,255,236,2,140,255,236,2,177,255,236,
+2,179,255,236,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,
+255,236,3,21,255,236,3,25,255,236,3,73,255,236,3,75,255,236,3,77,255,236,
+3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,
+236,3,91,255,236,3,93,255,236,3,95,255,236,0,55,0,5,0,41,0,10,0,41,0,16,255,
+215,0,38,255,236,0,50,255,236,0,52,255,236,0,137,255,236,0,139,255,236,0,
+148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,
+255,236,0,200,255,236,0,206,255,236,0,246,0,61,1,14,255,236,1,18,255,236,
+1,102,255,236,1,109,255,236,1,163,0,61,1,184,255,236,1,187,255,236,2,7,0,
+41,2,11,0,41,2,95,255,236,2,108,255,236,2,126,255,236,2,132,255,236,2,134,
+255,236,2,136,255,236,2,138,255,236,2,140,255,236,2,177,255,236,2,179,255,
+236,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,255,236,
+3,21,255,236,3,25,255,236,3,73,255,236,3,75,255,236,3,77,255,236,3,79,255,
+236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,236,3,91,
+255,236,3,93,255,236,3,95,255,236,0,32,0,36,255,236,0,130,255,236,0,131,255,
+236,0,132,255,236,0,133,255,236,0,134,255,236,0,135,255,236,0,194,255,236,
+0,196,255,236,0,198,255,236,1,67,255,236,1,95,255,236,1,105,255,236,1,170,
+255,236,2,40,255,236,2,88,255,236,2,114,255,236,2,217,255,236,2,219,255,236,
+2,221,255,236,3,29,255,236,3,31,255,236,3,33,255,236,3,35,255,236,3,37,255,
+236,3,39,255,236,3,41,255,236,3,43,255,236,3,45,255,236,3,47,255,236,3,49,
+255,236,3,51,255,236,0,87,0,12,255,215,0,15,255,195,0,17,255,195,0,36,255,
+236,0,44,255,236,0,45,255,246,0,54,255,236,0,55,255,195,0,57,255,215,0,58,
+255,236,0,59,255,215,0,60,255,215,0,61,255,236,0,64,255,215,0,96,255,215,
+0,130,255,236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,255,236,0,135,
+255,236,0,136,255,215,0,142,255,236,0,143,255,236,0,144,255,236,0,145,255,
+236,0,159,255,215,0,194,255,236,0,196,255,236,0,198,255,236,0,236,255,236,
+0,240,255,236,0,242,255,236,0,246,255,246,1,28,255,236,1,32,255,236,1,34,
+255,236,1,36,255,195,1,38,255,195,1,54,255,236,1,56,255,215,1,58,255,215,
+1,59,255,236,1,61,255,236,1,63,255,236,1,67,255,236,1,95,255,236,1,105,255,
+236,1,113,255,195,1,160,255,236,1,163,255,246,1,170,255,236,1,188,255,195,
+1,250,255,236,1,252,255,236,1,254,255,236,2,0,255,215,2,40,255,236,2,88,255,
+236,2,114,255,236,2,169,255,195,2,181,255,195,2,183,255,195,2,185,255,195,
+2,189,255,195,2,217,255,236,2,219,255,236,2,221,255,236,3,23,255,195,3,29,
+255,236,3,31,255,236,3,33,255,236,3,35,255,236,3,37,255,236,3,39,255,236,
+3,41,255,236,3,43,255,236,3,45,255,236,3,47,255,236,3,49,255,236,3,51,255,
+236,3,69,255,236,3,71,255,236,3,111,255,215,3,113,255,215,3,115,255,215,3,
+131,255,195,0,66,0,15,255,215,0,17,255,215,0,36,255,236,0,48,255,236,0,61,
+255,236,0,68,255,236,0,130,255,236,0,131,255,236,0,132,255,236,0,133,255,
+236,0,134,255,236,0,135,255,236,0,136,255,215,0,162,255,236,0,163,255,236,
+0,164,255,236,0,165,255,236,0,166,255,236,0,167,255,236,0,194,255,236,0,195,
+255,236,0,196,255,236,0,197,255,236,0,198,255,236,0,199,255,236,1,59,255,
+236,1,61,255,236,1,63,255,236,1,67,255,236,1,68,255,236,1,95,255,236,1,105,
+255,236,1,170,255,236,1,202,255,236,2,40,255,236,2,88,255,236,2,89,255,236,
+2,114,255,236,2,217,255,236,2,218,255,236,2,219,255,236,2,220,255,236,2,221,
+255,236,3,29,255,236,3,30,255,236,3,31,255,236,3,33,255,236,3,34,255,236,
+3,35,255,236,3,36,255,236,3,37,255,236,3,38,255,236,3,39,255,236,3,40,255,
+236,3,41,255,236,3,42,255,236,3,43,255,236,3,44,255,236,3,45,255,236,3,46,
+255,236,3,47,255,236,3,48,255,236,3,49,255,236,3,50,255,236,3,51,255,236,
+3,52,255,236,1,47,0,5,0,82,0,9,255,195,0,10,0,82,0,12,0,61,0,13,0,41,0,15,
+255,154,0,16,255,154,0,17,255,154,0,34,0,41,0,36,255,154,0,38,255,215,0,42,
+255,215,0,45,255,190,0,48,255,195,0,50,255,215,0,52,255,215,0,54,255,236,
+0,55,0,39,0,57,0,41,0,58,0,20,0,64,0,61,0,68,255,154,0,70,255,154,0,71,255,
+154,0,72,255,154,0,73,255,229,0,74,255,154,0,80,255,195,0,81,255,195,0,82,
+255,154,0,83,255,195,0,84,255,154,0,85,255,195,0,86,255,174,0,88,255,195,
+0,89,255,215,0,90,255,236,0,91,255,215,0,92,255,236,0,93,255,195,0,96,0,61,
+0,130,255,154,0,131,255,154,0,132,255,154,0,133,255,154,0,134,255,154,0,135,
+255,154,0,136,255,113,0,137,255,215,0,148,255,215,0,149,255,215,0,150,255,
+215,0,151,255,215,0,152,255,215,0,154,255,215,0,162,255,154,0,163,255,154,
+0,164,255,154,0,165,255,154,0,166,255,154,0,167,255,154,0,168,255,154,0,169,
+255,154,0,170,255,154,0,171,255,154,0,172,255,154,0,173,255,154,0,179,255,
+195,0,180,255,154,0,181,255,154,0,182,255,154,0,183,255,154,0,184,255,154,
+0,186,255,154,0,187,255,195,0,188,255,195,0,189,255,195,0,190,255,195,0,191,
+255,236,0,193,255,236,0,194,255,154,0,195,255,154,0,196,255,154,0,197,255,
+154,0,198,255,154,0,199,255,154,0,200,255,215,0,201,255,154,0,203,255,154,
+0,205,255,154,0,206,255,215,0,207,255,154,0,213,255,154,0,215,255,154,0,217,
+255,154,0,219,255,154,0,221,255,154,0,222,255,215,0,224,255,215,0,226,255,
+215,0,228,255,215,0,246,255,190,1,6,255,195,1,8,255,195,1,10,255,195,1,14,
+255,215,1,15,255,154,1,17,255,154,1,18,255,215,1,19,255,154,1,20,255,215,
+1,21,255,154,1,28,255,236,1,29,255,174,1,31,255,174,1,32,255,236,1,33,255,
+174,1,34,255,236,1,35,255,174,1,36,0,39,1,38,0,39,1,54,0,20,1,55,255,236,
+1,57,255,236,1,64,255,195,1,67,255,154,1,68,255,154,1,74,255,174,1,95,255,
+154,1,102,255,215,1,105,255,154,1,109,255,215,1,113,0,39,1,121,255,154,1,
+123,255,195,1,126,255,154,1,128,255,236,1,130,255,154,1,132,255,195,1,138,
+255,215,1,140,255,154,1,142,255,154,1,144,255,154,1,145,255,215,1,147,255,
+154,1,148,255,215,1,150,255,154,1,153,255,154,1,155,255,154,1,160,255,236,
+1,163,255,190,1,170,255,154,1,184,255,215,1,187,255,215,1,188,0,39,1,202,
+255,154,1,207,255,154,1,216,255,154,1,219,255,154,1,220,255,215,1,221,255,
+236,1,222,255,154,1,234,255,154,1,237,255,154,1,238,255,174,1,250,0,20,1,
+251,255,236,1,252,0,20,1,253,255,236,1,254,0,20,1,255,255,236,2,1,255,236,
+2,7,0,82,2,11,0,82,2,40,255,154,2,88,255,154,2,89,255,154,2,95,255,215,2,
+96,255,154,2,106,255,154,2,108,255,215,2,109,255,236,2,114,255,154,2,126,
+255,215,2,127,255,154,2,129,255,236,2,131,255,236,2,132,255,215,2,133,255,
+154,2,134,255,215,2,135,255,154,2,136,255,215,2,137,255,154,2,138,255,215,
+2,139,255,236,2,140,255,215,2,141,255,154,2,169,0,39,2,170,255,215,2,177,
+255,215,2,178,255,154,2,179,255,215,2,180,255,154,2,181,0,39,2,182,255,215,
+2,183,0,39,2,184,255,236,2,185,0,39,2,186,255,236,2,189,0,39,2,217,255,154,
+2,218,255,154,2,219,255,154,2,220,255,154,2,221,255,154,2,224,255,154,2,225,
+255,215,2,227,255,215,2,239,255,215,2,240,255,154,2,241,255,215,2,242,255,
+154,2,243,255,215,2,244,255,154,2,248,255,236,2,250,255,236,2,252,255,236,
+3,10,255,154,3,12,255,154,3,14,255,236,3,16,255,236,3,21,255,215,3,22,255,
+154,3,23,0,39,3,24,255,215,3,25,255,215,3,26,255,154,3,29,255,154,3,30,255,
+154,3,31,255,154,3,33,255,154,3,34,255,154,3,35,255,154,3,36,255,154,3,37,
+255,154,3,38,255,154,3,39,255,154,3,40,255,154,3,41,255,154,3,42,255,154,
+3,43,255,154,3,44,255,154,3,45,255,154,3,46,255,154,3,47,255,154,3,48,255,
+154,3,49,255,154,3,50,255,154,3,51,255,154,3,52,255,154,3,54,255,154,3,56,
+255,154,3,58,255,154,3,60,255,154,3,62,255,154,3,64,255,154,3,66,255,154,
+3,68,255,154,3,73,255,215,3,74,255,154,3,75,255,215,3,76,255,154,3,77,255,
+215,3,78,255,154,3,79,255,215,3,80,255,154,3,81,255,215,3,82,255,154,3,83,
+255,215,3,84,255,154,3,85,255,215,3,86,255,154,3,87,255,215,3,88,255,154,
+3,89,255,215,3,90,255,154,3,91,255,215,3,92,255,154,3,93,255,215,3,94,255,
+154,3,95,255,215,3,96,255,154,3,98,255,195,3,100,255,195,3,102,255,195,3,
+104,255,195,3,106,255,195,3,108,255,195,3,110,255,195,3,112,255,236,3,114,
+255,236,3,116,255,236,3,131,0,39,0,2,0,5,255,152,0,10,255,215,0,3,0,5,255,
+152,0,10,255,215,2,11,255,215,0,6,0,5,255,111,0,10,255,111,0,73,255,219,0,
+91,255,215,0,93,255,236,1,64,255,236,0,2,0,5,255,190,0,10,255,190,0,97,0,
+5,0,61,0,10,0,61,0,15,255,190,0,17,255,190,0,34,255,180,0,70,255,246,0,71,
+255,246,0,72,255,246,0,73,0,20,0,74,255,246,0,82,255,246,0,84,255,246,0,87,
+0,6,0,168,255,246,0,169,255,246,0,170,255,246,0,171,255,246,0,172,255,246,
+0,173,255,246,0,180,255,246,0,181,255,246,0,182,255,246,0,183,255,246,0,184,
+255,246,0,186,255,246,0,201,255,246,0,203,255,246,0,205,255,246,0,207,255,
+246,0,213,255,246,0,215,255,246,0,217,255,246,0,219,255,246,0,221,255,246,
+1,15,255,246,1,17,255,246,1,19,255,246,1,21,255,246,1,121,255,246,1,126,255,
+246,1,130,255,246,1,140,255,246,1,142,255,246,1,144,255,246,1,147,255,246,
+1,150,255,246,1,153,255,246,1,155,255,246,1,207,255,246,1,216,255,246,1,219,
+255,246,1,222,255,246,1,234,255,246,1,237,255,246,2,7,0,61,2,8,255,141,2,
+11,0,61,2,12,255,141,2,16,255,129,2,21,0,12,2,96,255,246,2,106,255,246,2,
+127,255,246,2,133,255,246,2,135,255,246,2,137,255,246,2,141,255,246,2,178,
+255,246,2,180,255,246,2,224,255,246,2,240,255,246,2,242,255,246,2,244,255,
+246,3,10,255,246,3,12,255,246,3,22,255,246,3,26,255,246,3,54,255,246,3,56,
+255,246,3,58,255,246,3,60,255,246,3,62,255,246,3,64,255,246,3,66,255,246,
+3,68,255,246,3,74,255,246,3,76,255,246,3,78,255,246,3,80,255,246,3,82,255,
+246,3,84,255,246,3,86,255,246,3,88,255,246,3,90,255,246,3,92,255,246,3,94,
+255,246,3,96,255,246,0,7,0,5,0,61,0,10,0,61,0,15,255,190,0,17,255,190,0,73,
+0,20,2,7,0,61,2,11,0,61,0,101,0,5,255,174,0,10,255,174,0,38,255,236,0,42,
+255,236,0,45,0,225,0,50,255,236,0,52,255,236,0,55,255,133,0,56,255,236,0,
+57,255,195,0,58,255,215,0,60,255,154,0,137,255,236,0,148,255,236,0,149,255,
+236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,0,155,255,236,
+0,156,255,236,0,157,255,236,0,158,255,236,0,159,255,154,0,200,255,236,0,206,
+255,236,0,222,255,236,0,224,255,236,0,226,255,236,0,228,255,236,1,14,255,
+236,1,18,255,236,1,20,255,215,1,36,255,133,1,38,255,133,1,44,255,236,1,48,
+255,236,1,50,255,236,1,52,255,236,1,54,255,215,1,56,255,154,1,58,255,154,
+1,102,255,236,1,109,255,236,1,113,255,133,1,184,255,236,1,187,255,236,1,188,
+255,133,1,250,255,215,1,252,255,215,1,254,255,215,2,0,255,154,2,7,255,174,
+2,11,255,174,2,95,255,236,2,97,255,236,2,108,255,236,2,126,255,236,2,132,
+255,236,2,134,255,236,2,136,255,236,2,138,255,236,2,140,255,236,2,169,255,
+133,2,177,255,236,2,179,255,236,2,181,255,133,2,183,255,133,2,185,255,133,
+2,189,255,133,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,
+255,236,3,21,255,236,3,23,255,133,3,25,255,236,3,73,255,236,3,75,255,236,
+3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,
+236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,236,3,97,255,236,3,99,
+255,236,3,101,255,236,3,103,255,236,3,105,255,236,3,107,255,236,3,109,255,
+236,3,111,255,154,3,113,255,154,3,115,255,154,3,131,255,133,0,31,0,5,0,102,
+0,10,0,102,0,12,0,143,0,34,0,164,0,64,0,164,0,69,0,82,0,75,0,82,0,76,0,61,
+0,77,0,61,0,78,0,82,0,79,0,82,0,96,0,184,0,174,0,246,0,176,0,205,0,177,0,
+205,0,231,0,82,0,233,0,164,0,235,1,10,0,237,0,205,0,239,0,246,0,241,0,41,
+0,245,0,61,0,247,0,225,0,249,0,82,0,252,0,82,0,254,0,82,1,0,0,82,1,2,0,82,
+1,4,0,82,2,7,0,143,2,11,0,143,0,1,0,45,0,102,0,58,0,5,0,41,0,10,0,41,0,38,
+255,236,0,42,255,236,0,45,0,82,0,50,255,236,0,52,255,236,0,137,255,236,0,
+148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,
+255,236,0,200,255,236,0,206,255,236,0,222,255,236,0,224,255,236,0,226,255,
+236,0,228,255,236,1,14,255,236,1,18,255,236,1,20,255,236,1,102,255,236,1,
+109,255,236,1,184,255,236,1,187,255,236,2,7,0,41,2,11,0,41,2,95,255,236,2,
+108,255,236,2,126,255,236,2,132,255,236,2,134,255,236,2,136,255,236,2,138,
+255,236,2,140,255,236,2,177,255,236,2,179,255,236,2,225,255,236,2,227,255,
+236,2,239,255,236,2,241,255,236,2,243,255,236,3,21,255,236,3,25,255,236,3,
+73,255,236,3,75,255,236,3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,
+3,85,255,236,3,87,255,236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,
+236,0,67,0,5,0,41,0,10,0,41,0,48,0,20,0,54,255,236,0,55,255,215,0,57,255,
+236,0,58,255,236,0,59,255,215,0,60,255,215,0,89,255,236,0,92,255,236,0,159,
+255,215,0,191,255,236,0,193,255,236,1,28,255,236,1,32,255,236,1,34,255,236,
+1,35,255,236,1,36,255,215,1,38,255,215,1,54,255,236,1,56,255,215,1,57,255,
+236,1,58,255,215,1,113,255,215,1,128,255,236,1,138,255,236,1,145,255,236,
+1,148,255,236,1,160,255,236,1,188,255,215,1,220,255,236,1,221,255,236,1,250,
+255,236,1,252,255,236,1,254,255,236,2,0,255,215,2,1,255,236,2,7,0,41,2,11,
+0,41,2,109,255,236,2,129,255,236,2,131,255,236,2,139,255,236,2,169,255,215,
+2,170,255,236,2,181,255,215,2,182,255,236,2,183,255,215,2,184,255,236,2,185,
+255,215,2,186,255,236,2,189,255,215,2,248,255,236,2,250,255,236,2,252,255,
+236,3,14,255,236,3,16,255,236,3,23,255,215,3,24,255,236,3,111,255,215,3,112,
+255,236,3,113,255,215,3,114,255,236,3,115,255,215,3,116,255,236,3,131,255,
+215,1,30,0,5,0,82,0,10,0,82,0,15,255,154,0,17,255,154,0,34,0,41,0,36,255,
+133,0,38,255,195,0,42,255,195,0,50,255,195,0,52,255,195,0,54,255,236,0,55,
+0,20,0,68,255,133,0,70,255,133,0,71,255,133,0,72,255,133,0,74,255,154,0,80,
+255,174,0,81,255,174,0,82,255,133,0,83,255,174,0,84,255,133,0,85,255,174,
+0,86,255,133,0,88,255,174,0,89,255,195,0,90,255,195,0,91,255,195,0,92,255,
+195,0,93,255,195,0,130,255,133,0,131,255,133,0,132,255,133,0,133,255,133,
+0,134,255,133,0,135,255,133,0,136,255,113,0,137,255,195,0,148,255,195,0,149,
+255,195,0,150,255,195,0,151,255,195,0,152,255,195,0,154,255,195,0,162,255,
+133,0,163,255,133,0,164,255,133,0,165,255,133,0,166,255,133,0,167,255,133,
+0,168,255,133,0,169,255,133,0,170,255,133,0,171,255,133,0,172,255,133,0,173,
+255,133,0,179,255,174,0,180,255,133,0,181,255,133,0,182,255,133,0,183,255,
+133,0,184,255,133,0,186,255,133,0,187,255,174,0,188,255,174,0,189,255,174,
+0,190,255,174,0,191,255,195,0,193,255,195,0,194,255,133,0,195,255,133,0,196,
+255,133,0,197,255,133,0,198,255,133,0,199,255,133,0,200,255,195,0,201,255,
+133,0,203,255,133,0,205,255,133,0,206,255,195,0,207,255,133,0,213,255,133,
+0,215,255,133,0,217,255,133,0,219,255,133,0,221,255,133,0,222,255,195,0,224,
+255,195,0,226,255,195,0,228,255,195,1,6,255,174,1,8,255,174,1,10,255,174,
+1,14,255,195,1,15,255,133,1,17,255,133,1,18,255,195,1,19,255,133,1,20,255,
+195,1,21,255,133,1,28,255,236,1,29,255,133,1,31,255,133,1,32,255,236,1,33,
+255,133,1,34,255,236,1,35,255,133,1,36,0,20,1,38,0,20,1,55,255,195,1,57,255,
+195,1,64,255,195,1,67,255,133,1,68,255,133,1,74,255,133,1,95,255,133,1,102,
+255,195,1,105,255,133,1,109,255,195,1,113,0,20,1,121,255,133,1,123,255,174,
+1,126,255,133,1,128,255,195,1,130,255,133,1,132,255,174,1,138,255,195,1,140,
+255,133,1,142,255,133,1,144,255,133,1,145,255,195,1,147,255,133,1,148,255,
+195,1,150,255,133,1,153,255,133,1,155,255,133,1,160,255,236,1,170,255,133,
+1,184,255,195,1,187,255,195,1,188,0,20,1,202,255,133,1,207,255,133,1,216,
+255,133,1,219,255,133,1,220,255,195,1,221,255,195,1,222,255,133,1,234,255,
+133,1,237,255,133,1,238,255,133,1,251,255,195,1,253,255,195,1,255,255,195,
+2,1,255,195,2,7,0,82,2,11,0,82,2,40,255,133,2,88,255,133,2,89,255,133,2,95,
+255,195,2,96,255,133,2,106,255,133,2,108,255,195,2,109,255,195,2,114,255,
+133,2,126,255,195,2,127,255,133,2,129,255,195,2,131,255,195,2,132,255,195,
+2,133,255,133,2,134,255,195,2,135,255,133,2,136,255,195,2,137,255,133,2,138,
+255,195,2,139,255,195,2,140,255,195,2,141,255,133,2,169,0,20,2,170,255,195,
+2,177,255,195,2,178,255,133,2,179,255,195,2,180,255,133,2,181,0,20,2,182,
+255,195,2,183,0,20,2,184,255,195,2,185,0,20,2,186,255,195,2,189,0,20,2,217,
+255,133,2,218,255,133,2,219,255,133,2,220,255,133,2,221,255,133,2,224,255,
+133,2,225,255,195,2,227,255,195,2,239,255,195,2,240,255,133,2,241,255,195,
+2,242,255,133,2,243,255,195,2,244,255,133,2,248,255,195,2,250,255,195,2,252,
+255,195,3,10,255,133,3,12,255,133,3,14,255,195,3,16,255,195,3,21,255,195,
+3,22,255,133,3,23,0,20,3,24,255,195,3,25,255,195,3,26,255,133,3,29,255,133,
+3,30,255,133,3,31,255,133,3,33,255,133,3,34,255,133,3,35,255,133,3,36,255,
+133,3,37,255,133,3,38,255,133,3,39,255,133,3,40,255,133,3,41,255,133,3,42,
+255,133,3,43,255,133,3,44,255,133,3,45,255,133,3,46,255,133,3,47,255,133,
+3,48,255,133,3,49,255,133,3,50,255,133,3,51,255,133,3,52,255,133,3,54,255,
+133,3,56,255,133,3,58,255,133,3,60,255,133,3,62,255,133,3,64,255,133,3,66,
+255,133,3,68,255,133,3,73,255,195,3,74,255,133,3,75,255,195,3,76,255,133,
+3,77,255,195,3,78,255,133,3,79,255,195,3,80,255,133,3,81,255,195,3,82,255,
+133,3,83,255,195,3,84,255,133,3,85,255,195,3,86,255,133,3,87,255,195,3,88,
+255,133,3,89,255,195,3,90,255,133,3,91,255,195,3,92,255,133,3,93,255,195,
+3,94,255,133,3,95,255,195,3,96,255,133,3,98,255,174,3,100,255,174,3,102,255,
+174,3,104,255,174,3,106,255,174,3,108,255,174,3,110,255,174,3,112,255,195,
+3,114,255,195,3,116,255,195,3,131,0,20,1,30,0,5,0,82,0,9,255,195,0,10,0,82,
+0,12,0,61,0,13,0,41,0,15,255,154,0,16,255,92,0,17,255,154,0,34,0,41,0,36,
+255,154,0,38,255,215,0,42,255,215,0,45,255,190,0,48,255,236,0,50,255,215,
+0,52,255,215,0,54,255,236,0,55,0,39,0,64,0,61,0,68,255,154,0,70,255,154,0,
+71,255,154,0,72,255,154,0,73,255,229,0,74,255,154,0,80,255,195,0,81,255,195,
+0,82,255,154,0,83,255,195,0,84,255,154,0,85,255,195,0,86,255,174,0,88,255,
+195,0,91,255,215,0,92,255,236,0,93,255,195,0,96,0,61,0,130,255,154,0,131,
+255,154,0,132,255,154,0,133,255,154,0,134,255,154,0,135,255,154,0,136,255,
+113,0,137,255,215,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,
+0,152,255,215,0,154,255,215,0,162,255,154,0,163,255,154,0,164,255,154,0,165,
+255,154,0,166,255,154,0,167,255,154,0,168,255,154,0,169,255,154,0,170,255,
+154,0,171,255,154,0,172,255,154,0,173,255,154,0,179,255,195,0,180,255,154,
+0,181,255,154,0,182,255,154,0,183,255,154,0,184,255,154,0,186,255,154,0,187,
+255,195,0,188,255,195,0,189,255,195,0,190,255,195,0,191,255,236,0,193,255,
+236,0,194,255,154,0,195,255,154,0,196,255,154,0,197,255,154,0,198,255,154,
+0,199,255,154,0,200,255,215,0,201,255,154,0,203,255,154,0,205,255,154,0,206,
+255,215,0,207,255,154,0,213,255,154,0,215,255,154,0,217,255,154,0,219,255,
+154,0,221,255,154,0,222,255,215,0,224,255,215,0,226,255,215,0,228,255,215,
+0,246,255,190,1,6,255,195,1,8,255,195,1,10,255,195,1,14,255,215,1,15,255,
+154,1,17,255,154,1,18,255,215,1,19,255,154,1,20,255,215,1,21,255,154,1,28,
+255,236,1,29,255,174,1,31,255,174,1,32,255,236,1,33,255,174,1,34,255,236,
+1,35,255,174,1,36,0,39,1,38,0,39,1,57,255,236,1,64,255,195,1,67,255,154,1,
+68,255,154,1,74,255,174,1,95,255,154,1,102,255,215,1,105,255,154,1,109,255,
+215,1,113,0,39,1,121,255,154,1,123,255,195,1,126,255,154,1,128,255,236,1,
+130,255,154,1,132,255,195,1,138,255,236,1,140,255,154,1,142,255,154,1,144,
+255,154,1,147,255,154,1,150,255,154,1,153,255,154,1,155,255,154,1,160,255,
+236,1,163,255,190,1,170,255,154,1,184,255,215,1,187,255,215,1,188,0,39,1,
+202,255,154,1,207,255,154,1,216,255,154,1,219,255,154,1,221,255,236,1,222,
+255,154,1,234,255,154,1,237,255,154,1,238,255,174,2,1,255,236,2,7,0,82,2,
+11,0,82,2,15,255,215,2,40,255,154,2,88,255,154,2,89,255,154,2,95,255,215,
+2,96,255,154,2,106,255,154,2,108,255,215,2,109,255,236,2,114,255,154,2,126,
+255,215,2,127,255,154,2,129,255,236,2,131,255,236,2,132,255,215,2,133,255,
+154,2,134,255,215,2,135,255,154,2,136,255,215,2,137,255,154,2,138,255,215,
+2,139,255,236,2,140,255,215,2,141,255,154,2,169,0,39,2,177,255,215,2,178,
+255,154,2,179,255,215,2,180,255,154,2,181,0,39,2,183,0,39,2,184,255,236,2,
+185,0,39,2,186,255,236,2,189,0,39,2,217,255,154,2,218,255,154,2,219,255,154,
+2,220,255,154,2,221,255,154,2,224,255,154,2,225,255,215,2,227,255,215,2,239,
+255,215,2,240,255,154,2,241,255,215,2,242,255,154,2,243,255,215,2,244,255,
+154,2,248,255,236,2,250,255,236,2,252,255,236,3,10,255,154,3,12,255,154,3,
+14,255,236,3,16,255,236,3,21,255,215,3,22,255,154,3,23,0,39,3,25,255,215,
+3,26,255,154,3,29,255,154,3,30,255,154,3,31,255,154,3,33,255,154,3,34,255,
+154,3,35,255,154,3,36,255,154,3,37,255,154,3,38,255,154,3,39,255,154,3,40,
+255,154,3,41,255,154,3,42,255,154,3,43,255,154,3,44,255,154,3,45,255,154,
+3,46,255,154,3,47,255,154,3,48,255,154,3,49,255,154,3,50,255,154,3,51,255,
+154,3,52,255,154,3,54,255,154,3,56,255,154,3,58,255,154,3,60,255,154,3,62,
+255,154,3,64,255,154,3,66,255,154,3,68,255,154,3,73,255,215,3,74,255,154,
+3,75,255,215,3,76,255,154,3,77,255,215,3,78,255,154,3,79,255,215,3,80,255,
+154,3,81,255,215,3,82,255,154,3,83,255,215,3,84,255,154,3,85,255,215,3,86,
+255,154,3,87,255,215,3,88,255,154,3,89,255,215,3,90,255,154,3,91,255,215,
+3,92,255,154,3,93,255,215,3,94,255,154,3,95,255,215,3,96,255,154,3,98,255,
+195,3,100,255,195,3,102,255,195,3,104,255,195,3,106,255,195,3,108,255,195,
+3,110,255,195,3,112,255,236,3,114,255,236,3,116,255,236,3,131,0,39,0,197,
+0,5,0,41,0,10,0,41,0,16,255,195,0,38,255,236,0,42,255,236,0,50,255,236,0,
+52,255,236,0,54,255,215,0,56,255,236,0,70,255,236,0,71,255,236,0,72,255,236,
+0,82,255,236,0,84,255,236,0,89,255,215,0,90,255,215,0,92,255,215,0,137,255,
+236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,
+0,154,255,236,0,155,255,236,0,156,255,236,0,157,255,236,0,158,255,236,0,168,
+255,236,0,169,255,236,0,170,255,236,0,171,255,236,0,172,255,236,0,173,255,
+236,0,180,255,236,0,181,255,236,0,182,255,236,0,183,255,236,0,184,255,236,
+0,186,255,236,0,191,255,215,0,193,255,215,0,200,255,236,0,201,255,236,0,203,
+255,236,0,205,255,236,0,206,255,236,0,207,255,236,0,213,255,236,0,215,255,
+236,0,217,255,236,0,219,255,236,0,221,255,236,0,222,255,236,0,224,255,236,
+0,226,255,236,0,228,255,236,1,14,255,236,1,15,255,236,1,17,255,236,1,18,255,
+236,1,19,255,236,1,20,255,215,1,21,255,236,1,28,255,215,1,32,255,215,1,34,
+255,215,1,44,255,236,1,48,255,236,1,50,255,236,1,52,255,236,1,55,255,215,
+1,57,255,215,1,102,255,236,1,109,255,236,1,121,255,236,1,126,255,236,1,128,
+255,215,1,130,255,236,1,138,255,215,1,140,255,236,1,142,255,236,1,144,255,
+236,1,145,255,215,1,147,255,236,1,148,255,215,1,150,255,236,1,153,255,236,
+1,155,255,236,1,160,255,215,1,184,255,236,1,187,255,236,1,207,255,236,1,216,
+255,236,1,219,255,236,1,220,255,215,1,221,255,215,1,222,255,236,1,234,255,
+236,1,237,255,236,1,251,255,215,1,253,255,215,1,255,255,215,2,1,255,215,2,
+7,0,41,2,11,0,41,2,95,255,236,2,96,255,236,2,97,255,236,2,106,255,236,2,108,
+255,236,2,109,255,215,2,126,255,236,2,127,255,236,2,129,255,215,2,131,255,
+215,2,132,255,236,2,133,255,236,2,134,255,236,2,135,255,236,2,136,255,236,
+2,137,255,236,2,138,255,236,2,139,255,215,2,140,255,236,2,141,255,236,2,170,
+255,215,2,177,255,236,2,178,255,236,2,179,255,236,2,180,255,236,2,182,255,
+215,2,184,255,215,2,186,255,215,2,224,255,236,2,225,255,236,2,227,255,236,
+2,239,255,236,2,240,255,236,2,241,255,236,2,242,255,236,2,243,255,236,2,244,
+255,236,2,248,255,215,2,250,255,215,2,252,255,215,3,10,255,236,3,12,255,236,
+3,14,255,215,3,16,255,215,3,21,255,236,3,22,255,236,3,24,255,215,3,25,255,
+236,3,26,255,236,3,54,255,236,3,56,255,236,3,58,255,236,3,60,255,236,3,62,
+255,236,3,64,255,236,3,66,255,236,3,68,255,236,3,73,255,236,3,74,255,236,
+3,75,255,236,3,76,255,236,3,77,255,236,3,78,255,236,3,79,255,236,3,80,255,
+236,3,81,255,236,3,82,255,236,3,83,255,236,3,84,255,236,3,85,255,236,3,86,
+255,236,3,87,255,236,3,88,255,236,3,89,255,236,3,90,255,236,3,91,255,236,
+3,92,255,236,3,93,255,236,3,94,255,236,3,95,255,236,3,96,255,236,3,97,255,
+236,3,99,255,236,3,101,255,236,3,103,255,236,3,105,255,236,3,107,255,236,
+3,109,255,236,3,112,255,215,3,114,255,215,3,116,255,215,0,51,0,82,255,236,
+0,168,255,236,0,180,255,236,0,181,255,236,0,182,255,236,0,183,255,236,0,184,
+255,236,0,186,255,236,1,15,255,236,1,17,255,236,1,19,255,236,1,21,255,236,
+1,140,255,236,1,142,255,236,1,144,255,236,1,147,255,236,1,150,255,236,1,153,
+255,236,1,155,255,236,1,216,255,236,1,222,255,236,2,11,0,20,2,96,255,236,
+2,106,255,236,2,127,255,236,2,133,255,236,2,135,255,236,2,137,255,236,2,141,
+255,236,2,178,255,236,2,180,255,236,2,224,255,236,2,240,255,236,2,242,255,
+236,2,244,255,236,3,10,255,236,3,12,255,236,3,22,255,236,3,26,255,236,3,74,
+255,236,3,76,255,236,3,78,255,236,3,80,255,236,3,82,255,236,3,84,255,236,
+3,86,255,236,3,88,255,236,3,90,255,236,3,92,255,236,3,94,255,236,3,96,255,
+236,0,11,1,98,0,41,1,102,255,236,1,105,0,41,1,109,255,236,1,113,255,133,1,
+114,255,154,1,115,255,215,1,117,255,215,1,120,255,154,1,136,0,41,1,145,255,
+195,0,3,1,102,255,236,1,109,255,236,1,115,255,236,0,11,1,95,255,236,1,100,
+255,236,1,103,255,236,1,108,255,236,1,112,255,236,1,113,255,195,1,114,255,
+215,1,116,255,215,1,119,255,236,1,120,255,215,1,136,255,236,0,36,0,16,255,
+195,0,109,255,195,1,95,255,154,1,98,255,195,1,102,255,215,1,105,255,195,1,
+115,255,215,1,118,255,215,1,121,255,154,1,122,255,154,1,123,255,195,1,125,
+255,195,1,126,255,154,1,129,255,174,1,130,255,154,1,131,255,215,1,132,255,
+195,1,133,255,215,1,134,255,195,1,135,255,195,1,137,255,195,1,140,255,154,
+1,142,255,154,1,143,255,154,1,144,255,154,1,146,255,195,1,147,255,174,1,148,
+255,215,1,149,255,195,1,150,255,174,1,152,255,215,1,153,255,154,1,154,255,
+195,1,155,255,174,2,2,255,195,2,3,255,195,0,3,1,113,255,195,1,114,255,195,
+1,120,255,195,0,25,1,121,255,215,1,125,255,215,1,126,255,215,1,128,255,215,
+1,129,255,215,1,131,255,236,1,133,255,215,1,134,255,215,1,136,0,41,1,138,
+255,215,1,139,255,236,1,140,255,215,1,141,255,236,1,143,255,236,1,144,255,
+215,1,145,255,236,1,146,255,215,1,147,255,215,1,148,255,236,1,149,255,215,
+1,150,255,236,1,152,255,215,1,153,255,215,1,154,255,215,1,155,255,215,0,80,
+0,5,255,174,0,10,255,174,0,38,255,236,0,42,255,236,0,50,255,236,0,52,255,
+236,0,55,255,133,0,56,255,236,0,57,255,195,0,58,255,215,0,60,255,154,0,137,
+255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,
+236,0,154,255,236,0,155,255,236,0,156,255,236,0,157,255,236,0,158,255,236,
+0,159,255,154,0,200,255,236,0,206,255,236,0,222,255,236,0,224,255,236,0,226,
+255,236,0,228,255,236,1,14,255,236,1,18,255,236,1,20,255,215,1,36,255,133,
+1,38,255,133,1,44,255,236,1,48,255,236,1,50,255,236,1,52,255,236,1,54,255,
+215,1,56,255,154,1,58,255,154,1,102,255,236,1,109,255,236,1,113,255,133,1,
+114,255,154,1,115,255,215,1,117,255,195,1,120,255,154,1,145,255,195,1,250,
+255,215,1,252,255,215,1,254,255,215,2,0,255,154,2,7,255,174,2,11,255,174,
+2,95,255,236,2,97,255,236,3,73,255,236,3,75,255,236,3,77,255,236,3,79,255,
+236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,236,3,91,
+255,236,3,93,255,236,3,95,255,236,3,97,255,236,3,99,255,236,3,101,255,236,
+3,103,255,236,3,105,255,236,3,107,255,236,3,109,255,236,3,111,255,154,3,113,
+255,154,3,115,255,154,3,131,255,133,0,24,0,55,255,236,0,57,255,236,0,59,255,
+236,0,60,255,236,0,159,255,236,1,36,255,236,1,38,255,236,1,56,255,236,1,58,
+255,236,1,103,255,236,1,108,255,215,1,112,255,236,1,113,255,236,1,114,255,
+236,1,116,255,236,1,119,255,236,1,120,255,236,1,145,255,236,1,148,255,236,
+2,0,255,236,3,111,255,236,3,113,255,236,3,115,255,236,3,131,255,236,0,114,
+0,5,255,154,0,10,255,154,0,15,255,154,0,16,255,154,0,17,255,154,0,38,255,
+236,0,42,255,236,0,50,255,236,0,52,255,236,0,55,255,133,0,56,255,236,0,57,
+255,174,0,58,255,195,0,60,255,154,0,109,255,154,0,125,255,174,0,137,255,236,
+0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,
+255,236,0,155,255,236,0,156,255,236,0,157,255,236,0,158,255,236,0,159,255,
+154,0,200,255,236,0,206,255,236,0,222,255,236,0,224,255,236,0,226,255,236,
+0,228,255,236,1,14,255,236,1,18,255,236,1,20,255,236,1,36,255,133,1,38,255,
+133,1,44,255,236,1,48,255,236,1,50,255,236,1,52,255,236,1,54,255,195,1,56,
+255,154,1,58,255,154,1,95,255,133,1,98,255,154,1,102,255,236,1,105,255,154,
+1,109,255,236,1,115,255,174,1,118,255,215,1,121,255,133,1,122,255,133,1,123,
+255,174,1,126,255,133,1,128,255,195,1,129,255,154,1,130,255,133,1,132,255,
+195,1,134,255,195,1,135,255,195,1,137,255,195,1,138,255,195,1,140,255,133,
+1,141,255,195,1,142,255,154,1,143,255,133,1,144,255,133,1,145,255,195,1,146,
+255,195,1,147,255,133,1,148,255,195,1,149,255,195,1,150,255,154,1,151,0,41,
+1,152,255,195,1,153,255,133,1,154,255,195,1,155,255,154,1,250,255,195,1,252,
+255,195,1,254,255,195,2,0,255,154,2,2,255,154,2,3,255,154,2,7,255,154,2,11,
+255,154,2,95,255,236,2,97,255,236,3,73,255,236,3,75,255,236,3,77,255,236,
+3,79,255,236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,
+236,3,91,255,236,3,93,255,236,3,95,255,236,3,97,255,236,3,99,255,236,3,101,
+255,236,3,103,255,236,3,105,255,236,3,107,255,236,3,109,255,236,3,111,255,
+154,3,113,255,154,3,115,255,154,3,131,255,133,0,178,0,5,0,82,0,10,0,82,0,
+15,255,154,0,17,255,154,0,34,0,41,0,36,255,195,0,38,255,215,0,42,255,215,
+0,50,255,215,0,52,255,215,0,68,255,195,0,70,255,195,0,71,255,195,0,72,255,
+195,0,74,255,195,0,80,255,215,0,81,255,215,0,82,255,195,0,83,255,215,0,84,
+255,195,0,85,255,215,0,86,255,215,0,88,255,215,0,130,255,195,0,131,255,195,
+0,132,255,195,0,133,255,195,0,134,255,195,0,135,255,195,0,136,255,133,0,137,
+255,215,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,255,
+215,0,154,255,215,0,162,255,195,0,163,255,195,0,164,255,195,0,165,255,195,
+0,166,255,195,0,167,255,195,0,168,255,195,0,169,255,195,0,170,255,195,0,171,
+255,195,0,172,255,195,0,173,255,195,0,179,255,215,0,180,255,195,0,181,255,
+195,0,182,255,195,0,183,255,195,0,184,255,195,0,186,255,195,0,187,255,215,
+0,188,255,215,0,189,255,215,0,190,255,215,0,194,255,195,0,195,255,195,0,196,
+255,195,0,197,255,195,0,198,255,195,0,199,255,195,0,200,255,215,0,201,255,
+195,0,203,255,195,0,205,255,195,0,206,255,215,0,207,255,195,0,213,255,195,
+0,215,255,195,0,217,255,195,0,219,255,195,0,221,255,195,0,222,255,215,0,224,
+255,215,0,226,255,215,0,228,255,215,1,6,255,215,1,8,255,215,1,10,255,215,
+1,14,255,215,1,15,255,195,1,17,255,195,1,18,255,215,1,19,255,195,1,20,255,
+215,1,21,255,195,1,29,255,215,1,31,255,215,1,33,255,215,1,35,255,215,1,67,
+255,195,1,68,255,195,1,74,255,215,1,98,0,20,1,102,255,215,1,109,255,215,1,
+113,255,154,1,114,255,195,1,115,255,215,1,117,255,215,1,120,255,195,1,121,
+255,195,1,136,0,41,1,141,255,215,2,7,0,82,2,11,0,82,2,40,255,195,2,88,255,
+195,2,89,255,195,2,95,255,215,2,96,255,195,3,29,255,195,3,30,255,195,3,31,
+255,195,3,33,255,195,3,34,255,195,3,35,255,195,3,36,255,195,3,37,255,195,
+3,38,255,195,3,39,255,195,3,40,255,195,3,41,255,195,3,42,255,195,3,43,255,
+195,3,44,255,195,3,45,255,195,3,46,255,195,3,47,255,195,3,48,255,195,3,49,
+255,195,3,50,255,195,3,51,255,195,3,52,255,195,3,54,255,195,3,56,255,195,
+3,58,255,195,3,60,255,195,3,62,255,195,3,64,255,195,3,66,255,195,3,68,255,
+195,3,73,255,215,3,74,255,195,3,75,255,215,3,76,255,195,3,77,255,215,3,78,
+255,195,3,79,255,215,3,80,255,195,3,81,255,215,3,82,255,195,3,83,255,215,
+3,84,255,195,3,85,255,215,3,86,255,195,3,87,255,215,3,88,255,195,3,89,255,
+215,3,90,255,195,3,91,255,215,3,92,255,195,3,93,255,215,3,94,255,195,3,95,
+255,215,3,96,255,195,3,98,255,215,3,100,255,215,3,102,255,215,3,104,255,215,
+3,106,255,215,3,108,255,215,3,110,255,215,0,8,1,102,255,236,1,109,255,236,
+1,115,255,236,1,146,255,215,1,149,255,215,1,151,0,41,1,152,255,215,1,154,
+255,215,0,71,0,15,255,195,0,17,255,195,0,36,255,236,0,44,255,236,0,55,255,
+195,0,57,255,215,0,58,255,236,0,59,255,215,0,60,255,215,0,61,255,236,0,130,
+255,236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,255,236,0,135,255,
+236,0,136,255,215,0,142,255,236,0,143,255,236,0,144,255,236,0,145,255,236,
+0,159,255,215,0,194,255,236,0,196,255,236,0,198,255,236,0,236,255,236,0,240,
+255,236,0,242,255,236,1,36,255,195,1,38,255,195,1,54,255,236,1,56,255,215,
+1,58,255,215,1,59,255,236,1,61,255,236,1,63,255,236,1,67,255,236,1,95,255,
+236,1,98,255,215,1,103,255,236,1,105,255,236,1,108,255,236,1,112,255,236,
+1,113,255,195,1,114,255,215,1,116,255,215,1,120,255,215,1,250,255,236,1,252,
+255,236,1,254,255,236,2,0,255,215,2,40,255,236,2,88,255,236,3,29,255,236,
+3,31,255,236,3,33,255,236,3,35,255,236,3,37,255,236,3,39,255,236,3,41,255,
+236,3,43,255,236,3,45,255,236,3,47,255,236,3,49,255,236,3,51,255,236,3,69,
+255,236,3,71,255,236,3,111,255,215,3,113,255,215,3,115,255,215,3,131,255,
+195,0,5,1,102,255,236,1,109,255,236,1,115,255,236,1,129,255,236,1,136,0,41,
+0,42,0,5,0,41,0,10,0,41,0,38,255,215,0,42,255,215,0,50,255,215,0,52,255,215,
+0,137,255,215,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,
+255,215,0,154,255,215,0,200,255,215,0,206,255,215,0,222,255,215,0,224,255,
+215,0,226,255,215,0,228,255,215,1,14,255,215,1,18,255,215,1,20,255,215,1,
+102,255,215,1,109,255,215,1,115,255,174,1,145,255,215,1,151,0,41,2,7,0,41,
+2,11,0,41,2,95,255,215,3,73,255,215,3,75,255,215,3,77,255,215,3,79,255,215,
+3,81,255,215,3,83,255,215,3,85,255,215,3,87,255,215,3,89,255,215,3,91,255,
+215,3,93,255,215,3,95,255,215,0,208,0,5,255,174,0,10,255,174,0,34,0,41,0,
+36,255,195,0,38,255,236,0,42,255,236,0,50,255,236,0,52,255,236,0,55,255,133,
+0,56,255,236,0,57,255,195,0,58,255,215,0,60,255,154,0,68,255,195,0,70,255,
+195,0,71,255,195,0,72,255,195,0,74,255,195,0,80,255,215,0,81,255,215,0,82,
+255,195,0,83,255,215,0,84,255,195,0,85,255,215,0,86,255,215,0,88,255,215,
+0,130,255,195,0,131,255,195,0,132,255,195,0,133,255,195,0,134,255,195,0,135,
+255,195,0,136,255,133,0,137,255,236,0,148,255,236,0,149,255,236,0,150,255,
+236,0,151,255,236,0,152,255,236,0,154,255,236,0,155,255,236,0,156,255,236,
+0,157,255,236,0,158,255,236,0,159,255,154,0,162,255,195,0,163,255,195,0,164,
+255,195,0,165,255,195,0,166,255,195,0,167,255,195,0,168,255,195,0,169,255,
+195,0,170,255,195,0,171,255,195,0,172,255,195,0,173,255,195,0,179,255,215,
+0,180,255,195,0,181,255,195,0,182,255,195,0,183,255,195,0,184,255,195,0,186,
+255,195,0,187,255,215,0,188,255,215,0,189,255,215,0,190,255,215,0,194,255,
+195,0,195,255,195,0,196,255,195,0,197,255,195,0,198,255,195,0,199,255,195,
+0,200,255,236,0,201,255,195,0,203,255,195,0,205,255,195,0,206,255,236,0,207,
+255,195,0,213,255,195,0,215,255,195,0,217,255,195,0,219,255,195,0,221,255,
+195,0,222,255,236,0,224,255,236,0,226,255,236,0,228,255,236,1,6,255,215,1,
+8,255,215,1,10,255,215,1,14,255,236,1,15,255,195,1,17,255,195,1,18,255,236,
+1,19,255,195,1,20,255,215,1,21,255,195,1,29,255,215,1,31,255,215,1,33,255,
+215,1,35,255,215,1,36,255,133,1,38,255,133,1,44,255,236,1,48,255,236,1,50,
+255,236,1,52,255,236,1,54,255,215,1,56,255,154,1,58,255,154,1,67,255,195,
+1,68,255,195,1,74,255,215,1,102,255,236,1,109,255,236,1,113,255,133,1,114,
+255,154,1,115,255,215,1,117,255,195,1,120,255,154,1,145,255,215,1,250,255,
+215,1,252,255,215,1,254,255,215,2,0,255,154,2,7,255,174,2,11,255,174,2,40,
+255,195,2,88,255,195,2,89,255,195,2,95,255,236,2,96,255,195,2,97,255,236,
+3,29,255,195,3,30,255,195,3,31,255,195,3,33,255,195,3,34,255,195,3,35,255,
+195,3,36,255,195,3,37,255,195,3,38,255,195,3,39,255,195,3,40,255,195,3,41,
+255,195,3,42,255,195,3,43,255,195,3,44,255,195,3,45,255,195,3,46,255,195,
+3,47,255,195,3,48,255,195,3,49,255,195,3,50,255,195,3,51,255,195,3,52,255,
+195,3,54,255,195,3,56,255,195,3,58,255,195,3,60,255,195,3,62,255,195,3,64,
+255,195,3,66,255,195,3,68,255,195,3,73,255,236,3,74,255,195,3,75,255,236,
+3,76,255,195,3,77,255,236,3,78,255,195,3,79,255,236,3,80,255,195,3,81,255,
+236,3,82,255,195,3,83,255,236,3,84,255,195,3,85,255,236,3,86,255,195,3,87,
+255,236,3,88,255,195,3,89,255,236,3,90,255,195,3,91,255,236,3,92,255,195,
+3,93,255,236,3,94,255,195,3,95,255,236,3,96,255,195,3,97,255,236,3,98,255,
+215,3,99,255,236,3,100,255,215,3,101,255,236,3,102,255,215,3,103,255,236,
+3,104,255,215,3,105,255,236,3,106,255,215,3,107,255,236,3,108,255,215,3,109,
+255,236,3,110,255,215,3,111,255,154,3,113,255,154,3,115,255,154,3,131,255,
+133,0,3,1,102,255,236,1,109,255,236,1,136,0,41,0,71,0,15,255,195,0,17,255,
+195,0,36,255,236,0,44,255,236,0,55,255,195,0,57,255,215,0,58,255,236,0,59,
+255,215,0,60,255,215,0,61,255,236,0,130,255,236,0,131,255,236,0,132,255,236,
+0,133,255,236,0,134,255,236,0,135,255,236,0,136,255,215,0,142,255,236,0,143,
+255,236,0,144,255,236,0,145,255,236,0,159,255,215,0,194,255,236,0,196,255,
+236,0,198,255,236,0,236,255,236,0,240,255,236,0,242,255,236,1,36,255,195,
+1,38,255,195,1,54,255,236,1,56,255,215,1,58,255,215,1,59,255,236,1,61,255,
+236,1,63,255,236,1,67,255,236,1,95,255,236,1,103,255,236,1,105,255,236,1,
+108,255,236,1,112,255,236,1,113,255,195,1,114,255,215,1,116,255,215,1,119,
+255,236,1,120,255,215,1,250,255,236,1,252,255,236,1,254,255,236,2,0,255,215,
+2,40,255,236,2,88,255,236,3,29,255,236,3,31,255,236,3,33,255,236,3,35,255,
+236,3,37,255,236,3,39,255,236,3,41,255,236,3,43,255,236,3,45,255,236,3,47,
+255,236,3,49,255,236,3,51,255,236,3,69,255,236,3,71,255,236,3,111,255,215,
+3,113,255,215,3,115,255,215,3,131,255,195,0,54,0,15,255,51,0,17,255,51,0,
+36,255,174,0,38,255,236,0,59,255,236,0,60,255,236,0,61,255,215,0,130,255,
+174,0,131,255,174,0,132,255,174,0,133,255,174,0,134,255,174,0,135,255,174,
+0,136,255,113,0,137,255,236,0,159,255,236,0,194,255,174,0,196,255,174,0,198,
+255,174,0,200,255,236,0,206,255,236,1,56,255,236,1,58,255,236,1,59,255,215,
+1,61,255,215,1,63,255,215,1,67,255,174,1,95,255,174,1,98,255,174,1,100,255,
+236,1,105,255,174,1,116,255,236,1,120,255,236,1,129,255,215,1,136,255,215,
+1,142,255,215,2,0,255,236,2,40,255,174,2,88,255,174,3,29,255,174,3,31,255,
+174,3,33,255,174,3,35,255,174,3,37,255,174,3,39,255,174,3,41,255,174,3,43,
+255,174,3,45,255,174,3,47,255,174,3,49,255,174,3,51,255,174,3,111,255,236,
+3,113,255,236,3,115,255,236,0,41,0,5,0,41,0,10,0,41,0,38,255,215,0,42,255,
+215,0,50,255,215,0,52,255,215,0,137,255,215,0,148,255,215,0,149,255,215,0,
+150,255,215,0,151,255,215,0,152,255,215,0,154,255,215,0,200,255,215,0,206,
+255,215,0,222,255,215,0,224,255,215,0,226,255,215,0,228,255,215,1,14,255,
+215,1,18,255,215,1,20,255,215,1,102,255,215,1,109,255,215,1,115,255,215,1,
+136,0,41,2,7,0,41,2,11,0,41,2,95,255,215,3,73,255,215,3,75,255,215,3,77,255,
+215,3,79,255,215,3,81,255,215,3,83,255,215,3,85,255,215,3,87,255,215,3,89,
+255,215,3,91,255,215,3,93,255,215,3,95,255,215,0,234,0,5,0,82,0,10,0,82,0,
+15,255,154,0,16,255,154,0,17,255,154,0,34,0,41,0,36,255,133,0,38,255,195,
+0,42,255,195,0,50,255,195,0,52,255,195,0,54,255,236,0,55,0,20,0,68,255,133,
+0,70,255,133,0,71,255,133,0,72,255,133,0,74,255,154,0,80,255,174,0,81,255,
+174,0,82,255,133,0,83,255,174,0,84,255,133,0,85,255,174,0,86,255,133,0,88,
+255,174,0,89,255,195,0,90,255,195,0,91,255,195,0,92,255,195,0,93,255,195,
+0,109,255,154,0,125,255,215,0,130,255,133,0,131,255,133,0,132,255,133,0,133,
+255,133,0,134,255,133,0,135,255,133,0,136,255,113,0,137,255,195,0,148,255,
+195,0,149,255,195,0,150,255,195,0,151,255,195,0,152,255,195,0,154,255,195,
+0,162,255,133,0,163,255,133,0,164,255,133,0,165,255,133,0,166,255,133,0,167,
+255,133,0,168,255,133,0,169,255,133,0,170,255,133,0,171,255,133,0,172,255,
+133,0,173,255,133,0,179,255,174,0,180,255,133,0,181,255,133,0,182,255,133,
+0,183,255,133,0,184,255,133,0,186,255,133,0,187,255,174,0,188,255,174,0,189,
+255,174,0,190,255,174,0,191,255,195,0,193,255,195,0,194,255,133,0,195,255,
+133,0,196,255,133,0,197,255,133,0,198,255,133,0,199,255,133,0,200,255,195,
+0,201,255,133,0,203,255,133,0,205,255,133,0,206,255,195,0,207,255,133,0,213,
+255,133,0,215,255,133,0,217,255,133,0,219,255,133,0,221,255,133,0,222,255,
+195,0,224,255,195,0,226,255,195,0,228,255,195,1,6,255,174,1,8,255,174,1,10,
+255,174,1,14,255,195,1,15,255,133,1,17,255,133,1,18,255,195,1,19,255,133,
+1,20,255,195,1,21,255,133,1,28,255,236,1,29,255,133,1,31,255,133,1,32,255,
+236,1,33,255,133,1,34,255,236,1,35,255,133,1,36,0,20,1,38,0,20,1,55,255,195,
+1,57,255,195,1,64,255,195,1,67,255,133,1,68,255,133,1,74,255,133,1,95,255,
+133,1,98,255,154,1,102,255,195,1,105,255,133,1,109,255,195,1,113,0,20,1,115,
+255,195,1,118,255,195,1,121,255,133,1,122,255,133,1,123,255,174,1,125,255,
+174,1,126,255,133,1,128,255,195,1,129,255,174,1,130,255,133,1,132,255,174,
+1,134,255,174,1,135,255,174,1,136,0,20,1,137,255,174,1,138,255,195,1,140,
+255,133,1,142,255,133,1,143,255,133,1,144,255,133,1,145,255,195,1,146,255,
+174,1,147,255,133,1,148,255,195,1,149,255,174,1,150,255,133,1,151,0,61,1,
+152,255,174,1,153,255,133,1,154,255,174,1,155,255,133,1,251,255,195,1,253,
+255,195,1,255,255,195,2,1,255,195,2,2,255,154,2,3,255,154,2,7,0,82,2,11,0,
+82,2,40,255,133,2,88,255,133,2,89,255,133,2,95,255,195,2,96,255,133,3,29,
+255,133,3,30,255,133,3,31,255,133,3,33,255,133,3,34,255,133,3,35,255,133,
+3,36,255,133,3,37,255,133,3,38,255,133,3,39,255,133,3,40,255,133,3,41,255,
+133,3,42,255,133,3,43,255,133,3,44,255,133,3,45,255,133,3,46,255,133,3,47,
+255,133,3,48,255,133,3,49,255,133,3,50,255,133,3,51,255,133,3,52,255,133,
+3,54,255,133,3,56,255,133,3,58,255,133,3,60,255,133,3,62,255,133,3,64,255,
+133,3,66,255,133,3,68,255,133,3,73,255,195,3,74,255,133,3,75,255,195,3,76,
+255,133,3,77,255,195,3,78,255,133,3,79,255,195,3,80,255,133,3,81,255,195,
+3,82,255,133,3,83,255,195,3,84,255,133,3,85,255,195,3,86,255,133,3,87,255,
+195,3,88,255,133,3,89,255,195,3,90,255,133,3,91,255,195,3,92,255,133,3,93,
+255,195,3,94,255,133,3,95,255,195,3,96,255,133,3,98,255,174,3,100,255,174,
+3,102,255,174,3,104,255,174,3,106,255,174,3,108,255,174,3,110,255,174,3,112,
+255,195,3,114,255,195,3,116,255,195,3,131,0,20,0,45,0,15,255,154,0,16,255,
+195,0,17,255,154,0,109,255,195,1,95,255,154,1,98,255,195,1,102,255,215,1,
+105,255,154,1,109,255,215,1,115,255,195,1,118,255,215,1,121,255,154,1,122,
+255,174,1,123,255,195,1,124,255,236,1,125,255,215,1,126,255,154,1,127,255,
+215,1,129,255,154,1,130,255,174,1,131,255,215,1,132,255,195,1,133,255,215,
+1,134,255,195,1,135,255,195,1,136,0,20,1,137,255,195,1,139,255,236,1,140,
+255,154,1,142,255,154,1,143,255,154,1,144,255,154,1,145,255,236,1,146,255,
+195,1,147,255,154,1,148,255,215,1,149,255,195,1,150,255,174,1,151,0,41,1,
+152,255,195,1,153,255,154,1,154,255,195,1,155,255,174,2,2,255,195,2,3,255,
+195,0,10,1,95,255,215,1,98,255,215,1,103,255,236,1,105,255,215,1,113,255,
+195,1,114,255,195,1,116,255,195,1,119,255,215,1,120,255,195,1,136,255,215,
+0,23,1,102,255,215,1,109,255,215,1,115,255,195,1,121,255,236,1,124,255,236,
+1,125,255,236,1,126,255,236,1,129,255,236,1,133,255,236,1,134,255,236,1,136,
+0,20,1,140,255,236,1,143,255,236,1,144,255,236,1,145,255,215,1,146,255,215,
+1,147,255,236,1,149,255,215,1,150,255,236,1,152,255,215,1,153,255,236,1,154,
+255,215,1,155,255,236,0,12,0,15,255,174,0,17,255,174,1,95,255,195,1,98,255,
+215,1,105,255,195,1,129,255,215,1,142,255,215,1,144,255,236,1,147,255,236,
+1,150,255,236,1,153,255,236,1,155,255,236,0,3,1,113,255,195,1,114,255,215,
+1,120,255,215,0,44,0,5,0,41,0,10,0,41,0,38,255,236,0,42,255,236,0,50,255,
+236,0,52,255,236,0,137,255,236,0,148,255,236,0,149,255,236,0,150,255,236,
+0,151,255,236,0,152,255,236,0,154,255,236,0,200,255,236,0,206,255,236,0,222,
+255,236,0,224,255,236,0,226,255,236,0,228,255,236,1,14,255,236,1,18,255,236,
+1,20,255,236,1,102,255,236,1,109,255,236,1,115,255,215,1,128,255,236,1,129,
+255,236,1,136,0,20,1,145,255,236,2,7,0,41,2,11,0,41,2,95,255,236,3,73,255,
+236,3,75,255,236,3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,3,85,
+255,236,3,87,255,236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,236,
+0,239,0,5,0,82,0,9,255,195,0,10,0,82,0,12,0,61,0,13,0,41,0,15,255,154,0,16,
+255,92,0,17,255,154,0,34,0,41,0,36,255,154,0,38,255,215,0,42,255,215,0,45,
+255,190,0,48,255,236,0,50,255,215,0,52,255,215,0,54,255,236,0,55,0,39,0,64,
+0,61,0,68,255,154,0,70,255,154,0,71,255,154,0,72,255,154,0,73,255,229,0,74,
+255,154,0,80,255,195,0,81,255,195,0,82,255,154,0,83,255,195,0,84,255,154,
+0,85,255,195,0,86,255,174,0,88,255,195,0,91,255,215,0,92,255,236,0,93,255,
+195,0,96,0,61,0,109,255,195,0,125,255,215,0,130,255,154,0,131,255,154,0,132,
+255,154,0,133,255,154,0,134,255,154,0,135,255,154,0,136,255,113,0,137,255,
+215,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,255,215,
+0,154,255,215,0,162,255,154,0,163,255,154,0,164,255,154,0,165,255,154,0,166,
+255,154,0,167,255,154,0,168,255,154,0,169,255,154,0,170,255,154,0,171,255,
+154,0,172,255,154,0,173,255,154,0,179,255,195,0,180,255,154,0,181,255,154,
+0,182,255,154,0,183,255,154,0,184,255,154,0,186,255,154,0,187,255,195,0,188,
+255,195,0,189,255,195,0,190,255,195,0,191,255,236,0,193,255,236,0,194,255,
+154,0,195,255,154,0,196,255,154,0,197,255,154,0,198,255,154,0,199,255,154,
+0,200,255,215,0,201,255,154,0,203,255,154,0,205,255,154,0,206,255,215,0,207,
+255,154,0,213,255,154,0,215,255,154,0,217,255,154,0,219,255,154,0,221,255,
+154,0,222,255,215,0,224,255,215,0,226,255,215,0,228,255,215,0,246,255,190,
+1,6,255,195,1,8,255,195,1,10,255,195,1,14,255,215,1,15,255,154,1,17,255,154,
+1,18,255,215,1,19,255,154,1,20,255,215,1,21,255,154,1,28,255,236,1,29,255,
+174,1,31,255,174,1,32,255,236,1,33,255,174,1,34,255,236,1,35,255,174,1,36,
+0,39,1,38,0,39,1,57,255,236,1,64,255,195,1,67,255,154,1,68,255,154,1,74,255,
+174,1,95,255,154,1,98,255,195,1,102,255,215,1,105,255,154,1,109,255,215,1,
+115,255,195,1,118,255,215,1,121,255,154,1,122,255,174,1,123,255,195,1,124,
+255,236,1,125,255,195,1,126,255,154,1,127,255,215,1,128,255,236,1,129,255,
+154,1,130,255,154,1,131,255,215,1,132,255,195,1,134,255,195,1,135,255,195,
+1,137,255,195,1,138,255,236,1,139,255,236,1,140,255,154,1,141,255,215,1,142,
+255,154,1,143,255,154,1,144,255,154,1,145,255,215,1,146,255,195,1,147,255,
+154,1,148,255,215,1,149,255,195,1,150,255,154,1,151,0,41,1,152,255,195,1,
+153,255,154,1,154,255,195,1,155,255,154,2,1,255,236,2,7,0,82,2,11,0,82,2,
+15,255,215,2,40,255,154,2,88,255,154,2,89,255,154,2,95,255,215,2,96,255,154,
+3,29,255,154,3,30,255,154,3,31,255,154,3,33,255,154,3,34,255,154,3,35,255,
+154,3,36,255,154,3,37,255,154,3,38,255,154,3,39,255,154,3,40,255,154,3,41,
+255,154,3,42,255,154,3,43,255,154,3,44,255,154,3,45,255,154,3,46,255,154,
+3,47,255,154,3,48,255,154,3,49,255,154,3,50,255,154,3,51,255,154,3,52,255,
+154,3,54,255,154,3,56,255,154,3,58,255,154,3,60,255,154,3,62,255,154,3,64,
+255,154,3,66,255,154,3,68,255,154,3,73,255,215,3,74,255,154,3,75,255,215,
+3,76,255,154,3,77,255,215,3,78,255,154,3,79,255,215,3,80,255,154,3,81,255,
+215,3,82,255,154,3,83,255,215,3,84,255,154,3,85,255,215,3,86,255,154,3,87,
+255,215,3,88,255,154,3,89,255,215,3,90,255,154,3,91,255,215,3,92,255,154,
+3,93,255,215,3,94,255,154,3,95,255,215,3,96,255,154,3,98,255,195,3,100,255,
+195,3,102,255,195,3,104,255,195,3,106,255,195,3,108,255,195,3,110,255,195,
+3,112,255,236,3,114,255,236,3,116,255,236,3,131,0,39,0,1,1,136,0,41,0,6,1,
+121,255,215,1,126,255,236,1,129,255,236,1,140,255,236,1,144,255,236,1,147,
+255,236,0,20,1,121,255,236,1,124,255,236,1,125,255,236,1,128,255,236,1,129,
+255,236,1,133,255,236,1,134,255,236,1,136,0,41,1,138,255,215,1,140,255,236,
+1,141,255,236,1,143,255,236,1,144,255,236,1,145,255,215,1,146,255,236,1,149,
+255,236,1,151,255,236,1,152,255,236,1,153,255,236,1,154,255,236,0,1,1,148,
+255,236,0,11,0,5,0,61,0,10,0,61,0,73,0,20,1,129,255,236,1,141,0,41,1,142,
+255,236,1,145,0,20,1,148,0,20,1,150,0,20,2,7,0,61,2,11,0,61,0,2,1,145,255,
+236,1,148,255,215,0,11,0,5,0,61,0,10,0,61,1,121,255,215,1,129,255,236,1,140,
+255,215,1,143,255,236,1,144,255,215,1,147,255,215,1,153,255,215,2,7,0,61,
+2,11,0,61,0,28,1,121,255,174,1,122,255,215,1,125,255,215,1,126,255,195,1,
+128,255,215,1,129,255,195,1,130,255,215,1,131,255,215,1,132,255,215,1,133,
+255,215,1,134,255,215,1,135,255,236,1,136,0,41,1,138,255,215,1,139,255,215,
+1,140,255,195,1,141,255,195,1,143,255,195,1,144,255,195,1,145,255,195,1,146,
+255,195,1,147,255,195,1,149,255,195,1,150,255,195,1,152,255,195,1,153,255,
+195,1,154,255,195,1,155,255,195,0,16,0,5,0,82,0,10,0,82,1,121,255,215,1,125,
+255,236,1,126,255,236,1,128,255,215,1,133,255,215,1,134,255,236,1,136,0,41,
+1,138,255,215,1,141,255,215,1,145,255,215,1,147,255,215,1,151,255,236,2,7,
+0,82,2,11,0,82,0,9,0,5,0,41,0,10,0,41,1,121,255,215,1,126,255,215,1,129,255,
+215,1,130,255,236,1,140,255,236,2,7,0,41,2,11,0,41,0,13,0,5,0,61,0,10,0,61,
+0,73,0,20,1,125,255,236,1,128,255,236,1,133,255,215,1,136,0,61,1,138,255,
+215,1,141,255,215,1,145,255,195,1,148,255,215,2,7,0,61,2,11,0,61,0,7,0,5,
+0,61,0,10,0,61,0,73,0,20,1,141,0,20,1,142,255,236,2,7,0,61,2,11,0,61,0,3,
+0,30,0,61,1,126,255,236,1,136,0,41,0,5,0,91,255,215,0,93,255,236,1,64,255,
+236,1,145,255,236,1,148,255,215,0,4,1,126,255,236,1,128,0,20,1,138,0,41,1,
+145,0,20,0,7,0,91,255,215,0,93,255,236,1,64,255,236,1,128,0,20,1,138,0,20,
+1,141,0,20,1,145,0,41,0,14,0,5,0,82,0,10,0,82,0,73,0,20,0,125,0,41,1,128,
+0,20,1,129,255,236,1,138,0,41,1,140,255,215,1,141,0,20,1,143,255,215,1,144,
+255,236,1,145,0,20,2,7,0,82,2,11,0,82,0,4,0,91,255,215,0,93,255,236,1,64,
+255,236,1,148,255,236,0,21,0,5,0,82,0,10,0,82,0,73,0,20,1,121,255,215,1,122,
+255,215,1,126,255,215,1,128,0,20,1,129,255,215,1,130,255,215,1,133,255,236,
+1,140,255,215,1,143,255,215,1,144,255,215,1,146,255,236,1,147,255,236,1,148,
+0,41,1,149,255,215,1,150,255,215,1,153,255,236,2,7,0,82,2,11,0,82,0,4,0,91,
+255,215,0,93,255,236,1,64,255,236,1,128,0,20,0,19,1,121,255,236,1,125,255,
+236,1,126,255,215,1,128,255,215,1,129,255,236,1,133,255,215,1,136,0,41,1,
+140,255,236,1,141,255,215,1,143,255,236,1,144,255,236,1,145,255,215,1,146,
+255,236,1,148,255,236,1,149,255,215,1,152,255,236,1,153,255,236,1,154,255,
+236,1,155,255,236,0,56,0,5,0,41,0,10,0,41,0,16,255,215,0,38,255,236,0,45,
+0,61,0,50,255,236,0,52,255,236,0,132,255,236,0,137,255,236,0,138,255,236,
+0,143,255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,
+255,236,0,154,255,236,0,200,255,236,0,206,255,236,0,246,0,61,1,14,255,236,
+1,18,255,236,1,184,255,236,1,187,255,236,1,190,255,236,2,7,0,41,2,11,0,41,
+2,95,255,236,2,108,255,236,2,126,255,236,2,132,255,236,2,134,255,236,2,136,
+255,236,2,138,255,236,2,140,255,236,2,177,255,236,2,179,255,236,2,225,255,
+236,2,227,255,236,2,239,255,236,2,241,255,236,2,243,255,236,3,21,255,236,
+3,25,255,236,3,73,255,236,3,75,255,236,3,77,255,236,3,79,255,236,3,81,255,
+236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,236,3,91,255,236,3,93,
+255,236,3,95,255,236,0,61,0,5,255,195,0,10,255,195,1,157,255,133,1,166,255,
+133,1,176,255,215,1,188,255,133,1,189,255,215,1,191,255,236,1,193,255,195,
+1,196,255,133,1,220,255,195,1,221,255,236,1,223,255,236,1,225,255,195,1,228,
+255,174,2,7,255,195,2,11,255,195,2,109,255,236,2,118,255,215,2,124,255,195,
+2,125,255,195,2,128,255,195,2,129,255,236,2,130,255,195,2,131,255,236,2,139,
+255,236,2,159,255,215,2,169,255,133,2,170,255,195,2,181,255,133,2,182,255,
+195,2,183,255,133,2,184,255,236,2,185,255,133,2,186,255,236,2,187,255,215,
+2,189,255,133,2,191,255,195,2,192,255,195,2,193,255,195,2,194,255,195,2,202,
+255,215,2,212,255,195,2,213,255,195,2,229,255,215,2,247,255,215,2,248,255,
+236,2,249,255,215,2,250,255,236,2,251,255,215,2,252,255,236,2,253,255,195,
+2,254,255,195,3,5,255,215,3,7,255,215,3,13,255,195,3,14,255,236,3,15,255,
+195,3,16,255,236,3,23,255,133,3,24,255,195,0,213,0,5,0,82,0,10,0,82,0,16,
+255,92,0,38,255,236,0,42,255,236,0,50,255,236,0,52,255,236,0,55,255,133,0,
+56,255,236,0,57,255,174,0,58,255,195,0,60,255,154,0,137,255,236,0,148,255,
+236,0,149,255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,
+0,155,255,236,0,156,255,236,0,157,255,236,0,158,255,236,0,159,255,154,0,200,
+255,236,0,206,255,236,0,222,255,236,0,224,255,236,0,226,255,236,0,228,255,
+236,1,14,255,236,1,18,255,236,1,20,255,236,1,36,255,133,1,38,255,133,1,44,
+255,236,1,48,255,236,1,50,255,236,1,52,255,236,1,54,255,195,1,56,255,154,
+1,58,255,154,1,159,255,236,1,164,255,154,1,170,255,133,1,174,255,133,1,181,
+255,133,1,184,255,215,1,187,255,236,1,190,255,195,1,202,255,133,1,203,255,
+215,1,204,255,195,1,205,255,195,1,206,255,92,1,207,255,133,1,208,255,195,
+1,209,255,195,1,210,255,195,1,211,255,195,1,212,255,195,1,213,255,92,1,214,
+255,195,1,215,255,195,1,216,255,133,1,217,255,195,1,218,255,195,1,219,255,
+133,1,220,255,195,1,221,255,195,1,222,255,133,1,223,255,195,1,224,255,195,
+1,225,255,195,1,226,255,195,1,227,255,195,1,228,255,195,1,229,255,195,1,230,
+255,195,1,231,255,195,1,232,255,195,1,233,255,154,1,234,255,133,1,236,255,
+195,1,237,255,133,1,238,255,174,1,240,0,61,1,242,255,92,1,243,255,195,1,245,
+255,195,1,247,255,195,1,249,255,195,1,250,255,195,1,252,255,195,1,254,255,
+195,2,0,255,154,2,7,0,82,2,11,0,82,2,95,255,236,2,97,255,236,2,106,255,133,
+2,107,255,195,2,108,255,215,2,109,255,195,2,114,255,133,2,125,255,195,2,126,
+255,215,2,127,255,133,2,129,255,195,2,131,255,195,2,132,255,215,2,133,255,
+133,2,134,255,215,2,135,255,133,2,136,255,215,2,137,255,133,2,138,255,215,
+2,139,255,195,2,140,255,215,2,141,255,133,2,150,255,195,2,154,255,195,2,160,
+255,195,2,164,255,195,2,166,255,195,2,170,255,195,2,172,255,195,2,174,255,
+195,2,176,255,195,2,177,255,215,2,178,255,133,2,179,255,215,2,180,255,133,
+2,182,255,195,2,184,255,195,2,186,255,195,2,188,255,195,2,192,255,195,2,194,
+255,195,2,196,255,195,2,197,255,174,2,198,255,113,2,199,255,174,2,203,255,
+195,2,206,255,133,2,207,255,92,2,209,255,195,2,211,255,195,2,213,255,195,
+2,215,255,195,2,217,255,133,2,218,255,133,2,219,255,133,2,220,255,133,2,221,
+255,133,2,224,255,133,2,225,255,215,2,227,255,215,2,230,255,195,2,236,255,
+195,2,238,255,195,2,239,255,215,2,240,255,133,2,241,255,215,2,242,255,133,
+2,243,255,215,2,244,255,133,2,248,255,195,2,250,255,195,2,252,255,195,2,254,
+255,195,3,0,255,195,3,6,255,195,3,8,255,195,3,9,255,92,3,10,255,133,3,11,
+255,92,3,12,255,133,3,14,255,195,3,16,255,195,3,17,255,133,3,18,255,92,3,
+20,255,195,3,21,255,215,3,22,255,133,3,24,255,195,3,25,255,215,3,26,255,133,
+3,27,255,133,3,28,255,92,3,73,255,236,3,75,255,236,3,77,255,236,3,79,255,
+236,3,81,255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,236,3,91,
+255,236,3,93,255,236,3,95,255,236,3,97,255,236,3,99,255,236,3,101,255,236,
+3,103,255,236,3,105,255,236,3,107,255,236,3,109,255,236,3,111,255,154,3,113,
+255,154,3,115,255,154,3,131,255,133,0,31,0,5,0,41,0,10,0,41,1,159,255,215,
+1,184,255,236,1,187,255,215,1,190,255,236,1,222,255,215,1,225,255,215,2,7,
+0,41,2,11,0,41,2,108,255,236,2,125,255,215,2,126,255,236,2,132,255,236,2,
+134,255,236,2,136,255,236,2,138,255,236,2,140,255,236,2,177,255,236,2,179,
+255,236,2,192,255,215,2,194,255,215,2,213,255,215,2,225,255,236,2,227,255,
+236,2,239,255,236,2,241,255,236,2,243,255,236,2,254,255,215,3,21,255,236,
+3,25,255,236,0,5,1,160,255,236,1,220,255,215,2,170,255,215,2,182,255,215,
+3,24,255,215,0,26,1,159,255,236,1,220,255,215,1,221,255,236,1,225,255,215,
+1,228,255,236,2,109,255,236,2,125,255,215,2,129,255,236,2,131,255,236,2,139,
+255,236,2,170,255,215,2,182,255,215,2,184,255,236,2,186,255,236,2,192,255,
+215,2,194,255,215,2,197,255,215,2,199,255,215,2,213,255,215,2,248,255,236,
+2,250,255,236,2,252,255,236,2,254,255,215,3,14,255,236,3,16,255,236,3,24,
+255,215,0,55,0,5,0,41,0,10,0,41,0,38,255,236,0,42,255,236,0,50,255,236,0,
+52,255,236,0,137,255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,
+255,236,0,152,255,236,0,154,255,236,0,200,255,236,0,206,255,236,0,222,255,
+236,0,224,255,236,0,226,255,236,0,228,255,236,1,14,255,236,1,18,255,236,1,
+20,255,236,1,159,255,236,1,184,255,236,1,187,255,236,2,11,0,41,2,95,255,236,
+2,108,255,236,2,126,255,236,2,132,255,236,2,134,255,236,2,136,255,236,2,138,
+255,236,2,140,255,236,2,177,255,236,2,179,255,236,2,225,255,236,2,227,255,
+236,2,239,255,236,2,241,255,236,2,243,255,236,3,21,255,236,3,25,255,236,3,
+73,255,236,3,75,255,236,3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,
+3,85,255,236,3,87,255,236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,
+236,0,52,0,5,255,154,0,10,255,154,1,166,255,133,1,168,255,215,1,176,255,215,
+1,181,255,236,1,188,255,133,1,189,255,236,1,191,255,236,1,193,255,174,1,196,
+255,133,1,220,255,215,1,225,255,215,1,228,255,195,2,7,255,154,2,11,255,154,
+2,118,255,215,2,124,255,174,2,125,255,215,2,128,255,174,2,130,255,174,2,159,
+255,215,2,169,255,133,2,170,255,215,2,181,255,133,2,182,255,215,2,183,255,
+133,2,185,255,133,2,187,255,215,2,189,255,133,2,191,255,174,2,192,255,215,
+2,193,255,174,2,194,255,215,2,202,255,215,2,206,255,236,2,212,255,174,2,213,
+255,215,2,229,255,215,2,247,255,236,2,249,255,236,2,251,255,236,2,253,255,
+174,2,254,255,215,3,5,255,215,3,7,255,215,3,13,255,174,3,15,255,174,3,17,
+255,236,3,23,255,133,3,24,255,215,3,27,255,236,0,49,0,5,255,154,0,10,255,
+154,1,157,255,133,1,166,255,133,1,168,255,215,1,176,255,236,1,188,255,133,
+1,189,255,215,1,193,255,174,1,196,255,133,1,220,255,215,1,223,255,236,1,225,
+255,236,1,228,255,215,2,7,255,154,2,11,255,154,2,118,255,236,2,124,255,174,
+2,125,255,236,2,128,255,174,2,130,255,174,2,159,255,236,2,169,255,133,2,170,
+255,215,2,181,255,133,2,182,255,215,2,183,255,133,2,185,255,133,2,187,255,
+236,2,189,255,133,2,191,255,174,2,192,255,236,2,193,255,174,2,194,255,236,
+2,202,255,236,2,212,255,174,2,213,255,236,2,229,255,236,2,247,255,215,2,249,
+255,215,2,251,255,215,2,253,255,174,2,254,255,236,3,5,255,236,3,7,255,236,
+3,13,255,174,3,15,255,174,3,23,255,133,3,24,255,215,0,29,1,157,255,154,1,
+166,255,154,1,196,255,133,1,220,255,215,1,221,255,236,1,225,255,215,1,228,
+255,195,1,246,255,236,2,109,255,236,2,125,255,215,2,129,255,236,2,131,255,
+236,2,139,255,236,2,170,255,215,2,182,255,215,2,184,255,236,2,186,255,236,
+2,192,255,215,2,194,255,215,2,197,255,215,2,199,255,215,2,213,255,215,2,248,
+255,236,2,250,255,236,2,252,255,236,2,254,255,215,3,14,255,236,3,16,255,236,
+3,24,255,215,0,109,0,5,0,41,0,10,0,41,0,38,255,215,0,42,255,215,0,50,255,
+215,0,52,255,215,0,137,255,215,0,148,255,215,0,149,255,215,0,150,255,215,
+0,151,255,215,0,152,255,215,0,154,255,215,0,200,255,215,0,206,255,215,0,222,
+255,215,0,224,255,215,0,226,255,215,0,228,255,215,1,14,255,215,1,18,255,215,
+1,20,255,215,1,159,255,215,1,164,0,41,1,181,0,41,1,184,255,215,1,187,255,
+215,1,190,255,174,1,203,255,236,1,206,0,20,1,207,255,215,1,216,255,215,1,
+219,255,215,1,220,255,215,1,221,255,215,1,222,255,215,1,225,255,195,1,228,
+255,215,1,234,255,215,1,237,255,215,2,7,0,41,2,11,0,41,2,95,255,215,2,106,
+255,215,2,108,255,215,2,109,255,215,2,125,255,195,2,126,255,215,2,127,255,
+215,2,129,255,215,2,131,255,215,2,132,255,215,2,133,255,215,2,134,255,215,
+2,135,255,215,2,136,255,215,2,137,255,215,2,138,255,215,2,139,255,215,2,140,
+255,215,2,141,255,215,2,170,255,215,2,177,255,215,2,178,255,215,2,179,255,
+215,2,180,255,215,2,182,255,215,2,184,255,215,2,186,255,215,2,192,255,195,
+2,194,255,195,2,206,0,41,2,213,255,195,2,224,255,215,2,225,255,215,2,227,
+255,215,2,239,255,215,2,240,255,215,2,241,255,215,2,242,255,215,2,243,255,
+215,2,244,255,215,2,248,255,215,2,250,255,215,2,252,255,215,2,254,255,195,
+3,10,255,215,3,12,255,215,3,14,255,215,3,16,255,215,3,17,0,41,3,21,255,215,
+3,22,255,215,3,24,255,215,3,25,255,215,3,26,255,215,3,27,0,41,3,73,255,215,
+3,75,255,215,3,77,255,215,3,79,255,215,3,81,255,215,3,83,255,215,3,85,255,
+215,3,87,255,215,3,89,255,215,3,91,255,215,3,93,255,215,3,95,255,215,0,103,
+0,5,0,82,0,10,0,82,1,164,255,154,1,170,255,133,1,174,255,113,1,181,255,154,
+1,187,255,215,1,188,0,41,1,190,255,215,1,196,0,20,1,201,255,236,1,202,255,
+174,1,204,255,215,1,205,255,215,1,206,255,92,1,207,255,174,1,209,255,215,
+1,210,255,215,1,211,255,215,1,212,255,215,1,213,255,92,1,214,255,215,1,215,
+255,215,1,216,255,174,1,217,255,215,1,218,255,215,1,219,255,174,1,222,255,
+174,1,224,255,215,1,225,255,215,1,226,255,215,1,227,255,215,1,229,255,215,
+1,230,255,215,1,232,255,215,1,233,255,215,1,234,255,215,1,236,255,215,1,237,
+255,174,1,238,255,215,1,240,0,82,1,242,255,113,1,243,255,215,1,245,255,215,
+1,247,255,215,1,249,255,215,2,7,0,82,2,11,0,82,2,106,255,174,2,107,255,215,
+2,114,255,133,2,125,255,215,2,127,255,174,2,133,255,174,2,135,255,174,2,137,
+255,174,2,141,255,174,2,150,255,215,2,154,255,215,2,164,255,215,2,166,255,
+215,2,169,0,41,2,172,255,215,2,174,255,215,2,176,255,215,2,178,255,174,2,
+180,255,174,2,181,0,41,2,183,0,41,2,185,0,41,2,189,0,41,2,192,255,215,2,194,
+255,215,2,196,255,215,2,206,255,154,2,207,255,92,2,209,255,215,2,211,255,
+215,2,213,255,215,2,215,255,215,2,217,255,133,2,218,255,174,2,219,255,133,
+2,220,255,174,2,221,255,133,2,224,255,174,2,236,255,215,2,238,255,215,2,240,
+255,174,2,242,255,174,2,244,255,174,2,254,255,215,3,0,255,215,3,10,255,174,
+3,12,255,174,3,17,255,154,3,18,255,92,3,20,255,215,3,22,255,174,3,23,0,41,
+3,26,255,174,3,27,255,154,3,28,255,92,0,138,0,5,255,174,0,10,255,174,0,38,
+255,236,0,42,255,236,0,50,255,236,0,52,255,236,0,55,255,133,0,56,255,236,
+0,57,255,195,0,58,255,215,0,60,255,154,0,137,255,236,0,148,255,236,0,149,
+255,236,0,150,255,236,0,151,255,236,0,152,255,236,0,154,255,236,0,155,255,
+236,0,156,255,236,0,157,255,236,0,158,255,236,0,159,255,154,0,200,255,236,
+0,206,255,236,0,222,255,236,0,224,255,236,0,226,255,236,0,228,255,236,1,14,
+255,236,1,18,255,236,1,20,255,215,1,36,255,133,1,38,255,133,1,44,255,236,
+1,48,255,236,1,50,255,236,1,52,255,236,1,54,255,215,1,56,255,154,1,58,255,
+154,1,157,255,154,1,159,255,236,1,164,0,61,1,166,255,133,1,174,0,41,1,181,
+0,41,1,184,255,236,1,187,255,236,1,188,255,133,1,190,255,215,1,193,255,174,
+1,196,255,154,1,213,0,41,1,220,255,215,1,225,255,195,1,228,255,195,1,231,
+0,41,1,242,0,41,1,250,255,215,1,252,255,215,1,254,255,215,2,0,255,154,2,7,
+255,174,2,11,255,174,2,95,255,236,2,97,255,236,2,108,255,236,2,124,255,174,
+2,125,255,195,2,126,255,236,2,128,255,174,2,130,255,174,2,132,255,236,2,134,
+255,236,2,136,255,236,2,138,255,236,2,140,255,236,2,169,255,133,2,170,255,
+215,2,177,255,236,2,179,255,236,2,181,255,133,2,182,255,215,2,183,255,133,
+2,185,255,133,2,189,255,133,2,191,255,174,2,192,255,195,2,193,255,174,2,194,
+255,195,2,197,255,174,2,198,255,195,2,199,255,174,2,206,0,41,2,207,0,41,2,
+212,255,174,2,213,255,195,2,225,255,236,2,227,255,236,2,239,255,236,2,241,
+255,236,2,243,255,236,2,253,255,174,2,254,255,195,3,13,255,174,3,15,255,174,
+3,17,0,41,3,18,0,41,3,21,255,236,3,23,255,133,3,24,255,215,3,25,255,236,3,
+27,0,41,3,28,0,41,3,73,255,236,3,75,255,236,3,77,255,236,3,79,255,236,3,81,
+255,236,3,83,255,236,3,85,255,236,3,87,255,236,3,89,255,236,3,91,255,236,
+3,93,255,236,3,95,255,236,3,97,255,236,3,99,255,236,3,101,255,236,3,103,255,
+236,3,105,255,236,3,107,255,236,3,109,255,236,3,111,255,154,3,113,255,154,
+3,115,255,154,3,131,255,133,0,42,1,157,255,215,1,188,255,215,1,189,255,215,
+1,191,255,236,1,193,255,195,1,196,255,215,1,208,255,236,1,220,255,215,1,225,
+255,215,1,228,255,215,2,124,255,195,2,125,255,215,2,128,255,195,2,130,255,
+195,2,160,255,236,2,169,255,215,2,170,255,215,2,181,255,215,2,182,255,215,
+2,183,255,215,2,185,255,215,2,188,255,236,2,189,255,215,2,191,255,195,2,192,
+255,215,2,193,255,195,2,194,255,215,2,203,255,236,2,212,255,195,2,213,255,
+215,2,230,255,236,2,247,255,215,2,249,255,215,2,251,255,215,2,253,255,195,
+2,254,255,215,3,6,255,236,3,8,255,236,3,13,255,195,3,15,255,195,3,23,255,
+215,3,24,255,215,0,34,0,55,255,236,0,57,255,236,0,59,255,236,0,60,255,236,
+0,159,255,236,1,36,255,236,1,38,255,236,1,56,255,236,1,58,255,236,1,176,255,
+236,1,188,255,236,1,189,255,236,1,191,255,236,2,0,255,236,2,118,255,236,2,
+159,255,236,2,169,255,236,2,181,255,236,2,183,255,236,2,185,255,236,2,187,
+255,236,2,189,255,236,2,202,255,236,2,229,255,236,2,247,255,236,2,249,255,
+236,2,251,255,236,3,5,255,236,3,7,255,236,3,23,255,236,3,111,255,236,3,113,
+255,236,3,115,255,236,3,131,255,236,0,143,0,5,0,82,0,10,0,82,0,16,255,92,
+1,159,255,236,1,164,255,154,1,170,255,133,1,174,255,133,1,181,255,133,1,184,
+255,215,1,190,255,195,1,202,255,133,1,204,255,195,1,205,255,195,1,206,255,
+92,1,207,255,133,1,208,255,195,1,209,255,195,1,210,255,195,1,211,255,195,
+1,212,255,195,1,213,255,92,1,214,255,195,1,215,255,195,1,216,255,133,1,217,
+255,195,1,218,255,195,1,219,255,133,1,220,255,195,1,221,255,195,1,222,255,
+133,1,223,255,195,1,224,255,195,1,225,255,195,1,226,255,195,1,227,255,195,
+1,228,255,195,1,229,255,195,1,230,255,195,1,231,255,195,1,232,255,195,1,233,
+255,154,1,234,255,133,1,236,255,195,1,237,255,133,1,238,255,174,1,240,0,61,
+1,242,255,92,1,243,255,195,1,245,255,195,1,247,255,195,1,249,255,195,2,7,
+0,82,2,11,0,82,2,106,255,133,2,107,255,195,2,108,255,215,2,109,255,195,2,
+114,255,133,2,125,255,195,2,126,255,215,2,127,255,133,2,129,255,195,2,131,
+255,195,2,132,255,215,2,133,255,133,2,134,255,215,2,135,255,133,2,136,255,
+215,2,137,255,133,2,138,255,215,2,139,255,195,2,140,255,215,2,141,255,133,
+2,150,255,195,2,154,255,195,2,160,255,195,2,164,255,195,2,166,255,195,2,170,
+255,195,2,172,255,195,2,174,255,195,2,176,255,195,2,177,255,215,2,178,255,
+133,2,179,255,215,2,180,255,133,2,182,255,195,2,184,255,195,2,186,255,195,
+2,188,255,195,2,192,255,195,2,194,255,195,2,196,255,195,2,197,255,174,2,198,
+255,113,2,199,255,174,2,203,255,195,2,206,255,133,2,207,255,92,2,209,255,
+195,2,211,255,195,2,213,255,195,2,215,255,195,2,217,255,133,2,218,255,133,
+2,219,255,133,2,220,255,133,2,221,255,133,2,224,255,133,2,225,255,215,2,227,
+255,215,2,230,255,195,2,236,255,195,2,238,255,195,2,239,255,215,2,240,255,
+133,2,241,255,215,2,242,255,133,2,243,255,215,2,244,255,133,2,248,255,195,
+2,250,255,195,2,252,255,195,2,254,255,195,3,0,255,195,3,6,255,195,3,8,255,
+195,3,9,255,92,3,10,255,133,3,11,255,92,3,12,255,133,3,14,255,195,3,16,255,
+195,3,17,255,133,3,18,255,92,3,20,255,195,3,21,255,215,3,22,255,133,3,24,
+255,195,3,25,255,215,3,26,255,133,3,27,255,133,3,28,255,92,0,66,1,157,255,
+215,1,163,0,246,1,164,0,41,1,166,255,215,1,170,0,20,1,174,0,41,1,181,0,41,
+1,184,255,236,1,187,255,236,1,188,255,215,1,190,255,236,1,193,255,215,1,196,
+255,215,1,206,0,41,1,213,0,41,1,225,255,215,1,231,0,41,1,241,0,102,1,242,
+0,41,2,108,255,236,2,114,0,20,2,124,255,215,2,125,255,215,2,126,255,236,2,
+128,255,215,2,130,255,215,2,132,255,236,2,134,255,236,2,136,255,236,2,138,
+255,236,2,140,255,236,2,169,255,215,2,177,255,236,2,179,255,236,2,181,255,
+215,2,183,255,215,2,185,255,215,2,189,255,215,2,191,255,215,2,192,255,215,
+2,193,255,215,2,194,255,215,2,198,255,215,2,206,0,41,2,207,0,41,2,212,255,
+215,2,213,255,215,2,217,0,20,2,219,0,20,2,221,0,20,2,225,255,236,2,227,255,
+236,2,239,255,236,2,241,255,236,2,243,255,236,2,253,255,215,2,254,255,215,
+3,13,255,215,3,15,255,215,3,17,0,41,3,18,0,41,3,21,255,236,3,23,255,215,3,
+25,255,236,3,27,0,41,3,28,0,41,0,49,0,5,0,61,0,10,0,61,0,16,255,215,1,159,
+255,215,1,164,0,41,1,181,0,41,1,184,255,215,1,187,255,215,1,190,255,195,1,
+203,255,215,1,213,0,41,1,220,255,215,1,225,255,174,1,242,0,41,2,7,0,61,2,
+11,0,61,2,108,255,215,2,125,255,174,2,126,255,215,2,132,255,215,2,134,255,
+215,2,136,255,215,2,138,255,215,2,140,255,215,2,170,255,215,2,177,255,215,
+2,179,255,215,2,182,255,215,2,192,255,174,2,194,255,174,2,197,255,195,2,198,
+255,154,2,199,255,195,2,206,0,41,2,207,0,41,2,213,255,174,2,225,255,215,2,
+227,255,215,2,239,255,215,2,241,255,215,2,243,255,215,2,254,255,174,3,17,
+0,41,3,18,0,41,3,21,255,215,3,24,255,215,3,25,255,215,3,27,0,41,3,28,0,41,
+0,38,0,5,0,41,0,10,0,41,1,177,255,236,1,181,255,215,1,188,255,215,1,189,255,
+236,1,190,255,236,1,191,255,215,1,193,255,236,1,196,255,236,1,199,255,236,
+2,7,0,41,2,11,0,41,2,124,255,236,2,128,255,236,2,130,255,236,2,161,255,236,
+2,169,255,215,2,181,255,215,2,183,255,215,2,185,255,215,2,189,255,215,2,191,
+255,236,2,193,255,236,2,206,255,215,2,212,255,236,2,231,255,236,2,233,255,
+236,2,245,255,236,2,247,255,236,2,249,255,236,2,251,255,236,2,253,255,236,
+3,13,255,236,3,15,255,236,3,17,255,215,3,23,255,215,3,27,255,215,0,76,0,5,
+0,41,0,10,0,41,0,16,255,215,0,38,255,215,0,42,255,215,0,50,255,215,0,52,255,
+215,0,137,255,215,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,
+0,152,255,215,0,154,255,215,0,200,255,215,0,206,255,215,0,222,255,215,0,224,
+255,215,0,226,255,215,0,228,255,215,1,14,255,215,1,18,255,215,1,20,255,215,
+1,159,255,215,1,164,0,61,1,181,0,41,1,184,255,215,1,187,255,215,1,190,255,
+174,1,203,255,215,1,213,0,41,1,225,255,174,1,228,255,215,1,242,0,41,2,7,0,
+41,2,11,0,41,2,95,255,215,2,108,255,215,2,125,255,174,2,126,255,215,2,132,
+255,215,2,134,255,215,2,136,255,215,2,138,255,215,2,140,255,215,2,177,255,
+215,2,179,255,215,2,192,255,174,2,194,255,174,2,206,0,41,2,207,0,41,2,213,
+255,174,2,225,255,215,2,227,255,215,2,239,255,215,2,241,255,215,2,243,255,
+215,2,254,255,174,3,17,0,41,3,18,0,41,3,21,255,215,3,25,255,215,3,27,0,41,
+3,28,0,41,3,73,255,215,3,75,255,215,3,77,255,215,3,79,255,215,3,81,255,215,
+3,83,255,215,3,85,255,215,3,87,255,215,3,89,255,215,3,91,255,215,3,93,255,
+215,3,95,255,215,0,87,0,15,255,195,0,17,255,195,0,36,255,236,0,44,255,236,
+0,55,255,195,0,57,255,215,0,58,255,236,0,59,255,215,0,60,255,215,0,61,255,
+236,0,130,255,236,0,131,255,236,0,132,255,236,0,133,255,236,0,134,255,236,
+0,135,255,236,0,136,255,215,0,142,255,236,0,143,255,236,0,144,255,236,0,145,
+255,236,0,159,255,215,0,194,255,236,0,196,255,236,0,198,255,236,0,236,255,
+236,0,240,255,236,0,242,255,236,1,36,255,195,1,38,255,195,1,54,255,236,1,
+56,255,215,1,58,255,215,1,59,255,236,1,61,255,236,1,63,255,236,1,67,255,236,
+1,157,255,215,1,164,255,215,1,166,255,215,1,170,255,236,1,174,255,236,1,176,
+255,215,1,188,255,195,1,191,255,236,1,196,255,215,1,250,255,236,1,252,255,
+236,1,254,255,236,2,0,255,215,2,40,255,236,2,88,255,236,2,114,255,236,2,118,
+255,215,2,159,255,215,2,169,255,195,2,181,255,195,2,183,255,195,2,185,255,
+195,2,187,255,215,2,189,255,195,2,202,255,215,2,217,255,236,2,219,255,236,
+2,221,255,236,2,229,255,215,3,5,255,215,3,7,255,215,3,23,255,195,3,29,255,
+236,3,31,255,236,3,33,255,236,3,35,255,236,3,37,255,236,3,39,255,236,3,41,
+255,236,3,43,255,236,3,45,255,236,3,47,255,236,3,49,255,236,3,51,255,236,
+3,69,255,236,3,71,255,236,3,111,255,215,3,113,255,215,3,115,255,215,3,131,
+255,195,0,69,0,5,0,61,0,10,0,61,0,15,255,51,0,17,255,51,0,36,255,174,0,38,
+255,236,0,59,255,236,0,60,255,236,0,61,255,215,0,130,255,174,0,131,255,174,
+0,132,255,174,0,133,255,174,0,134,255,174,0,135,255,174,0,136,255,113,0,137,
+255,236,0,159,255,236,0,194,255,174,0,196,255,174,0,198,255,174,0,200,255,
+236,0,206,255,236,1,56,255,236,1,58,255,236,1,59,255,215,1,61,255,215,1,63,
+255,215,1,67,255,174,1,164,255,174,1,170,255,174,1,174,255,154,1,181,255,
+154,1,187,255,236,1,206,255,154,1,213,255,174,1,242,255,174,2,0,255,236,2,
+7,0,61,2,11,0,61,2,40,255,174,2,88,255,174,2,114,255,174,2,206,255,154,2,
+207,255,174,2,217,255,174,2,219,255,174,2,221,255,174,3,9,255,174,3,11,255,
+174,3,17,255,154,3,18,255,174,3,27,255,154,3,28,255,174,3,29,255,174,3,31,
+255,174,3,33,255,174,3,35,255,174,3,37,255,174,3,39,255,174,3,41,255,174,
+3,43,255,174,3,45,255,174,3,47,255,174,3,49,255,174,3,51,255,174,3,111,255,
+236,3,113,255,236,3,115,255,236,0,66,0,5,0,41,0,10,0,41,0,12,0,41,0,38,255,
+215,0,42,255,215,0,50,255,215,0,52,255,215,0,64,0,41,0,96,0,41,0,137,255,
+215,0,148,255,215,0,149,255,215,0,150,255,215,0,151,255,215,0,152,255,215,
+0,154,255,215,0,200,255,215,0,206,255,215,0,222,255,215,0,224,255,215,0,226,
+255,215,0,228,255,215,1,14,255,215,1,18,255,215,1,159,255,215,1,184,255,215,
+1,187,255,215,1,190,255,195,1,225,255,195,2,7,0,41,2,11,0,41,2,95,255,215,
+2,108,255,215,2,125,255,195,2,126,255,215,2,132,255,215,2,134,255,215,2,136,
+255,215,2,138,255,215,2,140,255,215,2,177,255,215,2,179,255,215,2,192,255,
+195,2,194,255,195,2,198,255,174,2,213,255,195,2,225,255,215,2,227,255,215,
+2,239,255,215,2,241,255,215,2,243,255,215,2,254,255,195,3,21,255,215,3,25,
+255,215,3,73,255,215,3,75,255,215,3,77,255,215,3,79,255,215,3,81,255,215,
+3,83,255,215,3,85,255,215,3,87,255,215,3,89,255,215,3,91,255,215,3,93,255,
+215,3,95,255,215,1,83,0,5,0,82,0,10,0,82,0,15,255,154,0,16,255,154,0,17,255,
+154,0,34,0,41,0,36,255,133,0,38,255,195,0,42,255,195,0,50,255,195,0,52,255,
+195,0,54,255,236,0,55,0,20,0,68,255,133,0,70,255,133,0,71,255,133,0,72,255,
+133,0,74,255,154,0,80,255,174,0,81,255,174,0,82,255,133,0,83,255,174,0,84,
+255,133,0,85,255,174,0,86,255,133,0,88,255,174,0,89,255,195,0,90,255,195,
+0,91,255,195,0,92,255,195,0,93,255,195,0,130,255,133,0,131,255,133,0,132,
+255,133,0,133,255,133,0,134,255,133,0,135,255,133,0,136,255,113,0,137,255,
+195,0,148,255,195,0,149,255,195,0,150,255,195,0,151,255,195,0,152,255,195,
+0,154,255,195,0,162,255,133,0,163,255,133,0,164,255,133,0,165,255,133,0,166,
+255,133,0,167,255,133,0,168,255,133,0,169,255,133,0,170,255,133,0,171,255,
+133,0,172,255,133,0,173,255,133,0,179,255,174,0,180,255,133,0,181,255,133,
+0,182,255,133,0,183,255,133,0,184,255,133,0,186,255,133,0,187,255,174,0,188,
+255,174,0,189,255,174,0,190,255,174,0,191,255,195,0,193,255,195,0,194,255,
+133,0,195,255,133,0,196,255,133,0,197,255,133,0,198,255,133,0,199,255,133,
+0,200,255,195,0,201,255,133,0,203,255,133,0,205,255,133,0,206,255,195,0,207,
+255,133,0,213,255,133,0,215,255,133,0,217,255,133,0,219,255,133,0,221,255,
+133,0,222,255,195,0,224,255,195,0,226,255,195,0,228,255,195,1,6,255,174,1,
+8,255,174,1,10,255,174,1,14,255,195,1,15,255,133,1,17,255,133,1,18,255,195,
+1,19,255,133,1,20,255,195,1,21,255,133,1,28,255,236,1,29,255,133,1,31,255,
+133,1,32,255,236,1,33,255,133,1,34,255,236,1,35,255,133,1,36,0,20,1,38,0,
+20,1,55,255,195,1,57,255,195,1,64,255,195,1,67,255,133,1,68,255,133,1,74,
+255,133,1,159,255,195,1,160,255,236,1,164,255,174,1,170,255,133,1,174,255,
+154,1,181,255,154,1,184,255,195,1,187,255,195,1,188,0,20,1,190,255,195,1,
+196,0,20,1,202,255,133,1,204,255,195,1,205,255,195,1,206,255,113,1,207,255,
+133,1,208,255,195,1,209,255,195,1,210,255,195,1,212,255,195,1,213,255,113,
+1,214,255,195,1,215,255,195,1,216,255,133,1,217,255,195,1,218,255,195,1,219,
+255,133,1,220,255,195,1,221,255,195,1,222,255,133,1,223,255,195,1,224,255,
+195,1,225,255,195,1,226,255,195,1,227,255,195,1,229,255,195,1,230,255,195,
+1,232,255,195,1,233,255,195,1,234,255,133,1,235,0,41,1,236,255,195,1,237,
+255,133,1,238,255,133,1,240,0,82,1,242,255,133,1,243,255,195,1,245,255,195,
+1,247,255,195,1,249,255,195,1,251,255,195,1,253,255,195,1,255,255,195,2,1,
+255,195,2,7,0,82,2,11,0,82,2,40,255,133,2,88,255,133,2,89,255,133,2,95,255,
+195,2,96,255,133,2,106,255,133,2,107,255,195,2,108,255,195,2,109,255,195,
+2,114,255,133,2,125,255,195,2,126,255,195,2,127,255,133,2,129,255,195,2,131,
+255,195,2,132,255,195,2,133,255,133,2,134,255,195,2,135,255,133,2,136,255,
+195,2,137,255,133,2,138,255,195,2,139,255,195,2,140,255,195,2,141,255,133,
+2,150,255,195,2,154,255,195,2,160,255,195,2,164,255,195,2,166,255,195,2,169,
+0,20,2,170,255,195,2,172,255,195,2,174,255,195,2,176,255,195,2,177,255,195,
+2,178,255,133,2,179,255,195,2,180,255,133,2,181,0,20,2,182,255,195,2,183,
+0,20,2,184,255,195,2,185,0,20,2,186,255,195,2,188,255,195,2,189,0,20,2,192,
+255,195,2,194,255,195,2,196,255,195,2,197,255,195,2,198,255,133,2,199,255,
+195,2,203,255,195,2,206,255,154,2,207,255,113,2,209,255,195,2,211,255,195,
+2,213,255,195,2,215,255,195,2,217,255,133,2,218,255,133,2,219,255,133,2,220,
+255,133,2,221,255,133,2,224,255,133,2,225,255,195,2,227,255,195,2,230,255,
+195,2,236,255,195,2,238,255,195,2,239,255,195,2,240,255,133,2,241,255,195,
+2,242,255,133,2,243,255,195,2,244,255,133,2,248,255,195,2,250,255,195,2,252,
+255,195,2,254,255,195,3,0,255,195,3,6,255,195,3,8,255,195,3,9,255,133,3,10,
+255,133,3,11,255,133,3,12,255,133,3,14,255,195,3,16,255,195,3,17,255,154,
+3,18,255,113,3,20,255,195,3,21,255,195,3,22,255,133,3,23,0,20,3,24,255,195,
+3,25,255,195,3,26,255,133,3,27,255,154,3,28,255,113,3,29,255,133,3,30,255,
+133,3,31,255,133,3,33,255,133,3,34,255,133,3,35,255,133,3,36,255,133,3,37,
+255,133,3,38,255,133,3,39,255,133,3,40,255,133,3,41,255,133,3,42,255,133,
+3,43,255,133,3,44,255,133,3,45,255,133,3,46,255,133,3,47,255,133,3,48,255,
+133,3,49,255,133,3,50,255,133,3,51,255,133,3,52,255,133,3,54,255,133,3,56,
+255,133,3,58,255,133,3,60,255,133,3,62,255,133,3,64,255,133,3,66,255,133,
+3,68,255,133,3,73,255,195,3,74,255,133,3,75,255,195,3,76,255,133,3,77,255,
+195,3,78,255,133,3,79,255,195,3,80,255,133,3,81,255,195,3,82,255,133,3,83,
+255,195,3,84,255,133,3,85,255,195,3,86,255,133,3,87,255,195,3,88,255,133,
+3,89,255,195,3,90,255,133,3,91,255,195,3,92,255,133,3,93,255,195,3,94,255,
+133,3,95,255,195,3,96,255,133,3,98,255,174,3,100,255,174,3,102,255,174,3,
+104,255,174,3,106,255,174,3,108,255,174,3,110,255,174,3,112,255,195,3,114,
+255,195,3,116,255,195,3,131,0,20,0,99,0,5,0,61,0,10,0,61,0,16,255,215,1,159,
+255,215,1,164,255,174,1,170,255,154,1,174,255,133,1,181,255,154,1,187,255,
+215,1,190,255,236,1,196,0,41,1,202,255,174,1,204,255,195,1,205,255,195,1,
+206,255,113,1,207,255,195,1,210,255,195,1,211,255,195,1,212,255,195,1,213,
+255,113,1,214,255,195,1,215,255,195,1,216,255,154,1,217,255,195,1,218,255,
+195,1,219,255,195,1,222,255,174,1,224,255,195,1,225,255,195,1,226,255,195,
+1,227,255,195,1,229,255,195,1,230,255,195,1,232,255,195,1,233,255,195,1,234,
+255,195,1,236,255,195,1,237,255,195,1,238,255,195,1,240,0,61,1,242,255,133,
+1,243,255,195,1,245,255,195,1,247,255,195,1,249,255,195,2,7,0,61,2,11,0,61,
+2,106,255,154,2,107,255,195,2,114,255,154,2,125,255,195,2,127,255,154,2,133,
+255,154,2,135,255,154,2,137,255,154,2,141,255,154,2,150,255,195,2,154,255,
+195,2,164,255,195,2,166,255,195,2,172,255,195,2,174,255,195,2,176,255,195,
+2,178,255,154,2,180,255,154,2,192,255,195,2,194,255,195,2,196,255,195,2,198,
+255,174,2,206,255,154,2,207,255,113,2,209,255,195,2,211,255,195,2,213,255,
+195,2,215,255,195,2,217,255,154,2,218,255,174,2,219,255,154,2,220,255,174,
+2,221,255,154,2,224,255,154,2,236,255,195,2,238,255,195,2,240,255,154,2,242,
+255,154,2,244,255,154,2,254,255,195,3,0,255,195,3,9,255,133,3,10,255,154,
+3,11,255,133,3,12,255,154,3,17,255,154,3,18,255,113,3,20,255,195,3,22,255,
+154,3,26,255,154,3,27,255,154,3,28,255,113,0,42,1,157,255,215,1,164,255,215,
+1,166,255,195,1,168,255,236,1,170,255,215,1,174,255,215,1,176,255,195,1,181,
+255,215,1,188,255,195,1,191,255,215,1,196,255,195,1,199,255,215,1,206,255,
+195,1,213,255,195,1,242,255,195,2,114,255,215,2,118,255,195,2,159,255,195,
+2,161,255,215,2,169,255,195,2,181,255,195,2,183,255,195,2,185,255,195,2,187,
+255,195,2,189,255,195,2,202,255,195,2,206,255,215,2,207,255,195,2,217,255,
+215,2,219,255,215,2,221,255,215,2,229,255,195,2,231,255,215,2,233,255,215,
+2,245,255,215,3,5,255,195,3,7,255,195,3,17,255,215,3,18,255,195,3,23,255,
+195,3,27,255,215,3,28,255,195,0,46,0,5,0,41,0,10,0,41,1,159,255,215,1,164,
+0,61,1,174,0,41,1,181,0,41,1,184,255,236,1,187,255,215,1,190,255,215,1,193,
+255,236,1,225,255,195,2,7,0,41,2,11,0,41,2,108,255,236,2,124,255,236,2,125,
+255,195,2,126,255,236,2,128,255,236,2,130,255,236,2,132,255,236,2,134,255,
+236,2,136,255,236,2,138,255,236,2,140,255,236,2,177,255,236,2,179,255,236,
+2,191,255,236,2,192,255,195,2,193,255,236,2,194,255,195,2,206,0,41,2,212,
+255,236,2,213,255,195,2,225,255,236,2,227,255,236,2,239,255,236,2,241,255,
+236,2,243,255,236,2,253,255,236,2,254,255,195,3,13,255,236,3,15,255,236,3,
+17,0,41,3,21,255,236,3,25,255,236,3,27,0,41,0,48,1,163,0,246,1,164,0,41,1,
+170,0,20,1,174,0,41,1,181,0,41,1,188,255,236,1,190,255,236,1,191,0,20,1,193,
+255,236,1,206,0,41,1,213,0,20,1,225,255,215,1,231,0,41,1,241,0,102,1,242,
+0,41,2,114,0,20,2,124,255,236,2,125,255,215,2,128,255,236,2,130,255,236,2,
+169,255,236,2,181,255,236,2,183,255,236,2,185,255,236,2,189,255,236,2,191,
+255,236,2,192,255,215,2,193,255,236,2,194,255,215,2,197,255,215,2,198,255,
+215,2,199,255,215,2,206,0,41,2,207,0,20,2,212,255,236,2,213,255,215,2,217,
+0,20,2,219,0,20,2,221,0,20,2,253,255,236,2,254,255,215,3,13,255,236,3,15,
+255,236,3,17,0,41,3,18,0,20,3,23,255,236,3,27,0,41,3,28,0,20,0,62,1,157,255,
+236,1,163,0,225,1,164,0,61,1,170,0,41,1,174,0,41,1,181,0,41,1,188,255,236,
+1,189,0,41,1,190,255,236,1,191,0,20,1,193,255,236,1,196,255,236,1,199,0,20,
+1,206,0,61,1,209,0,20,1,213,0,41,1,220,255,236,1,225,255,215,1,228,255,236,
+1,231,0,41,1,241,0,102,1,242,0,41,2,114,0,41,2,124,255,236,2,125,255,215,
+2,128,255,236,2,130,255,236,2,161,0,20,2,169,255,236,2,170,255,236,2,181,
+255,236,2,182,255,236,2,183,255,236,2,185,255,236,2,189,255,236,2,191,255,
+236,2,192,255,215,2,193,255,236,2,194,255,215,2,206,0,41,2,207,0,41,2,212,
+255,236,2,213,255,215,2,217,0,41,2,219,0,41,2,221,0,41,2,231,0,20,2,233,0,
+20,2,245,0,20,2,247,0,41,2,249,0,41,2,251,0,41,2,253,255,236,2,254,255,215,
+3,13,255,236,3,15,255,236,3,17,0,41,3,18,0,41,3,23,255,236,3,24,255,236,3,
+27,0,41,3,28,0,41,0,30,0,5,255,195,0,10,255,195,1,157,255,133,1,166,255,113,
+1,168,255,215,1,188,255,133,1,193,255,195,1,196,255,133,1,220,255,215,1,228,
+255,215,2,7,255,195,2,11,255,195,2,124,255,195,2,128,255,195,2,130,255,195,
+2,169,255,133,2,170,255,215,2,181,255,133,2,182,255,215,2,183,255,133,2,185,
+255,133,2,189,255,133,2,191,255,195,2,193,255,195,2,212,255,195,2,253,255,
+195,3,13,255,195,3,15,255,195,3,23,255,133,3,24,255,215,0,32,0,5,255,154,
+0,10,255,154,1,157,255,133,1,166,255,133,1,168,255,215,1,188,255,133,1,193,
+255,195,1,196,255,133,1,220,255,215,1,228,255,215,2,7,255,154,2,11,255,154,
+2,124,255,195,2,128,255,195,2,130,255,195,2,169,255,133,2,170,255,215,2,181,
+255,133,2,182,255,215,2,183,255,133,2,185,255,133,2,189,255,133,2,191,255,
+195,2,193,255,195,2,197,255,195,2,199,255,195,2,212,255,195,2,253,255,195,
+3,13,255,195,3,15,255,195,3,23,255,133,3,24,255,215,0,35,1,157,255,215,1,
+164,255,215,1,166,255,215,1,168,255,215,1,174,255,215,1,176,255,195,1,177,
+255,236,1,181,255,195,1,188,255,215,1,189,255,236,1,191,255,215,1,213,255,
+215,1,242,255,215,2,118,255,195,2,159,255,195,2,169,255,215,2,181,255,215,
+2,183,255,215,2,185,255,215,2,187,255,195,2,189,255,215,2,202,255,195,2,206,
+255,195,2,207,255,215,2,229,255,195,2,247,255,236,2,249,255,236,2,251,255,
+236,3,5,255,195,3,7,255,195,3,17,255,195,3,18,255,215,3,23,255,215,3,27,255,
+195,3,28,255,215,0,29,1,157,255,215,1,164,255,215,1,166,255,215,1,168,255,
+236,1,174,255,215,1,176,255,215,1,177,255,236,1,181,255,215,1,189,255,236,
+1,191,255,215,1,206,255,215,1,213,255,215,1,242,255,215,2,118,255,215,2,159,
+255,215,2,187,255,215,2,202,255,215,2,206,255,215,2,207,255,215,2,229,255,
+215,2,247,255,236,2,249,255,236,2,251,255,236,3,5,255,215,3,7,255,215,3,17,
+255,215,3,18,255,215,3,27,255,215,3,28,255,215,0,25,0,10,255,215,1,220,255,
+215,1,221,255,236,1,225,255,236,1,228,255,215,1,246,255,215,2,109,255,236,
+2,125,255,236,2,129,255,236,2,131,255,236,2,139,255,236,2,170,255,215,2,182,
+255,215,2,184,255,236,2,186,255,236,2,192,255,236,2,194,255,236,2,213,255,
+236,2,248,255,236,2,250,255,236,2,252,255,236,2,254,255,236,3,14,255,236,
+3,16,255,236,3,24,255,215,0,33,1,206,255,215,1,208,255,215,1,220,255,215,
+1,221,255,215,1,223,255,215,1,225,255,236,1,228,255,215,1,246,255,215,2,109,
+255,215,2,125,255,236,2,129,255,215,2,131,255,215,2,139,255,215,2,160,255,
+215,2,170,255,215,2,182,255,215,2,184,255,215,2,186,255,215,2,188,255,215,
+2,192,255,236,2,194,255,236,2,203,255,215,2,213,255,236,2,230,255,215,2,248,
+255,215,2,250,255,215,2,252,255,215,2,254,255,236,3,6,255,215,3,8,255,215,
+3,14,255,215,3,16,255,215,3,24,255,215,0,36,0,5,0,61,0,10,0,61,1,208,255,
+236,1,220,255,215,1,221,255,215,1,223,255,215,1,225,255,236,1,228,255,215,
+1,246,255,215,2,7,0,61,2,11,0,61,2,109,255,215,2,125,255,236,2,129,255,215,
+2,131,255,215,2,139,255,215,2,160,255,236,2,170,255,215,2,182,255,215,2,184,
+255,215,2,186,255,215,2,188,255,236,2,192,255,236,2,194,255,236,2,203,255,
+236,2,213,255,236,2,230,255,236,2,248,255,215,2,250,255,215,2,252,255,215,
+2,254,255,236,3,6,255,236,3,8,255,236,3,14,255,215,3,16,255,215,3,24,255,
+215,0,7,1,206,255,154,1,213,255,154,1,237,255,236,1,242,255,154,2,207,255,
+154,3,18,255,154,3,28,255,154,0,16,1,202,0,20,1,206,0,41,1,220,255,215,1,
+225,255,215,1,228,255,195,1,241,0,123,2,125,255,215,2,170,255,215,2,182,255,
+215,2,192,255,215,2,194,255,215,2,213,255,215,2,218,0,20,2,220,0,20,2,254,
+255,215,3,24,255,215,0,13,0,10,255,215,1,208,255,215,1,220,255,236,1,223,
+255,236,2,160,255,215,2,170,255,236,2,182,255,236,2,188,255,215,2,203,255,
+215,2,230,255,215,3,6,255,215,3,8,255,215,3,24,255,236,0,32,0,5,0,41,0,10,
+0,41,1,207,255,215,1,216,255,215,1,219,255,236,1,222,255,215,1,225,255,215,
+1,234,255,215,1,237,255,215,2,7,0,41,2,11,0,41,2,106,255,215,2,125,255,215,
+2,127,255,215,2,133,255,215,2,135,255,215,2,137,255,215,2,141,255,215,2,178,
+255,215,2,180,255,215,2,192,255,215,2,194,255,215,2,213,255,215,2,224,255,
+215,2,240,255,215,2,242,255,215,2,244,255,215,2,254,255,215,3,10,255,215,
+3,12,255,215,3,22,255,215,3,26,255,215,0,29,0,5,0,61,0,10,0,61,1,209,255,
+236,1,220,255,236,1,221,255,236,1,223,255,236,1,225,255,215,1,246,255,236,
+2,7,0,61,2,11,0,61,2,109,255,236,2,125,255,215,2,129,255,236,2,131,255,236,
+2,139,255,236,2,170,255,236,2,182,255,236,2,184,255,236,2,186,255,236,2,192,
+255,215,2,194,255,215,2,213,255,215,2,248,255,236,2,250,255,236,2,252,255,
+236,2,254,255,215,3,14,255,236,3,16,255,236,3,24,255,236,0,33,0,5,0,41,0,
+10,0,41,1,203,255,215,1,207,255,215,1,216,255,215,1,219,255,215,1,222,255,
+215,1,225,255,215,1,234,255,215,1,237,255,215,2,7,0,41,2,11,0,41,2,106,255,
+215,2,125,255,215,2,127,255,215,2,133,255,215,2,135,255,215,2,137,255,215,
+2,141,255,215,2,178,255,215,2,180,255,215,2,192,255,215,2,194,255,215,2,213,
+255,215,2,224,255,215,2,240,255,215,2,242,255,215,2,244,255,215,2,254,255,
+215,3,10,255,215,3,12,255,215,3,22,255,215,3,26,255,215,0,34,0,91,255,215,
+0,93,255,236,1,64,255,236,1,208,255,215,1,209,255,236,1,213,255,236,1,220,
+255,215,1,221,255,236,1,223,255,215,1,242,255,236,1,246,255,236,2,109,255,
+236,2,129,255,236,2,131,255,236,2,139,255,236,2,160,255,215,2,170,255,215,
+2,182,255,215,2,184,255,236,2,186,255,236,2,188,255,215,2,203,255,215,2,207,
+255,236,2,230,255,215,2,248,255,236,2,250,255,236,2,252,255,236,3,6,255,215,
+3,8,255,215,3,14,255,236,3,16,255,236,3,18,255,236,3,24,255,215,3,28,255,
+236,0,19,1,208,255,215,1,209,255,236,1,213,255,236,1,220,255,236,1,223,255,
+236,1,228,255,236,1,242,255,236,2,160,255,215,2,170,255,236,2,182,255,236,
+2,188,255,215,2,203,255,215,2,207,255,236,2,230,255,215,3,6,255,215,3,8,255,
+215,3,18,255,236,3,24,255,236,3,28,255,236,0,23,0,5,0,61,0,10,0,61,1,207,
+255,236,1,216,255,236,1,237,255,236,2,7,0,61,2,11,0,61,2,106,255,236,2,127,
+255,236,2,133,255,236,2,135,255,236,2,137,255,236,2,141,255,236,2,178,255,
+236,2,180,255,236,2,224,255,236,2,240,255,236,2,242,255,236,2,244,255,236,
+3,10,255,236,3,12,255,236,3,22,255,236,3,26,255,236,0,48,0,5,0,82,0,10,0,
+82,0,73,0,20,1,202,255,215,1,206,255,154,1,207,255,236,1,213,255,195,1,216,
+255,215,1,219,255,215,1,221,0,20,1,222,255,215,1,237,255,215,1,242,255,154,
+1,246,0,20,2,7,0,82,2,11,0,82,2,106,255,215,2,109,0,20,2,127,255,215,2,129,
+0,20,2,131,0,20,2,133,255,215,2,135,255,215,2,137,255,215,2,139,0,20,2,141,
+255,215,2,178,255,215,2,180,255,215,2,184,0,20,2,186,0,20,2,207,255,195,2,
+218,255,215,2,220,255,215,2,224,255,215,2,240,255,215,2,242,255,215,2,244,
+255,215,2,248,0,20,2,250,0,20,2,252,0,20,3,10,255,215,3,12,255,215,3,14,0,
+20,3,16,0,20,3,18,255,195,3,22,255,215,3,26,255,215,3,28,255,195,0,36,0,5,
+0,61,0,10,0,61,0,73,0,20,1,202,255,236,1,206,255,195,1,213,255,195,1,216,
+255,236,1,220,0,20,1,222,255,236,1,242,255,195,2,7,0,61,2,11,0,61,2,106,255,
+236,2,127,255,236,2,133,255,236,2,135,255,236,2,137,255,236,2,141,255,236,
+2,170,0,20,2,178,255,236,2,180,255,236,2,182,0,20,2,207,255,195,2,218,255,
+236,2,220,255,236,2,224,255,236,2,240,255,236,2,242,255,236,2,244,255,236,
+3,10,255,236,3,12,255,236,3,18,255,195,3,22,255,236,3,24,0,20,3,26,255,236,
+3,28,255,195,0,28,0,91,255,215,0,93,255,236,1,64,255,236,1,208,255,215,1,
+209,255,236,1,213,255,236,1,220,255,215,1,223,255,236,1,225,255,236,1,228,
+255,215,1,242,255,215,2,125,255,236,2,160,255,215,2,170,255,215,2,182,255,
+215,2,188,255,215,2,192,255,236,2,194,255,236,2,203,255,215,2,207,255,236,
+2,213,255,236,2,230,255,215,2,254,255,236,3,6,255,215,3,8,255,215,3,18,255,
+236,3,24,255,215,3,28,255,236,0,29,1,203,255,236,1,207,255,236,1,216,255,
+236,1,219,255,236,1,222,255,236,1,225,255,236,1,234,255,236,1,237,255,236,
+2,106,255,236,2,125,255,236,2,127,255,236,2,133,255,236,2,135,255,236,2,137,
+255,236,2,141,255,236,2,178,255,236,2,180,255,236,2,192,255,236,2,194,255,
+236,2,213,255,236,2,224,255,236,2,240,255,236,2,242,255,236,2,244,255,236,
+2,254,255,236,3,10,255,236,3,12,255,236,3,22,255,236,3,26,255,236,0,21,1,
+206,0,41,1,213,0,41,1,220,255,236,1,225,255,236,1,228,255,215,1,231,0,41,
+1,233,0,20,1,241,0,102,1,242,0,41,1,246,0,20,2,125,255,236,2,170,255,236,
+2,182,255,236,2,192,255,236,2,194,255,236,2,207,0,41,2,213,255,236,2,254,
+255,236,3,18,0,41,3,24,255,236,3,28,0,41,0,22,1,206,0,61,1,213,0,41,1,220,
+255,236,1,225,255,236,1,228,255,236,1,231,0,20,1,234,255,236,1,237,255,236,
+1,241,0,102,1,242,0,41,1,246,0,20,2,125,255,236,2,170,255,236,2,182,255,236,
+2,192,255,236,2,194,255,236,2,207,0,41,2,213,255,236,2,254,255,236,3,18,0,
+41,3,24,255,236,3,28,0,41,0,25,1,220,255,154,1,221,255,215,1,223,255,236,
+1,225,255,215,1,228,255,113,1,246,255,195,2,109,255,215,2,125,255,215,2,129,
+255,215,2,131,255,215,2,139,255,215,2,170,255,154,2,182,255,154,2,184,255,
+215,2,186,255,215,2,192,255,215,2,194,255,215,2,213,255,215,2,248,255,215,
+2,250,255,215,2,252,255,215,2,254,255,215,3,14,255,215,3,16,255,215,3,24,
+255,154,0,28,0,5,0,61,0,10,0,61,1,220,255,154,1,221,255,215,1,223,255,236,
+1,225,255,215,1,228,255,113,2,7,0,61,2,11,0,61,2,109,255,215,2,125,255,215,
+2,129,255,215,2,131,255,215,2,139,255,215,2,170,255,154,2,182,255,154,2,184,
+255,215,2,186,255,215,2,192,255,215,2,194,255,215,2,213,255,215,2,248,255,
+215,2,250,255,215,2,252,255,215,2,254,255,215,3,14,255,215,3,16,255,215,3,
+24,255,154,0,17,1,206,255,215,1,208,255,215,1,209,255,236,1,213,255,236,1,
+223,255,236,1,228,255,215,1,242,255,236,1,246,255,215,2,160,255,215,2,188,
+255,215,2,203,255,215,2,207,255,236,2,230,255,215,3,6,255,215,3,8,255,215,
+3,18,255,236,3,28,255,236,0,16,1,206,255,215,1,208,255,215,1,209,255,236,
+1,213,255,236,1,223,255,236,1,228,255,215,1,246,255,236,2,160,255,215,2,188,
+255,215,2,203,255,215,2,207,255,236,2,230,255,215,3,6,255,215,3,8,255,215,
+3,18,255,236,3,28,255,236,0,3,0,5,255,152,0,10,255,215,1,223,255,236,0,28,
+1,206,255,154,1,207,255,215,1,213,255,154,1,216,255,215,1,219,255,236,1,222,
+255,215,1,234,255,215,1,237,255,236,1,242,255,154,2,106,255,215,2,127,255,
+215,2,133,255,215,2,135,255,215,2,137,255,215,2,141,255,215,2,178,255,215,
+2,180,255,215,2,207,255,154,2,224,255,215,2,240,255,215,2,242,255,215,2,244,
+255,215,3,10,255,215,3,12,255,215,3,18,255,154,3,22,255,215,3,26,255,215,
+3,28,255,154,0,2,1,235,0,61,1,244,0,61,0,33,1,208,255,215,1,220,255,154,1,
+221,255,195,1,222,255,236,1,223,255,236,1,225,255,215,1,228,255,154,1,246,
+255,215,2,109,255,195,2,125,255,215,2,129,255,195,2,131,255,195,2,139,255,
+195,2,160,255,215,2,170,255,154,2,182,255,154,2,184,255,195,2,186,255,195,
+2,188,255,215,2,192,255,215,2,194,255,215,2,203,255,215,2,213,255,215,2,230,
+255,215,2,248,255,195,2,250,255,195,2,252,255,195,2,254,255,215,3,6,255,215,
+3,8,255,215,3,14,255,195,3,16,255,195,3,24,255,154,0,31,1,208,255,215,1,220,
+255,154,1,221,255,195,1,223,255,236,1,225,255,215,1,228,255,154,2,109,255,
+195,2,125,255,215,2,129,255,195,2,131,255,195,2,139,255,195,2,160,255,215,
+2,170,255,154,2,182,255,154,2,184,255,195,2,186,255,195,2,188,255,215,2,192,
+255,215,2,194,255,215,2,203,255,215,2,213,255,215,2,230,255,215,2,248,255,
+195,2,250,255,195,2,252,255,195,2,254,255,215,3,6,255,215,3,8,255,215,3,14,
+255,195,3,16,255,195,3,24,255,154,0,1,1,246,255,215,0,28,0,5,0,41,0,10,0,
+41,1,203,255,236,1,207,255,215,1,216,255,215,1,219,255,236,1,222,255,215,
+1,234,255,215,1,237,255,215,1,246,255,236,2,7,0,41,2,11,0,41,2,106,255,215,
+2,127,255,215,2,133,255,215,2,135,255,215,2,137,255,215,2,141,255,215,2,178,
+255,215,2,180,255,215,2,224,255,215,2,240,255,215,2,242,255,215,2,244,255,
+215,3,10,255,215,3,12,255,215,3,22,255,215,3,26,255,215,0,29,1,202,255,215,
+1,213,255,195,1,216,255,236,1,220,0,20,1,242,255,215,2,106,255,236,2,127,
+255,236,2,133,255,236,2,135,255,236,2,137,255,236,2,141,255,236,2,170,0,20,
+2,178,255,236,2,180,255,236,2,182,0,20,2,207,255,195,2,218,255,215,2,220,
+255,215,2,224,255,236,2,240,255,236,2,242,255,236,2,244,255,236,3,10,255,
+236,3,12,255,236,3,18,255,195,3,22,255,236,3,24,0,20,3,26,255,236,3,28,255,
+195,0,219,0,5,0,82,0,10,0,82,0,16,255,92,0,38,255,236,0,42,255,236,0,50,255,
+236,0,52,255,236,0,55,255,133,0,56,255,236,0,57,255,174,0,58,255,195,0,60,
+255,154,0,137,255,236,0,148,255,236,0,149,255,236,0,150,255,236,0,151,255,
+236,0,152,255,236,0,154,255,236,0,155,255,236,0,156,255,236,0,157,255,236,
+0,158,255,236,0,159,255,154,0,200,255,236,0,206,255,236,0,222,255,236,0,224,
+255,236,0,226,255,236,0,228,255,236,1,14,255,236,1,18,255,236,1,20,255,236,
+1,36,255,133,1,38,255,133,1,44,255,236,1,48,255,236,1,50,255,236,1,52,255,
+236,1,54,255,195,1,56,255,154,1,58,255,154,1,159,255,236,1,164,255,154,1,
+170,255,133,1,174,255,133,1,181,255,133,1,184,255,215,1,187,255,236,1,188,
+255,133,1,190,255,195,1,202,255,133,1,204,255,195,1,205,255,195,1,206,255,
+92,1,207,255,133,1,208,255,195,1,209,255,195,1,210,255,195,1,211,255,195,
+1,212,255,195,1,213,255,92,1,214,255,195,1,215,255,195,1,216,255,133,1,217,
+255,195,1,218,255,195,1,219,255,133,1,220,255,195,1,221,255,195,1,222,255,
+133,1,223,255,195,1,224,255,195,1,225,255,195,1,226,255,195,1,227,255,195,
+1,228,255,195,1,229,255,195,1,230,255,195,1,231,255,195,1,232,255,195,1,233,
+255,154,1,234,255,133,1,236,255,195,1,237,255,133,1,238,255,174,1,240,0,61,
+1,242,255,92,1,243,255,195,1,245,255,195,1,247,255,195,1,249,255,195,1,250,
+255,195,1,252,255,195,1,254,255,195,2,0,255,154,2,7,0,82,2,11,0,82,2,95,255,
+236,2,97,255,236,2,106,255,133,2,107,255,195,2,108,255,215,2,109,255,195,
+2,114,255,133,2,125,255,195,2,126,255,215,2,127,255,133,2,129,255,195,2,131,
+255,195,2,132,255,215,2,133,255,133,2,134,255,215,2,135,255,133,2,136,255,
+215,2,137,255,133,2,138,255,215,2,139,255,195,2,140,255,215,2,141,255,133,
+2,150,255,195,2,154,255,195,2,160,255,195,2,164,255,195,2,166,255,195,2,169,
+255,133,2,170,255,195,2,172,255,195,2,174,255,195,2,176,255,195,2,177,255,
+215,2,178,255,133,2,179,255,215,2,180,255,133,2,181,255,133,2,182,255,195,
+2,183,255,133,2,184,255,195,2,185,255,133,2,186,255,195,2,188,255,195,2,189,
+255,133,2,192,255,195,2,194,255,195,2,196,255,195,2,197,255,174,2,198,255,
+113,2,199,255,174,2,203,255,195,2,206,255,133,2,207,255,92,2,209,255,195,
+2,211,255,195,2,213,255,195,2,215,255,195,2,217,255,133,2,218,255,133,2,219,
+255,133,2,220,255,133,2,221,255,133,2,224,255,133,2,225,255,215,2,227,255,
+215,2,230,255,195,2,236,255,195,2,238,255,195,2,239,255,215,2,240,255,133,
+2,241,255,215,2,242,255,133,2,243,255,215,2,244,255,133,2,248,255,195,2,250,
+255,195,2,252,255,195,2,254,255,195,3,0,255,195,3,6,255,195,3,8,255,195,3,
+9,255,92,3,10,255,133,3,11,255,92,3,12,255,133,3,14,255,195,3,16,255,195,
+3,17,255,133,3,18,255,92,3,20,255,195,3,21,255,215,3,22,255,133,3,23,255,
+133,3,24,255,195,3,25,255,215,3,26,255,133,3,27,255,133,3,28,255,92,3,73,
+255,236,3,75,255,236,3,77,255,236,3,79,255,236,3,81,255,236,3,83,255,236,
+3,85,255,236,3,87,255,236,3,89,255,236,3,91,255,236,3,93,255,236,3,95,255,
+236,3,97,255,236,3,99,255,236,3,101,255,236,3,103,255,236,3,105,255,236,3,
+107,255,236,3,109,255,236,3,111,255,154,3,113,255,154,3,115,255,154,3,131,
+255,133,0,3,0,55,255,154,1,113,255,154,1,114,255,195,0,196,0,36,255,174,0,
+44,0,41,0,55,0,82,0,57,0,82,0,58,0,102,0,59,0,41,0,60,0,82,0,61,0,41,0,70,
+255,195,0,71,255,195,0,72,255,195,0,74,255,215,0,82,255,195,0,84,255,195,
+0,87,0,41,0,89,0,41,0,90,0,20,0,130,255,174,0,131,255,174,0,132,255,174,0,
+133,255,174,0,134,255,174,0,135,255,174,0,136,255,92,0,142,0,41,0,143,0,41,
+0,144,0,41,0,145,0,41,0,159,0,82,0,168,255,195,0,169,255,195,0,170,255,195,
+0,171,255,195,0,172,255,195,0,173,255,195,0,180,255,195,0,181,255,195,0,182,
+255,195,0,183,255,195,0,184,255,195,0,186,255,195,0,194,255,174,0,196,255,
+174,0,198,255,174,0,201,255,195,0,203,255,195,0,205,255,195,0,207,255,195,
+0,213,255,195,0,215,255,195,0,217,255,195,0,219,255,195,0,221,255,195,0,236,
+0,41,0,240,0,41,0,242,0,41,1,15,255,195,1,17,255,195,1,19,255,195,1,21,255,
+195,1,36,0,82,1,38,0,82,1,54,0,102,1,55,0,20,1,56,0,82,1,58,0,82,1,59,0,41,
+1,61,0,41,1,63,0,41,1,67,255,174,1,95,255,174,1,105,255,174,1,113,0,82,1,
+121,255,195,1,126,255,195,1,130,255,195,1,138,0,41,1,140,255,195,1,142,255,
+195,1,144,255,195,1,145,0,41,1,147,255,195,1,148,0,41,1,150,255,195,1,153,
+255,195,1,155,255,195,1,157,0,82,1,164,255,154,1,166,0,82,1,168,0,61,1,170,
+255,174,1,174,255,133,1,176,0,61,1,177,0,20,1,181,255,133,1,188,0,82,1,189,
+0,61,1,191,0,41,1,196,0,82,1,207,255,195,1,216,255,195,1,219,255,195,1,220,
+0,41,1,222,255,195,1,234,255,195,1,237,255,195,1,250,0,102,1,251,0,20,1,252,
+0,102,1,253,0,20,1,254,0,102,1,255,0,20,2,0,0,82,2,40,255,174,2,88,255,174,
+2,96,255,195,2,106,255,195,2,114,255,174,2,118,0,61,2,127,255,195,2,133,255,
+195,2,135,255,195,2,137,255,195,2,141,255,195,2,159,0,61,2,169,0,82,2,170,
+0,41,2,178,255,195,2,180,255,195,2,181,0,82,2,182,0,41,2,183,0,82,2,185,0,
+82,2,187,0,61,2,189,0,82,2,202,0,61,2,206,255,133,2,217,255,174,2,219,255,
+174,2,221,255,174,2,224,255,195,2,229,0,61,2,240,255,195,2,242,255,195,2,
+244,255,195,2,247,0,61,2,249,0,61,2,251,0,61,3,5,0,61,3,7,0,61,3,10,255,195,
+3,12,255,195,3,17,255,133,3,22,255,195,3,23,0,82,3,24,0,41,3,26,255,195,3,
+27,255,133,3,29,255,174,3,31,255,174,3,33,255,174,3,35,255,174,3,37,255,174,
+3,39,255,174,3,41,255,174,3,43,255,174,3,45,255,174,3,47,255,174,3,49,255,
+174,3,51,255,174,3,54,255,195,3,56,255,195,3,58,255,195,3,60,255,195,3,62,
+255,195,3,64,255,195,3,66,255,195,3,68,255,195,3,69,0,41,3,71,0,41,3,74,255,
+195,3,76,255,195,3,78,255,195,3,80,255,195,3,82,255,195,3,84,255,195,3,86,
+255,195,3,88,255,195,3,90,255,195,3,92,255,195,3,94,255,195,3,96,255,195,
+3,111,0,82,3,113,0,82,3,115,0,82,3,131,0,82,0,16,0,69,0,61,0,73,0,102,0,75,
+0,61,0,76,0,61,0,77,0,61,0,78,0,61,0,79,0,61,0,87,0,102,0,89,0,102,0,90,0,
+102,0,91,0,41,0,92,0,102,0,93,0,41,3,112,0,102,3,114,0,102,3,116,0,102,0,
+16,0,69,0,61,0,73,0,102,0,75,0,61,0,76,0,61,0,77,0,61,0,78,0,61,0,79,0,61,
+0,87,0,102,0,89,0,102,0,90,0,82,0,91,0,41,0,92,0,102,0,93,0,20,3,112,0,102,
+3,114,0,102,3,116,0,102,0,2,3,9,255,133,3,11,255,133,0,2,0,151,0,5,0,5,0,
+0,0,10,0,11,0,1,0,15,0,17,0,3,0,36,0,39,0,6,0,41,0,41,0,10,0,44,0,44,0,11,
+0,46,0,47,0,12,0,50,0,53,0,14,0,55,0,62,0,18,0,68,0,70,0,26,0,72,0,75,0,29,
+0,78,0,78,0,33,0,80,0,82,0,34,0,85,0,87,0,37,0,89,0,94,0,40,0,109,0,109,0,
+46,0,125,0,125,0,47,0,130,0,135,0,48,0,137,0,146,0,54,0,148,0,152,0,64,0,
+154,0,159,0,69,0,162,0,173,0,75,0,179,0,184,0,87,0,186,0,191,0,93,0,193,0,
+201,0,99,0,203,0,203,0,108,0,205,0,207,0,109,0,209,0,209,0,112,0,213,0,213,
+0,113,0,215,0,215,0,114,0,217,0,219,0,115,0,221,0,221,0,118,0,236,0,236,0,
+119,0,240,0,240,0,120,0,242,0,242,0,121,0,248,0,248,0,122,0,250,0,251,0,123,
+0,253,0,253,0,125,0,255,1,1,0,126,1,3,1,3,0,129,1,6,1,6,0,130,1,8,1,8,0,131,
+1,10,1,10,0,132,1,14,1,15,0,133,1,17,1,19,0,135,1,21,1,21,0,138,1,29,1,29,
+0,139,1,31,1,31,0,140,1,33,1,36,0,141,1,38,1,39,0,145,1,44,1,44,0,147,1,48,
+1,48,0,148,1,50,1,50,0,149,1,52,1,52,0,150,1,54,1,59,0,151,1,61,1,61,0,157,
+1,63,1,64,0,158,1,67,1,68,0,160,1,74,1,74,0,162,1,86,1,86,0,163,1,90,1,98,
+0,164,1,100,1,100,0,173,1,102,1,105,0,174,1,108,1,109,0,178,1,111,1,124,0,
+180,1,126,1,132,0,194,1,134,1,136,0,201,1,138,1,142,0,204,1,144,1,145,0,209,
+1,147,1,151,0,211,1,153,1,153,0,216,1,155,1,162,0,217,1,164,1,168,0,225,1,
+170,1,174,0,230,1,176,1,177,0,235,1,180,1,180,0,237,1,184,1,184,0,238,1,186,
+1,192,0,239,1,195,1,196,0,246,1,198,1,200,0,248,1,202,1,209,0,251,1,212,1,
+212,1,3,1,216,1,216,1,4,1,218,1,224,1,5,1,227,1,234,1,12,1,236,1,238,1,20,
+1,240,1,240,1,23,1,242,1,246,1,24,1,248,2,3,1,29,2,6,2,6,1,41,2,10,2,10,1,
+42,2,40,2,40,1,43,2,88,2,88,1,44,2,96,2,96,1,45,2,98,2,98,1,46,2,106,2,106,
+1,47,2,108,2,114,1,48,2,116,2,116,1,55,2,118,2,124,1,56,2,126,2,140,1,63,
+2,149,2,157,1,78,2,159,2,160,1,87,2,162,2,175,1,89,2,177,2,192,1,103,2,195,
+2,195,1,119,2,197,2,197,1,120,2,199,2,199,1,121,2,201,2,204,1,122,2,206,2,
+207,1,126,2,210,2,211,1,128,2,214,2,217,1,130,2,219,2,219,1,134,2,222,2,222,
+1,135,2,224,2,233,1,136,2,239,2,252,1,146,2,255,3,0,1,160,3,3,3,8,1,162,3,
+11,3,29,1,168,3,31,3,31,1,187,3,33,3,33,1,188,3,35,3,35,1,189,3,37,3,37,1,
+190,3,39,3,39,1,191,3,41,3,41,1,192,3,43,3,43,1,193,3,45,3,45,1,194,3,47,
+3,47,1,195,3,49,3,49,1,196,3,51,3,51,1,197,3,54,3,54,1,198,3,56,3,56,1,199,
+3,58,3,58,1,200,3,60,3,60,1,201,3,62,3,62,1,202,3,64,3,64,1,203,3,66,3,66,
+1,204,3,68,3,69,1,205,3,71,3,71,1,207,3,73,3,86,1,208,3,88,3,88,1,222,3,90,
+3,90,1,223,3,92,3,92,1,224,3,94,3,94,1,225,3,96,3,97,1,226,3,99,3,99,1,228,
+3,102,3,102,1,229,3,104,3,104,1,230,3,106,3,106,1,231,3,108,3,108,1,232,3,
+110,3,116,1,233,3,131,3,131,1,240,0,0,0,1,0,0,0,10,0,28,0,30,0,1,108,97,116,
+110,0,8,0,4,0,0,0,0,255,255,0,0,0,0,0,0,};
+#endif
+
+#ifdef HAVE_INCBIN
+extern const unsigned char pdf_font_DroidSansMono[119380];
+asm(".globl pdf_font_DroidSansMono");
+asm(".balign 8");
+asm("pdf_font_DroidSansMono:");
+asm(".incbin \"fonts/droid/DroidSansMono.ttf\"");
+#else
+static const unsigned char pdf_font_DroidSansMono[119380] = {
+0,1,0,0,0,14,0,128,0,3,0,96,79,83,47,50,160,203,149,192,0,0,1,104,0,0,0,96,
+99,109,97,112,87,14,51,94,0,0,8,212,0,0,15,210,99,118,116,32,68,157,77,114,
+0,0,34,48,0,0,2,16,102,112,103,109,115,211,35,176,0,0,24,168,0,0,7,5,103,
+97,115,112,0,4,0,7,0,1,210,72,0,0,0,12,103,108,121,102,148,153,189,145,0,
+0,43,76,0,1,130,216,104,101,97,100,238,100,162,81,0,0,0,236,0,0,0,54,104,
+104,101,97,11,91,2,150,0,0,1,36,0,0,0,36,104,109,116,120,249,87,244,193,0,
+0,1,200,0,0,7,10,108,111,99,97,182,175,86,49,0,0,36,64,0,0,7,10,109,97,120,
+112,5,237,2,119,0,0,1,72,0,0,0,32,110,97,109,101,123,244,226,40,0,1,174,36,
+0,0,6,204,112,111,115,116,103,140,78,81,0,1,180,240,0,0,29,85,112,114,101,
+112,65,189,218,130,0,0,31,176,0,0,2,126,0,1,0,0,0,1,0,0,208,28,78,20,95,15,
+60,245,0,11,8,0,0,0,0,0,193,199,233,84,0,0,0,0,201,146,109,183,254,200,253,
+213,5,35,8,115,0,0,0,9,0,2,0,0,0,0,0,0,0,1,0,0,7,109,254,29,0,0,4,205,254,
+200,255,170,5,35,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,3,132,0,144,
+0,18,0,82,0,5,0,2,0,16,0,47,0,90,0,0,1,228,1,99,0,3,0,1,0,3,4,205,1,144,0,
+5,0,8,5,154,5,51,0,0,1,30,5,154,5,51,0,0,3,208,0,102,1,242,0,0,2,11,6,9,3,
+8,4,2,2,4,224,0,2,239,64,0,32,91,0,0,0,40,0,0,0,0,49,65,83,67,0,64,0,32,255,
+253,6,31,254,20,0,132,7,109,1,227,32,0,1,159,0,0,0,0,4,74,5,182,0,0,0,32,
+0,0,4,205,0,193,0,0,0,0,0,0,1,231,1,29,0,45,0,182,0,0,0,61,1,240,1,39,1,41,
+0,133,0,152,1,184,1,29,1,207,0,211,0,147,0,225,0,158,0,131,0,61,0,172,0,154,
+0,143,0,156,0,154,1,231,1,154,0,152,0,152,0,152,0,168,0,31,0,33,0,135,0,129,
+0,135,0,217,0,244,0,117,0,135,0,225,0,137,0,211,0,233,0,113,0,135,0,84,0,
+176,0,84,0,186,0,141,0,102,0,125,0,33,0,2,0,53,0,33,0,102,1,156,0,211,1,33,
+0,111,255,240,1,162,0,135,0,158,0,172,0,137,0,133,0,156,0,102,0,160,0,197,
+0,135,0,215,0,188,0,92,0,160,0,115,0,158,0,137,1,8,0,203,0,139,0,160,0,82,
+255,252,0,96,0,82,0,182,0,225,2,27,0,227,0,152,0,0,1,231,0,172,0,119,0,174,
+0,78,2,27,0,244,1,74,0,6,1,20,0,197,0,152,1,29,0,6,255,236,1,43,0,152,1,92,
+1,86,1,162,0,180,0,66,1,231,1,172,1,111,1,25,0,197,0,22,0,3,0,21,0,168,0,
+33,0,33,0,33,0,33,0,33,0,33,0,0,0,129,0,217,0,217,0,217,0,217,0,225,0,225,
+0,225,0,225,0,0,0,135,0,84,0,84,0,84,0,84,0,84,0,190,0,80,0,125,0,125,0,125,
+0,125,0,33,0,176,0,164,0,135,0,135,0,135,0,135,0,135,0,135,0,45,0,172,0,133,
+0,133,0,133,0,133,0,197,0,197,0,197,0,197,0,135,0,160,0,115,0,115,0,115,0,
+115,0,115,0,152,0,115,0,160,0,160,0,160,0,160,0,82,0,158,0,82,0,33,0,135,
+0,33,0,135,0,33,0,135,0,129,0,172,0,129,0,172,0,129,0,172,0,129,0,172,0,135,
+0,79,0,0,0,137,0,217,0,133,0,217,0,133,0,217,0,133,0,217,0,133,0,217,0,133,
+0,117,0,102,0,117,0,102,0,117,0,102,0,117,0,102,0,135,0,160,0,0,0,4,0,225,
+0,197,0,225,0,197,0,225,0,197,0,225,0,197,0,225,0,197,0,156,0,188,0,137,0,
+135,0,211,0,215,0,215,0,233,0,188,0,233,0,188,0,233,0,188,0,233,0,188,0,72,
+0,188,0,135,0,160,0,135,0,160,0,135,0,160,255,240,0,135,0,160,0,84,0,115,
+0,84,0,115,0,84,0,115,0,20,0,57,0,186,1,8,0,186,0,187,0,186,1,8,0,141,0,203,
+0,141,0,203,0,141,0,203,0,141,0,203,0,102,0,139,0,102,0,139,0,102,0,139,0,
+125,0,160,0,125,0,160,0,125,0,160,0,125,0,160,0,125,0,160,0,125,0,160,0,2,
+255,252,0,33,0,82,0,33,0,102,0,182,0,102,0,182,0,102,0,182,1,100,0,215,0,
+33,0,135,0,0,0,45,0,80,0,115,0,141,0,203,1,27,1,27,1,70,1,57,1,252,1,131,
+1,158,0,254,0,246,1,223,1,43,0,33,1,231,255,142,255,101,255,163,255,124,255,
+19,255,122,0,241,0,33,0,135,0,246,0,68,0,217,0,102,0,135,0,84,0,225,0,211,
+0,33,0,113,0,135,0,111,0,84,0,135,0,176,0,131,0,102,0,33,0,27,0,53,0,57,0,
+74,0,225,0,33,0,121,0,201,0,160,1,172,0,160,0,121,0,158,0,82,0,135,0,201,
+0,162,0,160,0,147,1,172,0,215,0,61,0,160,0,61,0,172,0,115,0,14,0,158,0,172,
+0,129,0,106,0,160,0,74,0,43,0,80,0,90,1,3,0,160,0,115,0,160,0,90,0,217,0,
+23,0,246,0,129,0,141,0,225,0,225,0,137,0,0,0,66,0,23,0,211,0,27,0,135,0,33,
+0,135,0,135,0,246,0,6,0,217,0,0,0,139,0,137,0,137,0,211,0,4,0,113,0,135,0,
+84,0,135,0,176,0,129,0,102,0,27,0,27,0,53,0,135,0,135,0,121,0,61,0,27,0,96,
+0,176,0,68,0,98,0,57,0,135,0,143,0,176,1,35,0,33,0,133,0,0,0,201,0,160,0,
+160,0,215,0,31,0,115,0,160,0,115,0,160,0,158,0,172,0,121,0,82,0,74,0,96,0,
+152,0,152,0,125,0,109,0,43,0,113,0,217,0,184,0,123,0,115,0,133,0,4,1,35,0,
+172,0,203,0,197,0,197,0,135,0,0,0,106,0,4,0,215,0,82,0,160,0,246,1,35,0,2,
+255,252,0,2,255,252,0,2,255,252,0,33,0,82,0,184,255,250,255,250,255,236,1,
+190,1,190,1,201,1,190,0,233,0,233,0,244,0,240,0,229,1,123,0,78,0,4,1,240,
+1,29,1,145,1,145,0,255,0,170,1,61,0,129,0,119,0,82,0,96,0,8,0,227,0,25,0,
+0,0,74,0,82,0,18,0,11,0,24,0,28,0,121,0,74,0,156,0,74,0,152,0,23,0,70,0,236,
+0,152,0,152,0,152,0,152,0,125,0,49,0,49,0,231,0,135,1,238,1,227,1,227,1,57,
+1,37,1,80,1,57,1,111,1,49,1,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,55,0,4,0,135,1,190,0,10,0,31,0,18,0,113,0,92,0,33,0,135,254,200,
+1,131,1,45,0,66,0,66,0,84,0,115,0,125,0,160,1,162,1,162,0,254,1,172,1,252,
+0,217,0,137,0,133,0,160,0,82,255,252,0,20,0,20,0,98,0,160,0,0,0,61,0,98,0,
+123,0,0,0,10,0,92,0,123,0,117,0,143,0,57,0,80,0,84,0,115,0,63,0,82,0,63,0,
+82,0,70,0,80,0,84,0,115,0,82,0,88,0,82,255,252,0,129,0,172,0,94,0,242,0,242,
+1,225,1,225,0,41,0,41,0,137,0,178,0,47,0,61,0,176,0,158,0,147,0,135,0,160,
+0,215,0,0,0,0,0,139,0,201,0,211,0,215,0,211,0,215,0,59,0,59,0,23,0,43,0,135,
+0,160,0,135,0,160,0,106,0,127,0,84,0,115,0,129,0,172,0,102,0,121,0,33,0,82,
+0,33,0,82,0,53,0,96,0,23,0,20,0,135,0,152,0,135,0,152,0,135,0,168,255,248,
+255,213,255,248,255,213,0,225,0,0,0,0,0,135,0,215,0,4,0,31,0,135,0,160,0,
+135,0,160,0,135,0,152,0,113,0,115,0,225,0,33,0,135,0,33,0,135,0,0,0,45,0,
+217,0,133,0,84,0,133,0,84,0,133,0,0,0,0,0,139,0,201,0,158,0,170,0,137,0,160,
+0,137,0,160,0,84,0,115,0,84,0,115,0,84,0,115,0,68,0,184,0,27,0,82,0,27,0,
+82,0,27,0,82,0,135,0,152,1,43,1,35,0,96,0,113,0,147,0,135,0,53,0,96,0,53,
+0,96,0,137,0,137,0,49,0,49,0,35,0,43,0,39,0,80,0,0,0,0,0,121,0,123,0,117,
+0,113,0,20,0,41,0,166,0,201,0,4,0,31,0,33,0,135,0,33,0,135,0,33,0,135,0,33,
+0,85,0,33,0,135,0,33,0,135,0,33,0,135,0,33,0,135,0,33,0,135,0,33,0,135,0,
+33,0,135,0,33,0,135,0,217,0,133,0,217,0,133,0,217,0,133,0,217,0,133,0,89,
+0,76,0,217,0,133,0,217,0,133,0,217,0,133,0,225,0,197,0,225,0,197,0,84,0,115,
+0,84,0,115,0,84,0,115,0,74,0,74,0,84,0,115,0,84,0,115,0,84,0,115,0,84,0,115,
+0,84,0,115,0,84,0,115,0,84,0,115,0,84,0,115,0,125,0,160,0,125,0,160,0,125,
+0,160,0,125,0,160,0,125,0,160,0,125,0,160,0,125,0,160,0,33,0,82,0,33,0,82,
+0,33,0,82,0,137,0,205,0,188,0,188,0,221,1,35,1,57,1,57,1,57,1,35,1,199,1,
+178,1,178,0,102,0,139,0,0,0,0,0,3,0,0,0,3,0,0,0,28,0,1,0,0,0,0,6,242,0,3,
+0,1,0,0,8,252,0,4,6,214,0,0,0,134,0,128,0,6,0,6,0,126,1,127,1,146,1,161,1,
+176,1,240,1,255,2,27,2,188,2,199,2,201,2,221,2,243,3,1,3,3,3,9,3,15,3,35,
+3,138,3,140,3,161,3,206,3,210,3,214,4,134,5,19,30,1,30,63,30,133,30,249,31,
+77,32,11,32,21,32,30,32,34,32,38,32,48,32,51,32,58,32,60,32,68,32,127,32,
+164,32,167,32,172,33,5,33,19,33,22,33,34,33,38,33,46,33,94,34,2,34,6,34,15,
+34,18,34,26,34,30,34,43,34,72,34,96,34,101,37,202,251,4,254,255,255,253,255,
+255,0,0,0,32,0,160,1,146,1,160,1,175,1,240,1,250,2,24,2,188,2,198,2,201,2,
+216,2,243,3,0,3,3,3,9,3,15,3,35,3,132,3,140,3,142,3,163,3,209,3,214,4,0,4,
+136,30,0,30,62,30,128,30,160,31,77,32,0,32,19,32,23,32,32,32,38,32,48,32,
+50,32,57,32,60,32,68,32,127,32,163,32,167,32,171,33,5,33,19,33,22,33,34,33,
+38,33,46,33,91,34,2,34,6,34,15,34,17,34,26,34,30,34,43,34,72,34,96,34,100,
+37,202,251,1,254,255,255,252,255,255,255,227,0,0,255,176,0,191,0,178,0,97,
+255,73,0,0,255,150,254,133,254,132,254,118,255,104,255,99,255,98,255,93,0,
+103,255,68,253,208,253,207,253,206,253,205,254,130,254,127,0,0,0,0,228,88,
+228,24,227,122,0,0,227,13,226,66,225,239,225,238,225,237,225,234,225,225,
+225,224,225,219,225,218,225,211,225,153,225,118,225,116,0,0,225,24,225,11,
+225,9,224,254,224,251,224,244,224,200,224,37,224,34,224,26,224,25,224,18,
+224,15,224,3,223,231,223,208,223,205,220,105,0,0,3,79,2,83,0,1,0,0,0,132,
+0,0,0,0,0,0,0,0,0,0,2,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,30,3,42,0,0,0,0,0,0,4,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,4,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,174,0,0,0,0,0,0,0,98,0,99,0,100,0,101,0,102,
+0,103,0,104,0,105,0,106,0,107,0,108,0,109,0,110,0,111,0,112,0,113,0,114,0,
+115,0,116,0,117,0,118,0,119,0,120,0,121,0,122,0,123,0,124,0,125,0,126,0,127,
+0,128,0,129,0,130,0,131,0,132,0,133,0,134,0,135,0,136,0,137,0,138,0,139,0,
+140,0,141,0,142,0,143,0,144,0,145,0,146,0,147,0,148,0,149,0,150,0,151,0,152,
+0,153,0,154,0,155,0,156,0,157,0,158,0,159,0,160,0,161,0,162,0,163,0,164,0,
+165,0,166,0,167,0,168,0,169,0,170,0,171,0,172,0,173,0,174,0,175,0,176,0,177,
+0,178,0,179,0,180,0,181,0,182,0,183,0,184,0,185,0,186,0,187,0,188,0,189,0,
+190,0,191,0,192,0,193,0,194,0,195,0,196,0,197,0,198,0,199,0,200,0,201,0,202,
+0,203,0,204,0,205,0,206,0,207,0,208,0,209,0,210,0,211,0,212,0,213,0,214,0,
+215,0,216,0,217,0,218,0,219,0,220,0,221,0,222,0,223,0,224,0,225,0,226,0,227,
+0,228,0,229,0,230,0,231,0,232,0,233,0,234,0,235,0,236,0,237,0,238,0,239,0,
+240,0,241,0,242,0,243,0,244,0,245,0,246,0,247,0,248,0,249,0,250,0,251,0,252,
+0,253,0,254,0,255,1,0,1,1,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,
+1,13,1,14,1,15,1,16,1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,
+1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,3,130,3,131,1,38,1,39,1,40,1,41,1,
+42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,
+1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,73,1,74,1,36,1,37,2,104,1,
+156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,2,105,
+1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,
+180,1,181,1,182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,
+1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,
+205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,
+1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,
+230,1,231,1,232,1,233,2,106,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,
+1,242,1,243,1,244,1,245,2,107,1,246,1,247,2,108,2,109,2,110,2,111,2,112,2,
+113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,
+2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,
+138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,
+2,151,2,152,2,153,2,154,1,248,1,249,2,155,2,156,2,157,2,158,2,159,2,160,2,
+161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,
+2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,
+186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,
+2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,
+211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,
+2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,
+236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,
+2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,
+3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,
+3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,
+3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,
+3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,
+3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,
+3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,
+3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,
+2,0,2,1,3,111,3,112,3,113,3,114,3,115,3,116,3,117,2,28,2,52,2,53,2,93,2,94,
+0,6,2,10,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,
+0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,
+0,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,
+0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,
+0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,
+0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,
+0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,
+0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,
+0,94,0,95,0,96,0,97,0,0,0,134,0,135,0,137,0,139,0,147,0,152,0,158,0,163,0,
+162,0,164,0,166,0,165,0,167,0,169,0,171,0,170,0,172,0,173,0,175,0,174,0,176,
+0,177,0,179,0,181,0,180,0,182,0,184,0,183,0,188,0,187,0,189,0,190,2,13,0,
+114,0,100,0,101,0,105,2,15,0,120,0,161,0,112,0,107,2,32,0,118,0,106,2,48,
+0,136,0,154,2,45,0,115,2,49,2,50,0,103,0,119,2,39,2,42,2,41,1,141,2,46,0,
+108,0,124,2,33,0,168,0,186,0,129,0,99,0,110,2,44,1,66,2,47,2,40,0,109,0,125,
+2,16,0,3,0,130,0,133,0,151,1,20,1,21,2,2,2,3,2,10,2,11,2,6,2,7,0,185,2,51,
+0,193,1,58,2,23,0,102,2,20,2,21,2,52,2,53,2,14,0,121,2,8,2,12,2,17,0,132,
+0,140,0,131,0,141,0,138,0,143,0,144,0,145,0,142,0,149,0,150,0,0,0,148,0,156,
+0,157,0,155,0,243,1,75,1,82,0,113,1,78,1,79,1,80,0,122,1,83,1,81,1,76,0,4,
+6,214,0,0,0,134,0,128,0,6,0,6,0,126,1,127,1,146,1,161,1,176,1,240,1,255,2,
+27,2,188,2,199,2,201,2,221,2,243,3,1,3,3,3,9,3,15,3,35,3,138,3,140,3,161,
+3,206,3,210,3,214,4,134,5,19,30,1,30,63,30,133,30,249,31,77,32,11,32,21,32,
+30,32,34,32,38,32,48,32,51,32,58,32,60,32,68,32,127,32,164,32,167,32,172,
+33,5,33,19,33,22,33,34,33,38,33,46,33,94,34,2,34,6,34,15,34,18,34,26,34,30,
+34,43,34,72,34,96,34,101,37,202,251,4,254,255,255,253,255,255,0,0,0,32,0,
+160,1,146,1,160,1,175,1,240,1,250,2,24,2,188,2,198,2,201,2,216,2,243,3,0,
+3,3,3,9,3,15,3,35,3,132,3,140,3,142,3,163,3,209,3,214,4,0,4,136,30,0,30,62,
+30,128,30,160,31,77,32,0,32,19,32,23,32,32,32,38,32,48,32,50,32,57,32,60,
+32,68,32,127,32,163,32,167,32,171,33,5,33,19,33,22,33,34,33,38,33,46,33,91,
+34,2,34,6,34,15,34,17,34,26,34,30,34,43,34,72,34,96,34,100,37,202,251,1,254,
+255,255,252,255,255,255,227,0,0,255,176,0,191,0,178,0,97,255,73,0,0,255,150,
+254,133,254,132,254,118,255,104,255,99,255,98,255,93,0,103,255,68,253,208,
+253,207,253,206,253,205,254,130,254,127,0,0,0,0,228,88,228,24,227,122,0,0,
+227,13,226,66,225,239,225,238,225,237,225,234,225,225,225,224,225,219,225,
+218,225,211,225,153,225,118,225,116,0,0,225,24,225,11,225,9,224,254,224,251,
+224,244,224,200,224,37,224,34,224,26,224,25,224,18,224,15,224,3,223,231,223,
+208,223,205,220,105,0,0,3,79,2,83,0,1,0,0,0,132,0,0,0,0,0,0,0,0,0,0,2,56,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,30,3,42,
+0,0,0,0,0,0,4,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+4,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,4,174,0,0,0,0,0,0,0,98,0,99,0,100,0,101,0,102,0,103,0,104,0,105,0,106,
+0,107,0,108,0,109,0,110,0,111,0,112,0,113,0,114,0,115,0,116,0,117,0,118,0,
+119,0,120,0,121,0,122,0,123,0,124,0,125,0,126,0,127,0,128,0,129,0,130,0,131,
+0,132,0,133,0,134,0,135,0,136,0,137,0,138,0,139,0,140,0,141,0,142,0,143,0,
+144,0,145,0,146,0,147,0,148,0,149,0,150,0,151,0,152,0,153,0,154,0,155,0,156,
+0,157,0,158,0,159,0,160,0,161,0,162,0,163,0,164,0,165,0,166,0,167,0,168,0,
+169,0,170,0,171,0,172,0,173,0,174,0,175,0,176,0,177,0,178,0,179,0,180,0,181,
+0,182,0,183,0,184,0,185,0,186,0,187,0,188,0,189,0,190,0,191,0,192,0,193,0,
+194,0,195,0,196,0,197,0,198,0,199,0,200,0,201,0,202,0,203,0,204,0,205,0,206,
+0,207,0,208,0,209,0,210,0,211,0,212,0,213,0,214,0,215,0,216,0,217,0,218,0,
+219,0,220,0,221,0,222,0,223,0,224,0,225,0,226,0,227,0,228,0,229,0,230,0,231,
+0,232,0,233,0,234,0,235,0,236,0,237,0,238,0,239,0,240,0,241,0,242,0,243,0,
+244,0,245,0,246,0,247,0,248,0,249,0,250,0,251,0,252,0,253,0,254,0,255,1,0,
+1,1,1,2,1,3,1,4,1,5,1,6,1,7,1,8,1,9,1,10,1,11,1,12,1,13,1,14,1,15,1,16,1,
+17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,
+1,32,1,33,1,34,1,35,3,130,3,131,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,
+46,1,47,1,48,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,
+1,61,1,62,1,63,1,64,1,65,1,73,1,74,1,36,1,37,2,104,1,156,1,157,1,158,1,159,
+1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,2,105,1,168,1,169,1,170,1,
+171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,
+1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,
+196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,
+1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,
+221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,
+2,106,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,
+245,2,107,1,246,1,247,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,
+2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,
+129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,
+2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,
+154,1,248,1,249,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,
+2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,
+177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,
+2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,2,201,2,
+202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,
+2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,
+227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,
+2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,2,251,2,
+252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,
+12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,
+3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,3,41,
+3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,3,56,
+3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,3,71,
+3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,3,86,
+3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,3,
+101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,2,0,2,1,3,111,3,
+112,3,113,3,114,3,115,3,116,3,117,2,28,2,52,2,53,2,93,2,94,0,0,64,69,89,88,
+85,84,83,82,81,80,79,78,77,76,75,74,73,72,71,70,69,68,67,66,65,64,63,62,61,
+60,59,58,57,56,55,54,53,49,48,47,46,45,44,40,39,38,37,36,35,34,33,31,24,20,
+17,16,15,14,13,11,10,9,8,7,6,5,4,3,2,1,0,44,69,35,70,96,32,176,38,96,176,
+4,38,35,72,72,45,44,69,35,70,35,97,32,176,38,97,176,4,38,35,72,72,45,44,69,
+35,70,96,176,32,97,32,176,70,96,176,4,38,35,72,72,45,44,69,35,70,35,97,176,
+32,96,32,176,38,97,176,32,97,176,4,38,35,72,72,45,44,69,35,70,96,176,64,97,
+32,176,102,96,176,4,38,35,72,72,45,44,69,35,70,35,97,176,64,96,32,176,38,
+97,176,64,97,176,4,38,35,72,72,45,44,1,16,32,60,0,60,45,44,32,69,35,32,176,
+205,68,35,32,184,1,90,81,88,35,32,176,141,68,35,89,32,176,237,81,88,35,32,
+176,77,68,35,89,32,176,4,38,81,88,35,32,176,13,68,35,89,33,33,45,44,32,32,
+69,24,104,68,32,176,1,96,32,69,176,70,118,104,138,69,96,68,45,44,1,177,11,
+10,67,35,67,101,10,45,44,0,177,10,11,67,35,67,11,45,44,0,176,40,35,112,177,
+1,40,62,1,176,40,35,112,177,2,40,69,58,177,2,0,8,13,45,44,32,69,176,3,37,
+69,97,100,176,80,81,88,69,68,27,33,33,89,45,44,73,176,14,35,68,45,44,32,69,
+176,0,67,96,68,45,44,1,176,6,67,176,7,67,101,10,45,44,32,105,176,64,97,176,
+0,139,32,177,44,192,138,140,184,16,0,98,96,43,12,100,35,100,97,92,88,176,
+3,97,89,45,44,138,3,69,138,138,135,176,17,43,176,41,35,68,176,41,122,228,
+24,45,44,69,101,176,44,35,68,69,176,43,35,68,45,44,75,82,88,69,68,27,33,33,
+89,45,44,75,81,88,69,68,27,33,33,89,45,44,1,176,5,37,16,35,32,138,245,0,176,
+1,96,35,237,236,45,44,1,176,5,37,16,35,32,138,245,0,176,1,97,35,237,236,45,
+44,1,176,6,37,16,245,0,237,236,45,44,70,35,70,96,138,138,70,35,32,70,138,
+96,138,97,184,255,128,98,35,32,16,35,138,177,12,12,138,112,69,96,32,176,0,
+80,88,176,1,97,184,255,186,139,27,176,70,140,89,176,16,96,104,1,58,45,44,
+32,69,176,3,37,70,82,75,176,19,81,91,88,176,2,37,70,32,104,97,176,3,37,176,
+3,37,63,35,33,56,27,33,17,89,45,44,32,69,176,3,37,70,80,88,176,2,37,70,32,
+104,97,176,3,37,176,3,37,63,35,33,56,27,33,17,89,45,44,0,176,7,67,176,6,67,
+11,45,44,33,33,12,100,35,100,139,184,64,0,98,45,44,33,176,128,81,88,12,100,
+35,100,139,184,32,0,98,27,178,0,64,47,43,89,176,2,96,45,44,33,176,192,81,
+88,12,100,35,100,139,184,21,85,98,27,178,0,128,47,43,89,176,2,96,45,44,12,
+100,35,100,139,184,64,0,98,96,35,33,45,44,75,83,88,138,176,4,37,73,100,35,
+69,105,176,64,139,97,176,128,98,176,32,97,106,176,14,35,68,35,16,176,14,246,
+27,33,35,138,18,17,32,57,47,89,45,44,75,83,88,32,176,3,37,73,100,105,32,176,
+5,38,176,6,37,73,100,35,97,176,128,98,176,32,97,106,176,14,35,68,176,4,38,
+16,176,14,246,138,16,176,14,35,68,176,14,246,176,14,35,68,176,14,237,27,138,
+176,4,38,17,18,32,57,35,32,57,47,47,89,45,44,69,35,69,96,35,69,96,35,69,96,
+35,118,104,24,176,128,98,32,45,44,176,72,43,45,44,32,69,176,0,84,88,176,64,
+68,32,69,176,64,97,68,27,33,33,89,45,44,69,177,48,47,69,35,69,97,96,176,1,
+96,105,68,45,44,75,81,88,176,47,35,112,176,20,35,66,27,33,33,89,45,44,75,
+81,88,32,176,3,37,69,105,83,88,68,27,33,33,89,27,33,33,89,45,44,69,176,20,
+67,176,0,96,99,176,1,96,105,68,45,44,176,47,69,68,45,44,69,35,32,69,138,96,
+68,45,44,69,35,69,96,68,45,44,75,35,81,88,185,0,51,255,224,177,52,32,27,179,
+51,0,52,0,89,68,68,45,44,176,22,67,88,176,3,38,69,138,88,100,102,176,31,96,
+27,100,176,32,96,102,32,88,27,33,176,64,89,176,1,97,89,35,88,101,89,176,41,
+35,68,35,16,176,41,224,27,33,33,33,33,33,89,45,44,176,2,67,84,88,75,83,35,
+75,81,90,88,56,27,33,33,89,27,33,33,33,33,89,45,44,176,22,67,88,176,4,37,
+69,100,176,32,96,102,32,88,27,33,176,64,89,176,1,97,35,88,27,101,89,176,41,
+35,68,176,5,37,176,8,37,8,32,88,2,27,3,89,176,4,37,16,176,5,37,32,70,176,
+4,37,35,66,60,176,4,37,176,7,37,8,176,7,37,16,176,6,37,32,70,176,4,37,176,
+1,96,35,66,60,32,88,1,27,0,89,176,4,37,16,176,5,37,176,41,224,176,41,32,69,
+101,68,176,7,37,16,176,6,37,176,41,224,176,5,37,176,8,37,8,32,88,2,27,3,89,
+176,5,37,176,3,37,67,72,176,4,37,176,7,37,8,176,6,37,176,3,37,176,1,96,67,
+72,27,33,89,33,33,33,33,33,33,33,45,44,2,176,4,37,32,32,70,176,4,37,35,66,
+176,5,37,8,176,3,37,69,72,33,33,33,33,45,44,2,176,3,37,32,176,4,37,8,176,
+2,37,67,72,33,33,33,45,44,69,35,32,69,24,32,176,0,80,32,88,35,101,35,89,35,
+104,32,176,64,80,88,33,176,64,89,35,88,101,89,138,96,68,45,44,75,83,35,75,
+81,90,88,32,69,138,96,68,27,33,33,89,45,44,75,84,88,32,69,138,96,68,27,33,
+33,89,45,44,75,83,35,75,81,90,88,56,27,33,33,89,45,44,176,0,33,75,84,88,56,
+27,33,33,89,45,44,176,2,67,84,88,176,70,43,27,33,33,33,33,89,45,44,176,2,
+67,84,88,176,71,43,27,33,33,33,89,45,44,176,2,67,84,88,176,72,43,27,33,33,
+33,33,89,45,44,176,2,67,84,88,176,73,43,27,33,33,33,89,45,44,32,138,8,35,
+75,83,138,75,81,90,88,35,56,27,33,33,89,45,44,0,176,2,37,73,176,0,83,88,32,
+176,64,56,17,27,33,89,45,44,1,70,35,70,96,35,70,97,35,32,16,32,70,138,97,
+184,255,128,98,138,177,64,64,138,112,69,96,104,58,45,44,32,138,35,73,100,
+138,35,83,88,60,27,33,89,45,44,75,82,88,125,27,122,89,45,44,176,18,0,75,1,
+75,84,66,45,44,177,2,0,66,177,35,1,136,81,177,64,1,136,83,90,88,185,16,0,
+0,32,136,84,88,178,2,1,2,67,96,66,89,177,36,1,136,81,88,185,32,0,0,64,136,
+84,88,178,2,2,2,67,96,66,177,36,1,136,84,88,178,2,32,2,67,96,66,0,75,1,75,
+82,88,178,2,8,2,67,96,66,89,27,185,64,0,0,128,136,84,88,178,2,4,2,67,96,66,
+89,185,64,0,0,128,99,184,1,0,136,84,88,178,2,8,2,67,96,66,89,185,64,0,1,0,
+99,184,2,0,136,84,88,178,2,16,2,67,96,66,89,185,64,0,2,0,99,184,4,0,136,84,
+88,178,2,64,2,67,96,66,89,89,89,89,89,45,44,69,24,104,35,75,81,88,35,32,69,
+32,100,176,64,80,88,124,89,104,138,96,89,68,45,44,176,0,22,176,2,37,176,2,
+37,1,176,1,35,62,0,176,2,35,62,177,1,2,6,12,176,10,35,101,66,176,11,35,66,
+1,176,1,35,63,0,176,2,35,63,177,1,2,6,12,176,6,35,101,66,176,7,35,66,176,
+1,22,1,45,44,122,138,16,69,35,245,24,45,0,0,0,64,21,248,3,255,31,241,111,
+26,31,47,239,111,239,2,230,228,51,31,229,228,25,31,184,1,0,64,16,51,255,85,
+223,51,221,85,222,51,3,85,176,255,208,255,2,184,255,192,64,104,255,9,17,70,
+0,221,32,221,112,221,3,221,1,3,85,220,3,255,31,214,213,51,31,211,210,25,31,
+135,210,1,254,194,25,31,6,186,22,186,230,186,246,186,4,15,178,31,178,47,178,
+3,64,178,15,19,70,167,177,1,175,83,25,31,174,173,25,31,172,74,25,31,171,170,
+25,31,169,3,255,31,158,157,25,31,31,157,1,112,156,128,156,144,156,208,156,
+224,156,240,156,6,15,153,1,151,152,1,184,255,248,64,56,152,9,15,70,32,151,
+128,151,144,151,240,151,4,169,150,185,150,2,56,150,1,240,149,1,191,149,1,
+32,149,48,149,64,149,128,149,144,149,160,149,6,148,146,25,31,147,83,25,31,
+15,146,1,133,71,25,31,197,189,1,7,0,1,0,166,1,7,0,182,1,7,178,2,3,128,186,
+1,7,0,144,1,7,64,168,2,118,117,25,31,116,80,25,31,115,80,25,31,111,72,25,
+31,110,71,25,31,26,1,24,85,25,19,255,31,7,4,255,31,6,3,255,31,97,96,25,31,
+101,96,1,100,95,1,255,251,1,239,251,1,121,251,1,63,251,79,251,2,24,250,18,
+24,70,79,250,95,250,111,250,3,212,91,228,91,2,91,90,16,31,57,90,1,6,90,1,
+6,19,51,18,85,5,1,3,85,4,51,3,85,15,3,127,3,239,3,3,224,253,1,223,253,1,81,
+80,25,31,15,252,191,252,207,252,223,252,4,3,64,252,12,16,70,73,70,25,31,96,
+72,1,59,71,1,6,28,27,255,31,22,51,21,85,17,1,15,85,16,51,15,85,2,1,0,85,1,
+71,0,85,184,1,6,64,30,27,18,31,159,15,223,15,2,207,15,239,15,2,111,0,127,
+0,175,0,239,0,4,16,0,1,128,22,1,5,1,184,1,144,177,84,83,43,43,75,184,7,255,
+82,75,176,9,80,91,176,1,136,176,37,83,176,1,136,176,64,81,90,176,6,136,176,
+0,85,90,91,88,177,1,1,142,89,133,141,141,0,66,29,75,176,50,83,88,176,96,29,
+89,75,176,100,83,88,176,64,29,89,75,176,128,83,88,176,16,29,177,22,0,66,89,
+115,115,115,116,43,43,43,43,43,43,43,1,95,115,115,43,43,95,115,0,43,115,115,
+115,43,43,43,1,95,115,115,43,115,115,43,115,115,115,115,0,115,115,43,43,43,
+43,43,1,43,43,0,43,43,43,115,95,115,115,1,43,0,115,43,43,1,115,115,115,115,
+115,115,43,115,115,0,115,115,43,43,1,43,43,0,43,43,1,115,0,43,115,115,43,
+1,115,43,0,43,43,43,115,43,115,43,43,43,43,43,115,1,43,0,43,24,0,0,6,20,0,
+11,0,81,5,182,0,23,0,117,5,182,5,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,74,0,20,
+0,143,0,0,255,236,0,0,0,0,255,236,0,0,0,0,255,236,0,0,254,20,254,20,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,
+0,8,115,0,0,0,178,0,182,0,188,0,156,0,213,0,0,0,0,0,0,0,143,0,131,0,151,0,
+159,0,125,0,229,0,0,0,0,0,0,0,0,0,0,0,0,0,186,0,197,0,186,0,0,0,0,0,164,0,
+159,0,143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,0,185,0,138,
+0,0,0,0,0,155,0,166,0,143,0,119,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,105,0,110,0,144,0,192,1,137,0,219,0,172,0,0,0,0,0,0,0,102,0,111,0,120,
+0,150,0,192,0,213,1,72,0,205,1,21,2,151,0,254,1,47,0,237,1,78,0,121,1,22,
+1,76,1,245,2,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,226,5,182,0,150,0,
+140,0,229,0,150,0,137,0,250,0,0,1,24,1,12,3,29,0,153,2,74,0,120,2,182,0,141,
+0,168,0,140,0,0,0,0,2,121,0,217,0,180,0,0,0,0,1,90,0,109,0,127,0,160,0,0,
+0,0,0,109,0,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,0,160,0,0,0,130,0,137,
+0,0,0,0,0,0,0,0,0,0,5,182,252,234,0,17,255,235,0,150,0,0,0,0,0,0,0,115,0,
+101,0,120,0,0,0,0,0,0,0,0,0,188,1,170,3,84,1,170,2,29,0,188,0,182,0,0,0,0,
+0,0,0,150,0,0,0,0,5,182,254,188,0,152,0,172,1,57,1,245,1,131,3,29,255,243,
+0,131,0,122,0,134,0,0,0,0,254,111,0,137,0,0,0,40,0,40,0,40,0,40,0,90,0,135,
+1,28,1,193,2,108,3,39,3,66,3,111,3,156,3,210,3,250,4,45,4,74,4,105,4,135,
+4,205,4,250,5,77,5,178,6,2,6,85,6,179,6,233,7,103,7,196,7,245,8,52,8,122,
+8,174,8,243,9,75,9,234,10,97,10,190,10,255,11,55,11,111,11,175,11,252,12,
+51,12,110,12,156,13,28,13,66,13,194,14,26,14,85,14,147,14,238,15,79,15,156,
+15,204,15,254,16,101,17,71,17,196,18,54,18,111,18,156,18,186,18,231,19,22,
+19,45,19,79,19,164,19,241,20,44,20,122,20,201,21,17,21,159,21,221,22,25,22,
+93,22,185,22,231,23,77,23,134,23,192,24,16,24,95,24,149,24,226,25,49,25,104,
+25,189,26,130,26,246,27,87,27,145,27,237,28,5,28,96,28,149,28,149,28,191,
+29,15,29,98,29,208,30,87,30,123,31,4,31,58,31,194,32,22,32,94,32,132,32,140,
+33,41,33,62,33,169,33,221,34,40,34,150,34,184,34,250,35,61,35,95,35,156,35,
+196,35,252,36,68,36,115,36,166,36,211,37,51,37,75,37,98,37,121,37,145,37,
+171,37,209,38,58,38,76,38,100,38,123,38,146,38,171,38,195,38,218,38,241,39,
+10,39,90,39,113,39,137,39,160,39,184,39,207,39,232,40,55,40,165,40,189,40,
+212,40,235,41,4,41,27,41,93,41,211,41,234,42,2,42,26,42,54,42,84,42,108,42,
+237,42,255,43,22,43,50,43,72,43,96,43,119,43,141,43,164,43,189,44,53,44,75,
+44,98,44,120,44,143,44,165,44,190,45,9,45,127,45,150,45,172,45,194,45,218,
+45,240,46,65,46,89,46,113,46,135,46,159,46,181,46,206,46,237,47,4,47,27,47,
+60,47,82,47,105,47,127,47,150,47,172,47,196,47,224,47,232,48,78,48,102,48,
+124,48,147,48,169,48,192,48,214,48,234,48,254,49,21,49,43,49,66,49,89,49,
+116,49,139,49,162,49,184,49,206,49,228,49,251,50,18,50,100,50,182,50,205,
+50,228,50,251,51,18,51,41,51,63,51,82,51,101,51,124,51,168,51,230,52,75,52,
+98,52,121,52,144,52,167,53,4,53,28,53,51,53,74,53,97,53,117,53,139,53,159,
+53,183,54,18,54,124,54,147,54,169,54,192,54,215,54,239,55,5,55,78,55,168,
+55,238,56,5,56,27,56,51,56,73,56,98,56,122,56,208,57,73,57,97,57,119,57,142,
+57,174,57,198,57,221,57,244,58,10,58,33,58,55,58,74,58,95,58,118,58,140,58,
+163,58,185,58,208,58,230,59,48,59,147,59,170,59,192,59,216,59,238,60,6,60,
+28,60,53,60,78,60,103,60,127,60,146,60,171,60,194,60,217,60,240,61,6,61,31,
+61,54,61,76,61,99,61,121,61,144,61,166,61,215,62,47,62,104,62,156,62,179,
+62,201,62,224,62,246,63,12,63,35,63,87,63,139,63,185,63,248,64,46,64,154,
+64,208,65,9,65,73,65,110,65,193,65,218,65,252,66,26,66,56,66,81,66,104,66,
+127,66,150,66,171,66,179,66,187,66,232,67,111,67,119,67,127,67,135,67,231,
+67,239,67,247,68,111,68,119,68,127,68,190,68,198,68,235,68,243,69,78,69,86,
+69,94,69,241,69,249,70,95,70,201,70,226,70,251,71,18,71,40,71,62,71,84,71,
+109,71,199,72,43,72,129,72,226,73,57,73,176,73,232,74,65,74,108,74,116,74,
+211,75,20,75,107,75,248,76,0,76,94,76,167,77,4,77,71,77,143,77,200,78,42,
+78,211,79,51,79,187,79,211,79,236,80,2,80,24,80,46,80,71,80,175,80,198,81,
+19,81,27,81,35,81,60,81,68,81,188,82,8,82,93,82,116,82,139,82,196,82,204,
+83,9,83,17,83,25,83,128,83,136,84,21,84,116,84,197,84,221,85,55,85,141,85,
+149,85,157,85,165,85,173,85,181,85,189,85,197,86,66,86,74,86,82,86,135,86,
+188,87,1,87,93,87,159,87,239,88,44,88,124,88,232,89,71,89,79,89,166,90,5,
+90,45,90,139,90,147,91,62,91,153,91,246,92,18,92,113,92,246,93,128,93,184,
+93,192,93,231,93,239,93,247,94,40,94,48,94,144,94,152,94,204,95,1,95,69,95,
+152,95,220,96,52,96,115,96,209,97,51,97,142,97,166,98,10,98,32,98,121,98,
+129,98,137,98,162,98,170,99,26,99,112,99,120,99,142,99,164,99,222,100,16,
+100,58,100,82,100,105,100,128,100,150,100,175,100,200,100,224,100,247,101,
+16,101,38,101,60,101,110,101,150,101,197,101,249,102,32,102,99,102,176,102,
+253,103,49,103,122,103,164,103,246,104,185,104,193,104,201,104,254,105,38,
+105,68,105,100,105,162,105,242,106,103,106,221,107,80,107,228,108,79,109,
+10,109,109,109,117,109,195,109,254,110,53,110,110,110,167,110,250,111,124,
+111,168,112,1,112,27,112,72,112,178,112,232,113,65,113,157,113,235,114,55,
+114,118,114,212,115,31,115,78,115,130,115,162,115,195,115,228,116,22,116,
+97,116,182,116,255,117,45,117,161,117,239,117,239,117,239,117,239,117,239,
+117,239,117,239,117,239,117,239,117,239,117,239,117,239,117,239,117,239,119,
+67,119,192,119,210,119,218,120,119,120,241,121,122,121,145,121,167,121,191,
+121,215,121,252,122,83,122,157,123,25,123,148,123,253,124,89,124,173,125,
+17,125,25,125,33,125,41,125,108,125,140,125,164,125,188,125,211,125,234,126,
+126,127,2,127,86,127,172,128,27,128,136,129,6,129,155,130,81,130,235,131,
+85,131,208,132,81,132,226,133,190,134,162,134,170,134,178,135,13,135,89,135,
+179,136,18,136,44,136,69,136,233,137,144,138,28,138,155,139,132,140,86,141,
+26,141,219,142,45,142,120,142,249,143,41,143,90,143,138,143,188,144,100,145,
+13,145,135,146,22,146,104,146,192,147,48,147,193,147,244,148,38,148,125,148,
+213,149,58,149,151,149,170,149,191,150,25,150,95,150,199,151,43,151,138,151,
+241,152,63,152,138,152,206,153,21,153,85,153,140,153,229,154,74,154,245,155,
+170,155,190,155,209,156,13,156,63,156,71,156,158,157,36,157,148,158,8,158,
+139,158,196,159,0,159,71,159,146,159,233,160,70,160,125,160,192,161,60,161,
+185,162,67,162,204,162,212,162,235,163,1,163,104,163,199,164,37,164,112,164,
+196,165,21,165,93,165,159,165,235,166,60,166,220,167,126,167,134,167,158,
+167,180,167,206,167,230,167,238,167,246,168,14,168,36,168,133,168,230,168,
+255,169,23,169,49,169,74,169,100,169,125,169,212,170,46,170,69,170,91,170,
+116,170,140,170,165,170,190,170,198,170,206,170,231,171,0,171,26,171,51,171,
+74,171,96,171,122,171,146,171,171,171,195,171,220,171,244,172,37,172,81,172,
+106,172,130,172,212,173,37,173,62,173,90,173,212,174,93,174,156,174,164,175,
+9,175,127,175,246,176,105,176,213,177,62,177,175,178,18,178,100,178,186,179,
+28,179,120,179,193,180,10,180,127,180,135,180,143,180,151,180,173,180,195,
+180,218,180,240,181,9,181,33,181,59,181,84,181,109,181,133,181,158,181,182,
+181,215,181,247,182,16,182,40,182,65,182,89,182,114,182,138,182,164,182,188,
+182,223,182,255,183,21,183,43,183,66,183,88,183,111,183,133,183,158,183,182,
+183,208,183,233,184,2,184,26,184,52,184,76,184,109,184,141,184,164,184,186,
+184,208,184,231,184,254,185,20,185,43,185,65,185,90,185,114,185,140,185,165,
+185,190,185,214,185,239,186,7,186,43,186,75,186,98,186,117,186,141,186,162,
+186,186,186,209,186,233,186,254,187,21,187,44,187,66,187,88,187,111,187,133,
+187,157,187,178,187,202,187,224,187,248,188,15,188,38,188,57,188,80,188,103,
+188,125,188,147,188,170,188,192,188,215,188,237,189,126,189,195,190,21,190,
+103,190,216,191,79,191,152,191,225,192,77,192,190,192,241,193,28,193,71,193,
+89,193,108,0,0,0,2,0,193,0,0,4,10,5,182,0,3,0,7,0,39,64,21,5,96,2,1,2,2,9,
+4,0,3,112,3,128,3,3,3,4,3,7,0,3,0,63,50,47,51,1,47,93,51,17,51,47,93,51,49,
+48,19,33,17,33,55,33,17,33,193,3,73,252,183,104,2,121,253,135,5,182,250,74,
+104,4,230,0,2,1,231,255,227,2,229,5,182,0,3,0,11,0,52,64,28,1,0,3,6,150,2,
+10,10,12,13,47,0,1,0,0,2,21,4,1,6,4,1,4,155,8,168,2,3,0,63,63,225,93,93,17,
+57,47,93,17,18,1,57,47,51,225,50,57,57,49,48,1,35,3,51,3,50,21,20,35,34,53,
+52,2,164,121,51,223,113,127,127,127,1,158,4,24,251,68,139,140,140,139,0,0,
+2,1,29,3,166,3,176,5,182,0,3,0,7,0,46,64,28,4,207,7,1,160,7,1,79,7,1,7,0,
+32,3,48,3,144,3,160,3,4,3,6,1,158,7,0,3,0,63,50,237,50,1,47,93,193,47,93,
+93,93,193,49,48,1,3,35,3,33,3,35,3,2,10,41,155,41,2,147,41,155,41,5,182,253,
+240,2,16,253,240,2,16,0,2,0,45,0,0,4,160,5,182,0,27,0,31,0,184,64,115,28,
+8,20,9,171,10,18,15,14,11,4,10,19,170,20,4,1,0,25,4,24,5,170,6,22,30,29,7,
+4,6,23,171,24,31,21,10,20,64,2,80,2,2,16,10,20,6,24,2,2,24,6,20,10,16,6,208,
+26,240,26,2,127,26,159,26,2,26,224,12,240,12,2,12,8,4,12,174,13,28,1,13,31,
+0,16,174,17,25,21,17,63,17,79,17,127,17,143,17,159,17,5,63,13,79,13,2,13,
+17,13,17,5,23,19,3,10,5,18,0,63,51,63,51,18,57,57,47,47,93,93,17,51,51,16,
+225,50,50,17,51,51,16,225,50,50,1,47,93,47,93,93,23,57,47,47,47,47,47,47,
+93,17,18,57,57,16,225,17,23,57,16,225,17,23,57,16,225,17,23,57,16,225,17,
+57,57,49,48,1,3,51,21,33,3,35,19,33,3,35,19,35,53,51,19,35,53,33,19,51,3,
+33,19,51,3,51,21,1,33,19,33,3,168,64,240,254,246,82,148,84,254,222,82,144,
+78,217,244,65,233,1,2,82,147,82,1,37,84,144,84,221,253,20,1,35,64,254,221,
+3,125,254,184,137,254,84,1,172,254,84,1,172,137,1,72,137,1,176,254,80,1,176,
+254,80,137,254,184,1,72,0,3,0,182,255,137,4,20,6,18,0,28,0,34,0,39,0,205,
+64,134,19,36,1,4,36,1,19,35,1,4,35,1,19,9,1,6,9,1,3,8,19,8,2,2,3,18,3,2,2,
+2,18,2,2,4,1,20,1,2,4,0,20,0,2,36,24,18,1,112,29,15,8,2,2,5,72,38,88,38,120,
+38,3,38,110,20,27,64,17,20,72,64,27,80,27,2,27,41,5,5,32,110,0,12,144,12,
+160,12,208,12,4,12,23,30,115,15,38,35,9,24,29,32,6,3,21,18,15,95,16,111,16,
+127,16,3,16,16,15,15,47,15,63,15,95,15,4,15,36,8,115,3,6,3,2,2,0,3,184,255,
+192,179,10,14,72,3,0,47,43,51,51,47,17,51,16,225,50,47,93,51,47,93,17,51,
+51,18,23,57,16,225,50,1,47,93,225,51,47,16,222,93,43,50,225,93,17,57,47,51,
+51,51,225,50,50,50,49,48,93,93,93,93,93,93,93,93,93,93,93,37,21,35,53,34,
+39,53,22,51,17,38,38,53,52,54,55,53,51,21,22,23,7,38,39,17,22,22,21,16,1,
+17,6,21,20,22,23,17,54,53,52,2,172,137,228,137,196,169,193,155,184,164,137,
+187,149,66,140,130,199,161,254,15,172,81,228,184,111,230,221,70,172,92,1,
+178,64,163,138,131,172,20,180,176,9,69,145,62,10,254,90,68,161,130,254,232,
+2,176,1,113,29,145,78,86,250,254,139,28,156,127,0,5,0,0,255,238,4,205,5,199,
+0,11,0,19,0,23,0,35,0,43,0,207,185,0,34,255,224,179,9,13,72,32,184,255,224,
+64,14,9,13,72,28,32,9,13,72,26,32,9,13,72,10,184,255,224,179,9,13,72,8,184,
+255,224,64,33,9,13,72,4,32,9,13,72,2,32,9,13,72,103,42,151,42,167,42,3,42,
+180,27,181,33,21,22,23,20,0,22,1,22,184,255,192,64,26,21,24,72,15,20,1,20,
+64,21,24,72,22,20,22,20,3,104,38,152,38,168,38,3,38,180,33,184,255,192,64,
+46,21,24,72,33,45,104,14,152,14,168,14,3,14,180,9,181,103,18,151,18,167,18,
+3,18,180,3,40,182,30,183,36,182,24,25,23,6,21,24,12,182,0,183,16,182,6,7,
+0,63,225,244,225,63,63,63,225,244,225,1,47,225,93,244,225,93,16,212,43,225,
+93,18,57,57,47,47,43,93,43,93,17,51,17,51,16,244,225,93,49,48,43,43,43,43,
+43,43,43,43,1,34,38,53,52,54,51,50,22,21,20,6,39,50,53,52,35,34,21,20,1,1,
+35,1,19,34,38,53,52,54,51,50,22,21,20,6,39,50,53,52,35,34,21,20,1,35,131,
+160,158,137,129,162,157,136,139,139,141,3,137,253,39,158,2,217,35,130,161,
+158,137,129,162,157,136,139,139,141,3,16,189,160,164,182,186,160,162,187,
+119,230,225,225,230,2,47,250,74,5,182,250,56,189,159,164,182,186,160,161,
+187,118,230,225,225,230,0,0,3,0,61,255,236,4,203,5,205,0,26,0,37,0,45,0,229,
+64,15,17,39,38,9,4,8,19,8,27,0,1,6,4,7,36,184,255,240,64,48,14,17,72,64,36,
+1,52,36,1,36,71,19,30,16,14,17,72,79,30,1,59,30,1,6,30,71,25,32,19,48,19,
+2,192,25,208,25,2,19,25,19,25,14,121,3,1,3,71,4,184,255,192,64,28,9,18,72,
+4,4,7,7,47,41,72,14,64,10,16,72,14,70,6,1,70,1,86,1,2,55,1,1,27,184,255,248,
+64,55,11,14,72,27,0,1,6,4,8,33,80,22,88,9,1,88,38,1,56,39,88,39,2,41,39,1,
+40,17,1,17,39,38,9,4,8,22,15,3,31,3,79,3,127,3,4,3,3,22,4,44,81,11,22,8,21,
+0,63,63,225,63,57,47,93,17,18,23,57,93,93,93,93,93,16,225,17,23,57,43,93,
+93,93,1,47,43,225,17,51,47,51,47,43,225,93,18,57,57,47,47,93,93,16,225,95,
+93,93,43,16,225,93,93,43,17,23,57,51,17,18,23,57,49,48,1,1,54,55,51,6,7,19,
+35,39,6,35,34,38,53,52,54,55,38,53,52,54,51,50,22,21,20,5,54,54,53,52,38,
+35,34,6,21,20,1,1,6,21,20,22,51,50,2,90,1,25,71,33,184,53,125,234,217,131,
+174,238,189,217,127,172,163,191,179,168,185,254,100,134,99,99,81,87,99,1,
+147,254,189,203,134,93,160,3,8,254,164,121,145,234,169,254,221,166,186,214,
+187,131,195,102,192,164,148,172,171,149,203,65,79,119,74,74,92,89,81,118,
+253,8,1,145,123,178,105,141,0,0,1,1,240,3,166,2,221,5,182,0,3,0,24,64,13,
+0,160,3,224,3,240,3,3,3,1,158,0,3,0,63,237,1,47,93,193,49,48,1,3,35,3,2,221,
+41,155,41,5,182,253,240,2,16,0,0,1,1,39,254,188,3,164,5,182,0,9,0,39,64,21,
+6,5,5,0,1,1,11,3,240,31,8,127,8,143,8,3,8,6,249,0,248,0,63,63,1,47,93,225,
+17,51,47,51,51,17,51,49,48,1,51,0,17,16,1,35,0,17,16,2,227,193,254,63,1,191,
+191,254,68,5,182,254,136,253,251,253,247,254,140,1,97,2,26,2,20,0,0,1,1,41,
+254,188,3,166,5,182,0,9,0,39,64,21,3,240,16,8,112,8,128,8,3,8,8,11,0,1,1,
+6,5,6,248,0,249,0,63,63,1,47,51,51,17,51,17,51,47,93,225,49,48,1,35,0,17,
+16,1,51,0,17,16,1,233,190,1,190,254,64,192,1,189,254,188,1,115,2,10,2,6,1,
+119,254,151,253,234,253,228,0,0,1,0,133,2,119,4,72,6,20,0,14,0,36,64,21,244,
+7,1,7,5,9,7,4,10,3,11,1,13,2,12,11,8,6,6,0,0,0,63,50,47,51,23,57,1,25,47,
+93,49,48,1,3,37,23,5,19,7,3,3,39,19,37,55,5,3,2,203,43,1,141,27,254,133,246,
+179,176,157,185,242,254,137,29,1,135,43,6,20,254,119,111,193,28,254,186,96,
+1,102,254,154,96,1,70,28,193,111,1,137,0,0,1,0,152,1,6,4,51,4,162,0,11,0,
+31,64,16,9,6,170,0,192,3,208,3,2,3,9,0,173,6,3,179,0,63,51,225,50,1,47,93,
+51,225,50,49,48,1,33,53,33,17,51,17,33,21,33,17,35,2,27,254,125,1,131,149,
+1,131,254,125,149,2,135,150,1,133,254,123,150,254,127,0,0,1,1,184,254,223,
+3,18,1,6,0,6,0,63,64,25,25,6,41,6,233,6,249,6,4,6,152,1,153,112,4,128,4,208,
+4,224,4,240,4,5,4,184,255,192,64,15,9,12,72,4,4,7,8,3,158,31,6,47,6,2,6,0,
+47,93,237,17,18,1,57,47,43,93,253,225,93,49,48,1,23,6,3,35,18,55,3,2,16,57,
+137,152,76,35,1,6,24,224,254,209,1,67,228,0,0,1,1,29,1,209,3,176,2,121,0,
+3,0,32,64,18,128,2,144,2,2,2,2,5,32,0,48,0,2,0,0,185,1,189,0,63,225,1,47,
+93,17,51,47,93,49,48,1,53,33,21,1,29,2,147,1,209,168,168,0,1,1,207,255,225,
+2,254,1,45,0,7,0,29,64,15,2,151,48,6,176,6,2,6,6,8,9,0,156,4,168,0,63,237,
+17,18,1,57,47,93,237,49,48,1,50,21,20,35,34,53,52,2,102,152,152,151,1,45,
+166,166,166,166,0,1,0,211,0,0,3,248,5,182,0,3,0,28,64,12,3,0,0,5,1,2,2,4,
+3,3,1,18,0,63,63,17,1,51,47,51,17,51,47,50,49,48,1,1,35,1,3,248,253,141,178,
+2,115,5,182,250,74,5,182,0,0,2,0,147,255,236,4,57,5,205,0,9,0,21,0,54,64,
+18,13,111,208,8,1,8,23,19,111,0,3,16,3,32,3,3,7,3,184,255,192,64,12,21,24,
+72,3,16,115,5,7,10,115,0,25,0,63,225,63,225,1,47,43,94,93,225,16,222,93,225,
+49,48,5,34,2,17,16,33,50,18,17,16,37,50,18,17,16,2,35,34,2,17,16,18,2,100,
+229,236,1,209,232,237,254,43,147,138,138,147,145,135,135,20,1,131,1,110,2,
+240,254,125,254,147,253,15,155,1,25,1,61,1,59,1,25,254,233,254,195,254,194,
+254,232,0,0,1,0,225,0,0,2,246,5,182,0,10,0,43,64,22,9,1,8,8,0,110,0,1,16,
+1,2,6,1,1,12,11,4,7,9,6,0,24,0,63,63,205,57,17,18,1,57,47,94,93,225,51,47,
+17,51,49,48,33,35,17,52,55,6,7,7,39,1,51,2,246,176,8,39,82,147,97,1,127,150,
+3,145,122,239,43,70,121,123,1,43,0,0,1,0,158,0,0,4,45,5,203,0,23,0,85,64,
+29,144,23,160,23,176,23,3,23,23,6,111,255,17,1,17,64,15,19,72,17,25,213,22,
+229,22,245,22,3,22,184,255,232,64,23,9,12,72,22,12,0,1,176,1,2,1,6,1,11,9,
+115,14,7,2,22,116,1,24,0,63,225,50,63,225,51,18,57,1,47,93,50,50,43,93,16,
+222,43,93,225,51,47,93,49,48,33,33,53,1,54,54,53,52,38,35,34,7,39,54,51,50,
+22,21,20,6,7,1,21,33,4,45,252,113,1,94,195,124,127,108,160,158,102,192,230,
+194,224,118,232,254,231,2,176,156,1,125,213,209,126,113,131,137,119,172,212,
+179,119,250,250,254,213,8,0,0,1,0,131,255,236,4,31,5,203,0,34,0,95,64,58,
+11,19,27,19,2,0,16,21,111,32,32,3,95,16,1,16,16,8,13,111,159,3,175,3,2,3,
+36,27,207,8,223,8,239,8,3,0,8,1,8,0,16,115,104,17,1,17,17,11,26,24,115,29,
+7,11,115,9,6,25,0,63,51,225,63,225,51,18,57,47,93,225,57,1,47,93,93,51,16,
+222,93,225,17,57,47,93,17,51,47,225,18,57,49,48,93,1,21,4,17,20,4,33,34,39,
+53,22,51,32,17,16,33,35,53,51,50,54,53,52,38,35,34,7,39,54,51,50,22,21,20,
+6,2,182,1,105,254,236,254,251,242,145,184,199,1,98,254,131,133,133,160,176,
+136,114,178,166,92,187,249,206,231,164,3,2,6,47,254,211,203,233,79,170,96,
+1,33,1,2,151,152,125,102,119,121,125,150,198,165,138,186,0,0,2,0,61,0,0,4,
+102,5,190,0,10,0,18,0,86,64,24,7,16,9,15,72,11,7,3,110,9,0,2,64,16,19,72,
+0,2,1,2,2,19,20,18,184,255,240,64,24,11,15,72,18,5,64,10,16,72,5,1,4,116,
+9,6,14,7,11,11,2,7,6,2,24,0,63,63,18,57,47,18,57,51,51,225,50,1,47,43,51,
+43,17,18,57,47,93,43,51,51,225,50,50,49,48,43,1,35,17,35,17,33,53,1,51,17,
+51,33,17,52,19,35,6,7,1,4,102,213,176,253,92,2,152,188,213,254,123,13,9,36,
+54,254,101,1,72,254,184,1,72,159,3,215,252,48,1,100,176,1,0,102,78,253,160,
+0,0,1,0,172,255,236,4,31,5,182,0,24,0,82,64,49,13,64,11,15,72,13,13,0,5,111,
+159,20,175,20,2,20,26,14,15,15,11,9,10,10,0,0,144,0,160,0,176,0,4,0,9,7,115,
+17,17,11,3,115,1,23,25,14,116,11,6,0,63,225,63,51,225,17,57,47,225,51,1,47,
+93,51,47,51,51,51,17,51,16,222,93,225,18,57,47,43,49,48,55,53,22,51,32,17,
+16,33,34,7,39,19,33,21,33,3,54,51,50,4,21,20,4,35,34,172,144,216,1,80,254,
+168,89,142,90,55,2,178,253,236,39,107,102,210,1,3,254,236,251,224,59,172,
+96,1,58,1,38,26,57,2,176,166,254,93,20,229,199,234,255,0,0,2,0,154,255,236,
+4,51,5,203,0,21,0,33,0,79,64,22,1,64,11,15,72,1,1,18,22,110,191,12,1,12,35,
+6,28,111,0,18,1,18,184,255,192,64,22,20,24,72,18,6,25,117,127,9,1,9,9,31,
+3,115,1,20,7,31,115,15,25,0,63,225,63,51,225,18,57,47,93,225,50,1,47,43,93,
+225,50,16,222,93,225,18,57,47,43,49,48,1,21,38,35,34,2,3,51,54,51,50,22,21,
+20,2,35,34,0,17,16,33,50,19,52,38,35,34,6,21,20,22,51,50,54,3,197,71,95,224,
+225,10,12,95,212,195,221,241,203,218,254,253,2,127,104,2,137,127,127,172,
+162,131,127,143,5,184,155,24,254,230,254,206,170,238,206,228,254,249,1,81,
+1,52,3,90,252,12,145,156,162,104,152,221,176,0,0,1,0,143,0,0,4,59,5,182,0,
+6,0,71,64,48,121,6,137,6,2,71,6,87,6,2,7,6,23,6,39,6,3,6,0,0,2,8,1,24,1,40,
+1,3,1,5,8,0,2,208,2,224,2,240,2,4,2,5,2,116,3,6,0,24,0,63,63,225,50,1,47,
+93,16,206,50,93,17,57,47,51,93,49,48,93,93,33,1,33,53,33,21,1,1,78,2,51,253,
+14,3,172,253,213,5,16,166,145,250,219,0,3,0,156,255,236,4,49,5,205,0,19,0,
+30,0,41,0,124,64,31,10,31,12,38,110,2,20,0,2,28,110,12,22,110,18,12,18,12,
+18,8,191,2,1,2,43,33,110,0,8,1,8,184,255,192,183,20,24,72,8,215,20,1,20,184,
+255,240,64,34,12,15,72,7,20,23,20,2,57,31,89,31,105,31,121,31,4,42,31,1,31,
+10,0,20,4,35,25,115,15,7,35,115,5,25,0,63,225,63,225,18,23,57,93,93,93,43,
+93,1,47,43,93,225,16,206,93,17,57,57,47,47,16,225,16,225,17,57,57,16,225,
+17,57,57,49,48,1,4,21,20,6,35,34,38,53,16,37,38,53,52,54,51,50,22,21,20,5,
+54,53,52,38,35,34,6,21,20,22,23,6,21,20,33,50,54,53,52,38,39,2,252,1,53,252,
+207,216,242,1,26,235,233,178,184,228,254,102,232,126,110,106,125,99,108,254,
+1,20,136,149,126,151,3,6,160,233,181,220,207,186,1,1,136,146,223,161,189,
+190,162,230,55,103,175,101,106,106,101,90,125,215,121,204,240,131,117,90,
+139,74,0,0,2,0,154,255,236,4,51,5,203,0,21,0,33,0,78,185,0,1,255,192,64,20,
+11,15,72,1,1,12,6,28,111,191,18,1,18,35,22,110,0,12,1,12,184,255,192,64,19,
+20,24,72,12,6,25,117,9,9,15,3,117,1,20,25,31,115,15,7,0,63,225,63,51,225,
+17,57,47,225,50,1,47,43,93,225,16,222,93,225,50,18,57,47,43,49,48,5,53,22,
+51,50,18,19,35,6,35,34,38,53,52,18,51,50,0,17,16,33,34,3,20,22,51,50,54,53,
+52,38,35,34,6,1,8,67,99,224,225,10,12,96,212,194,221,241,203,220,1,1,253,
+129,105,1,137,127,127,172,160,133,128,142,2,156,25,1,26,1,50,170,236,208,
+228,1,8,254,170,254,209,252,166,3,243,145,156,163,103,151,222,174,0,0,2,1,
+231,255,227,2,229,4,102,0,7,0,15,0,45,64,27,10,2,150,14,48,6,96,6,176,6,224,
+6,240,6,5,6,6,16,17,8,155,12,168,4,155,0,16,0,63,237,63,237,17,18,1,57,47,
+93,51,237,50,49,48,1,50,21,20,35,34,53,52,19,50,21,20,35,34,53,52,2,102,127,
+127,127,127,127,127,127,4,102,139,139,139,139,252,148,139,140,140,139,0,2,
+1,154,254,248,2,236,4,102,0,7,0,14,0,68,64,46,25,14,41,14,233,14,249,14,4,
+14,152,12,153,9,9,2,150,48,6,96,6,176,6,224,6,240,6,5,6,6,15,16,11,157,31,
+14,47,14,63,14,3,14,4,155,0,16,0,63,237,47,93,237,17,18,1,57,47,93,237,50,
+47,237,225,93,49,48,1,50,21,20,35,34,53,52,19,23,6,3,35,54,55,2,109,127,127,
+127,215,14,51,125,137,62,38,4,102,139,139,139,139,252,136,23,197,254,230,
+255,247,0,0,1,0,152,0,221,4,51,4,201,0,6,0,97,64,61,103,6,119,6,135,6,3,104,
+4,120,4,136,4,3,118,5,134,5,2,5,4,1,4,0,8,1,1,7,2,1,5,5,3,6,224,0,1,223,0,
+1,64,0,1,63,0,1,0,0,1,0,0,4,32,3,192,3,2,15,3,1,3,0,47,93,93,51,51,47,93,
+93,93,93,93,50,18,57,17,51,51,17,1,51,47,16,206,50,17,18,57,93,49,48,0,93,
+93,37,1,53,1,21,1,1,4,51,252,101,3,155,253,53,2,203,221,1,195,102,1,195,160,
+254,170,254,170,0,0,2,0,152,1,186,4,51,3,233,0,3,0,7,0,64,64,39,7,2,9,4,0,
+1,1,1,1,8,5,173,112,4,1,79,4,95,4,111,4,3,0,4,1,4,4,0,173,143,1,1,80,1,1,
+15,1,1,1,0,47,93,93,93,225,51,47,93,93,93,225,17,1,51,47,93,51,16,206,50,
+49,48,19,53,33,21,1,53,33,21,152,3,155,252,101,3,155,3,84,149,149,254,102,
+150,150,0,0,1,0,152,0,221,4,51,4,201,0,6,0,95,64,60,104,2,120,2,136,2,3,103,
+0,119,0,135,0,3,121,1,137,1,2,1,6,4,8,2,6,6,7,5,4,1,1,3,0,224,6,1,223,6,1,
+64,6,1,63,6,1,0,6,1,6,6,2,32,3,192,3,2,15,3,1,3,0,47,93,93,51,51,47,93,93,
+93,93,93,51,18,57,17,51,51,17,1,51,47,51,16,206,17,57,93,49,48,0,93,93,19,
+1,1,53,1,21,1,152,2,202,253,54,3,155,252,101,1,125,1,86,1,86,160,254,61,102,
+254,61,0,0,2,0,168,255,227,4,35,5,203,0,25,0,33,0,74,64,42,25,0,0,28,150,
+32,32,13,7,71,18,35,32,35,1,0,13,1,13,7,15,47,0,1,0,0,15,21,26,1,6,26,1,26,
+155,30,168,12,10,81,15,4,0,63,225,51,63,225,93,93,17,57,47,93,18,57,1,47,
+93,93,16,222,225,17,57,47,229,51,17,51,49,48,1,53,52,54,55,54,54,53,52,38,
+35,34,7,39,54,51,50,22,21,20,6,7,6,6,21,21,7,50,21,20,35,34,53,52,1,209,92,
+115,130,83,149,132,174,197,65,209,217,214,251,107,143,118,66,72,127,127,127,
+1,158,37,120,150,82,97,116,100,92,115,90,153,97,195,164,133,166,108,87,108,
+90,18,164,139,140,140,139,0,0,2,0,31,255,74,4,174,5,182,0,46,0,56,0,143,64,
+90,22,52,1,52,211,6,0,47,24,56,1,56,211,14,11,30,14,28,6,1,212,14,1,96,14,
+1,25,14,1,4,14,1,6,14,6,14,36,9,19,1,19,210,42,58,6,25,1,25,210,36,17,54,
+213,3,45,3,49,213,9,63,3,79,3,143,3,207,3,223,3,5,48,9,64,9,208,9,3,3,9,3,
+9,28,22,214,39,3,28,214,30,33,0,47,51,225,63,225,18,57,57,47,47,93,93,16,
+225,17,51,16,225,50,1,47,225,93,16,214,225,93,17,57,57,47,47,93,93,93,93,
+93,17,57,51,16,225,93,50,57,16,225,93,49,48,1,35,6,35,34,38,53,52,54,51,50,
+23,3,6,21,21,20,51,50,17,16,2,35,34,2,17,16,0,51,50,55,21,6,35,32,0,17,16,
+0,33,50,0,17,20,2,35,34,3,38,35,34,6,21,20,51,50,19,3,31,4,74,156,120,140,
+194,158,137,119,22,2,72,100,222,188,226,253,1,3,239,181,165,158,194,254,214,
+254,177,1,78,1,32,248,1,41,128,114,128,76,54,49,89,95,127,131,14,1,145,180,
+209,176,206,253,47,254,96,38,31,7,176,1,127,1,22,1,60,254,128,254,177,254,
+200,254,171,78,133,82,1,158,1,114,1,141,1,207,254,120,254,173,231,254,233,
+2,182,21,187,147,252,1,56,0,2,0,33,0,0,4,172,5,188,0,7,0,14,0,168,64,10,2,
+14,3,8,1,0,183,6,1,6,184,255,248,64,98,14,17,72,71,6,1,38,6,1,23,6,1,6,6,
+1,6,184,5,1,5,8,14,17,72,72,5,1,41,5,1,24,5,1,9,5,1,5,11,11,4,88,0,1,72,0,
+1,42,0,1,9,0,25,0,2,0,7,7,16,87,3,1,71,3,1,37,3,1,6,3,22,3,2,3,4,2,95,11,
+16,17,20,72,11,16,11,14,72,29,11,1,11,5,14,14,5,3,4,0,18,0,63,50,63,57,47,
+18,57,93,43,43,225,1,47,51,93,93,93,93,17,51,47,51,93,93,93,93,18,57,61,47,
+51,93,93,93,93,43,93,51,93,93,93,93,43,93,18,57,57,18,57,57,49,48,33,3,33,
+3,35,1,51,1,1,3,38,39,6,7,3,3,236,144,254,21,146,190,1,227,195,1,229,254,
+123,133,39,23,20,26,144,1,197,254,59,5,188,250,68,2,106,1,168,124,102,99,
+84,254,45,0,0,3,0,135,0,0,4,113,5,182,0,14,0,23,0,30,0,82,64,50,19,91,20,
+7,36,7,2,7,4,4,14,28,91,10,32,15,25,90,0,14,1,0,14,16,14,240,14,3,8,14,7,
+24,96,159,15,1,104,15,1,15,15,0,25,96,14,18,23,96,0,3,0,63,225,63,225,17,
+57,47,93,93,225,57,1,47,94,93,113,225,50,16,222,225,18,57,47,57,93,225,49,
+48,19,33,32,22,21,20,6,7,21,4,17,20,6,35,33,19,33,50,54,53,52,38,35,33,17,
+17,33,32,17,52,33,135,1,184,1,18,247,157,134,1,76,255,220,253,241,187,1,28,
+156,143,153,166,254,248,1,51,1,55,254,188,5,182,175,195,128,170,18,10,54,
+254,224,198,226,3,74,110,127,120,104,253,151,253,240,1,18,254,0,1,0,129,255,
+236,4,156,5,203,0,21,0,49,64,28,1,64,20,24,72,1,1,6,11,23,17,91,0,6,240,6,
+2,6,12,14,95,9,4,0,20,95,3,19,0,63,225,50,63,225,50,1,47,93,225,16,206,17,
+57,47,43,49,48,37,21,6,35,32,0,17,16,0,33,50,23,7,38,35,34,0,17,16,18,51,
+50,4,100,146,212,254,203,254,184,1,102,1,54,220,163,78,154,151,215,255,0,
+240,231,130,201,162,59,1,136,1,105,1,90,1,148,86,156,78,254,195,254,241,254,
+225,254,211,0,2,0,135,0,0,4,123,5,182,0,8,0,15,0,44,64,26,13,91,5,17,10,90,
+0,0,1,0,0,16,0,240,0,3,8,0,9,96,1,3,10,96,0,18,0,63,225,63,225,1,47,94,93,
+113,225,16,222,225,49,48,51,17,33,32,0,17,16,0,33,3,17,51,32,17,16,33,135,
+1,86,1,61,1,97,254,146,254,167,114,96,2,20,254,19,5,182,254,134,254,173,254,
+151,254,128,5,23,251,137,2,67,2,52,0,0,1,0,217,0,0,4,35,5,182,0,11,0,64,64,
+37,8,8,1,4,0,64,18,22,72,0,13,6,10,90,240,1,1,0,1,1,1,9,95,104,6,1,6,6,10,
+5,95,2,3,10,95,1,18,0,63,225,63,225,18,57,47,93,225,1,47,93,93,225,50,16,
+206,43,50,17,57,47,49,48,33,33,17,33,21,33,17,33,21,33,17,33,4,35,252,182,
+3,74,253,112,2,105,253,151,2,144,5,182,164,254,60,162,253,248,0,1,0,244,0,
+0,4,61,5,182,0,9,0,87,64,22,8,8,1,223,3,1,192,3,1,3,11,6,0,90,0,1,64,1,80,
+1,3,1,184,255,192,64,32,21,24,72,1,9,95,104,6,1,47,6,95,6,239,6,255,6,4,6,
+64,16,21,72,6,6,0,5,95,2,3,0,18,0,63,63,225,18,57,47,43,93,93,225,1,47,43,
+93,225,50,16,206,93,93,17,57,47,48,49,33,35,17,33,21,33,17,33,21,33,1,174,
+186,3,73,253,113,2,105,253,151,5,182,164,253,252,164,0,1,0,117,255,236,4,
+70,5,203,0,24,0,63,64,37,0,7,22,90,12,2,26,18,91,0,7,1,7,24,95,47,0,95,0,
+2,0,64,16,24,72,0,0,20,15,95,13,10,4,20,95,4,19,0,63,225,63,51,225,18,57,
+47,43,93,225,1,47,93,225,16,222,50,225,18,57,49,48,1,33,17,6,35,32,0,17,16,
+0,33,50,23,7,38,35,34,2,17,16,33,50,55,17,35,2,160,1,166,195,225,254,250,
+254,217,1,68,1,28,192,154,72,146,134,192,214,1,138,97,105,237,3,4,253,51,
+75,1,143,1,98,1,95,1,143,86,162,84,254,201,254,235,253,180,29,1,180,0,0,1,
+0,135,0,0,4,70,5,182,0,11,0,63,64,38,9,1,90,0,13,8,4,90,16,5,32,5,2,32,5,
+48,5,2,5,3,95,152,8,1,15,8,47,8,2,6,8,8,10,6,3,5,0,18,0,63,50,63,51,57,47,
+94,93,93,225,1,47,93,113,225,50,16,222,225,50,49,48,33,35,17,33,17,35,17,
+51,17,33,17,51,4,70,187,253,183,187,187,2,73,187,2,170,253,86,5,182,253,152,
+2,104,0,0,1,0,225,0,0,3,233,5,182,0,11,0,67,64,40,11,8,10,90,5,2,208,3,1,
+162,3,1,147,3,1,3,142,3,1,4,99,3,1,5,16,3,80,3,2,3,9,4,97,6,3,3,10,97,0,18,
+0,63,225,50,63,225,50,1,47,93,95,93,95,93,95,93,93,93,51,51,225,50,50,49,
+48,33,33,53,37,17,37,53,33,21,5,17,5,3,233,252,248,1,39,254,217,3,8,254,218,
+1,38,123,20,4,152,20,123,123,20,251,104,20,0,1,0,137,255,236,3,211,5,182,
+0,13,0,43,178,6,90,9,184,255,192,64,20,9,12,72,9,15,0,0,224,0,240,0,3,0,3,
+95,1,12,19,7,3,0,63,63,51,225,1,47,93,16,222,43,225,49,48,55,53,22,51,50,
+54,53,17,51,17,20,4,35,34,137,162,147,161,186,186,254,231,237,217,39,166,
+62,159,147,3,245,252,13,216,255,0,1,0,211,0,0,4,174,5,182,0,12,0,201,183,
+38,12,54,12,70,12,3,12,184,255,240,64,137,16,24,72,248,10,1,217,10,233,10,
+2,200,10,1,185,10,1,168,10,1,137,10,1,10,8,12,16,72,121,9,1,88,9,1,25,9,1,
+10,9,1,136,1,1,1,8,20,24,72,1,8,12,15,72,232,2,1,2,16,11,22,72,71,2,1,2,12,
+0,8,4,90,0,5,96,5,112,5,128,5,4,5,11,16,11,11,208,0,240,0,2,127,0,1,0,0,16,
+0,64,0,96,0,4,0,16,0,166,8,182,8,198,8,3,119,8,135,8,2,38,8,54,8,86,8,102,
+8,4,3,2,8,12,4,5,10,6,3,5,0,18,0,63,50,63,51,18,23,57,93,93,93,1,47,56,93,
+93,93,51,47,56,47,93,225,50,17,57,57,93,49,48,0,43,93,1,43,43,93,93,93,93,
+93,43,93,93,93,93,93,93,43,93,33,35,1,7,17,35,17,51,17,55,1,51,1,4,174,211,
+254,62,140,186,186,121,1,197,209,253,247,2,186,114,253,184,5,182,253,37,168,
+2,51,253,131,0,1,0,233,0,0,4,31,5,182,0,5,0,46,64,31,5,64,18,22,72,5,7,3,
+90,0,0,80,0,96,0,112,0,208,0,224,0,240,0,7,0,1,3,3,95,0,18,0,63,225,63,1,
+47,93,225,16,206,43,49,48,51,17,51,17,33,21,233,187,2,123,5,182,250,240,166,
+0,0,1,0,113,0,0,4,92,5,182,0,19,0,182,64,12,247,19,1,182,19,1,151,19,167,
+19,2,19,184,255,240,64,37,13,17,72,39,19,1,6,19,22,19,2,233,11,249,11,2,11,
+32,13,22,72,58,11,1,9,11,25,11,41,11,3,230,8,246,8,2,8,184,255,224,64,77,
+13,22,72,53,8,1,6,8,22,8,38,8,3,248,0,1,185,0,1,152,0,168,0,2,0,16,13,17,
+72,40,0,1,9,0,25,0,2,17,14,250,224,13,240,13,2,15,13,1,13,21,2,5,250,0,6,
+16,6,64,6,80,6,4,6,11,1,7,3,18,2,14,89,9,1,9,6,0,18,0,63,50,50,93,50,46,51,
+63,51,51,1,47,93,225,50,16,222,93,93,225,50,49,48,93,93,43,93,93,93,93,93,
+43,93,93,93,43,93,93,93,43,93,93,93,33,1,35,18,21,17,35,17,51,19,51,19,51,
+17,35,17,52,19,35,1,2,20,254,234,8,18,151,247,248,6,250,252,153,14,8,254,
+229,5,0,254,246,140,252,150,5,182,251,88,4,168,250,74,3,119,102,1,33,251,
+2,0,0,1,0,135,0,0,4,68,5,182,0,15,0,115,185,0,9,255,240,64,78,16,24,72,69,
+9,85,9,101,9,3,52,9,1,21,9,37,9,2,6,9,1,1,16,16,24,72,74,1,90,1,106,1,3,59,
+1,1,26,1,42,1,2,9,1,1,1,14,251,15,17,9,6,251,0,7,224,7,240,7,3,7,14,73,2,
+89,2,2,2,8,3,70,10,86,10,2,10,7,0,18,0,63,50,50,93,63,51,93,51,1,47,93,225,
+50,16,222,225,50,49,48,93,93,93,93,43,93,93,93,93,43,33,35,1,35,18,21,17,
+35,17,51,1,51,2,53,17,51,4,68,215,253,188,8,18,172,213,2,66,6,14,174,4,186,
+254,235,140,252,231,5,182,251,76,1,47,101,3,32,0,0,2,0,84,255,236,4,123,5,
+205,0,9,0,19,0,36,64,20,13,91,7,21,18,91,31,2,47,2,2,2,16,95,4,4,10,95,0,
+19,0,63,225,63,225,1,47,93,225,16,222,225,49,48,5,32,17,16,33,32,0,17,16,
+0,39,50,18,17,16,2,35,32,17,16,2,104,253,236,2,22,1,0,1,17,254,236,255,173,
+161,163,169,254,175,20,2,243,2,238,254,121,254,151,254,151,254,120,163,1,
+34,1,44,1,47,1,29,253,180,253,178,0,0,2,0,176,0,0,4,70,5,182,0,9,0,17,0,56,
+64,34,14,91,239,6,255,6,2,6,19,10,1,90,0,2,144,2,160,2,3,2,0,96,159,10,1,
+10,10,1,17,96,3,3,1,18,0,63,63,225,18,57,47,93,225,1,47,93,225,50,16,222,
+93,225,49,48,1,17,35,17,33,32,17,20,4,33,39,51,50,54,53,16,33,35,1,106,186,
+1,148,2,2,254,235,254,248,191,170,198,171,254,174,201,2,57,253,199,5,182,
+254,84,219,246,158,144,153,1,23,0,0,2,0,84,254,98,4,123,5,205,0,15,0,25,0,
+85,185,0,0,255,240,64,48,13,17,72,5,0,9,19,91,14,108,3,124,3,140,3,3,3,24,
+11,14,72,3,2,2,14,27,24,91,31,9,47,9,2,9,22,95,11,4,16,95,7,5,7,3,3,0,7,19,
+0,63,51,51,47,17,51,16,225,63,225,1,47,93,225,16,206,50,47,51,43,93,16,225,
+18,57,57,49,48,43,37,22,23,7,38,39,6,35,32,17,16,33,32,0,17,16,5,50,18,17,
+16,2,35,32,17,16,3,94,85,194,121,236,92,36,40,253,236,2,22,1,0,1,17,253,237,
+173,161,163,169,254,175,39,180,131,142,171,229,6,2,243,2,238,254,121,254,
+151,253,242,64,1,34,1,44,1,47,1,29,253,180,253,178,0,2,0,186,0,0,4,147,5,
+182,0,11,0,20,0,115,64,75,43,14,1,26,14,1,11,8,16,24,72,41,11,1,24,11,1,10,
+8,18,24,72,41,10,1,8,10,1,10,9,16,9,9,70,8,1,11,8,1,16,91,6,64,19,22,72,6,
+22,12,1,90,0,2,128,2,144,2,160,2,4,2,8,3,0,96,12,12,1,20,96,3,3,10,1,18,0,
+63,51,63,225,18,57,47,225,17,57,1,47,93,225,50,16,222,43,225,18,57,57,93,
+51,47,56,51,49,48,93,93,43,93,93,43,93,93,1,17,35,17,33,32,17,16,5,1,35,1,
+39,51,50,54,53,52,38,35,35,1,117,187,1,101,2,8,254,223,1,141,219,254,162,
+229,164,171,162,160,178,159,2,92,253,164,5,182,254,97,254,225,105,253,113,
+2,92,158,132,144,141,124,0,0,1,0,141,255,236,4,63,5,203,0,31,0,56,64,31,16,
+16,5,90,176,27,192,27,2,27,33,21,90,11,0,0,0,11,1,11,21,5,14,3,96,30,19,19,
+95,14,4,0,63,225,63,225,18,57,57,1,47,93,51,47,16,225,16,222,93,225,51,47,
+49,48,55,53,22,51,32,53,52,38,39,38,38,53,52,36,51,50,23,7,38,35,32,21,20,
+22,23,22,22,21,20,4,35,32,141,211,203,1,94,141,215,208,181,1,1,224,229,187,
+64,193,167,254,219,131,205,246,165,254,235,255,254,247,49,178,86,240,104,
+112,77,73,203,162,174,197,78,164,78,209,102,124,71,88,187,147,192,219,0,1,
+0,102,0,0,4,100,5,182,0,7,0,60,64,36,6,6,0,90,3,208,1,1,162,1,1,147,1,1,3,
+142,1,1,4,99,1,1,5,16,1,80,1,2,1,7,3,95,4,3,0,18,0,63,63,225,50,1,47,93,95,
+93,95,93,95,93,93,93,198,241,194,47,49,48,33,35,17,33,53,33,21,33,2,195,187,
+254,94,3,254,254,95,5,18,164,164,0,0,1,0,125,255,236,4,80,5,184,0,14,0,39,
+64,22,13,90,224,1,240,1,2,1,16,9,90,0,6,1,6,11,95,4,19,7,0,3,0,63,50,63,225,
+1,47,93,225,16,222,93,225,49,48,1,17,16,2,35,32,17,17,51,17,16,33,32,19,17,
+4,80,252,244,254,29,186,1,51,1,39,5,5,184,252,76,254,252,254,236,2,28,3,174,
+252,92,254,125,1,133,3,164,0,1,0,33,0,0,4,172,5,182,0,10,0,153,64,24,103,
+5,1,184,3,1,3,8,13,17,72,41,3,1,24,3,1,9,3,1,183,2,1,2,184,255,248,64,59,
+13,17,72,38,2,1,23,2,1,6,2,1,104,0,1,232,3,1,3,231,2,1,2,8,8,4,72,0,88,0,
+2,42,0,1,9,0,25,0,2,0,1,1,12,71,5,87,5,2,37,5,1,6,5,22,5,2,5,4,8,184,255,
+240,64,14,11,24,72,18,8,1,8,3,1,4,3,2,3,18,0,63,51,63,51,18,57,93,43,1,47,
+51,93,93,93,17,51,47,51,93,93,93,18,57,61,47,51,93,51,93,49,48,93,93,93,93,
+43,93,93,93,93,43,93,93,1,51,1,35,1,51,1,22,23,54,55,3,229,199,254,23,187,
+254,25,196,1,39,41,47,31,62,5,182,250,74,5,182,252,97,127,207,145,195,0,0,
+1,0,2,0,0,4,203,5,182,0,25,1,99,64,84,41,25,57,25,2,8,25,24,25,2,39,21,1,
+21,21,1,6,21,1,7,20,23,20,39,20,3,38,16,54,16,2,41,10,57,10,2,40,6,1,25,6,
+1,8,6,1,38,2,54,2,2,7,2,23,2,2,72,17,104,17,168,17,184,17,4,41,17,57,17,2,
+17,231,16,247,16,2,198,16,214,16,2,180,16,1,16,184,255,240,64,33,15,19,72,
+84,16,1,69,16,1,16,23,230,1,1,199,1,215,1,2,165,1,181,1,2,150,1,1,119,1,135,
+1,2,1,184,255,240,64,140,9,15,72,1,233,0,1,200,0,216,0,2,170,0,186,0,2,153,
+0,1,120,0,136,0,2,0,16,9,15,72,0,13,232,10,248,10,2,201,10,217,10,2,187,10,
+1,136,10,168,10,2,105,10,121,10,2,91,10,1,74,10,1,10,103,9,167,9,183,9,3,
+38,9,54,9,70,9,3,9,4,36,23,52,23,148,23,164,23,4,4,4,20,4,100,4,196,4,212,
+4,5,23,13,4,4,13,23,3,18,40,7,1,7,16,8,1,8,8,27,39,19,1,19,18,4,23,75,13,
+91,13,2,13,23,17,0,0,7,10,17,18,18,7,3,0,63,51,63,51,18,57,47,18,57,57,93,
+17,51,1,47,51,93,17,51,47,93,51,93,18,23,57,61,47,47,47,93,93,17,51,93,93,
+51,93,93,93,93,93,93,93,17,51,43,93,93,93,93,93,51,43,93,93,93,93,93,17,51,
+93,93,43,93,93,93,51,93,93,49,48,93,93,93,93,93,93,93,93,93,93,93,93,93,1,
+51,19,22,23,54,19,19,51,3,35,3,38,39,6,7,3,35,3,51,19,22,18,21,54,55,2,16,
+177,145,61,11,2,63,70,170,187,190,168,40,26,32,33,156,190,203,170,88,23,34,
+24,46,3,240,253,247,219,88,53,2,54,2,151,250,74,2,68,138,144,173,111,253,
+190,5,182,253,105,176,254,108,39,151,161,0,1,0,53,0,0,4,150,5,182,0,11,0,
+190,64,36,8,8,9,11,11,10,0,7,0,5,5,4,2,2,3,1,6,1,8,8,7,5,5,6,4,9,4,11,11,
+0,2,2,1,3,10,7,184,255,248,64,23,12,15,72,6,7,22,7,38,7,3,9,8,12,15,72,9,
+9,25,9,41,9,3,3,184,255,248,64,60,12,15,72,6,3,22,3,38,3,3,1,8,12,15,72,9,
+1,25,1,41,1,3,11,8,2,5,4,4,9,10,1,10,175,0,1,0,0,13,7,6,3,6,4,2,5,11,8,4,
+7,9,10,3,6,3,1,3,4,3,0,18,0,63,23,50,63,23,51,23,57,1,47,51,51,47,51,17,51,
+47,93,50,50,47,51,17,23,57,93,43,93,43,93,43,93,43,49,48,135,8,192,8,192,
+16,135,8,192,8,192,16,135,8,192,8,192,16,135,8,192,8,192,33,35,1,1,35,1,1,
+51,1,1,51,1,4,150,211,254,157,254,146,189,1,197,254,90,199,1,75,1,78,191,
+254,90,2,123,253,133,2,252,2,186,253,209,2,47,253,76,0,1,0,33,0,0,4,170,5,
+182,0,8,0,181,185,0,8,255,248,64,36,13,16,72,38,8,54,8,2,23,8,1,104,1,120,
+1,2,90,1,1,72,1,1,41,1,57,1,2,24,1,1,39,0,183,0,2,0,184,255,248,179,13,17,
+72,8,184,255,248,64,74,20,24,72,8,175,7,255,7,2,89,7,1,7,5,1,8,20,24,72,1,
+224,2,240,2,2,123,2,1,80,2,1,2,2,0,4,90,208,5,1,162,5,1,147,5,1,3,142,5,1,
+4,99,5,1,5,16,5,80,5,2,5,6,6,52,0,1,0,3,3,1,4,18,7,1,3,0,63,51,63,18,57,47,
+51,93,51,47,1,47,93,95,93,95,93,95,93,93,93,241,57,194,47,93,93,93,50,43,
+16,198,93,93,50,43,49,48,0,43,93,1,93,93,93,93,93,93,93,43,1,1,51,1,17,35,
+17,1,51,2,100,1,125,201,254,25,187,254,25,203,2,211,2,227,252,131,253,199,
+2,47,3,135,0,0,1,0,102,0,0,4,100,5,182,0,9,0,68,64,40,38,8,1,7,8,23,8,2,41,
+3,1,8,3,24,3,2,3,7,7,0,0,1,0,0,11,8,2,4,4,2,7,4,95,5,3,2,8,95,1,18,0,63,225,
+50,63,225,50,1,47,51,47,17,51,17,51,47,93,51,47,51,49,48,93,93,93,93,33,33,
+53,1,33,53,33,21,1,33,4,100,252,2,3,25,252,252,3,213,252,231,3,45,145,4,127,
+166,145,251,129,0,0,1,1,156,254,188,3,172,5,182,0,7,0,51,64,32,4,0,0,1,0,
+0,9,6,241,127,1,143,1,191,1,207,1,223,1,5,0,1,1,1,5,245,2,248,6,245,1,249,
+0,63,225,63,225,1,47,93,93,225,17,51,47,93,51,49,48,1,33,17,33,21,33,17,33,
+3,172,253,240,2,16,254,166,1,90,254,188,6,250,149,250,49,0,1,0,211,0,0,3,
+248,5,182,0,3,0,28,64,12,2,1,1,5,0,3,3,4,2,18,0,3,0,63,63,17,1,51,47,51,17,
+51,47,51,49,48,1,1,35,1,1,133,2,115,178,253,141,5,182,250,74,5,182,0,0,1,
+1,33,254,188,3,49,5,182,0,7,0,52,183,1,241,112,6,128,6,2,6,184,255,192,64,
+21,20,24,72,6,6,9,3,224,0,240,0,2,0,1,245,6,249,2,245,5,248,0,63,225,63,225,
+1,47,93,51,17,51,47,43,93,225,49,48,5,33,17,33,53,33,17,33,1,33,1,90,254,
+166,2,16,253,240,174,5,207,149,249,6,0,1,0,111,2,37,4,94,5,193,0,6,0,51,64,
+25,2,1,5,32,20,24,72,5,5,0,4,3,8,6,0,0,7,4,0,0,5,15,1,1,1,0,47,93,51,51,47,
+50,17,1,51,47,50,16,206,50,17,57,61,47,43,51,51,49,48,19,1,51,1,35,1,1,111,
+1,168,102,1,225,162,254,144,254,194,2,37,3,156,252,100,2,223,253,33,0,0,1,
+255,240,254,188,4,219,255,72,0,3,0,18,182,0,0,5,1,1,186,2,0,47,225,1,47,17,
+51,47,49,48,1,33,53,33,4,219,251,21,4,235,254,188,140,0,0,1,1,162,4,217,3,
+43,6,33,0,7,0,31,64,16,5,135,4,134,1,0,0,9,5,146,15,1,95,1,2,1,0,47,93,237,
+17,1,51,47,51,253,225,49,48,1,35,38,39,53,51,22,23,3,43,121,166,106,219,86,
+88,4,217,142,165,21,178,123,0,2,0,135,255,236,4,2,4,94,0,23,0,33,0,66,64,
+38,11,1,33,71,143,23,159,23,2,23,35,28,72,17,0,8,16,8,2,8,8,24,82,11,11,30,
+16,14,80,19,16,1,30,78,5,22,0,21,0,63,63,225,50,63,225,51,18,57,47,225,1,
+47,94,93,51,225,16,222,93,225,50,50,49,48,33,39,35,6,6,35,34,38,53,16,37,
+55,53,52,35,34,7,39,54,51,50,22,21,17,3,7,6,6,21,20,51,50,54,53,3,127,37,
+8,77,162,128,163,185,1,254,203,244,147,181,63,196,187,227,203,180,162,196,
+164,200,147,175,152,97,75,172,155,1,76,16,7,69,236,82,137,96,174,192,253,
+16,2,25,7,8,107,110,178,163,148,0,2,0,158,255,236,4,68,6,20,0,18,0,28,0,58,
+64,34,24,72,239,14,255,14,2,14,30,1,8,6,19,71,0,3,176,3,2,3,1,22,80,17,22,
+8,26,80,11,16,4,0,3,21,0,63,63,63,225,50,63,225,50,1,47,93,225,50,50,57,16,
+222,93,225,49,48,37,35,7,35,17,51,17,20,7,51,54,51,50,18,17,16,2,35,34,3,
+20,22,51,32,17,16,33,34,6,1,84,12,37,133,182,8,8,107,215,201,229,230,200,
+207,115,139,152,1,16,254,238,155,134,139,139,6,20,254,136,81,145,164,254,
+213,254,244,254,242,254,211,2,59,227,193,1,166,1,158,188,0,0,1,0,172,255,
+236,4,37,4,94,0,19,0,43,64,23,0,0,143,9,1,9,21,5,72,0,15,1,15,3,81,1,18,16,
+9,7,81,12,22,0,63,225,51,63,51,225,1,47,93,225,16,206,93,50,47,49,48,1,7,
+38,35,32,17,16,33,50,55,21,6,35,32,0,17,16,0,33,50,4,37,62,150,118,254,141,
+1,105,157,164,134,195,254,255,254,228,1,34,1,7,178,4,35,158,57,254,99,254,
+106,62,160,61,1,35,1,16,1,25,1,38,0,2,0,137,255,236,4,47,6,20,0,18,0,29,0,
+58,64,35,20,0,14,71,144,17,160,17,2,17,31,25,72,0,6,224,6,240,6,3,6,15,0,
+11,23,80,9,16,1,27,80,3,22,18,21,0,63,63,225,50,63,225,50,63,1,47,93,225,
+16,222,93,225,50,50,49,48,37,35,6,35,34,2,17,16,18,51,50,23,51,38,53,17,51,
+17,35,3,53,52,38,35,32,17,16,33,50,54,3,129,8,113,209,201,229,230,200,206,
+116,12,12,182,147,35,139,152,254,240,1,18,152,133,147,167,1,43,1,12,1,14,
+1,45,160,129,33,1,180,249,236,1,250,41,227,193,254,90,254,98,177,0,0,2,0,
+133,255,236,4,72,4,94,0,17,0,22,0,71,64,44,19,72,5,15,0,31,0,2,0,24,18,1,
+72,0,11,16,11,2,16,11,32,11,2,11,1,80,15,18,31,18,2,7,18,18,3,21,80,14,16,
+3,81,5,8,22,0,63,51,225,63,225,18,57,47,94,93,225,1,47,93,113,225,50,16,222,
+113,50,225,49,48,1,33,18,33,50,55,21,6,35,34,0,17,16,0,51,50,18,21,37,33,
+16,33,32,4,72,252,250,8,1,80,195,175,166,198,245,254,218,1,15,227,212,253,
+252,254,2,61,254,240,254,237,2,2,254,137,76,160,75,1,43,1,6,1,10,1,55,254,
+244,223,35,1,49,0,1,0,156,0,0,4,90,6,31,0,21,0,70,64,40,0,0,13,13,23,20,2,
+71,3,7,3,143,5,239,5,2,5,5,0,3,176,3,240,3,3,3,4,1,78,7,6,20,15,16,80,14,
+11,1,2,21,0,63,63,51,225,63,51,51,225,50,1,47,93,51,47,93,17,51,16,225,50,
+17,51,47,57,47,49,48,1,33,17,35,17,33,53,37,53,52,54,51,50,23,7,38,35,34,
+6,21,21,33,4,20,254,123,182,254,195,1,61,180,209,129,123,41,104,103,123,88,
+1,133,3,193,252,63,3,193,110,33,96,193,174,35,143,28,100,115,104,0,0,3,0,
+102,254,20,4,102,4,94,0,36,0,44,0,54,0,128,64,47,52,17,17,2,36,9,28,4,31,
+39,70,1,95,4,223,4,239,4,255,4,4,4,56,11,26,26,31,48,63,22,79,22,95,22,3,
+22,22,43,70,128,31,144,31,160,31,3,31,184,255,192,64,29,6,9,72,31,28,4,34,
+37,82,7,7,46,41,79,34,24,46,81,13,13,34,16,50,78,19,27,2,0,15,0,63,50,63,
+225,63,57,47,225,50,16,225,17,57,47,225,18,57,57,1,47,43,93,225,51,47,93,
+193,17,51,47,193,16,222,93,50,225,18,23,57,51,47,193,49,48,1,21,7,22,21,20,
+6,35,34,39,6,21,20,51,51,50,22,21,16,33,34,38,53,52,55,38,53,52,55,38,38,
+53,52,54,51,50,23,3,50,53,52,35,34,21,20,1,35,34,21,20,33,32,53,52,38,4,102,
+196,65,213,190,55,31,100,161,187,174,184,253,203,218,227,240,96,133,89,102,
+213,197,86,64,154,223,225,225,1,69,188,230,1,15,1,139,100,4,74,113,27,85,
+128,161,191,6,56,77,84,154,143,254,135,161,145,212,58,47,107,112,80,37,171,
+101,182,197,20,253,188,230,239,242,227,254,12,198,174,223,88,61,0,0,1,0,160,
+0,0,4,45,6,20,0,17,0,60,64,38,36,15,52,15,2,0,71,176,17,192,17,2,17,19,10,
+6,71,0,7,16,7,32,7,208,7,4,7,7,4,3,80,14,16,8,0,7,0,21,0,63,50,63,63,225,
+50,1,47,94,93,225,50,16,222,93,225,49,48,93,33,17,16,35,32,17,17,35,17,51,
+17,7,51,54,51,32,17,17,3,119,238,254,205,182,182,8,10,103,233,1,133,2,195,
+1,4,254,114,253,199,6,20,254,50,144,168,254,111,253,51,0,0,2,0,197,0,0,4,
+51,6,14,0,8,0,18,0,51,64,28,14,2,13,71,7,10,17,3,86,18,1,18,18,20,19,13,18,
+78,16,21,9,78,11,15,5,83,0,0,0,63,237,63,225,63,225,50,17,18,1,57,47,93,23,
+51,225,50,50,49,48,1,50,21,20,6,35,34,53,52,19,37,53,33,17,5,21,33,53,37,
+2,121,106,63,43,107,15,254,243,1,195,1,96,252,146,1,88,6,14,114,58,57,115,
+114,253,172,21,123,252,69,20,123,123,20,0,2,0,135,254,20,3,86,6,14,0,7,0,
+23,0,57,64,32,16,8,6,14,71,2,144,19,160,19,2,19,19,25,24,0,8,1,8,11,80,9,
+22,27,15,78,18,15,4,83,0,0,0,63,229,63,225,63,51,225,1,47,93,17,18,57,47,
+93,51,225,50,17,57,49,48,1,50,21,20,35,34,53,52,1,53,22,51,50,54,53,17,37,
+53,33,17,20,6,35,34,2,231,107,107,106,254,10,134,155,117,131,254,92,2,90,
+226,206,164,6,14,114,115,115,114,248,41,154,39,114,101,4,57,21,123,251,65,
+180,195,0,0,1,0,215,0,0,4,139,6,20,0,14,0,118,64,11,25,6,41,6,57,6,3,8,6,
+1,4,184,255,224,64,62,16,20,72,70,4,86,4,2,9,2,1,9,1,1,27,7,43,7,59,7,3,4,
+7,2,3,3,6,5,32,16,19,72,0,5,96,5,2,5,5,16,12,0,9,71,0,10,96,10,2,10,11,0,
+4,7,0,7,2,10,5,21,2,15,0,63,63,51,18,57,57,17,51,63,1,47,93,225,50,50,17,
+51,47,93,43,51,51,47,51,57,57,49,48,0,93,1,93,93,93,43,93,93,1,55,1,51,1,
+1,35,1,7,17,35,17,51,17,3,1,127,135,1,139,222,254,18,2,10,213,254,86,129,
+180,180,16,2,41,152,1,137,254,37,253,145,1,248,82,254,90,6,20,253,54,254,
+223,0,1,0,188,0,0,4,43,6,20,0,9,0,45,64,24,5,4,71,8,1,93,9,1,79,9,1,9,9,11,
+10,9,4,78,6,21,0,78,2,0,0,63,225,63,225,50,17,18,1,57,47,93,93,51,51,225,
+50,49,48,1,37,53,33,17,5,21,33,53,37,2,20,254,244,1,195,1,96,252,145,1,88,
+5,133,21,122,250,123,20,123,123,20,0,0,1,0,92,0,0,4,115,4,94,0,32,0,107,64,
+69,25,133,8,1,118,8,1,101,8,1,86,8,1,55,8,71,8,2,8,71,139,9,1,122,9,1,9,9,
+17,0,71,144,32,160,32,192,32,208,32,4,15,32,1,32,34,20,16,71,64,17,80,17,
+2,17,26,20,17,4,12,80,28,23,16,18,15,17,9,0,21,0,63,50,50,63,63,51,225,50,
+18,57,57,1,47,93,225,50,16,222,93,93,225,17,57,47,93,93,225,93,93,93,93,93,
+50,49,48,33,17,52,38,35,34,6,21,17,35,17,16,35,34,6,21,17,35,17,51,23,51,
+54,51,50,23,51,54,51,50,22,21,17,3,209,53,62,87,79,161,125,84,72,162,127,
+27,10,67,134,163,50,6,76,143,128,116,2,195,146,114,166,195,253,162,2,195,
+1,4,159,239,253,199,4,74,148,168,182,182,185,216,253,51,0,0,1,0,160,0,0,4,
+45,4,94,0,16,0,54,64,33,0,71,176,16,192,16,2,16,18,10,6,71,0,7,16,7,32,7,
+208,7,4,7,7,11,3,80,13,16,8,15,7,0,21,0,63,50,63,63,225,50,1,47,94,93,225,
+50,16,222,93,225,49,48,33,17,16,35,32,17,17,35,17,51,23,51,54,51,32,17,17,
+3,119,238,254,205,182,147,27,10,103,233,1,133,2,195,1,4,254,114,253,199,4,
+74,148,168,254,111,253,51,0,2,0,115,255,236,4,88,4,94,0,11,0,19,0,34,64,18,
+14,72,9,21,18,72,0,3,1,3,16,80,6,16,12,80,0,22,0,63,225,63,225,1,47,93,225,
+16,222,225,49,48,5,34,0,17,16,0,51,50,0,17,16,0,39,32,17,16,33,32,17,16,2,
+98,216,254,233,1,15,230,218,1,22,254,238,224,1,54,254,200,254,203,20,1,55,
+1,4,1,7,1,48,254,202,254,255,254,247,254,206,151,1,164,1,160,254,96,254,92,
+0,2,0,158,254,20,4,68,4,94,0,18,0,29,0,62,64,38,25,72,15,14,31,14,2,14,31,
+20,1,4,71,0,5,16,5,32,5,208,5,4,7,5,0,23,80,17,22,8,27,80,11,16,6,15,4,27,
+0,63,63,63,225,50,63,225,50,1,47,94,93,225,50,50,16,222,113,225,49,48,37,
+35,22,21,17,35,17,51,23,51,54,51,50,18,17,16,2,35,34,3,21,20,22,51,32,17,
+16,33,34,6,1,84,12,12,182,147,27,8,110,212,201,229,230,200,207,115,139,152,
+1,16,254,238,152,133,139,129,33,254,43,6,54,148,168,254,213,254,244,254,242,
+254,211,2,100,41,227,193,1,166,1,158,176,0,0,2,0,137,254,20,4,47,4,94,0,18,
+0,29,0,60,64,37,1,8,19,3,5,71,144,4,160,4,2,4,31,25,72,0,14,224,14,240,14,
+3,14,8,27,80,11,22,4,27,1,23,80,17,16,2,15,0,63,63,225,50,63,63,225,50,1,
+47,93,225,16,222,93,225,23,50,49,48,1,51,55,51,17,35,17,52,55,35,6,35,34,
+2,17,16,18,51,50,19,53,52,38,35,32,17,16,33,50,54,3,121,8,27,147,182,12,12,
+113,209,201,229,230,200,207,115,139,152,254,240,1,18,152,133,3,182,148,249,
+202,1,213,41,129,167,1,43,1,12,1,14,1,45,253,156,41,227,193,254,90,254,98,
+177,0,1,1,8,0,0,4,35,4,94,0,16,0,49,64,27,144,0,1,0,0,18,11,7,71,47,8,1,0,
+8,1,8,11,7,3,81,1,15,16,9,15,7,21,0,63,63,63,51,225,18,57,1,47,93,93,225,
+50,17,51,47,93,49,48,1,7,38,35,34,6,21,17,35,17,51,23,51,54,54,51,50,4,35,
+49,123,101,163,177,182,148,22,8,76,174,127,118,4,49,166,45,185,175,253,176,
+4,74,201,119,102,0,1,0,203,255,236,4,2,4,94,0,31,0,60,64,34,16,16,5,70,27,
+33,21,70,11,0,0,0,11,80,11,96,11,240,11,4,11,21,5,14,3,80,1,30,22,19,80,17,
+14,16,0,63,51,225,63,51,225,18,57,57,1,47,93,51,47,16,225,16,222,225,51,47,
+49,48,55,53,22,51,32,53,52,38,39,38,38,53,52,54,51,50,23,7,38,35,34,21,20,
+22,23,22,22,21,20,6,35,34,203,193,177,1,19,98,177,233,121,223,197,198,171,
+60,182,137,236,101,182,211,139,234,214,248,49,166,86,162,57,84,64,87,145,
+99,136,155,74,149,72,133,61,73,65,77,149,108,150,171,0,1,0,139,255,236,4,
+2,5,111,0,19,0,89,64,55,12,16,71,5,9,5,32,7,1,7,7,47,5,63,5,127,5,143,5,207,
+5,223,5,6,0,5,1,5,5,20,21,14,14,127,1,143,1,175,1,3,1,21,6,15,78,11,9,8,12,
+15,18,80,0,3,22,0,63,51,225,63,51,51,51,225,50,1,16,206,93,50,47,17,18,57,
+47,93,93,51,47,93,17,51,16,225,50,49,48,37,21,6,35,32,17,17,33,53,37,19,51,
+17,33,21,33,17,20,51,50,3,252,130,122,254,150,254,245,1,11,77,105,1,182,254,
+74,192,93,150,138,32,1,88,2,125,94,49,1,31,254,219,137,253,131,195,0,1,0,
+160,255,236,4,45,4,74,0,17,0,48,64,28,1,14,71,144,17,160,17,2,17,19,9,71,
+0,6,176,6,2,6,15,7,15,1,11,80,4,22,0,21,0,63,63,225,50,63,51,1,47,93,225,
+16,222,93,225,50,49,48,33,39,35,6,35,32,17,17,51,17,16,51,50,54,53,17,51,
+17,3,154,27,10,105,229,254,121,182,236,161,148,182,147,167,1,145,2,205,253,
+61,254,252,185,212,2,58,251,182,0,0,1,0,82,0,0,4,121,4,74,0,11,0,115,64,56,
+38,11,1,41,0,1,55,11,103,11,231,11,247,11,4,6,11,22,11,2,11,56,0,104,0,232,
+0,248,0,4,9,0,25,0,2,0,5,5,1,9,8,9,12,72,9,16,10,32,10,48,10,3,10,10,13,2,
+184,255,248,64,21,9,12,72,2,47,1,63,1,2,1,70,5,86,5,2,5,9,1,15,0,21,0,63,
+63,51,57,93,1,47,93,51,43,17,51,47,93,51,43,18,57,61,47,51,93,93,51,93,93,
+49,48,93,93,33,1,51,19,22,23,51,54,19,19,51,1,1,242,254,96,188,240,85,15,
+6,7,94,239,189,254,96,4,74,253,116,231,94,44,1,25,2,140,251,182,0,0,1,255,
+252,0,0,4,209,4,74,0,25,1,43,185,0,25,255,240,182,20,24,72,167,25,1,25,184,
+255,240,64,24,13,18,72,9,22,25,22,41,22,3,41,21,1,39,17,87,17,2,6,17,22,17,
+2,16,184,255,240,64,66,13,24,72,39,16,55,16,2,15,16,13,24,72,40,15,56,15,
+2,40,14,88,14,2,9,14,25,14,2,40,13,1,38,10,1,6,9,22,9,38,9,3,6,16,20,24,72,
+168,6,1,121,6,137,6,153,6,3,40,6,72,6,88,6,104,6,4,5,184,255,240,64,10,20,
+24,72,167,5,1,38,5,1,5,184,255,240,64,42,13,18,72,7,5,1,0,16,20,24,72,168,
+0,1,41,0,1,0,16,13,18,72,8,0,1,6,5,11,16,15,2,25,0,20,148,11,164,11,180,11,
+3,11,184,255,224,64,48,11,14,72,155,20,171,20,187,20,3,20,32,11,14,72,11,
+2,20,20,2,11,3,7,23,16,24,1,24,8,7,20,11,91,2,1,84,11,1,2,11,6,23,15,7,15,
+0,6,21,0,63,51,63,51,51,18,57,57,93,93,17,51,1,47,51,47,93,51,18,23,57,61,
+47,47,47,43,93,43,93,17,51,51,17,51,51,17,51,51,49,48,93,43,93,93,43,93,43,
+93,93,43,93,93,93,43,93,93,93,93,93,93,43,93,43,93,93,93,93,43,93,43,33,3,
+3,35,3,3,35,3,51,19,22,23,51,54,55,19,51,19,22,23,51,54,55,19,51,3,3,45,131,
+68,6,65,135,189,223,162,98,34,23,6,31,37,133,193,127,43,24,6,31,29,102,158,
+225,2,84,1,74,254,178,253,176,4,74,253,225,186,207,185,173,2,66,253,190,195,
+163,242,151,2,31,251,182,0,1,0,96,0,0,4,106,4,74,0,11,0,169,183,196,10,212,
+10,228,10,3,10,184,255,240,64,36,11,14,72,203,8,219,8,235,8,3,8,16,11,14,
+72,203,4,219,4,235,4,3,4,16,11,14,72,196,2,212,2,228,2,3,6,2,184,255,240,
+64,20,11,14,72,73,9,1,9,16,18,23,72,10,9,26,9,2,70,3,1,3,184,255,240,64,45,
+18,23,72,5,3,21,3,2,4,5,5,6,3,9,0,4,11,8,0,7,16,7,2,7,7,13,2,1,10,31,11,1,
+11,9,6,0,3,4,1,11,7,21,4,1,15,0,63,51,63,51,18,23,57,1,47,93,51,51,50,17,
+51,47,93,51,18,23,57,51,17,51,49,48,0,93,43,93,93,43,93,1,43,95,93,43,93,
+43,93,43,93,1,1,51,1,1,51,1,1,35,1,1,35,1,254,254,119,207,1,34,1,35,207,254,
+117,1,157,206,254,202,254,201,207,2,51,2,23,254,102,1,154,253,233,253,205,
+1,180,254,76,0,0,1,0,82,254,20,4,121,4,74,0,22,0,113,64,30,56,8,1,9,8,25,
+8,41,8,3,55,1,1,6,1,22,1,38,1,3,22,16,9,12,72,22,4,4,8,9,184,255,192,64,18,
+9,12,72,9,9,24,15,15,1,31,0,47,0,63,0,3,0,4,184,255,240,64,20,11,14,72,4,
+4,20,4,2,4,0,22,22,18,80,16,13,27,8,0,15,0,63,50,63,51,225,63,18,57,93,43,
+1,47,93,50,50,47,17,51,47,43,51,57,61,47,51,43,49,48,93,93,93,93,19,51,1,
+22,23,51,54,55,19,51,1,6,6,35,34,39,53,22,51,50,54,55,55,82,188,1,6,82,7,
+6,23,67,239,189,254,37,67,178,157,86,82,62,74,96,107,42,58,4,74,253,114,205,
+85,112,180,2,140,251,39,174,175,17,145,12,82,100,150,0,1,0,182,0,0,4,20,4,
+74,0,9,0,70,64,14,3,8,9,12,72,3,7,7,112,0,1,0,11,8,184,255,248,64,24,9,12,
+72,8,2,4,4,127,2,1,0,2,1,2,7,4,78,5,15,2,8,78,1,21,0,63,225,50,63,225,50,
+1,47,93,93,51,47,17,51,43,16,206,93,50,47,51,43,49,48,33,33,53,1,33,53,33,
+21,1,33,4,20,252,162,2,148,253,141,3,43,253,121,2,153,125,3,68,137,146,252,
+209,0,0,1,0,225,254,188,3,233,5,182,0,25,0,98,64,63,20,0,241,12,22,9,112,
+6,128,6,2,6,6,9,16,95,3,1,64,3,1,3,27,224,9,240,9,2,31,9,1,9,22,9,245,239,
+10,255,10,2,217,10,1,15,10,47,10,175,10,191,10,4,10,10,3,16,245,15,248,3,
+245,4,249,0,63,225,63,225,18,57,47,93,93,93,225,57,1,47,93,93,16,206,93,93,
+50,17,57,47,93,18,57,51,225,50,49,48,5,20,22,23,21,36,17,17,52,33,53,32,53,
+17,16,37,21,6,6,21,17,20,7,21,22,21,2,233,112,144,254,74,254,174,1,82,1,182,
+144,112,233,233,16,81,75,2,150,6,1,31,1,78,189,155,189,1,77,1,31,6,149,2,
+75,81,254,180,207,41,12,41,207,0,0,1,2,27,254,20,2,176,6,20,0,3,0,21,64,10,
+2,170,79,3,1,3,2,27,0,0,0,63,63,1,47,93,225,49,48,1,51,17,35,2,27,149,149,
+6,20,248,0,0,0,1,0,227,254,188,3,236,5,182,0,25,0,96,64,62,5,25,241,13,3,
+127,19,143,19,2,19,19,9,239,15,255,15,2,16,15,1,15,27,21,80,9,1,79,9,1,9,
+3,16,245,239,15,255,15,2,217,15,1,15,15,47,15,175,15,191,15,4,15,15,10,22,
+245,21,249,9,245,10,248,0,63,225,63,225,17,57,47,93,93,93,225,57,1,47,93,
+93,51,16,206,93,93,17,57,47,93,57,51,225,50,49,48,1,52,55,53,38,53,17,52,
+38,39,53,4,17,17,20,33,21,32,21,17,16,5,53,54,54,53,1,227,234,234,113,143,
+1,183,1,82,254,174,254,73,143,113,1,59,207,41,12,41,207,1,76,81,76,1,149,
+6,254,225,254,179,189,155,189,254,178,254,225,6,150,1,76,81,0,1,0,152,2,74,
+4,51,3,90,0,17,0,47,64,26,9,19,0,0,1,0,0,18,16,173,9,3,178,7,173,0,223,12,
+1,112,12,1,63,12,1,12,0,47,93,93,93,51,225,253,50,225,17,1,51,47,93,16,206,
+49,48,19,53,54,51,50,23,22,51,50,55,21,6,35,34,39,38,35,34,152,99,148,100,
+148,130,71,108,119,99,149,100,147,131,70,108,2,74,162,108,63,56,121,162,108,
+63,56,0,2,1,231,254,139,2,229,4,94,0,7,0,11,0,37,64,17,8,9,10,6,150,11,2,
+2,12,13,8,8,10,0,155,4,16,0,63,237,47,57,47,17,18,1,57,47,51,225,50,57,57,
+49,48,1,34,53,52,51,50,21,20,7,51,19,35,2,102,127,127,127,188,121,51,223,
+3,72,139,139,139,139,164,251,231,0,0,1,0,172,255,236,4,37,5,203,0,23,0,78,
+64,24,0,14,70,21,32,17,48,17,2,17,17,19,2,143,12,1,12,25,7,72,0,19,1,19,184,
+255,192,64,18,21,24,72,19,5,80,0,21,21,22,7,17,9,81,14,14,15,22,0,63,51,47,
+225,51,63,51,47,51,225,1,47,43,93,225,16,206,93,50,17,57,47,93,51,225,50,
+49,48,1,22,23,7,38,35,32,17,16,33,50,55,21,6,7,21,35,53,36,17,16,37,53,51,
+2,231,162,156,62,150,118,254,141,1,105,153,168,122,177,137,254,78,1,178,137,
+5,39,3,56,158,57,254,98,254,107,61,159,59,3,200,206,69,1,232,1,238,74,172,
+0,1,0,119,0,0,4,86,5,201,0,27,0,82,64,49,6,10,111,22,18,8,18,8,15,0,13,29,
+20,0,15,1,15,9,20,117,6,47,21,95,21,127,21,143,21,175,21,191,21,223,21,7,
+21,21,12,3,115,1,26,7,16,12,116,15,24,0,63,225,50,63,51,225,18,57,47,93,51,
+225,50,1,47,93,51,16,206,50,17,57,57,47,47,51,225,50,49,48,1,7,38,35,34,21,
+17,33,21,33,21,20,7,33,21,33,53,54,53,53,35,53,51,17,52,54,51,50,4,39,66,
+141,131,223,1,121,254,135,140,2,236,252,33,200,198,198,217,181,192,5,121,
+144,72,246,254,217,137,211,196,78,166,154,49,235,213,137,1,68,168,201,0,2,
+0,174,1,29,4,31,4,139,0,27,0,39,0,94,64,10,37,171,0,26,176,26,224,26,3,26,
+184,255,192,64,29,11,15,72,26,26,31,171,192,12,1,79,12,95,12,111,12,3,12,
+41,28,174,0,19,176,19,224,19,3,19,184,255,192,64,21,11,15,72,19,19,34,174,
+31,5,63,5,79,5,111,5,191,5,239,5,6,5,0,47,93,225,51,47,43,93,225,1,16,222,
+93,93,225,51,47,43,93,225,49,48,1,39,55,23,54,51,50,23,55,23,7,22,21,20,7,
+23,7,39,6,35,34,39,7,39,55,38,53,52,1,50,54,53,52,38,35,34,6,21,20,22,1,47,
+129,98,127,101,114,114,99,129,99,129,67,67,127,97,129,99,114,118,97,127,96,
+127,65,1,120,100,144,143,101,99,140,141,3,168,129,98,129,68,68,129,96,129,
+101,114,120,95,127,96,127,66,68,127,96,127,95,118,114,254,158,140,100,101,
+143,142,102,100,140,0,0,1,0,78,0,0,4,125,5,182,0,22,0,189,185,0,22,255,248,
+64,9,10,13,72,1,8,10,13,72,0,184,255,232,64,60,21,24,72,102,0,118,0,2,18,
+14,18,14,12,22,207,21,1,139,21,1,116,21,1,21,21,12,5,9,5,9,1,2,2,103,0,1,
+0,7,3,11,110,20,16,192,12,208,12,2,103,12,1,16,12,1,12,12,23,24,7,15,184,
+1,7,180,14,10,14,6,18,184,1,7,64,29,19,3,0,19,159,14,1,48,14,64,14,2,15,19,
+31,19,159,19,3,14,19,14,19,1,11,18,22,1,6,0,63,51,63,18,57,57,47,47,93,93,
+93,17,51,51,16,225,50,17,51,16,225,50,17,18,1,57,47,93,93,93,51,51,225,50,
+50,57,93,50,47,51,57,57,47,47,17,51,47,93,93,93,51,18,57,57,47,47,49,48,0,
+93,43,1,43,43,1,1,51,1,51,21,33,21,33,21,33,17,35,17,33,53,33,53,33,53,51,
+1,51,2,100,1,90,191,254,127,240,254,210,1,46,254,210,178,254,211,1,45,254,
+211,234,254,133,192,2,211,2,227,253,0,137,158,137,254,250,1,6,137,158,137,
+3,0,0,0,2,2,27,254,20,2,176,6,20,0,3,0,7,0,33,64,16,2,6,170,3,79,7,1,7,4,
+3,4,3,6,27,0,0,0,63,63,57,57,47,47,1,47,93,51,225,50,49,48,1,51,17,35,17,
+51,17,35,2,27,149,149,149,149,6,20,252,244,254,25,252,243,0,0,2,0,244,255,
+246,3,217,6,31,0,39,0,50,0,125,64,43,8,0,1,6,20,1,9,0,1,40,20,47,22,0,45,
+2,72,42,1,42,73,18,18,32,70,7,22,52,71,47,1,47,73,38,12,70,2,2,27,0,38,1,
+38,184,255,192,64,26,12,15,72,38,38,51,20,40,0,45,12,45,40,32,4,5,30,78,28,
+25,22,10,78,8,5,1,0,63,51,225,63,51,225,17,23,57,17,51,17,51,17,1,51,47,43,
+93,51,51,47,225,16,225,93,16,222,50,225,51,47,225,93,17,57,57,17,18,57,57,
+49,48,0,93,93,1,93,1,38,53,52,54,51,50,23,7,38,35,34,21,20,22,23,22,22,21,
+20,7,22,21,20,6,35,34,39,53,22,51,50,53,52,38,39,38,38,53,52,1,54,53,52,38,
+39,6,21,20,22,23,1,164,160,208,173,162,164,56,156,120,201,99,147,157,148,
+145,145,221,197,204,119,171,152,240,86,152,197,112,1,197,114,147,133,133,
+113,151,4,43,80,156,120,144,72,139,67,116,54,78,61,62,155,113,182,88,80,145,
+138,161,65,158,82,141,57,80,62,84,150,104,179,254,97,76,109,89,111,48,48,
+127,73,107,63,0,0,2,1,74,5,12,3,129,5,217,0,7,0,15,0,55,64,36,2,133,0,6,112,
+6,224,6,3,6,6,14,133,10,10,17,8,0,147,12,79,4,111,4,127,4,159,4,175,4,207,
+4,223,4,7,4,0,47,93,51,237,50,17,1,51,47,225,51,47,93,225,49,48,1,50,21,20,
+35,34,53,52,33,50,21,20,35,34,53,52,1,170,96,96,96,1,215,96,96,96,5,217,102,
+103,103,102,102,103,103,102,0,0,3,0,6,255,236,4,199,5,203,0,11,0,23,0,44,
+0,111,64,70,41,197,35,25,31,30,47,30,63,30,3,30,25,30,25,9,15,195,3,46,21,
+195,9,43,201,27,24,27,38,201,33,36,33,111,27,127,27,143,27,3,13,27,29,27,
+2,96,33,112,33,128,33,3,2,33,18,33,2,27,33,27,33,0,12,200,6,19,18,200,0,4,
+0,63,225,63,225,17,57,57,47,47,93,93,93,93,17,51,16,225,17,51,16,225,1,47,
+225,16,214,225,17,57,57,47,47,93,17,51,225,49,48,1,32,0,17,16,0,33,32,0,17,
+16,0,1,50,0,17,16,0,35,34,0,17,16,0,1,21,6,35,34,38,53,52,54,51,50,23,7,38,
+35,34,6,21,16,51,50,2,102,1,30,1,67,254,188,254,227,254,226,254,190,1,65,
+1,31,240,1,4,254,252,240,240,254,253,1,3,1,244,107,114,195,210,220,191,128,
+126,61,110,83,121,130,251,94,5,203,254,104,254,168,254,167,254,106,1,151,
+1,88,1,87,1,153,250,141,1,85,1,46,1,46,1,85,254,170,254,211,254,211,254,170,
+1,109,131,50,247,214,209,246,62,127,54,171,151,254,189,0,0,2,1,20,3,16,3,
+141,5,199,0,20,0,30,0,71,64,37,30,1,9,224,192,19,1,47,19,127,19,2,19,19,24,
+224,15,48,5,160,5,2,5,30,229,9,9,26,14,12,228,17,222,1,26,228,3,184,1,0,177,
+0,255,0,63,63,225,50,63,225,51,18,57,47,225,1,47,93,51,225,51,47,93,93,225,
+50,50,49,48,1,39,6,35,34,53,52,54,55,55,53,52,35,34,7,39,54,51,32,21,17,3,
+6,6,21,20,51,50,54,53,53,3,31,33,104,164,222,170,191,125,152,112,133,41,138,
+156,1,35,247,114,120,104,105,125,3,29,118,131,205,116,103,6,5,10,133,51,110,
+58,238,254,68,1,63,2,52,75,90,110,91,20,0,0,2,0,197,0,115,4,6,3,199,0,6,0,
+13,0,71,64,42,10,235,7,236,11,143,9,1,96,9,1,9,15,3,235,0,236,64,4,0,2,48,
+2,96,2,160,2,4,2,12,5,238,8,1,238,32,0,6,10,3,3,239,0,25,63,23,51,26,237,
+50,237,50,1,24,47,93,51,26,253,225,16,222,93,93,50,253,225,49,48,19,1,23,
+3,19,7,1,37,1,23,3,19,7,1,197,1,53,117,238,238,117,254,203,1,151,1,53,117,
+237,237,117,254,203,2,41,1,158,78,254,164,254,164,78,1,155,27,1,158,78,254,
+164,254,164,78,1,155,0,0,1,0,152,1,6,4,51,3,29,0,5,0,44,183,3,170,0,7,0,5,
+1,5,184,255,192,64,13,21,24,72,5,5,6,3,173,0,1,1,0,179,0,63,50,47,16,225,
+17,1,51,47,43,93,16,222,225,49,48,1,17,35,17,33,53,4,51,149,252,250,3,29,
+253,233,1,129,150,255,255,1,29,1,209,3,176,2,121,2,6,0,16,0,0,0,4,0,6,255,
+236,4,199,5,203,0,11,0,23,0,35,0,43,0,150,64,94,24,34,36,29,197,30,26,25,
+25,39,197,34,27,34,96,30,1,96,34,1,27,34,1,30,34,30,34,9,15,195,3,45,21,195,
+9,26,30,21,36,1,36,201,28,24,28,43,201,31,240,30,1,111,30,127,30,143,30,3,
+13,30,29,30,2,34,28,1,96,31,112,31,128,31,3,2,31,18,31,2,30,28,31,31,28,30,
+3,0,12,200,6,19,18,200,0,4,0,63,225,63,225,17,23,57,47,47,47,93,93,93,93,
+93,93,16,225,17,51,16,225,93,17,51,1,47,225,16,214,225,17,57,57,47,47,93,
+93,93,18,57,16,225,51,17,51,16,225,50,17,57,49,48,1,32,0,17,16,0,33,32,0,
+17,16,0,1,50,0,17,16,0,35,34,0,17,16,0,1,19,35,3,35,17,35,17,51,32,17,20,
+37,51,50,53,52,38,35,35,2,102,1,30,1,67,254,188,254,227,254,226,254,190,1,
+65,1,31,240,1,4,254,252,240,240,254,253,1,3,1,118,237,178,207,94,158,234,
+1,69,254,111,72,170,84,89,69,5,203,254,104,254,168,254,167,254,106,1,151,
+1,88,1,87,1,153,250,141,1,85,1,46,1,46,1,85,254,170,254,211,254,211,254,170,
+2,80,254,117,1,96,254,160,3,125,254,247,163,18,141,74,59,0,0,1,255,236,6,
+20,4,225,6,160,0,3,0,15,181,1,0,3,186,0,0,0,63,225,1,47,47,49,48,1,33,53,
+33,4,225,251,11,4,245,6,20,140,0,2,1,43,3,86,3,162,5,203,0,11,0,23,0,137,
+64,26,169,10,185,10,2,10,16,9,15,72,169,8,185,8,2,8,16,9,15,72,166,4,182,
+4,2,4,184,255,240,64,9,9,15,72,166,2,182,2,2,2,184,255,240,64,33,9,15,72,
+15,171,159,3,175,3,255,3,3,3,25,21,171,0,9,32,9,48,9,144,9,160,9,176,9,240,
+9,7,9,12,184,1,2,64,12,0,6,16,6,32,6,224,6,240,6,5,6,184,255,192,180,16,21,
+72,6,18,184,1,2,177,0,4,0,63,225,212,43,93,225,1,47,93,225,16,222,93,225,
+49,48,43,93,43,93,43,93,43,93,1,50,22,21,20,6,35,34,38,53,52,54,19,50,54,
+53,52,38,35,34,6,21,20,22,2,102,129,187,186,130,131,184,185,130,79,114,115,
+78,79,113,112,5,203,187,129,129,184,185,128,129,187,254,6,112,78,81,114,115,
+80,78,112,0,2,0,152,0,0,4,51,4,162,0,11,0,15,0,41,64,22,14,9,6,170,13,0,192,
+3,208,3,2,3,13,173,12,24,9,0,173,6,3,179,0,63,51,225,50,63,225,1,47,93,51,
+51,225,50,50,49,48,1,33,53,33,17,51,17,33,21,33,17,35,1,53,33,21,2,27,254,
+125,1,131,149,1,131,254,125,149,254,125,3,155,2,135,150,1,133,254,123,150,
+254,127,254,250,150,150,0,0,1,1,92,2,160,3,111,5,197,0,21,0,77,64,51,21,21,
+6,224,15,16,31,16,79,16,95,16,127,16,143,16,159,16,7,16,16,20,11,11,0,1,96,
+1,112,1,128,1,4,1,6,1,10,16,17,24,72,10,8,228,13,222,2,20,228,1,221,0,63,
+225,50,63,225,51,43,18,57,1,47,93,50,47,50,50,47,93,225,51,47,49,48,1,33,
+53,55,54,54,53,52,35,34,7,39,54,51,50,22,21,20,6,7,7,33,3,111,253,237,187,
+111,61,111,81,83,78,117,131,118,130,70,129,135,1,107,2,160,102,199,118,101,
+57,115,76,86,103,120,104,66,136,129,136,0,1,1,86,2,143,3,78,5,197,0,30,0,
+132,64,79,0,16,19,224,23,29,1,29,29,2,16,16,7,12,224,15,2,31,2,79,2,95,2,
+127,2,143,2,159,2,7,2,2,7,24,24,0,7,96,7,112,7,3,7,0,15,229,250,16,1,233,
+16,1,168,16,1,111,16,1,11,16,27,16,2,16,16,10,23,16,17,24,72,23,21,228,26,
+222,10,228,8,184,255,240,181,17,24,72,8,5,223,0,63,51,43,225,63,225,51,43,
+18,57,47,93,93,93,93,93,225,57,1,47,93,51,47,17,51,47,93,225,18,57,47,17,
+51,47,93,225,18,57,49,48,1,22,21,20,6,35,34,39,53,22,51,50,53,52,35,35,53,
+51,50,53,52,35,34,7,39,54,51,50,22,21,20,2,158,176,149,140,131,84,110,93,
+149,147,72,70,123,97,71,90,66,111,127,109,128,4,61,39,147,116,128,50,124,
+65,137,125,104,127,111,70,86,93,109,94,139,0,0,1,1,162,4,217,3,43,6,33,0,
+7,0,31,64,16,6,7,134,2,135,3,3,9,2,146,15,6,95,6,2,6,0,47,93,237,17,1,51,
+47,225,237,50,49,48,1,54,55,51,21,6,7,35,1,162,94,80,219,112,160,121,4,244,
+133,168,21,173,134,0,1,0,180,254,20,4,25,4,74,0,21,0,61,64,16,10,5,71,143,
+8,1,8,23,15,0,18,71,0,19,1,19,184,255,192,64,16,17,20,72,19,18,27,10,2,80,
+13,22,9,21,20,6,15,0,63,51,63,63,225,50,63,1,47,43,93,225,50,50,16,222,93,
+225,50,49,48,1,16,51,50,54,53,17,51,17,35,39,35,6,35,34,39,22,21,17,35,17,
+51,1,106,218,148,138,183,148,27,10,96,199,139,74,6,182,182,1,135,254,252,
+182,215,2,58,251,182,147,167,88,153,87,254,192,6,54,0,1,0,66,254,252,4,55,
+6,20,0,14,0,77,183,4,154,96,5,240,5,2,5,184,255,192,64,37,18,22,72,34,5,50,
+5,2,4,5,20,5,2,5,5,10,1,154,0,16,10,64,10,15,72,10,10,15,8,8,0,2,81,14,0,
+5,0,0,47,50,63,225,18,57,47,17,1,51,47,43,16,222,225,17,57,47,93,93,43,93,
+225,49,48,1,35,17,35,17,35,17,6,35,32,17,16,54,51,33,4,55,121,206,121,61,
+85,254,93,217,233,2,51,254,252,6,121,249,135,3,51,18,1,245,1,3,255,0,0,1,
+1,231,2,72,2,229,3,94,0,7,0,34,64,20,2,150,48,6,96,6,176,6,224,6,240,6,5,
+6,6,8,9,0,155,4,0,47,237,17,18,1,57,47,93,237,49,48,1,50,21,20,35,34,53,52,
+2,102,127,127,127,3,94,139,139,139,139,0,0,1,1,172,254,20,3,33,0,0,0,15,0,
+67,185,0,13,255,176,64,33,11,19,72,7,48,9,14,72,8,7,9,10,7,10,0,5,132,12,
+95,0,1,0,0,12,12,17,10,7,8,3,141,14,8,0,47,47,225,17,57,57,17,1,51,47,51,
+47,93,16,225,17,57,57,17,51,17,51,49,48,43,43,1,53,22,51,50,53,52,39,55,51,
+7,22,21,20,33,34,1,172,33,47,151,172,91,120,57,160,254,221,34,254,29,108,
+6,92,74,39,176,115,37,135,205,0,1,1,111,2,160,2,209,5,180,0,10,0,33,64,15,
+10,10,2,224,0,3,3,11,12,2,221,6,9,0,220,0,63,205,57,63,17,18,1,57,47,51,225,
+51,47,49,48,1,51,17,35,17,52,55,6,7,7,39,2,74,135,146,9,41,33,70,73,5,180,
+252,236,1,209,69,131,44,21,51,88,0,0,2,1,25,3,16,3,180,5,199,0,11,0,19,0,
+48,64,27,14,224,176,9,1,127,9,1,9,9,18,224,32,3,48,3,160,3,3,3,16,230,6,222,
+12,230,0,184,1,0,0,63,225,63,225,1,47,93,225,51,47,93,93,225,49,48,1,34,38,
+53,52,54,51,50,22,21,20,6,39,50,53,52,35,34,21,20,2,100,144,187,180,155,145,
+187,184,150,181,181,182,3,16,186,163,162,184,185,161,165,184,119,230,225,
+225,230,0,2,0,197,0,115,4,6,3,199,0,6,0,13,0,71,64,42,2,4,236,3,235,63,6,
+143,6,159,6,175,6,4,6,15,9,11,236,64,10,235,159,13,1,0,13,1,13,12,5,238,8,
+1,238,32,0,6,10,3,3,239,0,25,63,23,51,26,237,50,237,50,1,24,47,93,93,225,
+26,237,50,16,222,93,225,237,50,49,48,1,1,39,19,3,55,1,5,1,39,19,3,55,1,4,
+6,254,203,117,238,238,117,1,53,254,105,254,202,116,237,237,116,1,54,2,14,
+254,101,78,1,92,1,92,78,254,98,27,254,101,78,1,92,1,92,78,254,98,255,255,
+0,22,0,0,4,184,5,182,2,39,0,123,254,167,0,0,0,38,2,23,0,0,1,7,2,60,1,57,253,
+89,0,60,64,39,3,2,18,24,3,2,240,18,1,224,18,1,128,18,1,127,18,1,16,18,1,18,
+0,240,0,1,224,0,1,176,0,1,80,0,1,64,0,1,0,17,93,93,93,93,93,53,17,93,93,93,
+93,93,53,53,0,63,53,53,255,255,0,3,0,0,4,201,5,182,2,39,0,123,254,148,0,0,
+0,38,2,23,191,0,1,7,0,116,1,90,253,97,0,68,64,45,2,16,24,2,240,16,1,224,16,
+1,208,16,1,192,16,1,16,16,1,0,16,1,16,1,175,13,1,143,13,1,13,0,240,0,1,224,
+0,1,80,0,1,64,0,1,0,17,93,93,93,93,53,17,93,93,53,17,93,93,93,93,93,93,53,
+0,63,53,255,255,0,21,0,0,4,205,5,197,2,39,0,117,254,191,0,0,0,38,2,23,53,
+0,1,7,2,60,1,78,253,89,0,56,64,36,3,2,38,24,3,2,240,38,1,224,38,1,128,38,
+1,16,38,1,38,1,244,33,1,228,33,1,212,33,1,196,33,1,176,33,1,33,17,93,93,93,
+93,93,53,17,93,93,93,93,53,53,0,63,53,53,0,2,0,168,254,119,4,31,4,94,0,7,
+0,33,0,91,64,55,33,8,8,6,150,64,2,80,2,2,2,2,15,159,21,1,21,35,32,35,1,15,
+71,159,26,1,0,26,1,26,15,23,32,8,1,8,8,0,20,18,81,48,23,1,23,26,0,1,9,0,1,
+0,155,4,16,0,63,225,93,93,47,93,225,51,18,57,47,93,18,57,1,47,93,93,225,93,
+16,206,93,17,57,47,93,229,50,17,51,49,48,1,34,53,52,51,50,21,20,7,21,20,6,
+7,6,6,21,20,22,51,50,55,23,6,35,34,38,53,52,54,55,54,54,53,53,2,162,127,127,
+127,39,89,118,129,84,149,132,181,189,62,219,203,217,248,107,143,119,65,3,
+72,139,139,139,139,164,37,119,149,84,97,116,101,93,113,90,144,106,195,163,
+134,166,108,87,107,90,19,255,255,0,33,0,0,4,172,7,115,2,38,0,36,0,0,1,7,0,
+67,255,179,1,82,0,21,180,2,15,5,38,2,184,255,179,180,18,15,4,7,37,1,43,53,
+0,43,53,0,255,255,0,33,0,0,4,172,7,115,2,38,0,36,0,0,1,7,0,118,0,102,1,82,
+0,19,64,11,2,21,5,38,2,102,15,18,4,7,37,1,43,53,0,43,53,0,255,255,0,33,0,
+0,4,172,7,115,2,38,0,36,0,0,1,7,1,75,0,0,1,82,0,19,64,11,2,15,5,38,2,0,21,
+15,4,7,37,1,43,53,0,43,53,0,255,255,0,33,0,0,4,172,7,53,2,38,0,36,0,0,1,7,
+1,82,255,255,1,82,0,21,180,2,15,5,38,2,184,255,254,180,16,25,4,7,37,1,43,
+53,0,43,53,0,255,255,0,33,0,0,4,172,7,43,2,38,0,36,0,0,1,7,0,106,0,0,1,82,
+0,25,182,3,2,19,5,38,3,2,184,255,255,180,21,25,4,7,37,1,43,53,53,0,43,53,
+53,0,255,255,0,33,0,0,4,172,7,4,2,38,0,36,0,0,1,6,1,80,0,125,0,52,64,26,3,
+2,239,26,1,223,26,1,80,26,1,64,26,1,32,26,1,16,26,1,0,26,1,26,3,2,184,255,
+255,180,18,24,4,7,37,1,43,53,53,0,17,93,93,93,93,93,93,93,53,53,0,2,0,0,0,
+0,4,186,5,182,0,15,0,19,0,134,64,84,6,8,11,14,72,16,3,19,4,201,19,217,19,
+233,19,3,55,19,1,19,6,10,14,90,1,17,1,15,1,1,79,1,95,1,127,1,143,1,239,1,
+255,1,6,6,1,11,11,1,6,3,5,8,0,21,4,5,3,95,16,13,95,10,159,16,207,16,2,104,
+10,1,16,10,16,10,14,19,9,95,6,3,14,95,4,1,0,47,51,225,63,225,50,18,57,57,
+47,47,93,93,16,225,16,225,1,47,51,16,206,50,17,23,57,47,47,47,93,113,17,51,
+16,225,50,17,51,93,93,17,18,57,57,43,49,48,33,33,17,33,3,35,1,33,21,33,17,
+33,21,33,17,33,1,51,17,35,4,186,253,115,254,223,96,172,1,82,3,104,254,35,
+1,182,254,74,1,221,252,119,252,106,1,197,254,59,5,182,164,254,60,162,253,
+248,1,198,2,168,255,255,0,129,254,20,4,156,5,203,2,38,0,38,0,0,1,6,0,122,
+80,0,0,11,182,1,40,22,34,6,11,37,1,43,53,0,255,255,0,217,0,0,4,35,7,115,2,
+38,0,40,0,0,1,7,0,67,255,183,1,82,0,21,180,1,12,5,38,1,184,255,160,180,15,
+12,1,0,37,1,43,53,0,43,53,0,255,255,0,217,0,0,4,35,7,115,2,38,0,40,0,0,1,
+7,0,118,0,63,1,82,0,19,64,11,1,18,5,38,1,39,12,15,1,0,37,1,43,53,0,43,53,
+0,255,255,0,217,0,0,4,35,7,115,2,38,0,40,0,0,1,7,1,75,0,35,1,82,0,19,64,11,
+1,12,5,38,1,11,18,12,1,0,37,1,43,53,0,43,53,0,255,255,0,217,0,0,4,35,7,43,
+2,38,0,40,0,0,1,7,0,106,0,25,1,82,0,23,64,13,2,1,16,5,38,2,1,0,18,22,1,0,
+37,1,43,53,53,0,43,53,53,0,255,255,0,225,0,0,3,233,7,115,2,38,0,44,0,0,1,
+7,0,67,255,148,1,82,0,21,180,1,12,5,38,1,184,255,150,180,15,12,1,0,37,1,43,
+53,0,43,53,0,255,255,0,225,0,0,3,233,7,115,2,38,0,44,0,0,1,7,0,118,0,119,
+1,82,0,19,64,11,1,18,5,38,1,120,12,15,1,0,37,1,43,53,0,43,53,0,255,255,0,
+225,0,0,3,233,7,115,2,38,0,44,0,0,1,7,1,75,0,0,1,82,0,19,64,11,1,12,5,38,
+1,1,18,12,1,0,37,1,43,53,0,43,53,0,255,255,0,225,0,0,3,233,7,43,2,38,0,44,
+0,0,1,7,0,106,0,2,1,82,0,23,64,13,2,1,16,5,38,2,1,2,18,22,1,0,37,1,43,53,
+53,0,43,53,53,0,0,2,0,0,0,0,4,123,5,182,0,12,0,23,0,73,64,44,16,0,21,91,9,
+25,14,18,90,4,2,0,0,224,0,240,0,3,0,17,2,95,14,104,3,1,47,3,159,3,207,3,3,
+3,3,18,13,96,5,3,18,96,0,18,0,63,225,63,225,18,57,47,93,93,51,225,50,1,47,
+93,198,51,225,50,16,222,225,17,57,49,48,51,17,35,53,51,17,33,32,0,17,16,0,
+33,3,17,33,21,33,17,51,32,17,16,33,135,135,135,1,86,1,61,1,97,254,146,254,
+167,114,1,124,254,132,96,2,20,254,19,2,147,162,2,129,254,134,254,173,254,
+151,254,128,5,23,254,30,162,254,13,2,67,2,52,255,255,0,135,0,0,4,68,7,53,
+2,38,0,49,0,0,1,7,1,82,0,4,1,82,0,19,64,11,1,16,5,38,1,4,17,26,7,0,37,1,43,
+53,0,43,53,0,255,255,0,84,255,236,4,123,7,115,2,38,0,50,0,0,1,7,0,67,255,
+175,1,82,0,21,180,2,20,5,38,2,184,255,174,180,23,20,2,7,37,1,43,53,0,43,53,
+0,255,255,0,84,255,236,4,123,7,115,2,38,0,50,0,0,1,7,0,118,0,90,1,82,0,19,
+64,11,2,26,5,38,2,89,20,23,2,7,37,1,43,53,0,43,53,0,255,255,0,84,255,236,
+4,123,7,115,2,38,0,50,0,0,1,7,1,75,0,0,1,82,0,21,180,2,20,5,38,2,184,255,
+255,180,26,20,2,7,37,1,43,53,0,43,53,0,255,255,0,84,255,236,4,123,7,53,2,
+38,0,50,0,0,1,7,1,82,0,8,1,82,0,19,64,11,2,20,5,38,2,6,21,30,2,7,37,1,43,
+53,0,43,53,0,255,255,0,84,255,236,4,123,7,43,2,38,0,50,0,0,1,7,0,106,0,2,
+1,82,0,23,64,13,3,2,24,5,38,3,2,0,26,30,2,7,37,1,43,53,53,0,43,53,53,0,0,
+1,0,190,1,45,4,14,4,123,0,11,0,92,185,0,6,255,240,179,15,22,72,6,184,255,
+248,64,24,10,14,72,0,16,15,22,72,0,8,10,14,72,9,16,15,22,72,9,8,10,14,72,
+3,184,255,240,179,15,22,72,3,184,255,248,64,20,10,14,72,128,3,192,3,208,3,
+240,3,4,31,3,1,3,223,0,1,0,0,25,47,93,1,47,93,93,49,48,0,43,43,43,43,1,43,
+43,43,43,1,1,55,1,1,23,1,1,7,1,1,39,1,252,254,194,105,1,61,1,66,104,254,191,
+1,63,102,254,190,254,195,102,2,211,1,63,105,254,194,1,62,103,254,191,254,
+192,102,1,61,254,197,103,0,3,0,80,255,180,4,133,5,252,0,18,0,25,0,33,0,96,
+185,0,19,255,224,64,56,9,23,72,26,32,9,23,72,26,20,27,19,4,24,32,91,12,9,
+0,3,4,5,11,14,35,24,91,2,31,5,47,5,2,5,27,19,26,20,4,22,29,95,0,3,12,9,4,
+7,1,17,19,22,95,10,7,4,0,63,51,225,63,51,18,23,57,225,17,23,57,1,47,93,51,
+225,16,222,50,17,23,57,225,17,23,57,49,48,0,43,43,37,7,39,55,38,17,16,33,
+50,23,55,23,7,22,17,16,0,35,34,3,1,38,35,32,17,20,1,1,22,51,50,18,17,52,1,
+53,92,137,121,117,2,22,186,124,92,137,125,115,254,236,255,189,108,2,3,80,
+136,254,175,2,122,254,0,80,133,173,161,74,150,78,197,184,1,96,2,238,105,152,
+78,201,188,254,180,254,151,254,120,1,155,3,68,94,253,180,212,2,28,252,192,
+86,1,34,1,44,209,0,255,255,0,125,255,236,4,80,7,115,2,38,0,56,0,0,1,7,0,67,
+255,187,1,82,0,21,180,1,15,5,38,1,184,255,187,180,18,15,6,0,37,1,43,53,0,
+43,53,0,255,255,0,125,255,236,4,80,7,115,2,38,0,56,0,0,1,7,0,118,0,76,1,82,
+0,19,64,11,1,21,5,38,1,76,15,18,6,0,37,1,43,53,0,43,53,0,255,255,0,125,255,
+236,4,80,7,115,2,38,0,56,0,0,1,7,1,75,0,0,1,82,0,19,64,11,1,15,5,38,1,0,21,
+15,6,0,37,1,43,53,0,43,53,0,255,255,0,125,255,236,4,80,7,43,2,38,0,56,0,0,
+1,7,0,106,0,2,1,82,0,23,64,13,2,1,19,5,38,2,1,1,21,25,6,0,37,1,43,53,53,0,
+43,53,53,0,255,255,0,33,0,0,4,170,7,115,2,38,0,60,0,0,1,7,0,118,0,76,1,82,
+0,19,64,11,1,15,5,38,1,77,9,12,7,2,37,1,43,53,0,43,53,0,0,2,0,176,0,0,4,70,
+5,182,0,11,0,19,0,62,64,36,16,91,239,8,255,8,2,8,21,12,5,1,90,0,2,144,2,160,
+2,3,2,12,96,0,19,96,5,0,5,0,5,1,3,3,1,18,0,63,63,18,57,57,47,47,16,225,16,
+225,1,47,93,225,50,50,16,222,93,225,49,48,1,17,35,17,51,21,51,32,17,20,4,
+33,39,51,50,54,53,16,33,35,1,106,186,186,218,2,2,254,235,254,248,191,170,
+198,171,254,174,201,1,61,254,195,5,182,252,254,84,219,246,158,144,153,1,23,
+0,1,0,164,255,236,4,127,6,31,0,42,0,114,64,75,16,22,1,11,70,32,15,71,27,29,
+0,1,15,0,1,79,32,95,32,2,29,32,1,15,32,1,15,27,31,27,191,27,207,27,223,27,
+5,0,32,27,27,32,0,3,21,5,71,38,44,20,71,0,21,160,21,176,21,3,21,5,32,15,3,
+24,3,80,1,41,22,17,80,24,1,21,21,0,63,63,225,63,51,225,18,23,57,1,47,93,225,
+16,222,225,18,23,57,47,47,47,93,93,93,93,93,93,16,225,16,225,49,48,0,93,37,
+53,22,51,50,53,52,38,39,38,38,53,52,55,54,53,52,35,34,21,17,35,17,16,33,50,
+22,21,20,7,6,6,21,20,22,23,22,22,21,20,6,35,34,1,223,143,134,213,91,98,123,
+100,129,129,227,242,182,1,168,194,217,133,84,49,58,122,144,94,200,183,182,
+49,166,86,174,81,102,61,78,122,87,117,106,106,90,164,215,251,78,4,176,1,111,
+159,148,132,117,74,62,33,39,60,81,95,156,98,162,171,255,255,0,135,255,236,
+4,2,6,33,2,38,0,68,0,0,1,6,0,67,171,0,0,21,180,2,34,17,38,2,184,255,205,180,
+37,34,8,22,37,1,43,53,0,43,53,0,255,255,0,135,255,236,4,2,6,33,2,38,0,68,
+0,0,1,6,0,118,84,0,0,23,64,14,2,40,17,38,2,80,34,1,118,34,37,8,22,37,1,43,
+93,53,0,43,53,0,255,255,0,135,255,236,4,2,6,33,2,38,0,68,0,0,1,6,1,75,8,0,
+0,23,64,14,2,34,17,38,2,96,40,1,42,40,34,8,22,37,1,43,93,53,0,43,53,0,255,
+255,0,135,255,236,4,2,5,227,2,38,0,68,0,0,1,6,1,82,10,0,0,31,64,20,2,34,17,
+38,2,128,35,1,112,35,1,96,35,1,43,35,44,8,22,37,1,43,93,93,93,53,0,43,53,
+0,255,255,0,135,255,236,4,2,5,217,2,38,0,68,0,0,1,6,0,106,12,0,0,35,64,22,
+3,2,38,17,38,3,2,80,40,1,64,40,1,48,40,1,45,40,44,8,22,37,1,43,93,93,93,53,
+53,0,43,53,53,0,255,255,0,135,255,236,4,2,6,135,2,38,0,68,0,0,1,6,1,80,255,
+0,0,23,64,13,3,2,34,17,38,3,2,32,37,43,8,22,37,1,43,53,53,0,43,53,53,0,0,
+3,0,45,255,236,4,162,4,94,0,34,0,41,0,51,0,104,64,60,27,10,35,17,71,0,16,
+51,192,51,2,51,51,32,36,70,23,16,64,10,22,72,11,16,1,16,53,45,71,6,224,32,
+240,32,2,32,42,17,80,0,35,35,8,27,20,48,80,22,25,25,29,22,39,10,3,80,12,5,
+8,16,0,63,51,51,225,50,50,63,51,17,51,225,50,50,17,57,47,51,225,50,1,47,93,
+51,225,16,222,93,43,50,225,17,57,47,93,51,225,50,57,57,49,48,1,53,52,35,34,
+7,39,54,51,50,23,54,51,50,18,21,21,33,22,22,51,50,55,21,6,35,34,39,6,35,34,
+38,53,16,37,37,33,52,38,35,34,6,3,7,6,21,20,22,51,50,54,53,2,10,139,107,104,
+57,131,145,188,58,78,162,137,172,254,16,3,128,105,111,122,107,134,222,94,
+105,196,115,141,1,72,1,65,1,60,81,71,68,90,180,88,217,64,55,82,104,2,150,
+69,236,82,137,96,178,178,254,241,220,113,192,183,76,162,73,229,229,173,154,
+1,76,16,7,141,164,156,254,238,7,17,208,83,95,165,146,255,255,0,172,254,20,
+4,37,4,94,2,38,0,70,0,0,1,6,0,122,49,0,0,11,182,1,47,20,32,15,0,37,1,43,53,
+0,255,255,0,133,255,236,4,72,6,33,2,38,0,72,0,0,1,6,0,67,212,0,0,21,180,2,
+23,17,38,2,184,255,212,180,26,23,11,0,37,1,43,53,0,43,53,0,255,255,0,133,
+255,236,4,72,6,33,2,38,0,72,0,0,1,6,0,118,82,0,0,31,64,20,2,29,17,38,2,160,
+23,1,16,23,1,0,23,1,82,23,26,11,0,37,1,43,93,93,93,53,0,43,53,0,255,255,0,
+133,255,236,4,72,6,33,2,38,0,72,0,0,1,6,1,75,16,0,0,19,64,11,2,23,17,38,2,
+16,29,23,11,0,37,1,43,53,0,43,53,0,255,255,0,133,255,236,4,72,5,217,2,38,
+0,72,0,0,1,6,0,106,18,0,0,23,64,13,3,2,27,17,38,3,2,17,29,33,11,0,37,1,43,
+53,53,0,43,53,53,0,255,255,0,197,0,0,4,51,6,33,2,38,0,243,0,0,1,6,0,67,171,
+0,0,21,180,1,10,17,38,1,184,255,150,180,13,10,7,5,37,1,43,53,0,43,53,0,255,
+255,0,197,0,0,4,51,6,33,2,38,0,243,0,0,1,6,0,118,113,0,0,19,64,11,1,16,17,
+38,1,91,10,13,7,5,37,1,43,53,0,43,53,0,255,255,0,197,0,0,4,51,6,33,2,38,0,
+243,0,0,1,6,1,75,0,0,0,21,180,1,10,17,38,1,184,255,235,180,16,10,7,5,37,1,
+43,53,0,43,53,0,255,255,0,197,0,0,4,51,5,217,2,38,0,243,0,0,1,6,0,106,0,0,
+0,25,182,2,1,14,17,38,2,1,184,255,234,180,16,20,7,5,37,1,43,53,53,0,43,53,
+53,0,0,2,0,135,255,236,4,70,6,35,0,26,0,36,0,112,185,0,11,255,224,64,65,15,
+20,72,6,32,15,19,72,1,34,72,16,14,11,3,6,8,5,13,5,13,5,13,22,239,16,255,16,
+2,16,38,29,72,0,22,224,22,240,22,3,22,0,27,80,25,14,6,11,3,48,25,1,4,25,4,
+25,9,31,80,19,22,12,12,9,1,0,63,51,47,63,225,18,57,57,47,47,93,23,57,16,225,
+50,1,47,93,225,16,206,93,17,57,57,47,47,18,23,57,16,225,50,49,48,43,0,43,
+1,55,38,39,5,39,55,38,39,55,22,23,55,23,7,0,17,16,0,35,34,0,53,52,18,51,50,
+7,32,17,16,33,50,54,53,52,38,3,121,8,58,184,255,0,73,217,104,68,69,143,103,
+227,74,194,1,45,254,255,225,213,254,248,241,214,211,187,254,226,1,32,154,
+135,155,3,84,4,226,165,153,114,131,71,38,123,70,78,138,113,117,254,221,254,
+45,254,235,254,196,1,11,230,234,1,4,148,254,160,254,172,199,196,129,168,255,
+255,0,160,0,0,4,45,5,227,2,38,0,81,0,0,1,6,1,82,6,0,0,19,64,11,1,17,17,38,
+1,5,18,27,7,15,37,1,43,53,0,43,53,0,255,255,0,115,255,236,4,88,6,33,2,38,
+0,82,0,0,1,6,0,67,216,0,0,21,180,2,20,17,38,2,184,255,217,180,23,20,3,9,37,
+1,43,53,0,43,53,0,255,255,0,115,255,236,4,88,6,33,2,38,0,82,0,0,1,6,0,118,
+80,0,0,19,64,11,2,26,17,38,2,81,20,23,3,9,37,1,43,53,0,43,53,0,255,255,0,
+115,255,236,4,88,6,33,2,38,0,82,0,0,1,6,1,75,251,0,0,21,180,2,20,17,38,2,
+184,255,252,180,26,20,3,9,37,1,43,53,0,43,53,0,255,255,0,115,255,236,4,88,
+5,227,2,38,0,82,0,0,1,6,1,82,0,0,0,19,64,11,2,20,17,38,2,0,21,30,3,9,37,1,
+43,53,0,43,53,0,255,255,0,115,255,236,4,88,5,217,2,38,0,82,0,0,1,6,0,106,
+249,0,0,25,182,3,2,24,17,38,3,2,184,255,249,180,26,30,3,9,37,1,43,53,53,0,
+43,53,53,0,0,3,0,152,0,248,4,51,4,172,0,7,0,11,0,19,0,83,64,55,64,10,1,15,
+10,1,10,10,14,18,6,80,9,240,9,2,9,9,2,172,31,6,95,6,159,6,3,6,12,175,0,16,
+64,16,112,16,144,16,160,16,176,16,240,16,7,16,16,8,4,175,0,8,173,9,179,0,
+63,225,220,225,16,200,47,93,225,1,47,93,225,51,47,93,17,51,50,50,47,93,93,
+49,48,1,50,21,20,35,34,53,52,1,53,33,21,5,50,21,20,35,34,53,52,2,100,115,
+115,114,254,166,3,155,254,49,115,115,114,4,172,125,125,125,125,253,219,150,
+150,149,125,125,125,125,0,3,0,115,255,170,4,88,4,156,0,19,0,27,0,35,0,110,
+181,21,16,9,21,72,29,184,255,240,179,9,21,72,20,184,255,240,64,54,15,20,72,
+28,16,15,20,72,28,21,29,20,4,26,34,72,13,10,0,3,4,5,12,15,37,26,72,2,0,5,
+1,5,29,20,28,21,4,23,31,80,10,13,3,0,4,8,1,18,22,23,80,11,8,16,0,63,51,225,
+63,51,18,23,57,225,17,23,57,1,47,93,51,225,16,222,50,17,23,57,225,17,23,57,
+49,48,0,43,43,1,43,43,37,7,39,55,38,17,16,0,51,50,23,55,23,7,22,17,16,0,35,
+34,3,1,38,35,34,6,21,20,1,1,22,51,50,54,53,52,1,121,76,131,84,139,1,10,235,
+128,108,76,131,84,137,254,243,233,129,125,1,150,66,90,161,142,2,57,254,107,
+61,93,161,142,33,119,84,131,158,1,8,1,10,1,45,57,119,84,131,156,254,254,254,
+241,254,212,1,40,2,144,35,207,209,180,1,190,253,115,33,211,209,164,255,255,
+0,160,255,236,4,45,6,33,2,38,0,88,0,0,1,6,0,67,179,0,0,21,180,1,18,17,38,
+1,184,255,179,180,21,18,6,16,37,1,43,53,0,43,53,0,255,255,0,160,255,236,4,
+45,6,33,2,38,0,88,0,0,1,6,0,118,82,0,0,19,64,11,1,24,17,38,1,82,18,21,6,16,
+37,1,43,53,0,43,53,0,255,255,0,160,255,236,4,45,6,33,2,38,0,88,0,0,1,6,1,
+75,8,0,0,19,64,11,1,18,17,38,1,8,24,18,6,16,37,1,43,53,0,43,53,0,255,255,
+0,160,255,236,4,45,5,217,2,38,0,88,0,0,1,6,0,106,2,0,0,23,64,13,2,1,22,17,
+38,2,1,1,24,28,6,16,37,1,43,53,53,0,43,53,53,0,255,255,0,82,254,20,4,121,
+6,33,2,38,0,92,0,0,1,6,0,118,76,0,0,19,64,11,1,29,17,38,1,77,23,26,0,9,37,
+1,43,53,0,43,53,0,0,2,0,158,254,20,4,68,6,20,0,19,0,30,0,59,64,36,26,72,239,
+5,255,5,2,5,32,11,17,19,21,4,14,71,0,15,176,15,2,15,16,0,14,27,10,24,80,8,
+22,0,28,80,2,16,0,63,225,50,63,225,50,63,63,1,47,93,225,23,50,16,222,93,225,
+49,48,1,54,51,50,18,17,16,2,35,34,39,35,22,21,17,35,17,51,17,7,19,21,20,22,
+51,32,17,16,33,34,6,1,84,110,212,201,229,230,200,207,115,12,12,182,182,8,
+8,139,152,1,16,254,238,152,133,3,182,168,254,213,254,244,254,242,254,211,
+159,129,33,254,43,8,0,254,54,148,254,154,41,227,193,1,166,1,158,176,0,255,
+255,0,82,254,20,4,121,5,217,2,38,0,92,0,0,1,6,0,106,8,0,0,23,64,13,2,1,27,
+17,38,2,1,8,29,33,0,9,37,1,43,53,53,0,43,53,53,0,255,255,0,33,0,0,4,172,6,
+193,2,38,0,36,0,0,1,7,1,77,0,0,1,82,0,21,180,2,17,5,38,2,184,255,255,180,
+15,16,4,7,37,1,43,53,0,43,53,0,255,255,0,135,255,236,4,2,5,111,2,38,0,68,
+0,0,1,6,1,77,247,0,0,19,64,11,2,36,17,38,2,24,34,35,8,22,37,1,43,53,0,43,
+53,0,255,255,0,33,0,0,4,172,7,64,2,38,0,36,0,0,1,7,1,78,255,253,1,82,0,21,
+180,2,18,5,38,2,184,255,253,180,20,15,4,7,37,1,43,53,0,43,53,0,255,255,0,
+135,255,236,4,2,5,238,2,38,0,68,0,0,1,6,1,78,245,0,0,19,64,11,2,37,17,38,
+2,22,39,34,8,22,37,1,43,53,0,43,53,0,255,255,0,33,254,57,4,190,5,188,2,38,
+0,36,0,0,1,7,1,81,1,143,0,0,0,24,64,16,2,32,23,1,16,23,1,0,23,1,0,23,23,0,
+0,37,1,43,93,93,93,53,255,255,0,135,254,57,4,82,4,94,2,38,0,68,0,0,1,7,1,
+81,1,35,0,0,0,36,64,25,2,128,42,1,112,42,1,96,42,1,32,42,1,16,42,1,0,42,1,
+0,42,42,0,0,37,1,43,93,93,93,93,93,93,53,255,255,0,129,255,236,4,156,7,115,
+2,38,0,38,0,0,1,7,0,118,0,242,1,82,0,19,64,11,1,28,5,38,1,202,22,25,6,11,
+37,1,43,53,0,43,53,0,255,255,0,172,255,236,4,37,6,33,2,38,0,70,0,0,1,7,0,
+118,0,160,0,0,0,19,64,11,1,26,17,38,1,158,20,23,15,0,37,1,43,53,0,43,53,0,
+255,255,0,129,255,236,4,156,7,115,2,38,0,38,0,0,1,7,1,75,0,160,1,82,0,39,
+64,26,1,22,5,38,1,208,28,1,176,28,1,128,28,1,112,28,1,80,28,1,120,28,22,6,
+11,37,1,43,93,93,93,93,93,53,0,43,53,0,255,255,0,172,255,236,4,37,6,33,2,
+38,0,70,0,0,1,6,1,75,84,0,0,19,64,11,1,20,17,38,1,82,26,20,15,0,37,1,43,53,
+0,43,53,0,255,255,0,129,255,236,4,156,7,55,2,38,0,38,0,0,1,7,1,79,0,164,1,
+82,0,19,64,11,1,26,5,38,1,124,28,24,6,11,37,1,43,53,0,43,53,0,255,255,0,172,
+255,236,4,37,5,229,2,38,0,70,0,0,1,6,1,79,84,0,0,19,64,11,1,24,17,38,1,82,
+26,22,15,0,37,1,43,53,0,43,53,0,255,255,0,129,255,236,4,156,7,115,2,38,0,
+38,0,0,1,7,1,76,0,154,1,82,0,19,64,11,1,26,5,38,1,114,30,22,6,11,37,1,43,
+53,0,43,53,0,255,255,0,172,255,236,4,37,6,33,2,38,0,70,0,0,1,6,1,76,92,0,
+0,19,64,11,1,24,17,38,1,90,28,20,15,0,37,1,43,53,0,43,53,0,255,255,0,135,
+0,0,4,123,7,115,2,38,0,39,0,0,1,7,1,76,255,247,1,82,0,21,180,2,20,5,38,2,
+184,255,221,180,24,16,0,5,37,1,43,53,0,43,53,0,255,255,0,79,255,236,5,35,
+6,20,0,38,0,71,198,0,1,7,2,56,2,68,0,0,0,30,64,11,2,2,127,30,1,111,30,1,79,
+30,1,184,2,136,180,30,34,6,16,37,1,43,93,93,93,53,0,53,255,255,0,0,0,0,4,
+123,5,182,2,6,0,146,0,0,0,2,0,137,255,236,4,203,6,20,0,26,0,37,0,89,64,55,
+16,6,0,12,15,18,4,27,71,23,21,144,25,160,25,2,25,39,33,72,0,6,224,6,240,6,
+3,6,24,16,79,21,17,17,19,12,31,80,0,9,16,9,32,9,3,9,9,19,0,35,80,3,22,26,
+21,0,63,63,225,63,57,47,93,225,50,18,57,47,51,225,50,1,47,93,225,16,222,93,
+50,50,225,23,50,17,57,49,48,37,35,6,35,34,2,17,16,18,51,50,23,51,38,53,53,
+33,53,33,53,51,21,51,21,35,17,35,3,53,52,38,35,32,17,16,33,50,54,3,129,8,
+113,209,201,229,230,200,208,114,12,12,254,133,1,123,182,156,156,147,35,139,
+152,254,240,1,18,151,134,147,167,1,32,1,2,1,4,1,35,159,126,35,158,137,182,
+182,137,251,43,1,231,39,216,184,254,110,254,119,166,0,255,255,0,217,0,0,4,
+35,6,193,2,38,0,40,0,0,1,7,1,77,0,10,1,82,0,21,180,1,14,5,38,1,184,255,242,
+180,12,13,1,0,37,1,43,53,0,43,53,0,255,255,0,133,255,236,4,72,5,111,2,38,
+0,72,0,0,1,6,1,77,20,0,0,19,64,11,2,25,17,38,2,19,23,24,11,0,37,1,43,53,0,
+43,53,0,255,255,0,217,0,0,4,35,7,64,2,38,0,40,0,0,1,7,1,78,0,29,1,82,0,19,
+64,11,1,15,5,38,1,5,17,12,1,0,37,1,43,53,0,43,53,0,255,255,0,133,255,236,
+4,72,5,238,2,38,0,72,0,0,1,6,1,78,16,0,0,19,64,11,2,26,17,38,2,15,28,23,11,
+0,37,1,43,53,0,43,53,0,255,255,0,217,0,0,4,35,7,26,2,38,0,40,0,0,1,7,1,79,
+0,35,1,53,0,19,64,11,1,16,5,38,1,11,18,14,1,0,37,1,43,53,0,43,53,0,255,255,
+0,133,255,236,4,72,5,229,2,38,0,72,0,0,1,6,1,79,23,0,0,19,64,11,2,27,17,38,
+2,23,29,25,11,0,37,1,43,53,0,43,53,0,255,255,0,217,254,57,4,35,5,182,2,38,
+0,40,0,0,1,7,1,81,0,205,0,0,0,14,183,1,1,181,18,12,1,0,37,1,43,53,0,53,255,
+255,0,133,254,88,4,72,4,94,2,38,0,72,0,0,1,7,1,81,0,227,0,31,0,14,183,2,2,
+227,29,23,11,0,37,1,43,53,0,53,255,255,0,217,0,0,4,35,7,115,2,38,0,40,0,0,
+1,7,1,76,0,35,1,82,0,19,64,11,1,16,5,38,1,11,20,12,1,0,37,1,43,53,0,43,53,
+0,255,255,0,133,255,236,4,72,6,33,2,38,0,72,0,0,1,6,1,76,25,0,0,19,64,11,
+2,27,17,38,2,25,31,23,11,0,37,1,43,53,0,43,53,0,255,255,0,117,255,236,4,70,
+7,115,2,38,0,42,0,0,1,7,1,75,0,80,1,82,0,19,64,11,1,25,5,38,1,89,31,25,7,
+1,37,1,43,53,0,43,53,0,255,255,0,102,254,20,4,102,6,33,2,38,0,74,0,0,1,6,
+1,75,247,0,0,21,180,3,55,17,38,3,184,255,248,180,61,55,22,0,37,1,43,53,0,
+43,53,0,255,255,0,117,255,236,4,70,7,64,2,38,0,42,0,0,1,7,1,78,0,98,1,82,
+0,27,64,17,1,28,5,38,1,16,30,1,0,30,1,106,30,25,7,1,37,1,43,93,93,53,0,43,
+53,0,255,255,0,102,254,20,4,102,5,238,2,38,0,74,0,0,1,6,1,78,243,0,0,21,180,
+3,58,17,38,3,184,255,243,180,60,55,22,0,37,1,43,53,0,43,53,0,255,255,0,117,
+255,236,4,70,7,55,2,38,0,42,0,0,1,7,1,79,0,109,1,82,0,19,64,11,1,29,5,38,
+1,118,31,27,7,1,37,1,43,53,0,43,53,0,255,255,0,102,254,20,4,102,5,229,2,38,
+0,74,0,0,1,6,1,79,255,0,0,19,64,11,3,59,17,38,3,0,61,57,22,0,37,1,43,53,0,
+43,53,0,255,255,0,117,254,59,4,70,5,203,2,38,0,42,0,0,1,6,2,57,57,0,0,19,
+64,11,1,27,20,39,1,65,25,28,7,1,37,1,43,53,0,43,53,0,255,255,0,102,254,20,
+4,102,6,33,2,38,0,74,0,0,1,6,2,58,45,0,0,19,64,11,3,57,17,38,3,45,58,55,22,
+0,37,1,43,53,0,43,53,0,255,255,0,135,0,0,4,70,7,115,2,38,0,43,0,0,1,7,1,75,
+0,0,1,82,0,19,64,11,1,12,5,38,1,0,18,12,5,0,37,1,43,53,0,43,53,0,255,255,
+0,160,0,0,4,45,7,170,2,38,0,75,0,0,1,7,1,75,0,14,1,137,0,19,64,11,1,18,2,
+38,1,14,24,18,7,16,37,1,43,53,0,43,53,0,0,2,0,0,0,0,4,205,5,182,0,19,0,23,
+0,88,64,48,20,4,12,90,9,7,11,25,23,3,15,90,18,0,224,16,240,16,2,16,14,95,
+23,22,10,104,18,1,18,96,19,7,3,19,104,23,1,23,19,23,19,1,16,11,18,5,1,3,0,
+63,51,63,51,18,57,57,47,47,93,17,51,51,16,225,93,50,50,16,225,1,47,93,51,
+51,225,50,50,16,222,50,50,225,50,50,49,48,19,53,51,21,33,53,51,21,51,21,35,
+17,35,17,33,17,35,17,35,53,1,53,33,21,135,187,2,73,187,135,135,187,253,183,
+187,135,3,139,253,183,4,195,243,243,243,243,150,251,211,2,170,253,86,4,45,
+150,254,139,223,223,0,1,0,4,0,0,4,45,6,20,0,27,0,82,64,49,17,8,0,71,144,27,
+160,27,2,27,29,15,19,20,3,7,71,12,10,0,8,176,8,2,8,18,10,79,15,11,11,13,20,
+3,80,0,23,16,23,32,23,3,23,23,13,0,8,0,21,0,63,50,63,57,47,93,225,50,18,57,
+47,51,225,50,1,47,93,51,51,225,23,50,16,222,93,225,18,57,49,48,33,17,16,35,
+34,6,21,17,35,17,35,53,51,53,51,21,33,21,33,21,7,51,54,51,50,22,21,17,3,119,
+236,162,147,182,156,156,184,1,162,254,92,10,10,108,238,192,189,2,154,1,4,
+187,211,253,240,4,213,137,182,182,137,184,144,168,191,210,253,92,255,255,
+0,225,0,0,3,233,7,53,2,38,0,44,0,0,1,7,1,82,0,0,1,82,0,19,64,11,1,12,5,38,
+1,0,13,22,1,0,37,1,43,53,0,43,53,0,255,255,0,197,0,0,4,51,5,227,2,38,0,243,
+0,0,1,6,1,82,253,0,0,21,180,1,10,17,38,1,184,255,231,180,11,20,7,5,37,1,43,
+53,0,43,53,0,255,255,0,225,0,0,3,233,6,193,2,38,0,44,0,0,1,7,1,77,0,2,1,82,
+0,19,64,11,1,14,5,38,1,2,12,13,1,0,37,1,43,53,0,43,53,0,255,255,0,197,0,0,
+4,51,5,111,2,38,0,243,0,0,1,6,1,77,0,0,0,21,180,1,12,17,38,1,184,255,234,
+180,10,11,7,5,37,1,43,53,0,43,53,0,255,255,0,225,0,0,3,233,7,64,2,38,0,44,
+0,0,1,7,1,78,0,0,1,82,0,19,64,11,1,15,5,38,1,1,17,12,1,0,37,1,43,53,0,43,
+53,0,255,255,0,197,0,0,4,51,5,238,2,38,0,243,0,0,1,6,1,78,25,0,0,19,64,11,
+1,13,17,38,1,3,15,0,3,5,37,1,43,53,0,43,53,0,255,255,0,225,254,57,3,233,5,
+182,2,38,0,44,0,0,1,6,1,81,8,0,0,14,183,1,1,9,18,12,1,0,37,1,43,53,0,53,255,
+255,0,197,254,57,4,51,6,14,2,38,0,76,0,0,1,6,1,81,25,0,0,14,183,2,2,3,25,
+19,16,14,37,1,43,53,0,53,255,255,0,225,0,0,3,233,7,55,2,38,0,44,0,0,1,7,1,
+79,0,0,1,82,0,19,64,11,1,16,5,38,1,1,18,14,1,0,37,1,43,53,0,43,53,0,0,1,0,
+197,0,0,4,51,4,74,0,9,0,41,64,21,5,4,71,8,1,86,9,1,9,9,10,11,4,9,78,7,21,
+0,78,2,15,0,63,225,63,225,50,17,18,1,57,47,93,51,51,225,50,49,48,1,37,53,
+33,17,5,21,33,53,37,2,29,254,243,1,195,1,96,252,146,1,88,3,186,21,123,252,
+69,20,123,123,20,0,0,2,0,156,255,236,4,35,5,182,0,3,0,15,0,66,64,40,2,90,
+1,10,90,11,31,4,1,159,11,175,11,2,0,1,224,1,240,1,3,1,4,11,11,4,1,3,16,17,
+7,96,5,14,19,10,1,3,0,18,0,63,63,51,63,51,225,17,18,1,23,57,47,47,47,93,93,
+93,16,225,16,225,49,48,51,17,51,17,55,53,22,51,50,17,17,51,17,16,33,34,156,
+186,150,93,93,194,187,254,147,133,5,182,250,74,23,163,45,1,27,4,14,251,254,
+254,56,0,0,4,0,188,254,20,4,14,6,14,0,8,0,17,0,21,0,36,0,88,64,50,2,20,71,
+21,7,21,16,27,71,32,11,32,0,30,1,0,22,1,0,21,1,21,22,30,32,32,30,22,21,4,
+37,38,25,80,23,35,27,28,78,18,30,15,21,21,14,5,83,9,0,0,0,63,50,229,50,63,
+63,51,225,63,51,225,17,18,1,23,57,47,47,47,47,93,93,93,17,51,16,225,50,17,
+51,16,225,50,49,48,1,50,21,20,6,35,34,53,52,33,50,21,20,6,35,34,53,52,1,51,
+17,35,1,53,22,51,50,53,17,39,53,33,17,20,6,35,34,1,39,106,63,43,107,2,228,
+106,63,43,107,253,150,182,182,1,43,88,102,164,215,1,141,170,151,123,6,14,
+114,58,57,115,114,114,58,57,115,114,254,60,251,182,254,55,154,39,215,4,57,
+21,123,251,65,182,193,0,255,255,0,137,255,236,4,190,7,115,2,38,0,45,0,0,1,
+7,1,75,1,12,1,82,0,19,64,11,1,14,5,38,1,0,20,14,7,8,37,1,43,53,0,43,53,0,
+255,255,0,135,254,20,3,198,6,33,2,38,1,75,20,0,1,6,2,55,0,0,0,21,180,1,25,
+23,39,1,184,255,116,180,16,26,6,0,37,1,43,53,0,43,53,0,255,255,0,211,254,
+59,4,174,5,182,2,38,0,46,0,0,1,6,2,57,27,0,0,21,180,1,15,20,39,1,184,255,
+193,180,13,16,5,0,37,1,43,53,0,43,53,0,255,255,0,215,254,59,4,139,6,20,2,
+38,0,78,0,0,1,6,2,57,2,0,0,21,180,1,17,23,39,1,184,255,183,180,15,18,10,5,
+37,1,43,53,0,43,53,0,0,1,0,215,0,0,4,139,4,74,0,14,0,119,64,11,25,6,41,6,
+57,6,3,8,6,1,4,184,255,224,64,62,16,20,72,70,4,86,4,2,9,2,1,9,1,1,27,7,43,
+7,59,7,3,7,4,5,2,3,3,6,5,32,16,19,72,0,5,96,5,2,5,5,16,13,0,9,70,0,10,96,
+10,2,10,4,7,7,0,2,10,5,21,11,2,15,0,63,51,63,51,18,57,57,17,51,1,47,93,225,
+50,50,17,51,47,93,43,51,51,47,51,17,57,57,49,48,0,93,1,93,93,93,43,93,93,
+1,55,1,51,1,1,35,1,7,17,35,17,51,17,3,1,127,137,1,146,213,254,18,2,10,213,
+254,86,129,180,180,16,1,252,166,1,168,254,2,253,180,1,213,82,254,125,4,74,
+254,221,254,213,0,255,255,0,233,0,0,4,31,7,115,2,38,0,47,0,0,1,7,0,118,255,
+101,1,82,0,21,180,1,12,5,38,1,184,255,72,180,6,9,0,4,37,1,43,53,0,43,53,0,
+255,255,0,188,0,0,4,43,7,172,2,38,0,79,0,0,1,7,0,118,0,78,1,139,0,19,64,11,
+1,16,2,38,1,65,10,13,7,5,37,1,43,53,0,43,53,0,255,255,0,233,254,59,4,31,5,
+182,2,38,0,47,0,0,1,6,2,57,8,0,0,21,180,1,8,20,39,1,184,255,234,180,6,9,0,
+4,37,1,43,53,0,43,53,0,255,255,0,188,254,59,4,43,6,20,2,38,0,79,0,0,1,6,2,
+57,234,0,0,21,180,1,12,23,39,1,184,255,221,180,10,13,7,5,37,1,43,53,0,43,
+53,0,255,255,0,233,0,0,4,31,5,183,2,38,0,47,0,0,1,7,2,56,1,0,255,163,0,14,
+183,1,1,226,6,10,0,4,37,1,43,53,0,53,255,255,0,188,0,0,4,82,6,20,2,38,0,79,
+0,0,1,7,2,56,1,115,0,0,0,17,177,1,1,184,1,102,180,10,14,7,5,37,1,43,53,0,
+53,0,255,255,0,233,0,0,4,31,5,182,2,38,0,47,0,0,1,7,1,79,0,242,253,148,0,
+14,183,1,1,212,12,8,0,4,37,1,43,53,0,53,255,255,0,188,0,0,4,55,6,20,2,38,
+0,79,0,0,1,7,1,79,1,102,253,56,0,21,180,1,1,127,16,1,184,1,89,180,16,12,7,
+5,37,1,43,93,53,0,53,0,0,1,0,72,0,0,4,68,5,182,0,13,0,125,64,54,10,1,2,9,
+2,7,4,3,8,3,121,8,137,8,153,8,3,10,8,26,8,42,8,3,118,2,134,2,150,2,3,5,2,
+21,2,37,2,3,9,9,0,13,15,7,11,90,0,3,4,3,0,0,1,0,184,255,192,64,21,12,15,72,
+0,1,10,4,7,4,2,8,2,8,2,0,5,3,11,95,0,18,0,63,225,63,18,57,57,47,47,18,23,
+57,1,47,43,93,51,51,47,16,225,50,16,206,17,57,47,49,48,93,93,93,93,16,125,
+135,4,196,196,16,135,196,196,33,17,7,39,55,17,51,17,37,23,5,17,33,21,1,14,
+125,73,198,187,1,43,78,254,135,2,123,1,236,78,125,125,3,30,253,88,189,125,
+238,254,70,166,0,0,1,0,188,0,0,4,43,6,20,0,17,0,141,64,22,105,11,1,102,3,
+1,11,0,1,10,1,8,3,2,9,2,10,24,13,22,72,2,184,255,232,64,60,13,22,72,13,111,
+10,127,10,2,10,10,8,12,71,17,3,5,16,3,17,64,2,208,2,224,2,3,2,2,93,17,1,79,
+17,1,17,17,18,19,17,12,78,14,0,11,3,8,4,1,9,1,9,1,6,14,21,4,78,6,0,0,63,225,
+63,18,57,57,47,47,18,23,57,16,225,50,17,18,1,57,47,93,93,51,47,93,17,23,51,
+16,225,50,50,47,93,50,49,48,0,43,43,16,125,135,196,196,16,135,196,196,0,93,
+93,1,7,39,55,17,37,53,33,17,55,23,7,17,5,21,33,53,37,2,20,141,78,219,254,
+244,1,195,164,77,241,1,96,252,145,1,88,2,80,92,121,143,2,137,21,122,253,95,
+108,121,159,253,200,20,123,123,20,0,255,255,0,135,0,0,4,68,7,115,2,38,0,49,
+0,0,1,7,0,118,0,98,1,82,0,19,64,11,1,22,5,38,1,99,16,19,7,0,37,1,43,53,0,
+43,53,0,255,255,0,160,0,0,4,45,6,33,2,38,0,81,0,0,1,6,0,118,111,0,0,19,64,
+11,1,23,17,38,1,111,17,20,7,15,37,1,43,53,0,43,53,0,255,255,0,135,254,59,
+4,68,5,182,2,38,0,49,0,0,1,6,2,57,206,0,0,21,180,1,18,20,39,1,184,255,207,
+180,16,19,7,0,37,1,43,53,0,43,53,0,255,255,0,160,254,59,4,45,4,94,2,38,0,
+81,0,0,1,6,2,57,228,0,0,21,180,1,19,23,39,1,184,255,228,180,17,20,7,15,37,
+1,43,53,0,43,53,0,255,255,0,135,0,0,4,68,7,115,2,38,0,49,0,0,1,7,1,76,255,
+253,1,82,0,21,180,1,20,5,38,1,184,255,254,180,24,16,7,0,37,1,43,53,0,43,53,
+0,255,255,0,160,0,0,4,45,6,33,2,38,0,81,0,0,1,6,1,76,12,0,0,19,64,11,1,21,
+17,38,1,12,25,17,7,15,37,1,43,53,0,43,53,0,0,2,255,240,0,0,4,106,5,182,0,
+6,0,24,0,55,64,30,7,71,24,26,17,13,71,47,14,1,14,6,1,252,3,4,17,10,80,21,
+16,15,15,24,14,21,3,253,6,0,0,63,237,63,51,63,63,225,50,1,47,51,237,50,47,
+93,225,50,16,222,225,49,48,1,23,6,3,35,54,19,1,17,16,35,32,17,17,35,17,51,
+23,51,54,54,51,32,17,17,1,27,14,50,126,137,60,40,3,96,219,254,227,182,148,
+26,10,42,173,103,1,110,5,182,22,197,254,230,242,1,3,250,74,2,195,1,4,254,
+114,253,199,4,74,148,78,90,254,111,253,51,0,1,0,135,254,123,4,68,5,182,0,
+24,0,98,181,24,8,14,24,72,7,184,255,240,64,54,16,24,72,69,7,85,7,101,7,3,
+52,7,1,21,7,37,7,2,6,7,1,19,19,5,24,8,12,251,13,26,7,1,4,251,0,5,224,5,240,
+5,3,5,22,95,20,17,12,0,6,3,24,8,5,18,0,63,51,51,63,51,51,47,51,225,1,47,93,
+225,50,50,16,222,225,50,50,17,57,47,49,48,93,93,93,93,43,43,1,35,18,21,17,
+35,17,51,1,51,2,53,17,51,17,20,6,35,34,39,53,22,51,50,53,1,41,8,18,172,213,
+2,66,10,18,174,200,187,94,62,77,81,211,4,186,254,235,140,252,231,5,182,251,
+152,1,18,129,2,213,250,94,198,211,24,160,20,225,0,0,1,0,160,254,20,4,45,4,
+94,0,24,0,60,64,35,14,14,1,19,71,144,10,160,10,2,10,26,4,0,71,0,1,176,1,2,
+1,17,80,15,12,27,4,22,80,7,16,2,15,1,21,0,63,63,63,225,50,63,51,225,1,47,
+93,225,50,16,222,93,225,17,57,47,49,48,33,35,17,51,23,51,54,51,32,17,17,16,
+33,34,39,53,22,51,50,53,17,16,35,32,17,1,86,182,147,27,10,103,233,1,133,254,
+221,81,52,54,61,127,238,254,205,4,74,148,168,254,111,252,149,254,178,25,148,
+21,170,3,109,1,4,254,114,0,255,255,0,84,255,236,4,123,6,193,2,38,0,50,0,0,
+1,7,1,77,0,4,1,82,0,19,64,11,2,22,5,38,2,2,20,21,2,7,37,1,43,53,0,43,53,0,
+255,255,0,115,255,236,4,88,5,111,2,38,0,82,0,0,1,6,1,77,0,0,0,19,64,11,2,
+22,17,38,2,0,20,21,3,9,37,1,43,53,0,43,53,0,255,255,0,84,255,236,4,123,7,
+64,2,38,0,50,0,0,1,7,1,78,255,255,1,82,0,21,180,2,23,5,38,2,184,255,254,180,
+25,20,2,7,37,1,43,53,0,43,53,0,255,255,0,115,255,236,4,88,5,238,2,38,0,82,
+0,0,1,6,1,78,0,0,0,19,64,11,2,23,17,38,2,0,25,20,3,9,37,1,43,53,0,43,53,0,
+255,255,0,84,255,236,4,123,7,115,2,38,0,50,0,0,1,7,1,83,0,80,1,82,0,23,64,
+13,3,2,26,5,38,3,2,78,20,31,2,7,37,1,43,53,53,0,43,53,53,0,255,255,0,115,
+255,236,4,88,6,33,2,38,0,82,0,0,1,6,1,83,82,0,0,23,64,13,3,2,26,17,38,3,2,
+82,20,31,3,9,37,1,43,53,53,0,43,53,53,0,0,2,0,20,255,236,4,203,5,205,0,19,
+0,28,0,73,64,41,14,18,90,16,20,1,20,16,20,16,6,12,0,30,25,90,6,17,95,104,
+14,1,14,14,19,12,95,11,3,23,95,8,4,27,95,4,19,19,95,0,18,0,63,225,63,225,
+63,225,63,225,18,57,47,93,225,1,47,225,16,206,50,17,57,57,47,47,93,225,50,
+49,48,33,33,7,6,35,32,17,16,33,50,23,33,21,33,17,33,21,33,17,33,37,17,38,
+35,32,17,16,33,50,4,203,253,194,48,51,46,254,24,2,0,82,72,2,29,254,114,1,
+103,254,153,1,142,253,192,58,73,254,201,1,53,70,10,10,2,243,2,238,23,164,
+254,60,162,253,248,12,4,88,33,253,180,253,178,0,0,3,0,57,255,236,4,150,4,
+94,0,26,0,36,0,41,0,108,64,41,10,0,41,17,71,16,29,64,29,80,29,112,29,128,
+29,176,29,192,29,208,29,8,29,29,5,37,70,22,16,64,10,22,72,11,16,1,16,43,34,
+71,5,184,255,192,64,24,18,24,72,5,17,80,41,41,27,39,10,31,80,12,8,16,19,0,
+27,80,24,21,2,22,0,63,51,51,225,50,50,63,51,225,50,50,18,57,47,225,1,47,43,
+225,16,222,93,43,50,225,17,57,47,93,225,50,57,57,49,48,37,6,35,34,2,17,16,
+18,51,50,23,54,51,50,18,21,21,33,18,51,50,55,21,6,35,34,38,37,50,17,16,35,
+34,6,21,20,22,1,16,35,34,3,2,139,88,178,146,182,176,154,171,89,84,158,131,
+154,254,73,3,186,108,96,94,123,87,143,254,228,168,170,90,78,79,2,179,123,
+125,12,201,221,1,51,1,8,1,12,1,43,217,217,254,245,224,113,254,137,76,162,
+73,118,33,1,154,1,170,206,210,211,209,2,19,1,49,254,207,0,255,255,0,186,0,
+0,4,147,7,115,2,38,0,53,0,0,1,7,0,118,0,29,1,82,0,21,180,2,27,5,38,2,184,
+255,221,180,21,24,2,9,37,1,43,53,0,43,53,0,255,255,1,8,0,0,4,35,6,33,2,38,
+0,85,0,0,1,6,0,118,92,0,0,19,64,11,1,23,17,38,1,45,17,20,8,0,37,1,43,53,0,
+43,53,0,255,255,0,186,254,59,4,147,5,182,2,38,0,53,0,0,1,6,2,57,253,0,0,21,
+180,2,23,20,39,2,184,255,189,180,21,24,2,9,37,1,43,53,0,43,53,0,255,255,0,
+187,254,59,4,35,4,94,2,38,0,85,0,0,1,7,2,57,254,216,0,0,0,38,64,17,1,19,23,
+39,1,95,17,1,63,17,1,31,17,1,15,17,1,184,254,169,180,17,20,8,0,37,1,43,93,
+93,93,93,53,0,43,53,255,255,0,186,0,0,4,147,7,115,2,38,0,53,0,0,1,7,1,76,
+255,226,1,82,0,21,180,2,25,5,38,2,184,255,162,180,29,21,2,9,37,1,43,53,0,
+43,53,0,255,255,1,8,0,0,4,35,6,33,2,38,0,85,0,0,1,6,1,76,12,0,0,21,180,1,
+21,17,38,1,184,255,221,180,25,17,8,0,37,1,43,53,0,43,53,0,255,255,0,141,255,
+236,4,63,7,115,2,38,0,54,0,0,1,7,0,118,0,96,1,82,0,19,64,11,1,38,5,38,1,96,
+32,35,0,27,37,1,43,53,0,43,53,0,255,255,0,203,255,236,4,2,6,33,2,38,0,86,
+0,0,1,6,0,118,94,0,0,19,64,11,1,38,17,38,1,94,32,35,0,27,37,1,43,53,0,43,
+53,0,255,255,0,141,255,236,4,63,7,115,2,38,0,54,0,0,1,7,1,75,0,20,1,82,0,
+19,64,11,1,32,5,38,1,20,38,32,0,27,37,1,43,53,0,43,53,0,255,255,0,203,255,
+236,4,2,6,33,2,38,0,86,0,0,1,6,1,75,23,0,0,19,64,11,1,32,17,38,1,23,38,32,
+0,27,37,1,43,53,0,43,53,0,255,255,0,141,254,20,4,63,5,203,2,38,0,54,0,0,1,
+6,0,122,234,0,0,14,185,0,1,255,235,180,32,44,0,27,37,1,43,53,255,255,0,203,
+254,20,4,2,4,94,2,38,0,86,0,0,1,6,0,122,247,0,0,17,177,1,1,184,255,247,180,
+32,44,0,27,37,1,43,53,0,53,0,255,255,0,141,255,236,4,63,7,115,2,38,0,54,0,
+0,1,7,1,76,0,31,1,82,0,19,64,11,1,36,5,38,1,31,40,32,0,27,37,1,43,53,0,43,
+53,0,255,255,0,203,255,236,4,2,6,33,2,38,0,86,0,0,1,6,1,76,10,0,0,19,64,11,
+1,36,17,38,1,10,40,32,0,27,37,1,43,53,0,43,53,0,255,255,0,102,254,59,4,100,
+5,182,2,38,0,55,0,0,1,6,2,57,222,0,0,21,180,1,10,20,39,1,184,255,223,180,
+8,11,3,5,37,1,43,53,0,43,53,0,255,255,0,139,254,59,4,2,5,111,2,38,0,87,0,
+0,1,6,2,57,6,0,0,19,64,11,1,22,23,39,1,37,20,23,7,13,37,1,43,53,0,43,53,0,
+255,255,0,102,0,0,4,100,7,115,2,38,0,55,0,0,1,7,1,76,255,255,1,82,0,19,64,
+11,1,12,5,38,1,0,16,8,3,5,37,1,43,53,0,43,53,0,255,255,0,139,255,236,4,16,
+6,20,2,38,0,87,0,0,1,7,2,56,1,49,0,0,0,17,177,1,1,184,1,81,180,20,24,7,13,
+37,1,43,53,0,53,0,0,1,0,102,0,0,4,100,5,182,0,15,0,89,64,51,9,9,11,5,5,7,
+11,90,12,14,14,2,0,208,12,1,162,12,1,147,12,1,3,142,12,1,4,99,12,1,5,16,12,
+80,12,2,12,10,14,96,7,15,15,3,11,18,6,2,95,3,3,0,63,225,50,63,18,57,47,51,
+225,50,1,47,93,95,93,95,93,95,93,93,93,51,196,57,47,16,241,50,192,47,17,57,
+47,49,48,1,17,33,53,33,21,33,17,33,21,33,17,35,17,33,53,2,8,254,94,3,254,
+254,95,1,38,254,218,187,254,215,3,51,1,223,164,164,254,33,149,253,98,2,158,
+149,0,1,0,139,255,236,4,2,5,111,0,27,0,112,64,67,22,18,20,16,24,71,5,7,5,
+32,11,1,11,11,13,9,47,5,63,5,127,5,143,5,207,5,223,5,6,0,5,1,5,5,28,29,18,
+18,127,1,143,1,175,1,3,1,29,6,23,78,9,20,20,26,10,19,78,15,13,12,16,15,26,
+80,0,3,22,0,63,51,225,63,51,51,51,225,50,18,57,47,51,225,50,1,16,206,93,50,
+47,17,18,57,47,93,93,51,51,51,47,93,18,57,16,225,50,50,17,57,49,48,37,21,
+6,35,32,17,53,35,53,51,53,33,53,37,19,51,17,33,21,33,21,33,21,33,21,20,51,
+50,3,252,130,122,254,150,162,162,254,245,1,11,77,105,1,182,254,74,1,51,254,
+205,192,93,150,138,32,1,88,251,138,248,94,49,1,31,254,219,137,248,138,251,
+195,0,255,255,0,125,255,236,4,80,7,53,2,38,0,56,0,0,1,7,1,82,0,6,1,82,0,19,
+64,11,1,15,5,38,1,5,16,25,6,0,37,1,43,53,0,43,53,0,255,255,0,160,255,236,
+4,45,5,227,2,38,0,88,0,0,1,6,1,82,2,0,0,19,64,11,1,18,17,38,1,1,19,28,6,16,
+37,1,43,53,0,43,53,0,255,255,0,125,255,236,4,80,6,193,2,38,0,56,0,0,1,7,1,
+77,0,0,1,82,0,21,180,1,17,5,38,1,184,255,255,180,15,16,6,0,37,1,43,53,0,43,
+53,0,255,255,0,160,255,236,4,45,5,111,2,38,0,88,0,0,1,6,1,77,2,0,0,19,64,
+11,1,20,17,38,1,1,18,19,6,16,37,1,43,53,0,43,53,0,255,255,0,125,255,236,4,
+80,7,64,2,38,0,56,0,0,1,7,1,78,255,255,1,82,0,21,180,1,18,5,38,1,184,255,
+255,180,20,15,6,0,37,1,43,53,0,43,53,0,255,255,0,160,255,236,4,45,5,238,2,
+38,0,88,0,0,1,6,1,78,0,0,0,19,64,11,1,21,17,38,1,0,23,18,6,16,37,1,43,53,
+0,43,53,0,255,255,0,125,255,236,4,80,7,217,2,38,0,56,0,0,1,7,1,80,0,2,1,82,
+0,23,64,13,2,1,15,5,38,2,1,1,18,24,6,0,37,1,43,53,53,0,43,53,53,0,255,255,
+0,160,255,236,4,45,6,135,2,38,0,88,0,0,1,6,1,80,253,0,0,25,182,2,1,18,17,
+38,2,1,184,255,252,180,21,27,6,16,37,1,43,53,53,0,43,53,53,0,255,255,0,125,
+255,236,4,80,7,115,2,38,0,56,0,0,1,7,1,83,0,76,1,82,0,23,64,13,2,1,21,5,38,
+2,1,75,15,26,6,0,37,1,43,53,53,0,43,53,53,0,255,255,0,160,255,236,4,45,6,
+33,2,38,0,88,0,0,1,6,1,83,80,0,0,23,64,13,2,1,24,17,38,2,1,79,18,29,6,16,
+37,1,43,53,53,0,43,53,53,0,255,255,0,125,254,57,4,80,5,184,2,38,0,56,0,0,
+1,6,1,81,27,0,0,14,183,1,1,27,21,15,6,0,37,1,43,53,0,53,255,255,0,160,254,
+57,4,100,4,74,2,38,0,88,0,0,1,7,1,81,1,53,0,0,0,23,64,14,1,1,16,26,1,0,26,
+1,0,26,26,0,0,37,1,43,93,93,53,0,53,0,255,255,0,2,0,0,4,203,7,115,2,38,0,
+58,0,0,1,7,1,75,0,2,1,82,0,19,64,11,1,26,5,38,1,2,32,26,18,8,37,1,43,53,0,
+43,53,0,255,255,255,252,0,0,4,209,6,33,2,38,0,90,0,0,1,6,1,75,253,0,0,21,
+180,1,26,17,38,1,184,255,253,180,32,26,7,24,37,1,43,53,0,43,53,0,255,255,
+0,33,0,0,4,170,7,115,2,38,0,60,0,0,1,7,1,75,255,255,1,82,0,19,64,11,1,9,5,
+38,1,0,15,9,7,2,37,1,43,53,0,43,53,0,255,255,0,82,254,20,4,121,6,33,2,38,
+0,92,0,0,1,6,1,75,2,0,0,19,64,11,1,23,17,38,1,3,29,23,0,9,37,1,43,53,0,43,
+53,0,255,255,0,33,0,0,4,170,7,43,2,38,0,60,0,0,1,7,0,106,0,2,1,82,0,23,64,
+13,2,1,13,5,38,2,1,2,15,19,7,2,37,1,43,53,53,0,43,53,53,0,255,255,0,102,0,
+0,4,100,7,115,2,38,0,61,0,0,1,7,0,118,0,57,1,82,0,19,64,11,1,16,5,38,1,58,
+10,13,1,0,37,1,43,53,0,43,53,0,255,255,0,182,0,0,4,20,6,33,2,38,0,93,0,0,
+1,6,0,118,78,0,0,19,64,11,1,16,17,38,1,79,10,13,1,0,37,1,43,53,0,43,53,0,
+255,255,0,102,0,0,4,100,7,55,2,38,0,61,0,0,1,7,1,79,0,16,1,82,0,19,64,11,
+1,14,5,38,1,17,16,12,1,0,37,1,43,53,0,43,53,0,255,255,0,182,0,0,4,20,5,229,
+2,38,0,93,0,0,1,6,1,79,16,0,0,19,64,11,1,14,17,38,1,17,16,12,1,0,37,1,43,
+53,0,43,53,0,255,255,0,102,0,0,4,100,7,115,2,38,0,61,0,0,1,7,1,76,255,255,
+1,82,0,19,64,11,1,14,5,38,1,0,18,10,1,0,37,1,43,53,0,43,53,0,255,255,0,182,
+0,0,4,20,6,33,2,38,0,93,0,0,1,6,1,76,12,0,0,19,64,11,1,14,17,38,1,13,18,10,
+1,0,37,1,43,53,0,43,53,0,0,1,1,100,0,0,3,250,6,31,0,13,0,46,64,28,7,71,79,
+8,95,8,191,8,239,8,255,8,5,8,8,14,32,0,1,0,15,3,80,1,12,1,7,21,0,63,63,51,
+225,1,16,206,93,18,57,47,93,225,49,48,1,7,38,35,34,6,21,17,35,17,52,54,51,
+50,3,250,41,105,122,119,92,183,180,209,125,5,252,143,28,96,119,251,78,4,176,
+190,177,0,0,1,0,215,254,20,3,246,5,203,0,31,0,82,64,42,22,30,22,30,33,0,14,
+7,14,7,32,29,0,111,13,14,14,16,31,13,1,13,13,32,33,13,0,117,16,29,29,9,25,
+115,23,20,7,9,115,7,4,27,0,63,51,225,63,51,225,18,57,47,51,225,50,17,18,1,
+57,47,93,51,51,47,16,225,50,18,57,57,47,47,17,18,57,57,47,47,49,48,1,17,20,
+6,35,34,39,53,22,51,50,54,53,17,35,53,55,53,52,54,51,50,23,7,38,35,34,6,21,
+21,51,21,2,156,153,179,51,70,59,56,92,63,194,194,153,179,97,100,47,79,65,
+92,63,245,3,68,252,63,190,177,15,153,18,102,113,3,195,75,68,137,190,177,37,
+141,28,102,113,145,137,0,255,255,0,33,0,0,4,172,8,115,2,38,0,36,0,0,0,38,
+1,80,2,125,1,7,0,118,0,72,2,82,0,82,64,48,4,176,40,1,96,40,1,80,40,1,64,40,
+1,40,68,3,2,239,26,1,223,26,1,80,26,1,64,26,1,32,26,1,16,26,1,0,26,1,26,4,
+30,38,41,18,24,37,3,2,184,255,255,180,18,24,4,7,37,1,43,53,53,43,53,0,17,
+93,93,93,93,93,93,93,53,53,63,93,93,93,93,53,255,255,0,135,255,236,4,2,8,
+0,2,38,0,68,0,0,0,38,1,80,0,0,1,7,0,118,0,94,1,223,0,72,64,49,4,240,64,1,
+239,64,1,223,64,1,207,64,1,96,64,1,31,64,1,64,3,2,240,34,1,224,34,1,208,34,
+1,34,17,38,4,30,64,60,37,43,37,3,2,33,37,43,8,22,37,1,43,53,53,43,53,0,43,
+93,93,93,53,53,17,93,93,93,93,93,93,53,255,255,0,0,0,0,4,186,7,115,2,38,0,
+136,0,0,1,7,0,118,0,213,1,82,0,19,64,11,2,26,5,38,2,222,20,23,5,0,37,1,43,
+53,0,43,53,0,255,255,0,45,255,236,4,162,6,33,2,38,0,168,0,0,1,6,0,118,113,
+0,0,19,64,11,3,58,17,38,3,112,52,55,32,15,37,1,43,53,0,43,53,0,255,255,0,
+80,255,180,4,133,7,115,2,38,0,154,0,0,1,7,0,118,0,57,1,82,0,19,64,11,3,40,
+5,38,3,53,34,37,2,11,37,1,43,53,0,43,53,0,255,255,0,115,255,170,4,88,6,33,
+2,38,0,186,0,0,1,6,0,118,80,0,0,19,64,11,3,42,17,38,3,81,36,39,5,15,37,1,
+43,53,0,43,53,0,255,255,0,141,254,59,4,63,5,203,2,38,0,54,0,0,1,6,2,57,0,
+0,0,19,64,11,1,34,20,39,1,0,32,35,0,27,37,1,43,53,0,43,53,0,255,255,0,203,
+254,59,4,2,4,94,2,38,0,86,0,0,1,6,2,57,228,0,0,21,180,1,34,23,39,1,184,255,
+228,180,32,35,0,27,37,1,43,53,0,43,53,0,0,1,1,27,4,217,3,178,6,33,0,15,0,
+43,64,21,12,11,3,3,5,6,149,1,0,0,17,3,11,146,6,15,0,95,0,2,0,0,47,93,50,237,
+57,17,1,51,47,51,228,50,57,25,47,51,51,49,48,1,35,38,39,6,7,35,53,54,55,54,
+55,51,22,23,23,3,178,121,85,126,133,78,120,25,34,139,37,193,37,139,59,4,217,
+56,130,136,50,27,29,38,155,79,79,155,67,0,0,1,1,27,4,217,3,178,6,33,0,15,
+0,43,64,21,5,4,12,12,10,9,149,14,15,15,17,12,14,9,146,15,5,95,5,2,5,0,47,
+93,228,50,57,17,1,51,47,51,228,50,57,25,47,51,51,49,48,1,6,7,6,7,35,38,39,
+39,53,51,22,23,54,55,51,3,178,25,34,141,35,193,35,141,59,120,82,129,122,89,
+121,6,6,29,38,158,76,76,158,67,27,54,133,128,59,0,0,1,1,70,4,217,3,133,5,
+111,0,3,0,65,64,24,31,1,223,1,239,1,255,1,4,1,1,5,112,0,128,0,208,0,224,0,
+240,0,5,0,184,255,192,64,17,9,12,72,0,0,4,1,143,15,2,1,2,64,12,24,72,2,0,
+47,43,93,225,17,1,51,47,43,93,17,51,47,93,49,48,1,33,21,33,1,70,2,63,253,
+193,5,111,150,0,1,1,57,4,217,3,147,5,238,0,11,0,76,64,18,6,131,0,5,16,5,32,
+5,96,5,112,5,128,5,160,5,7,5,184,255,192,64,32,21,24,72,5,5,11,131,31,0,143,
+0,175,0,239,0,255,0,5,0,0,13,11,5,148,9,143,15,3,95,3,2,3,0,47,93,225,237,
+50,17,1,51,47,93,225,51,47,43,93,225,49,48,1,6,6,35,32,3,51,22,22,51,50,55,
+3,147,9,160,136,254,232,17,109,7,79,104,181,10,5,238,127,150,1,21,76,49,125,
+0,0,1,1,252,5,0,2,209,5,229,0,7,0,74,64,52,230,6,1,6,133,2,219,2,1,201,2,
+1,173,2,1,137,2,1,91,2,1,66,2,1,38,2,1,27,2,1,2,9,0,147,79,4,111,4,127,4,
+159,4,175,4,207,4,223,4,239,4,8,4,0,47,93,237,17,1,51,93,93,93,93,93,93,93,
+93,16,225,93,49,48,1,50,21,20,35,34,53,52,2,102,107,107,106,5,229,114,115,
+115,114,0,0,2,1,131,4,217,3,72,6,135,0,11,0,22,0,141,181,164,10,180,10,2,
+10,184,255,224,64,9,12,15,72,164,8,180,8,2,8,184,255,224,64,24,12,15,72,171,
+4,187,4,2,4,32,12,15,72,171,2,187,2,2,2,32,12,15,72,15,184,255,240,64,42,
+19,24,72,15,131,0,3,16,3,32,3,3,3,20,16,19,24,72,20,131,9,24,12,8,21,24,72,
+12,140,15,6,31,6,47,6,127,6,207,6,5,6,17,184,255,240,64,11,21,24,72,17,140,
+15,0,95,0,2,0,0,47,93,225,43,220,93,225,43,1,16,222,225,43,220,93,225,43,
+49,48,43,93,43,93,43,93,43,93,1,34,38,53,52,54,51,50,22,21,20,6,3,34,6,21,
+20,51,50,54,53,52,38,2,98,102,121,121,102,101,129,127,103,49,63,112,50,63,
+63,4,217,116,99,99,116,118,95,98,119,1,72,60,53,113,60,53,53,60,0,0,1,1,158,
+254,57,3,47,0,0,0,14,0,56,64,34,45,7,61,7,77,7,3,5,48,11,19,72,8,9,0,11,132,
+79,6,95,6,2,6,6,0,0,16,8,13,142,32,3,1,3,0,47,93,225,47,17,1,51,47,51,47,
+93,225,17,57,57,49,48,43,93,1,21,6,35,34,38,53,52,55,51,6,21,20,51,50,3,47,
+73,83,119,126,190,131,170,127,66,254,193,113,23,109,94,144,108,125,113,96,
+0,0,1,0,254,4,217,3,205,5,227,0,17,0,51,64,30,0,130,0,1,144,1,176,1,192,1,
+4,1,1,9,130,10,10,19,16,143,9,3,148,7,143,0,15,12,1,12,0,47,93,51,225,253,
+50,225,17,1,51,47,225,51,47,93,225,49,48,1,35,18,51,50,23,22,51,50,55,51,
+2,35,34,39,38,35,34,1,102,104,25,186,58,103,102,34,80,26,105,27,184,57,100,
+100,40,82,4,217,1,8,56,56,114,254,248,57,56,0,0,2,0,246,4,217,3,213,6,33,
+0,7,0,15,0,67,64,42,14,15,134,11,6,7,134,2,135,64,3,80,3,2,3,3,10,135,79,
+11,95,11,111,11,175,11,223,11,5,11,11,17,10,2,146,14,15,6,95,6,2,6,0,47,93,
+51,237,50,17,1,51,47,93,225,51,47,93,225,237,50,16,237,50,49,48,19,54,55,
+51,21,6,7,35,37,54,55,51,21,6,7,35,246,94,80,198,112,160,100,1,106,87,87,
+199,112,160,101,4,244,133,168,21,173,134,27,118,183,21,173,134,0,0,1,1,223,
+4,217,2,236,6,33,0,9,0,32,64,16,8,9,9,3,133,4,4,11,3,146,15,8,95,8,2,8,0,
+47,93,237,17,1,51,47,225,51,47,51,49,48,1,55,54,55,51,21,20,6,7,35,1,223,
+30,30,10,199,99,61,109,4,244,107,114,80,21,16,208,83,0,3,1,43,5,12,3,160,
+6,180,0,7,0,16,0,24,0,87,64,57,6,7,2,135,3,6,7,22,7,2,7,3,7,3,19,10,133,0,
+15,16,15,32,15,224,15,240,15,5,15,15,23,133,19,2,146,6,6,17,8,147,21,79,13,
+111,13,127,13,159,13,175,13,207,13,223,13,7,13,0,47,93,51,237,50,57,47,237,
+1,47,225,51,47,93,225,18,57,57,47,47,93,16,225,17,51,49,48,1,54,55,51,21,
+6,7,35,39,50,21,20,6,35,34,53,52,33,50,21,20,35,34,53,52,2,20,50,41,206,93,
+122,82,137,97,56,41,96,2,20,97,97,96,5,135,139,162,20,164,143,108,102,49,
+54,103,102,102,103,103,102,0,255,255,0,33,0,0,4,172,5,188,2,38,0,36,0,0,1,
+7,1,84,254,69,255,151,0,24,182,2,18,3,2,16,15,1,184,254,68,180,15,19,4,7,
+37,1,43,93,53,0,63,53,0,1,1,231,2,72,2,229,3,94,0,7,0,34,64,20,2,150,48,6,
+96,6,176,6,224,6,240,6,5,6,6,8,9,0,155,4,0,47,237,17,18,1,57,47,93,237,49,
+48,1,50,21,20,35,34,53,52,2,102,127,127,127,3,94,139,139,139,139,0,255,255,
+255,142,0,0,4,35,5,184,2,38,0,40,0,0,1,7,1,84,253,175,255,151,0,33,64,13,
+1,15,3,1,32,12,1,16,12,1,0,12,1,184,253,151,180,12,16,1,0,37,1,43,93,93,93,
+53,0,63,53,0,255,255,255,101,0,0,4,70,5,184,2,38,0,43,0,0,1,7,1,84,253,134,
+255,151,0,33,64,13,1,15,3,1,32,12,1,16,12,1,0,12,1,184,253,133,180,12,16,
+5,0,37,1,43,93,93,93,53,0,63,53,0,255,255,255,163,0,0,3,233,5,184,2,38,0,
+44,0,0,1,7,1,84,253,196,255,151,0,24,182,1,15,3,1,0,12,1,184,253,197,180,
+12,16,1,0,37,1,43,93,53,0,63,53,255,255,255,124,255,236,4,123,5,205,2,38,
+0,50,0,0,1,7,1,84,253,157,255,151,0,20,179,2,23,3,2,184,253,155,180,20,24,
+2,7,37,1,43,53,0,63,53,255,255,255,19,0,0,4,170,5,184,2,38,0,60,0,0,1,7,1,
+84,253,52,255,151,0,20,179,1,12,3,1,184,253,52,180,9,13,7,2,37,1,43,53,0,
+63,53,255,255,255,122,0,0,4,135,5,205,2,38,1,118,0,0,1,7,1,84,253,155,255,
+151,0,20,179,1,29,3,1,184,253,152,180,26,30,2,15,37,1,43,53,0,63,53,255,255,
+0,241,255,236,3,248,6,180,2,38,1,134,0,0,1,6,1,85,198,0,0,18,178,3,2,1,184,
+255,90,180,27,31,10,5,37,1,43,53,53,53,255,255,0,33,0,0,4,172,5,188,2,6,0,
+36,0,0,255,255,0,135,0,0,4,113,5,182,2,6,0,37,0,0,0,1,0,246,0,0,4,47,5,182,
+0,5,0,57,64,16,0,64,18,22,72,0,7,3,90,80,4,1,0,4,1,4,184,255,192,179,21,24,
+72,4,184,255,192,64,10,13,16,72,4,2,95,5,3,3,18,0,63,63,225,1,47,43,43,93,
+113,225,16,206,43,49,48,1,21,33,17,35,17,4,47,253,129,186,5,182,166,250,240,
+5,182,0,0,2,0,68,0,0,4,135,5,182,0,5,0,12,0,213,185,0,9,255,240,64,27,15,
+19,72,184,4,1,4,8,14,17,72,72,4,1,41,4,1,24,4,1,9,4,1,183,5,1,5,184,255,248,
+64,32,14,17,72,71,5,1,38,5,1,23,5,1,6,5,1,10,16,15,19,72,232,4,1,231,5,1,
+5,4,6,6,1,9,184,255,240,64,84,20,24,72,87,9,1,71,9,1,37,9,1,6,9,22,9,2,9,
+96,2,1,2,10,16,20,24,72,88,10,1,72,10,1,42,10,1,9,10,25,10,2,10,128,1,160,
+1,240,1,3,47,1,79,1,111,1,3,1,91,6,1,41,6,57,6,73,6,3,6,16,17,20,72,29,6,
+1,6,4,3,0,3,9,95,2,18,0,63,225,57,57,63,51,93,43,93,93,1,47,93,93,51,93,93,
+93,93,43,47,93,51,93,93,93,93,43,18,57,61,47,51,51,93,93,49,48,43,93,93,93,
+93,43,93,93,93,93,93,43,93,43,37,21,33,53,1,51,7,6,7,3,33,3,38,4,135,251,
+189,1,194,187,95,51,37,254,2,174,252,52,125,125,133,5,49,205,223,110,253,
+10,2,240,155,255,255,0,217,0,0,4,35,5,182,2,6,0,40,0,0,255,255,0,102,0,0,
+4,100,5,182,2,6,0,61,0,0,255,255,0,135,0,0,4,70,5,182,2,6,0,43,0,0,0,3,0,
+84,255,236,4,123,5,205,0,9,0,19,0,23,0,97,64,64,116,21,132,21,2,47,21,63,
+21,2,123,20,139,20,2,32,20,48,20,2,21,20,21,20,2,88,13,1,13,91,7,25,87,18,
+1,18,91,31,2,47,2,2,2,23,96,159,20,207,20,2,104,20,1,20,20,10,16,95,4,4,10,
+95,0,19,0,63,225,63,225,18,57,47,93,93,225,1,47,93,225,93,16,222,225,93,18,
+57,57,47,47,93,93,93,93,49,48,5,32,17,16,33,32,0,17,16,0,39,50,18,17,16,2,
+35,32,17,16,19,33,21,33,2,104,253,236,2,22,1,0,1,17,254,236,255,173,161,163,
+169,254,175,129,1,155,254,101,20,2,243,2,238,254,121,254,151,254,151,254,
+120,163,1,34,1,44,1,47,1,29,253,180,253,178,2,170,161,255,255,0,225,0,0,3,
+233,5,182,2,6,0,44,0,0,255,255,0,211,0,0,4,174,5,182,2,6,0,46,0,0,0,1,0,33,
+0,0,4,172,5,182,0,10,0,190,185,0,7,255,240,64,27,15,19,72,184,9,1,9,8,14,
+17,72,72,9,1,41,9,1,24,9,1,9,9,1,183,10,1,10,184,255,248,64,31,14,17,72,71,
+10,1,38,10,1,23,10,1,6,10,1,2,16,15,19,72,232,9,1,231,10,1,10,9,4,4,7,184,
+255,240,64,68,20,24,72,87,7,1,71,7,1,37,7,1,6,7,22,7,2,7,8,1,16,20,24,72,
+88,1,1,72,1,1,42,1,1,9,1,25,1,2,1,47,0,127,0,207,0,239,0,4,0,4,16,17,20,72,
+4,16,11,14,72,29,4,1,4,9,3,8,0,18,0,63,50,63,51,93,43,43,1,47,93,50,93,93,
+93,93,43,47,51,93,93,93,93,43,57,61,47,51,51,93,93,49,48,43,93,93,93,93,43,
+93,93,93,93,93,43,93,43,33,35,1,38,39,6,7,1,35,1,51,4,172,199,254,220,63,
+30,45,43,254,217,196,1,231,187,3,154,199,141,200,134,252,96,5,182,255,255,
+0,113,0,0,4,92,5,182,2,6,0,48,0,0,255,255,0,135,0,0,4,68,5,182,2,6,0,49,0,
+0,0,3,0,111,0,0,4,92,5,182,0,3,0,7,0,11,0,71,64,41,47,5,63,5,2,32,4,48,4,
+2,4,5,4,5,10,1,1,9,13,0,0,1,0,0,10,7,95,104,4,1,4,4,0,11,95,10,18,3,95,0,
+3,0,63,225,63,225,17,57,47,93,225,1,47,51,47,113,16,206,50,47,17,57,57,47,
+47,93,93,49,48,19,33,21,33,19,33,21,33,1,21,33,53,152,3,155,252,101,81,2,
+248,253,8,3,115,252,19,5,182,164,254,60,162,253,248,164,164,0,255,255,0,84,
+255,236,4,123,5,205,2,6,0,50,0,0,0,1,0,135,0,0,4,70,5,182,0,7,0,37,64,21,
+1,90,0,9,4,90,0,5,224,5,240,5,3,5,3,95,6,3,5,0,18,0,63,50,63,225,1,47,93,
+225,16,222,225,49,48,33,35,17,33,17,35,17,33,4,70,187,253,183,187,3,191,5,
+18,250,238,5,182,0,255,255,0,176,0,0,4,70,5,182,2,6,0,51,0,0,0,1,0,131,0,
+0,4,72,5,182,0,11,0,128,64,87,55,9,215,9,231,9,247,9,4,38,9,1,7,9,23,9,2,
+55,7,215,7,231,7,247,7,4,38,7,1,7,7,23,7,2,56,2,216,2,232,2,248,2,4,25,2,
+41,2,2,8,2,1,8,2,2,0,6,239,10,255,10,2,10,13,7,3,3,9,0,0,240,0,2,0,3,7,95,
+4,8,2,2,4,3,1,9,95,0,18,0,63,225,57,63,57,61,47,51,16,225,57,1,24,47,93,51,
+51,17,51,16,206,93,50,17,57,47,51,49,48,93,93,93,93,93,93,93,93,93,51,53,
+1,1,53,33,21,33,1,1,33,21,131,1,158,254,110,3,125,253,88,1,133,254,103,2,
+248,152,2,102,2,37,147,164,253,238,253,164,164,0,255,255,0,102,0,0,4,100,
+5,182,2,6,0,55,0,0,255,255,0,33,0,0,4,170,5,182,2,6,0,60,0,0,0,3,0,27,255,
+236,4,180,5,203,0,21,0,30,0,39,0,180,64,89,6,19,22,19,38,19,3,9,15,25,15,
+41,15,3,9,8,25,8,41,8,3,6,4,22,4,38,4,3,22,2,11,90,39,21,169,12,1,154,12,
+1,139,12,1,3,114,12,1,5,64,12,80,12,96,12,3,52,12,1,6,12,12,17,26,8,12,17,
+72,26,90,15,6,47,6,63,6,111,6,143,6,191,6,239,6,255,6,8,6,41,35,184,255,248,
+64,36,12,17,72,35,90,17,39,22,96,13,80,10,224,10,240,10,3,10,10,11,19,30,
+31,96,2,96,21,112,21,128,21,3,21,21,0,4,0,63,50,47,93,51,225,50,63,51,47,
+93,51,225,50,1,47,225,43,16,222,93,225,43,18,57,47,95,93,93,95,93,95,93,93,
+93,51,51,225,50,50,49,48,0,93,93,93,93,1,51,21,51,50,18,21,20,2,35,35,21,
+35,53,35,34,2,53,52,18,51,51,19,51,50,54,53,52,38,43,3,34,6,21,20,22,51,51,
+2,20,166,47,213,246,253,228,25,166,24,230,251,245,213,47,166,7,155,172,158,
+143,33,166,32,143,158,172,155,6,5,203,180,254,203,236,236,254,195,225,225,
+1,62,235,235,1,54,252,83,213,187,172,209,209,172,187,213,0,255,255,0,53,0,
+0,4,150,5,182,2,6,0,59,0,0,0,1,0,57,0,0,4,150,5,182,0,27,0,117,64,78,21,5,
+90,18,169,6,1,6,22,18,73,139,6,1,3,114,6,1,5,80,6,96,6,2,52,6,68,6,2,6,6,
+6,11,25,90,15,0,47,0,63,0,111,0,143,0,5,0,29,14,90,144,11,160,11,192,11,208,
+11,4,11,21,119,18,135,18,2,18,96,4,7,7,5,26,19,12,3,5,18,0,63,63,51,51,18,
+57,47,51,225,93,50,1,47,93,225,16,222,93,225,17,57,47,95,93,93,95,93,95,93,
+43,93,51,225,50,49,48,1,16,6,35,35,17,35,17,35,34,38,17,17,51,17,20,22,51,
+51,17,51,17,51,50,54,53,17,51,4,150,232,227,17,166,16,230,229,172,138,149,
+16,166,17,149,137,173,3,215,254,225,250,254,66,1,190,251,1,26,1,227,254,33,
+231,148,3,90,252,166,144,231,1,227,0,0,1,0,74,0,0,4,135,5,205,0,25,0,119,
+185,0,14,255,232,64,78,10,20,72,14,192,18,208,18,2,79,18,95,18,127,18,143,
+18,191,18,5,9,18,25,18,2,18,4,24,10,20,72,4,64,0,80,0,2,3,0,19,0,2,0,0,6,
+88,20,1,20,91,15,12,27,87,24,1,24,91,3,31,6,47,6,2,6,22,95,9,4,0,14,18,3,
+3,95,17,2,18,0,63,51,225,23,50,63,225,1,47,93,51,225,93,16,222,50,225,93,
+18,57,47,93,93,51,43,198,93,93,93,50,43,49,48,37,21,33,53,33,38,17,16,0,51,
+50,0,17,16,5,33,21,33,53,36,17,16,33,32,17,16,2,29,254,45,1,10,254,1,24,250,
+250,1,25,255,0,1,12,254,43,1,4,254,176,254,177,147,147,164,235,1,170,1,56,
+1,92,254,164,254,200,254,83,232,164,147,231,1,187,1,244,254,12,254,69,255,
+255,0,225,0,0,3,233,7,43,2,38,0,44,0,0,1,7,0,106,0,2,1,82,0,23,64,13,2,1,
+16,5,38,2,1,2,18,22,1,0,37,1,43,53,53,0,43,53,53,0,255,255,0,33,0,0,4,170,
+7,43,2,38,0,60,0,0,1,7,0,106,0,2,1,82,0,23,64,13,2,1,13,5,38,2,1,2,15,19,
+7,2,37,1,43,53,53,0,43,53,53,0,255,255,0,121,255,236,4,154,6,33,2,38,1,126,
+0,0,1,6,1,84,16,0,0,21,180,2,46,17,38,2,184,255,236,180,38,42,22,11,37,1,
+43,53,0,43,53,0,255,255,0,201,255,236,4,8,6,33,2,38,1,130,0,0,1,6,1,84,96,
+0,0,19,64,11,1,40,17,38,1,93,32,36,14,24,37,1,43,53,0,43,53,0,255,255,0,160,
+254,20,4,45,6,33,2,38,1,132,0,0,1,6,1,84,80,0,0,19,64,11,1,25,17,38,1,79,
+17,21,7,15,37,1,43,53,0,43,53,0,255,255,1,172,255,236,3,248,6,33,2,38,1,134,
+0,0,1,6,1,84,247,0,0,19,64,11,1,20,17,38,1,42,12,12,11,11,37,1,43,53,0,43,
+53,0,255,255,0,160,255,236,4,59,6,180,2,38,1,146,0,0,1,6,1,85,253,0,0,25,
+181,3,2,1,3,2,1,184,255,245,180,33,37,0,12,37,1,43,53,53,53,0,53,53,53,0,
+0,2,0,121,255,236,4,154,4,94,0,26,0,37,0,61,64,34,16,0,28,71,11,127,7,143,
+7,2,7,39,33,72,0,22,1,22,16,9,35,80,11,14,14,19,22,0,31,80,25,16,3,15,0,63,
+63,225,50,63,51,17,51,225,50,50,1,47,93,225,16,220,93,50,225,50,50,49,48,
+1,51,54,55,51,6,17,17,20,51,50,55,21,6,35,34,39,35,6,35,34,2,17,16,18,51,
+50,19,53,52,38,35,32,17,16,33,50,54,3,94,12,30,38,143,51,84,29,31,52,63,159,
+40,12,108,205,195,223,230,206,210,85,134,147,254,250,1,8,148,127,3,182,103,
+45,166,254,239,254,93,111,10,133,26,167,167,1,41,1,14,1,17,1,42,253,182,15,
+227,193,254,90,254,98,184,0,0,2,0,158,254,20,4,80,6,31,0,19,0,38,0,81,64,
+46,42,31,1,0,17,15,29,1,29,29,9,33,72,17,17,24,71,3,40,20,9,71,0,10,176,10,
+2,10,0,28,80,29,29,6,14,9,27,22,80,20,6,22,36,80,14,1,0,63,225,63,51,225,
+63,17,18,57,47,225,57,1,47,93,225,50,16,222,225,51,47,225,18,57,47,93,18,
+57,49,48,93,1,21,4,17,20,6,35,34,39,17,35,17,52,54,51,50,22,21,20,6,1,22,
+51,32,17,52,38,35,35,53,51,50,54,53,52,38,35,32,17,2,211,1,125,245,216,186,
+117,182,238,208,198,236,161,253,231,135,154,1,37,190,159,94,70,142,161,134,
+114,254,248,3,61,6,48,254,151,205,229,63,253,233,6,52,226,245,210,183,136,
+182,253,121,80,1,43,146,165,152,150,126,118,132,254,182,0,0,1,0,82,254,20,
+4,121,4,74,0,15,0,107,64,37,2,72,3,5,0,3,68,10,84,10,116,10,132,10,180,10,
+5,10,10,6,14,8,9,12,72,14,16,15,32,15,48,15,3,15,15,17,7,184,255,248,64,16,
+9,12,72,7,47,6,63,6,2,6,6,16,14,6,15,10,184,255,240,64,9,9,12,72,10,0,5,21,
+2,27,0,63,63,51,51,43,63,51,17,1,51,47,93,51,43,17,51,47,93,51,43,18,57,25,
+47,93,57,51,51,16,225,49,48,37,2,17,35,52,19,1,51,19,22,23,51,54,55,19,51,
+2,227,110,191,101,254,55,192,242,71,36,6,26,72,229,189,63,254,232,254,237,
+207,1,41,4,62,253,176,174,146,104,191,2,105,0,0,2,0,135,255,236,4,70,6,31,
+0,25,0,34,0,79,64,49,43,0,1,9,0,25,0,2,13,70,0,26,2,2,24,33,72,7,239,18,255,
+18,2,18,36,28,72,0,24,224,24,240,24,3,24,16,0,26,3,5,31,80,21,22,10,80,8,
+5,1,0,63,51,225,63,225,17,23,57,1,47,93,225,16,222,93,50,225,17,57,47,57,
+57,225,49,48,93,93,1,38,53,52,54,51,50,23,7,38,35,34,6,21,20,22,23,4,17,20,
+0,35,34,36,53,16,37,4,17,20,22,51,32,17,52,2,45,254,182,160,199,194,73,169,
+159,74,86,84,172,1,105,254,253,225,213,254,250,2,37,254,156,152,130,1,39,
+3,170,145,203,133,148,109,145,106,73,64,63,103,100,206,254,200,246,254,240,
+247,211,1,116,44,100,254,192,135,168,1,94,244,0,0,1,0,201,255,236,4,8,4,94,
+0,31,0,81,64,47,17,19,0,0,14,24,127,9,143,9,2,9,33,29,71,19,19,4,71,0,14,
+1,14,17,2,80,191,31,1,121,31,137,31,2,31,31,6,27,80,25,22,16,6,80,8,11,22,
+0,63,51,225,63,51,225,18,57,47,93,93,225,57,1,47,93,225,51,47,225,16,206,
+93,50,17,57,47,18,57,49,48,1,21,35,32,21,20,33,50,55,21,6,35,34,38,53,52,
+55,53,38,53,52,54,51,50,23,7,38,35,34,21,20,33,3,72,160,254,211,1,27,196,
+170,134,243,211,239,237,202,224,189,216,167,63,161,155,243,1,20,2,135,153,
+185,180,86,160,75,168,151,193,75,11,66,183,135,156,76,147,72,154,166,0,1,
+0,162,254,111,4,43,6,20,0,28,0,137,64,87,10,20,26,20,42,20,3,6,9,22,9,38,
+9,3,11,25,27,25,43,25,3,25,2,2,16,16,9,14,72,16,70,14,144,11,1,11,30,28,5,
+72,0,22,160,22,2,22,153,19,1,123,19,139,19,2,109,19,1,73,19,1,59,19,1,45,
+19,1,121,8,137,8,2,107,8,1,73,8,1,59,8,1,45,8,1,19,8,0,13,184,1,6,180,2,28,
+80,0,0,0,63,225,50,63,18,57,57,93,93,93,93,93,93,93,93,93,93,93,1,47,93,225,
+51,16,222,93,50,225,43,51,47,51,93,49,48,0,93,93,19,33,21,0,0,17,20,22,23,
+22,22,21,20,7,35,54,53,52,38,39,38,38,53,16,0,37,6,35,33,223,3,70,254,116,
+254,197,166,229,171,151,121,170,121,103,194,229,209,1,66,1,120,215,137,254,
+227,6,20,141,254,224,254,118,255,0,153,129,39,30,101,111,149,166,162,98,57,
+65,29,35,223,201,1,1,1,186,247,12,0,0,1,0,160,254,20,4,45,4,94,0,16,0,49,
+64,29,0,71,144,16,160,16,2,16,18,11,6,71,0,7,176,7,2,7,11,3,80,13,16,8,15,
+7,21,0,27,0,63,63,63,63,225,50,1,47,93,225,50,16,222,93,225,49,48,1,17,16,
+35,32,17,17,35,17,51,23,51,54,51,32,17,17,3,119,238,254,205,182,147,27,10,
+102,234,1,133,254,20,4,175,1,4,254,114,253,199,4,74,148,168,254,111,251,71,
+0,0,3,0,147,255,236,4,57,5,195,0,10,0,17,0,24,0,79,64,50,12,59,18,1,6,40,
+18,1,18,72,9,26,11,39,19,55,19,2,19,71,0,3,1,3,19,79,202,11,234,11,2,152,
+11,1,47,11,255,11,2,11,11,22,15,80,6,4,22,80,0,22,0,63,225,63,225,18,57,47,
+93,93,93,225,1,47,93,225,93,50,16,222,225,93,95,93,50,49,48,5,34,2,17,16,
+18,51,50,18,17,16,1,33,2,2,35,34,6,1,33,18,18,51,50,18,2,100,229,236,228,
+237,231,238,253,19,2,51,7,133,143,139,133,2,43,253,205,6,132,142,142,135,
+20,1,127,1,110,1,124,1,110,254,131,254,147,253,19,3,59,1,4,1,0,250,254,109,
+254,234,254,251,1,0,0,1,1,172,255,236,3,248,4,74,0,11,0,38,64,20,1,71,0,10,
+1,10,10,12,111,5,1,5,13,5,3,80,8,22,0,15,0,63,63,225,51,1,16,206,93,18,57,
+47,93,225,49,48,1,17,20,51,50,55,21,6,35,32,17,17,2,98,193,112,101,93,132,
+254,149,4,74,252,250,195,21,138,32,1,88,3,6,0,255,255,0,215,0,0,4,139,4,74,
+2,6,0,250,0,0,0,1,0,61,255,236,4,160,6,33,0,31,0,85,64,51,13,1,27,24,14,27,
+14,0,18,20,18,36,18,2,6,18,1,18,33,31,7,0,32,13,16,72,47,0,63,0,2,0,31,21,
+72,27,1,27,1,13,3,10,16,80,18,21,22,5,80,10,1,0,63,225,63,51,225,17,23,57,
+93,63,1,47,93,43,51,51,17,51,93,93,17,18,57,57,17,51,17,51,51,49,48,51,1,
+39,38,38,35,34,7,53,54,51,50,22,23,1,22,51,50,55,21,6,35,34,38,39,3,38,39,
+35,6,7,1,61,1,248,53,34,86,73,56,48,65,62,142,142,70,1,70,37,65,29,31,50,
+65,82,87,28,135,69,25,6,36,83,254,244,4,59,160,104,72,12,145,17,135,211,252,
+41,111,10,133,26,80,87,1,162,214,122,138,183,253,188,0,1,0,160,254,20,4,45,
+4,74,0,21,0,58,64,35,10,5,71,144,8,160,8,2,8,23,0,18,71,0,19,176,19,2,19,
+18,27,0,5,10,15,4,2,80,13,22,9,21,20,6,15,0,63,51,63,63,225,23,50,63,1,47,
+93,225,50,16,222,93,225,50,49,48,1,16,51,50,54,53,17,51,17,35,39,35,6,35,
+34,39,22,21,17,35,17,51,1,86,238,160,147,182,147,27,10,97,204,173,75,6,182,
+182,1,135,254,252,186,211,2,58,251,182,147,167,88,153,87,254,192,6,54,0,0,
+1,0,61,0,0,4,74,4,74,0,13,0,116,64,70,13,16,10,16,72,8,13,1,53,12,69,12,85,
+12,3,36,12,1,21,12,1,25,6,41,6,57,6,3,13,149,12,165,12,2,134,12,1,99,12,115,
+12,2,5,12,1,12,20,4,68,4,116,4,3,4,4,0,8,71,9,15,7,1,1,1,0,64,10,16,72,0,
+184,255,240,182,0,4,13,21,8,0,15,0,63,50,63,51,1,47,56,43,50,93,16,222,225,
+18,57,61,47,93,51,93,93,93,93,51,49,48,93,93,93,93,93,43,19,51,19,18,23,51,
+54,18,17,51,16,2,7,35,61,189,223,110,11,6,157,158,183,201,225,187,4,74,253,
+182,254,223,69,164,1,154,1,114,254,147,254,22,243,0,0,1,0,172,254,111,4,43,
+6,20,0,44,0,151,64,95,41,70,34,26,31,0,159,36,1,95,28,1,159,0,1,28,0,36,36,
+0,28,3,22,17,70,144,12,1,12,46,5,72,0,22,1,22,123,20,1,109,20,1,73,20,1,59,
+20,1,45,20,1,8,20,24,20,2,20,8,21,24,72,121,9,1,107,9,1,73,9,1,59,9,1,45,
+9,1,20,9,14,35,26,2,79,47,44,1,44,44,14,37,34,80,35,0,14,184,1,6,0,63,63,
+225,50,18,57,47,93,225,57,17,18,57,57,93,93,93,93,93,43,93,93,93,93,93,93,
+1,47,93,225,16,222,93,225,18,23,57,47,47,47,93,93,93,18,57,57,51,225,49,48,
+1,21,35,34,6,21,20,22,22,23,22,22,21,20,7,35,54,53,52,38,39,36,17,52,54,55,
+53,38,53,52,54,55,6,35,35,53,33,21,35,34,4,21,20,22,51,3,217,201,207,217,
+76,139,179,162,151,121,170,121,99,188,254,74,151,132,215,150,185,176,104,
+62,2,252,69,217,254,217,183,196,3,119,137,163,149,91,105,56,32,29,100,111,
+149,166,162,100,53,65,29,68,1,90,134,211,42,12,59,220,114,150,51,12,153,153,
+160,139,113,104,0,255,255,0,115,255,236,4,88,4,94,2,6,0,82,0,0,0,1,0,14,255,
+236,4,190,4,74,0,20,0,121,64,53,75,11,91,11,107,11,3,58,11,1,40,11,1,11,11,
+1,11,8,71,9,84,15,1,69,15,1,54,15,1,39,15,1,4,15,20,15,2,15,0,0,5,71,17,0,
+9,64,9,80,9,96,9,4,17,184,255,192,64,23,18,22,72,9,17,9,17,21,22,12,16,7,
+10,80,13,15,9,21,19,80,0,3,22,0,63,51,225,63,63,225,50,50,57,17,18,1,57,57,
+47,47,43,93,16,225,51,17,51,93,93,93,93,93,16,225,51,93,93,93,93,49,48,37,
+21,6,35,34,17,17,33,17,35,17,35,53,55,33,21,35,17,20,51,50,4,160,52,85,226,
+254,109,182,222,138,4,38,210,90,46,150,144,26,1,6,2,190,252,80,3,176,74,80,
+154,253,78,125,0,2,0,158,254,20,4,59,4,94,0,16,0,27,0,53,64,31,22,72,12,64,
+21,24,72,12,29,17,1,4,71,0,5,176,5,2,5,17,0,19,80,15,22,25,80,9,16,4,27,0,
+63,63,225,63,225,50,50,1,47,93,225,50,50,16,222,43,225,49,48,37,35,22,21,
+17,35,17,16,18,51,50,18,17,16,2,35,34,39,22,51,50,54,53,52,38,35,32,17,1,
+84,6,6,182,253,218,206,248,247,215,168,113,112,171,144,128,130,144,254,231,
+70,174,97,254,221,4,19,1,7,1,48,254,205,254,252,254,242,254,211,251,100,211,
+209,209,207,254,116,0,0,1,0,172,254,111,4,41,4,94,0,23,0,103,64,66,12,3,70,
+1,144,22,1,22,25,17,72,0,8,1,8,153,6,1,123,6,139,6,2,109,6,1,73,6,1,59,6,
+1,44,6,1,8,6,24,6,2,121,20,137,20,2,107,20,1,73,20,1,59,20,1,44,20,1,6,20,
+0,15,81,13,10,16,0,184,1,6,0,63,63,51,225,18,57,57,93,93,93,93,93,93,93,93,
+93,93,93,93,1,47,93,225,16,222,93,50,225,51,49,48,1,35,54,53,52,38,39,36,
+17,16,33,50,23,7,38,35,32,17,20,22,23,4,21,20,3,172,166,121,132,163,254,84,
+2,55,164,158,62,158,114,254,145,155,192,1,102,254,111,163,99,60,59,28,71,
+1,181,2,90,59,158,57,254,72,187,134,35,66,186,141,0,0,2,0,129,255,236,4,150,
+4,74,0,12,0,24,0,50,64,30,2,23,72,1,223,4,239,4,255,4,3,4,26,17,72,0,10,240,
+10,2,10,2,14,80,12,15,20,80,7,22,0,63,225,63,225,50,1,47,93,225,16,222,93,
+50,225,57,49,48,1,21,33,22,21,20,0,35,34,2,17,16,33,23,35,34,6,21,20,22,51,
+50,54,53,16,4,150,254,245,178,254,255,224,221,254,2,43,59,59,199,168,153,
+142,139,146,4,74,154,195,245,235,254,223,1,31,1,1,2,62,154,195,225,185,208,
+191,174,1,13,0,1,0,106,255,229,4,57,4,74,0,16,0,83,64,29,10,14,26,14,2,14,
+3,71,253,12,1,12,64,20,23,72,61,12,1,47,12,1,0,12,1,12,12,17,1,184,255,232,
+64,20,9,18,72,1,95,7,1,7,18,15,2,13,80,16,15,7,5,80,10,22,0,63,225,51,63,
+225,50,57,1,16,206,93,50,43,18,57,47,93,93,93,43,93,225,51,93,49,48,1,21,
+33,17,20,51,50,55,21,6,35,32,17,17,33,53,55,4,57,254,37,209,107,84,84,136,
+254,150,254,194,134,4,74,154,253,162,215,20,135,35,1,88,2,115,74,80,0,0,1,
+0,160,255,236,4,59,4,74,0,17,0,51,179,10,70,9,9,184,255,208,64,23,16,24,72,
+9,7,71,12,19,2,71,0,17,176,17,2,17,4,80,15,22,9,0,15,0,63,50,63,225,1,47,
+93,225,16,222,225,51,43,16,229,49,48,19,51,17,16,33,50,54,53,52,39,51,22,
+21,16,2,35,32,17,160,182,1,18,150,135,63,182,63,230,243,254,62,4,74,253,178,
+254,133,232,247,237,253,245,253,254,194,254,210,2,6,0,2,0,74,254,20,4,131,
+4,94,0,21,0,28,0,92,64,58,22,86,21,102,21,2,71,21,1,21,73,11,6,0,0,3,24,70,
+15,17,1,17,30,9,73,80,3,144,3,160,3,192,3,208,3,5,47,3,63,3,2,3,6,26,80,14,
+5,5,14,16,22,11,80,20,1,22,0,27,0,63,63,51,225,50,63,51,47,16,225,57,1,47,
+93,93,225,16,222,93,225,17,57,47,51,51,225,93,93,50,49,48,1,17,36,17,16,55,
+23,6,6,21,16,5,17,16,33,50,18,21,16,2,7,17,17,36,17,16,35,34,21,2,12,254,
+62,207,120,97,68,1,32,1,25,164,186,250,223,1,49,176,129,254,20,1,218,25,2,
+28,1,58,245,90,129,206,134,254,129,33,2,94,1,125,254,217,252,254,248,254,
+201,14,254,38,2,111,29,1,153,1,142,228,0,1,0,43,254,20,4,141,4,78,0,30,0,
+230,64,92,3,30,4,16,20,15,17,2,17,0,30,4,19,20,15,18,1,18,16,19,20,15,20,
+3,0,30,4,30,6,30,22,30,38,30,3,73,20,89,20,201,20,3,21,17,1,6,17,38,17,198,
+17,3,9,15,25,15,41,15,3,70,4,86,4,198,4,3,26,1,1,9,1,41,1,201,1,3,20,30,4,
+15,30,15,25,9,19,16,0,3,4,18,1,2,184,255,192,181,13,16,72,2,2,9,184,255,192,
+64,43,9,12,72,9,9,32,17,18,18,0,25,1,25,25,31,20,15,12,22,80,30,4,9,24,27,
+15,0,19,3,16,4,1,17,18,27,9,7,80,12,27,2,1,15,0,63,51,63,225,51,63,51,18,
+23,57,63,51,18,57,57,225,17,57,57,17,1,51,47,93,51,47,51,17,51,47,43,51,47,
+43,51,18,23,57,17,18,57,57,17,51,17,51,93,93,93,93,93,93,93,93,16,125,135,
+196,196,16,135,196,196,16,135,8,196,8,196,16,135,8,196,8,196,49,48,1,1,51,
+1,19,22,22,51,50,55,21,6,35,34,38,39,3,1,35,1,3,38,35,34,7,53,54,51,50,22,
+23,2,125,1,55,178,254,95,186,46,80,64,44,36,66,52,102,135,71,147,254,158,
+195,1,219,180,68,84,29,34,53,76,81,110,55,1,250,2,80,252,248,254,51,114,89,
+8,139,19,90,177,1,121,253,124,3,62,1,190,168,10,143,17,109,139,0,1,0,80,254,
+20,4,131,6,18,0,22,0,105,64,22,1,86,11,102,11,2,71,11,1,11,73,21,12,12,16,
+3,70,8,6,70,5,5,184,255,208,64,43,16,24,72,5,15,8,1,8,24,19,70,64,16,80,16,
+144,16,160,16,192,16,208,16,6,47,16,63,16,2,16,6,17,15,1,21,80,10,13,22,11,
+27,0,0,0,63,63,63,51,225,50,63,51,1,47,93,93,225,16,206,93,50,43,16,229,16,
+225,17,57,47,51,225,93,93,50,49,48,1,17,36,17,52,3,51,18,21,16,5,17,35,17,
+38,2,17,17,51,17,16,5,17,2,170,1,45,63,172,63,254,39,158,233,211,172,1,16,
+6,18,250,115,28,1,152,250,1,23,254,236,247,253,201,26,254,38,1,218,8,1,14,
+1,39,2,31,253,239,254,90,16,5,143,0,0,1,0,90,255,236,4,117,4,74,0,31,0,170,
+64,16,86,19,230,19,246,19,3,71,19,1,54,19,1,19,18,18,184,255,240,64,99,15,
+18,72,87,18,1,54,18,70,18,2,18,21,25,86,11,102,11,2,71,11,1,11,73,8,8,30,
+16,73,15,21,63,21,2,21,33,89,0,233,0,249,0,3,72,0,1,57,0,1,0,1,1,16,15,18,
+72,88,1,1,57,1,73,1,2,1,3,73,48,30,64,30,80,30,144,30,160,30,192,30,208,30,
+7,47,30,1,30,9,9,0,25,14,5,80,23,28,22,18,0,15,0,63,50,63,51,225,50,50,17,
+57,47,1,47,93,93,225,51,93,93,43,17,51,93,93,93,16,222,93,225,17,57,47,225,
+93,93,57,17,51,93,93,43,17,51,93,93,93,49,48,19,51,2,17,16,51,50,54,53,17,
+51,17,20,22,51,50,17,16,3,51,18,17,16,33,34,39,35,6,35,32,17,16,195,165,104,
+139,67,75,157,79,63,139,105,166,105,254,223,181,50,11,50,181,254,223,4,74,
+254,250,254,208,254,111,142,126,1,50,254,206,130,138,1,145,1,50,1,4,254,254,
+254,204,253,216,178,178,2,40,1,46,255,255,1,3,255,236,3,248,5,217,2,38,1,
+134,0,0,1,6,0,106,185,0,0,23,64,13,2,1,16,17,38,2,1,23,18,22,11,0,37,1,43,
+53,53,0,43,53,53,0,255,255,0,160,255,236,4,59,5,217,2,38,1,146,0,0,1,6,0,
+106,0,0,0,25,182,2,1,22,17,38,2,1,184,255,248,180,24,28,0,12,37,1,43,53,53,
+0,43,53,53,0,255,255,0,115,255,236,4,88,6,33,2,38,0,82,0,0,1,6,1,84,72,0,
+0,19,64,11,2,28,17,38,2,72,20,24,3,9,37,1,43,53,0,43,53,0,255,255,0,160,255,
+236,4,59,6,33,2,38,1,146,0,0,1,6,1,84,39,0,0,19,64,11,1,26,17,38,1,31,18,
+22,0,12,37,1,43,53,0,43,53,0,255,255,0,90,255,236,4,117,6,33,2,38,1,150,0,
+0,1,6,1,84,51,0,0,19,64,11,1,40,17,38,1,49,32,36,30,21,37,1,43,53,0,43,53,
+0,255,255,0,217,0,0,4,35,7,43,2,38,0,40,0,0,1,7,0,106,0,25,1,82,0,23,64,13,
+2,1,16,5,38,2,1,0,18,22,1,0,37,1,43,53,53,0,43,53,53,0,0,1,0,23,255,236,4,
+141,5,182,0,27,0,125,182,18,16,16,128,16,2,16,184,255,192,64,73,21,24,72,
+16,16,10,90,11,255,13,1,13,13,224,11,240,11,2,70,11,86,11,2,55,11,1,47,0,
+63,0,2,11,0,1,11,0,11,0,28,5,90,23,29,9,95,64,18,160,18,176,18,208,18,224,
+18,240,18,6,18,18,14,3,95,1,26,19,17,12,95,14,3,11,18,0,63,63,225,50,63,51,
+225,17,57,47,93,225,1,16,222,225,18,57,57,47,47,93,93,93,93,93,51,47,93,16,
+225,50,47,43,93,50,49,48,37,53,22,51,50,53,53,52,35,35,17,35,17,33,53,33,
+21,33,17,33,50,22,21,21,20,6,35,34,2,152,68,67,180,227,244,186,254,213,3,
+73,254,156,1,8,187,206,189,171,88,4,160,21,226,133,231,253,35,5,18,164,164,
+254,111,193,178,137,196,213,0,255,255,0,246,0,0,4,47,7,115,2,38,1,97,0,0,
+1,7,0,118,0,109,1,82,0,19,64,11,1,12,5,38,1,58,6,9,4,0,37,1,43,53,0,43,53,
+0,0,1,0,129,255,236,4,156,5,203,0,23,0,68,64,39,7,64,20,24,72,7,1,7,1,13,
+18,25,0,3,91,0,13,240,13,2,13,3,95,104,0,1,0,0,5,21,95,19,16,4,5,95,7,10,
+19,0,63,51,225,63,51,225,18,57,47,93,225,1,47,93,225,50,16,206,17,57,57,47,
+47,43,49,48,1,33,21,33,18,33,50,55,21,6,35,32,0,17,16,0,33,50,23,7,38,35,
+34,6,1,76,2,117,253,133,23,1,192,130,197,146,212,254,203,254,184,1,102,1,
+54,220,163,78,154,151,188,250,3,78,162,253,227,58,162,59,1,136,1,105,1,90,
+1,148,86,156,78,249,255,255,0,141,255,236,4,63,5,203,2,6,0,54,0,0,255,255,
+0,225,0,0,3,233,5,182,2,6,0,44,0,0,255,255,0,225,0,0,3,233,7,43,2,38,0,44,
+0,0,1,7,0,106,0,2,1,82,0,23,64,13,2,1,16,5,38,2,1,2,18,22,1,0,37,1,43,53,
+53,0,43,53,53,0,255,255,0,137,255,236,3,211,5,182,2,6,0,45,0,0,0,2,0,0,255,
+236,4,184,5,182,0,24,0,32,0,132,64,88,1,8,9,14,72,1,120,0,1,87,0,103,0,2,
+0,250,14,12,8,20,24,72,153,12,169,12,2,120,12,136,12,2,12,16,9,15,72,12,14,
+16,25,90,23,96,14,144,14,160,14,224,14,240,14,5,71,23,1,14,23,14,23,6,28,
+251,19,34,0,6,1,6,32,95,16,16,14,25,96,23,18,0,95,14,3,9,97,7,4,19,0,63,51,
+225,63,225,63,225,17,57,47,225,1,47,93,16,214,225,17,57,57,47,47,93,93,16,
+225,50,17,51,43,93,93,43,16,225,93,93,50,43,49,48,1,3,2,6,35,34,39,53,22,
+51,50,54,54,18,55,33,17,51,32,17,20,6,35,35,17,19,51,32,17,52,38,35,35,1,
+119,20,20,127,112,56,40,32,36,35,53,25,41,3,1,242,39,1,190,228,216,207,166,
+45,1,12,138,155,20,5,18,253,220,253,195,197,18,145,14,70,184,3,97,214,253,
+152,254,94,208,220,5,18,251,142,1,12,134,120,0,2,0,66,0,0,4,176,5,182,0,18,
+0,26,0,67,64,37,11,19,90,8,0,0,4,22,251,15,28,7,3,90,4,64,10,15,72,4,26,2,
+95,11,104,7,1,7,7,9,5,3,19,96,3,0,18,0,63,50,225,63,51,57,47,93,51,225,50,
+1,47,43,225,50,16,214,225,17,57,47,51,225,50,49,48,33,17,33,17,35,17,51,17,
+33,17,51,17,51,50,22,21,20,6,35,39,51,32,17,52,38,35,35,2,37,254,194,165,
+165,1,62,166,39,219,227,228,216,41,45,1,12,138,155,20,2,170,253,86,5,182,
+253,152,2,104,253,152,215,203,208,220,160,1,12,134,120,0,1,0,23,0,0,4,141,
+5,182,0,18,0,105,181,16,17,128,17,2,17,184,255,192,64,59,21,24,72,17,17,0,
+11,90,12,255,14,1,14,14,224,12,240,12,2,70,12,86,12,2,55,12,1,12,12,19,6,
+90,5,20,18,13,95,15,10,95,48,0,64,0,160,0,176,0,208,0,5,0,0,12,15,3,6,12,
+18,0,63,51,63,18,57,47,93,225,16,225,50,1,16,222,225,18,57,47,93,93,93,51,
+47,93,16,225,50,50,47,43,93,49,48,1,33,50,22,21,17,35,17,52,35,35,17,35,17,
+33,53,33,21,33,1,252,1,8,187,206,186,227,244,186,254,213,3,73,254,156,3,129,
+193,178,253,242,1,246,231,253,35,5,18,164,164,0,255,255,0,211,0,0,4,174,7,
+115,2,38,1,180,0,0,1,7,0,118,0,156,1,82,0,19,64,11,1,17,5,38,1,66,11,14,4,
+0,37,1,43,53,0,43,53,0,255,255,0,27,255,236,4,176,7,105,2,38,1,189,0,0,1,
+7,2,54,0,6,1,82,0,19,64,11,1,26,5,38,1,6,29,24,14,0,37,1,43,53,0,43,53,0,
+0,1,0,135,254,127,4,70,5,182,0,11,0,67,64,42,2,90,0,3,16,3,144,3,160,3,192,
+3,208,3,6,3,3,5,9,90,0,13,8,90,0,5,224,5,240,5,3,5,10,6,3,8,95,5,3,3,1,5,
+0,47,51,51,47,16,225,63,51,1,47,93,225,16,222,225,17,57,47,93,225,49,48,33,
+33,17,35,17,33,17,51,17,33,17,51,4,70,254,118,176,254,123,187,2,73,187,254,
+127,1,129,5,182,250,240,5,16,255,255,0,33,0,0,4,172,5,188,2,6,0,36,0,0,0,
+2,0,135,0,0,4,111,5,182,0,11,0,19,0,51,64,29,15,91,3,8,21,5,12,90,0,0,224,
+0,240,0,3,0,19,95,5,5,12,4,95,1,3,12,96,0,18,0,63,225,63,225,18,57,47,225,
+1,47,93,225,50,16,222,50,225,49,48,51,17,33,21,33,17,33,32,17,20,4,35,37,
+33,32,17,52,38,35,35,135,3,144,253,43,1,16,2,29,254,249,251,254,213,1,26,
+1,82,171,198,251,5,182,164,254,60,254,94,208,220,160,1,12,133,121,255,255,
+0,135,0,0,4,113,5,182,2,6,0,37,0,0,255,255,0,246,0,0,4,47,5,182,2,6,1,97,
+0,0,0,2,0,6,254,127,4,197,5,182,0,13,0,19,0,129,64,25,9,16,18,24,72,11,18,
+1,18,32,11,24,72,11,8,1,8,32,11,24,72,25,10,1,19,184,255,240,64,13,9,24,72,
+19,91,7,16,90,10,20,7,1,10,184,255,192,64,37,10,24,72,2,10,1,7,10,7,10,5,
+12,1,251,0,0,14,90,12,21,4,251,5,16,95,10,3,19,12,6,95,3,0,5,5,3,18,0,63,
+51,47,51,16,225,50,50,63,225,1,47,225,16,220,225,51,47,225,17,18,57,57,47,
+47,93,43,93,16,225,16,225,43,93,49,48,43,93,43,93,43,1,35,17,33,17,35,17,
+51,54,18,19,33,17,51,33,17,35,2,2,7,4,197,177,252,162,176,113,129,174,12,
+2,80,195,254,131,242,17,163,107,254,127,1,129,254,127,2,39,236,2,204,1,88,
+250,240,4,106,254,246,253,107,203,255,255,0,217,0,0,4,35,5,182,2,6,0,40,0,
+0,0,1,0,0,0,0,4,205,5,182,0,17,0,203,64,76,103,9,119,9,135,9,3,6,9,22,9,54,
+9,70,9,86,9,5,9,5,5,70,13,86,13,246,13,3,55,13,1,5,13,21,13,2,13,90,104,0,
+120,0,136,0,3,9,0,25,0,57,0,73,0,89,0,5,0,4,4,103,14,1,9,14,25,14,2,14,14,
+17,10,103,2,1,2,1,184,255,240,64,9,1,1,103,16,135,16,2,16,17,184,255,240,
+64,50,17,104,7,136,7,2,7,8,16,8,8,104,11,136,11,2,11,16,10,64,10,80,10,144,
+10,160,10,192,10,208,10,7,10,16,10,12,15,6,3,15,3,1,17,14,10,18,7,4,1,3,0,
+63,51,51,63,51,51,18,57,57,17,51,17,51,1,47,56,93,51,93,51,47,56,51,93,47,
+56,51,93,51,47,56,50,93,17,18,57,47,93,93,51,17,51,93,93,225,93,93,93,50,
+17,51,93,93,49,48,1,1,51,1,17,51,17,1,51,1,1,35,1,17,35,17,1,35,1,117,254,
+151,178,1,93,155,1,86,178,254,156,1,115,185,254,162,155,254,155,182,2,242,
+2,196,253,60,2,196,253,60,2,196,253,60,253,14,2,229,253,27,2,229,253,27,0,
+0,1,0,139,255,236,4,47,5,203,0,35,0,81,64,46,6,0,22,0,2,0,17,22,91,33,33,
+4,17,17,9,14,91,4,37,28,0,9,1,9,0,17,96,104,18,1,159,18,1,18,18,12,27,25,
+96,30,4,12,96,10,7,19,0,63,51,225,63,225,51,18,57,47,93,93,225,57,1,47,93,
+51,16,222,225,17,57,47,17,51,47,225,18,57,93,49,48,1,21,22,22,21,20,4,33,
+34,39,53,22,51,32,17,16,33,35,53,51,50,54,53,52,38,35,34,7,39,54,33,50,22,
+21,20,6,2,190,178,191,254,228,254,251,242,145,184,199,1,99,254,118,190,176,
+180,201,140,118,186,168,93,194,1,5,209,235,179,3,2,6,23,182,143,203,233,79,
+170,96,1,27,1,8,151,148,125,103,122,121,125,150,198,165,137,186,0,0,1,0,137,
+0,0,4,70,5,182,0,16,0,98,185,0,15,255,240,64,64,14,24,72,53,15,69,15,2,7,
+16,14,24,72,58,7,74,7,2,13,9,7,25,7,41,7,3,7,10,251,224,9,240,9,2,9,105,18,
+6,15,22,15,38,15,3,15,5,1,251,0,0,224,0,240,0,3,0,16,5,9,18,13,7,0,3,0,63,
+50,50,63,51,51,1,47,93,225,50,50,93,16,254,93,225,50,93,50,49,48,93,43,93,
+43,19,51,17,20,7,7,51,1,51,17,35,17,52,19,35,1,35,137,174,7,7,6,2,66,213,
+172,18,8,253,188,215,5,182,252,224,142,112,150,4,180,250,74,3,25,140,1,21,
+251,70,0,255,255,0,137,0,0,4,70,7,105,2,38,1,178,0,0,1,7,2,54,0,0,1,82,0,
+21,180,1,19,5,38,1,184,255,255,180,22,17,0,8,37,1,43,53,0,43,53,0,0,1,0,211,
+0,0,4,174,5,182,0,10,0,130,64,96,5,7,21,7,37,7,213,7,229,7,245,7,6,10,2,26,
+2,42,2,218,2,234,2,250,2,6,39,10,1,10,7,7,3,90,0,4,96,4,112,4,128,4,4,4,41,
+8,217,8,233,8,249,8,4,8,9,16,9,9,41,1,217,1,233,1,249,1,4,1,208,0,240,0,2,
+127,0,1,0,0,16,0,64,0,96,0,4,0,16,0,7,2,8,5,3,4,0,18,0,63,50,63,51,57,57,
+1,47,56,93,93,93,50,93,50,47,56,51,93,47,93,225,50,17,51,93,49,48,0,93,93,
+33,35,1,17,35,17,51,17,1,51,1,4,174,219,253,186,186,186,2,54,206,253,203,
+2,229,253,27,5,182,253,60,2,196,253,66,0,0,1,0,4,255,233,4,70,5,182,0,15,
+0,111,64,33,13,64,20,24,72,173,13,1,124,13,140,13,156,13,3,90,13,106,13,2,
+45,13,61,13,77,13,3,11,13,27,13,2,5,184,255,240,64,16,9,24,72,4,24,9,24,72,
+3,90,0,14,16,14,2,14,184,255,192,64,22,13,24,72,14,14,8,1,90,0,17,8,3,95,
+14,3,11,96,9,6,19,0,18,0,63,63,51,225,63,225,1,47,16,222,225,18,57,47,43,
+93,225,49,48,43,43,93,93,93,93,93,43,33,35,17,33,2,2,35,34,39,53,22,51,50,
+18,19,33,4,70,187,254,215,117,177,175,71,66,57,56,102,110,126,2,127,5,18,
+252,47,254,168,25,150,25,1,105,3,206,0,255,255,0,113,0,0,4,92,5,182,2,6,0,
+48,0,0,255,255,0,135,0,0,4,70,5,182,2,6,0,43,0,0,255,255,0,84,255,236,4,123,
+5,205,2,6,0,50,0,0,255,255,0,135,0,0,4,70,5,182,2,6,1,110,0,0,255,255,0,176,
+0,0,4,70,5,182,2,6,0,51,0,0,255,255,0,129,255,236,4,156,5,203,2,6,0,38,0,
+0,255,255,0,102,0,0,4,100,5,182,2,6,0,55,0,0,0,1,0,27,255,236,4,176,5,182,
+0,23,0,162,64,9,8,13,24,13,2,13,1,20,20,184,255,224,179,20,24,72,20,184,255,
+224,64,89,15,18,72,7,20,7,20,14,232,23,1,73,23,89,23,2,56,23,1,41,23,1,26,
+23,1,9,23,1,23,0,0,25,231,15,1,70,15,86,15,2,55,15,1,38,15,1,21,15,1,6,15,
+1,15,31,14,79,14,95,14,111,14,4,14,14,24,101,20,1,54,20,230,20,2,37,20,1,
+13,1,20,3,0,10,95,8,5,19,14,0,3,0,63,50,63,51,225,17,23,57,93,93,93,17,1,
+51,47,93,51,93,93,93,93,93,93,17,51,47,51,93,93,93,93,93,93,18,57,57,61,47,
+24,47,43,43,17,51,51,93,49,48,1,1,14,2,35,34,39,53,22,51,50,54,55,1,51,1,
+22,23,22,23,51,55,1,4,176,254,84,76,120,178,126,104,74,85,93,110,121,54,253,
+238,204,1,127,12,8,8,9,2,39,1,56,5,182,251,250,183,171,98,30,185,45,103,122,
+4,63,252,215,25,22,25,20,109,3,24,255,255,0,27,255,236,4,180,5,203,2,6,1,
+115,0,0,255,255,0,53,0,0,4,150,5,182,2,6,0,59,0,0,0,1,0,135,254,127,4,186,
+5,182,0,11,0,58,64,34,3,251,2,2,9,90,127,0,143,0,2,0,13,8,90,0,5,224,5,240,
+5,3,5,10,6,3,0,8,95,5,3,3,5,18,0,63,51,47,16,225,50,63,51,1,47,93,225,16,
+220,93,225,51,47,225,49,48,37,51,17,35,17,33,17,51,17,33,17,51,4,10,176,176,
+252,125,187,2,14,186,166,253,217,1,129,5,182,250,240,5,16,0,0,1,0,135,0,0,
+4,70,5,182,0,16,0,47,64,26,14,1,90,0,18,9,90,0,6,224,6,240,6,3,6,14,12,95,
+4,4,1,15,7,3,1,18,0,63,63,51,18,57,47,225,51,1,47,93,225,16,222,225,50,49,
+48,33,35,17,6,35,32,17,17,51,17,20,22,51,50,55,17,51,4,70,187,227,166,254,
+133,187,103,110,153,219,187,2,86,90,1,115,2,71,253,209,130,101,80,2,198,0,
+0,1,0,121,0,0,4,86,5,182,0,11,0,92,64,64,101,8,1,86,8,1,55,8,71,8,247,8,3,
+123,5,139,5,2,8,90,5,5,1,9,90,192,0,208,0,2,15,0,63,0,2,0,13,4,90,0,1,16,
+1,48,1,64,1,80,1,144,1,160,1,7,1,10,6,2,3,8,4,95,1,18,0,63,225,50,63,51,51,
+1,47,93,225,16,222,93,93,225,17,57,47,225,93,93,93,93,49,48,33,33,17,51,17,
+51,17,51,17,51,17,51,4,86,252,35,166,245,166,246,166,5,182,250,240,5,16,250,
+240,5,16,0,0,1,0,61,254,127,4,205,5,182,0,15,0,127,64,89,101,12,1,86,12,1,
+55,12,71,12,247,12,3,123,9,139,9,2,12,90,9,9,5,0,3,251,0,2,144,2,160,2,176,
+2,224,2,240,2,6,2,2,13,90,191,0,239,0,255,0,3,15,0,63,0,159,0,175,0,4,0,17,
+8,90,144,5,160,5,2,47,5,111,5,127,5,3,5,14,10,6,3,12,0,8,95,5,3,3,5,18,0,
+63,51,47,16,225,50,50,63,51,51,1,47,93,93,225,16,221,93,93,225,51,47,93,225,
+17,18,57,47,225,93,93,93,93,49,48,37,51,17,35,17,33,17,51,17,51,17,51,17,
+51,17,51,4,27,178,176,252,32,166,246,166,246,166,166,253,217,1,129,5,182,
+250,240,5,16,250,240,5,16,0,0,2,0,27,0,0,4,117,5,182,0,12,0,20,0,59,64,33,
+5,13,90,31,0,143,0,255,0,3,0,0,2,16,91,9,22,2,2,21,20,95,5,5,13,2,95,3,3,
+13,96,0,18,0,63,225,63,225,18,57,47,225,17,1,51,47,16,222,225,17,57,47,93,
+225,50,49,48,33,17,33,53,33,17,51,32,4,21,20,4,33,39,51,32,17,52,38,35,35,
+1,70,254,213,1,229,68,1,14,1,35,254,235,254,254,94,98,1,82,171,197,68,5,18,
+164,253,152,218,200,202,226,160,1,12,132,122,0,3,0,96,0,0,4,109,5,182,0,9,
+0,17,0,21,0,83,64,53,73,13,1,13,251,0,6,16,6,48,6,112,6,128,6,240,6,6,6,6,
+0,18,251,15,21,63,21,2,21,23,3,10,90,32,0,48,0,2,0,0,22,17,95,3,3,19,1,3,
+10,96,18,0,18,0,63,50,225,63,51,57,47,225,17,1,51,47,93,225,50,16,222,93,
+225,17,57,47,93,225,93,49,48,51,17,51,17,51,32,17,20,4,35,39,51,32,17,52,
+38,35,35,1,17,51,17,96,166,47,2,29,254,249,251,74,78,1,82,171,198,47,2,193,
+166,5,182,253,152,254,94,208,220,160,1,12,133,121,253,86,5,182,250,74,0,2,
+0,176,0,0,4,70,5,182,0,9,0,17,0,60,64,16,13,91,239,6,255,6,2,6,19,3,10,90,
+0,0,1,0,184,255,192,64,16,18,22,72,0,0,18,17,95,3,3,1,3,10,96,0,18,0,63,225,
+63,57,47,225,17,1,51,47,43,93,225,50,16,222,93,225,49,48,51,17,51,17,51,32,
+17,20,4,35,39,51,32,17,52,38,35,35,176,186,191,2,29,254,249,251,218,201,1,
+82,171,198,170,5,182,253,152,254,94,208,220,160,1,12,133,121,0,1,0,68,255,
+236,4,76,5,203,0,23,0,74,64,43,127,17,143,17,2,17,17,11,19,16,91,255,6,1,
+6,25,1,31,11,47,11,2,11,11,24,17,95,104,18,1,18,18,3,14,95,12,9,19,22,95,
+0,3,4,0,63,51,225,63,51,225,17,57,47,93,225,17,1,51,47,93,51,16,222,93,225,
+50,18,57,47,93,49,48,19,39,54,51,32,0,17,16,0,33,34,39,53,22,51,32,19,33,
+53,33,38,38,35,34,145,77,161,222,1,48,1,89,254,170,254,196,212,146,197,131,
+1,217,16,253,139,2,113,19,237,190,152,4,217,156,86,254,123,254,176,254,139,
+254,107,59,162,58,2,29,162,222,251,0,0,2,0,98,255,236,4,135,5,205,0,18,0,
+30,0,110,64,43,28,251,7,15,0,47,0,79,0,95,0,127,0,143,0,6,0,64,21,24,72,0,
+0,3,22,251,13,64,9,14,72,13,32,6,55,2,1,2,90,102,3,1,3,184,255,192,64,26,
+11,14,72,3,3,31,1,95,104,6,1,6,6,10,19,95,16,19,25,95,10,4,4,3,2,18,0,63,
+63,63,225,63,225,17,57,47,93,225,17,1,51,47,43,93,225,93,50,16,222,43,225,
+18,57,47,43,93,51,225,49,48,1,35,17,35,17,51,17,51,18,18,51,50,18,17,16,2,
+35,34,2,5,50,54,17,16,38,35,34,6,17,16,22,1,147,139,166,166,144,18,175,183,
+192,183,184,193,190,179,1,113,106,95,96,105,108,94,93,2,170,253,86,5,182,
+253,152,1,93,1,34,254,159,254,113,254,115,254,156,1,59,152,233,1,101,1,104,
+228,237,254,161,254,164,242,0,2,0,57,0,0,4,18,5,182,0,11,0,19,0,113,64,31,
+11,4,27,4,2,11,6,27,6,2,3,16,12,17,72,3,0,5,19,10,90,143,9,159,9,175,9,3,
+9,21,1,184,255,240,180,12,17,72,1,2,184,255,240,183,2,2,15,91,0,5,1,5,184,
+255,192,64,19,19,22,72,5,5,20,3,0,96,18,18,1,13,96,7,3,10,1,18,0,63,51,63,
+225,18,57,47,225,50,17,1,51,47,43,93,225,51,47,56,51,43,16,222,93,225,50,
+17,57,57,43,49,48,93,93,1,1,35,1,36,17,16,33,33,17,35,17,17,35,32,17,20,22,
+51,51,2,98,254,178,219,1,125,254,240,1,248,1,116,186,188,254,202,164,154,
+180,2,92,253,164,2,143,98,1,54,1,143,250,74,2,92,2,187,255,0,137,148,255,
+255,0,135,255,236,4,2,4,94,2,6,0,68,0,0,0,2,0,143,255,236,4,59,6,35,0,22,
+0,31,0,62,64,37,27,72,1,11,64,21,24,72,11,33,5,23,72,0,17,208,17,224,17,240,
+17,4,17,23,5,29,80,8,8,0,25,80,14,22,1,0,1,0,63,50,63,225,17,57,47,225,50,
+50,1,47,93,225,50,16,222,43,50,225,49,48,1,23,4,6,6,7,51,54,51,50,18,21,16,
+2,35,34,2,17,52,18,62,2,1,16,33,32,17,16,35,34,6,4,16,33,254,115,205,127,
+8,12,116,220,186,213,250,221,219,250,62,104,138,202,254,195,1,37,1,10,240,
+95,177,6,35,160,67,65,217,210,170,254,249,229,254,252,254,222,1,104,1,63,
+212,1,32,176,106,57,252,181,253,244,1,119,1,108,127,0,0,3,0,176,0,0,4,84,
+4,74,0,12,0,20,0,28,0,91,181,4,4,20,4,2,10,184,255,208,64,49,9,12,72,0,14,
+18,70,11,11,25,70,3,30,14,22,71,0,7,144,7,160,7,176,7,4,7,0,21,80,191,14,
+1,137,14,1,120,14,1,14,14,22,13,80,8,15,22,80,7,21,0,63,225,63,225,18,57,
+47,93,93,93,225,57,1,47,93,225,50,16,222,225,51,47,225,18,57,49,48,43,93,
+1,21,4,21,20,6,35,33,17,33,32,17,20,1,17,33,50,54,53,52,35,1,17,33,50,53,
+52,38,35,3,76,1,8,212,208,254,0,1,254,1,131,253,53,1,37,134,114,217,254,188,
+1,62,254,130,128,2,70,7,35,223,149,168,4,74,254,235,197,1,64,254,215,72,84,
+141,254,62,254,168,180,92,72,0,1,1,35,0,0,4,14,4,74,0,5,0,46,64,28,2,71,31,
+3,111,3,127,3,143,3,4,127,0,143,0,2,3,0,3,0,6,7,1,80,4,15,2,21,0,63,63,225,
+17,18,1,57,57,47,47,93,93,225,49,48,1,33,17,35,17,33,4,14,253,203,182,2,235,
+3,176,252,80,4,74,0,0,2,0,33,254,131,4,104,4,74,0,12,0,17,0,116,64,9,40,8,
+1,9,8,25,8,2,17,184,255,240,179,15,24,72,17,184,255,224,64,53,11,14,72,17,
+7,15,9,80,9,128,9,2,18,9,1,7,9,7,9,5,11,1,70,0,0,13,71,79,11,95,11,111,11,
+3,11,19,4,71,5,15,78,9,15,17,11,6,80,3,1,4,4,3,21,0,63,51,47,51,16,225,50,
+50,63,225,1,47,225,16,220,93,225,51,47,225,17,18,57,57,47,47,93,93,17,51,
+17,51,43,43,49,48,93,93,1,35,17,33,17,35,17,51,0,19,33,17,51,33,17,35,2,3,
+4,104,176,253,25,176,86,1,6,4,2,80,151,254,179,250,36,198,254,131,1,125,254,
+131,2,23,1,133,2,43,252,80,3,36,254,31,254,189,255,255,0,133,255,236,4,72,
+4,94,2,6,0,72,0,0,0,1,0,0,0,0,4,205,4,74,0,17,1,8,64,140,105,15,121,15,137,
+15,3,75,15,91,15,2,41,15,57,15,2,26,15,1,9,15,1,102,6,118,6,134,6,3,68,6,
+84,6,2,38,6,54,6,2,21,6,1,6,6,1,166,6,1,6,3,247,10,1,86,10,102,10,2,23,10,
+55,10,71,10,3,6,10,1,10,71,169,15,1,15,0,24,11,1,9,11,1,11,11,14,7,104,4,
+120,4,136,4,3,4,16,11,14,72,4,5,16,5,5,136,8,1,8,16,11,16,72,8,16,7,64,7,
+80,7,144,7,160,7,192,7,208,7,7,7,16,7,7,19,103,17,119,17,135,17,3,17,184,
+255,240,180,11,14,72,17,16,184,255,240,181,16,16,135,13,1,13,184,255,240,
+180,11,16,72,13,14,184,255,240,64,18,14,14,18,9,12,3,0,12,0,1,14,11,7,21,
+16,4,1,15,0,63,51,51,63,51,51,18,57,57,17,51,17,51,17,1,51,47,56,51,43,93,
+51,47,56,51,43,93,17,51,47,56,93,51,43,93,51,47,56,51,43,93,17,18,57,47,93,
+93,51,51,93,225,93,93,93,93,50,50,93,49,48,93,93,93,93,93,93,93,93,93,93,
+1,17,51,17,1,51,1,1,35,1,17,35,17,1,35,1,1,51,2,23,159,1,94,185,254,145,1,
+109,195,254,174,159,254,174,195,1,111,254,143,184,2,53,2,21,253,235,2,21,
+253,235,253,203,2,45,253,211,2,45,253,211,2,53,2,21,0,1,0,201,255,236,4,8,
+4,94,0,32,0,87,64,51,15,13,32,32,8,3,70,13,13,28,70,18,34,8,0,23,96,23,112,
+23,128,23,4,23,23,33,15,31,80,191,32,1,137,32,1,120,32,1,32,32,10,26,80,24,
+21,22,7,5,80,10,16,0,63,225,51,63,51,225,17,57,47,93,93,93,225,57,17,1,51,
+47,93,51,16,222,225,51,47,225,17,57,47,18,57,49,48,1,50,54,53,52,35,34,7,
+39,54,51,50,22,21,20,7,21,22,21,20,6,35,34,39,53,22,51,32,53,52,33,35,53,
+1,250,172,145,250,134,175,63,160,210,205,221,192,227,241,224,235,127,180,
+186,1,27,254,201,150,2,135,79,87,154,72,147,76,149,140,186,57,11,65,207,151,
+172,69,166,86,180,185,153,0,1,0,160,0,0,4,45,4,74,0,11,0,132,185,0,9,255,
+240,179,18,24,72,9,184,255,224,64,80,11,14,72,5,9,21,9,2,3,16,18,24,72,3,
+32,11,14,72,10,3,26,3,2,139,8,1,105,8,121,8,2,132,2,1,102,2,118,2,2,8,136,
+3,1,105,3,1,3,6,70,144,5,160,5,2,5,13,135,9,1,102,9,1,9,2,0,70,0,11,176,11,
+2,11,8,3,11,15,6,2,10,21,0,63,51,51,63,51,51,1,47,93,225,50,50,93,93,16,222,
+93,225,50,93,93,50,49,48,0,93,93,93,93,1,93,43,43,93,43,43,1,17,7,1,51,17,
+35,17,19,1,35,17,1,76,13,2,5,233,172,10,253,254,233,4,74,253,100,252,3,152,
+251,182,2,135,1,15,252,106,4,74,255,255,0,160,0,0,4,45,6,23,2,38,1,210,0,
+0,1,6,2,54,37,0,0,31,64,20,1,14,17,38,1,176,17,1,128,17,1,112,17,1,36,17,
+12,10,4,37,1,43,93,93,93,53,0,43,53,0,0,1,0,215,0,0,4,150,4,74,0,10,0,139,
+64,78,88,4,1,4,16,10,13,72,230,2,246,2,2,212,2,1,150,2,166,2,198,2,3,133,
+2,1,118,2,1,101,2,1,70,2,86,2,2,53,2,1,22,2,38,2,2,7,2,1,88,0,1,0,16,10,13,
+72,6,10,1,9,5,1,0,1,1,4,3,12,10,2,6,71,0,7,240,7,2,7,184,255,192,64,14,15,
+20,72,7,5,10,2,3,7,3,21,8,0,15,0,63,50,63,51,23,57,1,47,43,93,225,50,50,16,
+206,50,50,47,51,49,48,0,93,93,1,43,93,93,93,93,93,93,93,93,93,93,93,43,93,
+1,51,1,1,35,1,17,35,17,51,17,3,145,222,253,241,2,54,232,253,221,180,180,4,
+74,253,241,253,197,2,45,253,211,4,74,253,235,0,1,0,31,255,242,4,16,4,74,0,
+15,0,206,64,11,12,32,20,24,72,153,12,169,12,2,5,184,255,240,64,111,21,24,
+72,181,5,1,166,5,1,149,5,1,84,5,100,5,2,50,5,66,5,2,4,5,20,5,36,5,3,4,32,
+12,24,72,9,4,25,4,41,4,3,4,3,153,3,1,120,3,136,3,2,57,3,73,3,105,3,3,3,235,
+13,251,13,2,202,13,218,13,2,153,13,169,13,185,13,3,138,13,1,13,32,13,16,72,
+25,13,41,13,57,13,3,8,13,1,13,192,14,208,14,2,161,14,1,16,14,32,14,48,14,
+3,14,184,255,192,64,25,15,18,72,14,14,8,1,71,143,0,1,0,17,8,3,80,14,15,11,
+79,9,6,22,0,21,0,63,63,51,225,63,225,1,47,16,222,93,225,18,57,47,43,93,93,
+93,51,93,93,43,93,93,93,93,51,93,93,93,17,51,93,43,49,48,93,93,93,93,93,93,
+43,93,43,33,35,17,33,2,2,35,34,39,53,22,51,50,18,19,33,4,16,182,254,172,37,
+178,180,62,30,21,28,111,135,36,2,166,3,176,254,19,254,47,12,131,6,1,219,1,
+244,0,1,0,115,0,0,4,90,4,74,0,24,0,187,64,27,24,8,72,8,2,23,7,71,7,2,234,
+8,250,8,2,8,8,17,20,72,8,229,7,245,7,2,7,184,255,248,64,55,17,20,72,7,18,
+18,13,218,23,234,23,250,23,3,23,16,17,21,72,92,23,108,23,124,23,3,58,23,74,
+23,2,25,23,41,23,2,23,1,73,176,0,1,15,0,1,0,26,213,15,229,15,245,15,3,15,
+184,255,240,64,48,17,21,72,83,15,99,15,115,15,3,53,15,69,15,2,22,15,38,15,
+2,15,12,73,0,13,16,13,64,13,80,13,112,13,128,13,6,13,2,11,11,23,14,15,18,
+8,1,13,21,0,63,51,51,51,63,51,51,17,51,1,47,93,225,50,93,93,93,43,93,16,222,
+93,93,225,50,93,93,93,43,93,18,57,61,47,51,43,93,51,43,93,49,48,93,93,33,
+35,17,6,7,6,7,3,35,3,38,39,17,35,17,51,19,22,23,54,55,54,55,19,51,4,90,151,
+8,25,22,13,213,135,213,8,60,151,211,215,25,48,5,48,10,11,219,207,3,129,27,
+100,85,38,253,121,2,135,25,225,252,127,4,74,253,112,77,191,13,178,39,34,2,
+148,0,0,1,0,160,0,0,4,45,4,74,0,11,0,63,64,38,2,6,71,144,5,160,5,2,5,13,1,
+9,71,0,10,176,10,2,10,8,80,191,1,1,137,1,1,120,1,1,1,1,10,5,21,3,0,15,0,63,
+50,63,51,57,47,93,93,93,225,1,47,93,225,50,16,222,93,225,50,49,48,1,17,33,
+17,51,17,35,17,33,17,35,17,1,86,2,33,182,182,253,223,182,4,74,254,57,1,199,
+251,182,1,233,254,23,4,74,255,255,0,115,255,236,4,88,4,94,2,6,0,82,0,0,0,
+1,0,160,0,0,4,45,4,74,0,7,0,41,64,24,5,71,144,4,160,4,2,4,9,0,71,0,1,176,
+1,2,1,7,80,2,15,5,0,21,0,63,50,63,225,1,47,93,225,16,222,93,225,49,48,33,
+35,17,33,17,35,17,33,1,86,182,3,141,182,253,223,4,74,251,182,3,176,0,255,
+255,0,158,254,20,4,68,4,94,2,6,0,83,0,0,255,255,0,172,255,236,4,37,4,94,2,
+6,0,70,0,0,0,1,0,121,0,0,4,82,4,74,0,7,0,60,64,37,159,0,175,0,2,0,0,2,71,
+3,224,5,1,5,5,16,3,144,3,160,3,192,3,208,3,5,3,3,8,9,1,5,80,6,15,2,21,0,63,
+63,225,50,17,18,1,57,47,93,51,47,93,16,225,50,47,93,49,48,1,33,17,35,17,33,
+53,33,4,82,254,111,183,254,111,3,217,3,176,252,80,3,176,154,255,255,0,82,
+254,20,4,121,4,74,2,6,0,92,0,0,0,3,0,74,254,20,4,129,6,20,0,13,0,18,0,23,
+0,93,64,59,20,0,86,5,102,5,2,71,5,1,5,73,14,11,6,6,9,22,73,15,2,1,2,25,17,
+73,80,9,144,9,160,9,192,9,208,9,5,47,9,63,9,2,9,12,0,19,15,80,0,11,16,20,
+14,80,4,7,22,5,27,0,63,63,51,225,50,63,51,225,50,63,1,47,93,93,225,16,222,
+93,225,17,57,47,51,51,225,93,93,50,50,49,48,1,4,17,16,5,17,35,17,36,17,16,
+37,17,51,3,17,4,17,16,1,17,36,17,16,2,182,1,203,254,53,157,254,49,1,207,157,
+157,254,217,1,196,1,35,4,90,50,253,255,253,243,42,254,36,1,220,45,2,10,2,
+10,41,1,186,250,115,3,60,29,254,129,254,126,3,28,252,198,33,1,127,1,121,255,
+255,0,96,0,0,4,106,4,74,2,6,0,91,0,0,0,1,0,152,254,131,4,156,4,74,0,11,0,
+56,64,32,1,71,0,0,7,71,111,10,127,10,143,10,3,10,13,6,71,0,3,1,3,8,4,15,10,
+6,80,3,1,1,3,21,0,63,51,47,16,225,50,63,51,1,47,93,225,16,220,93,225,51,47,
+225,49,48,1,35,17,33,17,51,17,33,17,51,17,51,4,156,176,252,172,182,1,248,
+182,160,254,131,1,125,4,74,252,80,3,176,252,80,0,1,0,152,0,0,4,37,4,74,0,
+16,0,47,64,25,5,9,71,144,8,1,8,18,1,71,0,15,1,15,10,5,3,80,12,12,8,21,6,0,
+15,0,63,50,63,57,47,225,50,50,1,47,93,225,16,222,93,225,50,49,48,1,17,20,
+51,50,55,17,51,17,35,17,6,35,34,38,53,17,1,78,205,171,169,182,182,181,200,
+160,186,4,74,254,102,174,115,1,213,251,182,1,233,127,175,139,1,166,0,1,0,
+125,0,0,4,82,4,74,0,11,0,90,64,63,70,0,86,0,102,0,3,0,73,9,9,5,55,1,247,1,
+2,1,73,192,4,208,4,2,15,4,63,4,2,4,13,56,8,248,8,2,8,73,0,5,16,5,48,5,64,
+5,80,5,144,5,160,5,7,5,0,8,80,5,21,10,6,2,15,0,63,51,51,63,225,50,1,47,93,
+225,93,16,222,93,93,225,93,17,57,47,225,93,49,48,37,51,17,51,17,33,17,51,
+17,51,17,51,2,184,248,162,252,43,162,248,161,154,3,176,251,182,4,74,252,80,
+3,176,0,1,0,109,254,131,4,184,4,74,0,15,0,109,64,73,7,73,6,6,4,70,0,86,0,
+102,0,3,0,73,13,13,9,55,1,247,1,2,1,73,239,4,255,4,2,192,4,1,15,4,63,4,2,
+4,17,56,12,248,12,2,12,73,16,9,48,9,64,9,80,9,144,9,160,9,6,9,4,0,12,80,9,
+7,7,9,21,14,10,2,15,0,63,51,51,63,51,47,16,225,50,50,1,47,93,225,93,16,220,
+93,93,93,225,93,17,57,47,225,93,17,51,47,225,49,48,37,51,17,51,17,51,17,35,
+17,33,17,51,17,51,17,51,2,168,248,162,118,161,252,86,161,248,162,154,3,176,
+252,80,253,233,1,125,4,74,252,80,3,176,0,0,2,0,43,0,0,4,131,4,74,0,10,0,18,
+0,67,64,41,0,12,71,176,6,192,6,208,6,3,6,6,8,15,73,3,20,207,8,223,8,239,8,
+3,8,11,80,191,0,1,0,0,12,8,80,9,15,12,80,6,21,0,63,225,63,225,18,57,47,93,
+225,1,47,93,16,222,225,17,57,47,93,225,50,49,48,1,51,32,17,16,33,33,17,33,
+53,33,17,17,51,50,53,52,38,35,2,74,153,1,160,254,92,254,180,254,152,2,31,
+137,254,118,140,2,135,254,201,254,176,3,176,154,253,164,254,168,172,90,82,
+0,0,3,0,113,0,0,4,90,4,74,0,8,0,16,0,20,0,99,64,66,73,13,89,13,105,13,3,13,
+73,96,3,112,3,128,3,3,6,3,1,3,3,6,55,18,247,18,2,18,73,56,17,1,17,22,0,56,
+10,248,10,2,10,73,55,6,1,0,6,16,6,2,6,9,80,191,0,1,0,0,19,7,15,10,80,18,6,
+21,0,63,51,225,63,51,57,47,93,225,1,47,93,93,225,93,50,16,222,93,225,93,17,
+57,47,93,93,225,93,49,48,1,51,32,17,16,33,33,17,51,17,17,51,50,53,52,38,35,
+1,35,17,51,1,18,134,1,159,254,92,254,222,161,138,254,118,140,2,194,162,162,
+2,135,254,201,254,176,4,74,253,164,254,168,172,90,82,254,18,4,74,0,0,2,0,
+217,0,0,4,68,4,74,0,8,0,16,0,62,64,18,13,70,239,3,255,3,2,3,18,0,10,71,0,
+6,240,6,2,6,184,255,192,64,17,15,20,72,6,9,80,191,0,1,0,0,7,15,10,80,6,21,
+0,63,225,63,57,47,93,225,1,47,43,93,225,50,16,222,93,225,49,48,1,33,32,17,
+16,33,33,17,51,17,17,33,50,53,52,38,35,1,143,1,21,1,160,254,92,254,57,182,
+1,4,254,118,140,2,135,254,201,254,176,4,74,253,164,254,168,172,90,82,0,1,
+0,184,255,236,4,37,4,94,0,22,0,105,182,54,1,1,57,12,1,20,184,255,224,179,
+9,12,72,16,184,255,224,64,49,9,12,72,7,7,0,8,5,72,144,18,1,18,24,13,0,0,128,
+0,2,0,0,23,6,81,47,7,191,7,2,137,7,1,120,7,1,7,7,15,3,81,1,21,22,12,10,81,
+15,16,0,63,225,51,63,51,225,17,57,47,93,93,93,225,17,1,51,47,93,51,16,222,
+93,225,50,18,57,47,49,48,43,43,0,93,93,55,53,22,51,32,19,33,53,33,2,33,34,
+7,39,54,51,32,0,17,16,0,33,34,190,163,153,1,95,17,253,230,2,24,27,254,175,
+108,154,62,153,179,1,11,1,22,254,226,254,247,187,41,160,62,1,92,154,1,61,
+57,158,59,254,220,254,229,254,241,254,220,0,2,0,123,255,236,4,141,4,94,0,
+15,0,27,0,102,64,33,25,73,0,127,7,143,7,207,7,223,7,4,7,7,3,19,73,12,64,9,
+17,72,12,29,6,56,2,248,2,2,2,73,3,184,255,192,64,30,9,17,72,3,1,80,191,6,
+1,137,6,1,120,6,1,6,6,9,16,80,14,22,22,80,9,16,4,15,3,21,0,63,63,63,225,63,
+225,17,57,47,93,93,93,225,1,47,43,225,93,50,16,222,43,225,18,57,47,93,51,
+225,49,48,1,35,17,35,17,51,17,51,18,33,50,18,17,16,33,32,37,50,54,53,52,38,
+35,34,6,21,20,22,1,178,149,162,162,151,35,1,76,171,191,254,144,254,177,1,
+83,103,93,92,106,104,93,93,1,233,254,23,4,74,254,57,1,219,254,216,254,241,
+253,197,151,195,225,218,198,192,224,221,199,0,0,2,0,115,0,0,4,10,4,74,0,12,
+0,19,0,111,64,36,2,8,15,18,72,41,2,1,24,2,1,9,2,1,2,12,4,13,10,71,127,9,143,
+9,2,9,21,87,0,119,0,135,0,3,0,1,184,255,240,64,32,175,1,1,1,1,55,17,1,17,
+71,0,4,144,4,160,4,3,4,2,7,12,80,19,19,0,15,80,7,15,10,0,21,0,63,50,63,225,
+18,57,47,225,17,57,1,47,93,225,93,51,47,93,56,51,93,16,222,93,225,50,17,57,
+57,93,93,93,43,49,48,33,35,1,38,53,52,54,51,33,17,35,17,33,37,17,33,34,21,
+20,51,1,57,198,1,35,234,204,173,1,229,182,254,227,1,29,254,217,211,238,1,
+205,67,248,150,172,251,182,1,176,154,1,102,172,186,0,255,255,0,133,255,236,
+4,72,5,217,2,38,0,72,0,0,1,6,0,106,18,0,0,23,64,13,3,2,27,17,38,3,2,17,29,
+33,11,0,37,1,43,53,53,0,43,53,53,0,0,1,0,4,254,20,4,45,6,20,0,34,0,98,64,
+58,22,31,13,0,0,13,5,71,144,31,160,31,2,31,36,20,24,25,3,12,71,17,0,13,176,
+13,2,13,3,80,33,27,25,8,80,28,23,15,79,16,20,16,0,28,16,28,32,28,3,28,16,
+28,16,13,18,0,13,21,0,63,63,18,57,57,47,47,93,17,51,16,225,50,16,225,51,63,
+237,1,47,93,51,225,23,50,16,222,93,225,17,57,47,17,18,57,49,48,1,53,22,51,
+50,53,17,16,35,34,6,21,17,35,17,35,53,51,53,51,21,33,21,33,21,7,51,54,51,
+32,17,17,16,33,34,2,133,54,61,127,236,162,147,182,156,156,182,1,123,254,133,
+8,10,106,228,1,135,254,221,81,254,45,148,21,170,3,68,1,4,187,211,253,240,
+4,213,137,182,182,137,184,144,168,254,111,252,190,254,178,255,255,1,35,0,
+0,4,14,6,33,2,38,1,205,0,0,1,6,0,118,104,0,0,19,64,11,1,12,17,38,1,54,6,9,
+3,0,37,1,43,53,0,43,53,0,0,1,0,172,255,236,4,37,4,94,0,22,0,93,64,58,54,1,
+1,57,12,1,11,20,27,20,2,11,16,27,16,2,7,7,18,0,143,13,1,13,24,5,8,72,0,18,
+1,18,8,81,47,5,191,5,2,137,5,1,120,5,1,5,5,10,3,81,1,21,16,10,81,12,15,22,
+0,63,51,225,63,51,225,18,57,47,93,93,93,225,1,47,93,225,50,16,206,93,50,17,
+57,47,49,48,93,93,0,93,93,1,7,38,35,32,3,33,21,33,18,33,50,55,21,6,35,32,
+0,17,16,0,33,50,4,37,62,150,112,254,165,30,2,25,253,229,20,1,93,153,162,133,
+186,254,247,254,226,1,35,1,12,178,4,35,158,57,254,195,154,254,164,62,160,
+61,1,36,1,15,1,27,1,36,255,255,0,203,255,236,4,2,4,94,2,6,0,86,0,0,255,255,
+0,197,0,0,4,51,6,14,2,6,0,76,0,0,255,255,0,197,0,0,4,51,5,217,2,38,0,243,
+0,0,1,6,0,106,0,0,0,25,182,2,1,14,17,38,2,1,184,255,234,180,16,20,7,5,37,
+1,43,53,53,0,43,53,53,0,255,255,0,135,254,20,3,86,6,14,2,6,0,77,0,0,0,2,0,
+0,255,242,4,156,4,74,0,22,0,30,0,121,64,78,216,9,232,9,248,9,3,9,16,17,21,
+72,122,9,1,9,16,9,14,72,9,8,8,20,24,18,24,72,20,16,9,17,72,20,21,0,24,71,
+6,96,21,1,21,6,21,6,14,27,73,207,3,223,3,2,3,32,0,14,1,14,23,80,0,0,17,8,
+80,21,15,17,79,15,12,22,24,80,6,21,0,63,225,63,51,225,63,225,18,57,47,225,
+1,47,93,16,214,93,225,17,57,57,47,47,93,16,225,50,17,51,43,43,51,17,51,43,
+49,48,93,43,93,1,51,32,17,16,33,35,17,35,2,2,6,35,34,39,53,22,51,50,54,18,
+19,33,17,17,51,50,53,52,38,35,2,201,51,1,160,254,92,209,186,33,52,92,96,62,
+30,22,27,41,49,45,35,1,238,55,254,118,140,2,135,254,201,254,176,3,176,254,
+38,254,135,107,12,131,6,84,1,126,1,253,253,164,254,168,172,90,82,0,0,2,0,
+106,0,0,4,172,4,74,0,16,0,24,0,86,64,25,5,56,18,248,18,2,18,73,2,11,11,15,
+21,73,8,26,1,56,14,248,14,2,14,73,15,184,255,192,64,23,10,13,72,15,15,21,
+17,13,80,5,191,1,1,1,1,0,18,80,11,21,3,0,15,0,63,50,63,225,17,57,47,93,51,
+225,50,63,1,47,43,225,93,50,16,214,225,17,57,47,51,225,93,50,49,48,1,17,33,
+17,51,17,51,32,17,16,33,35,17,33,17,35,17,1,17,51,50,53,52,38,35,1,12,1,43,
+162,51,1,160,254,92,209,254,213,162,2,111,55,254,118,140,4,74,254,57,1,199,
+254,61,254,201,254,176,1,233,254,23,4,74,253,164,254,168,172,90,82,255,255,
+0,4,0,0,4,45,6,20,2,6,0,233,0,0,255,255,0,215,0,0,4,139,6,33,2,38,0,250,0,
+0,1,6,0,118,90,0,0,19,64,11,1,21,17,38,1,15,15,18,10,5,37,1,43,53,0,43,53,
+0,255,255,0,82,254,20,4,121,6,23,2,38,0,92,0,0,1,6,2,54,10,0,0,19,64,11,1,
+25,17,38,1,10,28,23,0,9,37,1,43,53,0,43,53,0,0,1,0,160,254,131,4,45,4,74,
+0,11,0,68,64,43,6,71,0,7,16,7,176,7,192,7,208,7,5,7,7,9,1,71,144,4,160,4,
+2,4,13,0,71,0,9,176,9,2,9,7,7,5,0,80,9,21,10,2,15,0,63,51,63,225,51,51,47,
+1,47,93,225,16,222,93,225,17,57,47,93,225,49,48,37,33,17,51,17,33,17,35,17,
+33,17,51,1,86,2,33,182,254,158,183,254,140,182,154,3,176,251,182,254,131,
+1,125,4,74,0,1,0,246,0,0,4,35,6,227,0,7,0,62,64,15,0,251,3,64,18,22,72,3,
+9,5,90,0,6,1,6,184,255,192,179,21,24,72,6,184,255,192,64,13,13,16,72,6,4,
+95,7,1,1,7,3,5,18,0,63,63,51,47,16,225,1,47,43,43,93,225,16,222,43,225,49,
+48,1,17,51,17,33,17,35,17,3,115,176,253,141,186,5,182,1,45,254,45,250,240,
+5,182,0,1,1,35,0,0,3,250,5,137,0,7,0,45,64,27,5,71,111,0,127,0,143,0,3,0,
+9,2,71,127,3,143,3,2,3,6,6,1,79,4,15,2,21,0,63,63,225,51,47,1,47,93,225,16,
+222,93,225,49,48,1,33,17,35,17,33,17,51,3,250,253,223,182,2,33,182,3,193,
+252,63,4,74,1,63,0,255,255,0,2,0,0,4,203,7,115,2,38,0,58,0,0,1,7,0,67,255,
+175,1,82,0,21,180,1,26,5,38,1,184,255,175,180,29,26,18,8,37,1,43,53,0,43,
+53,0,255,255,255,252,0,0,4,209,6,33,2,38,0,90,0,0,1,6,0,67,142,0,0,21,180,
+1,26,17,38,1,184,255,142,180,29,26,7,24,37,1,43,53,0,43,53,0,255,255,0,2,
+0,0,4,203,7,115,2,38,0,58,0,0,1,7,0,118,0,82,1,82,0,19,64,11,1,32,5,38,1,
+82,26,29,18,8,37,1,43,53,0,43,53,0,255,255,255,252,0,0,4,209,6,33,2,38,0,
+90,0,0,1,6,0,118,104,0,0,19,64,11,1,32,17,38,1,104,26,29,7,24,37,1,43,53,
+0,43,53,0,255,255,0,2,0,0,4,203,7,43,2,38,0,58,0,0,1,7,0,106,0,4,1,82,0,23,
+64,13,2,1,30,5,38,2,1,3,32,36,18,8,37,1,43,53,53,0,43,53,53,0,255,255,255,
+252,0,0,4,209,5,217,2,38,0,90,0,0,1,6,0,106,255,0,0,25,182,2,1,30,17,38,2,
+1,184,255,254,180,32,36,7,24,37,1,43,53,53,0,43,53,53,0,255,255,0,33,0,0,
+4,170,7,115,2,38,0,60,0,0,1,7,0,67,255,142,1,82,0,21,180,1,9,5,38,1,184,255,
+143,180,12,9,7,2,37,1,43,53,0,43,53,0,255,255,0,82,254,20,4,121,6,33,2,38,
+0,92,0,0,1,6,0,67,151,0,0,21,180,1,23,17,38,1,184,255,152,180,26,23,0,9,37,
+1,43,53,0,43,53,0,0,1,0,184,1,209,4,20,2,121,0,3,0,24,64,11,2,2,5,0,0,1,0,
+0,185,1,189,0,63,225,1,47,93,17,51,47,49,48,19,53,33,21,184,3,92,1,209,168,
+168,0,0,1,255,250,1,209,4,211,2,121,0,3,0,19,183,2,2,5,0,0,185,1,189,0,63,
+225,1,47,17,51,47,49,48,3,53,33,21,6,4,217,1,209,168,168,0,1,255,250,1,209,
+4,211,2,121,0,3,0,19,183,2,2,5,0,0,185,1,189,0,63,225,1,47,17,51,47,49,48,
+3,53,33,21,6,4,217,1,209,168,168,0,2,255,236,254,49,4,225,255,211,0,3,0,7,
+0,60,64,37,4,0,9,5,1,247,6,1,38,6,1,23,6,1,6,186,32,5,240,5,2,5,248,1,1,41,
+1,1,24,1,1,1,186,239,2,1,2,0,47,93,225,93,93,93,47,93,225,93,93,93,1,47,51,
+16,196,50,49,48,5,33,53,33,17,33,53,33,4,225,251,11,4,245,251,11,4,245,184,
+139,254,94,139,0,0,1,1,190,3,193,3,12,5,182,0,6,0,42,64,26,22,6,38,6,230,
+6,246,6,4,6,152,4,153,111,1,191,1,2,1,1,7,8,6,157,3,169,0,63,237,17,18,1,
+57,47,93,237,225,93,49,48,1,39,54,19,51,6,7,1,205,15,54,123,157,62,38,3,193,
+22,206,1,17,255,246,0,0,1,1,190,3,193,3,12,5,182,0,6,0,56,64,40,25,6,41,6,
+233,6,249,6,4,6,152,1,153,0,4,32,4,48,4,112,4,128,4,144,4,208,4,224,4,240,
+4,9,4,4,7,8,3,157,6,169,0,63,237,17,18,1,57,47,93,253,225,93,49,48,1,23,6,
+3,35,18,55,2,254,14,55,121,158,65,36,5,182,22,213,254,246,1,10,235,0,1,1,
+201,254,248,3,2,0,238,0,6,0,67,64,49,25,6,41,6,233,6,249,6,4,6,152,1,153,
+0,4,32,4,48,4,112,4,128,4,144,4,208,4,224,4,240,4,9,4,4,7,8,3,158,209,6,1,
+31,6,47,6,63,6,3,6,0,47,93,93,237,17,18,1,57,47,93,253,225,93,49,48,37,23,
+6,3,35,18,55,2,244,14,55,121,137,71,29,238,23,213,254,246,1,36,210,0,1,1,
+190,3,193,3,12,5,182,0,6,0,40,64,24,22,0,38,0,230,0,246,0,4,0,152,2,153,111,
+5,1,5,5,7,8,3,157,0,169,0,63,237,17,18,1,57,47,93,237,225,93,49,48,1,18,23,
+35,2,39,55,2,168,40,60,157,124,53,15,5,182,254,253,242,1,18,205,22,0,2,0,
+233,3,193,3,225,5,182,0,6,0,13,0,74,64,50,22,6,38,6,230,6,246,6,4,6,152,4,
+153,47,1,127,1,2,1,1,22,13,38,13,230,13,246,13,4,13,152,11,153,0,8,224,8,
+240,8,3,8,8,15,14,13,6,157,10,3,169,0,63,51,237,50,17,18,1,57,47,93,237,225,
+93,51,47,93,237,225,93,49,48,1,39,54,19,51,6,7,33,39,54,19,51,6,7,2,162,15,
+54,123,157,62,38,253,123,15,54,123,157,62,38,3,193,22,206,1,17,255,246,22,
+206,1,17,255,246,0,2,0,233,3,193,3,225,5,182,0,6,0,13,0,92,64,65,25,13,41,
+13,233,13,249,13,4,13,152,8,153,47,11,127,11,2,11,11,4,25,6,41,6,233,6,249,
+6,4,6,152,1,153,224,4,240,4,2,191,4,207,4,2,0,4,64,4,80,4,112,4,128,4,5,4,
+4,15,14,10,3,157,13,6,169,0,63,51,237,50,17,18,1,57,47,93,93,93,253,225,93,
+17,51,47,93,253,225,93,49,48,1,23,6,3,35,18,55,33,23,6,3,35,18,55,2,41,14,
+55,121,158,65,36,2,133,14,55,121,158,65,36,5,182,22,213,254,246,1,10,235,
+22,213,254,246,1,10,235,0,2,0,244,254,248,3,215,0,238,0,6,0,13,0,93,64,64,
+25,13,41,13,2,13,152,8,153,63,11,1,11,11,4,25,6,41,6,2,6,152,1,153,224,4,
+240,4,2,191,4,207,4,2,0,4,64,4,80,4,112,4,128,4,5,4,4,15,14,10,3,158,13,208,
+6,1,31,6,47,6,63,6,3,6,0,47,93,93,51,237,50,17,18,1,57,47,93,93,93,253,225,
+93,17,51,47,93,253,225,93,49,48,37,23,6,3,35,18,55,33,23,6,3,35,18,55,2,31,
+14,55,121,137,71,29,2,113,14,51,125,137,71,29,238,23,213,254,246,1,36,210,
+23,197,254,230,1,36,210,0,1,0,240,0,0,3,221,6,20,0,11,0,47,64,25,9,0,2,190,
+8,5,159,3,175,3,2,3,3,12,13,0,5,191,11,6,254,8,0,2,21,0,63,63,246,50,225,
+50,17,18,1,57,47,93,51,51,225,50,50,49,48,1,37,19,35,19,5,53,5,3,51,3,37,
+3,221,254,180,56,217,55,254,201,1,55,55,217,56,1,76,3,221,31,252,4,3,252,
+31,180,30,1,161,254,95,30,0,1,0,229,0,0,3,231,6,20,0,21,0,55,64,28,19,16,
+2,4,190,15,12,7,5,5,22,23,19,12,191,18,13,194,15,0,8,1,191,7,2,194,4,21,0,
+63,246,50,225,50,63,246,50,225,50,17,18,1,57,47,51,51,51,225,50,50,50,49,
+48,1,37,21,37,19,35,19,5,53,5,3,19,5,53,5,3,51,3,37,21,37,19,2,156,1,75,254,
+181,55,217,55,254,180,1,76,47,47,254,180,1,76,55,217,55,1,75,254,181,47,1,
+240,30,180,31,254,135,1,121,31,180,30,1,34,1,19,31,180,30,1,120,254,136,30,
+180,31,254,237,0,1,1,123,1,229,3,82,3,242,0,9,0,42,64,28,16,8,80,8,96,8,144,
+8,160,8,224,8,6,8,95,2,111,2,175,2,3,64,2,1,2,11,0,5,0,47,205,1,16,222,93,
+93,205,93,49,48,1,50,17,20,6,35,34,38,53,16,2,102,236,127,109,111,124,3,242,
+254,250,128,135,134,129,1,6,0,0,3,0,78,255,227,4,127,0,250,0,7,0,15,0,23,
+0,95,64,61,52,18,1,37,18,1,6,18,22,18,2,18,150,22,22,14,52,2,1,37,2,1,6,2,
+22,2,2,2,150,6,6,52,10,1,37,10,1,6,10,22,10,2,10,150,224,14,240,14,2,14,14,
+24,25,16,0,8,155,20,4,12,168,0,63,51,51,225,50,50,17,18,1,57,47,93,225,93,
+93,93,51,47,225,93,93,93,17,51,47,225,93,93,93,49,48,55,50,21,20,35,34,53,
+52,33,50,21,20,35,34,53,52,33,50,21,20,35,34,53,52,205,127,127,127,2,24,127,
+127,127,2,25,127,127,127,250,139,140,140,139,139,140,140,139,139,140,140,
+139,0,7,0,4,0,0,4,184,5,201,0,9,0,21,0,25,0,35,0,47,0,57,0,69,0,180,64,118,
+67,180,0,51,16,51,2,51,56,45,180,0,29,16,29,2,29,39,180,25,22,144,34,160,
+34,2,111,34,127,34,143,34,3,143,22,159,22,175,22,207,22,4,34,22,34,22,3,61,
+180,15,56,1,56,71,23,24,24,3,13,180,15,8,31,8,2,8,19,180,3,58,36,182,26,64,
+42,182,53,31,26,22,25,24,23,112,25,128,25,192,25,224,25,240,25,5,175,23,191,
+23,239,23,255,23,4,25,23,25,23,5,48,26,25,10,182,0,16,182,5,7,0,63,225,212,
+225,63,51,18,57,57,47,47,93,93,17,51,17,51,16,212,50,225,50,16,225,50,1,47,
+225,212,93,225,17,51,47,51,16,222,93,225,18,57,57,47,47,93,93,93,17,51,225,
+212,93,225,16,212,93,225,49,48,1,34,38,53,16,51,50,22,21,16,39,50,54,53,52,
+38,35,34,6,21,20,22,5,1,39,1,1,34,38,53,16,51,50,22,21,16,39,50,54,53,52,
+38,35,34,6,21,20,22,5,34,38,53,16,51,50,22,21,16,39,50,54,53,52,38,35,34,
+6,21,20,22,1,4,114,126,244,113,127,242,63,42,47,58,59,47,43,2,32,253,70,41,
+2,186,254,244,114,125,243,113,127,242,63,42,47,58,59,47,43,2,80,115,125,244,
+112,127,241,63,41,44,60,60,47,44,3,92,163,148,1,54,161,149,254,201,107,100,
+104,116,85,89,112,104,100,123,254,225,98,1,33,252,80,163,148,1,54,161,149,
+254,201,106,101,104,116,85,89,112,104,101,106,163,148,1,54,162,148,254,201,
+106,101,104,114,87,88,113,104,101,255,255,1,240,3,166,2,221,5,182,2,6,0,10,
+0,0,255,255,1,29,3,166,3,176,5,182,2,6,0,5,0,0,0,1,1,145,0,115,3,59,3,199,
+0,6,0,63,64,38,3,235,0,236,4,239,2,255,2,2,192,2,1,159,2,175,2,2,112,2,1,
+79,2,95,2,2,2,8,64,6,5,238,1,238,32,0,3,239,0,25,63,51,26,237,237,51,1,26,
+24,16,222,93,93,93,93,93,50,253,225,49,48,1,1,23,3,19,7,1,1,145,1,54,116,
+237,237,116,254,202,2,41,1,158,78,254,164,254,164,78,1,155,0,1,1,145,0,115,
+3,59,3,199,0,6,0,37,64,17,2,4,236,3,235,0,8,64,6,5,238,1,238,32,0,3,239,0,
+25,63,51,26,237,237,51,1,26,24,16,222,225,237,50,49,48,1,1,39,19,3,55,1,3,
+59,254,203,117,238,238,117,1,53,2,14,254,101,78,1,92,1,92,78,254,98,255,255,
+0,255,255,227,3,204,5,182,2,39,0,4,0,231,0,0,1,7,0,4,255,24,0,0,0,32,64,21,
+3,2,208,22,1,192,22,1,176,22,1,64,22,1,48,22,1,32,22,1,22,17,93,93,93,93,
+93,93,53,53,0,1,0,170,0,0,4,33,5,182,0,3,0,32,64,15,3,0,0,5,1,0,2,1,2,2,4,
+3,6,1,24,0,63,63,17,1,51,47,93,51,17,51,47,50,49,48,1,1,35,1,4,33,253,39,
+158,2,217,5,182,250,74,5,182,0,0,1,1,61,3,29,3,143,5,199,0,18,0,60,64,40,
+0,224,47,18,63,18,2,18,18,11,7,224,16,8,32,8,48,8,128,8,144,8,160,8,224,8,
+240,8,8,8,11,3,230,14,222,9,220,7,0,255,0,63,50,63,63,225,50,1,47,93,225,
+50,51,47,93,225,49,48,1,17,52,35,34,6,21,17,35,17,51,23,51,54,51,50,22,21,
+17,2,252,127,100,72,148,125,17,8,68,139,110,127,3,29,1,157,150,106,119,254,
+174,2,153,104,121,130,120,254,80,0,0,1,0,129,0,0,4,33,5,182,0,17,0,96,64,
+58,2,4,16,16,5,159,11,175,11,2,11,19,14,0,4,110,9,7,128,5,240,5,2,5,9,0,117,
+3,6,3,17,116,14,47,14,95,14,239,14,255,14,4,14,64,16,21,72,3,14,3,14,4,13,
+116,10,3,4,18,0,63,63,225,18,57,57,47,47,43,93,16,225,17,51,16,225,50,1,47,
+93,198,51,225,50,50,16,206,93,17,57,47,18,57,49,48,1,33,21,33,17,35,17,35,
+53,51,17,33,21,33,17,33,21,33,1,227,1,37,254,219,178,176,176,2,240,253,194,
+2,23,253,233,1,143,137,254,250,1,6,137,4,39,164,253,252,164,0,0,1,0,119,0,
+0,4,86,5,201,0,35,0,133,64,81,9,6,14,111,30,27,23,12,7,23,7,23,7,19,0,18,
+37,29,24,16,0,19,1,19,9,28,117,29,6,29,10,25,117,24,14,24,15,29,31,29,63,
+29,79,29,127,29,143,29,175,29,191,29,207,29,9,134,24,150,24,2,119,24,1,111,
+24,1,29,24,29,24,16,3,115,1,34,7,20,16,116,19,24,0,63,225,50,63,51,225,18,
+57,57,47,47,93,93,93,93,17,51,16,225,50,17,51,16,225,50,1,47,93,51,51,51,
+16,206,50,17,57,57,47,47,17,51,17,51,51,225,50,50,49,48,1,7,38,35,34,21,21,
+33,21,33,21,33,21,33,21,20,7,33,21,33,53,54,53,53,35,53,51,53,35,53,51,53,
+52,54,51,50,4,39,66,141,131,223,1,121,254,135,1,121,254,135,140,2,236,252,
+33,200,198,198,198,198,217,181,192,5,121,144,72,246,192,137,158,137,19,196,
+78,166,154,49,235,21,137,158,137,221,168,201,0,0,3,0,82,255,236,4,166,5,182,
+0,9,0,16,0,36,0,122,64,75,6,90,13,26,24,22,112,33,29,33,33,64,16,19,72,32,
+13,48,13,2,13,33,13,33,2,31,31,17,64,9,14,72,17,38,10,1,90,31,2,47,2,63,2,
+3,2,35,117,17,20,25,23,32,117,25,26,28,3,29,29,0,117,15,10,31,10,2,10,10,
+2,16,96,3,6,2,24,0,63,63,225,18,57,47,93,225,51,47,23,51,225,50,63,51,225,
+1,47,93,225,50,16,206,43,50,47,17,57,57,47,47,93,43,17,51,16,225,50,50,16,
+225,49,48,19,17,35,17,51,32,17,20,6,35,39,51,32,17,16,33,35,1,21,6,35,34,
+17,17,35,53,55,55,51,21,51,21,35,17,20,51,50,240,158,205,1,194,230,226,41,
+41,1,36,254,244,65,3,182,64,102,221,115,115,65,86,209,209,113,62,2,57,253,
+199,5,182,254,84,221,244,146,1,53,1,35,251,102,125,32,1,26,1,100,70,51,215,
+211,125,254,164,153,0,0,1,0,96,255,236,4,106,5,203,0,39,0,106,64,20,11,2,
+2,7,34,17,41,27,22,22,12,0,7,90,29,25,21,24,9,23,184,1,7,180,22,12,22,3,27,
+184,1,7,64,29,28,0,28,15,28,31,28,47,28,95,28,159,28,223,28,6,22,28,22,28,
+14,37,95,32,4,14,95,19,19,0,63,225,63,225,18,57,57,47,47,93,17,51,16,225,
+50,17,51,16,225,50,1,47,51,51,51,225,50,50,51,47,51,16,206,50,17,57,17,51,
+49,48,1,33,21,33,20,7,7,21,20,23,33,21,33,18,33,50,55,21,6,35,32,3,35,53,
+51,39,55,35,53,51,18,0,51,50,23,7,38,35,34,6,1,186,1,176,254,66,1,1,2,1,129,
+254,145,73,1,40,136,132,122,160,254,65,94,164,148,2,2,148,160,39,1,25,219,
+191,144,79,122,120,136,194,3,166,137,15,14,25,62,20,22,137,254,153,58,162,
+59,2,10,137,38,120,137,1,6,1,31,92,146,74,199,0,0,4,0,8,255,248,4,199,5,193,
+0,19,0,23,0,35,0,43,0,164,185,0,34,255,224,179,9,13,72,32,184,255,224,64,
+30,9,13,72,28,32,9,13,72,26,32,9,13,72,102,42,150,42,166,42,3,42,180,27,181,
+33,21,22,23,20,22,184,255,192,64,69,21,24,72,20,64,21,24,72,22,20,22,20,15,
+105,38,153,38,169,38,3,38,180,33,45,0,16,9,32,9,80,9,144,9,160,9,5,9,102,
+5,150,5,166,5,3,5,180,15,40,182,30,183,36,182,24,25,23,6,21,24,9,7,182,12,
+183,3,182,1,18,7,0,63,51,225,244,225,51,63,63,63,225,244,225,1,47,225,93,
+196,93,50,16,214,225,93,18,57,57,47,47,43,43,17,51,17,51,16,244,225,93,49,
+48,43,43,43,43,1,7,38,35,34,21,20,51,50,55,21,6,35,34,38,53,52,54,51,50,5,
+1,35,1,19,34,38,53,52,54,51,50,22,21,20,6,39,50,53,52,35,34,21,20,2,20,32,
+82,68,198,194,103,73,74,108,156,176,180,162,99,2,81,253,39,157,2,217,33,132,
+170,166,140,131,170,164,139,155,155,158,5,156,107,33,234,229,33,107,37,175,
+163,171,176,11,250,74,5,182,250,66,185,157,161,181,187,155,158,184,108,234,
+231,231,234,0,2,0,227,255,236,3,231,5,203,0,25,0,33,0,106,64,62,26,22,110,
+6,12,6,9,9,6,28,112,19,0,112,1,63,6,1,0,6,1,63,19,159,19,175,19,191,19,4,
+32,1,1,6,19,1,1,19,6,3,34,35,9,7,21,118,12,10,26,26,24,30,118,16,6,24,117,
+3,1,1,3,25,0,63,51,47,16,225,63,225,18,57,47,51,51,225,50,50,17,18,1,23,57,
+47,47,47,93,93,93,93,16,225,16,225,17,51,47,17,51,16,225,50,49,48,1,51,2,
+33,34,38,53,53,6,7,53,54,55,17,52,54,51,50,22,21,16,5,17,20,51,50,1,54,17,
+52,35,34,6,21,3,117,114,18,254,244,139,154,86,107,72,121,137,133,110,126,
+254,172,145,144,254,223,207,103,53,51,1,76,254,160,183,173,231,31,26,121,
+19,40,1,238,140,159,165,136,254,157,186,254,211,221,2,139,121,1,29,188,81,
+107,0,4,0,25,0,0,4,184,5,182,0,15,0,26,0,38,0,42,0,240,64,21,20,25,36,25,
+2,20,23,36,23,2,27,20,43,20,2,27,18,43,18,2,9,184,255,208,64,40,18,21,72,
+116,9,132,9,2,86,9,102,9,2,55,9,71,9,2,1,48,18,21,72,123,1,139,1,2,89,1,105,
+1,2,56,1,72,1,2,39,36,184,1,3,179,19,11,1,14,184,1,3,64,24,15,111,19,159,
+19,175,19,207,19,223,19,5,19,15,19,15,7,42,64,21,24,72,42,30,184,1,3,180,
+24,44,9,3,6,184,1,3,64,49,7,27,182,16,33,182,21,15,16,31,16,2,16,21,16,21,
+14,75,2,91,2,2,2,64,9,12,72,2,8,3,133,40,1,86,40,102,40,118,40,3,40,97,39,
+68,10,84,10,2,10,184,255,192,182,9,12,72,10,1,7,18,0,63,51,51,43,93,51,224,
+93,93,63,51,43,93,51,57,57,47,47,93,16,225,16,225,1,47,225,50,50,16,214,225,
+196,43,18,57,57,47,47,93,16,225,50,50,16,225,196,49,48,93,93,93,43,93,93,
+93,43,93,93,93,93,33,35,1,35,22,21,17,35,17,51,1,51,2,53,17,51,1,34,38,53,
+16,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,3,53,33,21,2,137,174,
+254,187,9,19,135,176,1,67,6,14,133,1,49,114,135,253,114,136,132,120,63,48,
+48,63,64,48,48,147,1,158,4,145,253,164,253,16,5,182,251,117,1,47,100,2,248,
+251,92,187,162,1,90,183,163,168,181,121,115,113,114,109,110,113,112,116,254,
+117,147,147,0,2,0,0,2,229,4,156,5,182,0,7,0,25,0,107,64,63,24,17,20,196,19,
+15,9,12,196,13,191,13,1,6,13,6,13,1,31,19,1,19,27,182,3,198,3,2,155,3,171,
+3,2,122,3,138,3,2,3,0,196,0,1,1,1,7,3,200,4,16,9,24,3,4,20,13,8,1,1,17,14,
+4,3,0,63,51,51,51,47,51,51,51,18,23,57,16,225,50,1,47,93,225,51,93,93,93,
+16,206,93,17,57,57,47,47,93,16,225,50,50,16,225,50,50,49,48,1,35,17,35,53,
+33,21,35,1,3,35,23,17,35,17,51,19,19,51,17,35,17,52,55,35,3,1,47,127,176,
+1,225,178,1,238,146,12,10,123,187,139,149,179,127,10,12,154,2,229,2,101,108,
+108,253,155,2,37,180,254,143,2,209,253,234,2,22,253,47,1,86,87,120,253,219,
+0,255,255,0,74,0,0,4,135,5,205,2,6,1,118,0,0,0,2,0,82,255,221,4,119,4,72,
+0,19,0,26,0,60,64,26,20,7,0,28,26,1,31,13,47,13,63,13,3,13,1,119,26,26,4,
+23,119,16,15,4,119,6,184,255,224,181,9,12,72,6,10,25,0,63,51,43,225,63,225,
+18,57,47,225,1,47,93,51,50,16,206,50,50,49,48,1,33,17,22,51,50,55,23,6,6,
+35,34,0,53,16,0,51,50,0,21,39,17,38,35,34,7,17,4,119,252,196,123,174,254,
+142,71,97,219,151,240,254,222,1,51,223,231,1,44,232,121,180,171,124,2,18,
+254,156,123,234,41,156,123,1,68,241,1,5,1,49,254,202,251,81,1,21,119,117,
+254,233,0,255,255,0,18,255,246,4,182,5,182,2,39,0,123,254,163,0,0,0,38,2,
+23,200,0,1,7,2,64,1,86,253,103,0,84,64,55,4,3,2,20,24,4,3,2,240,20,1,128,
+20,1,16,20,1,0,20,1,20,1,171,13,1,148,13,1,100,13,1,84,13,1,68,13,1,13,0,
+240,0,1,224,0,1,176,0,1,80,0,1,64,0,1,0,17,93,93,93,93,93,53,17,93,93,93,
+93,93,53,17,93,93,93,93,53,53,53,0,63,53,53,53,255,255,0,11,255,246,4,202,
+5,197,2,39,0,117,254,181,0,0,0,38,2,23,239,0,1,7,2,64,1,106,253,103,0,76,
+64,49,4,3,2,40,24,4,3,2,240,40,1,176,40,1,128,40,1,16,40,1,0,40,1,40,1,244,
+33,1,212,33,1,196,33,1,180,33,1,148,33,1,33,0,192,0,1,127,0,1,0,17,93,93,
+53,17,93,93,93,93,93,53,17,93,93,93,93,93,53,53,53,0,63,53,53,53,255,255,
+0,24,255,246,4,202,5,182,2,39,2,61,254,200,0,0,0,38,2,23,239,0,1,7,2,64,1,
+106,253,103,0,80,64,52,4,3,2,34,24,4,3,2,240,34,1,176,34,1,128,34,1,16,34,
+1,0,34,1,34,1,244,27,1,212,27,1,196,27,1,180,27,1,148,27,1,27,0,224,0,1,208,
+0,1,192,0,1,0,17,93,93,93,53,17,93,93,93,93,93,53,17,93,93,93,93,93,53,53,
+53,0,63,53,53,53,255,255,0,28,255,246,4,202,5,182,2,39,2,63,254,173,0,0,0,
+38,2,23,175,0,1,7,2,64,1,106,253,103,0,80,64,52,4,3,2,16,24,4,3,2,240,16,
+1,176,16,1,128,16,1,16,16,1,0,16,1,16,1,171,9,1,107,9,1,91,9,1,75,9,1,52,
+9,1,36,9,1,9,0,192,0,1,127,0,1,0,17,93,93,53,17,93,93,93,93,93,93,53,17,93,
+93,93,93,93,53,53,53,0,63,53,53,53,0,2,0,121,255,236,4,82,5,197,0,20,0,31,
+0,57,64,30,6,6,16,21,1,70,11,33,27,72,0,16,1,16,21,0,24,78,19,19,9,29,80,
+14,22,6,4,80,9,4,0,63,225,51,63,225,17,57,47,225,50,50,1,47,93,225,16,222,
+225,50,17,57,47,49,48,1,55,54,38,35,34,7,53,54,51,32,17,16,0,33,32,17,52,
+0,51,50,19,38,38,35,34,2,21,20,51,50,18,3,156,2,9,133,153,131,127,134,149,
+1,176,254,175,254,226,254,150,1,20,244,184,66,22,127,76,160,197,187,138,219,
+3,94,40,181,242,84,174,62,253,225,254,123,253,203,1,139,249,1,130,254,182,
+85,105,254,192,181,236,1,50,0,0,2,0,74,0,0,4,131,5,182,0,5,0,12,0,200,181,
+12,16,15,19,72,11,184,255,240,182,15,19,72,183,2,1,2,184,255,248,64,68,13,
+17,72,38,2,1,23,2,1,6,2,1,184,1,1,1,8,13,17,72,41,1,1,24,1,1,9,1,1,231,2,
+1,2,232,1,1,1,8,8,0,12,16,20,24,72,72,12,88,12,2,42,12,1,9,12,25,12,2,12,
+95,3,111,3,2,3,3,14,11,184,255,240,64,54,20,24,72,71,11,87,11,2,37,11,1,6,
+11,22,11,2,11,80,0,96,0,224,0,240,0,4,0,0,3,11,95,5,18,8,16,17,24,72,91,8,
+1,41,8,57,8,73,8,3,29,8,1,8,1,3,0,63,51,93,93,93,43,63,225,57,57,1,47,93,
+51,93,93,93,43,17,51,47,93,51,93,93,93,43,18,57,61,47,51,93,51,93,49,48,93,
+93,93,43,93,93,93,93,43,93,43,43,55,1,51,1,21,33,1,38,39,6,7,3,33,74,1,190,
+187,1,192,251,199,2,119,59,34,45,43,250,2,166,113,5,69,250,185,111,3,154,
+182,158,200,134,253,4,0,1,0,156,254,20,4,88,5,182,0,7,0,49,64,15,0,90,224,
+7,240,7,2,7,9,3,90,0,4,1,4,184,255,192,64,11,20,24,72,4,2,95,5,3,4,0,27,0,
+63,50,63,225,1,47,43,93,225,16,222,93,225,49,48,1,17,33,17,35,17,33,17,3,
+158,253,184,186,3,188,254,20,6,252,249,4,7,162,248,94,0,1,0,74,254,20,4,145,
+5,182,0,11,0,122,64,82,55,9,215,9,231,9,247,9,4,38,9,1,7,9,23,9,2,55,7,215,
+7,231,7,247,7,4,38,7,1,7,7,23,7,2,56,2,216,2,232,2,248,2,4,25,2,41,2,2,8,
+2,1,8,2,2,0,6,10,13,7,3,3,9,0,64,10,13,72,0,3,7,95,4,8,2,2,4,3,1,9,95,0,27,
+0,63,225,57,63,57,61,47,51,16,225,57,1,24,47,43,51,51,17,51,16,206,50,17,
+57,47,51,49,48,93,93,93,93,93,93,93,93,93,19,53,1,1,53,33,21,33,1,1,33,21,
+74,2,71,253,201,3,246,253,14,2,17,253,213,3,77,254,20,115,3,146,3,43,114,
+164,253,9,252,157,164,0,0,1,0,152,2,135,4,51,3,29,0,3,0,26,64,12,2,5,0,1,
+1,1,1,4,0,173,1,179,0,63,225,17,1,51,47,93,16,206,49,48,19,53,33,21,152,3,
+155,2,135,150,150,0,0,1,0,23,255,242,4,182,6,160,0,8,0,46,64,21,1,0,6,6,7,
+8,8,10,5,2,2,3,3,174,4,4,15,7,1,7,0,0,47,47,93,57,47,225,1,47,50,47,51,17,
+51,47,51,57,25,47,51,51,49,48,5,35,1,35,53,33,19,1,51,2,100,133,254,236,180,
+1,40,230,2,0,145,14,3,10,143,253,105,5,172,0,0,3,0,70,1,145,4,133,4,14,0,
+19,0,29,0,39,0,95,185,0,16,255,224,179,9,12,72,14,184,255,224,64,50,9,12,
+72,6,32,9,12,72,4,32,9,12,72,30,10,0,20,4,5,35,171,15,15,1,15,41,25,171,5,
+38,22,174,10,0,2,12,8,8,32,28,174,18,63,2,143,2,223,2,3,2,0,47,93,51,225,
+50,51,47,51,18,57,57,225,50,1,47,225,16,222,93,225,17,23,57,49,48,43,43,43,
+43,1,6,35,34,38,53,52,54,51,50,23,54,51,50,22,21,20,6,35,34,3,38,35,34,6,
+21,20,22,51,50,55,22,51,50,54,53,52,38,35,34,2,98,118,154,119,149,149,119,
+166,108,116,165,118,146,151,113,171,181,82,109,65,80,80,67,104,228,86,107,
+65,80,84,64,103,2,109,213,174,141,134,181,219,213,172,143,131,185,1,66,184,
+107,79,81,101,178,185,109,78,79,103,0,1,0,236,254,20,3,225,6,20,0,20,0,41,
+64,21,1,6,170,12,16,16,1,16,16,21,22,3,174,1,19,0,14,174,12,9,27,0,63,51,
+225,63,51,225,17,18,1,57,47,93,51,225,50,49,48,1,21,38,35,34,21,17,20,6,35,
+34,39,53,22,51,50,53,17,16,33,50,3,225,56,58,172,178,160,78,55,60,56,180,
+1,74,88,6,2,147,26,233,250,215,174,181,19,147,24,233,5,39,1,98,0,2,0,152,
+1,123,4,51,4,37,0,17,0,35,0,72,64,41,28,9,37,18,0,0,1,0,0,36,34,173,27,21,
+178,30,16,173,9,3,178,7,173,0,63,12,1,12,12,25,173,18,223,30,1,80,30,160,
+30,2,30,0,47,93,93,51,225,51,47,93,51,225,253,50,225,16,253,50,225,17,1,51,
+47,93,51,16,206,50,49,48,19,53,54,51,50,23,22,51,50,55,21,6,35,34,39,38,35,
+34,3,53,54,51,50,23,22,51,50,55,21,6,35,34,39,38,35,34,152,98,149,98,150,
+127,74,109,118,97,151,100,147,128,73,112,115,99,148,100,148,130,71,108,119,
+99,149,100,147,131,70,108,3,20,162,109,64,55,121,162,108,63,55,253,238,162,
+108,63,56,121,162,108,63,56,0,1,0,152,0,164,4,51,5,4,0,19,0,110,64,65,7,4,
+3,0,4,19,8,8,10,13,14,17,4,18,9,18,19,9,19,9,19,6,15,11,21,2,0,6,1,6,6,20,
+15,2,173,16,112,1,1,79,1,95,1,111,1,3,0,1,1,1,1,12,5,173,11,143,6,1,80,6,
+1,15,6,1,6,0,47,93,93,93,51,225,50,51,47,93,93,93,51,225,50,17,1,51,47,93,
+51,16,206,50,17,57,57,47,47,17,51,17,18,23,57,51,17,18,23,57,49,48,1,35,53,
+33,19,33,53,33,19,23,7,51,21,33,3,33,21,33,3,39,1,143,247,1,61,121,254,74,
+1,251,134,137,105,250,254,193,123,1,186,254,0,129,137,1,186,150,1,4,149,1,
+27,59,224,149,254,252,150,254,234,57,0,2,0,152,0,0,4,51,4,201,0,6,0,10,0,
+101,64,63,103,6,119,6,135,6,3,104,4,120,4,136,4,3,118,5,134,5,2,5,4,1,4,9,
+0,12,8,1,1,11,2,1,5,5,3,6,224,0,1,223,0,1,64,0,1,63,0,1,0,0,1,0,0,4,32,3,
+192,3,2,15,3,1,3,0,47,93,93,51,51,47,93,93,93,93,93,50,18,57,17,51,51,17,
+1,51,47,51,16,206,50,50,17,18,57,93,49,48,0,93,93,37,1,53,1,21,9,2,53,33,
+21,4,51,252,101,3,155,253,53,2,203,252,101,3,155,221,1,195,102,1,195,160,
+254,170,254,170,254,131,150,150,0,2,0,152,0,0,4,51,4,201,0,6,0,10,0,99,64,
+62,104,2,120,2,136,2,3,103,0,119,0,135,0,3,121,1,137,1,2,1,6,9,4,12,8,2,6,
+6,11,5,4,1,1,3,0,224,6,1,223,6,1,64,6,1,63,6,1,0,6,1,6,6,2,32,3,192,3,2,15,
+3,1,3,0,47,93,93,51,51,47,93,93,93,93,93,51,18,57,17,51,51,17,1,51,47,51,
+51,16,206,50,17,57,93,49,48,0,93,93,19,1,1,53,1,21,1,21,53,33,21,152,2,202,
+253,54,3,155,252,101,3,155,1,125,1,86,1,86,160,254,61,102,254,61,221,150,
+150,0,2,0,125,0,0,4,80,5,195,0,5,0,9,0,68,64,31,2,1,9,9,5,4,7,7,3,6,0,11,
+8,0,3,1,3,3,10,0,6,6,3,8,8,1,7,4,3,9,1,0,47,51,63,51,18,57,61,47,51,51,17,
+51,17,1,51,24,47,93,51,16,206,50,17,57,61,47,51,51,51,47,51,51,49,48,1,1,
+35,1,1,51,9,3,4,80,254,59,76,254,62,1,194,76,1,13,254,206,254,207,1,49,2,
+225,253,31,2,223,2,228,253,30,2,0,254,0,253,254,0,3,0,49,0,0,4,43,6,31,0,
+21,0,30,0,34,0,82,64,43,29,32,71,31,13,0,0,3,24,31,36,20,2,71,3,7,3,5,5,3,
+27,83,175,22,1,22,22,11,4,1,79,33,7,20,15,16,80,14,11,1,32,2,21,0,63,51,63,
+51,225,63,51,51,225,50,18,57,47,93,237,1,47,51,47,17,51,16,225,50,16,206,
+50,17,57,47,57,16,225,50,49,48,1,35,17,35,17,35,53,55,53,52,54,51,50,23,7,
+38,35,34,6,21,21,51,1,50,21,20,6,35,34,53,52,19,35,17,51,2,160,246,182,195,
+195,153,178,97,100,47,79,64,92,64,246,1,33,106,63,43,107,197,183,183,3,193,
+252,63,3,193,75,68,96,190,177,37,141,28,101,114,104,1,155,114,58,57,115,114,
+250,27,4,74,0,2,0,49,0,0,4,27,6,31,0,21,0,25,0,66,64,34,13,22,0,0,3,23,71,
+22,27,20,2,71,3,7,3,5,5,3,24,0,4,1,79,7,20,15,16,80,14,11,1,23,2,21,0,63,
+51,63,51,225,63,51,225,50,63,1,47,51,47,17,51,16,225,50,16,222,225,18,57,
+47,18,57,49,48,1,35,17,35,17,35,53,55,53,52,54,51,50,23,7,38,35,34,6,21,21,
+51,1,35,17,51,2,160,246,182,195,195,153,178,97,100,47,79,64,92,64,246,1,123,
+183,183,3,193,252,63,3,193,75,68,96,190,177,37,141,28,101,114,104,251,182,
+6,20,0,0,1,0,231,4,217,3,229,6,23,0,11,0,45,64,16,6,136,0,5,1,5,5,11,136,
+0,0,13,5,0,146,9,184,1,1,181,15,2,95,2,2,2,0,47,93,225,228,50,17,1,51,47,
+225,51,47,93,225,49,48,1,2,33,34,38,39,51,22,22,51,50,55,3,229,20,254,143,
+195,172,10,170,8,84,119,194,17,6,23,254,194,148,170,102,85,187,0,1,0,135,
+254,20,3,86,4,74,0,15,0,47,64,26,8,0,6,71,144,11,160,11,2,11,11,16,17,0,0,
+1,0,3,80,1,14,27,7,78,10,15,0,63,225,63,51,225,1,47,93,17,18,57,47,93,225,
+17,57,49,48,19,53,22,51,50,54,53,17,37,53,33,17,20,6,35,34,135,134,155,117,
+131,254,92,2,90,226,206,164,254,55,154,39,114,101,4,57,21,123,251,65,180,
+195,0,0,1,1,238,4,205,2,223,6,20,0,9,0,22,64,9,9,9,4,4,11,8,146,3,0,0,63,
+237,17,1,51,47,51,47,49,48,1,55,54,55,51,21,20,6,7,35,1,238,26,26,9,180,84,
+61,96,4,231,107,116,78,20,14,198,95,0,1,1,227,254,59,2,233,255,131,0,8,0,
+27,64,13,8,8,3,3,10,7,146,15,2,31,2,2,2,0,47,93,237,17,1,51,47,51,47,49,48,
+1,54,55,51,21,20,6,7,35,1,227,62,22,178,96,67,99,254,86,140,161,20,22,204,
+82,0,1,1,227,4,217,2,233,6,33,0,8,0,27,64,13,3,3,8,8,10,7,146,15,2,95,2,2,
+2,0,47,93,237,17,1,51,47,51,47,49,48,1,6,7,35,53,52,54,55,51,2,233,63,20,
+179,91,73,98,6,6,153,148,21,17,201,89,0,2,1,57,2,57,3,147,5,199,0,9,0,17,
+0,34,64,18,12,224,48,8,1,8,8,16,224,3,14,230,5,222,10,230,0,223,0,63,225,
+63,225,1,47,225,51,47,93,225,49,48,1,34,38,53,16,33,50,22,21,16,37,50,17,
+16,35,34,17,16,2,100,142,157,1,43,149,154,254,209,156,156,151,2,57,234,223,
+1,197,236,217,254,55,131,1,70,1,68,254,188,254,186,0,2,1,37,2,168,3,127,5,
+195,0,10,0,17,0,86,64,52,17,95,6,207,6,2,6,6,9,104,0,120,0,2,0,32,11,14,72,
+0,2,224,11,7,31,3,143,3,2,3,3,18,19,4,1,228,17,6,14,7,11,9,27,9,2,9,9,2,7,
+222,2,223,0,63,63,18,57,47,93,18,57,51,51,225,50,17,18,1,57,47,93,51,51,225,
+50,43,93,50,51,47,93,51,49,48,1,35,21,35,53,33,53,1,51,17,51,35,53,52,55,
+6,7,7,3,127,84,143,254,137,1,121,141,84,227,6,40,40,156,3,86,174,174,98,2,
+11,254,4,176,82,90,73,58,217,0,1,1,80,2,145,3,68,5,182,0,24,0,92,64,57,14,
+15,15,11,12,64,16,24,72,10,12,10,12,0,5,224,15,20,31,20,79,20,95,20,127,20,
+143,20,159,20,7,20,20,207,0,1,112,0,1,0,10,9,9,7,229,17,17,11,3,228,1,23,
+223,14,228,11,220,0,63,225,63,51,225,17,57,47,225,51,18,57,1,47,93,93,51,
+47,93,225,18,57,57,47,47,43,51,51,17,51,49,48,1,53,22,51,50,53,52,35,34,7,
+39,19,33,21,33,7,54,51,50,22,21,20,6,35,34,1,80,102,105,162,166,52,73,62,
+31,1,141,254,224,17,35,61,118,147,150,145,124,2,193,129,68,147,146,17,39,
+1,125,110,193,6,130,109,127,142,0,2,1,57,2,57,3,147,5,213,0,16,0,27,0,56,
+64,30,3,22,224,15,1,15,17,224,48,9,1,9,9,15,3,19,228,0,6,1,6,6,0,25,230,12,
+223,1,0,222,0,63,50,63,225,17,57,47,93,225,50,1,47,51,47,93,225,18,57,16,
+225,50,49,48,1,23,4,7,51,54,51,50,22,21,20,6,35,34,38,53,16,1,52,35,34,6,
+21,20,22,51,50,54,3,29,45,254,183,52,10,61,140,112,131,165,134,135,168,1,
+205,147,74,98,93,75,68,83,5,213,109,110,215,92,153,128,133,168,187,157,1,
+151,254,60,172,87,64,86,113,92,0,1,1,111,2,160,3,147,5,182,0,6,0,53,64,34,
+6,0,0,1,15,5,79,5,127,5,3,5,5,0,2,80,2,96,2,112,2,176,2,208,2,6,2,5,2,230,
+3,220,0,221,0,63,63,225,50,1,47,93,50,47,93,51,57,47,51,49,48,1,1,33,53,33,
+21,1,1,195,1,53,254,119,2,36,254,203,2,160,2,157,121,100,253,78,0,3,1,49,
+2,143,3,96,5,195,0,19,0,27,0,36,0,125,64,83,10,28,12,34,224,2,20,0,2,26,224,
+12,22,224,18,12,18,12,18,8,15,2,127,2,191,2,3,2,2,30,224,31,8,239,8,2,8,105,
+20,1,184,0,200,0,216,0,3,105,0,1,184,10,200,10,216,10,3,105,10,1,105,28,185,
+28,201,28,217,28,4,28,10,0,20,4,5,24,229,15,222,32,229,5,223,0,63,225,63,
+225,18,23,57,93,93,93,93,93,93,1,47,93,225,51,47,93,18,57,57,47,47,16,225,
+16,225,17,57,57,16,225,17,57,57,49,48,1,22,21,20,6,35,34,38,53,52,55,38,53,
+52,54,51,50,22,21,20,7,54,53,52,35,34,21,20,23,6,21,20,51,50,53,52,39,2,186,
+166,152,124,136,147,139,114,144,112,111,141,252,106,108,107,92,118,131,135,
+135,4,66,85,122,103,125,118,104,130,74,79,114,91,110,108,93,116,19,49,84,
+96,96,81,161,63,90,117,117,89,58,0,2,1,57,2,57,3,147,5,201,0,20,0,31,0,57,
+64,31,5,26,224,1,11,48,17,1,17,17,21,224,11,5,23,228,15,8,1,8,8,14,3,228,
+1,19,223,29,230,14,222,0,63,225,63,51,225,17,57,47,93,225,50,1,47,225,51,
+47,93,18,57,225,50,49,48,1,53,22,51,32,19,35,6,35,34,38,53,52,54,51,50,22,
+21,16,33,34,19,20,51,50,54,53,52,38,35,34,6,1,135,39,62,1,16,14,8,71,126,
+122,138,160,131,142,169,254,99,62,13,149,73,97,89,77,68,85,2,72,125,23,1,
+59,98,149,126,133,170,205,186,253,247,2,99,164,87,56,80,123,94,0,0,18,0,55,
+254,129,4,150,5,238,0,19,0,37,0,57,0,69,0,75,0,81,0,87,0,93,0,97,0,101,0,
+105,0,109,0,113,0,117,0,121,0,125,0,134,0,143,1,6,64,46,98,122,101,125,122,
+125,76,93,63,19,19,69,9,135,127,127,37,139,131,131,24,15,33,95,33,111,33,
+3,33,33,37,42,55,79,9,95,9,2,16,37,32,37,96,37,3,37,184,255,192,64,100,21,
+24,72,64,55,80,55,224,55,3,9,37,55,55,37,9,3,70,85,85,118,114,110,93,70,107,
+103,95,76,116,104,112,96,120,108,104,96,108,108,96,104,3,76,71,41,57,57,38,
+27,126,126,135,32,15,19,72,135,135,20,127,127,96,37,1,37,37,143,20,20,14,
+240,38,1,111,38,1,38,38,52,45,60,255,4,1,4,4,66,14,45,14,45,14,88,83,88,122,
+76,83,99,71,0,47,51,51,47,51,51,17,18,57,57,47,47,17,51,51,47,93,51,17,51,
+51,47,93,93,18,57,47,51,51,47,93,51,17,18,57,47,43,51,18,57,17,51,17,51,17,
+18,23,57,47,47,47,17,51,17,51,17,51,1,47,50,50,50,50,47,51,51,51,51,17,18,
+23,57,47,47,47,93,43,93,93,17,51,17,51,47,93,51,51,17,51,17,51,17,51,17,51,
+51,47,51,17,18,57,57,17,51,17,51,49,48,0,14,2,35,34,46,2,53,52,62,2,51,50,
+30,2,21,3,51,50,22,21,20,6,7,21,30,3,21,20,6,35,35,23,33,21,35,21,20,6,35,
+34,38,39,53,22,22,51,50,54,53,53,35,0,22,51,50,54,53,52,38,35,34,6,21,37,
+17,33,21,35,21,3,17,51,21,51,21,1,53,33,17,35,53,3,53,51,53,51,17,1,35,17,
+51,1,53,33,21,1,35,17,51,17,35,17,51,1,35,17,51,17,35,17,51,17,35,17,51,1,
+53,33,21,3,21,51,50,54,53,52,38,35,39,51,50,54,53,52,38,35,35,2,160,25,52,
+78,54,54,79,51,25,25,51,79,54,54,78,52,25,137,137,88,88,37,35,18,31,23,14,
+87,75,165,223,1,10,72,88,69,31,43,12,12,39,24,29,39,94,254,108,53,56,57,51,
+51,57,56,53,254,213,1,47,192,111,111,192,2,0,1,48,109,195,195,109,252,16,
+111,111,1,57,1,15,253,184,111,111,111,111,3,240,109,109,109,109,109,109,253,
+73,1,15,117,59,38,30,30,42,55,51,37,29,33,37,47,4,5,88,64,35,35,64,88,54,
+55,89,63,35,35,63,89,55,254,224,53,66,40,54,7,4,3,14,25,38,28,65,72,52,77,
+242,80,76,5,3,82,2,4,29,41,244,3,44,83,83,74,75,83,83,75,131,1,48,111,193,
+249,195,1,47,194,109,6,254,111,254,208,193,249,2,109,194,254,209,3,45,1,16,
+2,193,111,111,250,168,1,14,2,2,1,15,253,104,1,16,253,105,1,14,2,2,1,15,250,
+59,109,109,3,145,122,34,31,25,32,80,27,25,27,24,0,3,0,4,254,193,4,203,6,20,
+0,3,0,41,0,57,0,78,64,38,4,41,41,42,113,50,1,80,50,96,50,2,50,50,42,23,23,
+127,42,1,42,42,2,30,15,15,2,55,45,41,41,45,45,3,27,18,18,3,0,25,47,51,24,
+47,51,17,51,47,51,47,17,51,1,25,47,51,24,47,51,17,51,47,93,51,47,17,51,47,
+93,93,17,51,47,51,49,48,9,3,5,53,52,62,2,55,62,3,53,52,38,35,34,14,2,7,23,
+54,54,51,50,22,21,20,14,2,7,14,3,21,21,7,20,22,51,50,62,2,53,52,46,2,35,34,
+6,2,102,2,101,253,155,253,158,2,152,7,20,35,28,35,53,35,18,152,135,35,72,
+70,65,28,66,55,102,45,53,50,11,24,38,28,31,43,27,13,21,65,50,21,41,32,19,
+19,32,41,21,50,65,6,20,252,86,252,87,3,169,233,43,23,34,33,34,23,33,57,62,
+71,46,124,136,14,25,33,18,160,31,41,53,42,26,40,36,37,24,28,51,54,59,36,55,
+246,65,58,14,30,47,32,34,47,29,13,56,0,255,255,0,135,254,20,3,169,6,33,2,
+38,2,55,0,0,1,6,1,76,247,0,0,11,182,1,111,24,16,0,10,37,1,43,53,0,255,255,
+1,190,3,193,3,12,5,182,2,6,2,7,0,0,0,2,0,10,255,236,4,178,6,43,0,12,0,79,
+0,93,64,55,8,70,67,67,26,0,59,71,77,144,16,160,16,2,16,16,81,15,81,175,81,
+2,51,70,144,26,1,26,62,79,79,78,0,78,34,78,41,0,41,16,41,2,78,41,78,41,56,
+5,78,72,1,56,78,21,22,0,63,225,63,225,18,57,57,47,47,93,16,225,17,51,16,225,
+50,1,47,93,225,93,17,51,47,93,51,225,50,17,57,47,225,49,48,1,46,3,35,34,6,
+21,20,30,2,5,22,22,21,20,2,6,6,35,34,46,2,53,52,62,2,53,52,38,35,34,6,7,39,
+54,54,51,50,30,2,21,20,14,2,21,20,30,2,51,50,18,17,52,38,39,46,3,53,52,62,
+2,51,50,30,2,23,51,21,3,106,13,57,77,91,48,76,86,46,106,171,1,60,2,2,64,129,
+196,131,111,146,86,34,10,11,10,31,31,24,54,16,37,37,100,54,50,69,44,19,10,
+11,10,21,48,78,58,164,164,2,2,174,242,150,67,39,81,127,89,104,161,117,75,
+18,143,3,209,108,170,116,61,88,72,56,105,82,51,138,22,58,31,159,254,238,201,
+115,55,95,125,69,40,93,89,75,24,45,33,15,10,127,17,26,28,50,68,40,35,86,93,
+97,45,42,74,54,31,1,50,1,48,23,62,20,2,75,120,154,81,67,112,82,46,84,156,
+223,139,137,0,0,1,0,31,0,0,4,184,5,195,0,32,0,141,185,0,32,255,248,179,20,
+24,72,32,184,255,248,64,70,13,16,72,38,32,54,32,2,23,32,1,32,175,31,255,31,
+2,89,31,1,31,0,84,13,1,41,13,1,13,27,90,208,30,1,162,30,1,147,30,1,3,142,
+30,1,4,99,30,1,5,16,30,80,30,2,30,17,10,10,59,27,1,59,30,1,39,0,183,0,2,0,
+184,255,248,64,12,13,17,72,0,30,27,3,29,31,3,29,18,0,63,63,18,23,57,43,93,
+93,93,51,17,51,1,47,93,95,93,95,93,95,93,93,93,225,50,93,93,57,205,93,93,
+50,93,93,43,43,49,48,1,62,3,55,62,3,51,50,22,23,21,38,38,35,34,6,7,14,5,7,
+17,35,17,1,51,2,100,25,75,78,73,24,22,46,54,64,41,34,43,17,12,33,12,28,62,
+35,12,47,58,66,63,56,19,187,254,25,202,2,219,75,168,160,137,44,40,61,39,20,
+9,8,145,3,5,47,60,21,83,110,129,136,134,60,253,227,2,47,3,135,0,0,2,0,18,
+255,236,4,180,4,74,0,32,0,64,0,95,64,60,30,29,86,56,102,56,2,71,56,1,56,73,
+55,55,5,33,73,16,21,32,21,2,21,21,66,44,73,64,5,80,5,144,5,160,5,192,5,208,
+5,6,47,5,1,5,55,55,49,39,16,10,80,13,15,60,30,49,80,26,0,22,0,63,50,225,50,
+50,63,225,50,50,18,57,47,1,47,93,93,225,17,51,47,93,225,17,57,47,225,93,93,
+57,57,49,48,5,34,46,2,53,52,62,2,55,35,53,55,33,21,35,30,3,21,20,14,2,35,
+34,38,39,35,6,6,1,52,46,2,39,33,14,3,21,20,30,2,51,50,62,2,53,53,51,21,20,
+22,51,50,62,2,1,123,79,110,69,31,10,22,35,25,164,134,4,28,155,24,35,23,10,
+31,69,110,79,94,111,26,11,26,111,1,246,10,23,35,24,253,233,25,35,22,10,16,
+35,52,36,36,54,35,17,157,79,63,36,52,35,16,20,68,128,181,114,67,116,110,114,
+66,74,80,154,66,114,110,116,67,114,181,128,68,87,91,91,87,1,235,62,114,112,
+118,67,67,118,112,114,62,91,129,82,38,41,72,98,57,203,203,130,138,38,82,129,
+255,255,0,113,0,0,4,92,7,117,2,38,0,48,0,0,1,7,0,118,0,100,1,84,0,19,64,11,
+1,26,5,38,1,100,20,23,6,12,37,1,43,53,0,43,53,0,255,255,0,92,0,0,4,115,6,
+33,2,38,0,80,0,0,1,6,0,118,127,0,0,19,64,11,1,39,17,38,1,126,33,36,17,31,
+37,1,43,53,0,43,53,0,255,255,0,33,253,213,4,172,5,188,2,38,0,36,0,0,1,6,2,
+91,2,0,0,23,64,13,3,2,30,20,39,3,2,1,25,15,4,7,37,1,43,53,53,0,43,53,53,0,
+255,255,0,135,253,213,4,2,4,94,2,38,0,68,0,0,1,6,2,91,251,0,0,23,64,13,3,
+2,49,23,39,3,2,28,44,34,8,22,37,1,43,53,53,0,43,53,53,0,255,255,254,200,255,
+236,5,12,5,205,0,39,0,50,0,145,0,0,1,7,2,92,253,155,0,0,0,45,64,21,3,2,43,
+3,3,2,96,51,1,80,51,1,64,51,1,32,51,1,0,51,1,184,255,24,180,51,51,2,2,37,
+1,43,93,93,93,93,93,53,53,0,63,53,53,0,0,2,1,131,253,213,3,72,255,131,0,19,
+0,31,0,77,64,16,20,16,19,24,72,20,131,15,0,31,0,47,0,3,0,26,184,255,240,182,
+19,24,72,26,131,10,29,184,255,248,64,25,21,24,72,29,140,0,5,16,5,32,5,112,
+5,192,5,5,5,23,8,21,24,72,23,140,15,0,47,225,43,220,93,225,43,1,47,225,43,
+220,93,225,43,49,48,1,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,7,52,38,35,
+34,6,21,20,22,51,50,54,3,72,35,62,84,49,50,82,59,32,32,59,82,50,48,84,62,
+36,117,63,50,49,63,57,55,50,63,254,174,51,81,56,29,29,56,79,51,51,79,56,29,
+29,55,79,52,53,60,60,53,53,60,60,0,0,2,1,45,4,104,3,139,5,199,0,17,0,31,0,
+48,64,26,64,0,1,0,64,12,12,18,32,9,12,72,18,128,24,23,30,23,30,79,3,95,3,
+2,3,15,0,47,204,93,57,57,47,47,1,47,26,205,43,50,47,26,205,93,49,48,1,52,
+54,55,21,6,6,21,20,30,2,21,20,6,35,34,38,5,62,3,55,51,21,14,3,7,35,1,45,120,
+122,60,57,31,36,31,50,46,59,68,1,53,11,25,24,22,8,207,18,48,56,62,31,82,4,
+231,78,115,31,76,22,46,24,19,18,16,26,28,37,39,70,37,30,75,79,81,36,20,32,
+77,80,81,37,0,0,2,0,66,0,0,4,41,6,31,0,39,0,52,0,99,64,55,22,41,28,28,39,
+39,2,41,6,38,3,3,6,6,10,223,2,1,2,2,54,40,7,7,13,0,10,16,10,80,10,160,10,
+176,10,5,10,10,7,3,82,40,13,38,15,47,32,78,19,25,1,9,5,1,21,0,63,51,51,63,
+51,225,50,63,51,51,225,50,50,1,47,93,51,51,17,51,17,51,47,93,18,57,47,51,
+17,51,17,51,17,51,17,51,17,18,57,49,48,33,35,17,35,17,35,17,35,17,35,17,35,
+53,55,53,52,62,2,51,50,22,23,54,54,51,50,22,23,7,38,38,35,34,14,2,21,21,33,
+33,51,53,52,55,38,38,35,34,14,2,21,4,41,164,203,163,205,164,100,100,40,77,
+112,72,49,87,34,38,102,63,52,91,37,41,29,69,37,38,55,36,17,1,111,253,33,205,
+24,20,45,23,35,53,35,18,3,203,252,53,3,203,252,53,3,203,65,62,82,106,141,
+84,35,22,13,29,27,23,14,131,11,17,22,52,87,64,104,102,115,78,6,8,22,52,87,
+64,0,2,0,66,0,0,4,41,6,31,0,39,0,52,0,97,64,54,44,20,41,26,26,29,41,4,38,
+1,1,4,4,8,223,29,1,29,29,54,40,5,5,11,0,8,16,8,80,8,160,8,176,8,5,8,8,5,1,
+82,40,11,38,15,7,3,28,21,47,32,78,17,23,1,0,63,51,225,50,63,51,51,63,51,51,
+225,50,50,1,47,93,51,51,17,51,17,51,47,93,18,57,47,51,17,51,17,51,17,51,17,
+18,57,57,49,48,1,35,17,35,17,35,17,35,17,35,53,55,53,52,62,2,51,50,22,23,
+54,54,51,50,23,51,17,35,17,38,38,35,34,14,2,21,21,51,33,51,53,52,55,38,38,
+35,34,14,2,21,3,72,142,163,205,164,100,100,40,77,112,72,49,87,34,38,102,63,
+48,46,131,164,14,29,14,38,55,36,17,142,254,2,205,24,20,45,23,35,53,35,18,
+3,203,252,53,3,203,252,53,3,203,65,62,82,106,141,84,35,22,13,29,27,11,249,
+236,5,141,3,3,22,52,87,64,104,102,115,78,6,8,22,52,87,64,0,2,0,84,255,236,
+4,246,6,20,0,32,0,52,0,51,64,28,23,91,25,43,91,30,18,0,54,33,91,31,10,47,
+10,2,10,30,48,95,23,18,15,4,38,95,5,19,0,63,225,63,51,206,225,50,1,47,93,
+225,16,222,50,50,225,214,225,49,48,1,20,2,6,6,35,34,38,38,2,53,52,18,54,54,
+51,50,22,23,62,3,55,51,23,14,3,7,22,22,5,20,30,2,51,50,62,2,53,52,46,2,35,
+34,14,2,4,123,64,132,200,135,142,201,129,60,60,129,203,142,124,187,66,18,
+23,13,6,2,198,15,11,33,49,68,46,42,42,252,158,36,79,128,92,93,128,78,35,35,
+78,127,92,93,128,80,36,2,221,169,254,234,198,108,108,198,1,23,170,170,1,21,
+196,107,90,86,19,52,63,73,40,22,52,99,87,74,28,91,233,137,137,219,153,81,
+81,153,219,137,138,218,151,81,81,151,218,0,0,2,0,115,255,236,4,246,4,242,
+0,32,0,43,0,53,64,28,18,30,30,0,23,74,25,38,72,0,45,33,72,0,10,1,10,30,41,
+80,23,18,15,16,36,80,5,22,0,63,225,63,51,198,225,50,1,47,93,225,16,222,225,
+220,225,17,51,17,51,48,49,1,20,14,2,35,34,46,2,53,52,62,2,51,50,22,23,62,
+3,53,51,23,14,3,7,22,22,5,20,22,51,32,17,52,38,35,34,6,4,88,74,133,184,111,
+103,180,134,78,73,132,185,111,97,171,66,38,43,21,5,198,15,15,42,57,75,49,
+38,42,252,215,157,154,1,54,157,155,154,155,2,39,137,213,145,76,76,145,213,
+137,136,211,145,75,66,65,16,56,72,87,48,23,69,114,91,67,21,66,165,99,211,
+209,1,164,210,206,206,0,0,1,0,125,255,236,5,23,6,20,0,38,0,54,64,30,6,91,
+96,8,112,8,2,8,37,90,1,14,40,27,90,0,24,1,24,13,1,1,38,6,25,3,32,95,19,19,
+0,63,225,63,206,51,51,47,51,1,47,93,225,16,222,50,225,220,93,225,49,48,1,
+21,62,3,53,51,23,14,3,7,17,20,14,2,35,34,46,2,53,17,51,17,20,30,2,51,50,62,
+2,53,17,3,182,47,55,29,9,198,15,15,48,82,121,87,45,99,159,115,108,154,99,
+46,186,24,54,89,65,67,86,49,19,5,182,194,8,52,77,97,54,22,69,127,105,75,17,
+253,102,114,183,129,69,65,126,186,122,3,215,252,51,87,130,86,43,48,90,129,
+82,3,202,0,0,1,0,160,255,236,5,23,4,242,0,39,0,87,183,31,74,0,33,16,33,2,
+33,184,255,192,179,20,23,72,33,184,255,192,64,35,14,17,72,33,1,0,23,71,26,
+38,41,14,71,0,13,176,13,2,13,38,26,26,13,31,31,24,13,15,2,18,80,7,22,0,21,
+0,63,63,225,50,63,51,51,47,17,51,47,51,1,47,93,225,16,222,50,225,50,50,221,
+43,43,93,225,48,49,33,39,35,14,3,35,34,46,2,53,17,51,17,20,22,51,50,62,2,
+53,17,51,21,62,3,53,51,23,14,3,7,17,3,18,26,8,22,60,72,80,41,79,119,79,40,
+182,84,90,66,90,56,24,182,52,62,32,10,198,15,15,50,85,127,92,147,43,63,41,
+20,46,98,152,105,2,205,253,61,130,130,52,101,148,96,2,58,123,6,50,78,101,
+56,23,70,136,110,72,7,252,176,255,255,1,162,4,217,3,43,6,33,2,6,0,67,0,0,
+255,255,1,162,4,217,3,43,6,33,2,6,0,118,0,0,255,255,0,254,4,217,3,205,5,227,
+2,6,1,82,0,0,0,1,1,172,4,184,3,33,6,143,0,27,0,46,64,23,7,5,8,8,21,13,132,
+0,0,21,5,8,8,6,18,141,15,25,31,25,2,25,6,0,47,220,93,225,18,57,47,51,1,47,
+51,47,225,17,57,47,51,51,48,49,1,20,14,2,7,7,35,39,62,3,53,52,46,2,35,34,
+6,7,53,54,54,51,50,22,3,33,27,45,60,34,10,113,14,37,59,42,23,20,36,50,29,
+28,52,16,16,50,41,133,133,5,211,39,58,41,26,8,111,176,6,16,24,33,24,24,32,
+19,7,3,3,108,3,5,91,0,0,1,1,252,254,152,2,209,255,125,0,13,0,15,181,6,135,
+0,11,145,3,0,47,237,1,47,237,48,49,5,52,54,51,50,22,21,20,14,2,35,34,38,1,
+252,61,45,44,63,17,29,39,22,45,61,246,60,55,55,60,29,43,28,14,55,255,255,
+0,217,0,0,4,35,7,115,2,38,0,40,0,0,1,7,0,67,255,183,1,82,0,21,180,1,12,5,
+38,1,184,255,160,180,15,12,1,0,37,1,43,53,0,43,53,0,255,255,0,137,0,0,4,70,
+7,115,2,38,1,178,0,0,1,7,0,67,255,181,1,82,0,21,180,1,17,5,38,1,184,255,180,
+180,20,17,0,8,37,1,43,53,0,43,53,0,255,255,0,133,255,236,4,72,6,33,2,38,0,
+72,0,0,1,6,0,67,212,0,0,21,180,2,23,17,38,2,184,255,212,180,26,23,11,0,37,
+1,43,53,0,43,53,0,255,255,0,160,0,0,4,45,6,33,2,38,1,210,0,0,1,6,0,67,179,
+0,0,21,180,1,12,17,38,1,184,255,179,180,15,12,10,4,37,1,43,53,0,43,53,0,0,
+1,0,82,255,236,4,123,5,201,0,60,0,117,64,31,12,15,13,191,13,2,13,64,12,17,
+72,13,13,19,29,0,251,58,58,39,7,251,19,62,46,0,45,176,45,2,45,184,255,192,
+64,34,12,17,72,45,45,51,251,47,39,1,39,59,59,56,42,12,46,46,10,48,95,16,42,
+4,0,58,58,29,2,56,95,24,34,19,0,63,51,225,50,50,50,17,51,63,51,241,50,194,
+47,50,17,18,57,47,1,47,93,225,50,47,43,93,51,16,222,225,17,57,47,225,57,17,
+51,47,43,93,51,49,48,37,22,51,50,62,2,53,16,2,35,34,7,39,54,54,51,50,18,17,
+20,2,6,6,35,34,46,2,39,14,3,35,34,38,38,2,53,16,18,51,50,22,23,7,38,35,34,
+2,17,20,30,2,51,50,55,17,51,2,188,39,56,48,67,42,19,78,66,55,41,47,34,88,
+48,146,147,34,78,128,94,33,54,46,43,23,22,42,46,53,33,94,128,79,35,147,146,
+48,88,34,47,41,56,66,77,19,43,68,48,57,37,170,186,43,89,164,229,141,1,19,
+1,20,29,152,23,18,254,153,254,154,192,254,219,198,101,13,24,37,24,24,37,24,
+13,101,198,1,37,192,1,102,1,103,18,23,152,29,254,236,254,237,141,229,164,
+89,43,1,220,0,0,1,255,252,0,0,4,137,4,74,0,42,0,122,64,46,7,13,1,13,38,14,
+33,21,253,34,1,187,34,1,34,34,27,15,73,95,14,1,14,14,1,27,73,12,28,1,28,44,
+42,6,0,0,1,166,0,182,0,2,148,0,1,0,184,255,192,64,23,11,15,72,0,0,2,73,1,
+38,13,13,0,27,14,1,15,21,34,34,7,79,0,21,0,63,225,51,17,51,63,51,51,18,57,
+17,51,1,47,225,51,47,43,93,93,113,51,51,16,222,93,225,17,57,47,93,225,17,
+51,47,93,93,51,51,18,57,57,93,49,48,33,1,51,19,22,22,23,51,62,3,55,19,3,51,
+19,30,3,23,51,62,2,18,53,51,20,2,2,6,7,35,3,38,38,39,6,6,7,3,1,27,254,225,
+160,163,20,34,8,4,5,15,18,20,10,86,109,150,137,8,22,23,22,7,6,63,79,45,16,
+153,26,66,113,88,163,84,7,11,3,5,16,8,106,4,74,253,92,85,157,51,18,56,65,
+67,30,1,16,1,205,253,176,33,96,103,96,33,104,210,230,1,2,151,163,254,224,
+254,245,253,127,1,84,26,56,20,20,62,22,254,174,0,0,2,0,20,0,0,4,117,6,20,
+0,22,0,33,0,65,64,33,19,0,23,90,16,12,12,14,27,91,21,6,35,14,33,95,0,22,14,
+95,15,19,15,0,15,0,15,17,0,23,96,12,18,0,63,225,63,57,57,47,47,17,51,16,225,
+50,16,225,1,47,16,222,204,225,17,57,47,51,225,50,50,48,49,1,51,50,30,2,21,
+20,14,2,35,33,17,33,53,33,17,51,17,33,21,33,17,51,50,54,53,52,46,2,35,35,
+1,250,94,152,207,127,55,60,126,194,134,254,204,254,213,1,43,187,1,137,254,
+119,104,175,163,46,91,138,93,74,3,78,66,113,152,87,97,158,112,61,4,96,164,
+1,16,254,240,164,252,64,132,136,70,97,60,27,0,2,0,20,0,0,4,88,5,39,0,20,0,
+33,0,67,64,34,0,0,28,19,2,22,71,16,12,12,14,28,70,6,35,14,1,13,80,16,21,80,
+2,2,19,16,17,17,16,15,22,80,12,21,0,63,225,63,51,47,17,51,57,47,225,16,225,
+50,1,47,16,222,225,17,57,47,51,225,50,50,17,57,47,48,49,1,33,17,33,50,22,
+21,20,14,2,35,33,17,35,53,51,53,51,21,33,1,17,51,50,62,2,53,52,46,2,35,2,
+227,254,213,1,0,212,204,47,101,159,113,254,78,238,238,182,1,43,254,213,240,
+55,93,68,38,33,65,96,64,3,176,254,215,156,155,77,124,88,47,3,176,154,221,
+221,253,164,254,168,17,41,66,48,49,66,40,17,0,0,1,0,98,255,236,4,182,5,203,
+0,45,0,86,64,48,5,8,34,27,64,9,12,72,15,7,1,27,7,17,17,7,27,3,30,42,47,33,
+29,251,30,8,28,95,5,33,33,13,43,0,95,42,39,4,31,3,30,18,16,13,95,17,22,19,
+0,63,51,225,50,63,63,63,51,225,50,18,57,47,51,225,50,1,47,225,50,16,206,17,
+23,57,47,47,47,93,43,51,201,50,48,49,1,34,14,2,7,33,21,33,30,3,51,50,54,55,
+21,14,3,35,34,38,38,2,39,35,17,35,17,51,17,51,62,3,51,50,22,23,7,38,38,3,
+145,68,114,85,55,9,1,211,254,41,3,45,85,125,82,66,116,57,30,59,64,73,44,120,
+178,120,62,4,139,166,166,144,11,76,128,178,112,84,149,60,73,45,106,5,39,64,
+122,176,111,162,130,201,138,72,35,23,162,15,23,14,7,100,184,1,3,159,253,86,
+5,182,253,152,143,235,167,92,44,42,156,32,46,0,0,1,0,160,255,236,4,123,4,
+94,0,45,0,85,64,47,31,34,73,12,15,5,31,5,2,5,33,5,33,8,43,22,47,11,7,73,0,
+8,1,8,23,28,81,17,34,6,80,31,11,11,22,17,16,9,15,8,21,42,39,81,43,0,22,0,
+63,50,225,50,63,63,63,51,57,47,51,237,50,16,225,50,1,47,93,225,50,16,206,
+50,17,57,57,47,47,93,51,225,50,48,49,5,34,46,2,39,35,17,35,17,51,17,51,62,
+3,51,50,30,2,23,7,46,3,35,34,6,7,33,21,33,30,3,51,50,54,55,21,6,6,3,127,85,
+149,114,70,6,149,162,162,151,11,75,114,147,83,34,68,64,57,21,47,21,50,52,
+51,23,123,129,12,1,162,254,92,4,36,64,93,61,72,115,48,47,110,20,58,123,193,
+135,254,23,4,74,254,57,128,181,114,52,9,16,22,12,154,10,19,15,9,151,166,154,
+92,132,84,40,37,25,162,29,30,0,0,2,0,0,0,0,4,205,5,182,0,11,0,20,0,169,64,
+32,16,15,14,13,8,7,17,7,14,15,16,3,17,7,8,7,24,7,2,7,6,7,5,1,199,5,215,5,
+231,5,3,5,184,255,248,64,64,10,16,72,5,17,18,19,20,1,2,17,2,20,19,18,3,2,
+8,4,1,200,4,216,4,232,4,3,4,8,10,16,72,4,17,17,21,6,10,251,21,11,1,11,11,
+3,6,2,3,9,8,1,96,13,12,12,2,17,95,4,3,11,7,2,18,0,63,51,51,63,225,18,57,47,
+51,225,50,50,1,47,51,47,18,57,47,93,225,17,18,57,17,51,43,93,113,18,0,23,
+57,16,125,135,5,196,196,196,196,17,1,51,43,93,113,17,51,93,17,18,0,23,57,
+16,135,5,196,196,196,196,196,49,48,1,35,3,35,1,51,1,35,3,35,17,35,3,33,39,
+38,38,39,6,6,7,2,16,112,238,178,2,8,187,2,10,182,238,115,166,55,1,29,39,37,
+51,19,18,60,28,2,170,253,86,5,182,250,74,2,170,253,86,3,68,110,105,170,75,
+75,183,92,0,0,2,0,61,0,0,4,141,4,74,0,11,0,23,0,210,64,108,18,19,20,21,22,
+8,9,17,21,20,19,18,4,17,71,9,1,9,71,10,5,73,6,168,11,184,11,2,138,11,154,
+11,2,11,8,12,16,72,11,23,12,13,14,15,17,2,17,15,14,13,12,4,2,198,0,1,179,
+0,1,165,0,1,134,0,150,0,2,117,0,1,70,0,86,0,102,0,3,55,0,1,0,17,17,134,6,
+150,6,2,21,6,37,6,2,6,6,1,10,72,2,1,2,1,4,3,8,80,23,22,184,255,192,64,20,
+9,12,72,22,22,1,11,16,17,82,11,15,9,21,2,21,10,6,1,21,0,63,51,51,63,63,63,
+241,196,17,18,57,47,43,51,225,50,50,1,47,193,93,47,18,57,47,93,93,57,17,51,
+93,93,93,93,93,93,93,18,0,23,57,16,125,135,5,196,196,196,196,196,1,51,43,
+93,93,16,225,16,241,93,17,0,23,57,135,5,196,196,196,196,196,196,49,48,1,1,
+35,3,35,17,35,17,35,3,35,1,18,46,2,39,35,14,3,7,51,2,217,1,180,188,184,99,
+162,104,184,183,1,181,225,35,35,29,8,12,8,30,34,34,13,252,4,74,251,182,1,
+233,254,23,1,233,254,23,4,74,254,92,90,93,86,30,29,87,93,91,34,0,0,2,0,98,
+0,0,4,252,5,182,0,19,0,28,1,4,64,138,198,13,1,183,13,1,166,13,1,119,13,1,
+13,25,136,21,1,89,21,105,21,2,24,23,22,21,16,15,25,15,22,23,24,3,25,15,86,
+20,102,20,134,20,3,26,27,28,20,1,2,25,2,28,27,26,3,2,216,12,1,201,12,1,120,
+12,168,12,184,12,3,12,25,25,14,3,6,18,1,18,251,19,1,204,19,1,181,19,1,166,
+19,1,90,19,106,19,138,19,3,5,19,1,19,19,7,15,0,14,1,14,23,2,1,2,50,3,1,41,
+3,1,24,3,1,3,3,10,6,251,7,17,16,1,96,20,21,20,80,20,1,20,184,255,192,64,20,
+9,12,72,20,4,5,96,11,10,10,2,25,12,8,3,19,15,7,2,18,0,63,51,51,51,63,51,192,
+18,57,47,51,225,50,51,43,93,17,51,16,237,50,50,1,47,225,50,50,47,93,93,93,
+193,93,47,93,193,18,57,47,93,93,93,93,93,93,193,93,17,18,57,17,51,93,93,93,
+18,0,23,57,16,125,135,5,196,196,196,196,196,1,93,17,18,0,23,57,16,135,5,196,
+196,196,196,196,1,93,93,17,51,93,93,93,93,48,49,1,35,3,35,19,33,17,35,17,
+51,17,33,19,51,1,35,3,35,17,35,3,51,39,38,38,39,6,6,7,2,215,47,168,168,176,
+255,0,166,166,1,39,162,174,1,125,168,172,45,164,8,182,18,22,40,12,12,38,20,
+2,170,253,86,2,170,253,86,5,182,253,148,2,108,250,74,2,170,253,86,3,74,84,
+97,153,75,75,153,91,0,0,2,0,123,0,0,5,10,4,74,0,19,0,31,0,200,64,122,17,13,
+73,14,102,5,1,84,5,1,5,73,4,6,20,6,52,6,68,6,4,244,6,1,203,6,1,188,6,1,165,
+6,1,106,6,1,89,6,1,69,6,1,51,6,1,27,6,1,6,6,1,0,14,16,14,2,14,18,11,10,19,
+10,19,8,24,30,9,3,25,30,2,0,100,30,1,30,30,2,9,192,10,1,15,10,1,0,10,1,10,
+2,0,1,80,1,2,1,30,4,3,8,80,24,25,24,24,11,12,80,18,17,17,1,19,15,15,9,2,14,
+10,6,1,21,0,63,51,51,51,47,47,63,51,18,57,47,51,225,50,51,17,51,16,225,50,
+50,47,1,47,93,193,47,93,113,113,193,17,57,25,47,93,51,135,192,192,135,192,
+192,1,51,16,125,135,196,196,1,24,47,93,18,57,47,93,93,93,93,93,93,93,93,93,
+113,225,93,93,16,225,50,49,48,1,1,35,3,35,17,35,17,35,3,35,19,35,17,35,17,
+51,17,33,19,22,14,2,7,51,46,3,39,35,3,158,1,108,168,155,58,161,58,158,165,
+163,245,162,162,1,39,151,92,21,26,27,12,183,12,28,26,21,4,2,4,74,251,182,
+1,233,254,23,1,233,254,23,1,233,254,23,4,74,254,57,1,199,144,86,96,94,35,
+35,94,96,86,25,0,0,2,0,0,0,0,4,205,5,182,0,35,0,38,0,83,64,44,36,11,26,251,
+6,74,27,90,27,2,22,27,1,27,27,40,0,37,10,10,18,40,38,7,7,35,39,0,25,29,97,
+36,11,6,6,0,38,95,8,3,27,18,0,18,0,63,50,50,63,225,18,57,47,51,51,225,50,
+1,47,17,51,51,47,51,17,51,51,47,51,17,18,57,47,93,93,51,225,50,57,48,49,49,
+19,62,3,55,1,53,33,21,1,30,3,23,19,35,3,46,3,35,35,17,35,17,35,34,14,2,7,
+3,1,1,33,113,21,49,76,114,86,254,178,3,213,254,178,89,113,74,47,21,113,170,
+113,18,34,49,70,54,23,168,22,54,70,49,34,18,113,1,192,1,37,253,181,1,197,
+85,136,98,58,6,1,231,139,139,254,25,6,56,98,137,86,254,59,1,193,72,95,57,
+23,253,72,2,184,23,57,95,72,254,63,3,96,1,178,0,0,2,0,10,0,0,4,195,4,74,0,
+35,0,38,0,117,64,68,36,102,11,1,11,26,73,6,183,27,1,165,27,1,148,27,1,139,
+27,1,122,27,1,89,27,1,75,27,1,27,27,39,17,38,0,7,1,7,7,35,39,37,15,10,1,10,
+10,17,10,7,7,8,25,28,82,36,11,6,6,0,38,80,8,15,27,18,0,21,0,63,50,50,63,225,
+18,57,47,51,51,225,50,17,51,17,51,1,47,51,47,93,51,17,51,51,47,93,51,17,18,
+57,47,93,93,93,93,93,93,93,51,225,50,93,57,48,49,51,19,62,3,55,1,53,33,21,
+1,30,3,23,19,35,3,46,3,35,35,17,35,17,35,34,14,2,7,3,1,19,33,10,119,21,42,
+66,100,80,254,215,3,181,254,210,80,100,66,44,22,119,181,118,20,36,47,66,51,
+4,164,4,51,66,48,36,20,119,1,168,246,254,25,1,84,61,101,77,49,9,1,100,105,
+105,254,156,8,49,76,102,62,254,172,1,80,54,72,43,17,253,246,2,10,17,43,72,
+54,254,176,2,131,1,45,0,0,2,0,92,0,0,4,233,5,182,0,40,0,43,0,115,64,64,41,
+16,31,251,11,5,32,1,32,32,0,23,251,22,42,91,15,15,0,22,1,22,43,90,12,12,40,
+251,4,47,0,1,0,0,6,251,32,7,48,7,2,7,15,12,12,13,13,8,34,30,5,96,41,10,10,
+0,43,8,3,32,23,7,0,18,0,63,50,50,50,63,192,18,57,47,196,237,50,50,17,51,17,
+51,17,51,1,47,93,225,50,47,93,51,225,51,47,225,47,93,51,47,225,16,225,17,
+57,47,93,51,225,50,57,49,48,33,19,54,54,55,35,17,35,17,51,17,33,3,53,33,21,
+1,30,3,23,19,35,3,46,3,35,35,17,35,17,35,34,14,2,7,3,1,19,33,1,96,56,9,19,
+23,201,166,166,1,127,246,3,58,254,254,65,83,52,29,10,55,170,55,9,16,28,46,
+38,8,164,8,39,45,28,16,9,56,1,27,223,254,66,1,197,81,108,40,253,86,5,182,
+253,148,1,225,139,139,254,25,6,56,97,137,87,254,59,1,193,73,95,56,23,253,
+72,2,184,23,56,95,73,254,63,3,90,1,184,0,0,2,0,123,0,0,5,10,4,74,0,40,0,43,
+0,149,64,91,41,16,31,73,26,11,1,9,11,1,11,5,32,1,245,32,1,196,32,1,182,32,
+1,117,32,1,104,32,1,6,32,1,32,32,22,0,42,72,15,15,23,73,0,22,1,22,43,72,96,
+12,1,12,12,40,73,42,4,1,4,175,0,1,0,0,10,6,73,0,7,16,7,2,7,30,34,34,5,80,
+41,10,10,0,43,13,8,15,32,23,7,0,21,0,63,50,50,50,63,51,192,18,57,47,51,241,
+192,47,50,1,47,93,225,50,50,47,93,51,93,225,51,47,93,225,47,93,225,51,47,
+225,17,18,57,47,93,93,93,93,93,93,113,51,93,93,225,50,57,49,48,33,19,54,54,
+55,35,17,35,17,51,17,33,3,53,33,21,3,30,3,23,19,35,3,46,3,35,35,17,35,17,
+35,34,14,2,7,3,1,19,33,1,115,73,11,26,17,213,162,162,1,129,230,3,11,238,61,
+78,51,32,14,73,164,73,12,19,28,41,33,9,161,9,33,41,27,20,12,76,1,41,193,254,
+125,1,84,50,67,32,254,23,4,74,254,57,1,94,105,105,254,158,8,49,77,103,62,
+254,172,1,80,53,71,44,18,253,246,2,10,18,44,71,53,254,176,2,131,1,45,0,1,
+0,117,254,70,4,39,6,213,0,118,0,131,64,68,98,71,81,81,77,89,89,108,57,91,
+103,103,44,91,114,18,18,114,120,78,0,77,1,77,77,67,68,68,34,50,50,5,90,34,
+90,93,64,86,86,78,128,67,62,97,98,108,50,97,51,51,81,71,68,98,4,39,96,0,18,
+15,10,95,24,19,29,29,0,19,0,63,50,47,51,51,225,50,50,16,225,63,51,51,51,57,
+47,225,57,16,225,50,26,204,50,47,26,205,50,1,47,225,51,47,17,51,47,51,51,
+47,93,51,16,206,50,47,16,225,51,47,225,50,51,47,18,57,17,51,51,48,49,5,34,
+14,2,21,20,30,2,51,50,62,2,51,50,22,23,21,46,3,35,34,14,2,35,34,46,2,53,52,
+62,2,51,50,62,2,53,52,46,2,35,35,53,51,50,62,2,53,52,46,2,35,34,14,2,7,39,
+54,54,55,46,3,39,53,51,22,22,23,62,3,51,50,22,23,21,38,38,35,34,14,2,7,30,
+3,21,20,14,2,7,21,30,3,21,20,14,2,2,29,71,91,52,20,14,36,61,47,65,97,84,81,
+50,86,94,25,8,32,53,78,53,49,71,74,92,70,104,135,80,31,49,102,157,107,89,
+128,81,38,56,104,144,89,190,176,92,142,97,50,38,68,95,57,55,97,86,79,38,92,
+59,167,102,24,55,54,50,20,121,51,98,54,26,58,67,75,42,31,47,14,11,33,17,22,
+49,48,46,20,83,125,85,43,51,91,125,75,88,137,95,49,66,132,195,20,18,32,41,
+24,22,36,26,14,4,4,4,24,15,182,7,18,16,12,3,3,2,41,72,96,55,60,98,70,38,38,
+72,106,67,71,101,63,29,151,39,72,101,61,54,83,58,30,18,31,45,27,125,48,75,
+17,30,66,63,57,23,27,34,97,56,36,70,56,35,9,5,119,5,7,23,41,56,33,13,63,92,
+118,69,73,120,88,57,12,6,11,57,89,119,72,96,160,116,64,0,1,0,143,254,115,
+4,8,5,82,0,110,0,166,64,96,20,75,70,26,136,96,1,105,96,121,96,2,58,96,1,41,
+96,1,96,197,10,1,103,10,119,10,2,69,10,85,10,2,39,10,1,10,106,106,93,86,70,
+15,4,4,15,15,49,49,26,112,64,103,102,102,92,93,93,65,79,79,36,73,65,7,82,
+0,0,103,128,92,89,78,96,21,79,80,80,80,106,93,10,96,16,70,78,31,49,46,41,
+80,55,50,60,60,31,22,0,63,51,47,51,51,225,50,50,16,225,63,51,51,51,57,47,
+225,57,16,225,50,26,205,50,47,225,1,47,225,51,47,17,51,47,51,51,47,51,26,
+16,206,50,47,50,47,51,47,16,225,18,57,17,51,93,93,93,93,51,93,93,93,93,16,
+225,50,48,49,1,50,22,23,21,38,38,35,34,6,7,30,3,21,20,14,2,7,21,30,3,21,20,
+14,2,35,34,14,2,21,20,30,2,51,50,62,2,51,50,22,23,21,46,3,35,34,14,2,35,34,
+46,2,53,52,62,2,51,50,62,2,53,52,38,35,35,53,51,50,62,2,53,52,38,35,34,6,
+7,39,54,54,55,46,3,39,53,51,22,22,23,62,3,3,125,22,31,17,14,22,14,46,92,42,
+59,98,69,38,28,50,71,43,47,83,61,36,55,121,191,135,74,89,47,15,15,37,64,48,
+54,109,102,90,36,72,78,14,10,36,43,46,21,34,92,108,119,60,95,122,69,26,35,
+85,145,110,81,125,85,45,154,159,148,121,59,111,86,53,129,121,79,147,83,63,
+62,118,70,21,47,48,45,20,121,54,101,56,28,61,71,83,5,82,4,6,117,3,3,75,62,
+12,46,68,92,59,50,78,59,41,13,11,13,43,66,92,62,67,117,86,49,14,26,38,23,
+22,35,24,13,3,4,3,22,19,151,10,15,10,6,3,3,3,43,69,87,45,51,90,67,40,19,43,
+69,51,94,91,153,11,35,66,54,77,77,38,34,147,28,34,8,28,57,56,51,21,27,35,
+96,56,34,70,57,36,255,255,0,57,0,0,4,150,5,182,2,6,1,117,0,0,255,255,0,80,
+254,20,4,131,6,18,2,6,1,149,0,0,0,3,0,84,255,236,4,123,5,205,0,19,0,30,0,
+41,0,43,64,22,25,37,91,0,43,36,26,91,10,26,96,36,36,20,31,95,15,4,20,95,5,
+19,0,63,225,63,225,18,57,47,225,1,47,225,50,16,222,225,50,48,49,1,20,2,6,
+6,35,34,38,38,2,53,52,18,54,54,51,50,22,22,18,1,50,62,2,55,33,30,3,19,34,
+14,2,7,33,46,3,4,123,64,132,200,135,142,201,129,60,60,129,203,142,135,199,
+131,64,253,237,87,123,79,39,4,253,103,4,40,80,123,88,85,122,81,42,5,2,153,
+5,42,79,120,2,221,169,254,234,198,108,108,198,1,23,170,170,1,21,196,107,107,
+197,254,235,253,7,71,134,194,122,122,194,134,71,4,154,67,128,184,117,117,
+184,128,67,0,0,3,0,115,255,236,4,88,4,94,0,19,0,25,0,30,0,43,64,22,29,22,
+72,0,32,28,23,72,10,23,80,28,28,20,26,80,15,16,20,80,5,22,0,63,225,63,225,
+18,57,47,225,1,47,225,50,16,222,225,50,48,49,1,20,14,2,35,34,46,2,53,52,62,
+2,51,50,30,2,1,32,19,33,22,22,19,32,3,33,2,4,88,74,133,184,111,103,180,134,
+78,73,132,185,111,103,181,134,78,254,14,1,26,26,253,151,11,156,140,254,239,
+32,2,101,35,2,39,137,213,145,76,76,145,213,137,136,211,145,75,75,145,211,
+253,212,1,100,179,177,3,68,254,186,1,70,0,0,1,0,63,0,0,5,33,5,195,0,28,0,
+79,64,47,26,26,5,25,6,55,6,1,38,6,1,6,24,7,56,7,2,7,13,17,13,8,0,25,48,25,
+80,25,96,25,4,25,9,8,26,0,97,25,22,4,8,3,13,7,18,6,18,0,63,63,51,63,63,51,
+225,50,1,47,51,47,93,18,57,57,17,51,93,51,93,93,17,18,57,50,47,48,49,1,34,
+14,2,7,1,35,1,51,1,22,22,23,54,54,55,19,62,3,51,50,22,23,21,38,38,4,180,35,
+53,42,36,18,254,215,209,254,61,197,1,10,26,45,17,14,42,26,142,32,60,76,103,
+75,35,68,26,23,54,5,45,37,72,103,66,251,233,5,182,252,109,93,185,79,78,188,
+97,2,0,113,156,98,43,13,8,151,9,13,0,1,0,82,0,0,4,174,4,82,0,35,0,80,64,51,
+33,24,34,102,34,118,34,2,23,34,55,34,71,34,87,34,4,34,24,35,40,35,56,35,3,
+35,9,16,9,0,47,24,1,24,1,64,0,80,0,2,0,34,9,35,21,28,79,21,15,0,15,0,63,63,
+225,63,51,51,1,47,93,51,47,93,18,57,57,17,51,93,51,93,93,17,18,57,48,49,19,
+51,19,30,5,23,51,62,3,55,19,62,3,51,50,22,23,21,38,38,35,34,14,2,7,1,35,82,
+188,224,8,21,24,24,20,16,3,6,7,25,30,31,12,102,30,53,65,83,60,26,44,14,11,
+32,18,26,40,32,29,15,254,246,231,4,74,253,162,22,63,70,74,67,57,18,30,93,
+103,101,37,1,64,93,117,67,24,7,3,135,3,5,19,40,65,46,252,225,255,255,0,63,
+0,0,5,33,7,115,2,38,2,128,0,0,1,7,3,118,255,224,1,82,0,25,182,2,1,29,5,38,
+2,1,184,255,109,180,49,29,8,25,37,1,43,53,53,0,43,53,53,0,255,255,0,82,0,
+0,4,174,6,33,2,38,2,129,0,0,1,6,3,118,212,0,0,25,182,2,1,36,17,38,2,1,184,
+255,145,180,56,36,0,24,37,1,43,53,53,0,43,53,53,0,0,3,0,70,254,20,4,215,5,
+205,0,19,0,39,0,72,0,111,64,68,136,72,152,72,2,72,16,11,16,72,72,47,40,55,
+65,65,39,41,1,6,41,1,41,250,6,40,1,40,40,30,250,15,0,1,0,0,10,40,54,1,9,54,
+1,54,250,240,55,1,55,20,250,10,72,47,73,68,61,28,54,40,15,35,95,15,4,25,5,
+19,0,63,193,63,225,63,51,63,205,17,51,51,1,47,225,47,93,225,93,93,18,57,47,
+93,225,51,47,93,225,93,93,51,47,17,18,57,57,43,93,49,48,1,20,2,6,6,35,34,
+38,38,2,53,52,18,54,54,51,50,22,22,18,5,20,30,2,51,50,62,2,53,52,46,2,35,
+34,14,2,37,51,19,30,3,23,51,62,3,55,19,51,3,14,3,35,34,38,39,53,22,22,51,
+50,54,55,55,2,106,16,56,109,93,93,109,56,16,16,57,109,94,93,108,56,15,254,
+121,10,26,46,35,36,46,25,10,9,26,45,35,36,46,27,10,1,176,156,100,4,9,9,8,
+3,4,2,5,7,7,4,106,156,242,15,41,62,88,62,37,48,21,20,47,25,49,63,19,24,2,
+221,182,254,231,191,99,98,192,1,26,183,177,1,23,193,101,101,193,254,232,178,
+137,219,153,81,81,153,219,137,138,218,151,81,81,151,218,227,253,159,23,56,
+61,63,30,25,62,64,60,22,2,97,251,14,78,120,83,43,11,6,145,5,7,87,99,136,0,
+0,3,0,80,254,20,4,205,4,94,0,19,0,29,0,62,0,151,64,100,88,62,104,62,2,57,
+62,73,62,2,40,62,1,37,62,45,21,31,1,31,73,30,0,30,1,30,0,0,54,1,54,54,137,
+25,1,88,25,104,25,120,25,3,25,73,89,0,1,15,0,1,0,0,10,88,44,1,73,44,1,56,
+44,1,25,44,1,8,44,1,44,73,45,133,20,1,102,20,118,20,2,20,73,10,37,62,30,58,
+80,51,27,44,30,15,28,80,15,16,23,80,5,22,0,63,225,63,225,63,51,63,225,17,
+57,57,1,47,225,93,93,47,225,93,93,93,93,93,18,57,47,93,93,225,93,93,51,47,
+93,17,51,93,16,225,93,18,57,57,93,93,93,48,49,1,20,14,2,35,34,46,2,53,52,
+62,2,51,50,30,2,5,20,22,51,50,17,52,38,35,34,37,51,19,30,3,23,51,62,3,55,
+19,51,3,14,3,35,34,38,39,53,22,22,51,50,54,55,55,2,115,38,71,102,64,61,100,
+72,39,40,73,101,60,57,100,73,43,254,123,59,57,117,60,57,116,1,155,156,100,
+4,9,9,8,3,4,2,5,6,8,4,106,156,242,15,41,62,88,62,37,48,22,20,48,25,49,63,
+19,24,2,39,168,221,130,52,52,130,221,168,168,219,129,51,51,129,219,168,211,
+209,1,164,210,206,131,253,159,23,56,61,63,30,25,62,64,60,22,2,97,251,14,78,
+120,83,43,11,6,145,5,7,87,99,136,0,2,0,84,255,139,4,123,6,41,0,31,0,63,0,
+94,64,53,37,11,11,59,21,43,5,5,53,27,21,27,16,48,91,0,65,32,91,31,16,47,16,
+2,16,59,79,56,95,56,2,56,56,53,95,24,21,27,3,43,64,40,80,40,2,40,40,37,95,
+8,5,11,18,0,63,51,205,225,50,47,93,50,63,51,205,225,50,47,93,50,1,47,93,225,
+16,222,225,18,57,57,17,51,51,17,51,17,51,51,17,51,48,49,1,20,14,2,7,6,6,35,
+34,38,39,46,3,53,52,62,2,55,54,54,51,50,22,23,30,3,5,20,30,2,23,54,54,51,
+50,22,23,62,3,53,52,46,2,39,6,6,35,34,38,39,14,3,4,123,48,97,147,99,14,74,
+54,58,71,14,103,146,94,44,44,94,146,103,14,71,58,54,74,14,99,147,97,48,252,
+158,22,47,75,54,17,67,51,48,69,17,55,77,48,22,22,48,77,55,16,70,48,52,68,
+17,53,74,47,22,2,221,146,247,190,126,26,62,53,53,62,26,126,190,248,147,146,
+246,189,125,25,62,49,50,59,26,126,189,247,147,108,182,142,101,28,45,37,39,
+45,26,100,143,184,110,110,183,143,99,26,48,40,38,46,27,101,141,180,0,0,2,
+0,115,255,152,4,88,4,174,0,33,0,54,0,88,64,47,36,11,11,53,21,42,5,5,47,29,
+21,29,16,44,72,0,56,34,72,0,16,1,16,53,95,50,1,50,50,47,81,24,21,29,15,80,
+39,1,39,39,36,42,81,11,8,5,21,0,63,205,51,225,50,50,47,93,63,51,205,225,50,
+47,93,50,1,47,93,225,16,222,225,18,57,57,17,51,51,17,51,17,51,51,17,51,48,
+49,1,20,14,2,7,6,6,35,34,38,39,46,3,53,52,62,2,55,54,54,51,50,30,2,23,30,
+3,5,16,23,54,54,51,50,22,23,54,17,52,38,39,6,6,35,34,38,39,6,4,88,54,98,139,
+86,9,60,54,58,59,8,81,136,99,56,53,97,138,84,10,58,57,27,42,30,20,4,81,139,
+100,57,252,215,191,11,56,51,48,57,12,195,99,96,12,57,48,51,55,12,191,2,39,
+117,188,141,92,19,54,44,44,54,20,92,141,188,116,115,187,141,91,19,54,40,9,
+21,36,28,19,91,141,187,115,254,184,71,38,29,31,38,71,1,74,165,197,35,42,29,
+31,40,71,0,0,3,0,82,255,236,4,123,8,61,0,21,0,39,0,102,0,180,64,107,53,15,
+54,63,54,79,54,95,54,127,54,143,54,6,54,54,48,251,60,40,70,29,22,34,25,11,
+12,70,34,1,34,12,12,34,1,3,80,60,104,87,0,86,48,86,64,86,80,86,112,86,128,
+86,6,86,86,92,251,80,53,87,87,51,89,95,83,54,86,86,83,29,37,26,26,79,25,95,
+25,111,25,3,25,83,37,37,2,7,16,16,11,0,79,2,1,2,2,57,83,4,102,102,43,97,95,
+70,65,75,19,0,63,51,51,225,50,50,47,63,51,51,47,93,51,51,51,47,51,17,51,47,
+16,198,93,50,47,18,57,17,51,17,51,16,225,50,50,17,51,1,47,225,50,47,93,51,
+16,206,17,23,57,47,47,47,18,57,17,51,50,16,221,205,17,51,16,225,50,47,93,
+51,49,48,1,21,35,34,46,2,35,34,6,21,21,35,53,52,54,51,50,30,2,51,7,20,6,7,
+53,54,54,53,52,46,2,53,52,54,51,50,22,3,22,22,51,50,62,2,53,16,2,35,34,7,
+39,54,54,51,50,18,17,20,2,6,6,35,34,46,2,39,14,3,35,34,38,38,2,53,16,18,51,
+50,22,23,7,38,35,34,2,17,20,30,2,51,50,62,2,55,3,221,14,80,135,114,94,38,
+43,55,133,118,103,54,106,112,125,74,232,119,122,60,56,31,36,31,50,46,59,68,
+125,36,90,51,48,67,42,19,78,66,55,41,47,34,88,48,146,147,34,78,128,94,33,
+54,46,43,23,22,42,46,53,33,94,128,79,35,147,146,48,88,34,47,41,56,66,77,19,
+43,68,48,27,45,41,40,21,7,203,129,36,42,36,45,53,16,35,107,101,36,42,36,226,
+77,115,31,76,22,45,25,19,18,16,26,28,37,38,70,249,232,57,66,89,164,229,141,
+1,19,1,20,29,152,23,18,254,153,254,154,192,254,219,198,101,9,20,33,24,24,
+33,20,9,101,198,1,37,192,1,102,1,103,18,23,152,29,254,236,254,237,141,229,
+164,89,17,32,46,28,0,3,0,88,255,236,4,115,7,8,0,59,0,81,0,98,0,156,64,41,
+15,47,191,47,255,47,3,47,64,11,17,72,47,47,41,73,33,3,11,55,100,70,73,88,
+82,93,93,85,85,61,61,72,11,0,19,176,19,240,19,3,19,184,255,192,64,45,11,17,
+72,19,19,25,73,11,88,96,86,85,96,96,72,67,76,60,61,61,15,72,1,72,72,85,46,
+44,44,20,22,81,50,47,19,16,16,38,33,28,81,3,0,6,22,0,63,51,51,225,50,50,63,
+51,51,51,225,50,50,17,51,206,50,47,93,51,47,51,205,50,17,51,47,16,205,17,
+57,1,47,225,50,47,43,93,16,196,50,47,50,47,51,47,221,201,47,51,16,222,17,
+57,57,225,50,47,43,93,49,48,5,34,38,39,6,6,35,34,46,2,53,52,62,2,51,50,22,
+23,7,38,35,34,6,21,20,22,51,50,62,2,55,30,3,51,50,54,53,52,38,35,34,7,39,
+54,54,51,50,30,2,21,20,14,2,19,21,35,34,46,2,35,34,6,21,21,35,53,52,54,51,
+50,30,2,51,7,20,6,7,53,54,53,52,46,2,53,52,54,51,50,22,3,29,62,91,32,32,88,
+60,76,127,91,50,40,76,109,68,46,95,35,51,49,62,73,68,102,95,26,46,40,34,15,
+16,35,40,47,28,94,101,68,74,58,50,51,35,94,45,70,109,75,39,51,90,126,105,
+8,80,129,110,96,46,43,55,134,118,104,62,108,108,119,74,232,120,121,116,31,
+36,31,50,46,59,68,20,35,32,32,35,60,133,215,155,157,219,137,62,20,25,145,
+30,201,212,211,195,14,24,30,16,16,30,24,14,195,211,212,201,30,145,25,20,62,
+137,219,157,150,213,137,63,6,170,130,36,43,36,46,52,17,23,108,113,36,42,36,
+226,77,115,31,76,41,51,19,18,16,26,27,38,38,70,0,0,2,0,82,255,236,4,123,7,
+4,0,13,0,74,0,173,64,100,27,27,14,251,72,0,59,32,59,2,59,59,5,72,1,197,72,
+213,72,2,6,72,150,72,166,72,3,72,72,53,21,251,4,2,3,5,6,6,8,7,9,10,10,11,
+11,7,3,3,12,15,1,31,1,2,1,33,76,0,12,16,12,2,12,65,251,53,73,73,56,70,26,
+60,60,24,62,95,56,27,59,59,56,13,5,9,7,3,11,30,56,4,14,72,72,16,70,95,43,
+38,48,19,0,63,51,51,225,50,50,17,51,63,51,222,50,50,221,50,205,17,51,17,51,
+16,225,50,50,17,51,17,18,57,47,1,47,225,196,93,16,222,196,93,17,23,57,17,
+51,17,51,17,51,51,17,51,17,51,51,225,17,57,47,93,93,113,51,47,93,16,225,50,
+47,49,48,1,21,7,35,39,35,7,35,39,35,7,35,39,53,1,22,51,50,62,2,53,16,2,35,
+34,7,39,54,54,51,50,18,17,20,2,6,6,35,34,46,2,39,14,3,35,34,38,38,2,53,16,
+18,51,50,22,23,7,38,35,34,2,17,20,30,2,51,50,55,17,51,3,221,82,35,49,143,
+49,35,49,144,49,35,79,1,204,39,56,48,67,42,19,78,66,55,41,47,34,88,48,146,
+147,34,78,128,94,33,54,46,43,23,22,42,46,53,33,94,128,79,35,147,146,48,88,
+34,47,41,56,66,77,19,43,68,48,57,37,170,7,4,27,172,103,103,103,103,172,27,
+249,182,43,89,164,229,141,1,19,1,20,29,152,23,18,254,153,254,154,192,254,
+219,198,101,13,24,37,24,24,37,24,13,101,198,1,37,192,1,102,1,103,18,23,152,
+29,254,236,254,237,141,229,164,89,43,1,220,0,0,2,255,252,0,0,4,137,5,164,
+0,13,0,56,0,204,64,25,22,47,1,47,35,48,29,73,6,56,22,56,2,22,56,38,56,70,
+56,86,56,214,56,5,56,184,255,240,64,102,17,20,72,56,20,14,8,48,1,152,48,184,
+48,216,48,232,48,4,25,48,41,48,73,48,89,48,105,48,5,27,52,48,3,41,14,15,40,
+28,56,28,2,10,28,1,28,28,15,41,73,4,2,3,5,6,6,8,7,9,10,10,11,11,7,3,3,12,
+15,1,1,1,42,58,0,12,80,12,2,12,16,73,15,35,48,21,52,27,27,15,14,13,5,9,7,
+3,11,41,28,15,15,20,14,21,0,63,51,63,51,51,222,50,50,221,50,205,17,18,57,
+17,51,63,51,1,47,225,198,93,16,222,198,93,17,23,57,17,51,17,51,17,51,51,17,
+51,17,51,51,237,17,57,47,93,93,18,57,18,23,57,93,93,113,17,51,51,43,93,113,
+225,17,51,51,93,48,49,1,21,7,35,39,35,7,35,39,35,7,35,39,53,19,1,51,19,22,
+22,23,51,62,3,55,19,3,51,19,30,3,23,51,62,2,18,53,51,20,2,2,6,7,35,3,38,38,
+39,6,6,7,3,3,207,82,35,49,143,50,34,50,143,49,35,80,58,254,225,160,163,20,
+34,8,4,5,15,18,20,10,86,109,150,137,8,22,23,22,7,6,63,79,45,16,153,26,66,
+113,88,163,84,7,11,3,5,16,8,106,5,164,27,172,103,103,103,103,172,27,250,92,
+4,74,253,92,85,157,51,18,56,65,67,30,1,16,1,205,253,176,33,96,103,96,33,104,
+210,230,1,2,151,163,254,224,254,245,253,127,1,84,26,56,20,20,62,22,254,174,
+0,0,1,0,129,254,20,4,156,5,203,0,35,0,52,64,27,16,90,17,17,24,33,32,32,37,
+5,91,0,24,1,24,33,0,95,32,29,4,15,10,95,19,19,16,0,47,63,225,50,63,51,225,
+50,1,47,93,225,17,51,47,51,18,57,47,225,48,49,1,34,14,2,21,20,30,2,51,50,
+62,2,55,17,35,17,35,34,38,38,2,53,52,18,54,54,51,50,22,23,7,38,38,3,29,107,
+174,123,67,59,118,176,118,29,45,40,37,21,187,16,164,240,157,76,87,170,249,
+162,108,196,79,78,63,148,5,39,81,152,218,137,141,219,150,78,4,9,13,9,253,
+98,1,216,108,198,1,22,169,166,1,20,198,110,44,42,156,32,46,0,0,1,0,172,254,
+20,4,37,4,94,0,31,0,53,64,28,29,71,30,30,5,14,13,13,33,20,72,0,5,1,5,29,27,
+14,17,81,13,10,16,28,25,81,0,22,0,63,225,50,63,51,225,50,63,1,47,93,225,17,
+51,47,51,18,57,47,225,48,49,5,34,46,2,53,52,62,2,51,50,22,23,7,38,38,35,34,
+6,21,20,30,2,51,50,54,55,17,35,17,2,197,113,196,145,83,84,149,206,122,90,
+172,66,62,58,131,79,190,181,49,94,135,87,53,85,34,182,20,63,137,213,150,157,
+219,137,62,34,25,158,22,35,204,209,105,154,99,48,19,14,253,104,1,216,0,0,
+1,0,94,255,250,4,111,5,10,0,19,0,168,64,75,6,9,10,13,4,14,5,14,3,0,19,16,
+4,4,15,15,2,63,1,79,1,95,1,175,1,4,1,1,18,17,21,12,48,11,64,11,80,11,160,
+11,4,11,11,7,4,5,5,8,7,13,16,12,17,10,19,11,18,11,12,6,3,7,2,7,9,0,1,8,8,
+12,64,21,26,72,12,184,255,192,64,9,12,12,15,14,17,18,18,1,2,184,255,192,182,
+21,26,72,2,2,5,4,0,47,51,51,47,43,51,51,47,51,47,51,51,47,56,43,51,47,18,
+57,57,51,17,18,57,57,17,51,17,18,57,57,17,18,57,57,1,47,51,51,47,51,17,51,
+47,93,51,16,206,50,50,47,93,51,50,47,18,23,57,51,17,18,23,57,48,49,1,5,7,
+37,3,39,19,37,55,5,19,37,55,5,19,23,3,5,7,37,2,66,1,28,71,254,227,180,129,
+180,254,229,70,1,31,198,254,228,71,1,29,182,127,182,1,31,74,254,229,1,176,
+166,123,164,254,199,74,1,59,164,123,164,1,90,164,125,164,1,57,73,254,196,
+164,123,164,0,0,1,0,242,4,143,3,217,5,184,0,21,0,23,64,9,4,10,16,0,19,15,
+141,4,7,0,47,221,253,204,1,47,51,47,51,48,49,1,20,6,35,33,6,6,35,34,38,53,
+52,62,2,51,33,54,54,51,50,22,3,217,43,57,254,63,6,44,48,56,40,9,23,38,28,
+1,192,5,46,48,56,42,5,80,57,41,44,51,51,56,28,37,22,9,45,49,50,0,0,1,0,242,
+4,229,3,221,5,217,0,21,0,31,64,14,20,10,132,15,8,1,8,21,20,20,14,5,128,10,
+0,47,26,204,50,51,47,51,1,47,93,225,47,49,48,1,50,62,2,51,50,22,21,21,35,
+53,52,38,35,34,14,2,35,35,53,1,0,78,133,119,112,58,109,124,133,58,46,42,101,
+121,145,85,16,5,102,36,43,36,101,108,35,17,52,46,36,43,36,129,0,1,1,225,4,
+215,2,211,6,53,0,17,0,35,64,18,15,64,9,12,72,15,11,6,0,11,3,14,140,15,127,
+3,1,3,0,47,93,47,225,18,57,1,47,205,205,205,43,48,49,1,52,54,51,50,22,21,
+20,14,2,21,20,22,23,21,38,38,1,225,68,59,47,50,31,37,31,57,60,122,120,5,182,
+57,70,38,38,27,26,16,18,19,25,46,21,76,31,115,0,1,1,225,4,215,2,211,6,53,
+0,17,0,38,178,12,7,3,184,255,192,64,14,9,12,72,3,0,7,3,127,15,1,15,4,140,
+3,0,47,225,47,93,18,57,1,47,205,43,205,205,48,49,1,20,6,7,53,54,54,53,52,
+46,2,53,52,54,51,50,22,2,211,120,122,60,57,31,36,31,50,46,59,68,5,182,77,
+115,31,76,21,46,25,19,18,16,26,27,38,38,70,0,0,8,0,41,0,47,4,164,4,53,0,13,
+0,27,0,41,0,55,0,69,0,83,0,99,0,113,0,0,1,50,22,23,35,38,38,35,34,6,7,35,
+54,54,19,50,22,23,35,38,38,35,34,6,7,35,54,54,37,50,22,23,35,38,38,35,34,
+6,7,35,54,54,33,50,22,23,35,38,38,35,34,6,7,35,54,54,1,50,22,23,35,38,38,
+35,34,6,7,35,54,54,33,50,22,23,35,38,38,35,34,6,7,35,54,54,1,50,22,23,35,
+46,3,35,34,6,7,35,54,54,33,50,22,23,35,38,38,35,34,6,7,35,54,54,2,96,65,66,
+6,69,5,37,26,28,32,3,72,2,67,66,65,66,6,69,5,37,26,28,32,3,72,2,67,1,144,
+62,70,3,73,4,33,25,28,30,3,74,3,67,253,167,65,69,6,72,5,37,26,27,31,3,70,
+4,62,2,219,62,70,3,73,4,33,25,28,30,3,74,3,67,253,167,65,69,6,72,5,37,26,
+27,31,3,70,4,62,3,72,63,71,3,74,1,12,17,22,11,29,28,3,73,3,65,252,212,65,
+69,3,73,4,35,25,26,30,3,74,3,67,4,53,77,62,32,17,15,34,63,76,252,131,75,62,
+32,17,15,34,63,74,162,79,62,34,17,16,35,63,78,79,62,34,17,16,35,63,78,2,57,
+79,62,32,17,15,34,63,78,79,62,32,17,15,34,63,78,254,232,78,65,17,20,11,3,
+16,35,66,77,78,65,34,17,16,35,66,77,0,8,0,41,255,231,4,164,4,98,0,8,0,19,
+0,32,0,43,0,54,0,63,0,74,0,85,0,62,64,30,43,36,13,0,9,4,54,26,31,74,68,53,
+47,19,12,26,33,20,37,85,62,7,15,79,31,79,2,79,58,4,0,47,198,196,93,214,198,
+198,212,50,205,50,47,205,196,196,198,196,1,47,198,198,212,50,205,50,47,205,
+48,49,37,6,6,7,35,54,54,55,51,3,54,54,55,51,14,3,7,35,1,30,3,23,21,46,3,39,
+53,5,38,38,39,53,30,3,23,21,1,54,54,55,23,14,3,7,39,1,6,6,7,39,54,54,55,23,
+3,38,38,39,55,30,3,23,7,1,22,22,23,7,46,3,39,55,2,184,12,45,25,79,17,23,5,
+100,145,11,45,23,84,7,14,13,10,3,100,1,164,22,53,57,58,27,30,64,62,57,23,
+253,76,46,117,56,26,63,65,60,21,2,19,54,111,44,63,21,55,56,52,18,70,254,127,
+47,113,51,64,41,109,55,72,119,29,53,18,61,17,37,36,32,13,71,2,80,31,50,19,
+59,18,38,36,33,13,74,195,47,119,54,87,114,35,2,180,48,117,54,28,63,62,58,
+24,254,254,6,17,21,24,12,84,7,14,14,10,2,100,145,12,45,25,82,6,13,13,11,2,
+103,1,105,31,52,17,59,14,36,38,35,14,71,253,176,24,55,19,59,25,74,39,74,1,
+221,53,111,45,63,27,58,53,47,17,72,254,129,53,111,47,63,27,58,54,47,18,72,
+0,2,0,137,254,127,5,8,7,104,0,27,0,49,0,92,64,50,25,26,27,27,24,23,49,251,
+28,28,39,251,38,38,9,21,0,251,23,51,64,8,12,251,0,9,224,9,240,9,3,9,49,39,
+128,44,33,21,7,11,3,19,8,18,26,26,23,95,0,18,0,63,225,51,47,63,51,63,51,51,
+222,50,26,204,50,1,47,93,225,50,26,16,221,225,50,17,57,47,225,51,47,225,16,
+205,50,16,205,50,49,48,33,17,52,54,55,54,55,35,1,35,17,51,17,20,14,2,7,6,
+7,51,1,51,17,51,3,35,19,3,14,3,35,34,46,2,39,51,30,3,51,50,62,2,55,3,154,
+5,4,4,5,8,253,188,215,174,1,2,2,2,4,3,6,2,66,213,194,143,217,166,97,6,48,
+93,142,100,103,140,87,42,5,170,5,27,51,75,53,44,73,54,35,5,3,25,57,142,65,
+76,77,251,70,5,182,252,224,26,62,67,67,32,74,76,4,180,250,240,253,217,1,129,
+7,104,77,119,80,41,39,79,119,80,57,72,41,16,18,44,71,53,0,2,0,178,254,131,
+4,193,6,23,0,15,0,37,0,164,185,0,3,255,240,179,18,24,72,3,184,255,224,64,
+96,11,14,72,37,3,53,3,2,9,16,18,24,72,9,32,11,14,72,42,9,58,9,2,171,2,1,137,
+2,153,2,2,164,8,1,134,8,150,8,2,13,14,15,15,12,11,37,70,16,16,27,70,26,26,
+4,9,0,70,11,39,64,3,6,70,0,4,16,4,32,4,176,4,192,4,208,4,6,7,4,37,27,128,
+32,21,9,2,6,15,8,3,21,14,14,11,80,0,21,0,63,225,51,47,63,51,63,51,51,222,
+50,26,204,50,1,47,94,93,225,50,26,16,220,225,50,17,57,47,225,51,47,225,16,
+205,50,16,205,50,49,48,0,93,93,93,93,1,93,43,43,93,43,43,33,17,19,1,35,17,
+51,17,7,1,51,17,51,3,35,19,3,14,3,35,34,46,2,39,51,30,3,51,50,62,2,55,3,94,
+10,254,58,240,172,12,1,201,239,183,123,183,123,37,6,48,93,142,100,103,140,
+87,42,5,170,5,27,51,75,53,44,73,54,35,5,2,135,1,15,252,106,4,74,253,100,252,
+3,152,252,80,253,233,1,125,6,23,78,118,81,41,39,80,119,80,57,73,41,16,19,
+43,72,53,0,2,0,47,0,0,4,70,5,182,0,22,0,33,0,65,64,33,21,21,23,27,91,6,35,
+19,0,23,90,16,14,12,33,95,0,22,14,95,15,19,15,0,15,0,15,17,3,23,96,12,18,
+0,63,225,63,57,57,47,47,17,51,16,225,50,16,225,1,47,198,51,225,50,50,16,222,
+225,17,57,47,48,49,1,51,50,30,2,21,20,14,2,35,33,17,35,53,51,53,51,21,33,
+21,33,17,51,50,54,53,52,46,2,35,35,1,129,168,152,207,127,55,60,126,194,134,
+254,131,152,152,186,1,78,254,178,178,175,163,46,91,139,93,147,3,78,66,113,
+152,87,97,158,112,61,4,96,164,178,178,164,252,64,132,136,70,97,60,27,0,2,
+0,61,0,0,4,68,6,20,0,20,0,33,0,73,64,39,15,2,1,2,2,14,28,70,8,35,4,0,22,71,
+18,16,14,21,80,4,3,16,79,17,0,17,47,4,1,4,17,4,17,19,0,22,80,14,21,0,63,225,
+63,57,57,47,47,93,17,51,16,225,50,16,225,1,47,198,51,225,50,50,16,222,225,
+17,57,47,93,48,49,1,33,21,33,17,33,50,22,21,20,14,2,35,33,17,35,53,51,53,
+51,17,17,33,50,62,2,53,52,46,2,35,1,143,1,23,254,233,1,21,212,204,47,101,
+159,113,254,57,156,156,182,1,4,56,93,67,38,33,65,96,64,5,33,137,253,239,156,
+155,77,124,88,47,4,152,137,243,251,218,254,168,17,41,66,48,49,66,40,17,0,
+2,0,176,0,0,4,70,5,182,0,20,0,35,0,108,64,59,25,8,26,7,7,28,5,27,6,6,31,91,
+239,0,255,0,2,0,37,27,26,26,21,13,90,0,14,144,14,160,14,3,14,25,8,26,7,26,
+28,5,6,27,27,21,6,7,7,12,96,22,21,21,13,35,96,15,3,13,18,0,63,63,225,18,57,
+47,51,225,50,47,51,17,51,47,18,57,57,51,17,18,57,57,1,47,93,225,50,50,47,
+51,16,222,93,225,51,47,18,57,57,51,17,18,57,57,48,49,1,20,14,2,7,23,7,39,
+6,6,35,35,17,35,17,33,50,30,2,1,51,50,54,55,39,55,23,54,54,53,52,38,35,35,
+4,70,24,51,82,58,104,106,125,44,98,57,191,186,1,148,134,194,126,60,253,36,
+170,32,59,26,94,109,118,60,59,163,175,201,4,10,61,115,102,85,32,147,78,176,
+11,10,253,199,5,182,57,109,160,254,103,3,5,135,76,170,34,121,93,142,137,0,
+0,2,0,158,254,20,4,68,4,94,0,35,0,57,0,120,64,67,50,33,51,32,32,53,30,52,
+31,31,55,72,15,27,31,27,2,27,59,52,51,51,42,16,15,6,12,71,0,13,16,13,32,13,
+208,13,4,7,13,36,80,16,22,16,14,15,12,27,50,33,51,32,51,53,30,31,52,52,47,
+80,0,31,32,32,5,0,22,0,63,50,50,47,51,16,225,50,47,18,57,57,51,17,18,57,57,
+63,63,63,51,225,1,47,94,93,225,50,50,50,50,50,47,51,16,222,113,225,51,47,
+18,57,57,51,17,18,57,57,48,49,5,34,46,2,39,35,22,23,22,22,21,17,35,17,51,
+23,51,62,3,51,50,30,2,21,20,6,7,23,7,39,6,6,3,34,14,2,7,21,20,30,2,51,50,
+54,55,39,55,23,54,53,52,38,2,150,61,98,79,61,23,12,3,3,2,4,182,147,27,8,23,
+60,79,99,61,97,158,113,62,95,84,107,107,116,32,68,68,79,109,67,32,2,28,68,
+111,84,18,34,15,106,108,111,92,132,20,26,43,58,32,34,31,26,55,16,254,43,6,
+54,148,35,61,45,27,72,143,212,140,177,242,69,151,78,166,9,11,3,219,46,94,
+140,95,41,101,157,107,55,3,5,152,76,160,104,242,208,206,0,0,1,0,147,0,0,4,
+100,5,182,0,13,0,49,64,24,5,5,8,0,15,3,7,90,12,10,8,6,10,95,3,11,11,7,2,95,
+13,3,7,18,0,63,63,225,18,57,47,51,225,50,1,47,198,51,225,50,16,206,17,57,
+47,48,49,1,21,33,17,33,21,33,17,35,17,35,53,51,17,4,100,253,129,1,80,254,
+176,186,152,152,5,182,166,254,21,162,253,125,2,131,162,2,145,0,0,1,0,135,
+0,0,4,14,4,74,0,13,0,49,64,24,11,11,0,6,15,9,13,71,4,2,0,12,2,79,9,3,3,0,
+8,80,5,15,0,21,0,63,63,225,18,57,47,51,225,50,1,47,198,51,225,50,16,206,17,
+57,47,48,49,33,17,35,53,51,17,33,21,33,17,33,21,33,17,1,35,156,156,2,235,
+253,203,1,23,254,233,1,225,137,1,224,154,254,186,137,254,31,0,1,0,160,254,
+0,4,113,5,182,0,38,0,56,64,29,8,8,34,91,18,40,10,4,90,28,0,5,1,5,29,32,95,
+28,23,0,13,13,5,9,95,6,3,5,18,0,63,63,225,18,57,47,193,47,51,225,50,1,47,
+93,198,225,50,16,222,241,192,47,48,49,1,34,6,7,17,35,17,33,21,33,17,54,54,
+51,50,30,2,21,20,14,2,35,34,46,2,39,53,22,22,51,32,17,52,46,2,1,213,37,60,
+26,186,2,248,253,194,29,72,45,153,240,165,87,82,146,201,118,49,78,68,60,32,
+63,127,72,1,119,67,123,174,2,131,5,5,253,135,5,182,166,254,11,5,3,92,171,
+242,151,170,248,162,79,6,12,19,12,162,23,24,1,239,121,185,126,64,0,0,1,0,
+215,254,10,4,88,4,74,0,41,0,53,64,28,27,27,16,72,37,43,29,23,70,5,0,24,1,
+24,19,81,32,32,24,28,80,25,15,24,21,11,81,0,0,47,225,63,63,225,18,57,47,225,
+1,47,93,198,225,50,16,214,241,192,47,48,49,1,34,46,2,39,53,30,3,51,50,62,
+2,53,52,38,35,34,6,7,17,35,17,33,21,33,17,54,54,51,50,30,2,21,20,14,2,2,127,
+41,65,55,49,26,25,48,52,61,38,70,110,77,40,181,198,32,83,35,180,2,168,254,
+12,34,78,42,125,208,148,82,76,129,172,254,10,7,15,23,15,161,13,22,17,9,48,
+99,153,105,211,203,6,6,254,47,4,74,154,254,195,5,5,62,138,219,157,151,214,
+135,63,0,0,1,0,0,254,127,4,205,5,182,0,21,0,114,64,64,17,14,3,250,11,8,16,
+4,1,4,4,7,21,251,20,20,15,47,16,63,16,2,16,16,1,171,18,1,105,18,1,66,18,1,
+11,18,1,18,23,6,22,10,9,9,7,17,5,2,8,8,6,15,12,10,3,21,21,4,6,18,18,95,1,
+18,0,63,225,63,51,51,47,63,51,51,18,57,17,51,51,51,1,47,51,47,51,17,51,16,
+205,93,93,93,93,50,50,47,93,51,50,47,225,17,57,47,93,51,51,225,50,50,49,48,
+33,35,1,17,35,17,1,35,1,1,51,1,17,51,17,1,51,1,1,51,17,35,4,29,49,254,182,
+156,254,176,182,1,96,254,172,178,1,72,156,1,65,179,254,176,1,16,119,176,2,
+229,253,27,2,229,253,27,2,242,2,196,253,60,2,196,253,60,2,196,253,60,253,
+180,253,217,0,1,0,0,254,131,4,184,4,74,0,21,0,98,64,53,5,22,16,13,2,73,10,
+7,3,3,8,20,73,0,27,17,1,17,15,144,19,160,19,2,127,19,1,16,19,1,19,9,6,8,16,
+13,7,10,10,8,19,19,22,14,11,8,15,17,80,0,0,3,6,0,47,51,51,16,225,63,51,51,
+17,51,47,18,57,17,51,51,51,1,47,50,50,47,93,93,93,51,205,93,50,225,17,57,
+47,51,51,225,50,50,17,51,49,48,33,1,17,35,17,1,35,1,1,51,1,17,51,17,1,51,
+1,19,51,17,35,17,3,223,254,195,160,254,195,195,1,90,254,164,184,1,74,160,
+1,74,184,254,166,250,116,161,2,45,253,211,2,45,253,211,2,53,2,21,253,235,
+2,21,253,235,2,21,253,235,254,101,253,233,1,125,255,255,0,139,254,66,4,47,
+5,203,2,38,1,177,0,0,1,6,3,127,247,0,0,14,183,1,1,0,50,44,9,4,37,1,43,53,
+0,53,255,255,0,201,254,66,4,8,4,94,2,38,1,209,0,0,1,6,3,127,245,0,0,17,177,
+1,1,184,255,243,180,47,41,8,18,37,1,43,53,0,53,0,0,1,0,211,254,127,4,186,
+5,182,0,14,0,120,64,77,135,14,1,117,14,1,54,14,86,14,2,14,11,7,90,0,8,96,
+8,112,8,128,8,4,8,12,87,13,1,64,13,1,37,13,1,7,13,1,13,13,40,5,1,5,85,0,1,
+54,0,1,36,0,1,5,0,1,0,3,251,127,2,1,2,6,14,14,7,12,10,3,5,7,3,3,0,7,18,0,
+63,196,51,47,17,51,63,51,18,57,17,51,1,47,93,225,205,93,93,93,93,50,93,51,
+47,93,93,93,93,51,47,93,225,50,50,93,93,93,49,48,37,51,17,35,17,35,1,17,35,
+17,51,17,1,51,1,4,43,143,176,55,253,186,186,186,2,54,206,253,203,166,253,
+217,1,129,2,229,253,27,5,182,253,60,2,196,253,66,0,1,0,215,254,131,4,156,
+4,74,0,14,0,77,64,44,7,8,8,0,10,13,70,128,12,1,12,9,6,2,71,0,3,16,3,32,3,
+128,3,208,3,5,7,3,1,9,9,2,7,5,15,10,80,0,0,2,13,13,2,21,0,63,51,47,17,51,
+16,225,63,51,18,57,17,51,1,47,94,93,225,50,50,47,93,225,205,50,50,47,51,49,
+48,33,1,17,35,17,51,17,1,51,1,1,51,17,35,17,3,174,253,221,180,180,2,6,222,
+253,241,1,158,158,176,2,45,253,211,4,74,253,235,2,21,253,241,254,95,253,233,
+1,125,0,0,1,0,211,0,0,4,174,5,182,0,18,0,139,183,11,7,90,8,18,15,2,3,184,
+1,3,64,73,12,5,38,4,1,12,4,28,4,2,4,4,0,0,8,96,8,112,8,128,8,4,8,16,17,17,
+1,208,0,240,0,2,127,0,1,0,0,16,0,64,0,96,0,4,0,16,0,2,18,18,5,6,17,3,15,12,
+16,11,16,11,6,6,9,8,4,13,4,13,9,3,8,0,18,0,63,50,63,57,57,47,47,17,18,57,
+17,51,50,17,18,57,57,63,18,57,57,17,51,1,47,56,93,93,93,51,51,47,51,47,93,
+18,57,47,93,93,51,51,225,50,50,50,16,225,50,48,49,33,35,1,21,35,17,7,17,35,
+17,51,17,55,17,51,21,1,51,1,4,174,211,254,174,133,119,186,186,119,133,1,66,
+209,253,247,1,244,205,1,100,98,253,215,5,182,253,6,164,1,99,179,1,166,253,
+101,0,1,0,215,0,0,4,150,4,74,0,18,0,127,64,75,13,10,17,73,7,22,18,1,12,18,
+1,18,18,3,14,11,12,12,15,164,14,1,123,14,139,14,155,14,3,0,14,96,14,2,14,
+16,14,6,2,71,0,3,96,3,2,3,10,7,11,13,11,4,16,0,15,1,13,13,8,63,18,1,48,8,
+1,18,8,18,8,2,4,15,15,2,21,0,63,51,63,18,57,57,47,47,93,93,18,57,17,51,18,
+57,57,17,51,17,18,57,57,1,47,93,225,50,47,56,93,93,93,51,51,47,51,17,18,57,
+47,93,93,51,225,50,50,49,48,1,39,17,35,17,51,17,55,17,51,21,1,51,1,1,35,1,
+21,35,2,16,133,180,180,133,125,1,4,222,253,241,2,54,232,254,223,125,1,166,
+135,253,211,4,74,253,235,137,1,56,185,1,13,253,241,253,197,1,39,205,0,1,0,
+59,0,0,4,174,5,182,0,20,0,119,64,74,14,14,5,0,20,2,19,16,12,4,90,9,7,0,5,
+96,5,112,5,128,5,4,5,72,18,88,18,2,18,19,19,1,208,0,240,0,2,127,0,1,0,0,16,
+0,64,0,96,0,4,0,16,0,20,16,2,3,15,7,95,12,3,159,8,175,8,2,8,8,18,10,3,5,0,
+18,0,63,50,63,51,57,47,93,57,51,225,50,17,51,51,51,1,47,56,93,93,93,51,51,
+47,51,93,47,93,198,51,225,50,50,17,57,57,17,18,57,47,49,48,33,35,1,7,17,35,
+17,35,53,51,53,51,21,51,21,35,17,55,1,51,1,4,174,211,254,62,140,186,152,152,
+186,213,213,121,1,197,209,253,247,2,186,114,253,184,4,96,164,178,178,164,
+254,123,168,2,51,253,131,0,1,0,59,0,0,4,139,6,20,0,22,0,122,64,73,118,14,
+150,14,2,101,14,1,86,14,1,69,14,1,14,17,6,6,13,7,3,19,71,22,1,0,20,1,20,12,
+13,13,16,15,32,16,19,72,0,15,96,15,2,15,16,15,14,17,89,17,1,17,118,9,1,9,
+18,18,12,16,19,21,6,22,79,4,1,1,2,12,15,2,0,0,63,63,18,57,47,51,237,50,63,
+51,18,57,17,51,93,51,93,17,51,1,47,56,93,43,51,51,47,51,47,93,51,206,225,
+50,50,17,57,47,57,57,93,93,93,93,49,48,19,51,53,51,21,33,21,33,17,3,51,55,
+1,51,1,1,35,1,7,17,35,17,35,59,156,180,1,123,254,133,16,4,135,1,139,222,254,
+18,2,10,213,254,86,129,180,156,5,94,182,182,137,254,117,254,223,152,1,137,
+254,37,253,145,1,248,82,254,90,4,213,0,0,1,0,23,0,0,4,174,5,182,0,14,0,95,
+181,7,14,23,14,2,14,184,255,248,64,46,13,18,72,14,2,13,10,4,90,5,5,0,7,12,
+13,8,13,13,1,0,16,0,14,2,184,2,1,169,2,1,88,2,1,2,10,3,3,5,12,7,95,8,3,5,
+0,18,0,63,50,63,225,51,18,57,17,51,51,93,93,93,17,51,1,47,56,51,51,47,56,
+51,47,18,57,47,225,50,17,57,57,43,113,48,49,33,35,1,7,17,35,17,33,53,33,17,
+55,1,51,1,4,174,203,254,162,137,186,254,213,1,229,104,1,117,195,254,100,2,
+184,153,253,225,5,18,164,253,8,170,2,78,253,135,0,1,0,43,0,0,4,203,4,74,0,
+12,0,92,64,54,167,0,1,150,0,1,0,1,16,1,1,40,4,56,4,2,4,14,12,11,103,2,1,86,
+2,1,71,2,1,2,6,71,0,7,1,7,7,3,9,3,16,3,5,2,2,7,9,80,0,10,15,7,3,21,0,63,51,
+63,51,225,18,57,17,51,1,47,56,47,18,57,47,93,225,50,93,93,93,50,50,17,51,
+93,51,47,56,51,93,93,48,49,1,51,1,1,35,1,17,35,17,33,53,33,17,3,223,197,254,
+96,1,199,207,254,76,181,254,152,2,29,4,74,253,241,253,197,2,45,253,211,3,
+176,154,253,235,0,0,1,0,135,254,127,4,186,5,182,0,15,0,78,64,47,12,8,90,0,
+9,1,0,9,16,9,240,9,3,8,9,13,5,90,159,0,175,0,2,0,4,251,127,1,207,1,2,1,6,
+95,12,12,8,14,10,3,5,8,3,3,0,8,18,0,63,192,51,47,17,51,63,51,18,57,47,225,
+1,47,93,225,221,93,225,50,47,94,93,113,225,50,48,49,37,51,17,35,17,35,17,
+33,17,35,17,51,17,33,17,51,4,10,176,176,186,253,242,187,187,2,14,186,166,
+253,217,1,129,2,170,253,86,5,182,253,152,2,104,0,0,1,0,160,254,131,4,156,
+4,74,0,15,0,85,64,53,8,0,71,11,15,70,15,12,1,239,12,1,160,12,192,12,2,79,
+12,111,12,2,12,7,3,71,0,4,16,4,32,4,208,4,4,7,4,1,80,7,7,9,6,15,11,80,0,0,
+3,14,14,3,21,0,63,51,47,17,51,16,225,63,51,57,47,225,1,47,94,93,225,50,47,
+93,93,93,113,225,221,225,50,48,49,33,17,33,17,35,17,51,17,33,17,51,17,51,
+17,35,17,3,70,254,16,182,182,1,240,182,160,176,1,233,254,23,4,74,254,57,1,
+199,252,80,253,233,1,125,0,1,0,135,0,0,4,182,5,182,0,13,0,75,64,47,9,1,90,
+63,0,79,0,191,0,3,0,64,26,29,72,0,143,11,1,11,8,4,90,0,5,1,0,5,16,5,240,5,
+3,8,5,3,95,8,8,0,13,10,6,3,5,0,18,0,63,50,63,51,192,18,57,47,225,1,47,94,
+93,113,225,50,47,93,220,43,93,225,50,49,48,33,35,17,33,17,35,17,51,17,33,
+17,33,21,33,3,156,187,254,97,187,187,1,159,1,213,254,230,2,170,253,86,5,182,
+253,152,2,104,164,0,0,1,0,160,0,0,4,182,4,74,0,13,0,59,64,34,9,1,71,0,79,
+11,1,11,8,4,71,0,5,16,5,32,5,208,5,4,7,5,3,80,8,8,0,13,10,6,15,5,0,21,0,63,
+50,63,51,192,18,57,47,225,1,47,94,93,225,50,47,93,220,225,50,48,49,33,35,
+17,33,17,35,17,51,17,33,17,33,21,35,3,199,183,254,70,182,182,1,186,1,166,
+239,1,233,254,23,4,74,254,57,1,199,154,0,1,0,106,254,0,4,156,5,182,0,36,0,
+68,64,38,16,16,0,29,251,30,30,34,23,251,8,64,9,14,72,8,38,33,251,48,34,1,
+34,26,3,3,33,32,95,35,3,30,33,18,20,95,13,19,0,63,225,63,51,63,225,18,57,
+47,201,1,47,93,225,16,222,43,225,17,57,47,241,50,192,47,49,48,1,54,54,51,
+50,30,2,21,20,14,2,35,34,38,39,53,22,22,51,50,54,53,52,38,35,34,7,17,35,17,
+33,17,35,17,33,2,203,18,49,25,98,141,91,43,51,94,134,84,54,85,43,38,73,47,
+115,100,103,112,51,27,166,254,235,166,2,97,3,23,5,7,92,171,242,151,170,248,
+162,79,19,20,162,16,21,247,248,243,253,12,253,137,5,18,250,238,5,182,0,1,
+0,127,254,10,4,131,4,74,0,41,0,78,64,44,29,21,73,22,3,3,96,22,1,22,22,26,
+12,73,15,37,31,37,2,37,43,25,73,0,26,1,26,17,81,32,32,26,24,80,27,15,22,26,
+21,4,7,81,3,0,0,47,50,225,50,63,51,63,225,18,57,47,225,1,47,93,225,16,222,
+93,225,17,57,47,93,51,47,16,225,50,49,48,1,34,38,39,53,22,22,51,50,62,2,53,
+52,46,2,35,34,6,7,17,35,17,33,17,35,17,33,17,54,54,51,50,30,2,21,20,14,2,
+3,57,60,92,40,42,82,56,50,70,44,20,20,47,76,57,23,45,20,162,254,254,162,2,
+70,21,48,23,78,131,93,52,48,87,121,254,10,22,21,162,22,23,47,98,153,107,107,
+156,102,49,4,6,254,45,3,176,252,80,4,74,254,39,6,6,57,133,221,165,155,215,
+133,60,0,2,0,84,255,172,4,162,5,205,0,65,0,83,0,107,64,61,51,18,5,79,79,0,
+76,91,16,56,32,56,2,56,56,26,35,34,34,66,91,0,0,11,11,85,43,91,31,26,47,26,
+2,26,71,96,112,61,128,61,2,61,61,38,95,31,4,79,51,48,95,21,11,8,95,12,15,
+18,5,21,19,0,63,51,51,220,50,225,50,16,225,50,50,63,241,202,47,93,225,1,47,
+93,225,17,51,47,51,47,225,50,47,51,17,57,47,113,225,18,57,17,51,51,51,49,
+48,1,20,14,2,7,22,22,51,50,54,55,21,6,6,35,34,38,39,6,6,35,34,38,38,2,53,
+52,18,54,54,51,50,22,23,7,38,38,35,34,14,2,21,20,30,2,51,50,54,55,46,3,53,
+52,62,2,51,50,30,2,7,52,46,2,35,34,14,2,21,20,22,23,62,3,4,123,31,54,71,39,
+23,55,35,31,59,31,29,68,32,69,131,62,41,85,59,126,196,134,70,69,134,196,127,
+50,93,38,56,28,61,34,81,124,84,42,46,88,126,80,20,19,16,37,56,38,19,41,80,
+115,74,74,115,80,42,197,11,27,44,32,32,44,26,11,56,48,30,46,31,16,2,190,106,
+184,151,115,37,13,10,14,11,170,13,12,44,52,17,15,95,188,1,21,183,193,1,30,
+189,94,20,15,154,11,14,68,145,227,158,157,221,139,63,3,4,54,117,132,149,86,
+132,192,124,60,55,118,188,143,86,132,89,45,52,96,136,84,144,228,79,33,101,
+124,139,0,0,2,0,115,255,197,4,115,4,94,0,15,0,80,0,137,64,57,72,52,19,5,5,
+67,87,0,1,0,72,32,57,1,89,57,1,72,57,1,57,57,27,36,35,35,8,72,67,78,78,15,
+67,1,67,82,44,72,0,27,16,27,2,27,13,78,80,62,1,144,62,160,62,176,62,3,62,
+184,255,192,64,23,9,12,72,62,62,49,36,39,80,35,32,16,5,49,80,22,72,74,80,
+16,19,22,22,0,63,51,212,225,50,16,225,50,63,51,225,50,18,57,47,43,93,113,
+225,1,47,93,225,16,206,93,50,47,16,225,50,47,51,17,57,47,93,93,113,225,93,
+18,57,17,51,51,51,49,48,1,20,30,2,23,54,54,53,52,46,2,35,34,6,1,34,38,39,
+6,6,35,34,46,2,53,52,62,2,51,50,22,23,7,38,38,35,34,14,2,21,20,30,2,51,50,
+50,55,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,22,51,50,54,55,21,6,6,2,172,
+19,33,43,24,57,66,13,29,44,31,62,63,1,82,65,124,57,38,83,47,111,182,129,71,
+67,127,185,118,57,79,32,45,25,56,42,81,117,75,36,39,77,115,76,10,10,9,34,
+52,36,19,48,84,114,65,65,110,82,46,27,48,64,37,39,53,26,57,28,23,63,1,244,
+52,91,77,64,26,45,160,107,51,84,58,32,122,253,104,30,37,14,14,76,145,209,
+133,129,212,151,83,15,11,146,8,13,56,108,159,103,97,152,105,56,2,39,80,90,
+103,61,94,136,89,43,39,86,138,99,70,119,99,79,30,19,6,8,147,9,7,0,255,255,
+0,129,254,66,4,156,5,203,2,38,0,38,0,0,1,7,3,127,0,158,0,0,0,14,183,1,1,118,
+36,30,6,11,37,1,43,53,0,53,255,255,0,172,254,66,4,37,4,94,2,38,0,70,0,0,1,
+6,3,127,55,0,0,14,183,1,1,53,34,28,15,0,37,1,43,53,0,53,0,1,0,102,254,127,
+4,100,5,182,0,11,0,74,64,44,10,251,11,1,6,6,8,90,3,208,1,1,162,1,1,147,1,
+1,3,142,1,1,4,99,1,1,5,16,1,80,1,2,1,7,3,95,4,3,11,11,8,95,1,18,0,63,225,
+51,47,63,225,50,1,47,93,95,93,95,93,95,93,93,93,198,241,194,47,16,222,225,
+48,49,33,35,17,33,53,33,21,33,17,51,17,35,2,195,187,254,94,3,254,254,95,176,
+176,5,18,164,164,251,148,253,217,0,0,1,0,121,254,131,4,82,4,74,0,11,0,54,
+64,32,9,71,10,0,5,5,7,71,2,16,0,80,0,144,0,160,0,208,0,5,0,6,2,80,3,15,10,
+10,7,80,0,21,0,63,225,51,47,63,225,50,1,47,93,206,241,202,47,16,222,225,49,
+48,33,17,33,53,33,21,33,17,51,17,35,17,2,10,254,111,3,217,254,111,159,182,
+3,176,154,154,252,234,253,233,1,125,255,255,0,33,0,0,4,170,5,182,2,6,0,60,
+0,0,0,1,0,82,254,20,4,121,4,74,0,19,0,99,64,62,55,4,71,4,2,38,4,1,4,141,3,
+1,3,1,72,17,1,41,17,1,17,207,18,1,18,18,10,0,71,208,1,1,160,1,1,147,1,1,3,
+123,1,1,99,1,1,5,16,1,80,1,2,1,19,10,2,2,1,17,3,15,1,27,0,63,63,51,18,57,
+17,51,51,1,47,93,95,93,93,95,93,93,93,241,57,202,47,93,50,93,93,16,206,93,
+50,93,93,49,48,1,35,17,1,51,19,30,3,23,51,62,3,55,19,51,1,2,193,183,254,72,
+190,238,12,31,28,24,5,6,6,23,29,31,12,239,189,254,72,254,20,1,236,4,74,253,
+145,32,90,93,86,29,29,86,93,90,32,2,111,251,182,0,0,1,0,33,0,0,4,170,5,182,
+0,16,0,202,185,0,16,255,248,64,36,13,16,72,38,16,54,16,2,23,16,1,104,1,120,
+1,2,90,1,1,72,1,1,41,1,57,1,2,24,1,1,39,0,183,0,2,0,184,255,248,179,13,17,
+72,16,184,255,248,64,84,20,24,72,16,175,15,255,15,2,89,15,1,15,9,1,8,20,24,
+72,1,224,2,240,2,2,123,2,1,80,2,1,2,2,8,0,9,8,6,6,4,8,90,13,11,208,9,1,162,
+9,1,147,9,1,3,142,9,1,4,99,9,1,5,16,9,80,9,2,9,3,0,14,14,7,11,95,4,12,12,
+1,8,18,15,1,3,0,63,51,63,18,57,47,51,225,50,51,17,51,51,1,47,93,95,93,95,
+93,95,93,93,93,206,51,241,50,202,47,17,18,57,16,200,47,93,93,93,50,43,16,
+204,93,93,50,43,48,49,0,43,93,1,93,93,93,93,93,93,93,43,1,1,51,1,21,33,21,
+33,17,35,17,33,53,33,53,1,51,2,100,1,125,201,254,25,1,38,254,218,187,254,
+217,1,39,254,25,203,2,211,2,227,252,131,61,164,254,168,1,88,164,51,3,135,
+0,1,0,82,254,20,4,121,4,74,0,25,0,136,64,11,135,10,151,10,167,10,3,118,10,
+1,10,184,255,248,64,71,11,15,72,10,9,4,168,23,1,121,23,1,23,8,11,15,72,23,
+207,24,1,24,24,3,16,4,25,3,1,1,3,71,8,6,208,4,1,162,4,1,147,4,1,3,142,4,1,
+4,99,4,1,5,16,4,80,4,2,4,2,6,79,25,16,7,7,3,23,9,15,3,27,0,63,63,51,18,57,
+47,51,51,225,50,1,47,93,95,93,95,93,95,93,93,93,206,51,241,202,47,17,51,18,
+57,16,200,47,93,50,43,93,93,16,204,50,43,93,93,48,49,33,21,33,17,35,17,33,
+53,33,1,51,19,30,3,23,51,62,3,55,19,51,1,3,203,254,246,183,254,246,1,10,254,
+72,190,238,12,31,28,24,5,6,6,23,29,31,12,239,189,254,72,137,254,157,1,99,
+137,4,74,253,145,32,90,93,86,29,29,86,93,90,32,2,111,251,182,0,1,0,53,254,
+127,4,186,5,182,0,15,0,160,64,21,71,15,87,15,167,15,3,15,72,9,104,9,120,9,
+3,9,6,12,12,14,11,184,255,248,64,14,12,15,72,6,11,22,11,38,11,3,11,10,10,
+7,184,255,248,64,64,12,15,72,6,7,22,7,38,7,3,7,8,13,8,12,15,72,9,13,25,13,
+41,13,3,13,14,14,1,5,8,12,15,72,9,5,25,5,41,5,3,5,0,0,4,251,1,15,12,6,9,9,
+7,13,10,3,0,95,5,5,7,3,3,7,18,0,63,51,47,17,51,16,225,63,51,18,57,17,51,51,
+51,1,47,225,51,17,51,93,43,17,51,47,51,93,43,47,51,93,43,51,47,51,93,43,18,
+57,17,51,51,93,51,93,48,49,37,51,17,35,17,35,1,1,35,1,1,51,1,1,51,1,4,51,
+135,176,71,254,157,254,146,189,1,197,254,90,199,1,75,1,78,191,254,90,166,
+253,217,1,129,2,123,253,133,2,252,2,186,253,209,2,47,253,76,0,0,1,0,96,254,
+131,4,156,4,74,0,15,0,189,183,196,14,212,14,228,14,3,14,184,255,240,64,36,
+11,14,72,203,12,219,12,235,12,3,12,16,11,14,72,203,4,219,4,235,4,3,4,16,11,
+14,72,196,2,212,2,228,2,3,6,2,184,255,240,64,20,11,14,72,73,13,1,13,16,18,
+23,72,10,13,26,13,2,70,3,1,3,184,255,240,64,51,18,23,72,5,3,21,3,2,13,6,0,
+3,3,5,2,1,1,14,31,15,1,15,12,7,7,8,4,5,5,11,70,8,7,80,12,12,14,13,6,3,0,0,
+1,14,10,10,14,21,4,1,15,0,63,51,63,51,47,17,18,57,17,51,51,51,17,51,16,225,
+1,47,225,51,47,51,17,51,17,51,47,93,51,51,47,51,18,57,17,51,51,51,48,49,0,
+93,43,93,93,43,93,1,43,95,93,43,93,43,93,43,93,1,1,51,1,1,51,1,1,51,17,35,
+17,35,1,1,35,1,254,254,119,207,1,34,1,35,207,254,117,1,45,162,176,80,254,
+202,254,201,207,2,51,2,23,254,102,1,154,253,233,254,103,253,233,1,125,1,180,
+254,76,0,0,1,0,23,254,127,4,186,5,182,0,15,0,57,64,31,0,14,48,14,2,14,14,
+15,90,11,10,1,90,4,7,251,6,15,10,95,2,12,3,4,0,95,9,7,7,9,18,0,63,51,47,16,
+225,50,63,51,225,50,1,47,225,221,225,47,205,241,201,47,93,48,49,37,33,17,
+51,17,51,17,35,17,33,17,35,53,33,21,35,1,188,1,148,186,176,176,252,248,235,
+2,145,236,166,5,16,250,240,253,217,1,129,5,18,164,164,0,0,1,0,20,254,131,
+4,156,4,74,0,15,0,63,64,36,11,71,13,2,70,160,15,176,15,2,15,64,8,1,1,8,1,
+8,8,10,71,5,3,12,4,80,6,15,14,10,80,3,1,1,3,21,0,63,51,47,16,225,50,63,225,
+51,1,47,206,241,202,47,93,93,47,93,225,222,225,48,49,1,35,17,33,17,35,53,
+33,21,35,17,33,17,51,17,51,4,156,176,253,6,222,2,121,229,1,158,182,160,254,
+131,1,125,3,176,154,154,252,234,3,176,252,80,0,1,0,135,254,127,4,186,5,182,
+0,25,0,61,64,34,15,90,0,12,1,12,23,5,90,0,3,251,127,2,207,2,2,2,23,20,95,
+6,9,9,24,13,3,0,95,5,3,3,5,18,0,63,51,47,16,225,63,51,57,47,51,225,50,1,47,
+93,225,221,225,50,47,93,225,48,49,37,51,17,35,17,35,17,6,6,35,34,38,53,17,
+51,17,20,30,2,51,50,54,55,17,51,4,10,176,176,186,81,169,84,187,192,187,20,
+50,82,61,77,152,84,186,166,253,217,1,129,2,63,29,38,191,180,2,71,253,209,
+57,87,58,29,31,28,2,219,0,1,0,152,254,131,4,156,4,74,0,27,0,65,64,37,20,1,
+71,23,27,70,160,24,1,47,24,1,24,14,71,0,11,192,11,2,11,20,17,80,1,6,6,0,21,
+12,15,26,26,23,80,0,21,0,63,225,51,47,63,51,18,57,47,51,225,50,1,47,93,225,
+47,93,93,225,221,225,50,48,49,33,17,14,3,35,34,46,2,53,17,51,17,20,22,51,
+50,54,55,17,51,17,51,17,35,17,3,70,39,78,82,90,51,82,129,88,47,182,105,100,
+78,148,73,182,160,176,1,207,25,37,26,13,47,84,115,68,1,166,254,102,88,86,
+45,43,1,240,252,80,253,233,1,125,0,1,0,135,0,0,4,70,5,182,0,29,0,81,177,24,
+6,184,1,3,64,38,22,7,7,12,27,1,90,0,31,15,90,0,12,16,12,2,12,27,24,22,22,
+20,95,9,8,9,7,7,5,2,9,9,1,28,13,3,1,18,0,63,63,51,18,57,47,51,51,51,47,17,
+51,16,237,50,47,50,50,1,47,93,225,16,222,225,50,17,57,47,51,225,50,49,48,
+33,35,17,6,6,7,17,35,17,35,34,38,53,17,51,17,20,30,2,51,51,17,51,17,54,54,
+55,17,51,4,70,187,65,109,53,133,33,187,192,187,20,50,82,61,12,133,51,113,
+63,187,2,86,25,36,11,254,199,1,39,191,180,2,71,253,209,57,87,58,29,1,88,254,
+180,9,36,23,2,198,0,0,1,0,152,0,0,4,37,4,74,0,28,0,95,64,55,8,19,73,6,64,
+20,80,20,112,20,128,20,4,20,20,27,10,14,71,13,30,1,71,0,27,16,27,2,27,21,
+22,20,20,18,15,4,80,22,22,14,11,28,15,14,21,10,8,5,15,6,1,6,6,5,21,0,63,51,
+47,93,17,51,51,63,63,51,18,57,47,225,51,51,51,47,17,51,1,47,93,225,16,222,
+225,50,17,57,47,93,51,225,50,48,49,1,17,20,22,51,51,17,51,17,54,55,17,51,
+17,35,17,6,6,7,21,35,53,35,34,46,2,53,17,1,78,105,100,6,125,104,105,182,182,
+53,101,55,125,47,82,129,88,47,4,74,254,102,88,86,1,45,254,227,29,70,1,213,
+251,182,1,233,37,51,16,254,231,47,84,115,68,1,166,0,0,1,0,135,0,0,4,70,5,
+182,0,19,0,43,64,22,10,90,9,21,2,18,90,0,19,1,19,17,14,95,2,5,5,19,9,18,0,
+3,0,63,63,51,57,47,51,225,50,1,47,93,225,50,16,222,225,48,49,19,51,17,54,
+54,51,50,22,21,17,35,17,52,38,35,34,6,7,17,35,135,187,110,188,95,183,196,
+187,100,117,86,175,107,187,5,182,253,170,45,45,188,182,253,184,2,47,116,116,
+40,40,253,57,0,0,1,0,168,0,0,4,53,4,74,0,23,0,59,64,36,0,71,176,23,192,23,
+2,23,25,12,8,71,0,9,16,9,32,9,192,9,208,9,5,7,9,7,4,80,12,17,17,10,15,9,0,
+21,0,63,50,63,57,47,51,225,50,1,47,94,93,225,50,16,222,93,225,48,49,33,17,
+52,38,35,34,6,7,17,35,17,51,17,62,3,51,50,30,2,21,17,3,127,105,100,90,166,
+84,182,182,44,87,92,101,57,82,129,88,47,1,154,88,86,58,57,254,43,4,74,254,
+22,31,47,32,17,47,83,115,68,254,90,0,2,255,248,255,236,4,123,5,205,0,45,0,
+56,0,84,64,47,52,91,5,18,18,5,58,35,134,38,1,103,38,119,38,2,38,251,31,51,
+7,91,40,31,28,1,28,34,31,28,7,96,51,34,40,40,0,17,12,95,18,23,19,46,95,0,
+4,0,63,225,63,51,225,50,17,57,47,204,51,225,50,1,47,51,221,93,50,225,50,16,
+225,93,93,50,16,206,50,47,16,225,48,49,1,50,22,22,18,21,21,33,30,3,51,50,
+62,2,55,21,14,3,35,34,46,2,39,38,38,53,52,54,55,51,6,6,21,20,51,51,62,3,23,
+34,14,2,7,33,52,46,2,2,221,125,160,93,36,253,96,5,36,75,120,90,47,79,71,65,
+33,33,65,76,92,60,126,179,118,60,8,144,143,17,11,156,6,14,102,21,11,60,109,
+162,110,64,92,62,33,5,1,223,16,48,87,5,205,101,189,254,241,170,90,122,194,
+134,71,12,20,28,16,170,15,26,18,10,93,177,254,160,3,114,122,42,66,23,15,62,
+35,97,154,244,171,91,164,65,126,185,120,117,184,128,67,0,0,2,255,213,255,
+236,4,88,4,94,0,44,0,53,0,94,64,56,49,72,30,40,40,30,55,12,149,15,1,102,15,
+118,15,134,15,3,15,73,8,48,31,72,19,31,5,47,5,2,5,11,8,64,24,27,72,8,5,31,
+80,48,11,18,18,34,45,80,24,16,39,34,81,40,0,22,0,63,50,225,50,63,225,18,57,
+47,204,51,225,50,1,47,43,51,221,93,50,225,50,16,225,93,93,50,16,206,50,47,
+16,225,48,49,5,34,46,2,39,38,38,53,52,54,55,51,6,6,21,20,22,51,51,62,3,51,
+50,30,2,21,21,33,22,22,51,50,62,2,55,21,14,3,3,34,6,7,33,52,46,2,2,215,108,
+178,131,75,4,133,141,17,10,149,6,14,48,50,27,14,75,117,152,90,99,158,110,
+59,253,76,5,152,152,51,87,80,77,39,40,77,81,87,96,115,132,11,1,235,27,56,
+88,20,70,136,199,129,2,111,114,39,63,21,14,58,34,47,49,108,170,117,61,71,
+129,181,110,113,193,182,10,19,29,18,162,19,28,18,8,3,219,156,149,68,113,80,
+44,0,0,2,255,248,254,127,4,123,5,205,0,48,0,59,0,103,64,57,24,251,25,25,31,
+55,91,5,18,18,5,61,38,134,41,1,103,41,119,41,2,41,251,34,54,7,91,44,31,31,
+1,31,37,34,31,7,96,54,37,43,43,0,17,12,95,23,26,23,24,24,18,23,19,49,95,0,
+4,0,63,225,63,51,51,47,17,51,16,225,50,17,57,47,204,51,225,50,1,47,51,221,
+93,50,225,50,16,225,93,93,50,16,206,50,47,16,225,18,57,47,225,48,49,1,50,
+22,22,18,21,21,33,30,3,51,50,62,2,55,21,14,3,7,17,35,17,46,3,39,38,38,53,
+52,54,55,51,6,6,21,20,51,51,62,3,23,34,14,2,7,33,52,46,2,2,221,125,160,93,
+36,253,96,5,36,75,120,90,47,79,71,65,33,30,59,67,78,49,176,90,130,86,46,6,
+144,143,17,11,156,6,14,102,21,11,60,109,162,110,64,92,62,33,5,1,223,16,48,
+87,5,205,101,189,254,241,170,90,122,194,134,71,12,20,28,16,170,14,23,18,12,
+2,254,147,1,125,23,111,170,226,138,3,114,122,42,66,23,15,62,35,97,154,244,
+171,91,164,65,126,185,120,117,184,128,67,0,0,2,255,213,254,131,4,88,4,94,
+0,45,0,54,0,113,64,66,20,70,21,21,27,50,72,6,16,16,6,56,34,149,37,1,102,37,
+118,37,134,37,3,37,73,30,49,7,72,41,31,27,47,27,2,27,33,30,64,24,27,72,30,
+27,7,80,49,33,40,40,0,15,10,81,19,22,19,20,20,16,19,22,46,80,0,16,0,63,225,
+63,51,51,47,17,51,16,225,50,17,57,47,204,51,225,50,1,47,43,51,221,93,50,225,
+50,16,225,93,93,50,16,206,50,47,16,225,18,57,47,225,49,48,1,50,30,2,21,21,
+33,22,22,51,50,62,2,55,21,6,6,7,17,35,17,46,3,39,38,38,53,52,54,55,51,6,6,
+21,20,22,51,51,62,3,23,34,6,7,33,52,46,2,2,174,99,158,110,59,253,76,5,152,
+152,51,87,80,77,39,66,133,78,176,84,136,99,57,3,133,141,17,10,149,6,14,48,
+50,27,14,75,117,152,86,115,132,11,1,235,27,56,88,4,94,71,129,181,110,113,
+193,182,10,19,29,18,162,32,34,5,254,149,1,117,17,84,132,178,111,2,111,114,
+39,63,21,14,58,34,47,49,108,170,117,61,151,156,149,68,113,80,44,0,255,255,
+0,225,0,0,3,233,5,182,2,6,0,44,0,0,255,255,0,0,0,0,4,205,7,105,2,38,1,176,
+0,0,1,7,2,54,0,0,1,82,0,19,64,11,1,20,5,38,1,0,23,18,17,10,37,1,43,53,0,43,
+53,0,255,255,0,0,0,0,4,205,6,23,2,38,1,208,0,0,1,6,2,54,0,0,0,19,64,11,1,
+20,17,38,1,0,23,18,16,5,37,1,43,53,0,43,53,0,0,1,0,135,254,0,4,88,5,182,0,
+37,0,88,64,49,134,11,1,23,11,55,11,103,11,3,119,8,1,9,10,10,33,91,17,39,11,
+8,4,90,5,27,27,0,5,1,5,8,11,97,3,0,0,4,9,6,3,28,31,95,27,22,22,4,18,0,63,
+51,47,51,225,50,63,51,18,57,47,51,225,50,1,47,93,51,47,16,225,50,50,16,222,
+225,51,47,51,48,49,0,93,1,93,93,1,34,6,7,17,35,17,51,17,1,51,1,51,50,30,2,
+21,20,14,2,35,34,46,2,39,53,22,22,51,32,17,52,46,2,1,240,57,82,35,187,187,
+2,53,207,253,209,6,127,210,151,83,82,146,200,119,49,78,68,60,31,63,126,73,
+1,118,69,115,152,2,125,15,14,253,160,5,182,253,60,2,196,253,88,81,161,237,
+156,170,248,162,79,6,12,19,12,162,23,24,1,239,129,186,119,56,0,0,1,0,215,
+254,10,4,88,4,74,0,34,0,85,64,48,34,16,25,33,1,33,34,34,20,72,5,36,32,22,
+0,54,0,70,0,3,0,28,70,29,13,13,0,29,1,29,32,0,78,27,25,25,29,33,30,15,14,
+17,81,13,10,10,29,21,0,63,51,47,51,225,50,63,51,18,57,47,51,225,50,1,47,93,
+51,47,16,225,50,93,50,16,222,225,51,47,51,93,56,48,49,1,30,3,21,20,14,2,35,
+34,38,39,53,22,22,51,50,54,53,52,46,2,35,34,7,17,35,17,51,17,1,51,2,106,100,
+180,135,79,74,129,176,102,76,105,47,44,105,66,149,157,52,97,137,85,83,75,
+180,180,1,228,215,2,98,2,61,130,207,149,150,213,136,64,31,29,161,24,37,195,
+210,106,152,98,46,29,254,76,4,74,254,6,1,250,0,1,0,4,254,127,4,203,5,182,
+0,35,0,75,64,42,12,20,7,250,29,20,0,34,144,34,160,34,3,34,34,5,20,3,91,2,
+1,5,90,0,4,1,7,95,34,3,21,24,97,20,17,19,3,3,0,95,5,18,0,63,225,51,47,63,
+51,225,50,63,225,1,47,51,221,225,16,221,225,47,18,57,47,93,18,57,225,17,57,
+48,49,37,51,3,35,19,35,17,35,14,3,7,14,3,35,34,38,39,53,22,22,51,50,62,2,
+55,54,54,18,18,55,33,4,8,195,144,217,166,186,236,14,32,33,34,16,20,53,79,
+110,78,35,74,28,22,59,32,48,64,42,26,10,11,33,39,43,22,2,65,166,253,217,1,
+129,5,18,113,244,236,212,81,103,162,111,59,14,11,150,10,15,63,98,117,54,57,
+200,1,6,1,58,170,0,1,0,31,254,131,4,174,4,74,0,24,0,63,64,33,9,15,7,73,20,
+15,23,23,5,15,3,71,2,1,5,71,0,4,1,7,80,23,15,18,79,12,22,3,3,0,80,5,21,0,
+63,225,51,47,63,225,63,225,1,47,51,221,225,16,221,225,47,18,57,47,18,57,225,
+17,57,48,49,37,51,3,35,19,35,17,33,2,2,6,6,35,34,38,39,53,22,51,50,54,54,
+18,55,33,3,248,182,123,182,123,182,254,196,20,64,95,130,86,28,49,15,21,28,
+55,89,69,51,18,2,142,154,253,233,1,125,3,176,254,253,254,148,230,105,6,6,
+131,6,117,241,1,111,250,0,1,0,135,254,0,4,70,5,182,0,27,0,78,64,46,20,12,
+90,23,29,19,15,90,16,5,5,16,16,32,16,2,32,16,48,16,2,16,14,95,152,19,1,15,
+19,47,19,2,6,19,19,16,21,17,3,16,18,6,9,95,5,0,0,47,50,225,50,63,63,51,18,
+57,47,94,93,93,225,1,47,93,113,51,47,16,225,50,16,222,225,50,48,49,1,34,46,
+2,39,53,22,22,51,50,54,53,17,33,17,35,17,51,17,33,17,51,17,20,14,2,2,88,45,
+71,61,54,29,56,110,63,164,174,253,183,187,187,2,73,187,74,132,181,254,0,6,
+12,19,12,162,23,24,240,247,2,31,253,86,5,182,253,152,2,104,250,221,170,248,
+162,79,0,0,1,0,160,254,10,4,45,4,74,0,27,0,72,64,42,20,12,71,176,23,192,23,
+2,23,29,19,15,71,16,3,3,0,16,16,16,32,16,208,16,4,7,16,14,80,19,19,16,21,
+17,15,16,21,4,7,81,3,0,0,47,50,225,50,63,63,51,18,57,47,225,1,47,94,93,51,
+47,16,225,50,16,222,93,225,50,48,49,1,34,38,39,53,22,22,51,50,62,2,53,17,
+33,17,35,17,51,17,33,17,51,17,20,14,2,2,145,75,105,47,43,106,66,59,91,61,
+31,253,223,182,182,2,33,182,63,111,151,254,10,31,29,161,24,37,45,97,150,105,
+1,178,254,23,4,74,254,57,1,199,251,243,150,213,136,64,0,0,1,0,135,254,127,
+4,203,5,182,0,15,0,84,64,49,12,8,90,16,9,32,9,2,32,9,48,9,2,9,3,91,2,1,13,
+5,90,0,4,1,6,95,152,12,1,15,12,47,12,2,6,12,12,9,14,10,3,0,5,5,9,3,3,9,18,
+0,63,51,47,17,51,16,205,63,51,18,57,47,94,93,93,225,1,47,51,221,225,50,16,
+221,225,47,93,113,225,50,48,49,37,51,3,35,19,35,17,33,17,35,17,51,17,33,17,
+51,4,8,195,144,217,166,186,253,244,187,187,2,12,186,166,253,217,1,129,2,170,
+253,86,5,182,253,152,2,104,0,0,1,0,160,254,131,4,174,4,74,0,15,0,73,64,41,
+14,71,13,12,8,0,71,11,15,12,7,3,71,0,4,16,4,32,4,208,4,4,7,4,2,80,7,7,4,9,
+5,15,11,80,0,0,4,14,14,4,21,0,63,51,47,17,51,16,225,63,51,18,57,47,225,1,
+47,94,93,225,50,47,51,221,225,50,16,221,237,48,49,33,17,33,17,35,17,51,17,
+33,17,51,17,51,3,35,19,3,66,254,20,182,182,1,236,182,182,123,182,123,1,233,
+254,23,4,74,254,57,1,199,252,80,253,233,1,125,0,1,0,135,254,127,4,70,5,182,
+0,29,0,61,64,32,28,251,27,27,22,0,90,25,31,12,90,0,9,1,9,1,6,95,22,17,17,
+10,29,95,26,27,27,26,18,23,10,3,0,63,51,63,51,47,16,225,17,57,47,51,225,50,
+1,47,93,225,16,222,225,50,50,47,225,48,49,37,17,14,3,35,34,38,53,17,51,17,
+20,30,2,51,50,62,2,55,17,51,17,35,17,35,17,3,139,57,101,94,92,49,187,192,
+187,20,50,82,61,45,86,89,96,56,187,187,176,166,1,176,22,34,22,12,191,180,
+2,71,253,209,57,87,58,29,10,20,30,20,2,198,250,74,254,127,2,39,0,1,0,152,
+254,131,4,37,4,74,0,27,0,75,64,45,25,70,24,24,19,27,71,176,22,1,22,29,13,
+71,0,10,16,10,32,10,208,10,4,7,10,5,80,15,16,31,16,2,16,16,11,26,80,23,24,
+24,23,21,20,11,15,0,63,51,63,51,47,16,225,17,57,47,93,225,1,47,94,93,225,
+16,222,93,225,50,50,47,225,48,49,1,14,3,35,34,46,2,53,17,51,17,20,22,51,50,
+54,55,17,51,17,35,17,35,17,51,3,111,44,87,92,101,57,82,129,88,47,182,105,
+100,89,167,84,182,166,176,160,1,233,30,48,32,17,47,84,115,68,1,166,254,102,
+88,86,58,57,1,213,251,182,254,131,2,23,0,0,1,0,113,254,127,4,203,5,182,0,
+29,0,219,64,60,27,14,1,10,14,1,252,14,1,237,14,1,220,14,1,185,14,201,14,2,
+138,14,154,14,170,14,3,108,14,124,14,2,91,14,1,58,14,74,14,2,25,14,41,14,
+2,3,11,19,11,2,241,11,1,226,11,1,212,11,1,11,184,255,232,64,88,17,21,72,99,
+11,115,11,2,84,11,1,53,11,69,11,2,22,11,38,11,2,19,251,18,17,29,0,12,12,8,
+27,22,10,14,1,14,21,250,15,16,1,191,16,207,16,223,16,3,16,17,5,11,1,11,7,
+2,8,250,0,9,16,9,2,9,16,95,21,18,28,14,2,11,3,5,12,1,3,12,13,0,1,1,0,8,19,
+19,8,18,0,63,51,47,17,51,95,93,50,95,93,63,51,51,51,63,225,1,47,93,225,50,
+50,50,93,47,221,93,113,225,50,93,50,50,17,57,17,51,51,16,221,237,48,49,93,
+93,93,93,43,93,93,93,113,93,93,93,93,93,93,93,93,93,113,113,33,1,35,22,23,
+22,22,21,17,35,17,51,19,51,19,51,17,51,3,35,19,35,17,52,54,55,54,55,35,1,
+1,254,254,250,8,5,4,4,5,145,237,236,6,239,242,154,185,176,166,108,4,3,4,3,
+8,254,248,5,0,74,73,63,139,57,252,150,5,182,251,88,4,168,250,240,253,217,
+1,129,3,119,52,134,61,71,73,251,2,0,1,0,115,254,131,4,174,4,74,0,36,0,204,
+64,140,184,36,200,36,216,36,3,153,36,169,36,2,138,36,1,105,36,1,90,36,1,72,
+36,1,41,36,57,36,2,26,36,1,9,36,1,213,24,1,198,24,1,165,24,181,24,2,150,24,
+1,85,24,101,24,133,24,3,70,24,1,55,24,1,38,24,1,21,24,1,6,24,1,8,15,1,8,14,
+1,7,13,1,7,12,1,3,14,13,30,30,6,24,21,73,4,22,20,22,36,22,3,22,4,3,2,36,6,
+73,1,5,123,2,203,2,219,2,235,2,4,2,7,36,36,20,24,15,30,14,15,14,1,2,14,21,
+4,4,21,21,1,80,6,21,0,63,225,63,51,47,17,51,95,93,17,51,63,51,51,17,51,1,
+47,93,51,221,225,50,16,221,205,47,93,225,50,17,57,17,51,51,48,49,95,93,93,
+93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,93,1,17,51,3,
+35,19,35,17,14,3,7,3,35,3,46,3,39,17,35,17,51,19,30,3,23,62,3,55,19,4,29,
+145,123,168,123,123,4,16,17,17,5,199,131,196,4,16,18,18,6,145,204,197,10,
+21,18,15,4,5,14,17,19,10,203,4,74,252,80,253,233,1,125,3,129,21,69,74,68,
+18,253,121,2,135,14,62,73,75,26,252,127,4,74,253,112,34,81,75,62,16,17,61,
+74,78,34,2,148,0,255,255,0,225,0,0,3,233,5,182,2,6,0,44,0,0,255,255,0,33,
+0,0,4,172,7,105,2,38,0,36,0,0,1,7,2,54,255,255,1,82,0,21,180,2,17,5,38,2,
+184,255,255,180,20,15,4,7,37,1,43,53,0,43,53,0,255,255,0,135,255,236,4,2,
+6,23,2,38,0,68,0,0,1,6,2,54,4,0,0,19,64,11,2,36,17,38,2,37,39,34,8,22,37,
+1,43,53,0,43,53,0,255,255,0,33,0,0,4,172,7,43,2,38,0,36,0,0,1,7,0,106,0,0,
+1,82,0,25,182,3,2,19,5,38,3,2,184,255,255,180,21,25,4,7,37,1,43,53,53,0,43,
+53,53,0,255,255,0,135,255,236,4,2,5,217,2,38,0,68,0,0,1,6,0,106,12,0,0,23,
+64,13,3,2,38,17,38,3,2,45,40,44,8,22,37,1,43,53,53,0,43,53,53,0,255,255,0,
+0,0,0,4,186,5,182,2,6,0,136,0,0,255,255,0,45,255,236,4,162,4,94,2,6,0,168,
+0,0,255,255,0,217,0,0,4,35,7,105,2,38,0,40,0,0,1,7,2,54,0,23,1,82,0,21,180,
+1,14,5,38,1,184,255,255,180,17,12,1,0,37,1,43,53,0,43,53,0,255,255,0,133,
+255,236,4,72,6,23,2,38,0,72,0,0,1,6,2,54,16,0,0,19,64,11,2,25,17,38,2,15,
+28,23,11,0,37,1,43,53,0,43,53,0,0,2,0,84,255,236,4,123,5,205,0,30,0,41,0,
+63,64,36,36,26,91,14,43,37,91,24,32,3,48,3,2,3,3,31,24,47,24,2,24,37,95,25,
+25,9,31,95,19,19,3,0,95,4,9,4,0,63,51,225,50,63,225,17,57,47,225,1,47,93,
+51,47,93,16,225,16,222,225,50,48,49,1,34,6,7,53,62,3,51,50,22,22,18,21,20,
+2,6,6,35,34,38,38,2,53,53,33,46,3,3,50,62,2,55,33,30,3,2,35,111,179,79,38,
+80,93,111,67,141,217,147,75,73,141,208,135,137,192,122,55,3,98,6,55,100,145,
+48,77,125,90,54,6,253,99,2,35,75,119,5,41,44,32,170,15,26,19,10,108,198,254,
+233,171,174,254,235,194,104,103,192,1,17,171,82,122,193,134,71,251,102,65,
+126,185,120,117,184,127,68,0,0,2,0,133,255,236,4,72,4,94,0,30,0,39,0,73,64,
+43,34,17,72,15,5,1,255,5,1,5,41,35,72,15,25,25,0,15,1,0,15,16,15,240,15,3,
+8,15,35,80,16,16,0,31,80,10,22,25,20,81,26,0,16,0,63,50,225,50,63,225,17,
+57,47,225,1,47,94,93,113,51,47,16,225,16,222,93,113,225,50,49,48,1,50,30,
+2,21,20,14,2,35,34,46,2,53,53,33,38,38,35,34,14,2,7,53,62,3,19,50,54,55,33,
+20,30,2,2,45,119,198,143,79,72,131,184,111,108,173,120,64,3,6,5,171,168,56,
+97,89,84,44,43,83,87,96,100,133,156,12,253,195,32,66,103,4,94,74,142,210,
+135,136,214,148,79,71,129,181,110,113,193,181,10,19,28,18,159,20,28,19,9,
+252,37,156,149,68,113,80,44,0,255,255,0,84,255,236,4,123,7,43,2,38,2,225,
+0,0,1,7,0,106,0,2,1,82,0,23,64,13,3,2,46,5,38,3,2,0,48,52,24,14,37,1,43,53,
+53,0,43,53,53,0,255,255,0,133,255,236,4,72,5,217,2,38,2,226,0,0,1,6,0,106,
+2,0,0,23,64,13,3,2,44,17,38,3,2,1,46,50,15,5,37,1,43,53,53,0,43,53,53,0,255,
+255,0,0,0,0,4,205,7,43,2,38,1,176,0,0,1,7,0,106,0,0,1,82,0,25,182,2,1,22,
+5,38,2,1,184,255,255,180,24,28,17,10,37,1,43,53,53,0,43,53,53,0,255,255,0,
+0,0,0,4,205,5,217,2,38,1,208,0,0,1,6,0,106,0,0,0,25,182,2,1,22,17,38,2,1,
+184,255,255,180,24,28,16,5,37,1,43,53,53,0,43,53,53,0,255,255,0,139,255,236,
+4,47,7,43,2,38,1,177,0,0,1,7,0,106,255,237,1,82,0,25,182,2,1,40,5,38,2,1,
+184,255,246,180,42,46,9,4,37,1,43,53,53,0,43,53,53,0,255,255,0,201,255,236,
+4,8,5,217,2,38,1,209,0,0,1,6,0,106,253,0,0,25,182,2,1,37,17,38,2,1,184,255,
+250,180,39,43,8,18,37,1,43,53,53,0,43,53,53,0,0,1,0,158,255,236,4,66,5,182,
+0,32,0,75,64,41,87,0,1,70,0,1,28,91,32,32,5,0,91,26,26,13,22,5,34,29,29,0,
+13,1,13,32,29,95,30,0,97,26,26,30,3,14,19,96,13,10,19,0,63,51,225,50,63,57,
+47,225,16,225,50,1,47,93,51,47,16,222,193,17,57,47,225,17,51,47,225,48,49,
+93,93,1,30,3,21,20,14,2,35,34,38,39,53,30,3,51,50,54,53,52,38,35,35,53,1,
+33,53,33,21,2,74,115,186,132,71,67,136,205,137,110,192,85,43,96,99,99,46,
+178,176,207,186,123,1,166,253,166,3,61,3,59,4,54,100,151,102,96,160,116,64,
+34,45,170,23,36,24,13,148,135,135,129,151,1,209,166,145,0,0,1,0,170,254,20,
+4,59,4,74,0,36,0,70,64,38,32,74,36,36,5,0,74,0,30,1,30,30,13,24,70,5,38,33,
+0,13,1,13,31,0,78,30,30,19,33,80,34,15,14,19,80,13,10,27,0,63,51,225,50,63,
+225,18,57,47,225,50,1,47,93,51,16,222,225,17,57,47,93,225,17,51,47,225,48,
+49,1,30,3,21,20,14,2,35,34,38,39,55,30,3,51,50,62,2,53,52,46,2,35,35,53,1,
+33,53,33,21,2,72,104,182,135,78,76,139,198,123,122,193,62,2,33,84,98,111,
+59,77,128,92,51,59,108,151,91,119,1,182,253,150,3,61,1,213,7,64,114,164,108,
+110,185,134,75,36,34,166,16,31,24,15,48,89,127,78,86,123,80,37,125,1,237,
+154,133,0,255,255,0,137,0,0,4,70,6,193,2,38,1,178,0,0,1,7,1,77,0,2,1,82,0,
+19,64,11,1,19,5,38,1,0,17,18,0,8,37,1,43,53,0,43,53,0,255,255,0,160,0,0,4,
+45,5,111,2,38,1,210,0,0,1,6,1,77,2,0,0,19,64,11,1,14,17,38,1,1,12,13,10,4,
+37,1,43,53,0,43,53,0,255,255,0,137,0,0,4,70,7,43,2,38,1,178,0,0,1,7,0,106,
+0,2,1,82,0,23,64,13,2,1,21,5,38,2,1,0,23,27,0,8,37,1,43,53,53,0,43,53,53,
+0,255,255,0,160,0,0,4,45,5,217,2,38,1,210,0,0,1,6,0,106,2,0,0,23,64,13,2,
+1,16,17,38,2,1,1,18,22,10,4,37,1,43,53,53,0,43,53,53,0,255,255,0,84,255,236,
+4,123,7,43,2,38,0,50,0,0,1,7,0,106,0,2,1,82,0,23,64,13,3,2,24,5,38,3,2,0,
+26,30,2,7,37,1,43,53,53,0,43,53,53,0,255,255,0,115,255,236,4,88,5,217,2,38,
+0,82,0,0,1,6,0,106,249,0,0,25,182,3,2,24,17,38,3,2,184,255,249,180,26,30,
+3,9,37,1,43,53,53,0,43,53,53,0,255,255,0,84,255,236,4,123,5,205,2,6,2,126,
+0,0,255,255,0,115,255,236,4,88,4,94,2,6,2,127,0,0,255,255,0,84,255,236,4,
+123,7,43,2,38,2,126,0,0,1,7,0,106,0,2,1,82,0,23,64,13,4,3,46,5,38,4,3,0,48,
+52,10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,115,255,236,4,88,5,217,2,38,
+2,127,0,0,1,6,0,106,249,0,0,25,182,4,3,35,17,38,4,3,184,255,249,180,37,41,
+10,0,37,1,43,53,53,0,43,53,53,0,255,255,0,68,255,236,4,76,7,43,2,38,1,199,
+0,0,1,7,0,106,255,136,1,82,0,25,182,2,1,28,5,38,2,1,184,255,166,180,30,34,
+1,6,37,1,43,53,53,0,43,53,53,0,255,255,0,184,255,236,4,37,5,217,2,38,1,231,
+0,0,1,6,0,106,208,0,0,25,182,2,1,27,17,38,2,1,184,255,199,180,29,33,13,18,
+37,1,43,53,53,0,43,53,53,0,255,255,0,27,255,236,4,176,6,193,2,38,1,189,0,
+0,1,7,1,77,0,8,1,82,0,19,64,11,1,26,5,38,1,8,24,25,14,0,37,1,43,53,0,43,53,
+0,255,255,0,82,254,20,4,121,5,111,2,38,0,92,0,0,1,6,1,77,2,0,0,19,64,11,1,
+25,17,38,1,2,23,24,0,9,37,1,43,53,0,43,53,0,255,255,0,27,255,236,4,176,7,
+43,2,38,1,189,0,0,1,7,0,106,255,255,1,82,0,25,182,2,1,28,5,38,2,1,184,255,
+255,180,30,34,14,0,37,1,43,53,53,0,43,53,53,0,255,255,0,82,254,20,4,121,5,
+217,2,38,0,92,0,0,1,6,0,106,8,0,0,23,64,13,2,1,27,17,38,2,1,8,29,33,0,9,37,
+1,43,53,53,0,43,53,53,0,255,255,0,27,255,236,4,176,7,115,2,38,1,189,0,0,1,
+7,1,83,0,82,1,82,0,23,64,13,2,1,30,5,38,2,1,82,24,35,14,0,37,1,43,53,53,0,
+43,53,53,0,255,255,0,82,254,20,4,121,6,33,2,38,0,92,0,0,1,6,1,83,94,0,0,23,
+64,13,2,1,29,17,38,2,1,94,23,34,0,9,37,1,43,53,53,0,43,53,53,0,255,255,0,
+135,0,0,4,70,7,43,2,38,1,193,0,0,1,7,0,106,0,2,1,82,0,23,64,13,2,1,21,5,38,
+2,1,1,23,27,6,0,37,1,43,53,53,0,43,53,53,0,255,255,0,152,0,0,4,37,5,217,2,
+38,1,225,0,0,1,6,0,106,251,0,0,23,64,13,2,1,21,17,38,2,1,2,23,27,15,7,37,
+1,43,53,53,0,43,53,53,0,0,1,1,43,254,127,4,100,5,182,0,9,0,56,64,35,0,11,
+5,251,6,6,3,90,0,8,1,0,8,32,8,48,8,144,8,160,8,240,8,6,8,2,95,9,3,5,5,3,95,
+8,18,0,63,225,51,47,63,225,1,47,93,113,225,50,47,225,16,206,49,48,1,21,33,
+17,51,17,35,17,35,17,4,100,253,129,177,177,186,5,182,166,251,150,253,217,
+1,129,5,182,0,1,1,35,254,131,4,14,4,74,0,9,0,46,64,26,2,11,7,70,8,8,5,71,
+0,0,144,0,160,0,3,0,4,80,1,15,7,7,5,80,0,21,0,63,225,51,47,63,225,1,47,93,
+225,50,47,225,16,206,48,49,33,17,33,21,33,17,51,17,35,17,1,35,2,235,253,203,
+160,176,4,74,154,252,234,253,233,1,125,0,255,255,0,96,0,0,4,109,7,43,2,38,
+1,197,0,0,1,7,0,106,0,2,1,82,0,23,64,13,4,3,26,5,38,4,3,1,28,32,0,20,37,1,
+43,53,53,0,43,53,53,0,255,255,0,113,0,0,4,90,5,217,2,38,1,229,0,0,1,6,0,106,
+2,0,0,23,64,13,4,3,25,17,38,4,3,2,27,31,6,17,37,1,43,53,53,0,43,53,53,0,0,
+1,0,147,254,109,4,100,5,182,0,29,0,72,64,38,15,4,1,4,4,7,0,31,16,9,250,23,
+23,2,7,90,28,26,24,19,6,26,95,3,27,27,7,2,95,29,3,7,95,24,18,19,96,12,0,47,
+225,63,225,63,225,18,57,47,51,225,50,1,47,47,206,51,225,50,50,47,225,206,
+16,206,17,57,47,93,48,49,1,21,33,17,33,21,33,17,51,17,20,6,35,34,38,39,53,
+22,22,51,50,54,53,53,35,17,35,53,51,17,4,100,253,129,1,80,254,176,156,110,
+125,39,63,21,14,58,34,47,49,186,152,152,5,182,166,254,21,162,254,35,254,217,
+132,142,17,9,150,7,14,49,49,150,2,131,162,2,145,0,0,1,0,135,254,109,4,14,
+4,74,0,29,0,72,64,37,10,10,13,6,31,25,22,15,73,29,29,9,13,71,4,2,0,22,25,
+80,21,18,12,2,79,9,3,3,13,8,80,5,15,13,81,0,21,0,63,225,63,225,18,57,47,51,
+225,50,47,51,225,50,1,47,206,51,225,50,50,47,225,206,47,16,206,17,57,47,48,
+49,33,17,35,53,51,17,33,21,33,17,33,21,33,17,51,17,20,6,35,34,38,39,53,22,
+22,51,50,54,53,53,1,35,156,156,2,235,253,203,1,23,254,233,156,110,126,38,
+63,22,14,59,34,46,50,1,225,137,1,224,154,254,186,137,254,197,254,217,132,
+142,17,9,150,7,14,49,49,150,255,255,0,53,254,109,4,205,5,182,2,38,0,59,0,
+0,1,7,3,128,1,180,0,0,0,23,182,1,1,0,21,176,21,2,184,1,180,180,21,12,4,0,
+37,1,43,93,53,0,53,0,255,255,0,96,254,109,4,119,4,74,2,38,0,91,0,0,1,7,3,
+129,1,94,0,0,0,30,181,1,1,80,21,1,21,184,255,192,178,9,12,54,184,1,94,180,
+21,12,11,7,37,1,43,43,93,53,0,53,0,1,0,53,0,0,4,150,5,182,0,17,0,164,185,
+0,11,255,248,64,23,12,15,72,6,11,22,11,38,11,3,13,8,12,15,72,9,13,25,13,41,
+13,3,4,184,255,248,64,32,12,15,72,6,4,22,4,38,4,3,2,8,12,15,72,9,2,25,2,41,
+2,3,15,9,6,3,0,12,12,14,11,10,184,255,240,64,10,10,10,5,7,17,7,17,1,4,5,184,
+255,240,64,25,5,13,14,16,14,14,2,1,16,1,3,0,7,95,15,12,8,8,1,13,10,3,5,1,
+18,0,63,51,63,51,18,57,47,51,51,225,50,50,1,47,56,51,51,47,56,51,47,56,51,
+18,57,57,47,47,17,51,47,56,51,18,57,17,51,51,51,51,51,93,43,93,43,93,43,93,
+43,48,49,1,1,35,1,1,35,1,33,53,33,1,51,1,1,51,1,33,21,2,250,1,156,211,254,
+157,254,146,189,1,154,254,223,1,21,254,145,199,1,75,1,78,191,254,141,1,29,
+2,180,253,76,2,123,253,133,2,180,162,2,96,253,209,2,47,253,160,162,0,1,0,
+96,0,0,4,106,4,74,0,17,0,194,183,196,14,212,14,228,14,3,14,184,255,240,64,
+36,11,14,72,203,12,219,12,235,12,3,12,16,11,14,72,203,5,219,5,235,5,3,5,16,
+11,14,72,196,3,212,3,228,3,3,6,3,184,255,240,64,20,11,14,72,73,13,1,13,16,
+18,23,72,10,13,26,13,2,70,4,1,4,184,255,240,64,55,18,23,72,5,4,21,4,2,17,
+9,17,9,15,11,16,13,10,7,1,4,4,6,3,2,2,14,31,15,1,15,5,6,6,12,0,11,16,11,2,
+11,13,10,17,79,7,4,0,0,2,15,11,21,5,2,15,0,63,51,63,51,18,57,47,51,51,225,
+50,50,1,47,93,51,51,47,51,47,93,51,51,47,51,18,57,17,51,51,51,51,51,17,18,
+57,57,47,47,48,49,0,93,43,93,93,43,93,1,43,95,93,43,93,43,93,43,93,19,33,
+1,51,1,1,51,1,33,21,33,1,35,1,1,35,1,33,166,1,41,254,166,207,1,34,1,35,207,
+254,164,1,45,254,207,1,114,206,254,202,254,201,207,1,115,254,211,2,123,1,
+207,254,102,1,154,254,49,137,254,14,1,180,254,76,1,242,0,2,0,137,0,0,3,246,
+5,182,0,14,0,25,0,42,64,22,6,25,90,9,27,21,91,0,0,1,0,16,95,5,5,7,24,96,10,
+18,7,3,0,63,63,225,17,57,47,225,1,47,93,225,16,222,225,50,48,49,19,52,62,
+2,51,51,17,51,17,33,34,46,2,1,35,34,14,2,21,20,22,51,51,137,55,127,207,152,
+149,187,254,149,133,194,126,61,2,178,129,93,138,91,46,163,175,159,1,172,87,
+152,113,66,2,104,250,74,61,112,158,1,95,27,60,97,70,136,132,0,255,255,0,137,
+255,236,4,47,6,20,2,6,0,71,0,0,0,2,0,49,255,236,4,131,5,182,0,33,0,48,0,61,
+64,33,9,24,251,21,48,48,15,32,251,15,1,63,1,2,1,50,40,90,15,35,95,33,20,20,
+22,3,27,9,43,96,6,12,19,0,63,51,225,50,50,63,57,47,51,225,1,47,225,16,222,
+93,225,17,57,47,51,225,57,49,48,1,17,20,14,2,35,34,38,39,6,6,35,34,38,53,
+52,62,2,51,51,17,51,17,20,22,51,50,62,2,53,17,5,35,34,14,2,21,20,22,51,50,
+62,2,53,4,131,30,67,109,79,92,109,34,35,122,97,165,167,49,104,161,112,82,
+174,65,68,30,44,29,14,254,88,80,66,94,60,28,78,94,48,60,35,13,3,80,254,24,
+84,140,101,55,87,87,79,93,209,215,103,163,114,60,2,104,251,178,114,103,23,
+51,83,60,1,232,166,30,67,107,77,128,130,35,60,79,43,0,0,2,0,49,255,236,4,
+131,6,20,0,44,0,61,0,62,64,33,14,40,70,37,50,50,23,3,70,15,6,1,6,63,59,70,
+23,31,56,80,28,16,4,4,38,0,14,0,45,80,11,20,22,0,63,51,225,50,50,63,57,47,
+63,225,50,1,47,225,16,222,93,225,17,57,47,51,225,57,48,49,37,50,54,53,17,
+51,17,20,14,2,35,34,38,39,35,14,3,35,34,2,17,52,62,2,51,50,22,23,51,38,39,
+38,38,53,17,51,17,20,30,2,33,50,62,2,55,53,52,46,2,35,34,6,21,20,22,3,88,
+66,59,174,34,68,101,67,110,129,34,4,19,43,60,83,59,154,141,42,77,107,65,82,
+104,31,8,2,2,2,2,174,9,26,50,254,85,46,63,39,19,1,17,39,64,48,83,77,77,131,
+124,130,1,59,254,193,105,152,98,46,99,103,41,74,55,32,1,30,1,25,141,214,144,
+72,74,65,34,31,26,55,16,1,159,251,146,61,107,78,45,46,94,141,94,41,101,157,
+107,55,217,205,209,205,0,1,0,35,255,236,4,84,5,203,0,57,0,80,64,42,37,251,
+0,0,31,26,251,11,11,18,45,251,15,48,1,48,59,17,18,6,6,18,31,6,97,7,46,46,
+7,7,21,42,95,53,19,18,17,17,14,96,21,4,0,63,225,50,17,51,63,225,17,57,47,
+51,47,16,225,57,1,47,51,47,17,51,16,222,93,225,17,57,47,225,51,51,47,225,
+48,49,1,52,46,2,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,30,2,
+21,20,14,2,7,21,30,3,21,20,30,2,51,50,54,53,17,51,17,20,14,2,35,34,46,2,1,
+254,16,42,72,56,156,156,83,91,88,86,60,94,53,82,65,151,103,81,121,79,39,30,
+56,80,49,57,84,56,28,14,31,47,33,66,59,174,40,77,109,69,69,112,79,43,1,135,
+77,109,70,33,151,134,125,124,115,33,41,117,54,57,54,97,133,79,73,116,85,58,
+16,6,13,51,83,121,84,74,103,65,29,115,133,1,201,254,45,107,152,97,45,38,94,
+159,0,1,0,43,255,236,4,94,4,92,0,57,0,71,64,37,37,26,70,31,0,11,11,18,45,
+70,15,48,1,48,59,17,18,6,6,18,31,6,80,46,7,7,21,42,81,53,22,17,14,78,18,21,
+16,0,63,51,225,50,63,225,17,57,47,196,225,57,1,47,51,47,17,51,16,222,93,225,
+17,57,47,51,51,225,50,48,49,1,46,3,35,35,53,51,50,54,53,52,38,35,34,6,7,39,
+54,54,51,50,30,2,21,20,14,2,7,21,30,3,23,30,3,51,50,54,53,17,51,17,20,14,
+2,35,34,46,2,2,10,3,18,41,70,56,139,139,83,91,75,87,66,113,63,61,65,156,101,
+81,120,79,39,30,56,80,49,53,81,56,31,4,3,15,29,45,33,66,59,174,40,76,110,
+69,69,107,76,43,1,27,56,80,51,24,153,86,80,82,74,36,32,141,36,38,42,73,100,
+57,55,86,64,43,14,4,6,30,56,85,61,54,75,47,21,115,133,1,53,254,193,107,152,
+97,45,28,69,117,0,1,0,39,254,127,4,117,5,203,0,49,0,80,64,43,1,90,46,46,49,
+39,15,91,34,34,49,251,0,47,80,47,2,47,23,24,8,8,24,24,23,23,20,96,29,39,8,
+97,9,9,29,4,46,95,1,48,48,1,18,0,63,51,47,16,225,63,57,47,225,57,16,225,50,
+17,51,1,47,51,47,17,51,47,93,225,50,47,225,50,17,51,47,225,49,48,33,35,17,
+52,46,2,35,35,53,51,50,62,2,53,52,46,2,35,34,6,7,39,62,3,51,50,30,2,21,20,
+14,2,7,21,30,3,21,21,51,17,35,3,197,187,56,103,149,93,191,176,92,142,97,50,
+37,68,95,58,110,169,75,92,38,98,116,131,72,109,166,112,57,51,91,125,75,87,
+138,94,50,176,176,1,160,68,99,65,32,151,39,72,101,61,54,83,58,30,67,54,125,
+31,54,41,24,54,97,133,79,73,120,88,57,12,6,11,57,89,119,72,250,253,217,0,
+0,1,0,80,254,131,4,92,4,94,0,47,0,78,64,41,36,14,70,31,31,0,71,43,43,47,70,
+44,49,22,23,8,8,23,23,48,22,17,80,26,36,7,80,48,8,1,8,8,23,26,16,45,45,43,
+80,0,21,0,63,225,51,47,63,51,57,47,93,225,57,16,225,50,17,1,51,47,51,47,17,
+51,16,222,225,50,47,225,51,47,225,50,48,49,33,17,52,46,2,35,35,53,51,50,62,
+2,53,52,38,35,34,14,2,7,39,54,54,51,50,30,2,21,20,14,2,7,21,30,3,21,21,51,
+17,35,17,3,6,27,62,102,75,236,203,62,100,72,39,140,131,47,82,80,80,45,63,
+93,201,115,99,160,113,61,28,51,71,43,54,84,58,31,160,176,1,43,47,73,49,26,
+153,18,39,64,45,77,77,10,18,27,17,147,39,37,36,72,106,70,53,81,59,41,14,11,
+13,44,66,91,62,145,253,233,1,125,0,1,0,0,255,236,4,131,5,182,0,48,0,83,64,
+46,22,13,27,250,1,29,251,48,6,13,0,1,16,1,2,1,48,1,48,13,35,251,15,38,1,38,
+50,13,32,95,43,19,36,36,17,1,95,27,3,14,14,17,96,13,11,19,0,63,51,225,50,
+47,63,225,18,57,47,63,225,1,47,16,222,93,225,17,57,57,47,47,93,18,57,16,225,
+16,237,17,57,48,49,1,35,14,3,7,14,3,35,34,39,53,22,22,51,50,62,2,55,54,54,
+18,18,55,33,17,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,2,45,164,
+9,20,21,19,9,10,27,48,78,62,51,39,14,26,17,25,31,21,14,6,7,19,23,26,15,1,
+231,59,66,68,57,174,42,78,109,68,67,110,80,44,5,18,116,245,234,210,81,103,
+161,110,58,22,154,8,9,60,93,113,54,59,196,1,2,1,57,177,251,209,129,119,119,
+129,1,201,254,45,105,152,98,46,44,96,153,108,0,1,0,0,255,236,4,131,4,74,0,
+41,0,73,64,40,20,73,1,22,70,41,0,1,16,1,2,1,41,1,41,11,28,70,15,31,1,31,43,
+11,29,29,15,1,80,20,15,25,12,12,15,79,36,11,8,22,0,63,51,51,225,50,17,51,
+63,225,18,57,47,1,47,16,222,93,225,17,57,57,47,47,93,16,225,16,225,49,48,
+1,35,6,2,14,3,35,34,38,39,53,22,22,51,50,54,54,18,55,33,17,20,22,51,50,54,
+53,17,51,17,20,14,2,35,34,46,2,53,2,45,174,10,29,38,48,58,69,41,26,49,15,
+8,17,8,37,61,48,37,13,1,246,55,72,65,58,174,36,73,110,74,71,113,79,42,3,176,
+186,254,226,213,145,89,39,6,6,131,3,3,117,241,1,111,250,253,61,135,125,123,
+137,1,53,254,193,105,152,98,46,37,87,142,104,0,1,0,121,255,236,4,131,5,182,
+0,29,0,72,64,42,27,0,251,19,19,23,6,251,56,9,1,15,9,1,9,31,26,22,251,71,23,
+1,0,23,16,23,2,23,21,95,7,26,26,28,24,3,23,18,3,95,14,19,0,63,225,63,63,51,
+57,47,51,225,1,47,93,93,225,50,16,222,93,93,225,17,57,47,225,51,48,49,1,20,
+22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,33,17,35,17,51,17,33,17,
+51,2,219,62,69,69,58,166,37,74,111,75,75,110,72,36,254,234,166,166,1,22,166,
+1,135,129,119,119,129,1,201,254,45,105,152,98,46,44,96,153,108,1,45,253,86,
+5,182,253,152,2,104,0,1,0,123,255,236,4,123,4,74,0,29,0,80,64,49,5,73,2,71,
+24,87,24,2,24,24,28,11,73,72,14,88,14,168,14,3,15,14,1,14,31,1,27,73,0,28,
+16,28,2,28,28,21,26,80,12,1,1,0,8,80,19,22,3,0,15,0,63,50,63,225,17,57,47,
+196,225,63,1,47,93,225,50,16,222,93,93,225,17,57,47,93,51,225,48,49,1,17,
+33,17,51,17,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,53,33,17,35,
+17,1,29,1,34,162,55,72,63,58,162,35,70,105,71,67,108,76,40,254,222,162,4,
+74,254,57,1,199,253,61,131,129,130,130,1,53,254,193,105,152,98,46,37,87,142,
+104,139,254,23,4,74,0,1,0,117,255,236,4,111,5,203,0,40,0,73,64,42,40,40,12,
+39,90,2,21,20,20,2,42,29,91,0,12,1,12,21,24,95,17,40,95,47,0,95,0,2,0,64,
+16,24,72,0,0,20,17,4,34,95,7,19,0,63,225,63,51,57,47,43,93,225,16,225,50,
+1,47,93,225,16,206,50,47,51,16,225,17,57,47,48,49,1,33,21,20,14,2,35,34,38,
+38,2,53,52,18,54,54,51,50,22,23,7,38,38,35,34,14,2,21,20,30,2,51,50,62,2,
+53,33,2,160,1,207,52,111,173,121,138,210,141,72,80,151,216,136,115,181,75,
+72,58,153,94,86,140,100,55,45,89,132,87,82,109,66,27,254,234,2,246,142,167,
+241,155,73,105,195,1,23,174,172,1,22,195,105,44,42,162,34,50,81,152,218,137,
+132,217,154,85,55,111,170,115,0,0,1,0,113,255,236,4,92,4,94,0,40,0,65,64,
+35,40,40,12,1,21,63,20,1,20,20,39,71,1,42,29,72,0,12,1,12,21,24,78,17,40,
+80,0,0,20,17,16,34,78,7,22,0,63,225,63,51,57,47,225,16,225,50,1,47,93,225,
+16,222,225,51,47,93,51,17,18,57,47,48,49,1,33,21,20,14,2,35,34,46,2,53,52,
+62,2,51,50,22,23,7,38,38,35,34,14,2,21,20,30,2,51,50,62,2,53,33,2,123,1,225,
+50,113,179,129,135,200,132,65,71,140,208,138,111,172,77,61,60,148,91,91,139,
+92,47,37,83,132,94,81,110,66,28,254,215,2,74,68,130,200,137,71,79,147,211,
+132,131,210,148,80,37,39,145,29,45,58,109,157,98,93,155,112,62,45,80,113,
+67,0,0,1,0,20,255,236,4,131,5,182,0,25,0,64,64,38,6,90,15,9,1,9,27,48,24,
+1,24,24,0,90,159,21,1,21,48,19,128,19,144,19,3,19,25,21,95,22,7,7,22,3,3,
+95,14,19,0,63,225,63,57,47,16,225,50,1,47,93,206,93,241,202,47,93,16,222,
+93,225,48,49,1,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,33,53,
+33,21,33,2,113,82,92,92,82,182,50,93,132,81,80,133,95,53,254,94,3,254,254,
+95,1,135,129,119,119,129,1,201,254,45,105,152,98,46,39,93,154,115,3,149,164,
+164,0,0,1,0,41,255,236,4,111,4,74,0,27,0,60,64,35,13,71,16,29,143,3,159,3,
+2,3,3,5,71,31,0,1,0,0,26,16,26,2,26,14,14,1,10,80,21,22,4,0,80,1,15,0,63,
+225,50,63,225,17,57,47,1,47,93,206,93,241,202,47,93,16,222,225,48,49,19,53,
+33,21,33,17,20,30,2,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,41,3,53,
+254,193,21,49,80,59,105,95,183,47,95,143,96,91,146,102,55,3,176,154,154,253,
+215,65,98,65,32,130,130,1,53,254,193,105,152,98,46,46,98,150,105,2,53,0,0,
+1,0,166,255,236,4,68,5,203,0,59,0,73,64,39,28,28,49,39,39,11,10,61,21,90,
+0,0,32,91,0,49,1,49,54,29,97,159,26,1,26,26,5,38,35,96,39,44,19,11,16,96,
+10,5,4,0,63,51,225,50,63,51,225,50,17,57,47,93,225,57,1,47,93,225,51,47,225,
+16,206,50,50,47,17,57,47,48,49,19,52,62,2,51,50,30,2,23,7,46,3,35,34,14,2,
+21,20,30,2,51,51,21,35,34,6,21,20,22,51,50,54,55,21,14,3,35,34,46,2,53,52,
+62,2,55,53,46,3,211,60,115,169,109,71,123,105,90,39,93,37,77,83,91,52,57,
+95,68,38,44,87,131,87,194,190,186,208,170,164,109,203,84,42,88,99,111,64,
+128,195,131,66,50,94,137,88,75,120,84,45,4,96,79,133,97,54,24,41,54,31,125,
+27,45,31,18,30,58,83,54,61,101,72,39,151,133,135,137,142,49,43,170,19,28,
+19,9,60,111,156,96,72,123,94,61,11,6,12,57,88,120,255,255,0,201,255,236,4,
+8,4,94,2,6,1,130,0,0,255,255,0,4,255,233,4,70,5,182,2,6,1,181,0,0,255,255,
+0,31,255,242,4,16,4,74,2,6,1,213,0,0,255,255,0,33,254,152,4,172,5,188,2,38,
+0,36,0,0,1,6,2,103,0,0,0,19,64,11,2,18,20,39,2,0,15,21,4,7,37,1,43,53,0,43,
+53,0,255,255,0,135,254,152,4,2,4,94,2,38,0,68,0,0,1,6,2,103,237,0,0,19,64,
+11,2,37,23,39,2,15,34,40,8,22,37,1,43,53,0,43,53,0,255,255,0,33,0,0,4,172,
+7,225,2,38,0,36,0,0,1,7,2,102,0,33,1,82,0,19,64,11,2,21,5,38,2,33,36,15,4,
+7,37,1,43,53,0,43,53,0,255,255,0,135,255,236,4,2,6,143,2,38,0,68,0,0,1,6,
+2,102,25,0,0,19,64,11,2,40,17,38,2,59,55,34,8,22,37,1,43,53,0,43,53,0,255,
+255,0,33,0,0,4,172,7,209,2,38,0,36,0,0,1,7,3,119,0,121,1,82,0,23,64,13,3,
+2,15,5,38,3,2,120,23,38,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,135,255,
+236,4,141,6,127,2,38,0,68,0,0,1,6,3,119,125,0,0,23,64,13,3,2,34,17,38,3,2,
+158,42,57,8,22,37,1,43,53,53,0,43,53,53,0,255,255,0,33,0,0,4,172,7,209,2,
+38,0,36,0,0,1,7,3,120,255,148,1,82,0,25,182,3,2,23,5,38,3,2,184,255,148,180,
+36,22,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,85,255,236,4,2,6,127,2,38,
+0,68,0,0,1,6,3,120,153,0,0,25,182,3,2,42,17,38,3,2,184,255,187,180,55,41,
+8,22,37,1,43,53,53,0,43,53,53,0,255,255,0,33,0,0,4,172,8,74,2,38,0,36,0,0,
+1,7,3,121,0,88,1,82,0,23,64,13,3,2,15,5,38,3,2,88,23,32,4,7,37,1,43,53,53,
+0,43,53,53,0,255,255,0,135,255,236,4,76,6,248,2,38,0,68,0,0,1,6,3,121,92,
+0,0,23,64,13,3,2,34,17,38,3,2,126,42,51,8,22,37,1,43,53,53,0,43,53,53,0,255,
+255,0,33,0,0,4,172,8,98,2,38,0,36,0,0,1,7,3,122,0,8,1,82,0,23,64,13,3,2,23,
+5,38,3,2,7,41,55,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,135,255,236,4,2,
+7,16,2,38,0,68,0,0,1,6,3,122,12,0,0,23,64,13,3,2,42,17,38,3,2,45,60,74,8,
+22,37,1,43,53,53,0,43,53,53,0,255,255,0,33,254,152,4,172,7,115,2,38,0,36,
+0,0,0,39,1,75,0,0,1,82,1,6,2,103,0,0,0,34,64,22,3,34,20,39,2,15,5,38,3,0,
+31,37,4,7,37,2,0,21,15,4,7,37,1,43,53,43,53,0,43,53,43,53,255,255,0,135,254,
+152,4,2,6,33,2,38,0,68,0,0,0,38,1,75,8,0,1,6,2,103,237,0,0,34,64,22,3,53,
+23,39,2,34,17,38,3,15,50,56,8,22,37,2,42,40,34,8,22,37,1,43,53,43,53,0,43,
+53,43,53,255,255,0,33,0,0,4,172,8,19,2,38,0,36,0,0,1,7,3,123,0,0,1,82,0,23,
+64,13,3,2,32,5,38,3,2,0,35,27,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,135,
+255,236,4,2,6,193,2,38,0,68,0,0,1,6,3,123,255,0,0,23,64,13,3,2,51,17,38,3,
+2,32,54,46,8,22,37,1,43,53,53,0,43,53,53,0,255,255,0,33,0,0,4,172,8,19,2,
+38,0,36,0,0,1,7,3,124,0,0,1,82,0,23,64,13,3,2,32,5,38,3,2,0,35,27,4,7,37,
+1,43,53,53,0,43,53,53,0,255,255,0,135,255,236,4,2,6,193,2,38,0,68,0,0,1,6,
+3,124,255,0,0,23,64,13,3,2,51,17,38,3,2,32,54,46,8,22,37,1,43,53,53,0,43,
+53,53,0,255,255,0,33,0,0,4,172,8,88,2,38,0,36,0,0,1,7,3,125,0,0,1,82,0,23,
+64,13,3,2,20,5,38,3,2,0,23,15,4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,135,
+255,236,4,2,7,6,2,38,0,68,0,0,1,6,3,125,255,0,0,23,64,13,3,2,39,17,38,3,2,
+32,42,34,8,22,37,1,43,53,53,0,43,53,53,0,255,255,0,33,0,0,4,172,8,98,2,38,
+0,36,0,0,1,7,3,126,0,0,1,82,0,25,182,3,2,20,5,38,3,2,184,255,255,180,44,58,
+4,7,37,1,43,53,53,0,43,53,53,0,255,255,0,135,255,236,4,2,7,16,2,38,0,68,0,
+0,1,6,3,126,255,0,0,23,64,13,3,2,39,17,38,3,2,32,63,77,8,22,37,1,43,53,53,
+0,43,53,53,0,255,255,0,33,254,152,4,172,7,64,2,38,0,36,0,0,0,39,1,78,255,
+253,1,82,1,6,2,103,0,0,0,37,64,16,3,30,20,39,2,18,5,38,3,0,27,33,4,7,37,2,
+184,255,253,180,20,15,4,7,37,1,43,53,43,53,0,43,53,43,53,0,255,255,0,135,
+254,152,4,2,5,238,2,38,0,68,0,0,0,38,1,78,245,0,1,6,2,103,237,0,0,34,64,22,
+3,49,23,39,2,37,17,38,3,15,46,52,8,22,37,2,22,39,34,8,22,37,1,43,53,43,53,
+0,43,53,43,53,255,255,0,217,254,152,4,35,5,182,2,38,0,40,0,0,1,6,2,103,23,
+0,0,19,64,11,1,15,20,39,1,0,12,18,1,0,37,1,43,53,0,43,53,0,255,255,0,133,
+254,152,4,72,4,94,2,38,0,72,0,0,1,6,2,103,23,0,0,19,64,11,2,26,23,39,2,23,
+23,29,11,0,37,1,43,53,0,43,53,0,255,255,0,217,0,0,4,35,7,225,2,38,0,40,0,
+0,1,7,2,102,0,39,1,82,0,19,64,11,1,18,5,38,1,15,33,12,1,0,37,1,43,53,0,43,
+53,0,255,255,0,133,255,236,4,72,6,143,2,38,0,72,0,0,1,6,2,102,57,0,0,19,64,
+11,2,29,17,38,2,57,44,23,11,0,37,1,43,53,0,43,53,0,255,255,0,217,0,0,4,35,
+7,53,2,38,0,40,0,0,1,7,1,82,0,25,1,82,0,19,64,11,1,12,5,38,1,0,13,22,1,0,
+37,1,43,53,0,43,53,0,255,255,0,133,255,236,4,72,5,227,2,38,0,72,0,0,1,6,1,
+82,33,0,0,19,64,11,2,23,17,38,2,32,24,33,11,0,37,1,43,53,0,43,53,0,255,255,
+0,217,0,0,4,145,7,209,2,38,0,40,0,0,1,7,3,119,0,129,1,82,0,23,64,13,2,1,12,
+5,38,2,1,105,20,35,1,0,37,1,43,53,53,0,43,53,53,0,255,255,0,133,255,236,4,
+133,6,127,2,38,0,72,0,0,1,6,3,119,117,0,0,23,64,13,3,2,23,17,38,3,2,116,31,
+46,11,0,37,1,43,53,53,0,43,53,53,0,255,255,0,89,0,0,4,35,7,209,2,38,0,40,
+0,0,1,7,3,120,255,157,1,82,0,25,182,2,1,20,5,38,2,1,184,255,133,180,33,19,
+1,0,37,1,43,53,53,0,43,53,53,0,255,255,0,76,255,236,4,72,6,127,2,38,0,72,
+0,0,1,6,3,120,144,0,0,25,182,3,2,31,17,38,3,2,184,255,144,180,44,30,11,0,
+37,1,43,53,53,0,43,53,53,0,255,255,0,217,0,0,4,80,8,74,2,38,0,40,0,0,1,7,
+3,121,0,96,1,82,0,23,64,13,2,1,12,5,38,2,1,72,20,29,1,0,37,1,43,53,53,0,43,
+53,53,0,255,255,0,133,255,236,4,72,6,248,2,38,0,72,0,0,1,6,3,121,84,0,0,23,
+64,13,3,2,23,17,38,3,2,84,31,40,11,0,37,1,43,53,53,0,43,53,53,0,255,255,0,
+217,0,0,4,35,8,98,2,38,0,40,0,0,1,7,3,122,0,16,1,82,0,25,182,2,1,20,5,38,
+2,1,184,255,248,180,38,52,1,0,37,1,43,53,53,0,43,53,53,0,255,255,0,133,255,
+236,4,72,7,16,2,38,0,72,0,0,1,6,3,122,4,0,0,23,64,13,3,2,31,17,38,3,2,3,49,
+63,11,0,37,1,43,53,53,0,43,53,53,0,255,255,0,217,254,152,4,35,7,115,2,38,
+0,40,0,0,0,39,1,75,0,35,1,82,1,6,2,103,23,0,0,34,64,22,2,31,20,39,1,12,5,
+38,2,0,28,34,1,0,37,1,11,18,12,1,0,37,1,43,53,43,53,0,43,53,43,53,255,255,
+0,133,254,152,4,72,6,33,2,38,0,72,0,0,0,38,1,75,16,0,1,6,2,103,23,0,0,34,
+64,22,3,42,23,39,2,23,17,38,3,23,39,45,11,0,37,2,16,29,23,11,0,37,1,43,53,
+43,53,0,43,53,43,53,255,255,0,225,0,0,3,233,7,225,2,38,0,44,0,0,1,7,2,102,
+0,31,1,82,0,19,64,11,1,18,5,38,1,32,33,12,1,0,37,1,43,53,0,43,53,0,255,255,
+0,197,0,0,4,51,6,143,2,38,0,243,0,0,1,6,2,102,47,0,0,19,64,11,1,16,17,38,
+1,25,31,10,7,5,37,1,43,53,0,43,53,0,255,255,0,225,254,152,3,233,5,182,2,38,
+0,44,0,0,1,6,2,103,0,0,0,19,64,11,1,15,20,39,1,1,12,18,1,0,37,1,43,53,0,43,
+53,0,255,255,0,197,254,152,4,51,6,14,2,38,0,76,0,0,1,6,2,103,20,0,0,21,180,
+2,22,23,39,2,184,255,255,180,19,25,16,14,37,1,43,53,0,43,53,0,255,255,0,84,
+254,152,4,123,5,205,2,38,0,50,0,0,1,6,2,103,0,0,0,21,180,2,23,20,39,2,184,
+255,255,180,20,26,2,7,37,1,43,53,0,43,53,0,255,255,0,115,254,152,4,88,4,94,
+2,38,0,82,0,0,1,6,2,103,0,0,0,19,64,11,2,23,23,39,2,1,20,26,3,9,37,1,43,53,
+0,43,53,0,255,255,0,84,255,236,4,123,7,225,2,38,0,50,0,0,1,7,2,102,0,23,1,
+82,0,19,64,11,2,26,5,38,2,22,41,20,2,7,37,1,43,53,0,43,53,0,255,255,0,115,
+255,236,4,88,6,143,2,38,0,82,0,0,1,6,2,102,31,0,0,19,64,11,2,26,17,38,2,32,
+41,20,3,9,37,1,43,53,0,43,53,0,255,255,0,84,255,236,4,131,7,209,2,38,0,50,
+0,0,1,7,3,119,0,115,1,82,0,23,64,13,3,2,20,5,38,3,2,113,28,43,2,7,37,1,43,
+53,53,0,43,53,53,0,255,255,0,115,255,236,4,131,6,127,2,38,0,82,0,0,1,6,3,
+119,115,0,0,23,64,13,3,2,20,17,38,3,2,115,28,43,3,9,37,1,43,53,53,0,43,53,
+53,0,255,255,0,74,255,236,4,123,7,209,2,38,0,50,0,0,1,7,3,120,255,142,1,82,
+0,25,182,3,2,28,5,38,3,2,184,255,141,180,41,27,2,7,37,1,43,53,53,0,43,53,
+53,0,255,255,0,74,255,236,4,88,6,127,2,38,0,82,0,0,1,6,3,120,142,0,0,25,182,
+3,2,28,17,38,3,2,184,255,143,180,41,27,3,9,37,1,43,53,53,0,43,53,53,0,255,
+255,0,84,255,236,4,123,8,74,2,38,0,50,0,0,1,7,3,121,0,82,1,82,0,23,64,13,
+3,2,20,5,38,3,2,81,28,37,2,7,37,1,43,53,53,0,43,53,53,0,255,255,0,115,255,
+236,4,88,6,248,2,38,0,82,0,0,1,6,3,121,82,0,0,23,64,13,3,2,20,17,38,3,2,83,
+28,37,3,9,37,1,43,53,53,0,43,53,53,0,255,255,0,84,255,236,4,123,8,98,2,38,
+0,50,0,0,1,7,3,122,0,2,1,82,0,23,64,13,3,2,28,5,38,3,2,0,46,60,2,7,37,1,43,
+53,53,0,43,53,53,0,255,255,0,115,255,236,4,88,7,16,2,38,0,82,0,0,1,6,3,122,
+2,0,0,23,64,13,3,2,28,17,38,3,2,2,46,60,3,9,37,1,43,53,53,0,43,53,53,0,255,
+255,0,84,254,152,4,123,7,115,2,38,0,50,0,0,0,39,1,75,0,0,1,82,1,6,2,103,0,
+0,0,40,64,9,3,39,20,39,2,20,5,38,3,184,255,255,181,36,42,2,7,37,2,184,255,
+255,180,26,20,2,7,37,1,43,53,43,53,0,43,53,43,53,255,255,0,115,254,152,4,
+88,6,33,2,38,0,82,0,0,0,38,1,75,0,0,1,6,2,103,0,0,0,34,64,22,3,39,23,39,2,
+20,17,38,3,1,36,42,3,9,37,2,1,26,20,3,9,37,1,43,53,43,53,0,43,53,43,53,255,
+255,0,84,255,236,4,246,7,115,2,38,2,95,0,0,1,7,0,118,0,90,1,82,0,19,64,11,
+2,59,5,38,2,27,53,56,10,25,37,1,43,53,0,43,53,0,255,255,0,115,255,236,4,246,
+6,33,2,38,2,96,0,0,1,6,0,118,80,0,0,14,183,2,2,2,44,47,10,25,37,1,43,53,0,
+53,255,255,0,84,255,236,4,246,7,115,2,38,2,95,0,0,1,7,0,67,255,175,1,82,0,
+21,180,2,53,5,38,2,184,255,113,180,56,53,10,25,37,1,43,53,0,43,53,0,255,255,
+0,115,255,236,4,246,6,33,2,38,2,96,0,0,1,6,0,67,216,0,0,17,177,2,2,184,255,
+138,180,47,44,10,25,37,1,43,53,0,53,0,255,255,0,84,255,236,4,246,7,225,2,
+38,2,95,0,0,1,7,2,102,0,23,1,82,0,21,180,2,60,5,38,2,184,255,217,180,74,53,
+10,25,37,1,43,53,0,43,53,0,255,255,0,115,255,236,4,246,6,143,2,38,2,96,0,
+0,1,6,2,102,31,0,0,21,180,2,51,17,38,2,184,255,209,180,65,44,10,25,37,1,43,
+53,0,43,53,0,255,255,0,84,255,236,4,246,7,53,2,38,2,95,0,0,1,7,1,82,0,8,1,
+82,0,21,180,2,53,5,38,2,184,255,201,180,54,63,10,25,37,1,43,53,0,43,53,0,
+255,255,0,115,255,236,4,246,5,227,2,38,2,96,0,0,1,6,1,82,0,0,0,17,177,2,2,
+184,255,177,180,45,54,10,25,37,1,43,53,0,53,0,255,255,0,84,254,152,4,246,
+6,20,2,38,2,95,0,0,1,6,2,103,0,0,0,21,180,2,56,20,39,2,184,255,194,180,53,
+59,10,25,37,1,43,53,0,43,53,0,255,255,0,115,254,152,4,246,4,242,2,38,2,96,
+0,0,1,6,2,103,0,0,0,21,180,2,47,23,39,2,184,255,178,180,44,50,10,25,37,1,
+43,53,0,43,53,0,255,255,0,125,254,152,4,80,5,184,2,38,0,56,0,0,1,6,2,103,
+0,0,0,19,64,11,1,18,20,39,1,0,15,21,6,0,37,1,43,53,0,43,53,0,255,255,0,160,
+254,152,4,45,4,74,2,38,0,88,0,0,1,6,2,103,0,0,0,19,64,11,1,21,23,39,1,0,18,
+24,6,16,37,1,43,53,0,43,53,0,255,255,0,125,255,236,4,80,7,225,2,38,0,56,0,
+0,1,7,2,102,0,23,1,82,0,19,64,11,1,21,5,38,1,23,36,15,6,0,37,1,43,53,0,43,
+53,0,255,255,0,160,255,236,4,45,6,143,2,38,0,88,0,0,1,6,2,102,29,0,0,19,64,
+11,1,24,17,38,1,29,39,18,6,16,37,1,43,53,0,43,53,0,255,255,0,125,255,236,
+5,23,7,115,2,38,2,97,0,0,1,7,0,118,255,255,1,82,0,21,180,1,45,5,38,1,184,
+255,156,180,39,42,24,8,37,1,43,53,0,43,53,0,255,255,0,160,255,236,5,23,6,
+33,2,38,2,98,0,0,1,6,0,118,255,0,0,17,177,1,1,184,255,138,180,40,43,12,33,
+37,1,43,53,0,53,0,255,255,0,125,255,236,5,23,7,115,2,38,2,97,0,0,1,7,0,67,
+255,110,1,82,0,21,180,1,39,5,38,1,184,255,11,180,42,39,24,8,37,1,43,53,0,
+43,53,0,255,255,0,160,255,236,5,23,6,33,2,38,2,98,0,0,1,7,0,67,255,107,0,
+0,0,17,177,1,1,184,254,246,180,43,40,12,33,37,1,43,53,0,53,0,255,255,0,125,
+255,236,5,23,7,225,2,38,2,97,0,0,1,7,2,102,255,218,1,82,0,21,180,1,46,5,38,
+1,184,255,119,180,60,39,24,8,37,1,43,53,0,43,53,0,255,255,0,160,255,236,5,
+23,6,143,2,38,2,98,0,0,1,6,2,102,226,0,0,21,180,1,46,17,38,1,184,255,109,
+180,61,40,12,33,37,1,43,53,0,43,53,0,255,255,0,125,255,236,5,23,7,53,2,38,
+2,97,0,0,1,7,1,82,255,198,1,82,0,19,64,11,1,39,5,38,1,36,40,49,24,14,37,1,
+43,53,0,43,53,0,255,255,0,160,255,236,5,23,5,227,2,38,2,98,0,0,1,6,1,82,206,
+0,0,14,183,1,1,33,41,50,12,39,37,1,43,53,0,53,255,255,0,125,254,152,5,23,
+6,20,2,38,2,97,0,0,1,6,2,103,185,0,0,21,180,1,42,20,39,1,184,255,86,180,39,
+45,24,8,37,1,43,53,0,43,53,0,255,255,0,160,254,152,5,23,4,242,2,38,2,98,0,
+0,1,6,2,103,189,0,0,21,180,1,43,23,39,1,184,255,72,180,40,46,12,33,37,1,43,
+53,0,43,53,0,255,255,0,33,254,152,4,170,5,182,2,38,0,60,0,0,1,6,2,103,255,
+0,0,19,64,11,1,12,20,39,1,0,9,15,7,2,37,1,43,53,0,43,53,0,255,255,0,82,254,
+20,4,121,4,74,2,38,0,92,0,0,1,7,2,103,1,47,0,0,0,17,177,1,1,184,1,48,180,
+23,29,0,9,37,1,43,53,0,53,0,255,255,0,33,0,0,4,170,7,225,2,38,0,60,0,0,1,
+7,2,102,0,20,1,82,0,19,64,11,1,15,5,38,1,21,30,9,7,2,37,1,43,53,0,43,53,0,
+255,255,0,82,254,20,4,121,6,143,2,38,0,92,0,0,1,6,2,102,20,0,0,19,64,11,1,
+29,17,38,1,21,44,23,0,9,37,1,43,53,0,43,53,0,255,255,0,33,0,0,4,170,7,53,
+2,38,0,60,0,0,1,7,1,82,0,12,1,82,0,19,64,11,1,9,5,38,1,12,10,19,7,2,37,1,
+43,53,0,43,53,0,255,255,0,82,254,20,4,121,5,227,2,38,0,92,0,0,1,6,1,82,12,
+0,0,19,64,11,1,23,17,38,1,12,24,33,0,9,37,1,43,53,0,43,53,0,0,3,0,137,254,
+188,4,203,6,20,0,3,0,43,0,60,0,118,64,71,33,33,15,50,43,35,26,4,32,71,39,
+41,37,3,3,144,41,160,41,2,41,62,58,72,15,2,2,0,15,224,15,240,15,3,15,43,21,
+41,32,79,38,35,35,20,36,0,25,55,80,0,20,16,20,32,20,176,20,192,20,5,20,15,
+4,44,80,10,1,78,2,10,22,0,63,222,225,16,225,50,63,93,225,50,63,18,57,47,51,
+225,50,63,1,47,93,51,47,16,225,16,206,93,50,47,50,16,205,225,50,50,50,50,
+50,17,57,47,48,49,1,33,53,33,3,35,14,3,35,34,46,2,53,52,62,2,51,50,30,2,23,
+51,38,39,38,38,53,53,33,53,33,53,51,21,51,21,35,17,35,37,50,62,2,55,53,52,
+46,2,35,34,6,21,20,22,4,47,252,152,3,104,174,8,23,61,78,98,62,97,158,113,
+62,62,113,158,97,61,98,79,61,23,12,3,3,2,4,254,133,1,123,182,156,156,147,
+254,188,79,109,67,32,2,28,68,111,84,140,132,132,254,188,140,1,75,34,61,46,
+26,70,138,204,134,135,206,139,71,25,44,58,32,33,31,26,55,16,158,137,182,182,
+137,251,43,131,44,89,133,90,39,97,149,102,52,206,196,198,195,0,2,0,205,4,
+217,3,172,6,33,0,13,0,27,0,48,64,24,15,130,14,14,20,1,130,0,0,8,133,95,6,
+1,6,6,22,133,20,21,7,128,15,0,0,47,50,26,205,50,1,47,225,51,47,93,225,51,
+47,225,17,51,47,225,48,49,1,35,46,3,39,53,51,30,3,23,5,35,46,3,39,53,51,30,
+3,23,3,172,100,34,82,77,64,16,199,16,43,46,48,21,254,150,101,34,82,77,63,
+16,198,16,43,46,48,22,4,217,28,83,88,81,27,21,34,81,81,76,29,27,28,83,88,
+81,27,21,34,81,81,76,29,0,0,2,0,188,4,217,4,16,6,127,0,16,0,28,0,68,64,35,
+22,136,23,23,27,130,63,28,79,28,111,28,3,28,28,13,13,12,4,4,8,1,0,0,7,8,22,
+128,27,64,4,12,128,7,0,0,47,50,26,205,50,26,222,26,205,1,47,51,51,47,51,18,
+57,17,51,51,17,51,47,93,225,51,47,225,48,49,1,35,38,38,39,6,6,7,35,53,54,
+54,55,51,22,22,23,39,62,3,55,51,21,6,6,7,35,3,43,100,51,108,52,54,106,51,
+101,51,116,48,193,48,116,51,78,20,32,30,29,16,180,45,106,55,101,4,217,34,
+84,48,48,84,34,27,59,132,69,69,132,59,194,26,44,46,52,33,21,60,103,43,0,2,
+0,188,4,217,4,16,6,127,0,16,0,28,0,68,64,35,23,136,22,64,18,130,48,17,64,
+17,96,17,3,17,17,3,3,4,12,12,16,9,8,8,15,16,23,128,18,64,12,3,128,9,15,0,
+47,51,26,205,50,26,220,26,205,1,47,51,51,47,51,18,57,17,51,51,17,51,47,93,
+225,26,221,225,48,49,1,54,54,55,51,22,22,23,21,35,38,38,39,6,6,7,35,55,35,
+38,38,39,53,51,30,3,23,1,162,51,116,48,192,48,116,51,100,51,106,54,53,107,
+51,100,78,101,55,107,45,181,16,29,29,33,20,4,244,59,132,69,69,132,59,27,34,
+84,48,48,84,34,195,43,103,60,21,33,52,46,44,26,0,2,0,221,4,217,3,240,6,248,
+0,16,0,41,0,95,64,52,23,130,24,24,36,28,130,15,17,31,17,2,17,17,15,36,31,
+36,2,36,64,12,15,72,36,36,13,13,12,4,4,8,1,0,0,7,8,22,25,25,24,33,140,39,
+39,24,64,4,12,128,1,7,0,47,51,26,205,50,26,204,50,47,237,18,57,47,51,1,47,
+51,51,47,51,18,57,17,51,51,17,51,47,43,93,51,47,93,225,17,57,47,225,48,49,
+1,35,38,38,39,6,6,7,35,53,54,54,55,51,22,22,23,19,20,14,2,7,7,35,39,54,54,
+53,52,46,2,35,34,6,7,53,54,51,50,22,3,76,101,51,107,53,54,105,51,101,51,116,
+48,193,48,116,51,164,20,35,45,25,6,86,11,56,65,15,27,37,21,22,39,11,21,59,
+99,100,4,217,34,84,48,48,84,34,27,59,132,69,69,132,59,1,118,29,43,30,21,6,
+81,131,9,31,37,19,24,14,5,3,3,82,6,69,0,0,2,1,35,4,217,3,168,7,16,0,16,0,
+44,0,102,64,36,20,26,39,130,40,34,25,40,4,3,12,12,16,9,8,8,15,40,31,40,47,
+40,3,40,40,25,130,26,15,16,16,26,39,39,31,31,184,1,1,179,22,25,64,36,184,
+1,1,183,17,17,25,12,3,128,9,15,0,47,51,26,221,50,198,50,47,225,26,16,218,
+225,47,50,47,1,47,51,47,51,16,237,51,47,93,51,47,51,18,57,17,51,51,17,18,
+57,16,237,17,57,49,48,1,54,54,55,51,22,22,23,21,35,38,38,39,6,6,7,35,1,34,
+46,2,35,34,6,7,35,62,3,51,50,30,2,51,50,54,55,51,14,3,1,45,51,116,48,193,
+48,116,51,101,51,106,54,52,108,51,100,1,191,36,72,69,63,29,40,42,14,92,5,
+28,48,66,41,38,74,69,62,26,40,42,14,92,4,29,48,66,4,244,59,132,69,69,132,
+59,27,34,84,48,48,84,34,1,90,28,34,28,42,50,48,81,59,33,28,34,28,43,49,48,
+81,59,33,0,2,1,57,4,217,3,147,6,193,0,11,0,31,0,45,64,22,0,11,1,11,64,7,31,
+131,12,12,21,131,20,5,128,11,11,31,20,26,143,17,0,47,253,204,50,50,47,26,
+204,1,47,225,51,47,225,214,26,205,93,48,49,1,62,3,55,51,21,6,6,7,35,37,14,
+3,35,34,38,39,51,30,3,51,50,62,2,55,2,37,20,32,30,29,16,180,45,106,56,100,
+1,110,4,44,76,110,71,146,144,7,109,4,27,48,68,43,36,66,51,34,4,5,248,25,44,
+46,53,33,21,60,103,44,6,60,99,69,38,139,127,43,49,26,7,9,27,49,40,0,0,2,1,
+57,4,217,3,147,6,193,0,11,0,31,0,47,64,23,31,131,12,12,20,15,0,1,0,64,4,21,
+131,20,5,128,1,1,31,20,26,143,17,0,47,253,204,50,50,47,26,205,1,47,225,214,
+26,205,93,17,51,47,225,48,49,1,35,38,38,39,53,51,30,3,23,23,14,3,35,34,38,
+39,51,30,3,51,50,62,2,55,2,152,101,56,106,45,181,16,29,29,33,20,251,4,44,
+76,110,71,146,144,7,109,4,27,48,68,43,36,66,51,34,4,5,221,44,103,60,21,33,
+53,46,44,25,21,60,99,69,38,139,127,43,49,26,7,9,27,49,40,0,2,1,57,4,217,3,
+147,7,6,0,19,0,43,0,86,64,48,26,26,27,27,37,37,31,20,64,9,12,72,20,20,0,9,
+131,8,19,131,31,0,1,0,25,28,28,27,34,140,41,128,143,27,159,27,175,27,3,27,
+27,14,19,8,8,14,143,5,0,47,241,200,47,50,16,202,47,93,26,220,225,18,57,17,
+51,1,47,93,225,47,225,18,57,47,43,193,51,47,57,47,51,47,48,49,1,14,3,35,34,
+38,39,51,30,3,51,50,62,2,55,39,20,14,2,7,7,35,39,54,54,53,52,38,35,34,6,7,
+53,54,54,51,50,22,3,147,4,44,76,110,71,146,144,7,109,4,27,48,68,43,36,66,
+51,34,4,43,20,35,45,25,6,86,11,56,65,57,43,22,39,11,11,38,31,99,100,5,227,
+60,99,69,38,139,127,43,49,26,7,9,27,49,40,150,29,43,31,20,6,41,90,9,32,37,
+37,24,3,3,82,3,3,69,0,2,1,35,4,217,3,168,7,16,0,19,0,47,0,88,64,24,25,34,
+20,39,34,39,43,28,130,29,29,9,131,8,42,130,43,43,19,131,0,42,42,34,184,1,
+1,178,25,29,39,184,1,1,64,12,64,20,20,29,8,19,19,8,128,14,143,5,0,47,225,
+26,205,50,47,16,198,50,47,26,237,16,220,237,50,47,1,47,225,51,47,225,47,225,
+51,47,225,18,57,57,17,51,17,51,49,48,1,14,3,35,34,38,39,51,30,3,51,50,62,
+2,55,39,34,46,2,35,34,6,7,35,62,3,51,50,30,2,51,50,54,55,51,14,3,3,139,4,
+44,76,110,71,146,145,6,109,4,27,48,67,44,36,65,51,34,5,47,36,72,69,63,29,
+40,42,14,92,5,28,48,66,41,38,74,69,62,26,40,42,14,92,4,29,48,66,5,227,60,
+99,69,38,139,127,43,49,26,7,9,27,49,40,80,28,34,28,42,50,48,81,59,33,28,34,
+28,43,49,48,81,59,33,0,0,1,1,199,254,66,3,6,0,0,0,20,0,34,64,18,3,15,2,31,
+2,47,2,3,2,2,14,8,132,0,18,142,11,2,0,47,47,225,1,47,237,204,51,47,93,51,
+48,49,5,52,39,51,30,3,21,20,6,35,34,38,39,53,22,22,51,50,54,2,113,140,129,
+26,57,47,30,100,101,29,63,26,14,45,25,34,52,238,106,132,19,52,64,75,42,90,
+104,8,8,113,4,5,43,0,0,1,1,178,254,109,3,25,0,166,0,17,0,24,64,10,9,1,73,
+16,10,13,80,9,6,0,0,47,47,51,225,50,1,47,225,204,48,49,37,17,14,3,35,34,38,
+39,53,22,22,51,50,54,53,17,3,25,1,26,57,89,63,38,63,22,14,59,34,46,50,166,
+254,217,66,102,70,36,17,9,150,7,14,49,49,1,60,0,0,1,1,178,254,109,3,25,0,
+154,0,17,0,24,64,10,9,1,73,16,10,13,80,9,6,0,0,47,47,51,237,50,1,47,225,204,
+48,49,37,17,14,3,35,34,38,39,53,22,22,51,50,54,53,17,3,25,1,26,57,89,63,38,
+63,22,14,59,34,46,50,154,254,229,66,102,70,36,17,9,150,7,14,49,49,1,48,0,
+255,255,0,102,254,20,4,100,5,182,2,38,0,55,0,0,1,6,0,122,0,0,0,11,182,1,25,
+16,17,1,0,37,1,43,53,0,255,255,0,139,254,20,4,2,5,111,2,38,0,87,0,0,1,6,0,
+122,40,0,0,14,185,0,1,255,197,180,21,32,5,1,37,1,43,53,0,0,0,27,1,74,0,1,
+0,0,0,0,0,0,0,52,0,0,0,1,0,0,0,0,0,1,0,15,0,52,0,1,0,0,0,0,0,2,0,7,0,67,0,
+1,0,0,0,0,0,3,0,26,0,74,0,1,0,0,0,0,0,4,0,15,0,52,0,1,0,0,0,0,0,5,0,12,0,
+100,0,1,0,0,0,0,0,6,0,13,0,112,0,1,0,0,0,0,0,7,0,78,0,125,0,1,0,0,0,0,0,8,
+0,20,0,203,0,1,0,0,0,0,0,10,0,103,0,223,0,1,0,0,0,0,0,13,0,46,1,70,0,1,0,
+0,0,0,0,14,0,42,1,116,0,1,0,0,0,0,0,18,0,15,0,52,0,3,0,1,4,9,0,0,0,104,1,
+158,0,3,0,1,4,9,0,1,0,30,2,6,0,3,0,1,4,9,0,2,0,14,2,36,0,3,0,1,4,9,0,3,0,
+52,2,50,0,3,0,1,4,9,0,4,0,30,2,6,0,3,0,1,4,9,0,5,0,44,2,102,0,3,0,1,4,9,0,
+6,0,26,2,146,0,3,0,1,4,9,0,7,0,156,2,172,0,3,0,1,4,9,0,8,0,40,3,72,0,3,0,
+1,4,9,0,10,0,206,3,112,0,3,0,1,4,9,0,11,0,56,4,62,0,3,0,1,4,9,0,12,0,92,4,
+118,0,3,0,1,4,9,0,13,0,92,4,210,0,3,0,1,4,9,0,14,0,84,5,46,68,105,103,105,
+116,105,122,101,100,32,100,97,116,97,32,99,111,112,121,114,105,103,104,116,
+32,169,32,50,48,48,55,44,32,71,111,111,103,108,101,32,67,111,114,112,111,
+114,97,116,105,111,110,46,68,114,111,105,100,32,83,97,110,115,32,77,111,110,
+111,82,101,103,117,108,97,114,65,115,99,101,110,100,101,114,32,45,32,68,114,
+111,105,100,32,83,97,110,115,32,77,111,110,111,86,101,114,115,105,111,110,
+32,49,46,48,48,68,114,111,105,100,83,97,110,115,77,111,110,111,68,114,111,
+105,100,32,105,115,32,97,32,116,114,97,100,101,109,97,114,107,32,111,102,
+32,71,111,111,103,108,101,32,97,110,100,32,109,97,121,32,98,101,32,114,101,
+103,105,115,116,101,114,101,100,32,105,110,32,99,101,114,116,97,105,110,32,
+106,117,114,105,115,100,105,99,116,105,111,110,115,46,65,115,99,101,110,100,
+101,114,32,67,111,114,112,111,114,97,116,105,111,110,68,114,111,105,100,32,
+83,97,110,115,32,105,115,32,97,32,104,117,109,97,110,105,115,116,32,115,97,
+110,115,32,115,101,114,105,102,32,116,121,112,101,102,97,99,101,32,100,101,
+115,105,103,110,101,100,32,102,111,114,32,117,115,101,114,32,105,110,116,
+101,114,102,97,99,101,115,32,97,110,100,32,101,108,101,99,116,114,111,110,
+105,99,32,99,111,109,109,117,110,105,99,97,116,105,111,110,46,76,105,99,101,
+110,115,101,100,32,117,110,100,101,114,32,116,104,101,32,65,112,97,99,104,
+101,32,76,105,99,101,110,115,101,44,32,86,101,114,115,105,111,110,32,50,46,
+48,104,116,116,112,58,47,47,119,119,119,46,97,112,97,99,104,101,46,111,114,
+103,47,108,105,99,101,110,115,101,115,47,76,73,67,69,78,83,69,45,50,46,48,
+0,68,0,105,0,103,0,105,0,116,0,105,0,122,0,101,0,100,0,32,0,100,0,97,0,116,
+0,97,0,32,0,99,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,169,
+0,32,0,50,0,48,0,48,0,55,0,44,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,
+0,67,0,111,0,114,0,112,0,111,0,114,0,97,0,116,0,105,0,111,0,110,0,46,0,68,
+0,114,0,111,0,105,0,100,0,32,0,83,0,97,0,110,0,115,0,32,0,77,0,111,0,110,
+0,111,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,65,0,115,0,99,0,101,0,110,
+0,100,0,101,0,114,0,32,0,45,0,32,0,68,0,114,0,111,0,105,0,100,0,32,0,83,0,
+97,0,110,0,115,0,32,0,77,0,111,0,110,0,111,0,86,0,101,0,114,0,115,0,105,0,
+111,0,110,0,32,0,49,0,46,0,48,0,48,0,32,0,98,0,117,0,105,0,108,0,100,0,32,
+0,49,0,49,0,51,0,68,0,114,0,111,0,105,0,100,0,83,0,97,0,110,0,115,0,77,0,
+111,0,110,0,111,0,68,0,114,0,111,0,105,0,100,0,32,0,105,0,115,0,32,0,97,0,
+32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,
+32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,97,0,110,0,100,0,32,0,109,0,
+97,0,121,0,32,0,98,0,101,0,32,0,114,0,101,0,103,0,105,0,115,0,116,0,101,0,
+114,0,101,0,100,0,32,0,105,0,110,0,32,0,99,0,101,0,114,0,116,0,97,0,105,0,
+110,0,32,0,106,0,117,0,114,0,105,0,115,0,100,0,105,0,99,0,116,0,105,0,111,
+0,110,0,115,0,46,0,65,0,115,0,99,0,101,0,110,0,100,0,101,0,114,0,32,0,67,
+0,111,0,114,0,112,0,111,0,114,0,97,0,116,0,105,0,111,0,110,0,68,0,114,0,111,
+0,105,0,100,0,32,0,83,0,97,0,110,0,115,0,32,0,105,0,115,0,32,0,97,0,32,0,
+104,0,117,0,109,0,97,0,110,0,105,0,115,0,116,0,32,0,115,0,97,0,110,0,115,
+0,32,0,115,0,101,0,114,0,105,0,102,0,32,0,116,0,121,0,112,0,101,0,102,0,97,
+0,99,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,102,
+0,111,0,114,0,32,0,117,0,115,0,101,0,114,0,32,0,105,0,110,0,116,0,101,0,114,
+0,102,0,97,0,99,0,101,0,115,0,32,0,97,0,110,0,100,0,32,0,101,0,108,0,101,
+0,99,0,116,0,114,0,111,0,110,0,105,0,99,0,32,0,99,0,111,0,109,0,109,0,117,
+0,110,0,105,0,99,0,97,0,116,0,105,0,111,0,110,0,46,0,104,0,116,0,116,0,112,
+0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,97,0,115,0,99,0,101,0,110,0,100,0,
+101,0,114,0,99,0,111,0,114,0,112,0,46,0,99,0,111,0,109,0,47,0,104,0,116,0,
+116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,97,0,115,0,99,0,101,0,110,
+0,100,0,101,0,114,0,99,0,111,0,114,0,112,0,46,0,99,0,111,0,109,0,47,0,116,
+0,121,0,112,0,101,0,100,0,101,0,115,0,105,0,103,0,110,0,101,0,114,0,115,0,
+46,0,104,0,116,0,109,0,108,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,100,
+0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,65,0,112,
+0,97,0,99,0,104,0,101,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,
+32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,50,0,46,0,48,0,104,0,116,
+0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,97,0,112,0,97,0,99,0,
+104,0,101,0,46,0,111,0,114,0,103,0,47,0,108,0,105,0,99,0,101,0,110,0,115,
+0,101,0,115,0,47,0,76,0,73,0,67,0,69,0,78,0,83,0,69,0,45,0,50,0,46,0,48,0,
+2,0,0,0,0,0,0,255,102,0,102,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,132,
+0,0,1,2,0,2,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,
+0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,
+0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,
+0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,
+0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,
+0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,
+0,92,0,93,0,94,0,95,0,96,0,97,0,172,0,163,0,132,0,133,0,189,0,150,0,232,0,
+134,0,142,0,139,0,157,0,169,0,164,1,3,0,138,1,4,0,131,0,147,0,242,0,243,0,
+141,0,151,0,136,1,5,0,222,0,241,0,158,0,170,0,245,0,244,0,246,0,162,0,173,
+0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,
+0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,
+212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,
+0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,
+121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,
+1,6,1,7,1,8,1,9,1,10,1,11,0,253,0,254,1,12,1,13,1,14,1,15,0,255,1,0,1,16,
+1,17,1,18,1,19,1,20,1,21,1,22,1,23,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,
+0,248,0,249,1,32,1,33,1,34,1,35,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,
+44,1,45,1,46,1,47,1,48,0,215,1,49,1,50,1,51,1,52,1,53,1,54,1,55,1,56,1,57,
+1,58,1,59,1,60,1,61,1,62,1,63,0,226,0,227,1,64,1,65,1,66,1,67,1,68,1,69,1,
+70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,0,176,0,177,1,79,1,80,1,81,1,82,
+1,83,1,84,1,85,1,86,1,87,1,88,0,251,0,252,0,228,0,229,1,89,1,90,1,91,1,92,
+1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,
+106,1,107,1,108,1,109,1,110,0,187,1,111,1,112,1,113,1,114,0,230,0,231,1,115,
+0,166,1,116,1,117,1,118,1,119,1,120,1,121,1,122,1,123,0,216,0,225,1,124,0,
+219,0,220,0,221,0,224,0,217,0,223,1,125,1,126,1,127,1,128,1,129,1,130,1,131,
+1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,
+144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,
+1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,
+169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,
+0,155,1,182,1,183,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,
+193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,
+1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,
+218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,
+1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,
+243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,
+2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,
+2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,
+2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,0,178,0,179,2,42,2,43,0,
+182,0,183,0,196,2,44,0,180,0,181,0,197,0,130,0,194,0,135,0,171,0,198,2,45,
+2,46,0,190,0,191,2,47,0,188,2,48,0,247,2,49,2,50,2,51,2,52,2,53,2,54,0,140,
+0,159,2,55,2,56,2,57,2,58,2,59,0,152,2,60,0,154,0,153,0,239,0,165,0,146,0,
+156,0,167,0,143,0,148,0,149,0,185,2,61,2,62,2,63,2,64,2,65,2,66,2,67,2,68,
+2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,
+2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,
+2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,
+111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,
+2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,
+136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,
+2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,
+161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,
+2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,
+186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,
+2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,
+211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,
+2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,
+236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,
+2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,
+3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,
+3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,
+3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,
+3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,
+3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,
+3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,
+3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,
+3,111,3,112,3,113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,
+123,3,124,3,125,3,126,3,127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,
+3,136,3,137,3,138,3,139,3,140,5,46,110,117,108,108,7,117,110,105,48,48,65,
+68,9,111,118,101,114,115,99,111,114,101,14,112,101,114,105,111,100,99,101,
+110,116,101,114,101,100,7,65,109,97,99,114,111,110,7,97,109,97,99,114,111,
+110,6,65,98,114,101,118,101,6,97,98,114,101,118,101,7,65,111,103,111,110,
+101,107,7,97,111,103,111,110,101,107,11,67,99,105,114,99,117,109,102,108,
+101,120,11,99,99,105,114,99,117,109,102,108,101,120,4,67,100,111,116,4,99,
+100,111,116,6,68,99,97,114,111,110,6,100,99,97,114,111,110,6,68,99,114,111,
+97,116,6,100,99,114,111,97,116,7,69,109,97,99,114,111,110,7,101,109,97,99,
+114,111,110,6,69,98,114,101,118,101,6,101,98,114,101,118,101,10,69,100,111,
+116,97,99,99,101,110,116,10,101,100,111,116,97,99,99,101,110,116,7,69,111,
+103,111,110,101,107,7,101,111,103,111,110,101,107,6,69,99,97,114,111,110,
+6,101,99,97,114,111,110,11,71,99,105,114,99,117,109,102,108,101,120,11,103,
+99,105,114,99,117,109,102,108,101,120,4,71,100,111,116,4,103,100,111,116,
+12,71,99,111,109,109,97,97,99,99,101,110,116,12,103,99,111,109,109,97,97,
+99,99,101,110,116,11,72,99,105,114,99,117,109,102,108,101,120,11,104,99,105,
+114,99,117,109,102,108,101,120,4,72,98,97,114,4,104,98,97,114,6,73,116,105,
+108,100,101,6,105,116,105,108,100,101,7,73,109,97,99,114,111,110,7,105,109,
+97,99,114,111,110,6,73,98,114,101,118,101,6,105,98,114,101,118,101,7,73,111,
+103,111,110,101,107,7,105,111,103,111,110,101,107,10,73,100,111,116,97,99,
+99,101,110,116,2,73,74,2,105,106,11,74,99,105,114,99,117,109,102,108,101,
+120,11,106,99,105,114,99,117,109,102,108,101,120,12,75,99,111,109,109,97,
+97,99,99,101,110,116,12,107,99,111,109,109,97,97,99,99,101,110,116,12,107,
+103,114,101,101,110,108,97,110,100,105,99,6,76,97,99,117,116,101,6,108,97,
+99,117,116,101,12,76,99,111,109,109,97,97,99,99,101,110,116,12,108,99,111,
+109,109,97,97,99,99,101,110,116,6,76,99,97,114,111,110,6,108,99,97,114,111,
+110,4,76,100,111,116,4,108,100,111,116,6,78,97,99,117,116,101,6,110,97,99,
+117,116,101,12,78,99,111,109,109,97,97,99,99,101,110,116,12,110,99,111,109,
+109,97,97,99,99,101,110,116,6,78,99,97,114,111,110,6,110,99,97,114,111,110,
+11,110,97,112,111,115,116,114,111,112,104,101,3,69,110,103,3,101,110,103,
+7,79,109,97,99,114,111,110,7,111,109,97,99,114,111,110,6,79,98,114,101,118,
+101,6,111,98,114,101,118,101,13,79,104,117,110,103,97,114,117,109,108,97,
+117,116,13,111,104,117,110,103,97,114,117,109,108,97,117,116,6,82,97,99,117,
+116,101,6,114,97,99,117,116,101,12,82,99,111,109,109,97,97,99,99,101,110,
+116,12,114,99,111,109,109,97,97,99,99,101,110,116,6,82,99,97,114,111,110,
+6,114,99,97,114,111,110,6,83,97,99,117,116,101,6,115,97,99,117,116,101,11,
+83,99,105,114,99,117,109,102,108,101,120,11,115,99,105,114,99,117,109,102,
+108,101,120,12,84,99,111,109,109,97,97,99,99,101,110,116,12,116,99,111,109,
+109,97,97,99,99,101,110,116,6,84,99,97,114,111,110,6,116,99,97,114,111,110,
+4,84,98,97,114,4,116,98,97,114,6,85,116,105,108,100,101,6,117,116,105,108,
+100,101,7,85,109,97,99,114,111,110,7,117,109,97,99,114,111,110,6,85,98,114,
+101,118,101,6,117,98,114,101,118,101,5,85,114,105,110,103,5,117,114,105,110,
+103,13,85,104,117,110,103,97,114,117,109,108,97,117,116,13,117,104,117,110,
+103,97,114,117,109,108,97,117,116,7,85,111,103,111,110,101,107,7,117,111,
+103,111,110,101,107,11,87,99,105,114,99,117,109,102,108,101,120,11,119,99,
+105,114,99,117,109,102,108,101,120,11,89,99,105,114,99,117,109,102,108,101,
+120,11,121,99,105,114,99,117,109,102,108,101,120,6,90,97,99,117,116,101,6,
+122,97,99,117,116,101,10,90,100,111,116,97,99,99,101,110,116,10,122,100,111,
+116,97,99,99,101,110,116,5,108,111,110,103,115,10,65,114,105,110,103,97,99,
+117,116,101,10,97,114,105,110,103,97,99,117,116,101,7,65,69,97,99,117,116,
+101,7,97,101,97,99,117,116,101,11,79,115,108,97,115,104,97,99,117,116,101,
+11,111,115,108,97,115,104,97,99,117,116,101,12,83,99,111,109,109,97,97,99,
+99,101,110,116,12,115,99,111,109,109,97,97,99,99,101,110,116,6,109,97,99,
+114,111,110,5,116,111,110,111,115,13,100,105,101,114,101,115,105,115,116,
+111,110,111,115,10,65,108,112,104,97,116,111,110,111,115,9,97,110,111,116,
+101,108,101,105,97,12,69,112,115,105,108,111,110,116,111,110,111,115,8,69,
+116,97,116,111,110,111,115,9,73,111,116,97,116,111,110,111,115,12,79,109,
+105,99,114,111,110,116,111,110,111,115,12,85,112,115,105,108,111,110,116,
+111,110,111,115,10,79,109,101,103,97,116,111,110,111,115,17,105,111,116,97,
+100,105,101,114,101,115,105,115,116,111,110,111,115,5,65,108,112,104,97,4,
+66,101,116,97,5,71,97,109,109,97,7,117,110,105,48,51,57,52,7,69,112,115,105,
+108,111,110,4,90,101,116,97,3,69,116,97,5,84,104,101,116,97,4,73,111,116,
+97,5,75,97,112,112,97,6,76,97,109,98,100,97,2,77,117,2,78,117,2,88,105,7,
+79,109,105,99,114,111,110,2,80,105,3,82,104,111,5,83,105,103,109,97,3,84,
+97,117,7,85,112,115,105,108,111,110,3,80,104,105,3,67,104,105,3,80,115,105,
+7,117,110,105,48,51,65,57,12,73,111,116,97,100,105,101,114,101,115,105,115,
+15,85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,10,97,108,112,
+104,97,116,111,110,111,115,12,101,112,115,105,108,111,110,116,111,110,111,
+115,8,101,116,97,116,111,110,111,115,9,105,111,116,97,116,111,110,111,115,
+20,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,
+111,115,5,97,108,112,104,97,4,98,101,116,97,5,103,97,109,109,97,5,100,101,
+108,116,97,7,101,112,115,105,108,111,110,4,122,101,116,97,3,101,116,97,5,
+116,104,101,116,97,4,105,111,116,97,5,107,97,112,112,97,6,108,97,109,98,100,
+97,7,117,110,105,48,51,66,67,2,110,117,2,120,105,7,111,109,105,99,114,111,
+110,3,114,104,111,6,115,105,103,109,97,49,5,115,105,103,109,97,3,116,97,117,
+7,117,112,115,105,108,111,110,3,112,104,105,3,99,104,105,3,112,115,105,5,
+111,109,101,103,97,12,105,111,116,97,100,105,101,114,101,115,105,115,15,117,
+112,115,105,108,111,110,100,105,101,114,101,115,105,115,12,111,109,105,99,
+114,111,110,116,111,110,111,115,12,117,112,115,105,108,111,110,116,111,110,
+111,115,10,111,109,101,103,97,116,111,110,111,115,9,97,102,105,105,49,48,
+48,50,51,9,97,102,105,105,49,48,48,53,49,9,97,102,105,105,49,48,48,53,50,
+9,97,102,105,105,49,48,48,53,51,9,97,102,105,105,49,48,48,53,52,9,97,102,
+105,105,49,48,48,53,53,9,97,102,105,105,49,48,48,53,54,9,97,102,105,105,49,
+48,48,53,55,9,97,102,105,105,49,48,48,53,56,9,97,102,105,105,49,48,48,53,
+57,9,97,102,105,105,49,48,48,54,48,9,97,102,105,105,49,48,48,54,49,9,97,102,
+105,105,49,48,48,54,50,9,97,102,105,105,49,48,49,52,53,9,97,102,105,105,49,
+48,48,49,55,9,97,102,105,105,49,48,48,49,56,9,97,102,105,105,49,48,48,49,
+57,9,97,102,105,105,49,48,48,50,48,9,97,102,105,105,49,48,48,50,49,9,97,102,
+105,105,49,48,48,50,50,9,97,102,105,105,49,48,48,50,52,9,97,102,105,105,49,
+48,48,50,53,9,97,102,105,105,49,48,48,50,54,9,97,102,105,105,49,48,48,50,
+55,9,97,102,105,105,49,48,48,50,56,9,97,102,105,105,49,48,48,50,57,9,97,102,
+105,105,49,48,48,51,48,9,97,102,105,105,49,48,48,51,49,9,97,102,105,105,49,
+48,48,51,50,9,97,102,105,105,49,48,48,51,51,9,97,102,105,105,49,48,48,51,
+52,9,97,102,105,105,49,48,48,51,53,9,97,102,105,105,49,48,48,51,54,9,97,102,
+105,105,49,48,48,51,55,9,97,102,105,105,49,48,48,51,56,9,97,102,105,105,49,
+48,48,51,57,9,97,102,105,105,49,48,48,52,48,9,97,102,105,105,49,48,48,52,
+49,9,97,102,105,105,49,48,48,52,50,9,97,102,105,105,49,48,48,52,51,9,97,102,
+105,105,49,48,48,52,52,9,97,102,105,105,49,48,48,52,53,9,97,102,105,105,49,
+48,48,52,54,9,97,102,105,105,49,48,48,52,55,9,97,102,105,105,49,48,48,52,
+56,9,97,102,105,105,49,48,48,52,57,9,97,102,105,105,49,48,48,54,53,9,97,102,
+105,105,49,48,48,54,54,9,97,102,105,105,49,48,48,54,55,9,97,102,105,105,49,
+48,48,54,56,9,97,102,105,105,49,48,48,54,57,9,97,102,105,105,49,48,48,55,
+48,9,97,102,105,105,49,48,48,55,50,9,97,102,105,105,49,48,48,55,51,9,97,102,
+105,105,49,48,48,55,52,9,97,102,105,105,49,48,48,55,53,9,97,102,105,105,49,
+48,48,55,54,9,97,102,105,105,49,48,48,55,55,9,97,102,105,105,49,48,48,55,
+56,9,97,102,105,105,49,48,48,55,57,9,97,102,105,105,49,48,48,56,48,9,97,102,
+105,105,49,48,48,56,49,9,97,102,105,105,49,48,48,56,50,9,97,102,105,105,49,
+48,48,56,51,9,97,102,105,105,49,48,48,56,52,9,97,102,105,105,49,48,48,56,
+53,9,97,102,105,105,49,48,48,56,54,9,97,102,105,105,49,48,48,56,55,9,97,102,
+105,105,49,48,48,56,56,9,97,102,105,105,49,48,48,56,57,9,97,102,105,105,49,
+48,48,57,48,9,97,102,105,105,49,48,48,57,49,9,97,102,105,105,49,48,48,57,
+50,9,97,102,105,105,49,48,48,57,51,9,97,102,105,105,49,48,48,57,52,9,97,102,
+105,105,49,48,48,57,53,9,97,102,105,105,49,48,48,57,54,9,97,102,105,105,49,
+48,48,57,55,9,97,102,105,105,49,48,48,55,49,9,97,102,105,105,49,48,48,57,
+57,9,97,102,105,105,49,48,49,48,48,9,97,102,105,105,49,48,49,48,49,9,97,102,
+105,105,49,48,49,48,50,9,97,102,105,105,49,48,49,48,51,9,97,102,105,105,49,
+48,49,48,52,9,97,102,105,105,49,48,49,48,53,9,97,102,105,105,49,48,49,48,
+54,9,97,102,105,105,49,48,49,48,55,9,97,102,105,105,49,48,49,48,56,9,97,102,
+105,105,49,48,49,48,57,9,97,102,105,105,49,48,49,49,48,9,97,102,105,105,49,
+48,49,57,51,9,97,102,105,105,49,48,48,53,48,9,97,102,105,105,49,48,48,57,
+56,6,87,103,114,97,118,101,6,119,103,114,97,118,101,6,87,97,99,117,116,101,
+6,119,97,99,117,116,101,9,87,100,105,101,114,101,115,105,115,9,119,100,105,
+101,114,101,115,105,115,6,89,103,114,97,118,101,6,121,103,114,97,118,101,
+9,97,102,105,105,48,48,50,48,56,13,117,110,100,101,114,115,99,111,114,101,
+100,98,108,13,113,117,111,116,101,114,101,118,101,114,115,101,100,6,109,105,
+110,117,116,101,6,115,101,99,111,110,100,9,101,120,99,108,97,109,100,98,108,
+9,110,115,117,112,101,114,105,111,114,9,97,102,105,105,48,56,57,52,49,6,112,
+101,115,101,116,97,4,69,117,114,111,9,97,102,105,105,54,49,50,52,56,9,97,
+102,105,105,54,49,50,56,57,9,97,102,105,105,54,49,51,53,50,9,101,115,116,
+105,109,97,116,101,100,9,111,110,101,101,105,103,104,116,104,12,116,104,114,
+101,101,101,105,103,104,116,104,115,11,102,105,118,101,101,105,103,104,116,
+104,115,12,115,101,118,101,110,101,105,103,104,116,104,115,5,68,101,108,116,
+97,7,117,110,105,70,66,48,49,7,117,110,105,70,66,48,50,13,99,121,114,105,
+108,108,105,99,98,114,101,118,101,8,100,111,116,108,101,115,115,106,16,99,
+97,114,111,110,99,111,109,109,97,97,99,99,101,110,116,11,99,111,109,109,97,
+97,99,99,101,110,116,17,99,111,109,109,97,97,99,99,101,110,116,114,111,116,
+97,116,101,12,122,101,114,111,115,117,112,101,114,105,111,114,12,102,111,
+117,114,115,117,112,101,114,105,111,114,12,102,105,118,101,115,117,112,101,
+114,105,111,114,11,115,105,120,115,117,112,101,114,105,111,114,13,115,101,
+118,101,110,115,117,112,101,114,105,111,114,13,101,105,103,104,116,115,117,
+112,101,114,105,111,114,12,110,105,110,101,115,117,112,101,114,105,111,114,
+7,117,110,105,50,48,48,48,7,117,110,105,50,48,48,49,7,117,110,105,50,48,48,
+50,7,117,110,105,50,48,48,51,7,117,110,105,50,48,48,52,7,117,110,105,50,48,
+48,53,7,117,110,105,50,48,48,54,7,117,110,105,50,48,48,55,7,117,110,105,50,
+48,48,56,7,117,110,105,50,48,48,57,7,117,110,105,50,48,48,65,7,117,110,105,
+50,48,48,66,7,117,110,105,70,69,70,70,7,117,110,105,70,70,70,67,7,117,110,
+105,70,70,70,68,7,117,110,105,48,49,70,48,7,117,110,105,48,50,66,67,7,117,
+110,105,48,51,68,49,7,117,110,105,48,51,68,50,7,117,110,105,48,51,68,54,7,
+117,110,105,49,69,51,69,7,117,110,105,49,69,51,70,7,117,110,105,49,69,48,
+48,7,117,110,105,49,69,48,49,7,117,110,105,49,70,52,68,7,117,110,105,48,50,
+70,51,9,100,97,115,105,97,111,120,105,97,7,117,110,105,70,66,48,51,7,117,
+110,105,70,66,48,52,5,79,104,111,114,110,5,111,104,111,114,110,5,85,104,111,
+114,110,5,117,104,111,114,110,7,117,110,105,48,51,48,48,7,117,110,105,48,
+51,48,49,7,117,110,105,48,51,48,51,4,104,111,111,107,8,100,111,116,98,101,
+108,111,119,7,117,110,105,48,52,48,48,7,117,110,105,48,52,48,68,7,117,110,
+105,48,52,53,48,7,117,110,105,48,52,53,68,7,117,110,105,48,52,54,48,7,117,
+110,105,48,52,54,49,7,117,110,105,48,52,54,50,7,117,110,105,48,52,54,51,7,
+117,110,105,48,52,54,52,7,117,110,105,48,52,54,53,7,117,110,105,48,52,54,
+54,7,117,110,105,48,52,54,55,7,117,110,105,48,52,54,56,7,117,110,105,48,52,
+54,57,7,117,110,105,48,52,54,65,7,117,110,105,48,52,54,66,7,117,110,105,48,
+52,54,67,7,117,110,105,48,52,54,68,7,117,110,105,48,52,54,69,7,117,110,105,
+48,52,54,70,7,117,110,105,48,52,55,48,7,117,110,105,48,52,55,49,7,117,110,
+105,48,52,55,50,7,117,110,105,48,52,55,51,7,117,110,105,48,52,55,52,7,117,
+110,105,48,52,55,53,7,117,110,105,48,52,55,54,7,117,110,105,48,52,55,55,7,
+117,110,105,48,52,55,56,7,117,110,105,48,52,55,57,7,117,110,105,48,52,55,
+65,7,117,110,105,48,52,55,66,7,117,110,105,48,52,55,67,7,117,110,105,48,52,
+55,68,7,117,110,105,48,52,55,69,7,117,110,105,48,52,55,70,7,117,110,105,48,
+52,56,48,7,117,110,105,48,52,56,49,7,117,110,105,48,52,56,50,7,117,110,105,
+48,52,56,51,7,117,110,105,48,52,56,52,7,117,110,105,48,52,56,53,7,117,110,
+105,48,52,56,54,7,117,110,105,48,52,56,56,7,117,110,105,48,52,56,57,7,117,
+110,105,48,52,56,65,7,117,110,105,48,52,56,66,7,117,110,105,48,52,56,67,7,
+117,110,105,48,52,56,68,7,117,110,105,48,52,56,69,7,117,110,105,48,52,56,
+70,7,117,110,105,48,52,57,50,7,117,110,105,48,52,57,51,7,117,110,105,48,52,
+57,52,7,117,110,105,48,52,57,53,7,117,110,105,48,52,57,54,7,117,110,105,48,
+52,57,55,7,117,110,105,48,52,57,56,7,117,110,105,48,52,57,57,7,117,110,105,
+48,52,57,65,7,117,110,105,48,52,57,66,7,117,110,105,48,52,57,67,7,117,110,
+105,48,52,57,68,7,117,110,105,48,52,57,69,7,117,110,105,48,52,57,70,7,117,
+110,105,48,52,65,48,7,117,110,105,48,52,65,49,7,117,110,105,48,52,65,50,7,
+117,110,105,48,52,65,51,7,117,110,105,48,52,65,52,7,117,110,105,48,52,65,
+53,7,117,110,105,48,52,65,54,7,117,110,105,48,52,65,55,7,117,110,105,48,52,
+65,56,7,117,110,105,48,52,65,57,7,117,110,105,48,52,65,65,7,117,110,105,48,
+52,65,66,7,117,110,105,48,52,65,67,7,117,110,105,48,52,65,68,7,117,110,105,
+48,52,65,69,7,117,110,105,48,52,65,70,7,117,110,105,48,52,66,48,7,117,110,
+105,48,52,66,49,7,117,110,105,48,52,66,50,7,117,110,105,48,52,66,51,7,117,
+110,105,48,52,66,52,7,117,110,105,48,52,66,53,7,117,110,105,48,52,66,54,7,
+117,110,105,48,52,66,55,7,117,110,105,48,52,66,56,7,117,110,105,48,52,66,
+57,7,117,110,105,48,52,66,65,7,117,110,105,48,52,66,66,7,117,110,105,48,52,
+66,67,7,117,110,105,48,52,66,68,7,117,110,105,48,52,66,69,7,117,110,105,48,
+52,66,70,7,117,110,105,48,52,67,48,7,117,110,105,48,52,67,49,7,117,110,105,
+48,52,67,50,7,117,110,105,48,52,67,51,7,117,110,105,48,52,67,52,7,117,110,
+105,48,52,67,53,7,117,110,105,48,52,67,54,7,117,110,105,48,52,67,55,7,117,
+110,105,48,52,67,56,7,117,110,105,48,52,67,57,7,117,110,105,48,52,67,65,7,
+117,110,105,48,52,67,66,7,117,110,105,48,52,67,67,7,117,110,105,48,52,67,
+68,7,117,110,105,48,52,67,69,7,117,110,105,48,52,67,70,7,117,110,105,48,52,
+68,48,7,117,110,105,48,52,68,49,7,117,110,105,48,52,68,50,7,117,110,105,48,
+52,68,51,7,117,110,105,48,52,68,52,7,117,110,105,48,52,68,53,7,117,110,105,
+48,52,68,54,7,117,110,105,48,52,68,55,7,117,110,105,48,52,68,56,7,117,110,
+105,48,52,68,57,7,117,110,105,48,52,68,65,7,117,110,105,48,52,68,66,7,117,
+110,105,48,52,68,67,7,117,110,105,48,52,68,68,7,117,110,105,48,52,68,69,7,
+117,110,105,48,52,68,70,7,117,110,105,48,52,69,48,7,117,110,105,48,52,69,
+49,7,117,110,105,48,52,69,50,7,117,110,105,48,52,69,51,7,117,110,105,48,52,
+69,52,7,117,110,105,48,52,69,53,7,117,110,105,48,52,69,54,7,117,110,105,48,
+52,69,55,7,117,110,105,48,52,69,56,7,117,110,105,48,52,69,57,7,117,110,105,
+48,52,69,65,7,117,110,105,48,52,69,66,7,117,110,105,48,52,69,67,7,117,110,
+105,48,52,69,68,7,117,110,105,48,52,69,69,7,117,110,105,48,52,69,70,7,117,
+110,105,48,52,70,48,7,117,110,105,48,52,70,49,7,117,110,105,48,52,70,50,7,
+117,110,105,48,52,70,51,7,117,110,105,48,52,70,52,7,117,110,105,48,52,70,
+53,7,117,110,105,48,52,70,54,7,117,110,105,48,52,70,55,7,117,110,105,48,52,
+70,56,7,117,110,105,48,52,70,57,7,117,110,105,48,52,70,65,7,117,110,105,48,
+52,70,66,7,117,110,105,48,52,70,67,7,117,110,105,48,52,70,68,7,117,110,105,
+48,52,70,69,7,117,110,105,48,52,70,70,7,117,110,105,48,53,48,48,7,117,110,
+105,48,53,48,49,7,117,110,105,48,53,48,50,7,117,110,105,48,53,48,51,7,117,
+110,105,48,53,48,52,7,117,110,105,48,53,48,53,7,117,110,105,48,53,48,54,7,
+117,110,105,48,53,48,55,7,117,110,105,48,53,48,56,7,117,110,105,48,53,48,
+57,7,117,110,105,48,53,48,65,7,117,110,105,48,53,48,66,7,117,110,105,48,53,
+48,67,7,117,110,105,48,53,48,68,7,117,110,105,48,53,48,69,7,117,110,105,48,
+53,48,70,7,117,110,105,48,53,49,48,7,117,110,105,48,53,49,49,7,117,110,105,
+48,53,49,50,7,117,110,105,48,53,49,51,7,117,110,105,49,69,65,48,7,117,110,
+105,49,69,65,49,7,117,110,105,49,69,65,50,7,117,110,105,49,69,65,51,7,117,
+110,105,49,69,65,52,7,117,110,105,49,69,65,53,7,117,110,105,49,69,65,54,7,
+117,110,105,49,69,65,55,7,117,110,105,49,69,65,56,7,117,110,105,49,69,65,
+57,7,117,110,105,49,69,65,65,7,117,110,105,49,69,65,66,7,117,110,105,49,69,
+65,67,7,117,110,105,49,69,65,68,7,117,110,105,49,69,65,69,7,117,110,105,49,
+69,65,70,7,117,110,105,49,69,66,48,7,117,110,105,49,69,66,49,7,117,110,105,
+49,69,66,50,7,117,110,105,49,69,66,51,7,117,110,105,49,69,66,52,7,117,110,
+105,49,69,66,53,7,117,110,105,49,69,66,54,7,117,110,105,49,69,66,55,7,117,
+110,105,49,69,66,56,7,117,110,105,49,69,66,57,7,117,110,105,49,69,66,65,7,
+117,110,105,49,69,66,66,7,117,110,105,49,69,66,67,7,117,110,105,49,69,66,
+68,7,117,110,105,49,69,66,69,7,117,110,105,49,69,66,70,7,117,110,105,49,69,
+67,48,7,117,110,105,49,69,67,49,7,117,110,105,49,69,67,50,7,117,110,105,49,
+69,67,51,7,117,110,105,49,69,67,52,7,117,110,105,49,69,67,53,7,117,110,105,
+49,69,67,54,7,117,110,105,49,69,67,55,7,117,110,105,49,69,67,56,7,117,110,
+105,49,69,67,57,7,117,110,105,49,69,67,65,7,117,110,105,49,69,67,66,7,117,
+110,105,49,69,67,67,7,117,110,105,49,69,67,68,7,117,110,105,49,69,67,69,7,
+117,110,105,49,69,67,70,7,117,110,105,49,69,68,48,7,117,110,105,49,69,68,
+49,7,117,110,105,49,69,68,50,7,117,110,105,49,69,68,51,7,117,110,105,49,69,
+68,52,7,117,110,105,49,69,68,53,7,117,110,105,49,69,68,54,7,117,110,105,49,
+69,68,55,7,117,110,105,49,69,68,56,7,117,110,105,49,69,68,57,7,117,110,105,
+49,69,68,65,7,117,110,105,49,69,68,66,7,117,110,105,49,69,68,67,7,117,110,
+105,49,69,68,68,7,117,110,105,49,69,68,69,7,117,110,105,49,69,68,70,7,117,
+110,105,49,69,69,48,7,117,110,105,49,69,69,49,7,117,110,105,49,69,69,50,7,
+117,110,105,49,69,69,51,7,117,110,105,49,69,69,52,7,117,110,105,49,69,69,
+53,7,117,110,105,49,69,69,54,7,117,110,105,49,69,69,55,7,117,110,105,49,69,
+69,56,7,117,110,105,49,69,69,57,7,117,110,105,49,69,69,65,7,117,110,105,49,
+69,69,66,7,117,110,105,49,69,69,67,7,117,110,105,49,69,69,68,7,117,110,105,
+49,69,69,69,7,117,110,105,49,69,69,70,7,117,110,105,49,69,70,48,7,117,110,
+105,49,69,70,49,7,117,110,105,49,69,70,52,7,117,110,105,49,69,70,53,7,117,
+110,105,49,69,70,54,7,117,110,105,49,69,70,55,7,117,110,105,49,69,70,56,7,
+117,110,105,49,69,70,57,7,117,110,105,50,48,65,66,7,117,110,105,48,51,48,
+70,19,99,105,114,99,117,109,102,108,101,120,97,99,117,116,101,99,111,109,
+98,19,99,105,114,99,117,109,102,108,101,120,103,114,97,118,101,99,111,109,
+98,18,99,105,114,99,117,109,102,108,101,120,104,111,111,107,99,111,109,98,
+19,99,105,114,99,117,109,102,108,101,120,116,105,108,100,101,99,111,109,98,
+14,98,114,101,118,101,97,99,117,116,101,99,111,109,98,14,98,114,101,118,101,
+103,114,97,118,101,99,111,109,98,13,98,114,101,118,101,104,111,111,107,99,
+111,109,98,14,98,114,101,118,101,116,105,108,100,101,99,111,109,98,16,99,
+121,114,105,108,108,105,99,104,111,111,107,108,101,102,116,17,99,121,114,
+105,108,108,105,99,98,105,103,104,111,111,107,85,67,17,99,121,114,105,108,
+108,105,99,98,105,103,104,111,111,107,76,67,8,84,99,101,100,105,108,108,97,
+8,116,99,101,100,105,108,108,97,0,0,0,0,0,0,2,0,5,0,2,255,255,0,3,};
+#endif
@@ -26,11 +26,12 @@ enum
 };
 
 fz_error pdf_lex(int *tok, fz_stream *f, char *buf, int n, int *len);
+fz_error pdf_lex_value(int *tok, fz_stream *f, char *buf, int n, int *len, fz_off_t *ip, float *fp);
 
 fz_error pdf_parse_array(fz_obj **op, pdf_xref *xref, fz_stream *f, char *buf, int cap);
 fz_error pdf_parse_dict(fz_obj **op, pdf_xref *xref, fz_stream *f, char *buf, int cap);
 fz_error pdf_parse_stm_obj(fz_obj **op, pdf_xref *xref, fz_stream *f, char *buf, int cap);
-fz_error pdf_parse_ind_obj(fz_obj **op, pdf_xref *xref, fz_stream *f, char *buf, int cap, int *num, int *gen, int *stm_ofs);
+fz_error pdf_parse_ind_obj(fz_obj **op, pdf_xref *xref, fz_stream *f, char *buf, int cap, int *num, int *gen, fz_off_t *stm_ofs);
 
 fz_rect pdf_to_rect(fz_obj *array);
 fz_matrix pdf_to_matrix(fz_obj *array);
@@ -44,35 +45,76 @@ char *pdf_from_ucs2(unsigned short *str);
  */
 
 typedef struct pdf_xref_entry_s pdf_xref_entry;
+typedef struct pdf_xref_slot_s pdf_xref_slot;
 typedef struct pdf_crypt_s pdf_crypt;
 
+/*
+ * The xref table has one small entry per object. Everything we only need
+ * for objects that have been loaded lives in a separate slot, so huge
+ * documents don't pay for it up front.
+ */
+
 struct pdf_xref_entry_s
 {
-	int ofs;	/* file offset / objstm object number */
-	int gen;	/* generation / objstm index */
-	int stm_ofs;	/* on-disk stream */
+	fz_off_t ofs;	/* file offset / objstm object number */
+	unsigned short gen;	/* generation / objstm index */
+	unsigned char type;	/* 0=unset (f)ree i(n)use (o)bjstm */
+	unsigned char flags;	/* PDF_XREF_USED, PDF_XREF_PINNED */
+	int slot;	/* index in xref->slots, or 0 if none */
+};
+
+struct pdf_xref_slot_s
+{
 	fz_obj *obj;	/* stored/cached object */
-	int type;	/* 0=unset (f)ree i(n)use (o)bjstm */
+	fz_off_t stm_ofs;	/* on-disk stream */
+	int size;	/* bytes parsed for the cached object */
+	int next;	/* next free slot */
+};
+
+enum
+{
+	PDF_XREF_USED = 1,	/* accessed since the last trim */
+	PDF_XREF_PINNED = 2,	/* modified in memory, never evicted */
 };
 
 struct pdf_xref_s
 {
 	fz_stream *file;
 	int version;
-	int startxref;
-	int file_size;
+	fz_off_t startxref;
+	fz_off_t file_size;
 	pdf_crypt *crypt;
 	fz_obj *trailer;
 
 	int len;
 	pdf_xref_entry *table;
 
+	int slot_len;
+	int slot_cap;
+	int slot_free;
+	pdf_xref_slot *slots;
+
+	int obj_cache_size;	/* bytes parsed for the evictable cached objects */
+	int obj_cache_max;	/* trim down to this, or 0 for no limit */
+	int obj_cache_held;	/* bytes left over that we could not evict */
+	int obj_cache_hand;
+
+	fz_off_t main_xref_ofs;	/* linearized file whose main xref is not read yet */
+	int linear_page1;	/* linearization parameters, see pdf_linear.c */
+	int linear_page_count;
+	fz_off_t linear_hint_ofs;
+	int linear_hint_len;
+	fz_off_t *linear_page_ofs;	/* page offsets from the hint stream */
+
 	int page_len;
 	int page_cap;
-	fz_obj **page_objs;
+	int page_walked;
+	fz_obj **page_objs;	/* loaded on demand, see pdf_lookup_page_object */
 	fz_obj **page_refs;
 
+	struct pdf_obj_stm_s *obj_stms;	/* recently used object streams */
 	struct pdf_store_s *store;
+	struct pdf_image_s *images;	/* images still to be decoded from this file */
 
 	char scratch[65536];
 };
@@ -81,22 +123,36 @@ fz_obj *pdf_resolve_indirect(fz_obj *ref);
 fz_error pdf_cache_object(pdf_xref *, int num, int gen);
 fz_error pdf_load_object(fz_obj **objp, pdf_xref *, int num, int gen);
 void pdf_update_object( pdf_xref *xref, int num, int gen, fz_obj *newobj);
+void pdf_pin_object(pdf_xref *xref, int num);
+void pdf_set_cached_object(pdf_xref *xref, int num, fz_obj *obj);
+fz_obj *pdf_get_cached_object(pdf_xref *xref, int num);
+void pdf_drop_cached_object(pdf_xref *xref, int num);
+fz_off_t pdf_get_stream_offset(pdf_xref *xref, int num);
+void pdf_set_stream_offset(pdf_xref *xref, int num, fz_off_t stm_ofs);
+void pdf_trim_object_cache(pdf_xref *xref);
 
 int pdf_is_stream(pdf_xref *xref, int num, int gen);
 fz_stream *pdf_open_inline_stream(fz_stream *chain, pdf_xref *xref, fz_obj *stmobj, int length);
 fz_error pdf_load_raw_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen);
 fz_error pdf_load_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen);
+fz_error pdf_load_image_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen, int len, int l2factor);
 fz_error pdf_open_raw_stream(fz_stream **stmp, pdf_xref *, int num, int gen);
 fz_error pdf_open_stream(fz_stream **stmp, pdf_xref *, int num, int gen);
-fz_error pdf_open_stream_at(fz_stream **stmp, pdf_xref *xref, int num, int gen, fz_obj *dict, int stm_ofs);
+fz_error pdf_open_image_stream(fz_stream **stmp, pdf_xref *, int num, int gen, int l2factor);
+fz_error pdf_open_stream_at(fz_stream **stmp, pdf_xref *xref, int num, int gen, fz_obj *dict, fz_off_t stm_ofs);
 
 fz_error pdf_open_xref_with_stream(pdf_xref **xrefp, fz_stream *file, char *password);
 fz_error pdf_open_xref(pdf_xref **xrefp, const char *filename, char *password);
+fz_error pdf_open_xref_with_index(pdf_xref **xrefp, const char *filename, char *password, const char *indexname);
+fz_error pdf_save_index(pdf_xref *xref, const char *filename, const char *indexname);
+fz_error pdf_load_full_xref(pdf_xref *xref);
 void pdf_free_xref(pdf_xref *);
 
 /* private */
 fz_error pdf_repair_xref(pdf_xref *xref, char *buf, int bufsize);
 fz_error pdf_repair_obj_stms(pdf_xref *xref);
+fz_error pdf_load_index(pdf_xref *xref, const char *filename, const char *indexname);
+int pdf_lookup_linear_page(pdf_xref *xref, int number);
 void pdf_debug_xref(pdf_xref *);
 void pdf_resize_xref(pdf_xref *xref, int newcap);
 
@@ -118,9 +174,12 @@ enum
 };
 
 fz_error pdf_new_crypt(pdf_crypt **cp, fz_obj *enc, fz_obj *id);
-void pdf_free_crypt(pdf_crypt *crypt);
+pdf_crypt *pdf_keep_crypt(pdf_crypt *crypt);
+void pdf_drop_crypt(pdf_crypt *crypt);
 
 void pdf_crypt_obj(pdf_crypt *crypt, fz_obj *obj, int num, int gen);
+int pdf_decrypt_string(void *crypt, int num, int gen, unsigned char *s, int len);
+void pdf_drop_string_crypt(void *crypt);
 fz_stream *pdf_open_crypt(fz_stream *chain, pdf_crypt *crypt, int num, int gen);
 fz_stream *pdf_open_crypt_with_filter(fz_stream *chain, pdf_crypt *crypt, char *name, int num, int gen);
 
@@ -166,8 +225,9 @@ fz_pixmap *pdf_expand_indexed_pixmap(fz_pixmap *src);
 
 fz_error pdf_load_shading(fz_shade **shadep, pdf_xref *xref, fz_obj *obj);
 
-fz_error pdf_load_inline_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict, fz_stream *file);
-fz_error pdf_load_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *obj);
+fz_error pdf_load_inline_image(fz_image **imagep, pdf_xref *xref, fz_obj *rdb, fz_obj *dict, fz_stream *file);
+fz_error pdf_load_image(fz_image **imagep, pdf_xref *xref, fz_obj *obj);
+void pdf_detach_images(pdf_xref *xref);
 int pdf_is_jpx_image(fz_obj *dict);
 
 /*
@@ -186,6 +246,7 @@ struct pdf_pattern_s
 	fz_rect bbox;
 	fz_obj *resources;
 	fz_buffer *contents;
+	fz_obj *me;
 };
 
 fz_error pdf_load_pattern(pdf_pattern **patp, pdf_xref *xref, fz_obj *obj);
@@ -209,6 +270,7 @@ struct pdf_xobject_s
 	fz_colorspace *colorspace;
 	fz_obj *resources;
 	fz_buffer *contents;
+	fz_obj *me;
 };
 
 fz_error pdf_load_xobject(pdf_xobject **xobjp, pdf_xref *xref, fz_obj *obj);
@@ -471,6 +533,7 @@ struct pdf_page_s
 	int transparency;
 	fz_obj *resources;
 	fz_buffer *contents;
+	fz_obj *me;
 	pdf_link *links;
 	pdf_annot *annots;
 };
@@ -478,6 +541,9 @@ struct pdf_page_s
 fz_error pdf_load_page_tree(pdf_xref *xref);
 int pdf_find_page_number(pdf_xref *xref, fz_obj *pageobj);
 int pdf_count_pages(pdf_xref *xref);
+fz_obj *pdf_lookup_page_object(pdf_xref *xref, int number);
+fz_obj *pdf_lookup_page_ref(pdf_xref *xref, int number);
+fz_obj *pdf_lookup_inherited_page_item(fz_obj *pageobj, char *key);
 
 fz_error pdf_load_page(pdf_page **pagep, pdf_xref *xref, int number);
 void pdf_free_page(pdf_page *page);
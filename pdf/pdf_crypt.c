@@ -18,8 +18,32 @@ struct pdf_crypt_filter_s
 	int length;
 };
 
+/*
+ * Object keys are derived with an MD5 of the document key and the object
+ * number, so keep the most recent ones to avoid hashing again every time
+ * an object or stream is decrypted. Strings are decrypted one at a time
+ * when they are first used, so the expanded AES key for an object's
+ * strings is kept along with its key.
+ */
+
+typedef struct pdf_object_key_s pdf_object_key;
+
+enum { PDF_OBJECT_KEY_CACHE = 256 };
+
+struct pdf_object_key_s
+{
+	int num;
+	int gen;
+	int method;
+	int len; /* zero for an empty slot */
+	unsigned char key[16];
+	int has_aes;
+	fz_aes *aes; /* expanded string key, allocated on first use */
+};
+
 struct pdf_crypt_s
 {
+	int refs;
 	fz_obj *id;
 
 	int v;
@@ -37,6 +61,9 @@ struct pdf_crypt_s
 	int encrypt_metadata;
 
 	unsigned char key[32]; /* decryption key generated from password */
+
+	pdf_object_key keys[PDF_OBJECT_KEY_CACHE];
+	fz_aes *aes; /* expanded string key for AESV3, the same for all objects */
 };
 
 static fz_error pdf_parse_crypt_filter(pdf_crypt_filter *cf, fz_obj *dict, char *name, int defaultlength);
@@ -55,18 +82,19 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 
 	crypt = fz_malloc(sizeof(pdf_crypt));
 	memset(crypt, 0x00, sizeof(pdf_crypt));
+	crypt->refs = 1;
 
 	/* Common to all security handlers (PDF 1.7 table 3.18) */
 
 	obj = fz_dict_gets(dict, "Filter");
 	if (!fz_is_name(obj))
 	{
-		pdf_free_crypt(crypt);
+		pdf_drop_crypt(crypt);
 		return fz_throw("unspecified encryption handler");
 	}
 	if (strcmp(fz_to_name(obj), "Standard") != 0)
 	{
-		pdf_free_crypt(crypt);
+		pdf_drop_crypt(crypt);
 		return fz_throw("unknown encryption handler: '%s'", fz_to_name(obj));
 	}
 
@@ -76,7 +104,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 		crypt->v = fz_to_int(obj);
 	if (crypt->v != 1 && crypt->v != 2 && crypt->v != 4 && crypt->v != 5)
 	{
-		pdf_free_crypt(crypt);
+		pdf_drop_crypt(crypt);
 		return fz_throw("unknown encryption version");
 	}
 
@@ -93,12 +121,12 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 
 		if (crypt->length % 8 != 0)
 		{
-			pdf_free_crypt(crypt);
+			pdf_drop_crypt(crypt);
 			return fz_throw("invalid encryption key length");
 		}
 		if (crypt->length > 256)
 		{
-			pdf_free_crypt(crypt);
+			pdf_drop_crypt(crypt);
 			return fz_throw("invalid encryption key length");
 		}
 	}
@@ -139,7 +167,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 			error = pdf_parse_crypt_filter(&crypt->stmf, crypt->cf, fz_to_name(obj), crypt->length);
 			if (error)
 			{
-				pdf_free_crypt(crypt);
+				pdf_drop_crypt(crypt);
 				return fz_rethrow(error, "cannot parse stream crypt filter (%d %d R)", fz_to_num(obj), fz_to_gen(obj));
 			}
 		}
@@ -150,7 +178,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 			error = pdf_parse_crypt_filter(&crypt->strf, crypt->cf, fz_to_name(obj), crypt->length);
 			if (error)
 			{
-				pdf_free_crypt(crypt);
+				pdf_drop_crypt(crypt);
 				return fz_rethrow(error, "cannot parse string crypt filter (%d %d R)", fz_to_num(obj), fz_to_gen(obj));
 			}
 		}
@@ -167,7 +195,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 		crypt->r = fz_to_int(obj);
 	else
 	{
-		pdf_free_crypt(crypt);
+		pdf_drop_crypt(crypt);
 		return fz_throw("encryption dictionary missing revision value");
 	}
 
@@ -179,7 +207,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 		memcpy(crypt->o, fz_to_str_buf(obj), 48);
 	else
 	{
-		pdf_free_crypt(crypt);
+		pdf_drop_crypt(crypt);
 		return fz_throw("encryption dictionary missing owner password");
 	}
 
@@ -195,7 +223,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 	}
 	else
 	{
-		pdf_free_crypt(crypt);
+		pdf_drop_crypt(crypt);
 		return fz_throw("encryption dictionary missing user password");
 	}
 
@@ -204,7 +232,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 		crypt->p = fz_to_int(obj);
 	else
 	{
-		pdf_free_crypt(crypt);
+		pdf_drop_crypt(crypt);
 		return fz_throw("encryption dictionary missing permissions value");
 	}
 
@@ -213,7 +241,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 		obj = fz_dict_gets(dict, "OE");
 		if (!fz_is_string(obj) || fz_to_str_len(obj) != 32)
 		{
-			pdf_free_crypt(crypt);
+			pdf_drop_crypt(crypt);
 			return fz_throw("encryption dictionary missing owner encryption key");
 		}
 		memcpy(crypt->oe, fz_to_str_buf(obj), 32);
@@ -221,7 +249,7 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 		obj = fz_dict_gets(dict, "UE");
 		if (!fz_is_string(obj) || fz_to_str_len(obj) != 32)
 		{
-			pdf_free_crypt(crypt);
+			pdf_drop_crypt(crypt);
 			return fz_throw("encryption dictionary missing user encryption key");
 		}
 		memcpy(crypt->ue, fz_to_str_buf(obj), 32);
@@ -247,11 +275,31 @@ pdf_new_crypt(pdf_crypt **cryptp, fz_obj *dict, fz_obj *id)
 	return fz_okay;
 }
 
+/*
+ * Strings that are still encrypted hold a reference to the crypt object,
+ * so it stays around for them after the document is closed.
+ */
+
+pdf_crypt *
+pdf_keep_crypt(pdf_crypt *crypt)
+{
+	crypt->refs++;
+	return crypt;
+}
+
 void
-pdf_free_crypt(pdf_crypt *crypt)
+pdf_drop_crypt(pdf_crypt *crypt)
 {
+	int i;
+
+	if (--crypt->refs > 0)
+		return;
+
 	if (crypt->id) fz_drop_obj(crypt->id);
 	if (crypt->cf) fz_drop_obj(crypt->cf);
+	for (i = 0; i < PDF_OBJECT_KEY_CACHE; i++)
+		fz_free(crypt->keys[i].aes);
+	fz_free(crypt->aes);
 	fz_free(crypt);
 }
 
@@ -670,6 +718,7 @@ pdf_get_crypt_length(pdf_xref *xref)
 static int
 pdf_compute_object_key(pdf_crypt *crypt, pdf_crypt_filter *cf, int num, int gen, unsigned char *key)
 {
+	pdf_object_key *slot;
 	fz_md5 md5;
 	unsigned char message[5];
 
@@ -679,6 +728,13 @@ pdf_compute_object_key(pdf_crypt *crypt, pdf_crypt_filter *cf, int num, int gen,
 		return crypt->length / 8;
 	}
 
+	slot = &crypt->keys[num & (PDF_OBJECT_KEY_CACHE - 1)];
+	if (slot->len && slot->num == num && slot->gen == gen && slot->method == cf->method)
+	{
+		memcpy(key, slot->key, slot->len);
+		return slot->len;
+	}
+
 	fz_md5_init(&md5);
 	fz_md5_update(&md5, crypt->key, crypt->length / 8);
 	message[0] = (num) & 0xFF;
@@ -693,23 +749,106 @@ pdf_compute_object_key(pdf_crypt *crypt, pdf_crypt_filter *cf, int num, int gen,
 
 	fz_md5_final(&md5, key);
 
-	if (crypt->length / 8 + 5 > 16)
-		return 16;
-	return crypt->length / 8 + 5;
+	slot->num = num;
+	slot->gen = gen;
+	slot->method = cf->method;
+	slot->has_aes = 0;
+	slot->len = MIN(crypt->length / 8 + 5, 16);
+	memcpy(slot->key, key, slot->len);
+
+	return slot->len;
+}
+
+/*
+ * Get the expanded AES key for the strings of an object, whose key
+ * pdf_compute_object_key has just put in the cache.
+ */
+
+static fz_aes *
+pdf_string_aes_key(pdf_crypt *crypt, int num, unsigned char *key, int keylen)
+{
+	pdf_object_key *slot;
+
+	if (crypt->strf.method == PDF_CRYPT_AESV3)
+	{
+		if (!crypt->aes)
+		{
+			crypt->aes = fz_malloc(sizeof(fz_aes));
+			aes_setkey_dec(crypt->aes, key, keylen * 8);
+		}
+		return crypt->aes;
+	}
+
+	slot = &crypt->keys[num & (PDF_OBJECT_KEY_CACHE - 1)];
+	if (!slot->has_aes)
+	{
+		if (!slot->aes)
+			slot->aes = fz_malloc(sizeof(fz_aes));
+		aes_setkey_dec(slot->aes, key, keylen * 8);
+		slot->has_aes = 1;
+	}
+	return slot->aes;
 }
 
 /*
  * PDF 1.7 algorithm 3.1 and ExtensionLevel 3 algorithm 3.1a
  *
- * Decrypt all strings in obj modifying the data in-place.
+ * Decrypt a string in place, returning its new length.
+ * This is called the first time a string from an encrypted
+ * object is looked at.
+ */
+
+int
+pdf_decrypt_string(void *crypt_, int num, int gen, unsigned char *s, int n)
+{
+	pdf_crypt *crypt = crypt_;
+	unsigned char key[32];
+	int keylen;
+
+	keylen = pdf_compute_object_key(crypt, &crypt->strf, num, gen, key);
+
+	if (crypt->strf.method == PDF_CRYPT_RC4)
+	{
+		fz_arc4 arc4;
+		fz_arc4_init(&arc4, key, keylen);
+		fz_arc4_encrypt(&arc4, s, s, n);
+	}
+
+	if (crypt->strf.method == PDF_CRYPT_AESV2 || crypt->strf.method == PDF_CRYPT_AESV3)
+	{
+		if (n & 15 || n < 32)
+			fz_warn("invalid string length for aes encryption");
+		else
+		{
+			unsigned char iv[16];
+			memcpy(iv, s, 16);
+			aes_crypt_cbc(pdf_string_aes_key(crypt, num, key, keylen), AES_DECRYPT, n - 16, iv, s + 16, s);
+			/* delete space used for iv and padding bytes at end */
+			if (s[n - 17] < 1 || s[n - 17] > 16)
+				fz_warn("aes padding out of range");
+			else
+				n = n - 16 - s[n - 17];
+		}
+	}
+
+	return n;
+}
+
+void
+pdf_drop_string_crypt(void *crypt)
+{
+	pdf_drop_crypt(crypt);
+}
+
+/*
+ * Mark all strings in obj to be decrypted when they are first used.
  * Recurse through arrays and dictionaries, but do not follow
  * indirect references.
  */
 
-static void
-pdf_crypt_obj_imp(pdf_crypt *crypt, fz_obj *obj, unsigned char *key, int keylen)
+void
+pdf_crypt_obj(pdf_crypt *crypt, fz_obj *obj, int num, int gen)
 {
-	unsigned char *s;
 	int i, n;
 
 	if (fz_is_indirect(obj))
@@ -717,34 +856,7 @@ pdf_crypt_obj_imp(pdf_crypt *crypt, fz_obj *obj, unsigned char *key, int keylen)
 
 	if (fz_is_string(obj))
 	{
-		s = (unsigned char *) fz_to_str_buf(obj);
-		n = fz_to_str_len(obj);
-
-		if (crypt->strf.method == PDF_CRYPT_RC4)
-		{
-			fz_arc4 arc4;
-			fz_arc4_init(&arc4, key, keylen);
-			fz_arc4_encrypt(&arc4, s, s, n);
-		}
-
-		if (crypt->strf.method == PDF_CRYPT_AESV2 || crypt->strf.method == PDF_CRYPT_AESV3)
-		{
-			if (n & 15 || n < 32)
-				fz_warn("invalid string length for aes encryption");
-			else
-			{
-				unsigned char iv[16];
-				fz_aes aes;
-				memcpy(iv, s, 16);
-				aes_setkey_dec(&aes, key, keylen * 8);
-				aes_crypt_cbc(&aes, AES_DECRYPT, n - 16, iv, s + 16, s);
-				/* delete space used for iv and padding bytes at end */
-				if (s[n - 17] < 1 || s[n - 17] > 16)
-					fz_warn("aes padding out of range");
-				else
-					fz_set_str_len(obj, n - 16 - s[n - 17]);
-			}
-		}
+		fz_set_str_crypt(obj, pdf_keep_crypt(crypt), num, gen);
 	}
 
 	else if (fz_is_array(obj))
@@ -752,7 +864,7 @@ pdf_crypt_obj_imp(pdf_crypt *crypt, fz_obj *obj, unsigned char *key, int keylen)
 		n = fz_array_len(obj);
 		for (i = 0; i < n; i++)
 		{
-			pdf_crypt_obj_imp(crypt, fz_array_get(obj, i), key, keylen);
+			pdf_crypt_obj(crypt, fz_array_get(obj, i), num, gen);
 		}
 	}
 
@@ -761,22 +873,11 @@ pdf_crypt_obj_imp(pdf_crypt *crypt, fz_obj *obj, unsigned char *key, int keylen)
 		n = fz_dict_len(obj);
 		for (i = 0; i < n; i++)
 		{
-			pdf_crypt_obj_imp(crypt, fz_dict_get_val(obj, i), key, keylen);
+			pdf_crypt_obj(crypt, fz_dict_get_val(obj, i), num, gen);
 		}
 	}
 }
 
-void
-pdf_crypt_obj(pdf_crypt *crypt, fz_obj *obj, int num, int gen)
-{
-	unsigned char key[32];
-	int len;
-
-	len = pdf_compute_object_key(crypt, &crypt->strf, num, gen, key);
-
-	pdf_crypt_obj_imp(crypt, obj, key, len);
-}
-
 /*
  * PDF 1.7 algorithm 3.1 and ExtensionLevel 3 algorithm 3.1a
  *
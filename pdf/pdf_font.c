@@ -286,6 +286,10 @@ pdf_load_embedded_font(pdf_font_desc *fontdesc, pdf_xref *xref, fz_obj *stmref)
 	if (error)
 		return fz_rethrow(error, "cannot load font stream (%d %d R)", fz_to_num(stmref), fz_to_gen(stmref));
 
+	/* take a private copy if the data is shared with the file */
+	if (buf->parent || buf->mapped)
+		fz_resize_buffer(buf, buf->len);
+
 	error = fz_new_font_from_memory(&fontdesc->font, buf->data, buf->len, 0);
 	if (error)
 	{
@@ -1,10 +1,7 @@
 #include "fitz.h"
 #include "mupdf.h"
 
-/* TODO: store JPEG compressed samples */
-/* TODO: store flate compressed samples */
-
-static fz_error pdf_load_jpx_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *dict);
+static fz_error pdf_load_jpx_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *dict, int tw, int th);
 
 static void
 pdf_mask_color_key(fz_pixmap *pix, int n, int *colorkey)
@@ -25,8 +22,51 @@ pdf_mask_color_key(fz_pixmap *pix, int n, int *colorkey)
 	}
 }
 
+/*
+ * Find how many times a w x h image can be halved and still be at
+ * least as big as the tw x th pixels it will be drawn at, if we
+ * know that.
+ */
+static int
+pdf_image_l2factor(int w, int h, int tw, int th, int max)
+{
+	int l2factor = 0;
+
+	if (tw <= 0 || th <= 0)
+		return 0;
+
+	while (l2factor < max)
+	{
+		int d = 2 << l2factor;
+		if ((w + d - 1) / d < tw || (h + d - 1) / d < th)
+			break;
+		l2factor++;
+	}
+
+	return l2factor;
+}
+
+/*
+ * A JPEG can be decoded at 1/2, 1/4 or 1/8 size for much less
+ * than the cost of decoding it at full size.
+ */
+static int
+pdf_is_dct_image(fz_obj *dict)
+{
+	fz_obj *filter;
+
+	filter = fz_dict_getsa(dict, "Filter", "F");
+	if (fz_is_array(filter))
+		filter = fz_array_get(filter, fz_array_len(filter) - 1);
+	return !strcmp(fz_to_name(filter), "DCTDecode") || !strcmp(fz_to_name(filter), "DCT");
+}
+
+/*
+ * Decode the samples of an image to a pixmap, at no more than tw x th
+ * if that's cheap. The explicit mask is not loaded here.
+ */
 static fz_error
-pdf_load_image_imp(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict, fz_stream *cstm, int forcemask)
+pdf_decode_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict, fz_stream *cstm, int forcemask, int tw, int th)
 {
 	fz_stream *stm;
 	fz_pixmap *tile;
@@ -38,20 +78,22 @@ pdf_load_image_imp(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict,
 	int interpolate;
 	int indexed;
 	fz_colorspace *colorspace;
-	fz_pixmap *mask; /* explicit mask/softmask image */
+	fz_pixmap *mask;
 	int usecolorkey;
 	int colorkey[FZ_MAX_COLORS * 2];
 	float decode[FZ_MAX_COLORS * 2];
 
 	int stride;
 	unsigned char *samples;
+	fz_buffer *buf = NULL;
+	int l2factor, fx, fy;
 	int i, len;
 
 	/* special case for JPEG2000 images */
 	if (pdf_is_jpx_image(dict))
 	{
 		tile = NULL;
-		error = pdf_load_jpx_image(&tile, xref, dict);
+		error = pdf_load_jpx_image(&tile, xref, dict, tw, th);
 		if (error)
 			return fz_rethrow(error, "cannot load jpx image");
 		if (forcemask)
@@ -79,7 +121,6 @@ pdf_load_image_imp(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict,
 	indexed = 0;
 	usecolorkey = 0;
 	colorspace = NULL;
-	mask = NULL;
 
 	if (imagemask)
 		bpc = 1;
@@ -97,6 +138,15 @@ pdf_load_image_imp(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict,
 	if (h > (1 << 16))
 		return fz_throw("image is too high");
 
+	/* inline images are small enough as they are */
+	l2factor = 0;
+	if (!cstm && !imagemask && bpc == 8 && pdf_is_dct_image(dict))
+	{
+		l2factor = pdf_image_l2factor(w, h, tw, th, 3);
+		w = (w + (1 << l2factor) - 1) >> l2factor;
+		h = (h + (1 << l2factor) - 1) >> l2factor;
+	}
+
 	obj = fz_dict_getsa(dict, "ColorSpace", "CS");
 	if (obj && !imagemask && !forcemask)
 	{
@@ -136,42 +186,38 @@ pdf_load_image_imp(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict,
 	}
 
 	obj = fz_dict_getsa(dict, "SMask", "Mask");
-	if (fz_is_dict(obj))
-	{
-		/* Not allowed for inline images */
-		if (!cstm)
-		{
-			error = pdf_load_image_imp(&mask, xref, rdb, obj, NULL, 1);
-			if (error)
-			{
-				if (colorspace)
-					fz_drop_colorspace(colorspace);
-				return fz_rethrow(error, "cannot load image mask/softmask");
-			}
-		}
-	}
-	else if (fz_is_array(obj))
+	if (fz_is_array(obj))
 	{
 		usecolorkey = 1;
 		for (i = 0; i < n * 2; i++)
 			colorkey[i] = fz_to_int(fz_array_get(obj, i));
 	}
 
+	/*
+	 * Average blocks of samples if the image will be drawn much smaller,
+	 * but leave twice the size needed for the draw device to filter. A
+	 * trailing partial block is kept only if it's at least half full, so
+	 * the image is stretched by no more than half a block.
+	 */
+	fx = fy = 1;
+	if (tw > 0 && th > 0 && !usecolorkey)
+	{
+		fx = MAX(1, w / (tw * 2));
+		fy = MAX(1, h / (th * 2));
+	}
+
 	/* Allocate now, to fail early if we run out of memory */
-	tile = fz_new_pixmap_with_limit(colorspace, w, h);
+	tile = fz_new_pixmap_with_limit(colorspace, (w + fx / 2) / fx, (h + fy / 2) / fy);
 	if (!tile)
 	{
 		if (colorspace)
 			fz_drop_colorspace(colorspace);
-		if (mask)
-			fz_drop_pixmap(mask);
 		return fz_throw("out of memory");
 	}
 
 	if (colorspace)
 		fz_drop_colorspace(colorspace);
 
-	tile->mask = mask;
 	tile->interpolate = interpolate;
 
 	stride = (w * n * bpc + 7) / 8;
@@ -179,40 +225,45 @@ pdf_load_image_imp(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict,
 	if (cstm)
 	{
 		stm = pdf_open_inline_stream(cstm, xref, dict, stride * h);
-	}
-	else
-	{
-		error = pdf_open_stream(&stm, xref, fz_to_num(dict), fz_to_gen(dict));
-		if (error)
+
+		samples = fz_calloc(h, stride);
+
+		len = fz_read(stm, samples, h * stride);
+		if (len < 0)
 		{
+			fz_close(stm);
+			fz_free(samples);
 			fz_drop_pixmap(tile);
-			return fz_rethrow(error, "cannot open image data stream (%d 0 R)", fz_to_num(dict));
+			return fz_rethrow(len, "cannot read image data");
 		}
-	}
 
-	samples = fz_calloc(h, stride);
+		/* Make sure we read the EOF marker (for inline images only) */
+		{
+			unsigned char tbuf[512];
+			int tlen = fz_read(stm, tbuf, sizeof tbuf);
+			if (tlen < 0)
+				fz_catch(tlen, "ignoring error at end of image");
+			if (tlen > 0)
+				fz_warn("ignoring garbage at end of image");
+		}
 
-	len = fz_read(stm, samples, h * stride);
-	if (len < 0)
-	{
 		fz_close(stm);
-		fz_free(samples);
-		fz_drop_pixmap(tile);
-		return fz_rethrow(len, "cannot read image data");
 	}
-
-	/* Make sure we read the EOF marker (for inline images only) */
-	if (cstm)
+	else
 	{
-		unsigned char tbuf[512];
-		int tlen = fz_read(stm, tbuf, sizeof tbuf);
-		if (tlen < 0)
-			fz_catch(tlen, "ignoring error at end of image");
-		if (tlen > 0)
-			fz_warn("ignoring garbage at end of image");
-	}
+		error = pdf_load_image_stream(&buf, xref, fz_to_num(dict), fz_to_gen(dict), stride * h, l2factor);
+		if (error)
+		{
+			fz_drop_pixmap(tile);
+			return fz_rethrow(error, "cannot load image data stream (%d 0 R)", fz_to_num(dict));
+		}
 
-	fz_close(stm);
+		/* we need the whole image in writable memory of our own */
+		len = MIN(buf->len, stride * h);
+		if (buf->cap < stride * h || buf->parent || buf->mapped)
+			fz_resize_buffer(buf, stride * h);
+		samples = buf->data;
+	}
 
 	/* Pad truncated images */
 	if (len < stride * h)
@@ -231,9 +282,15 @@ pdf_load_image_imp(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict,
 			p[i] = ~p[i];
 	}
 
-	fz_unpack_tile(tile, samples, n, bpc, stride, indexed);
+	if (fx > 1 || fy > 1)
+		fz_unpack_tile_reduced(tile, samples, w, h, n, bpc, stride, indexed, fx, fy);
+	else
+		fz_unpack_tile(tile, samples, n, bpc, stride, indexed);
 
-	fz_free(samples);
+	if (buf)
+		fz_drop_buffer(buf);
+	else
+		fz_free(samples);
 
 	if (usecolorkey)
 		pdf_mask_color_key(tile, n, colorkey);
@@ -256,14 +313,19 @@ pdf_load_image_imp(fz_pixmap **imgp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict,
 }
 
 fz_error
-pdf_load_inline_image(fz_pixmap **pixp, pdf_xref *xref, fz_obj *rdb, fz_obj *dict, fz_stream *file)
+pdf_load_inline_image(fz_image **imagep, pdf_xref *xref, fz_obj *rdb, fz_obj *dict, fz_stream *file)
 {
 	fz_error error;
+	fz_pixmap *tile;
 
-	error = pdf_load_image_imp(pixp, xref, rdb, dict, file, 0);
+	/* the data is in the content stream, so decode it now */
+	error = pdf_decode_image(&tile, xref, rdb, dict, file, 0, 0, 0);
 	if (error)
 		return fz_rethrow(error, "cannot load inline image");
 
+	*imagep = fz_new_image_from_pixmap(tile);
+	fz_drop_pixmap(tile);
+
 	return fz_okay;
 }
 
@@ -283,13 +345,14 @@ pdf_is_jpx_image(fz_obj *dict)
 }
 
 static fz_error
-pdf_load_jpx_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *dict)
+pdf_load_jpx_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *dict, int tw, int th)
 {
 	fz_error error;
 	fz_buffer *buf;
 	fz_colorspace *colorspace;
 	fz_pixmap *img;
 	fz_obj *obj;
+	int w, h, l2factor;
 
 	colorspace = NULL;
 
@@ -305,7 +368,12 @@ pdf_load_jpx_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *dict)
 			fz_catch(error, "cannot load image colorspace");
 	}
 
-	error = fz_load_jpx_image(&img, buf->data, buf->len, colorspace);
+	/* only decode the wavelet levels we need */
+	w = fz_to_int(fz_dict_gets(dict, "Width"));
+	h = fz_to_int(fz_dict_gets(dict, "Height"));
+	l2factor = pdf_image_l2factor(w, h, tw, th, 16);
+
+	error = fz_load_jpx_image(&img, buf->data, buf->len, colorspace, l2factor);
 	if (error)
 	{
 		if (colorspace)
@@ -318,37 +386,247 @@ pdf_load_jpx_image(fz_pixmap **imgp, pdf_xref *xref, fz_obj *dict)
 		fz_drop_colorspace(colorspace);
 	fz_drop_buffer(buf);
 
+	*imgp = img;
+	return fz_okay;
+}
+
+/*
+ * Images from the file are only decoded when drawn. Until then
+ * we keep no more than the object to decode them from.
+ */
+
+typedef struct pdf_image_s pdf_image;
+
+struct pdf_image_s
+{
+	pdf_xref *xref;
+	fz_obj *dict;
+	int forcemask;
+	int invert;
+	pdf_image *prev, *next;
+};
+
+/*
+ * Images can outlive the document, in a display list for example. When
+ * the xref is freed the images that still decode from it are cut loose,
+ * and decoding them again fails.
+ */
+void
+pdf_detach_images(pdf_xref *xref)
+{
+	pdf_image *img, *next;
+
+	for (img = xref->images; img; img = next)
+	{
+		next = img->next;
+		img->xref = NULL;
+		img->prev = NULL;
+		img->next = NULL;
+	}
+	xref->images = NULL;
+}
+
+static fz_error
+pdf_load_image_pixmap(fz_pixmap **pixp, void *state, int w, int h)
+{
+	pdf_image *img = state;
+	fz_error error;
+
+	if (!img->xref)
+		return fz_throw("document of image (%d 0 R) is closed", fz_to_num(img->dict));
+
+	error = pdf_decode_image(pixp, img->xref, NULL, img->dict, NULL, img->forcemask, w, h);
+	if (error)
+		return fz_rethrow(error, "cannot decode image (%d 0 R)", fz_to_num(img->dict));
+	return fz_okay;
+}
+
+/*
+ * Bilevel images and masks are drawn straight from their packed samples,
+ * which is what the fax and JBIG2 decoders produce. The bits are inverted
+ * where needed so that set bits are opaque in masks and white in images.
+ */
+static int
+pdf_is_bitmap_image(fz_obj *dict, fz_colorspace *colorspace, int forcemask, int *invert)
+{
+	fz_obj *obj;
+	float d0, d1;
+	int imagemask;
+
+	imagemask = fz_to_bool(fz_dict_getsa(dict, "ImageMask", "IM"));
+	if (!imagemask && fz_to_int(fz_dict_getsa(dict, "BitsPerComponent", "BPC")) != 1)
+		return 0;
+	if (!imagemask && !forcemask && colorspace != fz_device_gray)
+		return 0;
+	if (fz_to_bool(fz_dict_getsa(dict, "Interpolate", "I")))
+		return 0;
+	if (fz_is_array(fz_dict_getsa(dict, "SMask", "Mask")))
+		return 0;
+	if (pdf_is_jpx_image(dict))
+		return 0;
+
+	d0 = 0;
+	d1 = 1;
+	obj = fz_dict_getsa(dict, "Decode", "D");
+	if (obj)
+	{
+		d0 = fz_to_real(fz_array_get(obj, 0));
+		d1 = fz_to_real(fz_array_get(obj, 1));
+	}
+	if (!((d0 == 0 && d1 == 1) || (d0 == 1 && d1 == 0)))
+		return 0;
+
+	/* 0=opaque and 1=transparent in image masks */
+	if (imagemask)
+		*invert = d0 == 0;
+	else
+		*invert = d0 == 1;
+	return 1;
+}
+
+static fz_error
+pdf_load_image_bitmap(fz_bitmap **bitp, void *state)
+{
+	pdf_image *img = state;
+	fz_error error;
+	fz_buffer *buf;
+	fz_bitmap *bit;
+	unsigned char *s, *d;
+	int w, h, stride, len;
+	int x, y;
+
+	if (!img->xref)
+		return fz_throw("document of image (%d 0 R) is closed", fz_to_num(img->dict));
+
+	w = fz_to_int(fz_dict_getsa(img->dict, "Width", "W"));
+	h = fz_to_int(fz_dict_getsa(img->dict, "Height", "H"));
+	if (w > (1 << 16) || h > (1 << 16))
+		return fz_throw("image is too large");
+	stride = (w + 7) / 8;
+
+	error = pdf_load_image_stream(&buf, img->xref, fz_to_num(img->dict), fz_to_gen(img->dict), stride * h, 0);
+	if (error)
+		return fz_rethrow(error, "cannot load image data stream (%d 0 R)", fz_to_num(img->dict));
+
+	len = MIN(buf->len, stride * h);
+	if (len < stride * h)
+		fz_warn("padding truncated image (%d 0 R)", fz_to_num(img->dict));
+
+	bit = fz_new_bitmap(w, h, 1);
+	for (y = 0; y < h; y++)
+	{
+		s = buf->data + y * stride;
+		d = bit->samples + y * bit->stride;
+		x = CLAMP(len - y * stride, 0, stride);
+		memcpy(d, s, x);
+		memset(d + x, 0, bit->stride - x);
+		if (img->invert)
+			for (x = 0; x < stride; x++)
+				d[x] = ~d[x];
+	}
+
+	fz_drop_buffer(buf);
+
+	*bitp = bit;
+	return fz_okay;
+}
+
+static void
+pdf_free_image(void *state)
+{
+	pdf_image *img = state;
+
+	if (img->prev)
+		img->prev->next = img->next;
+	else if (img->xref)
+		img->xref->images = img->next;
+	if (img->next)
+		img->next->prev = img->prev;
+
+	fz_drop_obj(img->dict);
+	fz_free(img);
+}
+
+static fz_error
+pdf_load_image_imp(fz_image **imagep, pdf_xref *xref, fz_obj *dict, int forcemask)
+{
+	fz_error error;
+	fz_colorspace *colorspace;
+	fz_image *image;
+	pdf_image *img;
+	fz_obj *obj;
+	int w, h;
+
+	w = fz_to_int(fz_dict_getsa(dict, "Width", "W"));
+	h = fz_to_int(fz_dict_getsa(dict, "Height", "H"));
+
+	if (w <= 0)
+		return fz_throw("image width is zero");
+	if (h <= 0)
+		return fz_throw("image height is zero");
+
+	/* only whether it's a mask matters until it's decoded */
+	colorspace = NULL;
+	obj = fz_dict_getsa(dict, "ColorSpace", "CS");
+	if (forcemask || fz_to_bool(fz_dict_getsa(dict, "ImageMask", "IM")))
+		colorspace = NULL;
+	else if (obj)
+	{
+		error = pdf_load_colorspace(&colorspace, xref, obj);
+		if (error)
+			return fz_rethrow(error, "cannot load image colorspace");
+	}
+	else if (pdf_is_jpx_image(dict))
+		colorspace = fz_keep_colorspace(fz_device_rgb); /* the real one is in the file */
+
+	img = fz_malloc(sizeof(pdf_image));
+	img->xref = xref;
+	img->dict = fz_keep_obj(dict);
+	img->forcemask = forcemask;
+	img->invert = 0;
+	img->prev = NULL;
+	img->next = xref->images;
+	if (xref->images)
+		xref->images->prev = img;
+	xref->images = img;
+
+	image = fz_new_image(w, h, colorspace, img, pdf_load_image_pixmap, pdf_free_image);
+	if (pdf_is_bitmap_image(dict, colorspace, forcemask, &img->invert))
+		image->load_bitmap = pdf_load_image_bitmap;
+	if (colorspace)
+		fz_drop_colorspace(colorspace);
+
 	obj = fz_dict_getsa(dict, "SMask", "Mask");
-	if (fz_is_dict(obj))
+	if (fz_is_dict(obj) && !forcemask)
 	{
-		error = pdf_load_image_imp(&img->mask, xref, NULL, obj, NULL, 1);
+		error = pdf_load_image_imp(&image->mask, xref, obj, 1);
 		if (error)
 		{
-			fz_drop_pixmap(img);
+			fz_drop_image(image);
 			return fz_rethrow(error, "cannot load image mask/softmask");
 		}
 	}
 
-	*imgp = img;
+	*imagep = image;
 	return fz_okay;
 }
 
 fz_error
-pdf_load_image(fz_pixmap **pixp, pdf_xref *xref, fz_obj *dict)
+pdf_load_image(fz_image **imagep, pdf_xref *xref, fz_obj *dict)
 {
 	fz_error error;
 
-	if ((*pixp = pdf_find_item(xref->store, fz_drop_pixmap, dict)))
+	if ((*imagep = pdf_find_item(xref->store, fz_drop_image, dict)))
 	{
-		fz_keep_pixmap(*pixp);
+		fz_keep_image(*imagep);
 		return fz_okay;
 	}
 
-	error = pdf_load_image_imp(pixp, xref, NULL, dict, NULL, 0);
+	error = pdf_load_image_imp(imagep, xref, dict, 0);
 	if (error)
 		return fz_rethrow(error, "cannot load image (%d 0 R)", fz_to_num(dict));
 
-	pdf_store_item(xref->store, fz_keep_pixmap, fz_drop_pixmap, dict, *pixp);
+	pdf_store_item(xref->store, fz_keep_image, fz_drop_image, dict, *imagep);
 
 	return fz_okay;
 }
@@ -0,0 +1,421 @@
+#include "fitz.h"
+#include "mupdf.h"
+
+#include <sys/stat.h>
+
+/*
+ * Sidecar document index.
+ *
+ * Opening a big or broken file means reading the whole xref (or scanning
+ * the whole file to repair it) and walking the page tree. The index keeps
+ * the result of that in a small binary file next to the document, so the
+ * next open can pick it straight up from a memory mapped buffer.
+ *
+ * The index is tied to the size, modification time and a digest of the
+ * tail of the file. If any of these change it is ignored and written anew.
+ *
+ * Layout, all numbers little endian:
+ *
+ *	magic[8] size[8] mtime[8] digest[16]
+ *	version[4] startxref[8] length[8]
+ *	len[4] then len times: type[1] gen[2] ofs[8]
+ *	pages[4] then pages times: num[4] gen[2]
+ *	pinned[4] then pinned times: num[4] stm_ofs[8]
+ *	trailer and pinned objects as text
+ *
+ * The length is that of the whole index, so a truncated or overwritten
+ * file is caught before any of the counts in it are trusted.
+ */
+
+static const char index_magic[8] = { 'M', 'U', 'P', 'D', 'F', 'I', 'X', '2' };
+
+enum
+{
+	INDEX_HEADER = 64,
+	INDEX_LENGTH = 52,
+	INDEX_ENTRY = 11,
+	INDEX_PAGE = 6,
+	INDEX_PINNED = 12,
+	INDEX_DIGEST_TAIL = 4096,
+};
+
+static inline unsigned int get16(unsigned char *p)
+{
+	return p[0] | p[1] << 8;
+}
+
+static inline unsigned int get32(unsigned char *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (unsigned int)p[3] << 24;
+}
+
+static inline fz_off_t get64(unsigned char *p)
+{
+	return (fz_off_t)get32(p) | (fz_off_t)get32(p + 4) << 32;
+}
+
+static void put16(FILE *fp, unsigned int v)
+{
+	putc(v & 0xff, fp);
+	putc((v >> 8) & 0xff, fp);
+}
+
+static void put32(FILE *fp, unsigned int v)
+{
+	put16(fp, v & 0xffff);
+	put16(fp, v >> 16);
+}
+
+static void put64(FILE *fp, fz_off_t v)
+{
+	put32(fp, v & 0xffffffff);
+	put32(fp, (v >> 32) & 0xffffffff);
+}
+
+static fz_error
+pdf_index_digest(pdf_xref *xref, fz_off_t size, unsigned char digest[16])
+{
+	unsigned char buf[INDEX_DIGEST_TAIL];
+	fz_md5 md5;
+	int n;
+
+	fz_seek(xref->file, MAX(0, size - INDEX_DIGEST_TAIL), 0);
+	n = fz_read(xref->file, buf, sizeof buf);
+	if (n < 0)
+		return fz_rethrow(n, "cannot read from file");
+
+	fz_md5_init(&md5);
+	fz_md5_update(&md5, buf, n);
+	fz_md5_final(&md5, digest);
+	return fz_okay;
+}
+
+/* An index that is out of date is not an error, it just sets *okp to 0 */
+static fz_error
+pdf_check_index(pdf_xref *xref, const char *filename, unsigned char *p, int *okp)
+{
+	fz_error error;
+	unsigned char digest[16];
+	struct stat st;
+
+	*okp = 0;
+
+	if (stat(filename, &st) < 0)
+		return fz_throw("cannot stat file '%s': %s", filename, strerror(errno));
+	if (get64(p + 8) != (fz_off_t)st.st_size || get64(p + 16) != (fz_off_t)st.st_mtime)
+		return fz_okay;
+
+	error = pdf_index_digest(xref, st.st_size, digest);
+	if (error)
+		return fz_rethrow(error, "cannot check document index");
+	if (memcmp(p + 24, digest, 16))
+		return fz_okay;
+
+	*okp = 1;
+	return fz_okay;
+}
+
+static fz_error
+pdf_parse_index_objects(pdf_xref *xref, unsigned char *p, unsigned char *ep, fz_obj **objs, int n)
+{
+	fz_error error;
+	fz_stream *stm;
+	int i;
+
+	stm = fz_open_memory(p, ep - p);
+	for (i = 0; i < n; i++)
+	{
+		error = pdf_parse_stm_obj(&objs[i], xref, stm, xref->scratch, sizeof xref->scratch);
+		if (error)
+		{
+			while (i--)
+				fz_drop_obj(objs[i]);
+			fz_close(stm);
+			return fz_rethrow(error, "cannot parse object in document index");
+		}
+	}
+	fz_close(stm);
+
+	return fz_okay;
+}
+
+static fz_error
+pdf_read_index(pdf_xref *xref, const char *filename, unsigned char *p, unsigned char *ep)
+{
+	fz_error error;
+	unsigned char *base, *table, *pages, *pinned;
+	unsigned int len, page_len, pin_len, i, num;
+	fz_obj **objs;
+	int ok;
+
+	/* not an index at all, treat it as missing */
+	if (ep - p < sizeof index_magic || memcmp(p, index_magic, sizeof index_magic))
+		return fz_okay;
+
+	if (ep - p < INDEX_HEADER)
+		return fz_throw("document index is truncated");
+
+	error = pdf_check_index(xref, filename, p, &ok);
+	if (error)
+		return fz_rethrow(error, "cannot use document index");
+	if (!ok)
+		return fz_okay;
+
+	if (get64(p + INDEX_LENGTH) != (fz_off_t)(ep - p))
+		return fz_throw("document index has wrong length");
+
+	base = p;
+	len = get32(p + 60);
+	table = p + INDEX_HEADER;
+	if (len < 1 || (unsigned)(ep - table) / INDEX_ENTRY < len)
+		return fz_throw("document index has bad entry count");
+
+	p = table + len * INDEX_ENTRY;
+	if (ep - p < 4)
+		return fz_throw("document index is truncated");
+	page_len = get32(p);
+	pages = p + 4;
+	if ((unsigned)(ep - pages) / INDEX_PAGE < page_len)
+		return fz_throw("document index is truncated");
+
+	p = pages + page_len * INDEX_PAGE;
+	if (ep - p < 4)
+		return fz_throw("document index is truncated");
+	pin_len = get32(p);
+	pinned = p + 4;
+	if ((unsigned)(ep - pinned) / INDEX_PINNED < pin_len)
+		return fz_throw("document index is truncated");
+
+	for (i = 0; i < pin_len; i++)
+		if (get32(pinned + i * INDEX_PINNED) >= len)
+			return fz_throw("object out of range in document index");
+
+	/* parse everything before touching the xref, so a bad index leaves no trace */
+	p = pinned + pin_len * INDEX_PINNED;
+	objs = fz_calloc(pin_len + 1, sizeof(fz_obj*));
+	error = pdf_parse_index_objects(xref, p, ep, objs, pin_len + 1);
+	if (error)
+	{
+		fz_free(objs);
+		return fz_rethrow(error, "cannot read document index");
+	}
+	if (!fz_is_dict(objs[0]))
+	{
+		for (i = 0; i <= pin_len; i++)
+			fz_drop_obj(objs[i]);
+		fz_free(objs);
+		return fz_throw("trailer missing in document index");
+	}
+
+	xref->version = get32(base + 40);
+	xref->startxref = get64(base + 44);
+	xref->file_size = get64(base + 8);
+	xref->trailer = objs[0];
+
+	pdf_resize_xref(xref, len);
+	for (i = 0, p = table; i < len; i++, p += INDEX_ENTRY)
+	{
+		xref->table[i].type = p[0];
+		xref->table[i].gen = get16(p + 1);
+		xref->table[i].ofs = get64(p + 3);
+	}
+
+	for (i = 0, p = pinned; i < pin_len; i++, p += INDEX_PINNED)
+	{
+		num = get32(p);
+		pdf_set_cached_object(xref, num, objs[i + 1]);
+		pdf_set_stream_offset(xref, num, get64(p + 4));
+		fz_drop_obj(objs[i + 1]);
+	}
+	fz_free(objs);
+
+	/* every page is known, so there is never a need to walk the tree */
+	xref->page_cap = page_len;
+	xref->page_len = page_len;
+	xref->page_walked = 1;
+	xref->page_refs = fz_calloc(page_len, sizeof(fz_obj*));
+	xref->page_objs = fz_calloc(page_len, sizeof(fz_obj*));
+	memset(xref->page_objs, 0, page_len * sizeof(fz_obj*));
+	for (i = 0, p = pages; i < page_len; i++, p += INDEX_PAGE)
+	{
+		num = get32(p);
+		if (num > 0 && num < len)
+			xref->page_refs[i] = fz_new_indirect(num, get16(p + 4), xref);
+		else
+			xref->page_refs[i] = NULL;
+	}
+
+	return fz_okay;
+}
+
+/*
+ * Fill in the xref, trailer and page list from the index. A missing or out
+ * of date index is not an error, the xref table is simply left empty. If
+ * the index is broken, an error is returned and the xref is untouched.
+ */
+
+fz_error
+pdf_load_index(pdf_xref *xref, const char *filename, const char *indexname)
+{
+	fz_error error;
+	fz_stream *stm;
+	fz_buffer *buf;
+	fz_off_t len;
+
+	stm = fz_open_file(indexname);
+	if (!stm)
+		return fz_okay;
+
+	fz_seek(stm, 0, 2);
+	len = fz_tell(stm);
+	fz_seek(stm, 0, 0);
+
+	/* share the mapped file if we can, otherwise read it in */
+	buf = len <= INT_MAX ? fz_slice_stream(stm, 0, len) : NULL;
+	if (!buf)
+	{
+		error = fz_read_all(&buf, stm, len <= INT_MAX ? len : 0);
+		if (error)
+		{
+			fz_close(stm);
+			return fz_rethrow(error, "cannot read document index '%s'", indexname);
+		}
+	}
+	fz_close(stm);
+
+	error = pdf_read_index(xref, filename, buf->data, buf->data + buf->len);
+	fz_drop_buffer(buf);
+	if (error)
+		return fz_rethrow(error, "cannot load document index '%s'", indexname);
+
+	return fz_okay;
+}
+
+static void
+pdf_write_index(FILE *fp, pdf_xref *xref, struct stat *st, unsigned char digest[16])
+{
+	pdf_xref_entry *x;
+	fz_obj *ref;
+	long end;
+	int i, n;
+
+	fwrite(index_magic, 1, sizeof index_magic, fp);
+	put64(fp, st->st_size);
+	put64(fp, st->st_mtime);
+	fwrite(digest, 1, 16, fp);
+	put32(fp, xref->version);
+	put64(fp, xref->startxref);
+	put64(fp, 0); /* length, filled in at the end */
+
+	put32(fp, xref->len);
+	for (i = 0; i < xref->len; i++)
+	{
+		x = &xref->table[i];
+		putc(x->type, fp);
+		put16(fp, x->gen);
+		put64(fp, x->ofs);
+	}
+
+	put32(fp, xref->page_len);
+	for (i = 0; i < xref->page_len; i++)
+	{
+		ref = xref->page_refs[i];
+		put32(fp, fz_is_indirect(ref) ? fz_to_num(ref) : 0);
+		put16(fp, fz_is_indirect(ref) ? fz_to_gen(ref) : 0);
+	}
+
+	/* objects fixed up by repair can't be parsed from the file again */
+	for (i = 0, n = 0; i < xref->len; i++)
+		if ((xref->table[i].flags & PDF_XREF_PINNED) && pdf_get_cached_object(xref, i))
+			n++;
+	put32(fp, n);
+	for (i = 0; i < xref->len; i++)
+	{
+		if ((xref->table[i].flags & PDF_XREF_PINNED) && pdf_get_cached_object(xref, i))
+		{
+			put32(fp, i);
+			put64(fp, pdf_get_stream_offset(xref, i));
+		}
+	}
+
+	fz_fprint_obj(fp, xref->trailer, 1);
+	for (i = 0; i < xref->len; i++)
+		if ((xref->table[i].flags & PDF_XREF_PINNED) && pdf_get_cached_object(xref, i))
+			fz_fprint_obj(fp, pdf_get_cached_object(xref, i), 1);
+
+	end = ftell(fp);
+	fseek(fp, INDEX_LENGTH, 0);
+	put64(fp, end);
+}
+
+/*
+ * Write the index for an open document. This looks up every page, so the
+ * page references can be stored along with the xref. The index is written
+ * to a temporary file and renamed into place, so a reader never sees half
+ * of it.
+ */
+
+fz_error
+pdf_save_index(pdf_xref *xref, const char *filename, const char *indexname)
+{
+	fz_error error;
+	unsigned char digest[16];
+	struct stat st;
+	char *tmpname;
+	FILE *fp;
+	int i, n;
+
+	if (stat(filename, &st) < 0)
+		return fz_throw("cannot stat file '%s': %s", filename, strerror(errno));
+
+	error = pdf_index_digest(xref, st.st_size, digest);
+	if (error)
+		return fz_rethrow(error, "cannot write document index");
+
+	error = pdf_load_full_xref(xref);
+	if (error)
+		return fz_rethrow(error, "cannot write document index");
+
+	error = pdf_load_page_tree(xref);
+	if (error)
+		return fz_rethrow(error, "cannot write document index");
+	for (i = 0; i < xref->page_len; i++)
+		pdf_lookup_page_ref(xref, i);
+
+	n = strlen(indexname) + 5;
+	tmpname = fz_malloc(n);
+	fz_strlcpy(tmpname, indexname, n);
+	fz_strlcat(tmpname, ".tmp", n);
+
+	fp = fopen(tmpname, "wb");
+	if (!fp)
+	{
+		error = fz_throw("cannot create document index '%s': %s", tmpname, strerror(errno));
+		fz_free(tmpname);
+		return error;
+	}
+
+	pdf_write_index(fp, xref, &st, digest);
+
+	if (ferror(fp) | fclose(fp))
+	{
+		remove(tmpname);
+		fz_free(tmpname);
+		return fz_throw("cannot write document index '%s'", indexname);
+	}
+
+#ifdef _WIN32
+	/* rename does not replace an existing file here */
+	remove(indexname);
+#endif
+	if (rename(tmpname, indexname) < 0)
+	{
+		error = fz_throw("cannot rename document index '%s': %s", tmpname, strerror(errno));
+		remove(tmpname);
+		fz_free(tmpname);
+		return error;
+	}
+
+	fz_free(tmpname);
+	return fz_okay;
+}
@@ -13,6 +13,14 @@ enum
 	PDF_STROKE,
 };
 
+/* where the text matrix came from, while recording a form */
+enum
+{
+	PDF_TM_FRESH,
+	PDF_TM_INHERITED,
+	PDF_TM_USED,
+};
+
 enum
 {
 	PDF_MAT_NONE,
@@ -89,6 +97,7 @@ struct pdf_csi_s
 	fz_matrix tm;
 	int text_mode;
 	int accumulate;
+	int tm_state;
 
 	/* graphics state */
 	fz_matrix top_ctm;
@@ -96,7 +105,7 @@ struct pdf_csi_s
 	int gtop;
 };
 
-static fz_error pdf_run_buffer(pdf_csi *csi, fz_obj *rdb, fz_buffer *contents);
+static fz_error pdf_run_buffer(pdf_csi *csi, fz_obj *rdb, fz_buffer *contents, fz_obj *key);
 static fz_error pdf_run_xobject(pdf_csi *csi, fz_obj *resources, pdf_xobject *xobj, fz_matrix transform);
 static void pdf_show_pattern(pdf_csi *csi, pdf_pattern *pat, fz_rect area, int what);
 
@@ -182,7 +191,7 @@ pdf_show_shade(pdf_csi *csi, fz_shade *shd)
 }
 
 static void
-pdf_show_image(pdf_csi *csi, fz_pixmap *image)
+pdf_show_image(pdf_csi *csi, fz_image *image)
 {
 	pdf_gstate *gstate = csi->gstate + csi->gtop;
 	fz_rect bbox;
@@ -546,6 +555,9 @@ pdf_show_space(pdf_csi *csi, float tadj)
 		return;
 	}
 
+	if (csi->tm_state == PDF_TM_INHERITED)
+		csi->tm_state = PDF_TM_USED;
+
 	if (fontdesc->wmode == 0)
 		csi->tm = fz_concat(fz_translate(tadj * gstate->scale, 0), csi->tm);
 	else
@@ -566,6 +578,9 @@ pdf_show_string(pdf_csi *csi, unsigned char *buf, int len)
 		return;
 	}
 
+	if (csi->tm_state == PDF_TM_INHERITED)
+		csi->tm_state = PDF_TM_USED;
+
 	while (buf < end)
 	{
 		buf = pdf_decode_cmap(fontdesc->encoding, buf, &cpt);
@@ -677,6 +692,7 @@ pdf_new_csi(pdf_xref *xref, fz_device *dev, fz_matrix ctm, char *target)
 	csi->tm = fz_identity;
 	csi->text_mode = 0;
 	csi->accumulate = 1;
+	csi->tm_state = PDF_TM_FRESH;
 
 	csi->top_ctm = ctm;
 	pdf_init_gstate(&csi->gstate[0], ctm);
@@ -982,7 +998,7 @@ pdf_show_pattern(pdf_csi *csi, pdf_pattern *pat, fz_rect area, int what)
 		gstate->ctm = ptm;
 		csi->top_ctm = gstate->ctm;
 		pdf_gsave(csi);
-		error = pdf_run_buffer(csi, pat->resources, pat->contents);
+		error = pdf_run_buffer(csi, pat->resources, pat->contents, pat->me);
 		if (error)
 			fz_catch(error, "cannot render pattern tile");
 		pdf_grestore(csi);
@@ -1000,7 +1016,7 @@ pdf_show_pattern(pdf_csi *csi, pdf_pattern *pat, fz_rect area, int what)
 				gstate->ctm = fz_concat(fz_translate(x * pat->xstep, y * pat->ystep), ptm);
 				csi->top_ctm = gstate->ctm;
 				pdf_gsave(csi);
-				error = pdf_run_buffer(csi, pat->resources, pat->contents);
+				error = pdf_run_buffer(csi, pat->resources, pat->contents, pat->me);
 				pdf_grestore(csi);
 				while (oldtop < csi->gtop)
 					pdf_grestore(csi);
@@ -1086,7 +1102,7 @@ pdf_run_xobject(pdf_csi *csi, fz_obj *resources, pdf_xobject *xobj, fz_matrix tr
 	if (xobj->resources)
 		resources = xobj->resources;
 
-	error = pdf_run_buffer(csi, resources, xobj->contents);
+	error = pdf_run_buffer(csi, resources, xobj->contents, xobj->me);
 	if (error)
 		fz_catch(error, "cannot interpret XObject stream");
 
@@ -1109,6 +1125,227 @@ pdf_run_xobject(pdf_csi *csi, fz_obj *resources, pdf_xobject *xobj, fz_matrix tr
 	return fz_okay;
 }
 
+/*
+ * Form XObjects that are drawn more than once, such as letterheads and
+ * stamps, are recorded into a display list the second time and replayed
+ * from the store after that. What a form draws depends on the graphics
+ * state it inherits, so the list keeps a copy of that state and is only
+ * replayed when the current state matches.
+ */
+
+typedef struct pdf_form_list_s pdf_form_list;
+
+struct pdf_form_list_s
+{
+	int refs;
+	int uses;		/* -1 if the form can't be replayed */
+	fz_display_list *list;
+	pdf_gstate gstate;	/* inherited state (apart from the ctm) */
+	char target[16];
+	int hints;
+	int flags;		/* device flags set while recording */
+	int check_tm;		/* text was shown with the inherited text matrix */
+	int set_tm;		/* the text matrix was changed by the form */
+	fz_matrix tm0, tlm0, tm1, tlm1;
+};
+
+static pdf_form_list *
+pdf_keep_form_list(pdf_form_list *form)
+{
+	form->refs ++;
+	return form;
+}
+
+static void
+pdf_drop_form_list(pdf_form_list *form)
+{
+	if (form && --form->refs == 0)
+	{
+		if (form->list)
+		{
+			fz_free_display_list(form->list);
+			pdf_drop_material(&form->gstate.stroke);
+			pdf_drop_material(&form->gstate.fill);
+			if (form->gstate.font)
+				pdf_drop_font(form->gstate.font);
+		}
+		fz_free(form);
+	}
+}
+
+static int
+pdf_same_material(pdf_material *a, pdf_material *b)
+{
+	int i;
+
+	if (a->kind != b->kind || a->colorspace != b->colorspace ||
+		a->pattern != b->pattern || a->shade != b->shade || a->alpha != b->alpha)
+		return 0;
+	if (a->colorspace)
+		for (i = 0; i < a->colorspace->n; i++)
+			if (a->v[i] != b->v[i])
+				return 0;
+	return 1;
+}
+
+static int
+pdf_same_stroke_state(fz_stroke_state *a, fz_stroke_state *b)
+{
+	int i;
+
+	if (a->start_cap != b->start_cap || a->dash_cap != b->dash_cap || a->end_cap != b->end_cap ||
+		a->linejoin != b->linejoin || a->linewidth != b->linewidth ||
+		a->miterlimit != b->miterlimit || a->dash_phase != b->dash_phase ||
+		a->dash_len != b->dash_len)
+		return 0;
+	for (i = 0; i < a->dash_len; i++)
+		if (a->dash_list[i] != b->dash_list[i])
+			return 0;
+	return 1;
+}
+
+static int
+pdf_same_matrix(fz_matrix a, fz_matrix b)
+{
+	return a.a == b.a && a.b == b.b && a.c == b.c && a.d == b.d && a.e == b.e && a.f == b.f;
+}
+
+static int
+pdf_form_list_matches(pdf_csi *csi, pdf_form_list *form)
+{
+	pdf_gstate *a = csi->gstate + csi->gtop;
+	pdf_gstate *b = &form->gstate;
+
+	if (csi->dev->hints != form->hints || strcmp(csi->target, form->target))
+		return 0;
+	if (form->check_tm && (!pdf_same_matrix(csi->tm, form->tm0) || !pdf_same_matrix(csi->tlm, form->tlm0)))
+		return 0;
+	return pdf_same_material(&a->fill, &b->fill) &&
+		pdf_same_material(&a->stroke, &b->stroke) &&
+		pdf_same_stroke_state(&a->stroke_state, &b->stroke_state) &&
+		a->char_space == b->char_space &&
+		a->word_space == b->word_space &&
+		a->scale == b->scale &&
+		a->leading == b->leading &&
+		a->font == b->font &&
+		a->size == b->size &&
+		a->render == b->render &&
+		a->rise == b->rise &&
+		a->blendmode == b->blendmode;
+}
+
+static fz_error
+pdf_record_form(pdf_csi *csi, pdf_xobject *xobj, pdf_form_list *form)
+{
+	fz_error error;
+	pdf_gstate *gstate = csi->gstate + csi->gtop;
+	fz_device *dev = csi->dev;
+	fz_display_list *list;
+	fz_matrix ctm = gstate->ctm;
+	int tm_state = csi->tm_state;
+
+	/* draw the form directly if it is used again while recording */
+	form->uses = -1;
+
+	memcpy(&form->gstate, gstate, sizeof(pdf_gstate));
+	pdf_keep_material(&form->gstate.stroke);
+	pdf_keep_material(&form->gstate.fill);
+	if (form->gstate.font)
+		pdf_keep_font(form->gstate.font);
+	fz_strlcpy(form->target, csi->target, sizeof form->target);
+	form->hints = dev->hints;
+	form->tm0 = csi->tm;
+	form->tlm0 = csi->tlm;
+
+	/* record in the space of the parent, and draw with the real ctm */
+	list = fz_new_display_list();
+	csi->dev = fz_new_list_device(list);
+	csi->dev->hints = dev->hints;
+	csi->tm_state = PDF_TM_INHERITED;
+	gstate->ctm = fz_identity;
+
+	error = pdf_run_xobject(csi, xobj->resources, xobj, fz_identity);
+
+	gstate->ctm = ctm;
+	form->flags = csi->dev->flags;
+	fz_free_device(csi->dev);
+	csi->dev = dev;
+	dev->flags |= form->flags;
+
+	form->tm1 = csi->tm;
+	form->tlm1 = csi->tlm;
+	form->set_tm = !pdf_same_matrix(form->tm0, form->tm1) || !pdf_same_matrix(form->tlm0, form->tlm1);
+	form->check_tm = csi->tm_state == PDF_TM_USED || (csi->tm_state == PDF_TM_INHERITED && form->set_tm);
+	if (csi->tm_state == PDF_TM_USED && tm_state == PDF_TM_INHERITED)
+		csi->tm_state = PDF_TM_USED;
+	else
+		csi->tm_state = tm_state;
+
+	fz_execute_display_list(list, dev, ctm, fz_infinite_bbox);
+
+	/* text or a path left unfinished would not be in the list */
+	if (error || csi->text || csi->accumulate != 1 || csi->path->len > 0)
+	{
+		fz_free_display_list(list);
+		pdf_drop_material(&form->gstate.stroke);
+		pdf_drop_material(&form->gstate.fill);
+		if (form->gstate.font)
+			pdf_drop_font(form->gstate.font);
+	}
+	else
+	{
+		form->list = list;
+	}
+
+	return error;
+}
+
+static fz_error
+pdf_run_form(pdf_csi *csi, pdf_xobject *xobj)
+{
+	fz_error error;
+	pdf_gstate *gstate = csi->gstate + csi->gtop;
+	pdf_store *store = csi->xref->store;
+	pdf_form_list *form;
+
+	if (!store || !xobj->me || csi->in_text || csi->text ||
+		csi->accumulate != 1 || csi->path->len > 0 || gstate->softmask)
+		return pdf_run_xobject(csi, xobj->resources, xobj, fz_identity);
+
+	form = pdf_find_item(store, pdf_drop_form_list, xobj->me);
+	if (form)
+	{
+		pdf_keep_form_list(form);
+	}
+	else
+	{
+		form = fz_malloc(sizeof(pdf_form_list));
+		form->refs = 1;
+		form->uses = 0;
+		form->list = NULL;
+		pdf_store_item(store, pdf_keep_form_list, pdf_drop_form_list, xobj->me, form);
+	}
+
+	if (form->list && pdf_form_list_matches(csi, form))
+	{
+		csi->dev->flags |= form->flags;
+		fz_execute_display_list(form->list, csi->dev, gstate->ctm, fz_infinite_bbox);
+		if (form->set_tm)
+		{
+			csi->tm = form->tm1;
+			csi->tlm = form->tlm1;
+		}
+		error = fz_okay;
+	}
+	else if (form->list || form->uses < 0 || ++form->uses < 2)
+		error = pdf_run_xobject(csi, xobj->resources, xobj, fz_identity);
+	else
+		error = pdf_record_form(csi, xobj, form);
+
+	pdf_drop_form_list(form);
+	return error;
+}
+
 static fz_error
 pdf_run_extgstate(pdf_csi *csi, fz_obj *rdb, fz_obj *extgstate)
 {
@@ -1265,7 +1502,7 @@ static fz_error pdf_run_BI(pdf_csi *csi, fz_obj *rdb, fz_stream *file)
 	fz_error error;
 	char *buf = csi->xref->scratch;
 	int buflen = sizeof(csi->xref->scratch);
-	fz_pixmap *img;
+	fz_image *img;
 	fz_obj *obj;
 
 	error = pdf_parse_dict(&obj, csi->xref, file, buf, buflen);
@@ -1285,7 +1522,7 @@ static fz_error pdf_run_BI(pdf_csi *csi, fz_obj *rdb, fz_stream *file)
 
 	pdf_show_image(csi, img);
 
-	fz_drop_pixmap(img);
+	fz_drop_image(img);
 
 	/* find EI */
 	ch = fz_read_byte(file);
@@ -1312,6 +1549,7 @@ static void pdf_run_BT(pdf_csi *csi)
 	csi->in_text = 1;
 	csi->tm = fz_identity;
 	csi->tlm = fz_identity;
+	csi->tm_state = PDF_TM_FRESH;
 }
 
 static void pdf_run_BX(pdf_csi *csi)
@@ -1419,7 +1657,7 @@ static fz_error pdf_run_Do(pdf_csi *csi, fz_obj *rdb)
 		if (!xobj->resources)
 			xobj->resources = fz_keep_obj(rdb);
 
-		error = pdf_run_xobject(csi, xobj->resources, xobj, fz_identity);
+		error = pdf_run_form(csi, xobj);
 		if (error)
 			return fz_rethrow(error, "cannot draw xobject (%d %d R)", fz_to_num(obj), fz_to_gen(obj));
 
@@ -1430,12 +1668,12 @@ static fz_error pdf_run_Do(pdf_csi *csi, fz_obj *rdb)
 	{
 		if ((csi->dev->hints & FZ_IGNORE_IMAGE) == 0)
 		{
-			fz_pixmap *img;
+			fz_image *img;
 			error = pdf_load_image(&img, csi->xref, obj);
 			if (error)
 				return fz_rethrow(error, "cannot load image (%d %d R)", fz_to_num(obj), fz_to_gen(obj));
 			pdf_show_image(csi, img);
-			fz_drop_pixmap(img);
+			fz_drop_image(img);
 		}
 	}
 
@@ -1992,10 +2230,9 @@ static void pdf_run_dquote(pdf_csi *csi)
 #define B(a,b) (a | b << 8)
 #define C(a,b,c) (a | b << 8 | c << 16)
 
-static fz_error
-pdf_run_keyword(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf)
+static int
+pdf_keyword_key(char *buf)
 {
-	fz_error error;
 	int key;
 
 	key = buf[0];
@@ -2010,6 +2247,14 @@ pdf_run_keyword(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf)
 		}
 	}
 
+	return key;
+}
+
+static fz_error
+pdf_run_keyword(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf, int key)
+{
+	fz_error error;
+
 	switch (key)
 	{
 	case A('"'): pdf_run_dquote(csi); break;
@@ -2117,6 +2362,8 @@ pdf_run_stream(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf, int buflen
 {
 	fz_error error;
 	int tok, len, in_array;
+	fz_off_t ival;
+	float fval;
 
 	/* make sure we have a clean slate if we come here from flush_text */
 	pdf_clear_stack(csi);
@@ -2127,7 +2374,7 @@ pdf_run_stream(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf, int buflen
 		if (csi->top == nelem(csi->stack) - 1)
 			return fz_throw("stack overflow");
 
-		error = pdf_lex(&tok, file, buf, buflen, &len);
+		error = pdf_lex_value(&tok, file, buf, buflen, &len, &ival, &fval);
 		if (error)
 			return fz_rethrow(error, "lexical error in content stream");
 
@@ -2140,7 +2387,7 @@ pdf_run_stream(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf, int buflen
 			else if (tok == PDF_TOK_INT || tok == PDF_TOK_REAL)
 			{
 				pdf_gstate *gstate = csi->gstate + csi->gtop;
-				pdf_show_space(csi, -fz_atof(buf) * gstate->size * 0.001f);
+				pdf_show_space(csi, -fval * gstate->size * 0.001f);
 			}
 			else if (tok == PDF_TOK_STRING)
 			{
@@ -2189,12 +2436,8 @@ pdf_run_stream(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf, int buflen
 			break;
 
 		case PDF_TOK_INT:
-			csi->stack[csi->top] = atoi(buf);
-			csi->top ++;
-			break;
-
 		case PDF_TOK_REAL:
-			csi->stack[csi->top] = fz_atof(buf);
+			csi->stack[csi->top] = fval;
 			csi->top ++;
 			break;
 
@@ -2211,7 +2454,354 @@ pdf_run_stream(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf, int buflen
 			break;
 
 		case PDF_TOK_KEYWORD:
-			error = pdf_run_keyword(csi, rdb, file, buf);
+			error = pdf_run_keyword(csi, rdb, file, buf, pdf_keyword_key(buf));
+			if (error)
+				return fz_rethrow(error, "cannot run keyword");
+			pdf_clear_stack(csi);
+			break;
+
+		default:
+			return fz_throw("syntax error in content stream");
+		}
+	}
+}
+
+/*
+ * Compiled content streams
+ *
+ * A content stream is lexed once into an array of tokens, which is kept in
+ * the store and replayed on later runs. Numbers are kept in the ops, names,
+ * strings and keywords in a text pool, and arrays and dictionaries are
+ * parsed up front into an object array. Compilation stops at the first
+ * inline image; the rest of the stream is interpreted from the buffer.
+ */
+
+enum { PDF_OP_OBJ = PDF_NUM_TOKENS };
+
+typedef struct pdf_op_s pdf_op;
+typedef struct pdf_code_s pdf_code;
+
+struct pdf_op_s
+{
+	int tok;
+	int len;		/* string length, or keyword key */
+	union
+	{
+		float v;	/* number value */
+		int ofs;	/* offset in text pool, or index in objs */
+	} u;
+};
+
+struct pdf_code_s
+{
+	int refs;
+	int len, cap;
+	pdf_op *ops;
+	int text_len, text_cap;
+	char *text;
+	fz_obj *objs;
+	int resume;		/* offset after the BI keyword, or -1 */
+};
+
+static pdf_code *
+pdf_keep_code(pdf_code *code)
+{
+	code->refs ++;
+	return code;
+}
+
+static void
+pdf_drop_code(pdf_code *code)
+{
+	if (code && --code->refs == 0)
+	{
+		fz_drop_obj(code->objs);
+		fz_free(code->text);
+		fz_free(code->ops);
+		fz_free(code);
+	}
+}
+
+static pdf_op *
+pdf_add_op(pdf_code *code, int tok)
+{
+	pdf_op *op;
+
+	if (code->len == code->cap)
+	{
+		code->cap *= 2;
+		code->ops = fz_realloc(code->ops, code->cap, sizeof(pdf_op));
+	}
+
+	op = code->ops + code->len++;
+	op->tok = tok;
+	op->len = 0;
+	op->u.ofs = 0;
+	return op;
+}
+
+static int
+pdf_add_text(pdf_code *code, char *s, int len)
+{
+	int ofs = code->text_len;
+
+	if (ofs + len + 1 > code->text_cap)
+	{
+		while (ofs + len + 1 > code->text_cap)
+			code->text_cap *= 2;
+		code->text = fz_realloc(code->text, code->text_cap, 1);
+	}
+
+	memcpy(code->text + ofs, s, len);
+	code->text[ofs + len] = 0;
+	code->text_len += len + 1;
+	return ofs;
+}
+
+static void
+pdf_add_obj(pdf_code *code, fz_obj *obj)
+{
+	pdf_op *op = pdf_add_op(code, PDF_OP_OBJ);
+	op->u.ofs = fz_array_len(code->objs);
+	fz_array_push(code->objs, obj);
+	fz_drop_obj(obj);
+}
+
+/*
+ * The ops mirror what pdf_run_stream would see. The last op is always one
+ * that ends the run: EOF, an error, a token the interpreter rejects, or BI.
+ */
+static pdf_code *
+pdf_compile_stream(pdf_xref *xref, fz_stream *file, char *buf, int buflen)
+{
+	fz_error error;
+	pdf_code *code;
+	pdf_op *op;
+	fz_obj *obj;
+	int tok, len, in_text, in_array;
+	fz_off_t ival;
+	float fval;
+
+	code = fz_malloc(sizeof(pdf_code));
+	code->refs = 1;
+	code->len = 0;
+	code->cap = 256;
+	code->ops = fz_calloc(code->cap, sizeof(pdf_op));
+	code->text_len = 0;
+	code->text_cap = 1024;
+	code->text = fz_malloc(code->text_cap);
+	code->objs = fz_new_array(4);
+	code->resume = -1;
+
+	in_text = 0;
+	in_array = 0;
+
+	while (1)
+	{
+		error = pdf_lex_value(&tok, file, buf, buflen, &len, &ival, &fval);
+		if (error)
+		{
+			pdf_add_op(code, PDF_TOK_ERROR);
+			return code;
+		}
+
+		op = pdf_add_op(code, tok);
+
+		if (in_array)
+		{
+			if (tok == PDF_TOK_CLOSE_ARRAY)
+				in_array = 0;
+			else if (tok == PDF_TOK_INT || tok == PDF_TOK_REAL)
+				op->u.v = fval;
+			else if (tok == PDF_TOK_STRING)
+			{
+				op->len = len;
+				op->u.ofs = pdf_add_text(code, buf, len);
+			}
+			else if (tok == PDF_TOK_KEYWORD)
+			{
+				op->u.ofs = pdf_add_text(code, buf, strlen(buf));
+				if (strcmp(buf, "Tw") && strcmp(buf, "Tc"))
+					return code;
+			}
+			else
+				return code;
+		}
+
+		else switch (tok)
+		{
+		case PDF_TOK_OPEN_ARRAY:
+			if (!in_text)
+			{
+				code->len--;
+				error = pdf_parse_array(&obj, xref, file, buf, buflen);
+				if (error)
+				{
+					pdf_add_op(code, PDF_TOK_ERROR);
+					return code;
+				}
+				pdf_add_obj(code, obj);
+			}
+			else
+			{
+				in_array = 1;
+			}
+			break;
+
+		case PDF_TOK_OPEN_DICT:
+			code->len--;
+			error = pdf_parse_dict(&obj, xref, file, buf, buflen);
+			if (error)
+			{
+				pdf_add_op(code, PDF_TOK_ERROR);
+				return code;
+			}
+			pdf_add_obj(code, obj);
+			break;
+
+		case PDF_TOK_NAME:
+			op->u.ofs = pdf_add_text(code, buf, strlen(buf));
+			break;
+
+		case PDF_TOK_INT:
+		case PDF_TOK_REAL:
+			op->u.v = fval;
+			break;
+
+		case PDF_TOK_STRING:
+			op->len = len;
+			op->u.ofs = pdf_add_text(code, buf, len);
+			break;
+
+		case PDF_TOK_KEYWORD:
+			op->len = pdf_keyword_key(buf);
+			op->u.ofs = pdf_add_text(code, buf, strlen(buf));
+			if (op->len == B('B','T'))
+				in_text = 1;
+			else if (op->len == B('E','T'))
+				in_text = 0;
+			else if (op->len == B('B','I'))
+			{
+				code->resume = fz_tell(file);
+				return code;
+			}
+			break;
+
+		default:
+			return code;
+		}
+	}
+}
+
+static fz_error
+pdf_run_code(pdf_csi *csi, fz_obj *rdb, pdf_code *code, fz_buffer *contents, char *buf, int buflen)
+{
+	fz_error error;
+	fz_stream *file;
+	pdf_op *op;
+	char *s;
+	int in_array;
+
+	pdf_clear_stack(csi);
+	in_array = 0;
+
+	for (op = code->ops; op < code->ops + code->len; op++)
+	{
+		if (csi->top == nelem(csi->stack) - 1)
+			return fz_throw("stack overflow");
+
+		if (op->tok == PDF_TOK_ERROR)
+			return fz_throw("syntax error in content stream");
+
+		s = NULL;
+		if (op->tok == PDF_TOK_NAME || op->tok == PDF_TOK_STRING || op->tok == PDF_TOK_KEYWORD)
+			s = code->text + op->u.ofs;
+
+		if (in_array)
+		{
+			if (op->tok == PDF_TOK_CLOSE_ARRAY)
+			{
+				in_array = 0;
+			}
+			else if (op->tok == PDF_TOK_INT || op->tok == PDF_TOK_REAL)
+			{
+				pdf_gstate *gstate = csi->gstate + csi->gtop;
+				pdf_show_space(csi, -op->u.v * gstate->size * 0.001f);
+			}
+			else if (op->tok == PDF_TOK_STRING)
+			{
+				pdf_show_string(csi, (unsigned char *)s, op->len);
+			}
+			else if (op->tok == PDF_TOK_KEYWORD)
+			{
+				if (!strcmp(s, "Tw") || !strcmp(s, "Tc"))
+					fz_warn("ignoring keyword '%s' inside array", s);
+				else
+					return fz_throw("syntax error in array");
+			}
+			else if (op->tok == PDF_TOK_EOF)
+				return fz_okay;
+			else
+				return fz_throw("syntax error in array");
+		}
+
+		else switch (op->tok)
+		{
+		case PDF_TOK_ENDSTREAM:
+		case PDF_TOK_EOF:
+			return fz_okay;
+
+		case PDF_TOK_OPEN_ARRAY:
+			in_array = 1;
+			break;
+
+		case PDF_OP_OBJ:
+			if (csi->obj)
+				fz_drop_obj(csi->obj);
+			csi->obj = fz_keep_obj(fz_array_get(code->objs, op->u.ofs));
+			break;
+
+		case PDF_TOK_NAME:
+			fz_strlcpy(csi->name, s, sizeof(csi->name));
+			break;
+
+		case PDF_TOK_INT:
+		case PDF_TOK_REAL:
+			csi->stack[csi->top] = op->u.v;
+			csi->top ++;
+			break;
+
+		case PDF_TOK_STRING:
+			if (op->len <= sizeof(csi->string))
+			{
+				memcpy(csi->string, s, op->len);
+				csi->string_len = op->len;
+			}
+			else
+			{
+				if (csi->obj)
+					fz_drop_obj(csi->obj);
+				csi->obj = fz_new_string(s, op->len);
+			}
+			break;
+
+		case PDF_TOK_KEYWORD:
+			if (op->len == B('B','I'))
+			{
+				/* the inline image and everything after it is read from the buffer */
+				file = fz_open_buffer(contents);
+				fz_seek(file, code->resume, 0);
+				error = pdf_run_keyword(csi, rdb, file, s, op->len);
+				if (error)
+				{
+					fz_close(file);
+					return fz_rethrow(error, "cannot run keyword");
+				}
+				error = pdf_run_stream(csi, rdb, file, buf, buflen);
+				fz_close(file);
+				return error;
+			}
+			error = pdf_run_keyword(csi, rdb, NULL, s, op->len);
 			if (error)
 				return fz_rethrow(error, "cannot run keyword");
 			pdf_clear_stack(csi);
@@ -2221,6 +2811,8 @@ pdf_run_stream(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf, int buflen
 			return fz_throw("syntax error in content stream");
 		}
 	}
+
+	return fz_okay;
 }
 
 /*
@@ -2228,17 +2820,43 @@ pdf_run_stream(pdf_csi *csi, fz_obj *rdb, fz_stream *file, char *buf, int buflen
  */
 
 static fz_error
-pdf_run_buffer(pdf_csi *csi, fz_obj *rdb, fz_buffer *contents)
+pdf_run_buffer(pdf_csi *csi, fz_obj *rdb, fz_buffer *contents, fz_obj *key)
 {
 	fz_error error;
 	int len = sizeof csi->xref->scratch;
 	char *buf = fz_malloc(len); /* we must be re-entrant for type3 fonts */
-	fz_stream *file = fz_open_buffer(contents);
+	fz_stream *file;
+	pdf_code *code = NULL;
 	int save_in_text = csi->in_text;
+
+	/* compile streams we can find again, interpret the rest directly */
+	if (key)
+	{
+		code = pdf_find_item(csi->xref->store, pdf_drop_code, key);
+		if (code)
+			pdf_keep_code(code);
+		else
+		{
+			file = fz_open_buffer(contents);
+			code = pdf_compile_stream(csi->xref, file, buf, len);
+			fz_close(file);
+			pdf_store_item(csi->xref->store, pdf_keep_code, pdf_drop_code, key, code);
+		}
+	}
+
 	csi->in_text = 0;
-	error = pdf_run_stream(csi, rdb, file, buf, len);
+	if (code)
+	{
+		error = pdf_run_code(csi, rdb, code, contents, buf, len);
+		pdf_drop_code(code);
+	}
+	else
+	{
+		file = fz_open_buffer(contents);
+		error = pdf_run_stream(csi, rdb, file, buf, len);
+		fz_close(file);
+	}
 	csi->in_text = save_in_text;
-	fz_close(file);
 	fz_free(buf);
 	if (error)
 		return fz_rethrow(error, "cannot parse content stream");
@@ -2257,7 +2875,7 @@ pdf_run_page_with_usage(pdf_xref *xref, pdf_page *page, fz_device *dev, fz_matri
 		fz_begin_group(dev, fz_transform_rect(ctm, page->mediabox), 1, 0, 0, 1);
 
 	csi = pdf_new_csi(xref, dev, ctm, target);
-	error = pdf_run_buffer(csi, page->resources, page->contents);
+	error = pdf_run_buffer(csi, page->resources, page->contents, page->me);
 	pdf_free_csi(csi);
 	if (error)
 		return fz_rethrow(error, "cannot parse page content stream");
@@ -2300,7 +2918,7 @@ fz_error
 pdf_run_glyph(pdf_xref *xref, fz_obj *resources, fz_buffer *contents, fz_device *dev, fz_matrix ctm)
 {
 	pdf_csi *csi = pdf_new_csi(xref, dev, ctm, "View");
-	fz_error error = pdf_run_buffer(csi, resources, contents);
+	fz_error error = pdf_run_buffer(csi, resources, contents, NULL);
 	pdf_free_csi(csi);
 	if (error)
 		return fz_rethrow(error, "cannot parse glyph content stream");
@@ -42,15 +42,32 @@ static inline int unhex(int ch)
 	return 0;
 }
 
+static inline int isregular(int ch)
+{
+	switch (ch)
+	{
+	case IS_WHITE:
+	case IS_DELIM:
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ * White space, comments, names, keywords and numbers are scanned straight
+ * from the stream's buffer while they lie within it; the byte at a time
+ * code below only runs for tokens that cross the end of the buffer.
+ */
+
 static void
 lex_white(fz_stream *f)
 {
 	int c;
 	do {
-		c = fz_read_byte(f);
-	} while ((c <= 32) && (iswhite(c)));
-	if (c != EOF)
-		fz_unread_byte(f);
+		while (f->rp < f->wp && iswhite(*f->rp))
+			f->rp++;
+		c = fz_peek_byte(f);
+	} while (c != EOF && iswhite(c));
 }
 
 static void
@@ -58,10 +75,81 @@ lex_comment(fz_stream *f)
 {
 	int c;
 	do {
+		while (f->rp < f->wp && *f->rp != '\012' && *f->rp != '\015')
+			f->rp++;
 		c = fz_read_byte(f);
 	} while ((c != '\012') && (c != '\015') && (c != EOF));
 }
 
+static const double lex_pow10[] =
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15,
+};
+
+/*
+ * Numbers of up to 15 digits are converted while they are scanned: the
+ * digits make an exact integer, and dividing it by an exact power of ten
+ * gives the correctly rounded result, the same as strtod would. Longer
+ * numbers, and numbers that run off the end of the buffer, return -1 and
+ * are left for lex_number.
+ */
+static int
+lex_number_fast(fz_stream *f, char *buf, int n, int *tok, fz_off_t *ip, float *fp)
+{
+	unsigned char *s = f->rp;
+	unsigned char *p = s;
+	unsigned char *e = f->wp;
+	fz_off_t m = 0;
+	int neg = 0, dot = 0, digits = 0, frac = 0;
+	int len;
+
+	if (p < e && (*p == '+' || *p == '-'))
+		neg = *p++ == '-';
+
+	while (p < e)
+	{
+		if (*p >= '0' && *p <= '9')
+		{
+			m = m * 10 + (*p - '0');
+			digits++;
+			frac += dot;
+		}
+		else if (*p == '.' && !dot)
+			dot = 1;
+		else
+			break;
+		p++;
+	}
+
+	len = p - s;
+	if (p == e || digits > 15 || len >= n)
+		return -1;
+
+	memcpy(buf, s, len);
+	buf[len] = '\0';
+	f->rp = p;
+
+	/* a lone sign or dot reads as zero */
+	if (digits == 0)
+		neg = 0;
+
+	if (dot)
+	{
+		double d = m / lex_pow10[frac];
+		*tok = PDF_TOK_REAL;
+		*fp = (float)(neg ? -d : d);
+	}
+	else
+	{
+		*tok = PDF_TOK_INT;
+		*ip = neg ? -m : m;
+		*fp = (float)*ip;
+	}
+
+	return len;
+}
+
 static int
 lex_number(fz_stream *f, char *s, int n, int *tok)
 {
@@ -144,6 +232,19 @@ end:
 static void
 lex_name(fz_stream *f, char *s, int n)
 {
+	unsigned char *p = f->rp;
+	unsigned char *e = f->wp;
+
+	while (p < e && isregular(*p) && *p != '#')
+		p++;
+	if (p < e && *p != '#' && p - f->rp < n)
+	{
+		memcpy(s, f->rp, p - f->rp);
+		s[p - f->rp] = '\0';
+		f->rp = p;
+		return;
+	}
+
 	while (n > 1)
 	{
 		int c = fz_read_byte(f);
@@ -381,6 +482,18 @@ pdf_token_from_keyword(char *key)
 
 fz_error
 pdf_lex(int *tok, fz_stream *f, char *buf, int n, int *sl)
+{
+	fz_off_t i;
+	float v;
+	return pdf_lex_value(tok, f, buf, n, sl, &i, &v);
+}
+
+/*
+ * As pdf_lex, but also returns the value of number tokens:
+ * integers in ip, and both integers and reals in fp.
+ */
+fz_error
+pdf_lex_value(int *tok, fz_stream *f, char *buf, int n, int *sl, fz_off_t *ip, float *fp)
 {
 	while (1)
 	{
@@ -444,7 +557,20 @@ pdf_lex(int *tok, fz_stream *f, char *buf, int n, int *sl)
 			return fz_okay;
 		case IS_NUMBER:
 			fz_unread_byte(f);
-			*sl = lex_number(f, buf, n, tok);
+			*sl = lex_number_fast(f, buf, n, tok, ip, fp);
+			if (*sl < 0)
+			{
+				*sl = lex_number(f, buf, n, tok);
+				if (*tok == PDF_TOK_INT)
+				{
+					*ip = strtoll(buf, NULL, 10);
+					*fp = (float)*ip;
+				}
+				else
+				{
+					*fp = fz_atof(buf);
+				}
+			}
 			return fz_okay;
 		default: /* isregular: !isdelim && !iswhite && c != EOF */
 			fz_unread_byte(f);
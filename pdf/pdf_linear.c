@@ -0,0 +1,334 @@
+#include "fitz.h"
+#include "mupdf.h"
+
+/*
+ * Linearized files.
+ *
+ * pdf_load_xref reads only the first page section of a linearized file,
+ * and leaves the main xref until an object outside of it is needed. The
+ * page offset hint table tells us where the objects of every other page
+ * are, so a page can be found by scanning just its own part of the file,
+ * without reading the main xref or the page tree. Objects that are shared
+ * between pages are still found through the main xref.
+ */
+
+static inline int iswhite(int ch)
+{
+	return
+		ch == '\000' || ch == '\011' || ch == '\012' ||
+		ch == '\014' || ch == '\015' || ch == '\040';
+}
+
+/* Offsets in the hint tables are given as if the hint stream wasn't there */
+static fz_off_t
+pdf_linear_offset(pdf_xref *xref, fz_off_t ofs)
+{
+	if (ofs >= xref->linear_hint_ofs)
+		ofs += xref->linear_hint_len;
+	return ofs;
+}
+
+/* Read the page offsets from the page offset hint table, see PDF 1.7 F.4.1 */
+static fz_error
+pdf_load_linear_hints(pdf_xref *xref)
+{
+	fz_error error;
+	fz_stream *stm;
+	fz_obj *dict;
+	fz_off_t stm_ofs, ofs;
+	int num, gen;
+	int n = xref->linear_page_count;
+	int obj_bits, least_len, len_bits;
+	int i;
+
+	fz_seek(xref->file, xref->linear_hint_ofs, 0);
+	error = pdf_parse_ind_obj(&dict, xref, xref->file, xref->scratch, sizeof xref->scratch, &num, &gen, &stm_ofs);
+	if (error)
+		return fz_rethrow(error, "cannot parse hint stream");
+	if (stm_ofs <= 0)
+	{
+		fz_drop_obj(dict);
+		return fz_throw("hint stream is not a stream (%d %d R)", num, gen);
+	}
+
+	error = pdf_open_stream_at(&stm, xref, num, gen, dict, stm_ofs);
+	fz_drop_obj(dict);
+	if (error)
+		return fz_rethrow(error, "cannot open hint stream (%d %d R)", num, gen);
+
+	fz_read_bits(stm, 32);	/* least number of objects in a page */
+	ofs = fz_read_bits(stm, 32);	/* location of the first page object */
+	obj_bits = fz_read_bits(stm, 16);
+	least_len = fz_read_bits(stm, 32);
+	len_bits = fz_read_bits(stm, 16);
+
+	/* the rest of the header is about content streams and shared objects */
+	for (i = 0; i < 2; i++)
+	{
+		fz_read_bits(stm, 32);
+		fz_read_bits(stm, 16);
+	}
+	for (i = 0; i < 4; i++)
+		fz_read_bits(stm, 16);
+
+	if (obj_bits > 32 || len_bits > 32)
+	{
+		fz_close(stm);
+		return fz_throw("invalid page offset hint table");
+	}
+
+	/* skip the number of objects in each page */
+	for (i = 0; i < n; i++)
+		fz_read_bits(stm, obj_bits);
+	fz_sync_bits(stm);
+
+	xref->linear_page_ofs = fz_calloc(n + 1, sizeof(fz_off_t));
+	for (i = 0; i < n; i++)
+	{
+		xref->linear_page_ofs[i] = ofs;
+		ofs += least_len + fz_read_bits(stm, len_bits);
+	}
+	xref->linear_page_ofs[n] = ofs;
+
+	fz_close(stm);
+
+	if (ofs > xref->file_size)
+	{
+		fz_free(xref->linear_page_ofs);
+		xref->linear_page_ofs = NULL;
+		return fz_throw("page offset hint table is out of range");
+	}
+
+	return fz_okay;
+}
+
+typedef struct pdf_linear_entry_s pdf_linear_entry;
+
+struct pdf_linear_entry_s
+{
+	int num;
+	int gen;
+	fz_off_t ofs;
+};
+
+/*
+ * Find the objects between ofs and end, and if the first one is a page
+ * object, fill in the xref entries for them and return its number. The
+ * entries are only kept once the page is found, so a bad offset that
+ * lands in the middle of some stream leaves nothing behind.
+ */
+static int
+pdf_scan_linear_page(pdf_xref *xref, fz_off_t ofs, fz_off_t end)
+{
+	fz_error error = fz_okay;
+	fz_stream *file = xref->file;
+	char *buf = xref->scratch;
+	int cap = sizeof xref->scratch;
+	pdf_linear_entry *list = NULL;
+	int list_len = 0, list_cap = 0;
+	fz_obj *dict, *obj;
+	fz_off_t numofs, stm_ofs, stm_len;
+	int tok, len, num, gen, c, i;
+	int ispage = 0;
+
+	fz_seek(file, ofs, 0);
+
+	while (1)
+	{
+		while (iswhite(fz_peek_byte(file)))
+			fz_read_byte(file);
+
+		numofs = fz_tell(file);
+		if (numofs < 0 || numofs >= end)
+			break;
+
+		error = pdf_lex(&tok, file, buf, cap, &len);
+		if (error || tok != PDF_TOK_INT)
+			break;
+		num = atoi(buf);
+		error = pdf_lex(&tok, file, buf, cap, &len);
+		if (error || tok != PDF_TOK_INT)
+			break;
+		gen = atoi(buf);
+		error = pdf_lex(&tok, file, buf, cap, &len);
+		if (error || tok != PDF_TOK_OBJ)
+			break;
+
+		if (num <= 0 || num >= xref->len)
+			break;
+
+		stm_len = 0;
+		error = pdf_lex(&tok, file, buf, cap, &len);
+		if (error)
+			break;
+		if (tok == PDF_TOK_OPEN_DICT)
+		{
+			/* Send NULL xref so we don't try to resolve references */
+			error = pdf_parse_dict(&dict, NULL, file, buf, cap);
+			if (error)
+				break;
+
+			if (list_len == 0)
+			{
+				obj = fz_dict_gets(dict, "Type");
+				ispage = fz_is_name(obj) && !strcmp(fz_to_name(obj), "Page");
+			}
+
+			obj = fz_dict_gets(dict, "Length");
+			if (fz_is_int(obj))
+				stm_len = fz_to_offset(obj);
+
+			fz_drop_obj(dict);
+
+			error = pdf_lex(&tok, file, buf, cap, &len);
+			if (error)
+				break;
+		}
+
+		if (!ispage)
+			break;
+
+		if (list_len == list_cap)
+		{
+			list_cap = list_cap ? list_cap * 2 : 16;
+			list = fz_realloc(list, list_cap, sizeof(pdf_linear_entry));
+		}
+		list[list_len].num = num;
+		list[list_len].gen = gen;
+		list[list_len].ofs = numofs;
+		list_len++;
+
+		while (tok != PDF_TOK_STREAM && tok != PDF_TOK_ENDOBJ &&
+			tok != PDF_TOK_ERROR && tok != PDF_TOK_EOF)
+		{
+			error = pdf_lex(&tok, file, buf, cap, &len);
+			if (error)
+				break;
+		}
+		if (error)
+			break;
+
+		if (tok == PDF_TOK_STREAM)
+		{
+			c = fz_read_byte(file);
+			if (c == '\r' && fz_peek_byte(file) == '\n')
+				fz_read_byte(file);
+			stm_ofs = fz_tell(file);
+			if (stm_ofs < 0)
+				break;
+
+			tok = PDF_TOK_ERROR;
+			if (stm_len > 0 && stm_ofs + stm_len < end)
+			{
+				fz_seek(file, stm_ofs + stm_len, 0);
+				error = pdf_lex(&tok, file, buf, cap, &len);
+				if (error)
+					break;
+				if (tok != PDF_TOK_ENDSTREAM)
+					fz_seek(file, stm_ofs, 0);
+			}
+
+			/* fall back to looking for the end of the stream */
+			if (tok != PDF_TOK_ENDSTREAM)
+			{
+				if (fz_read(file, (unsigned char *)buf, 9) != 9)
+					break;
+				while (memcmp(buf, "endstream", 9) != 0)
+				{
+					c = fz_read_byte(file);
+					if (c == EOF)
+						break;
+					memmove(buf, buf + 1, 8);
+					buf[8] = c;
+				}
+			}
+
+			error = pdf_lex(&tok, file, buf, cap, &len);
+			if (error || tok != PDF_TOK_ENDOBJ)
+				break;
+		}
+		else if (tok != PDF_TOK_ENDOBJ)
+			break;
+	}
+
+	if (error)
+		fz_catch(error, "cannot scan page objects");
+
+	for (i = 0; i < list_len; i++)
+	{
+		num = list[i].num;
+		if (xref->table[num].type == 0)
+		{
+			xref->table[num].type = 'n';
+			xref->table[num].ofs = list[i].ofs;
+			xref->table[num].gen = list[i].gen;
+		}
+	}
+
+	num = list_len > 0 ? list[0].num : 0;
+	fz_free(list);
+	return num;
+}
+
+static int
+pdf_is_linear_page(pdf_xref *xref, int num)
+{
+	fz_error error;
+	fz_obj *obj, *type;
+	int ok;
+
+	if (num <= 0 || num >= xref->len)
+		return 0;
+
+	error = pdf_load_object(&obj, xref, num, xref->table[num].gen);
+	if (error)
+	{
+		fz_catch(error, "cannot load page object (%d 0 R)", num);
+		return 0;
+	}
+
+	type = fz_dict_gets(obj, "Type");
+	ok = fz_is_name(type) && !strcmp(fz_to_name(type), "Page");
+	fz_drop_obj(obj);
+	return ok;
+}
+
+/*
+ * Find the page object for a page of a linearized file, using the hint
+ * table to read only the part of the file that the page is in. Returns
+ * the object number, or 0 if the page has to be found the usual way.
+ */
+int
+pdf_lookup_linear_page(pdf_xref *xref, int number)
+{
+	fz_error error;
+	fz_off_t ofs, end;
+	int num;
+
+	if (!xref->linear_page1 || number < 0 || number >= xref->linear_page_count)
+		return 0;
+
+	if (number == 0)
+		return pdf_is_linear_page(xref, xref->linear_page1) ? xref->linear_page1 : 0;
+
+	if (!xref->linear_page_ofs)
+	{
+		error = pdf_load_linear_hints(xref);
+		if (error)
+		{
+			fz_catch(error, "ignoring hint stream");
+			xref->linear_page1 = 0;
+			return 0;
+		}
+	}
+
+	ofs = xref->linear_page_ofs[number];
+	end = xref->linear_page_ofs[number + 1];
+
+	/* some writers don't leave the hint stream out of the offsets */
+	num = pdf_scan_linear_page(xref, pdf_linear_offset(xref, ofs), pdf_linear_offset(xref, end));
+	if (!num && pdf_linear_offset(xref, ofs) != ofs)
+		num = pdf_scan_linear_page(xref, ofs, end);
+
+	return pdf_is_linear_page(xref, num) ? num : 0;
+}
@@ -1,85 +1,53 @@
 #include "fitz.h"
 #include "mupdf.h"
 
-struct info
-{
-	fz_obj *resources;
-	fz_obj *mediabox;
-	fz_obj *cropbox;
-	fz_obj *rotate;
-};
+/*
+ * Pages are found on demand by descending the page tree, using the Count
+ * of each node to skip whole subtrees, so only the nodes on the path to
+ * a page are loaded. If the counts turn out to be wrong we fall back to
+ * walking the whole tree, once.
+ */
 
-int
-pdf_count_pages(pdf_xref *xref)
+enum { MAX_PAGE_TREE_DEPTH = 64 };
+
+static fz_obj *
+pdf_page_tree_root(pdf_xref *xref)
 {
-	return xref->page_len;
+	fz_obj *catalog = fz_dict_gets(xref->trailer, "Root");
+	return fz_dict_gets(catalog, "Pages");
 }
 
-int
-pdf_find_page_number(pdf_xref *xref, fz_obj *page)
+static int
+pdf_is_page_tree_node(fz_obj *node)
 {
-	int i, num = fz_to_num(page);
-	for (i = 0; i < xref->page_len; i++)
-		if (num == fz_to_num(xref->page_refs[i]))
-			return i;
-	return -1;
+	return fz_is_array(fz_dict_gets(node, "Kids")) && fz_is_int(fz_dict_gets(node, "Count"));
 }
 
 static void
-pdf_load_page_tree_node(pdf_xref *xref, fz_obj *node, struct info info)
+pdf_walk_page_tree(pdf_xref *xref, fz_obj *node)
 {
-	fz_obj *dict, *kids, *count;
-	fz_obj *obj, *tmp;
+	fz_obj *kids, *tmp;
 	int i, n;
 
 	/* prevent infinite recursion */
 	if (fz_dict_gets(node, ".seen"))
 		return;
 
-	kids = fz_dict_gets(node, "Kids");
-	count = fz_dict_gets(node, "Count");
-
-	if (fz_is_array(kids) && fz_is_int(count))
+	if (pdf_is_page_tree_node(node))
 	{
-		obj = fz_dict_gets(node, "Resources");
-		if (obj)
-			info.resources = obj;
-		obj = fz_dict_gets(node, "MediaBox");
-		if (obj)
-			info.mediabox = obj;
-		obj = fz_dict_gets(node, "CropBox");
-		if (obj)
-			info.cropbox = obj;
-		obj = fz_dict_gets(node, "Rotate");
-		if (obj)
-			info.rotate = obj;
-
 		tmp = fz_new_null();
 		fz_dict_puts(node, ".seen", tmp);
 		fz_drop_obj(tmp);
 
+		kids = fz_dict_gets(node, "Kids");
 		n = fz_array_len(kids);
 		for (i = 0; i < n; i++)
-		{
-			obj = fz_array_get(kids, i);
-			pdf_load_page_tree_node(xref, obj, info);
-		}
+			pdf_walk_page_tree(xref, fz_array_get(kids, i));
 
 		fz_dict_dels(node, ".seen");
 	}
 	else
 	{
-		dict = fz_resolve_indirect(node);
-
-		if (info.resources && !fz_dict_gets(dict, "Resources"))
-			fz_dict_puts(dict, "Resources", info.resources);
-		if (info.mediabox && !fz_dict_gets(dict, "MediaBox"))
-			fz_dict_puts(dict, "MediaBox", info.mediabox);
-		if (info.cropbox && !fz_dict_gets(dict, "CropBox"))
-			fz_dict_puts(dict, "CropBox", info.cropbox);
-		if (info.rotate && !fz_dict_gets(dict, "Rotate"))
-			fz_dict_puts(dict, "Rotate", info.rotate);
-
 		if (xref->page_len == xref->page_cap)
 		{
 			fz_warn("found more pages than expected");
@@ -89,35 +57,218 @@ pdf_load_page_tree_node(pdf_xref *xref, fz_obj *node, struct info info)
 		}
 
 		xref->page_refs[xref->page_len] = fz_keep_obj(node);
-		xref->page_objs[xref->page_len] = fz_keep_obj(dict);
+		xref->page_objs[xref->page_len] = fz_keep_obj(fz_resolve_indirect(node));
 		xref->page_len ++;
 	}
 }
 
+static void
+pdf_load_all_pages(pdf_xref *xref)
+{
+	int i;
+
+	fz_warn("page tree counts are wrong, loading all pages");
+
+	for (i = 0; i < xref->page_len; i++)
+	{
+		if (xref->page_refs[i])
+			fz_drop_obj(xref->page_refs[i]);
+		if (xref->page_objs[i])
+			fz_drop_obj(xref->page_objs[i]);
+		xref->page_refs[i] = NULL;
+		xref->page_objs[i] = NULL;
+	}
+
+	xref->page_len = 0;
+	pdf_walk_page_tree(xref, pdf_page_tree_root(xref));
+	xref->page_walked = 1;
+}
+
+static int
+pdf_lookup_page(pdf_xref *xref, int number)
+{
+	fz_obj *node, *kids, *kid;
+	int i, n, num, count, depth;
+	int skip = number;
+
+	if (number < 0 || number >= xref->page_len)
+		return 0;
+	if (xref->page_objs[number])
+		return 1;
+	if (xref->page_refs[number])
+	{
+		xref->page_objs[number] = fz_keep_obj(fz_resolve_indirect(xref->page_refs[number]));
+		return 1;
+	}
+	if (xref->page_walked)
+		return 0;
+
+	/* linearized files tell us where the page is, no need to read the page tree */
+	if (xref->linear_page1)
+	{
+		num = pdf_lookup_linear_page(xref, number);
+		if (num > 0)
+		{
+			xref->page_refs[number] = fz_new_indirect(num, xref->table[num].gen, xref);
+			xref->page_objs[number] = fz_keep_obj(fz_resolve_indirect(xref->page_refs[number]));
+			return 1;
+		}
+	}
+
+	node = pdf_page_tree_root(xref);
+	for (depth = 0; depth < MAX_PAGE_TREE_DEPTH; depth++)
+	{
+		kids = fz_dict_gets(node, "Kids");
+		n = fz_array_len(kids);
+		for (i = 0; i < n; i++)
+		{
+			kid = fz_array_get(kids, i);
+			if (pdf_is_page_tree_node(kid))
+			{
+				count = fz_to_int(fz_dict_gets(kid, "Count"));
+				if (count < 0)
+					goto broken;
+				if (skip < count)
+					break;
+				skip -= count;
+			}
+			else if (skip == 0)
+			{
+				xref->page_refs[number] = fz_keep_obj(kid);
+				xref->page_objs[number] = fz_keep_obj(fz_resolve_indirect(kid));
+				return 1;
+			}
+			else
+				skip --;
+		}
+		if (i == n)
+			break;
+		node = fz_array_get(kids, i);
+	}
+
+broken:
+	pdf_load_all_pages(xref);
+	return number < xref->page_len;
+}
+
+int
+pdf_count_pages(pdf_xref *xref)
+{
+	return xref->page_len;
+}
+
+fz_obj *
+pdf_lookup_page_object(pdf_xref *xref, int number)
+{
+	if (!pdf_lookup_page(xref, number))
+		return NULL;
+	return xref->page_objs[number];
+}
+
+fz_obj *
+pdf_lookup_page_ref(pdf_xref *xref, int number)
+{
+	if (!pdf_lookup_page(xref, number))
+		return NULL;
+	return xref->page_refs[number];
+}
+
+fz_obj *
+pdf_lookup_inherited_page_item(fz_obj *node, char *key)
+{
+	fz_obj *val;
+	int depth;
+
+	for (depth = 0; node && depth < MAX_PAGE_TREE_DEPTH; depth++)
+	{
+		val = fz_dict_gets(node, key);
+		if (val)
+			return val;
+		node = fz_dict_gets(node, "Parent");
+	}
+
+	return NULL;
+}
+
+/* count the pages before this one by following the parent links up to the root */
+int
+pdf_find_page_number(pdf_xref *xref, fz_obj *page)
+{
+	fz_obj *node, *parent, *kids, *kid;
+	int i, n, depth;
+	int num = fz_to_num(page);
+	int number = 0;
+
+	node = page;
+	for (depth = 0; depth < MAX_PAGE_TREE_DEPTH; depth++)
+	{
+		parent = fz_dict_gets(node, "Parent");
+		if (!parent)
+			break;
+
+		kids = fz_dict_gets(parent, "Kids");
+		n = fz_array_len(kids);
+		for (i = 0; i < n; i++)
+		{
+			kid = fz_array_get(kids, i);
+			if (fz_to_num(kid) == fz_to_num(node))
+				break;
+			if (pdf_is_page_tree_node(kid))
+				number += fz_to_int(fz_dict_gets(kid, "Count"));
+			else
+				number ++;
+		}
+		if (i == n)
+			break;
+
+		node = parent;
+	}
+
+	if (fz_to_num(node) == fz_to_num(pdf_page_tree_root(xref)) &&
+		fz_to_num(pdf_lookup_page_ref(xref, number)) == num)
+		return number;
+
+	if (!xref->page_walked)
+		pdf_load_all_pages(xref);
+	for (i = 0; i < xref->page_len; i++)
+		if (num == fz_to_num(xref->page_refs[i]))
+			return i;
+	return -1;
+}
+
 fz_error
 pdf_load_page_tree(pdf_xref *xref)
 {
-	struct info info;
-	fz_obj *catalog = fz_dict_gets(xref->trailer, "Root");
-	fz_obj *pages = fz_dict_gets(catalog, "Pages");
-	fz_obj *count = fz_dict_gets(pages, "Count");
+	fz_obj *pages, *count;
+	int n;
 
-	if (!fz_is_dict(pages))
-		return fz_throw("missing page tree");
-	if (!fz_is_int(count))
-		return fz_throw("missing page count");
+	/* already known from a document index */
+	if (xref->page_refs)
+		return fz_okay;
 
-	xref->page_cap = fz_to_int(count);
-	xref->page_len = 0;
-	xref->page_refs = fz_calloc(xref->page_cap, sizeof(fz_obj*));
-	xref->page_objs = fz_calloc(xref->page_cap, sizeof(fz_obj*));
+	/* linearized files say how many pages they have up front */
+	if (xref->linear_page1)
+		n = xref->linear_page_count;
+	else
+	{
+		pages = pdf_page_tree_root(xref);
+		count = fz_dict_gets(pages, "Count");
 
-	info.resources = NULL;
-	info.mediabox = NULL;
-	info.cropbox = NULL;
-	info.rotate = NULL;
+		if (!fz_is_dict(pages))
+			return fz_throw("missing page tree");
+		if (!fz_is_int(count))
+			return fz_throw("missing page count");
 
-	pdf_load_page_tree_node(xref, pages, info);
+		n = MAX(fz_to_int(count), 0);
+	}
+
+	xref->page_cap = n;
+	xref->page_len = xref->page_cap;
+	xref->page_walked = 0;
+	xref->page_refs = fz_calloc(xref->page_cap, sizeof(fz_obj*));
+	xref->page_objs = fz_calloc(xref->page_cap, sizeof(fz_obj*));
+	memset(xref->page_refs, 0, xref->page_cap * sizeof(fz_obj*));
+	memset(xref->page_objs, 0, xref->page_cap * sizeof(fz_obj*));
 
 	return fz_okay;
 }
@@ -277,24 +428,24 @@ pdf_load_page(pdf_page **pagep, pdf_xref *xref, int number)
 	fz_obj *obj;
 	fz_bbox bbox;
 
-	if (number < 0 || number >= xref->page_len)
+	pageobj = pdf_lookup_page_object(xref, number);
+	pageref = pdf_lookup_page_ref(xref, number);
+	if (!pageobj)
 		return fz_throw("cannot find page %d", number + 1);
 
 	/* Ensure that we have a store for resource objects */
 	if (!xref->store)
 		xref->store = pdf_new_store();
 
-	pageobj = xref->page_objs[number];
-	pageref = xref->page_refs[number];
-
 	page = fz_malloc(sizeof(pdf_page));
 	page->resources = NULL;
 	page->contents = NULL;
+	page->me = fz_keep_obj(pageref);
 	page->transparency = 0;
 	page->links = NULL;
 	page->annots = NULL;
 
-	obj = fz_dict_gets(pageobj, "MediaBox");
+	obj = pdf_lookup_inherited_page_item(pageobj, "MediaBox");
 	bbox = fz_round_rect(pdf_to_rect(obj));
 	if (fz_is_empty_rect(pdf_to_rect(obj)))
 	{
@@ -305,7 +456,7 @@ pdf_load_page(pdf_page **pagep, pdf_xref *xref, int number)
 		bbox.y1 = 792;
 	}
 
-	obj = fz_dict_gets(pageobj, "CropBox");
+	obj = pdf_lookup_inherited_page_item(pageobj, "CropBox");
 	if (fz_is_array(obj))
 	{
 		fz_bbox cropbox = fz_round_rect(pdf_to_rect(obj));
@@ -323,7 +474,7 @@ pdf_load_page(pdf_page **pagep, pdf_xref *xref, int number)
 		page->mediabox = fz_unit_rect;
 	}
 
-	page->rotate = fz_to_int(fz_dict_gets(pageobj, "Rotate"));
+	page->rotate = fz_to_int(pdf_lookup_inherited_page_item(pageobj, "Rotate"));
 
 	obj = fz_dict_gets(pageobj, "Annots");
 	if (obj)
@@ -332,7 +483,7 @@ pdf_load_page(pdf_page **pagep, pdf_xref *xref, int number)
 		pdf_load_annots(&page->annots, xref, obj);
 	}
 
-	page->resources = fz_dict_gets(pageobj, "Resources");
+	page->resources = pdf_lookup_inherited_page_item(pageobj, "Resources");
 	if (page->resources)
 		fz_keep_obj(page->resources);
 
@@ -362,6 +513,8 @@ pdf_free_page(pdf_page *page)
 		fz_drop_obj(page->resources);
 	if (page->contents)
 		fz_drop_buffer(page->contents);
+	if (page->me)
+		fz_drop_obj(page->me);
 	if (page->links)
 		pdf_free_link(page->links);
 	if (page->annots)
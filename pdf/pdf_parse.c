@@ -176,15 +176,18 @@ pdf_parse_array(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int cap
 	fz_error error = fz_okay;
 	fz_obj *ary = NULL;
 	fz_obj *obj = NULL;
-	int a = 0, b = 0, n = 0;
+	fz_off_t a = 0, b = 0;
+	int n = 0;
 	int tok;
 	int len;
+	fz_off_t ival;
+	float fval;
 
 	ary = fz_new_array(4);
 
 	while (1)
 	{
-		error = pdf_lex(&tok, file, buf, cap, &len);
+		error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 		if (error)
 		{
 			fz_drop_obj(ary);
@@ -195,13 +198,13 @@ pdf_parse_array(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int cap
 		{
 			if (n > 0)
 			{
-				obj = fz_new_int(a);
+				obj = fz_new_offset(a);
 				fz_array_push(ary, obj);
 				fz_drop_obj(obj);
 			}
 			if (n > 1)
 			{
-				obj = fz_new_int(b);
+				obj = fz_new_offset(b);
 				fz_array_push(ary, obj);
 				fz_drop_obj(obj);
 			}
@@ -210,7 +213,7 @@ pdf_parse_array(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int cap
 
 		if (tok == PDF_TOK_INT && n == 2)
 		{
-			obj = fz_new_int(a);
+			obj = fz_new_offset(a);
 			fz_array_push(ary, obj);
 			fz_drop_obj(obj);
 			a = b;
@@ -225,9 +228,9 @@ pdf_parse_array(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int cap
 
 		case PDF_TOK_INT:
 			if (n == 0)
-				a = atoi(buf);
+				a = ival;
 			if (n == 1)
-				b = atoi(buf);
+				b = ival;
 			n ++;
 			break;
 
@@ -237,7 +240,7 @@ pdf_parse_array(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int cap
 				fz_drop_obj(ary);
 				return fz_throw("cannot parse indirect reference in array");
 			}
-			obj = fz_new_indirect(a, b, xref);
+			obj = fz_new_indirect((int)a, (int)b, xref);
 			fz_array_push(ary, obj);
 			fz_drop_obj(obj);
 			n = 0;
@@ -271,7 +274,7 @@ pdf_parse_array(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int cap
 			fz_drop_obj(obj);
 			break;
 		case PDF_TOK_REAL:
-			obj = fz_new_real(fz_atof(buf));
+			obj = fz_new_real(fval);
 			fz_array_push(ary, obj);
 			fz_drop_obj(obj);
 			break;
@@ -312,13 +315,16 @@ pdf_parse_dict(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int cap)
 	fz_obj *val = NULL;
 	int tok;
 	int len;
-	int a, b;
+	fz_off_t ival;
+	float fval;
+	fz_off_t a;
+	int b;
 
 	dict = fz_new_dict(8);
 
 	while (1)
 	{
-		error = pdf_lex(&tok, file, buf, cap, &len);
+		error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 		if (error)
 		{
 			fz_drop_obj(dict);
@@ -347,7 +353,7 @@ skip:
 
 		key = fz_new_name(buf);
 
-		error = pdf_lex(&tok, file, buf, cap, &len);
+		error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 		if (error)
 		{
 			fz_drop_obj(key);
@@ -378,16 +384,16 @@ skip:
 			break;
 
 		case PDF_TOK_NAME: val = fz_new_name(buf); break;
-		case PDF_TOK_REAL: val = fz_new_real(fz_atof(buf)); break;
+		case PDF_TOK_REAL: val = fz_new_real(fval); break;
 		case PDF_TOK_STRING: val = fz_new_string(buf, len); break;
 		case PDF_TOK_TRUE: val = fz_new_bool(1); break;
 		case PDF_TOK_FALSE: val = fz_new_bool(0); break;
 		case PDF_TOK_NULL: val = fz_new_null(); break;
 
 		case PDF_TOK_INT:
-			/* 64-bit to allow for numbers > INT_MAX and overflow */
-			a = (int) strtoll(buf, 0, 10);
-			error = pdf_lex(&tok, file, buf, cap, &len);
+			/* 64-bit to allow for file offsets > INT_MAX */
+			a = ival;
+			error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 			if (error)
 			{
 				fz_drop_obj(key);
@@ -397,7 +403,7 @@ skip:
 			if (tok == PDF_TOK_CLOSE_DICT || tok == PDF_TOK_NAME ||
 				(tok == PDF_TOK_KEYWORD && !strcmp(buf, "ID")))
 			{
-				val = fz_new_int(a);
+				val = fz_new_offset(a);
 				fz_dict_put(dict, key, val);
 				fz_drop_obj(val);
 				fz_drop_obj(key);
@@ -405,8 +411,8 @@ skip:
 			}
 			if (tok == PDF_TOK_INT)
 			{
-				b = atoi(buf);
-				error = pdf_lex(&tok, file, buf, cap, &len);
+				b = (int)ival;
+				error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 				if (error)
 				{
 					fz_drop_obj(key);
@@ -415,7 +421,7 @@ skip:
 				}
 				if (tok == PDF_TOK_R)
 				{
-					val = fz_new_indirect(a, b, xref);
+					val = fz_new_indirect((int)a, b, xref);
 					break;
 				}
 			}
@@ -441,8 +447,10 @@ pdf_parse_stm_obj(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int c
 	fz_error error;
 	int tok;
 	int len;
+	fz_off_t ival;
+	float fval;
 
-	error = pdf_lex(&tok, file, buf, cap, &len);
+	error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 	if (error)
 		return fz_rethrow(error, "cannot parse token in object stream");
 
@@ -459,12 +467,12 @@ pdf_parse_stm_obj(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int c
 			return fz_rethrow(error, "cannot parse object stream");
 		break;
 	case PDF_TOK_NAME: *op = fz_new_name(buf); break;
-	case PDF_TOK_REAL: *op = fz_new_real(fz_atof(buf)); break;
+	case PDF_TOK_REAL: *op = fz_new_real(fval); break;
 	case PDF_TOK_STRING: *op = fz_new_string(buf, len); break;
 	case PDF_TOK_TRUE: *op = fz_new_bool(1); break;
 	case PDF_TOK_FALSE: *op = fz_new_bool(0); break;
 	case PDF_TOK_NULL: *op = fz_new_null(); break;
-	case PDF_TOK_INT: *op = fz_new_int(atoi(buf)); break;
+	case PDF_TOK_INT: *op = fz_new_offset(ival); break;
 	default: return fz_throw("unknown token in object stream");
 	}
 
@@ -474,36 +482,40 @@ pdf_parse_stm_obj(fz_obj **op, pdf_xref *xref, fz_stream *file, char *buf, int c
 fz_error
 pdf_parse_ind_obj(fz_obj **op, pdf_xref *xref,
 	fz_stream *file, char *buf, int cap,
-	int *onum, int *ogen, int *ostmofs)
+	int *onum, int *ogen, fz_off_t *ostmofs)
 {
 	fz_error error = fz_okay;
 	fz_obj *obj = NULL;
-	int num = 0, gen = 0, stm_ofs;
+	int num = 0, gen = 0;
+	fz_off_t stm_ofs;
 	int tok;
 	int len;
-	int a, b;
+	fz_off_t ival;
+	float fval;
+	fz_off_t a;
+	int b;
 
-	error = pdf_lex(&tok, file, buf, cap, &len);
+	error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 	if (error)
 		return fz_rethrow(error, "cannot parse indirect object (%d %d R)", num, gen);
 	if (tok != PDF_TOK_INT)
 		return fz_throw("expected object number (%d %d R)", num, gen);
-	num = atoi(buf);
+	num = (int)ival;
 
-	error = pdf_lex(&tok, file, buf, cap, &len);
+	error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 	if (error)
 		return fz_rethrow(error, "cannot parse indirect object (%d %d R)", num, gen);
 	if (tok != PDF_TOK_INT)
 		return fz_throw("expected generation number (%d %d R)", num, gen);
-	gen = atoi(buf);
+	gen = (int)ival;
 
-	error = pdf_lex(&tok, file, buf, cap, &len);
+	error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 	if (error)
 		return fz_rethrow(error, "cannot parse indirect object (%d %d R)", num, gen);
 	if (tok != PDF_TOK_OBJ)
 		return fz_throw("expected 'obj' keyword (%d %d R)", num, gen);
 
-	error = pdf_lex(&tok, file, buf, cap, &len);
+	error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 	if (error)
 		return fz_rethrow(error, "cannot parse indirect object (%d %d R)", num, gen);
 
@@ -522,31 +534,31 @@ pdf_parse_ind_obj(fz_obj **op, pdf_xref *xref,
 		break;
 
 	case PDF_TOK_NAME: obj = fz_new_name(buf); break;
-	case PDF_TOK_REAL: obj = fz_new_real(fz_atof(buf)); break;
+	case PDF_TOK_REAL: obj = fz_new_real(fval); break;
 	case PDF_TOK_STRING: obj = fz_new_string(buf, len); break;
 	case PDF_TOK_TRUE: obj = fz_new_bool(1); break;
 	case PDF_TOK_FALSE: obj = fz_new_bool(0); break;
 	case PDF_TOK_NULL: obj = fz_new_null(); break;
 
 	case PDF_TOK_INT:
-		a = atoi(buf);
-		error = pdf_lex(&tok, file, buf, cap, &len);
+		a = ival;
+		error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 		if (error)
 			return fz_rethrow(error, "cannot parse indirect object (%d %d R)", num, gen);
 		if (tok == PDF_TOK_STREAM || tok == PDF_TOK_ENDOBJ)
 		{
-			obj = fz_new_int(a);
+			obj = fz_new_offset(a);
 			goto skip;
 		}
 		if (tok == PDF_TOK_INT)
 		{
-			b = atoi(buf);
-			error = pdf_lex(&tok, file, buf, cap, &len);
+			b = (int)ival;
+			error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 			if (error)
 				return fz_rethrow(error, "cannot parse indirect object (%d %d R)", num, gen);
 			if (tok == PDF_TOK_R)
 			{
-				obj = fz_new_indirect(a, b, xref);
+				obj = fz_new_indirect((int)a, b, xref);
 				break;
 			}
 		}
@@ -560,7 +572,7 @@ pdf_parse_ind_obj(fz_obj **op, pdf_xref *xref,
 		return fz_throw("syntax error in object (%d %d R)", num, gen);
 	}
 
-	error = pdf_lex(&tok, file, buf, cap, &len);
+	error = pdf_lex_value(&tok, file, buf, cap, &len, &ival, &fval);
 	if (error)
 	{
 		fz_drop_obj(obj);
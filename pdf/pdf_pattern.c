@@ -18,6 +18,7 @@ pdf_load_pattern(pdf_pattern **patp, pdf_xref *xref, fz_obj *dict)
 	pat->refs = 1;
 	pat->resources = NULL;
 	pat->contents = NULL;
+	pat->me = fz_keep_obj(dict);
 
 	/* Store pattern now, to avoid possible recursion if objects refer back to this one */
 	pdf_store_item(xref->store, pdf_keep_pattern, pdf_drop_pattern, dict, pat);
@@ -67,6 +68,8 @@ pdf_drop_pattern(pdf_pattern *pat)
 			fz_drop_obj(pat->resources);
 		if (pat->contents)
 			fz_drop_buffer(pat->contents);
+		if (pat->me)
+			fz_drop_obj(pat->me);
 		fz_free(pat);
 	}
 }
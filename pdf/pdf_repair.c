@@ -7,13 +7,13 @@ struct entry
 {
 	int num;
 	int gen;
-	int ofs;
-	int stm_ofs;
+	fz_off_t ofs;
+	fz_off_t stm_ofs;
 	int stm_len;
 };
 
 static fz_error
-pdf_repair_obj(fz_stream *file, char *buf, int cap, int *stmofsp, int *stmlenp, fz_obj **encrypt, fz_obj **id)
+pdf_repair_obj(fz_stream *file, char *buf, int cap, fz_off_t *stmofsp, int *stmlenp, fz_obj **encrypt, fz_obj **id)
 {
 	fz_error error;
 	int tok;
@@ -160,11 +160,14 @@ pdf_repair_obj_stm(pdf_xref *xref, int num, int gen)
 		if (n >= xref->len)
 			pdf_resize_xref(xref, n + 1);
 
-		xref->table[n].ofs = num;
-		xref->table[n].gen = i;
-		xref->table[n].stm_ofs = 0;
-		xref->table[n].obj = NULL;
-		xref->table[n].type = 'o';
+		/* an object that is already loaded from here may be in use */
+		if (xref->table[n].type != 'o' || xref->table[n].ofs != num || xref->table[n].gen != i)
+		{
+			pdf_drop_cached_object(xref, n);
+			xref->table[n].ofs = num;
+			xref->table[n].gen = i;
+			xref->table[n].type = 'o';
+		}
 
 		error = pdf_lex(&tok, stm, buf, sizeof buf, &n);
 		if (error || tok != PDF_TOK_INT)
@@ -197,8 +200,9 @@ pdf_repair_xref(pdf_xref *xref, char *buf, int bufsize)
 
 	int num = 0;
 	int gen = 0;
-	int tmpofs, numofs = 0, genofs = 0;
-	int stm_len, stm_ofs = 0;
+	fz_off_t tmpofs, numofs = 0, genofs = 0;
+	fz_off_t stm_ofs = 0;
+	int stm_len;
 	int tok;
 	int next;
 	int i, n, c;
@@ -346,7 +350,8 @@ pdf_repair_xref(pdf_xref *xref, char *buf, int bufsize)
 		xref->table[list[i].num].ofs = list[i].ofs;
 		xref->table[list[i].num].gen = list[i].gen;
 
-		xref->table[list[i].num].stm_ofs = list[i].stm_ofs;
+		if (list[i].stm_ofs || pdf_get_stream_offset(xref, list[i].num))
+			pdf_set_stream_offset(xref, list[i].num, list[i].stm_ofs);
 
 		/* corrected stream length */
 		if (list[i].stm_len >= 0)
@@ -361,6 +366,7 @@ pdf_repair_xref(pdf_xref *xref, char *buf, int bufsize)
 			length = fz_new_int(list[i].stm_len);
 			fz_dict_puts(dict, "Length", length);
 			fz_drop_obj(length);
+			pdf_pin_object(xref, list[i].num);
 
 			fz_drop_obj(dict);
 		}
@@ -370,8 +376,7 @@ pdf_repair_xref(pdf_xref *xref, char *buf, int bufsize)
 	xref->table[0].type = 'f';
 	xref->table[0].ofs = 0;
 	xref->table[0].gen = 65535;
-	xref->table[0].stm_ofs = 0;
-	xref->table[0].obj = NULL;
+	pdf_drop_cached_object(xref, 0);
 
 	next = 0;
 	for (i = xref->len - 1; i >= 0; i--)
@@ -450,7 +455,7 @@ pdf_repair_obj_stms(pdf_xref *xref)
 
 	for (i = 0; i < xref->len; i++)
 	{
-		if (xref->table[i].stm_ofs)
+		if (pdf_get_stream_offset(xref, i))
 		{
 			pdf_load_object(&dict, xref, i, 0);
 			if (!strcmp(fz_to_name(fz_dict_gets(dict, "Type")), "ObjStm"))
@@ -19,7 +19,7 @@ pdf_is_stream(pdf_xref *xref, int num, int gen)
 		return 0;
 	}
 
-	return xref->table[num].stm_ofs > 0;
+	return pdf_get_stream_offset(xref, num) > 0;
 }
 
 /*
@@ -50,11 +50,66 @@ pdf_stream_has_crypt(fz_obj *stm)
 	return 0;
 }
 
+static int
+pdf_guess_filter_length(int len, char *filter)
+{
+	if (!strcmp(filter, "ASCIIHexDecode"))
+		return len / 2;
+	if (!strcmp(filter, "ASCII85Decode"))
+		return len * 4 / 5;
+	if (!strcmp(filter, "FlateDecode"))
+		return len * 3;
+	if (!strcmp(filter, "RunLengthDecode"))
+		return len * 3;
+	if (!strcmp(filter, "LZWDecode"))
+		return len * 2;
+	return len;
+}
+
+/*
+ * Give a filter a bigger buffer if we expect a lot of data out of it,
+ * so that long filter chains don't step through big streams 4k at a time.
+ */
+static void
+pdf_size_filter_buffer(fz_stream *stm, int len)
+{
+	if (len > stm->ep - stm->bp)
+		fz_resize_stream_buffer(stm, len);
+}
+
+/*
+ * Scanned documents often share one set of JBIG2 global segments between
+ * all their pages, so decode them once and keep them in the store.
+ */
+static fz_error
+pdf_load_jbig2_globals(fz_jbig2_globals **globalsp, pdf_xref *xref, fz_obj *obj)
+{
+	fz_error error;
+	fz_buffer *buf;
+
+	if ((*globalsp = pdf_find_item(xref->store, fz_drop_jbig2_globals, obj)))
+	{
+		fz_keep_jbig2_globals(*globalsp);
+		return fz_okay;
+	}
+
+	error = pdf_load_stream(&buf, xref, fz_to_num(obj), fz_to_gen(obj));
+	if (error)
+		return fz_rethrow(error, "cannot load jbig2 global segments (%d %d R)", fz_to_num(obj), fz_to_gen(obj));
+
+	*globalsp = fz_load_jbig2_globals(buf->data, buf->len);
+	fz_drop_buffer(buf);
+
+	pdf_store_item(xref->store, fz_keep_jbig2_globals, fz_drop_jbig2_globals, obj, *globalsp);
+
+	return fz_okay;
+}
+
 /*
  * Create a filter given a name and param dictionary.
  */
 static fz_stream *
-build_filter(fz_stream *chain, pdf_xref * xref, fz_obj * f, fz_obj * p, int num, int gen)
+build_filter(fz_stream *chain, pdf_xref * xref, fz_obj * f, fz_obj * p, int num, int gen, int l2factor)
 {
 	fz_error error;
 	char *s;
@@ -71,7 +126,7 @@ build_filter(fz_stream *chain, pdf_xref * xref, fz_obj * f, fz_obj * p, int num,
 		return fz_open_faxd(chain, p);
 
 	else if (!strcmp(s, "DCTDecode") || !strcmp(s, "DCT"))
-		return fz_open_dctd(chain, p);
+		return fz_open_dctd(chain, p, l2factor);
 
 	else if (!strcmp(s, "RunLengthDecode") || !strcmp(s, "RL"))
 		return fz_open_rld(chain);
@@ -94,18 +149,17 @@ build_filter(fz_stream *chain, pdf_xref * xref, fz_obj * f, fz_obj * p, int num,
 
 	else if (!strcmp(s, "JBIG2Decode"))
 	{
+		fz_jbig2_globals *globals = NULL;
 		fz_obj *obj = fz_dict_gets(p, "JBIG2Globals");
 		if (obj)
 		{
-			fz_buffer *globals;
-			error = pdf_load_stream(&globals, xref, fz_to_num(obj), fz_to_gen(obj));
+			error = pdf_load_jbig2_globals(&globals, xref, obj);
 			if (error)
 				fz_catch(error, "cannot load jbig2 global segments");
-			chain = fz_open_jbig2d(chain, globals);
-			fz_drop_buffer(globals);
-			return chain;
 		}
-		return fz_open_jbig2d(chain, NULL);
+		chain = fz_open_jbig2d(chain, globals);
+		fz_drop_jbig2_globals(globals);
+		return chain;
 	}
 
 	else if (!strcmp(s, "JPXDecode"))
@@ -136,19 +190,23 @@ build_filter(fz_stream *chain, pdf_xref * xref, fz_obj * f, fz_obj * p, int num,
  * Build a chain of filters given filter names and param dicts.
  * If head is given, start filter chain with it.
  * Assume ownership of head.
+ * Only the last filter is asked to reduce its output by l2factor.
  */
 static fz_stream *
-build_filter_chain(fz_stream *chain, pdf_xref *xref, fz_obj *fs, fz_obj *ps, int num, int gen)
+build_filter_chain(fz_stream *chain, pdf_xref *xref, fz_obj *fs, fz_obj *ps, int num, int gen, int len, int l2factor)
 {
 	fz_obj *f;
 	fz_obj *p;
-	int i;
+	int i, n;
 
-	for (i = 0; i < fz_array_len(fs); i++)
+	n = fz_array_len(fs);
+	for (i = 0; i < n; i++)
 	{
 		f = fz_array_get(fs, i);
 		p = fz_array_get(ps, i);
-		chain = build_filter(chain, xref, f, p, num, gen);
+		chain = build_filter(chain, xref, f, p, num, gen, i == n - 1 ? l2factor : 0);
+		len = pdf_guess_filter_length(len, fz_to_name(f));
+		pdf_size_filter_buffer(chain, len);
 	}
 
 	return chain;
@@ -158,22 +216,38 @@ build_filter_chain(fz_stream *chain, pdf_xref *xref, fz_obj *fs, fz_obj *ps, int
  * Build a filter for reading raw stream data.
  * This is a null filter to constrain reading to the
  * stream length, followed by a decryption filter.
+ * If the file is held in memory, read the stream data
+ * from there directly instead of through the null filter.
  */
 static fz_stream *
-pdf_open_raw_filter(fz_stream *chain, pdf_xref *xref, fz_obj *stmobj, int num, int gen)
+pdf_open_raw_filter(fz_stream *chain, pdf_xref *xref, fz_obj *stmobj, int num, int gen, fz_off_t stm_ofs)
 {
+	fz_buffer *slice;
 	int hascrypt;
 	int len;
 
-	/* don't close chain when we close this filter */
-	fz_keep_stream(chain);
-
 	len = fz_to_int(fz_dict_gets(stmobj, "Length"));
-	chain = fz_open_null(chain, len);
+
+	slice = fz_slice_stream(chain, stm_ofs, len);
+	if (slice)
+	{
+		chain = fz_open_buffer(slice);
+		fz_drop_buffer(slice);
+	}
+	else
+	{
+		/* don't close chain when we close this filter */
+		fz_keep_stream(chain);
+		chain = fz_open_null(chain, len);
+		pdf_size_filter_buffer(chain, len);
+	}
 
 	hascrypt = pdf_stream_has_crypt(stmobj);
 	if (xref->crypt && !hascrypt)
+	{
 		chain = pdf_open_crypt(chain, xref->crypt, num, gen);
+		pdf_size_filter_buffer(chain, len);
+	}
 
 	return chain;
 }
@@ -183,20 +257,28 @@ pdf_open_raw_filter(fz_stream *chain, pdf_xref *xref, fz_obj *stmobj, int num, i
  * to stream length and decrypting.
  */
 static fz_stream *
-pdf_open_filter(fz_stream *chain, pdf_xref *xref, fz_obj *stmobj, int num, int gen)
+pdf_open_filter(fz_stream *chain, pdf_xref *xref, fz_obj *stmobj, int num, int gen, fz_off_t stm_ofs, int l2factor)
 {
 	fz_obj *filters;
 	fz_obj *params;
+	int len;
 
 	filters = fz_dict_getsa(stmobj, "Filter", "F");
 	params = fz_dict_getsa(stmobj, "DecodeParms", "DP");
+	len = fz_to_int(fz_dict_gets(stmobj, "Length"));
 
-	chain = pdf_open_raw_filter(chain, xref, stmobj, num, gen);
+	chain = pdf_open_raw_filter(chain, xref, stmobj, num, gen, stm_ofs);
 
 	if (fz_is_name(filters))
-		return build_filter(chain, xref, filters, params, num, gen);
-	if (fz_array_len(filters) > 0)
-		return build_filter_chain(chain, xref, filters, params, num, gen);
+	{
+		chain = build_filter(chain, xref, filters, params, num, gen, l2factor);
+		pdf_size_filter_buffer(chain, pdf_guess_filter_length(len, fz_to_name(filters)));
+	}
+	else if (fz_array_len(filters) > 0)
+		chain = build_filter_chain(chain, xref, filters, params, num, gen, len, l2factor);
+
+	/* the decoded length, if the producer told us */
+	pdf_size_filter_buffer(chain, fz_to_int(fz_dict_gets(stmobj, "DL")));
 
 	return chain;
 }
@@ -218,9 +300,9 @@ pdf_open_inline_stream(fz_stream *chain, pdf_xref *xref, fz_obj *stmobj, int len
 	fz_keep_stream(chain);
 
 	if (fz_is_name(filters))
-		return build_filter(chain, xref, filters, params, 0, 0);
+		return build_filter(chain, xref, filters, params, 0, 0, 0);
 	if (fz_array_len(filters) > 0)
-		return build_filter_chain(chain, xref, filters, params, 0, 0);
+		return build_filter_chain(chain, xref, filters, params, 0, 0, length, 0);
 
 	return fz_open_null(chain, length);
 }
@@ -232,22 +314,21 @@ pdf_open_inline_stream(fz_stream *chain, pdf_xref *xref, fz_obj *stmobj, int len
 fz_error
 pdf_open_raw_stream(fz_stream **stmp, pdf_xref *xref, int num, int gen)
 {
-	pdf_xref_entry *x;
+	fz_off_t stm_ofs;
 	fz_error error;
 
 	if (num < 0 || num >= xref->len)
 		return fz_throw("object id out of range (%d %d R)", num, gen);
 
-	x = xref->table + num;
-
 	error = pdf_cache_object(xref, num, gen);
 	if (error)
 		return fz_rethrow(error, "cannot load stream object (%d %d R)", num, gen);
 
-	if (x->stm_ofs)
+	stm_ofs = pdf_get_stream_offset(xref, num);
+	if (stm_ofs)
 	{
-		*stmp = pdf_open_raw_filter(xref->file, xref, x->obj, num, gen);
-		fz_seek(xref->file, x->stm_ofs, 0);
+		*stmp = pdf_open_raw_filter(xref->file, xref, pdf_get_cached_object(xref, num), num, gen, stm_ofs);
+		fz_seek(xref->file, stm_ofs, 0);
 		return fz_okay;
 	}
 
@@ -258,26 +339,27 @@ pdf_open_raw_stream(fz_stream **stmp, pdf_xref *xref, int num, int gen)
  * Open a stream for reading uncompressed data.
  * Put the opened file in xref->stream.
  * Using xref->file while a stream is open is a Bad idea.
+ * An image stream may be decoded at 1/2, 1/4 or 1/8 size (l2factor 1 to 3)
+ * if its last filter can do that cheaply; others ignore l2factor.
  */
 fz_error
-pdf_open_stream(fz_stream **stmp, pdf_xref *xref, int num, int gen)
+pdf_open_image_stream(fz_stream **stmp, pdf_xref *xref, int num, int gen, int l2factor)
 {
-	pdf_xref_entry *x;
+	fz_off_t stm_ofs;
 	fz_error error;
 
 	if (num < 0 || num >= xref->len)
 		return fz_throw("object id out of range (%d %d R)", num, gen);
 
-	x = xref->table + num;
-
 	error = pdf_cache_object(xref, num, gen);
 	if (error)
 		return fz_rethrow(error, "cannot load stream object (%d %d R)", num, gen);
 
-	if (x->stm_ofs)
+	stm_ofs = pdf_get_stream_offset(xref, num);
+	if (stm_ofs)
 	{
-		*stmp = pdf_open_filter(xref->file, xref, x->obj, num, gen);
-		fz_seek(xref->file, x->stm_ofs, 0);
+		*stmp = pdf_open_filter(xref->file, xref, pdf_get_cached_object(xref, num), num, gen, stm_ofs, l2factor);
+		fz_seek(xref->file, stm_ofs, 0);
 		return fz_okay;
 	}
 
@@ -285,17 +367,48 @@ pdf_open_stream(fz_stream **stmp, pdf_xref *xref, int num, int gen)
 }
 
 fz_error
-pdf_open_stream_at(fz_stream **stmp, pdf_xref *xref, int num, int gen, fz_obj *dict, int stm_ofs)
+pdf_open_stream(fz_stream **stmp, pdf_xref *xref, int num, int gen)
+{
+	return pdf_open_image_stream(stmp, xref, num, gen, 0);
+}
+
+fz_error
+pdf_open_stream_at(fz_stream **stmp, pdf_xref *xref, int num, int gen, fz_obj *dict, fz_off_t stm_ofs)
 {
 	if (stm_ofs)
 	{
-		*stmp = pdf_open_filter(xref->file, xref, dict, num, gen);
+		*stmp = pdf_open_filter(xref->file, xref, dict, num, gen, stm_ofs, 0);
 		fz_seek(xref->file, stm_ofs, 0);
 		return fz_okay;
 	}
 	return fz_throw("object is not a stream");
 }
 
+/*
+ * Share the raw data of a stream that needs no decryption (and,
+ * if unfiltered is set, no decoding) directly from the file,
+ * if the file is held in memory. Returns NULL otherwise.
+ */
+static fz_buffer *
+pdf_slice_raw_stream(pdf_xref *xref, int num, fz_obj *dict, int unfiltered)
+{
+	fz_obj *filters;
+	int len;
+
+	if (xref->crypt && !pdf_stream_has_crypt(dict))
+		return NULL;
+
+	if (unfiltered)
+	{
+		filters = fz_dict_getsa(dict, "Filter", "F");
+		if (fz_is_name(filters) || fz_array_len(filters) > 0)
+			return NULL;
+	}
+
+	len = fz_to_int(fz_dict_gets(dict, "Length"));
+	return fz_slice_stream(xref->file, pdf_get_stream_offset(xref, num), len);
+}
+
 /*
  * Load raw (compressed but decrypted) contents of a stream into buf.
  */
@@ -313,6 +426,16 @@ pdf_load_raw_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen)
 
 	len = fz_to_int(fz_dict_gets(dict, "Length"));
 
+	if (pdf_get_stream_offset(xref, num))
+	{
+		*bufp = pdf_slice_raw_stream(xref, num, dict, 0);
+		if (*bufp)
+		{
+			fz_drop_obj(dict);
+			return fz_okay;
+		}
+	}
+
 	fz_drop_obj(dict);
 
 	error = pdf_open_raw_stream(&stm, xref, num, gen);
@@ -330,46 +453,118 @@ pdf_load_raw_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen)
 	return fz_okay;
 }
 
+/*
+ * Decode a stream of known decoded length in one go, into a buffer
+ * allocated once at the right size. Handles FlateDecode with or without
+ * a PNG predictor. Returns NULL if the stream doesn't fit the bill, or
+ * doesn't decode to exactly the expected length.
+ */
+static fz_buffer *
+pdf_decode_whole_stream(pdf_xref *xref, int num, int gen, fz_obj *dict, int len)
+{
+	fz_error error;
+	fz_obj *filters, *params;
+	fz_buffer *raw, *buf;
+	int n;
+
+	filters = fz_dict_getsa(dict, "Filter", "F");
+	params = fz_dict_getsa(dict, "DecodeParms", "DP");
+	if (fz_is_array(filters))
+	{
+		if (fz_array_len(filters) != 1)
+			return NULL;
+		filters = fz_array_get(filters, 0);
+		params = fz_array_get(params, 0);
+	}
+
+	if (strcmp(fz_to_name(filters), "FlateDecode") && strcmp(fz_to_name(filters), "Fl"))
+		return NULL;
+
+	n = len;
+	if (fz_to_int(fz_dict_gets(params, "Predictor")) > 1)
+	{
+		n = fz_png_predicted_length(params, len);
+		if (n < 0)
+			return NULL;
+	}
+
+	error = pdf_load_raw_stream(&raw, xref, num, gen);
+	if (error)
+	{
+		fz_catch(error, "cannot load raw stream (%d %d R)", num, gen);
+		return NULL;
+	}
+
+	buf = fz_new_buffer(n);
+	if (fz_inflate_buffer(buf->data, n, raw->data, raw->len) != n)
+	{
+		fz_drop_buffer(raw);
+		fz_drop_buffer(buf);
+		return NULL;
+	}
+	fz_drop_buffer(raw);
+
+	if (n != len)
+		fz_unpredict_png_buffer(buf->data, n, params);
+	buf->len = len;
+
+	return buf;
+}
+
 static int
-pdf_guess_filter_length(int len, char *filter)
+pdf_guess_decoded_length(fz_obj *dict)
 {
-	if (!strcmp(filter, "ASCIIHexDecode"))
-		return len / 2;
-	if (!strcmp(filter, "ASCII85Decode"))
-		return len * 4 / 5;
-	if (!strcmp(filter, "FlateDecode"))
-		return len * 3;
-	if (!strcmp(filter, "RunLengthDecode"))
-		return len * 3;
-	if (!strcmp(filter, "LZWDecode"))
-		return len * 2;
+	fz_obj *obj;
+	int i, len;
+
+	len = fz_to_int(fz_dict_gets(dict, "Length"));
+	obj = fz_dict_gets(dict, "Filter");
+	len = pdf_guess_filter_length(len, fz_to_name(obj));
+	for (i = 0; i < fz_array_len(obj); i++)
+		len = pdf_guess_filter_length(len, fz_to_name(fz_array_get(obj, i)));
+
 	return len;
 }
 
 /*
- * Load uncompressed contents of a stream into buf.
+ * Load uncompressed contents of a stream into buf. If the decoded length
+ * is known, either from the caller or from /DL, try to decode it in one go.
  */
-fz_error
-pdf_load_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen)
+static fz_error
+pdf_load_stream_imp(fz_buffer **bufp, pdf_xref *xref, int num, int gen, int len, int l2factor)
 {
 	fz_error error;
 	fz_stream *stm;
-	fz_obj *dict, *obj;
-	int i, len;
-
-	error = pdf_open_stream(&stm, xref, num, gen);
-	if (error)
-		return fz_rethrow(error, "cannot open stream (%d %d R)", num, gen);
+	fz_obj *dict;
 
 	error = pdf_load_object(&dict, xref, num, gen);
 	if (error)
 		return fz_rethrow(error, "cannot load stream dictionary (%d %d R)", num, gen);
 
-	len = fz_to_int(fz_dict_gets(dict, "Length"));
-	obj = fz_dict_gets(dict, "Filter");
-	len = pdf_guess_filter_length(len, fz_to_name(obj));
-	for (i = 0; i < fz_array_len(obj); i++)
-		len = pdf_guess_filter_length(len, fz_to_name(fz_array_get(obj, i)));
+	if (len <= 0)
+		len = fz_to_int(fz_dict_gets(dict, "DL"));
+
+	if (pdf_get_stream_offset(xref, num))
+	{
+		*bufp = pdf_slice_raw_stream(xref, num, dict, 1);
+		if (!*bufp && len > 0)
+			*bufp = pdf_decode_whole_stream(xref, num, gen, dict, len);
+		if (*bufp)
+		{
+			fz_drop_obj(dict);
+			return fz_okay;
+		}
+	}
+
+	error = pdf_open_image_stream(&stm, xref, num, gen, l2factor);
+	if (error)
+	{
+		fz_drop_obj(dict);
+		return fz_rethrow(error, "cannot open stream (%d %d R)", num, gen);
+	}
+
+	if (len <= 0)
+		len = pdf_guess_decoded_length(dict);
 
 	fz_drop_obj(dict);
 
@@ -383,3 +578,21 @@ pdf_load_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen)
 	fz_close(stm);
 	return fz_okay;
 }
+
+fz_error
+pdf_load_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen)
+{
+	return pdf_load_stream_imp(bufp, xref, num, gen, 0, 0);
+}
+
+/*
+ * Load the samples of an image stream, which should decode to len bytes
+ * (at the reduced size given by l2factor, see pdf_open_image_stream).
+ * The buffer may still be shorter or longer if the stream doesn't match,
+ * and may share data with the file.
+ */
+fz_error
+pdf_load_image_stream(fz_buffer **bufp, pdf_xref *xref, int num, int gen, int len, int l2factor)
+{
+	return pdf_load_stream_imp(bufp, xref, num, gen, len, l2factor);
+}
@@ -19,6 +19,7 @@ pdf_load_xobject(pdf_xobject **formp, pdf_xref *xref, fz_obj *dict)
 	form->resources = NULL;
 	form->contents = NULL;
 	form->colorspace = NULL;
+	form->me = fz_keep_obj(dict);
 
 	/* Store item immediately, to avoid possible recursion if objects refer back to this one */
 	pdf_store_item(xref->store, pdf_keep_xobject, pdf_drop_xobject, dict, form);
@@ -91,6 +92,8 @@ pdf_drop_xobject(pdf_xobject *xobj)
 			fz_drop_obj(xobj->resources);
 		if (xobj->contents)
 			fz_drop_buffer(xobj->contents);
+		if (xobj->me)
+			fz_drop_obj(xobj->me);
 		fz_free(xobj);
 	}
 }
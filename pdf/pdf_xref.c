@@ -1,6 +1,9 @@
 #include "fitz.h"
 #include "mupdf.h"
 
+/* default budget for cached objects, see pdf_trim_object_cache */
+enum { PDF_OBJ_CACHE_MAX = 16 << 20 };
+
 static inline int iswhite(int ch)
 {
 	return
@@ -31,14 +34,15 @@ static fz_error
 pdf_read_start_xref(pdf_xref *xref)
 {
 	unsigned char buf[1024];
-	int t, n;
+	fz_off_t t;
+	int n;
 	int i;
 
 	fz_seek(xref->file, 0, 2);
 
 	xref->file_size = fz_tell(xref->file);
 
-	t = MAX(0, xref->file_size - (int)sizeof buf);
+	t = MAX(0, xref->file_size - (fz_off_t)sizeof buf);
 	fz_seek(xref->file, t, 0);
 
 	n = fz_read(xref->file, buf, sizeof buf);
@@ -52,7 +56,7 @@ pdf_read_start_xref(pdf_xref *xref)
 			i += 9;
 			while (iswhite(buf[i]) && i < n)
 				i ++;
-			xref->startxref = atoi((char*)(buf + i));
+			xref->startxref = strtoll((char*)(buf + i), NULL, 10);
 			return fz_okay;
 		}
 	}
@@ -71,7 +75,7 @@ pdf_read_old_trailer(pdf_xref *xref, char *buf, int cap)
 	int len;
 	char *s;
 	int n;
-	int t;
+	fz_off_t t;
 	int tok;
 	int c;
 
@@ -100,7 +104,7 @@ pdf_read_old_trailer(pdf_xref *xref, char *buf, int cap)
 		if (t < 0)
 			return fz_throw("cannot tell in file");
 
-		fz_seek(xref->file, t + 20 * len, 0);
+		fz_seek(xref->file, t + 20 * (fz_off_t)len, 0);
 	}
 
 	error = pdf_lex(&tok, xref->file, buf, cap, &n);
@@ -178,8 +182,8 @@ pdf_resize_xref(pdf_xref *xref, int newlen)
 		xref->table[i].type = 0;
 		xref->table[i].ofs = 0;
 		xref->table[i].gen = 0;
-		xref->table[i].stm_ofs = 0;
-		xref->table[i].obj = NULL;
+		xref->table[i].flags = 0;
+		xref->table[i].slot = 0;
 	}
 	xref->len = newlen;
 }
@@ -237,7 +241,7 @@ pdf_read_old_xref(fz_obj **trailerp, pdf_xref *xref, char *buf, int cap)
 				while (*s != '\0' && iswhite(*s))
 					s++;
 
-				xref->table[i].ofs = atoi(s);
+				xref->table[i].ofs = strtoll(s, NULL, 10);
 				xref->table[i].gen = atoi(s + 11);
 				xref->table[i].type = s[17];
 				if (s[17] != 'f' && s[17] != 'n' && s[17] != 'o')
@@ -275,7 +279,7 @@ pdf_read_new_xref_section(pdf_xref *xref, fz_stream *stm, int i0, int i1, int w0
 	for (i = i0; i < i0 + i1; i++)
 	{
 		int a = 0;
-		int b = 0;
+		fz_off_t b = 0;
 		int c = 0;
 
 		if (fz_is_eof(stm))
@@ -308,7 +312,8 @@ pdf_read_new_xref(fz_obj **trailerp, pdf_xref *xref, char *buf, int cap)
 	fz_obj *trailer;
 	fz_obj *index;
 	fz_obj *obj;
-	int num, gen, stm_ofs;
+	int num, gen;
+	fz_off_t stm_ofs;
 	int size, w0, w1, w2;
 	int t;
 
@@ -387,7 +392,7 @@ pdf_read_new_xref(fz_obj **trailerp, pdf_xref *xref, char *buf, int cap)
 }
 
 static fz_error
-pdf_read_xref(fz_obj **trailerp, pdf_xref *xref, int ofs, char *buf, int cap)
+pdf_read_xref(fz_obj **trailerp, pdf_xref *xref, fz_off_t ofs, char *buf, int cap)
 {
 	fz_error error;
 	int c;
@@ -402,13 +407,13 @@ pdf_read_xref(fz_obj **trailerp, pdf_xref *xref, int ofs, char *buf, int cap)
 	{
 		error = pdf_read_old_xref(trailerp, xref, buf, cap);
 		if (error)
-			return fz_rethrow(error, "cannot read xref (ofs=%d)", ofs);
+			return fz_rethrow(error, "cannot read xref (ofs=%lld)", ofs);
 	}
 	else if (c >= '0' && c <= '9')
 	{
 		error = pdf_read_new_xref(trailerp, xref, buf, cap);
 		if (error)
-			return fz_rethrow(error, "cannot read xref (ofs=%d)", ofs);
+			return fz_rethrow(error, "cannot read xref (ofs=%lld)", ofs);
 	}
 	else
 	{
@@ -419,7 +424,7 @@ pdf_read_xref(fz_obj **trailerp, pdf_xref *xref, int ofs, char *buf, int cap)
 }
 
 static fz_error
-pdf_read_xref_sections(pdf_xref *xref, int ofs, char *buf, int cap)
+pdf_read_xref_sections(pdf_xref *xref, fz_off_t ofs, char *buf, int cap)
 {
 	fz_error error;
 	fz_obj *trailer;
@@ -434,7 +439,7 @@ pdf_read_xref_sections(pdf_xref *xref, int ofs, char *buf, int cap)
 	xrefstm = fz_dict_gets(trailer, "XRefStm");
 	if (xrefstm)
 	{
-		error = pdf_read_xref_sections(xref, fz_to_int(xrefstm), buf, cap);
+		error = pdf_read_xref_sections(xref, fz_to_offset(xrefstm), buf, cap);
 		if (error)
 		{
 			fz_drop_obj(trailer);
@@ -445,7 +450,7 @@ pdf_read_xref_sections(pdf_xref *xref, int ofs, char *buf, int cap)
 	prev = fz_dict_gets(trailer, "Prev");
 	if (prev)
 	{
-		error = pdf_read_xref_sections(xref, fz_to_int(prev), buf, cap);
+		error = pdf_read_xref_sections(xref, fz_to_offset(prev), buf, cap);
 		if (error)
 		{
 			fz_drop_obj(trailer);
@@ -457,6 +462,218 @@ pdf_read_xref_sections(pdf_xref *xref, int ofs, char *buf, int cap)
 	return fz_okay;
 }
 
+static fz_error
+pdf_check_xref(pdf_xref *xref)
+{
+	pdf_xref_entry *x;
+	int i;
+
+	/* the entries that are still unset may be in the main xref of a linearized file */
+	int partial = xref->main_xref_ofs > 0;
+
+	/* broken pdfs where first object is not free */
+	if (xref->table[0].type != 'f')
+		return fz_throw("first object in xref is not free");
+
+	/* broken pdfs where object offsets are out of range */
+	for (i = 0; i < xref->len; i++)
+	{
+		x = &xref->table[i];
+		if (x->type == 'n')
+			if (x->ofs <= 0 || x->ofs >= xref->file_size)
+				return fz_throw("object offset out of range: %lld (%d 0 R)", x->ofs, i);
+		if (x->type == 'o')
+			if (x->ofs <= 0 || x->ofs >= xref->len ||
+				!(xref->table[x->ofs].type == 'n' || (partial && xref->table[x->ofs].type == 0)))
+				return fz_throw("invalid reference to an objstm that does not exist: %lld (%d 0 R)", x->ofs, i);
+	}
+
+	return fz_okay;
+}
+
+/*
+ * Linearized files start with a small xref for the objects of the first
+ * page. Read only that one, and leave the main xref at the end of the file
+ * until we need an object that isn't in the first page section. The file
+ * is left alone (with no xref table) if it isn't linearized, or has been
+ * updated since it was.
+ */
+
+static int
+pdf_has_linear_marker(char *buf, int n)
+{
+	int i;
+	for (i = 0; i + 11 <= n; i++)
+		if (!memcmp(buf + i, "/Linearized", 11))
+			return 1;
+	return 0;
+}
+
+static fz_error
+pdf_load_linear_xref(pdf_xref *xref, char *buf, int cap)
+{
+	fz_error error;
+	fz_obj *dict, *trailer, *obj;
+	fz_off_t ofs;
+	int n;
+
+	/* most files aren't linearized, so peek before parsing anything */
+	fz_seek(xref->file, 0, 0);
+	n = fz_read(xref->file, (unsigned char *)buf, MIN(cap, 1024));
+	if (n < 0)
+		return fz_rethrow(n, "cannot read from file");
+	if (!pdf_has_linear_marker(buf, n))
+		return fz_okay;
+
+	fz_seek(xref->file, 0, 2);
+	xref->file_size = fz_tell(xref->file);
+
+	/* the linearization dictionary is the first object after the header */
+	fz_seek(xref->file, 0, 0);
+	fz_read_line(xref->file, buf, cap);
+	error = pdf_parse_ind_obj(&dict, xref, xref->file, buf, cap, NULL, NULL, NULL);
+	if (error)
+		return fz_rethrow(error, "cannot parse linearization dictionary");
+	ofs = fz_tell(xref->file);
+
+	if (!fz_dict_gets(dict, "Linearized") || fz_to_offset(fz_dict_gets(dict, "L")) != xref->file_size)
+	{
+		fz_drop_obj(dict);
+		return fz_okay;
+	}
+
+	obj = fz_dict_gets(dict, "H");
+	xref->linear_page1 = fz_to_int(fz_dict_gets(dict, "O"));
+	xref->linear_page_count = fz_to_int(fz_dict_gets(dict, "N"));
+	xref->linear_hint_ofs = fz_to_offset(fz_array_get(obj, 0));
+	xref->linear_hint_len = fz_to_int(fz_array_get(obj, 1));
+	fz_drop_obj(dict);
+
+	if (xref->linear_page1 <= 0 || xref->linear_page_count <= 0)
+		return fz_throw("invalid linearization dictionary");
+
+	/* the first page trailer has everything, and points back to the main xref */
+	xref->startxref = ofs;
+	error = pdf_read_trailer(xref, buf, cap);
+	if (error)
+		return fz_rethrow(error, "cannot read first page trailer");
+
+	obj = fz_dict_gets(xref->trailer, "Size");
+	if (!obj)
+		return fz_throw("trailer missing Size entry");
+	pdf_resize_xref(xref, fz_to_int(obj));
+
+	error = pdf_read_xref(&trailer, xref, ofs, buf, cap);
+	if (error)
+		return fz_rethrow(error, "cannot read first page xref");
+
+	obj = fz_dict_gets(trailer, "XRefStm");
+	if (obj)
+	{
+		error = pdf_read_xref_sections(xref, fz_to_offset(obj), buf, cap);
+		if (error)
+		{
+			fz_drop_obj(trailer);
+			return fz_rethrow(error, "cannot read /XRefStm xref section");
+		}
+	}
+
+	xref->main_xref_ofs = fz_to_offset(fz_dict_gets(trailer, "Prev"));
+	fz_drop_obj(trailer);
+
+	/* object 0 is always free, don't read the main xref to find out */
+	if (xref->table[0].type == 0)
+	{
+		xref->table[0].type = 'f';
+		xref->table[0].gen = 65535;
+	}
+
+	error = pdf_check_xref(xref);
+	if (error)
+		return fz_rethrow(error, "cannot read first page xref");
+
+	return fz_okay;
+}
+
+/*
+ * The main xref of a linearized file is broken, so rebuild the table by
+ * scanning the file, the same way pdf_open_xref does. Objects that are
+ * already loaded and the first page trailer are kept, since callers may
+ * be holding on to them.
+ */
+static fz_error
+pdf_repair_linear_xref(pdf_xref *xref)
+{
+	fz_error error;
+	fz_obj *trailer, *obj;
+	int i;
+
+	for (i = 0; i < xref->len; i++)
+	{
+		if (!pdf_get_cached_object(xref, i))
+		{
+			xref->table[i].type = 0;
+			xref->table[i].ofs = 0;
+			xref->table[i].gen = 0;
+		}
+	}
+
+	trailer = xref->trailer;
+	xref->trailer = NULL;
+	error = pdf_repair_xref(xref, xref->scratch, sizeof xref->scratch);
+	if (error)
+	{
+		xref->trailer = trailer;
+		return fz_rethrow(error, "cannot repair document");
+	}
+
+	obj = fz_dict_gets(xref->trailer, "Root");
+	if (obj && !fz_dict_gets(trailer, "Root"))
+		fz_dict_puts(trailer, "Root", obj);
+	obj = fz_dict_gets(xref->trailer, "Info");
+	if (obj && !fz_dict_gets(trailer, "Info"))
+		fz_dict_puts(trailer, "Info", obj);
+	fz_drop_obj(xref->trailer);
+	xref->trailer = trailer;
+
+	error = pdf_repair_obj_stms(xref);
+	if (error)
+		return fz_rethrow(error, "cannot repair document");
+
+	return fz_okay;
+}
+
+/*
+ * Read the main xref of a linearized file that was opened from its first
+ * page section. This is done on demand when looking up other objects, but
+ * callers that go through the whole xref table must call it first.
+ */
+
+fz_error
+pdf_load_full_xref(pdf_xref *xref)
+{
+	fz_error error;
+	fz_off_t ofs = xref->main_xref_ofs;
+
+	if (!ofs)
+		return fz_okay;
+
+	xref->main_xref_ofs = 0;
+
+	error = pdf_read_xref_sections(xref, ofs, xref->scratch, sizeof xref->scratch);
+	if (!error)
+		error = pdf_check_xref(xref);
+	if (error)
+	{
+		fz_catch(error, "cannot read main xref, trying to repair");
+		error = pdf_repair_linear_xref(xref);
+		if (error)
+			return fz_rethrow(error, "cannot read main xref");
+	}
+
+	return fz_okay;
+}
+
 /*
  * load xref tables from pdf
  */
@@ -466,12 +683,32 @@ pdf_load_xref(pdf_xref *xref, char *buf, int bufsize)
 {
 	fz_error error;
 	fz_obj *size;
-	int i;
 
 	error = pdf_load_version(xref);
 	if (error)
 		return fz_rethrow(error, "cannot read version marker");
 
+	error = pdf_load_linear_xref(xref, buf, bufsize);
+	if (error)
+	{
+		fz_catch(error, "ignoring linearization");
+		if (xref->table)
+		{
+			fz_free(xref->table);
+			xref->table = NULL;
+			xref->len = 0;
+		}
+		if (xref->trailer)
+		{
+			fz_drop_obj(xref->trailer);
+			xref->trailer = NULL;
+		}
+		xref->main_xref_ofs = 0;
+		xref->linear_page1 = 0;
+	}
+	else if (xref->table)
+		return fz_okay;
+
 	error = pdf_read_start_xref(xref);
 	if (error)
 		return fz_rethrow(error, "cannot read startxref");
@@ -490,20 +727,9 @@ pdf_load_xref(pdf_xref *xref, char *buf, int bufsize)
 	if (error)
 		return fz_rethrow(error, "cannot read xref");
 
-	/* broken pdfs where first object is not free */
-	if (xref->table[0].type != 'f')
-		return fz_throw("first object in xref is not free");
-
-	/* broken pdfs where object offsets are out of range */
-	for (i = 0; i < xref->len; i++)
-	{
-		if (xref->table[i].type == 'n')
-			if (xref->table[i].ofs <= 0 || xref->table[i].ofs >= xref->file_size)
-				return fz_throw("object offset out of range: %d (%d 0 R)", xref->table[i].ofs, i);
-		if (xref->table[i].type == 'o')
-			if (xref->table[i].ofs <= 0 || xref->table[i].ofs >= xref->len || xref->table[xref->table[i].ofs].type != 'n')
-				return fz_throw("invalid reference to an objstm that does not exist: %d (%d 0 R)", xref->table[i].ofs, i);
-	}
+	error = pdf_check_xref(xref);
+	if (error)
+		return fz_rethrow(error, "cannot read xref");
 
 	return fz_okay;
 }
@@ -513,25 +739,37 @@ pdf_load_xref(pdf_xref *xref, char *buf, int bufsize)
  * If password is not null, try to decrypt.
  */
 
-fz_error
-pdf_open_xref_with_stream(pdf_xref **xrefp, fz_stream *file, char *password)
+static fz_error
+pdf_open_xref_imp(pdf_xref **xrefp, fz_stream *file, char *password,
+	const char *filename, const char *indexname)
 {
 	pdf_xref *xref;
 	fz_error error;
 	fz_obj *encrypt, *id;
 	fz_obj *dict, *obj;
-	int i, repaired = 0;
+	int i, repaired = 0, indexed = 0;
 
-	/* install pdf specific callback */
+	/* install pdf specific callbacks */
 	fz_resolve_indirect = pdf_resolve_indirect;
+	fz_decrypt_string = pdf_decrypt_string;
+	fz_drop_string_crypt = pdf_drop_string_crypt;
 
 	xref = fz_malloc(sizeof(pdf_xref));
 
 	memset(xref, 0, sizeof(pdf_xref));
 
 	xref->file = fz_keep_stream(file);
+	xref->obj_cache_max = PDF_OBJ_CACHE_MAX;
+
+	if (indexname)
+	{
+		error = pdf_load_index(xref, filename, indexname);
+		if (error)
+			fz_catch(error, "ignoring document index");
+		indexed = xref->table != NULL;
+	}
 
-	error = pdf_load_xref(xref, xref->scratch, sizeof xref->scratch);
+	error = indexed ? fz_okay : pdf_load_xref(xref, xref->scratch, sizeof xref->scratch);
 	if (error)
 	{
 		fz_catch(error, "trying to repair");
@@ -632,10 +870,25 @@ pdf_open_xref_with_stream(pdf_xref **xrefp, fz_stream *file, char *password)
 		}
 	}
 
+	if (indexname && !indexed)
+	{
+		error = pdf_save_index(xref, filename, indexname);
+		if (error)
+			fz_catch(error, "cannot save document index");
+	}
+
 	*xrefp = xref;
 	return fz_okay;
 }
 
+fz_error
+pdf_open_xref_with_stream(pdf_xref **xrefp, fz_stream *file, char *password)
+{
+	return pdf_open_xref_imp(xrefp, file, password, NULL, NULL);
+}
+
+static void pdf_free_obj_stm_cache(pdf_xref *xref);
+
 void
 pdf_free_xref(pdf_xref *xref)
 {
@@ -644,30 +897,33 @@ pdf_free_xref(pdf_xref *xref)
 	if (xref->store)
 		pdf_free_store(xref->store);
 
-	if (xref->table)
+	pdf_detach_images(xref);
+	pdf_free_obj_stm_cache(xref);
+
+	if (xref->slots)
 	{
-		for (i = 0; i < xref->len; i++)
-		{
-			if (xref->table[i].obj)
-			{
-				fz_drop_obj(xref->table[i].obj);
-				xref->table[i].obj = NULL;
-			}
-		}
-		fz_free(xref->table);
+		for (i = 1; i < xref->slot_len; i++)
+			if (xref->slots[i].obj)
+				fz_drop_obj(xref->slots[i].obj);
+		fz_free(xref->slots);
 	}
 
+	fz_free(xref->table);
+	fz_free(xref->linear_page_ofs);
+
 	if (xref->page_objs)
 	{
 		for (i = 0; i < xref->page_len; i++)
-			fz_drop_obj(xref->page_objs[i]);
+			if (xref->page_objs[i])
+				fz_drop_obj(xref->page_objs[i]);
 		fz_free(xref->page_objs);
 	}
 
 	if (xref->page_refs)
 	{
 		for (i = 0; i < xref->page_len; i++)
-			fz_drop_obj(xref->page_refs[i]);
+			if (xref->page_refs[i])
+				fz_drop_obj(xref->page_refs[i]);
 		fz_free(xref->page_refs);
 	}
 
@@ -676,7 +932,7 @@ pdf_free_xref(pdf_xref *xref)
 	if (xref->trailer)
 		fz_drop_obj(xref->trailer);
 	if (xref->crypt)
-		pdf_free_crypt(xref->crypt);
+		pdf_drop_crypt(xref->crypt);
 
 	fz_free(xref);
 }
@@ -688,186 +944,466 @@ pdf_debug_xref(pdf_xref *xref)
 	printf("xref\n0 %d\n", xref->len);
 	for (i = 0; i < xref->len; i++)
 	{
-		printf("%05d: %010d %05d %c (stm_ofs=%d)\n", i,
+		printf("%05d: %010lld %05d %c (stm_ofs=%lld)\n", i,
 			xref->table[i].ofs,
 			xref->table[i].gen,
 			xref->table[i].type ? xref->table[i].type : '-',
-			xref->table[i].stm_ofs);
+			pdf_get_stream_offset(xref, i));
 	}
 }
 
 /*
  * compressed object streams
+ *
+ * We keep the decompressed contents and offset table of the few most
+ * recently used object streams, and only parse the objects that are
+ * actually asked for.
  */
 
+enum { MAX_OBJ_STM_CACHE = 8 };
+
+typedef struct pdf_obj_stm_s pdf_obj_stm;
+
+struct pdf_obj_stm_s
+{
+	int num;
+	int count;
+	int first;
+	int *numbuf;
+	int *ofsbuf;
+	fz_buffer *buf;
+	pdf_obj_stm *next;
+};
+
+static void
+pdf_free_obj_stm(pdf_obj_stm *os)
+{
+	fz_drop_buffer(os->buf);
+	fz_free(os->numbuf);
+	fz_free(os->ofsbuf);
+	fz_free(os);
+}
+
+static void
+pdf_free_obj_stm_cache(pdf_xref *xref)
+{
+	pdf_obj_stm *os;
+
+	while (xref->obj_stms)
+	{
+		os = xref->obj_stms;
+		xref->obj_stms = os->next;
+		pdf_free_obj_stm(os);
+	}
+}
+
 static fz_error
-pdf_load_obj_stm(pdf_xref *xref, int num, int gen, char *buf, int cap)
+pdf_load_obj_stm(pdf_obj_stm **osp, pdf_xref *xref, int num, int gen, char *buf, int cap)
 {
 	fz_error error;
 	fz_stream *stm;
 	fz_obj *objstm;
-	int *numbuf;
-	int *ofsbuf;
-
-	fz_obj *obj;
-	int first;
-	int count;
+	pdf_obj_stm *os;
 	int i, n;
 	int tok;
+	fz_off_t ival;
+	float fval;
 
 	error = pdf_load_object(&objstm, xref, num, gen);
 	if (error)
 		return fz_rethrow(error, "cannot load object stream object (%d %d R)", num, gen);
 
-	count = fz_to_int(fz_dict_gets(objstm, "N"));
-	first = fz_to_int(fz_dict_gets(objstm, "First"));
+	os = fz_malloc(sizeof(pdf_obj_stm));
+	os->num = num;
+	os->count = fz_to_int(fz_dict_gets(objstm, "N"));
+	os->first = fz_to_int(fz_dict_gets(objstm, "First"));
+	os->numbuf = NULL;
+	os->ofsbuf = NULL;
+	os->buf = NULL;
+	os->next = NULL;
+
+	fz_drop_obj(objstm);
 
-	numbuf = fz_calloc(count, sizeof(int));
-	ofsbuf = fz_calloc(count, sizeof(int));
+	if (os->count < 0 || os->first < 0)
+	{
+		pdf_free_obj_stm(os);
+		return fz_throw("corrupt object stream (%d %d R)", num, gen);
+	}
 
-	error = pdf_open_stream(&stm, xref, num, gen);
+	error = pdf_load_stream(&os->buf, xref, num, gen);
 	if (error)
 	{
-		error = fz_rethrow(error, "cannot open object stream (%d %d R)", num, gen);
-		goto cleanupbuf;
+		pdf_free_obj_stm(os);
+		return fz_rethrow(error, "cannot load object stream (%d %d R)", num, gen);
 	}
 
-	for (i = 0; i < count; i++)
+	os->numbuf = fz_calloc(os->count, sizeof(int));
+	os->ofsbuf = fz_calloc(os->count, sizeof(int));
+
+	stm = fz_open_buffer(os->buf);
+
+	for (i = 0; i < os->count; i++)
 	{
-		error = pdf_lex(&tok, stm, buf, cap, &n);
+		error = pdf_lex_value(&tok, stm, buf, cap, &n, &ival, &fval);
 		if (error || tok != PDF_TOK_INT)
-		{
-			error = fz_rethrow(error, "corrupt object stream (%d %d R)", num, gen);
-			goto cleanupstm;
-		}
-		numbuf[i] = atoi(buf);
+			goto cleanup;
+		os->numbuf[i] = (int)ival;
 
-		error = pdf_lex(&tok, stm, buf, cap, &n);
+		error = pdf_lex_value(&tok, stm, buf, cap, &n, &ival, &fval);
 		if (error || tok != PDF_TOK_INT)
-		{
-			error = fz_rethrow(error, "corrupt object stream (%d %d R)", num, gen);
-			goto cleanupstm;
-		}
-		ofsbuf[i] = atoi(buf);
+			goto cleanup;
+		os->ofsbuf[i] = (int)ival;
 	}
 
-	fz_seek(stm, first, 0);
+	fz_close(stm);
+	*osp = os;
+	return fz_okay;
 
-	for (i = 0; i < count; i++)
-	{
-		fz_seek(stm, first + ofsbuf[i], 0);
+cleanup:
+	fz_close(stm);
+	pdf_free_obj_stm(os);
+	return fz_rethrow(error, "corrupt object stream (%d %d R)", num, gen);
+}
 
-		error = pdf_parse_stm_obj(&obj, xref, stm, buf, cap);
-		if (error)
-		{
-			error = fz_rethrow(error, "cannot parse object %d in stream (%d %d R)", i, num, gen);
-			goto cleanupstm;
-		}
+/* find an object stream in the cache, loading it if needed, and move it to the front */
+static fz_error
+pdf_find_obj_stm(pdf_obj_stm **osp, pdf_xref *xref, int num)
+{
+	fz_error error;
+	pdf_obj_stm **prevp, *os;
+	int n;
 
-		if (numbuf[i] < 1 || numbuf[i] >= xref->len)
-		{
-			fz_drop_obj(obj);
-			error = fz_throw("object id (%d 0 R) out of range (0..%d)", numbuf[i], xref->len - 1);
-			goto cleanupstm;
-		}
+	*osp = NULL;
 
-		if (xref->table[numbuf[i]].type == 'o' && xref->table[numbuf[i]].ofs == num)
+	prevp = &xref->obj_stms;
+	for (os = xref->obj_stms; os; os = os->next)
+	{
+		if (os->num == num)
 		{
-			if (xref->table[numbuf[i]].obj)
-				fz_drop_obj(xref->table[numbuf[i]].obj);
-			xref->table[numbuf[i]].obj = obj;
+			*prevp = os->next;
+			goto found;
 		}
-		else
+		prevp = &os->next;
+	}
+
+	error = pdf_load_obj_stm(&os, xref, num, 0, xref->scratch, sizeof xref->scratch);
+	if (error)
+		return fz_rethrow(error, "cannot load object stream (%d 0 R)", num);
+
+	/* drop the least recently used stream if the cache is full */
+	n = 1;
+	for (prevp = &xref->obj_stms; *prevp; prevp = &(*prevp)->next)
+	{
+		if (n++ == MAX_OBJ_STM_CACHE)
 		{
-			fz_drop_obj(obj);
+			pdf_free_obj_stm(*prevp);
+			*prevp = NULL;
+			break;
 		}
 	}
 
-	fz_close(stm);
-	fz_free(ofsbuf);
-	fz_free(numbuf);
-	fz_drop_obj(objstm);
+found:
+	os->next = xref->obj_stms;
+	xref->obj_stms = os;
+	*osp = os;
 	return fz_okay;
+}
+
+static fz_error
+pdf_load_obj_stm_object(fz_obj **objp, int *sizep, pdf_xref *xref, int num, int gen)
+{
+	fz_error error;
+	fz_stream *stm;
+	pdf_obj_stm *os;
+	int i = xref->table[num].gen;
+
+	error = pdf_find_obj_stm(&os, xref, (int)xref->table[num].ofs);
+	if (error)
+		return fz_rethrow(error, "cannot load object stream containing object (%d %d R)", num, gen);
+
+	/* the xref entry tells us the index, but don't trust it blindly */
+	if (i < 0 || i >= os->count || os->numbuf[i] != num)
+	{
+		for (i = 0; i < os->count; i++)
+			if (os->numbuf[i] == num)
+				break;
+		if (i == os->count)
+			return fz_throw("object (%d %d R) was not found in its object stream", num, gen);
+	}
 
-cleanupstm:
+	stm = fz_open_buffer(os->buf);
+	fz_seek(stm, os->first + os->ofsbuf[i], 0);
+	error = pdf_parse_stm_obj(objp, xref, stm, xref->scratch, sizeof xref->scratch);
+	*sizep = fz_tell(stm) - (os->first + os->ofsbuf[i]);
 	fz_close(stm);
-cleanupbuf:
-	fz_free(ofsbuf);
-	fz_free(numbuf);
-	fz_drop_obj(objstm);
-	return error; /* already rethrown */
+	if (error)
+		return fz_rethrow(error, "cannot parse object %d in stream (%d 0 R)", i, os->num);
+
+	return fz_okay;
 }
 
 /*
  * object loading
+ *
+ * Parsed objects are cached in the xref slots. To keep memory in check for
+ * huge documents, pdf_trim_object_cache evicts objects that nobody else
+ * holds a reference to, using a clock sweep over the table, until the
+ * bytes parsed for the cached objects fit in obj_cache_max. Evicted objects
+ * are parsed again from the file when they are next asked for. Objects
+ * that have been changed in memory are pinned and never evicted.
+ *
+ * Callers may hold on to borrowed object pointers, so the cache is only
+ * trimmed when the application asks for it, typically between pages.
  */
 
+/* Find or make the slot for an object. This may move the slots array. */
+static pdf_xref_slot *
+pdf_get_xref_slot(pdf_xref *xref, int num)
+{
+	pdf_xref_entry *x = &xref->table[num];
+	pdf_xref_slot *slot;
+
+	if (x->slot)
+		return &xref->slots[x->slot];
+
+	if (xref->slot_free)
+	{
+		x->slot = xref->slot_free;
+		xref->slot_free = xref->slots[x->slot].next;
+	}
+	else
+	{
+		/* slot 0 is never used, so that 0 can mean none */
+		if (xref->slot_len == 0)
+			xref->slot_len = 1;
+		if (xref->slot_len >= xref->slot_cap)
+		{
+			xref->slot_cap = MAX(xref->slot_cap * 2, 256);
+			xref->slots = fz_realloc(xref->slots, xref->slot_cap, sizeof(pdf_xref_slot));
+		}
+		x->slot = xref->slot_len++;
+	}
+
+	slot = &xref->slots[x->slot];
+	slot->obj = NULL;
+	slot->stm_ofs = 0;
+	slot->size = 0;
+	slot->next = 0;
+	return slot;
+}
+
+fz_obj *
+pdf_get_cached_object(pdf_xref *xref, int num)
+{
+	int slot = xref->table[num].slot;
+	return slot ? xref->slots[slot].obj : NULL;
+}
+
+/* Drop the cached object and give its slot back */
+void
+pdf_drop_cached_object(pdf_xref *xref, int num)
+{
+	pdf_xref_entry *x = &xref->table[num];
+	pdf_xref_slot *slot;
+
+	if (!x->slot)
+		return;
+
+	slot = &xref->slots[x->slot];
+	if (slot->obj)
+		fz_drop_obj(slot->obj);
+	slot->obj = NULL;
+	xref->obj_cache_size -= slot->size;
+	slot->size = 0;
+	slot->next = xref->slot_free;
+	xref->slot_free = x->slot;
+	x->slot = 0;
+}
+
+fz_off_t
+pdf_get_stream_offset(pdf_xref *xref, int num)
+{
+	int slot = xref->table[num].slot;
+	return slot ? xref->slots[slot].stm_ofs : 0;
+}
+
+void
+pdf_set_stream_offset(pdf_xref *xref, int num, fz_off_t stm_ofs)
+{
+	pdf_get_xref_slot(xref, num)->stm_ofs = stm_ofs;
+}
+
 fz_error
 pdf_cache_object(pdf_xref *xref, int num, int gen)
 {
 	fz_error error;
 	pdf_xref_entry *x;
+	pdf_xref_slot *slot;
+	fz_obj *obj;
+	fz_off_t stm_ofs = 0;
 	int rnum, rgen;
+	int size = 0;
+
+	/* the main xref of a linearized file is only read when needed */
+	if (xref->main_xref_ofs && num >= 0 && (num >= xref->len || xref->table[num].type == 0))
+	{
+		error = pdf_load_full_xref(xref);
+		if (error)
+			return fz_rethrow(error, "cannot load object (%d %d R)", num, gen);
+	}
 
 	if (num < 0 || num >= xref->len)
 		return fz_throw("object out of range (%d %d R); xref size %d", num, gen, xref->len);
 
 	x = &xref->table[num];
+	x->flags |= PDF_XREF_USED;
 
-	if (x->obj)
+	if (x->slot && xref->slots[x->slot].obj)
 		return fz_okay;
 
 	if (x->type == 'f')
 	{
-		x->obj = fz_new_null();
+		pdf_get_xref_slot(xref, num)->obj = fz_new_null();
 		return fz_okay;
 	}
 	else if (x->type == 'n')
 	{
 		fz_seek(xref->file, x->ofs, 0);
 
-		error = pdf_parse_ind_obj(&x->obj, xref, xref->file, xref->scratch, sizeof xref->scratch,
-			&rnum, &rgen, &x->stm_ofs);
+		error = pdf_parse_ind_obj(&obj, xref, xref->file, xref->scratch, sizeof xref->scratch,
+			&rnum, &rgen, &stm_ofs);
 		if (error)
 			return fz_rethrow(error, "cannot parse object (%d %d R)", num, gen);
 
+		size = fz_tell(xref->file) - x->ofs;
+	}
+	else if (x->type == 'o')
+	{
+		error = pdf_load_obj_stm_object(&obj, &size, xref, num, gen);
+		if (error)
+			return fz_rethrow(error, "cannot load object (%d %d R) from object stream", num, gen);
+	}
+	else
+	{
+		return fz_throw("assert: corrupt xref struct");
+	}
+
+	/* loading an object stream may have read the main xref and moved the table */
+	x = &xref->table[num];
+
+	slot = pdf_get_xref_slot(xref, num);
+	slot->obj = obj;
+	if (x->type == 'n')
+		slot->stm_ofs = stm_ofs;
+	if (!(x->flags & PDF_XREF_PINNED))
+	{
+		slot->size = size;
+		xref->obj_cache_size += size;
+	}
+
+	if (x->type == 'n')
+	{
 		if (rnum != num)
 			return fz_throw("found object (%d %d R) instead of (%d %d R)", rnum, rgen, num, gen);
 
 		if (xref->crypt)
-			pdf_crypt_obj(xref->crypt, x->obj, num, gen);
+			pdf_crypt_obj(xref->crypt, obj, num, gen);
 	}
-	else if (x->type == 'o')
+
+	return fz_okay;
+}
+
+static int
+pdf_can_evict_object(pdf_xref *xref, pdf_xref_entry *x)
+{
+	fz_obj *obj = x->slot ? xref->slots[x->slot].obj : NULL;
+
+	if (!obj || (x->flags & PDF_XREF_PINNED))
+		return 0;
+	if (x->type != 'o' && (x->type != 'n' || x->ofs <= 0))
+		return 0;
+	return fz_get_obj_refs(obj) == 1;
+}
+
+void
+pdf_trim_object_cache(pdf_xref *xref)
+{
+	pdf_xref_entry *x;
+	int i, n, target;
+
+	if (xref->obj_cache_max <= 0)
+		return;
+	if (xref->obj_cache_size <= xref->obj_cache_max + xref->obj_cache_held)
+		return;
+
+	/* leave some slack so we don't sweep again on the very next page */
+	target = xref->obj_cache_max / 4 * 3;
+
+	/* page objects can be found again from their references */
+	for (i = 0; i < xref->page_len; i++)
 	{
-		if (!x->obj)
+		if (xref->page_objs[i] && fz_is_indirect(xref->page_refs[i]))
 		{
-			error = pdf_load_obj_stm(xref, x->ofs, 0, xref->scratch, sizeof xref->scratch);
-			if (error)
-				return fz_rethrow(error, "cannot load object stream containing object (%d %d R)", num, gen);
-			if (!x->obj)
-				return fz_throw("object (%d %d R) was not found in its object stream", num, gen);
+			fz_drop_obj(xref->page_objs[i]);
+			xref->page_objs[i] = NULL;
 		}
 	}
-	else
+
+	/* two passes give every object a chance to lose its used mark */
+	for (n = 0; n < 2 * xref->len && xref->obj_cache_size > target; n++)
 	{
-		return fz_throw("assert: corrupt xref struct");
+		if (xref->obj_cache_hand >= xref->len)
+			xref->obj_cache_hand = 0;
+		i = xref->obj_cache_hand++;
+		x = &xref->table[i];
+
+		if (!pdf_can_evict_object(xref, x))
+			continue;
+
+		if (x->flags & PDF_XREF_USED)
+		{
+			x->flags &= ~PDF_XREF_USED;
+			continue;
+		}
+
+		pdf_drop_cached_object(xref, i);
 	}
 
-	return fz_okay;
+	/* the rest is held elsewhere, don't sweep again until the cache grows */
+	xref->obj_cache_held = MAX(xref->obj_cache_size - target, 0);
+}
+
+/* Stop counting an object towards the cache and keep it in memory for good */
+void
+pdf_pin_object(pdf_xref *xref, int num)
+{
+	pdf_xref_entry *x = &xref->table[num];
+
+	if (!(x->flags & PDF_XREF_PINNED))
+	{
+		if (x->slot)
+		{
+			xref->obj_cache_size -= xref->slots[x->slot].size;
+			xref->slots[x->slot].size = 0;
+		}
+		x->flags |= PDF_XREF_PINNED;
+	}
 }
 
 fz_error
 pdf_load_object(fz_obj **objp, pdf_xref *xref, int num, int gen)
 {
 	fz_error error;
+	fz_obj *obj;
 
 	error = pdf_cache_object(xref, num, gen);
 	if (error)
 		return fz_rethrow(error, "cannot load object (%d %d R) into cache", num, gen);
 
-	assert(xref->table[num].obj);
+	obj = pdf_get_cached_object(xref, num);
+	assert(obj);
 
-	*objp = fz_keep_obj(xref->table[num].obj);
+	*objp = fz_keep_obj(obj);
 
 	return fz_okay;
 }
@@ -888,13 +1424,27 @@ pdf_resolve_indirect(fz_obj *ref)
 				fz_catch(error, "cannot load object (%d %d R) into cache", num, gen);
 				return ref;
 			}
-			if (xref->table[num].obj)
-				return xref->table[num].obj;
+			if (xref->slots[xref->table[num].slot].obj)
+				return xref->slots[xref->table[num].slot].obj;
 		}
 	}
 	return ref;
 }
 
+/* Put an object in the cache for good, leaving its xref entry alone */
+void
+pdf_set_cached_object(pdf_xref *xref, int num, fz_obj *obj)
+{
+	pdf_xref_slot *slot;
+
+	pdf_pin_object(xref, num);
+
+	slot = pdf_get_xref_slot(xref, num);
+	if (slot->obj)
+		fz_drop_obj(slot->obj);
+	slot->obj = fz_keep_obj(obj);
+}
+
 /* Replace numbered object -- for use by pdfclean and similar tools */
 void
 pdf_update_object(pdf_xref *xref, int num, int gen, fz_obj *newobj)
@@ -907,12 +1457,9 @@ pdf_update_object(pdf_xref *xref, int num, int gen, fz_obj *newobj)
 		return;
 	}
 
-	x = &xref->table[num];
-
-	if (x->obj)
-		fz_drop_obj(x->obj);
+	pdf_set_cached_object(xref, num, newobj);
 
-	x->obj = fz_keep_obj(newobj);
+	x = &xref->table[num];
 	x->type = 'n';
 	x->ofs = 0;
 }
@@ -938,3 +1485,26 @@ pdf_open_xref(pdf_xref **xrefp, const char *filename, char *password)
 	fz_close(file);
 	return fz_okay;
 }
+
+/*
+ * Open a file using the sidecar index to skip reading the xref and page
+ * tree, or write the index if it is missing or out of date.
+ */
+
+fz_error
+pdf_open_xref_with_index(pdf_xref **xrefp, const char *filename, char *password, const char *indexname)
+{
+	fz_error error;
+	fz_stream *file;
+
+	file = fz_open_file(filename);
+	if (!file)
+		return fz_throw("cannot open file '%s': %s", filename, strerror(errno));
+
+	error = pdf_open_xref_imp(xrefp, file, password, filename, indexname);
+	if (error)
+		return fz_rethrow(error, "cannot load document '%s'", filename);
+
+	fz_close(file);
+	return fz_okay;
+}
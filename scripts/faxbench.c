@@ -0,0 +1,319 @@
+/* faxbench.c -- time the CCITT fax decoder on synthetic scanned pages */
+
+#include "fitz.h"
+
+#ifdef _MSC_VER
+#include <winsock2.h>
+#else
+#include <sys/time.h>
+#endif
+
+/*
+ * Makes a text-like page of random glyph blobs, encodes it as G4 and as
+ * G3 1-D, and decodes it again through fz_open_faxd. The output is checked
+ * against the page, so this doubles as a round trip test of the decoder.
+ */
+
+struct code { int code, bits; };
+
+/* T.4 run length codes, terminating codes 0-63 then makeup codes 64-2560 */
+
+static const struct code white_term[64] =
+{
+	{0x35,8}, {0x7,6}, {0x7,4}, {0x8,4}, {0xb,4}, {0xc,4}, {0xe,4}, {0xf,4},
+	{0x13,5}, {0x14,5}, {0x7,5}, {0x8,5}, {0x8,6}, {0x3,6}, {0x34,6}, {0x35,6},
+	{0x2a,6}, {0x2b,6}, {0x27,7}, {0xc,7}, {0x8,7}, {0x17,7}, {0x3,7}, {0x4,7},
+	{0x28,7}, {0x2b,7}, {0x13,7}, {0x24,7}, {0x18,7}, {0x2,8}, {0x3,8}, {0x1a,8},
+	{0x1b,8}, {0x12,8}, {0x13,8}, {0x14,8}, {0x15,8}, {0x16,8}, {0x17,8}, {0x28,8},
+	{0x29,8}, {0x2a,8}, {0x2b,8}, {0x2c,8}, {0x2d,8}, {0x4,8}, {0x5,8}, {0xa,8},
+	{0xb,8}, {0x52,8}, {0x53,8}, {0x54,8}, {0x55,8}, {0x24,8}, {0x25,8}, {0x58,8},
+	{0x59,8}, {0x5a,8}, {0x5b,8}, {0x4a,8}, {0x4b,8}, {0x32,8}, {0x33,8}, {0x34,8},
+};
+
+static const struct code white_makeup[40] =
+{
+	{0x1b,5}, {0x12,5}, {0x17,6}, {0x37,7}, {0x36,8}, {0x37,8}, {0x64,8}, {0x65,8},
+	{0x68,8}, {0x67,8}, {0xcc,9}, {0xcd,9}, {0xd2,9}, {0xd3,9}, {0xd4,9}, {0xd5,9},
+	{0xd6,9}, {0xd7,9}, {0xd8,9}, {0xd9,9}, {0xda,9}, {0xdb,9}, {0x98,9}, {0x99,9},
+	{0x9a,9}, {0x18,6}, {0x9b,9}, {0x8,11}, {0xc,11}, {0xd,11}, {0x12,12}, {0x13,12},
+	{0x14,12}, {0x15,12}, {0x16,12}, {0x17,12}, {0x1c,12}, {0x1d,12}, {0x1e,12}, {0x1f,12},
+};
+
+static const struct code black_term[64] =
+{
+	{0x37,10}, {0x2,3}, {0x3,2}, {0x2,2}, {0x3,3}, {0x3,4}, {0x2,4}, {0x3,5},
+	{0x5,6}, {0x4,6}, {0x4,7}, {0x5,7}, {0x7,7}, {0x4,8}, {0x7,8}, {0x18,9},
+	{0x17,10}, {0x18,10}, {0x8,10}, {0x67,11}, {0x68,11}, {0x6c,11}, {0x37,11}, {0x28,11},
+	{0x17,11}, {0x18,11}, {0xca,12}, {0xcb,12}, {0xcc,12}, {0xcd,12}, {0x68,12}, {0x69,12},
+	{0x6a,12}, {0x6b,12}, {0xd2,12}, {0xd3,12}, {0xd4,12}, {0xd5,12}, {0xd6,12}, {0xd7,12},
+	{0x6c,12}, {0x6d,12}, {0xda,12}, {0xdb,12}, {0x54,12}, {0x55,12}, {0x56,12}, {0x57,12},
+	{0x64,12}, {0x65,12}, {0x52,12}, {0x53,12}, {0x24,12}, {0x37,12}, {0x38,12}, {0x27,12},
+	{0x28,12}, {0x58,12}, {0x59,12}, {0x2b,12}, {0x2c,12}, {0x5a,12}, {0x66,12}, {0x67,12},
+};
+
+static const struct code black_makeup[40] =
+{
+	{0xf,10}, {0xc8,12}, {0xc9,12}, {0x5b,12}, {0x33,12}, {0x34,12}, {0x35,12}, {0x6c,13},
+	{0x6d,13}, {0x4a,13}, {0x4b,13}, {0x4c,13}, {0x4d,13}, {0x72,13}, {0x73,13}, {0x74,13},
+	{0x75,13}, {0x76,13}, {0x77,13}, {0x52,13}, {0x53,13}, {0x54,13}, {0x55,13}, {0x5a,13},
+	{0x5b,13}, {0x64,13}, {0x65,13}, {0x8,11}, {0xc,11}, {0xd,11}, {0x12,12}, {0x13,12},
+	{0x14,12}, {0x15,12}, {0x16,12}, {0x17,12}, {0x1c,12}, {0x1d,12}, {0x1e,12}, {0x1f,12},
+};
+
+struct bits
+{
+	unsigned char *p;
+	int len;
+	unsigned int word;
+	int n;
+};
+
+static unsigned int seed = 1;
+
+static int
+rnd(int lo, int hi)
+{
+	seed = seed * 1103515245 + 12345;
+	return lo + (seed >> 16) % (hi - lo + 1);
+}
+
+static void
+putbits(struct bits *b, int code, int n)
+{
+	while (n--)
+	{
+		b->word = (b->word << 1) | ((code >> n) & 1);
+		if (++b->n == 8)
+		{
+			b->p[b->len++] = b->word;
+			b->word = 0;
+			b->n = 0;
+		}
+	}
+}
+
+static void
+flushbits(struct bits *b)
+{
+	if (b->n)
+		putbits(b, 0, 8 - b->n);
+}
+
+static void
+putrun(struct bits *b, int len, int black)
+{
+	const struct code *term = black ? black_term : white_term;
+	const struct code *makeup = black ? black_makeup : white_makeup;
+
+	while (len >= 2560)
+	{
+		putbits(b, makeup[39].code, makeup[39].bits);
+		len -= 2560;
+	}
+	if (len >= 64)
+	{
+		putbits(b, makeup[len / 64 - 1].code, makeup[len / 64 - 1].bits);
+		len %= 64;
+	}
+	putbits(b, term[len].code, term[len].bits);
+}
+
+/* first pixel at or after x that is not of the given color */
+static int
+findcolor(unsigned char *row, int w, int x, int color)
+{
+	while (x < w && row[x] == color)
+		x++;
+	return x;
+}
+
+static void
+encode_g4_row(struct bits *b, unsigned char *row, unsigned char *ref, int w)
+{
+	int a0 = -1, a1, a2, b1, b2;
+	int color = 0;
+
+	while (a0 < w)
+	{
+		a1 = findcolor(row, w, a0 + 1, color);
+		a2 = findcolor(row, w, a1 + 1, !color);
+
+		/* first changing element on the reference line right of a0, of the other color */
+		b1 = a0 + 1;
+		while (b1 < w && (ref[b1] == color || (b1 > 0 ? ref[b1 - 1] : 0) != color))
+			b1++;
+		b2 = findcolor(ref, w, b1 + 1, !color);
+
+		if (b2 < a1)
+		{
+			putbits(b, 1, 4);
+			a0 = b2;
+		}
+		else if (a1 - b1 >= -3 && a1 - b1 <= 3)
+		{
+			static const struct code vcodes[7] =
+				{ {2,7}, {2,6}, {2,3}, {1,1}, {3,3}, {3,6}, {3,7} };
+			putbits(b, vcodes[a1 - b1 + 3].code, vcodes[a1 - b1 + 3].bits);
+			a0 = a1;
+			color = !color;
+		}
+		else
+		{
+			putbits(b, 1, 3);
+			putrun(b, a1 - MAX(a0, 0), color);
+			putrun(b, a2 - a1, !color);
+			a0 = a2;
+		}
+	}
+}
+
+static void
+encode_g3_row(struct bits *b, unsigned char *row, int w)
+{
+	int x = 0, e, color = 0;
+
+	while (x < w)
+	{
+		e = findcolor(row, w, x, color);
+		putrun(b, e - x, color);
+		x = e;
+		color = !color;
+	}
+}
+
+static int
+encode(unsigned char *out, unsigned char *page, int w, int h, int k)
+{
+	unsigned char *white = calloc(w, 1);
+	struct bits b = { out, 0, 0, 0 };
+	int y;
+
+	for (y = 0; y < h; y++)
+	{
+		if (k < 0)
+			encode_g4_row(&b, page + y * w, y > 0 ? page + (y - 1) * w : white, w);
+		else
+			encode_g3_row(&b, page + y * w, w);
+	}
+	if (k < 0)
+	{
+		putbits(&b, 1, 12);
+		putbits(&b, 1, 12);
+	}
+	flushbits(&b);
+
+	free(white);
+	return b.len;
+}
+
+static void
+make_page(unsigned char *page, int w, int h)
+{
+	int x, y, gx, gy, gw, gh;
+
+	memset(page, 0, w * h);
+	for (y = 40; y + 30 < h; y += 32)
+	{
+		for (x = 50; x + 20 < w - 50; x += gw + rnd(2, 6))
+		{
+			gw = rnd(6, 16);
+			gh = rnd(12, 22);
+			for (gy = y + 22 - gh; gy < y + 22; gy++)
+				for (gx = x; gx < x + gw; gx++)
+					if (rnd(0, 9) < 7 || gy == y + 22 - gh || gy == y + 21)
+						page[gy * w + gx] = 1;
+			if (rnd(0, 99) < 15)
+				x += rnd(10, 30);
+		}
+	}
+}
+
+static double
+gettime(void)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	return now.tv_sec * 1000.0 + now.tv_usec / 1000.0;
+}
+
+static void
+setint(fz_obj *dict, char *key, int val)
+{
+	fz_obj *obj = fz_new_int(val);
+	fz_dict_puts(dict, key, obj);
+	fz_drop_obj(obj);
+}
+
+static void
+bench(char *name, unsigned char *page, int w, int h, int k, int iterations)
+{
+	int stride = (w + 7) / 8;
+	unsigned char *data = malloc(w * h * 2 + 16);
+	unsigned char *packed = calloc(stride, h);
+	fz_buffer *buf = NULL;
+	fz_stream *stm;
+	fz_obj *parms, *obj;
+	fz_error error;
+	double start, end;
+	int len, x, y, i;
+
+	len = encode(data, page, w, h, k);
+	for (y = 0; y < h; y++)
+		for (x = 0; x < w; x++)
+			if (page[y * w + x])
+				packed[y * stride + x / 8] |= 0x80 >> (x & 7);
+
+	parms = fz_new_dict(4);
+	setint(parms, "Columns", w);
+	setint(parms, "Rows", h);
+	setint(parms, "K", k);
+	obj = fz_new_bool(1);
+	fz_dict_puts(parms, "BlackIs1", obj);
+	fz_drop_obj(obj);
+
+	start = gettime();
+	for (i = 0; i < iterations; i++)
+	{
+		if (buf)
+			fz_drop_buffer(buf);
+		stm = fz_open_faxd(fz_open_memory(data, len), parms);
+		error = fz_read_all(&buf, stm, stride * h);
+		fz_close(stm);
+		if (error)
+			fz_catch(error, "cannot decode %s page", name);
+	}
+	end = gettime();
+
+	printf("%s: %d bytes, %.2f ms per page, %s\n", name, len,
+		(end - start) / iterations,
+		buf->len == stride * h && !memcmp(buf->data, packed, stride * h) ? "ok" : "MISMATCH");
+
+	fz_drop_buffer(buf);
+	fz_drop_obj(parms);
+	free(packed);
+	free(data);
+}
+
+int
+main(int argc, char **argv)
+{
+	int iterations = argc > 1 ? atoi(argv[1]) : 20;
+	int w = argc > 2 ? atoi(argv[2]) : 2480;
+	int h = argc > 3 ? atoi(argv[3]) : 3508;
+	unsigned char *page;
+
+	if (iterations < 1 || w < 1 || h < 1)
+	{
+		fprintf(stderr, "usage: faxbench [iterations [width height]]\n");
+		return 1;
+	}
+
+	page = malloc(w * h);
+	make_page(page, w, h);
+
+	bench("G4", page, w, h, -1, iterations);
+	bench("G3 1-D", page, w, h, 0, iterations);
+
+	free(page);
+	return 0;
+}
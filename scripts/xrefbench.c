@@ -0,0 +1,110 @@
+/* xrefbench.c -- time opening a file with a very large xref table */
+
+#include "fitz.h"
+#include "mupdf.h"
+
+#ifdef _MSC_VER
+#include <winsock2.h>
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+/*
+ * Opens the file and loads its page tree, and reports the time it took
+ * and the peak memory use. Given a number of objects, it first writes a
+ * synthetic file with a classic xref table and that many small objects.
+ */
+
+static void
+make_file(char *filename, int n)
+{
+	fz_off_t *ofs;
+	FILE *fp;
+	long x;
+	int i;
+
+	fp = fopen(filename, "wb");
+	if (!fp)
+	{
+		fprintf(stderr, "cannot create '%s'\n", filename);
+		exit(1);
+	}
+
+	ofs = fz_calloc(n, sizeof(fz_off_t));
+
+	fprintf(fp, "%%PDF-1.4\n");
+	ofs[1] = ftell(fp);
+	fprintf(fp, "1 0 obj\n<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+	ofs[2] = ftell(fp);
+	fprintf(fp, "2 0 obj\n<< /Type /Pages /Kids [3 0 R] /Count 1 >>\nendobj\n");
+	ofs[3] = ftell(fp);
+	fprintf(fp, "3 0 obj\n<< /Type /Page /Parent 2 0 R /MediaBox [0 0 100 100] >>\nendobj\n");
+	for (i = 4; i < n; i++)
+	{
+		ofs[i] = ftell(fp);
+		fprintf(fp, "%d 0 obj\n[%d]\nendobj\n", i, i);
+	}
+
+	x = ftell(fp);
+	fprintf(fp, "xref\n0 %d\n0000000000 65535 f \n", n);
+	for (i = 1; i < n; i++)
+		fprintf(fp, "%010ld 00000 n \n", (long)ofs[i]);
+	fprintf(fp, "trailer\n<< /Size %d /Root 1 0 R >>\nstartxref\n%ld\n%%%%EOF\n", n, x);
+
+	fz_free(ofs);
+	fclose(fp);
+}
+
+static double
+gettime(void)
+{
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	return now.tv_sec * 1000.0 + now.tv_usec / 1000.0;
+}
+
+int
+main(int argc, char **argv)
+{
+	fz_error error;
+	pdf_xref *xref;
+	double start, end;
+
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: xrefbench file.pdf [objects]\n");
+		return 1;
+	}
+
+	if (argc > 2)
+		make_file(argv[1], MAX(atoi(argv[2]), 4));
+
+	start = gettime();
+
+	error = pdf_open_xref(&xref, argv[1], NULL);
+	if (error)
+	{
+		fz_catch(error, "cannot open '%s'", argv[1]);
+		return 1;
+	}
+	error = pdf_load_page_tree(xref);
+	if (error)
+		fz_catch(error, "cannot load page tree");
+
+	end = gettime();
+
+	printf("%d objects, %d pages: %.1f ms\n", xref->len, pdf_count_pages(xref), end - start);
+
+#ifndef _WIN32
+	{
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		printf("peak memory: %ld MB\n", usage.ru_maxrss / 1024);
+	}
+#endif
+
+	pdf_free_xref(xref);
+
+	return 0;
+}
@@ -42,12 +42,15 @@ xps_paint_image_brush(xps_context *ctx, fz_matrix ctm, fz_rect area, char *base_
 	xml_element *root, void *vimage)
 {
 	fz_pixmap *pixmap = vimage;
+	fz_image *image;
 	float xs = pixmap->w * 96 / pixmap->xres;
 	float ys = pixmap->h * 96 / pixmap->yres;
 	fz_matrix im = fz_scale(xs, -ys);
 	im.f = ys;
 	ctm = fz_concat(im, ctm);
-	fz_fill_image(ctx->dev, pixmap, ctm, ctx->opacity[ctx->opacity_top]);
+	image = fz_new_image_from_pixmap(pixmap);
+	fz_fill_image(ctx->dev, image, ctm, ctx->opacity[ctx->opacity_top]);
+	fz_drop_image(image);
 }
 
 static xps_part *
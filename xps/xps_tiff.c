@@ -215,7 +215,7 @@ xps_decode_tiff_fax(struct tiff *tiff, int comp, fz_stream *chain, byte *wp, int
 static int
 xps_decode_tiff_jpeg(struct tiff *tiff, fz_stream *chain, byte *wp, int wlen)
 {
-	fz_stream *stm = fz_open_dctd(chain, NULL);
+	fz_stream *stm = fz_open_dctd(chain, NULL, 0);
 	int n = fz_read(stm, wp, wlen);
 	fz_close(stm);
 	if (n < 0)
@@ -32,15 +32,22 @@ static inline int getshort(fz_stream *file)
 	return a | b << 8;
 }
 
-static inline int getlong(fz_stream *file)
+static inline unsigned int getlong(fz_stream *file)
 {
-	int a = fz_read_byte(file);
-	int b = fz_read_byte(file);
-	int c = fz_read_byte(file);
-	int d = fz_read_byte(file);
+	unsigned int a = fz_read_byte(file);
+	unsigned int b = fz_read_byte(file);
+	unsigned int c = fz_read_byte(file);
+	unsigned int d = fz_read_byte(file);
 	return a | b << 8 | c << 16 | d << 24;
 }
 
+static inline fz_off_t getlong64(fz_stream *file)
+{
+	fz_off_t a = getlong(file);
+	fz_off_t b = getlong(file);
+	return a | b << 32;
+}
+
 static void *
 xps_zip_alloc_items(xps_context *ctx, int items, int size)
 {
@@ -156,10 +163,11 @@ xps_read_zip_entry(xps_context *ctx, xps_entry *ent, unsigned char *outbuf)
  */
 
 static int
-xps_read_zip_dir(xps_context *ctx, int start_offset)
+xps_read_zip_dir(xps_context *ctx, fz_off_t start_offset)
 {
+	fz_off_t offset, count;
+	fz_off_t csize, usize;
 	int sig;
-	int offset, count;
 	int namesize, metasize, commentsize;
 	int i;
 
@@ -176,6 +184,47 @@ xps_read_zip_dir(xps_context *ctx, int start_offset)
 	(void) getlong(ctx->file); /* size of central directory */
 	offset = getlong(ctx->file); /* offset to central directory */
 
+	/* ZIP64 */
+	if (count == 0xFFFF || offset == 0xFFFFFFFF)
+	{
+		fz_off_t offset64, count64;
+
+		fz_seek(ctx->file, start_offset - 20, 0);
+
+		sig = getlong(ctx->file);
+		if (sig != ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIG)
+			return fz_throw("wrong zip64 end of central directory locator signature (0x%x)", sig);
+
+		(void) getlong(ctx->file); /* start disk */
+		offset64 = getlong64(ctx->file); /* offset to end of central directory record */
+		if (offset64 < 0 || offset64 > start_offset)
+			return fz_throw("zip64 end of central directory out of range");
+
+		fz_seek(ctx->file, offset64, 0);
+
+		sig = getlong(ctx->file);
+		if (sig != ZIP64_END_OF_CENTRAL_DIRECTORY_SIG)
+			return fz_throw("wrong zip64 end of central directory signature (0x%x)", sig);
+
+		(void) getlong64(ctx->file); /* size of record */
+		(void) getshort(ctx->file); /* version made by */
+		(void) getshort(ctx->file); /* version to extract */
+		(void) getlong(ctx->file); /* disk number */
+		(void) getlong(ctx->file); /* disk number start */
+		count64 = getlong64(ctx->file); /* entries in central directory disk */
+		(void) getlong64(ctx->file); /* entries in central directory */
+		(void) getlong64(ctx->file); /* size of central directory */
+		offset64 = getlong64(ctx->file); /* offset to central directory */
+
+		if (count == 0xFFFF)
+			count = count64;
+		if (offset == 0xFFFFFFFF)
+			offset = offset64;
+	}
+
+	if (count < 0 || count > INT_MAX / (int)sizeof(xps_entry))
+		return fz_throw("too many entries in zip central directory");
+
 	ctx->zip_count = count;
 	ctx->zip_table = fz_calloc(count, sizeof(xps_entry));
 	memset(ctx->zip_table, 0, sizeof(xps_entry) * count);
@@ -195,8 +244,8 @@ xps_read_zip_dir(xps_context *ctx, int start_offset)
 		(void) getshort(ctx->file); /* last mod file time */
 		(void) getshort(ctx->file); /* last mod file date */
 		(void) getlong(ctx->file); /* crc-32 */
-		ctx->zip_table[i].csize = getlong(ctx->file);
-		ctx->zip_table[i].usize = getlong(ctx->file);
+		csize = getlong(ctx->file);
+		usize = getlong(ctx->file);
 		namesize = getshort(ctx->file);
 		metasize = getshort(ctx->file);
 		commentsize = getshort(ctx->file);
@@ -209,7 +258,43 @@ xps_read_zip_dir(xps_context *ctx, int start_offset)
 		fz_read(ctx->file, (unsigned char*)ctx->zip_table[i].name, namesize);
 		ctx->zip_table[i].name[namesize] = 0;
 
-		fz_seek(ctx->file, metasize, 1);
+		/* the zip64 extra field has the 64-bit values that overflowed */
+		while (metasize > 0)
+		{
+			int type = getshort(ctx->file);
+			int size = getshort(ctx->file);
+			if (type == ZIP64_EXTRA_FIELD_SIG)
+			{
+				int left = size;
+				if (usize == 0xFFFFFFFF && left >= 8)
+				{
+					usize = getlong64(ctx->file);
+					left -= 8;
+				}
+				if (csize == 0xFFFFFFFF && left >= 8)
+				{
+					csize = getlong64(ctx->file);
+					left -= 8;
+				}
+				if (ctx->zip_table[i].offset == 0xFFFFFFFF && left >= 8)
+				{
+					ctx->zip_table[i].offset = getlong64(ctx->file);
+					left -= 8;
+				}
+				fz_seek(ctx->file, left, 1);
+			}
+			else
+			{
+				fz_seek(ctx->file, size, 1);
+			}
+			metasize -= 4 + size;
+		}
+
+		if (csize < 0 || csize > INT_MAX || usize < 0 || usize >= INT_MAX)
+			return fz_throw("zip entry too large to read (%s)", ctx->zip_table[i].name);
+		ctx->zip_table[i].csize = csize;
+		ctx->zip_table[i].usize = usize;
+
 		fz_seek(ctx->file, commentsize, 1);
 	}
 
@@ -222,14 +307,14 @@ static int
 xps_find_and_read_zip_dir(xps_context *ctx)
 {
 	unsigned char buf[512];
-	int file_size, back, maxback;
+	fz_off_t file_size, back, maxback;
 	int i, n;
 
 	fz_seek(ctx->file, 0, SEEK_END);
 	file_size = fz_tell(ctx->file);
 
-	maxback = MIN(file_size, 0xFFFF + sizeof buf);
-	back = MIN(maxback, sizeof buf);
+	maxback = MIN(file_size, 0xFFFF + (int)sizeof buf);
+	back = MIN(maxback, (int)sizeof buf);
 
 	while (back < maxback)
 	{